@@ -1,9 +1,24 @@
 ARCHTUPLE=arm-none-eabi-
 DEVICE=VEX EDR V5
 
-MFLAGS=-mcpu=cortex-a9 -mfpu=neon-fp16 -mfloat-abi=softfp -Os -g
+# Set FLOAT_ABI to hard to pass floating point arguments and results in VFP
+# registers instead of core registers. Every object in the link has to agree,
+# so a project and its kernel template must be built with the same setting
+FLOAT_ABI?=softfp
+MFLAGS=-mcpu=cortex-a9 -mfpu=neon-fp16 -mfloat-abi=$(FLOAT_ABI) -Os -g
 CPPFLAGS=-D_POSIX_THREADS -D_UNIX98_THREAD_MUTEX_ATTRIBUTES
 GCCFLAGS=-ffunction-sections -fdata-sections -fdiagnostics-color -funwind-tables
+# Set EXCEPTIONS to 0 to build C++ without exception support, which drops the
+# landing pads and exception tables from every object. The unwind tables stay
+# so that crash backtraces still work. A kernel built this way is its own
+# template, and projects built against it can't throw or catch
+EXCEPTIONS?=1
+ifeq ($(EXCEPTIONS),0)
+GXXEXCEPTIONFLAGS=-fno-exceptions
+endif
+# The toolchain's libstdc++ is single threaded. Finding pros/gthr/bits/gthr-default.h
+# first swaps in the PROS gthreads backend, see pros/gthr-pros.h
+GTHREADFLAGS=-isystem"$(INCDIR)/pros/gthr" -D_GLIBCXX_HAS_GTHREADS -D_GLIBCXX_USE_SCHED_YIELD
 
 WARNFLAGS+=-Wno-psabi
 
@@ -17,17 +32,37 @@ DEPFLAGS = -MT $$@ -MMD -MP -MF $(DEPDIR)/$$*.Td
 MAKEDEPFOLDER = -$(VV)mkdir -p $(DEPDIR)/$$(dir $$(patsubst $(BINDIR)/%, %, $(ROOT)/$$@))
 RENAMEDEPENDENCYFILE = -$(VV)mv -f $(DEPDIR)/$$*.Td $$(patsubst $(SRCDIR)/%, $(DEPDIR)/%.d, $(ROOT)/$$<) && touch $$@
 
-LIBRARIES+=$(wildcard $(FWDIR)/*.a)
+ifeq ($(FLOAT_ABI),hard)
+# The newlib in firmware is softfp, so use the toolchain's hard float one
+EXCLUDE_FW_LIBRARIES=$(FWDIR)/libc.a $(FWDIR)/libm.a
+# libv5rts is softfp too. The calls to its functions which take or return
+# floating point values go through the shims in system/v5_abi.c, and the rest
+# are the same under either ABI, so the mismatch between the objects is safe
+V5_ABI_WRAPS=vexBatteryCapacityGet vexBatteryTemperatureGet vexDeviceImuDegreesGet vexDeviceImuHeadingGet
+V5_ABI_WRAPS+=vexDeviceMotorActualVelocityGet vexDeviceMotorEfficiencyGet vexDeviceMotorPositionGet
+V5_ABI_WRAPS+=vexDeviceMotorPowerGet vexDeviceMotorTargetGet vexDeviceMotorTemperatureGet vexDeviceMotorTorqueGet
+V5_ABI_WRAPS+=vexDeviceMotorPositionSet vexDeviceMotorAbsoluteTargetSet vexDeviceMotorRelativeTargetSet
+V5_ABI_LNK_FLAGS=--no-warn-mismatch $(foreach fn,$(V5_ABI_WRAPS),--wrap=$(fn))
+endif
+
+LIBRARIES+=$(filter-out $(EXCLUDE_FW_LIBRARIES), $(wildcard $(FWDIR)/*.a))
 # Cannot include newlib and libc because not all of the req'd stubs are implemented
 EXCLUDE_COLD_LIBRARIES+=$(FWDIR)/libc.a $(FWDIR)/libm.a
 COLD_LIBRARIES=$(filter-out $(EXCLUDE_COLD_LIBRARIES), $(LIBRARIES))
 wlprefix=-Wl,$(subst $(SPACE),$(COMMA),$1)
-LNK_FLAGS=--gc-sections --start-group $(strip $(LIBRARIES)) -lc -lm -lgcc -lstdc++ -lsupc++ --end-group
+# std::chrono::system_clock::now() and steady_clock::now(), which system/cpp_support.cpp reads off the global timer
+CLOCK_WRAPS=_ZNSt6chrono3_V212system_clock3nowEv _ZNSt6chrono3_V212steady_clock3nowEv
+CLOCK_LNK_FLAGS=$(foreach fn,$(CLOCK_WRAPS),--wrap=$(fn))
+LNK_FLAGS=$(V5_ABI_LNK_FLAGS) $(CLOCK_LNK_FLAGS) --gc-sections --start-group $(strip $(LIBRARIES)) -lc -lm -lgcc -lstdc++ -lsupc++ --end-group
 
 ASMFLAGS=$(MFLAGS) $(WARNFLAGS)
 CFLAGS=$(MFLAGS) $(CPPFLAGS) $(WARNFLAGS) $(GCCFLAGS) --std=gnu11
-CXXFLAGS=$(MFLAGS) $(CPPFLAGS) $(WARNFLAGS) $(GCCFLAGS) --std=gnu++17
+CXXFLAGS=$(MFLAGS) $(CPPFLAGS) $(WARNFLAGS) $(GCCFLAGS) $(GTHREADFLAGS) $(GXXEXCEPTIONFLAGS) --std=gnu++17
 LDFLAGS=$(MFLAGS) $(WARNFLAGS) -nostdlib $(GCCFLAGS)
+# Set per object with target or pattern-specific variables, e.g.
+# $(BINDIR)/hot/%.c.o: OBJ_OPTFLAGS=-O2
+# overrides the -Os above for the sources in src/hot
+OBJ_OPTFLAGS?=
 SIZEFLAGS=-d --common
 NUMFMTFLAGS=--to=iec --format %.2f --suffix=B
 
@@ -41,6 +76,7 @@ LD:=$(ARCHTUPLE)g++
 OBJCOPY:=$(ARCHTUPLE)objcopy
 SIZETOOL:=$(ARCHTUPLE)size
 READELF:=$(ARCHTUPLE)readelf
+PYTHON?=python3
 STRIP:=$(ARCHTUPLE)strip
 
 ifneq (, $(shell command -v gnumfmt 2> /dev/null))
@@ -234,6 +270,8 @@ $(COLD_ELF): $(COLD_LIBRARIES)
 
 $(HOT_BIN): $(HOT_ELF) $(COLD_BIN)
 	$(call test_output_2,Creating $@ for $(DEVICE) ,$(OBJCOPY) $< -O binary $@,$(DONE_STRING))
+	@# An unhashed hot package still runs, it just always gets uploaded in full
+	-$(call test_output_2,Hashing hot package chunks ,$(PYTHON) $(FWDIR)/hot-chunks.py hash $@,$(DONE_STRING))
 
 $(HOT_ELF): $(COLD_ELF) $(ELF_DEPS)
 	$(call _pros_ld_timestamp)
@@ -253,7 +291,7 @@ $(BINDIR)/%.$1.o: $(SRCDIR)/%.$1
 $(BINDIR)/%.$1.o: $(SRCDIR)/%.$1 $(DEPDIR)/$(basename $1).d
 	$(VV)mkdir -p $$(dir $$@)
 	$(MAKEDEPFOLDER)
-	$$(call test_output_2,Compiled $$< ,$(CC) -c $(INCLUDE) -iquote"$(INCDIR)/$$(dir $$*)" $(CFLAGS) $(EXTRA_CFLAGS) $(DEPFLAGS) -o $$@ $$<,$(OK_STRING))
+	$$(call test_output_2,Compiled $$< ,$(CC) -c $(INCLUDE) -iquote"$(INCDIR)/$$(dir $$*)" $(CFLAGS) $(EXTRA_CFLAGS) $$(OBJ_OPTFLAGS) $(DEPFLAGS) -o $$@ $$<,$(OK_STRING))
 	$(RENAMEDEPENDENCYFILE)
 endef
 $(foreach cext,$(CEXTS),$(eval $(call c_rule,$(cext))))
@@ -263,7 +301,7 @@ $(BINDIR)/%.$1.o: $(SRCDIR)/%.$1
 $(BINDIR)/%.$1.o: $(SRCDIR)/%.$1 $(DEPDIR)/$(basename %).d
 	$(VV)mkdir -p $$(dir $$@)
 	$(MAKEDEPFOLDER)
-	$$(call test_output_2,Compiled $$< ,$(CXX) -c $(INCLUDE) -iquote"$(INCDIR)/$$(dir $$*)" $(CXXFLAGS) $(EXTRA_CXXFLAGS) $(DEPFLAGS) -o $$@ $$<,$(OK_STRING))
+	$$(call test_output_2,Compiled $$< ,$(CXX) -c $(INCLUDE) -iquote"$(INCDIR)/$$(dir $$*)" $(CXXFLAGS) $(EXTRA_CXXFLAGS) $$(OBJ_OPTFLAGS) $(DEPFLAGS) -o $$@ $$<,$(OK_STRING))
 	$(RENAMEDEPENDENCYFILE)
 endef
 $(foreach cxxext,$(CXXEXTS),$(eval $(call cxx_rule,$(cxxext))))
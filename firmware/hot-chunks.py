@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+Hashes the chunks of a hot package and compares two hot packages by chunk.
+
+v5-hot.ld ends the hot image with a table of one CRC-32 per HOT_CHUNK_SIZE
+bytes of the image, followed by struct hot_chunks (include/system/hot.h):
+
+    uint32_t hashes[count];
+    uint32_t count, chunk_size, magic;
+
+The linker leaves the hashes zeroed and the magic HOT_CHUNKS_EMPTY.
+
+  hot-chunks.py hash hot.package.bin
+      Fills in the hashes and sets the magic to HOT_CHUNKS_MAGIC. The cold
+      image checks them before it installs the hot image.
+
+  hot-chunks.py diff old.package.bin new.package.bin
+      Prints as JSON the byte ranges of the new package which differ from the
+      old one, merging neighbouring chunks. An uploader which knows the brain
+      holds the old package only needs to send these ranges; any package
+      which wasn't hashed differs everywhere.
+"""
+
+import json
+import struct
+import sys
+import zlib
+
+HOT_CHUNKS_MAGIC = 0x4B4E4843
+HOT_CHUNKS_EMPTY = 0x00000000
+TRAILER = struct.Struct('<III')
+
+
+def read_table(image):
+    """Returns (offset of the hashes, chunk size, hashes, magic) of a package"""
+    if len(image) < TRAILER.size:
+        raise ValueError('too short to be a hot package')
+    count, chunk_size, magic = TRAILER.unpack_from(image, len(image) - TRAILER.size)
+    table = len(image) - TRAILER.size - 4 * count
+    if magic not in (HOT_CHUNKS_MAGIC, HOT_CHUNKS_EMPTY) or chunk_size == 0 or table < 0 or \
+            (table + chunk_size - 1) // chunk_size != count:
+        raise ValueError('no chunk table at the end of the package')
+    hashes = list(struct.unpack_from('<%dI' % count, image, table))
+    return table, chunk_size, hashes, magic
+
+
+def chunk_hashes(image, table, chunk_size):
+    return [zlib.crc32(image[i:min(i + chunk_size, table)]) for i in range(0, table, chunk_size)]
+
+
+def hash_package(path):
+    with open(path, 'rb') as f:
+        image = bytearray(f.read())
+    table, chunk_size, _, _ = read_table(image)
+    hashes = chunk_hashes(image, table, chunk_size)
+    struct.pack_into('<%dI' % len(hashes), image, table, *hashes)
+    struct.pack_into('<I', image, len(image) - 4, HOT_CHUNKS_MAGIC)
+    with open(path, 'wb') as f:
+        f.write(image)
+
+
+def diff_packages(old_path, new_path):
+    with open(new_path, 'rb') as f:
+        new = f.read()
+    table, chunk_size, new_hashes, magic = read_table(new)
+    if magic != HOT_CHUNKS_MAGIC:
+        new_hashes = chunk_hashes(new, table, chunk_size)
+    old_hashes = []
+    try:
+        with open(old_path, 'rb') as f:
+            old = f.read()
+        _, old_chunk_size, old_hashes, old_magic = read_table(old)
+        if old_magic != HOT_CHUNKS_MAGIC or old_chunk_size != chunk_size:
+            old_hashes = []
+    except (OSError, ValueError):
+        pass
+
+    changed = []
+    for i, h in enumerate(new_hashes):
+        if i < len(old_hashes) and old_hashes[i] == h:
+            continue
+        start = i * chunk_size
+        if changed and changed[-1][0] + changed[-1][1] == start:
+            changed[-1][1] += chunk_size
+        else:
+            changed.append([start, chunk_size])
+    # The chunk table itself always goes, and the last chunk may be short
+    if changed and changed[-1][0] + changed[-1][1] >= table:
+        changed[-1][1] = len(new) - changed[-1][0]
+    else:
+        changed.append([table, len(new) - table])
+    json.dump({'size': len(new), 'chunk_size': chunk_size, 'changed': changed}, sys.stdout)
+    print()
+
+
+if __name__ == '__main__':
+    try:
+        if len(sys.argv) == 3 and sys.argv[1] == 'hash':
+            hash_package(sys.argv[2])
+        elif len(sys.argv) == 4 and sys.argv[1] == 'diff':
+            diff_packages(sys.argv[2], sys.argv[3])
+        else:
+            sys.exit(__doc__)
+    except ValueError as e:
+        sys.exit('%s: %s' % (sys.argv[-1], e))
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Prints what each subsystem of the kernel takes of flash and RAM.
+
+  size-report.py [--size TOOL] [--nm TOOL] [--root DIR] [--top N] OBJECT...
+
+Runs the size tool over the objects and adds up their .text (with .rodata),
+.data and .bss by subsystem, which is the object's directory under --root
+(bin by default), one level deep except for system/dev and LVGL. The objects
+are measured before the link, so code the link drops with --gc-sections is
+still counted, but every static buffer and task stack is there as it will be.
+
+Then lists the --top largest variables (10 by default) found with nm, since
+a few buffers make up most of the RAM. Their sizes are set in
+include/system/kernel_config.h.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+from collections import defaultdict
+
+# nm symbol types which take RAM
+RAM_TYPES = {'b': '.bss', 'B': '.bss', 'd': '.data', 'D': '.data'}
+
+
+def subsystem(path, root):
+    """Returns the subsystem an object belongs to"""
+    rel = os.path.relpath(path, root)
+    parts = rel.split(os.sep)[:-1]
+    if not parts or parts[0] == '..':
+        return 'other'
+    if parts[0] == 'display' and len(parts) > 1 and parts[1].startswith('lv_'):
+        return 'display/lvgl'
+    if parts[:2] == ['system', 'dev']:
+        return 'system/dev'
+    return parts[0]
+
+
+def measure(size_tool, objects):
+    """Returns (text, data, bss, object) of each object, in Berkeley format"""
+    out = subprocess.run([size_tool, '-d', '--common'] + objects, check=True, stdout=subprocess.PIPE,
+                         universal_newlines=True).stdout
+    sizes = []
+    for line in out.splitlines()[1:]:
+        fields = line.split(None, 5)
+        if len(fields) == 6:
+            sizes.append((int(fields[0]), int(fields[1]), int(fields[2]), fields[5]))
+    return sizes
+
+
+def largest(nm_tool, objects, top):
+    """Returns (size, section, symbol, object) of the top largest variables"""
+    variables = []
+    for obj in objects:
+        out = subprocess.run([nm_tool, '-S', obj], check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+        for line in out.splitlines():
+            fields = line.split()
+            if len(fields) == 4 and fields[2] in RAM_TYPES:
+                variables.append((int(fields[1], 16), RAM_TYPES[fields[2]], fields[3], obj))
+    variables.sort(reverse=True)
+    return variables[:top]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Prints what each subsystem of the kernel takes of flash and RAM')
+    parser.add_argument('--size', default='arm-none-eabi-size')
+    parser.add_argument('--nm', default='arm-none-eabi-nm')
+    parser.add_argument('--root', default='bin')
+    parser.add_argument('--top', type=int, default=10)
+    parser.add_argument('objects', nargs='+')
+    args = parser.parse_args()
+
+    totals = defaultdict(lambda: [0, 0, 0])
+    for text, data, bss, obj in measure(args.size, args.objects):
+        total = totals[subsystem(obj, args.root)]
+        total[0] += text
+        total[1] += data
+        total[2] += bss
+
+    row = '{:<16}{:>10}{:>10}{:>10}{:>10}'
+    print(row.format('subsystem', 'text', 'data', 'bss', 'ram'))
+    grand = [0, 0, 0]
+    # the biggest reservations first
+    for name, (text, data, bss) in sorted(totals.items(), key=lambda item: -(item[1][1] + item[1][2])):
+        print(row.format(name, text, data, bss, data + bss))
+        grand = [grand[0] + text, grand[1] + data, grand[2] + bss]
+    print(row.format('total', grand[0], grand[1], grand[2], grand[1] + grand[2]))
+
+    if args.top > 0:
+        print('\nLargest variables:')
+        for size, section, symbol, obj in largest(args.nm, args.objects, args.top):
+            print('{:>10}  {:<6} {} ({})'.format(size, section, symbol, os.path.relpath(obj, args.root)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -49,10 +49,12 @@
 
 #include "pros/adi.h"
 #include "pros/colors.h"
+#include "pros/ext_adi.h"
 #include "pros/imu.h"
 #include "pros/llemu.h"
 #include "pros/misc.h"
 #include "pros/motors.h"
+#include "pros/odometry.h"
 #include "pros/rtos.h"
 #include "pros/vision.h"
 
@@ -60,6 +62,7 @@
 #include "pros/adi.hpp"
 #include "pros/imu.hpp"
 #include "pros/llemu.hpp"
+#include "pros/math.hpp"
 #include "pros/misc.hpp"
 #include "pros/motors.hpp"
 #include "pros/rtos.hpp"
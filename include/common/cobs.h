@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define COBS_ENCODE_MEASURE_MAX(src_len) ((src_len) + (((src_len) + 253) / 254))
@@ -52,3 +54,55 @@ int cobs_encode(uint8_t* restrict dest, const uint8_t* restrict src, const size_
  * \return The size of src when encoded
  */
 size_t cobs_encode_measure(const uint8_t* restrict src, const size_t src_len, const uint32_t prefix);
+
+// Streaming encoder: encodes in a single pass into a small buffer, handing the
+// bytes which are final (everything before the pending code byte) to flush
+// whenever the buffer fills up. The buffer must hold more than 255 bytes.
+typedef size_t (*cobs_flush_fn_t)(const uint8_t* data, size_t len, void* arg);
+
+typedef struct cobs_stream {
+	uint8_t* buf;
+	size_t size;
+	size_t write_idx;
+	size_t code_idx;
+	uint8_t code;
+	bool failed;  // set if flush accepted fewer bytes than it was given
+	cobs_flush_fn_t flush;
+	void* flush_arg;
+} cobs_stream_s_t;
+
+void cobs_stream_init(cobs_stream_s_t* stream, uint8_t* buf, size_t size, cobs_flush_fn_t flush, void* flush_arg,
+                      const uint32_t prefix);
+
+// Like cobs_stream_init, but the frame doesn't start with a stream prefix
+void cobs_stream_begin(cobs_stream_s_t* stream, uint8_t* buf, size_t size, cobs_flush_fn_t flush, void* flush_arg);
+
+void cobs_stream_write(cobs_stream_s_t* stream, const uint8_t* restrict src, const size_t src_len);
+
+// Finishes the frame, appends the 0 delimiter and flushes everything.
+// Returns false if any flush failed, in which case everything after the failed
+// flush was dropped rather than handed to flush
+bool cobs_stream_finish(cobs_stream_s_t* stream);
+
+// Streaming decoder: fed one byte at a time, decoding into buf. Frames which
+// don't fit in buf or are malformed are discarded
+typedef struct cobs_decoder {
+	uint8_t* buf;
+	size_t size;
+	size_t len;
+	uint8_t remaining;  // bytes left in the current block
+	bool pending_zero;  // the current block ends with an implicit 0
+	bool invalid;
+} cobs_decoder_s_t;
+
+void cobs_decoder_init(cobs_decoder_s_t* decoder, uint8_t* buf, size_t size);
+
+// Returns the length of the decoded frame when byte is the delimiter ending a
+// valid frame, -1 otherwise
+int32_t cobs_decode_byte(cobs_decoder_s_t* decoder, const uint8_t byte);
+
+// Decodes the data bytes at the start of src which continue the current block,
+// many at a time, and returns how many were consumed. Stops before the next
+// code byte, delimiter or byte which wouldn't fit, which should be passed to
+// cobs_decode_byte
+size_t cobs_decode_run(cobs_decoder_s_t* decoder, const uint8_t* src, const size_t len);
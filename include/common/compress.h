@@ -0,0 +1,33 @@
+/**
+ * \file common/compress.h
+ *
+ * Record compression header
+ *
+ * See common/compress.c for discussion
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Encodes each little endian 32-bit word of cur (the last zero extended) as the
+// zig-zag varint of its difference from the same word of prev. Returns the
+// length written to dest, or 0 if it would be more than cap
+size_t delta_encode(uint8_t* dest, size_t cap, const uint8_t* cur, const uint8_t* prev, size_t len);
+
+// The most bytes lz4_compress() takes, since its match positions are 16 bits
+#define LZ4_MAX_INPUT 0xfffe
+#define LZ4_HASH_BITS 12
+
+// Compresses src into an LZ4 block, using table (1 << LZ4_HASH_BITS entries) to
+// find matches. Returns the length written to dest, or 0 if it would be more
+// than cap or src is longer than LZ4_MAX_INPUT
+size_t lz4_compress(uint8_t* dest, size_t cap, const uint8_t* src, size_t len, uint16_t* table);
@@ -0,0 +1,31 @@
+/**
+ * \file common/crc.h
+ *
+ * Cyclic redundancy checks
+ *
+ * See common/crc.c for discussion
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CRC16_CCITT_INIT 0xffff
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021). Start with CRC16_CCITT_INIT and pass
+// the previous result to continue over more data
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t* data, size_t len);
+
+#define CRC32_INIT 0
+
+// CRC-32 as used by zlib and PNG (reflected polynomial 0xEDB88320). Start with
+// CRC32_INIT and pass the previous result to continue over more data
+uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len);
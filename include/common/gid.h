@@ -19,16 +19,15 @@
 #include "api.h"
 
 struct gid_metadata {
-	uint32_t* const bitmap;    // a constant pointer to a bitmap
-	const size_t max;          // Maximum gid value
-	const size_t reserved;     // first n GIDs may be reserved, at most 32, but at least 1
+	uint32_t* const bitmap;    // a constant pointer to a bitmap, set bits are free
+	const size_t max;          // Number of gids, every gid is less than this
+	const size_t reserved;     // first n GIDs may be reserved, but at least 1
 	const size_t bitmap_size;  // Cached number of uint32_t's used to map gid_max.
 	                           // Use gid_size_to_words to compute
 
 	// internal usage to ensure that GIDs get delegated linearly before wrapping
-	// around back to 0
+	// around back to 0. Only a hint, so it is updated without synchronization
 	size_t _cur_val;
-	mutex_t _lock;
 };
 
 #ifndef UINT32_WIDTH
@@ -52,6 +51,8 @@ void gid_init(struct gid_metadata* const metadata);
 /**
  * Allocates a gid from the gid structure and returns it.
  *
+ * This takes no lock, so it may be called from any task at any time.
+ *
  * \param[in] metadata
  *            The gid_metadata to record to the gid structure
  *
@@ -62,6 +63,8 @@ uint32_t gid_alloc(struct gid_metadata* const metadata);
 /**
  * Frees the gid specified from the structure.
  *
+ * This takes no lock, so it may be called from any task at any time.
+ *
  * \param[in] metadata
  *            The gid_metadata to free from the gid structure
  * \param id
@@ -4,7 +4,9 @@
  * Linked list implementation for internal use
  *
  * This file defines a linked list implementation that operates on the FreeRTOS
- * heap, and is able to generically store function pointers and data
+ * heap, and is able to generically store function pointers and data. A list
+ * can instead take its nodes from a pool, and an intrusive variant links nodes
+ * embedded in the payloads themselves so nothing is allocated at all.
  *
  * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
  *
@@ -15,6 +17,10 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include "kapi.h"
+
 typedef void (*generic_fn_t)(void);
 
 typedef struct ll_node_s {
@@ -27,6 +33,7 @@ typedef struct ll_node_s {
 
 typedef struct {
 	ll_node_s_t* head;
+	pool_t pool;  // where nodes come from, or NULL for the heap
 } linked_list_s_t;
 
 /**
@@ -56,6 +63,20 @@ ll_node_s_t* linked_list_init_data_node(void* data);
  */
 linked_list_s_t* linked_list_init();
 
+/**
+ * Initialize a linked list in caller-provided storage whose nodes are taken
+ * from a pool instead of the heap
+ *
+ * The pool's blocks must be at least sizeof(ll_node_s_t) bytes. When the pool
+ * is exhausted, inserting into the list does nothing.
+ *
+ * \param[out] list
+ *              Storage for the list
+ * \param pool
+ *        Pool to take nodes from, or NULL to use the heap
+ */
+void linked_list_init_static(linked_list_s_t* list, pool_t pool);
+
 /**
  * Prepend a node containing a function pointer to a linked list
  *
@@ -141,6 +162,29 @@ typedef void (*linked_list_foreach_fn_t)(ll_node_s_t*, void*);
  */
 void linked_list_foreach(linked_list_s_t* list, linked_list_foreach_fn_t, void* extra_data);
 
+/**
+ * Iterate over every node in a linked list without a callback
+ *
+ * The current node may be removed from the list (or freed) in the loop body.
+ *
+ * \param node
+ *        Name of the ll_node_s_t* loop variable
+ * \param list
+ *        Linked list to iterate over, which may be NULL
+ */
+#define linked_list_for_each(node, list) \
+	for (ll_node_s_t *node = (list) ? (list)->head : NULL, *node##_next = node ? node->next : NULL; node != NULL; \
+	     node = node##_next, node##_next = node ? node->next : NULL)
+
+/**
+ * Removes every node from a linked list, leaving it empty but valid. This does
+ * not free any internal data.
+ *
+ * \param list
+ *				List to clear
+ */
+void linked_list_clear(linked_list_s_t* list);
+
 /**
  * Frees a linked_list_s_t, making it no longer a valid list. This does not free any
  * internal data, only the linekd_list structure.
@@ -149,3 +193,86 @@ void linked_list_foreach(linked_list_s_t* list, linked_list_foreach_fn_t, void*
  *				List to free
  */
 void linked_list_free(linked_list_s_t* list);
+
+/**
+ * A link embedded in a structure to make it a node of an intrusive list, which
+ * needs no allocation to insert into
+ */
+typedef struct ll_link_s {
+	struct ll_link_s* next;
+} ll_link_s_t;
+
+typedef struct {
+	ll_link_s_t* head;
+} intrusive_list_s_t;
+
+/**
+ * Get the structure a link is embedded in
+ *
+ * \param link
+ *        Pointer to the link
+ * \param type
+ *        Type of the structure containing the link
+ * \param member
+ *        Name of the link within the structure
+ */
+#define ll_container_of(link, type, member) ((type*)((char*)(link)-offsetof(type, member)))
+
+/**
+ * Initialize an empty intrusive list
+ *
+ * \param[out] list
+ *              List to initialize
+ */
+static inline void intrusive_list_init(intrusive_list_s_t* list) {
+	list->head = NULL;
+}
+
+/**
+ * Prepend a node to an intrusive list
+ *
+ * \param[in, out] list
+ *                 List to which the node will be prepended
+ * \param[in, out] link
+ *                 Link of the node, which must not already be in a list
+ */
+static inline void intrusive_list_prepend(intrusive_list_s_t* list, ll_link_s_t* link) {
+	link->next = list->head;
+	list->head = link;
+}
+
+/**
+ * Append a node to an intrusive list
+ *
+ * \param[in, out] list
+ *                 List to which the node will be appended
+ * \param[in, out] link
+ *                 Link of the node, which must not already be in a list
+ */
+void intrusive_list_append(intrusive_list_s_t* list, ll_link_s_t* link);
+
+/**
+ * Remove a node from an intrusive list
+ *
+ * \param[in, out] list
+ *                 List from which the node will be removed
+ * \param[in, out] link
+ *                 Link of the node to remove
+ *
+ * \return True if the node was found in the list, false otherwise
+ */
+bool intrusive_list_remove(intrusive_list_s_t* list, ll_link_s_t* link);
+
+/**
+ * Iterate over every link in an intrusive list without a callback
+ *
+ * The current node may be removed from the list (or freed) in the loop body.
+ *
+ * \param link
+ *        Name of the ll_link_s_t* loop variable
+ * \param list
+ *        Intrusive list to iterate over
+ */
+#define intrusive_list_for_each(link, list) \
+	for (ll_link_s_t *link = (list)->head, *link##_next = link ? link->next : NULL; link != NULL; \
+	     link = link##_next, link##_next = link ? link->next : NULL)
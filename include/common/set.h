@@ -20,12 +20,25 @@
 #include <stdint.h>
 #include "kapi.h"
 
-struct set {
-	uint32_t* arr;
+// An open-addressed hash table of items. Tables are never modified once
+// published, so readers can probe one without locking
+struct set_table {
+	size_t capacity;  // a power of two
 	size_t used;
-	size_t size;
+	bool has_zero;    // 0 marks an empty slot, so it is kept out of items
+	uint32_t items[];
+};
+
+struct set {
+	struct set_table* table;
+	// Bumped whenever the set changes, so callers can cache lookups
+	uint32_t generation;
+	// Readers register in the current epoch's count while they hold a table, so
+	// the writer which replaced it knows when it can be freed
+	uint32_t epoch;
+	uint32_t readers[2];
 	static_sem_s_t mtx_buf;
-	mutex_t mtx;
+	mutex_t mtx;  // serializes writers
 };
 
 /**
@@ -63,6 +76,9 @@ bool set_rm(struct set* const set, uint32_t item);
 /**
  * Checks if the set contains an item
  *
+ * This doesn't lock anything, so it is safe to call on every write to a
+ * stream.
+ *
  * \param set
  *        A pointer to the set structure
  * \param item
@@ -72,6 +88,20 @@ bool set_rm(struct set* const set, uint32_t item);
  */
 bool set_contains(struct set* set, uint32_t item);
 
+/**
+ * Gets a number which changes whenever an item is added to or removed from the
+ * set
+ *
+ * A lookup cached alongside the generation it was made in is still valid as
+ * long as the generation hasn't changed. The generation is never 0.
+ *
+ * \param set
+ *        A pointer to the set structure
+ *
+ * \return The set's generation
+ */
+uint32_t set_generation(struct set* set);
+
 /**
  * Checks if the list contains an item
  *
@@ -23,9 +23,9 @@
 #else                        /*LV_MEM_CUSTOM*/
 #define LV_MEM_CUSTOM_INCLUDE                                                  \
   "kapi.h"                          /*Header for the dynamic memory function*/
-#define LV_MEM_CUSTOM_ALLOC kmalloc /*Wrapper to malloc*/
-#define LV_MEM_CUSTOM_FREE kfree    /*Wrapper to free*/
-#endif                              /*LV_MEM_CUSTOM*/
+#define LV_MEM_CUSTOM_ALLOC display_mem_alloc /*Wrapper to malloc, kmalloc or a display arena*/
+#define LV_MEM_CUSTOM_FREE display_mem_free    /*Wrapper to free*/
+#endif                                         /*LV_MEM_CUSTOM*/
 #define LV_ENABLE_GC 0
 
 /*===================
@@ -41,10 +41,13 @@
  * Required for buffered drawing, opacity and anti-aliasing
  * VDB makes the double buffering, you don't need to deal with it!
  * Typical size: ~1/10 screen */
-#define LV_VDB_SIZE                                                            \
-  (LV_VER_RES *                                                                \
-   LV_HOR_RES) /*Size of VDB in pixel count (1/10 screen size is good for      \
-                  first)*/
+/* The kernel is built with the sizes in system/kernel_config.h, and programs
+ * which include this header don't use them */
+#ifdef KERNEL_DISPLAY_VDB_SIZE
+#define LV_VDB_SIZE KERNEL_DISPLAY_VDB_SIZE
+#else
+#define LV_VDB_SIZE (LV_VER_RES * LV_HOR_RES) /*Size of VDB in pixel count*/
+#endif
 #define LV_VDB_ADR                                                             \
   0 /*Place VDB to a specific address (e.g. in external RAM) (0: allocate      \
        automatically into RAM)*/
@@ -52,17 +55,37 @@
 /* Use two Virtual Display buffers (VDB) parallelize rendering and flushing
  * (optional)
  * The flushing should use DMA to write the frame buffer in the background*/
-#define LV_VDB_DOUBLE 0 /*1: Enable the use of 2 VDBs*/
+#ifdef KERNEL_DISPLAY_VDB_DOUBLE
+#define LV_VDB_DOUBLE KERNEL_DISPLAY_VDB_DOUBLE
+#else
+#define LV_VDB_DOUBLE 1 /*1: Enable the use of 2 VDBs*/
+#endif
 #define LV_VDB2_ADR                                                            \
   0 /*Place VDB2 to a specific address (e.g. in external RAM) (0: allocate     \
        automatically into RAM)*/
 
+/* Block instead of spinning while waiting for a flush to finish */
+#define LV_VDB_FLUSH_WAIT_INCLUDE "kapi.h" /*Header for the wait function*/
+#define LV_VDB_FLUSH_WAIT() display_flush_wait()
+
 /* Enable anti-aliasing (lines, and radiuses will be smoothed) */
 #define LV_ANTIALIAS 1 /*1: Enable anti-aliasing*/
 
 /*Screen refresh settings*/
 #define LV_REFR_PERIOD 40   /*Screen refresh period in milliseconds*/
 #define LV_INV_FIFO_SIZE 32 /*The average count of objects on a screen */
+#define LV_INV_TILE_SIZE 16 /*Merge invalidated areas on tiles of this size (0: only overlapping areas)*/
+
+/*Bytes of decoded letters to keep for drawing them again (0: decode the font's bitmap every time)*/
+#define LV_GLYPH_CACHE_SIZE (16 * 1024)
+
+/*Bytes of full shadow corner masks to keep for drawing them again (0: calculate the blur every time)*/
+#define LV_SHADOW_CACHE_SIZE (8 * 1024)
+
+/*Time the design functions of every object type (0: don't time them)*/
+#define LV_REFR_PROFILE 1
+#define LV_REFR_PROFILE_TIME_INCLUDE "kapi.h" /*Header for the time function*/
+#define LV_REFR_PROFILE_TIME() ((uint32_t)micros())
 
 /*=================
    Misc. setting
@@ -115,6 +138,9 @@
 /*================
  *  THEME USAGE
  *================*/
+/* A theme which is turned off here is left out of the library and its init
+ * function is hidden from the headers shipped with the kernel. The kernel
+ * itself falls back to the default styles when the alien theme is off. */
 #define LV_THEME_LIVE_UPDATE 1
 #define USE_LV_THEME_TEMPL 0 /*Just for test*/
 #define USE_LV_THEME_DEFAULT 0 /*Built mainly from the built-in styles. Consumes very few RAM*/
@@ -123,6 +149,7 @@
 #define USE_LV_THEME_MONO 1 /*Mono color theme for monochrome displays*/
 #define USE_LV_THEME_MATERIAL 1 /*Flat theme with bold colors and light shadows*/
 #define USE_LV_THEME_ZEN 1 /*Peaceful, mainly light theme */
+#define USE_LV_THEME_NEMO 1 /*Water-like theme based on the movie "Finding Nemo"*/
 
 /*==================
  *    FONT USAGE
@@ -130,42 +157,92 @@
 
 /* More info about fonts: https://littlevgl.com/basics#fonts
  * To enable a built-in font use 1,2,4 or 8 values
- * which will determine the bit-per-pixel */
+ * which will determine the bit-per-pixel.
+ * A build can choose other fonts, e.g. make EXTRA_CFLAGS=-DUSE_LV_FONT_DEJAVU_40=4
+ * The glyphs are compressed, see lv_fonts/lv_font_compress.py */
 #define LV_FONT_DEFAULT                                                        \
   &lv_font_dejavu_20 /*Always set a default font from the built-in fonts*/
 
+#ifndef USE_LV_FONT_DEJAVU_10
 #define USE_LV_FONT_DEJAVU_10 4
+#endif
+#ifndef USE_LV_FONT_DEJAVU_10_LATIN_SUP
 #define USE_LV_FONT_DEJAVU_10_LATIN_SUP 4
+#endif
+#ifndef USE_LV_FONT_DEJAVU_10_CYRILLIC
 #define USE_LV_FONT_DEJAVU_10_CYRILLIC 4
+#endif
+#ifndef USE_LV_FONT_SYMBOL_10
 #define USE_LV_FONT_SYMBOL_10 4
+#endif
 
+#ifndef USE_LV_FONT_DEJAVU_20
 #define USE_LV_FONT_DEJAVU_20 4
+#endif
+#ifndef USE_LV_FONT_DEJAVU_20_LATIN_SUP
 #define USE_LV_FONT_DEJAVU_20_LATIN_SUP 4
+#endif
+#ifndef USE_LV_FONT_DEJAVU_20_CYRILLIC
 #define USE_LV_FONT_DEJAVU_20_CYRILLIC 4
+#endif
+#ifndef USE_LV_FONT_SYMBOL_20
 #define USE_LV_FONT_SYMBOL_20 4
+#endif
 
+#ifndef USE_LV_FONT_DEJAVU_30
 #define USE_LV_FONT_DEJAVU_30 0
+#endif
+#ifndef USE_LV_FONT_DEJAVU_30_LATIN_SUP
 #define USE_LV_FONT_DEJAVU_30_LATIN_SUP 0
+#endif
+#ifndef USE_LV_FONT_DEJAVU_30_CYRILLIC
 #define USE_LV_FONT_DEJAVU_30_CYRILLIC 0
+#endif
+#ifndef USE_LV_FONT_SYMBOL_30
 #define USE_LV_FONT_SYMBOL_30 0
+#endif
 
+#ifndef USE_LV_FONT_DEJAVU_40
 #define USE_LV_FONT_DEJAVU_40 0
+#endif
+#ifndef USE_LV_FONT_DEJAVU_40_LATIN_SUP
 #define USE_LV_FONT_DEJAVU_40_LATIN_SUP 0
+#endif
+#ifndef USE_LV_FONT_DEJAVU_40_CYRILLIC
 #define USE_LV_FONT_DEJAVU_40_CYRILLIC 0
+#endif
+#ifndef USE_LV_FONT_SYMBOL_40
 #define USE_LV_FONT_SYMBOL_40 0
+#endif
 
 /* PROS adds the mono variant of DejaVu sans */
+#ifndef USE_PROS_FONT_DEJAVU_MONO_10
 #define USE_PROS_FONT_DEJAVU_MONO_10 4
+#endif
+#ifndef USE_PROS_FONT_DEJAVU_MONO_10_LATIN_SUP
 #define USE_PROS_FONT_DEJAVU_MONO_10_LATIN_SUP 4
+#endif
 
+#ifndef USE_PROS_FONT_DEJAVU_MONO_20
 #define USE_PROS_FONT_DEJAVU_MONO_20 4
+#endif
+#ifndef USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20
 #define USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 4
+#endif
 
+#ifndef USE_PROS_FONT_DEJAVU_MONO_30
 #define USE_PROS_FONT_DEJAVU_MONO_30 0
+#endif
+#ifndef USE_PROS_FONT_DEJAVU_MONO_30_LATIN_SUP
 #define USE_PROS_FONT_DEJAVU_MONO_30_LATIN_SUP 0
+#endif
 
+#ifndef USE_PROS_FONT_DEJAVU_MONO_40
 #define USE_PROS_FONT_DEJAVU_MONO_40 0
+#endif
+#ifndef USE_PROS_FONT_DEJAVU_MONO_40_LATIN_SUP
 #define USE_PROS_FONT_DEJAVU_MONO_40_LATIN_SUP 0
+#endif
 
 /*===================
  *  LV_OBJ SETTINGS
@@ -179,6 +256,12 @@
  *================*/
 /*
  * Documentation of the object types: https://littlevgl.com/object-types
+ *
+ * An object type which is turned off here is left out of the library and its
+ * API is hidden from the headers shipped with the kernel, so the cold image
+ * shrinks by its code and styles. The headers refuse to build if a type is
+ * turned off while a type still turned on depends on it. LLEMU needs lv_cont,
+ * lv_btn and lv_label, and the error screen needs lv_win and lv_label.
  */
 
 /*****************
@@ -198,6 +281,7 @@
 #if USE_LV_IMG != 0
 #  define LV_IMG_CF_INDEXED 1
 #  define LV_IMG_CF_ALPHA 1
+#  define LV_IMG_CACHE_DEF_SIZE (512 * 1024) /*Bytes of decoded image files to keep in memory (0: no cache)*/
 #endif
 
 /*Line (dependencies: -*/
@@ -266,7 +350,8 @@
 #define USE_LV_SPINBOX 1
 #define USE_LV_CALENDAR 1
 
-#define USE_PRELOAD 1
+/*Preloader (dependencies: lv_arc, animations)*/
+#define USE_LV_PRELOAD 1
 #if USE_LV_PRELOAD != 0
 #  define LV_PRELOAD_DEF_ARC_LENGTH 60
 #  define LV_PRELOAD_DEF_SPIN_TIME 1000
@@ -338,4 +423,12 @@
 #  define _CRT_SECURE_NO_WARNINGS
 #endif
 #include "display/lv_conf_checker.h"
+
+/*The object types the kernel's own screens are built from*/
+#if USE_LV_CONT == 0 || USE_LV_BTN == 0 || USE_LV_LABEL == 0
+#error "LLEMU needs lv_cont, lv_btn and lv_label. Enable them in lv_conf.h"
+#endif
+#if USE_LV_WIN == 0
+#error "The error screen needs lv_win. Enable it in lv_conf.h (USE_LV_WIN  1)"
+#endif
 #endif /*LV_CONF_H*/
@@ -425,6 +425,9 @@
 #ifndef LV_IMG_CF_ALPHA
 #  define LV_IMG_CF_ALPHA     1       /*Enable alpha indexed images*/
 #endif
+#ifndef LV_IMG_CACHE_DEF_SIZE
+#  define LV_IMG_CACHE_DEF_SIZE 0    /*Bytes of decoded image files to keep in memory (0: no cache)*/
+#endif
 #endif
 
 /*Line (dependencies: -*/
@@ -145,6 +145,17 @@ lv_indev_feedback_t lv_indev_get_feedback(const lv_indev_t *indev);
  */
 void lv_indev_wait_release(lv_indev_t * indev);
 
+/**
+ * Read and process the input devices at the next `lv_task_handler`, e.g. when a driver knows its state changed
+ */
+void lv_indev_read_now(void);
+
+/**
+ * Change how often the input devices are read
+ * @param period new period of the reads in milliseconds (LV_INDEV_READ_PERIOD by default)
+ */
+void lv_indev_set_read_period(uint32_t period);
+
 /**********************
  *      MACROS
  **********************/
@@ -19,10 +19,24 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#if LV_REFR_PROFILE
+#define LV_REFR_PROFILE_BUCKETS 8   /*Draw times are counted in buckets of < 16, < 32, ... < 1024 and >= 1024 time units*/
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_REFR_PROFILE
+/*The draw times of an object type, see `lv_refr_get_profile()`*/
+typedef struct {
+    lv_signal_func_t signal_func;   /*Every object type has its own signal function*/
+    const char * type;              /*Name of the type, e.g. "lv_btn"*/
+    uint32_t draws;                 /*The number of objects drawn*/
+    uint32_t time;                  /*Total time in the design functions in LV_REFR_PROFILE_TIME() units*/
+    uint32_t max_time;              /*The longest time an object took*/
+    uint32_t histogram[LV_REFR_PROFILE_BUCKETS];
+} lv_refr_profile_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -53,6 +67,12 @@ void lv_refr_init(void);
  */
 void lv_refr_now(void);
 
+/**
+ * Change how often the invalidated areas are redrawn
+ * @param period new period of the refresh in milliseconds (LV_REFR_PERIOD by default)
+ */
+void lv_refr_set_period(uint32_t period);
+
 /**
  * Invalidate an area
  * @param area_p pointer to area which should be invalidated
@@ -83,6 +103,20 @@ uint16_t lv_refr_get_buf_size(void);
  * @param num number of areas to delete
  */
 void lv_refr_pop_from_buf(uint16_t num);
+
+#if LV_REFR_PROFILE
+/**
+ * Get the draw times of the object types drawn since start up or `lv_refr_reset_profile()`
+ * @param cnt store the number of object types here
+ * @return array of 'cnt' profiles, in the order the types were first drawn
+ */
+const lv_refr_profile_t * lv_refr_get_profile(uint16_t * cnt);
+
+/**
+ * Forget the draw times of every object type
+ */
+void lv_refr_reset_profile(void);
+#endif
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -154,6 +154,29 @@ bool lv_img_color_format_is_chroma_keyed(lv_img_cf_t cf);
 
 bool lv_img_color_format_has_alpha(lv_img_cf_t cf);
 
+/**
+ * Set how many bytes of decoded image files to keep in memory. Image files are decoded
+ * to `lv_color_t` pixels the first time they are drawn and then drawn like variable images,
+ * and the least recently drawn ones are dropped when the cache would outgrow this size.
+ * Alpha-only images, whose colors come from the style, and images bigger than the whole cache
+ * are still read from their files on every draw.
+ * @param size the new size of the cache in bytes (0: don't cache)
+ */
+void lv_img_cache_set_size(uint32_t size);
+
+/**
+ * Drop an image file from the cache, e.g. after it was changed on the card.
+ * The objects showing it have to be invalidated to redraw it.
+ * @param src path of the file (e.g. "S:/folder/image.bin"), or NULL to drop every image
+ */
+void lv_img_cache_invalidate_src(const char * src);
+
+/**
+ * Get how many bytes the image cache uses
+ * @return size of the cached images and their paths in bytes
+ */
+uint32_t lv_img_cache_get_used(void);
+
 
 /**********************
  *      MACROS
@@ -41,6 +41,21 @@ extern "C" {
 void lv_draw_label(const lv_area_t * coords,const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
                    const char * txt, lv_txt_flag_t flag, lv_point_t * offset);
 
+/**
+ * Write a text, reusing its line breaks from the last time if nothing changed
+ * @param coords coordinates of the label
+ * @param mask the label will be drawn only in this area
+ * @param style pointer to a style
+ * @param opa_scale scale down all opacities by the factor
+ * @param txt 0 terminated text to write
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @param offset text offset in x and y direction (NULL if unused)
+ * @param layout the line breaks of 'txt', updated if they are out of date (NULL to lay it out from scratch)
+ */
+void lv_draw_label_layout(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style,
+                          lv_opa_t opa_scale, const char * txt, lv_txt_flag_t flag, lv_point_t * offset,
+                          lv_txt_layout_t * layout);
+
 /**********************
  *      MACROS
  **********************/
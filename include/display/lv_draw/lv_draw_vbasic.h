@@ -61,6 +61,12 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
                 const lv_font_t * font_p, uint32_t letter,
                 lv_color_t color, lv_opa_t opa);
 
+/**
+ * Forget the opacity maps of the letters 'lv_vletter' decoded.
+ * Call it before a font which was drawn is freed or changed.
+ */
+void lv_vletter_cache_clear(void);
+
 /**
  * Draw a color map to the display (image)
  * @param cords_p coordinates the color map
@@ -52,13 +52,14 @@ typedef struct _lv_font_struct
     uint32_t unicode_last;
     const uint8_t * glyph_bitmap;
     const lv_font_glyph_dsc_t * glyph_dsc;
-    const uint32_t * unicode_list;
+    const uint32_t * unicode_list;         /*Ascending list of the letters of a sparse font, terminated by 0 (NULL: continuous)*/
     const uint8_t * (*get_bitmap)(const struct _lv_font_struct *,uint32_t);     /*Get a glyph's  bitmap from a font*/
     int16_t (*get_width)(const struct _lv_font_struct *,uint32_t);        /*Get a glyph's with with a given font*/
     struct _lv_font_struct * next_page;    /*Pointer to a font extension*/
     uint32_t h_px       :8;
     uint32_t bpp        :4;                /*Bit per pixel: 1, 2 or 4*/
     uint32_t monospace  :8;                /*Fix width (0: normal width)*/
+    uint32_t compressed :1;                /*The glyphs are packed with PackBits, see `lv_font_decompress`*/
     uint16_t glyph_cnt;                    /*Number of glyphs (letters) in the font*/
 } lv_font_t;
 
@@ -136,6 +137,24 @@ static inline uint8_t lv_font_get_height(const lv_font_t * font_p)
  */
 uint8_t lv_font_get_bpp(const lv_font_t * font, uint32_t letter);
 
+/**
+ * Tells if the glyph of a letter is compressed
+ * @param font pointer to font
+ * @param letter a letter from font (font extensions can be compressed or not)
+ * @return true: the bitmap of the letter has to be unpacked with `lv_font_decompress`
+ */
+bool lv_font_is_compressed(const lv_font_t * font, uint32_t letter);
+
+/**
+ * Unpack the bitmap of a compressed glyph.
+ * A header byte 'n' of 0..127 is followed by 'n + 1' bytes to copy,
+ * one of 129..255 by a byte to repeat '257 - n' times.
+ * @param src the compressed bitmap (from `lv_font_get_bitmap`)
+ * @param dest store the bitmap here
+ * @param len length of the unpacked bitmap (the rows of the glyph)
+ */
+void lv_font_decompress(const uint8_t * src, uint8_t * dest, uint32_t len);
+
 /**
  * Generic bitmap get function used in 'font->get_bitmap' when the font contains all characters in the range
  * @param font pointer to font
@@ -35,6 +35,7 @@ extern "C" {
     prefix lv_ll_t _lv_drv_ll;\
     prefix lv_ll_t _lv_file_ll;\
     prefix lv_ll_t _lv_anim_ll;\
+    prefix lv_ll_t _lv_img_cache_ll;  /*Decoded image files, most recently drawn first*/ \
     prefix void * _lv_def_scr;\
     prefix void * _lv_act_scr;\
     prefix void * _lv_top_layer;\
@@ -60,6 +60,7 @@ typedef struct
     void * param;
     uint8_t prio:3;
     uint8_t once:1;
+    uint8_t pass;       /*The `lv_task_handler` call it last ran in*/
 } lv_task_t;
 
 /**********************
@@ -73,8 +74,9 @@ void lv_task_init(void);
 
 /**
  * Call it  periodically to handle lv_tasks.
+ * @return milliseconds until the next call has something to do, see `lv_task_get_time_till_next`
  */
-LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void);
+LV_ATTRIBUTE_TASK_HANDLER uint32_t lv_task_handler(void);
 
 /**
  * Create a new lv_task
@@ -138,6 +140,13 @@ void lv_task_enable(bool en);
  */
 uint8_t lv_task_get_idle(void);
 
+/**
+ * Get the time until the next lv_task is due, e.g. to sleep until then between calls of `lv_task_handler`
+ * @return milliseconds until 'lv_task_handler' has something to do (0: now, UINT32_MAX: nothing to do,
+ *         because there are no lv_tasks or the lv_task handling is suspended)
+ */
+uint32_t lv_task_get_time_till_next(void);
+
 /**********************
  *      MACROS
  **********************/
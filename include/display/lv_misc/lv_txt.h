@@ -50,6 +50,37 @@ enum
 };
 typedef uint8_t lv_txt_cmd_state_t;
 
+/**
+ * A line of a laid out text
+ */
+typedef struct
+{
+    uint32_t start;         /*Byte index of the line's first letter*/
+    lv_coord_t width;       /*Width of the line as 'lv_txt_get_width' gives it*/
+} lv_txt_line_t;
+
+/**
+ * The line breaks of a text, kept until the text or the settings it was laid out with change
+ */
+typedef struct
+{
+    /*What the text was laid out with (Handled by the library)*/
+    const char * txt;
+    uint32_t txt_hash;
+    uint32_t txt_len;
+    const lv_font_t * font;
+    lv_coord_t letter_space;
+    lv_coord_t max_width;
+    lv_txt_flag_t flag;
+    uint8_t valid       :1;
+    uint8_t unwrapped   :1;     /*No line was broken to fit 'max_width'*/
+
+    lv_txt_line_t * lines;
+    uint16_t line_cnt;
+    uint16_t line_cap;          /*Number of lines 'lines' has room for*/
+    lv_coord_t width;           /*Width of the longest line*/
+} lv_txt_layout_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -92,6 +123,55 @@ lv_coord_t lv_txt_get_width(const char * txt, uint16_t length,
                             const lv_font_t * font, lv_coord_t letter_space, lv_txt_flag_t flag);
 
 
+/**
+ * Initialize an empty text layout
+ * @param layout pointer to a layout
+ */
+void lv_txt_layout_init(lv_txt_layout_t * layout);
+
+/**
+ * Lay out a text, unless the layout is of the same text with the same settings already
+ * @param layout pointer to a layout
+ * @param txt a '\0' terminated string
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max with of the text (break the lines to fit this size) Set CORD_MAX to avoid line breaks
+ * @param flag settings for the text from 'txt_flag_type' enum
+ * @return true: the layout is of `txt`, false: not enough memory to lay it out
+ */
+bool lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                          lv_coord_t letter_space, lv_coord_t max_width, lv_txt_flag_t flag);
+
+/**
+ * Get the size of a laid out text, the same as 'lv_txt_get_size' would give it
+ * @param layout pointer to an up to date layout
+ * @param size_res pointer to a 'point_t' variable to store the result
+ * @param line_space line space of the text
+ */
+void lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_point_t * size_res, lv_coord_t line_space);
+
+/**
+ * Get the line of a laid out text a letter is in
+ * @param layout pointer to an up to date layout with at least one line
+ * @param byte_id byte index of the letter
+ * @return index of the line in 'layout->lines'
+ */
+uint16_t lv_txt_layout_get_line(const lv_txt_layout_t * layout, uint32_t byte_id);
+
+/**
+ * Get the byte index of the first letter after a line of a laid out text
+ * @param layout pointer to an up to date layout
+ * @param line index of the line in 'layout->lines'
+ * @return where the next line starts, or the length of the text after the last line
+ */
+uint32_t lv_txt_layout_get_line_end(const lv_txt_layout_t * layout, uint16_t line);
+
+/**
+ * Free the memory of a text layout and make it empty
+ * @param layout pointer to a layout
+ */
+void lv_txt_layout_clear(lv_txt_layout_t * layout);
+
 /**
  * Check next character in a string and decide if te character is part of the command or not
  * @param state pointer to a txt_cmd_state_t variable which stores the current state of command processing
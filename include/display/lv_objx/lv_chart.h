@@ -51,6 +51,7 @@ typedef struct
     uint8_t vdiv_cnt;     /*Number of vertical division lines*/
     uint16_t point_cnt;   /*Point number in a data line*/
     uint8_t type    :4;   /*Line, column or point chart (from 'lv_chart_type_t')*/
+    uint8_t update_mode :1; /*How new points are added (from 'lv_chart_update_mode_t')*/
     struct {
         lv_coord_t width;  /*Line width or point radius*/
         uint8_t num;       /*Number of data lines in dl_ll*/
@@ -69,6 +70,14 @@ enum
 };
 typedef uint8_t lv_chart_type_t;
 
+/*How 'lv_chart_set_next' adds a point*/
+enum
+{
+    LV_CHART_UPDATE_MODE_SHIFT,     /*Shift the old points left and add the new one on the right*/
+    LV_CHART_UPDATE_MODE_CIRCULAR,  /*Overwrite the oldest point in place, sweeping from left to right*/
+};
+typedef uint8_t lv_chart_update_mode_t;
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -135,6 +144,16 @@ void lv_chart_set_type(lv_obj_t * chart, lv_chart_type_t type);
  */
 void lv_chart_set_point_count(lv_obj_t * chart, uint16_t point_cnt);
 
+/**
+ * Set how new points are added by 'lv_chart_set_next'.
+ * In circular mode every point stays at its own x position and a new point overwrites the oldest one,
+ * so only the few columns around it have to be redrawn instead of the whole chart.
+ * A gap is left in the lines after the newest point.
+ * @param chart pointer to a chart object
+ * @param mode the new update mode (from 'lv_chart_update_mode_t')
+ */
+void lv_chart_set_update_mode(lv_obj_t * chart, lv_chart_update_mode_t mode);
+
 /**
  * Set the opacity of the data series
  * @param chart pointer to a chart object
@@ -173,7 +192,8 @@ void lv_chart_init_points(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t
 void lv_chart_set_points(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t * y_array);
 
 /**
- * Shift all data right and set the most right data on a data line
+ * Shift all data right and set the most right data on a data line,
+ * or overwrite the oldest point in circular update mode
  * @param chart pointer to chart object
  * @param ser pointer to a data series on 'chart'
  * @param y the new value of the most right data
@@ -208,6 +228,13 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * chart);
  */
 uint16_t lv_chart_get_point_cnt(const lv_obj_t * chart);
 
+/**
+ * Get how new points are added by 'lv_chart_set_next'
+ * @param chart pointer to a chart object
+ * @return the update mode (from 'lv_chart_update_mode_t')
+ */
+lv_chart_update_mode_t lv_chart_get_update_mode(const lv_obj_t * chart);
+
 /**
  * Get the opacity of the data series
  * @param chart pointer to chart object
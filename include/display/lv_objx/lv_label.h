@@ -75,6 +75,7 @@ typedef struct
     uint16_t dot_end;               /*The text end position in dot mode (Handled by the library)*/
     uint16_t anim_speed;            /*Speed of scroll and roll animation in px/sec unit*/
     lv_point_t offset;              /*Text draw position offset*/
+    lv_txt_layout_t layout;         /*Line breaks of the text (Handled by the library)*/
     uint8_t static_txt  :1;         /*Flag to indicate the text is static*/
     uint8_t align       :2;         /*Align type from 'lv_label_align_t'*/
     uint8_t recolor     :1;         /*Enable in-line letter re-coloring*/
@@ -48,6 +48,14 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * Fills in the button of a virtual list for an item, see `lv_list_set_virtual`
+ * @param list pointer to the list
+ * @param btn pointer to the button (it has a label, see `lv_list_get_btn_label`)
+ * @param index index of the item the button shows from now on
+ */
+typedef void (*lv_list_item_cb_t)(lv_obj_t * list, lv_obj_t * btn, uint32_t index);
+
 /*Data of list*/
 typedef struct
 {
@@ -62,6 +70,13 @@ typedef struct
     lv_obj_t * last_sel;                          /* The last selected button. It will be reverted when the list is focused again */
     lv_obj_t * selected_btn;                      /* The button is currently being selected*/
 #endif
+    /*Virtual mode (Handled by the library)*/
+    lv_list_item_cb_t item_cb;                    /*Fills in the buttons of the visible items (NULL: not virtual)*/
+    lv_obj_t ** virt_btns;                        /*The buttons recycled for the visible items*/
+    uint32_t * virt_items;                        /*The item each of them shows*/
+    uint16_t virt_btn_cnt;
+    lv_coord_t item_h;                            /*Height of every item in virtual mode*/
+    lv_action_t virt_action;                      /*Release action of the buttons in virtual mode*/
 } lv_list_ext_t;
 
 enum {
@@ -118,6 +133,29 @@ lv_obj_t * lv_list_add(lv_obj_t * list, const void * img_src, const char * txt,
  */
 bool lv_list_remove(const lv_obj_t * list, uint32_t index);
 
+/**
+ * Make a list virtual: instead of a button for every item it only has buttons for the items in view,
+ * which are recycled for the next items while it's scrolled, so memory and scrolling don't depend on the item count.
+ * `item_cb` fills in a button whenever it starts showing another item, and `lv_list_get_btn_index` tells
+ * which item a button shows, e.g. in `rel_action`. Any buttons added before are deleted.
+ * The buttons' states are not kept per item, so in single mode `item_cb` should set them.
+ * The height of the items times their count must fit in `lv_coord_t`.
+ * @param list pointer to a list object
+ * @param item_cnt number of items
+ * @param item_h height of every item
+ * @param item_cb function to fill in the button of an item
+ * @param rel_action pointer to release action function of the buttons (like with lv_btn)
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t item_cnt, lv_coord_t item_h, lv_list_item_cb_t item_cb,
+                         lv_action_t rel_action);
+
+/**
+ * Change the number of items of a virtual list, and fill in every visible button again as their items might have changed
+ * @param list pointer to a list object in virtual mode
+ * @param item_cnt number of items
+ */
+void lv_list_set_virtual_size(lv_obj_t * list, uint32_t item_cnt);
+
 /*=====================
  * Setter functions
  *====================*/
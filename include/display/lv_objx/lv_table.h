@@ -51,6 +51,16 @@ typedef union {
     uint8_t format_byte;
 }lv_table_cell_format_t;
 
+/**
+ * Gives the content of a cell of a virtual table, see `lv_table_set_virtual`
+ * @param table pointer to the table
+ * @param row id of the row
+ * @param col id of the column
+ * @param format the cell's format, which may be changed (left aligned, type 1 and cropped by default)
+ * @return text of the cell (NULL if empty), which only has to stay valid until the next call
+ */
+typedef const char * (*lv_table_cell_cb_t)(lv_obj_t * table, uint16_t row, uint16_t col, lv_table_cell_format_t * format);
+
 /*Data of table*/
 typedef struct {
     /*New data for this type */
@@ -59,6 +69,7 @@ typedef struct {
     char ** cell_data;
     lv_style_t * cell_style[LV_TABLE_CELL_STYLE_CNT];
     lv_coord_t col_w[LV_TABLE_COL_MAX];
+    lv_table_cell_cb_t cell_cb;     /*Gives the cells in virtual mode (NULL: not virtual)*/
 } lv_table_ext_t;
 
 
@@ -105,6 +116,18 @@ void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const
  */
 void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt);
 
+/**
+ * Make a table virtual: it stores no cells and gets only the ones it draws from `cell_cb`,
+ * so drawing and memory don't depend on the number of rows.
+ * All the rows are one line high, the cells can't be merged, and their values and formats can't be set.
+ * `lv_table_set_row_cnt` changes the number of rows, and `lv_obj_invalidate` redraws changed cells.
+ * The height of all the rows must still fit in `lv_coord_t`.
+ * @param table pointer to a Table object
+ * @param row_cnt number of rows
+ * @param cell_cb function giving the cells, or NULL to make the table normal again with empty cells
+ */
+void lv_table_set_virtual(lv_obj_t * table, uint16_t row_cnt, lv_table_cell_cb_t cell_cb);
+
 /**
  * Set the number of columns
  * @param table table pointer to a Table object
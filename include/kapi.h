@@ -30,6 +30,7 @@ extern "C" {
 #define mutex_t pros::mutex_t
 #define sem_t pros::c::sem_t
 #define queue_t pros::c::queue_t
+#define hybrid_mutex_t pros::c::hybrid_mutex_t
 #endif
 
 #define KDBG_FILENO 3
@@ -37,15 +38,40 @@ extern "C" {
 #define warn_printf(fmt, ...) dprintf(STDERR_FILENO, "%s:%d -- " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__)
 #define warn_wprint(str) wprintf("%s", str)
 
-#define kprintf(fmt, ...) dprintf(KDBG_FILENO, "%s:%d -- " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__)
+/**
+ * Queues a kernel message for the kernel log task to write to kdbg. Takes the
+ * same format strings and arguments as plog(), and the format string must
+ * outlive the message. Doesn't lock or allocate anything, so it may be called
+ * from any task, with the scheduler suspended or from an interrupt.
+ *
+ * \param subsystem
+ *        The subsystem logging the message, a klog_subsystem_e_t
+ * \param level
+ *        The message's level, a klog_level_e_t
+ * \param file
+ *        The file which logged the message
+ * \param line
+ *        The line which logged the message
+ * \param fmt
+ *        The format string
+ *
+ * \return True if the message was queued, false if it was filtered out or the
+ * queue was full
+ */
+bool klog_write(uint8_t subsystem, uint8_t level, const char* file, uint16_t line, const char* fmt, ...)
+    __attribute__((format(printf, 5, 6)));
+
+#define klog(subsystem, level, fmt, ...) klog_write(subsystem, level, __FILE__, __LINE__, fmt, ##__VA_ARGS__)
+
+#define kprintf(fmt, ...) klog(E_KLOG_KERNEL, E_KLOG_INFO, fmt, ##__VA_ARGS__)
 #define kprint(str) kprintf("%s", str)
 
 #ifndef PROS_RELEASING
-#define kassert(cond)                     \
-	do {                                    \
-		if (!(cond)) {                        \
-			kprint("Assertion failed: " #cond); \
-		}                                     \
+#define kassert(cond)                                                  \
+	do {                                                                 \
+		if (!(cond)) {                                                     \
+			klog(E_KLOG_KERNEL, E_KLOG_ERROR, "Assertion failed: %s", #cond); \
+		}                                                                  \
 	} while (0)
 #else
 #define kassert(cond)
@@ -106,6 +132,37 @@ int32_t rtos_resume_all(void);
 task_t task_create_static(task_fn_t task_code, void* const param, uint32_t priority, const size_t stack_size,
                           const char* const name, task_stack_t* const stack_buffer, static_task_s_t* const task_buffer);
 
+/**
+ * Restarts a statically allocated task in place.
+ *
+ * The task's stack and control block are reused to run task_code from the
+ * start, which is much cheaper than task_delete() followed by
+ * task_create_static() since nothing waits on the idle task. Tasks notified
+ * of the old task's deletion are notified as usual.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The task is NULL, the calling task, or not statically allocated
+ *
+ * \param task
+ *        The task to restart, created by task_create_static()
+ * \param task_code
+ *        Pointer to the new task entry function
+ * \param param
+ *        Pointer to memory that will be used as a parameter for the task
+ * \param priority
+ *        The priority at which the task should run
+ * \param stack_depth
+ *        The number of words on the task's stack, as given to
+ *        task_create_static()
+ * \param name
+ *        A descriptive name for the task
+ *
+ * \return The task handle, or NULL if an error occurred
+ */
+task_t task_restart_static(task_t task, task_fn_t task_code, void* const param, uint32_t priority,
+                           const size_t stack_size, const char* const name);
+
 /**
  * Creates a statically allocated mutex.
  *
@@ -120,6 +177,30 @@ task_t task_create_static(task_fn_t task_code, void* const param, uint32_t prior
  */
 mutex_t mutex_create_static(static_sem_s_t* mutex_buffer);
 
+/**
+ * The storage of a hybrid mutex, see rtos/hybrid_mutex.c
+ */
+typedef struct static_hybrid_mutex_s {
+	volatile uint32_t state;  // The owner, with the low bit set once another task had to wait
+	uint32_t waiters;         // The tasks blocked on queue_mutex
+	mutex_t queue_mutex;
+	static_sem_s_t queue_mutex_buf;
+} static_hybrid_mutex_s_t;
+
+/**
+ * Creates a statically allocated hybrid mutex.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - mutex_buffer is NULL
+ *
+ * \param[out] mutex_buffer
+ *             A buffer to store the mutex in
+ *
+ * \return A handle to the mutex, or NULL upon failure
+ */
+hybrid_mutex_t hybrid_mutex_create_static(static_hybrid_mutex_s_t* mutex_buffer);
+
 /**
  * Creates a statically allocated semaphore.
  *
@@ -171,6 +252,21 @@ queue_t queue_create_static(uint32_t length, uint32_t item_size, uint8_t* storag
  */
 void display_error(const char* text);
 
+/**
+ * Hands the ports' binding errors to the display daemon, which shows them with
+ * display_error() the next time it runs.
+ *
+ * This only stores the masks and wakes the display daemon, so the system
+ * daemon can call it without formatting text or touching LVGL.
+ *
+ * \param unplugged
+ *        A bitmask of the ports with a device registered but none plugged in
+ * \param mismatched
+ *        A bitmask of the ports with a different device plugged in than the
+ *        one registered
+ */
+void display_port_errors(uint32_t unplugged, uint32_t mismatched);
+
 /**
  * Display a fatal error to the built-in LCD/touch screen.
  *
@@ -183,6 +279,58 @@ void display_error(const char* text);
  */
 void display_fatal_error(const char* text);
 
+/**
+ * Gets the boot options the user program picked with PROS_BOOT_OPTIONS(). This
+ * can be called from the start of pros_init, as the hot image is already loaded.
+ *
+ * \return The PROS_BOOT_* flags, 0 if the program didn't pick any
+ */
+uint32_t boot_get_options(void);
+
+/**
+ * Prints on the kdbg stream how long each boot phase took, including the user's
+ * global constructors, and when initialize() starts. Called by the system
+ * daemon right before it starts initialize().
+ */
+void boot_report_times(void);
+
+/**
+ * Allocates memory for LVGL, from the display arena the calling task selected
+ * with display_arena_select() if it has room, otherwise from the kernel heap.
+ *
+ * \param size
+ *        The number of bytes to allocate
+ *
+ * \return The memory, or NULL if there isn't enough
+ */
+void* display_mem_alloc(size_t size);
+
+/**
+ * Frees memory allocated by display_mem_alloc().
+ *
+ * \param ptr
+ *        The memory to free
+ */
+void display_mem_free(void* ptr);
+
+/**
+ * Blocks LVGL until the flush of a VDB to the screen finishes. LVGL calls this
+ * in a loop while it waits for the flush task, instead of spinning.
+ */
+void display_flush_wait(void);
+
+/**
+ * Copies a rectangle of pixels to the screen, leaving out the parts covered by
+ * display canvases. Every copy to the screen goes through here or
+ * display_canvas_present(), which serialize them.
+ *
+ * \param x1, y1, x2, y2
+ *        The rectangle on the screen
+ * \param buf
+ *        The rectangle's pixels, row by row
+ */
+void display_copy_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const uint32_t* buf);
+
 /**
  * Prints hex characters to the terminal.
  *
@@ -111,6 +111,16 @@ typedef enum adi_port_config_e {
 #endif
 #endif
 
+/**
+ * The state of a port's background calibration.
+ */
+typedef enum adi_calibration_status_e {
+	E_ADI_CALIBRATION_NONE = 0,  // No calibration was started, or the port was reconfigured during it
+	E_ADI_CALIBRATION_RUNNING,
+	E_ADI_CALIBRATION_DONE,
+	E_ADI_CALIBRATION_ERR = PROS_ERR
+} adi_calibration_status_e_t;
+
 #define NUM_ADI_PORTS 8
 
 #ifdef __cplusplus
@@ -191,6 +201,29 @@ int32_t adi_port_set_config(uint8_t port, adi_port_config_e_t type);
  */
 int32_t adi_port_set_value(uint8_t port, int32_t value);
 
+/**
+ * Reads the values of all of the ADI ports at once.
+ *
+ * The ADI is only taken once for the whole read, rather than once per port
+ * with each port's own read function, so this is the cheaper way to sample
+ * several sensors every loop. Each value is the one the port's own read
+ * function gives for its configuration: adi_analog_read() for analog inputs,
+ * adi_digital_read() for digital inputs, adi_encoder_get() for the top port
+ * of an encoder and adi_motor_get() for motors. Ports with any other
+ * configuration give their raw value, like adi_port_get_value().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - values is NULL
+ *
+ * \param[out] values
+ *             The values of ports 1-8 ('a'-'h')
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t adi_read_all(int32_t values[NUM_ADI_PORTS]);
+
 /******************************************************************************/
 /**                      PROS 2 Compatibility Functions                      **/
 /**                                                                          **/
@@ -234,8 +267,10 @@ int32_t adi_port_set_value(uint8_t port, int32_t value);
  * calibration value.
  *
  * This method assumes that the true sensor value is not actively changing at
- * this time and computes an average from approximately 500 samples, 1 ms apart,
- * for a 0.5 s period of calibration. The average value thus calculated is
+ * this time and computes an average from 64 of the ADI's updates, 10 ms apart,
+ * for a 0.64 s period of calibration. The calibration runs in the background
+ * like adi_analog_calibrate_async(), so the other ADI ports can be used in the
+ * meantime. The average value thus calculated is
  * returned and stored for later calls to the adi_analog_read_calibrated() and
  * adi_analog_read_calibrated_HR() functions. These functions will return
  * the difference between this value and the current sensor value when called.
@@ -254,6 +289,68 @@ int32_t adi_port_set_value(uint8_t port, int32_t value);
  */
 int32_t adi_analog_calibrate(uint8_t port);
 
+/**
+ * Starts calibrating the analog sensor on the specified port in the
+ * background, and returns straight away.
+ *
+ * The system daemon takes a sample every time the ADI updates, and once it has
+ * 64 of them the average is stored for adi_analog_read_calibrated() and
+ * adi_analog_read_calibrated_HR() just like adi_analog_calibrate() does.
+ * Several sensors can be calibrated at once, and the ADI isn't held while they
+ * are. Use adi_calibration_get_status() or adi_calibration_wait() to find out
+ * when it's done.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param port
+ *        The ADI port to calibrate (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return 1 if the calibration was started or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t adi_analog_calibrate_async(uint8_t port);
+
+/**
+ * Gets the state of the background calibration on the specified port, which
+ * adi_analog_calibrate_async() or adi_gyro_init_async() started.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ *
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return The calibration's state, or E_ADI_CALIBRATION_ERR if the operation
+ * failed, setting errno.
+ */
+adi_calibration_status_e_t adi_calibration_get_status(uint8_t port);
+
+/**
+ * Waits for the background calibration on the specified port to finish.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ * EINVAL - No calibration was started on the port, or the port was
+ * reconfigured before it finished
+ * EAGAIN - The scheduler hasn't started yet, so the calibration can't run
+ * ETIMEDOUT - The calibration didn't finish within the timeout
+ *
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H')
+ * \param timeout
+ *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+ *
+ * \return The calibration value adi_analog_calibrate() would return for an
+ * analog sensor, 1 for a gyro, or PROS_ERR if the operation failed, setting
+ * errno.
+ */
+int32_t adi_calibration_wait(uint8_t port, uint32_t timeout);
+
 /**
  * Gets the 12-bit value of the specified port.
  *
@@ -388,6 +485,31 @@ int32_t adi_digital_get_new_press(uint8_t port);
  */
 int32_t adi_digital_write(uint8_t port, const bool value);
 
+/**
+ * Sets several ports configured as digital outputs at once, e.g. a bank of
+ * solenoids which should fire together.
+ *
+ * The ADI is only taken once, and the system daemon doesn't send the ADI's
+ * outputs while it is held, so every port in the mask changes in the same
+ * update. No port is changed unless every port in the mask is a digital
+ * output.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EADDRINUSE - A port in the mask is not configured as a digital output
+ *
+ * \param mask
+ *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+ *        port 8 ('h')
+ * \param values
+ *        The values to set the ports to, with the same bits as mask. Bits
+ *        which aren't in mask are ignored.
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t adi_digital_write_mask(uint8_t mask, uint8_t values);
+
 /**
  * Configures the port as an input or output with a variety of settings.
  *
@@ -424,6 +546,30 @@ int32_t adi_pin_mode(uint8_t port, uint8_t mode);
  */
 int32_t adi_motor_set(uint8_t port, int8_t speed);
 
+/**
+ * Sets the speeds of several motors at once.
+ *
+ * Like adi_digital_write_mask(), the ADI is only taken once and every motor
+ * in the mask changes in the same update. No motor is changed unless every
+ * port in the mask is configured as a motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - speeds is NULL
+ * EADDRINUSE - A port in the mask is not configured as a motor
+ *
+ * \param mask
+ *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+ *        port 8 ('h')
+ * \param speeds
+ *        The new signed speeds of ports 1-8 ('a'-'h'), as for adi_motor_set().
+ *        Speeds of ports which aren't in mask are ignored.
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t adi_motor_set_mask(uint8_t mask, const int8_t speeds[NUM_ADI_PORTS]);
+
 /**
  * Gets the last set speed of the motor on the given port.
  *
@@ -458,8 +604,9 @@ int32_t adi_motor_stop(uint8_t port);
 /**
  * Reference type for an initialized encoder.
  *
- * This merely contains the port number for the encoder, unlike its use as an
- * object to store encoder data in PROS 2.
+ * This merely contains the port number for the encoder, along with the smart
+ * port of its ADI expander if it has one, unlike its use as an object to store
+ * encoder data in PROS 2.
  */
 typedef int32_t adi_encoder_t;
 
@@ -524,6 +671,52 @@ adi_encoder_t adi_encoder_init(uint8_t port_top, uint8_t port_bottom, const bool
  */
 int32_t adi_encoder_reset(adi_encoder_t enc);
 
+/**
+ * Gets the encoder's velocity in ticks per second.
+ *
+ * The system daemon works out the velocity every time the ADI updates, from
+ * the change in the encoder's count and the time between the ADI's readings,
+ * so it doesn't suffer from when the calling task happens to run. Each new
+ * estimate is blended into the velocity with an exponential filter, see
+ * adi_encoder_set_velocity_filter().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ * EADDRINUSE - The port is not configured as an encoder
+ *
+ * \param enc
+ *        The adi_encoder_t object from adi_encoder_init() to read
+ *
+ * \return The encoder's velocity in ticks per second, or PROS_ERR_F if the
+ * operation failed, setting errno.
+ */
+double adi_encoder_get_velocity(adi_encoder_t enc);
+
+/**
+ * Sets how much the encoder's velocity is smoothed.
+ *
+ * Every time the ADI updates, the velocity moves by alpha of the way towards
+ * the velocity measured over the last update. An alpha of 1 turns the filter
+ * off, while smaller values filter out more noise at the cost of lagging
+ * behind changes. The default is 0.5.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ * EADDRINUSE - The port is not configured as an encoder
+ * EINVAL - alpha is not greater than 0 and at most 1
+ *
+ * \param enc
+ *        The adi_encoder_t object from adi_encoder_init() to configure
+ * \param alpha
+ *        The weight of each new measurement, greater than 0 and at most 1
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t adi_encoder_set_velocity_filter(adi_encoder_t enc, double alpha);
+
 /**
  * Disables the encoder and voids the configuration on its ports.
  *
@@ -543,8 +736,9 @@ int32_t adi_encoder_shutdown(adi_encoder_t enc);
 /**
  * Reference type for an initialized ultrasonic.
  *
- * This merely contains the port number for the ultrasonic, unlike its use as an
- * object to store ultrasonic data in PROS 2.
+ * This merely contains the port number for the ultrasonic, along with the
+ * smart port of its ADI expander if it has one, unlike its use as an object to
+ * store ultrasonic data in PROS 2.
  */
 typedef int32_t adi_ultrasonic_t;
 
@@ -588,6 +782,40 @@ int32_t adi_ultrasonic_get(adi_ultrasonic_t ult);
  */
 adi_ultrasonic_t adi_ultrasonic_init(uint8_t port_ping, uint8_t port_echo);
 
+/**
+ * The most readings adi_ultrasonic_get_filtered() can take the median of.
+ */
+#define ADI_ULTRASONIC_WINDOW_MAX 9
+
+/**
+ * Gets the median of the ultrasonic's latest readings.
+ *
+ * The system daemon keeps the latest ADI_ULTRASONIC_WINDOW_MAX readings of
+ * every ultrasonic, taking each new one as the ADI sends it, about every
+ * 10 ms, and works out their medians as it goes. This only looks one up, so
+ * it's no more expensive than adi_ultrasonic_get(), while a median of a few
+ * readings throws out the odd missed echo. A window of n adds about n / 2
+ * readings of lag. Until the sensor has taken a full window's worth of
+ * readings since adi_ultrasonic_init(), the median is of the ones it has.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The window is 0 or more than ADI_ULTRASONIC_WINDOW_MAX
+ * ENXIO - The given value is not within the range of ADI Ports
+ * EADDRINUSE - The port is not configured as an ultrasonic
+ * EAGAIN - The sensor hasn't taken a reading yet
+ *
+ * \param ult
+ *        The adi_ultrasonic_t object from adi_ultrasonic_init() to read
+ * \param window
+ *        How many of the latest readings to take the median of, from 1 to
+ *        ADI_ULTRASONIC_WINDOW_MAX
+ *
+ * \return The median distance to the nearest object in m^-4, like
+ * adi_ultrasonic_get(), or PROS_ERR if the operation failed, setting errno.
+ */
+int32_t adi_ultrasonic_get_filtered(adi_ultrasonic_t ult, uint8_t window);
+
 /**
  * Disables the ultrasonic sensor and voids the configuration on its ports.
  *
@@ -607,8 +835,9 @@ int32_t adi_ultrasonic_shutdown(adi_ultrasonic_t ult);
 /**
  * Reference type for an initialized gyroscope.
  *
- * This merely contains the port number for the gyroscope, unlike its use as an
- * object to store gyro data in PROS 2.
+ * This merely contains the port number for the gyroscope, along with the
+ * smart port of its ADI expander if it has one, unlike its use as an object to
+ * store gyro data in PROS 2.
  */
 typedef int32_t adi_gyro_t;
 
@@ -656,6 +885,30 @@ double adi_gyro_get(adi_gyro_t gyro);
  */
 adi_gyro_t adi_gyro_init(uint8_t port, double multiplier);
 
+/**
+ * Initializes a gyroscope on the given port like adi_gyro_init(), but returns
+ * without waiting for its calibration. Several gyros can calibrate at once
+ * this way.
+ *
+ * The gyro's readings aren't meaningful until adi_calibration_get_status()
+ * gives E_ADI_CALIBRATION_DONE for its port, or adi_calibration_wait()
+ * returns.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of ADI Ports
+ *
+ * \param port
+ *        The ADI port to initialize as a gyro (from 1-8, 'a'-'h', 'A'-'H')
+ * \param multiplier
+ *        A scalar value that will be multiplied by the gyro heading value
+ *        supplied by the ADI
+ *
+ * \return An adi_gyro_t object containing the given port, or PROS_ERR if the
+ * initialization failed.
+ */
+adi_gyro_t adi_gyro_init_async(uint8_t port, double multiplier);
+
 /**
  * Resets the gyroscope value to zero.
  *
@@ -19,10 +19,32 @@
 #define _PROS_ADI_HPP_
 
 #include "pros/adi.h"
+#include "pros/ext_adi.h"
+#include "pros/rtos.h"
 
 #include <cstdint>
+#include <tuple>
+#include <utility>
 
 namespace pros {
+/**
+ * A port of an ADI expander, as {smart port, ADI port}, e.g. {5, 'A'}. The
+ * brain's own ports can be given this way with ADI_INTERNAL_SMART_PORT.
+ *
+ * Ports given to a constructor on their own need a second pair of braces, e.g.
+ * pros::ADIDigitalOut piston({{5, 'A'}}), since {5, 'A'} would also match the
+ * constructor which takes a port and an initial state.
+ */
+typedef std::pair<std::uint8_t, std::uint8_t> ext_adi_port_pair_t;
+
+/**
+ * The two ports of a device on an ADI expander, as
+ * {smart port, first ADI port, second ADI port}, e.g. {5, 'A', 'B'}. As with
+ * ext_adi_port_pair_t, these need a second pair of braces when they're given on
+ * their own, e.g. pros::ADIEncoder encoder({{5, 'A', 'B'}}).
+ */
+typedef std::tuple<std::uint8_t, std::uint8_t, std::uint8_t> ext_adi_port_tuple_t;
+
 class ADIPort {
 	public:
 	/**
@@ -39,6 +61,22 @@ class ADIPort {
 	 */
 	ADIPort(std::uint8_t port, adi_port_config_e_t type = E_ADI_TYPE_UNDEFINED);
 
+	/**
+	 * Configures a port of an ADI expander to act as a given sensor type.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 * \param type
+	 *        The configuration type for the port
+	 */
+	ADIPort(ext_adi_port_pair_t port_pair, adi_port_config_e_t type = E_ADI_TYPE_UNDEFINED);
+
 	virtual ~ADIPort(void) = default;
 
 	/**
@@ -80,9 +118,102 @@ class ADIPort {
 	 */
 	std::int32_t set_value(std::int32_t value) const;
 
+	/**
+	 * Reads the values of all of the ADI ports at once, taking the ADI only
+	 * once. See adi_read_all() for the value each port gives.
+	 *
+	 * \param[out] values
+	 *             The values of ports 1-8 ('a'-'h')
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t read_all(std::int32_t values[NUM_ADI_PORTS]);
+
+	/**
+	 * Reads the values of all of the ports of an ADI expander at once. See
+	 * ext_adi_read_all().
+	 *
+	 * \param smart_port
+	 *        The smart port of the expander (from 1-22)
+	 * \param[out] values
+	 *             The values of ports 1-8 ('a'-'h')
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t read_all(std::uint8_t smart_port, std::int32_t values[NUM_ADI_PORTS]);
+
+	/**
+	 * Sets several digital outputs at once, taking the ADI only once. See
+	 * adi_digital_write_mask().
+	 *
+	 * \param mask
+	 *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+	 *        port 8 ('h')
+	 * \param values
+	 *        The values to set the ports to, with the same bits as mask
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t set_digital_mask(std::uint8_t mask, std::uint8_t values);
+
+	/**
+	 * Sets several digital outputs of an ADI expander at once. See
+	 * ext_adi_digital_write_mask().
+	 *
+	 * \param smart_port
+	 *        The smart port of the expander (from 1-22)
+	 * \param mask
+	 *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+	 *        port 8 ('h')
+	 * \param values
+	 *        The values to set the ports to, with the same bits as mask
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t set_digital_mask(std::uint8_t smart_port, std::uint8_t mask, std::uint8_t values);
+
+	/**
+	 * Sets the speeds of several motors at once, taking the ADI only once.
+	 * See adi_motor_set_mask().
+	 *
+	 * \param mask
+	 *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+	 *        port 8 ('h')
+	 * \param speeds
+	 *        The new signed speeds of ports 1-8 ('a'-'h')
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t set_motor_mask(std::uint8_t mask, const std::int8_t speeds[NUM_ADI_PORTS]);
+
+	/**
+	 * Sets the speeds of several motors on an ADI expander at once. See
+	 * ext_adi_motor_set_mask().
+	 *
+	 * \param smart_port
+	 *        The smart port of the expander (from 1-22)
+	 * \param mask
+	 *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+	 *        port 8 ('h')
+	 * \param speeds
+	 *        The new signed speeds of ports 1-8 ('a'-'h')
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	static std::int32_t set_motor_mask(std::uint8_t smart_port, std::uint8_t mask,
+	                                   const std::int8_t speeds[NUM_ADI_PORTS]);
+
 	protected:
 	ADIPort(void);
-	std::uint8_t _port;
+	std::uint8_t _smart_port = ADI_INTERNAL_SMART_PORT;
+	// The ADI port, or the handle from the init function of devices which have one
+	std::int32_t _port;
 };
 
 class ADIAnalogIn : private ADIPort {
@@ -104,13 +235,27 @@ class ADIAnalogIn : private ADIPort {
 	 */
 	ADIAnalogIn(std::uint8_t port);
 
+	/**
+	 * Configures a port of an ADI expander to act as an Analog Input.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 */
+	ADIAnalogIn(ext_adi_port_pair_t port_pair);
+
 	/**
 	 * Calibrates the analog sensor on the specified port and returns the new
 	 * calibration value.
 	 *
 	 * This method assumes that the true sensor value is not actively changing at
-	 * this time and computes an average from approximately 500 samples, 1 ms
-	 * apart, for a 0.5 s period of calibration. The average value thus calculated
+	 * this time and computes an average from 64 of the ADI's updates, 10 ms
+	 * apart, for a 0.64 s period of calibration. The average value thus calculated
 	 * is returned and stored for later calls to the
 	 * pros::ADIAnalogIn::get_value_calibrated() and
 	 * pros::ADIAnalogIn::get_value_calibrated_HR() functions. These functions
@@ -128,6 +273,37 @@ class ADIAnalogIn : private ADIPort {
 	 */
 	std::int32_t calibrate(void) const;
 
+	/**
+	 * Starts calibrating the analog sensor in the background, and returns
+	 * straight away. See adi_analog_calibrate_async() for details.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EADDRINUSE - The port is not configured as an analog input
+	 *
+	 * \return 1 if the calibration was started or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t calibrate_async(void) const;
+
+	/**
+	 * Waits for a calibration started by pros::ADIAnalogIn::calibrate_async() to
+	 * finish.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - No calibration was started, or the port was reconfigured before
+	 * it finished
+	 * ETIMEDOUT - The calibration didn't finish within the timeout
+	 *
+	 * \param timeout
+	 *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+	 *
+	 * \return The average sensor value, or PROS_ERR if the operation failed,
+	 * setting errno.
+	 */
+	std::int32_t wait_for_calibration(std::uint32_t timeout = TIMEOUT_MAX) const;
+
 	/**
 	 * Gets the 12 bit calibrated value of an analog input port.
 	 *
@@ -205,6 +381,20 @@ class ADIAnalogOut : private ADIPort {
 	 */
 	ADIAnalogOut(std::uint8_t port);
 
+	/**
+	 * Configures a port of an ADI expander to act as an Analog Output.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 */
+	ADIAnalogOut(ext_adi_port_pair_t port_pair);
+
 	/**
 	 * Sets the value for the given ADI port.
 	 *
@@ -240,6 +430,22 @@ class ADIDigitalOut : private ADIPort {
 	 */
 	ADIDigitalOut(std::uint8_t port, bool init_state = LOW);
 
+	/**
+	 * Configures a port of an ADI expander to act as a Digital Output.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 * \param init_state
+	 *        The initial state for the port
+	 */
+	ADIDigitalOut(ext_adi_port_pair_t port_pair, bool init_state = LOW);
+
 	/**
 	 * Sets the value for the given ADI port.
 	 *
@@ -275,6 +481,20 @@ class ADIDigitalIn : private ADIPort {
 	 */
 	ADIDigitalIn(std::uint8_t port);
 
+	/**
+	 * Configures a port of an ADI expander to act as a Digital Input.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 */
+	ADIDigitalIn(ext_adi_port_pair_t port_pair);
+
 	/**
 	 * Gets a rising-edge case for a digital button press.
 	 *
@@ -325,6 +545,20 @@ class ADIMotor : private ADIPort {
 	 */
 	ADIMotor(std::uint8_t port);
 
+	/**
+	 * Configures a port of an ADI expander to act as a Motor.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 */
+	ADIMotor(ext_adi_port_pair_t port_pair);
+
 	/**
 	 * Stops the motor on the given port.
 	 *
@@ -384,6 +618,22 @@ class ADIEncoder : private ADIPort {
 	 */
 	ADIEncoder(std::uint8_t port_top, std::uint8_t port_bottom, bool reversed = false);
 
+	/**
+	 * Configures a pair of ports of an ADI expander to act as an Encoder.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Any of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_tuple
+	 *        The smart port of the expander (from 1-22), then the "top" and
+	 *        "bottom" wires from the encoder sensor
+	 * \param reverse
+	 *        If "true", the sensor will count in the opposite direction
+	 */
+	ADIEncoder(ext_adi_port_tuple_t port_tuple, bool reversed = false);
+
 	/**
 	 * Sets the encoder value to zero.
 	 *
@@ -412,6 +662,27 @@ class ADIEncoder : private ADIPort {
 	 * reset
 	 */
 	std::int32_t get_value(void) const;
+
+	/**
+	 * Gets the encoder's velocity in ticks per second, as estimated by the
+	 * kernel every time the ADI updates. See adi_encoder_get_velocity().
+	 *
+	 * \return The encoder's velocity in ticks per second, or PROS_ERR_F if the
+	 * operation failed, setting errno.
+	 */
+	double get_velocity(void) const;
+
+	/**
+	 * Sets how much the encoder's velocity is smoothed. See
+	 * adi_encoder_set_velocity_filter().
+	 *
+	 * \param alpha
+	 *        The weight of each new measurement, greater than 0 and at most 1
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t set_velocity_filter(double alpha) const;
 };
 
 class ADIUltrasonic : private ADIPort {
@@ -432,6 +703,20 @@ class ADIUltrasonic : private ADIPort {
 	 */
 	ADIUltrasonic(std::uint8_t port_ping, std::uint8_t port_echo);
 
+	/**
+	 * Configures a pair of ports of an ADI expander to act as an Ultrasonic.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Any of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_tuple
+	 *        The smart port of the expander (from 1-22), then the ping and echo
+	 *        ports, as for ADIUltrasonic(std::uint8_t, std::uint8_t)
+	 */
+	ADIUltrasonic(ext_adi_port_tuple_t port_tuple);
+
 	/**
 	 * Gets the current ultrasonic sensor value in centimeters.
 	 *
@@ -447,6 +732,25 @@ class ADIUltrasonic : private ADIPort {
 	 * meter), measured from the sensor's mounting points.
 	 */
 	using ADIPort::get_value;
+
+	/**
+	 * Gets the median of the sensor's latest readings, which the system daemon
+	 * keeps up to date. See adi_ultrasonic_get_filtered().
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The window is 0 or more than ADI_ULTRASONIC_WINDOW_MAX
+	 * EADDRINUSE - The port is not configured as an ultrasonic
+	 * EAGAIN - The sensor hasn't taken a reading yet
+	 *
+	 * \param window
+	 *        How many of the latest readings to take the median of, from 1 to
+	 *        ADI_ULTRASONIC_WINDOW_MAX
+	 *
+	 * \return The median distance to the nearest object in m^-4, or PROS_ERR
+	 * if the operation failed, setting errno.
+	 */
+	std::int32_t get_value_filtered(std::uint8_t window) const;
 };
 
 class ADIGyro : private ADIPort {
@@ -474,6 +778,23 @@ class ADIGyro : private ADIPort {
 	 */
 	ADIGyro(std::uint8_t port, double multiplier = 1);
 
+	/**
+	 * Configures a port of an ADI expander to act as a Gyro.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - Either of the given ports is out of range
+	 * ENODEV - The smart port doesn't have an ADI expander in it
+	 *
+	 * \param port_pair
+	 *        The smart port of the expander (from 1-22) and the ADI port number
+	 *        (from 1-8, 'a'-'h', 'A'-'H') to configure
+	 * \param multiplier
+	 *        A scalar value that will be multiplied by the gyro heading value
+	 *        supplied by the ADI
+	 */
+	ADIGyro(ext_adi_port_pair_t port_pair, double multiplier = 1);
+
 	/**
 	 * Gets the current gyro angle in tenths of a degree. Unless a multiplier is
 	 * applied to the gyro, the return value will be a whole number representing
@@ -75,6 +75,42 @@ bool task_abort_delay(task_t task);
 void task_notify_when_deleting(task_t target_task, task_t task_to_notify, uint32_t value,
                                notify_action_e_t notify_action);
 
+/**
+ * Creates a new task without a newlib reentrancy structure of its own.
+ *
+ * Every task made by task_create() carries roughly a kilobyte of newlib state
+ * (stdio streams, strtok()'s position, rand()'s seed and so on) which is set
+ * up when it is created and swapped in on every context switch. A light task
+ * skips that and shares the global structure instead, keeping only its errno
+ * to itself. This makes it smaller and quicker to create, which suits the
+ * many small tasks which only do control loops and talk to devices.
+ *
+ * Because the global structure isn't locked, a light task must not use stdio
+ * (printf(), std::cout, fopen() and the like) or other newlib functions which
+ * keep state between calls, such as strtok() and rand(). Functions which only
+ * set errno, like the PROS device functions, are fine.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOMEM - The stack or TCB couldn't be allocated.
+ *
+ * \param function
+ *        Pointer to the task entry function
+ * \param parameters
+ *        Pointer to memory that will be used as a parameter for the task
+ * \param prio
+ *        The priority at which the task should run
+ * \param stack_depth
+ *        The number of words available on the task's stack
+ * \param name
+ *        A descriptive name for the task
+ *
+ * \return A handle by which the newly created task can be referenced, or NULL
+ * if an error occurred
+ */
+task_t task_create_light(task_fn_t function, void* const parameters, uint32_t prio, const uint16_t stack_depth,
+                         const char* const name);
+
 /**
  * Creates a recursive mutex which can be locked recursively by the owner.
  *
@@ -356,199 +392,4213 @@ void queue_delete(queue_t queue);
  */
 void queue_reset(queue_t queue);
 
+/**
+ * Reserves the slot at the end of a queue so an item can be built directly in
+ * the queue's memory, instead of being copied in by queue_append(). The item
+ * isn't visible to receivers until queue_commit() is called.
+ *
+ * Only one slot may be reserved at a time, and nothing else may be written to
+ * the queue until the reserved slot is committed.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOSPC - The queue is full and the timeout is 0
+ *
+ * \param queue
+ *        The queue handle
+ * \param timeout
+ *        Time to wait for space to become available. A timeout of 0 can be used
+ *        to attempt to reserve without blocking. TIMEOUT_MAX can be used to
+ *        block indefinitely.
+ *
+ * \return A pointer to the reserved slot, which is item_size bytes long, or
+ * NULL if the queue stayed full.
+ */
+void* queue_reserve_back(queue_t queue, uint32_t timeout);
+
+/**
+ * Adds the slot reserved by queue_reserve_back() to the end of the queue and
+ * wakes a task waiting to receive.
+ *
+ * \param queue
+ *        The queue handle
+ *
+ * \return True if the item was added, false if the queue had no room for it.
+ */
+bool queue_commit(queue_t queue);
+
+/**
+ * Gets a pointer to the item at the front of a queue without copying it out.
+ * The item stays in the queue, and its memory stays valid, until
+ * queue_release() is called.
+ *
+ * Only one task may access the front of the queue this way at a time, and it
+ * must not receive from the queue by other means until the item is released.
+ *
+ * \param queue
+ *        The queue handle
+ * \param timeout
+ *        Time to wait for an item to arrive. A timeout of 0 can be used to
+ *        check without blocking. TIMEOUT_MAX can be used to block indefinitely.
+ *
+ * \return A pointer to the front item, or NULL if the queue stayed empty.
+ */
+void* queue_peek_front_ptr(queue_t queue, uint32_t timeout);
+
+/**
+ * Removes the item at the front of a queue without copying it out, typically
+ * after it has been used through queue_peek_front_ptr(), and wakes a task
+ * waiting to send.
+ *
+ * \param queue
+ *        The queue handle
+ *
+ * \return True if an item was removed, false if the queue was empty.
+ */
+bool queue_release(queue_t queue);
+
 /******************************************************************************/
-/**                           Device Registration                            **/
+/**                                Queue Sets                                **/
+/**                                                                          **/
+/**  A queue set lets a task block on several queues and semaphores at once. **/
+/**  Each time an item is added to a member, or a member semaphore is        **/
+/**  posted, the member's handle is added to the set. queue_set_select()     **/
+/**  returns the next of those handles, and the caller must then receive     **/
+/**  from the queue or wait on the semaphore once, with a timeout of 0.      **/
 /******************************************************************************/
 
-/*
- * List of possible v5 devices
+typedef void* queue_set_t;
+
+/**
+ * Creates a queue set.
  *
- * This list contains all current V5 Devices, and mirrors V5_DeviceType from the
- * api.
+ * To be sure no event is lost, the length must be at least the total length
+ * of the set's members, counting a binary semaphore as 1 and a counting
+ * semaphore as its maximum count.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The length is 0.
+ * ENOMEM - There was not enough memory for the set.
+ *
+ * \param length
+ *        The most events the set holds at once
+ *
+ * \return A handle to the newly created queue set, or NULL if it could not be
+ * created.
  */
-typedef enum v5_device_e {
-	E_DEVICE_NONE = 0,
-	E_DEVICE_MOTOR = 2,
-	E_DEVICE_IMU = 6,
-	E_DEVICE_RADIO = 8,
-	E_DEVICE_VISION = 11,
-	E_DEVICE_ADI = 12,
-	E_DEVICE_GENERIC = 129,
-	E_DEVICE_UNDEFINED = 255
-} v5_device_e_t;
+queue_set_t queue_set_create(uint32_t length);
 
-/*
- * Registers a device in the given port
+/**
+ * Deletes a queue set. Its members must have been removed from it first.
  *
- * Registers a device of the given type in the given port into the registry, if
- * that type of device is detected to be plugged in to that port.
+ * \param set
+ *        The queue set handle
+ */
+void queue_set_delete(queue_set_t set);
+
+/**
+ * Adds a queue or semaphore to a queue set. Mutexes can't be added, since a
+ * task blocked on the set would not lend its priority to the mutex's owner.
  *
  * This function uses the following values of errno when an error state is
  * reached:
- * ENXIO - The given value is not within the range of V5 ports (1-21), or a
- * a different device than specified is plugged in.
- * EADDRINUSE - The port is already registered to another device.
+ * EINVAL - The member is already in a set, or it isn't empty.
  *
- * \param port
- *        The port number to register the device
- * \param device
- *        The type of device to register
+ * \param set
+ *        The queue set handle
+ * \param member
+ *        The queue_t or sem_t to add
  *
- * \return 1 upon success, PROS_ERR upon failure
+ * \return True if the member was added, false otherwise.
  */
-int registry_bind_port(uint8_t port, v5_device_e_t device_type);
+bool queue_set_add(queue_set_t set, void* member);
 
-/*
- * Deregisters a devices from the given port
+/**
+ * Removes a queue or semaphore from a queue set, which must be done before
+ * the member is deleted.
  *
- * Removes the device registed in the given port, if there is one.
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The member isn't in the set, or it isn't empty.
+ *
+ * \param set
+ *        The queue set handle
+ * \param member
+ *        The queue_t or sem_t to remove
+ *
+ * \return True if the member was removed, false otherwise.
+ */
+bool queue_set_remove(queue_set_t set, void* member);
+
+/**
+ * Blocks until one of a queue set's members has an item or has been posted.
  *
  * This function uses the following values of errno when an error state is
  * reached:
- * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ETIMEDOUT - No member became ready before the timeout.
  *
- * \param port
- *        The port number to deregister
+ * \param set
+ *        The queue set handle
+ * \param timeout
+ *        Time to wait for a member to become ready. A timeout of 0 can be
+ *        used to check without blocking. TIMEOUT_MAX can be used to block
+ *        indefinitely.
  *
- * \return 1 upon success, PROS_ERR upon failure
+ * \return The queue_t or sem_t which is ready, or NULL if none became ready.
  */
-int registry_unbind_port(uint8_t port);
+void* queue_set_select(queue_set_t set, uint32_t timeout);
 
 /******************************************************************************/
-/**                               Filesystem                                 **/
+/**                             Message Buffers                              **/
+/**                                                                          **/
+/**  A message buffer passes messages of any length from one task to         **/
+/**  another, each stored with a 4 byte length instead of padded to a fixed  **/
+/**  item size. One task may send and one receive at a time; if more need    **/
+/**  to, they must share a mutex.                                            **/
 /******************************************************************************/
+
+typedef void* message_buffer_t;
+
 /**
- * Control settings of the serial driver.
+ * The bytes at the start of a message buffer's storage which hold its
+ * bookkeeping
+ */
+#define MESSAGE_BUFFER_HEADER_SIZE 36
+
+/**
+ * The space a message of length bytes takes up in a message buffer
+ */
+#define MESSAGE_BUFFER_MESSAGE_SPACE(length) ((length) + 4)
+
+/**
+ * The number of bytes of storage a message buffer of size bytes needs, e.g.
  *
- * \param action
- * 			An action to perform on the serial driver. See the SERCTL_* macros for
- * 			details on the different actions.
- * \param extra_arg
- * 			An argument to pass in based on the action
+ * static uint8_t storage[MESSAGE_BUFFER_STORAGE_SIZE(256)] __attribute__((aligned(4)));
  */
-int32_t serctl(const uint32_t action, void* const extra_arg);
+#define MESSAGE_BUFFER_STORAGE_SIZE(size) (MESSAGE_BUFFER_HEADER_SIZE + (size) + 1)
 
 /**
- * Control settings of the microSD card driver.
+ * Creates a message buffer.
  *
- * \param action
- * 			An action to perform on the microSD card driver. See the USDCTL_* macros
- *      for details on the different actions.
- * \param extra_arg
- * 		   	An argument to pass in based on the action
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The size is too small to hold a message.
+ * ENOMEM - There was not enough memory for the message buffer.
+ *
+ * \param size
+ *        The bytes the buffer holds, counting MESSAGE_BUFFER_MESSAGE_SPACE()
+ *        for each message
+ *
+ * \return A handle to the message buffer, or NULL upon failure
  */
-// Not yet implemented
-// int32_t usdctl(const uint32_t action, void* const extra_arg);
+message_buffer_t message_buffer_create(size_t size);
 
 /**
- * Control settings of the way the file's driver treats the file
+ * Creates a message buffer in the given storage.
  *
- * \param file
- * 			A valid file descriptor number
- * \param action
- * 			An action to perform on the file's driver. See the *CTL_* macros for
- * 			details on the different actions. Note that the action passed in must
- *      match the correct driver (e.g. don't perform a SERCTL_* action on a
- *      microSD card file)
- * \param extra_arg
- * 		  	An argument to pass in based on the action
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The size is too small to hold a message, or storage is NULL or
+ *          isn't aligned to 4 bytes.
+ *
+ * \param size
+ *        The bytes the buffer holds, counting MESSAGE_BUFFER_MESSAGE_SPACE()
+ *        for each message
+ * \param storage
+ *        At least MESSAGE_BUFFER_STORAGE_SIZE(size) bytes for the buffer
+ *
+ * \return A handle to the message buffer, or NULL upon failure
  */
-int32_t fdctl(int file, const uint32_t action, void* const extra_arg);
+message_buffer_t message_buffer_create_static(size_t size, void* storage);
 
 /**
- * Action macro to pass into serctl or fdctl that activates the stream
- * identifier.
+ * Deletes a message buffer, freeing its memory if it was created by
+ * message_buffer_create().
  *
- * When used with serctl, the extra argument must be the little endian
- * representation of the stream identifier (e.g. "sout" -> 0x74756f73)
+ * \param buffer
+ *        The message buffer handle
+ */
+void message_buffer_delete(message_buffer_t buffer);
+
+/**
+ * Copies a message into a message buffer.
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EMSGSIZE - The message is too long to ever fit in the buffer.
+ * ETIMEDOUT - The buffer didn't have room for the message before the timeout.
+ *
+ * \param buffer
+ *        The message buffer handle
+ * \param data
+ *        The message
+ * \param length
+ *        The length of the message in bytes
+ * \param timeout
+ *        Time to wait for room. A timeout of 0 can be used to attempt to send
+ *        without blocking. TIMEOUT_MAX can be used to block indefinitely.
+ *
+ * \return The length of the message, or 0 if it was not sent.
  */
-#define SERCTL_ACTIVATE 10
+size_t message_buffer_send(message_buffer_t buffer, const void* data, size_t length, uint32_t timeout);
 
 /**
- * Action macro to pass into serctl or fdctl that deactivates the stream
- * identifier.
+ * Copies the oldest message out of a message buffer.
  *
- * When used with serctl, the extra argument must be the little endian
- * representation of the stream identifier (e.g. "sout" -> 0x74756f73)
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EMSGSIZE - The next message is longer than max_length. It stays in the
+ *            buffer.
+ * ETIMEDOUT - No message arrived before the timeout.
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * \param buffer
+ *        The message buffer handle
+ * \param[out] data
+ *        Where to copy the message
+ * \param max_length
+ *        The most bytes data can hold
+ * \param timeout
+ *        Time to wait for a message to arrive. A timeout of 0 can be used to
+ *        check without blocking. TIMEOUT_MAX can be used to block
+ *        indefinitely.
+ *
+ * \return The length of the message, or 0 if none was received.
  */
-#define SERCTL_DEACTIVATE 11
+size_t message_buffer_recv(message_buffer_t buffer, void* data, size_t max_length, uint32_t timeout);
 
 /**
- * Action macro to pass into fdctl that enables blocking writes for the file
+ * Gets the free space in a message buffer.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * \param buffer
+ *        The message buffer handle
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * \return The bytes which are free, so the longest message which would fit
+ * is MESSAGE_BUFFER_MESSAGE_SPACE() less than this.
  */
-#define SERCTL_BLKWRITE 12
+size_t message_buffer_get_free(message_buffer_t buffer);
+
+/******************************************************************************/
+/**                               Event Groups                               **/
+/**                                                                          **/
+/**  32 event bits which tasks can set, clear and wait on, for any or all of **/
+/**  a set of bits at once. Waiting tasks block on their task notification,  **/
+/**  so a task which uses its notification for something else may stop       **/
+/**  waiting early, and only EVENT_GROUP_MAX_WAITERS tasks can block on a    **/
+/**  group at a time; any more return straight away as if they timed out.    **/
+/******************************************************************************/
+
+typedef void* event_group_t;
 
 /**
- * Action macro to pass into fdctl that makes writes non-blocking for the file
+ * The most tasks which can block on an event group at once
+ */
+#define EVENT_GROUP_MAX_WAITERS 8
+
+/**
+ * The number of bytes of storage event_group_create_static() needs
+ */
+#define EVENT_GROUP_STORAGE_SIZE (4 + 4 * EVENT_GROUP_MAX_WAITERS)
+
+/**
+ * Creates an event group with all of its bits clear.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOMEM - There was not enough memory for the event group.
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * \return A handle to the event group, or NULL upon failure
  */
-#define SERCTL_NOBLKWRITE 13
+event_group_t event_group_create(void);
 
 /**
- * Action macro to pass into serctl that enables advanced stream multiplexing
- * capabilities
+ * Creates an event group with all of its bits clear in the given storage.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - storage is NULL or isn't aligned to 4 bytes.
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * \param storage
+ *        At least EVENT_GROUP_STORAGE_SIZE bytes for the event group
+ *
+ * \return A handle to the event group, or NULL upon failure
  */
-#define SERCTL_ENABLE_COBS 14
+event_group_t event_group_create_static(void* storage);
 
 /**
- * Action macro to pass into serctl that disables advanced stream multiplexing
- * capabilities
+ * Deletes an event group created by event_group_create(). No task may be
+ * waiting on it.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * \param group
+ *        The event group handle
+ */
+void event_group_delete(event_group_t group);
+
+/**
+ * Sets bits and wakes the tasks waiting on the group.
  *
- * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
- * to learn more.
+ * \param group
+ *        The event group handle
+ * \param bits
+ *        The bits to set
+ *
+ * \return The group's bits after setting them
  */
-#define SERCTL_DISABLE_COBS 15
+uint32_t event_group_set(event_group_t group, uint32_t bits);
 
 /**
- * Action macro to check if there is data available from the Generic Serial
- * Device
+ * Clears bits.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * \param group
+ *        The event group handle
+ * \param bits
+ *        The bits to clear
+ *
+ * \return The group's bits before clearing them
  */
-#define DEVCTL_FIONREAD 16
+uint32_t event_group_clear(event_group_t group, uint32_t bits);
 
 /**
- * Action macro to check if there is space available in the Generic Serial
- * Device's output buffer
+ * Gets an event group's bits.
  *
- * The extra argument is not used with this action, provide any value (e.g.
- * NULL) instead
+ * \param group
+ *        The event group handle
+ *
+ * \return The group's bits
  */
-#define DEVCTL_FIONWRITE 18
+uint32_t event_group_get(event_group_t group);
 
 /**
- * Action macro to set the Generic Serial Device's baudrate.
+ * Waits for bits of an event group to be set.
  *
- * The extra argument is the baudrate.
+ * \param group
+ *        The event group handle
+ * \param bits
+ *        The bits to wait for
+ * \param wait_for_all
+ *        Whether to wait for all of the bits or any one of them
+ * \param clear_on_exit
+ *        Whether to clear the bits waited for when the wait succeeds
+ * \param timeout
+ *        Time to wait for the bits. TIMEOUT_MAX can be used to block
+ *        indefinitely.
+ *
+ * \return The group's bits when the wait ended, before any were cleared.
+ * Compare this against the bits waited for to tell if the wait timed out.
  */
-#define DEVCTL_SET_BAUDRATE 17
+uint32_t event_group_wait(event_group_t group, uint32_t bits, bool wait_for_all, bool clear_on_exit,
+                          uint32_t timeout);
+
+/******************************************************************************/
+/**                               Work Queues                                **/
+/**                                                                          **/
+/**  A work queue runs short jobs one after another in a worker task of its  **/
+/**  own, so a job can be pushed to a background priority without creating   **/
+/**  a task for it. Jobs are kept in a fixed pool, so submitting one never   **/
+/**  touches the heap, and a full queue turns jobs away instead of waiting.  **/
+/******************************************************************************/
+
+typedef void* work_queue_t;
+typedef void (*work_fn_t)(void*);
+
+/**
+ * The bytes of inline data each job has room for, see work_queue_reserve()
+ */
+#define WORK_QUEUE_INLINE_SIZE 32
+
+/**
+ * Creates a work queue and starts its worker task.
+ *
+ * The worker must run below the system daemon, so that jobs can never hold up
+ * VEXos's device updates.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - max_jobs is 0, or prio is TASK_PRIORITY_MAX - 2 or higher.
+ * ENOMEM - There was not enough memory for the queue or its worker.
+ *
+ * \param prio
+ *        The priority of the worker task
+ * \param max_jobs
+ *        The most jobs which can wait in the queue at once
+ * \param stack_depth
+ *        The number of words (i.e. 4 * stack_depth) available on the worker's
+ *        stack
+ * \param name
+ *        A descriptive name for the worker task
+ *
+ * \return A handle to the work queue, or NULL upon failure
+ */
+work_queue_t work_queue_create(uint32_t prio, uint32_t max_jobs, uint16_t stack_depth, const char* name);
+
+/**
+ * Runs the jobs already submitted to a work queue, then stops its worker and
+ * frees the queue. Must not be called from one of the queue's own jobs.
+ *
+ * \param queue
+ *        The work queue handle
+ */
+void work_queue_delete(work_queue_t queue);
+
+/**
+ * Submits a job to a work queue. Jobs run in the order they were submitted.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOSPC - max_jobs jobs are already waiting.
+ *
+ * \param queue
+ *        The work queue handle
+ * \param function
+ *        The function for the worker to call
+ * \param param
+ *        The parameter to pass to the function
+ *
+ * \return True if the job was submitted, false otherwise.
+ */
+bool work_queue_submit(work_queue_t queue, work_fn_t function, void* param);
+
+/**
+ * Takes a job from a work queue's pool and returns its WORK_QUEUE_INLINE_SIZE
+ * bytes of inline data, aligned to 8 bytes, which the caller fills in before
+ * handing the job over with work_queue_commit(). The function is passed the
+ * inline data, so a job's state needs no separate allocation.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOSPC - max_jobs jobs are already waiting.
+ *
+ * \param queue
+ *        The work queue handle
+ * \param function
+ *        The function for the worker to call with the job's inline data
+ *
+ * \return The job's inline data, or NULL upon failure
+ */
+void* work_queue_reserve(work_queue_t queue, work_fn_t function);
+
+/**
+ * Submits a job previously taken with work_queue_reserve().
+ *
+ * \param queue
+ *        The work queue handle
+ * \param data
+ *        The inline data returned by work_queue_reserve()
+ *
+ * \return True if the job was submitted, false otherwise.
+ */
+bool work_queue_commit(work_queue_t queue, void* data);
+
+/******************************************************************************/
+/**                         Run-to-Completion Tasks                          **/
+/**                                                                          **/
+/**  Short event handlers which run to completion each time they are         **/
+/**  activated, instead of each waiting in a task and on a stack of its own. **/
+/**  Every handler at a priority is run by one executor task for that        **/
+/**  priority, so they share its stack and never preempt one another, while  **/
+/**  handlers at higher priorities preempt them as tasks would.              **/
+/******************************************************************************/
+
+typedef void* rtc_task_t;
+typedef void (*rtc_fn_t)(void*);
+
+/**
+ * The default number of words on the stack of each priority's executor
+ */
+#define RTC_EXECUTOR_STACK_DEPTH_DEFAULT 0x400
+
+/**
+ * Sets the number of words on the stack of a priority's executor, which must
+ * have room for the deepest of its handlers. This only takes effect if it's
+ * called before the first handler at that priority is created.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - prio is TASK_PRIORITY_MAX - 2 or higher, or stack_depth is below
+ *          TASK_STACK_DEPTH_MIN
+ * EBUSY - The executor has already been started
+ *
+ * \param prio
+ *        The priority of the executor
+ * \param stack_depth
+ *        The number of words (i.e. 4 * stack_depth) available on its stack
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t rtc_executor_set_stack_depth(uint32_t prio, uint16_t stack_depth);
+
+/**
+ * Creates a run-to-completion task, starting the executor for its priority if
+ * it's the first. The handler only runs once it's activated.
+ *
+ * The handler runs once per activation, and shouldn't block or delay since
+ * the other handlers at its priority can't run until it returns.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - function is NULL, or prio is TASK_PRIORITY_MAX - 2 or higher (so
+ *          that the handlers never hold up the system daemon)
+ * ENOMEM - There was not enough memory for the task or its executor
+ *
+ * \param function
+ *        The handler to run on each activation
+ * \param param
+ *        The parameter to pass to the handler
+ * \param prio
+ *        The priority to run the handler at
+ *
+ * \return A handle to the task, or NULL upon failure
+ */
+rtc_task_t rtc_task_create(rtc_fn_t function, void* param, uint32_t prio);
+
+/**
+ * Deletes a run-to-completion task, dropping any activations which haven't
+ * run yet. If its handler is running, the task is freed once it returns,
+ * which makes it safe for a handler to delete its own task.
+ *
+ * \param task
+ *        The task to delete
+ */
+void rtc_task_delete(rtc_task_t task);
+
+/**
+ * Activates a run-to-completion task, so that its handler runs once more.
+ * Activations are counted, and a task with several waiting runs once per
+ * activation, taking turns with the other ready tasks at its priority.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - task is NULL
+ *
+ * \param task
+ *        The task to activate
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t rtc_task_activate(rtc_task_t task);
+
+/**
+ * Activates a run-to-completion task from an interrupt.
+ *
+ * The same as rtc_task_activate(), but errno is left alone since it belongs to
+ * the interrupted task.
+ *
+ * \param task
+ *        The task to activate
+ *
+ * \return True upon success, false if task is NULL
+ */
+bool rtc_task_activate_from_isr(rtc_task_t task);
+
+/******************************************************************************/
+/**                                  Topics                                  **/
+/**                                                                          **/
+/**  Named values which any task can publish and any number of tasks can    **/
+/**  read or subscribe to. Reading the latest value never blocks or takes a  **/
+/**  lock, and subscribers are woken on each publish, optionally with a      **/
+/**  queue of every value published since they last looked.                  **/
+/******************************************************************************/
+
+typedef void* topic_t;
+typedef void* topic_sub_t;
+
+/**
+ * The most characters a topic's name can have
+ */
+#define TOPIC_NAME_MAX_LEN 31
+
+/**
+ * The names of the kernel's topics, which the system daemon publishes every
+ * cycle (every 2 ms) once a task has opened them. They can't be published by
+ * tasks.
+ *
+ * TOPIC_MOTORS holds a motor_snapshot_s_t for each of ports 1-21, indexed by
+ * port - 1, with a timestamp of 0 for ports without a registered motor.
+ * TOPIC_IMUS holds an imu_state_s_t for each of ports 1-21, with a port of 0
+ * for ports without a ready Inertial Sensor.
+ * TOPIC_CONTROLLERS holds a controller_state_s_t for each controller_id_e_t.
+ * TOPIC_ODOM holds the odom_pose_s_t, and is only published while odometry is
+ * running.
+ */
+#define TOPIC_MOTORS "pros/motors"
+#define TOPIC_IMUS "pros/imus"
+#define TOPIC_CONTROLLERS "pros/controllers"
+#define TOPIC_ODOM "pros/odom"
+
+/**
+ * Creates a topic whose values are size bytes long, or gives the existing topic
+ * by that name if it has the same size. Values are copied byte for byte, so
+ * they mustn't hold pointers to memory which might change.
+ *
+ * Topics are never deleted.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name is NULL or longer than TOPIC_NAME_MAX_LEN, size is 0, or a
+ *          topic by that name already exists with a different size
+ * ENOMEM - There was not enough memory for the topic
+ *
+ * \param name
+ *        The name of the topic
+ * \param size
+ *        The size of the topic's values in bytes
+ *
+ * \return A handle to the topic, or NULL upon failure
+ */
+topic_t topic_create(const char* name, size_t size);
+
+/**
+ * Gives the topic by the given name.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name is NULL
+ * ENOENT - No topic by that name has been created
+ *
+ * \param name
+ *        The name of the topic
+ *
+ * \return A handle to the topic, or NULL upon failure
+ */
+topic_t topic_find(const char* name);
+
+/**
+ * Gets the size of a topic's values.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - topic is NULL
+ *
+ * \param topic
+ *        The topic handle
+ *
+ * \return The size in bytes, or 0 upon failure
+ */
+size_t topic_get_size(topic_t topic);
+
+/**
+ * Publishes a value on a topic, waking its subscribers. This copies the value
+ * with the scheduler suspended, so big values should be published sparingly.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - topic or value is NULL
+ * EACCES - The topic is one of the kernel's
+ *
+ * \param topic
+ *        The topic handle
+ * \param value
+ *        The value to copy, of the topic's size
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t topic_publish(topic_t topic, const void* value);
+
+/**
+ * Copies the latest value published on a topic, without blocking.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - topic or value is NULL
+ * EAGAIN - Nothing has been published yet
+ *
+ * \param topic
+ *        The topic handle
+ * \param[out] value
+ *        Where to copy the value, which must have room for the topic's size
+ *
+ * \return The value's sequence number, which counts the publishes on the topic
+ * from 1, or 0 upon failure
+ */
+uint32_t topic_read(topic_t topic, void* value);
+
+/**
+ * Gets the sequence number of the latest value published on a topic, so that
+ * polling tasks can tell whether there's a new one without copying it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - topic is NULL
+ *
+ * \param topic
+ *        The topic handle
+ *
+ * \return The sequence number, or 0 if nothing has been published yet or upon
+ * failure
+ */
+uint32_t topic_get_seq(topic_t topic);
+
+/**
+ * Subscribes the calling task to a topic.
+ *
+ * With a queue_length of 0, topic_sub_receive() only ever gives the latest
+ * value. Otherwise, every value published is also copied to the subscription's
+ * queue, the oldest being dropped once it's full, see topic_sub_get_dropped().
+ *
+ * If notify_bits isn't 0, they are also set in the task's notification value
+ * on each publish, like task_notify_ext() with E_NOTIFY_ACTION_BITS, so that a
+ * task can wait on several topics at once with task_notify_take().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - topic is NULL
+ * ENOMEM - There was not enough memory for the subscription
+ *
+ * \param topic
+ *        The topic handle
+ * \param queue_length
+ *        The number of values to queue, or 0 to only keep the latest one
+ * \param notify_bits
+ *        The notification bits to set on the task for each publish, or 0
+ *
+ * \return A handle to the subscription, or NULL upon failure
+ */
+topic_sub_t topic_subscribe(topic_t topic, uint32_t queue_length, uint32_t notify_bits);
+
+/**
+ * Ends a subscription. No task may be receiving from it.
+ *
+ * \param sub
+ *        The subscription handle
+ */
+void topic_unsubscribe(topic_sub_t sub);
+
+/**
+ * Waits for a value published since the subscription last received one. With a
+ * queue that's the oldest value queued, and otherwise the latest value.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - sub or value is NULL
+ * EAGAIN - Nothing new was published before the timeout
+ *
+ * \param sub
+ *        The subscription handle
+ * \param[out] value
+ *        Where to copy the value, which must have room for the topic's size
+ * \param timeout
+ *        The time in milliseconds to wait, or 0 to return immediately, or
+ *        TIMEOUT_MAX to wait forever
+ *
+ * \return The value's sequence number, or 0 upon failure
+ */
+uint32_t topic_sub_receive(topic_sub_t sub, void* value, uint32_t timeout);
+
+/**
+ * Gets the number of values dropped from a subscription's queue because it was
+ * full.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - sub is NULL
+ *
+ * \param sub
+ *        The subscription handle
+ *
+ * \return The number of values dropped, or PROS_ERR upon failure
+ */
+uint32_t topic_sub_get_dropped(topic_sub_t sub);
+
+/******************************************************************************/
+/**                              Software Timers                             **/
+/**                                                                          **/
+/**  Timers kept on a hierarchical timing wheel, so starting or stopping one **/
+/**  takes the same time however many timers exist. Callbacks run in the     **/
+/**  "PROS Timers" task, one batch for all the timers expiring on a tick.    **/
+/******************************************************************************/
+
+typedef void* sw_timer_t;
+typedef void (*timer_fn_t)(void*);
+
+/**
+ * Creates a software timer. The timer does not run until timer_start() is
+ * called.
+ *
+ * Callbacks run in the timer task at a priority of TASK_PRIORITY_MAX - 3, so
+ * they should be short and must not block; a slow callback delays every other
+ * timer.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The callback is NULL or the period is 0
+ * ENOMEM - The timer could not be allocated
+ *
+ * \param callback
+ *        The function to call when the timer expires
+ * \param param
+ *        The parameter passed to the callback
+ * \param period
+ *        The time in milliseconds from a start of the timer to its expiry
+ * \param periodic
+ *        Whether the timer restarts by itself after every expiry. Periodic
+ *        timers keep to multiples of the period like task_delay_until().
+ *
+ * \return A handle to the timer, or NULL if an error occurred
+ */
+sw_timer_t timer_create(timer_fn_t callback, void* param, uint32_t period, bool periodic);
+
+/**
+ * Starts a timer so that it expires one period from now. A timer which is
+ * already running is restarted.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The timer is NULL
+ *
+ * \param timer
+ *        The timer to start
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t timer_start(sw_timer_t timer);
+
+/**
+ * Stops a timer. Its callback is not called again until it is restarted.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The timer is NULL
+ *
+ * \param timer
+ *        The timer to stop
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t timer_stop(sw_timer_t timer);
+
+/**
+ * Checks whether a timer has been started and has not expired or been
+ * stopped since. Periodic timers stay active until they are stopped.
+ *
+ * \param timer
+ *        The timer to check
+ *
+ * \return True if the timer is running
+ */
+bool timer_is_active(sw_timer_t timer);
+
+/**
+ * Stops and frees a timer. This may be called from the timer's own callback.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The timer is NULL
+ *
+ * \param timer
+ *        The timer to delete
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t timer_delete(sw_timer_t timer);
+
+/******************************************************************************/
+/**                           Task CPU Statistics                            **/
+/**                                                                          **/
+/**  Every task is credited with the microseconds it runs for. Once a second **/
+/**  the kernel works out the share of the CPU each task used since the last **/
+/**  sample, and can print a table of them on the kdbg stream.               **/
+/******************************************************************************/
+
+/**
+ * Gets the total time a task has spent running.
+ *
+ * \param task
+ *        The task to check, or NULL for the calling task
+ *
+ * \return The task's run time in microseconds. This wraps around after about
+ * 71 minutes.
+ */
+uint32_t task_get_cpu_time(task_t task);
+
+/**
+ * Gets the share of the CPU a task used during the last one second sample.
+ *
+ * \param task
+ *        The task to check, or NULL for the calling task
+ *
+ * \return The percentage of the CPU the task used, or 0 if the task has not
+ * been sampled yet.
+ */
+double task_get_cpu_usage(task_t task);
+
+/**
+ * Prints the CPU usage and total run time of every task on the kdbg stream,
+ * busiest first, at a regular interval. The stream must be activated with
+ * serctl(SERCTL_ACTIVATE, 0x6762646b), its 'kdbg' ID, to be seen.
+ *
+ * \param period
+ *        The interval in milliseconds, rounded up to whole seconds. A period of
+ *        0 stops the reports.
+ */
+void task_cpu_report_set_period(uint32_t period);
+
+/******************************************************************************/
+/**                                Idle Work                                 **/
+/**                                                                          **/
+/**  Deferrable work, such as compacting, flushing logs or aggregating       **/
+/**  statistics, can be run by the idle task while no other task is ready.   **/
+/**  Each time around its loop the idle task first frees the tasks which     **/
+/**  have deleted themselves, then runs the registered callbacks in turn     **/
+/**  until its budget for that pass is used up. Idle work runs at the lowest **/
+/**  priority, so any other task which becomes ready preempts it straight    **/
+/**  away.                                                                   **/
+/******************************************************************************/
+
+/**
+ * The most callbacks which can be registered at once.
+ */
+#define IDLE_WORK_MAX 8
+
+/**
+ * The default time the idle task spends on callbacks each pass of its loop,
+ * in microseconds.
+ */
+#define IDLE_WORK_DEFAULT_BUDGET 1000
+
+/**
+ * Does a piece of deferrable work. It runs in the idle task, so it must never
+ * block or delay, and it should return by the deadline so that the other
+ * callbacks and the idle task's own work get their turn. It is called again
+ * on every pass in which there is time, so long jobs should be split up.
+ *
+ * \param param
+ *        The parameter given to idle_work_register()
+ * \param deadline
+ *        The micros() time at which the idle task's budget for this pass runs out
+ */
+typedef void (*idle_work_fn_t)(void* param, uint64_t deadline);
+
+/**
+ * Statistics of the idle work since startup.
+ */
+typedef struct idle_work_stats_s {
+	uint32_t runs;       // Number of callbacks run
+	uint32_t overruns;   // Number of callbacks which returned after their deadline
+	uint32_t longest;    // The longest a callback took in microseconds, including while it was preempted
+	uint64_t work_time;  // The total time callbacks took in microseconds, including while they were preempted
+} idle_work_stats_s_t;
+
+/**
+ * Registers a callback to be run by the idle task.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - fn is NULL
+ * ENOSPC - IDLE_WORK_MAX callbacks are already registered
+ *
+ * \param fn
+ *        The function to call
+ * \param param
+ *        The parameter passed to it
+ *
+ * \return An ID for idle_work_unregister() upon success, PROS_ERR upon failure
+ */
+int32_t idle_work_register(idle_work_fn_t fn, void* param);
+
+/**
+ * Unregisters a callback. If the idle task is in the middle of running it,
+ * this waits for it to return, so its parameter may be freed afterwards.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - id is not a registered callback
+ *
+ * \param id
+ *        The ID returned by idle_work_register()
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t idle_work_unregister(int32_t id);
+
+/**
+ * Sets how long the idle task spends on callbacks each pass of its loop.
+ *
+ * \param budget
+ *        The time in microseconds, after which no further callback is started
+ *        until the next pass
+ */
+void idle_work_set_budget(uint32_t budget);
+
+/**
+ * Gets the idle work's statistics.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t idle_work_get_stats(idle_work_stats_s_t* const stats);
+
+/**
+ * Gets the share of the CPU which no task other than the idle task wanted
+ * during the last one second sample of the task CPU statistics. Idle work is
+ * included, since it only ever uses time which would otherwise be idle.
+ *
+ * \return The percentage of the CPU which was idle, or 0 if the idle task has
+ * not been sampled yet.
+ */
+double idle_get_usage(void);
+
+/******************************************************************************/
+/**                            Overload Handling                             **/
+/**                                                                          **/
+/**  Once a second, with the task CPU statistics, the kernel adds up the CPU **/
+/**  used by each class of task priority. With a policy set, it sheds the    **/
+/**  kernel's optional work in steps while the idle share stays low, and     **/
+/**  gives it back once there is room again, so an overloaded program slows  **/
+/**  its logging, display and telemetry before its own tasks starve.         **/
+/******************************************************************************/
+
+/**
+ * How much of the kernel's optional work is being shed
+ */
+typedef enum overload_level_e {
+	E_OVERLOAD_NONE = 0,  // Nothing is shed
+	// Info messages aren't logged, 1 in 2 plog() messages is kept, the display
+	// redraws every 250 ms and telemetry is sent half as often
+	E_OVERLOAD_DEGRADED,
+	// Only errors are logged, 1 in 8 plog() messages is kept, the display is
+	// frozen and telemetry is sent a quarter as often
+	E_OVERLOAD_SEVERE
+} overload_level_e_t;
+
+/**
+ * The classes CPU usage is added up in, by the tasks' base priorities
+ */
+typedef enum task_class_e {
+	E_TASK_CLASS_HIGH = 0,  // Above TASK_PRIORITY_DEFAULT, e.g. the system daemon and timing critical tasks
+	E_TASK_CLASS_DEFAULT,   // TASK_PRIORITY_DEFAULT, e.g. the competition tasks
+	E_TASK_CLASS_LOW,       // Below TASK_PRIORITY_DEFAULT, e.g. the display daemon and log draining
+	E_TASK_CLASS_IDLE,      // The idle task and its idle work
+	E_TASK_CLASSES
+} task_class_e_t;
+
+/**
+ * Which of the kernel's optional work a policy may shed
+ */
+#define OVERLOAD_SHED_LOGS 0x1       // klog and plog messages
+#define OVERLOAD_SHED_DISPLAY 0x2    // display refreshes, on top of display_set_refresh_mode()
+#define OVERLOAD_SHED_TELEMETRY 0x4  // motor telemetry samples and metrics snapshots
+#define OVERLOAD_SHED_ALL (OVERLOAD_SHED_LOGS | OVERLOAD_SHED_DISPLAY | OVERLOAD_SHED_TELEMETRY)
+
+/**
+ * When to shed work. The level rises as soon as a one second sample's idle
+ * share drops below the level's threshold, and falls a level at a time once
+ * the idle share has stayed restore_margin above the current level's
+ * threshold for restore_windows samples in a row.
+ */
+typedef struct overload_policy_s {
+	double degraded_idle;      // The idle percentage below which to go to E_OVERLOAD_DEGRADED
+	double severe_idle;        // The idle percentage below which to go to E_OVERLOAD_SEVERE
+	double restore_margin;     // In percentage points
+	uint32_t restore_windows;  // In one second samples
+	uint32_t actions;          // The OVERLOAD_SHED_* to apply
+	// Called from the timer task whenever the level changes, e.g. to shed the
+	// program's own work too. May be NULL
+	void (*on_change)(overload_level_e_t level, void* param);
+	void* param;
+} overload_policy_s_t;
+
+/**
+ * Statistics of the CPU usage and the overload handling
+ */
+typedef struct overload_stats_s {
+	overload_level_e_t level;                 // The current level
+	double class_usage[E_TASK_CLASSES];       // The percentage of the latest sample used by each class
+	uint32_t windows[E_OVERLOAD_SEVERE + 1];  // The number of samples spent at each level
+	uint32_t changes;                         // The number of times the level changed
+	uint32_t logs_shed;                       // The plog() messages left out while shedding logs
+} overload_stats_s_t;
+
+/**
+ * Sets the overload policy. Without one (the default) the CPU usage is still
+ * added up, but nothing is shed.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A threshold is outside 0-100, severe_idle is above degraded_idle,
+ * restore_margin is negative or restore_windows is 0
+ *
+ * \param policy
+ *        The policy, which is copied, or NULL to stop shedding and give back
+ *        whatever was shed
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t overload_set_policy(const overload_policy_s_t* const policy);
+
+/**
+ * Gets the current overload level.
+ *
+ * \return The level, E_OVERLOAD_NONE if no policy is set
+ */
+overload_level_e_t overload_get_level(void);
+
+/**
+ * Gets the overload statistics.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t overload_get_stats(overload_stats_s_t* const stats);
+
+/******************************************************************************/
+/**                          Task Stack Statistics                           **/
+/**                                                                          **/
+/**  Every five seconds the kernel checks how close each task has come to    **/
+/**  overflowing its stack. The lowest free space is kept by task name, so   **/
+/**  tasks which have since ended are still reported.                        **/
+/******************************************************************************/
+
+typedef struct task_stack_stats_s {
+	char name[TASK_NAME_MAX_LEN];  // The name of the task
+	uint32_t stack_size;           // The size of the task's stack in words
+	uint32_t min_free;             // The fewest words ever left free on the stack
+} task_stack_stats_s_t;
+
+/**
+ * Gets the stack usage of every task seen so far.
+ *
+ * \param stats
+ *        An array to fill in, which may be NULL to only count the tasks
+ * \param count
+ *        The number of entries in stats
+ *
+ * \return The number of tasks known, which may be more than count
+ */
+int32_t task_get_stack_stats(task_stack_stats_s_t* stats, uint32_t count);
+
+/**
+ * Prints the stack size and lowest free space of every task seen so far on the
+ * kdbg stream, closest to overflowing first. This is done once by the timer
+ * task, so the function returns immediately.
+ *
+ * The kernel prints this report when a match ends, i.e. when the robot is
+ * disabled after driver control while connected to a field controller.
+ */
+void task_stack_report(void);
+
+/******************************************************************************/
+/**                           Task List Snapshots                            **/
+/**                                                                          **/
+/**  task_list_snapshot() reads the state of every task in one walk of the   **/
+/**  scheduler's lists, so monitoring code can list the tasks often without  **/
+/**  holding up the system it's watching. The stack scans only go over the   **/
+/**  words used since the last snapshot.                                     **/
+/******************************************************************************/
+
+typedef struct task_snapshot_s {
+	task_t task;                   // The task's handle
+	char name[TASK_NAME_MAX_LEN];  // The name of the task
+	task_state_e_t state;          // The task's state when the snapshot was taken
+	uint32_t priority;             // The task's priority, which may be inherited from a mutex
+	uint32_t stack_free;           // The fewest words ever left free on the task's stack
+	uint32_t cpu_time;             // The task's run time in microseconds, see task_get_cpu_time()
+} task_snapshot_s_t;
+
+/**
+ * Takes a snapshot of every task.
+ *
+ * The scheduler is suspended for the walk. The first snapshot scans the used
+ * part of every stack, later ones only what each task has used since.
+ *
+ * \param snapshot
+ *        An array to fill in, which may be NULL to only count the tasks
+ * \param count
+ *        The number of entries in snapshot
+ *
+ * \return The number of tasks, which may be more than count. Only the first
+ * count of them are filled in.
+ */
+int32_t task_list_snapshot(task_snapshot_s_t* snapshot, uint32_t count);
+
+/******************************************************************************/
+/**                               Kernel Heap                                **/
+/**                                                                          **/
+/**  The kernel heap backs kmalloc(), and with it every task, queue and      **/
+/**  mutex which isn't statically allocated as well as LVGL's memory. By     **/
+/**  default it is a TLSF allocator, so allocating and freeing take bounded  **/
+/**  time no matter how fragmented the heap gets.                            **/
+/******************************************************************************/
+
+/**
+ * The state of the kernel heap, see heap_get_stats(). Free byte counts include
+ * the 8 byte header of each free block
+ */
+typedef struct heap_stats_s {
+	uint32_t total_bytes;         // The size of the heap
+	uint32_t free_bytes;          // The number of bytes which are free
+	uint32_t min_free_bytes;      // The fewest bytes which have ever been free
+	uint32_t largest_free_block;  // The largest allocation which would currently succeed
+	uint32_t free_blocks;         // The number of free blocks the free space is split into
+	float fragmentation;          // 1 - the largest free block / the free space, from 0 to 1
+} heap_stats_s_t;
+
+/**
+ * Gets the state of the kernel heap.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *              Where to store the state of the heap
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t heap_get_stats(heap_stats_s_t* stats);
+
+/**
+ * Allocates memory from the kernel heap at an address which is a multiple of
+ * alignment, e.g. 32 or 64 bytes so that a buffer used by NEON code or copied
+ * in bulk starts on a cache line and doesn't share one with anything else.
+ *
+ * The memory must be freed with kfree_aligned(). malloc()'s memory can be
+ * aligned the same way with aligned_alloc() or posix_memalign().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - alignment is not a power of 2
+ * ENOMEM - There isn't a free block which fits
+ *
+ * \param size
+ *        The number of bytes to allocate
+ * \param alignment
+ *        The alignment of the memory, a power of 2
+ *
+ * \return The memory, or NULL upon failure
+ */
+void* kmalloc_aligned(size_t size, size_t alignment);
+
+/**
+ * Frees memory allocated with kmalloc_aligned().
+ *
+ * \param ptr
+ *        The memory to free, or NULL to do nothing
+ */
+void kfree_aligned(void* ptr);
+
+/**
+ * Prints every live kmalloc() and malloc() allocation on the kdbg stream,
+ * grouped by call site and task with the largest total first.
+ *
+ * The call sites are return addresses, which can be turned into source lines
+ * on the host with e.g. arm-none-eabi-addr2line -e bin/monolith.elf 0x...
+ * Allocations with operator new are attributed to operator new itself.
+ *
+ * Only available when the kernel is built with configUSE_HEAP_TRACKING set in
+ * FreeRTOSConfig.h. Allocations made while the tracking table was full aren't
+ * listed, but are counted in the report.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOSYS - The kernel was built without heap tracking
+ * ENOMEM - There isn't enough memory to put the report together
+ *
+ * \return The number of live allocations upon success, PROS_ERR upon failure
+ */
+int32_t heap_track_dump(void);
+
+/******************************************************************************/
+/**                               Memory Pools                               **/
+/**                                                                          **/
+/**  Fixed-size blocks carved out of memory the caller provides. Allocating  **/
+/**  and freeing take a few instructions without locking anything, so pools  **/
+/**  can be used from control loops and interrupts alike. See pros::Pool in  **/
+/**  pros/rtos.hpp for an allocator for C++ objects and containers.          **/
+/******************************************************************************/
+
+typedef void* pool_t;
+
+/**
+ * The bytes at the start of a pool's storage which hold its bookkeeping
+ */
+#define POOL_HEADER_SIZE 16
+
+/**
+ * The alignment of every block, and of the storage given to
+ * pool_create_static()
+ */
+#define POOL_ALIGNMENT 8
+
+/**
+ * The space each block takes up in a pool's storage
+ */
+#define POOL_BLOCK_STRIDE(block_size) (((block_size) + POOL_ALIGNMENT - 1) & ~(POOL_ALIGNMENT - 1))
+
+/**
+ * The number of bytes of storage a pool of count blocks of block_size bytes
+ * needs, e.g.
+ *
+ * static uint8_t storage[POOL_STORAGE_SIZE(sizeof(msg_s_t), 16)] __attribute__((aligned(POOL_ALIGNMENT)));
+ */
+#define POOL_STORAGE_SIZE(block_size, count) (POOL_HEADER_SIZE + (count)*POOL_BLOCK_STRIDE(block_size))
+
+/**
+ * Creates a pool of fixed-size blocks in the given storage.
+ *
+ * The pool lives entirely in the storage, so nothing needs to be freed when it
+ * is no longer used.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - block_size or count is 0, or storage is NULL or isn't aligned to
+ *          POOL_ALIGNMENT
+ *
+ * \param block_size
+ *        The size of each block in bytes
+ * \param count
+ *        The number of blocks in the pool
+ * \param storage
+ *        At least POOL_STORAGE_SIZE(block_size, count) bytes for the pool
+ *
+ * \return A handle to the pool, or NULL upon failure
+ */
+pool_t pool_create_static(size_t block_size, uint32_t count, void* storage);
+
+/**
+ * Takes a block from a pool.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - pool is NULL
+ * ENOMEM - Every block is in use
+ *
+ * \param pool
+ *        The pool to take a block from
+ *
+ * \return The block, which is aligned to POOL_ALIGNMENT, or NULL upon failure
+ */
+void* pool_alloc(pool_t pool);
+
+/**
+ * Gives a block back to the pool it was taken from.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - pool is NULL, or block is not one of the pool's blocks
+ *
+ * \param pool
+ *        The pool the block was taken from
+ * \param block
+ *        The block to give back
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t pool_free(pool_t pool, void* block);
+
+/**
+ * Takes a block from a pool, from an interrupt.
+ *
+ * The same as pool_alloc(), but errno is left alone since it belongs to the
+ * interrupted task.
+ *
+ * \param pool
+ *        The pool to take a block from
+ *
+ * \return The block, or NULL if every block is in use
+ */
+void* pool_alloc_from_isr(pool_t pool);
+
+/**
+ * Gives a block back to the pool it was taken from, from an interrupt.
+ *
+ * The same as pool_free(), but errno is left alone since it belongs to the
+ * interrupted task.
+ *
+ * \param pool
+ *        The pool the block was taken from
+ * \param block
+ *        The block to give back
+ *
+ * \return True upon success, false if block is not one of the pool's blocks
+ */
+bool pool_free_from_isr(pool_t pool, void* block);
+
+/**
+ * Gets the number of blocks of a pool which aren't in use.
+ *
+ * \param pool
+ *        The pool
+ *
+ * \return The number of free blocks
+ */
+uint32_t pool_get_free(pool_t pool);
+
+/******************************************************************************/
+/**                              Hybrid Mutexes                              **/
+/**                                                                          **/
+/**  Mutexes which are taken and given with a single atomic compare-and-swap **/
+/**  while no other task wants them, and only fall back to a blocking mutex  **/
+/**  with priority inheritance when one does. They aren't recursive and      **/
+/**  can't be used from interrupts.                                          **/
+/******************************************************************************/
+
+typedef void* hybrid_mutex_t;
+
+/**
+ * Creates a hybrid mutex.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOMEM - There isn't enough memory for the mutex
+ *
+ * \return A handle to the mutex, or NULL upon failure
+ */
+hybrid_mutex_t hybrid_mutex_create(void);
+
+/**
+ * Takes a hybrid mutex, waiting for it if another task has it. While the
+ * calling task waits, the owner runs at the calling task's priority if that is
+ * higher than its own.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - mutex is NULL
+ *
+ * \param mutex
+ *        The mutex to take
+ * \param timeout
+ *        How long to wait for the mutex in milliseconds. 0 returns at once,
+ *        TIMEOUT_MAX waits forever
+ *
+ * \return True if the mutex was taken, false if the timeout passed first or an
+ * error occurred
+ */
+bool hybrid_mutex_take(hybrid_mutex_t mutex, uint32_t timeout);
+
+/**
+ * Gives back a hybrid mutex taken by the calling task.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - mutex is NULL
+ * EPERM - The calling task doesn't have the mutex
+ *
+ * \param mutex
+ *        The mutex to give
+ *
+ * \return True if the mutex was given, false if an error occurred
+ */
+bool hybrid_mutex_give(hybrid_mutex_t mutex);
+
+/**
+ * Gets the task which has a hybrid mutex. Unlike mutex_get_owner() this doesn't
+ * enter a critical section.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - mutex is NULL
+ *
+ * \param mutex
+ *        The mutex
+ *
+ * \return The task which has the mutex, or NULL if no task has it
+ */
+task_t hybrid_mutex_get_owner(hybrid_mutex_t mutex);
+
+/**
+ * Deletes a hybrid mutex created with hybrid_mutex_create(). No task may have
+ * the mutex or be waiting for it.
+ *
+ * \param mutex
+ *        The mutex to delete
+ */
+void hybrid_mutex_delete(hybrid_mutex_t mutex);
+
+/******************************************************************************/
+/**                              Display Arenas                              **/
+/**                                                                          **/
+/**  Regions which LVGL objects can be allocated from instead of the kernel  **/
+/**  heap, so a screen's objects don't leave holes all over the heap once    **/
+/**  it is deleted. The region is reused as soon as everything allocated in  **/
+/**  it has been freed.                                                      **/
+/******************************************************************************/
+
+typedef void* display_arena_t;
+
+/**
+ * The state of a display arena, see display_arena_get_stats()
+ */
+typedef struct display_arena_stats_s {
+	uint32_t size;         // The size of the arena's region
+	uint32_t used;         // The bytes of the region handed out since it was last empty
+	uint32_t high_water;   // The most bytes of the region which have ever been handed out
+	uint32_t live_blocks;  // The number of allocations which haven't been freed yet
+} display_arena_stats_s_t;
+
+/**
+ * Creates a display arena with a region of the given size, allocated from the
+ * kernel heap.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - size is 0
+ * ENOMEM - The kernel heap doesn't have room for the region
+ *
+ * \param size
+ *        The size of the region in bytes
+ *
+ * \return A handle to the arena, or NULL upon failure
+ */
+display_arena_t display_arena_create(size_t size);
+
+/**
+ * Makes LVGL allocate from an arena for as long as the calling task has it
+ * selected, e.g. while building a screen:
+ *
+ * display_arena_select(arena);
+ * lv_obj_t* screen = lv_obj_create(NULL, NULL);
+ * ... // Create and style the screen's objects
+ * display_arena_select(NULL);
+ *
+ * Only LVGL calls made by the calling task use the arena. Anything which
+ * doesn't fit in it any more comes from the kernel heap as usual. Once every
+ * allocation made from the arena is freed, which deleting the screen does, its
+ * whole region can be used again.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EBUSY - Another task has an arena selected
+ *
+ * \param arena
+ *        The arena to allocate from, or NULL to go back to the kernel heap
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t display_arena_select(display_arena_t arena);
+
+/**
+ * Deletes a display arena and frees its region.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - arena is NULL
+ * EBUSY - Allocations made from the arena haven't all been freed, or the arena
+ *         is selected
+ *
+ * \param arena
+ *        The arena to delete
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t display_arena_delete(display_arena_t arena);
+
+/**
+ * Gets the state of a display arena, e.g. to size it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - arena or stats is NULL
+ *
+ * \param arena
+ *        The arena
+ * \param[out] stats
+ *              Where to store the state of the arena
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t display_arena_get_stats(display_arena_t arena, display_arena_stats_s_t* stats);
+
+/**
+ * How much memory LVGL holds, see display_get_mem_stats()
+ */
+typedef struct display_mem_stats_s {
+	uint32_t heap_bytes;       // Bytes of the kernel heap LVGL holds now, including the heap's block headers
+	uint32_t peak_heap_bytes;  // The most bytes of the kernel heap LVGL has held at once
+	uint32_t heap_blocks;      // The number of kernel heap blocks LVGL holds now
+	uint32_t arena_bytes;      // Bytes handed out from all of the display arenas
+	uint32_t failed_allocs;    // The number of LVGL's allocations which didn't fit anywhere
+	float heap_fragmentation;  // The fragmentation of the whole kernel heap now, see heap_get_stats()
+} display_mem_stats_s_t;
+
+/**
+ * Gets how much memory LVGL holds, e.g. to tell how much of the kernel heap
+ * is left for everything else. lv_mem_monitor() can't tell, since LVGL's
+ * memory comes from the kernel heap and display arenas instead of its own
+ * pool.
+ *
+ * The kernel heap is shared, so its fragmentation includes the blocks of
+ * every other user. Drawing the UI into a display arena keeps LVGL's blocks
+ * from adding to it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *              Where to store the figures
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t display_get_mem_stats(display_mem_stats_s_t* stats);
+
+/**
+ * Restarts the peak of display_get_mem_stats() from the current usage, e.g.
+ * to measure a single screen.
+ */
+void display_reset_mem_peak(void);
+
+/******************************************************************************/
+/**                             Display Refreshes                            **/
+/**                                                                          **/
+/**  LVGL redraws the invalidated parts of the screen every 40 ms unless the  **/
+/**  refresh mode says otherwise. Nearby invalidated areas are merged on     **/
+/**  16x16 pixel tiles first, so that a screen of small, frequently updated  **/
+/**  labels takes a few large copies to the screen instead of many small     **/
+/**  ones. The statistics show what the refreshes cost, and the render      **/
+/**  statistics which kinds of LVGL objects take the time to draw.           **/
+/******************************************************************************/
+
+/**
+ * The cost of the display refreshes, see display_get_refresh_stats()
+ */
+typedef struct display_refresh_stats_s {
+	uint32_t refreshes;          // The number of refreshes which drew something
+	uint32_t flushes;            // The number of rectangles copied to the screen
+	uint32_t pixels;             // The number of pixels copied to the screen
+	uint32_t flush_time;         // The total time spent copying to the screen, in microseconds
+	uint32_t max_flush_time;     // The longest single copy to the screen, in microseconds
+	uint32_t last_flushes;       // The number of rectangles the latest refresh copied
+	uint32_t last_pixels;        // The number of pixels the latest refresh copied
+	uint32_t last_refresh_time;  // How long the latest refresh took, drawing included, in milliseconds
+} display_refresh_stats_s_t;
+
+/**
+ * Gets the statistics of the display refreshes since PROS started or since
+ * display_reset_refresh_stats() was last called.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *        Set to the statistics
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_get_refresh_stats(display_refresh_stats_s_t* stats);
+
+/**
+ * Resets the display refresh statistics to zero, e.g. before measuring a
+ * screen.
+ */
+void display_reset_refresh_stats(void);
+
+/**
+ * The number of buckets in display_render_stats_s_t::histogram
+ */
+#define DISPLAY_RENDER_BUCKETS 8
+
+/**
+ * The draw times of one type of LVGL object, see display_get_render_stats()
+ */
+typedef struct display_render_stats_s {
+	const char* type;          // The object type, e.g. "lv_btn"
+	uint32_t draws;            // The number of times an object of the type was drawn
+	uint32_t draw_time;        // The total time spent drawing the objects, in microseconds
+	uint32_t max_draw_time;    // The longest time an object took, in microseconds
+	uint32_t histogram[DISPLAY_RENDER_BUCKETS];  // The draws which took < 16, < 32, ... < 1024 and >= 1024 microseconds
+} display_render_stats_s_t;
+
+/**
+ * Gets how long each type of LVGL object took to draw since PROS started or
+ * since display_reset_render_stats() was last called.
+ *
+ * An object's time doesn't include drawing its children, so a slow screen
+ * shows up as the types of the objects which are slow themselves. The types
+ * come in the order they were first drawn.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL and count isn't 0
+ *
+ * \param[out] stats
+ *        An array of count statistics, set to the first count object types
+ * \param count
+ *        The length of stats
+ *
+ * \return The number of object types drawn, which may be more than count, or
+ * PROS_ERR if the operation failed, setting errno.
+ */
+int32_t display_get_render_stats(display_render_stats_s_t* stats, uint32_t count);
+
+/**
+ * Resets the render statistics, e.g. before measuring a screen.
+ */
+void display_reset_render_stats(void);
+
+/**
+ * How often the display daemon redraws the screen and reads the touch screen
+ */
+typedef enum display_refresh_mode {
+	E_DISPLAY_REFRESH_FULL = 0,  // Redraw every 40 ms (the default)
+	E_DISPLAY_REFRESH_REDUCED,   // Redraw every 250 ms
+	E_DISPLAY_REFRESH_FROZEN,    // Don't run LVGL at all, so nothing is redrawn or animated and touches are ignored
+	E_DISPLAY_REFRESH_AUTO       // Frozen while the robot is in autonomous and enabled, full otherwise
+} display_refresh_mode_e_t;
+
+/**
+ * Sets how often the display daemon redraws the screen. Between its LVGL tasks
+ * the daemon sleeps, so the less often the screen is redrawn the more CPU is
+ * left to the other tasks, e.g. in E_DISPLAY_REFRESH_AUTO mode nothing is
+ * drawn during autonomous when nobody is looking at the screen.
+ *
+ * Changes made to the screen while it is frozen are drawn once it isn't.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - mode isn't a display_refresh_mode_e_t
+ *
+ * \param mode
+ *        The new refresh mode
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_set_refresh_mode(display_refresh_mode_e_t mode);
+
+/**
+ * Gets the refresh mode set with display_set_refresh_mode().
+ *
+ * \return The refresh mode
+ */
+display_refresh_mode_e_t display_get_refresh_mode(void);
+
+/******************************************************************************/
+/**                             Display Canvases                             **/
+/**                                                                          **/
+/**  Rectangles of the screen reserved for drawing directly, e.g. live plots **/
+/**  which would be too slow as LVGL charts. A canvas is drawn in memory and **/
+/**  copied to the screen in one go with display_canvas_present(). LVGL      **/
+/**  keeps drawing the rest of the screen but never draws over a canvas.     **/
+/******************************************************************************/
+
+/**
+ * The most canvases which can exist at once
+ */
+#define DISPLAY_CANVAS_MAX 4
+
+typedef struct display_canvas_s* display_canvas_t;
+
+/**
+ * Reserves a rectangle of the screen as a canvas, cleared to black. Nothing is
+ * shown in it until display_canvas_present() is called.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The rectangle is empty or not on the screen
+ * EBUSY - The rectangle overlaps another canvas
+ * ENOSPC - DISPLAY_CANVAS_MAX canvases already exist
+ * ENOMEM - The kernel heap doesn't have room for the canvas's pixels
+ *
+ * \param x1, y1
+ *        The top left corner of the canvas on the screen
+ * \param x2, y2
+ *        The bottom right corner of the canvas on the screen
+ *
+ * \return A handle to the canvas, or NULL upon failure
+ */
+display_canvas_t display_canvas_create(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+
+/**
+ * Deletes a canvas and gives its rectangle back to LVGL, which redraws it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to delete
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_delete(display_canvas_t canvas);
+
+/**
+ * Fills a canvas with a color.
+ *
+ * The drawing functions only change the canvas in memory and clip what they
+ * draw to it. Coordinates are relative to the canvas's top left corner, and
+ * colors are 0xRRGGBB, like the COLOR_ constants. A canvas should be drawn by
+ * one task at a time.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to draw on
+ * \param color
+ *        The color to fill it with
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_clear(display_canvas_t canvas, uint32_t color);
+
+/**
+ * Sets a pixel of a canvas, see display_canvas_clear() for the conventions of
+ * the drawing functions.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to draw on
+ * \param x, y
+ *        The pixel
+ * \param color
+ *        The color to set it to
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_set_pixel(display_canvas_t canvas, int16_t x, int16_t y, uint32_t color);
+
+/**
+ * Fills a rectangle of a canvas, see display_canvas_clear() for the
+ * conventions of the drawing functions.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to draw on
+ * \param x1, y1, x2, y2
+ *        The corners of the rectangle, inclusive
+ * \param color
+ *        The color to fill it with
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_fill_rect(display_canvas_t canvas, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                 uint32_t color);
+
+/**
+ * Draws a line on a canvas, see display_canvas_clear() for the conventions of
+ * the drawing functions.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to draw on
+ * \param x0, y0, x1, y1
+ *        The ends of the line, both drawn
+ * \param color
+ *        The color of the line
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_draw_line(display_canvas_t canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 uint32_t color);
+
+/**
+ * Scrolls a canvas left, filling the columns which come in on the right with
+ * a color. A plot can then draw only its newest points each frame:
+ *
+ * display_canvas_scroll(canvas, 1, COLOR_BLACK);
+ * display_canvas_draw_line(canvas, width - 2, last_y, width - 1, y, COLOR_WHITE);
+ * display_canvas_present(canvas);
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL or columns is negative
+ *
+ * \param canvas
+ *        The canvas to scroll
+ * \param columns
+ *        How many columns to scroll by
+ * \param color
+ *        The color of the new columns
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_scroll(display_canvas_t canvas, int16_t columns, uint32_t color);
+
+/**
+ * Copies a canvas to the screen.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - canvas is NULL
+ *
+ * \param canvas
+ *        The canvas to show
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t display_canvas_present(display_canvas_t canvas);
+
+/******************************************************************************/
+/**                              Display Images                              **/
+/**                                                                          **/
+/**  Images on the microSD card can be shown with LVGL by their path on the  **/
+/**  "S:" drive, e.g. lv_img_set_src(img, "S:/logo.bin"). Each file is read  **/
+/**  with usd_load_file(), decoded once and kept in LVGL's image cache, so   **/
+/**  it is drawn from memory afterwards. The size of the cache is set with   **/
+/**  lv_img_cache_set_size(), and files which changed on the card are        **/
+/**  dropped from it with lv_img_cache_invalidate_src().                     **/
+/******************************************************************************/
+
+/**
+ * The LVGL drive letter of the microSD card
+ */
+#define DISPLAY_USD_LETTER 'S'
+
+/******************************************************************************/
+/**                             Scheduler Trace                              **/
+/**                                                                          **/
+/**  Records context switches, blocking on queues and mutex operations into  **/
+/**  a ring buffer, and sends them over the serial line on the 'trce' stream **/
+/**  so that a host tool can draw a timeline of the tasks, e.g. as a Chrome  **/
+/**  or Perfetto trace.                                                      **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of the trace stream ("trce" little endian)
+ */
+#define SER_TRACE_STREAM_ID 0x65637274
+
+/**
+ * The kinds of event in a trace
+ */
+typedef enum trace_event {
+	E_TRACE_TASK_SWITCHED_IN = 1,      // The task started running
+	E_TRACE_TASK_SWITCHED_OUT,         // The task stopped running. arg is 1 if it was preempted, 0 if it blocked
+	E_TRACE_TASK_READY,                // The task became ready to run
+	E_TRACE_BLOCKING_ON_QUEUE_RECEIVE, // The task blocked on the queue, semaphore or mutex numbered arg
+	E_TRACE_BLOCKING_ON_QUEUE_SEND,    // The task blocked sending to the queue numbered arg
+	E_TRACE_MUTEX_TAKE,                // The task took the mutex numbered arg
+	E_TRACE_MUTEX_GIVE,                // The task gave the mutex numbered arg
+	E_TRACE_PRIORITY_INHERIT,          // The task, a mutex holder, inherited the priority arg
+	E_TRACE_PRIORITY_DISINHERIT,       // The task, a mutex holder, went back to the priority arg
+	E_TRACE_MARK                       // trace_mark() was called with arg
+} trace_event_e_t;
+
+/**
+ * An event in a trace, 12 bytes in little endian
+ */
+typedef struct __attribute__((packed)) trace_event_s {
+	uint32_t timestamp;  // Microseconds from the high resolution timer
+	uint16_t task;       // The number of the task, see the task records below
+	uint8_t type;        // A trace_event_e_t
+	uint8_t priority;    // The task's priority at the time of the event
+	uint32_t arg;        // Depends on the type
+} trace_event_s_t;
+
+/**
+ * Starts recording a trace, discarding the previous one.
+ *
+ * Events are kept in a ring buffer, so once it is full each new event replaces
+ * the oldest one. Tasks are identified by a number which is unique to each
+ * task created or restarted, and queues, semaphores and mutexes by the order in
+ * which they were created.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The event count is 0
+ * ENOMEM - The buffer could not be allocated
+ *
+ * \param event_count
+ *        The number of events to keep, rounded down to a power of two. Each
+ *        uses 12 bytes of the kernel heap
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t trace_start(uint32_t event_count);
+
+/**
+ * Stops recording the trace, keeping what was recorded until the next
+ * trace_start().
+ */
+void trace_stop(void);
+
+/**
+ * Records an E_TRACE_MARK event, e.g. to mark the start of an iteration of a
+ * control loop. Does nothing unless a trace is being recorded.
+ *
+ * \param value
+ *        The value to record as the event's arg
+ */
+void trace_mark(uint32_t value);
+
+/**
+ * Stops recording the trace and sends it on the trace stream, blocking until
+ * it has been queued. The stream doesn't need to be activated.
+ *
+ * Every record is a COBS frame on the stream whose first byte is its kind:
+ * - 0: a header of the version (uint8_t, currently 1), the event size
+ *   (uint16_t), the number of events which follow (uint32_t), the number of
+ *   older events which were overwritten (uint32_t) and the number of queues
+ *   created so far (uint32_t)
+ * - 1: a task, made of its priority (uint8_t), its number (uint16_t) and its
+ *   name, which takes up the rest of the record
+ * - 2: events, made of a reserved byte, the number of events (uint16_t) and
+ *   that many trace_event_s_t, oldest first
+ * - 3: the end of the trace
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - No trace has been started
+ * EIO - The trace could not be sent
+ *
+ * \return The number of events sent, or PROS_ERR upon failure
+ */
+int32_t trace_dump(void);
+
+/******************************************************************************/
+/**                       Backtraces and Sampling Profiler                   **/
+/**                                                                          **/
+/**  Unwinds task stacks with the same tables used for data abort reports,   **/
+/**  and samples where the CPU is on every tick into a histogram which is    **/
+/**  sent on the 'prof' stream for a host tool to turn into a profile.       **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of the profile stream ("prof" little endian)
+ */
+#define SER_PROFILE_STREAM_ID 0x666f7270
+
+/**
+ * The most return addresses the profiler records per sample
+ */
+#define PROFILER_MAX_DEPTH 8
+
+/**
+ * Gets the return addresses on a task's stack, innermost first.
+ *
+ * For the calling task, the first address is in the function which called
+ * task_get_backtrace(). For any other task, it is where the task stopped
+ * running. The scheduler is suspended while another task's stack is unwound.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - pcs is NULL, max is 0, or the task has been deleted
+ *
+ * \param task
+ *        The task to unwind, or NULL for the calling task
+ * \param pcs
+ *        Where to store the addresses
+ * \param max
+ *        The number of addresses pcs has room for
+ *
+ * \return The number of addresses stored, or PROS_ERR upon failure
+ */
+int32_t task_get_backtrace(task_t task, uint32_t* pcs, uint32_t max);
+
+/**
+ * Starts sampling, discarding the previous samples.
+ *
+ * Every tick, the address the tick interrupted and, for a depth over 1, the
+ * return addresses leading to it are counted in a bucket along with the
+ * running task. Identical samples share a bucket, so the buckets only run out
+ * if many different places are sampled. Samples which find no bucket are
+ * counted as dropped. Unwinding takes time in the tick interrupt, so a depth of
+ * 1 is the cheapest.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The bucket count is 0, or the depth is 0 or over PROFILER_MAX_DEPTH
+ * ENOMEM - The buckets could not be allocated
+ *
+ * \param bucket_count
+ *        The number of buckets, rounded down to a power of two. Each uses
+ *        8 + 4 * depth bytes of the kernel heap
+ * \param depth
+ *        The number of addresses to record per sample
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t profiler_start(uint32_t bucket_count, uint32_t depth);
+
+/**
+ * Stops sampling, keeping the samples until the next profiler_start().
+ */
+void profiler_stop(void);
+
+/**
+ * Stops sampling and sends the buckets on the profile stream, blocking until
+ * they have been queued. The stream doesn't need to be activated.
+ *
+ * Every record is a COBS frame on the stream whose first byte is its kind:
+ * - 0: a header of the version (uint8_t, currently 1), the depth (uint8_t), a
+ *   reserved byte, the number of buckets which follow (uint32_t), the number
+ *   of samples counted (uint32_t), the number dropped (uint32_t) and the
+ *   sampling period in microseconds (uint32_t)
+ * - 1: a task, made of its priority (uint8_t), its number (uint16_t) and its
+ *   name, which takes up the rest of the record. Only tasks which still exist
+ *   are sent
+ * - 2: buckets, made of a reserved byte, the number of buckets (uint16_t) and
+ *   that many buckets. Each is its sample count (uint32_t), the task number
+ *   (uint32_t) and depth addresses (uint32_t), innermost first and padded
+ *   with 0s
+ * - 3: the end of the profile
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The profiler has never been started
+ * EIO - The profile could not be sent
+ *
+ * \return The number of buckets sent, or PROS_ERR upon failure
+ */
+int32_t profiler_dump(void);
+
+/******************************************************************************/
+/**                          System Daemon Statistics                        **/
+/**                                                                          **/
+/**  The system daemon runs every 2 ms to let VEXos update its device data.  **/
+/**  These functions report how long each phase of that work takes.          **/
+/******************************************************************************/
+
+/**
+ * The number of buckets in each phase's duration histogram.
+ */
+#define SYSTEM_DAEMON_HISTOGRAM_BUCKETS 8
+
+/**
+ * The upper bounds (exclusive) of the histogram buckets in microseconds. The
+ * last bucket counts every duration of at least 1000us.
+ */
+#define SYSTEM_DAEMON_HISTOGRAM_BOUNDS \
+	{ 5, 10, 25, 50, 100, 250, 1000, UINT32_MAX }
+
+/**
+ * The phases of a system daemon cycle, in the order they are run.
+ */
+typedef enum system_daemon_phase_e {
+	E_SYSTEM_DAEMON_PHASE_SERIAL_FLUSH = 0,  // Flushing the serial output buffer
+	E_SYSTEM_DAEMON_PHASE_PORT_TAKE,         // Obtaining exclusive access to the ports
+	E_SYSTEM_DAEMON_PHASE_BACKGROUND,        // vexBackgroundProcessing()
+	E_SYSTEM_DAEMON_PHASE_VDML,              // Validating the device registry
+	E_SYSTEM_DAEMON_PHASE_PORT_GIVE,         // Releasing the ports
+	E_SYSTEM_DAEMON_PHASE_COUNT
+} system_daemon_phase_e_t;
+
+/**
+ * Duration statistics of one system daemon phase.
+ */
+typedef struct system_daemon_phase_stats_s {
+	uint32_t histogram[SYSTEM_DAEMON_HISTOGRAM_BUCKETS];  // Number of cycles per duration bucket
+	uint32_t last_us;                                     // Duration of the last cycle in microseconds
+	uint32_t max_us;                                      // Longest duration in microseconds
+} system_daemon_phase_stats_s_t;
+
+/**
+ * Statistics of the system daemon since startup or the last reset.
+ */
+typedef struct system_daemon_stats_s {
+	system_daemon_phase_stats_s_t phases[E_SYSTEM_DAEMON_PHASE_COUNT];
+	uint32_t cycles;              // Number of daemon cycles run
+	uint32_t missed_deadlines;    // Number of cycles which overran their 2 ms period
+	uint32_t transitions;         // Number of competition mode changes
+	uint32_t last_transition_us;  // Time taken to start the user function's task on the last mode change
+	uint32_t max_transition_us;   // Longest time taken to start the user function's task in microseconds
+	uint32_t last_start_us;       // Time from noticing the last mode change to the user function being called
+	uint32_t max_start_us;        // Longest time from noticing a mode change to the user function in microseconds
+} system_daemon_stats_s_t;
+
+/**
+ * Gets the timing statistics of the system daemon.
+ *
+ * Phase durations are measured with the CPU's cycle counter.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t system_daemon_get_stats(system_daemon_stats_s_t* const stats);
+
+/**
+ * Resets the timing statistics of the system daemon.
+ */
+void system_daemon_reset_stats(void);
+
+/******************************************************************************/
+/**                          Port Access Statistics                          **/
+/**                                                                          **/
+/**  Counts how often each port's mutex is taken, how often a task had to   **/
+/**  wait for it, for another task or for the system daemon, and how long   **/
+/**  it was held. The daemon's exclusive access to every port each cycle is **/
+/**  counted separately. Counting is off until port_stats_enable().         **/
+/******************************************************************************/
+
+/**
+ * Access statistics of one port, or of the daemon's exclusive access.
+ */
+typedef struct port_access_stats_s {
+	uint32_t acquisitions;   // Number of times the port was taken
+	uint32_t contended;      // Number of those which had to wait for another task or the daemon
+	uint64_t total_wait_us;  // Time spent waiting to take the port in microseconds
+	uint32_t max_wait_us;    // Longest wait in microseconds
+	uint32_t max_hold_us;    // Longest time the port was held in microseconds
+} port_access_stats_s_t;
+
+/**
+ * Starts or stops counting port accesses. While counting, taking and giving a
+ * port each read the CPU's cycle counter; otherwise they only check a flag.
+ *
+ * \param enable
+ *        Whether to count port accesses
+ */
+void port_stats_enable(bool enable);
+
+/**
+ * Gets the access statistics of a port.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The port is not a device port. Ports 1-21 are the smart ports, 22 is
+ *         the built-in ADI and the ones above are the battery and controllers
+ * EINVAL - stats is NULL
+ *
+ * \param port
+ *        The port number, starting at 1
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t port_stats_get(uint8_t port, port_access_stats_s_t* const stats);
+
+/**
+ * Gets the access statistics of the system daemon's exclusive access to every
+ * port. A contended acquisition is one which waited for device calls already
+ * in progress to return.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t port_stats_get_daemon(port_access_stats_s_t* const stats);
+
+/**
+ * Resets the access statistics of every port and of the daemon.
+ */
+void port_stats_reset(void);
+
+/******************************************************************************/
+/**                           Competition Handlers                           **/
+/**                                                                          **/
+/**  By default the daemon restarts one task with autonomous(), opcontrol()  **/
+/**  and the rest each time the competition mode changes. A handler          **/
+/**  registered for a mode instead lives in a task of its own, created once  **/
+/**  at the priority asked for, which the daemon only has to notify.         **/
+/******************************************************************************/
+
+/**
+ * The competition modes which can be given a handler.
+ */
+typedef enum competition_mode_e {
+	E_COMPETITION_MODE_OPCONTROL = 0,  // In place of opcontrol()
+	E_COMPETITION_MODE_AUTONOMOUS,     // In place of autonomous()
+	E_COMPETITION_MODE_DISABLED,       // In place of disabled()
+	E_COMPETITION_MODE_INITIALIZE,     // In place of competition_initialize()
+	E_COMPETITION_MODE_COUNT
+} competition_mode_e_t;
+
+/**
+ * Runs handler in a long-lived task each time the robot enters a competition
+ * mode, in place of the user function for that mode.
+ *
+ * The task is created straight away and waits for its mode, so entering the
+ * mode costs a task notification instead of setting up a task. When the mode
+ * ends while the handler is still running, the task is restarted in place and
+ * goes back to waiting, just as the user function would have been stopped.
+ *
+ * Registering a mode again replaces its handler and priority from the next
+ * time the mode is entered. Handlers should be registered from initialize().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The mode is not valid, handler is NULL or the priority is above
+ *          TASK_PRIORITY_MAX - 3, where it would preempt the daemon
+ * ENOMEM - The handler's task could not be allocated
+ *
+ * \param mode
+ *        The competition mode to handle
+ * \param handler
+ *        The function to run
+ * \param param
+ *        The argument handler is called with
+ * \param priority
+ *        The priority of the handler's task
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t competition_handler_register(competition_mode_e_t mode, task_fn_t handler, void* param, uint32_t priority);
+
+/******************************************************************************/
+/**                              Task Watchdog                               **/
+/**                                                                          **/
+/**  A task registers with a deadline and then calls watchdog_kick() at      **/
+/**  least that often. Each cycle the system daemon checks every registered  **/
+/**  task's last kick, and runs the safe-state action once for each missed  **/
+/**  deadline. A task is unregistered when it is deleted or restarted, e.g.  **/
+/**  when the competition mode changes.                                      **/
+/******************************************************************************/
+
+/**
+ * The most tasks which can be registered with the watchdog at once.
+ */
+#define WATCHDOG_MAX_TASKS 8
+
+/**
+ * Called when a registered task misses its deadline.
+ *
+ * \param task
+ *        The task which missed its deadline
+ * \param overdue
+ *        How many milliseconds past its deadline the task is
+ * \param param
+ *        The parameter given to watchdog_set_action()
+ */
+typedef void (*watchdog_action_fn_t)(task_t task, uint32_t overdue, void* param);
+
+/**
+ * Statistics of the watchdog since startup or the last reset.
+ */
+typedef struct watchdog_stats_s {
+	uint32_t misses;                         // Number of deadlines missed
+	uint32_t last_miss_time;                 // millis() when the last deadline was found missed
+	uint32_t last_overdue;                   // How far past its deadline the last task was in milliseconds
+	char last_task_name[TASK_NAME_MAX_LEN];  // The name of the last task to miss its deadline
+} watchdog_stats_s_t;
+
+/**
+ * Registers the calling task with the watchdog, which counts as a kick.
+ *
+ * Registering again changes the task's deadline.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The deadline is 0
+ * ENOSPC - WATCHDOG_MAX_TASKS tasks are already registered
+ *
+ * \param deadline
+ *        The longest time in milliseconds between the task's kicks
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t watchdog_register(uint32_t deadline);
+
+/**
+ * Unregisters the calling task from the watchdog, if it is registered.
+ */
+void watchdog_unregister(void);
+
+/**
+ * Tells the watchdog the calling task is still running. This only stores the
+ * time, so it can be called every iteration of a control loop.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The calling task is not registered
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t watchdog_kick(void);
+
+/**
+ * Sets the safe-state action run when a registered task misses its deadline.
+ *
+ * The action runs in the system daemon task within one cycle (2 ms) of the
+ * deadline, after the ports have been released, so it may use device
+ * functions but must return quickly and must not block. It runs once per
+ * missed deadline; a task which starts kicking again can miss another. For
+ * example, to hold the drive still:
+ *
+ * \code
+ * void brake_drive(task_t task, uint32_t overdue, void* param) {
+ *   motor_group_move_velocity(drive_ports, 4, 0);
+ * }
+ * \endcode
+ *
+ * with the motors' brake modes set to E_MOTOR_BRAKE_BRAKE or
+ * E_MOTOR_BRAKE_HOLD. Misses are recorded in the stats with or without an
+ * action.
+ *
+ * \param action
+ *        The function to call, or NULL to only record misses
+ * \param param
+ *        The parameter passed to the action
+ */
+void watchdog_set_action(watchdog_action_fn_t action, void* param);
+
+/**
+ * Gets the watchdog's statistics.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t watchdog_get_stats(watchdog_stats_s_t* const stats);
+
+/**
+ * Resets the watchdog's statistics.
+ */
+void watchdog_reset_stats(void);
+
+/******************************************************************************/
+/**                           Input Latency Probe                            **/
+/**                                                                          **/
+/**  Measures how long a change on the controller takes to reach a motor.   **/
+/**  The daemon numbers every change in the controllers' inputs it sees. A   **/
+/**  task which reads the controller and then commands a motor from it tags  **/
+/**  the motor with that number, and the probe times the command and the     **/
+/**  daemon cycle which sends it to the motor.                               **/
+/******************************************************************************/
+
+/**
+ * The number of buckets in each latency histogram.
+ */
+#define LATENCY_PROBE_HISTOGRAM_BUCKETS 10
+
+/**
+ * The upper bounds (exclusive) of the latency histogram buckets in
+ * microseconds. The last bucket counts every latency of at least 50 ms.
+ */
+#define LATENCY_PROBE_HISTOGRAM_BOUNDS \
+	{ 500, 1000, 2000, 3000, 5000, 10000, 15000, 25000, 50000, UINT32_MAX }
+
+/**
+ * The number of most recent input changes which can still be tagged.
+ */
+#define LATENCY_PROBE_INPUT_HISTORY 16
+
+/**
+ * The stretches of time the probe measures.
+ */
+typedef enum latency_probe_stage_e {
+	E_LATENCY_PROBE_STAGE_INPUT = 0,  // From the daemon seeing the input change until the motor is commanded
+	E_LATENCY_PROBE_STAGE_OUTPUT,     // From the motor command until the daemon sends it to the motor
+	E_LATENCY_PROBE_STAGE_TOTAL,      // From the daemon seeing the input change until the motor is sent it
+	E_LATENCY_PROBE_STAGE_COUNT
+} latency_probe_stage_e_t;
+
+/**
+ * Latency statistics of one stage.
+ */
+typedef struct latency_probe_stage_stats_s {
+	uint32_t histogram[LATENCY_PROBE_HISTOGRAM_BUCKETS];  // Number of samples per latency bucket
+	uint32_t last_us;                                     // Latency of the last sample in microseconds
+	uint32_t max_us;                                      // Longest latency in microseconds
+	uint64_t total_us;                                    // Sum of every sample's latency, for the mean
+} latency_probe_stage_stats_s_t;
+
+/**
+ * Statistics of the latency probe since it was started.
+ */
+typedef struct latency_probe_stats_s {
+	latency_probe_stage_stats_s_t stages[E_LATENCY_PROBE_STAGE_COUNT];
+	uint32_t samples;   // Number of tagged commands which reached their motor
+	uint32_t expired;   // Number of tags refused because their input was too old
+	uint32_t replaced;  // Number of tags replaced by another before the motor was commanded
+} latency_probe_stats_s_t;
+
+/**
+ * Starts numbering the controllers' input changes, and clears the statistics.
+ */
+void latency_probe_start(void);
+
+/**
+ * Stops the latency probe and drops the tags which haven't been measured yet.
+ * The statistics are kept.
+ */
+void latency_probe_stop(void);
+
+/**
+ * Gets the number of the latest change to either controller's joysticks or
+ * buttons seen by the system daemon. Read it together with the controller,
+ * e.g. with controller_get_state(), to tag the commands derived from that
+ * reading.
+ *
+ * \return The number of the latest input change, or 0 if there hasn't been
+ * one since the probe started
+ */
+uint32_t latency_probe_get_input(void);
+
+/**
+ * Tags the next motor_move(), motor_move_voltage() or motor_move_velocity()
+ * on a port as derived from a controller input change.
+ *
+ * When the command reaches the motor, the time from the input change, from
+ * the command and the total are added to the statistics. Tagging a port again
+ * before it is commanded replaces the earlier tag.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21)
+ * EINVAL - The probe isn't running, or input is 0 or hasn't happened yet
+ * ETIMEDOUT - More than LATENCY_PROBE_INPUT_HISTORY changes have happened
+ * since the input, so its time has been forgotten
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param input
+ *        The input change number from latency_probe_get_input()
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t latency_probe_tag(uint8_t port, uint32_t input);
+
+/**
+ * Gets the latency statistics.
+ *
+ * Times are measured with micros().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ *
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t latency_probe_get_stats(latency_probe_stats_s_t* const stats);
+
+/******************************************************************************/
+/**                           Device Registration                            **/
+/******************************************************************************/
+
+/*
+ * List of possible v5 devices
+ *
+ * This list contains all current V5 Devices, and mirrors V5_DeviceType from the
+ * api.
+ */
+typedef enum v5_device_e {
+	E_DEVICE_NONE = 0,
+	E_DEVICE_MOTOR = 2,
+	E_DEVICE_IMU = 6,
+	E_DEVICE_RADIO = 8,
+	E_DEVICE_VISION = 11,
+	E_DEVICE_ADI = 12,
+	E_DEVICE_GENERIC = 129,
+	E_DEVICE_UNDEFINED = 255
+} v5_device_e_t;
+
+/*
+ * Registers a device in the given port
+ *
+ * Registers a device of the given type in the given port into the registry, if
+ * that type of device is detected to be plugged in to that port.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21), or a
+ * a different device than specified is plugged in.
+ * EADDRINUSE - The port is already registered to another device.
+ *
+ * \param port
+ *        The port number to register the device
+ * \param device
+ *        The type of device to register
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int registry_bind_port(uint8_t port, v5_device_e_t device_type);
+
+/*
+ * Deregisters a devices from the given port
+ *
+ * Removes the device registed in the given port, if there is one.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ *
+ * \param port
+ *        The port number to deregister
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int registry_unbind_port(uint8_t port);
+
+/*
+ * Callback invoked when the device plugged into a port changes
+ *
+ * \param port
+ *        The port number from 1-21
+ * \param old_type
+ *        The type of device that was previously plugged in
+ * \param new_type
+ *        The type of device that is now plugged in, E_DEVICE_NONE if the
+ *        device was unplugged
+ */
+typedef void (*registry_change_fn_t)(uint8_t port, v5_device_e_t old_type, v5_device_e_t new_type);
+
+/*
+ * Sets a callback to be invoked whenever a device is plugged into or unplugged
+ * from a port.
+ *
+ * The callback runs in the system daemon task within 2 ms of the change, so it
+ * must return quickly and must not block (e.g. notify a task rather than doing
+ * the work in the callback).
+ *
+ * \param callback
+ *        The function to call, or NULL to remove the current callback
+ */
+void registry_on_change(registry_change_fn_t callback);
+
+/*
+ * Blocks the calling task until one of the given ports has new data from its
+ * device.
+ *
+ * After every time VEXos updates its device data, the system daemon compares
+ * each device's timestamp with the one it saw before and wakes the tasks
+ * waiting on the ports which changed. A control loop which waits here instead
+ * of calling task_delay() runs straight after its sensors update, rather than
+ * up to a whole update period later. Only updates which arrive after the call
+ * count, so the caller never wakes for data it has already read.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - port_mask is 0 or has bits set for ports which don't exist
+ * EDEADLK - The calling task has a read transaction open, see vdml_read_begin()
+ * ETIMEDOUT - None of the ports had new data before the timeout
+ *
+ * \param port_mask
+ *        A bitmask of the ports to wait on, bit 0 for port 1 through bit 21
+ *        for the built-in ADI
+ * \param timeout
+ *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+ *
+ * \return The bitmask of the waited on ports which have new data, 0 if the
+ * timeout expired first, or PROS_ERR upon failure
+ */
+uint32_t vdml_wait_for_update(uint32_t port_mask, uint32_t timeout);
+
+/*
+ * Creates a binary semaphore which the system daemon posts whenever one of
+ * the given ports has new data from its device, like vdml_wait_for_update()
+ * but without having to call in each time. The semaphore can be waited on
+ * directly, or put in a queue set to wait on device data and queues at once.
+ * A semaphore can only join a set while it hasn't been posted, so it is added
+ * to the set, if one is given, before the daemon starts posting it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - port_mask is 0 or has bits set for ports which don't exist
+ * ENOMEM - There was not enough memory for the semaphore
+ *
+ * \param port_mask
+ *        A bitmask of the ports to watch, bit 0 for port 1 through bit 21
+ *        for the built-in ADI
+ * \param set
+ *        The queue set to add the semaphore to, or NULL for none
+ *
+ * \return The semaphore, or NULL upon failure
+ */
+sem_t vdml_update_sem_create(uint32_t port_mask, queue_set_t set);
+
+/*
+ * Stops the system daemon from posting a semaphore from
+ * vdml_update_sem_create(), takes it out of its queue set and deletes it. If
+ * it was posted since the set last returned it, the set may return the
+ * deleted handle once more, which must then be ignored.
+ *
+ * \param sem
+ *        The semaphore to delete
+ * \param set
+ *        The queue set the semaphore was added to, or NULL for none
+ */
+void vdml_update_sem_delete(sem_t sem, queue_set_t set);
+
+/*
+ * Gets the time at which the system daemon first saw the current data of the
+ * device on a port, i.e. the cycle in which VEXos received it.
+ *
+ * Devices update at different rates and out of step with each other, so this
+ * gives fusion code the age of each reading. The same time is in the
+ * updated_us field of the motor, Inertial Sensor and Vision Sensor snapshots.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-22)
+ *
+ * \param port
+ *        The V5 port number from 1-21, or 22 for the built-in ADI
+ *
+ * \return The micros() time of the update, 0 if the port hasn't had data yet,
+ * or PROS_ERR upon failure
+ */
+uint32_t vdml_get_last_update(uint8_t port);
+
+/*
+ * Starts a read transaction, so that every device read until vdml_read_end()
+ * gives data from the same update of VEXos's device data.
+ *
+ * Separate reads can otherwise straddle an update, e.g. an IMU heading from
+ * one cycle and motor positions from the next. The transaction holds off the
+ * system daemon's next cycle instead, so the usual getters of every device
+ * (motors, IMUs, ADI and the rest) all read one cycle's data. If the daemon is
+ * in the middle of a cycle, this waits for it to finish.
+ *
+ * The daemon runs every 2 ms and waits for the transaction, so it must be kept
+ * to a few reads: no delays, no waiting on other tasks and no device writes
+ * which wait for the daemon. vdml_wait_for_update() fails with EDEADLK while
+ * the transaction is open. Transactions don't nest.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - port_mask is 0 or has bits set for ports which don't exist
+ * EDEADLK - The calling task already has a transaction open
+ * ENODEV - One of the ports has no device plugged in (and isn't being
+ * replayed), in which case no transaction is started
+ *
+ * \param port_mask
+ *        A bitmask of the ports to be read, bit 0 for port 1 through bit 21
+ *        for the built-in ADI
+ *
+ * \return 1 if the transaction was started or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t vdml_read_begin(uint32_t port_mask);
+
+/*
+ * Ends the calling task's read transaction, letting the system daemon run its
+ * next cycle.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EPERM - The calling task has no transaction open
+ *
+ * \return 1 if the transaction was ended or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t vdml_read_end(void);
+
+/******************************************************************************/
+/**                              Device Drivers                              **/
+/**                                                                          **/
+/**  A driver registered for a type of device is bound to every port that   **/
+/**  type is plugged into, and polled by the system daemon each cycle right  **/
+/**  after VEXos updates its device data. The daemon keeps a snapshot for   **/
+/**  each bound port, which the driver fills and any task can then read     **/
+/**  with device_driver_get_snapshot() without claiming the port.           **/
+/******************************************************************************/
+
+/**
+ * The most drivers which can be registered at once.
+ */
+#define DEVICE_DRIVER_MAX 4
+
+/**
+ * The callbacks of a device driver.
+ *
+ * Each runs in the system daemon with the scheduler suspended and every port
+ * held, so it must return quickly and must not block. The device functions
+ * don't wait for their ports while the scheduler is suspended, so they may be
+ * called on the bound port. Any callback may be NULL.
+ */
+typedef struct device_driver_s {
+	size_t snapshot_size;  // The bytes of snapshot kept for each bound port, 0 for none
+	// Called once the device is plugged into a port, with the port's zeroed snapshot
+	void (*on_bind)(uint8_t port, void* snapshot);
+	// Called every cycle the device is plugged in, to update the port's snapshot
+	void (*on_poll_cycle)(uint8_t port, void* snapshot);
+	// Called once the device is unplugged from a port, or another type plugged in
+	void (*on_unbind)(uint8_t port);
+} device_driver_s_t;
+
+/**
+ * Registers a driver for a type of device. The driver is first bound to the
+ * ports with the device plugged in on the daemon's next cycle.
+ *
+ * Drivers stay registered until the program ends. A type already handled by
+ * the kernel, such as E_DEVICE_MOTOR, can have a driver too, which runs after
+ * the kernel's own snapshot of the device.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - driver is NULL, or the type is E_DEVICE_NONE or E_DEVICE_UNDEFINED
+ * EEXIST - The type already has a driver
+ * ENOSPC - DEVICE_DRIVER_MAX drivers are already registered
+ * ENOMEM - The snapshots could not be allocated
+ *
+ * \param type
+ *        The type of device to drive
+ * \param driver
+ *        The driver's callbacks, which are copied
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t device_driver_register(v5_device_e_t type, const device_driver_s_t* driver);
+
+/**
+ * Copies the latest snapshot of a port bound to a driver.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21)
+ * ENODEV - The port isn't bound to a driver
+ * EINVAL - dest is NULL or size is larger than the driver's snapshot_size
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] dest
+ *             Where to copy the snapshot to
+ * \param size
+ *        The number of bytes to copy
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t device_driver_get_snapshot(uint8_t port, void* dest, size_t size);
+
+/******************************************************************************/
+/**                        Device Recording and Replay                       **/
+/**                                                                          **/
+/**  The system daemon can send every new reading from selected devices to   **/
+/**  the host, and later serve a recording back through the device getters   **/
+/**  in place of the devices themselves, so the same user code can be run    **/
+/**  on exactly the same inputs to compare its timing and behaviour.         **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of the device recording stream ("vrec" little endian)
+ *
+ * Each frame on the stream holds the readings which changed in one daemon
+ * cycle: the uint32_t number of daemon cycles since vdml_record_start() and
+ * the uint32_t millis() of the cycle, followed by an entry for each device.
+ * An entry is the uint8_t port number from 1-22 (22 for the built-in ADI), the
+ * uint8_t v5_device_e_t of the device, a uint16_t length and that many bytes
+ * of readings: a motor_snapshot_s_t for a motor, an imu_state_s_t for an
+ * Inertial Sensor, and the int32_t raw values of the 8 ports for the built-in
+ * ADI.
+ */
+#define VDML_RECORD_STREAM_ID 0x63657276
+
+/**
+ * The most bytes a recorded frame holds. Entries which would make a frame
+ * longer are left out and counted as dropped.
+ */
+#define VDML_RECORD_FRAME_SIZE 1024
+
+/**
+ * Starts sending the readings of the given devices on the "vrec" stream.
+ *
+ * After every time VEXos updates its device data, the system daemon records
+ * the readings of each selected device which sent new data. Only motors,
+ * Inertial Sensors and the built-in ADI are recorded. Frames are queued by the
+ * daemon and sent by a background task, so they are dropped rather than
+ * delaying the daemon if the serial line can't keep up. Calling this function
+ * again restarts the recording with the new selection.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - port_mask is 0 or has bits set for ports which don't exist
+ * ENOMEM - There was not enough memory to queue frames
+ *
+ * \param port_mask
+ *        A bitmask of the ports to record, bit 0 for port 1 through bit 21
+ *        for the built-in ADI
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t vdml_record_start(uint32_t port_mask);
+
+/**
+ * Stops recording device readings.
+ */
+void vdml_record_stop(void);
+
+/**
+ * Gets the number of frames and entries dropped since the recording started.
+ *
+ * \return The number dropped
+ */
+uint32_t vdml_record_get_dropped(void);
+
+/**
+ * Starts serving a recording back through the device getters.
+ *
+ * The recording is the frames from the "vrec" stream, each preceded by its
+ * uint32_t length, as the host saves them. Frames are applied by the system
+ * daemon whenever it reaches the cycle they were recorded in, counting from
+ * the first cycle after this call. From the first frame which holds a port's
+ * device, until vdml_replay_stop(), that port is replayed: the motor_get_*
+ * telemetry getters, motor_get_snapshot(), the imu_get_* readings and
+ * imu_get_state() give the recorded values without touching the port, ADI
+ * reads give the recorded port values, and vdml_wait_for_update() and the
+ * semaphores from vdml_update_sem_create() follow the recorded updates. Ports
+ * keep their last recorded values once the recording runs out.
+ *
+ * The recording isn't copied, so it must stay valid until replay is stopped,
+ * e.g. a file loaded with usd_load_file().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The recording is NULL or isn't made of whole frames
+ * ENOMEM - There was not enough memory for the replayed readings
+ *
+ * \param recording
+ *        The recorded frames
+ * \param len
+ *        The length of the recording in bytes
+ *
+ * \return The number of frames in the recording, or PROS_ERR upon failure
+ */
+int32_t vdml_replay_start(const void* recording, size_t len);
+
+/**
+ * Stops replaying, so every port is read from its device again.
+ */
+void vdml_replay_stop(void);
+
+/**
+ * Gets the number of frames of the recording the daemon hasn't applied yet.
+ *
+ * \return The number of frames left, 0 once the recording has run out or if
+ * nothing is being replayed
+ */
+uint32_t vdml_replay_get_remaining(void);
+
+/******************************************************************************/
+/**                               Filesystem                                 **/
+/******************************************************************************/
+/**
+ * Control settings of the serial driver.
+ *
+ * \param action
+ * 			An action to perform on the serial driver. See the SERCTL_* macros for
+ * 			details on the different actions.
+ * \param extra_arg
+ * 			An argument to pass in based on the action
+ */
+int32_t serctl(const uint32_t action, void* const extra_arg);
+
+/**
+ * Control settings of the microSD card driver.
+ *
+ * \param action
+ * 			An action to perform on the microSD card driver. See the USDCTL_* macros
+ *      for details on the different actions.
+ * \param extra_arg
+ * 		   	An argument to pass in based on the action
+ */
+// Not yet implemented
+// int32_t usdctl(const uint32_t action, void* const extra_arg);
+
+/**
+ * Control settings of the way the file's driver treats the file
+ *
+ * \param file
+ * 			A valid file descriptor number
+ * \param action
+ * 			An action to perform on the file's driver. See the *CTL_* macros for
+ * 			details on the different actions. Note that the action passed in must
+ *      match the correct driver (e.g. don't perform a SERCTL_* action on a
+ *      microSD card file)
+ * \param extra_arg
+ * 		  	An argument to pass in based on the action
+ */
+int32_t fdctl(int file, const uint32_t action, void* const extra_arg);
+
+/**
+ * Event flags for vfs_poll
+ */
+#define VFS_POLLIN 0x01    // the file has data to read
+#define VFS_POLLOUT 0x04   // the file can be written without waiting
+#define VFS_POLLNVAL 0x20  // the file descriptor isn't open. Only set in revents
+
+/**
+ * A file for vfs_poll to wait on
+ */
+typedef struct vfs_pollfd {
+	int fd;           // the file descriptor number
+	int16_t events;   // the VFS_POLL* events to wait for
+	int16_t revents;  // set by vfs_poll to the events which are ready
+} vfs_pollfd_s_t;
+
+/**
+ * Waits until at least one of several files is ready to be read or written.
+ *
+ * The files can be any mix of serial streams (such as stdin), smart ports
+ * opened with /dev, and microSD card files. The calling task blocks on its task
+ * notification until a driver reports new data or free space, so nothing is
+ * polled in the meantime. Because of this, a task using its notification for
+ * something else may return from vfs_poll early with nothing ready.
+ *
+ * stdin is readable once a byte has been received, /dev ports are readable
+ * once the system daemon has received data and writable while there is room in
+ * the port's write queue, and microSD card files are readable whenever they are
+ * opened for reading and writable while the write-behind buffer has room.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - fds is NULL
+ * EBUSY - Too many tasks are already waiting in vfs_poll
+ *
+ * \param fds
+ *        The files to wait on. Each file's revents is set to its ready events
+ * \param count
+ *        The number of files
+ * \param timeout
+ *        How long to wait, in milliseconds. 0 checks the files without
+ *        waiting, and TIMEOUT_MAX waits forever
+ *
+ * \return The number of files with any revents set, 0 if the timeout elapsed
+ * first, or PROS_ERR if the operation failed, setting errno.
+ */
+int32_t vfs_poll(vfs_pollfd_s_t* fds, size_t count, uint32_t timeout);
+
+/**
+ * Action macro to pass into serctl or fdctl that activates the stream
+ * identifier.
+ *
+ * When used with serctl, the extra argument must be the little endian
+ * representation of the stream identifier (e.g. "sout" -> 0x74756f73)
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_ACTIVATE 10
+
+/**
+ * Action macro to pass into serctl or fdctl that deactivates the stream
+ * identifier.
+ *
+ * When used with serctl, the extra argument must be the little endian
+ * representation of the stream identifier (e.g. "sout" -> 0x74756f73)
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_DEACTIVATE 11
+
+/**
+ * Action macro to pass into fdctl that enables blocking writes for the file
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_BLKWRITE 12
+
+/**
+ * Action macro to pass into fdctl that makes writes non-blocking for the file
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_NOBLKWRITE 13
+
+/**
+ * Action macro to pass into serctl that enables advanced stream multiplexing
+ * capabilities
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_ENABLE_COBS 14
+
+/**
+ * Action macro to pass into serctl that disables advanced stream multiplexing
+ * capabilities
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ *
+ * Visit https://pros.cs.purdue.edu/v5/tutorials/topical/filesystem.html#serial
+ * to learn more.
+ */
+#define SERCTL_DISABLE_COBS 15
+
+/**
+ * Action macro to check if there is data available from the Generic Serial
+ * Device
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ */
+#define DEVCTL_FIONREAD 16
+
+/**
+ * Action macro to check if there is space available in the Generic Serial
+ * Device's output buffer
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ */
+#define DEVCTL_FIONWRITE 18
+
+/**
+ * Action macro to set the Generic Serial Device's baudrate.
+ *
+ * The extra argument is the baudrate.
+ */
+#define DEVCTL_SET_BAUDRATE 17
+
+/**
+ * Output statistics of a serial stream, see SERCTL_GET_STREAM_STATS
+ */
+typedef struct ser_stream_stats_s {
+	uint32_t stream_id;  // The stream identifier, e.g. 0x74756f73 for "sout"
+	uint32_t sent;       // The number of bytes queued for output
+	uint32_t dropped;    // The number of bytes dropped because the output buffer was full
+} ser_stream_stats_s_t;
+
+/**
+ * Action macro to pass into serctl that gets the output statistics of a stream.
+ *
+ * The extra argument is a pointer to a ser_stream_stats_s_t whose stream_id is
+ * set to the stream to query. The other fields are filled in, and are 0 for
+ * streams that have not been written to.
+ */
+#define SERCTL_GET_STREAM_STATS 19
+
+/**
+ * Output priority classes of serial streams. Queued output of a higher class
+ * is always sent before output of a lower class. Priorities only take effect
+ * while COBS is enabled.
+ */
+typedef enum ser_priority_e {
+	E_SER_PRIORITY_HIGH = 0,  // Default for serr
+	E_SER_PRIORITY_NORMAL,    // Default for every other stream
+	E_SER_PRIORITY_LOW,
+	E_SER_PRIORITY_COUNT
+} ser_priority_e_t;
+
+/**
+ * Output configuration of a serial stream, see SERCTL_CONFIGURE_STREAM
+ */
+typedef struct ser_stream_config_s {
+	uint32_t stream_id;         // The stream identifier, e.g. 0x74756f73 for "sout"
+	ser_priority_e_t priority;  // The stream's priority class
+	uint32_t rate;              // The maximum sustained rate in bytes per second, 0 for no limit
+	uint32_t burst;             // The most bytes which may be sent at once, at least the largest write
+} ser_stream_config_s_t;
+
+/**
+ * Action macro to pass into serctl that sets the priority class and rate limit
+ * of a stream.
+ *
+ * The extra argument is a pointer to a ser_stream_config_s_t. Writes which
+ * exceed the stream's rate limit are dropped and counted in its statistics.
+ */
+#define SERCTL_CONFIGURE_STREAM 20
+
+/**
+ * Action macro to pass into fdctl that writes everything buffered for a
+ * microSD card file to the card.
+ *
+ * Writes to microSD card files are buffered and written out by a background
+ * task, so data isn't guaranteed to be on the card until this returns or the
+ * file is closed. This blocks until the card is done.
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ */
+#define USDCTL_SYNC 21
+
+/**
+ * Action macro to pass into serctl that turns on capture mode, for pushing as
+ * much data as possible over a USB tether.
+ *
+ * Queued output is normally handed to VEXos once every system daemon cycle
+ * (2 ms). In capture mode a flush task also hands it over as soon as it is
+ * written and then every millisecond for as long as VEXos can't take all of
+ * it, so the output buffer is kept from filling up between daemon cycles. The
+ * flush task runs at TASK_PRIORITY_DEFAULT + 1. Pair this with a larger output
+ * buffer, see PROS_SER_BUFFER_SIZES().
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ */
+#define SERCTL_ENABLE_CAPTURE 22
+
+/**
+ * Action macro to pass into serctl that turns off capture mode, leaving output
+ * to the system daemon.
+ *
+ * The extra argument is not used with this action, provide any value (e.g.
+ * NULL) instead
+ */
+#define SERCTL_DISABLE_CAPTURE 23
+
+/******************************************************************************/
+/**                            Serial Telemetry                              **/
+/**                                                                          **/
+/**  Binary records sent over the serial line on the 'tlm' stream, framed    **/
+/**  with COBS like every other stream. The stream must be activated with    **/
+/**  serctl(SERCTL_ACTIVATE, SER_TLM_STREAM_ID) before records are sent.      **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of the telemetry stream ("tlm" little endian)
+ */
+#define SER_TLM_STREAM_ID 0x006d6c74
+
+/**
+ * The record ID reserved for record descriptors, see ser_tlm_describe()
+ */
+#define SER_TLM_DESCRIPTOR_ID 0
+
+/**
+ * Describes the layout of a telemetry record so that the host can decode it.
+ *
+ * The format uses Python struct module syntax without the byte order
+ * character (records are always little endian), e.g. "Iffh". Use
+ * SER_TLM_RECORD() to declare a descriptor for a packed struct.
+ */
+typedef struct ser_tlm_descriptor_s {
+	uint16_t id;         // The record ID, must not be SER_TLM_DESCRIPTOR_ID or SER_TLM_CLOCK_ID
+	uint16_t size;       // The size of the record in bytes
+	const char* name;    // The name of the record
+	const char* format;  // The layout of the record
+} ser_tlm_descriptor_s_t;
+
+/**
+ * Declares a ser_tlm_descriptor_s_t named <type>_tlm for a record type.
+ *
+ * The record type should be declared with __attribute__((packed)) so that its
+ * layout matches the format.
+ *
+ * \param type
+ *        The struct type of the record
+ * \param record_id
+ *        The record ID, from 1-65534
+ * \param fmt
+ *        The layout of the record, see ser_tlm_descriptor_s_t
+ */
+#define SER_TLM_RECORD(type, record_id, fmt) \
+	static const ser_tlm_descriptor_s_t type##_tlm = {.id = (record_id), .size = sizeof(type), .name = #type, .format = (fmt)}
+
+/**
+ * Sends a record descriptor on the telemetry stream.
+ *
+ * It is sent as a record with the ID SER_TLM_DESCRIPTOR_ID, whose payload is
+ * the record's ID and size (both uint16_t) followed by its null-terminated
+ * name and format. Send the descriptors of every record once the stream is
+ * activated, or whenever the host asks for them.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The descriptor is NULL or uses the record ID SER_TLM_DESCRIPTOR_ID or
+ * SER_TLM_CLOCK_ID
+ * EIO - The descriptor could not be sent
+ *
+ * \param descriptor
+ *        The descriptor to send
+ *
+ * \return 1 upon success, 0 if the stream isn't activated or PROS_ERR upon
+ * failure
+ */
+int32_t ser_tlm_describe(const ser_tlm_descriptor_s_t* const descriptor);
+
+/**
+ * Sends a record on the telemetry stream.
+ *
+ * The record is sent as its ID (uint16_t) followed by its bytes. This neither
+ * formats the data nor goes through newlib, so it is much cheaper than
+ * printing the same values.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - data is NULL or the record ID is SER_TLM_CLOCK_ID
+ * EIO - The record could not be sent
+ *
+ * \param record_id
+ *        The record's ID
+ * \param data
+ *        The record's data
+ * \param size
+ *        The size of the record in bytes
+ *
+ * \return 1 upon success, 0 if the stream isn't activated or PROS_ERR upon
+ * failure
+ */
+int32_t ser_tlm_write(const uint16_t record_id, const void* const data, const size_t size);
+
+/**
+ * The stream identifier of compressed telemetry records ("tlmz" little
+ * endian). Records whose ID has compression turned on with
+ * ser_tlm_set_compression() are sent on this stream instead of the 'tlm'
+ * stream, while the 'tlm' stream is activated. Each is sent as its ID
+ * (uint16_t), its encoding (uint8_t, a ser_tlm_compression_e_t) and its
+ * payload:
+ *
+ * E_SER_TLM_COMPRESS_NONE - The record's bytes, as on the 'tlm' stream
+ * E_SER_TLM_COMPRESS_DELTA - For each little endian 32-bit word of the record
+ *   (the last zero extended), the zig-zag LEB128 varint of the difference
+ *   between it and the same word of the last record sent with this ID
+ * E_SER_TLM_COMPRESS_LZ4 - The record's bytes as an LZ4 block
+ *
+ * A record is sent uncompressed whenever compressing it wouldn't save anything.
+ * Delta records only follow a record of the same size sent without errors, and
+ * every SER_TLM_KEYFRAME_INTERVAL-th record is sent uncompressed so the host
+ * can pick up the stream part way through.
+ */
+#define SER_TLM_Z_STREAM_ID 0x7a6d6c74
+
+/**
+ * How telemetry records of an ID are compressed, see SER_TLM_Z_STREAM_ID
+ */
+typedef enum ser_tlm_compression_e {
+	E_SER_TLM_COMPRESS_NONE = 0,
+	E_SER_TLM_COMPRESS_DELTA,  // For records sent over and over, up to SER_TLM_DELTA_MAX_SIZE bytes
+	E_SER_TLM_COMPRESS_LZ4     // For bulk data, up to SER_TLM_LZ4_MAX_SIZE bytes
+} ser_tlm_compression_e_t;
+
+/**
+ * The most record IDs which may be compressed at once
+ */
+#define SER_TLM_COMPRESS_MAX_RECORDS 8
+
+/**
+ * The largest record which is delta encoded. Larger ones are sent uncompressed.
+ */
+#define SER_TLM_DELTA_MAX_SIZE 256
+
+/**
+ * The largest record which is LZ4 compressed. Larger ones are sent
+ * uncompressed.
+ */
+#define SER_TLM_LZ4_MAX_SIZE 4096
+
+/**
+ * The number of delta encoded records between uncompressed ones
+ */
+#define SER_TLM_KEYFRAME_INTERVAL 50
+
+/**
+ * Sets how the telemetry records of an ID are compressed. Compressing costs a
+ * pass over each record and a lock per write, which is worth it where the
+ * serial line is slow, like over the VEXnet radio.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The record ID is SER_TLM_DESCRIPTOR_ID or the mode is out of range
+ * ENOMEM - SER_TLM_COMPRESS_MAX_RECORDS IDs are already compressed
+ *
+ * \param record_id
+ *        The record ID
+ * \param mode
+ *        How its records are compressed, E_SER_TLM_COMPRESS_NONE to send them
+ *        on the 'tlm' stream again
+ *
+ * \return 1 upon success or PROS_ERR upon failure
+ */
+int32_t ser_tlm_set_compression(const uint16_t record_id, const ser_tlm_compression_e_t mode);
+
+/**
+ * Loads a whole file from the microSD card into memory.
+ *
+ * The file is read in large chunks into a single allocation, which is much
+ * faster than reading it through stdio. Use this for constant data like
+ * lookup tables or paths.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - path is NULL
+ * ENOENT - The file could not be opened
+ * ENOMEM - There isn't enough memory for the file
+ * EIO - The file could not be read
+ *
+ * \param path
+ *        The path of the file, e.g. "/usd/path.bin"
+ * \param[out] size
+ *        Set to the size of the file in bytes, may be NULL
+ *
+ * \return The contents of the file upon success, NULL upon failure. Release
+ * them with usd_unload_file()
+ */
+const void* usd_load_file(const char* path, size_t* const size);
+
+/**
+ * Releases the contents of a file loaded with usd_load_file().
+ *
+ * \param data
+ *        The file's contents
+ */
+void usd_unload_file(const void* data);
+
+/******************************************************************************/
+/**                             Deferred Logging                             **/
+/**                                                                          **/
+/**  Messages logged as the address of their format string, a timestamp and  **/
+/**  the raw arguments instead of formatted text, so logging skips newlib's  **/
+/**  printf, its locks and its allocations. The format strings are kept in   **/
+/**  the .plog_fmt section, from which the host reconstructs the text using  **/
+/**  the program's ELF. Records are queued without locking and sent in       **/
+/**  batches on the 'plog' stream by a background task.                      **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of the deferred logging stream ("plog" little
+ * endian). It is activated by default.
+ *
+ * Each frame on the stream holds one or more records, each made of the
+ * uint32_t address of its format string, the low 32 bits of micros() when it
+ * was logged, a uint8_t length and that many bytes of arguments. Integer
+ * arguments take 4 bytes, or 8 with the ll or j length modifiers, floating
+ * point arguments take 8 bytes as doubles and strings are copied with their
+ * null terminator. Arguments which don't fit in PLOG_ARGS_SIZE bytes are left
+ * out and strings are cut short. A record with the address 0 holds the
+ * uint32_t number of records dropped since the last one.
+ */
+#define PLOG_STREAM_ID 0x676f6c70
+
+/**
+ * The most bytes of arguments a record holds
+ */
+#define PLOG_ARGS_SIZE 48
+
+/**
+ * Logs a message without formatting it.
+ *
+ * Takes the same format strings and arguments as printf(), except that %n
+ * isn't supported. The format must be a string literal, which is kept in the
+ * .plog_fmt section. This doesn't lock or allocate anything, so it may be
+ * called from any task or from an interrupt.
+ *
+ * \param fmt
+ *        The format string literal
+ *
+ * \return True if the message was queued, false if the queue was full and it
+ * was dropped
+ */
+#define plog(fmt, ...)                                                         \
+	({                                                                           \
+		static const char _plog_fmt[] __attribute__((section(".plog_fmt"))) = fmt; \
+		plog_write(_plog_fmt, ##__VA_ARGS__);                                      \
+	})
+
+/**
+ * Queues a message for deferred logging. Use plog() instead, this must only be
+ * given format strings in the .plog_fmt section.
+ *
+ * \param fmt
+ *        The format string, in the .plog_fmt section
+ *
+ * \return True if the message was queued, false if the queue was full and it
+ * was dropped
+ */
+bool plog_write(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * Gets the number of messages dropped because the queue was full since the
+ * program started.
+ *
+ * \return The number of dropped messages
+ */
+uint32_t plog_get_dropped(void);
+
+/******************************************************************************/
+/**                                Kernel Log                                **/
+/**                                                                          **/
+/**  The kernel's own messages (kprintf() and the like) are queued the same  **/
+/**  way as plog() records, with their level and subsystem, and a low        **/
+/**  priority task formats them onto kdbg. Messages below a subsystem's      **/
+/**  level are dropped before they're queued.                                **/
+/******************************************************************************/
+
+/**
+ * Kernel log message levels, least severe first
+ */
+typedef enum klog_level_e {
+	E_KLOG_DEBUG = 0,
+	E_KLOG_INFO,
+	E_KLOG_WARNING,
+	E_KLOG_ERROR,
+	E_KLOG_NONE  // as a level filter, drops every message
+} klog_level_e_t;
+
+/**
+ * The parts of the kernel which log messages
+ */
+typedef enum klog_subsystem_e {
+	E_KLOG_KERNEL = 0,
+	E_KLOG_BOOT,
+	E_KLOG_VFS,
+	E_KLOG_VDML,
+	E_KLOG_SUBSYSTEMS
+} klog_subsystem_e_t;
+
+/**
+ * Sets the least severe level of message a subsystem logs. Every subsystem
+ * starts at E_KLOG_INFO.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The subsystem or level is out of range
+ *
+ * \param subsystem
+ *        The subsystem, or E_KLOG_SUBSYSTEMS for all of them
+ * \param level
+ *        The least severe level logged
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t klog_set_level(klog_subsystem_e_t subsystem, klog_level_e_t level);
+
+/**
+ * Gets the least severe level of message a subsystem logs.
+ *
+ * \param subsystem
+ *        The subsystem
+ *
+ * \return The subsystem's level, or E_KLOG_NONE if it is out of range
+ */
+klog_level_e_t klog_get_level(klog_subsystem_e_t subsystem);
+
+/**
+ * Gets the number of kernel messages dropped because the queue was full since
+ * the program started.
+ *
+ * \return The number of dropped messages
+ */
+uint32_t klog_get_dropped(void);
+
+/******************************************************************************/
+/**                             microSD logging                              **/
+/**                                                                          **/
+/**  Fixed size binary records logged to a file on the microSD card without  **/
+/**  waiting on the card. A log file starts with a header (the 'PLOG' magic, **/
+/**  a uint16_t version and record size, the uint32_t millis() and uint64_t  **/
+/**  microsecond time it was opened at, and the schema's null-terminated     **/
+/**  name and format). Each record follows as its uint32_t microsecond       **/
+/**  timestamp and the record's bytes.                                       **/
+/******************************************************************************/
+
+/**
+ * Describes the records of a log so that they can be decoded later.
+ *
+ * The format uses Python struct module syntax without the byte order character
+ * (records are always little endian), like ser_tlm_descriptor_s_t.
+ */
+typedef struct usd_log_schema_s {
+	uint32_t record_size;  // The size of a record in bytes
+	const char* name;      // The name of the record
+	const char* format;    // The layout of the record
+} usd_log_schema_s_t;
+
+typedef struct usd_log* usd_log_t;
+
+/**
+ * Creates a log file on the microSD card, replacing any existing file.
+ *
+ * Two 16 KB buffers are allocated for the log, so a log of 64 byte records at
+ * 1 kHz is written out about every quarter of a second.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A parameter is NULL or the record size is 0 or too large
+ * ENOMEM - The buffers could not be allocated
+ * ENFILE - Too many logs are open
+ * EIO - The file could not be created
+ *
+ * \param path
+ *        The path of the file, e.g. "/usd/run.bin"
+ * \param schema
+ *        The layout of the records, which is written to the file's header
+ *
+ * \return The log upon success, NULL upon failure
+ */
+usd_log_t usd_log_open(const char* path, const usd_log_schema_s_t* const schema);
+
+/**
+ * Adds a record to a log.
+ *
+ * This only copies the record into a buffer and is safe to call from
+ * real-time tasks. If the card falls so far behind that both buffers are full,
+ * the record is dropped.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - log or record is NULL
+ *
+ * \param log
+ *        The log
+ * \param record
+ *        The record, which is schema->record_size bytes long
+ *
+ * \return 1 upon success, 0 if the record was dropped or PROS_ERR upon failure
+ */
+int32_t usd_log_write(usd_log_t log, const void* const record);
+
+/**
+ * Gets the number of records which were dropped because the card fell behind.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - log is NULL
+ *
+ * \param log
+ *        The log
+ *
+ * \return The number of dropped records, or PROS_ERR upon failure
+ */
+uint32_t usd_log_get_dropped(usd_log_t log);
+
+/**
+ * Writes out every buffered record and closes a log.
+ *
+ * This blocks until the card is done.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - log is NULL
+ *
+ * \param log
+ *        The log
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t usd_log_close(usd_log_t log);
+
+/******************************************************************************/
+/**                            Serial parameters                             **/
+/**                                                                          **/
+/**  Named variables which the host can read and write while the program is  **/
+/**  running, e.g. to tune controller gains without re-uploading. The host    **/
+/**  sends "pRv", a length byte and a request of that length:                 **/
+/**    'l'                   list every parameter                             **/
+/**    'r' <index>           read a parameter                                 **/
+/**    'w' <index> <value>   stage a new value (4 bytes, little endian)       **/
+/**  Each response is a frame on the 'parm' stream made of the request op,    **/
+/**  the parameter index, a ser_param_status_e_t and the parameter's type,    **/
+/**  followed by its value ('r' and 'w') or its name ('l'). Listing ends with **/
+/**  a frame with the E_SER_PARAM_END status.                                 **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of parameter responses ("parm" little endian)
+ */
+#define SER_PARAM_STREAM_ID 0x6d726170
+
+/**
+ * The maximum number of parameters which can be registered
+ */
+#define SER_PARAM_MAX_COUNT 32
+
+/**
+ * The maximum length of a parameter's name, excluding the null terminator
+ */
+#define SER_PARAM_NAME_LENGTH 24
+
+typedef enum ser_param_type_e { E_SER_PARAM_INT32 = 0, E_SER_PARAM_FLOAT } ser_param_type_e_t;
+
+typedef enum ser_param_status_e {
+	E_SER_PARAM_OK = 0,
+	E_SER_PARAM_BAD_INDEX,    // No parameter has the requested index
+	E_SER_PARAM_BAD_REQUEST,  // The request is malformed
+	E_SER_PARAM_END           // Listing is complete
+} ser_param_status_e_t;
+
+/**
+ * Registers an int32_t variable as a parameter.
+ *
+ * Values written by the host are staged and only copied into the variable by
+ * ser_param_apply(), so the variable never changes in the middle of a control
+ * loop iteration.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name or var is NULL, or name is longer than SER_PARAM_NAME_LENGTH
+ * EEXIST - A parameter with the same name is already registered
+ * ENOMEM - SER_PARAM_MAX_COUNT parameters are already registered
+ *
+ * \param name
+ *        The parameter's name. It is not copied so it must stay valid
+ * \param var
+ *        The variable
+ *
+ * \return The parameter's index upon success, PROS_ERR upon failure
+ */
+int32_t ser_param_register_int32(const char* const name, int32_t* const var);
+
+/**
+ * Registers a float variable as a parameter.
+ *
+ * Values written by the host are staged and only copied into the variable by
+ * ser_param_apply(), so the variable never changes in the middle of a control
+ * loop iteration.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name or var is NULL, or name is longer than SER_PARAM_NAME_LENGTH
+ * EEXIST - A parameter with the same name is already registered
+ * ENOMEM - SER_PARAM_MAX_COUNT parameters are already registered
+ *
+ * \param name
+ *        The parameter's name. It is not copied so it must stay valid
+ * \param var
+ *        The variable
+ *
+ * \return The parameter's index upon success, PROS_ERR upon failure
+ */
+int32_t ser_param_register_float(const char* const name, float* const var);
+
+/**
+ * Copies every value staged by the host into its variable at once.
+ *
+ * Call this at the start of each control loop iteration, from the task which
+ * uses the parameters.
+ *
+ * \return The number of parameters which were updated
+ */
+int32_t ser_param_apply(void);
+
+/******************************************************************************/
+/**                                 Metrics                                  **/
+/**                                                                          **/
+/**  Named counters, gauges and histograms which can be updated from any     **/
+/**  task or interrupt without a lock, and which the host reads all at once  **/
+/**  in one format. The host sends "pRm", a length byte and a request:       **/
+/**    'l'                list every metric                                  **/
+/**    'd'                send a snapshot of every metric                    **/
+/**    'a' <period>       send a snapshot every period ms (4 bytes, little   **/
+/**                       endian), or stop if it's 0                         **/
+/**  Responses are frames on the 'metr' stream. Listing sends 'l', the       **/
+/**  metric's index, its metric_type_e_t and its name for each metric, then  **/
+/**  'l' and the metric count. A snapshot is 'd', the metric count and       **/
+/**  millis() (uint32_t), then for each metric its index and type followed   **/
+/**  by its uint32_t value, or by a metric_histogram_s_t for a histogram.    **/
+/**  The kernel registers gauges of its own, e.g. "heap.free".               **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of metrics responses ("metr" little endian)
+ */
+#define SER_METRICS_STREAM_ID 0x7274656d
+
+/**
+ * The maximum number of metrics which can be registered, including the
+ * kernel's
+ */
+#define METRIC_MAX_COUNT 64
+
+/**
+ * The maximum number of those which can be histograms
+ */
+#define METRIC_MAX_HISTOGRAMS 8
+
+/**
+ * The maximum length of a metric's name, excluding the null terminator
+ */
+#define METRIC_NAME_LENGTH 24
+
+/**
+ * The number of buckets in each histogram. Bucket i counts the values with i
+ * significant bits, i.e. from 2^(i-1) to 2^i - 1, and the last bucket also
+ * counts every larger value.
+ */
+#define METRIC_HISTOGRAM_BUCKETS 16
+
+typedef enum metric_type_e { E_METRIC_COUNTER = 0, E_METRIC_GAUGE, E_METRIC_HISTOGRAM } metric_type_e_t;
+
+/**
+ * The observations of a histogram, as sent in a snapshot
+ */
+typedef struct metric_histogram_s {
+	uint32_t count;  // The number of values observed
+	uint32_t sum;    // The sum of the values observed, wrapping around
+	uint32_t buckets[METRIC_HISTOGRAM_BUCKETS];
+} metric_histogram_s_t;
+
+/**
+ * Registers a counter, which starts at 0 and is increased by metric_add().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name is NULL or longer than METRIC_NAME_LENGTH
+ * EEXIST - A metric with the same name is already registered
+ * ENOMEM - METRIC_MAX_COUNT metrics are already registered
+ *
+ * \param name
+ *        The metric's name. It is not copied so it must stay valid
+ *
+ * \return The metric's index upon success, PROS_ERR upon failure
+ */
+int32_t metric_register_counter(const char* name);
+
+/**
+ * Registers a gauge, which holds the last value given to metric_set().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name is NULL or longer than METRIC_NAME_LENGTH
+ * EEXIST - A metric with the same name is already registered
+ * ENOMEM - METRIC_MAX_COUNT metrics are already registered
+ *
+ * \param name
+ *        The metric's name. It is not copied so it must stay valid
+ *
+ * \return The metric's index upon success, PROS_ERR upon failure
+ */
+int32_t metric_register_gauge(const char* name);
+
+/**
+ * Registers a gauge whose value is read by calling a function each time a
+ * snapshot is taken, for values which are already kept elsewhere. The function
+ * is called from whichever task takes the snapshot, usually the serial daemon,
+ * so it must not block for long.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name or sample is NULL, or name is longer than METRIC_NAME_LENGTH
+ * EEXIST - A metric with the same name is already registered
+ * ENOMEM - METRIC_MAX_COUNT metrics are already registered
+ *
+ * \param name
+ *        The metric's name. It is not copied so it must stay valid
+ * \param sample
+ *        The function which gives the gauge's value
+ *
+ * \return The metric's index upon success, PROS_ERR upon failure
+ */
+int32_t metric_register_sampled(const char* name, uint32_t (*sample)(void));
+
+/**
+ * Registers a histogram, which counts the values given to metric_observe() in
+ * METRIC_HISTOGRAM_BUCKETS power of two buckets.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - name is NULL or longer than METRIC_NAME_LENGTH
+ * EEXIST - A metric with the same name is already registered
+ * ENOMEM - METRIC_MAX_COUNT metrics or METRIC_MAX_HISTOGRAMS histograms are
+ *          already registered
+ *
+ * \param name
+ *        The metric's name. It is not copied so it must stay valid
+ *
+ * \return The metric's index upon success, PROS_ERR upon failure
+ */
+int32_t metric_register_histogram(const char* name);
+
+/**
+ * Adds to a counter. Safe to call from interrupts. Indexes which aren't
+ * registered are ignored, so a failed registration needs no checks.
+ *
+ * \param metric
+ *        The index of the counter
+ * \param n
+ *        The amount to add
+ */
+void metric_add(int32_t metric, uint32_t n);
+
+/**
+ * Sets a gauge's value. Safe to call from interrupts. Indexes which aren't
+ * registered are ignored.
+ *
+ * \param metric
+ *        The index of the gauge
+ * \param value
+ *        The new value
+ */
+void metric_set(int32_t metric, uint32_t value);
+
+/**
+ * Counts a value in a histogram. Safe to call from interrupts. Indexes which
+ * aren't registered histograms are ignored.
+ *
+ * \param metric
+ *        The index of the histogram
+ * \param value
+ *        The value observed, e.g. a duration in microseconds
+ */
+void metric_observe(int32_t metric, uint32_t value);
+
+/**
+ * Sends a snapshot of every metric on the 'metr' stream now, as the host's 'd'
+ * request does.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENOBUFS - The serial output buffer had no room for the snapshot
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t metric_dump(void);
+
+/******************************************************************************/
+/**                              File Transfer                               **/
+/**                                                                          **/
+/**  Uploads files from the host to the microSD card over the serial line.   **/
+/**  The host sends "pRf", a length byte and a request:                      **/
+/**    'o' <size> <crc> <path>   start an upload, replacing the file at path  **/
+/**                              (relative to /usd/, the size and CRC-32 of   **/
+/**                              the whole file as 4 byte little endian)      **/
+/**    'c'                       finish the upload, checking size and CRC    **/
+/**    'x'                       abandon the upload                           **/
+/**  Then for each block of the file, "pRF", the block's sequence number     **/
+/**  (from 0) and length (both uint16_t), its CRC-32 (uint32_t) and the       **/
+/**  length bytes of data, which are read in bulk rather than parsed.        **/
+/**  Every request and block is answered on the 'file' stream with the op,   **/
+/**  a ser_file_status_e_t, the sequence number of the next block wanted     **/
+/**  (uint16_t) and the number of bytes written so far (uint32_t). Only that **/
+/**  block is taken next, so the host can keep up to SER_FILE_WINDOW blocks  **/
+/**  in flight and resend from the wanted one after a block is refused.      **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of file transfer answers ("file" little endian)
+ */
+#define SER_FILE_STREAM_ID 0x656c6966
+
+/**
+ * The most data one block can carry
+ */
+#define SER_FILE_BLOCK_SIZE 1024
+
+/**
+ * The most blocks the host should send before they are answered
+ */
+#define SER_FILE_WINDOW 4
+
+typedef enum ser_file_status_e {
+	E_SER_FILE_OK = 0,
+	E_SER_FILE_BAD_REQUEST,   // The request is malformed, or a block is over SER_FILE_BLOCK_SIZE
+	E_SER_FILE_OPEN_FAILED,   // The file couldn't be created
+	E_SER_FILE_NOT_OPEN,      // No upload has been started
+	E_SER_FILE_OUT_OF_ORDER,  // The block isn't the one wanted next
+	E_SER_FILE_BAD_CRC,       // The block, or the whole file when finishing, doesn't match its CRC
+	E_SER_FILE_BAD_SIZE,      // The upload was finished with a different size than it was started with
+	E_SER_FILE_WRITE_FAILED   // Writing to the card failed
+} ser_file_status_e_t;
+
+/******************************************************************************/
+/**                          Clock Synchronization                           **/
+/**                                                                          **/
+/**  An NTP style exchange which relates micros() to the host's clock, so    **/
+/**  logs line up with video and field data. The host sends "pRt" and 24     **/
+/**  bytes: the time it sent this request, then the time it sent the last    **/
+/**  request and the time it received that answer (all uint64_t              **/
+/**  microseconds, 0 if there was none). The robot answers on the 'sync'     **/
+/**  stream with the request's time, micros() when the request was read and  **/
+/**  micros() when the answer was sent. Each completed exchange samples the  **/
+/**  offset between the clocks, and the robot keeps the offset of the        **/
+/**  fastest recent exchange and the drift between the clocks. While the     **/
+/**  'tlm' stream is activated, every new estimate is also sent as a         **/
+/**  SER_TLM_CLOCK_ID record.                                                **/
+/******************************************************************************/
+
+/**
+ * The stream identifier of clock synchronization answers ("sync" little
+ * endian)
+ */
+#define SER_SYNC_STREAM_ID 0x636e7973
+
+/**
+ * The telemetry record ID reserved for clock estimates. Its payload is
+ * micros() when it was sent (uint64_t), then the offset (int64_t) and the
+ * drift (double) of clock_sync_status_s_t as of that time, which convert the
+ * robot's timestamps in every other record to host time.
+ */
+#define SER_TLM_CLOCK_ID 0xffff
+
+/**
+ * The current relation between micros() and the host's clock
+ */
+typedef struct clock_sync_status_s {
+	uint64_t ref_time;  // micros() when offset was measured
+	int64_t offset;     // The host's time minus micros() at ref_time, in microseconds
+	double drift;       // How much offset grows per microsecond of micros(), e.g. 1e-5 for 10 ppm
+	uint32_t delay;     // The round trip time of the exchange which measured offset, in microseconds
+	uint32_t samples;   // The number of exchanges completed
+} clock_sync_status_s_t;
+
+/**
+ * Gets the current estimate of the host's clock.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - status is NULL
+ * EAGAIN - No exchange has completed yet
+ *
+ * \param[out] status
+ *        The estimate
+ *
+ * \return 1 upon success or PROS_ERR upon failure
+ */
+int32_t clock_sync_get_status(clock_sync_status_s_t* const status);
+
+/**
+ * Converts a micros() timestamp to the host's time.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EAGAIN - No exchange has completed yet
+ *
+ * \param time
+ *        The timestamp, from micros()
+ *
+ * \return The host's time at that timestamp in microseconds, or 0 if no
+ * exchange has completed, setting errno
+ */
+uint64_t clock_sync_to_host(const uint64_t time);
+
+/******************************************************************************/
+/**                               Boot Options                               **/
+/**                                                                          **/
+/**  What the kernel does before initialize() runs. A program picks options  **/
+/**  by defining them once in any of its source files, e.g.                  **/
+/**  PROS_BOOT_OPTIONS(PROS_BOOT_DEFER_DISPLAY | PROS_BOOT_QUIET_REGISTRY);  **/
+/******************************************************************************/
+
+/**
+ * Don't bring up LVGL, its theme and the default screen at boot. The display
+ * daemon brings them up once it first gets to run, which is when the higher
+ * priority tasks like initialize() first block, or the first kernel display
+ * function (e.g. lcd_initialize()) or display_start() does if that's earlier.
+ *
+ * Programs which call LVGL directly from initialize() or a global constructor
+ * must call display_start() first.
+ */
+#define PROS_BOOT_DEFER_DISPLAY 0x1
+
+/**
+ * Don't log every device found while registering the smart ports at boot.
+ */
+#define PROS_BOOT_QUIET_REGISTRY 0x2
+
+/**
+ * Lock the kernel's latency-critical code and data (the tick, the context
+ * switch, the system daemon and the port mutexes) into one way of the L2
+ * cache, so that they don't miss to DDR after the program evicts them. This
+ * takes 64 KB of the 512 KB L2 cache away from the rest of the program and
+ * VEXos, and does nothing if VEXos already locked that way.
+ */
+#define PROS_BOOT_LOCK_FAST 0x4
+
+#ifdef __cplusplus
+#define PROS_BOOT_OPTIONS(options) extern "C" const uint32_t pros_boot_options = (options)
+#else
+#define PROS_BOOT_OPTIONS(options) const uint32_t pros_boot_options = (options)
+#endif
+
+/**
+ * The sizes of the serial driver's buffers, see PROS_SER_BUFFER_SIZES(). A
+ * size of 0 keeps the default.
+ */
+typedef struct ser_buffer_sizes_s {
+	uint32_t output;  // Bytes of queued output for normal priority streams, 2047 by default
+	uint32_t input;   // Bytes of received stdin not read yet, 4096 by default
+} ser_buffer_sizes_s_t;
+
+/**
+ * Sets the sizes of the serial driver's buffers, e.g.
+ * PROS_SER_BUFFER_SIZES(32768, 0); for a 32 KB output buffer. Like
+ * PROS_BOOT_OPTIONS(), this is defined once in any of the program's source
+ * files. The buffers are taken from the heap at boot, and a size the heap
+ * can't fit falls back to the default.
+ */
+#ifdef __cplusplus
+#define PROS_SER_BUFFER_SIZES(output, input) \
+	extern "C" const ::pros::c::ser_buffer_sizes_s_t pros_ser_buffer_sizes = {(output), (input)}
+#else
+#define PROS_SER_BUFFER_SIZES(output, input) const ser_buffer_sizes_s_t pros_ser_buffer_sizes = {(output), (input)}
+#endif
+
+/******************************************************************************/
+/**                           Robot Configuration                            **/
+/**                                                                          **/
+/**  A table of the devices the robot has, defined once in any source file  **/
+/**  of the program and read by the kernel at boot, e.g.                     **/
+/**  PROS_ROBOT_CONFIG(PROS_ROBOT_MOTOR(1, E_MOTOR_GEARSET_06,               **/
+/**                                     E_MOTOR_BRAKE_COAST,                 **/
+/**                                     E_MOTOR_ENCODER_DEGREES, false),     **/
+/**                    PROS_ROBOT_DEVICE(10, E_DEVICE_IMU));                 **/
+/**  Each port is bound to its type, so a device plugged in late doesn't    **/
+/**  have to be registered by the first call to it, and each motor's         **/
+/**  settings are sent before initialize() runs and again whenever the       **/
+/**  motor is plugged back in.                                               **/
+/******************************************************************************/
+
+/**
+ * One device of the robot configuration. The motor settings are ignored for
+ * other devices, and a setting of its type's *_INVALID value is left alone.
+ */
+typedef struct robot_port_config_s {
+	uint8_t port;  // The V5 port number from 1-21
+	v5_device_e_t type;
+	motor_gearset_e_t gearset;
+	motor_brake_mode_e_t brake_mode;
+	motor_encoder_units_e_t encoder_units;
+	bool reversed;
+} robot_port_config_s_t;
+
+#ifdef __cplusplus
+#define PROS_ROBOT_CONFIG(...)                                                           \
+	extern "C" const ::pros::c::robot_port_config_s_t pros_robot_config[] = {__VA_ARGS__}; \
+	extern "C" const uint32_t pros_robot_config_count = sizeof(pros_robot_config) / sizeof(pros_robot_config[0])
+#define PROS_ROBOT_MOTOR(port, gearset, brake_mode, encoder_units, reversed) \
+	{ (port), ::pros::c::E_DEVICE_MOTOR, (gearset), (brake_mode), (encoder_units), (reversed) }
+#define PROS_ROBOT_DEVICE(port, type)                                               \
+	{ (port), (type), ::pros::E_MOTOR_GEARSET_INVALID, ::pros::E_MOTOR_BRAKE_INVALID, \
+	  ::pros::E_MOTOR_ENCODER_INVALID, false }
+#else
+#define PROS_ROBOT_CONFIG(...)                                     \
+	const robot_port_config_s_t pros_robot_config[] = {__VA_ARGS__}; \
+	const uint32_t pros_robot_config_count = sizeof(pros_robot_config) / sizeof(pros_robot_config[0])
+#define PROS_ROBOT_MOTOR(port, gearset, brake_mode, encoder_units, reversed) \
+	{ (port), E_DEVICE_MOTOR, (gearset), (brake_mode), (encoder_units), (reversed) }
+#define PROS_ROBOT_DEVICE(port, type) \
+	{ (port), (type), E_MOTOR_GEARSET_INVALID, E_MOTOR_BRAKE_INVALID, E_MOTOR_ENCODER_INVALID, false }
+#endif
+
+/**
+ * Brings up LVGL if the program deferred it with PROS_BOOT_DEFER_DISPLAY and
+ * it isn't up yet. The kernel's own display functions call this themselves.
+ */
+void display_start(void);
+
+/**
+ * Checks whether LVGL is up, see PROS_BOOT_DEFER_DISPLAY.
+ *
+ * \return True if LVGL may be used
+ */
+bool display_is_started(void);
 
 #ifdef __cplusplus
 }
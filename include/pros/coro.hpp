@@ -0,0 +1,541 @@
+/**
+ * \file pros/coro.hpp
+ *
+ * Contains a cooperative executor for C++20 coroutines.
+ *
+ * Small behaviors such as LED blinkers, debouncers and state machines can be
+ * written as coroutines and run together on the stack of one task instead of
+ * each taking a task of its own. This header needs C++20 and is not included
+ * by api.h, so compile with -std=gnu++20 and include it directly.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_CORO_HPP_
+#define _PROS_CORO_HPP_
+
+#ifndef __cpp_impl_coroutine
+#error "pros/coro.hpp requires C++20 coroutines (compile with -std=gnu++20)"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+#include "pros/rtos.hpp"
+
+/**
+ * The size in bytes of a block of the coroutine frame pool. A behavior whose
+ * frame does not fit in a block cannot be started.
+ *
+ * Both pool settings may be defined before including this header, but must be
+ * the same in every source file.
+ */
+#ifndef PROS_CORO_FRAME_SIZE
+#define PROS_CORO_FRAME_SIZE 512
+#endif
+
+/**
+ * The number of blocks in the coroutine frame pool, i.e. the number of
+ * behaviors which can exist at once.
+ */
+#ifndef PROS_CORO_FRAME_COUNT
+#define PROS_CORO_FRAME_COUNT 32
+#endif
+
+namespace pros {
+namespace coro {
+class Executor;
+namespace detail {
+class NotifyAwaiter;
+}
+
+namespace detail {
+/**
+ * Fixed-size blocks from which every coroutine frame is allocated.
+ *
+ * Frames are allocated by whichever task calls the coroutine, so the free list
+ * is a lock-free stack of block indices. Its head carries a counter in the
+ * upper half-word to rule out ABA.
+ */
+class FramePool {
+	static_assert(PROS_CORO_FRAME_COUNT > 0 && PROS_CORO_FRAME_COUNT < 0xFFFF, "Invalid PROS_CORO_FRAME_COUNT");
+
+	public:
+	static constexpr std::size_t block_size =
+	    (PROS_CORO_FRAME_SIZE + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+	void* allocate(std::size_t size) noexcept {
+		if (size > block_size) return nullptr;
+		std::uint32_t head = free_head.load(std::memory_order_acquire);
+		while ((head & 0xFFFF) != none) {
+			std::uint32_t index = head & 0xFFFF;
+			std::uint32_t next = ((head + 0x10000) & 0xFFFF0000) | next_free[index];
+			if (free_head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+				return blocks[index];
+			}
+		}
+		// Blocks which have never been handed out aren't on the free list yet
+		std::uint32_t index = unused.load(std::memory_order_relaxed);
+		while (index < PROS_CORO_FRAME_COUNT) {
+			if (unused.compare_exchange_weak(index, index + 1, std::memory_order_relaxed)) return blocks[index];
+		}
+		return nullptr;
+	}
+
+	void deallocate(void* ptr) noexcept {
+		std::uint32_t index = (static_cast<unsigned char*>(ptr) - blocks[0]) / block_size;
+		std::uint32_t head = free_head.load(std::memory_order_relaxed);
+		std::uint32_t next;
+		do {
+			next_free[index] = head & 0xFFFF;
+			next = ((head + 0x10000) & 0xFFFF0000) | index;
+		} while (!free_head.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	private:
+	static constexpr std::uint16_t none = 0xFFFF;
+
+	alignas(std::max_align_t) unsigned char blocks[PROS_CORO_FRAME_COUNT][block_size] = {};
+	std::uint16_t next_free[PROS_CORO_FRAME_COUNT] = {};
+	std::atomic<std::uint32_t> free_head{none};
+	std::atomic<std::uint32_t> unused{0};
+};
+
+// Constant initialized, so behaviors may be created from global constructors
+constinit inline FramePool frame_pool;
+
+/**
+ * What a suspended behavior is waiting for. A behavior waiting for nothing is
+ * resumed on the executor's next pass.
+ */
+struct Wait {
+	bool (*ready)(void*) = nullptr;  // Condition checked on every pass, given the awaiter
+	void* awaiter = nullptr;
+	std::uint32_t deadline = 0;
+	bool has_deadline = false;
+	bool on_notify = false;  // Resume once Executor::notify() is called
+	std::uint32_t notifications = 0;
+	bool timed_out = false;  // Set if the deadline resumed the behavior
+};
+}  // namespace detail
+
+/**
+ * A coroutine run cooperatively by an Executor.
+ *
+ * Any function returning Behavior is a coroutine. Calling it allocates its
+ * frame from the frame pool but does not run it; pass the result to
+ * Executor::spawn(). If the pool is exhausted, the Behavior is empty and
+ * spawning it fails.
+ *
+ * Behaviors wait with co_await on the awaitables below, and must not block the
+ * executor's task, e.g. with pros::delay() or a mutex, as that stalls every
+ * other behavior.
+ */
+class Behavior {
+	public:
+	struct promise_type {
+		Executor* executor = nullptr;
+		promise_type* next = nullptr;
+		detail::Wait wait;
+
+		static void* operator new(std::size_t size) noexcept {
+			return detail::frame_pool.allocate(size);
+		}
+		static void operator delete(void* ptr) noexcept {
+			detail::frame_pool.deallocate(ptr);
+		}
+		static Behavior get_return_object_on_allocation_failure() noexcept {
+			return Behavior();
+		}
+		Behavior get_return_object() noexcept {
+			return Behavior(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+		std::suspend_always initial_suspend() noexcept {
+			return {};
+		}
+		std::suspend_always final_suspend() noexcept {
+			return {};
+		}
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept {
+			std::terminate();
+		}
+	};
+
+	Behavior() noexcept = default;
+	Behavior(Behavior&& other) noexcept : coroutine(std::exchange(other.coroutine, nullptr)) {}
+	Behavior& operator=(Behavior&& other) noexcept {
+		if (this != &other) {
+			if (coroutine) coroutine.destroy();
+			coroutine = std::exchange(other.coroutine, nullptr);
+		}
+		return *this;
+	}
+	Behavior(const Behavior&) = delete;
+	Behavior& operator=(const Behavior&) = delete;
+	~Behavior() {
+		if (coroutine) coroutine.destroy();
+	}
+
+	/**
+	 * \return False if the frame pool had no room for the behavior
+	 */
+	explicit operator bool() const noexcept {
+		return static_cast<bool>(coroutine);
+	}
+
+	private:
+	explicit Behavior(std::coroutine_handle<promise_type> handle) noexcept : coroutine(handle) {}
+
+	std::coroutine_handle<promise_type> coroutine;
+	friend class Executor;
+};
+
+/**
+ * Runs any number of behaviors inside the task which calls run().
+ *
+ * Each pass resumes every behavior whose wait is over, then the task sleeps
+ * on its notification value until the nearest deadline, a call to notify(),
+ * or, while any behavior polls a condition, the poll interval.
+ */
+class Executor {
+	public:
+	/**
+	 * \param poll_interval
+	 *        How often, in milliseconds, to check the conditions of behaviors
+	 *        waiting in until() or receive()
+	 */
+	explicit Executor(std::uint32_t poll_interval = 1) noexcept : poll_interval(poll_interval) {}
+	Executor(const Executor&) = delete;
+	Executor& operator=(const Executor&) = delete;
+
+	/**
+	 * Destroys any behaviors which have not finished.
+	 */
+	~Executor() {
+		while (head != nullptr) {
+			Behavior::promise_type* promise = head;
+			head = promise->next;
+			std::coroutine_handle<Behavior::promise_type>::from_promise(*promise).destroy();
+		}
+	}
+
+	/**
+	 * Adds a behavior to the executor. It first runs on the executor's next
+	 * pass, after the behaviors added before it.
+	 *
+	 * This may be called before run() or from a behavior of this executor, but
+	 * not from other tasks while the executor is running.
+	 *
+	 * \param behavior
+	 *        The behavior to take ownership of
+	 *
+	 * \return True if the behavior was added, false if it is empty
+	 */
+	bool spawn(Behavior&& behavior) noexcept {
+		if (!behavior) return false;
+		Behavior::promise_type* promise = &std::exchange(behavior.coroutine, nullptr).promise();
+		promise->executor = this;
+		Behavior::promise_type** link = &head;
+		while (*link != nullptr) link = &(*link)->next;
+		*link = promise;
+		return true;
+	}
+
+	/**
+	 * Runs the behaviors in the calling task until all of them have finished.
+	 */
+	void run() {
+		task.store(c::task_get_current(), std::memory_order_release);
+		while (head != nullptr) {
+			std::uint32_t timeout = step();
+			if (head != nullptr && timeout != 0) c::task_notify_take(true, timeout);
+		}
+		task.store(nullptr, std::memory_order_release);
+	}
+
+	/**
+	 * Resumes every behavior waiting in notified(). This may be called from any
+	 * task.
+	 */
+	void notify() noexcept {
+		notifications.fetch_add(1, std::memory_order_release);
+		task_t runner = task.load(std::memory_order_acquire);
+		if (runner != nullptr) c::task_notify(runner);
+	}
+
+	/**
+	 * \return The number of behaviors which have not finished
+	 */
+	std::size_t size() const noexcept {
+		std::size_t count = 0;
+		for (Behavior::promise_type* promise = head; promise != nullptr; promise = promise->next) count++;
+		return count;
+	}
+
+	private:
+	static bool is_ready(detail::Wait& wait, std::uint32_t now, std::uint32_t notifications) {
+		if (wait.ready != nullptr && wait.ready(wait.awaiter)) return true;
+		if (wait.on_notify && wait.notifications != notifications) return true;
+		if (wait.has_deadline && static_cast<std::int32_t>(now - wait.deadline) >= 0) {
+			wait.timed_out = true;
+			return true;
+		}
+		return wait.ready == nullptr && !wait.on_notify && !wait.has_deadline;
+	}
+
+	// resumes the behaviors which are ready and returns how long the task may sleep
+	std::uint32_t step() {
+		std::uint32_t now = c::millis();
+		std::uint32_t seen = notifications.load(std::memory_order_acquire);
+		std::uint32_t timeout = TIMEOUT_MAX;
+		Behavior::promise_type** link = &head;
+		while (*link != nullptr) {
+			Behavior::promise_type* promise = *link;
+			if (is_ready(promise->wait, now, seen)) {
+				auto coroutine = std::coroutine_handle<Behavior::promise_type>::from_promise(*promise);
+				coroutine.resume();
+				now = c::millis();
+				if (coroutine.done()) {
+					*link = promise->next;
+					coroutine.destroy();
+					continue;
+				}
+			}
+			const detail::Wait& wait = promise->wait;
+			if (wait.ready != nullptr && poll_interval < timeout) timeout = poll_interval;
+			if (wait.has_deadline) {
+				std::int32_t left = static_cast<std::int32_t>(wait.deadline - now);
+				if (left <= 0) {
+					timeout = 0;
+				} else if (static_cast<std::uint32_t>(left) < timeout) {
+					timeout = left;
+				}
+			}
+			if (wait.ready == nullptr && !wait.on_notify && !wait.has_deadline) timeout = 0;
+			link = &promise->next;
+		}
+		return timeout;
+	}
+
+	Behavior::promise_type* head = nullptr;
+	std::atomic<task_t> task{nullptr};
+	std::atomic<std::uint32_t> notifications{0};
+	std::uint32_t poll_interval;
+
+	friend class detail::NotifyAwaiter;
+};
+
+namespace detail {
+// Records a new wait in the promise of the suspending behavior
+class WaitAwaiter {
+	public:
+	bool await_ready() const noexcept {
+		return false;
+	}
+
+	protected:
+	Wait& begin_wait(std::coroutine_handle<Behavior::promise_type> handle, std::uint32_t timeout) noexcept {
+		promise = &handle.promise();
+		promise->wait = Wait();
+		if (timeout != TIMEOUT_MAX) {
+			promise->wait.has_deadline = true;
+			promise->wait.deadline = c::millis() + timeout;
+		}
+		return promise->wait;
+	}
+	bool timed_out() const noexcept {
+		return promise != nullptr && promise->wait.timed_out;
+	}
+
+	Behavior::promise_type* promise = nullptr;
+};
+
+class DelayAwaiter : public WaitAwaiter {
+	public:
+	explicit DelayAwaiter(std::uint32_t milliseconds) noexcept : milliseconds(milliseconds) {}
+	void await_suspend(std::coroutine_handle<Behavior::promise_type> handle) noexcept {
+		begin_wait(handle, milliseconds);
+	}
+	void await_resume() const noexcept {}
+
+	private:
+	std::uint32_t milliseconds;
+};
+
+class DelayUntilAwaiter : public WaitAwaiter {
+	public:
+	DelayUntilAwaiter(std::uint32_t* prev_time, std::uint32_t delta) noexcept {
+		*prev_time += delta;
+		wake_time = *prev_time;
+	}
+	bool await_ready() const noexcept {
+		return static_cast<std::int32_t>(c::millis() - wake_time) >= 0;
+	}
+	void await_suspend(std::coroutine_handle<Behavior::promise_type> handle) noexcept {
+		Wait& wait = begin_wait(handle, TIMEOUT_MAX);
+		wait.has_deadline = true;
+		wait.deadline = wake_time;
+	}
+	void await_resume() const noexcept {}
+
+	private:
+	std::uint32_t wake_time;
+};
+
+template <typename P>
+class UntilAwaiter : public WaitAwaiter {
+	public:
+	UntilAwaiter(P&& predicate, std::uint32_t timeout) : predicate(std::forward<P>(predicate)), timeout(timeout) {}
+	bool await_ready() {
+		return predicate();
+	}
+	void await_suspend(std::coroutine_handle<Behavior::promise_type> handle) noexcept {
+		Wait& wait = begin_wait(handle, timeout);
+		wait.ready = &check;
+		wait.awaiter = this;
+	}
+	bool await_resume() const noexcept {
+		return !timed_out();
+	}
+
+	private:
+	static bool check(void* self) {
+		return static_cast<UntilAwaiter*>(self)->predicate();
+	}
+
+	P predicate;
+	std::uint32_t timeout;
+};
+
+class NotifyAwaiter : public WaitAwaiter {
+	public:
+	explicit NotifyAwaiter(std::uint32_t timeout) noexcept : timeout(timeout) {}
+	void await_suspend(std::coroutine_handle<Behavior::promise_type> handle) noexcept {
+		Wait& wait = begin_wait(handle, timeout);
+		wait.on_notify = true;
+		wait.notifications = handle.promise().executor->notifications.load(std::memory_order_acquire);
+	}
+	bool await_resume() const noexcept {
+		return !timed_out();
+	}
+
+	private:
+	std::uint32_t timeout;
+};
+
+template <typename T, std::uint32_t N>
+class ReceiveAwaiter : public WaitAwaiter {
+	public:
+	ReceiveAwaiter(Queue<T, N>& queue, T& item, std::uint32_t timeout) noexcept
+	    : queue(queue), item(item), timeout(timeout) {}
+	bool await_ready() {
+		return queue.recv(item, 0);
+	}
+	void await_suspend(std::coroutine_handle<Behavior::promise_type> handle) noexcept {
+		Wait& wait = begin_wait(handle, timeout);
+		wait.ready = &check;
+		wait.awaiter = this;
+	}
+	bool await_resume() const noexcept {
+		return !timed_out();
+	}
+
+	private:
+	static bool check(void* self) {
+		ReceiveAwaiter* awaiter = static_cast<ReceiveAwaiter*>(self);
+		return awaiter->queue.recv(awaiter->item, 0);
+	}
+
+	Queue<T, N>& queue;
+	T& item;
+	std::uint32_t timeout;
+};
+}  // namespace detail
+
+/**
+ * Suspends the behavior for a given number of milliseconds. A delay of 0 lets
+ * the other behaviors run once.
+ *
+ * \param milliseconds
+ *        The number of milliseconds to wait (1000 milliseconds per second)
+ */
+inline detail::DelayAwaiter delay(std::uint32_t milliseconds) noexcept {
+	return detail::DelayAwaiter(milliseconds);
+}
+
+/**
+ * Suspends the behavior until a time specified in milliseconds, like
+ * task_delay_until(). This does not suspend if the wake time has passed.
+ *
+ * \param prev_time
+ *        A pointer to the location storing the setpoint time, advanced by
+ *        delta. This should typically be initialized to pros::millis().
+ * \param delta
+ *        The number of milliseconds to wait (1000 milliseconds per second)
+ */
+inline detail::DelayUntilAwaiter delay_until(std::uint32_t* prev_time, std::uint32_t delta) noexcept {
+	return detail::DelayUntilAwaiter(prev_time, delta);
+}
+
+/**
+ * Suspends the behavior until a predicate returns true. The predicate is
+ * checked on every pass of the executor and at least every poll interval.
+ *
+ * \param predicate
+ *        A callable returning bool
+ * \param timeout
+ *        Time to wait in milliseconds. TIMEOUT_MAX waits forever.
+ *
+ * \return True if the predicate became true, false if the wait timed out
+ */
+template <typename P>
+detail::UntilAwaiter<P> until(P&& predicate, std::uint32_t timeout = TIMEOUT_MAX) {
+	return detail::UntilAwaiter<P>(std::forward<P>(predicate), timeout);
+}
+
+/**
+ * Suspends the behavior until Executor::notify() is called.
+ *
+ * \param timeout
+ *        Time to wait in milliseconds. TIMEOUT_MAX waits forever.
+ *
+ * \return True if the executor was notified, false if the wait timed out
+ */
+inline detail::NotifyAwaiter notified(std::uint32_t timeout = TIMEOUT_MAX) noexcept {
+	return detail::NotifyAwaiter(timeout);
+}
+
+/**
+ * Suspends the behavior until an item can be received from a queue. Other
+ * tasks can keep sending to the queue as usual.
+ *
+ * \param queue
+ *        The queue to receive from
+ * \param[out] item
+ *        Assigned the received item
+ * \param timeout
+ *        Time to wait in milliseconds. TIMEOUT_MAX waits forever.
+ *
+ * \return True if an item was received, false if the wait timed out
+ */
+template <typename T, std::uint32_t N>
+detail::ReceiveAwaiter<T, N> receive(Queue<T, N>& queue, T& item, std::uint32_t timeout = TIMEOUT_MAX) noexcept {
+	return detail::ReceiveAwaiter<T, N>(queue, item, timeout);
+}
+}  // namespace coro
+}  // namespace pros
+
+#endif  // _PROS_CORO_HPP_
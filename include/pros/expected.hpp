@@ -0,0 +1,152 @@
+/**
+ * \file pros/expected.hpp
+ *
+ * Contains pros::expected, which carries either a result or the errno value of
+ * a call which failed.
+ *
+ * The C++ wrappers return the same sentinels as the C API (PROS_ERR or
+ * PROS_ERR_F) and set errno. pros::expect() turns such a result into a
+ * pros::expected right at the call, so the error travels with the value
+ * instead of in errno, which the next call may overwrite, e.g.
+ *
+ * pros::expected<double> pos = pros::expect(motor.get_position());
+ * if (!pos) {
+ *   printf("motor: %s\n", strerror(pos.error()));
+ *   return;
+ * }
+ * double target = *pos + 90;
+ *
+ * This works the same with or without exceptions, so it suits programs built
+ * against the EXCEPTIONS=0 kernel. Only value() throws, and without exceptions
+ * it aborts instead.
+ *
+ * This header is not included by api.h, so include it directly.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_EXPECTED_HPP_
+#define _PROS_EXPECTED_HPP_
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+#ifdef __cpp_exceptions
+#include <system_error>
+#endif
+
+namespace pros {
+/**
+ * Either a T, or the errno value of the call which failed to give one.
+ */
+template <typename T>
+class expected {
+	static_assert(std::is_trivially_copyable<T>::value, "pros::expected holds the results of the kernel's calls");
+
+	public:
+	/**
+	 * Creates an expected holding a result.
+	 */
+	constexpr expected(T value) noexcept : val(value), err(0) {}
+
+	/**
+	 * Creates an expected holding an error.
+	 *
+	 * \param error
+	 *        The errno value, which must not be 0
+	 */
+	static constexpr expected failure(int error) noexcept {
+		return expected(T(), error);
+	}
+
+	constexpr bool has_value() const noexcept {
+		return err == 0;
+	}
+
+	constexpr explicit operator bool() const noexcept {
+		return err == 0;
+	}
+
+	/**
+	 * Gets the errno value the call failed with.
+	 *
+	 * \return The errno value, or 0 if there is a result
+	 */
+	constexpr int error() const noexcept {
+		return err;
+	}
+
+	/**
+	 * Gets the result without checking there is one.
+	 */
+	constexpr const T& operator*() const noexcept {
+		return val;
+	}
+
+	/**
+	 * Gets the result. If there isn't one this throws a std::system_error, or
+	 * aborts if exceptions are disabled.
+	 */
+	const T& value() const {
+		if (err != 0) {
+#ifdef __cpp_exceptions
+			throw std::system_error(err, std::generic_category());
+#else
+			std::abort();
+#endif
+		}
+		return val;
+	}
+
+	/**
+	 * Gets the result, or fallback if there isn't one.
+	 */
+	constexpr T value_or(T fallback) const noexcept {
+		return err == 0 ? val : fallback;
+	}
+
+	private:
+	constexpr expected(T value, int error) noexcept : val(value), err(error) {}
+
+	T val;
+	int err;
+};
+
+/**
+ * Checks the result of a kernel call for its error sentinel, PROS_ERR for
+ * 32-bit integers and PROS_ERR_F for floating point values. Results of any
+ * other type are taken as they are.
+ *
+ * Must be called straight on the kernel call's result, before anything else
+ * has a chance to change errno.
+ *
+ * \param result
+ *        What the call returned
+ *
+ * \return The result, or errno if the result is the sentinel
+ */
+template <typename T>
+expected<T> expect(T result) noexcept {
+	bool failed = false;
+	if constexpr (std::is_floating_point<T>::value) {
+		failed = result == std::numeric_limits<T>::infinity();
+	} else if constexpr (std::is_integral<T>::value && sizeof(T) == sizeof(std::int32_t)) {
+		failed = result == static_cast<T>(std::numeric_limits<std::int32_t>::max());
+	}
+	if (failed) return expected<T>::failure(errno != 0 ? errno : EIO);
+	return result;
+}
+}  // namespace pros
+
+#endif  // _PROS_EXPECTED_HPP_
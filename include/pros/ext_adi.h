@@ -0,0 +1,589 @@
+/**
+ * \file pros/ext_adi.h
+ *
+ * Contains prototypes for interfacing with the ADI on a smart port, i.e. a
+ * three-wire port expander.
+ *
+ * Each of these functions is the adi.h function of the same name with the
+ * smart port of the ADI to use in front. The brain's own three-wire ports are
+ * the ADI on ADI_INTERNAL_SMART_PORT, so e.g.
+ * ext_adi_digital_write(ADI_INTERNAL_SMART_PORT, 'A', HIGH) is
+ * adi_digital_write('A', HIGH). Every expander keeps its own cached port
+ * configurations, calibrations and encoder velocities, just like the brain's
+ * ADI does.
+ *
+ * The encoders, ultrasonics and gyros created here are used with the
+ * functions in adi.h, e.g. adi_encoder_get(), since their handles carry the
+ * smart port along with the ADI port.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_EXT_ADI_H_
+#define _PROS_EXT_ADI_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pros/adi.h"
+
+/**
+ * The smart port of the brain's own ADI, for use with these functions.
+ */
+#define ADI_INTERNAL_SMART_PORT 22
+
+#ifdef __cplusplus
+extern "C" {
+namespace pros {
+namespace c {
+#endif
+
+/******************************************************************************/
+/**                         General ADI Use Functions                        **/
+/**                                                                          **/
+/**   These functions allow for interaction with any port type on any ADI    **/
+/******************************************************************************/
+
+/**
+ * Gets the configuration for the given port of an ADI, see
+ * adi_port_get_config().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port number (from 1-8, 'a'-'h', 'A'-'H') for which to return
+ *        the configuration
+ *
+ * \return The ADI configuration for the given port
+ */
+adi_port_config_e_t ext_adi_port_get_config(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets the value for the given port of an ADI, see adi_port_get_value().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port number (from 1-8, 'a'-'h', 'A'-'H') for which to return
+ *        the value
+ *
+ * \return The value stored for the given port
+ */
+int32_t ext_adi_port_get_value(uint8_t smart_port, uint8_t port);
+
+/**
+ * Configures a port of an ADI to act as a given sensor type, see
+ * adi_port_set_config().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port number (from 1-8, 'a'-'h', 'A'-'H') to configure
+ * \param type
+ *        The configuration type for the port
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_port_set_config(uint8_t smart_port, uint8_t port, adi_port_config_e_t type);
+
+/**
+ * Sets the value for the given port of an ADI, see adi_port_set_value().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port number (from 1-8, 'a'-'h', 'A'-'H') for which the value
+ *        will be set
+ * \param value
+ *        The value to set the ADI port to
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_port_set_value(uint8_t smart_port, uint8_t port, int32_t value);
+
+/**
+ * Reads the values of all of the ports of an ADI at once, taking the ADI
+ * only once, see adi_read_all().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - values is NULL
+ * ENXIO - The smart port is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param[out] values
+ *             The values of ports 1-8 ('a'-'h')
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_read_all(uint8_t smart_port, int32_t values[NUM_ADI_PORTS]);
+
+/******************************************************************************/
+/**                      PROS 2 Compatibility Functions                      **/
+/**                                                                          **/
+/**     The expander versions of the functions for the ADI's port types      **/
+/******************************************************************************/
+
+/**
+ * Calibrates an analog sensor on a port of an ADI, see adi_analog_calibrate().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to calibrate (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return The average sensor value computed by this function
+ */
+int32_t ext_adi_analog_calibrate(uint8_t smart_port, uint8_t port);
+
+/**
+ * Starts calibrating an analog sensor on a port of an ADI in the background,
+ * see adi_analog_calibrate_async().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to calibrate (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return 1 if the calibration was started or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_analog_calibrate_async(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets the status of the latest calibration of a port of an ADI, see
+ * adi_calibration_get_status().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return The status of the port's latest calibration
+ */
+adi_calibration_status_e_t ext_adi_calibration_get_status(uint8_t smart_port, uint8_t port);
+
+/**
+ * Waits for the calibration of a port of an ADI to finish, see
+ * adi_calibration_wait().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * EAGAIN - The calibration is running but the scheduler hasn't started
+ * ETIMEDOUT - The calibration didn't finish within the timeout
+ * EINVAL - The port has no finished calibration
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H')
+ * \param timeout
+ *        The longest to wait in milliseconds, or TIMEOUT_MAX to wait for as
+ *        long as it takes
+ *
+ * \return The calibration's result, as for adi_calibration_wait(), or
+ * PROS_ERR if the operation failed, setting errno.
+ */
+int32_t ext_adi_calibration_wait(uint8_t smart_port, uint8_t port, uint32_t timeout);
+
+/**
+ * Gets the 12-bit value of an analog input on a port of an ADI, see
+ * adi_analog_read().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H') for which the value will be
+ *        returned
+ *
+ * \return The analog sensor value, where a value of 0 reflects an input
+ * voltage of nearly 0 V and a value of 4095 reflects an input voltage of
+ * nearly 5 V
+ */
+int32_t ext_adi_analog_read(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets the 12-bit calibrated value of an analog input on a port of an ADI,
+ * see adi_analog_read_calibrated().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H') for which the value will be
+ *        returned
+ *
+ * \return The difference of the sensor value from its calibrated default from
+ * -4095 to 4095
+ */
+int32_t ext_adi_analog_read_calibrated(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets the 16-bit calibrated value of an analog input on a port of an ADI,
+ * see adi_analog_read_calibrated_HR().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as an analog input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port (from 1-8, 'a'-'h', 'A'-'H') for which the value will be
+ *        returned
+ *
+ * \return The difference of the sensor value from its calibrated default from
+ * -16384 to 16384
+ */
+int32_t ext_adi_analog_read_calibrated_HR(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets the digital value (1 or 0) of a digital input on a port of an ADI,
+ * see adi_digital_read().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a digital input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to read (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return True if the pin is HIGH, or false if it is LOW
+ */
+int32_t ext_adi_digital_read(uint8_t smart_port, uint8_t port);
+
+/**
+ * Gets a rising-edge case for a digital button press on a port of an ADI,
+ * see adi_digital_get_new_press().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a digital input
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to read (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return 1 if the button is pressed and had not been pressed
+ * the last time this function was called, 0 otherwise.
+ */
+int32_t ext_adi_digital_get_new_press(uint8_t smart_port, uint8_t port);
+
+/**
+ * Sets the digital value (1 or 0) of a digital output on a port of an ADI,
+ * see adi_digital_write().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a digital output
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to set (from 1-8, 'a'-'h', 'A'-'H')
+ * \param value
+ *        An expression evaluating to "true" or "false" to set the output to
+ *        HIGH or LOW respectively, or the constants HIGH or LOW themselves
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_digital_write(uint8_t smart_port, uint8_t port, const bool value);
+
+/**
+ * Sets several digital outputs of an ADI at once, see
+ * adi_digital_write_mask().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The smart port is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - A port in the mask is not configured as a digital output
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param mask
+ *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+ *        port 8 ('h')
+ * \param values
+ *        The values to set the ports to, with the same bits as mask
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_digital_write_mask(uint8_t smart_port, uint8_t mask, uint8_t values);
+
+/**
+ * Configures a port of an ADI as an input or output, see adi_pin_mode().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EINVAL - The mode is not one of those below
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to configure (from 1-8, 'a'-'h', 'A'-'H')
+ * \param mode
+ *        One of INPUT, INPUT_ANALOG, OUTPUT, or OUTPUT_ANALOG
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_pin_mode(uint8_t smart_port, uint8_t port, uint8_t mode);
+
+/**
+ * Sets the speed of the motor on a port of an ADI, see adi_motor_set().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a motor
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to set (from 1-8, 'a'-'h', 'A'-'H')
+ * \param speed
+ *        The new signed speed; -127 is full reverse and 127 is full forward,
+ *        with 0 being off
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_motor_set(uint8_t smart_port, uint8_t port, int8_t speed);
+
+/**
+ * Sets the speeds of several motors on an ADI at once, see
+ * adi_motor_set_mask().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - speeds is NULL
+ * ENXIO - The smart port is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - A port in the mask is not configured as a motor
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param mask
+ *        The ports to set, with bit 0 for port 1 ('a') through bit 7 for
+ *        port 8 ('h')
+ * \param speeds
+ *        The new signed speeds of ports 1-8 ('a'-'h')
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_motor_set_mask(uint8_t smart_port, uint8_t mask, const int8_t speeds[NUM_ADI_PORTS]);
+
+/**
+ * Gets the last set speed of the motor on a port of an ADI, see
+ * adi_motor_get().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a motor
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to get (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return The last set speed of the motor on the given port
+ */
+int32_t ext_adi_motor_get(uint8_t smart_port, uint8_t port);
+
+/**
+ * Stops the motor on a port of an ADI, see adi_motor_stop().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ * EADDRINUSE - The port is not configured as a motor
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to stop (from 1-8, 'a'-'h', 'A'-'H')
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t ext_adi_motor_stop(uint8_t smart_port, uint8_t port);
+
+/**
+ * Creates an encoder on two ports of an ADI, see adi_encoder_init().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Any of the given ports is out of range, or the ADI ports aren't
+ *         next to each other
+ * EINVAL - The ADI ports aren't a valid pair, e.g. 'B' and 'C'
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port_top
+ *        The "top" wire from the encoder sensor with the removable cover side
+ *        UP
+ * \param port_bottom
+ *        The "bottom" wire from the encoder sensor
+ * \param reverse
+ *        If "true", the sensor will count in the opposite direction
+ *
+ * \return An adi_encoder_t object to be used with the encoder functions in
+ * adi.h
+ */
+adi_encoder_t ext_adi_encoder_init(uint8_t smart_port, uint8_t port_top, uint8_t port_bottom, const bool reverse);
+
+/**
+ * Creates an ultrasonic on two ports of an ADI, see adi_ultrasonic_init().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Any of the given ports is out of range, or the ADI ports aren't
+ *         next to each other
+ * EINVAL - The ADI ports aren't a valid pair, or port_ping isn't the lower of the two
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port_ping
+ *        The port connected to the orange OUTPUT cable. This should be in port
+ *        1, 3, 5, or 7 ('A', 'C', 'E', 'G').
+ * \param port_echo
+ *        The port connected to the yellow INPUT cable. This should be in the
+ *        next highest port following port_ping.
+ *
+ * \return An adi_ultrasonic_t object to be used with the ultrasonic functions
+ * in adi.h
+ */
+adi_ultrasonic_t ext_adi_ultrasonic_init(uint8_t smart_port, uint8_t port_ping, uint8_t port_echo);
+
+/**
+ * Creates a gyro on a port of an ADI and waits for it to calibrate, see
+ * adi_gyro_init().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to initialize as a gyro (from 1-8, 'a'-'h', 'A'-'H')
+ * \param multiplier
+ *        A scalar value that will be multiplied by the gyro heading value
+ *        supplied by the ADI
+ *
+ * \return An adi_gyro_t object to be used with the gyro functions in adi.h
+ */
+adi_gyro_t ext_adi_gyro_init(uint8_t smart_port, uint8_t port, double multiplier);
+
+/**
+ * Creates a gyro on a port of an ADI without waiting for it to calibrate,
+ * see adi_gyro_init_async().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - Either of the given ports is out of range
+ * ENODEV - The smart port doesn't have an ADI expander in it
+ *
+ * \param smart_port
+ *        The smart port of the ADI (from 1-22, with 22 the brain's own)
+ * \param port
+ *        The ADI port to initialize as a gyro (from 1-8, 'a'-'h', 'A'-'H')
+ * \param multiplier
+ *        A scalar value that will be multiplied by the gyro heading value
+ *        supplied by the ADI
+ *
+ * \return An adi_gyro_t object to be used with the gyro functions in adi.h
+ */
+adi_gyro_t ext_adi_gyro_init_async(uint8_t smart_port, uint8_t port, double multiplier);
+
+#ifdef __cplusplus
+}  // namespace c
+}  // namespace pros
+}
+#endif
+
+#endif  // _PROS_EXT_ADI_H_
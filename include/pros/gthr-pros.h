@@ -0,0 +1,229 @@
+/**
+ * \file pros/gthr-pros.h
+ *
+ * The gthreads backend of libstdc++ for PROS
+ *
+ * libstdc++ builds std::thread, std::mutex, std::condition_variable and the
+ * rest of its threading support on top of the gthreads interface. The
+ * toolchain's libstdc++ is built single threaded, so common.mk puts pros/gthr
+ * ahead of the toolchain's headers, where bits/gthr-default.h includes this
+ * header in place of gthr-single.h, and defines _GLIBCXX_HAS_GTHREADS so the
+ * standard headers declare those classes. The parts of them which libstdc++
+ * keeps in the library are defined in system/cpp_support.cpp.
+ *
+ * - Threads are PROS tasks, created at the priority of the task starting them
+ * - Mutexes are hybrid mutexes, kept inside the mutex object and set up the
+ *   first time they're locked, so std::mutex stays constexpr constructible and
+ *   needs nothing done when it's destroyed
+ * - Condition variables are queues of waiting tasks woken by task
+ *   notifications, so a task shouldn't wait on one while it expects another
+ *   notification
+ * - Keys are kept per task behind one of its thread local storage pointers
+ *
+ * std::call_once, std::future and std::notify_all_at_thread_exit() need more
+ * of the library than this provides, and aren't supported.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_GTHR_PROS_H_
+#define _PROS_GTHR_PROS_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+
+#define __GTHREADS 1
+#define __GTHREADS_CXX0X 1
+#define __GTHREAD_HAS_COND 1
+#define _GTHREAD_USE_MUTEX_TIMEDLOCK 1
+
+// The most keys that may exist at once
+#define GTHREAD_KEYS_MAX 8
+// The words of storage a mutex has for its hybrid mutex, checked in rtos/gthread.c
+#define GTHREAD_MUTEX_WORDS 24
+
+typedef void* __gthread_t;
+typedef uint32_t __gthread_key_t;
+typedef struct {
+	volatile uint32_t state;
+} __gthread_once_t;
+typedef struct {
+	volatile uint32_t ready;
+	uint32_t storage[GTHREAD_MUTEX_WORDS];
+} __gthread_mutex_t;
+typedef struct {
+	__gthread_mutex_t mutex;
+	uint32_t count;
+} __gthread_recursive_mutex_t;
+typedef struct {
+	void* head;
+	void* tail;
+} __gthread_cond_t;
+typedef struct timespec __gthread_time_t;
+
+#define __GTHREAD_ONCE_INIT {0}
+#define __GTHREAD_MUTEX_INIT {0, {0}}
+#define __GTHREAD_RECURSIVE_MUTEX_INIT {__GTHREAD_MUTEX_INIT, 0}
+#define __GTHREAD_COND_INIT {0, 0}
+#define __GTHREAD_TIME_INIT {0, 0}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Implemented in rtos/gthread.c. The functions return 0 on success or an errno
+// value, and the timeouts are absolute times of gettimeofday(), i.e. of
+// std::chrono::system_clock, with NULL to wait forever
+int gthread_create(__gthread_t* thread, void* (*func)(void*), void* arg);
+int gthread_join(__gthread_t thread, void** value);
+int gthread_detach(__gthread_t thread);
+__gthread_t gthread_self(void);
+void gthread_yield(void);
+int gthread_once(__gthread_once_t* once, void (*func)(void));
+int gthread_key_create(__gthread_key_t* key, void (*dtor)(void*));
+int gthread_key_delete(__gthread_key_t key);
+void* gthread_getspecific(__gthread_key_t key);
+int gthread_setspecific(__gthread_key_t key, const void* value);
+int gthread_mutex_lock(__gthread_mutex_t* mutex, const __gthread_time_t* timeout);
+int gthread_mutex_trylock(__gthread_mutex_t* mutex);
+int gthread_mutex_unlock(__gthread_mutex_t* mutex);
+int gthread_recursive_mutex_lock(__gthread_recursive_mutex_t* mutex, const __gthread_time_t* timeout);
+int gthread_recursive_mutex_trylock(__gthread_recursive_mutex_t* mutex);
+int gthread_recursive_mutex_unlock(__gthread_recursive_mutex_t* mutex);
+int gthread_cond_wait(__gthread_cond_t* cond, __gthread_mutex_t* mutex, const __gthread_time_t* timeout);
+int gthread_cond_signal(__gthread_cond_t* cond);
+int gthread_cond_broadcast(__gthread_cond_t* cond);
+
+#ifdef __cplusplus
+}
+#endif
+
+static inline int __gthread_active_p(void) {
+	return 1;
+}
+
+static inline int __gthread_create(__gthread_t* thread, void* (*func)(void*), void* arg) {
+	return gthread_create(thread, func, arg);
+}
+
+static inline int __gthread_join(__gthread_t thread, void** value) {
+	return gthread_join(thread, value);
+}
+
+static inline int __gthread_detach(__gthread_t thread) {
+	return gthread_detach(thread);
+}
+
+static inline int __gthread_equal(__gthread_t t1, __gthread_t t2) {
+	return t1 == t2;
+}
+
+static inline __gthread_t __gthread_self(void) {
+	return gthread_self();
+}
+
+static inline int __gthread_yield(void) {
+	gthread_yield();
+	return 0;
+}
+
+static inline int __gthread_once(__gthread_once_t* once, void (*func)(void)) {
+	return gthread_once(once, func);
+}
+
+static inline int __gthread_key_create(__gthread_key_t* key, void (*dtor)(void*)) {
+	return gthread_key_create(key, dtor);
+}
+
+static inline int __gthread_key_delete(__gthread_key_t key) {
+	return gthread_key_delete(key);
+}
+
+static inline void* __gthread_getspecific(__gthread_key_t key) {
+	return gthread_getspecific(key);
+}
+
+static inline int __gthread_setspecific(__gthread_key_t key, const void* value) {
+	return gthread_setspecific(key, value);
+}
+
+static inline int __gthread_mutex_destroy(__gthread_mutex_t* mutex) {
+	(void)mutex;
+	return 0;
+}
+
+static inline int __gthread_mutex_lock(__gthread_mutex_t* mutex) {
+	return gthread_mutex_lock(mutex, 0);
+}
+
+static inline int __gthread_mutex_trylock(__gthread_mutex_t* mutex) {
+	return gthread_mutex_trylock(mutex);
+}
+
+static inline int __gthread_mutex_timedlock(__gthread_mutex_t* mutex, const __gthread_time_t* timeout) {
+	return gthread_mutex_lock(mutex, timeout);
+}
+
+static inline int __gthread_mutex_unlock(__gthread_mutex_t* mutex) {
+	return gthread_mutex_unlock(mutex);
+}
+
+static inline int __gthread_recursive_mutex_destroy(__gthread_recursive_mutex_t* mutex) {
+	(void)mutex;
+	return 0;
+}
+
+static inline int __gthread_recursive_mutex_lock(__gthread_recursive_mutex_t* mutex) {
+	return gthread_recursive_mutex_lock(mutex, 0);
+}
+
+static inline int __gthread_recursive_mutex_trylock(__gthread_recursive_mutex_t* mutex) {
+	return gthread_recursive_mutex_trylock(mutex);
+}
+
+static inline int __gthread_recursive_mutex_timedlock(__gthread_recursive_mutex_t* mutex,
+                                                      const __gthread_time_t* timeout) {
+	return gthread_recursive_mutex_lock(mutex, timeout);
+}
+
+static inline int __gthread_recursive_mutex_unlock(__gthread_recursive_mutex_t* mutex) {
+	return gthread_recursive_mutex_unlock(mutex);
+}
+
+static inline int __gthread_cond_destroy(__gthread_cond_t* cond) {
+	(void)cond;
+	return 0;
+}
+
+static inline int __gthread_cond_wait(__gthread_cond_t* cond, __gthread_mutex_t* mutex) {
+	return gthread_cond_wait(cond, mutex, 0);
+}
+
+static inline int __gthread_cond_timedwait(__gthread_cond_t* cond, __gthread_mutex_t* mutex,
+                                           const __gthread_time_t* timeout) {
+	return gthread_cond_wait(cond, mutex, timeout);
+}
+
+static inline int __gthread_cond_wait_recursive(__gthread_cond_t* cond, __gthread_recursive_mutex_t* mutex) {
+	// The hybrid mutex is given up and taken back, and the count is left alone
+	return gthread_cond_wait(cond, &mutex->mutex, 0);
+}
+
+static inline int __gthread_cond_signal(__gthread_cond_t* cond) {
+	return gthread_cond_signal(cond);
+}
+
+static inline int __gthread_cond_broadcast(__gthread_cond_t* cond) {
+	return gthread_cond_broadcast(cond);
+}
+
+#endif  // _PROS_GTHR_PROS_H_
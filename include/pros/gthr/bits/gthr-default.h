@@ -0,0 +1,15 @@
+/**
+ * \file pros/gthr/bits/gthr-default.h
+ *
+ * Found by libstdc++'s bits/gthr.h ahead of the toolchain's own gthr-default.h,
+ * see pros/gthr-pros.h
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "pros/gthr-pros.h"
@@ -74,6 +74,52 @@ typedef struct __attribute__((__packed__)) euler_s {
  */
 int32_t imu_reset(uint8_t port);
 
+/**
+ * Starts calibrating the IMU without waiting for it, so that several sensors
+ * and ADI calibrations can run at once while initialization carries on.
+ *
+ * This is the same as imu_reset(); either one lets imu_wait_calibrated() tell
+ * when the calibration is done.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as an Inertial Sensor
+ * EAGAIN - The sensor is already calibrating
+ *
+ * \param port
+ *        The V5 Inertial Sensor port number from 1-21
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_reset_async(uint8_t port);
+
+/**
+ * Blocks until every IMU in the mask has finished the calibration started by
+ * imu_reset() or imu_reset_async().
+ *
+ * The system daemon wakes the task once it sees each sensor's calibrating
+ * status clear, so the task doesn't poll imu_get_status(). A port which isn't
+ * being calibrated counts as done straight away. At most
+ * EVENT_GROUP_MAX_WAITERS tasks can wait at once; any more time out.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The mask is empty or has bits above port 22
+ * EAGAIN - The scheduler isn't running yet
+ * ETIMEDOUT - A sensor was still calibrating when the timeout ran out
+ * ENODEV - A port in the mask isn't an Inertial Sensor, e.g. it was unplugged
+ *
+ * \param port_mask
+ *        The ports to wait for, with bit (port - 1) set for each
+ * \param timeout
+ *        Time to wait in milliseconds. TIMEOUT_MAX can be used to block
+ *        indefinitely.
+ * \return 1 once every sensor is calibrated or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_wait_calibrated(uint32_t port_mask, uint32_t timeout);
+
 /**
  * Get the total number of degrees the Inertial Sensor has spun about the z-axis
  *
@@ -243,6 +289,215 @@ imu_accel_s_t imu_get_accel(uint8_t port);
  */
 imu_status_e_t imu_get_status(uint8_t port);
 
+/**
+ * Holds all of the Inertial Sensor's readings from the same update.
+ */
+typedef struct imu_state_s {
+	double rotation;            // The total number of degrees turned about the z-axis, like imu_get_rotation()
+	double heading;             // The heading from 0 to 360 degrees, like imu_get_heading()
+	quaternion_s_t quaternion;  // The orientation, like imu_get_quaternion()
+	euler_s_t euler;            // The orientation as Euler angles, like imu_get_euler()
+	imu_gyro_s_t gyro_rate;     // The raw gyroscope values, like imu_get_gyro_rate()
+	imu_accel_s_t accel;        // The raw accelerometer values, like imu_get_accel()
+	uint32_t timestamp;         // The time in ms the sensor sent these readings
+	uint32_t updated_us;        // The micros() time the daemon first saw them, see vdml_get_last_update()
+	uint8_t port;               // The V5 port number from 1-21
+} imu_state_s_t;
+
+/**
+ * Gets all of the Inertial Sensor's readings at once.
+ *
+ * This is equivalent to calling each of the getters, but only claims the
+ * sensor's port and checks whether it's calibrating once. Since nothing else
+ * runs in between, the readings all come from the same update.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as an Inertial Sensor
+ * EAGAIN - The sensor is still calibrating
+ * EINVAL - state is NULL
+ *
+ * \param  port
+ * 				 The V5 Inertial Sensor port number from 1-21
+ * \param[out] state
+ *             The struct to fill with the sensor's readings
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_get_state(uint8_t port, imu_state_s_t* const state);
+
+/**
+ * The number of samples the Inertial Sensor buffer holds.
+ */
+#define IMU_BUFFER_SIZE 64
+
+/**
+ * Starts recording every update of the given Inertial Sensors.
+ *
+ * The system daemon appends the full state of each selected sensor to a
+ * buffer whenever the sensor has sent new readings, so none of them are
+ * missed however slowly they are read. Calling this function again replaces
+ * the selection; a port mask of 0 stops recording.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The mask selects ports outside of 1-21
+ *
+ * \param port_mask
+ *        A bitmap of the ports to record, where bit 0 is port 1
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_buffer_enable(uint32_t port_mask);
+
+/**
+ * Removes the oldest samples from the Inertial Sensor buffer.
+ *
+ * Only one task should read the buffer. If the buffer is full, new samples
+ * are dropped until it is read; see imu_buffer_get_dropped().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - buffer is NULL
+ *
+ * \param[out] buffer
+ *             The array to copy the samples into
+ * \param count
+ *        The maximum number of samples to copy
+ *
+ * \return The number of samples copied or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t imu_buffer_read(imu_state_s_t* const buffer, uint32_t count);
+
+/**
+ * Gets the number of samples dropped because the Inertial Sensor buffer was
+ * full.
+ *
+ * \return The number of samples dropped since recording was enabled
+ */
+uint32_t imu_buffer_get_dropped(void);
+
+/******************************************************************************/
+/**                            Inertial Sensor groups                        **/
+/**                                                                          **/
+/**   The system daemon fuses the turn rates of several Inertial Sensors     **/
+/**   into one heading, every cycle                                          **/
+/******************************************************************************/
+
+/**
+ * The most Inertial Sensors an IMU group can fuse.
+ */
+#define IMU_GROUP_MAX_SENSORS 4
+
+/**
+ * A sensor whose turn rate differs from the group's median by more than this
+ * many degrees per second is left out of the fused rate until it agrees again.
+ */
+#define IMU_GROUP_OUTLIER_RATE 10.0
+
+/**
+ * While the group's median turn rate is below this many degrees per second the
+ * robot is taken to be still, and each sensor's remaining drift is learned and
+ * taken off its rate from then on.
+ */
+#define IMU_GROUP_STILL_RATE 0.5
+
+/**
+ * An IMU group handle, from imu_group_create().
+ */
+typedef void* imu_group_t;
+
+/**
+ * An IMU group's fused readings, published by the system daemon every cycle.
+ */
+typedef struct imu_group_state_s {
+	double rotation;      // The fused total rotation about the z-axis in degrees, like imu_get_rotation()
+	double heading;       // The rotation wrapped to 0 to 360 degrees
+	double rate;          // The fused turn rate in degrees per second
+	uint32_t timestamp;   // The millis() time of the update
+	uint32_t updated_us;  // The micros() time of the update
+	uint8_t sensors;      // The number of sensors fused in the update
+	uint8_t rejected;     // A bitmask of the sensors, by index in the group, rejected as outliers
+} imu_group_state_s_t;
+
+/**
+ * Creates a group of Inertial Sensors whose readings the system daemon fuses.
+ *
+ * Each cycle, the daemon works out every sensor's turn rate from the change in
+ * its rotation between the sensor's updates, takes off the drift it has learned
+ * for the sensor while the robot was still, and averages the rates which agree
+ * with the median to within IMU_GROUP_OUTLIER_RATE. The fused rate is then
+ * integrated every cycle, so the sensors' updates don't need to line up.
+ * Sensors which are unplugged or calibrating are left out until they're back.
+ *
+ * The fused rotation starts at 0, see imu_group_set_rotation().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - ports is NULL, count is 0 or more than IMU_GROUP_MAX_SENSORS, or a
+ * port is given twice
+ * ENXIO - A port is not within the range of V5 ports (1-21)
+ * ENOMEM - There was not enough memory for the group
+ *
+ * \param ports
+ *        The V5 port numbers of the sensors, from 1-21
+ * \param count
+ *        The number of ports
+ *
+ * \return The group, or NULL upon failure
+ */
+imu_group_t imu_group_create(const uint8_t* ports, uint8_t count);
+
+/**
+ * Gets an IMU group's latest fused readings.
+ *
+ * This doesn't take any of the sensors' ports, so it never blocks.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - group or state is NULL
+ * EAGAIN - None of the sensors has given two readings yet
+ *
+ * \param group
+ *        The IMU group
+ * \param[out] state
+ *             The readings to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_group_get_state(imu_group_t group, imu_group_state_s_t* const state);
+
+/**
+ * Sets an IMU group's fused rotation, e.g. to the robot's starting heading.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - group is NULL
+ *
+ * \param group
+ *        The IMU group
+ * \param rotation
+ *        The new rotation in degrees
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t imu_group_set_rotation(imu_group_t group, double rotation);
+
+/**
+ * Stops fusing an IMU group's sensors and frees it. No task may be reading the
+ * group while it is deleted.
+ *
+ * \param group
+ *        The IMU group
+ */
+void imu_group_delete(imu_group_t group);
+
 // NOTE: not used
 // void imu_set_mode(uint8_t port, uint32_t mode);
 // uint32_t imu_get_mode(uint8_t port);
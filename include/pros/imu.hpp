@@ -45,6 +45,23 @@ class Imu {
 	 * failed, setting errno.
 	 */
 	virtual std::int32_t reset() const;
+	/**
+	 * Blocks until the calibration started by reset() is done, without polling
+	 * get_status()
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EAGAIN - The scheduler isn't running yet
+	 * ETIMEDOUT - The sensor was still calibrating when the timeout ran out
+	 * ENODEV - The port isn't an Inertial Sensor, e.g. it was unplugged
+	 *
+	 * \param timeout
+	 *        Time to wait in milliseconds. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 * \return 1 once the sensor is calibrated or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t wait_calibrated(std::uint32_t timeout) const;
 	/**
 	 * Get the total number of degrees the Inertial Sensor has spun about the z-axis
 	 *
@@ -211,6 +228,40 @@ class Imu {
 	 * false if it is not.
 	 */
 	virtual bool is_calibrating() const;
+	/**
+	 * Get all of the Inertial Sensor's readings from the same update at once.
+	 * See pros::c::imu_get_state().
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - The given value is not within the range of V5 ports (1-21).
+	 * ENODEV - The port cannot be configured as an Inertial Sensor
+	 * EAGAIN - The sensor is still calibrating
+	 *
+	 * \param[out] state
+	 *             The struct to fill with the sensor's readings
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t get_state(pros::c::imu_state_s_t* const state) const;
+};
+
+/**
+ * An Imu whose port is fixed at compile time. The port is checked with a
+ * static_assert, so a miswired port number is a compile error rather than an
+ * ENXIO at runtime.
+ *
+ * \tparam Port
+ *         The V5 port number from 1-21
+ */
+template <std::uint8_t Port>
+class StaticImu : public Imu {
+	static_assert(Port >= 1 && Port <= 21, "V5 ports must be between 1 and 21");
+
+	public:
+	StaticImu() : Imu(Port) {}
+
+	static constexpr std::uint8_t port = Port;
 };
 }  // namespace pros
 
@@ -0,0 +1,121 @@
+/**
+ * \file pros/lazy.hpp
+ *
+ * Contains pros::Lazy, a global which is built the first time it's used.
+ *
+ * Every global with a constructor is built before initialize() runs, one after
+ * another, so a big lookup table or a std::vector filled at startup holds up
+ * the whole program. Wrapping it in a pros::Lazy moves that work to whichever
+ * task first uses it, e.g.
+ *
+ * pros::Lazy<std::vector<float>> profile([] { return build_profile(); });
+ * ...
+ * float speed = (*profile)[i];
+ *
+ * A Lazy's own constructor is constexpr, so a global one takes no time at
+ * startup at all. The kernel logs the slowest global constructor at boot to
+ * help find which globals are worth making lazy.
+ *
+ * The value is built exactly once even if several tasks use it at the same
+ * time, and the others wait until it's built. It is never destroyed, like any
+ * other global on the brain.
+ *
+ * This header is not included by api.h, so include it directly.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_LAZY_HPP_
+#define _PROS_LAZY_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include "pros/rtos.hpp"
+
+namespace pros {
+/**
+ * A T which is built on first use, either with T's default constructor or
+ * from what a factory function returns.
+ */
+template <typename T>
+class Lazy {
+	public:
+	/**
+	 * Creates a Lazy which builds its value with T's default constructor.
+	 */
+	constexpr Lazy() noexcept : factory(nullptr) {}
+
+	/**
+	 * Creates a Lazy which builds its value from what factory returns. A lambda
+	 * which captures nothing converts to the function pointer.
+	 *
+	 * \param factory
+	 *        The function to build the value with
+	 */
+	constexpr explicit Lazy(T (*factory)()) noexcept : factory(factory) {}
+
+	Lazy(const Lazy&) = delete;
+	Lazy& operator=(const Lazy&) = delete;
+
+	/**
+	 * Gets the value, building it first if this is its first use.
+	 *
+	 * \return The value
+	 */
+	T& get() {
+		if (state.load(std::memory_order_acquire) != READY) build();
+		return *std::launder(reinterpret_cast<T*>(storage));
+	}
+
+	T& operator*() {
+		return get();
+	}
+
+	T* operator->() {
+		return &get();
+	}
+
+	/**
+	 * Checks whether the value has been built, without building it.
+	 *
+	 * \return True if the value has been built
+	 */
+	bool is_built() const {
+		return state.load(std::memory_order_acquire) == READY;
+	}
+
+	private:
+	enum : std::uint8_t { UNBUILT, BUILDING, READY };
+
+	void build() {
+		std::uint8_t expected = UNBUILT;
+		if (state.compare_exchange_strong(expected, BUILDING, std::memory_order_acquire)) {
+			if (factory != nullptr) {
+				new (storage) T(factory());
+			} else {
+				new (storage) T();
+			}
+			state.store(READY, std::memory_order_release);
+			return;
+		}
+		// Another task is building the value
+		while (state.load(std::memory_order_acquire) != READY) c::task_delay(1);
+	}
+
+	T (*const factory)();
+	std::atomic<std::uint8_t> state{UNBUILT};
+	alignas(T) unsigned char storage[sizeof(T)]{};
+};
+}  // namespace pros
+
+#endif  // _PROS_LAZY_HPP_
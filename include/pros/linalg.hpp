@@ -0,0 +1,538 @@
+/**
+ * \file pros/linalg.hpp
+ *
+ * Contains fixed size matrices and an extended Kalman filter for sensor fusion.
+ *
+ * Filters for a robot's heading and pose work with matrices of 3x3 to 6x6
+ * every few milliseconds. Here the sizes are template arguments, so a matrix is
+ * a plain array on the stack, every loop has a fixed trip count, and nothing
+ * touches the heap. Each row is padded to a multiple of four floats and aligned
+ * for NEON, so multiplying matrices works through four columns at a time.
+ *
+ * pros::linalg::Ekf is a generic extended Kalman filter, where the caller works
+ * out the model's prediction and Jacobians. pros::linalg::PoseFilter builds on
+ * it to fuse the kernel's odometry with position and heading fixes, e.g.
+ *
+ * pros::linalg::PoseFilter filter(0.01f, 0.001f);
+ * while (true) {
+ *   odom_pose_s_t pose;
+ *   if (odom_get_pose(&pose) == 1) filter.predict(pose);
+ *   if (saw_wall) filter.update_position(wall_x, wall_y, 0.25f);
+ *   odom_pose_s_t fused = filter.pose();
+ *   ...
+ * }
+ *
+ * This header is not included by api.h, so include it directly.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_LINALG_HPP_
+#define _PROS_LINALG_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "pros/imu.h"
+#include "pros/odometry.h"
+
+namespace pros {
+namespace linalg {
+/**
+ * An R by C matrix of floats, stored by rows. Rows of more than one column are
+ * padded to a multiple of four floats, and the padding isn't part of the value.
+ */
+template <std::size_t R, std::size_t C>
+class Matrix {
+	static_assert(R > 0 && C > 0, "Invalid pros::linalg::Matrix size");
+
+	public:
+	static constexpr std::size_t rows = R;
+	static constexpr std::size_t cols = C;
+	// floats from the start of one row to the next
+	static constexpr std::size_t stride = C == 1 ? 1 : (C + 3) & ~static_cast<std::size_t>(3);
+
+	/**
+	 * Creates a matrix of zeros.
+	 */
+	constexpr Matrix() noexcept : m{} {}
+
+	/**
+	 * Creates a matrix from its values, row by row, e.g.
+	 * Matrix<2, 2>{1, 2,
+	 *              3, 4}
+	 * Values left out are 0.
+	 */
+	constexpr Matrix(std::initializer_list<float> values) noexcept : m{} {
+		std::size_t i = 0;
+		for (float const value : values) {
+			if (i == R * C) break;
+			m[i / C * stride + i % C] = value;
+			i++;
+		}
+	}
+
+	static constexpr Matrix identity() noexcept {
+		static_assert(R == C, "Only square matrices have an identity");
+		Matrix out;
+		for (std::size_t i = 0; i < R; i++) out(i, i) = 1;
+		return out;
+	}
+
+	constexpr float& operator()(std::size_t r, std::size_t c) noexcept {
+		return m[r * stride + c];
+	}
+
+	constexpr float operator()(std::size_t r, std::size_t c) const noexcept {
+		return m[r * stride + c];
+	}
+
+	/**
+	 * Gets an element of a vector (a matrix of one column).
+	 */
+	constexpr float& operator[](std::size_t i) noexcept {
+		static_assert(C == 1, "Only vectors can be indexed by one number");
+		return m[i];
+	}
+
+	constexpr float operator[](std::size_t i) const noexcept {
+		static_assert(C == 1, "Only vectors can be indexed by one number");
+		return m[i];
+	}
+
+	float* row(std::size_t r) noexcept {
+		return &m[r * stride];
+	}
+
+	const float* row(std::size_t r) const noexcept {
+		return &m[r * stride];
+	}
+
+	constexpr Matrix& operator+=(const Matrix& other) noexcept {
+		for (std::size_t i = 0; i < R * stride; i++) m[i] += other.m[i];
+		return *this;
+	}
+
+	constexpr Matrix& operator-=(const Matrix& other) noexcept {
+		for (std::size_t i = 0; i < R * stride; i++) m[i] -= other.m[i];
+		return *this;
+	}
+
+	constexpr Matrix& operator*=(float scale) noexcept {
+		for (std::size_t i = 0; i < R * stride; i++) m[i] *= scale;
+		return *this;
+	}
+
+	private:
+	alignas(16) float m[R * stride];
+};
+
+/**
+ * A column vector of N floats.
+ */
+template <std::size_t N>
+using Vector = Matrix<N, 1>;
+
+template <std::size_t R, std::size_t C>
+constexpr Matrix<R, C> operator+(Matrix<R, C> a, const Matrix<R, C>& b) noexcept {
+	return a += b;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr Matrix<R, C> operator-(Matrix<R, C> a, const Matrix<R, C>& b) noexcept {
+	return a -= b;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr Matrix<R, C> operator*(Matrix<R, C> a, float scale) noexcept {
+	return a *= scale;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr Matrix<R, C> operator*(float scale, Matrix<R, C> a) noexcept {
+	return a *= scale;
+}
+
+/**
+ * Multiplies an R by K matrix by a K by C one.
+ */
+template <std::size_t R, std::size_t K, std::size_t C>
+Matrix<R, C> operator*(const Matrix<R, K>& a, const Matrix<K, C>& b) noexcept {
+	Matrix<R, C> out;
+#ifdef __ARM_NEON
+	if constexpr (Matrix<K, C>::stride % 4 == 0) {
+		// Each row of the result is a sum of b's rows, scaled by a's row
+		constexpr std::size_t quads = Matrix<K, C>::stride / 4;
+		for (std::size_t i = 0; i < R; i++) {
+			float32x4_t acc[quads];
+#pragma GCC unroll 2
+			for (std::size_t q = 0; q < quads; q++) acc[q] = vdupq_n_f32(0);
+#pragma GCC unroll 8
+			for (std::size_t k = 0; k < K; k++) {
+				float const scale = a(i, k);
+				const float* const b_row = b.row(k);
+#pragma GCC unroll 2
+				for (std::size_t q = 0; q < quads; q++) acc[q] = vmlaq_n_f32(acc[q], vld1q_f32(b_row + 4 * q), scale);
+			}
+			float* const out_row = out.row(i);
+#pragma GCC unroll 2
+			for (std::size_t q = 0; q < quads; q++) vst1q_f32(out_row + 4 * q, acc[q]);
+		}
+		return out;
+	}
+#endif
+	for (std::size_t i = 0; i < R; i++) {
+		for (std::size_t j = 0; j < C; j++) {
+			float sum = 0;
+#pragma GCC unroll 8
+			for (std::size_t k = 0; k < K; k++) sum += a(i, k) * b(k, j);
+			out(i, j) = sum;
+		}
+	}
+	return out;
+}
+
+template <std::size_t R, std::size_t C>
+constexpr Matrix<C, R> transpose(const Matrix<R, C>& a) noexcept {
+	Matrix<C, R> out;
+	for (std::size_t i = 0; i < R; i++) {
+		for (std::size_t j = 0; j < C; j++) out(j, i) = a(i, j);
+	}
+	return out;
+}
+
+template <std::size_t N>
+constexpr float dot(const Vector<N>& a, const Vector<N>& b) noexcept {
+	float sum = 0;
+	for (std::size_t i = 0; i < N; i++) sum += a[i] * b[i];
+	return sum;
+}
+
+template <std::size_t N>
+float norm(const Vector<N>& a) noexcept {
+	return std::sqrt(dot(a, a));
+}
+
+/**
+ * Inverts a square matrix. Matrices of up to 3x3 use the closed forms, and
+ * larger ones Gauss-Jordan elimination with partial pivoting.
+ *
+ * \param a
+ *        The matrix to invert
+ * \param[out] out
+ *             The inverse, left alone if a is singular
+ *
+ * \return False if a is singular (or too close to it to invert in floats)
+ */
+template <std::size_t N>
+bool inverse(const Matrix<N, N>& a, Matrix<N, N>* out) noexcept {
+	constexpr float epsilon = 1e-12f;
+	if constexpr (N == 1) {
+		if (std::fabs(a(0, 0)) < epsilon) return false;
+		(*out)(0, 0) = 1 / a(0, 0);
+		return true;
+	} else if constexpr (N == 2) {
+		float const det = a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+		if (std::fabs(det) < epsilon) return false;
+		float const inv = 1 / det;
+		*out = Matrix<2, 2>{a(1, 1) * inv, -a(0, 1) * inv, -a(1, 0) * inv, a(0, 0) * inv};
+		return true;
+	} else if constexpr (N == 3) {
+		float const c00 = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+		float const c01 = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+		float const c02 = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+		float const det = a(0, 0) * c00 + a(0, 1) * c01 + a(0, 2) * c02;
+		if (std::fabs(det) < epsilon) return false;
+		float const inv = 1 / det;
+		*out = Matrix<3, 3>{c00 * inv,
+		                    (a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2)) * inv,
+		                    (a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1)) * inv,
+		                    c01 * inv,
+		                    (a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0)) * inv,
+		                    (a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2)) * inv,
+		                    c02 * inv,
+		                    (a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1)) * inv,
+		                    (a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0)) * inv};
+		return true;
+	} else {
+		Matrix<N, N> left = a;
+		Matrix<N, N> right = Matrix<N, N>::identity();
+		for (std::size_t col = 0; col < N; col++) {
+			std::size_t pivot = col;
+			for (std::size_t r = col + 1; r < N; r++) {
+				if (std::fabs(left(r, col)) > std::fabs(left(pivot, col))) pivot = r;
+			}
+			if (std::fabs(left(pivot, col)) < epsilon) return false;
+			if (pivot != col) {
+				for (std::size_t c = 0; c < N; c++) {
+					float t = left(col, c);
+					left(col, c) = left(pivot, c);
+					left(pivot, c) = t;
+					t = right(col, c);
+					right(col, c) = right(pivot, c);
+					right(pivot, c) = t;
+				}
+			}
+			float const inv = 1 / left(col, col);
+			for (std::size_t c = 0; c < N; c++) {
+				left(col, c) *= inv;
+				right(col, c) *= inv;
+			}
+			for (std::size_t r = 0; r < N; r++) {
+				if (r == col) continue;
+				float const factor = left(r, col);
+				if (factor == 0) continue;
+				for (std::size_t c = 0; c < N; c++) {
+					left(r, c) -= factor * left(col, c);
+					right(r, c) -= factor * right(col, c);
+				}
+			}
+		}
+		*out = right;
+		return true;
+	}
+}
+
+/**
+ * An extended Kalman filter over a state of N floats.
+ *
+ * The model stays with the caller: each step it works out the predicted state
+ * and the Jacobian of its motion model, and for each measurement the
+ * difference from what the state predicts (the innovation) and the Jacobian of
+ * its measurement model. Innovations of angles should be wrapped into
+ * [-pi, pi] by the caller.
+ */
+template <std::size_t N>
+class Ekf {
+	public:
+	/**
+	 * Creates a filter with a state of zeros.
+	 *
+	 * \param variance
+	 *        The variance of each element of the starting state
+	 */
+	constexpr explicit Ekf(float variance = 1.0f) noexcept : x(), P(Matrix<N, N>::identity() * variance) {}
+
+	/**
+	 * Moves the filter to its prediction of the next state.
+	 *
+	 * \param predicted
+	 *        The state the motion model predicts from state()
+	 * \param F
+	 *        The Jacobian of the motion model at state()
+	 * \param Q
+	 *        The covariance of the noise the step adds
+	 */
+	void predict(const Vector<N>& predicted, const Matrix<N, N>& F, const Matrix<N, N>& Q) noexcept {
+		x = predicted;
+		P = F * P * transpose(F) + Q;
+	}
+
+	/**
+	 * Corrects the state with a measurement of M values.
+	 *
+	 * \param innovation
+	 *        The measurement minus the measurement model's prediction of it from
+	 *        state()
+	 * \param H
+	 *        The Jacobian of the measurement model at state()
+	 * \param R
+	 *        The covariance of the measurement's noise
+	 *
+	 * \return False if the measurement couldn't be used, which leaves the filter
+	 * as it was
+	 */
+	template <std::size_t M>
+	bool update(const Vector<M>& innovation, const Matrix<M, N>& H, const Matrix<M, M>& R) noexcept {
+		Matrix<N, M> const PHt = P * transpose(H);
+		Matrix<M, M> S_inv;
+		if (!inverse(H * PHt + R, &S_inv)) return false;
+		Matrix<N, M> const K = PHt * S_inv;
+		x += K * innovation;
+		P -= K * (H * P);
+		// Keep the covariance symmetric against rounding
+		P = (P + transpose(P)) * 0.5f;
+		return true;
+	}
+
+	const Vector<N>& state() const noexcept {
+		return x;
+	}
+
+	const Matrix<N, N>& covariance() const noexcept {
+		return P;
+	}
+
+	/**
+	 * Sets the state, e.g. when the robot is placed at a known position.
+	 *
+	 * \param state
+	 *        The new state
+	 * \param variance
+	 *        The variance of each element of the new state
+	 */
+	void reset(const Vector<N>& state, float variance) noexcept {
+		x = state;
+		P = Matrix<N, N>::identity() * variance;
+	}
+
+	private:
+	Vector<N> x;
+	Matrix<N, N> P;
+};
+
+/**
+ * Fuses the kernel's odometry with fixes of the robot's position and heading,
+ * e.g. from distance sensors against the field walls or a GPS sensor.
+ *
+ * The state is x, y and the heading in radians, in the odometry's frame. The
+ * odometry's motion since the last predict() is turned into the robot's own
+ * frame and applied at the filtered heading, so drift corrected by a fix stays
+ * corrected.
+ */
+class PoseFilter {
+	public:
+	/**
+	 * Creates the filter.
+	 *
+	 * \param distance_variance
+	 *        The variance in position added per unit the robot travels
+	 * \param heading_variance
+	 *        The variance in heading, in radians squared, added per radian the
+	 *        robot turns
+	 */
+	PoseFilter(float distance_variance, float heading_variance) noexcept
+	    : ekf(0), distance_variance(distance_variance), heading_variance(heading_variance), last(), started(false) {}
+
+	/**
+	 * Moves the filter by the odometry's motion since the last call. The first
+	 * call starts the filter at the odometry's pose.
+	 *
+	 * \param odom
+	 *        The odometry's latest pose, from odom_get_pose() or TOPIC_ODOM
+	 */
+	void predict(const c::odom_pose_s_t& odom) noexcept {
+		constexpr float deg_to_rad = 0.0174532925f;
+		if (!started) {
+			ekf.reset(Vector<3>{static_cast<float>(odom.x), static_cast<float>(odom.y),
+			                    static_cast<float>(odom.theta) * deg_to_rad},
+			          0);
+			last = odom;
+			started = true;
+			return;
+		}
+		// The odometry moves its pose by forward * (sin, cos) + sideways * (cos, -sin)
+		float const last_theta = static_cast<float>(last.theta) * deg_to_rad;
+		float const dx = static_cast<float>(odom.x - last.x);
+		float const dy = static_cast<float>(odom.y - last.y);
+		float const forward = dx * std::sin(last_theta) + dy * std::cos(last_theta);
+		float const sideways = dx * std::cos(last_theta) - dy * std::sin(last_theta);
+		float const d_theta = static_cast<float>(odom.theta - last.theta) * deg_to_rad;
+		last = odom;
+
+		const Vector<3>& x = ekf.state();
+		float const s = std::sin(x[2]);
+		float const c = std::cos(x[2]);
+		Vector<3> const predicted{x[0] + forward * s + sideways * c, x[1] + forward * c - sideways * s, x[2] + d_theta};
+		Matrix<3, 3> F = Matrix<3, 3>::identity();
+		F(0, 2) = forward * c - sideways * s;
+		F(1, 2) = -forward * s - sideways * c;
+		Matrix<3, 3> Q;
+		float const distance = std::sqrt(forward * forward + sideways * sideways);
+		Q(0, 0) = Q(1, 1) = distance_variance * distance;
+		Q(2, 2) = heading_variance * std::fabs(d_theta);
+		ekf.predict(predicted, F, Q);
+	}
+
+	/**
+	 * Corrects the filter with a fix of the robot's position.
+	 *
+	 * \param x
+	 *        The measured x coordinate
+	 * \param y
+	 *        The measured y coordinate
+	 * \param variance
+	 *        The variance of the fix in each axis
+	 *
+	 * \return False if the fix couldn't be used
+	 */
+	bool update_position(float x, float y, float variance) noexcept {
+		const Vector<3>& state = ekf.state();
+		return ekf.update(Vector<2>{x - state[0], y - state[1]}, Matrix<2, 3>{1, 0, 0, 0, 1, 0},
+		                  Matrix<2, 2>::identity() * variance);
+	}
+
+	/**
+	 * Corrects the filter with a fix of the robot's heading.
+	 *
+	 * \param theta
+	 *        The measured heading in degrees, increasing clockwise like the
+	 *        odometry's
+	 * \param variance
+	 *        The variance of the fix in radians squared
+	 *
+	 * \return False if the fix couldn't be used
+	 */
+	bool update_heading(float theta, float variance) noexcept {
+		constexpr float deg_to_rad = 0.0174532925f;
+		constexpr float pi = 3.14159265358979f;
+		float innovation = std::remainder(theta * deg_to_rad - ekf.state()[2], 2 * pi);
+		return ekf.update(Vector<1>{innovation}, Matrix<1, 3>{0, 0, 1}, Matrix<1, 1>{variance});
+	}
+
+	/**
+	 * Corrects the filter with an Inertial Sensor's rotation, e.g. one the
+	 * odometry isn't already using.
+	 *
+	 * \param imu
+	 *        The sensor's readings, from imu_get_state() or TOPIC_IMUS
+	 * \param offset
+	 *        The robot's heading in degrees when the sensor's rotation was 0
+	 * \param variance
+	 *        The variance of the sensor's heading in radians squared
+	 *
+	 * \return False if the fix couldn't be used
+	 */
+	bool update_heading(const c::imu_state_s_t& imu, float offset, float variance) noexcept {
+		return update_heading(static_cast<float>(imu.rotation) + offset, variance);
+	}
+
+	/**
+	 * Gets the filtered pose, with the heading in degrees and the timestamp of
+	 * the odometry pose last given to predict().
+	 */
+	c::odom_pose_s_t pose() const noexcept {
+		constexpr float rad_to_deg = 57.2957795f;
+		const Vector<3>& x = ekf.state();
+		return c::odom_pose_s_t{x[0], x[1], x[2] * rad_to_deg, last.timestamp};
+	}
+
+	const Ekf<3>& filter() const noexcept {
+		return ekf;
+	}
+
+	private:
+	Ekf<3> ekf;
+	float distance_variance;
+	float heading_variance;
+	c::odom_pose_s_t last;
+	bool started;
+};
+}  // namespace linalg
+}  // namespace pros
+
+#endif  // _PROS_LINALG_HPP_
@@ -43,6 +43,8 @@ typedef void (*lcd_btn_cb_fn_t)(void);
 #define LCD_BTN_CENTER 2
 #define LCD_BTN_RIGHT 1
 
+#define LCD_LINE_LENGTH 32
+
 typedef struct lcd_s {
 	lv_obj_t* frame;
 	lv_obj_t* screen;
@@ -52,6 +54,7 @@ typedef struct lcd_s {
 	lcd_btn_cb_fn_t callbacks[3];  // < 0 => left; 1 => center; 2 => right
 	volatile uint8_t touch_bits;   // < 4 => left; 2 => center; 1 => right (no
 	                               // multitouch support)
+	char lines[8][LCD_LINE_LENGTH + 1];  // < the text the labels draw from
 } lcd_s_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,496 @@
+/**
+ * \file pros/math.hpp
+ *
+ * Contains approximate trigonometry and square roots for robot kinematics.
+ *
+ * Odometry, path following and field-centric drives call sin, cos, atan2 and
+ * sqrt many times per loop. The functions here are float versions which are
+ * inlined instead of calling into libm, so with the soft-float ABI the values
+ * also stay in the VFP registers. The batched functions work through arrays
+ * four values at a time with NEON.
+ *
+ * Both the scalar and the batched functions stay within these bounds of the
+ * double precision libm results for finite inputs:
+ * - sin, cos and sincos: 1.5e-7 absolute for |x| < 8192. Further out the
+ *   range reduction loses precision, so reduce angles before then
+ * - atan2: 3e-7 radians absolute, with atan2(0, 0) giving 0
+ * - sqrt and hypot: 3e-7 relative, with sqrt(0) giving 0 and negative inputs
+ *   giving NaN
+ *
+ * tests/fast_math.cpp measures the bounds and the speedup on a brain.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_MATH_HPP_
+#define _PROS_MATH_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+namespace pros {
+namespace math {
+namespace detail {
+// pi/2 split so that k * pi_2_hi and k * pi_2_mid are exact for k < 2^16
+constexpr float pi_2_hi = 1.5703125f;
+constexpr float pi_2_mid = 4.837512969970703125e-4f;
+constexpr float pi_2_lo = 7.549789954891882e-8f;
+constexpr float two_over_pi = 0.636619772367581f;
+constexpr float pi = 3.14159265358979f;
+constexpr float pi_2 = 1.57079632679490f;
+constexpr float pi_4 = 0.785398163397448f;
+constexpr float tan_pi_8 = 0.414213562373095f;
+
+// Minimax polynomials for sin and cos on [-pi/4, pi/4] and atan on
+// [-tan(pi/8), tan(pi/8)], from Cephes
+constexpr float sin_c1 = -1.6666654611e-1f;
+constexpr float sin_c2 = 8.3321608736e-3f;
+constexpr float sin_c3 = -1.9515295891e-4f;
+constexpr float cos_c2 = 4.166664568298827e-2f;
+constexpr float cos_c3 = -1.388731625493765e-3f;
+constexpr float cos_c4 = 2.443315711809948e-5f;
+constexpr float atan_c1 = -3.33329491539e-1f;
+constexpr float atan_c2 = 1.99777106478e-1f;
+constexpr float atan_c3 = -1.38776856032e-1f;
+constexpr float atan_c4 = 8.05374449538e-2f;
+
+inline float sin_poly(float r, float z) {
+	return r + r * z * (sin_c1 + z * (sin_c2 + z * sin_c3));
+}
+
+inline float cos_poly(float z) {
+	return 1.0f - 0.5f * z + z * z * (cos_c2 + z * (cos_c3 + z * cos_c4));
+}
+
+// Reduces x to r in [-pi/4, pi/4], returning the quadrant k where x = r + k * pi/2
+inline std::int32_t reduce(float x, float* r) {
+	std::int32_t const k = static_cast<std::int32_t>(x * two_over_pi + (x < 0 ? -0.5f : 0.5f));
+	float const kf = static_cast<float>(k);
+	*r = ((x - kf * pi_2_hi) - kf * pi_2_mid) - kf * pi_2_lo;
+	return k;
+}
+
+#ifdef __ARM_NEON
+/**
+ * Four lanes of the scalar functions above. The polynomials and the range
+ * reduction are the same, and the divisions and square roots are Newton
+ * refinements of the NEON estimates, which have no instruction on ARMv7.
+ * Without NEON the batched functions loop over the scalar ones instead.
+ */
+typedef float32x4_t f4;
+
+inline f4 load(const float* p) {
+	return vld1q_f32(p);
+}
+inline void store(float* p, f4 v) {
+	vst1q_f32(p, v);
+}
+inline f4 dup(float x) {
+	return vdupq_n_f32(x);
+}
+// a + b * c
+inline f4 mla(f4 a, f4 b, f4 c) {
+	return vmlaq_f32(a, b, c);
+}
+inline f4 recip(f4 x) {
+	f4 e = vrecpeq_f32(x);
+	e = vmulq_f32(vrecpsq_f32(x, e), e);
+	return vmulq_f32(vrecpsq_f32(x, e), e);
+}
+inline f4 sqrt4(f4 x) {
+	f4 e = vrsqrteq_f32(x);
+	e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, e), e), e);
+	e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, e), e), e);
+	// The estimate of 0 is infinite
+	return vbslq_f32(vceqq_f32(x, dup(0)), dup(0), vmulq_f32(x, e));
+}
+// Flips the sign of the lanes whose bit of k is set
+inline f4 flip_if(f4 v, int32x4_t k, int bit) {
+	uint32x4_t const sign = vshlq_u32(vandq_u32(vreinterpretq_u32_s32(k), vdupq_n_u32(1 << bit)), vdupq_n_s32(31 - bit));
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), sign));
+}
+
+inline void sincos4(f4 x, f4* s, f4* c) {
+	// Round to the nearest quadrant, giving the half the sign of x
+	uint32x4_t const sign_bit = vdupq_n_u32(0x80000000);
+	f4 const half = vbslq_f32(sign_bit, x, dup(0.5f));
+	int32x4_t const k = vcvtq_s32_f32(mla(half, x, dup(two_over_pi)));
+	f4 const kf = vcvtq_f32_s32(k);
+	f4 r = mla(x, kf, dup(-pi_2_hi));
+	r = mla(r, kf, dup(-pi_2_mid));
+	r = mla(r, kf, dup(-pi_2_lo));
+	f4 const z = vmulq_f32(r, r);
+	f4 sp = mla(dup(sin_c2), z, dup(sin_c3));
+	sp = mla(dup(sin_c1), z, sp);
+	sp = mla(r, vmulq_f32(r, z), sp);
+	f4 cp = mla(dup(cos_c3), z, dup(cos_c4));
+	cp = mla(dup(cos_c2), z, cp);
+	cp = mla(mla(dup(1.0f), z, dup(-0.5f)), vmulq_f32(z, z), cp);
+	// Odd quadrants swap sin and cos, then quadrants 2 and 3 negate sin and 1 and 2 negate cos
+	uint32x4_t const odd = vtstq_s32(k, vdupq_n_s32(1));
+	*s = flip_if(vbslq_f32(odd, cp, sp), k, 1);
+	*c = flip_if(vbslq_f32(odd, sp, cp), vaddq_s32(k, vdupq_n_s32(1)), 1);
+}
+
+inline f4 atan2_4(f4 y, f4 x) {
+	f4 const ax = vabsq_f32(x), ay = vabsq_f32(y);
+	f4 const lo = vminq_f32(ax, ay), hi = vmaxq_f32(ax, ay);
+	// Above tan(pi/8), atan(a) = pi/4 + atan((a - 1) / (a + 1)), with a = lo / hi
+	uint32x4_t const upper = vcgtq_f32(lo, vmulq_f32(hi, dup(tan_pi_8)));
+	f4 const num = vbslq_f32(upper, vsubq_f32(lo, hi), lo);
+	f4 const den = vbslq_f32(upper, vaddq_f32(lo, hi), hi);
+	f4 const a = vmulq_f32(num, recip(den));
+	f4 const z = vmulq_f32(a, a);
+	f4 p = mla(dup(atan_c3), z, dup(atan_c4));
+	p = mla(dup(atan_c2), z, p);
+	p = mla(dup(atan_c1), z, p);
+	f4 r = mla(a, vmulq_f32(a, z), p);
+	r = vaddq_f32(r, vbslq_f32(upper, dup(pi_4), dup(0)));
+	r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(dup(pi_2), r), r);
+	r = vbslq_f32(vcltq_f32(x, dup(0)), vsubq_f32(dup(pi), r), r);
+	r = vbslq_f32(vceqq_f32(hi, dup(0)), dup(0), r);
+	// Take the sign of y
+	return vbslq_f32(vdupq_n_u32(0x80000000), y, r);
+}
+#endif
+}  // namespace detail
+
+/**
+ * Approximate sine of x in radians, see the bounds at the top of this file
+ */
+inline float sin(float x) {
+	float r;
+	std::int32_t const k = detail::reduce(x, &r);
+	float const z = r * r;
+	float const v = k & 1 ? detail::cos_poly(z) : detail::sin_poly(r, z);
+	return k & 2 ? -v : v;
+}
+
+/**
+ * Approximate cosine of x in radians, see the bounds at the top of this file
+ */
+inline float cos(float x) {
+	float r;
+	std::int32_t const k = detail::reduce(x, &r);
+	float const z = r * r;
+	float const v = k & 1 ? detail::sin_poly(r, z) : detail::cos_poly(z);
+	return (k + 1) & 2 ? -v : v;
+}
+
+/**
+ * Approximate sine and cosine of x in radians, sharing the range reduction
+ */
+inline void sincos(float x, float* s, float* c) {
+	float r;
+	std::int32_t const k = detail::reduce(x, &r);
+	float const z = r * r;
+	float const sp = detail::sin_poly(r, z);
+	float const cp = detail::cos_poly(z);
+	*s = k & 1 ? cp : sp;
+	*c = k & 1 ? sp : cp;
+	if (k & 2) *s = -*s;
+	if ((k + 1) & 2) *c = -*c;
+}
+
+/**
+ * Approximate angle of the point (x, y) in radians, in [-pi, pi]
+ */
+inline float atan2(float y, float x) {
+	float const ax = std::fabs(x), ay = std::fabs(y);
+	float const lo = ax < ay ? ax : ay, hi = ax < ay ? ay : ax;
+	if (hi == 0) return std::copysign(0.0f, y);
+	bool const upper = lo > hi * detail::tan_pi_8;
+	float const a = upper ? (lo - hi) / (lo + hi) : lo / hi;
+	float const z = a * a;
+	float r = a + a * z * (detail::atan_c1 + z * (detail::atan_c2 + z * (detail::atan_c3 + z * detail::atan_c4)));
+	if (upper) r += detail::pi_4;
+	if (ay > ax) r = detail::pi_2 - r;
+	if (x < 0) r = detail::pi - r;
+	return std::copysign(r, y);
+}
+
+/**
+ * Batched sine and cosine. Either output may be null if it isn't wanted, and
+ * the outputs may be the input.
+ *
+ * \param x
+ *        The angles in radians
+ * \param[out] s
+ *        The sines
+ * \param[out] c
+ *        The cosines
+ * \param n
+ *        The number of angles
+ */
+inline void sincos(const float* x, float* s, float* c, std::size_t n) {
+	std::size_t i = 0;
+	float in[4], out_s[4], out_c[4];
+	while (i < n) {
+		std::size_t const count = n - i < 4 ? n - i : 4;
+		const float* src = x + i;
+		if (count < 4) {
+			// Pad the last group so every angle takes the same path
+			std::memset(in, 0, sizeof(in));
+			std::memcpy(in, src, count * sizeof(float));
+			src = in;
+		}
+#ifdef __ARM_NEON
+		detail::f4 vs, vc;
+		detail::sincos4(detail::load(src), &vs, &vc);
+		detail::store(out_s, vs);
+		detail::store(out_c, vc);
+#else
+		for (int j = 0; j < 4; j++) sincos(src[j], &out_s[j], &out_c[j]);
+#endif
+		if (s != nullptr) std::memcpy(s + i, out_s, count * sizeof(float));
+		if (c != nullptr) std::memcpy(c + i, out_c, count * sizeof(float));
+		i += count;
+	}
+}
+
+/**
+ * Batched sine, which may be done in place
+ *
+ * \param x
+ *        The angles in radians
+ * \param[out] out
+ *        The sines
+ * \param n
+ *        The number of angles
+ */
+inline void sin(const float* x, float* out, std::size_t n) {
+	sincos(x, out, nullptr, n);
+}
+
+/**
+ * Batched cosine, which may be done in place
+ *
+ * \param x
+ *        The angles in radians
+ * \param[out] out
+ *        The cosines
+ * \param n
+ *        The number of angles
+ */
+inline void cos(const float* x, float* out, std::size_t n) {
+	sincos(x, nullptr, out, n);
+}
+
+/**
+ * Batched atan2, which may be done in place
+ *
+ * \param y
+ *        The points' y coordinates
+ * \param x
+ *        The points' x coordinates
+ * \param[out] out
+ *        The angles in radians
+ * \param n
+ *        The number of points
+ */
+inline void atan2(const float* y, const float* x, float* out, std::size_t n) {
+	std::size_t i = 0;
+	float in_y[4], in_x[4], result[4];
+	while (i < n) {
+		std::size_t const count = n - i < 4 ? n - i : 4;
+		const float* src_y = y + i;
+		const float* src_x = x + i;
+		if (count < 4) {
+			std::memset(in_y, 0, sizeof(in_y));
+			std::memset(in_x, 0, sizeof(in_x));
+			std::memcpy(in_y, src_y, count * sizeof(float));
+			std::memcpy(in_x, src_x, count * sizeof(float));
+			src_y = in_y;
+			src_x = in_x;
+		}
+#ifdef __ARM_NEON
+		detail::store(result, detail::atan2_4(detail::load(src_y), detail::load(src_x)));
+#else
+		for (int j = 0; j < 4; j++) result[j] = atan2(src_y[j], src_x[j]);
+#endif
+		std::memcpy(out + i, result, count * sizeof(float));
+		i += count;
+	}
+}
+
+/**
+ * Batched square root of x * x + y * y, which may be done in place
+ *
+ * \param x
+ *        The first values
+ * \param y
+ *        The second values
+ * \param[out] out
+ *        The results
+ * \param n
+ *        The number of values
+ */
+inline void hypot(const float* x, const float* y, float* out, std::size_t n) {
+	std::size_t i = 0;
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t const vx = vld1q_f32(x + i), vy = vld1q_f32(y + i);
+		vst1q_f32(out + i, detail::sqrt4(vmlaq_f32(vmulq_f32(vx, vx), vy, vy)));
+	}
+	if (i < n) {
+		float in_x[4] = {0}, in_y[4] = {0};
+		std::memcpy(in_x, x + i, (n - i) * sizeof(float));
+		std::memcpy(in_y, y + i, (n - i) * sizeof(float));
+		hypot(in_x, in_y, in_x, 4);
+		std::memcpy(out + i, in_x, (n - i) * sizeof(float));
+	}
+#else
+	for (; i < n; i++) out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+#endif
+}
+
+/**
+ * Batched square root, which may be done in place
+ *
+ * \param x
+ *        The values
+ * \param[out] out
+ *        The square roots
+ * \param n
+ *        The number of values
+ */
+inline void sqrt(const float* x, float* out, std::size_t n) {
+	std::size_t i = 0;
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) vst1q_f32(out + i, detail::sqrt4(vld1q_f32(x + i)));
+	if (i < n) {
+		float in[4] = {0};
+		std::memcpy(in, x + i, (n - i) * sizeof(float));
+		sqrt(in, in, 4);
+		std::memcpy(out + i, in, (n - i) * sizeof(float));
+	}
+#else
+	for (; i < n; i++) out[i] = std::sqrt(x[i]);
+#endif
+}
+
+/**
+ * Rotates points about the origin by the same angle, e.g. turning robot
+ * relative vectors into field relative ones. The outputs may be the inputs.
+ *
+ * \param x
+ *        The points' x coordinates
+ * \param y
+ *        The points' y coordinates
+ * \param angle
+ *        The angle to rotate by in radians, counterclockwise
+ * \param[out] out_x
+ *        The rotated x coordinates
+ * \param[out] out_y
+ *        The rotated y coordinates
+ * \param n
+ *        The number of points
+ */
+inline void rotate(const float* x, const float* y, float angle, float* out_x, float* out_y, std::size_t n) {
+	float s, c;
+	sincos(angle, &s, &c);
+	std::size_t i = 0;
+#ifdef __ARM_NEON
+	float32x4_t const vs = vdupq_n_f32(s), vc = vdupq_n_f32(c);
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t const vx = vld1q_f32(x + i), vy = vld1q_f32(y + i);
+		vst1q_f32(out_x + i, vmlsq_f32(vmulq_f32(vx, vc), vy, vs));
+		vst1q_f32(out_y + i, vmlaq_f32(vmulq_f32(vx, vs), vy, vc));
+	}
+#endif
+	for (; i < n; i++) {
+		float const px = x[i], py = y[i];
+		out_x[i] = px * c - py * s;
+		out_y[i] = px * s + py * c;
+	}
+}
+
+/**
+ * Turns the wheel speeds of a differential drive into the chassis' linear and
+ * angular speeds, e.g. for a run of motor velocity readings. The outputs may
+ * be the inputs.
+ *
+ * \param left
+ *        The left side's speeds
+ * \param right
+ *        The right side's speeds
+ * \param track_width
+ *        The distance between the left and right wheels, in the units of the
+ *        speeds over radians
+ * \param[out] linear
+ *        The chassis' forward speeds
+ * \param[out] angular
+ *        The chassis' counterclockwise turning speeds in radians
+ * \param n
+ *        The number of speeds
+ */
+inline void differential_to_chassis(const float* left, const float* right, float track_width, float* linear,
+                                    float* angular, std::size_t n) {
+	float const inv_track = 1.0f / track_width;
+	std::size_t i = 0;
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t const l = vld1q_f32(left + i), r = vld1q_f32(right + i);
+		vst1q_f32(linear + i, vmulq_n_f32(vaddq_f32(l, r), 0.5f));
+		vst1q_f32(angular + i, vmulq_n_f32(vsubq_f32(r, l), inv_track));
+	}
+#endif
+	for (; i < n; i++) {
+		float const l = left[i], r = right[i];
+		linear[i] = (l + r) * 0.5f;
+		angular[i] = (r - l) * inv_track;
+	}
+}
+
+/**
+ * Turns chassis speeds into the wheel speeds of a differential drive, the
+ * inverse of differential_to_chassis(). The outputs may be the inputs.
+ *
+ * \param linear
+ *        The chassis' forward speeds
+ * \param angular
+ *        The chassis' counterclockwise turning speeds in radians
+ * \param track_width
+ *        The distance between the left and right wheels
+ * \param[out] left
+ *        The left side's speeds
+ * \param[out] right
+ *        The right side's speeds
+ * \param n
+ *        The number of speeds
+ */
+inline void chassis_to_differential(const float* linear, const float* angular, float track_width, float* left,
+                                    float* right, std::size_t n) {
+	float const half_track = track_width * 0.5f;
+	std::size_t i = 0;
+#ifdef __ARM_NEON
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t const v = vld1q_f32(linear + i), w = vmulq_n_f32(vld1q_f32(angular + i), half_track);
+		vst1q_f32(left + i, vsubq_f32(v, w));
+		vst1q_f32(right + i, vaddq_f32(v, w));
+	}
+#endif
+	for (; i < n; i++) {
+		float const v = linear[i], w = angular[i] * half_track;
+		left[i] = v - w;
+		right[i] = v + w;
+	}
+}
+}  // namespace math
+}  // namespace pros
+
+#endif  // _PROS_MATH_HPP_
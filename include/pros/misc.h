@@ -85,6 +85,103 @@ typedef enum {
 	E_CONTROLLER_DIGITAL_A
 } controller_digital_e_t;
 
+/**
+ * The number of digital channels (buttons) on a controller.
+ */
+#define CONTROLLER_NUM_BUTTONS 12
+
+/**
+ * The bit for a button in controller_state_s_t's buttons and in the mask given
+ * to controller_edge_queue_create().
+ */
+#define CONTROLLER_BUTTON_BIT(button) (1 << ((button)-E_CONTROLLER_DIGITAL_L1))
+
+/**
+ * A controller's inputs, sampled by the system daemon.
+ *
+ * The per-button arrays are indexed by the button minus
+ * E_CONTROLLER_DIGITAL_L1.
+ */
+typedef struct controller_state_s {
+	uint32_t timestamp;  // The millis() time the controller was sampled
+	int32_t connected;   // 1 if the controller is connected, 0 otherwise
+	int32_t analog[4];   // The joysticks, indexed by controller_analog_e_t
+	uint16_t buttons;    // The buttons held down, see CONTROLLER_BUTTON_BIT()
+	// How many times each button has been pressed and released since the
+	// program started
+	uint32_t presses[CONTROLLER_NUM_BUTTONS];
+	uint32_t releases[CONTROLLER_NUM_BUTTONS];
+	// The millis() time each button was last pressed or released
+	uint32_t edge_times[CONTROLLER_NUM_BUTTONS];
+} controller_state_s_t;
+
+/**
+ * A button being pressed or released, as read from an edge queue.
+ */
+typedef struct controller_edge_s {
+	uint32_t timestamp;             // The millis() time the edge was seen
+	controller_id_e_t id;           // The controller the button is on
+	controller_digital_e_t button;  // The button
+	int32_t pressed;                // 1 for a press, 0 for a release
+} controller_edge_s_t;
+
+/**
+ * The number of edges an edge queue holds before dropping new ones.
+ */
+#define CONTROLLER_EDGE_QUEUE_SIZE 32
+
+typedef struct controller_edge_queue_s* controller_edge_queue_t;
+
+typedef struct controller_watch_s* controller_watch_t;
+
+/**
+ * The counters of a controller's queue of screen and rumble updates.
+ */
+typedef struct controller_output_stats_s {
+	uint32_t pending;      // The updates waiting to be sent, at most one per line plus the rumble
+	uint32_t sent;         // The updates VEXos has accepted
+	uint32_t overwritten;  // The updates replaced by a later one before they were sent
+	uint32_t retries;      // The times VEXos refused an update, which is then sent again
+} controller_output_stats_s_t;
+
+/**
+ * The number of samples the battery's minimums and maximums are taken over.
+ * The system daemon samples the battery every 10 ms, so this covers 500 ms.
+ */
+#define BATTERY_WINDOW_SAMPLES 50
+
+/**
+ * The battery voltage in millivolts below which a brownout is predicted by
+ * default, see battery_set_brownout_threshold().
+ */
+#define BATTERY_BROWNOUT_VOLTAGE 10500
+
+/**
+ * The battery's readings, filtered by the system daemon.
+ */
+typedef struct battery_state_s {
+	uint32_t timestamp;  // The millis() time of the latest sample
+	// The filtered readings, see battery_set_filter()
+	double voltage;      // In millivolts
+	double current;      // In milliamps
+	double temperature;  // As battery_get_temperature() gives
+	double capacity;     // As battery_get_capacity() gives
+	// The extremes of the raw readings over the last BATTERY_WINDOW_SAMPLES
+	int32_t voltage_min;
+	int32_t voltage_max;
+	int32_t current_min;
+	int32_t current_max;
+	// How fast the filtered voltage is changing over the window, in millivolts
+	// per second
+	double voltage_trend;
+	// The total current drawn by every motor in milliamps, filtered like the
+	// battery's current
+	double motor_current;
+	// 1 if the voltage is below the brownout threshold, or is falling quickly
+	// enough to be below it within 250 ms, 0 otherwise
+	int32_t brownout_predicted;
+} battery_state_s_t;
+
 #ifdef PROS_USE_SIMPLE_NAMES
 #ifdef __cplusplus
 #define CONTROLLER_MASTER pros::E_CONTROLLER_MASTER
@@ -134,11 +231,13 @@ namespace c {
 /**
  * Checks if the controller is connected.
  *
+ * This reads the inputs the system daemon sampled at the start of its
+ * current cycle, so it never waits on another task.
+ *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
  * given.
- * EACCES - Another resource is currently trying to access the controller port.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -151,11 +250,13 @@ int32_t controller_is_connected(controller_id_e_t id);
 /**
  * Gets the value of an analog channel (joystick) on a controller.
  *
+ * This reads the inputs the system daemon sampled at the start of its
+ * current cycle, so it never waits on another task.
+ *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, or the channel isn't one of those listed below.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -207,11 +308,13 @@ int32_t controller_get_battery_level(controller_id_e_t id);
 /**
  * Checks if a digital channel (button) on the controller is currently pressed.
  *
+ * This reads the inputs the system daemon sampled at the start of its
+ * current cycle, so it never waits on another task.
+ *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, or the button isn't one of those listed below.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -228,19 +331,20 @@ int32_t controller_get_digital(controller_id_e_t id, controller_digital_e_t butt
 /**
  * Returns a rising-edge case for a controller button press.
  *
- * This function is not thread-safe.
- * Multiple tasks polling a single button may return different results under the
- * same circumstances, so only one task should call this function for any given
- * button. E.g., Task A calls this function for buttons 1 and 2. Task B may call
- * this function for button 3, but should not for buttons 1 or 2. A typical
- * use-case for this function is to call inside opcontrol to detect new button
- * presses, and not in any other tasks.
+ * The system daemon counts every press, so a press is reported even if the
+ * button was released again before this function was called.
+ *
+ * Every task calling this function shares the record of which presses were
+ * reported, so only one task should call this function for any given button.
+ * E.g., Task A calls this function for buttons 1 and 2. Task B may call this
+ * function for button 3, but should not for buttons 1 or 2. Tasks which all
+ * need to see the same presses should each use an edge queue instead, see
+ * controller_edge_queue_create().
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
  * given.
- * EACCES - Another resource is currently trying to access the controller port.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -249,22 +353,23 @@ int32_t controller_get_digital(controller_id_e_t id, controller_digital_e_t butt
  * 			  The button to read. Must be one of
  *        DIGITAL_{RIGHT,DOWN,LEFT,UP,A,B,Y,X,R1,R2,L1,L2}
  *
- * \return 1 if the button on the controller is pressed and had not been pressed
- * the last time this function was called, 0 otherwise.
+ * \return 1 if the button on the controller has been pressed since the last
+ * time this function was called, or is pressed and this function hasn't been
+ * called for it before, 0 otherwise.
  */
 int32_t controller_get_digital_new_press(controller_id_e_t id, controller_digital_e_t button);
 
 /**
  * Sets text to the controller LCD screen.
  *
- * \note Controller text setting is currently in beta, so continuous, fast
- * updates will not work well.
+ * The update is queued and this function returns straight away. The system
+ * daemon sends the queued updates as fast as VEXos allows, about one every
+ * 50 ms per controller. A write to a line that is still queued replaces it.
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, or the line is out of range.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -286,14 +391,14 @@ int32_t controller_print(controller_id_e_t id, uint8_t line, uint8_t col, const
 /**
  * Sets text to the controller LCD screen.
  *
- * \note Controller text setting is currently in beta, so continuous, fast
- * updates will not work well.
+ * The update is queued and this function returns straight away. The system
+ * daemon sends the queued updates as fast as VEXos allows, about one every
+ * 50 ms per controller. A write to a line that is still queued replaces it.
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, the line is out of range, or str is NULL.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -313,14 +418,14 @@ int32_t controller_set_text(controller_id_e_t id, uint8_t line, uint8_t col, con
 /**
  * Clears an individual line of the controller screen.
  *
- * \note Controller text setting is currently in beta, so continuous, fast
- * updates will not work well.
+ * The update is queued and this function returns straight away. The system
+ * daemon sends the queued updates as fast as VEXos allows, about one every
+ * 50 ms per controller. A write to a line that is still queued replaces it.
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, or the line is out of range.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -336,15 +441,15 @@ int32_t controller_clear_line(controller_id_e_t id, uint8_t line);
 /**
  * Clears all of the lines on the controller screen.
  *
- * \note Controller text setting is currently in beta, so continuous, fast
- * updates will not work well. On vexOS version 1.0.0 this function will block
- * for 110ms.
+ * The update is queued and this function returns straight away. The system
+ * daemon sends the queued updates as fast as VEXos allows, about one every
+ * 50 ms per controller. Clearing the screen drops writes to its lines that
+ * are still queued.
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
  * given.
- * EACCES - Another resource is currently trying to access the controller port.
  *
  * \param id
  *        The ID of the controller (e.g. the master or partner controller).
@@ -358,14 +463,14 @@ int32_t controller_clear(controller_id_e_t id);
 /**
  * Rumble the controller.
  *
- * \note Controller rumble activation is currently in beta, so continuous, fast
- * updates will not work well.
+ * The update is queued and this function returns straight away. The system
+ * daemon sends the queued updates as fast as VEXos allows, about one every
+ * 50 ms per controller. A rumble that is still queued is replaced.
  *
  * This function uses the following values of errno when an error state is
  * reached:
  * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
- * given.
- * EACCES - Another resource is currently trying to access the controller port.
+ * given, or rumble_pattern is NULL.
  *
  * \param id
  *				The ID of the controller (e.g. the master or partner controller).
@@ -380,6 +485,152 @@ int32_t controller_clear(controller_id_e_t id);
  */
 int32_t controller_rumble(controller_id_e_t id, const char* rumble_pattern);
 
+/**
+ * Gets the counters of a controller's queue of screen and rumble updates.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
+ * given, or stats is NULL
+ *
+ * \param id
+ *        The ID of the controller (e.g. the master or partner controller).
+ *        Must be one of CONTROLLER_MASTER or CONTROLLER_PARTNER
+ * \param[out] stats
+ *             The counters to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t controller_get_output_stats(controller_id_e_t id, controller_output_stats_s_t* const stats);
+
+/**
+ * Gets all of a controller's inputs as sampled by the system daemon.
+ *
+ * This never waits on another task, and all of the values come from the same
+ * sample.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
+ * given, or state is NULL
+ *
+ * \param id
+ *        The ID of the controller (e.g. the master or partner controller).
+ *        Must be one of CONTROLLER_MASTER or CONTROLLER_PARTNER
+ * \param[out] state
+ *             The state to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t controller_get_state(controller_id_e_t id, controller_state_s_t* const state);
+
+/**
+ * Creates a queue that receives every press and release of some of a
+ * controller's buttons.
+ *
+ * The system daemon adds the edges it sees to every queue watching the button,
+ * so each task can have its own queue and none of them miss an edge. Edges are
+ * dropped while a queue is full, see controller_edge_queue_get_dropped().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
+ * given, or button_mask has no buttons or bits that aren't buttons
+ * ENOMEM - The queue could not be allocated
+ *
+ * \param id
+ *        The ID of the controller (e.g. the master or partner controller).
+ *        Must be one of CONTROLLER_MASTER or CONTROLLER_PARTNER
+ * \param button_mask
+ *        The buttons to watch, made of CONTROLLER_BUTTON_BIT()s
+ *
+ * \return A handle to the queue, or NULL if the operation failed, setting
+ * errno.
+ */
+controller_edge_queue_t controller_edge_queue_create(controller_id_e_t id, uint16_t button_mask);
+
+/**
+ * Takes the oldest edges out of an edge queue.
+ *
+ * This never blocks, and only one task should read from a given queue.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - queue or edges is NULL
+ *
+ * \param queue
+ *        The queue from controller_edge_queue_create()
+ * \param[out] edges
+ *             The array to copy the edges into, oldest first
+ * \param count
+ *        The most edges to take
+ *
+ * \return The number of edges taken, or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t controller_edge_queue_read(controller_edge_queue_t queue, controller_edge_s_t* const edges, uint32_t count);
+
+/**
+ * Gets how many edges were dropped because an edge queue was full.
+ *
+ * \param queue
+ *        The queue from controller_edge_queue_create()
+ *
+ * \return The number of edges dropped since the queue was created
+ */
+uint32_t controller_edge_queue_get_dropped(controller_edge_queue_t queue);
+
+/**
+ * Stops an edge queue receiving edges and frees it.
+ *
+ * \param queue
+ *        The queue from controller_edge_queue_create()
+ */
+void controller_edge_queue_delete(controller_edge_queue_t queue);
+
+/**
+ * Wakes the calling task whenever a controller's inputs change.
+ *
+ * The system daemon checks the watch as soon as it samples the controller,
+ * straight after VEXos processes the radio, and sets notify_bits in the task's
+ * notification value (as task_notify_ext() with E_NOTIFY_ACTION_BITS does) if
+ * a button was pressed or released, the controller was connected or
+ * disconnected, or a joystick axis moved by more than deadband since the last
+ * wakeup. A drive loop waiting in task_notify_take() or task_notify_ext() then
+ * runs in the same 2 ms cycle as the input, and controller_get_state() gives
+ * the inputs which woke it.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - A value other than E_CONTROLLER_MASTER or E_CONTROLLER_PARTNER is
+ * given, or notify_bits is 0
+ * ENOMEM - The watch could not be allocated
+ *
+ * \param id
+ *        The ID of the controller (e.g. the master or partner controller).
+ *        Must be one of CONTROLLER_MASTER or CONTROLLER_PARTNER
+ * \param deadband
+ *        How far a joystick axis (-127 to 127) has to move from where it was
+ *        at the last wakeup to wake the task again
+ * \param notify_bits
+ *        The bits to set in the task's notification value
+ *
+ * \return A handle to the watch, or NULL if the operation failed, setting
+ * errno.
+ */
+controller_watch_t controller_watch_create(controller_id_e_t id, uint8_t deadband, uint32_t notify_bits);
+
+/**
+ * Stops a watch waking its task and frees it. This must be done before the
+ * task is deleted.
+ *
+ * \param watch
+ *        The watch from controller_watch_create()
+ */
+void controller_watch_delete(controller_watch_t watch);
+
 /**
  * Gets the current voltage of the battery, as reported by VEXos.
  *
@@ -424,6 +675,53 @@ double battery_get_temperature(void);
  */
 double battery_get_capacity(void);
 
+/**
+ * Gets the battery's filtered readings.
+ *
+ * The system daemon samples the battery every 10 ms along with the motors'
+ * current, so this never waits on another task and costs no more than a copy.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - state is NULL
+ * EAGAIN - The battery hasn't been sampled yet
+ *
+ * \param[out] state
+ *             The state to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t battery_get_state(battery_state_s_t* const state);
+
+/**
+ * Sets how much the battery's readings are smoothed.
+ *
+ * Every sample, the filtered readings move by alpha of the way towards the
+ * raw ones. An alpha of 1 turns the filter off, while smaller values filter
+ * out more noise at the cost of lagging behind changes. The default is 0.1.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - alpha is not greater than 0 and at most 1
+ *
+ * \param alpha
+ *        The filter's weight for new samples, in (0, 1]
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t battery_set_filter(double alpha);
+
+/**
+ * Sets the voltage below which a brownout is predicted, see
+ * battery_state_s_t's brownout_predicted.
+ *
+ * \param millivolts
+ *        The threshold in millivolts, BATTERY_BROWNOUT_VOLTAGE by default
+ */
+void battery_set_brownout_threshold(int32_t millivolts);
+
 /**
  * Checks if the SD card is installed.
  *
@@ -431,6 +729,72 @@ double battery_get_capacity(void);
  */
 int32_t usd_is_installed(void);
 
+/**
+ * The kinds of entry on the SD card, see usd_get_file_info().
+ */
+typedef enum usd_file_type_e {
+	E_USD_FILE = 0,   // A regular file
+	E_USD_DIRECTORY,  // A directory
+} usd_file_type_e_t;
+
+/**
+ * What usd_get_file_info() finds about an entry on the SD card.
+ */
+typedef struct usd_file_info_s {
+	usd_file_type_e_t type;
+	int32_t size;  // The size of a file in bytes, 0 for a directory
+} usd_file_info_s_t;
+
+/**
+ * Lists the names of every file and directory in a directory of the SD card,
+ * in one call into VEXos.
+ *
+ * The names are written to buffer one after another, each followed by a
+ * newline, and the list is NUL terminated. Names which don't fit in len bytes
+ * are left out.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - path or buffer is NULL, or len is less than 1
+ * EBUSY - No SD card is installed
+ * ENOENT - The directory does not exist
+ * EIO - The card could not be read
+ *
+ * \param path
+ *        The directory to list, e.g. "/usd/logs". The "/usd" is optional and
+ *        "/" is the top of the card
+ * \param[out] buffer
+ *             The buffer to write the names to
+ * \param len
+ *        The size of buffer in bytes
+ *
+ * \return The number of names written, or PROS_ERR upon failure
+ */
+int32_t usd_list_files(const char* path, char* buffer, int32_t len);
+
+/**
+ * Finds whether a path on the SD card is a file or a directory and how large
+ * the file is, without it being opened through the file system.
+ *
+ * Finding a file's size briefly opens it, so this needs one of the 8 files
+ * VEXos allows open at once.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - path or info is NULL
+ * EBUSY - No SD card is installed
+ * ENOENT - Nothing exists at the path
+ * EIO - The card could not be read
+ *
+ * \param path
+ *        The path to look up, with or without "/usd" in front
+ * \param[out] info
+ *             What was found
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+int32_t usd_get_file_info(const char* path, usd_file_info_s_t* info);
+
 #ifdef __cplusplus
 }
 }
@@ -41,10 +41,8 @@ class Controller {
 	/**
 	 * Checks if the controller is connected.
 	 *
-	 * This function uses the following values of errno when an error state is
-	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * This reads the inputs the system daemon sampled at the start of its
+	 * current cycle, so it never waits on another task.
 	 *
 	 * \return 1 if the controller is connected, 0 otherwise
 	 */
@@ -53,10 +51,12 @@ class Controller {
 	/**
 	 * Gets the value of an analog channel (joystick) on a controller.
 	 *
+	 * This reads the inputs the system daemon sampled at the start of its
+	 * current cycle, so it never waits on another task.
+	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The channel isn't one of those listed below.
 	 *
 	 * \param channel
 	 * 			  The analog channel to get.
@@ -96,10 +96,12 @@ class Controller {
 	 * Checks if a digital channel (button) on the controller is currently
 	 * pressed.
 	 *
+	 * This reads the inputs the system daemon sampled at the start of its
+	 * current cycle, so it never waits on another task.
+	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The button isn't one of those listed below.
 	 *
 	 * \param button
 	 * 			  The button to read. Must be one of
@@ -113,28 +115,48 @@ class Controller {
 	/**
 	 * Returns a rising-edge case for a controller button press.
 	 *
-	 * This function is not thread-safe.
-	 * Multiple tasks polling a single button may return different results under
-	 * the same circumstances, so only one task should call this function for any
-	 * given button. E.g., Task A calls this function for buttons 1 and 2.
-	 * Task B may call this function for button 3, but should not for buttons
-	 * 1 or 2. A typical use-case for this function is to call inside opcontrol
-	 * to detect new button presses, and not in any other tasks.
+	 * The system daemon counts every press, so a press is reported even if the
+	 * button was released again before this function was called.
+	 *
+	 * Every task calling this function shares the record of which presses were
+	 * reported, so only one task should call this function for any given
+	 * button. E.g., Task A calls this function for buttons 1 and 2. Task B may
+	 * call this function for button 3, but should not for buttons 1 or 2. Tasks
+	 * which all need to see the same presses should each use an edge queue
+	 * instead, see pros::c::controller_edge_queue_create().
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The button isn't one of those listed below.
 	 *
 	 * \param button
 	 * 			  The button to read. Must be one of
 	 *        DIGITAL_{RIGHT,DOWN,LEFT,UP,A,B,Y,X,R1,R2,L1,L2}
 	 *
-	 * \return 1 if the button on the controller is pressed and had not been
-	 * pressed the last time this function was called, 0 otherwise.
+	 * \return 1 if the button on the controller has been pressed since the last
+	 * time this function was called, or is pressed and this function hasn't been
+	 * called for it before, 0 otherwise.
 	 */
 	std::int32_t get_digital_new_press(controller_digital_e_t button);
 
+	/**
+	 * Gets all of the controller's inputs as sampled by the system daemon.
+	 *
+	 * This never waits on another task, and all of the values come from the
+	 * same sample.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - state is NULL
+	 *
+	 * \param[out] state
+	 *             The state to fill
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t get_state(controller_state_s_t* const state);
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
 	template <typename T>
@@ -149,13 +171,13 @@ class Controller {
 	/**
 	 * Sets text to the controller LCD screen.
 	 *
-	 * \note Controller text setting is currently in beta, so continuous, fast
-	 * updates will not work well.
+	 * The update is queued and this function returns straight away. The system
+	 * daemon sends the queued updates as fast as VEXos allows, about one every
+	 * 50 ms per controller. A write to a line that is still queued replaces it.
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The line is out of range
 	 *
 	 * \param line
 	 *        The line number at which the text will be displayed [0-2]
@@ -177,13 +199,13 @@ class Controller {
 	/**
 	 * Sets text to the controller LCD screen.
 	 *
-	 * \note Controller text setting is currently in beta, so continuous, fast
-	 * updates will not work well.
+	 * The update is queued and this function returns straight away. The system
+	 * daemon sends the queued updates as fast as VEXos allows, about one every
+	 * 50 ms per controller. A write to a line that is still queued replaces it.
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The line is out of range, or str is NULL
 	 *
 	 * \param line
 	 *        The line number at which the text will be displayed [0-2]
@@ -200,13 +222,13 @@ class Controller {
 	/**
 	 * Clears an individual line of the controller screen.
 	 *
-	 * \note Controller text setting is currently in beta, so continuous, fast
-	 * updates will not work well.
+	 * The update is queued and this function returns straight away. The system
+	 * daemon sends the queued updates as fast as VEXos allows, about one every
+	 * 50 ms per controller. A write to a line that is still queued replaces it.
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - The line is out of range
 	 *
 	 * \param line
 	 *        The line number to clear [0-2]
@@ -219,13 +241,13 @@ class Controller {
 	/**
 	 * Rumble the controller.
 	 *
-	 * \note Controller rumble activation is currently in beta, so continuous, fast
-	 * updates will not work well.
+	 * The update is queued and this function returns straight away. The system
+	 * daemon sends the queued updates as fast as VEXos allows, about one every
+	 * 50 ms per controller. A rumble that is still queued is replaced.
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - rumble_pattern is NULL
 	 *
 	 * \param rumble_pattern
 	 *				A string consisting of the characters '.', '-', and ' ', where dots
@@ -240,19 +262,30 @@ class Controller {
 	/**
 	 * Clears all of the lines on the controller screen.
 	 *
-	 * \note Controller text setting is currently in beta, so continuous, fast
-	 * updates will not work well. On vexOS version 1.0.0 this function will
-	 * block for 110ms.
+	 * The update is queued and this function returns straight away. The system
+	 * daemon sends the queued updates as fast as VEXos allows, about one every
+	 * 50 ms per controller. Clearing the screen drops writes to its lines that
+	 * are still queued.
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t clear(void);
+
+	/**
+	 * Gets the counters of the controller's queue of screen and rumble updates.
 	 *
 	 * This function uses the following values of errno when an error state is
 	 * reached:
-	 * EACCES - Another resource is currently trying to access the controller
-	 * port.
+	 * EINVAL - stats is NULL
+	 *
+	 * \param[out] stats
+	 *             The counters to fill
 	 *
 	 * \return 1 if the operation was successful or PROS_ERR if the operation
 	 * failed, setting errno.
 	 */
-	std::int32_t clear(void);
+	std::int32_t get_output_stats(controller_output_stats_s_t* const stats);
 
 	private:
 	controller_id_e_t _id;
@@ -302,6 +335,49 @@ double get_temperature(void);
  * \return The current capacity of the battery
  */
 int32_t get_voltage(void);
+
+/**
+ * Gets the battery's filtered readings.
+ *
+ * The system daemon samples the battery every 10 ms along with the motors'
+ * current, so this never waits on another task and costs no more than a copy.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - state is NULL
+ * EAGAIN - The battery hasn't been sampled yet
+ *
+ * \param[out] state
+ *             The state to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+std::int32_t get_state(battery_state_s_t* const state);
+
+/**
+ * Sets how much the battery's readings are smoothed. See
+ * pros::c::battery_set_filter().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - alpha is not greater than 0 and at most 1
+ *
+ * \param alpha
+ *        The filter's weight for new samples, in (0, 1]
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+std::int32_t set_filter(double alpha);
+
+/**
+ * Sets the voltage below which a brownout is predicted.
+ *
+ * \param millivolts
+ *        The threshold in millivolts, BATTERY_BROWNOUT_VOLTAGE by default
+ */
+void set_brownout_threshold(std::int32_t millivolts);
 }  // namespace battery
 
 namespace competition {
@@ -324,6 +400,22 @@ namespace usd {
  * \return 1 if the SD card is installed, 0 otherwise
  */
 std::int32_t is_installed(void);
+
+/**
+ * Lists the names of every file and directory in a directory of the SD card,
+ * each followed by a newline. See pros::c::usd_list_files().
+ *
+ * \return The number of names written, or PROS_ERR upon failure
+ */
+std::int32_t list_files(const char* path, char* buffer, std::int32_t len);
+
+/**
+ * Finds whether a path on the SD card is a file or a directory and how large
+ * the file is. See pros::c::usd_get_file_info().
+ *
+ * \return 1 upon success, PROS_ERR upon failure
+ */
+std::int32_t get_file_info(const char* path, pros::c::usd_file_info_s_t* info);
 }  // namespace usd
 }  // namespace pros
 
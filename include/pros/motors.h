@@ -174,6 +174,33 @@ int32_t motor_move_voltage(uint8_t port, const int32_t voltage);
  */
 int32_t motor_modify_profiled_velocity(uint8_t port, const int32_t velocity);
 
+/**
+ * Sets whether the motor's voltage and velocity commands are left for the
+ * system daemon to send.
+ *
+ * motor_move(), motor_move_voltage() and motor_move_velocity() skip commands
+ * which are the same as the last one sent to the motor, without taking its
+ * port. With batching enabled, a changed command is also only stored, and the
+ * daemon sends the latest one at the start of its next cycle (within 2 ms).
+ * This makes the functions cheap to call from a fast loop, at the cost of the
+ * command reaching the motor slightly later.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as a motor
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param enable
+ *        Whether to batch the motor's commands. A command still waiting when
+ *        batching is disabled is sent straight away.
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_set_command_batching(uint8_t port, const bool enable);
+
 /**
  * Gets the target position set for the motor by the user.
  *
@@ -1092,6 +1119,911 @@ int32_t motor_is_reversed(uint8_t port);
  */
 int32_t motor_get_voltage_limit(uint8_t port);
 
+/******************************************************************************/
+/**                           Motor state functions                          **/
+/**                                                                          **/
+/**   These functions read all of a motor's telemetry at once                **/
+/******************************************************************************/
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * Holds all of a motor's telemetry, read under a single claim of its port.
+ */
+typedef struct motor_state_s {
+	double position;          // The position in the motor's encoder units
+	double velocity;          // The actual velocity in RPM
+	double target_position;   // The target position of the last absolute or relative movement
+	double power;             // The power drawn in Watts
+	double torque;            // The torque generated in Newton Meters (Nm)
+	double efficiency;        // The efficiency as a percentage
+	double temperature;       // The temperature in degrees Celsius
+	int32_t target_velocity;  // The commanded velocity in RPM
+	int32_t current_draw;     // The current drawn in mA
+	int32_t voltage;          // The voltage delivered in mV
+	int32_t direction;        // 1 for moving in the positive direction, -1 for negative
+	uint32_t faults;          // A bitfield containing the motor's faults
+	uint32_t flags;           // A bitfield containing the motor's flags
+} motor_state_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Gets all of the motor's telemetry at once.
+ *
+ * This is equivalent to calling each of the telemetry getters, but only claims
+ * the motor's port once.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as a motor
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] state
+ *             The struct to fill with the motor's telemetry
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_get_state(uint8_t port, motor_state_s_t* const state);
+
+/******************************************************************************/
+/**                        Motor controller functions                        **/
+/**                                                                          **/
+/**   These functions let the system daemon run a PID loop for a motor,      **/
+/**   using the sensor values VEXos has just updated                         **/
+/******************************************************************************/
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * The quantity a motor controller regulates.
+ */
+typedef enum motor_controller_mode_e {
+	E_MOTOR_CONTROLLER_VELOCITY = 0,  // Targets are actual velocities in RPM
+	E_MOTOR_CONTROLLER_POSITION       // Targets are positions in the motor's encoder units
+} motor_controller_mode_e_t;
+
+/**
+ * The configuration of a controller run by the system daemon.
+ *
+ * The controller is evaluated every daemon cycle (2 ms), and its output is the
+ * motor voltage in millivolts:
+ *
+ * voltage = kf * target + kp * error + ki * sum(error) + kd * (error - last_error)
+ *
+ * The integral and derivative terms are per daemon cycle, not per second.
+ */
+typedef struct motor_controller_s {
+	motor_controller_mode_e_t mode;
+	double kf;    // Feedforward gain applied to the target
+	double kp;    // Proportional gain
+	double ki;    // Integral gain
+	double kd;    // Derivative gain
+	double slew;  // The maximum change of voltage per cycle in mV, 0 for no limit
+} motor_controller_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Starts running a controller for the motor in the system daemon.
+ *
+ * The controller starts with a target of 0 and overrides any other movement
+ * command sent to the motor until motor_controller_disable() is called.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as a motor
+ * EINVAL - controller is NULL or its slew is negative
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param controller
+ *        The controller's configuration
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_controller_enable(uint8_t port, const motor_controller_s_t* const controller);
+
+/**
+ * Sets the target of the motor's controller.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - No controller is enabled for the motor
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param target
+ *        The new target, see motor_controller_mode_e_t for its units
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_controller_set_target(uint8_t port, const double target);
+
+/**
+ * Stops running the motor's controller and stops the motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - The port cannot be configured as a motor
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_controller_disable(uint8_t port);
+
+/******************************************************************************/
+/**                        Motor trajectory functions                        **/
+/**                                                                          **/
+/**   These functions let the system daemon play back a table of setpoints   **/
+/**   on several motors at once, interpolating between them every cycle      **/
+/******************************************************************************/
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * A setpoint in a trajectory.
+ */
+typedef struct motor_trajectory_point_s {
+	uint32_t time;    // The time in ms since the trajectory started
+	double position;  // The position in the motors' encoder units
+	double velocity;  // The velocity in RPM
+	double voltage;   // The feedforward voltage in mV
+} motor_trajectory_point_s_t;
+
+/**
+ * How a trajectory corrects the motors' errors. Every daemon cycle (2 ms), each
+ * motor is given the voltage in millivolts
+ *
+ * voltage = setpoint voltage + kp * position error + kv * velocity error
+ */
+typedef struct motor_trajectory_gains_s {
+	double kp;  // mV per encoder unit of position error
+	double kv;  // mV per RPM of velocity error
+} motor_trajectory_gains_s_t;
+
+typedef struct motor_trajectory_s* motor_trajectory_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Copies a trajectory into kernel memory, ready to be started with
+ * motor_trajectory_start().
+ *
+ * Every motor in the trajectory follows the same setpoints, negated for
+ * reversed ports. The points' positions are absolute, in the motors' encoder
+ * units, so tare the motors first if the trajectory starts at 0.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - ports, points or gains is NULL, count or num_points is 0, or the
+ * points' times don't increase
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21)
+ * ENOMEM - The trajectory could not be allocated
+ *
+ * \param ports
+ *        The motors' ports from 1-21; a negative port reverses the
+ *        trajectory for that motor
+ * \param count
+ *        The number of ports
+ * \param points
+ *        The setpoints, in order of time
+ * \param num_points
+ *        The number of setpoints
+ * \param gains
+ *        How the motors' errors are corrected
+ *
+ * \return A handle to the trajectory, or NULL if the operation failed, setting
+ * errno.
+ */
+motor_trajectory_t motor_trajectory_load(const int8_t* const ports, const uint8_t count,
+                                         const motor_trajectory_point_s_t* const points, const uint32_t num_points,
+                                         const motor_trajectory_gains_s_t* const gains);
+
+/**
+ * Starts playing back a trajectory.
+ *
+ * The trajectory starts at the daemon's next cycle, so trajectories started
+ * one after another within 2 ms of each other run in step. Until it ends, the
+ * trajectory overrides any other command sent to its motors. At the end the
+ * motors are told to hold a velocity of 0.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - trajectory is NULL
+ * EBUSY - One of the trajectory's motors is already running another
+ * trajectory or a controller, see motor_controller_enable()
+ *
+ * \param trajectory
+ *        The trajectory from motor_trajectory_load()
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_trajectory_start(motor_trajectory_t trajectory);
+
+/**
+ * Stops playing back a trajectory early, stopping its motors.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - trajectory is NULL
+ *
+ * \param trajectory
+ *        The trajectory from motor_trajectory_load()
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_trajectory_stop(motor_trajectory_t trajectory);
+
+/**
+ * Checks whether a trajectory is playing.
+ *
+ * \param trajectory
+ *        The trajectory from motor_trajectory_load()
+ *
+ * \return 1 if the trajectory has been started and hasn't ended, 0 otherwise
+ */
+int32_t motor_trajectory_is_running(motor_trajectory_t trajectory);
+
+/**
+ * Waits for a trajectory to end.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - trajectory is NULL
+ * EAGAIN - The scheduler isn't running, so the trajectory can't advance
+ * ETIMEDOUT - The trajectory didn't end before the timeout
+ *
+ * \param trajectory
+ *        The trajectory from motor_trajectory_load()
+ * \param timeout
+ *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_trajectory_wait(motor_trajectory_t trajectory, uint32_t timeout);
+
+/**
+ * Frees a trajectory, stopping it first if it is playing.
+ *
+ * \param trajectory
+ *        The trajectory from motor_trajectory_load()
+ */
+void motor_trajectory_delete(motor_trajectory_t trajectory);
+
+/******************************************************************************/
+/**                          Motor group functions                           **/
+/**                                                                          **/
+/**   These functions send the same command to several motors at once. All   **/
+/**   of the ports are validated and claimed before any command is sent, so  **/
+/**   the system daemon can never run between two motors of the group        **/
+/******************************************************************************/
+
+/**
+ * Sets the voltage for a group of motors from -127 to 127.
+ *
+ * This is equivalent to calling motor_move() on every motor of the group. A
+ * negative port number negates the command sent to that motor, which is useful
+ * for mirrored drive sides.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group is empty
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - One of the ports cannot be configured as a motor
+ * EACCES - Another resource is currently trying to access one of the ports.
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param voltage
+ *        The new motor voltage from -127 to 127
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno. If the operation failed, no motor was commanded.
+ */
+int32_t motor_group_move(const int8_t* const ports, const uint8_t count, int32_t voltage);
+
+/**
+ * Sets the target absolute position for a group of motors.
+ *
+ * This is equivalent to calling motor_move_absolute() on every motor of the
+ * group. A negative port number negates the target position for that motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group is empty
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - One of the ports cannot be configured as a motor
+ * EACCES - Another resource is currently trying to access one of the ports.
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param position
+ *        The absolute position to move to in the motors' encoder units
+ * \param velocity
+ *        The maximum allowable velocity for the movement in RPM
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno. If the operation failed, no motor was commanded.
+ */
+int32_t motor_group_move_absolute(const int8_t* const ports, const uint8_t count, const double position,
+                                  const int32_t velocity);
+
+/**
+ * Sets the relative target position for a group of motors.
+ *
+ * This is equivalent to calling motor_move_relative() on every motor of the
+ * group. A negative port number negates the relative position for that motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group is empty
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - One of the ports cannot be configured as a motor
+ * EACCES - Another resource is currently trying to access one of the ports.
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param position
+ *        The relative position to move to in the motors' encoder units
+ * \param velocity
+ *        The maximum allowable velocity for the movement in RPM
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno. If the operation failed, no motor was commanded.
+ */
+int32_t motor_group_move_relative(const int8_t* const ports, const uint8_t count, const double position,
+                                  const int32_t velocity);
+
+/**
+ * Sets the velocity for a group of motors.
+ *
+ * This is equivalent to calling motor_move_velocity() on every motor of the
+ * group. A negative port number negates the velocity for that motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group is empty
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - One of the ports cannot be configured as a motor
+ * EACCES - Another resource is currently trying to access one of the ports.
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param velocity
+ *        The new motor velocity from +-100, +-200, or +-600 depending on the
+ *        motors' gearsets
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno. If the operation failed, no motor was commanded.
+ */
+int32_t motor_group_move_velocity(const int8_t* const ports, const uint8_t count, const int32_t velocity);
+
+/**
+ * Sets the output voltage for a group of motors from -12000 to 12000 in
+ * millivolts.
+ *
+ * This is equivalent to calling motor_move_voltage() on every motor of the
+ * group. A negative port number negates the voltage for that motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group is empty
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - One of the ports cannot be configured as a motor
+ * EACCES - Another resource is currently trying to access one of the ports.
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param voltage
+ *        The new voltage value from -12000 to 12000
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno. If the operation failed, no motor was commanded.
+ */
+int32_t motor_group_move_voltage(const int8_t* const ports, const uint8_t count, const int32_t voltage);
+
+/******************************************************************************/
+/**                      Motor group synchronization                         **/
+/**                                                                          **/
+/**   These functions let the system daemon keep the motors of a group in    **/
+/**   step, trimming each motor's command every cycle by how far it has      **/
+/**   fallen behind or run ahead of the others                               **/
+/******************************************************************************/
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * How a synchronized group corrects its motors. Every daemon cycle (2 ms), each
+ * motor's progress since the group's last command (its position, negated for
+ * reversed ports) is compared with the group's average, and the motor is sent
+ *
+ * command + kp * error + ki * sum(error)
+ *
+ * where the command is the group's last velocity (RPM) or voltage (mV)
+ * command, so the gains are in RPM or mV per encoder unit to match. The sum is
+ * per daemon cycle.
+ */
+typedef struct motor_sync_gains_s {
+	double kp;        // Per encoder unit of error
+	double ki;        // Per encoder unit of error summed over the cycles
+	double max_trim;  // The largest correction in RPM or mV, 0 for no limit
+} motor_sync_gains_s_t;
+
+/**
+ * How well a synchronized group is keeping in step.
+ */
+typedef struct motor_sync_stats_s {
+	double spread;       // The progress of the furthest ahead motor minus the furthest behind, in encoder units
+	double peak_spread;  // The largest spread since the group's synchronization was enabled
+	double max_trim;     // The largest correction sent in the latest cycle
+	uint32_t cycles;     // The daemon cycles in which the group was corrected
+} motor_sync_stats_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Starts keeping the motors of a group in step.
+ *
+ * While every motor of the group is running a velocity or voltage command from
+ * the motor group functions (or the same command sent to each of them), the
+ * system daemon trims each motor's command in the cycle it reads the motors,
+ * before the motors are released to the user's tasks. Each new command starts
+ * the comparison over from the motors' positions at the time. Cycles in which a
+ * motor is unplugged, is stopped, has a profiled move, or is driven by a
+ * controller or trajectory aren't corrected.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The group has fewer than 2 motors, or gains is NULL or negative
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * EBUSY - One of the motors is already in a synchronized group
+ * ENOMEM - The synchronization could not be allocated
+ *
+ * \param ports
+ *        The V5 port numbers of the group from 1-21, or -1 to -21 to reverse
+ * \param count
+ *        The number of ports in the group
+ * \param gains
+ *        The gains, which are copied
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_group_sync_enable(const int8_t* const ports, const uint8_t count,
+                                const motor_sync_gains_s_t* const gains);
+
+/**
+ * Changes the gains of a synchronized group.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - gains is NULL or negative
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - The group isn't synchronized
+ *
+ * \param ports
+ *        The ports the group was synchronized with
+ * \param count
+ *        The number of ports in the group
+ * \param gains
+ *        The new gains
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_group_sync_set_gains(const int8_t* const ports, const uint8_t count,
+                                   const motor_sync_gains_s_t* const gains);
+
+/**
+ * Gets how well a synchronized group is keeping in step.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - stats is NULL
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - The group isn't synchronized
+ *
+ * \param ports
+ *        The ports the group was synchronized with
+ * \param count
+ *        The number of ports in the group
+ * \param[out] stats
+ *             The statistics to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_group_sync_get_stats(const int8_t* const ports, const uint8_t count, motor_sync_stats_s_t* const stats);
+
+/**
+ * Stops keeping the motors of a group in step. The daemon sends each motor its
+ * last command without a correction in its next cycle.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+ * ENODEV - The group isn't synchronized
+ *
+ * \param ports
+ *        The ports the group was synchronized with
+ * \param count
+ *        The number of ports in the group
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_group_sync_disable(const int8_t* const ports, const uint8_t count);
+
+/******************************************************************************/
+/**                         Motor snapshot functions                         **/
+/**                                                                          **/
+/**   These functions allow programmers to read a motor's full telemetry     **/
+/**   without contending for the motor's port                                **/
+/******************************************************************************/
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * Holds a copy of a motor's telemetry as it was captured by the system daemon.
+ *
+ * The system daemon refreshes this copy for every registered motor once per
+ * cycle (every 2 ms), immediately after VEXos updates its device data.
+ */
+typedef struct motor_snapshot_s {
+	double position;          // The position in the motor's encoder units
+	double velocity;          // The actual velocity in RPM
+	double power;             // The power drawn in Watts
+	double torque;            // The torque generated in Newton Meters (Nm)
+	double efficiency;        // The efficiency as a percentage
+	double temperature;       // The temperature in degrees Celsius
+	int32_t current_draw;     // The current drawn in mA
+	int32_t voltage;          // The voltage delivered in mV
+	int32_t direction;        // 1 for moving in the positive direction, -1 for negative
+	uint32_t faults;          // A bitfield containing the motor's faults
+	uint32_t flags;           // A bitfield containing the motor's flags
+	uint32_t timestamp;       // The time in ms when this snapshot was captured
+	int32_t raw_position;     // The raw encoder count, as from motor_get_raw_position()
+	int32_t scaled_position;  // raw_position times the motor's position scale, see motor_set_position_scale()
+	uint32_t updated_us;      // The micros() time the daemon first saw this data, see vdml_get_last_update()
+} motor_snapshot_s_t;
+
+/**
+ * Converts a number of output units per raw encoder count to the 16.16 fixed
+ * point scale motor_set_position_scale() takes. With a constant argument this
+ * is evaluated at compile time.
+ *
+ * For example, to get micrometres travelled by a 4" wheel on a 200 RPM motor,
+ * which counts 900 per revolution:
+ *
+ * motor_set_position_scale(1, MOTOR_POSITION_SCALE(4 * 25400 * 3.14159265 / 900));
+ */
+#define MOTOR_POSITION_SCALE(units_per_count) ((int32_t)((units_per_count)*65536.0))
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Gets the most recent telemetry snapshot of the motor.
+ *
+ * Unlike the individual telemetry getters, this function does not take the
+ * motor's port, so it never blocks on the system daemon or other tasks using
+ * the motor. The values are at most one daemon cycle (2 ms) old; check the
+ * timestamp field to see exactly when they were captured.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENODEV - No motor has been captured on the port
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] snapshot
+ *             The snapshot to fill with the motor's telemetry
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_get_snapshot(uint8_t port, motor_snapshot_s_t* const snapshot);
+
+/**
+ * Sets the scale the system daemon converts the motor's raw encoder count to
+ * scaled_position with.
+ *
+ * The conversion is done in integer arithmetic once per daemon cycle, as
+ * (raw_position * scale) >> 16, so consumers which need the position in their
+ * own units (e.g. odometry) don't repeat floating point conversions on every
+ * read. Keep |raw_position * scale| below 2^47 so the result fits in 32 bits.
+ * The scale is 0 by default, which leaves scaled_position at 0.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param scale
+ *        The output units per raw encoder count as 16.16 fixed point, see
+ *        MOTOR_POSITION_SCALE()
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_set_position_scale(uint8_t port, const int32_t scale);
+
+/**
+ * Gets the scaled positions of several motors, all from the same daemon cycle.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - port_mask is 0 or has bits above port 22, or positions is NULL
+ * ENODEV - No motor has been captured on one of the ports
+ *
+ * \param port_mask
+ *        A bitmask of the ports to read, bit 0 being port 1
+ * \param[out] positions
+ *             Filled with one scaled_position per port in the mask, in order
+ *             of increasing port number
+ * \param[out] timestamp
+ *             If not NULL, set to the time in ms the positions were captured
+ *
+ * \return The number of positions read, or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t motor_get_scaled_positions(uint32_t port_mask, int32_t* const positions, uint32_t* const timestamp);
+
+/******************************************************************************/
+/**                           Motor fault events                             **/
+/**                                                                          **/
+/**   The system daemon compares every motor's faults with the last cycle's  **/
+/**   and calls a handler when one it watches is raised or cleared, so the   **/
+/**   faults don't have to be polled                                         **/
+/******************************************************************************/
+
+/**
+ * Called when one of the faults a handler watches is raised or cleared.
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param faults
+ *        The motor's faults now, a bitfield of motor_fault_e_t
+ * \param changed
+ *        The watched faults which were raised or cleared, those set in faults
+ *        having been raised
+ * \param param
+ *        The parameter given to motor_on_fault()
+ */
+typedef void (*motor_fault_fn_t)(uint8_t port, uint32_t faults, uint32_t changed, void* param);
+
+/**
+ * Sets the handler called when the given faults of the motor are raised or
+ * cleared.
+ *
+ * The handler runs in the system daemon task within one cycle (2 ms) of the
+ * change, after the ports have been released, so it may use device functions
+ * but must return quickly and must not block (e.g. notify a task rather than
+ * doing the work in the handler). Faults which are already raised when the
+ * handler is set are reported on the next cycle.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * EINVAL - The mask is 0 while a handler is given
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param mask
+ *        The faults to watch, a bitfield of motor_fault_e_t
+ * \param callback
+ *        The function to call, or NULL to remove the port's handler
+ * \param param
+ *        The parameter passed to the handler
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_on_fault(uint8_t port, const uint32_t mask, motor_fault_fn_t callback, void* param);
+
+/******************************************************************************/
+/**                        Motor telemetry functions                         **/
+/**                                                                          **/
+/**   These functions let the system daemon record motor telemetry into a    **/
+/**   buffer at the smart port update rate for later bulk reads              **/
+/******************************************************************************/
+
+/**
+ * The number of samples the telemetry buffer holds.
+ */
+#define MOTOR_TELEMETRY_BUFFER_SIZE 256
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * A telemetry sample recorded by the system daemon.
+ */
+typedef struct motor_telemetry_sample_s {
+	uint32_t timestamp;    // The time in ms when the sample was recorded
+	uint8_t port;          // The V5 port number from 1-21
+	double position;       // The position in the motor's encoder units
+	double velocity;       // The actual velocity in RPM
+	int32_t current_draw;  // The current drawn in mA
+	int32_t voltage;       // The voltage delivered in mV
+} motor_telemetry_sample_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Starts recording telemetry for the given motors.
+ *
+ * Every divisor-th system daemon cycle (every 2 ms), a sample is appended to
+ * the telemetry buffer for every selected motor. Calling this function again
+ * replaces the selection; a port mask of 0 stops recording.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The divisor is 0 or the mask selects ports outside of 1-21
+ *
+ * \param port_mask
+ *        A bitmap of the ports to record, where bit 0 is port 1
+ * \param divisor
+ *        The number of daemon cycles between samples
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_telemetry_enable(uint32_t port_mask, uint32_t divisor);
+
+/**
+ * Removes the oldest samples from the telemetry buffer.
+ *
+ * Only one task should read the telemetry buffer. If the buffer is full, new
+ * samples are dropped until it is read; see motor_telemetry_get_dropped().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - buffer is NULL
+ *
+ * \param[out] buffer
+ *             The array to copy the samples into
+ * \param count
+ *        The maximum number of samples to copy
+ *
+ * \return The number of samples copied or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t motor_telemetry_read(motor_telemetry_sample_s_t* const buffer, uint32_t count);
+
+/**
+ * Gets the number of samples dropped because the telemetry buffer was full.
+ *
+ * \return The number of samples dropped since recording was enabled
+ */
+uint32_t motor_telemetry_get_dropped(void);
+
+/******************************************************************************/
+/**                     Motor current budget functions                       **/
+/**                                                                          **/
+/**   These functions let the system daemon share a total current budget     **/
+/**   between the motors every cycle, by setting their current limits        **/
+/******************************************************************************/
+
+/**
+ * Starts sharing a total current budget between all of the motors.
+ *
+ * Every system daemon cycle (every 2 ms), straight after the motors are
+ * sampled, each motor is first given the current it is drawing plus a few
+ * hundred mA so it can speed up, and then a share of what is left. Both steps
+ * go from the highest priority motors to the lowest, see
+ * motor_current_budget_set_priority(), and no motor gets more than the limit
+ * set with motor_set_current_limit(). The total of the limits never exceeds
+ * the budget, so the brain doesn't have to throttle motors of its own accord.
+ *
+ * While the budget is enabled, motor_set_current_limit() sets the most the
+ * budget gives the motor, and motor_get_current_limit() reports the current
+ * allocation.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The total is not positive
+ *
+ * \param total
+ *        The total current in mA to share between the motors
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_current_budget_enable(const int32_t total);
+
+/**
+ * Stops sharing the current budget. Each motor gets back the limit set with
+ * motor_set_current_limit() on the next daemon cycle.
+ *
+ * \return 1
+ */
+int32_t motor_current_budget_disable(void);
+
+/**
+ * Sets a motor's priority for the current budget. Higher priority motors are
+ * given current first, and motors with the same priority share what is left
+ * in proportion to what they want. Every motor starts with a priority of 0.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param priority
+ *        The motor's priority, from 0 (lowest) to 255
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_current_budget_set_priority(uint8_t port, const uint8_t priority);
+
+/**
+ * Gets the current limit the budget last gave a motor.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * EINVAL - The current budget isn't enabled
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ *
+ * \return The motor's current limit in mA, or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t motor_current_budget_get_allocation(uint8_t port);
+
 #ifdef __cplusplus
 }  // namespace c
 }  // namespace pros
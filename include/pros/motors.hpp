@@ -20,6 +20,8 @@
 #define _PROS_MOTORS_HPP_
 
 #include <cstdint>
+#include <initializer_list>
+#include <vector>
 #include "pros/motors.h"
 
 namespace pros {
@@ -814,6 +816,148 @@ class Motor {
 	 */
 	virtual std::int32_t get_voltage_limit(void) const;
 
+	/**
+	 * Gets all of the motor's telemetry at once.
+	 *
+	 * This is equivalent to calling each of the telemetry getters, but only
+	 * claims the motor's port once.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - The port cannot be configured as a motor
+	 *
+	 * Additionally, in an error state all values of the returned struct are set
+	 * to PROS_ERR or PROS_ERR_F.
+	 *
+	 * \return A motor_state_s_t containing the motor's telemetry
+	 */
+	virtual motor_state_s_t get_state(void) const;
+
+	/**
+	 * Gets the most recent telemetry snapshot of the motor.
+	 *
+	 * Unlike the individual telemetry getters, this function does not take the
+	 * motor's port, so it never blocks on the system daemon or other tasks using
+	 * the motor. The values are at most one daemon cycle (2 ms) old.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - No motor has been captured on the port
+	 *
+	 * Additionally, in an error state all values of the returned struct are set
+	 * to PROS_ERR or PROS_ERR_F and the timestamp is set to 0.
+	 *
+	 * \return A motor_snapshot_s_t containing the motor's telemetry
+	 */
+	virtual motor_snapshot_s_t snapshot(void) const;
+
+	/**
+	 * Sets the scale the system daemon converts the motor's raw encoder count to
+	 * the snapshot's scaled_position with. See motor_set_position_scale().
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - The given value is not within the range of V5 ports (1-21).
+	 *
+	 * \param scale
+	 *        The output units per raw encoder count as 16.16 fixed point, see
+	 *        MOTOR_POSITION_SCALE()
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t set_position_scale(const std::int32_t scale) const;
+
+	/**
+	 * Sets the handler called when the given faults of the motor are raised or
+	 * cleared. See motor_on_fault().
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENXIO - The given value is not within the range of V5 ports (1-21).
+	 * EINVAL - The mask is 0 while a handler is given
+	 *
+	 * \param mask
+	 *        The faults to watch, a bitfield of motor_fault_e_t
+	 * \param callback
+	 *        The function to call, or NULL to remove the motor's handler
+	 * \param param
+	 *        The parameter passed to the handler
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t on_fault(const std::uint32_t mask, c::motor_fault_fn_t callback, void* param) const;
+
+	/****************************************************************************/
+	/**                       Motor controller functions                       **/
+	/**                                                                        **/
+	/**  These functions let the system daemon run a PID loop for the motor,   **/
+	/**  using the sensor values VEXos has just updated                        **/
+	/****************************************************************************/
+
+	/**
+	 * Starts running a controller for the motor in the system daemon.
+	 *
+	 * The controller starts with a target of 0 and overrides any other movement
+	 * command sent to the motor until disable_controller() is called.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - The port cannot be configured as a motor
+	 * EINVAL - The controller's slew is negative
+	 *
+	 * \param controller
+	 *        The controller's configuration
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t enable_controller(const motor_controller_s_t& controller) const;
+
+	/**
+	 * Sets the target of the motor's controller.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - No controller is enabled for the motor
+	 *
+	 * \param target
+	 *        The new target, see motor_controller_mode_e_t for its units
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t set_controller_target(const double target) const;
+
+	/**
+	 * Stops running the motor's controller and stops the motor.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - The port cannot be configured as a motor
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t disable_controller(void) const;
+
+	/**
+	 * Sets whether the motor's voltage and velocity commands are left for the
+	 * system daemon to send. See pros::c::motor_set_command_batching().
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * ENODEV - The port cannot be configured as a motor
+	 *
+	 * \param enable
+	 *        Whether to batch the motor's commands
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t set_command_batching(const bool enable) const;
+
 	/**
 	 * Gets the port number of the motor.
 	 *
@@ -825,6 +969,386 @@ class Motor {
 	const std::uint8_t _port;
 };
 
+class MotorGroup {
+	public:
+	/**
+	 * Creates a MotorGroup object for the given ports.
+	 *
+	 * A negative port number reverses every command sent to that motor, which
+	 * makes it easy to drive mirrored motors with the same command. This is
+	 * independent of the motor's own reversal flag (see Motor::set_reversed()).
+	 *
+	 * \param ports
+	 *        The V5 port numbers from 1-21, or -1 to -21 to reverse
+	 */
+	explicit MotorGroup(const std::initializer_list<std::int8_t> ports);
+
+	explicit MotorGroup(const std::vector<std::int8_t>& ports);
+
+	/****************************************************************************/
+	/**                       Motor group movement functions                   **/
+	/**                                                                        **/
+	/**   These functions validate and claim every port of the group before    **/
+	/**   sending any command, so all of the motors receive their command in   **/
+	/**   the same system daemon cycle                                         **/
+	/****************************************************************************/
+
+	/**
+	 * Sets the voltage for every motor in the group from -127 to 127.
+	 *
+	 * This is equivalent to calling Motor::move() on every motor of the group.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The group is empty
+	 * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+	 * ENODEV - One of the ports cannot be configured as a motor
+	 * EACCES - Another resource is currently trying to access one of the ports.
+	 *
+	 * \param voltage
+	 *        The new motor voltage from -127 to 127
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno. If the operation failed, no motor was commanded.
+	 */
+	virtual std::int32_t operator=(std::int32_t voltage) const;
+
+	virtual std::int32_t move(std::int32_t voltage) const;
+
+	/**
+	 * Sets the target absolute position for every motor in the group.
+	 *
+	 * This is equivalent to calling Motor::move_absolute() on every motor of the
+	 * group.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The group is empty
+	 * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+	 * ENODEV - One of the ports cannot be configured as a motor
+	 * EACCES - Another resource is currently trying to access one of the ports.
+	 *
+	 * \param position
+	 *        The absolute position to move to in the motors' encoder units
+	 * \param velocity
+	 *        The maximum allowable velocity for the movement in RPM
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno. If the operation failed, no motor was commanded.
+	 */
+	virtual std::int32_t move_absolute(const double position, const std::int32_t velocity) const;
+
+	/**
+	 * Sets the relative target position for every motor in the group.
+	 *
+	 * This is equivalent to calling Motor::move_relative() on every motor of the
+	 * group.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The group is empty
+	 * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+	 * ENODEV - One of the ports cannot be configured as a motor
+	 * EACCES - Another resource is currently trying to access one of the ports.
+	 *
+	 * \param position
+	 *        The relative position to move to in the motors' encoder units
+	 * \param velocity
+	 *        The maximum allowable velocity for the movement in RPM
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno. If the operation failed, no motor was commanded.
+	 */
+	virtual std::int32_t move_relative(const double position, const std::int32_t velocity) const;
+
+	/**
+	 * Sets the velocity for every motor in the group.
+	 *
+	 * This is equivalent to calling Motor::move_velocity() on every motor of the
+	 * group.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The group is empty
+	 * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+	 * ENODEV - One of the ports cannot be configured as a motor
+	 * EACCES - Another resource is currently trying to access one of the ports.
+	 *
+	 * \param velocity
+	 *        The new motor velocity from +-100, +-200, or +-600 depending on the
+	 *        motors' gearsets
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno. If the operation failed, no motor was commanded.
+	 */
+	virtual std::int32_t move_velocity(const std::int32_t velocity) const;
+
+	/**
+	 * Sets the output voltage for every motor in the group from -12000 to 12000
+	 * in millivolts.
+	 *
+	 * This is equivalent to calling Motor::move_voltage() on every motor of the
+	 * group.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The group is empty
+	 * ENXIO - One of the ports is not within the range of V5 ports (1-21).
+	 * ENODEV - One of the ports cannot be configured as a motor
+	 * EACCES - Another resource is currently trying to access one of the ports.
+	 *
+	 * \param voltage
+	 *        The new voltage value from -12000 to 12000
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno. If the operation failed, no motor was commanded.
+	 */
+	virtual std::int32_t move_voltage(const std::int32_t voltage) const;
+
+	/****************************************************************************/
+	/**                     Motor group synchronization                        **/
+	/****************************************************************************/
+
+	/**
+	 * Starts keeping the motors of the group in step, by trimming each motor's
+	 * velocity or voltage command in the system daemon every cycle.
+	 *
+	 * See pros::c::motor_group_sync_enable() for how the correction works and
+	 * the values of errno it sets.
+	 *
+	 * \param gains
+	 *        The correction's gains
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t sync_enable(const motor_sync_gains_s_t& gains) const;
+
+	/**
+	 * Changes the gains of the group's synchronization, see
+	 * pros::c::motor_group_sync_set_gains().
+	 */
+	virtual std::int32_t sync_set_gains(const motor_sync_gains_s_t& gains) const;
+
+	/**
+	 * Gets how well the group is keeping in step, see
+	 * pros::c::motor_group_sync_get_stats().
+	 *
+	 * \return The statistics, all 0 if the group isn't synchronized, setting
+	 * errno
+	 */
+	virtual motor_sync_stats_s_t sync_get_stats(void) const;
+
+	/**
+	 * Stops keeping the motors of the group in step, see
+	 * pros::c::motor_group_sync_disable().
+	 */
+	virtual std::int32_t sync_disable(void) const;
+
+	/**
+	 * Gets the port numbers of the group, as given to the constructor.
+	 *
+	 * \return The group's port numbers
+	 */
+	virtual std::vector<std::int8_t> get_ports(void) const;
+
+	/**
+	 * Gets the number of motors in the group.
+	 *
+	 * \return The number of motors in the group
+	 */
+	virtual std::uint8_t size(void) const;
+
+	private:
+	const std::vector<std::int8_t> _ports;
+};
+
+/**
+ * A Motor whose port and configuration are fixed at compile time.
+ *
+ * The port is checked with a static_assert, so a miswired port number is a
+ * compile error rather than an ENXIO at runtime, and the gearset and
+ * reversal are applied once on construction.
+ *
+ * \tparam Port
+ *         The V5 port number from 1-21
+ * \tparam Gearset
+ *         The motor's gearset
+ * \tparam Reversed
+ *         True reverses the motor, false is default
+ */
+template <std::uint8_t Port, motor_gearset_e_t Gearset = E_MOTOR_GEARSET_18, bool Reversed = false>
+class StaticMotor : public Motor {
+	static_assert(Port >= 1 && Port <= 21, "V5 ports must be between 1 and 21");
+
+	public:
+	StaticMotor() : Motor(Port, Gearset, Reversed) {}
+
+	static constexpr std::uint8_t port = Port;
+	static constexpr motor_gearset_e_t gearset = Gearset;
+	static constexpr bool reversed = Reversed;
+};
+
+/**
+ * A Motor without virtual functions, for tight control loops.
+ *
+ * Every function is defined here and calls the C API directly, so the
+ * compiler can inline it into the caller instead of going through Motor's
+ * vtable and an out-of-line wrapper. The motor's configuration is shared with
+ * every other object on the same port, since it lives in the kernel.
+ *
+ * It can't be overridden or used through a Motor reference; as_motor() gives
+ * a Motor for code which needs one.
+ */
+class InlineMotor final {
+	public:
+	/**
+	 * Creates an InlineMotor object for the given port. See Motor::Motor() for
+	 * the parameters and errors.
+	 */
+	explicit InlineMotor(const std::uint8_t port, const motor_gearset_e_t gearset, const bool reverse,
+	                     const motor_encoder_units_e_t encoder_units)
+	    : _port(port) {
+		c::motor_set_gearing(port, gearset);
+		c::motor_set_reversed(port, reverse);
+		c::motor_set_encoder_units(port, encoder_units);
+	}
+
+	explicit InlineMotor(const std::uint8_t port, const motor_gearset_e_t gearset, const bool reverse) : _port(port) {
+		c::motor_set_gearing(port, gearset);
+		c::motor_set_reversed(port, reverse);
+	}
+
+	explicit InlineMotor(const std::uint8_t port, const motor_gearset_e_t gearset) : _port(port) {
+		c::motor_set_gearing(port, gearset);
+	}
+
+	explicit InlineMotor(const std::uint8_t port) : _port(port) {}
+
+	/**
+	 * The movement functions. See the Motor functions of the same names.
+	 */
+	std::int32_t operator=(std::int32_t voltage) const {
+		return c::motor_move(_port, voltage);
+	}
+
+	std::int32_t move(std::int32_t voltage) const {
+		return c::motor_move(_port, voltage);
+	}
+
+	std::int32_t move_absolute(const double position, const std::int32_t velocity) const {
+		return c::motor_move_absolute(_port, position, velocity);
+	}
+
+	std::int32_t move_relative(const double position, const std::int32_t velocity) const {
+		return c::motor_move_relative(_port, position, velocity);
+	}
+
+	std::int32_t move_velocity(const std::int32_t velocity) const {
+		return c::motor_move_velocity(_port, velocity);
+	}
+
+	std::int32_t move_voltage(const std::int32_t voltage) const {
+		return c::motor_move_voltage(_port, voltage);
+	}
+
+	std::int32_t modify_profiled_velocity(const std::int32_t velocity) const {
+		return c::motor_modify_profiled_velocity(_port, velocity);
+	}
+
+	std::int32_t set_command_batching(const bool enable) const {
+		return c::motor_set_command_batching(_port, enable);
+	}
+
+	/**
+	 * The telemetry functions. See the Motor functions of the same names.
+	 */
+	double get_position(void) const {
+		return c::motor_get_position(_port);
+	}
+
+	double get_actual_velocity(void) const {
+		return c::motor_get_actual_velocity(_port);
+	}
+
+	double get_target_position(void) const {
+		return c::motor_get_target_position(_port);
+	}
+
+	std::int32_t get_target_velocity(void) const {
+		return c::motor_get_target_velocity(_port);
+	}
+
+	std::int32_t get_current_draw(void) const {
+		return c::motor_get_current_draw(_port);
+	}
+
+	std::int32_t get_voltage(void) const {
+		return c::motor_get_voltage(_port);
+	}
+
+	double get_power(void) const {
+		return c::motor_get_power(_port);
+	}
+
+	double get_torque(void) const {
+		return c::motor_get_torque(_port);
+	}
+
+	double get_temperature(void) const {
+		return c::motor_get_temperature(_port);
+	}
+
+	std::int32_t get_direction(void) const {
+		return c::motor_get_direction(_port);
+	}
+
+	std::int32_t is_stopped(void) const {
+		return c::motor_is_stopped(_port);
+	}
+
+	/**
+	 * Gets the motor's snapshot from the last system daemon cycle.
+	 *
+	 * Unlike Motor::snapshot(), the fields aren't set to PROS_ERR on failure, so
+	 * check the return value instead.
+	 *
+	 * \param[out] snapshot
+	 *             The snapshot to fill
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t snapshot(motor_snapshot_s_t* const snapshot) const {
+		return c::motor_get_snapshot(_port, snapshot);
+	}
+
+	std::int32_t set_position_scale(const std::int32_t scale) const {
+		return c::motor_set_position_scale(_port, scale);
+	}
+
+	/**
+	 * Gets the port number of the motor.
+	 *
+	 * \return The motor's port number.
+	 */
+	std::uint8_t get_port(void) const {
+		return _port;
+	}
+
+	/**
+	 * Gets a Motor on the same port, for code which takes a Motor.
+	 *
+	 * \return A Motor for the port, sharing this one's configuration
+	 */
+	Motor as_motor(void) const {
+		return Motor(_port);
+	}
+
+	private:
+	const std::uint8_t _port;
+};
+
 namespace literals {
 const pros::Motor operator"" _mtr(const unsigned long long int m);
 const pros::Motor operator"" _rmtr(const unsigned long long int m);
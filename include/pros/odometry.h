@@ -0,0 +1,284 @@
+/**
+ * \file pros/odometry.h
+ *
+ * Contains prototypes for the kernel's odometry, which tracks the robot's
+ * position from its tracking wheels and an Inertial Sensor.
+ *
+ * The position is worked out by the system daemon every 2 ms, straight after
+ * VEXos updates its device data, so it is always based on the latest readings
+ * and a steady time step no matter how busy the user's tasks are.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_ODOMETRY_H_
+#define _PROS_ODOMETRY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+namespace pros {
+namespace c {
+#endif
+
+/**
+ * The sensor a tracking wheel is read from.
+ */
+typedef enum odom_source_e {
+	E_ODOM_SOURCE_NONE = 0,     // No wheel
+	E_ODOM_SOURCE_ADI_ENCODER,  // An encoder set up with adi_encoder_init()
+	E_ODOM_SOURCE_MOTOR         // A motor's position, in the units set with motor_set_encoder_units()
+} odom_source_e_t;
+
+/**
+ * A tracking wheel.
+ */
+typedef struct odom_wheel_s {
+	odom_source_e_t source;
+	// The encoder's top port (from 1-8, 'a'-'h', 'A'-'H'), or the motor's port
+	// (from 1-21)
+	uint8_t port;
+	// Counts the wheel's readings the other way round
+	bool reversed;
+	// The distance the wheel rolls for each tick or motor position unit. The
+	// pose's x and y are in the same units of distance.
+	double distance_per_tick;
+	// For the forward wheel, how far it is to the right of the tracking center.
+	// For the sideways wheel, how far it is in front of the tracking center.
+	double offset;
+} odom_wheel_s_t;
+
+/**
+ * The sensors the odometry uses.
+ */
+typedef struct odom_config_s {
+	// A wheel which rolls as the robot drives forward
+	odom_wheel_s_t forward;
+	// A wheel which rolls as the robot moves sideways, to the right when its
+	// readings increase. Its source is E_ODOM_SOURCE_NONE if the robot doesn't
+	// have one, in which case the robot is assumed not to slide sideways.
+	odom_wheel_s_t sideways;
+	// The Inertial Sensor's port (from 1-21), which gives the robot's heading
+	uint8_t imu_port;
+} odom_config_s_t;
+
+/**
+ * The robot's position.
+ *
+ * x and y are measured from where the robot was when the odometry was started
+ * or its pose was last set, with y pointing the way the robot faces when theta
+ * is 0 and x to the right of that.
+ */
+typedef struct odom_pose_s {
+	double x;
+	double y;
+	double theta;        // The heading in degrees, increasing clockwise like imu_get_rotation()
+	uint32_t timestamp;  // The millis() time the pose was worked out
+} odom_pose_s_t;
+
+/**
+ * Starts tracking the robot's position with the given sensors, from a pose of
+ * 0, 0, 0.
+ *
+ * If the odometry is already running, it switches to the new sensors and
+ * starts over. Cycles in which one of the sensors is unplugged, or the
+ * Inertial Sensor is calibrating, are skipped, so motion during them is lost.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - config is NULL, the forward wheel has no source, or a wheel's
+ * distance_per_tick is 0
+ * ENXIO - A port is not within the range of ADI or V5 ports
+ *
+ * \param config
+ *        The sensors to use, which are copied
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t odom_start(const odom_config_s_t* config);
+
+/**
+ * Stops tracking the robot's position.
+ */
+void odom_stop(void);
+
+/**
+ * Sets where the robot is, e.g. at the start of an autonomous routine.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The odometry isn't running
+ *
+ * \param x
+ *        The robot's new x coordinate
+ * \param y
+ *        The robot's new y coordinate
+ * \param theta
+ *        The robot's new heading in degrees
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t odom_set_pose(double x, double y, double theta);
+
+/**
+ * Gets the robot's latest pose.
+ *
+ * This doesn't take any lock, so it is cheap enough to call as often as
+ * needed.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - pose is NULL or the odometry isn't running
+ *
+ * \param[out] pose
+ *             The pose to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t odom_get_pose(odom_pose_s_t* pose);
+
+/******************************************************************************/
+/**                              Path following                              **/
+/**                                                                          **/
+/**  The system daemon can steer a differential drive along a path with      **/
+/**  pure pursuit, straight after each odometry update, and send the wheel   **/
+/**  velocities to the drive motors in the same cycle                        **/
+/******************************************************************************/
+
+/**
+ * The most motors on each side of the drive
+ */
+#define PATH_FOLLOW_MAX_MOTORS 4
+
+/**
+ * A point on a path.
+ */
+typedef struct path_point_s {
+	double x;
+	double y;
+	double velocity;  // The forward speed to drive at from this point, in distance per second
+} path_point_s_t;
+
+/**
+ * How to follow a path, in the units of distance of the odometry.
+ */
+typedef struct path_follow_config_s {
+	// The drive motors' ports from 1-21, 0 for none. A negative port reverses
+	// the motor
+	int8_t left_ports[PATH_FOLLOW_MAX_MOTORS];
+	int8_t right_ports[PATH_FOLLOW_MAX_MOTORS];
+	// The distance between the left and right wheels
+	double track_width;
+	// How far ahead along the path the robot steers towards. Longer is smoother
+	// but cuts corners
+	double lookahead;
+	// The motor RPM which drives its side of the robot at one unit of distance
+	// per second
+	double rpm_per_speed;
+	// How close to the last point the robot has to get for the path to end
+	double end_tolerance;
+} path_follow_config_s_t;
+
+/**
+ * The progress along the path, as of the daemon's latest cycle.
+ */
+typedef struct path_follow_status_s {
+	uint32_t closest;    // The index of the point closest to the robot
+	double lookahead_x;  // The point the robot is steering towards
+	double lookahead_y;
+	double curvature;    // One over the radius of the arc being driven, positive to the right
+	double left_rpm;     // The velocities sent to the motors, before reversing
+	double right_rpm;
+	bool running;
+	uint32_t timestamp;  // The millis() time of the update
+} path_follow_status_s_t;
+
+/**
+ * Starts following a path with the drive motors.
+ *
+ * The points aren't copied, so they must stay in memory until the path ends or
+ * path_follow_stop() is called; e.g. a file loaded with usd_load_file(). Each
+ * daemon cycle continues the search for the closest point and the lookahead
+ * point from where the last one left off, so long paths cost no more than
+ * short ones and the robot can't skip ahead to where the path doubles back.
+ *
+ * Until the path ends, the drive motors are given velocities every cycle. A
+ * motor with a velocity controller from motor_controller_enable() has its
+ * target set instead, and a motor running a trajectory or a position
+ * controller is left alone. Once the robot is within end_tolerance of the last
+ * point, or has driven past it, the motors are told to hold a velocity of 0.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - points or config is NULL, there are fewer than 2 points, there
+ * are no drive motors, the lookahead, track width or rpm_per_speed isn't
+ * positive, or the odometry isn't running
+ * ENXIO - A drive port is not within the range of V5 ports (1-21)
+ *
+ * \param points
+ *        The path's points, in order
+ * \param num_points
+ *        The number of points
+ * \param config
+ *        How to follow the path, which is copied
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t path_follow_start(const path_point_s_t* points, uint32_t num_points, const path_follow_config_s_t* config);
+
+/**
+ * Stops following the path early, stopping the drive motors.
+ */
+void path_follow_stop(void);
+
+/**
+ * Gets the progress along the path.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - status is NULL or no path has been started
+ *
+ * \param[out] status
+ *             The status to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t path_follow_get_status(path_follow_status_s_t* status);
+
+/**
+ * Waits for the path to end.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EAGAIN - The scheduler isn't running, so the path can't advance
+ * ETIMEDOUT - The path didn't end before the timeout
+ *
+ * \param timeout
+ *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t path_follow_wait(uint32_t timeout);
+
+#ifdef __cplusplus
+}
+}
+}
+#endif
+
+#endif  // _PROS_ODOMETRY_H_
@@ -0,0 +1,242 @@
+/**
+ * \file pros/pmr.hpp
+ *
+ * Contains std::pmr memory resources built on kernel memory pools and arenas.
+ *
+ * The std::pmr containers (std::pmr::vector, std::pmr::map, ...) take a
+ * std::pmr::memory_resource instead of an allocator type, so one of these can
+ * be handed to them without any allocator boilerplate, e.g.
+ *
+ * pros::pmr::arena_resource<4096> scratch;
+ * while (true) {
+ *   {
+ *     std::pmr::vector<Point> points(&scratch);
+ *     ...
+ *   }
+ *   scratch.release();
+ *   pros::delay(10);
+ * }
+ *
+ * Neither resource goes to the heap unless it's given an upstream resource to
+ * fall back on. By default that is std::pmr::null_memory_resource(), whose
+ * allocations throw std::bad_alloc, so a loop which outgrows its resource
+ * fails loudly instead of quietly taking malloc()'s lock. Fallbacks to
+ * std::pmr::new_delete_resource() show up in heap_get_stats().
+ *
+ * This header is not included by api.h, so include it directly.
+ *
+ * This file should not be modified by users, since it gets replaced whenever
+ * a kernel upgrade occurs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _PROS_PMR_HPP_
+#define _PROS_PMR_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#include "pros/rtos.hpp"
+
+namespace pros {
+namespace pmr {
+/**
+ * A memory resource which hands out the N blocks of BlockSize bytes of a
+ * kernel memory pool.
+ *
+ * Suits containers which allocate one node at a time, such as std::pmr::list,
+ * std::pmr::map and std::pmr::unordered_map's nodes. Allocating and freeing
+ * never lock anything, so the resource may be shared between tasks.
+ * Allocations which are larger than a block or more aligned than
+ * POOL_ALIGNMENT, or which find every block in use, go to the upstream
+ * resource and are counted by misses().
+ *
+ * The resource must outlive everything allocated from it.
+ */
+template <std::size_t BlockSize, std::size_t N>
+class pool_resource : public std::pmr::memory_resource {
+	static_assert(N > 0 && BlockSize > 0, "Invalid pros::pmr::pool_resource size");
+
+	public:
+	/**
+	 * Creates the pool.
+	 *
+	 * \param upstream
+	 *        The resource to fall back on for allocations the pool can't take
+	 */
+	explicit pool_resource(std::pmr::memory_resource* upstream = std::pmr::null_memory_resource()) noexcept
+	    : pool(c::pool_create_static(BlockSize, N, storage)), upstream(upstream) {}
+
+	pool_resource(const pool_resource&) = delete;
+	pool_resource& operator=(const pool_resource&) = delete;
+
+	/**
+	 * \return The number of blocks which aren't in use.
+	 */
+	std::uint32_t available(void) const {
+		return c::pool_get_free(pool);
+	}
+
+	/**
+	 * \return The number of allocations which went to the upstream resource.
+	 */
+	std::uint32_t misses(void) const noexcept {
+		return miss_count.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * \return The resource which allocations the pool can't take go to.
+	 */
+	std::pmr::memory_resource* upstream_resource(void) const noexcept {
+		return upstream;
+	}
+
+	protected:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+		if (bytes <= BlockSize && alignment <= detail::pool_alignment) {
+			void* block = c::pool_alloc(pool);
+			if (block != nullptr) return block;
+		}
+		miss_count.fetch_add(1, std::memory_order_relaxed);
+		return upstream->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+		if (owns(ptr)) {
+			c::pool_free(pool, ptr);
+		} else {
+			upstream->deallocate(ptr, bytes, alignment);
+		}
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+
+	private:
+	static constexpr std::size_t stride = (BlockSize + detail::pool_alignment - 1) & ~(detail::pool_alignment - 1);
+
+	bool owns(const void* ptr) const noexcept {
+		auto const addr = reinterpret_cast<std::uintptr_t>(ptr);
+		auto const start = reinterpret_cast<std::uintptr_t>(storage);
+		return addr >= start && addr < start + sizeof(storage);
+	}
+
+	alignas(detail::pool_alignment) unsigned char storage[detail::pool_header_size + N * stride];
+	c::pool_t pool;
+	std::pmr::memory_resource* upstream;
+	std::atomic<std::uint32_t> miss_count{0};
+};
+
+/**
+ * A memory resource which bumps allocations off Size bytes of its own, for
+ * scratch memory which is all thrown away at once.
+ *
+ * Allocating is a pointer bump and deallocating does nothing. release() makes
+ * the whole arena free again, e.g. at the end of each control loop iteration,
+ * after everything allocated from it has been destroyed. Allocations which
+ * don't fit go to the upstream resource, are counted by misses() and are given
+ * back to it when they're deallocated.
+ *
+ * An arena isn't safe to use from more than one task at a time. It must
+ * outlive everything allocated from it.
+ */
+template <std::size_t Size>
+class arena_resource : public std::pmr::memory_resource {
+	static_assert(Size > 0, "Invalid pros::pmr::arena_resource size");
+
+	public:
+	/**
+	 * Creates the arena.
+	 *
+	 * \param upstream
+	 *        The resource to fall back on for allocations which don't fit
+	 */
+	explicit arena_resource(std::pmr::memory_resource* upstream = std::pmr::null_memory_resource()) noexcept
+	    : upstream(upstream) {}
+
+	arena_resource(const arena_resource&) = delete;
+	arena_resource& operator=(const arena_resource&) = delete;
+
+	/**
+	 * Makes the whole arena free again. Anything still allocated from it is
+	 * overwritten by later allocations.
+	 */
+	void release(void) noexcept {
+		top = 0;
+	}
+
+	/**
+	 * \return The number of bytes allocated since the last release(),
+	 *         including alignment padding.
+	 */
+	std::size_t used(void) const noexcept {
+		return top;
+	}
+
+	/**
+	 * \return The most bytes there have ever been allocated at once. An arena
+	 *         can be sized by running with a large one and checking this.
+	 */
+	std::size_t peak(void) const noexcept {
+		return peak_top;
+	}
+
+	/**
+	 * \return The number of allocations which went to the upstream resource.
+	 */
+	std::uint32_t misses(void) const noexcept {
+		return miss_count;
+	}
+
+	/**
+	 * \return The resource which allocations that don't fit go to.
+	 */
+	std::pmr::memory_resource* upstream_resource(void) const noexcept {
+		return upstream;
+	}
+
+	protected:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+		// Even an empty allocation takes a byte, so none of them are at the end of the storage
+		if (bytes == 0) bytes = 1;
+		auto const start = reinterpret_cast<std::uintptr_t>(storage);
+		std::uintptr_t const addr = (start + top + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+		if (addr - start <= Size && bytes <= Size - (addr - start)) {
+			top = addr - start + bytes;
+			if (top > peak_top) peak_top = top;
+			return reinterpret_cast<void*>(addr);
+		}
+		miss_count++;
+		return upstream->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+		auto const addr = reinterpret_cast<std::uintptr_t>(ptr);
+		auto const start = reinterpret_cast<std::uintptr_t>(storage);
+		if (addr < start || addr >= start + Size) upstream->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+
+	private:
+	alignas(std::max_align_t) unsigned char storage[Size];
+	std::size_t top = 0;
+	std::size_t peak_top = 0;
+	std::uint32_t miss_count = 0;
+	std::pmr::memory_resource* upstream;
+};
+}  // namespace pmr
+}  // namespace pros
+
+#endif  // _PROS_PMR_HPP_
@@ -105,6 +105,31 @@ typedef enum {
 
 typedef void* mutex_t;
 
+/**
+ * The timing record of a task created by task_create_periodic(). Times are in
+ * microseconds since PROS initialized, and response times are measured from a
+ * release to the end of the task function's run for it, so they include any
+ * time the task spent preempted.
+ */
+typedef struct periodic_task_stats_s {
+	uint32_t period;           // The time between releases, in milliseconds
+	uint32_t deadline;         // The longest allowed response time, in milliseconds
+	uint32_t releases;         // How many times the task function has run
+	uint32_t misses;           // How many runs finished after their deadline
+	uint32_t skipped;          // How many releases passed while a late run was still going
+	uint64_t last_release;     // When the most recent run was released
+	uint64_t last_completion;  // When the most recent run finished
+	uint32_t last_response;    // The most recent run's response time, in microseconds
+	uint32_t max_response;     // The worst response time so far, in microseconds
+} periodic_task_stats_s_t;
+
+/**
+ * Called by a periodic task when a run of its function finishes after its
+ * deadline, with the task, the run's response time in microseconds and the
+ * parameter given to task_set_deadline_miss_callback().
+ */
+typedef void (*periodic_miss_fn_t)(task_t task, uint32_t response, void* param);
+
 /**
  * Refers to the current task handle
  */
@@ -125,6 +150,13 @@ namespace c {
  */
 uint32_t millis(void);
 
+/**
+ * Gets the number of microseconds since PROS initialized.
+ *
+ * \return The number of microseconds since PROS initialized
+ */
+uint64_t micros(void);
+
 /**
  * Creates a new task and add it to the list of tasks that are ready to run.
  *
@@ -155,6 +187,88 @@ uint32_t millis(void);
 task_t task_create(task_fn_t function, void* const parameters, uint32_t prio, const uint16_t stack_depth,
                    const char* const name);
 
+/**
+ * Creates a new task which calls a function once every period.
+ *
+ * The function is released every period milliseconds from when the task
+ * starts, and should return once it has done its work for the release. A run
+ * which finishes after its deadline counts as a miss and calls the task's
+ * deadline miss callback, if it has one. A release which passes while an
+ * earlier run is still going is skipped rather than run late, so an overrun
+ * never turns into a burst of back-to-back runs, and the task keeps to its
+ * original schedule. See task_get_periodic_stats() for the task's timings.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The period is 0, or the deadline is longer than the period.
+ * ENOMEM - The stack cannot be used as the TCB was not created.
+ *
+ * \param function
+ *        Pointer to the function to call once every period
+ * \param parameters
+ *        Pointer to memory that will be passed to every call of the function.
+ *        This memory should not typically come from stack, but rather from
+ *        dynamically (i.e., malloc'd) or statically allocated memory.
+ * \param period
+ *        The number of milliseconds between releases
+ * \param deadline
+ *        The number of milliseconds after a release by which the function must
+ *        have returned, or 0 for the whole period
+ * \param prio
+ *        The priority at which the task should run.
+ *        TASK_PRIO_DEFAULT plus/minus 1 or 2 is typically used.
+ * \param stack_depth
+ *        The number of words (i.e. 4 * stack_depth) available on the task's
+ *        stack. TASK_STACK_DEPTH_DEFAULT is typically sufficienct.
+ * \param name
+ *        A descriptive name for the task.  This is mainly used to facilitate
+ *        debugging. The name may be up to 32 characters long.
+ *
+ * \return A handle by which the newly created task can be referenced. If an
+ * error occurred, NULL will be returned and errno can be checked for hints as
+ * to why task_create_periodic failed.
+ */
+task_t task_create_periodic(task_fn_t function, void* const parameters, uint32_t period, uint32_t deadline,
+                            uint32_t prio, const uint16_t stack_depth, const char* const name);
+
+/**
+ * Gets the timing record of a task created by task_create_periodic().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The task is not a periodic task, or stats is NULL.
+ *
+ * \param task
+ *        The task to check, or NULL for the calling task
+ * \param[out] stats
+ *        Where to copy the task's timing record
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t task_get_periodic_stats(task_t task, periodic_task_stats_s_t* const stats);
+
+/**
+ * Sets the function a task created by task_create_periodic() calls whenever a
+ * run finishes after its deadline. The callback runs in the periodic task
+ * itself, before it waits for its next release, so it should be quick.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The task is not a periodic task.
+ *
+ * \param task
+ *        The task to set the callback of, or NULL for the calling task
+ * \param callback
+ *        The function to call on a missed deadline, or NULL for none
+ * \param param
+ *        The parameter to pass to the callback
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t task_set_deadline_miss_callback(task_t task, periodic_miss_fn_t callback, void* param);
+
 /**
  * Removes a task from the RTOS real time kernel's management. The task being
  * deleted will be removed from all ready, blocked, suspended and event lists.
@@ -197,6 +311,22 @@ void delay(const uint32_t milliseconds);
  */
 void task_delay_until(uint32_t* const prev_time, const uint32_t delta);
 
+/**
+ * Delays a task until a specified time in microseconds. Like
+ * task_delay_until(), but the task is woken by a hardware timer within a few
+ * microseconds of the wake time instead of on the next millisecond tick.
+ *
+ * The task will be woken up at the time *prev_time + delta, and *prev_time will
+ * be updated to reflect the time at which the task will unblock.
+ *
+ * \param prev_time
+ *        A pointer to the location storing the setpoint time. This should
+ *        typically be initialized to the return value of micros().
+ * \param delta
+ *        The number of microseconds to wait (1000000 microseconds per second)
+ */
+void task_delay_until_us(uint64_t* const prev_time, const uint32_t delta);
+
 /**
  * Gets the priority of the specified task.
  *
@@ -270,7 +400,9 @@ char* task_get_name(task_t task);
 /**
  * Gets a task handle from the specified name
  *
- * The operation takes a relatively long time and should be used sparingly.
+ * Tasks are indexed by name, so this takes about the same time however many
+ * tasks there are. If several tasks have the name, the one created last is
+ * returned.
  *
  * \param name
  *        The name to query
@@ -368,6 +500,34 @@ bool task_notify_clear(task_t task);
  */
 mutex_t mutex_create(void);
 
+/**
+ * Creates a priority ceiling mutex.
+ *
+ * A task which takes the mutex is raised to the ceiling priority first, and
+ * goes back to its own priority once it gives the mutex back. If the ceiling is
+ * at least the priority of every task which takes the mutex, no other task
+ * using it can run while it's held, so a task is blocked by it for at most one
+ * critical section and never through a chain of other mutexes. The mutex is
+ * taken and given back with mutex_take() and mutex_give(), in the reverse of
+ * the order they were taken in if a task holds more than one. A priority
+ * given to the owner with task_set_priority() while it holds the mutex is
+ * undone when the mutex is given back.
+ *
+ * mutex_take() fails with EINVAL in a task whose priority is above the ceiling,
+ * and mutex_give() fails with EPERM in a task which doesn't hold the mutex.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The ceiling is not between TASK_PRIORITY_MIN and TASK_PRIORITY_MAX
+ * ENOMEM - The mutex couldn't be allocated
+ *
+ * \param ceiling
+ *        The priority of the highest priority task which takes the mutex
+ *
+ * \return A handle to a newly created mutex, or NULL upon failure
+ */
+mutex_t mutex_create_ceiling(uint32_t ceiling);
+
 /**
  * Takes and locks a mutex, waiting for up to a certain number of milliseconds
  * before timing out.
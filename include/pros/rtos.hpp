@@ -23,13 +23,141 @@
 
 #include "pros/rtos.h"
 #undef delay
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <new>
+#include <sys/reent.h>
 #include <type_traits>
+#include <utility>
 
 namespace pros {
+namespace c {
+extern "C" {
+// The parts of the RTOS API in pros/apix.h which the classes below use
+typedef void* queue_t;
+typedef void* sem_t;
+queue_t queue_create(std::uint32_t length, std::uint32_t item_size);
+void queue_delete(queue_t queue);
+std::uint32_t queue_get_waiting(const queue_t queue);
+void* queue_reserve_back(queue_t queue, std::uint32_t timeout);
+bool queue_commit(queue_t queue);
+void* queue_peek_front_ptr(queue_t queue, std::uint32_t timeout);
+bool queue_release(queue_t queue);
+typedef void* queue_set_t;
+queue_set_t queue_set_create(std::uint32_t length);
+void queue_set_delete(queue_set_t set);
+bool queue_set_add(queue_set_t set, void* member);
+bool queue_set_remove(queue_set_t set, void* member);
+void* queue_set_select(queue_set_t set, std::uint32_t timeout);
+typedef void* message_buffer_t;
+message_buffer_t message_buffer_create_static(std::size_t size, void* storage);
+void message_buffer_delete(message_buffer_t buffer);
+std::size_t message_buffer_send(message_buffer_t buffer, const void* data, std::size_t length, std::uint32_t timeout);
+std::size_t message_buffer_recv(message_buffer_t buffer, void* data, std::size_t max_length, std::uint32_t timeout);
+std::size_t message_buffer_get_free(message_buffer_t buffer);
+typedef void* event_group_t;
+event_group_t event_group_create_static(void* storage);
+std::uint32_t event_group_set(event_group_t group, std::uint32_t bits);
+std::uint32_t event_group_clear(event_group_t group, std::uint32_t bits);
+std::uint32_t event_group_get(event_group_t group);
+std::uint32_t event_group_wait(event_group_t group, std::uint32_t bits, bool wait_for_all, bool clear_on_exit,
+                               std::uint32_t timeout);
+typedef void* work_queue_t;
+work_queue_t work_queue_create(std::uint32_t prio, std::uint32_t max_jobs, std::uint16_t stack_depth,
+                               const char* name);
+void work_queue_delete(work_queue_t queue);
+bool work_queue_submit(work_queue_t queue, task_fn_t function, void* param);
+void* work_queue_reserve(work_queue_t queue, task_fn_t function);
+bool work_queue_commit(work_queue_t queue, void* data);
+sem_t sem_create(std::uint32_t max_count, std::uint32_t init_count);
+void sem_delete(sem_t sem);
+bool sem_wait(sem_t sem, std::uint32_t timeout);
+bool sem_post(sem_t sem);
+std::uint32_t sem_get_count(sem_t sem);
+std::uint32_t task_get_cpu_time(task_t task);
+double task_get_cpu_usage(task_t task);
+mutex_t mutex_recursive_create(void);
+bool mutex_recursive_take(mutex_t mutex, std::uint32_t timeout);
+bool mutex_recursive_give(mutex_t mutex);
+typedef void* pool_t;
+pool_t pool_create_static(std::size_t block_size, std::uint32_t count, void* storage);
+void* pool_alloc(pool_t pool);
+std::int32_t pool_free(pool_t pool, void* block);
+std::uint32_t pool_get_free(pool_t pool);
+}
+}  // namespace c
+
+namespace detail {
+// configNUM_THREAD_LOCAL_STORAGE_POINTERS in FreeRTOSConfig.h
+constexpr std::size_t thread_local_storage_pointers = 7;
+
+// Mirrors the layout of the kernel's static_task_s_t, so tasks can be allocated
+// statically without the kernel's headers. Checked when the kernel is built
+struct StaticTaskControl {
+	void* top_of_stack;
+	std::uint32_t list_items[2][5];
+	std::uint32_t priority;
+	void* stack;
+	char name[32];
+	void* end_of_stack;
+	std::uint32_t trace[2];
+	std::uint32_t mutexes[2];
+	void* thread_local_storage[thread_local_storage_pointers];
+	std::uint32_t run_time;
+	struct _reent* reent_ptr;
+	std::uint32_t notify_value;
+	std::uint8_t flags[3];
+	struct _reent reent;
+};
+
+// Creates a task in the given memory, implemented in rtos.cpp
+task_t task_create_static(task_fn_t function, void* parameters, std::uint32_t prio, std::size_t stack_words,
+                          const char* name, std::uint32_t* stack, StaticTaskControl* control);
+
+// The size of the kernel's static_queue_s_t, so queues can be allocated
+// statically without the kernel's headers. Checked when the kernel is built
+constexpr std::size_t static_queue_size = 84;
+
+// Creates a queue in the given memory, implemented in rtos.cpp
+c::queue_t queue_create_static(std::uint32_t length, std::uint32_t item_size, std::uint8_t* storage, void* control);
+
+// The memory for a Queue's items and bookkeeping. Queues with a length of 0
+// are sized when they're created and allocate their memory from the heap
+template <typename T, std::uint32_t N>
+struct QueueStorage {
+	alignas(T) std::uint8_t items[N * sizeof(T)];
+	alignas(void*) std::uint8_t control[static_queue_size];
+};
+
+template <typename T>
+struct QueueStorage<T, 0> {
+	// Items are stored right after the queue's bookkeeping, which is only
+	// pointer aligned
+	static_assert(alignof(T) <= alignof(void*), "pros::Queue items can't need more than pointer alignment");
+};
+
+// MESSAGE_BUFFER_HEADER_SIZE and EVENT_GROUP_STORAGE_SIZE from pros/apix.h.
+// Checked when the kernel is built
+constexpr std::size_t message_buffer_header_size = 36;
+constexpr std::size_t event_group_storage_size = 36;
+// WORK_QUEUE_INLINE_SIZE from pros/apix.h, also checked when the kernel is built
+constexpr std::size_t work_queue_inline_size = 32;
+
+// POOL_HEADER_SIZE and POOL_ALIGNMENT from pros/apix.h. Checked when the
+// kernel is built
+constexpr std::size_t pool_header_size = 16;
+constexpr std::size_t pool_alignment = 8;
+
+// Room for a T along with what a container or std::allocate_shared keeps next
+// to it: the links of a std::list or std::map node, or a shared_ptr's counts
+template <typename T>
+constexpr std::size_t pool_block_size = sizeof(T) + 4 * sizeof(void*);
+}  // namespace detail
+
+
 class Task {
 	public:
 	/**
@@ -209,6 +337,22 @@ class Task {
 	 */
 	const char* get_name(void);
 
+	/**
+	 * Gets the total time the task has spent running.
+	 *
+	 * \return The task's run time in microseconds. This wraps around after
+	 * about 71 minutes.
+	 */
+	std::uint32_t get_cpu_time(void);
+
+	/**
+	 * Gets the share of the CPU the task used during the last one second
+	 * sample.
+	 *
+	 * \return The percentage of the CPU the task used
+	 */
+	double get_cpu_usage(void);
+
 	/**
 	 * Convert this object to a C task_t handle
 	 */
@@ -306,6 +450,21 @@ class Task {
 	 */
 	static void delay_until(std::uint32_t* const prev_time, const std::uint32_t delta);
 
+	/**
+	 * Delays a task until a specified time in microseconds. The task is woken
+	 * by a hardware timer instead of on the next millisecond tick.
+	 *
+	 * The task will be woken up at the time *prev_time + delta, and *prev_time
+	 * will be updated to reflect the time at which the task will unblock.
+	 *
+	 * \param prev_time
+	 *        A pointer to the location storing the setpoint time. This should
+	 *        typically be initialized to the return value from pros::micros().
+	 * \param delta
+	 *        The number of microseconds to wait (1000000 microseconds per second)
+	 */
+	static void delay_until_us(std::uint64_t* const prev_time, const std::uint32_t delta);
+
 	/**
 	 * Gets the number of tasks the kernel is currently managing, including all
 	 * ready, blocked, or suspended tasks. A task that has been deleted, but not
@@ -316,10 +475,184 @@ class Task {
 	 */
 	static std::uint32_t get_count(void);
 
-	private:
+	protected:
 	task_t task;
 };
 
+/**
+ * A task whose stack and control block are part of the object, so creating it
+ * never touches the heap. Like the kernel's own tasks, a StaticTask is
+ * typically a global which lives for the whole program.
+ *
+ * \tparam StackWords
+ *         The number of words (i.e. 4 * StackWords) available on the task's
+ *         stack
+ * \tparam CallableSize
+ *         The room for a callable entry function and its captures, which is
+ *         stored inline instead of in a heap allocated std::function
+ */
+template <std::size_t StackWords = TASK_STACK_DEPTH_DEFAULT, std::size_t CallableSize = 32>
+class StaticTask : public Task {
+	public:
+	/**
+	 * Creates a new task and add it to the list of tasks that are ready to run.
+	 *
+	 * \param function
+	 *        Pointer to the task entry function
+	 * \param parameters
+	 *        Pointer to memory that will be used as a parameter for the task
+	 * \param prio
+	 *        The priority at which the task should run
+	 * \param name
+	 *        A descriptive name for the task
+	 */
+	StaticTask(task_fn_t function, void* parameters = nullptr, std::uint32_t prio = TASK_PRIORITY_DEFAULT,
+	           const char* name = "")
+	    : Task(static_cast<task_t>(nullptr)) {
+		task = detail::task_create_static(function, parameters, prio, StackWords, name, stack, &control);
+	}
+
+	/**
+	 * Creates a new task and add it to the list of tasks that are ready to run.
+	 *
+	 * \param function
+	 *        Callable object to use as entry function. It is moved into the
+	 *        StaticTask and must fit in CallableSize bytes
+	 * \param prio
+	 *        The priority at which the task should run
+	 * \param name
+	 *        A descriptive name for the task
+	 */
+	template <class F, typename = std::enable_if_t<std::is_invocable_r_v<void, F&>>>
+	StaticTask(F&& function, std::uint32_t prio = TASK_PRIORITY_DEFAULT, const char* name = "")
+	    : Task(static_cast<task_t>(nullptr)) {
+		using Fn = std::decay_t<F>;
+		static_assert(sizeof(Fn) <= CallableSize, "the callable is too big, increase StaticTask's CallableSize");
+		static_assert(alignof(Fn) <= alignof(std::max_align_t), "the callable is over-aligned");
+		new (callable) Fn(std::forward<F>(function));
+		destroy = [](void* callable) { static_cast<Fn*>(callable)->~Fn(); };
+		task = detail::task_create_static([](void* callable) { (*static_cast<Fn*>(callable))(); }, callable, prio,
+		                                  StackWords, name, stack, &control);
+	}
+
+	template <class F, typename = std::enable_if_t<std::is_invocable_r_v<void, F&>>>
+	StaticTask(F&& function, const char* name) : StaticTask(std::forward<F>(function), TASK_PRIORITY_DEFAULT, name) {}
+
+	StaticTask(const StaticTask&) = delete;
+	StaticTask& operator=(const StaticTask&) = delete;
+
+	~StaticTask(void) {
+		if (task != nullptr) remove();
+		if (destroy != nullptr) destroy(callable);
+	}
+
+	private:
+	alignas(8) std::uint32_t stack[StackWords];
+	detail::StaticTaskControl control;
+	alignas(std::max_align_t) std::uint8_t callable[CallableSize];
+	void (*destroy)(void*) = nullptr;
+};
+
+/**
+ * A task which calls a function once every period and keeps a record of its
+ * timing, see task_create_periodic(). A PeriodicTask owns its task, and
+ * removes it when it is destroyed, so it is typically a global or a member of
+ * an object which lives as long as the task should run.
+ */
+class PeriodicTask : public Task {
+	public:
+	/**
+	 * Creates a new periodic task and add it to the list of tasks that are
+	 * ready to run.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The period is 0, or the deadline is longer than the period.
+	 * ENOMEM - The stack cannot be used as the TCB was not created.
+	 *
+	 * \param function
+	 *        Pointer to the function to call once every period
+	 * \param parameters
+	 *        Pointer to memory that will be passed to every call of the function
+	 * \param period
+	 *        The number of milliseconds between releases
+	 * \param deadline
+	 *        The number of milliseconds after a release by which the function
+	 *        must have returned, or 0 for the whole period
+	 * \param prio
+	 *        The priority at which the task should run
+	 * \param stack_depth
+	 *        The number of words (i.e. 4 * stack_depth) available on the task's
+	 *        stack
+	 * \param name
+	 *        A descriptive name for the task
+	 */
+	PeriodicTask(task_fn_t function, void* parameters, std::uint32_t period, std::uint32_t deadline = 0,
+	             std::uint32_t prio = TASK_PRIORITY_DEFAULT, std::uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT,
+	             const char* name = "");
+
+	/**
+	 * Creates a new periodic task and add it to the list of tasks that are
+	 * ready to run.
+	 *
+	 * This function uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - The period is 0, or the deadline is longer than the period.
+	 * ENOMEM - The stack cannot be used as the TCB was not created.
+	 *
+	 * \param function
+	 *        Callable object to call once every period
+	 * \param period
+	 *        The number of milliseconds between releases
+	 * \param deadline
+	 *        The number of milliseconds after a release by which the function
+	 *        must have returned, or 0 for the whole period
+	 * \param prio
+	 *        The priority at which the task should run
+	 * \param stack_depth
+	 *        The number of words (i.e. 4 * stack_depth) available on the task's
+	 *        stack
+	 * \param name
+	 *        A descriptive name for the task
+	 */
+	template <class F, typename = std::enable_if_t<std::is_invocable_r_v<void, F&>>>
+	PeriodicTask(F&& function, std::uint32_t period, std::uint32_t deadline = 0,
+	             std::uint32_t prio = TASK_PRIORITY_DEFAULT, std::uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT,
+	             const char* name = "")
+	    : Task(static_cast<task_t>(nullptr)), callable(new std::function<void()>(std::forward<F>(function))) {
+		task = c::task_create_periodic([](void* callable) { (*static_cast<std::function<void()>*>(callable))(); },
+		                               callable.get(), period, deadline, prio, stack_depth, name);
+	}
+
+	PeriodicTask(const PeriodicTask&) = delete;
+	PeriodicTask& operator=(const PeriodicTask&) = delete;
+
+	~PeriodicTask(void);
+
+	/**
+	 * Gets the task's timing record.
+	 *
+	 * \return The release and response times of the task's runs so far, and
+	 * how many of them missed their deadline
+	 */
+	periodic_task_stats_s_t get_stats(void);
+
+	/**
+	 * Sets the function the task calls whenever a run finishes after its
+	 * deadline. The callback runs in the periodic task itself, so it should be
+	 * quick.
+	 *
+	 * \param callback
+	 *        The function to call on a missed deadline, or nullptr for none
+	 * \param param
+	 *        The parameter to pass to the callback
+	 */
+	void set_miss_callback(periodic_miss_fn_t callback, void* param = nullptr);
+
+	private:
+	std::unique_ptr<std::function<void()>> callable;
+};
+
 class Mutex {
 	public:
 	Mutex(void);
@@ -356,10 +689,804 @@ class Mutex {
 	 */
 	bool give(void);
 
+	// Lockable interface for std::lock_guard and std::unique_lock
+	void lock(void) {
+		take(TIMEOUT_MAX);
+	}
+	bool try_lock(void) {
+		return take(0);
+	}
+	void unlock(void) {
+		give();
+	}
+
+	private:
+	mutex_t mutex;
+};
+
+/**
+ * A queue whose items are constructed in place in the queue's memory and moved
+ * out of it by the receiver, so items which own memory (like std::vector or
+ * std::string) can be queued directly instead of through pointers.
+ *
+ * Queues with a length N are allocated statically as part of the object.
+ * Queues with N = 0 are given their length when they're created and allocate
+ * their memory from the heap.
+ *
+ * A Queue may have one sending task and one receiving task at a time.
+ */
+class QueueSet;
+
+template <typename T, std::uint32_t N = 0>
+class Queue {
+	public:
+	/**
+	 * Creates a statically allocated queue which can hold N items.
+	 */
+	Queue(void) : queue(detail::queue_create_static(N, sizeof(T), storage.items, storage.control)) {
+		static_assert(N > 0, "pros::Queue<T> needs a length, use pros::Queue<T, N> to size it statically");
+	}
+
+	/**
+	 * Creates a queue whose memory is allocated from the heap.
+	 *
+	 * \param length
+	 *        The maximum number of items that the queue can contain
+	 */
+	explicit Queue(std::uint32_t length) : queue(c::queue_create(length, sizeof(T))) {
+		static_assert(N == 0, "pros::Queue<T, N> is sized statically");
+	}
+
+	Queue(const Queue&) = delete;
+	Queue& operator=(const Queue&) = delete;
+
+	~Queue(void) {
+		while (pop())
+			;
+		c::queue_delete(queue);
+	}
+
+	/**
+	 * Constructs an item at the end of the queue.
+	 *
+	 * \param timeout
+	 *        Time to wait for space to become available. A timeout of 0 can be
+	 *        used to attempt to post without blocking. TIMEOUT_MAX can be used
+	 *        to block indefinitely.
+	 * \param args
+	 *        The arguments to T's constructor
+	 *
+	 * \return True if the item was added, false if the queue stayed full.
+	 */
+	template <typename... Args>
+	bool emplace(std::uint32_t timeout, Args&&... args) {
+		void* slot = c::queue_reserve_back(queue, timeout);
+		if (slot == nullptr) return false;
+		new (slot) T(std::forward<Args>(args)...);
+		return c::queue_commit(queue);
+	}
+
+	/**
+	 * Moves an item to the end of the queue.
+	 *
+	 * \param item
+	 *        The item to add. It is left in a moved-from state only if the
+	 *        item was added
+	 * \param timeout
+	 *        Time to wait for space to become available
+	 *
+	 * \return True if the item was added, false if the queue stayed full.
+	 */
+	bool send(T&& item, std::uint32_t timeout) {
+		return emplace(timeout, std::move(item));
+	}
+
+	/**
+	 * Copies an item to the end of the queue.
+	 *
+	 * \param item
+	 *        The item to add
+	 * \param timeout
+	 *        Time to wait for space to become available
+	 *
+	 * \return True if the item was added, false if the queue stayed full.
+	 */
+	bool send(const T& item, std::uint32_t timeout) {
+		return emplace(timeout, item);
+	}
+
+	/**
+	 * Moves the item at the front of the queue out of it.
+	 *
+	 * \param[out] item
+	 *        Assigned the front item
+	 * \param timeout
+	 *        Time to wait for an item to arrive. A timeout of 0 can be used to
+	 *        check without blocking. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return True if an item was received, false if the queue stayed empty.
+	 */
+	bool recv(T& item, std::uint32_t timeout) {
+		T* front_item = front(timeout);
+		if (front_item == nullptr) return false;
+		item = std::move(*front_item);
+		return pop();
+	}
+
+	/**
+	 * Gets the item at the front of the queue without removing it. The item
+	 * stays valid until pop() is called.
+	 *
+	 * \param timeout
+	 *        Time to wait for an item to arrive. A timeout of 0 can be used to
+	 *        check without blocking. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return The front item, or nullptr if the queue stayed empty.
+	 */
+	T* front(std::uint32_t timeout) {
+		return static_cast<T*>(c::queue_peek_front_ptr(queue, timeout));
+	}
+
+	/**
+	 * Destroys and removes the item at the front of the queue.
+	 *
+	 * \return True if an item was removed, false if the queue was empty.
+	 */
+	bool pop(void) {
+		T* item = front(0);
+		if (item == nullptr) return false;
+		item->~T();
+		return c::queue_release(queue);
+	}
+
+	/**
+	 * \return The number of items in the queue.
+	 */
+	std::uint32_t size(void) const {
+		return c::queue_get_waiting(queue);
+	}
+
+	private:
+	friend class QueueSet;
+
+	detail::QueueStorage<T, N> storage;
+	c::queue_t queue;
+};
+
+/**
+ * An allocator which hands out the blocks of a Pool, for containers which
+ * allocate one element at a time (std::list, std::map, std::set, ...) and for
+ * std::allocate_shared.
+ *
+ * Allocations which don't fit in a block, such as a std::vector's array, or
+ * which find the pool empty throw std::bad_alloc.
+ */
+template <typename T, std::size_t BlockSize>
+class PoolAllocator {
+	public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind {
+		using other = PoolAllocator<U, BlockSize>;
+	};
+
+	explicit PoolAllocator(c::pool_t pool) noexcept : pool(pool) {}
+
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U, BlockSize>& other) noexcept : pool(other.pool) {}
+
+	T* allocate(std::size_t n) {
+		static_assert(alignof(T) <= detail::pool_alignment, "pros::Pool blocks aren't aligned enough for T");
+		void* block = n * sizeof(T) <= BlockSize ? c::pool_alloc(pool) : nullptr;
+		if (block == nullptr) {
+#ifdef __cpp_exceptions
+			throw std::bad_alloc();
+#else
+			std::abort();
+#endif
+		}
+		return static_cast<T*>(block);
+	}
+
+	void deallocate(T* ptr, std::size_t) noexcept {
+		c::pool_free(pool, ptr);
+	}
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U, BlockSize>& other) const noexcept {
+		return pool == other.pool;
+	}
+
+	template <typename U>
+	bool operator!=(const PoolAllocator<U, BlockSize>& other) const noexcept {
+		return pool != other.pool;
+	}
+
+	private:
+	template <typename U, std::size_t>
+	friend class PoolAllocator;
+
+	c::pool_t pool;
+};
+
+/**
+ * N fixed-size blocks for allocating T objects without going to the heap.
+ * Allocating and freeing take the same few instructions every time and never
+ * lock anything, so they're safe in a control loop's hot path.
+ *
+ * Objects can be created directly with create() and destroy(), or the pool can
+ * back containers and shared pointers through get_allocator(), e.g.
+ *
+ * pros::Pool<Message, 16> messages;
+ * std::shared_ptr<Message> msg = std::allocate_shared<Message>(messages.get_allocator(), ...);
+ * std::list<Message, decltype(messages)::allocator_type> inbox(messages.get_allocator());
+ *
+ * Each block is BlockSize bytes, which by default leaves room for the
+ * bookkeeping those put next to each T.
+ *
+ * The pool must outlive everything allocated from it.
+ */
+template <typename T, std::size_t N, std::size_t BlockSize = detail::pool_block_size<T>>
+class Pool {
+	static_assert(N > 0 && BlockSize >= sizeof(T), "Invalid pros::Pool size");
+
+	public:
+	using allocator_type = PoolAllocator<T, BlockSize>;
+
+	Pool(void) : pool(c::pool_create_static(BlockSize, N, storage)) {}
+
+	Pool(const Pool&) = delete;
+	Pool& operator=(const Pool&) = delete;
+
+	/**
+	 * Constructs a T in a block of the pool.
+	 *
+	 * \param args
+	 *        The arguments to T's constructor
+	 *
+	 * \return The new object, or nullptr if every block is in use.
+	 */
+	template <typename... Args>
+	T* create(Args&&... args) {
+		void* block = c::pool_alloc(pool);
+		if (block == nullptr) return nullptr;
+		return new (block) T(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * Destroys an object made with create() and gives its block back.
+	 *
+	 * \param object
+	 *        The object to destroy, or nullptr to do nothing
+	 */
+	void destroy(T* object) {
+		if (object == nullptr) return;
+		object->~T();
+		c::pool_free(pool, object);
+	}
+
+	/**
+	 * \return An allocator which hands out the pool's blocks.
+	 */
+	allocator_type get_allocator(void) noexcept {
+		return allocator_type(pool);
+	}
+
+	/**
+	 * \return The number of blocks which aren't in use.
+	 */
+	std::uint32_t available(void) const {
+		return c::pool_get_free(pool);
+	}
+
+	private:
+	static constexpr std::size_t stride = (BlockSize + detail::pool_alignment - 1) & ~(detail::pool_alignment - 1);
+
+	alignas(detail::pool_alignment) unsigned char storage[detail::pool_header_size + N * stride];
+	c::pool_t pool;
+};
+
+/**
+ * A counting semaphore.
+ */
+class Semaphore {
+	public:
+	/**
+	 * Creates a counting semaphore.
+	 *
+	 * \param max_count
+	 *        The maximum count value that can be reached
+	 * \param init_count
+	 *        The initial count value assigned to the new semaphore
+	 */
+	Semaphore(std::uint32_t max_count, std::uint32_t init_count);
+
+	Semaphore(const Semaphore&) = delete;
+	Semaphore& operator=(const Semaphore&) = delete;
+	Semaphore(Semaphore&& other) noexcept;
+	Semaphore& operator=(Semaphore&& other) noexcept;
+	~Semaphore(void);
+
+	/**
+	 * Waits for the semaphore's value to be greater than 0, then decrements it.
+	 *
+	 * \param timeout
+	 *        Time to wait before the semaphore's becomes available. A timeout of
+	 *        0 can be used to poll the semaphore. TIMEOUT_MAX can be used to
+	 *        block indefinitely.
+	 *
+	 * \return True if the semaphore was successfully taken, false otherwise.
+	 */
+	bool wait(std::uint32_t timeout);
+
+	/**
+	 * Increments the semaphore's value.
+	 *
+	 * \return True if the value was incremented, false otherwise.
+	 */
+	bool post(void);
+
+	/**
+	 * \return The current value of the semaphore
+	 */
+	std::uint32_t get_count(void);
+
+	private:
+	friend class QueueSet;
+
+	c::sem_t sem;
+};
+
+/**
+ * Lets a task block on several queues and semaphores at once, see
+ * queue_set_create().
+ *
+ * pros::QueueSet set(SENSOR_QUEUE_LENGTH + 1);
+ * set.add(sensor_queue);
+ * set.add(command_ready);
+ * void* ready = set.select(TIMEOUT_MAX);
+ * if (pros::QueueSet::is(ready, sensor_queue)) sensor_queue.recv(reading, 0);
+ *
+ * A member's items must only be received, or the semaphore waited on, once
+ * for each time select() returns it.
+ */
+class QueueSet {
+	public:
+	/**
+	 * Creates a queue set.
+	 *
+	 * \param length
+	 *        The most events the set holds at once, which should be at least
+	 *        the total length of its members
+	 */
+	explicit QueueSet(std::uint32_t length);
+
+	QueueSet(const QueueSet&) = delete;
+	QueueSet& operator=(const QueueSet&) = delete;
+
+	/**
+	 * Deletes the queue set. Its members must have been removed from it
+	 * first.
+	 */
+	~QueueSet(void);
+
+	/**
+	 * Adds an empty queue to the set.
+	 *
+	 * \return True if the queue was added, false if it was in a set already
+	 * or wasn't empty.
+	 */
+	template <typename T, std::uint32_t N>
+	bool add(Queue<T, N>& queue) {
+		return c::queue_set_add(set, queue.queue);
+	}
+
+	/**
+	 * Adds a semaphore with a count of 0 to the set.
+	 *
+	 * \return True if the semaphore was added, false if it was in a set
+	 * already or its count wasn't 0.
+	 */
+	bool add(Semaphore& sem);
+
+	/**
+	 * Adds a C queue_t or sem_t to the set, such as a semaphore from
+	 * vdml_update_sem_create().
+	 *
+	 * \return True if the member was added, false if it was in a set already
+	 * or wasn't empty.
+	 */
+	bool add(void* member);
+
+	/**
+	 * Removes an empty queue from the set.
+	 *
+	 * \return True if the queue was removed, false otherwise.
+	 */
+	template <typename T, std::uint32_t N>
+	bool remove(Queue<T, N>& queue) {
+		return c::queue_set_remove(set, queue.queue);
+	}
+
+	/**
+	 * Removes a semaphore with a count of 0 from the set.
+	 *
+	 * \return True if the semaphore was removed, false otherwise.
+	 */
+	bool remove(Semaphore& sem);
+
+	/**
+	 * Removes an empty C queue_t or sem_t from the set.
+	 *
+	 * \return True if the member was removed, false otherwise.
+	 */
+	bool remove(void* member);
+
+	/**
+	 * Blocks until one of the set's members has an item or has been posted.
+	 *
+	 * \param timeout
+	 *        Time to wait for a member to become ready. A timeout of 0 can be
+	 *        used to check without blocking. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return The member which is ready, to be checked with is(), or nullptr
+	 * if none became ready.
+	 */
+	void* select(std::uint32_t timeout);
+
+	/**
+	 * \return Whether a member returned by select() is the given queue.
+	 */
+	template <typename T, std::uint32_t N>
+	static bool is(void* selected, const Queue<T, N>& queue) {
+		return selected == queue.queue;
+	}
+
+	/**
+	 * \return Whether a member returned by select() is the given semaphore.
+	 */
+	static bool is(void* selected, const Semaphore& sem) {
+		return selected == sem.sem;
+	}
+
+	private:
+	c::queue_set_t set;
+};
+
+/**
+ * A mutex which the task holding it may take again. It must be given as many
+ * times as it was taken before other tasks can take it.
+ *
+ * Like pros::Mutex, this can be held with std::lock_guard or std::unique_lock.
+ */
+class RecursiveMutex {
+	public:
+	RecursiveMutex(void);
+
+	RecursiveMutex(const RecursiveMutex&) = delete;
+	RecursiveMutex& operator=(const RecursiveMutex&) = delete;
+	RecursiveMutex(RecursiveMutex&& other) noexcept;
+	RecursiveMutex& operator=(RecursiveMutex&& other) noexcept;
+	~RecursiveMutex(void);
+
+	/**
+	 * Takes the mutex, waiting for up to a certain number of milliseconds.
+	 *
+	 * \param timeout
+	 *        Time to wait before the mutex becomes available. A timeout of 0 can
+	 *        be used to poll the mutex. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return True if the mutex was successfully taken, false otherwise.
+	 */
+	bool take(std::uint32_t timeout);
+
+	/**
+	 * Gives the mutex back once.
+	 *
+	 * \return True if the mutex was successfully returned, false otherwise.
+	 */
+	bool give(void);
+
+	// Lockable interface for std::lock_guard and std::unique_lock
+	void lock(void) {
+		take(TIMEOUT_MAX);
+	}
+	bool try_lock(void) {
+		return take(0);
+	}
+	void unlock(void) {
+		give();
+	}
+
+	private:
+	mutex_t mutex;
+};
+
+/**
+ * A priority ceiling mutex, see mutex_create_ceiling(). The calling task is
+ * raised to the ceiling while it holds the mutex.
+ *
+ * Like pros::Mutex, this can be held with std::lock_guard or std::unique_lock.
+ */
+class CeilingMutex {
+	public:
+	/**
+	 * Creates a priority ceiling mutex.
+	 *
+	 * \param ceiling
+	 *        The priority of the highest priority task which takes the mutex
+	 */
+	explicit CeilingMutex(std::uint32_t ceiling);
+
+	CeilingMutex(const CeilingMutex&) = delete;
+	CeilingMutex& operator=(const CeilingMutex&) = delete;
+	CeilingMutex(CeilingMutex&& other) noexcept;
+	CeilingMutex& operator=(CeilingMutex&& other) noexcept;
+	~CeilingMutex(void);
+
+	/**
+	 * Raises the calling task to the ceiling and takes the mutex, waiting for
+	 * up to a certain number of milliseconds.
+	 *
+	 * \param timeout
+	 *        Time to wait before the mutex becomes available. A timeout of 0 can
+	 *        be used to poll the mutex. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return True if the mutex was successfully taken, false otherwise. If false
+	 * is returned, then errno is set with a hint about why the the mutex
+	 * couldn't be taken.
+	 */
+	bool take(std::uint32_t timeout);
+
+	/**
+	 * Gives the mutex back and returns the calling task to its own priority.
+	 *
+	 * \return True if the mutex was successfully returned, false otherwise. If
+	 * false is returned, then errno is set with a hint about why the mutex
+	 * couldn't be returned.
+	 */
+	bool give(void);
+
+	// Lockable interface for std::lock_guard and std::unique_lock
+	void lock(void) {
+		take(TIMEOUT_MAX);
+	}
+	bool try_lock(void) {
+		return take(0);
+	}
+	void unlock(void) {
+		give();
+	}
+
 	private:
 	mutex_t mutex;
 };
 
+/**
+ * A set of 32 event bits which tasks can wait on, see event_group_create().
+ *
+ * Waiting tasks block on their task notification, so a task which uses its
+ * notification for something else may stop waiting early, like vfs_poll().
+ */
+class EventGroup {
+	public:
+	/**
+	 * Creates an event group with all of its bits clear, stored in the object.
+	 */
+	EventGroup(void);
+
+	EventGroup(const EventGroup&) = delete;
+	EventGroup& operator=(const EventGroup&) = delete;
+
+	/**
+	 * Sets bits and wakes the tasks waiting on the group.
+	 *
+	 * \param bits
+	 *        The bits to set
+	 *
+	 * \return The group's bits after setting them
+	 */
+	std::uint32_t set(std::uint32_t bits);
+
+	/**
+	 * Clears bits.
+	 *
+	 * \param bits
+	 *        The bits to clear
+	 *
+	 * \return The group's bits before clearing them
+	 */
+	std::uint32_t clear(std::uint32_t bits);
+
+	/**
+	 * \return The group's bits
+	 */
+	std::uint32_t get(void) const;
+
+	/**
+	 * Waits for bits to be set.
+	 *
+	 * \param bits
+	 *        The bits to wait for
+	 * \param wait_for_all
+	 *        Whether to wait for all of the bits or any one of them
+	 * \param clear_on_exit
+	 *        Whether to clear the bits waited for when the wait succeeds
+	 * \param timeout
+	 *        Time to wait for the bits. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return The group's bits when the wait ended, before any were cleared.
+	 * Compare this against the bits waited for to tell if the wait timed out.
+	 */
+	std::uint32_t wait(std::uint32_t bits, bool wait_for_all, bool clear_on_exit, std::uint32_t timeout);
+
+	private:
+	alignas(4) std::uint8_t storage[detail::event_group_storage_size];
+	c::event_group_t group;
+};
+
+/**
+ * Runs short jobs one after another in a background task, see
+ * work_queue_create().
+ *
+ * pros::WorkQueue background(8);
+ * background.submit([chunk = std::move(chunk)] { fwrite(chunk.data(), 1, chunk.size(), log_file); });
+ *
+ * A callable and its captures are stored in the job itself, and must fit in
+ * 32 bytes; bigger state should be captured through a pointer.
+ */
+class WorkQueue {
+	public:
+	/**
+	 * Creates a work queue and starts its worker task.
+	 *
+	 * \param max_jobs
+	 *        The most jobs which can wait in the queue at once
+	 * \param prio
+	 *        The priority of the worker task, which must be below
+	 *        TASK_PRIORITY_MAX - 2
+	 * \param stack_depth
+	 *        The number of words (i.e. 4 * stack_depth) available on the
+	 *        worker's stack
+	 * \param name
+	 *        A descriptive name for the worker task
+	 */
+	explicit WorkQueue(std::uint32_t max_jobs, std::uint32_t prio = TASK_PRIORITY_MIN + 1,
+	                   std::uint16_t stack_depth = TASK_STACK_DEPTH_DEFAULT, const char* name = "work queue")
+	    : queue(c::work_queue_create(prio, max_jobs, stack_depth, name)) {}
+
+	WorkQueue(const WorkQueue&) = delete;
+	WorkQueue& operator=(const WorkQueue&) = delete;
+
+	/**
+	 * Runs the jobs already submitted, then stops the worker. Must not happen
+	 * in one of the queue's own jobs.
+	 */
+	~WorkQueue(void) {
+		c::work_queue_delete(queue);
+	}
+
+	/**
+	 * Submits a job which calls a callable object in the worker task.
+	 *
+	 * \param function
+	 *        The callable, which is moved into the job
+	 *
+	 * \return True if the job was submitted, false if the queue was full.
+	 */
+	template <class F, typename = std::enable_if_t<std::is_invocable_r_v<void, F&>>>
+	bool submit(F&& function) {
+		using Fn = std::decay_t<F>;
+		static_assert(sizeof(Fn) <= detail::work_queue_inline_size, "the callable is too big for a work queue job");
+		static_assert(alignof(Fn) <= 8, "the callable is over-aligned");
+		void* data = c::work_queue_reserve(queue, [](void* data) {
+			Fn* fn = static_cast<Fn*>(data);
+			(*fn)();
+			fn->~Fn();
+		});
+		if (data == nullptr) return false;
+		new (data) Fn(std::forward<F>(function));
+		return c::work_queue_commit(queue, data);
+	}
+
+	/**
+	 * Submits a job which calls a function in the worker task.
+	 *
+	 * \param function
+	 *        The function to call
+	 * \param param
+	 *        The parameter to pass to the function
+	 *
+	 * \return True if the job was submitted, false if the queue was full.
+	 */
+	bool submit(task_fn_t function, void* param) {
+		return c::work_queue_submit(queue, function, param);
+	}
+
+	private:
+	c::work_queue_t queue;
+};
+
+/**
+ * Passes messages of any length from one task to another, see
+ * message_buffer_create(). The buffer's memory is part of the object.
+ *
+ * One task may send and one receive at a time; if more need to, they must
+ * share a mutex.
+ *
+ * \tparam Size
+ *         The bytes the buffer holds, counting the message's length plus 4
+ *         for each message
+ */
+template <std::size_t Size>
+class MessageBuffer {
+	public:
+	MessageBuffer(void) : buffer(c::message_buffer_create_static(Size, storage)) {}
+
+	MessageBuffer(const MessageBuffer&) = delete;
+	MessageBuffer& operator=(const MessageBuffer&) = delete;
+
+	~MessageBuffer(void) {
+		c::message_buffer_delete(buffer);
+	}
+
+	/**
+	 * Copies a message into the buffer.
+	 *
+	 * \param data
+	 *        The message
+	 * \param length
+	 *        The length of the message in bytes
+	 * \param timeout
+	 *        Time to wait for room. A timeout of 0 can be used to attempt to
+	 *        send without blocking. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return The length of the message, or 0 if it was not sent.
+	 */
+	std::size_t send(const void* data, std::size_t length, std::uint32_t timeout) {
+		return c::message_buffer_send(buffer, data, length, timeout);
+	}
+
+	/**
+	 * Copies the oldest message out of the buffer.
+	 *
+	 * \param[out] data
+	 *        Where to copy the message
+	 * \param max_length
+	 *        The most bytes data can hold. A longer message stays in the
+	 *        buffer
+	 * \param timeout
+	 *        Time to wait for a message to arrive. A timeout of 0 can be used
+	 *        to check without blocking. TIMEOUT_MAX can be used to block
+	 *        indefinitely.
+	 *
+	 * \return The length of the message, or 0 if none was received.
+	 */
+	std::size_t recv(void* data, std::size_t max_length, std::uint32_t timeout) {
+		return c::message_buffer_recv(buffer, data, max_length, timeout);
+	}
+
+	/**
+	 * \return The bytes free in the buffer, 4 more than the longest message
+	 * which would fit.
+	 */
+	std::size_t get_free(void) const {
+		return c::message_buffer_get_free(buffer);
+	}
+
+	private:
+	alignas(4) std::uint8_t storage[detail::message_buffer_header_size + Size + 1];
+	c::message_buffer_t buffer;
+};
+
 /**
  * Gets the number of milliseconds since PROS initialized.
  *
@@ -367,6 +1494,17 @@ class Mutex {
  */
 using pros::c::millis;
 
+/**
+ * Gets the number of microseconds since PROS initialized.
+ *
+ * std::chrono::steady_clock, system_clock and high_resolution_clock read the
+ * same timer to the nanosecond, and std::this_thread::sleep_for() and
+ * sleep_until() wait to the microsecond like task_delay_until_us().
+ *
+ * \return The number of microseconds since PROS initialized
+ */
+using pros::c::micros;
+
 /**
  * Delays a task for a given number of milliseconds.
  *
@@ -20,6 +20,7 @@
 #define _PROS_SERIAL_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -238,6 +239,352 @@ int32_t serial_write_byte(uint8_t port, uint8_t buffer);
  */
 int32_t serial_write(uint8_t port, uint8_t* buffer, int32_t length);
 
+/******************************************************************************/
+/**                              Serial framing                              **/
+/**                                                                          **/
+/**  The kernel can split a port's input into frames while it receives      **/
+/**  data, so whole packets are handed out at once                           **/
+/******************************************************************************/
+
+/**
+ * The largest frame payload, in bytes
+ */
+#define SERIAL_MAX_FRAME_SIZE 256
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+typedef enum serial_framing_e {
+	E_SERIAL_FRAMING_NONE = 0,  // Raw bytes (the default)
+	E_SERIAL_FRAMING_COBS,      // COBS encoded frames ending in a 0 byte
+	E_SERIAL_FRAMING_SLIP,      // SLIP (RFC 1055) frames ending in 0xC0
+	// 0xA5, the payload length (uint16_t), the payload and the CRC-16/CCITT-FALSE
+	// of the length and payload (uint16_t), all little endian
+	E_SERIAL_FRAMING_LENGTH_CRC
+} serial_framing_e_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Sets how the port's input and frame output are framed.
+ *
+ * While framing is enabled, received data is only available through
+ * serial_read_frame(). Frames which are malformed or fail their CRC are
+ * dropped and counted, see serial_get_frame_errors().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port or framing is invalid
+ * EACCES - Another resource is currently trying to access the port.
+ * ENODEV - The port hasn't been enabled with serial_enable()
+ * ENOMEM - The frame buffer could not be allocated
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param framing
+ *        The framing to use
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t serial_set_framing(uint8_t port, serial_framing_e_t framing);
+
+/**
+ * Reads one whole frame received on the port.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or framing isn't enabled
+ * ENOBUFS - The next frame is larger than max_length
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param buffer
+ *        The buffer to read the frame's payload into
+ * \param max_length
+ *        The size of the buffer. Use SERIAL_MAX_FRAME_SIZE to fit any frame
+ * \param timeout
+ *        How long to wait for a frame, in milliseconds
+ *
+ * \return The length of the frame, 0 if no frame arrived before the timeout
+ * or PROS_ERR if the operation failed, setting errno.
+ */
+int32_t serial_read_frame(uint8_t port, uint8_t* buffer, int32_t max_length, uint32_t timeout);
+
+/**
+ * Writes one frame to the port using the port's framing.
+ *
+ * The encoded frame is queued all at once, or not at all if there isn't room
+ * for it in the port's write queue.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port or length is invalid or framing isn't enabled
+ * EACCES - Another resource is currently trying to access the port.
+ * EAGAIN - There isn't room for the frame in the write queue
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param data
+ *        The frame's payload
+ * \param length
+ *        The length of the payload, at most SERIAL_MAX_FRAME_SIZE
+ *
+ * \return The length of the payload if the operation was successful or
+ * PROS_ERR if the operation failed, setting errno.
+ */
+int32_t serial_write_frame(uint8_t port, const uint8_t* data, int32_t length);
+
+/**
+ * Gets the number of received frames which were dropped because they were
+ * malformed, failed their CRC or didn't fit in the frame buffer.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or framing isn't enabled
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ *
+ * \return The number of dropped frames or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t serial_get_frame_errors(uint8_t port);
+
+/******************************************************************************/
+/**                                Serial RPC                                **/
+/**                                                                          **/
+/**  Request/response calls to a coprocessor on a framed port. A request is  **/
+/**  one frame holding the method, the call ID and the arguments. The        **/
+/**  coprocessor answers with one frame holding SERIAL_RPC_RESPONSE, the     **/
+/**  call's ID, a status (0 for success) and the results. Responses are      **/
+/**  matched to their calls as the system daemon receives them, and every    **/
+/**  other frame is still read with serial_read_frame().                     **/
+/**                                                                          **/
+/**  Methods are best declared with SERIAL_RPC_METHOD(), which gives each a  **/
+/**  typed function, e.g.                                                    **/
+/**    SERIAL_RPC_METHOD(vision_find, 1, vision_query_s_t, vision_blobs_s_t) **/
+/**  declares vision_find(port, &query, &blobs, timeout).                    **/
+/******************************************************************************/
+
+/**
+ * The first byte of every response frame
+ */
+#define SERIAL_RPC_RESPONSE 0xff
+
+/**
+ * The most calls which can be waiting for their responses on one port
+ */
+#define SERIAL_RPC_MAX_CALLS 8
+
+/**
+ * Declares a static inline function called name which calls method_id with an
+ * args_type argument and gets a result_type result, see serial_rpc_call().
+ * Both types are copied byte for byte, so both sides must agree on their
+ * layout.
+ */
+#define SERIAL_RPC_METHOD(name, method_id, args_type, result_type)                                        \
+	static inline int32_t name(uint8_t port, const args_type* args, result_type* result, uint32_t timeout) { \
+		return serial_rpc_call(port, method_id, args, sizeof(args_type), result, sizeof(result_type), timeout); \
+	}
+
+/**
+ * Enables RPC on a port. The port's framing must also be enabled with
+ * serial_set_framing().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid
+ * ENOMEM - The call slots could not be allocated
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t serial_rpc_enable(uint8_t port);
+
+/**
+ * Calls a method on the coprocessor and waits for its response.
+ *
+ * The arguments are written into the port's write queue as part of the request
+ * frame without being copied anywhere else first, and the results are copied
+ * straight into result by the system daemon. The calling task sleeps until
+ * then, so several tasks can have calls waiting at once.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or doesn't have RPC enabled, or args_len is
+ *          over SERIAL_MAX_FRAME_SIZE - 2
+ * EBUSY - SERIAL_RPC_MAX_CALLS calls are already waiting on the port
+ * EAGAIN - There isn't room for the request in the write queue
+ * ETIMEDOUT - No response came in time
+ * EPROTO - The response's status wasn't 0
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param method
+ *        The method to call
+ * \param args
+ *        The arguments
+ * \param args_len
+ *        The length of the arguments
+ * \param[out] result
+ *        The buffer for the results
+ * \param result_max
+ *        The size of the buffer. Longer results are cut short
+ * \param timeout
+ *        How long to wait for the response, in milliseconds
+ *
+ * \return The length of the results or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t serial_rpc_call(uint8_t port, uint8_t method, const void* args, size_t args_len, void* result,
+                        size_t result_max, uint32_t timeout);
+
+/**
+ * Gets the number of responses received on a port which didn't match a waiting
+ * call, e.g. because the call had already timed out.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or doesn't have RPC enabled
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ *
+ * \return The number of stray responses or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t serial_rpc_get_stray(uint8_t port);
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * One part of the data written by serial_writev()
+ */
+typedef struct serial_iovec_s {
+	const void* data;
+	size_t length;
+} serial_iovec_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Writes several buffers to the port as one contiguous transmission.
+ *
+ * For example, a header, a payload and a CRC can be written without first
+ * copying them into one buffer. The data is queued all at once, or not at all
+ * if there isn't room for it in the port's write queue, and this never waits
+ * for the port.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or iov is NULL
+ * ENODEV - The port hasn't been enabled with serial_enable()
+ * EACCES - Another task is currently writing to the port
+ * EAGAIN - There isn't room for all of the data in the write queue
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param iov
+ *        The buffers to write, in order
+ * \param count
+ *        The number of buffers
+ *
+ * \return The total number of bytes written or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t serial_writev(uint8_t port, const serial_iovec_s_t* iov, int32_t count);
+
+/******************************************************************************/
+/**                           Serial buffer tuning                           **/
+/**                                                                          **/
+/**  The system daemon moves data between VEXos and each enabled port's      **/
+/**  kernel buffers every cycle (2 ms). At high baud rates the buffers       **/
+/**  should hold a few cycles of data, so a reader which isn't scheduled in  **/
+/**  time doesn't leave VEXos's small buffer to overflow.                    **/
+/******************************************************************************/
+
+/**
+ * The largest receive or transmit buffer a port may have, in bytes
+ */
+#define SERIAL_MAX_BUFFER_SIZE 65536
+
+#ifdef __cplusplus
+}  // namespace c
+#endif
+
+/**
+ * A port's buffer sizes and counters, see serial_get_buffer_stats()
+ */
+typedef struct serial_buffer_stats_s {
+	uint32_t rx_size;       // The size of the receive buffer
+	uint32_t tx_size;       // The size of the transmit buffer
+	uint32_t rx_bytes;      // Bytes moved from VEXos into the receive buffer
+	uint32_t tx_bytes;      // Bytes handed from the transmit buffer to VEXos
+	uint32_t rx_overflows;  // Times received data was left in VEXos because the receive buffer was full
+	uint32_t tx_overflows;  // Writes cut short or refused because the transmit buffer was full
+	uint32_t rx_peak;       // The most bytes the receive buffer has held
+	uint32_t tx_peak;       // The most bytes the transmit buffer has held
+} serial_buffer_stats_s_t;
+
+#ifdef __cplusplus
+namespace c {
+#endif
+
+/**
+ * Sets the sizes of the port's kernel receive and transmit buffers. This must
+ * be called before serial_enable(), which allocates them.
+ *
+ * For example, at 921600 baud a port receives about 184 bytes per daemon
+ * cycle, so an 8 KB receive buffer holds about 90 ms of data.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or a size is over SERIAL_MAX_BUFFER_SIZE
+ * EACCES - Another resource is currently trying to access the port.
+ * EBUSY - The port has already been enabled
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param rx_size
+ *        The size of the receive buffer in bytes, 0 for the default of 512
+ * \param tx_size
+ *        The size of the transmit buffer in bytes, 0 for the default of 1024
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t serial_set_buffer_sizes(uint8_t port, uint32_t rx_size, uint32_t tx_size);
+
+/**
+ * Gets the sizes, traffic and overflow counters of the port's buffers.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port is invalid or stats is NULL
+ * EACCES - Another resource is currently trying to access the port.
+ * ENODEV - The port hasn't been enabled with serial_enable()
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] stats
+ *        The buffer statistics
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t serial_get_buffer_stats(uint8_t port, serial_buffer_stats_s_t* stats);
+
 #ifdef __cplusplus
 }  // namespace c
 }  // namespace pros
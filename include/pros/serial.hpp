@@ -217,6 +217,95 @@ class Serial {
 	 */
 	virtual std::int32_t write(std::uint8_t* buffer, std::int32_t length) const;
 
+	/**
+	 * Sets how the port's input and frame output are framed.
+	 *
+	 * See serial_set_framing() for details.
+	 *
+	 * \param framing
+	 *        The framing to use
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t set_framing(serial_framing_e_t framing) const;
+
+	/**
+	 * Reads one whole frame received on the port.
+	 *
+	 * See serial_read_frame() for details.
+	 *
+	 * \param buffer
+	 *        The buffer to read the frame's payload into
+	 * \param max_length
+	 *        The size of the buffer. Use SERIAL_MAX_FRAME_SIZE to fit any frame
+	 * \param timeout
+	 *        How long to wait for a frame, in milliseconds
+	 *
+	 * \return The length of the frame, 0 if no frame arrived before the timeout
+	 * or PROS_ERR if the operation failed, setting errno.
+	 */
+	virtual std::int32_t read_frame(std::uint8_t* buffer, std::int32_t max_length, std::uint32_t timeout) const;
+
+	/**
+	 * Writes one frame to the port using the port's framing.
+	 *
+	 * See serial_write_frame() for details.
+	 *
+	 * \param data
+	 *        The frame's payload
+	 * \param length
+	 *        The length of the payload, at most SERIAL_MAX_FRAME_SIZE
+	 *
+	 * \return The length of the payload if the operation was successful or
+	 * PROS_ERR if the operation failed, setting errno.
+	 */
+	virtual std::int32_t write_frame(const std::uint8_t* data, std::int32_t length) const;
+
+	/**
+	 * Writes several buffers to the port as one contiguous transmission.
+	 *
+	 * See serial_writev() for details.
+	 *
+	 * \param iov
+	 *        The buffers to write, in order
+	 * \param count
+	 *        The number of buffers
+	 *
+	 * \return The total number of bytes written or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t writev(const serial_iovec_s_t* iov, std::int32_t count) const;
+
+	/**
+	 * Sets the sizes of the port's kernel receive and transmit buffers, before
+	 * the port is enabled.
+	 *
+	 * See serial_set_buffer_sizes() for details.
+	 *
+	 * \param rx_size
+	 *        The size of the receive buffer in bytes, 0 for the default
+	 * \param tx_size
+	 *        The size of the transmit buffer in bytes, 0 for the default
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t set_buffer_sizes(std::uint32_t rx_size, std::uint32_t tx_size) const;
+
+	/**
+	 * Gets the sizes, traffic and overflow counters of the port's buffers.
+	 *
+	 * See serial_get_buffer_stats() for details.
+	 *
+	 * \param[out] stats
+	 *        The buffer statistics
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	virtual std::int32_t get_buffer_stats(serial_buffer_stats_s_t* stats) const;
+
 	private:
 	const std::uint8_t _port;
 };
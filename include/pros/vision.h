@@ -90,6 +90,60 @@ typedef struct __attribute__((__packed__)) vision_object {
 	int16_t y_middle_coord;
 } vision_object_s_t;
 
+/**
+ * The most objects a vision snapshot holds.
+ */
+#define VISION_SNAPSHOT_MAX_OBJECTS 16
+
+/**
+ * A copy of the objects in one of the Vision Sensor's frames, made by the
+ * system daemon.
+ */
+typedef struct vision_snapshot_s {
+	uint32_t timestamp;   // The time in ms the sensor last sent data
+	uint32_t updated_us;  // The micros() time the daemon first saw that data, see vdml_get_last_update()
+	uint32_t frame;       // Counts up every time the objects change
+	uint32_t count;       // The number of objects in objects
+	// The objects, roughly ordered by size like vision_read_by_size() and with
+	// the port's zero point applied
+	vision_object_s_t objects[VISION_SNAPSHOT_MAX_OBJECTS];
+} vision_snapshot_s_t;
+
+/**
+ * Selects objects from a vision snapshot with vision_snapshot_filter().
+ */
+typedef struct vision_filter_s {
+	// The signature (1-7) or color code objects must have, or 0 for any
+	uint16_t signature;
+	// The smallest width times height objects may have
+	uint32_t min_area;
+	// The largest width times height objects may have, or 0 for no limit
+	uint32_t max_area;
+} vision_filter_s_t;
+
+/**
+ * The most objects vision_get_tracks() follows at once.
+ */
+#define VISION_MAX_TRACKS VISION_SNAPSHOT_MAX_OBJECTS
+
+/**
+ * How many frames in a row a tracked object may go unseen before its track is
+ * dropped.
+ */
+#define VISION_TRACK_MAX_MISSES 3
+
+/**
+ * An object followed from frame to frame by vision_get_tracks().
+ */
+typedef struct vision_track_s {
+	uint32_t id;       // Stays the same for as long as the object is tracked, and is never 0
+	uint32_t age;      // The number of frames since the object was first seen
+	uint32_t missed;   // The number of frames in a row the object hasn't been seen in
+	float x_velocity;  // The speed of the object's middle in pixels per second, smoothed over frames
+	float y_velocity;
+	vision_object_s_t object;  // The object as it was last seen
+} vision_track_s_t;
+
 typedef enum vision_zero {
 	E_VISION_ZERO_TOPLEFT = 0,  // (0,0) coordinate is the top left of the FOV
 	E_VISION_ZERO_CENTER = 1    // (0,0) coordinate is the center of the FOV
@@ -407,6 +461,10 @@ int32_t vision_read_by_code(uint8_t port, const uint32_t size_id, const vision_c
 /**
  * Gets the object detection signature with the given id number.
  *
+ * The kernel keeps each signature once it has been read from the sensor or set
+ * with vision_set_signature(), so only the first read of each goes to the
+ * sensor. They are read again after the sensor is unplugged or replaced.
+ *
  * \param port
  *        The V5 port number from 1-21
  * \param signature_id
@@ -548,6 +606,165 @@ int32_t vision_set_zero_point(uint8_t port, vision_zero_e_t zero_point);
  */
 int32_t vision_set_wifi_mode(uint8_t port, const uint8_t enable);
 
+/**
+ * Starts or stops copying the Vision Sensor's objects into a snapshot every
+ * frame.
+ *
+ * While it is enabled, the system daemon copies the whole object list once
+ * every time the sensor sends a new frame. Any number of tasks can then get
+ * the snapshot with vision_snapshot_get() and filter it with
+ * vision_snapshot_filter() without touching the sensor. The snapshot's memory
+ * is allocated the first time it is enabled and kept after it is disabled.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENOMEM - The snapshot could not be allocated
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param enable
+ *        Whether to copy the sensor's frames
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t vision_snapshot_enable(uint8_t port, const bool enable);
+
+/**
+ * Gets the latest frame copied for the Vision Sensor.
+ *
+ * This doesn't take the sensor's port, so it never waits on other tasks.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * EINVAL - snapshot is NULL or snapshots aren't enabled for the port
+ * EAGAIN - No frame has been copied yet
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] snapshot
+ *             The snapshot to fill
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t vision_snapshot_get(uint8_t port, vision_snapshot_s_t* const snapshot);
+
+/**
+ * Copies the objects of a snapshot which match a filter, sorted by area with
+ * the largest first. Objects with the same area keep the sensor's order.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - snapshot, filter or object_arr is NULL
+ *
+ * \param snapshot
+ *        The snapshot from vision_snapshot_get()
+ * \param filter
+ *        The signature and sizes the objects must have
+ * \param object_count
+ *        The most objects to copy
+ * \param[out] object_arr
+ *             The array to copy the objects into
+ *
+ * \return The number of objects copied, or PROS_ERR if the operation failed,
+ * setting errno. All objects in object_arr that were not found are given
+ * VISION_OBJECT_ERR_SIG as their signature.
+ */
+int32_t vision_snapshot_filter(const vision_snapshot_s_t* const snapshot, const vision_filter_s_t* const filter,
+                               const uint32_t object_count, vision_object_s_t* const object_arr);
+
+/**
+ * Waits for the Vision Sensor's next frame.
+ *
+ * The smart port updates more often than the sensor makes frames, so the
+ * system daemon compares the objects of each update with the last frame's and
+ * only counts it as a new frame if they changed. Querying the sensor once
+ * after every call processes every frame exactly once. Since a frame only
+ * counts as new if something in it changed, this keeps waiting while the
+ * sensor sees exactly the same objects.
+ *
+ * Snapshots are enabled for the port if they weren't already, see
+ * vision_snapshot_enable(), and the frame can be read with
+ * vision_snapshot_get().
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * ENOMEM - The snapshot could not be allocated
+ * ETIMEDOUT - No new frame arrived before the timeout
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param timeout
+ *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+ *
+ * \return The new frame's sequence number, as in the snapshot's frame, or
+ * PROS_ERR if the operation failed, setting errno.
+ */
+int32_t vision_wait_for_frame(uint8_t port, uint32_t timeout);
+
+/**
+ * Starts or stops following the Vision Sensor's objects from frame to frame.
+ *
+ * While it is enabled, the system daemon matches the objects of every new
+ * frame to the tracks of the last one, so that each object keeps the same
+ * track id for as long as it stays in view, and works out how fast each one
+ * is moving. The closest pairs of a track and an object with the same
+ * signature are matched first, and an object is only matched to a track whose
+ * predicted position is within gate pixels of it. Objects which don't match a
+ * track start new ones, and tracks which aren't matched for more than
+ * VISION_TRACK_MAX_MISSES frames are dropped.
+ *
+ * Snapshots are enabled for the port if they weren't already, see
+ * vision_snapshot_enable(), since tracking works on them. Enabling tracking
+ * again starts every track over.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * EINVAL - gate is 0 while enabling
+ * ENOMEM - The snapshot or tracks could not be allocated
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param enable
+ *        Whether to track the sensor's objects
+ * \param gate
+ *        The farthest in pixels an object may be from where a track expects
+ *        it to be and still be matched to it
+ *
+ * \return 1 if the operation was successful or PROS_ERR if the operation
+ * failed, setting errno.
+ */
+int32_t vision_tracking_enable(uint8_t port, const bool enable, const uint16_t gate);
+
+/**
+ * Gets the tracks of the Vision Sensor's objects as of its latest frame, the
+ * oldest first.
+ *
+ * This doesn't take the sensor's port, and every task reads the same tracks,
+ * which are only worked out once per frame.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * ENXIO - The given value is not within the range of V5 ports (1-21).
+ * EINVAL - tracks is NULL or tracking isn't enabled for the port
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param[out] tracks
+ *             The array to copy the tracks into
+ * \param track_count
+ *        The most tracks to copy
+ *
+ * \return The number of tracks copied, or PROS_ERR if the operation failed,
+ * setting errno.
+ */
+int32_t vision_get_tracks(uint8_t port, vision_track_s_t* const tracks, const uint32_t track_count);
+
 #ifdef __cplusplus
 }  // namespace c
 }  // namespace pros
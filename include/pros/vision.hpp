@@ -20,6 +20,7 @@
 #ifndef _PROS_VISION_HPP_
 #define _PROS_VISION_HPP_
 
+#include "pros/rtos.h"
 #include "pros/vision.h"
 
 #include <cstdint>
@@ -438,6 +439,78 @@ class Vision {
 	 */
 	std::int32_t set_wifi_mode(const std::uint8_t enable) const;
 
+	/**
+	 * Gets the latest frame the system daemon copied from the Vision sensor,
+	 * without taking its port. See pros::c::vision_snapshot_enable() and
+	 * pros::c::vision_snapshot_get().
+	 *
+	 * This functions uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - snapshot is NULL or snapshots aren't enabled for the port
+	 * EAGAIN - No frame has been copied yet
+	 *
+	 * \param[out] snapshot
+	 *             The snapshot to fill
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t get_snapshot(vision_snapshot_s_t* const snapshot) const;
+
+	/**
+	 * Waits for the Vision sensor's next frame. See
+	 * pros::c::vision_wait_for_frame().
+	 *
+	 * This functions uses the following values of errno when an error state is
+	 * reached:
+	 * ETIMEDOUT - No new frame arrived before the timeout
+	 *
+	 * \param timeout
+	 *        The maximum time to wait in milliseconds, or TIMEOUT_MAX
+	 *
+	 * \return The new frame's sequence number, or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t wait_for_frame(const std::uint32_t timeout = TIMEOUT_MAX) const;
+
+	/**
+	 * Starts or stops following the Vision sensor's objects from frame to
+	 * frame. See pros::c::vision_tracking_enable().
+	 *
+	 * This functions uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - gate is 0 while enabling
+	 * ENOMEM - The snapshot or tracks could not be allocated
+	 *
+	 * \param enable
+	 *        Whether to track the sensor's objects
+	 * \param gate
+	 *        The farthest in pixels an object may be from where a track expects
+	 *        it to be and still be matched to it
+	 *
+	 * \return 1 if the operation was successful or PROS_ERR if the operation
+	 * failed, setting errno.
+	 */
+	std::int32_t set_tracking(const bool enable, const std::uint16_t gate = 20) const;
+
+	/**
+	 * Gets the tracks of the Vision sensor's objects as of its latest frame, the
+	 * oldest first. See pros::c::vision_get_tracks().
+	 *
+	 * This functions uses the following values of errno when an error state is
+	 * reached:
+	 * EINVAL - tracks is NULL or tracking isn't enabled for the port
+	 *
+	 * \param[out] tracks
+	 *             The array to copy the tracks into
+	 * \param track_count
+	 *        The most tracks to copy
+	 *
+	 * \return The number of tracks copied, or PROS_ERR if the operation failed,
+	 * setting errno.
+	 */
+	std::int32_t get_tracks(vision_track_s_t* const tracks, const std::uint32_t track_count) const;
+
 	private:
 	std::uint8_t _port;
 };
@@ -122,11 +122,15 @@
 #define configUSE_TICK_HOOK                     0
 #define configMAX_PRIORITIES                    ( 16 )
 #define configMINIMAL_STACK_SIZE                ( ( unsigned short ) 250 )
-// allocate 1 MB for FreeRTOS heap
-#define configTOTAL_HEAP_SIZE                   ( 0x100000 )
+// 1 MB by default, see system/kernel_config.h
+#define configTOTAL_HEAP_SIZE                   ( KERNEL_HEAP_SIZE )
+// 1 for the constant time heap in heap_tlsf.c, 0 for the first fit heap in heap_4.c
+#define configUSE_TLSF_HEAP                     1
 #define configMAX_TASK_NAME_LEN                 ( 32 )
 #define configUSE_TRACE_FACILITY                1
 #define INCLUDE_uxTaskGetStackHighWaterMark     1
+/* Lets the size of every task's stack be reported. */
+#define configRECORD_STACK_HIGH_ADDRESS         1
 #define configUSE_16_BIT_TICKS                  0
 #define configIDLE_SHOULD_YIELD                 1
 #define configUSE_MUTEXES                       1
@@ -136,12 +140,21 @@
 #define configUSE_MALLOC_FAILED_HOOK            1
 #define configUSE_APPLICATION_TASK_TAG          0
 #define configUSE_COUNTING_SEMAPHORES           1
-#define configUSE_QUEUE_SETS                    0
+#define configUSE_QUEUE_SETS                    1
 #define configSUPPORT_STATIC_ALLOCATION         1
 #define configUSE_NEWLIB_REENTRANT              1
 #define configSTACK_DEPTH_TYPE                  size_t
 
-#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 2
+// Mirrored by pros::detail::thread_local_storage_pointers in pros/rtos.hpp
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 7
+
+/* Gives the blocks a task cached in front of newlib's malloc() back when it is
+deleted, see system/mlock.c, frees a periodic task's timing record, see
+rtos/periodic_task.c, and forgets the task's FPU registers, see rtos/port.c. */
+void malloc_cache_release( void *task );
+void periodic_task_release( void *task );
+void vPortCleanUpFPUContext( void *pxTCB );
+#define portCLEAN_UP_TCB( pxTCB ) do { vPortCleanUpFPUContext( pxTCB ); malloc_cache_release( pxTCB ); periodic_task_release( pxTCB ); } while( 0 )
 
 /* Include the query-heap CLI command to query the free heap space. */
 #define configINCLUDE_QUERY_HEAP_COMMAND        1
@@ -156,7 +169,8 @@
 be created without an FPU context, and a task must call vTaskUsesFPU() before
 making use of any FPU registers.  If configUSE_TASK_FPU_SUPPORT is set to 2 then
 tasks are created with an FPU context by default, and calling vTaskUsesFPU() has
-no effect. */
+no effect.  The port switches the FPU registers lazily, on a task's first
+floating point instruction after a context switch, and only supports 2. */
 #define configUSE_TASK_FPU_SUPPORT              2
 
 /* Set the following definitions to 1 to include the API function, or zero
@@ -182,12 +196,13 @@ readable ASCII form.  See the notes in the implementation of vTaskList() within
 FreeRTOS/Source/tasks.c for limitations. */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    1
 
-/* The private watchdog is used to generate run time stats. */
+/* Run time stats are kept in microseconds of the high resolution timer, whose
+lower 32 bits wrap around about every 71 minutes. */
 extern void vInitialiseTimerForRunTimeStats( void );
-extern uint32_t vexSystemWatchdogGet( void );
+extern uint64_t vexSystemHighResTimeGet( void );
 #define configGENERATE_RUN_TIME_STATS 1
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() vInitialiseTimerForRunTimeStats()
-#define portGET_RUN_TIME_COUNTER_VALUE()         vexSystemWatchdogGet()
+#define portGET_RUN_TIME_COUNTER_VALUE()         ( ( uint32_t ) vexSystemHighResTimeGet() )
 
 /* The size of the global output buffer that is available for use when there
 are multiple command interpreters running at once (for example, one on a UART
@@ -231,4 +246,25 @@ Zynq MPU. */
 #define configINTERRUPT_CONTROLLER_CPU_INTERFACE_OFFSET ( -0xf00 )
 #define configUNIQUE_INTERRUPT_PRIORITIES               32
 
+/* Set to 0 to leave the scheduler trace recorder's hooks out of the kernel
+entirely. While compiled in, they cost a load and a branch each until a trace
+is started. */
+#define configUSE_TRACE_RECORDER 1
+#if ( configUSE_TRACE_RECORDER == 1 )
+	#include "rtos/trace_recorder.h"
+#endif
+
+/* Set to 1 to track every live kmalloc() and malloc() allocation by call site
+and task, see rtos/heap_track.c. The table takes 16 bytes per entry, and the
+number of entries must be a power of two. */
+#define configUSE_HEAP_TRACKING 0
+#define configHEAP_TRACKING_ENTRIES 256
+#if ( configUSE_HEAP_TRACKING == 1 )
+	void heap_track_alloc( void *ptr, size_t size, void *caller, bool newlib );
+	void heap_track_free( void *ptr );
+	/* Expanded inside kmalloc() and kfree(), so the return address is the caller's */
+	#define traceMALLOC( pvAddress, uiSize ) heap_track_alloc( ( pvAddress ), ( uiSize ), __builtin_return_address( 0 ), false )
+	#define traceFREE( pvAddress, uiSize ) heap_track_free( pvAddress )
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
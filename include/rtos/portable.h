@@ -110,6 +110,9 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) ;
  */
 void *kmalloc( size_t xSize ) ;
 void kfree( void *pv ) ;
+void *kmalloc_aligned( size_t xSize, size_t xAlignment ) ;
+void kfree_aligned( void *pv ) ;
+size_t kmalloc_block_size( const void *pv ) ;
 void vPortInitialiseBlocks( void ) ;
 size_t xPortGetFreeHeapSize( void ) ;
 size_t xPortGetMinimumEverFreeHeapSize( void ) ;
@@ -63,6 +63,7 @@ typedef void * QueueSetMemberHandle_t;
 #define	queueSEND_TO_BACK		( ( int32_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( int32_t ) 1 )
 #define queueOVERWRITE			( ( int32_t ) 2 )
+#define queueRESERVE_BACK		( ( int32_t ) 3 ) /* PROS extension: hands out the back slot instead of copying into it. */
 
 /* For internal use only.  These definitions *must* match those in queue.c. */
 #define queueQUEUE_TYPE_BASE				( ( uint8_t ) 0U )
@@ -71,6 +72,7 @@ typedef void * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_COUNTING_SEMAPHORE	( ( uint8_t ) 2U )
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE	( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX		( ( uint8_t ) 4U )
+#define queueQUEUE_TYPE_CEILING_MUTEX		( ( uint8_t ) 5U ) /* PROS extension: see mutex_create_ceiling() in semphr.c. */
 
 /**
  * queue. h
@@ -311,6 +313,24 @@ typedef void * QueueSetMemberHandle_t;
  */
 bool queue_prepend(queue_t queue, const void* item, uint32_t timeout);
 
+/*
+ * PROS extension: zero-copy access to queue items. See pros/apix.h for details.
+ */
+void* queue_reserve_back(queue_t queue, uint32_t timeout);
+bool queue_commit(queue_t queue);
+void* queue_peek_front_ptr(queue_t queue, uint32_t timeout);
+bool queue_release(queue_t queue);
+
+/*
+ * PROS extension: queue sets. See pros/apix.h for details.
+ */
+typedef void* queue_set_t;
+queue_set_t queue_set_create(uint32_t length);
+void queue_set_delete(queue_set_t set);
+bool queue_set_add(queue_set_t set, void* member);
+bool queue_set_remove(queue_set_t set, void* member);
+void* queue_set_select(queue_set_t set, uint32_t timeout);
+
 /**
  * queue. h
  * <pre>
@@ -1417,6 +1437,7 @@ queue_t xQueueCreateCountingSemaphoreStatic( const uint32_t uxMaxCount, const ui
 int32_t xQueueSemaphoreTake( queue_t xQueue, uint32_t xTicksToWait ) ;
 void* xQueueGetMutexHolder( queue_t xSemaphore ) ;
 void* xQueueGetMutexHolderFromISR( queue_t xSemaphore ) ;
+int32_t xQueueTakeMutexFor( queue_t xMutex, void* xHolder ) ;
 
 /*
  * For internal use only.  Use xSemaphoreTakeMutexRecursive() or
@@ -499,6 +499,123 @@ size_t stream_buf_recv( stream_buf_t xStreamBuffer,
 							 size_t xBufferLengthBytes,
 							 uint32_t xTicksToWait ) ;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t stream_buf_peek_contiguous( stream_buf_t xStreamBuffer, uint8_t **ppucData );
+</pre>
+ *
+ * PROS extension: gets the bytes at the front of a stream buffer without
+ * copying them. Only the part of the data which is contiguous in memory is
+ * returned, so data which wraps around the end of the buffer takes two calls.
+ * The bytes stay in the buffer until stream_buf_consume() is called.
+ *
+ * Must only be used by the stream buffer's single reader.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to peek at.
+ *
+ * @param ppucData Set to point at the first byte in the buffer.
+ *
+ * @return The number of contiguous bytes available at *ppucData.
+ */
+size_t stream_buf_peek_contiguous( stream_buf_t xStreamBuffer, uint8_t **ppucData ) ;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t stream_buf_consume( stream_buf_t xStreamBuffer, size_t xCount );
+</pre>
+ *
+ * PROS extension: removes bytes from the front of a stream buffer, typically
+ * after they have been used through stream_buf_peek_contiguous(), and unblocks
+ * a task waiting to send.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xCount The number of bytes to remove.
+ *
+ * @return The number of bytes removed, which is less than xCount if fewer bytes
+ * were in the buffer.
+ */
+size_t stream_buf_consume( stream_buf_t xStreamBuffer, size_t xCount ) ;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t stream_buf_peek_free( stream_buf_t xStreamBuffer, uint8_t **ppucData );
+</pre>
+ *
+ * PROS extension: gets the free space at the back of a stream buffer so data
+ * can be produced directly into the buffer's memory. Only the part of the
+ * space which is contiguous in memory is returned, so a write which wraps
+ * around the end of the buffer takes two calls. Nothing is visible to the
+ * reader until stream_buf_commit() is called.
+ *
+ * Must only be used by the stream buffer's single writer.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write into.
+ *
+ * @param ppucData Set to point at the first free byte in the buffer.
+ *
+ * @return The number of contiguous bytes which can be written at *ppucData.
+ */
+size_t stream_buf_peek_free( stream_buf_t xStreamBuffer, uint8_t **ppucData ) ;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t stream_buf_commit( stream_buf_t xStreamBuffer, size_t xCount );
+</pre>
+ *
+ * PROS extension: makes bytes written through stream_buf_peek_free() visible
+ * to the reader, and unblocks a task waiting to receive.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xCount The number of bytes to add.
+ *
+ * @return The number of bytes added, which is less than xCount if there wasn't
+ * room for all of them.
+ */
+size_t stream_buf_commit( stream_buf_t xStreamBuffer, size_t xCount ) ;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+stream_buf_t stream_buf_create_spsc_static( size_t xBufferSizeBytes,
+                                            uint8_t *pucStreamBufferStorageArea,
+                                            static_stream_buf_s_t *pxStaticStreamBuffer );
+</pre>
+ *
+ * PROS extension: like stream_buf_create_static() with a trigger level of 1,
+ * for buffers with exactly one sending task and one receiving task (or callers
+ * which serialize each side themselves). Sends and receives which don't have to
+ * wait take no critical section and only go through the scheduler when the
+ * other side is blocked, and stream_buf_peek_free()/stream_buf_commit() and
+ * stream_buf_peek_contiguous()/stream_buf_consume() give zero-copy access.
+ *
+ * Must not be used from interrupts.
+ *
+ * @param xBufferSizeBytes The size of the storage area. Like other static
+ * stream buffers, the buffer holds one byte less than this.
+ *
+ * @param pucStreamBufferStorageArea Must point to a uint8_t array that is at
+ * least xBufferSizeBytes big.
+ *
+ * @param pxStaticStreamBuffer Used to hold the stream buffer's data structure.
+ *
+ * @return The handle of the created stream buffer, or NULL if either pointer
+ * is NULL.
+ */
+stream_buf_t stream_buf_create_spsc_static( size_t xBufferSizeBytes,
+											uint8_t * const pucStreamBufferStorageArea,
+											static_stream_buf_s_t * const pxStaticStreamBuffer ) ;
+
 /**
  * stream_buffer.h
  *
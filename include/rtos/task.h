@@ -123,9 +123,24 @@ typedef struct xTASK_STATUS
 	uint32_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited to avoid unbounded priority inversion when obtaining a mutex.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
 	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	task_stack_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
+	#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+		task_stack_t *pxEndOfStack;	/* Points to the highest address of the task's stack area. */
+	#endif
 	uint16_t usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Filled in by task_list_snapshot().  Must match task_snapshot_s_t in
+pros/apix.h. */
+typedef struct task_snapshot_s
+{
+	task_t task;
+	char name[ configMAX_TASK_NAME_LEN ];
+	task_state_e_t state;
+	uint32_t priority;
+	uint32_t stack_free;	/* The fewest words ever left free on the stack. */
+	uint32_t cpu_time;		/* Microseconds spent running. */
+} task_snapshot_s_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -426,6 +441,29 @@ is used in assert() statements. */
 	                            static_task_s_t * const task_buffer ) ;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * task. h
+ * <pre>task_t task_restart_static( task_t xTask, task_fn_t pvTaskCode, void * pvParameters, uint32_t uxPriority, const size_t usStackDepth, const char * const pcName );</pre>
+ *
+ * Restarts a task created with task_create_static() in place, running
+ * pvTaskCode from the top of the same stack.  This is equivalent to deleting
+ * the task and creating it again on the same buffers, but does not depend on
+ * the idle task having cleaned the old task up.
+ *
+ * The task may be in any state, including deleted, but must not be the
+ * calling task.  Mutexes held by the old task are not released.
+ *
+ * \return The handle of the restarted task, which is always xTask, or NULL if
+ * the task cannot be restarted.
+ *
+ * \ingroup Tasks
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( INCLUDE_vTaskDelete == 1 ) )
+	task_t task_restart_static(	task_t task, task_fn_t task_code, void* const param,
+	                            uint32_t priority, const size_t stack_size,
+	                            const char* const name ) ;
+#endif
+
 /**
  * task. h
  * <pre>void task_delete( task_t xTask );</pre>
@@ -650,6 +688,12 @@ int32_t task_abort_delay( task_t xTask ) ;
  */
 uint32_t task_get_priority( task_t xTask ) ;
 
+/*
+ * The priority xTask was last given, leaving out any it has inherited from
+ * the mutexes it holds.
+ */
+uint32_t task_get_base_priority( task_t xTask ) ;
+
 /**
  * task. h
  * <pre>uint32_t uxTaskPriorityGetFromISR( task_t xTask );</pre>
@@ -1353,6 +1397,36 @@ task_t xTaskGetIdleTaskHandle( void ) ;
  */
 uint32_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime ) ;
 
+/**
+ * task. h
+ * <PRE>uint32_t uxTaskGetSystemStateExt( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime, const int32_t xGetFreeStackSpace );</PRE>
+ *
+ * Same as uxTaskGetSystemState(), but the stack high water mark of each task,
+ * which takes a scan of the whole stack to find, is only filled in when
+ * xGetFreeStackSpace is pdTRUE.
+ */
+uint32_t uxTaskGetSystemStateExt( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime, const int32_t xGetFreeStackSpace ) ;
+
+/**
+ * task. h
+ * <PRE>int32_t task_list_snapshot( task_snapshot_s_t * const pxSnapshot, const uint32_t uxCount );</PRE>
+ *
+ * Fills in the state of up to uxCount tasks in one walk of the task lists and
+ * returns how many tasks there are.  See pros/apix.h.
+ */
+int32_t task_list_snapshot( task_snapshot_s_t * const pxSnapshot, const uint32_t uxCount ) ;
+
+/**
+ * task. h
+ * <PRE>uint32_t uxTaskGetSystemStateFromAbort( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize );</PRE>
+ *
+ * Same as uxTaskGetSystemStateExt() without the stack high water marks or the
+ * total run time, but walks the task lists without suspending the scheduler.
+ * Only for the data abort handler, which runs with interrupts disabled and
+ * never returns to the scheduler.
+ */
+uint32_t uxTaskGetSystemStateFromAbort( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize ) ;
+
 /**
  * task. h
  * <PRE>void vTaskList( char *pcWriteBuffer );</PRE>
@@ -2093,6 +2167,12 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) ;
  */
 void *pvTaskIncrementMutexHeldCount( void ) ;
 
+/*
+ * For internal use only.  Increment the mutex held count of a task other than
+ * the calling one, which xQueueTakeMutexFor() made the holder of a mutex.
+ */
+void vTaskIncrementMutexHeldCountOf( task_t xTask ) ;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critial
  * section.
@@ -50,14 +50,7 @@ typedef struct tskTaskControlBlock
 	#endif
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
-		/* Allocate a Newlib reent structure that is specific to this task.
-		Note Newlib support has been included by popular demand, but is not
-		used by the FreeRTOS maintainers themselves.  FreeRTOS is not
-		responsible for resulting newlib operation.  User must be familiar with
-		newlib and must provide system-wide implementations of the necessary
-		stubs. Be warned that (at the time of writing) the current newlib design
-		implements a system-wide malloc() that must be provided with locks. */
-		struct	_reent xNewLib_reent;
+		struct	_reent *pxNewLib_reent;	/*< Points to xNewLib_reent, or to _GLOBAL_REENT for a light task. */
 	#endif
 
 	#if( configUSE_TASK_NOTIFICATIONS == 1 )
@@ -75,6 +68,23 @@ typedef struct tskTaskControlBlock
 		uint8_t ucDelayAborted;
 	#endif
 
+	struct tskTaskControlBlock *pxNameNext;	/*< The next task in the same bucket of the name index, see task_get_by_name(). */
+	uint32_t		uxStackFreeWords;	/*< The fewest words left free on the stack as of the last task_list_snapshot(). */
+
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		/* Allocate a Newlib reent structure that is specific to this task.
+		Note Newlib support has been included by popular demand, but is not
+		used by the FreeRTOS maintainers themselves.  FreeRTOS is not
+		responsible for resulting newlib operation.  User must be familiar with
+		newlib and must provide system-wide implementations of the necessary
+		stubs. Be warned that (at the time of writing) the current newlib design
+		implements a system-wide malloc() that must be provided with locks.
+
+		This comes last so that a light task's TCB can be allocated without it,
+		see task_create_light(). */
+		struct	_reent xNewLib_reent;
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
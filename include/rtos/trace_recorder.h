@@ -0,0 +1,136 @@
+/**
+ * \file rtos/trace_recorder.h
+ *
+ * FreeRTOS trace hooks for the scheduler trace recorder.
+ *
+ * This file is included at the end of FreeRTOSConfig.h so that the hooks
+ * replace the empty defaults in FreeRTOS.h. Each hook costs a load and a
+ * branch while no trace is being recorded. See rtos/trace_recorder.c for the
+ * recorder itself and pros/apix.h for the functions which control it.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include <stdint.h>
+
+// These must match trace_event_e_t in pros/apix.h
+#define TRACE_EVENT_TASK_SWITCHED_IN 1
+#define TRACE_EVENT_TASK_SWITCHED_OUT 2
+#define TRACE_EVENT_TASK_READY 3
+#define TRACE_EVENT_BLOCKING_ON_QUEUE_RECEIVE 4
+#define TRACE_EVENT_BLOCKING_ON_QUEUE_SEND 5
+#define TRACE_EVENT_MUTEX_TAKE 6
+#define TRACE_EVENT_MUTEX_GIVE 7
+#define TRACE_EVENT_PRIORITY_INHERIT 8
+#define TRACE_EVENT_PRIORITY_DISINHERIT 9
+#define TRACE_EVENT_MARK 10
+
+// Nonzero while a trace is being recorded
+extern volatile uint32_t trace_recording;
+// The number given to the last queue which was created
+extern uint32_t trace_queue_number;
+
+void trace_record(uint32_t type, uint32_t task, uint32_t priority, uint32_t arg);
+// Records an event of the calling task
+void trace_record_current(uint32_t type, uint32_t arg);
+// Remembers the name of a task which is created while recording, in case it is gone by the time the trace is sent
+void trace_record_task_name(uint32_t task, const char* name);
+// Copies up to max of the most recent events, oldest first, and returns how many were copied
+uint32_t trace_copy_recent(void* dest, uint32_t max);
+
+#define TRACE_ACTIVE() __builtin_expect(trace_recording, 0)
+
+// Used from tasks.c, where pxCurrentTCB and the ready lists are in scope
+
+#define traceTASK_SWITCHED_IN()                                                                      \
+	do {                                                                                             \
+		if (TRACE_ACTIVE()) {                                                                        \
+			trace_record(TRACE_EVENT_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber, pxCurrentTCB->uxPriority, \
+			             0);                                                                         \
+		}                                                                                            \
+	} while (0)
+
+// The argument is 1 if the task was preempted and is still ready, or 0 if it blocked
+#define traceTASK_SWITCHED_OUT()                                                                        \
+	do {                                                                                                \
+		if (TRACE_ACTIVE()) {                                                                           \
+			trace_record(TRACE_EVENT_TASK_SWITCHED_OUT, pxCurrentTCB->uxTCBNumber, pxCurrentTCB->uxPriority, \
+			             listIS_CONTAINED_WITHIN(&pxReadyTasksLists[pxCurrentTCB->uxPriority],           \
+			                                     &pxCurrentTCB->xStateListItem));                        \
+		}                                                                                               \
+	} while (0)
+
+#define traceTASK_CREATE(pxNewTCB)                                                   \
+	do {                                                                             \
+		if (TRACE_ACTIVE()) {                                                        \
+			trace_record_task_name((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName); \
+		}                                                                            \
+	} while (0)
+
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)                                                 \
+	do {                                                                                      \
+		if (TRACE_ACTIVE()) {                                                                 \
+			trace_record(TRACE_EVENT_TASK_READY, (pxTCB)->uxTCBNumber, (pxTCB)->uxPriority, 0); \
+		}                                                                                     \
+	} while (0)
+
+#define traceTASK_PRIORITY_INHERIT(pxTCBOfMutexHolder, uxInheritedPriority)                                  \
+	do {                                                                                                     \
+		if (TRACE_ACTIVE()) {                                                                                \
+			trace_record(TRACE_EVENT_PRIORITY_INHERIT, (pxTCBOfMutexHolder)->uxTCBNumber,                    \
+			             (pxTCBOfMutexHolder)->uxPriority, (uxInheritedPriority));                           \
+		}                                                                                                    \
+	} while (0)
+
+#define traceTASK_PRIORITY_DISINHERIT(pxTCBOfMutexHolder, uxOriginalPriority)                                \
+	do {                                                                                                     \
+		if (TRACE_ACTIVE()) {                                                                                \
+			trace_record(TRACE_EVENT_PRIORITY_DISINHERIT, (pxTCBOfMutexHolder)->uxTCBNumber,                 \
+			             (pxTCBOfMutexHolder)->uxPriority, (uxOriginalPriority));                            \
+		}                                                                                                    \
+	} while (0)
+
+// Used from queue.c. Queues are numbered as they are created so that events can name them
+
+#define traceQUEUE_CREATE(pxNewQueue) ((pxNewQueue)->uxQueueNumber = ++trace_queue_number)
+
+#define TRACE_QUEUE_IS_MUTEX(pxQueue) \
+	((pxQueue)->ucQueueType == queueQUEUE_TYPE_MUTEX || (pxQueue)->ucQueueType == queueQUEUE_TYPE_RECURSIVE_MUTEX)
+
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)                                                     \
+	do {                                                                                            \
+		if (TRACE_ACTIVE()) {                                                                       \
+			trace_record_current(TRACE_EVENT_BLOCKING_ON_QUEUE_RECEIVE, (pxQueue)->uxQueueNumber); \
+		}                                                                                           \
+	} while (0)
+
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)                                                     \
+	do {                                                                                         \
+		if (TRACE_ACTIVE()) {                                                                    \
+			trace_record_current(TRACE_EVENT_BLOCKING_ON_QUEUE_SEND, (pxQueue)->uxQueueNumber); \
+		}                                                                                        \
+	} while (0)
+
+#define traceQUEUE_RECEIVE(pxQueue)                                                   \
+	do {                                                                              \
+		if (TRACE_ACTIVE() && TRACE_QUEUE_IS_MUTEX(pxQueue)) {                        \
+			trace_record_current(TRACE_EVENT_MUTEX_TAKE, (pxQueue)->uxQueueNumber);   \
+		}                                                                             \
+	} while (0)
+
+#define traceQUEUE_SEND(pxQueue)                                                      \
+	do {                                                                              \
+		if (TRACE_ACTIVE() && TRACE_QUEUE_IS_MUTEX(pxQueue)) {                        \
+			trace_record_current(TRACE_EVENT_MUTEX_GIVE, (pxQueue)->uxQueueNumber);   \
+		}                                                                             \
+	} while (0)
+
+#endif  // TRACE_RECORDER_H
@@ -0,0 +1,74 @@
+/**
+ * \file system/crash_dump.h
+ *
+ * The binary core written when a data abort happens, see system/crash_dump.c.
+ *
+ * The dump is kept in RAM which isn't cleared at startup and written to
+ * /usd/crash-N.bin, so it can be symbolized on a computer with the program's
+ * ELF files. Every field is little endian and the layout only changes along
+ * with CRASH_DUMP_VERSION.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define CRASH_DUMP_MAGIC 0x48535243  // 'CRSH' little endian
+#define CRASH_DUMP_VERSION 1
+
+#define CRASH_DUMP_STACK_WORDS 256
+#define CRASH_DUMP_MAX_TASKS 32
+#define CRASH_DUMP_TRACE_EVENTS 64
+#define CRASH_DUMP_TRACE_EVENT_SIZE 12  // a trace_event_s_t from pros/apix.h
+#define CRASH_DUMP_MAX_FILES 100
+
+typedef struct __attribute__((packed)) crash_dump_task {
+	uint32_t tcb;
+	uint32_t top_of_stack;  // where the task's registers were saved when it last stopped running
+	uint32_t stack_base;    // lowest address of the stack
+	uint32_t stack_end;     // highest address of the stack
+	uint16_t number;        // the task number used by the scheduler trace
+	uint8_t state;          // a task_state_e_t
+	uint8_t priority;
+	char name[16];  // cut short, the crashed task's full name is in the dump itself
+} crash_dump_task_s_t;
+
+typedef struct __attribute__((packed)) crash_dump {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	uint32_t size;  // bytes in the whole dump, for telling versions apart
+	uint32_t crc;   // CRC-32 of everything after this field
+	uint32_t millis;
+	uint32_t dfsr;         // the data fault status register
+	uint32_t dfar;         // the address whose access faulted
+	uint32_t regs[16];     // r0-r12, sp, lr and pc of the faulting instruction
+	uint32_t tcb;          // the task which was running, 0 if the scheduler hadn't started
+	char task_name[32];
+	uint32_t stack_base;   // the running task's stack bounds
+	uint32_t stack_end;
+	uint32_t stack_words;  // how many words of stack were copied, starting at sp
+	uint32_t task_count;
+	uint32_t trace_count;  // events, oldest first, 0 if no trace was recorded
+	uint32_t hot_table;    // the address of the hot image's table, 0 in a monolith build
+	uint32_t stack[CRASH_DUMP_STACK_WORDS];
+	crash_dump_task_s_t tasks[CRASH_DUMP_MAX_TASKS];
+	uint8_t trace[CRASH_DUMP_TRACE_EVENTS][CRASH_DUMP_TRACE_EVENT_SIZE];
+} crash_dump_s_t;
+
+// Fills in the dump from the registers at a data abort, r0-r15
+void crash_dump_capture(const uint32_t* regs);
+// Writes the dump to the next free /usd/crash-N.bin and forgets it. Returns N,
+// or -1 if there was no dump or it couldn't be written
+int32_t crash_dump_persist(void);
+// crash_dump_persist() from the abort handler, unless the card is in use
+int32_t crash_dump_persist_from_abort(void);
+// Writes out a dump left by the last run, if there is one
+void crash_dump_initialize(void);
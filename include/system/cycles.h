@@ -0,0 +1,57 @@
+/**
+ * \file system/cycles.h
+ *
+ * The CPU cycle counter
+ *
+ * On the brain this is the Cortex-A9's PMU cycle counter, which counts at the
+ * 667 MHz core clock and wraps every 6.4 seconds, so only differences between
+ * two readings taken less than that apart mean anything.
+ *
+ * Everything else the kernel does with the processor goes through the RTOS
+ * port or the hot/cold linking code, so this is the one bit of machine specific
+ * code the timing and benchmarking code needs. Anywhere but ARM it is backed by
+ * the v5_api's microsecond timer scaled to the same rate, so that code behaves
+ * the same when the kernel is built for a host machine against a simulated
+ * v5_api, only at microsecond resolution.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef __arm__
+// from v5_api.h, which not every user of this header includes
+uint64_t vexSystemHighResTimeGet(void);
+#endif
+
+// The Cortex-A9 runs at 667 MHz
+#define CPU_CYCLES_PER_US 667
+
+// Starts the cycle counter. The system daemon does this at startup
+static inline void cycle_counter_enable(void) {
+#ifdef __arm__
+	uint32_t pmcr;
+	__asm__ volatile("mrc p15, 0, %0, c9, c12, 0" : "=r"(pmcr));
+	// PMCR.E enables the performance counters
+	__asm__ volatile("mcr p15, 0, %0, c9, c12, 0" ::"r"(pmcr | 1));
+	// PMCNTENSET bit 31 enables the cycle counter
+	__asm__ volatile("mcr p15, 0, %0, c9, c12, 1" ::"r"(1 << 31));
+#endif
+}
+
+static inline uint32_t cycle_counter_get(void) {
+#ifdef __arm__
+	uint32_t cycles;
+	__asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+	return cycles;
+#else
+	return (uint32_t)(vexSystemHighResTimeGet() * CPU_CYCLES_PER_US);
+#endif
+}
@@ -20,3 +20,14 @@
 extern const struct fs_driver* const ser_driver;
 int ser_open_r(struct _reent* r, const char* path, int flags, int mode);
 void ser_initialize(void);
+// Sends a frame on a stream even if it isn't activated. Used to answer host commands
+bool ser_frame_write(uint32_t stream_id, const void* data, size_t len);
+// Checks whether a stream is sent over the serial line, i.e. it is activated or
+// always delivered
+bool ser_stream_is_sent(uint32_t stream_id);
+// Takes a serial buffer from the heap for size bytes, or for default_size if
+// size is 0 or the heap can't fit it. Returns the size taken
+size_t ser_buffer_alloc(uint32_t size, size_t default_size, uint8_t** buffer);
+// Gets the sizes the user program picked with PROS_SER_BUFFER_SIZES(), found the
+// same way as boot_get_options(), or NULL if it didn't pick any. From hot.c
+const ser_buffer_sizes_s_t* boot_get_ser_buffer_sizes(void);
@@ -15,8 +15,25 @@
 
 #pragma once
 
+#include <stdbool.h>
+
+#include "v5_api.h"
 #include "vfs.h"
 
 extern const struct fs_driver* const usd_driver;
 int usd_open_r(struct _reent* r, const char* path, int flags, int mode);
 void usd_initialize(void);
+
+// Serializes calls into the VEXos file system
+void usd_io_lock(void);
+void usd_io_unlock(void);
+// Whether some task holds the I/O lock. For the crash dump, which can't wait on it
+bool usd_io_is_locked(void);
+// Wakes the uSD writer task
+void usd_writer_notify(void);
+// Mounts the card if it hasn't been since it was put in. Called with the I/O lock held
+FRESULT usd_mount(void);
+// The errno for a VEXos file system result
+int usd_fresult_errno(FRESULT result);
+// Writes out full log buffers. Called by the uSD writer task with the I/O lock held
+void usd_log_flush(void);
@@ -28,17 +28,39 @@ struct fs_driver {
 	int (*isatty_r)(struct _reent*, void* const);
 	off_t (*lseek_r)(struct _reent*, void* const, off_t, int);
 	int (*ctl)(void* const, const uint32_t, void* const);
+	// returns which of the requested VFS_POLL* events are ready. Optional, files
+	// without it are always ready
+	int16_t (*poll)(void* const, const int16_t);
 };
 
+// The size of the file table, including the reserved file descriptors. Can be
+// overridden at build time
+#ifndef VFS_MAX_FILES_OPEN
+#define VFS_MAX_FILES_OPEN 63
+#endif
+
+// Driver arguments up to this size are stored in the file table itself
+#define VFS_INLINE_ARG_SIZE 16
+
 struct file_entry {
-	struct fs_driver const* driver;
+	struct fs_driver const* driver;  // NULL if the file descriptor isn't open
 	void* arg;
+	uint8_t inline_arg[VFS_INLINE_ARG_SIZE] __attribute__((aligned(8)));
 };
 
 // adds an entry to the file table
 int vfs_add_entry_r(struct _reent* r, struct fs_driver const* const driver, void* arg);
 
+// adds an entry to the file table whose argument is copied into the entry, so
+// the driver doesn't have to allocate (and free) it. size must be at most
+// VFS_INLINE_ARG_SIZE
+int vfs_add_entry_inline_r(struct _reent* r, struct fs_driver const* const driver, const void* arg, size_t size);
+
 // update an entry to the file table. Returns -1 if there was an error.
 // If driver is NULL, then the driver isn't updated. If arg is (void*)-1, then
 // the arg isn't updated.
 int vfs_update_entry(int file, struct fs_driver const* const driver, void* arg);
+
+// wakes every task blocked in vfs_poll so it can check its files again. Called
+// by drivers whenever a file may have become readable or writable
+void vfs_poll_notify(void);
@@ -1,5 +1,22 @@
 #pragma once
 
+#include <stdint.h>
+
+// The hot image is split into chunks of HOT_CHUNK_SIZE bytes, and the CRC-32 of
+// each chunk is recorded at the end of the image so that an upload only needs
+// to send the chunks which changed. v5-hot.ld reserves the table and
+// firmware/hot-chunks.py fills it in after linking.
+#define HOT_CHUNK_SIZE 4096
+#define HOT_CHUNKS_MAGIC 0x4B4E4843 // "CHNK", the hashes are filled in
+#define HOT_CHUNKS_EMPTY 0x00000000 // the image was never hashed
+
+// Last bytes of the hot image, preceded by count CRC-32s of the chunks
+struct hot_chunks {
+	uint32_t count;
+	uint32_t chunk_size;
+	uint32_t magic;
+};
+
 struct hot_table {
 	char const* compile_timestamp;
 	char const* compile_directory;
@@ -7,11 +24,34 @@ struct hot_table {
 	void* __exidx_start;
 	void* __exidx_end;
 
+	struct hot_chunks const* chunks;
+
 	struct {
 #define FUNC(F) void (*F)();
 #include "system/user_functions/list.h"
 #undef FUNC
 	} functions;
+
+	// Filled in by the cold image once the table is installed, so the unwinder
+	// can tell hot code from cold code with two compares. Both 0 when there is
+	// no hot exidx table
+	uintptr_t exidx_code_start;
+	uintptr_t exidx_code_end;
+
+	// Filled in by install_hot_table, in CPU cycles, for boot_report_times()
+	struct {
+		uint32_t bss_bytes;
+		uint32_t bss_cycles;
+		uint32_t ctor_count;
+		uint32_t ctor_cycles;
+		void (*slowest_ctor)(void);
+		uint32_t slowest_ctor_cycles;
+	} init_stats;
 };
 
 extern struct hot_table* const HOT_TABLE;
+
+// Checks the hot image in memory against its chunk hashes. Returns the index of
+// the first chunk which doesn't match, or -1 if all of them match or the image
+// was never hashed.
+int32_t hot_chunks_verify(struct hot_chunks const* chunks);
@@ -0,0 +1,93 @@
+/**
+ * \file system/kernel_config.h
+ *
+ * Sizes of the kernel's biggest static reservations
+ *
+ * The kernel's Makefile includes this header ahead of every kernel source, so
+ * LVGL's lv_conf.h and FreeRTOSConfig.h see it too. Every size can be
+ * overridden from the command line, e.g.
+ *
+ * make template EXTRA_CFLAGS+=-DKERNEL_HEAP_SIZE=0x80000
+ *
+ * `make size-report` prints what each subsystem reserves, so a build's memory
+ * can be traded for the program's own buffers deliberately. Shrinking a task
+ * stack below what its task needs corrupts memory, so check the task's
+ * stack statistics (task_get_stack_stats()) with the new size.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _SYSTEM_KERNEL_CONFIG_H_
+#define _SYSTEM_KERNEL_CONFIG_H_
+
+/******************************************************************************/
+/**                                 Memory                                   **/
+/******************************************************************************/
+// The FreeRTOS heap, which kmalloc(), malloc() and new allocate from
+#ifndef KERNEL_HEAP_SIZE
+#define KERNEL_HEAP_SIZE 0x100000
+#endif
+
+// LVGL's virtual display buffer in pixels. LVGL draws a strip this big at a
+// time, so a smaller one costs a redraw more passes but no quality
+#ifndef KERNEL_DISPLAY_VDB_SIZE
+#define KERNEL_DISPLAY_VDB_SIZE (LV_VER_RES * LV_HOR_RES)
+#endif
+// 1 to draw into one VDB while the flush task copies the other to the screen
+#ifndef KERNEL_DISPLAY_VDB_DOUBLE
+#define KERNEL_DISPLAY_VDB_DOUBLE 1
+#endif
+
+/******************************************************************************/
+/**                                 Buffers                                  **/
+/******************************************************************************/
+// The defaults of the serial buffers a program can resize with
+// PROS_SER_BUFFER_SIZES()
+#ifndef KERNEL_SER_INPUT_BUFFER_SIZE
+#define KERNEL_SER_INPUT_BUFFER_SIZE 0x1000
+#endif
+#ifndef KERNEL_SER_OUTPUT_BUFFER_SIZE
+#define KERNEL_SER_OUTPUT_BUFFER_SIZE 2047  // the normal priority queue
+#endif
+// The high and low priority queues
+#ifndef KERNEL_SER_PRIORITY_BUFFER_SIZE
+#define KERNEL_SER_PRIORITY_BUFFER_SIZE 512
+#endif
+
+// Allocated for each open file on the uSD card
+#ifndef KERNEL_USD_WRITE_BUFFER_SIZE
+#define KERNEL_USD_WRITE_BUFFER_SIZE 0x1000
+#endif
+#ifndef KERNEL_USD_READ_BUFFER_SIZE
+#define KERNEL_USD_READ_BUFFER_SIZE 0x1000
+#endif
+
+/******************************************************************************/
+/**                               Task stacks                                **/
+/**                                                                          **/
+/**  In words, like the stack depths passed to task_create()                 **/
+/******************************************************************************/
+#ifndef KERNEL_SYSTEM_DAEMON_STACK_DEPTH
+#define KERNEL_SYSTEM_DAEMON_STACK_DEPTH TASK_STACK_DEPTH_DEFAULT
+#endif
+// The task which runs initialize() and the competition mode functions, and the
+// tasks of the competition handlers which replace them
+#ifndef KERNEL_COMPETITION_TASK_STACK_DEPTH
+#define KERNEL_COMPETITION_TASK_STACK_DEPTH TASK_STACK_DEPTH_DEFAULT
+#endif
+#ifndef KERNEL_DISPLAY_DAEMON_STACK_DEPTH
+#define KERNEL_DISPLAY_DAEMON_STACK_DEPTH TASK_STACK_DEPTH_DEFAULT
+#endif
+#ifndef KERNEL_DISPLAY_FLUSH_STACK_DEPTH
+#define KERNEL_DISPLAY_FLUSH_STACK_DEPTH TASK_STACK_DEPTH_MIN
+#endif
+#ifndef KERNEL_SER_DAEMON_STACK_DEPTH
+#define KERNEL_SER_DAEMON_STACK_DEPTH TASK_STACK_DEPTH_MIN
+#endif
+
+#endif  // _SYSTEM_KERNEL_CONFIG_H_
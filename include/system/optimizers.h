@@ -18,3 +18,14 @@
 // See https://stackoverflow.com/q/109710 for discussion
 #define likely(cond) __builtin_expect(!!(cond), 1)
 #define unlikely(cond) __builtin_expect(!!(cond), 0)
+
+// Prevents the compiler from reordering memory accesses across this point
+#define compiler_barrier() __asm__ volatile("" ::: "memory")
+
+// Groups kernel code and data which run on every tick, context switch or
+// daemon cycle in a few cache lines of their own at the start of .text, .data
+// and .bss (see firmware/v5.ld), which PROS_BOOT_LOCK_FAST locks into the L2
+// cache. __pros_fast_bss is for zero-initialized data
+#define __pros_fast __attribute__((section(".text.pros_fast")))
+#define __pros_fast_data __attribute__((section(".data.pros_fast")))
+#define __pros_fast_bss __attribute__((section(".bss.pros_fast")))
@@ -21,19 +21,99 @@
 extern "C" {
 #endif
 
-typedef struct {
-	v5_device_e_t device_type;
+/*
+ * The size of the device specific data each port has, see
+ * v5_smart_device_s_t. 16 bytes in adi_data_s_t times 8 ADI Ports = 128, then
+ * the ADI's cached port configurations.
+ */
+#define REGISTRY_PAD_SIZE 144
+
+/*
+ * A port's entry in the registry.
+ *
+ * Everything a device call looks at on its way to VEXos shares one 32 byte
+ * cache line per port: the getters check replay_type, claim_port() checks
+ * validated_type and takes the mutex, and the call then uses device_info. The
+ * device specific data, which only some calls need, is kept apart behind pad
+ * so it doesn't spread the entries out.
+ */
+typedef struct __attribute__((aligned(32))) {
 	V5_DeviceT device_info;
-	uint8_t pad[128];  // 16 bytes in adi_data_s_t times 8 ADI Ports = 128
+	hybrid_mutex_t mutex;  // The port's mutex, see port_mutex_take()
+	v5_device_e_t device_type;
+	/*
+	 * The device type the port was last validated as by the system daemon, or
+	 * E_DEVICE_NONE if the port's binding hasn't been validated since its
+	 * plugged type or binding last changed.
+	 *
+	 * claim_port() uses this to skip registry_validate_binding() when the
+	 * binding is already known to be good. Only the system daemon marks ports
+	 * as validated, see registry_mark_validated().
+	 */
+	volatile v5_device_e_t validated_type;
+	/*
+	 * The type of device the port is being replayed as by vdml_replay_start(),
+	 * or E_DEVICE_NONE if the port is read from its device.
+	 *
+	 * The device getters check this before claiming a port and give the values
+	 * from vdml_replay_motor(), vdml_replay_imu() or vdml_replay_adi() instead,
+	 * see vdml_replaying(). Only the system daemon sets a port's replayed type.
+	 */
+	volatile v5_device_e_t replay_type;
+	// REGISTRY_PAD_SIZE bytes of the device's own data, e.g. the motor's PIDs
+	uint8_t* pad;
 } v5_smart_device_s_t;
 
+/*
+ * The registry, indexed by port number from 0. Ports past NUM_V5_PORTS are
+ * the brain's internal devices and only have a mutex.
+ */
+extern v5_smart_device_s_t registry_devices[V5_MAX_DEVICE_PORTS];
+
+/*
+ * Marks a port's current binding as validated.
+ *
+ * This is called by the system daemon once registry_validate_binding() has
+ * succeeded for a port.
+ *
+ * \param port
+ *        The V5 port number from 0-20
+ */
+void registry_mark_validated(uint8_t port);
+
 /*
  * Detects the devices that are plugged in.
  *
  * Pulls the type names of plugged-in devices and stores them in the buffer
  * registry_types.
+ *
+ * \return A bitmap of the ports (0-20) whose plugged type changed or whose
+ * binding was changed with registry_bind_port() or registry_unbind_port()
+ * since the last call
+ */
+uint32_t registry_update_types();
+
+/*
+ * Invokes the callback set with registry_on_change() for every port whose
+ * plugged type changed since the last call.
+ *
+ * This is called by the system daemon after it releases the ports, so the
+ * callback may use device functions.
+ */
+void registry_dispatch_changes();
+
+/*
+ * Sends the settings from the program's PROS_ROBOT_CONFIG() to the configured
+ * motors plugged into the given ports.
+ *
+ * This is called by the system daemon once VEXos is up, before initialize()
+ * starts, and for the ports whose plugged type changed after it releases the
+ * ports, since device functions are called.
+ *
+ * \param ports
+ *        A bitmap of the ports (0-20) to configure
  */
-void registry_update_types();
+void registry_config_apply(uint32_t ports);
 
 /*
  * Returns the information on the device registered to the port.
@@ -15,6 +15,8 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include "system/optimizers.h"
 #include "vdml/registry.h"
 
 /**
@@ -30,6 +32,8 @@
  * and mutex taking for all of the motor wrapper functions.
  * If port is out of range, the calling function sets errno and returns.
  * If a port isn't yet registered, it registered as a motor automatically.
+ * If the system daemon has already validated the port's binding as the
+ * expected type, the registry checks are skipped.
  * If a mutex cannot be taken, errno is set to EACCES (access denied) and
  * returns.
  *
@@ -40,18 +44,19 @@
  * \param error_code
  *        The error code that return if error checking failed
  */
-#define claim_port(port, device_type, error_code)          \
-  if (!VALIDATE_PORT_NO(port)) {                           \
-    errno = ENXIO;                                         \
-    return error_code;                                     \
-  }                                                        \
-  if (registry_validate_binding(port, device_type) != 0) { \
-    return error_code;                                     \
-  }                                                        \
-  v5_smart_device_s_t* device = registry_get_device(port); \
-  if (!port_mutex_take(port)) {                            \
-    errno = EACCES;                                        \
-    return error_code;                                     \
+#define claim_port(port, device_type, error_code)             \
+  if (!VALIDATE_PORT_NO(port)) {                              \
+    errno = ENXIO;                                            \
+    return error_code;                                        \
+  }                                                           \
+  if (registry_devices[port].validated_type != device_type && \
+      registry_validate_binding(port, device_type) != 0) {    \
+    return error_code;                                        \
+  }                                                           \
+  v5_smart_device_s_t* device = &registry_devices[port];      \
+  if (!port_mutex_take(port)) {                               \
+    errno = EACCES;                                           \
+    return error_code;                                        \
   }
 
 /**
@@ -190,12 +195,18 @@ int port_mutex_take(uint8_t port);
 int port_mutex_give(uint8_t port);
 
 /**
- * Executes port_mutex_take() for all of the V5 Smart Ports.
+ * Gives the calling task exclusive access to all of the V5 Smart Ports.
+ *
+ * This does not take every port mutex. Instead, new device calls are blocked
+ * and the function waits for every task currently holding a port mutex to
+ * return it. Tasks it waits on run just below the daemon's priority until
+ * then, so the wait only lasts as long as their device calls. This is intended
+ * for the system daemon and must not be called while holding a port mutex.
  */
 void port_mutex_take_all();
 
 /**
- * Executes port_mutex_give() for all of the V5 Smart Ports.
+ * Releases the exclusive access obtained by port_mutex_take_all().
  */
 void port_mutex_give_all();
 
@@ -235,6 +246,212 @@ int internal_port_mutex_take(uint8_t port);
  */
 int internal_port_mutex_give(uint8_t port);
 
+/**
+ * Generation counter for the telemetry snapshots published by the system
+ * daemon. It is incremented after every capture.
+ */
+extern volatile uint32_t vdml_snapshot_gen;
+
+/**
+ * Captures telemetry snapshots for all registered devices which support them.
+ *
+ * This is called by the system daemon immediately after VEXos updates its
+ * device data, while the scheduler is suspended, so no task can observe a
+ * partially written snapshot. It also notes which ports' device timestamps
+ * have changed for vdml_dispatch_updates().
+ */
+void vdml_snapshot_capture(void);
+
+/**
+ * Wakes the tasks in vdml_wait_for_update() which are waiting on a port whose
+ * device timestamp changed in the last vdml_snapshot_capture().
+ *
+ * This is called by the system daemon after it releases the ports.
+ */
+void vdml_dispatch_updates(void);
+
+/**
+ * Copies a snapshot published by vdml_snapshot_capture() into dest without
+ * taking any port mutex. If the copying task was preempted by a capture, the
+ * copy is retried.
+ *
+ * \param dest
+ *        Pointer to the destination object
+ * \param src
+ *        Pointer to the published snapshot
+ */
+#define vdml_snapshot_read(dest, src)         \
+  do {                                        \
+    uint32_t _gen;                            \
+    do {                                      \
+      _gen = vdml_snapshot_gen;               \
+      compiler_barrier();                     \
+      memcpy((dest), (src), sizeof(*(dest))); \
+      compiler_barrier();                     \
+    } while (_gen != vdml_snapshot_gen);      \
+  } while (0)
+
+/**
+ * Macro, returns true if the port is being replayed as the given type of
+ * device by vdml_replay_start(), in which case its getters must give the
+ * recorded values instead of claiming the port.
+ *
+ * \param port
+ *        The V5 port number from 0-21
+ * \param device_type
+ *        The v5_device_e_t that the getter reads
+ */
+#define vdml_replaying(port, device_type) \
+  unlikely(VALIDATE_PORT_NO(port) && registry_devices[port].replay_type == (device_type))
+
+/**
+ * The recorded readings of a port being replayed as a motor or Inertial
+ * Sensor.
+ *
+ * These may only be called once vdml_replaying() has returned true for the
+ * port and type. Since the daemon applies frames with the scheduler
+ * suspended, copy whole structures with vdml_snapshot_read().
+ *
+ * \param port
+ *        The V5 port number from 0-20
+ */
+const motor_snapshot_s_t* vdml_replay_motor(uint8_t port);
+const imu_state_s_t* vdml_replay_imu(uint8_t port);
+
+/**
+ * The recorded raw value of one of the built-in ADI's ports, once
+ * vdml_replaying() has returned true for it.
+ *
+ * \param adi_port
+ *        The ADI port number from 0-7
+ */
+int32_t vdml_replay_adi(uint8_t adi_port);
+
+/**
+ * Applies the frames of the recording being replayed which are due this daemon
+ * cycle.
+ *
+ * This is called by vdml_snapshot_capture() before any snapshots are taken.
+ *
+ * \return A bitmask of the ports which were given new readings
+ */
+uint32_t vdml_replay_capture(void);
+
+/**
+ * Queues a frame of the readings of the recorded ports which have new data.
+ *
+ * This is called at the end of vdml_snapshot_capture().
+ *
+ * \param updated
+ *        A bitmask of the ports which have new data this cycle
+ */
+void vdml_record_capture(uint32_t updated);
+
+/**
+ * The micros() time each port's current device data was first seen, see
+ * vdml_get_last_update(). Written by vdml_snapshot_capture() before the
+ * snapshots are taken.
+ */
+extern uint32_t vdml_update_times[NUM_V5_PORTS];
+
+/**
+ * A bitmask of the ports tagged by latency_probe_tag() which haven't reached
+ * their motor yet. Checked before calling the other latency probe hooks, so
+ * untagged commands don't pay for them.
+ */
+extern volatile uint32_t latency_probe_ports;
+
+/**
+ * Numbers a change in the controllers' inputs, if the latency probe is running.
+ *
+ * This is called by controller_snapshot_capture().
+ */
+void latency_probe_input_capture(void);
+
+/**
+ * Notes the time a tagged port is commanded.
+ *
+ * \param port
+ *        The V5 port number from 0-20
+ */
+void latency_probe_command(uint8_t port);
+
+/**
+ * Notes that a tagged port's command is in VEXos's device data, to be sent by
+ * the next vexBackgroundProcessing().
+ *
+ * \param port
+ *        The V5 port number from 0-20
+ */
+void latency_probe_written(uint8_t port);
+
+/**
+ * Records the latencies of the tagged commands which vexBackgroundProcessing()
+ * has just sent.
+ *
+ * This is called by vdml_snapshot_capture() before anything else.
+ */
+void latency_probe_capture(void);
+
+/**
+ * Reads from a generic serial port's receive buffer, which the system daemon
+ * fills every cycle. Unlike serial_read(), this can wait for data without
+ * holding the port's mutex.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port or length is invalid
+ * ENODEV - The port hasn't been enabled with serial_enable()
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param buffer
+ *        The buffer to read into
+ * \param length
+ *        The maximum number of bytes to read
+ * \param timeout
+ *        How long to wait for the first byte, in milliseconds
+ *
+ * \return The number of bytes read, or PROS_ERR upon failure
+ */
+int32_t serial_rx_read(uint8_t port, uint8_t* buffer, int32_t length, uint32_t timeout);
+
+/**
+ * Queues data on a generic serial port's transmit queue, which the system
+ * daemon hands to VEXos every cycle. Unlike serial_write(), this can wait for
+ * room in the queue without holding the port's mutex.
+ *
+ * This function uses the following values of errno when an error state is
+ * reached:
+ * EINVAL - The port or length is invalid
+ * ENODEV - The port hasn't been enabled with serial_enable()
+ * EACCES - Another task is writing to the port
+ *
+ * \param port
+ *        The V5 port number from 1-21
+ * \param buffer
+ *        The data to write
+ * \param length
+ *        The number of bytes to write
+ * \param timeout
+ *        How long to wait for room in the queue, in milliseconds
+ *
+ * \return The number of bytes queued, or PROS_ERR upon failure
+ */
+int32_t serial_tx_write(uint8_t port, const uint8_t* buffer, int32_t length, uint32_t timeout);
+
+/**
+ * Gets the number of bytes waiting in a generic serial port's receive buffer,
+ * without claiming the port. Returns 0 for ports which aren't enabled
+ */
+size_t serial_rx_get_used(uint8_t port);
+
+/**
+ * Gets the room left in a generic serial port's transmit queue, without
+ * claiming the port. Returns 0 for ports which aren't enabled
+ */
+size_t serial_tx_get_unused(uint8_t port);
+
 #define V5_PORT_BATTERY 24
 #define V5_PORT_CONTROLLER_1 25
 #define V5_PORT_CONTROLLER_2 26
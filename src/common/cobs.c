@@ -18,6 +18,39 @@
 
 #include "cobs.h"
 
+// Zero bytes are found a word at a time: a word has a 0 byte exactly when
+// subtracting 1 from each byte borrows into a byte whose top bit was clear.
+// NEON could scan wider, but kernel code runs in tasks which otherwise never
+// touch the FPU, and saving its registers on context switches would cost more
+// than it saves here
+typedef uint32_t __attribute__((may_alias)) word_t;
+#define WORD_HAS_ZERO(w) (((w)-0x01010101u) & ~(w)&0x80808080u)
+
+// Returns the number of nonzero bytes at the start of src, looking at no more
+// than len bytes
+static inline size_t cobs_nonzero_run(const uint8_t* src, const size_t len) {
+	size_t i = 0;
+	while (i < len && ((uintptr_t)(src + i) & (sizeof(word_t) - 1))) {
+		if (src[i] == 0) return i;
+		i++;
+	}
+	while (i + 2 * sizeof(word_t) <= len) {
+		word_t const a = *(const word_t*)(src + i);
+		word_t const b = *(const word_t*)(src + i + sizeof(word_t));
+		if (WORD_HAS_ZERO(a) | WORD_HAS_ZERO(b)) break;
+		i += 2 * sizeof(word_t);
+	}
+	while (i < len && src[i] != 0) i++;
+	return i;
+}
+
+// The number of bytes which can still join a block with the given code before
+// it is full, limited to len
+static inline size_t cobs_block_room(const uint8_t code, const size_t len) {
+	size_t const room = 0xff - code;
+	return len < room ? len : room;
+}
+
 size_t cobs_encode_measure(const uint8_t* restrict src, const size_t src_len, const uint32_t prefix) {
 	size_t read_idx = 0;
 	size_t write_idx = 1;
@@ -37,18 +70,18 @@ size_t cobs_encode_measure(const uint8_t* restrict src, const size_t src_len, co
 	read_idx = 0;
 
 	while (read_idx < src_len) {
-		if (src[read_idx] == 0) {
+		size_t run = cobs_nonzero_run(src + read_idx, cobs_block_room(code, src_len - read_idx));
+		write_idx += run;
+		read_idx += run;
+		code += run;
+		if (code == 0xff) {
 			code = 1;
 			write_idx++;
-			read_idx++;
-		} else {
+		} else if (read_idx < src_len) {
+			// the run ended at a 0
+			code = 1;
 			write_idx++;
 			read_idx++;
-			code++;
-			if (code == 0xff) {
-				code = 1;
-				write_idx++;
-			}
 		}
 	}
 
@@ -77,19 +110,21 @@ int cobs_encode(uint8_t* restrict dest, const uint8_t* restrict src, const size_
 	read_idx = 0;
 
 	while (read_idx < src_len) {
-		if (src[read_idx] == 0) {
+		size_t run = cobs_nonzero_run(src + read_idx, cobs_block_room(code, src_len - read_idx));
+		memcpy(dest + write_idx, src + read_idx, run);
+		write_idx += run;
+		read_idx += run;
+		code += run;
+		if (code == 0xff) {
+			dest[code_idx] = code;
+			code = 1;
+			code_idx = write_idx++;
+		} else if (read_idx < src_len) {
+			// the run ended at a 0
 			dest[code_idx] = code;
 			code = 1;
 			code_idx = write_idx++;
 			read_idx++;
-		} else {
-			dest[write_idx++] = src[read_idx++];
-			code++;
-			if (code == 0xff) {
-				dest[code_idx] = code;
-				code = 1;
-				code_idx = write_idx++;
-			}
 		}
 	}
 
@@ -97,3 +132,144 @@ int cobs_encode(uint8_t* restrict dest, const uint8_t* restrict src, const size_
 
 	return write_idx;
 }
+
+static void cobs_stream_flush(cobs_stream_s_t* stream, size_t len) {
+	if (len == 0) return;
+	// Once a flush failed the rest of the frame is dropped, but the buffer still
+	// has to make room for it
+	if (!stream->failed && stream->flush(stream->buf, len, stream->flush_arg) != len) {
+		stream->failed = true;
+	}
+	// Keep the pending block (at most 255 bytes) at the front of the buffer
+	memmove(stream->buf, stream->buf + len, stream->write_idx - len);
+	stream->write_idx -= len;
+	stream->code_idx -= len;
+}
+
+static inline void cobs_stream_put(cobs_stream_s_t* stream, const uint8_t byte) {
+	if (stream->write_idx >= stream->size) {
+		cobs_stream_flush(stream, stream->code_idx);
+	}
+	if (byte == 0) {
+		stream->buf[stream->code_idx] = stream->code;
+		stream->code = 1;
+		stream->code_idx = stream->write_idx++;
+	} else {
+		stream->buf[stream->write_idx++] = byte;
+		stream->code++;
+		if (stream->code == 0xff) {
+			stream->buf[stream->code_idx] = stream->code;
+			stream->code = 1;
+			if (stream->write_idx >= stream->size) {
+				cobs_stream_flush(stream, stream->write_idx);
+			}
+			stream->code_idx = stream->write_idx++;
+		}
+	}
+}
+
+void cobs_stream_begin(cobs_stream_s_t* stream, uint8_t* buf, size_t size, cobs_flush_fn_t flush, void* flush_arg) {
+	stream->buf = buf;
+	stream->size = size;
+	stream->write_idx = 1;
+	stream->code_idx = 0;
+	stream->code = 1;
+	stream->failed = false;
+	stream->flush = flush;
+	stream->flush_arg = flush_arg;
+}
+
+void cobs_stream_init(cobs_stream_s_t* stream, uint8_t* buf, size_t size, cobs_flush_fn_t flush, void* flush_arg,
+                      const uint32_t prefix) {
+	cobs_stream_begin(stream, buf, size, flush, flush_arg);
+	cobs_stream_write(stream, (const uint8_t*)&prefix, sizeof(prefix));
+}
+
+void cobs_stream_write(cobs_stream_s_t* stream, const uint8_t* restrict src, const size_t src_len) {
+	size_t i = 0;
+	while (i < src_len) {
+		if (stream->write_idx >= stream->size) {
+			cobs_stream_flush(stream, stream->code_idx);
+		}
+		// Copy the nonzero bytes which fit in the buffer and leave the block short
+		// of full at once. The byte after them goes through cobs_stream_put, which
+		// handles zeros, full blocks and full buffers
+		size_t room = cobs_block_room(stream->code + 1, src_len - i);
+		if (room > stream->size - stream->write_idx) room = stream->size - stream->write_idx;
+		size_t run = cobs_nonzero_run(src + i, room);
+		memcpy(stream->buf + stream->write_idx, src + i, run);
+		stream->write_idx += run;
+		stream->code += run;
+		i += run;
+		if (i < src_len) {
+			cobs_stream_put(stream, src[i++]);
+		}
+	}
+}
+
+bool cobs_stream_finish(cobs_stream_s_t* stream) {
+	stream->buf[stream->code_idx] = stream->code;
+	if (stream->write_idx >= stream->size) {
+		cobs_stream_flush(stream, stream->write_idx);
+	}
+	stream->buf[stream->write_idx++] = 0;
+	stream->code_idx = stream->write_idx;
+	cobs_stream_flush(stream, stream->write_idx);
+	return !stream->failed;
+}
+
+void cobs_decoder_init(cobs_decoder_s_t* decoder, uint8_t* buf, size_t size) {
+	decoder->buf = buf;
+	decoder->size = size;
+	decoder->len = 0;
+	decoder->remaining = 0;
+	decoder->pending_zero = false;
+	decoder->invalid = false;
+}
+
+size_t cobs_decode_run(cobs_decoder_s_t* decoder, const uint8_t* src, const size_t len) {
+	if (decoder->invalid) {
+		// everything up to the next delimiter is dropped
+		return cobs_nonzero_run(src, len);
+	}
+	size_t room = len < decoder->remaining ? len : decoder->remaining;
+	if (room > decoder->size - decoder->len) room = decoder->size - decoder->len;
+	size_t run = cobs_nonzero_run(src, room);
+	memcpy(decoder->buf + decoder->len, src, run);
+	decoder->len += run;
+	decoder->remaining -= run;
+	return run;
+}
+
+int32_t cobs_decode_byte(cobs_decoder_s_t* decoder, const uint8_t byte) {
+	if (byte == 0) {
+		// the implicit 0 at the end of the last block isn't part of the frame
+		int32_t len = decoder->remaining || decoder->invalid || !decoder->len ? -1 : (int32_t)decoder->len;
+		decoder->len = 0;
+		decoder->remaining = 0;
+		decoder->pending_zero = false;
+		decoder->invalid = false;
+		return len;
+	}
+	if (decoder->invalid) return -1;
+	if (decoder->remaining == 0) {
+		// byte is the code of a new block
+		if (decoder->pending_zero) {
+			if (decoder->len >= decoder->size) {
+				decoder->invalid = true;
+				return -1;
+			}
+			decoder->buf[decoder->len++] = 0;
+		}
+		decoder->remaining = byte - 1;
+		decoder->pending_zero = byte != 0xff;
+		return -1;
+	}
+	if (decoder->len >= decoder->size) {
+		decoder->invalid = true;
+		return -1;
+	}
+	decoder->buf[decoder->len++] = byte;
+	decoder->remaining--;
+	return -1;
+}
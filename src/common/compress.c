@@ -0,0 +1,109 @@
+/**
+ * \file common/compress.c
+ *
+ * Record compression
+ *
+ * Two cheap encoders for telemetry records. delta_encode() suits a record sent
+ * over and over with slowly changing fields: each word becomes the zig-zag
+ * varint of how much it changed, so an unchanged word takes one byte. Floats
+ * are differenced as their bit patterns, which is exact and still small while
+ * their sign and exponent hold. lz4_compress() is a greedy LZ4 block encoder
+ * (one hash probe per position, no lazy matching) for bulk data, whose output
+ * any LZ4 block decoder reads.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "common/compress.h"
+
+// The block format's limits: the last match starts at least 12 bytes before
+// the end, and the last 5 bytes are always literals
+#define LZ4_MIN_MATCH 4
+#define LZ4_MF_LIMIT 12
+#define LZ4_LAST_LITERALS 5
+
+static uint32_t word_get(const uint8_t* data, size_t len, size_t i) {
+	uint32_t word = 0;
+	memcpy(&word, data + i, len - i < 4 ? len - i : 4);
+	return word;
+}
+
+size_t delta_encode(uint8_t* dest, size_t cap, const uint8_t* cur, const uint8_t* prev, size_t len) {
+	size_t out = 0;
+	for (size_t i = 0; i < len; i += 4) {
+		int32_t const diff = (int32_t)(word_get(cur, len, i) - word_get(prev, len, i));
+		uint32_t zigzag = ((uint32_t)diff << 1) ^ (uint32_t)(diff >> 31);
+		do {
+			if (out == cap) return 0;
+			dest[out++] = (zigzag & 0x7f) | (zigzag > 0x7f ? 0x80 : 0);
+			zigzag >>= 7;
+		} while (zigzag);
+	}
+	return out;
+}
+
+// Writes an LZ4 length which is more than its token's nibble holds
+static bool lz4_put_length(uint8_t* dest, size_t cap, size_t* out, size_t len) {
+	for (; len >= 255; len -= 255) {
+		if (*out == cap) return false;
+		dest[(*out)++] = 255;
+	}
+	if (*out == cap) return false;
+	dest[(*out)++] = len;
+	return true;
+}
+
+// Writes a sequence of literals followed by a match, or just literals if
+// match_len is 0
+static bool lz4_put_sequence(uint8_t* dest, size_t cap, size_t* out, const uint8_t* literals, size_t literal_len,
+                             uint16_t offset, size_t match_len) {
+	if (*out == cap) return false;
+	size_t const match_code = match_len ? match_len - LZ4_MIN_MATCH : 0;
+	dest[(*out)++] = (literal_len < 15 ? literal_len : 15) << 4 | (match_code < 15 ? match_code : 15);
+	if (literal_len >= 15 && !lz4_put_length(dest, cap, out, literal_len - 15)) return false;
+	if (cap - *out < literal_len) return false;
+	memcpy(dest + *out, literals, literal_len);
+	*out += literal_len;
+	if (!match_len) return true;
+	if (cap - *out < 2) return false;
+	dest[(*out)++] = offset & 0xff;
+	dest[(*out)++] = offset >> 8;
+	return match_code < 15 || lz4_put_length(dest, cap, out, match_code - 15);
+}
+
+size_t lz4_compress(uint8_t* dest, size_t cap, const uint8_t* src, size_t len, uint16_t* table) {
+	if (len > LZ4_MAX_INPUT) return 0;
+	size_t out = 0, anchor = 0;
+	if (len > LZ4_MF_LIMIT) {
+		// positions are stored off by one, so 0 is an empty entry
+		memset(table, 0, sizeof(*table) << LZ4_HASH_BITS);
+		size_t i = 0;
+		while (i < len - LZ4_MF_LIMIT) {
+			uint32_t seq;
+			memcpy(&seq, src + i, sizeof(seq));
+			uint32_t const hash = (seq * 2654435761u) >> (32 - LZ4_HASH_BITS);
+			size_t const candidate = table[hash];
+			table[hash] = i + 1;
+			if (candidate == 0 || memcmp(src + candidate - 1, &seq, sizeof(seq))) {
+				i++;
+				continue;
+			}
+			size_t const from = candidate - 1;
+			size_t match_len = LZ4_MIN_MATCH;
+			while (i + match_len < len - LZ4_LAST_LITERALS && src[from + match_len] == src[i + match_len]) match_len++;
+			if (!lz4_put_sequence(dest, cap, &out, src + anchor, i - anchor, i - from, match_len)) return 0;
+			i += match_len;
+			anchor = i;
+		}
+	}
+	if (!lz4_put_sequence(dest, cap, &out, src + anchor, len - anchor, 0, 0)) return 0;
+	return out;
+}
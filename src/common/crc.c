@@ -0,0 +1,43 @@
+/**
+ * \file common/crc.c
+ *
+ * Cyclic redundancy checks
+ *
+ * CRC-16 is bitwise, which is small and fast enough for the short frames the
+ * kernel checks. CRC-32 also checks the hot image at startup, so it steps a
+ * nibble at a time through a 16 entry table.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "common/crc.h"
+
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t* data, size_t len) {
+	for (size_t i = 0; i < len; i++) {
+		crc ^= (uint16_t)data[i] << 8;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+static const uint32_t crc32_nibbles[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len) {
+	crc = ~crc;
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		crc = (crc >> 4) ^ crc32_nibbles[crc & 0xf];
+		crc = (crc >> 4) ^ crc32_nibbles[crc & 0xf];
+	}
+	return ~crc;
+}
@@ -21,75 +21,98 @@
 #include "kapi.h"
 
 // Note: the V5 is a 32-bit architecture, so we'll use 32-bit integers
+//
+// The bitmap is only ever changed with exclusive loads and stores of whole
+// words, so allocating and freeing need no lock and can't lose each other's
+// updates
+
+static inline uint32_t load_exclusive(uint32_t* addr) {
+	uint32_t value;
+	__asm volatile("ldrex %0, [%1]" : "=r"(value) : "r"(addr) : "memory");
+	return value;
+}
+
+// Returns 0 if the store succeeded
+static inline uint32_t store_exclusive(uint32_t* addr, uint32_t value) {
+	uint32_t failed;
+	__asm volatile("strex %0, %2, [%1]" : "=&r"(failed) : "r"(addr), "r"(value) : "memory");
+	return failed;
+}
 
 void gid_init(struct gid_metadata* const metadata) {
 	// metadata arguments aren't checked for correctness since this is an
 	// internal data structure
 	size_t i;
 	for (i = 0; i < metadata->bitmap_size; i++) {
-		metadata->bitmap[i] = ~0;
+		size_t const first = i * UINT32_WIDTH;
+		uint32_t word = ~0;
+		if (metadata->reserved > first) {
+			word = metadata->reserved - first >= UINT32_WIDTH ? 0 : word << (metadata->reserved - first);
+		}
+		// gids past the end of the last word don't exist
+		if (metadata->max - first < UINT32_WIDTH) {
+			word &= ~(~0u << (metadata->max - first));
+		}
+		metadata->bitmap[i] = word;
 	}
+	metadata->_cur_val = 0;
+}
 
-	metadata->bitmap[0] = (~0 << (metadata->reserved));
-
-	metadata->_lock = mutex_create();
-	return;
+// Claims the lowest free gid in a word of the bitmap whose bit is set in mask,
+// returning 0 if there isn't one
+static uint32_t claim_in_word(struct gid_metadata* const metadata, size_t word_idx, uint32_t mask) {
+	uint32_t* const word = metadata->bitmap + word_idx;
+	uint32_t free_bits;
+	uint32_t bit;
+	do {
+		free_bits = load_exclusive(word);
+		if ((free_bits & mask) == 0) {
+			__asm volatile("clrex" ::: "memory");
+			return 0;
+		}
+		// __builtin_ctz counts trailing zeros. This effectively returns the
+		// position of the first unassigned gid within the word
+		bit = __builtin_ctz(free_bits & mask);
+	} while (store_exclusive(word, free_bits & ~(1u << bit)));
+	return word_idx * UINT32_WIDTH + bit;
 }
 
 uint32_t gid_alloc(struct gid_metadata* const metadata) {
-	if (mutex_take(metadata->_lock, TIMEOUT_MAX)) {
-		size_t i;
-		uint32_t gid = 0;
-		uint32_t* gid_word = NULL;
-		uint32_t gid_idx = 0;
-		// check if the _cur_val + 1 is free
-		if (!gid_check(metadata, (metadata->_cur_val + 1) % metadata->max)) {
-			// that gid was free! so allocate it
-			gid = metadata->_cur_val = (metadata->_cur_val + 1) % metadata->max;
-			gid_word = metadata->bitmap + (gid / UINT32_WIDTH);
-			gid_idx = gid % UINT32_WIDTH;
-			goto return_gid;
-		} else {
-			for (i = 0; i < metadata->bitmap_size; i++) {
-				gid_word = metadata->bitmap + i;
-				if (*gid_word == 0) {  // all GIDs in this word are assigned
-					continue;
-				}
-				// __builtin_ctz counts trailing zeros. This effectively returns the
-				// position of the first unassigned gid withing the word
-				gid_idx = __builtin_ctz(*gid_word);
-				gid = gid_idx + (i * UINT32_WIDTH);
-				// mark the id as allocated
-				goto return_gid;
-			}
-		}
-	return_gid:
-		if (gid > metadata->max || gid == 0) {
-			mutex_give(metadata->_lock);
-			return 0;
+	// start looking right after the last gid handed out, so that gids are reused
+	// as late as possible
+	size_t start = metadata->_cur_val + 1;
+	if (start >= metadata->max) start = 0;
+	size_t const start_word = start / UINT32_WIDTH;
+	uint32_t const start_mask = ~0u << (start % UINT32_WIDTH);
+
+	// the start word is visited twice, first above the start and then, once
+	// every other word is full, below it
+	for (size_t i = 0; i <= metadata->bitmap_size; i++) {
+		size_t const word_idx = (start_word + i) % metadata->bitmap_size;
+		uint32_t const mask = i == 0 ? start_mask : i == metadata->bitmap_size ? ~start_mask : ~0u;
+		uint32_t const gid = claim_in_word(metadata, word_idx, mask);
+		if (gid != 0) {
+			metadata->_cur_val = gid;
+			return gid;
 		}
-		*gid_word &= ~(1 << gid_idx);
-		metadata->_cur_val = gid;
-		mutex_give(metadata->_lock);
-		return gid;
 	}
 	return 0;
 }
 
 void gid_free(struct gid_metadata* const metadata, uint32_t id) {
-	if (id > metadata->max || id == 0) {
+	if (id >= metadata->max || id == 0) {
 		return;
 	}
 
-	size_t word_idx = id / UINT32_WIDTH;
-	metadata->bitmap[word_idx] |= 1 << (id % UINT32_WIDTH);
+	__atomic_fetch_or(metadata->bitmap + id / UINT32_WIDTH, 1u << (id % UINT32_WIDTH), __ATOMIC_RELEASE);
 }
 
 bool gid_check(struct gid_metadata* metadata, uint32_t id) {
-	if (id > metadata->max) {
+	if (id >= metadata->max) {
 		return false;
 	}
 
 	size_t word_idx = id / UINT32_WIDTH;
-	return (metadata->bitmap[word_idx] & (1 << (id % UINT32_WIDTH))) ? false : true;
+	uint32_t const word = __atomic_load_n(metadata->bitmap + word_idx, __ATOMIC_ACQUIRE);
+	return (word & (1u << (id % UINT32_WIDTH))) ? false : true;
 }
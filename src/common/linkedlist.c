@@ -4,7 +4,9 @@
  * Linked list implementation for internal use
  *
  * This file defines a linked list implementation that operates on the FreeRTOS
- * heap, and is able to generically store function pointers and data
+ * heap, and is able to generically store function pointers and data. A list
+ * can instead take its nodes from a pool, and an intrusive variant links nodes
+ * embedded in the payloads themselves so nothing is allocated at all.
  *
  * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
  *
@@ -34,17 +36,37 @@ ll_node_s_t* linked_list_init_data_node(void* data) {
 	return node;
 }
 
+static ll_node_s_t* node_alloc(linked_list_s_t* list) {
+	ll_node_s_t* node = list->pool ? pool_alloc(list->pool) : kmalloc(sizeof *node);
+	if (node != NULL) node->next = NULL;
+	return node;
+}
+
+static void node_free(linked_list_s_t* list, ll_node_s_t* node) {
+	if (list->pool)
+		pool_free(list->pool, node);
+	else
+		kfree(node);
+}
+
 linked_list_s_t* linked_list_init() {
 	linked_list_s_t* list = (linked_list_s_t*)kmalloc(sizeof *list);
-	list->head = NULL;
+	linked_list_init_static(list, NULL);
 
 	return list;
 }
 
+void linked_list_init_static(linked_list_s_t* list, pool_t pool) {
+	list->head = NULL;
+	list->pool = pool;
+}
+
 void linked_list_prepend_func(linked_list_s_t* list, generic_fn_t func) {
 	if (list == NULL) list = linked_list_init();
 
-	ll_node_s_t* n = linked_list_init_func_node(func);
+	ll_node_s_t* n = node_alloc(list);
+	if (n == NULL) return;
+	n->payload.func = func;
 
 	n->next = list->head;
 	list->head = n;
@@ -53,7 +75,9 @@ void linked_list_prepend_func(linked_list_s_t* list, generic_fn_t func) {
 void linked_list_prepend_data(linked_list_s_t* list, void* data) {
 	if (list == NULL) list = linked_list_init();
 
-	ll_node_s_t* n = linked_list_init_data_node(data);
+	ll_node_s_t* n = node_alloc(list);
+	if (n == NULL) return;
+	n->payload.data = data;
 
 	n->next = list->head;
 	list->head = n;
@@ -62,7 +86,9 @@ void linked_list_prepend_data(linked_list_s_t* list, void* data) {
 void linked_list_append_func(linked_list_s_t* list, generic_fn_t func) {
 	if (list == NULL) list = linked_list_init();
 
-	ll_node_s_t* n = linked_list_init_func_node(func);
+	ll_node_s_t* n = node_alloc(list);
+	if (n == NULL) return;
+	n->payload.func = func;
 
 	if (list->head == NULL) {
 		list->head = n;
@@ -88,7 +114,7 @@ void linked_list_remove_func(linked_list_s_t* list, generic_fn_t func) {
 				list->head = it->next;
 			else
 				p->next = it->next;
-			kfree(it);
+			node_free(list, it);
 			break;
 		}
 
@@ -100,7 +126,9 @@ void linked_list_remove_func(linked_list_s_t* list, generic_fn_t func) {
 void linked_list_append_data(linked_list_s_t* list, void* data) {
 	if (list == NULL) list = linked_list_init();
 
-	ll_node_s_t* n = linked_list_init_data_node(data);
+	ll_node_s_t* n = node_alloc(list);
+	if (n == NULL) return;
+	n->payload.data = data;
 
 	if (list->head == NULL) {
 		list->head = n;
@@ -126,7 +154,7 @@ void linked_list_remove_data(linked_list_s_t* list, void* data) {
 				list->head = it->next;
 			else
 				p->next = it->next;
-			kfree(it);
+			node_free(list, it);
 			break;
 		}
 
@@ -145,13 +173,38 @@ void linked_list_foreach(linked_list_s_t* list, linked_list_foreach_fn_t cb, voi
 	}
 }
 
-void linked_list_free(linked_list_s_t* list) {
-	if (list == NULL || list->head == NULL) return;
+void linked_list_clear(linked_list_s_t* list) {
+	if (list == NULL) return;
 
 	while (list->head != NULL) {
 		ll_node_s_t* node = list->head;
 		list->head = node->next;
-		kfree(node);
+		node_free(list, node);
 	}
+}
+
+void linked_list_free(linked_list_s_t* list) {
+	if (list == NULL) return;
+
+	linked_list_clear(list);
 	kfree(list);
 }
+
+void intrusive_list_append(intrusive_list_s_t* list, ll_link_s_t* link) {
+	ll_link_s_t** it = &list->head;
+	while (*it != NULL) it = &(*it)->next;
+
+	link->next = NULL;
+	*it = link;
+}
+
+bool intrusive_list_remove(intrusive_list_s_t* list, ll_link_s_t* link) {
+	for (ll_link_s_t** it = &list->head; *it != NULL; it = &(*it)->next) {
+		if (*it == link) {
+			*it = link->next;
+			link->next = NULL;
+			return true;
+		}
+	}
+	return false;
+}
@@ -5,6 +5,12 @@
  * It's used to check which streams are enabled in ser_driver for the moment,
  * but also has list_contains which may be useful in other contexts.
  *
+ * The set is read far more often than it changes (every write to a serial
+ * stream checks it), so lookups take no lock. Items live in a small
+ * open-addressed hash table which is never modified in place: writers build a
+ * new table, publish it with a single pointer store and free the old one once
+ * no reader can still be probing it.
+ *
  * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
  * All rights reserved.
  *
@@ -19,74 +25,139 @@
 #include "kapi.h"
 #include "system/optimizers.h"
 
-void set_initialize(struct set* const set) {
-	set->arr = kmalloc(8 * sizeof(*(set->arr)));
-	set->used = 0;
-	set->size = 8;
-	set->mtx = mutex_create_static(&(set->mtx_buf));
+#define SET_INITIAL_CAPACITY 8
+
+static inline size_t table_slot(struct set_table const* const table, uint32_t item) {
+	item *= 2654435761u;  // Knuth's multiplicative hash
+	return (item ^ (item >> 16)) & (table->capacity - 1);
 }
 
-bool set_add(struct set* const set, uint32_t item) {
-	size_t i = 0;
-	if (!mutex_take(set->mtx, TIMEOUT_MAX)) {
-		return false;
+static bool table_contains(struct set_table const* const table, uint32_t item) {
+	if (item == 0) return table->has_zero;
+	// Tables are never more than 3/4 full, so there's always an empty slot which
+	// ends the probe
+	for (size_t i = table_slot(table, item);; i = (i + 1) & (table->capacity - 1)) {
+		if (table->items[i] == item) return true;
+		if (table->items[i] == 0) return false;
 	}
-	for (i = 0; i < set->used; i++) {
-		if (set->arr[i] == item) {
-			mutex_give(set->mtx);
-			return true;
-		}
+}
+
+static void table_insert(struct set_table* const table, uint32_t item) {
+	if (item == 0) {
+		table->has_zero = true;
+		return;
 	}
-	if (set->used == set->size) {
-		uint32_t* temp = set->arr;
-		set->arr = kmalloc((set->size + 8) * sizeof(*(set->arr)));
-		if (unlikely(set->arr == NULL)) {
-			set->arr = temp;
-			mutex_give(set->mtx);
-			return false;
-		}
-		memcpy(set->arr, temp, set->size * sizeof(*(set->arr)));
-		set->size += 8;
+	size_t i = table_slot(table, item);
+	while (table->items[i] != 0) i = (i + 1) & (table->capacity - 1);
+	table->items[i] = item;
+	table->used++;
+}
+
+static struct set_table* table_create(size_t capacity) {
+	struct set_table* table = kmalloc(sizeof(*table) + capacity * sizeof(*table->items));
+	if (unlikely(table == NULL)) return NULL;
+	table->capacity = capacity;
+	table->used = 0;
+	table->has_zero = false;
+	memset(table->items, 0, capacity * sizeof(*table->items));
+	return table;
+}
+
+// Builds a copy of the set's table with item added to or removed from it
+static struct set_table* table_copy(struct set_table const* const old, uint32_t item, bool add) {
+	size_t capacity = old->capacity;
+	if (add && (old->used + 1) * 4 > capacity * 3) capacity *= 2;
+	struct set_table* table = table_create(capacity);
+	if (unlikely(table == NULL)) return NULL;
+	table->has_zero = old->has_zero;
+	for (size_t i = 0; i < old->capacity; i++) {
+		if (old->items[i] != 0 && old->items[i] != item) table_insert(table, old->items[i]);
 	}
-	set->arr[set->used] = item;
-	set->used++;
-	mutex_give(set->mtx);
-	return true;
+	if (add) {
+		table_insert(table, item);
+	} else if (item == 0) {
+		table->has_zero = false;
+	}
+	return table;
 }
 
-bool set_rm(struct set* set, uint32_t item) {
-	size_t i = 0;
+// Publishes a new table and frees the one it replaces. Must be called with the
+// set's mutex held
+static void set_replace(struct set* const set, struct set_table* const table) {
+	struct set_table* const old = set->table;
+	__atomic_store_n(&set->table, table, __ATOMIC_SEQ_CST);
+	if (__atomic_add_fetch(&set->generation, 1, __ATOMIC_SEQ_CST) == 0) {
+		__atomic_add_fetch(&set->generation, 1, __ATOMIC_SEQ_CST);
+	}
+
+	// Readers which still hold the old table registered in the current epoch.
+	// Anyone reading from now on registers in the next one, so waiting for the
+	// current epoch to drain is enough
+	uint32_t const epoch = set->epoch;
+	__atomic_store_n(&set->epoch, epoch ^ 1, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&set->readers[epoch], __ATOMIC_SEQ_CST) != 0) {
+		task_delay(1);
+	}
+	kfree(old);
+}
+
+void set_initialize(struct set* const set) {
+	set->table = table_create(SET_INITIAL_CAPACITY);
+	set->generation = 1;
+	set->epoch = 0;
+	set->readers[0] = set->readers[1] = 0;
+	set->mtx = mutex_create_static(&(set->mtx_buf));
+}
+
+static bool set_modify(struct set* const set, uint32_t item, bool add) {
 	if (!mutex_take(set->mtx, TIMEOUT_MAX)) {
 		return false;
 	}
-	for (i = 0; i < set->used - 1; i++) {
-		if (set->arr[i] == item) {
-			memcpy(set->arr + i, set->arr + i + 1, set->used - i - 1);
-			set->used--;
-			mutex_give(set->mtx);
-			return true;
-		}
+	// set_add and set_rm succeed if the item is already (not) present
+	if (table_contains(set->table, item) == add) {
+		mutex_give(set->mtx);
+		return true;
 	}
-	if (set->arr[set->used] == item) {
-		// this is the last item, no need to do memcpy, just decrement the counter
-		set->used--;
+	struct set_table* table = table_copy(set->table, item, add);
+	if (unlikely(table == NULL)) {
+		mutex_give(set->mtx);
+		return false;
 	}
+	set_replace(set, table);
 	mutex_give(set->mtx);
 	return true;
 }
 
+bool set_add(struct set* const set, uint32_t item) {
+	return set_modify(set, item, true);
+}
+
+bool set_rm(struct set* set, uint32_t item) {
+	return set_modify(set, item, false);
+}
+
 bool set_contains(struct set* set, uint32_t item) {
-	if (!mutex_take(set->mtx, TIMEOUT_MAX)) {
-		return false;
+	uint32_t epoch;
+	while (true) {
+		epoch = __atomic_load_n(&set->epoch, __ATOMIC_SEQ_CST);
+		__atomic_add_fetch(&set->readers[epoch], 1, __ATOMIC_SEQ_CST);
+		// If a writer moved to the next epoch in the meantime, it may not wait for
+		// this reader, so register again
+		if (__atomic_load_n(&set->epoch, __ATOMIC_SEQ_CST) == epoch) break;
+		__atomic_sub_fetch(&set->readers[epoch], 1, __ATOMIC_SEQ_CST);
 	}
-	bool ret = list_contains(set->arr, set->used, item);
-	mutex_give(set->mtx);
+	bool ret = table_contains(__atomic_load_n(&set->table, __ATOMIC_SEQ_CST), item);
+	__atomic_sub_fetch(&set->readers[epoch], 1, __ATOMIC_SEQ_CST);
 	return ret;
 }
 
+uint32_t set_generation(struct set* set) {
+	return __atomic_load_n(&set->generation, __ATOMIC_SEQ_CST);
+}
+
 bool list_contains(uint32_t const* list, const size_t size, const uint32_t item) {
 	uint32_t const* const end = list + size;
-	while (list <= end) {
+	while (list < end) {
 		if (*list == item) {
 			return true;
 		}
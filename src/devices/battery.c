@@ -11,10 +11,118 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <errno.h>
+
 #include "kapi.h"
 #include "v5_api.h"
 #include "vdml/vdml.h"
 
+// The daemon runs every 2 ms, so the battery is sampled every 10 ms
+#define BATTERY_SAMPLE_CYCLES 5
+#define BATTERY_SAMPLE_PERIOD 10
+#define BATTERY_DEFAULT_ALPHA 0.1
+// How far ahead in seconds the voltage trend is followed to predict a brownout
+#define BATTERY_PREDICTION_TIME 0.25
+
+extern int32_t motor_snapshot_total_current(void);
+
+// Only changed by the daemon, or with the scheduler suspended
+static battery_state_s_t state;
+static double filter_alpha = BATTERY_DEFAULT_ALPHA;
+static int32_t brownout_threshold = BATTERY_BROWNOUT_VOLTAGE;
+static uint32_t samples;
+static int32_t voltage_window[BATTERY_WINDOW_SAMPLES];
+static int32_t current_window[BATTERY_WINDOW_SAMPLES];
+static double filtered_voltage_window[BATTERY_WINDOW_SAMPLES];
+
+static inline double ema(double filtered, double sample) {
+	return filtered + filter_alpha * (sample - filtered);
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended, after the
+// motors' snapshots have been taken
+void battery_snapshot_capture(void) {
+	static uint32_t cycle = 0;
+	if (++cycle < BATTERY_SAMPLE_CYCLES) return;
+	cycle = 0;
+
+	int32_t voltage = vexBatteryVoltageGet();
+	int32_t current = vexBatteryCurrentGet();
+	double temperature = vexBatteryTemperatureGet();
+	double capacity = vexBatteryCapacityGet();
+	int32_t motor_current = motor_snapshot_total_current();
+	if (samples == 0) {
+		// Start the filters at the first readings rather than ramping up from 0
+		state.voltage = voltage;
+		state.current = current;
+		state.temperature = temperature;
+		state.capacity = capacity;
+		state.motor_current = motor_current;
+	} else {
+		state.voltage = ema(state.voltage, voltage);
+		state.current = ema(state.current, current);
+		state.temperature = ema(state.temperature, temperature);
+		state.capacity = ema(state.capacity, capacity);
+		state.motor_current = ema(state.motor_current, motor_current);
+	}
+
+	uint32_t slot = samples % BATTERY_WINDOW_SAMPLES;
+	voltage_window[slot] = voltage;
+	current_window[slot] = current;
+	filtered_voltage_window[slot] = state.voltage;
+	samples++;
+	uint32_t count = samples < BATTERY_WINDOW_SAMPLES ? samples : BATTERY_WINDOW_SAMPLES;
+	state.voltage_min = state.voltage_max = voltage;
+	state.current_min = state.current_max = current;
+	for (uint32_t i = 0; i < count; i++) {
+		if (voltage_window[i] < state.voltage_min) state.voltage_min = voltage_window[i];
+		if (voltage_window[i] > state.voltage_max) state.voltage_max = voltage_window[i];
+		if (current_window[i] < state.current_min) state.current_min = current_window[i];
+		if (current_window[i] > state.current_max) state.current_max = current_window[i];
+	}
+
+	// The trend compares the filtered voltage with the oldest one in the window
+	state.voltage_trend = 0;
+	if (count > 1) {
+		double oldest = filtered_voltage_window[(samples - count) % BATTERY_WINDOW_SAMPLES];
+		state.voltage_trend = (state.voltage - oldest) * 1000.0 / ((count - 1) * BATTERY_SAMPLE_PERIOD);
+	}
+	double predicted = state.voltage;
+	if (state.voltage_trend < 0) predicted += state.voltage_trend * BATTERY_PREDICTION_TIME;
+	state.brownout_predicted = predicted < brownout_threshold;
+	state.timestamp = millis();
+}
+
+int32_t battery_get_state(battery_state_s_t* const out) {
+	if (out == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(out, &state);
+	if (out->timestamp == 0) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t battery_set_filter(double alpha) {
+	if (!(alpha > 0 && alpha <= 1)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	filter_alpha = alpha;
+	rtos_resume_all();
+	return 1;
+}
+
+void battery_set_brownout_threshold(int32_t millivolts) {
+	rtos_suspend_all();
+	brownout_threshold = millivolts;
+	rtos_resume_all();
+}
+
 int32_t battery_get_voltage(void) {
 	if (!internal_port_mutex_take(V5_PORT_BATTERY)) {
 		errno = EACCES;
@@ -32,5 +32,17 @@ double get_temperature(void) {
 std::int32_t get_voltage(void) {
 	return battery_get_voltage();
 }
+
+std::int32_t get_state(battery_state_s_t* const state) {
+	return battery_get_state(state);
+}
+
+std::int32_t set_filter(double alpha) {
+	return battery_set_filter(alpha);
+}
+
+void set_brownout_threshold(std::int32_t millivolts) {
+	battery_set_brownout_threshold(millivolts);
+}
 }  // namespace battery
 }  // namespace pros
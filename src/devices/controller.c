@@ -12,71 +12,160 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "kapi.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "vdml/vdml.h"
 
 #define CONTROLLER_MAX_COLS 15
 
-// From enum in misc.h
-#define NUM_BUTTONS 12
+// The inputs sampled by the system daemon, published with the other snapshots
+static controller_state_s_t states[2];
 
-typedef struct controller_data {
-	bool button_pressed[NUM_BUTTONS];
-} controller_data_s_t;
+// What controller_get_digital_new_press() has reported, shared by its callers
+static uint32_t reported_presses[2][CONTROLLER_NUM_BUTTONS];
+static uint16_t reported_valid[2];
 
-bool get_button_pressed(int port, int button) {
-	return ((controller_data_s_t*)registry_get_device_internal(port)->pad)->button_pressed[button];
+struct controller_edge_queue_s {
+	struct controller_edge_queue_s* next;
+	controller_id_e_t id;
+	uint16_t button_mask;
+	volatile uint32_t head;  // Written by the daemon
+	volatile uint32_t tail;  // Written by the reader
+	volatile uint32_t dropped;
+	controller_edge_s_t edges[CONTROLLER_EDGE_QUEUE_SIZE];
+};
+
+// Only changed with the scheduler suspended
+static struct controller_edge_queue_s* edge_queues;
+
+struct controller_watch_s {
+	struct controller_watch_s* next;
+	controller_id_e_t id;
+	uint8_t deadband;
+	task_t task;
+	uint32_t notify_bits;
+	// the inputs at the last wakeup
+	int32_t connected;
+	int32_t analog[4];
+	uint16_t buttons;
+};
+
+// Only changed with the scheduler suspended
+static struct controller_watch_s* watches;
+
+static void edge_queues_push(controller_id_e_t id, uint8_t button_num, bool pressed, uint32_t now) {
+	for (struct controller_edge_queue_s* queue = edge_queues; queue != NULL; queue = queue->next) {
+		if (queue->id != id || !(queue->button_mask & (1 << button_num))) continue;
+		uint32_t head = queue->head;
+		if (head - queue->tail >= CONTROLLER_EDGE_QUEUE_SIZE) {
+			queue->dropped++;
+			continue;
+		}
+		controller_edge_s_t* edge = &queue->edges[head % CONTROLLER_EDGE_QUEUE_SIZE];
+		edge->timestamp = now;
+		edge->id = id;
+		edge->button = E_CONTROLLER_DIGITAL_L1 + button_num;
+		edge->pressed = pressed;
+		compiler_barrier();
+		queue->head = head + 1;
+	}
 }
 
-void set_button_pressed(int port, int button, bool state) {
-	controller_data_s_t* data = (controller_data_s_t*)registry_get_device_internal(port)->pad;
-	data->button_pressed[button] = state;
+static void watch_reference(struct controller_watch_s* watch, const controller_state_s_t* state) {
+	watch->connected = state->connected;
+	memcpy(watch->analog, state->analog, sizeof(watch->analog));
+	watch->buttons = state->buttons;
 }
 
-int32_t controller_is_connected(controller_id_e_t id) {
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
+static void watches_check(controller_id_e_t id, const controller_state_s_t* state) {
+	for (struct controller_watch_s* watch = watches; watch != NULL; watch = watch->next) {
+		if (watch->id != id) continue;
+		bool changed = state->buttons != watch->buttons || state->connected != watch->connected;
+		for (int i = 0; i < 4 && !changed; i++) {
+			int32_t const moved = state->analog[i] - watch->analog[i];
+			if (moved > watch->deadband || -moved > watch->deadband) changed = true;
+		}
+		if (!changed) continue;
+		watch_reference(watch, state);
+		task_notify_ext(watch->task, watch->notify_bits, E_NOTIFY_ACTION_BITS, NULL);
 	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void controller_snapshot_capture(void) {
+	uint32_t now = millis();
+	bool input_changed = false;
+	for (int id = E_CONTROLLER_MASTER; id <= E_CONTROLLER_PARTNER; id++) {
+		controller_state_s_t* state = &states[id];
+		state->connected = vexControllerConnectionStatusGet(id) != 0;
+		for (int i = 0; i < 4; i++) {
+			int32_t const value = vexControllerGet(id, E_CONTROLLER_ANALOG_LEFT_X + i);
+			if (value != state->analog[i]) input_changed = true;
+			state->analog[i] = value;
+		}
+		uint16_t buttons = 0;
+		for (int i = 0; i < CONTROLLER_NUM_BUTTONS; i++) {
+			// the buttons enum starts at 6, the correct place for the libv5rts
+			if (vexControllerGet(id, E_CONTROLLER_DIGITAL_L1 + i)) buttons |= 1 << i;
+		}
+		uint16_t changed = buttons ^ state->buttons;
+		if (changed) input_changed = true;
+		for (int i = 0; changed; i++, changed >>= 1) {
+			if (!(changed & 1)) continue;
+			bool pressed = buttons & (1 << i);
+			if (pressed) {
+				state->presses[i]++;
+			} else {
+				state->releases[i]++;
+			}
+			state->edge_times[i] = now;
+			if (unlikely(edge_queues != NULL)) edge_queues_push(id, i, pressed, now);
+		}
+		state->buttons = buttons;
+		state->timestamp = now;
+		if (unlikely(watches != NULL)) watches_check(id, state);
+	}
+	if (input_changed) latency_probe_input_capture();
+}
+
+// Used by vdml_topics_capture(), after controller_snapshot_capture()
+const controller_state_s_t* controller_state_peek(void) {
+	return states;
+}
+
+static inline bool controller_id_valid(controller_id_e_t id) {
+	if (id != E_CONTROLLER_MASTER && id != E_CONTROLLER_PARTNER) {
+		errno = EINVAL;
+		return false;
+	}
+	return true;
+}
+
+int32_t controller_get_state(controller_id_e_t id, controller_state_s_t* const state) {
+	if (!controller_id_valid(id)) return PROS_ERR;
+	if (state == NULL) {
+		errno = EINVAL;
 		return PROS_ERR;
 	}
-	int32_t rtn = vexControllerConnectionStatusGet(id);
-	internal_port_mutex_give(port);
-	return rtn;
+	vdml_snapshot_read(state, &states[id]);
+	return 1;
+}
+
+int32_t controller_is_connected(controller_id_e_t id) {
+	if (!controller_id_valid(id)) return PROS_ERR;
+	return states[id].connected;
 }
 
 int32_t controller_get_analog(controller_id_e_t id, controller_analog_e_t channel) {
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
-	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
+	if (!controller_id_valid(id)) return PROS_ERR;
+	if ((uint32_t)channel > E_CONTROLLER_ANALOG_RIGHT_Y) {
+		errno = EINVAL;
 		return PROS_ERR;
 	}
-	int32_t rtn = vexControllerGet(id, channel);
-	internal_port_mutex_give(port);
-	return rtn;
+	return states[id].analog[channel];
 }
 
 int32_t controller_get_battery_capacity(controller_id_e_t id) {
@@ -124,138 +213,251 @@ int32_t controller_get_battery_level(controller_id_e_t id) {
 }
 
 int32_t controller_get_digital(controller_id_e_t id, controller_digital_e_t button) {
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
-	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
+	if (!controller_id_valid(id)) return PROS_ERR;
+	uint32_t button_num = button - E_CONTROLLER_DIGITAL_L1;
+	if (button_num >= CONTROLLER_NUM_BUTTONS) {
+		errno = EINVAL;
 		return PROS_ERR;
 	}
-	// the buttons enum starts at 4, the correct place for the libv5rts
-	int32_t rtn = vexControllerGet(id, button);
-	internal_port_mutex_give(port);
-	return rtn;
+	return (states[id].buttons >> button_num) & 1;
 }
 
 int32_t controller_get_digital_new_press(controller_id_e_t id, controller_digital_e_t button) {
-	int32_t pressed = controller_get_digital(id, button);
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
-	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
+	if (!controller_id_valid(id)) return PROS_ERR;
+	uint32_t button_num = button - E_CONTROLLER_DIGITAL_L1;
+	if (button_num >= CONTROLLER_NUM_BUTTONS) {
+		errno = EINVAL;
 		return PROS_ERR;
 	}
-	uint8_t button_num = button - E_CONTROLLER_DIGITAL_L1;
+	bool new_press;
+	rtos_suspend_all();
+	uint32_t presses = states[id].presses[button_num];
+	if (!(reported_valid[id] & (1 << button_num))) {
+		// The first call only reports the button if it is held right now, not
+		// presses from long ago
+		reported_presses[id][button_num] = presses - ((states[id].buttons >> button_num) & 1);
+		reported_valid[id] |= 1 << button_num;
+	}
+	new_press = reported_presses[id][button_num] != presses;
+	reported_presses[id][button_num] = presses;
+	rtos_resume_all();
+	return new_press;
+}
 
-	if (!pressed) {
-		set_button_pressed(port, button_num, false);
+controller_edge_queue_t controller_edge_queue_create(controller_id_e_t id, uint16_t button_mask) {
+	if (!controller_id_valid(id)) return NULL;
+	if (button_mask == 0 || (button_mask >> CONTROLLER_NUM_BUTTONS) != 0) {
+		errno = EINVAL;
+		return NULL;
 	}
-	if (pressed && !get_button_pressed(port, button_num)) {
-		// button is currently pressed and was not detected as being pressed during
-		// last check
-		set_button_pressed(port, button_num, true);
-		internal_port_mutex_give(port);
-		return true;
-	} else {
-		internal_port_mutex_give(port);
-		return false;  // button is not pressed or was already detected
+	struct controller_edge_queue_s* queue = kmalloc(sizeof(*queue));
+	if (queue == NULL) {
+		errno = ENOMEM;
+		return NULL;
 	}
+	memset(queue, 0, sizeof(*queue));
+	queue->id = id;
+	queue->button_mask = button_mask;
+	rtos_suspend_all();
+	queue->next = edge_queues;
+	edge_queues = queue;
+	rtos_resume_all();
+	return queue;
 }
 
-int32_t controller_set_text(controller_id_e_t id, uint8_t line, uint8_t col, const char* str) {
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
-	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
+int32_t controller_edge_queue_read(controller_edge_queue_t queue, controller_edge_s_t* const edges, uint32_t count) {
+	if (queue == NULL || edges == NULL) {
+		errno = EINVAL;
 		return PROS_ERR;
 	}
-	line++;
-	if (col >= CONTROLLER_MAX_COLS)
-		col = CONTROLLER_MAX_COLS;
-	else
-		col++;
+	uint32_t tail = queue->tail;
+	uint32_t available = queue->head - tail;
+	if (count > available) count = available;
+	compiler_barrier();
+	for (uint32_t i = 0; i < count; i++) {
+		edges[i] = queue->edges[(tail + i) % CONTROLLER_EDGE_QUEUE_SIZE];
+	}
+	compiler_barrier();
+	queue->tail = tail + count;
+	return count;
+}
 
-	char* buf = strndup(str, CONTROLLER_MAX_COLS + 1);
+uint32_t controller_edge_queue_get_dropped(controller_edge_queue_t queue) {
+	return queue == NULL ? 0 : queue->dropped;
+}
 
-	uint32_t rtn_val = vexControllerTextSet(id, line, col, buf);
-	free(buf);
-	internal_port_mutex_give(port);
+void controller_edge_queue_delete(controller_edge_queue_t queue) {
+	if (queue == NULL) return;
+	rtos_suspend_all();
+	struct controller_edge_queue_s** link = &edge_queues;
+	while (*link != NULL && *link != queue) link = &(*link)->next;
+	if (*link != NULL) *link = queue->next;
+	rtos_resume_all();
+	kfree(queue);
+}
 
-	if (!rtn_val) {
-		errno = EAGAIN;
-		return PROS_ERR;
+controller_watch_t controller_watch_create(controller_id_e_t id, uint8_t deadband, uint32_t notify_bits) {
+	if (!controller_id_valid(id)) return NULL;
+	if (notify_bits == 0) {
+		errno = EINVAL;
+		return NULL;
 	}
-	return 1;
+	struct controller_watch_s* watch = kmalloc(sizeof(*watch));
+	if (watch == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	watch->id = id;
+	watch->deadband = deadband;
+	watch->task = task_get_current();
+	watch->notify_bits = notify_bits;
+	rtos_suspend_all();
+	watch_reference(watch, &states[id]);
+	watch->next = watches;
+	watches = watch;
+	rtos_resume_all();
+	return watch;
 }
 
-int32_t controller_print(controller_id_e_t id, uint8_t line, uint8_t col, const char* fmt, ...) {
-	uint8_t port;
-	switch (id) {
-		case E_CONTROLLER_MASTER:
-			port = V5_PORT_CONTROLLER_1;
-			break;
-		case E_CONTROLLER_PARTNER:
-			port = V5_PORT_CONTROLLER_2;
-			break;
-		default:
-			errno = EINVAL;
-			return PROS_ERR;
+void controller_watch_delete(controller_watch_t watch) {
+	if (watch == NULL) return;
+	rtos_suspend_all();
+	struct controller_watch_s** link = &watches;
+	while (*link != NULL && *link != watch) link = &(*link)->next;
+	if (*link != NULL) *link = watch->next;
+	rtos_resume_all();
+	kfree(watch);
+}
+
+// VEXos only sends a controller one screen or rumble update about every 50 ms
+#define CONTROLLER_OUTPUT_INTERVAL 50
+
+// Slot 0 clears the whole screen, 1-3 are the screen's lines and 4 is the
+// rumble, the same as the lines vexControllerTextSet() takes
+#define CONTROLLER_OUTPUT_SLOTS 5
+#define CONTROLLER_CLEAR_SLOT 0
+
+typedef struct controller_output_slot_s {
+	bool pending;
+	uint32_t seq;  // Bumped by every write, so the daemon knows if a slot changed while it was sending
+	uint8_t col;
+	char text[CONTROLLER_MAX_COLS + 1];
+} controller_output_slot_s_t;
+
+typedef struct controller_output_s {
+	controller_output_slot_s_t slots[CONTROLLER_OUTPUT_SLOTS];
+	uint32_t last_sent;
+	uint8_t next_slot;  // Where to start looking for a pending line, so every line gets a turn
+	controller_output_stats_s_t stats;
+} controller_output_s_t;
+
+// Only changed with the scheduler suspended
+static controller_output_s_t outputs[2];
+static uint8_t outputs_pending;  // Bit id is set while controller id has a pending slot
+
+static controller_output_slot_s_t* output_next_slot(controller_output_s_t* output) {
+	// Clearing the screen has to go first, since the lines written after it are
+	// meant to stay
+	if (output->slots[CONTROLLER_CLEAR_SLOT].pending) return &output->slots[CONTROLLER_CLEAR_SLOT];
+	for (int i = 0; i < CONTROLLER_OUTPUT_SLOTS - 1; i++) {
+		uint8_t slot = 1 + (output->next_slot + i) % (CONTROLLER_OUTPUT_SLOTS - 1);
+		if (output->slots[slot].pending) {
+			output->next_slot = slot % (CONTROLLER_OUTPUT_SLOTS - 1);
+			return &output->slots[slot];
+		}
 	}
-	if (!internal_port_mutex_take(port)) {
-		errno = EACCES;
-		return PROS_ERR;
+	return NULL;
+}
+
+// Called by vdml_background_processing() while the daemon holds every port
+void controller_output_flush(void) {
+	if (likely(!outputs_pending)) return;
+	uint32_t now = millis();
+	for (int id = E_CONTROLLER_MASTER; id <= E_CONTROLLER_PARTNER; id++) {
+		controller_output_s_t* output = &outputs[id];
+		if (!(outputs_pending & (1 << id)) || now - output->last_sent < CONTROLLER_OUTPUT_INTERVAL) continue;
+		controller_output_slot_s_t copy;
+		rtos_suspend_all();
+		controller_output_slot_s_t* slot = output_next_slot(output);
+		if (slot != NULL) copy = *slot;
+		rtos_resume_all();
+		if (slot == NULL) continue;
+
+		output->last_sent = now;
+		bool accepted = vexControllerTextSet(id, slot - output->slots, copy.col, copy.text);
+		rtos_suspend_all();
+		if (!accepted) {
+			output->stats.retries++;
+		} else {
+			output->stats.sent++;
+			// A write that came in while sending is sent next time
+			if (slot->seq == copy.seq) {
+				slot->pending = false;
+				output->stats.pending--;
+			}
+		}
+		if (output->stats.pending == 0) outputs_pending &= ~(1 << id);
+		rtos_resume_all();
 	}
+}
+
+// Must be called with the scheduler suspended
+static void output_slot_write(controller_id_e_t id, uint8_t slot_num, uint8_t col, const char* text) {
+	controller_output_s_t* output = &outputs[id];
+	controller_output_slot_s_t* slot = &output->slots[slot_num];
+	if (slot->pending) {
+		output->stats.overwritten++;
+	} else {
+		slot->pending = true;
+		output->stats.pending++;
+	}
+	slot->seq++;
+	slot->col = col;
+	strncpy(slot->text, text, CONTROLLER_MAX_COLS);
+	slot->text[CONTROLLER_MAX_COLS] = '\0';
+	if (slot_num == CONTROLLER_CLEAR_SLOT) {
+		// The screen's lines are about to be cleared, so waiting writes to them
+		// would be wiped straight away
+		for (int i = 1; i <= 3; i++) {
+			if (!output->slots[i].pending) continue;
+			output->slots[i].pending = false;
+			output->stats.pending--;
+			output->stats.overwritten++;
+		}
+	}
+	outputs_pending |= 1 << id;
+}
+
+static int32_t controller_output_write(controller_id_e_t id, uint8_t line, uint8_t col, const char* text) {
+	if (!controller_id_valid(id)) return PROS_ERR;
+	// Line 255 (-1) clears the screen
 	line++;
+	if (line >= CONTROLLER_OUTPUT_SLOTS || text == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
 	if (col >= CONTROLLER_MAX_COLS)
 		col = CONTROLLER_MAX_COLS;
 	else
 		col++;
 
+	rtos_suspend_all();
+	output_slot_write(id, line, col, text);
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t controller_set_text(controller_id_e_t id, uint8_t line, uint8_t col, const char* str) {
+	return controller_output_write(id, line, col, str);
+}
+
+int32_t controller_print(controller_id_e_t id, uint8_t line, uint8_t col, const char* fmt, ...) {
+	char buf[CONTROLLER_MAX_COLS + 1];
 	va_list args;
 	va_start(args, fmt);
-	char* buf = (char*)malloc(CONTROLLER_MAX_COLS + 1);
-	vsnprintf(buf, CONTROLLER_MAX_COLS + 1, fmt, args);
-
-	uint32_t rtn_val = vexControllerTextSet(id, line, col, buf);
-	free(buf);
+	vsnprintf(buf, sizeof(buf), fmt, args);
 	va_end(args);
-
-	internal_port_mutex_give(port);
-
-	if (!rtn_val) {
-		errno = EAGAIN;
-		return PROS_ERR;
-	}
-	return 1;
+	return controller_output_write(id, line, col, buf);
 }
 
 int32_t controller_clear_line(controller_id_e_t id, uint8_t line) {
@@ -267,10 +469,11 @@ int32_t controller_clear(controller_id_e_t id) {
 	if (vexSystemVersion() > 0x01000000) {
 		return controller_print(id, -1, 0, "");
 	} else {
+		// VEXos 1.0.0 can't clear the whole screen at once. The daemon spaces the
+		// three lines out, so there's no need to wait between them
 		for (int i = 0; i < 3; i++) {
 			int32_t rtn = controller_clear_line(id, i);
 			if (rtn == PROS_ERR) return PROS_ERR;
-			if (i != 2) delay(55);
 		}
 		return 1;
 	}
@@ -280,6 +483,18 @@ int32_t controller_rumble(controller_id_e_t id, const char* rumble_pattern) {
 	return controller_set_text(id, 3, 0, rumble_pattern);
 }
 
+int32_t controller_get_output_stats(controller_id_e_t id, controller_output_stats_s_t* const stats) {
+	if (!controller_id_valid(id)) return PROS_ERR;
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*stats = outputs[id].stats;
+	rtos_resume_all();
+	return 1;
+}
+
 uint8_t competition_get_status(void) {
 	return vexCompetitionStatus();
 }
@@ -0,0 +1,208 @@
+/**
+ * \file devices/odometry.c
+ *
+ * Tracking of the robot's position in the system daemon.
+ *
+ * odom_update() runs from vdml_snapshot_capture(), while the scheduler is
+ * suspended straight after VEXos has updated its device data, and the daemon
+ * holds every port. It reads the tracking wheels and the Inertial Sensor,
+ * treats the motion since the last cycle as an arc and adds it to the pose.
+ * The pose is then published with the other snapshots, so odom_get_pose()
+ * doesn't need a lock.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "pros/odometry.h"
+#include "system/optimizers.h"
+#include "v5_api.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+#define DEG_TO_RAD (M_PI / 180.0)
+
+extern bool adi_encoder_sample(uint8_t port, int32_t* count);
+
+// The configuration and the state below are only changed with the scheduler
+// suspended, which keeps them from changing under odom_update()
+static odom_config_s_t config;
+static bool running;
+static bool primed;  // Whether the last readings are valid
+static double last_forward, last_sideways, last_rotation;
+static double heading_offset;  // Added to the Inertial Sensor's rotation to give theta
+static bool theta_pending;     // Whether pending_theta is to be set as soon as there is a reading
+static double pending_theta;
+static odom_pose_s_t pose;
+static odom_pose_s_t published;
+
+static bool wheel_read(const odom_wheel_s_t* wheel, double* distance) {
+	double ticks;
+	if (wheel->source == E_ODOM_SOURCE_ADI_ENCODER) {
+		int32_t count;
+		if (!adi_encoder_sample(wheel->port, &count)) return false;
+		ticks = count;
+	} else if (wheel->source == E_ODOM_SOURCE_MOTOR) {
+		if (registry_get_plugged_type(wheel->port) != E_DEVICE_MOTOR) return false;
+		ticks = vexDeviceMotorPositionGet(registry_get_device(wheel->port)->device_info);
+	} else {
+		*distance = 0;
+		return true;
+	}
+	*distance = (wheel->reversed ? -ticks : ticks) * wheel->distance_per_tick;
+	return true;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void odom_update(void) {
+	if (likely(!running)) return;
+	double forward, sideways, rotation;
+	V5_DeviceT imu = registry_get_device(config.imu_port)->device_info;
+	if (registry_get_plugged_type(config.imu_port) != E_DEVICE_IMU ||
+	    (vexDeviceImuStatusGet(imu) & E_IMU_STATUS_CALIBRATING) || !wheel_read(&config.forward, &forward) ||
+	    !wheel_read(&config.sideways, &sideways)) {
+		primed = false;
+		return;
+	}
+	rotation = vexDeviceImuHeadingGet(imu);
+	if (theta_pending) {
+		heading_offset = pending_theta - rotation;
+		theta_pending = false;
+	}
+
+	if (primed) {
+		double d_forward = forward - last_forward;
+		double d_sideways = sideways - last_sideways;
+		double d_theta = (rotation - last_rotation) * DEG_TO_RAD;
+		double theta = (last_rotation + heading_offset) * DEG_TO_RAD;
+
+		// The motion relative to the robot, x to its right and y forward
+		double local_x = d_sideways, local_y = d_forward;
+		if (d_theta != 0) {
+			double chord = 2 * sin(d_theta / 2);
+			local_y = chord * (d_forward / d_theta + config.forward.offset);
+			local_x = chord * (d_sideways / d_theta - config.sideways.offset);
+		}
+		// The chord points halfway between the old and new headings
+		double angle = theta + d_theta / 2;
+		pose.x += local_y * sin(angle) + local_x * cos(angle);
+		pose.y += local_y * cos(angle) - local_x * sin(angle);
+	}
+	last_forward = forward;
+	last_sideways = sideways;
+	last_rotation = rotation;
+	primed = true;
+
+	pose.theta = rotation + heading_offset;
+	pose.timestamp = millis();
+	published = pose;
+}
+
+static int32_t wheel_validate(odom_wheel_s_t* wheel) {
+	if (wheel->source == E_ODOM_SOURCE_NONE) return 1;
+	if (wheel->distance_per_tick == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (wheel->source == E_ODOM_SOURCE_ADI_ENCODER) {
+		// Stored as 0-7, like the ADI functions do
+		if (wheel->port >= 'a' && wheel->port <= 'h') {
+			wheel->port -= 'a';
+		} else if (wheel->port >= 'A' && wheel->port <= 'H') {
+			wheel->port -= 'A';
+		} else {
+			wheel->port--;
+		}
+		if (wheel->port >= NUM_ADI_PORTS) {
+			errno = ENXIO;
+			return PROS_ERR;
+		}
+	} else if (wheel->source == E_ODOM_SOURCE_MOTOR) {
+		wheel->port--;
+		if (!VALIDATE_PORT_NO(wheel->port)) {
+			errno = ENXIO;
+			return PROS_ERR;
+		}
+	} else {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t odom_start(const odom_config_s_t* new_config) {
+	if (new_config == NULL || new_config->forward.source == E_ODOM_SOURCE_NONE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	odom_config_s_t checked = *new_config;
+	if (wheel_validate(&checked.forward) == PROS_ERR || wheel_validate(&checked.sideways) == PROS_ERR) {
+		return PROS_ERR;
+	}
+	checked.imu_port--;
+	if (!VALIDATE_PORT_NO(checked.imu_port)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+
+	rtos_suspend_all();
+	config = checked;
+	primed = false;
+	theta_pending = true;
+	pending_theta = 0;
+	memset(&pose, 0, sizeof(pose));
+	running = true;
+	rtos_resume_all();
+	return 1;
+}
+
+void odom_stop(void) {
+	rtos_suspend_all();
+	running = false;
+	rtos_resume_all();
+}
+
+int32_t odom_set_pose(double x, double y, double theta) {
+	int32_t ret = 1;
+	rtos_suspend_all();
+	if (running) {
+		pose.x = x;
+		pose.y = y;
+		pose.theta = theta;
+		if (primed) {
+			heading_offset = theta - last_rotation;
+		} else {
+			theta_pending = true;
+			pending_theta = theta;
+		}
+	} else {
+		errno = EINVAL;
+		ret = PROS_ERR;
+	}
+	rtos_resume_all();
+	return ret;
+}
+
+// Gives the pose path_follow_update() steers by, or NULL if the odometry didn't
+// update it this cycle. Called with the scheduler suspended
+const odom_pose_s_t* odom_pose_peek(void) {
+	return running && primed ? &pose : NULL;
+}
+
+int32_t odom_get_pose(odom_pose_s_t* out) {
+	if (out == NULL || !running) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(out, &published);
+	return 1;
+}
@@ -0,0 +1,265 @@
+/**
+ * \file devices/path_follow.c
+ *
+ * Pure pursuit path following in the system daemon.
+ *
+ * path_follow_update() runs from vdml_snapshot_capture() straight after
+ * odom_update(), with the scheduler suspended and every port held by the
+ * daemon. It moves the closest point and the lookahead point on from where
+ * they were last cycle, steers along the arc through the lookahead point and
+ * sends the wheel velocities to the drive motors, so they go out with the
+ * next vexBackgroundProcessing().
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "pros/odometry.h"
+#include "system/optimizers.h"
+#include "vdml/vdml.h"
+
+#define DEG_TO_RAD (M_PI / 180.0)
+
+// from odometry.c and vdml_motors.c
+extern const odom_pose_s_t* odom_pose_peek(void);
+extern void motor_velocity_drive(uint8_t port, double rpm);
+
+// The configuration and the state below are only changed with the scheduler
+// suspended, which keeps them from changing under path_follow_update()
+static const path_point_s_t* path;
+static uint32_t path_len;
+static path_follow_config_s_t config;
+static uint32_t left_ports, right_ports, reversed_ports;  // Bit i for port i + 1
+static volatile bool running;
+static uint32_t stop_ports;  // The motors of a path stopped early, for the daemon to stop
+static bool started;         // Whether a path has ever been started, so the status means something
+static uint32_t closest;
+static double lookahead;  // The lookahead point as a fractional index into the path
+static path_follow_status_s_t status;
+static path_follow_status_s_t published;
+
+static void drive(double left_rpm, double right_rpm) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		double rpm;
+		if (left_ports & (1 << i)) {
+			rpm = left_rpm;
+		} else if (right_ports & (1 << i)) {
+			rpm = right_rpm;
+		} else {
+			continue;
+		}
+		motor_velocity_drive(i, (reversed_ports & (1 << i)) ? -rpm : rpm);
+	}
+}
+
+static double distance_squared(const path_point_s_t* point, double x, double y) {
+	double const dx = point->x - x, dy = point->y - y;
+	return dx * dx + dy * dy;
+}
+
+// Finds where the circle of the lookahead distance about the robot leaves the
+// path, past the last lookahead point. Returns false if the path isn't within
+// reach. Only looks a couple of lookaheads along the path, so far away parts
+// of a path which doubles back don't count and every cycle costs the same
+static bool lookahead_find(double x, double y, double* found) {
+	double const radius = config.lookahead;
+	double travelled = 0;
+	uint32_t i = (uint32_t)lookahead > closest ? (uint32_t)lookahead : closest;
+	for (; i + 1 < path_len && travelled < 2 * radius; i++) {
+		const path_point_s_t* const from = &path[i];
+		const path_point_s_t* const to = &path[i + 1];
+		double const dx = to->x - from->x, dy = to->y - from->y;
+		double const fx = from->x - x, fy = from->y - y;
+		double const a = dx * dx + dy * dy;
+		if (a == 0) continue;
+		double const b = 2 * (fx * dx + fy * dy);
+		double const c = fx * fx + fy * fy - radius * radius;
+		double const disc = b * b - 4 * a * c;
+		travelled += sqrt(a);
+		if (disc < 0) continue;
+		// The far intersection is where the path leaves the circle
+		double const t = (-b + sqrt(disc)) / (2 * a);
+		if (t >= 0 && t <= 1 && i + t >= lookahead) {
+			*found = i + t;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended, once the
+// odometry has updated the pose
+void path_follow_update(void) {
+	if (unlikely(stop_ports)) {
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (stop_ports & (1 << i)) motor_velocity_drive(i, 0);
+		}
+		stop_ports = 0;
+	}
+	if (likely(!running)) return;
+	const odom_pose_s_t* const pose = odom_pose_peek();
+	// The motors keep their last velocities through a missed reading
+	if (pose == NULL) return;
+
+	while (closest + 1 < path_len &&
+	       distance_squared(&path[closest + 1], pose->x, pose->y) <= distance_squared(&path[closest], pose->x, pose->y)) {
+		closest++;
+	}
+	const path_point_s_t* const end = &path[path_len - 1];
+	double const theta = pose->theta * DEG_TO_RAD;
+	double const sin_theta = sin(theta), cos_theta = cos(theta);
+	double const end_dist_sq = distance_squared(end, pose->x, pose->y);
+	// The end is behind the robot once it's closest and has a negative forward distance
+	bool const passed = closest == path_len - 1 && (end->x - pose->x) * sin_theta + (end->y - pose->y) * cos_theta < 0;
+	if (end_dist_sq <= config.end_tolerance * config.end_tolerance || passed) {
+		drive(0, 0);
+		running = false;
+		status.closest = closest;
+		status.curvature = status.left_rpm = status.right_rpm = 0;
+		status.running = false;
+		status.timestamp = millis();
+		published = status;
+		return;
+	}
+
+	double target_x, target_y;
+	double found;
+	if (end_dist_sq <= config.lookahead * config.lookahead) {
+		lookahead = path_len - 1;
+		target_x = end->x;
+		target_y = end->y;
+	} else if (lookahead_find(pose->x, pose->y, &found)) {
+		lookahead = found;
+		uint32_t const i = (uint32_t)found;
+		double const t = found - i;
+		target_x = path[i].x + t * (path[i + 1].x - path[i].x);
+		target_y = path[i].y + t * (path[i + 1].y - path[i].y);
+	} else {
+		// Off the path, so head back towards it
+		uint32_t const i = closest + 1 < path_len ? closest + 1 : closest;
+		target_x = path[i].x;
+		target_y = path[i].y;
+	}
+
+	// The target in the robot's frame, x to its right and y forward, like odom_update()
+	double const dx = target_x - pose->x, dy = target_y - pose->y;
+	double const local_x = dx * cos_theta - dy * sin_theta;
+	double const dist_sq = dx * dx + dy * dy;
+	double const curvature = dist_sq > 0 ? 2 * local_x / dist_sq : 0;
+	double const speed = path[closest].velocity * config.rpm_per_speed;
+	double const turn = curvature * config.track_width / 2;
+	double const left_rpm = speed * (1 + turn), right_rpm = speed * (1 - turn);
+	drive(left_rpm, right_rpm);
+
+	status.closest = closest;
+	status.lookahead_x = target_x;
+	status.lookahead_y = target_y;
+	status.curvature = curvature;
+	status.left_rpm = left_rpm;
+	status.right_rpm = right_rpm;
+	status.running = true;
+	status.timestamp = millis();
+	published = status;
+}
+
+static int32_t ports_validate(const int8_t* ports, uint32_t* mask, uint32_t* reversed) {
+	*mask = 0;
+	for (int i = 0; i < PATH_FOLLOW_MAX_MOTORS; i++) {
+		if (ports[i] == 0) continue;
+		int32_t const port = (ports[i] < 0 ? -ports[i] : ports[i]) - 1;
+		if (!VALIDATE_PORT_NO(port) || port == NUM_V5_PORTS - 1) {
+			errno = ENXIO;
+			return PROS_ERR;
+		}
+		*mask |= 1 << port;
+		if (ports[i] < 0) *reversed |= 1 << port;
+	}
+	return 1;
+}
+
+int32_t path_follow_start(const path_point_s_t* points, uint32_t num_points,
+                          const path_follow_config_s_t* new_config) {
+	if (points == NULL || new_config == NULL || num_points < 2 || !(new_config->lookahead > 0) ||
+	    !(new_config->track_width > 0) || !(new_config->rpm_per_speed > 0)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	odom_pose_s_t pose;
+	if (odom_get_pose(&pose) == PROS_ERR) return PROS_ERR;
+	uint32_t left, right, reversed = 0;
+	if (ports_validate(new_config->left_ports, &left, &reversed) == PROS_ERR ||
+	    ports_validate(new_config->right_ports, &right, &reversed) == PROS_ERR) {
+		return PROS_ERR;
+	}
+	if (!left || !right) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+
+	rtos_suspend_all();
+	// The motors of the last path which aren't in this one need stopping
+	if (running) stop_ports |= (left_ports | right_ports) & ~(left | right);
+	stop_ports &= ~(left | right);
+	path = points;
+	path_len = num_points;
+	config = *new_config;
+	left_ports = left;
+	right_ports = right;
+	reversed_ports = reversed;
+	closest = 0;
+	lookahead = 0;
+	memset(&status, 0, sizeof(status));
+	status.running = true;
+	published = status;
+	started = true;
+	running = true;
+	rtos_resume_all();
+	return 1;
+}
+
+void path_follow_stop(void) {
+	rtos_suspend_all();
+	if (running) {
+		running = false;
+		stop_ports |= left_ports | right_ports;
+		status.running = false;
+		published = status;
+	}
+	rtos_resume_all();
+}
+
+int32_t path_follow_get_status(path_follow_status_s_t* out) {
+	if (out == NULL || !started) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(out, &published);
+	return 1;
+}
+
+int32_t path_follow_wait(uint32_t timeout) {
+	if (running && xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	uint32_t const start = millis();
+	while (running) {
+		uint32_t const elapsed = millis() - start;
+		if (timeout != TIMEOUT_MAX && elapsed >= timeout) {
+			errno = ETIMEDOUT;
+			return PROS_ERR;
+		}
+		// The daemon steers just before it wakes the tasks waiting on the drive's ports
+		vdml_wait_for_update(left_ports | right_ports, timeout == TIMEOUT_MAX ? TIMEOUT_MAX : timeout - elapsed);
+	}
+	return 1;
+}
@@ -14,56 +14,148 @@
 
 #include <errno.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "api.h"
 #include "kapi.h"
 #include "pros/misc.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "vdml/registry.h"
 #include "vdml/vdml.h"
 
-static v5_smart_device_s_t registry[V5_MAX_DEVICE_PORTS];
+__pros_fast_bss v5_smart_device_s_t registry_devices[V5_MAX_DEVICE_PORTS];
+__pros_fast_bss static uint8_t registry_pads[NUM_V5_PORTS][REGISTRY_PAD_SIZE] __attribute__((aligned(8)));
 static V5_DeviceType registry_types[V5_MAX_DEVICE_PORTS];
+static V5_DeviceType registry_prev_types[V5_MAX_DEVICE_PORTS];
+
+
+// The ports whose binding changed since the last registry_update_types()
+static uint32_t registry_rebound_ports;
+
+// Plugged type changes that haven't been passed to the callback yet
+static registry_change_fn_t registry_change_callback;
+static uint32_t registry_pending_changes;
+static v5_device_e_t registry_pending_old_types[NUM_V5_PORTS];
+
+// The program's PROS_ROBOT_CONFIG(), if it has one, by port
+extern __attribute__((weak)) const robot_port_config_s_t pros_robot_config[];
+extern __attribute__((weak)) const uint32_t pros_robot_config_count;
+static const robot_port_config_s_t* registry_configs[NUM_V5_PORTS];
 
 void registry_init() {
 	int i;
-	kprint("[VDML][INFO]Initializing registry\n");
+	const bool quiet = boot_get_options() & PROS_BOOT_QUIET_REGISTRY;
+	klog(E_KLOG_VDML, E_KLOG_INFO, "Initializing registry");
 	registry_update_types();
+	// Make the first validation cover every port
+	registry_rebound_ports = (1 << NUM_V5_PORTS) - 1;
+	uint32_t const configs = &pros_robot_config_count != NULL ? pros_robot_config_count : 0;
+	for (uint32_t c = 0; c < configs; c++) {
+		uint8_t const port = pros_robot_config[c].port - 1;
+		// The built-in ADI is always bound
+		if (VALIDATE_PORT_NO(port) && port != NUM_V5_PORTS - 1) {
+			registry_configs[port] = &pros_robot_config[c];
+		} else {
+			klog(E_KLOG_VDML, E_KLOG_ERROR, "Robot configuration: Invalid port number %d", port + 1);
+		}
+	}
 	for (i = 0; i < NUM_V5_PORTS; i++) {
-		registry[i].device_type = (v5_device_e_t)registry_types[i];
-		registry[i].device_info = vexDeviceGetByIndex(i);
-		if (registry[i].device_type != E_DEVICE_NONE) {
-			kprintf("[VDML][INFO]Register device in port %d", i + 1);
+		registry_devices[i].device_type = (v5_device_e_t)registry_types[i];
+		// A configured port is bound to its type even if something else is plugged in, so that's reported
+		if (registry_configs[i] != NULL) registry_devices[i].device_type = registry_configs[i]->type;
+		registry_devices[i].device_info = vexDeviceGetByIndex(i);
+		registry_devices[i].pad = registry_pads[i];
+		if (!quiet && registry_devices[i].device_type != E_DEVICE_NONE) {
+			klog(E_KLOG_VDML, E_KLOG_INFO, "Register device in port %d", i + 1);
 		}
 	}
-	kprint("[VDML][INFO]Done initializing registry\n");
+	klog(E_KLOG_VDML, E_KLOG_INFO, "Done initializing registry");
 }
 
-void registry_update_types() {
+uint32_t registry_update_types() {
 	vexDeviceGetStatus(registry_types);
+	uint32_t changed = registry_rebound_ports;
+	registry_rebound_ports = 0;
+	if (memcmp(registry_types, registry_prev_types, sizeof(registry_types)) == 0) {
+		return changed;
+	}
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (registry_types[i] == registry_prev_types[i]) continue;
+		registry_devices[i].validated_type = E_DEVICE_NONE;
+		if (!(registry_pending_changes & (1 << i))) {
+			registry_pending_old_types[i] = (v5_device_e_t)registry_prev_types[i];
+		}
+		registry_pending_changes |= 1 << i;
+		changed |= 1 << i;
+	}
+	memcpy(registry_prev_types, registry_types, sizeof(registry_types));
+	return changed;
+}
+
+void registry_mark_validated(uint8_t port) {
+	if (VALIDATE_PORT_NO(port)) {
+		registry_devices[port].validated_type = registry_devices[port].device_type;
+	}
+}
+
+void registry_config_apply(uint32_t ports) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		const robot_port_config_s_t* const config = registry_configs[i];
+		if (!(ports & (1 << i)) || config == NULL || config->type != E_DEVICE_MOTOR) continue;
+		if ((v5_device_e_t)registry_types[i] != E_DEVICE_MOTOR) continue;
+		if (config->gearset != E_MOTOR_GEARSET_INVALID) motor_set_gearing(i + 1, config->gearset);
+		if (config->brake_mode != E_MOTOR_BRAKE_INVALID) motor_set_brake_mode(i + 1, config->brake_mode);
+		if (config->encoder_units != E_MOTOR_ENCODER_INVALID) motor_set_encoder_units(i + 1, config->encoder_units);
+		motor_set_reversed(i + 1, config->reversed);
+	}
+}
+
+void registry_dispatch_changes() {
+	uint32_t changes = registry_pending_changes;
+	registry_change_fn_t callback = registry_change_callback;
+	if (likely(!changes)) return;
+	registry_pending_changes = 0;
+	// A configured motor plugged back in has lost its settings
+	registry_config_apply(changes);
+	if (callback == NULL) return;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(changes & (1 << i))) continue;
+		v5_device_e_t new_type = (v5_device_e_t)registry_types[i];
+		// Skip ports which went back to what they were, e.g. a loose cable
+		if (registry_pending_old_types[i] != new_type) {
+			callback(i + 1, registry_pending_old_types[i], new_type);
+		}
+	}
+}
+
+void registry_on_change(registry_change_fn_t callback) {
+	registry_change_callback = callback;
 }
 
 int registry_bind_port(uint8_t port, v5_device_e_t device_type) {
 	if (!VALIDATE_PORT_NO(port)) {
-		kprintf("[VDML][ERROR]Registration: Invalid port number %d\n", port + 1);
+		klog(E_KLOG_VDML, E_KLOG_ERROR, "Registration: Invalid port number %d", port + 1);
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	if (registry[port].device_type != E_DEVICE_NONE) {
-		kprintf("[VDML][ERROR]Registration: Port already in use %d\n", port + 1);
+	if (registry_devices[port].device_type != E_DEVICE_NONE) {
+		klog(E_KLOG_VDML, E_KLOG_ERROR, "Registration: Port already in use %d", port + 1);
 		errno = EADDRINUSE;
 		return PROS_ERR;
 	}
 	if ((v5_device_e_t)registry_types[port] != device_type && (v5_device_e_t)registry_types[port] != E_DEVICE_NONE) {
-		kprintf("[VDML][ERROR]Registration: Device mismatch in port %d\n", port + 1);
+		klog(E_KLOG_VDML, E_KLOG_ERROR, "Registration: Device mismatch in port %d", port + 1);
 		errno = EADDRINUSE;
 		return PROS_ERR;
 	}
-	kprintf("[VDML][INFO]Registering device in port %d\n", port + 1);
-	v5_smart_device_s_t device;
-	device.device_type = device_type;
-	device.device_info = vexDeviceGetByIndex(port);
-	registry[port] = device;
+	if (!(boot_get_options() & PROS_BOOT_QUIET_REGISTRY)) {
+		klog(E_KLOG_VDML, E_KLOG_INFO, "Registering device in port %d", port + 1);
+	}
+	registry_devices[port].validated_type = E_DEVICE_NONE;
+	registry_devices[port].device_info = vexDeviceGetByIndex(port);
+	registry_devices[port].device_type = device_type;
+	registry_rebound_ports |= 1 << port;
 	return 1;
 }
 
@@ -73,8 +165,10 @@ int registry_unbind_port(uint8_t port) {
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	registry[port].device_type = E_DEVICE_NONE;
-	registry[port].device_info = NULL;
+	registry_devices[port].validated_type = E_DEVICE_NONE;
+	registry_devices[port].device_type = E_DEVICE_NONE;
+	registry_devices[port].device_info = NULL;
+	registry_rebound_ports |= 1 << port;
 	return 1;
 }
 
@@ -83,7 +177,7 @@ v5_smart_device_s_t* registry_get_device(uint8_t port) {
 		errno = ENXIO;
 		return NULL;
 	}
-	return &registry[port];
+	return &registry_devices[port];
 }
 
 v5_smart_device_s_t* registry_get_device_internal(uint8_t port) {
@@ -91,7 +185,7 @@ v5_smart_device_s_t* registry_get_device_internal(uint8_t port) {
 		errno = ENXIO;
 		return NULL;
 	}
-	return &registry[port];
+	return &registry_devices[port];
 }
 
 v5_device_e_t registry_get_bound_type(uint8_t port) {
@@ -99,7 +193,7 @@ v5_device_e_t registry_get_bound_type(uint8_t port) {
 		errno = ENXIO;
 		return E_DEVICE_UNDEFINED;
 	}
-	return registry[port].device_type;
+	return registry_devices[port].device_type;
 }
 
 v5_device_e_t registry_get_plugged_type(uint8_t port) {
@@ -134,7 +228,7 @@ int32_t registry_validate_binding(uint8_t port, v5_device_e_t expected_t) {
 	} else if (actual_t == E_DEVICE_NONE) {
 		// Warn about nothing plugged
 		if (!vdml_get_port_error(port)) {
-			kprintf("[VDML][WARNING] No device in port %d. Is it plugged in?\n", port + 1);
+			klog(E_KLOG_VDML, E_KLOG_WARNING, "No device in port %d. Is it plugged in?", port + 1);
 			vdml_set_port_error(port);
 		}
 		errno = ENODEV;
@@ -142,7 +236,7 @@ int32_t registry_validate_binding(uint8_t port, v5_device_e_t expected_t) {
 	} else {
 		// Warn about a mismatch
 		if (!vdml_get_port_error(port)) {
-			kprintf("[VDML][WARNING] Device mistmatch in port %d.\n", port + 1);
+			klog(E_KLOG_VDML, E_KLOG_WARNING, "Device mismatch in port %d.", port + 1);
 			vdml_set_port_error(port);
 		}
 		errno = EADDRINUSE;
@@ -15,26 +15,49 @@
 
 #include "vdml/vdml.h"
 #include "kapi.h"
+#include "system/cycles.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "vdml/registry.h"
 
 #include <errno.h>
 #include <stdio.h>
+#include <string.h>
 
 /**
  * Bitmap to indicate if a port has had an error printed or not.
  */
 int32_t port_errors;
 
+volatile uint32_t vdml_snapshot_gen;
+
 extern void registry_init();
 extern void port_mutex_init();
+extern void motor_snapshot_capture(void);
+extern void battery_snapshot_capture(void);
+extern void odom_update(void);
+extern void path_follow_update(void);
+extern void imu_buffer_capture(void);
+extern void imu_calibration_capture(void);
+extern void imu_group_capture(void);
+extern void vision_snapshot_capture(void);
+extern void controller_snapshot_capture(void);
+extern void device_driver_capture(void);
+extern void vdml_topics_initialize(void);
+extern void vdml_topics_capture(void);
+extern void serial_rx_drain(void);
+extern void serial_tx_drain(void);
+extern void adi_background_processing(void);
+extern void controller_output_flush(void);
+extern void motor_commands_forget(uint32_t port_mask);
+extern void vision_signatures_forget(uint32_t port_mask);
 
 int32_t claim_port_try(uint8_t port, v5_device_e_t type) {
 	if (!VALIDATE_PORT_NO(port)) {
 		errno = ENXIO;
 		return 0;
 	}
-	if (registry_validate_binding(port, type) != 0) {
+	if (registry_devices[port].validated_type != type && registry_validate_binding(port, type) != 0) {
 		return 0;
 	}
 	if (!port_mutex_take(port)) {
@@ -49,8 +72,61 @@ int32_t claim_port_try(uint8_t port, v5_device_e_t type) {
  * controllers, batteries which are sort of like smart devices internally to the
  * V5
  */
-mutex_t port_mutexes[V5_MAX_DEVICE_PORTS];            // Mutexes for each port
-static_sem_s_t port_mutex_bufs[V5_MAX_DEVICE_PORTS];  // Stack mem for rtos
+// Hybrid mutexes, since nearly every device call takes its port uncontended. The
+// handles are kept in the ports' registry entries, next to what claim_port() reads
+__pros_fast_bss static_hybrid_mutex_s_t port_mutex_bufs[V5_MAX_DEVICE_PORTS];  // Stack mem for rtos
+
+/**
+ * Instead of taking every port mutex, the system daemon excludes device calls
+ * with a reader/writer scheme: every task which holds a port mutex is counted
+ * as an active device call (a reader), and the daemon (the writer) closes the
+ * gate to new device calls and waits for the active ones to drain.
+ */
+static mutex_t device_gate;                // Held by the daemon while it has exclusive access
+static static_sem_s_t device_gate_buf;
+static sem_t device_drained;               // Posted when the last active device call returns
+static static_sem_s_t device_drained_buf;
+static volatile uint32_t active_device_calls;
+static volatile bool daemon_exclusive;
+static volatile bool daemon_draining;
+
+/**
+ * The device calls the daemon waits on run just below the daemon's priority
+ * until they return, so tasks of middling priority can't hold the daemon up by
+ * preempting a low priority task in the middle of a VEXos call. These are the
+ * tasks raised for the current drain and their priorities beforehand.
+ */
+#define DEVICE_DRAIN_PRIORITY (TASK_PRIORITY_MAX - 3)
+static task_t boosted_tasks[V5_MAX_DEVICE_PORTS];
+static uint32_t boosted_priorities[V5_MAX_DEVICE_PORTS];
+
+/**
+ * Port access statistics, see port_stats_enable(). A port's entry and hold
+ * start are only written by the task holding the port, so taking the port
+ * already serializes them. A hold start of 0 means the hold isn't timed.
+ */
+static volatile bool port_stats_enabled;
+static port_access_stats_s_t port_stats[V5_MAX_DEVICE_PORTS];
+static uint32_t port_hold_starts[V5_MAX_DEVICE_PORTS];
+static port_access_stats_s_t daemon_port_stats;
+static uint32_t daemon_hold_start;
+
+static void port_stats_acquired(port_access_stats_s_t* stats, uint32_t* hold_start, uint32_t wait_start,
+                                bool contended) {
+	uint32_t const now = cycle_counter_get();
+	uint32_t const wait = (now - wait_start) / CPU_CYCLES_PER_US;
+	stats->acquisitions++;
+	if (contended) stats->contended++;
+	stats->total_wait_us += wait;
+	if (wait > stats->max_wait_us) stats->max_wait_us = wait;
+	*hold_start = now ? now : 1;
+}
+
+static void port_stats_released(port_access_stats_s_t* stats, uint32_t* hold_start) {
+	uint32_t const hold = (cycle_counter_get() - *hold_start) / CPU_CYCLES_PER_US;
+	*hold_start = 0;
+	if (hold > stats->max_hold_us) stats->max_hold_us = hold;
+}
 
 /**
  * Shorcut to initialize all of VDML (mutexes and register)
@@ -58,70 +134,230 @@ static_sem_s_t port_mutex_bufs[V5_MAX_DEVICE_PORTS];  // Stack mem for rtos
 void vdml_initialize() {
 	port_mutex_init();
 	registry_init();
+	vdml_topics_initialize();
 }
 
 /**
  * Initializes the mutexes for the motor ports.
  *
- * Initializes a static array of FreeRTOS mutexes to protect against race
+ * Initializes a static array of hybrid mutexes to protect against race
  * conditions. For example, we don't want the Background processing task to run
  * at the same time that we set a motor, because bad information may be
  * returned, or worse.
  */
 void port_mutex_init() {
 	for (int i = 0; i < V5_MAX_DEVICE_PORTS; i++) {
-		port_mutexes[i] = mutex_create_static(&(port_mutex_bufs[i]));
+		registry_devices[i].mutex = hybrid_mutex_create_static(&(port_mutex_bufs[i]));
+	}
+	device_gate = mutex_create_static(&device_gate_buf);
+	device_drained = sem_create_static(1, 0, &device_drained_buf);
+}
+
+// Whether the current task holds a port mutex other than the given port's
+static bool holds_other_port(uint8_t port) {
+	task_t self = task_get_current();
+	for (int i = 0; i < V5_MAX_DEVICE_PORTS; i++) {
+		if (i != port && hybrid_mutex_get_owner(registry_devices[i].mutex) == self) return true;
+	}
+	return false;
+}
+
+/**
+ * Takes a port's mutex and registers a device call on it. If the daemon
+ * currently has exclusive access, the port mutex is returned while waiting for
+ * the daemon to finish, so no task can block on a port held by a waiting task.
+ *
+ * A task which already holds another port (e.g. a motor group) is counted in
+ * active_device_calls, so the daemon is still draining and has not started its
+ * exclusive section yet. Such a task must proceed, or it would deadlock with
+ * the daemon.
+ */
+__pros_fast static int device_call_enter(uint8_t port) {
+	bool const timed = port_stats_enabled;
+	uint32_t const wait_start = timed ? cycle_counter_get() : 0;
+	bool contended = false;
+	while (true) {
+		if (unlikely(timed) && hybrid_mutex_get_owner(registry_devices[port].mutex) != NULL) contended = true;
+		if (!hybrid_mutex_take(registry_devices[port].mutex, TIMEOUT_MAX)) return 0;
+		rtos_suspend_all();
+		if (!daemon_exclusive || holds_other_port(port)) {
+			active_device_calls++;
+			rtos_resume_all();
+			if (unlikely(timed)) port_stats_acquired(&port_stats[port], &port_hold_starts[port], wait_start, contended);
+			return 1;
+		}
+		rtos_resume_all();
+		contended = true;
+		hybrid_mutex_give(registry_devices[port].mutex);
+		mutex_take(device_gate, TIMEOUT_MAX);
+		mutex_give(device_gate);
+	}
+}
+
+__pros_fast static void device_call_exit(void) {
+	bool wake = false;
+	rtos_suspend_all();
+	active_device_calls--;
+	if (active_device_calls == 0 && daemon_draining) {
+		daemon_draining = false;
+		wake = true;
 	}
+	rtos_resume_all();
+	if (wake) sem_post(device_drained);
 }
 
-int port_mutex_take(uint8_t port) {
+__pros_fast int port_mutex_take(uint8_t port) {
 	if (port >= V5_MAX_DEVICE_PORTS) {
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	return xTaskGetSchedulerState() != taskSCHEDULER_RUNNING || mutex_take(port_mutexes[port], TIMEOUT_MAX);
+	if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) return 1;
+	return device_call_enter(port);
 }
 
-int internal_port_mutex_take(uint8_t port) {
+__pros_fast int internal_port_mutex_take(uint8_t port) {
 	if (port >= V5_MAX_DEVICE_PORTS) {
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	return mutex_take(port_mutexes[port], TIMEOUT_MAX);
+	return device_call_enter(port);
 }
 
-static inline char* print_num(char* buff, int num) {
-	*buff++ = (num / 10) + '0';
-	*buff++ = (num % 10) + '0';
-	return buff;
-}
-
-int port_mutex_give(uint8_t port) {
+__pros_fast int port_mutex_give(uint8_t port) {
 	if (port >= V5_MAX_DEVICE_PORTS) {
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	return xTaskGetSchedulerState() != taskSCHEDULER_RUNNING || mutex_give(port_mutexes[port]);
+	if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) return 1;
+	if (unlikely(port_hold_starts[port])) port_stats_released(&port_stats[port], &port_hold_starts[port]);
+	device_call_exit();
+	return hybrid_mutex_give(registry_devices[port].mutex);
 }
 
-int internal_port_mutex_give(uint8_t port) {
+__pros_fast int internal_port_mutex_give(uint8_t port) {
 	if (port >= V5_MAX_DEVICE_PORTS) {
 		errno = ENXIO;
 		return PROS_ERR;
 	}
-	return mutex_give(port_mutexes[port]);
+	if (unlikely(port_hold_starts[port])) port_stats_released(&port_stats[port], &port_hold_starts[port]);
+	device_call_exit();
+	return hybrid_mutex_give(registry_devices[port].mutex);
 }
 
-void port_mutex_take_all() {
+// Raises every port holder below DEVICE_DRAIN_PRIORITY to it, returning how many were raised.
+// Called with the scheduler suspended, so the holders can't change underneath
+static uint32_t device_callers_boost(void) {
+	uint32_t count = 0;
 	for (int i = 0; i < V5_MAX_DEVICE_PORTS; i++) {
-		port_mutex_take(i);
+		task_t const owner = hybrid_mutex_get_owner(registry_devices[i].mutex);
+		if (owner == NULL) continue;
+		uint32_t const priority = task_get_priority(owner);
+		// Also skips a task already raised for another port it holds, e.g. a motor group
+		if (priority >= DEVICE_DRAIN_PRIORITY) continue;
+		boosted_tasks[count] = owner;
+		boosted_priorities[count] = priority;
+		count++;
+		task_set_priority(owner, DEVICE_DRAIN_PRIORITY);
 	}
+	return count;
 }
 
-void port_mutex_give_all() {
-	for (int i = 0; i < V5_MAX_DEVICE_PORTS; i++) {
-		port_mutex_give(i);
+__pros_fast void port_mutex_take_all() {
+	bool const timed = port_stats_enabled;
+	uint32_t const wait_start = timed ? cycle_counter_get() : 0;
+	// Close the gate to new device calls, then wait for the active ones to return
+	mutex_take(device_gate, TIMEOUT_MAX);
+	rtos_suspend_all();
+	daemon_exclusive = true;
+	bool drain = daemon_draining = active_device_calls > 0;
+	uint32_t const boosted = drain ? device_callers_boost() : 0;
+	rtos_resume_all();
+	if (drain) sem_wait(device_drained, TIMEOUT_MAX);
+	// The daemon preempts the raised tasks as soon as the last call returns, so they get their priorities back
+	// before running any further
+	for (uint32_t i = 0; i < boosted; i++) task_set_priority(boosted_tasks[i], boosted_priorities[i]);
+	if (unlikely(timed)) port_stats_acquired(&daemon_port_stats, &daemon_hold_start, wait_start, drain);
+}
+
+__pros_fast void port_mutex_give_all() {
+	if (unlikely(daemon_hold_start)) port_stats_released(&daemon_port_stats, &daemon_hold_start);
+	daemon_exclusive = false;
+	mutex_give(device_gate);
+}
+
+// A read transaction holds the gate, so the daemon can't start its next cycle
+// until it ends. The device calls in between still take their ports as usual,
+// and they never wait on the daemon since it can't become exclusive
+static bool in_read_transaction(void) {
+	return mutex_get_owner(device_gate) == task_get_current();
+}
+
+int32_t vdml_read_begin(uint32_t port_mask) {
+	if (port_mask == 0 || port_mask >> NUM_V5_PORTS) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (in_read_transaction()) {
+		errno = EDEADLK;
+		return PROS_ERR;
+	}
+	// Waits out a cycle the daemon is in the middle of
+	mutex_take(device_gate, TIMEOUT_MAX);
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if ((port_mask & (1 << i)) && registry_get_plugged_type(i) == E_DEVICE_NONE &&
+		    registry_devices[i].replay_type == E_DEVICE_NONE) {
+			mutex_give(device_gate);
+			errno = ENODEV;
+			return PROS_ERR;
+		}
+	}
+	return 1;
+}
+
+int32_t vdml_read_end(void) {
+	if (!in_read_transaction()) {
+		errno = EPERM;
+		return PROS_ERR;
+	}
+	mutex_give(device_gate);
+	return 1;
+}
+
+void port_stats_enable(bool enable) {
+	port_stats_enabled = enable;
+}
+
+int32_t port_stats_get(uint8_t port, port_access_stats_s_t* const stats) {
+	if (!VALIDATE_PORT_NO_INTERNAL(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
 	}
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*stats = port_stats[port - 1];
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t port_stats_get_daemon(port_access_stats_s_t* const stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*stats = daemon_port_stats;
+	rtos_resume_all();
+	return 1;
+}
+
+void port_stats_reset(void) {
+	rtos_suspend_all();
+	memset(port_stats, 0, sizeof(port_stats));
+	memset(&daemon_port_stats, 0, sizeof(daemon_port_stats));
+	rtos_resume_all();
 }
 
 void vdml_set_port_error(uint8_t port) {
@@ -156,105 +392,232 @@ void vdml_reset_port_error() {
  *
  * Updates the registry type array, detecting what devices are actually
  * plugged in according to the system, then compares that with the registry
- * records.
+ * records of the ports which changed since the last call.
  *
  * On warnings, no operation is performed.
  */
 void vdml_background_processing() {
-	static int32_t last_port_errors = 0;
 	static int cycle = 0;
+	static uint32_t unplugged = 0, mismatched = 0;
+	static uint32_t shown_unplugged = 0, shown_mismatched = 0;
+	static bool shown = true;  // Whether the display has the current masks
 	cycle++;
+
+	// Move generic serial data between VEXos and the kernel's buffers
+	serial_rx_drain();
+	serial_tx_drain();
+
+	// Sample the ADI's encoders and any calibrations running in the background
+	adi_background_processing();
+
+	// Send the controllers' next screen and rumble updates
+	controller_output_flush();
+
+	// Refresh actual device types
+	uint32_t changed = registry_update_types();
+
 	if (cycle % 5000 == 0) {
 		vdml_reset_port_error();
-		last_port_errors = 0;
+		// Revalidate everything so the warnings are printed, and shown, again
+		changed = (1 << NUM_V5_PORTS) - 1;
+		shown = false;
 	}
 
-	// Refresh actual device types
-	registry_update_types();
+	// Validate the ports whose plugged type or binding changed. Warn if mismatch.
+	if (changed) {
+		motor_commands_forget(changed);
+		vision_signatures_forget(changed);
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(changed & (1 << i))) continue;
+			int32_t const error = registry_validate_binding(i, E_DEVICE_NONE);
+			if (error == 0) registry_mark_validated(i);
+			unplugged = error == 1 ? unplugged | (1 << i) : unplugged & ~(1 << i);
+			mismatched = error == 2 ? mismatched | (1 << i) : mismatched & ~(1 << i);
+		}
+	}
+	// The display daemon renders them, so the daemon only hands over the masks
+	// when they change, and at most every 50 ms
+	if (cycle % 50 == 0 && (!shown || unplugged != shown_unplugged || mismatched != shown_mismatched)) {
+		display_port_errors(unplugged, mismatched);
+		shown_unplugged = unplugged;
+		shown_mismatched = mismatched;
+		shown = true;
+	}
+}
 
-	// Validate the ports. Warn if mismatch.
-	uint8_t error_arr[NUM_V5_PORTS];
-	int num_errors = 0;
-	int mismatch_errors = 0;
+/**
+ * Tasks waiting in vdml_wait_for_update(), each on a semaphore on its own
+ * stack, and the semaphores from vdml_update_sem_create(). The list and the
+ * timestamps are only touched with the scheduler suspended.
+ */
+typedef struct update_waiter_s {
+	struct update_waiter_s* next;
+	uint32_t port_mask;
+	uint32_t updated;  // Set by the system daemon when it wakes the waiter
+	sem_t sem;
+	bool persistent;  // Posted on every update and left in the list
+} update_waiter_s_t;
+
+typedef struct update_sem_s {
+	update_waiter_s_t waiter;
+	static_sem_s_t sem_buf;
+} update_sem_s_t;
+
+static update_waiter_s_t* update_waiters;
+static uint32_t device_timestamps[NUM_V5_PORTS];
+static uint32_t pending_updates;
+uint32_t vdml_update_times[NUM_V5_PORTS];
+
+// Called with the scheduler suspended, right after VEXos has updated its device
+// data. Returns the ports with new data, where replayed ports only count the
+// frames replayed this cycle
+static uint32_t vdml_update_capture(uint32_t replayed) {
+	uint32_t const now = micros();
+	uint32_t updated = replayed;
 	for (int i = 0; i < NUM_V5_PORTS; i++) {
-		error_arr[i] = registry_validate_binding(i, E_DEVICE_NONE);
-		if (error_arr[i] != 0) num_errors++;
-		if (error_arr[i] == 2) mismatch_errors++;
-	}
-	// Every 50 ms
-	if (cycle % 50 == 0) {
-		if (last_port_errors == port_errors) {
-			goto end_render_errors;
+		if (replayed & (1 << i)) vdml_update_times[i] = now;
+		if (registry_get_plugged_type(i) == E_DEVICE_NONE || registry_devices[i].replay_type != E_DEVICE_NONE) continue;
+		uint32_t timestamp = vexDeviceGetTimestamp(registry_get_device(i)->device_info);
+		if (timestamp != device_timestamps[i]) {
+			device_timestamps[i] = timestamp;
+			vdml_update_times[i] = now;
+			updated |= 1 << i;
 		}
-		char line[50];
-		char* line_ptr = line;
-		if (num_errors == 0)
-			line[0] = (char)0;
-		else if (num_errors <= 6) {
-			// If we have 1-6 total errors (unplugged + mismatch), we can
-			// display a line indicating the ports where these errors occur
-			strcpy(line_ptr, "PORTS");
-			line_ptr += 5;  // 5 is length of "PORTS"
-			if (mismatch_errors != 0) {
-				strcpy(line_ptr, " MISMATCHED: ");
-				line_ptr += 13;  // 13 is length of previous string
-				for (int i = 0; i < NUM_V5_PORTS; i++) {
-					if (error_arr[i] == 2) {
-						line_ptr = print_num(line_ptr, i + 1);
-						*line_ptr++ = ',';
-					}
-				}
-				line_ptr--;
-			}
-			if (num_errors != mismatch_errors) {
-				strcpy(line_ptr, " UNPLUGGED: ");
-				line_ptr += 12;  // 12 is length of previous string
-				for (int i = 0; i < NUM_V5_PORTS; i++) {
-					if (error_arr[i] == 1) {
-						line_ptr = print_num(line_ptr, i + 1);
-						*line_ptr++ = ',';
-					}
-				}
-				line_ptr--;
-			}
+	}
+	pending_updates |= updated;
+	return updated;
+}
+
+uint32_t vdml_get_last_update(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	return vdml_update_times[port - 1];
+}
+
+void vdml_snapshot_capture(void) {
+	latency_probe_capture();
+	uint32_t replayed = vdml_replay_capture();
+	// First, so the snapshots can carry the update times
+	uint32_t updated = vdml_update_capture(replayed);
+	motor_snapshot_capture();
+	battery_snapshot_capture();
+	odom_update();
+	path_follow_update();
+	imu_buffer_capture();
+	imu_calibration_capture();
+	imu_group_capture();
+	vision_snapshot_capture();
+	controller_snapshot_capture();
+	device_driver_capture();
+	vdml_topics_capture();
+	vdml_record_capture(updated);
+	compiler_barrier();
+	vdml_snapshot_gen++;
+}
+
+void vdml_dispatch_updates(void) {
+	if (likely(!pending_updates)) return;
+	rtos_suspend_all();
+	uint32_t updates = pending_updates;
+	pending_updates = 0;
+	update_waiter_s_t** link = &update_waiters;
+	while (*link != NULL) {
+		update_waiter_s_t* waiter = *link;
+		if (waiter->persistent) {
+			// Already posted if its owner hasn't caught up yet
+			if (waiter->port_mask & updates) sem_post(waiter->sem);
+			link = &waiter->next;
+		} else if (waiter->port_mask & updates) {
+			waiter->updated = waiter->port_mask & updates;
+			*link = waiter->next;
+			sem_post(waiter->sem);
 		} else {
-			/* If we have > 6 errors, we display the following:
-			 * PORT ERRORS: 1..... 6..... 11..... 16.....
-			 * where each . represents a port. A '.' indicates
-			 * there is no error on that port, a 'U' indicates
-			 * the registry expected a device there but there isn't
-			 * one, and a 'M' indicates the plugged in devices doesn't
-			 * match what we expect. The numbers are just a visual reference
-			 * to aid in determining what ports have errors.
-			 */
-			strcpy(line_ptr, "PORT ERRORS:");
-			line_ptr += 12;  // 12 is length of previous string
-			for (int i = 0; i < NUM_V5_PORTS; i++) {
-				if (i % 5 == 0) {
-					*line_ptr++ = ' ';
-					line_ptr = print_num(line_ptr, i + 1);
-				}
-				switch (error_arr[i]) {
-					case 0:
-						*line_ptr++ = '.';
-						break;
-					case 1:
-						*line_ptr++ = 'U';
-						break;
-					case 2:
-						*line_ptr++ = 'M';
-						break;
-					// Should never happen
-					default:
-						*line_ptr++ = '?';
-						break;
-				}
-			}
+			link = &waiter->next;
+		}
+	}
+	rtos_resume_all();
+}
+
+uint32_t vdml_wait_for_update(uint32_t port_mask, uint32_t timeout) {
+	if (port_mask == 0 || port_mask >> NUM_V5_PORTS) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// No update can come while the caller holds the daemon off
+	if (in_read_transaction()) {
+		errno = EDEADLK;
+		return PROS_ERR;
+	}
+	static_sem_s_t sem_buf;
+	update_waiter_s_t waiter = {
+	    .port_mask = port_mask, .updated = 0, .sem = sem_create_static(1, 0, &sem_buf), .persistent = false};
+	rtos_suspend_all();
+	waiter.next = update_waiters;
+	update_waiters = &waiter;
+	rtos_resume_all();
+
+	sem_wait(waiter.sem, timeout);
+
+	rtos_suspend_all();
+	// The daemon unlinks the waiters it wakes, so only a timed out waiter is still in the list
+	if (!waiter.updated) {
+		update_waiter_s_t** link = &update_waiters;
+		while (*link != &waiter) link = &(*link)->next;
+		*link = waiter.next;
+	}
+	rtos_resume_all();
+	sem_delete(waiter.sem);
+
+	if (!waiter.updated) errno = ETIMEDOUT;
+	return waiter.updated;
+}
+
+sem_t vdml_update_sem_create(uint32_t port_mask, queue_set_t set) {
+	if (port_mask == 0 || port_mask >> NUM_V5_PORTS) {
+		errno = EINVAL;
+		return NULL;
+	}
+	update_sem_s_t* update_sem = kmalloc(sizeof(*update_sem));
+	if (update_sem == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	update_sem->waiter = (update_waiter_s_t){.port_mask = port_mask,
+	                                         .updated = 0,
+	                                         .sem = sem_create_static(1, 0, &update_sem->sem_buf),
+	                                         .persistent = true};
+	if (set != NULL && !queue_set_add(set, update_sem->waiter.sem)) {
+		sem_delete(update_sem->waiter.sem);
+		kfree(update_sem);
+		return NULL;
+	}
+	rtos_suspend_all();
+	update_sem->waiter.next = update_waiters;
+	update_waiters = &update_sem->waiter;
+	rtos_resume_all();
+	return update_sem->waiter.sem;
+}
+
+void vdml_update_sem_delete(sem_t sem, queue_set_t set) {
+	update_sem_s_t* update_sem = NULL;
+	rtos_suspend_all();
+	for (update_waiter_s_t** link = &update_waiters; *link != NULL; link = &(*link)->next) {
+		if ((*link)->persistent && (*link)->sem == sem) {
+			// The waiter is the first member of the update_sem_s_t
+			update_sem = (update_sem_s_t*)*link;
+			*link = (*link)->next;
+			break;
 		}
-		// Null terminate the string
-		*line_ptr = '\0';
-		display_error(line);
-	end_render_errors:
-		last_port_errors = port_errors;
 	}
+	rtos_resume_all();
+	if (update_sem == NULL) return;
+	if (set != NULL) {
+		// Nothing posts it any more, so once taken it stays empty
+		sem_wait(sem, 0);
+		queue_set_remove(set, sem);
+	}
+	sem_delete(sem);
+	kfree(update_sem);
 }
@@ -15,6 +15,7 @@
 #include <stdio.h>
 
 #include "kapi.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "vdml/registry.h"
 #include "vdml/vdml.h"
@@ -30,6 +31,11 @@
 // actual time that it takes.
 #define GYRO_CALIBRATION_TIME 1300
 
+// Analog calibrations average this many of the ADI's updates, which come about 10 ms apart
+#define ANALOG_CALIBRATION_SAMPLES 64
+// How long adi_calibration_wait() goes between checks if it misses an ADI update
+#define CALIBRATION_POLL_TIME 20
+
 typedef union adi_data {
 	struct {
 		int32_t calib;
@@ -46,6 +52,115 @@ typedef union adi_data {
 	} gyro_data;
 } adi_data_s_t;
 
+/**
+ * The configuration of each port as last set through the kernel, so that
+ * reads don't have to ask VEXos every time. It is kept in the ADI's pad after
+ * the ports' adi_data_s_t and filled from VEXos the first time it's used.
+ * Only accessed with the ADI's port mutex held.
+ */
+typedef struct adi_config_cache_s {
+	uint8_t configs[NUM_ADI_PORTS];
+	bool loaded;
+} adi_config_cache_s_t;
+
+_Static_assert(sizeof(adi_data_s_t) * NUM_ADI_PORTS + sizeof(adi_config_cache_s_t) <=
+                   REGISTRY_PAD_SIZE,
+               "The ADI's data doesn't fit in a device's pad");
+
+static adi_config_cache_s_t* adi_config_cache(v5_smart_device_s_t* device) {
+	adi_config_cache_s_t* cache = (adi_config_cache_s_t*)&((adi_data_s_t*)(device->pad))[NUM_ADI_PORTS];
+	if (!cache->loaded) {
+		for (int i = 0; i < NUM_ADI_PORTS; i++) {
+			cache->configs[i] = (uint8_t)vexDeviceAdiPortConfigGet(device->device_info, i);
+		}
+		cache->loaded = true;
+	}
+	return cache;
+}
+
+static inline adi_port_config_e_t adi_config_get(v5_smart_device_s_t* device, uint8_t port) {
+	return (adi_port_config_e_t)adi_config_cache(device)->configs[port];
+}
+
+// The port's value, or its recorded value while the ADI is replayed, see vdml_replay.c.
+// Only the brain's ADI is recorded, so expanders always read their own values
+static inline int32_t adi_value_get(v5_smart_device_s_t* device, uint8_t port) {
+	if (vdml_replaying(INTERNAL_ADI_PORT, E_DEVICE_ADI) && device == registry_get_device_internal(INTERNAL_ADI_PORT)) {
+		return vdml_replay_adi(port);
+	}
+	return vexDeviceAdiValueGet(device->device_info, port);
+}
+
+static void adi_config_set(v5_smart_device_s_t* device, uint8_t port, adi_port_config_e_t config) {
+	adi_config_cache_s_t* cache = adi_config_cache(device);
+	vexDeviceAdiPortConfigSet(device->device_info, port, (V5_AdiPortConfiguration)config);
+	cache->configs[port] = (uint8_t)config;
+}
+
+/**
+ * Calibrations which the system daemon runs in the background, one per port.
+ * They are started with the ADI's port mutex held and advanced by the daemon
+ * while it holds every port mutex, so the two never overlap.
+ */
+typedef struct adi_calibration_s {
+	uint32_t total;     // The sum of an analog calibration's samples so far
+	uint32_t deadline;  // When a gyro calibration finishes, in milliseconds
+	int32_t result;     // What adi_calibration_wait() returns once it's done
+	uint16_t samples;
+	bool gyro;
+	volatile adi_calibration_status_e_t status;
+} adi_calibration_s_t;
+
+/**
+ * The velocity of each encoder, indexed by its top port. The system daemon
+ * differentiates every new reading against the last one, using the time the
+ * ADI took them at, and smooths the result with an exponential filter. Only
+ * accessed with the ADI's port mutex held, like the calibrations.
+ */
+typedef struct adi_encoder_velocity_s {
+	int32_t last_count;
+	uint32_t last_time;  // The ADI's timestamp of last_count in milliseconds
+	float velocity;      // In ticks per second
+	float alpha;         // The weight of each new reading in velocity, 0 for the default
+	bool primed;         // Whether last_count holds a reading yet
+} adi_encoder_velocity_s_t;
+
+#define ENCODER_VELOCITY_DEFAULT_ALPHA 0.5f
+
+/**
+ * The latest readings of each ultrasonic, indexed by half its ping port. Every
+ * time the ADI sends a new reading the system daemon adds it to the ring, then
+ * works out the median of each window size at once by inserting the readings
+ * newest first into a sorted list, so adi_ultrasonic_get_filtered() only has
+ * to look one up. Only accessed with the ADI's port mutex held.
+ */
+typedef struct adi_ultrasonic_filter_s {
+	int32_t samples[ADI_ULTRASONIC_WINDOW_MAX];  // A ring of the latest readings
+	int32_t medians[ADI_ULTRASONIC_WINDOW_MAX];  // medians[i] is the median of the latest i + 1 readings
+	uint8_t next;                                // Where the next reading goes in samples
+	uint8_t count;                               // How many readings samples holds
+} adi_ultrasonic_filter_s_t;
+
+/**
+ * What the system daemon keeps for each ADI, the brain's own or an expander's,
+ * indexed by its smart port. These don't fit in the ADI's pad.
+ */
+typedef struct adi_state_s {
+	adi_calibration_s_t calibrations[NUM_ADI_PORTS];
+	adi_encoder_velocity_s_t encoder_velocities[NUM_ADI_PORTS];
+	adi_ultrasonic_filter_s_t ultrasonic_filters[NUM_ADI_PORTS / 2];
+	uint32_t timestamp;   // The ADI's timestamp in the last daemon cycle
+	uint8_t calibrating;  // A bit for each port whose calibration is running
+} adi_state_s_t;
+
+static adi_state_s_t adi_states[NUM_V5_PORTS];
+// A bit for each smart port which has been used as an ADI, so the daemon only looks at those
+static uint32_t adi_devices = 1 << INTERNAL_ADI_PORT;
+
+static inline void adi_device_mark(uint8_t smart) {
+	if (unlikely(!(adi_devices & (1 << smart)))) __atomic_fetch_or(&adi_devices, 1 << smart, __ATOMIC_RELAXED);
+}
+
 #define transform_adi_port(port)       \
 	if (port >= 'a' && port <= 'h')      \
 		port -= 'a';                       \
@@ -58,18 +173,41 @@ typedef union adi_data {
 		return PROS_ERR;                   \
 	}
 
-#define validate_type(device, port, type)                                                                 \
-	adi_port_config_e_t config = (adi_port_config_e_t)vexDeviceAdiPortConfigGet(device->device_info, port); \
-	if (config != type) {                                                                                   \
-		errno = EADDRINUSE;                                                                                   \
-		return PROS_ERR;                                                                                      \
+// Claims the ADI on a smart port from 1-22, where 22 is the brain's own
+// three-wire ports, and declares smart as its index in the registry
+#define claim_adi(smart_port)             \
+	uint8_t const smart = (smart_port) - 1; \
+	claim_port_i(smart, E_DEVICE_ADI);      \
+	adi_device_mark(smart);
+
+/**
+ * Encoders, ultrasonics and gyros are referred to by their port plus one, with
+ * the smart port of an expander in the byte above. The brain's ADI leaves that
+ * byte 0, so its handles are just the port as they've always been.
+ */
+#define adi_handle(smart, port) ((smart) == INTERNAL_ADI_PORT ? (port) + 1 : (((smart) + 1) << 8) | ((port) + 1))
+
+// Splits a handle into the smart_port and port it was made from
+#define transform_adi_handle(handle)                         \
+	uint8_t smart_port = (uint32_t)(handle) >> 8;              \
+	if (smart_port == 0) smart_port = ADI_INTERNAL_SMART_PORT; \
+	uint8_t port = (handle) & 0xff;                            \
+	transform_adi_port(port);
+
+#define validate_type(device, port, type)                        \
+	adi_port_config_e_t config = adi_config_get(device, port);     \
+	if (config != type) {                                          \
+		port_mutex_give(smart);                                      \
+		errno = EADDRINUSE;                                          \
+		return PROS_ERR;                                             \
 	}
 
-#define validate_motor(device, port)                                                                      \
-	adi_port_config_e_t config = (adi_port_config_e_t)vexDeviceAdiPortConfigGet(device->device_info, port); \
-	if (config != E_ADI_LEGACY_PWM && config != E_ADI_LEGACY_SERVO) {                                       \
-		errno = EADDRINUSE;                                                                                   \
-		return PROS_ERR;                                                                                      \
+#define validate_motor(device, port)                                \
+	adi_port_config_e_t config = adi_config_get(device, port);        \
+	if (config != E_ADI_LEGACY_PWM && config != E_ADI_LEGACY_SERVO) { \
+		port_mutex_give(smart);                                         \
+		errno = EADDRINUSE;                                             \
+		return PROS_ERR;                                                \
 	}
 
 #define validate_twowire(port_top, port_bottom) \
@@ -91,198 +229,440 @@ typedef union adi_data {
 		return PROS_ERR;                            \
 	}
 
-adi_port_config_e_t adi_port_get_config(uint8_t port) {
+// Checks that every port in the mask has the configuration, so that the batched
+// writes either change every port or none of them
+#define validate_mask(device, mask, valid)                     \
+	for (int port = 0; port < NUM_ADI_PORTS; port++) {           \
+		if (!(mask & (1 << port))) continue;                       \
+		adi_port_config_e_t config = adi_config_get(device, port); \
+		if (!(valid)) {                                            \
+			port_mutex_give(smart);                                  \
+			errno = EADDRINUSE;                                      \
+			return PROS_ERR;                                         \
+		}                                                          \
+	}
+
+adi_port_config_e_t ext_adi_port_get_config(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	adi_port_config_e_t rtn = (adi_port_config_e_t)vexDeviceAdiPortConfigGet(device->device_info, port);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	claim_adi(smart_port);
+	adi_port_config_e_t rtn = adi_config_get(device, port);
+	return_port(smart, rtn);
 }
 
-int32_t adi_port_get_value(uint8_t port) {
+int32_t ext_adi_port_get_value(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	int32_t rtn = vexDeviceAdiValueGet(device->device_info, port);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	claim_adi(smart_port);
+	int32_t rtn = adi_value_get(device, port);
+	return_port(smart, rtn);
 }
 
-int32_t adi_port_set_config(uint8_t port, adi_port_config_e_t type) {
+int32_t ext_adi_port_set_config(uint8_t smart_port, uint8_t port, adi_port_config_e_t type) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	vexDeviceAdiPortConfigSet(device->device_info, port, (V5_AdiPortConfiguration)type);
-	return_port(INTERNAL_ADI_PORT, 1);
+	claim_adi(smart_port);
+	adi_config_set(device, port, type);
+	return_port(smart, 1);
 }
 
-int32_t adi_port_set_value(uint8_t port, int32_t value) {
+int32_t ext_adi_port_set_value(uint8_t smart_port, uint8_t port, int32_t value) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	vexDeviceAdiValueSet(device->device_info, port, value);
-	return_port(INTERNAL_ADI_PORT, 1);
+	return_port(smart, 1);
 }
 
-int32_t adi_analog_calibrate(uint8_t port) {
+int32_t ext_adi_read_all(uint8_t smart_port, int32_t values[NUM_ADI_PORTS]) {
+	if (values == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_adi(smart_port);
+	for (int port = 0; port < NUM_ADI_PORTS; port++) {
+		adi_port_config_e_t config = adi_config_get(device, port);
+		int32_t value = adi_value_get(device, port);
+		// Give each port's value the way its own read function would
+		adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
+		if (config == E_ADI_LEGACY_ENCODER && adi_data->encoder_data.reversed) {
+			value = -value;
+		} else if (config == E_ADI_LEGACY_PWM || config == E_ADI_LEGACY_SERVO) {
+			value -= ADI_MOTOR_MAX_SPEED;
+		}
+		values[port] = value;
+	}
+	return_port(smart, 1);
+}
+
+static void calibration_start(adi_state_s_t* state, uint8_t port, bool gyro) {
+	state->calibrations[port] = (adi_calibration_s_t){.deadline = millis() + GYRO_CALIBRATION_TIME,
+	                                                  .gyro = gyro,
+	                                                  .status = E_ADI_CALIBRATION_RUNNING};
+	state->calibrating |= 1 << port;
+}
+
+static void calibration_finish(adi_state_s_t* state, uint8_t port, adi_calibration_status_e_t status, int32_t result) {
+	state->calibrations[port].result = result;
+	state->calibrating &= ~(1 << port);
+	compiler_barrier();
+	state->calibrations[port].status = status;
+}
+
+// Keeps the filter's configuration, but starts the estimate over
+static void encoder_velocity_reset(adi_state_s_t* state, uint8_t port) {
+	state->encoder_velocities[port] = (adi_encoder_velocity_s_t){.alpha = state->encoder_velocities[port].alpha};
+}
+
+static void encoder_velocity_update(v5_smart_device_s_t* device, adi_state_s_t* state, uint8_t port,
+                                    uint32_t timestamp) {
+	adi_encoder_velocity_s_t* const vel = &state->encoder_velocities[port];
+	int32_t count = adi_value_get(device, port);
+	if (((adi_data_s_t*)(device->pad))[port].encoder_data.reversed) count = -count;
+	uint32_t dt = timestamp - vel->last_time;
+	if (vel->primed && dt > 0) {
+		float reading = (float)(count - vel->last_count) * 1000.0f / (float)dt;
+		float alpha = vel->alpha > 0 ? vel->alpha : ENCODER_VELOCITY_DEFAULT_ALPHA;
+		vel->velocity += alpha * (reading - vel->velocity);
+	}
+	vel->last_count = count;
+	vel->last_time = timestamp;
+	vel->primed = true;
+}
+
+static void ultrasonic_filter_update(v5_smart_device_s_t* device, adi_state_s_t* state, uint8_t port) {
+	adi_ultrasonic_filter_s_t* const filter = &state->ultrasonic_filters[port / 2];
+	filter->samples[filter->next] = adi_value_get(device, port);
+	filter->next = (filter->next + 1) % ADI_ULTRASONIC_WINDOW_MAX;
+	if (filter->count < ADI_ULTRASONIC_WINDOW_MAX) filter->count++;
+
+	int32_t sorted[ADI_ULTRASONIC_WINDOW_MAX];
+	uint8_t i = filter->next;
+	for (uint8_t n = 0; n < filter->count; n++) {
+		i = (i + ADI_ULTRASONIC_WINDOW_MAX - 1) % ADI_ULTRASONIC_WINDOW_MAX;
+		int32_t const sample = filter->samples[i];
+		uint8_t j = n;
+		for (; j > 0 && sorted[j - 1] > sample; j--) sorted[j] = sorted[j - 1];
+		sorted[j] = sample;
+		// An even window has two middle readings, so take the point halfway between them
+		filter->medians[n] = n % 2 ? (sorted[n / 2] + sorted[n / 2 + 1]) / 2 : sorted[n / 2];
+	}
+}
+
+static void adi_device_processing(v5_smart_device_s_t* device, adi_state_s_t* state) {
+	// Only take samples when the ADI has sent new values, so that none is counted twice
+	uint32_t timestamp = vexDeviceGetTimestamp(device->device_info);
+	bool updated = timestamp != state->timestamp;
+	state->timestamp = timestamp;
+
+	if (updated) {
+		for (uint8_t port = 0; port < NUM_ADI_PORTS; port += 2) {
+			adi_port_config_e_t config = adi_config_get(device, port);
+			if (config == E_ADI_LEGACY_ENCODER) {
+				encoder_velocity_update(device, state, port, timestamp);
+			} else if (config == E_ADI_LEGACY_ULTRASONIC) {
+				ultrasonic_filter_update(device, state, port);
+			}
+		}
+	}
+
+	if (likely(!state->calibrating)) return;
+	for (uint8_t port = 0; port < NUM_ADI_PORTS; port++) {
+		if (!(state->calibrating & (1 << port))) continue;
+		adi_calibration_s_t* const cal = &state->calibrations[port];
+		adi_port_config_e_t config = adi_config_get(device, port);
+		if (config != (cal->gyro ? E_ADI_LEGACY_GYRO : E_ADI_ANALOG_IN)) {
+			// The port was reconfigured in the meantime
+			calibration_finish(state, port, E_ADI_CALIBRATION_NONE, 0);
+		} else if (cal->gyro) {
+			// VEXos calibrates gyros by itself, so just wait for it to be done
+			if ((int32_t)(millis() - cal->deadline) >= 0) calibration_finish(state, port, E_ADI_CALIBRATION_DONE, 1);
+		} else if (updated) {
+			cal->total += adi_value_get(device, port);
+			if (++cal->samples == ANALOG_CALIBRATION_SAMPLES) {
+				adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
+				// Kept 16 times finer for adi_analog_read_calibrated_HR()
+				adi_data->analog_data.calib =
+				    (int32_t)((cal->total * 16 + ANALOG_CALIBRATION_SAMPLES / 2) / ANALOG_CALIBRATION_SAMPLES);
+				calibration_finish(state, port, E_ADI_CALIBRATION_DONE,
+				                   (int32_t)((cal->total + ANALOG_CALIBRATION_SAMPLES / 2) / ANALOG_CALIBRATION_SAMPLES));
+			}
+		}
+	}
+}
+
+// Called by the system daemon every cycle while it holds every port mutex
+void adi_background_processing(void) {
+	uint32_t devices = adi_devices;
+	while (devices) {
+		uint8_t const smart = __builtin_ctz(devices);
+		devices &= devices - 1;
+		// An unplugged expander has nothing to sample, and the brain's ADI is always there
+		if (smart != INTERNAL_ADI_PORT && registry_get_plugged_type(smart) != E_DEVICE_ADI) continue;
+		adi_device_processing(registry_get_device(smart), &adi_states[smart]);
+	}
+}
+
+int32_t ext_adi_analog_calibrate_async(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_ANALOG_IN);
-	uint32_t total = 0;
-	for (uint32_t i = 0; i < 512; i++) {
-		total += vexDeviceAdiValueGet(device->device_info, port);
-		task_delay(1); // TODO: If smart ports (and the ADI) only update every 10ms, this really only reads 56 samples, maybe change to a 10ms
+	calibration_start(&adi_states[smart], port, false);
+	return_port(smart, 1);
+}
+
+adi_calibration_status_e_t ext_adi_calibration_get_status(uint8_t smart_port, uint8_t port) {
+	transform_adi_port(port);
+	if (smart_port < 1 || smart_port > NUM_V5_PORTS) {
+		errno = ENXIO;
+		return PROS_ERR;
 	}
-	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
-	adi_data->analog_data.calib = (int32_t)((total + 16) >> 5);
-	return_port(INTERNAL_ADI_PORT, (int32_t)((total + 256) >> 9));
+	return adi_states[smart_port - 1].calibrations[port].status;
 }
 
-int32_t adi_analog_read(uint8_t port) {
+int32_t ext_adi_calibration_wait(uint8_t smart_port, uint8_t port, uint32_t timeout) {
+	transform_adi_port(port);
+	if (smart_port < 1 || smart_port > NUM_V5_PORTS) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	adi_calibration_s_t* const cal = &adi_states[smart_port - 1].calibrations[port];
+	if (cal->status == E_ADI_CALIBRATION_RUNNING && xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+		// The system daemon can't advance the calibration yet
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	uint32_t start = millis();
+	while (cal->status == E_ADI_CALIBRATION_RUNNING) {
+		uint32_t elapsed = millis() - start;
+		if (timeout != TIMEOUT_MAX && elapsed >= timeout) {
+			errno = ETIMEDOUT;
+			return PROS_ERR;
+		}
+		uint32_t wait = CALIBRATION_POLL_TIME;
+		if (timeout != TIMEOUT_MAX && timeout - elapsed < wait) wait = timeout - elapsed;
+		// The daemon takes its samples just before it wakes the tasks waiting on the ADI
+		vdml_wait_for_update(1 << (smart_port - 1), wait);
+	}
+	if (cal->status != E_ADI_CALIBRATION_DONE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return cal->result;
+}
+
+int32_t ext_adi_analog_calibrate(uint8_t smart_port, uint8_t port) {
+	int32_t rtn = ext_adi_analog_calibrate_async(smart_port, port);
+	return rtn == PROS_ERR ? PROS_ERR : ext_adi_calibration_wait(smart_port, port, TIMEOUT_MAX);
+}
+
+int32_t ext_adi_analog_read(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_ANALOG_IN);
-	int32_t rtn = vexDeviceAdiValueGet(device->device_info, port);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	int32_t rtn = adi_value_get(device, port);
+	return_port(smart, rtn);
 }
 
-int32_t adi_analog_read_calibrated(uint8_t port) {
+int32_t ext_adi_analog_read_calibrated(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_ANALOG_IN);
 	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
-	int32_t rtn = (vexDeviceAdiValueGet(device->device_info, port) - (adi_data->analog_data.calib >> 4));
-	return_port(INTERNAL_ADI_PORT, rtn);
+	int32_t rtn = (adi_value_get(device, port) - (adi_data->analog_data.calib >> 4));
+	return_port(smart, rtn);
 }
 
-int32_t adi_analog_read_calibrated_HR(uint8_t port) {
+int32_t ext_adi_analog_read_calibrated_HR(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_ANALOG_IN);
 	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
-	int32_t rtn = ((vexDeviceAdiValueGet(device->device_info, port) << 4) - adi_data->analog_data.calib);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	int32_t rtn = ((adi_value_get(device, port) << 4) - adi_data->analog_data.calib);
+	return_port(smart, rtn);
 }
 
-int32_t adi_digital_read(uint8_t port) {
+int32_t ext_adi_digital_read(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_DIGITAL_IN);
-	int32_t rtn = vexDeviceAdiValueGet(device->device_info, port);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	int32_t rtn = adi_value_get(device, port);
+	return_port(smart, rtn);
 }
 
-int32_t adi_digital_get_new_press(uint8_t port) {
+int32_t ext_adi_digital_get_new_press(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_DIGITAL_IN);
 
 	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
 
-	int32_t pressed = vexDeviceAdiValueGet(device->device_info, port);
+	int32_t pressed = adi_value_get(device, port);
 
 	if (!pressed)
 		adi_data->digital_data.was_pressed = false;
 	else if (!adi_data->digital_data.was_pressed) {
 		// Button is currently pressed and was not detected as being pressed during last check
 		adi_data->digital_data.was_pressed = true;
-		return_port(INTERNAL_ADI_PORT, true);
+		return_port(smart, true);
 	}
 
-	return_port(INTERNAL_ADI_PORT, false);
+	return_port(smart, false);
 }
 
-int32_t adi_digital_write(uint8_t port, const bool value) {
+int32_t ext_adi_digital_write(uint8_t smart_port, uint8_t port, const bool value) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_type(device, port, E_ADI_DIGITAL_OUT);
 	vexDeviceAdiValueSet(device->device_info, port, (int32_t)value);
-	return_port(INTERNAL_ADI_PORT, 1);
+	return_port(smart, 1);
 }
 
-int32_t adi_pin_mode(uint8_t port, uint8_t mode) {
+int32_t ext_adi_digital_write_mask(uint8_t smart_port, uint8_t mask, uint8_t values) {
+	claim_adi(smart_port);
+	validate_mask(device, mask, config == E_ADI_DIGITAL_OUT);
+	// The daemon can't send the ADI's outputs while it's held, so these all go out together
+	for (int port = 0; port < NUM_ADI_PORTS; port++) {
+		if (mask & (1 << port)) vexDeviceAdiValueSet(device->device_info, port, (values >> port) & 1);
+	}
+	return_port(smart, 1);
+}
+
+int32_t ext_adi_pin_mode(uint8_t smart_port, uint8_t port, uint8_t mode) {
 	switch (mode) {
 		case INPUT:
-			adi_port_set_config(port, E_ADI_DIGITAL_IN);
-			break;
+			return ext_adi_port_set_config(smart_port, port, E_ADI_DIGITAL_IN);
 		case OUTPUT:
-			adi_port_set_config(port, E_ADI_DIGITAL_OUT);
-			break;
+			return ext_adi_port_set_config(smart_port, port, E_ADI_DIGITAL_OUT);
 		case INPUT_ANALOG:
-			adi_port_set_config(port, E_ADI_ANALOG_IN);
-			break;
+			return ext_adi_port_set_config(smart_port, port, E_ADI_ANALOG_IN);
 		case OUTPUT_ANALOG:
-			adi_port_set_config(port, E_ADI_ANALOG_OUT);
-			break;
+			return ext_adi_port_set_config(smart_port, port, E_ADI_ANALOG_OUT);
 		default:
 			errno = EINVAL;
 			return PROS_ERR;
 	};
-	return 1;
 }
 
-int32_t adi_motor_set(uint8_t port, int8_t speed) {
+int32_t ext_adi_motor_set(uint8_t smart_port, uint8_t port, int8_t speed) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_motor(device, port);
 	if (speed > ADI_MOTOR_MAX_SPEED)
 		speed = ADI_MOTOR_MAX_SPEED;
 	else if (speed < ADI_MOTOR_MIN_SPEED)
 		speed = ADI_MOTOR_MIN_SPEED;
 	vexDeviceAdiValueSet(device->device_info, port, speed);
-	return_port(INTERNAL_ADI_PORT, 1);
+	return_port(smart, 1);
 }
 
-int32_t adi_motor_get(uint8_t port) {
+int32_t ext_adi_motor_set_mask(uint8_t smart_port, uint8_t mask, const int8_t speeds[NUM_ADI_PORTS]) {
+	if (speeds == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_adi(smart_port);
+	validate_mask(device, mask, config == E_ADI_LEGACY_PWM || config == E_ADI_LEGACY_SERVO);
+	for (int port = 0; port < NUM_ADI_PORTS; port++) {
+		if (mask & (1 << port)) vexDeviceAdiValueSet(device->device_info, port, speeds[port]);
+	}
+	return_port(smart, 1);
+}
+
+int32_t ext_adi_motor_get(uint8_t smart_port, uint8_t port) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
 	validate_motor(device, port);
-	int32_t rtn = vexDeviceAdiValueGet(device->device_info, port) - ADI_MOTOR_MAX_SPEED;
-	return_port(INTERNAL_ADI_PORT, rtn);
+	int32_t rtn = adi_value_get(device, port) - ADI_MOTOR_MAX_SPEED;
+	return_port(smart, rtn);
 }
 
-int32_t adi_motor_stop(uint8_t port) {
-	return adi_motor_set(port, 0);
+int32_t ext_adi_motor_stop(uint8_t smart_port, uint8_t port) {
+	return ext_adi_motor_set(smart_port, port, 0);
 }
 
-adi_encoder_t adi_encoder_init(uint8_t port_top, uint8_t port_bottom, const bool reverse) {
+// Reads an encoder for the odometry without taking the ADI, for the system
+// daemon while it holds every port mutex. Returns false if the port isn't
+// configured as an encoder. Only the brain's own ports are used for odometry.
+bool adi_encoder_sample(uint8_t port, int32_t* count) {
+	v5_smart_device_s_t* device = registry_get_device(INTERNAL_ADI_PORT);
+	if (port >= NUM_ADI_PORTS || adi_config_get(device, port) != E_ADI_LEGACY_ENCODER) return false;
+	*count = adi_value_get(device, port);
+	if (((adi_data_s_t*)(device->pad))[port].encoder_data.reversed) *count = -*count;
+	return true;
+}
+
+adi_encoder_t ext_adi_encoder_init(uint8_t smart_port, uint8_t port_top, uint8_t port_bottom, const bool reverse) {
 	transform_adi_port(port_top);
 	transform_adi_port(port_bottom);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
 	validate_twowire(port_top, port_bottom);
+	claim_adi(smart_port);
 
 	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
 	adi_data->encoder_data.reversed = reverse;
-	vexDeviceAdiPortConfigSet(device->device_info, port, E_ADI_LEGACY_ENCODER);
-	return_port(INTERNAL_ADI_PORT, port + 1);
+	adi_config_set(device, port, E_ADI_LEGACY_ENCODER);
+	encoder_velocity_reset(&adi_states[smart], port);
+	return_port(smart, adi_handle(smart, port));
 }
 
 int32_t adi_encoder_get(adi_encoder_t enc) {
-	transform_adi_port(enc);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, enc, E_ADI_LEGACY_ENCODER);
-	
+	transform_adi_handle(enc);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ENCODER);
+
 	int32_t rtn;
-	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[enc];
-	if (adi_data->encoder_data.reversed) rtn = -vexDeviceAdiValueGet(device->device_info, enc);
-	else rtn = vexDeviceAdiValueGet(device->device_info, enc);
-	return_port(INTERNAL_ADI_PORT, rtn);
+	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
+	if (adi_data->encoder_data.reversed) rtn = -adi_value_get(device, port);
+	else rtn = adi_value_get(device, port);
+	return_port(smart, rtn);
 }
 
 int32_t adi_encoder_reset(adi_encoder_t enc) {
-	transform_adi_port(enc);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, enc, E_ADI_LEGACY_ENCODER);
-	
-	vexDeviceAdiValueSet(device->device_info, enc, 0);
-	return_port(INTERNAL_ADI_PORT, 1);
+	transform_adi_handle(enc);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ENCODER);
+
+	vexDeviceAdiValueSet(device->device_info, port, 0);
+	// Differentiate the next reading against the new zero rather than the old count
+	adi_states[smart].encoder_velocities[port].last_count = 0;
+	return_port(smart, 1);
+}
+
+// Internal wrapper for adi_encoder_get_velocity, like _adi_gyro_get
+int32_t _adi_encoder_get_velocity(adi_encoder_t enc, double* out) {
+	transform_adi_handle(enc);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ENCODER);
+
+	*out = adi_states[smart].encoder_velocities[port].velocity;
+	return_port(smart, 1);
+}
+
+double adi_encoder_get_velocity(adi_encoder_t enc) {
+	double rtn;
+	if (_adi_encoder_get_velocity(enc, &rtn) == PROS_ERR) return PROS_ERR_F;
+	else return rtn;
+}
+
+int32_t adi_encoder_set_velocity_filter(adi_encoder_t enc, double alpha) {
+	if (!(alpha > 0 && alpha <= 1)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	transform_adi_handle(enc);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ENCODER);
+
+	adi_states[smart].encoder_velocities[port].alpha = (float)alpha;
+	return_port(smart, 1);
 }
 
 int32_t adi_encoder_shutdown(adi_encoder_t enc) {
-	transform_adi_port(enc);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, enc, E_ADI_LEGACY_ENCODER);
+	transform_adi_handle(enc);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ENCODER);
 
-	vexDeviceAdiPortConfigSet(device->device_info, enc, E_ADI_TYPE_UNDEFINED);
-	return_port(INTERNAL_ADI_PORT, 1);
+	adi_config_set(device, port, E_ADI_TYPE_UNDEFINED);
+	return_port(smart, 1);
 }
 
-adi_ultrasonic_t adi_ultrasonic_init(uint8_t port_ping, uint8_t port_echo) {
+adi_ultrasonic_t ext_adi_ultrasonic_init(uint8_t smart_port, uint8_t port_ping, uint8_t port_echo) {
 	transform_adi_port(port_ping);
 	transform_adi_port(port_echo);
 	validate_twowire(port_ping, port_echo);
@@ -291,67 +671,97 @@ adi_ultrasonic_t adi_ultrasonic_init(uint8_t port_ping, uint8_t port_echo) {
 		return PROS_ERR;
 	}
 
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	vexDeviceAdiPortConfigSet(device->device_info, port, E_ADI_LEGACY_ULTRASONIC);
-	return_port(INTERNAL_ADI_PORT, port + 1);
+	claim_adi(smart_port);
+	adi_config_set(device, port, E_ADI_LEGACY_ULTRASONIC);
+	adi_states[smart].ultrasonic_filters[port / 2] = (adi_ultrasonic_filter_s_t){0};
+	return_port(smart, adi_handle(smart, port));
 }
 
 int32_t adi_ultrasonic_get(adi_ultrasonic_t ult) {
-	transform_adi_port(ult);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, ult, E_ADI_LEGACY_ULTRASONIC);
-	
-	int32_t rtn = vexDeviceAdiValueGet(device->device_info, ult);
-	return_port(ult, rtn);
+	transform_adi_handle(ult);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ULTRASONIC);
+
+	int32_t rtn = adi_value_get(device, port);
+	return_port(smart, rtn);
+}
+
+int32_t adi_ultrasonic_get_filtered(adi_ultrasonic_t ult, uint8_t window) {
+	if (window == 0 || window > ADI_ULTRASONIC_WINDOW_MAX) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	transform_adi_handle(ult);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ULTRASONIC);
+
+	adi_ultrasonic_filter_s_t* const filter = &adi_states[smart].ultrasonic_filters[port / 2];
+	if (filter->count == 0) {
+		port_mutex_give(smart);
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	// Until the ring fills, the window is as many readings as there are
+	int32_t rtn = filter->medians[(window < filter->count ? window : filter->count) - 1];
+	return_port(smart, rtn);
 }
 
 int32_t adi_ultrasonic_shutdown(adi_ultrasonic_t ult) {
-	transform_adi_port(ult);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, ult, E_ADI_LEGACY_ULTRASONIC);
+	transform_adi_handle(ult);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_ULTRASONIC);
 
-	vexDeviceAdiPortConfigSet(device->device_info, ult, E_ADI_TYPE_UNDEFINED);
-	return_port(INTERNAL_ADI_PORT, 1);
+	adi_config_set(device, port, E_ADI_TYPE_UNDEFINED);
+	return_port(smart, 1);
 }
 
-adi_gyro_t adi_gyro_init(uint8_t port, double multiplier) {
+adi_gyro_t ext_adi_gyro_init_async(uint8_t smart_port, uint8_t port, double multiplier) {
 	transform_adi_port(port);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
+	claim_adi(smart_port);
+	adi_state_s_t* const state = &adi_states[smart];
 
 	if (multiplier == 0) multiplier = 1;
 	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
 	adi_data->gyro_data.multiplier = multiplier;
 	adi_data->gyro_data.tare_value = 0;
 
-	adi_port_config_e_t config = vexDeviceAdiPortConfigGet(device->device_info, port);
+	adi_port_config_e_t config = adi_config_get(device, port);
 	if (config == E_ADI_LEGACY_GYRO) {
-		// Port has already been calibrated, no need to do that again
-		return_port(INTERNAL_ADI_PORT, port + 1);
+		// Port has already been calibrated, or is being calibrated, no need to do that again
+		if (state->calibrations[port].status != E_ADI_CALIBRATION_RUNNING) {
+			calibration_finish(state, port, E_ADI_CALIBRATION_DONE, 1);
+		}
+		return_port(smart, adi_handle(smart, port));
 	}
 
-	vexDeviceAdiPortConfigSet(device->device_info, port, E_ADI_LEGACY_GYRO);
-	if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+	adi_config_set(device, port, E_ADI_LEGACY_GYRO);
+	calibration_start(state, port, true);
+	return_port(smart, adi_handle(smart, port));
+}
+
+adi_gyro_t ext_adi_gyro_init(uint8_t smart_port, uint8_t port, double multiplier) {
+	adi_gyro_t gyro = ext_adi_gyro_init_async(smart_port, port, multiplier);
+	if (gyro != PROS_ERR && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
 		// If the scheduler is currently running (meaning that this is not called
-		// from a global constructor, for example) then delay for the duration of
-		// the calibration time in VexOS.
-		delay(GYRO_CALIBRATION_TIME);
+		// from a global constructor, for example) then wait for VEXos to finish
+		// calibrating. The ADI isn't held meanwhile, so other ports can be used.
+		ext_adi_calibration_wait(smart_port, port, TIMEOUT_MAX);
 	}
-
-	return_port(INTERNAL_ADI_PORT, port + 1);
+	return gyro;
 }
 
 // Internal wrapper for adi_gyro_get to get around transform_adi_port, claim_port_i, validate_type and return_port possibly returning PROS_ERR, not PROS_ERR_F
 int32_t _adi_gyro_get(adi_gyro_t gyro, double* out) {
-	transform_adi_port(gyro);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, gyro, E_ADI_LEGACY_GYRO);
+	transform_adi_handle(gyro);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_GYRO);
 
-	double rtn = (double)vexDeviceAdiValueGet(device->device_info, gyro);
-	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[gyro];
+	double rtn = (double)adi_value_get(device, port);
+	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
 	rtn -= adi_data->gyro_data.tare_value;
 	rtn *= adi_data->gyro_data.multiplier;
 	*out = rtn;
-	return_port(INTERNAL_ADI_PORT, 1);
+	return_port(smart, 1);
 }
 
 double adi_gyro_get(adi_gyro_t gyro) {
@@ -361,20 +771,122 @@ double adi_gyro_get(adi_gyro_t gyro) {
 }
 
 int32_t adi_gyro_reset(adi_gyro_t gyro) {
-	transform_adi_port(gyro);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, gyro, E_ADI_LEGACY_GYRO);
+	transform_adi_handle(gyro);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_GYRO);
 
-	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[gyro];
-	adi_data->gyro_data.tare_value = vexDeviceAdiValueGet(device->device_info, gyro);
-	return_port(INTERNAL_ADI_PORT, 1);
+	adi_data_s_t* const adi_data = &((adi_data_s_t*)(device->pad))[port];
+	adi_data->gyro_data.tare_value = adi_value_get(device, port);
+	return_port(smart, 1);
 }
 
 int32_t adi_gyro_shutdown(adi_gyro_t gyro) {
-	transform_adi_port(gyro);
-	claim_port_i(INTERNAL_ADI_PORT, E_DEVICE_ADI);
-	validate_type(device, gyro, E_ADI_LEGACY_GYRO);
+	transform_adi_handle(gyro);
+	claim_adi(smart_port);
+	validate_type(device, port, E_ADI_LEGACY_GYRO);
+
+	adi_config_set(device, port, E_ADI_TYPE_UNDEFINED);
+	return_port(smart, 1);
+}
+
+// The adi.h functions are the ones for the brain's own ADI
+
+adi_port_config_e_t adi_port_get_config(uint8_t port) {
+	return ext_adi_port_get_config(ADI_INTERNAL_SMART_PORT, port);
+}
 
-	vexDeviceAdiPortConfigSet(device->device_info, gyro, E_ADI_TYPE_UNDEFINED);
-	return_port(INTERNAL_ADI_PORT, 1);
-}
\ No newline at end of file
+int32_t adi_port_get_value(uint8_t port) {
+	return ext_adi_port_get_value(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_port_set_config(uint8_t port, adi_port_config_e_t type) {
+	return ext_adi_port_set_config(ADI_INTERNAL_SMART_PORT, port, type);
+}
+
+int32_t adi_port_set_value(uint8_t port, int32_t value) {
+	return ext_adi_port_set_value(ADI_INTERNAL_SMART_PORT, port, value);
+}
+
+int32_t adi_read_all(int32_t values[NUM_ADI_PORTS]) {
+	return ext_adi_read_all(ADI_INTERNAL_SMART_PORT, values);
+}
+
+int32_t adi_analog_calibrate(uint8_t port) {
+	return ext_adi_analog_calibrate(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_analog_calibrate_async(uint8_t port) {
+	return ext_adi_analog_calibrate_async(ADI_INTERNAL_SMART_PORT, port);
+}
+
+adi_calibration_status_e_t adi_calibration_get_status(uint8_t port) {
+	return ext_adi_calibration_get_status(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_calibration_wait(uint8_t port, uint32_t timeout) {
+	return ext_adi_calibration_wait(ADI_INTERNAL_SMART_PORT, port, timeout);
+}
+
+int32_t adi_analog_read(uint8_t port) {
+	return ext_adi_analog_read(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_analog_read_calibrated(uint8_t port) {
+	return ext_adi_analog_read_calibrated(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_analog_read_calibrated_HR(uint8_t port) {
+	return ext_adi_analog_read_calibrated_HR(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_digital_read(uint8_t port) {
+	return ext_adi_digital_read(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_digital_get_new_press(uint8_t port) {
+	return ext_adi_digital_get_new_press(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_digital_write(uint8_t port, const bool value) {
+	return ext_adi_digital_write(ADI_INTERNAL_SMART_PORT, port, value);
+}
+
+int32_t adi_digital_write_mask(uint8_t mask, uint8_t values) {
+	return ext_adi_digital_write_mask(ADI_INTERNAL_SMART_PORT, mask, values);
+}
+
+int32_t adi_pin_mode(uint8_t port, uint8_t mode) {
+	return ext_adi_pin_mode(ADI_INTERNAL_SMART_PORT, port, mode);
+}
+
+int32_t adi_motor_set(uint8_t port, int8_t speed) {
+	return ext_adi_motor_set(ADI_INTERNAL_SMART_PORT, port, speed);
+}
+
+int32_t adi_motor_set_mask(uint8_t mask, const int8_t speeds[NUM_ADI_PORTS]) {
+	return ext_adi_motor_set_mask(ADI_INTERNAL_SMART_PORT, mask, speeds);
+}
+
+int32_t adi_motor_get(uint8_t port) {
+	return ext_adi_motor_get(ADI_INTERNAL_SMART_PORT, port);
+}
+
+int32_t adi_motor_stop(uint8_t port) {
+	return ext_adi_motor_stop(ADI_INTERNAL_SMART_PORT, port);
+}
+
+adi_encoder_t adi_encoder_init(uint8_t port_top, uint8_t port_bottom, const bool reverse) {
+	return ext_adi_encoder_init(ADI_INTERNAL_SMART_PORT, port_top, port_bottom, reverse);
+}
+
+adi_ultrasonic_t adi_ultrasonic_init(uint8_t port_ping, uint8_t port_echo) {
+	return ext_adi_ultrasonic_init(ADI_INTERNAL_SMART_PORT, port_ping, port_echo);
+}
+
+adi_gyro_t adi_gyro_init_async(uint8_t port, double multiplier) {
+	return ext_adi_gyro_init_async(ADI_INTERNAL_SMART_PORT, port, multiplier);
+}
+
+adi_gyro_t adi_gyro_init(uint8_t port, double multiplier) {
+	return ext_adi_gyro_init(ADI_INTERNAL_SMART_PORT, port, multiplier);
+}
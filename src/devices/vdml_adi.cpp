@@ -20,64 +20,121 @@ ADIPort::ADIPort(std::uint8_t port, adi_port_config_e_t type) : _port(port) {
 	adi_port_set_config(_port, type);
 }
 
+ADIPort::ADIPort(ext_adi_port_pair_t port_pair, adi_port_config_e_t type)
+    : _smart_port(port_pair.first), _port(port_pair.second) {
+	ext_adi_port_set_config(_smart_port, _port, type);
+}
+
 ADIPort::ADIPort(void) {
 	// for use by derived classes like ADIEncoder
 }
 
 std::int32_t ADIPort::set_config(adi_port_config_e_t type) const {
-	return adi_port_set_config(_port, type);
+	return ext_adi_port_set_config(_smart_port, _port, type);
 }
 
 std::int32_t ADIPort::get_config(void) const {
-	return adi_port_get_config(_port);
+	return ext_adi_port_get_config(_smart_port, _port);
 }
 
 std::int32_t ADIPort::set_value(std::int32_t value) const {
-	return adi_port_set_value(_port, value);
+	return ext_adi_port_set_value(_smart_port, _port, value);
 }
 
 std::int32_t ADIPort::get_value(void) const {
-	return adi_port_get_value(_port);
+	return ext_adi_port_get_value(_smart_port, _port);
+}
+
+std::int32_t ADIPort::read_all(std::int32_t values[NUM_ADI_PORTS]) {
+	return adi_read_all(values);
+}
+
+std::int32_t ADIPort::read_all(std::uint8_t smart_port, std::int32_t values[NUM_ADI_PORTS]) {
+	return ext_adi_read_all(smart_port, values);
+}
+
+std::int32_t ADIPort::set_digital_mask(std::uint8_t mask, std::uint8_t values) {
+	return adi_digital_write_mask(mask, values);
+}
+
+std::int32_t ADIPort::set_digital_mask(std::uint8_t smart_port, std::uint8_t mask, std::uint8_t values) {
+	return ext_adi_digital_write_mask(smart_port, mask, values);
+}
+
+std::int32_t ADIPort::set_motor_mask(std::uint8_t mask, const std::int8_t speeds[NUM_ADI_PORTS]) {
+	return adi_motor_set_mask(mask, speeds);
+}
+
+std::int32_t ADIPort::set_motor_mask(std::uint8_t smart_port, std::uint8_t mask,
+                                     const std::int8_t speeds[NUM_ADI_PORTS]) {
+	return ext_adi_motor_set_mask(smart_port, mask, speeds);
 }
 
 ADIAnalogIn::ADIAnalogIn(std::uint8_t port) : ADIPort(port, E_ADI_ANALOG_IN) {}
 
+ADIAnalogIn::ADIAnalogIn(ext_adi_port_pair_t port_pair) : ADIPort(port_pair, E_ADI_ANALOG_IN) {}
+
 ADIAnalogOut::ADIAnalogOut(std::uint8_t port) : ADIPort(port, E_ADI_ANALOG_OUT) {}
 
+ADIAnalogOut::ADIAnalogOut(ext_adi_port_pair_t port_pair) : ADIPort(port_pair, E_ADI_ANALOG_OUT) {}
+
 std::int32_t ADIAnalogIn::calibrate(void) const {
-	return adi_analog_calibrate(_port);
+	return ext_adi_analog_calibrate(_smart_port, _port);
+}
+
+std::int32_t ADIAnalogIn::calibrate_async(void) const {
+	return ext_adi_analog_calibrate_async(_smart_port, _port);
+}
+
+std::int32_t ADIAnalogIn::wait_for_calibration(std::uint32_t timeout) const {
+	return ext_adi_calibration_wait(_smart_port, _port, timeout);
 }
 
 std::int32_t ADIAnalogIn::get_value_calibrated(void) const {
-	return adi_analog_read_calibrated(_port);
+	return ext_adi_analog_read_calibrated(_smart_port, _port);
 }
 
 std::int32_t ADIAnalogIn::get_value_calibrated_HR(void) const {
-	return adi_analog_read_calibrated_HR(_port);
+	return ext_adi_analog_read_calibrated_HR(_smart_port, _port);
 }
 
 ADIDigitalOut::ADIDigitalOut(std::uint8_t port, bool init_state) : ADIPort(port, E_ADI_DIGITAL_OUT) {
 	set_value(init_state);
 }
 
+ADIDigitalOut::ADIDigitalOut(ext_adi_port_pair_t port_pair, bool init_state) : ADIPort(port_pair, E_ADI_DIGITAL_OUT) {
+	set_value(init_state);
+}
+
 ADIDigitalIn::ADIDigitalIn(std::uint8_t port) : ADIPort(port, E_ADI_DIGITAL_IN) {}
 
+ADIDigitalIn::ADIDigitalIn(ext_adi_port_pair_t port_pair) : ADIPort(port_pair, E_ADI_DIGITAL_IN) {}
+
 std::int32_t ADIDigitalIn::get_new_press(void) const {
-	return adi_digital_get_new_press(_port);
+	return ext_adi_digital_get_new_press(_smart_port, _port);
 }
 
 ADIMotor::ADIMotor(std::uint8_t port) : ADIPort(port, E_ADI_LEGACY_PWM) {
 	stop();
 }
 
+ADIMotor::ADIMotor(ext_adi_port_pair_t port_pair) : ADIPort(port_pair, E_ADI_LEGACY_PWM) {
+	stop();
+}
+
 std::int32_t ADIMotor::stop(void) const {
-	return adi_motor_stop(_port);
+	return ext_adi_motor_stop(_smart_port, _port);
 }
 
 ADIEncoder::ADIEncoder(std::uint8_t port_top, std::uint8_t port_bottom, bool reversed) {
 	_port = adi_encoder_init(port_top, port_bottom, reversed);
 }
 
+ADIEncoder::ADIEncoder(ext_adi_port_tuple_t port_tuple, bool reversed) {
+	_smart_port = std::get<0>(port_tuple);
+	_port = ext_adi_encoder_init(_smart_port, std::get<1>(port_tuple), std::get<2>(port_tuple), reversed);
+}
+
 std::int32_t ADIEncoder::reset(void) const {
 	return adi_encoder_reset(_port);
 }
@@ -86,14 +143,36 @@ std::int32_t ADIEncoder::get_value(void) const {
 	return adi_encoder_get(_port);
 }
 
+double ADIEncoder::get_velocity(void) const {
+	return adi_encoder_get_velocity(_port);
+}
+
+std::int32_t ADIEncoder::set_velocity_filter(double alpha) const {
+	return adi_encoder_set_velocity_filter(_port, alpha);
+}
+
 ADIUltrasonic::ADIUltrasonic(std::uint8_t port_ping, std::uint8_t port_echo) {
 	_port = adi_ultrasonic_init(port_ping, port_echo);
 }
 
+ADIUltrasonic::ADIUltrasonic(ext_adi_port_tuple_t port_tuple) {
+	_smart_port = std::get<0>(port_tuple);
+	_port = ext_adi_ultrasonic_init(_smart_port, std::get<1>(port_tuple), std::get<2>(port_tuple));
+}
+
+std::int32_t ADIUltrasonic::get_value_filtered(std::uint8_t window) const {
+	return adi_ultrasonic_get_filtered(_port, window);
+}
+
 ADIGyro::ADIGyro(std::uint8_t port, double multiplier) {
 	_port = adi_gyro_init(port, multiplier);
 }
 
+ADIGyro::ADIGyro(ext_adi_port_pair_t port_pair, double multiplier) {
+	_smart_port = port_pair.first;
+	_port = ext_adi_gyro_init(_smart_port, port_pair.second, multiplier);
+}
+
 double ADIGyro::get_value(void) const {
 	return adi_gyro_get(_port);
 }
@@ -0,0 +1,130 @@
+/**
+ * \file devices/vdml_driver.c
+ *
+ * Device drivers polled by the system daemon
+ *
+ * device_driver_capture() runs from vdml_snapshot_capture() with the scheduler
+ * suspended, while the daemon holds every port. It binds each smart port to
+ * the driver for the type plugged into it, unbinding whatever was there
+ * before, and polls the bound ports. The snapshots are written in place: the
+ * capture bumps vdml_snapshot_gen once it's done, so a reader preempted in the
+ * middle of a copy sees the change and copies again.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+// The smart ports, as the built-in ADI can't have another device plugged in
+#define DRIVER_PORTS (NUM_V5_PORTS - 1)
+
+typedef struct device_driver_entry {
+	v5_device_e_t type;
+	device_driver_s_t ops;
+	uint8_t* snapshots;  // DRIVER_PORTS of ops.snapshot_size each
+} device_driver_entry_s_t;
+
+// Only added to with the scheduler suspended, and never removed
+static device_driver_entry_s_t drivers[DEVICE_DRIVER_MAX];
+static uint32_t driver_count;
+static device_driver_entry_s_t* bound[DRIVER_PORTS];
+
+static inline void* driver_snapshot(const device_driver_entry_s_t* driver, int port) {
+	return driver->snapshots == NULL ? NULL : driver->snapshots + port * driver->ops.snapshot_size;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void device_driver_capture(void) {
+	if (likely(!driver_count)) return;
+	for (int i = 0; i < DRIVER_PORTS; i++) {
+		v5_device_e_t const type = registry_get_plugged_type(i);
+		device_driver_entry_s_t* driver = NULL;
+		for (uint32_t d = 0; d < driver_count; d++) {
+			if (drivers[d].type == type) {
+				driver = &drivers[d];
+				break;
+			}
+		}
+		device_driver_entry_s_t* const old = bound[i];
+		if (unlikely(old != driver)) {
+			if (old != NULL && old->ops.on_unbind != NULL) old->ops.on_unbind(i + 1);
+			bound[i] = driver;
+			if (driver != NULL) {
+				if (driver->snapshots != NULL) memset(driver_snapshot(driver, i), 0, driver->ops.snapshot_size);
+				if (driver->ops.on_bind != NULL) driver->ops.on_bind(i + 1, driver_snapshot(driver, i));
+			}
+		}
+		if (driver != NULL && driver->ops.on_poll_cycle != NULL) {
+			driver->ops.on_poll_cycle(i + 1, driver_snapshot(driver, i));
+		}
+	}
+}
+
+int32_t device_driver_register(v5_device_e_t type, const device_driver_s_t* driver) {
+	if (driver == NULL || type == E_DEVICE_NONE || type == E_DEVICE_UNDEFINED) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	uint8_t* snapshots = NULL;
+	if (driver->snapshot_size) {
+		snapshots = kmalloc(DRIVER_PORTS * driver->snapshot_size);
+		if (snapshots == NULL) {
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+	}
+	rtos_suspend_all();
+	int32_t error = 0;
+	for (uint32_t d = 0; d < driver_count; d++) {
+		if (drivers[d].type == type) error = EEXIST;
+	}
+	if (!error && driver_count == DEVICE_DRIVER_MAX) error = ENOSPC;
+	if (!error) {
+		drivers[driver_count].type = type;
+		drivers[driver_count].ops = *driver;
+		drivers[driver_count].snapshots = snapshots;
+		driver_count++;
+	}
+	rtos_resume_all();
+	if (error) {
+		kfree(snapshots);
+		errno = error;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t device_driver_get_snapshot(uint8_t port, void* dest, size_t size) {
+	if (!VALIDATE_PORT_NO(port - 1) || port == NUM_V5_PORTS) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	uint32_t gen;
+	do {
+		gen = vdml_snapshot_gen;
+		compiler_barrier();
+		const device_driver_entry_s_t* const driver = bound[port - 1];
+		if (driver == NULL) {
+			errno = ENODEV;
+			return PROS_ERR;
+		}
+		if (dest == NULL || size > driver->ops.snapshot_size) {
+			errno = EINVAL;
+			return PROS_ERR;
+		}
+		memcpy(dest, driver_snapshot(driver, port - 1), size);
+		compiler_barrier();
+	} while (gen != vdml_snapshot_gen);
+	return 1;
+}
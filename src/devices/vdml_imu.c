@@ -11,7 +11,9 @@
  */
 
 #include <errno.h>
+#include "kapi.h"
 #include "pros/imu.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "vdml/registry.h"
 #include "vdml/vdml.h"
@@ -22,14 +24,108 @@
 		return_port(port - 1, err_return);                                         \
 	}
 
-int32_t imu_reset(uint8_t port) {
+// Gives the recorded reading while the port is replayed, see vdml_replay.c
+#define return_replayed(port, field) \
+	if (vdml_replaying(port - 1, E_DEVICE_IMU)) return vdml_replay_imu(port - 1)->field
+
+// How long a reset has to show up as calibrating before the daemon gives up on it
+#define IMU_CALIBRATION_START_TIME 1000
+
+/**
+ * Calibrations started through the kernel. The system daemon watches the
+ * ports in imu_calibrating and sets a port's bit in imu_calibrated once
+ * VEXos has reported it calibrating and then stopped, which wakes the tasks in
+ * imu_wait_calibrated(). The masks and start times are only changed with the
+ * scheduler suspended.
+ */
+static uint32_t imu_calibrated_storage[EVENT_GROUP_STORAGE_SIZE / 4];
+static event_group_t imu_calibrated;
+static volatile uint32_t imu_calibrating;
+static uint32_t imu_calibration_seen;  // Ports which VEXos has reported calibrating
+static uint32_t imu_calibration_starts[NUM_V5_PORTS];
+
+// Every port counts as calibrated until the kernel starts calibrating it
+static event_group_t calibration_group(void) {
+	rtos_suspend_all();
+	if (imu_calibrated == NULL) {
+		imu_calibrated = event_group_create_static(imu_calibrated_storage);
+		event_group_set(imu_calibrated, (1 << NUM_V5_PORTS) - 1);
+	}
+	rtos_resume_all();
+	return imu_calibrated;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void imu_calibration_capture(void) {
+	uint32_t const mask = imu_calibrating;
+	if (likely(!mask)) return;
+	uint32_t finished = 0;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(mask & (1 << i))) continue;
+		// An unplugged sensor won't finish, so let its waiters find out from the getters
+		if (registry_get_plugged_type(i) == E_DEVICE_IMU) {
+			if (vexDeviceImuStatusGet(registry_get_device(i)->device_info) & E_IMU_STATUS_CALIBRATING) {
+				imu_calibration_seen |= 1 << i;
+				continue;
+			}
+			// VEXos takes a few readings to report a reset
+			if (!(imu_calibration_seen & (1 << i)) && millis() - imu_calibration_starts[i] < IMU_CALIBRATION_START_TIME) {
+				continue;
+			}
+		}
+		finished |= 1 << i;
+	}
+	if (!finished) return;
+	imu_calibrating &= ~finished;
+	imu_calibration_seen &= ~finished;
+	event_group_set(imu_calibrated, finished);
+}
+
+int32_t imu_reset_async(uint8_t port) {
+	event_group_t const group = calibration_group();
 	claim_port_i(port - 1, E_DEVICE_IMU);
 	ERROR_IMU_STILL_CALIBRATING(port, device, PROS_ERR);
 	vexDeviceImuReset(device->device_info);
+	rtos_suspend_all();
+	event_group_clear(group, 1 << (port - 1));
+	imu_calibration_seen &= ~(1 << (port - 1));
+	imu_calibration_starts[port - 1] = millis();
+	imu_calibrating |= 1 << (port - 1);
+	rtos_resume_all();
 	return_port(port - 1, 1);
 }
 
+int32_t imu_reset(uint8_t port) {
+	return imu_reset_async(port);
+}
+
+int32_t imu_wait_calibrated(uint32_t port_mask, uint32_t timeout) {
+	if (port_mask == 0 || port_mask >> NUM_V5_PORTS) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Nothing can wait before the scheduler starts, and the daemon isn't running to finish them
+	if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	event_group_t const group = calibration_group();
+	uint32_t const bits = event_group_wait(group, port_mask, true, false, timeout);
+	if ((bits & port_mask) != port_mask) {
+		errno = ETIMEDOUT;
+		return PROS_ERR;
+	}
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if ((port_mask & (1 << i)) && registry_get_plugged_type(i) != E_DEVICE_IMU) {
+			errno = ENODEV;
+			return PROS_ERR;
+		}
+	}
+	return 1;
+}
+
 double imu_get_rotation(uint8_t port) {
+	return_replayed(port, rotation);
 	claim_port_f(port - 1, E_DEVICE_IMU);
 	ERROR_IMU_STILL_CALIBRATING(port, device, PROS_ERR_F);
 	double rtn = vexDeviceImuHeadingGet(device->device_info);
@@ -37,6 +133,7 @@ double imu_get_rotation(uint8_t port) {
 }
 
 double imu_get_heading(uint8_t port) {
+	return_replayed(port, heading);
 	claim_port_f(port - 1, E_DEVICE_IMU);
 	ERROR_IMU_STILL_CALIBRATING(port, device, PROS_ERR_F);
 	double rtn = vexDeviceImuDegreesGet(device->device_info);
@@ -47,6 +144,7 @@ double imu_get_heading(uint8_t port) {
 	{ .x = PROS_ERR_F, .y = PROS_ERR_F, .z = PROS_ERR_F, .w = PROS_ERR_F }
 
 quaternion_s_t imu_get_quaternion(uint8_t port) {
+	return_replayed(port, quaternion);
 	quaternion_s_t rtn = QUATERNION_ERR_INIT;
 	v5_smart_device_s_t* device;
 	if (!claim_port_try(port - 1, E_DEVICE_IMU)) {
@@ -70,6 +168,7 @@ quaternion_s_t imu_get_quaternion(uint8_t port) {
 	{ .pitch = PROS_ERR_F, .roll = PROS_ERR_F, .yaw = PROS_ERR_F }
 
 euler_s_t imu_get_euler(uint8_t port) {
+	return_replayed(port, euler);
 	euler_s_t rtn = ATTITUDE_ERR_INIT;
 	v5_smart_device_s_t* device;
 	if (!claim_port_try(port - 1, E_DEVICE_IMU)) {
@@ -96,6 +195,7 @@ double imu_get_yaw(uint8_t port) {
 #define RAW_IMU_ERR_INIT {.x = PROS_ERR_F, .y = PROS_ERR_F, .z = PROS_ERR_F};
 
 imu_gyro_s_t imu_get_gyro_rate(uint8_t port) {
+	return_replayed(port, gyro_rate);
 	imu_gyro_s_t rtn = RAW_IMU_ERR_INIT;
 	v5_smart_device_s_t* device;
 	if (!claim_port_try(port - 1, E_DEVICE_IMU)) {
@@ -115,6 +215,7 @@ imu_gyro_s_t imu_get_gyro_rate(uint8_t port) {
 }
 
 imu_accel_s_t imu_get_accel(uint8_t port) {
+	return_replayed(port, accel);
 	imu_accel_s_t rtn = RAW_IMU_ERR_INIT;
 	v5_smart_device_s_t* device;
 	if (!claim_port_try(port - 1, E_DEVICE_IMU)) {
@@ -142,3 +243,112 @@ imu_status_e_t imu_get_status(uint8_t port) {
 	rtn = vexDeviceImuStatusGet(device->device_info);
 	return_port(port - 1, rtn);
 }
+
+// Fills everything but the port, for a device whose port is held. Also used by
+// vdml_record_capture()
+void imu_state_read(V5_DeviceT device_info, imu_state_s_t* const state) {
+	V5_DeviceImuQuaternion qt;
+	V5_DeviceImuAttitude attitude;
+	// read into the SDK's own types, since pointers into packed PROS structs may be unaligned
+	V5_DeviceImuRaw raw;
+	state->rotation = vexDeviceImuHeadingGet(device_info);
+	state->heading = vexDeviceImuDegreesGet(device_info);
+	// Shuffled into {x,y,z,w} like imu_get_quaternion() does
+	vexDeviceImuQuaternionGet(device_info, &qt);
+	state->quaternion.x = qt.b;
+	state->quaternion.y = qt.c;
+	state->quaternion.z = qt.d;
+	state->quaternion.w = qt.a;
+	vexDeviceImuAttitudeGet(device_info, &attitude);
+	state->euler = (euler_s_t){.pitch = attitude.pitch, .roll = attitude.roll, .yaw = attitude.yaw};
+	vexDeviceImuRawGyroGet(device_info, &raw);
+	state->gyro_rate = (imu_gyro_s_t){.x = raw.x, .y = raw.y, .z = raw.z};
+	vexDeviceImuRawAccelGet(device_info, &raw);
+	state->accel = (imu_accel_s_t){.x = raw.x, .y = raw.y, .z = raw.z};
+	state->timestamp = vexDeviceGetTimestamp(device_info);
+}
+
+int32_t imu_get_state(uint8_t port, imu_state_s_t* const state) {
+	if (state == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (vdml_replaying(port - 1, E_DEVICE_IMU)) {
+		vdml_snapshot_read(state, vdml_replay_imu(port - 1));
+		state->port = port;
+		return 1;
+	}
+	claim_port_i(port - 1, E_DEVICE_IMU);
+	ERROR_IMU_STILL_CALIBRATING(port, device, PROS_ERR);
+	imu_state_read(device->device_info, state);
+	state->port = port;
+	state->updated_us = vdml_update_times[port - 1];
+	return_port(port - 1, 1);
+}
+
+// Single producer (the daemon) single consumer ring of samples, like the motor telemetry buffer
+static imu_state_s_t imu_buffer[IMU_BUFFER_SIZE];
+static volatile uint32_t imu_buffer_head;  // Written by the daemon
+static volatile uint32_t imu_buffer_tail;  // Written by the reader
+static volatile uint32_t imu_buffer_mask;
+static volatile uint32_t imu_buffer_dropped;
+static uint32_t imu_timestamps[NUM_V5_PORTS];
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void imu_buffer_capture(void) {
+	uint32_t mask = imu_buffer_mask;
+	if (likely(!mask)) return;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(mask & (1 << i)) || registry_get_plugged_type(i) != E_DEVICE_IMU) continue;
+		V5_DeviceT device_info = registry_get_device(i)->device_info;
+		uint32_t timestamp = vexDeviceGetTimestamp(device_info);
+		if (timestamp == imu_timestamps[i] || (vexDeviceImuStatusGet(device_info) & E_IMU_STATUS_CALIBRATING)) {
+			continue;
+		}
+		imu_timestamps[i] = timestamp;
+		uint32_t head = imu_buffer_head;
+		if (head - imu_buffer_tail >= IMU_BUFFER_SIZE) {
+			imu_buffer_dropped++;
+			continue;
+		}
+		imu_state_s_t* sample = &imu_buffer[head % IMU_BUFFER_SIZE];
+		imu_state_read(device_info, sample);
+		sample->port = i + 1;
+		sample->updated_us = vdml_update_times[i];
+		compiler_barrier();
+		imu_buffer_head = head + 1;
+	}
+}
+
+int32_t imu_buffer_enable(uint32_t port_mask) {
+	if ((port_mask >> NUM_V5_PORTS) != 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	imu_buffer_mask = port_mask;
+	imu_buffer_dropped = 0;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t imu_buffer_read(imu_state_s_t* const buffer, uint32_t count) {
+	if (buffer == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	uint32_t tail = imu_buffer_tail;
+	uint32_t available = imu_buffer_head - tail;
+	if (count > available) count = available;
+	compiler_barrier();
+	for (uint32_t i = 0; i < count; i++) {
+		buffer[i] = imu_buffer[(tail + i) % IMU_BUFFER_SIZE];
+	}
+	compiler_barrier();
+	imu_buffer_tail = tail + count;
+	return count;
+}
+
+uint32_t imu_buffer_get_dropped(void) {
+	return imu_buffer_dropped;
+}
@@ -17,6 +17,10 @@ std::int32_t Imu::reset() const {
 	return pros::c::imu_reset(_port);
 }
 
+std::int32_t Imu::wait_calibrated(std::uint32_t timeout) const {
+	return pros::c::imu_wait_calibrated(1 << (_port - 1), timeout);
+}
+
 double Imu::get_rotation() const {
     return pros::c::imu_get_rotation(_port);
 }
@@ -60,4 +64,8 @@ pros::c::imu_status_e_t Imu::get_status() const {
 bool Imu::is_calibrating() const {
 	return get_status() & pros::c::E_IMU_STATUS_CALIBRATING;
 }
+
+std::int32_t Imu::get_state(pros::c::imu_state_s_t* const state) const {
+	return pros::c::imu_get_state(_port, state);
+}
 }  // namespace pros
@@ -0,0 +1,232 @@
+/**
+ * \file devices/vdml_imu_group.c
+ *
+ * Fusion of several Inertial Sensors into one heading
+ *
+ * imu_group_capture() runs from vdml_snapshot_capture() with the scheduler
+ * suspended, while the daemon holds every port. For each group it turns each
+ * sensor's new rotation into a rate, fuses the rates and integrates the result
+ * over the daemon cycle, then publishes the group's state for
+ * vdml_snapshot_read(). Groups are only linked, unlinked and changed with the
+ * scheduler suspended too.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "pros/imu.h"
+#include "v5_api.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+// Readings further apart than this don't give a rate, e.g. after a cable glitch
+#define IMU_GROUP_MAX_SAMPLE_GAP 100
+// How much of the difference between a still sensor's rate and its bias is
+// learned per reading. The sensors update every 10 ms, so the bias settles
+// within a few seconds of the robot stopping
+#define IMU_GROUP_BIAS_GAIN 0.005
+
+typedef struct imu_group_sensor {
+	uint8_t port;  // 0-20
+	bool primed;   // Whether last_rotation and last_time are from a valid reading
+	bool has_rate;
+	double last_rotation;
+	uint32_t last_time;  // The sensor's timestamp of last_rotation
+	double rate;         // The latest rate in degrees per second, bias not taken off
+	double bias;
+} imu_group_sensor_s_t;
+
+typedef struct imu_group {
+	struct imu_group* next;
+	uint8_t count;
+	bool started;  // Whether rotation has been integrated yet
+	uint32_t last_us;
+	double rotation;
+	double rate;
+	imu_group_sensor_s_t sensors[IMU_GROUP_MAX_SENSORS];
+	imu_group_state_s_t published;
+} imu_group_s_t;
+
+static imu_group_s_t* imu_groups;
+
+// Reads a sensor's rotation and timestamp, returning false if it has none to give
+static bool sensor_read(uint8_t port, double* rotation, uint32_t* time) {
+	if (vdml_replaying(port, E_DEVICE_IMU)) {
+		const imu_state_s_t* const state = vdml_replay_imu(port);
+		*rotation = state->rotation;
+		*time = state->timestamp;
+		return true;
+	}
+	if (registry_get_plugged_type(port) != E_DEVICE_IMU) return false;
+	V5_DeviceT device_info = registry_get_device(port)->device_info;
+	if (vexDeviceImuStatusGet(device_info) & E_IMU_STATUS_CALIBRATING) return false;
+	*rotation = vexDeviceImuHeadingGet(device_info);
+	*time = vexDeviceGetTimestamp(device_info);
+	return true;
+}
+
+static void sensor_update(imu_group_sensor_s_t* sensor) {
+	double rotation;
+	uint32_t time;
+	if (!sensor_read(sensor->port, &rotation, &time)) {
+		sensor->primed = sensor->has_rate = false;
+		return;
+	}
+	if (sensor->primed && time == sensor->last_time) return;
+	uint32_t const dt = time - sensor->last_time;
+	sensor->has_rate = sensor->primed && dt <= IMU_GROUP_MAX_SAMPLE_GAP;
+	if (sensor->has_rate) sensor->rate = (rotation - sensor->last_rotation) * 1000.0 / dt;
+	sensor->last_rotation = rotation;
+	sensor->last_time = time;
+	sensor->primed = true;
+}
+
+static void group_update(imu_group_s_t* group, uint32_t now_us) {
+	double rates[IMU_GROUP_MAX_SENSORS];
+	double sorted[IMU_GROUP_MAX_SENSORS];
+	int n = 0;
+	for (int i = 0; i < group->count; i++) {
+		imu_group_sensor_s_t* const sensor = &group->sensors[i];
+		sensor_update(sensor);
+		rates[i] = sensor->rate - sensor->bias;
+		if (!sensor->has_rate) continue;
+		// Insertion sort, there are only a few
+		int j = n++;
+		for (; j > 0 && sorted[j - 1] > rates[i]; j--) sorted[j] = sorted[j - 1];
+		sorted[j] = rates[i];
+	}
+	if (n == 0) {
+		group->started = false;
+		return;
+	}
+
+	double median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+	// Two sensors which disagree have the same distance from their mean, so
+	// trust the one closer to where the group was heading
+	if (n == 2 && sorted[1] - sorted[0] > 2 * IMU_GROUP_OUTLIER_RATE) {
+		median = fabs(sorted[0] - group->rate) < fabs(sorted[1] - group->rate) ? sorted[0] : sorted[1];
+	}
+	double total = 0;
+	int fused = 0;
+	uint8_t rejected = 0;
+	for (int i = 0; i < group->count; i++) {
+		if (!group->sensors[i].has_rate) continue;
+		if (fabs(rates[i] - median) > IMU_GROUP_OUTLIER_RATE) {
+			rejected |= 1 << i;
+			continue;
+		}
+		total += rates[i];
+		fused++;
+	}
+	group->rate = total / fused;
+
+	// Learn each sensor's drift while the robot is still
+	if (fabs(median) < IMU_GROUP_STILL_RATE) {
+		for (int i = 0; i < group->count; i++) {
+			imu_group_sensor_s_t* const sensor = &group->sensors[i];
+			if (sensor->has_rate) sensor->bias += IMU_GROUP_BIAS_GAIN * (sensor->rate - sensor->bias);
+		}
+	}
+
+	if (group->started) group->rotation += group->rate * (now_us - group->last_us) / 1000000.0;
+	group->started = true;
+	group->last_us = now_us;
+
+	imu_group_state_s_t* const state = &group->published;
+	state->rotation = group->rotation;
+	state->heading = fmod(group->rotation, 360.0);
+	if (state->heading < 0) state->heading += 360.0;
+	state->rate = group->rate;
+	state->timestamp = millis();
+	state->updated_us = now_us;
+	state->sensors = fused;
+	state->rejected = rejected;
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void imu_group_capture(void) {
+	if (likely(imu_groups == NULL)) return;
+	uint32_t const now_us = micros();
+	for (imu_group_s_t* group = imu_groups; group != NULL; group = group->next) group_update(group, now_us);
+}
+
+imu_group_t imu_group_create(const uint8_t* ports, uint8_t count) {
+	if (ports == NULL || count == 0 || count > IMU_GROUP_MAX_SENSORS) {
+		errno = EINVAL;
+		return NULL;
+	}
+	for (int i = 0; i < count; i++) {
+		if (!VALIDATE_PORT_NO(ports[i] - 1) || ports[i] == NUM_V5_PORTS) {
+			errno = ENXIO;
+			return NULL;
+		}
+		for (int j = 0; j < i; j++) {
+			if (ports[j] == ports[i]) {
+				errno = EINVAL;
+				return NULL;
+			}
+		}
+	}
+	imu_group_s_t* const group = kmalloc(sizeof(*group));
+	if (group == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	memset(group, 0, sizeof(*group));
+	group->count = count;
+	for (int i = 0; i < count; i++) group->sensors[i].port = ports[i] - 1;
+	rtos_suspend_all();
+	group->next = imu_groups;
+	imu_groups = group;
+	rtos_resume_all();
+	return group;
+}
+
+int32_t imu_group_get_state(imu_group_t group, imu_group_state_s_t* const state) {
+	if (group == NULL || state == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(state, &((imu_group_s_t*)group)->published);
+	if (state->timestamp == 0) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t imu_group_set_rotation(imu_group_t group, double rotation) {
+	if (group == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	imu_group_s_t* const g = group;
+	rtos_suspend_all();
+	g->rotation = rotation;
+	g->published.rotation = rotation;
+	g->published.heading = fmod(rotation, 360.0);
+	if (g->published.heading < 0) g->published.heading += 360.0;
+	rtos_resume_all();
+	return 1;
+}
+
+void imu_group_delete(imu_group_t group) {
+	if (group == NULL) return;
+	rtos_suspend_all();
+	for (imu_group_s_t** link = &imu_groups; *link != NULL; link = &(*link)->next) {
+		if (*link == group) {
+			*link = ((imu_group_s_t*)group)->next;
+			break;
+		}
+	}
+	rtos_resume_all();
+	kfree(group);
+}
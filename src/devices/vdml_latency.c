@@ -0,0 +1,159 @@
+/**
+ * \file devices/vdml_latency.c
+ *
+ * Input latency probe
+ *
+ * controller_snapshot_capture() notes the time of every change it sees in a
+ * ring of the most recent changes. A tag copies that time to the port, and
+ * each tagged port then moves through being commanded, having the command in
+ * VEXos's device data and being sent by the next vexBackgroundProcessing(),
+ * which is when latency_probe_capture() records it.
+ *
+ * The ring and the ports are only changed with the scheduler suspended, since
+ * the daemon updates them from vdml_snapshot_capture().
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "vdml/vdml.h"
+
+typedef enum latency_state {
+	E_LATENCY_IDLE = 0,
+	E_LATENCY_TAGGED,     // Waiting for the motor to be commanded
+	E_LATENCY_COMMANDED,  // Waiting for a batched command to be flushed
+	E_LATENCY_WRITTEN     // Waiting for the daemon to send the command
+} latency_state_e_t;
+
+typedef struct latency_port {
+	uint32_t input_us;
+	uint32_t command_us;
+	latency_state_e_t state;
+} latency_port_s_t;
+
+volatile uint32_t latency_probe_ports;
+
+static bool running;
+static uint32_t input_count;
+static uint32_t input_times[LATENCY_PROBE_INPUT_HISTORY];
+static latency_port_s_t ports[NUM_V5_PORTS];
+static latency_probe_stats_s_t stats;
+static const uint32_t histogram_bounds[LATENCY_PROBE_HISTOGRAM_BUCKETS] = LATENCY_PROBE_HISTOGRAM_BOUNDS;
+
+static void stage_record(latency_probe_stage_e_t stage, uint32_t us) {
+	latency_probe_stage_stats_s_t* const s = &stats.stages[stage];
+	uint32_t bucket = 0;
+	while (us >= histogram_bounds[bucket] && bucket < LATENCY_PROBE_HISTOGRAM_BUCKETS - 1) bucket++;
+	s->histogram[bucket]++;
+	s->last_us = us;
+	if (us > s->max_us) s->max_us = us;
+	s->total_us += us;
+}
+
+// Called by controller_snapshot_capture() with the scheduler suspended
+void latency_probe_input_capture(void) {
+	if (likely(!running)) return;
+	input_count++;
+	input_times[input_count % LATENCY_PROBE_INPUT_HISTORY] = micros();
+}
+
+// Called by motor_command() before a tagged port's command is sent
+void latency_probe_command(uint8_t port) {
+	rtos_suspend_all();
+	if (ports[port].state == E_LATENCY_TAGGED) {
+		ports[port].command_us = micros();
+		ports[port].state = E_LATENCY_COMMANDED;
+	}
+	rtos_resume_all();
+}
+
+// Called once a tagged port's command is in VEXos's device data, either by
+// motor_command() or by motor_commands_flush() with the scheduler suspended
+void latency_probe_written(uint8_t port) {
+	rtos_suspend_all();
+	if (ports[port].state == E_LATENCY_COMMANDED) ports[port].state = E_LATENCY_WRITTEN;
+	rtos_resume_all();
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended, straight
+// after vexBackgroundProcessing() has sent the ports' commands
+void latency_probe_capture(void) {
+	uint32_t const mask = latency_probe_ports;
+	if (likely(!mask)) return;
+	uint32_t const now = micros();
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(mask & (1 << i)) || ports[i].state != E_LATENCY_WRITTEN) continue;
+		stage_record(E_LATENCY_PROBE_STAGE_INPUT, ports[i].command_us - ports[i].input_us);
+		stage_record(E_LATENCY_PROBE_STAGE_OUTPUT, now - ports[i].command_us);
+		stage_record(E_LATENCY_PROBE_STAGE_TOTAL, now - ports[i].input_us);
+		stats.samples++;
+		ports[i].state = E_LATENCY_IDLE;
+		latency_probe_ports &= ~(1 << i);
+	}
+}
+
+void latency_probe_start(void) {
+	rtos_suspend_all();
+	memset(&stats, 0, sizeof(stats));
+	memset(ports, 0, sizeof(ports));
+	latency_probe_ports = 0;
+	input_count = 0;
+	running = true;
+	rtos_resume_all();
+}
+
+void latency_probe_stop(void) {
+	rtos_suspend_all();
+	running = false;
+	memset(ports, 0, sizeof(ports));
+	latency_probe_ports = 0;
+	rtos_resume_all();
+}
+
+uint32_t latency_probe_get_input(void) {
+	return input_count;
+}
+
+int32_t latency_probe_tag(uint8_t port, uint32_t input) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	int32_t rtn = 1;
+	rtos_suspend_all();
+	if (!running || input == 0 || input > input_count) {
+		errno = EINVAL;
+		rtn = PROS_ERR;
+	} else if (input_count - input >= LATENCY_PROBE_INPUT_HISTORY) {
+		stats.expired++;
+		errno = ETIMEDOUT;
+		rtn = PROS_ERR;
+	} else {
+		latency_port_s_t* const p = &ports[port - 1];
+		if (p->state != E_LATENCY_IDLE) stats.replaced++;
+		p->input_us = input_times[input % LATENCY_PROBE_INPUT_HISTORY];
+		p->state = E_LATENCY_TAGGED;
+		latency_probe_ports |= 1 << (port - 1);
+	}
+	rtos_resume_all();
+	return rtn;
+}
+
+int32_t latency_probe_get_stats(latency_probe_stats_s_t* const out) {
+	if (out == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// The daemon preempts the caller, so keep it from updating the stats midway
+	rtos_suspend_all();
+	*out = stats;
+	rtos_resume_all();
+	return 1;
+}
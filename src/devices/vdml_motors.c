@@ -13,6 +13,7 @@
 #include <errno.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "kapi.h"
 #include "pros/motors.h"
@@ -23,10 +24,118 @@
 #define MOTOR_MOVE_RANGE 127
 #define MOTOR_VOLTAGE_RANGE 12000
 
+typedef enum motor_command {
+	E_MOTOR_COMMAND_NONE = 0,  // Not known, e.g. after a profiled move, so the next command is always sent
+	E_MOTOR_COMMAND_VOLTAGE,
+	E_MOTOR_COMMAND_VELOCITY
+} motor_command_e_t;
+
 typedef struct motor_data {
 	V5_DeviceMotorPid pos_pid, vel_pid;
+	// The last voltage or velocity command, so repeats of it can be skipped.
+	// Only changed with the scheduler suspended
+	motor_command_e_t command;
+	int32_t command_value;
+	// Whether commands are left for the daemon to send, and one is waiting
+	bool batched;
+	bool pending;
 } motor_data_s_t;
 
+// The ports with a batched command waiting for the daemon
+static uint32_t batched_pending;
+
+// Gives the recorded reading while the port is replayed, see vdml_replay.c
+#define return_replayed(port, field) \
+	if (vdml_replaying(port, E_DEVICE_MOTOR)) return vdml_replay_motor(port)->field
+
+static inline motor_data_s_t* motor_data(uint8_t port) {
+	return (motor_data_s_t*)registry_get_device(port)->pad;
+}
+
+static inline void motor_command_send(V5_DeviceT device_info, motor_command_e_t command, int32_t value) {
+	if (command == E_MOTOR_COMMAND_VOLTAGE) {
+		vexDeviceMotorVoltageSet(device_info, value);
+	} else {
+		vexDeviceMotorVelocitySet(device_info, value);
+	}
+}
+
+// Records a command sent to the motor some other way
+static inline void motor_command_record(uint8_t port, motor_command_e_t command, int32_t value) {
+	motor_data_s_t* data = motor_data(port);
+	rtos_suspend_all();
+	data->command = command;
+	data->command_value = value;
+	// Whatever was waiting has been superseded
+	data->pending = false;
+	batched_pending &= ~(1 << port);
+	rtos_resume_all();
+}
+
+// Called by vdml_background_processing() for the ports whose device changed,
+// since a new motor hasn't been sent anything yet
+void motor_commands_forget(uint32_t port_mask) {
+	rtos_suspend_all();
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (port_mask & (1 << i)) motor_data(i)->command = E_MOTOR_COMMAND_NONE;
+	}
+	rtos_resume_all();
+}
+
+static int32_t motor_command(uint8_t port, motor_command_e_t command, int32_t value) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	motor_data_s_t* data = motor_data(port - 1);
+	bool const tagged = unlikely(latency_probe_ports & (1 << (port - 1)));
+	if (tagged) latency_probe_command(port - 1);
+	// A repeat of the last command doesn't need the port. The validated type is
+	// cleared as soon as the motor is unplugged
+	bool done = false;
+	bool queued = false;
+	rtos_suspend_all();
+	if (registry_devices[port - 1].validated_type == E_DEVICE_MOTOR) {
+		if (data->command == command && data->command_value == value) {
+			done = true;
+		} else if (data->batched) {
+			data->command = command;
+			data->command_value = value;
+			data->pending = true;
+			batched_pending |= 1 << (port - 1);
+			done = queued = true;
+		}
+	}
+	rtos_resume_all();
+	if (done) {
+		// A repeat is already what the daemon sends, a queued one is sent by the flush
+		if (tagged && !queued) latency_probe_written(port - 1);
+		return 1;
+	}
+
+	claim_port_i(port - 1, E_DEVICE_MOTOR);
+	motor_command_send(device->device_info, command, value);
+	if (tagged) latency_probe_written(port - 1);
+	motor_command_record(port - 1, command, value);
+	return_port(port - 1, 1);
+}
+
+// Called by motor_snapshot_capture() with the scheduler suspended
+static void motor_commands_flush(void) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(batched_pending & (1 << i))) continue;
+		motor_data_s_t* data = motor_data(i);
+		if (registry_get_plugged_type(i) == E_DEVICE_MOTOR) {
+			motor_command_send(registry_get_device(i)->device_info, data->command, data->command_value);
+			if (unlikely(latency_probe_ports & (1 << i))) latency_probe_written(i);
+		} else {
+			data->command = E_MOTOR_COMMAND_NONE;
+		}
+		data->pending = false;
+	}
+	batched_pending = 0;
+}
+
 static V5_DeviceMotorPid get_pos_pid(uint8_t port) {
 	return ((motor_data_s_t*)registry_get_device(port)->pad)->pos_pid;
 }
@@ -64,30 +173,45 @@ int32_t motor_move(uint8_t port, int32_t voltage) {
 int32_t motor_move_absolute(uint8_t port, const double position, const int32_t velocity) {
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	vexDeviceMotorAbsoluteTargetSet(device->device_info, position, velocity);
+	motor_command_record(port - 1, E_MOTOR_COMMAND_NONE, 0);
 	return_port(port - 1, 1);
 }
 
 int32_t motor_move_relative(uint8_t port, const double position, const int32_t velocity) {
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	vexDeviceMotorRelativeTargetSet(device->device_info, position, velocity);
+	motor_command_record(port - 1, E_MOTOR_COMMAND_NONE, 0);
 	return_port(port - 1, 1);
 }
 
 int32_t motor_move_velocity(uint8_t port, const int32_t velocity) {
-	claim_port_i(port - 1, E_DEVICE_MOTOR);
-	vexDeviceMotorVelocitySet(device->device_info, velocity);
-	return_port(port - 1, 1);
+	return motor_command(port, E_MOTOR_COMMAND_VELOCITY, velocity);
 }
 
 int32_t motor_move_voltage(uint8_t port, const int32_t voltage) {
-	claim_port_i(port - 1, E_DEVICE_MOTOR);
-	vexDeviceMotorVoltageSet(device->device_info, voltage);
-	return_port(port - 1, 1);
+	return motor_command(port, E_MOTOR_COMMAND_VOLTAGE, voltage);
 }
 
 int32_t motor_modify_profiled_velocity(uint8_t port, const int32_t velocity) {
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	vexDeviceMotorVelocityUpdate(device->device_info, velocity);
+	motor_command_record(port - 1, E_MOTOR_COMMAND_NONE, 0);
+	return_port(port - 1, 1);
+}
+
+int32_t motor_set_command_batching(uint8_t port, const bool enable) {
+	claim_port_i(port - 1, E_DEVICE_MOTOR);
+	motor_data_s_t* data = motor_data(port - 1);
+	rtos_suspend_all();
+	data->batched = enable;
+	bool flush = !enable && data->pending;
+	rtos_resume_all();
+	// Don't leave a command behind for a daemon that no longer looks for it
+	if (flush) {
+		motor_command_send(device->device_info, data->command, data->command_value);
+		if (unlikely(latency_probe_ports & (1 << (port - 1)))) latency_probe_written(port - 1);
+		motor_command_record(port - 1, data->command, data->command_value);
+	}
 	return_port(port - 1, 1);
 }
 
@@ -106,24 +230,28 @@ int32_t motor_get_target_velocity(uint8_t port) {
 // Telemetry functions
 
 double motor_get_actual_velocity(uint8_t port) {
+	return_replayed(port - 1, velocity);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorActualVelocityGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 int32_t motor_get_current_draw(uint8_t port) {
+	return_replayed(port - 1, current_draw);
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	int32_t rtn = vexDeviceMotorCurrentGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 int32_t motor_get_direction(uint8_t port) {
+	return_replayed(port - 1, direction);
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	int32_t rtn = vexDeviceMotorDirectionGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 double motor_get_efficiency(uint8_t port) {
+	return_replayed(port - 1, efficiency);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorEfficiencyGet(device->device_info);
 	return_port(port - 1, rtn);
@@ -158,12 +286,14 @@ int32_t motor_get_zero_position_flag(uint8_t port) {
 }
 
 uint32_t motor_get_faults(uint8_t port) {
+	return_replayed(port - 1, faults);
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	uint32_t rtn = vexDeviceMotorFaultsGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 uint32_t motor_get_flags(uint8_t port) {
+	return_replayed(port - 1, flags);
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	uint32_t rtn = vexDeviceMotorFlagsGet(device->device_info);
 	return_port(port - 1, rtn);
@@ -176,30 +306,35 @@ int32_t motor_get_raw_position(uint8_t port, uint32_t* const timestamp) {
 }
 
 double motor_get_position(uint8_t port) {
+	return_replayed(port - 1, position);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorPositionGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 double motor_get_power(uint8_t port) {
+	return_replayed(port - 1, power);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorPowerGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 double motor_get_temperature(uint8_t port) {
+	return_replayed(port - 1, temperature);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorTemperatureGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 double motor_get_torque(uint8_t port) {
+	return_replayed(port - 1, torque);
 	claim_port_f(port - 1, E_DEVICE_MOTOR);
 	double rtn = vexDeviceMotorTorqueGet(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 int32_t motor_get_voltage(uint8_t port) {
+	return_replayed(port - 1, voltage);
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
 	int32_t rtn = vexDeviceMotorVoltageGet(device->device_info);
 	return_port(port - 1, rtn);
@@ -225,9 +360,27 @@ int32_t motor_set_brake_mode(uint8_t port, const motor_brake_mode_e_t mode) {
 	return_port(port - 1, 1);
 }
 
+// How much more current than it draws now a motor is given each cycle, so it
+// can still speed up
+#define MOTOR_CURRENT_BUDGET_HEADROOM 300
+// The smallest change in a motor's allocation that is sent to it, in mA
+#define MOTOR_CURRENT_BUDGET_STEP 50
+
+// The current budget, shared with motor_snapshot_capture(). A requested limit
+// of 0 means it hasn't been read from the motor yet
+static int32_t current_budget;  // 0 while the budget is disabled
+static int32_t requested_limits[NUM_V5_PORTS];
+static int32_t applied_limits[NUM_V5_PORTS];
+static uint8_t budget_priorities[NUM_V5_PORTS];
+static bool budget_restore;  // Set when the budget is disabled, until the motors get their limits back
+
 int32_t motor_set_current_limit(uint8_t port, const int32_t limit) {
 	claim_port_i(port - 1, E_DEVICE_MOTOR);
-	vexDeviceMotorCurrentLimitSet(device->device_info, limit);
+	rtos_suspend_all();
+	requested_limits[port - 1] = limit;
+	// While the budget is enabled, the daemon applies the limit next cycle
+	if (!current_budget) vexDeviceMotorCurrentLimitSet(device->device_info, limit);
+	rtos_resume_all();
 	return_port(port - 1, 1);
 }
 
@@ -423,3 +576,1061 @@ int32_t motor_get_voltage_limit(uint8_t port) {
 	int32_t rtn = vexDeviceMotorVoltageLimitGet(device->device_info);
 	return_port(rtn, port - 1);
 }
+
+int32_t motor_get_state(uint8_t port, motor_state_s_t* const state) {
+	claim_port_i(port - 1, E_DEVICE_MOTOR);
+	V5_DeviceT device_info = device->device_info;
+	state->position = vexDeviceMotorPositionGet(device_info);
+	state->velocity = vexDeviceMotorActualVelocityGet(device_info);
+	state->target_position = vexDeviceMotorTargetGet(device_info);
+	state->power = vexDeviceMotorPowerGet(device_info);
+	state->torque = vexDeviceMotorTorqueGet(device_info);
+	state->efficiency = vexDeviceMotorEfficiencyGet(device_info);
+	state->temperature = vexDeviceMotorTemperatureGet(device_info);
+	state->target_velocity = vexDeviceMotorVelocityGet(device_info);
+	state->current_draw = vexDeviceMotorCurrentGet(device_info);
+	state->voltage = vexDeviceMotorVoltageGet(device_info);
+	state->direction = vexDeviceMotorDirectionGet(device_info);
+	state->faults = vexDeviceMotorFaultsGet(device_info);
+	state->flags = vexDeviceMotorFlagsGet(device_info);
+	return_port(port - 1, 1);
+}
+
+// Motor group functions
+
+/**
+ * Validates every port of a motor group and takes their mutexes in ascending
+ * port order, so that two groups sharing motors can never deadlock.
+ *
+ * \param ports
+ *        The group's ports; a negative port reverses commands sent to it
+ * \param count
+ *        The number of ports in the group
+ * \param[out] reversed
+ *        Bitmap of the ports (0-20) that commands should be negated for
+ *
+ * \return Bitmap of the claimed ports (0-20), or 0 if the group could not be
+ * claimed, setting errno.
+ */
+static uint32_t motor_group_claim(const int8_t* const ports, const uint8_t count, uint32_t* const reversed) {
+	uint32_t claimed = 0;
+	*reversed = 0;
+	if (ports == NULL || count == 0) {
+		errno = EINVAL;
+		return 0;
+	}
+	for (uint8_t i = 0; i < count; i++) {
+		int32_t port = (ports[i] < 0 ? -ports[i] : ports[i]) - 1;
+		if (!VALIDATE_PORT_NO(port)) {
+			errno = ENXIO;
+			return 0;
+		}
+		if (registry_devices[port].validated_type != E_DEVICE_MOTOR && registry_validate_binding(port, E_DEVICE_MOTOR) != 0) {
+			return 0;
+		}
+		if (ports[i] < 0) *reversed |= 1 << port;
+		claimed |= 1 << port;
+	}
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if ((claimed & (1 << i)) && !port_mutex_take(i)) {
+			// Return whatever we have already taken
+			while (--i >= 0) {
+				if (claimed & (1 << i)) port_mutex_give(i);
+			}
+			errno = EACCES;
+			return 0;
+		}
+	}
+	return claimed;
+}
+
+static void motor_group_release(const uint32_t claimed) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (claimed & (1 << i)) port_mutex_give(i);
+	}
+}
+
+int32_t motor_group_move(const int8_t* const ports, const uint8_t count, int32_t voltage) {
+	if (voltage > 127) {
+		voltage = 127;
+	} else if (voltage < -127) {
+		voltage = -127;
+	}
+
+	// Same remapping as motor_move()
+	int32_t command = (((voltage + MOTOR_MOVE_RANGE) * (MOTOR_VOLTAGE_RANGE)) / (MOTOR_MOVE_RANGE));
+	command -= MOTOR_VOLTAGE_RANGE;
+	return motor_group_move_voltage(ports, count, command);
+}
+
+int32_t motor_group_move_absolute(const int8_t* const ports, const uint8_t count, const double position,
+                                  const int32_t velocity) {
+	uint32_t reversed;
+	uint32_t claimed = motor_group_claim(ports, count, &reversed);
+	if (!claimed) return PROS_ERR;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(claimed & (1 << i))) continue;
+		int32_t sign = (reversed & (1 << i)) ? -1 : 1;
+		vexDeviceMotorAbsoluteTargetSet(registry_get_device(i)->device_info, sign * position, velocity);
+		motor_command_record(i, E_MOTOR_COMMAND_NONE, 0);
+	}
+	motor_group_release(claimed);
+	return 1;
+}
+
+int32_t motor_group_move_relative(const int8_t* const ports, const uint8_t count, const double position,
+                                  const int32_t velocity) {
+	uint32_t reversed;
+	uint32_t claimed = motor_group_claim(ports, count, &reversed);
+	if (!claimed) return PROS_ERR;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(claimed & (1 << i))) continue;
+		int32_t sign = (reversed & (1 << i)) ? -1 : 1;
+		vexDeviceMotorRelativeTargetSet(registry_get_device(i)->device_info, sign * position, velocity);
+		motor_command_record(i, E_MOTOR_COMMAND_NONE, 0);
+	}
+	motor_group_release(claimed);
+	return 1;
+}
+
+int32_t motor_group_move_velocity(const int8_t* const ports, const uint8_t count, const int32_t velocity) {
+	uint32_t reversed;
+	uint32_t claimed = motor_group_claim(ports, count, &reversed);
+	if (!claimed) return PROS_ERR;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(claimed & (1 << i))) continue;
+		int32_t value = (reversed & (1 << i)) ? -velocity : velocity;
+		motor_data_s_t* data = motor_data(i);
+		if (data->command == E_MOTOR_COMMAND_VELOCITY && data->command_value == value && !data->pending) continue;
+		vexDeviceMotorVelocitySet(registry_get_device(i)->device_info, value);
+		motor_command_record(i, E_MOTOR_COMMAND_VELOCITY, value);
+	}
+	motor_group_release(claimed);
+	return 1;
+}
+
+int32_t motor_group_move_voltage(const int8_t* const ports, const uint8_t count, const int32_t voltage) {
+	uint32_t reversed;
+	uint32_t claimed = motor_group_claim(ports, count, &reversed);
+	if (!claimed) return PROS_ERR;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(claimed & (1 << i))) continue;
+		int32_t value = (reversed & (1 << i)) ? -voltage : voltage;
+		motor_data_s_t* data = motor_data(i);
+		if (data->command == E_MOTOR_COMMAND_VOLTAGE && data->command_value == value && !data->pending) continue;
+		vexDeviceMotorVoltageSet(registry_get_device(i)->device_info, value);
+		motor_command_record(i, E_MOTOR_COMMAND_VOLTAGE, value);
+	}
+	motor_group_release(claimed);
+	return 1;
+}
+
+static motor_snapshot_s_t motor_snapshots[NUM_V5_PORTS];
+static uint32_t motor_snapshot_ports;  // The ports captured in the latest cycle
+static int32_t motor_total_current;  // The sum of every motor's current_draw in the latest snapshots
+static int32_t position_scales[NUM_V5_PORTS];  // 16.16 fixed point, see motor_set_position_scale()
+
+// Fault handlers set with motor_on_fault(). The faults seen by the daemon are
+// kept for the watched ports, and the changes wait for motor_dispatch_faults()
+typedef struct fault_handler {
+	motor_fault_fn_t callback;
+	void* param;
+	uint32_t mask;
+} fault_handler_s_t;
+static fault_handler_s_t fault_handlers[NUM_V5_PORTS];
+static uint32_t fault_watched_ports;
+static uint32_t fault_last[NUM_V5_PORTS];
+static uint32_t fault_pending_ports;
+static uint32_t fault_pending_changes[NUM_V5_PORTS];
+
+// Single producer (the daemon) single consumer ring of telemetry samples
+static motor_telemetry_sample_s_t telemetry_buffer[MOTOR_TELEMETRY_BUFFER_SIZE];
+static volatile uint32_t telemetry_head;  // Written by the daemon
+static volatile uint32_t telemetry_tail;  // Written by the reader
+static volatile uint32_t telemetry_mask;
+static volatile uint32_t telemetry_divisor = 1;
+static volatile uint32_t telemetry_shed = 1;  // multiplies the divisor while the CPU is overloaded
+static volatile uint32_t telemetry_dropped;
+
+static void telemetry_record(uint8_t port, const motor_snapshot_s_t* const snapshot) {
+	uint32_t head = telemetry_head;
+	if (head - telemetry_tail >= MOTOR_TELEMETRY_BUFFER_SIZE) {
+		telemetry_dropped++;
+		return;
+	}
+	motor_telemetry_sample_s_t* sample = &telemetry_buffer[head % MOTOR_TELEMETRY_BUFFER_SIZE];
+	sample->timestamp = snapshot->timestamp;
+	sample->port = port + 1;
+	sample->position = snapshot->position;
+	sample->velocity = snapshot->velocity;
+	sample->current_draw = snapshot->current_draw;
+	sample->voltage = snapshot->voltage;
+	compiler_barrier();
+	telemetry_head = head + 1;
+}
+
+typedef struct motor_controller_data {
+	motor_controller_s_t config;
+	double target;
+	double integral;
+	double last_error;
+	double voltage;
+	bool enabled;
+} motor_controller_data_s_t;
+
+static motor_controller_data_s_t motor_controllers[NUM_V5_PORTS];
+
+static void motor_controller_update(motor_controller_data_s_t* const ctrl, const motor_snapshot_s_t* const snapshot,
+                                    V5_DeviceT device_info) {
+	const motor_controller_s_t* config = &ctrl->config;
+	double actual = config->mode == E_MOTOR_CONTROLLER_POSITION ? snapshot->position : snapshot->velocity;
+	double error = ctrl->target - actual;
+	double output = config->kf * ctrl->target + config->kp * error + config->ki * (ctrl->integral + error) +
+	                config->kd * (error - ctrl->last_error);
+	ctrl->last_error = error;
+
+	// Only integrate while unsaturated so the integral can't wind up
+	if (fabs(output) < MOTOR_VOLTAGE_RANGE) {
+		ctrl->integral += error;
+	} else {
+		output = copysign(MOTOR_VOLTAGE_RANGE, output);
+	}
+	if (config->slew > 0) {
+		if (output > ctrl->voltage + config->slew) {
+			output = ctrl->voltage + config->slew;
+		} else if (output < ctrl->voltage - config->slew) {
+			output = ctrl->voltage - config->slew;
+		}
+	}
+	ctrl->voltage = output;
+	vexDeviceMotorVoltageSet(device_info, (int32_t)output);
+}
+
+int32_t motor_controller_enable(uint8_t port, const motor_controller_s_t* const controller) {
+	if (controller == NULL || controller->slew < 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_port_i(port - 1, E_DEVICE_MOTOR);
+	motor_controller_data_s_t* ctrl = &motor_controllers[port - 1];
+	// The daemon evaluates controllers with the scheduler suspended
+	rtos_suspend_all();
+	ctrl->config = *controller;
+	ctrl->target = 0;
+	ctrl->integral = 0;
+	ctrl->last_error = 0;
+	ctrl->voltage = vexDeviceMotorVoltageGet(device->device_info);
+	ctrl->enabled = true;
+	rtos_resume_all();
+	motor_command_record(port - 1, E_MOTOR_COMMAND_NONE, 0);
+	return_port(port - 1, 1);
+}
+
+int32_t motor_controller_set_target(uint8_t port, const double target) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	motor_controller_data_s_t* ctrl = &motor_controllers[port - 1];
+	if (!ctrl->enabled) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	ctrl->target = target;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_controller_disable(uint8_t port) {
+	claim_port_i(port - 1, E_DEVICE_MOTOR);
+	motor_controllers[port - 1].enabled = false;
+	vexDeviceMotorVoltageSet(device->device_info, 0);
+	motor_command_record(port - 1, E_MOTOR_COMMAND_VOLTAGE, 0);
+	return_port(port - 1, 1);
+}
+
+struct motor_trajectory_s {
+	struct motor_trajectory_s* next;  // The next active trajectory, while this one is running
+	uint32_t ports;                   // Bit i for port i + 1
+	uint32_t reversed;
+	motor_trajectory_gains_s_t gains;
+	volatile bool running;
+	bool started;  // Whether the daemon has set start_time yet
+	uint32_t start_time;
+	uint32_t segment;  // The point the playback is past
+	uint32_t num_points;
+	motor_trajectory_point_s_t points[];
+};
+
+// Only changed with the scheduler suspended
+static struct motor_trajectory_s* active_trajectories;
+static uint32_t trajectory_ports;       // The ports of every active trajectory
+static uint32_t trajectory_stop_ports;  // The ports of trajectories stopped early, for the daemon to stop
+
+// Must be called with the scheduler suspended
+static void trajectory_unlink(struct motor_trajectory_s* const trajectory) {
+	struct motor_trajectory_s** link = &active_trajectories;
+	while (*link != NULL && *link != trajectory) link = &(*link)->next;
+	if (*link != NULL) *link = trajectory->next;
+	trajectory_ports &= ~trajectory->ports;
+	trajectory->running = false;
+}
+
+// Interpolates the trajectory's setpoint for the given time
+static motor_trajectory_point_s_t trajectory_setpoint(struct motor_trajectory_s* const trajectory,
+                                                      const uint32_t elapsed) {
+	const motor_trajectory_point_s_t* points = trajectory->points;
+	while (trajectory->segment + 2 < trajectory->num_points && points[trajectory->segment + 1].time <= elapsed) {
+		trajectory->segment++;
+	}
+	const motor_trajectory_point_s_t* from = &points[trajectory->segment];
+	if (trajectory->segment + 1 >= trajectory->num_points || elapsed <= from->time) return *from;
+	const motor_trajectory_point_s_t* to = from + 1;
+	double f = (double)(elapsed - from->time) / (to->time - from->time);
+	motor_trajectory_point_s_t setpoint = {.time = elapsed,
+	                                       .position = from->position + f * (to->position - from->position),
+	                                       .velocity = from->velocity + f * (to->velocity - from->velocity),
+	                                       .voltage = from->voltage + f * (to->voltage - from->voltage)};
+	return setpoint;
+}
+
+// Called by motor_snapshot_capture() with the scheduler suspended, once the
+// motors' snapshots are up to date
+static void trajectories_update(const uint32_t now) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(trajectory_stop_ports & (1 << i)) || registry_get_plugged_type(i) != E_DEVICE_MOTOR) continue;
+		vexDeviceMotorVoltageSet(registry_get_device(i)->device_info, 0);
+		motor_command_record(i, E_MOTOR_COMMAND_VOLTAGE, 0);
+	}
+	trajectory_stop_ports = 0;
+
+	struct motor_trajectory_s** link = &active_trajectories;
+	while (*link != NULL) {
+		struct motor_trajectory_s* trajectory = *link;
+		if (!trajectory->started) {
+			trajectory->start_time = now;
+			trajectory->started = true;
+		}
+		uint32_t elapsed = now - trajectory->start_time;
+		bool done = elapsed >= trajectory->points[trajectory->num_points - 1].time;
+		motor_trajectory_point_s_t setpoint = trajectory_setpoint(trajectory, elapsed);
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(trajectory->ports & (1 << i)) || registry_get_plugged_type(i) != E_DEVICE_MOTOR) continue;
+			V5_DeviceT device_info = registry_get_device(i)->device_info;
+			if (done) {
+				// Hold still once the trajectory is over
+				vexDeviceMotorVelocitySet(device_info, 0);
+				motor_command_record(i, E_MOTOR_COMMAND_VELOCITY, 0);
+				continue;
+			}
+			double sign = (trajectory->reversed & (1 << i)) ? -1 : 1;
+			const motor_snapshot_s_t* snapshot = &motor_snapshots[i];
+			double voltage = sign * setpoint.voltage + trajectory->gains.kp * (sign * setpoint.position - snapshot->position) +
+			                 trajectory->gains.kv * (sign * setpoint.velocity - snapshot->velocity);
+			if (fabs(voltage) > MOTOR_VOLTAGE_RANGE) voltage = copysign(MOTOR_VOLTAGE_RANGE, voltage);
+			vexDeviceMotorVoltageSet(device_info, (int32_t)voltage);
+		}
+		if (done) {
+			*link = trajectory->next;
+			trajectory_ports &= ~trajectory->ports;
+			trajectory->running = false;
+		} else {
+			link = &trajectory->next;
+		}
+	}
+}
+
+motor_trajectory_t motor_trajectory_load(const int8_t* const ports, const uint8_t count,
+                                         const motor_trajectory_point_s_t* const points, const uint32_t num_points,
+                                         const motor_trajectory_gains_s_t* const gains) {
+	if (ports == NULL || count == 0 || points == NULL || num_points == 0 || gains == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	for (uint32_t i = 1; i < num_points; i++) {
+		if (points[i].time <= points[i - 1].time) {
+			errno = EINVAL;
+			return NULL;
+		}
+	}
+	uint32_t port_mask = 0, reversed = 0;
+	for (uint8_t i = 0; i < count; i++) {
+		int32_t port = (ports[i] < 0 ? -ports[i] : ports[i]) - 1;
+		if (!VALIDATE_PORT_NO(port)) {
+			errno = ENXIO;
+			return NULL;
+		}
+		if (ports[i] < 0) reversed |= 1 << port;
+		port_mask |= 1 << port;
+	}
+	struct motor_trajectory_s* trajectory = kmalloc(sizeof(*trajectory) + num_points * sizeof(*points));
+	if (trajectory == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	memset(trajectory, 0, sizeof(*trajectory));
+	trajectory->ports = port_mask;
+	trajectory->reversed = reversed;
+	trajectory->gains = *gains;
+	trajectory->num_points = num_points;
+	memcpy(trajectory->points, points, num_points * sizeof(*points));
+	return trajectory;
+}
+
+int32_t motor_trajectory_start(motor_trajectory_t trajectory) {
+	if (trajectory == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	int32_t rtn = 1;
+	rtos_suspend_all();
+	bool busy = trajectory->running || (trajectory_ports & trajectory->ports);
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if ((trajectory->ports & (1 << i)) && motor_controllers[i].enabled) busy = true;
+	}
+	if (busy) {
+		errno = EBUSY;
+		rtn = PROS_ERR;
+	} else {
+		trajectory->started = false;
+		trajectory->segment = 0;
+		trajectory->running = true;
+		trajectory->next = active_trajectories;
+		active_trajectories = trajectory;
+		trajectory_ports |= trajectory->ports;
+		trajectory_stop_ports &= ~trajectory->ports;
+		// The trajectory overrides whatever the motors were last told
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (trajectory->ports & (1 << i)) motor_command_record(i, E_MOTOR_COMMAND_NONE, 0);
+		}
+	}
+	rtos_resume_all();
+	return rtn;
+}
+
+int32_t motor_trajectory_stop(motor_trajectory_t trajectory) {
+	if (trajectory == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (trajectory->running) {
+		trajectory_unlink(trajectory);
+		trajectory_stop_ports |= trajectory->ports;
+	}
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_trajectory_is_running(motor_trajectory_t trajectory) {
+	return trajectory != NULL && trajectory->running;
+}
+
+int32_t motor_trajectory_wait(motor_trajectory_t trajectory, uint32_t timeout) {
+	if (trajectory == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (trajectory->running && xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	uint32_t start = millis();
+	while (trajectory->running) {
+		uint32_t elapsed = millis() - start;
+		if (timeout != TIMEOUT_MAX && elapsed >= timeout) {
+			errno = ETIMEDOUT;
+			return PROS_ERR;
+		}
+		// The daemon advances the trajectory just before it wakes the tasks waiting on its ports
+		vdml_wait_for_update(trajectory->ports, timeout == TIMEOUT_MAX ? TIMEOUT_MAX : timeout - elapsed);
+	}
+	return 1;
+}
+
+void motor_trajectory_delete(motor_trajectory_t trajectory) {
+	if (trajectory == NULL) return;
+	motor_trajectory_stop(trajectory);
+	kfree(trajectory);
+}
+
+struct motor_sync_s {
+	struct motor_sync_s* next;
+	uint32_t ports;  // Bit i for port i + 1
+	uint32_t reversed;
+	motor_sync_gains_s_t gains;
+	// Whether base and origin hold the command being corrected
+	bool tracking;
+	motor_command_e_t command;
+	int32_t base[NUM_V5_PORTS];
+	double origin[NUM_V5_PORTS];
+	double integral[NUM_V5_PORTS];
+	motor_sync_stats_s_t stats;
+};
+
+// Only changed with the scheduler suspended
+static struct motor_sync_s* active_syncs;
+static uint32_t sync_ports;          // The ports of every synchronized group
+// The ports of groups no longer synchronized, for the daemon to send their commands to
+static uint32_t sync_restore_ports;
+
+static uint32_t sync_port_mask(const int8_t* const ports, const uint8_t count, uint32_t* const reversed) {
+	uint32_t mask = 0;
+	*reversed = 0;
+	for (uint8_t i = 0; ports != NULL && i < count; i++) {
+		int32_t port = (ports[i] < 0 ? -ports[i] : ports[i]) - 1;
+		if (!VALIDATE_PORT_NO(port)) {
+			errno = ENXIO;
+			return 0;
+		}
+		if (ports[i] < 0) *reversed |= 1 << port;
+		mask |= 1 << port;
+	}
+	if (!mask) errno = EINVAL;
+	return mask;
+}
+
+static bool sync_gains_valid(const motor_sync_gains_s_t* const gains) {
+	return gains != NULL && gains->kp >= 0 && gains->ki >= 0 && gains->max_trim >= 0;
+}
+
+// Must be called with the scheduler suspended
+static struct motor_sync_s* sync_find(const uint32_t ports) {
+	struct motor_sync_s* sync = active_syncs;
+	while (sync != NULL && sync->ports != ports) sync = sync->next;
+	return sync;
+}
+
+// Called by motor_snapshot_capture() with the scheduler suspended, once the
+// motors' snapshots, controllers and trajectories are up to date
+static void sync_update(struct motor_sync_s* const sync, const uint32_t motors) {
+	uint32_t const ports = sync->ports;
+	bool usable = (ports & motors) == ports && !(ports & trajectory_ports);
+	bool same = sync->tracking;
+	bool moving = false;
+	motor_command_e_t command = E_MOTOR_COMMAND_NONE;
+	for (int i = 0; i < NUM_V5_PORTS && usable; i++) {
+		if (!(ports & (1 << i))) continue;
+		const motor_data_s_t* const data = motor_data(i);
+		if (motor_controllers[i].enabled || data->command == E_MOTOR_COMMAND_NONE ||
+		    (command != E_MOTOR_COMMAND_NONE && data->command != command)) {
+			usable = false;
+		}
+		command = data->command;
+		if (data->command_value != sync->base[i]) same = false;
+		if (data->command_value != 0) moving = true;
+	}
+	if (!usable || !moving) {
+		sync->tracking = false;
+		return;
+	}
+	if (!same || command != sync->command) {
+		// A new command, which the motors are compared from here on
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(ports & (1 << i))) continue;
+			sync->base[i] = motor_data(i)->command_value;
+			sync->origin[i] = motor_snapshots[i].position;
+			sync->integral[i] = 0;
+		}
+		sync->command = command;
+		sync->tracking = true;
+		return;
+	}
+
+	double progress[NUM_V5_PORTS];
+	double sum = 0, lowest = INFINITY, highest = -INFINITY;
+	int count = 0;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(ports & (1 << i))) continue;
+		double const sign = (sync->reversed & (1 << i)) ? -1 : 1;
+		progress[i] = sign * (motor_snapshots[i].position - sync->origin[i]);
+		sum += progress[i];
+		count++;
+		if (progress[i] < lowest) lowest = progress[i];
+		if (progress[i] > highest) highest = progress[i];
+	}
+	double const mean = sum / count;
+	double max_trim = 0;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(ports & (1 << i))) continue;
+		double const sign = (sync->reversed & (1 << i)) ? -1 : 1;
+		double const error = mean - progress[i];
+		double trim = sync->gains.kp * error + sync->gains.ki * (sync->integral[i] + error);
+		// Only integrate while unsaturated so the integral can't wind up
+		if (sync->gains.max_trim > 0 && fabs(trim) > sync->gains.max_trim) {
+			trim = copysign(sync->gains.max_trim, trim);
+		} else {
+			sync->integral[i] += error;
+		}
+		if (fabs(trim) > max_trim) max_trim = fabs(trim);
+		double value = sync->base[i] + sign * trim;
+		V5_DeviceT const device_info = registry_get_device(i)->device_info;
+		if (command == E_MOTOR_COMMAND_VOLTAGE) {
+			if (fabs(value) > MOTOR_VOLTAGE_RANGE) value = copysign(MOTOR_VOLTAGE_RANGE, value);
+			vexDeviceMotorVoltageSet(device_info, (int32_t)value);
+		} else {
+			vexDeviceMotorVelocitySet(device_info, (int32_t)value);
+		}
+	}
+	sync->stats.spread = highest - lowest;
+	if (sync->stats.spread > sync->stats.peak_spread) sync->stats.peak_spread = sync->stats.spread;
+	sync->stats.max_trim = max_trim;
+	sync->stats.cycles++;
+}
+
+// Called by motor_snapshot_capture() with the scheduler suspended
+static void syncs_update(const uint32_t motors) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(sync_restore_ports & (1 << i)) || !(motors & (1 << i))) continue;
+		const motor_data_s_t* const data = motor_data(i);
+		if (data->command != E_MOTOR_COMMAND_NONE) {
+			motor_command_send(registry_get_device(i)->device_info, data->command, data->command_value);
+		}
+	}
+	sync_restore_ports = 0;
+	for (struct motor_sync_s* sync = active_syncs; sync != NULL; sync = sync->next) sync_update(sync, motors);
+}
+
+int32_t motor_group_sync_enable(const int8_t* const ports, const uint8_t count,
+                                const motor_sync_gains_s_t* const gains) {
+	uint32_t reversed;
+	uint32_t const mask = sync_port_mask(ports, count, &reversed);
+	if (!mask) return PROS_ERR;
+	if (__builtin_popcount(mask) < 2 || !sync_gains_valid(gains)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	struct motor_sync_s* const sync = kmalloc(sizeof(*sync));
+	if (sync == NULL) {
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+	memset(sync, 0, sizeof(*sync));
+	sync->ports = mask;
+	sync->reversed = reversed;
+	sync->gains = *gains;
+	rtos_suspend_all();
+	bool const busy = sync_ports & mask;
+	if (!busy) {
+		sync->next = active_syncs;
+		active_syncs = sync;
+		sync_ports |= mask;
+		sync_restore_ports &= ~mask;
+	}
+	rtos_resume_all();
+	if (busy) {
+		kfree(sync);
+		errno = EBUSY;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t motor_group_sync_set_gains(const int8_t* const ports, const uint8_t count,
+                                   const motor_sync_gains_s_t* const gains) {
+	uint32_t reversed;
+	uint32_t const mask = sync_port_mask(ports, count, &reversed);
+	if (!mask) return PROS_ERR;
+	if (!sync_gains_valid(gains)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	struct motor_sync_s* const sync = sync_find(mask);
+	if (sync != NULL) sync->gains = *gains;
+	rtos_resume_all();
+	if (sync == NULL) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t motor_group_sync_get_stats(const int8_t* const ports, const uint8_t count, motor_sync_stats_s_t* const stats) {
+	uint32_t reversed;
+	uint32_t const mask = sync_port_mask(ports, count, &reversed);
+	if (!mask) return PROS_ERR;
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	struct motor_sync_s* const sync = sync_find(mask);
+	if (sync != NULL) *stats = sync->stats;
+	rtos_resume_all();
+	if (sync == NULL) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t motor_group_sync_disable(const int8_t* const ports, const uint8_t count) {
+	uint32_t reversed;
+	uint32_t const mask = sync_port_mask(ports, count, &reversed);
+	if (!mask) return PROS_ERR;
+	rtos_suspend_all();
+	struct motor_sync_s* const sync = sync_find(mask);
+	if (sync != NULL) {
+		struct motor_sync_s** link = &active_syncs;
+		while (*link != sync) link = &(*link)->next;
+		*link = sync->next;
+		sync_ports &= ~mask;
+		sync_restore_ports |= mask;
+	}
+	rtos_resume_all();
+	if (sync == NULL) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	kfree(sync);
+	return 1;
+}
+
+// Called from the system daemon with the scheduler suspended, e.g. by
+// path_follow_update(). Sets the target of the motor's velocity controller if
+// it has one, and otherwise has VEXos hold the velocity. A motor running a
+// trajectory or a position controller is left to it
+void motor_velocity_drive(uint8_t port, double rpm) {
+	if (registry_get_plugged_type(port) != E_DEVICE_MOTOR || (trajectory_ports & (1 << port))) return;
+	motor_controller_data_s_t* const ctrl = &motor_controllers[port];
+	if (ctrl->enabled) {
+		if (ctrl->config.mode == E_MOTOR_CONTROLLER_VELOCITY) ctrl->target = rpm;
+		return;
+	}
+	int32_t const value = (int32_t)rpm;
+	motor_data_s_t* const data = motor_data(port);
+	if (data->command == E_MOTOR_COMMAND_VELOCITY && data->command_value == value) return;
+	vexDeviceMotorVelocitySet(registry_get_device(port)->device_info, value);
+	motor_command_record(port, E_MOTOR_COMMAND_VELOCITY, value);
+}
+
+// Hands out as much of *remaining as possible towards each motor's demand,
+// going through the priorities from highest to lowest. Motors with the same
+// priority get the same share of their demand when there isn't enough left
+static void current_budget_fill(uint32_t motors, const int32_t* demand, int32_t* alloc, int32_t* remaining) {
+	int32_t level = UINT8_MAX;
+	while (level >= 0 && *remaining > 0) {
+		int32_t total = 0, next = -1;
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(motors & (1 << i))) continue;
+			if (budget_priorities[i] == level) {
+				total += demand[i];
+			} else if (budget_priorities[i] < level && budget_priorities[i] > next) {
+				next = budget_priorities[i];
+			}
+		}
+		if (total > 0) {
+			int32_t share = total <= *remaining ? total : *remaining;
+			for (int i = 0; i < NUM_V5_PORTS; i++) {
+				if (!(motors & (1 << i)) || budget_priorities[i] != level) continue;
+				alloc[i] += (int32_t)((int64_t)demand[i] * share / total);
+			}
+			*remaining -= share;
+		}
+		level = next;
+	}
+}
+
+// Splits the current budget between the motors in the snapshots just taken
+static void current_budget_allocate(uint32_t motors) {
+	int32_t demand[NUM_V5_PORTS], alloc[NUM_V5_PORTS] = {0};
+	int32_t remaining = current_budget;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(motors & (1 << i))) continue;
+		if (requested_limits[i] == 0) {
+			requested_limits[i] = vexDeviceMotorCurrentLimitGet(registry_get_device(i)->device_info);
+		}
+		// First give every motor what it is drawing now plus room to speed up
+		int32_t wanted = motor_snapshots[i].current_draw + MOTOR_CURRENT_BUDGET_HEADROOM;
+		demand[i] = wanted < requested_limits[i] ? wanted : requested_limits[i];
+	}
+	current_budget_fill(motors, demand, alloc, &remaining);
+	// Then share out what is left, up to the motors' own limits
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (motors & (1 << i)) demand[i] = requested_limits[i] - alloc[i];
+	}
+	current_budget_fill(motors, demand, alloc, &remaining);
+
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(motors & (1 << i))) continue;
+		// Small changes aren't worth sending to the motor, unless they give it
+		// back its whole limit
+		int32_t change = alloc[i] - applied_limits[i];
+		if (change < MOTOR_CURRENT_BUDGET_STEP && change > -MOTOR_CURRENT_BUDGET_STEP &&
+		    (alloc[i] != requested_limits[i] || change == 0)) {
+			continue;
+		}
+		vexDeviceMotorCurrentLimitSet(registry_get_device(i)->device_info, alloc[i]);
+		applied_limits[i] = alloc[i];
+	}
+}
+
+// Called by motor_snapshot_capture() for the watched ports
+static inline void fault_check(uint8_t port, uint32_t faults) {
+	uint32_t const changed = (faults ^ fault_last[port]) & fault_handlers[port].mask;
+	fault_last[port] = faults;
+	if (likely(!changed)) return;
+	fault_pending_changes[port] ^= changed;  // a fault raised and cleared again before dispatch cancels out
+	fault_pending_ports |= 1 << port;
+}
+
+// Called by the system daemon once the ports have been released
+void motor_dispatch_faults(void) {
+	if (likely(!fault_pending_ports)) return;
+	fault_handler_s_t handlers[NUM_V5_PORTS];
+	uint32_t faults[NUM_V5_PORTS];
+	uint32_t changes[NUM_V5_PORTS];
+	rtos_suspend_all();
+	uint32_t const ports = fault_pending_ports;
+	fault_pending_ports = 0;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(ports & (1 << i))) continue;
+		handlers[i] = fault_handlers[i];
+		faults[i] = fault_last[i];
+		changes[i] = fault_pending_changes[i];
+		fault_pending_changes[i] = 0;
+	}
+	rtos_resume_all();
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(ports & (1 << i)) || !changes[i] || handlers[i].callback == NULL) continue;
+		handlers[i].callback(i + 1, faults[i], changes[i], handlers[i].param);
+	}
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void motor_snapshot_capture(void) {
+	static uint32_t telemetry_cycle = 0;
+	uint32_t now = millis();
+	bool record = telemetry_mask && ++telemetry_cycle >= telemetry_divisor * telemetry_shed;
+	if (record) telemetry_cycle = 0;
+	int32_t total_current = 0;
+	uint32_t motors = 0;
+	if (batched_pending) motor_commands_flush();
+	uint32_t replayed = 0;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		motor_snapshot_s_t* snapshot = &motor_snapshots[i];
+		// A replayed motor isn't read, and isn't driven by the controllers or the current budget
+		if (vdml_replaying(i, E_DEVICE_MOTOR)) {
+			*snapshot = *vdml_replay_motor(i);
+			replayed |= 1 << i;
+			continue;
+		}
+		if (registry_get_bound_type(i) != E_DEVICE_MOTOR || registry_get_plugged_type(i) != E_DEVICE_MOTOR) {
+			continue;
+		}
+		V5_DeviceT device_info = registry_get_device(i)->device_info;
+		snapshot->position = vexDeviceMotorPositionGet(device_info);
+		snapshot->velocity = vexDeviceMotorActualVelocityGet(device_info);
+		snapshot->power = vexDeviceMotorPowerGet(device_info);
+		snapshot->torque = vexDeviceMotorTorqueGet(device_info);
+		snapshot->efficiency = vexDeviceMotorEfficiencyGet(device_info);
+		snapshot->temperature = vexDeviceMotorTemperatureGet(device_info);
+		snapshot->current_draw = vexDeviceMotorCurrentGet(device_info);
+		snapshot->voltage = vexDeviceMotorVoltageGet(device_info);
+		snapshot->direction = vexDeviceMotorDirectionGet(device_info);
+		snapshot->faults = vexDeviceMotorFaultsGet(device_info);
+		snapshot->flags = vexDeviceMotorFlagsGet(device_info);
+		snapshot->timestamp = now;
+		snapshot->updated_us = vdml_update_times[i];
+		if (unlikely(fault_watched_ports & (1 << i))) fault_check(i, snapshot->faults);
+		snapshot->raw_position = vexDeviceMotorPositionRawGet(device_info, NULL);
+		snapshot->scaled_position = ((int64_t)snapshot->raw_position * position_scales[i]) >> 16;
+		total_current += snapshot->current_draw;
+		motors |= 1 << i;
+		if (record && (telemetry_mask & (1 << i))) telemetry_record(i, snapshot);
+		if (motor_controllers[i].enabled) motor_controller_update(&motor_controllers[i], snapshot, device_info);
+	}
+	motor_total_current = total_current;
+	motor_snapshot_ports = motors | replayed;
+	if (trajectory_ports || trajectory_stop_ports) trajectories_update(now);
+	if (active_syncs != NULL || sync_restore_ports) syncs_update(motors);
+	if (current_budget) {
+		current_budget_allocate(motors);
+	} else if (unlikely(budget_restore)) {
+		// Give every motor back the limit it was set to
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(motors & (1 << i)) || requested_limits[i] == 0) continue;
+			vexDeviceMotorCurrentLimitSet(registry_get_device(i)->device_info, requested_limits[i]);
+		}
+		budget_restore = false;
+	}
+}
+
+int32_t motor_current_budget_enable(const int32_t total) {
+	if (total <= 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (!current_budget) {
+		// Force every motor's limit to be sent on the first cycle
+		for (int i = 0; i < NUM_V5_PORTS; i++) applied_limits[i] = -MOTOR_CURRENT_BUDGET_STEP;
+	}
+	current_budget = total;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_current_budget_disable(void) {
+	rtos_suspend_all();
+	if (current_budget) budget_restore = true;
+	current_budget = 0;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_current_budget_set_priority(uint8_t port, const uint8_t priority) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	budget_priorities[port - 1] = priority;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_current_budget_get_allocation(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (!current_budget) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return applied_limits[port - 1];
+}
+
+// Used by battery_snapshot_capture(), straight after motor_snapshot_capture()
+int32_t motor_snapshot_total_current(void) {
+	return motor_total_current;
+}
+
+// Used by vdml_record_capture(), after motor_snapshot_capture()
+const motor_snapshot_s_t* motor_snapshot_peek(uint8_t port) {
+	return motor_snapshot_ports & (1 << port) ? &motor_snapshots[port] : NULL;
+}
+
+// Called by system/overload.c
+void motor_telemetry_set_shed(uint32_t factor) {
+	telemetry_shed = factor;
+}
+
+int32_t motor_telemetry_enable(uint32_t port_mask, uint32_t divisor) {
+	if (divisor == 0 || (port_mask >> NUM_V5_PORTS) != 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	telemetry_mask = port_mask;
+	telemetry_divisor = divisor;
+	telemetry_dropped = 0;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_telemetry_read(motor_telemetry_sample_s_t* const buffer, uint32_t count) {
+	if (buffer == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	uint32_t tail = telemetry_tail;
+	uint32_t available = telemetry_head - tail;
+	if (count > available) count = available;
+	compiler_barrier();
+	for (uint32_t i = 0; i < count; i++) {
+		buffer[i] = telemetry_buffer[(tail + i) % MOTOR_TELEMETRY_BUFFER_SIZE];
+	}
+	compiler_barrier();
+	telemetry_tail = tail + count;
+	return count;
+}
+
+uint32_t motor_telemetry_get_dropped(void) {
+	return telemetry_dropped;
+}
+
+int32_t motor_get_snapshot(uint8_t port, motor_snapshot_s_t* const snapshot) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (registry_get_bound_type(port - 1) != E_DEVICE_MOTOR && !vdml_replaying(port - 1, E_DEVICE_MOTOR)) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(snapshot, &motor_snapshots[port - 1]);
+	if (snapshot->timestamp == 0) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+int32_t motor_set_position_scale(uint8_t port, const int32_t scale) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	position_scales[port - 1] = scale;
+	return 1;
+}
+
+int32_t motor_on_fault(uint8_t port, const uint32_t mask, motor_fault_fn_t callback, void* param) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (callback != NULL && mask == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	fault_handlers[port - 1] = (fault_handler_s_t){.callback = callback, .param = param, .mask = mask};
+	// Start from no faults, so the ones already raised are reported
+	fault_last[port - 1] = 0;
+	fault_pending_changes[port - 1] = 0;
+	fault_pending_ports &= ~(1 << (port - 1));
+	if (callback != NULL) {
+		fault_watched_ports |= 1 << (port - 1);
+	} else {
+		fault_watched_ports &= ~(1 << (port - 1));
+	}
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t motor_get_scaled_positions(uint32_t port_mask, int32_t* const positions, uint32_t* const timestamp) {
+	if (port_mask == 0 || (port_mask >> NUM_V5_PORTS) != 0 || positions == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	uint32_t gen, time;
+	int32_t count;
+	bool missing;
+	// Like vdml_snapshot_read(), but the whole set has to come from one cycle
+	do {
+		gen = vdml_snapshot_gen;
+		compiler_barrier();
+		count = 0;
+		time = 0;
+		missing = false;
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (!(port_mask & (1 << i))) continue;
+			const motor_snapshot_s_t* const snapshot = &motor_snapshots[i];
+			if (snapshot->timestamp == 0) missing = true;
+			if (snapshot->timestamp > time) time = snapshot->timestamp;
+			positions[count++] = snapshot->scaled_position;
+		}
+		compiler_barrier();
+	} while (gen != vdml_snapshot_gen);
+	if (missing) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	if (timestamp != NULL) *timestamp = time;
+	return count;
+}
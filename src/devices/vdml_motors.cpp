@@ -171,6 +171,53 @@ std::int32_t Motor::get_voltage_limit(void) const {
 	return motor_get_voltage_limit(_port);
 }
 
+motor_state_s_t Motor::get_state(void) const {
+	motor_state_s_t rtn;
+	if (motor_get_state(_port, &rtn) == PROS_ERR) {
+		rtn.position = rtn.velocity = rtn.target_position = rtn.power = rtn.torque = PROS_ERR_F;
+		rtn.efficiency = rtn.temperature = PROS_ERR_F;
+		rtn.target_velocity = rtn.current_draw = rtn.voltage = rtn.direction = PROS_ERR;
+		rtn.faults = rtn.flags = PROS_ERR;
+	}
+	return rtn;
+}
+
+motor_snapshot_s_t Motor::snapshot(void) const {
+	motor_snapshot_s_t rtn;
+	if (motor_get_snapshot(_port, &rtn) == PROS_ERR) {
+		rtn.position = rtn.velocity = rtn.power = rtn.torque = PROS_ERR_F;
+		rtn.efficiency = rtn.temperature = PROS_ERR_F;
+		rtn.current_draw = rtn.voltage = rtn.direction = PROS_ERR;
+		rtn.faults = rtn.flags = rtn.raw_position = rtn.scaled_position = PROS_ERR;
+		rtn.timestamp = rtn.updated_us = 0;
+	}
+	return rtn;
+}
+
+std::int32_t Motor::set_position_scale(const std::int32_t scale) const {
+	return motor_set_position_scale(_port, scale);
+}
+
+std::int32_t Motor::on_fault(const std::uint32_t mask, motor_fault_fn_t callback, void* param) const {
+	return motor_on_fault(_port, mask, callback, param);
+}
+
+std::int32_t Motor::enable_controller(const motor_controller_s_t& controller) const {
+	return motor_controller_enable(_port, &controller);
+}
+
+std::int32_t Motor::set_controller_target(const double target) const {
+	return motor_controller_set_target(_port, target);
+}
+
+std::int32_t Motor::disable_controller(void) const {
+	return motor_controller_disable(_port);
+}
+
+std::int32_t Motor::set_command_batching(const bool enable) const {
+	return motor_set_command_batching(_port, enable);
+}
+
 std::uint8_t Motor::get_port(void) const {
 	return _port;
 }
@@ -232,6 +279,60 @@ std::int32_t Motor::set_voltage_limit(const std::int32_t limit) const {
 	return motor_set_voltage_limit(_port, limit);
 }
 
+MotorGroup::MotorGroup(const std::initializer_list<std::int8_t> ports) : _ports(ports) {}
+
+MotorGroup::MotorGroup(const std::vector<std::int8_t>& ports) : _ports(ports) {}
+
+std::int32_t MotorGroup::operator=(std::int32_t voltage) const {
+	return motor_group_move(_ports.data(), _ports.size(), voltage);
+}
+
+std::int32_t MotorGroup::move(std::int32_t voltage) const {
+	return motor_group_move(_ports.data(), _ports.size(), voltage);
+}
+
+std::int32_t MotorGroup::move_absolute(const double position, const std::int32_t velocity) const {
+	return motor_group_move_absolute(_ports.data(), _ports.size(), position, velocity);
+}
+
+std::int32_t MotorGroup::move_relative(const double position, const std::int32_t velocity) const {
+	return motor_group_move_relative(_ports.data(), _ports.size(), position, velocity);
+}
+
+std::int32_t MotorGroup::move_velocity(const std::int32_t velocity) const {
+	return motor_group_move_velocity(_ports.data(), _ports.size(), velocity);
+}
+
+std::int32_t MotorGroup::move_voltage(const std::int32_t voltage) const {
+	return motor_group_move_voltage(_ports.data(), _ports.size(), voltage);
+}
+
+std::int32_t MotorGroup::sync_enable(const motor_sync_gains_s_t& gains) const {
+	return motor_group_sync_enable(_ports.data(), _ports.size(), &gains);
+}
+
+std::int32_t MotorGroup::sync_set_gains(const motor_sync_gains_s_t& gains) const {
+	return motor_group_sync_set_gains(_ports.data(), _ports.size(), &gains);
+}
+
+motor_sync_stats_s_t MotorGroup::sync_get_stats(void) const {
+	motor_sync_stats_s_t stats = {};
+	motor_group_sync_get_stats(_ports.data(), _ports.size(), &stats);
+	return stats;
+}
+
+std::int32_t MotorGroup::sync_disable(void) const {
+	return motor_group_sync_disable(_ports.data(), _ports.size());
+}
+
+std::vector<std::int8_t> MotorGroup::get_ports(void) const {
+	return _ports;
+}
+
+std::uint8_t MotorGroup::size(void) const {
+	return _ports.size();
+}
+
 namespace literals {
 const pros::Motor operator"" _mtr(const unsigned long long int m) {
 	return pros::Motor(m, false);
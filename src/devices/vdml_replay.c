@@ -0,0 +1,303 @@
+/**
+ * \file devices/vdml_replay.c
+ *
+ * Device recording and replay
+ *
+ * While recording, vdml_record_capture() packs the readings of the selected
+ * devices which changed this daemon cycle into a frame and queues it on a
+ * message buffer, which a background task drains onto the vrec stream. The
+ * daemon never waits for the serial line; a frame which doesn't fit is
+ * dropped.
+ *
+ * While replaying, vdml_replay_capture() walks the recording as the daemon
+ * cycles pass and copies each due entry into that port's replayed readings,
+ * marking the port's replay_type in the registry. The getters check that before
+ * claiming the port, see vdml_replaying().
+ *
+ * Both run from vdml_snapshot_capture() with the scheduler suspended, so the
+ * state below is only changed with the scheduler suspended too.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "rtos/message_buffer.h"
+#include "system/dev/ser.h"
+#include "v5_api.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+#define INTERNAL_ADI_PORT (22 - 1)
+#define RECORD_BUFFER_SIZE 4096
+
+typedef struct __attribute__((packed)) record_header {
+	uint32_t cycle;
+	uint32_t time;
+} record_header_s_t;
+
+typedef struct __attribute__((packed)) record_entry {
+	uint8_t port;  // 1-22
+	uint8_t type;  // a v5_device_e_t
+	uint16_t len;
+} record_entry_s_t;
+
+typedef union replay_readings {
+	motor_snapshot_s_t motor;
+	imu_state_s_t imu;
+	int32_t adi[NUM_ADI_PORTS];
+} replay_readings_u_t;
+
+// from vdml_motors.c and vdml_imu.c
+extern const motor_snapshot_s_t* motor_snapshot_peek(uint8_t port);
+extern void imu_state_read(V5_DeviceT device_info, imu_state_s_t* const state);
+
+static uint32_t record_mask;
+static uint32_t record_cycle;
+static uint32_t record_dropped;
+static msg_buf_t record_frames;
+
+static const uint8_t* replay_data;
+static size_t replay_len;
+static size_t replay_pos;  // where the next frame's length is
+static uint32_t replay_cycle;
+static uint32_t replay_remaining;
+static replay_readings_u_t* replay_readings;  // allocated on the first replay and kept
+
+static task_stack_t record_task_stack[TASK_STACK_DEPTH_MIN];
+static static_task_s_t record_task_buffer;
+
+/******************************************************************************/
+/**                                Recording                                 **/
+/******************************************************************************/
+
+static void record_task_fn(void* ign) {
+	static uint8_t frame[VDML_RECORD_FRAME_SIZE];
+	while (true) {
+		size_t len = msg_buf_recv(record_frames, frame, sizeof(frame), TIMEOUT_MAX);
+		if (len) ser_frame_write(VDML_RECORD_STREAM_ID, frame, len);
+	}
+}
+
+// Appends an entry to the frame, returning false if it doesn't fit
+static bool record_put(uint8_t* frame, size_t* len, uint8_t port, v5_device_e_t type, const void* data,
+                       uint16_t size) {
+	if (*len + sizeof(record_entry_s_t) + size > VDML_RECORD_FRAME_SIZE) {
+		record_dropped++;
+		return false;
+	}
+	const record_entry_s_t entry = {.port = port + 1, .type = type, .len = size};
+	memcpy(frame + *len, &entry, sizeof(entry));
+	memcpy(frame + *len + sizeof(entry), data, size);
+	*len += sizeof(entry) + size;
+	return true;
+}
+
+void vdml_record_capture(uint32_t updated) {
+	uint32_t const ports = record_mask & updated;
+	record_cycle++;
+	if (likely(!ports)) return;
+
+	static uint8_t frame[VDML_RECORD_FRAME_SIZE];
+	const record_header_s_t header = {.cycle = record_cycle, .time = millis()};
+	memcpy(frame, &header, sizeof(header));
+	size_t len = sizeof(header);
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(ports & (1 << i))) continue;
+		if (i == INTERNAL_ADI_PORT) {
+			int32_t values[NUM_ADI_PORTS];
+			V5_DeviceT device_info = registry_get_device_internal(i)->device_info;
+			bool const replayed = vdml_replaying(i, E_DEVICE_ADI);
+			for (int port = 0; port < NUM_ADI_PORTS; port++) {
+				values[port] = replayed ? vdml_replay_adi(port) : vexDeviceAdiValueGet(device_info, port);
+			}
+			record_put(frame, &len, i, E_DEVICE_ADI, values, sizeof(values));
+		} else if (vdml_replaying(i, E_DEVICE_IMU)) {
+			record_put(frame, &len, i, E_DEVICE_IMU, vdml_replay_imu(i), sizeof(imu_state_s_t));
+		} else if (registry_get_plugged_type(i) == E_DEVICE_IMU) {
+			V5_DeviceT device_info = registry_get_device(i)->device_info;
+			if (vexDeviceImuStatusGet(device_info) & E_IMU_STATUS_CALIBRATING) continue;
+			imu_state_s_t state;
+			imu_state_read(device_info, &state);
+			state.port = i + 1;
+			state.updated_us = vdml_update_times[i];
+			record_put(frame, &len, i, E_DEVICE_IMU, &state, sizeof(state));
+		} else {
+			const motor_snapshot_s_t* const snapshot = motor_snapshot_peek(i);
+			if (snapshot != NULL) record_put(frame, &len, i, E_DEVICE_MOTOR, snapshot, sizeof(*snapshot));
+		}
+	}
+	if (len > sizeof(header) && msg_buf_send(record_frames, frame, len, 0) == 0) record_dropped++;
+}
+
+int32_t vdml_record_start(uint32_t port_mask) {
+	if (port_mask == 0 || port_mask >> NUM_V5_PORTS) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (record_frames == NULL) {
+		msg_buf_t const frames = xMessageBufferCreate(RECORD_BUFFER_SIZE);
+		if (frames == NULL) {
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+		rtos_suspend_all();
+		if (record_frames == NULL) {
+			record_frames = frames;
+			task_create_static(record_task_fn, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_MIN,
+			                   "Device Recorder (PROS)", record_task_stack, &record_task_buffer);
+		} else {
+			vMessageBufferDelete(frames);
+		}
+		rtos_resume_all();
+	}
+	rtos_suspend_all();
+	record_mask = port_mask;
+	record_cycle = 0;
+	record_dropped = 0;
+	rtos_resume_all();
+	return 1;
+}
+
+void vdml_record_stop(void) {
+	record_mask = 0;
+}
+
+uint32_t vdml_record_get_dropped(void) {
+	return record_dropped;
+}
+
+/******************************************************************************/
+/**                                  Replay                                  **/
+/******************************************************************************/
+
+const motor_snapshot_s_t* vdml_replay_motor(uint8_t port) {
+	return &replay_readings[port].motor;
+}
+
+const imu_state_s_t* vdml_replay_imu(uint8_t port) {
+	return &replay_readings[port].imu;
+}
+
+int32_t vdml_replay_adi(uint8_t adi_port) {
+	return replay_readings[INTERNAL_ADI_PORT].adi[adi_port];
+}
+
+static size_t replay_entry_size(v5_device_e_t type) {
+	switch (type) {
+		case E_DEVICE_MOTOR:
+			return sizeof(motor_snapshot_s_t);
+		case E_DEVICE_IMU:
+			return sizeof(imu_state_s_t);
+		case E_DEVICE_ADI:
+			return sizeof(int32_t[NUM_ADI_PORTS]);
+		default:
+			return 0;
+	}
+}
+
+// Copies the frame's entries into the replayed readings, returning the ports given new readings
+static uint32_t replay_apply(const uint8_t* frame, uint32_t len) {
+	uint32_t updated = 0;
+	for (uint32_t pos = sizeof(record_header_s_t); pos + sizeof(record_entry_s_t) <= len;) {
+		record_entry_s_t entry;
+		memcpy(&entry, frame + pos, sizeof(entry));
+		pos += sizeof(entry);
+		if (pos + entry.len > len) break;
+		uint8_t const port = entry.port - 1;
+		v5_device_e_t const type = entry.type;
+		// A port keeps the type it was first replayed as, and the built-in ADI is only ever an ADI
+		bool const valid = VALIDATE_PORT_NO(port) && entry.len == replay_entry_size(type) &&
+		                   (port == INTERNAL_ADI_PORT) == (type == E_DEVICE_ADI) &&
+		                   (registry_devices[port].replay_type == E_DEVICE_NONE || registry_devices[port].replay_type == type);
+		if (valid) {
+			memcpy(&replay_readings[port], frame + pos, entry.len);
+			registry_devices[port].replay_type = type;
+			updated |= 1 << port;
+		}
+		pos += entry.len;
+	}
+	return updated;
+}
+
+uint32_t vdml_replay_capture(void) {
+	if (likely(replay_data == NULL)) return 0;
+	replay_cycle++;
+	uint32_t updated = 0;
+	while (replay_pos < replay_len) {
+		uint32_t len;
+		record_header_s_t header;
+		memcpy(&len, replay_data + replay_pos, sizeof(len));
+		memcpy(&header, replay_data + replay_pos + sizeof(len), sizeof(header));
+		if (header.cycle > replay_cycle) break;
+		updated |= replay_apply(replay_data + replay_pos + sizeof(len), len);
+		replay_pos += sizeof(len) + len;
+		replay_remaining--;
+	}
+	return updated;
+}
+
+int32_t vdml_replay_start(const void* recording, size_t len) {
+	if (recording == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Check the frames up front, so the daemon never reads past the end
+	const uint8_t* const data = recording;
+	int32_t frames = 0;
+	for (size_t pos = 0; pos < len; frames++) {
+		uint32_t frame_len = 0;
+		if (len - pos >= sizeof(frame_len)) {
+			memcpy(&frame_len, data + pos, sizeof(frame_len));
+			pos += sizeof(frame_len);
+		}
+		if (frame_len < sizeof(record_header_s_t) || frame_len > len - pos) {
+			errno = EINVAL;
+			return PROS_ERR;
+		}
+		pos += frame_len;
+	}
+	if (replay_readings == NULL) {
+		replay_readings_u_t* readings = kmalloc(NUM_V5_PORTS * sizeof(*readings));
+		if (readings == NULL) {
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+		rtos_suspend_all();
+		if (replay_readings == NULL) {
+			replay_readings = readings;
+			readings = NULL;
+		}
+		rtos_resume_all();
+		kfree(readings);
+	}
+	rtos_suspend_all();
+	for (int i = 0; i < NUM_V5_PORTS; i++) registry_devices[i].replay_type = E_DEVICE_NONE;
+	replay_data = data;
+	replay_len = len;
+	replay_pos = 0;
+	replay_cycle = 0;
+	replay_remaining = frames;
+	rtos_resume_all();
+	return frames;
+}
+
+void vdml_replay_stop(void) {
+	rtos_suspend_all();
+	for (int i = 0; i < NUM_V5_PORTS; i++) registry_devices[i].replay_type = E_DEVICE_NONE;
+	replay_data = NULL;
+	replay_len = 0;
+	replay_pos = 0;
+	replay_remaining = 0;
+	rtos_resume_all();
+}
+
+uint32_t vdml_replay_get_remaining(void) {
+	return replay_remaining;
+}
@@ -16,10 +16,190 @@
 
 #include "kapi.h"
 #include "pros/serial.h"
+#include "system/dev/vfs.h"
 #include "v5_api.h"
 #include "vdml/registry.h"
 #include "vdml/vdml.h"
 
+#define SERIAL_RX_BUFFER_SIZE 512
+#define SERIAL_TX_BUFFER_SIZE 1024
+
+// Data received on generic serial ports is moved into these buffers by the
+// system daemon every cycle. A reader blocked on a buffer is woken with a task
+// notification as soon as data arrives, instead of polling VEXos.
+// Created by serial_enable
+typedef struct serial_rx {
+	stream_buf_t stream;
+	// Stream buffers only support one reader at a time. Functions which hold the
+	// port's mutex never wait on this, since a reader blocked in serial_rx_read
+	// holds it until the daemon (which needs every port mutex) delivers data
+	mutex_t lock;
+	uint32_t size;  // picked by serial_set_buffer_sizes, 0 for the default
+	// Only changed by the daemon
+	uint32_t bytes;
+	uint32_t overflows;
+	uint32_t peak;
+} serial_rx_s_t;
+
+static serial_rx_s_t serial_rx[NUM_V5_PORTS];
+
+// Data to transmit is queued here and handed to VEXos by the system daemon as
+// space frees up, so writers never wait on the port. Created by serial_enable
+typedef struct serial_tx {
+	stream_buf_t stream;
+	// Stream buffers only support one writer at a time. Like the receive lock,
+	// this is never waited on while holding the port's mutex
+	mutex_t lock;
+	uint32_t size;
+	uint32_t bytes;      // only changed by the daemon
+	uint32_t overflows;  // only changed with the lock held
+	uint32_t peak;
+} serial_tx_s_t;
+
+static serial_tx_s_t serial_tx[NUM_V5_PORTS];
+
+// comes from vdml_serial_frame.c
+extern int32_t serial_frame_space(uint8_t port);
+extern void serial_frame_feed(uint8_t port, const uint8_t* data, size_t len);
+
+// called by the system daemon with every port mutex held
+void serial_rx_drain(void) {
+	uint8_t chunk[64];
+	bool received = false;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (serial_rx[i].stream == NULL || registry_get_plugged_type(i) != E_DEVICE_GENERIC) continue;
+		serial_rx_s_t* const rx = &serial_rx[i];
+		V5_DeviceT device_info = registry_get_device(i)->device_info;
+		while (1) {
+			int32_t len = vexDeviceGenericSerialReceiveAvail(device_info);
+			// framed ports are decoded into frames instead of buffered as bytes
+			int32_t frame_space = serial_frame_space(i);
+			size_t space = frame_space >= 0 ? (size_t)frame_space : stream_buf_get_unused(rx->stream);
+			// whatever doesn't fit stays in the VEXos buffer until there's space,
+			// which VEXos overruns if the reader doesn't catch up
+			if (len > 0 && space == 0) rx->overflows++;
+			if ((size_t)len > space) len = space;
+			if (len > (int32_t)sizeof(chunk)) len = sizeof(chunk);
+			if (len <= 0) break;
+			len = vexDeviceGenericSerialReceive(device_info, chunk, len);
+			if (len <= 0) break;
+			if (frame_space >= 0) {
+				serial_frame_feed(i, chunk, len);
+			} else {
+				stream_buf_send(rx->stream, chunk, len, 0);
+			}
+			rx->bytes += len;
+			received = true;
+		}
+		size_t const used = stream_buf_get_used(rx->stream);
+		if (used > rx->peak) rx->peak = used;
+	}
+	if (received) vfs_poll_notify();
+}
+
+bool serial_rx_enabled(uint8_t port) {
+	return serial_rx[port].stream != NULL;
+}
+
+// called by the system daemon with every port mutex held
+void serial_tx_drain(void) {
+	bool sent_any = false;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (serial_tx[i].stream == NULL || registry_get_plugged_type(i) != E_DEVICE_GENERIC) continue;
+		V5_DeviceT device_info = registry_get_device(i)->device_info;
+		size_t const used = stream_buf_get_used(serial_tx[i].stream);
+		if (used > serial_tx[i].peak) serial_tx[i].peak = used;
+		int32_t free = vexDeviceGenericSerialWriteFree(device_info);
+		// Hand the queue's memory straight to VEXos. Two passes cover data which
+		// wraps around the end of the buffer
+		for (int pass = 0; pass < 2 && free > 0; pass++) {
+			uint8_t* data;
+			size_t len = stream_buf_peek_contiguous(serial_tx[i].stream, &data);
+			if (len == 0) break;
+			if (len > (size_t)free) len = free;
+			int32_t sent = vexDeviceGenericSerialTransmit(device_info, data, len);
+			if (sent <= 0) break;
+			stream_buf_consume(serial_tx[i].stream, sent);
+			serial_tx[i].bytes += sent;
+			free -= sent;
+			sent_any = true;
+			if ((size_t)sent < len) break;
+		}
+	}
+	if (sent_any) vfs_poll_notify();
+}
+
+size_t serial_rx_get_used(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1) || serial_rx[port - 1].stream == NULL) return 0;
+	return stream_buf_get_used(serial_rx[port - 1].stream);
+}
+
+size_t serial_tx_get_unused(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1) || serial_tx[port - 1].stream == NULL) return 0;
+	return stream_buf_get_unused(serial_tx[port - 1].stream);
+}
+
+// Queues data on a port's transmit queue. If atomic is set, nothing is queued
+// unless all of it fits right away. Otherwise as much as fits before the
+// timeout is queued. port is 0-indexed
+int32_t serial_tx_enqueue(uint8_t port, const serial_iovec_s_t* iov, size_t count, bool atomic, uint32_t timeout) {
+	serial_tx_s_t* tx = &serial_tx[port];
+	if (tx->stream == NULL) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	if (!mutex_take(tx->lock, timeout)) {
+		errno = EACCES;
+		return PROS_ERR;
+	}
+	if (atomic) {
+		size_t total = 0;
+		for (size_t i = 0; i < count; i++) total += iov[i].length;
+		if (total > stream_buf_get_unused(tx->stream)) {
+			tx->overflows++;
+			mutex_give(tx->lock);
+			errno = EAGAIN;
+			return PROS_ERR;
+		}
+	}
+	int32_t queued = 0;
+	for (size_t i = 0; i < count; i++) {
+		size_t n = iov[i].length ? stream_buf_send(tx->stream, iov[i].data, iov[i].length, timeout) : 0;
+		queued += n;
+		if (n < iov[i].length) {
+			tx->overflows++;
+			break;
+		}
+	}
+	mutex_give(tx->lock);
+	return queued;
+}
+
+int32_t serial_tx_write(uint8_t port, const uint8_t* buffer, int32_t length, uint32_t timeout) {
+	if (!VALIDATE_PORT_NO(port - 1) || length < 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	const serial_iovec_s_t iov = {.data = buffer, .length = length};
+	return serial_tx_enqueue(port - 1, &iov, 1, false, timeout);
+}
+
+int32_t serial_rx_read(uint8_t port, uint8_t* buffer, int32_t length, uint32_t timeout) {
+	if (!VALIDATE_PORT_NO(port - 1) || length < 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	if (rx->stream == NULL) {
+		errno = ENODEV;
+		return PROS_ERR;
+	}
+	mutex_take(rx->lock, TIMEOUT_MAX);
+	int32_t rtn = stream_buf_recv(rx->stream, buffer, length, timeout);
+	mutex_give(rx->lock);
+	return rtn;
+}
+
 // Control function
 
 int32_t serial_enable(uint8_t port) {
@@ -39,6 +219,64 @@ int32_t serial_enable(uint8_t port) {
 		return PROS_ERR;
 	}
 	vexDeviceGenericSerialEnable(device->device_info, 0);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	if (rx->stream == NULL) {
+		rx->lock = mutex_create();
+		rx->stream = stream_buf_create(rx->size ? rx->size : SERIAL_RX_BUFFER_SIZE, 1);
+	}
+	serial_tx_s_t* tx = &serial_tx[port - 1];
+	if (tx->stream == NULL) {
+		tx->lock = mutex_create();
+		tx->stream = stream_buf_create(tx->size ? tx->size : SERIAL_TX_BUFFER_SIZE, 1);
+	}
+	if (rx->stream == NULL || tx->stream == NULL) {
+		errno = ENOMEM;
+		return_port(port - 1, PROS_ERR);
+	}
+	return_port(port - 1, 1);
+}
+
+int32_t serial_set_buffer_sizes(uint8_t port, uint32_t rx_size, uint32_t tx_size) {
+	if (!VALIDATE_PORT_NO(port - 1) || rx_size > SERIAL_MAX_BUFFER_SIZE || tx_size > SERIAL_MAX_BUFFER_SIZE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (!port_mutex_take(port - 1)) {
+		errno = EACCES;
+		return PROS_ERR;
+	}
+	// Readers and writers wait on the buffers without the port's mutex, so they
+	// can't be swapped out from under them
+	if (serial_rx[port - 1].stream != NULL || serial_tx[port - 1].stream != NULL) {
+		errno = EBUSY;
+		return_port(port - 1, PROS_ERR);
+	}
+	serial_rx[port - 1].size = rx_size;
+	serial_tx[port - 1].size = tx_size;
+	return_port(port - 1, 1);
+}
+
+int32_t serial_get_buffer_stats(uint8_t port, serial_buffer_stats_s_t* stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_port_i(port - 1, E_DEVICE_GENERIC);
+	(void)device;  // only the port's lock is needed
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	serial_tx_s_t* tx = &serial_tx[port - 1];
+	if (rx->stream == NULL) {
+		errno = ENODEV;
+		return_port(port - 1, PROS_ERR);
+	}
+	*stats = (serial_buffer_stats_s_t){.rx_size = rx->size ? rx->size : SERIAL_RX_BUFFER_SIZE,
+	                                   .tx_size = tx->size ? tx->size : SERIAL_TX_BUFFER_SIZE,
+	                                   .rx_bytes = rx->bytes,
+	                                   .tx_bytes = tx->bytes,
+	                                   .rx_overflows = rx->overflows,
+	                                   .tx_overflows = tx->overflows,
+	                                   .rx_peak = rx->peak,
+	                                   .tx_peak = tx->peak};
 	return_port(port - 1, 1);
 }
 
@@ -51,6 +289,11 @@ int32_t serial_set_baudrate(uint8_t port, int32_t baudrate) {
 int32_t serial_flush(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
 	vexDeviceGenericSerialFlush(device->device_info);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	if (rx->stream != NULL && mutex_take(rx->lock, 0)) {
+		stream_buf_reset(rx->stream);
+		mutex_give(rx->lock);
+	}
 	return_port(port - 1, 1);
 }
 
@@ -58,13 +301,17 @@ int32_t serial_flush(uint8_t port) {
 
 int32_t serial_get_read_avail(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
-	int32_t rtn = vexDeviceGenericSerialReceiveAvail(device->device_info);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	int32_t rtn = rx->stream != NULL ? (int32_t)stream_buf_get_used(rx->stream)
+	                                 : vexDeviceGenericSerialReceiveAvail(device->device_info);
 	return_port(port - 1, rtn);
 }
 
 int32_t serial_get_write_free(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
-	int32_t rtn = vexDeviceGenericSerialWriteFree(device->device_info);
+	serial_tx_s_t* tx = &serial_tx[port - 1];
+	int32_t rtn = tx->stream != NULL ? (int32_t)stream_buf_get_unused(tx->stream)
+	                                 : vexDeviceGenericSerialWriteFree(device->device_info);
 	return_port(port - 1, rtn);
 }
 
@@ -72,19 +319,51 @@ int32_t serial_get_write_free(uint8_t port) {
 
 int32_t serial_peek_byte(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
-	int32_t rtn = vexDeviceGenericSerialPeekChar(device->device_info);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	int32_t rtn;
+	if (rx->stream != NULL) {
+		uint8_t* data;
+		rtn = -1;
+		if (mutex_take(rx->lock, 0)) {
+			rtn = stream_buf_peek_contiguous(rx->stream, &data) ? *data : -1;
+			mutex_give(rx->lock);
+		}
+	} else {
+		rtn = vexDeviceGenericSerialPeekChar(device->device_info);
+	}
 	return_port(port - 1, rtn);
 }
 
 int32_t serial_read_byte(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
-	int32_t rtn = vexDeviceGenericSerialReadChar(device->device_info);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	int32_t rtn;
+	if (rx->stream != NULL) {
+		uint8_t b;
+		rtn = -1;
+		if (mutex_take(rx->lock, 0)) {
+			rtn = stream_buf_recv(rx->stream, &b, 1, 0) ? b : -1;
+			mutex_give(rx->lock);
+		}
+	} else {
+		rtn = vexDeviceGenericSerialReadChar(device->device_info);
+	}
 	return_port(port - 1, rtn);
 }
 
 int32_t serial_read(uint8_t port, uint8_t* buffer, int32_t length) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
-	int32_t rtn = vexDeviceGenericSerialReceive(device->device_info, buffer, length);
+	serial_rx_s_t* rx = &serial_rx[port - 1];
+	int32_t rtn;
+	if (rx->stream != NULL) {
+		rtn = 0;
+		if (mutex_take(rx->lock, 0)) {
+			rtn = stream_buf_recv(rx->stream, buffer, length, 0);
+			mutex_give(rx->lock);
+		}
+	} else {
+		rtn = vexDeviceGenericSerialReceive(device->device_info, buffer, length);
+	}
 	return_port(port - 1, rtn);
 }
 
@@ -92,6 +371,10 @@ int32_t serial_read(uint8_t port, uint8_t* buffer, int32_t length) {
 
 int32_t serial_write_byte(uint8_t port, uint8_t buffer) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
+	if (serial_tx[port - 1].stream != NULL) {
+		const serial_iovec_s_t iov = {.data = &buffer, .length = 1};
+		return_port(port - 1, serial_tx_enqueue(port - 1, &iov, 1, false, 0));
+	}
 	int32_t rtn = vexDeviceGenericSerialWriteChar(device->device_info, buffer);
 	if (rtn == -1) {
 		errno = EIO;
@@ -102,6 +385,10 @@ int32_t serial_write_byte(uint8_t port, uint8_t buffer) {
 
 int32_t serial_write(uint8_t port, uint8_t* buffer, int32_t length) {
 	claim_port_i(port - 1, E_DEVICE_GENERIC);
+	if (serial_tx[port - 1].stream != NULL) {
+		const serial_iovec_s_t iov = {.data = buffer, .length = length};
+		return_port(port - 1, serial_tx_enqueue(port - 1, &iov, 1, false, 0));
+	}
 	int32_t rtn = vexDeviceGenericSerialTransmit(device->device_info, buffer, length);
 	if (rtn == -1) {
 		errno = EIO;
@@ -109,3 +396,11 @@ int32_t serial_write(uint8_t port, uint8_t* buffer, int32_t length) {
 	}
 	return_port(port - 1, rtn);
 }
+
+int32_t serial_writev(uint8_t port, const serial_iovec_s_t* iov, int32_t count) {
+	if (!VALIDATE_PORT_NO(port - 1) || iov == NULL || count < 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return serial_tx_enqueue(port - 1, iov, count, true, 0);
+}
@@ -65,6 +65,30 @@ std::int32_t Serial::write(std::uint8_t* buffer, std::int32_t length) const {
 	return serial_write(_port, buffer, length);
 }
 
+std::int32_t Serial::set_framing(serial_framing_e_t framing) const {
+	return serial_set_framing(_port, framing);
+}
+
+std::int32_t Serial::read_frame(std::uint8_t* buffer, std::int32_t max_length, std::uint32_t timeout) const {
+	return serial_read_frame(_port, buffer, max_length, timeout);
+}
+
+std::int32_t Serial::write_frame(const std::uint8_t* data, std::int32_t length) const {
+	return serial_write_frame(_port, data, length);
+}
+
+std::int32_t Serial::writev(const serial_iovec_s_t* iov, std::int32_t count) const {
+	return serial_writev(_port, iov, count);
+}
+
+std::int32_t Serial::set_buffer_sizes(std::uint32_t rx_size, std::uint32_t tx_size) const {
+	return serial_set_buffer_sizes(_port, rx_size, tx_size);
+}
+
+std::int32_t Serial::get_buffer_stats(serial_buffer_stats_s_t* stats) const {
+	return serial_get_buffer_stats(_port, stats);
+}
+
 namespace literals {
 const pros::Serial operator"" _ser(const unsigned long long int m) {
 	return pros::Serial(m);
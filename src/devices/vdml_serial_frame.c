@@ -0,0 +1,349 @@
+/**
+ * \file devices/vdml_serial_frame.c
+ *
+ * Contains the framing layer for V5 Generic Serial devices.
+ *
+ * The system daemon feeds the data it receives on a framed port through the
+ * port's decoder (see serial_rx_drain) and places each complete frame in a
+ * message buffer, so a reader is woken once per frame. RPC responses are
+ * handed to vdml_serial_rpc.c instead.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "common/cobs.h"
+#include "common/crc.h"
+#include "kapi.h"
+#include "pros/serial.h"
+#include "rtos/message_buffer.h"
+#include "v5_api.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+#define SERIAL_FRAME_BUFFER_SIZE 1024
+
+// comes from vdml_serial.c
+extern bool serial_rx_enabled(uint8_t port);
+extern int32_t serial_tx_enqueue(uint8_t port, const serial_iovec_s_t* iov, size_t count, bool atomic,
+                                 uint32_t timeout);
+// comes from vdml_serial_rpc.c
+extern bool serial_rpc_deliver(uint8_t port, const uint8_t* frame, size_t len);
+
+#define SLIP_END 0xc0
+#define SLIP_ESC 0xdb
+#define SLIP_ESC_END 0xdc
+#define SLIP_ESC_ESC 0xdd
+
+#define LENGTH_CRC_SYNC 0xa5
+// sync byte, length, payload and CRC
+#define LENGTH_CRC_OVERHEAD 5
+// the most parts serial_frame_writev takes
+#define FRAME_MAX_PARTS 4
+
+typedef struct serial_frame_state {
+	serial_framing_e_t framing;
+	uint8_t port;
+	msg_buf_t frames;
+	mutex_t lock;  // message buffers only support one reader at a time
+	uint32_t errors;
+	uint8_t buf[SERIAL_MAX_FRAME_SIZE];
+	size_t len;
+	union {
+		cobs_decoder_s_t cobs;
+		bool slip_escaped;
+		struct {
+			enum { E_LCRC_SYNC, E_LCRC_LENGTH_LO, E_LCRC_LENGTH_HI, E_LCRC_PAYLOAD, E_LCRC_CRC_LO, E_LCRC_CRC_HI } state;
+			uint16_t expected;
+			uint16_t crc;
+		} lcrc;
+	};
+} serial_frame_state_s_t;
+
+// Allocated by serial_set_framing. Only changed with the port's mutex held,
+// which the daemon also holds while decoding
+static serial_frame_state_s_t* frame_states[NUM_V5_PORTS];
+
+static void frame_reset(serial_frame_state_s_t* state) {
+	state->len = 0;
+	state->slip_escaped = false;
+	state->lcrc.state = E_LCRC_SYNC;
+	if (state->framing == E_SERIAL_FRAMING_COBS) {
+		cobs_decoder_init(&state->cobs, state->buf, sizeof(state->buf));
+	}
+}
+
+static void frame_complete(serial_frame_state_s_t* state, size_t len) {
+	if (len == 0) return;
+	if (state->buf[0] == SERIAL_RPC_RESPONSE && serial_rpc_deliver(state->port, state->buf, len)) return;
+	// the daemon made sure there's room before receiving this data
+	if (!msg_buf_send(state->frames, state->buf, len, 0)) state->errors++;
+}
+
+// Decodes one byte. Only called by the daemon
+static void frame_decode(serial_frame_state_s_t* state, uint8_t b) {
+	switch (state->framing) {
+		case E_SERIAL_FRAMING_COBS: {
+			bool invalid = state->cobs.invalid;
+			int32_t len = cobs_decode_byte(&state->cobs, b);
+			if (len > 0) {
+				frame_complete(state, len);
+			} else if (b == 0 && (invalid || state->cobs.remaining)) {
+				state->errors++;
+			}
+			break;
+		}
+		case E_SERIAL_FRAMING_SLIP:
+			if (b == SLIP_END) {
+				if (!state->slip_escaped) frame_complete(state, state->len);
+				state->len = 0;
+				state->slip_escaped = false;
+				break;
+			}
+			if (state->slip_escaped) {
+				state->slip_escaped = false;
+				b = b == SLIP_ESC_END ? SLIP_END : b == SLIP_ESC_ESC ? SLIP_ESC : b;
+			} else if (b == SLIP_ESC) {
+				state->slip_escaped = true;
+				break;
+			}
+			if (state->len < sizeof(state->buf)) {
+				state->buf[state->len++] = b;
+			} else {
+				// too long, drop everything until the next END
+				state->errors++;
+				state->slip_escaped = true;
+			}
+			break;
+		case E_SERIAL_FRAMING_LENGTH_CRC:
+			switch (state->lcrc.state) {
+				case E_LCRC_SYNC:
+					if (b == LENGTH_CRC_SYNC) state->lcrc.state = E_LCRC_LENGTH_LO;
+					break;
+				case E_LCRC_LENGTH_LO:
+					state->lcrc.expected = b;
+					state->lcrc.state = E_LCRC_LENGTH_HI;
+					break;
+				case E_LCRC_LENGTH_HI:
+					state->lcrc.expected |= (uint16_t)b << 8;
+					state->len = 0;
+					if (state->lcrc.expected == 0 || state->lcrc.expected > sizeof(state->buf)) {
+						// not a real header, look for the next sync byte
+						state->errors++;
+						state->lcrc.state = E_LCRC_SYNC;
+					} else {
+						state->lcrc.state = E_LCRC_PAYLOAD;
+					}
+					break;
+				case E_LCRC_PAYLOAD:
+					state->buf[state->len++] = b;
+					if (state->len == state->lcrc.expected) state->lcrc.state = E_LCRC_CRC_LO;
+					break;
+				case E_LCRC_CRC_LO:
+					state->lcrc.crc = b;
+					state->lcrc.state = E_LCRC_CRC_HI;
+					break;
+				case E_LCRC_CRC_HI: {
+					state->lcrc.crc |= (uint16_t)b << 8;
+					const uint8_t length[2] = {state->lcrc.expected & 0xff, state->lcrc.expected >> 8};
+					uint16_t crc = crc16_ccitt(crc16_ccitt(CRC16_CCITT_INIT, length, 2), state->buf, state->len);
+					if (crc == state->lcrc.crc) {
+						frame_complete(state, state->len);
+					} else {
+						state->errors++;
+					}
+					state->lcrc.state = E_LCRC_SYNC;
+					break;
+				}
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+// Called by serial_rx_drain with every port mutex held. Returns how many bytes
+// may be received for a framed port, or -1 if the port isn't framed
+int32_t serial_frame_space(uint8_t port) {
+	serial_frame_state_s_t* state = frame_states[port];
+	if (state == NULL || state->framing == E_SERIAL_FRAMING_NONE) return -1;
+	// Leave room for a whole frame plus the small frames the rest of a chunk can
+	// hold (each with its length) so decoded frames are never dropped. The rest
+	// stays in the VEXos buffer until the reader catches up
+	return xMessageBufferSpaceAvailable(state->frames) >= 2 * (SERIAL_MAX_FRAME_SIZE + sizeof(size_t))
+	           ? SERIAL_MAX_FRAME_SIZE
+	           : 0;
+}
+
+void serial_frame_feed(uint8_t port, const uint8_t* data, size_t len) {
+	serial_frame_state_s_t* state = frame_states[port];
+	for (size_t i = 0; i < len; i++) {
+		// the data bytes of a COBS block are copied in bulk, leaving only code
+		// bytes and delimiters to frame_decode
+		if (state->framing == E_SERIAL_FRAMING_COBS) {
+			i += cobs_decode_run(&state->cobs, data + i, len - i);
+			if (i == len) break;
+		}
+		frame_decode(state, data[i]);
+	}
+}
+
+int32_t serial_set_framing(uint8_t port, serial_framing_e_t framing) {
+	if (framing > E_SERIAL_FRAMING_LENGTH_CRC) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_port_i(port - 1, E_DEVICE_GENERIC);
+	(void)device;  // only the port's lock is needed
+	if (!serial_rx_enabled(port - 1)) {
+		errno = ENODEV;
+		return_port(port - 1, PROS_ERR);
+	}
+	serial_frame_state_s_t* state = frame_states[port - 1];
+	if (state == NULL && framing != E_SERIAL_FRAMING_NONE) {
+		state = kmalloc(sizeof(*state));
+		msg_buf_t frames = state ? xMessageBufferCreate(SERIAL_FRAME_BUFFER_SIZE) : NULL;
+		if (frames == NULL) {
+			kfree(state);
+			errno = ENOMEM;
+			return_port(port - 1, PROS_ERR);
+		}
+		memset(state, 0, sizeof(*state));
+		state->port = port - 1;
+		state->frames = frames;
+		state->lock = mutex_create();
+		frame_states[port - 1] = state;
+	}
+	if (state != NULL) {
+		state->framing = framing;
+		frame_reset(state);
+	}
+	return_port(port - 1, 1);
+}
+
+int32_t serial_read_frame(uint8_t port, uint8_t* buffer, int32_t max_length, uint32_t timeout) {
+	if (!VALIDATE_PORT_NO(port - 1) || frame_states[port - 1] == NULL ||
+	    frame_states[port - 1]->framing == E_SERIAL_FRAMING_NONE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	serial_frame_state_s_t* state = frame_states[port - 1];
+	// the port mutex isn't held while waiting, so the daemon can deliver frames
+	mutex_take(state->lock, TIMEOUT_MAX);
+	int32_t len = msg_buf_recv(state->frames, buffer, max_length, timeout);
+	if (len == 0 && !msg_buf_is_empty(state->frames)) {
+		mutex_give(state->lock);
+		errno = ENOBUFS;
+		return PROS_ERR;
+	}
+	mutex_give(state->lock);
+	return len;
+}
+
+int32_t serial_get_frame_errors(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1) || frame_states[port - 1] == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return frame_states[port - 1]->errors;
+}
+
+// Sink for the COBS encoder, which has all of dest to itself
+static size_t frame_capture(const uint8_t* data, size_t len, void* arg) {
+	*(size_t*)arg = len;
+	return len;
+}
+
+// Encodes a frame made of count parts into dest, which must hold
+// 2 * SERIAL_MAX_FRAME_SIZE + 2 bytes. Length/CRC frames aren't encoded, see
+// serial_frame_writev
+static size_t frame_encode(serial_framing_e_t framing, uint8_t* dest, const serial_iovec_s_t* parts, size_t count) {
+	size_t n = 0;
+	switch (framing) {
+		case E_SERIAL_FRAMING_COBS: {
+			// dest is large enough that the encoder only flushes when finishing
+			cobs_stream_s_t cobs;
+			cobs_stream_begin(&cobs, dest, 2 * SERIAL_MAX_FRAME_SIZE + 2, frame_capture, &n);
+			for (size_t i = 0; i < count; i++) cobs_stream_write(&cobs, parts[i].data, parts[i].length);
+			cobs_stream_finish(&cobs);
+			return n;
+		}
+		case E_SERIAL_FRAMING_SLIP:
+			for (size_t i = 0; i < count; i++) {
+				const uint8_t* const data = parts[i].data;
+				for (size_t j = 0; j < parts[i].length; j++) {
+					if (data[j] == SLIP_END) {
+						dest[n++] = SLIP_ESC;
+						dest[n++] = SLIP_ESC_END;
+					} else if (data[j] == SLIP_ESC) {
+						dest[n++] = SLIP_ESC;
+						dest[n++] = SLIP_ESC_ESC;
+					} else {
+						dest[n++] = data[j];
+					}
+				}
+			}
+			dest[n++] = SLIP_END;
+			return n;
+		default:
+			return 0;
+	}
+}
+
+// Writes a frame made of up to FRAME_MAX_PARTS parts, at most
+// SERIAL_MAX_FRAME_SIZE bytes in all, to a framed port whose mutex is held.
+// Length/CRC frames are queued straight from the parts, with the header and
+// CRC around them, so their payload is only copied once, into the write queue
+static int32_t frame_writev(uint8_t port, const serial_iovec_s_t* parts, size_t count, size_t length) {
+	serial_frame_state_s_t* state = frame_states[port];
+	if (state == NULL || state->framing == E_SERIAL_FRAMING_NONE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (state->framing == E_SERIAL_FRAMING_LENGTH_CRC) {
+		uint8_t const header[3] = {LENGTH_CRC_SYNC, length & 0xff, length >> 8};
+		uint16_t crc = crc16_ccitt(CRC16_CCITT_INIT, header + 1, 2);
+		serial_iovec_s_t iov[FRAME_MAX_PARTS + 2];
+		iov[0] = (serial_iovec_s_t){.data = header, .length = sizeof(header)};
+		for (size_t i = 0; i < count; i++) {
+			crc = crc16_ccitt(crc, parts[i].data, parts[i].length);
+			iov[i + 1] = parts[i];
+		}
+		uint8_t const trailer[2] = {crc & 0xff, crc >> 8};
+		iov[count + 1] = (serial_iovec_s_t){.data = trailer, .length = sizeof(trailer)};
+		return serial_tx_enqueue(port, iov, count + 2, true, 0);
+	}
+	uint8_t encoded[2 * SERIAL_MAX_FRAME_SIZE + 2];
+	const serial_iovec_s_t iov = {.data = encoded, .length = frame_encode(state->framing, encoded, parts, count)};
+	return serial_tx_enqueue(port, &iov, 1, true, 0);
+}
+
+// Used by serial_rpc_call() to write a request's header and arguments without
+// copying them together first. The port is 0-indexed
+int32_t serial_frame_writev(uint8_t port, const serial_iovec_s_t* parts, size_t count) {
+	size_t length = 0;
+	for (size_t i = 0; i < count; i++) length += parts[i].length;
+	if (count > FRAME_MAX_PARTS || length == 0 || length > SERIAL_MAX_FRAME_SIZE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	claim_port_i(port, E_DEVICE_GENERIC);
+	(void)device;  // only the port's lock is needed
+	int32_t const rtn = frame_writev(port, parts, count, length);
+	return_port(port, rtn == PROS_ERR ? PROS_ERR : (int32_t)length);
+}
+
+int32_t serial_write_frame(uint8_t port, const uint8_t* data, int32_t length) {
+	if (length <= 0 || length > SERIAL_MAX_FRAME_SIZE || data == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	const serial_iovec_s_t part = {.data = data, .length = length};
+	return serial_frame_writev(port - 1, &part, 1);
+}
@@ -0,0 +1,168 @@
+/**
+ * \file devices/vdml_serial_rpc.c
+ *
+ * Contains the request/response calls over framed V5 Generic Serial ports.
+ *
+ * Each port with RPC enabled has a fixed set of call slots. A call takes a free
+ * slot, writes its request frame and waits on the slot's semaphore. The
+ * system daemon hands every response frame it decodes on the port to
+ * serial_rpc_deliver, which copies the results straight into the caller's
+ * buffer and posts the semaphore, so nothing polls for responses.
+ *
+ * A call's ID holds its slot in the low bits and a count of the slot's uses in
+ * the rest, so a late response to a call which already timed out is told apart
+ * from the response to the slot's next call. Slots are only changed with the
+ * scheduler suspended.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "pros/serial.h"
+#include "vdml/vdml.h"
+
+#define RPC_SLOT_BITS 3  // log2 of SERIAL_RPC_MAX_CALLS
+#define RPC_SLOTS SERIAL_RPC_MAX_CALLS
+// the tag, the call ID and the status
+#define RPC_RESPONSE_HEADER 3
+
+// comes from vdml_serial_frame.c
+extern int32_t serial_frame_writev(uint8_t port, const serial_iovec_s_t* parts, size_t count);
+
+typedef struct rpc_slot {
+	sem_t done;
+	static_sem_s_t done_buf;
+	uint8_t id;
+	uint8_t status;
+	bool complete;
+	void* result;
+	size_t result_max;
+	size_t result_len;
+} rpc_slot_s_t;
+
+typedef struct rpc_port {
+	rpc_slot_s_t slots[RPC_SLOTS];
+	uint32_t busy;  // bit i for slots[i]
+	uint8_t uses[RPC_SLOTS];
+	uint32_t stray;  // responses which matched no call
+} rpc_port_s_t;
+
+// Allocated by serial_rpc_enable and never freed
+static rpc_port_s_t* rpc_ports[NUM_V5_PORTS];
+
+int32_t serial_rpc_enable(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (rpc_ports[port - 1] != NULL) return 1;
+	rpc_port_s_t* const rpc = kmalloc(sizeof(*rpc));
+	if (rpc == NULL) {
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+	memset(rpc, 0, sizeof(*rpc));
+	for (int i = 0; i < RPC_SLOTS; i++) rpc->slots[i].done = sem_create_static(1, 0, &rpc->slots[i].done_buf);
+	rtos_suspend_all();
+	bool const raced = rpc_ports[port - 1] != NULL;
+	if (!raced) rpc_ports[port - 1] = rpc;
+	rtos_resume_all();
+	if (raced) kfree(rpc);
+	return 1;
+}
+
+// Called by the system daemon for every frame starting with SERIAL_RPC_RESPONSE
+// on a framed port. Returns false if the port doesn't have RPC enabled, so the
+// frame is left for serial_read_frame()
+bool serial_rpc_deliver(uint8_t port, const uint8_t* frame, size_t len) {
+	rpc_port_s_t* const rpc = rpc_ports[port];
+	if (rpc == NULL) return false;
+	if (len < RPC_RESPONSE_HEADER) {
+		rpc->stray++;
+		return true;
+	}
+	uint8_t const id = frame[1];
+	rpc_slot_s_t* const slot = &rpc->slots[id & (RPC_SLOTS - 1)];
+	rtos_suspend_all();
+	if ((rpc->busy & (1 << (id & (RPC_SLOTS - 1)))) && slot->id == id && !slot->complete) {
+		size_t const n = len - RPC_RESPONSE_HEADER;
+		slot->result_len = n < slot->result_max ? n : slot->result_max;
+		memcpy(slot->result, frame + RPC_RESPONSE_HEADER, slot->result_len);
+		slot->status = frame[2];
+		slot->complete = true;
+		sem_post(slot->done);
+	} else {
+		rpc->stray++;
+	}
+	rtos_resume_all();
+	return true;
+}
+
+int32_t serial_rpc_call(uint8_t port, uint8_t method, const void* args, size_t args_len, void* result,
+                        size_t result_max, uint32_t timeout) {
+	if (!VALIDATE_PORT_NO(port - 1) || rpc_ports[port - 1] == NULL || (args_len && args == NULL) ||
+	    (result_max && result == NULL) || args_len > SERIAL_MAX_FRAME_SIZE - 2) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rpc_port_s_t* const rpc = rpc_ports[port - 1];
+
+	rtos_suspend_all();
+	if (rpc->busy == (1 << RPC_SLOTS) - 1) {
+		rtos_resume_all();
+		errno = EBUSY;
+		return PROS_ERR;
+	}
+	int const i = __builtin_ctz(~rpc->busy);
+	rpc_slot_s_t* const slot = &rpc->slots[i];
+	rpc->busy |= 1 << i;
+	slot->id = i | (++rpc->uses[i] << RPC_SLOT_BITS);
+	slot->complete = false;
+	slot->result = result;
+	slot->result_max = result_max;
+	rtos_resume_all();
+
+	uint8_t const header[2] = {method, slot->id};
+	const serial_iovec_s_t parts[] = {{.data = header, .length = sizeof(header)}, {.data = args, .length = args_len}};
+	bool const written = serial_frame_writev(port - 1, parts, 2) != PROS_ERR;
+	bool const posted = written && sem_wait(slot->done, timeout);
+	rtos_suspend_all();
+	bool const complete = slot->complete;
+	// so no response is taken from here on
+	slot->complete = true;
+	rtos_resume_all();
+	// A response which came in just after the wait timed out left the semaphore
+	// posted
+	if (complete && !posted) sem_wait(slot->done, 0);
+	uint8_t const status = slot->status;
+	size_t const result_len = slot->result_len;
+	rtos_suspend_all();
+	rpc->busy &= ~(1 << i);
+	rtos_resume_all();
+
+	if (!written) return PROS_ERR;
+	if (!complete) {
+		errno = ETIMEDOUT;
+		return PROS_ERR;
+	}
+	if (status != 0) {
+		errno = EPROTO;
+		return PROS_ERR;
+	}
+	return result_len;
+}
+
+int32_t serial_rpc_get_stray(uint8_t port) {
+	if (!VALIDATE_PORT_NO(port - 1) || rpc_ports[port - 1] == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return rpc_ports[port - 1]->stray;
+}
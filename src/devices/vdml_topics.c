@@ -0,0 +1,102 @@
+/**
+ * \file devices/vdml_topics.c
+ *
+ * The kernel's topics
+ *
+ * The system daemon publishes its snapshots of the motors, Inertial Sensors
+ * and controllers and the odometry's pose on topics, so that tasks can
+ * subscribe to them alongside their own. vdml_topics_capture() fills each
+ * opened topic's value straight from the snapshots, with the scheduler
+ * suspended, and topics nobody has opened are skipped.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "kapi.h"
+#include "v5_api.h"
+#include "vdml/registry.h"
+#include "vdml/vdml.h"
+
+#define TOPIC_PORTS (NUM_V5_PORTS - 1)
+
+// from topic.c
+extern topic_t topic_create_kernel(const char* name, size_t size);
+extern void* topic_kernel_begin(topic_t topic);
+extern void topic_kernel_commit(topic_t topic);
+// from vdml_motors.c, vdml_imu.c, controller.c and odometry.c
+extern const motor_snapshot_s_t* motor_snapshot_peek(uint8_t port);
+extern void imu_state_read(V5_DeviceT device_info, imu_state_s_t* const state);
+extern const controller_state_s_t* controller_state_peek(void);
+extern const odom_pose_s_t* odom_pose_peek(void);
+
+static topic_t motors_topic;
+static topic_t imus_topic;
+static topic_t controllers_topic;
+static topic_t odom_topic;
+
+// Called by vdml_initialize()
+void vdml_topics_initialize(void) {
+	motors_topic = topic_create_kernel(TOPIC_MOTORS, TOPIC_PORTS * sizeof(motor_snapshot_s_t));
+	imus_topic = topic_create_kernel(TOPIC_IMUS, TOPIC_PORTS * sizeof(imu_state_s_t));
+	controllers_topic = topic_create_kernel(TOPIC_CONTROLLERS, 2 * sizeof(controller_state_s_t));
+	odom_topic = topic_create_kernel(TOPIC_ODOM, sizeof(odom_pose_s_t));
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended, after the
+// snapshots are captured
+void vdml_topics_capture(void) {
+	motor_snapshot_s_t* const motors = topic_kernel_begin(motors_topic);
+	if (motors != NULL) {
+		for (int i = 0; i < TOPIC_PORTS; i++) {
+			const motor_snapshot_s_t* const snapshot = motor_snapshot_peek(i);
+			if (snapshot != NULL) {
+				motors[i] = *snapshot;
+			} else {
+				memset(&motors[i], 0, sizeof(motors[i]));
+			}
+		}
+		topic_kernel_commit(motors_topic);
+	}
+
+	imu_state_s_t* const imus = topic_kernel_begin(imus_topic);
+	if (imus != NULL) {
+		for (int i = 0; i < TOPIC_PORTS; i++) {
+			if (vdml_replaying(i, E_DEVICE_IMU)) {
+				imus[i] = *vdml_replay_imu(i);
+				continue;
+			}
+			if (registry_get_plugged_type(i) == E_DEVICE_IMU) {
+				V5_DeviceT device_info = registry_get_device(i)->device_info;
+				if (!(vexDeviceImuStatusGet(device_info) & E_IMU_STATUS_CALIBRATING)) {
+					imu_state_read(device_info, &imus[i]);
+					imus[i].port = i + 1;
+					imus[i].updated_us = vdml_update_times[i];
+					continue;
+				}
+			}
+			memset(&imus[i], 0, sizeof(imus[i]));
+		}
+		topic_kernel_commit(imus_topic);
+	}
+
+	controller_state_s_t* const controllers = topic_kernel_begin(controllers_topic);
+	if (controllers != NULL) {
+		memcpy(controllers, controller_state_peek(), 2 * sizeof(controller_state_s_t));
+		topic_kernel_commit(controllers_topic);
+	}
+
+	// Only published in the cycles the odometry updated the pose
+	const odom_pose_s_t* const pose = odom_pose_peek();
+	odom_pose_s_t* const odom = pose != NULL ? topic_kernel_begin(odom_topic) : NULL;
+	if (odom != NULL) {
+		*odom = *pose;
+		topic_kernel_commit(odom_topic);
+	}
+}
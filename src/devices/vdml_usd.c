@@ -11,9 +11,73 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include "kapi.h"
+#include "system/dev/usd.h"
 #include "v5_api.h"
 
 int32_t usd_is_installed(void) {
 	return vexFileDriveStatus(0);
 }
+
+// VEXos paths start at the top of the card, without the "/usd" the file system puts in front
+static const char* usd_card_path(const char* path) {
+	return strstr(path, "/usd") == path ? path + strlen("/usd") : path;
+}
+
+int32_t usd_list_files(const char* path, char* buffer, int32_t len) {
+	if (path == NULL || buffer == NULL || len < 1) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	path = usd_card_path(path);
+	if (*path == '\0') path = "/";
+	usd_io_lock();
+	FRESULT result = usd_mount();
+	if (result == FR_OK) result = vexFileDirectoryGet(path, buffer, len);
+	usd_io_unlock();
+	if (result != FR_OK) {
+		errno = usd_fresult_errno(result);
+		return PROS_ERR;
+	}
+	buffer[len - 1] = '\0';
+	int32_t count = 0;
+	for (const char* c = buffer; *c != '\0'; c++) {
+		if (*c == '\n') count++;
+	}
+	return count;
+}
+
+int32_t usd_get_file_info(const char* path, usd_file_info_s_t* info) {
+	if (path == NULL || info == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	path = usd_card_path(path);
+	usd_io_lock();
+	FRESULT const result = usd_mount();
+	if (result != FR_OK) {
+		usd_io_unlock();
+		errno = usd_fresult_errno(result);
+		return PROS_ERR;
+	}
+	if (!vexFileStatus(path)) {
+		usd_io_unlock();
+		errno = ENOENT;
+		return PROS_ERR;
+	}
+	// Only a file opens for reading
+	FIL* const fptr = vexFileOpen(path, "");
+	if (fptr != NULL) {
+		info->type = E_USD_FILE;
+		info->size = vexFileSize(fptr);
+		vexFileClose(fptr);
+	} else {
+		info->type = E_USD_DIRECTORY;
+		info->size = 0;
+	}
+	usd_io_unlock();
+	return 1;
+}
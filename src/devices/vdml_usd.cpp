@@ -21,5 +21,13 @@ std::int32_t is_installed(void) {
 	return usd_is_installed();
 }
 
+std::int32_t list_files(const char* path, char* buffer, std::int32_t len) {
+	return usd_list_files(path, buffer, len);
+}
+
+std::int32_t get_file_info(const char* path, usd_file_info_s_t* info) {
+	return usd_get_file_info(path, info);
+}
+
 }  // namespace usd
 }  // namespace pros
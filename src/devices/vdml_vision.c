@@ -10,7 +10,15 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 #include "kapi.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 #include "v5_apitypes.h"
 #include "vdml/registry.h"
@@ -29,19 +37,59 @@ static void set_zero_point(uint8_t port, vision_zero_e_t zero_point) {
 	data->zero_point = zero_point;
 }
 
-static void _vision_transform_coords(uint8_t port, vision_object_s_t* object_ptr) {
-	switch (get_zero_point(port)) {
-		case E_VISION_ZERO_CENTER:
-			object_ptr->left_coord -= VISION_FOV_WIDTH / 2;
-			object_ptr->top_coord = (VISION_FOV_HEIGHT / 2) - object_ptr->top_coord;
-			break;
-		default:
-			break;
+#define VISION_SIGNATURE_COUNT 7
+
+/**
+ * The signatures of each port's sensor as last read from it or set through
+ * the kernel, indexed by signature id - 1, so that looking one up again is a
+ * memory read. Allocated the first time a port's signatures are used, since
+ * they don't fit in its pad. Only accessed with the port's mutex held.
+ */
+static vision_signature_s_t* signature_caches[NUM_V5_PORTS];
+static uint8_t signatures_cached[NUM_V5_PORTS];  // A bit for each signature in the port's cache
+
+static vision_signature_s_t* signature_cache(uint8_t port) {
+	if (unlikely(signature_caches[port] == NULL)) {
+		signature_caches[port] = kmalloc(VISION_SIGNATURE_COUNT * sizeof(vision_signature_s_t));
+	}
+	return signature_caches[port];
+}
+
+static void signature_cache_put(uint8_t port, uint8_t signature_id, const vision_signature_s_t* sig) {
+	vision_signature_s_t* const cache = signature_cache(port);
+	// Without the memory the signature is just read from the sensor every time
+	if (cache == NULL) return;
+	cache[signature_id - 1] = *sig;
+	signatures_cached[port] |= 1 << (signature_id - 1);
+}
+
+// Called by vdml_background_processing() for the ports whose device changed,
+// since a new sensor may have different signatures
+void vision_signatures_forget(uint32_t port_mask) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (port_mask & (1 << i)) signatures_cached[i] = 0;
+	}
+}
+
+static inline void _vision_shift_object(vision_object_s_t* object_ptr, const bool center) {
+	if (center) {
+		object_ptr->left_coord -= VISION_FOV_WIDTH / 2;
+		object_ptr->top_coord = (VISION_FOV_HEIGHT / 2) - object_ptr->top_coord;
 	}
 	object_ptr->x_middle_coord = object_ptr->left_coord + (object_ptr->width / 2);
 	object_ptr->y_middle_coord = object_ptr->top_coord - (object_ptr->height / 2);
 }
 
+static void _vision_transform_coords(uint8_t port, vision_object_s_t* object_ptr) {
+	_vision_shift_object(object_ptr, get_zero_point(port) == E_VISION_ZERO_CENTER);
+}
+
+// Transforms a whole array of objects, looking the zero point up only once
+static void _vision_transform_objects(uint8_t port, vision_object_s_t* objects, const uint32_t count) {
+	const bool center = get_zero_point(port) == E_VISION_ZERO_CENTER;
+	for (uint32_t i = 0; i < count; i++) _vision_shift_object(&objects[i], center);
+}
+
 int32_t vision_get_object_count(uint8_t port) {
 	claim_port_i(port - 1, E_DEVICE_VISION);
 	int32_t rtn = vexDeviceVisionObjectCountGet(device->device_info);
@@ -91,9 +139,9 @@ vision_object_s_t _vision_get_by_sig(uint8_t port, const uint32_t size_id, const
 		goto err_return;
 	}
 
-	for (uint8_t i = 0; i <= object_count; i++) {
+	for (uint8_t i = 0; i < object_count; i++) {
 		vision_object_s_t check;
-		if (vexDeviceVisionObjectGet(device->device_info, i, (V5_DeviceVisionObject*)&check) == PROS_ERR) {
+		if (vexDeviceVisionObjectGet(device->device_info, i, (V5_DeviceVisionObject*)&check) == 0) {
 			errno = EAGAIN;
 			rtn = check;
 			goto err_return;
@@ -147,14 +195,15 @@ int32_t vision_read_by_size(uint8_t port, const uint32_t size_id, const uint32_t
 	}
 
 	for (uint32_t i = size_id; i < c; i++) {
-		if (!vexDeviceVisionObjectGet(device->device_info, i, (V5_DeviceVisionObject*)(object_arr + i))) {
+		if (!vexDeviceVisionObjectGet(device->device_info, i, (V5_DeviceVisionObject*)(object_arr + i - size_id))) {
 			errno = EAGAIN;
-			object_arr[i].signature = VISION_OBJECT_ERR_SIG;
+			object_arr[i - size_id].signature = VISION_OBJECT_ERR_SIG;
+			c = i;
 			break;
 		}
-		_vision_transform_coords(port - 1, &object_arr[i]);
 	}
-	return_port(port - 1, c);
+	_vision_transform_objects(port - 1, object_arr, c - size_id);
+	return_port(port - 1, c - size_id);
 }
 
 int32_t _vision_read_by_sig(uint8_t port, const uint32_t size_id, const uint32_t sig_id, const uint32_t object_count,
@@ -169,23 +218,20 @@ int32_t _vision_read_by_sig(uint8_t port, const uint32_t size_id, const uint32_t
 		port_mutex_give(port - 1);
 		return PROS_ERR;
 	}
-	if (c > object_count) {
-		c = object_count;
-	}
 
-	uint32_t j = 0;                    // track how many objects we've placed into object_arr
-	uint32_t seen = 0;                 // track how many objects we've seen matching sig_id
-	for (uint8_t i = 0; i < c; i++) {  // loop through all objects on sensor
+	uint32_t j = 0;     // track how many objects we've placed into object_arr
+	uint32_t seen = 0;  // track how many objects we've seen matching sig_id
+	for (uint8_t i = 0; i < c && j < object_count; i++) {  // loop through all objects on sensor
 		// place i-th object on vision sensor on j-th position in object_arr
 		if (!vexDeviceVisionObjectGet(device->device_info, i, (V5_DeviceVisionObject*)(object_arr + j))) {
 			errno = EAGAIN;
-			object_arr[i].signature = VISION_OBJECT_ERR_SIG;
+			object_arr[j].signature = VISION_OBJECT_ERR_SIG;
 			goto rtn;
 		}
 		// check if this (j-th) object matches sig_id
 		if (object_arr[j].signature == sig_id) {
 			seen++;
-			if (seen >= size_id) {  // have we seen enough objects to start adding to object_arr?
+			if (seen > size_id) {  // have we seen enough objects to start adding to object_arr?
 				// if so, transform the coords and "commit" it by incrementing j
 				_vision_transform_coords(port - 1, &object_arr[j]);
 				j++;
@@ -193,6 +239,8 @@ int32_t _vision_read_by_sig(uint8_t port, const uint32_t size_id, const uint32_t
 			}
 		}
 	}
+	// the last object read didn't match, so it mustn't be left behind in object_arr
+	if (j < object_count) object_arr[j].signature = VISION_OBJECT_ERR_SIG;
 	errno = EDOM;  // read through all objects and couldn't find enough objects matching filter parameters
 rtn:
 	return_port(port - 1, j);
@@ -218,7 +266,7 @@ int32_t vision_read_by_code(uint8_t port, const uint32_t size_id, const vision_c
 vision_signature_s_t vision_get_signature(uint8_t port, const uint8_t signature_id) {
 	vision_signature_s_t sig;
 	sig.id = VISION_OBJECT_ERR_SIG;
-	if (signature_id > 7 || signature_id == 0) {
+	if (signature_id > VISION_SIGNATURE_COUNT || signature_id == 0) {
 		errno = EINVAL;
 		return sig;
 	}
@@ -226,18 +274,25 @@ vision_signature_s_t vision_get_signature(uint8_t port, const uint8_t signature_
 	if (!rtn) {
 		return sig;
 	}
+	if (signatures_cached[port - 1] & (1 << (signature_id - 1))) {
+		sig = signature_caches[port - 1][signature_id - 1];
+		port_mutex_give(port - 1);
+		return sig;
+	}
 	v5_smart_device_s_t* device = registry_get_device(port - 1);
 	rtn = vexDeviceVisionSignatureGet(device->device_info, signature_id, (V5_DeviceVisionSignature*)&sig);
 	if (!rtn || !sig._pad[0]) {  // sig._pad[0] is flags, will be set to 1 if data is valid and signatures are sent
 		errno = EAGAIN;
 		sig.id = VISION_OBJECT_ERR_SIG;
+	} else {
+		signature_cache_put(port - 1, signature_id, &sig);
 	}
 	port_mutex_give(port - 1);
 	return sig;
 }
 
 int32_t vision_set_signature(uint8_t port, const uint8_t signature_id, vision_signature_s_t* const signature_ptr) {
-	if (signature_id > 7 || signature_id == 0) {
+	if (signature_id > VISION_SIGNATURE_COUNT || signature_id == 0) {
 		errno = EINVAL;
 		return PROS_ERR;
 	}
@@ -245,6 +300,7 @@ int32_t vision_set_signature(uint8_t port, const uint8_t signature_id, vision_si
 
 	claim_port_i(port - 1, E_DEVICE_VISION);
 	vexDeviceVisionSignatureSet(device->device_info, (V5_DeviceVisionSignature*)signature_ptr);
+	signature_cache_put(port - 1, signature_id, signature_ptr);
 	return_port(port - 1, 1);
 }
 
@@ -371,3 +427,354 @@ int32_t vision_print_signature(const vision_signature_s_t sig) {
 	       sig._pad[2], sig.range, sig.u_min, sig.u_max, sig.u_mean, sig.v_min, sig.v_max, sig.v_mean, sig.rgb, sig.type);
 	return 1;
 }
+
+// Frames copied by the system daemon. A port's buffer is kept once it has
+// been allocated, so a reader never copies out of freed memory
+static vision_snapshot_s_t* snapshots[NUM_V5_PORTS];
+static uint32_t snapshot_mask;  // The ports whose buffers are refreshed
+static vision_object_s_t frame_objects[VISION_SNAPSHOT_MAX_OBJECTS];
+
+/**
+ * The tracks of each port's objects, updated by vision_snapshot_capture() as
+ * it copies each new frame. Like the snapshots, a port's tracks are kept once
+ * they have been allocated, and are read with vdml_snapshot_read().
+ */
+typedef struct vision_tracker_s {
+	uint32_t next_id;
+	uint32_t timestamp;  // The snapshot timestamp of the last frame tracked
+	uint32_t count;
+	uint16_t gate;
+	vision_track_s_t tracks[VISION_MAX_TRACKS];
+} vision_tracker_s_t;
+
+static vision_tracker_s_t* trackers[NUM_V5_PORTS];
+static uint32_t tracking_mask;  // The ports whose tracks are updated
+
+// Velocities are smoothed like the ADI's encoder velocities
+#define TRACK_VELOCITY_ALPHA 0.5f
+
+static void tracker_update(vision_tracker_s_t* tracker, const vision_snapshot_s_t* snapshot) {
+	uint32_t const count = snapshot->count;
+	float const dt = tracker->timestamp != 0 ? (snapshot->timestamp - tracker->timestamp) / 1000.0f : 0;
+	tracker->timestamp = snapshot->timestamp;
+
+	// The squared distance of every object from where each track expects its object to be by now,
+	// or -1 if they can't be matched
+	float const gate = (float)tracker->gate * tracker->gate;
+	float distances[VISION_MAX_TRACKS][VISION_SNAPSHOT_MAX_OBJECTS];
+	for (uint32_t t = 0; t < tracker->count; t++) {
+		vision_track_s_t const* const track = &tracker->tracks[t];
+		float const x = track->object.x_middle_coord + track->x_velocity * dt;
+		float const y = track->object.y_middle_coord + track->y_velocity * dt;
+		for (uint32_t o = 0; o < count; o++) {
+			vision_object_s_t const* const object = &snapshot->objects[o];
+			float const dx = object->x_middle_coord - x, dy = object->y_middle_coord - y;
+			float const distance = dx * dx + dy * dy;
+			distances[t][o] = object->signature == track->object.signature && distance <= gate ? distance : -1;
+		}
+	}
+
+	// Greedily match the closest pair left until none can be
+	uint32_t unmatched_tracks = (1u << tracker->count) - 1;
+	uint32_t unmatched_objects = (1u << count) - 1;
+	while (unmatched_tracks && unmatched_objects) {
+		float best = -1;
+		uint32_t best_t = 0, best_o = 0;
+		for (uint32_t t = 0; t < tracker->count; t++) {
+			if (!(unmatched_tracks & (1u << t))) continue;
+			for (uint32_t o = 0; o < count; o++) {
+				if (!(unmatched_objects & (1u << o)) || distances[t][o] < 0) continue;
+				if (best < 0 || distances[t][o] < best) {
+					best = distances[t][o];
+					best_t = t;
+					best_o = o;
+				}
+			}
+		}
+		if (best < 0) break;
+		unmatched_tracks &= ~(1u << best_t);
+		unmatched_objects &= ~(1u << best_o);
+
+		vision_track_s_t* const track = &tracker->tracks[best_t];
+		vision_object_s_t const* const object = &snapshot->objects[best_o];
+		if (dt > 0) {
+			float const vx = (object->x_middle_coord - track->object.x_middle_coord) / dt;
+			float const vy = (object->y_middle_coord - track->object.y_middle_coord) / dt;
+			// The first estimate has nothing to be smoothed with
+			float const alpha = track->age > 1 ? TRACK_VELOCITY_ALPHA : 1;
+			track->x_velocity += alpha * (vx - track->x_velocity);
+			track->y_velocity += alpha * (vy - track->y_velocity);
+		}
+		track->object = *object;
+		track->age++;
+		track->missed = 0;
+	}
+
+	// Drop the tracks which have been missed too often, keeping the rest in order
+	uint32_t kept = 0;
+	for (uint32_t t = 0; t < tracker->count; t++) {
+		vision_track_s_t* const track = &tracker->tracks[t];
+		if (unmatched_tracks & (1u << t)) {
+			track->age++;
+			if (++track->missed > VISION_TRACK_MAX_MISSES) continue;
+		}
+		if (kept != t) tracker->tracks[kept] = *track;
+		kept++;
+	}
+	tracker->count = kept;
+
+	// Then start tracks for the objects which are new, while there's room
+	for (uint32_t o = 0; o < count && tracker->count < VISION_MAX_TRACKS; o++) {
+		if (!(unmatched_objects & (1u << o))) continue;
+		if (++tracker->next_id == 0) tracker->next_id = 1;
+		tracker->tracks[tracker->count++] =
+		    (vision_track_s_t){.id = tracker->next_id, .age = 1, .object = snapshot->objects[o]};
+	}
+}
+
+// Called by vdml_snapshot_capture() with the scheduler suspended
+void vision_snapshot_capture(void) {
+	if (likely(!snapshot_mask)) return;
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (!(snapshot_mask & (1 << i)) || registry_get_plugged_type(i) != E_DEVICE_VISION) continue;
+		vision_snapshot_s_t* snapshot = snapshots[i];
+		V5_DeviceT device_info = registry_get_device(i)->device_info;
+		// Only copy the objects again once the sensor has sent a new frame
+		uint32_t timestamp = vexDeviceGetTimestamp(device_info);
+		if (snapshot->timestamp == timestamp) continue;
+		uint32_t count = vexDeviceVisionObjectCountGet(device_info);
+		if (count > VISION_SNAPSHOT_MAX_OBJECTS) count = VISION_SNAPSHOT_MAX_OBJECTS;
+		uint32_t copied = 0;
+		while (copied < count &&
+		       vexDeviceVisionObjectGet(device_info, copied, (V5_DeviceVisionObject*)&frame_objects[copied])) {
+			copied++;
+		}
+		_vision_transform_objects(i, frame_objects, copied);
+		snapshot->timestamp = timestamp;
+		snapshot->updated_us = vdml_update_times[i];
+		// The smart port updates faster than the sensor makes frames, so only
+		// count it as a new frame if the objects changed
+		if (copied != snapshot->count || memcmp(frame_objects, snapshot->objects, copied * sizeof(*frame_objects))) {
+			memcpy(snapshot->objects, frame_objects, copied * sizeof(*frame_objects));
+			snapshot->count = copied;
+			snapshot->frame++;
+			if (tracking_mask & (1 << i)) tracker_update(trackers[i], snapshot);
+		}
+	}
+}
+
+int32_t vision_snapshot_enable(uint8_t port, const bool enable) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (enable && snapshots[port - 1] == NULL) {
+		vision_snapshot_s_t* snapshot = kmalloc(sizeof(*snapshot));
+		if (snapshot == NULL) {
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+		memset(snapshot, 0, sizeof(*snapshot));
+		rtos_suspend_all();
+		if (snapshots[port - 1] == NULL) {
+			snapshots[port - 1] = snapshot;
+			snapshot = NULL;
+		}
+		rtos_resume_all();
+		// Another task enabled the port first
+		kfree(snapshot);
+	}
+	rtos_suspend_all();
+	if (enable) {
+		snapshot_mask |= 1 << (port - 1);
+	} else {
+		snapshot_mask &= ~(1 << (port - 1));
+	}
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t vision_snapshot_get(uint8_t port, vision_snapshot_s_t* const snapshot) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (snapshot == NULL || !(snapshot_mask & (1 << (port - 1)))) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vdml_snapshot_read(snapshot, snapshots[port - 1]);
+	if (snapshot->timestamp == 0) {
+		// No frame has been copied yet, e.g. because the sensor is unplugged
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+// A snapshot may have been filled in by the user, so don't trust its count
+static inline uint32_t snapshot_count(const vision_snapshot_s_t* snapshot) {
+	return snapshot->count < VISION_SNAPSHOT_MAX_OBJECTS ? snapshot->count : VISION_SNAPSHOT_MAX_OBJECTS;
+}
+
+// Works out which of a snapshot's objects match a filter, returning them as a
+// bitmask with bit i for objects[i], and fills areas with every object's area
+static uint32_t snapshot_match(const vision_snapshot_s_t* snapshot, const vision_filter_s_t* filter,
+                               uint32_t areas[VISION_SNAPSHOT_MAX_OBJECTS]) {
+	const uint32_t count = snapshot_count(snapshot);
+	const uint32_t max_area = filter->max_area != 0 ? filter->max_area : UINT32_MAX;
+	uint32_t mask = 0;
+#ifdef __ARM_NEON
+	_Static_assert(VISION_SNAPSHOT_MAX_OBJECTS % 8 == 0, "snapshot_match works on 8 objects at a time");
+	// The objects are packed, so their fields are gathered into lanes first.
+	// Lanes past the count are zeroed and masked off at the end
+	uint16_t sigs[VISION_SNAPSHOT_MAX_OBJECTS] = {0};
+	uint16_t widths[VISION_SNAPSHOT_MAX_OBJECTS] = {0};
+	uint16_t heights[VISION_SNAPSHOT_MAX_OBJECTS] = {0};
+	for (uint32_t i = 0; i < count; i++) {
+		sigs[i] = snapshot->objects[i].signature;
+		widths[i] = snapshot->objects[i].width;
+		heights[i] = snapshot->objects[i].height;
+	}
+	static const uint16_t lane_bits[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+	const uint16x8_t bits = vld1q_u16(lane_bits);
+	const uint16x8_t sig = vdupq_n_u16(filter->signature);
+	const uint16x8_t any_sig = vdupq_n_u16(filter->signature == 0 ? 0xFFFF : 0);
+	const uint32x4_t min = vdupq_n_u32(filter->min_area);
+	const uint32x4_t max = vdupq_n_u32(max_area);
+	for (uint32_t i = 0; i < VISION_SNAPSHOT_MAX_OBJECTS; i += 8) {
+		uint16x8_t w = vld1q_u16(widths + i), h = vld1q_u16(heights + i);
+		uint32x4_t area_lo = vmull_u16(vget_low_u16(w), vget_low_u16(h));
+		uint32x4_t area_hi = vmull_u16(vget_high_u16(w), vget_high_u16(h));
+		vst1q_u32(areas + i, area_lo);
+		vst1q_u32(areas + i + 4, area_hi);
+		uint32x4_t ok_lo = vandq_u32(vcgeq_u32(area_lo, min), vcleq_u32(area_lo, max));
+		uint32x4_t ok_hi = vandq_u32(vcgeq_u32(area_hi, min), vcleq_u32(area_hi, max));
+		uint16x8_t ok = vcombine_u16(vmovn_u32(ok_lo), vmovn_u32(ok_hi));
+		ok = vandq_u16(ok, vorrq_u16(vceqq_u16(vld1q_u16(sigs + i), sig), any_sig));
+		// Turn the lanes into bits and add them up
+		uint16x4_t sum = vpadd_u16(vget_low_u16(vandq_u16(ok, bits)), vget_high_u16(vandq_u16(ok, bits)));
+		sum = vpadd_u16(sum, sum);
+		sum = vpadd_u16(sum, sum);
+		mask |= (uint32_t)vget_lane_u16(sum, 0) << i;
+	}
+	mask &= (1u << count) - 1;
+#else
+	for (uint32_t i = 0; i < count; i++) {
+		const vision_object_s_t* object = &snapshot->objects[i];
+		areas[i] = (uint32_t)(uint16_t)object->width * (uint16_t)object->height;
+		if (filter->signature != 0 && object->signature != filter->signature) continue;
+		if (areas[i] < filter->min_area || areas[i] > max_area) continue;
+		mask |= 1u << i;
+	}
+#endif
+	return mask;
+}
+
+int32_t vision_snapshot_filter(const vision_snapshot_s_t* const snapshot, const vision_filter_s_t* const filter,
+                               const uint32_t object_count, vision_object_s_t* const object_arr) {
+	if (snapshot == NULL || filter == NULL || object_arr == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	uint32_t areas[VISION_SNAPSHOT_MAX_OBJECTS];
+	uint32_t mask = snapshot_match(snapshot, filter, areas);
+
+	// The sensor only roughly orders objects by size, so sort the matches by
+	// area, largest first. Insertion sort keeps equal areas in the sensor's order
+	uint8_t order[VISION_SNAPSHOT_MAX_OBJECTS];
+	uint32_t matches = 0;
+	for (uint32_t i = 0; i < snapshot_count(snapshot); i++) {
+		if (!(mask & (1u << i))) continue;
+		uint32_t j = matches++;
+		while (j > 0 && areas[order[j - 1]] < areas[i]) {
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = i;
+	}
+
+	uint32_t found = matches < object_count ? matches : object_count;
+	for (uint32_t i = 0; i < found; i++) object_arr[i] = snapshot->objects[order[i]];
+	for (uint32_t i = found; i < object_count; i++) object_arr[i].signature = VISION_OBJECT_ERR_SIG;
+	return found;
+}
+
+int32_t vision_wait_for_frame(uint8_t port, uint32_t timeout) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (!(snapshot_mask & (1 << (port - 1))) && vision_snapshot_enable(port, true) == PROS_ERR) {
+		return PROS_ERR;
+	}
+	const vision_snapshot_s_t* snapshot = snapshots[port - 1];
+	uint32_t frame = snapshot->frame;
+	uint32_t start = millis();
+	// The daemon copies the objects just before it wakes the tasks waiting on the port
+	while (snapshot->frame == frame) {
+		uint32_t elapsed = millis() - start;
+		if (timeout != TIMEOUT_MAX && elapsed >= timeout) {
+			errno = ETIMEDOUT;
+			return PROS_ERR;
+		}
+		vdml_wait_for_update(1 << (port - 1), timeout == TIMEOUT_MAX ? TIMEOUT_MAX : timeout - elapsed);
+	}
+	return snapshot->frame;
+}
+
+int32_t vision_tracking_enable(uint8_t port, const bool enable, const uint16_t gate) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (!enable) {
+		rtos_suspend_all();
+		tracking_mask &= ~(1 << (port - 1));
+		rtos_resume_all();
+		return 1;
+	}
+	if (gate == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (vision_snapshot_enable(port, true) == PROS_ERR) return PROS_ERR;
+	if (trackers[port - 1] == NULL) {
+		vision_tracker_s_t* tracker = kmalloc(sizeof(*tracker));
+		if (tracker == NULL) {
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+		rtos_suspend_all();
+		if (trackers[port - 1] == NULL) {
+			trackers[port - 1] = tracker;
+			tracker = NULL;
+		}
+		rtos_resume_all();
+		// Another task enabled the port first
+		kfree(tracker);
+	}
+	rtos_suspend_all();
+	vision_tracker_s_t* const tracker = trackers[port - 1];
+	// The ids keep counting up, so a track which is started over never reuses one
+	*tracker = (vision_tracker_s_t){.next_id = tracker->next_id, .gate = gate};
+	tracking_mask |= 1 << (port - 1);
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t vision_get_tracks(uint8_t port, vision_track_s_t* const tracks, const uint32_t track_count) {
+	if (!VALIDATE_PORT_NO(port - 1)) {
+		errno = ENXIO;
+		return PROS_ERR;
+	}
+	if (tracks == NULL || !(tracking_mask & (1 << (port - 1)))) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	vision_tracker_s_t tracker;
+	vdml_snapshot_read(&tracker, trackers[port - 1]);
+	uint32_t const copied = tracker.count < track_count ? tracker.count : track_count;
+	memcpy(tracks, tracker.tracks, copied * sizeof(*tracks));
+	return copied;
+}
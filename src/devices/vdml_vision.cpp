@@ -115,4 +115,20 @@ std::int32_t Vision::set_zero_point(vision_zero_e_t zero_point) const {
 std::int32_t Vision::set_wifi_mode(const std::uint8_t enable) const {
 	return vision_set_wifi_mode(_port, enable);
 }
+
+std::int32_t Vision::get_snapshot(vision_snapshot_s_t* const snapshot) const {
+	return vision_snapshot_get(_port, snapshot);
+}
+
+std::int32_t Vision::wait_for_frame(const std::uint32_t timeout) const {
+	return vision_wait_for_frame(_port, timeout);
+}
+
+std::int32_t Vision::set_tracking(const bool enable, const std::uint16_t gate) const {
+	return vision_tracking_enable(_port, enable, gate);
+}
+
+std::int32_t Vision::get_tracks(vision_track_s_t* const tracks, const std::uint32_t track_count) const {
+	return vision_get_tracks(_port, tracks, track_count);
+}
 }  // namespace pros
@@ -10,32 +10,78 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include "display/lvgl.h"
 #include "kapi.h"
 #include "v5_api.h"
 
-static task_stack_t disp_daemon_task_stack[TASK_STACK_DEPTH_DEFAULT];
+static task_stack_t disp_daemon_task_stack[KERNEL_DISPLAY_DAEMON_STACK_DEPTH];
 static static_task_s_t disp_daemon_task_buffer;
 static task_t disp_daemon_task;
 
-static void disp_daemon(void* ign) {
-	uint32_t time = millis();
-	while (true) {
-		lv_task_handler();
-		task_delay_until(&time, 2);
-		lv_tick_inc(2);
-	}
-}
+extern void display_canvas_initialize(void);
+extern void display_usd_initialize(void);
 
-static void vex_display_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lv_color_t* color) {
-	vexDisplayCopyRect(x1, y1, x2, y2, (uint32_t*)color, x2 - x1 + 1);
-	lv_flush_ready();
+// Copies the VDB LVGL has finished with to the screen while LVGL draws into
+// the other one
+static task_stack_t disp_flush_task_stack[KERNEL_DISPLAY_FLUSH_STACK_DEPTH];
+static static_task_s_t disp_flush_task_buffer;
+static task_t disp_flush_task;
+static static_sem_s_t flush_done_buf;
+static sem_t flush_done;  // Posted whenever a flush finishes
+
+// The flush handed to the flush task
+static struct {
+	int32_t x1, y1, x2, y2;
+	const lv_color_t* color;
+} flush_request;
+
+// The system daemon samples the touch screen every cycle and wakes the display
+// daemon when it changes, so LVGL doesn't have to poll it. It only reads it
+// every LV_INDEV_READ_PERIOD while it is touched or was touched recently, to
+// catch long presses and let drags coast to a stop.
+#define DISPLAY_TOUCH_IDLE_READ_PERIOD 1000
+#define DISPLAY_TOUCH_ACTIVE_TIME 1000  // How long after a release to keep reading every LV_INDEV_READ_PERIOD
+
+static V5_TouchStatus touch_status;  // Written by the system daemon
+static volatile bool touch_changed;
+static int32_t reported_presses;     // The press count LVGL was last told about
+
+void display_touch_poll(void) {
+	V5_TouchStatus status;
+	vexTouchDataGet(&status);
+	if (status.lastEvent == touch_status.lastEvent && status.lastXpos == touch_status.lastXpos &&
+	    status.lastYpos == touch_status.lastYpos && status.pressCount == touch_status.pressCount &&
+	    status.releaseCount == touch_status.releaseCount) {
+		return;
+	}
+	// The daemon isn't preempted by the display daemon, so it can copy without suspending
+	touch_status = status;
+	touch_changed = true;
+	if (disp_daemon_task != NULL) task_notify(disp_daemon_task);
 }
 
 static bool vex_read_touch(lv_indev_data_t* data) {
-	static V5_TouchStatus v5_touch_status;
-	vexTouchDataGet(&v5_touch_status);
-	switch (v5_touch_status.lastEvent) {
+	rtos_suspend_all();
+	V5_TouchStatus status = touch_status;
+	rtos_resume_all();
+
+	// return last (x,y) pos in all cases https://doc.littlevgl.com/#Porting and
+	// purduesigbots/pros#79
+	data->point.x = status.lastXpos;
+	data->point.y = status.lastYpos;
+
+	// A tap which was over between two reads is reported as a press first, then
+	// as the release on the next read
+	if (status.lastEvent == kTouchEventRelease && status.pressCount != reported_presses) {
+		reported_presses = status.pressCount;
+		data->state = LV_INDEV_STATE_PR;
+		return true;
+	}
+	reported_presses = status.pressCount;
+	switch (status.lastEvent) {
 		case kTouchEventPress:
 		case kTouchEventPressAuto:
 			data->state = LV_INDEV_STATE_PR;
@@ -44,15 +90,234 @@ static bool vex_read_touch(lv_indev_data_t* data) {
 			data->state = LV_INDEV_STATE_REL;
 			break;
 	}
-	// return last (x,y) pos in all cases https://doc.littlevgl.com/#Porting and
-	// purduesigbots/pros#79
-	data->point.x = v5_touch_status.lastXpos;
-	data->point.y = v5_touch_status.lastYpos;
 	return false;
 }
 
-void display_initialize(void) {
+// Reads the touch screen as soon as it changes and sets how often LVGL reads
+// it otherwise. Only called by the display daemon
+static void update_touch_reads(void) {
+	static uint32_t period = LV_INDEV_READ_PERIOD;
+	static uint32_t last_touched;
+
+	if (touch_changed) {
+		touch_changed = false;
+		lv_indev_read_now();
+	}
+	if (touch_status.lastEvent != kTouchEventRelease) last_touched = millis();
+	uint32_t new_period =
+	    millis() - last_touched < DISPLAY_TOUCH_ACTIVE_TIME ? LV_INDEV_READ_PERIOD : DISPLAY_TOUCH_IDLE_READ_PERIOD;
+	if (new_period != period) {
+		lv_indev_set_read_period(new_period);
+		period = new_period;
+	}
+}
+
+#define DISPLAY_REDUCED_REFRESH_PERIOD 250
+#define DISPLAY_AUTO_CHECK_PERIOD 20  // How often a frozen daemon in auto mode checks the competition state
+
+static volatile display_refresh_mode_e_t refresh_mode = E_DISPLAY_REFRESH_FULL;
+
+// Applies the refresh mode to LVGL; returns whether LVGL is running.
+// Only called by the display daemon
+static display_refresh_mode_e_t shed_mode = E_DISPLAY_REFRESH_FULL;
+
+static bool apply_refresh_mode(void) {
+	static bool frozen = false;
+	static uint32_t period = LV_REFR_PERIOD;
+
+	display_refresh_mode_e_t mode = refresh_mode;
+	if (mode == E_DISPLAY_REFRESH_AUTO) {
+		uint8_t status = competition_get_status();
+		bool autonomous = (status & COMPETITION_AUTONOMOUS) && !(status & COMPETITION_DISABLED);
+		mode = autonomous ? E_DISPLAY_REFRESH_FROZEN : E_DISPLAY_REFRESH_FULL;
+	}
+	// While the CPU is overloaded the display refreshes no faster than the
+	// overload handling allows. FULL, REDUCED and FROZEN are in order of speed
+	display_refresh_mode_e_t const shed = __atomic_load_n(&shed_mode, __ATOMIC_RELAXED);
+	if (shed > mode) mode = shed;
+
+	bool freeze = mode == E_DISPLAY_REFRESH_FROZEN;
+	if (freeze != frozen) {
+		lv_task_enable(!freeze);
+		frozen = freeze;
+	}
+	uint32_t new_period = mode == E_DISPLAY_REFRESH_REDUCED ? DISPLAY_REDUCED_REFRESH_PERIOD : LV_REFR_PERIOD;
+	if (!freeze && new_period != period) {
+		lv_refr_set_period(new_period);
+		period = new_period;
+	}
+	return !freeze;
+}
+
+extern void display_port_errors_render(void);
+
+// Wakes the display daemon, e.g. when the system daemon has something for it to show
+void display_daemon_notify(void) {
+	if (disp_daemon_task != NULL) task_notify(disp_daemon_task);
+}
+
+// Called by system/overload.c, from the timer task
+void display_set_shed_mode(display_refresh_mode_e_t mode) {
+	__atomic_store_n(&shed_mode, mode, __ATOMIC_RELAXED);
+	display_daemon_notify();
+}
+
+static void disp_daemon(void* ign) {
+	display_start();
+	uint32_t time = millis();
+	while (true) {
+		display_port_errors_render();
+		bool running = apply_refresh_mode();
+		uint32_t sleep;
+		if (running) {
+			update_touch_reads();
+			sleep = lv_task_handler();
+		} else {
+			sleep = lv_task_get_time_till_next();
+		}
+
+		// Sleep until the next LVGL task is due (forever if there is none, as
+		// TIMEOUT_MAX is UINT32_MAX), or until the refresh mode changes. The
+		// daemon still doesn't run more often than every 2 ms.
+		if (refresh_mode == E_DISPLAY_REFRESH_AUTO && sleep > DISPLAY_AUTO_CHECK_PERIOD) {
+			sleep = DISPLAY_AUTO_CHECK_PERIOD;
+		}
+		if (sleep < 2) sleep = 2;
+		task_notify_take(true, sleep);
+
+		uint32_t now = millis();
+		lv_tick_inc(now - time);
+		time = now;
+	}
+}
+
+int32_t display_set_refresh_mode(display_refresh_mode_e_t mode) {
+	if (mode < E_DISPLAY_REFRESH_FULL || mode > E_DISPLAY_REFRESH_AUTO) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	refresh_mode = mode;
+	if (disp_daemon_task != NULL) task_notify(disp_daemon_task);
+	return 1;
+}
+
+display_refresh_mode_e_t display_get_refresh_mode(void) {
+	return refresh_mode;
+}
+
+// Only written by the display daemon
+static display_refresh_stats_s_t refresh_stats;
+static uint32_t refresh_flushes;  // The flushes and pixels of the refresh in progress
+static uint32_t refresh_pixels;
+
+static void disp_flush(void* ign) {
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		uint64_t start = micros();
+		display_copy_rect(flush_request.x1, flush_request.y1, flush_request.x2, flush_request.y2,
+		                  (const uint32_t*)flush_request.color);
+		uint32_t time = micros() - start;
+
+		rtos_suspend_all();
+		refresh_stats.flush_time += time;
+		if (time > refresh_stats.max_flush_time) refresh_stats.max_flush_time = time;
+		rtos_resume_all();
+
+		lv_flush_ready();
+		sem_post(flush_done);
+	}
+}
+
+// LVGL only calls this once the previous flush is ready, so the request is free
+static void vex_display_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lv_color_t* color) {
+	flush_request.x1 = x1;
+	flush_request.y1 = y1;
+	flush_request.x2 = x2;
+	flush_request.y2 = y2;
+	flush_request.color = color;
+
+	uint32_t pixels = (x2 - x1 + 1) * (y2 - y1 + 1);
+	refresh_flushes++;
+	refresh_pixels += pixels;
+	rtos_suspend_all();
+	refresh_stats.flushes++;
+	refresh_stats.pixels += pixels;
+	rtos_resume_all();
+
+	task_notify(disp_flush_task);
+}
+
+void display_flush_wait(void) {
+	// A post left over from an earlier flush only makes LVGL check again
+	sem_wait(flush_done, TIMEOUT_MAX);
+}
+
+// Called by LVGL after each refresh which drew something
+static void vex_display_refreshed(uint32_t time, uint32_t pixels) {
+	rtos_suspend_all();
+	refresh_stats.refreshes++;
+	refresh_stats.last_flushes = refresh_flushes;
+	refresh_stats.last_pixels = refresh_pixels;
+	refresh_stats.last_refresh_time = time;
+	rtos_resume_all();
+	refresh_flushes = 0;
+	refresh_pixels = 0;
+}
+
+int32_t display_get_refresh_stats(display_refresh_stats_s_t* stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*stats = refresh_stats;
+	rtos_resume_all();
+	return 1;
+}
+
+void display_reset_refresh_stats(void) {
+	rtos_suspend_all();
+	refresh_stats = (display_refresh_stats_s_t){0};
+	rtos_resume_all();
+}
+
+_Static_assert(DISPLAY_RENDER_BUCKETS == LV_REFR_PROFILE_BUCKETS, "DISPLAY_RENDER_BUCKETS is out of date");
+
+int32_t display_get_render_stats(display_render_stats_s_t* stats, uint32_t count) {
+	if (stats == NULL && count > 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// The display daemon adds to the profiles while it draws
+	rtos_suspend_all();
+	uint16_t types;
+	const lv_refr_profile_t* profiles = lv_refr_get_profile(&types);
+	for (uint32_t i = 0; i < types && i < count; i++) {
+		stats[i].type = profiles[i].type;
+		stats[i].draws = profiles[i].draws;
+		stats[i].draw_time = profiles[i].time;
+		stats[i].max_draw_time = profiles[i].max_time;
+		memcpy(stats[i].histogram, profiles[i].histogram, sizeof(stats[i].histogram));
+	}
+	rtos_resume_all();
+	return types;
+}
+
+void display_reset_render_stats(void) {
+	rtos_suspend_all();
+	lv_refr_reset_profile();
+	rtos_resume_all();
+}
+
+// LVGL itself is brought up by display_start(), at boot unless the program
+// deferred it with PROS_BOOT_DEFER_DISPLAY
+static static_sem_s_t start_mutex_buf;
+static mutex_t start_mutex;
+static volatile bool started = false;
+
+static void display_lvgl_initialize(void) {
 	lv_init();
+	display_usd_initialize();
 
 	lv_disp_drv_t disp_drv;
 	lv_disp_drv_init(&disp_drv);
@@ -60,18 +325,48 @@ void display_initialize(void) {
 	disp_drv.disp_flush = vex_display_flush;
 
 	lv_disp_drv_register(&disp_drv);
+	lv_refr_set_monitor_cb(vex_display_refreshed);
 
+	vexTouchDataGet(&touch_status);
+	reported_presses = touch_status.pressCount;
 	lv_indev_drv_t touch_drv;
 	lv_indev_drv_init(&touch_drv);
 	touch_drv.type = LV_INDEV_TYPE_POINTER;
 	touch_drv.read = vex_read_touch;
 	lv_indev_drv_register(&touch_drv);
 
+#if USE_LV_THEME_ALIEN
 	lv_theme_set_current(lv_theme_alien_init(40, NULL));
+#endif
 	lv_obj_t* page = lv_obj_create(NULL, NULL);
 	lv_obj_set_size(page, 480, 240);
 	lv_scr_load(page);
+}
+
+void display_start(void) {
+	if (started) return;
+	// Nothing else runs before the scheduler, e.g. during global constructors
+	bool scheduler_running = xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+	if (scheduler_running) mutex_take(start_mutex, TIMEOUT_MAX);
+	if (!started) {
+		display_lvgl_initialize();
+		started = true;
+	}
+	if (scheduler_running) mutex_give(start_mutex);
+}
+
+bool display_is_started(void) {
+	return started;
+}
+
+void display_initialize(void) {
+	display_canvas_initialize();
+	start_mutex = mutex_create_static(&start_mutex_buf);
+	flush_done = sem_create_static(1, 0, &flush_done_buf);
+	disp_flush_task = task_create_static(disp_flush, NULL, TASK_PRIORITY_MIN + 3, KERNEL_DISPLAY_FLUSH_STACK_DEPTH,
+	                                     "Display Flush (PROS)", disp_flush_task_stack, &disp_flush_task_buffer);
+	if (!(boot_get_options() & PROS_BOOT_DEFER_DISPLAY)) display_start();
 
-	disp_daemon_task = task_create_static(disp_daemon, NULL, TASK_PRIORITY_MIN + 2, TASK_STACK_DEPTH_DEFAULT,
+	disp_daemon_task = task_create_static(disp_daemon, NULL, TASK_PRIORITY_MIN + 2, KERNEL_DISPLAY_DAEMON_STACK_DEPTH,
 	                                      "Display Daemon (PROS)", disp_daemon_task_stack, &disp_daemon_task_buffer);
 }
@@ -0,0 +1,203 @@
+/**
+ * \file display/display_arena.c
+ *
+ * Arenas for LVGL's memory.
+ *
+ * LVGL allocates every object, style and list node on its own, so building and
+ * deleting screens leaves the kernel heap riddled with small holes. While a
+ * task has an arena selected, the memory LVGL asks for on that task's behalf is
+ * bumped off the arena's region instead. Blocks given back to an arena are only
+ * counted, and once all of them are back, e.g. because the screen they were
+ * made for was deleted, the whole region is free again in one go.
+ *
+ * Every other allocation, including those LVGL makes from the display daemon
+ * while animating or redrawing, still comes from the kernel heap. So does any
+ * allocation which doesn't fit in the arena any more. Those blocks are counted
+ * by their size in the heap, so display_get_mem_stats() can tell how much of
+ * the kernel heap the UI holds.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "display/lvgl.h"
+#include "kapi.h"
+
+#define ARENA_ALIGN 8
+
+typedef struct display_arena_s {
+	struct display_arena_s* next;
+	uint8_t* start;
+	uint8_t* top;  // The next free byte
+	uint8_t* end;
+	uint32_t live;  // The number of blocks which haven't been given back
+	size_t high_water;
+} display_arena_s_t;
+
+// Every arena, so that freed blocks can be traced back to theirs. All of the
+// state below is protected by suspending the scheduler
+static display_arena_s_t* arenas;
+static display_arena_s_t* selected;
+static task_t selecting_task;
+// LVGL's blocks in the kernel heap
+static uint32_t heap_bytes;
+static uint32_t peak_heap_bytes;
+static uint32_t heap_blocks;
+static uint32_t failed_allocs;
+
+static display_arena_s_t* arena_of(const void* ptr) {
+	for (display_arena_s_t* arena = arenas; arena != NULL; arena = arena->next) {
+		if ((const uint8_t*)ptr >= arena->start && (const uint8_t*)ptr < arena->end) return arena;
+	}
+	return NULL;
+}
+
+void* display_mem_alloc(size_t size) {
+	void* ret = NULL;
+	rtos_suspend_all();
+	if (selected != NULL && selecting_task == task_get_current()) {
+		size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+		if (size <= (size_t)(selected->end - selected->top)) {
+			ret = selected->top;
+			selected->top += size;
+			selected->live++;
+			if ((size_t)(selected->top - selected->start) > selected->high_water) {
+				selected->high_water = selected->top - selected->start;
+			}
+		}
+	}
+	rtos_resume_all();
+	if (ret != NULL) return ret;
+
+	ret = kmalloc(size);
+	rtos_suspend_all();
+	if (ret != NULL) {
+		heap_bytes += kmalloc_block_size(ret);
+		heap_blocks++;
+		if (heap_bytes > peak_heap_bytes) peak_heap_bytes = heap_bytes;
+	} else {
+		failed_allocs++;
+	}
+	rtos_resume_all();
+	return ret;
+}
+
+void display_mem_free(void* ptr) {
+	rtos_suspend_all();
+	display_arena_s_t* arena = arena_of(ptr);
+	if (arena != NULL && --arena->live == 0) arena->top = arena->start;
+	if (arena == NULL && ptr != NULL) {
+		heap_bytes -= kmalloc_block_size(ptr);
+		heap_blocks--;
+	}
+	rtos_resume_all();
+	if (arena == NULL) kfree(ptr);
+}
+
+int32_t display_get_mem_stats(display_mem_stats_s_t* stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	heap_stats_s_t heap;
+	heap_get_stats(&heap);
+	rtos_suspend_all();
+	uint32_t arena_bytes = 0;
+	for (const display_arena_s_t* arena = arenas; arena != NULL; arena = arena->next) {
+		arena_bytes += arena->top - arena->start;
+	}
+	*stats = (display_mem_stats_s_t){.heap_bytes = heap_bytes,
+	                                 .peak_heap_bytes = peak_heap_bytes,
+	                                 .heap_blocks = heap_blocks,
+	                                 .arena_bytes = arena_bytes,
+	                                 .failed_allocs = failed_allocs,
+	                                 .heap_fragmentation = heap.fragmentation};
+	rtos_resume_all();
+	return 1;
+}
+
+void display_reset_mem_peak(void) {
+	rtos_suspend_all();
+	peak_heap_bytes = heap_bytes;
+	rtos_resume_all();
+}
+
+display_arena_t display_arena_create(size_t size) {
+	if (size == 0) {
+		errno = EINVAL;
+		return NULL;
+	}
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	size_t header = (sizeof(display_arena_s_t) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	display_arena_s_t* arena = kmalloc(header + size);
+	if (arena == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	arena->start = (uint8_t*)arena + header;
+	arena->top = arena->start;
+	arena->end = arena->start + size;
+	arena->live = 0;
+	arena->high_water = 0;
+	rtos_suspend_all();
+	arena->next = arenas;
+	arenas = arena;
+	rtos_resume_all();
+	return arena;
+}
+
+int32_t display_arena_select(display_arena_t arena) {
+	int32_t ret = 1;
+	rtos_suspend_all();
+	if (selected != NULL && selecting_task != task_get_current()) {
+		errno = EBUSY;
+		ret = PROS_ERR;
+	} else {
+		selected = arena;
+		selecting_task = task_get_current();
+	}
+	rtos_resume_all();
+	return ret;
+}
+
+int32_t display_arena_delete(display_arena_t handle) {
+	display_arena_s_t* arena = handle;
+	if (arena == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	int32_t ret = 1;
+	rtos_suspend_all();
+	if (arena->live != 0 || arena == selected) {
+		errno = EBUSY;
+		ret = PROS_ERR;
+	} else {
+		display_arena_s_t** link = &arenas;
+		while (*link != arena) link = &(*link)->next;
+		*link = arena->next;
+	}
+	rtos_resume_all();
+	if (ret == 1) kfree(arena);
+	return ret;
+}
+
+int32_t display_arena_get_stats(display_arena_t handle, display_arena_stats_s_t* stats) {
+	const display_arena_s_t* arena = handle;
+	if (arena == NULL || stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*stats = (display_arena_stats_s_t){.size = arena->end - arena->start,
+	                                   .used = arena->top - arena->start,
+	                                   .high_water = arena->high_water,
+	                                   .live_blocks = arena->live};
+	rtos_resume_all();
+	return 1;
+}
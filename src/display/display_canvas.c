@@ -0,0 +1,230 @@
+/**
+ * \file display/display_canvas.c
+ *
+ * Immediate mode canvases on the V5 Brain's screen.
+ *
+ * A canvas reserves a rectangle of the screen for user code, which draws into
+ * the canvas's own pixel buffer and copies the buffer to the screen when a
+ * frame is done. LVGL draws around the canvases: every flush of the VDB is cut
+ * into the pieces which don't overlap one, so LVGL objects under a canvas are
+ * hidden instead of being drawn over it. Scrolling a canvas moves its pixels
+ * in memory, so a plot only has to draw the newest columns of each frame.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display/lvgl.h"
+#include "kapi.h"
+#include "v5_api.h"
+
+#define DISPLAY_WIDTH 480
+#define DISPLAY_HEIGHT 240
+
+struct display_canvas_s {
+	int16_t x1, y1, x2, y2;  // The canvas's rectangle on the screen
+	int16_t width, height;
+	uint32_t pixels[];  // 0x00RRGGBB, row by row
+};
+
+// Every copy to the screen, and the canvases list, are protected by copy_mutex
+static static_sem_s_t copy_mutex_buf;
+static mutex_t copy_mutex;
+static display_canvas_t canvases[DISPLAY_CANVAS_MAX];
+
+void display_canvas_initialize(void) {
+	copy_mutex = mutex_create_static(&copy_mutex_buf);
+}
+
+// Copies a rectangle of buf, whose rows are stride pixels apart, to the screen
+// except where it overlaps the canvases from index on
+static void copy_rect_around(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const uint32_t* buf, int32_t stride,
+                             int index) {
+	while (index < DISPLAY_CANVAS_MAX && (canvases[index] == NULL || canvases[index]->x2 < x1 ||
+	                                      canvases[index]->x1 > x2 || canvases[index]->y2 < y1 ||
+	                                      canvases[index]->y1 > y2)) {
+		index++;
+	}
+	if (index == DISPLAY_CANVAS_MAX) {
+		vexDisplayCopyRect(x1, y1, x2, y2, (uint32_t*)buf, stride);
+		return;
+	}
+
+	// Cut the rectangle into the bands above and below the canvas, and the
+	// pieces left and right of it
+	const display_canvas_t canvas = canvases[index];
+	int32_t top = canvas->y1 > y1 ? canvas->y1 : y1;
+	int32_t bottom = canvas->y2 < y2 ? canvas->y2 : y2;
+	if (y1 < top) copy_rect_around(x1, y1, x2, top - 1, buf, stride, index + 1);
+	if (bottom < y2) copy_rect_around(x1, bottom + 1, x2, y2, buf + (bottom + 1 - y1) * stride, stride, index + 1);
+	const uint32_t* band = buf + (top - y1) * stride;
+	if (x1 < canvas->x1) copy_rect_around(x1, top, canvas->x1 - 1, bottom, band, stride, index + 1);
+	if (canvas->x2 < x2) {
+		copy_rect_around(canvas->x2 + 1, top, x2, bottom, band + (canvas->x2 + 1 - x1), stride, index + 1);
+	}
+}
+
+void display_copy_rect(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const uint32_t* buf) {
+	mutex_take(copy_mutex, TIMEOUT_MAX);
+	copy_rect_around(x1, y1, x2, y2, buf, x2 - x1 + 1, 0);
+	mutex_give(copy_mutex);
+}
+
+display_canvas_t display_canvas_create(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+	if (x1 < 0 || y1 < 0 || x2 >= DISPLAY_WIDTH || y2 >= DISPLAY_HEIGHT || x2 < x1 || y2 < y1) {
+		errno = EINVAL;
+		return NULL;
+	}
+	int16_t width = x2 - x1 + 1;
+	int16_t height = y2 - y1 + 1;
+	display_canvas_t canvas = kmalloc(sizeof(*canvas) + (size_t)width * height * sizeof(uint32_t));
+	if (canvas == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	canvas->x1 = x1;
+	canvas->y1 = y1;
+	canvas->x2 = x2;
+	canvas->y2 = y2;
+	canvas->width = width;
+	canvas->height = height;
+	memset(canvas->pixels, 0, (size_t)width * height * sizeof(uint32_t));
+
+	int free_index = DISPLAY_CANVAS_MAX;
+	bool overlaps = false;
+	mutex_take(copy_mutex, TIMEOUT_MAX);
+	for (int i = 0; i < DISPLAY_CANVAS_MAX; i++) {
+		const display_canvas_t other = canvases[i];
+		if (other == NULL) {
+			if (free_index == DISPLAY_CANVAS_MAX) free_index = i;
+		} else if (other->x1 <= x2 && x1 <= other->x2 && other->y1 <= y2 && y1 <= other->y2) {
+			overlaps = true;
+		}
+	}
+	if (!overlaps && free_index < DISPLAY_CANVAS_MAX) canvases[free_index] = canvas;
+	mutex_give(copy_mutex);
+	if (overlaps || free_index == DISPLAY_CANVAS_MAX) {
+		kfree(canvas);
+		errno = overlaps ? EBUSY : ENOSPC;
+		return NULL;
+	}
+	return canvas;
+}
+
+int32_t display_canvas_delete(display_canvas_t canvas) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	mutex_take(copy_mutex, TIMEOUT_MAX);
+	for (int i = 0; i < DISPLAY_CANVAS_MAX; i++) {
+		if (canvases[i] == canvas) canvases[i] = NULL;
+	}
+	mutex_give(copy_mutex);
+
+	// Let LVGL draw what was under the canvas again. If it isn't up yet it draws
+	// the whole screen once it is
+	if (display_is_started()) {
+		lv_area_t area = {.x1 = canvas->x1, .y1 = canvas->y1, .x2 = canvas->x2, .y2 = canvas->y2};
+		lv_inv_area(&area);
+	}
+	kfree(canvas);
+	return 1;
+}
+
+int32_t display_canvas_clear(display_canvas_t canvas, uint32_t color) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return display_canvas_fill_rect(canvas, 0, 0, canvas->width - 1, canvas->height - 1, color);
+}
+
+int32_t display_canvas_set_pixel(display_canvas_t canvas, int16_t x, int16_t y, uint32_t color) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (x >= 0 && x < canvas->width && y >= 0 && y < canvas->height) canvas->pixels[y * canvas->width + x] = color;
+	return 1;
+}
+
+int32_t display_canvas_fill_rect(display_canvas_t canvas, int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+                                 uint32_t color) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (x1 < 0) x1 = 0;
+	if (y1 < 0) y1 = 0;
+	if (x2 >= canvas->width) x2 = canvas->width - 1;
+	if (y2 >= canvas->height) y2 = canvas->height - 1;
+	for (int16_t y = y1; y <= y2; y++) {
+		uint32_t* row = &canvas->pixels[y * canvas->width];
+		for (int16_t x = x1; x <= x2; x++) row[x] = color;
+	}
+	return 1;
+}
+
+int32_t display_canvas_draw_line(display_canvas_t canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                 uint32_t color) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Bresenham's, clipping each pixel to the canvas
+	int32_t dx = abs(x1 - x0);
+	int32_t dy = -abs(y1 - y0);
+	int32_t step_x = x0 < x1 ? 1 : -1;
+	int32_t step_y = y0 < y1 ? 1 : -1;
+	int32_t error = dx + dy;
+	int32_t x = x0, y = y0;
+	while (true) {
+		if (x >= 0 && x < canvas->width && y >= 0 && y < canvas->height) canvas->pixels[y * canvas->width + x] = color;
+		if (x == x1 && y == y1) break;
+		int32_t error2 = 2 * error;
+		if (error2 >= dy) {
+			error += dy;
+			x += step_x;
+		}
+		if (error2 <= dx) {
+			error += dx;
+			y += step_y;
+		}
+	}
+	return 1;
+}
+
+int32_t display_canvas_scroll(display_canvas_t canvas, int16_t columns, uint32_t color) {
+	if (canvas == NULL || columns < 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (columns > canvas->width) columns = canvas->width;
+	int16_t kept = canvas->width - columns;
+	for (int16_t y = 0; y < canvas->height; y++) {
+		uint32_t* row = &canvas->pixels[y * canvas->width];
+		memmove(row, row + columns, kept * sizeof(uint32_t));
+		for (int16_t x = kept; x < canvas->width; x++) row[x] = color;
+	}
+	return 1;
+}
+
+int32_t display_canvas_present(display_canvas_t canvas) {
+	if (canvas == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	mutex_take(copy_mutex, TIMEOUT_MAX);
+	vexDisplayCopyRect(canvas->x1, canvas->y1, canvas->x2, canvas->y2, canvas->pixels, canvas->width);
+	mutex_give(copy_mutex);
+	return 1;
+}
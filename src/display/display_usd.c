@@ -0,0 +1,99 @@
+/**
+ * \file display/display_usd.c
+ *
+ * LVGL file system driver for the microSD card.
+ *
+ * Paths on the "S:" drive, e.g. "S:/logo.bin", name files on the card, so
+ * LVGL images can be loaded straight from it. Opening a file loads all of it
+ * with usd_load_file(), which is much faster than reading it piecewise, and
+ * reads and seeks then work on the copy in memory. Images drawn from the card
+ * are decoded once into LVGL's image cache, so the file is only loaded again
+ * once the cache has dropped it.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "display/lvgl.h"
+#include "kapi.h"
+
+typedef struct usd_lv_file {
+	const uint8_t* data;
+	uint32_t size;
+	uint32_t pos;
+} usd_lv_file_s_t;
+
+static lv_fs_res_t usd_lv_open(void* file_p, const char* path, lv_fs_mode_t mode) {
+	if (mode & LV_FS_MODE_WR) return LV_FS_RES_DENIED;
+	// LVGL strips the drive and the leading slashes
+	char usd_path[LV_FS_MAX_FN_LENGTH + sizeof("/usd/")];
+	if (snprintf(usd_path, sizeof(usd_path), "/usd/%s", path) >= (int)sizeof(usd_path)) return LV_FS_RES_INV_PARAM;
+
+	size_t size;
+	const uint8_t* data = usd_load_file(usd_path, &size);
+	if (data == NULL) {
+		switch (errno) {
+			case ENOENT:
+				return LV_FS_RES_NOT_EX;
+			case ENOMEM:
+				return LV_FS_RES_OUT_OF_MEM;
+			default:
+				return LV_FS_RES_HW_ERR;
+		}
+	}
+	*(usd_lv_file_s_t*)file_p = (usd_lv_file_s_t){.data = data, .size = size, .pos = 0};
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t usd_lv_close(void* file_p) {
+	usd_unload_file(((usd_lv_file_s_t*)file_p)->data);
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t usd_lv_read(void* file_p, void* buf, uint32_t btr, uint32_t* br) {
+	usd_lv_file_s_t* const file = file_p;
+	uint32_t const len = btr < file->size - file->pos ? btr : file->size - file->pos;
+	memcpy(buf, file->data + file->pos, len);
+	file->pos += len;
+	if (br != NULL) *br = len;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t usd_lv_seek(void* file_p, uint32_t pos) {
+	usd_lv_file_s_t* const file = file_p;
+	file->pos = pos < file->size ? pos : file->size;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t usd_lv_tell(void* file_p, uint32_t* pos_p) {
+	*pos_p = ((usd_lv_file_s_t*)file_p)->pos;
+	return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t usd_lv_size(void* file_p, uint32_t* size_p) {
+	*size_p = ((usd_lv_file_s_t*)file_p)->size;
+	return LV_FS_RES_OK;
+}
+
+// Called by display_lvgl_initialize() once LVGL's file system is initialized
+void display_usd_initialize(void) {
+	lv_fs_drv_t drv;
+	memset(&drv, 0, sizeof(drv));
+	drv.letter = DISPLAY_USD_LETTER;
+	drv.file_size = sizeof(usd_lv_file_s_t);
+	drv.open = usd_lv_open;
+	drv.close = usd_lv_close;
+	drv.read = usd_lv_read;
+	drv.seek = usd_lv_seek;
+	drv.tell = usd_lv_tell;
+	drv.size = usd_lv_size;
+	lv_fs_add_drv(&drv);
+}
@@ -11,10 +11,15 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <string.h>
+
 #include "display/lvgl.h"
 #include "kapi.h"
+#include "system/optimizers.h"
 #include "v5_api.h"
 
+extern void display_daemon_notify(void);
+
 void display_fatal_error(const char* text) {
 	// in fatal error state, cannot rely on integrity of the RTOS
 	char s[50];
@@ -54,6 +59,7 @@ void display_error(const char* text) {
 		}
 		return;
 	}
+	display_start();
 	if (!_window) {
 		_window = lv_win_create(lv_scr_act(), NULL);
 		lv_obj_set_size(_window, 480, 240);
@@ -65,3 +71,93 @@ void display_error(const char* text) {
 	lv_label_set_text(_warning_label, text);
 	lv_obj_set_hidden(_window, false);
 }
+
+// The ports' errors from the system daemon, rendered by the display daemon
+static uint32_t port_unplugged, port_mismatched;
+static volatile bool port_errors_pending;
+
+void display_port_errors(uint32_t unplugged, uint32_t mismatched) {
+	rtos_suspend_all();
+	port_unplugged = unplugged;
+	port_mismatched = mismatched;
+	port_errors_pending = true;
+	rtos_resume_all();
+	display_daemon_notify();
+}
+
+static inline char* print_num(char* buff, int num) {
+	*buff++ = (num / 10) + '0';
+	*buff++ = (num % 10) + '0';
+	return buff;
+}
+
+// Appends the numbers of the ports in the mask, separated by commas
+static char* print_ports(char* line_ptr, uint32_t mask) {
+	for (int i = 0; i < NUM_V5_PORTS; i++) {
+		if (mask & (1 << i)) {
+			line_ptr = print_num(line_ptr, i + 1);
+			*line_ptr++ = ',';
+		}
+	}
+	return line_ptr - 1;
+}
+
+// Called by the display daemon
+void display_port_errors_render(void) {
+	if (likely(!port_errors_pending)) return;
+	rtos_suspend_all();
+	uint32_t const unplugged = port_unplugged;
+	uint32_t const mismatched = port_mismatched;
+	port_errors_pending = false;
+	rtos_resume_all();
+
+	int const num_errors = __builtin_popcount(unplugged | mismatched);
+	char line[50];
+	char* line_ptr = line;
+	if (num_errors == 0) {
+		line[0] = (char)0;
+	} else if (num_errors <= 6) {
+		// If we have 1-6 total errors (unplugged + mismatch), we can
+		// display a line indicating the ports where these errors occur
+		strcpy(line_ptr, "PORTS");
+		line_ptr += 5;  // 5 is length of "PORTS"
+		if (mismatched != 0) {
+			strcpy(line_ptr, " MISMATCHED: ");
+			line_ptr += 13;  // 13 is length of previous string
+			line_ptr = print_ports(line_ptr, mismatched);
+		}
+		if (unplugged != 0) {
+			strcpy(line_ptr, " UNPLUGGED: ");
+			line_ptr += 12;  // 12 is length of previous string
+			line_ptr = print_ports(line_ptr, unplugged);
+		}
+	} else {
+		/* If we have > 6 errors, we display the following:
+		 * PORT ERRORS: 1..... 6..... 11..... 16.....
+		 * where each . represents a port. A '.' indicates
+		 * there is no error on that port, a 'U' indicates
+		 * the registry expected a device there but there isn't
+		 * one, and a 'M' indicates the plugged in devices doesn't
+		 * match what we expect. The numbers are just a visual reference
+		 * to aid in determining what ports have errors.
+		 */
+		strcpy(line_ptr, "PORT ERRORS:");
+		line_ptr += 12;  // 12 is length of previous string
+		for (int i = 0; i < NUM_V5_PORTS; i++) {
+			if (i % 5 == 0) {
+				*line_ptr++ = ' ';
+				line_ptr = print_num(line_ptr, i + 1);
+			}
+			if (mismatched & (1 << i)) {
+				*line_ptr++ = 'M';
+			} else if (unplugged & (1 << i)) {
+				*line_ptr++ = 'U';
+			} else {
+				*line_ptr++ = '.';
+			}
+		}
+	}
+	// Null terminate the string
+	*line_ptr = '\0';
+	display_error(line);
+}
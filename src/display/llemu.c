@@ -14,11 +14,8 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
-#define _GNU_SOURCE
-// NOTE: this would normally be in the C file, but it won't compile that way
-#include <stdio.h>  // vasprintf (GNU extension)
-#undef _GNU_SOURCE
 #include <stdarg.h>
+#include <stdio.h>
 #include <string.h>
 #include "kapi.h"
 #include "pros/llemu.h"
@@ -132,6 +129,7 @@ static lv_obj_t* _create_lcd(void) {
 	lcd->callbacks[0] = NULL;
 	lcd->callbacks[1] = NULL;
 	lcd->callbacks[2] = NULL;
+	memset(lcd->lines, 0, sizeof(lcd->lines));
 
 	for (size_t i = 0; i < 8; i++) {
 		lcd->lcd_text[i] = lv_label_create(lcd->screen, NULL);
@@ -140,23 +138,66 @@ static lv_obj_t* _create_lcd(void) {
 		lv_label_set_align(lcd->lcd_text[i], LV_LABEL_ALIGN_LEFT);
 		lv_label_set_long_mode(lcd->lcd_text[i], LV_LABEL_LONG_CROP);
 		// lv_label_set_no_break(lcd->lcd_text[i], true);
-		lv_label_set_text(lcd->lcd_text[i], "");
+		// The labels draw straight from the line buffers, so a print never
+		// allocates from the LVGL heap
+		lv_label_set_static_text(lcd->lcd_text[i], lcd->lines[i]);
 	}
 
 	return lcd_dummy;
 }
 
+// Whether a line can be redrawn character by character: every byte is one
+// ASCII character on the same row
+static bool _lcd_is_single_row(const char* text) {
+	for (; *text; text++) {
+		if (*text == '\n' || *text & 0x80) return false;
+	}
+	return true;
+}
+
+static void _lcd_set_line(lcd_s_t* lcd, int16_t line, const char* text) {
+	char* current = lcd->lines[line];
+	if (!strcmp(current, text)) return;
+
+	lv_obj_t* label = lcd->lcd_text[line];
+	const lv_style_t* style = lv_obj_get_style(label);
+	const lv_font_t* font = style->text.font;
+	if (!lv_font_is_monospace(font, ' ') || !_lcd_is_single_row(current) || !_lcd_is_single_row(text)) {
+		strcpy(current, text);
+		lv_label_set_static_text(label, current);
+		return;
+	}
+
+	// Only invalidate the columns between the first and last characters that
+	// changed, since every character is the same width
+	size_t current_len = strlen(current);
+	size_t text_len = strlen(text);
+	size_t len = current_len > text_len ? current_len : text_len;
+	size_t first = 0;
+	while (current[first] == text[first]) first++;
+	size_t last = len - 1;
+	while (last > first && (last >= current_len ? '\0' : current[last]) == (last >= text_len ? '\0' : text[last])) {
+		last--;
+	}
+	strcpy(current, text);
+
+	lv_coord_t pitch = lv_font_get_width(font, ' ') + style->text.letter_space;
+	lv_area_t area;
+	lv_obj_get_coords(label, &area);
+	lv_area_t span = {.x1 = area.x1 + first * pitch, .y1 = area.y1, .x2 = area.x1 + (last + 1) * pitch - 1, .y2 = area.y2};
+	if (lv_area_intersect(&span, &span, &area)) lv_inv_area(&span);
+}
+
 bool _lcd_vprint(lv_obj_t* lcd_dummy, int16_t line, const char* fmt, va_list args) {
 	if (line < 0 || line > 7) {
 		errno = EINVAL;
 		return false;
 	}
 	lcd_s_t* lcd = lv_obj_get_ext_attr(lcd_dummy);
-	char buf[33];
-	vsnprintf(buf, 33, fmt, args);
+	char buf[LCD_LINE_LENGTH + 1];
+	vsnprintf(buf, sizeof(buf), fmt, args);
 
-	lv_label_set_text(lcd->lcd_text[line], buf);
-	lv_obj_set_width(lcd->lcd_text[line], 426);
+	_lcd_set_line(lcd, line, buf);
 	return true;
 }
 
@@ -174,9 +215,9 @@ bool _lcd_set_text(lv_obj_t* lcd_dummy, int16_t line, const char* text) {
 
 void _lcd_clear(lv_obj_t* lcd_dummy) {
 	lcd_s_t* lcd = lv_obj_get_ext_attr(lcd_dummy);
-	// delete children of screen (this is fine because when we print, we just
-	// overwrite the pointer anyway)
-	lv_obj_clean(lcd->screen);
+	for (int16_t i = 0; i < 8; i++) {
+		_lcd_set_line(lcd, i, "");
+	}
 }
 
 bool _lcd_clear_line(lv_obj_t* lcd_dummy, int16_t line) {
@@ -185,7 +226,7 @@ bool _lcd_clear_line(lv_obj_t* lcd_dummy, int16_t line) {
 		return false;
 	}
 	lcd_s_t* lcd = lv_obj_get_ext_attr(lcd_dummy);
-	lv_label_set_text(lcd->lcd_text[line], "");
+	_lcd_set_line(lcd, line, "");
 	return true;
 }
 
@@ -218,6 +259,7 @@ static lv_obj_t* _llemu_lcd;
 bool lcd_initialize(void) {
 	if (lcd_is_initialized()) return false;
 
+	display_start();
 	_llemu_lcd = _create_lcd();
 	if (!_llemu_lcd) return false;
 
@@ -50,6 +50,9 @@ static void indev_drag_throw(lv_indev_proc_t * state);
  *  STATIC VARIABLES
  **********************/
 static lv_indev_t * indev_act;
+#if LV_INDEV_READ_PERIOD != 0
+static lv_task_t * indev_task;
+#endif
 
 /**********************
  *      MACROS
@@ -65,7 +68,7 @@ static lv_indev_t * indev_act;
 void lv_indev_init(void)
 {
 #if LV_INDEV_READ_PERIOD != 0
-    lv_task_create(indev_proc_task, LV_INDEV_READ_PERIOD, LV_TASK_PRIO_MID, NULL);
+    indev_task = lv_task_create(indev_proc_task, LV_INDEV_READ_PERIOD, LV_TASK_PRIO_MID, NULL);
 #endif
 
     lv_indev_reset(NULL);   /*Reset all input devices*/
@@ -282,6 +285,29 @@ void lv_indev_wait_release(lv_indev_t * indev)
     indev->proc.wait_unil_release = 1;
 }
 
+/**
+ * Read and process the input devices at the next `lv_task_handler`, e.g. when a driver knows its state changed
+ */
+void lv_indev_read_now(void)
+{
+#if LV_INDEV_READ_PERIOD != 0
+    if(indev_task != NULL) lv_task_ready(indev_task);
+#endif
+}
+
+/**
+ * Change how often the input devices are read
+ * @param period new period of the reads in milliseconds (LV_INDEV_READ_PERIOD by default)
+ */
+void lv_indev_set_read_period(uint32_t period)
+{
+#if LV_INDEV_READ_PERIOD != 0
+    if(indev_task != NULL) lv_task_set_period(indev_task, period);
+#else
+    (void)period;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -13,6 +13,11 @@
 #include "display/lv_hal/lv_hal_disp.h"
 #include "display/lv_misc/lv_task.h"
 #include "display/lv_misc/lv_mem.h"
+#include "display/lv_misc/lv_math.h"
+
+#if LV_REFR_PROFILE && defined(LV_REFR_PROFILE_TIME_INCLUDE)
+#include LV_REFR_PROFILE_TIME_INCLUDE
+#endif
 
 /*********************
  *      DEFINES
@@ -21,6 +26,22 @@
 #define LV_INV_FIFO_SIZE    32    /*The average count of objects on a screen */
 #endif
 
+#ifndef LV_INV_TILE_SIZE
+#define LV_INV_TILE_SIZE    0     /*Size of the tiles invalidated areas are merged on (0: merge only overlapping areas)*/
+#endif
+
+#if LV_REFR_PROFILE && !defined(LV_REFR_PROFILE_TYPES)
+#define LV_REFR_PROFILE_TYPES   32    /*Most object types to time (the rest are not counted)*/
+#endif
+
+#if LV_INV_TILE_SIZE > 0
+#define LV_INV_TILE_COLS    ((LV_HOR_RES + LV_INV_TILE_SIZE - 1) / LV_INV_TILE_SIZE)
+#define LV_INV_TILE_ROWS    ((LV_VER_RES + LV_INV_TILE_SIZE - 1) / LV_INV_TILE_SIZE)
+#if LV_INV_TILE_COLS > 32
+#error "LV_INV_TILE_SIZE is too small: a row of tiles has to fit in 32 bits"
+#endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +55,10 @@ typedef struct {
  **********************/
 static void lv_refr_task(void * param);
 static void lv_refr_join_area(void);
+#if LV_INV_TILE_SIZE > 0
+static void lv_refr_mark_tiles(const lv_area_t * area_p);
+static void lv_refr_tile_areas(void);
+#endif
 static void lv_refr_areas(void);
 #if LV_VDB_SIZE == 0
 static void lv_refr_area_no_vdb(const lv_area_t * area_p);
@@ -44,6 +69,9 @@ static void lv_refr_area_part_vdb(const lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
+#if LV_REFR_PROFILE
+static void lv_refr_profile_add(lv_obj_t * obj, uint32_t time, bool drawn);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -53,6 +81,14 @@ static uint16_t inv_buf_p;
 static void (*monitor_cb)(uint32_t, uint32_t); /*Monitor the rendering time*/
 static void (*round_cb)(lv_area_t *);          /*If set then called to modify invalidated areas for special display controllers*/
 static uint32_t px_num;
+static lv_task_t * refr_task;
+#if LV_INV_TILE_SIZE > 0
+static uint32_t inv_tiles[LV_INV_TILE_ROWS];    /*Bit 'x' of row 'y' is set if tile (x, y) is invalid*/
+#endif
+#if LV_REFR_PROFILE
+static lv_refr_profile_t profiles[LV_REFR_PROFILE_TYPES];
+static uint16_t profile_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -70,9 +106,17 @@ void lv_refr_init(void)
     inv_buf_p = 0;
     memset(inv_buf, 0, sizeof(inv_buf));
 
-    lv_task_t * task;
-    task = lv_task_create(lv_refr_task, LV_REFR_PERIOD, LV_TASK_PRIO_MID, NULL);
-    lv_task_ready(task);        /*Be sure the screen will be refreshed immediately on start up*/
+    refr_task = lv_task_create(lv_refr_task, LV_REFR_PERIOD, LV_TASK_PRIO_MID, NULL);
+    lv_task_ready(refr_task);   /*Be sure the screen will be refreshed immediately on start up*/
+}
+
+/**
+ * Change how often the invalidated areas are redrawn
+ * @param period new period of the refresh in milliseconds (LV_REFR_PERIOD by default)
+ */
+void lv_refr_set_period(uint32_t period)
+{
+    if(refr_task != NULL) lv_task_set_period(refr_task, period);
 }
 
 /**
@@ -96,6 +140,9 @@ void lv_inv_area(const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         inv_buf_p = 0;
+#if LV_INV_TILE_SIZE > 0
+        memset(inv_tiles, 0, sizeof(inv_tiles));
+#endif
         return;
     }
 
@@ -123,9 +170,17 @@ void lv_inv_area(const lv_area_t * area_p)
         /*Save the area*/
         if(inv_buf_p < LV_INV_FIFO_SIZE) {
             lv_area_copy(&inv_buf[inv_buf_p].area, &com_area);
-        } else {/*If no place for the area add the screen*/
+        } else {
+#if LV_INV_TILE_SIZE > 0
+            /*If no place for the area move the saved areas to the tiles*/
+            for(i = 0; i < inv_buf_p; i++) lv_refr_mark_tiles(&inv_buf[i].area);
+            inv_buf_p = 0;
+            lv_area_copy(&inv_buf[inv_buf_p].area, &com_area);
+#else
+            /*If no place for the area add the screen*/
             inv_buf_p = 0;
             lv_area_copy(&inv_buf[inv_buf_p].area, &scr_area);
+#endif
         }
         inv_buf_p ++;
     }
@@ -172,6 +227,28 @@ void lv_refr_pop_from_buf(uint16_t num)
     else inv_buf_p -= num;
 }
 
+#if LV_REFR_PROFILE
+/**
+ * Get the draw times of the object types drawn since start up or `lv_refr_reset_profile()`
+ * @param cnt store the number of object types here
+ * @return array of 'cnt' profiles, in the order the types were first drawn
+ */
+const lv_refr_profile_t * lv_refr_get_profile(uint16_t * cnt)
+{
+    *cnt = profile_cnt;
+    return profiles;
+}
+
+/**
+ * Forget the draw times of every object type
+ */
+void lv_refr_reset_profile(void)
+{
+    profile_cnt = 0;
+    memset(profiles, 0, sizeof(profiles));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -193,7 +270,11 @@ static void lv_refr_task(void * param)
         return;
     }
 
+#if LV_INV_TILE_SIZE > 0
+    lv_refr_tile_areas();
+#else
     lv_refr_join_area();
+#endif
 
     lv_refr_areas();
 
@@ -289,6 +370,94 @@ static void lv_refr_join_area(void)
     }
 }
 
+#if LV_INV_TILE_SIZE > 0
+/**
+ * Mark the tiles an area touches as invalid
+ * @param area_p pointer to an area on the screen
+ */
+static void lv_refr_mark_tiles(const lv_area_t * area_p)
+{
+    uint32_t x1 = area_p->x1 / LV_INV_TILE_SIZE;
+    uint32_t x2 = area_p->x2 / LV_INV_TILE_SIZE;
+    uint32_t cols = ((x2 - x1 + 1) >= 32 ? 0xFFFFFFFF : ((uint32_t)1 << (x2 - x1 + 1)) - 1) << x1;
+
+    lv_coord_t y;
+    for(y = area_p->y1 / LV_INV_TILE_SIZE; y <= area_p->y2 / LV_INV_TILE_SIZE; y++) {
+        inv_tiles[y] |= cols;
+    }
+}
+
+/**
+ * Replace the invalidated areas with as few rectangles as cover the same tiles.
+ * Every row of tiles is cut into spans of invalid tiles, and a span is extended
+ * down for as long as the rows below it are invalid over the whole span.
+ * Each rectangle is then shrunk to the invalidated areas inside it, so the
+ * tiles only decide which areas are refreshed (and flushed) together.
+ */
+static void lv_refr_tile_areas(void)
+{
+    lv_join_t areas[LV_INV_FIFO_SIZE];
+    uint32_t overflow[LV_INV_TILE_ROWS];    /*The tiles of areas which didn't fit in the buffer*/
+    uint16_t area_num = inv_buf_p;
+    uint16_t i;
+
+    memcpy(areas, inv_buf, sizeof(lv_join_t) * area_num);
+    memcpy(overflow, inv_tiles, sizeof(overflow));
+    for(i = 0; i < area_num; i++) lv_refr_mark_tiles(&areas[i].area);
+
+    inv_buf_p = 0;
+    lv_coord_t y;
+    for(y = 0; y < LV_INV_TILE_ROWS; y++) {
+        while(inv_tiles[y] != 0) {
+            /*Find the first span of invalid tiles in this row*/
+            uint32_t first = __builtin_ctz(inv_tiles[y]);
+            uint32_t rest = ~(inv_tiles[y] >> first);
+            uint32_t len = rest == 0 ? 32 - first : (uint32_t)__builtin_ctz(rest);
+            uint32_t span = (len >= 32 ? 0xFFFFFFFF : ((uint32_t)1 << len) - 1) << first;
+
+            /*Extend it down while the whole span is invalid*/
+            lv_coord_t y2 = y;
+            bool inexact = (overflow[y] & span) != 0;
+            inv_tiles[y] &= ~span;
+            while(y2 + 1 < LV_INV_TILE_ROWS && (inv_tiles[y2 + 1] & span) == span) {
+                y2++;
+                inv_tiles[y2] &= ~span;
+                if(overflow[y2] & span) inexact = true;
+            }
+
+            lv_area_t tile_area;
+            tile_area.x1 = first * LV_INV_TILE_SIZE;
+            tile_area.y1 = y * LV_INV_TILE_SIZE;
+            tile_area.x2 = LV_MATH_MIN((first + len) * LV_INV_TILE_SIZE, LV_HOR_RES) - 1;
+            tile_area.y2 = LV_MATH_MIN((y2 + 1) * LV_INV_TILE_SIZE, LV_VER_RES) - 1;
+
+            /*Shrink the rectangle to the areas in it unless some of its tiles came from an overflow*/
+            if(!inexact) {
+                lv_area_t bounds;
+                lv_area_t part;
+                bool found = false;
+                for(i = 0; i < area_num; i++) {
+                    if(lv_area_intersect(&part, &areas[i].area, &tile_area) == false) continue;
+                    if(found) lv_area_join(&bounds, &bounds, &part);
+                    else lv_area_copy(&bounds, &part);
+                    found = true;
+                }
+                if(found) lv_area_copy(&tile_area, &bounds);
+            }
+
+            if(inv_buf_p < LV_INV_FIFO_SIZE) {
+                lv_area_copy(&inv_buf[inv_buf_p].area, &tile_area);
+                inv_buf[inv_buf_p].joined = 0;
+                inv_buf_p++;
+            } else {
+                /*No place for more rectangles: add the rest to the last one*/
+                lv_area_join(&inv_buf[inv_buf_p - 1].area, &inv_buf[inv_buf_p - 1].area, &tile_area);
+            }
+        }
+    }
+}
+#endif
+
 /**
  * Refresh the joined areas
  */
@@ -540,7 +709,13 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
     /*Call the post draw design function of the parents of the to object*/
     par = lv_obj_get_parent(top_p);
     while(par != NULL) {
+#if LV_REFR_PROFILE
+        uint32_t draw_start = LV_REFR_PROFILE_TIME();
+#endif
         par->design_func(par, mask_p, LV_DESIGN_DRAW_POST);
+#if LV_REFR_PROFILE
+        lv_refr_profile_add(par, LV_REFR_PROFILE_TIME() - draw_start, false);
+#endif
         par = lv_obj_get_parent(par);
     }
 }
@@ -573,7 +748,13 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     if(union_ok != false) {
 
         /* Redraw the object */
+#if LV_REFR_PROFILE
+        uint32_t draw_start = LV_REFR_PROFILE_TIME();
+#endif
         obj->design_func(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
+#if LV_REFR_PROFILE
+        uint32_t draw_time = LV_REFR_PROFILE_TIME() - draw_start;
+#endif
         //usleep(5 * 1000);  /*DEBUG: Wait after every object draw to see the order of drawing*/
 
 
@@ -604,7 +785,55 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
         }
 
         /* If all the children are redrawn make 'post draw' design */
+#if LV_REFR_PROFILE
+        draw_start = LV_REFR_PROFILE_TIME();
+#endif
         obj->design_func(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+#if LV_REFR_PROFILE
+        /*The children's time is counted for their own types*/
+        lv_refr_profile_add(obj, draw_time + LV_REFR_PROFILE_TIME() - draw_start, true);
+#endif
+
+    }
+}
 
+#if LV_REFR_PROFILE
+/**
+ * Count the time of an object's design functions for its type
+ * @param obj pointer to the drawn object
+ * @param time time spent in the design functions
+ * @param drawn true: the object was drawn; false: only its 'post draw' design was made
+ */
+static void lv_refr_profile_add(lv_obj_t * obj, uint32_t time, bool drawn)
+{
+    lv_refr_profile_t * profile = NULL;
+    uint16_t i;
+    for(i = 0; i < profile_cnt; i++) {
+        if(profiles[i].signal_func == obj->signal_func) {
+            profile = &profiles[i];
+            break;
+        }
+    }
+
+    if(profile == NULL) {
+        if(profile_cnt == LV_REFR_PROFILE_TYPES) return;
+
+        /*Ask the type only once because it goes through every ancestor's signal function*/
+        lv_obj_type_t type;
+        lv_obj_get_type(obj, &type);
+        profile = &profiles[profile_cnt];
+        profile->signal_func = obj->signal_func;
+        profile->type = type.type[0];
+        profile_cnt++;
+    }
+
+    profile->time += time;
+    if(time > profile->max_time) profile->max_time = time;
+    if(drawn) {
+        uint8_t bucket = 0;
+        while(bucket < LV_REFR_PROFILE_BUCKETS - 1 && time >= ((uint32_t)16 << bucket)) bucket++;
+        profile->draws++;
+        profile->histogram[bucket]++;
     }
 }
+#endif
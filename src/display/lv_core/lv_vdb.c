@@ -24,6 +24,14 @@
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
+#ifdef LV_VDB_FLUSH_WAIT_INCLUDE
+#include LV_VDB_FLUSH_WAIT_INCLUDE
+#endif
+
+#ifndef LV_VDB_FLUSH_WAIT
+#define LV_VDB_FLUSH_WAIT()         /*Spin until the flush is ready*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -81,7 +89,7 @@ lv_vdb_t * lv_vdb_get(void)
 #if LV_VDB_DOUBLE == 0
     /* Wait until VDB is flushing.
      * (Until this user calls of 'lv_flush_ready()' in the display drivers's flush function*/
-    while(vdb_flushing);
+    while(vdb_flushing) LV_VDB_FLUSH_WAIT();
 
     return &vdb;
 #else
@@ -103,7 +111,7 @@ void lv_vdb_flush(void)
 
     /*Don't start a new flush while the previous is not finished*/
 #if LV_VDB_DOUBLE
-    while(vdb_flushing);
+    while(vdb_flushing) LV_VDB_FLUSH_WAIT();
 #endif  /*LV_VDB_DOUBLE*/
 
     vdb_flushing = true;
@@ -8,6 +8,8 @@
  *********************/
 #include "lv_draw_img.h"
 #include "display/lv_misc/lv_fs.h"
+#include "display/lv_misc/lv_gc.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -16,6 +18,13 @@
 /**********************
  *      TYPEDEFS
  **********************/
+/*A decoded image file in the cache*/
+typedef struct {
+    char * src;                 /*Copy of the path of the file*/
+    lv_img_header_t header;     /*Header of the file*/
+    uint8_t * data;             /*The pixels as 'lv_color_t', followed by an alpha byte if the format has alpha*/
+    uint32_t size;              /*Bytes of 'data' and 'src', counted against the cache size*/
+} lv_img_cache_entry_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -28,6 +37,9 @@ static lv_res_t lv_img_decoder_read_line(lv_coord_t x, lv_coord_t y, lv_coord_t
 static void lv_img_decoder_close(void);
 static lv_res_t lv_img_built_in_decoder_line_alpha(lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_built_in_decoder_line_indexed(lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static lv_img_cache_entry_t * lv_img_cache_find(const char * src);
+static const lv_img_cache_entry_t * lv_img_cache_open(const char * src, const lv_style_t * style);
+static void lv_img_cache_drop(lv_img_cache_entry_t * entry);
 
 /**********************
  *  STATIC VARIABLES
@@ -49,6 +61,10 @@ static lv_img_decoder_open_f_t lv_img_decoder_open_custom;
 static lv_img_decoder_read_line_f_t lv_img_decoder_read_line_custom;
 static lv_img_decoder_close_f_t lv_img_decoder_close_custom;
 
+static bool cache_inited;
+static uint32_t cache_size = LV_IMG_CACHE_DEF_SIZE;
+static uint32_t cache_used;
+
 /**********************
  *      MACROS
  **********************/
@@ -112,6 +128,13 @@ lv_res_t lv_img_dsc_get_info(const char * src, lv_img_header_t * header)
     }
 #if USE_LV_FILESYSTEM
     else if(src_type == LV_IMG_SRC_FILE) {
+        /*Don't open the file again if it's already decoded*/
+        const lv_img_cache_entry_t * entry = lv_img_cache_find(src);
+        if(entry) {
+            *header = entry->header;
+            return LV_RES_OK;
+        }
+
         lv_fs_file_t file;
         lv_fs_res_t res;
         uint32_t rn;
@@ -275,6 +298,42 @@ void lv_img_decoder_set_custom(lv_img_decoder_info_f_t  info_fp, lv_img_decoder_
     lv_img_decoder_close_custom = close_fp;
 }
 
+/**
+ * Set how many bytes of decoded image files to keep in memory
+ * @param size the new size of the cache in bytes (0: don't cache)
+ */
+void lv_img_cache_set_size(uint32_t size)
+{
+    cache_size = size;
+
+    /*Drop the least recently drawn images until the rest fit*/
+    while(cache_used > cache_size) lv_img_cache_drop(lv_ll_get_tail(&LV_GC_ROOT(_lv_img_cache_ll)));
+}
+
+/**
+ * Drop an image file from the cache
+ * @param src path of the file, or NULL to drop every image
+ */
+void lv_img_cache_invalidate_src(const char * src)
+{
+    if(src == NULL) {
+        while(cache_used > 0) lv_img_cache_drop(lv_ll_get_head(&LV_GC_ROOT(_lv_img_cache_ll)));
+        return;
+    }
+
+    lv_img_cache_entry_t * entry = lv_img_cache_find(src);
+    if(entry) lv_img_cache_drop(entry);
+}
+
+/**
+ * Get how many bytes the image cache uses
+ * @return size of the cached images and their paths in bytes
+ */
+uint32_t lv_img_cache_get_used(void)
+{
+    return cache_used;
+}
+
 
 /**********************
  *   STATIC FUNCTIONS
@@ -294,6 +353,17 @@ static lv_res_t lv_img_draw_core(const lv_area_t * coords, const lv_area_t * mas
 
     lv_opa_t opa = opa_scale == LV_OPA_COVER ? style->image.opa : (uint16_t)((uint16_t) style->image.opa * opa_scale) >> 8;
 
+    /*Decoded image files are simply drawn from the memory like variable images*/
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        const lv_img_cache_entry_t * entry = lv_img_cache_open(src, style);
+        if(entry) {
+            bool chroma_keyed = lv_img_color_format_is_chroma_keyed(entry->header.cf);
+            bool alpha_byte = lv_img_color_format_has_alpha(entry->header.cf);
+            map_fp(coords, mask, entry->data, opa, chroma_keyed, alpha_byte, style->image.color, style->image.intense);
+            return LV_RES_OK;
+        }
+    }
+
     lv_img_header_t header;
     lv_res_t header_res;
     header_res = lv_img_dsc_get_info(src, &header);
@@ -673,6 +743,122 @@ static lv_res_t lv_img_built_in_decoder_line_alpha(lv_coord_t x, lv_coord_t y, l
 #endif
 }
 
+/**
+ * Find an image file in the cache
+ * @param src path of the file
+ * @return the decoded image or NULL if it's not cached
+ */
+static lv_img_cache_entry_t * lv_img_cache_find(const char * src)
+{
+    if(cache_inited == false) {
+        lv_ll_init(&LV_GC_ROOT(_lv_img_cache_ll), sizeof(lv_img_cache_entry_t));
+        cache_inited = true;
+    }
+
+    lv_img_cache_entry_t * entry;
+    LL_READ(LV_GC_ROOT(_lv_img_cache_ll), entry) {
+        if(strcmp(entry->src, src) == 0) return entry;
+    }
+
+    return NULL;
+}
+
+/**
+ * Get the decoded pixels of an image file, decoding it into the cache if it's not there yet
+ * @param src path of the file
+ * @param style style of the image, passed to the decoder
+ * @return the decoded image or NULL if it can't be cached
+ */
+static const lv_img_cache_entry_t * lv_img_cache_open(const char * src, const lv_style_t * style)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_cache_ll);
+    lv_img_cache_entry_t * entry = lv_img_cache_find(src);
+    if(entry) {
+        /*Keep the list in the order of the last draw to drop the least recently drawn images first*/
+        lv_img_cache_entry_t * head = lv_ll_get_head(ll);
+        if(entry != head) lv_ll_move_before(ll, entry, head);
+        return entry;
+    }
+
+    if(cache_size == 0) return NULL;
+
+    lv_img_header_t header;
+    if(lv_img_dsc_get_info(src, &header) != LV_RES_OK) return NULL;
+
+    /*The colors of alpha images come from the style so they are not cached*/
+    if(header.cf == LV_IMG_CF_ALPHA_1BIT ||
+            header.cf == LV_IMG_CF_ALPHA_2BIT ||
+            header.cf == LV_IMG_CF_ALPHA_4BIT ||
+            header.cf == LV_IMG_CF_ALPHA_8BIT) {
+        return NULL;
+    }
+
+    uint32_t px_size = lv_img_color_format_has_alpha(header.cf) ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint32_t stride = header.w * px_size;
+    uint32_t data_size = stride * header.h;
+    uint32_t src_size = strlen(src) + 1;
+    if(data_size + src_size > cache_size) return NULL;
+
+    uint8_t * data = lv_mem_alloc(data_size);
+    if(data == NULL) return NULL;
+
+    /*Decode the whole image with the same decoder which would draw it line by line*/
+    lv_res_t res = LV_RES_OK;
+    const uint8_t * img_data = lv_img_decoder_open(src, style);
+    if(img_data == LV_IMG_DECODER_OPEN_FAIL) {
+        res = LV_RES_INV;
+    } else if(img_data) {
+        memcpy(data, img_data, data_size);
+    } else {
+        lv_coord_t y;
+        for(y = 0; y < header.h && res == LV_RES_OK; y++) {
+            res = lv_img_decoder_read_line(0, y, header.w, data + y * stride);
+        }
+    }
+    lv_img_decoder_close();
+
+    if(res != LV_RES_OK) {
+        LV_LOG_WARN("Image cache can't decode the image");
+        lv_mem_free(data);
+        return NULL;
+    }
+
+    /*Make room by dropping the least recently drawn images*/
+    while(cache_used + data_size + src_size > cache_size) lv_img_cache_drop(lv_ll_get_tail(ll));
+
+    entry = lv_ll_ins_head(ll);
+    char * src_copy = lv_mem_alloc(src_size);
+    if(entry == NULL || src_copy == NULL) {
+        if(entry) lv_ll_rem(ll, entry);
+        lv_mem_free(entry);
+        lv_mem_free(src_copy);
+        lv_mem_free(data);
+        return NULL;
+    }
+
+    memcpy(src_copy, src, src_size);
+    entry->src = src_copy;
+    entry->header = header;
+    entry->data = data;
+    entry->size = data_size + src_size;
+    cache_used += entry->size;
+
+    return entry;
+}
+
+/**
+ * Remove an image from the cache and free it
+ * @param entry pointer to the cached image
+ */
+static void lv_img_cache_drop(lv_img_cache_entry_t * entry)
+{
+    cache_used -= entry->size;
+    lv_mem_free(entry->src);
+    lv_mem_free(entry->data);
+    lv_ll_rem(&LV_GC_ROOT(_lv_img_cache_ll), entry);
+    lv_mem_free(entry);
+}
+
 static lv_res_t lv_img_built_in_decoder_line_indexed(lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
 {
 
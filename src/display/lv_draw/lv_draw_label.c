@@ -56,10 +56,37 @@ static uint8_t hex_char_to_num(char hex);
  */
 void lv_draw_label(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale,
                    const char * txt, lv_txt_flag_t flag, lv_point_t * offset)
+{
+    lv_draw_label_layout(coords, mask, style, opa_scale, txt, flag, offset, NULL);
+}
+
+/**
+ * Write a text, reusing its line breaks from the last time if nothing changed
+ * @param coords coordinates of the label
+ * @param mask the label will be drawn only in this area
+ * @param style pointer to a style
+ * @param opa_scale scale down all opacities by the factor
+ * @param txt 0 terminated text to write
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @param offset text offset in x and y direction (NULL if unused)
+ * @param layout the line breaks of 'txt', updated if they are out of date (NULL to lay it out from scratch)
+ */
+void lv_draw_label_layout(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style,
+                          lv_opa_t opa_scale, const char * txt, lv_txt_flag_t flag, lv_point_t * offset,
+                          lv_txt_layout_t * layout)
 {
     const lv_font_t * font = style->text.font;
     lv_coord_t w;
-    if((flag & LV_TXT_FLAG_EXPAND) == 0) {
+    if(layout != NULL) {
+        /*In EXPAND mode the width doesn't limit the lines, and otherwise it is the label's*/
+        if(!lv_txt_layout_update(layout, txt, font, style->text.letter_space, lv_area_get_width(coords), flag)) {
+            layout = NULL;
+        }
+    }
+
+    if(layout != NULL) {
+        w = (flag & LV_TXT_FLAG_EXPAND) ? layout->width : lv_area_get_width(coords);
+    } else if((flag & LV_TXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     } else {
@@ -87,30 +114,46 @@ void lv_draw_label(const lv_area_t * coords, const lv_area_t * mask, const lv_st
     }
 
     uint32_t line_start = 0;
-    uint32_t line_end = lv_txt_get_next_line(txt, font, style->text.letter_space, w, flag);
+    uint32_t line_end;
+    uint16_t line_id = 0;
+
+    if(layout != NULL) {
+        /*Skip straight to the first visible line*/
+        if(line_height > 0 && pos.y + line_height < mask->y1) {
+            uint32_t skipped = (mask->y1 - pos.y - 1) / line_height;
+            if(skipped >= layout->line_cnt) return;
+            line_id = skipped;
+            pos.y += skipped * line_height;
+        }
+        if(layout->line_cnt == 0) return;
+        line_start = layout->lines[line_id].start;
+        line_end = lv_txt_layout_get_line_end(layout, line_id);
+    } else {
+        line_end = lv_txt_get_next_line(txt, font, style->text.letter_space, w, flag);
 
-    /*Go the first visible line*/
-    while(pos.y + line_height < mask->y1) {
-        /*Go to next line*/
-        line_start = line_end;
-        line_end += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, w, flag);
-        pos.y += line_height;
+        /*Go the first visible line*/
+        while(pos.y + line_height < mask->y1) {
+            /*Go to next line*/
+            line_start = line_end;
+            line_end += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, w, flag);
+            pos.y += line_height;
 
-        if(txt[line_start] == '\0') return;
+            if(txt[line_start] == '\0') return;
+        }
     }
 
     /*Align to middle*/
     if(flag & LV_TXT_FLAG_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start,
-                                      font, style->text.letter_space, flag);
+        line_width = layout != NULL ? layout->lines[line_id].width :
+                     lv_txt_get_width(&txt[line_start], line_end - line_start, font, style->text.letter_space, flag);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(flag & LV_TXT_FLAG_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start,
-                                      font, style->text.letter_space, flag);
+        line_width = layout != NULL ? layout->lines[line_id].width :
+                     lv_txt_get_width(&txt[line_start], line_end - line_start, font, style->text.letter_space, flag);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -191,21 +234,26 @@ void lv_draw_label(const lv_area_t * coords, const lv_area_t * mask, const lv_st
         }
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, w, flag);
+        if(layout != NULL) {
+            if(++line_id >= layout->line_cnt) return;
+            line_end = lv_txt_layout_get_line_end(layout, line_id);
+        } else {
+            line_end += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, w, flag);
+        }
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(flag & LV_TXT_FLAG_CENTER) {
-            line_width = lv_txt_get_width(&txt[line_start], line_end - line_start,
-                                          font, style->text.letter_space, flag);
+            line_width = layout != NULL ? layout->lines[line_id].width :
+                         lv_txt_get_width(&txt[line_start], line_end - line_start, font, style->text.letter_space, flag);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(flag & LV_TXT_FLAG_RIGHT) {
-            line_width = lv_txt_get_width(&txt[line_start], line_end - line_start,
-                                          font, style->text.letter_space, flag);
+            line_width = layout != NULL ? layout->lines[line_id].width :
+                         lv_txt_get_width(&txt[line_start], line_end - line_start, font, style->text.letter_space, flag);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
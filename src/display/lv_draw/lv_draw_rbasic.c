@@ -145,6 +145,9 @@ void lv_rletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
 
     if(map_p == NULL) return;
 
+    /*Compressed letters are only drawn through the glyph cache of 'lv_vletter'*/
+    if(lv_font_is_compressed(font_p, letter)) return;
+
     /*If the letter is completely out of mask don't draw it */
     if(pos_p->x + letter_w < mask_p->x1 || pos_p->x > mask_p->x2 ||
             pos_p->y + letter_h < mask_p->y1 || pos_p->y > mask_p->y2) return;
@@ -35,6 +35,14 @@ static void lv_draw_shadow(const lv_area_t * coords, const lv_area_t * mask, con
 static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask, const  lv_style_t * style, lv_opa_t opa_scale);
 static void lv_draw_shadow_bottom(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale);
 static void lv_draw_shadow_full_straight(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, const lv_opa_t * map);
+static void lv_draw_shadow_full_curve(lv_coord_t radius, lv_coord_t * curve_x, uint16_t len);
+static void lv_draw_shadow_full_1d_blur(lv_coord_t swidth, lv_opa_t opa, uint32_t * line_1d_blur);
+static uint16_t lv_draw_shadow_full_line(int16_t line, lv_coord_t radius, lv_coord_t swidth, const lv_coord_t * curve_x,
+                                         const uint32_t * line_1d_blur, lv_opa_t * line_2d_blur);
+#if LV_SHADOW_CACHE_SIZE
+static const lv_opa_t * shadow_cache_get(lv_coord_t radius, lv_coord_t swidth, lv_opa_t opa,
+                                         const lv_coord_t ** curve_x, const uint16_t ** cols);
+#endif
 #endif
 
 static uint16_t lv_draw_cont_radius_corr(uint16_t r, lv_coord_t w, lv_coord_t h);
@@ -46,6 +54,23 @@ static lv_opa_t antialias_get_opa_circ(lv_coord_t seg, lv_coord_t px_id, lv_opa_
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if USE_LV_SHADOW && LV_VDB_SIZE && LV_SHADOW_CACHE_SIZE
+#define SHADOW_CACHE_ENTRIES    8       /*Most shadow masks kept at once*/
+
+typedef struct {
+    lv_coord_t radius;
+    lv_coord_t swidth;
+    lv_opa_t opa;
+    uint32_t offset;                    /*Start of the mask in 'shadow_cache_buf'*/
+} shadow_cache_entry_t;
+
+/*Every mask is the length of its rows, the quarter circle of its corner and then
+ *its rows of opacities, allocated one after the other in 'shadow_cache_buf'*/
+static uint32_t shadow_cache_buf[LV_SHADOW_CACHE_SIZE / sizeof(uint32_t)];
+static shadow_cache_entry_t shadow_cache[SHADOW_CACHE_ENTRIES];
+static uint16_t shadow_cache_cnt;
+static uint32_t shadow_cache_head;      /*Where the next mask goes*/
+#endif
 
 /**********************
  *      MACROS
@@ -1085,24 +1110,23 @@ static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask
 
     radius += LV_ANTIALIAS;
 
+    lv_opa_t opa = opa_scale == LV_OPA_COVER ? style->body.opa : (uint16_t)((uint16_t) style->body.opa * opa_scale) >> 8;
+    const lv_coord_t * curve_x;
+    const uint16_t * cols;
+    const lv_opa_t * map = NULL;
+#if LV_SHADOW_CACHE_SIZE
+    map = shadow_cache_get(radius, swidth, opa, &curve_x, &cols);
+#endif
+
 #if LV_COMPILER_VLA_SUPPORTED
-    lv_coord_t curve_x[radius + swidth + 1];     /*Stores the 'x' coordinates of a quarter circle.*/
+    lv_coord_t curve_buf[radius + swidth + 1];     /*Stores the 'x' coordinates of a quarter circle.*/
 #else
 # if LV_HOR_RES > LV_VER_RES
-    lv_coord_t curve_x[LV_HOR_RES];
+    lv_coord_t curve_buf[LV_HOR_RES];
 # else
-    lv_coord_t curve_x[LV_VER_RES];
+    lv_coord_t curve_buf[LV_VER_RES];
 # endif
 #endif
-    memset(curve_x, 0, sizeof(curve_x));
-    lv_point_t circ;
-    lv_coord_t circ_tmp;
-    lv_circ_init(&circ, &circ_tmp, radius);
-    while(lv_circ_cont(&circ)) {
-        curve_x[LV_CIRC_OCT1_Y(circ)] = LV_CIRC_OCT1_X(circ);
-        curve_x[LV_CIRC_OCT2_Y(circ)] = LV_CIRC_OCT2_X(circ);
-        lv_circ_next(&circ, &circ_tmp);
-    }
     int16_t line;
 
     int16_t filter_width = 2 * swidth + 1;
@@ -1115,10 +1139,11 @@ static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask
     uint32_t line_1d_blur[LV_VER_RES];
 # endif
 #endif
-    /*1D Blur horizontally*/
-    lv_opa_t opa = opa_scale == LV_OPA_COVER ? style->body.opa : (uint16_t)((uint16_t) style->body.opa * opa_scale) >> 8;
-    for(line = 0; line < filter_width; line++) {
-        line_1d_blur[line] = (uint32_t)((uint32_t)(filter_width - line) * (opa * 2)  << SHADOW_OPA_EXTRA_PRECISION) / (filter_width * filter_width);
+    /*Without a cached mask calculate the corner and the 1D blur here*/
+    if(map == NULL) {
+        lv_draw_shadow_full_curve(radius, curve_buf, sizeof(curve_buf) / sizeof(curve_buf[0]));
+        lv_draw_shadow_full_1d_blur(swidth, opa, line_1d_blur);
+        curve_x = curve_buf;
     }
 
     uint16_t col;
@@ -1151,39 +1176,14 @@ static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask
 
     ofs_lt.x = coords->x1 + radius + LV_ANTIALIAS;
     ofs_lt.y = coords->y1 + radius + LV_ANTIALIAS;
-    bool line_ready;
     for(line = 0; line <= radius + swidth; line++) {        /*Check all rows and make the 1D blur to 2D*/
-        line_ready = false;
-        for(col = 0; col <= radius + swidth; col++) {        /*Check all pixels in a 1D blur line (from the origo to last shadow pixel (radius + swidth))*/
-
-            /*Sum the opacities from the lines above and below this 'row'*/
-            int16_t line_rel;
-            uint32_t px_opa_sum = 0;
-            for(line_rel = -swidth; line_rel <= swidth; line_rel ++) {
-                /*Get the relative x position of the 'line_rel' to 'line'*/
-                int16_t col_rel;
-                if(line + line_rel < 0) {                       /*Below the radius, here is the blur of the edge */
-                    col_rel = radius - curve_x[line] - col;
-                } else if(line + line_rel > radius) {           /*Above the radius, here won't be more 1D blur*/
-                    break;
-                } else {                                        /*Blur from the curve*/
-                    col_rel = curve_x[line + line_rel] - curve_x[line] - col;
-                }
-
-                /*Add the value of the 1D blur on 'col_rel' position*/
-                if(col_rel < -swidth) {                         /*Outside of the blurred area. */
-                    if(line_rel == -swidth) line_ready = true;  /*If no data even on the very first line then it wont't be anything else in this line*/
-                    break;                                      /*Break anyway because only smaller 'col_rel' values will come */
-                } else if(col_rel > swidth) px_opa_sum += line_1d_blur[0];      /*Inside the not blurred area*/
-                else px_opa_sum += line_1d_blur[swidth - col_rel];              /*On the 1D blur (+ swidth to align to the center)*/
-            }
-
-            line_2d_blur[col] = px_opa_sum >> SHADOW_OPA_EXTRA_PRECISION;
-            if(line_ready) {
-                col++;      /*To make this line to the last one ( drawing will go to '< col')*/
-                break;
-            }
-
+        const lv_opa_t * line_map;
+        if(map != NULL) {
+            line_map = &map[line * (radius + swidth + 1)];
+            col = cols[line];
+        } else {
+            col = lv_draw_shadow_full_line(line, radius, swidth, curve_x, line_1d_blur, line_2d_blur);
+            line_map = line_2d_blur;
         }
 
         /*Flush the line*/
@@ -1203,19 +1203,19 @@ static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask
         for(d = 1; d < col; d++) {
 
             if(point_lt.x < ofs_lt.x && point_lt.y < ofs_lt.y) {
-                px_fp(point_lt.x, point_lt.y, mask, style->body.shadow.color, line_2d_blur[d]);
+                px_fp(point_lt.x, point_lt.y, mask, style->body.shadow.color, line_map[d]);
             }
 
             if(point_lb.x < ofs_lb.x && point_lb.y > ofs_lb.y) {
-                px_fp(point_lb.x, point_lb.y, mask, style->body.shadow.color, line_2d_blur[d]);
+                px_fp(point_lb.x, point_lb.y, mask, style->body.shadow.color, line_map[d]);
             }
 
             if(point_rt.x > ofs_rt.x && point_rt.y < ofs_rt.y) {
-                px_fp(point_rt.x, point_rt.y, mask, style->body.shadow.color, line_2d_blur[d]);
+                px_fp(point_rt.x, point_rt.y, mask, style->body.shadow.color, line_map[d]);
             }
 
             if(point_rb.x > ofs_rb.x && point_rb.y > ofs_rb.y) {
-                px_fp(point_rb.x, point_rb.y, mask, style->body.shadow.color, line_2d_blur[d]);
+                px_fp(point_rb.x, point_rb.y, mask, style->body.shadow.color, line_map[d]);
             }
 
             point_rb.x++;
@@ -1228,10 +1228,167 @@ static void lv_draw_shadow_full(const lv_area_t * coords, const lv_area_t * mask
         /* Put the first line to the edges too.
          * It is not correct because blur should be done below the corner too
          * but is is simple, fast and gives a good enough result*/
-        if(line == 0) lv_draw_shadow_full_straight(coords, mask, style, line_2d_blur);
+        if(line == 0) lv_draw_shadow_full_straight(coords, mask, style, line_map);
+    }
+}
+
+/**
+ * Calculate the 'x' coordinates of a quarter circle for a full shadow
+ * @param radius radius of the circle
+ * @param curve_x store the coordinates here
+ * @param len length of 'curve_x' (the rest of it is cleared)
+ */
+static void lv_draw_shadow_full_curve(lv_coord_t radius, lv_coord_t * curve_x, uint16_t len)
+{
+    memset(curve_x, 0, len * sizeof(lv_coord_t));
+    lv_point_t circ;
+    lv_coord_t circ_tmp;
+    lv_circ_init(&circ, &circ_tmp, radius);
+    while(lv_circ_cont(&circ)) {
+        curve_x[LV_CIRC_OCT1_Y(circ)] = LV_CIRC_OCT1_X(circ);
+        curve_x[LV_CIRC_OCT2_Y(circ)] = LV_CIRC_OCT2_X(circ);
+        lv_circ_next(&circ, &circ_tmp);
     }
 }
 
+/**
+ * Calculate the horizontal 1D blur of a full shadow
+ * @param swidth width of the shadow
+ * @param opa opacity of the shadow
+ * @param line_1d_blur store the '2 * swidth + 1' values here
+ */
+static void lv_draw_shadow_full_1d_blur(lv_coord_t swidth, lv_opa_t opa, uint32_t * line_1d_blur)
+{
+    int16_t filter_width = 2 * swidth + 1;
+    int16_t line;
+    for(line = 0; line < filter_width; line++) {
+        line_1d_blur[line] = (uint32_t)((uint32_t)(filter_width - line) * (opa * 2)  << SHADOW_OPA_EXTRA_PRECISION) / (filter_width * filter_width);
+    }
+}
+
+/**
+ * Make the 1D blur to 2D in a row of a full shadow's corner
+ * @param line index of the row from the middle point of the radius
+ * @param radius radius of the corner
+ * @param swidth width of the shadow
+ * @param curve_x the 'x' coordinates of the corner's quarter circle
+ * @param line_1d_blur the 1D blur
+ * @param line_2d_blur store the opacities of the row here
+ * @return the opacities to draw from the row (drawing goes to '< col')
+ */
+static uint16_t lv_draw_shadow_full_line(int16_t line, lv_coord_t radius, lv_coord_t swidth, const lv_coord_t * curve_x,
+                                         const uint32_t * line_1d_blur, lv_opa_t * line_2d_blur)
+{
+    bool line_ready = false;
+    uint16_t col;
+    for(col = 0; col <= radius + swidth; col++) {        /*Check all pixels in a 1D blur line (from the origo to last shadow pixel (radius + swidth))*/
+
+        /*Sum the opacities from the lines above and below this 'row'*/
+        int16_t line_rel;
+        uint32_t px_opa_sum = 0;
+        for(line_rel = -swidth; line_rel <= swidth; line_rel ++) {
+            /*Get the relative x position of the 'line_rel' to 'line'*/
+            int16_t col_rel;
+            if(line + line_rel < 0) {                       /*Below the radius, here is the blur of the edge */
+                col_rel = radius - curve_x[line] - col;
+            } else if(line + line_rel > radius) {           /*Above the radius, here won't be more 1D blur*/
+                break;
+            } else {                                        /*Blur from the curve*/
+                col_rel = curve_x[line + line_rel] - curve_x[line] - col;
+            }
+
+            /*Add the value of the 1D blur on 'col_rel' position*/
+            if(col_rel < -swidth) {                         /*Outside of the blurred area. */
+                if(line_rel == -swidth) line_ready = true;  /*If no data even on the very first line then it wont't be anything else in this line*/
+                break;                                      /*Break anyway because only smaller 'col_rel' values will come */
+            } else if(col_rel > swidth) px_opa_sum += line_1d_blur[0];      /*Inside the not blurred area*/
+            else px_opa_sum += line_1d_blur[swidth - col_rel];              /*On the 1D blur (+ swidth to align to the center)*/
+        }
+
+        line_2d_blur[col] = px_opa_sum >> SHADOW_OPA_EXTRA_PRECISION;
+        if(line_ready) {
+            col++;      /*To make this line to the last one ( drawing will go to '< col')*/
+            break;
+        }
+
+    }
+
+    return col;
+}
+
+#if LV_SHADOW_CACHE_SIZE
+/**
+ * Get the opacity mask of a full shadow's corner, calculating it if it isn't cached yet
+ * @param radius radius of the corner (already corrected)
+ * @param swidth width of the shadow
+ * @param opa opacity of the shadow
+ * @param curve_x store a pointer to the 'x' coordinates of the corner's quarter circle here
+ * @param cols store a pointer to the length of every row here
+ * @return the rows of the mask ('radius + swidth + 1' opacities each) or NULL if it is too big to cache
+ */
+static const lv_opa_t * shadow_cache_get(lv_coord_t radius, lv_coord_t swidth, lv_opa_t opa,
+                                         const lv_coord_t ** curve_x, const uint16_t ** cols)
+{
+    uint32_t n = radius + swidth + 1;
+    const shadow_cache_entry_t * entry = NULL;
+    uint16_t i;
+    for(i = 0; i < shadow_cache_cnt; i++) {
+        if(shadow_cache[i].radius == radius && shadow_cache[i].swidth == swidth && shadow_cache[i].opa == opa) {
+            entry = &shadow_cache[i];
+            break;
+        }
+    }
+
+    if(entry == NULL) {
+        uint32_t size = (n * (sizeof(uint16_t) + sizeof(lv_coord_t) + n) + 3) & ~3;
+        if(size > LV_SHADOW_CACHE_SIZE / 2) return NULL;
+
+        /*Start over when the cache is full. A screen uses only a few shadow styles
+         *so they will be cached again after the next refresh*/
+        if(shadow_cache_cnt == SHADOW_CACHE_ENTRIES || shadow_cache_head + size > LV_SHADOW_CACHE_SIZE) {
+            shadow_cache_cnt = 0;
+            shadow_cache_head = 0;
+        }
+
+        shadow_cache_entry_t * new_entry = &shadow_cache[shadow_cache_cnt];
+        new_entry->radius = radius;
+        new_entry->swidth = swidth;
+        new_entry->opa = opa;
+        new_entry->offset = shadow_cache_head;
+
+        uint8_t * buf = (uint8_t *) shadow_cache_buf + new_entry->offset;
+        uint16_t * new_cols = (uint16_t *) buf;
+        lv_coord_t * new_curve_x = (lv_coord_t *)(buf + n * sizeof(uint16_t));
+        lv_opa_t * new_map = buf + n * (sizeof(uint16_t) + sizeof(lv_coord_t));
+
+#if LV_COMPILER_VLA_SUPPORTED
+        uint32_t line_1d_blur[2 * swidth + 1];
+#else
+# if LV_HOR_RES > LV_VER_RES
+        uint32_t line_1d_blur[LV_HOR_RES];
+# else
+        uint32_t line_1d_blur[LV_VER_RES];
+# endif
+#endif
+        lv_draw_shadow_full_curve(radius, new_curve_x, n);
+        lv_draw_shadow_full_1d_blur(swidth, opa, line_1d_blur);
+        memset(new_map, 0, n * n);
+        int16_t line;
+        for(line = 0; line < (int16_t) n; line++) {
+            new_cols[line] = lv_draw_shadow_full_line(line, radius, swidth, new_curve_x, line_1d_blur, &new_map[line * n]);
+        }
+
+        shadow_cache_cnt++;
+        shadow_cache_head += size;
+        entry = new_entry;
+    }
+
+    const uint8_t * buf = (const uint8_t *) shadow_cache_buf + entry->offset;
+    *cols = (const uint16_t *) buf;
+    *curve_x = (const lv_coord_t *)(buf + n * sizeof(uint16_t));
+    return buf + n * (sizeof(uint16_t) + sizeof(lv_coord_t));
+}
+#endif
 
 static void lv_draw_shadow_bottom(const lv_area_t * coords, const lv_area_t * mask, const lv_style_t * style, lv_opa_t opa_scale)
 {
@@ -34,6 +34,14 @@
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
+/*Use NEON to fill and blend 4 pixels at a time if the target has it*/
+#if defined(__ARM_NEON) && LV_COLOR_DEPTH == 32 && LV_COLOR_SCREEN_TRANSP == 0
+#define VBASIC_NEON    1
+#include <arm_neon.h>
+#else
+#define VBASIC_NEON    0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -44,6 +52,17 @@
 static void sw_mem_blend(lv_color_t * dest, const lv_color_t * src, uint32_t length, lv_opa_t opa);
 static void sw_color_fill(lv_area_t * mem_area, lv_color_t * mem, const lv_area_t * fill_area, lv_color_t color, lv_opa_t opa);
 
+static void sw_opa_map_blend(lv_color_t * dest, const uint8_t * opa_map, uint32_t length, lv_color_t color, lv_opa_t opa);
+
+#if LV_GLYPH_CACHE_SIZE
+static const uint8_t * glyph_cache_get(const lv_font_t * font_p, uint32_t letter, const uint8_t * map_p,
+                                       uint8_t letter_w, uint8_t letter_h, uint8_t bpp, const uint8_t * bpp_opa_table);
+#endif
+
+#if VBASIC_NEON
+static inline uint8x16_t neon_color_mix(uint16x8_t c1_lo, uint16x8_t c1_hi, uint8x16_t c2, uint8x8_t mix_inv);
+#endif
+
 #if LV_COLOR_SCREEN_TRANSP
 static inline lv_color_t color_mix_2_alpha(lv_color_t bg_color, lv_opa_t bg_opa, lv_color_t fg_color, lv_opa_t fg_opa);
 #endif
@@ -51,6 +70,25 @@ static inline lv_color_t color_mix_2_alpha(lv_color_t bg_color, lv_opa_t bg_opa,
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_GLYPH_CACHE_SIZE
+#define GLYPH_CACHE_ENTRIES     64      /*Most glyphs kept at once*/
+
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    uint32_t offset;                    /*Start of the opacity map in 'glyph_cache_buf'*/
+    uint32_t size;
+} glyph_cache_entry_t;
+
+/*The opacity maps are allocated one after the other around 'glyph_cache_buf',
+ *and the entries are kept in the same order in the 'glyph_cache' ring*/
+static uint8_t glyph_cache_buf[LV_GLYPH_CACHE_SIZE];
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_ENTRIES];
+static uint16_t glyph_cache_first;      /*The oldest entry*/
+static uint16_t glyph_cache_cnt;
+static uint32_t glyph_cache_head;       /*Where the next opacity map goes*/
+static uint8_t glyph_unpack_buf[LV_GLYPH_CACHE_SIZE / 4];   /*The bitmap of a compressed letter being decoded*/
+#endif
 
 /**********************
  *      MACROS
@@ -325,11 +363,33 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
     /*If the letter is partially out of mask the move there on VDB*/
     vdb_buf_tmp += (row_start * vdb_width) + col_start;
 
+    lv_disp_t * disp = lv_disp_get_active();
+
+#if LV_GLYPH_CACHE_SIZE
+    /*Blend the letter's opacity map if it's already decoded (or can be)*/
+    if(disp->driver.vdb_wr == NULL) {
+        const uint8_t * opa_map = glyph_cache_get(font_p, letter, map_p, letter_w, letter_h, bpp, bpp_opa_table);
+        if(opa_map != NULL) {
+            opa_map += (row_start * letter_w) + col_start;
+            for(row = row_start; row < row_end; row ++) {
+                sw_opa_map_blend(vdb_buf_tmp, opa_map, col_end - col_start, color, opa);
+                opa_map += letter_w;
+                vdb_buf_tmp += vdb_width;
+            }
+            return;
+        }
+    }
+#endif
+
+    /*Compressed letters can only be drawn by unpacking them to the cache*/
+    if(lv_font_is_compressed(font_p, letter)) {
+        LV_LOG_WARN("Font: compressed letter can't be drawn without the glyph cache");
+        return;
+    }
+
     /*Move on the map too*/
     map_p += (row_start * width_byte_bpp) + ((col_start * bpp) >> 3);
 
-    lv_disp_t * disp = lv_disp_get_active();
-
     uint8_t letter_px;
     lv_opa_t px_opa;
     for(row = row_start; row < row_end; row ++) {
@@ -378,6 +438,19 @@ void lv_vletter(const lv_point_t * pos_p, const lv_area_t * mask_p,
     }
 }
 
+/**
+ * Forget the opacity maps of the letters 'lv_vletter' decoded.
+ * Call it before a font which was drawn is freed or changed.
+ */
+void lv_vletter_cache_clear(void)
+{
+#if LV_GLYPH_CACHE_SIZE
+    glyph_cache_first = 0;
+    glyph_cache_cnt = 0;
+    glyph_cache_head = 0;
+#endif
+}
+
 /**
  * Draw a color map to the display (image)
  * @param cords_p coordinates the color map
@@ -561,8 +634,19 @@ static void sw_mem_blend(lv_color_t * dest, const lv_color_t * src, uint32_t len
     if(opa == LV_OPA_COVER) {
         memcpy(dest, src, length * sizeof(lv_color_t));
     } else {
-        uint32_t col;
-        for(col = 0; col < length; col++) {
+        uint32_t col = 0;
+#if VBASIC_NEON
+        uint8x8_t mix = vdup_n_u8(opa);
+        uint8x8_t mix_inv = vdup_n_u8(255 - opa);
+        for(; col + 4 <= length; col += 4) {
+            uint8x16_t src_px = vld1q_u8((const uint8_t *)&src[col]);
+            uint8x16_t dest_px = vld1q_u8((const uint8_t *)&dest[col]);
+            uint8x16_t res = neon_color_mix(vmull_u8(vget_low_u8(src_px), mix), vmull_u8(vget_high_u8(src_px), mix),
+                                            dest_px, mix_inv);
+            vst1q_u8((uint8_t *)&dest[col], res);
+        }
+#endif
+        for(; col < length; col++) {
             dest[col] = lv_color_mix(src[col], dest[col], opa);
         }
     }
@@ -597,7 +681,14 @@ static void sw_color_fill(lv_area_t * mem_area, lv_color_t * mem, const lv_area_
         if(opa == LV_OPA_COVER) {
 
             /*Fill the first row with 'color'*/
-            for(col = fill_area->x1; col <= fill_area->x2; col++) {
+            col = fill_area->x1;
+#if VBASIC_NEON
+            uint32x4_t color_px = vdupq_n_u32(color.full);
+            for(; col + 3 <= fill_area->x2; col += 4) {
+                vst1q_u32(&mem[col].full, color_px);
+            }
+#endif
+            for(; col <= fill_area->x2; col++) {
                 mem[col] = color;
             }
 
@@ -617,9 +708,21 @@ static void sw_color_fill(lv_area_t * mem_area, lv_color_t * mem, const lv_area_
 #if LV_COLOR_SCREEN_TRANSP == 0
             lv_color_t bg_tmp = LV_COLOR_BLACK;
             lv_color_t opa_tmp = lv_color_mix(color, bg_tmp, opa);
+#endif
+#if VBASIC_NEON
+            /*The same color is mixed in everywhere so its part of the sums is the same for every pixel*/
+            uint16x8_t color_part = vmull_u8(vreinterpret_u8_u32(vdup_n_u32(color.full)), vdup_n_u8(opa));
+            uint8x8_t mix_inv = vdup_n_u8(255 - opa);
 #endif
             for(row = fill_area->y1; row <= fill_area->y2; row++) {
-                for(col = fill_area->x1; col <= fill_area->x2; col++) {
+                col = fill_area->x1;
+#if VBASIC_NEON
+                for(; col + 3 <= fill_area->x2; col += 4) {
+                    uint8x16_t bg_px = vld1q_u8((const uint8_t *)&mem[col]);
+                    vst1q_u8((uint8_t *)&mem[col], neon_color_mix(color_part, color_part, bg_px, mix_inv));
+                }
+#endif
+                for(; col <= fill_area->x2; col++) {
 #if LV_COLOR_SCREEN_TRANSP == 0
                     /*If the bg color changed recalculate the result color*/
                     if(mem[col].full != bg_tmp.full) {
@@ -639,6 +742,159 @@ static void sw_color_fill(lv_area_t * mem_area, lv_color_t * mem, const lv_area_
     }
 }
 
+/**
+ * Blend a color to destination memory using a map of opacities
+ * @param dest a memory address. Blend the color here.
+ * @param opa_map opacity of the color for every pixel of 'dest' (0: leave the pixel alone)
+ * @param length number of pixels
+ * @param color the color to blend
+ * @param opa opacity of the whole map (0, LV_OPA_TRANSP: transparent ... 255, LV_OPA_COVER, fully cover)
+ */
+static void sw_opa_map_blend(lv_color_t * dest, const uint8_t * opa_map, uint32_t length, lv_color_t color, lv_opa_t opa)
+{
+    uint32_t col = 0;
+#if VBASIC_NEON
+    const uint8x8_t color_px = vreinterpret_u8_u32(vdup_n_u32(color.full));
+    const uint8x8_t opa_v = vdup_n_u8(opa);
+    const uint8x8_t alpha = vreinterpret_u8_u32(vdup_n_u32(0xFF000000));
+    const uint8x8_t spread_lo = {0, 0, 0, 0, 1, 1, 1, 1};     /*Copy the opacity of a pixel to its 4 bytes*/
+    const uint8x8_t spread_hi = {2, 2, 2, 2, 3, 3, 3, 3};
+    for(; col + 4 <= length; col += 4) {
+        uint32_t map_4px;
+        memcpy(&map_4px, &opa_map[col], sizeof(map_4px));
+        if(map_4px == 0) continue;
+
+        uint8x8_t map_px = vreinterpret_u8_u32(vdup_n_u32(map_4px));
+        uint8x8_t px_opa = opa == LV_OPA_COVER ? map_px : vshrn_n_u16(vmull_u8(map_px, opa_v), 8);
+        uint8x16_t bg = vld1q_u8((const uint8_t *)&dest[col]);
+
+        uint8x8_t mix_lo = vtbl1_u8(px_opa, spread_lo);
+        uint8x8_t mix_hi = vtbl1_u8(px_opa, spread_hi);
+        uint16x8_t lo = vmlal_u8(vmull_u8(color_px, mix_lo), vget_low_u8(bg), vmvn_u8(mix_lo));
+        uint16x8_t hi = vmlal_u8(vmull_u8(color_px, mix_hi), vget_high_u8(bg), vmvn_u8(mix_hi));
+
+        /*Pixels with 0 in the map are left alone*/
+        uint8x8_t res_lo = vbsl_u8(vceq_u8(vtbl1_u8(map_px, spread_lo), vdup_n_u8(0)), vget_low_u8(bg),
+                                   vorr_u8(vshrn_n_u16(lo, 8), alpha));
+        uint8x8_t res_hi = vbsl_u8(vceq_u8(vtbl1_u8(map_px, spread_hi), vdup_n_u8(0)), vget_high_u8(bg),
+                                   vorr_u8(vshrn_n_u16(hi, 8), alpha));
+        vst1q_u8((uint8_t *)&dest[col], vcombine_u8(res_lo, res_hi));
+    }
+#endif
+    for(; col < length; col++) {
+        if(opa_map[col] == 0) continue;
+        lv_opa_t px_opa = opa == LV_OPA_COVER ? opa_map[col] : (uint16_t)((uint16_t)opa_map[col] * opa) >> 8;
+#if LV_COLOR_SCREEN_TRANSP == 0
+        dest[col] = lv_color_mix(color, dest[col], px_opa);
+#else
+        dest[col] = color_mix_2_alpha(dest[col], dest[col].alpha, color, px_opa);
+#endif
+    }
+}
+
+#if LV_GLYPH_CACHE_SIZE
+/**
+ * Check whether an area of 'glyph_cache_buf' is used by an entry
+ * @param offset start of the area
+ * @param size size of the area
+ * @return true: an entry's opacity map overlaps the area
+ */
+static bool glyph_cache_is_used(uint32_t offset, uint32_t size)
+{
+    uint16_t i;
+    for(i = 0; i < glyph_cache_cnt; i++) {
+        const glyph_cache_entry_t * entry = &glyph_cache[(glyph_cache_first + i) % GLYPH_CACHE_ENTRIES];
+        if(entry->offset < offset + size && offset < entry->offset + entry->size) return true;
+    }
+    return false;
+}
+
+/**
+ * Get the opacity map of a letter, one byte per pixel, decoding the font's bitmap into the cache if needed.
+ * When the cache is full the oldest letters are dropped, so letters drawn all the time stay
+ * as long as they fit in the cache together.
+ * @param font_p pointer to the font the letter was looked up in
+ * @param letter an UNICODE character code
+ * @param map_p the letter's bitmap in the font
+ * @param letter_w width of the letter
+ * @param letter_h height of the letter
+ * @param bpp bit per pixel of the bitmap (1, 2, 4 or 8)
+ * @param bpp_opa_table opacity of the pixel values of bitmap, NULL if 'bpp' is 8
+ * @return 'letter_w' x 'letter_h' opacities or NULL if the letter is too large to cache
+ */
+static const uint8_t * glyph_cache_get(const lv_font_t * font_p, uint32_t letter, const uint8_t * map_p,
+                                       uint8_t letter_w, uint8_t letter_h, uint8_t bpp, const uint8_t * bpp_opa_table)
+{
+    uint16_t i;
+    for(i = 0; i < glyph_cache_cnt; i++) {
+        const glyph_cache_entry_t * entry = &glyph_cache[(glyph_cache_first + i) % GLYPH_CACHE_ENTRIES];
+        if(entry->font == font_p && entry->letter == letter) return &glyph_cache_buf[entry->offset];
+    }
+
+    /*Don't let one large letter push out a whole screen of small ones*/
+    uint32_t size = (uint32_t)letter_w * letter_h;
+    if(size == 0 || size > LV_GLYPH_CACHE_SIZE / 4) return NULL;
+
+    uint32_t offset = glyph_cache_head;
+    if(offset + size > LV_GLYPH_CACHE_SIZE) offset = 0;
+
+    /*Drop the oldest letters until there is room*/
+    while(glyph_cache_cnt == GLYPH_CACHE_ENTRIES || glyph_cache_is_used(offset, size)) {
+        glyph_cache_first = (glyph_cache_first + 1) % GLYPH_CACHE_ENTRIES;
+        glyph_cache_cnt--;
+    }
+
+    glyph_cache_entry_t * entry = &glyph_cache[(glyph_cache_first + glyph_cache_cnt) % GLYPH_CACHE_ENTRIES];
+    entry->font = font_p;
+    entry->letter = letter;
+    entry->offset = offset;
+    entry->size = size;
+    glyph_cache_cnt++;
+    glyph_cache_head = offset + size;
+
+    /*Decode the bitmap row by row. The rows start on byte boundaries.*/
+    uint8_t * opa_p = &glyph_cache_buf[offset];
+    uint8_t width_byte_bpp = (letter_w * bpp) >> 3;
+    if((letter_w * bpp) & 0x7) width_byte_bpp++;
+    if(lv_font_is_compressed(font_p, letter)) {
+        /*The packed rows are never longer than the opacity map*/
+        lv_font_decompress(map_p, glyph_unpack_buf, (uint32_t)width_byte_bpp * letter_h);
+        map_p = glyph_unpack_buf;
+    }
+    uint8_t px_mask = (1 << bpp) - 1;
+    lv_coord_t row;
+    lv_coord_t col;
+    for(row = 0; row < letter_h; row++) {
+        for(col = 0; col < letter_w; col++) {
+            uint32_t bit = (uint32_t)col * bpp;
+            uint8_t letter_px = (map_p[bit >> 3] >> (8 - (bit & 0x7) - bpp)) & px_mask;
+            *opa_p++ = bpp == 8 ? letter_px : bpp_opa_table[letter_px];
+        }
+        map_p += width_byte_bpp;
+    }
+
+    return &glyph_cache_buf[offset];
+}
+#endif
+
+#if VBASIC_NEON
+/**
+ * Mix 4 pixels into 4 others like 'lv_color_mix', giving the same results
+ * @param c1_lo the first 2 pixels to mix in, already multiplied by the mix ratio
+ * @param c1_hi the last 2 pixels to mix in, already multiplied by the mix ratio
+ * @param c2 the pixels to mix them into
+ * @param mix_inv 255 minus the mix ratio, in every lane
+ * @return the mixed pixels, fully opaque
+ */
+static inline uint8x16_t neon_color_mix(uint16x8_t c1_lo, uint16x8_t c1_hi, uint8x16_t c2, uint8x8_t mix_inv)
+{
+    uint16x8_t lo = vmlal_u8(c1_lo, vget_low_u8(c2), mix_inv);
+    uint16x8_t hi = vmlal_u8(c1_hi, vget_high_u8(c2), mix_inv);
+    uint8x16_t ret = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+    return vorrq_u8(ret, vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000)));
+}
+#endif
+
 #if LV_COLOR_SCREEN_TRANSP
 
 /**
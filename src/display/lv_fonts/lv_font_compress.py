@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Compresses the glyph bitmaps of an LVGL font source file.
+
+Every glyph's bitmap is packed with PackBits, which lv_font_decompress() in
+lv_font.c unpacks into the glyph cache the first time the glyph is drawn:
+a header byte n of 0..127 copies the next n + 1 bytes, a header byte of
+129..255 repeats the next byte 257 - n times, and 128 is never used.
+
+The glyph indices are rewritten to the offsets of the packed bitmaps and the
+font is marked as compressed. The file is rewritten in place and files which
+are already compressed are left as they are.
+
+Usage: lv_font_compress.py font.c [font.c ...]
+"""
+
+import re
+import sys
+
+GLYPH_START = re.compile(r'^\s*/\*Unicode: (U\+[0-9a-fA-F]+) \((.*)\) , Width: (\d+) \*/')
+BYTES = re.compile(r'0x[0-9a-fA-F]{2}')
+GLYPH_INDEX = re.compile(r'\.glyph_index = (\d+)\}')
+BYTES_PER_LINE = 16
+
+
+def pack_bits(data):
+    """Packs bytes with PackBits"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out.append(257 - run)
+            out.append(data[i])
+            i += run
+            continue
+        # Copy bytes until the next run of at least three
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out.extend(data[start:i])
+    return bytes(out)
+
+
+def compress_bitmaps(lines):
+    """Rewrites the glyph bitmaps between the bitmap array's braces"""
+    out = []
+    offsets = []      # (old offset, new offset) of every glyph of the current bpp
+    old_offset = new_offset = 0
+    glyph = None      # (comment, bytes) of the glyph being read
+
+    def flush():
+        nonlocal old_offset, new_offset
+        if glyph is None:
+            return
+        comment, data = glyph
+        packed = pack_bits(data)
+        offsets[-1][old_offset] = new_offset
+        old_offset += len(data)
+        new_offset += len(packed)
+        out.append(comment)
+        indent = comment[:len(comment) - len(comment.lstrip())]
+        for i in range(0, len(packed), BYTES_PER_LINE):
+            out.append(indent + ' '.join('0x%02x,' % b for b in packed[i:i + BYTES_PER_LINE]) + '\n')
+        out.append('\n')
+
+    for line in lines:
+        stripped = line.strip()
+        if stripped.startswith('#if') or stripped.startswith('#elif') or stripped.startswith('#endif'):
+            flush()
+            glyph = None
+            out.append(line)
+            offsets.append({})
+            old_offset = new_offset = 0
+        elif GLYPH_START.match(line):
+            flush()
+            glyph = (line, bytearray())
+        elif glyph is not None:
+            glyph[1].extend(int(b, 16) for b in BYTES.findall(line.split('//')[0]))
+    flush()
+    return out, [o for o in offsets if o]
+
+
+def array_start(lines, name):
+    """Finds the line of the opening brace of an array"""
+    i = next(i for i, line in enumerate(lines) if name in line)
+    return i if '{' in lines[i] else i + 1
+
+
+def compress(path):
+    with open(path) as f:
+        lines = f.readlines()
+    if any('.compressed = 1' in line for line in lines):
+        return
+
+    start = array_start(lines, '_glyph_bitmap[] =')
+    end = next(i for i in range(start, len(lines)) if lines[i].startswith('};'))
+    bitmaps, offsets = compress_bitmaps(lines[start + 1:end])
+    lines[start + 1:end] = bitmaps
+
+    # The glyph descriptions have the same '#if' sections as the bitmaps
+    start = array_start(lines, '_glyph_dsc[] =')
+    end = next(i for i in range(start, len(lines)) if lines[i].startswith('};'))
+    section = -1
+    for i in range(start + 1, end):
+        if lines[i].lstrip().startswith('#if') or lines[i].lstrip().startswith('#elif'):
+            section += 1
+        match = GLYPH_INDEX.search(lines[i])
+        if match:
+            new_index = offsets[section][int(match.group(1))]
+            lines[i] = lines[i][:match.start(1)] + str(new_index) + lines[i][match.end(1):]
+
+    font = next(i for i, line in enumerate(lines) if re.match(r'^lv_font_t \w+ =', line))
+    end = next(i for i in range(font, len(lines)) if lines[i].startswith('};'))
+    lines.insert(end, '    .compressed = 1,        /*The glyphs are packed with PackBits*/\n')
+
+    with open(path, 'w') as f:
+        f.writelines(lines)
+
+
+if __name__ == '__main__':
+    for path in sys.argv[1:]:
+        compress(path)
@@ -11,8751 +11,2050 @@
 static const uint8_t lv_font_dejavu_20_glyph_bitmap[] = {
 #if USE_LV_FONT_DEJAVU_20 == 1
     /*Unicode: U+0020 ( ) , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-
+    0xed, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xf8, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0022 (") , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0xcc,  //@@..@@
-    0xcc,  //@@..@@
-    0xcc,  //@@..@@
-    0xcc,  //@@..@@
-    0xcc,  //@@..@@
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-
+    0xfe, 0x00, 0xfc, 0xcc, 0xf5, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x04, 0x40,  //.....@..+@..
-    0x04, 0x40,  //....+@..+@..
-    0x0c, 0xc0,  //....%@..%%..
-    0x0c, 0x80,  //....@%..@+..
-    0x7f, 0xf0,  //.@@@@@@@@@@@
-    0x7f, 0xf0,  //.@@@@@@@@@@@
-    0x09, 0x80,  //...+@..%@...
-    0x19, 0x00,  //...@%..@+...
-    0xff, 0xe0,  //@@@@@@@@@@@.
-    0xff, 0xe0,  //@@@@@@@@@@@.
-    0x13, 0x00,  //..+@..%@....
-    0x33, 0x00,  //..%%..%%....
-    0x32, 0x00,  //..@%..@+....
-    0x22, 0x00,  //..@+..@.....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfd, 0x00, 0x1a, 0x04, 0x40, 0x04, 0x40, 0x0c, 0xc0, 0x0c, 0x80, 0x7f, 0xf0, 0x7f, 0xf0, 0x09,
+    0x80, 0x19, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x13, 0x00, 0x33, 0x00, 0x32, 0x00, 0x22, 0xf8, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x08, 0x00,  //....@....
-    0x08, 0x00,  //....@....
-    0x3e, 0x00,  //.+%@@@%..
-    0x7f, 0x00,  //+@@@@@@@.
-    0xe9, 0x00,  //@@%.@.+@.
-    0xc8, 0x00,  //@@..@....
-    0xf8, 0x00,  //%@@%@....
-    0x7e, 0x00,  //.@@@@@@+.
-    0x0f, 0x00,  //...+@@@@+
-    0x09, 0x80,  //....@.+@@
-    0x09, 0x80,  //....@..@@
-    0x8b, 0x80,  //@+..@.%@@
-    0xff, 0x00,  //@@@@@@@@+
-    0x7e, 0x00,  //.%@@@@%+.
-    0x08, 0x00,  //....@....
-    0x08, 0x00,  //....@....
-    0x08, 0x00,  //....@....
-    0x00, 0x00,  //.........
-
+    0xfd, 0x00, 0x20, 0x08, 0x00, 0x08, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0xf8,
+    0x00, 0x7e, 0x00, 0x0f, 0x00, 0x09, 0x80, 0x09, 0x80, 0x8b, 0x80, 0xff, 0x00, 0x7e, 0x00, 0x08,
+    0x00, 0x08, 0x00, 0x08, 0xfe, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 15 */
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x78, 0x10,  //.%@@%.....+@...
-    0x48, 0x20,  //+@++@+....@....
-    0xcc, 0x60,  //@@..@@...%%....
-    0xcc, 0x40,  //@@..@@...@.....
-    0xcc, 0x80,  //@@..@@..@+.....
-    0xc8, 0x80,  //+@++@+.+%......
-    0x79, 0x3c,  //.%@@%..@..%@@%.
-    0x02, 0x24,  //......%+.+@++@+
-    0x02, 0x66,  //.....+@..@@..@@
-    0x04, 0x66,  //.....@...@@..@@
-    0x0c, 0x66,  //....%%...@@..@@
-    0x08, 0x24,  //....@....+@++@+
-    0x10, 0x3c,  //...@+.....%@@%.
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-
+    0xfb, 0x00, 0x19, 0x78, 0x10, 0x48, 0x20, 0xcc, 0x60, 0xcc, 0x40, 0xcc, 0x80, 0xc8, 0x80, 0x79,
+    0x3c, 0x02, 0x24, 0x02, 0x66, 0x04, 0x66, 0x0c, 0x66, 0x08, 0x24, 0x10, 0x3c, 0xf9, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x0f, 0x00,  //...+@@@%+...
-    0x1f, 0x80,  //..+@@@@@@...
-    0x30, 0x80,  //..@@+..+%...
-    0x30, 0x00,  //..@@........
-    0x38, 0x00,  //..%@%.......
-    0x3c, 0x00,  //..%@@%......
-    0x7e, 0x60,  //.%@%@@%..@@.
-    0xc7, 0x60,  //%@+.+@@%+@%.
-    0xc3, 0xc0,  //@@...+@@@@..
-    0xc1, 0x80,  //@@+...+@@+..
-    0xe1, 0xc0,  //%@@+..+@@%..
-    0x7f, 0xe0,  //.@@@@@@@@@%.
-    0x3e, 0x70,  //..%@@@%.+@@%
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x19, 0x0f, 0x00, 0x1f, 0x80, 0x30, 0x80, 0x30, 0x00, 0x38, 0x00, 0x3c, 0x00, 0x7e,
+    0x60, 0xc7, 0x60, 0xc3, 0xc0, 0xc1, 0x80, 0xe1, 0xc0, 0x7f, 0xe0, 0x3e, 0x70, 0xf9, 0x00,
 
     /*Unicode: U+0027 (') , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xfc, 0xc0, 0xf5, 0x00,
 
     /*Unicode: U+0028 (() , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x30,  //..%@
-    0x20,  //..@+
-    0x60,  //.%@.
-    0x60,  //.@%.
-    0x40,  //+@+.
-    0xc0,  //%@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //%@..
-    0x40,  //+@+.
-    0x60,  //.@%.
-    0x60,  //.%@.
-    0x20,  //..@+
-    0x30,  //..%@
-    0x00,  //....
-    0x00,  //....
-
+    0x06, 0x00, 0x00, 0x30, 0x20, 0x60, 0x60, 0x40, 0xfb, 0xc0, 0x06, 0x40, 0x60, 0x60, 0x20, 0x30,
+    0x00, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xc0,  //@%..
-    0x40,  //+@..
-    0x60,  //.@%.
-    0x60,  //.%@.
-    0x20,  //.+@+
-    0x30,  //..@%
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@%
-    0x20,  //.+@+
-    0x60,  //.%@.
-    0x60,  //.@%.
-    0x40,  //+@..
-    0xc0,  //@%..
-    0x00,  //....
-    0x00,  //....
-
+    0x06, 0x00, 0x00, 0xc0, 0x40, 0x60, 0x60, 0x20, 0xfb, 0x30, 0x06, 0x20, 0x60, 0x60, 0x40, 0xc0,
+    0x00, 0x00,
 
     /*Unicode: U+002a (*) , Width: 7 */
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x10,  //...@...
-    0x92,  //%..@..%
-    0x54,  //+@+@+@+
-    0x38,  //..@@@..
-    0x38,  //..@@@..
-    0x54,  //+@+@+@+
-    0x92,  //%..@..%
-    0x10,  //...@...
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-
+    0xfe, 0x00, 0x07, 0x10, 0x92, 0x54, 0x38, 0x38, 0x54, 0x92, 0x10, 0xf8, 0x00,
 
     /*Unicode: U+002b (+) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0xff, 0xf0,  //@@@@@@@@@@@@
-    0xff, 0xf0,  //@@@@@@@@@@@@
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xf9, 0x00, 0x16, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xff, 0xf0, 0xff,
+    0xf0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x00,
 
     /*Unicode: U+002c (,) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x60,  //.@@
-    0x60,  //.@@
-    0x40,  //+@.
-    0x80,  //@+.
-    0x00,  //...
-    0x00,  //...
-
+    0xf3, 0x00, 0x05, 0x60, 0x60, 0x40, 0x80, 0x00, 0x00,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0xf8,  //@@@@@
-    0xf8,  //@@@@@
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-
+    0xf7, 0x00, 0x01, 0xf8, 0xf8, 0xf9, 0x00,
 
     /*Unicode: U+002e (.) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xf3, 0x00, 0x01, 0xc0, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+002f (/) , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x0c,  //....@@
-    0x0c,  //...+@%
-    0x18,  //...%@+
-    0x18,  //...@@.
-    0x18,  //...@@.
-    0x38,  //..+@%.
-    0x30,  //..@@+.
-    0x30,  //..@@..
-    0x30,  //.+@@..
-    0x70,  //.%@%..
-    0x60,  //.@@+..
-    0x60,  //.@@...
-    0x60,  //+@%...
-    0xc0,  //%@+...
-    0xc0,  //@@....
-    0x00,  //......
-    0x00,  //......
-
+    0xfe, 0x00, 0x01, 0x0c, 0x0c, 0xfe, 0x18, 0x00, 0x38, 0xfe, 0x30, 0x00, 0x70, 0xfe, 0x60, 0x03,
+    0xc0, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x1c, 0x00,  //..+@@@+..
-    0x7f, 0x00,  //.%@@@@@%.
-    0x63, 0x00,  //+@@+.+@@+
-    0xc1, 0x80,  //%@+...+@%
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //%@+...+@%
-    0x63, 0x00,  //+@@+.+@@+
-    0x7f, 0x00,  //.%@@@@@%.
-    0x3e, 0x00,  //..+@@@+..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x1c, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+    0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x38,  //.+@@@...
-    0xf8,  //@@@@@...
-    0x98,  //@+.@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x02, 0x38, 0xf8, 0x98, 0xf9, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x7c, 0x00,  //.%@@@%...
-    0xfe, 0x00,  //@@@@@@@+.
-    0x87, 0x00,  //@+...@@@.
-    0x03, 0x00,  //......@@.
-    0x03, 0x00,  //......@@.
-    0x06, 0x00,  //.....%@+.
-    0x06, 0x00,  //....+@@..
-    0x0c, 0x00,  //...+@@...
-    0x18, 0x00,  //..+@@+...
-    0x30, 0x00,  //.+@@+....
-    0x60, 0x00,  //+@@+.....
-    0xff, 0x00,  //@@@@@@@@.
-    0xff, 0x00,  //@@@@@@@@.
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x7c, 0x00, 0xfe, 0x00, 0x87, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xff, 0x00, 0xff, 0xf8, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x7e, 0x00,  //.%@@@@%..
-    0xff, 0x00,  //@@@@@@@@+
-    0x83, 0x80,  //@+....%@@
-    0x01, 0x80,  //.......@@
-    0x03, 0x80,  //......%@%
-    0x3e, 0x00,  //..@@@@@+.
-    0x3f, 0x00,  //..@@@@@%.
-    0x03, 0x80,  //.....+@@%
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x83, 0x80,  //%+...+@@%
-    0xff, 0x00,  //@@@@@@@@.
-    0x7e, 0x00,  //.%@@@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x7e, 0x00, 0xff, 0x00, 0x83, 0x80, 0x01, 0x80, 0x03, 0x80, 0x3e, 0x00, 0x3f,
+    0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x83, 0x80, 0xff, 0x00, 0x7e, 0xf8, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x07, 0x00,  //.....%@@..
-    0x07, 0x00,  //....+@@@..
-    0x0b, 0x00,  //....@+@@..
-    0x1b, 0x00,  //...%@.@@..
-    0x13, 0x00,  //..+@..@@..
-    0x23, 0x00,  //..@+..@@..
-    0x63, 0x00,  //.@@...@@..
-    0x43, 0x00,  //+@....@@..
-    0xff, 0xc0,  //@@@@@@@@@@
-    0xff, 0xc0,  //@@@@@@@@@@
-    0x03, 0x00,  //......@@..
-    0x03, 0x00,  //......@@..
-    0x03, 0x00,  //......@@..
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xfb, 0x00, 0x18, 0x07, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x23, 0x00, 0x63,
+    0x00, 0x43, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x03, 0xf8, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x7e,  //.@@@@@@.
-    0x7e,  //.@@@@@@.
-    0x60,  //.@@.....
-    0x60,  //.@@.....
-    0x7c,  //.@@@@@..
-    0x7e,  //.@@@@@@.
-    0x47,  //.%...@@%
-    0x03,  //......@@
-    0x03,  //......@@
-    0x03,  //......@@
-    0x87,  //%...+@@%
-    0xfe,  //@@@@@@@.
-    0x7c,  //.%@@@%..
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x06, 0x7e, 0x7e, 0x60, 0x60, 0x7c, 0x7e, 0x47, 0xfe, 0x03, 0x02, 0x87, 0xfe, 0x7c,
+    0xfd, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x1e, 0x00,  //...%@@@+.
-    0x3f, 0x00,  //.+@@@@@@.
-    0x71, 0x00,  //.@@%...%.
-    0xe0, 0x00,  //+@@......
-    0xc0, 0x00,  //@@+......
-    0xde, 0x00,  //@@.%@@%..
-    0xff, 0x00,  //@@%@@@@@.
-    0xe3, 0x80,  //@@%...%@%
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //%@.....@@
-    0x63, 0x80,  //+@%...%@%
-    0x7f, 0x00,  //.%@@@@@@.
-    0x1e, 0x00,  //..+@@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x1e, 0x00, 0x3f, 0x00, 0x71, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xde, 0x00, 0xff,
+    0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x80, 0x7f, 0x00, 0x1e, 0xf8, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x06,  //.....%@+
-    0x06,  //.....@@.
-    0x06,  //....+@@.
-    0x0c,  //....%@+.
-    0x0c,  //....@@..
-    0x0c,  //....@@..
-    0x1c,  //...%@%..
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x38,  //..%@%...
-    0x30,  //..@@+...
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x06, 0xfe, 0x0c, 0x04, 0x1c, 0x18, 0x18, 0x38, 0x30, 0xfd,
+    0x00,
 
     /*Unicode: U+0038 (8) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x3e, 0x00,  //.+%@@@%+.
-    0x7f, 0x00,  //+@@@@@@@+
-    0xe3, 0x80,  //@@%...%@@
-    0xc1, 0x80,  //@@.....@@
-    0xe3, 0x80,  //%@%...%@%
-    0x3e, 0x00,  //.+@@@@@+.
-    0x7f, 0x00,  //.%@@@@@%.
-    0xe3, 0x80,  //%@%...%@%
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xe3, 0x80,  //@@%...%@@
-    0x7f, 0x00,  //+@@@@@@@+
-    0x3e, 0x00,  //..%@@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x3e, 0x00, 0x7f,
+    0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x3c, 0x00,  //..%@@@+..
-    0x7f, 0x00,  //.@@@@@@%.
-    0xe3, 0x00,  //%@%...%@.
-    0xc1, 0x80,  //@@.....@%
-    0xc1, 0x80,  //@@.....@@
-    0xe3, 0x80,  //%@%...%@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0x3d, 0x80,  //..%@@%.@@
-    0x01, 0x80,  //......+@@
-    0x03, 0x00,  //......@@+
-    0x47, 0x00,  //.%...%@@.
-    0x7e, 0x00,  //.@@@@@@+.
-    0x3c, 0x00,  //.+@@@%...
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x3c, 0x00, 0x7f, 0x00, 0xe3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f,
+    0x80, 0x3d, 0x80, 0x01, 0x80, 0x03, 0x00, 0x47, 0x00, 0x7e, 0x00, 0x3c, 0xf8, 0x00,
 
     /*Unicode: U+003a (:) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfa, 0x00, 0x01, 0xc0, 0xc0, 0xfc, 0x00, 0x01, 0xc0, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+003b (;) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x60,  //.@@
-    0x60,  //.@@
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x60,  //.@@
-    0x60,  //.@@
-    0x40,  //+@.
-    0x80,  //@+.
-    0x00,  //...
-    0x00,  //...
-
+    0xfa, 0x00, 0x01, 0x60, 0x60, 0xfc, 0x00, 0x05, 0x60, 0x60, 0x40, 0x80, 0x00, 0x00,
 
     /*Unicode: U+003c (<) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x20,  //.........+@
-    0x01, 0xe0,  //.......%@@@
-    0x07, 0xc0,  //....+@@@@%+
-    0x3e, 0x00,  //.+%@@@@+...
-    0xf8, 0x00,  //@@@@%+.....
-    0xf8, 0x00,  //@@@@%+.....
-    0x3e, 0x00,  //.+%@@@@+...
-    0x07, 0xc0,  //....+@@@@%+
-    0x01, 0xe0,  //......+%@@@
-    0x00, 0x20,  //.........+@
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xf4, 0x00, 0x12, 0x20, 0x01, 0xe0, 0x07, 0xc0, 0x3e, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x3e, 0x00,
+    0x07, 0xc0, 0x01, 0xe0, 0x00, 0x20, 0xf9, 0x00,
 
     /*Unicode: U+003d (=) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xf3, 0x00, 0x03, 0xff, 0xe0, 0xff, 0xe0, 0xfd, 0x00, 0x03, 0xff, 0xe0, 0xff, 0xe0, 0xf3, 0x00,
 
     /*Unicode: U+003e (>) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x80, 0x00,  //@+.........
-    0xf0, 0x00,  //@@@%.......
-    0x7c, 0x00,  //+%@@@@+....
-    0x0f, 0x80,  //...+@@@@%+.
-    0x03, 0xe0,  //.....+%@@@@
-    0x03, 0xe0,  //.....+%@@@@
-    0x0f, 0x80,  //...+@@@@%+.
-    0x7c, 0x00,  //+%@@@@+....
-    0xf0, 0x00,  //@@@%+......
-    0x80, 0x00,  //@+.........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xf5, 0x00, 0x12, 0x80, 0x00, 0xf0, 0x00, 0x7c, 0x00, 0x0f, 0x80, 0x03, 0xe0, 0x03, 0xe0, 0x0f,
+    0x80, 0x7c, 0x00, 0xf0, 0x00, 0x80, 0xf8, 0x00,
 
     /*Unicode: U+003f (?) , Width: 7 */
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x78,  //.%@@@+.
-    0xfc,  //@@@@@@+
-    0x8e,  //@+..%@@
-    0x06,  //.....@@
-    0x06,  //....+@%
-    0x0c,  //....@@.
-    0x18,  //...@@..
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x00,  //.......
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-
+    0xfe, 0x00, 0x06, 0x78, 0xfc, 0x8e, 0x06, 0x06, 0x0c, 0x18, 0xfe, 0x30, 0x02, 0x00, 0x30, 0x30,
+    0xfd, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 16 */
-    0x00, 0x00,  //................
-    0x00, 0x00,  //................
-    0x00, 0x00,  //................
-    0x07, 0xe0,  //.....%@@@@%+....
-    0x1f, 0xf8,  //...%@@@@@@@@@+..
-    0x3c, 0x1c,  //..%@@%....+%@@+.
-    0x70, 0x06,  //.%@@........+@@.
-    0x60, 0x03,  //.@@..........+@%
-    0xe3, 0x63,  //%@%...@@.@@...@@
-    0xc7, 0xe3,  //@@...%@@@@@...@@
-    0xc6, 0x63,  //@@...@@..@@..+@@
-    0xc6, 0x66,  //@@...@@..@@.+@@+
-    0xc7, 0xfc,  //@@...%@@@@@@@@+.
-    0xe3, 0x70,  //%@%...@@.@@%+...
-    0x60, 0x00,  //.@@.............
-    0x70, 0x00,  //.%@@............
-    0x3c, 0x30,  //..@@@+....+@....
-    0x1f, 0xf0,  //...%@@@@@@@@....
-    0x07, 0xc0,  //....+%@@@%+.....
-    0x00, 0x00,  //................
-
+    0xfb, 0x00, 0x21, 0x07, 0xe0, 0x1f, 0xf8, 0x3c, 0x1c, 0x70, 0x06, 0x60, 0x03, 0xe3, 0x63, 0xc7,
+    0xe3, 0xc6, 0x63, 0xc6, 0x66, 0xc7, 0xfc, 0xe3, 0x70, 0x60, 0x00, 0x70, 0x00, 0x3c, 0x30, 0x1f,
+    0xf0, 0x07, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //....+@@+....
-    0x0f, 0x00,  //....@@@@....
-    0x0f, 0x00,  //....@@@@....
-    0x19, 0x80,  //...%@++@%...
-    0x19, 0x80,  //...@@..@@...
-    0x19, 0x80,  //..+@%..%@+..
-    0x30, 0xc0,  //..@@....@@..
-    0x3f, 0xc0,  //..@@@@@@@@..
-    0x7f, 0xe0,  //.%@@@@@@@@%.
-    0x60, 0x60,  //.@@......@@.
-    0x60, 0x60,  //+@%......%@+
-    0xc0, 0x30,  //@@+......+@@
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x13, 0x06, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x19, 0x80, 0x19, 0x80, 0x19,
+    0x80, 0x30, 0xc0, 0x3f, 0xc0, 0x7f, 0xe0, 0xfd, 0x60, 0x01, 0xc0, 0x30, 0xf9, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0xfc, 0x00,  //@@@@@@+..
-    0xff, 0x00,  //@@@@@@@%.
-    0xc3, 0x00,  //@@...+@@.
-    0xc3, 0x00,  //@@....@@.
-    0xc3, 0x00,  //@@...+@%.
-    0xfe, 0x00,  //@@@@@@%..
-    0xfe, 0x00,  //@@@@@@@+.
-    0xc3, 0x00,  //@@....%@+
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc3, 0x80,  //@@....%@@
-    0xff, 0x00,  //@@@@@@@@+
-    0xfe, 0x00,  //@@@@@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0xfc, 0x00, 0xff, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xfe, 0x00, 0xfe,
+    0x00, 0xc3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x00, 0xfe, 0xf8, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x0f, 0xc0,  //...+%@@@@%.
-    0x3f, 0xe0,  //..@@@@@@@@@
-    0x70, 0x20,  //.@@@+....+@
-    0x60, 0x00,  //+@@........
-    0xc0, 0x00,  //%@+........
-    0xc0, 0x00,  //@@.........
-    0xc0, 0x00,  //@@.........
-    0xc0, 0x00,  //@@.........
-    0xc0, 0x00,  //%@+........
-    0x60, 0x00,  //+@@........
-    0x70, 0x20,  //.@@@+....+@
-    0x3f, 0xe0,  //..@@@@@@@@@
-    0x0f, 0xc0,  //...+%@@@@%.
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x19, 0x0f, 0xc0, 0x3f, 0xe0, 0x70, 0x20, 0x60, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0xc0, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x70, 0x20, 0x3f, 0xe0, 0x0f, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0xfe, 0x00,  //@@@@@@%+...
-    0xff, 0x80,  //@@@@@@@@@..
-    0xc1, 0xc0,  //@@....+@@@.
-    0xc0, 0xc0,  //@@......@@+
-    0xc0, 0x60,  //@@......+@@
-    0xc0, 0x60,  //@@.......@@
-    0xc0, 0x60,  //@@.......@@
-    0xc0, 0x60,  //@@.......@@
-    0xc0, 0x60,  //@@......+@@
-    0xc0, 0xc0,  //@@......@@+
-    0xc1, 0xc0,  //@@....+@@@.
-    0xff, 0x80,  //@@@@@@@@@..
-    0xfe, 0x00,  //@@@@@@%+...
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x04, 0xfe, 0x00, 0xff, 0x80, 0xc1, 0xfd, 0xc0, 0x0f, 0x60, 0xc0, 0x60, 0xc0, 0x60,
+    0xc0, 0x60, 0xc0, 0x60, 0xc0, 0xc0, 0xc1, 0xc0, 0xff, 0x80, 0xfe, 0xf8, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0xc0, 0x01, 0xff, 0xff, 0xfd, 0xc0, 0x01, 0xff, 0xff, 0xfd,
+    0x00,
 
     /*Unicode: U+0046 (F) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xfe,  //@@@@@@@.
-    0xfe,  //@@@@@@@.
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0xc0, 0x01, 0xfe, 0xfe, 0xfb, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x0f, 0xc0,  //...+%@@@@%.
-    0x3f, 0xe0,  //..@@@@@@@@@
-    0x70, 0x20,  //.@@@+....+@
-    0x60, 0x00,  //+@@........
-    0xc0, 0x00,  //%@+........
-    0xc3, 0xe0,  //@@....@@@@@
-    0xc3, 0xe0,  //@@....@@@@@
-    0xc0, 0x60,  //@@.......@@
-    0xc0, 0x60,  //@@+......@@
-    0x60, 0x60,  //+@@......@@
-    0x70, 0x60,  //.@@@+...+@@
-    0x3f, 0xc0,  //..@@@@@@@@+
-    0x0f, 0x80,  //...+@@@@%..
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x10, 0x0f, 0xc0, 0x3f, 0xe0, 0x70, 0x20, 0x60, 0x00, 0xc0, 0x00, 0xc3, 0xe0, 0xc3,
+    0xe0, 0xc0, 0x60, 0xc0, 0xfe, 0x60, 0x05, 0x70, 0x60, 0x3f, 0xc0, 0x0f, 0x80, 0xf9, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xff, 0xc0,  //@@@@@@@@@@
-    0xff, 0xc0,  //@@@@@@@@@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xfb, 0x00, 0xf7, 0xc0, 0x02, 0xff, 0xc0, 0xff, 0xf4, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xf4, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+004a (J) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x70,  //.%@%
-    0xe0,  //@@@.
-    0xc0,  //@%..
-
+    0xfe, 0x00, 0xf3, 0x30, 0x02, 0x70, 0xe0, 0xc0,
 
     /*Unicode: U+004b (K) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0xc1, 0x80,  //@@.....@@+.
-    0xc3, 0x00,  //@@....@@+..
-    0xc6, 0x00,  //@@...@@+...
-    0xcc, 0x00,  //@@..@@+....
-    0xd8, 0x00,  //@@.@@+.....
-    0xf0, 0x00,  //@@@@+......
-    0xf0, 0x00,  //@@@@.......
-    0xd8, 0x00,  //@@+@@......
-    0xcc, 0x00,  //@@.+@@.....
-    0xc6, 0x00,  //@@..+@@....
-    0xc3, 0x00,  //@@...+@@...
-    0xc1, 0x80,  //@@....+@@..
-    0xc0, 0xc0,  //@@.....+@@+
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x19, 0xc1, 0x80, 0xc3, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xf0, 0x00, 0xf0,
+    0x00, 0xd8, 0x00, 0xcc, 0x00, 0xc6, 0x00, 0xc3, 0x00, 0xc1, 0x80, 0xc0, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+004c (L) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0xf6, 0xc0, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+004d (M) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0xe0, 0x70,  //@@@+....+@@@
-    0xf0, 0xf0,  //@@@%....%@@@
-    0xf0, 0xf0,  //@@%@....@%@@
-    0xd8, 0xb0,  //@@.@+..+@.@@
-    0xd9, 0xb0,  //@@.@@..@@.@@
-    0xd9, 0xb0,  //@@.%@..@+.@@
-    0xcf, 0x30,  //@@..@%%@..@@
-    0xcf, 0x30,  //@@..@@@@..@@
-    0xc6, 0x30,  //@@..+@@+..@@
-    0xc6, 0x30,  //@@...@@...@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x01, 0xe0, 0x70, 0xfd, 0xf0, 0x13, 0xd8, 0xb0, 0xd9, 0xb0, 0xd9, 0xb0, 0xcf, 0x30,
+    0xcf, 0x30, 0xc6, 0x30, 0xc6, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xf9, 0x00,
 
     /*Unicode: U+004e (N) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0xe0, 0xc0,  //@@%.....@@
-    0xe0, 0xc0,  //@@@.....@@
-    0xf0, 0xc0,  //@@@%....@@
-    0xf0, 0xc0,  //@@%@+...@@
-    0xd8, 0xc0,  //@@.@@...@@
-    0xd8, 0xc0,  //@@.%@+..@@
-    0xcc, 0xc0,  //@@..@@..@@
-    0xc6, 0xc0,  //@@..+@%.@@
-    0xc6, 0xc0,  //@@...@@.@@
-    0xc3, 0xc0,  //@@...+@@@@
-    0xc3, 0xc0,  //@@....%@@@
-    0xc1, 0xc0,  //@@.....@@@
-    0xc1, 0xc0,  //@@.....%@@
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xfb, 0x00, 0x19, 0xe0, 0xc0, 0xe0, 0xc0, 0xf0, 0xc0, 0xf0, 0xc0, 0xd8, 0xc0, 0xd8, 0xc0, 0xcc,
+    0xc0, 0xc6, 0xc0, 0xc6, 0xc0, 0xc3, 0xc0, 0xc3, 0xc0, 0xc1, 0xc0, 0xc1, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+004f (O) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x0f, 0x80,  //...+@@@@+...
-    0x3f, 0xc0,  //..@@@@@@@@..
-    0x70, 0xe0,  //.@@@+..+@@@.
-    0x60, 0x60,  //+@@......@@+
-    0xc0, 0x30,  //%@+......+@%
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //%@+......+@%
-    0x60, 0x60,  //+@@......@@+
-    0x70, 0xe0,  //.@@@+..+@@@.
-    0x3f, 0xc0,  //..@@@@@@@@..
-    0x1f, 0x80,  //...+@@@@+...
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x19, 0x0f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0,
+    0x30, 0xc0, 0x30, 0xc0, 0x30, 0x60, 0x60, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf9, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xfc,  //@@@@@%+.
-    0xfe,  //@@@@@@@+
-    0xc7,  //@@...%@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc7,  //@@...%@@
-    0xfe,  //@@@@@@@+
-    0xfc,  //@@@@@@+.
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfe, 0x00, 0x07, 0xfc, 0xfe, 0xc7, 0xc3, 0xc3, 0xc7, 0xfe, 0xfc, 0xfc, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x0f, 0x80,  //...+@@@@%...
-    0x3f, 0xc0,  //..@@@@@@@@..
-    0x70, 0xe0,  //.@@@+..+@@@.
-    0x60, 0x60,  //+@@......@@+
-    0xc0, 0x30,  //%@+......+@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //@@........@@
-    0xc0, 0x30,  //%@+......+@%
-    0x60, 0x60,  //+@@......@@+
-    0x70, 0xe0,  //.@@@+..+@@%.
-    0x3f, 0xc0,  //..@@@@@@@%..
-    0x1f, 0x80,  //...%@@@@%...
-    0x01, 0x80,  //......+@@+..
-    0x00, 0xc0,  //.......+@@+.
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x1d, 0x0f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60, 0xc0, 0x30, 0xc0, 0x30, 0xc0,
+    0x30, 0xc0, 0x30, 0xc0, 0x30, 0x60, 0x60, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0x01, 0x80, 0x00,
+    0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0xfc, 0x00,  //@@@@@@+...
-    0xfe, 0x00,  //@@@@@@@+..
-    0xc7, 0x00,  //@@...%@@..
-    0xc3, 0x00,  //@@....@@..
-    0xc3, 0x00,  //@@....@@..
-    0xc7, 0x00,  //@@...%@%..
-    0xfe, 0x00,  //@@@@@@@...
-    0xfc, 0x00,  //@@@@@@+...
-    0xc6, 0x00,  //@@..+@@...
-    0xc3, 0x00,  //@@...+@@..
-    0xc3, 0x00,  //@@....@@+.
-    0xc1, 0x80,  //@@....+@@.
-    0xc1, 0xc0,  //@@.....%@%
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xfb, 0x00, 0x19, 0xfc, 0x00, 0xfe, 0x00, 0xc7, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc7, 0x00, 0xfe,
+    0x00, 0xfc, 0x00, 0xc6, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc1, 0x80, 0xc1, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x3e, 0x00,  //..%@@@%..
-    0x7f, 0x00,  //+@@@@@@@.
-    0xe1, 0x00,  //@@%...+%.
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@+......
-    0x7c, 0x00,  //+@@@@%+..
-    0x3f, 0x00,  //..%@@@@@.
-    0x03, 0x80,  //.....+@@%
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x83, 0x80,  //@+....%@@
-    0xff, 0x00,  //@@@@@@@@+
-    0x7e, 0x00,  //.%@@@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0xe1, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x7c, 0x00, 0x3f,
+    0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x83, 0x80, 0xff, 0x00, 0x7e, 0xf8, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0xff, 0xf0,  //@@@@@@@@@@@@
-    0xff, 0xf0,  //@@@@@@@@@@@@
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x18, 0xff, 0xf0, 0xff, 0xf0, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@+....+@@
-    0x61, 0x80,  //+@@+..+@@+
-    0x7f, 0x80,  //.@@@@@@@@.
-    0x1e, 0x00,  //..+@@@@+..
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xfb, 0x00, 0xed, 0xc0, 0x04, 0x61, 0x80, 0x7f, 0x80, 0x1e, 0xf8, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0xc0, 0x30,  //@@+......+@@
-    0x60, 0x60,  //+@%......%@+
-    0x60, 0x60,  //.@@......@@.
-    0x60, 0x60,  //.%@+....+@%.
-    0x30, 0xc0,  //..@@....@@..
-    0x30, 0xc0,  //..@@....@@..
-    0x19, 0x80,  //..+@%..%@+..
-    0x19, 0x80,  //...@@..@@...
-    0x19, 0x80,  //...%@++@%...
-    0x0f, 0x00,  //....@@@@+...
-    0x0f, 0x00,  //....@@@@....
-    0x06, 0x00,  //....+@@+....
-    0x06, 0x00,  //.....@@.....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x01, 0xc0, 0x30, 0xfb, 0x60, 0x10, 0x30, 0xc0, 0x30, 0xc0, 0x19, 0x80, 0x19, 0x80,
+    0x19, 0x80, 0x0f, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 17 */
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0xc1, 0xc1, 0x80,  //@@.....@@@.....@@
-    0xc1, 0xc1, 0x80,  //%@+...+@@@+...+@%
-    0x63, 0xe3, 0x00,  //+@%...%@%@%...%@+
-    0x63, 0x63, 0x00,  //.@@...@@.@@...@@.
-    0x63, 0x63, 0x00,  //.@@...@@.@@...@@.
-    0x63, 0x63, 0x00,  //.%@+.+@%.%@+.+@%.
-    0x36, 0x36, 0x00,  //.+@%.%@+.+@%.%@+.
-    0x36, 0x36, 0x00,  //..@@.@@...@@.@@..
-    0x36, 0x36, 0x00,  //..@@+@@...@@+@@..
-    0x3e, 0x3e, 0x00,  //..%@@@%...%@@@%..
-    0x1c, 0x1c, 0x00,  //..+@@@+...+@@@+..
-    0x1c, 0x1c, 0x00,  //...@@@.....@@@...
-    0x1c, 0x1c, 0x00,  //...@@@.....@@%...
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-
+    0xf8, 0x00, 0x25, 0xc1, 0xc1, 0x80, 0xc1, 0xc1, 0x80, 0x63, 0xe3, 0x00, 0x63, 0x63, 0x00, 0x63,
+    0x63, 0x00, 0x63, 0x63, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x3e, 0x3e,
+    0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0x00, 0x1c, 0x1c, 0xf4, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x70, 0xe0,  //.%@%....%@%
-    0x30, 0xc0,  //..@@+..+@@.
-    0x39, 0x80,  //..%@@..@@+.
-    0x1b, 0x80,  //...@@+%@%..
-    0x0f, 0x00,  //...+@@@@...
-    0x0e, 0x00,  //....%@@+...
-    0x0e, 0x00,  //....%@@....
-    0x0f, 0x00,  //...+@@@@...
-    0x1b, 0x00,  //...@@+@@+..
-    0x39, 0x80,  //..%@%.+@@..
-    0x31, 0xc0,  //.+@@...@@%.
-    0x60, 0xc0,  //.@@+....@@.
-    0xe0, 0xe0,  //%@@.....%@%
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x19, 0x70, 0xe0, 0x30, 0xc0, 0x39, 0x80, 0x1b, 0x80, 0x0f, 0x00, 0x0e, 0x00, 0x0e,
+    0x00, 0x0f, 0x00, 0x1b, 0x00, 0x39, 0x80, 0x31, 0xc0, 0x60, 0xc0, 0xe0, 0xe0, 0xf9, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0xe0, 0x70,  //%@@......@@%
-    0x60, 0x60,  //.@@+....+@@.
-    0x30, 0xc0,  //..@@....@@..
-    0x19, 0x80,  //..+@%..%@+..
-    0x19, 0x80,  //...%@++@%...
-    0x0f, 0x00,  //....@@@@....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //.....@@.....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xfb, 0x00, 0x18, 0xe0, 0x70, 0x60, 0x60, 0x30, 0xc0, 0x19, 0x80, 0x19, 0x80, 0x0f, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0x01, 0xc0,  //.......%@@.
-    0x03, 0x80,  //......%@@..
-    0x03, 0x00,  //.....+@@+..
-    0x07, 0x00,  //.....@@%...
-    0x0e, 0x00,  //....@@%....
-    0x1c, 0x00,  //...%@@.....
-    0x18, 0x00,  //..+@@......
-    0x30, 0x00,  //.+@@+......
-    0x70, 0x00,  //.@@%.......
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x19, 0xff, 0xe0, 0xff, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x0e,
+    0x00, 0x1c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x70, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf9, 0x00,
 
     /*Unicode: U+005b ([) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xf0,  //@@@@
-    0xf0,  //@@@@
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xc0,  //@@..
-    0xf0,  //@@@@
-    0xf0,  //@@@@
-    0x00,  //....
-    0x00,  //....
-
+    0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf5, 0xc0, 0x03, 0xf0, 0xf0, 0x00, 0x00,
 
     /*Unicode: U+005c (\) , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0xc0,  //@@....
-    0xc0,  //%@+...
-    0x60,  //+@%...
-    0x60,  //.@@...
-    0x60,  //.@@+..
-    0x70,  //.%@%..
-    0x30,  //.+@@..
-    0x30,  //..@@..
-    0x30,  //..@@+.
-    0x38,  //..+@%.
-    0x18,  //...@@.
-    0x18,  //...@@.
-    0x18,  //...%@+
-    0x0c,  //...+@%
-    0x0c,  //....@@
-    0x00,  //......
-    0x00,  //......
-
+    0xfe, 0x00, 0x01, 0xc0, 0xc0, 0xfe, 0x60, 0x00, 0x70, 0xfe, 0x30, 0x00, 0x38, 0xfe, 0x18, 0x03,
+    0x0c, 0x0c, 0x00, 0x00,
 
     /*Unicode: U+005d (]) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xf0,  //@@@@
-    0xf0,  //@@@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0xf0,  //@@@@
-    0xf0,  //@@@@
-    0x00,  //....
-    0x00,  //....
-
+    0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf5, 0x30, 0x03, 0xf0, 0xf0, 0x00, 0x00,
 
     /*Unicode: U+005e (^) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x0e, 0x00,  //....@@@....
-    0x1f, 0x00,  //...%@%@%...
-    0x31, 0x80,  //..%@+.+@%..
-    0x60, 0xc0,  //.%@+...+@%.
-    0xc0, 0x60,  //%@+.....+@%
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
+    0xfb, 0x00, 0x09, 0x0e, 0x00, 0x1f, 0x00, 0x31, 0x80, 0x60, 0xc0, 0xc0, 0x60, 0xe9, 0x00,
 
     /*Unicode: U+005f (_) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0xff, 0x80,  //@@@@@@@@@
-    0xff, 0x80,  //@@@@@@@@@
-
+    0xdd, 0x00, 0x03, 0xff, 0x80, 0xff, 0x80,
 
     /*Unicode: U+0060 (`) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xc0,  //%@..
-    0x60,  //.%@.
-    0x30,  //..%%
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-
+    0x04, 0x00, 0x00, 0xc0, 0x60, 0x30, 0xf2, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x3c,  //.+%@@@+.
-    0x7e,  //.@@@@@@.
-    0x47,  //.%...%@%
-    0x03,  //......@@
-    0x3f,  //.+@@@@@@
-    0xff,  //%@@@@@@@
-    0xc3,  //@@+...@@
-    0xc7,  //@@+..%@@
-    0xff,  //%@@@@%@@
-    0x7b,  //.%@@%.@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfb, 0x00, 0x09, 0x3c, 0x7e, 0x47, 0x03, 0x3f, 0xff, 0xc3, 0xc7, 0xff, 0x7b, 0xfd, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xde, 0x00,  //@@.%@@%..
-    0xff, 0x00,  //@@%@@@@@.
-    0xe3, 0x80,  //@@@...@@%
-    0xc1, 0x80,  //@@+...+@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@+...+@@
-    0xe3, 0x80,  //@@@...@@%
-    0xff, 0x00,  //@@%@@@@@.
-    0xde, 0x00,  //@@.%@@%..
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfd, 0x00, 0x1a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xde, 0x00, 0xff, 0x00, 0xe3,
+    0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0xf8, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x1e,  //..+@@@%+
-    0x7f,  //.%@@@@@@
-    0x61,  //+@@+...%
-    0xc0,  //@@+.....
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@+.....
-    0x61,  //+@@+...%
-    0x7f,  //.%@@@@@@
-    0x1e,  //..+@@@%+
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfb, 0x00, 0x02, 0x1e, 0x7f, 0x61, 0xfd, 0xc0, 0x02, 0x61, 0x7f, 0x1e, 0xfd, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x3d, 0x80,  //..%@@%.@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0xe3, 0x80,  //%@@...@@@
-    0xc1, 0x80,  //@@+...+@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@+...+@@
-    0xe3, 0x80,  //%@@...@@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0x3d, 0x80,  //..%@@%.@@
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfd, 0x00, 0x1b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x3d, 0x80, 0x7f, 0x80, 0xe3,
+    0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0xf9,
+    0x00,
 
     /*Unicode: U+0065 (e) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x1f, 0x00,  //..+%@@@%..
-    0x7f, 0x80,  //.%@@@@@@@.
-    0x61, 0xc0,  //+@@+...@@%
-    0xc0, 0xc0,  //@@......@@
-    0xff, 0xc0,  //@@@@@@@@@@
-    0xff, 0xc0,  //@@@@@@@@@@
-    0xc0, 0x00,  //@@........
-    0x60, 0x40,  //+@@+....+@
-    0x7f, 0xc0,  //.%@@@@@@@@
-    0x1f, 0x80,  //..+%@@@@%.
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xf5, 0x00, 0x04, 0x1f, 0x00, 0x7f, 0x80, 0x61, 0xfe, 0xc0, 0x0b, 0xff, 0xc0, 0xff, 0xc0, 0xc0,
+    0x00, 0x60, 0x40, 0x7f, 0xc0, 0x1f, 0x80, 0xf9, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 7 */
-    0x00,  //.......
-    0x00,  //.......
-    0x1e,  //...%@@@
-    0x3e,  //..%@@@@
-    0x30,  //..@@+..
-    0x30,  //..@@...
-    0xfe,  //@@@@@@@
-    0xfe,  //@@@@@@@
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x30,  //..@@...
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-
+    0x07, 0x00, 0x00, 0x1e, 0x3e, 0x30, 0x30, 0xfe, 0xfe, 0xf9, 0x30, 0xfd, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x3d, 0x80,  //..%@@%.@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0xe3, 0x80,  //%@@...@@@
-    0xc1, 0x80,  //@@+...+@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@+...+@@
-    0xe3, 0x80,  //%@@...@@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0x3d, 0x80,  //..%@@%.@@
-    0x01, 0x80,  //......+@%
-    0x43, 0x00,  //.%...+@@+
-    0x7f, 0x00,  //.@@@@@@@.
-    0x3e, 0x00,  //.+%@@@%..
-
+    0xf5, 0x00, 0x1b, 0x3d, 0x80, 0x7f, 0x80, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+    0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x01, 0x80, 0x43, 0x00, 0x7f, 0x00, 0x3e, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xc0,  //@@......
-    0xde,  //@@.%@@%.
-    0xfe,  //@@%@@@@+
-    0xe7,  //@@@..%@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0x01, 0x00, 0x00, 0xfd, 0xc0, 0x02, 0xde, 0xfe, 0xe7, 0xfa, 0xc3, 0xfd, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x05, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xf7, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x30,  //..@@
-    0x30,  //..@@
-    0x00,  //....
-    0x00,  //....
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //..@@
-    0x30,  //.+@@
-    0xe0,  //@@@+
-    0xc0,  //@@+.
-
+    0x05, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0xf5, 0x30, 0x01, 0xe0, 0xc0,
 
     /*Unicode: U+006b (k) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc3, 0x00,  //@@....@@+
-    0xc6, 0x00,  //@@..+@@+.
-    0xcc, 0x00,  //@@.+@@+..
-    0xd8, 0x00,  //@@+@@+...
-    0xf0, 0x00,  //@@@@.....
-    0xf0, 0x00,  //@@@@+....
-    0xd8, 0x00,  //@@+@@+...
-    0xcc, 0x00,  //@@.+@@+..
-    0xc6, 0x00,  //@@..+@@+.
-    0xc3, 0x00,  //@@...+@@+
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-
+    0xfd, 0x00, 0x1a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc3, 0x00, 0xc6, 0x00, 0xcc,
+    0x00, 0xd8, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xd8, 0x00, 0xcc, 0x00, 0xc6, 0x00, 0xc3, 0xf8, 0x00,
 
     /*Unicode: U+006c (l) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x01, 0x00, 0x00, 0xf3, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+006d (m) , Width: 14 */
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0xdc, 0x78,  //@@.%@@+..%@@%.
-    0xfe, 0xf8,  //@@%@@@@+@@@@@+
-    0xe7, 0x9c,  //@@@..%@@@..%@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0xc3, 0x0c,  //@@....@@....@@
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-    0x00, 0x00,  //..............
-
+    0xf5, 0x00, 0x13, 0xdc, 0x78, 0xfe, 0xf8, 0xe7, 0x9c, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3,
+    0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xc3, 0x0c, 0xf9, 0x00,
 
     /*Unicode: U+006e (n) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xde,  //@@.%@@%.
-    0xfe,  //@@%@@@@+
-    0xe7,  //@@@..%@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfb, 0x00, 0x02, 0xde, 0xfe, 0xe7, 0xfa, 0xc3, 0xfd, 0x00,
 
     /*Unicode: U+006f (o) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x1e, 0x00,  //..+@@@@+..
-    0x7f, 0x80,  //.%@@@@@@%.
-    0x61, 0x80,  //+@@+..+@@+
-    0xc0, 0xc0,  //@@+....+@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@......@@
-    0xc0, 0xc0,  //@@+....+@@
-    0x61, 0x80,  //+@@+..+@@+
-    0x7f, 0x80,  //.%@@@@@@%.
-    0x1e, 0x00,  //..+@@@@+..
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xf5, 0x00, 0x05, 0x1e, 0x00, 0x7f, 0x80, 0x61, 0x80, 0xf9, 0xc0, 0x04, 0x61, 0x80, 0x7f, 0x80,
+    0x1e, 0xf8, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0xde, 0x00,  //@@.%@@%..
-    0xff, 0x00,  //@@%@@@@@.
-    0xe3, 0x80,  //@@@...@@%
-    0xc1, 0x80,  //@@+...+@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@+...+@@
-    0xe3, 0x80,  //@@@...@@%
-    0xff, 0x00,  //@@%@@@@@.
-    0xde, 0x00,  //@@.%@@%..
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-    0xc0, 0x00,  //@@.......
-
+    0xf5, 0x00, 0x1b, 0xde, 0x00, 0xff, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+    0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 9 */
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x00, 0x00,  //.........
-    0x3d, 0x80,  //..%@@%.@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0xe3, 0x80,  //%@@...@@@
-    0xc1, 0x80,  //@@+...+@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@.....@@
-    0xc1, 0x80,  //@@+...+@@
-    0xe3, 0x80,  //%@@...@@@
-    0x7f, 0x80,  //.@@@@@%@@
-    0x3d, 0x80,  //..%@@%.@@
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-    0x01, 0x80,  //.......@@
-
+    0xf5, 0x00, 0x1b, 0x3d, 0x80, 0x7f, 0x80, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+    0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
 
     /*Unicode: U+0072 (r) , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0xdc,  //@@.%@@
-    0xfc,  //@@%@@@
-    0xe0,  //@@@+..
-    0xc0,  //@@+...
-    0xc0,  //@@....
-    0xc0,  //@@....
-    0xc0,  //@@....
-    0xc0,  //@@....
-    0xc0,  //@@....
-    0xc0,  //@@....
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-
+    0xfb, 0x00, 0x02, 0xdc, 0xfc, 0xe0, 0xfa, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 7 */
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x7c,  //.+@@@%+
-    0xfe,  //%@@@@@@
-    0xc2,  //@@+...%
-    0xe0,  //@@%+...
-    0x7c,  //+@@@@@.
-    0x1e,  //..+%@@%
-    0x06,  //.....@@
-    0x86,  //%+..+@@
-    0xfe,  //@@@@@@%
-    0x78,  //.%@@@+.
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-    0x00,  //.......
-
+    0xfb, 0x00, 0x09, 0x7c, 0xfe, 0xc2, 0xe0, 0x7c, 0x1e, 0x06, 0x86, 0xfe, 0x78, 0xfd, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 6 */
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0xfc,  //@@@@@@
-    0xfc,  //@@@@@@
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0x60,  //.@@...
-    0x60,  //.@@+..
-    0x7c,  //.%@@@@
-    0x3c,  //..%@@@
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-    0x00,  //......
-
+    0xfe, 0x00, 0xfe, 0x60, 0x01, 0xfc, 0xfc, 0xfb, 0x60, 0x01, 0x7c, 0x3c, 0xfd, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xc3,  //@@....@@
-    0xe7,  //@@%..@@@
-    0x7f,  //+@@@@%@@
-    0x7b,  //.%@@%.@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfb, 0x00, 0xfa, 0xc3, 0x02, 0xe7, 0x7f, 0x7b, 0xfd, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x60, 0x60,  //.@@......@@.
-    0x60, 0x60,  //.%@+....+@%.
-    0x30, 0xc0,  //..@@....@@..
-    0x30, 0xc0,  //..@@....@@..
-    0x19, 0x80,  //..+@%..%@+..
-    0x19, 0x80,  //...@@..@@...
-    0x19, 0x80,  //...%@.+@%...
-    0x0f, 0x00,  //...+@%@@....
-    0x0f, 0x00,  //....@@@@....
-    0x06, 0x00,  //....+@@+....
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-
+    0xf5, 0x00, 0xfd, 0x60, 0x0e, 0x30, 0xc0, 0x30, 0xc0, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x0f,
+    0x00, 0x0f, 0x00, 0x06, 0xf8, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 15 */
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x63, 0x8c,  //.@@...@@@...@@.
-    0x63, 0x8c,  //.@@...@@@...@@.
-    0x63, 0x8c,  //.%@+.+@@@+.+@%.
-    0x36, 0xd8,  //.+@%.%@+@%.%@+.
-    0x36, 0xd8,  //..@@.@@.@@.@@..
-    0x36, 0xd8,  //..@@.@%.%@.@@..
-    0x3c, 0x78,  //..%@%@+.+@%@%..
-    0x1c, 0x70,  //..+@@@...@@@+..
-    0x1c, 0x70,  //...@@@...@@@...
-    0x1c, 0x70,  //...@@%...%@@...
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-
+    0xf5, 0x00, 0x13, 0x63, 0x8c, 0x63, 0x8c, 0x63, 0x8c, 0x36, 0xd8, 0x36, 0xd8, 0x36, 0xd8, 0x3c,
+    0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0xf9, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 10 */
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0xe1, 0xc0,  //%@@....@@%
-    0x61, 0x80,  //.@@+..+@@.
-    0x33, 0x00,  //.+@@..@@..
-    0x33, 0x00,  //..%@++@%..
-    0x1e, 0x00,  //...@@@@...
-    0x1e, 0x00,  //...@@@@...
-    0x33, 0x00,  //..%@++@%..
-    0x33, 0x00,  //.+@@..@@+.
-    0x61, 0x80,  //.@@+..+@@.
-    0xe1, 0xc0,  //%@@....@@%
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-    0x00, 0x00,  //..........
-
+    0xf5, 0x00, 0x13, 0xe1, 0xc0, 0x61, 0x80, 0x33, 0x00, 0x33, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x33,
+    0x00, 0x33, 0x00, 0x61, 0x80, 0xe1, 0xc0, 0xf9, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 12 */
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x00, 0x00,  //............
-    0x60, 0x60,  //.@@......@@.
-    0x60, 0x60,  //.%@+....+@%.
-    0x30, 0xc0,  //..@@....@@..
-    0x30, 0xc0,  //..%@+..+@@..
-    0x19, 0x80,  //...@@..@@+..
-    0x19, 0x80,  //...@@+.@@...
-    0x0f, 0x00,  //...+@%%@+...
-    0x0f, 0x00,  //....@@@@....
-    0x06, 0x00,  //....+@@+....
-    0x06, 0x00,  //.....@@.....
-    0x06, 0x00,  //....+@%.....
-    0x0c, 0x00,  //....%@......
-    0x3c, 0x00,  //..@@@%......
-    0x38, 0x00,  //..@@%.......
-
+    0xf5, 0x00, 0xfd, 0x60, 0x17, 0x30, 0xc0, 0x30, 0xc0, 0x19, 0x80, 0x19, 0x80, 0x0f, 0x00, 0x0f,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x38, 0x00,
 
     /*Unicode: U+007a (z) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x06,  //....+@@.
-    0x0c,  //....@@+.
-    0x1c,  //...@@@..
-    0x38,  //..%@@...
-    0x30,  //.+@@+...
-    0x70,  //.@@%....
-    0xff,  //@@@@@@@@
-    0xff,  //@@@@@@@@
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-    0x00,  //........
-
+    0xfb, 0x00, 0x09, 0xff, 0xff, 0x06, 0x0c, 0x1c, 0x38, 0x30, 0x70, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+007b ({) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0x0f,  //....%@@@
-    0x1f,  //...%@@@@
-    0x18,  //...@@+..
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x38,  //..%@@...
-    0xf0,  //@@@@....
-    0xf0,  //@@@@....
-    0x38,  //..%@%...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@+..
-    0x1f,  //...%@@@@
-    0x0f,  //....%@@@
-    0x00,  //........
-
+    0x03, 0x00, 0x00, 0x0f, 0x1f, 0xfd, 0x18, 0x03, 0x38, 0xf0, 0xf0, 0x38, 0xfc, 0x18, 0x02, 0x1f,
+    0x0f, 0x00,
 
     /*Unicode: U+007c (|) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-    0xc0,  //@@
-
+    0x01, 0x00, 0x00, 0xef, 0xc0,
 
     /*Unicode: U+007d (}) , Width: 8 */
-    0x00,  //........
-    0x00,  //........
-    0xf0,  //@@@%....
-    0xf8,  //@@@@%...
-    0x18,  //..+@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x1c,  //...@@%..
-    0x0f,  //....@@@@
-    0x0f,  //....@@@@
-    0x1c,  //...%@%..
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //...@@...
-    0x18,  //..+@@...
-    0xf8,  //@@@@%...
-    0xf0,  //@@@%....
-    0x00,  //........
-
+    0x03, 0x00, 0x00, 0xf0, 0xf8, 0xfd, 0x18, 0x03, 0x1c, 0x0f, 0x0f, 0x1c, 0xfc, 0x18, 0x02, 0xf8,
+    0xf0, 0x00,
 
     /*Unicode: U+007e (~) , Width: 11 */
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x7c, 0x20,  //.%@@@%...+@
-    0xff, 0xe0,  //@@@@@@@@@@@
-    0x87, 0xc0,  //@+...%@@@%.
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-    0x00, 0x00,  //...........
-
-
+    0xf1, 0x00, 0x05, 0x7c, 0x20, 0xff, 0xe0, 0x87, 0xc0, 0xef, 0x00,
 
 #elif USE_LV_FONT_DEJAVU_20 == 2
     /*Unicode: U+0020 ( ) , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xd9, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xf8, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+0022 (") , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0xf0, 0xf0,  //@@..@@
-    0xf0, 0xf0,  //@@..@@
-    0xf0, 0xf0,  //@@..@@
-    0xf0, 0xf0,  //@@..@@
-    0xf0, 0xf0,  //@@..@@
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xfb, 0x00, 0xf7, 0xf0, 0xe9, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x30, 0x70,  //.....@..+@..
-    0x00, 0x70, 0x70,  //....+@..+@..
-    0x00, 0xb0, 0xa0,  //....%@..%%..
-    0x00, 0xe0, 0xd0,  //....@%..@+..
-    0x3f, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x3f, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x01, 0xc2, 0xc0,  //...+@..%@...
-    0x03, 0x83, 0x40,  //...@%..@+...
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-    0x07, 0x0b, 0x00,  //..+@..%@....
-    0x0a, 0x0a, 0x00,  //..%%..%%....
-    0x0e, 0x0d, 0x00,  //..@%..@+....
-    0x0d, 0x0c, 0x00,  //..@+..@.....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xfa, 0x00, 0x27, 0x30, 0x70, 0x00, 0x70, 0x70, 0x00, 0xb0, 0xa0, 0x00, 0xe0, 0xd0, 0x3f, 0xff,
+    0xff, 0x3f, 0xff, 0xff, 0x01, 0xc2, 0xc0, 0x03, 0x83, 0x40, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc,
+    0x07, 0x0b, 0x00, 0x0a, 0x0a, 0x00, 0x0e, 0x0d, 0x00, 0x0d, 0x0c, 0xf4, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0xc0, 0x00,  //....@....
-    0x00, 0xc0, 0x00,  //....@....
-    0x1b, 0xf8, 0x00,  //.+%@@@%..
-    0x7f, 0xff, 0x00,  //+@@@@@@@.
-    0xf8, 0xc7, 0x00,  //@@%.@.+@.
-    0xf0, 0xc0, 0x00,  //@@..@....
-    0xbe, 0xc0, 0x00,  //%@@%@....
-    0x3f, 0xfd, 0x00,  //.@@@@@@+.
-    0x01, 0xff, 0x40,  //...+@@@@+
-    0x00, 0xc7, 0xc0,  //....@.+@@
-    0x00, 0xc3, 0xc0,  //....@..@@
-    0xd0, 0xcb, 0xc0,  //@+..@.%@@
-    0xff, 0xff, 0x40,  //@@@@@@@@+
-    0x2f, 0xf9, 0x00,  //.%@@@@%+.
-    0x00, 0xc0, 0x00,  //....@....
-    0x00, 0xc0, 0x00,  //....@....
-    0x00, 0xc0, 0x00,  //....@....
-    0x00, 0x00, 0x00,  //.........
-
+    0xfa, 0x00, 0x30, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x1b, 0xf8, 0x00, 0x7f, 0xff, 0x00, 0xf8, 0xc7,
+    0x00, 0xf0, 0xc0, 0x00, 0xbe, 0xc0, 0x00, 0x3f, 0xfd, 0x00, 0x01, 0xff, 0x40, 0x00, 0xc7, 0xc0,
+    0x00, 0xc3, 0xc0, 0xd0, 0xcb, 0xc0, 0xff, 0xff, 0x40, 0x2f, 0xf9, 0x00, 0x00, 0xc0, 0x00, 0x00,
+    0xc0, 0x00, 0x00, 0xc0, 0xfd, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x2f, 0x80, 0x07, 0x00,  //.%@@%.....+@...
-    0x75, 0xd0, 0x0c, 0x00,  //+@++@+....@....
-    0xf0, 0xf0, 0x28, 0x00,  //@@..@@...%%....
-    0xf0, 0xf0, 0x30, 0x00,  //@@..@@...@.....
-    0xf0, 0xf0, 0xd0, 0x00,  //@@..@@..@+.....
-    0xb5, 0xd1, 0x80, 0x00,  //+@++@+.+%......
-    0x2f, 0x83, 0x0b, 0xe0,  //.%@@%..@..%@@%.
-    0x00, 0x09, 0x1d, 0x74,  //......%+.+@++@+
-    0x00, 0x1c, 0x3c, 0x3c,  //.....+@..@@..@@
-    0x00, 0x30, 0x3c, 0x3c,  //.....@...@@..@@
-    0x00, 0xa0, 0x3c, 0x3c,  //....%%...@@..@@
-    0x00, 0xc0, 0x1d, 0x74,  //....@....+@++@+
-    0x03, 0x40, 0x0b, 0xe0,  //...@+.....%@@%.
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xf5, 0x00, 0x33, 0x2f, 0x80, 0x07, 0x00, 0x75, 0xd0, 0x0c, 0x00, 0xf0, 0xf0, 0x28, 0x00, 0xf0,
+    0xf0, 0x30, 0x00, 0xf0, 0xf0, 0xd0, 0x00, 0xb5, 0xd1, 0x80, 0x00, 0x2f, 0x83, 0x0b, 0xe0, 0x00,
+    0x09, 0x1d, 0x74, 0x00, 0x1c, 0x3c, 0x3c, 0x00, 0x30, 0x3c, 0x3c, 0x00, 0xa0, 0x3c, 0x3c, 0x00,
+    0xc0, 0x1d, 0x74, 0x03, 0x40, 0x0b, 0xe0, 0xf1, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x01, 0xfe, 0x40,  //...+@@@%+...
-    0x07, 0xff, 0xc0,  //..+@@@@@@...
-    0x0f, 0x41, 0xc0,  //..@@+..+%...
-    0x0f, 0x00, 0x00,  //..@@........
-    0x0b, 0x80, 0x00,  //..%@%.......
-    0x0b, 0xe0, 0x00,  //..%@@%......
-    0x2e, 0xf8, 0x3c,  //.%@%@@%..@@.
-    0xb4, 0x7e, 0x78,  //%@+.+@@%+@%.
-    0xf0, 0x1f, 0xf0,  //@@...+@@@@..
-    0xf4, 0x07, 0xd0,  //@@+...+@@+..
-    0xbd, 0x07, 0xe0,  //%@@+..+@@%..
-    0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-    0x0b, 0xf8, 0x7e,  //..%@@@%.+@@%
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x26, 0x01, 0xfe, 0x40, 0x07, 0xff, 0xc0, 0x0f, 0x41, 0xc0, 0x0f, 0x00, 0x00, 0x0b,
+    0x80, 0x00, 0x0b, 0xe0, 0x00, 0x2e, 0xf8, 0x3c, 0xb4, 0x7e, 0x78, 0xf0, 0x1f, 0xf0, 0xf4, 0x07,
+    0xd0, 0xbd, 0x07, 0xe0, 0x3f, 0xff, 0xf8, 0x0b, 0xf8, 0x7e, 0xf5, 0x00,
 
     /*Unicode: U+0027 (') , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xfc, 0xf0, 0xf5, 0x00,
 
     /*Unicode: U+0028 (() , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x0b,  //..%@
-    0x0d,  //..@+
-    0x2c,  //.%@.
-    0x38,  //.@%.
-    0x74,  //+@+.
-    0xb0,  //%@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xb0,  //%@..
-    0x74,  //+@+.
-    0x38,  //.@%.
-    0x2c,  //.%@.
-    0x0d,  //..@+
-    0x0b,  //..%@
-    0x00,  //....
-    0x00,  //....
-
+    0x07, 0x00, 0x00, 0x0b, 0x0d, 0x2c, 0x38, 0x74, 0xb0, 0xfd, 0xf0, 0x07, 0xb0, 0x74, 0x38, 0x2c,
+    0x0d, 0x0b, 0x00, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xe0,  //@%..
-    0x70,  //+@..
-    0x38,  //.@%.
-    0x2c,  //.%@.
-    0x1d,  //.+@+
-    0x0e,  //..@%
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0e,  //..@%
-    0x1d,  //.+@+
-    0x2c,  //.%@.
-    0x38,  //.@%.
-    0x70,  //+@..
-    0xe0,  //@%..
-    0x00,  //....
-    0x00,  //....
-
+    0x07, 0x00, 0x00, 0xe0, 0x70, 0x38, 0x2c, 0x1d, 0x0e, 0xfd, 0x0f, 0x07, 0x0e, 0x1d, 0x2c, 0x38,
+    0x70, 0xe0, 0x00, 0x00,
 
     /*Unicode: U+002a (*) , Width: 7 */
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x03, 0x00,  //...@...
-    0x83, 0x08,  //%..@..%
-    0x77, 0x74,  //+@+@+@+
-    0x0f, 0xc0,  //..@@@..
-    0x0f, 0xc0,  //..@@@..
-    0x77, 0x74,  //+@+@+@+
-    0x83, 0x08,  //%..@..%
-    0x03, 0x00,  //...@...
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-
+    0xfb, 0x00, 0x0e, 0x03, 0x00, 0x83, 0x08, 0x77, 0x74, 0x0f, 0xc0, 0x0f, 0xc0, 0x77, 0x74, 0x83,
+    0x08, 0x03, 0xee, 0x00,
 
     /*Unicode: U+002b (+) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf4, 0x00, 0x0d, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c,
+    0x00, 0xfb, 0xff, 0x0d, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00,
+    0x00, 0x3c, 0xf4, 0x00,
 
     /*Unicode: U+002c (,) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x3c,  //.@@
-    0x3c,  //.@@
-    0x70,  //+@.
-    0xd0,  //@+.
-    0x00,  //...
-    0x00,  //...
-
+    0xf3, 0x00, 0x05, 0x3c, 0x3c, 0x70, 0xd0, 0x00, 0x00,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
+    0xed, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0xf1, 0x00,
 
     /*Unicode: U+002e (.) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xf3, 0x00, 0x01, 0xf0, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+002f (/) , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0xf0,  //....@@
-    0x01, 0xe0,  //...+@%
-    0x02, 0xd0,  //...%@+
-    0x03, 0xc0,  //...@@.
-    0x03, 0xc0,  //...@@.
-    0x0b, 0x80,  //..+@%.
-    0x0f, 0x40,  //..@@+.
-    0x0f, 0x00,  //..@@..
-    0x1f, 0x00,  //.+@@..
-    0x2e, 0x00,  //.%@%..
-    0x3d, 0x00,  //.@@+..
-    0x3c, 0x00,  //.@@...
-    0x78, 0x00,  //+@%...
-    0xb4, 0x00,  //%@+...
-    0xf0, 0x00,  //@@....
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xfa, 0x00, 0x1b, 0xf0, 0x01, 0xe0, 0x02, 0xd0, 0x03, 0xc0, 0x03, 0xc0, 0x0b, 0x80, 0x0f, 0x40,
+    0x0f, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xb4, 0x00, 0xf0, 0xfc,
+    0x00,
 
     /*Unicode: U+0030 (0) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x07, 0xf4, 0x00,  //..+@@@+..
-    0x2f, 0xfe, 0x00,  //.%@@@@@%.
-    0x7d, 0x1f, 0x40,  //+@@+.+@@+
-    0xb4, 0x07, 0x80,  //%@+...+@%
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xb4, 0x07, 0x80,  //%@+...+@%
-    0x7d, 0x1f, 0x40,  //+@@+.+@@+
-    0x2f, 0xfe, 0x00,  //.%@@@@@%.
-    0x0b, 0xf8, 0x00,  //..+@@@+..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x07, 0xf4, 0x00, 0x2f, 0xfe, 0x00, 0x7d, 0x1f, 0x40, 0xb4, 0x07, 0x80, 0xf0,
+    0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07,
+    0x80, 0x7d, 0x1f, 0x40, 0x2f, 0xfe, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x1f, 0xc0,  //.+@@@...
-    0xff, 0xc0,  //@@@@@...
-    0xd3, 0xc0,  //@+.@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0x15, 0x1f, 0xc0, 0xff, 0xc0, 0xd3, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x2f, 0xe0, 0x00,  //.%@@@%...
-    0xff, 0xfd, 0x00,  //@@@@@@@+.
-    0xd0, 0x3f, 0x00,  //@+...@@@.
-    0x00, 0x0f, 0x00,  //......@@.
-    0x00, 0x0f, 0x00,  //......@@.
-    0x00, 0x2d, 0x00,  //.....%@+.
-    0x00, 0x7c, 0x00,  //....+@@..
-    0x01, 0xf0, 0x00,  //...+@@...
-    0x07, 0xd0, 0x00,  //..+@@+...
-    0x1f, 0x40, 0x00,  //.+@@+....
-    0x7d, 0x00, 0x00,  //+@@+.....
-    0xff, 0xff, 0x00,  //@@@@@@@@.
-    0xff, 0xff, 0x00,  //@@@@@@@@.
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x2f, 0xe0, 0x00, 0xff, 0xfd, 0x00, 0xd0, 0x3f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xf0, 0x00, 0x07, 0xd0, 0x00, 0x1f, 0x40,
+    0x00, 0x7d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf4, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x2f, 0xf8, 0x00,  //.%@@@@%..
-    0xff, 0xff, 0x40,  //@@@@@@@@+
-    0xd0, 0x0b, 0xc0,  //@+....%@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x0b, 0x80,  //......%@%
-    0x0f, 0xfd, 0x00,  //..@@@@@+.
-    0x0f, 0xfe, 0x00,  //..@@@@@%.
-    0x00, 0x1f, 0x80,  //.....+@@%
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x90, 0x1f, 0x80,  //%+...+@@%
-    0xff, 0xff, 0x00,  //@@@@@@@@.
-    0x2f, 0xf8, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x2f, 0xf8, 0x00, 0xff, 0xff, 0x40, 0xd0, 0x0b, 0xc0, 0x00, 0x03, 0xc0, 0x00,
+    0x0b, 0x80, 0x0f, 0xfd, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x03, 0xc0, 0x00, 0x03,
+    0xc0, 0x90, 0x1f, 0x80, 0xff, 0xff, 0x00, 0x2f, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x2f, 0x00,  //.....%@@..
-    0x00, 0x7f, 0x00,  //....+@@@..
-    0x00, 0xdf, 0x00,  //....@+@@..
-    0x02, 0xcf, 0x00,  //...%@.@@..
-    0x07, 0x0f, 0x00,  //..+@..@@..
-    0x0d, 0x0f, 0x00,  //..@+..@@..
-    0x3c, 0x0f, 0x00,  //.@@...@@..
-    0x70, 0x0f, 0x00,  //+@....@@..
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0x00, 0x0f, 0x00,  //......@@..
-    0x00, 0x0f, 0x00,  //......@@..
-    0x00, 0x0f, 0x00,  //......@@..
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xf7, 0x00, 0x24, 0x2f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xdf, 0x00, 0x02, 0xcf, 0x00, 0x07, 0x0f,
+    0x00, 0x0d, 0x0f, 0x00, 0x3c, 0x0f, 0x00, 0x70, 0x0f, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+    0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0xf4, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x3f, 0xfc,  //.@@@@@@.
-    0x3f, 0xfc,  //.@@@@@@.
-    0x3c, 0x00,  //.@@.....
-    0x3c, 0x00,  //.@@.....
-    0x3f, 0xf0,  //.@@@@@..
-    0x3f, 0xfc,  //.@@@@@@.
-    0x20, 0x3e,  //.%...@@%
-    0x00, 0x0f,  //......@@
-    0x00, 0x0f,  //......@@
-    0x00, 0x0f,  //......@@
-    0x90, 0x7e,  //%...+@@%
-    0xff, 0xfc,  //@@@@@@@.
-    0x6f, 0xe0,  //.%@@@%..
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0x19, 0x3f, 0xfc, 0x3f, 0xfc, 0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xfc, 0x20,
+    0x3e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x90, 0x7e, 0xff, 0xfc, 0x6f, 0xe0, 0xf9, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x02, 0xfd, 0x00,  //...%@@@+.
-    0x1f, 0xff, 0x00,  //.+@@@@@@.
-    0x3e, 0x02, 0x00,  //.@@%...%.
-    0xbc, 0x00, 0x00,  //+@@......
-    0xf4, 0x00, 0x00,  //@@+......
-    0xf2, 0xf8, 0x00,  //@@.%@@%..
-    0xfb, 0xff, 0x00,  //@@%@@@@@.
-    0xf8, 0x0b, 0x80,  //@@%...%@%
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xb0, 0x03, 0xc0,  //%@.....@@
-    0x78, 0x0b, 0x80,  //+@%...%@%
-    0x2f, 0xff, 0x00,  //.%@@@@@@.
-    0x07, 0xf8, 0x00,  //..+@@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x02, 0xfd, 0x00, 0x1f, 0xff, 0x00, 0x3e, 0x02, 0x00, 0xbc, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0xf2, 0xf8, 0x00, 0xfb, 0xff, 0x00, 0xf8, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xb0, 0x03,
+    0xc0, 0x78, 0x0b, 0x80, 0x2f, 0xff, 0x00, 0x07, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x2d,  //.....%@+
-    0x00, 0x3c,  //.....@@.
-    0x00, 0x7c,  //....+@@.
-    0x00, 0xb4,  //....%@+.
-    0x00, 0xf0,  //....@@..
-    0x00, 0xf0,  //....@@..
-    0x02, 0xe0,  //...%@%..
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x0b, 0x80,  //..%@%...
-    0x0f, 0x40,  //..@@+...
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0xfd, 0xff, 0x15, 0x00, 0x2d, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0xb4, 0x00, 0xf0, 0x00,
+    0xf0, 0x02, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x0b, 0x80, 0x0f, 0x40, 0xf9, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x1b, 0xf9, 0x00,  //.+%@@@%+.
-    0x7f, 0xff, 0x40,  //+@@@@@@@+
-    0xf8, 0x0b, 0xc0,  //@@%...%@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xb8, 0x0b, 0x80,  //%@%...%@%
-    0x1f, 0xfd, 0x00,  //.+@@@@@+.
-    0x2f, 0xfe, 0x00,  //.%@@@@@%.
-    0xb8, 0x0b, 0x80,  //%@%...%@%
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf8, 0x0b, 0xc0,  //@@%...%@@
-    0x7f, 0xff, 0x40,  //+@@@@@@@+
-    0x0b, 0xf8, 0x00,  //..%@@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x1b, 0xf9, 0x00, 0x7f, 0xff, 0x40, 0xf8, 0x0b, 0xc0, 0xf0, 0x03, 0xc0, 0xb8,
+    0x0b, 0x80, 0x1f, 0xfd, 0x00, 0x2f, 0xfe, 0x00, 0xb8, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+    0xc0, 0xf8, 0x0b, 0xc0, 0x7f, 0xff, 0x40, 0x0b, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x0b, 0xf4, 0x00,  //..%@@@+..
-    0x3f, 0xfe, 0x00,  //.@@@@@@%.
-    0xb8, 0x0b, 0x00,  //%@%...%@.
-    0xf0, 0x03, 0x80,  //@@.....@%
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf8, 0x0b, 0xc0,  //%@%...%@@
-    0x7f, 0xfb, 0xc0,  //.@@@@@%@@
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x00, 0x07, 0xc0,  //......+@@
-    0x00, 0x0f, 0x40,  //......@@+
-    0x20, 0x2f, 0x00,  //.%...%@@.
-    0x3f, 0xfd, 0x00,  //.@@@@@@+.
-    0x1f, 0xe0, 0x00,  //.+@@@%...
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x0b, 0xf4, 0x00, 0x3f, 0xfe, 0x00, 0xb8, 0x0b, 0x00, 0xf0, 0x03, 0x80, 0xf0,
+    0x03, 0xc0, 0xf8, 0x0b, 0xc0, 0x7f, 0xfb, 0xc0, 0x0b, 0xe3, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x0f,
+    0x40, 0x20, 0x2f, 0x00, 0x3f, 0xfd, 0x00, 0x1f, 0xe0, 0xf4, 0x00,
 
     /*Unicode: U+003a (:) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfa, 0x00, 0x01, 0xf0, 0xf0, 0xfc, 0x00, 0x01, 0xf0, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+003b (;) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x3c,  //.@@
-    0x3c,  //.@@
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x3c,  //.@@
-    0x3c,  //.@@
-    0x70,  //+@.
-    0xd0,  //@+.
-    0x00,  //...
-    0x00,  //...
-
+    0xfa, 0x00, 0x01, 0x3c, 0x3c, 0xfc, 0x00, 0x05, 0x3c, 0x3c, 0x70, 0xd0, 0x00, 0x00,
 
     /*Unicode: U+003c (<) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x1c,  //.........+@
-    0x00, 0x06, 0xfc,  //.......%@@@
-    0x00, 0x7f, 0xe4,  //....+@@@@%+
-    0x1b, 0xfd, 0x00,  //.+%@@@@+...
-    0xff, 0x90, 0x00,  //@@@@%+.....
-    0xff, 0x90, 0x00,  //@@@@%+.....
-    0x1b, 0xfd, 0x00,  //.+%@@@@+...
-    0x00, 0x7f, 0xe4,  //....+@@@@%+
-    0x00, 0x06, 0xfc,  //......+%@@@
-    0x00, 0x00, 0x1c,  //.........+@
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xed, 0x00, 0x1b, 0x1c, 0x00, 0x06, 0xfc, 0x00, 0x7f, 0xe4, 0x1b, 0xfd, 0x00, 0xff, 0x90, 0x00,
+    0xff, 0x90, 0x00, 0x1b, 0xfd, 0x00, 0x00, 0x7f, 0xe4, 0x00, 0x06, 0xfc, 0x00, 0x00, 0x1c, 0xf5,
+    0x00,
 
     /*Unicode: U+003d (=) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xec, 0x00, 0x05, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfb, 0x00, 0x05, 0xff, 0xff, 0xfc, 0xff,
+    0xff, 0xfc, 0xec, 0x00,
 
     /*Unicode: U+003e (>) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xd0, 0x00, 0x00,  //@+.........
-    0xfe, 0x40, 0x00,  //@@@%.......
-    0x6f, 0xf4, 0x00,  //+%@@@@+....
-    0x01, 0xff, 0x90,  //...+@@@@%+.
-    0x00, 0x1b, 0xfc,  //.....+%@@@@
-    0x00, 0x1b, 0xfc,  //.....+%@@@@
-    0x01, 0xff, 0x90,  //...+@@@@%+.
-    0x6f, 0xf4, 0x00,  //+%@@@@+....
-    0xfe, 0x40, 0x00,  //@@@%+......
-    0xd0, 0x00, 0x00,  //@+.........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xef, 0x00, 0x1b, 0xd0, 0x00, 0x00, 0xfe, 0x40, 0x00, 0x6f, 0xf4, 0x00, 0x01, 0xff, 0x90, 0x00,
+    0x1b, 0xfc, 0x00, 0x1b, 0xfc, 0x01, 0xff, 0x90, 0x6f, 0xf4, 0x00, 0xfe, 0x40, 0x00, 0xd0, 0xf3,
+    0x00,
 
     /*Unicode: U+003f (?) , Width: 7 */
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x6f, 0xd0,  //.%@@@+.
-    0xff, 0xf4,  //@@@@@@+
-    0xd0, 0xbc,  //@+..%@@
-    0x00, 0x3c,  //.....@@
-    0x00, 0x78,  //....+@%
-    0x00, 0xf0,  //....@@.
-    0x03, 0xc0,  //...@@..
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x00, 0x00,  //.......
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-
+    0xfb, 0x00, 0x12, 0x6f, 0xd0, 0xff, 0xf4, 0xd0, 0xbc, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x03,
+    0xc0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xfe, 0x00, 0x02, 0x0f, 0x00, 0x0f, 0xf8, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 16 */
-    0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x2f, 0xf9, 0x00,  //.....%@@@@%+....
-    0x02, 0xff, 0xff, 0xd0,  //...%@@@@@@@@@+..
-    0x0b, 0xe0, 0x06, 0xf4,  //..%@@%....+%@@+.
-    0x2f, 0x00, 0x00, 0x7c,  //.%@@........+@@.
-    0x3c, 0x00, 0x00, 0x1e,  //.@@..........+@%
-    0xb8, 0x0f, 0x3c, 0x0f,  //%@%...@@.@@...@@
-    0xf0, 0x2f, 0xfc, 0x0f,  //@@...%@@@@@...@@
-    0xf0, 0x3c, 0x3c, 0x1f,  //@@...@@..@@..+@@
-    0xf0, 0x3c, 0x3c, 0x7d,  //@@...@@..@@.+@@+
-    0xf0, 0x2f, 0xff, 0xf4,  //@@...%@@@@@@@@+.
-    0xb8, 0x0f, 0x3e, 0x40,  //%@%...@@.@@%+...
-    0x7c, 0x00, 0x00, 0x00,  //.@@.............
-    0x2f, 0x00, 0x00, 0x00,  //.%@@............
-    0x0f, 0xe0, 0x0b, 0x00,  //..@@@+....+@....
-    0x02, 0xff, 0xff, 0x00,  //...%@@@@@@@@....
-    0x00, 0x6f, 0xe4, 0x00,  //....+%@@@%+.....
-    0x00, 0x00, 0x00, 0x00,  //................
-
+    0xf4, 0x00, 0x2b, 0x2f, 0xf9, 0x00, 0x02, 0xff, 0xff, 0xd0, 0x0b, 0xe0, 0x06, 0xf4, 0x2f, 0x00,
+    0x00, 0x7c, 0x3c, 0x00, 0x00, 0x1e, 0xb8, 0x0f, 0x3c, 0x0f, 0xf0, 0x2f, 0xfc, 0x0f, 0xf0, 0x3c,
+    0x3c, 0x1f, 0xf0, 0x3c, 0x3c, 0x7d, 0xf0, 0x2f, 0xff, 0xf4, 0xb8, 0x0f, 0x3e, 0x40, 0x7c, 0xfe,
+    0x00, 0x00, 0x2f, 0xfe, 0x00, 0x0a, 0x0f, 0xe0, 0x0b, 0x00, 0x02, 0xff, 0xff, 0x00, 0x00, 0x6f,
+    0xe4, 0xfc, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x7d, 0x00,  //....+@@+....
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x02, 0xd7, 0x80,  //...%@++@%...
-    0x03, 0xc3, 0xc0,  //...@@..@@...
-    0x07, 0x82, 0xd0,  //..+@%..%@+..
-    0x0f, 0x00, 0xf0,  //..@@....@@..
-    0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-    0x2f, 0xff, 0xf8,  //.%@@@@@@@@%.
-    0x3c, 0x00, 0x3c,  //.@@......@@.
-    0x78, 0x00, 0x2d,  //+@%......%@+
-    0xf4, 0x00, 0x1f,  //@@+......+@@
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf7, 0x00, 0x25, 0x3c, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x02, 0xd7,
+    0x80, 0x03, 0xc3, 0xc0, 0x07, 0x82, 0xd0, 0x0f, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x2f, 0xff, 0xf8,
+    0x3c, 0x00, 0x3c, 0x78, 0x00, 0x2d, 0xf4, 0x00, 0x1f, 0xf5, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0xff, 0xf4, 0x00,  //@@@@@@+..
-    0xff, 0xfe, 0x00,  //@@@@@@@%.
-    0xf0, 0x1f, 0x00,  //@@...+@@.
-    0xf0, 0x0f, 0x00,  //@@....@@.
-    0xf0, 0x1e, 0x00,  //@@...+@%.
-    0xff, 0xf8, 0x00,  //@@@@@@%..
-    0xff, 0xfd, 0x00,  //@@@@@@@+.
-    0xf0, 0x0b, 0x40,  //@@....%@+
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x0b, 0xc0,  //@@....%@@
-    0xff, 0xff, 0x40,  //@@@@@@@@+
-    0xff, 0xf8, 0x00,  //@@@@@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0xff, 0xf4, 0x00, 0xff, 0xfe, 0x00, 0xf0, 0x1f, 0x00, 0xf0, 0x0f, 0x00, 0xf0,
+    0x1e, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0x00, 0xf0, 0x0b, 0x40, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+    0xc0, 0xf0, 0x0b, 0xc0, 0xff, 0xff, 0x40, 0xff, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x01, 0xbf, 0xe0,  //...+%@@@@%.
-    0x0f, 0xff, 0xfc,  //..@@@@@@@@@
-    0x3f, 0x40, 0x1c,  //.@@@+....+@
-    0x7c, 0x00, 0x00,  //+@@........
-    0xb4, 0x00, 0x00,  //%@+........
-    0xf0, 0x00, 0x00,  //@@.........
-    0xf0, 0x00, 0x00,  //@@.........
-    0xf0, 0x00, 0x00,  //@@.........
-    0xb4, 0x00, 0x00,  //%@+........
-    0x7c, 0x00, 0x00,  //+@@........
-    0x3f, 0x40, 0x1c,  //.@@@+....+@
-    0x0f, 0xff, 0xfc,  //..@@@@@@@@@
-    0x01, 0xbf, 0xe0,  //...+%@@@@%.
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x26, 0x01, 0xbf, 0xe0, 0x0f, 0xff, 0xfc, 0x3f, 0x40, 0x1c, 0x7c, 0x00, 0x00, 0xb4,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x3f, 0x40, 0x1c, 0x0f, 0xff, 0xfc, 0x01, 0xbf, 0xe0, 0xf5, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xff, 0xf9, 0x00,  //@@@@@@%+...
-    0xff, 0xff, 0xc0,  //@@@@@@@@@..
-    0xf0, 0x07, 0xf0,  //@@....+@@@.
-    0xf0, 0x00, 0xf4,  //@@......@@+
-    0xf0, 0x00, 0x7c,  //@@......+@@
-    0xf0, 0x00, 0x3c,  //@@.......@@
-    0xf0, 0x00, 0x3c,  //@@.......@@
-    0xf0, 0x00, 0x3c,  //@@.......@@
-    0xf0, 0x00, 0x7c,  //@@......+@@
-    0xf0, 0x00, 0xf4,  //@@......@@+
-    0xf0, 0x07, 0xf0,  //@@....+@@@.
-    0xff, 0xff, 0xc0,  //@@@@@@@@@..
-    0xff, 0xf9, 0x00,  //@@@@@@%+...
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x25, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xc0, 0xf0, 0x07, 0xf0, 0xf0, 0x00, 0xf4, 0xf0,
+    0x00, 0x7c, 0xf0, 0x00, 0x3c, 0xf0, 0x00, 0x3c, 0xf0, 0x00, 0x3c, 0xf0, 0x00, 0x7c, 0xf0, 0x00,
+    0xf4, 0xf0, 0x07, 0xf0, 0xff, 0xff, 0xc0, 0xff, 0xf9, 0xf4, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0xfd, 0xff, 0x05, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0xff, 0x07, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xff, 0xfc,  //@@@@@@@.
-    0xff, 0xfc,  //@@@@@@@.
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0xfd, 0xff, 0x14, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xf0,
+    0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xf8, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x01, 0xbf, 0xe0,  //...+%@@@@%.
-    0x0f, 0xff, 0xfc,  //..@@@@@@@@@
-    0x3f, 0x40, 0x1c,  //.@@@+....+@
-    0x7c, 0x00, 0x00,  //+@@........
-    0xf4, 0x00, 0x00,  //%@+........
-    0xf0, 0x0f, 0xfc,  //@@....@@@@@
-    0xf0, 0x0f, 0xfc,  //@@....@@@@@
-    0xf0, 0x00, 0x3c,  //@@.......@@
-    0xf4, 0x00, 0x3c,  //@@+......@@
-    0x7c, 0x00, 0x3c,  //+@@......@@
-    0x3f, 0x40, 0x7c,  //.@@@+...+@@
-    0x0f, 0xff, 0xf4,  //..@@@@@@@@+
-    0x01, 0xff, 0x80,  //...+@@@@%..
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x26, 0x01, 0xbf, 0xe0, 0x0f, 0xff, 0xfc, 0x3f, 0x40, 0x1c, 0x7c, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0xf0, 0x0f, 0xfc, 0xf0, 0x0f, 0xfc, 0xf0, 0x00, 0x3c, 0xf4, 0x00, 0x3c, 0x7c, 0x00,
+    0x3c, 0x3f, 0x40, 0x7c, 0x0f, 0xff, 0xf4, 0x01, 0xff, 0x80, 0xf5, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xf8, 0x00, 0x26, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00,
+    0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf5, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xf4, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+004a (J) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x2e,  //.%@%
-    0xfc,  //@@@.
-    0xe0,  //@%..
-
+    0xfe, 0x00, 0xf3, 0x0f, 0x02, 0x2e, 0xfc, 0xe0,
 
     /*Unicode: U+004b (K) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xf0, 0x03, 0xd0,  //@@.....@@+.
-    0xf0, 0x0f, 0x40,  //@@....@@+..
-    0xf0, 0x3d, 0x00,  //@@...@@+...
-    0xf0, 0xf4, 0x00,  //@@..@@+....
-    0xf3, 0xd0, 0x00,  //@@.@@+.....
-    0xff, 0x40, 0x00,  //@@@@+......
-    0xff, 0x00, 0x00,  //@@@@.......
-    0xf7, 0xc0, 0x00,  //@@+@@......
-    0xf1, 0xf0, 0x00,  //@@.+@@.....
-    0xf0, 0x7c, 0x00,  //@@..+@@....
-    0xf0, 0x1f, 0x00,  //@@...+@@...
-    0xf0, 0x07, 0xd0,  //@@....+@@..
-    0xf0, 0x01, 0xf4,  //@@.....+@@+
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x26, 0xf0, 0x03, 0xd0, 0xf0, 0x0f, 0x40, 0xf0, 0x3d, 0x00, 0xf0, 0xf4, 0x00, 0xf3,
+    0xd0, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0x00, 0xf7, 0xc0, 0x00, 0xf1, 0xf0, 0x00, 0xf0, 0x7c,
+    0x00, 0xf0, 0x1f, 0x00, 0xf0, 0x07, 0xd0, 0xf0, 0x01, 0xf4, 0xf5, 0x00,
 
     /*Unicode: U+004c (L) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+    0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+004d (M) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0xfd, 0x00, 0x7f,  //@@@+....+@@@
-    0xff, 0x00, 0xbf,  //@@@%....%@@@
-    0xfb, 0x00, 0xef,  //@@%@....@%@@
-    0xf7, 0x81, 0xdf,  //@@.@+..+@.@@
-    0xf3, 0xc3, 0xcf,  //@@.@@..@@.@@
-    0xf2, 0xc3, 0x8f,  //@@.%@..@+.@@
-    0xf0, 0xeb, 0x0f,  //@@..@%%@..@@
-    0xf0, 0xff, 0x0f,  //@@..@@@@..@@
-    0xf0, 0x7d, 0x0f,  //@@..+@@+..@@
-    0xf0, 0x3c, 0x0f,  //@@...@@...@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x26, 0xfd, 0x00, 0x7f, 0xff, 0x00, 0xbf, 0xfb, 0x00, 0xef, 0xf7, 0x81, 0xdf, 0xf3,
+    0xc3, 0xcf, 0xf2, 0xc3, 0x8f, 0xf0, 0xeb, 0x0f, 0xf0, 0xff, 0x0f, 0xf0, 0x7d, 0x0f, 0xf0, 0x3c,
+    0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf5, 0x00,
 
     /*Unicode: U+004e (N) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0xf8, 0x00, 0xf0,  //@@%.....@@
-    0xfc, 0x00, 0xf0,  //@@@.....@@
-    0xfe, 0x00, 0xf0,  //@@@%....@@
-    0xfb, 0x40, 0xf0,  //@@%@+...@@
-    0xf3, 0xc0, 0xf0,  //@@.@@...@@
-    0xf2, 0xd0, 0xf0,  //@@.%@+..@@
-    0xf0, 0xf0, 0xf0,  //@@..@@..@@
-    0xf0, 0x78, 0xf0,  //@@..+@%.@@
-    0xf0, 0x3d, 0xf0,  //@@...@@.@@
-    0xf0, 0x1f, 0xf0,  //@@...+@@@@
-    0xf0, 0x0b, 0xf0,  //@@....%@@@
-    0xf0, 0x03, 0xf0,  //@@.....@@@
-    0xf0, 0x02, 0xf0,  //@@.....%@@
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xf8, 0x00, 0x10, 0xf8, 0x00, 0xf0, 0xfc, 0x00, 0xf0, 0xfe, 0x00, 0xf0, 0xfb, 0x40, 0xf0, 0xf3,
+    0xc0, 0xf0, 0xf2, 0xd0, 0xfc, 0xf0, 0x10, 0x78, 0xf0, 0xf0, 0x3d, 0xf0, 0xf0, 0x1f, 0xf0, 0xf0,
+    0x0b, 0xf0, 0xf0, 0x03, 0xf0, 0xf0, 0x02, 0xf0, 0xf5, 0x00,
 
     /*Unicode: U+004f (O) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x01, 0xff, 0x80,  //...+@@@@+...
-    0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-    0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-    0x7c, 0x00, 0x3d,  //+@@......@@+
-    0xf4, 0x00, 0x1e,  //%@+......+@%
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf4, 0x00, 0x1e,  //%@+......+@%
-    0x7c, 0x00, 0x3d,  //+@@......@@+
-    0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-    0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-    0x02, 0xff, 0x80,  //...+@@@@+...
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x26, 0x01, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7c, 0x00, 0x3d, 0xf4,
+    0x00, 0x1e, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf4, 0x00, 0x1e, 0x7c, 0x00,
+    0x3d, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xf5, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xff, 0xf4,  //@@@@@%+.
-    0xff, 0xfd,  //@@@@@@@+
-    0xf0, 0x2f,  //@@...%@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x2f,  //@@...%@@
-    0xff, 0xfd,  //@@@@@@@+
-    0xff, 0xf4,  //@@@@@@+.
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfb, 0x00, 0x18, 0xff, 0xf4, 0xff, 0xfd, 0xf0, 0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x2f, 0xff,
+    0xfd, 0xff, 0xf4, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xf8, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x01, 0xff, 0x80,  //...+@@@@%...
-    0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-    0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-    0x7c, 0x00, 0x3d,  //+@@......@@+
-    0xf4, 0x00, 0x1f,  //%@+......+@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf0, 0x00, 0x0f,  //@@........@@
-    0xf4, 0x00, 0x1e,  //%@+......+@%
-    0x7c, 0x00, 0x3d,  //+@@......@@+
-    0x3f, 0x41, 0xf8,  //.@@@+..+@@%.
-    0x0f, 0xff, 0xe0,  //..@@@@@@@%..
-    0x02, 0xff, 0x80,  //...%@@@@%...
-    0x00, 0x07, 0xd0,  //......+@@+..
-    0x00, 0x01, 0xf4,  //.......+@@+.
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x2c, 0x01, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7c, 0x00, 0x3d, 0xf4,
+    0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf4, 0x00, 0x1e, 0x7c, 0x00,
+    0x3d, 0x3f, 0x41, 0xf8, 0x0f, 0xff, 0xe0, 0x02, 0xff, 0x80, 0x00, 0x07, 0xd0, 0x00, 0x01, 0xf4,
+    0xfb, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0xff, 0xf4, 0x00,  //@@@@@@+...
-    0xff, 0xfd, 0x00,  //@@@@@@@+..
-    0xf0, 0x2f, 0x00,  //@@...%@@..
-    0xf0, 0x0f, 0x00,  //@@....@@..
-    0xf0, 0x0f, 0x00,  //@@....@@..
-    0xf0, 0x2e, 0x00,  //@@...%@%..
-    0xff, 0xfc, 0x00,  //@@@@@@@...
-    0xff, 0xf4, 0x00,  //@@@@@@+...
-    0xf0, 0x7c, 0x00,  //@@..+@@...
-    0xf0, 0x1f, 0x00,  //@@...+@@..
-    0xf0, 0x0f, 0x40,  //@@....@@+.
-    0xf0, 0x07, 0xc0,  //@@....+@@.
-    0xf0, 0x02, 0xe0,  //@@.....%@%
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xf8, 0x00, 0x26, 0xff, 0xf4, 0x00, 0xff, 0xfd, 0x00, 0xf0, 0x2f, 0x00, 0xf0, 0x0f, 0x00, 0xf0,
+    0x0f, 0x00, 0xf0, 0x2e, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xf4, 0x00, 0xf0, 0x7c, 0x00, 0xf0, 0x1f,
+    0x00, 0xf0, 0x0f, 0x40, 0xf0, 0x07, 0xc0, 0xf0, 0x02, 0xe0, 0xf5, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x0b, 0xf8, 0x00,  //..%@@@%..
-    0x7f, 0xff, 0x00,  //+@@@@@@@.
-    0xf8, 0x06, 0x00,  //@@%...+%.
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf4, 0x00, 0x00,  //@@+......
-    0x7f, 0xe4, 0x00,  //+@@@@%+..
-    0x1b, 0xff, 0x00,  //..%@@@@@.
-    0x00, 0x1f, 0x80,  //.....+@@%
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0xd0, 0x0f, 0xc0,  //@+....%@@
-    0xff, 0xff, 0x40,  //@@@@@@@@+
-    0x2f, 0xf8, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xf8, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x7f, 0xff, 0x00, 0xf8, 0x06, 0x00, 0xf0, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0x7f, 0xe4, 0x00, 0x1b, 0xff, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x03, 0xc0, 0x00, 0x03,
+    0xc0, 0xd0, 0x0f, 0xc0, 0xff, 0xff, 0x40, 0x2f, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0xfb, 0xff, 0x1f, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00,
+    0x00, 0x3c, 0x00, 0x00, 0x3c, 0xf4, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf4, 0x01, 0xf0,  //@@+....+@@
-    0x7d, 0x07, 0xd0,  //+@@+..+@@+
-    0x3f, 0xff, 0xc0,  //.@@@@@@@@.
-    0x07, 0xfd, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xf8, 0x00, 0x25, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf4, 0x01,
+    0xf0, 0x7d, 0x07, 0xd0, 0x3f, 0xff, 0xc0, 0x07, 0xfd, 0xf4, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0xf4, 0x00, 0x1f,  //@@+......+@@
-    0x78, 0x00, 0x2d,  //+@%......%@+
-    0x3c, 0x00, 0x3c,  //.@@......@@.
-    0x2d, 0x00, 0x78,  //.%@+....+@%.
-    0x0f, 0x00, 0xf0,  //..@@....@@..
-    0x0f, 0x01, 0xf0,  //..@@....@@..
-    0x07, 0x82, 0xd0,  //..+@%..%@+..
-    0x03, 0xc3, 0xc0,  //...@@..@@...
-    0x02, 0xd7, 0x80,  //...%@++@%...
-    0x01, 0xff, 0x40,  //....@@@@+...
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x00, 0x7d, 0x00,  //....+@@+....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x25, 0xf4, 0x00, 0x1f, 0x78, 0x00, 0x2d, 0x3c, 0x00, 0x3c, 0x2d, 0x00, 0x78, 0x0f,
+    0x00, 0xf0, 0x0f, 0x01, 0xf0, 0x07, 0x82, 0xd0, 0x03, 0xc3, 0xc0, 0x02, 0xd7, 0x80, 0x01, 0xff,
+    0x40, 0x00, 0xff, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x3c, 0xf4, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0xf0, 0x03, 0xf0, 0x03, 0xc0,  //@@.....@@@.....@@
-    0xb4, 0x07, 0xf4, 0x07, 0x80,  //%@+...+@@@+...+@%
-    0x78, 0x0b, 0xb8, 0x0b, 0x40,  //+@%...%@%@%...%@+
-    0x3c, 0x0f, 0x3c, 0x0f, 0x00,  //.@@...@@.@@...@@.
-    0x3c, 0x0f, 0x3c, 0x0f, 0x00,  //.@@...@@.@@...@@.
-    0x2d, 0x1e, 0x2d, 0x1e, 0x00,  //.%@+.+@%.%@+.+@%.
-    0x1e, 0x2d, 0x1e, 0x2d, 0x00,  //.+@%.%@+.+@%.%@+.
-    0x0f, 0x3c, 0x0f, 0x3c, 0x00,  //..@@.@@...@@.@@..
-    0x0f, 0x7c, 0x0f, 0x7c, 0x00,  //..@@+@@...@@+@@..
-    0x0b, 0xf8, 0x0b, 0xf8, 0x00,  //..%@@@%...%@@@%..
-    0x07, 0xf4, 0x07, 0xf4, 0x00,  //..+@@@+...+@@@+..
-    0x03, 0xf0, 0x03, 0xf0, 0x00,  //...@@@.....@@@...
-    0x03, 0xf0, 0x03, 0xf0, 0x00,  //...@@@.....@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xf2, 0x00, 0x3f, 0xf0, 0x03, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0xf4, 0x07, 0x80, 0x78, 0x0b, 0xb8,
+    0x0b, 0x40, 0x3c, 0x0f, 0x3c, 0x0f, 0x00, 0x3c, 0x0f, 0x3c, 0x0f, 0x00, 0x2d, 0x1e, 0x2d, 0x1e,
+    0x00, 0x1e, 0x2d, 0x1e, 0x2d, 0x00, 0x0f, 0x3c, 0x0f, 0x3c, 0x00, 0x0f, 0x7c, 0x0f, 0x7c, 0x00,
+    0x0b, 0xf8, 0x0b, 0xf8, 0x00, 0x07, 0xf4, 0x07, 0xf4, 0x00, 0x03, 0xf0, 0x03, 0xf0, 0x00, 0x03,
+    0xf0, 0x03, 0xf0, 0xec, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x2e, 0x00, 0xb8,  //.%@%....%@%
-    0x0f, 0x41, 0xf0,  //..@@+..+@@.
-    0x0b, 0xc3, 0xd0,  //..%@@..@@+.
-    0x03, 0xdb, 0x80,  //...@@+%@%..
-    0x01, 0xff, 0x00,  //...+@@@@...
-    0x00, 0xfd, 0x00,  //....%@@+...
-    0x00, 0xbc, 0x00,  //....%@@....
-    0x01, 0xff, 0x00,  //...+@@@@...
-    0x03, 0xdf, 0x40,  //...@@+@@+..
-    0x0b, 0x87, 0xc0,  //..%@%.+@@..
-    0x1f, 0x03, 0xe0,  //.+@@...@@%.
-    0x3d, 0x00, 0xf0,  //.@@+....@@.
-    0xbc, 0x00, 0xb8,  //%@@.....%@%
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x26, 0x2e, 0x00, 0xb8, 0x0f, 0x41, 0xf0, 0x0b, 0xc3, 0xd0, 0x03, 0xdb, 0x80, 0x01,
+    0xff, 0x00, 0x00, 0xfd, 0x00, 0x00, 0xbc, 0x00, 0x01, 0xff, 0x00, 0x03, 0xdf, 0x40, 0x0b, 0x87,
+    0xc0, 0x1f, 0x03, 0xe0, 0x3d, 0x00, 0xf0, 0xbc, 0x00, 0xb8, 0xf5, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0xbc, 0x00, 0x3e,  //%@@......@@%
-    0x3d, 0x00, 0x7c,  //.@@+....+@@.
-    0x0f, 0x00, 0xf0,  //..@@....@@..
-    0x07, 0x82, 0xd0,  //..+@%..%@+..
-    0x02, 0xd7, 0x80,  //...%@++@%...
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xf8, 0x00, 0x25, 0xbc, 0x00, 0x3e, 0x3d, 0x00, 0x7c, 0x0f, 0x00, 0xf0, 0x07, 0x82, 0xd0, 0x02,
+    0xd7, 0x80, 0x00, 0xff, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0xf4, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0x00, 0x02, 0xf0,  //.......%@@.
-    0x00, 0x0b, 0xc0,  //......%@@..
-    0x00, 0x1f, 0x40,  //.....+@@+..
-    0x00, 0x3e, 0x00,  //.....@@%...
-    0x00, 0xf8, 0x00,  //....@@%....
-    0x02, 0xf0, 0x00,  //...%@@.....
-    0x07, 0xc0, 0x00,  //..+@@......
-    0x1f, 0x40, 0x00,  //.+@@+......
-    0x3e, 0x00, 0x00,  //.@@%.......
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf8, 0x00, 0x26, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x00, 0x02, 0xf0, 0x00, 0x0b, 0xc0, 0x00,
+    0x1f, 0x40, 0x00, 0x3e, 0x00, 0x00, 0xf8, 0x00, 0x02, 0xf0, 0x00, 0x07, 0xc0, 0x00, 0x1f, 0x40,
+    0x00, 0x3e, 0x00, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xf5, 0x00,
 
     /*Unicode: U+005b ([) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xff,  //@@@@
-    0xff,  //@@@@
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xf0,  //@@..
-    0xff,  //@@@@
-    0xff,  //@@@@
-    0x00,  //....
-    0x00,  //....
-
+    0x03, 0x00, 0x00, 0xff, 0xff, 0xf5, 0xf0, 0x03, 0xff, 0xff, 0x00, 0x00,
 
     /*Unicode: U+005c (\) , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0xf0, 0x00,  //@@....
-    0xb4, 0x00,  //%@+...
-    0x78, 0x00,  //+@%...
-    0x3c, 0x00,  //.@@...
-    0x3d, 0x00,  //.@@+..
-    0x2e, 0x00,  //.%@%..
-    0x1f, 0x00,  //.+@@..
-    0x0f, 0x00,  //..@@..
-    0x0f, 0x40,  //..@@+.
-    0x0b, 0x80,  //..+@%.
-    0x03, 0xc0,  //...@@.
-    0x03, 0xc0,  //...@@.
-    0x02, 0xd0,  //...%@+
-    0x01, 0xe0,  //...+@%
-    0x00, 0xf0,  //....@@
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xfb, 0x00, 0x1d, 0xf0, 0x00, 0xb4, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x2e, 0x00, 0x1f,
+    0x00, 0x0f, 0x00, 0x0f, 0x40, 0x0b, 0x80, 0x03, 0xc0, 0x03, 0xc0, 0x02, 0xd0, 0x01, 0xe0, 0x00,
+    0xf0, 0xfd, 0x00,
 
     /*Unicode: U+005d (]) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xff,  //@@@@
-    0xff,  //@@@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0xff,  //@@@@
-    0xff,  //@@@@
-    0x00,  //....
-    0x00,  //....
-
+    0x03, 0x00, 0x00, 0xff, 0xff, 0xf5, 0x0f, 0x03, 0xff, 0xff, 0x00, 0x00,
 
     /*Unicode: U+005e (^) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0xfc, 0x00,  //....@@@....
-    0x02, 0xee, 0x00,  //...%@%@%...
-    0x0b, 0x47, 0x80,  //..%@+.+@%..
-    0x2d, 0x01, 0xe0,  //.%@+...+@%.
-    0xb4, 0x00, 0x78,  //%@+.....+@%
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
+    0xf7, 0x00, 0x0d, 0xfc, 0x00, 0x02, 0xee, 0x00, 0x0b, 0x47, 0x80, 0x2d, 0x01, 0xe0, 0xb4, 0x00,
+    0x78, 0xdd, 0x00,
 
     /*Unicode: U+005f (_) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0xc0,  //@@@@@@@@@
-    0xff, 0xff, 0xc0,  //@@@@@@@@@
-
+    0xcb, 0x00, 0x05, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
 
     /*Unicode: U+0060 (`) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0xb0,  //%@..
-    0x2c,  //.%@.
-    0x0a,  //..%%
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-
+    0x04, 0x00, 0x00, 0xb0, 0x2c, 0x0a, 0xf2, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x1b, 0xf4,  //.+%@@@+.
-    0x3f, 0xfc,  //.@@@@@@.
-    0x20, 0x2e,  //.%...%@%
-    0x00, 0x0f,  //......@@
-    0x1f, 0xff,  //.+@@@@@@
-    0xbf, 0xff,  //%@@@@@@@
-    0xf4, 0x0f,  //@@+...@@
-    0xf4, 0x2f,  //@@+..%@@
-    0xbf, 0xef,  //%@@@@%@@
-    0x2f, 0x8f,  //.%@@%.@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x13, 0x1b, 0xf4, 0x3f, 0xfc, 0x20, 0x2e, 0x00, 0x0f, 0x1f, 0xff, 0xbf, 0xff, 0xf4,
+    0x0f, 0xf4, 0x2f, 0xbf, 0xef, 0x2f, 0x8f, 0xf9, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf2, 0xf8, 0x00,  //@@.%@@%..
-    0xfb, 0xff, 0x00,  //@@%@@@@@.
-    0xfc, 0x0f, 0x80,  //@@@...@@%
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xfc, 0x0f, 0x80,  //@@@...@@%
-    0xfb, 0xff, 0x00,  //@@%@@@@@.
-    0xf2, 0xf8, 0x00,  //@@.%@@%..
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x28, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf2,
+    0xf8, 0x00, 0xfb, 0xff, 0x00, 0xfc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+    0xc0, 0xf4, 0x07, 0xc0, 0xfc, 0x0f, 0x80, 0xfb, 0xff, 0x00, 0xf2, 0xf8, 0xf4, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x07, 0xf9,  //..+@@@%+
-    0x2f, 0xff,  //.%@@@@@@
-    0x7d, 0x02,  //+@@+...%
-    0xf4, 0x00,  //@@+.....
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf4, 0x00,  //@@+.....
-    0x7d, 0x02,  //+@@+...%
-    0x2f, 0xff,  //.%@@@@@@
-    0x07, 0xf9,  //..+@@@%+
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x13, 0x07, 0xf9, 0x2f, 0xff, 0x7d, 0x02, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+    0x00, 0x7d, 0x02, 0x2f, 0xff, 0x07, 0xf9, 0xf9, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xfa, 0x00, 0x28, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x0b, 0xe3,
+    0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+    0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3, 0xc0, 0xf5, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x06, 0xfe, 0x00,  //..+%@@@%..
-    0x2f, 0xff, 0xc0,  //.%@@@@@@@.
-    0x7d, 0x03, 0xe0,  //+@@+...@@%
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@
-    0xf0, 0x00, 0x00,  //@@........
-    0x7d, 0x00, 0x70,  //+@@+....+@
-    0x2f, 0xff, 0xf0,  //.%@@@@@@@@
-    0x06, 0xff, 0x80,  //..+%@@@@%.
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xef, 0x00, 0x1d, 0x06, 0xfe, 0x00, 0x2f, 0xff, 0xc0, 0x7d, 0x03, 0xe0, 0xf0, 0x00, 0xf0, 0xff,
+    0xff, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x7d, 0x00, 0x70, 0x2f, 0xff, 0xf0, 0x06, 0xff,
+    0x80, 0xf5, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 7 */
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x02, 0xfc,  //...%@@@
-    0x0b, 0xfc,  //..%@@@@
-    0x0f, 0x40,  //..@@+..
-    0x0f, 0x00,  //..@@...
-    0xff, 0xfc,  //@@@@@@@
-    0xff, 0xfc,  //@@@@@@@
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x0f, 0x00,  //..@@...
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-
+    0xfd, 0x00, 0x1a, 0x02, 0xfc, 0x0b, 0xfc, 0x0f, 0x40, 0x0f, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0x0f,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xf8, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x00, 0x07, 0x80,  //......+@%
-    0x20, 0x1f, 0x40,  //.%...+@@+
-    0x3f, 0xff, 0x00,  //.@@@@@@@.
-    0x1b, 0xf8, 0x00,  //.+%@@@%..
-
+    0xef, 0x00, 0x29, 0x0b, 0xe3, 0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0,
+    0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3,
+    0xc0, 0x00, 0x07, 0x80, 0x20, 0x1f, 0x40, 0x3f, 0xff, 0x00, 0x1b, 0xf8, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf0, 0x00,  //@@......
-    0xf2, 0xf8,  //@@.%@@%.
-    0xfb, 0xfd,  //@@%@@@@+
-    0xfc, 0x2f,  //@@@..%@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xfd, 0x00, 0x1b, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf2, 0xf8, 0xfb, 0xfd, 0xfc,
+    0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf9,
+    0x00,
 
     /*Unicode: U+0069 (i) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x05, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf7, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00,  //....
-    0x00,  //....
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x00,  //....
-    0x00,  //....
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x0f,  //..@@
-    0x1f,  //.+@@
-    0xfd,  //@@@+
-    0xf4,  //@@+.
-
+    0x05, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xf6, 0x0f, 0x02, 0x1f, 0xfd, 0xf4,
 
     /*Unicode: U+006b (k) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x0f, 0x40,  //@@....@@+
-    0xf0, 0x7d, 0x00,  //@@..+@@+.
-    0xf1, 0xf4, 0x00,  //@@.+@@+..
-    0xf7, 0xd0, 0x00,  //@@+@@+...
-    0xff, 0x00, 0x00,  //@@@@.....
-    0xff, 0x40, 0x00,  //@@@@+....
-    0xf7, 0xd0, 0x00,  //@@+@@+...
-    0xf1, 0xf4, 0x00,  //@@.+@@+..
-    0xf0, 0x7d, 0x00,  //@@..+@@+.
-    0xf0, 0x1f, 0x40,  //@@...+@@+
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-
+    0xfb, 0x00, 0x29, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0x0f, 0x40, 0xf0, 0x7d, 0x00, 0xf1, 0xf4, 0x00, 0xf7, 0xd0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x40,
+    0x00, 0xf7, 0xd0, 0x00, 0xf1, 0xf4, 0x00, 0xf0, 0x7d, 0x00, 0xf0, 0x1f, 0x40, 0xf5, 0x00,
 
     /*Unicode: U+006c (l) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x01, 0x00, 0x00, 0xf3, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+006d (m) , Width: 14 */
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0xf2, 0xf4, 0x2f, 0x80,  //@@.%@@+..%@@%.
-    0xfb, 0xfd, 0xff, 0xd0,  //@@%@@@@+@@@@@+
-    0xfc, 0x2f, 0xc2, 0xf0,  //@@@..%@@@..%@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0xf0, 0x0f, 0x00, 0xf0,  //@@....@@....@@
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00,  //..............
-
+    0xe9, 0x00, 0x27, 0xf2, 0xf4, 0x2f, 0x80, 0xfb, 0xfd, 0xff, 0xd0, 0xfc, 0x2f, 0xc2, 0xf0, 0xf0,
+    0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xf0,
+    0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xf1, 0x00,
 
     /*Unicode: U+006e (n) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xf2, 0xf8,  //@@.%@@%.
-    0xfb, 0xfd,  //@@%@@@@+
-    0xfc, 0x2f,  //@@@..%@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x13, 0xf2, 0xf8, 0xfb, 0xfd, 0xfc, 0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf9, 0x00,
 
     /*Unicode: U+006f (o) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x07, 0xfd, 0x00,  //..+@@@@+..
-    0x3f, 0xff, 0x80,  //.%@@@@@@%.
-    0x7d, 0x07, 0xd0,  //+@@+..+@@+
-    0xf4, 0x01, 0xf0,  //@@+....+@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf0, 0x00, 0xf0,  //@@......@@
-    0xf4, 0x01, 0xf0,  //@@+....+@@
-    0x7d, 0x07, 0xd0,  //+@@+..+@@+
-    0x3f, 0xff, 0x80,  //.%@@@@@@%.
-    0x07, 0xfd, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xef, 0x00, 0x1c, 0x07, 0xfd, 0x00, 0x3f, 0xff, 0x80, 0x7d, 0x07, 0xd0, 0xf4, 0x01, 0xf0, 0xf0,
+    0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf4, 0x01, 0xf0, 0x7d, 0x07, 0xd0, 0x3f, 0xff, 0x80, 0x07, 0xfd,
+    0xf4, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0xf2, 0xf8, 0x00,  //@@.%@@%..
-    0xfb, 0xff, 0x00,  //@@%@@@@@.
-    0xfc, 0x0f, 0x80,  //@@@...@@%
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xfc, 0x0f, 0x80,  //@@@...@@%
-    0xfb, 0xff, 0x00,  //@@%@@@@@.
-    0xf2, 0xf8, 0x00,  //@@.%@@%..
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-    0xf0, 0x00, 0x00,  //@@.......
-
+    0xef, 0x00, 0x29, 0xf2, 0xf8, 0x00, 0xfb, 0xff, 0x00, 0xfc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0,
+    0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xfc, 0x0f, 0x80, 0xfb, 0xff, 0x00, 0xf2, 0xf8,
+    0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 9 */
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00,  //.........
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf0, 0x03, 0xc0,  //@@.....@@
-    0xf4, 0x07, 0xc0,  //@@+...+@@
-    0xbc, 0x0f, 0xc0,  //%@@...@@@
-    0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-    0x0b, 0xe3, 0xc0,  //..%@@%.@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-    0x00, 0x03, 0xc0,  //.......@@
-
+    0xef, 0x00, 0x29, 0x0b, 0xe3, 0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0,
+    0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3,
+    0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0,
 
     /*Unicode: U+0072 (r) , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0xf2, 0xf0,  //@@.%@@
-    0xfb, 0xf0,  //@@%@@@
-    0xfd, 0x00,  //@@@+..
-    0xf4, 0x00,  //@@+...
-    0xf0, 0x00,  //@@....
-    0xf0, 0x00,  //@@....
-    0xf0, 0x00,  //@@....
-    0xf0, 0x00,  //@@....
-    0xf0, 0x00,  //@@....
-    0xf0, 0x00,  //@@....
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xf5, 0x00, 0x12, 0xf2, 0xf0, 0xfb, 0xf0, 0xfd, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+    0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xf8, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 7 */
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x2f, 0xe4,  //.+@@@%+
-    0xbf, 0xfc,  //%@@@@@@
-    0xf4, 0x08,  //@@+...%
-    0xf9, 0x00,  //@@%+...
-    0x7f, 0xf0,  //+@@@@@.
-    0x06, 0xfc,  //..+%@@%
-    0x00, 0x3c,  //.....@@
-    0x90, 0x7c,  //%+..+@@
-    0xff, 0xf8,  //@@@@@@%
-    0x2f, 0xd0,  //.%@@@+.
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-    0x00, 0x00,  //.......
-
+    0xf5, 0x00, 0x13, 0x2f, 0xe4, 0xbf, 0xfc, 0xf4, 0x08, 0xf9, 0x00, 0x7f, 0xf0, 0x06, 0xfc, 0x00,
+    0x3c, 0x90, 0x7c, 0xff, 0xf8, 0x2f, 0xd0, 0xf9, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 6 */
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0xff, 0xf0,  //@@@@@@
-    0xff, 0xf0,  //@@@@@@
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0x3c, 0x00,  //.@@...
-    0x3d, 0x00,  //.@@+..
-    0x2f, 0xf0,  //.%@@@@
-    0x0b, 0xf0,  //..%@@@
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-    0x00, 0x00,  //......
-
+    0xfb, 0x00, 0x19, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x3c, 0x00, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x2f, 0xf0, 0x0b, 0xf0, 0xf9, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf0, 0x0f,  //@@....@@
-    0xf8, 0x3f,  //@@%..@@@
-    0x7f, 0xef,  //+@@@@%@@
-    0x2f, 0x8f,  //.%@@%.@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x13, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x0f, 0xf8, 0x3f, 0x7f, 0xef, 0x2f, 0x8f, 0xf9, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x3c, 0x00, 0x3c,  //.@@......@@.
-    0x2d, 0x00, 0x78,  //.%@+....+@%.
-    0x1f, 0x00, 0xf0,  //..@@....@@..
-    0x0f, 0x00, 0xf0,  //..@@....@@..
-    0x07, 0x82, 0xd0,  //..+@%..%@+..
-    0x03, 0xc3, 0xc0,  //...@@..@@...
-    0x02, 0xc7, 0x80,  //...%@.+@%...
-    0x01, 0xef, 0x00,  //...+@%@@....
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x00, 0x7d, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-
+    0xef, 0x00, 0x1c, 0x3c, 0x00, 0x3c, 0x2d, 0x00, 0x78, 0x1f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x07,
+    0x82, 0xd0, 0x03, 0xc3, 0xc0, 0x02, 0xc7, 0x80, 0x01, 0xef, 0x00, 0x00, 0xff, 0x00, 0x00, 0x7d,
+    0xf4, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x3c, 0x0f, 0xc0, 0xf0,  //.@@...@@@...@@.
-    0x3c, 0x0f, 0xc0, 0xf0,  //.@@...@@@...@@.
-    0x2d, 0x1f, 0xd1, 0xe0,  //.%@+.+@@@+.+@%.
-    0x1e, 0x2d, 0xe2, 0xd0,  //.+@%.%@+@%.%@+.
-    0x0f, 0x3c, 0xf3, 0xc0,  //..@@.@@.@@.@@..
-    0x0f, 0x38, 0xb3, 0xc0,  //..@@.@%.%@.@@..
-    0x0b, 0xb4, 0x7b, 0x80,  //..%@%@+.+@%@%..
-    0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-    0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-    0x03, 0xe0, 0x2f, 0x00,  //...@@%...%@@...
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xe9, 0x00, 0x26, 0x3c, 0x0f, 0xc0, 0xf0, 0x3c, 0x0f, 0xc0, 0xf0, 0x2d, 0x1f, 0xd1, 0xe0, 0x1e,
+    0x2d, 0xe2, 0xd0, 0x0f, 0x3c, 0xf3, 0xc0, 0x0f, 0x38, 0xb3, 0xc0, 0x0b, 0xb4, 0x7b, 0x80, 0x07,
+    0xf0, 0x3f, 0x40, 0x03, 0xf0, 0x3f, 0x00, 0x03, 0xe0, 0x2f, 0xf0, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 10 */
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0xbc, 0x03, 0xe0,  //%@@....@@%
-    0x3d, 0x07, 0xc0,  //.@@+..+@@.
-    0x1f, 0x0f, 0x00,  //.+@@..@@..
-    0x0b, 0x5e, 0x00,  //..%@++@%..
-    0x03, 0xfc, 0x00,  //...@@@@...
-    0x03, 0xfc, 0x00,  //...@@@@...
-    0x0b, 0x5e, 0x00,  //..%@++@%..
-    0x1f, 0x0f, 0x40,  //.+@@..@@+.
-    0x3d, 0x07, 0xc0,  //.@@+..+@@.
-    0xbc, 0x03, 0xe0,  //%@@....@@%
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00,  //..........
-
+    0xef, 0x00, 0x1d, 0xbc, 0x03, 0xe0, 0x3d, 0x07, 0xc0, 0x1f, 0x0f, 0x00, 0x0b, 0x5e, 0x00, 0x03,
+    0xfc, 0x00, 0x03, 0xfc, 0x00, 0x0b, 0x5e, 0x00, 0x1f, 0x0f, 0x40, 0x3d, 0x07, 0xc0, 0xbc, 0x03,
+    0xe0, 0xf5, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 12 */
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00,  //............
-    0x3c, 0x00, 0x3c,  //.@@......@@.
-    0x2d, 0x00, 0x78,  //.%@+....+@%.
-    0x0f, 0x00, 0xf0,  //..@@....@@..
-    0x0b, 0x41, 0xf0,  //..%@+..+@@..
-    0x03, 0xc3, 0xd0,  //...@@..@@+..
-    0x03, 0xd3, 0xc0,  //...@@+.@@...
-    0x01, 0xeb, 0x40,  //...+@%%@+...
-    0x00, 0xff, 0x00,  //....@@@@....
-    0x00, 0x7d, 0x00,  //....+@@+....
-    0x00, 0x3c, 0x00,  //.....@@.....
-    0x00, 0x78, 0x00,  //....+@%.....
-    0x00, 0xb0, 0x00,  //....%@......
-    0x0f, 0xe0, 0x00,  //..@@@%......
-    0x0f, 0x80, 0x00,  //..@@%.......
-
+    0xef, 0x00, 0x29, 0x3c, 0x00, 0x3c, 0x2d, 0x00, 0x78, 0x0f, 0x00, 0xf0, 0x0b, 0x41, 0xf0, 0x03,
+    0xc3, 0xd0, 0x03, 0xd3, 0xc0, 0x01, 0xeb, 0x40, 0x00, 0xff, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0xb0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0x80, 0x00,
 
     /*Unicode: U+007a (z) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x7c,  //....+@@.
-    0x00, 0xf4,  //....@@+.
-    0x03, 0xf0,  //...@@@..
-    0x0b, 0xc0,  //..%@@...
-    0x1f, 0x40,  //.+@@+...
-    0x3e, 0x00,  //.@@%....
-    0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-
+    0xf5, 0x00, 0xfd, 0xff, 0x0b, 0x00, 0x7c, 0x00, 0xf4, 0x03, 0xf0, 0x0b, 0xc0, 0x1f, 0x40, 0x3e,
+    0x00, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+007b ({) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0x00, 0xbf,  //....%@@@
-    0x02, 0xff,  //...%@@@@
-    0x03, 0xd0,  //...@@+..
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x0b, 0xc0,  //..%@@...
-    0xff, 0x00,  //@@@@....
-    0xff, 0x00,  //@@@@....
-    0x0b, 0x80,  //..%@%...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xd0,  //...@@+..
-    0x02, 0xff,  //...%@@@@
-    0x00, 0xbf,  //....%@@@
-    0x00, 0x00,  //........
-
+    0xfc, 0x00, 0x22, 0xbf, 0x02, 0xff, 0x03, 0xd0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x0b, 0xc0,
+    0xff, 0x00, 0xff, 0x00, 0x0b, 0x80, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xd0,
+    0x02, 0xff, 0x00, 0xbf, 0x00, 0x00,
 
     /*Unicode: U+007c (|) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-    0xf0,  //@@
-
+    0x01, 0x00, 0x00, 0xef, 0xf0,
 
     /*Unicode: U+007d (}) , Width: 8 */
-    0x00, 0x00,  //........
-    0x00, 0x00,  //........
-    0xfe, 0x00,  //@@@%....
-    0xff, 0x80,  //@@@@%...
-    0x07, 0xc0,  //..+@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xe0,  //...@@%..
-    0x00, 0xff,  //....@@@@
-    0x00, 0xff,  //....@@@@
-    0x02, 0xe0,  //...%@%..
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x03, 0xc0,  //...@@...
-    0x07, 0xc0,  //..+@@...
-    0xff, 0x80,  //@@@@%...
-    0xfe, 0x00,  //@@@%....
-    0x00, 0x00,  //........
-
+    0xfd, 0x00, 0x20, 0xfe, 0x00, 0xff, 0x80, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xe0, 0x00, 0xff, 0x00, 0xff, 0x02, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07,
+    0xc0, 0xff, 0x80, 0xfe, 0xfe, 0x00,
 
     /*Unicode: U+007e (~) , Width: 11 */
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x2f, 0xe0, 0x1c,  //.%@@@%...+@
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-    0xd0, 0x6f, 0xe0,  //@+...%@@@%.
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00,  //...........
-
-
+    0xe9, 0x00, 0x08, 0x2f, 0xe0, 0x1c, 0xff, 0xff, 0xfc, 0xd0, 0x6f, 0xe0, 0xe6, 0x00,
 
 #elif USE_LV_FONT_DEJAVU_20 == 4
     /*Unicode: U+0020 ( ) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xc5, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xee,  //@@
-    0xdd,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xfa, 0xff, 0x05, 0xee, 0xdd, 0x00, 0x00, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0022 (") , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0xff, 0x00, 0xff,  //@@..@@
-    0xff, 0x00, 0xff,  //@@..@@
-    0xff, 0x00, 0xff,  //@@..@@
-    0xff, 0x00, 0xff,  //@@..@@
-    0xff, 0x00, 0xff,  //@@..@@
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xf8, 0x00, 0x0e, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0xdd, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x2f, 0x30, 0x4f, 0x10,  //.....@..+@..
-    0x00, 0x00, 0x6f, 0x00, 0x7d, 0x00,  //....+@..+@..
-    0x00, 0x00, 0x9c, 0x00, 0xba, 0x00,  //....%@..%%..
-    0x00, 0x00, 0xd8, 0x00, 0xe6, 0x00,  //....@%..@+..
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x00, 0x07, 0xe0, 0x09, 0xd0, 0x00,  //...+@..%@...
-    0x00, 0x0c, 0x90, 0x0e, 0x70, 0x00,  //...@%..@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-    0x00, 0x6f, 0x00, 0x8d, 0x00, 0x00,  //..+@..%@....
-    0x00, 0xab, 0x00, 0xb9, 0x00, 0x00,  //..%%..%%....
-    0x00, 0xd8, 0x00, 0xf6, 0x00, 0x00,  //..@%..@+....
-    0x01, 0xf4, 0x02, 0xf2, 0x00, 0x00,  //..@+..@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xf3, 0x00, 0x08, 0x2f, 0x30, 0x4f, 0x10, 0x00, 0x00, 0x6f, 0x00, 0x7d, 0xfe, 0x00, 0x02, 0x9c,
+    0x00, 0xba, 0xfe, 0x00, 0x04, 0xd8, 0x00, 0xe6, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0x0f, 0xfc, 0xff,
+    0x0b, 0x00, 0x07, 0xe0, 0x09, 0xd0, 0x00, 0x00, 0x0c, 0x90, 0x0e, 0x70, 0x00, 0xfc, 0xff, 0x00,
+    0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x6f, 0x00, 0x8d, 0xfe, 0x00, 0x02, 0xab, 0x00, 0xb9, 0xfe,
+    0x00, 0x08, 0xd8, 0x00, 0xf6, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xf2, 0xe7, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-    0x04, 0xbe, 0xfe, 0xa3, 0x00,  //.+%@@@%..
-    0x6f, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-    0xef, 0x91, 0xf1, 0x5c, 0x00,  //@@%.@.+@.
-    0xff, 0x10, 0xf0, 0x00, 0x00,  //@@..@....
-    0xbf, 0xd8, 0xf2, 0x00, 0x00,  //%@@%@....
-    0x1c, 0xff, 0xff, 0xd6, 0x00,  //.@@@@@@+.
-    0x00, 0x37, 0xfe, 0xff, 0x60,  //...+@@@@+
-    0x00, 0x00, 0xf0, 0x6f, 0xd0,  //....@.+@@
-    0x00, 0x00, 0xf0, 0x0f, 0xf0,  //....@..@@
-    0xc6, 0x10, 0xf1, 0x9f, 0xe0,  //@+..@.%@@
-    0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@+
-    0x28, 0xce, 0xfe, 0xb4, 0x00,  //.%@@@@%+.
-    0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf5, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x04, 0xbe, 0xfe, 0xa3, 0x00, 0x6f,
+    0xfe, 0xff, 0x28, 0x00, 0xef, 0x91, 0xf1, 0x5c, 0x00, 0xff, 0x10, 0xf0, 0x00, 0x00, 0xbf, 0xd8,
+    0xf2, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x37, 0xfe, 0xff, 0x60, 0x00, 0x00, 0xf0,
+    0x6f, 0xd0, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0xc6, 0x10, 0xf1, 0x9f, 0xe0, 0xfd, 0xff, 0x04, 0x60,
+    0x28, 0xce, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0,
+    0xfa, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x08, 0xee, 0x80, 0x00, 0x00, 0x4d, 0x00, 0x00,  //.%@@%.....+@...
-    0x7f, 0x66, 0xf7, 0x00, 0x00, 0xe3, 0x00, 0x00,  //+@++@+....@....
-    0xdf, 0x11, 0xfd, 0x00, 0x09, 0x90, 0x00, 0x00,  //@@..@@...%%....
-    0xff, 0x00, 0xff, 0x00, 0x3e, 0x00, 0x00, 0x00,  //@@..@@...@.....
-    0xdf, 0x11, 0xfd, 0x00, 0xc5, 0x00, 0x00, 0x00,  //@@..@@..@+.....
-    0x8f, 0x66, 0xf7, 0x07, 0xb0, 0x00, 0x00, 0x00,  //+@++@+.+%......
-    0x08, 0xee, 0x80, 0x1e, 0x10, 0x8e, 0xe8, 0x00,  //.%@@%..@..%@@%.
-    0x00, 0x00, 0x00, 0xb7, 0x07, 0xf6, 0x6f, 0x70,  //......%+.+@++@+
-    0x00, 0x00, 0x05, 0xc0, 0x0d, 0xf1, 0x1f, 0xd0,  //.....+@..@@..@@
-    0x00, 0x00, 0x0e, 0x30, 0x0f, 0xf0, 0x0f, 0xf0,  //.....@...@@..@@
-    0x00, 0x00, 0x99, 0x00, 0x0d, 0xf1, 0x1f, 0xd0,  //....%%...@@..@@
-    0x00, 0x03, 0xe0, 0x00, 0x07, 0xf6, 0x6f, 0x70,  //....@....+@++@+
-    0x00, 0x0d, 0x40, 0x00, 0x00, 0x8e, 0xe8, 0x00,  //...@+.....%@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xe9, 0x00, 0x1c, 0x08, 0xee, 0x80, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x7f, 0x66, 0xf7, 0x00, 0x00,
+    0xe3, 0x00, 0x00, 0xdf, 0x11, 0xfd, 0x00, 0x09, 0x90, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x3e,
+    0xfe, 0x00, 0x04, 0xdf, 0x11, 0xfd, 0x00, 0xc5, 0xfe, 0x00, 0x04, 0x8f, 0x66, 0xf7, 0x07, 0xb0,
+    0xfe, 0x00, 0x06, 0x08, 0xee, 0x80, 0x1e, 0x10, 0x8e, 0xe8, 0xfd, 0x00, 0x2b, 0xb7, 0x07, 0xf6,
+    0x6f, 0x70, 0x00, 0x00, 0x05, 0xc0, 0x0d, 0xf1, 0x1f, 0xd0, 0x00, 0x00, 0x0e, 0x30, 0x0f, 0xf0,
+    0x0f, 0xf0, 0x00, 0x00, 0x99, 0x00, 0x0d, 0xf1, 0x1f, 0xd0, 0x00, 0x03, 0xe0, 0x00, 0x07, 0xf6,
+    0x6f, 0x70, 0x00, 0x0d, 0x40, 0x00, 0x00, 0x8e, 0xe8, 0xe0, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x04, 0xcf, 0xeb, 0x40, 0x00,  //...+@@@%+...
-    0x00, 0x5f, 0xff, 0xff, 0xf0, 0x00,  //..+@@@@@@...
-    0x00, 0xdf, 0x70, 0x04, 0xc0, 0x00,  //..@@+..+%...
-    0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@@........
-    0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,  //..%@%.......
-    0x00, 0x9f, 0xf9, 0x00, 0x00, 0x00,  //..%@@%......
-    0x0b, 0xf8, 0xff, 0x90, 0x1f, 0xe0,  //.%@%@@%..@@.
-    0x8f, 0x50, 0x5f, 0xf9, 0x5f, 0x90,  //%@+.+@@%+@%.
-    0xef, 0x00, 0x04, 0xff, 0xef, 0x10,  //@@...+@@@@..
-    0xff, 0x40, 0x00, 0x6f, 0xf5, 0x00,  //@@+...+@@+..
-    0xaf, 0xe5, 0x10, 0x6f, 0xf9, 0x00,  //%@@+..+@@%..
-    0x1e, 0xff, 0xff, 0xfc, 0xff, 0x80,  //.@@@@@@@@@%.
-    0x01, 0x8d, 0xfe, 0x90, 0x5f, 0xf8,  //..%@@@%.+@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xee, 0x00, 0x12, 0x04, 0xcf, 0xeb, 0x40, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xdf,
+    0x70, 0x04, 0xc0, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x01, 0xbf, 0x80, 0xfd, 0x00, 0x01, 0x9f, 0xf9,
+    0xfe, 0x00, 0x29, 0x0b, 0xf8, 0xff, 0x90, 0x1f, 0xe0, 0x8f, 0x50, 0x5f, 0xf9, 0x5f, 0x90, 0xef,
+    0x00, 0x04, 0xff, 0xef, 0x10, 0xff, 0x40, 0x00, 0x6f, 0xf5, 0x00, 0xaf, 0xe5, 0x10, 0x6f, 0xf9,
+    0x00, 0x1e, 0xff, 0xff, 0xfc, 0xff, 0x80, 0x01, 0x8d, 0xfe, 0x90, 0x5f, 0xf8, 0xe9, 0x00,
 
     /*Unicode: U+0027 (') , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xfc, 0xff, 0xf5, 0x00,
 
     /*Unicode: U+0028 (() , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x8c,  //..%@
-    0x02, 0xf5,  //..@+
-    0x0a, 0xe0,  //.%@.
-    0x1f, 0xa0,  //.@%.
-    0x6f, 0x60,  //+@+.
-    0xbf, 0x30,  //%@..
-    0xdf, 0x10,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xdf, 0x10,  //@@..
-    0xbf, 0x30,  //%@..
-    0x6f, 0x60,  //+@+.
-    0x1f, 0xa0,  //.@%.
-    0x0a, 0xf0,  //.%@.
-    0x02, 0xf5,  //..@+
-    0x00, 0x8c,  //..%@
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0xfc, 0x00, 0x1e, 0x8c, 0x02, 0xf5, 0x0a, 0xe0, 0x1f, 0xa0, 0x6f, 0x60, 0xbf, 0x30, 0xdf, 0x10,
+    0xff, 0x00, 0xff, 0x00, 0xdf, 0x10, 0xbf, 0x30, 0x6f, 0x60, 0x1f, 0xa0, 0x0a, 0xf0, 0x02, 0xf5,
+    0x00, 0x8c, 0xfd, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0xc8, 0x00,  //@%..
-    0x5f, 0x20,  //+@..
-    0x0f, 0xa0,  //.@%.
-    0x0a, 0xf1,  //.%@.
-    0x06, 0xf6,  //.+@+
-    0x03, 0xfa,  //..@%
-    0x01, 0xfd,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x01, 0xfd,  //..@@
-    0x03, 0xfa,  //..@%
-    0x06, 0xf6,  //.+@+
-    0x0a, 0xf1,  //.%@.
-    0x0f, 0xa0,  //.@%.
-    0x5f, 0x20,  //+@..
-    0xc8, 0x00,  //@%..
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0xfd, 0x00, 0x1e, 0xc8, 0x00, 0x5f, 0x20, 0x0f, 0xa0, 0x0a, 0xf1, 0x06, 0xf6, 0x03, 0xfa, 0x01,
+    0xfd, 0x00, 0xff, 0x00, 0xff, 0x01, 0xfd, 0x03, 0xfa, 0x06, 0xf6, 0x0a, 0xf1, 0x0f, 0xa0, 0x5f,
+    0x20, 0xc8, 0xfc, 0x00,
 
     /*Unicode: U+002a (*) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x0f, 0x00, 0x00,  //...@...
-    0xa2, 0x0f, 0x02, 0xa0,  //%..@..%
-    0x5e, 0x5f, 0x5e, 0x50,  //+@+@+@+
-    0x02, 0xcf, 0xc2, 0x00,  //..@@@..
-    0x02, 0xcf, 0xc2, 0x00,  //..@@@..
-    0x5e, 0x5f, 0x5e, 0x50,  //+@+@+@+
-    0xa2, 0x0f, 0x02, 0xa0,  //%..@..%
-    0x00, 0x0f, 0x00, 0x00,  //...@...
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xf4, 0x00, 0x1c, 0x0f, 0x00, 0x00, 0xa2, 0x0f, 0x02, 0xa0, 0x5e, 0x5f, 0x5e, 0x50, 0x02, 0xcf,
+    0xc2, 0x00, 0x02, 0xcf, 0xc2, 0x00, 0x5e, 0x5f, 0x5e, 0x50, 0xa2, 0x0f, 0x02, 0xa0, 0x00, 0x0f,
+    0xdb, 0x00,
 
     /*Unicode: U+002b (+) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xe7, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd,
+    0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x03, 0x0f, 0xf0, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00,
+    0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f,
+    0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xe7, 0x00,
 
     /*Unicode: U+002c (,) , Width: 3 */
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x0f, 0xf0,  //.@@
-    0x1f, 0xd0,  //.@@
-    0x6f, 0x20,  //+@.
-    0xc6, 0x00,  //@+.
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-
+    0xe5, 0x00, 0x06, 0x0f, 0xf0, 0x1f, 0xd0, 0x6f, 0x20, 0xc6, 0xfc, 0x00,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
+    0xe3, 0x00, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xe9, 0x00,
 
     /*Unicode: U+002e (.) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xf3, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+002f (/) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x03, 0xfd,  //....@@
-    0x00, 0x07, 0xf9,  //...+@%
-    0x00, 0x0b, 0xf5,  //...%@+
-    0x00, 0x0f, 0xf1,  //...@@.
-    0x00, 0x3f, 0xd0,  //...@@.
-    0x00, 0x8f, 0x90,  //..+@%.
-    0x00, 0xcf, 0x40,  //..@@+.
-    0x00, 0xff, 0x00,  //..@@..
-    0x04, 0xfc, 0x00,  //.+@@..
-    0x08, 0xf8, 0x00,  //.%@%..
-    0x0d, 0xf4, 0x00,  //.@@+..
-    0x1f, 0xf0, 0x00,  //.@@...
-    0x5f, 0xb0, 0x00,  //+@%...
-    0x9f, 0x70, 0x00,  //%@+...
-    0xdf, 0x30, 0x00,  //@@....
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xf7, 0x00, 0x2a, 0x03, 0xfd, 0x00, 0x07, 0xf9, 0x00, 0x0b, 0xf5, 0x00, 0x0f, 0xf1, 0x00, 0x3f,
+    0xd0, 0x00, 0x8f, 0x90, 0x00, 0xcf, 0x40, 0x00, 0xff, 0x00, 0x04, 0xfc, 0x00, 0x08, 0xf8, 0x00,
+    0x0d, 0xf4, 0x00, 0x1f, 0xf0, 0x00, 0x5f, 0xb0, 0x00, 0x9f, 0x70, 0x00, 0xdf, 0x30, 0xfa, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x7d, 0xfd, 0x70, 0x00,  //..+@@@+..
-    0x0a, 0xff, 0xff, 0xfa, 0x00,  //.%@@@@@%.
-    0x4f, 0xf4, 0x04, 0xff, 0x40,  //+@@+.+@@+
-    0xaf, 0x70, 0x00, 0x7f, 0xa0,  //%@+...+@%
-    0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-    0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-    0xaf, 0x70, 0x00, 0x7f, 0xa0,  //%@+...+@%
-    0x4f, 0xf4, 0x04, 0xff, 0x40,  //+@@+.+@@+
-    0x0a, 0xff, 0xff, 0xfa, 0x00,  //.%@@@@@%.
-    0x00, 0x8d, 0xfd, 0x80, 0x00,  //..+@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf1, 0x00, 0x3e, 0x7d, 0xfd, 0x70, 0x00, 0x0a, 0xff, 0xff, 0xfa, 0x00, 0x4f, 0xf4, 0x04, 0xff,
+    0x40, 0xaf, 0x70, 0x00, 0x7f, 0xa0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+    0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf,
+    0x70, 0x00, 0x7f, 0xa0, 0x4f, 0xf4, 0x04, 0xff, 0x40, 0x0a, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x8d,
+    0xfd, 0x80, 0xec, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x27, 0xcf, 0xf0, 0x00,  //.+@@@...
-    0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-    0xd7, 0x2f, 0xf0, 0x00,  //@+.@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x2b, 0x27, 0xcf, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xd7, 0x2f, 0xf0, 0x00, 0x00,
+    0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+    0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9,
+    0xff, 0xf1, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x39, 0xdf, 0xea, 0x30, 0x00,  //.%@@@%...
-    0xff, 0xff, 0xff, 0xf5, 0x00,  //@@@@@@@+.
-    0xc5, 0x10, 0x2c, 0xfd, 0x00,  //@+...@@@.
-    0x00, 0x00, 0x02, 0xff, 0x00,  //......@@.
-    0x00, 0x00, 0x01, 0xfd, 0x00,  //......@@.
-    0x00, 0x00, 0x08, 0xf7, 0x00,  //.....%@+.
-    0x00, 0x00, 0x5f, 0xd0, 0x00,  //....+@@..
-    0x00, 0x05, 0xff, 0x20, 0x00,  //...+@@...
-    0x00, 0x6f, 0xf4, 0x00, 0x00,  //..+@@+...
-    0x06, 0xff, 0x60, 0x00, 0x00,  //.+@@+....
-    0x7f, 0xf6, 0x00, 0x00, 0x00,  //+@@+.....
-    0xff, 0xff, 0xff, 0xff, 0x10,  //@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x10,  //@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x04, 0x39, 0xdf, 0xea, 0x30, 0x00, 0xfe, 0xff, 0x05, 0xf5, 0x00, 0xc5, 0x10, 0x2c,
+    0xfd, 0xfe, 0x00, 0x01, 0x02, 0xff, 0xfe, 0x00, 0x01, 0x01, 0xfd, 0xfe, 0x00, 0x01, 0x08, 0xf7,
+    0xfe, 0x00, 0x13, 0x5f, 0xd0, 0x00, 0x00, 0x05, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xf4, 0x00, 0x00,
+    0x06, 0xff, 0x60, 0x00, 0x00, 0x7f, 0xf6, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0x10, 0xfd, 0xff, 0x00,
+    0x10, 0xed, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x38, 0xdf, 0xfd, 0x92, 0x00,  //.%@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0x50,  //@@@@@@@@+
-    0xc6, 0x20, 0x03, 0xaf, 0xd0,  //@+....%@@
-    0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-    0x00, 0x00, 0x02, 0xaf, 0x90,  //......%@%
-    0x00, 0xff, 0xff, 0xd7, 0x00,  //..@@@@@+.
-    0x00, 0xff, 0xff, 0xf8, 0x00,  //..@@@@@%.
-    0x00, 0x00, 0x14, 0xcf, 0x80,  //.....+@@%
-    0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-    0x00, 0x00, 0x00, 0x2f, 0xf0,  //.......@@
-    0xb4, 0x10, 0x14, 0xdf, 0xb0,  //%+...+@@%
-    0xff, 0xff, 0xff, 0xfe, 0x20,  //@@@@@@@@.
-    0x39, 0xdf, 0xfd, 0x81, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x04, 0x38, 0xdf, 0xfd, 0x92, 0x00, 0xfd, 0xff, 0x05, 0x50, 0xc6, 0x20, 0x03, 0xaf,
+    0xd0, 0xfe, 0x00, 0x0f, 0x1f, 0xe0, 0x00, 0x00, 0x02, 0xaf, 0x90, 0x00, 0xff, 0xff, 0xd7, 0x00,
+    0x00, 0xff, 0xff, 0xf8, 0xfe, 0x00, 0x02, 0x14, 0xcf, 0x80, 0xfe, 0x00, 0x01, 0x1f, 0xe0, 0xfe,
+    0x00, 0x06, 0x2f, 0xf0, 0xb4, 0x10, 0x14, 0xdf, 0xb0, 0xfe, 0xff, 0x05, 0xfe, 0x20, 0x39, 0xdf,
+    0xfd, 0x81, 0xec, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x0a, 0xff, 0x00,  //.....%@@..
-    0x00, 0x00, 0x5f, 0xff, 0x00,  //....+@@@..
-    0x00, 0x01, 0xe7, 0xff, 0x00,  //....@+@@..
-    0x00, 0x0b, 0xc0, 0xff, 0x00,  //...%@.@@..
-    0x00, 0x6f, 0x20, 0xff, 0x00,  //..+@..@@..
-    0x02, 0xf7, 0x00, 0xff, 0x00,  //..@+..@@..
-    0x0c, 0xc0, 0x00, 0xff, 0x00,  //.@@...@@..
-    0x7f, 0x20, 0x00, 0xff, 0x00,  //+@....@@..
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0xff, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0xff, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xf0, 0x00, 0x01, 0x0a, 0xff, 0xfe, 0x00, 0x20, 0x5f, 0xff, 0x00, 0x00, 0x01, 0xe7, 0xff, 0x00,
+    0x00, 0x0b, 0xc0, 0xff, 0x00, 0x00, 0x6f, 0x20, 0xff, 0x00, 0x02, 0xf7, 0x00, 0xff, 0x00, 0x0c,
+    0xc0, 0x00, 0xff, 0x00, 0x7f, 0x20, 0x00, 0xff, 0x00, 0xf7, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd,
+    0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xec, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x0f, 0xff, 0xff, 0xf0,  //.@@@@@@.
-    0x0f, 0xff, 0xff, 0xf0,  //.@@@@@@.
-    0x0f, 0xf0, 0x00, 0x00,  //.@@.....
-    0x0f, 0xf0, 0x00, 0x00,  //.@@.....
-    0x0f, 0xfd, 0xfc, 0x30,  //.@@@@@..
-    0x0f, 0xff, 0xff, 0xf2,  //.@@@@@@.
-    0x0a, 0x20, 0x3d, 0xfa,  //.%...@@%
-    0x00, 0x00, 0x03, 0xfe,  //......@@
-    0x00, 0x00, 0x00, 0xff,  //......@@
-    0x00, 0x00, 0x03, 0xfe,  //......@@
-    0xb4, 0x00, 0x4e, 0xf9,  //%...+@@%
-    0xff, 0xff, 0xff, 0xe1,  //@@@@@@@.
-    0x4a, 0xef, 0xd9, 0x10,  //.%@@@%..
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x1f, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+    0xf0, 0x00, 0x00, 0x0f, 0xfd, 0xfc, 0x30, 0x0f, 0xff, 0xff, 0xf2, 0x0a, 0x20, 0x3d, 0xfa, 0x00,
+    0x00, 0x03, 0xfe, 0xfe, 0x00, 0x08, 0xff, 0x00, 0x00, 0x03, 0xfe, 0xb4, 0x00, 0x4e, 0xf9, 0xfe,
+    0xff, 0x04, 0xe1, 0x4a, 0xef, 0xd9, 0x10, 0xf1, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x3a, 0xef, 0xc4, 0x00,  //...%@@@+.
-    0x04, 0xff, 0xff, 0xff, 0x00,  //.+@@@@@@.
-    0x1e, 0xfb, 0x20, 0x3b, 0x00,  //.@@%...%.
-    0x8f, 0xd0, 0x00, 0x00, 0x00,  //+@@......
-    0xcf, 0x60, 0x00, 0x00, 0x00,  //@@+......
-    0xef, 0x39, 0xef, 0xb3, 0x00,  //@@.%@@%..
-    0xff, 0xaf, 0xff, 0xff, 0x30,  //@@%@@@@@.
-    0xff, 0xb2, 0x02, 0xbf, 0xb0,  //@@%...%@%
-    0xdf, 0x10, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xaf, 0x10, 0x00, 0x1f, 0xf0,  //%@.....@@
-    0x4f, 0xb2, 0x02, 0xbf, 0xb0,  //+@%...%@%
-    0x0a, 0xff, 0xff, 0xff, 0x30,  //.%@@@@@@.
-    0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf1, 0x00, 0x04, 0x3a, 0xef, 0xc4, 0x00, 0x04, 0xfe, 0xff, 0x07, 0x00, 0x1e, 0xfb, 0x20, 0x3b,
+    0x00, 0x8f, 0xd0, 0xfe, 0x00, 0x01, 0xcf, 0x60, 0xfe, 0x00, 0x1e, 0xef, 0x39, 0xef, 0xb3, 0x00,
+    0xff, 0xaf, 0xff, 0xff, 0x30, 0xff, 0xb2, 0x02, 0xbf, 0xb0, 0xdf, 0x10, 0x00, 0x1f, 0xf0, 0xaf,
+    0x10, 0x00, 0x1f, 0xf0, 0x4f, 0xb2, 0x02, 0xbf, 0xb0, 0x0a, 0xfe, 0xff, 0x04, 0x30, 0x00, 0x7d,
+    0xfe, 0xa2, 0xec, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@
-    0x00, 0x00, 0x0a, 0xf7,  //.....%@+
-    0x00, 0x00, 0x0f, 0xf2,  //.....@@.
-    0x00, 0x00, 0x4f, 0xd0,  //....+@@.
-    0x00, 0x00, 0x9f, 0x70,  //....%@+.
-    0x00, 0x00, 0xef, 0x20,  //....@@..
-    0x00, 0x03, 0xfd, 0x00,  //....@@..
-    0x00, 0x09, 0xf8, 0x00,  //...%@%..
-    0x00, 0x0e, 0xf3, 0x00,  //...@@...
-    0x00, 0x3f, 0xe0, 0x00,  //...@@...
-    0x00, 0x8f, 0x90, 0x00,  //..%@%...
-    0x00, 0xdf, 0x40, 0x00,  //..@@+...
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0xfa, 0xff, 0x2b, 0xfc, 0x00, 0x00, 0x0a, 0xf7, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00,
+    0x4f, 0xd0, 0x00, 0x00, 0x9f, 0x70, 0x00, 0x00, 0xef, 0x20, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x09,
+    0xf8, 0x00, 0x00, 0x0e, 0xf3, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0xdf,
+    0x40, 0xf0, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x04, 0xbe, 0xfe, 0xb4, 0x00,  //.+%@@@%+.
-    0x6f, 0xff, 0xff, 0xff, 0x60,  //+@@@@@@@+
-    0xef, 0x91, 0x01, 0x9f, 0xe0,  //@@%...%@@
-    0xef, 0x00, 0x00, 0x1f, 0xe0,  //@@.....@@
-    0x9f, 0x91, 0x01, 0x9f, 0x90,  //%@%...%@%
-    0x07, 0xef, 0xff, 0xe7, 0x00,  //.+@@@@@+.
-    0x08, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@%.
-    0x8f, 0xb2, 0x02, 0xbf, 0x80,  //%@%...%@%
-    0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-    0xff, 0x10, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xcf, 0xb2, 0x02, 0xbf, 0xc0,  //@@%...%@@
-    0x4f, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@+
-    0x02, 0xad, 0xfe, 0xb3, 0x00,  //..%@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x05, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x6f, 0xfe, 0xff, 0x2e, 0x60, 0xef, 0x91, 0x01,
+    0x9f, 0xe0, 0xef, 0x00, 0x00, 0x1f, 0xe0, 0x9f, 0x91, 0x01, 0x9f, 0x90, 0x07, 0xef, 0xff, 0xe7,
+    0x00, 0x08, 0xff, 0xff, 0xf8, 0x00, 0x8f, 0xb2, 0x02, 0xbf, 0x80, 0xef, 0x10, 0x00, 0x1f, 0xe0,
+    0xff, 0x10, 0x00, 0x1f, 0xf0, 0xcf, 0xb2, 0x02, 0xbf, 0xc0, 0x4f, 0xfe, 0xff, 0x04, 0x40, 0x02,
+    0xad, 0xfe, 0xb3, 0xec, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x02, 0xae, 0xfd, 0x70, 0x00,  //..%@@@+..
-    0x3f, 0xff, 0xff, 0xf9, 0x00,  //.@@@@@@%.
-    0xbf, 0xb2, 0x02, 0xbf, 0x30,  //%@%...%@.
-    0xff, 0x10, 0x00, 0x1f, 0x90,  //@@.....@%
-    0xff, 0x10, 0x00, 0x1f, 0xd0,  //@@.....@@
-    0xcf, 0xb2, 0x02, 0xbf, 0xf0,  //%@%...%@@
-    0x4f, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x03, 0xbf, 0xe9, 0x3f, 0xe0,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x6f, 0xc0,  //......+@@
-    0x00, 0x00, 0x00, 0xdf, 0x70,  //......@@+
-    0x0b, 0x30, 0x2b, 0xfe, 0x10,  //.%...%@@.
-    0x0f, 0xff, 0xff, 0xf4, 0x00,  //.@@@@@@+.
-    0x04, 0xcf, 0xea, 0x30, 0x00,  //.+@@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x27, 0x02, 0xae, 0xfd, 0x70, 0x00, 0x3f, 0xff, 0xff, 0xf9, 0x00, 0xbf, 0xb2, 0x02,
+    0xbf, 0x30, 0xff, 0x10, 0x00, 0x1f, 0x90, 0xff, 0x10, 0x00, 0x1f, 0xd0, 0xcf, 0xb2, 0x02, 0xbf,
+    0xf0, 0x4f, 0xff, 0xff, 0xaf, 0xf0, 0x03, 0xbf, 0xe9, 0x3f, 0xe0, 0xfe, 0x00, 0x01, 0x6f, 0xc0,
+    0xfe, 0x00, 0x0f, 0xdf, 0x70, 0x0b, 0x30, 0x2b, 0xfe, 0x10, 0x0f, 0xff, 0xff, 0xf4, 0x00, 0x04,
+    0xcf, 0xea, 0x30, 0xec, 0x00,
 
     /*Unicode: U+003a (:) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfa, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+003b (;) , Width: 3 */
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x0f, 0xf0,  //.@@
-    0x0f, 0xf0,  //.@@
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x0f, 0xf0,  //.@@
-    0x1f, 0xd0,  //.@@
-    0x6f, 0x20,  //+@.
-    0xc6, 0x00,  //@+.
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-
+    0xf3, 0x00, 0x03, 0x0f, 0xf0, 0x0f, 0xf0, 0xf7, 0x00, 0x06, 0x0f, 0xf0, 0x1f, 0xd0, 0x6f, 0x20,
+    0xc6, 0xfc, 0x00,
 
     /*Unicode: U+003c (<) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x16, 0xc0,  //.........+@
-    0x00, 0x00, 0x00, 0x4a, 0xff, 0xf0,  //.......%@@@
-    0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50,  //....+@@@@%+
-    0x05, 0xbf, 0xff, 0xd7, 0x10, 0x00,  //.+%@@@@+...
-    0xef, 0xff, 0xa4, 0x00, 0x00, 0x00,  //@@@@%+.....
-    0xef, 0xff, 0xa4, 0x00, 0x00, 0x00,  //@@@@%+.....
-    0x05, 0xbf, 0xff, 0xd7, 0x10, 0x00,  //.+%@@@@+...
-    0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50,  //....+@@@@%+
-    0x00, 0x00, 0x00, 0x4a, 0xff, 0xf0,  //......+%@@@
-    0x00, 0x00, 0x00, 0x00, 0x16, 0xc0,  //.........+@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xd9, 0x00, 0x01, 0x16, 0xc0, 0xfe, 0x00, 0x11, 0x4a, 0xff, 0xf0, 0x00, 0x01, 0x7d, 0xff, 0xfb,
+    0x50, 0x05, 0xbf, 0xff, 0xd7, 0x10, 0x00, 0xef, 0xff, 0xa4, 0xfe, 0x00, 0x02, 0xef, 0xff, 0xa4,
+    0xfe, 0x00, 0x0b, 0x05, 0xbf, 0xff, 0xd7, 0x10, 0x00, 0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50, 0xfe,
+    0x00, 0x02, 0x4a, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0x16, 0xc0, 0xe9, 0x00,
 
     /*Unicode: U+003d (=) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xd7, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xf5, 0x00, 0xfc, 0xff, 0x00, 0xf0,
+    0xfc, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
     /*Unicode: U+003e (>) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.........
-    0xff, 0xfa, 0x40, 0x00, 0x00, 0x00,  //@@@%.......
-    0x5b, 0xff, 0xfd, 0x71, 0x00, 0x00,  //+%@@@@+....
-    0x00, 0x17, 0xdf, 0xff, 0xb5, 0x00,  //...+@@@@%+.
-    0x00, 0x00, 0x04, 0xaf, 0xff, 0xe0,  //.....+%@@@@
-    0x00, 0x00, 0x04, 0xaf, 0xff, 0xe0,  //.....+%@@@@
-    0x00, 0x17, 0xdf, 0xff, 0xb5, 0x00,  //...+@@@@%+.
-    0x5b, 0xff, 0xfd, 0x71, 0x00, 0x00,  //+%@@@@+....
-    0xff, 0xfa, 0x40, 0x00, 0x00, 0x00,  //@@@%+......
-    0xc6, 0x10, 0x00, 0x00, 0x00, 0x00,  //@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xdd, 0x00, 0x00, 0xc6, 0xfc, 0x00, 0x02, 0xff, 0xfa, 0x40, 0xfe, 0x00, 0x03, 0x5b, 0xff, 0xfd,
+    0x71, 0xfe, 0x00, 0x03, 0x17, 0xdf, 0xff, 0xb5, 0xfe, 0x00, 0x18, 0x04, 0xaf, 0xff, 0xe0, 0x00,
+    0x00, 0x04, 0xaf, 0xff, 0xe0, 0x00, 0x17, 0xdf, 0xff, 0xb5, 0x00, 0x5b, 0xff, 0xfd, 0x71, 0x00,
+    0x00, 0xff, 0xfa, 0x40, 0xfe, 0x00, 0x01, 0xc6, 0x10, 0xe5, 0x00,
 
     /*Unicode: U+003f (?) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x4a, 0xef, 0xd6, 0x00,  //.%@@@+.
-    0xff, 0xff, 0xff, 0x70,  //@@@@@@+
-    0xc4, 0x01, 0x9f, 0xd0,  //@+..%@@
-    0x00, 0x00, 0x0f, 0xf0,  //.....@@
-    0x00, 0x00, 0x4f, 0xa0,  //....+@%
-    0x00, 0x02, 0xed, 0x10,  //....@@.
-    0x00, 0x2e, 0xd1, 0x00,  //...@@..
-    0x00, 0xcf, 0x30, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xf5, 0x00, 0x03, 0x4a, 0xef, 0xd6, 0x00, 0xfe, 0xff, 0x1a, 0x70, 0xc4, 0x01, 0x9f, 0xd0, 0x00,
+    0x00, 0x0f, 0xf0, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x02, 0xed, 0x10, 0x00, 0x2e, 0xd1, 0x00, 0x00,
+    0xcf, 0x30, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xef, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 16 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x18, 0xce, 0xfe, 0xb6, 0x00, 0x00,  //.....%@@@@%+....
-    0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00,  //...%@@@@@@@@@+..
-    0x00, 0xbf, 0xf9, 0x30, 0x01, 0x5b, 0xff, 0x60,  //..%@@%....+%@@+.
-    0x09, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x6f, 0xf2,  //.%@@........+@@.
-    0x2f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfa,  //.@@..........+@%
-    0x9f, 0x90, 0x02, 0xce, 0x3f, 0xf0, 0x01, 0xfe,  //%@%...@@.@@...@@
-    0xdf, 0x30, 0x0b, 0xff, 0xcf, 0xf0, 0x00, 0xff,  //@@...%@@@@@...@@
-    0xff, 0x00, 0x0e, 0xf3, 0x3f, 0xf0, 0x05, 0xfc,  //@@...@@..@@..+@@
-    0xff, 0x00, 0x0e, 0xf3, 0x3f, 0xf1, 0x7f, 0xf5,  //@@...@@..@@.+@@+
-    0xdf, 0x20, 0x0b, 0xff, 0xcf, 0xff, 0xff, 0x60,  //@@...%@@@@@@@@+.
-    0x9f, 0x80, 0x02, 0xce, 0x3f, 0xeb, 0x71, 0x00,  //%@%...@@.@@%+...
-    0x4f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.............
-    0x0b, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@............
-    0x01, 0xdf, 0xf8, 0x20, 0x02, 0x8d, 0x20, 0x00,  //..@@@+....+@....
-    0x00, 0x1b, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x00,  //...%@@@@@@@@....
-    0x00, 0x00, 0x4a, 0xef, 0xeb, 0x50, 0x00, 0x00,  //....+%@@@%+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+    0xe7, 0x00, 0x03, 0x18, 0xce, 0xfe, 0xb6, 0xfe, 0x00, 0x00, 0x08, 0xfd, 0xff, 0x0c, 0xe4, 0x00,
+    0x00, 0xbf, 0xf9, 0x30, 0x01, 0x5b, 0xff, 0x60, 0x09, 0xfe, 0x30, 0xfe, 0x00, 0x03, 0x6f, 0xf2,
+    0x2f, 0xf3, 0xfd, 0x00, 0x33, 0x07, 0xfa, 0x9f, 0x90, 0x02, 0xce, 0x3f, 0xf0, 0x01, 0xfe, 0xdf,
+    0x30, 0x0b, 0xff, 0xcf, 0xf0, 0x00, 0xff, 0xff, 0x00, 0x0e, 0xf3, 0x3f, 0xf0, 0x05, 0xfc, 0xff,
+    0x00, 0x0e, 0xf3, 0x3f, 0xf1, 0x7f, 0xf5, 0xdf, 0x20, 0x0b, 0xff, 0xcf, 0xff, 0xff, 0x60, 0x9f,
+    0x80, 0x02, 0xce, 0x3f, 0xeb, 0x71, 0x00, 0x4f, 0xf2, 0xfb, 0x00, 0x02, 0x0b, 0xfd, 0x20, 0xfc,
+    0x00, 0x09, 0x01, 0xdf, 0xf8, 0x20, 0x02, 0x8d, 0x20, 0x00, 0x00, 0x1b, 0xfe, 0xff, 0x01, 0xfc,
+    0x10, 0xfe, 0x00, 0x03, 0x4a, 0xef, 0xeb, 0x50, 0xf7, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x0e, 0xe0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x5f, 0xf5, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0xcf, 0xfc, 0x00, 0x00,  //....@@@@....
-    0x00, 0x02, 0xfc, 0xcf, 0x20, 0x00,  //....@@@@....
-    0x00, 0x09, 0xf6, 0x5f, 0x90, 0x00,  //...%@++@%...
-    0x00, 0x0e, 0xf0, 0x0e, 0xe0, 0x00,  //...@@..@@...
-    0x00, 0x5f, 0xa0, 0x08, 0xf6, 0x00,  //..+@%..%@+..
-    0x00, 0xcf, 0x30, 0x02, 0xfc, 0x00,  //..@@....@@..
-    0x02, 0xff, 0xff, 0xff, 0xff, 0x20,  //..@@@@@@@@..
-    0x09, 0xff, 0xff, 0xff, 0xff, 0x90,  //.%@@@@@@@@%.
-    0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0,  //.@@......@@.
-    0x6f, 0xb0, 0x00, 0x00, 0x0b, 0xf6,  //+@%......%@+
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc,  //@@+......+@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xed, 0x00, 0x01, 0x0e, 0xe0, 0xfd, 0x00, 0x01, 0x5f, 0xf5, 0xfd, 0x00, 0x01, 0xcf, 0xfc, 0xfe,
+    0x00, 0x1d, 0x02, 0xfc, 0xcf, 0x20, 0x00, 0x00, 0x09, 0xf6, 0x5f, 0x90, 0x00, 0x00, 0x0e, 0xf0,
+    0x0e, 0xe0, 0x00, 0x00, 0x5f, 0xa0, 0x08, 0xf6, 0x00, 0x00, 0xcf, 0x30, 0x02, 0xfc, 0x00, 0x02,
+    0xfd, 0xff, 0x01, 0x20, 0x09, 0xfd, 0xff, 0x12, 0x90, 0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0, 0x6f,
+    0xb0, 0x00, 0x00, 0x0b, 0xf6, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc, 0xe9, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0xfc, 0x60, 0x00,  //@@@@@@+..
-    0xff, 0xff, 0xff, 0xf8, 0x00,  //@@@@@@@%.
-    0xff, 0x00, 0x07, 0xfe, 0x00,  //@@...+@@.
-    0xff, 0x00, 0x00, 0xff, 0x00,  //@@....@@.
-    0xff, 0x00, 0x07, 0xfa, 0x00,  //@@...+@%.
-    0xff, 0xff, 0xff, 0x91, 0x00,  //@@@@@@%..
-    0xff, 0xff, 0xff, 0xd6, 0x00,  //@@@@@@@+.
-    0xff, 0x00, 0x02, 0xbf, 0x60,  //@@....%@+
-    0xff, 0x00, 0x00, 0x1f, 0xd0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x02, 0xbf, 0xc0,  //@@....%@@
-    0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+
-    0xff, 0xff, 0xfe, 0xa3, 0x00,  //@@@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x04, 0xff, 0xff, 0xfc, 0x60, 0x00, 0xfe, 0xff, 0x10, 0xf8, 0x00, 0xff, 0x00, 0x07,
+    0xfe, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x07, 0xfa, 0x00, 0xfe, 0xff, 0x01, 0x91,
+    0x00, 0xfe, 0xff, 0x15, 0xd6, 0x00, 0xff, 0x00, 0x02, 0xbf, 0x60, 0xff, 0x00, 0x00, 0x1f, 0xd0,
+    0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x02, 0xbf, 0xc0, 0xfd, 0xff, 0x04, 0x40, 0xff, 0xff,
+    0xfe, 0xa3, 0xec, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x05, 0xbe, 0xff, 0xd9, 0x30,  //...+%@@@@%.
-    0x01, 0xcf, 0xff, 0xff, 0xff, 0xf0,  //..@@@@@@@@@
-    0x0c, 0xfe, 0x61, 0x00, 0x26, 0xc0,  //.@@@+....+@
-    0x6f, 0xd1, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0xbf, 0x50, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0xef, 0x10, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xef, 0x10, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xbf, 0x50, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0x6f, 0xd1, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0x0c, 0xfe, 0x61, 0x00, 0x26, 0xc0,  //.@@@+....+@
-    0x01, 0xcf, 0xff, 0xff, 0xff, 0xf0,  //..@@@@@@@@@
-    0x00, 0x06, 0xbe, 0xff, 0xd9, 0x30,  //...+%@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xee, 0x00, 0x06, 0x05, 0xbe, 0xff, 0xd9, 0x30, 0x01, 0xcf, 0xfe, 0xff, 0x08, 0xf0, 0x0c, 0xfe,
+    0x61, 0x00, 0x26, 0xc0, 0x6f, 0xd1, 0xfd, 0x00, 0x01, 0xbf, 0x50, 0xfd, 0x00, 0x01, 0xef, 0x10,
+    0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x01, 0xef, 0x10, 0xfd, 0x00, 0x01, 0xbf, 0x50, 0xfd, 0x00,
+    0x01, 0x6f, 0xd1, 0xfd, 0x00, 0x07, 0x0c, 0xfe, 0x61, 0x00, 0x26, 0xc0, 0x01, 0xcf, 0xfe, 0xff,
+    0x06, 0xf0, 0x00, 0x06, 0xbe, 0xff, 0xd9, 0x30, 0xe9, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00,  //@@@@@@%+...
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x00,  //@@@@@@@@@..
-    0xff, 0x00, 0x01, 0x5d, 0xfe, 0x10,  //@@....+@@@.
-    0xff, 0x00, 0x00, 0x00, 0xdf, 0x70,  //@@......@@+
-    0xff, 0x00, 0x00, 0x00, 0x5f, 0xc0,  //@@......+@@
-    0xff, 0x00, 0x00, 0x00, 0x1f, 0xe0,  //@@.......@@
-    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,  //@@.......@@
-    0xff, 0x00, 0x00, 0x00, 0x1f, 0xe0,  //@@.......@@
-    0xff, 0x00, 0x00, 0x00, 0x5f, 0xc0,  //@@......+@@
-    0xff, 0x00, 0x00, 0x00, 0xdf, 0x70,  //@@......@@+
-    0xff, 0x00, 0x01, 0x5d, 0xfe, 0x10,  //@@....+@@@.
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x00,  //@@@@@@@@@..
-    0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00,  //@@@@@@%+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xef, 0x00, 0x05, 0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00, 0xfd, 0xff, 0x08, 0xe3, 0x00, 0xff, 0x00,
+    0x01, 0x5d, 0xfe, 0x10, 0xff, 0xfe, 0x00, 0x02, 0xdf, 0x70, 0xff, 0xfe, 0x00, 0x02, 0x5f, 0xc0,
+    0xff, 0xfe, 0x00, 0x02, 0x1f, 0xe0, 0xff, 0xfe, 0x00, 0x02, 0x0f, 0xf0, 0xff, 0xfe, 0x00, 0x02,
+    0x1f, 0xe0, 0xff, 0xfe, 0x00, 0x02, 0x5f, 0xc0, 0xff, 0xfe, 0x00, 0x07, 0xdf, 0x70, 0xff, 0x00,
+    0x01, 0x5d, 0xfe, 0x10, 0xfd, 0xff, 0x05, 0xe3, 0x00, 0xff, 0xff, 0xfe, 0xb6, 0xe7, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xf8, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xf9, 0xff,
+    0xf1, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xf0,  //@@@@@@@.
-    0xff, 0xff, 0xff, 0xf0,  //@@@@@@@.
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0xf8, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+    0x00, 0xf0, 0xfe, 0xff, 0x01, 0xf0, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe,
+    0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xee, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x06, 0xbe, 0xff, 0xc9, 0x30,  //...+%@@@@%.
-    0x02, 0xdf, 0xff, 0xff, 0xff, 0xf0,  //..@@@@@@@@@
-    0x0d, 0xfd, 0x51, 0x00, 0x26, 0xc0,  //.@@@+....+@
-    0x6f, 0xd0, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0xcf, 0x50, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0xef, 0x10, 0x00, 0xff, 0xff, 0xf0,  //@@....@@@@@
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xf0,  //@@....@@@@@
-    0xef, 0x10, 0x00, 0x00, 0x0f, 0xf0,  //@@.......@@
-    0xcf, 0x40, 0x00, 0x00, 0x0f, 0xf0,  //@@+......@@
-    0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf0,  //+@@......@@
-    0x0d, 0xfc, 0x40, 0x01, 0x6f, 0xf0,  //.@@@+...+@@
-    0x02, 0xef, 0xff, 0xff, 0xff, 0x60,  //..@@@@@@@@+
-    0x00, 0x07, 0xcf, 0xfd, 0x92, 0x00,  //...+@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xee, 0x00, 0x06, 0x06, 0xbe, 0xff, 0xc9, 0x30, 0x02, 0xdf, 0xfe, 0xff, 0x08, 0xf0, 0x0d, 0xfd,
+    0x51, 0x00, 0x26, 0xc0, 0x6f, 0xd0, 0xfd, 0x00, 0x01, 0xcf, 0x50, 0xfd, 0x00, 0x25, 0xef, 0x10,
+    0x00, 0xff, 0xff, 0xf0, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xef, 0x10, 0x00, 0x00, 0x0f, 0xf0,
+    0xcf, 0x40, 0x00, 0x00, 0x0f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x0f, 0xf0, 0x0d, 0xfc, 0x40, 0x01,
+    0x6f, 0xf0, 0x02, 0xef, 0xfe, 0xff, 0x05, 0x60, 0x00, 0x07, 0xcf, 0xfd, 0x92, 0xe8, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xf2, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf5, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff,
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xed, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0xfe, 0x00, 0xf4, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+004a (J) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x02, 0xfe,  //..@@
-    0x2b, 0xfa,  //.%@%
-    0xff, 0xf3,  //@@@.
-    0xfb, 0x30,  //@%..
-
+    0xfa, 0x00, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0xfe, 0x2b, 0xfa,
+    0xff, 0xf3, 0xfb, 0x30,
 
     /*Unicode: U+004b (K) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0x00, 0x00, 0x2e, 0xf7, 0x00,  //@@.....@@+.
-    0xff, 0x00, 0x02, 0xef, 0x60, 0x00,  //@@....@@+..
-    0xff, 0x00, 0x2e, 0xf6, 0x00, 0x00,  //@@...@@+...
-    0xff, 0x02, 0xef, 0x50, 0x00, 0x00,  //@@..@@+....
-    0xff, 0x3e, 0xf4, 0x00, 0x00, 0x00,  //@@.@@+.....
-    0xff, 0xef, 0x40, 0x00, 0x00, 0x00,  //@@@@+......
-    0xff, 0xfe, 0x20, 0x00, 0x00, 0x00,  //@@@@.......
-    0xff, 0x4f, 0xe2, 0x00, 0x00, 0x00,  //@@+@@......
-    0xff, 0x05, 0xfe, 0x30, 0x00, 0x00,  //@@.+@@.....
-    0xff, 0x00, 0x5f, 0xe3, 0x00, 0x00,  //@@..+@@....
-    0xff, 0x00, 0x06, 0xff, 0x30, 0x00,  //@@...+@@...
-    0xff, 0x00, 0x00, 0x6f, 0xf4, 0x00,  //@@....+@@..
-    0xff, 0x00, 0x00, 0x07, 0xff, 0x40,  //@@.....+@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xef, 0x00, 0x1a, 0xff, 0x00, 0x00, 0x2e, 0xf7, 0x00, 0xff, 0x00, 0x02, 0xef, 0x60, 0x00, 0xff,
+    0x00, 0x2e, 0xf6, 0x00, 0x00, 0xff, 0x02, 0xef, 0x50, 0x00, 0x00, 0xff, 0x3e, 0xf4, 0xfe, 0x00,
+    0x02, 0xff, 0xef, 0x40, 0xfe, 0x00, 0x02, 0xff, 0xfe, 0x20, 0xfe, 0x00, 0x02, 0xff, 0x4f, 0xe2,
+    0xfe, 0x00, 0x1d, 0xff, 0x05, 0xfe, 0x30, 0x00, 0x00, 0xff, 0x00, 0x5f, 0xe3, 0x00, 0x00, 0xff,
+    0x00, 0x06, 0xff, 0x30, 0x00, 0xff, 0x00, 0x00, 0x6f, 0xf4, 0x00, 0xff, 0x00, 0x00, 0x07, 0xff,
+    0x40, 0xe9, 0x00,
 
     /*Unicode: U+004c (L) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xf9, 0xff,
+    0xf1, 0x00,
 
     /*Unicode: U+004d (M) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xff, 0xf6, 0x00, 0x00, 0x4f, 0xff,  //@@@+....+@@@
-    0xff, 0xfc, 0x00, 0x00, 0xaf, 0xff,  //@@@%....%@@@
-    0xff, 0xaf, 0x20, 0x01, 0xfa, 0xff,  //@@%@....@%@@
-    0xff, 0x4f, 0x80, 0x07, 0xf4, 0xff,  //@@.@+..+@.@@
-    0xff, 0x0e, 0xd0, 0x0d, 0xd0, 0xff,  //@@.@@..@@.@@
-    0xff, 0x08, 0xf3, 0x3f, 0x80, 0xff,  //@@.%@..@+.@@
-    0xff, 0x02, 0xf9, 0x9f, 0x20, 0xff,  //@@..@%%@..@@
-    0xff, 0x00, 0xcf, 0xfc, 0x00, 0xff,  //@@..@@@@..@@
-    0xff, 0x00, 0x6f, 0xf6, 0x00, 0xff,  //@@..+@@+..@@
-    0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff,  //@@...@@...@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@@........@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@@........@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@@........@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xef, 0x00, 0x3c, 0xff, 0xf6, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xaf, 0xff, 0xff,
+    0xaf, 0x20, 0x01, 0xfa, 0xff, 0xff, 0x4f, 0x80, 0x07, 0xf4, 0xff, 0xff, 0x0e, 0xd0, 0x0d, 0xd0,
+    0xff, 0xff, 0x08, 0xf3, 0x3f, 0x80, 0xff, 0xff, 0x02, 0xf9, 0x9f, 0x20, 0xff, 0xff, 0x00, 0xcf,
+    0xfc, 0x00, 0xff, 0xff, 0x00, 0x6f, 0xf6, 0x00, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff,
+    0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xe9, 0x00,
 
     /*Unicode: U+004e (N) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0x80, 0x00, 0x00, 0xff,  //@@%.....@@
-    0xff, 0xf2, 0x00, 0x00, 0xff,  //@@@.....@@
-    0xff, 0xfb, 0x00, 0x00, 0xff,  //@@@%....@@
-    0xff, 0xbf, 0x40, 0x00, 0xff,  //@@%@+...@@
-    0xff, 0x2f, 0xd0, 0x00, 0xff,  //@@.@@...@@
-    0xff, 0x08, 0xf7, 0x00, 0xff,  //@@.%@+..@@
-    0xff, 0x01, 0xef, 0x10, 0xff,  //@@..@@..@@
-    0xff, 0x00, 0x6f, 0xa0, 0xff,  //@@..+@%.@@
-    0xff, 0x00, 0x0d, 0xf4, 0xff,  //@@...@@.@@
-    0xff, 0x00, 0x04, 0xfd, 0xff,  //@@...+@@@@
-    0xff, 0x00, 0x00, 0xaf, 0xff,  //@@....%@@@
-    0xff, 0x00, 0x00, 0x2f, 0xff,  //@@.....@@@
-    0xff, 0x00, 0x00, 0x08, 0xff,  //@@.....%@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xf2, 0x00, 0x40, 0xff, 0x80, 0x00, 0x00, 0xff, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00,
+    0x00, 0xff, 0xff, 0xbf, 0x40, 0x00, 0xff, 0xff, 0x2f, 0xd0, 0x00, 0xff, 0xff, 0x08, 0xf7, 0x00,
+    0xff, 0xff, 0x01, 0xef, 0x10, 0xff, 0xff, 0x00, 0x6f, 0xa0, 0xff, 0xff, 0x00, 0x0d, 0xf4, 0xff,
+    0xff, 0x00, 0x04, 0xfd, 0xff, 0xff, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x2f, 0xff, 0xff,
+    0x00, 0x00, 0x08, 0xff, 0xed, 0x00,
 
     /*Unicode: U+004f (O) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x07, 0xdf, 0xfd, 0x80, 0x00,  //...+@@@@+...
-    0x02, 0xef, 0xff, 0xff, 0xfe, 0x20,  //..@@@@@@@@..
-    0x0d, 0xfc, 0x40, 0x04, 0xcf, 0xd0,  //.@@@+..+@@@.
-    0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf6,  //+@@......@@+
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb,  //%@+......+@%
-    0xef, 0x10, 0x00, 0x00, 0x01, 0xfe,  //@@........@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@@........@@
-    0xef, 0x10, 0x00, 0x00, 0x01, 0xfe,  //@@........@@
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb,  //%@+......+@%
-    0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf6,  //+@@......@@+
-    0x0d, 0xfc, 0x40, 0x04, 0xcf, 0xd0,  //.@@@+..+@@@.
-    0x02, 0xef, 0xff, 0xff, 0xfe, 0x20,  //..@@@@@@@@..
-    0x00, 0x08, 0xdf, 0xfd, 0x80, 0x00,  //...+@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xee, 0x00, 0x23, 0x07, 0xdf, 0xfd, 0x80, 0x00, 0x02, 0xef, 0xff, 0xff, 0xfe, 0x20, 0x0d, 0xfc,
+    0x40, 0x04, 0xcf, 0xd0, 0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf6, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb,
+    0xef, 0x10, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xfd, 0x00, 0x23, 0xff, 0xef, 0x10, 0x00, 0x00, 0x01,
+    0xfe, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb, 0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf6, 0x0d, 0xfc, 0x40,
+    0x04, 0xcf, 0xd0, 0x02, 0xef, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x08, 0xdf, 0xfd, 0x80, 0xe8, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xfc, 0x40,  //@@@@@%+.
-    0xff, 0xff, 0xff, 0xf4,  //@@@@@@@+
-    0xff, 0x00, 0x1a, 0xfc,  //@@...%@@
-    0xff, 0x00, 0x01, 0xff,  //@@....@@
-    0xff, 0x00, 0x01, 0xff,  //@@....@@
-    0xff, 0x00, 0x1a, 0xfc,  //@@...%@@
-    0xff, 0xff, 0xff, 0xf4,  //@@@@@@@+
-    0xff, 0xff, 0xfc, 0x40,  //@@@@@@+.
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf5, 0x00, 0x03, 0xff, 0xff, 0xfc, 0x40, 0xfe, 0xff, 0x10, 0xf4, 0xff, 0x00, 0x1a, 0xfc, 0xff,
+    0x00, 0x01, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x1a, 0xfc, 0xfe, 0xff, 0x05, 0xf4, 0xff,
+    0xff, 0xfc, 0x40, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xee, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x07, 0xdf, 0xfd, 0x81, 0x00,  //...+@@@@%...
-    0x02, 0xef, 0xff, 0xff, 0xfe, 0x20,  //..@@@@@@@@..
-    0x0d, 0xfc, 0x40, 0x04, 0xcf, 0xd0,  //.@@@+..+@@@.
-    0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf7,  //+@@......@@+
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc,  //%@+......+@@
-    0xef, 0x10, 0x00, 0x00, 0x01, 0xfe,  //@@........@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@@........@@
-    0xef, 0x10, 0x00, 0x00, 0x01, 0xfd,  //@@........@@
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb,  //%@+......+@%
-    0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf4,  //+@@......@@+
-    0x0d, 0xfc, 0x40, 0x04, 0xcf, 0xa0,  //.@@@+..+@@%.
-    0x02, 0xef, 0xff, 0xff, 0xfa, 0x00,  //..@@@@@@@%..
-    0x00, 0x18, 0xdf, 0xff, 0xa0, 0x00,  //...%@@@@%...
-    0x00, 0x00, 0x00, 0x4f, 0xf6, 0x00,  //......+@@+..
-    0x00, 0x00, 0x00, 0x06, 0xff, 0x40,  //.......+@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xee, 0x00, 0x23, 0x07, 0xdf, 0xfd, 0x81, 0x00, 0x02, 0xef, 0xff, 0xff, 0xfe, 0x20, 0x0d, 0xfc,
+    0x40, 0x04, 0xcf, 0xd0, 0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf7, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc,
+    0xef, 0x10, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xfd, 0x00, 0x23, 0xff, 0xef, 0x10, 0x00, 0x00, 0x01,
+    0xfd, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfb, 0x6f, 0xd0, 0x00, 0x00, 0x0d, 0xf4, 0x0d, 0xfc, 0x40,
+    0x04, 0xcf, 0xa0, 0x02, 0xef, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x18, 0xdf, 0xff, 0xa0, 0xfd, 0x00,
+    0x01, 0x4f, 0xf6, 0xfd, 0x00, 0x02, 0x06, 0xff, 0x40, 0xf5, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0xff, 0xfc, 0x50, 0x00,  //@@@@@@+...
-    0xff, 0xff, 0xff, 0xf5, 0x00,  //@@@@@@@+..
-    0xff, 0x00, 0x1a, 0xfc, 0x00,  //@@...%@@..
-    0xff, 0x00, 0x01, 0xff, 0x00,  //@@....@@..
-    0xff, 0x00, 0x01, 0xfe, 0x00,  //@@....@@..
-    0xff, 0x00, 0x1a, 0xfa, 0x00,  //@@...%@%..
-    0xff, 0xff, 0xff, 0xc1, 0x00,  //@@@@@@@...
-    0xff, 0xff, 0xff, 0x40, 0x00,  //@@@@@@+...
-    0xff, 0x00, 0x5f, 0xf3, 0x00,  //@@..+@@...
-    0xff, 0x00, 0x07, 0xfc, 0x00,  //@@...+@@..
-    0xff, 0x00, 0x00, 0xdf, 0x60,  //@@....@@+.
-    0xff, 0x00, 0x00, 0x4f, 0xe1,  //@@....+@@.
-    0xff, 0x00, 0x00, 0x0a, 0xfa,  //@@.....%@%
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xf2, 0x00, 0x04, 0xff, 0xff, 0xfc, 0x50, 0x00, 0xfe, 0xff, 0x15, 0xf5, 0x00, 0xff, 0x00, 0x1a,
+    0xfc, 0x00, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x00, 0xff, 0x00, 0x1a, 0xfa,
+    0x00, 0xfe, 0xff, 0x01, 0xc1, 0x00, 0xfe, 0xff, 0x1a, 0x40, 0x00, 0xff, 0x00, 0x5f, 0xf3, 0x00,
+    0xff, 0x00, 0x07, 0xfc, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x60, 0xff, 0x00, 0x00, 0x4f, 0xe1, 0xff,
+    0x00, 0x00, 0x0a, 0xfa, 0xed, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x03, 0xbe, 0xfd, 0x93, 0x00,  //..%@@@%..
-    0x5f, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-    0xdf, 0xb2, 0x01, 0x5b, 0x00,  //@@%...+%.
-    0xff, 0x10, 0x00, 0x00, 0x00,  //@@.......
-    0xdf, 0x71, 0x00, 0x00, 0x00,  //@@+......
-    0x5f, 0xff, 0xda, 0x50, 0x00,  //+@@@@%+..
-    0x04, 0xbf, 0xff, 0xfc, 0x10,  //..%@@@@@.
-    0x00, 0x00, 0x26, 0xdf, 0x90,  //.....+@@%
-    0x00, 0x00, 0x00, 0x2f, 0xe0,  //.......@@
-    0x00, 0x00, 0x00, 0x1f, 0xf0,  //.......@@
-    0xc6, 0x20, 0x03, 0xcf, 0xd0,  //@+....%@@
-    0xff, 0xff, 0xff, 0xff, 0x50,  //@@@@@@@@+
-    0x38, 0xdf, 0xfe, 0xa3, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf2, 0x00, 0x05, 0x03, 0xbe, 0xfd, 0x93, 0x00, 0x5f, 0xfe, 0xff, 0x07, 0x00, 0xdf, 0xb2, 0x01,
+    0x5b, 0x00, 0xff, 0x10, 0xfe, 0x00, 0x01, 0xdf, 0x71, 0xfe, 0x00, 0x0e, 0x5f, 0xff, 0xda, 0x50,
+    0x00, 0x04, 0xbf, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x26, 0xdf, 0x90, 0xfe, 0x00, 0x01, 0x2f, 0xe0,
+    0xfe, 0x00, 0x06, 0x1f, 0xf0, 0xc6, 0x20, 0x03, 0xcf, 0xd0, 0xfd, 0xff, 0x04, 0x50, 0x38, 0xdf,
+    0xfe, 0xa3, 0xec, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xef, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00,
+    0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01,
+    0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f,
+    0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xe7, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@@......@@
-    0xef, 0x10, 0x00, 0x01, 0xfe,  //@@......@@
-    0xcf, 0x50, 0x00, 0x05, 0xfc,  //@@+....+@@
-    0x6f, 0xe5, 0x11, 0x5e, 0xf6,  //+@@+..+@@+
-    0x0c, 0xff, 0xff, 0xff, 0xc0,  //.@@@@@@@@.
-    0x00, 0x7d, 0xff, 0xd7, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xf2, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01,
+    0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x10, 0xff, 0xef, 0x10, 0x00, 0x01, 0xfe,
+    0xcf, 0x50, 0x00, 0x05, 0xfc, 0x6f, 0xe5, 0x11, 0x5e, 0xf6, 0x0c, 0xfe, 0xff, 0x04, 0xc0, 0x00,
+    0x7d, 0xff, 0xd7, 0xec, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc,  //@@+......+@@
-    0x6f, 0xb0, 0x00, 0x00, 0x0b, 0xf6,  //+@%......%@+
-    0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0,  //.@@......@@.
-    0x09, 0xf7, 0x00, 0x00, 0x7f, 0x90,  //.%@+....+@%.
-    0x03, 0xfd, 0x00, 0x00, 0xdf, 0x30,  //..@@....@@..
-    0x00, 0xdf, 0x30, 0x04, 0xfd, 0x00,  //..@@....@@..
-    0x00, 0x6f, 0xa0, 0x0a, 0xf7, 0x00,  //..+@%..%@+..
-    0x00, 0x1f, 0xf0, 0x0f, 0xf1, 0x00,  //...@@..@@...
-    0x00, 0x0a, 0xf6, 0x6f, 0xa0, 0x00,  //...%@++@%...
-    0x00, 0x04, 0xfc, 0xcf, 0x40, 0x00,  //....@@@@+...
-    0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x7f, 0xf7, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x1f, 0xf1, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xef, 0x00, 0x3a, 0xcf, 0x50, 0x00, 0x00, 0x05, 0xfc, 0x6f, 0xb0, 0x00, 0x00, 0x0b, 0xf6, 0x0f,
+    0xf1, 0x00, 0x00, 0x1f, 0xf0, 0x09, 0xf7, 0x00, 0x00, 0x7f, 0x90, 0x03, 0xfd, 0x00, 0x00, 0xdf,
+    0x30, 0x00, 0xdf, 0x30, 0x04, 0xfd, 0x00, 0x00, 0x6f, 0xa0, 0x0a, 0xf7, 0x00, 0x00, 0x1f, 0xf0,
+    0x0f, 0xf1, 0x00, 0x00, 0x0a, 0xf6, 0x6f, 0xa0, 0x00, 0x00, 0x04, 0xfc, 0xcf, 0x40, 0xfe, 0x00,
+    0x01, 0xdf, 0xfd, 0xfd, 0x00, 0x01, 0x7f, 0xf7, 0xfd, 0x00, 0x01, 0x1f, 0xf1, 0xe7, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0xdf, 0x20, 0x00, 0x3f, 0xff, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@@.....@@
-    0x9f, 0x60, 0x00, 0x7f, 0xff, 0x60, 0x00, 0x6f, 0x90,  //%@+...+@@@+...+@%
-    0x5f, 0xb0, 0x00, 0xbf, 0x9f, 0xa0, 0x00, 0xaf, 0x50,  //+@%...%@%@%...%@+
-    0x1f, 0xe0, 0x00, 0xff, 0x1f, 0xe0, 0x00, 0xef, 0x10,  //.@@...@@.@@...@@.
-    0x0d, 0xf3, 0x03, 0xfc, 0x0c, 0xf2, 0x02, 0xfd, 0x00,  //.@@...@@.@@...@@.
-    0x09, 0xf7, 0x07, 0xf8, 0x08, 0xf6, 0x06, 0xf9, 0x00,  //.%@+.+@%.%@+.+@%.
-    0x05, 0xfb, 0x0b, 0xf4, 0x04, 0xfa, 0x0a, 0xf4, 0x00,  //.+@%.%@+.+@%.%@+.
-    0x01, 0xfe, 0x0f, 0xf0, 0x00, 0xfe, 0x0e, 0xf0, 0x00,  //..@@.@@...@@.@@..
-    0x00, 0xcf, 0x6f, 0xc0, 0x00, 0xcf, 0x5f, 0xc0, 0x00,  //..@@+@@...@@+@@..
-    0x00, 0x8f, 0xef, 0x80, 0x00, 0x8f, 0xdf, 0x80, 0x00,  //..%@@@%...%@@@%..
-    0x00, 0x4f, 0xff, 0x40, 0x00, 0x4f, 0xff, 0x40, 0x00,  //..+@@@+...+@@@+..
-    0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@.....@@@...
-    0x00, 0x0c, 0xfc, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x00,  //...@@@.....@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xe6, 0x00, 0x69, 0xdf, 0x20, 0x00, 0x3f, 0xff, 0x20, 0x00, 0x2f, 0xd0, 0x9f, 0x60, 0x00, 0x7f,
+    0xff, 0x60, 0x00, 0x6f, 0x90, 0x5f, 0xb0, 0x00, 0xbf, 0x9f, 0xa0, 0x00, 0xaf, 0x50, 0x1f, 0xe0,
+    0x00, 0xff, 0x1f, 0xe0, 0x00, 0xef, 0x10, 0x0d, 0xf3, 0x03, 0xfc, 0x0c, 0xf2, 0x02, 0xfd, 0x00,
+    0x09, 0xf7, 0x07, 0xf8, 0x08, 0xf6, 0x06, 0xf9, 0x00, 0x05, 0xfb, 0x0b, 0xf4, 0x04, 0xfa, 0x0a,
+    0xf4, 0x00, 0x01, 0xfe, 0x0f, 0xf0, 0x00, 0xfe, 0x0e, 0xf0, 0x00, 0x00, 0xcf, 0x6f, 0xc0, 0x00,
+    0xcf, 0x5f, 0xc0, 0x00, 0x00, 0x8f, 0xef, 0x80, 0x00, 0x8f, 0xdf, 0x80, 0x00, 0x00, 0x4f, 0xff,
+    0x40, 0x00, 0x4f, 0xff, 0x40, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x05,
+    0x0c, 0xfc, 0x00, 0x00, 0x0c, 0xfc, 0xdb, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x0b, 0xfb, 0x00, 0x00, 0xbf, 0xa0,  //.%@%....%@%
-    0x02, 0xff, 0x40, 0x06, 0xfe, 0x10,  //..@@+..+@@.
-    0x00, 0x8f, 0xd0, 0x1f, 0xf5, 0x00,  //..%@@..@@+.
-    0x00, 0x0e, 0xf7, 0xbf, 0xb0, 0x00,  //...@@+%@%..
-    0x00, 0x05, 0xff, 0xfe, 0x10, 0x00,  //...+@@@@...
-    0x00, 0x00, 0xcf, 0xf6, 0x00, 0x00,  //....%@@+...
-    0x00, 0x00, 0xbf, 0xf3, 0x00, 0x00,  //....%@@....
-    0x00, 0x05, 0xff, 0xfc, 0x00, 0x00,  //...+@@@@...
-    0x00, 0x1e, 0xf7, 0xef, 0x50, 0x00,  //...@@+@@+..
-    0x00, 0xaf, 0xb0, 0x6f, 0xe0, 0x00,  //..%@%.+@@..
-    0x05, 0xff, 0x20, 0x0d, 0xf8, 0x00,  //.+@@...@@%.
-    0x1e, 0xf7, 0x00, 0x03, 0xff, 0x20,  //.@@+....@@.
-    0xaf, 0xc0, 0x00, 0x00, 0xaf, 0xb0,  //%@@.....%@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xef, 0x00, 0x1c, 0x0b, 0xfb, 0x00, 0x00, 0xbf, 0xa0, 0x02, 0xff, 0x40, 0x06, 0xfe, 0x10, 0x00,
+    0x8f, 0xd0, 0x1f, 0xf5, 0x00, 0x00, 0x0e, 0xf7, 0xbf, 0xb0, 0x00, 0x00, 0x05, 0xff, 0xfe, 0x10,
+    0xfe, 0x00, 0x01, 0xcf, 0xf6, 0xfd, 0x00, 0x01, 0xbf, 0xf3, 0xfe, 0x00, 0x02, 0x05, 0xff, 0xfc,
+    0xfe, 0x00, 0x1c, 0x1e, 0xf7, 0xef, 0x50, 0x00, 0x00, 0xaf, 0xb0, 0x6f, 0xe0, 0x00, 0x05, 0xff,
+    0x20, 0x0d, 0xf8, 0x00, 0x1e, 0xf7, 0x00, 0x03, 0xff, 0x20, 0xaf, 0xc0, 0x00, 0x00, 0xaf, 0xb0,
+    0xe9, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xaf, 0xc0, 0x00, 0x00, 0x0c, 0xfa,  //%@@......@@%
-    0x0d, 0xf7, 0x00, 0x00, 0x7f, 0xd0,  //.@@+....+@@.
-    0x03, 0xff, 0x20, 0x02, 0xff, 0x30,  //..@@....@@..
-    0x00, 0x6f, 0xb0, 0x0b, 0xf6, 0x00,  //..+@%..%@+..
-    0x00, 0x0b, 0xf6, 0x6f, 0xb0, 0x00,  //...%@++@%...
-    0x00, 0x01, 0xef, 0xfe, 0x10, 0x00,  //....@@@@....
-    0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xef, 0x00, 0x22, 0xaf, 0xc0, 0x00, 0x00, 0x0c, 0xfa, 0x0d, 0xf7, 0x00, 0x00, 0x7f, 0xd0, 0x03,
+    0xff, 0x20, 0x02, 0xff, 0x30, 0x00, 0x6f, 0xb0, 0x0b, 0xf6, 0x00, 0x00, 0x0b, 0xf6, 0x6f, 0xb0,
+    0x00, 0x00, 0x01, 0xef, 0xfe, 0x10, 0xfe, 0x00, 0x01, 0x3f, 0xf3, 0xfd, 0x00, 0x01, 0x0f, 0xf0,
+    0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xfd,
+    0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf0, 0xe7, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x0b, 0xfe, 0x10,  //.......%@@.
-    0x00, 0x00, 0x00, 0x8f, 0xf3, 0x00,  //......%@@..
-    0x00, 0x00, 0x05, 0xff, 0x60, 0x00,  //.....+@@+..
-    0x00, 0x00, 0x2f, 0xf9, 0x00, 0x00,  //.....@@%...
-    0x00, 0x00, 0xdf, 0xb0, 0x00, 0x00,  //....@@%....
-    0x00, 0x0a, 0xfd, 0x10, 0x00, 0x00,  //...%@@.....
-    0x00, 0x7f, 0xf2, 0x00, 0x00, 0x00,  //..+@@......
-    0x04, 0xff, 0x50, 0x00, 0x00, 0x00,  //.+@@+......
-    0x1e, 0xf8, 0x00, 0x00, 0x00, 0x00,  //.@@%.......
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xef, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x02, 0x0b, 0xfe, 0x10,
+    0xfe, 0x00, 0x01, 0x8f, 0xf3, 0xfe, 0x00, 0x02, 0x05, 0xff, 0x60, 0xfe, 0x00, 0x01, 0x2f, 0xf9,
+    0xfd, 0x00, 0x01, 0xdf, 0xb0, 0xfe, 0x00, 0x02, 0x0a, 0xfd, 0x10, 0xfe, 0x00, 0x01, 0x7f, 0xf2,
+    0xfe, 0x00, 0x02, 0x04, 0xff, 0x50, 0xfe, 0x00, 0x01, 0x1e, 0xf8, 0xfd, 0x00, 0x00, 0xcf, 0xfd,
+    0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xe9, 0x00,
 
     /*Unicode: U+005b ([) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0xff, 0xff,  //@@@@
-    0xff, 0xff,  //@@@@
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0x00,  //@@..
-    0xff, 0xff,  //@@@@
-    0xff, 0xff,  //@@@@
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0xfd, 0x00, 0xfc, 0xff, 0x16, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfd, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+005c (\) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0xdf, 0x30, 0x00,  //@@....
-    0x9f, 0x70, 0x00,  //%@+...
-    0x5f, 0xb0, 0x00,  //+@%...
-    0x1f, 0xf0, 0x00,  //.@@...
-    0x0d, 0xf4, 0x00,  //.@@+..
-    0x08, 0xf8, 0x00,  //.%@%..
-    0x04, 0xfc, 0x00,  //.+@@..
-    0x00, 0xff, 0x00,  //..@@..
-    0x00, 0xcf, 0x40,  //..@@+.
-    0x00, 0x8f, 0x90,  //..+@%.
-    0x00, 0x3f, 0xd0,  //...@@.
-    0x00, 0x0f, 0xf1,  //...@@.
-    0x00, 0x0b, 0xf5,  //...%@+
-    0x00, 0x07, 0xf9,  //...+@%
-    0x00, 0x03, 0xfd,  //....@@
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xf8, 0x00, 0x2c, 0xdf, 0x30, 0x00, 0x9f, 0x70, 0x00, 0x5f, 0xb0, 0x00, 0x1f, 0xf0, 0x00, 0x0d,
+    0xf4, 0x00, 0x08, 0xf8, 0x00, 0x04, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0xcf, 0x40, 0x00, 0x8f,
+    0x90, 0x00, 0x3f, 0xd0, 0x00, 0x0f, 0xf1, 0x00, 0x0b, 0xf5, 0x00, 0x07, 0xf9, 0x00, 0x03, 0xfd,
+    0xfb, 0x00,
 
     /*Unicode: U+005d (]) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0xff, 0xff,  //@@@@
-    0xff, 0xff,  //@@@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0xff, 0xff,  //@@@@
-    0xff, 0xff,  //@@@@
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0xfd, 0x00, 0xfd, 0xff, 0x16, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+005e (^) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0xcf, 0xc0, 0x00, 0x00,  //....@@@....
-    0x00, 0x0b, 0xfa, 0xfb, 0x00, 0x00,  //...%@%@%...
-    0x00, 0xaf, 0x60, 0x6f, 0xa0, 0x00,  //..%@+.+@%..
-    0x09, 0xf5, 0x00, 0x05, 0xf9, 0x00,  //.%@+...+@%.
-    0x8f, 0x40, 0x00, 0x00, 0x4f, 0x80,  //%@+.....+@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xed, 0x00, 0x01, 0xcf, 0xc0, 0xfe, 0x00, 0x02, 0x0b, 0xfa, 0xfb, 0xfe, 0x00, 0x10, 0xaf, 0x60,
+    0x6f, 0xa0, 0x00, 0x09, 0xf5, 0x00, 0x05, 0xf9, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x4f, 0x80, 0xb9,
+    0x00,
 
     /*Unicode: U+005f (_) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-
+    0xa7, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0,
 
     /*Unicode: U+0060 (`) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x8e, 0x10,  //%@..
-    0x0a, 0xc0,  //.%@.
-    0x00, 0xb9,  //..%%
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0xfd, 0x00, 0x05, 0x8e, 0x10, 0x0a, 0xc0, 0x00, 0xb9, 0xe3, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x04, 0xbe, 0xfc, 0x40,  //.+%@@@+.
-    0x0f, 0xff, 0xff, 0xf3,  //.@@@@@@.
-    0x0a, 0x30, 0x2a, 0xfa,  //.%...%@%
-    0x00, 0x00, 0x01, 0xfe,  //......@@
-    0x07, 0xcf, 0xff, 0xff,  //.+@@@@@@
-    0x8f, 0xff, 0xff, 0xff,  //%@@@@@@@
-    0xef, 0x51, 0x01, 0xff,  //@@+...@@
-    0xef, 0x40, 0x2a, 0xff,  //@@+..%@@
-    0xaf, 0xff, 0xfa, 0xff,  //%@@@@%@@
-    0x1a, 0xee, 0x90, 0xff,  //.%@@%.@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0x14, 0x04, 0xbe, 0xfc, 0x40, 0x0f, 0xff, 0xff, 0xf3, 0x0a, 0x30, 0x2a, 0xfa, 0x00,
+    0x00, 0x01, 0xfe, 0x07, 0xcf, 0xff, 0xff, 0x8f, 0xfe, 0xff, 0x0f, 0xef, 0x51, 0x01, 0xff, 0xef,
+    0x40, 0x2a, 0xff, 0xaf, 0xff, 0xfa, 0xff, 0x1a, 0xee, 0x90, 0xff, 0xf1, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x09, 0xef, 0xa1, 0x00,  //@@.%@@%..
-    0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-    0xff, 0xd3, 0x03, 0xef, 0x80,  //@@@...@@%
-    0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-    0xff, 0xd3, 0x03, 0xef, 0x80,  //@@@...@@%
-    0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-    0xff, 0x09, 0xef, 0xa2, 0x00,  //@@.%@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfd, 0x00, 0x30, 0xff, 0x09, 0xef, 0xa1, 0x00, 0xff, 0xaf, 0xff, 0xfe, 0x10, 0xff, 0xd3, 0x03,
+    0xef, 0x80, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f,
+    0xf0, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0xd3, 0x03, 0xef, 0x80, 0xff, 0xaf, 0xff, 0xfe, 0x10,
+    0xff, 0x09, 0xef, 0xa2, 0xec, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x6c, 0xff, 0xb4,  //..+@@@%+
-    0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-    0x7f, 0xf6, 0x10, 0x3a,  //+@@+...%
-    0xcf, 0x60, 0x00, 0x00,  //@@+.....
-    0xff, 0x10, 0x00, 0x00,  //@@......
-    0xff, 0x10, 0x00, 0x00,  //@@......
-    0xcf, 0x60, 0x00, 0x00,  //@@+.....
-    0x7f, 0xf6, 0x10, 0x3a,  //+@@+...%
-    0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-    0x00, 0x7d, 0xff, 0xb4,  //..+@@@%+
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe8, 0x00, 0x03, 0x6c, 0xff, 0xb4, 0x0b, 0xfe, 0xff, 0x18, 0x7f, 0xf6, 0x10, 0x3a, 0xcf, 0x60,
+    0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xcf, 0x60, 0x00, 0x00, 0x7f, 0xf6,
+    0x10, 0x3a, 0x0b, 0xfe, 0xff, 0x03, 0x00, 0x7d, 0xff, 0xb4, 0xf1, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x02, 0xaf, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x8f, 0xd3, 0x03, 0xef, 0xf0,  //%@@...@@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0x8f, 0xd3, 0x03, 0xef, 0xf0,  //%@@...@@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x02, 0xbf, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf4, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe,
+    0x00, 0x33, 0x0f, 0xf0, 0x02, 0xaf, 0xe9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3,
+    0x03, 0xef, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00,
+    0x1f, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xef, 0xf0, 0x1e, 0xff, 0xff, 0xaf,
+    0xf0, 0x02, 0xbf, 0xe9, 0x0f, 0xf0, 0xed, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x5b, 0xef, 0xd8, 0x00,  //..+%@@@%..
-    0x0a, 0xff, 0xff, 0xff, 0xd0,  //.%@@@@@@@.
-    0x6f, 0xe5, 0x10, 0x3c, 0xf8,  //+@@+...@@%
-    0xcf, 0x30, 0x00, 0x02, 0xfd,  //@@......@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xcf, 0x30, 0x00, 0x00, 0x00,  //@@........
-    0x6f, 0xe6, 0x10, 0x02, 0x6c,  //+@@+....+@
-    0x09, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@
-    0x00, 0x4a, 0xef, 0xfd, 0x82,  //..+%@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe2, 0x00, 0x04, 0x5b, 0xef, 0xd8, 0x00, 0x0a, 0xfe, 0xff, 0x0a, 0xd0, 0x6f, 0xe5, 0x10, 0x3c,
+    0xf8, 0xcf, 0x30, 0x00, 0x02, 0xfd, 0xf7, 0xff, 0x01, 0xcf, 0x30, 0xfe, 0x00, 0x05, 0x6f, 0xe6,
+    0x10, 0x02, 0x6c, 0x09, 0xfd, 0xff, 0x04, 0x00, 0x4a, 0xef, 0xfd, 0x82, 0xed, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x08, 0xdf, 0xf0,  //...%@@@
-    0x00, 0x8f, 0xff, 0xf0,  //..%@@@@
-    0x00, 0xdf, 0x50, 0x00,  //..@@+..
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-    0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0xff, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xf8, 0x00, 0x0e, 0x08, 0xdf, 0xf0, 0x00, 0x8f, 0xff, 0xf0, 0x00, 0xdf, 0x50, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xef, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x02, 0xbf, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x02, 0xbf, 0xe9, 0x2f, 0xe0,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x6f, 0xb0,  //......+@%
-    0x0a, 0x30, 0x16, 0xff, 0x60,  //.%...+@@+
-    0x0f, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-    0x04, 0xbe, 0xfd, 0x80, 0x00,  //.+%@@@%..
-
+    0xe3, 0x00, 0x31, 0x02, 0xbf, 0xe9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3, 0x03,
+    0xdf, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f,
+    0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xdf, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0,
+    0x02, 0xbf, 0xe9, 0x2f, 0xe0, 0xfe, 0x00, 0x10, 0x6f, 0xb0, 0x0a, 0x30, 0x16, 0xff, 0x60, 0x0f,
+    0xff, 0xff, 0xfc, 0x00, 0x04, 0xbe, 0xfd, 0x80, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0x09, 0xfe, 0x80,  //@@.%@@%.
-    0xff, 0xaf, 0xff, 0xf6,  //@@%@@@@+
-    0xff, 0xc2, 0x09, 0xfc,  //@@@..%@@
-    0xff, 0x30, 0x01, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf9, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x27, 0xff, 0x09, 0xfe, 0x80, 0xff, 0xaf, 0xff, 0xf6, 0xff, 0xc2, 0x09, 0xfc, 0xff,
+    0x30, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf1, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xf7, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x00, 0xff,  //..@@
-    0x07, 0xfd,  //.+@@
-    0xff, 0xf7,  //@@@+
-    0xfd, 0x70,  //@@+.
-
+    0xfc, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x1a, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xfd,
+    0xff, 0xf7, 0xfd, 0x70,
 
     /*Unicode: U+006b (k) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x03, 0xef, 0x70,  //@@....@@+
-    0xff, 0x00, 0x4f, 0xf6, 0x00,  //@@..+@@+.
-    0xff, 0x04, 0xff, 0x50, 0x00,  //@@.+@@+..
-    0xff, 0x5f, 0xf4, 0x00, 0x00,  //@@+@@+...
-    0xff, 0xfe, 0x30, 0x00, 0x00,  //@@@@.....
-    0xff, 0xff, 0x50, 0x00, 0x00,  //@@@@+....
-    0xff, 0x6f, 0xf5, 0x00, 0x00,  //@@+@@+...
-    0xff, 0x06, 0xff, 0x60, 0x00,  //@@.+@@+..
-    0xff, 0x00, 0x7f, 0xf6, 0x00,  //@@..+@@+.
-    0xff, 0x00, 0x07, 0xff, 0x70,  //@@...+@@+
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfd, 0x00, 0x31, 0xff, 0x00, 0x03, 0xef, 0x70, 0xff, 0x00, 0x4f, 0xf6, 0x00, 0xff, 0x04, 0xff,
+    0x50, 0x00, 0xff, 0x5f, 0xf4, 0x00, 0x00, 0xff, 0xfe, 0x30, 0x00, 0x00, 0xff, 0xff, 0x50, 0x00,
+    0x00, 0xff, 0x6f, 0xf5, 0x00, 0x00, 0xff, 0x06, 0xff, 0x60, 0x00, 0xff, 0x00, 0x7f, 0xf6, 0x00,
+    0xff, 0x00, 0x07, 0xff, 0x70, 0xed, 0x00,
 
     /*Unicode: U+006c (l) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-
+    0x01, 0x00, 0x00, 0xf3, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+006d (m) , Width: 14 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0xff, 0x09, 0xfe, 0x60, 0x1a, 0xee, 0x80,  //@@.%@@+..%@@%.
-    0xff, 0xaf, 0xff, 0xf4, 0xcf, 0xff, 0xf5,  //@@%@@@@+@@@@@+
-    0xff, 0xc2, 0x09, 0xfe, 0xc2, 0x09, 0xfc,  //@@@..%@@@..%@@
-    0xff, 0x30, 0x01, 0xff, 0x30, 0x01, 0xfe,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //@@....@@....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+    0xd7, 0x00, 0x45, 0xff, 0x09, 0xfe, 0x60, 0x1a, 0xee, 0x80, 0xff, 0xaf, 0xff, 0xf4, 0xcf, 0xff,
+    0xf5, 0xff, 0xc2, 0x09, 0xfe, 0xc2, 0x09, 0xfc, 0xff, 0x30, 0x01, 0xff, 0x30, 0x01, 0xfe, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xe5, 0x00,
 
     /*Unicode: U+006e (n) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0x09, 0xfe, 0x80,  //@@.%@@%.
-    0xff, 0xaf, 0xff, 0xf6,  //@@%@@@@+
-    0xff, 0xc2, 0x09, 0xfc,  //@@@..%@@
-    0xff, 0x30, 0x01, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0x27, 0xff, 0x09, 0xfe, 0x80, 0xff, 0xaf, 0xff, 0xf6, 0xff, 0xc2, 0x09, 0xfc, 0xff,
+    0x30, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf1, 0x00,
 
     /*Unicode: U+006f (o) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x7c, 0xff, 0xc7, 0x00,  //..+@@@@+..
-    0x0c, 0xff, 0xff, 0xff, 0xb0,  //.%@@@@@@%.
-    0x7f, 0xe6, 0x11, 0x6f, 0xf7,  //+@@+..+@@+
-    0xdf, 0x50, 0x00, 0x06, 0xfc,  //@@+....+@@
-    0xff, 0x10, 0x00, 0x01, 0xff,  //@@......@@
-    0xff, 0x10, 0x00, 0x01, 0xff,  //@@......@@
-    0xdf, 0x50, 0x00, 0x06, 0xfc,  //@@+....+@@
-    0x7f, 0xe5, 0x11, 0x5e, 0xf7,  //+@@+..+@@+
-    0x0c, 0xff, 0xff, 0xff, 0xb0,  //.%@@@@@@%.
-    0x00, 0x7d, 0xff, 0xd7, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe2, 0x00, 0x04, 0x7c, 0xff, 0xc7, 0x00, 0x0c, 0xfe, 0xff, 0x1f, 0xb0, 0x7f, 0xe6, 0x11, 0x6f,
+    0xf7, 0xdf, 0x50, 0x00, 0x06, 0xfc, 0xff, 0x10, 0x00, 0x01, 0xff, 0xff, 0x10, 0x00, 0x01, 0xff,
+    0xdf, 0x50, 0x00, 0x06, 0xfc, 0x7f, 0xe5, 0x11, 0x5e, 0xf7, 0x0c, 0xfe, 0xff, 0x04, 0xb0, 0x00,
+    0x7d, 0xff, 0xd7, 0xec, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0x09, 0xef, 0xa1, 0x00,  //@@.%@@%..
-    0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-    0xff, 0xd3, 0x03, 0xef, 0x80,  //@@@...@@%
-    0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-    0xff, 0xd3, 0x03, 0xef, 0x80,  //@@@...@@%
-    0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-    0xff, 0x09, 0xef, 0xa2, 0x00,  //@@.%@@%..
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+    0xe3, 0x00, 0x32, 0xff, 0x09, 0xef, 0xa1, 0x00, 0xff, 0xaf, 0xff, 0xfe, 0x10, 0xff, 0xd3, 0x03,
+    0xef, 0x80, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f,
+    0xf0, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0xd3, 0x03, 0xef, 0x80, 0xff, 0xaf, 0xff, 0xfe, 0x10,
+    0xff, 0x09, 0xef, 0xa2, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+    0x00, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x02, 0xaf, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x8f, 0xd3, 0x03, 0xef, 0xf0,  //%@@...@@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-    0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-    0x8f, 0xd3, 0x03, 0xef, 0xf0,  //%@@...@@@
-    0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-    0x02, 0xbf, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-    0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-
+    0xe3, 0x00, 0x31, 0x02, 0xaf, 0xe9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3, 0x03,
+    0xef, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f,
+    0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xef, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0,
+    0x02, 0xbf, 0xe9, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe,
+    0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0,
 
     /*Unicode: U+0072 (r) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0xff, 0x09, 0xef,  //@@.%@@
-    0xff, 0xaf, 0xff,  //@@%@@@
-    0xff, 0xe4, 0x00,  //@@@+..
-    0xff, 0x50, 0x00,  //@@+...
-    0xff, 0x10, 0x00,  //@@....
-    0xff, 0x00, 0x00,  //@@....
-    0xff, 0x00, 0x00,  //@@....
-    0xff, 0x00, 0x00,  //@@....
-    0xff, 0x00, 0x00,  //@@....
-    0xff, 0x00, 0x00,  //@@....
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xef, 0x00, 0x1b, 0xff, 0x09, 0xef, 0xff, 0xaf, 0xff, 0xff, 0xe4, 0x00, 0xff, 0x50, 0x00, 0xff,
+    0x10, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xf3,
+    0x00,
 
     /*Unicode: U+0073 (s) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x08, 0xdf, 0xfb, 0x40,  //.+@@@%+
-    0x9f, 0xff, 0xff, 0xf0,  //%@@@@@@
-    0xef, 0x71, 0x03, 0xa0,  //@@+...%
-    0xdf, 0xb7, 0x30, 0x00,  //@@%+...
-    0x4e, 0xff, 0xfd, 0x20,  //+@@@@@.
-    0x00, 0x48, 0xef, 0xc0,  //..+%@@%
-    0x00, 0x00, 0x1f, 0xf0,  //.....@@
-    0xb4, 0x00, 0x6f, 0xf0,  //%+..+@@
-    0xff, 0xff, 0xff, 0xa0,  //@@@@@@%
-    0x3a, 0xef, 0xd7, 0x00,  //.%@@@+.
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xe9, 0x00, 0x1f, 0x08, 0xdf, 0xfb, 0x40, 0x9f, 0xff, 0xff, 0xf0, 0xef, 0x71, 0x03, 0xa0, 0xdf,
+    0xb7, 0x30, 0x00, 0x4e, 0xff, 0xfd, 0x20, 0x00, 0x48, 0xef, 0xc0, 0x00, 0x00, 0x1f, 0xf0, 0xb4,
+    0x00, 0x6f, 0xf0, 0xfe, 0xff, 0x03, 0xa0, 0x3a, 0xef, 0xd7, 0xf0, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0xff, 0xff,  //@@@@@@
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0f, 0xf0, 0x00,  //.@@...
-    0x0e, 0xf4, 0x00,  //.@@+..
-    0x0a, 0xff, 0xff,  //.%@@@@
-    0x01, 0xae, 0xff,  //..%@@@
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00,  //......
-
+    0xf8, 0x00, 0x08, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xfb, 0xff, 0x17, 0x0f,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0e, 0xf4,
+    0x00, 0x0a, 0xff, 0xff, 0x01, 0xae, 0xff, 0xf5, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xff, 0x00, 0x00, 0xff,  //@@....@@
-    0xef, 0x10, 0x03, 0xff,  //@@....@@
-    0xcf, 0x90, 0x2c, 0xff,  //@@%..@@@
-    0x6f, 0xff, 0xfa, 0xff,  //+@@@@%@@
-    0x08, 0xef, 0xa0, 0xff,  //.%@@%.@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0x27, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xef, 0x10, 0x03, 0xff, 0xcf,
+    0x90, 0x2c, 0xff, 0x6f, 0xff, 0xfa, 0xff, 0x08, 0xef, 0xa0, 0xff, 0xf1, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x1f, 0xf1, 0x00, 0x00, 0x0e, 0xe0,  //.@@......@@.
-    0x0a, 0xf7, 0x00, 0x00, 0x6f, 0x80,  //.%@+....+@%.
-    0x04, 0xfc, 0x00, 0x00, 0xcf, 0x20,  //..@@....@@..
-    0x00, 0xdf, 0x20, 0x03, 0xfc, 0x00,  //..@@....@@..
-    0x00, 0x7f, 0x80, 0x09, 0xf6, 0x00,  //..+@%..%@+..
-    0x00, 0x1f, 0xd0, 0x0f, 0xf0, 0x00,  //...@@..@@...
-    0x00, 0x0a, 0xf3, 0x6f, 0x90, 0x00,  //...%@.+@%...
-    0x00, 0x04, 0xf9, 0xcf, 0x30, 0x00,  //...+@%@@....
-    0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x7f, 0xf7, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdd, 0x00, 0x2e, 0x1f, 0xf1, 0x00, 0x00, 0x0e, 0xe0, 0x0a, 0xf7, 0x00, 0x00, 0x6f, 0x80, 0x04,
+    0xfc, 0x00, 0x00, 0xcf, 0x20, 0x00, 0xdf, 0x20, 0x03, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x09, 0xf6,
+    0x00, 0x00, 0x1f, 0xd0, 0x0f, 0xf0, 0x00, 0x00, 0x0a, 0xf3, 0x6f, 0x90, 0x00, 0x00, 0x04, 0xf9,
+    0xcf, 0x30, 0xfe, 0x00, 0x01, 0xdf, 0xfd, 0xfd, 0x00, 0x01, 0x7f, 0xf7, 0xe7, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x0f, 0xf0, 0x00, 0xcf, 0xc0, 0x00, 0xff, 0x00,  //.@@...@@@...@@.
-    0x0c, 0xf3, 0x01, 0xff, 0xf0, 0x03, 0xfc, 0x00,  //.@@...@@@...@@.
-    0x08, 0xf7, 0x04, 0xfd, 0xf4, 0x07, 0xf8, 0x00,  //.%@+.+@@@+.+@%.
-    0x04, 0xfa, 0x08, 0xf5, 0xf8, 0x0a, 0xf4, 0x00,  //.+@%.%@+@%.%@+.
-    0x00, 0xfd, 0x0c, 0xe0, 0xec, 0x0d, 0xf0, 0x00,  //..@@.@@.@@.@@..
-    0x00, 0xcf, 0x2f, 0x90, 0xaf, 0x1f, 0xc0, 0x00,  //..@@.@%.%@.@@..
-    0x00, 0x8f, 0x9f, 0x50, 0x5f, 0x8f, 0x80, 0x00,  //..%@%@+.+@%@%..
-    0x00, 0x5f, 0xff, 0x10, 0x1f, 0xef, 0x50, 0x00,  //..+@@@...@@@+..
-    0x00, 0x1f, 0xfc, 0x00, 0x0d, 0xff, 0x10, 0x00,  //...@@@...@@@...
-    0x00, 0x0d, 0xf8, 0x00, 0x08, 0xfd, 0x00, 0x00,  //...@@%...%@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xd1, 0x00, 0x4d, 0x0f, 0xf0, 0x00, 0xcf, 0xc0, 0x00, 0xff, 0x00, 0x0c, 0xf3, 0x01, 0xff, 0xf0,
+    0x03, 0xfc, 0x00, 0x08, 0xf7, 0x04, 0xfd, 0xf4, 0x07, 0xf8, 0x00, 0x04, 0xfa, 0x08, 0xf5, 0xf8,
+    0x0a, 0xf4, 0x00, 0x00, 0xfd, 0x0c, 0xe0, 0xec, 0x0d, 0xf0, 0x00, 0x00, 0xcf, 0x2f, 0x90, 0xaf,
+    0x1f, 0xc0, 0x00, 0x00, 0x8f, 0x9f, 0x50, 0x5f, 0x8f, 0x80, 0x00, 0x00, 0x5f, 0xff, 0x10, 0x1f,
+    0xef, 0x50, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x0d, 0xff, 0x10, 0x00, 0x00, 0x0d, 0xf8, 0x00, 0x08,
+    0xfd, 0xdf, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xaf, 0xd0, 0x00, 0x0d, 0xfa,  //%@@....@@%
-    0x1e, 0xf5, 0x00, 0x5f, 0xd0,  //.@@+..+@@.
-    0x04, 0xfd, 0x00, 0xdf, 0x30,  //.+@@..@@..
-    0x00, 0x9f, 0x55, 0xf8, 0x00,  //..%@++@%..
-    0x00, 0x0d, 0xdd, 0xc0, 0x00,  //...@@@@...
-    0x00, 0x1e, 0xef, 0xe1, 0x00,  //...@@@@...
-    0x00, 0xaf, 0x57, 0xfa, 0x00,  //..%@++@%..
-    0x05, 0xfd, 0x00, 0xef, 0x50,  //.+@@..@@+.
-    0x1e, 0xf4, 0x00, 0x5f, 0xe1,  //.@@+..+@@.
-    0xaf, 0xc0, 0x00, 0x0c, 0xfa,  //%@@....@@%
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe3, 0x00, 0x31, 0xaf, 0xd0, 0x00, 0x0d, 0xfa, 0x1e, 0xf5, 0x00, 0x5f, 0xd0, 0x04, 0xfd, 0x00,
+    0xdf, 0x30, 0x00, 0x9f, 0x55, 0xf8, 0x00, 0x00, 0x0d, 0xdd, 0xc0, 0x00, 0x00, 0x1e, 0xef, 0xe1,
+    0x00, 0x00, 0xaf, 0x57, 0xfa, 0x00, 0x05, 0xfd, 0x00, 0xef, 0x50, 0x1e, 0xf4, 0x00, 0x5f, 0xe1,
+    0xaf, 0xc0, 0x00, 0x0c, 0xfa, 0xed, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x2f, 0xf1, 0x00, 0x00, 0x0f, 0xf2,  //.@@......@@.
-    0x0a, 0xf7, 0x00, 0x00, 0x7f, 0xa0,  //.%@+....+@%.
-    0x03, 0xfe, 0x00, 0x00, 0xef, 0x30,  //..@@....@@..
-    0x00, 0xbf, 0x50, 0x05, 0xfc, 0x00,  //..%@+..+@@..
-    0x00, 0x3f, 0xd0, 0x0c, 0xf4, 0x00,  //...@@..@@+..
-    0x00, 0x0c, 0xf4, 0x3f, 0xd0, 0x00,  //...@@+.@@...
-    0x00, 0x04, 0xfb, 0xaf, 0x60, 0x00,  //...+@%%@+...
-    0x00, 0x00, 0xdf, 0xfe, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x5f, 0xf7, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x6f, 0x80, 0x00, 0x00,  //....+@%.....
-    0x00, 0x01, 0xbf, 0x20, 0x00, 0x00,  //....%@......
-    0x00, 0xff, 0xfb, 0x00, 0x00, 0x00,  //..@@@%......
-    0x00, 0xff, 0xb1, 0x00, 0x00, 0x00,  //..@@%.......
-
+    0xdd, 0x00, 0x28, 0x2f, 0xf1, 0x00, 0x00, 0x0f, 0xf2, 0x0a, 0xf7, 0x00, 0x00, 0x7f, 0xa0, 0x03,
+    0xfe, 0x00, 0x00, 0xef, 0x30, 0x00, 0xbf, 0x50, 0x05, 0xfc, 0x00, 0x00, 0x3f, 0xd0, 0x0c, 0xf4,
+    0x00, 0x00, 0x0c, 0xf4, 0x3f, 0xd0, 0x00, 0x00, 0x04, 0xfb, 0xaf, 0x60, 0xfe, 0x00, 0x01, 0xdf,
+    0xfe, 0xfd, 0x00, 0x01, 0x5f, 0xf7, 0xfd, 0x00, 0x01, 0x2f, 0xe0, 0xfd, 0x00, 0x01, 0x6f, 0x80,
+    0xfe, 0x00, 0x02, 0x01, 0xbf, 0x20, 0xfe, 0x00, 0x01, 0xff, 0xfb, 0xfd, 0x00, 0x01, 0xff, 0xb1,
+    0xfe, 0x00,
 
     /*Unicode: U+007a (z) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xfd,  //@@@@@@@@
-    0x00, 0x00, 0x4f, 0xf3,  //....+@@.
-    0x00, 0x01, 0xef, 0x70,  //....@@+.
-    0x00, 0x0c, 0xfc, 0x00,  //...@@@..
-    0x00, 0x9f, 0xe1, 0x00,  //..%@@...
-    0x05, 0xff, 0x50, 0x00,  //.+@@+...
-    0x2f, 0xfa, 0x00, 0x00,  //.@@%....
-    0xdf, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0xfa, 0xff, 0x19, 0xfd, 0x00, 0x00, 0x4f, 0xf3, 0x00, 0x01, 0xef, 0x70, 0x00, 0x0c,
+    0xfc, 0x00, 0x00, 0x9f, 0xe1, 0x00, 0x05, 0xff, 0x50, 0x00, 0x2f, 0xfa, 0x00, 0x00, 0xdf, 0xfa,
+    0xff, 0xf1, 0x00,
 
     /*Unicode: U+007b ({) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x01, 0x9d, 0xff,  //....%@@@
-    0x00, 0x0a, 0xff, 0xff,  //...%@@@@
-    0x00, 0x0e, 0xf6, 0x00,  //...@@+..
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x01, 0x8f, 0xc0, 0x00,  //..%@@...
-    0xff, 0xfc, 0x30, 0x00,  //@@@@....
-    0xff, 0xfc, 0x20, 0x00,  //@@@@....
-    0x01, 0xaf, 0xb0, 0x00,  //..%@%...
-    0x00, 0x1f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0e, 0xf7, 0x00,  //...@@+..
-    0x00, 0x09, 0xff, 0xff,  //...%@@@@
-    0x00, 0x00, 0x9d, 0xff,  //....%@@@
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf8, 0x00, 0x42, 0x01, 0x9d, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x0f,
+    0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0x8f, 0xc0, 0x00, 0xff, 0xfc,
+    0x30, 0x00, 0xff, 0xfc, 0x20, 0x00, 0x01, 0xaf, 0xb0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f,
+    0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0e, 0xf7, 0x00, 0x00, 0x09,
+    0xff, 0xff, 0x00, 0x00, 0x9d, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+007c (|) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-    0xff,  //@@
-
+    0x01, 0x00, 0x00, 0xef, 0xff,
 
     /*Unicode: U+007d (}) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xd9, 0x10, 0x00,  //@@@%....
-    0xff, 0xff, 0xa0, 0x00,  //@@@@%...
-    0x00, 0x6f, 0xe0, 0x00,  //..+@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0c, 0xf8, 0x10,  //...@@%..
-    0x00, 0x03, 0xcf, 0xff,  //....@@@@
-    0x00, 0x02, 0xcf, 0xff,  //....@@@@
-    0x00, 0x0b, 0xfa, 0x10,  //...%@%..
-    0x00, 0x0f, 0xf1, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x0f, 0xf0, 0x00,  //...@@...
-    0x00, 0x7f, 0xe0, 0x00,  //..+@@...
-    0xff, 0xff, 0x90, 0x00,  //@@@@%...
-    0xff, 0xd9, 0x00, 0x00,  //@@@%....
-    0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf9, 0x00, 0x41, 0xff, 0xd9, 0x10, 0x00, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00,
+    0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0c, 0xf8, 0x10, 0x00,
+    0x03, 0xcf, 0xff, 0x00, 0x02, 0xcf, 0xff, 0x00, 0x0b, 0xfa, 0x10, 0x00, 0x0f, 0xf1, 0x00, 0x00,
+    0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0xff,
+    0xff, 0x90, 0x00, 0xff, 0xd9, 0xfb, 0x00,
 
     /*Unicode: U+007e (~) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x18, 0xef, 0xd8, 0x30, 0x05, 0xd0,  //.%@@@%...+@
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@
-    0xe6, 0x10, 0x48, 0xdf, 0xe9, 0x10,  //@+...%@@@%.
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
-
+    0xd1, 0x00, 0x06, 0x18, 0xef, 0xd8, 0x30, 0x05, 0xd0, 0xef, 0xfd, 0xff, 0x07, 0xe0, 0xe6, 0x10,
+    0x48, 0xdf, 0xe9, 0x10, 0x10, 0xcc, 0x00,
 
 #elif USE_LV_FONT_DEJAVU_20 == 8
     /*Unicode: U+0020 ( ) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x89, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xf4, 0xf2,  //@@
-    0xe4, 0xe2,  //@@
-    0xd2, 0xd2,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xfb, 0x00, 0xf5, 0xff, 0x05, 0xf4, 0xf2, 0xe4, 0xe2, 0xd2, 0xd2, 0xfd, 0x00, 0xfd, 0xff, 0xf9,
+    0x00,
 
     /*Unicode: U+0022 (") , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xef, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00,
+    0x00, 0xfd, 0xff, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xb9, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0x36, 0x00, 0x44, 0xff, 0x16, 0x00,  //.....@..+@..
-    0x00, 0x00, 0x00, 0x00, 0x62, 0xf6, 0x04, 0x00, 0x7e, 0xde, 0x00, 0x00,  //....+@..+@..
-    0x00, 0x00, 0x00, 0x00, 0x9a, 0xc4, 0x00, 0x00, 0xb8, 0xa6, 0x00, 0x00,  //....%@..%%..
-    0x00, 0x00, 0x00, 0x00, 0xd2, 0x8a, 0x00, 0x00, 0xee, 0x6e, 0x00, 0x00,  //....@%..@+..
-    0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x70, 0xea, 0x04, 0x00, 0x90, 0xd2, 0x00, 0x00, 0x00,  //...+@..%@...
-    0x00, 0x00, 0x00, 0xcc, 0x94, 0x00, 0x02, 0xe6, 0x78, 0x00, 0x00, 0x00,  //...@%..@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02,  //@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02,  //@@@@@@@@@@@.
-    0x00, 0x00, 0x66, 0xf0, 0x00, 0x00, 0x86, 0xd6, 0x00, 0x00, 0x00, 0x00,  //..+@..%@....
-    0x00, 0x00, 0xa0, 0xba, 0x00, 0x00, 0xbe, 0x9c, 0x00, 0x00, 0x00, 0x00,  //..%%..%%....
-    0x00, 0x00, 0xd8, 0x82, 0x00, 0x02, 0xf2, 0x64, 0x00, 0x00, 0x00, 0x00,  //..@%..@+....
-    0x00, 0x12, 0xff, 0x4a, 0x00, 0x2e, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //..@+..@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xe5, 0x00, 0x06, 0x2a, 0xff, 0x36, 0x00, 0x44, 0xff, 0x16, 0xfc, 0x00, 0x05, 0x62, 0xf6, 0x04,
+    0x00, 0x7e, 0xde, 0xfb, 0x00, 0x05, 0x9a, 0xc4, 0x00, 0x00, 0xb8, 0xa6, 0xfb, 0x00, 0x08, 0xd2,
+    0x8a, 0x00, 0x00, 0xee, 0x6e, 0x00, 0x00, 0x06, 0xf6, 0xff, 0x00, 0x06, 0xf6, 0xff, 0xfe, 0x00,
+    0x05, 0x70, 0xea, 0x04, 0x00, 0x90, 0xd2, 0xfb, 0x00, 0x05, 0xcc, 0x94, 0x00, 0x02, 0xe6, 0x78,
+    0xfe, 0x00, 0xf6, 0xff, 0x00, 0x02, 0xf6, 0xff, 0x08, 0x02, 0x00, 0x00, 0x66, 0xf0, 0x00, 0x00,
+    0x86, 0xd6, 0xfb, 0x00, 0x05, 0xa0, 0xba, 0x00, 0x00, 0xbe, 0x9c, 0xfb, 0x00, 0x05, 0xd8, 0x82,
+    0x00, 0x02, 0xf2, 0x64, 0xfc, 0x00, 0x06, 0x12, 0xff, 0x4a, 0x00, 0x2e, 0xff, 0x2a, 0xcd, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-    0x00, 0x42, 0xb4, 0xe6, 0xff, 0xea, 0xac, 0x3c, 0x00,  //.+%@@@%..
-    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-    0xe0, 0xff, 0x9c, 0x18, 0xff, 0x18, 0x50, 0xc2, 0x00,  //@@%.@.+@.
-    0xf2, 0xff, 0x12, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@..@....
-    0xb6, 0xff, 0xd4, 0x86, 0xff, 0x28, 0x00, 0x00, 0x00,  //%@@%@....
-    0x1c, 0xce, 0xff, 0xff, 0xff, 0xff, 0xde, 0x64, 0x00,  //.@@@@@@+.
-    0x00, 0x00, 0x3c, 0x7c, 0xff, 0xe0, 0xff, 0xff, 0x64,  //...+@@@@+
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x68, 0xff, 0xd6,  //....@.+@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x0c, 0xff, 0xf6,  //....@..@@
-    0xca, 0x62, 0x16, 0x00, 0xff, 0x1c, 0x9c, 0xff, 0xe0,  //@+..@.%@@
-    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x66,  //@@@@@@@@+
-    0x2e, 0x8c, 0xcc, 0xee, 0xff, 0xe4, 0xb2, 0x42, 0x00,  //.%@@@@%+.
-    0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xeb, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x08, 0x42, 0xb4, 0xe6, 0xff, 0xea,
+    0xac, 0x3c, 0x00, 0x66, 0xfa, 0xff, 0x0e, 0x00, 0xe0, 0xff, 0x9c, 0x18, 0xff, 0x18, 0x50, 0xc2,
+    0x00, 0xf2, 0xff, 0x12, 0x00, 0xff, 0xfd, 0x00, 0x05, 0xb6, 0xff, 0xd4, 0x86, 0xff, 0x28, 0xfe,
+    0x00, 0x01, 0x1c, 0xce, 0xfd, 0xff, 0x01, 0xde, 0x64, 0xfe, 0x00, 0x06, 0x3c, 0x7c, 0xff, 0xe0,
+    0xff, 0xff, 0x64, 0xfd, 0x00, 0x04, 0xff, 0x00, 0x68, 0xff, 0xd6, 0xfd, 0x00, 0x0d, 0xff, 0x00,
+    0x0c, 0xff, 0xf6, 0xca, 0x62, 0x16, 0x00, 0xff, 0x1c, 0x9c, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xf6,
+    0xfd, 0xff, 0x08, 0x66, 0x2e, 0x8c, 0xcc, 0xee, 0xff, 0xe4, 0xb2, 0x42, 0xfd, 0x00, 0x01, 0x02,
+    0xff, 0xf9, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xf4, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x04, 0x8a, 0xe6, 0xe4, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xd4, 0x04, 0x00, 0x00,  //.%@@%.....+@...
-    0x7c, 0xff, 0x6a, 0x6c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x0c, 0xe0, 0x3a, 0x00, 0x00, 0x00,  //+@++@+....@....
-    0xda, 0xff, 0x14, 0x16, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x90, 0x98, 0x00, 0x00, 0x00, 0x00,  //@@..@@...%%....
-    0xf6, 0xff, 0x02, 0x02, 0xff, 0xf4, 0x00, 0x00, 0x34, 0xe4, 0x0e, 0x00, 0x00, 0x00, 0x00,  //@@..@@...@.....
-    0xda, 0xff, 0x14, 0x14, 0xff, 0xda, 0x00, 0x02, 0xce, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@..@@..@+.....
-    0x80, 0xff, 0x68, 0x68, 0xff, 0x7c, 0x00, 0x74, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@++@+.+%......
-    0x06, 0x8e, 0xe6, 0xe6, 0x8c, 0x04, 0x1e, 0xe8, 0x1e, 0x04, 0x8a, 0xe4, 0xe6, 0x8a, 0x04,  //.%@@%..@..%@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x72, 0x00, 0x7c, 0xff, 0x6a, 0x6a, 0xff, 0x7a,  //......%+.+@++@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xce, 0x02, 0x00, 0xda, 0xff, 0x14, 0x14, 0xff, 0xda,  //.....+@..@@..@@
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0xe4, 0x34, 0x00, 0x00, 0xf6, 0xff, 0x02, 0x02, 0xff, 0xf4,  //.....@...@@..@@
-    0x00, 0x00, 0x00, 0x00, 0x98, 0x90, 0x00, 0x00, 0x00, 0xda, 0xff, 0x14, 0x14, 0xff, 0xda,  //....%%...@@..@@
-    0x00, 0x00, 0x00, 0x3a, 0xe0, 0x0c, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x68, 0x68, 0xff, 0x7c,  //....@....+@++@+
-    0x00, 0x00, 0x04, 0xd4, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8c, 0xe6, 0xe6, 0x8c, 0x04,  //...@+.....%@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xd4, 0x00, 0x05, 0x04, 0x8a, 0xe6, 0xe4, 0x88, 0x04, 0xfd, 0x00, 0x0a, 0x4e, 0xd4, 0x04, 0x00,
+    0x00, 0x7c, 0xff, 0x6a, 0x6c, 0xff, 0x78, 0xfe, 0x00, 0x02, 0x0c, 0xe0, 0x3a, 0xfe, 0x00, 0x05,
+    0xda, 0xff, 0x14, 0x16, 0xff, 0xd8, 0xfe, 0x00, 0x01, 0x90, 0x98, 0xfd, 0x00, 0x0a, 0xf6, 0xff,
+    0x02, 0x02, 0xff, 0xf4, 0x00, 0x00, 0x34, 0xe4, 0x0e, 0xfd, 0x00, 0x09, 0xda, 0xff, 0x14, 0x14,
+    0xff, 0xda, 0x00, 0x02, 0xce, 0x56, 0xfc, 0x00, 0x08, 0x80, 0xff, 0x68, 0x68, 0xff, 0x7c, 0x00,
+    0x74, 0xb4, 0xfb, 0x00, 0x0e, 0x06, 0x8e, 0xe6, 0xe6, 0x8c, 0x04, 0x1e, 0xe8, 0x1e, 0x04, 0x8a,
+    0xe4, 0xe6, 0x8a, 0x04, 0xfb, 0x00, 0x08, 0xb6, 0x72, 0x00, 0x7c, 0xff, 0x6a, 0x6a, 0xff, 0x7a,
+    0xfc, 0x00, 0x09, 0x56, 0xce, 0x02, 0x00, 0xda, 0xff, 0x14, 0x14, 0xff, 0xda, 0xfd, 0x00, 0x0a,
+    0x0e, 0xe4, 0x34, 0x00, 0x00, 0xf6, 0xff, 0x02, 0x02, 0xff, 0xf4, 0xfd, 0x00, 0x01, 0x98, 0x90,
+    0xfe, 0x00, 0x05, 0xda, 0xff, 0x14, 0x14, 0xff, 0xda, 0xfe, 0x00, 0x02, 0x3a, 0xe0, 0x0c, 0xfe,
+    0x00, 0x0a, 0x7e, 0xff, 0x68, 0x68, 0xff, 0x7c, 0x00, 0x00, 0x04, 0xd4, 0x4e, 0xfd, 0x00, 0x05,
+    0x04, 0x8c, 0xe6, 0xe6, 0x8c, 0x04, 0xc5, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x4a, 0xc8, 0xf6, 0xee, 0xb0, 0x42, 0x00, 0x00, 0x00,  //...+@@@%+...
-    0x00, 0x00, 0x54, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..+@@@@@@...
-    0x00, 0x00, 0xde, 0xff, 0x72, 0x0e, 0x08, 0x4a, 0xc0, 0x00, 0x00, 0x00,  //..@@+..+%...
-    0x00, 0x00, 0xfa, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@........
-    0x00, 0x00, 0xb0, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@%.......
-    0x00, 0x04, 0x9a, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@%......
-    0x08, 0xbc, 0xf0, 0x8e, 0xfc, 0xff, 0x96, 0x00, 0x1c, 0xff, 0xe2, 0x00,  //.%@%@@%..@@.
-    0x8c, 0xff, 0x58, 0x00, 0x54, 0xf8, 0xff, 0x9a, 0x54, 0xff, 0x92, 0x00,  //%@+.+@@%+@%.
-    0xe8, 0xff, 0x0e, 0x00, 0x00, 0x46, 0xf4, 0xff, 0xe6, 0xf0, 0x18, 0x00,  //@@...+@@@@..
-    0xf0, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0x50, 0x00, 0x00,  //@@+...+@@+..
-    0xaa, 0xff, 0xe8, 0x5a, 0x14, 0x08, 0x6e, 0xff, 0xff, 0x98, 0x00, 0x00,  //%@@+..+@@%..
-    0x1c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0x8e, 0x00,  //.@@@@@@@@@%.
-    0x00, 0x10, 0x88, 0xd8, 0xf8, 0xec, 0x92, 0x02, 0x56, 0xf2, 0xff, 0x84,  //..%@@@%.+@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xda, 0x00, 0x05, 0x4a, 0xc8, 0xf6, 0xee, 0xb0, 0x42, 0xfc, 0x00, 0x01, 0x54, 0xfc, 0xfc, 0xff,
+    0xfc, 0x00, 0x06, 0xde, 0xff, 0x72, 0x0e, 0x08, 0x4a, 0xc0, 0xfc, 0x00, 0x02, 0xfa, 0xff, 0x0c,
+    0xf8, 0x00, 0x02, 0xb0, 0xff, 0x8c, 0xf9, 0x00, 0x04, 0x04, 0x9a, 0xff, 0xff, 0x94, 0xfb, 0x00,
+    0x26, 0x08, 0xbc, 0xf0, 0x8e, 0xfc, 0xff, 0x96, 0x00, 0x1c, 0xff, 0xe2, 0x00, 0x8c, 0xff, 0x58,
+    0x00, 0x54, 0xf8, 0xff, 0x9a, 0x54, 0xff, 0x92, 0x00, 0xe8, 0xff, 0x0e, 0x00, 0x00, 0x46, 0xf4,
+    0xff, 0xe6, 0xf0, 0x18, 0x00, 0xf0, 0xff, 0x4c, 0xfe, 0x00, 0x13, 0x66, 0xff, 0xff, 0x50, 0x00,
+    0x00, 0xaa, 0xff, 0xe8, 0x5a, 0x14, 0x08, 0x6e, 0xff, 0xff, 0x98, 0x00, 0x00, 0x1c, 0xe0, 0xfc,
+    0xff, 0x10, 0xc6, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x10, 0x88, 0xd8, 0xf8, 0xec, 0x92, 0x02, 0x56,
+    0xf2, 0xff, 0x84, 0xd1, 0x00,
 
     /*Unicode: U+0027 (') , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xfb, 0x00, 0xf7, 0xff, 0xe9, 0x00,
 
     /*Unicode: U+0028 (() , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x84, 0xc6,  //..%@
-    0x00, 0x24, 0xf8, 0x54,  //..@+
-    0x00, 0xa4, 0xee, 0x04,  //.%@.
-    0x18, 0xf8, 0xa2, 0x00,  //.@%.
-    0x6c, 0xff, 0x62, 0x00,  //+@+.
-    0xb0, 0xff, 0x34, 0x00,  //%@..
-    0xdc, 0xff, 0x14, 0x00,  //@@..
-    0xf4, 0xff, 0x06, 0x00,  //@@..
-    0xf4, 0xff, 0x06, 0x00,  //@@..
-    0xdc, 0xff, 0x16, 0x00,  //@@..
-    0xb0, 0xff, 0x36, 0x00,  //%@..
-    0x6c, 0xff, 0x66, 0x00,  //+@+.
-    0x18, 0xf8, 0xa6, 0x00,  //.@%.
-    0x00, 0xa2, 0xf0, 0x04,  //.%@.
-    0x00, 0x22, 0xf6, 0x56,  //..@+
-    0x00, 0x00, 0x82, 0xc6,  //..%@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xf7, 0x00, 0x3d, 0x84, 0xc6, 0x00, 0x24, 0xf8, 0x54, 0x00, 0xa4, 0xee, 0x04, 0x18, 0xf8, 0xa2,
+    0x00, 0x6c, 0xff, 0x62, 0x00, 0xb0, 0xff, 0x34, 0x00, 0xdc, 0xff, 0x14, 0x00, 0xf4, 0xff, 0x06,
+    0x00, 0xf4, 0xff, 0x06, 0x00, 0xdc, 0xff, 0x16, 0x00, 0xb0, 0xff, 0x36, 0x00, 0x6c, 0xff, 0x66,
+    0x00, 0x18, 0xf8, 0xa6, 0x00, 0x00, 0xa2, 0xf0, 0x04, 0x00, 0x22, 0xf6, 0x56, 0x00, 0x00, 0x82,
+    0xc6, 0xf9, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0xc6, 0x82, 0x00, 0x00,  //@%..
-    0x58, 0xf6, 0x22, 0x00,  //+@..
-    0x04, 0xf0, 0xa0, 0x00,  //.@%.
-    0x00, 0xa6, 0xf6, 0x14,  //.%@.
-    0x00, 0x66, 0xff, 0x68,  //.+@+
-    0x00, 0x36, 0xff, 0xae,  //..@%
-    0x00, 0x16, 0xff, 0xdc,  //..@@
-    0x00, 0x06, 0xff, 0xf2,  //..@@
-    0x00, 0x08, 0xff, 0xf2,  //..@@
-    0x00, 0x16, 0xff, 0xdc,  //..@@
-    0x00, 0x36, 0xff, 0xac,  //..@%
-    0x00, 0x66, 0xff, 0x68,  //.+@+
-    0x00, 0xa6, 0xf6, 0x14,  //.%@.
-    0x04, 0xf0, 0xa0, 0x00,  //.@%.
-    0x58, 0xf6, 0x22, 0x00,  //+@..
-    0xc6, 0x82, 0x00, 0x00,  //@%..
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xf9, 0x00, 0x3d, 0xc6, 0x82, 0x00, 0x00, 0x58, 0xf6, 0x22, 0x00, 0x04, 0xf0, 0xa0, 0x00, 0x00,
+    0xa6, 0xf6, 0x14, 0x00, 0x66, 0xff, 0x68, 0x00, 0x36, 0xff, 0xae, 0x00, 0x16, 0xff, 0xdc, 0x00,
+    0x06, 0xff, 0xf2, 0x00, 0x08, 0xff, 0xf2, 0x00, 0x16, 0xff, 0xdc, 0x00, 0x36, 0xff, 0xac, 0x00,
+    0x66, 0xff, 0x68, 0x00, 0xa6, 0xf6, 0x14, 0x04, 0xf0, 0xa0, 0x00, 0x58, 0xf6, 0x22, 0x00, 0xc6,
+    0x82, 0xf7, 0x00,
 
     /*Unicode: U+002a (*) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-    0xa4, 0x2c, 0x00, 0xff, 0x00, 0x2c, 0xa4,  //%..@..%
-    0x5e, 0xe6, 0x52, 0xff, 0x52, 0xe6, 0x5e,  //+@+@+@+
-    0x00, 0x24, 0xcc, 0xff, 0xcc, 0x24, 0x00,  //..@@@..
-    0x00, 0x24, 0xca, 0xff, 0xca, 0x24, 0x00,  //..@@@..
-    0x5c, 0xe6, 0x52, 0xff, 0x54, 0xe6, 0x5c,  //+@+@+@+
-    0xa6, 0x2c, 0x00, 0xff, 0x00, 0x2e, 0xa6,  //%..@..%
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xe9, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x29, 0xa4, 0x2c, 0x00, 0xff, 0x00, 0x2c, 0xa4, 0x5e, 0xe6,
+    0x52, 0xff, 0x52, 0xe6, 0x5e, 0x00, 0x24, 0xcc, 0xff, 0xcc, 0x24, 0x00, 0x00, 0x24, 0xca, 0xff,
+    0xca, 0x24, 0x00, 0x5c, 0xe6, 0x52, 0xff, 0x54, 0xe6, 0x5c, 0xa6, 0x2c, 0x00, 0xff, 0x00, 0x2e,
+    0xa6, 0xfe, 0x00, 0x00, 0xff, 0xbf, 0x00,
 
     /*Unicode: U+002b (+) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xcc, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7,
+    0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xe9, 0xff, 0xfc, 0x00, 0x01,
+    0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff,
+    0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xcc, 0x00,
 
     /*Unicode: U+002c (,) , Width: 3 */
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0xff, 0xff,  //.@@
-    0x10, 0xff, 0xda,  //.@@
-    0x6c, 0xf4, 0x2e,  //+@.
-    0xce, 0x60, 0x00,  //@+.
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-
+    0xd6, 0x00, 0x09, 0xff, 0xff, 0x10, 0xff, 0xda, 0x6c, 0xf4, 0x2e, 0xce, 0x60, 0xfa, 0x00,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xcf, 0x00, 0xf7, 0xff, 0xd9, 0x00,
 
     /*Unicode: U+002e (.) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xe5, 0x00, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+002f (/) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x30, 0xff, 0xdc,  //....@@
-    0x00, 0x00, 0x00, 0x74, 0xff, 0x9a,  //...+@%
-    0x00, 0x00, 0x00, 0xb6, 0xff, 0x58,  //...%@+
-    0x00, 0x00, 0x04, 0xf4, 0xff, 0x16,  //...@@.
-    0x00, 0x00, 0x3c, 0xff, 0xd2, 0x00,  //...@@.
-    0x00, 0x00, 0x80, 0xff, 0x90, 0x00,  //..+@%.
-    0x00, 0x00, 0xc4, 0xff, 0x4c, 0x00,  //..@@+.
-    0x00, 0x0c, 0xfa, 0xfa, 0x0e, 0x00,  //..@@..
-    0x00, 0x4a, 0xff, 0xc8, 0x00, 0x00,  //.+@@..
-    0x00, 0x8c, 0xff, 0x84, 0x00, 0x00,  //.%@%..
-    0x00, 0xd0, 0xff, 0x42, 0x00, 0x00,  //.@@+..
-    0x14, 0xfc, 0xf6, 0x06, 0x00, 0x00,  //.@@...
-    0x56, 0xff, 0xbc, 0x00, 0x00, 0x00,  //+@%...
-    0x9a, 0xff, 0x7a, 0x00, 0x00, 0x00,  //%@+...
-    0xdc, 0xff, 0x38, 0x00, 0x00, 0x00,  //@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xec, 0x00, 0x02, 0x30, 0xff, 0xdc, 0xfe, 0x00, 0x02, 0x74, 0xff, 0x9a, 0xfe, 0x00, 0x0d, 0xb6,
+    0xff, 0x58, 0x00, 0x00, 0x04, 0xf4, 0xff, 0x16, 0x00, 0x00, 0x3c, 0xff, 0xd2, 0xfe, 0x00, 0x02,
+    0x80, 0xff, 0x90, 0xfe, 0x00, 0x0d, 0xc4, 0xff, 0x4c, 0x00, 0x00, 0x0c, 0xfa, 0xfa, 0x0e, 0x00,
+    0x00, 0x4a, 0xff, 0xc8, 0xfe, 0x00, 0x02, 0x8c, 0xff, 0x84, 0xfe, 0x00, 0x0d, 0xd0, 0xff, 0x42,
+    0x00, 0x00, 0x14, 0xfc, 0xf6, 0x06, 0x00, 0x00, 0x56, 0xff, 0xbc, 0xfe, 0x00, 0x02, 0x9a, 0xff,
+    0x7a, 0xfe, 0x00, 0x02, 0xdc, 0xff, 0x38, 0xf2, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x06, 0x7e, 0xdc, 0xf8, 0xdc, 0x7e, 0x04, 0x00,  //..+@@@+..
-    0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00,  //.%@@@@@%.
-    0x46, 0xff, 0xf0, 0x46, 0x06, 0x46, 0xf0, 0xff, 0x44,  //+@@+.+@@+
-    0xa2, 0xff, 0x76, 0x00, 0x00, 0x00, 0x76, 0xff, 0xa0,  //%@+...+@%
-    0xd6, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xd6,  //@@.....@@
-    0xf2, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf0,  //@@.....@@
-    0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa,  //@@.....@@
-    0xf2, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf0,  //@@.....@@
-    0xd6, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xd6,  //@@.....@@
-    0xa2, 0xff, 0x76, 0x00, 0x00, 0x00, 0x76, 0xff, 0xa2,  //%@+...+@%
-    0x48, 0xff, 0xf0, 0x44, 0x06, 0x44, 0xf0, 0xff, 0x46,  //+@@+.+@@+
-    0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x00,  //.%@@@@@%.
-    0x00, 0x06, 0x80, 0xde, 0xf8, 0xde, 0x80, 0x06, 0x00,  //..+@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe5, 0x00, 0x09, 0x06, 0x7e, 0xdc, 0xf8, 0xdc, 0x7e, 0x04, 0x00, 0x00, 0xac, 0xfc, 0xff, 0x0d,
+    0xaa, 0x00, 0x46, 0xff, 0xf0, 0x46, 0x06, 0x46, 0xf0, 0xff, 0x44, 0xa2, 0xff, 0x76, 0xfe, 0x00,
+    0x05, 0x76, 0xff, 0xa0, 0xd6, 0xff, 0x2c, 0xfe, 0x00, 0x05, 0x2c, 0xff, 0xd6, 0xf2, 0xff, 0x0a,
+    0xfe, 0x00, 0x04, 0x0a, 0xff, 0xf0, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfa, 0xf2, 0xff, 0x0a,
+    0xfe, 0x00, 0x05, 0x0a, 0xff, 0xf0, 0xd6, 0xff, 0x2c, 0xfe, 0x00, 0x05, 0x2c, 0xff, 0xd6, 0xa2,
+    0xff, 0x76, 0xfe, 0x00, 0x0d, 0x76, 0xff, 0xa2, 0x48, 0xff, 0xf0, 0x44, 0x06, 0x44, 0xf0, 0xff,
+    0x46, 0x00, 0xae, 0xfc, 0xff, 0x09, 0xac, 0x00, 0x00, 0x06, 0x80, 0xde, 0xf8, 0xde, 0x80, 0x06,
+    0xdc, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x26, 0x76, 0xc6, 0xfc, 0xff, 0x00, 0x00, 0x00,  //.+@@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-    0xd4, 0x7e, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x00,  //@+.@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0x04, 0x26, 0x76, 0xc6, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x04, 0xd4,
+    0x7e, 0x2a, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+    0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+    0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff,
+    0xe1, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x36, 0x98, 0xdc, 0xf8, 0xe0, 0xae, 0x34, 0x00, 0x00,  //.%@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x00,  //@@@@@@@+.
-    0xc4, 0x5e, 0x1c, 0x06, 0x2e, 0xc4, 0xff, 0xd6, 0x00,  //@+...@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xf6, 0x00,  //......@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xd2, 0x00,  //......@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x7a, 0x00,  //.....%@+.
-    0x00, 0x00, 0x00, 0x00, 0x58, 0xfc, 0xd8, 0x08, 0x00,  //....+@@..
-    0x00, 0x00, 0x00, 0x58, 0xfa, 0xf2, 0x2c, 0x00, 0x00,  //...+@@...
-    0x00, 0x00, 0x64, 0xfc, 0xfa, 0x4e, 0x00, 0x00, 0x00,  //..+@@+...
-    0x00, 0x6e, 0xff, 0xfc, 0x60, 0x00, 0x00, 0x00, 0x00,  //.+@@+....
-    0x7a, 0xff, 0xfc, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@+.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe6, 0x00, 0x08, 0x36, 0x98, 0xdc, 0xf8, 0xe0, 0xae, 0x34, 0x00, 0x00, 0xfb, 0xff, 0x0a, 0xfc,
+    0x50, 0x00, 0xc4, 0x5e, 0x1c, 0x06, 0x2e, 0xc4, 0xff, 0xd6, 0xfb, 0x00, 0x02, 0x20, 0xff, 0xf6,
+    0xfb, 0x00, 0x02, 0x14, 0xff, 0xd2, 0xfb, 0x00, 0x02, 0x86, 0xff, 0x7a, 0xfc, 0x00, 0x03, 0x58,
+    0xfc, 0xd8, 0x08, 0xfd, 0x00, 0x03, 0x58, 0xfa, 0xf2, 0x2c, 0xfd, 0x00, 0x03, 0x64, 0xfc, 0xfa,
+    0x4e, 0xfd, 0x00, 0x03, 0x6e, 0xff, 0xfc, 0x60, 0xfd, 0x00, 0x03, 0x7a, 0xff, 0xfc, 0x64, 0xfc,
+    0x00, 0xf9, 0xff, 0x00, 0x12, 0xf9, 0xff, 0x00, 0x12, 0xdd, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x30, 0x8c, 0xd0, 0xf4, 0xf0, 0xd6, 0x9a, 0x2c, 0x00,  //.%@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x56,  //@@@@@@@@+
-    0xc8, 0x6a, 0x26, 0x04, 0x0c, 0x32, 0xa8, 0xff, 0xde,  //@+....%@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xee,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x0a, 0x2c, 0xa2, 0xff, 0x92,  //......%@%
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x74, 0x02,  //..@@@@@+.
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8e, 0x04,  //..@@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0xcc, 0xff, 0x8c,  //.....+@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xe6,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xf2,  //.......@@
-    0xb8, 0x4e, 0x14, 0x02, 0x14, 0x4a, 0xd2, 0xff, 0xb6,  //%+...+@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x28,  //@@@@@@@@.
-    0x38, 0x9e, 0xde, 0xfa, 0xf2, 0xd0, 0x8a, 0x18, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe6, 0x00, 0x08, 0x30, 0x8c, 0xd0, 0xf4, 0xf0, 0xd6, 0x9a, 0x2c, 0x00, 0xfa, 0xff, 0x0a, 0xfa,
+    0x56, 0xc8, 0x6a, 0x26, 0x04, 0x0c, 0x32, 0xa8, 0xff, 0xde, 0xfb, 0x00, 0x02, 0x12, 0xff, 0xee,
+    0xfd, 0x00, 0x06, 0x0a, 0x2c, 0xa2, 0xff, 0x92, 0x00, 0x00, 0xfd, 0xff, 0x04, 0xdc, 0x74, 0x02,
+    0x00, 0x00, 0xfd, 0xff, 0x02, 0xf2, 0x8e, 0x04, 0xfd, 0x00, 0x04, 0x10, 0x44, 0xcc, 0xff, 0x8c,
+    0xfb, 0x00, 0x02, 0x1e, 0xff, 0xe6, 0xfb, 0x00, 0x0b, 0x24, 0xff, 0xf2, 0xb8, 0x4e, 0x14, 0x02,
+    0x14, 0x4a, 0xd2, 0xff, 0xb6, 0xfa, 0xff, 0x09, 0xea, 0x28, 0x38, 0x9e, 0xde, 0xfa, 0xf2, 0xd0,
+    0x8a, 0x18, 0xdc, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x00, 0x00,  //.....%@@..
-    0x00, 0x00, 0x00, 0x00, 0x5a, 0xf8, 0xff, 0xff, 0x00, 0x00,  //....+@@@..
-    0x00, 0x00, 0x00, 0x1a, 0xee, 0x7a, 0xff, 0xff, 0x00, 0x00,  //....@+@@..
-    0x00, 0x00, 0x00, 0xb6, 0xcc, 0x02, 0xff, 0xff, 0x00, 0x00,  //...%@.@@..
-    0x00, 0x00, 0x66, 0xf8, 0x2c, 0x00, 0xff, 0xff, 0x00, 0x00,  //..+@..@@..
-    0x00, 0x22, 0xf2, 0x7a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@+..@@..
-    0x00, 0xc2, 0xca, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@@...@@..
-    0x74, 0xf8, 0x2a, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //+@....@@..
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //......@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xde, 0x00, 0x02, 0xaa, 0xff, 0xff, 0xfb, 0x00, 0x03, 0x5a, 0xf8, 0xff, 0xff, 0xfc, 0x00, 0x04,
+    0x1a, 0xee, 0x7a, 0xff, 0xff, 0xfc, 0x00, 0x04, 0xb6, 0xcc, 0x02, 0xff, 0xff, 0xfd, 0x00, 0x05,
+    0x66, 0xf8, 0x2c, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x06, 0x22, 0xf2, 0x7a, 0x00, 0x00, 0xff, 0xff,
+    0xfe, 0x00, 0x0b, 0xc2, 0xca, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x74, 0xf8, 0x2a, 0xfe,
+    0x00, 0x04, 0xff, 0xff, 0x00, 0x00, 0xf6, 0xee, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00,
+    0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xd7, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@.
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.....
-    0x00, 0xff, 0xff, 0xd4, 0xf6, 0xc4, 0x3c, 0x00,  //.@@@@@..
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2e,  //.@@@@@@.
-    0x00, 0xa2, 0x26, 0x08, 0x3e, 0xd8, 0xff, 0xaa,  //.%...@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xe8,  //......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xfa,  //......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xe4,  //......@@
-    0xb2, 0x40, 0x0a, 0x0e, 0x4c, 0xe0, 0xff, 0x9c,  //%...+@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x1a,  //@@@@@@@.
-    0x40, 0xac, 0xea, 0xf8, 0xde, 0x96, 0x18, 0x00,  //.%@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe8, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00,
+    0x01, 0xff, 0xff, 0xfb, 0x00, 0x07, 0xff, 0xff, 0xd4, 0xf6, 0xc4, 0x3c, 0x00, 0x00, 0xfc, 0xff,
+    0x09, 0xf6, 0x2e, 0x00, 0xa2, 0x26, 0x08, 0x3e, 0xd8, 0xff, 0xaa, 0xfc, 0x00, 0x02, 0x38, 0xff,
+    0xe8, 0xfc, 0x00, 0x02, 0x0a, 0xff, 0xfa, 0xfc, 0x00, 0x0a, 0x3e, 0xff, 0xe4, 0xb2, 0x40, 0x0a,
+    0x0e, 0x4c, 0xe0, 0xff, 0x9c, 0xfb, 0xff, 0x08, 0xe4, 0x1a, 0x40, 0xac, 0xea, 0xf8, 0xde, 0x96,
+    0x18, 0xe0, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x30, 0xac, 0xea, 0xf6, 0xc2, 0x4c, 0x00,  //...%@@@+.
-    0x00, 0x4c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.+@@@@@@.
-    0x16, 0xee, 0xff, 0xb6, 0x2a, 0x06, 0x32, 0xb4, 0x00,  //.@@%...%.
-    0x80, 0xff, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@......
-    0xc8, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-    0xee, 0xff, 0x34, 0x90, 0xee, 0xf2, 0xba, 0x3a, 0x00,  //@@.%@@%..
-    0xfa, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3a,  //@@%@@@@@.
-    0xf2, 0xff, 0xb8, 0x2a, 0x06, 0x2a, 0xba, 0xff, 0xbe,  //@@%...%@%
-    0xd6, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf4,  //@@.....@@
-    0xa0, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf2,  //%@.....@@
-    0x42, 0xff, 0xba, 0x28, 0x06, 0x28, 0xba, 0xff, 0xb8,  //+@%...%@%
-    0x00, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x30,  //.%@@@@@@.
-    0x00, 0x02, 0x76, 0xd8, 0xf8, 0xec, 0xaa, 0x2a, 0x00,  //..+@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe4, 0x00, 0x09, 0x30, 0xac, 0xea, 0xf6, 0xc2, 0x4c, 0x00, 0x00, 0x4c, 0xf8, 0xfc, 0xff, 0x0d,
+    0x00, 0x16, 0xee, 0xff, 0xb6, 0x2a, 0x06, 0x32, 0xb4, 0x00, 0x80, 0xff, 0xd8, 0x06, 0xfc, 0x00,
+    0x02, 0xc8, 0xff, 0x6c, 0xfb, 0x00, 0x0b, 0xee, 0xff, 0x34, 0x90, 0xee, 0xf2, 0xba, 0x3a, 0x00,
+    0xfa, 0xff, 0xa8, 0xfd, 0xff, 0x0d, 0xf8, 0x3a, 0xf2, 0xff, 0xb8, 0x2a, 0x06, 0x2a, 0xba, 0xff,
+    0xbe, 0xd6, 0xff, 0x1a, 0xfe, 0x00, 0x05, 0x1a, 0xff, 0xf4, 0xa0, 0xff, 0x1a, 0xfe, 0x00, 0x0d,
+    0x1a, 0xff, 0xf2, 0x42, 0xff, 0xba, 0x28, 0x06, 0x28, 0xba, 0xff, 0xb8, 0x00, 0xa4, 0xfc, 0xff,
+    0x09, 0xf2, 0x30, 0x00, 0x02, 0x76, 0xd8, 0xf8, 0xec, 0xaa, 0x2a, 0xdc, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0x70,  //.....%@+
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xf0, 0xff, 0x20,  //.....@@.
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xd0, 0x00,  //....+@@.
-    0x00, 0x00, 0x00, 0x00, 0x9c, 0xff, 0x7e, 0x00,  //....%@+.
-    0x00, 0x00, 0x00, 0x02, 0xea, 0xff, 0x2e, 0x00,  //....@@..
-    0x00, 0x00, 0x00, 0x3e, 0xff, 0xdc, 0x00, 0x00,  //....@@..
-    0x00, 0x00, 0x00, 0x90, 0xff, 0x8c, 0x00, 0x00,  //...%@%..
-    0x00, 0x00, 0x00, 0xe0, 0xff, 0x3c, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x34, 0xff, 0xe8, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x84, 0xff, 0x9a, 0x00, 0x00, 0x00,  //..%@%...
-    0x00, 0x00, 0xd6, 0xff, 0x4a, 0x00, 0x00, 0x00,  //..@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0xfa, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x00, 0xc2, 0xfc, 0x00, 0x02, 0xa8, 0xff, 0x70,
+    0xfd, 0x00, 0x03, 0x06, 0xf0, 0xff, 0x20, 0xfd, 0x00, 0x02, 0x4a, 0xff, 0xd0, 0xfc, 0x00, 0x02,
+    0x9c, 0xff, 0x7e, 0xfd, 0x00, 0x03, 0x02, 0xea, 0xff, 0x2e, 0xfd, 0x00, 0x02, 0x3e, 0xff, 0xdc,
+    0xfc, 0x00, 0x02, 0x90, 0xff, 0x8c, 0xfc, 0x00, 0x02, 0xe0, 0xff, 0x3c, 0xfd, 0x00, 0x02, 0x34,
+    0xff, 0xe8, 0xfc, 0x00, 0x02, 0x84, 0xff, 0x9a, 0xfc, 0x00, 0x02, 0xd6, 0xff, 0x4a, 0xde, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x42, 0xb2, 0xe0, 0xf6, 0xe0, 0xb2, 0x42, 0x00,  //.+%@@@%+.
-    0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //+@@@@@@@+
-    0xe4, 0xff, 0x96, 0x1e, 0x04, 0x1e, 0x98, 0xff, 0xe4,  //@@%...%@@
-    0xee, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //@@.....@@
-    0x92, 0xff, 0x94, 0x1c, 0x04, 0x1e, 0x96, 0xff, 0x92,  //%@%...%@%
-    0x02, 0x76, 0xe0, 0xff, 0xff, 0xff, 0xe0, 0x76, 0x02,  //.+@@@@@+.
-    0x02, 0x8c, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0x8c, 0x02,  //.%@@@@@%.
-    0x86, 0xff, 0xb8, 0x28, 0x06, 0x2a, 0xba, 0xff, 0x86,  //%@%...%@%
-    0xe4, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xe4,  //@@.....@@
-    0xf6, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf6,  //@@.....@@
-    0xc8, 0xff, 0xb8, 0x28, 0x06, 0x28, 0xba, 0xff, 0xc6,  //@@%...%@@
-    0x46, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x44,  //+@@@@@@@+
-    0x00, 0x2e, 0xaa, 0xde, 0xf8, 0xea, 0xb2, 0x38, 0x00,  //..%@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe5, 0x00, 0x08, 0x42, 0xb2, 0xe0, 0xf6, 0xe0, 0xb2, 0x42, 0x00, 0x6a, 0xfa, 0xff, 0x0c, 0x6a,
+    0xe4, 0xff, 0x96, 0x1e, 0x04, 0x1e, 0x98, 0xff, 0xe4, 0xee, 0xff, 0x0e, 0xfe, 0x00, 0x0e, 0x10,
+    0xff, 0xec, 0x92, 0xff, 0x94, 0x1c, 0x04, 0x1e, 0x96, 0xff, 0x92, 0x02, 0x76, 0xe0, 0xfe, 0xff,
+    0x05, 0xe0, 0x76, 0x02, 0x02, 0x8c, 0xf2, 0xfe, 0xff, 0x0e, 0xf2, 0x8c, 0x02, 0x86, 0xff, 0xb8,
+    0x28, 0x06, 0x2a, 0xba, 0xff, 0x86, 0xe4, 0xff, 0x1a, 0xfe, 0x00, 0x05, 0x1a, 0xff, 0xe4, 0xf6,
+    0xff, 0x1a, 0xfe, 0x00, 0x0d, 0x1a, 0xff, 0xf6, 0xc8, 0xff, 0xb8, 0x28, 0x06, 0x28, 0xba, 0xff,
+    0xc6, 0x46, 0xfa, 0xfc, 0xff, 0x09, 0xfa, 0x44, 0x00, 0x2e, 0xaa, 0xde, 0xf8, 0xea, 0xb2, 0x38,
+    0xdc, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x2a, 0xaa, 0xea, 0xf8, 0xd6, 0x72, 0x02, 0x00,  //..%@@@+..
-    0x30, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00,  //.@@@@@@%.
-    0xb8, 0xff, 0xbc, 0x2a, 0x06, 0x2a, 0xbc, 0xff, 0x3e,  //%@%...%@.
-    0xf2, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0x9c,  //@@.....@%
-    0xf4, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xd4,  //@@.....@@
-    0xc0, 0xff, 0xba, 0x28, 0x06, 0x28, 0xb8, 0xff, 0xf0,  //%@%...%@@
-    0x40, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xfa,  //.@@@@@%@@
-    0x00, 0x3e, 0xbc, 0xf2, 0xee, 0x90, 0x34, 0xff, 0xee,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xc6,  //......+@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd6, 0xff, 0x7e,  //......@@+
-    0x00, 0xb2, 0x30, 0x04, 0x28, 0xb4, 0xff, 0xee, 0x16,  //.%...%@@.
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4c, 0x00,  //.@@@@@@+.
-    0x00, 0x4c, 0xc2, 0xf6, 0xea, 0xac, 0x30, 0x00, 0x00,  //.+@@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe5, 0x00, 0x09, 0x2a, 0xaa, 0xea, 0xf8, 0xd6, 0x72, 0x02, 0x00, 0x30, 0xf2, 0xfc, 0xff, 0x0d,
+    0x9c, 0x00, 0xb8, 0xff, 0xbc, 0x2a, 0x06, 0x2a, 0xbc, 0xff, 0x3e, 0xf2, 0xff, 0x1a, 0xfe, 0x00,
+    0x05, 0x1a, 0xff, 0x9c, 0xf4, 0xff, 0x1a, 0xfe, 0x00, 0x0d, 0x1a, 0xff, 0xd4, 0xc0, 0xff, 0xba,
+    0x28, 0x06, 0x28, 0xb8, 0xff, 0xf0, 0x40, 0xfa, 0xfd, 0xff, 0x0b, 0xaa, 0xff, 0xfa, 0x00, 0x3e,
+    0xbc, 0xf2, 0xee, 0x90, 0x34, 0xff, 0xee, 0xfb, 0x00, 0x02, 0x6c, 0xff, 0xc6, 0xfc, 0x00, 0x0d,
+    0x04, 0xd6, 0xff, 0x7e, 0x00, 0xb2, 0x30, 0x04, 0x28, 0xb4, 0xff, 0xee, 0x16, 0x00, 0xfc, 0xff,
+    0x09, 0xf8, 0x4c, 0x00, 0x00, 0x4c, 0xc2, 0xf6, 0xea, 0xac, 0x30, 0xdb, 0x00,
 
     /*Unicode: U+003a (:) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xf3, 0x00, 0xfd, 0xff, 0xf7, 0x00, 0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+003b (;) , Width: 3 */
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0xff, 0xff,  //.@@
-    0x00, 0xff, 0xff,  //.@@
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0xff, 0xff,  //.@@
-    0x10, 0xff, 0xda,  //.@@
-    0x6c, 0xf4, 0x2e,  //+@.
-    0xce, 0x60, 0x00,  //@+.
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-
+    0xeb, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf1, 0x00, 0x09, 0xff, 0xff, 0x10, 0xff, 0xda,
+    0x6c, 0xf4, 0x2e, 0xce, 0x60, 0xfa, 0x00,
 
     /*Unicode: U+003c (<) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6a, 0xcc,  //.........+@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa4, 0xf6, 0xff, 0xff,  //.......%@@@
-    0x00, 0x00, 0x00, 0x1a, 0x7a, 0xdc, 0xff, 0xff, 0xfc, 0xb6, 0x54,  //....+@@@@%+
-    0x04, 0x52, 0xb4, 0xfc, 0xff, 0xff, 0xde, 0x7c, 0x1c, 0x00, 0x00,  //.+%@@@@+...
-    0xea, 0xff, 0xff, 0xf6, 0xa4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.....
-    0xea, 0xff, 0xff, 0xf6, 0xa4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.....
-    0x04, 0x54, 0xb6, 0xfc, 0xff, 0xff, 0xdc, 0x7c, 0x1c, 0x00, 0x00,  //.+%@@@@+...
-    0x00, 0x00, 0x00, 0x1c, 0x7c, 0xdc, 0xff, 0xff, 0xfc, 0xb6, 0x54,  //....+@@@@%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xa4, 0xf6, 0xff, 0xff,  //......+%@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6a, 0xce,  //.........+@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xb7, 0x00, 0x02, 0x10, 0x6a, 0xcc, 0xfb, 0x00, 0x04, 0x40, 0xa4, 0xf6, 0xff, 0xff, 0xfe, 0x00,
+    0x18, 0x1a, 0x7a, 0xdc, 0xff, 0xff, 0xfc, 0xb6, 0x54, 0x04, 0x52, 0xb4, 0xfc, 0xff, 0xff, 0xde,
+    0x7c, 0x1c, 0x00, 0x00, 0xea, 0xff, 0xff, 0xf6, 0xa4, 0x42, 0xfc, 0x00, 0x05, 0xea, 0xff, 0xff,
+    0xf6, 0xa4, 0x42, 0xfc, 0x00, 0x08, 0x04, 0x54, 0xb6, 0xfc, 0xff, 0xff, 0xdc, 0x7c, 0x1c, 0xfc,
+    0x00, 0x07, 0x1c, 0x7c, 0xdc, 0xff, 0xff, 0xfc, 0xb6, 0x54, 0xfb, 0x00, 0x04, 0x42, 0xa4, 0xf6,
+    0xff, 0xff, 0xf9, 0x00, 0x02, 0x10, 0x6a, 0xce, 0xd5, 0x00,
 
     /*Unicode: U+003d (=) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xb4, 0x00, 0xeb, 0xff, 0xeb, 0x00, 0xeb, 0xff, 0xb4, 0x00,
 
     /*Unicode: U+003e (>) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xcc, 0x6a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.........
-    0xff, 0xff, 0xf6, 0xa4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%.......
-    0x54, 0xb8, 0xfc, 0xff, 0xff, 0xdc, 0x7a, 0x1a, 0x00, 0x00, 0x00,  //+%@@@@+....
-    0x00, 0x00, 0x1c, 0x7e, 0xde, 0xff, 0xff, 0xfc, 0xb4, 0x52, 0x04,  //...+@@@@%+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xa6, 0xf6, 0xff, 0xff, 0xea,  //.....+%@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xa6, 0xf6, 0xff, 0xff, 0xea,  //.....+%@@@@
-    0x00, 0x00, 0x1c, 0x7c, 0xde, 0xff, 0xff, 0xfc, 0xb6, 0x52, 0x04,  //...+@@@@%+.
-    0x54, 0xb6, 0xfc, 0xff, 0xff, 0xdc, 0x7c, 0x1a, 0x00, 0x00, 0x00,  //+%@@@@+....
-    0xff, 0xff, 0xf6, 0xa4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%+......
-    0xce, 0x6a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xbf, 0x00, 0x02, 0xcc, 0x6a, 0x0e, 0xf9, 0x00, 0x04, 0xff, 0xff, 0xf6, 0xa4, 0x40, 0xfb, 0x00,
+    0x07, 0x54, 0xb8, 0xfc, 0xff, 0xff, 0xdc, 0x7a, 0x1a, 0xfc, 0x00, 0x08, 0x1c, 0x7e, 0xde, 0xff,
+    0xff, 0xfc, 0xb4, 0x52, 0x04, 0xfc, 0x00, 0x05, 0x44, 0xa6, 0xf6, 0xff, 0xff, 0xea, 0xfc, 0x00,
+    0x18, 0x42, 0xa6, 0xf6, 0xff, 0xff, 0xea, 0x00, 0x00, 0x1c, 0x7c, 0xde, 0xff, 0xff, 0xfc, 0xb6,
+    0x52, 0x04, 0x54, 0xb6, 0xfc, 0xff, 0xff, 0xdc, 0x7c, 0x1a, 0xfe, 0x00, 0x04, 0xff, 0xff, 0xf6,
+    0xa4, 0x42, 0xfb, 0x00, 0x02, 0xce, 0x6a, 0x10, 0xcd, 0x00,
 
     /*Unicode: U+003f (?) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x40, 0xac, 0xe8, 0xf6, 0xd2, 0x68, 0x00,  //.%@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@+
-    0xc2, 0x4e, 0x0c, 0x12, 0x94, 0xff, 0xda,  //@+..%@@
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xf2,  //.....@@
-    0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xa4,  //....+@%
-    0x00, 0x00, 0x00, 0x20, 0xe4, 0xd0, 0x10,  //....@@.
-    0x00, 0x00, 0x26, 0xe2, 0xd6, 0x14, 0x00,  //...@@..
-    0x00, 0x00, 0xc4, 0xff, 0x38, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xf8, 0xff, 0x02, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xec, 0x00, 0x06, 0x40, 0xac, 0xe8, 0xf6, 0xd2, 0x68, 0x00, 0xfb, 0xff, 0x07, 0x70, 0xc2, 0x4e,
+    0x0c, 0x12, 0x94, 0xff, 0xda, 0xfd, 0x00, 0x02, 0x0c, 0xff, 0xf2, 0xfd, 0x00, 0x02, 0x46, 0xff,
+    0xa4, 0xfe, 0x00, 0x09, 0x20, 0xe4, 0xd0, 0x10, 0x00, 0x00, 0x26, 0xe2, 0xd6, 0x14, 0xfe, 0x00,
+    0x02, 0xc4, 0xff, 0x38, 0xfd, 0x00, 0x02, 0xf8, 0xff, 0x02, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf5,
+    0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xe2, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 16 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-    0x00, 0x00, 0x00, 0x00, 0x1e, 0x82, 0xca, 0xec, 0xf6, 0xe0, 0xb4, 0x66, 0x08, 0x00, 0x00, 0x00,  //.....%@@@@%+....
-    0x00, 0x00, 0x02, 0x8a, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x4c, 0x00, 0x00,  //...%@@@@@@@@@+..
-    0x00, 0x04, 0xb8, 0xff, 0xfa, 0x9a, 0x3e, 0x0e, 0x04, 0x1a, 0x56, 0xbc, 0xff, 0xfc, 0x60, 0x00,  //..%@@%....+%@@+.
-    0x00, 0x94, 0xff, 0xe6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfa, 0xf8, 0x2a,  //.%@@........+@@.
-    0x2c, 0xfc, 0xf8, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xa2,  //.@@..........+@%
-    0x90, 0xff, 0x94, 0x00, 0x00, 0x20, 0xca, 0xe6, 0x34, 0xff, 0xff, 0x00, 0x00, 0x1a, 0xff, 0xe6,  //%@%...@@.@@...@@
-    0xd4, 0xff, 0x36, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@...%@@@@@...@@
-    0xf2, 0xff, 0x0e, 0x00, 0x00, 0xee, 0xff, 0x32, 0x36, 0xff, 0xff, 0x00, 0x00, 0x5e, 0xff, 0xce,  //@@...@@..@@..+@@
-    0xf4, 0xff, 0x0a, 0x00, 0x00, 0xee, 0xff, 0x32, 0x32, 0xff, 0xff, 0x1c, 0x72, 0xf2, 0xff, 0x56,  //@@...@@..@@.+@@+
-    0xda, 0xff, 0x2e, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x6a, 0x00,  //@@...%@@@@@@@@+.
-    0x9e, 0xff, 0x84, 0x00, 0x00, 0x22, 0xcc, 0xe6, 0x36, 0xf6, 0xe2, 0xba, 0x76, 0x18, 0x00, 0x00,  //%@%...@@.@@%+...
-    0x40, 0xff, 0xf2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@.............
-    0x00, 0xb4, 0xff, 0xd6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@............
-    0x00, 0x12, 0xd8, 0xff, 0xf0, 0x80, 0x2c, 0x08, 0x08, 0x2c, 0x80, 0xd6, 0x2a, 0x00, 0x00, 0x00,  //..@@@+....+@....
-    0x00, 0x00, 0x12, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x1c, 0x00, 0x00, 0x00,  //...%@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0xa8, 0xe2, 0xf8, 0xe8, 0xb4, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+%@@@%+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+    0xcd, 0x00, 0x08, 0x1e, 0x82, 0xca, 0xec, 0xf6, 0xe0, 0xb4, 0x66, 0x08, 0xfc, 0x00, 0x02, 0x02,
+    0x8a, 0xf8, 0xfa, 0xff, 0x01, 0xe2, 0x4c, 0xfe, 0x00, 0x13, 0x04, 0xb8, 0xff, 0xfa, 0x9a, 0x3e,
+    0x0e, 0x04, 0x1a, 0x56, 0xbc, 0xff, 0xfc, 0x60, 0x00, 0x00, 0x94, 0xff, 0xe6, 0x38, 0xfa, 0x00,
+    0x07, 0x60, 0xfa, 0xf8, 0x2a, 0x2c, 0xfc, 0xf8, 0x32, 0xf8, 0x00, 0x4b, 0x7e, 0xff, 0xa2, 0x90,
+    0xff, 0x94, 0x00, 0x00, 0x20, 0xca, 0xe6, 0x34, 0xff, 0xff, 0x00, 0x00, 0x1a, 0xff, 0xe6, 0xd4,
+    0xff, 0x36, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xc8, 0xff, 0xff, 0x00, 0x00, 0x0e, 0xff, 0xf6, 0xf2,
+    0xff, 0x0e, 0x00, 0x00, 0xee, 0xff, 0x32, 0x36, 0xff, 0xff, 0x00, 0x00, 0x5e, 0xff, 0xce, 0xf4,
+    0xff, 0x0a, 0x00, 0x00, 0xee, 0xff, 0x32, 0x32, 0xff, 0xff, 0x1c, 0x72, 0xf2, 0xff, 0x56, 0xda,
+    0xff, 0x2e, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xc8, 0xfd, 0xff, 0x16, 0xf4, 0x6a, 0x00, 0x9e, 0xff,
+    0x84, 0x00, 0x00, 0x22, 0xcc, 0xe6, 0x36, 0xf6, 0xe2, 0xba, 0x76, 0x18, 0x00, 0x00, 0x40, 0xff,
+    0xf2, 0x22, 0xf4, 0x00, 0x03, 0xb4, 0xff, 0xd6, 0x20, 0xf5, 0x00, 0x0b, 0x12, 0xd8, 0xff, 0xf0,
+    0x80, 0x2c, 0x08, 0x08, 0x2c, 0x80, 0xd6, 0x2a, 0xfc, 0x00, 0x01, 0x12, 0xba, 0xfa, 0xff, 0x01,
+    0xc4, 0x1c, 0xfa, 0x00, 0x06, 0x4a, 0xa8, 0xe2, 0xf8, 0xe8, 0xb4, 0x54, 0xec, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xea, 0xec, 0x06, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x28, 0xff, 0xc6, 0xc4, 0xff, 0x2a, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x90, 0xff, 0x64, 0x5c, 0xff, 0x92, 0x00, 0x00, 0x00,  //...%@++@%...
-    0x00, 0x00, 0x08, 0xee, 0xf4, 0x0c, 0x06, 0xea, 0xee, 0x08, 0x00, 0x00,  //...@@..@@...
-    0x00, 0x00, 0x5e, 0xff, 0xa0, 0x00, 0x00, 0x8c, 0xff, 0x60, 0x00, 0x00,  //..+@%..%@+..
-    0x00, 0x00, 0xc6, 0xff, 0x3e, 0x00, 0x00, 0x24, 0xfc, 0xc6, 0x00, 0x00,  //..@@....@@..
-    0x00, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x00,  //..@@@@@@@@..
-    0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00,  //.%@@@@@@@@%.
-    0x0a, 0xf0, 0xfc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0xf0, 0x0a,  //.@@......@@.
-    0x64, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x62,  //+@%......%@+
-    0xca, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xca,  //@@+......+@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xd9, 0x00, 0x03, 0x06, 0xea, 0xec, 0x06, 0xf9, 0x00, 0x03, 0x5a, 0xff, 0xff, 0x5c, 0xf9, 0x00,
+    0x03, 0xc2, 0xff, 0xff, 0xc4, 0xfa, 0x00, 0x05, 0x28, 0xff, 0xc6, 0xc4, 0xff, 0x2a, 0xfb, 0x00,
+    0x05, 0x90, 0xff, 0x64, 0x5c, 0xff, 0x92, 0xfc, 0x00, 0x07, 0x08, 0xee, 0xf4, 0x0c, 0x06, 0xea,
+    0xee, 0x08, 0xfd, 0x00, 0x07, 0x5e, 0xff, 0xa0, 0x00, 0x00, 0x8c, 0xff, 0x60, 0xfd, 0x00, 0x07,
+    0xc6, 0xff, 0x3e, 0x00, 0x00, 0x24, 0xfc, 0xc6, 0xfe, 0x00, 0x00, 0x2e, 0xf9, 0xff, 0x03, 0x2e,
+    0x00, 0x00, 0x94, 0xf9, 0xff, 0x05, 0x94, 0x00, 0x0a, 0xf0, 0xfc, 0x1c, 0xfd, 0x00, 0x06, 0x1c,
+    0xfc, 0xf0, 0x0a, 0x64, 0xff, 0xb6, 0xfb, 0x00, 0x05, 0xb6, 0xff, 0x62, 0xca, 0xff, 0x54, 0xfb,
+    0x00, 0x02, 0x54, 0xff, 0xca, 0xd1, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xce, 0x68, 0x00, 0x00,  //@@@@@@+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00,  //@@@@@@@%.
-    0xff, 0xff, 0x00, 0x00, 0x0c, 0x7a, 0xff, 0xea, 0x00,  //@@...+@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf0, 0x00,  //@@....@@.
-    0xff, 0xff, 0x00, 0x00, 0x0c, 0x76, 0xff, 0xac, 0x00,  //@@...+@%.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x98, 0x10, 0x00,  //@@@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x60, 0x00,  //@@@@@@@+.
-    0xff, 0xff, 0x00, 0x00, 0x06, 0x2c, 0xb4, 0xff, 0x66,  //@@....%@+
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xda,  //@@.....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf6,  //@@.....@@
-    0xff, 0xff, 0x00, 0x00, 0x06, 0x2c, 0xb4, 0xff, 0xcc,  //@@....%@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x46,  //@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0xe4, 0xaa, 0x36, 0x00,  //@@@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe6, 0x00, 0xfd, 0xff, 0x04, 0xf2, 0xce, 0x68, 0x00, 0x00, 0xfa, 0xff, 0x0c, 0x88, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x0c, 0x7a, 0xff, 0xea, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x0c, 0x0a, 0xff, 0xf0,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0x0c, 0x76, 0xff, 0xac, 0x00, 0xfc, 0xff, 0x03, 0xf6, 0x98, 0x10,
+    0x00, 0xfb, 0xff, 0x0d, 0xdc, 0x60, 0x00, 0xff, 0xff, 0x00, 0x00, 0x06, 0x2c, 0xb4, 0xff, 0x66,
+    0xff, 0xff, 0xfd, 0x00, 0x04, 0x18, 0xff, 0xda, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0x18, 0xff, 0xf6,
+    0xff, 0xff, 0x00, 0x00, 0x06, 0x2c, 0xb4, 0xff, 0xcc, 0xfa, 0xff, 0x01, 0xfa, 0x46, 0xfd, 0xff,
+    0x03, 0xfa, 0xe4, 0xaa, 0x36, 0xdc, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x02, 0x5e, 0xb6, 0xe6, 0xf8, 0xf2, 0xd2, 0x96, 0x36,  //...+%@@@@%.
-    0x00, 0x18, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@@@@@
-    0x04, 0xca, 0xff, 0xe2, 0x66, 0x1e, 0x04, 0x08, 0x28, 0x64, 0xc4,  //.@@@+....+@
-    0x64, 0xff, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0xbc, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0xea, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xea, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.........
-    0xbc, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0x64, 0xff, 0xdc, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0x04, 0xcc, 0xff, 0xe0, 0x64, 0x1e, 0x04, 0x08, 0x26, 0x64, 0xc4,  //.@@@+....+@
-    0x00, 0x1a, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@@@@@
-    0x00, 0x00, 0x04, 0x60, 0xb8, 0xe8, 0xfa, 0xf2, 0xd2, 0x94, 0x36,  //...+%@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xde, 0x00, 0x0b, 0x02, 0x5e, 0xb6, 0xe6, 0xf8, 0xf2, 0xd2, 0x96, 0x36, 0x00, 0x18, 0xc8, 0xf9,
+    0xff, 0x0e, 0x04, 0xca, 0xff, 0xe2, 0x66, 0x1e, 0x04, 0x08, 0x28, 0x64, 0xc4, 0x64, 0xff, 0xde,
+    0x14, 0xfa, 0x00, 0x02, 0xbc, 0xff, 0x5c, 0xf9, 0x00, 0x02, 0xea, 0xff, 0x16, 0xf9, 0x00, 0x02,
+    0xfa, 0xff, 0x02, 0xf9, 0x00, 0x02, 0xea, 0xff, 0x16, 0xf9, 0x00, 0x02, 0xbc, 0xff, 0x5c, 0xf9,
+    0x00, 0x03, 0x64, 0xff, 0xdc, 0x14, 0xfa, 0x00, 0x0d, 0x04, 0xcc, 0xff, 0xe0, 0x64, 0x1e, 0x04,
+    0x08, 0x26, 0x64, 0xc4, 0x00, 0x1a, 0xca, 0xf9, 0xff, 0x0a, 0x00, 0x00, 0x04, 0x60, 0xb8, 0xe8,
+    0xfa, 0xf2, 0xd2, 0x94, 0x36, 0xd5, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xe0, 0xb2, 0x68, 0x0a, 0x00, 0x00,  //@@@@@@%+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x32, 0x00,  //@@@@@@@@@..
-    0xff, 0xff, 0x00, 0x00, 0x06, 0x1e, 0x5e, 0xd6, 0xff, 0xe8, 0x12,  //@@....+@@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd0, 0xff, 0x7e,  //@@......@@+
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xc6,  //@@......+@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xec,  //@@.......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfa,  //@@.......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xec,  //@@.......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xc6,  //@@......+@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd0, 0xff, 0x7c,  //@@......@@+
-    0xff, 0xff, 0x00, 0x00, 0x04, 0x1e, 0x5c, 0xd6, 0xff, 0xe8, 0x12,  //@@....+@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x32, 0x00,  //@@@@@@@@@..
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xe2, 0xb4, 0x68, 0x0a, 0x00, 0x00,  //@@@@@@%+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xe0, 0x00, 0xfd, 0xff, 0x06, 0xf2, 0xe0, 0xb2, 0x68, 0x0a, 0x00, 0x00, 0xf9, 0xff, 0x0f, 0xe0,
+    0x32, 0x00, 0xff, 0xff, 0x00, 0x00, 0x06, 0x1e, 0x5e, 0xd6, 0xff, 0xe8, 0x12, 0xff, 0xff, 0xfc,
+    0x00, 0x05, 0x0a, 0xd0, 0xff, 0x7e, 0xff, 0xff, 0xfb, 0x00, 0x04, 0x50, 0xff, 0xc6, 0xff, 0xff,
+    0xfb, 0x00, 0x04, 0x14, 0xff, 0xec, 0xff, 0xff, 0xfb, 0x00, 0x04, 0x02, 0xff, 0xfa, 0xff, 0xff,
+    0xfb, 0x00, 0x04, 0x14, 0xff, 0xec, 0xff, 0xff, 0xfb, 0x00, 0x04, 0x52, 0xff, 0xc6, 0xff, 0xff,
+    0xfc, 0x00, 0x0e, 0x0a, 0xd0, 0xff, 0x7c, 0xff, 0xff, 0x00, 0x00, 0x04, 0x1e, 0x5c, 0xd6, 0xff,
+    0xe8, 0x12, 0xf9, 0xff, 0x02, 0xe0, 0x32, 0x00, 0xfd, 0xff, 0x04, 0xf4, 0xe2, 0xb4, 0x68, 0x0a,
+    0xd3, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0xef, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+    0xef, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+    0xff, 0xfb, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0xef, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+    0xfa, 0xff, 0x00, 0x00, 0xfa, 0xff, 0x02, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+    0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+    0x01, 0xff, 0xff, 0xdb, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x08, 0x6c, 0xbe, 0xea, 0xfa, 0xf0, 0xce, 0x92, 0x36,  //...+%@@@@%.
-    0x00, 0x22, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@@@@@
-    0x08, 0xd6, 0xff, 0xd8, 0x5c, 0x1a, 0x04, 0x0a, 0x2a, 0x68, 0xc6,  //.@@@+....+@
-    0x6c, 0xff, 0xd4, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@........
-    0xc0, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@+........
-    0xec, 0xff, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@....@@@@@
-    0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@....@@@@@
-    0xec, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.......@@
-    0xc2, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@+......@@
-    0x72, 0xff, 0xc8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //+@@......@@
-    0x0c, 0xde, 0xff, 0xc4, 0x46, 0x0e, 0x04, 0x1e, 0x6e, 0xff, 0xff,  //.@@@+...+@@
-    0x00, 0x2c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x66,  //..@@@@@@@@+
-    0x00, 0x00, 0x0e, 0x7a, 0xca, 0xf0, 0xf8, 0xdc, 0x96, 0x24, 0x00,  //...+@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xde, 0x00, 0x0b, 0x08, 0x6c, 0xbe, 0xea, 0xfa, 0xf0, 0xce, 0x92, 0x36, 0x00, 0x22, 0xd6, 0xf9,
+    0xff, 0x0e, 0x08, 0xd6, 0xff, 0xd8, 0x5c, 0x1a, 0x04, 0x0a, 0x2a, 0x68, 0xc6, 0x6c, 0xff, 0xd4,
+    0x0c, 0xfa, 0x00, 0x02, 0xc0, 0xff, 0x54, 0xf9, 0x00, 0x02, 0xec, 0xff, 0x14, 0xfe, 0x00, 0xfc,
+    0xff, 0x02, 0xfa, 0xff, 0x02, 0xfe, 0x00, 0xfc, 0xff, 0x02, 0xec, 0xff, 0x12, 0xfb, 0x00, 0x04,
+    0xff, 0xff, 0xc2, 0xff, 0x4c, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x72, 0xff, 0xc8, 0x04, 0xfc, 0x00,
+    0x0f, 0xff, 0xff, 0x0c, 0xde, 0xff, 0xc4, 0x46, 0x0e, 0x04, 0x1e, 0x6e, 0xff, 0xff, 0x00, 0x2c,
+    0xe0, 0xfb, 0xff, 0x0b, 0xf8, 0x66, 0x00, 0x00, 0x0e, 0x7a, 0xca, 0xf0, 0xf8, 0xdc, 0x96, 0x24,
+    0xd4, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe3, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd,
+    0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xe9, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd,
+    0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0x01,
+    0xff, 0xff, 0xd9, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xfb, 0x00, 0xe7, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+004a (J) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x04, 0xff, 0xf8,  //..@@
-    0x00, 0x2a, 0xff, 0xe0,  //..@@
-    0x24, 0xb8, 0xff, 0xa6,  //.%@%
-    0xff, 0xff, 0xf8, 0x32,  //@@@.
-    0xf0, 0xbc, 0x3e, 0x00,  //@%..
-
+    0xf3, 0x00, 0x41, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x04, 0xff, 0xf8, 0x00, 0x2a, 0xff, 0xe0, 0x24, 0xb8, 0xff, 0xa6, 0xff, 0xff, 0xf8,
+    0x32, 0xf0, 0xbc, 0x3e, 0x00,
 
     /*Unicode: U+004b (K) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x22, 0xe0, 0xff, 0x78, 0x00,  //@@.....@@+.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x26, 0xe4, 0xfc, 0x6c, 0x00, 0x00,  //@@....@@+..
-    0xff, 0xff, 0x00, 0x00, 0x28, 0xe6, 0xfc, 0x60, 0x00, 0x00, 0x00,  //@@...@@+...
-    0xff, 0xff, 0x00, 0x2c, 0xe8, 0xf8, 0x54, 0x00, 0x00, 0x00, 0x00,  //@@..@@+....
-    0xff, 0xff, 0x30, 0xea, 0xf6, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.@@+.....
-    0xff, 0xff, 0xee, 0xf2, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@+......
-    0xff, 0xff, 0xf6, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@.......
-    0xff, 0xff, 0x4c, 0xf8, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+@@......
-    0xff, 0xff, 0x00, 0x52, 0xfa, 0xec, 0x30, 0x00, 0x00, 0x00, 0x00,  //@@.+@@.....
-    0xff, 0xff, 0x00, 0x00, 0x5a, 0xfc, 0xee, 0x36, 0x00, 0x00, 0x00,  //@@..+@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x62, 0xfc, 0xf0, 0x3a, 0x00, 0x00,  //@@...+@@...
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xf2, 0x40, 0x00,  //@@....+@@..
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xf4, 0x44,  //@@.....+@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xe0, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x06, 0x22, 0xe0, 0xff, 0x78, 0x00, 0xff, 0xff, 0xfe,
+    0x00, 0x0d, 0x26, 0xe4, 0xfc, 0x6c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x28, 0xe6, 0xfc, 0x60,
+    0xfe, 0x00, 0x06, 0xff, 0xff, 0x00, 0x2c, 0xe8, 0xf8, 0x54, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x30,
+    0xea, 0xf6, 0x4a, 0xfc, 0x00, 0x04, 0xff, 0xff, 0xee, 0xf2, 0x42, 0xfb, 0x00, 0x04, 0xff, 0xff,
+    0xf6, 0xe6, 0x28, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x4c, 0xf8, 0xe8, 0x2c, 0xfc, 0x00, 0x06, 0xff,
+    0xff, 0x00, 0x52, 0xfa, 0xec, 0x30, 0xfd, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0x5a, 0xfc, 0xee,
+    0x36, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x07, 0x62, 0xfc, 0xf0, 0x3a, 0x00, 0x00, 0xff,
+    0xff, 0xfd, 0x00, 0x06, 0x6a, 0xff, 0xf2, 0x40, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x03, 0x72, 0xff,
+    0xf4, 0x44, 0xd5, 0x00,
 
     /*Unicode: U+004c (L) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+    0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+    0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+    0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+004d (M) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff,  //@@@+....+@@@
-    0xff, 0xff, 0xf2, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xf2, 0xff, 0xff,  //@@@%....%@@@
-    0xff, 0xff, 0xa0, 0xfc, 0x20, 0x00, 0x00, 0x12, 0xf8, 0xa0, 0xff, 0xff,  //@@%@....@%@@
-    0xff, 0xff, 0x40, 0xff, 0x80, 0x00, 0x00, 0x70, 0xff, 0x40, 0xff, 0xff,  //@@.@+..+@.@@
-    0xff, 0xff, 0x00, 0xe0, 0xde, 0x00, 0x00, 0xd2, 0xde, 0x00, 0xff, 0xff,  //@@.@@..@@.@@
-    0xff, 0xff, 0x00, 0x82, 0xff, 0x3e, 0x38, 0xff, 0x80, 0x00, 0xff, 0xff,  //@@.%@..@+.@@
-    0xff, 0xff, 0x00, 0x22, 0xff, 0x9e, 0x9c, 0xff, 0x22, 0x00, 0xff, 0xff,  //@@..@%%@..@@
-    0xff, 0xff, 0x00, 0x00, 0xc2, 0xf2, 0xf2, 0xc2, 0x00, 0x00, 0xff, 0xff,  //@@..@@@@..@@
-    0xff, 0xff, 0x00, 0x00, 0x62, 0xff, 0xff, 0x62, 0x00, 0x00, 0xff, 0xff,  //@@..+@@+..@@
-    0xff, 0xff, 0x00, 0x00, 0x0c, 0xf4, 0xf4, 0x0c, 0x00, 0x00, 0xff, 0xff,  //@@...@@...@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@........@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@........@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@........@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdd, 0x00, 0xfe, 0xff, 0x00, 0x62, 0xfd, 0x00, 0x00, 0x44, 0xfc, 0xff, 0x01, 0xf2, 0xc0, 0xfd,
+    0x00, 0x01, 0xa8, 0xf2, 0xfd, 0xff, 0x07, 0xa0, 0xfc, 0x20, 0x00, 0x00, 0x12, 0xf8, 0xa0, 0xfd,
+    0xff, 0x07, 0x40, 0xff, 0x80, 0x00, 0x00, 0x70, 0xff, 0x40, 0xfd, 0xff, 0x07, 0x00, 0xe0, 0xde,
+    0x00, 0x00, 0xd2, 0xde, 0x00, 0xfd, 0xff, 0x07, 0x00, 0x82, 0xff, 0x3e, 0x38, 0xff, 0x80, 0x00,
+    0xfd, 0xff, 0x07, 0x00, 0x22, 0xff, 0x9e, 0x9c, 0xff, 0x22, 0x00, 0xfd, 0xff, 0x07, 0x00, 0x00,
+    0xc2, 0xf2, 0xf2, 0xc2, 0x00, 0x00, 0xfd, 0xff, 0x07, 0x00, 0x00, 0x62, 0xff, 0xff, 0x62, 0x00,
+    0x00, 0xfd, 0xff, 0x07, 0x00, 0x00, 0x0c, 0xf4, 0xf4, 0x0c, 0x00, 0x00, 0xfd, 0xff, 0xf9, 0x00,
+    0xfd, 0xff, 0xf9, 0x00, 0xfd, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xd1, 0x00,
 
     /*Unicode: U+004e (N) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@%.....@@
-    0xff, 0xff, 0xf8, 0x26, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@.....@@
-    0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@%....@@
-    0xff, 0xff, 0xb4, 0xff, 0x4e, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@%@+...@@
-    0xff, 0xff, 0x26, 0xfa, 0xdc, 0x06, 0x00, 0x00, 0xff, 0xff,  //@@.@@...@@
-    0xff, 0xff, 0x00, 0x8e, 0xff, 0x7c, 0x00, 0x00, 0xff, 0xff,  //@@.%@+..@@
-    0xff, 0xff, 0x00, 0x10, 0xea, 0xf4, 0x1c, 0x00, 0xff, 0xff,  //@@..@@..@@
-    0xff, 0xff, 0x00, 0x00, 0x68, 0xff, 0xaa, 0x00, 0xff, 0xff,  //@@..+@%.@@
-    0xff, 0xff, 0x00, 0x00, 0x02, 0xd2, 0xff, 0x40, 0xff, 0xff,  //@@...@@.@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x42, 0xff, 0xd4, 0xff, 0xff,  //@@...+@@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff,  //@@....%@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x22, 0xf8, 0xff, 0xff,  //@@.....@@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff,  //@@.....%@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe3, 0x00, 0x02, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0xfd, 0xff, 0x01, 0xf8, 0x26, 0xfd, 0x00, 0xfc,
+    0xff, 0x00, 0xb6, 0xfd, 0x00, 0xfd, 0xff, 0x02, 0xb4, 0xff, 0x4e, 0xfe, 0x00, 0xfd, 0xff, 0x05,
+    0x26, 0xfa, 0xdc, 0x06, 0x00, 0x00, 0xfd, 0xff, 0x05, 0x00, 0x8e, 0xff, 0x7c, 0x00, 0x00, 0xfd,
+    0xff, 0x05, 0x00, 0x10, 0xea, 0xf4, 0x1c, 0x00, 0xfd, 0xff, 0x05, 0x00, 0x00, 0x68, 0xff, 0xaa,
+    0x00, 0xfd, 0xff, 0x05, 0x00, 0x00, 0x02, 0xd2, 0xff, 0x40, 0xfd, 0xff, 0xfe, 0x00, 0x02, 0x42,
+    0xff, 0xd4, 0xfd, 0xff, 0xfd, 0x00, 0x00, 0xae, 0xfc, 0xff, 0xfd, 0x00, 0x01, 0x22, 0xf8, 0xfd,
+    0xff, 0xfc, 0x00, 0x02, 0x88, 0xff, 0xff, 0xd9, 0x00,
 
     /*Unicode: U+004f (O) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x0e, 0x7e, 0xd0, 0xf2, 0xf2, 0xd0, 0x80, 0x0e, 0x00, 0x00,  //...+@@@@+...
-    0x00, 0x28, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x28, 0x00,  //..@@@@@@@@..
-    0x08, 0xd8, 0xff, 0xce, 0x46, 0x0a, 0x0a, 0x44, 0xce, 0xff, 0xd8, 0x08,  //.@@@+..+@@@.
-    0x6e, 0xff, 0xd4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd6, 0xff, 0x6c,  //+@@......@@+
-    0xc0, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xbe,  //%@+......+@%
-    0xec, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xea,  //@@........@@
-    0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xfa,  //@@........@@
-    0xec, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xea,  //@@........@@
-    0xc0, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xbe,  //%@+......+@%
-    0x6e, 0xff, 0xd4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd4, 0xff, 0x6c,  //+@@......@@+
-    0x0a, 0xda, 0xff, 0xcc, 0x44, 0x0a, 0x08, 0x42, 0xcc, 0xff, 0xd8, 0x08,  //.@@@+..+@@@.
-    0x00, 0x28, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x28, 0x00,  //..@@@@@@@@..
-    0x00, 0x00, 0x0e, 0x80, 0xd0, 0xf4, 0xf4, 0xd2, 0x80, 0x0e, 0x00, 0x00,  //...+@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdb, 0x00, 0x07, 0x0e, 0x7e, 0xd0, 0xf2, 0xf2, 0xd0, 0x80, 0x0e, 0xfe, 0x00, 0x01, 0x28, 0xe0,
+    0xfb, 0xff, 0x12, 0xe0, 0x28, 0x00, 0x08, 0xd8, 0xff, 0xce, 0x46, 0x0a, 0x0a, 0x44, 0xce, 0xff,
+    0xd8, 0x08, 0x6e, 0xff, 0xd4, 0x0a, 0xfd, 0x00, 0x06, 0x0a, 0xd6, 0xff, 0x6c, 0xc0, 0xff, 0x56,
+    0xfb, 0x00, 0x05, 0x56, 0xff, 0xbe, 0xec, 0xff, 0x14, 0xfb, 0x00, 0x05, 0x16, 0xff, 0xea, 0xfa,
+    0xff, 0x02, 0xfb, 0x00, 0x05, 0x04, 0xff, 0xfa, 0xec, 0xff, 0x14, 0xfb, 0x00, 0x05, 0x16, 0xff,
+    0xea, 0xc0, 0xff, 0x56, 0xfb, 0x00, 0x06, 0x56, 0xff, 0xbe, 0x6e, 0xff, 0xd4, 0x0a, 0xfd, 0x00,
+    0x12, 0x0a, 0xd4, 0xff, 0x6c, 0x0a, 0xda, 0xff, 0xcc, 0x44, 0x0a, 0x08, 0x42, 0xcc, 0xff, 0xd8,
+    0x08, 0x00, 0x28, 0xe0, 0xfb, 0xff, 0x01, 0xe0, 0x28, 0xfe, 0x00, 0x07, 0x0e, 0x80, 0xd0, 0xf4,
+    0xf4, 0xd2, 0x80, 0x0e, 0xcf, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xc0, 0x4a, 0x00,  //@@@@@%+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c,  //@@@@@@@+
-    0xff, 0xff, 0x00, 0x00, 0x1a, 0xa8, 0xff, 0xc6,  //@@...%@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf4,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf4,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x18, 0xa6, 0xff, 0xc6,  //@@...%@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e,  //@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xc2, 0x4a, 0x00,  //@@@@@@+.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xe9, 0x00, 0xfd, 0xff, 0x03, 0xf2, 0xc0, 0x4a, 0x00, 0xfa, 0xff, 0x0a, 0x4c, 0xff, 0xff, 0x00,
+    0x00, 0x1a, 0xa8, 0xff, 0xc6, 0xff, 0xff, 0xfe, 0x00, 0x04, 0x14, 0xff, 0xf4, 0xff, 0xff, 0xfe,
+    0x00, 0x0a, 0x14, 0xff, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x18, 0xa6, 0xff, 0xc6, 0xfa, 0xff, 0x00,
+    0x4e, 0xfd, 0xff, 0x05, 0xf2, 0xc2, 0x4a, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+    0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xdb, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x0e, 0x7e, 0xd0, 0xf2, 0xf4, 0xd2, 0x82, 0x10, 0x00, 0x00,  //...+@@@@%...
-    0x00, 0x28, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x2c, 0x00,  //..@@@@@@@@..
-    0x08, 0xd8, 0xff, 0xce, 0x46, 0x0a, 0x0a, 0x44, 0xce, 0xff, 0xde, 0x0c,  //.@@@+..+@@@.
-    0x6e, 0xff, 0xd4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd6, 0xff, 0x74,  //+@@......@@+
-    0xc0, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xc2,  //%@+......+@@
-    0xec, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xec,  //@@........@@
-    0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf6,  //@@........@@
-    0xec, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xdc,  //@@........@@
-    0xc0, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xb0,  //%@+......+@%
-    0x6e, 0xff, 0xd4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd4, 0xff, 0x4a,  //+@@......@@+
-    0x0a, 0xdc, 0xff, 0xcc, 0x44, 0x0a, 0x08, 0x42, 0xcc, 0xff, 0xac, 0x00,  //.@@@+..+@@%.
-    0x00, 0x2a, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x08, 0x00,  //..@@@@@@@%..
-    0x00, 0x00, 0x10, 0x82, 0xd2, 0xf4, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00,  //...%@@@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xfa, 0xff, 0x62, 0x00, 0x00,  //......+@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xf8, 0x42, 0x00,  //.......+@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdb, 0x00, 0x07, 0x0e, 0x7e, 0xd0, 0xf2, 0xf4, 0xd2, 0x82, 0x10, 0xfe, 0x00, 0x01, 0x28, 0xe0,
+    0xfb, 0xff, 0x12, 0xe2, 0x2c, 0x00, 0x08, 0xd8, 0xff, 0xce, 0x46, 0x0a, 0x0a, 0x44, 0xce, 0xff,
+    0xde, 0x0c, 0x6e, 0xff, 0xd4, 0x0a, 0xfd, 0x00, 0x06, 0x0a, 0xd6, 0xff, 0x74, 0xc0, 0xff, 0x56,
+    0xfb, 0x00, 0x05, 0x56, 0xff, 0xc2, 0xec, 0xff, 0x14, 0xfb, 0x00, 0x05, 0x16, 0xff, 0xec, 0xfa,
+    0xff, 0x02, 0xfb, 0x00, 0x05, 0x04, 0xff, 0xf6, 0xec, 0xff, 0x14, 0xfb, 0x00, 0x05, 0x16, 0xff,
+    0xdc, 0xc0, 0xff, 0x56, 0xfb, 0x00, 0x06, 0x56, 0xff, 0xb0, 0x6e, 0xff, 0xd4, 0x0a, 0xfd, 0x00,
+    0x12, 0x0a, 0xd4, 0xff, 0x4a, 0x0a, 0xdc, 0xff, 0xcc, 0x44, 0x0a, 0x08, 0x42, 0xcc, 0xff, 0xac,
+    0x00, 0x00, 0x2a, 0xe2, 0xfb, 0xff, 0x01, 0xa2, 0x08, 0xfe, 0x00, 0x06, 0x10, 0x82, 0xd2, 0xf4,
+    0xff, 0xff, 0xa6, 0xf8, 0x00, 0x03, 0x42, 0xfa, 0xff, 0x62, 0xf8, 0x00, 0x03, 0x64, 0xff, 0xf8,
+    0x42, 0xe8, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xc6, 0x58, 0x00, 0x00, 0x00,  //@@@@@@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00,  //@@@@@@@+..
-    0xff, 0xff, 0x00, 0x00, 0x18, 0xa0, 0xff, 0xce, 0x00, 0x00,  //@@...%@@..
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf6, 0x00, 0x00,  //@@....@@..
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x14, 0xff, 0xea, 0x00, 0x00,  //@@....@@..
-    0xff, 0xff, 0x00, 0x00, 0x16, 0xa0, 0xff, 0xa4, 0x00, 0x00,  //@@...%@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x14, 0x00, 0x00,  //@@@@@@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x48, 0x00, 0x00, 0x00,  //@@@@@@+...
-    0xff, 0xff, 0x00, 0x06, 0x58, 0xf6, 0xf8, 0x30, 0x00, 0x00,  //@@..+@@...
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x74, 0xff, 0xc6, 0x00, 0x00,  //@@...+@@..
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0xd4, 0xff, 0x66, 0x00,  //@@....@@+.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xee, 0x18,  //@@....+@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xac,  //@@.....%@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe3, 0x00, 0xfd, 0xff, 0x02, 0xf2, 0xc6, 0x58, 0xfe, 0x00, 0xfa, 0xff, 0x0e, 0x5c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x18, 0xa0, 0xff, 0xce, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x06, 0x14,
+    0xff, 0xf6, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x0e, 0x14, 0xff, 0xea, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x16, 0xa0, 0xff, 0xa4, 0x00, 0x00, 0xfb, 0xff, 0x03, 0xc4, 0x14, 0x00, 0x00, 0xfc,
+    0xff, 0x01, 0xf2, 0x48, 0xfe, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x06, 0x58, 0xf6, 0xf8, 0x30, 0x00,
+    0x00, 0xff, 0xff, 0xfe, 0x00, 0x06, 0x74, 0xff, 0xc6, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x06,
+    0x04, 0xd4, 0xff, 0x66, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x05, 0x42, 0xff, 0xee, 0x18, 0xff, 0xff,
+    0xfc, 0x00, 0x02, 0xaa, 0xff, 0xac, 0xd9, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x34, 0xb0, 0xe0, 0xf8, 0xde, 0x9e, 0x3a, 0x00,  //..%@@@%..
-    0x50, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-    0xd2, 0xff, 0xb6, 0x2e, 0x06, 0x14, 0x54, 0xbe, 0x00,  //@@%...+%.
-    0xf6, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xd4, 0xff, 0x7c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-    0x56, 0xff, 0xff, 0xff, 0xda, 0xa6, 0x5a, 0x04, 0x00,  //+@@@@%+..
-    0x00, 0x40, 0xb0, 0xf2, 0xff, 0xff, 0xff, 0xce, 0x12,  //..%@@@@@.
-    0x00, 0x00, 0x00, 0x02, 0x28, 0x68, 0xde, 0xff, 0x96,  //.....+@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xe0,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf8,  //.......@@
-    0xc8, 0x68, 0x26, 0x06, 0x0a, 0x38, 0xc0, 0xff, 0xd4,  //@+....%@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x52,  //@@@@@@@@+
-    0x32, 0x8e, 0xd0, 0xf4, 0xf8, 0xe2, 0xaa, 0x3a, 0x00,  //.%@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe5, 0x00, 0x09, 0x34, 0xb0, 0xe0, 0xf8, 0xde, 0x9e, 0x3a, 0x00, 0x50, 0xfc, 0xfb, 0xff, 0x0c,
+    0x00, 0xd2, 0xff, 0xb6, 0x2e, 0x06, 0x14, 0x54, 0xbe, 0x00, 0xf6, 0xff, 0x16, 0xfb, 0x00, 0x03,
+    0xd4, 0xff, 0x7c, 0x12, 0xfc, 0x00, 0x00, 0x56, 0xfe, 0xff, 0x08, 0xda, 0xa6, 0x5a, 0x04, 0x00,
+    0x00, 0x40, 0xb0, 0xf2, 0xfe, 0xff, 0x01, 0xce, 0x12, 0xfe, 0x00, 0x05, 0x02, 0x28, 0x68, 0xde,
+    0xff, 0x96, 0xfb, 0x00, 0x02, 0x28, 0xff, 0xe0, 0xfb, 0x00, 0x0b, 0x18, 0xff, 0xf8, 0xc8, 0x68,
+    0x26, 0x06, 0x0a, 0x38, 0xc0, 0xff, 0xd4, 0xfa, 0xff, 0x09, 0xfc, 0x52, 0x32, 0x8e, 0xd0, 0xf4,
+    0xf8, 0xe2, 0xaa, 0x3a, 0xdc, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdd, 0x00, 0xe9, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00,
+    0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01,
+    0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff,
+    0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xcc, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@......@@
-    0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@......@@
-    0xee, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xee,  //@@......@@
-    0xc4, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xc4,  //@@+....+@@
-    0x6e, 0xff, 0xe8, 0x54, 0x12, 0x12, 0x56, 0xea, 0xff, 0x6c,  //+@@+..+@@+
-    0x04, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x04,  //.@@@@@@@@.
-    0x00, 0x08, 0x7a, 0xd2, 0xf6, 0xf4, 0xd2, 0x7a, 0x08, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xe3, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd,
+    0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0x00, 0x03,
+    0xff, 0xff, 0xfc, 0xff, 0xfb, 0x00, 0x04, 0xff, 0xfc, 0xee, 0xff, 0x14, 0xfd, 0x00, 0x05, 0x16,
+    0xff, 0xee, 0xc4, 0xff, 0x5a, 0xfd, 0x00, 0x0e, 0x5c, 0xff, 0xc4, 0x6e, 0xff, 0xe8, 0x54, 0x12,
+    0x12, 0x56, 0xea, 0xff, 0x6c, 0x04, 0xc4, 0xfb, 0xff, 0x0a, 0xc2, 0x04, 0x00, 0x08, 0x7a, 0xd2,
+    0xf6, 0xf4, 0xd2, 0x7a, 0x08, 0xd8, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xcc, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xcc,  //@@+......+@@
-    0x68, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x66,  //+@%......%@+
-    0x0e, 0xf4, 0xfc, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfc, 0xf4, 0x0c,  //.@@......@@.
-    0x00, 0x9e, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0x9e, 0x00,  //.%@+....+@%.
-    0x00, 0x38, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0x38, 0x00,  //..@@....@@..
-    0x00, 0x00, 0xd4, 0xff, 0x3e, 0x00, 0x00, 0x40, 0xff, 0xd4, 0x00, 0x00,  //..@@....@@..
-    0x00, 0x00, 0x6e, 0xff, 0xa2, 0x00, 0x00, 0xa2, 0xff, 0x70, 0x00, 0x00,  //..+@%..%@+..
-    0x00, 0x00, 0x12, 0xf6, 0xf4, 0x0c, 0x0e, 0xf4, 0xf8, 0x12, 0x00, 0x00,  //...@@..@@...
-    0x00, 0x00, 0x00, 0xa4, 0xff, 0x66, 0x66, 0xff, 0xa6, 0x00, 0x00, 0x00,  //...%@++@%...
-    0x00, 0x00, 0x00, 0x40, 0xff, 0xc8, 0xca, 0xff, 0x42, 0x00, 0x00, 0x00,  //....@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00, 0x00, 0x16, 0xf8, 0xfa, 0x18, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdd, 0x00, 0x02, 0xcc, 0xff, 0x54, 0xfb, 0x00, 0x05, 0x54, 0xff, 0xcc, 0x68, 0xff, 0xb6, 0xfb,
+    0x00, 0x06, 0xb6, 0xff, 0x66, 0x0e, 0xf4, 0xfc, 0x1a, 0xfd, 0x00, 0x07, 0x1c, 0xfc, 0xf4, 0x0c,
+    0x00, 0x9e, 0xff, 0x7a, 0xfd, 0x00, 0x07, 0x7c, 0xff, 0x9e, 0x00, 0x00, 0x38, 0xff, 0xda, 0xfd,
+    0x00, 0x02, 0xdc, 0xff, 0x38, 0xfe, 0x00, 0x07, 0xd4, 0xff, 0x3e, 0x00, 0x00, 0x40, 0xff, 0xd4,
+    0xfd, 0x00, 0x07, 0x6e, 0xff, 0xa2, 0x00, 0x00, 0xa2, 0xff, 0x70, 0xfd, 0x00, 0x07, 0x12, 0xf6,
+    0xf4, 0x0c, 0x0e, 0xf4, 0xf8, 0x12, 0xfc, 0x00, 0x05, 0xa4, 0xff, 0x66, 0x66, 0xff, 0xa6, 0xfb,
+    0x00, 0x05, 0x40, 0xff, 0xc8, 0xca, 0xff, 0x42, 0xfa, 0x00, 0x03, 0xda, 0xff, 0xff, 0xdc, 0xf9,
+    0x00, 0x03, 0x76, 0xff, 0xff, 0x78, 0xf9, 0x00, 0x03, 0x16, 0xf8, 0xfa, 0x18, 0xcd, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0xde, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xdc,  //@@.....@@@.....@@
-    0x9c, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xf8, 0xff, 0x64, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x9a,  //%@+...+@@@+...+@%
-    0x5a, 0xff, 0xb0, 0x00, 0x00, 0x00, 0xba, 0xff, 0x98, 0xff, 0xa4, 0x00, 0x00, 0x00, 0xae, 0xff, 0x58,  //+@%...%@%@%...%@+
-    0x18, 0xff, 0xec, 0x00, 0x00, 0x04, 0xf4, 0xfc, 0x1e, 0xfa, 0xe4, 0x00, 0x00, 0x00, 0xec, 0xff, 0x16,  //.@@...@@.@@...@@.
-    0x00, 0xd6, 0xff, 0x30, 0x00, 0x38, 0xff, 0xce, 0x00, 0xc8, 0xff, 0x28, 0x00, 0x2e, 0xff, 0xd2, 0x00,  //.@@...@@.@@...@@.
-    0x00, 0x94, 0xff, 0x72, 0x00, 0x78, 0xff, 0x8c, 0x00, 0x88, 0xff, 0x68, 0x00, 0x6e, 0xff, 0x90, 0x00,  //.%@+.+@%.%@+.+@%.
-    0x00, 0x50, 0xff, 0xb2, 0x00, 0xb6, 0xff, 0x4c, 0x00, 0x48, 0xff, 0xaa, 0x00, 0xae, 0xff, 0x4e, 0x00,  //.+@%.%@+.+@%.%@+.
-    0x00, 0x10, 0xfc, 0xee, 0x06, 0xf2, 0xfa, 0x0e, 0x00, 0x0c, 0xfa, 0xea, 0x02, 0xec, 0xfa, 0x0e, 0x00,  //..@@.@@...@@.@@..
-    0x00, 0x00, 0xcc, 0xff, 0x6a, 0xff, 0xca, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x5c, 0xff, 0xc8, 0x00, 0x00,  //..@@+@@...@@+@@..
-    0x00, 0x00, 0x8a, 0xff, 0xe2, 0xff, 0x88, 0x00, 0x00, 0x00, 0x88, 0xff, 0xda, 0xff, 0x86, 0x00, 0x00,  //..%@@@%...%@@@%..
-    0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00,  //..+@@@+...+@@@+..
-    0x00, 0x00, 0x0a, 0xfa, 0xff, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0xff, 0xf8, 0x08, 0x00, 0x00,  //...@@@.....@@@...
-    0x00, 0x00, 0x00, 0xc4, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xc0, 0x00, 0x00, 0x00,  //...@@@.....@@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xce, 0x00, 0x02, 0xde, 0xff, 0x2e, 0xfe, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0x00, 0x22, 0xfe, 0x00,
+    0x05, 0x2e, 0xff, 0xdc, 0x9c, 0xff, 0x6e, 0xfe, 0x00, 0x04, 0x7a, 0xff, 0xf8, 0xff, 0x64, 0xfe,
+    0x00, 0x05, 0x6e, 0xff, 0x9a, 0x5a, 0xff, 0xb0, 0xfe, 0x00, 0x04, 0xba, 0xff, 0x98, 0xff, 0xa4,
+    0xfe, 0x00, 0x0d, 0xae, 0xff, 0x58, 0x18, 0xff, 0xec, 0x00, 0x00, 0x04, 0xf4, 0xfc, 0x1e, 0xfa,
+    0xe4, 0xfe, 0x00, 0x45, 0xec, 0xff, 0x16, 0x00, 0xd6, 0xff, 0x30, 0x00, 0x38, 0xff, 0xce, 0x00,
+    0xc8, 0xff, 0x28, 0x00, 0x2e, 0xff, 0xd2, 0x00, 0x00, 0x94, 0xff, 0x72, 0x00, 0x78, 0xff, 0x8c,
+    0x00, 0x88, 0xff, 0x68, 0x00, 0x6e, 0xff, 0x90, 0x00, 0x00, 0x50, 0xff, 0xb2, 0x00, 0xb6, 0xff,
+    0x4c, 0x00, 0x48, 0xff, 0xaa, 0x00, 0xae, 0xff, 0x4e, 0x00, 0x00, 0x10, 0xfc, 0xee, 0x06, 0xf2,
+    0xfa, 0x0e, 0x00, 0x0c, 0xfa, 0xea, 0x02, 0xec, 0xfa, 0x0e, 0xfe, 0x00, 0x04, 0xcc, 0xff, 0x6a,
+    0xff, 0xca, 0xfe, 0x00, 0x04, 0xc8, 0xff, 0x5c, 0xff, 0xc8, 0xfd, 0x00, 0x04, 0x8a, 0xff, 0xe2,
+    0xff, 0x88, 0xfe, 0x00, 0x04, 0x88, 0xff, 0xda, 0xff, 0x86, 0xfd, 0x00, 0x00, 0x48, 0xfe, 0xff,
+    0x00, 0x48, 0xfe, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x00, 0x44, 0xfd, 0x00, 0x04, 0x0a, 0xfa, 0xff,
+    0xfa, 0x0a, 0xfe, 0x00, 0x04, 0x0c, 0xfa, 0xff, 0xf8, 0x08, 0xfc, 0x00, 0x02, 0xc4, 0xff, 0xc6,
+    0xfc, 0x00, 0x02, 0xc6, 0xff, 0xc0, 0xba, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0xb4, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0xaa,  //.%@%....%@%
-    0x00, 0x24, 0xf8, 0xff, 0x46, 0x00, 0x00, 0x64, 0xff, 0xec, 0x16,  //..@@+..+@@.
-    0x00, 0x00, 0x86, 0xff, 0xd6, 0x04, 0x1a, 0xf0, 0xff, 0x5a, 0x00,  //..%@@..@@+.
-    0x00, 0x00, 0x0a, 0xe4, 0xff, 0x72, 0xb4, 0xff, 0xb2, 0x00, 0x00,  //...@@+%@%..
-    0x00, 0x00, 0x00, 0x58, 0xff, 0xfa, 0xff, 0xee, 0x1a, 0x00, 0x00,  //...+@@@@...
-    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00,  //....%@@+...
-    0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00,  //....%@@....
-    0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x00,  //...+@@@@...
-    0x00, 0x00, 0x16, 0xec, 0xff, 0x7a, 0xec, 0xff, 0x5c, 0x00, 0x00,  //...@@+@@+..
-    0x00, 0x00, 0xae, 0xff, 0xbe, 0x00, 0x6a, 0xff, 0xe4, 0x0c, 0x00,  //..%@%.+@@..
-    0x00, 0x58, 0xff, 0xf4, 0x22, 0x00, 0x02, 0xd0, 0xff, 0x88, 0x00,  //.+@@...@@%.
-    0x14, 0xea, 0xff, 0x70, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xf8, 0x24,  //.@@+....@@.
-    0xaa, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xb4,  //%@@.....%@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xdf, 0x00, 0x02, 0xb4, 0xff, 0xb0, 0xfd, 0x00, 0x17, 0xba, 0xff, 0xaa, 0x00, 0x24, 0xf8, 0xff,
+    0x46, 0x00, 0x00, 0x64, 0xff, 0xec, 0x16, 0x00, 0x00, 0x86, 0xff, 0xd6, 0x04, 0x1a, 0xf0, 0xff,
+    0x5a, 0xfe, 0x00, 0x06, 0x0a, 0xe4, 0xff, 0x72, 0xb4, 0xff, 0xb2, 0xfc, 0x00, 0x05, 0x58, 0xff,
+    0xfa, 0xff, 0xee, 0x1a, 0xfb, 0x00, 0x03, 0xc0, 0xff, 0xff, 0x62, 0xfa, 0x00, 0x03, 0xb2, 0xff,
+    0xff, 0x34, 0xfb, 0x00, 0x00, 0x5c, 0xfe, 0xff, 0x00, 0xc6, 0xfc, 0x00, 0x06, 0x16, 0xec, 0xff,
+    0x7a, 0xec, 0xff, 0x5c, 0xfd, 0x00, 0x17, 0xae, 0xff, 0xbe, 0x00, 0x6a, 0xff, 0xe4, 0x0c, 0x00,
+    0x00, 0x58, 0xff, 0xf4, 0x22, 0x00, 0x02, 0xd0, 0xff, 0x88, 0x00, 0x14, 0xea, 0xff, 0x70, 0xfe,
+    0x00, 0x06, 0x3e, 0xff, 0xf8, 0x24, 0xaa, 0xff, 0xc6, 0xfc, 0x00, 0x02, 0xa6, 0xff, 0xb4, 0xd5,
+    0x00,
 
     /*Unicode: U+0059 (Y) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0xa0, 0xff, 0xca, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0xca, 0xff, 0xa0,  //%@@......@@%
-    0x0a, 0xd8, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xd8, 0x0a,  //.@@+....+@@.
-    0x00, 0x30, 0xf8, 0xf4, 0x22, 0x00, 0x00, 0x22, 0xf4, 0xf6, 0x30, 0x00,  //..@@....@@..
-    0x00, 0x00, 0x6e, 0xff, 0xbc, 0x00, 0x00, 0xbe, 0xff, 0x6c, 0x00, 0x00,  //..+@%..%@+..
-    0x00, 0x00, 0x00, 0xb0, 0xff, 0x64, 0x66, 0xff, 0xb0, 0x00, 0x00, 0x00,  //...%@++@%...
-    0x00, 0x00, 0x00, 0x12, 0xe2, 0xf0, 0xf0, 0xe2, 0x10, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xdd, 0x00, 0x03, 0xa0, 0xff, 0xca, 0x02, 0xfd, 0x00, 0x07, 0x02, 0xca, 0xff, 0xa0, 0x0a, 0xd8,
+    0xff, 0x72, 0xfd, 0x00, 0x0e, 0x74, 0xff, 0xd8, 0x0a, 0x00, 0x30, 0xf8, 0xf4, 0x22, 0x00, 0x00,
+    0x22, 0xf4, 0xf6, 0x30, 0xfe, 0x00, 0x07, 0x6e, 0xff, 0xbc, 0x00, 0x00, 0xbe, 0xff, 0x6c, 0xfc,
+    0x00, 0x05, 0xb0, 0xff, 0x64, 0x66, 0xff, 0xb0, 0xfb, 0x00, 0x05, 0x12, 0xe2, 0xf0, 0xf0, 0xe2,
+    0x10, 0xfa, 0x00, 0x03, 0x3c, 0xff, 0xff, 0x3c, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01,
+    0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00, 0x01, 0xff,
+    0xff, 0xf7, 0x00, 0x01, 0xff, 0xff, 0xcc, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0xff, 0xe6, 0x1a,  //.......%@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xf8, 0x38, 0x00,  //......%@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x60, 0x00, 0x00,  //.....+@@+..
-    0x00, 0x00, 0x00, 0x00, 0x28, 0xf2, 0xff, 0x92, 0x00, 0x00, 0x00,  //.....@@%...
-    0x00, 0x00, 0x00, 0x0c, 0xd6, 0xff, 0xbc, 0x02, 0x00, 0x00, 0x00,  //....@@%....
-    0x00, 0x00, 0x00, 0xac, 0xff, 0xde, 0x12, 0x00, 0x00, 0x00, 0x00,  //...%@@.....
-    0x00, 0x00, 0x76, 0xff, 0xf2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@......
-    0x00, 0x42, 0xfa, 0xfc, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@+......
-    0x1e, 0xea, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@%.......
-    0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xe0, 0x00, 0xec, 0xff, 0x00, 0xc8, 0xfb, 0x00, 0x04, 0x02, 0xbc, 0xff, 0xe6, 0x1a, 0xfb, 0x00,
+    0x03, 0x88, 0xff, 0xf8, 0x38, 0xfb, 0x00, 0x03, 0x52, 0xff, 0xff, 0x60, 0xfb, 0x00, 0x03, 0x28,
+    0xf2, 0xff, 0x92, 0xfb, 0x00, 0x04, 0x0c, 0xd6, 0xff, 0xbc, 0x02, 0xfb, 0x00, 0x03, 0xac, 0xff,
+    0xde, 0x12, 0xfb, 0x00, 0x03, 0x76, 0xff, 0xf2, 0x2c, 0xfb, 0x00, 0x03, 0x42, 0xfa, 0xfc, 0x52,
+    0xfb, 0x00, 0x03, 0x1e, 0xea, 0xff, 0x82, 0xfa, 0x00, 0x00, 0xca, 0xec, 0xff, 0xd5, 0x00,
 
     /*Unicode: U+005b ([) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xf9, 0x00, 0xf7, 0xff, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+005c (\) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0xdc, 0xff, 0x38, 0x00, 0x00, 0x00,  //@@....
-    0x9a, 0xff, 0x7a, 0x00, 0x00, 0x00,  //%@+...
-    0x56, 0xff, 0xbc, 0x00, 0x00, 0x00,  //+@%...
-    0x14, 0xfc, 0xf6, 0x06, 0x00, 0x00,  //.@@...
-    0x00, 0xd0, 0xff, 0x42, 0x00, 0x00,  //.@@+..
-    0x00, 0x8c, 0xff, 0x84, 0x00, 0x00,  //.%@%..
-    0x00, 0x4a, 0xff, 0xc8, 0x00, 0x00,  //.+@@..
-    0x00, 0x0c, 0xfa, 0xfa, 0x0e, 0x00,  //..@@..
-    0x00, 0x00, 0xc4, 0xff, 0x4c, 0x00,  //..@@+.
-    0x00, 0x00, 0x80, 0xff, 0x90, 0x00,  //..+@%.
-    0x00, 0x00, 0x3c, 0xff, 0xd2, 0x00,  //...@@.
-    0x00, 0x00, 0x04, 0xf4, 0xff, 0x16,  //...@@.
-    0x00, 0x00, 0x00, 0xb6, 0xff, 0x58,  //...%@+
-    0x00, 0x00, 0x00, 0x74, 0xff, 0x9a,  //...+@%
-    0x00, 0x00, 0x00, 0x30, 0xff, 0xdc,  //....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xef, 0x00, 0x02, 0xdc, 0xff, 0x38, 0xfe, 0x00, 0x02, 0x9a, 0xff, 0x7a, 0xfe, 0x00, 0x02, 0x56,
+    0xff, 0xbc, 0xfe, 0x00, 0x03, 0x14, 0xfc, 0xf6, 0x06, 0xfe, 0x00, 0x02, 0xd0, 0xff, 0x42, 0xfe,
+    0x00, 0x02, 0x8c, 0xff, 0x84, 0xfe, 0x00, 0x02, 0x4a, 0xff, 0xc8, 0xfe, 0x00, 0x03, 0x0c, 0xfa,
+    0xfa, 0x0e, 0xfe, 0x00, 0x02, 0xc4, 0xff, 0x4c, 0xfe, 0x00, 0x02, 0x80, 0xff, 0x90, 0xfe, 0x00,
+    0x02, 0x3c, 0xff, 0xd2, 0xfe, 0x00, 0x03, 0x04, 0xf4, 0xff, 0x16, 0xfe, 0x00, 0x02, 0xb6, 0xff,
+    0x58, 0xfe, 0x00, 0x02, 0x74, 0xff, 0x9a, 0xfe, 0x00, 0x02, 0x30, 0xff, 0xdc, 0xf5, 0x00,
 
     /*Unicode: U+005d (]) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0xff, 0xff, 0xff, 0xff,  //@@@@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xf9, 0x00, 0xf9, 0xff, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xf7, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+005e (^) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x08, 0xc2, 0xff, 0xc2, 0x08, 0x00, 0x00, 0x00,  //....@@@....
-    0x00, 0x00, 0x04, 0xb6, 0xff, 0xae, 0xff, 0xb4, 0x04, 0x00, 0x00,  //...%@%@%...
-    0x00, 0x00, 0xa8, 0xfc, 0x62, 0x00, 0x64, 0xfc, 0xa6, 0x00, 0x00,  //..%@+.+@%..
-    0x00, 0x98, 0xf8, 0x54, 0x00, 0x00, 0x00, 0x56, 0xf8, 0x98, 0x00,  //.%@+...+@%.
-    0x88, 0xf4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xf4, 0x86,  //%@+.....+@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+    0xdd, 0x00, 0x04, 0x08, 0xc2, 0xff, 0xc2, 0x08, 0xfc, 0x00, 0x06, 0x04, 0xb6, 0xff, 0xae, 0xff,
+    0xb4, 0x04, 0xfd, 0x00, 0x06, 0xa8, 0xfc, 0x62, 0x00, 0x64, 0xfc, 0xa6, 0xfe, 0x00, 0x02, 0x98,
+    0xf8, 0x54, 0xfe, 0x00, 0x06, 0x56, 0xf8, 0x98, 0x00, 0x88, 0xf4, 0x48, 0xfc, 0x00, 0x02, 0x48,
+    0xf4, 0x86, 0x81, 0x00, 0xfd, 0x00,
 
     /*Unicode: U+005f (_) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-
+    0x81, 0x00, 0xdf, 0x00, 0xef, 0xff,
 
     /*Unicode: U+0060 (`) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x8a, 0xe8, 0x1c, 0x00,  //%@..
-    0x00, 0xa0, 0xc8, 0x06,  //.%@.
-    0x00, 0x02, 0xb6, 0x9a,  //..%%
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xf9, 0x00, 0x0b, 0x8a, 0xe8, 0x1c, 0x00, 0x00, 0xa0, 0xc8, 0x06, 0x00, 0x02, 0xb6, 0x9a, 0xc5,
+    0x00,
 
     /*Unicode: U+0061 (a) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x44, 0xb2, 0xee, 0xf4, 0xc4, 0x42, 0x00,  //.+%@@@+.
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x32,  //.@@@@@@.
-    0x00, 0xaa, 0x30, 0x06, 0x20, 0xac, 0xff, 0xa6,  //.%...%@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xe0,  //......@@
-    0x02, 0x72, 0xce, 0xf4, 0xff, 0xff, 0xff, 0xf8,  //.+@@@@@@
-    0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@@@@@@
-    0xec, 0xff, 0x5c, 0x10, 0x02, 0x10, 0xff, 0xff,  //@@+...@@
-    0xec, 0xff, 0x4e, 0x06, 0x20, 0xaa, 0xff, 0xff,  //@@+..%@@
-    0xa4, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0xff,  //%@@@@%@@
-    0x10, 0xa2, 0xec, 0xee, 0x9c, 0x0a, 0xff, 0xff,  //.%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xd0, 0x00, 0x07, 0x44, 0xb2, 0xee, 0xf4, 0xc4, 0x42, 0x00, 0x00, 0xfc, 0xff, 0x09, 0xf8, 0x32,
+    0x00, 0xaa, 0x30, 0x06, 0x20, 0xac, 0xff, 0xa6, 0xfc, 0x00, 0x06, 0x14, 0xff, 0xe0, 0x02, 0x72,
+    0xce, 0xf4, 0xfe, 0xff, 0x01, 0xf8, 0x8c, 0xfa, 0xff, 0x10, 0xec, 0xff, 0x5c, 0x10, 0x02, 0x10,
+    0xff, 0xff, 0xec, 0xff, 0x4e, 0x06, 0x20, 0xaa, 0xff, 0xff, 0xa4, 0xfd, 0xff, 0x0a, 0xae, 0xff,
+    0xff, 0x10, 0xa2, 0xec, 0xee, 0x9c, 0x0a, 0xff, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x08, 0x98, 0xea, 0xf2, 0xae, 0x1e, 0x00,  //@@.%@@%..
-    0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x10,  //@@%@@@@@.
-    0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88,  //@@@...@@%
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xd4,  //@@+...+@@
-    0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf6,  //@@.....@@
-    0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf6,  //@@.....@@
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xd4,  //@@+...+@@
-    0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88,  //@@@...@@%
-    0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x10,  //@@%@@@@@.
-    0xff, 0xff, 0x0a, 0x9a, 0xec, 0xf2, 0xae, 0x20, 0x00,  //@@.%@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xef, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+    0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x0b, 0xff, 0xff, 0x08, 0x98, 0xea, 0xf2, 0xae, 0x1e, 0x00,
+    0xff, 0xff, 0xac, 0xfd, 0xff, 0x0d, 0xe2, 0x10, 0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff,
+    0x88, 0xff, 0xff, 0x4c, 0xfe, 0x00, 0x05, 0x4e, 0xff, 0xd4, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05,
+    0x10, 0xff, 0xf6, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xf6, 0xff, 0xff, 0x4c, 0xfe,
+    0x00, 0x0e, 0x4e, 0xff, 0xd4, 0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88, 0xff, 0xff,
+    0xac, 0xfd, 0xff, 0x09, 0xe2, 0x10, 0xff, 0xff, 0x0a, 0x9a, 0xec, 0xf2, 0xae, 0x20, 0xdc, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x02, 0x6e, 0xca, 0xf2, 0xf4, 0xbe, 0x4c,  //..+@@@%+
-    0x04, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-    0x72, 0xff, 0xf2, 0x6c, 0x1a, 0x06, 0x38, 0xae,  //+@@+...%
-    0xce, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-    0xf4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xf4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xce, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-    0x70, 0xff, 0xf0, 0x6a, 0x1a, 0x06, 0x36, 0xae,  //+@@+...%
-    0x04, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-    0x00, 0x04, 0x72, 0xd0, 0xf6, 0xf2, 0xbe, 0x4c,  //..+@@@%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xd0, 0x00, 0x08, 0x02, 0x6e, 0xca, 0xf2, 0xf4, 0xbe, 0x4c, 0x04, 0xb8, 0xfb, 0xff, 0x0a, 0x72,
+    0xff, 0xf2, 0x6c, 0x1a, 0x06, 0x38, 0xae, 0xce, 0xff, 0x64, 0xfc, 0x00, 0x02, 0xf4, 0xff, 0x14,
+    0xfc, 0x00, 0x02, 0xf4, 0xff, 0x14, 0xfc, 0x00, 0x02, 0xce, 0xff, 0x62, 0xfc, 0x00, 0x09, 0x70,
+    0xff, 0xf0, 0x6a, 0x1a, 0x06, 0x36, 0xae, 0x04, 0xba, 0xfb, 0xff, 0x07, 0x00, 0x04, 0x72, 0xd0,
+    0xf6, 0xf2, 0xbe, 0x4c, 0xe1, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x20, 0xae, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff,  //..%@@%.@@
-    0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,  //.@@@@@%@@
-    0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff,  //%@@...@@@
-    0xd6, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff,  //@@+...+@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xd6, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff,  //@@+...+@@
-    0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff,  //%@@...@@@
-    0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,  //.@@@@@%@@
-    0x00, 0x20, 0xb0, 0xf2, 0xec, 0x98, 0x08, 0xff, 0xff,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xe8, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+    0x00, 0x0c, 0xff, 0xff, 0x00, 0x20, 0xae, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff, 0x12, 0xe2, 0xfd,
+    0xff, 0x0e, 0xac, 0xff, 0xff, 0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff, 0xd6, 0xff,
+    0x4c, 0xfe, 0x00, 0x05, 0x4e, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff,
+    0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff, 0xd6, 0xff, 0x4c, 0xfe, 0x00, 0x0d, 0x4e,
+    0xff, 0xff, 0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff, 0x12, 0xe2, 0xfd, 0xff, 0x0b,
+    0xac, 0xff, 0xff, 0x00, 0x20, 0xb0, 0xf2, 0xec, 0x98, 0x08, 0xff, 0xff, 0xdd, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x5a, 0xbe, 0xee, 0xf8, 0xda, 0x88, 0x0e, 0x00,  //..+%@@@%..
-    0x00, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0c,  //.%@@@@@@@.
-    0x62, 0xff, 0xe2, 0x54, 0x12, 0x08, 0x38, 0xc8, 0xff, 0x86,  //+@@+...@@%
-    0xc6, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xd8,  //@@......@@
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-    0xca, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-    0x60, 0xff, 0xe6, 0x62, 0x1e, 0x08, 0x06, 0x24, 0x64, 0xc4,  //+@@+....+@
-    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@
-    0x00, 0x00, 0x42, 0xaa, 0xe2, 0xf8, 0xf4, 0xd2, 0x8c, 0x2e,  //..+%@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xc3, 0x00, 0x09, 0x5a, 0xbe, 0xee, 0xf8, 0xda, 0x88, 0x0e, 0x00, 0x00, 0xa4, 0xfb, 0xff, 0x0e,
+    0xd2, 0x0c, 0x62, 0xff, 0xe2, 0x54, 0x12, 0x08, 0x38, 0xc8, 0xff, 0x86, 0xc6, 0xff, 0x3a, 0xfd,
+    0x00, 0x03, 0x20, 0xff, 0xd8, 0xf4, 0xf9, 0xff, 0x01, 0xf8, 0xf4, 0xf8, 0xff, 0x02, 0xca, 0xff,
+    0x34, 0xfa, 0x00, 0x0b, 0x60, 0xff, 0xe6, 0x62, 0x1e, 0x08, 0x06, 0x24, 0x64, 0xc4, 0x00, 0x90,
+    0xf9, 0xff, 0x09, 0x00, 0x00, 0x42, 0xaa, 0xe2, 0xf8, 0xf4, 0xd2, 0x8c, 0x2e, 0xd9, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x06, 0x88, 0xde, 0xfa, 0xff,  //...%@@@
-    0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff,  //..%@@@@
-    0x00, 0x00, 0xdc, 0xff, 0x50, 0x04, 0x00,  //..@@+..
-    0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xf1, 0x00, 0x07, 0x06, 0x88, 0xde, 0xfa, 0xff, 0x00, 0x00, 0x82, 0xfd, 0xff, 0x05, 0x00, 0x00,
+    0xdc, 0xff, 0x50, 0x04, 0xfe, 0x00, 0x01, 0xfa, 0xff, 0xfe, 0x00, 0xf3, 0xff, 0x03, 0x00, 0x00,
+    0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff,
+    0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff,
+    0xfc, 0x00, 0x01, 0xff, 0xff, 0xe2, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x22, 0xb0, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff,  //..%@@%.@@
-    0x12, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,  //.@@@@@%@@
-    0x8a, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xde, 0xff, 0xff,  //%@@...@@@
-    0xd6, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff,  //@@+...+@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xd6, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@+...+@@
-    0x8a, 0xff, 0xdc, 0x3c, 0x0a, 0x3c, 0xdc, 0xff, 0xff,  //%@@...@@@
-    0x14, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0xfa,  //.@@@@@%@@
-    0x00, 0x24, 0xb2, 0xf4, 0xec, 0x98, 0x28, 0xff, 0xe8,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbe,  //......+@%
-    0x00, 0xae, 0x3c, 0x0c, 0x18, 0x64, 0xf0, 0xff, 0x6a,  //.%...+@@+
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x04,  //.@@@@@@@.
-    0x00, 0x48, 0xb6, 0xe4, 0xf8, 0xda, 0x88, 0x0c, 0x00,  //.+%@@@%..
-
+    0xca, 0x00, 0x09, 0x22, 0xb0, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff, 0x12, 0xe4, 0xfd, 0xff, 0x0e,
+    0xac, 0xff, 0xff, 0x8a, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xde, 0xff, 0xff, 0xd6, 0xff, 0x4a, 0xfe,
+    0x00, 0x05, 0x4c, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff, 0xf6, 0xff,
+    0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff, 0xd6, 0xff, 0x4a, 0xfe, 0x00, 0x0d, 0x4a, 0xff, 0xff,
+    0x8a, 0xff, 0xdc, 0x3c, 0x0a, 0x3c, 0xdc, 0xff, 0xff, 0x14, 0xe6, 0xfd, 0xff, 0x0b, 0xae, 0xff,
+    0xfa, 0x00, 0x24, 0xb2, 0xf4, 0xec, 0x98, 0x28, 0xff, 0xe8, 0xfb, 0x00, 0x0c, 0x6a, 0xff, 0xbe,
+    0x00, 0xae, 0x3c, 0x0c, 0x18, 0x64, 0xf0, 0xff, 0x6a, 0x00, 0xfb, 0xff, 0x0a, 0xca, 0x04, 0x00,
+    0x48, 0xb6, 0xe4, 0xf8, 0xda, 0x88, 0x0c, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-    0xff, 0xff, 0x08, 0x9c, 0xf0, 0xea, 0x86, 0x00,  //@@.%@@%.
-    0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@%@@@@+
-    0xff, 0xff, 0xcc, 0x2a, 0x0e, 0x98, 0xff, 0xca,  //@@@..%@@
-    0xff, 0xff, 0x36, 0x00, 0x00, 0x18, 0xff, 0xf2,  //@@....@@
-    0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf1, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+    0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x0a, 0xff, 0xff, 0x08, 0x9c, 0xf0, 0xea, 0x86, 0x00, 0xff,
+    0xff, 0xaa, 0xfd, 0xff, 0x13, 0x6a, 0xff, 0xff, 0xcc, 0x2a, 0x0e, 0x98, 0xff, 0xca, 0xff, 0xff,
+    0x36, 0x00, 0x00, 0x18, 0xff, 0xf2, 0xff, 0xff, 0x06, 0xfe, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd,
+    0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01,
+    0xff, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xed, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x0e, 0xff, 0xf6,  //..@@
-    0x08, 0x76, 0xff, 0xd2,  //.+@@
-    0xff, 0xff, 0xff, 0x7a,  //@@@+
-    0xfa, 0xda, 0x7e, 0x02,  //@@+.
-
+    0xf7, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf7, 0x00, 0x2d, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x0e, 0xff, 0xf6, 0x08, 0x76, 0xff, 0xd2, 0xfe, 0xff, 0x04, 0x7a, 0xfa, 0xda,
+    0x7e, 0x02,
 
     /*Unicode: U+006b (k) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x3a, 0xee, 0xff, 0x76,  //@@....@@+
-    0xff, 0xff, 0x00, 0x00, 0x44, 0xf4, 0xfc, 0x62, 0x00,  //@@..+@@+.
-    0xff, 0xff, 0x00, 0x4e, 0xf6, 0xf8, 0x54, 0x00, 0x00,  //@@.+@@+..
-    0xff, 0xff, 0x5a, 0xfa, 0xf2, 0x44, 0x00, 0x00, 0x00,  //@@+@@+...
-    0xff, 0xff, 0xfc, 0xee, 0x38, 0x00, 0x00, 0x00, 0x00,  //@@@@.....
-    0xff, 0xff, 0xff, 0xf8, 0x52, 0x00, 0x00, 0x00, 0x00,  //@@@@+....
-    0xff, 0xff, 0x6c, 0xff, 0xfa, 0x5a, 0x00, 0x00, 0x00,  //@@+@@+...
-    0xff, 0xff, 0x00, 0x6e, 0xff, 0xfc, 0x64, 0x00, 0x00,  //@@.+@@+..
-    0xff, 0xff, 0x00, 0x00, 0x70, 0xff, 0xfc, 0x6e, 0x00,  //@@..+@@+.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0x78,  //@@...+@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+    0xef, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+    0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x1b, 0x3a, 0xee, 0xff, 0x76,
+    0xff, 0xff, 0x00, 0x00, 0x44, 0xf4, 0xfc, 0x62, 0x00, 0xff, 0xff, 0x00, 0x4e, 0xf6, 0xf8, 0x54,
+    0x00, 0x00, 0xff, 0xff, 0x5a, 0xfa, 0xf2, 0x44, 0xfe, 0x00, 0x04, 0xff, 0xff, 0xfc, 0xee, 0x38,
+    0xfd, 0x00, 0xfe, 0xff, 0x01, 0xf8, 0x52, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x6c, 0xff, 0xfa, 0x5a,
+    0xfe, 0x00, 0x13, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xfc, 0x64, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x70, 0xff, 0xfc, 0x6e, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x03, 0x72, 0xff, 0xff, 0x78, 0xdd, 0x00,
 
     /*Unicode: U+006c (l) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-
+    0xfd, 0x00, 0xe5, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+006d (m) , Width: 14 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0xff, 0xff, 0x0a, 0x9e, 0xf0, 0xe6, 0x6e, 0x00, 0x10, 0xa2, 0xee, 0xea, 0x84, 0x00,  //@@.%@@+..%@@%.
-    0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x5c,  //@@%@@@@+@@@@@+
-    0xff, 0xff, 0xce, 0x2c, 0x0c, 0x94, 0xff, 0xee, 0xce, 0x2c, 0x0c, 0x94, 0xff, 0xc2,  //@@@..%@@@..%@@
-    0xff, 0xff, 0x36, 0x00, 0x00, 0x18, 0xff, 0xff, 0x36, 0x00, 0x00, 0x18, 0xff, 0xe8,  //@@....@@....@@
-    0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@....@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+    0xad, 0x00, 0x10, 0xff, 0xff, 0x0a, 0x9e, 0xf0, 0xe6, 0x6e, 0x00, 0x10, 0xa2, 0xee, 0xea, 0x84,
+    0x00, 0xff, 0xff, 0xac, 0xfd, 0xff, 0x01, 0x4c, 0xc8, 0xfd, 0xff, 0x1f, 0x5c, 0xff, 0xff, 0xce,
+    0x2c, 0x0c, 0x94, 0xff, 0xee, 0xce, 0x2c, 0x0c, 0x94, 0xff, 0xc2, 0xff, 0xff, 0x36, 0x00, 0x00,
+    0x18, 0xff, 0xff, 0x36, 0x00, 0x00, 0x18, 0xff, 0xe8, 0xff, 0xff, 0x06, 0xfe, 0x00, 0x02, 0xff,
+    0xff, 0x06, 0xfe, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00,
+    0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff,
+    0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01,
+    0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xc9, 0x00,
 
     /*Unicode: U+006e (n) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0x08, 0x9c, 0xf0, 0xea, 0x86, 0x00,  //@@.%@@%.
-    0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@%@@@@+
-    0xff, 0xff, 0xcc, 0x2a, 0x0e, 0x98, 0xff, 0xca,  //@@@..%@@
-    0xff, 0xff, 0x36, 0x00, 0x00, 0x18, 0xff, 0xf2,  //@@....@@
-    0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xd1, 0x00, 0x0a, 0xff, 0xff, 0x08, 0x9c, 0xf0, 0xea, 0x86, 0x00, 0xff, 0xff, 0xaa, 0xfd, 0xff,
+    0x13, 0x6a, 0xff, 0xff, 0xcc, 0x2a, 0x0e, 0x98, 0xff, 0xca, 0xff, 0xff, 0x36, 0x00, 0x00, 0x18,
+    0xff, 0xf2, 0xff, 0xff, 0x06, 0xfe, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd,
+    0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+006f (o) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x04, 0x76, 0xce, 0xf4, 0xf4, 0xce, 0x74, 0x04, 0x00,  //..+@@@@+..
-    0x06, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x04,  //.%@@@@@@%.
-    0x76, 0xff, 0xee, 0x60, 0x14, 0x14, 0x60, 0xf0, 0xff, 0x74,  //+@@+..+@@+
-    0xd0, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xce,  //@@+....+@@
-    0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf4,  //@@......@@
-    0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf4,  //@@......@@
-    0xd0, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xce,  //@@+....+@@
-    0x76, 0xff, 0xec, 0x5c, 0x12, 0x12, 0x5e, 0xee, 0xff, 0x74,  //+@@+..+@@+
-    0x06, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x04,  //.%@@@@@@%.
-    0x00, 0x06, 0x76, 0xd0, 0xf6, 0xf4, 0xd0, 0x74, 0x04, 0x00,  //..+@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xc4, 0x00, 0x0a, 0x04, 0x76, 0xce, 0xf4, 0xf4, 0xce, 0x74, 0x04, 0x00, 0x06, 0xc0, 0xfb, 0xff,
+    0x0e, 0xbc, 0x04, 0x76, 0xff, 0xee, 0x60, 0x14, 0x14, 0x60, 0xf0, 0xff, 0x74, 0xd0, 0xff, 0x5e,
+    0xfd, 0x00, 0x05, 0x62, 0xff, 0xce, 0xf6, 0xff, 0x12, 0xfd, 0x00, 0x05, 0x14, 0xff, 0xf4, 0xf6,
+    0xff, 0x12, 0xfd, 0x00, 0x05, 0x14, 0xff, 0xf4, 0xd0, 0xff, 0x5c, 0xfd, 0x00, 0x0e, 0x60, 0xff,
+    0xce, 0x76, 0xff, 0xec, 0x5c, 0x12, 0x12, 0x5e, 0xee, 0xff, 0x74, 0x06, 0xc0, 0xfb, 0xff, 0x0a,
+    0xbe, 0x04, 0x00, 0x06, 0x76, 0xd0, 0xf6, 0xf4, 0xd0, 0x74, 0x04, 0xd8, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0xff, 0xff, 0x08, 0x98, 0xea, 0xf2, 0xae, 0x1e, 0x00,  //@@.%@@%..
-    0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x10,  //@@%@@@@@.
-    0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88,  //@@@...@@%
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xd4,  //@@+...+@@
-    0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf6,  //@@.....@@
-    0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf6,  //@@.....@@
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xd4,  //@@+...+@@
-    0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88,  //@@@...@@%
-    0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x10,  //@@%@@@@@.
-    0xff, 0xff, 0x0a, 0x9a, 0xec, 0xf2, 0xae, 0x20, 0x00,  //@@.%@@%..
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+    0xcb, 0x00, 0x0b, 0xff, 0xff, 0x08, 0x98, 0xea, 0xf2, 0xae, 0x1e, 0x00, 0xff, 0xff, 0xac, 0xfd,
+    0xff, 0x0d, 0xe2, 0x10, 0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88, 0xff, 0xff, 0x4c,
+    0xfe, 0x00, 0x05, 0x4e, 0xff, 0xd4, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xf6, 0xff,
+    0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xf6, 0xff, 0xff, 0x4c, 0xfe, 0x00, 0x0e, 0x4e, 0xff,
+    0xd4, 0xff, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0x88, 0xff, 0xff, 0xac, 0xfd, 0xff, 0x0c,
+    0xe2, 0x10, 0xff, 0xff, 0x0a, 0x9a, 0xec, 0xf2, 0xae, 0x20, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01,
+    0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 9 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-    0x00, 0x20, 0xae, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff,  //..%@@%.@@
-    0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,  //.@@@@@%@@
-    0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff,  //%@@...@@@
-    0xd6, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff,  //@@+...+@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff,  //@@.....@@
-    0xd6, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff,  //@@+...+@@
-    0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff,  //%@@...@@@
-    0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff,  //.@@@@@%@@
-    0x00, 0x20, 0xb0, 0xf2, 0xec, 0x98, 0x08, 0xff, 0xff,  //..%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-
+    0xca, 0x00, 0x09, 0x20, 0xae, 0xf2, 0xea, 0x96, 0x08, 0xff, 0xff, 0x12, 0xe2, 0xfd, 0xff, 0x0e,
+    0xac, 0xff, 0xff, 0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff, 0xd6, 0xff, 0x4c, 0xfe,
+    0x00, 0x05, 0x4e, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff, 0xf6, 0xff,
+    0x0e, 0xfe, 0x00, 0x05, 0x10, 0xff, 0xff, 0xd6, 0xff, 0x4c, 0xfe, 0x00, 0x0d, 0x4e, 0xff, 0xff,
+    0x88, 0xff, 0xde, 0x3e, 0x0a, 0x3e, 0xe0, 0xff, 0xff, 0x12, 0xe2, 0xfd, 0xff, 0x0b, 0xac, 0xff,
+    0xff, 0x00, 0x20, 0xb0, 0xf2, 0xec, 0x98, 0x08, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+    0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff,
 
     /*Unicode: U+0072 (r) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0xff, 0xff, 0x08, 0x92, 0xe8, 0xfa,  //@@.%@@
-    0xff, 0xff, 0xaa, 0xff, 0xff, 0xff,  //@@%@@@
-    0xff, 0xff, 0xe2, 0x48, 0x0a, 0x00,  //@@@+..
-    0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //@@+...
-    0xff, 0xff, 0x10, 0x00, 0x00, 0x00,  //@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xdd, 0x00, 0x08, 0xff, 0xff, 0x08, 0x92, 0xe8, 0xfa, 0xff, 0xff, 0xaa, 0xfc, 0xff, 0x06, 0xe2,
+    0x48, 0x0a, 0x00, 0xff, 0xff, 0x50, 0xfe, 0x00, 0x02, 0xff, 0xff, 0x10, 0xfe, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff,
+    0xfd, 0x00, 0x01, 0xff, 0xff, 0xe5, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x08, 0x80, 0xd6, 0xf4, 0xf0, 0xba, 0x4a,  //.+@@@%+
-    0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@@@@@
-    0xee, 0xff, 0x70, 0x10, 0x04, 0x34, 0xac,  //@@+...%
-    0xd8, 0xff, 0xb2, 0x7e, 0x3c, 0x00, 0x00,  //@@%+...
-    0x42, 0xe8, 0xff, 0xff, 0xff, 0xda, 0x2e,  //+@@@@@.
-    0x00, 0x08, 0x48, 0x8e, 0xe4, 0xff, 0xc0,  //..+%@@%
-    0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf4,  //.....@@
-    0xb6, 0x44, 0x0a, 0x0a, 0x68, 0xff, 0xf6,  //%+..+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4,  //@@@@@@%
-    0x3e, 0xaa, 0xea, 0xf4, 0xd6, 0x7c, 0x08,  //.%@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xd7, 0x00, 0x07, 0x08, 0x80, 0xd6, 0xf4, 0xf0, 0xba, 0x4a, 0x9e, 0xfb, 0xff, 0x0f, 0xee, 0xff,
+    0x70, 0x10, 0x04, 0x34, 0xac, 0xd8, 0xff, 0xb2, 0x7e, 0x3c, 0x00, 0x00, 0x42, 0xe8, 0xfe, 0xff,
+    0x08, 0xda, 0x2e, 0x00, 0x08, 0x48, 0x8e, 0xe4, 0xff, 0xc0, 0xfd, 0x00, 0x09, 0x18, 0xff, 0xf4,
+    0xb6, 0x44, 0x0a, 0x0a, 0x68, 0xff, 0xf6, 0xfb, 0xff, 0x07, 0xa4, 0x3e, 0xaa, 0xea, 0xf4, 0xd6,
+    0x7c, 0x08, 0xe5, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0x00, 0xfc, 0xff, 0x02, 0x00, 0x00,  //.@@...
-    0x00, 0xea, 0xff, 0x46, 0x00, 0x00,  //.@@+..
-    0x00, 0xaa, 0xff, 0xff, 0xff, 0xff,  //.%@@@@
-    0x00, 0x18, 0xaa, 0xec, 0xfc, 0xff,  //..%@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xee, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe,
+    0x00, 0xf5, 0xff, 0x02, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x02, 0xfc, 0xff, 0x02, 0xfe, 0x00, 0x02, 0xea,
+    0xff, 0x46, 0xfe, 0x00, 0x00, 0xaa, 0xfd, 0xff, 0x05, 0x00, 0x18, 0xaa, 0xec, 0xfc, 0xff, 0xe9,
+    0x00,
 
     /*Unicode: U+0075 (u) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@....@@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff,  //@@....@@
-    0xea, 0xff, 0x1a, 0x00, 0x00, 0x36, 0xff, 0xff,  //@@....@@
-    0xc4, 0xff, 0x96, 0x0c, 0x2a, 0xcc, 0xff, 0xff,  //@@%..@@@
-    0x60, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xff,  //+@@@@%@@
-    0x00, 0x86, 0xea, 0xf0, 0xa0, 0x0a, 0xff, 0xff,  //.%@@%.@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xd1, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd,
+    0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0x13, 0x06, 0xff, 0xff, 0xea,
+    0xff, 0x1a, 0x00, 0x00, 0x36, 0xff, 0xff, 0xc4, 0xff, 0x96, 0x0c, 0x2a, 0xcc, 0xff, 0xff, 0x60,
+    0xfd, 0xff, 0x0a, 0xaa, 0xff, 0xff, 0x00, 0x86, 0xea, 0xf0, 0xa0, 0x0a, 0xff, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x12, 0xf6, 0xfa, 0x16, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xee, 0xe8, 0x04,  //.@@......@@.
-    0x00, 0xa6, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x8a, 0x00,  //.%@+....+@%.
-    0x00, 0x40, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x26, 0x00,  //..@@....@@..
-    0x00, 0x00, 0xd8, 0xff, 0x28, 0x00, 0x00, 0x30, 0xff, 0xc4, 0x00, 0x00,  //..@@....@@..
-    0x00, 0x00, 0x74, 0xff, 0x82, 0x00, 0x00, 0x98, 0xff, 0x62, 0x00, 0x00,  //..+@%..%@+..
-    0x00, 0x00, 0x14, 0xf8, 0xdc, 0x00, 0x0c, 0xf2, 0xf2, 0x0a, 0x00, 0x00,  //...@@..@@...
-    0x00, 0x00, 0x00, 0xa8, 0xff, 0x3a, 0x66, 0xff, 0x9c, 0x00, 0x00, 0x00,  //...%@.+@%...
-    0x00, 0x00, 0x00, 0x42, 0xff, 0x96, 0xce, 0xff, 0x38, 0x00, 0x00, 0x00,  //...+@%@@....
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xf6, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+    0xb9, 0x00, 0x03, 0x12, 0xf6, 0xfa, 0x16, 0xfd, 0x00, 0x07, 0x0a, 0xee, 0xe8, 0x04, 0x00, 0xa6,
+    0xff, 0x70, 0xfd, 0x00, 0x07, 0x62, 0xff, 0x8a, 0x00, 0x00, 0x40, 0xff, 0xcc, 0xfd, 0x00, 0x02,
+    0xca, 0xff, 0x26, 0xfe, 0x00, 0x07, 0xd8, 0xff, 0x28, 0x00, 0x00, 0x30, 0xff, 0xc4, 0xfd, 0x00,
+    0x07, 0x74, 0xff, 0x82, 0x00, 0x00, 0x98, 0xff, 0x62, 0xfd, 0x00, 0x07, 0x14, 0xf8, 0xdc, 0x00,
+    0x0c, 0xf2, 0xf2, 0x0a, 0xfc, 0x00, 0x05, 0xa8, 0xff, 0x3a, 0x66, 0xff, 0x9c, 0xfb, 0x00, 0x05,
+    0x42, 0xff, 0x96, 0xce, 0xff, 0x38, 0xfa, 0x00, 0x03, 0xda, 0xf6, 0xff, 0xd6, 0xf9, 0x00, 0x03,
+    0x76, 0xff, 0xff, 0x74, 0xcd, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x06, 0xf8, 0xfc, 0x0a, 0x00, 0x00, 0xce, 0xff, 0xce, 0x00, 0x00, 0x0a, 0xfc, 0xf6, 0x06,  //.@@...@@@...@@.
-    0x00, 0xc2, 0xff, 0x3e, 0x00, 0x10, 0xfc, 0xff, 0xfc, 0x0e, 0x00, 0x3e, 0xff, 0xc2, 0x00,  //.@@...@@@...@@.
-    0x00, 0x84, 0xff, 0x74, 0x00, 0x4c, 0xff, 0xdc, 0xff, 0x4a, 0x00, 0x72, 0xff, 0x84, 0x00,  //.%@+.+@@@+.+@%.
-    0x00, 0x48, 0xff, 0xaa, 0x00, 0x8c, 0xff, 0x58, 0xff, 0x88, 0x00, 0xa8, 0xff, 0x46, 0x00,  //.+@%.%@+@%.%@+.
-    0x00, 0x0c, 0xfa, 0xde, 0x00, 0xcc, 0xe4, 0x00, 0xe4, 0xc6, 0x00, 0xdc, 0xfa, 0x0c, 0x00,  //..@@.@@.@@.@@..
-    0x00, 0x00, 0xcc, 0xff, 0x24, 0xfc, 0x9e, 0x00, 0xa0, 0xf8, 0x1c, 0xff, 0xcc, 0x00, 0x00,  //..@@.@%.%@.@@..
-    0x00, 0x00, 0x8e, 0xff, 0x96, 0xff, 0x5a, 0x00, 0x5a, 0xff, 0x8a, 0xff, 0x8e, 0x00, 0x00,  //..%@%@+.+@%@%..
-    0x00, 0x00, 0x50, 0xff, 0xf6, 0xfc, 0x14, 0x00, 0x16, 0xfc, 0xee, 0xff, 0x50, 0x00, 0x00,  //..+@@@...@@@+..
-    0x00, 0x00, 0x14, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x14, 0x00, 0x00,  //...@@@...@@@...
-    0x00, 0x00, 0x00, 0xd6, 0xff, 0x88, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xd4, 0x00, 0x00, 0x00,  //...@@%...%@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xa7, 0x00, 0x49, 0x06, 0xf8, 0xfc, 0x0a, 0x00, 0x00, 0xce, 0xff, 0xce, 0x00, 0x00, 0x0a, 0xfc,
+    0xf6, 0x06, 0x00, 0xc2, 0xff, 0x3e, 0x00, 0x10, 0xfc, 0xff, 0xfc, 0x0e, 0x00, 0x3e, 0xff, 0xc2,
+    0x00, 0x00, 0x84, 0xff, 0x74, 0x00, 0x4c, 0xff, 0xdc, 0xff, 0x4a, 0x00, 0x72, 0xff, 0x84, 0x00,
+    0x00, 0x48, 0xff, 0xaa, 0x00, 0x8c, 0xff, 0x58, 0xff, 0x88, 0x00, 0xa8, 0xff, 0x46, 0x00, 0x00,
+    0x0c, 0xfa, 0xde, 0x00, 0xcc, 0xe4, 0x00, 0xe4, 0xc6, 0x00, 0xdc, 0xfa, 0x0c, 0xfe, 0x00, 0x0a,
+    0xcc, 0xff, 0x24, 0xfc, 0x9e, 0x00, 0xa0, 0xf8, 0x1c, 0xff, 0xcc, 0xfd, 0x00, 0x0a, 0x8e, 0xff,
+    0x96, 0xff, 0x5a, 0x00, 0x5a, 0xff, 0x8a, 0xff, 0x8e, 0xfd, 0x00, 0x0a, 0x50, 0xff, 0xf6, 0xfc,
+    0x14, 0x00, 0x16, 0xfc, 0xee, 0xff, 0x50, 0xfd, 0x00, 0x03, 0x14, 0xff, 0xff, 0xce, 0xfe, 0x00,
+    0x03, 0xd0, 0xff, 0xff, 0x14, 0xfc, 0x00, 0x02, 0xd6, 0xff, 0x88, 0xfe, 0x00, 0x02, 0x8a, 0xff,
+    0xd4, 0xc2, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 10 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0xa6, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xa4,  //%@@....@@%
-    0x10, 0xe4, 0xff, 0x56, 0x00, 0x00, 0x56, 0xff, 0xde, 0x0e,  //.@@+..+@@.
-    0x00, 0x46, 0xff, 0xd6, 0x00, 0x02, 0xd6, 0xfc, 0x3c, 0x00,  //.+@@..@@..
-    0x00, 0x00, 0x94, 0xff, 0x5c, 0x5c, 0xff, 0x84, 0x00, 0x00,  //..%@++@%..
-    0x00, 0x00, 0x08, 0xda, 0xda, 0xda, 0xce, 0x04, 0x00, 0x00,  //...@@@@...
-    0x00, 0x00, 0x16, 0xec, 0xe0, 0xf0, 0xe8, 0x12, 0x00, 0x00,  //...@@@@...
-    0x00, 0x00, 0xae, 0xff, 0x5c, 0x76, 0xff, 0xa6, 0x00, 0x00,  //..%@++@%..
-    0x00, 0x58, 0xff, 0xd2, 0x00, 0x06, 0xe0, 0xff, 0x52, 0x00,  //.+@@..@@+.
-    0x14, 0xea, 0xff, 0x4a, 0x00, 0x00, 0x58, 0xff, 0xe8, 0x12,  //.@@+..+@@.
-    0xaa, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xff, 0xa8,  //%@@....@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+    0xc5, 0x00, 0x02, 0xa6, 0xff, 0xd2, 0xfd, 0x00, 0x15, 0xd2, 0xff, 0xa4, 0x10, 0xe4, 0xff, 0x56,
+    0x00, 0x00, 0x56, 0xff, 0xde, 0x0e, 0x00, 0x46, 0xff, 0xd6, 0x00, 0x02, 0xd6, 0xfc, 0x3c, 0xfe,
+    0x00, 0x05, 0x94, 0xff, 0x5c, 0x5c, 0xff, 0x84, 0xfd, 0x00, 0x00, 0x08, 0xfe, 0xda, 0x01, 0xce,
+    0x04, 0xfd, 0x00, 0x05, 0x16, 0xec, 0xe0, 0xf0, 0xe8, 0x12, 0xfd, 0x00, 0x05, 0xae, 0xff, 0x5c,
+    0x76, 0xff, 0xa6, 0xfe, 0x00, 0x15, 0x58, 0xff, 0xd2, 0x00, 0x06, 0xe0, 0xff, 0x52, 0x00, 0x14,
+    0xea, 0xff, 0x4a, 0x00, 0x00, 0x58, 0xff, 0xe8, 0x12, 0xaa, 0xff, 0xc2, 0xfd, 0x00, 0x02, 0xc8,
+    0xff, 0xa8, 0xd9, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 12 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-    0x24, 0xfc, 0xf4, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2, 0xfc, 0x26,  //.@@......@@.
-    0x00, 0xa8, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xae, 0x00,  //.%@+....+@%.
-    0x00, 0x30, 0xff, 0xe4, 0x04, 0x00, 0x00, 0x02, 0xe0, 0xff, 0x38, 0x00,  //..@@....@@..
-    0x00, 0x00, 0xb6, 0xff, 0x5e, 0x00, 0x00, 0x56, 0xff, 0xc2, 0x00, 0x00,  //..%@+..+@@..
-    0x00, 0x00, 0x3e, 0xff, 0xd0, 0x00, 0x00, 0xc6, 0xff, 0x4c, 0x00, 0x00,  //...@@..@@+..
-    0x00, 0x00, 0x00, 0xc4, 0xff, 0x42, 0x36, 0xff, 0xd4, 0x00, 0x00, 0x00,  //...@@+.@@...
-    0x00, 0x00, 0x00, 0x4a, 0xff, 0xb6, 0xa8, 0xff, 0x60, 0x00, 0x00, 0x00,  //...+@%%@+...
-    0x00, 0x00, 0x00, 0x00, 0xd0, 0xfc, 0xfa, 0xe2, 0x04, 0x00, 0x00, 0x00,  //....@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00,  //....+@@+....
-    0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xee, 0x0c, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-    0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@%.....
-    0x00, 0x00, 0x00, 0x10, 0xba, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@......
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@%......
-    0x00, 0x00, 0xff, 0xf6, 0xb6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@%.......
-
+    0xb9, 0x00, 0x03, 0x24, 0xfc, 0xf4, 0x12, 0xfd, 0x00, 0x07, 0x0e, 0xf2, 0xfc, 0x26, 0x00, 0xa8,
+    0xff, 0x7a, 0xfd, 0x00, 0x0e, 0x74, 0xff, 0xae, 0x00, 0x00, 0x30, 0xff, 0xe4, 0x04, 0x00, 0x00,
+    0x02, 0xe0, 0xff, 0x38, 0xfe, 0x00, 0x07, 0xb6, 0xff, 0x5e, 0x00, 0x00, 0x56, 0xff, 0xc2, 0xfd,
+    0x00, 0x07, 0x3e, 0xff, 0xd0, 0x00, 0x00, 0xc6, 0xff, 0x4c, 0xfc, 0x00, 0x05, 0xc4, 0xff, 0x42,
+    0x36, 0xff, 0xd4, 0xfb, 0x00, 0x05, 0x4a, 0xff, 0xb6, 0xa8, 0xff, 0x60, 0xfa, 0x00, 0x04, 0xd0,
+    0xfc, 0xfa, 0xe2, 0x04, 0xfa, 0x00, 0x03, 0x58, 0xff, 0xff, 0x74, 0xf9, 0x00, 0x03, 0x24, 0xff,
+    0xee, 0x0c, 0xf9, 0x00, 0x02, 0x62, 0xff, 0x8a, 0xf9, 0x00, 0x03, 0x10, 0xba, 0xff, 0x28, 0xfa,
+    0x00, 0xfe, 0xff, 0x00, 0xb4, 0xf9, 0x00, 0x03, 0xff, 0xf6, 0xb6, 0x18, 0xfb, 0x00,
 
     /*Unicode: U+007a (z) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x4a, 0xfc, 0xfa, 0x36,  //....+@@.
-    0x00, 0x00, 0x00, 0x1e, 0xec, 0xff, 0x7a, 0x00,  //....@@+.
-    0x00, 0x00, 0x06, 0xca, 0xff, 0xc2, 0x02, 0x00,  //...@@@..
-    0x00, 0x00, 0x98, 0xff, 0xee, 0x1e, 0x00, 0x00,  //..%@@...
-    0x00, 0x5c, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00,  //.+@@+...
-    0x2a, 0xf4, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00,  //.@@%....
-    0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xd1, 0x00, 0xf2, 0xff, 0x00, 0xda, 0xfd, 0x00, 0x03, 0x4a, 0xfc, 0xfa, 0x36, 0xfe, 0x00, 0x03,
+    0x1e, 0xec, 0xff, 0x7a, 0xfe, 0x00, 0x04, 0x06, 0xca, 0xff, 0xc2, 0x02, 0xfe, 0x00, 0x03, 0x98,
+    0xff, 0xee, 0x1e, 0xfe, 0x00, 0x03, 0x5c, 0xff, 0xff, 0x58, 0xfe, 0x00, 0x03, 0x2a, 0xf4, 0xff,
+    0xa2, 0xfd, 0x00, 0x00, 0xd8, 0xf2, 0xff, 0xe1, 0x00,
 
     /*Unicode: U+007b ({) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x10, 0x96, 0xda, 0xf4, 0xff,  //....%@@@
-    0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff, 0xff,  //...%@@@@
-    0x00, 0x00, 0x00, 0xe8, 0xff, 0x66, 0x0c, 0x00,  //...@@+..
-    0x00, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x0c, 0xff, 0xf6, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x14, 0x86, 0xff, 0xcc, 0x00, 0x00, 0x00,  //..%@@...
-    0xff, 0xff, 0xff, 0xca, 0x32, 0x00, 0x00, 0x00,  //@@@@....
-    0xff, 0xff, 0xfc, 0xc2, 0x26, 0x00, 0x00, 0x00,  //@@@@....
-    0x00, 0x1e, 0xaa, 0xff, 0xbe, 0x00, 0x00, 0x00,  //..%@%...
-    0x00, 0x00, 0x1e, 0xff, 0xf0, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xfa, 0xff, 0x08, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xe2, 0xff, 0x74, 0x0e, 0x00,  //...@@+..
-    0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff,  //...%@@@@
-    0x00, 0x00, 0x00, 0x0c, 0x90, 0xd8, 0xf6, 0xff,  //....%@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xee, 0x00, 0x04, 0x10, 0x96, 0xda, 0xf4, 0xff, 0xfe, 0x00, 0x00, 0xa4, 0xfd, 0xff, 0xfe, 0x00,
+    0x03, 0xe8, 0xff, 0x66, 0x0c, 0xfd, 0x00, 0x02, 0xfc, 0xff, 0x04, 0xfc, 0x00, 0x01, 0xff, 0xff,
+    0xfc, 0x00, 0x02, 0x0c, 0xff, 0xf6, 0xfd, 0x00, 0x03, 0x14, 0x86, 0xff, 0xcc, 0xfe, 0x00, 0xfe,
+    0xff, 0x01, 0xca, 0x32, 0xfe, 0x00, 0x04, 0xff, 0xff, 0xfc, 0xc2, 0x26, 0xfd, 0x00, 0x03, 0x1e,
+    0xaa, 0xff, 0xbe, 0xfc, 0x00, 0x02, 0x1e, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x02, 0xff, 0xff, 0xfb,
+    0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x02, 0xfa, 0xff, 0x08, 0xfc, 0x00, 0x03, 0xe2, 0xff, 0x74,
+    0x0e, 0xfd, 0x00, 0x00, 0x96, 0xfd, 0xff, 0xfe, 0x00, 0x04, 0x0c, 0x90, 0xd8, 0xf6, 0xff, 0xf9,
+    0x00,
 
     /*Unicode: U+007c (|) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-    0xff, 0xff,  //@@
-
+    0xfd, 0x00, 0xdd, 0xff,
 
     /*Unicode: U+007d (}) , Width: 8 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-    0xff, 0xf4, 0xda, 0x96, 0x10, 0x00, 0x00, 0x00,  //@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00,  //@@@@%...
-    0x00, 0x0c, 0x64, 0xff, 0xe8, 0x00, 0x00, 0x00,  //..+@@...
-    0x00, 0x00, 0x04, 0xff, 0xfc, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xf8, 0xff, 0x0a, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xcc, 0xff, 0x86, 0x14, 0x00,  //...@@%..
-    0x00, 0x00, 0x00, 0x32, 0xca, 0xff, 0xff, 0xff,  //....@@@@
-    0x00, 0x00, 0x00, 0x26, 0xc2, 0xfc, 0xff, 0xff,  //....@@@@
-    0x00, 0x00, 0x00, 0xbe, 0xff, 0xa8, 0x1e, 0x00,  //...%@%..
-    0x00, 0x00, 0x00, 0xf0, 0xff, 0x1e, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x00, 0x0a, 0xff, 0xf8, 0x00, 0x00, 0x00,  //...@@...
-    0x00, 0x0c, 0x70, 0xff, 0xe0, 0x00, 0x00, 0x00,  //..+@@...
-    0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00,  //@@@@%...
-    0xff, 0xf6, 0xd8, 0x90, 0x0c, 0x00, 0x00, 0x00,  //@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+    0xf1, 0x00, 0x04, 0xff, 0xf4, 0xda, 0x96, 0x10, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xa4, 0xfd, 0x00,
+    0x03, 0x0c, 0x64, 0xff, 0xe8, 0xfc, 0x00, 0x02, 0x04, 0xff, 0xfc, 0xfb, 0x00, 0x01, 0xff, 0xff,
+    0xfb, 0x00, 0x02, 0xf8, 0xff, 0x0a, 0xfc, 0x00, 0x03, 0xcc, 0xff, 0x86, 0x14, 0xfd, 0x00, 0x01,
+    0x32, 0xca, 0xfe, 0xff, 0xfe, 0x00, 0x04, 0x26, 0xc2, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xbe,
+    0xff, 0xa8, 0x1e, 0xfd, 0x00, 0x02, 0xf0, 0xff, 0x1e, 0xfc, 0x00, 0x02, 0xff, 0xff, 0x02, 0xfc,
+    0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0a, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x0c, 0x70, 0xff,
+    0xe0, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0x96, 0xfe, 0x00, 0x04, 0xff, 0xf6, 0xd8, 0x90, 0x0c, 0xf6,
+    0x00,
 
     /*Unicode: U+007e (~) , Width: 11 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,  //...........
-    0x10, 0x8e, 0xe4, 0xf6, 0xd0, 0x8a, 0x3e, 0x0a, 0x0e, 0x58, 0xda,  //.%@@@%...+@
-    0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,  //@@@@@@@@@@@
-    0xea, 0x68, 0x12, 0x0c, 0x40, 0x8a, 0xd2, 0xf6, 0xe4, 0x90, 0x10,  //@+...%@@@%.
-    0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
-
+    0xaa, 0x00, 0x0c, 0x08, 0x10, 0x8e, 0xe4, 0xf6, 0xd0, 0x8a, 0x3e, 0x0a, 0x0e, 0x58, 0xda, 0xe2,
+    0xf8, 0xff, 0x0c, 0xe2, 0xea, 0x68, 0x12, 0x0c, 0x40, 0x8a, 0xd2, 0xf6, 0xe4, 0x90, 0x10, 0x1a,
+    0x9f, 0x00,
 
 #endif
 };
@@ -8765,391 +2064,391 @@ static const uint8_t lv_font_dejavu_20_glyph_bitmap[] = {
 static const lv_font_glyph_dsc_t lv_font_dejavu_20_glyph_dsc[] = {
 #if USE_LV_FONT_DEJAVU_20 == 1
     {.w_px = 6,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 2,   .glyph_index = 20}, /*Unicode: U+0021 (!)*/
-    {.w_px = 6,   .glyph_index = 40}, /*Unicode: U+0022 (")*/
-    {.w_px = 12,  .glyph_index = 60}, /*Unicode: U+0023 (#)*/
-    {.w_px = 9,   .glyph_index = 100},    /*Unicode: U+0024 ($)*/
-    {.w_px = 15,  .glyph_index = 140},    /*Unicode: U+0025 (%)*/
-    {.w_px = 12,  .glyph_index = 180},    /*Unicode: U+0026 (&)*/
-    {.w_px = 2,   .glyph_index = 220},    /*Unicode: U+0027 (')*/
-    {.w_px = 4,   .glyph_index = 240},    /*Unicode: U+0028 (()*/
-    {.w_px = 4,   .glyph_index = 260},    /*Unicode: U+0029 ())*/
-    {.w_px = 7,   .glyph_index = 280},    /*Unicode: U+002a (*)*/
-    {.w_px = 12,  .glyph_index = 300},    /*Unicode: U+002b (+)*/
-    {.w_px = 3,   .glyph_index = 340},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 360},    /*Unicode: U+002d (-)*/
-    {.w_px = 2,   .glyph_index = 380},    /*Unicode: U+002e (.)*/
-    {.w_px = 6,   .glyph_index = 400},    /*Unicode: U+002f (/)*/
-    {.w_px = 9,   .glyph_index = 420},    /*Unicode: U+0030 (0)*/
-    {.w_px = 8,   .glyph_index = 460},    /*Unicode: U+0031 (1)*/
-    {.w_px = 9,   .glyph_index = 480},    /*Unicode: U+0032 (2)*/
-    {.w_px = 9,   .glyph_index = 520},    /*Unicode: U+0033 (3)*/
-    {.w_px = 10,  .glyph_index = 560},    /*Unicode: U+0034 (4)*/
-    {.w_px = 8,   .glyph_index = 600},    /*Unicode: U+0035 (5)*/
-    {.w_px = 9,   .glyph_index = 620},    /*Unicode: U+0036 (6)*/
-    {.w_px = 8,   .glyph_index = 660},    /*Unicode: U+0037 (7)*/
-    {.w_px = 9,   .glyph_index = 680},    /*Unicode: U+0038 (8)*/
-    {.w_px = 9,   .glyph_index = 720},    /*Unicode: U+0039 (9)*/
-    {.w_px = 2,   .glyph_index = 760},    /*Unicode: U+003a (:)*/
-    {.w_px = 3,   .glyph_index = 780},    /*Unicode: U+003b (;)*/
-    {.w_px = 11,  .glyph_index = 800},    /*Unicode: U+003c (<)*/
-    {.w_px = 11,  .glyph_index = 840},    /*Unicode: U+003d (=)*/
-    {.w_px = 11,  .glyph_index = 880},    /*Unicode: U+003e (>)*/
-    {.w_px = 7,   .glyph_index = 920},    /*Unicode: U+003f (?)*/
-    {.w_px = 16,  .glyph_index = 940},    /*Unicode: U+0040 (@)*/
-    {.w_px = 12,  .glyph_index = 980},    /*Unicode: U+0041 (A)*/
-    {.w_px = 9,   .glyph_index = 1020},   /*Unicode: U+0042 (B)*/
-    {.w_px = 11,  .glyph_index = 1060},   /*Unicode: U+0043 (C)*/
-    {.w_px = 11,  .glyph_index = 1100},   /*Unicode: U+0044 (D)*/
-    {.w_px = 8,   .glyph_index = 1140},   /*Unicode: U+0045 (E)*/
-    {.w_px = 8,   .glyph_index = 1160},   /*Unicode: U+0046 (F)*/
-    {.w_px = 11,  .glyph_index = 1180},   /*Unicode: U+0047 (G)*/
-    {.w_px = 10,  .glyph_index = 1220},   /*Unicode: U+0048 (H)*/
-    {.w_px = 2,   .glyph_index = 1260},   /*Unicode: U+0049 (I)*/
-    {.w_px = 4,   .glyph_index = 1280},   /*Unicode: U+004a (J)*/
-    {.w_px = 11,  .glyph_index = 1300},   /*Unicode: U+004b (K)*/
-    {.w_px = 8,   .glyph_index = 1340},   /*Unicode: U+004c (L)*/
-    {.w_px = 12,  .glyph_index = 1360},   /*Unicode: U+004d (M)*/
-    {.w_px = 10,  .glyph_index = 1400},   /*Unicode: U+004e (N)*/
-    {.w_px = 12,  .glyph_index = 1440},   /*Unicode: U+004f (O)*/
-    {.w_px = 8,   .glyph_index = 1480},   /*Unicode: U+0050 (P)*/
-    {.w_px = 12,  .glyph_index = 1500},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 10,  .glyph_index = 1540},   /*Unicode: U+0052 (R)*/
-    {.w_px = 9,   .glyph_index = 1580},   /*Unicode: U+0053 (S)*/
-    {.w_px = 12,  .glyph_index = 1620},   /*Unicode: U+0054 (T)*/
-    {.w_px = 10,  .glyph_index = 1660},   /*Unicode: U+0055 (U)*/
-    {.w_px = 12,  .glyph_index = 1700},   /*Unicode: U+0056 (V)*/
-    {.w_px = 17,  .glyph_index = 1740},   /*Unicode: U+0057 (W)*/
-    {.w_px = 11,  .glyph_index = 1800},   /*Unicode: U+0058 (X)*/
-    {.w_px = 12,  .glyph_index = 1840},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 11,  .glyph_index = 1880},   /*Unicode: U+005a (Z)*/
-    {.w_px = 4,   .glyph_index = 1920},   /*Unicode: U+005b ([)*/
-    {.w_px = 6,   .glyph_index = 1940},   /*Unicode: U+005c (\)*/
-    {.w_px = 4,   .glyph_index = 1960},   /*Unicode: U+005d (])*/
-    {.w_px = 11,  .glyph_index = 1980},   /*Unicode: U+005e (^)*/
-    {.w_px = 9,   .glyph_index = 2020},   /*Unicode: U+005f (_)*/
-    {.w_px = 4,   .glyph_index = 2060},   /*Unicode: U+0060 (`)*/
-    {.w_px = 8,   .glyph_index = 2080},   /*Unicode: U+0061 (a)*/
-    {.w_px = 9,   .glyph_index = 2100},   /*Unicode: U+0062 (b)*/
-    {.w_px = 8,   .glyph_index = 2140},   /*Unicode: U+0063 (c)*/
-    {.w_px = 9,   .glyph_index = 2160},   /*Unicode: U+0064 (d)*/
-    {.w_px = 10,  .glyph_index = 2200},   /*Unicode: U+0065 (e)*/
-    {.w_px = 7,   .glyph_index = 2240},   /*Unicode: U+0066 (f)*/
-    {.w_px = 9,   .glyph_index = 2260},   /*Unicode: U+0067 (g)*/
-    {.w_px = 8,   .glyph_index = 2300},   /*Unicode: U+0068 (h)*/
-    {.w_px = 2,   .glyph_index = 2320},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 2340},   /*Unicode: U+006a (j)*/
-    {.w_px = 9,   .glyph_index = 2360},   /*Unicode: U+006b (k)*/
-    {.w_px = 2,   .glyph_index = 2400},   /*Unicode: U+006c (l)*/
-    {.w_px = 14,  .glyph_index = 2420},   /*Unicode: U+006d (m)*/
-    {.w_px = 8,   .glyph_index = 2460},   /*Unicode: U+006e (n)*/
-    {.w_px = 10,  .glyph_index = 2480},   /*Unicode: U+006f (o)*/
-    {.w_px = 9,   .glyph_index = 2520},   /*Unicode: U+0070 (p)*/
-    {.w_px = 9,   .glyph_index = 2560},   /*Unicode: U+0071 (q)*/
-    {.w_px = 6,   .glyph_index = 2600},   /*Unicode: U+0072 (r)*/
-    {.w_px = 7,   .glyph_index = 2620},   /*Unicode: U+0073 (s)*/
-    {.w_px = 6,   .glyph_index = 2640},   /*Unicode: U+0074 (t)*/
-    {.w_px = 8,   .glyph_index = 2660},   /*Unicode: U+0075 (u)*/
-    {.w_px = 12,  .glyph_index = 2680},   /*Unicode: U+0076 (v)*/
-    {.w_px = 15,  .glyph_index = 2720},   /*Unicode: U+0077 (w)*/
-    {.w_px = 10,  .glyph_index = 2760},   /*Unicode: U+0078 (x)*/
-    {.w_px = 12,  .glyph_index = 2800},   /*Unicode: U+0079 (y)*/
-    {.w_px = 8,   .glyph_index = 2840},   /*Unicode: U+007a (z)*/
-    {.w_px = 8,   .glyph_index = 2860},   /*Unicode: U+007b ({)*/
-    {.w_px = 2,   .glyph_index = 2880},   /*Unicode: U+007c (|)*/
-    {.w_px = 8,   .glyph_index = 2900},   /*Unicode: U+007d (})*/
-    {.w_px = 11,  .glyph_index = 2920},   /*Unicode: U+007e (~)*/
+    {.w_px = 2,   .glyph_index = 2}, /*Unicode: U+0021 (!)*/
+    {.w_px = 6,   .glyph_index = 13}, /*Unicode: U+0022 (")*/
+    {.w_px = 12,  .glyph_index = 19}, /*Unicode: U+0023 (#)*/
+    {.w_px = 9,   .glyph_index = 51},    /*Unicode: U+0024 ($)*/
+    {.w_px = 15,  .glyph_index = 89},    /*Unicode: U+0025 (%)*/
+    {.w_px = 12,  .glyph_index = 120},    /*Unicode: U+0026 (&)*/
+    {.w_px = 2,   .glyph_index = 151},    /*Unicode: U+0027 (')*/
+    {.w_px = 4,   .glyph_index = 157},    /*Unicode: U+0028 (()*/
+    {.w_px = 4,   .glyph_index = 175},    /*Unicode: U+0029 ())*/
+    {.w_px = 7,   .glyph_index = 193},    /*Unicode: U+002a (*)*/
+    {.w_px = 12,  .glyph_index = 206},    /*Unicode: U+002b (+)*/
+    {.w_px = 3,   .glyph_index = 234},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 243},    /*Unicode: U+002d (-)*/
+    {.w_px = 2,   .glyph_index = 250},    /*Unicode: U+002e (.)*/
+    {.w_px = 6,   .glyph_index = 257},    /*Unicode: U+002f (/)*/
+    {.w_px = 9,   .glyph_index = 277},    /*Unicode: U+0030 (0)*/
+    {.w_px = 8,   .glyph_index = 307},    /*Unicode: U+0031 (1)*/
+    {.w_px = 9,   .glyph_index = 320},    /*Unicode: U+0032 (2)*/
+    {.w_px = 9,   .glyph_index = 350},    /*Unicode: U+0033 (3)*/
+    {.w_px = 10,  .glyph_index = 380},    /*Unicode: U+0034 (4)*/
+    {.w_px = 8,   .glyph_index = 410},    /*Unicode: U+0035 (5)*/
+    {.w_px = 9,   .glyph_index = 428},    /*Unicode: U+0036 (6)*/
+    {.w_px = 8,   .glyph_index = 458},    /*Unicode: U+0037 (7)*/
+    {.w_px = 9,   .glyph_index = 475},    /*Unicode: U+0038 (8)*/
+    {.w_px = 9,   .glyph_index = 505},    /*Unicode: U+0039 (9)*/
+    {.w_px = 2,   .glyph_index = 535},    /*Unicode: U+003a (:)*/
+    {.w_px = 3,   .glyph_index = 547},    /*Unicode: U+003b (;)*/
+    {.w_px = 11,  .glyph_index = 561},    /*Unicode: U+003c (<)*/
+    {.w_px = 11,  .glyph_index = 585},    /*Unicode: U+003d (=)*/
+    {.w_px = 11,  .glyph_index = 601},    /*Unicode: U+003e (>)*/
+    {.w_px = 7,   .glyph_index = 625},    /*Unicode: U+003f (?)*/
+    {.w_px = 16,  .glyph_index = 643},    /*Unicode: U+0040 (@)*/
+    {.w_px = 12,  .glyph_index = 680},    /*Unicode: U+0041 (A)*/
+    {.w_px = 9,   .glyph_index = 710},   /*Unicode: U+0042 (B)*/
+    {.w_px = 11,  .glyph_index = 740},   /*Unicode: U+0043 (C)*/
+    {.w_px = 11,  .glyph_index = 771},   /*Unicode: U+0044 (D)*/
+    {.w_px = 8,   .glyph_index = 800},   /*Unicode: U+0045 (E)*/
+    {.w_px = 8,   .glyph_index = 817},   /*Unicode: U+0046 (F)*/
+    {.w_px = 11,  .glyph_index = 831},   /*Unicode: U+0047 (G)*/
+    {.w_px = 10,  .glyph_index = 862},   /*Unicode: U+0048 (H)*/
+    {.w_px = 2,   .glyph_index = 874},   /*Unicode: U+0049 (I)*/
+    {.w_px = 4,   .glyph_index = 880},   /*Unicode: U+004a (J)*/
+    {.w_px = 11,  .glyph_index = 888},   /*Unicode: U+004b (K)*/
+    {.w_px = 8,   .glyph_index = 919},   /*Unicode: U+004c (L)*/
+    {.w_px = 12,  .glyph_index = 928},   /*Unicode: U+004d (M)*/
+    {.w_px = 10,  .glyph_index = 958},   /*Unicode: U+004e (N)*/
+    {.w_px = 12,  .glyph_index = 989},   /*Unicode: U+004f (O)*/
+    {.w_px = 8,   .glyph_index = 1020},   /*Unicode: U+0050 (P)*/
+    {.w_px = 12,  .glyph_index = 1035},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 10,  .glyph_index = 1070},   /*Unicode: U+0052 (R)*/
+    {.w_px = 9,   .glyph_index = 1101},   /*Unicode: U+0053 (S)*/
+    {.w_px = 12,  .glyph_index = 1131},   /*Unicode: U+0054 (T)*/
+    {.w_px = 10,  .glyph_index = 1161},   /*Unicode: U+0055 (U)*/
+    {.w_px = 12,  .glyph_index = 1173},   /*Unicode: U+0056 (V)*/
+    {.w_px = 17,  .glyph_index = 1200},   /*Unicode: U+0057 (W)*/
+    {.w_px = 11,  .glyph_index = 1243},   /*Unicode: U+0058 (X)*/
+    {.w_px = 12,  .glyph_index = 1274},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 11,  .glyph_index = 1304},   /*Unicode: U+005a (Z)*/
+    {.w_px = 4,   .glyph_index = 1335},   /*Unicode: U+005b ([)*/
+    {.w_px = 6,   .glyph_index = 1347},   /*Unicode: U+005c (\)*/
+    {.w_px = 4,   .glyph_index = 1367},   /*Unicode: U+005d (])*/
+    {.w_px = 11,  .glyph_index = 1379},   /*Unicode: U+005e (^)*/
+    {.w_px = 9,   .glyph_index = 1394},   /*Unicode: U+005f (_)*/
+    {.w_px = 4,   .glyph_index = 1401},   /*Unicode: U+0060 (`)*/
+    {.w_px = 8,   .glyph_index = 1409},   /*Unicode: U+0061 (a)*/
+    {.w_px = 9,   .glyph_index = 1424},   /*Unicode: U+0062 (b)*/
+    {.w_px = 8,   .glyph_index = 1456},   /*Unicode: U+0063 (c)*/
+    {.w_px = 9,   .glyph_index = 1470},   /*Unicode: U+0064 (d)*/
+    {.w_px = 10,  .glyph_index = 1503},   /*Unicode: U+0065 (e)*/
+    {.w_px = 7,   .glyph_index = 1528},   /*Unicode: U+0066 (f)*/
+    {.w_px = 9,   .glyph_index = 1541},   /*Unicode: U+0067 (g)*/
+    {.w_px = 8,   .glyph_index = 1572},   /*Unicode: U+0068 (h)*/
+    {.w_px = 2,   .glyph_index = 1585},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 1596},   /*Unicode: U+006a (j)*/
+    {.w_px = 9,   .glyph_index = 1608},   /*Unicode: U+006b (k)*/
+    {.w_px = 2,   .glyph_index = 1640},   /*Unicode: U+006c (l)*/
+    {.w_px = 14,  .glyph_index = 1647},   /*Unicode: U+006d (m)*/
+    {.w_px = 8,   .glyph_index = 1672},   /*Unicode: U+006e (n)*/
+    {.w_px = 10,  .glyph_index = 1682},   /*Unicode: U+006f (o)*/
+    {.w_px = 9,   .glyph_index = 1701},   /*Unicode: U+0070 (p)*/
+    {.w_px = 9,   .glyph_index = 1732},   /*Unicode: U+0071 (q)*/
+    {.w_px = 6,   .glyph_index = 1763},   /*Unicode: U+0072 (r)*/
+    {.w_px = 7,   .glyph_index = 1773},   /*Unicode: U+0073 (s)*/
+    {.w_px = 6,   .glyph_index = 1788},   /*Unicode: U+0074 (t)*/
+    {.w_px = 8,   .glyph_index = 1802},   /*Unicode: U+0075 (u)*/
+    {.w_px = 12,  .glyph_index = 1812},   /*Unicode: U+0076 (v)*/
+    {.w_px = 15,  .glyph_index = 1834},   /*Unicode: U+0077 (w)*/
+    {.w_px = 10,  .glyph_index = 1859},   /*Unicode: U+0078 (x)*/
+    {.w_px = 12,  .glyph_index = 1884},   /*Unicode: U+0079 (y)*/
+    {.w_px = 8,   .glyph_index = 1913},   /*Unicode: U+007a (z)*/
+    {.w_px = 8,   .glyph_index = 1928},   /*Unicode: U+007b ({)*/
+    {.w_px = 2,   .glyph_index = 1946},   /*Unicode: U+007c (|)*/
+    {.w_px = 8,   .glyph_index = 1951},   /*Unicode: U+007d (})*/
+    {.w_px = 11,  .glyph_index = 1969},   /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_DEJAVU_20 == 2
     {.w_px = 6,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 2,   .glyph_index = 40}, /*Unicode: U+0021 (!)*/
-    {.w_px = 6,   .glyph_index = 60}, /*Unicode: U+0022 (")*/
-    {.w_px = 12,  .glyph_index = 100},    /*Unicode: U+0023 (#)*/
-    {.w_px = 9,   .glyph_index = 160},    /*Unicode: U+0024 ($)*/
-    {.w_px = 15,  .glyph_index = 220},    /*Unicode: U+0025 (%)*/
-    {.w_px = 12,  .glyph_index = 300},    /*Unicode: U+0026 (&)*/
-    {.w_px = 2,   .glyph_index = 360},    /*Unicode: U+0027 (')*/
-    {.w_px = 4,   .glyph_index = 380},    /*Unicode: U+0028 (()*/
-    {.w_px = 4,   .glyph_index = 400},    /*Unicode: U+0029 ())*/
-    {.w_px = 7,   .glyph_index = 420},    /*Unicode: U+002a (*)*/
-    {.w_px = 12,  .glyph_index = 460},    /*Unicode: U+002b (+)*/
-    {.w_px = 3,   .glyph_index = 520},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 540},    /*Unicode: U+002d (-)*/
-    {.w_px = 2,   .glyph_index = 580},    /*Unicode: U+002e (.)*/
-    {.w_px = 6,   .glyph_index = 600},    /*Unicode: U+002f (/)*/
-    {.w_px = 9,   .glyph_index = 640},    /*Unicode: U+0030 (0)*/
-    {.w_px = 8,   .glyph_index = 700},    /*Unicode: U+0031 (1)*/
-    {.w_px = 9,   .glyph_index = 740},    /*Unicode: U+0032 (2)*/
-    {.w_px = 9,   .glyph_index = 800},    /*Unicode: U+0033 (3)*/
-    {.w_px = 10,  .glyph_index = 860},    /*Unicode: U+0034 (4)*/
-    {.w_px = 8,   .glyph_index = 920},    /*Unicode: U+0035 (5)*/
-    {.w_px = 9,   .glyph_index = 960},    /*Unicode: U+0036 (6)*/
-    {.w_px = 8,   .glyph_index = 1020},   /*Unicode: U+0037 (7)*/
-    {.w_px = 9,   .glyph_index = 1060},   /*Unicode: U+0038 (8)*/
-    {.w_px = 9,   .glyph_index = 1120},   /*Unicode: U+0039 (9)*/
-    {.w_px = 2,   .glyph_index = 1180},   /*Unicode: U+003a (:)*/
-    {.w_px = 3,   .glyph_index = 1200},   /*Unicode: U+003b (;)*/
-    {.w_px = 11,  .glyph_index = 1220},   /*Unicode: U+003c (<)*/
-    {.w_px = 11,  .glyph_index = 1280},   /*Unicode: U+003d (=)*/
-    {.w_px = 11,  .glyph_index = 1340},   /*Unicode: U+003e (>)*/
-    {.w_px = 7,   .glyph_index = 1400},   /*Unicode: U+003f (?)*/
-    {.w_px = 16,  .glyph_index = 1440},   /*Unicode: U+0040 (@)*/
-    {.w_px = 12,  .glyph_index = 1520},   /*Unicode: U+0041 (A)*/
-    {.w_px = 9,   .glyph_index = 1580},   /*Unicode: U+0042 (B)*/
-    {.w_px = 11,  .glyph_index = 1640},   /*Unicode: U+0043 (C)*/
-    {.w_px = 11,  .glyph_index = 1700},   /*Unicode: U+0044 (D)*/
-    {.w_px = 8,   .glyph_index = 1760},   /*Unicode: U+0045 (E)*/
-    {.w_px = 8,   .glyph_index = 1800},   /*Unicode: U+0046 (F)*/
-    {.w_px = 11,  .glyph_index = 1840},   /*Unicode: U+0047 (G)*/
-    {.w_px = 10,  .glyph_index = 1900},   /*Unicode: U+0048 (H)*/
-    {.w_px = 2,   .glyph_index = 1960},   /*Unicode: U+0049 (I)*/
-    {.w_px = 4,   .glyph_index = 1980},   /*Unicode: U+004a (J)*/
-    {.w_px = 11,  .glyph_index = 2000},   /*Unicode: U+004b (K)*/
-    {.w_px = 8,   .glyph_index = 2060},   /*Unicode: U+004c (L)*/
-    {.w_px = 12,  .glyph_index = 2100},   /*Unicode: U+004d (M)*/
-    {.w_px = 10,  .glyph_index = 2160},   /*Unicode: U+004e (N)*/
-    {.w_px = 12,  .glyph_index = 2220},   /*Unicode: U+004f (O)*/
-    {.w_px = 8,   .glyph_index = 2280},   /*Unicode: U+0050 (P)*/
-    {.w_px = 12,  .glyph_index = 2320},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 10,  .glyph_index = 2380},   /*Unicode: U+0052 (R)*/
-    {.w_px = 9,   .glyph_index = 2440},   /*Unicode: U+0053 (S)*/
-    {.w_px = 12,  .glyph_index = 2500},   /*Unicode: U+0054 (T)*/
-    {.w_px = 10,  .glyph_index = 2560},   /*Unicode: U+0055 (U)*/
-    {.w_px = 12,  .glyph_index = 2620},   /*Unicode: U+0056 (V)*/
-    {.w_px = 17,  .glyph_index = 2680},   /*Unicode: U+0057 (W)*/
-    {.w_px = 11,  .glyph_index = 2780},   /*Unicode: U+0058 (X)*/
-    {.w_px = 12,  .glyph_index = 2840},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 11,  .glyph_index = 2900},   /*Unicode: U+005a (Z)*/
-    {.w_px = 4,   .glyph_index = 2960},   /*Unicode: U+005b ([)*/
-    {.w_px = 6,   .glyph_index = 2980},   /*Unicode: U+005c (\)*/
-    {.w_px = 4,   .glyph_index = 3020},   /*Unicode: U+005d (])*/
-    {.w_px = 11,  .glyph_index = 3040},   /*Unicode: U+005e (^)*/
-    {.w_px = 9,   .glyph_index = 3100},   /*Unicode: U+005f (_)*/
-    {.w_px = 4,   .glyph_index = 3160},   /*Unicode: U+0060 (`)*/
-    {.w_px = 8,   .glyph_index = 3180},   /*Unicode: U+0061 (a)*/
-    {.w_px = 9,   .glyph_index = 3220},   /*Unicode: U+0062 (b)*/
-    {.w_px = 8,   .glyph_index = 3280},   /*Unicode: U+0063 (c)*/
-    {.w_px = 9,   .glyph_index = 3320},   /*Unicode: U+0064 (d)*/
-    {.w_px = 10,  .glyph_index = 3380},   /*Unicode: U+0065 (e)*/
-    {.w_px = 7,   .glyph_index = 3440},   /*Unicode: U+0066 (f)*/
-    {.w_px = 9,   .glyph_index = 3480},   /*Unicode: U+0067 (g)*/
-    {.w_px = 8,   .glyph_index = 3540},   /*Unicode: U+0068 (h)*/
-    {.w_px = 2,   .glyph_index = 3580},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 3600},   /*Unicode: U+006a (j)*/
-    {.w_px = 9,   .glyph_index = 3620},   /*Unicode: U+006b (k)*/
-    {.w_px = 2,   .glyph_index = 3680},   /*Unicode: U+006c (l)*/
-    {.w_px = 14,  .glyph_index = 3700},   /*Unicode: U+006d (m)*/
-    {.w_px = 8,   .glyph_index = 3780},   /*Unicode: U+006e (n)*/
-    {.w_px = 10,  .glyph_index = 3820},   /*Unicode: U+006f (o)*/
-    {.w_px = 9,   .glyph_index = 3880},   /*Unicode: U+0070 (p)*/
-    {.w_px = 9,   .glyph_index = 3940},   /*Unicode: U+0071 (q)*/
-    {.w_px = 6,   .glyph_index = 4000},   /*Unicode: U+0072 (r)*/
-    {.w_px = 7,   .glyph_index = 4040},   /*Unicode: U+0073 (s)*/
-    {.w_px = 6,   .glyph_index = 4080},   /*Unicode: U+0074 (t)*/
-    {.w_px = 8,   .glyph_index = 4120},   /*Unicode: U+0075 (u)*/
-    {.w_px = 12,  .glyph_index = 4160},   /*Unicode: U+0076 (v)*/
-    {.w_px = 15,  .glyph_index = 4220},   /*Unicode: U+0077 (w)*/
-    {.w_px = 10,  .glyph_index = 4300},   /*Unicode: U+0078 (x)*/
-    {.w_px = 12,  .glyph_index = 4360},   /*Unicode: U+0079 (y)*/
-    {.w_px = 8,   .glyph_index = 4420},   /*Unicode: U+007a (z)*/
-    {.w_px = 8,   .glyph_index = 4460},   /*Unicode: U+007b ({)*/
-    {.w_px = 2,   .glyph_index = 4500},   /*Unicode: U+007c (|)*/
-    {.w_px = 8,   .glyph_index = 4520},   /*Unicode: U+007d (})*/
-    {.w_px = 11,  .glyph_index = 4560},   /*Unicode: U+007e (~)*/
+    {.w_px = 2,   .glyph_index = 2}, /*Unicode: U+0021 (!)*/
+    {.w_px = 6,   .glyph_index = 13}, /*Unicode: U+0022 (")*/
+    {.w_px = 12,  .glyph_index = 19},    /*Unicode: U+0023 (#)*/
+    {.w_px = 9,   .glyph_index = 64},    /*Unicode: U+0024 ($)*/
+    {.w_px = 15,  .glyph_index = 118},    /*Unicode: U+0025 (%)*/
+    {.w_px = 12,  .glyph_index = 175},    /*Unicode: U+0026 (&)*/
+    {.w_px = 2,   .glyph_index = 219},    /*Unicode: U+0027 (')*/
+    {.w_px = 4,   .glyph_index = 225},    /*Unicode: U+0028 (()*/
+    {.w_px = 4,   .glyph_index = 245},    /*Unicode: U+0029 ())*/
+    {.w_px = 7,   .glyph_index = 265},    /*Unicode: U+002a (*)*/
+    {.w_px = 12,  .glyph_index = 285},    /*Unicode: U+002b (+)*/
+    {.w_px = 3,   .glyph_index = 321},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 330},    /*Unicode: U+002d (-)*/
+    {.w_px = 2,   .glyph_index = 339},    /*Unicode: U+002e (.)*/
+    {.w_px = 6,   .glyph_index = 346},    /*Unicode: U+002f (/)*/
+    {.w_px = 9,   .glyph_index = 379},    /*Unicode: U+0030 (0)*/
+    {.w_px = 8,   .glyph_index = 422},    /*Unicode: U+0031 (1)*/
+    {.w_px = 9,   .glyph_index = 451},    /*Unicode: U+0032 (2)*/
+    {.w_px = 9,   .glyph_index = 494},    /*Unicode: U+0033 (3)*/
+    {.w_px = 10,  .glyph_index = 537},    /*Unicode: U+0034 (4)*/
+    {.w_px = 8,   .glyph_index = 579},    /*Unicode: U+0035 (5)*/
+    {.w_px = 9,   .glyph_index = 610},    /*Unicode: U+0036 (6)*/
+    {.w_px = 8,   .glyph_index = 653},   /*Unicode: U+0037 (7)*/
+    {.w_px = 9,   .glyph_index = 682},   /*Unicode: U+0038 (8)*/
+    {.w_px = 9,   .glyph_index = 725},   /*Unicode: U+0039 (9)*/
+    {.w_px = 2,   .glyph_index = 768},   /*Unicode: U+003a (:)*/
+    {.w_px = 3,   .glyph_index = 780},   /*Unicode: U+003b (;)*/
+    {.w_px = 11,  .glyph_index = 794},   /*Unicode: U+003c (<)*/
+    {.w_px = 11,  .glyph_index = 827},   /*Unicode: U+003d (=)*/
+    {.w_px = 11,  .glyph_index = 847},   /*Unicode: U+003e (>)*/
+    {.w_px = 7,   .glyph_index = 880},   /*Unicode: U+003f (?)*/
+    {.w_px = 16,  .glyph_index = 910},   /*Unicode: U+0040 (@)*/
+    {.w_px = 12,  .glyph_index = 977},   /*Unicode: U+0041 (A)*/
+    {.w_px = 9,   .glyph_index = 1020},   /*Unicode: U+0042 (B)*/
+    {.w_px = 11,  .glyph_index = 1063},   /*Unicode: U+0043 (C)*/
+    {.w_px = 11,  .glyph_index = 1107},   /*Unicode: U+0044 (D)*/
+    {.w_px = 8,   .glyph_index = 1150},   /*Unicode: U+0045 (E)*/
+    {.w_px = 8,   .glyph_index = 1176},   /*Unicode: U+0046 (F)*/
+    {.w_px = 11,  .glyph_index = 1204},   /*Unicode: U+0047 (G)*/
+    {.w_px = 10,  .glyph_index = 1248},   /*Unicode: U+0048 (H)*/
+    {.w_px = 2,   .glyph_index = 1292},   /*Unicode: U+0049 (I)*/
+    {.w_px = 4,   .glyph_index = 1298},   /*Unicode: U+004a (J)*/
+    {.w_px = 11,  .glyph_index = 1306},   /*Unicode: U+004b (K)*/
+    {.w_px = 8,   .glyph_index = 1350},   /*Unicode: U+004c (L)*/
+    {.w_px = 12,  .glyph_index = 1379},   /*Unicode: U+004d (M)*/
+    {.w_px = 10,  .glyph_index = 1423},   /*Unicode: U+004e (N)*/
+    {.w_px = 12,  .glyph_index = 1465},   /*Unicode: U+004f (O)*/
+    {.w_px = 8,   .glyph_index = 1509},   /*Unicode: U+0050 (P)*/
+    {.w_px = 12,  .glyph_index = 1539},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 10,  .glyph_index = 1589},   /*Unicode: U+0052 (R)*/
+    {.w_px = 9,   .glyph_index = 1633},   /*Unicode: U+0053 (S)*/
+    {.w_px = 12,  .glyph_index = 1676},   /*Unicode: U+0054 (T)*/
+    {.w_px = 10,  .glyph_index = 1715},   /*Unicode: U+0055 (U)*/
+    {.w_px = 12,  .glyph_index = 1758},   /*Unicode: U+0056 (V)*/
+    {.w_px = 17,  .glyph_index = 1801},   /*Unicode: U+0057 (W)*/
+    {.w_px = 11,  .glyph_index = 1870},   /*Unicode: U+0058 (X)*/
+    {.w_px = 12,  .glyph_index = 1914},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 11,  .glyph_index = 1957},   /*Unicode: U+005a (Z)*/
+    {.w_px = 4,   .glyph_index = 2001},   /*Unicode: U+005b ([)*/
+    {.w_px = 6,   .glyph_index = 2013},   /*Unicode: U+005c (\)*/
+    {.w_px = 4,   .glyph_index = 2048},   /*Unicode: U+005d (])*/
+    {.w_px = 11,  .glyph_index = 2060},   /*Unicode: U+005e (^)*/
+    {.w_px = 9,   .glyph_index = 2079},   /*Unicode: U+005f (_)*/
+    {.w_px = 4,   .glyph_index = 2088},   /*Unicode: U+0060 (`)*/
+    {.w_px = 8,   .glyph_index = 2096},   /*Unicode: U+0061 (a)*/
+    {.w_px = 9,   .glyph_index = 2121},   /*Unicode: U+0062 (b)*/
+    {.w_px = 8,   .glyph_index = 2167},   /*Unicode: U+0063 (c)*/
+    {.w_px = 9,   .glyph_index = 2192},   /*Unicode: U+0064 (d)*/
+    {.w_px = 10,  .glyph_index = 2238},   /*Unicode: U+0065 (e)*/
+    {.w_px = 7,   .glyph_index = 2273},   /*Unicode: U+0066 (f)*/
+    {.w_px = 9,   .glyph_index = 2305},   /*Unicode: U+0067 (g)*/
+    {.w_px = 8,   .glyph_index = 2350},   /*Unicode: U+0068 (h)*/
+    {.w_px = 2,   .glyph_index = 2383},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 2394},   /*Unicode: U+006a (j)*/
+    {.w_px = 9,   .glyph_index = 2407},   /*Unicode: U+006b (k)*/
+    {.w_px = 2,   .glyph_index = 2454},   /*Unicode: U+006c (l)*/
+    {.w_px = 14,  .glyph_index = 2461},   /*Unicode: U+006d (m)*/
+    {.w_px = 8,   .glyph_index = 2506},   /*Unicode: U+006e (n)*/
+    {.w_px = 10,  .glyph_index = 2531},   /*Unicode: U+006f (o)*/
+    {.w_px = 9,   .glyph_index = 2565},   /*Unicode: U+0070 (p)*/
+    {.w_px = 9,   .glyph_index = 2610},   /*Unicode: U+0071 (q)*/
+    {.w_px = 6,   .glyph_index = 2655},   /*Unicode: U+0072 (r)*/
+    {.w_px = 7,   .glyph_index = 2679},   /*Unicode: U+0073 (s)*/
+    {.w_px = 6,   .glyph_index = 2704},   /*Unicode: U+0074 (t)*/
+    {.w_px = 8,   .glyph_index = 2735},   /*Unicode: U+0075 (u)*/
+    {.w_px = 12,  .glyph_index = 2760},   /*Unicode: U+0076 (v)*/
+    {.w_px = 15,  .glyph_index = 2794},   /*Unicode: U+0077 (w)*/
+    {.w_px = 10,  .glyph_index = 2838},   /*Unicode: U+0078 (x)*/
+    {.w_px = 12,  .glyph_index = 2873},   /*Unicode: U+0079 (y)*/
+    {.w_px = 8,   .glyph_index = 2918},   /*Unicode: U+007a (z)*/
+    {.w_px = 8,   .glyph_index = 2939},   /*Unicode: U+007b ({)*/
+    {.w_px = 2,   .glyph_index = 2977},   /*Unicode: U+007c (|)*/
+    {.w_px = 8,   .glyph_index = 2982},   /*Unicode: U+007d (})*/
+    {.w_px = 11,  .glyph_index = 3020},   /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_DEJAVU_20 == 4
     {.w_px = 6,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 2,   .glyph_index = 60}, /*Unicode: U+0021 (!)*/
-    {.w_px = 6,   .glyph_index = 80}, /*Unicode: U+0022 (")*/
-    {.w_px = 12,  .glyph_index = 140},    /*Unicode: U+0023 (#)*/
-    {.w_px = 9,   .glyph_index = 260},    /*Unicode: U+0024 ($)*/
-    {.w_px = 15,  .glyph_index = 360},    /*Unicode: U+0025 (%)*/
-    {.w_px = 12,  .glyph_index = 520},    /*Unicode: U+0026 (&)*/
-    {.w_px = 2,   .glyph_index = 640},    /*Unicode: U+0027 (')*/
-    {.w_px = 4,   .glyph_index = 660},    /*Unicode: U+0028 (()*/
-    {.w_px = 4,   .glyph_index = 700},    /*Unicode: U+0029 ())*/
-    {.w_px = 7,   .glyph_index = 740},    /*Unicode: U+002a (*)*/
-    {.w_px = 12,  .glyph_index = 820},    /*Unicode: U+002b (+)*/
-    {.w_px = 3,   .glyph_index = 940},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 980},    /*Unicode: U+002d (-)*/
-    {.w_px = 2,   .glyph_index = 1040},   /*Unicode: U+002e (.)*/
-    {.w_px = 6,   .glyph_index = 1060},   /*Unicode: U+002f (/)*/
-    {.w_px = 9,   .glyph_index = 1120},   /*Unicode: U+0030 (0)*/
-    {.w_px = 8,   .glyph_index = 1220},   /*Unicode: U+0031 (1)*/
-    {.w_px = 9,   .glyph_index = 1300},   /*Unicode: U+0032 (2)*/
-    {.w_px = 9,   .glyph_index = 1400},   /*Unicode: U+0033 (3)*/
-    {.w_px = 10,  .glyph_index = 1500},   /*Unicode: U+0034 (4)*/
-    {.w_px = 8,   .glyph_index = 1600},   /*Unicode: U+0035 (5)*/
-    {.w_px = 9,   .glyph_index = 1680},   /*Unicode: U+0036 (6)*/
-    {.w_px = 8,   .glyph_index = 1780},   /*Unicode: U+0037 (7)*/
-    {.w_px = 9,   .glyph_index = 1860},   /*Unicode: U+0038 (8)*/
-    {.w_px = 9,   .glyph_index = 1960},   /*Unicode: U+0039 (9)*/
-    {.w_px = 2,   .glyph_index = 2060},   /*Unicode: U+003a (:)*/
-    {.w_px = 3,   .glyph_index = 2080},   /*Unicode: U+003b (;)*/
-    {.w_px = 11,  .glyph_index = 2120},   /*Unicode: U+003c (<)*/
-    {.w_px = 11,  .glyph_index = 2240},   /*Unicode: U+003d (=)*/
-    {.w_px = 11,  .glyph_index = 2360},   /*Unicode: U+003e (>)*/
-    {.w_px = 7,   .glyph_index = 2480},   /*Unicode: U+003f (?)*/
-    {.w_px = 16,  .glyph_index = 2560},   /*Unicode: U+0040 (@)*/
-    {.w_px = 12,  .glyph_index = 2720},   /*Unicode: U+0041 (A)*/
-    {.w_px = 9,   .glyph_index = 2840},   /*Unicode: U+0042 (B)*/
-    {.w_px = 11,  .glyph_index = 2940},   /*Unicode: U+0043 (C)*/
-    {.w_px = 11,  .glyph_index = 3060},   /*Unicode: U+0044 (D)*/
-    {.w_px = 8,   .glyph_index = 3180},   /*Unicode: U+0045 (E)*/
-    {.w_px = 8,   .glyph_index = 3260},   /*Unicode: U+0046 (F)*/
-    {.w_px = 11,  .glyph_index = 3340},   /*Unicode: U+0047 (G)*/
-    {.w_px = 10,  .glyph_index = 3460},   /*Unicode: U+0048 (H)*/
-    {.w_px = 2,   .glyph_index = 3560},   /*Unicode: U+0049 (I)*/
-    {.w_px = 4,   .glyph_index = 3580},   /*Unicode: U+004a (J)*/
-    {.w_px = 11,  .glyph_index = 3620},   /*Unicode: U+004b (K)*/
-    {.w_px = 8,   .glyph_index = 3740},   /*Unicode: U+004c (L)*/
-    {.w_px = 12,  .glyph_index = 3820},   /*Unicode: U+004d (M)*/
-    {.w_px = 10,  .glyph_index = 3940},   /*Unicode: U+004e (N)*/
-    {.w_px = 12,  .glyph_index = 4040},   /*Unicode: U+004f (O)*/
-    {.w_px = 8,   .glyph_index = 4160},   /*Unicode: U+0050 (P)*/
-    {.w_px = 12,  .glyph_index = 4240},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 10,  .glyph_index = 4360},   /*Unicode: U+0052 (R)*/
-    {.w_px = 9,   .glyph_index = 4460},   /*Unicode: U+0053 (S)*/
-    {.w_px = 12,  .glyph_index = 4560},   /*Unicode: U+0054 (T)*/
-    {.w_px = 10,  .glyph_index = 4680},   /*Unicode: U+0055 (U)*/
-    {.w_px = 12,  .glyph_index = 4780},   /*Unicode: U+0056 (V)*/
-    {.w_px = 17,  .glyph_index = 4900},   /*Unicode: U+0057 (W)*/
-    {.w_px = 11,  .glyph_index = 5080},   /*Unicode: U+0058 (X)*/
-    {.w_px = 12,  .glyph_index = 5200},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 11,  .glyph_index = 5320},   /*Unicode: U+005a (Z)*/
-    {.w_px = 4,   .glyph_index = 5440},   /*Unicode: U+005b ([)*/
-    {.w_px = 6,   .glyph_index = 5480},   /*Unicode: U+005c (\)*/
-    {.w_px = 4,   .glyph_index = 5540},   /*Unicode: U+005d (])*/
-    {.w_px = 11,  .glyph_index = 5580},   /*Unicode: U+005e (^)*/
-    {.w_px = 9,   .glyph_index = 5700},   /*Unicode: U+005f (_)*/
-    {.w_px = 4,   .glyph_index = 5800},   /*Unicode: U+0060 (`)*/
-    {.w_px = 8,   .glyph_index = 5840},   /*Unicode: U+0061 (a)*/
-    {.w_px = 9,   .glyph_index = 5920},   /*Unicode: U+0062 (b)*/
-    {.w_px = 8,   .glyph_index = 6020},   /*Unicode: U+0063 (c)*/
-    {.w_px = 9,   .glyph_index = 6100},   /*Unicode: U+0064 (d)*/
-    {.w_px = 10,  .glyph_index = 6200},   /*Unicode: U+0065 (e)*/
-    {.w_px = 7,   .glyph_index = 6300},   /*Unicode: U+0066 (f)*/
-    {.w_px = 9,   .glyph_index = 6380},   /*Unicode: U+0067 (g)*/
-    {.w_px = 8,   .glyph_index = 6480},   /*Unicode: U+0068 (h)*/
-    {.w_px = 2,   .glyph_index = 6560},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 6580},   /*Unicode: U+006a (j)*/
-    {.w_px = 9,   .glyph_index = 6620},   /*Unicode: U+006b (k)*/
-    {.w_px = 2,   .glyph_index = 6720},   /*Unicode: U+006c (l)*/
-    {.w_px = 14,  .glyph_index = 6740},   /*Unicode: U+006d (m)*/
-    {.w_px = 8,   .glyph_index = 6880},   /*Unicode: U+006e (n)*/
-    {.w_px = 10,  .glyph_index = 6960},   /*Unicode: U+006f (o)*/
-    {.w_px = 9,   .glyph_index = 7060},   /*Unicode: U+0070 (p)*/
-    {.w_px = 9,   .glyph_index = 7160},   /*Unicode: U+0071 (q)*/
-    {.w_px = 6,   .glyph_index = 7260},   /*Unicode: U+0072 (r)*/
-    {.w_px = 7,   .glyph_index = 7320},   /*Unicode: U+0073 (s)*/
-    {.w_px = 6,   .glyph_index = 7400},   /*Unicode: U+0074 (t)*/
-    {.w_px = 8,   .glyph_index = 7460},   /*Unicode: U+0075 (u)*/
-    {.w_px = 12,  .glyph_index = 7540},   /*Unicode: U+0076 (v)*/
-    {.w_px = 15,  .glyph_index = 7660},   /*Unicode: U+0077 (w)*/
-    {.w_px = 10,  .glyph_index = 7820},   /*Unicode: U+0078 (x)*/
-    {.w_px = 12,  .glyph_index = 7920},   /*Unicode: U+0079 (y)*/
-    {.w_px = 8,   .glyph_index = 8040},   /*Unicode: U+007a (z)*/
-    {.w_px = 8,   .glyph_index = 8120},   /*Unicode: U+007b ({)*/
-    {.w_px = 2,   .glyph_index = 8200},   /*Unicode: U+007c (|)*/
-    {.w_px = 8,   .glyph_index = 8220},   /*Unicode: U+007d (})*/
-    {.w_px = 11,  .glyph_index = 8300},   /*Unicode: U+007e (~)*/
+    {.w_px = 2,   .glyph_index = 2}, /*Unicode: U+0021 (!)*/
+    {.w_px = 6,   .glyph_index = 15}, /*Unicode: U+0022 (")*/
+    {.w_px = 12,  .glyph_index = 35},    /*Unicode: U+0023 (#)*/
+    {.w_px = 9,   .glyph_index = 112},    /*Unicode: U+0024 ($)*/
+    {.w_px = 15,  .glyph_index = 194},    /*Unicode: U+0025 (%)*/
+    {.w_px = 12,  .glyph_index = 301},    /*Unicode: U+0026 (&)*/
+    {.w_px = 2,   .glyph_index = 380},    /*Unicode: U+0027 (')*/
+    {.w_px = 4,   .glyph_index = 386},    /*Unicode: U+0028 (()*/
+    {.w_px = 4,   .glyph_index = 422},    /*Unicode: U+0029 ())*/
+    {.w_px = 7,   .glyph_index = 458},    /*Unicode: U+002a (*)*/
+    {.w_px = 12,  .glyph_index = 492},    /*Unicode: U+002b (+)*/
+    {.w_px = 3,   .glyph_index = 548},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 560},    /*Unicode: U+002d (-)*/
+    {.w_px = 2,   .glyph_index = 571},   /*Unicode: U+002e (.)*/
+    {.w_px = 6,   .glyph_index = 578},   /*Unicode: U+002f (/)*/
+    {.w_px = 9,   .glyph_index = 626},   /*Unicode: U+0030 (0)*/
+    {.w_px = 8,   .glyph_index = 694},   /*Unicode: U+0031 (1)*/
+    {.w_px = 9,   .glyph_index = 745},   /*Unicode: U+0032 (2)*/
+    {.w_px = 9,   .glyph_index = 812},   /*Unicode: U+0033 (3)*/
+    {.w_px = 10,  .glyph_index = 880},   /*Unicode: U+0034 (4)*/
+    {.w_px = 8,   .glyph_index = 937},   /*Unicode: U+0035 (5)*/
+    {.w_px = 9,   .glyph_index = 994},   /*Unicode: U+0036 (6)*/
+    {.w_px = 8,   .glyph_index = 1062},   /*Unicode: U+0037 (7)*/
+    {.w_px = 9,   .glyph_index = 1113},   /*Unicode: U+0038 (8)*/
+    {.w_px = 9,   .glyph_index = 1182},   /*Unicode: U+0039 (9)*/
+    {.w_px = 2,   .glyph_index = 1251},   /*Unicode: U+003a (:)*/
+    {.w_px = 3,   .glyph_index = 1263},   /*Unicode: U+003b (;)*/
+    {.w_px = 11,  .glyph_index = 1282},   /*Unicode: U+003c (<)*/
+    {.w_px = 11,  .glyph_index = 1342},   /*Unicode: U+003d (=)*/
+    {.w_px = 11,  .glyph_index = 1364},   /*Unicode: U+003e (>)*/
+    {.w_px = 7,   .glyph_index = 1423},   /*Unicode: U+003f (?)*/
+    {.w_px = 16,  .glyph_index = 1474},   /*Unicode: U+0040 (@)*/
+    {.w_px = 12,  .glyph_index = 1596},   /*Unicode: U+0041 (A)*/
+    {.w_px = 9,   .glyph_index = 1673},   /*Unicode: U+0042 (B)*/
+    {.w_px = 11,  .glyph_index = 1741},   /*Unicode: U+0043 (C)*/
+    {.w_px = 11,  .glyph_index = 1815},   /*Unicode: U+0044 (D)*/
+    {.w_px = 8,   .glyph_index = 1894},   /*Unicode: U+0045 (E)*/
+    {.w_px = 8,   .glyph_index = 1928},   /*Unicode: U+0046 (F)*/
+    {.w_px = 11,  .glyph_index = 1973},   /*Unicode: U+0047 (G)*/
+    {.w_px = 10,  .glyph_index = 2052},   /*Unicode: U+0048 (H)*/
+    {.w_px = 2,   .glyph_index = 2111},   /*Unicode: U+0049 (I)*/
+    {.w_px = 4,   .glyph_index = 2117},   /*Unicode: U+004a (J)*/
+    {.w_px = 11,  .glyph_index = 2153},   /*Unicode: U+004b (K)*/
+    {.w_px = 8,   .glyph_index = 2236},   /*Unicode: U+004c (L)*/
+    {.w_px = 12,  .glyph_index = 2286},   /*Unicode: U+004d (M)*/
+    {.w_px = 10,  .glyph_index = 2366},   /*Unicode: U+004e (N)*/
+    {.w_px = 12,  .glyph_index = 2436},   /*Unicode: U+004f (O)*/
+    {.w_px = 8,   .glyph_index = 2516},   /*Unicode: U+0050 (P)*/
+    {.w_px = 12,  .glyph_index = 2570},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 10,  .glyph_index = 2661},   /*Unicode: U+0052 (R)*/
+    {.w_px = 9,   .glyph_index = 2731},   /*Unicode: U+0053 (S)*/
+    {.w_px = 12,  .glyph_index = 2799},   /*Unicode: U+0054 (T)*/
+    {.w_px = 10,  .glyph_index = 2860},   /*Unicode: U+0055 (U)*/
+    {.w_px = 12,  .glyph_index = 2929},   /*Unicode: U+0056 (V)*/
+    {.w_px = 17,  .glyph_index = 3008},   /*Unicode: U+0057 (W)*/
+    {.w_px = 11,  .glyph_index = 3128},   /*Unicode: U+0058 (X)*/
+    {.w_px = 12,  .glyph_index = 3210},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 11,  .glyph_index = 3285},   /*Unicode: U+005a (Z)*/
+    {.w_px = 4,   .glyph_index = 3358},   /*Unicode: U+005b ([)*/
+    {.w_px = 6,   .glyph_index = 3390},   /*Unicode: U+005c (\)*/
+    {.w_px = 4,   .glyph_index = 3440},   /*Unicode: U+005d (])*/
+    {.w_px = 11,  .glyph_index = 3472},   /*Unicode: U+005e (^)*/
+    {.w_px = 9,   .glyph_index = 3505},   /*Unicode: U+005f (_)*/
+    {.w_px = 4,   .glyph_index = 3515},   /*Unicode: U+0060 (`)*/
+    {.w_px = 8,   .glyph_index = 3526},   /*Unicode: U+0061 (a)*/
+    {.w_px = 9,   .glyph_index = 3571},   /*Unicode: U+0062 (b)*/
+    {.w_px = 8,   .glyph_index = 3641},   /*Unicode: U+0063 (c)*/
+    {.w_px = 9,   .glyph_index = 3685},   /*Unicode: U+0064 (d)*/
+    {.w_px = 10,  .glyph_index = 3757},   /*Unicode: U+0065 (e)*/
+    {.w_px = 7,   .glyph_index = 3803},   /*Unicode: U+0066 (f)*/
+    {.w_px = 9,   .glyph_index = 3861},   /*Unicode: U+0067 (g)*/
+    {.w_px = 8,   .glyph_index = 3934},   /*Unicode: U+0068 (h)*/
+    {.w_px = 2,   .glyph_index = 3995},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 4006},   /*Unicode: U+006a (j)*/
+    {.w_px = 9,   .glyph_index = 4042},   /*Unicode: U+006b (k)*/
+    {.w_px = 2,   .glyph_index = 4113},   /*Unicode: U+006c (l)*/
+    {.w_px = 14,  .glyph_index = 4120},   /*Unicode: U+006d (m)*/
+    {.w_px = 8,   .glyph_index = 4195},   /*Unicode: U+006e (n)*/
+    {.w_px = 10,  .glyph_index = 4240},   /*Unicode: U+006f (o)*/
+    {.w_px = 9,   .glyph_index = 4293},   /*Unicode: U+0070 (p)*/
+    {.w_px = 9,   .glyph_index = 4361},   /*Unicode: U+0071 (q)*/
+    {.w_px = 6,   .glyph_index = 4434},   /*Unicode: U+0072 (r)*/
+    {.w_px = 7,   .glyph_index = 4467},   /*Unicode: U+0073 (s)*/
+    {.w_px = 6,   .glyph_index = 4511},   /*Unicode: U+0074 (t)*/
+    {.w_px = 8,   .glyph_index = 4552},   /*Unicode: U+0075 (u)*/
+    {.w_px = 12,  .glyph_index = 4597},   /*Unicode: U+0076 (v)*/
+    {.w_px = 15,  .glyph_index = 4659},   /*Unicode: U+0077 (w)*/
+    {.w_px = 10,  .glyph_index = 4742},   /*Unicode: U+0078 (x)*/
+    {.w_px = 12,  .glyph_index = 4797},   /*Unicode: U+0079 (y)*/
+    {.w_px = 8,   .glyph_index = 4879},   /*Unicode: U+007a (z)*/
+    {.w_px = 8,   .glyph_index = 4914},   /*Unicode: U+007b ({)*/
+    {.w_px = 2,   .glyph_index = 4986},   /*Unicode: U+007c (|)*/
+    {.w_px = 8,   .glyph_index = 4991},   /*Unicode: U+007d (})*/
+    {.w_px = 11,  .glyph_index = 5062},   /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_DEJAVU_20 == 8
     {.w_px = 6,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 2,   .glyph_index = 120},    /*Unicode: U+0021 (!)*/
-    {.w_px = 6,   .glyph_index = 160},    /*Unicode: U+0022 (")*/
-    {.w_px = 12,  .glyph_index = 280},    /*Unicode: U+0023 (#)*/
-    {.w_px = 9,   .glyph_index = 520},    /*Unicode: U+0024 ($)*/
-    {.w_px = 15,  .glyph_index = 700},    /*Unicode: U+0025 (%)*/
-    {.w_px = 12,  .glyph_index = 1000},   /*Unicode: U+0026 (&)*/
-    {.w_px = 2,   .glyph_index = 1240},   /*Unicode: U+0027 (')*/
-    {.w_px = 4,   .glyph_index = 1280},   /*Unicode: U+0028 (()*/
-    {.w_px = 4,   .glyph_index = 1360},   /*Unicode: U+0029 ())*/
-    {.w_px = 7,   .glyph_index = 1440},   /*Unicode: U+002a (*)*/
-    {.w_px = 12,  .glyph_index = 1580},   /*Unicode: U+002b (+)*/
-    {.w_px = 3,   .glyph_index = 1820},   /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 1880},   /*Unicode: U+002d (-)*/
-    {.w_px = 2,   .glyph_index = 1980},   /*Unicode: U+002e (.)*/
-    {.w_px = 6,   .glyph_index = 2020},   /*Unicode: U+002f (/)*/
-    {.w_px = 9,   .glyph_index = 2140},   /*Unicode: U+0030 (0)*/
-    {.w_px = 8,   .glyph_index = 2320},   /*Unicode: U+0031 (1)*/
-    {.w_px = 9,   .glyph_index = 2480},   /*Unicode: U+0032 (2)*/
-    {.w_px = 9,   .glyph_index = 2660},   /*Unicode: U+0033 (3)*/
-    {.w_px = 10,  .glyph_index = 2840},   /*Unicode: U+0034 (4)*/
-    {.w_px = 8,   .glyph_index = 3040},   /*Unicode: U+0035 (5)*/
-    {.w_px = 9,   .glyph_index = 3200},   /*Unicode: U+0036 (6)*/
-    {.w_px = 8,   .glyph_index = 3380},   /*Unicode: U+0037 (7)*/
-    {.w_px = 9,   .glyph_index = 3540},   /*Unicode: U+0038 (8)*/
-    {.w_px = 9,   .glyph_index = 3720},   /*Unicode: U+0039 (9)*/
-    {.w_px = 2,   .glyph_index = 3900},   /*Unicode: U+003a (:)*/
-    {.w_px = 3,   .glyph_index = 3940},   /*Unicode: U+003b (;)*/
-    {.w_px = 11,  .glyph_index = 4000},   /*Unicode: U+003c (<)*/
-    {.w_px = 11,  .glyph_index = 4220},   /*Unicode: U+003d (=)*/
-    {.w_px = 11,  .glyph_index = 4440},   /*Unicode: U+003e (>)*/
-    {.w_px = 7,   .glyph_index = 4660},   /*Unicode: U+003f (?)*/
-    {.w_px = 16,  .glyph_index = 4800},   /*Unicode: U+0040 (@)*/
-    {.w_px = 12,  .glyph_index = 5120},   /*Unicode: U+0041 (A)*/
-    {.w_px = 9,   .glyph_index = 5360},   /*Unicode: U+0042 (B)*/
-    {.w_px = 11,  .glyph_index = 5540},   /*Unicode: U+0043 (C)*/
-    {.w_px = 11,  .glyph_index = 5760},   /*Unicode: U+0044 (D)*/
-    {.w_px = 8,   .glyph_index = 5980},   /*Unicode: U+0045 (E)*/
-    {.w_px = 8,   .glyph_index = 6140},   /*Unicode: U+0046 (F)*/
-    {.w_px = 11,  .glyph_index = 6300},   /*Unicode: U+0047 (G)*/
-    {.w_px = 10,  .glyph_index = 6520},   /*Unicode: U+0048 (H)*/
-    {.w_px = 2,   .glyph_index = 6720},   /*Unicode: U+0049 (I)*/
-    {.w_px = 4,   .glyph_index = 6760},   /*Unicode: U+004a (J)*/
-    {.w_px = 11,  .glyph_index = 6840},   /*Unicode: U+004b (K)*/
-    {.w_px = 8,   .glyph_index = 7060},   /*Unicode: U+004c (L)*/
-    {.w_px = 12,  .glyph_index = 7220},   /*Unicode: U+004d (M)*/
-    {.w_px = 10,  .glyph_index = 7460},   /*Unicode: U+004e (N)*/
-    {.w_px = 12,  .glyph_index = 7660},   /*Unicode: U+004f (O)*/
-    {.w_px = 8,   .glyph_index = 7900},   /*Unicode: U+0050 (P)*/
-    {.w_px = 12,  .glyph_index = 8060},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 10,  .glyph_index = 8300},   /*Unicode: U+0052 (R)*/
-    {.w_px = 9,   .glyph_index = 8500},   /*Unicode: U+0053 (S)*/
-    {.w_px = 12,  .glyph_index = 8680},   /*Unicode: U+0054 (T)*/
-    {.w_px = 10,  .glyph_index = 8920},   /*Unicode: U+0055 (U)*/
-    {.w_px = 12,  .glyph_index = 9120},   /*Unicode: U+0056 (V)*/
-    {.w_px = 17,  .glyph_index = 9360},   /*Unicode: U+0057 (W)*/
-    {.w_px = 11,  .glyph_index = 9700},   /*Unicode: U+0058 (X)*/
-    {.w_px = 12,  .glyph_index = 9920},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 11,  .glyph_index = 10160},  /*Unicode: U+005a (Z)*/
-    {.w_px = 4,   .glyph_index = 10380},  /*Unicode: U+005b ([)*/
-    {.w_px = 6,   .glyph_index = 10460},  /*Unicode: U+005c (\)*/
-    {.w_px = 4,   .glyph_index = 10580},  /*Unicode: U+005d (])*/
-    {.w_px = 11,  .glyph_index = 10660},  /*Unicode: U+005e (^)*/
-    {.w_px = 9,   .glyph_index = 10880},  /*Unicode: U+005f (_)*/
-    {.w_px = 4,   .glyph_index = 11060},  /*Unicode: U+0060 (`)*/
-    {.w_px = 8,   .glyph_index = 11140},  /*Unicode: U+0061 (a)*/
-    {.w_px = 9,   .glyph_index = 11300},  /*Unicode: U+0062 (b)*/
-    {.w_px = 8,   .glyph_index = 11480},  /*Unicode: U+0063 (c)*/
-    {.w_px = 9,   .glyph_index = 11640},  /*Unicode: U+0064 (d)*/
-    {.w_px = 10,  .glyph_index = 11820},  /*Unicode: U+0065 (e)*/
-    {.w_px = 7,   .glyph_index = 12020},  /*Unicode: U+0066 (f)*/
-    {.w_px = 9,   .glyph_index = 12160},  /*Unicode: U+0067 (g)*/
-    {.w_px = 8,   .glyph_index = 12340},  /*Unicode: U+0068 (h)*/
-    {.w_px = 2,   .glyph_index = 12500},  /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 12540},  /*Unicode: U+006a (j)*/
-    {.w_px = 9,   .glyph_index = 12620},  /*Unicode: U+006b (k)*/
-    {.w_px = 2,   .glyph_index = 12800},  /*Unicode: U+006c (l)*/
-    {.w_px = 14,  .glyph_index = 12840},  /*Unicode: U+006d (m)*/
-    {.w_px = 8,   .glyph_index = 13120},  /*Unicode: U+006e (n)*/
-    {.w_px = 10,  .glyph_index = 13280},  /*Unicode: U+006f (o)*/
-    {.w_px = 9,   .glyph_index = 13480},  /*Unicode: U+0070 (p)*/
-    {.w_px = 9,   .glyph_index = 13660},  /*Unicode: U+0071 (q)*/
-    {.w_px = 6,   .glyph_index = 13840},  /*Unicode: U+0072 (r)*/
-    {.w_px = 7,   .glyph_index = 13960},  /*Unicode: U+0073 (s)*/
-    {.w_px = 6,   .glyph_index = 14100},  /*Unicode: U+0074 (t)*/
-    {.w_px = 8,   .glyph_index = 14220},  /*Unicode: U+0075 (u)*/
-    {.w_px = 12,  .glyph_index = 14380},  /*Unicode: U+0076 (v)*/
-    {.w_px = 15,  .glyph_index = 14620},  /*Unicode: U+0077 (w)*/
-    {.w_px = 10,  .glyph_index = 14920},  /*Unicode: U+0078 (x)*/
-    {.w_px = 12,  .glyph_index = 15120},  /*Unicode: U+0079 (y)*/
-    {.w_px = 8,   .glyph_index = 15360},  /*Unicode: U+007a (z)*/
-    {.w_px = 8,   .glyph_index = 15520},  /*Unicode: U+007b ({)*/
-    {.w_px = 2,   .glyph_index = 15680},  /*Unicode: U+007c (|)*/
-    {.w_px = 8,   .glyph_index = 15720},  /*Unicode: U+007d (})*/
-    {.w_px = 11,  .glyph_index = 15880},  /*Unicode: U+007e (~)*/
+    {.w_px = 2,   .glyph_index = 2},    /*Unicode: U+0021 (!)*/
+    {.w_px = 6,   .glyph_index = 19},    /*Unicode: U+0022 (")*/
+    {.w_px = 12,  .glyph_index = 50},    /*Unicode: U+0023 (#)*/
+    {.w_px = 9,   .glyph_index = 162},    /*Unicode: U+0024 ($)*/
+    {.w_px = 15,  .glyph_index = 285},    /*Unicode: U+0025 (%)*/
+    {.w_px = 12,  .glyph_index = 469},   /*Unicode: U+0026 (&)*/
+    {.w_px = 2,   .glyph_index = 602},   /*Unicode: U+0027 (')*/
+    {.w_px = 4,   .glyph_index = 608},   /*Unicode: U+0028 (()*/
+    {.w_px = 4,   .glyph_index = 675},   /*Unicode: U+0029 ())*/
+    {.w_px = 7,   .glyph_index = 742},   /*Unicode: U+002a (*)*/
+    {.w_px = 12,  .glyph_index = 797},   /*Unicode: U+002b (+)*/
+    {.w_px = 3,   .glyph_index = 853},   /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 868},   /*Unicode: U+002d (-)*/
+    {.w_px = 2,   .glyph_index = 874},   /*Unicode: U+002e (.)*/
+    {.w_px = 6,   .glyph_index = 880},   /*Unicode: U+002f (/)*/
+    {.w_px = 9,   .glyph_index = 969},   /*Unicode: U+0030 (0)*/
+    {.w_px = 8,   .glyph_index = 1083},   /*Unicode: U+0031 (1)*/
+    {.w_px = 9,   .glyph_index = 1149},   /*Unicode: U+0032 (2)*/
+    {.w_px = 9,   .glyph_index = 1240},   /*Unicode: U+0033 (3)*/
+    {.w_px = 10,  .glyph_index = 1340},   /*Unicode: U+0034 (4)*/
+    {.w_px = 8,   .glyph_index = 1430},   /*Unicode: U+0035 (5)*/
+    {.w_px = 9,   .glyph_index = 1513},   /*Unicode: U+0036 (6)*/
+    {.w_px = 8,   .glyph_index = 1622},   /*Unicode: U+0037 (7)*/
+    {.w_px = 9,   .glyph_index = 1702},   /*Unicode: U+0038 (8)*/
+    {.w_px = 9,   .glyph_index = 1816},   /*Unicode: U+0039 (9)*/
+    {.w_px = 2,   .glyph_index = 1925},   /*Unicode: U+003a (:)*/
+    {.w_px = 3,   .glyph_index = 1935},   /*Unicode: U+003b (;)*/
+    {.w_px = 11,  .glyph_index = 1958},   /*Unicode: U+003c (<)*/
+    {.w_px = 11,  .glyph_index = 2048},   /*Unicode: U+003d (=)*/
+    {.w_px = 11,  .glyph_index = 2058},   /*Unicode: U+003e (>)*/
+    {.w_px = 7,   .glyph_index = 2148},   /*Unicode: U+003f (?)*/
+    {.w_px = 16,  .glyph_index = 2223},   /*Unicode: U+0040 (@)*/
+    {.w_px = 12,  .glyph_index = 2429},   /*Unicode: U+0041 (A)*/
+    {.w_px = 9,   .glyph_index = 2548},   /*Unicode: U+0042 (B)*/
+    {.w_px = 11,  .glyph_index = 2651},   /*Unicode: U+0043 (C)*/
+    {.w_px = 11,  .glyph_index = 2754},   /*Unicode: U+0044 (D)*/
+    {.w_px = 8,   .glyph_index = 2868},   /*Unicode: U+0045 (E)*/
+    {.w_px = 8,   .glyph_index = 2907},   /*Unicode: U+0046 (F)*/
+    {.w_px = 11,  .glyph_index = 2960},   /*Unicode: U+0047 (G)*/
+    {.w_px = 10,  .glyph_index = 3074},   /*Unicode: U+0048 (H)*/
+    {.w_px = 2,   .glyph_index = 3126},   /*Unicode: U+0049 (I)*/
+    {.w_px = 4,   .glyph_index = 3132},   /*Unicode: U+004a (J)*/
+    {.w_px = 11,  .glyph_index = 3201},   /*Unicode: U+004b (K)*/
+    {.w_px = 8,   .glyph_index = 3333},   /*Unicode: U+004c (L)*/
+    {.w_px = 12,  .glyph_index = 3394},   /*Unicode: U+004d (M)*/
+    {.w_px = 10,  .glyph_index = 3519},   /*Unicode: U+004e (N)*/
+    {.w_px = 12,  .glyph_index = 3624},   /*Unicode: U+004f (O)*/
+    {.w_px = 8,   .glyph_index = 3758},   /*Unicode: U+0050 (P)*/
+    {.w_px = 12,  .glyph_index = 3838},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 10,  .glyph_index = 3985},   /*Unicode: U+0052 (R)*/
+    {.w_px = 9,   .glyph_index = 4105},   /*Unicode: U+0053 (S)*/
+    {.w_px = 12,  .glyph_index = 4207},   /*Unicode: U+0054 (T)*/
+    {.w_px = 10,  .glyph_index = 4268},   /*Unicode: U+0055 (U)*/
+    {.w_px = 12,  .glyph_index = 4355},   /*Unicode: U+0056 (V)*/
+    {.w_px = 17,  .glyph_index = 4482},   /*Unicode: U+0057 (W)*/
+    {.w_px = 11,  .glyph_index = 4698},   /*Unicode: U+0058 (X)*/
+    {.w_px = 12,  .glyph_index = 4827},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 11,  .glyph_index = 4931},  /*Unicode: U+005a (Z)*/
+    {.w_px = 4,   .glyph_index = 5010},  /*Unicode: U+005b ([)*/
+    {.w_px = 6,   .glyph_index = 5065},  /*Unicode: U+005c (\)*/
+    {.w_px = 4,   .glyph_index = 5160},  /*Unicode: U+005d (])*/
+    {.w_px = 11,  .glyph_index = 5215},  /*Unicode: U+005e (^)*/
+    {.w_px = 9,   .glyph_index = 5269},  /*Unicode: U+005f (_)*/
+    {.w_px = 4,   .glyph_index = 5275},  /*Unicode: U+0060 (`)*/
+    {.w_px = 8,   .glyph_index = 5292},  /*Unicode: U+0061 (a)*/
+    {.w_px = 9,   .glyph_index = 5367},  /*Unicode: U+0062 (b)*/
+    {.w_px = 8,   .glyph_index = 5479},  /*Unicode: U+0063 (c)*/
+    {.w_px = 9,   .glyph_index = 5549},  /*Unicode: U+0064 (d)*/
+    {.w_px = 10,  .glyph_index = 5659},  /*Unicode: U+0065 (e)*/
+    {.w_px = 7,   .glyph_index = 5738},  /*Unicode: U+0066 (f)*/
+    {.w_px = 9,   .glyph_index = 5809},  /*Unicode: U+0067 (g)*/
+    {.w_px = 8,   .glyph_index = 5929},  /*Unicode: U+0068 (h)*/
+    {.w_px = 2,   .glyph_index = 6013},  /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 6023},  /*Unicode: U+006a (j)*/
+    {.w_px = 9,   .glyph_index = 6089},  /*Unicode: U+006b (k)*/
+    {.w_px = 2,   .glyph_index = 6201},  /*Unicode: U+006c (l)*/
+    {.w_px = 14,  .glyph_index = 6207},  /*Unicode: U+006d (m)*/
+    {.w_px = 8,   .glyph_index = 6328},  /*Unicode: U+006e (n)*/
+    {.w_px = 10,  .glyph_index = 6392},  /*Unicode: U+006f (o)*/
+    {.w_px = 9,   .glyph_index = 6485},  /*Unicode: U+0070 (p)*/
+    {.w_px = 9,   .glyph_index = 6595},  /*Unicode: U+0071 (q)*/
+    {.w_px = 6,   .glyph_index = 6705},  /*Unicode: U+0072 (r)*/
+    {.w_px = 7,   .glyph_index = 6760},  /*Unicode: U+0073 (s)*/
+    {.w_px = 6,   .glyph_index = 6828},  /*Unicode: U+0074 (t)*/
+    {.w_px = 8,   .glyph_index = 6893},  /*Unicode: U+0075 (u)*/
+    {.w_px = 12,  .glyph_index = 6957},  /*Unicode: U+0076 (v)*/
+    {.w_px = 15,  .glyph_index = 7059},  /*Unicode: U+0077 (w)*/
+    {.w_px = 10,  .glyph_index = 7206},  /*Unicode: U+0078 (x)*/
+    {.w_px = 12,  .glyph_index = 7306},  /*Unicode: U+0079 (y)*/
+    {.w_px = 8,   .glyph_index = 7432},  /*Unicode: U+007a (z)*/
+    {.w_px = 8,   .glyph_index = 7489},  /*Unicode: U+007b ({)*/
+    {.w_px = 2,   .glyph_index = 7602},  /*Unicode: U+007c (|)*/
+    {.w_px = 8,   .glyph_index = 7606},  /*Unicode: U+007d (})*/
+    {.w_px = 11,  .glyph_index = 7719},  /*Unicode: U+007e (~)*/
 
 #endif
 };
@@ -9175,6 +2474,7 @@ lv_font_t lv_font_dejavu_20 = {
 #endif
     .monospace = 0,
     .next_page = NULL,      /*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_LV_FONT_DEJAVU_20*/
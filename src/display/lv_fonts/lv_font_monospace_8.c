@@ -11,4191 +11,1356 @@
 static const uint8_t lv_font_monospace_8_glyph_bitmap[] = {
 #if USE_LV_FONT_MONOSPACE_8 == 1
     /*Unicode: U+0020 ( ) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0xf9, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 1 */
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x00,  //.
-    0x00,  //.
-    0x80,  //%
-    0x00,  //.
-
+    0xfd, 0x80, 0x03, 0x00, 0x00, 0x80, 0x00,
 
     /*Unicode: U+0022 (") , Width: 4 */
-    0x90,  //%..%
-    0x90,  //%..%
-    0x90,  //%..%
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-
+    0xfe, 0x90, 0xfc, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 6 */
-    0x48,  //.%..%.
-    0x48,  //.%..%.
-    0xfc,  //%%%%%%
-    0x48,  //.%..%.
-    0xfc,  //%%%%%%
-    0x48,  //.%..%.
-    0x48,  //.%..%.
-    0x00,  //......
-
+    0x07, 0x48, 0x48, 0xfc, 0x48, 0xfc, 0x48, 0x48, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 5 */
-    0x20,  //..%..
-    0x78,  //.%%%%
-    0xa0,  //%.%..
-    0x70,  //.%%%.
-    0x28,  //..%.%
-    0xf0,  //%%%%.
-    0x20,  //..%..
-    0x00,  //.....
-
+    0x07, 0x20, 0x78, 0xa0, 0x70, 0x28, 0xf0, 0x20, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 6 */
-    0x00,  //......
-    0xc4,  //%%...%
-    0xc8,  //%%..%.
-    0x10,  //...%..
-    0x20,  //..%...
-    0x4c,  //.%..%%
-    0x8c,  //%...%%
-    0x00,  //......
-
+    0x07, 0x00, 0xc4, 0xc8, 0x10, 0x20, 0x4c, 0x8c, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 6 */
-    0x60,  //.%%...
-    0x90,  //%..%..
-    0x90,  //%..%..
-    0x60,  //.%%...
-    0x94,  //%..%.%
-    0x88,  //%...%.
-    0x74,  //.%%%.%
-    0x00,  //......
-
+    0x07, 0x60, 0x90, 0x90, 0x60, 0x94, 0x88, 0x74, 0x00,
 
     /*Unicode: U+0027 (') , Width: 3 */
-    0x20,  //..%
-    0x40,  //.%.
-    0x80,  //%..
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0x02, 0x20, 0x40, 0x80, 0xfc, 0x00,
 
     /*Unicode: U+0028 (() , Width: 3 */
-    0x20,  //..%
-    0x40,  //.%.
-    0x80,  //%..
-    0x80,  //%..
-    0x80,  //%..
-    0x40,  //.%.
-    0x20,  //..%
-    0x00,  //...
-
+    0x01, 0x20, 0x40, 0xfe, 0x80, 0x02, 0x40, 0x20, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 3 */
-    0x80,  //%..
-    0x40,  //.%.
-    0x20,  //..%
-    0x20,  //..%
-    0x20,  //..%
-    0x40,  //.%.
-    0x80,  //%..
-    0x00,  //...
-
+    0x01, 0x80, 0x40, 0xfe, 0x20, 0x02, 0x40, 0x80, 0x00,
 
     /*Unicode: U+002a (*) , Width: 5 */
-    0x20,  //..%..
-    0xa8,  //%.%.%
-    0x70,  //.%%%.
-    0x20,  //..%..
-    0x70,  //.%%%.
-    0xa8,  //%.%.%
-    0x20,  //..%..
-    0x00,  //.....
-
+    0x07, 0x20, 0xa8, 0x70, 0x20, 0x70, 0xa8, 0x20, 0x00,
 
     /*Unicode: U+002b (+) , Width: 5 */
-    0x00,  //.....
-    0x20,  //..%..
-    0x20,  //..%..
-    0xf8,  //%%%%%
-    0x20,  //..%..
-    0x20,  //..%..
-    0x00,  //.....
-    0x00,  //.....
-
+    0x07, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00,
 
     /*Unicode: U+002c (,) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x40,  //.%
-    0x40,  //.%
-    0x80,  //%.
-
+    0xfc, 0x00, 0x02, 0x40, 0x40, 0x80,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0xf8,  //%%%%%
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-
+    0xfd, 0x00, 0x00, 0xf8, 0xfe, 0x00,
 
     /*Unicode: U+002e (.) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x80,  //%
-    0x00,  //.
-
+    0xfb, 0x00, 0x01, 0x80, 0x00,
 
     /*Unicode: U+002f (/) , Width: 7 */
-    0x02,  //......%
-    0x04,  //.....%.
-    0x08,  //....%..
-    0x10,  //...%...
-    0x20,  //..%....
-    0x40,  //.%.....
-    0x80,  //%......
-    0x00,  //.......
-
+    0x07, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 5 */
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x98,  //%..%%
-    0xa8,  //%.%.%
-    0xc8,  //%%..%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x70, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 5 */
-    0x20,  //..%..
-    0x60,  //.%%..
-    0xa0,  //%.%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0xf8,  //%%%%%
-    0x00,  //.....
-
+    0x02, 0x20, 0x60, 0xa0, 0xfe, 0x20, 0x01, 0xf8, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 5 */
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x08,  //....%
-    0x10,  //...%.
-    0x60,  //.%%..
-    0x80,  //%....
-    0xf8,  //%%%%%
-    0x00,  //.....
-
+    0x07, 0x70, 0x88, 0x08, 0x10, 0x60, 0x80, 0xf8, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 5 */
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x08,  //....%
-    0x30,  //..%%.
-    0x08,  //....%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x70, 0x88, 0x08, 0x30, 0x08, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 5 */
-    0x10,  //...%.
-    0x30,  //..%%.
-    0x50,  //.%.%.
-    0x90,  //%..%.
-    0xf8,  //%%%%%
-    0x10,  //...%.
-    0x10,  //...%.
-    0x00,  //.....
-
+    0x07, 0x10, 0x30, 0x50, 0x90, 0xf8, 0x10, 0x10, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 5 */
-    0xf8,  //%%%%%
-    0x80,  //%....
-    0xf0,  //%%%%.
-    0x08,  //....%
-    0x08,  //....%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0xf8, 0x80, 0xf0, 0x08, 0x08, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 5 */
-    0x38,  //..%%%
-    0x40,  //.%...
-    0x80,  //%....
-    0xf0,  //%%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x38, 0x40, 0x80, 0xf0, 0x88, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 5 */
-    0xf8,  //%%%%%
-    0x08,  //....%
-    0x10,  //...%.
-    0x20,  //..%..
-    0x40,  //.%...
-    0x40,  //.%...
-    0x40,  //.%...
-    0x00,  //.....
-
+    0x03, 0xf8, 0x08, 0x10, 0x20, 0xfe, 0x40, 0x00, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 5 */
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 5 */
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x08,  //....%
-    0x10,  //...%.
-    0xe0,  //%%%..
-    0x00,  //.....
-
+    0x07, 0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0xe0, 0x00,
 
     /*Unicode: U+003a (:) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0x80,  //%
-    0x00,  //.
-    0x00,  //.
-    0x80,  //%
-    0x00,  //.
-    0x00,  //.
-
+    0x07, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
 
     /*Unicode: U+003b (;) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x40,  //.%
-    0x00,  //..
-    0x00,  //..
-    0x40,  //.%
-    0x40,  //.%
-    0x80,  //%.
-
+    0x07, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x80,
 
     /*Unicode: U+003c (<) , Width: 4 */
-    0x10,  //...%
-    0x20,  //..%.
-    0x40,  //.%..
-    0x80,  //%...
-    0x40,  //.%..
-    0x20,  //..%.
-    0x10,  //...%
-    0x00,  //....
-
+    0x07, 0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x00,
 
     /*Unicode: U+003d (=) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xf8,  //%%%%%
-    0x00,  //.....
-    0xf8,  //%%%%%
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-
+    0x04, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0xfe, 0x00,
 
     /*Unicode: U+003e (>) , Width: 4 */
-    0x80,  //%...
-    0x40,  //.%..
-    0x20,  //..%.
-    0x10,  //...%
-    0x20,  //..%.
-    0x40,  //.%..
-    0x80,  //%...
-    0x00,  //....
-
+    0x07, 0x80, 0x40, 0x20, 0x10, 0x20, 0x40, 0x80, 0x00,
 
     /*Unicode: U+003f (?) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x08,  //....%.
-    0x10,  //...%..
-    0x10,  //...%..
-    0x00,  //......
-    0x10,  //...%..
-    0x00,  //......
-
+    0x07, 0x78, 0x84, 0x08, 0x10, 0x10, 0x00, 0x10, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x94,  //%..%.%
-    0xac,  //%.%.%%
-    0x98,  //%..%%.
-    0x80,  //%.....
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0x07, 0x78, 0x84, 0x94, 0xac, 0x98, 0x80, 0x78, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 6 */
-    0x30,  //..%%..
-    0x48,  //.%..%.
-    0x84,  //%....%
-    0xfc,  //%%%%%%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x00,  //......
-
+    0x03, 0x30, 0x48, 0x84, 0xfc, 0xfe, 0x84, 0x00, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 6 */
-    0xf8,  //%%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0xf8,  //%%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0xf8,  //%%%%%.
-    0x00,  //......
-
+    0x07, 0xf8, 0x84, 0x84, 0xf8, 0x84, 0x84, 0xf8, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x84,  //%....%
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0x01, 0x78, 0x84, 0xfe, 0x80, 0x02, 0x84, 0x78, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 6 */
-    0xf0,  //%%%%..
-    0x88,  //%...%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x88,  //%...%.
-    0xf0,  //%%%%..
-    0x00,  //......
-
+    0x01, 0xf0, 0x88, 0xfe, 0x84, 0x02, 0x88, 0xf0, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 6 */
-    0xfc,  //%%%%%%
-    0x80,  //%.....
-    0x80,  //%.....
-    0xf0,  //%%%%..
-    0x80,  //%.....
-    0x80,  //%.....
-    0xfc,  //%%%%%%
-    0x00,  //......
-
+    0x07, 0xfc, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xfc, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 6 */
-    0xfc,  //%%%%%%
-    0x80,  //%.....
-    0x80,  //%.....
-    0xf0,  //%%%%..
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x00,  //......
-
+    0x03, 0xfc, 0x80, 0x80, 0xf0, 0xfe, 0x80, 0x00, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x80,  //%.....
-    0x9c,  //%..%%%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0x07, 0x78, 0x84, 0x80, 0x9c, 0x84, 0x84, 0x78, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 6 */
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0xfc,  //%%%%%%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x00,  //......
-
+    0xfe, 0x84, 0x00, 0xfc, 0xfe, 0x84, 0x00, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 3 */
-    0xe0,  //%%%
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0xe0,  //%%%
-    0x00,  //...
-
+    0x00, 0xe0, 0xfc, 0x40, 0x01, 0xe0, 0x00,
 
     /*Unicode: U+004a (J) , Width: 5 */
-    0x08,  //....%
-    0x08,  //....%
-    0x08,  //....%
-    0x08,  //....%
-    0x08,  //....%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0xfc, 0x08, 0x02, 0x88, 0x70, 0x00,
 
     /*Unicode: U+004b (K) , Width: 6 */
-    0x84,  //%....%
-    0x88,  //%...%.
-    0x90,  //%..%..
-    0xe0,  //%%%...
-    0x90,  //%..%..
-    0x88,  //%...%.
-    0x84,  //%....%
-    0x00,  //......
-
+    0x07, 0x84, 0x88, 0x90, 0xe0, 0x90, 0x88, 0x84, 0x00,
 
     /*Unicode: U+004c (L) , Width: 6 */
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0xfc,  //%%%%%%
-    0x00,  //......
-
+    0xfb, 0x80, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+004d (M) , Width: 6 */
-    0x84,  //%....%
-    0xcc,  //%%..%%
-    0xb4,  //%.%%.%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x00,  //......
-
+    0x02, 0x84, 0xcc, 0xb4, 0xfd, 0x84, 0x00, 0x00,
 
     /*Unicode: U+004e (N) , Width: 6 */
-    0x84,  //%....%
-    0xc4,  //%%...%
-    0xa4,  //%.%..%
-    0x94,  //%..%.%
-    0x8c,  //%...%%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x00,  //......
-
+    0x07, 0x84, 0xc4, 0xa4, 0x94, 0x8c, 0x84, 0x84, 0x00,
 
     /*Unicode: U+004f (O) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0x00, 0x78, 0xfc, 0x84, 0x01, 0x78, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 6 */
-    0xf8,  //%%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0xf8,  //%%%%%.
-    0x80,  //%.....
-    0x80,  //%.....
-    0x80,  //%.....
-    0x00,  //......
-
+    0x03, 0xf8, 0x84, 0x84, 0xf8, 0xfe, 0x80, 0x00, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x94,  //%..%.%
-    0x88,  //%...%.
-    0x74,  //.%%%.%
-    0x00,  //......
-
+    0x00, 0x78, 0xfe, 0x84, 0x03, 0x94, 0x88, 0x74, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 6 */
-    0xf8,  //%%%%%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0xf8,  //%%%%%.
-    0x90,  //%..%..
-    0x88,  //%...%.
-    0x84,  //%....%
-    0x00,  //......
-
+    0x07, 0xf8, 0x84, 0x84, 0xf8, 0x90, 0x88, 0x84, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 6 */
-    0x78,  //.%%%%.
-    0x84,  //%....%
-    0x80,  //%.....
-    0x78,  //.%%%%.
-    0x04,  //.....%
-    0x84,  //%....%
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0x07, 0x78, 0x84, 0x80, 0x78, 0x04, 0x84, 0x78, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 5 */
-    0xf8,  //%%%%%
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x00,  //.....
-
+    0x00, 0xf8, 0xfb, 0x20, 0x00, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 6 */
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x78,  //.%%%%.
-    0x00,  //......
-
+    0xfb, 0x84, 0x01, 0x78, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 6 */
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x48,  //.%..%.
-    0x30,  //..%%..
-    0x00,  //......
-
+    0xfc, 0x84, 0x02, 0x48, 0x30, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 6 */
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0x84,  //%....%
-    0xb4,  //%.%%.%
-    0xcc,  //%%..%%
-    0x84,  //%....%
-    0x00,  //......
-
+    0xfd, 0x84, 0x03, 0xb4, 0xcc, 0x84, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 6 */
-    0x84,  //%....%
-    0x84,  //%....%
-    0x48,  //.%..%.
-    0x30,  //..%%..
-    0x48,  //.%..%.
-    0x84,  //%....%
-    0x84,  //%....%
-    0x00,  //......
-
+    0x07, 0x84, 0x84, 0x48, 0x30, 0x48, 0x84, 0x84, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 5 */
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x20,  //..%..
-    0x20,  //..%..
-    0x20,  //..%..
-    0x00,  //.....
-
+    0xfe, 0x88, 0x00, 0x70, 0xfe, 0x20, 0x00, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 5 */
-    0xf8,  //%%%%%
-    0x08,  //....%
-    0x10,  //...%.
-    0x20,  //..%..
-    0x40,  //.%...
-    0x80,  //%....
-    0xf8,  //%%%%%
-    0x00,  //.....
-
+    0x07, 0xf8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00,
 
     /*Unicode: U+005b ([) , Width: 3 */
-    0xe0,  //%%%
-    0x80,  //%..
-    0x80,  //%..
-    0x80,  //%..
-    0x80,  //%..
-    0x80,  //%..
-    0xe0,  //%%%
-    0x00,  //...
-
+    0x00, 0xe0, 0xfc, 0x80, 0x01, 0xe0, 0x00,
 
     /*Unicode: U+005c (\) , Width: 7 */
-    0x80,  //%......
-    0x40,  //.%.....
-    0x20,  //..%....
-    0x10,  //...%...
-    0x08,  //....%..
-    0x04,  //.....%.
-    0x02,  //......%
-    0x00,  //.......
-
+    0x07, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00,
 
     /*Unicode: U+005d (]) , Width: 3 */
-    0xe0,  //%%%
-    0x20,  //..%
-    0x20,  //..%
-    0x20,  //..%
-    0x20,  //..%
-    0x20,  //..%
-    0xe0,  //%%%
-    0x00,  //...
-
+    0x00, 0xe0, 0xfc, 0x20, 0x01, 0xe0, 0x00,
 
     /*Unicode: U+005e (^) , Width: 5 */
-    0x20,  //..%..
-    0x50,  //.%.%.
-    0x88,  //%...%
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-
+    0x02, 0x20, 0x50, 0x88, 0xfc, 0x00,
 
     /*Unicode: U+005f (_) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0xf8,  //%%%%%
-
+    0xfa, 0x00, 0x00, 0xf8,
 
     /*Unicode: U+0060 (`) , Width: 3 */
-    0x80,  //%..
-    0x40,  //.%.
-    0x20,  //..%
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0x02, 0x80, 0x40, 0x20, 0xfc, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x70,  //.%%%.
-    0x08,  //....%
-    0x78,  //.%%%%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 5 */
-    0x80,  //%....
-    0x80,  //%....
-    0xf0,  //%%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0xf0,  //%%%%.
-    0x00,  //.....
-
+    0x02, 0x80, 0x80, 0xf0, 0xfe, 0x88, 0x01, 0xf0, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x80,  //%....
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 5 */
-    0x08,  //....%
-    0x08,  //....%
-    0x78,  //.%%%%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x00,  //.....
-
+    0x02, 0x08, 0x08, 0x78, 0xfe, 0x88, 0x01, 0x78, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0xf8,  //%%%%%
-    0x80,  //%....
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 6 */
-    0x18,  //...%%.
-    0x24,  //..%..%
-    0x20,  //..%...
-    0xf8,  //%%%%%.
-    0x20,  //..%...
-    0x20,  //..%...
-    0x20,  //..%...
-    0x00,  //......
-
+    0x03, 0x18, 0x24, 0x20, 0xf8, 0xfe, 0x20, 0x00, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x78,  //.%%%%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x08,  //....%
-    0x70,  //.%%%.
-
+    0x07, 0x00, 0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x70,
 
     /*Unicode: U+0068 (h) , Width: 5 */
-    0x80,  //%....
-    0x80,  //%....
-    0xf0,  //%%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x00,  //.....
-
+    0x02, 0x80, 0x80, 0xf0, 0xfd, 0x88, 0x00, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 3 */
-    0x40,  //.%.
-    0x00,  //...
-    0xc0,  //%%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0xe0,  //%%%
-    0x00,  //...
-
+    0x02, 0x40, 0x00, 0xc0, 0xfe, 0x40, 0x01, 0xe0, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x10,  //...%
-    0x00,  //....
-    0x30,  //..%%
-    0x10,  //...%
-    0x10,  //...%
-    0x10,  //...%
-    0x90,  //%..%
-    0x60,  //.%%.
-
+    0x02, 0x10, 0x00, 0x30, 0xfe, 0x10, 0x01, 0x90, 0x60,
 
     /*Unicode: U+006b (k) , Width: 5 */
-    0x80,  //%....
-    0x80,  //%....
-    0x88,  //%...%
-    0x90,  //%..%.
-    0xe0,  //%%%..
-    0x90,  //%..%.
-    0x88,  //%...%
-    0x00,  //.....
-
+    0x07, 0x80, 0x80, 0x88, 0x90, 0xe0, 0x90, 0x88, 0x00,
 
     /*Unicode: U+006c (l) , Width: 3 */
-    0xc0,  //%%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0x40,  //.%.
-    0xe0,  //%%%
-    0x00,  //...
-
+    0x00, 0xc0, 0xfc, 0x40, 0x01, 0xe0, 0x00,
 
     /*Unicode: U+006d (m) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xd0,  //%%.%.
-    0xa8,  //%.%.%
-    0xa8,  //%.%.%
-    0xa8,  //%.%.%
-    0xa8,  //%.%.%
-    0x00,  //.....
-
+    0x02, 0x00, 0x00, 0xd0, 0xfd, 0xa8, 0x00, 0x00,
 
     /*Unicode: U+006e (n) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xf0,  //%%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x00,  //.....
-
+    0x02, 0x00, 0x00, 0xf0, 0xfd, 0x88, 0x00, 0x00,
 
     /*Unicode: U+006f (o) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x70,  //.%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x02, 0x00, 0x00, 0x70, 0xfe, 0x88, 0x01, 0x70, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xf0,  //%%%%.
-    0x88,  //%...%
-    0x88,  //%...%
-    0xf0,  //%%%%.
-    0x80,  //%....
-    0x80,  //%....
-
+    0x07, 0x00, 0x00, 0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80,
 
     /*Unicode: U+0071 (q) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x78,  //.%%%%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x08,  //....%
-    0x08,  //....%
-
+    0x07, 0x00, 0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x08,
 
     /*Unicode: U+0072 (r) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xb8,  //%.%%%
-    0xc0,  //%%...
-    0x80,  //%....
-    0x80,  //%....
-    0x80,  //%....
-    0x00,  //.....
-
+    0x03, 0x00, 0x00, 0xb8, 0xc0, 0xfe, 0x80, 0x00, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x78,  //.%%%%
-    0x80,  //%....
-    0x70,  //.%%%.
-    0x08,  //....%
-    0xf0,  //%%%%.
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0x78, 0x80, 0x70, 0x08, 0xf0, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 5 */
-    0x40,  //.%...
-    0x40,  //.%...
-    0xf0,  //%%%%.
-    0x40,  //.%...
-    0x40,  //.%...
-    0x48,  //.%..%
-    0x30,  //..%%.
-    0x00,  //.....
-
+    0x07, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x48, 0x30, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x70,  //.%%%.
-    0x00,  //.....
-
+    0x01, 0x00, 0x00, 0xfd, 0x88, 0x01, 0x70, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x50,  //.%.%.
-    0x20,  //..%..
-    0x00,  //.....
-
+    0x01, 0x00, 0x00, 0xfe, 0x88, 0x02, 0x50, 0x20, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x88,  //%...%
-    0xa8,  //%.%.%
-    0xa8,  //%.%.%
-    0xa8,  //%.%.%
-    0x50,  //.%.%.
-    0x00,  //.....
-
+    0x02, 0x00, 0x00, 0x88, 0xfe, 0xa8, 0x01, 0x50, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x88,  //%...%
-    0x50,  //.%.%.
-    0x20,  //..%..
-    0x50,  //.%.%.
-    0x88,  //%...%
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0x88,  //%...%
-    0x88,  //%...%
-    0x88,  //%...%
-    0x78,  //.%%%%
-    0x08,  //....%
-    0x70,  //.%%%.
-
+    0x01, 0x00, 0x00, 0xfe, 0x88, 0x02, 0x78, 0x08, 0x70,
 
     /*Unicode: U+007a (z) , Width: 5 */
-    0x00,  //.....
-    0x00,  //.....
-    0xf8,  //%%%%%
-    0x10,  //...%.
-    0x20,  //..%..
-    0x40,  //.%...
-    0xf8,  //%%%%%
-    0x00,  //.....
-
+    0x07, 0x00, 0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8, 0x00,
 
     /*Unicode: U+007b ({) , Width: 4 */
-    0x30,  //..%%
-    0x40,  //.%..
-    0x40,  //.%..
-    0x80,  //%...
-    0x40,  //.%..
-    0x40,  //.%..
-    0x30,  //..%%
-    0x00,  //....
-
+    0x07, 0x30, 0x40, 0x40, 0x80, 0x40, 0x40, 0x30, 0x00,
 
     /*Unicode: U+007c (|) , Width: 1 */
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-    0x80,  //%
-
+    0xf9, 0x80,
 
     /*Unicode: U+007d (}) , Width: 4 */
-    0xc0,  //%%..
-    0x20,  //..%.
-    0x20,  //..%.
-    0x10,  //...%
-    0x20,  //..%.
-    0x20,  //..%.
-    0xc0,  //%%..
-    0x00,  //....
-
+    0x07, 0xc0, 0x20, 0x20, 0x10, 0x20, 0x20, 0xc0, 0x00,
 
     /*Unicode: U+007e (~) , Width: 5 */
-    0x40,  //.%...
-    0xa8,  //%.%.%
-    0x10,  //...%.
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-    0x00,  //.....
-
-
+    0x02, 0x40, 0xa8, 0x10, 0xfc, 0x00,
 
 #elif USE_LV_FONT_MONOSPACE_8 == 2
     /*Unicode: U+0020 ( ) , Width: 3 */
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0xf9, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 1 */
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0x00,  //.
-    0x00,  //.
-    0xc0,  //@
-    0x00,  //.
-
+    0xfd, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+0022 (") , Width: 4 */
-    0xc3,  //@..@
-    0xc3,  //@..@
-    0xc3,  //@..@
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-    0x00,  //....
-
+    0xfe, 0xc3, 0xfc, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 6 */
-    0x30, 0xc0,  //.@..@.
-    0x30, 0xc0,  //.@..@.
-    0xff, 0xf0,  //@@@@@@
-    0x30, 0xc0,  //.@..@.
-    0xff, 0xf0,  //@@@@@@
-    0x30, 0xc0,  //.@..@.
-    0x30, 0xc0,  //.@..@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x30, 0xc0, 0x30, 0xc0, 0xff, 0xf0, 0x30, 0xc0, 0xff, 0xf0, 0x30, 0xc0, 0x30, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0024 ($) , Width: 5 */
-    0x0c, 0x00,  //..@..
-    0x3f, 0xc0,  //.@@@@
-    0xcc, 0x00,  //@.@..
-    0x3f, 0x00,  //.@@@.
-    0x0c, 0xc0,  //..@.@
-    0xff, 0x00,  //@@@@.
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-
+    0x0c, 0x0c, 0x00, 0x3f, 0xc0, 0xcc, 0x00, 0x3f, 0x00, 0x0c, 0xc0, 0xff, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 6 */
-    0x00, 0x00,  //......
-    0xf0, 0x30,  //@@...@
-    0xf0, 0xc0,  //@@..@.
-    0x03, 0x00,  //...@..
-    0x0c, 0x00,  //..@...
-    0x30, 0xf0,  //.@..@@
-    0xc0, 0xf0,  //@...@@
-    0x00, 0x00,  //......
-
+    0x0f, 0x00, 0x00, 0xf0, 0x30, 0xf0, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0xf0, 0xc0, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+0026 (&) , Width: 6 */
-    0x3c, 0x00,  //.@@...
-    0xc3, 0x00,  //@..@..
-    0xc3, 0x00,  //@..@..
-    0x3c, 0x00,  //.@@...
-    0xc3, 0x30,  //@..@.@
-    0xc0, 0xc0,  //@...@.
-    0x3f, 0x30,  //.@@@.@
-    0x00, 0x00,  //......
-
+    0x0f, 0x3c, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0x3c, 0x00, 0xc3, 0x30, 0xc0, 0xc0, 0x3f, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0027 (') , Width: 3 */
-    0x0c,  //..@
-    0x30,  //.@.
-    0xc0,  //@..
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0x02, 0x0c, 0x30, 0xc0, 0xfc, 0x00,
 
     /*Unicode: U+0028 (() , Width: 3 */
-    0x0c,  //..@
-    0x30,  //.@.
-    0xc0,  //@..
-    0xc0,  //@..
-    0xc0,  //@..
-    0x30,  //.@.
-    0x0c,  //..@
-    0x00,  //...
-
+    0x01, 0x0c, 0x30, 0xfe, 0xc0, 0x02, 0x30, 0x0c, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 3 */
-    0xc0,  //@..
-    0x30,  //.@.
-    0x0c,  //..@
-    0x0c,  //..@
-    0x0c,  //..@
-    0x30,  //.@.
-    0xc0,  //@..
-    0x00,  //...
-
+    0x01, 0xc0, 0x30, 0xfe, 0x0c, 0x02, 0x30, 0xc0, 0x00,
 
     /*Unicode: U+002a (*) , Width: 5 */
-    0x0c, 0x00,  //..@..
-    0xcc, 0xc0,  //@.@.@
-    0x3f, 0x00,  //.@@@.
-    0x0c, 0x00,  //..@..
-    0x3f, 0x00,  //.@@@.
-    0xcc, 0xc0,  //@.@.@
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-
+    0x0c, 0x0c, 0x00, 0xcc, 0xc0, 0x3f, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0xcc, 0xc0, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+002b (+) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0xff, 0xc0,  //@@@@@
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
+    0x0a, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0xfc, 0x00,
 
     /*Unicode: U+002c (,) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x30,  //.@
-    0x30,  //.@
-    0xc0,  //@.
-
+    0xfc, 0x00, 0x02, 0x30, 0x30, 0xc0,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
+    0xf9, 0x00, 0x01, 0xff, 0xc0, 0xfb, 0x00,
 
     /*Unicode: U+002e (.) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0xc0,  //@
-    0x00,  //.
-
+    0xfb, 0x00, 0x01, 0xc0, 0x00,
 
     /*Unicode: U+002f (/) , Width: 7 */
-    0x00, 0x0c,  //......@
-    0x00, 0x30,  //.....@.
-    0x00, 0xc0,  //....@..
-    0x03, 0x00,  //...@...
-    0x0c, 0x00,  //..@....
-    0x30, 0x00,  //.@.....
-    0xc0, 0x00,  //@......
-    0x00, 0x00,  //.......
-
+    0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0xfe, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 5 */
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc3, 0xc0,  //@..@@
-    0xcc, 0xc0,  //@.@.@
-    0xf0, 0xc0,  //@@..@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x08, 0x3f, 0x00, 0xc0, 0xc0, 0xc3, 0xc0, 0xcc, 0xc0, 0xf0, 0xfe, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 5 */
-    0x0c, 0x00,  //..@..
-    0x3c, 0x00,  //.@@..
-    0xcc, 0x00,  //@.@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-
+    0x0f, 0x0c, 0x00, 0x3c, 0x00, 0xcc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0032 (2) , Width: 5 */
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0x00, 0xc0,  //....@
-    0x03, 0x00,  //...@.
-    0x3c, 0x00,  //.@@..
-    0xc0, 0x00,  //@....
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-
+    0x0f, 0x3f, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0x03, 0x00, 0x3c, 0x00, 0xc0, 0x00, 0xff, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0033 (3) , Width: 5 */
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0x00, 0xc0,  //....@
-    0x0f, 0x00,  //..@@.
-    0x00, 0xc0,  //....@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x08, 0x3f, 0x00, 0xc0, 0xc0, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xfe, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 5 */
-    0x03, 0x00,  //...@.
-    0x0f, 0x00,  //..@@.
-    0x33, 0x00,  //.@.@.
-    0xc3, 0x00,  //@..@.
-    0xff, 0xc0,  //@@@@@
-    0x03, 0x00,  //...@.
-    0x03, 0x00,  //...@.
-    0x00, 0x00,  //.....
-
+    0x0c, 0x03, 0x00, 0x0f, 0x00, 0x33, 0x00, 0xc3, 0x00, 0xff, 0xc0, 0x03, 0x00, 0x03, 0xfe, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 5 */
-    0xff, 0xc0,  //@@@@@
-    0xc0, 0x00,  //@....
-    0xff, 0x00,  //@@@@.
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x08, 0xff, 0xc0, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 5 */
-    0x0f, 0xc0,  //..@@@
-    0x30, 0x00,  //.@...
-    0xc0, 0x00,  //@....
-    0xff, 0x00,  //@@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x07, 0x0f, 0xc0, 0x30, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xfd, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 5 */
-    0xff, 0xc0,  //@@@@@
-    0x00, 0xc0,  //....@
-    0x03, 0x00,  //...@.
-    0x0c, 0x00,  //..@..
-    0x30, 0x00,  //.@...
-    0x30, 0x00,  //.@...
-    0x30, 0x00,  //.@...
-    0x00, 0x00,  //.....
-
+    0x0c, 0xff, 0xc0, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xfe, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 5 */
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x01, 0x3f, 0x00, 0xfd, 0xc0, 0x01, 0x3f, 0x00, 0xfd, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 5 */
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0xc0,  //....@
-    0x03, 0x00,  //...@.
-    0xfc, 0x00,  //@@@..
-    0x00, 0x00,  //.....
-
+    0x01, 0x3f, 0x00, 0xfd, 0xc0, 0x06, 0x3f, 0xc0, 0x00, 0xc0, 0x03, 0x00, 0xfc, 0xfe, 0x00,
 
     /*Unicode: U+003a (:) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0xc0,  //@
-    0x00,  //.
-    0x00,  //.
-    0xc0,  //@
-    0x00,  //.
-    0x00,  //.
-
+    0x07, 0x00, 0x00, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+003b (;) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x30,  //.@
-    0x00,  //..
-    0x00,  //..
-    0x30,  //.@
-    0x30,  //.@
-    0xc0,  //@.
-
+    0x07, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 0xc0,
 
     /*Unicode: U+003c (<) , Width: 4 */
-    0x03,  //...@
-    0x0c,  //..@.
-    0x30,  //.@..
-    0xc0,  //@...
-    0x30,  //.@..
-    0x0c,  //..@.
-    0x03,  //...@
-    0x00,  //....
-
+    0x07, 0x03, 0x0c, 0x30, 0xc0, 0x30, 0x0c, 0x03, 0x00,
 
     /*Unicode: U+003d (=) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x05, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xc0, 0xfb, 0x00,
 
     /*Unicode: U+003e (>) , Width: 4 */
-    0xc0,  //@...
-    0x30,  //.@..
-    0x0c,  //..@.
-    0x03,  //...@
-    0x0c,  //..@.
-    0x30,  //.@..
-    0xc0,  //@...
-    0x00,  //....
-
+    0x07, 0xc0, 0x30, 0x0c, 0x03, 0x0c, 0x30, 0xc0, 0x00,
 
     /*Unicode: U+003f (?) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0x00, 0xc0,  //....@.
-    0x03, 0x00,  //...@..
-    0x03, 0x00,  //...@..
-    0x00, 0x00,  //......
-    0x03, 0x00,  //...@..
-    0x00, 0x00,  //......
-
+    0x08, 0x3f, 0xc0, 0xc0, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc3, 0x30,  //@..@.@
-    0xcc, 0xf0,  //@.@.@@
-    0xc3, 0xc0,  //@..@@.
-    0xc0, 0x00,  //@.....
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc3, 0x30, 0xcc, 0xf0, 0xc3, 0xc0, 0xc0, 0x00, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0041 (A) , Width: 6 */
-    0x0f, 0x00,  //..@@..
-    0x30, 0xc0,  //.@..@.
-    0xc0, 0x30,  //@....@
-    0xff, 0xf0,  //@@@@@@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0x0f, 0x00, 0x30, 0xc0, 0xc0, 0x30, 0xff, 0xf0, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0042 (B) , Width: 6 */
-    0xff, 0xc0,  //@@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xff, 0xc0,  //@@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xff, 0xc0,  //@@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0xff, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xff, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xff, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0043 (C) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x30,  //@....@
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x30, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0044 (D) , Width: 6 */
-    0xff, 0x00,  //@@@@..
-    0xc0, 0xc0,  //@...@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0xc0,  //@...@.
-    0xff, 0x00,  //@@@@..
-    0x00, 0x00,  //......
-
+    0x01, 0xff, 0x00, 0xfe, 0xc0, 0x07, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0xc0, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 6 */
-    0xff, 0xf0,  //@@@@@@
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xff, 0x00,  //@@@@..
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xff, 0xf0,  //@@@@@@
-    0x00, 0x00,  //......
-
+    0x0f, 0xff, 0xf0, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+0046 (F) , Width: 6 */
-    0xff, 0xf0,  //@@@@@@
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xff, 0x00,  //@@@@..
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0x00, 0x00,  //......
-
+    0x0c, 0xff, 0xf0, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xfe, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x00,  //@.....
-    0xc3, 0xf0,  //@..@@@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc0, 0x00, 0xc3, 0xf0, 0xc0, 0x30, 0xc0, 0x30, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0048 (H) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xff, 0xf0,  //@@@@@@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xff, 0xf0, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0049 (I) , Width: 3 */
-    0xfc,  //@@@
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0xfc,  //@@@
-    0x00,  //...
-
+    0x00, 0xfc, 0xfc, 0x30, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+004a (J) , Width: 5 */
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0x08, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfe, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+004b (K) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0xc0,  //@...@.
-    0xc3, 0x00,  //@..@..
-    0xfc, 0x00,  //@@@...
-    0xc3, 0x00,  //@..@..
-    0xc0, 0xc0,  //@...@.
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x09, 0xc0, 0x30, 0xc0, 0xc0, 0xc3, 0x00, 0xfc, 0x00, 0xc3, 0x00, 0xfe, 0xc0, 0x02, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+004c (L) , Width: 6 */
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xff, 0xf0,  //@@@@@@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+004d (M) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xf0, 0xf0,  //@@..@@
-    0xcf, 0x30,  //@.@@.@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xf0, 0xf0, 0xcf, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+004e (N) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xf0, 0x30,  //@@...@
-    0xcc, 0x30,  //@.@..@
-    0xc3, 0x30,  //@..@.@
-    0xc0, 0xf0,  //@...@@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xf0, 0x30, 0xcc, 0x30, 0xc3, 0x30, 0xc0, 0xf0, 0xc0, 0x30, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+004f (O) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0050 (P) , Width: 6 */
-    0xff, 0xc0,  //@@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xff, 0xc0,  //@@@@@.
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0xc0, 0x00,  //@.....
-    0x00, 0x00,  //......
-
+    0x0c, 0xff, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xff, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xfe, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc3, 0x30,  //@..@.@
-    0xc0, 0xc0,  //@...@.
-    0x3f, 0x30,  //.@@@.@
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc3, 0x30, 0xc0, 0xc0, 0x3f, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0052 (R) , Width: 6 */
-    0xff, 0xc0,  //@@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xff, 0xc0,  //@@@@@.
-    0xc3, 0x00,  //@..@..
-    0xc0, 0xc0,  //@...@.
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x09, 0xff, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0xff, 0xc0, 0xc3, 0x00, 0xfe, 0xc0, 0x02, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0053 (S) , Width: 6 */
-    0x3f, 0xc0,  //.@@@@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x00,  //@.....
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x30,  //.....@
-    0xc0, 0x30,  //@....@
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0x3f, 0xc0, 0xc0, 0x30, 0xc0, 0x00, 0x3f, 0xc0, 0x00, 0x30, 0xc0, 0x30, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0054 (T) , Width: 5 */
-    0xff, 0xc0,  //@@@@@
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-
+    0x0c, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x3f, 0xc0,  //.@@@@.
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x3f, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+0056 (V) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x30, 0xc0,  //.@..@.
-    0x0f, 0x00,  //..@@..
-    0x00, 0x00,  //......
-
+    0x0c, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0x30, 0xc0, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0xcf, 0x30,  //@.@@.@
-    0xf0, 0xf0,  //@@..@@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xcf, 0x30, 0xf0, 0xf0, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0058 (X) , Width: 6 */
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x30, 0xc0,  //.@..@.
-    0x0f, 0x00,  //..@@..
-    0x30, 0xc0,  //.@..@.
-    0xc0, 0x30,  //@....@
-    0xc0, 0x30,  //@....@
-    0x00, 0x00,  //......
-
+    0x0f, 0xc0, 0x30, 0xc0, 0x30, 0x30, 0xc0, 0x0f, 0x00, 0x30, 0xc0, 0xc0, 0x30, 0xc0, 0x30, 0x00,
+    0x00,
 
     /*Unicode: U+0059 (Y) , Width: 5 */
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-
+    0xfb, 0xc0, 0x06, 0x3f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 5 */
-    0xff, 0xc0,  //@@@@@
-    0x00, 0xc0,  //....@
-    0x03, 0x00,  //...@.
-    0x0c, 0x00,  //..@..
-    0x30, 0x00,  //.@...
-    0xc0, 0x00,  //@....
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-
+    0x0f, 0xff, 0xc0, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xff, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+005b ([) , Width: 3 */
-    0xfc,  //@@@
-    0xc0,  //@..
-    0xc0,  //@..
-    0xc0,  //@..
-    0xc0,  //@..
-    0xc0,  //@..
-    0xfc,  //@@@
-    0x00,  //...
-
+    0x00, 0xfc, 0xfc, 0xc0, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+005c (\) , Width: 7 */
-    0xc0, 0x00,  //@......
-    0x30, 0x00,  //.@.....
-    0x0c, 0x00,  //..@....
-    0x03, 0x00,  //...@...
-    0x00, 0xc0,  //....@..
-    0x00, 0x30,  //.....@.
-    0x00, 0x0c,  //......@
-    0x00, 0x00,  //.......
-
+    0x0f, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00,
+    0x00,
 
     /*Unicode: U+005d (]) , Width: 3 */
-    0xfc,  //@@@
-    0x0c,  //..@
-    0x0c,  //..@
-    0x0c,  //..@
-    0x0c,  //..@
-    0x0c,  //..@
-    0xfc,  //@@@
-    0x00,  //...
-
+    0x00, 0xfc, 0xfc, 0x0c, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+005e (^) , Width: 5 */
-    0x0c, 0x00,  //..@..
-    0x33, 0x00,  //.@.@.
-    0xc0, 0xc0,  //@...@
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
+    0x05, 0x0c, 0x00, 0x33, 0x00, 0xc0, 0xc0, 0xf7, 0x00,
 
     /*Unicode: U+005f (_) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-
+    0xf3, 0x00, 0x01, 0xff, 0xc0,
 
     /*Unicode: U+0060 (`) , Width: 3 */
-    0xc0,  //@..
-    0x30,  //.@.
-    0x0c,  //..@
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-    0x00,  //...
-
+    0x02, 0xc0, 0x30, 0x0c, 0xfc, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0x00,  //.@@@.
-    0x00, 0xc0,  //....@
-    0x3f, 0xc0,  //.@@@@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x04, 0x3f, 0x00, 0x00, 0xc0, 0x3f, 0xfe, 0xc0, 0x03, 0x3f, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 5 */
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-    0xff, 0x00,  //@@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xff, 0x00,  //@@@@.
-    0x00, 0x00,  //.....
-
+    0x05, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xfb, 0xc0, 0x00, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0x00,  //@....
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x01, 0x3f, 0x00, 0xfe, 0xc0, 0x03, 0x00, 0xc0, 0xc0, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 5 */
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-    0x3f, 0xc0,  //.@@@@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0x00,  //.....
-
+    0x04, 0x00, 0xc0, 0x00, 0xc0, 0x3f, 0xfa, 0xc0, 0x03, 0x3f, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xff, 0xc0,  //@@@@@
-    0xc0, 0x00,  //@....
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x08, 0x3f, 0x00, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 6 */
-    0x03, 0xc0,  //...@@.
-    0x0c, 0x30,  //..@..@
-    0x0c, 0x00,  //..@...
-    0xff, 0xc0,  //@@@@@.
-    0x0c, 0x00,  //..@...
-    0x0c, 0x00,  //..@...
-    0x0c, 0x00,  //..@...
-    0x00, 0x00,  //......
-
+    0x0c, 0x03, 0xc0, 0x0c, 0x30, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0xc0,  //.@@@@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0xc0,  //....@
-    0x3f, 0x00,  //.@@@.
-
+    0xfd, 0x00, 0x00, 0x3f, 0xfc, 0xc0, 0x05, 0x3f, 0xc0, 0x00, 0xc0, 0x3f, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 5 */
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-    0xff, 0x00,  //@@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x00, 0x00,  //.....
-
+    0x05, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xf9, 0xc0, 0x01, 0x00, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 3 */
-    0x30,  //.@.
-    0x00,  //...
-    0xf0,  //@@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0xfc,  //@@@
-    0x00,  //...
-
+    0x02, 0x30, 0x00, 0xf0, 0xfe, 0x30, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x03,  //...@
-    0x00,  //....
-    0x0f,  //..@@
-    0x03,  //...@
-    0x03,  //...@
-    0x03,  //...@
-    0xc3,  //@..@
-    0x3c,  //.@@.
-
+    0x02, 0x03, 0x00, 0x0f, 0xfe, 0x03, 0x01, 0xc3, 0x3c,
 
     /*Unicode: U+006b (k) , Width: 5 */
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-    0xc0, 0xc0,  //@...@
-    0xc3, 0x00,  //@..@.
-    0xfc, 0x00,  //@@@..
-    0xc3, 0x00,  //@..@.
-    0xc0, 0xc0,  //@...@
-    0x00, 0x00,  //.....
-
+    0x0f, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xc0, 0xc3, 0x00, 0xfc, 0x00, 0xc3, 0x00, 0xc0, 0xc0, 0x00,
+    0x00,
 
     /*Unicode: U+006c (l) , Width: 3 */
-    0xf0,  //@@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0x30,  //.@.
-    0xfc,  //@@@
-    0x00,  //...
-
+    0x00, 0xf0, 0xfc, 0x30, 0x01, 0xfc, 0x00,
 
     /*Unicode: U+006d (m) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xf3, 0x00,  //@@.@.
-    0xcc, 0xc0,  //@.@.@
-    0xcc, 0xc0,  //@.@.@
-    0xcc, 0xc0,  //@.@.@
-    0xcc, 0xc0,  //@.@.@
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x0b, 0xf3, 0x00, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+006e (n) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0x00,  //@@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x01, 0xff, 0x00, 0xf9, 0xc0, 0x01, 0x00, 0x00,
 
     /*Unicode: U+006f (o) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0x00,  //.@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x01, 0x3f, 0x00, 0xfb, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0x00,  //@@@@.
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xff, 0x00,  //@@@@.
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-
+    0xfd, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xc0, 0x05, 0xff, 0x00, 0xc0, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0xc0,  //.@@@@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0xc0,  //....@
-    0x00, 0xc0,  //....@
-
+    0xfd, 0x00, 0x00, 0x3f, 0xfc, 0xc0, 0x05, 0x3f, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
 
     /*Unicode: U+0072 (r) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xcf, 0xc0,  //@.@@@
-    0xf0, 0x00,  //@@...
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-    0xc0, 0x00,  //@....
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x08, 0xcf, 0xc0, 0xf0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xfe, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x3f, 0xc0,  //.@@@@
-    0xc0, 0x00,  //@....
-    0x3f, 0x00,  //.@@@.
-    0x00, 0xc0,  //....@
-    0xff, 0x00,  //@@@@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x08, 0x3f, 0xc0, 0xc0, 0x00, 0x3f, 0x00, 0x00, 0xc0, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 5 */
-    0x30, 0x00,  //.@...
-    0x30, 0x00,  //.@...
-    0xff, 0x00,  //@@@@.
-    0x30, 0x00,  //.@...
-    0x30, 0x00,  //.@...
-    0x30, 0xc0,  //.@..@
-    0x0f, 0x00,  //..@@.
-    0x00, 0x00,  //.....
-
+    0x0c, 0x30, 0x00, 0x30, 0x00, 0xff, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xc0, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0x00,  //.@@@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0xf9, 0xc0, 0x00, 0x3f, 0xfe, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x33, 0x00,  //.@.@.
-    0x0c, 0x00,  //..@..
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0xfb, 0xc0, 0x02, 0x33, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xc0, 0xc0,  //@...@
-    0xcc, 0xc0,  //@.@.@
-    0xcc, 0xc0,  //@.@.@
-    0xcc, 0xc0,  //@.@.@
-    0x33, 0x00,  //.@.@.
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x08, 0xc0, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0x33, 0xfe, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xc0, 0xc0,  //@...@
-    0x33, 0x00,  //.@.@.
-    0x0c, 0x00,  //..@..
-    0x33, 0x00,  //.@.@.
-    0xc0, 0xc0,  //@...@
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x0b, 0xc0, 0xc0, 0x33, 0x00, 0x0c, 0x00, 0x33, 0x00, 0xc0, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0xc0, 0xc0,  //@...@
-    0x3f, 0xc0,  //.@@@@
-    0x00, 0xc0,  //....@
-    0x3f, 0x00,  //.@@@.
-
+    0xfd, 0x00, 0xfb, 0xc0, 0x05, 0x3f, 0xc0, 0x00, 0xc0, 0x3f, 0x00,
 
     /*Unicode: U+007a (z) , Width: 5 */
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0xff, 0xc0,  //@@@@@
-    0x03, 0x00,  //...@.
-    0x0c, 0x00,  //..@..
-    0x30, 0x00,  //.@...
-    0xff, 0xc0,  //@@@@@
-    0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x0b, 0xff, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xff, 0xc0, 0x00, 0x00,
 
     /*Unicode: U+007b ({) , Width: 4 */
-    0x0f,  //..@@
-    0x30,  //.@..
-    0x30,  //.@..
-    0xc0,  //@...
-    0x30,  //.@..
-    0x30,  //.@..
-    0x0f,  //..@@
-    0x00,  //....
-
+    0x07, 0x0f, 0x30, 0x30, 0xc0, 0x30, 0x30, 0x0f, 0x00,
 
     /*Unicode: U+007c (|) , Width: 1 */
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-    0xc0,  //@
-
+    0xf9, 0xc0,
 
     /*Unicode: U+007d (}) , Width: 4 */
-    0xf0,  //@@..
-    0x0c,  //..@.
-    0x0c,  //..@.
-    0x03,  //...@
-    0x0c,  //..@.
-    0x0c,  //..@.
-    0xf0,  //@@..
-    0x00,  //....
-
+    0x07, 0xf0, 0x0c, 0x0c, 0x03, 0x0c, 0x0c, 0xf0, 0x00,
 
     /*Unicode: U+007e (~) , Width: 5 */
-    0x30, 0x00,  //.@...
-    0xcc, 0xc0,  //@.@.@
-    0x03, 0x00,  //...@.
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-    0x00, 0x00,  //.....
-
-
+    0x04, 0x30, 0x00, 0xcc, 0xc0, 0x03, 0xf6, 0x00,
 
 #elif USE_LV_FONT_MONOSPACE_8 == 4
     /*Unicode: U+0020 ( ) , Width: 3 */
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-
+    0xf1, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 1 */
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0x00,  //.
-    0x00,  //.
-    0xf0,  //@
-    0x00,  //.
-
+    0xfd, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x00,
 
     /*Unicode: U+0022 (") , Width: 4 */
-    0xf0, 0x0f,  //@..@
-    0xf0, 0x0f,  //@..@
-    0xf0, 0x0f,  //@..@
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-    0x00, 0x00,  //....
-
+    0x05, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf7, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 6 */
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0xff, 0xff, 0xff,  //@@@@@@
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0xff, 0xff, 0xff,  //@@@@@@
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0x00, 0x00, 0x00,  //......
-
+    0x05, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0xfe, 0xff, 0x02, 0x0f, 0x00, 0xf0, 0xfe, 0xff, 0x05,
+    0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 5 */
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0xf0, 0x00,  //@.@..
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0xf0, 0xf0,  //..@.@
-    0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-
+    0x04, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xfe, 0xf0, 0x0b, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xf0, 0xf0,
+    0xff, 0xff, 0x00, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 6 */
-    0x00, 0x00, 0x00,  //......
-    0xff, 0x00, 0x0f,  //@@...@
-    0xff, 0x00, 0xf0,  //@@..@.
-    0x00, 0x0f, 0x00,  //...@..
-    0x00, 0xf0, 0x00,  //..@...
-    0x0f, 0x00, 0xff,  //.@..@@
-    0xf0, 0x00, 0xff,  //@...@@
-    0x00, 0x00, 0x00,  //......
-
+    0xfe, 0x00, 0x11, 0xff, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f,
+    0x00, 0xff, 0xf0, 0x00, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 6 */
-    0x0f, 0xf0, 0x00,  //.@@...
-    0xf0, 0x0f, 0x00,  //@..@..
-    0xf0, 0x0f, 0x00,  //@..@..
-    0x0f, 0xf0, 0x00,  //.@@...
-    0xf0, 0x0f, 0x0f,  //@..@.@
-    0xf0, 0x00, 0xf0,  //@...@.
-    0x0f, 0xff, 0x0f,  //.@@@.@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x0f, 0x0f,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0027 (') , Width: 3 */
-    0x00, 0xf0,  //..@
-    0x0f, 0x00,  //.@.
-    0xf0, 0x00,  //@..
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-
+    0x04, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0xf6, 0x00,
 
     /*Unicode: U+0028 (() , Width: 3 */
-    0x00, 0xf0,  //..@
-    0x0f, 0x00,  //.@.
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0x0f, 0x00,  //.@.
-    0x00, 0xf0,  //..@
-    0x00, 0x00,  //...
-
+    0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+0029 ()) , Width: 3 */
-    0xf0, 0x00,  //@..
-    0x0f, 0x00,  //.@.
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0x0f, 0x00,  //.@.
-    0xf0, 0x00,  //@..
-    0x00, 0x00,  //...
-
+    0x0c, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+002a (*) , Width: 5 */
-    0x00, 0xf0, 0x00,  //..@..
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-
+    0x02, 0x00, 0xf0, 0x00, 0xfe, 0xf0, 0x08, 0x0f, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0x00,
+    0xfe, 0xf0, 0x01, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+002b (+) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x0c, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0xfa, 0x00,
 
     /*Unicode: U+002c (,) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x00,  //..
-    0x0f,  //.@
-    0x0f,  //.@
-    0xf0,  //@.
-
+    0xfc, 0x00, 0x02, 0x0f, 0x0f, 0xf0,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
+    0xf5, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xf8, 0x00,
 
     /*Unicode: U+002e (.) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0xf0,  //@
-    0x00,  //.
-
+    0xfb, 0x00, 0x01, 0xf0, 0x00,
 
     /*Unicode: U+002f (/) , Width: 7 */
-    0x00, 0x00, 0x00, 0xf0,  //......@
-    0x00, 0x00, 0x0f, 0x00,  //.....@.
-    0x00, 0x00, 0xf0, 0x00,  //....@..
-    0x00, 0x0f, 0x00, 0x00,  //...@...
-    0x00, 0xf0, 0x00, 0x00,  //..@....
-    0x0f, 0x00, 0x00, 0x00,  //.@.....
-    0xf0, 0x00, 0x00, 0x00,  //@......
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xfe, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0x00,
+    0x03, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0xf0, 0xfa, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 5 */
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x0f, 0xf0,  //@..@@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xff, 0x00, 0xf0,  //@@..@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x07, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x0f, 0xfd, 0xf0, 0x07, 0xff, 0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 5 */
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0xf0, 0x00,  //.@@..
-    0xf0, 0xf0, 0x00,  //@.@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0x00, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 5 */
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x0f, 0x00,  //...@.
-    0x0f, 0xf0, 0x00,  //.@@..
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00,
+    0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 5 */
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0xff, 0x00,  //..@@.
-    0x00, 0x00, 0xf0,  //....@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x0a, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xfe, 0x00, 0x05, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0034 (4) , Width: 5 */
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0xff, 0x00,  //..@@.
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0xf0, 0x0f, 0x00,  //@..@.
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x00, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0xff, 0xf0,
+    0x00, 0x0f, 0x00, 0x00, 0x0f, 0xfd, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 5 */
-    0xff, 0xff, 0xf0,  //@@@@@
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x07, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x08, 0xf0, 0x00, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 5 */
-    0x00, 0xff, 0xf0,  //..@@@
-    0x0f, 0x00, 0x00,  //.@...
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0037 (7) , Width: 5 */
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0x00, 0x00,  //.@...
-    0x0f, 0x00, 0x00,  //.@...
-    0x0f, 0x00, 0x00,  //.@...
-    0x00, 0x00, 0x00,  //.....
-
+    0x12, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x0f, 0xfc, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 5 */
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 5 */
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x0f, 0x00,  //...@.
-    0xff, 0xf0, 0x00,  //@@@..
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0xf0,
+    0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+003a (:) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0xf0,  //@
-    0x00,  //.
-    0x00,  //.
-    0xf0,  //@
-    0x00,  //.
-    0x00,  //.
-
+    0x07, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
 
     /*Unicode: U+003b (;) , Width: 2 */
-    0x00,  //..
-    0x00,  //..
-    0x0f,  //.@
-    0x00,  //..
-    0x00,  //..
-    0x0f,  //.@
-    0x0f,  //.@
-    0xf0,  //@.
-
+    0x07, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0xf0,
 
     /*Unicode: U+003c (<) , Width: 4 */
-    0x00, 0x0f,  //...@
-    0x00, 0xf0,  //..@.
-    0x0f, 0x00,  //.@..
-    0xf0, 0x00,  //@...
-    0x0f, 0x00,  //.@..
-    0x00, 0xf0,  //..@.
-    0x00, 0x0f,  //...@
-    0x00, 0x00,  //....
-
+    0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+    0x00,
 
     /*Unicode: U+003d (=) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xf8, 0x00,
 
     /*Unicode: U+003e (>) , Width: 4 */
-    0xf0, 0x00,  //@...
-    0x0f, 0x00,  //.@..
-    0x00, 0xf0,  //..@.
-    0x00, 0x0f,  //...@
-    0x00, 0xf0,  //..@.
-    0x0f, 0x00,  //.@..
-    0xf0, 0x00,  //@...
-    0x00, 0x00,  //....
-
+    0x0c, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+003f (?) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0xf0,  //....@.
-    0x00, 0x0f, 0x00,  //...@..
-    0x00, 0x0f, 0x00,  //...@..
-    0x00, 0x00, 0x00,  //......
-    0x00, 0x0f, 0x00,  //...@..
-    0x00, 0x00, 0x00,  //......
-
+    0x0d, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0xfc,
+    0x00, 0x00, 0x0f, 0xfd, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x0f, 0x0f,  //@..@.@
-    0xf0, 0xf0, 0xff,  //@.@.@@
-    0xf0, 0x0f, 0xf0,  //@..@@.
-    0xf0, 0x00, 0x00,  //@.....
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xf0, 0x0f, 0xf0,
+    0xf0, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 6 */
-    0x00, 0xff, 0x00,  //..@@..
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xff,  //@@@@@@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x08, 0x00, 0xff, 0x00, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0x0f, 0xfe, 0xff, 0x08, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 6 */
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0044 (D) , Width: 6 */
-    0xff, 0xff, 0x00,  //@@@@..
-    0xf0, 0x00, 0xf0,  //@...@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0xf0,  //@...@.
-    0xff, 0xff, 0x00,  //@@@@..
-    0x00, 0x00, 0x00,  //......
-
+    0x13, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0xf0, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 6 */
-    0xff, 0xff, 0xff,  //@@@@@@
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0x00,  //@@@@..
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0x00, 0x00,  //......
-
+    0xfe, 0xff, 0x0e, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 6 */
-    0xff, 0xff, 0xff,  //@@@@@@
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0x00,  //@@@@..
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0x00, 0x00, 0x00,  //......
-
+    0xfe, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0x00, 0x00, 0xf0, 0xfc, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x0f, 0xff,  //@..@@@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xff,  //@@@@@@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x08, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0xff, 0x08, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 3 */
-    0xff, 0xf0,  //@@@
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0xff, 0xf0,  //@@@
-    0x00, 0x00,  //...
-
+    0x0f, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+004a (J) , Width: 5 */
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+004b (K) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0xf0,  //@...@.
-    0xf0, 0x0f, 0x00,  //@..@..
-    0xff, 0xf0, 0x00,  //@@@...
-    0xf0, 0x0f, 0x00,  //@..@..
-    0xf0, 0x00, 0xf0,  //@...@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0x00,
+    0xf0, 0x00, 0xf0, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+004c (L) , Width: 6 */
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0x00, 0x00,  //......
-
+    0x11, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+004d (M) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0x00, 0xff,  //@@..@@
-    0xf0, 0xff, 0x0f,  //@.@@.@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+004e (N) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0x00, 0x0f,  //@@...@
-    0xf0, 0xf0, 0x0f,  //@.@..@
-    0xf0, 0x0f, 0x0f,  //@..@.@
-    0xf0, 0x00, 0xff,  //@...@@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x00, 0xff,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+004f (O) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 6 */
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0xf0, 0x00, 0x00,  //@.....
-    0x00, 0x00, 0x00,  //......
-
+    0x12, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00,
+    0xf0, 0x00, 0x00, 0xf0, 0xfc, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x0f, 0x0f,  //@..@.@
-    0xf0, 0x00, 0xf0,  //@...@.
-    0x0f, 0xff, 0x0f,  //.@@@.@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x0f, 0x0f,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 6 */
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0xf0, 0x0f, 0x00,  //@..@..
-    0xf0, 0x00, 0xf0,  //@...@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x00,
+    0xf0, 0x00, 0xf0, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 6 */
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x00,  //@.....
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x0f,  //.....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 5 */
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0xff, 0xf0,  //.@@@@.
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+    0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0x00, 0xff, 0x00,  //..@@..
-    0x00, 0x00, 0x00,  //......
-
+    0x13, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+    0x0f, 0x00, 0xf0, 0x00, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0xff, 0x0f,  //@.@@.@
-    0xff, 0x00, 0xff,  //@@..@@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0xff, 0x0f,
+    0xff, 0x00, 0xff, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 6 */
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0x00, 0xff, 0x00,  //..@@..
-    0x0f, 0x00, 0xf0,  //.@..@.
-    0xf0, 0x00, 0x0f,  //@....@
-    0xf0, 0x00, 0x0f,  //@....@
-    0x00, 0x00, 0x00,  //......
-
+    0x14, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0x00, 0xf0,
+    0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xfe, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 5 */
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+005a (Z) , Width: 5 */
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0x00, 0x00,  //.@...
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00,
+    0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+005b ([) , Width: 3 */
-    0xff, 0xf0,  //@@@
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0xf0, 0x00,  //@..
-    0xff, 0xf0,  //@@@
-    0x00, 0x00,  //...
-
+    0x0f, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+005c (\) , Width: 7 */
-    0xf0, 0x00, 0x00, 0x00,  //@......
-    0x0f, 0x00, 0x00, 0x00,  //.@.....
-    0x00, 0xf0, 0x00, 0x00,  //..@....
-    0x00, 0x0f, 0x00, 0x00,  //...@...
-    0x00, 0x00, 0xf0, 0x00,  //....@..
-    0x00, 0x00, 0x0f, 0x00,  //.....@.
-    0x00, 0x00, 0x00, 0xf0,  //......@
-    0x00, 0x00, 0x00, 0x00,  //.......
-
+    0x00, 0xf0, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0x00,
+    0x00, 0xf0, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+005d (]) , Width: 3 */
-    0xff, 0xf0,  //@@@
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0x00, 0xf0,  //..@
-    0xff, 0xf0,  //@@@
-    0x00, 0x00,  //...
-
+    0x0f, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+005e (^) , Width: 5 */
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
+    0x08, 0x00, 0xf0, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0xf2, 0x00,
 
     /*Unicode: U+005f (_) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-
+    0xec, 0x00, 0x02, 0xff, 0xff, 0xf0,
 
     /*Unicode: U+0060 (`) , Width: 3 */
-    0xf0, 0x00,  //@..
-    0x0f, 0x00,  //.@.
-    0x00, 0xf0,  //..@
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-    0x00, 0x00,  //...
-
+    0x05, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0xf0,  //....@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0x09, 0xf0, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x0f,
+    0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 5 */
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0d, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x0f,
+    0xff, 0xfd, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 5 */
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xff, 0xff, 0xf0,  //@@@@@
-    0xf0, 0x00, 0x00,  //@....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0d, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x0f,
+    0xff, 0xfd, 0x00,
 
     /*Unicode: U+0066 (f) , Width: 6 */
-    0x00, 0x0f, 0xf0,  //...@@.
-    0x00, 0xf0, 0x0f,  //..@..@
-    0x00, 0xf0, 0x00,  //..@...
-    0xff, 0xff, 0xf0,  //@@@@@.
-    0x00, 0xf0, 0x00,  //..@...
-    0x00, 0xf0, 0x00,  //..@...
-    0x00, 0xf0, 0x00,  //..@...
-    0x00, 0x00, 0x00,  //......
-
+    0x13, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0xf0, 0xfd, 0x00,
 
     /*Unicode: U+0067 (g) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x0f, 0xff, 0x00,  //.@@@.
-
+    0xfb, 0x00, 0x11, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x00,
+    0x00, 0xf0, 0x0f, 0xff, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 5 */
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0,
+    0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 3 */
-    0x0f, 0x00,  //.@.
-    0x00, 0x00,  //...
-    0xff, 0x00,  //@@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0xff, 0xf0,  //@@@
-    0x00, 0x00,  //...
-
+    0x00, 0x0f, 0xfe, 0x00, 0x0b, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00, 0x0f,  //...@
-    0x00, 0x00,  //....
-    0x00, 0xff,  //..@@
-    0x00, 0x0f,  //...@
-    0x00, 0x0f,  //...@
-    0x00, 0x0f,  //...@
-    0xf0, 0x0f,  //@..@
-    0x0f, 0xf0,  //.@@.
-
+    0x01, 0x00, 0x0f, 0xfe, 0x00, 0x0a, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x0f, 0x0f,
+    0xf0,
 
     /*Unicode: U+006b (k) , Width: 5 */
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x0f, 0x00,  //@..@.
-    0xff, 0xf0, 0x00,  //@@@..
-    0xf0, 0x0f, 0x00,  //@..@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0x00,  //.....
-
+    0x14, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0xff, 0xf0, 0x00,
+    0xf0, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+006c (l) , Width: 3 */
-    0xff, 0x00,  //@@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0x0f, 0x00,  //.@.
-    0xff, 0xf0,  //@@@
-    0x00, 0x00,  //...
-
+    0x0f, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00,
+    0x00,
 
     /*Unicode: U+006d (m) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0x0f, 0x00,  //@@.@.
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x02, 0xff, 0x0f, 0x00, 0xf5, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+006e (n) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0e, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0,
+    0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+006f (o) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0d, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f,
+    0xff, 0xfd, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xff, 0xff, 0x00,  //@@@@.
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-
+    0xfb, 0x00, 0x11, 0xff, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf0,
+    0x00, 0x00, 0xf0, 0x00, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x00, 0x00, 0xf0,  //....@
-
+    0xfb, 0x00, 0x11, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0xf0,
 
     /*Unicode: U+0072 (r) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0xff, 0xf0,  //@.@@@
-    0xff, 0x00, 0x00,  //@@...
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-    0xf0, 0x00, 0x00,  //@....
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0c, 0xf0, 0xff, 0xf0, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+    0xfc, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0xf0, 0x00, 0x00,  //@....
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0xf0,  //....@
-    0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x07, 0x0f, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x02, 0xf0, 0xff,
+    0xff, 0xfd, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 5 */
-    0x0f, 0x00, 0x00,  //.@...
-    0x0f, 0x00, 0x00,  //.@...
-    0xff, 0xff, 0x00,  //@@@@.
-    0x0f, 0x00, 0x00,  //.@...
-    0x0f, 0x00, 0x00,  //.@...
-    0x0f, 0x00, 0xf0,  //.@..@
-    0x00, 0xff, 0x00,  //..@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0x13, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x0f, 0x00, 0xf0, 0x00, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0d, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f,
+    0xff, 0xfd, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0d, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0x00,
+    0xf0, 0xfd, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x01, 0xf0, 0x00, 0xf7, 0xf0, 0x01, 0x0f, 0x0f, 0xfd, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0x0f, 0x00,  //.@.@.
-    0xf0, 0x00, 0xf0,  //@...@
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0e, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x0f, 0x00, 0xf0,
+    0x00, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0xf0, 0x00, 0xf0,  //@...@
-    0x0f, 0xff, 0xf0,  //.@@@@
-    0x00, 0x00, 0xf0,  //....@
-    0x0f, 0xff, 0x00,  //.@@@.
-
+    0xfb, 0x00, 0x11, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x00,
+    0x00, 0xf0, 0x0f, 0xff, 0x00,
 
     /*Unicode: U+007a (z) , Width: 5 */
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0xf0, 0x00,  //..@..
-    0x0f, 0x00, 0x00,  //.@...
-    0xff, 0xff, 0xf0,  //@@@@@
-    0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0x00, 0x0e, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xff,
+    0xff, 0xf0, 0xfe, 0x00,
 
     /*Unicode: U+007b ({) , Width: 4 */
-    0x00, 0xff,  //..@@
-    0x0f, 0x00,  //.@..
-    0x0f, 0x00,  //.@..
-    0xf0, 0x00,  //@...
-    0x0f, 0x00,  //.@..
-    0x0f, 0x00,  //.@..
-    0x00, 0xff,  //..@@
-    0x00, 0x00,  //....
-
+    0x0f, 0x00, 0xff, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0xff, 0x00,
+    0x00,
 
     /*Unicode: U+007c (|) , Width: 1 */
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-    0xf0,  //@
-
+    0xf9, 0xf0,
 
     /*Unicode: U+007d (}) , Width: 4 */
-    0xff, 0x00,  //@@..
-    0x00, 0xf0,  //..@.
-    0x00, 0xf0,  //..@.
-    0x00, 0x0f,  //...@
-    0x00, 0xf0,  //..@.
-    0x00, 0xf0,  //..@.
-    0xff, 0x00,  //@@..
-    0x00, 0x00,  //....
-
+    0x0c, 0xff, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+007e (~) , Width: 5 */
-    0x0f, 0x00, 0x00,  //.@...
-    0xf0, 0xf0, 0xf0,  //@.@.@
-    0x00, 0x0f, 0x00,  //...@.
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00,  //.....
-
-
+    0x02, 0x0f, 0x00, 0x00, 0xfe, 0xf0, 0x01, 0x00, 0x0f, 0xf1, 0x00,
 
 #elif USE_LV_FONT_MONOSPACE_8 == 8
     /*Unicode: U+0020 ( ) , Width: 3 */
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-
+    0xe9, 0x00,
 
     /*Unicode: U+0021 (!) , Width: 1 */
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0x00,  //.
-    0x00,  //.
-    0xff,  //@
-    0x00,  //.
-
+    0xfd, 0xff, 0x03, 0x00, 0x00, 0xff, 0x00,
 
     /*Unicode: U+0022 (") , Width: 4 */
-    0xff, 0x00, 0x00, 0xff,  //@..@
-    0xff, 0x00, 0x00, 0xff,  //@..@
-    0xff, 0x00, 0x00, 0xff,  //@..@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0x0b, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xed, 0x00,
 
     /*Unicode: U+0023 (#) , Width: 6 */
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xfb, 0xff, 0x05,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xfb, 0xff, 0x0a, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0024 ($) , Width: 5 */
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0xff, 0x00, 0x00,  //@.@..
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0xff, 0x00, 0xff,  //..@.@
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe,
+    0x00, 0x01, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0025 (%) , Width: 6 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,  //@@...@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0x00,  //@@..@.
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...@..
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@...
-    0x00, 0xff, 0x00, 0x00, 0xff, 0xff,  //.@..@@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@...@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00,
+    0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x01,
+    0xff, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0026 (&) , Width: 6 */
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //@..@..
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //@..@..
-    0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@...
-    0xff, 0x00, 0x00, 0xff, 0x00, 0xff,  //@..@.@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@.@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x02, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x09, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x06, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff,
+    0xfe, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0027 (') , Width: 3 */
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0x00, 0x00,  //@..
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-
+    0x06, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0x00,
 
     /*Unicode: U+0028 (() , Width: 3 */
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0x00,  //...
-
+    0x0c, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+0029 ()) , Width: 3 */
-    0xff, 0x00, 0x00,  //@..
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0x00, 0x00,  //@..
-    0x00, 0x00, 0x00,  //...
-
+    0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0a, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+002a (*) , Width: 5 */
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x0a, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00,
+    0x00, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0x08, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0xfa, 0x00,
 
     /*Unicode: U+002b (+) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfa, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0xff,
+    0xfd, 0x00, 0x00, 0xff, 0xf5, 0x00,
 
     /*Unicode: U+002c (,) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0xff,  //.@
-    0x00, 0xff,  //.@
-    0xff, 0x00,  //@.
-
+    0xf6, 0x00, 0x04, 0xff, 0x00, 0xff, 0xff, 0x00,
 
     /*Unicode: U+002d (-) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xed, 0x00, 0xfc, 0xff, 0xf2, 0x00,
 
     /*Unicode: U+002e (.) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0x00,  //.
-    0xff,  //@
-    0x00,  //.
-
+    0xfb, 0x00, 0x01, 0xff, 0x00,
 
     /*Unicode: U+002f (/) , Width: 7 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //......@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.....@.
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@....
-    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0xfb, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff,
+    0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf4, 0x00,
 
     /*Unicode: U+0030 (0) , Width: 5 */
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0xff, 0xff,  //@..@@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0xff, 0x00, 0x00, 0xff,  //@@..@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff,
+    0x02, 0x00, 0xff, 0x00, 0xfe, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00,
+    0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0031 (1) , Width: 5 */
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0xff, 0x00, 0x00,  //.@@..
-    0xff, 0x00, 0xff, 0x00, 0x00,  //@.@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x06, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xfd, 0x00,
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+0032 (2) , Width: 5 */
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0xff, 0xff, 0x00, 0x00,  //.@@..
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe,
+    0x00, 0x07, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfc, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+0033 (3) , Width: 5 */
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0xff, 0xff, 0x00,  //..@@.
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x04, 0xff, 0x00,
+    0x00, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb,
+    0x00,
 
     /*Unicode: U+0034 (4) , Width: 5 */
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0xff, 0xff, 0x00,  //..@@.
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0xff, 0x00, 0x00, 0xff, 0x00,  //@..@.
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0c, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0035 (5) , Width: 5 */
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfb, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe,
+    0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0036 (6) , Width: 5 */
-    0x00, 0x00, 0xff, 0xff, 0xff,  //..@@@
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff,
+    0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb,
+    0x00,
 
     /*Unicode: U+0037 (7) , Width: 5 */
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfc, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0038 (8) , Width: 5 */
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00,
+    0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0039 (9) , Width: 5 */
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0xff, 0xff, 0xff, 0x00, 0x00,  //@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0x00, 0xfd, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+003a (:) , Width: 1 */
-    0x00,  //.
-    0x00,  //.
-    0xff,  //@
-    0x00,  //.
-    0x00,  //.
-    0xff,  //@
-    0x00,  //.
-    0x00,  //.
-
+    0x07, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
 
     /*Unicode: U+003b (;) , Width: 2 */
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0xff,  //.@
-    0x00, 0x00,  //..
-    0x00, 0x00,  //..
-    0x00, 0xff,  //.@
-    0x00, 0xff,  //.@
-    0xff, 0x00,  //@.
-
+    0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x04, 0xff, 0x00, 0xff, 0xff, 0x00,
 
     /*Unicode: U+003c (<) , Width: 4 */
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0xff, 0x00, 0x00, 0x00,  //@...
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0xfe, 0x00, 0x09, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00,
+    0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+003d (=) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0xff, 0xf2, 0x00,
 
     /*Unicode: U+003e (>) , Width: 4 */
-    0xff, 0x00, 0x00, 0x00,  //@...
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0xff, 0x00, 0x00, 0x00,  //@...
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x09, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+003f (?) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //....@.
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...@..
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //...@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+    0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0040 (@) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0xff,  //@..@.@
-    0xff, 0x00, 0xff, 0x00, 0xff, 0xff,  //@.@.@@
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //@..@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0xff, 0x00, 0xff, 0x00, 0xfe, 0xff, 0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfb, 0x00,
+    0xfd, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0041 (A) , Width: 6 */
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@..
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x03, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xfd, 0x00,
+    0xf9, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfb, 0x00,
 
     /*Unicode: U+0042 (B) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfc, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfb, 0xff, 0x01, 0x00,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfb, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0043 (C) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xff,
+    0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff, 0xfa,
+    0x00,
 
     /*Unicode: U+0044 (D) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@..
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfd, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00,
+    0xfd, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0045 (E) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@..
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfa, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfc, 0x00,
+    0x00, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0046 (F) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@..
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfa, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfc, 0x00,
+    0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf6, 0x00,
 
     /*Unicode: U+0047 (G) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@..@@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x02, 0xff,
+    0x00, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff,
+    0xfa, 0x00,
 
     /*Unicode: U+0048 (H) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xf9, 0xff,
+    0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0049 (I) , Width: 3 */
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0x00,  //...
-
+    0xfe, 0xff, 0x0e, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+004a (J) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+004b (K) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //@..@..
-    0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //@..@..
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x06, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x02, 0xff, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+004c (L) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00,
+    0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+004d (M) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff,  //@.@@.@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x05, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+004e (N) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0x00, 0x00, 0x00, 0xff,  //@@...@
-    0xff, 0x00, 0xff, 0x00, 0x00, 0xff,  //@.@..@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0xff,  //@..@.@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@...@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x0d, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff,
+    0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+004f (O) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00,
+    0xfd, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0050 (P) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfc, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfb, 0xff, 0x01, 0x00,
+    0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf6, 0x00,
 
     /*Unicode: U+0051 (Q) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0xff, 0x00, 0xff,  //@..@.@
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0x00, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@.@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x02, 0xff,
+    0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0052 (R) , Width: 6 */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0xff, 0x00, 0x00, 0xff, 0x00, 0x00,  //@..@..
-    0xff, 0x00, 0x00, 0x00, 0xff, 0x00,  //@...@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfc, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xfb, 0xff, 0x07, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfd, 0x00, 0x00,
+    0xff, 0xfb, 0x00,
 
     /*Unicode: U+0053 (S) , Width: 6 */
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@.....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //.....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0xfd, 0xff,
+    0xfb, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0054 (T) , Width: 5 */
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfc, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0055 (U) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00,
+    0xfd, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0056 (V) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe,
+    0x00, 0x01, 0xff, 0xff, 0xf9, 0x00,
 
     /*Unicode: U+0057 (W) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0xff, 0xff, 0x00, 0xff,  //@.@@.@
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe,
+    0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0058 (X) , Width: 6 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@..
-    0x00, 0xff, 0x00, 0x00, 0xff, 0x00,  //.@..@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff,  //@....@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xfd, 0x00,
+    0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0059 (Y) , Width: 5 */
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0x00, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfa,
+    0x00,
 
     /*Unicode: U+005a (Z) , Width: 5 */
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfc, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfc, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+005b ([) , Width: 3 */
-    0xff, 0xff, 0xff,  //@@@
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0x00, 0x00,  //@..
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0x00,  //...
-
+    0xfd, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+005c (\) , Width: 7 */
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@......
-    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@.....
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@....
-    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //.....@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,  //......@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+    0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00,
+    0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+005d (]) , Width: 3 */
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0xff,  //..@
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0x00,  //...
-
+    0xfe, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xfd, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+005e (^) , Width: 5 */
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xe8, 0x00,
 
     /*Unicode: U+005f (_) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-
+    0xde, 0x00, 0xfc, 0xff,
 
     /*Unicode: U+0060 (`) , Width: 3 */
-    0xff, 0x00, 0x00,  //@..
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0x00, 0xff,  //..@
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-    0x00, 0x00, 0x00,  //...
-
+    0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf2, 0x00,
 
     /*Unicode: U+0061 (a) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf6, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00,
+    0xfd, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+0062 (b) , Width: 5 */
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01,
+    0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0063 (c) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf6, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0064 (d) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff,
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+0065 (e) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf6, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfb,
+    0x00,
 
     /*Unicode: U+0066 (f) , Width: 6 */
-    0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //...@@.
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //..@..@
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@.
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@...
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@...
-    0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //..@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+    0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x06, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfe,
+    0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf8,
+    0x00,
 
     /*Unicode: U+0067 (g) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-
+    0xf6, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff,
+    0xfd, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x00,
 
     /*Unicode: U+0068 (h) , Width: 5 */
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01,
+    0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfc, 0x00,
 
     /*Unicode: U+0069 (i) , Width: 3 */
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0x00, 0x00,  //...
-    0xff, 0xff, 0x00,  //@@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0x00,  //...
-
+    0x01, 0x00, 0xff, 0xfd, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+006a (j) , Width: 4 */
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0x00, 0x00,  //....
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0xff, 0x00, 0x00, 0xff,  //@..@
-    0x00, 0xff, 0xff, 0x00,  //.@@.
-
+    0xfe, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
+    0xff, 0xfe, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00,
 
     /*Unicode: U+006b (k) , Width: 5 */
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0xff, 0x00,  //@..@.
-    0xff, 0xff, 0xff, 0x00, 0x00,  //@@@..
-    0xff, 0x00, 0x00, 0xff, 0x00,  //@..@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00,
+    0x00, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+006c (l) , Width: 3 */
-    0xff, 0xff, 0x00,  //@@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0x00, 0xff, 0x00,  //.@.
-    0xff, 0xff, 0xff,  //@@@
-    0x00, 0x00, 0x00,  //...
-
+    0x11, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0x00,
 
     /*Unicode: U+006d (m) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0x00, 0xff, 0x00,  //@@.@.
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x18, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+006e (n) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+006f (o) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf6, 0x00, 0xfe, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff,
+    0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0070 (p) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-
+    0xf7, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xfc, 0xff,
+    0x01, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+0071 (q) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-
+    0xf6, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfd, 0xff,
+    0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
 
     /*Unicode: U+0072 (r) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0xff, 0xff, 0xff,  //@.@@@
-    0xff, 0xff, 0x00, 0x00, 0x00,  //@@...
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x01, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+    0x00, 0x00, 0xff, 0xf8, 0x00,
 
     /*Unicode: U+0073 (s) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf6, 0x00, 0xfc, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfc, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0074 (t) , Width: 5 */
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@.
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0x00, 0xff, 0x00, 0x00, 0xff,  //.@..@
-    0x00, 0x00, 0xff, 0xff, 0x00,  //..@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0x01, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd,
+    0x00, 0x00, 0xff, 0xfd, 0x00, 0x07, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0075 (u) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0076 (v) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
     /*Unicode: U+0077 (w) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x13, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+0078 (x) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0x00, 0xff, 0x00,  //.@.@.
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+0079 (y) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0xff, 0x00, 0x00, 0x00, 0xff,  //@...@
-    0x00, 0xff, 0xff, 0xff, 0xff,  //.@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff,  //....@
-    0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@.
-
+    0xf7, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x01, 0xff, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x01, 0xff, 0x00, 0xfe, 0xff, 0x00, 0x00,
 
     /*Unicode: U+007a (z) , Width: 5 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+    0xf7, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+    0xfe, 0x00, 0xfc, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+007b ({) , Width: 4 */
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0xff, 0x00, 0x00, 0x00,  //@...
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0x00, 0xff, 0x00, 0x00,  //.@..
-    0x00, 0x00, 0xff, 0xff,  //..@@
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfd, 0x00,
+    0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
     /*Unicode: U+007c (|) , Width: 1 */
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-    0xff,  //@
-
+    0xf9, 0xff,
 
     /*Unicode: U+007d (}) , Width: 4 */
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0x00, 0x00, 0xff,  //...@
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0x00, 0x00, 0xff, 0x00,  //..@.
-    0xff, 0xff, 0x00, 0x00,  //@@..
-    0x00, 0x00, 0x00, 0x00,  //....
-
+    0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x03, 0xff, 0x00,
+    0x00, 0xff, 0xfe, 0x00, 0x03, 0xff, 0x00, 0xff, 0xff, 0xfb, 0x00,
 
     /*Unicode: U+007e (~) , Width: 5 */
-    0x00, 0xff, 0x00, 0x00, 0x00,  //.@...
-    0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-    0x00, 0x00, 0x00, 0xff, 0x00,  //...@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
-
+    0x01, 0x00, 0xff, 0xfe, 0x00, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xe7,
+    0x00,
 
 #endif
 };
@@ -4205,391 +1370,391 @@ static const uint8_t lv_font_monospace_8_glyph_bitmap[] = {
 static const lv_font_glyph_dsc_t lv_font_monospace_8_glyph_dsc[] = {
 #if USE_LV_FONT_MONOSPACE_8 == 1
     {.w_px = 3,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 1,   .glyph_index = 8},  /*Unicode: U+0021 (!)*/
-    {.w_px = 4,   .glyph_index = 16}, /*Unicode: U+0022 (")*/
-    {.w_px = 6,   .glyph_index = 24}, /*Unicode: U+0023 (#)*/
-    {.w_px = 5,   .glyph_index = 32}, /*Unicode: U+0024 ($)*/
-    {.w_px = 6,   .glyph_index = 40}, /*Unicode: U+0025 (%)*/
-    {.w_px = 6,   .glyph_index = 48}, /*Unicode: U+0026 (&)*/
-    {.w_px = 3,   .glyph_index = 56}, /*Unicode: U+0027 (')*/
-    {.w_px = 3,   .glyph_index = 64}, /*Unicode: U+0028 (()*/
-    {.w_px = 3,   .glyph_index = 72}, /*Unicode: U+0029 ())*/
-    {.w_px = 5,   .glyph_index = 80}, /*Unicode: U+002a (*)*/
-    {.w_px = 5,   .glyph_index = 88}, /*Unicode: U+002b (+)*/
-    {.w_px = 2,   .glyph_index = 96}, /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 104},    /*Unicode: U+002d (-)*/
-    {.w_px = 1,   .glyph_index = 112},    /*Unicode: U+002e (.)*/
-    {.w_px = 7,   .glyph_index = 120},    /*Unicode: U+002f (/)*/
-    {.w_px = 5,   .glyph_index = 128},    /*Unicode: U+0030 (0)*/
-    {.w_px = 5,   .glyph_index = 136},    /*Unicode: U+0031 (1)*/
-    {.w_px = 5,   .glyph_index = 144},    /*Unicode: U+0032 (2)*/
-    {.w_px = 5,   .glyph_index = 152},    /*Unicode: U+0033 (3)*/
-    {.w_px = 5,   .glyph_index = 160},    /*Unicode: U+0034 (4)*/
-    {.w_px = 5,   .glyph_index = 168},    /*Unicode: U+0035 (5)*/
-    {.w_px = 5,   .glyph_index = 176},    /*Unicode: U+0036 (6)*/
-    {.w_px = 5,   .glyph_index = 184},    /*Unicode: U+0037 (7)*/
-    {.w_px = 5,   .glyph_index = 192},    /*Unicode: U+0038 (8)*/
-    {.w_px = 5,   .glyph_index = 200},    /*Unicode: U+0039 (9)*/
-    {.w_px = 1,   .glyph_index = 208},    /*Unicode: U+003a (:)*/
+    {.w_px = 1,   .glyph_index = 2},  /*Unicode: U+0021 (!)*/
+    {.w_px = 4,   .glyph_index = 9}, /*Unicode: U+0022 (")*/
+    {.w_px = 6,   .glyph_index = 13}, /*Unicode: U+0023 (#)*/
+    {.w_px = 5,   .glyph_index = 22}, /*Unicode: U+0024 ($)*/
+    {.w_px = 6,   .glyph_index = 31}, /*Unicode: U+0025 (%)*/
+    {.w_px = 6,   .glyph_index = 40}, /*Unicode: U+0026 (&)*/
+    {.w_px = 3,   .glyph_index = 49}, /*Unicode: U+0027 (')*/
+    {.w_px = 3,   .glyph_index = 55}, /*Unicode: U+0028 (()*/
+    {.w_px = 3,   .glyph_index = 64}, /*Unicode: U+0029 ())*/
+    {.w_px = 5,   .glyph_index = 73}, /*Unicode: U+002a (*)*/
+    {.w_px = 5,   .glyph_index = 82}, /*Unicode: U+002b (+)*/
+    {.w_px = 2,   .glyph_index = 91}, /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 97},    /*Unicode: U+002d (-)*/
+    {.w_px = 1,   .glyph_index = 103},    /*Unicode: U+002e (.)*/
+    {.w_px = 7,   .glyph_index = 108},    /*Unicode: U+002f (/)*/
+    {.w_px = 5,   .glyph_index = 117},    /*Unicode: U+0030 (0)*/
+    {.w_px = 5,   .glyph_index = 126},    /*Unicode: U+0031 (1)*/
+    {.w_px = 5,   .glyph_index = 135},    /*Unicode: U+0032 (2)*/
+    {.w_px = 5,   .glyph_index = 144},    /*Unicode: U+0033 (3)*/
+    {.w_px = 5,   .glyph_index = 153},    /*Unicode: U+0034 (4)*/
+    {.w_px = 5,   .glyph_index = 162},    /*Unicode: U+0035 (5)*/
+    {.w_px = 5,   .glyph_index = 171},    /*Unicode: U+0036 (6)*/
+    {.w_px = 5,   .glyph_index = 180},    /*Unicode: U+0037 (7)*/
+    {.w_px = 5,   .glyph_index = 189},    /*Unicode: U+0038 (8)*/
+    {.w_px = 5,   .glyph_index = 198},    /*Unicode: U+0039 (9)*/
+    {.w_px = 1,   .glyph_index = 207},    /*Unicode: U+003a (:)*/
     {.w_px = 2,   .glyph_index = 216},    /*Unicode: U+003b (;)*/
-    {.w_px = 4,   .glyph_index = 224},    /*Unicode: U+003c (<)*/
-    {.w_px = 5,   .glyph_index = 232},    /*Unicode: U+003d (=)*/
-    {.w_px = 4,   .glyph_index = 240},    /*Unicode: U+003e (>)*/
-    {.w_px = 6,   .glyph_index = 248},    /*Unicode: U+003f (?)*/
-    {.w_px = 6,   .glyph_index = 256},    /*Unicode: U+0040 (@)*/
-    {.w_px = 6,   .glyph_index = 264},    /*Unicode: U+0041 (A)*/
-    {.w_px = 6,   .glyph_index = 272},    /*Unicode: U+0042 (B)*/
-    {.w_px = 6,   .glyph_index = 280},    /*Unicode: U+0043 (C)*/
-    {.w_px = 6,   .glyph_index = 288},    /*Unicode: U+0044 (D)*/
-    {.w_px = 6,   .glyph_index = 296},    /*Unicode: U+0045 (E)*/
-    {.w_px = 6,   .glyph_index = 304},    /*Unicode: U+0046 (F)*/
-    {.w_px = 6,   .glyph_index = 312},    /*Unicode: U+0047 (G)*/
-    {.w_px = 6,   .glyph_index = 320},    /*Unicode: U+0048 (H)*/
-    {.w_px = 3,   .glyph_index = 328},    /*Unicode: U+0049 (I)*/
-    {.w_px = 5,   .glyph_index = 336},    /*Unicode: U+004a (J)*/
-    {.w_px = 6,   .glyph_index = 344},    /*Unicode: U+004b (K)*/
-    {.w_px = 6,   .glyph_index = 352},    /*Unicode: U+004c (L)*/
-    {.w_px = 6,   .glyph_index = 360},    /*Unicode: U+004d (M)*/
-    {.w_px = 6,   .glyph_index = 368},    /*Unicode: U+004e (N)*/
-    {.w_px = 6,   .glyph_index = 376},    /*Unicode: U+004f (O)*/
-    {.w_px = 6,   .glyph_index = 384},    /*Unicode: U+0050 (P)*/
-    {.w_px = 6,   .glyph_index = 392},    /*Unicode: U+0051 (Q)*/
-    {.w_px = 6,   .glyph_index = 400},    /*Unicode: U+0052 (R)*/
-    {.w_px = 6,   .glyph_index = 408},    /*Unicode: U+0053 (S)*/
-    {.w_px = 5,   .glyph_index = 416},    /*Unicode: U+0054 (T)*/
-    {.w_px = 6,   .glyph_index = 424},    /*Unicode: U+0055 (U)*/
-    {.w_px = 6,   .glyph_index = 432},    /*Unicode: U+0056 (V)*/
-    {.w_px = 6,   .glyph_index = 440},    /*Unicode: U+0057 (W)*/
-    {.w_px = 6,   .glyph_index = 448},    /*Unicode: U+0058 (X)*/
-    {.w_px = 5,   .glyph_index = 456},    /*Unicode: U+0059 (Y)*/
-    {.w_px = 5,   .glyph_index = 464},    /*Unicode: U+005a (Z)*/
-    {.w_px = 3,   .glyph_index = 472},    /*Unicode: U+005b ([)*/
-    {.w_px = 7,   .glyph_index = 480},    /*Unicode: U+005c (\)*/
-    {.w_px = 3,   .glyph_index = 488},    /*Unicode: U+005d (])*/
-    {.w_px = 5,   .glyph_index = 496},    /*Unicode: U+005e (^)*/
-    {.w_px = 5,   .glyph_index = 504},    /*Unicode: U+005f (_)*/
-    {.w_px = 3,   .glyph_index = 512},    /*Unicode: U+0060 (`)*/
-    {.w_px = 5,   .glyph_index = 520},    /*Unicode: U+0061 (a)*/
-    {.w_px = 5,   .glyph_index = 528},    /*Unicode: U+0062 (b)*/
-    {.w_px = 5,   .glyph_index = 536},    /*Unicode: U+0063 (c)*/
-    {.w_px = 5,   .glyph_index = 544},    /*Unicode: U+0064 (d)*/
+    {.w_px = 4,   .glyph_index = 225},    /*Unicode: U+003c (<)*/
+    {.w_px = 5,   .glyph_index = 234},    /*Unicode: U+003d (=)*/
+    {.w_px = 4,   .glyph_index = 242},    /*Unicode: U+003e (>)*/
+    {.w_px = 6,   .glyph_index = 251},    /*Unicode: U+003f (?)*/
+    {.w_px = 6,   .glyph_index = 260},    /*Unicode: U+0040 (@)*/
+    {.w_px = 6,   .glyph_index = 269},    /*Unicode: U+0041 (A)*/
+    {.w_px = 6,   .glyph_index = 278},    /*Unicode: U+0042 (B)*/
+    {.w_px = 6,   .glyph_index = 287},    /*Unicode: U+0043 (C)*/
+    {.w_px = 6,   .glyph_index = 296},    /*Unicode: U+0044 (D)*/
+    {.w_px = 6,   .glyph_index = 305},    /*Unicode: U+0045 (E)*/
+    {.w_px = 6,   .glyph_index = 314},    /*Unicode: U+0046 (F)*/
+    {.w_px = 6,   .glyph_index = 323},    /*Unicode: U+0047 (G)*/
+    {.w_px = 6,   .glyph_index = 332},    /*Unicode: U+0048 (H)*/
+    {.w_px = 3,   .glyph_index = 340},    /*Unicode: U+0049 (I)*/
+    {.w_px = 5,   .glyph_index = 347},    /*Unicode: U+004a (J)*/
+    {.w_px = 6,   .glyph_index = 353},    /*Unicode: U+004b (K)*/
+    {.w_px = 6,   .glyph_index = 362},    /*Unicode: U+004c (L)*/
+    {.w_px = 6,   .glyph_index = 367},    /*Unicode: U+004d (M)*/
+    {.w_px = 6,   .glyph_index = 375},    /*Unicode: U+004e (N)*/
+    {.w_px = 6,   .glyph_index = 384},    /*Unicode: U+004f (O)*/
+    {.w_px = 6,   .glyph_index = 391},    /*Unicode: U+0050 (P)*/
+    {.w_px = 6,   .glyph_index = 400},    /*Unicode: U+0051 (Q)*/
+    {.w_px = 6,   .glyph_index = 409},    /*Unicode: U+0052 (R)*/
+    {.w_px = 6,   .glyph_index = 418},    /*Unicode: U+0053 (S)*/
+    {.w_px = 5,   .glyph_index = 427},    /*Unicode: U+0054 (T)*/
+    {.w_px = 6,   .glyph_index = 433},    /*Unicode: U+0055 (U)*/
+    {.w_px = 6,   .glyph_index = 438},    /*Unicode: U+0056 (V)*/
+    {.w_px = 6,   .glyph_index = 444},    /*Unicode: U+0057 (W)*/
+    {.w_px = 6,   .glyph_index = 451},    /*Unicode: U+0058 (X)*/
+    {.w_px = 5,   .glyph_index = 460},    /*Unicode: U+0059 (Y)*/
+    {.w_px = 5,   .glyph_index = 468},    /*Unicode: U+005a (Z)*/
+    {.w_px = 3,   .glyph_index = 477},    /*Unicode: U+005b ([)*/
+    {.w_px = 7,   .glyph_index = 484},    /*Unicode: U+005c (\)*/
+    {.w_px = 3,   .glyph_index = 493},    /*Unicode: U+005d (])*/
+    {.w_px = 5,   .glyph_index = 500},    /*Unicode: U+005e (^)*/
+    {.w_px = 5,   .glyph_index = 506},    /*Unicode: U+005f (_)*/
+    {.w_px = 3,   .glyph_index = 510},    /*Unicode: U+0060 (`)*/
+    {.w_px = 5,   .glyph_index = 516},    /*Unicode: U+0061 (a)*/
+    {.w_px = 5,   .glyph_index = 525},    /*Unicode: U+0062 (b)*/
+    {.w_px = 5,   .glyph_index = 534},    /*Unicode: U+0063 (c)*/
+    {.w_px = 5,   .glyph_index = 543},    /*Unicode: U+0064 (d)*/
     {.w_px = 5,   .glyph_index = 552},    /*Unicode: U+0065 (e)*/
-    {.w_px = 6,   .glyph_index = 560},    /*Unicode: U+0066 (f)*/
-    {.w_px = 5,   .glyph_index = 568},    /*Unicode: U+0067 (g)*/
-    {.w_px = 5,   .glyph_index = 576},    /*Unicode: U+0068 (h)*/
-    {.w_px = 3,   .glyph_index = 584},    /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 592},    /*Unicode: U+006a (j)*/
-    {.w_px = 5,   .glyph_index = 600},    /*Unicode: U+006b (k)*/
-    {.w_px = 3,   .glyph_index = 608},    /*Unicode: U+006c (l)*/
-    {.w_px = 5,   .glyph_index = 616},    /*Unicode: U+006d (m)*/
-    {.w_px = 5,   .glyph_index = 624},    /*Unicode: U+006e (n)*/
-    {.w_px = 5,   .glyph_index = 632},    /*Unicode: U+006f (o)*/
-    {.w_px = 5,   .glyph_index = 640},    /*Unicode: U+0070 (p)*/
-    {.w_px = 5,   .glyph_index = 648},    /*Unicode: U+0071 (q)*/
-    {.w_px = 5,   .glyph_index = 656},    /*Unicode: U+0072 (r)*/
-    {.w_px = 5,   .glyph_index = 664},    /*Unicode: U+0073 (s)*/
-    {.w_px = 5,   .glyph_index = 672},    /*Unicode: U+0074 (t)*/
-    {.w_px = 5,   .glyph_index = 680},    /*Unicode: U+0075 (u)*/
-    {.w_px = 5,   .glyph_index = 688},    /*Unicode: U+0076 (v)*/
-    {.w_px = 5,   .glyph_index = 696},    /*Unicode: U+0077 (w)*/
-    {.w_px = 5,   .glyph_index = 704},    /*Unicode: U+0078 (x)*/
-    {.w_px = 5,   .glyph_index = 712},    /*Unicode: U+0079 (y)*/
-    {.w_px = 5,   .glyph_index = 720},    /*Unicode: U+007a (z)*/
-    {.w_px = 4,   .glyph_index = 728},    /*Unicode: U+007b ({)*/
-    {.w_px = 1,   .glyph_index = 736},    /*Unicode: U+007c (|)*/
-    {.w_px = 4,   .glyph_index = 744},    /*Unicode: U+007d (})*/
-    {.w_px = 5,   .glyph_index = 752},    /*Unicode: U+007e (~)*/
+    {.w_px = 6,   .glyph_index = 561},    /*Unicode: U+0066 (f)*/
+    {.w_px = 5,   .glyph_index = 570},    /*Unicode: U+0067 (g)*/
+    {.w_px = 5,   .glyph_index = 579},    /*Unicode: U+0068 (h)*/
+    {.w_px = 3,   .glyph_index = 587},    /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 596},    /*Unicode: U+006a (j)*/
+    {.w_px = 5,   .glyph_index = 605},    /*Unicode: U+006b (k)*/
+    {.w_px = 3,   .glyph_index = 614},    /*Unicode: U+006c (l)*/
+    {.w_px = 5,   .glyph_index = 621},    /*Unicode: U+006d (m)*/
+    {.w_px = 5,   .glyph_index = 629},    /*Unicode: U+006e (n)*/
+    {.w_px = 5,   .glyph_index = 637},    /*Unicode: U+006f (o)*/
+    {.w_px = 5,   .glyph_index = 646},    /*Unicode: U+0070 (p)*/
+    {.w_px = 5,   .glyph_index = 655},    /*Unicode: U+0071 (q)*/
+    {.w_px = 5,   .glyph_index = 664},    /*Unicode: U+0072 (r)*/
+    {.w_px = 5,   .glyph_index = 673},    /*Unicode: U+0073 (s)*/
+    {.w_px = 5,   .glyph_index = 682},    /*Unicode: U+0074 (t)*/
+    {.w_px = 5,   .glyph_index = 691},    /*Unicode: U+0075 (u)*/
+    {.w_px = 5,   .glyph_index = 699},    /*Unicode: U+0076 (v)*/
+    {.w_px = 5,   .glyph_index = 708},    /*Unicode: U+0077 (w)*/
+    {.w_px = 5,   .glyph_index = 717},    /*Unicode: U+0078 (x)*/
+    {.w_px = 5,   .glyph_index = 726},    /*Unicode: U+0079 (y)*/
+    {.w_px = 5,   .glyph_index = 735},    /*Unicode: U+007a (z)*/
+    {.w_px = 4,   .glyph_index = 744},    /*Unicode: U+007b ({)*/
+    {.w_px = 1,   .glyph_index = 753},    /*Unicode: U+007c (|)*/
+    {.w_px = 4,   .glyph_index = 755},    /*Unicode: U+007d (})*/
+    {.w_px = 5,   .glyph_index = 764},    /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_MONOSPACE_8 == 2
     {.w_px = 3,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 1,   .glyph_index = 8},  /*Unicode: U+0021 (!)*/
-    {.w_px = 4,   .glyph_index = 16}, /*Unicode: U+0022 (")*/
-    {.w_px = 6,   .glyph_index = 24}, /*Unicode: U+0023 (#)*/
-    {.w_px = 5,   .glyph_index = 40}, /*Unicode: U+0024 ($)*/
-    {.w_px = 6,   .glyph_index = 56}, /*Unicode: U+0025 (%)*/
-    {.w_px = 6,   .glyph_index = 72}, /*Unicode: U+0026 (&)*/
-    {.w_px = 3,   .glyph_index = 88}, /*Unicode: U+0027 (')*/
-    {.w_px = 3,   .glyph_index = 96}, /*Unicode: U+0028 (()*/
-    {.w_px = 3,   .glyph_index = 104},    /*Unicode: U+0029 ())*/
-    {.w_px = 5,   .glyph_index = 112},    /*Unicode: U+002a (*)*/
-    {.w_px = 5,   .glyph_index = 128},    /*Unicode: U+002b (+)*/
-    {.w_px = 2,   .glyph_index = 144},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 152},    /*Unicode: U+002d (-)*/
-    {.w_px = 1,   .glyph_index = 168},    /*Unicode: U+002e (.)*/
-    {.w_px = 7,   .glyph_index = 176},    /*Unicode: U+002f (/)*/
-    {.w_px = 5,   .glyph_index = 192},    /*Unicode: U+0030 (0)*/
-    {.w_px = 5,   .glyph_index = 208},    /*Unicode: U+0031 (1)*/
-    {.w_px = 5,   .glyph_index = 224},    /*Unicode: U+0032 (2)*/
-    {.w_px = 5,   .glyph_index = 240},    /*Unicode: U+0033 (3)*/
-    {.w_px = 5,   .glyph_index = 256},    /*Unicode: U+0034 (4)*/
-    {.w_px = 5,   .glyph_index = 272},    /*Unicode: U+0035 (5)*/
-    {.w_px = 5,   .glyph_index = 288},    /*Unicode: U+0036 (6)*/
-    {.w_px = 5,   .glyph_index = 304},    /*Unicode: U+0037 (7)*/
-    {.w_px = 5,   .glyph_index = 320},    /*Unicode: U+0038 (8)*/
-    {.w_px = 5,   .glyph_index = 336},    /*Unicode: U+0039 (9)*/
-    {.w_px = 1,   .glyph_index = 352},    /*Unicode: U+003a (:)*/
-    {.w_px = 2,   .glyph_index = 360},    /*Unicode: U+003b (;)*/
-    {.w_px = 4,   .glyph_index = 368},    /*Unicode: U+003c (<)*/
-    {.w_px = 5,   .glyph_index = 376},    /*Unicode: U+003d (=)*/
-    {.w_px = 4,   .glyph_index = 392},    /*Unicode: U+003e (>)*/
-    {.w_px = 6,   .glyph_index = 400},    /*Unicode: U+003f (?)*/
-    {.w_px = 6,   .glyph_index = 416},    /*Unicode: U+0040 (@)*/
-    {.w_px = 6,   .glyph_index = 432},    /*Unicode: U+0041 (A)*/
-    {.w_px = 6,   .glyph_index = 448},    /*Unicode: U+0042 (B)*/
-    {.w_px = 6,   .glyph_index = 464},    /*Unicode: U+0043 (C)*/
-    {.w_px = 6,   .glyph_index = 480},    /*Unicode: U+0044 (D)*/
-    {.w_px = 6,   .glyph_index = 496},    /*Unicode: U+0045 (E)*/
-    {.w_px = 6,   .glyph_index = 512},    /*Unicode: U+0046 (F)*/
-    {.w_px = 6,   .glyph_index = 528},    /*Unicode: U+0047 (G)*/
-    {.w_px = 6,   .glyph_index = 544},    /*Unicode: U+0048 (H)*/
-    {.w_px = 3,   .glyph_index = 560},    /*Unicode: U+0049 (I)*/
-    {.w_px = 5,   .glyph_index = 568},    /*Unicode: U+004a (J)*/
-    {.w_px = 6,   .glyph_index = 584},    /*Unicode: U+004b (K)*/
-    {.w_px = 6,   .glyph_index = 600},    /*Unicode: U+004c (L)*/
-    {.w_px = 6,   .glyph_index = 616},    /*Unicode: U+004d (M)*/
-    {.w_px = 6,   .glyph_index = 632},    /*Unicode: U+004e (N)*/
-    {.w_px = 6,   .glyph_index = 648},    /*Unicode: U+004f (O)*/
-    {.w_px = 6,   .glyph_index = 664},    /*Unicode: U+0050 (P)*/
-    {.w_px = 6,   .glyph_index = 680},    /*Unicode: U+0051 (Q)*/
-    {.w_px = 6,   .glyph_index = 696},    /*Unicode: U+0052 (R)*/
-    {.w_px = 6,   .glyph_index = 712},    /*Unicode: U+0053 (S)*/
-    {.w_px = 5,   .glyph_index = 728},    /*Unicode: U+0054 (T)*/
-    {.w_px = 6,   .glyph_index = 744},    /*Unicode: U+0055 (U)*/
-    {.w_px = 6,   .glyph_index = 760},    /*Unicode: U+0056 (V)*/
-    {.w_px = 6,   .glyph_index = 776},    /*Unicode: U+0057 (W)*/
-    {.w_px = 6,   .glyph_index = 792},    /*Unicode: U+0058 (X)*/
-    {.w_px = 5,   .glyph_index = 808},    /*Unicode: U+0059 (Y)*/
-    {.w_px = 5,   .glyph_index = 824},    /*Unicode: U+005a (Z)*/
-    {.w_px = 3,   .glyph_index = 840},    /*Unicode: U+005b ([)*/
-    {.w_px = 7,   .glyph_index = 848},    /*Unicode: U+005c (\)*/
-    {.w_px = 3,   .glyph_index = 864},    /*Unicode: U+005d (])*/
-    {.w_px = 5,   .glyph_index = 872},    /*Unicode: U+005e (^)*/
-    {.w_px = 5,   .glyph_index = 888},    /*Unicode: U+005f (_)*/
-    {.w_px = 3,   .glyph_index = 904},    /*Unicode: U+0060 (`)*/
-    {.w_px = 5,   .glyph_index = 912},    /*Unicode: U+0061 (a)*/
-    {.w_px = 5,   .glyph_index = 928},    /*Unicode: U+0062 (b)*/
-    {.w_px = 5,   .glyph_index = 944},    /*Unicode: U+0063 (c)*/
-    {.w_px = 5,   .glyph_index = 960},    /*Unicode: U+0064 (d)*/
-    {.w_px = 5,   .glyph_index = 976},    /*Unicode: U+0065 (e)*/
-    {.w_px = 6,   .glyph_index = 992},    /*Unicode: U+0066 (f)*/
-    {.w_px = 5,   .glyph_index = 1008},   /*Unicode: U+0067 (g)*/
-    {.w_px = 5,   .glyph_index = 1024},   /*Unicode: U+0068 (h)*/
-    {.w_px = 3,   .glyph_index = 1040},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 1048},   /*Unicode: U+006a (j)*/
-    {.w_px = 5,   .glyph_index = 1056},   /*Unicode: U+006b (k)*/
-    {.w_px = 3,   .glyph_index = 1072},   /*Unicode: U+006c (l)*/
-    {.w_px = 5,   .glyph_index = 1080},   /*Unicode: U+006d (m)*/
-    {.w_px = 5,   .glyph_index = 1096},   /*Unicode: U+006e (n)*/
-    {.w_px = 5,   .glyph_index = 1112},   /*Unicode: U+006f (o)*/
-    {.w_px = 5,   .glyph_index = 1128},   /*Unicode: U+0070 (p)*/
-    {.w_px = 5,   .glyph_index = 1144},   /*Unicode: U+0071 (q)*/
-    {.w_px = 5,   .glyph_index = 1160},   /*Unicode: U+0072 (r)*/
-    {.w_px = 5,   .glyph_index = 1176},   /*Unicode: U+0073 (s)*/
-    {.w_px = 5,   .glyph_index = 1192},   /*Unicode: U+0074 (t)*/
-    {.w_px = 5,   .glyph_index = 1208},   /*Unicode: U+0075 (u)*/
-    {.w_px = 5,   .glyph_index = 1224},   /*Unicode: U+0076 (v)*/
-    {.w_px = 5,   .glyph_index = 1240},   /*Unicode: U+0077 (w)*/
-    {.w_px = 5,   .glyph_index = 1256},   /*Unicode: U+0078 (x)*/
-    {.w_px = 5,   .glyph_index = 1272},   /*Unicode: U+0079 (y)*/
-    {.w_px = 5,   .glyph_index = 1288},   /*Unicode: U+007a (z)*/
-    {.w_px = 4,   .glyph_index = 1304},   /*Unicode: U+007b ({)*/
-    {.w_px = 1,   .glyph_index = 1312},   /*Unicode: U+007c (|)*/
-    {.w_px = 4,   .glyph_index = 1320},   /*Unicode: U+007d (})*/
-    {.w_px = 5,   .glyph_index = 1328},   /*Unicode: U+007e (~)*/
+    {.w_px = 1,   .glyph_index = 2},  /*Unicode: U+0021 (!)*/
+    {.w_px = 4,   .glyph_index = 9}, /*Unicode: U+0022 (")*/
+    {.w_px = 6,   .glyph_index = 13}, /*Unicode: U+0023 (#)*/
+    {.w_px = 5,   .glyph_index = 30}, /*Unicode: U+0024 ($)*/
+    {.w_px = 6,   .glyph_index = 46}, /*Unicode: U+0025 (%)*/
+    {.w_px = 6,   .glyph_index = 63}, /*Unicode: U+0026 (&)*/
+    {.w_px = 3,   .glyph_index = 80}, /*Unicode: U+0027 (')*/
+    {.w_px = 3,   .glyph_index = 86}, /*Unicode: U+0028 (()*/
+    {.w_px = 3,   .glyph_index = 95},    /*Unicode: U+0029 ())*/
+    {.w_px = 5,   .glyph_index = 104},    /*Unicode: U+002a (*)*/
+    {.w_px = 5,   .glyph_index = 120},    /*Unicode: U+002b (+)*/
+    {.w_px = 2,   .glyph_index = 134},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 140},    /*Unicode: U+002d (-)*/
+    {.w_px = 1,   .glyph_index = 147},    /*Unicode: U+002e (.)*/
+    {.w_px = 7,   .glyph_index = 152},    /*Unicode: U+002f (/)*/
+    {.w_px = 5,   .glyph_index = 168},    /*Unicode: U+0030 (0)*/
+    {.w_px = 5,   .glyph_index = 184},    /*Unicode: U+0031 (1)*/
+    {.w_px = 5,   .glyph_index = 201},    /*Unicode: U+0032 (2)*/
+    {.w_px = 5,   .glyph_index = 218},    /*Unicode: U+0033 (3)*/
+    {.w_px = 5,   .glyph_index = 234},    /*Unicode: U+0034 (4)*/
+    {.w_px = 5,   .glyph_index = 250},    /*Unicode: U+0035 (5)*/
+    {.w_px = 5,   .glyph_index = 266},    /*Unicode: U+0036 (6)*/
+    {.w_px = 5,   .glyph_index = 281},    /*Unicode: U+0037 (7)*/
+    {.w_px = 5,   .glyph_index = 297},    /*Unicode: U+0038 (8)*/
+    {.w_px = 5,   .glyph_index = 311},    /*Unicode: U+0039 (9)*/
+    {.w_px = 1,   .glyph_index = 326},    /*Unicode: U+003a (:)*/
+    {.w_px = 2,   .glyph_index = 335},    /*Unicode: U+003b (;)*/
+    {.w_px = 4,   .glyph_index = 344},    /*Unicode: U+003c (<)*/
+    {.w_px = 5,   .glyph_index = 353},    /*Unicode: U+003d (=)*/
+    {.w_px = 4,   .glyph_index = 364},    /*Unicode: U+003e (>)*/
+    {.w_px = 6,   .glyph_index = 373},    /*Unicode: U+003f (?)*/
+    {.w_px = 6,   .glyph_index = 389},    /*Unicode: U+0040 (@)*/
+    {.w_px = 6,   .glyph_index = 406},    /*Unicode: U+0041 (A)*/
+    {.w_px = 6,   .glyph_index = 423},    /*Unicode: U+0042 (B)*/
+    {.w_px = 6,   .glyph_index = 440},    /*Unicode: U+0043 (C)*/
+    {.w_px = 6,   .glyph_index = 457},    /*Unicode: U+0044 (D)*/
+    {.w_px = 6,   .glyph_index = 473},    /*Unicode: U+0045 (E)*/
+    {.w_px = 6,   .glyph_index = 490},    /*Unicode: U+0046 (F)*/
+    {.w_px = 6,   .glyph_index = 506},    /*Unicode: U+0047 (G)*/
+    {.w_px = 6,   .glyph_index = 523},    /*Unicode: U+0048 (H)*/
+    {.w_px = 3,   .glyph_index = 540},    /*Unicode: U+0049 (I)*/
+    {.w_px = 5,   .glyph_index = 547},    /*Unicode: U+004a (J)*/
+    {.w_px = 6,   .glyph_index = 563},    /*Unicode: U+004b (K)*/
+    {.w_px = 6,   .glyph_index = 580},    /*Unicode: U+004c (L)*/
+    {.w_px = 6,   .glyph_index = 597},    /*Unicode: U+004d (M)*/
+    {.w_px = 6,   .glyph_index = 614},    /*Unicode: U+004e (N)*/
+    {.w_px = 6,   .glyph_index = 631},    /*Unicode: U+004f (O)*/
+    {.w_px = 6,   .glyph_index = 648},    /*Unicode: U+0050 (P)*/
+    {.w_px = 6,   .glyph_index = 664},    /*Unicode: U+0051 (Q)*/
+    {.w_px = 6,   .glyph_index = 681},    /*Unicode: U+0052 (R)*/
+    {.w_px = 6,   .glyph_index = 698},    /*Unicode: U+0053 (S)*/
+    {.w_px = 5,   .glyph_index = 715},    /*Unicode: U+0054 (T)*/
+    {.w_px = 6,   .glyph_index = 731},    /*Unicode: U+0055 (U)*/
+    {.w_px = 6,   .glyph_index = 748},    /*Unicode: U+0056 (V)*/
+    {.w_px = 6,   .glyph_index = 764},    /*Unicode: U+0057 (W)*/
+    {.w_px = 6,   .glyph_index = 781},    /*Unicode: U+0058 (X)*/
+    {.w_px = 5,   .glyph_index = 798},    /*Unicode: U+0059 (Y)*/
+    {.w_px = 5,   .glyph_index = 810},    /*Unicode: U+005a (Z)*/
+    {.w_px = 3,   .glyph_index = 827},    /*Unicode: U+005b ([)*/
+    {.w_px = 7,   .glyph_index = 834},    /*Unicode: U+005c (\)*/
+    {.w_px = 3,   .glyph_index = 851},    /*Unicode: U+005d (])*/
+    {.w_px = 5,   .glyph_index = 858},    /*Unicode: U+005e (^)*/
+    {.w_px = 5,   .glyph_index = 867},    /*Unicode: U+005f (_)*/
+    {.w_px = 3,   .glyph_index = 872},    /*Unicode: U+0060 (`)*/
+    {.w_px = 5,   .glyph_index = 878},    /*Unicode: U+0061 (a)*/
+    {.w_px = 5,   .glyph_index = 893},    /*Unicode: U+0062 (b)*/
+    {.w_px = 5,   .glyph_index = 906},    /*Unicode: U+0063 (c)*/
+    {.w_px = 5,   .glyph_index = 920},    /*Unicode: U+0064 (d)*/
+    {.w_px = 5,   .glyph_index = 933},    /*Unicode: U+0065 (e)*/
+    {.w_px = 6,   .glyph_index = 947},    /*Unicode: U+0066 (f)*/
+    {.w_px = 5,   .glyph_index = 963},   /*Unicode: U+0067 (g)*/
+    {.w_px = 5,   .glyph_index = 976},   /*Unicode: U+0068 (h)*/
+    {.w_px = 3,   .glyph_index = 988},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 997},   /*Unicode: U+006a (j)*/
+    {.w_px = 5,   .glyph_index = 1006},   /*Unicode: U+006b (k)*/
+    {.w_px = 3,   .glyph_index = 1023},   /*Unicode: U+006c (l)*/
+    {.w_px = 5,   .glyph_index = 1030},   /*Unicode: U+006d (m)*/
+    {.w_px = 5,   .glyph_index = 1045},   /*Unicode: U+006e (n)*/
+    {.w_px = 5,   .glyph_index = 1055},   /*Unicode: U+006f (o)*/
+    {.w_px = 5,   .glyph_index = 1066},   /*Unicode: U+0070 (p)*/
+    {.w_px = 5,   .glyph_index = 1080},   /*Unicode: U+0071 (q)*/
+    {.w_px = 5,   .glyph_index = 1093},   /*Unicode: U+0072 (r)*/
+    {.w_px = 5,   .glyph_index = 1107},   /*Unicode: U+0073 (s)*/
+    {.w_px = 5,   .glyph_index = 1121},   /*Unicode: U+0074 (t)*/
+    {.w_px = 5,   .glyph_index = 1137},   /*Unicode: U+0075 (u)*/
+    {.w_px = 5,   .glyph_index = 1145},   /*Unicode: U+0076 (v)*/
+    {.w_px = 5,   .glyph_index = 1155},   /*Unicode: U+0077 (w)*/
+    {.w_px = 5,   .glyph_index = 1169},   /*Unicode: U+0078 (x)*/
+    {.w_px = 5,   .glyph_index = 1184},   /*Unicode: U+0079 (y)*/
+    {.w_px = 5,   .glyph_index = 1195},   /*Unicode: U+007a (z)*/
+    {.w_px = 4,   .glyph_index = 1210},   /*Unicode: U+007b ({)*/
+    {.w_px = 1,   .glyph_index = 1219},   /*Unicode: U+007c (|)*/
+    {.w_px = 4,   .glyph_index = 1221},   /*Unicode: U+007d (})*/
+    {.w_px = 5,   .glyph_index = 1230},   /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_MONOSPACE_8 == 4
     {.w_px = 3,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 1,   .glyph_index = 16}, /*Unicode: U+0021 (!)*/
-    {.w_px = 4,   .glyph_index = 24}, /*Unicode: U+0022 (")*/
-    {.w_px = 6,   .glyph_index = 40}, /*Unicode: U+0023 (#)*/
-    {.w_px = 5,   .glyph_index = 64}, /*Unicode: U+0024 ($)*/
-    {.w_px = 6,   .glyph_index = 88}, /*Unicode: U+0025 (%)*/
-    {.w_px = 6,   .glyph_index = 112},    /*Unicode: U+0026 (&)*/
-    {.w_px = 3,   .glyph_index = 136},    /*Unicode: U+0027 (')*/
-    {.w_px = 3,   .glyph_index = 152},    /*Unicode: U+0028 (()*/
-    {.w_px = 3,   .glyph_index = 168},    /*Unicode: U+0029 ())*/
-    {.w_px = 5,   .glyph_index = 184},    /*Unicode: U+002a (*)*/
-    {.w_px = 5,   .glyph_index = 208},    /*Unicode: U+002b (+)*/
-    {.w_px = 2,   .glyph_index = 232},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 240},    /*Unicode: U+002d (-)*/
-    {.w_px = 1,   .glyph_index = 264},    /*Unicode: U+002e (.)*/
-    {.w_px = 7,   .glyph_index = 272},    /*Unicode: U+002f (/)*/
-    {.w_px = 5,   .glyph_index = 304},    /*Unicode: U+0030 (0)*/
-    {.w_px = 5,   .glyph_index = 328},    /*Unicode: U+0031 (1)*/
-    {.w_px = 5,   .glyph_index = 352},    /*Unicode: U+0032 (2)*/
-    {.w_px = 5,   .glyph_index = 376},    /*Unicode: U+0033 (3)*/
-    {.w_px = 5,   .glyph_index = 400},    /*Unicode: U+0034 (4)*/
-    {.w_px = 5,   .glyph_index = 424},    /*Unicode: U+0035 (5)*/
-    {.w_px = 5,   .glyph_index = 448},    /*Unicode: U+0036 (6)*/
-    {.w_px = 5,   .glyph_index = 472},    /*Unicode: U+0037 (7)*/
-    {.w_px = 5,   .glyph_index = 496},    /*Unicode: U+0038 (8)*/
-    {.w_px = 5,   .glyph_index = 520},    /*Unicode: U+0039 (9)*/
-    {.w_px = 1,   .glyph_index = 544},    /*Unicode: U+003a (:)*/
-    {.w_px = 2,   .glyph_index = 552},    /*Unicode: U+003b (;)*/
-    {.w_px = 4,   .glyph_index = 560},    /*Unicode: U+003c (<)*/
-    {.w_px = 5,   .glyph_index = 576},    /*Unicode: U+003d (=)*/
-    {.w_px = 4,   .glyph_index = 600},    /*Unicode: U+003e (>)*/
-    {.w_px = 6,   .glyph_index = 616},    /*Unicode: U+003f (?)*/
-    {.w_px = 6,   .glyph_index = 640},    /*Unicode: U+0040 (@)*/
-    {.w_px = 6,   .glyph_index = 664},    /*Unicode: U+0041 (A)*/
-    {.w_px = 6,   .glyph_index = 688},    /*Unicode: U+0042 (B)*/
-    {.w_px = 6,   .glyph_index = 712},    /*Unicode: U+0043 (C)*/
-    {.w_px = 6,   .glyph_index = 736},    /*Unicode: U+0044 (D)*/
-    {.w_px = 6,   .glyph_index = 760},    /*Unicode: U+0045 (E)*/
-    {.w_px = 6,   .glyph_index = 784},    /*Unicode: U+0046 (F)*/
-    {.w_px = 6,   .glyph_index = 808},    /*Unicode: U+0047 (G)*/
-    {.w_px = 6,   .glyph_index = 832},    /*Unicode: U+0048 (H)*/
-    {.w_px = 3,   .glyph_index = 856},    /*Unicode: U+0049 (I)*/
-    {.w_px = 5,   .glyph_index = 872},    /*Unicode: U+004a (J)*/
-    {.w_px = 6,   .glyph_index = 896},    /*Unicode: U+004b (K)*/
-    {.w_px = 6,   .glyph_index = 920},    /*Unicode: U+004c (L)*/
-    {.w_px = 6,   .glyph_index = 944},    /*Unicode: U+004d (M)*/
-    {.w_px = 6,   .glyph_index = 968},    /*Unicode: U+004e (N)*/
-    {.w_px = 6,   .glyph_index = 992},    /*Unicode: U+004f (O)*/
-    {.w_px = 6,   .glyph_index = 1016},   /*Unicode: U+0050 (P)*/
-    {.w_px = 6,   .glyph_index = 1040},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 6,   .glyph_index = 1064},   /*Unicode: U+0052 (R)*/
-    {.w_px = 6,   .glyph_index = 1088},   /*Unicode: U+0053 (S)*/
-    {.w_px = 5,   .glyph_index = 1112},   /*Unicode: U+0054 (T)*/
-    {.w_px = 6,   .glyph_index = 1136},   /*Unicode: U+0055 (U)*/
-    {.w_px = 6,   .glyph_index = 1160},   /*Unicode: U+0056 (V)*/
-    {.w_px = 6,   .glyph_index = 1184},   /*Unicode: U+0057 (W)*/
-    {.w_px = 6,   .glyph_index = 1208},   /*Unicode: U+0058 (X)*/
-    {.w_px = 5,   .glyph_index = 1232},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 5,   .glyph_index = 1256},   /*Unicode: U+005a (Z)*/
-    {.w_px = 3,   .glyph_index = 1280},   /*Unicode: U+005b ([)*/
-    {.w_px = 7,   .glyph_index = 1296},   /*Unicode: U+005c (\)*/
-    {.w_px = 3,   .glyph_index = 1328},   /*Unicode: U+005d (])*/
-    {.w_px = 5,   .glyph_index = 1344},   /*Unicode: U+005e (^)*/
-    {.w_px = 5,   .glyph_index = 1368},   /*Unicode: U+005f (_)*/
-    {.w_px = 3,   .glyph_index = 1392},   /*Unicode: U+0060 (`)*/
-    {.w_px = 5,   .glyph_index = 1408},   /*Unicode: U+0061 (a)*/
-    {.w_px = 5,   .glyph_index = 1432},   /*Unicode: U+0062 (b)*/
-    {.w_px = 5,   .glyph_index = 1456},   /*Unicode: U+0063 (c)*/
-    {.w_px = 5,   .glyph_index = 1480},   /*Unicode: U+0064 (d)*/
-    {.w_px = 5,   .glyph_index = 1504},   /*Unicode: U+0065 (e)*/
-    {.w_px = 6,   .glyph_index = 1528},   /*Unicode: U+0066 (f)*/
-    {.w_px = 5,   .glyph_index = 1552},   /*Unicode: U+0067 (g)*/
-    {.w_px = 5,   .glyph_index = 1576},   /*Unicode: U+0068 (h)*/
-    {.w_px = 3,   .glyph_index = 1600},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 1616},   /*Unicode: U+006a (j)*/
-    {.w_px = 5,   .glyph_index = 1632},   /*Unicode: U+006b (k)*/
-    {.w_px = 3,   .glyph_index = 1656},   /*Unicode: U+006c (l)*/
-    {.w_px = 5,   .glyph_index = 1672},   /*Unicode: U+006d (m)*/
-    {.w_px = 5,   .glyph_index = 1696},   /*Unicode: U+006e (n)*/
-    {.w_px = 5,   .glyph_index = 1720},   /*Unicode: U+006f (o)*/
-    {.w_px = 5,   .glyph_index = 1744},   /*Unicode: U+0070 (p)*/
-    {.w_px = 5,   .glyph_index = 1768},   /*Unicode: U+0071 (q)*/
-    {.w_px = 5,   .glyph_index = 1792},   /*Unicode: U+0072 (r)*/
-    {.w_px = 5,   .glyph_index = 1816},   /*Unicode: U+0073 (s)*/
-    {.w_px = 5,   .glyph_index = 1840},   /*Unicode: U+0074 (t)*/
-    {.w_px = 5,   .glyph_index = 1864},   /*Unicode: U+0075 (u)*/
-    {.w_px = 5,   .glyph_index = 1888},   /*Unicode: U+0076 (v)*/
-    {.w_px = 5,   .glyph_index = 1912},   /*Unicode: U+0077 (w)*/
-    {.w_px = 5,   .glyph_index = 1936},   /*Unicode: U+0078 (x)*/
-    {.w_px = 5,   .glyph_index = 1960},   /*Unicode: U+0079 (y)*/
-    {.w_px = 5,   .glyph_index = 1984},   /*Unicode: U+007a (z)*/
-    {.w_px = 4,   .glyph_index = 2008},   /*Unicode: U+007b ({)*/
-    {.w_px = 1,   .glyph_index = 2024},   /*Unicode: U+007c (|)*/
-    {.w_px = 4,   .glyph_index = 2032},   /*Unicode: U+007d (})*/
-    {.w_px = 5,   .glyph_index = 2048},   /*Unicode: U+007e (~)*/
+    {.w_px = 1,   .glyph_index = 2}, /*Unicode: U+0021 (!)*/
+    {.w_px = 4,   .glyph_index = 9}, /*Unicode: U+0022 (")*/
+    {.w_px = 6,   .glyph_index = 18}, /*Unicode: U+0023 (#)*/
+    {.w_px = 5,   .glyph_index = 42}, /*Unicode: U+0024 ($)*/
+    {.w_px = 6,   .glyph_index = 65}, /*Unicode: U+0025 (%)*/
+    {.w_px = 6,   .glyph_index = 88},    /*Unicode: U+0026 (&)*/
+    {.w_px = 3,   .glyph_index = 112},    /*Unicode: U+0027 (')*/
+    {.w_px = 3,   .glyph_index = 120},    /*Unicode: U+0028 (()*/
+    {.w_px = 3,   .glyph_index = 137},    /*Unicode: U+0029 ())*/
+    {.w_px = 5,   .glyph_index = 153},    /*Unicode: U+002a (*)*/
+    {.w_px = 5,   .glyph_index = 176},    /*Unicode: U+002b (+)*/
+    {.w_px = 2,   .glyph_index = 194},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 200},    /*Unicode: U+002d (-)*/
+    {.w_px = 1,   .glyph_index = 208},    /*Unicode: U+002e (.)*/
+    {.w_px = 7,   .glyph_index = 213},    /*Unicode: U+002f (/)*/
+    {.w_px = 5,   .glyph_index = 240},    /*Unicode: U+0030 (0)*/
+    {.w_px = 5,   .glyph_index = 262},    /*Unicode: U+0031 (1)*/
+    {.w_px = 5,   .glyph_index = 286},    /*Unicode: U+0032 (2)*/
+    {.w_px = 5,   .glyph_index = 310},    /*Unicode: U+0033 (3)*/
+    {.w_px = 5,   .glyph_index = 333},    /*Unicode: U+0034 (4)*/
+    {.w_px = 5,   .glyph_index = 356},    /*Unicode: U+0035 (5)*/
+    {.w_px = 5,   .glyph_index = 379},    /*Unicode: U+0036 (6)*/
+    {.w_px = 5,   .glyph_index = 402},    /*Unicode: U+0037 (7)*/
+    {.w_px = 5,   .glyph_index = 424},    /*Unicode: U+0038 (8)*/
+    {.w_px = 5,   .glyph_index = 447},    /*Unicode: U+0039 (9)*/
+    {.w_px = 1,   .glyph_index = 470},    /*Unicode: U+003a (:)*/
+    {.w_px = 2,   .glyph_index = 479},    /*Unicode: U+003b (;)*/
+    {.w_px = 4,   .glyph_index = 488},    /*Unicode: U+003c (<)*/
+    {.w_px = 5,   .glyph_index = 505},    /*Unicode: U+003d (=)*/
+    {.w_px = 4,   .glyph_index = 519},    /*Unicode: U+003e (>)*/
+    {.w_px = 6,   .glyph_index = 535},    /*Unicode: U+003f (?)*/
+    {.w_px = 6,   .glyph_index = 556},    /*Unicode: U+0040 (@)*/
+    {.w_px = 6,   .glyph_index = 580},    /*Unicode: U+0041 (A)*/
+    {.w_px = 6,   .glyph_index = 604},    /*Unicode: U+0042 (B)*/
+    {.w_px = 6,   .glyph_index = 628},    /*Unicode: U+0043 (C)*/
+    {.w_px = 6,   .glyph_index = 652},    /*Unicode: U+0044 (D)*/
+    {.w_px = 6,   .glyph_index = 675},    /*Unicode: U+0045 (E)*/
+    {.w_px = 6,   .glyph_index = 697},    /*Unicode: U+0046 (F)*/
+    {.w_px = 6,   .glyph_index = 718},    /*Unicode: U+0047 (G)*/
+    {.w_px = 6,   .glyph_index = 742},    /*Unicode: U+0048 (H)*/
+    {.w_px = 3,   .glyph_index = 766},    /*Unicode: U+0049 (I)*/
+    {.w_px = 5,   .glyph_index = 783},    /*Unicode: U+004a (J)*/
+    {.w_px = 6,   .glyph_index = 806},    /*Unicode: U+004b (K)*/
+    {.w_px = 6,   .glyph_index = 830},    /*Unicode: U+004c (L)*/
+    {.w_px = 6,   .glyph_index = 853},    /*Unicode: U+004d (M)*/
+    {.w_px = 6,   .glyph_index = 877},    /*Unicode: U+004e (N)*/
+    {.w_px = 6,   .glyph_index = 901},    /*Unicode: U+004f (O)*/
+    {.w_px = 6,   .glyph_index = 925},   /*Unicode: U+0050 (P)*/
+    {.w_px = 6,   .glyph_index = 947},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 6,   .glyph_index = 971},   /*Unicode: U+0052 (R)*/
+    {.w_px = 6,   .glyph_index = 995},   /*Unicode: U+0053 (S)*/
+    {.w_px = 5,   .glyph_index = 1019},   /*Unicode: U+0054 (T)*/
+    {.w_px = 6,   .glyph_index = 1042},   /*Unicode: U+0055 (U)*/
+    {.w_px = 6,   .glyph_index = 1066},   /*Unicode: U+0056 (V)*/
+    {.w_px = 6,   .glyph_index = 1089},   /*Unicode: U+0057 (W)*/
+    {.w_px = 6,   .glyph_index = 1113},   /*Unicode: U+0058 (X)*/
+    {.w_px = 5,   .glyph_index = 1137},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 5,   .glyph_index = 1160},   /*Unicode: U+005a (Z)*/
+    {.w_px = 3,   .glyph_index = 1184},   /*Unicode: U+005b ([)*/
+    {.w_px = 7,   .glyph_index = 1201},   /*Unicode: U+005c (\)*/
+    {.w_px = 3,   .glyph_index = 1229},   /*Unicode: U+005d (])*/
+    {.w_px = 5,   .glyph_index = 1246},   /*Unicode: U+005e (^)*/
+    {.w_px = 5,   .glyph_index = 1258},   /*Unicode: U+005f (_)*/
+    {.w_px = 3,   .glyph_index = 1264},   /*Unicode: U+0060 (`)*/
+    {.w_px = 5,   .glyph_index = 1273},   /*Unicode: U+0061 (a)*/
+    {.w_px = 5,   .glyph_index = 1293},   /*Unicode: U+0062 (b)*/
+    {.w_px = 5,   .glyph_index = 1316},   /*Unicode: U+0063 (c)*/
+    {.w_px = 5,   .glyph_index = 1335},   /*Unicode: U+0064 (d)*/
+    {.w_px = 5,   .glyph_index = 1359},   /*Unicode: U+0065 (e)*/
+    {.w_px = 6,   .glyph_index = 1378},   /*Unicode: U+0066 (f)*/
+    {.w_px = 5,   .glyph_index = 1401},   /*Unicode: U+0067 (g)*/
+    {.w_px = 5,   .glyph_index = 1422},   /*Unicode: U+0068 (h)*/
+    {.w_px = 3,   .glyph_index = 1446},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 1463},   /*Unicode: U+006a (j)*/
+    {.w_px = 5,   .glyph_index = 1480},   /*Unicode: U+006b (k)*/
+    {.w_px = 3,   .glyph_index = 1504},   /*Unicode: U+006c (l)*/
+    {.w_px = 5,   .glyph_index = 1521},   /*Unicode: U+006d (m)*/
+    {.w_px = 5,   .glyph_index = 1531},   /*Unicode: U+006e (n)*/
+    {.w_px = 5,   .glyph_index = 1551},   /*Unicode: U+006f (o)*/
+    {.w_px = 5,   .glyph_index = 1570},   /*Unicode: U+0070 (p)*/
+    {.w_px = 5,   .glyph_index = 1591},   /*Unicode: U+0071 (q)*/
+    {.w_px = 5,   .glyph_index = 1612},   /*Unicode: U+0072 (r)*/
+    {.w_px = 5,   .glyph_index = 1630},   /*Unicode: U+0073 (s)*/
+    {.w_px = 5,   .glyph_index = 1649},   /*Unicode: U+0074 (t)*/
+    {.w_px = 5,   .glyph_index = 1672},   /*Unicode: U+0075 (u)*/
+    {.w_px = 5,   .glyph_index = 1691},   /*Unicode: U+0076 (v)*/
+    {.w_px = 5,   .glyph_index = 1710},   /*Unicode: U+0077 (w)*/
+    {.w_px = 5,   .glyph_index = 1722},   /*Unicode: U+0078 (x)*/
+    {.w_px = 5,   .glyph_index = 1742},   /*Unicode: U+0079 (y)*/
+    {.w_px = 5,   .glyph_index = 1763},   /*Unicode: U+007a (z)*/
+    {.w_px = 4,   .glyph_index = 1783},   /*Unicode: U+007b ({)*/
+    {.w_px = 1,   .glyph_index = 1800},   /*Unicode: U+007c (|)*/
+    {.w_px = 4,   .glyph_index = 1802},   /*Unicode: U+007d (})*/
+    {.w_px = 5,   .glyph_index = 1818},   /*Unicode: U+007e (~)*/
 
 #elif USE_LV_FONT_MONOSPACE_8 == 8
     {.w_px = 3,   .glyph_index = 0},  /*Unicode: U+0020 ( )*/
-    {.w_px = 1,   .glyph_index = 24}, /*Unicode: U+0021 (!)*/
-    {.w_px = 4,   .glyph_index = 32}, /*Unicode: U+0022 (")*/
-    {.w_px = 6,   .glyph_index = 64}, /*Unicode: U+0023 (#)*/
-    {.w_px = 5,   .glyph_index = 112},    /*Unicode: U+0024 ($)*/
-    {.w_px = 6,   .glyph_index = 152},    /*Unicode: U+0025 (%)*/
-    {.w_px = 6,   .glyph_index = 200},    /*Unicode: U+0026 (&)*/
-    {.w_px = 3,   .glyph_index = 248},    /*Unicode: U+0027 (')*/
-    {.w_px = 3,   .glyph_index = 272},    /*Unicode: U+0028 (()*/
-    {.w_px = 3,   .glyph_index = 296},    /*Unicode: U+0029 ())*/
-    {.w_px = 5,   .glyph_index = 320},    /*Unicode: U+002a (*)*/
-    {.w_px = 5,   .glyph_index = 360},    /*Unicode: U+002b (+)*/
-    {.w_px = 2,   .glyph_index = 400},    /*Unicode: U+002c (,)*/
-    {.w_px = 5,   .glyph_index = 416},    /*Unicode: U+002d (-)*/
-    {.w_px = 1,   .glyph_index = 456},    /*Unicode: U+002e (.)*/
-    {.w_px = 7,   .glyph_index = 464},    /*Unicode: U+002f (/)*/
-    {.w_px = 5,   .glyph_index = 520},    /*Unicode: U+0030 (0)*/
-    {.w_px = 5,   .glyph_index = 560},    /*Unicode: U+0031 (1)*/
-    {.w_px = 5,   .glyph_index = 600},    /*Unicode: U+0032 (2)*/
-    {.w_px = 5,   .glyph_index = 640},    /*Unicode: U+0033 (3)*/
-    {.w_px = 5,   .glyph_index = 680},    /*Unicode: U+0034 (4)*/
-    {.w_px = 5,   .glyph_index = 720},    /*Unicode: U+0035 (5)*/
-    {.w_px = 5,   .glyph_index = 760},    /*Unicode: U+0036 (6)*/
-    {.w_px = 5,   .glyph_index = 800},    /*Unicode: U+0037 (7)*/
-    {.w_px = 5,   .glyph_index = 840},    /*Unicode: U+0038 (8)*/
-    {.w_px = 5,   .glyph_index = 880},    /*Unicode: U+0039 (9)*/
-    {.w_px = 1,   .glyph_index = 920},    /*Unicode: U+003a (:)*/
-    {.w_px = 2,   .glyph_index = 928},    /*Unicode: U+003b (;)*/
-    {.w_px = 4,   .glyph_index = 944},    /*Unicode: U+003c (<)*/
-    {.w_px = 5,   .glyph_index = 976},    /*Unicode: U+003d (=)*/
-    {.w_px = 4,   .glyph_index = 1016},   /*Unicode: U+003e (>)*/
-    {.w_px = 6,   .glyph_index = 1048},   /*Unicode: U+003f (?)*/
-    {.w_px = 6,   .glyph_index = 1096},   /*Unicode: U+0040 (@)*/
-    {.w_px = 6,   .glyph_index = 1144},   /*Unicode: U+0041 (A)*/
-    {.w_px = 6,   .glyph_index = 1192},   /*Unicode: U+0042 (B)*/
-    {.w_px = 6,   .glyph_index = 1240},   /*Unicode: U+0043 (C)*/
-    {.w_px = 6,   .glyph_index = 1288},   /*Unicode: U+0044 (D)*/
-    {.w_px = 6,   .glyph_index = 1336},   /*Unicode: U+0045 (E)*/
-    {.w_px = 6,   .glyph_index = 1384},   /*Unicode: U+0046 (F)*/
-    {.w_px = 6,   .glyph_index = 1432},   /*Unicode: U+0047 (G)*/
-    {.w_px = 6,   .glyph_index = 1480},   /*Unicode: U+0048 (H)*/
-    {.w_px = 3,   .glyph_index = 1528},   /*Unicode: U+0049 (I)*/
-    {.w_px = 5,   .glyph_index = 1552},   /*Unicode: U+004a (J)*/
-    {.w_px = 6,   .glyph_index = 1592},   /*Unicode: U+004b (K)*/
-    {.w_px = 6,   .glyph_index = 1640},   /*Unicode: U+004c (L)*/
-    {.w_px = 6,   .glyph_index = 1688},   /*Unicode: U+004d (M)*/
-    {.w_px = 6,   .glyph_index = 1736},   /*Unicode: U+004e (N)*/
-    {.w_px = 6,   .glyph_index = 1784},   /*Unicode: U+004f (O)*/
-    {.w_px = 6,   .glyph_index = 1832},   /*Unicode: U+0050 (P)*/
-    {.w_px = 6,   .glyph_index = 1880},   /*Unicode: U+0051 (Q)*/
-    {.w_px = 6,   .glyph_index = 1928},   /*Unicode: U+0052 (R)*/
-    {.w_px = 6,   .glyph_index = 1976},   /*Unicode: U+0053 (S)*/
-    {.w_px = 5,   .glyph_index = 2024},   /*Unicode: U+0054 (T)*/
-    {.w_px = 6,   .glyph_index = 2064},   /*Unicode: U+0055 (U)*/
-    {.w_px = 6,   .glyph_index = 2112},   /*Unicode: U+0056 (V)*/
-    {.w_px = 6,   .glyph_index = 2160},   /*Unicode: U+0057 (W)*/
-    {.w_px = 6,   .glyph_index = 2208},   /*Unicode: U+0058 (X)*/
-    {.w_px = 5,   .glyph_index = 2256},   /*Unicode: U+0059 (Y)*/
-    {.w_px = 5,   .glyph_index = 2296},   /*Unicode: U+005a (Z)*/
-    {.w_px = 3,   .glyph_index = 2336},   /*Unicode: U+005b ([)*/
-    {.w_px = 7,   .glyph_index = 2360},   /*Unicode: U+005c (\)*/
-    {.w_px = 3,   .glyph_index = 2416},   /*Unicode: U+005d (])*/
-    {.w_px = 5,   .glyph_index = 2440},   /*Unicode: U+005e (^)*/
-    {.w_px = 5,   .glyph_index = 2480},   /*Unicode: U+005f (_)*/
-    {.w_px = 3,   .glyph_index = 2520},   /*Unicode: U+0060 (`)*/
-    {.w_px = 5,   .glyph_index = 2544},   /*Unicode: U+0061 (a)*/
-    {.w_px = 5,   .glyph_index = 2584},   /*Unicode: U+0062 (b)*/
-    {.w_px = 5,   .glyph_index = 2624},   /*Unicode: U+0063 (c)*/
-    {.w_px = 5,   .glyph_index = 2664},   /*Unicode: U+0064 (d)*/
-    {.w_px = 5,   .glyph_index = 2704},   /*Unicode: U+0065 (e)*/
-    {.w_px = 6,   .glyph_index = 2744},   /*Unicode: U+0066 (f)*/
-    {.w_px = 5,   .glyph_index = 2792},   /*Unicode: U+0067 (g)*/
-    {.w_px = 5,   .glyph_index = 2832},   /*Unicode: U+0068 (h)*/
-    {.w_px = 3,   .glyph_index = 2872},   /*Unicode: U+0069 (i)*/
-    {.w_px = 4,   .glyph_index = 2896},   /*Unicode: U+006a (j)*/
-    {.w_px = 5,   .glyph_index = 2928},   /*Unicode: U+006b (k)*/
-    {.w_px = 3,   .glyph_index = 2968},   /*Unicode: U+006c (l)*/
-    {.w_px = 5,   .glyph_index = 2992},   /*Unicode: U+006d (m)*/
-    {.w_px = 5,   .glyph_index = 3032},   /*Unicode: U+006e (n)*/
-    {.w_px = 5,   .glyph_index = 3072},   /*Unicode: U+006f (o)*/
-    {.w_px = 5,   .glyph_index = 3112},   /*Unicode: U+0070 (p)*/
-    {.w_px = 5,   .glyph_index = 3152},   /*Unicode: U+0071 (q)*/
-    {.w_px = 5,   .glyph_index = 3192},   /*Unicode: U+0072 (r)*/
-    {.w_px = 5,   .glyph_index = 3232},   /*Unicode: U+0073 (s)*/
-    {.w_px = 5,   .glyph_index = 3272},   /*Unicode: U+0074 (t)*/
-    {.w_px = 5,   .glyph_index = 3312},   /*Unicode: U+0075 (u)*/
-    {.w_px = 5,   .glyph_index = 3352},   /*Unicode: U+0076 (v)*/
-    {.w_px = 5,   .glyph_index = 3392},   /*Unicode: U+0077 (w)*/
-    {.w_px = 5,   .glyph_index = 3432},   /*Unicode: U+0078 (x)*/
-    {.w_px = 5,   .glyph_index = 3472},   /*Unicode: U+0079 (y)*/
-    {.w_px = 5,   .glyph_index = 3512},   /*Unicode: U+007a (z)*/
-    {.w_px = 4,   .glyph_index = 3552},   /*Unicode: U+007b ({)*/
-    {.w_px = 1,   .glyph_index = 3584},   /*Unicode: U+007c (|)*/
-    {.w_px = 4,   .glyph_index = 3592},   /*Unicode: U+007d (})*/
-    {.w_px = 5,   .glyph_index = 3624},   /*Unicode: U+007e (~)*/
+    {.w_px = 1,   .glyph_index = 2}, /*Unicode: U+0021 (!)*/
+    {.w_px = 4,   .glyph_index = 9}, /*Unicode: U+0022 (")*/
+    {.w_px = 6,   .glyph_index = 24}, /*Unicode: U+0023 (#)*/
+    {.w_px = 5,   .glyph_index = 62},    /*Unicode: U+0024 ($)*/
+    {.w_px = 6,   .glyph_index = 90},    /*Unicode: U+0025 (%)*/
+    {.w_px = 6,   .glyph_index = 126},    /*Unicode: U+0026 (&)*/
+    {.w_px = 3,   .glyph_index = 171},    /*Unicode: U+0027 (')*/
+    {.w_px = 3,   .glyph_index = 181},    /*Unicode: U+0028 (()*/
+    {.w_px = 3,   .glyph_index = 205},    /*Unicode: U+0029 ())*/
+    {.w_px = 5,   .glyph_index = 227},    /*Unicode: U+002a (*)*/
+    {.w_px = 5,   .glyph_index = 261},    /*Unicode: U+002b (+)*/
+    {.w_px = 2,   .glyph_index = 283},    /*Unicode: U+002c (,)*/
+    {.w_px = 5,   .glyph_index = 291},    /*Unicode: U+002d (-)*/
+    {.w_px = 1,   .glyph_index = 297},    /*Unicode: U+002e (.)*/
+    {.w_px = 7,   .glyph_index = 302},    /*Unicode: U+002f (/)*/
+    {.w_px = 5,   .glyph_index = 332},    /*Unicode: U+0030 (0)*/
+    {.w_px = 5,   .glyph_index = 368},    /*Unicode: U+0031 (1)*/
+    {.w_px = 5,   .glyph_index = 400},    /*Unicode: U+0032 (2)*/
+    {.w_px = 5,   .glyph_index = 432},    /*Unicode: U+0033 (3)*/
+    {.w_px = 5,   .glyph_index = 465},    /*Unicode: U+0034 (4)*/
+    {.w_px = 5,   .glyph_index = 497},    /*Unicode: U+0035 (5)*/
+    {.w_px = 5,   .glyph_index = 521},    /*Unicode: U+0036 (6)*/
+    {.w_px = 5,   .glyph_index = 554},    /*Unicode: U+0037 (7)*/
+    {.w_px = 5,   .glyph_index = 582},    /*Unicode: U+0038 (8)*/
+    {.w_px = 5,   .glyph_index = 618},    /*Unicode: U+0039 (9)*/
+    {.w_px = 1,   .glyph_index = 650},    /*Unicode: U+003a (:)*/
+    {.w_px = 2,   .glyph_index = 659},    /*Unicode: U+003b (;)*/
+    {.w_px = 4,   .glyph_index = 671},    /*Unicode: U+003c (<)*/
+    {.w_px = 5,   .glyph_index = 698},    /*Unicode: U+003d (=)*/
+    {.w_px = 4,   .glyph_index = 708},   /*Unicode: U+003e (>)*/
+    {.w_px = 6,   .glyph_index = 733},   /*Unicode: U+003f (?)*/
+    {.w_px = 6,   .glyph_index = 762},   /*Unicode: U+0040 (@)*/
+    {.w_px = 6,   .glyph_index = 798},   /*Unicode: U+0041 (A)*/
+    {.w_px = 6,   .glyph_index = 832},   /*Unicode: U+0042 (B)*/
+    {.w_px = 6,   .glyph_index = 860},   /*Unicode: U+0043 (C)*/
+    {.w_px = 6,   .glyph_index = 893},   /*Unicode: U+0044 (D)*/
+    {.w_px = 6,   .glyph_index = 929},   /*Unicode: U+0045 (E)*/
+    {.w_px = 6,   .glyph_index = 953},   /*Unicode: U+0046 (F)*/
+    {.w_px = 6,   .glyph_index = 977},   /*Unicode: U+0047 (G)*/
+    {.w_px = 6,   .glyph_index = 1011},   /*Unicode: U+0048 (H)*/
+    {.w_px = 3,   .glyph_index = 1043},   /*Unicode: U+0049 (I)*/
+    {.w_px = 5,   .glyph_index = 1065},   /*Unicode: U+004a (J)*/
+    {.w_px = 6,   .glyph_index = 1095},   /*Unicode: U+004b (K)*/
+    {.w_px = 6,   .glyph_index = 1137},   /*Unicode: U+004c (L)*/
+    {.w_px = 6,   .glyph_index = 1165},   /*Unicode: U+004d (M)*/
+    {.w_px = 6,   .glyph_index = 1204},   /*Unicode: U+004e (N)*/
+    {.w_px = 6,   .glyph_index = 1242},   /*Unicode: U+004f (O)*/
+    {.w_px = 6,   .glyph_index = 1278},   /*Unicode: U+0050 (P)*/
+    {.w_px = 6,   .glyph_index = 1305},   /*Unicode: U+0051 (Q)*/
+    {.w_px = 6,   .glyph_index = 1346},   /*Unicode: U+0052 (R)*/
+    {.w_px = 6,   .glyph_index = 1381},   /*Unicode: U+0053 (S)*/
+    {.w_px = 5,   .glyph_index = 1411},   /*Unicode: U+0054 (T)*/
+    {.w_px = 6,   .glyph_index = 1439},   /*Unicode: U+0055 (U)*/
+    {.w_px = 6,   .glyph_index = 1475},   /*Unicode: U+0056 (V)*/
+    {.w_px = 6,   .glyph_index = 1513},   /*Unicode: U+0057 (W)*/
+    {.w_px = 6,   .glyph_index = 1552},   /*Unicode: U+0058 (X)*/
+    {.w_px = 5,   .glyph_index = 1593},   /*Unicode: U+0059 (Y)*/
+    {.w_px = 5,   .glyph_index = 1626},   /*Unicode: U+005a (Z)*/
+    {.w_px = 3,   .glyph_index = 1654},   /*Unicode: U+005b ([)*/
+    {.w_px = 7,   .glyph_index = 1675},   /*Unicode: U+005c (\)*/
+    {.w_px = 3,   .glyph_index = 1703},   /*Unicode: U+005d (])*/
+    {.w_px = 5,   .glyph_index = 1724},   /*Unicode: U+005e (^)*/
+    {.w_px = 5,   .glyph_index = 1742},   /*Unicode: U+005f (_)*/
+    {.w_px = 3,   .glyph_index = 1746},   /*Unicode: U+0060 (`)*/
+    {.w_px = 5,   .glyph_index = 1758},   /*Unicode: U+0061 (a)*/
+    {.w_px = 5,   .glyph_index = 1778},   /*Unicode: U+0062 (b)*/
+    {.w_px = 5,   .glyph_index = 1807},   /*Unicode: U+0063 (c)*/
+    {.w_px = 5,   .glyph_index = 1832},   /*Unicode: U+0064 (d)*/
+    {.w_px = 5,   .glyph_index = 1862},   /*Unicode: U+0065 (e)*/
+    {.w_px = 6,   .glyph_index = 1879},   /*Unicode: U+0066 (f)*/
+    {.w_px = 5,   .glyph_index = 1912},   /*Unicode: U+0067 (g)*/
+    {.w_px = 5,   .glyph_index = 1937},   /*Unicode: U+0068 (h)*/
+    {.w_px = 3,   .glyph_index = 1971},   /*Unicode: U+0069 (i)*/
+    {.w_px = 4,   .glyph_index = 1993},   /*Unicode: U+006a (j)*/
+    {.w_px = 5,   .glyph_index = 2022},   /*Unicode: U+006b (k)*/
+    {.w_px = 3,   .glyph_index = 2058},   /*Unicode: U+006c (l)*/
+    {.w_px = 5,   .glyph_index = 2081},   /*Unicode: U+006d (m)*/
+    {.w_px = 5,   .glyph_index = 2111},   /*Unicode: U+006e (n)*/
+    {.w_px = 5,   .glyph_index = 2139},   /*Unicode: U+006f (o)*/
+    {.w_px = 5,   .glyph_index = 2165},   /*Unicode: U+0070 (p)*/
+    {.w_px = 5,   .glyph_index = 2190},   /*Unicode: U+0071 (q)*/
+    {.w_px = 5,   .glyph_index = 2214},   /*Unicode: U+0072 (r)*/
+    {.w_px = 5,   .glyph_index = 2235},   /*Unicode: U+0073 (s)*/
+    {.w_px = 5,   .glyph_index = 2249},   /*Unicode: U+0074 (t)*/
+    {.w_px = 5,   .glyph_index = 2281},   /*Unicode: U+0075 (u)*/
+    {.w_px = 5,   .glyph_index = 2309},   /*Unicode: U+0076 (v)*/
+    {.w_px = 5,   .glyph_index = 2337},   /*Unicode: U+0077 (w)*/
+    {.w_px = 5,   .glyph_index = 2366},   /*Unicode: U+0078 (x)*/
+    {.w_px = 5,   .glyph_index = 2396},   /*Unicode: U+0079 (y)*/
+    {.w_px = 5,   .glyph_index = 2426},   /*Unicode: U+007a (z)*/
+    {.w_px = 4,   .glyph_index = 2448},   /*Unicode: U+007b ({)*/
+    {.w_px = 1,   .glyph_index = 2477},   /*Unicode: U+007c (|)*/
+    {.w_px = 4,   .glyph_index = 2479},   /*Unicode: U+007d (})*/
+    {.w_px = 5,   .glyph_index = 2506},   /*Unicode: U+007e (~)*/
 
 #endif
 };
@@ -4614,6 +1779,7 @@ lv_font_t lv_font_monospace_8 = {
 #endif
     .monospace = 6,     /*Fix width (0: if not used)*/
     .next_page = NULL,      /*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_LV_FONT_MONOSPACE_8*/
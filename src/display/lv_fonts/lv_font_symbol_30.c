@@ -12,6611 +12,2749 @@
 static const uint8_t lv_font_symbol_30_glyph_bitmap[] = {
 #if USE_LV_FONT_SYMBOL_30 == 1
     /*Unicode: U+f001 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x03, 0x00,  //.....................+%%+
-    0x00, 0x00, 0x1f, 0x80,  //..................+%@@@@@
-    0x00, 0x00, 0xff, 0x80,  //...............+@@@@@@@@@
-    0x00, 0x0f, 0xff, 0x80,  //...........+%@@@@@@@@@@@@
-    0x00, 0x7f, 0xff, 0x80,  //.........%@@@@@@@@@@@@@@@
-    0x00, 0xff, 0xff, 0x80,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0xff, 0xff, 0x80,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0xff, 0xff, 0x80,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0xff, 0xff, 0x80,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0xff, 0xf1, 0x80,  //........@@@@@@@@@@@%+..@@
-    0x00, 0xff, 0x81, 0x80,  //........@@@@@@@@%+.....@@
-    0x00, 0xfc, 0x01, 0x80,  //........@@@@@%.........@@
-    0x00, 0xc0, 0x01, 0x80,  //........@@+............@@
-    0x00, 0xc0, 0x01, 0x80,  //........@@.............@@
-    0x00, 0xc0, 0x01, 0x80,  //........@@.............@@
-    0x00, 0xc0, 0x01, 0x80,  //........@@.............@@
-    0x00, 0xc0, 0x01, 0x80,  //........@@.............@@
-    0x00, 0xc0, 0x7f, 0x80,  //........@@......+@@@@@%@@
-    0x00, 0xc1, 0xff, 0x80,  //........@@.....@@@@@@@@@@
-    0x00, 0xc1, 0xff, 0x80,  //........@@....+@@@@@@@@@@
-    0x00, 0xc1, 0xff, 0x80,  //........@@.....@@@@@@@@@@
-    0x3f, 0xc1, 0xff, 0x00,  //.+%@@@@%@@.....%@@@@@@@@+
-    0xff, 0xc0, 0x7c, 0x00,  //%@@@@@@@@@.......%@@@@+..
-    0xff, 0xc0, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xff, 0xc0, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xff, 0x80, 0x00, 0x00,  //%@@@@@@@@+...............
-    0x3f, 0x00, 0x00, 0x00,  //.+%@@@@%.................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf7, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x62, 0x1f, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x0f, 0xff,
+    0x80, 0x00, 0x7f, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff,
+    0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xf1, 0x80, 0x00, 0xff, 0x81, 0x80, 0x00, 0xfc, 0x01,
+    0x80, 0x00, 0xc0, 0x01, 0x80, 0x00, 0xc0, 0x01, 0x80, 0x00, 0xc0, 0x01, 0x80, 0x00, 0xc0, 0x01,
+    0x80, 0x00, 0xc0, 0x01, 0x80, 0x00, 0xc0, 0x7f, 0x80, 0x00, 0xc1, 0xff, 0x80, 0x00, 0xc1, 0xff,
+    0x80, 0x00, 0xc1, 0xff, 0x80, 0x3f, 0xc1, 0xff, 0x00, 0xff, 0xc0, 0x7c, 0x00, 0xff, 0xc0, 0x00,
+    0x00, 0xff, 0xc0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xfa, 0x00,
 
     /*Unicode: U+f008 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x7f, 0xff, 0xff, 0xfc,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xff, 0xff, 0xff, 0xfe,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+..+@@+.............+@@+..+@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+...@@...............@@....@@.
-    0xff, 0x00, 0x01, 0xfe,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0x00, 0x01, 0xfe,  //@@@@@@@@...............@@@@@@@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+..+@@...............@@+..+@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+...@@+.............+@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+..+@@...............@@+..+@@.
-    0xff, 0x00, 0x01, 0xfe,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0x00, 0x01, 0xfe,  //@@@@@@@@...............@@@@@@@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+...@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@....@@...............@@....@@.
-    0xc3, 0x00, 0x01, 0x86,  //@@+...@@+.............+@@....@@.
-    0xff, 0xff, 0xff, 0xfe,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xfc,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xf9, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x2c, 0xfe, 0xc3, 0x00, 0x01, 0x86, 0xc3,
+    0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xff, 0x00, 0x01, 0xfe, 0xff,
+    0x00, 0x01, 0xfe, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3,
+    0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xfe, 0xff, 0x00, 0xfe, 0xfe, 0xff, 0x28, 0xfe, 0xc3,
+    0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xff,
+    0x00, 0x01, 0xfe, 0xff, 0x00, 0x01, 0xfe, 0xc3, 0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xc3,
+    0x00, 0x01, 0x86, 0xc3, 0x00, 0x01, 0x86, 0xfe, 0xff, 0x04, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xfd,
+    0x00,
 
     /*Unicode: U+f00b () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x7f, 0x1f, 0xff, 0xf0,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x1f, 0xff, 0xf8,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0xff, 0x1f, 0xff, 0xf8,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0x1f, 0xff, 0xf0,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0xff, 0x1f, 0xff, 0xf8,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0x3f, 0xff, 0xf8,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0x1f, 0xff, 0xf0,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf9, 0x00, 0x17, 0x7f, 0x1f, 0xff, 0xf0, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff,
+    0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x1f, 0xff, 0xf8, 0xf5, 0x00, 0x17, 0xff, 0x1f,
+    0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f,
+    0xff, 0xf8, 0x7f, 0x1f, 0xff, 0xf0, 0xf9, 0x00, 0x17, 0xff, 0x1f, 0xff, 0xf8, 0xff, 0x3f, 0xff,
+    0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0xff, 0x3f, 0xff, 0xf8, 0x7f, 0x1f, 0xff,
+    0xf0, 0xed, 0x00,
 
     /*Unicode: U+f00c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.....................+...
-    0x00, 0x00, 0x0e, 0x00,  //...................+@@@..
-    0x00, 0x00, 0x1f, 0x00,  //..................+@@@@@.
-    0x00, 0x00, 0x3f, 0x80,  //.................+@@@@@@@
-    0x00, 0x00, 0x7f, 0x80,  //................+@@@@@@@@
-    0x00, 0x00, 0xff, 0x00,  //...............+@@@@@@@@+
-    0x10, 0x01, 0xfe, 0x00,  //...%+.........+@@@@@@@@+.
-    0x38, 0x03, 0xfc, 0x00,  //..@@@+.......+@@@@@@@@+..
-    0x7c, 0x07, 0xf8, 0x00,  //.@@@@@+.....+@@@@@@@@+...
-    0xfe, 0x0f, 0xf0, 0x00,  //@@@@@@@+...+@@@@@@@@+....
-    0xff, 0x1f, 0xe0, 0x00,  //@@@@@@@@+.+@@@@@@@@+.....
-    0x7f, 0xff, 0xc0, 0x00,  //+@@@@@@@@%@@@@@@@@+......
-    0x3f, 0xff, 0x80, 0x00,  //.+@@@@@@@@@@@@@@@+.......
-    0x1f, 0xff, 0x00, 0x00,  //..+@@@@@@@@@@@@@+........
-    0x0f, 0xfe, 0x00, 0x00,  //...+@@@@@@@@@@@+.........
-    0x07, 0xfc, 0x00, 0x00,  //....+@@@@@@@@@+..........
-    0x03, 0xf8, 0x00, 0x00,  //.....+@@@@@@@+...........
-    0x01, 0xf0, 0x00, 0x00,  //......+@@@@@+............
-    0x00, 0xe0, 0x00, 0x00,  //.......+@@@+.............
-    0x00, 0x40, 0x00, 0x00,  //........+%+..............
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe7, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x37, 0x3f, 0x80, 0x00, 0x00, 0x7f,
+    0x80, 0x00, 0x00, 0xff, 0x00, 0x10, 0x01, 0xfe, 0x00, 0x38, 0x03, 0xfc, 0x00, 0x7c, 0x07, 0xf8,
+    0x00, 0xfe, 0x0f, 0xf0, 0x00, 0xff, 0x1f, 0xe0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0x80,
+    0x00, 0x1f, 0xff, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00,
+    0x00, 0x01, 0xf0, 0xfe, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x40, 0xeb, 0x00,
 
     /*Unicode: U+f00d () , Width: 20 */
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x1c, 0x01, 0x80,  //...%@%.........%@+..
-    0x3e, 0x03, 0xc0,  //..%@@@%.......@@@@+.
-    0x7f, 0x07, 0xe0,  //.%@@@@@%.....@@@@@@+
-    0x7f, 0x8f, 0xf0,  //.@@@@@@@%...@@@@@@@@
-    0x7f, 0xdf, 0xf0,  //.@@@@@@@@%.@@@@@@@@%
-    0x3f, 0xff, 0xe0,  //..@@@@@@@@@@@@@@@@@.
-    0x1f, 0xff, 0xc0,  //...@@@@@@@@@@@@@@@..
-    0x0f, 0xff, 0x80,  //....@@@@@@@@@@@@@...
-    0x07, 0xff, 0x00,  //.....@@@@@@@@@@@....
-    0x03, 0xfe, 0x00,  //.....+@@@@@@@@@.....
-    0x07, 0xff, 0x00,  //.....@@@@@@@@@@%....
-    0x0f, 0xff, 0x80,  //....@@@@@@@@@@@@%...
-    0x1f, 0xff, 0xc0,  //...@@@@@@@@@@@@@@%..
-    0x3f, 0xff, 0xe0,  //..@@@@@@@@@@@@@@@@%.
-    0x7f, 0xdf, 0xf0,  //.@@@@@@@@@+@@@@@@@@%
-    0x7f, 0x8f, 0xf0,  //.@@@@@@@@...@@@@@@@@
-    0x7f, 0x07, 0xf0,  //.@@@@@@@.....@@@@@@%
-    0x3e, 0x03, 0xe0,  //..@@@@@.......@@@@%.
-    0x1c, 0x01, 0xc0,  //...@@@.........@@%..
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00,  //....................
-
+    0xef, 0x00, 0x38, 0x1c, 0x01, 0x80, 0x3e, 0x03, 0xc0, 0x7f, 0x07, 0xe0, 0x7f, 0x8f, 0xf0, 0x7f,
+    0xdf, 0xf0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0x80, 0x07, 0xff, 0x00, 0x03, 0xfe,
+    0x00, 0x07, 0xff, 0x00, 0x0f, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x7f, 0xdf, 0xf0,
+    0x7f, 0x8f, 0xf0, 0x7f, 0x07, 0xf0, 0x3e, 0x03, 0xe0, 0x1c, 0x01, 0xc0, 0xf2, 0x00,
 
     /*Unicode: U+f011 () , Width: 25 */
-    0x00, 0x18, 0x00, 0x00,  //...........@@+...........
-    0x00, 0x3c, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x3c, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x3c, 0x00, 0x00,  //..........@@@@...........
-    0x06, 0x3c, 0x60, 0x00,  //.....%%...@@@@...%%......
-    0x0f, 0x3c, 0xf0, 0x00,  //....@@@@..@@@@..@@@@.....
-    0x1f, 0x3c, 0xf8, 0x00,  //...@@@@@..@@@@..@@@@@....
-    0x3f, 0x3c, 0xfc, 0x00,  //..%@@@@@..@@@@..%@@@@@...
-    0x3e, 0x3c, 0x7c, 0x00,  //.+@@@@@...@@@@...@@@@@+..
-    0x7c, 0x3c, 0x3e, 0x00,  //.@@@@@....@@@@....@@@@@..
-    0x78, 0x3c, 0x1e, 0x00,  //+@@@@+....@@@@.....@@@@+.
-    0xf8, 0x3c, 0x1f, 0x00,  //%@@@@.....@@@@.....%@@@%.
-    0xf0, 0x3c, 0x0f, 0x00,  //@@@@+.....@@@@.....+@@@@.
-    0xf0, 0x3c, 0x0f, 0x00,  //@@@@+.....%@@@......@@@@.
-    0xf0, 0x00, 0x0f, 0x00,  //@@@@.......++.......@@@@.
-    0xf0, 0x00, 0x0f, 0x00,  //@@@@................@@@@.
-    0xf0, 0x00, 0x0f, 0x00,  //@@@@+...............@@@@.
-    0xf8, 0x00, 0x1f, 0x00,  //%@@@%..............%@@@@.
-    0x78, 0x00, 0x1e, 0x00,  //+@@@@..............@@@@+.
-    0x7c, 0x00, 0x3e, 0x00,  //.@@@@%............%@@@@..
-    0x7c, 0x00, 0x3e, 0x00,  //.+@@@@+..........+@@@@%..
-    0x3f, 0x00, 0xfc, 0x00,  //..@@@@@%........%@@@@@...
-    0x1f, 0xc3, 0xf8, 0x00,  //...@@@@@@%+...%@@@@@@+...
-    0x0f, 0xff, 0xf0, 0x00,  //...+@@@@@@@@@@@@@@@@+....
-    0x07, 0xff, 0xe0, 0x00,  //....+@@@@@@@@@@@@@@+.....
-    0x03, 0xff, 0xc0, 0x00,  //......%@@@@@@@@@@%.......
-    0x00, 0x7e, 0x00, 0x00,  //........+@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x01, 0x00, 0x18, 0xfe, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x5c, 0x3c, 0x00,
+    0x00, 0x06, 0x3c, 0x60, 0x00, 0x0f, 0x3c, 0xf0, 0x00, 0x1f, 0x3c, 0xf8, 0x00, 0x3f, 0x3c, 0xfc,
+    0x00, 0x3e, 0x3c, 0x7c, 0x00, 0x7c, 0x3c, 0x3e, 0x00, 0x78, 0x3c, 0x1e, 0x00, 0xf8, 0x3c, 0x1f,
+    0x00, 0xf0, 0x3c, 0x0f, 0x00, 0xf0, 0x3c, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x0f,
+    0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf8, 0x00, 0x1f, 0x00, 0x78, 0x00, 0x1e, 0x00, 0x7c, 0x00, 0x3e,
+    0x00, 0x7c, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0xfc, 0x00, 0x1f, 0xc3, 0xf8, 0x00, 0x0f, 0xff, 0xf0,
+    0x00, 0x07, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x7e, 0xf3, 0x00,
 
     /*Unicode: U+f013 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x3e, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x3e, 0x00, 0x00,  //..........@@@@@..........
-    0x04, 0x3e, 0x10, 0x00,  //.....%...+@@@@@....%.....
-    0x0e, 0x7f, 0x38, 0x00,  //...+@@@+.%@@@@@%.+@@@....
-    0x1f, 0xff, 0xfc, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x3f, 0xff, 0xfe, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x1f, 0xff, 0xfc, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x0f, 0xff, 0xf8, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x0f, 0xe3, 0xf8, 0x00,  //....@@@@@@@+++@@@@@@@....
-    0x1f, 0xc1, 0xfc, 0x00,  //...%@@@@@%.....%@@@@@%...
-    0xff, 0x80, 0xff, 0x80,  //@@@@@@@@@.......@@@@@@@@@
-    0xff, 0x00, 0x7f, 0x80,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0x00, 0x7f, 0x80,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0x00, 0x7f, 0x80,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0x80, 0xff, 0x80,  //@@@@@@@@@.......@@@@@@@@@
-    0x1f, 0xc1, 0xfc, 0x00,  //...%@@@@@%.....%@@@@@%+..
-    0x0f, 0xe3, 0xf8, 0x00,  //....@@@@@@%+.+%@@@@@@....
-    0x0f, 0xff, 0xf8, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x1f, 0xff, 0xfc, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x3f, 0xff, 0xfe, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x1f, 0xff, 0xfc, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x0e, 0x7f, 0x38, 0x00,  //...+@@@+.%@@@@@%.+@@@+...
-    0x04, 0x3e, 0x10, 0x00,  //.....@....@@@@@+..+@+....
-    0x00, 0x3e, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x3e, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf8, 0x00, 0x00, 0x3e, 0xfe, 0x00, 0x58, 0x3e, 0x00, 0x00, 0x04, 0x3e, 0x10, 0x00, 0x0e, 0x7f,
+    0x38, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x0f, 0xff,
+    0xf8, 0x00, 0x0f, 0xe3, 0xf8, 0x00, 0x1f, 0xc1, 0xfc, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x00,
+    0x7f, 0x80, 0xff, 0x00, 0x7f, 0x80, 0xff, 0x00, 0x7f, 0x80, 0xff, 0x80, 0xff, 0x80, 0x1f, 0xc1,
+    0xfc, 0x00, 0x0f, 0xe3, 0xf8, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x3f, 0xff,
+    0xfe, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x0e, 0x7f, 0x38, 0x00, 0x04, 0x3e, 0x10, 0x00, 0x00, 0x3e,
+    0xfe, 0x00, 0x00, 0x3e, 0xf3, 0x00,
 
     /*Unicode: U+f014 () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x01, 0xfe, 0x00,  //.......%@@@@@@@+.......
-    0x01, 0xff, 0x00,  //......+@@@@@@@@@.......
-    0x03, 0x03, 0x80,  //......@@+.....%@%......
-    0x03, 0x01, 0x80,  //.....+@@.......@@......
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x30, 0x00, 0x18,  //..@@..............+@%..
-    0x30, 0x00, 0x18,  //..@@..............+@%..
-    0x30, 0x00, 0x18,  //..@@..............+@%..
-    0x30, 0x00, 0x18,  //..@@...+...+...+..+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x98,  //..@@..@@+.%@+.+@%.+@%..
-    0x33, 0x31, 0x18,  //..@@..%@..%@+.+@+.+@%..
-    0x30, 0x00, 0x18,  //..@@..............+@%..
-    0x30, 0x00, 0x18,  //..@@..............+@%..
-    0x30, 0x00, 0x38,  //..@@+.............%@%..
-    0x1f, 0xff, 0xf0,  //..+@@@@@@@@@@@@@@@@@...
-    0x1f, 0xff, 0xe0,  //...%@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xfb, 0x00, 0x4a, 0x01, 0xfe, 0x00, 0x01, 0xff, 0x00, 0x03, 0x03, 0x80, 0x03, 0x01, 0x80, 0xff,
+    0xff, 0xfe, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00,
+    0x18, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98,
+    0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x98, 0x33, 0x31, 0x18, 0x30,
+    0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00, 0x38, 0x1f, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0xf8, 0x00,
 
     /*Unicode: U+f015 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x04, 0x1e, 0x00,  //............+%+....%%%%....
-    0x00, 0x1f, 0x1e, 0x00,  //...........%@@@%...@@@@....
-    0x00, 0x3f, 0x9e, 0x00,  //..........@@@@@@@..@@@@....
-    0x00, 0x7b, 0xde, 0x00,  //.........@@@@.@@@@+@@@@....
-    0x00, 0xf1, 0xfe, 0x00,  //.......+@@@%.+.%@@@@@@@....
-    0x03, 0xee, 0x7e, 0x00,  //......%@@@+.%@%.+@@@@@@....
-    0x07, 0x9f, 0x3e, 0x00,  //.....%@@@+.@@@@@.+@@@@@....
-    0x0f, 0x3f, 0x9e, 0x00,  //....@@@@.+@@@@@@@+.@@@@....
-    0x1e, 0xff, 0xef, 0x00,  //...@@@@.%@@@@@@@@@%.%@@@+..
-    0x3d, 0xff, 0xf7, 0xc0,  //.+@@@%.%@@@@@@@@@@@%.%@@@%.
-    0x7b, 0xff, 0xf9, 0xe0,  //+@@@+.@@@@@@@@@@@@@@@.+@@@%
-    0x67, 0xff, 0xfc, 0xc0,  //.@@++@@@@@@@@@@@@@@@@@+.@@+
-    0x0f, 0xff, 0xfe, 0x00,  //....@@@@@@@@@@@@@@@@@@@..+.
-    0x0f, 0xff, 0xfe, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x0f, 0xff, 0xfe, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x0f, 0xe0, 0xfe, 0x00,  //....%@@@@@@.....@@@@@@%....
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf0, 0x00, 0x51, 0x04, 0x1e, 0x00, 0x00, 0x1f, 0x1e, 0x00, 0x00, 0x3f, 0x9e, 0x00, 0x00, 0x7b,
+    0xde, 0x00, 0x00, 0xf1, 0xfe, 0x00, 0x03, 0xee, 0x7e, 0x00, 0x07, 0x9f, 0x3e, 0x00, 0x0f, 0x3f,
+    0x9e, 0x00, 0x1e, 0xff, 0xef, 0x00, 0x3d, 0xff, 0xf7, 0xc0, 0x7b, 0xff, 0xf9, 0xe0, 0x67, 0xff,
+    0xfc, 0xc0, 0x0f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x0f, 0xe0,
+    0xfe, 0x00, 0x0f, 0xe0, 0xfe, 0x00, 0x0f, 0xe0, 0xfe, 0x00, 0x0f, 0xe0, 0xfe, 0x00, 0x0f, 0xe0,
+    0xfe, 0x00, 0x0f, 0xe0, 0xfe, 0xec, 0x00,
 
     /*Unicode: U+f019 () , Width: 27 */
-    0x00, 0x1f, 0x00, 0x00,  //...........%%%%%...........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //......++++@@@@@@%++++......
-    0x07, 0xff, 0xfc, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x03, 0xff, 0xf8, 0x00,  //.....+@@@@@@@@@@@@@@@......
-    0x01, 0xff, 0xf0, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0xff, 0xe0, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x7f, 0xc0, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x3f, 0x80, 0x00,  //.........+@@@@@@@..........
-    0x00, 0x1f, 0x00, 0x00,  //..........+@@@@@...........
-    0x00, 0x0e, 0x00, 0x00,  //...........+@@@............
-    0xff, 0xc4, 0x7f, 0xe0,  //%@@@@@@@@%..+@...%@@@@@@@@%
-    0xff, 0xe0, 0xff, 0xe0,  //@@@@@@@@@@%.....@@@@@@@@@@@
-    0xff, 0xf1, 0xff, 0xe0,  //@@@@@@@@@@@@+.+@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xe6, 0x60,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xe6, 0x60,  //@@@@@@@@@@@@@@@@@@@.+@@++@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x01, 0x00, 0x1f, 0xfe, 0x00, 0x38, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80,
+    0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80,
+    0x00, 0x00, 0x3f, 0x80, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xf0,
+    0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x1f, 0xfe,
+    0x00, 0x0e, 0x0e, 0x00, 0x00, 0xff, 0xc4, 0x7f, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf1, 0xff,
+    0xe0, 0xfe, 0xff, 0x08, 0xe0, 0xff, 0xff, 0xe6, 0x60, 0xff, 0xff, 0xe6, 0x60, 0xfe, 0xff, 0x00,
+    0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xed, 0x00,
 
     /*Unicode: U+f01c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x07, 0xff, 0xf0, 0x00,  //....+@@@@@@@@@@@@@@@.....
-    0x0f, 0xff, 0xf8, 0x00,  //....@@@@@@@@@@@@@@@@@....
-    0x0f, 0xff, 0xf8, 0x00,  //...+@@@@@@@@@@@@@@@@@....
-    0x1e, 0x00, 0x3c, 0x00,  //...@@@%...........%@@%...
-    0x1c, 0x00, 0x1c, 0x00,  //...@@@............+@@@...
-    0x3c, 0x00, 0x1e, 0x00,  //..%@@%.............@@@%..
-    0x38, 0x00, 0x0e, 0x00,  //..@@@+.............+@@@..
-    0x78, 0x00, 0x0e, 0x00,  //.%@@@...............@@@+.
-    0x70, 0x00, 0x0f, 0x00,  //.@@@+...............%@@@.
-    0x70, 0x00, 0x07, 0x00,  //+@@@.................@@@.
-    0xf0, 0x00, 0x07, 0x80,  //%@@%.................@@@%
-    0xf0, 0x00, 0x07, 0x80,  //@@@%++++.........++++%@@@
-    0xff, 0x80, 0xff, 0x80,  //@@@@@@@@%.......@@@@@@@@@
-    0xff, 0x80, 0xff, 0x80,  //@@@@@@@@@......+@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@%.....@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf1, 0x00, 0x3b, 0x07, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x1e,
+    0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x78,
+    0x00, 0x0e, 0x00, 0x70, 0x00, 0x0f, 0x00, 0x70, 0x00, 0x07, 0x00, 0xf0, 0x00, 0x07, 0x80, 0xf0,
+    0x00, 0x07, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xfe,
+    0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe,
+    0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xed, 0x00,
 
     /*Unicode: U+f021 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x7f, 0x00, 0x00,  //........+%@@@@@%+........
-    0x03, 0xff, 0xc1, 0x80,  //......%@@@@@@@@@@@+....@%
-    0x07, 0xff, 0xf3, 0x80,  //.....@@@@@@@@@@@@@@@..@@@
-    0x0f, 0xff, 0xff, 0x80,  //....@@@@@@@@@@@@@@@@@@@@@
-    0x1f, 0xc1, 0xff, 0x80,  //...@@@@@@%+...+%@@@@@@@@@
-    0x3f, 0x00, 0x7f, 0x80,  //..@@@@@@.........%@@@@@@@
-    0x3e, 0x00, 0x3f, 0x80,  //.+@@@@%...........@@@@@@@
-    0x7c, 0x00, 0x7f, 0x80,  //.@@@@@...........@@@@@@@@
-    0x78, 0x00, 0xff, 0x80,  //+@@@@...........@@@@@@@@@
-    0xf8, 0x00, 0xff, 0x80,  //%@@@%...........@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00,  //.+++.............+++++++.
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.++++++++............+++.
-    0xff, 0x80, 0x0f, 0x00,  //@@@@@@@@@+..........@@@@+
-    0xff, 0x80, 0x0f, 0x00,  //@@@@@@@@@...........@@@@.
-    0xff, 0x00, 0x1f, 0x00,  //@@@@@@@@...........@@@@@.
-    0xfe, 0x00, 0x3e, 0x00,  //@@@@@@@...........%@@@@+.
-    0xff, 0x00, 0x7e, 0x00,  //@@@@@@@@.........@@@@@%..
-    0xff, 0xc1, 0xfc, 0x00,  //@@@@@@@@@%+...+%@@@@@@...
-    0xff, 0xff, 0xf8, 0x00,  //@@@@@@@@@@@@@@@@@@@@@....
-    0xe7, 0xff, 0xf0, 0x00,  //@@@..@@@@@@@@@@@@@@@.....
-    0xc3, 0xff, 0xc0, 0x00,  //@@....%@@@@@@@@@@@+......
-    0x00, 0x7f, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf8, 0x00, 0x26, 0x7f, 0x00, 0x00, 0x03, 0xff, 0xc1, 0x80, 0x07, 0xff, 0xf3, 0x80, 0x0f, 0xff,
+    0xff, 0x80, 0x1f, 0xc1, 0xff, 0x80, 0x3f, 0x00, 0x7f, 0x80, 0x3e, 0x00, 0x3f, 0x80, 0x7c, 0x00,
+    0x7f, 0x80, 0x78, 0x00, 0xff, 0x80, 0xf8, 0x00, 0xff, 0x80, 0xed, 0x00, 0x25, 0xff, 0x80, 0x0f,
+    0x00, 0xff, 0x80, 0x0f, 0x00, 0xff, 0x00, 0x1f, 0x00, 0xfe, 0x00, 0x3e, 0x00, 0xff, 0x00, 0x7e,
+    0x00, 0xff, 0xc1, 0xfc, 0x00, 0xff, 0xff, 0xf8, 0x00, 0xe7, 0xff, 0xf0, 0x00, 0xc3, 0xff, 0xc0,
+    0x00, 0x00, 0x7f, 0xf3, 0x00,
 
     /*Unicode: U+f026 () , Width: 13 */
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x10,  //..........+@.
-    0x00, 0x70,  //.........%@@+
-    0x00, 0xf0,  //........%@@@+
-    0x01, 0xf0,  //.......%@@@@+
-    0x03, 0xf0,  //......%@@@@@+
-    0x07, 0xf0,  //.++++%@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //@@@@@@@@@@@@+
-    0xff, 0xf0,  //%@@@@@@@@@@@+
-    0x03, 0xf0,  //......@@@@@@+
-    0x01, 0xf0,  //.......@@@@@+
-    0x00, 0xf0,  //........@@@@+
-    0x00, 0x70,  //.........@@@+
-    0x00, 0x30,  //..........@@+
-    0x00, 0x10,  //...........%.
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-    0x00, 0x00,  //.............
-
+    0xf6, 0x00, 0x26, 0x10, 0x00, 0x70, 0x00, 0xf0, 0x01, 0xf0, 0x03, 0xf0, 0x07, 0xf0, 0xff, 0xf0,
+    0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x03, 0xf0,
+    0x01, 0xf0, 0x00, 0xf0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x10, 0xf7, 0x00,
 
     /*Unicode: U+f027 () , Width: 19 */
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x10, 0x00,  //..........+@.......
-    0x00, 0x70, 0x00,  //.........%@@+......
-    0x00, 0xf0, 0x00,  //........%@@@+......
-    0x01, 0xf0, 0x00,  //.......%@@@@+......
-    0x03, 0xf0, 0x00,  //......%@@@@@+......
-    0x07, 0xf0, 0x00,  //.++++%@@@@@@+......
-    0xff, 0xf1, 0x80,  //@@@@@@@@@@@@+..@@+.
-    0xff, 0xf1, 0xc0,  //@@@@@@@@@@@@+..@@@.
-    0xff, 0xf0, 0xe0,  //@@@@@@@@@@@@+...%@%
-    0xff, 0xf0, 0x60,  //@@@@@@@@@@@@+....@@
-    0xff, 0xf0, 0x60,  //@@@@@@@@@@@@+....@@
-    0xff, 0xf0, 0xe0,  //@@@@@@@@@@@@+...@@%
-    0xff, 0xf1, 0xc0,  //@@@@@@@@@@@@+..@@@.
-    0xff, 0xf1, 0x80,  //%@@@@@@@@@@@+..%%..
-    0x03, 0xf0, 0x00,  //......@@@@@@+......
-    0x01, 0xf0, 0x00,  //.......@@@@@+......
-    0x00, 0xf0, 0x00,  //........@@@@+......
-    0x00, 0x70, 0x00,  //.........@@@+......
-    0x00, 0x30, 0x00,  //..........@@+......
-    0x00, 0x10, 0x00,  //...........%.......
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00,  //...................
-
+    0xf1, 0x00, 0x39, 0x10, 0x00, 0x00, 0x70, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xf0,
+    0x00, 0x07, 0xf0, 0x00, 0xff, 0xf1, 0x80, 0xff, 0xf1, 0xc0, 0xff, 0xf0, 0xe0, 0xff, 0xf0, 0x60,
+    0xff, 0xf0, 0x60, 0xff, 0xf0, 0xe0, 0xff, 0xf1, 0xc0, 0xff, 0xf1, 0x80, 0x03, 0xf0, 0x00, 0x01,
+    0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x10, 0xf1, 0x00,
 
     /*Unicode: U+f028 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x10, 0x00,  //..................+@+......
-    0x00, 0x00, 0x1c, 0x00,  //...........+......+@@@.....
-    0x00, 0x30, 0x0e, 0x00,  //..........@@+......+@@@....
-    0x00, 0x70, 0x07, 0x00,  //.........@@@+........%@@...
-    0x00, 0xf0, 0x63, 0x80,  //........@@@@+....@@+..%@@..
-    0x01, 0xf0, 0x71, 0x80,  //.......@@@@@+....@@@+..@@+.
-    0x03, 0xf0, 0x38, 0xc0,  //......@@@@@@+.....%@@+.+@@.
-    0x7f, 0xf0, 0x1c, 0xc0,  //+%%%%@@@@@@@+......%@@..@@+
-    0xff, 0xf1, 0xcc, 0xe0,  //@@@@@@@@@@@@+..@@%..@@+.%@%
-    0xff, 0xf1, 0xc6, 0x60,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xf0, 0x66, 0x60,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xf0, 0x66, 0x60,  //@@@@@@@@@@@@+....@@..@@..@@
-    0xff, 0xf0, 0x66, 0x60,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xf1, 0xc6, 0x60,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xf1, 0xcc, 0xe0,  //@@@@@@@@@@@@+..@@%..@@+.+@%
-    0x7f, 0xf0, 0x1c, 0xc0,  //+%%%%@@@@@@@+..+...%@@..@@+
-    0x03, 0xf0, 0x38, 0xc0,  //......@@@@@@+.....%@@+.+@@.
-    0x01, 0xf0, 0x71, 0x80,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0xf0, 0x63, 0x80,  //........@@@@+....@@+..%@@..
-    0x00, 0x70, 0x07, 0x00,  //.........@@@+........%@@...
-    0x00, 0x30, 0x0e, 0x00,  //..........@@+......+@@@+...
-    0x00, 0x00, 0x1c, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x18, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf3, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x4c, 0x1c, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00, 0x70, 0x07,
+    0x00, 0x00, 0xf0, 0x63, 0x80, 0x01, 0xf0, 0x71, 0x80, 0x03, 0xf0, 0x38, 0xc0, 0x7f, 0xf0, 0x1c,
+    0xc0, 0xff, 0xf1, 0xcc, 0xe0, 0xff, 0xf1, 0xc6, 0x60, 0xff, 0xf0, 0x66, 0x60, 0xff, 0xf0, 0x66,
+    0x60, 0xff, 0xf0, 0x66, 0x60, 0xff, 0xf1, 0xc6, 0x60, 0xff, 0xf1, 0xcc, 0xe0, 0x7f, 0xf0, 0x1c,
+    0xc0, 0x03, 0xf0, 0x38, 0xc0, 0x01, 0xf0, 0x71, 0x80, 0x00, 0xf0, 0x63, 0x80, 0x00, 0x70, 0x07,
+    0x00, 0x00, 0x30, 0x0e, 0xfe, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x00, 0x18, 0xf0, 0x00,
 
     /*Unicode: U+f03e () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x7f, 0xff, 0xff, 0xfc,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xff, 0xff, 0xff, 0xfe,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc3, 0x80, 0x00, 0x06,  //@@...+@@%....................@@.
-    0xc7, 0xc0, 0x00, 0x06,  //@@..+@@@@%...................@@.
-    0xcf, 0xc0, 0x00, 0x06,  //@@..@@@@@@...................@@.
-    0xcf, 0xc0, 0x18, 0x06,  //@@..@@@@@@.........%@........@@.
-    0xcf, 0xc0, 0x3c, 0x06,  //@@..%@@@@@........%@@@.......@@.
-    0xc7, 0x80, 0x7e, 0x06,  //@@...%@@@........%@@@@@......@@.
-    0xc0, 0x00, 0xff, 0x06,  //@@..............@@@@@@@@.....@@.
-    0xc0, 0x01, 0xff, 0x86,  //@@.............@@@@@@@@@@....@@.
-    0xc0, 0x03, 0xff, 0xc6,  //@@.......+....@@@@@@@@@@@@...@@.
-    0xc0, 0xc7, 0xff, 0xe6,  //@@......@@+..@@@@@@@@@@@@@@..@@.
-    0xc1, 0xef, 0xff, 0xe6,  //@@.....@@@@+@@@@@@@@@@@@@@@..@@.
-    0xc3, 0xff, 0xff, 0xe6,  //@@....@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xc7, 0xff, 0xff, 0xe6,  //@@...@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xcf, 0xff, 0xff, 0xe6,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xcf, 0xff, 0xff, 0xe6,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xcf, 0xff, 0xff, 0xe6,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xcf, 0xff, 0xff, 0xe6,  //@@..%%%%%%%%%%%%%%%%%%%%%%+..@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xff, 0xff, 0xff, 0xfe,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xfc,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xf9, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x54, 0xfe, 0xc0, 0x00, 0x00, 0x06, 0xc0,
+    0x00, 0x00, 0x06, 0xc3, 0x80, 0x00, 0x06, 0xc7, 0xc0, 0x00, 0x06, 0xcf, 0xc0, 0x00, 0x06, 0xcf,
+    0xc0, 0x18, 0x06, 0xcf, 0xc0, 0x3c, 0x06, 0xc7, 0x80, 0x7e, 0x06, 0xc0, 0x00, 0xff, 0x06, 0xc0,
+    0x01, 0xff, 0x86, 0xc0, 0x03, 0xff, 0xc6, 0xc0, 0xc7, 0xff, 0xe6, 0xc1, 0xef, 0xff, 0xe6, 0xc3,
+    0xff, 0xff, 0xe6, 0xc7, 0xff, 0xff, 0xe6, 0xcf, 0xff, 0xff, 0xe6, 0xcf, 0xff, 0xff, 0xe6, 0xcf,
+    0xff, 0xff, 0xe6, 0xcf, 0xff, 0xff, 0xe6, 0xc0, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x06, 0xfe,
+    0xff, 0x04, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xf5, 0x00,
 
     /*Unicode: U+f040 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //..................+......
-    0x00, 0x00, 0x70, 0x00,  //.................@@@+....
-    0x00, 0x00, 0xf8, 0x00,  //................@@@@@+...
-    0x00, 0x01, 0xfc, 0x00,  //...............@@@@@@@+..
-    0x00, 0x01, 0xfe, 0x00,  //...............@@@@@@@@+.
-    0x00, 0x04, 0xff, 0x00,  //.............@..@@@@@@@@.
-    0x00, 0x0e, 0x7f, 0x00,  //............@@@..@@@@@@@+
-    0x00, 0x1f, 0x3f, 0x00,  //...........@@@@@..@@@@@@.
-    0x00, 0x3b, 0x9e, 0x00,  //..........@@@.@@@..@@@@+.
-    0x00, 0x77, 0xcc, 0x00,  //.........@@@.@@@@@..@@+..
-    0x00, 0xef, 0xe0, 0x00,  //........@@@.@@@@@@@......
-    0x01, 0xdf, 0xf0, 0x00,  //.......@@@.@@@@@@@@@.....
-    0x03, 0xbf, 0xe0, 0x00,  //......@@@.@@@@@@@@@+.....
-    0x07, 0x7f, 0xc0, 0x00,  //.....@@@.@@@@@@@@@+......
-    0x0e, 0xff, 0x80, 0x00,  //....@@@.@@@@@@@@@+.......
-    0x1d, 0xff, 0x00, 0x00,  //...@@@.@@@@@@@@@+........
-    0x3b, 0xfe, 0x00, 0x00,  //..@@@.@@@@@@@@@+.........
-    0x7f, 0xfc, 0x00, 0x00,  //.@@@@@@@@@@@@@+..........
-    0xef, 0xf8, 0x00, 0x00,  //@@%.%@@@@@@@@+...........
-    0xc7, 0xf0, 0x00, 0x00,  //@@...%@@@@@@+............
-    0xc3, 0xe0, 0x00, 0x00,  //@@....%@@@@+.............
-    0xf1, 0xc0, 0x00, 0x00,  //@@@@...@@@+..............
-    0xf3, 0x80, 0x00, 0x00,  //@@@@..%@@+...............
-    0xff, 0x00, 0x00, 0x00,  //@@@@@@@@+................
-    0xfe, 0x00, 0x00, 0x00,  //@@@@@@@+.................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf3, 0x00, 0x00, 0x70, 0xfe, 0x00, 0x52, 0xf8, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xfe,
+    0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x0e, 0x7f, 0x00, 0x00, 0x1f, 0x3f, 0x00, 0x00, 0x3b, 0x9e,
+    0x00, 0x00, 0x77, 0xcc, 0x00, 0x00, 0xef, 0xe0, 0x00, 0x01, 0xdf, 0xf0, 0x00, 0x03, 0xbf, 0xe0,
+    0x00, 0x07, 0x7f, 0xc0, 0x00, 0x0e, 0xff, 0x80, 0x00, 0x1d, 0xff, 0x00, 0x00, 0x3b, 0xfe, 0x00,
+    0x00, 0x7f, 0xfc, 0x00, 0x00, 0xef, 0xf8, 0x00, 0x00, 0xc7, 0xf0, 0x00, 0x00, 0xc3, 0xe0, 0x00,
+    0x00, 0xf1, 0xc0, 0x00, 0x00, 0xf3, 0x80, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xf2, 0x00,
 
     /*Unicode: U+f048 () , Width: 17 */
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0xf0, 0x00, 0x00,  //%@@%...........++
-    0xf0, 0x01, 0x80,  //@@@@..........+@%
-    0xf0, 0x03, 0x80,  //@@@@.........+@@%
-    0xf0, 0x07, 0x80,  //@@@@........+@@@%
-    0xf0, 0x0f, 0x80,  //@@@@.......+@@@@%
-    0xf0, 0x1f, 0x80,  //@@@@......+@@@@@%
-    0xf0, 0x3f, 0x80,  //@@@@.....+@@@@@@%
-    0xf0, 0x7f, 0x80,  //@@@@....+@@@@@@@%
-    0xf0, 0xff, 0x80,  //@@@@...+@@@@@@@@%
-    0xf1, 0xff, 0x80,  //@@@@..+@@@@@@@@@%
-    0xf3, 0xff, 0x80,  //@@@@.+@@@@@@@@@@%
-    0xf7, 0xff, 0x80,  //@@@@+@@@@@@@@@@@%
-    0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0x80,  //@@@@%@@@@@@@@@@@%
-    0xf3, 0xff, 0x80,  //@@@@.+@@@@@@@@@@%
-    0xf1, 0xff, 0x80,  //@@@@..+@@@@@@@@@%
-    0xf0, 0xff, 0x80,  //@@@@...+@@@@@@@@%
-    0xf0, 0x7f, 0x80,  //@@@@....+@@@@@@@%
-    0xf0, 0x3f, 0x80,  //@@@@.....+@@@@@@%
-    0xf0, 0x1f, 0x80,  //@@@@......+@@@@@%
-    0xf0, 0x0f, 0x80,  //@@@@.......+@@@@%
-    0xf0, 0x07, 0x80,  //@@@@........+@@@%
-    0xf0, 0x03, 0x80,  //@@@@.........+@@%
-    0xf0, 0x01, 0x80,  //@@@@..........+@%
-    0xf0, 0x00, 0x80,  //%@@@...........+%
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-
+    0xfb, 0x00, 0x4a, 0xf0, 0x00, 0x00, 0xf0, 0x01, 0x80, 0xf0, 0x03, 0x80, 0xf0, 0x07, 0x80, 0xf0,
+    0x0f, 0x80, 0xf0, 0x1f, 0x80, 0xf0, 0x3f, 0x80, 0xf0, 0x7f, 0x80, 0xf0, 0xff, 0x80, 0xf1, 0xff,
+    0x80, 0xf3, 0xff, 0x80, 0xf7, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xf3, 0xff, 0x80,
+    0xf1, 0xff, 0x80, 0xf0, 0xff, 0x80, 0xf0, 0x7f, 0x80, 0xf0, 0x3f, 0x80, 0xf0, 0x1f, 0x80, 0xf0,
+    0x0f, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x03, 0x80, 0xf0, 0x01, 0x80, 0xf0, 0x00, 0x80, 0xf8, 0x00,
 
     /*Unicode: U+f04b () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x80, 0x00, 0x00,  //@+.....................
-    0xe0, 0x00, 0x00,  //@@@+...................
-    0xf8, 0x00, 0x00,  //@@@@@..................
-    0xfe, 0x00, 0x00,  //@@@@@@%................
-    0xff, 0x80, 0x00,  //@@@@@@@@%..............
-    0xff, 0xc0, 0x00,  //@@@@@@@@@@+............
-    0xff, 0xf0, 0x00,  //@@@@@@@@@@@@+..........
-    0xff, 0xfc, 0x00,  //@@@@@@@@@@@@@@.........
-    0xff, 0xff, 0x00,  //@@@@@@@@@@@@@@@%.......
-    0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@%.....
-    0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@+...
-    0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@%.
-    0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0x00,  //@@@@@@@@@@@@@@@@+......
-    0xff, 0xfe, 0x00,  //@@@@@@@@@@@@@@%........
-    0xff, 0xf8, 0x00,  //@@@@@@@@@@@@%..........
-    0xff, 0xe0, 0x00,  //@@@@@@@@@@%............
-    0xff, 0x80, 0x00,  //@@@@@@@@@+.............
-    0xfe, 0x00, 0x00,  //@@@@@@@+...............
-    0xfc, 0x00, 0x00,  //@@@@@%.................
-    0xf0, 0x00, 0x00,  //@@@%...................
-    0xc0, 0x00, 0x00,  //@@.....................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xfb, 0x00, 0x48, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff,
+    0x80, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xe0, 0x00, 0xff,
+    0x80, 0x00, 0xfe, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xc0, 0xf6, 0x00,
 
     /*Unicode: U+f04c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0xff, 0xc1, 0xff, 0x80,  //%@@@@@@@@@.....@@@@@@@@@%
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xc1, 0xff, 0x80,  //%@@@@@@@@@.....@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf9, 0x00, 0x63, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xff,
+    0xc1, 0xff, 0x80, 0xff, 0xc1, 0xff, 0x80, 0xf5, 0x00,
 
     /*Unicode: U+f04d () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0xff, 0xff, 0xff, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf9, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff,
+    0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xf5, 0x00,
 
     /*Unicode: U+f051 () , Width: 17 */
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x0f, 0x00,  //+...........%@@%.
-    0x80, 0x0f, 0x00,  //@+..........@@@@.
-    0xc0, 0x0f, 0x00,  //@@+.........@@@@.
-    0xe0, 0x0f, 0x00,  //@@@+........@@@@.
-    0xf0, 0x0f, 0x00,  //@@@@+.......@@@@.
-    0xf8, 0x0f, 0x00,  //@@@@@+......@@@@.
-    0xfc, 0x0f, 0x00,  //@@@@@@+.....@@@@.
-    0xfe, 0x0f, 0x00,  //@@@@@@@+....@@@@.
-    0xff, 0x0f, 0x00,  //@@@@@@@@+...@@@@.
-    0xff, 0x8f, 0x00,  //@@@@@@@@@+..@@@@.
-    0xff, 0xcf, 0x00,  //@@@@@@@@@@+.@@@@.
-    0xff, 0xef, 0x00,  //@@@@@@@@@@@+@@@@.
-    0xff, 0xff, 0x00,  //@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0x00,  //@@@@@@@@@@@%@@@@.
-    0xff, 0xef, 0x00,  //@@@@@@@@@@%.@@@@.
-    0xff, 0xcf, 0x00,  //@@@@@@@@@%..@@@@.
-    0xff, 0x8f, 0x00,  //@@@@@@@@%...@@@@.
-    0xff, 0x0f, 0x00,  //@@@@@@@%....@@@@.
-    0xfe, 0x0f, 0x00,  //@@@@@@%.....@@@@.
-    0xfc, 0x0f, 0x00,  //@@@@@%......@@@@.
-    0xf8, 0x0f, 0x00,  //@@@@%.......@@@@.
-    0xf0, 0x0f, 0x00,  //@@@%........@@@@.
-    0xe0, 0x0f, 0x00,  //@@%.........@@@@.
-    0xc0, 0x0f, 0x00,  //@%..........@@@@.
-    0x80, 0x0f, 0x00,  //%...........%@@@.
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00,  //.................
-
+    0xfa, 0x00, 0x48, 0x0f, 0x00, 0x80, 0x0f, 0x00, 0xc0, 0x0f, 0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x0f,
+    0x00, 0xf8, 0x0f, 0x00, 0xfc, 0x0f, 0x00, 0xfe, 0x0f, 0x00, 0xff, 0x0f, 0x00, 0xff, 0x8f, 0x00,
+    0xff, 0xcf, 0x00, 0xff, 0xef, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xef, 0x00, 0xff,
+    0xcf, 0x00, 0xff, 0x8f, 0x00, 0xff, 0x0f, 0x00, 0xfe, 0x0f, 0x00, 0xfc, 0x0f, 0x00, 0xf8, 0x0f,
+    0x00, 0xf0, 0x0f, 0x00, 0xe0, 0x0f, 0x00, 0xc0, 0x0f, 0x00, 0x80, 0x0f, 0xf7, 0x00,
 
     /*Unicode: U+f052 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x08, 0x00, 0x00,  //...........+@+...........
-    0x00, 0x1c, 0x00, 0x00,  //..........+@@@+..........
-    0x00, 0x3e, 0x00, 0x00,  //.........+@@@@@+.........
-    0x00, 0x7f, 0x00, 0x00,  //........+@@@@@@@+........
-    0x00, 0xff, 0x80, 0x00,  //.......+@@@@@@@@@+.......
-    0x01, 0xff, 0xc0, 0x00,  //......+@@@@@@@@@@@+......
-    0x03, 0xff, 0xe0, 0x00,  //.....+@@@@@@@@@@@@@+.....
-    0x07, 0xff, 0xf0, 0x00,  //....+@@@@@@@@@@@@@@@+....
-    0x0f, 0xff, 0xf8, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x1f, 0xff, 0xfc, 0x00,  //..+@@@@@@@@@@@@@@@@@@@+..
-    0x3f, 0xff, 0xfe, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@+.
-    0x7f, 0xff, 0xff, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x7f, 0xff, 0xff, 0x00,  //+%%%%%%%%%%%%%%%%%%%%%%%+
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf0, 0x00, 0x00, 0x08, 0xfe, 0x00, 0x00, 0x1c, 0xfe, 0x00, 0x00, 0x3e, 0xfe, 0x00, 0x00, 0x7f,
+    0xfe, 0x00, 0x21, 0xff, 0x80, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x07, 0xff,
+    0xf0, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x7f, 0xff,
+    0xff, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe,
+    0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xed,
+    0x00,
 
     /*Unicode: U+f053 () , Width: 18 */
-    0x00, 0x00, 0x00,  //..................
-    0x00, 0x06, 0x00,  //............+@%...
-    0x00, 0x0f, 0x00,  //...........+@@@%..
-    0x00, 0x1f, 0x80,  //..........+@@@@@%.
-    0x00, 0x3f, 0x80,  //.........+@@@@@@@.
-    0x00, 0x7f, 0x80,  //........+@@@@@@@@.
-    0x00, 0xff, 0x00,  //.......+@@@@@@@@..
-    0x01, 0xfe, 0x00,  //......+@@@@@@@@...
-    0x03, 0xfc, 0x00,  //.....+@@@@@@@@....
-    0x07, 0xf8, 0x00,  //....+@@@@@@@@.....
-    0x0f, 0xf0, 0x00,  //...+@@@@@@@@......
-    0x1f, 0xe0, 0x00,  //..+@@@@@@@@.......
-    0x3f, 0xc0, 0x00,  //.+@@@@@@@@........
-    0x7f, 0x80, 0x00,  //+@@@@@@@@.........
-    0x7f, 0x80, 0x00,  //+@@@@@@@@.........
-    0x3f, 0xc0, 0x00,  //.+@@@@@@@@........
-    0x1f, 0xe0, 0x00,  //..+@@@@@@@@.......
-    0x0f, 0xf0, 0x00,  //...+@@@@@@@@......
-    0x07, 0xf8, 0x00,  //....+@@@@@@@@.....
-    0x03, 0xfc, 0x00,  //.....+@@@@@@@@....
-    0x01, 0xfe, 0x00,  //......+@@@@@@@@...
-    0x00, 0xff, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x7f, 0x80,  //........+@@@@@@@@.
-    0x00, 0x3f, 0x80,  //.........+@@@@@@@.
-    0x00, 0x1f, 0x00,  //..........+@@@@@+.
-    0x00, 0x0e, 0x00,  //...........+@@@+..
-    0x00, 0x04, 0x00,  //............+@+...
-    0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00,  //..................
-
+    0xfd, 0x00, 0x4b, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x7f,
+    0x80, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x00, 0x0f, 0xf0, 0x00,
+    0x1f, 0xe0, 0x00, 0x3f, 0xc0, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80, 0x00, 0x3f, 0xc0, 0x00, 0x1f,
+    0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xf8, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x7f, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x04, 0xf7,
+    0x00,
 
     /*Unicode: U+f054 () , Width: 18 */
-    0x00, 0x00, 0x00,  //..................
-    0x18, 0x00, 0x00,  //...@@.............
-    0x3c, 0x00, 0x00,  //..@@@@............
-    0x7e, 0x00, 0x00,  //.@@@@@@...........
-    0x7f, 0x00, 0x00,  //+@@@@@@@..........
-    0x7f, 0x80, 0x00,  //.@@@@@@@@.........
-    0x3f, 0xc0, 0x00,  //..@@@@@@@@........
-    0x1f, 0xe0, 0x00,  //...@@@@@@@@.......
-    0x0f, 0xf0, 0x00,  //....@@@@@@@@......
-    0x07, 0xf8, 0x00,  //.....@@@@@@@@.....
-    0x03, 0xfc, 0x00,  //......@@@@@@@@....
-    0x01, 0xfe, 0x00,  //.......@@@@@@@@...
-    0x00, 0xff, 0x00,  //........@@@@@@@@..
-    0x00, 0x7f, 0x80,  //.........@@@@@@@@.
-    0x00, 0x7f, 0x80,  //.........@@@@@@@@.
-    0x00, 0xff, 0x00,  //........@@@@@@@@..
-    0x01, 0xfe, 0x00,  //.......@@@@@@@@...
-    0x03, 0xfc, 0x00,  //......@@@@@@@@....
-    0x07, 0xf8, 0x00,  //.....@@@@@@@@.....
-    0x0f, 0xf0, 0x00,  //....@@@@@@@@......
-    0x1f, 0xe0, 0x00,  //...@@@@@@@@.......
-    0x3f, 0xc0, 0x00,  //..@@@@@@@@........
-    0x7f, 0x80, 0x00,  //.@@@@@@@@.........
-    0x7f, 0x00, 0x00,  //+@@@@@@@..........
-    0x7e, 0x00, 0x00,  //.%@@@@@...........
-    0x3c, 0x00, 0x00,  //..%@@@............
-    0x18, 0x00, 0x00,  //...%@.............
-    0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00,  //..................
-
+    0xfe, 0x00, 0x4b, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x80, 0x00, 0x3f, 0xc0, 0x00, 0x1f, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x07, 0xf8, 0x00, 0x03, 0xfc,
+    0x00, 0x01, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80, 0x00, 0xff, 0x00,
+    0x01, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xe0, 0x00, 0x3f,
+    0xc0, 0x00, 0x7f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x18, 0xf6,
+    0x00,
 
     /*Unicode: U+f067 () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x7c, 0x00,  //.........%@@@%.........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfe, 0x00,  //.+++++++@@@@@@%+++++++.
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xfc,  //+%%%%%%%@@@@@@@%%%%%%%.
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0xfc, 0x00,  //........%@@@@@+........
-    0x00, 0x7c, 0x00,  //........+@@@@@.........
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xfa, 0x00, 0x42, 0x7c, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+    0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfe, 0x00, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x00,
+    0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+    0x00, 0x00, 0xfc, 0x00, 0x00, 0x7c, 0xf1, 0x00,
 
     /*Unicode: U+f068 () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0xff, 0xff, 0xfc,  //%@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xfc,  //+@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xe0, 0x00, 0x11, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff,
+    0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xda, 0x00,
 
     /*Unicode: U+f071 () , Width: 29 */
-    0x00, 0x07, 0x00, 0x00,  //.............%@%.............
-    0x00, 0x0f, 0x80, 0x00,  //............%@@@%............
-    0x00, 0x0f, 0x80, 0x00,  //............@@@@@............
-    0x00, 0x1f, 0xc0, 0x00,  //...........%@@@@@%...........
-    0x00, 0x1f, 0xc0, 0x00,  //...........@@@@@@@...........
-    0x00, 0x3f, 0xe0, 0x00,  //..........%@@@@@@@%..........
-    0x00, 0x3f, 0xe0, 0x00,  //..........@@@@@@@@@..........
-    0x00, 0x7f, 0xf0, 0x00,  //.........@@@@@@@@@@@.........
-    0x00, 0x70, 0x70, 0x00,  //........+@@@+++++@@@+........
-    0x00, 0xf0, 0x78, 0x00,  //........@@@@.....@@@@........
-    0x00, 0xf0, 0x78, 0x00,  //.......+@@@@.....@@@@+.......
-    0x01, 0xf0, 0x7c, 0x00,  //.......@@@@@+...+@@@@@.......
-    0x01, 0xf0, 0x7c, 0x00,  //......+@@@@@+...+@@@@@+......
-    0x03, 0xf0, 0x7e, 0x00,  //......@@@@@@+...+@@@@@@......
-    0x07, 0xf0, 0x7f, 0x00,  //.....%@@@@@@+...+@@@@@@%.....
-    0x07, 0xf0, 0x7f, 0x00,  //.....@@@@@@@+...+@@@@@@@.....
-    0x0f, 0xf8, 0xff, 0x80,  //....%@@@@@@@%...%@@@@@@@%....
-    0x0f, 0xff, 0xff, 0x80,  //....@@@@@@@@@@@@@@@@@@@@@....
-    0x1f, 0xff, 0xff, 0xc0,  //...%@@@@@@@@@@@@@@@@@@@@@%...
-    0x1f, 0xf0, 0x7f, 0xc0,  //..+@@@@@@@@@+...+@@@@@@@@@+..
-    0x3f, 0xf0, 0x7f, 0xe0,  //..@@@@@@@@@@+...+@@@@@@@@@@..
-    0x3f, 0xf0, 0x7f, 0xe0,  //.+@@@@@@@@@@+...+@@@@@@@@@@+.
-    0x7f, 0xf8, 0xff, 0xf0,  //.@@@@@@@@@@@%...%@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xf0,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xf0,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0x01, 0x00, 0x07, 0xfe, 0x00, 0x5a, 0x0f, 0x80, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x1f, 0xc0,
+    0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x7f, 0xf0,
+    0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x00, 0xf0, 0x78, 0x00, 0x01, 0xf0, 0x7c,
+    0x00, 0x01, 0xf0, 0x7c, 0x00, 0x03, 0xf0, 0x7e, 0x00, 0x07, 0xf0, 0x7f, 0x00, 0x07, 0xf0, 0x7f,
+    0x00, 0x0f, 0xf8, 0xff, 0x80, 0x0f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x7f,
+    0xc0, 0x3f, 0xf0, 0x7f, 0xe0, 0x3f, 0xf0, 0x7f, 0xe0, 0x7f, 0xf8, 0xff, 0xf0, 0x7f, 0xff, 0xff,
+    0xf0, 0xfe, 0xff, 0x00, 0xf8, 0xfe, 0xff, 0x04, 0xf8, 0x7f, 0xff, 0xff, 0xf0, 0xf5, 0x00,
 
     /*Unicode: U+f074 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x01, 0x00,  //.......................@+....
-    0x00, 0x00, 0x01, 0x80,  //.......................@@+...
-    0x00, 0x00, 0x01, 0xc0,  //.......................@@@+..
-    0xfc, 0x00, 0x7f, 0xe0,  //%%%%%%+.........+%%%%%@@@@@+.
-    0xff, 0x03, 0xff, 0xf0,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xff, 0xc7, 0xff, 0xf8,  //@@@@@@@@@+...%@@@@@@@@@@@@@@@
-    0xff, 0xcf, 0xff, 0xf0,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0x07, 0xcf, 0xc3, 0xe0,  //+++++%@@@@++@@@@@%++++%@@@@..
-    0x01, 0xdf, 0x01, 0xc0,  //......+@@@.@@@@@.......@@@...
-    0x00, 0x9e, 0x01, 0x80,  //.......+@++@@@@........@@....
-    0x00, 0xbe, 0x01, 0x00,  //........%.@@@@%........@.....
-    0x00, 0x3c, 0x00, 0x00,  //.........+@@@@...............
-    0x00, 0x7c, 0x00, 0x00,  //.........@@@@%...............
-    0x00, 0x78, 0x00, 0x00,  //........+@@@@................
-    0x00, 0xfa, 0x01, 0x00,  //........@@@@@.%........@.....
-    0x00, 0xf6, 0x01, 0x80,  //.......+@@@@+%@........@@....
-    0x01, 0xf7, 0x01, 0xc0,  //.......@@@@@.@@@.......@@@...
-    0x07, 0xef, 0xc3, 0xe0,  //+++++%@@@@@.%@@@@%++++%@@@@..
-    0xff, 0xcf, 0xff, 0xf0,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0xff, 0xc7, 0xff, 0xf8,  //@@@@@@@@@%...@@@@@@@@@@@@@@@@
-    0xff, 0x03, 0xff, 0xf0,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xfc, 0x00, 0x7f, 0xe0,  //%@@@%%+.........+%%@@@@@@@@+.
-    0x00, 0x00, 0x01, 0xc0,  //.......................@@@+..
-    0x00, 0x00, 0x01, 0x80,  //.......................@@+...
-    0x00, 0x00, 0x01, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xfb, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x27, 0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0xfc, 0x00, 0x7f,
+    0xe0, 0xff, 0x03, 0xff, 0xf0, 0xff, 0xc7, 0xff, 0xf8, 0xff, 0xcf, 0xff, 0xf0, 0x07, 0xcf, 0xc3,
+    0xe0, 0x01, 0xdf, 0x01, 0xc0, 0x00, 0x9e, 0x01, 0x80, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x3c, 0xfe,
+    0x00, 0x00, 0x7c, 0xfe, 0x00, 0x00, 0x78, 0xfe, 0x00, 0x29, 0xfa, 0x01, 0x00, 0x00, 0xf6, 0x01,
+    0x80, 0x01, 0xf7, 0x01, 0xc0, 0x07, 0xef, 0xc3, 0xe0, 0xff, 0xcf, 0xff, 0xf0, 0xff, 0xc7, 0xff,
+    0xf8, 0xff, 0x03, 0xff, 0xf0, 0xfc, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01,
+    0x80, 0x00, 0x00, 0x01, 0xf0, 0x00,
 
     /*Unicode: U+f077 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x0c, 0x00, 0x00,  //............@@.............
-    0x00, 0x1e, 0x00, 0x00,  //...........@@@@............
-    0x00, 0x3f, 0x00, 0x00,  //..........@@@@@@...........
-    0x00, 0x7f, 0x80, 0x00,  //.........@@@@@@@@..........
-    0x00, 0xff, 0xc0, 0x00,  //........@@@@@@@@@@.........
-    0x01, 0xff, 0xe0, 0x00,  //.......@@@@@@@@@@@@........
-    0x03, 0xff, 0xf0, 0x00,  //......@@@@@@@@@@@@@@.......
-    0x07, 0xff, 0xf8, 0x00,  //.....@@@@@@@@@@@@@@@@......
-    0x0f, 0xf3, 0xfc, 0x00,  //....@@@@@@@@+.@@@@@@@@.....
-    0x1f, 0xe1, 0xfe, 0x00,  //...@@@@@@@@+...@@@@@@@@....
-    0x3f, 0xc0, 0xff, 0x00,  //..@@@@@@@@+.....@@@@@@@@...
-    0x7f, 0x80, 0x7f, 0x80,  //.@@@@@@@@+.......@@@@@@@@..
-    0xff, 0x00, 0x3f, 0xc0,  //@@@@@@@@+.........@@@@@@@@.
-    0xfe, 0x00, 0x1f, 0xc0,  //@@@@@@@+...........@@@@@@@.
-    0x7c, 0x00, 0x0f, 0x80,  //.@@@@@+.............@@@@@..
-    0x38, 0x00, 0x07, 0x00,  //..@@@+...............@@@...
-    0x10, 0x00, 0x02, 0x00,  //...%+.................%....
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xe0, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x35, 0x7f,
+    0x80, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x07, 0xff,
+    0xf8, 0x00, 0x0f, 0xf3, 0xfc, 0x00, 0x1f, 0xe1, 0xfe, 0x00, 0x3f, 0xc0, 0xff, 0x00, 0x7f, 0x80,
+    0x7f, 0x80, 0xff, 0x00, 0x3f, 0xc0, 0xfe, 0x00, 0x1f, 0xc0, 0x7c, 0x00, 0x0f, 0x80, 0x38, 0x00,
+    0x07, 0x00, 0x10, 0x00, 0x02, 0xec, 0x00,
 
     /*Unicode: U+f078 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x18, 0x00, 0x07, 0x00,  //..+@@................%@%...
-    0x3c, 0x00, 0x0f, 0x80,  //.+@@@@..............%@@@%..
-    0x7e, 0x00, 0x1f, 0xc0,  //+@@@@@@............%@@@@@%.
-    0xff, 0x00, 0x3f, 0xc0,  //@@@@@@@@..........%@@@@@@@.
-    0x7f, 0x80, 0x7f, 0x80,  //+@@@@@@@@........%@@@@@@@+.
-    0x3f, 0xc0, 0xff, 0x00,  //.+@@@@@@@@......%@@@@@@@+..
-    0x1f, 0xe1, 0xfe, 0x00,  //..+@@@@@@@@....%@@@@@@@+...
-    0x0f, 0xf3, 0xfc, 0x00,  //...+@@@@@@@@..%@@@@@@@+....
-    0x07, 0xff, 0xf8, 0x00,  //....+@@@@@@@@%@@@@@@@+.....
-    0x03, 0xff, 0xf0, 0x00,  //.....+@@@@@@@@@@@@@@+......
-    0x01, 0xff, 0xe0, 0x00,  //......+@@@@@@@@@@@@+.......
-    0x00, 0xff, 0xc0, 0x00,  //.......+@@@@@@@@@@+........
-    0x00, 0x7f, 0x80, 0x00,  //........+@@@@@@@@+.........
-    0x00, 0x3f, 0x00, 0x00,  //.........+@@@@@@+..........
-    0x00, 0x1e, 0x00, 0x00,  //..........+@@@@+...........
-    0x00, 0x0c, 0x00, 0x00,  //...........+@@+............
-    0x00, 0x00, 0x00, 0x00,  //............++.............
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xdd, 0x00, 0x35, 0x18, 0x00, 0x07, 0x00, 0x3c, 0x00, 0x0f, 0x80, 0x7e, 0x00, 0x1f, 0xc0, 0xff,
+    0x00, 0x3f, 0xc0, 0x7f, 0x80, 0x7f, 0x80, 0x3f, 0xc0, 0xff, 0x00, 0x1f, 0xe1, 0xfe, 0x00, 0x0f,
+    0xf3, 0xfc, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,
+    0xff, 0xc0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x00,
+    0x0c, 0xeb, 0x00,
 
     /*Unicode: U+f079 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x06, 0x3f, 0xff, 0xe0,  //.....%@...%@@@@@@@@@@@@@@@@.....
-    0x0f, 0x1f, 0xff, 0xe0,  //....%@@@...@@@@@@@@@@@@@@@@.....
-    0x0f, 0x8f, 0xff, 0xe0,  //...+@@@@@...@@@@@@@@@@@@@@@.....
-    0x1f, 0xc7, 0xff, 0xe0,  //...@@@@@@%..+@@@@@@@@@@@@@@.....
-    0x3f, 0xc0, 0x01, 0xe0,  //..@@@@@@@@+...........+@@@@.....
-    0x7f, 0xe0, 0x01, 0xe0,  //.@@@@@@@@@@+...........@@@@.....
-    0xff, 0xf0, 0x01, 0xe0,  //%@@@@@@@@@@@...........@@@@.....
-    0xff, 0xf0, 0x01, 0xe0,  //@@@@@@@@@@@@+..........@@@@.....
-    0x0f, 0x00, 0x01, 0xe0,  //.+++@@@@+++............@@@@.....
-    0x0f, 0x00, 0x01, 0xe0,  //....@@@@+..............@@@@.....
-    0x0f, 0x00, 0x01, 0xe0,  //....@@@@+...........+++@@@@+++..
-    0x0f, 0x00, 0x1f, 0xfe,  //....@@@@+.........+@@@@@@@@@@@@.
-    0x0f, 0x00, 0x1f, 0xfe,  //....@@@@+..........@@@@@@@@@@@%.
-    0x0f, 0x00, 0x0f, 0xfc,  //....@@@@+...........@@@@@@@@@@..
-    0x0f, 0x00, 0x07, 0xf8,  //....@@@@+...........+@@@@@@@@...
-    0x0f, 0xff, 0xc7, 0xf0,  //....@@@@@@@@@@@@@@+..%@@@@@@+...
-    0x0f, 0xff, 0xe3, 0xe0,  //....@@@@@@@@@@@@@@@...%@@@@+....
-    0x0f, 0xff, 0xf1, 0xe0,  //....@@@@@@@@@@@@@@@@...@@@%.....
-    0x0f, 0xff, 0xf8, 0xc0,  //....@@@@@@@@@@@@@@@@%...@%......
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xe9, 0x00, 0x4b, 0x06, 0x3f, 0xff, 0xe0, 0x0f, 0x1f, 0xff, 0xe0, 0x0f, 0x8f, 0xff, 0xe0, 0x1f,
+    0xc7, 0xff, 0xe0, 0x3f, 0xc0, 0x01, 0xe0, 0x7f, 0xe0, 0x01, 0xe0, 0xff, 0xf0, 0x01, 0xe0, 0xff,
+    0xf0, 0x01, 0xe0, 0x0f, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x01, 0xe0, 0x0f, 0x00, 0x01, 0xe0, 0x0f,
+    0x00, 0x1f, 0xfe, 0x0f, 0x00, 0x1f, 0xfe, 0x0f, 0x00, 0x0f, 0xfc, 0x0f, 0x00, 0x07, 0xf8, 0x0f,
+    0xff, 0xc7, 0xf0, 0x0f, 0xff, 0xe3, 0xe0, 0x0f, 0xff, 0xf1, 0xe0, 0x0f, 0xff, 0xf8, 0xc0, 0xed,
+    0x00,
 
     /*Unicode: U+f07b () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x3f, 0xc0, 0x00, 0x00,  //..%@@@@@@%+................
-    0x7f, 0xf0, 0x00, 0x00,  //.@@@@@@@@@@%...............
-    0xff, 0xf0, 0x00, 0x00,  //%@@@@@@@@@@@...............
-    0xff, 0xf0, 0x00, 0x00,  //@@@@@@@@@@@@+..............
-    0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@@@%%%%%%%%%%%+..
-    0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xff, 0xc0,  //+@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3f, 0xff, 0xff, 0x80,  //.+@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf9, 0x00, 0x0f, 0x3f, 0xc0, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff,
+    0xf0, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+    0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+    0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+    0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe,
+    0xff, 0x00, 0xe0, 0xfe, 0xff, 0x08, 0xe0, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x80, 0xed,
+    0x00,
 
     /*Unicode: U+f093 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x04, 0x00, 0x00,  //.............%.............
-    0x00, 0x0e, 0x00, 0x00,  //............@@@............
-    0x00, 0x1f, 0x00, 0x00,  //...........@@@@@...........
-    0x00, 0x3f, 0x80, 0x00,  //..........@@@@@@@..........
-    0x00, 0x7f, 0xc0, 0x00,  //.........@@@@@@@@@.........
-    0x00, 0xff, 0xe0, 0x00,  //........@@@@@@@@@@@........
-    0x01, 0xff, 0xf0, 0x00,  //.......@@@@@@@@@@@@@.......
-    0x03, 0xff, 0xf8, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x07, 0xff, 0xfc, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x03, 0xff, 0xf8, 0x00,  //......%%%%@@@@@@@%%%%......
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x3f, 0x80, 0x00,  //..........%@@@@@%..........
-    0x00, 0x1f, 0x00, 0x00,  //..........+@@@@@...........
-    0xff, 0x80, 0x3f, 0xe0,  //%@@@@@@@@.........@@@@@@@@%
-    0xff, 0xc0, 0x7f, 0xe0,  //@@@@@@@@@@+.....+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xe6, 0x60,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xe6, 0x60,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xfc, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x42, 0x3f,
+    0x80, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x03, 0xff,
+    0xf8, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f,
+    0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x3f,
+    0x80, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x1f, 0x00, 0x00, 0xff, 0x80, 0x3f, 0xe0, 0xff, 0xc0,
+    0x7f, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x08, 0xe0, 0xff, 0xff, 0xe6, 0x60, 0xff, 0xff,
+    0xe6, 0x60, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x00, 0xe0, 0xf5, 0x00,
 
     /*Unicode: U+f095 () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x18, 0x00, 0x00,  //...%%+.................
-    0x3c, 0x00, 0x00,  //.+@@@@.................
-    0x7e, 0x00, 0x00,  //.@@@@@%................
-    0xfe, 0x00, 0x00,  //+@@@@@@................
-    0xff, 0x00, 0x00,  //@@@@@@@%...............
-    0xff, 0x00, 0x00,  //@@@@@@@@...............
-    0xff, 0x00, 0x00,  //@@@@@@@%...............
-    0xfe, 0x00, 0x00,  //%@@@@@%................
-    0x7c, 0x00, 0x00,  //+@@@@%.................
-    0x7c, 0x00, 0x00,  //.@@@@+.................
-    0x7c, 0x00, 0x00,  //.%@@@@.................
-    0x3e, 0x00, 0x00,  //..@@@@%................
-    0x3e, 0x00, 0x00,  //..%@@@@+...............
-    0x1f, 0x00, 0x00,  //...@@@@@...............
-    0x0f, 0x80, 0x00,  //...+@@@@@..............
-    0x07, 0xc0, 0xe0,  //....+@@@@@+.....%@%....
-    0x07, 0xf1, 0xf8,  //.....%@@@@@%...%@@@@%..
-    0x03, 0xff, 0xfc,  //......%@@@@@@+%@@@@@@@+
-    0x00, 0xff, 0xfe,  //.......+@@@@@@@@@@@@@@%
-    0x00, 0x7f, 0xfe,  //........+@@@@@@@@@@@@@%
-    0x00, 0x3f, 0xfc,  //..........%@@@@@@@@@@@.
-    0x00, 0x0f, 0xf8,  //............%@@@@@@@@+.
-    0x00, 0x01, 0xf0,  //..............+%@@@+...
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xfb, 0x00, 0x44, 0x18, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x7c, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0f, 0x80, 0x00,
+    0x07, 0xc0, 0xe0, 0x07, 0xf1, 0xf8, 0x03, 0xff, 0xfc, 0x00, 0xff, 0xfe, 0x00, 0x7f, 0xfe, 0x00,
+    0x3f, 0xfc, 0x00, 0x0f, 0xf8, 0x00, 0x01, 0xf0, 0xf2, 0x00,
 
     /*Unicode: U+f0c4 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x0c, 0x00, 0x00, 0x00,  //..++%++......................
-    0x7f, 0x80, 0x00, 0x00,  //.@@@@@@@+....................
-    0xff, 0xc0, 0x00, 0x00,  //@@@@@@@@@@...............+...
-    0xe1, 0xe0, 0x01, 0xf0,  //@@@+..+%@@@............%@%@%.
-    0xe0, 0x70, 0x07, 0x10,  //@@%.....+@@%.........%@%...@+
-    0xe0, 0x30, 0x0c, 0x30,  //@@@......+@@.......+@%....%@.
-    0xf0, 0x30, 0x30, 0x60,  //@@@%......@@.....+@%.....@%..
-    0x78, 0x70, 0xc0, 0x80,  //+@@@@+...%@@....@@+....+@+...
-    0x3f, 0xfb, 0x03, 0x00,  //.+@@@@@@@@@%@+%@+.....%@.....
-    0x1f, 0xee, 0x06, 0x00,  //...%@@@@@@@.%@+......%%......
-    0x03, 0x38, 0x0c, 0x00,  //.....+%%+.@@@.......@%.......
-    0x00, 0x1b, 0x10, 0x00,  //...........%@.@@..+@+........
-    0x00, 0x1b, 0x78, 0x00,  //..........+@%.%@.%@@%........
-    0x0f, 0xe0, 0xcc, 0x00,  //....%@@@@%@+..+.%%..%@.......
-    0x3f, 0xef, 0x02, 0x00,  //..%@@@@@@@@.%@@@+....+@+.....
-    0x7f, 0xf9, 0x81, 0x80,  //.@@@@@%%%@@@%.+@@+.....@%....
-    0xf0, 0x30, 0x60, 0xc0,  //%@@@+....+@@....+@@+....%@...
-    0xe0, 0x30, 0x18, 0x20,  //@@@.......@@......+@%....+@+.
-    0xe0, 0x70, 0x06, 0x10,  //@@%......@@%........+@%....@+
-    0xe0, 0xe0, 0x03, 0xb0,  //@@@....+@@@...........%@%.%@.
-    0xff, 0xc0, 0x00, 0xc0,  //@@@@%%@@@@+.............%@+..
-    0x7f, 0x80, 0x00, 0x00,  //+@@@@@@@@+...................
-    0x3e, 0x00, 0x00, 0x00,  //..%@@@%+.....................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf1, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x54, 0x7f, 0x80, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xe1,
+    0xe0, 0x01, 0xf0, 0xe0, 0x70, 0x07, 0x10, 0xe0, 0x30, 0x0c, 0x30, 0xf0, 0x30, 0x30, 0x60, 0x78,
+    0x70, 0xc0, 0x80, 0x3f, 0xfb, 0x03, 0x00, 0x1f, 0xee, 0x06, 0x00, 0x03, 0x38, 0x0c, 0x00, 0x00,
+    0x1b, 0x10, 0x00, 0x00, 0x1b, 0x78, 0x00, 0x0f, 0xe0, 0xcc, 0x00, 0x3f, 0xef, 0x02, 0x00, 0x7f,
+    0xf9, 0x81, 0x80, 0xf0, 0x30, 0x60, 0xc0, 0xe0, 0x30, 0x18, 0x20, 0xe0, 0x70, 0x06, 0x10, 0xe0,
+    0xe0, 0x03, 0xb0, 0xff, 0xc0, 0x00, 0xc0, 0x7f, 0x80, 0x00, 0x00, 0x3e, 0xf2, 0x00,
 
     /*Unicode: U+f0c5 () , Width: 29 */
-    0x00, 0x7f, 0xc0, 0x00,  //........+@@@@@@@@@+..........
-    0x01, 0xff, 0xe0, 0x00,  //.......%@@@@@@@@@@@..........
-    0x03, 0xc0, 0x60, 0x00,  //......%@@@.......@@..........
-    0x07, 0xc0, 0x60, 0x00,  //.....%@@@@.......@@..........
-    0x0e, 0xc0, 0x60, 0x00,  //....%@@.@@.......@@..........
-    0x1c, 0xc0, 0x60, 0x00,  //...%@@..@@.......@@..........
-    0x38, 0xc0, 0x7f, 0xf0,  //..%@@...@@.......@@%@@@@@@@@+
-    0x70, 0xc0, 0x7f, 0xf8,  //.%@@....@@.......@@@@@@@@@@@@
-    0x7f, 0xc0, 0x78, 0x18,  //+@@@@@@@@@.......@@@@......@@
-    0xff, 0xc0, 0xf8, 0x18,  //@@@@@@@@@%......@@@@@......@@
-    0xc0, 0x01, 0xd8, 0x18,  //@@.............@@@.@@......@@
-    0xc0, 0x03, 0x98, 0x18,  //@@...........+@@@..@@......@@
-    0xc0, 0x07, 0x18, 0x18,  //@@..........+@@@...@@......@@
-    0xc0, 0x0e, 0x18, 0x18,  //@@.........+@@@....@@......@@
-    0xc0, 0x1c, 0x18, 0x18,  //@@.........@@@+....@@......@@
-    0xc0, 0x3f, 0xf8, 0x18,  //@@........%@@@@@@@@@@......@@
-    0xc0, 0x3f, 0xf0, 0x18,  //@@........@@@@@@@@@@+......@@
-    0xc0, 0x30, 0x00, 0x18,  //@@........@@+..............@@
-    0xc0, 0x30, 0x00, 0x18,  //@@........@@+..............@@
-    0xc0, 0x30, 0x00, 0x18,  //@@........@@+..............@@
-    0xc0, 0x30, 0x00, 0x18,  //@@........@@+..............@@
-    0xff, 0xf0, 0x00, 0x18,  //@@@@@@@@@@@@+..............@@
-    0xff, 0xf0, 0x00, 0x18,  //%@@@@@@@@@@@+..............@@
-    0x00, 0x30, 0x00, 0x18,  //..........@@+..............@@
-    0x00, 0x30, 0x00, 0x18,  //..........@@+..............@@
-    0x00, 0x30, 0x00, 0x18,  //..........@@+..............@@
-    0x00, 0x30, 0x00, 0x18,  //..........@@+..............@@
-    0x00, 0x3f, 0xff, 0xf8,  //..........@@@@@@@@@@@@@@@@@@@
-    0x00, 0x1f, 0xff, 0xf8,  //..........+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0x73, 0x00, 0x7f, 0xc0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x03, 0xc0, 0x60, 0x00, 0x07, 0xc0, 0x60,
+    0x00, 0x0e, 0xc0, 0x60, 0x00, 0x1c, 0xc0, 0x60, 0x00, 0x38, 0xc0, 0x7f, 0xf0, 0x70, 0xc0, 0x7f,
+    0xf8, 0x7f, 0xc0, 0x78, 0x18, 0xff, 0xc0, 0xf8, 0x18, 0xc0, 0x01, 0xd8, 0x18, 0xc0, 0x03, 0x98,
+    0x18, 0xc0, 0x07, 0x18, 0x18, 0xc0, 0x0e, 0x18, 0x18, 0xc0, 0x1c, 0x18, 0x18, 0xc0, 0x3f, 0xf8,
+    0x18, 0xc0, 0x3f, 0xf0, 0x18, 0xc0, 0x30, 0x00, 0x18, 0xc0, 0x30, 0x00, 0x18, 0xc0, 0x30, 0x00,
+    0x18, 0xc0, 0x30, 0x00, 0x18, 0xff, 0xf0, 0x00, 0x18, 0xff, 0xf0, 0x00, 0x18, 0x00, 0x30, 0x00,
+    0x18, 0x00, 0x30, 0x00, 0x18, 0x00, 0x30, 0x00, 0x18, 0x00, 0x30, 0x00, 0x18, 0x00, 0x3f, 0xff,
+    0xf8, 0x00, 0x1f, 0xff, 0xf8, 0xfd, 0x00,
 
     /*Unicode: U+f0c7 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x7f, 0xff, 0xc0, 0x00,  //+@@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xf0, 0x00,  //@@@@@@@@@@@@@@@@@@@%.....
-    0xcf, 0xc1, 0xb8, 0x00,  //@@..@@@@@@+....@@.@@%....
-    0xcf, 0xc1, 0x9c, 0x00,  //@@..@@@@@@.....@@..@@%...
-    0xcf, 0xc1, 0x8e, 0x00,  //@@..@@@@@@.....@@...@@%..
-    0xcf, 0xc1, 0x87, 0x00,  //@@..@@@@@@.....@@....@@%.
-    0xcf, 0xc1, 0x83, 0x00,  //@@..@@@@@@.....@@.....@@+
-    0xcf, 0xc1, 0x81, 0x80,  //@@..@@@@@@.....@@.....+@@
-    0xcf, 0xc1, 0x81, 0x80,  //@@..@@@@@@+....@@......@@
-    0xcf, 0xff, 0x81, 0x80,  //@@..@@@@@@@@@@@@@......@@
-    0xc7, 0xff, 0x01, 0x80,  //@@..+@@@@@@@@@@@+......@@
-    0xc0, 0x00, 0x01, 0x80,  //@@.....................@@
-    0xc0, 0x00, 0x01, 0x80,  //@@.....................@@
-    0xc0, 0x00, 0x01, 0x80,  //@@.....................@@
-    0xc0, 0x00, 0x01, 0x80,  //@@.....................@@
-    0xcf, 0xff, 0xf9, 0x80,  //@@..%@@@@@@@@@@@@@@@%..@@
-    0xcf, 0xff, 0xf9, 0x80,  //@@..@@@@@@@@@@@@@@@@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xcc, 0x00, 0x19, 0x80,  //@@..@@.............@@..@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf9, 0x00, 0x5b, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xcf, 0xc1, 0xb8, 0x00, 0xcf,
+    0xc1, 0x9c, 0x00, 0xcf, 0xc1, 0x8e, 0x00, 0xcf, 0xc1, 0x87, 0x00, 0xcf, 0xc1, 0x83, 0x00, 0xcf,
+    0xc1, 0x81, 0x80, 0xcf, 0xc1, 0x81, 0x80, 0xcf, 0xff, 0x81, 0x80, 0xc7, 0xff, 0x01, 0x80, 0xc0,
+    0x00, 0x01, 0x80, 0xc0, 0x00, 0x01, 0x80, 0xc0, 0x00, 0x01, 0x80, 0xc0, 0x00, 0x01, 0x80, 0xcf,
+    0xff, 0xf9, 0x80, 0xcf, 0xff, 0xf9, 0x80, 0xcc, 0x00, 0x19, 0x80, 0xcc, 0x00, 0x19, 0x80, 0xcc,
+    0x00, 0x19, 0x80, 0xcc, 0x00, 0x19, 0x80, 0xcc, 0x00, 0x19, 0x80, 0xcc, 0x00, 0x19, 0x80, 0xfe,
+    0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xf5, 0x00,
 
     /*Unicode: U+f0e7 () , Width: 15 */
-    0x00, 0x00,  //...............
-    0x00, 0x00,  //...............
-    0x1f, 0xc0,  //...%@@@@@@.....
-    0x1f, 0xc0,  //...@@@@@@@.....
-    0x1f, 0x80,  //...@@@@@@+.....
-    0x1f, 0x80,  //..+@@@@@@......
-    0x3f, 0x80,  //..%@@@@@%......
-    0x3f, 0x00,  //..@@@@@@+......
-    0x3f, 0x00,  //..@@@@@@.......
-    0x3f, 0x1c,  //.+@@@@@%..+%@@+
-    0x7f, 0xfc,  //.%@@@@@%@@@@@@.
-    0x7f, 0xfc,  //.@@@@@@@@@@@@%.
-    0x7f, 0xf8,  //.@@@@@@@@@@@@..
-    0x7f, 0xf8,  //+@@@@@@@@@@@%..
-    0xff, 0xf0,  //%@@@@@@@@@@@+..
-    0xfd, 0xf0,  //@@@@@%+%@@@@...
-    0xc1, 0xe0,  //%%+....@@@@+...
-    0x01, 0xe0,  //.......@@@@....
-    0x01, 0xc0,  //......+@@@+....
-    0x03, 0xc0,  //......%@@@.....
-    0x03, 0x80,  //......@@@+.....
-    0x03, 0x80,  //......@@@......
-    0x03, 0x80,  //.....+@@%......
-    0x07, 0x00,  //.....%@@.......
-    0x07, 0x00,  //.....@@%.......
-    0x06, 0x00,  //.....@@........
-    0x06, 0x00,  //....+@%........
-    0x0c, 0x00,  //....%@.........
-    0x0c, 0x00,  //....%%.........
-    0x00, 0x00,  //...............
-
+    0xfd, 0x00, 0x34, 0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0x80, 0x1f, 0x80, 0x3f, 0x80, 0x3f, 0x00, 0x3f,
+    0x00, 0x3f, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x7f, 0xf8, 0x7f, 0xf8, 0xff, 0xf0, 0xfd, 0xf0, 0xc1,
+    0xe0, 0x01, 0xe0, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07,
+    0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0xfe, 0x00,
 
     /*Unicode: U+f0f3 () , Width: 27 */
-    0x00, 0x04, 0x00, 0x00,  //............+%+............
-    0x00, 0x0e, 0x00, 0x00,  //............@@@............
-    0x00, 0x0e, 0x00, 0x00,  //...........+@@@+...........
-    0x00, 0x7f, 0xc0, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0xff, 0xe0, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x01, 0xff, 0xf0, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x03, 0xff, 0xf8, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x03, 0xff, 0xf8, 0x00,  //.....+@@@@@@@@@@@@@@@+.....
-    0x07, 0xff, 0xfc, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x07, 0xff, 0xfc, 0x00,  //.....@@@@@@@@@@@@@@@@%.....
-    0x07, 0xff, 0xfc, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x07, 0xff, 0xfc, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x07, 0xff, 0xfc, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x07, 0xff, 0xfc, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x07, 0xff, 0xfc, 0x00,  //....+@@@@@@@@@@@@@@@@@.....
-    0x0f, 0xff, 0xfc, 0x00,  //....%@@@@@@@@@@@@@@@@@+....
-    0x0f, 0xff, 0xfe, 0x00,  //....@@@@@@@@@@@@@@@@@@%....
-    0x0f, 0xff, 0xfe, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x1f, 0xff, 0xff, 0x00,  //...%@@@@@@@@@@@@@@@@@@@%...
-    0x1f, 0xff, 0xff, 0x00,  //...@@@@@@@@@@@@@@@@@@@@@...
-    0x3f, 0xff, 0xff, 0x80,  //..@@@@@@@@@@@@@@@@@@@@@@%..
-    0x7f, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@%.
-    0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xc0,  //.@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x00, 0x7f, 0xc0, 0x00,  //.........%%%@@@@@%.........
-    0x00, 0x2f, 0x80, 0x00,  //.........+@+@@@@@+.........
-    0x00, 0x37, 0x80, 0x00,  //..........%@+%@@%..........
-    0x00, 0x1f, 0x00, 0x00,  //...........%@@@%...........
-    0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x01, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x4a, 0x7f, 0xc0,
+    0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xf8,
+    0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfc,
+    0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xfc,
+    0x00, 0x0f, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff,
+    0x00, 0x3f, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0xff, 0x12,
+    0xe0, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x37, 0x80,
+    0x00, 0x00, 0x1f, 0xfb, 0x00,
 
     /*Unicode: U+f11c () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x7f, 0xff, 0xff, 0xfc,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xcc, 0xce, 0x66, 0x66,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xcc, 0xce, 0x66, 0x66,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xc0, 0x00, 0x00, 0x66,  //@@.......................@@..@@.
-    0xc0, 0x00, 0x00, 0x66,  //@@.......................@@..@@.
-    0xcf, 0x31, 0x99, 0xe6,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xcf, 0x31, 0x99, 0xe6,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xcc, 0xff, 0xfe, 0x66,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xcc, 0xff, 0xfe, 0x66,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xc0, 0x00, 0x00, 0x06,  //@@...........................@@.
-    0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xfc,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xe9, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x3c, 0xfe, 0xc0, 0x00, 0x00, 0x06, 0xc0,
+    0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x06, 0xcc, 0xce, 0x66, 0x66, 0xcc, 0xce, 0x66, 0x66, 0xc0,
+    0x00, 0x00, 0x66, 0xc0, 0x00, 0x00, 0x66, 0xcf, 0x31, 0x99, 0xe6, 0xcf, 0x31, 0x99, 0xe6, 0xc0,
+    0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x06, 0xcc, 0xff, 0xfe, 0x66, 0xcc, 0xff, 0xfe, 0x66, 0xc0,
+    0x00, 0x00, 0x06, 0xc0, 0x00, 0x00, 0x06, 0xfe, 0xff, 0x04, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0xed,
+    0x00,
 
     /*Unicode: U+f124 () , Width: 23 */
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x04,  //.....................%+
-    0x00, 0x00, 0x1e,  //...................%@@%
-    0x00, 0x00, 0x7c,  //.................%@@@@+
-    0x00, 0x01, 0xfc,  //...............%@@@@@@.
-    0x00, 0x07, 0xf8,  //.............%@@@@@@@+.
-    0x00, 0x1f, 0xf8,  //...........%@@@@@@@@@..
-    0x00, 0x7f, 0xf0,  //.........%@@@@@@@@@@+..
-    0x01, 0xff, 0xf0,  //.......%@@@@@@@@@@@@...
-    0x07, 0xff, 0xe0,  //.....%@@@@@@@@@@@@@+...
-    0x1f, 0xff, 0xe0,  //...%@@@@@@@@@@@@@@@....
-    0x7f, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@.....
-    0x7f, 0xff, 0x80,  //+%%%%%%%%%@@@@@@@+.....
-    0x00, 0x3f, 0x80,  //..........%@@@@@@......
-    0x00, 0x3f, 0x00,  //..........%@@@@@+......
-    0x00, 0x3f, 0x00,  //..........%@@@@@.......
-    0x00, 0x3e, 0x00,  //..........%@@@@+.......
-    0x00, 0x3e, 0x00,  //..........%@@@@........
-    0x00, 0x3c, 0x00,  //..........%@@@+........
-    0x00, 0x3c, 0x00,  //..........%@@@.........
-    0x00, 0x38, 0x00,  //..........%@@+.........
-    0x00, 0x38, 0x00,  //..........%@@..........
-    0x00, 0x10, 0x00,  //..........+@+..........
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00,  //.......................
-
+    0xf3, 0x00, 0x41, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x7c, 0x00, 0x01, 0xfc, 0x00, 0x07, 0xf8,
+    0x00, 0x1f, 0xf8, 0x00, 0x7f, 0xf0, 0x01, 0xff, 0xf0, 0x07, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x7f,
+    0xff, 0xc0, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0x80, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x10, 0xf7, 0x00,
 
     /*Unicode: U+f15b () , Width: 25 */
-    0x7f, 0xfc, 0x00, 0x00,  //+@@@@@@@@@@@@@+..........
-    0xff, 0xfc, 0x40, 0x00,  //@@@@@@@@@@@@@@+.+%.......
-    0xff, 0xfc, 0x60, 0x00,  //@@@@@@@@@@@@@@+.+@%......
-    0xff, 0xfc, 0x70, 0x00,  //@@@@@@@@@@@@@@+.+@@%.....
-    0xff, 0xfc, 0x78, 0x00,  //@@@@@@@@@@@@@@+.+@@@%....
-    0xff, 0xfc, 0x7c, 0x00,  //@@@@@@@@@@@@@@+.+@@@@%...
-    0xff, 0xfc, 0x7e, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@%..
-    0xff, 0xfc, 0x7f, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@@%.
-    0xff, 0xfc, 0x00, 0x00,  //@@@@@@@@@@@@@@+..+++++++.
-    0xff, 0xfe, 0x00, 0x00,  //@@@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@%%%%%%%%%
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x27, 0x7f, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x40, 0x00, 0xff, 0xfc, 0x60, 0x00, 0xff, 0xfc, 0x70,
+    0x00, 0xff, 0xfc, 0x78, 0x00, 0xff, 0xfc, 0x7c, 0x00, 0xff, 0xfc, 0x7e, 0x00, 0xff, 0xfc, 0x7f,
+    0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00,
+    0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00,
+    0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00,
+    0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00,
+    0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0xff, 0x03,
+    0x80, 0x7f, 0xff, 0xff, 0xfc, 0x00,
 
     /*Unicode: U+f1eb () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x1f, 0xf0, 0x00,  //..........+%%@@@@@@%+...........
-    0x00, 0xff, 0xff, 0x00,  //.......+%@@@@@@@@@@@@@@%........
-    0x03, 0xff, 0xff, 0xc0,  //.....+@@@@@@@@@@@@@@@@@@@%......
-    0x0f, 0xff, 0xff, 0xf0,  //....%@@@@@@@@@@@@@@@@@@@@@@%....
-    0x1f, 0xf0, 0x1f, 0xf8,  //..+@@@@@@@@%++....+%@@@@@@@@@...
-    0x7f, 0x80, 0x03, 0xfc,  //.%@@@@@@@+............%@@@@@@@+.
-    0xfe, 0x00, 0x00, 0xfe,  //%@@@@@@+................%@@@@@@+
-    0xfc, 0x1f, 0xf0, 0x3f,  //@@@@@@.....%@@@@@@@%+.....@@@@@%
-    0x78, 0x7f, 0xfe, 0x1e,  //.@@@%...+@@@@@@@@@@@@@@+...@@@%.
-    0x21, 0xff, 0xff, 0x8c,  //..@+..+@@@@@@@@@@@@@@@@@@...%%..
-    0x03, 0xff, 0xff, 0xc0,  //.....+@@@@@@@@@@@@@@@@@@@@+.....
-    0x07, 0xf8, 0x1f, 0xe0,  //....+@@@@@@@%+....+%@@@@@@@.....
-    0x07, 0xc0, 0x03, 0xe0,  //.....@@@@@...........+@@@@%.....
-    0x03, 0x0f, 0xe1, 0xc0,  //......@@+...%@@@@@%+...%@%......
-    0x00, 0x3f, 0xfc, 0x00,  //..........%@@@@@@@@@@+..........
-    0x00, 0x7f, 0xfe, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x7f, 0xfe, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x3c, 0x3c, 0x00,  //..........@@@%....%@@%..........
-    0x00, 0x00, 0x00, 0x00,  //...........+........+...........
-    0x00, 0x03, 0xc0, 0x00,  //..............%@@%..............
-    0x00, 0x07, 0xc0, 0x00,  //.............%@@@@+.............
-    0x00, 0x03, 0xc0, 0x00,  //..............@@@%..............
-    0x00, 0x01, 0x80, 0x00,  //...............%%...............
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xf8, 0x00, 0x45, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x0f, 0xff,
+    0xff, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8, 0x7f, 0x80, 0x03, 0xfc, 0xfe, 0x00, 0x00, 0xfe, 0xfc, 0x1f,
+    0xf0, 0x3f, 0x78, 0x7f, 0xfe, 0x1e, 0x21, 0xff, 0xff, 0x8c, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xf8,
+    0x1f, 0xe0, 0x07, 0xc0, 0x03, 0xe0, 0x03, 0x0f, 0xe1, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f,
+    0xfe, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x3c, 0x3c, 0xfb, 0x00, 0x0d, 0x03, 0xc0, 0x00, 0x00,
+    0x07, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0xec, 0x00,
 
     /*Unicode: U+f240 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@..+++++++++++++++++++++++++++..@@...
-    0xcf, 0xff, 0xff, 0xfe, 0x60,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@+..
-    0xcf, 0xff, 0xff, 0xfe, 0x78,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x78,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xcf, 0xff, 0xff, 0xfe, 0x70,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@+.
-    0xcf, 0xff, 0xff, 0xfe, 0x60,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xed, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x01, 0xe0, 0xc0, 0xfe, 0x00, 0x01,
+    0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x3d, 0x60, 0xcf, 0xff, 0xff, 0xfe, 0x60,
+    0xcf, 0xff, 0xff, 0xfe, 0x78, 0xcf, 0xff, 0xff, 0xfe, 0x18, 0xcf, 0xff, 0xff, 0xfe, 0x18, 0xcf,
+    0xff, 0xff, 0xfe, 0x18, 0xcf, 0xff, 0xff, 0xfe, 0x18, 0xcf, 0xff, 0xff, 0xfe, 0x18, 0xcf, 0xff,
+    0xff, 0xfe, 0x18, 0xcf, 0xff, 0xff, 0xfe, 0x18, 0xcf, 0xff, 0xff, 0xfe, 0x78, 0xcf, 0xff, 0xff,
+    0xfe, 0x70, 0xcf, 0xff, 0xff, 0xfe, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x00,
+    0x60, 0xfd, 0xff, 0x01, 0xe0, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xe8, 0x00,
 
     /*Unicode: U+f241 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@..+++++++++++++++++++++........@@...
-    0xcf, 0xff, 0xff, 0x80, 0x60,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@+..
-    0xcf, 0xff, 0xff, 0x80, 0x78,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x18,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xcf, 0xff, 0xff, 0x80, 0x78,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xcf, 0xff, 0xff, 0x80, 0x70,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@+.
-    0xcf, 0xff, 0xff, 0x80, 0x60,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xed, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x01, 0xe0, 0xc0, 0xfe, 0x00, 0x01,
+    0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x3d, 0x60, 0xcf, 0xff, 0xff, 0x80, 0x60,
+    0xcf, 0xff, 0xff, 0x80, 0x78, 0xcf, 0xff, 0xff, 0x80, 0x18, 0xcf, 0xff, 0xff, 0x80, 0x18, 0xcf,
+    0xff, 0xff, 0x80, 0x18, 0xcf, 0xff, 0xff, 0x80, 0x18, 0xcf, 0xff, 0xff, 0x80, 0x18, 0xcf, 0xff,
+    0xff, 0x80, 0x18, 0xcf, 0xff, 0xff, 0x80, 0x18, 0xcf, 0xff, 0xff, 0x80, 0x78, 0xcf, 0xff, 0xff,
+    0x80, 0x70, 0xcf, 0xff, 0xff, 0x80, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x00,
+    0x60, 0xfd, 0xff, 0x01, 0xe0, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xe8, 0x00,
 
     /*Unicode: U+f242 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@..++++++++++++++...............@@...
-    0xcf, 0xff, 0xc0, 0x00, 0x60,  //@@..@@@@@@@@@@@@@@+..............@@+..
-    0xcf, 0xff, 0xc0, 0x00, 0x78,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x18,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x78,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xcf, 0xff, 0xc0, 0x00, 0x70,  //@@..@@@@@@@@@@@@@@+..............@@@+.
-    0xcf, 0xff, 0xc0, 0x00, 0x60,  //@@..@@@@@@@@@@@@@@+..............@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xed, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x01, 0xe0, 0xc0, 0xfe, 0x00, 0x01,
+    0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x3d, 0x60, 0xcf, 0xff, 0xc0, 0x00, 0x60,
+    0xcf, 0xff, 0xc0, 0x00, 0x78, 0xcf, 0xff, 0xc0, 0x00, 0x18, 0xcf, 0xff, 0xc0, 0x00, 0x18, 0xcf,
+    0xff, 0xc0, 0x00, 0x18, 0xcf, 0xff, 0xc0, 0x00, 0x18, 0xcf, 0xff, 0xc0, 0x00, 0x18, 0xcf, 0xff,
+    0xc0, 0x00, 0x18, 0xcf, 0xff, 0xc0, 0x00, 0x18, 0xcf, 0xff, 0xc0, 0x00, 0x78, 0xcf, 0xff, 0xc0,
+    0x00, 0x70, 0xcf, 0xff, 0xc0, 0x00, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x00,
+    0x60, 0xfd, 0xff, 0x01, 0xe0, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xe8, 0x00,
 
     /*Unicode: U+f243 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@..++++++++.....................@@...
-    0xcf, 0xf0, 0x00, 0x00, 0x60,  //@@..@@@@@@@@+....................@@+..
-    0xcf, 0xf0, 0x00, 0x00, 0x78,  //@@..@@@@@@@@+....................@@@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x18,  //@@..@@@@@@@@+......................@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x78,  //@@..@@@@@@@@+....................@@@@.
-    0xcf, 0xf0, 0x00, 0x00, 0x70,  //@@..@@@@@@@@+....................@@@+.
-    0xcf, 0xf0, 0x00, 0x00, 0x60,  //@@..@@@@@@@@+....................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xed, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x01, 0xe0, 0xc0, 0xfe, 0x00, 0x01,
+    0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x3d, 0x60, 0xcf, 0xf0, 0x00, 0x00, 0x60,
+    0xcf, 0xf0, 0x00, 0x00, 0x78, 0xcf, 0xf0, 0x00, 0x00, 0x18, 0xcf, 0xf0, 0x00, 0x00, 0x18, 0xcf,
+    0xf0, 0x00, 0x00, 0x18, 0xcf, 0xf0, 0x00, 0x00, 0x18, 0xcf, 0xf0, 0x00, 0x00, 0x18, 0xcf, 0xf0,
+    0x00, 0x00, 0x18, 0xcf, 0xf0, 0x00, 0x00, 0x18, 0xcf, 0xf0, 0x00, 0x00, 0x78, 0xcf, 0xf0, 0x00,
+    0x00, 0x70, 0xcf, 0xf0, 0x00, 0x00, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x00,
+    0x60, 0xfd, 0xff, 0x01, 0xe0, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xe8, 0x00,
 
     /*Unicode: U+f244 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@+..
-    0xc0, 0x00, 0x00, 0x00, 0x78,  //@@...............................@@@%.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x18,  //@@.................................@@.
-    0xc0, 0x00, 0x00, 0x00, 0x78,  //@@...............................@@@@.
-    0xc0, 0x00, 0x00, 0x00, 0x70,  //@@...............................@@@+.
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xc0, 0x00, 0x00, 0x00, 0x60,  //@@...............................@@...
-    0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x7f, 0xff, 0xff, 0xff, 0xc0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xed, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff, 0x01, 0xe0, 0xc0, 0xfe, 0x00, 0x01,
+    0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60,
+    0xc0, 0xfe, 0x00, 0x01, 0x78, 0xc0, 0xfe, 0x00, 0x01, 0x18, 0xc0, 0xfe, 0x00, 0x01, 0x18, 0xc0,
+    0xfe, 0x00, 0x01, 0x18, 0xc0, 0xfe, 0x00, 0x01, 0x18, 0xc0, 0xfe, 0x00, 0x01, 0x18, 0xc0, 0xfe,
+    0x00, 0x01, 0x18, 0xc0, 0xfe, 0x00, 0x01, 0x18, 0xc0, 0xfe, 0x00, 0x01, 0x78, 0xc0, 0xfe, 0x00,
+    0x01, 0x70, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x01, 0x60, 0xc0, 0xfe, 0x00, 0x00,
+    0x60, 0xfd, 0xff, 0x01, 0xe0, 0x7f, 0xfe, 0xff, 0x00, 0xc0, 0xe8, 0x00,
 
     /*Unicode: U+f293 () , Width: 22 */
-    0x01, 0xfe, 0x00,  //......+%@@@@@%%.......
-    0x07, 0xff, 0x80,  //....+@@@@@@@@@@@%.....
-    0x1f, 0xff, 0xc0,  //...%@@@@@@%@@@@@@@....
-    0x1f, 0xdf, 0xe0,  //..+@@@@@@%.%@@@@@@@...
-    0x3f, 0xcf, 0xf0,  //..@@@@@@@%..%@@@@@@%..
-    0x7f, 0xc7, 0xf0,  //.%@@@@@@@%...%@@@@@@..
-    0x7f, 0xc3, 0xf0,  //.@@@@@@@@%....%@@@@@+.
-    0x7f, 0xc1, 0xf8,  //.@@@@@@@@%..+..%@@@@%.
-    0x7b, 0xc8, 0xf8,  //+@@@@.%@@%..@+..%@@@@.
-    0xf1, 0xcc, 0x78,  //%@@@+..%@%..@@...@@@@.
-    0xf8, 0xc8, 0xf8,  //%@@@@+..%%..@+..%@@@@+
-    0xfc, 0x01, 0xf8,  //@@@@@@+..+..+..%@@@@@+
-    0xfe, 0x03, 0xf8,  //@@@@@@@+......%@@@@@@+
-    0xff, 0x07, 0xf8,  //@@@@@@@@+....%@@@@@@@+
-    0xff, 0x87, 0xfc,  //@@@@@@@@@...+@@@@@@@@%
-    0xff, 0x07, 0xf8,  //@@@@@@@@+....%@@@@@@@+
-    0xfe, 0x03, 0xf8,  //@@@@@@@+......%@@@@@@+
-    0xfc, 0x01, 0xf8,  //@@@@@@+..+..+..%@@@@@+
-    0xf8, 0xc8, 0xf8,  //%@@@@+..%%..@+..%@@@@+
-    0xf1, 0xcc, 0x78,  //%@@@+..%@%..@@...@@@@.
-    0x7b, 0xc8, 0xf8,  //+@@@@.%@@%..@+..%@@@@.
-    0x7f, 0xc1, 0xf8,  //.@@@@@@@@%..+..%@@@@%.
-    0x7f, 0xc3, 0xf0,  //.@@@@@@@@%....%@@@@@+.
-    0x7f, 0xc7, 0xf0,  //.%@@@@@@@%...%@@@@@@..
-    0x3f, 0xcf, 0xf0,  //..@@@@@@@%..%@@@@@@%..
-    0x1f, 0xdf, 0xe0,  //..+@@@@@@%.%@@@@@@@...
-    0x1f, 0xff, 0xc0,  //...%@@@@@@%@@@@@@@....
-    0x07, 0xff, 0x80,  //....+@@@@@@@@@@@%.....
-    0x01, 0xfe, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x00,  //......................
-
-
+    0x55, 0x01, 0xfe, 0x00, 0x07, 0xff, 0x80, 0x1f, 0xff, 0xc0, 0x1f, 0xdf, 0xe0, 0x3f, 0xcf, 0xf0,
+    0x7f, 0xc7, 0xf0, 0x7f, 0xc3, 0xf0, 0x7f, 0xc1, 0xf8, 0x7b, 0xc8, 0xf8, 0xf1, 0xcc, 0x78, 0xf8,
+    0xc8, 0xf8, 0xfc, 0x01, 0xf8, 0xfe, 0x03, 0xf8, 0xff, 0x07, 0xf8, 0xff, 0x87, 0xfc, 0xff, 0x07,
+    0xf8, 0xfe, 0x03, 0xf8, 0xfc, 0x01, 0xf8, 0xf8, 0xc8, 0xf8, 0xf1, 0xcc, 0x78, 0x7b, 0xc8, 0xf8,
+    0x7f, 0xc1, 0xf8, 0x7f, 0xc3, 0xf0, 0x7f, 0xc7, 0xf0, 0x3f, 0xcf, 0xf0, 0x1f, 0xdf, 0xe0, 0x1f,
+    0xff, 0xc0, 0x07, 0xff, 0x80, 0x01, 0xfe, 0xfd, 0x00,
 
 #elif USE_LV_FONT_SYMBOL_30 == 2
     /*Unicode: U+f001 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x40,  //.....................+%%+
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xc0,  //..................+%@@@@@
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0,  //...............+@@@@@@@@@
-    0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xc0,  //...........+%@@@@@@@@@@@@
-    0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xc0,  //.........%@@@@@@@@@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0xff, 0xff, 0xfe, 0x43, 0xc0,  //........@@@@@@@@@@@%+..@@
-    0x00, 0x00, 0xff, 0xff, 0x90, 0x03, 0xc0,  //........@@@@@@@@%+.....@@
-    0x00, 0x00, 0xff, 0xe0, 0x00, 0x03, 0xc0,  //........@@@@@%.........@@
-    0x00, 0x00, 0xf4, 0x00, 0x00, 0x03, 0xc0,  //........@@+............@@
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0,  //........@@.............@@
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0,  //........@@.............@@
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0,  //........@@.............@@
-    0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0,  //........@@.............@@
-    0x00, 0x00, 0xf0, 0x00, 0x7f, 0xff, 0xc0,  //........@@......+@@@@@%@@
-    0x00, 0x00, 0xf0, 0x03, 0xff, 0xff, 0xc0,  //........@@.....@@@@@@@@@@
-    0x00, 0x00, 0xf0, 0x07, 0xff, 0xff, 0xc0,  //........@@....+@@@@@@@@@@
-    0x00, 0x00, 0xf0, 0x03, 0xff, 0xff, 0xc0,  //........@@.....@@@@@@@@@@
-    0x1b, 0xfe, 0xf0, 0x02, 0xff, 0xff, 0x40,  //.+%@@@@%@@.....%@@@@@@@@+
-    0xbf, 0xff, 0xf0, 0x00, 0x2f, 0xf4, 0x00,  //%@@@@@@@@@.......%@@@@+..
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xbf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@+...............
-    0x1b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+%@@@@%.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xee, 0x00, 0x01, 0x1a, 0x40, 0xfd, 0x00, 0x02, 0x06, 0xff, 0xc0, 0xfe, 0x00, 0x0d, 0x01, 0xff,
+    0xff, 0xc0, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0x02, 0xc0,
+    0x00, 0x00, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x00, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x00, 0xfd, 0xff,
+    0x02, 0xc0, 0x00, 0x00, 0xfd, 0xff, 0x65, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x43, 0xc0, 0x00,
+    0x00, 0xff, 0xff, 0x90, 0x03, 0xc0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xf4,
+    0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+    0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x03, 0xc0,
+    0x00, 0x00, 0xf0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00,
+    0xf0, 0x07, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0x1b, 0xfe, 0xf0, 0x02,
+    0xff, 0xff, 0x40, 0xbf, 0xff, 0xf0, 0x00, 0x2f, 0xf4, 0x00, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x02,
+    0xff, 0xff, 0xf0, 0xfd, 0x00, 0x02, 0xbf, 0xff, 0xd0, 0xfd, 0x00, 0x01, 0x1b, 0xfe, 0xf5, 0x00,
 
     /*Unicode: U+f008 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf4, 0x1f, 0x40, 0x00, 0x00, 0x07, 0xd0, 0x7c,  //@@+..+@@+.............+@@+..+@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf4, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@+...@@...............@@....@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc,  //@@@@@@@@...............@@@@@@@@.
-    0xf4, 0x1f, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x7c,  //@@+..+@@...............@@+..+@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf4, 0x1f, 0x40, 0x00, 0x00, 0x07, 0xd0, 0x7c,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf4, 0x0f, 0x40, 0x00, 0x00, 0x07, 0xc0, 0x3c,  //@@+...@@+.............+@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf4, 0x1f, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x7c,  //@@+..+@@...............@@+..+@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc,  //@@@@@@@@...............@@@@@@@@.
-    0xf4, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@+...@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf0, 0x0f, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x3c,  //@@....@@...............@@....@@.
-    0xf4, 0x0f, 0x40, 0x00, 0x00, 0x07, 0xc0, 0x3c,  //@@+...@@+.............+@@....@@.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xf1, 0x00, 0x00, 0x2f, 0xfb, 0xff, 0x01, 0xe0, 0xbf, 0xfb, 0xff, 0x0a, 0xfc, 0xf4, 0x1f, 0x40,
+    0x00, 0x00, 0x07, 0xd0, 0x7c, 0xf0, 0x0f, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe,
+    0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf4, 0x0f, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x3c, 0xff, 0xff, 0xfe,
+    0x00, 0x04, 0x03, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x04, 0x03, 0xff, 0xfc, 0xf4, 0x1f, 0xfe,
+    0x00, 0x04, 0x03, 0xd0, 0x7c, 0xf0, 0x0f, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe,
+    0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe, 0x00, 0x0a, 0x03, 0xc0, 0x3c, 0xf4, 0x1f, 0x40,
+    0x00, 0x00, 0x07, 0xd0, 0x7c, 0xfa, 0xff, 0x00, 0xfc, 0xfa, 0xff, 0x0a, 0xfc, 0xf4, 0x0f, 0x40,
+    0x00, 0x00, 0x07, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe,
+    0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf4, 0x1f, 0xfe, 0x00, 0x04, 0x03, 0xd0, 0x7c, 0xff, 0xff, 0xfe,
+    0x00, 0x04, 0x03, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x04, 0x03, 0xff, 0xfc, 0xf4, 0x0f, 0xfe,
+    0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x3c, 0xf0, 0x0f, 0xfe,
+    0x00, 0x0b, 0x03, 0xc0, 0x3c, 0xf4, 0x0f, 0x40, 0x00, 0x00, 0x07, 0xc0, 0x3c, 0xbf, 0xfb, 0xff,
+    0x01, 0xfc, 0x3f, 0xfb, 0xff, 0x00, 0xf0, 0xf9, 0x00,
 
     /*Unicode: U+f00b () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x7f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0xbf, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0xbf, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf1, 0x00, 0x02, 0x7f, 0xfe, 0x03, 0xfd, 0xff, 0x03, 0x40, 0xff, 0xff, 0x0b, 0xfd, 0xff, 0x03,
+    0xc0, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff,
+    0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xbf, 0xff, 0x07, 0xfd, 0xff, 0x00, 0x80, 0xe9, 0x00, 0x02,
+    0xbf, 0xff, 0x07, 0xfd, 0xff, 0x03, 0x80, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff,
+    0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x0b, 0xfd,
+    0xff, 0x03, 0xc0, 0x7f, 0xfe, 0x03, 0xfd, 0xff, 0x00, 0x40, 0xf1, 0x00, 0x02, 0xbf, 0xff, 0x07,
+    0xfd, 0xff, 0x03, 0x80, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x4b, 0xfd, 0xff,
+    0x03, 0xc0, 0xff, 0xff, 0x4b, 0xfd, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x0b, 0xfd, 0xff, 0x03, 0xc0,
+    0x7f, 0xfe, 0x03, 0xfd, 0xff, 0x00, 0x40, 0xd9, 0x00,
 
     /*Unicode: U+f00c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,  //.....................+...
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00,  //...................+@@@..
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00,  //..................+@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xc0,  //.................+@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0,  //................+@@@@@@@@
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x40,  //...............+@@@@@@@@+
-    0x02, 0x40, 0x00, 0x07, 0xff, 0xfd, 0x00,  //...%+.........+@@@@@@@@+.
-    0x0f, 0xd0, 0x00, 0x1f, 0xff, 0xf4, 0x00,  //..@@@+.......+@@@@@@@@+..
-    0x3f, 0xf4, 0x00, 0x7f, 0xff, 0xd0, 0x00,  //.@@@@@+.....+@@@@@@@@+...
-    0xff, 0xfd, 0x01, 0xff, 0xff, 0x40, 0x00,  //@@@@@@@+...+@@@@@@@@+....
-    0xff, 0xff, 0x47, 0xff, 0xfd, 0x00, 0x00,  //@@@@@@@@+.+@@@@@@@@+.....
-    0x7f, 0xff, 0xef, 0xff, 0xf4, 0x00, 0x00,  //+@@@@@@@@%@@@@@@@@+......
-    0x1f, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00,  //.+@@@@@@@@@@@@@@@+.......
-    0x07, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00,  //..+@@@@@@@@@@@@@+........
-    0x01, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@+.........
-    0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0x00,  //....+@@@@@@@@@+..........
-    0x00, 0x1f, 0xff, 0xd0, 0x00, 0x00, 0x00,  //.....+@@@@@@@+...........
-    0x00, 0x07, 0xff, 0x40, 0x00, 0x00, 0x00,  //......+@@@@@+............
-    0x00, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.......+@@@+.............
-    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,  //........+%+..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xd9, 0x00, 0x00, 0x10, 0xfc, 0x00, 0x01, 0x01, 0xfc, 0xfc, 0x00, 0x01, 0x07, 0xff, 0xfc, 0x00,
+    0x02, 0x1f, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0x7f, 0xff, 0xc0, 0xfe, 0x00, 0x2e, 0x01, 0xff, 0xff,
+    0x40, 0x02, 0x40, 0x00, 0x07, 0xff, 0xfd, 0x00, 0x0f, 0xd0, 0x00, 0x1f, 0xff, 0xf4, 0x00, 0x3f,
+    0xf4, 0x00, 0x7f, 0xff, 0xd0, 0x00, 0xff, 0xfd, 0x01, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff, 0x47,
+    0xff, 0xfd, 0x00, 0x00, 0x7f, 0xff, 0xef, 0xff, 0xf4, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x03, 0xd0,
+    0x00, 0x00, 0x07, 0xfe, 0xff, 0x06, 0x40, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfd, 0xfd, 0x00, 0x02,
+    0x7f, 0xff, 0xf4, 0xfd, 0x00, 0x02, 0x1f, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x07, 0xff, 0x40, 0xfd,
+    0x00, 0x01, 0x01, 0xfd, 0xfb, 0x00, 0x00, 0x64, 0xda, 0x00,
 
     /*Unicode: U+f00d () , Width: 20 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x02, 0xe0, 0x00, 0x02, 0xd0,  //...%@%.........%@+..
-    0x0b, 0xf8, 0x00, 0x0f, 0xf4,  //..%@@@%.......@@@@+.
-    0x2f, 0xfe, 0x00, 0x3f, 0xfd,  //.%@@@@@%.....@@@@@@+
-    0x3f, 0xff, 0x80, 0xff, 0xff,  //.@@@@@@@%...@@@@@@@@
-    0x3f, 0xff, 0xe3, 0xff, 0xff,  //.@@@@@@@@%.@@@@@@@@%
-    0x0f, 0xff, 0xff, 0xff, 0xfc,  //..@@@@@@@@@@@@@@@@@.
-    0x03, 0xff, 0xff, 0xff, 0xf0,  //...@@@@@@@@@@@@@@@..
-    0x00, 0xff, 0xff, 0xff, 0xc0,  //....@@@@@@@@@@@@@...
-    0x00, 0x3f, 0xff, 0xff, 0x00,  //.....@@@@@@@@@@@....
-    0x00, 0x1f, 0xff, 0xfc, 0x00,  //.....+@@@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xfe, 0x00,  //.....@@@@@@@@@@%....
-    0x00, 0xff, 0xff, 0xff, 0x80,  //....@@@@@@@@@@@@%...
-    0x03, 0xff, 0xff, 0xff, 0xe0,  //...@@@@@@@@@@@@@@%..
-    0x0f, 0xff, 0xff, 0xff, 0xf8,  //..@@@@@@@@@@@@@@@@%.
-    0x3f, 0xff, 0xf7, 0xff, 0xfe,  //.@@@@@@@@@+@@@@@@@@%
-    0x3f, 0xff, 0xc0, 0xff, 0xff,  //.@@@@@@@@...@@@@@@@@
-    0x3f, 0xff, 0x00, 0x3f, 0xfe,  //.@@@@@@@.....@@@@@@%
-    0x0f, 0xfc, 0x00, 0x0f, 0xf8,  //..@@@@@.......@@@@%.
-    0x03, 0xf0, 0x00, 0x03, 0xe0,  //...@@@.........@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-
+    0xe3, 0x00, 0x19, 0x02, 0xe0, 0x00, 0x02, 0xd0, 0x0b, 0xf8, 0x00, 0x0f, 0xf4, 0x2f, 0xfe, 0x00,
+    0x3f, 0xfd, 0x3f, 0xff, 0x80, 0xff, 0xff, 0x3f, 0xff, 0xe3, 0xff, 0xff, 0x0f, 0xfe, 0xff, 0x01,
+    0xfc, 0x03, 0xfe, 0xff, 0x01, 0xf0, 0x00, 0xfe, 0xff, 0x10, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0x00,
+    0x00, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x80, 0x03,
+    0xfe, 0xff, 0x01, 0xe0, 0x0f, 0xfe, 0xff, 0x19, 0xf8, 0x3f, 0xff, 0xf7, 0xff, 0xfe, 0x3f, 0xff,
+    0xc0, 0xff, 0xff, 0x3f, 0xff, 0x00, 0x3f, 0xfe, 0x0f, 0xfc, 0x00, 0x0f, 0xf8, 0x03, 0xf0, 0x00,
+    0x03, 0xe0, 0xe8, 0x00,
 
     /*Unicode: U+f011 () , Width: 25 */
-    0x00, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x00,  //...........@@+...........
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x28, 0x0f, 0xf0, 0x28, 0x00, 0x00,  //.....%%...@@@@...%%......
-    0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0x00,  //....@@@@..@@@@..@@@@.....
-    0x03, 0xff, 0x0f, 0xf0, 0xff, 0xc0, 0x00,  //...@@@@@..@@@@..@@@@@....
-    0x0b, 0xff, 0x0f, 0xf0, 0xbf, 0xf0, 0x00,  //..%@@@@@..@@@@..%@@@@@...
-    0x1f, 0xfc, 0x0f, 0xf0, 0x3f, 0xf4, 0x00,  //.+@@@@@...@@@@...@@@@@+..
-    0x3f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfc, 0x00,  //.@@@@@....@@@@....@@@@@..
-    0x7f, 0xd0, 0x0f, 0xf0, 0x03, 0xfd, 0x00,  //+@@@@+....@@@@.....@@@@+.
-    0xbf, 0xc0, 0x0f, 0xf0, 0x02, 0xfe, 0x00,  //%@@@@.....@@@@.....%@@@%.
-    0xff, 0x40, 0x0f, 0xf0, 0x01, 0xff, 0x00,  //@@@@+.....@@@@.....+@@@@.
-    0xff, 0x40, 0x0b, 0xf0, 0x00, 0xff, 0x00,  //@@@@+.....%@@@......@@@@.
-    0xff, 0x00, 0x01, 0x40, 0x00, 0xff, 0x00,  //@@@@.......++.......@@@@.
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //@@@@................@@@@.
-    0xff, 0x40, 0x00, 0x00, 0x00, 0xff, 0x00,  //@@@@+...............@@@@.
-    0xbf, 0x80, 0x00, 0x00, 0x02, 0xff, 0x00,  //%@@@%..............%@@@@.
-    0x7f, 0xc0, 0x00, 0x00, 0x03, 0xfd, 0x00,  //+@@@@..............@@@@+.
-    0x3f, 0xe0, 0x00, 0x00, 0x0b, 0xfc, 0x00,  //.@@@@%............%@@@@..
-    0x2f, 0xf4, 0x00, 0x00, 0x1f, 0xf8, 0x00,  //.+@@@@+..........+@@@@%..
-    0x0f, 0xfe, 0x00, 0x00, 0xbf, 0xf0, 0x00,  //..@@@@@%........%@@@@@...
-    0x03, 0xff, 0xe4, 0x0b, 0xff, 0xd0, 0x00,  //...@@@@@@%+...%@@@@@@+...
-    0x01, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //...+@@@@@@@@@@@@@@@@+....
-    0x00, 0x7f, 0xff, 0xff, 0xfd, 0x00, 0x00,  //....+@@@@@@@@@@@@@@+.....
-    0x00, 0x0b, 0xff, 0xff, 0xe0, 0x00, 0x00,  //......%@@@@@@@@@@%.......
-    0x00, 0x00, 0x7f, 0xfd, 0x00, 0x00, 0x00,  //........+@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x03, 0x00, 0x00, 0x03, 0xd0, 0xfc, 0x00, 0x01, 0x0f, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xf0, 0xfc,
+    0x00, 0x01, 0x0f, 0xf0, 0xfd, 0x00, 0x03, 0x28, 0x0f, 0xf0, 0x28, 0xfe, 0x00, 0x45, 0xff, 0x0f,
+    0xf0, 0xff, 0x00, 0x00, 0x03, 0xff, 0x0f, 0xf0, 0xff, 0xc0, 0x00, 0x0b, 0xff, 0x0f, 0xf0, 0xbf,
+    0xf0, 0x00, 0x1f, 0xfc, 0x0f, 0xf0, 0x3f, 0xf4, 0x00, 0x3f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfc, 0x00,
+    0x7f, 0xd0, 0x0f, 0xf0, 0x03, 0xfd, 0x00, 0xbf, 0xc0, 0x0f, 0xf0, 0x02, 0xfe, 0x00, 0xff, 0x40,
+    0x0f, 0xf0, 0x01, 0xff, 0x00, 0xff, 0x40, 0x0b, 0xf0, 0x00, 0xff, 0x00, 0xff, 0x00, 0x01, 0x40,
+    0x00, 0xff, 0x00, 0xff, 0xfd, 0x00, 0x03, 0xff, 0x00, 0xff, 0x40, 0xfe, 0x00, 0x2c, 0xff, 0x00,
+    0xbf, 0x80, 0x00, 0x00, 0x02, 0xff, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x3f, 0xe0,
+    0x00, 0x00, 0x0b, 0xfc, 0x00, 0x2f, 0xf4, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x00,
+    0xbf, 0xf0, 0x00, 0x03, 0xff, 0xe4, 0x0b, 0xff, 0xd0, 0x00, 0x01, 0xfd, 0xff, 0x06, 0x40, 0x00,
+    0x00, 0x7f, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0x03, 0x0b, 0xff, 0xff, 0xe0, 0xfd, 0x00, 0x01, 0x7f,
+    0xfd, 0xe9, 0x00,
 
     /*Unicode: U+f013 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x20, 0x1f, 0xfc, 0x02, 0x00, 0x00,  //.....%...+@@@@@....%.....
-    0x01, 0xfd, 0x2f, 0xfe, 0x1f, 0xc0, 0x00,  //...+@@@+.%@@@@@%.+@@@....
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x0b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0xff, 0xfd, 0x5f, 0xff, 0xc0, 0x00,  //....@@@@@@@+++@@@@@@@....
-    0x06, 0xff, 0xe0, 0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%.....%@@@@@%...
-    0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc0,  //@@@@@@@@@.......@@@@@@@@@
-    0xff, 0xff, 0x40, 0x00, 0x7f, 0xff, 0xc0,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0x40, 0x00, 0x7f, 0xff, 0xc0,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0x40, 0x00, 0x7f, 0xff, 0xc0,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc0,  //@@@@@@@@@.......@@@@@@@@@
-    0x02, 0xff, 0xe0, 0x02, 0xff, 0xe4, 0x00,  //...%@@@@@%.....%@@@@@%+..
-    0x00, 0xff, 0xf9, 0x1b, 0xff, 0xc0, 0x00,  //....@@@@@@%+.+%@@@@@@....
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x0b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x01, 0xfd, 0x2f, 0xfe, 0x1f, 0xd0, 0x00,  //...+@@@+.%@@@@@%.+@@@+...
-    0x00, 0x34, 0x0f, 0xfd, 0x07, 0x40, 0x00,  //.....@....@@@@@+..+@+....
-    0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf1, 0x00, 0x01, 0x0f, 0xfc, 0xfc, 0x00, 0x01, 0x0f, 0xfc, 0xfd, 0x00, 0x0d, 0x20, 0x1f, 0xfc,
+    0x02, 0x00, 0x00, 0x01, 0xfd, 0x2f, 0xfe, 0x1f, 0xc0, 0x00, 0x03, 0xfd, 0xff, 0x02, 0xf0, 0x00,
+    0x0b, 0xfd, 0xff, 0x02, 0xf8, 0x00, 0x03, 0xfd, 0xff, 0x02, 0xf0, 0x00, 0x01, 0xfd, 0xff, 0x41,
+    0xd0, 0x00, 0x00, 0xff, 0xfd, 0x5f, 0xff, 0xc0, 0x00, 0x06, 0xff, 0xe0, 0x02, 0xff, 0xe0, 0x00,
+    0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x40, 0x00, 0x7f, 0xff, 0xc0, 0xff, 0xff,
+    0x40, 0x00, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0x40, 0x00, 0x7f, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x00,
+    0xff, 0xff, 0xc0, 0x02, 0xff, 0xe0, 0x02, 0xff, 0xe4, 0x00, 0x00, 0xff, 0xf9, 0x1b, 0xff, 0xc0,
+    0x00, 0x01, 0xfd, 0xff, 0x02, 0xd0, 0x00, 0x03, 0xfd, 0xff, 0x02, 0xf0, 0x00, 0x0b, 0xfd, 0xff,
+    0x02, 0xf8, 0x00, 0x03, 0xfd, 0xff, 0x0e, 0xf4, 0x00, 0x01, 0xfd, 0x2f, 0xfe, 0x1f, 0xd0, 0x00,
+    0x00, 0x34, 0x0f, 0xfd, 0x07, 0x40, 0xfe, 0x00, 0x01, 0x0f, 0xfc, 0xfc, 0x00, 0x01, 0x0f, 0xfc,
+    0xe9, 0x00,
 
     /*Unicode: U+f014 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x02, 0xff, 0xfd, 0x00, 0x00,  //.......%@@@@@@@+.......
-    0x00, 0x07, 0xff, 0xff, 0x00, 0x00,  //......+@@@@@@@@@.......
-    0x00, 0x0f, 0x40, 0x0b, 0x80, 0x00,  //......@@+.....%@%......
-    0x00, 0x1f, 0x00, 0x03, 0xc0, 0x00,  //.....+@@.......@@......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x0f, 0x00, 0x00, 0x00, 0x07, 0x80,  //..@@..............+@%..
-    0x0f, 0x00, 0x00, 0x00, 0x07, 0x80,  //..@@..............+@%..
-    0x0f, 0x00, 0x00, 0x00, 0x07, 0x80,  //..@@..............+@%..
-    0x0f, 0x01, 0x01, 0x01, 0x07, 0x80,  //..@@...+...+...+..+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,  //..@@..@@+.%@+.+@%.+@%..
-    0x0f, 0x0b, 0x0b, 0x47, 0x47, 0x80,  //..@@..%@..%@+.+@+.+@%..
-    0x0f, 0x00, 0x00, 0x00, 0x07, 0x80,  //..@@..............+@%..
-    0x0f, 0x00, 0x00, 0x00, 0x07, 0x80,  //..@@..............+@%..
-    0x0f, 0x40, 0x00, 0x00, 0x0b, 0x80,  //..@@+.............%@%..
-    0x07, 0xff, 0xff, 0xff, 0xff, 0x00,  //..+@@@@@@@@@@@@@@@@@...
-    0x02, 0xff, 0xff, 0xff, 0xfd, 0x00,  //...%@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xf4, 0x00, 0x02, 0x02, 0xff, 0xfd, 0xfe, 0x00, 0x02, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x0a, 0x0f,
+    0x40, 0x0b, 0x80, 0x00, 0x00, 0x1f, 0x00, 0x03, 0xc0, 0x00, 0xfc, 0xff, 0x00, 0xf8, 0xfc, 0xff,
+    0x01, 0xf8, 0x0f, 0xfe, 0x00, 0x02, 0x07, 0x80, 0x0f, 0xfe, 0x00, 0x02, 0x07, 0x80, 0x0f, 0xfe,
+    0x00, 0x02, 0x07, 0x80, 0x0f, 0xfe, 0x01, 0x3e, 0x07, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,
+    0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47,
+    0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f,
+    0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80, 0x0f, 0x0f, 0x4b, 0x47, 0x87, 0x80,
+    0x0f, 0x0b, 0x0b, 0x47, 0x47, 0x80, 0x0f, 0xfe, 0x00, 0x02, 0x07, 0x80, 0x0f, 0xfe, 0x00, 0x08,
+    0x07, 0x80, 0x0f, 0x40, 0x00, 0x00, 0x0b, 0x80, 0x07, 0xfd, 0xff, 0x01, 0x00, 0x02, 0xfe, 0xff,
+    0x00, 0xfd, 0xee, 0x00,
 
     /*Unicode: U+f015 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x64, 0x02, 0xa8, 0x00,  //............+%+....%%%%....
-    0x00, 0x00, 0x02, 0xfe, 0x03, 0xfc, 0x00,  //...........%@@@%...@@@@....
-    0x00, 0x00, 0x0f, 0xff, 0xc3, 0xfc, 0x00,  //..........@@@@@@@..@@@@....
-    0x00, 0x00, 0x3f, 0xcf, 0xf7, 0xfc, 0x00,  //.........@@@@.@@@@+@@@@....
-    0x00, 0x01, 0xfe, 0x12, 0xff, 0xfc, 0x00,  //.......+@@@%.+.%@@@@@@@....
-    0x00, 0x0b, 0xf8, 0xb8, 0x7f, 0xfc, 0x00,  //......%@@@+.%@%.+@@@@@@....
-    0x00, 0x2f, 0xd3, 0xff, 0x1f, 0xfc, 0x00,  //.....%@@@+.@@@@@.+@@@@@....
-    0x00, 0xff, 0x1f, 0xff, 0xd3, 0xfc, 0x00,  //....@@@@.+@@@@@@@+.@@@@....
-    0x03, 0xfc, 0xbf, 0xff, 0xf8, 0xbf, 0x40,  //...@@@@.%@@@@@@@@@%.%@@@+..
-    0x1f, 0xe2, 0xff, 0xff, 0xfe, 0x2f, 0xe0,  //.+@@@%.%@@@@@@@@@@@%.%@@@%.
-    0x7f, 0x8f, 0xff, 0xff, 0xff, 0xc7, 0xf8,  //+@@@+.@@@@@@@@@@@@@@@.+@@@%
-    0x3d, 0x7f, 0xff, 0xff, 0xff, 0xf4, 0xf4,  //.@@++@@@@@@@@@@@@@@@@@+.@@+
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,  //....@@@@@@@@@@@@@@@@@@@..+.
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0xbf, 0xfc, 0x00, 0xff, 0xf8, 0x00,  //....%@@@@@@.....@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xe2, 0x00, 0x02, 0x64, 0x02, 0xa8, 0xfe, 0x00, 0x03, 0x02, 0xfe, 0x03, 0xfc, 0xfe, 0x00, 0x03,
+    0x0f, 0xff, 0xc3, 0xfc, 0xfe, 0x00, 0x30, 0x3f, 0xcf, 0xf7, 0xfc, 0x00, 0x00, 0x01, 0xfe, 0x12,
+    0xff, 0xfc, 0x00, 0x00, 0x0b, 0xf8, 0xb8, 0x7f, 0xfc, 0x00, 0x00, 0x2f, 0xd3, 0xff, 0x1f, 0xfc,
+    0x00, 0x00, 0xff, 0x1f, 0xff, 0xd3, 0xfc, 0x00, 0x03, 0xfc, 0xbf, 0xff, 0xf8, 0xbf, 0x40, 0x1f,
+    0xe2, 0xff, 0xff, 0xfe, 0x2f, 0xe0, 0x7f, 0x8f, 0xfe, 0xff, 0x03, 0xc7, 0xf8, 0x3d, 0x7f, 0xfe,
+    0xff, 0x02, 0xf4, 0xf4, 0x00, 0xfd, 0xff, 0x02, 0xfc, 0x10, 0x00, 0xfd, 0xff, 0x02, 0xfc, 0x00,
+    0x00, 0xfd, 0xff, 0x2a, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc,
+    0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xff,
+    0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xbf, 0xfc, 0x00, 0xff, 0xf8, 0xdd,
+    0x00,
 
     /*Unicode: U+f019 () , Width: 27 */
-    0x00, 0x00, 0x02, 0xaa, 0x00, 0x00, 0x00,  //...........%%%%%...........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x05, 0x5f, 0xff, 0xd5, 0x40, 0x00,  //......++++@@@@@@%++++......
-    0x00, 0x2f, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.....+@@@@@@@@@@@@@@@......
-    0x00, 0x07, 0xff, 0xff, 0xff, 0x40, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x00, 0x1f, 0xff, 0xd0, 0x00, 0x00,  //.........+@@@@@@@..........
-    0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00,  //..........+@@@@@...........
-    0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,  //...........+@@@............
-    0xbf, 0xff, 0xe0, 0x70, 0x3f, 0xff, 0xf8,  //%@@@@@@@@%..+@...%@@@@@@@@%
-    0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xfc,  //@@@@@@@@@@%.....@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@+.+@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7c, 0x7c,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7d, 0x7c,  //@@@@@@@@@@@@@@@@@@@.+@@++@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x03, 0x00, 0x00, 0x02, 0xaa, 0xfc, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff,
+    0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02,
+    0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfe,
+    0x00, 0x07, 0x05, 0x5f, 0xff, 0xd5, 0x40, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0x03, 0xe0, 0x00, 0x00,
+    0x1f, 0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x06, 0x40, 0x00, 0x00, 0x01, 0xff,
+    0xff, 0xfd, 0xfd, 0x00, 0x02, 0x7f, 0xff, 0xf4, 0xfd, 0x00, 0x02, 0x1f, 0xff, 0xd0, 0xfd, 0x00,
+    0x01, 0x07, 0xff, 0xfc, 0x00, 0x01, 0x01, 0xfc, 0xfe, 0x00, 0x0d, 0xbf, 0xff, 0xe0, 0x70, 0x3f,
+    0xff, 0xf8, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x03, 0x47, 0xff, 0xff, 0xfc,
+    0xfb, 0xff, 0x00, 0xfc, 0xfd, 0xff, 0x02, 0xfc, 0x7c, 0x7c, 0xfd, 0xff, 0x02, 0xfc, 0x7d, 0x7c,
+    0xfb, 0xff, 0x01, 0xfc, 0xbf, 0xfc, 0xff, 0x00, 0xf8, 0xde, 0x00,
 
     /*Unicode: U+f01c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x00,  //....+@@@@@@@@@@@@@@@.....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //....@@@@@@@@@@@@@@@@@....
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //...+@@@@@@@@@@@@@@@@@....
-    0x03, 0xf8, 0x00, 0x00, 0x0b, 0xe0, 0x00,  //...@@@%...........%@@%...
-    0x03, 0xf0, 0x00, 0x00, 0x07, 0xf0, 0x00,  //...@@@............+@@@...
-    0x0b, 0xe0, 0x00, 0x00, 0x03, 0xf8, 0x00,  //..%@@%.............@@@%..
-    0x0f, 0xd0, 0x00, 0x00, 0x01, 0xfc, 0x00,  //..@@@+.............+@@@..
-    0x2f, 0xc0, 0x00, 0x00, 0x00, 0xfd, 0x00,  //.%@@@...............@@@+.
-    0x3f, 0x40, 0x00, 0x00, 0x00, 0xbf, 0x00,  //.@@@+...............%@@@.
-    0x7f, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00,  //+@@@.................@@@.
-    0xbe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,  //%@@%.................@@@%
-    0xfe, 0x55, 0x00, 0x00, 0x15, 0x6f, 0xc0,  //@@@%++++.........++++%@@@
-    0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xc0,  //@@@@@@@@%.......@@@@@@@@@
-    0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xc0,  //@@@@@@@@@......+@@@@@@@@@
-    0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xc0,  //@@@@@@@@@%.....@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe4, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x02, 0x40, 0x00, 0x00, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x01,
+    0xfd, 0xff, 0x1f, 0xc0, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x00,
+    0x07, 0xf0, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0x01, 0xfc,
+    0x00, 0x2f, 0xc0, 0xfe, 0x00, 0x03, 0xfd, 0x00, 0x3f, 0x40, 0xfe, 0x00, 0x02, 0xbf, 0x00, 0x7f,
+    0xfd, 0x00, 0x02, 0x3f, 0x00, 0xbe, 0xfd, 0x00, 0x1d, 0x3f, 0x80, 0xfe, 0x55, 0x00, 0x00, 0x15,
+    0x6f, 0xc0, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb,
+    0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x01, 0xc0, 0xbf, 0xfc, 0xff, 0x00, 0x80,
+    0xde, 0x00,
 
     /*Unicode: U+f021 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x6f, 0xfe, 0x40, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x0b, 0xff, 0xff, 0xf4, 0x03, 0x80,  //......%@@@@@@@@@@@+....@%
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0x0f, 0xc0,  //.....@@@@@@@@@@@@@@@..@@@
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //....@@@@@@@@@@@@@@@@@@@@@
-    0x03, 0xff, 0xe4, 0x06, 0xff, 0xff, 0xc0,  //...@@@@@@%+...+%@@@@@@@@@
-    0x0f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xc0,  //..@@@@@@.........%@@@@@@@
-    0x1f, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xc0,  //.+@@@@%...........@@@@@@@
-    0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc0,  //.@@@@@...........@@@@@@@@
-    0x7f, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xc0,  //+@@@@...........@@@@@@@@@
-    0xbf, 0x80, 0x00, 0x00, 0xff, 0xff, 0xc0,  //%@@@%...........@@@@@@@@@
-    0x15, 0x00, 0x00, 0x00, 0x15, 0x55, 0x00,  //.+++.............+++++++.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x15, 0x55, 0x40, 0x00, 0x00, 0x15, 0x00,  //.++++++++............+++.
-    0xff, 0xff, 0xd0, 0x00, 0x00, 0xff, 0x40,  //@@@@@@@@@+..........@@@@+
-    0xff, 0xff, 0xc0, 0x00, 0x00, 0xff, 0x00,  //@@@@@@@@@...........@@@@.
-    0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00,  //@@@@@@@@...........@@@@@.
-    0xff, 0xfc, 0x00, 0x00, 0x0b, 0xfd, 0x00,  //@@@@@@@...........%@@@@+.
-    0xff, 0xff, 0x00, 0x00, 0x3f, 0xf8, 0x00,  //@@@@@@@@.........@@@@@%..
-    0xff, 0xff, 0xe4, 0x06, 0xff, 0xf0, 0x00,  //@@@@@@@@@%+...+%@@@@@@...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //@@@@@@@@@@@@@@@@@@@@@....
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@..@@@@@@@@@@@@@@@.....
-    0xf0, 0x0b, 0xff, 0xff, 0xf4, 0x00, 0x00,  //@@....%@@@@@@@@@@@+......
-    0x00, 0x00, 0x6f, 0xfe, 0x40, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf1, 0x00, 0x02, 0x6f, 0xfe, 0x40, 0xfe, 0x00, 0x07, 0x0b, 0xff, 0xff, 0xf4, 0x03, 0x80, 0x00,
+    0x3f, 0xfe, 0xff, 0x02, 0x0f, 0xc0, 0x00, 0xfc, 0xff, 0x2b, 0xc0, 0x03, 0xff, 0xe4, 0x06, 0xff,
+    0xff, 0xc0, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x1f, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xc0,
+    0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x7f, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xbf, 0x80,
+    0x00, 0x00, 0xff, 0xff, 0xc0, 0x15, 0xfe, 0x00, 0x01, 0x15, 0x55, 0xeb, 0x00, 0x30, 0x15, 0x55,
+    0x40, 0x00, 0x00, 0x15, 0x00, 0xff, 0xff, 0xd0, 0x00, 0x00, 0xff, 0x40, 0xff, 0xff, 0xc0, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x0b, 0xfd,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xff, 0xe4, 0x06, 0xff, 0xf0, 0x00, 0xfc,
+    0xff, 0x03, 0xc0, 0x00, 0xfc, 0x3f, 0xfe, 0xff, 0x06, 0x00, 0x00, 0xf0, 0x0b, 0xff, 0xff, 0xf4,
+    0xfd, 0x00, 0x02, 0x6f, 0xfe, 0x40, 0xea, 0x00,
 
     /*Unicode: U+f026 () , Width: 13 */
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x07, 0x00,  //..........+@.
-    0x00, 0x00, 0x2f, 0x40,  //.........%@@+
-    0x00, 0x00, 0xbf, 0x40,  //........%@@@+
-    0x00, 0x02, 0xff, 0x40,  //.......%@@@@+
-    0x00, 0x0b, 0xff, 0x40,  //......%@@@@@+
-    0x15, 0x6f, 0xff, 0x40,  //.++++%@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@+
-    0xbf, 0xff, 0xff, 0x40,  //%@@@@@@@@@@@+
-    0x00, 0x1f, 0xff, 0x40,  //......@@@@@@+
-    0x00, 0x07, 0xff, 0x40,  //.......@@@@@+
-    0x00, 0x01, 0xff, 0x40,  //........@@@@+
-    0x00, 0x00, 0x3f, 0x40,  //.........@@@+
-    0x00, 0x00, 0x0f, 0x40,  //..........@@+
-    0x00, 0x00, 0x02, 0x00,  //...........%.
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00,  //.............
-
+    0xeb, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x11, 0x2f, 0x40, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x02, 0xff,
+    0x40, 0x00, 0x0b, 0xff, 0x40, 0x15, 0x6f, 0xff, 0x40, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0xff, 0x00,
+    0x40, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0xff, 0x00,
+    0x40, 0xfe, 0xff, 0x1b, 0x40, 0xbf, 0xff, 0xff, 0x40, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x07, 0xff,
+    0x40, 0x00, 0x01, 0xff, 0x40, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x02,
+    0xec, 0x00,
 
     /*Unicode: U+f027 () , Width: 19 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x07, 0x00, 0x00,  //..........+@.......
-    0x00, 0x00, 0x2f, 0x40, 0x00,  //.........%@@+......
-    0x00, 0x00, 0xbf, 0x40, 0x00,  //........%@@@+......
-    0x00, 0x02, 0xff, 0x40, 0x00,  //.......%@@@@+......
-    0x00, 0x0b, 0xff, 0x40, 0x00,  //......%@@@@@+......
-    0x15, 0x6f, 0xff, 0x40, 0x00,  //.++++%@@@@@@+......
-    0xff, 0xff, 0xff, 0x43, 0xd0,  //@@@@@@@@@@@@+..@@+.
-    0xff, 0xff, 0xff, 0x43, 0xf0,  //@@@@@@@@@@@@+..@@@.
-    0xff, 0xff, 0xff, 0x40, 0xb8,  //@@@@@@@@@@@@+...%@%
-    0xff, 0xff, 0xff, 0x40, 0x3c,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0x40, 0x3c,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0x40, 0xf8,  //@@@@@@@@@@@@+...@@%
-    0xff, 0xff, 0xff, 0x43, 0xf0,  //@@@@@@@@@@@@+..@@@.
-    0xbf, 0xff, 0xff, 0x42, 0x80,  //%@@@@@@@@@@@+..%%..
-    0x00, 0x1f, 0xff, 0x40, 0x00,  //......@@@@@@+......
-    0x00, 0x07, 0xff, 0x40, 0x00,  //.......@@@@@+......
-    0x00, 0x01, 0xff, 0x40, 0x00,  //........@@@@+......
-    0x00, 0x00, 0x3f, 0x40, 0x00,  //.........@@@+......
-    0x00, 0x00, 0x0f, 0x40, 0x00,  //..........@@+......
-    0x00, 0x00, 0x02, 0x00, 0x00,  //...........%.......
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-
+    0xe6, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x01, 0x2f, 0x40, 0xfe, 0x00, 0x11, 0xbf, 0x40, 0x00, 0x00,
+    0x02, 0xff, 0x40, 0x00, 0x00, 0x0b, 0xff, 0x40, 0x00, 0x15, 0x6f, 0xff, 0x40, 0x00, 0xfe, 0xff,
+    0x01, 0x43, 0xd0, 0xfe, 0xff, 0x01, 0x43, 0xf0, 0xfe, 0xff, 0x01, 0x40, 0xb8, 0xfe, 0xff, 0x01,
+    0x40, 0x3c, 0xfe, 0xff, 0x01, 0x40, 0x3c, 0xfe, 0xff, 0x01, 0x40, 0xf8, 0xfe, 0xff, 0x14, 0x43,
+    0xf0, 0xbf, 0xff, 0xff, 0x42, 0x80, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x00, 0x07, 0xff, 0x40, 0x00,
+    0x00, 0x01, 0xff, 0x40, 0xfe, 0x00, 0x01, 0x3f, 0x40, 0xfe, 0x00, 0x01, 0x0f, 0x40, 0xfe, 0x00,
+    0x00, 0x02, 0xe6, 0x00,
 
     /*Unicode: U+f028 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x00,  //..................+@+......
-    0x00, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x0f, 0x40, 0x01, 0xfd, 0x00,  //..........@@+......+@@@....
-    0x00, 0x00, 0x3f, 0x40, 0x00, 0x2f, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0xff, 0x40, 0x3d, 0x0b, 0xc0,  //........@@@@+....@@+..%@@..
-    0x00, 0x03, 0xff, 0x40, 0x3f, 0x43, 0xd0,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x0f, 0xff, 0x40, 0x0b, 0xd1, 0xf0,  //......@@@@@@+.....%@@+.+@@.
-    0x6a, 0xbf, 0xff, 0x41, 0x02, 0xf0, 0xf4,  //+%%%%@@@@@@@+......%@@..@@+
-    0xff, 0xff, 0xff, 0x43, 0xe0, 0xf4, 0xb8,  //@@@@@@@@@@@@+..@@%..@@+.%@%
-    0xff, 0xff, 0xff, 0x42, 0xf4, 0x78, 0x7c,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xff, 0xff, 0x40, 0x7c, 0x3c, 0x3c,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0x40, 0x3c, 0x3c, 0x3c,  //@@@@@@@@@@@@+....@@..@@..@@
-    0xff, 0xff, 0xff, 0x40, 0x7c, 0x3c, 0x3c,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0x42, 0xf4, 0x78, 0x7c,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xff, 0xff, 0x43, 0xe0, 0xf4, 0xb8,  //@@@@@@@@@@@@+..@@%..@@+.+@%
-    0x6a, 0xbf, 0xff, 0x41, 0x02, 0xf0, 0xf4,  //+%%%%@@@@@@@+..+...%@@..@@+
-    0x00, 0x0f, 0xff, 0x40, 0x0b, 0xd1, 0xf0,  //......@@@@@@+.....%@@+.+@@.
-    0x00, 0x03, 0xff, 0x40, 0x3f, 0x43, 0xd0,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x00, 0xff, 0x40, 0x3d, 0x0b, 0xc0,  //........@@@@+....@@+..%@@..
-    0x00, 0x00, 0x3f, 0x40, 0x00, 0x2f, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0x0f, 0x40, 0x01, 0xfd, 0x00,  //..........@@+......+@@@+...
-    0x00, 0x00, 0x01, 0x00, 0x07, 0xf0, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xe8, 0x00, 0x01, 0x07, 0x40, 0xfe, 0x00, 0x03, 0x01, 0x00, 0x07, 0xf0, 0xfe, 0x00, 0x03, 0x0f,
+    0x40, 0x01, 0xfd, 0xfe, 0x00, 0x03, 0x3f, 0x40, 0x00, 0x2f, 0xfe, 0x00, 0x19, 0xff, 0x40, 0x3d,
+    0x0b, 0xc0, 0x00, 0x03, 0xff, 0x40, 0x3f, 0x43, 0xd0, 0x00, 0x0f, 0xff, 0x40, 0x0b, 0xd1, 0xf0,
+    0x6a, 0xbf, 0xff, 0x41, 0x02, 0xf0, 0xf4, 0xfe, 0xff, 0x03, 0x43, 0xe0, 0xf4, 0xb8, 0xfe, 0xff,
+    0x03, 0x42, 0xf4, 0x78, 0x7c, 0xfe, 0xff, 0x03, 0x40, 0x7c, 0x3c, 0x3c, 0xfe, 0xff, 0x00, 0x40,
+    0xfe, 0x3c, 0xfe, 0xff, 0x03, 0x40, 0x7c, 0x3c, 0x3c, 0xfe, 0xff, 0x03, 0x42, 0xf4, 0x78, 0x7c,
+    0xfe, 0xff, 0x25, 0x43, 0xe0, 0xf4, 0xb8, 0x6a, 0xbf, 0xff, 0x41, 0x02, 0xf0, 0xf4, 0x00, 0x0f,
+    0xff, 0x40, 0x0b, 0xd1, 0xf0, 0x00, 0x03, 0xff, 0x40, 0x3f, 0x43, 0xd0, 0x00, 0x00, 0xff, 0x40,
+    0x3d, 0x0b, 0xc0, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x2f, 0xfe, 0x00, 0x03, 0x0f, 0x40, 0x01, 0xfd,
+    0xfe, 0x00, 0x03, 0x01, 0x00, 0x07, 0xf0, 0xfc, 0x00, 0x01, 0x07, 0x80, 0xe4, 0x00,
 
     /*Unicode: U+f03e () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...+@@%....................@@.
-    0xf0, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@..+@@@@%...................@@.
-    0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@..@@@@@@...................@@.
-    0xf0, 0xff, 0xf0, 0x00, 0x02, 0xc0, 0x00, 0x3c,  //@@..@@@@@@.........%@........@@.
-    0xf0, 0xbf, 0xf0, 0x00, 0x0b, 0xf0, 0x00, 0x3c,  //@@..%@@@@@........%@@@.......@@.
-    0xf0, 0x2f, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x3c,  //@@...%@@@........%@@@@@......@@.
-    0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3c,  //@@..............@@@@@@@@.....@@.
-    0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3c,  //@@.............@@@@@@@@@@....@@.
-    0xf0, 0x00, 0x10, 0x0f, 0xff, 0xff, 0xf0, 0x3c,  //@@.......+....@@@@@@@@@@@@...@@.
-    0xf0, 0x00, 0xf4, 0x3f, 0xff, 0xff, 0xfc, 0x3c,  //@@......@@+..@@@@@@@@@@@@@@..@@.
-    0xf0, 0x03, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@.....@@@@+@@@@@@@@@@@@@@@..@@.
-    0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@....@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@...@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xf0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x3c,  //@@..%%%%%%%%%%%%%%%%%%%%%%+..@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xf1, 0x00, 0x00, 0x2f, 0xfb, 0xff, 0x01, 0xe0, 0xbf, 0xfb, 0xff, 0x01, 0xfc, 0xf0, 0xfb, 0x00,
+    0x01, 0x3c, 0xf0, 0xfb, 0x00, 0x03, 0x3c, 0xf0, 0x1f, 0x80, 0xfd, 0x00, 0x03, 0x3c, 0xf0, 0x7f,
+    0xe0, 0xfd, 0x00, 0x03, 0x3c, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x19, 0x3c, 0xf0, 0xff, 0xf0, 0x00,
+    0x02, 0xc0, 0x00, 0x3c, 0xf0, 0xbf, 0xf0, 0x00, 0x0b, 0xf0, 0x00, 0x3c, 0xf0, 0x2f, 0xc0, 0x00,
+    0x3f, 0xfc, 0x00, 0x3c, 0xf0, 0xfe, 0x00, 0x1e, 0xff, 0xff, 0x00, 0x3c, 0xf0, 0x00, 0x00, 0x03,
+    0xff, 0xff, 0xc0, 0x3c, 0xf0, 0x00, 0x10, 0x0f, 0xff, 0xff, 0xf0, 0x3c, 0xf0, 0x00, 0xf4, 0x3f,
+    0xff, 0xff, 0xfc, 0x3c, 0xf0, 0x03, 0xfd, 0xfe, 0xff, 0x03, 0xfc, 0x3c, 0xf0, 0x0f, 0xfd, 0xff,
+    0x03, 0xfc, 0x3c, 0xf0, 0x3f, 0xfd, 0xff, 0x02, 0xfc, 0x3c, 0xf0, 0xfc, 0xff, 0x02, 0xfc, 0x3c,
+    0xf0, 0xfc, 0xff, 0x02, 0xfc, 0x3c, 0xf0, 0xfc, 0xff, 0x02, 0xfc, 0x3c, 0xf0, 0xfc, 0xaa, 0x02,
+    0xa8, 0x3c, 0xf0, 0xfb, 0x00, 0x01, 0x3c, 0xf0, 0xfb, 0x00, 0x01, 0x3c, 0xbf, 0xfb, 0xff, 0x01,
+    0xfc, 0x3f, 0xfb, 0xff, 0x00, 0xf0, 0xe9, 0x00,
 
     /*Unicode: U+f040 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,  //..................+......
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00,  //.................@@@+....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x00,  //................@@@@@+...
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x00,  //...............@@@@@@@+..
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xfd, 0x00,  //...............@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0x40,  //.............@..@@@@@@@@.
-    0x00, 0x00, 0x00, 0xfc, 0x3f, 0xff, 0x40,  //............@@@..@@@@@@@+
-    0x00, 0x00, 0x03, 0xff, 0x0f, 0xff, 0x00,  //...........@@@@@..@@@@@@.
-    0x00, 0x00, 0x0f, 0xcf, 0xc3, 0xfd, 0x00,  //..........@@@.@@@..@@@@+.
-    0x00, 0x00, 0x3f, 0x3f, 0xf0, 0xf4, 0x00,  //.........@@@.@@@@@..@@+..
-    0x00, 0x00, 0xfc, 0xff, 0xfc, 0x00, 0x00,  //........@@@.@@@@@@@......
-    0x00, 0x03, 0xf3, 0xff, 0xff, 0x00, 0x00,  //.......@@@.@@@@@@@@@.....
-    0x00, 0x0f, 0xcf, 0xff, 0xfd, 0x00, 0x00,  //......@@@.@@@@@@@@@+.....
-    0x00, 0x3f, 0x3f, 0xff, 0xf4, 0x00, 0x00,  //.....@@@.@@@@@@@@@+......
-    0x00, 0xfc, 0xff, 0xff, 0xd0, 0x00, 0x00,  //....@@@.@@@@@@@@@+.......
-    0x03, 0xf3, 0xff, 0xff, 0x40, 0x00, 0x00,  //...@@@.@@@@@@@@@+........
-    0x0f, 0xcf, 0xff, 0xfd, 0x00, 0x00, 0x00,  //..@@@.@@@@@@@@@+.........
-    0x3f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,  //.@@@@@@@@@@@@@+..........
-    0xf8, 0xbf, 0xff, 0xd0, 0x00, 0x00, 0x00,  //@@%.%@@@@@@@@+...........
-    0xf0, 0x2f, 0xff, 0x40, 0x00, 0x00, 0x00,  //@@...%@@@@@@+............
-    0xf0, 0x0b, 0xfd, 0x00, 0x00, 0x00, 0x00,  //@@....%@@@@+.............
-    0xff, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x00,  //@@@@...@@@+..............
-    0xff, 0x0b, 0xd0, 0x00, 0x00, 0x00, 0x00,  //@@@@..%@@+...............
-    0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@+................
-    0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xef, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x01, 0x3f, 0x40, 0xfc, 0x00, 0x01, 0xff, 0xd0, 0xfd, 0x00,
+    0x02, 0x03, 0xff, 0xf4, 0xfd, 0x00, 0x02, 0x03, 0xff, 0xfd, 0xfd, 0x00, 0x03, 0x30, 0xff, 0xff,
+    0x40, 0xfe, 0x00, 0x09, 0xfc, 0x3f, 0xff, 0x40, 0x00, 0x00, 0x03, 0xff, 0x0f, 0xff, 0xfe, 0x00,
+    0x03, 0x0f, 0xcf, 0xc3, 0xfd, 0xfe, 0x00, 0x03, 0x3f, 0x3f, 0xf0, 0xf4, 0xfe, 0x00, 0x02, 0xfc,
+    0xff, 0xfc, 0xfe, 0x00, 0x03, 0x03, 0xf3, 0xff, 0xff, 0xfe, 0x00, 0x03, 0x0f, 0xcf, 0xff, 0xfd,
+    0xfe, 0x00, 0x03, 0x3f, 0x3f, 0xff, 0xf4, 0xfe, 0x00, 0x10, 0xfc, 0xff, 0xff, 0xd0, 0x00, 0x00,
+    0x03, 0xf3, 0xff, 0xff, 0x40, 0x00, 0x00, 0x0f, 0xcf, 0xff, 0xfd, 0xfe, 0x00, 0x03, 0x3f, 0xff,
+    0xff, 0xf4, 0xfe, 0x00, 0x03, 0xf8, 0xbf, 0xff, 0xd0, 0xfe, 0x00, 0x03, 0xf0, 0x2f, 0xff, 0x40,
+    0xfe, 0x00, 0x02, 0xf0, 0x0b, 0xfd, 0xfd, 0x00, 0x02, 0xff, 0x03, 0xf4, 0xfd, 0x00, 0x02, 0xff,
+    0x0b, 0xd0, 0xfd, 0x00, 0x02, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x01, 0xff, 0xfd, 0xe7, 0x00,
 
     /*Unicode: U+f048 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0xbe, 0x00, 0x00, 0x01, 0x40,  //%@@%...........++
-    0xff, 0x00, 0x00, 0x07, 0x80,  //@@@@..........+@%
-    0xff, 0x00, 0x00, 0x1f, 0x80,  //@@@@.........+@@%
-    0xff, 0x00, 0x00, 0x7f, 0x80,  //@@@@........+@@@%
-    0xff, 0x00, 0x01, 0xff, 0x80,  //@@@@.......+@@@@%
-    0xff, 0x00, 0x07, 0xff, 0x80,  //@@@@......+@@@@@%
-    0xff, 0x00, 0x1f, 0xff, 0x80,  //@@@@.....+@@@@@@%
-    0xff, 0x00, 0x7f, 0xff, 0x80,  //@@@@....+@@@@@@@%
-    0xff, 0x01, 0xff, 0xff, 0x80,  //@@@@...+@@@@@@@@%
-    0xff, 0x07, 0xff, 0xff, 0x80,  //@@@@..+@@@@@@@@@%
-    0xff, 0x1f, 0xff, 0xff, 0x80,  //@@@@.+@@@@@@@@@@%
-    0xff, 0x7f, 0xff, 0xff, 0x80,  //@@@@+@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@%
-    0xff, 0xbf, 0xff, 0xff, 0x80,  //@@@@%@@@@@@@@@@@%
-    0xff, 0x1f, 0xff, 0xff, 0x80,  //@@@@.+@@@@@@@@@@%
-    0xff, 0x07, 0xff, 0xff, 0x80,  //@@@@..+@@@@@@@@@%
-    0xff, 0x01, 0xff, 0xff, 0x80,  //@@@@...+@@@@@@@@%
-    0xff, 0x00, 0x7f, 0xff, 0x80,  //@@@@....+@@@@@@@%
-    0xff, 0x00, 0x1f, 0xff, 0x80,  //@@@@.....+@@@@@@%
-    0xff, 0x00, 0x07, 0xff, 0x80,  //@@@@......+@@@@@%
-    0xff, 0x00, 0x01, 0xff, 0x80,  //@@@@.......+@@@@%
-    0xff, 0x00, 0x00, 0x7f, 0x80,  //@@@@........+@@@%
-    0xff, 0x00, 0x00, 0x1f, 0x80,  //@@@@.........+@@%
-    0xff, 0x00, 0x00, 0x07, 0x80,  //@@@@..........+@%
-    0xbf, 0x00, 0x00, 0x01, 0x80,  //%@@@...........+%
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xf7, 0x00, 0x3b, 0xbe, 0x00, 0x00, 0x01, 0x40, 0xff, 0x00, 0x00, 0x07, 0x80, 0xff, 0x00, 0x00,
+    0x1f, 0x80, 0xff, 0x00, 0x00, 0x7f, 0x80, 0xff, 0x00, 0x01, 0xff, 0x80, 0xff, 0x00, 0x07, 0xff,
+    0x80, 0xff, 0x00, 0x1f, 0xff, 0x80, 0xff, 0x00, 0x7f, 0xff, 0x80, 0xff, 0x01, 0xff, 0xff, 0x80,
+    0xff, 0x07, 0xff, 0xff, 0x80, 0xff, 0x1f, 0xff, 0xff, 0x80, 0xff, 0x7f, 0xff, 0xff, 0x80, 0xfd,
+    0xff, 0x3c, 0x80, 0xff, 0xbf, 0xff, 0xff, 0x80, 0xff, 0x1f, 0xff, 0xff, 0x80, 0xff, 0x07, 0xff,
+    0xff, 0x80, 0xff, 0x01, 0xff, 0xff, 0x80, 0xff, 0x00, 0x7f, 0xff, 0x80, 0xff, 0x00, 0x1f, 0xff,
+    0x80, 0xff, 0x00, 0x07, 0xff, 0x80, 0xff, 0x00, 0x01, 0xff, 0x80, 0xff, 0x00, 0x00, 0x7f, 0x80,
+    0xff, 0x00, 0x00, 0x1f, 0x80, 0xff, 0x00, 0x00, 0x07, 0x80, 0xbf, 0x00, 0x00, 0x01, 0x80, 0xf2,
+    0x00,
 
     /*Unicode: U+f04b () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.....................
-    0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+...................
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,  //@@@@@..................
-    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,  //@@@@@@%................
-    0xff, 0xff, 0x80, 0x00, 0x00, 0x00,  //@@@@@@@@%..............
-    0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,  //@@@@@@@@@@+............
-    0xff, 0xff, 0xff, 0x40, 0x00, 0x00,  //@@@@@@@@@@@@+..........
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //@@@@@@@@@@@@@@.........
-    0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,  //@@@@@@@@@@@@@@@%.......
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //@@@@@@@@@@@@@@@@@%.....
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x00,  //@@@@@@@@@@@@@@@@@@@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@%.
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,  //@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //@@@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,  //@@@@@@@@@@@@@@%........
-    0xff, 0xff, 0xff, 0x80, 0x00, 0x00,  //@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,  //@@@@@@@@@@%............
-    0xff, 0xff, 0xd0, 0x00, 0x00, 0x00,  //@@@@@@@@@+.............
-    0xff, 0xfd, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+...............
-    0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,  //@@@@@%.................
-    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%...................
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xf5, 0x00, 0x00, 0xd0, 0xfc, 0x00, 0x00, 0xfd, 0xfc, 0x00, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x01,
+    0xff, 0xf8, 0xfd, 0x00, 0x02, 0xff, 0xff, 0x80, 0xfe, 0x00, 0x02, 0xff, 0xff, 0xf4, 0xfe, 0x00,
+    0xfe, 0xff, 0x02, 0x40, 0x00, 0x00, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x00, 0xfe, 0xff, 0x02, 0xfe,
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0xe0, 0x00, 0xfd, 0xff, 0x01, 0xfd, 0x00, 0xfc, 0xff, 0x00, 0xd0,
+    0xfc, 0xff, 0x00, 0xf8, 0xfc, 0xff, 0x00, 0xe0, 0xfd, 0xff, 0x01, 0xfe, 0x00, 0xfd, 0xff, 0x01,
+    0xf4, 0x00, 0xfd, 0xff, 0x01, 0x40, 0x00, 0xfe, 0xff, 0x02, 0xf8, 0x00, 0x00, 0xfe, 0xff, 0x05,
+    0x80, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xfe, 0x00, 0x02, 0xff, 0xff, 0xd0, 0xfe, 0x00, 0x01, 0xff,
+    0xfd, 0xfd, 0x00, 0x01, 0xff, 0xe0, 0xfd, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xf0, 0xea, 0x00,
 
     /*Unicode: U+f04c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0xbf, 0xff, 0xf0, 0x03, 0xff, 0xff, 0x80,  //%@@@@@@@@@.....@@@@@@@@@%
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xbf, 0xff, 0xf0, 0x03, 0xff, 0xff, 0x80,  //%@@@@@@@@@.....@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf3, 0x00, 0x7f, 0xbf, 0xff, 0xf0, 0x03, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4,
+    0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff,
+    0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07,
+    0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0x2e, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0,
+    0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xf4, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xc0, 0xbf, 0xff, 0xf0, 0x03,
+    0xff, 0xff, 0x80, 0xec, 0x00,
 
     /*Unicode: U+f04d () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //%@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf3, 0x00, 0x00, 0xbf, 0xfc, 0xff, 0x00, 0x40, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0,
+    0xfb, 0xff, 0x01, 0xc0, 0xbf, 0xfc, 0xff, 0x00, 0x80, 0xec, 0x00,
 
     /*Unicode: U+f051 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x40, 0x00, 0x00, 0xbe, 0x00,  //+...........%@@%.
-    0xd0, 0x00, 0x00, 0xff, 0x00,  //@+..........@@@@.
-    0xf4, 0x00, 0x00, 0xff, 0x00,  //@@+.........@@@@.
-    0xfd, 0x00, 0x00, 0xff, 0x00,  //@@@+........@@@@.
-    0xff, 0x40, 0x00, 0xff, 0x00,  //@@@@+.......@@@@.
-    0xff, 0xd0, 0x00, 0xff, 0x00,  //@@@@@+......@@@@.
-    0xff, 0xf4, 0x00, 0xff, 0x00,  //@@@@@@+.....@@@@.
-    0xff, 0xfd, 0x00, 0xff, 0x00,  //@@@@@@@+....@@@@.
-    0xff, 0xff, 0x40, 0xff, 0x00,  //@@@@@@@@+...@@@@.
-    0xff, 0xff, 0xd0, 0xff, 0x00,  //@@@@@@@@@+..@@@@.
-    0xff, 0xff, 0xf4, 0xff, 0x00,  //@@@@@@@@@@+.@@@@.
-    0xff, 0xff, 0xfd, 0xff, 0x00,  //@@@@@@@@@@@+@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xfe, 0xff, 0x00,  //@@@@@@@@@@@%@@@@.
-    0xff, 0xff, 0xf8, 0xff, 0x00,  //@@@@@@@@@@%.@@@@.
-    0xff, 0xff, 0xe0, 0xff, 0x00,  //@@@@@@@@@%..@@@@.
-    0xff, 0xff, 0x80, 0xff, 0x00,  //@@@@@@@@%...@@@@.
-    0xff, 0xfe, 0x00, 0xff, 0x00,  //@@@@@@@%....@@@@.
-    0xff, 0xf8, 0x00, 0xff, 0x00,  //@@@@@@%.....@@@@.
-    0xff, 0xe0, 0x00, 0xff, 0x00,  //@@@@@%......@@@@.
-    0xff, 0x80, 0x00, 0xff, 0x00,  //@@@@%.......@@@@.
-    0xfe, 0x00, 0x00, 0xff, 0x00,  //@@@%........@@@@.
-    0xf8, 0x00, 0x00, 0xff, 0x00,  //@@%.........@@@@.
-    0xe0, 0x00, 0x00, 0xff, 0x00,  //@%..........@@@@.
-    0x80, 0x00, 0x00, 0xbf, 0x00,  //%...........%@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xf7, 0x00, 0x3b, 0x40, 0x00, 0x00, 0xbe, 0x00, 0xd0, 0x00, 0x00, 0xff, 0x00, 0xf4, 0x00, 0x00,
+    0xff, 0x00, 0xfd, 0x00, 0x00, 0xff, 0x00, 0xff, 0x40, 0x00, 0xff, 0x00, 0xff, 0xd0, 0x00, 0xff,
+    0x00, 0xff, 0xf4, 0x00, 0xff, 0x00, 0xff, 0xfd, 0x00, 0xff, 0x00, 0xff, 0xff, 0x40, 0xff, 0x00,
+    0xff, 0xff, 0xd0, 0xff, 0x00, 0xff, 0xff, 0xf4, 0xff, 0x00, 0xff, 0xff, 0xfd, 0xff, 0x00, 0xfd,
+    0xff, 0x3b, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xf8, 0xff, 0x00, 0xff, 0xff, 0xe0,
+    0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0x00, 0xff, 0xfe, 0x00, 0xff, 0x00, 0xff, 0xf8, 0x00, 0xff,
+    0x00, 0xff, 0xe0, 0x00, 0xff, 0x00, 0xff, 0x80, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x00, 0xff, 0x00,
+    0xf8, 0x00, 0x00, 0xff, 0x00, 0xe0, 0x00, 0x00, 0xff, 0x00, 0x80, 0x00, 0x00, 0xbf, 0xf1, 0x00,
 
     /*Unicode: U+f052 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x00,  //...........+@+...........
-    0x00, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x00,  //..........+@@@+..........
-    0x00, 0x00, 0x1f, 0xfd, 0x00, 0x00, 0x00,  //.........+@@@@@+.........
-    0x00, 0x00, 0x7f, 0xff, 0x40, 0x00, 0x00,  //........+@@@@@@@+........
-    0x00, 0x01, 0xff, 0xff, 0xd0, 0x00, 0x00,  //.......+@@@@@@@@@+.......
-    0x00, 0x07, 0xff, 0xff, 0xf4, 0x00, 0x00,  //......+@@@@@@@@@@@+......
-    0x00, 0x1f, 0xff, 0xff, 0xfd, 0x00, 0x00,  //.....+@@@@@@@@@@@@@+.....
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0x40, 0x00,  //....+@@@@@@@@@@@@@@@+....
-    0x01, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x07, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //..+@@@@@@@@@@@@@@@@@@@+..
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@+.
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x40,  //+%%%%%%%%%%%%%%%%%%%%%%%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe3, 0x00, 0x01, 0x01, 0xd0, 0xfc, 0x00, 0x01, 0x07, 0xf4, 0xfc, 0x00, 0x01, 0x1f, 0xfd, 0xfc,
+    0x00, 0x02, 0x7f, 0xff, 0x40, 0xfe, 0x00, 0x03, 0x01, 0xff, 0xff, 0xd0, 0xfe, 0x00, 0x03, 0x07,
+    0xff, 0xff, 0xf4, 0xfe, 0x00, 0x03, 0x1f, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+    0x02, 0x40, 0x00, 0x01, 0xfd, 0xff, 0x02, 0xd0, 0x00, 0x07, 0xfd, 0xff, 0x02, 0xf4, 0x00, 0x1f,
+    0xfd, 0xff, 0x02, 0xfd, 0x00, 0x7f, 0xfc, 0xff, 0x01, 0x40, 0x6a, 0xfc, 0xaa, 0x00, 0x40, 0xf3,
+    0x00, 0xfb, 0xff, 0x00, 0x80, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00,
+    0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0x80, 0xde, 0x00,
 
     /*Unicode: U+f053 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x78, 0x00,  //............+@%...
-    0x00, 0x00, 0x01, 0xfe, 0x00,  //...........+@@@%..
-    0x00, 0x00, 0x07, 0xff, 0x80,  //..........+@@@@@%.
-    0x00, 0x00, 0x1f, 0xff, 0xc0,  //.........+@@@@@@@.
-    0x00, 0x00, 0x7f, 0xff, 0xc0,  //........+@@@@@@@@.
-    0x00, 0x01, 0xff, 0xff, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x07, 0xff, 0xfc, 0x00,  //......+@@@@@@@@...
-    0x00, 0x1f, 0xff, 0xf0, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x7f, 0xff, 0xc0, 0x00,  //....+@@@@@@@@.....
-    0x01, 0xff, 0xff, 0x00, 0x00,  //...+@@@@@@@@......
-    0x07, 0xff, 0xfc, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x1f, 0xff, 0xf0, 0x00, 0x00,  //.+@@@@@@@@........
-    0x7f, 0xff, 0xc0, 0x00, 0x00,  //+@@@@@@@@.........
-    0x7f, 0xff, 0xc0, 0x00, 0x00,  //+@@@@@@@@.........
-    0x1f, 0xff, 0xf0, 0x00, 0x00,  //.+@@@@@@@@........
-    0x07, 0xff, 0xfc, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x01, 0xff, 0xff, 0x00, 0x00,  //...+@@@@@@@@......
-    0x00, 0x7f, 0xff, 0xc0, 0x00,  //....+@@@@@@@@.....
-    0x00, 0x1f, 0xff, 0xf0, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x07, 0xff, 0xfc, 0x00,  //......+@@@@@@@@...
-    0x00, 0x01, 0xff, 0xff, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x00, 0x7f, 0xff, 0xc0,  //........+@@@@@@@@.
-    0x00, 0x00, 0x1f, 0xff, 0xc0,  //.........+@@@@@@@.
-    0x00, 0x00, 0x07, 0xff, 0x40,  //..........+@@@@@+.
-    0x00, 0x00, 0x01, 0xfd, 0x00,  //...........+@@@+..
-    0x00, 0x00, 0x00, 0x74, 0x00,  //............+@+...
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xf9, 0x00, 0x00, 0x78, 0xfe, 0x00, 0x01, 0x01, 0xfe, 0xfe, 0x00, 0x46, 0x07, 0xff, 0x80, 0x00,
+    0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x07,
+    0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff,
+    0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00,
+    0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00,
+    0x01, 0xff, 0xff, 0xfe, 0x00, 0x11, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00,
+    0x07, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x10, 0x7f, 0xff, 0xc0, 0x00, 0x00,
+    0x1f, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0x40, 0x00, 0x00, 0x01, 0xfd, 0xfd, 0x00, 0x00, 0x74,
+    0xf1, 0x00,
 
     /*Unicode: U+f054 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x03, 0xc0, 0x00, 0x00, 0x00,  //...@@.............
-    0x0f, 0xf0, 0x00, 0x00, 0x00,  //..@@@@............
-    0x3f, 0xfc, 0x00, 0x00, 0x00,  //.@@@@@@...........
-    0x7f, 0xff, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x3f, 0xff, 0xc0, 0x00, 0x00,  //.@@@@@@@@.........
-    0x0f, 0xff, 0xf0, 0x00, 0x00,  //..@@@@@@@@........
-    0x03, 0xff, 0xfc, 0x00, 0x00,  //...@@@@@@@@.......
-    0x00, 0xff, 0xff, 0x00, 0x00,  //....@@@@@@@@......
-    0x00, 0x3f, 0xff, 0xc0, 0x00,  //.....@@@@@@@@.....
-    0x00, 0x0f, 0xff, 0xf0, 0x00,  //......@@@@@@@@....
-    0x00, 0x03, 0xff, 0xfc, 0x00,  //.......@@@@@@@@...
-    0x00, 0x00, 0xff, 0xff, 0x00,  //........@@@@@@@@..
-    0x00, 0x00, 0x3f, 0xff, 0xc0,  //.........@@@@@@@@.
-    0x00, 0x00, 0x3f, 0xff, 0xc0,  //.........@@@@@@@@.
-    0x00, 0x00, 0xff, 0xff, 0x00,  //........@@@@@@@@..
-    0x00, 0x03, 0xff, 0xfc, 0x00,  //.......@@@@@@@@...
-    0x00, 0x0f, 0xff, 0xf0, 0x00,  //......@@@@@@@@....
-    0x00, 0x3f, 0xff, 0xc0, 0x00,  //.....@@@@@@@@.....
-    0x00, 0xff, 0xff, 0x00, 0x00,  //....@@@@@@@@......
-    0x03, 0xff, 0xfc, 0x00, 0x00,  //...@@@@@@@@.......
-    0x0f, 0xff, 0xf0, 0x00, 0x00,  //..@@@@@@@@........
-    0x3f, 0xff, 0xc0, 0x00, 0x00,  //.@@@@@@@@.........
-    0x7f, 0xff, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x2f, 0xfc, 0x00, 0x00, 0x00,  //.%@@@@@...........
-    0x0b, 0xf0, 0x00, 0x00, 0x00,  //..%@@@............
-    0x02, 0xc0, 0x00, 0x00, 0x00,  //...%@.............
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xfc, 0x00, 0x01, 0x03, 0xc0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x3f, 0xfc, 0xfe,
+    0x00, 0x01, 0x7f, 0xff, 0xfe, 0x00, 0x0c, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00,
+    0x00, 0x03, 0xff, 0xfc, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x0c, 0x3f, 0xff, 0xc0, 0x00,
+    0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xfc, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+    0x31, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x03,
+    0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00,
+    0x00, 0x7f, 0xff, 0xfe, 0x00, 0x01, 0x2f, 0xfc, 0xfe, 0x00, 0x01, 0x0b, 0xf0, 0xfe, 0x00, 0x01,
+    0x02, 0xc0, 0xef, 0x00,
 
     /*Unicode: U+f067 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00,  //.........%@@@%.........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x15, 0x55, 0xff, 0xf9, 0x55, 0x50,  //.+++++++@@@@@@%+++++++.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x6a, 0xaa, 0xff, 0xfe, 0xaa, 0xa0,  //+%%%%%%%@@@@@@@%%%%%%%.
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00,  //........+@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xf3, 0x00, 0x01, 0x2f, 0xe0, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd,
+    0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00,
+    0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x09, 0xbf, 0xf4, 0x00, 0x00, 0x15, 0x55, 0xff, 0xf9, 0x55, 0x50,
+    0xfc, 0xff, 0x00, 0xf8, 0xfc, 0xff, 0x00, 0xfc, 0xfc, 0xff, 0x00, 0xfc, 0xfc, 0xff, 0x00, 0xfc,
+    0xfc, 0xff, 0x0a, 0xf8, 0x6a, 0xaa, 0xff, 0xfe, 0xaa, 0xa0, 0x00, 0x00, 0xbf, 0xf4, 0xfd, 0x00,
+    0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01,
+    0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0x7f,
+    0xf0, 0xe1, 0x00,
 
     /*Unicode: U+f068 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf4,  //%@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf4,  //+@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xbf, 0x00, 0x00, 0xbf, 0xfd, 0xff, 0x00, 0xf4, 0xfc, 0xff, 0x00, 0xfc, 0xfc, 0xff, 0x00, 0xfc,
+    0xfc, 0xff, 0x00, 0xfc, 0xfc, 0xff, 0x01, 0xf8, 0x7f, 0xfd, 0xff, 0x00, 0xf4, 0xb3, 0x00,
 
     /*Unicode: U+f071 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00,  //.............%@%.............
-    0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,  //............%@@@%............
-    0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00,  //............@@@@@............
-    0x00, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x00, 0x00,  //...........%@@@@@%...........
-    0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00,  //...........@@@@@@@...........
-    0x00, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x00, 0x00,  //..........%@@@@@@@%..........
-    0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00,  //..........@@@@@@@@@..........
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@.........
-    0x00, 0x00, 0x7f, 0x55, 0x7f, 0x40, 0x00, 0x00,  //........+@@@+++++@@@+........
-    0x00, 0x00, 0xff, 0x00, 0x3f, 0xc0, 0x00, 0x00,  //........@@@@.....@@@@........
-    0x00, 0x01, 0xff, 0x00, 0x3f, 0xd0, 0x00, 0x00,  //.......+@@@@.....@@@@+.......
-    0x00, 0x03, 0xff, 0x40, 0x7f, 0xf0, 0x00, 0x00,  //.......@@@@@+...+@@@@@.......
-    0x00, 0x07, 0xff, 0x40, 0x7f, 0xf4, 0x00, 0x00,  //......+@@@@@+...+@@@@@+......
-    0x00, 0x0f, 0xff, 0x40, 0x7f, 0xfc, 0x00, 0x00,  //......@@@@@@+...+@@@@@@......
-    0x00, 0x2f, 0xff, 0x40, 0x7f, 0xfe, 0x00, 0x00,  //.....%@@@@@@+...+@@@@@@%.....
-    0x00, 0x3f, 0xff, 0x40, 0x7f, 0xff, 0x00, 0x00,  //.....@@@@@@@+...+@@@@@@@.....
-    0x00, 0xbf, 0xff, 0x80, 0xbf, 0xff, 0x80, 0x00,  //....%@@@@@@@%...%@@@@@@@%....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //....@@@@@@@@@@@@@@@@@@@@@....
-    0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //...%@@@@@@@@@@@@@@@@@@@@@%...
-    0x07, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xf4, 0x00,  //..+@@@@@@@@@+...+@@@@@@@@@+..
-    0x0f, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xfc, 0x00,  //..@@@@@@@@@@+...+@@@@@@@@@@..
-    0x1f, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xfd, 0x00,  //.+@@@@@@@@@@+...+@@@@@@@@@@+.
-    0x3f, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@%...%@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xfe, 0x00, 0x00, 0x2e, 0xfa, 0x00, 0x01, 0xbf, 0x80, 0xfb, 0x00, 0x01, 0xff, 0xc0, 0xfc, 0x00,
+    0x02, 0x02, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x0b, 0xff, 0xf8,
+    0xfc, 0x00, 0x02, 0x0f, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x03, 0x7f,
+    0x55, 0x7f, 0x40, 0xfd, 0x00, 0x03, 0xff, 0x00, 0x3f, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0x00,
+    0x3f, 0xd0, 0xfe, 0x00, 0x04, 0x03, 0xff, 0x40, 0x7f, 0xf0, 0xfe, 0x00, 0x04, 0x07, 0xff, 0x40,
+    0x7f, 0xf4, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x40, 0x7f, 0xfc, 0xfe, 0x00, 0x04, 0x2f, 0xff, 0x40,
+    0x7f, 0xfe, 0xfe, 0x00, 0x04, 0x3f, 0xff, 0x40, 0x7f, 0xff, 0xfe, 0x00, 0x07, 0xbf, 0xff, 0x80,
+    0xbf, 0xff, 0x80, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xc0, 0x00, 0x02, 0xfc, 0xff, 0x22, 0xe0, 0x00,
+    0x07, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xf4, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xfc, 0x00,
+    0x1f, 0xff, 0xff, 0x40, 0x7f, 0xff, 0xfd, 0x00, 0x3f, 0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0x00,
+    0x7f, 0xfb, 0xff, 0x00, 0x40, 0xfa, 0xff, 0x00, 0xc0, 0xfa, 0xff, 0x01, 0xc0, 0x7f, 0xfb, 0xff,
+    0x00, 0x40, 0xe9, 0x00,
 
     /*Unicode: U+f074 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf4, 0x00,  //.......................@@@+..
-    0xaa, 0xa4, 0x00, 0x00, 0x6a, 0xaf, 0xfd, 0x00,  //%%%%%%+.........+%%%%%@@@@@+.
-    0xff, 0xff, 0x40, 0x0b, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@+...%@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0x55, 0x6f, 0xf5, 0xff, 0xe5, 0x5b, 0xfc, 0x00,  //+++++%@@@@++@@@@@%++++%@@@@..
-    0x00, 0x07, 0xf3, 0xff, 0x00, 0x03, 0xf0, 0x00,  //......+@@@.@@@@@.......@@@...
-    0x00, 0x01, 0xd7, 0xfc, 0x00, 0x03, 0xc0, 0x00,  //.......+@++@@@@........@@....
-    0x00, 0x00, 0x8f, 0xf8, 0x00, 0x03, 0x00, 0x00,  //........%.@@@@%........@.....
-    0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@...............
-    0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00,  //.........@@@@%...............
-    0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,  //........+@@@@................
-    0x00, 0x00, 0xff, 0xc8, 0x00, 0x03, 0x00, 0x00,  //........@@@@@.%........@.....
-    0x00, 0x01, 0xff, 0x6c, 0x00, 0x03, 0xc0, 0x00,  //.......+@@@@+%@........@@....
-    0x00, 0x07, 0xff, 0x3f, 0x00, 0x03, 0xf0, 0x00,  //.......@@@@@.@@@.......@@@...
-    0x55, 0x6f, 0xfc, 0xbf, 0xe5, 0x5b, 0xfc, 0x00,  //+++++%@@@@@.%@@@@%++++%@@@@..
-    0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@%...@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0x40, 0x0b, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xbf, 0xa4, 0x00, 0x00, 0x6f, 0xff, 0xfd, 0x00,  //%@@@%%+.........+%%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf4, 0x00,  //.......................@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd0, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf4, 0x00, 0x01, 0x03, 0x40, 0xfb, 0x00, 0x01, 0x03, 0xd0, 0xfb, 0x00, 0x0e, 0x03, 0xf4, 0x00,
+    0xaa, 0xa4, 0x00, 0x00, 0x6a, 0xaf, 0xfd, 0x00, 0xff, 0xff, 0x40, 0x0b, 0xfe, 0xff, 0x04, 0x40,
+    0xff, 0xff, 0xe0, 0x2f, 0xfe, 0xff, 0x04, 0xc0, 0xff, 0xff, 0xf4, 0xbf, 0xfe, 0xff, 0x17, 0x00,
+    0x55, 0x6f, 0xf5, 0xff, 0xe5, 0x5b, 0xfc, 0x00, 0x00, 0x07, 0xf3, 0xff, 0x00, 0x03, 0xf0, 0x00,
+    0x00, 0x01, 0xd7, 0xfc, 0x00, 0x03, 0xc0, 0xfe, 0x00, 0x03, 0x8f, 0xf8, 0x00, 0x03, 0xfd, 0x00,
+    0x01, 0x1f, 0xf0, 0xfb, 0x00, 0x01, 0x3f, 0xe0, 0xfb, 0x00, 0x01, 0x7f, 0xc0, 0xfb, 0x00, 0x03,
+    0xff, 0xc8, 0x00, 0x03, 0xfe, 0x00, 0x1a, 0x01, 0xff, 0x6c, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x07,
+    0xff, 0x3f, 0x00, 0x03, 0xf0, 0x00, 0x55, 0x6f, 0xfc, 0xbf, 0xe5, 0x5b, 0xfc, 0x00, 0xff, 0xff,
+    0xf4, 0xbf, 0xfe, 0xff, 0x04, 0x00, 0xff, 0xff, 0xe0, 0x3f, 0xfe, 0xff, 0x04, 0xc0, 0xff, 0xff,
+    0x40, 0x0b, 0xfe, 0xff, 0x07, 0x40, 0xbf, 0xa4, 0x00, 0x00, 0x6f, 0xff, 0xfd, 0xfb, 0x00, 0x01,
+    0x03, 0xf4, 0xfb, 0x00, 0x01, 0x03, 0xd0, 0xfb, 0x00, 0x01, 0x03, 0x40, 0xe0, 0x00,
 
     /*Unicode: U+f077 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,  //............@@.............
-    0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,  //...........@@@@............
-    0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //..........@@@@@@...........
-    0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00,  //.........@@@@@@@@..........
-    0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00,  //........@@@@@@@@@@.........
-    0x00, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x00,  //.......@@@@@@@@@@@@........
-    0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00,  //......@@@@@@@@@@@@@@.......
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.....@@@@@@@@@@@@@@@@......
-    0x00, 0xff, 0xff, 0x4f, 0xff, 0xf0, 0x00,  //....@@@@@@@@+.@@@@@@@@.....
-    0x03, 0xff, 0xfd, 0x03, 0xff, 0xfc, 0x00,  //...@@@@@@@@+...@@@@@@@@....
-    0x0f, 0xff, 0xf4, 0x00, 0xff, 0xff, 0x00,  //..@@@@@@@@+.....@@@@@@@@...
-    0x3f, 0xff, 0xd0, 0x00, 0x3f, 0xff, 0xc0,  //.@@@@@@@@+.......@@@@@@@@..
-    0xff, 0xff, 0x40, 0x00, 0x1f, 0xff, 0xf0,  //@@@@@@@@+.........@@@@@@@@.
-    0xff, 0xfd, 0x00, 0x00, 0x07, 0xff, 0xf0,  //@@@@@@@+...........@@@@@@@.
-    0x3f, 0xf4, 0x00, 0x00, 0x01, 0xff, 0xc0,  //.@@@@@+.............@@@@@..
-    0x0f, 0xd0, 0x00, 0x00, 0x00, 0x7f, 0x00,  //..@@@+...............@@@...
-    0x02, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00,  //...%+.................%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xc6, 0x00, 0x00, 0xf0, 0xfc, 0x00, 0x01, 0x03, 0xfc, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+    0x02, 0x3f, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0x03, 0xff, 0xff,
+    0xfc, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x34, 0xc0, 0x00,
+    0x00, 0xff, 0xff, 0x4f, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xfd, 0x03, 0xff, 0xfc, 0x00, 0x0f, 0xff,
+    0xf4, 0x00, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xd0, 0x00, 0x3f, 0xff, 0xc0, 0xff, 0xff, 0x40, 0x00,
+    0x1f, 0xff, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x3f, 0xf4, 0x00, 0x00, 0x01, 0xff,
+    0xc0, 0x0f, 0xd0, 0xfe, 0x00, 0x03, 0x7f, 0x00, 0x02, 0x40, 0xfe, 0x00, 0x00, 0x08, 0xdd, 0x00,
 
     /*Unicode: U+f078 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x07, 0xc0, 0x00, 0x00, 0x00, 0x2e, 0x00,  //..+@@................%@%...
-    0x1f, 0xf0, 0x00, 0x00, 0x00, 0xbf, 0x80,  //.+@@@@..............%@@@%..
-    0x7f, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xe0,  //+@@@@@@............%@@@@@%.
-    0xff, 0xff, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@@@@@@@..........%@@@@@@@.
-    0x7f, 0xff, 0xc0, 0x00, 0x2f, 0xff, 0xd0,  //+@@@@@@@@........%@@@@@@@+.
-    0x1f, 0xff, 0xf0, 0x00, 0xbf, 0xff, 0x40,  //.+@@@@@@@@......%@@@@@@@+..
-    0x07, 0xff, 0xfc, 0x02, 0xff, 0xfd, 0x00,  //..+@@@@@@@@....%@@@@@@@+...
-    0x01, 0xff, 0xff, 0x0b, 0xff, 0xf4, 0x00,  //...+@@@@@@@@..%@@@@@@@+....
-    0x00, 0x7f, 0xff, 0xef, 0xff, 0xd0, 0x00,  //....+@@@@@@@@%@@@@@@@+.....
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0x40, 0x00,  //.....+@@@@@@@@@@@@@@+......
-    0x00, 0x07, 0xff, 0xff, 0xfd, 0x00, 0x00,  //......+@@@@@@@@@@@@+.......
-    0x00, 0x01, 0xff, 0xff, 0xf4, 0x00, 0x00,  //.......+@@@@@@@@@@+........
-    0x00, 0x00, 0x7f, 0xff, 0xd0, 0x00, 0x00,  //........+@@@@@@@@+.........
-    0x00, 0x00, 0x1f, 0xff, 0x40, 0x00, 0x00,  //.........+@@@@@@+..........
-    0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00,  //..........+@@@@+...........
-    0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x00,  //...........+@@+............
-    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,  //............++.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xc2, 0x00, 0x01, 0x07, 0xc0, 0xfe, 0x00, 0x03, 0x2e, 0x00, 0x1f, 0xf0, 0xfe, 0x00, 0x34, 0xbf,
+    0x80, 0x7f, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xe0, 0xff, 0xff, 0x00, 0x00, 0x0b, 0xff, 0xf0, 0x7f,
+    0xff, 0xc0, 0x00, 0x2f, 0xff, 0xd0, 0x1f, 0xff, 0xf0, 0x00, 0xbf, 0xff, 0x40, 0x07, 0xff, 0xfc,
+    0x02, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0x0b, 0xff, 0xf4, 0x00, 0x00, 0x7f, 0xff, 0xef, 0xff,
+    0xd0, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x06, 0x40, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfd, 0xfe, 0x00,
+    0x03, 0x01, 0xff, 0xff, 0xf4, 0xfd, 0x00, 0x02, 0x7f, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x1f, 0xff,
+    0x40, 0xfd, 0x00, 0x01, 0x07, 0xfd, 0xfc, 0x00, 0x01, 0x01, 0xf4, 0xfb, 0x00, 0x00, 0x50, 0xe2,
+    0x00,
 
     /*Unicode: U+f079 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x2c, 0x0b, 0xff, 0xff, 0xff, 0xfc, 0x00,  //.....%@...%@@@@@@@@@@@@@@@@.....
-    0x00, 0xbf, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x00,  //....%@@@...@@@@@@@@@@@@@@@@.....
-    0x01, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xfc, 0x00,  //...+@@@@@...@@@@@@@@@@@@@@@.....
-    0x03, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xfc, 0x00,  //...@@@@@@%..+@@@@@@@@@@@@@@.....
-    0x0f, 0xff, 0xf4, 0x00, 0x00, 0x07, 0xfc, 0x00,  //..@@@@@@@@+...........+@@@@.....
-    0x3f, 0xff, 0xfd, 0x00, 0x00, 0x03, 0xfc, 0x00,  //.@@@@@@@@@@+...........@@@@.....
-    0xbf, 0xff, 0xff, 0x00, 0x00, 0x03, 0xfc, 0x00,  //%@@@@@@@@@@@...........@@@@.....
-    0xff, 0xff, 0xff, 0x40, 0x00, 0x03, 0xfc, 0x00,  //@@@@@@@@@@@@+..........@@@@.....
-    0x15, 0xff, 0x54, 0x00, 0x00, 0x03, 0xfc, 0x00,  //.+++@@@@+++............@@@@.....
-    0x00, 0xff, 0x40, 0x00, 0x00, 0x03, 0xfc, 0x00,  //....@@@@+..............@@@@.....
-    0x00, 0xff, 0x40, 0x00, 0x00, 0x57, 0xfd, 0x50,  //....@@@@+...........+++@@@@+++..
-    0x00, 0xff, 0x40, 0x00, 0x07, 0xff, 0xff, 0xfc,  //....@@@@+.........+@@@@@@@@@@@@.
-    0x00, 0xff, 0x40, 0x00, 0x03, 0xff, 0xff, 0xf8,  //....@@@@+..........@@@@@@@@@@@%.
-    0x00, 0xff, 0x40, 0x00, 0x00, 0xff, 0xff, 0xf0,  //....@@@@+...........@@@@@@@@@@..
-    0x00, 0xff, 0x40, 0x00, 0x00, 0x7f, 0xff, 0xc0,  //....@@@@+...........+@@@@@@@@...
-    0x00, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0x40,  //....@@@@@@@@@@@@@@+..%@@@@@@+...
-    0x00, 0xff, 0xff, 0xff, 0xfc, 0x0b, 0xfd, 0x00,  //....@@@@@@@@@@@@@@@...%@@@@+....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf8, 0x00,  //....@@@@@@@@@@@@@@@@...@@@%.....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xe0, 0x00,  //....@@@@@@@@@@@@@@@@%...@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xd0, 0x00, 0x01, 0x2c, 0x0b, 0xfe, 0xff, 0x04, 0xfc, 0x00, 0x00, 0xbf, 0x03, 0xfe, 0xff, 0x04,
+    0xfc, 0x00, 0x01, 0xff, 0xc0, 0xfe, 0xff, 0x21, 0xfc, 0x00, 0x03, 0xff, 0xe0, 0x7f, 0xff, 0xff,
+    0xfc, 0x00, 0x0f, 0xff, 0xf4, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x3f, 0xff, 0xfd, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0xbf, 0xff, 0xff, 0x00, 0x00, 0x03, 0xfc, 0x00, 0xfe, 0xff, 0x3d, 0x40, 0x00, 0x03,
+    0xfc, 0x00, 0x15, 0xff, 0x54, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x03,
+    0xfc, 0x00, 0x00, 0xff, 0x40, 0x00, 0x00, 0x57, 0xfd, 0x50, 0x00, 0xff, 0x40, 0x00, 0x07, 0xff,
+    0xff, 0xfc, 0x00, 0xff, 0x40, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0xff, 0x40, 0x00, 0x00, 0xff,
+    0xff, 0xf0, 0x00, 0xff, 0x40, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xfe, 0xff, 0x04, 0xf4, 0x2f,
+    0xff, 0x40, 0x00, 0xfe, 0xff, 0x04, 0xfc, 0x0b, 0xfd, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x03, 0xf8,
+    0x00, 0x00, 0xfd, 0xff, 0x01, 0x80, 0xe0, 0xd8, 0x00,
 
     /*Unicode: U+f07b () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x0b, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00,  //..%@@@@@@%+................
-    0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@%...............
-    0xbf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@...............
-    0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..............
-    0xff, 0xff, 0xff, 0xea, 0xaa, 0xaa, 0x40,  //@@@@@@@@@@@@@%%%%%%%%%%%+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //.+@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf3, 0x00, 0x02, 0x0b, 0xff, 0xe4, 0xfd, 0x00, 0x02, 0x3f, 0xff, 0xfe, 0xfd, 0x00, 0x02, 0xbf,
+    0xff, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0x00, 0xfe, 0xff, 0x03, 0xea, 0xaa, 0xaa,
+    0x40, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf8, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00,
+    0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00,
+    0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00,
+    0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0xff, 0x01,
+    0xf8, 0x7f, 0xfc, 0xff, 0x01, 0xf0, 0x1f, 0xfc, 0xff, 0x00, 0xc0, 0xde, 0x00,
 
     /*Unicode: U+f093 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,  //.............%.............
-    0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00,  //...........@@@@@...........
-    0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00,  //..........@@@@@@@..........
-    0x00, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x00,  //.........@@@@@@@@@.........
-    0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x00,  //........@@@@@@@@@@@........
-    0x00, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00,  //.......@@@@@@@@@@@@@.......
-    0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x0a, 0xaf, 0xff, 0xea, 0x80, 0x00,  //......%%%%@@@@@@@%%%%......
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x07, 0xff, 0x40, 0x00, 0x00,  //..........+@@@@@...........
-    0xbf, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xf8,  //%@@@@@@@@.........@@@@@@@@%
-    0xff, 0xff, 0xf4, 0x00, 0x7f, 0xff, 0xfc,  //@@@@@@@@@@+.....+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7c, 0x7c,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x7c, 0x7c,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf7, 0x00, 0x00, 0x20, 0xfb, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0x03, 0xff, 0xfc, 0x00, 0x02,
+    0x0f, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0x3f, 0xff, 0xf0, 0xfd, 0x00, 0x02, 0xff, 0xff, 0xfc, 0xfe,
+    0x00, 0x00, 0x03, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x3f,
+    0xfe, 0xff, 0x07, 0xe0, 0x00, 0x00, 0x0a, 0xaf, 0xff, 0xea, 0x80, 0xfe, 0x00, 0x02, 0x0b, 0xff,
+    0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02,
+    0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd,
+    0x00, 0x02, 0x0b, 0xff, 0x80, 0xfd, 0x00, 0x12, 0x07, 0xff, 0x40, 0x00, 0x00, 0xbf, 0xff, 0xc0,
+    0x00, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xf4, 0x00, 0x7f, 0xff, 0xfc, 0xfb, 0xff, 0x00, 0xfc, 0xfb,
+    0xff, 0x00, 0xfc, 0xfd, 0xff, 0x02, 0xfc, 0x7c, 0x7c, 0xfd, 0xff, 0x02, 0xfc, 0x7c, 0x7c, 0xfb,
+    0xff, 0x01, 0xfc, 0xbf, 0xfc, 0xff, 0x00, 0xf8, 0xec, 0x00,
 
     /*Unicode: U+f095 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x02, 0x90, 0x00, 0x00, 0x00, 0x00,  //...%%+.................
-    0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,  //.+@@@@.................
-    0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //.@@@@@%................
-    0xbf, 0xfc, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@................
-    0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@...............
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xbf, 0xf8, 0x00, 0x00, 0x00, 0x00,  //%@@@@@%................
-    0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00,  //+@@@@%.................
-    0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00,  //.@@@@+.................
-    0x2f, 0xf0, 0x00, 0x00, 0x00, 0x00,  //.%@@@@.................
-    0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //..@@@@%................
-    0x0b, 0xfd, 0x00, 0x00, 0x00, 0x00,  //..%@@@@+...............
-    0x03, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@@@...............
-    0x01, 0xff, 0xc0, 0x00, 0x00, 0x00,  //...+@@@@@..............
-    0x00, 0x7f, 0xf4, 0x00, 0xf8, 0x00,  //....+@@@@@+.....%@%....
-    0x00, 0x2f, 0xfe, 0x02, 0xff, 0x80,  //.....%@@@@@%...%@@@@%..
-    0x00, 0x0b, 0xff, 0xeb, 0xff, 0xf4,  //......%@@@@@@+%@@@@@@@+
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xf8,  //.......+@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8,  //........+@@@@@@@@@@@@@%
-    0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0,  //..........%@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0xbf, 0xff, 0xd0,  //............%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x06, 0xfe, 0x00,  //..............+%@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xf5, 0x00, 0x01, 0x02, 0x90, 0xfd, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01, 0x3f, 0xf8, 0xfd,
+    0x00, 0x01, 0xbf, 0xfc, 0xfd, 0x00, 0x01, 0xff, 0xfe, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00,
+    0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xbf, 0xf8, 0xfd, 0x00, 0x01, 0x7f, 0xe0, 0xfd, 0x00, 0x01,
+    0x3f, 0xe0, 0xfd, 0x00, 0x01, 0x2f, 0xf0, 0xfd, 0x00, 0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x01, 0x0b,
+    0xfd, 0xfd, 0x00, 0x01, 0x03, 0xff, 0xfd, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xfd, 0x00, 0x12, 0x7f,
+    0xf4, 0x00, 0xf8, 0x00, 0x00, 0x2f, 0xfe, 0x02, 0xff, 0x80, 0x00, 0x0b, 0xff, 0xeb, 0xff, 0xf4,
+    0x00, 0x01, 0xfe, 0xff, 0x0c, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0b, 0xff,
+    0xff, 0xf0, 0xfe, 0x00, 0x02, 0xbf, 0xff, 0xd0, 0xfe, 0x00, 0x01, 0x06, 0xfe, 0xe2, 0x00,
 
     /*Unicode: U+f0c4 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x05, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..++%++......................
-    0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@+....................
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x10, 0x00,  //@@@@@@@@@@...............+...
-    0xfd, 0x06, 0xfc, 0x00, 0x00, 0x02, 0xee, 0x00,  //@@@+..+%@@@............%@%@%.
-    0xf8, 0x00, 0x7e, 0x00, 0x00, 0x2e, 0x03, 0x40,  //@@%.....+@@%.........%@%...@+
-    0xfc, 0x00, 0x1f, 0x00, 0x01, 0xe0, 0x0b, 0x00,  //@@@......+@@.......+@%....%@.
-    0xfe, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x38, 0x00,  //@@@%......@@.....+@%.....@%..
-    0x7f, 0xd0, 0x2f, 0x01, 0xf4, 0x01, 0xd0, 0x00,  //+@@@@+...%@@....@@+....+@+...
-    0x1f, 0xff, 0xfe, 0xdb, 0x40, 0x0b, 0x00, 0x00,  //.+@@@@@@@@@%@+%@+.....%@.....
-    0x02, 0xff, 0xfc, 0xb8, 0x00, 0x28, 0x00, 0x00,  //...%@@@@@@@.%@+......%%......
-    0x00, 0x1a, 0x4f, 0xc0, 0x00, 0xe0, 0x00, 0x00,  //.....+%%+.@@@.......@%.......
-    0x00, 0x00, 0x02, 0xcf, 0x07, 0x40, 0x00, 0x00,  //...........%@.@@..+@+........
-    0x00, 0x00, 0x07, 0x8b, 0x2f, 0x80, 0x00, 0x00,  //..........+@%.%@.%@@%........
-    0x00, 0xbf, 0xed, 0x04, 0xa0, 0xb0, 0x00, 0x00,  //....%@@@@%@+..+.%%..%@.......
-    0x0b, 0xff, 0xfc, 0xbf, 0x40, 0x1d, 0x00, 0x00,  //..%@@@@@@@@.%@@@+....+@+.....
-    0x3f, 0xfa, 0xbf, 0x87, 0xd0, 0x03, 0x80, 0x00,  //.@@@@@%%%@@@%.+@@+.....@%....
-    0xbf, 0x40, 0x1f, 0x00, 0x7d, 0x00, 0xb0, 0x00,  //%@@@+....+@@....+@@+....%@...
-    0xfd, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x1d, 0x00,  //@@@.......@@......+@%....+@+.
-    0xf8, 0x00, 0x3e, 0x00, 0x00, 0x78, 0x03, 0x40,  //@@%......@@%........+@%....@+
-    0xfc, 0x01, 0xfc, 0x00, 0x00, 0x0b, 0x8b, 0x00,  //@@@....+@@@...........%@%.%@.
-    0xff, 0xaf, 0xf4, 0x00, 0x00, 0x00, 0xb4, 0x00,  //@@@@%%@@@@+.............%@+..
-    0x7f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@+...................
-    0x0b, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@%+.....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xe1, 0x00, 0x01, 0x05, 0xa4, 0xfb, 0x00, 0x02, 0x3f, 0xff, 0x80, 0xfc, 0x00, 0x02, 0xff, 0xff,
+    0xf0, 0xfe, 0x00, 0x37, 0x10, 0x00, 0xfd, 0x06, 0xfc, 0x00, 0x00, 0x02, 0xee, 0x00, 0xf8, 0x00,
+    0x7e, 0x00, 0x00, 0x2e, 0x03, 0x40, 0xfc, 0x00, 0x1f, 0x00, 0x01, 0xe0, 0x0b, 0x00, 0xfe, 0x00,
+    0x0f, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x7f, 0xd0, 0x2f, 0x01, 0xf4, 0x01, 0xd0, 0x00, 0x1f, 0xff,
+    0xfe, 0xdb, 0x40, 0x0b, 0x00, 0x00, 0x02, 0xff, 0xfc, 0xb8, 0x00, 0x28, 0xfe, 0x00, 0x04, 0x1a,
+    0x4f, 0xc0, 0x00, 0xe0, 0xfd, 0x00, 0x03, 0x02, 0xcf, 0x07, 0x40, 0xfd, 0x00, 0x03, 0x07, 0x8b,
+    0x2f, 0x80, 0xfe, 0x00, 0x39, 0xbf, 0xed, 0x04, 0xa0, 0xb0, 0x00, 0x00, 0x0b, 0xff, 0xfc, 0xbf,
+    0x40, 0x1d, 0x00, 0x00, 0x3f, 0xfa, 0xbf, 0x87, 0xd0, 0x03, 0x80, 0x00, 0xbf, 0x40, 0x1f, 0x00,
+    0x7d, 0x00, 0xb0, 0x00, 0xfd, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x1d, 0x00, 0xf8, 0x00, 0x3e, 0x00,
+    0x00, 0x78, 0x03, 0x40, 0xfc, 0x01, 0xfc, 0x00, 0x00, 0x0b, 0x8b, 0x00, 0xff, 0xaf, 0xf4, 0xfe,
+    0x00, 0x04, 0xb4, 0x00, 0x7f, 0xff, 0xd0, 0xfc, 0x00, 0x01, 0x0b, 0xf9, 0xe3, 0x00,
 
     /*Unicode: U+f0c5 () , Width: 29 */
-    0x00, 0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0x00,  //........+@@@@@@@@@+..........
-    0x00, 0x02, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,  //.......%@@@@@@@@@@@..........
-    0x00, 0x0b, 0xf0, 0x00, 0x3c, 0x00, 0x00, 0x00,  //......%@@@.......@@..........
-    0x00, 0x2f, 0xf0, 0x00, 0x3c, 0x00, 0x00, 0x00,  //.....%@@@@.......@@..........
-    0x00, 0xbc, 0xf0, 0x00, 0x3c, 0x00, 0x00, 0x00,  //....%@@.@@.......@@..........
-    0x02, 0xf0, 0xf0, 0x00, 0x3c, 0x00, 0x00, 0x00,  //...%@@..@@.......@@..........
-    0x0b, 0xc0, 0xf0, 0x00, 0x3e, 0xff, 0xff, 0x40,  //..%@@...@@.......@@%@@@@@@@@+
-    0x2f, 0x00, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xc0,  //.%@@....@@.......@@@@@@@@@@@@
-    0x7f, 0xff, 0xf0, 0x00, 0x3f, 0xc0, 0x03, 0xc0,  //+@@@@@@@@@.......@@@@......@@
-    0xff, 0xff, 0xe0, 0x00, 0xff, 0xc0, 0x03, 0xc0,  //@@@@@@@@@%......@@@@@......@@
-    0xf0, 0x00, 0x00, 0x03, 0xf3, 0xc0, 0x03, 0xc0,  //@@.............@@@.@@......@@
-    0xf0, 0x00, 0x00, 0x1f, 0xc3, 0xc0, 0x03, 0xc0,  //@@...........+@@@..@@......@@
-    0xf0, 0x00, 0x00, 0x7f, 0x03, 0xc0, 0x03, 0xc0,  //@@..........+@@@...@@......@@
-    0xf0, 0x00, 0x01, 0xfc, 0x03, 0xc0, 0x03, 0xc0,  //@@.........+@@@....@@......@@
-    0xf0, 0x00, 0x03, 0xf4, 0x03, 0xc0, 0x03, 0xc0,  //@@.........@@@+....@@......@@
-    0xf0, 0x00, 0x0b, 0xff, 0xff, 0xc0, 0x03, 0xc0,  //@@........%@@@@@@@@@@......@@
-    0xf0, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x03, 0xc0,  //@@........@@@@@@@@@@+......@@
-    0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //@@........@@+..............@@
-    0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //@@........@@+..............@@
-    0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //@@........@@+..............@@
-    0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //@@........@@+..............@@
-    0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x03, 0xc0,  //@@@@@@@@@@@@+..............@@
-    0xbf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x03, 0xc0,  //%@@@@@@@@@@@+..............@@
-    0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //..........@@+..............@@
-    0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //..........@@+..............@@
-    0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //..........@@+..............@@
-    0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0,  //..........@@+..............@@
-    0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc0,  //..........@@@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x80,  //..........+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0x04, 0x00, 0x00, 0x7f, 0xff, 0xf4, 0xfd, 0x00, 0x03, 0x02, 0xff, 0xff, 0xfc, 0xfd, 0x00, 0x03,
+    0x0b, 0xf0, 0x00, 0x3c, 0xfd, 0x00, 0x03, 0x2f, 0xf0, 0x00, 0x3c, 0xfd, 0x00, 0x03, 0xbc, 0xf0,
+    0x00, 0x3c, 0xfe, 0x00, 0x04, 0x02, 0xf0, 0xf0, 0x00, 0x3c, 0xfe, 0x00, 0x77, 0x0b, 0xc0, 0xf0,
+    0x00, 0x3e, 0xff, 0xff, 0x40, 0x2f, 0x00, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xf0,
+    0x00, 0x3f, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x00,
+    0x03, 0xf3, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x00, 0x1f, 0xc3, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x00,
+    0x7f, 0x03, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x01, 0xfc, 0x03, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x03,
+    0xf4, 0x03, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x0b, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0xf0, 0x00, 0x0f,
+    0xff, 0xff, 0x40, 0x03, 0xc0, 0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0xf0, 0x00, 0x0f,
+    0x40, 0x00, 0x00, 0x03, 0xc0, 0xf0, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0xf0, 0x00, 0x0f,
+    0x40, 0x00, 0x00, 0x03, 0xc0, 0xfe, 0xff, 0x2f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0xbf, 0xff, 0xff,
+    0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f,
+    0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f,
+    0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x07, 0xfd,
+    0xff, 0x00, 0x80, 0xf9, 0x00,
 
     /*Unicode: U+f0c7 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x7f, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00,  //+@@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@%.....
-    0xf0, 0xff, 0xf4, 0x03, 0xcf, 0x80, 0x00,  //@@..@@@@@@+....@@.@@%....
-    0xf0, 0xff, 0xf0, 0x03, 0xc3, 0xe0, 0x00,  //@@..@@@@@@.....@@..@@%...
-    0xf0, 0xff, 0xf0, 0x03, 0xc0, 0xf8, 0x00,  //@@..@@@@@@.....@@...@@%..
-    0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x3e, 0x00,  //@@..@@@@@@.....@@....@@%.
-    0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x0f, 0x40,  //@@..@@@@@@.....@@.....@@+
-    0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x07, 0xc0,  //@@..@@@@@@.....@@.....+@@
-    0xf0, 0xff, 0xf4, 0x03, 0xc0, 0x03, 0xc0,  //@@..@@@@@@+....@@......@@
-    0xf0, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@......@@
-    0xf0, 0x7f, 0xff, 0xff, 0x40, 0x03, 0xc0,  //@@..+@@@@@@@@@@@+......@@
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.....................@@
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.....................@@
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.....................@@
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.....................@@
-    0xf0, 0xbf, 0xff, 0xff, 0xff, 0x83, 0xc0,  //@@..%@@@@@@@@@@@@@@@%..@@
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc0,  //@@..@@@@@@@@@@@@@@@@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,  //@@..@@.............@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf3, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x02, 0xf4, 0x00, 0x00, 0xfd, 0xff, 0x34, 0xfe, 0x00, 0x00,
+    0xf0, 0xff, 0xf4, 0x03, 0xcf, 0x80, 0x00, 0xf0, 0xff, 0xf0, 0x03, 0xc3, 0xe0, 0x00, 0xf0, 0xff,
+    0xf0, 0x03, 0xc0, 0xf8, 0x00, 0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x3e, 0x00, 0xf0, 0xff, 0xf0, 0x03,
+    0xc0, 0x0f, 0x40, 0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x07, 0xc0, 0xf0, 0xff, 0xf4, 0x03, 0xc0, 0x03,
+    0xc0, 0xf0, 0xfe, 0xff, 0x0a, 0xc0, 0x03, 0xc0, 0xf0, 0x7f, 0xff, 0xff, 0x40, 0x03, 0xc0, 0xf0,
+    0xfd, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfd, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfd, 0x00, 0x02, 0x03,
+    0xc0, 0xf0, 0xfd, 0x00, 0x03, 0x03, 0xc0, 0xf0, 0xbf, 0xfe, 0xff, 0x02, 0x83, 0xc0, 0xf0, 0xfd,
+    0xff, 0x2b, 0xc3, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x03,
+    0xc3, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0,
+    0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xc3, 0xc0, 0xfb, 0xff,
+    0x01, 0xc0, 0xbf, 0xfc, 0xff, 0x00, 0x80, 0xec, 0x00,
 
     /*Unicode: U+f0e7 () , Width: 15 */
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00,  //...............
-    0x02, 0xff, 0xf0, 0x00,  //...%@@@@@@.....
-    0x03, 0xff, 0xf0, 0x00,  //...@@@@@@@.....
-    0x03, 0xff, 0xd0, 0x00,  //...@@@@@@+.....
-    0x07, 0xff, 0xc0, 0x00,  //..+@@@@@@......
-    0x0b, 0xff, 0x80, 0x00,  //..%@@@@@%......
-    0x0f, 0xff, 0x40, 0x00,  //..@@@@@@+......
-    0x0f, 0xff, 0x00, 0x00,  //..@@@@@@.......
-    0x1f, 0xfe, 0x06, 0xf4,  //.+@@@@@%..+%@@+
-    0x2f, 0xfe, 0xff, 0xf0,  //.%@@@@@%@@@@@@.
-    0x3f, 0xff, 0xff, 0xe0,  //.@@@@@@@@@@@@%.
-    0x3f, 0xff, 0xff, 0xc0,  //.@@@@@@@@@@@@..
-    0x7f, 0xff, 0xff, 0x80,  //+@@@@@@@@@@@%..
-    0xbf, 0xff, 0xff, 0x40,  //%@@@@@@@@@@@+..
-    0xff, 0xe6, 0xff, 0x00,  //@@@@@%+%@@@@...
-    0xa4, 0x03, 0xfd, 0x00,  //%%+....@@@@+...
-    0x00, 0x03, 0xfc, 0x00,  //.......@@@@....
-    0x00, 0x07, 0xf4, 0x00,  //......+@@@+....
-    0x00, 0x0b, 0xf0, 0x00,  //......%@@@.....
-    0x00, 0x0f, 0xd0, 0x00,  //......@@@+.....
-    0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-    0x00, 0x1f, 0x80, 0x00,  //.....+@@%......
-    0x00, 0x2f, 0x00, 0x00,  //.....%@@.......
-    0x00, 0x3e, 0x00, 0x00,  //.....@@%.......
-    0x00, 0x3c, 0x00, 0x00,  //.....@@........
-    0x00, 0x78, 0x00, 0x00,  //....+@%........
-    0x00, 0xb0, 0x00, 0x00,  //....%@.........
-    0x00, 0xa0, 0x00, 0x00,  //....%%.........
-    0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xf9, 0x00, 0x55, 0x02, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xd0, 0x00, 0x07,
+    0xff, 0xc0, 0x00, 0x0b, 0xff, 0x80, 0x00, 0x0f, 0xff, 0x40, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x1f,
+    0xfe, 0x06, 0xf4, 0x2f, 0xfe, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xc0, 0x7f,
+    0xff, 0xff, 0x80, 0xbf, 0xff, 0xff, 0x40, 0xff, 0xe6, 0xff, 0x00, 0xa4, 0x03, 0xfd, 0x00, 0x00,
+    0x03, 0xfc, 0x00, 0x00, 0x07, 0xf4, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x0f, 0xd0, 0x00, 0x00,
+    0x0f, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x2f, 0xfe, 0x00, 0x00, 0x3e, 0xfe, 0x00, 0x00,
+    0x3c, 0xfe, 0x00, 0x00, 0x78, 0xfe, 0x00, 0x00, 0xb0, 0xfe, 0x00, 0x00, 0xa0, 0xfb, 0x00,
 
     /*Unicode: U+f0f3 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,  //............+%+............
-    0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x00,  //...........+@@@+...........
-    0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x07, 0xff, 0xff, 0xff, 0x40, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xd0, 0x00,  //.....+@@@@@@@@@@@@@@@+.....
-    0x00, 0x2f, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.....@@@@@@@@@@@@@@@@%.....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x00,  //....+@@@@@@@@@@@@@@@@@.....
-    0x00, 0xbf, 0xff, 0xff, 0xff, 0xf4, 0x00,  //....%@@@@@@@@@@@@@@@@@+....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //....@@@@@@@@@@@@@@@@@@%....
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x02, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,  //...%@@@@@@@@@@@@@@@@@@@%...
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@@@@@@@@@@@@@@@@@@@...
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //..@@@@@@@@@@@@@@@@@@@@@@%..
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //.%@@@@@@@@@@@@@@@@@@@@@@@%.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x00, 0x00, 0x2a, 0xff, 0xe0, 0x00, 0x00,  //.........%%%@@@@@%.........
-    0x00, 0x00, 0x1d, 0xff, 0xd0, 0x00, 0x00,  //.........+@+@@@@@+.........
-    0x00, 0x00, 0x0b, 0x6f, 0x80, 0x00, 0x00,  //..........%@+%@@%..........
-    0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x00,  //...........%@@@%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xfe, 0x00, 0x00, 0x64, 0xfb, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0x01, 0xfd, 0xfc, 0x00, 0x02,
+    0x7f, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0x01, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff,
+    0x03, 0x40, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x03, 0xd0,
+    0x00, 0x00, 0x2f, 0xfe, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x03, 0xe0, 0x00, 0x00,
+    0x3f, 0xfe, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x3f, 0xfe,
+    0xff, 0x03, 0xf0, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x03,
+    0xf0, 0x00, 0x00, 0xbf, 0xfe, 0xff, 0x02, 0xf4, 0x00, 0x00, 0xfd, 0xff, 0x02, 0xf8, 0x00, 0x00,
+    0xfd, 0xff, 0x02, 0xfc, 0x00, 0x02, 0xfd, 0xff, 0x02, 0xfe, 0x00, 0x03, 0xfc, 0xff, 0x01, 0x00,
+    0x0f, 0xfc, 0xff, 0x01, 0x80, 0x2f, 0xfc, 0xff, 0x01, 0xe0, 0xbf, 0xfc, 0xff, 0x00, 0xf8, 0xfb,
+    0xff, 0x01, 0xfc, 0x3f, 0xfc, 0xff, 0x05, 0xf0, 0x00, 0x00, 0x2a, 0xff, 0xe0, 0xfd, 0x00, 0x02,
+    0x1d, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x0b, 0x6f, 0x80, 0xfd, 0x00, 0x01, 0x02, 0xfe, 0xf7, 0x00,
 
     /*Unicode: U+f11c () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0xf0, 0xf0, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xf0, 0xf0, 0xf0, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c,  //@@.......................@@..@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c,  //@@.......................@@..@@.
-    0xf0, 0xff, 0x0f, 0x03, 0xc3, 0xc3, 0xfc, 0x3c,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xf0, 0xff, 0x0f, 0x03, 0xc3, 0xc3, 0xfc, 0x3c,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xf0, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,  //@@...........................@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xd1, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xf4, 0xfa, 0xff, 0x01, 0xfc, 0xf0, 0xfb, 0x00, 0x01,
+    0x3c, 0xf0, 0xfb, 0x00, 0x01, 0x3c, 0xf0, 0xfb, 0x00, 0x00, 0x3c, 0xfe, 0xf0, 0x00, 0xfc, 0xfd,
+    0x3c, 0xfe, 0xf0, 0x00, 0xfc, 0xfd, 0x3c, 0x00, 0xf0, 0xfc, 0x00, 0x02, 0x3c, 0x3c, 0xf0, 0xfc,
+    0x00, 0x12, 0x3c, 0x3c, 0xf0, 0xff, 0x0f, 0x03, 0xc3, 0xc3, 0xfc, 0x3c, 0xf0, 0xff, 0x0f, 0x03,
+    0xc3, 0xc3, 0xfc, 0x3c, 0xf0, 0xfb, 0x00, 0x01, 0x3c, 0xf0, 0xfb, 0x00, 0x02, 0x3c, 0xf0, 0xf0,
+    0xfe, 0xff, 0x04, 0xfc, 0x3c, 0x3c, 0xf0, 0xf0, 0xfe, 0xff, 0x03, 0xfc, 0x3c, 0x3c, 0xf0, 0xfb,
+    0x00, 0x01, 0x3c, 0xf0, 0xfb, 0x00, 0x00, 0x3c, 0xfa, 0xff, 0x01, 0xfc, 0x3f, 0xfb, 0xff, 0x00,
+    0xf4, 0xd9, 0x00,
 
     /*Unicode: U+f124 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24,  //.....................%+
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xf8,  //...................%@@%
-    0x00, 0x00, 0x00, 0x00, 0x2f, 0xf4,  //.................%@@@@+
-    0x00, 0x00, 0x00, 0x02, 0xff, 0xf0,  //...............%@@@@@@.
-    0x00, 0x00, 0x00, 0x2f, 0xff, 0xd0,  //.............%@@@@@@@+.
-    0x00, 0x00, 0x02, 0xff, 0xff, 0xc0,  //...........%@@@@@@@@@..
-    0x00, 0x00, 0x2f, 0xff, 0xff, 0x40,  //.........%@@@@@@@@@@+..
-    0x00, 0x02, 0xff, 0xff, 0xff, 0x00,  //.......%@@@@@@@@@@@@...
-    0x00, 0x2f, 0xff, 0xff, 0xfd, 0x00,  //.....%@@@@@@@@@@@@@+...
-    0x02, 0xff, 0xff, 0xff, 0xfc, 0x00,  //...%@@@@@@@@@@@@@@@....
-    0x2f, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.%@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //@@@@@@@@@@@@@@@@@@.....
-    0x6a, 0xaa, 0xaf, 0xff, 0xd0, 0x00,  //+%%%%%%%%%@@@@@@@+.....
-    0x00, 0x00, 0x0b, 0xff, 0xc0, 0x00,  //..........%@@@@@@......
-    0x00, 0x00, 0x0b, 0xff, 0x40, 0x00,  //..........%@@@@@+......
-    0x00, 0x00, 0x0b, 0xff, 0x00, 0x00,  //..........%@@@@@.......
-    0x00, 0x00, 0x0b, 0xfd, 0x00, 0x00,  //..........%@@@@+.......
-    0x00, 0x00, 0x0b, 0xfc, 0x00, 0x00,  //..........%@@@@........
-    0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00,  //..........%@@@+........
-    0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //..........%@@@.........
-    0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00,  //..........%@@+.........
-    0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00,  //..........%@@..........
-    0x00, 0x00, 0x07, 0x40, 0x00, 0x00,  //..........+@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xe4, 0x00, 0x00, 0x24, 0xfd, 0x00, 0x01, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0x2f, 0xf4, 0xfe, 0x00,
+    0x02, 0x02, 0xff, 0xf0, 0xfe, 0x00, 0x10, 0x2f, 0xff, 0xd0, 0x00, 0x00, 0x02, 0xff, 0xff, 0xc0,
+    0x00, 0x00, 0x2f, 0xff, 0xff, 0x40, 0x00, 0x02, 0xfe, 0xff, 0x07, 0x00, 0x00, 0x2f, 0xff, 0xff,
+    0xfd, 0x00, 0x02, 0xfe, 0xff, 0x02, 0xfc, 0x00, 0x2f, 0xfe, 0xff, 0x01, 0xf4, 0x00, 0xfd, 0xff,
+    0x06, 0xf0, 0x00, 0x6a, 0xaa, 0xaf, 0xff, 0xd0, 0xfe, 0x00, 0x02, 0x0b, 0xff, 0xc0, 0xfe, 0x00,
+    0x02, 0x0b, 0xff, 0x40, 0xfe, 0x00, 0x01, 0x0b, 0xff, 0xfd, 0x00, 0x01, 0x0b, 0xfd, 0xfd, 0x00,
+    0x01, 0x0b, 0xfc, 0xfd, 0x00, 0x01, 0x0b, 0xf4, 0xfd, 0x00, 0x01, 0x0b, 0xf0, 0xfd, 0x00, 0x01,
+    0x0b, 0xd0, 0xfd, 0x00, 0x01, 0x0b, 0xc0, 0xfd, 0x00, 0x01, 0x07, 0x40, 0xed, 0x00,
 
     /*Unicode: U+f15b () , Width: 25 */
-    0x7f, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,  //+@@@@@@@@@@@@@+..........
-    0xff, 0xff, 0xff, 0xf4, 0x60, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+%.......
-    0xff, 0xff, 0xff, 0xf4, 0x78, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@%......
-    0xff, 0xff, 0xff, 0xf4, 0x7e, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@%.....
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0x80, 0x00,  //@@@@@@@@@@@@@@+.+@@@%....
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xe0, 0x00,  //@@@@@@@@@@@@@@+.+@@@@%...
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xf8, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@%..
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xfe, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@@%.
-    0xff, 0xff, 0xff, 0xf4, 0x15, 0x55, 0x00,  //@@@@@@@@@@@@@@+..+++++++.
-    0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0x80,  //@@@@@@@@@@@@@@@@%%%%%%%%%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x03, 0x7f, 0xff, 0xff, 0xf4, 0xfe, 0x00, 0xfe, 0xff, 0x03, 0xf4, 0x60, 0x00, 0x00, 0xfe, 0xff,
+    0x03, 0xf4, 0x78, 0x00, 0x00, 0xfe, 0xff, 0x03, 0xf4, 0x7e, 0x00, 0x00, 0xfe, 0xff, 0x03, 0xf4,
+    0x7f, 0x80, 0x00, 0xfe, 0xff, 0x03, 0xf4, 0x7f, 0xe0, 0x00, 0xfe, 0xff, 0x03, 0xf4, 0x7f, 0xf8,
+    0x00, 0xfe, 0xff, 0x03, 0xf4, 0x7f, 0xfe, 0x00, 0xfe, 0xff, 0x03, 0xf4, 0x15, 0x55, 0x00, 0xfe,
+    0xff, 0x00, 0xf8, 0xfe, 0x00, 0xfd, 0xff, 0x02, 0xaa, 0xaa, 0x80, 0xfb, 0xff, 0x00, 0xc0, 0xfb,
+    0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb,
+    0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb,
+    0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb,
+    0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0xff, 0x01, 0xc0, 0x7f,
+    0xfc, 0xff, 0x00, 0x40, 0xfa, 0x00,
 
     /*Unicode: U+f1eb () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x06, 0xbf, 0xfe, 0x40, 0x00, 0x00,  //..........+%%@@@@@@%+...........
-    0x00, 0x01, 0xbf, 0xff, 0xff, 0xfe, 0x00, 0x00,  //.......+%@@@@@@@@@@@@@@%........
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@%......
-    0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,  //....%@@@@@@@@@@@@@@@@@@@@@@%....
-    0x07, 0xff, 0xfe, 0x50, 0x06, 0xff, 0xff, 0xc0,  //..+@@@@@@@@%++....+%@@@@@@@@@...
-    0x2f, 0xff, 0xd0, 0x00, 0x00, 0x0b, 0xff, 0xf4,  //.%@@@@@@@+............%@@@@@@@+.
-    0xbf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfd,  //%@@@@@@+................%@@@@@@+
-    0xff, 0xf0, 0x02, 0xff, 0xfe, 0x40, 0x0f, 0xfe,  //@@@@@@.....%@@@@@@@%+.....@@@@@%
-    0x3f, 0x80, 0x7f, 0xff, 0xff, 0xfd, 0x03, 0xf8,  //.@@@%...+@@@@@@@@@@@@@@+...@@@%.
-    0x0d, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa0,  //..@+..+@@@@@@@@@@@@@@@@@@...%%..
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@@+.....
-    0x00, 0x7f, 0xff, 0x90, 0x06, 0xff, 0xfc, 0x00,  //....+@@@@@@@%+....+%@@@@@@@.....
-    0x00, 0x3f, 0xf4, 0x00, 0x00, 0x1f, 0xf8, 0x00,  //.....@@@@@...........+@@@@%.....
-    0x00, 0x0f, 0x40, 0xbf, 0xfd, 0x02, 0xe0, 0x00,  //......@@+...%@@@@@%+...%@%......
-    0x00, 0x00, 0x0b, 0xff, 0xff, 0xe0, 0x00, 0x00,  //..........%@@@@@@@@@@+..........
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x0f, 0xe0, 0x1b, 0xe0, 0x00, 0x00,  //..........@@@%....%@@%..........
-    0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00,  //...........+........+...........
-    0x00, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x00,  //..............%@@%..............
-    0x00, 0x00, 0x00, 0x2f, 0xf4, 0x00, 0x00, 0x00,  //.............%@@@@+.............
-    0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00,  //..............@@@%..............
-    0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00,  //...............%%...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xef, 0x00, 0x03, 0x06, 0xbf, 0xfe, 0x40, 0xfe, 0x00, 0x04, 0x01, 0xbf, 0xff, 0xff, 0xfe, 0xfe,
+    0x00, 0x00, 0x1f, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0xbf, 0xfd, 0xff, 0x13, 0xfe, 0x00, 0x07,
+    0xff, 0xfe, 0x50, 0x06, 0xff, 0xff, 0xc0, 0x2f, 0xff, 0xd0, 0x00, 0x00, 0x0b, 0xff, 0xf4, 0xbf,
+    0xfd, 0xfd, 0x00, 0x13, 0xbf, 0xfd, 0xff, 0xf0, 0x02, 0xff, 0xfe, 0x40, 0x0f, 0xfe, 0x3f, 0x80,
+    0x7f, 0xff, 0xff, 0xfd, 0x03, 0xf8, 0x0d, 0x07, 0xfd, 0xff, 0x03, 0xc0, 0xa0, 0x00, 0x1f, 0xfd,
+    0xff, 0x18, 0xf4, 0x00, 0x00, 0x7f, 0xff, 0x90, 0x06, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xf4, 0x00,
+    0x00, 0x1f, 0xf8, 0x00, 0x00, 0x0f, 0x40, 0xbf, 0xfd, 0x02, 0xe0, 0xfe, 0x00, 0x03, 0x0b, 0xff,
+    0xff, 0xe0, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xf8,
+    0xfd, 0x00, 0x03, 0x0f, 0xe0, 0x1b, 0xe0, 0xfd, 0x00, 0x03, 0x01, 0x00, 0x00, 0x40, 0xfc, 0x00,
+    0x01, 0x0b, 0xe0, 0xfb, 0x00, 0x01, 0x2f, 0xf4, 0xfb, 0x00, 0x01, 0x0f, 0xe0, 0xfb, 0x00, 0x01,
+    0x02, 0x80, 0xd6, 0x00,
 
     /*Unicode: U+f240 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x3c, 0x00,  //@@..+++++++++++++++++++++++++++..@@...
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3d, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@+..
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0x40,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@+.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xd9, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfb, 0x55, 0x03, 0x54,
+    0x3c, 0x00, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x3d, 0x00, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x3f, 0xc0,
+    0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x03, 0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x03, 0xc0, 0xf0, 0xfb,
+    0xff, 0x03, 0xfc, 0x03, 0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x03, 0xc0, 0xf0, 0xfb, 0xff, 0x03,
+    0xfc, 0x03, 0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x03, 0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x03,
+    0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x3f, 0xc0, 0xf0, 0xfb, 0xff, 0x03, 0xfc, 0x3f, 0x40, 0xf0,
+    0xfb, 0xff, 0x03, 0xfc, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02,
+    0x3c, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xfc, 0x00, 0x2f, 0xfa, 0xff, 0x00, 0xe0, 0xce, 0x00,
 
     /*Unicode: U+f241 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x3c, 0x00,  //@@..+++++++++++++++++++++........@@...
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3d, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@+..
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0x40,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@+.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3c, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xd9, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfc, 0x55, 0x04, 0x40,
+    0x00, 0x3c, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x3d, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x3f, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x03, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x3f, 0xc0, 0xf0, 0xfc, 0xff, 0x04, 0x80, 0x00, 0x3f, 0x40, 0xf0, 0xfc, 0xff, 0x04, 0x80,
+    0x00, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xbf,
+    0xfa, 0xff, 0x02, 0xfc, 0x00, 0x2f, 0xfa, 0xff, 0x00, 0xe0, 0xce, 0x00,
 
     /*Unicode: U+f242 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@..++++++++++++++...............@@...
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x3d, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@+..
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x3f, 0x40,  //@@..@@@@@@@@@@@@@@+..............@@@+.
-    0xf0, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xd9, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfe, 0x55, 0x00, 0x50,
+    0xfe, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x3d, 0x00, 0xf0,
+    0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x3f, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00,
+    0x02, 0x03, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfe, 0xff,
+    0x00, 0xf4, 0xfe, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x03,
+    0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4,
+    0xfe, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x03, 0xc0, 0xf0,
+    0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x3f, 0xc0, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00,
+    0x02, 0x3f, 0x40, 0xf0, 0xfe, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00,
+    0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xfc, 0x00, 0x2f,
+    0xfa, 0xff, 0x00, 0xe0, 0xce, 0x00,
 
     /*Unicode: U+f243 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@..++++++++.....................@@...
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00,  //@@..@@@@@@@@+....................@@+..
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@+....................@@@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@..@@@@@@@@+......................@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0,  //@@..@@@@@@@@+....................@@@@.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40,  //@@..@@@@@@@@+....................@@@+.
-    0xf0, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@..@@@@@@@@+....................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xd9, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x04, 0x3c, 0x00, 0xf0, 0x55, 0x55, 0xfc, 0x00,
+    0x05, 0x3c, 0x00, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x3d, 0x00, 0xf0, 0xff, 0xff, 0x40,
+    0xfd, 0x00, 0x05, 0x3f, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x03, 0xc0, 0xf0, 0xff,
+    0xff, 0x40, 0xfd, 0x00, 0x05, 0x03, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x03, 0xc0,
+    0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x03, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05,
+    0x03, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x03, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd,
+    0x00, 0x05, 0x03, 0xc0, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x05, 0x3f, 0xc0, 0xf0, 0xff, 0xff,
+    0x40, 0xfd, 0x00, 0x05, 0x3f, 0x40, 0xf0, 0xff, 0xff, 0x40, 0xfd, 0x00, 0x02, 0x3c, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xfc,
+    0x00, 0x2f, 0xfa, 0xff, 0x00, 0xe0, 0xce, 0x00,
 
     /*Unicode: U+f244 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00,  //@@...............................@@+..
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,  //@@...............................@@@%.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,  //@@.................................@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0,  //@@...............................@@@@.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40,  //@@...............................@@@+.
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xd9, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c,
+    0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3d, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3f, 0x80, 0xf0, 0xfa, 0x00,
+    0x02, 0x03, 0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x03, 0xc0, 0xf0,
+    0xfa, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x03,
+    0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x03, 0xc0, 0xf0, 0xfa, 0x00, 0x02, 0x3f, 0xc0, 0xf0, 0xfa, 0x00,
+    0x02, 0x3f, 0x40, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x3c, 0x00, 0xf0,
+    0xfa, 0x00, 0x02, 0x3c, 0x00, 0xbf, 0xfa, 0xff, 0x02, 0xfc, 0x00, 0x2f, 0xfa, 0xff, 0x00, 0xe0,
+    0xce, 0x00,
 
     /*Unicode: U+f293 () , Width: 22 */
-    0x00, 0x06, 0xff, 0xe8, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x7f, 0xff, 0xff, 0x80, 0x00,  //....+@@@@@@@@@@@%.....
-    0x02, 0xff, 0xfb, 0xff, 0xf0, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x07, 0xff, 0xe2, 0xff, 0xfc, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x0f, 0xff, 0xe0, 0xbf, 0xfe, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x2f, 0xff, 0xe0, 0x2f, 0xff, 0x00,  //.%@@@@@@@%...%@@@@@@..
-    0x3f, 0xff, 0xe0, 0x0b, 0xff, 0x40,  //.@@@@@@@@%....%@@@@@+.
-    0x3f, 0xff, 0xe0, 0x42, 0xff, 0x80,  //.@@@@@@@@%..+..%@@@@%.
-    0x7f, 0xcb, 0xe0, 0xd0, 0xbf, 0xc0,  //+@@@@.%@@%..@+..%@@@@.
-    0xbf, 0x42, 0xe0, 0xf0, 0x3f, 0xc0,  //%@@@+..%@%..@@...@@@@.
-    0xff, 0xd0, 0xa0, 0xd0, 0xbf, 0xd0,  //%@@@@+..%%..@+..%@@@@+
-    0xff, 0xf4, 0x10, 0x42, 0xff, 0xd0,  //@@@@@@+..+..+..%@@@@@+
-    0xff, 0xfd, 0x00, 0x0b, 0xff, 0xd0,  //@@@@@@@+......%@@@@@@+
-    0xff, 0xff, 0x40, 0x2f, 0xff, 0xd0,  //@@@@@@@@+....%@@@@@@@+
-    0xff, 0xff, 0xc0, 0x7f, 0xff, 0xe0,  //@@@@@@@@@...+@@@@@@@@%
-    0xff, 0xff, 0x40, 0x2f, 0xff, 0xd0,  //@@@@@@@@+....%@@@@@@@+
-    0xff, 0xfd, 0x00, 0x0b, 0xff, 0xd0,  //@@@@@@@+......%@@@@@@+
-    0xff, 0xf4, 0x10, 0x42, 0xff, 0xd0,  //@@@@@@+..+..+..%@@@@@+
-    0xff, 0xd0, 0xa0, 0xd0, 0xbf, 0xd0,  //%@@@@+..%%..@+..%@@@@+
-    0xbf, 0x42, 0xe0, 0xf0, 0x3f, 0xc0,  //%@@@+..%@%..@@...@@@@.
-    0x7f, 0xcb, 0xe0, 0xd0, 0xbf, 0xc0,  //+@@@@.%@@%..@+..%@@@@.
-    0x3f, 0xff, 0xe0, 0x42, 0xff, 0x80,  //.@@@@@@@@%..+..%@@@@%.
-    0x3f, 0xff, 0xe0, 0x0b, 0xff, 0x40,  //.@@@@@@@@%....%@@@@@+.
-    0x2f, 0xff, 0xe0, 0x2f, 0xff, 0x00,  //.%@@@@@@@%...%@@@@@@..
-    0x0f, 0xff, 0xe0, 0xbf, 0xfe, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x07, 0xff, 0xe2, 0xff, 0xfc, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x02, 0xff, 0xfb, 0xff, 0xf0, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x00, 0x7f, 0xff, 0xff, 0x80, 0x00,  //....+@@@@@@@@@@@%.....
-    0x00, 0x06, 0xff, 0xf8, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................
-
-
+    0x03, 0x00, 0x06, 0xff, 0xe8, 0xfe, 0x00, 0x7f, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x02, 0xff, 0xfb,
+    0xff, 0xf0, 0x00, 0x07, 0xff, 0xe2, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xe0, 0xbf, 0xfe, 0x00, 0x2f,
+    0xff, 0xe0, 0x2f, 0xff, 0x00, 0x3f, 0xff, 0xe0, 0x0b, 0xff, 0x40, 0x3f, 0xff, 0xe0, 0x42, 0xff,
+    0x80, 0x7f, 0xcb, 0xe0, 0xd0, 0xbf, 0xc0, 0xbf, 0x42, 0xe0, 0xf0, 0x3f, 0xc0, 0xff, 0xd0, 0xa0,
+    0xd0, 0xbf, 0xd0, 0xff, 0xf4, 0x10, 0x42, 0xff, 0xd0, 0xff, 0xfd, 0x00, 0x0b, 0xff, 0xd0, 0xff,
+    0xff, 0x40, 0x2f, 0xff, 0xd0, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xe0, 0xff, 0xff, 0x40, 0x2f, 0xff,
+    0xd0, 0xff, 0xfd, 0x00, 0x0b, 0xff, 0xd0, 0xff, 0xf4, 0x10, 0x42, 0xff, 0xd0, 0xff, 0xd0, 0xa0,
+    0xd0, 0xbf, 0xd0, 0xbf, 0x42, 0xe0, 0xf0, 0x3f, 0xc0, 0x7f, 0xcb, 0xe0, 0xd0, 0xbf, 0xc0, 0x3f,
+    0xff, 0xe0, 0x42, 0xff, 0x80, 0x3f, 0xff, 0xe0, 0x24, 0x0b, 0xff, 0x40, 0x2f, 0xff, 0xe0, 0x2f,
+    0xff, 0x00, 0x0f, 0xff, 0xe0, 0xbf, 0xfe, 0x00, 0x07, 0xff, 0xe2, 0xff, 0xfc, 0x00, 0x02, 0xff,
+    0xfb, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x06, 0xff, 0xf8, 0xf9, 0x00,
 
 #elif USE_LV_FONT_SYMBOL_30 == 4
     /*Unicode: U+f001 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9b, 0x40,  //.....................+%%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0xff, 0xff, 0xe0,  //..................+%@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xcf, 0xff, 0xff, 0xff, 0xf0,  //...............+@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //...........+%@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.........%@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf0,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x72, 0x1f, 0xf0,  //........@@@@@@@@@@@%+..@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x00, 0x00, 0x1f, 0xf0,  //........@@@@@@@@%+.....@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd8, 0x30, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //........@@@@@%.........@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //........@@+............@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00, 0x12, 0x20, 0x1f, 0xf0,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xcf, 0xf0,  //........@@......+@@@@@%@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xf0,  //........@@.....@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //........@@....+@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0xff, 0x10, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xd0,  //........@@.....@@@@@@@@@@
-    0x04, 0xae, 0xff, 0xe9, 0xff, 0x10, 0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0x40,  //.+%@@@@%@@.....%@@@@@@@@+
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x39, 0xdf, 0xec, 0x71, 0x00,  //%@@@@@@@@@.......%@@@@+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xaf, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@+...............
-    0x05, 0xbf, 0xff, 0xea, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+%@@@@%.................
-    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xdd, 0x00, 0x02, 0x04, 0x9b, 0x40, 0xf9, 0x00, 0x04, 0x01, 0x6a, 0xff, 0xff, 0xe0, 0xfa, 0x00,
+    0x01, 0x27, 0xcf, 0xfe, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x01, 0x04, 0x9e, 0xfc, 0xff, 0x00, 0xf0,
+    0xfd, 0x00, 0x00, 0x3a, 0xfa, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xef, 0xfa, 0xff, 0x00, 0xf0,
+    0xfd, 0x00, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfa, 0xff,
+    0x01, 0xdf, 0xf0, 0xfd, 0x00, 0xfc, 0xff, 0x03, 0xfb, 0x72, 0x1f, 0xf0, 0xfd, 0x00, 0xfe, 0xff,
+    0x05, 0xfe, 0xa5, 0x00, 0x00, 0x1f, 0xf0, 0xfd, 0x00, 0x03, 0xff, 0xff, 0xd8, 0x30, 0xfe, 0x00,
+    0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0x72, 0xfc, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01,
+    0xff, 0x10, 0xfc, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0x10, 0xfc, 0x00, 0x01, 0x1f,
+    0xf0, 0xfd, 0x00, 0x01, 0xff, 0x10, 0xfc, 0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0x10,
+    0xfe, 0x00, 0x03, 0x12, 0x20, 0x1f, 0xf0, 0xfd, 0x00, 0x08, 0xff, 0x10, 0x00, 0x00, 0x7c, 0xff,
+    0xff, 0xcf, 0xf0, 0xfd, 0x00, 0x03, 0xff, 0x10, 0x00, 0x0c, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0x00,
+    0x03, 0xff, 0x10, 0x00, 0x4f, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x03, 0xff, 0x10, 0x00, 0x3f,
+    0xfd, 0xff, 0x08, 0xd0, 0x04, 0xae, 0xff, 0xe9, 0xff, 0x10, 0x00, 0x09, 0xfd, 0xff, 0x01, 0x40,
+    0x9f, 0xfd, 0xff, 0x07, 0x10, 0x00, 0x00, 0x39, 0xdf, 0xec, 0x71, 0x00, 0xfc, 0xff, 0x00, 0x10,
+    0xfa, 0x00, 0xfc, 0xff, 0xf9, 0x00, 0x00, 0xaf, 0xfe, 0xff, 0x00, 0xf6, 0xf9, 0x00, 0x04, 0x05,
+    0xbf, 0xff, 0xea, 0x30, 0xf7, 0x00, 0x00, 0x11, 0xf7, 0x00,
 
     /*Unicode: U+f008 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0x50, 0x04, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf4, 0x00, 0x4f, 0xf0,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x40, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0x00, 0x3f, 0xf1,  //@@+...@@...............@@....@@.
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0x61, 0x15, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf5, 0x11, 0x5f, 0xf1,  //@@+..+@@...............@@+..+@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x61, 0x15, 0xff, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6f, 0xf5, 0x11, 0x5f, 0xf1,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0x40, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf3, 0x00, 0x3f, 0xf1,  //@@+...@@+.............+@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x50, 0x04, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf4, 0x00, 0x4f, 0xf1,  //@@+..+@@...............@@+..+@@.
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0x40, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0x00, 0x3f, 0xf1,  //@@+...@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x10, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xf1,  //@@....@@...............@@....@@.
-    0xff, 0x40, 0x03, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf3, 0x00, 0x3f, 0xf0,  //@@+...@@+.............+@@....@@.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xe1, 0x00, 0x00, 0x1b, 0xf4, 0xff, 0x02, 0xfb, 0x10, 0xbf, 0xf3, 0xff, 0x05, 0xc0, 0xff, 0x50,
+    0x04, 0xff, 0x60, 0xfb, 0x00, 0x08, 0x6f, 0xf4, 0x00, 0x4f, 0xf0, 0xff, 0x10, 0x00, 0xff, 0xfa,
+    0x00, 0x08, 0x1f, 0xf0, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf0,
+    0x00, 0x0f, 0xf1, 0xff, 0x40, 0x03, 0xff, 0xfa, 0x00, 0x04, 0x1f, 0xf3, 0x00, 0x3f, 0xf1, 0xfd,
+    0xff, 0xfa, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0xfa, 0x00, 0x00, 0x1f, 0xfe,
+    0xff, 0x04, 0xf1, 0xff, 0x61, 0x15, 0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf5, 0x11, 0x5f, 0xf1, 0xff,
+    0x10, 0x00, 0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf0, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa,
+    0x00, 0x08, 0x1f, 0xf0, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x09, 0x1f, 0xf0,
+    0x00, 0x0f, 0xf1, 0xff, 0x61, 0x15, 0xff, 0x61, 0xfb, 0x11, 0x04, 0x6f, 0xf5, 0x11, 0x5f, 0xf1,
+    0xf2, 0xff, 0x00, 0xf1, 0xf2, 0xff, 0x05, 0xf1, 0xff, 0x40, 0x03, 0xff, 0x40, 0xfb, 0x00, 0x08,
+    0x5f, 0xf3, 0x00, 0x3f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf0, 0x00, 0x0f,
+    0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf0, 0x00, 0x0f, 0xf1, 0xff, 0x50, 0x04,
+    0xff, 0xfa, 0x00, 0x04, 0x1f, 0xf4, 0x00, 0x4f, 0xf1, 0xfd, 0xff, 0xfa, 0x00, 0x00, 0x1f, 0xfe,
+    0xff, 0x00, 0xf1, 0xfd, 0xff, 0xfa, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x04, 0xf1, 0xff, 0x40, 0x03,
+    0xff, 0xfa, 0x00, 0x08, 0x1f, 0xf3, 0x00, 0x3f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x08,
+    0x1f, 0xf0, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0xff, 0xfa, 0x00, 0x09, 0x1f, 0xf0, 0x00, 0x0f,
+    0xf1, 0xff, 0x40, 0x03, 0xff, 0x40, 0xfb, 0x00, 0x05, 0x5f, 0xf3, 0x00, 0x3f, 0xf0, 0xbf, 0xf3,
+    0xff, 0x01, 0xc0, 0x1c, 0xf4, 0xff, 0x01, 0xfc, 0x20, 0xf1, 0x00,
 
     /*Unicode: U+f00b () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0x02, 0x33, 0x33, 0x30, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x02, 0x33, 0x33, 0x30, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x00,  //.............................
-    0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x02, 0x33, 0x33, 0x30, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x00,  //.............................
-    0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xe3, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xf9, 0xff, 0x00, 0x70, 0xfd, 0xff, 0x01,
+    0x30, 0x9f, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd,
+    0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x06,
+    0xf0, 0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xf9, 0xff, 0x06, 0xa0, 0x02, 0x33, 0x33, 0x30, 0x00,
+    0x01, 0xfa, 0x33, 0x00, 0x32, 0xf1, 0x00, 0x05, 0x02, 0x33, 0x33, 0x30, 0x00, 0x01, 0xfa, 0x33,
+    0x07, 0x32, 0x00, 0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xf9, 0xff, 0x00, 0xa0, 0xfd, 0xff, 0x01,
+    0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd,
+    0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x30, 0x9f, 0xf9, 0xff, 0x06,
+    0xf0, 0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xf9, 0xff, 0x00, 0x70, 0xf2, 0x00, 0x05, 0x02, 0x33,
+    0x33, 0x30, 0x00, 0x01, 0xfa, 0x33, 0x07, 0x32, 0x00, 0xaf, 0xff, 0xff, 0xfe, 0x10, 0x5f, 0xf9,
+    0xff, 0x00, 0xa0, 0xfd, 0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x40,
+    0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0x40, 0xaf, 0xf9, 0xff, 0x00, 0xf0, 0xfd, 0xff,
+    0x01, 0x30, 0x9f, 0xf9, 0xff, 0x06, 0xf0, 0x7f, 0xff, 0xff, 0xfb, 0x00, 0x3e, 0xf9, 0xff, 0x00,
+    0x70, 0xb6, 0x00,
 
     /*Unicode: U+f00c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,  //.....................+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xc1, 0x00,  //...................+@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfc, 0x10,  //..................+@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xc0,  //.................+@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xf0,  //................+@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0x70,  //...............+@@@@@@@@+
-    0x00, 0x18, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xf7, 0x00,  //...%+.........+@@@@@@@@+.
-    0x02, 0xef, 0xf6, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00,  //..@@@+.......+@@@@@@@@+..
-    0x2e, 0xff, 0xff, 0x60, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //.@@@@@+.....+@@@@@@@@+...
-    0xdf, 0xff, 0xff, 0xf6, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //@@@@@@@+...+@@@@@@@@+....
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x5f, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00,  //@@@@@@@@+.+@@@@@@@@+.....
-    0x5f, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,  //+@@@@@@@@%@@@@@@@@+......
-    0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@@@@@@@@+.......
-    0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //..+@@@@@@@@@@@@@+........
-    0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@+.........
-    0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@+..........
-    0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@+...........
-    0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@+............
-    0x00, 0x00, 0x00, 0x05, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@+.............
-    0x00, 0x00, 0x00, 0x00, 0x4b, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+%+..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xb6, 0x00, 0x00, 0x36, 0xf6, 0x00, 0x02, 0x05, 0xff, 0xc1, 0xf7, 0x00, 0x03, 0x5f, 0xff, 0xfc,
+    0x10, 0xf9, 0x00, 0x00, 0x05, 0xfe, 0xff, 0x00, 0xc0, 0xf9, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0x00,
+    0xf0, 0xfa, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x03, 0x70, 0x00, 0x18, 0x50, 0xfd, 0x00, 0x00, 0x5f,
+    0xfe, 0xff, 0x04, 0xf7, 0x00, 0x02, 0xef, 0xf6, 0xfe, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x08, 0x70,
+    0x00, 0x2e, 0xff, 0xff, 0x60, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0x08, 0xf7, 0x00, 0x00, 0xdf, 0xff,
+    0xff, 0xf6, 0x00, 0x05, 0xfd, 0xff, 0x02, 0x70, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x60, 0x5f, 0xfe,
+    0xff, 0x00, 0xf7, 0xfe, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0x00, 0xfa, 0xfd, 0xff, 0x00, 0x70, 0xfe,
+    0x00, 0x00, 0x05, 0xfa, 0xff, 0x00, 0xf7, 0xfc, 0x00, 0x00, 0x5f, 0xfb, 0xff, 0x00, 0x70, 0xfc,
+    0x00, 0x00, 0x05, 0xfc, 0xff, 0x00, 0xf7, 0xfa, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0x70, 0xfa,
+    0x00, 0x00, 0x05, 0xfe, 0xff, 0x00, 0xf7, 0xf8, 0x00, 0x03, 0x5f, 0xff, 0xff, 0x70, 0xf8, 0x00,
+    0x02, 0x05, 0xff, 0xf7, 0xf6, 0x00, 0x01, 0x4b, 0x60, 0xb9, 0x00,
 
     /*Unicode: U+f00d () , Width: 20 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x08, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe6, 0x00,  //...%@%.........%@+..
-    0x00, 0x9f, 0xff, 0xa0, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x60,  //..%@@@%.......@@@@+.
-    0x09, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xf5,  //.%@@@@@%.....@@@@@@+
-    0x2f, 0xff, 0xff, 0xff, 0xa0, 0x01, 0xcf, 0xff, 0xff, 0xfe,  //.@@@@@@@%...@@@@@@@@
-    0x0e, 0xff, 0xff, 0xff, 0xfa, 0x1c, 0xff, 0xff, 0xff, 0xfc,  //.@@@@@@@@%.@@@@@@@@%
-    0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,  //..@@@@@@@@@@@@@@@@@.
-    0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,  //...@@@@@@@@@@@@@@@..
-    0x00, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00,  //....@@@@@@@@@@@@@...
-    0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00,  //.....@@@@@@@@@@@....
-    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x00,  //.....+@@@@@@@@@.....
-    0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00,  //.....@@@@@@@@@@%....
-    0x00, 0x01, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00,  //....@@@@@@@@@@@@%...
-    0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00,  //...@@@@@@@@@@@@@@%..
-    0x01, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //..@@@@@@@@@@@@@@@@%.
-    0x0c, 0xff, 0xff, 0xff, 0xfd, 0x4e, 0xff, 0xff, 0xff, 0xf9,  //.@@@@@@@@@+@@@@@@@@%
-    0x2f, 0xff, 0xff, 0xff, 0xd1, 0x03, 0xef, 0xff, 0xff, 0xff,  //.@@@@@@@@...@@@@@@@@
-    0x0c, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x3e, 0xff, 0xff, 0xf9,  //.@@@@@@@.....@@@@@@%
-    0x00, 0xcf, 0xff, 0xd1, 0x00, 0x00, 0x03, 0xef, 0xff, 0x90,  //..@@@@@.......@@@@%.
-    0x00, 0x0c, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x3e, 0xf9, 0x00,  //...@@@.........@@%..
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-
+    0xc4, 0x00, 0x01, 0x08, 0xf9, 0xfd, 0x00, 0x17, 0x1b, 0xe6, 0x00, 0x00, 0x9f, 0xff, 0xa0, 0x00,
+    0x00, 0x01, 0xcf, 0xff, 0x60, 0x09, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xf5, 0x2f,
+    0xfe, 0xff, 0x06, 0xa0, 0x01, 0xcf, 0xff, 0xff, 0xfe, 0x0e, 0xfe, 0xff, 0x01, 0xfa, 0x1c, 0xfe,
+    0xff, 0x02, 0xfc, 0x03, 0xef, 0xfa, 0xff, 0x02, 0xd1, 0x00, 0x3e, 0xfb, 0xff, 0x04, 0xfd, 0x10,
+    0x00, 0x03, 0xef, 0xfc, 0xff, 0x00, 0xd1, 0xfe, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0x01, 0xfd, 0x10,
+    0xfe, 0x00, 0x00, 0x04, 0xfd, 0xff, 0x00, 0xf1, 0xfd, 0x00, 0x00, 0x1c, 0xfd, 0xff, 0x00, 0xfa,
+    0xfe, 0x00, 0x01, 0x01, 0xcf, 0xfc, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x1c, 0xfb, 0xff, 0x03, 0xfa,
+    0x00, 0x01, 0xcf, 0xfa, 0xff, 0x01, 0xa0, 0x0c, 0xfe, 0xff, 0x01, 0xfd, 0x4e, 0xfe, 0xff, 0x01,
+    0xf9, 0x2f, 0xfe, 0xff, 0x02, 0xd1, 0x03, 0xef, 0xfe, 0xff, 0x17, 0x0c, 0xff, 0xff, 0xfd, 0x10,
+    0x00, 0x3e, 0xff, 0xff, 0xf9, 0x00, 0xcf, 0xff, 0xd1, 0x00, 0x00, 0x03, 0xef, 0xff, 0x90, 0x00,
+    0x0c, 0xfd, 0x10, 0xfe, 0x00, 0x01, 0x3e, 0xf9, 0xfe, 0x00, 0x00, 0x20, 0xfc, 0x00, 0x00, 0x20,
+    0xd8, 0x00,
 
     /*Unicode: U+f011 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x08, 0x93, 0x00, 0xff, 0xff, 0x20, 0x29, 0x81, 0x00, 0x00, 0x00,  //.....%%...@@@@...%%......
-    0x00, 0x01, 0xdf, 0xff, 0x10, 0xff, 0xff, 0x20, 0xdf, 0xfe, 0x20, 0x00, 0x00,  //....@@@@..@@@@..@@@@.....
-    0x00, 0x1d, 0xff, 0xff, 0x30, 0xff, 0xff, 0x21, 0xff, 0xff, 0xe2, 0x00, 0x00,  //...@@@@@..@@@@..@@@@@....
-    0x00, 0xbf, 0xff, 0xfd, 0x00, 0xff, 0xff, 0x20, 0xbf, 0xff, 0xfd, 0x00, 0x00,  //..%@@@@@..@@@@..%@@@@@...
-    0x05, 0xff, 0xff, 0xd1, 0x00, 0xff, 0xff, 0x20, 0x0c, 0xff, 0xff, 0x70, 0x00,  //.+@@@@@...@@@@...@@@@@+..
-    0x0d, 0xff, 0xfe, 0x10, 0x00, 0xff, 0xff, 0x20, 0x00, 0xcf, 0xff, 0xf0, 0x00,  //.@@@@@....@@@@....@@@@@..
-    0x4f, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x3f, 0xff, 0xf6, 0x00,  //+@@@@+....@@@@.....@@@@+.
-    0x9f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x0a, 0xff, 0xfb, 0x00,  //%@@@@.....@@@@.....%@@@%.
-    0xcf, 0xff, 0x70, 0x00, 0x00, 0xff, 0xff, 0x10, 0x00, 0x05, 0xff, 0xfe, 0x00,  //@@@@+.....@@@@.....+@@@@.
-    0xef, 0xff, 0x40, 0x00, 0x00, 0xaf, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10,  //@@@@+.....%@@@......@@@@.
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10,  //@@@@.......++.......@@@@.
-    0xef, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00,  //@@@@................@@@@.
-    0xdf, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00,  //@@@@+...............@@@@.
-    0xaf, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xfc, 0x00,  //%@@@%..............%@@@@.
-    0x5f, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf7, 0x00,  //+@@@@..............@@@@+.
-    0x0f, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xf2, 0x00,  //.@@@@%............%@@@@..
-    0x08, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xa0, 0x00,  //.+@@@@+..........+@@@@%..
-    0x00, 0xef, 0xff, 0xf9, 0x10, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x20, 0x00,  //..@@@@@%........%@@@@@...
-    0x00, 0x3f, 0xff, 0xff, 0xe8, 0x42, 0x13, 0x8e, 0xff, 0xff, 0xf5, 0x00, 0x00,  //...@@@@@@%+...%@@@@@@+...
-    0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@+....
-    0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x01, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00,  //......%@@@@@@@@@@%.......
-    0x00, 0x00, 0x00, 0x01, 0x7c, 0xef, 0xfe, 0xc7, 0x20, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xfc, 0x00, 0x01, 0x3d, 0xe5, 0xf6, 0x00, 0x01, 0xdf, 0xff, 0xf6, 0x00, 0x02, 0xff, 0xff, 0x20,
+    0xf7, 0x00, 0x02, 0xff, 0xff, 0x20, 0xfa, 0x00, 0x07, 0x08, 0x93, 0x00, 0xff, 0xff, 0x20, 0x29,
+    0x81, 0xfd, 0x00, 0x09, 0x01, 0xdf, 0xff, 0x10, 0xff, 0xff, 0x20, 0xdf, 0xfe, 0x20, 0xfe, 0x00,
+    0x09, 0x1d, 0xff, 0xff, 0x30, 0xff, 0xff, 0x21, 0xff, 0xff, 0xe2, 0xfe, 0x00, 0x60, 0xbf, 0xff,
+    0xfd, 0x00, 0xff, 0xff, 0x20, 0xbf, 0xff, 0xfd, 0x00, 0x00, 0x05, 0xff, 0xff, 0xd1, 0x00, 0xff,
+    0xff, 0x20, 0x0c, 0xff, 0xff, 0x70, 0x00, 0x0d, 0xff, 0xfe, 0x10, 0x00, 0xff, 0xff, 0x20, 0x00,
+    0xcf, 0xff, 0xf0, 0x00, 0x4f, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x3f, 0xff, 0xf6,
+    0x00, 0x9f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x0a, 0xff, 0xfb, 0x00, 0xcf, 0xff,
+    0x70, 0x00, 0x00, 0xff, 0xff, 0x10, 0x00, 0x05, 0xff, 0xfe, 0x00, 0xef, 0xff, 0x40, 0x00, 0x00,
+    0xaf, 0xfc, 0x00, 0x00, 0x02, 0xff, 0xff, 0x10, 0xff, 0xff, 0x20, 0x00, 0x00, 0x05, 0x60, 0xfe,
+    0x00, 0x05, 0xff, 0xff, 0x10, 0xef, 0xff, 0x30, 0xfb, 0x00, 0x06, 0x01, 0xff, 0xff, 0x00, 0xdf,
+    0xff, 0x50, 0xfb, 0x00, 0x06, 0x03, 0xff, 0xff, 0x00, 0xaf, 0xff, 0xa0, 0xfb, 0x00, 0x06, 0x08,
+    0xff, 0xfc, 0x00, 0x5f, 0xff, 0xf1, 0xfb, 0x00, 0x06, 0x0e, 0xff, 0xf7, 0x00, 0x0f, 0xff, 0xfa,
+    0xfb, 0x00, 0x07, 0x8f, 0xff, 0xf2, 0x00, 0x08, 0xff, 0xff, 0x70, 0xfd, 0x00, 0x09, 0x05, 0xff,
+    0xff, 0xa0, 0x00, 0x00, 0xef, 0xff, 0xf9, 0x10, 0xfe, 0x00, 0x0f, 0x8f, 0xff, 0xff, 0x20, 0x00,
+    0x00, 0x3f, 0xff, 0xff, 0xe8, 0x42, 0x13, 0x8e, 0xff, 0xff, 0xf5, 0xfe, 0x00, 0x00, 0x05, 0xf9,
+    0xff, 0x00, 0x70, 0xfd, 0x00, 0x00, 0x4e, 0xfb, 0xff, 0x00, 0xf5, 0xfc, 0x00, 0x01, 0x01, 0x9f,
+    0xfd, 0xff, 0x01, 0xfa, 0x20, 0xfb, 0x00, 0x05, 0x01, 0x7c, 0xef, 0xfe, 0xc7, 0x20, 0xd6, 0x00,
 
     /*Unicode: U+f013 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x3b, 0x30, 0x04, 0xff, 0xff, 0xf3, 0x00, 0x3b, 0x30, 0x00, 0x00,  //.....%...+@@@@@....%.....
-    0x00, 0x04, 0xff, 0xf6, 0x1a, 0xff, 0xff, 0xf9, 0x16, 0xff, 0xe3, 0x00, 0x00,  //...+@@@+.%@@@@@%.+@@@....
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xc6, 0x46, 0xcf, 0xff, 0xff, 0xf1, 0x00, 0x00,  //....@@@@@@@+++@@@@@@@....
-    0x01, 0x4a, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x09, 0xff, 0xff, 0xf9, 0x30, 0x00,  //...%@@@@@%.....%@@@@@%...
-    0xdf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@.......@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@+.......+@@@@@@@@
-    0xdf, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@.......@@@@@@@@@
-    0x01, 0x3a, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfa, 0x42, 0x00,  //...%@@@@@%.....%@@@@@%+..
-    0x00, 0x01, 0xff, 0xff, 0xff, 0xb5, 0x35, 0xbf, 0xff, 0xff, 0xf2, 0x00, 0x00,  //....@@@@@@%+.+%@@@@@@....
-    0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x04, 0xff, 0xf7, 0x2a, 0xff, 0xff, 0xfa, 0x27, 0xff, 0xf5, 0x00, 0x00,  //...+@@@+.%@@@@@%.+@@@+...
-    0x00, 0x00, 0x3c, 0x40, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x4c, 0x40, 0x00, 0x00,  //.....@....@@@@@+..+@+....
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe2, 0x00, 0x02, 0xdf, 0xff, 0xd0, 0xf8, 0x00, 0x03, 0x01, 0xff, 0xff, 0xf1, 0xfa, 0x00, 0x08,
+    0x3b, 0x30, 0x04, 0xff, 0xff, 0xf3, 0x00, 0x3b, 0x30, 0xfe, 0x00, 0x09, 0x04, 0xff, 0xf6, 0x1a,
+    0xff, 0xff, 0xf9, 0x16, 0xff, 0xe3, 0xfe, 0x00, 0x00, 0x3f, 0xf9, 0xff, 0x04, 0xfe, 0x20, 0x00,
+    0x00, 0xbf, 0xf8, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x2f, 0xf9, 0xff, 0x04, 0xfe, 0x20, 0x00, 0x00,
+    0x05, 0xf9, 0xff, 0x00, 0xf4, 0xfe, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x15, 0xc6, 0x46, 0xcf, 0xff,
+    0xff, 0xf1, 0x00, 0x00, 0x01, 0x4a, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x09, 0xff, 0xff, 0xf9, 0x30,
+    0x00, 0xdf, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xcf, 0xfe, 0xff, 0x00, 0xc0, 0xfd, 0xff,
+    0x00, 0x60, 0xfe, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0x40, 0xfe, 0x00,
+    0x00, 0x4f, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0x60, 0xfe, 0x00, 0x00, 0x6f, 0xfe, 0xff,
+    0x01, 0xf0, 0xdf, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0xcf, 0xfe, 0xff, 0x0f, 0xe0, 0x01,
+    0x3a, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfa, 0x42, 0x00, 0x00, 0x01, 0xfe, 0xff,
+    0x05, 0xb5, 0x35, 0xbf, 0xff, 0xff, 0xf2, 0xfe, 0x00, 0x00, 0x04, 0xf9, 0xff, 0x00, 0xf5, 0xfe,
+    0x00, 0x00, 0x1e, 0xf8, 0xff, 0x03, 0x20, 0x00, 0x00, 0xaf, 0xf8, 0xff, 0x03, 0xb0, 0x00, 0x00,
+    0x3f, 0xf8, 0xff, 0x0c, 0x40, 0x00, 0x00, 0x04, 0xff, 0xf7, 0x2a, 0xff, 0xff, 0xfa, 0x27, 0xff,
+    0xf5, 0xfd, 0x00, 0x08, 0x3c, 0x40, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x4c, 0x40, 0xfb, 0x00, 0x03,
+    0x01, 0xff, 0xff, 0xf2, 0xf7, 0x00, 0x02, 0xef, 0xff, 0xe0, 0xf7, 0x00, 0x01, 0x01, 0x11, 0xe1,
+    0x00,
 
     /*Unicode: U+f014 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00,  //.......%@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,  //......+@@@@@@@@@.......
-    0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0xaf, 0x90, 0x00, 0x00, 0x00,  //......@@+.....%@%......
-    0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00, 0x3f, 0xf1, 0x00, 0x00, 0x00,  //.....+@@.......@@......
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0xef, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xb0, 0x00,  //..@@..............+@%..
-    0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00,  //..@@..............+@%..
-    0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00,  //..@@..............+@%..
-    0x00, 0xef, 0x20, 0x35, 0x00, 0x25, 0x10, 0x15, 0x10, 0x5f, 0xb0, 0x00,  //..@@...+...+...+..+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0xef, 0x20, 0xbf, 0x30, 0x9f, 0x50, 0x6f, 0x70, 0x5f, 0xb0, 0x00,  //..@@..%@..%@+.+@+.+@%..
-    0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00,  //..@@..............+@%..
-    0x00, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00,  //..@@..............+@%..
-    0x00, 0xcf, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00,  //..@@+.............%@%..
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00,  //..+@@@@@@@@@@@@@@@@@...
-    0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xe6, 0x00, 0x00, 0x08, 0xfe, 0xff, 0x00, 0xe5, 0xfa, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0x20,
+    0xfb, 0x00, 0x05, 0xdf, 0x70, 0x00, 0x00, 0xaf, 0x90, 0xfc, 0x00, 0x01, 0x04, 0xfe, 0xfe, 0x00,
+    0x01, 0x3f, 0xf1, 0xfe, 0x00, 0x00, 0xef, 0xf7, 0xff, 0x00, 0xb0, 0xf6, 0xff, 0x03, 0xb0, 0x00,
+    0xef, 0x30, 0xfb, 0x00, 0x05, 0x6f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xfb, 0x00, 0x05, 0x5f, 0xb0,
+    0x00, 0x00, 0xef, 0x20, 0xfb, 0x00, 0x7f, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0x35, 0x00, 0x25,
+    0x10, 0x15, 0x10, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f,
+    0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef,
+    0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf,
+    0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f,
+    0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef,
+    0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf,
+    0x60, 0x7f, 0x80, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xcf, 0x40, 0xaf, 0x60, 0x7f, 0x80, 0x5f,
+    0xb0, 0x00, 0x00, 0xef, 0x20, 0xbf, 0x30, 0x09, 0x9f, 0x50, 0x6f, 0x70, 0x5f, 0xb0, 0x00, 0x00,
+    0xef, 0x20, 0xfb, 0x00, 0x05, 0x5f, 0xb0, 0x00, 0x00, 0xef, 0x20, 0xfb, 0x00, 0x05, 0x5f, 0xb0,
+    0x00, 0x00, 0xcf, 0x50, 0xfb, 0x00, 0x04, 0x8f, 0x90, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0x03, 0x30,
+    0x00, 0x00, 0x0a, 0xfa, 0xff, 0x00, 0xf7, 0xdb, 0x00,
 
     /*Unicode: U+f015 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x70, 0x00, 0x0a, 0xbb, 0xa0, 0x00, 0x00,  //............+%+....%%%%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfb, 0x10, 0x2f, 0xff, 0xf0, 0x00, 0x00,  //...........%@@@%...@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xd2, 0x2f, 0xff, 0xf0, 0x00, 0x00,  //..........@@@@@@@..@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xc3, 0xcf, 0xff, 0x7f, 0xff, 0xf0, 0x00, 0x00,  //.........@@@@.@@@@+@@@@....
-    0x00, 0x00, 0x00, 0x06, 0xff, 0xfa, 0x05, 0x0a, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //.......+@@@%.+.%@@@@@@@....
-    0x00, 0x00, 0x00, 0x8f, 0xff, 0x81, 0xbf, 0xb1, 0x7f, 0xff, 0xff, 0xf0, 0x00, 0x00,  //......%@@@+.%@%.+@@@@@@....
-    0x00, 0x00, 0x0b, 0xff, 0xf5, 0x2d, 0xff, 0xfd, 0x24, 0xff, 0xff, 0xf0, 0x00, 0x00,  //.....%@@@+.@@@@@.+@@@@@....
-    0x00, 0x02, 0xdf, 0xfe, 0x35, 0xff, 0xff, 0xff, 0xf5, 0x2d, 0xff, 0xf3, 0x00, 0x00,  //....@@@@.+@@@@@@@+.@@@@....
-    0x00, 0x3e, 0xff, 0xc1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x81, 0xbf, 0xff, 0x50, 0x00,  //...@@@@.%@@@@@@@@@%.%@@@+..
-    0x06, 0xff, 0xfa, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x19, 0xff, 0xf8, 0x00,  //.+@@@%.%@@@@@@@@@@@%.%@@@%.
-    0x5f, 0xff, 0x82, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x6f, 0xff, 0x80,  //+@@@+.@@@@@@@@@@@@@@@.+@@@%
-    0x2e, 0xf5, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x43, 0xef, 0x40,  //.@@++@@@@@@@@@@@@@@@@@+.@@+
-    0x03, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x14, 0x00,  //....@@@@@@@@@@@@@@@@@@@..+.
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xfd, 0xcc, 0xcd, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0xbf, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00,  //....%@@@@@@.....@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xc3, 0x00, 0x05, 0x7b, 0x70, 0x00, 0x0a, 0xbb, 0xa0, 0xfa, 0x00, 0x06, 0x0b, 0xff, 0xfb, 0x10,
+    0x2f, 0xff, 0xf0, 0xfb, 0x00, 0x07, 0x01, 0xdf, 0xff, 0xff, 0xd2, 0x2f, 0xff, 0xf0, 0xfb, 0x00,
+    0x07, 0x3e, 0xff, 0xc3, 0xcf, 0xff, 0x7f, 0xff, 0xf0, 0xfc, 0x00, 0x04, 0x06, 0xff, 0xfa, 0x05,
+    0x0a, 0xfe, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x08, 0x8f, 0xff, 0x81, 0xbf, 0xb1, 0x7f, 0xff, 0xff,
+    0xf0, 0xfd, 0x00, 0x09, 0x0b, 0xff, 0xf5, 0x2d, 0xff, 0xfd, 0x24, 0xff, 0xff, 0xf0, 0xfe, 0x00,
+    0x03, 0x02, 0xdf, 0xfe, 0x35, 0xfe, 0xff, 0x03, 0xf5, 0x2d, 0xff, 0xf3, 0xfe, 0x00, 0x03, 0x3e,
+    0xff, 0xc1, 0x8f, 0xfd, 0xff, 0x08, 0x81, 0xbf, 0xff, 0x50, 0x00, 0x06, 0xff, 0xfa, 0x1b, 0xfc,
+    0xff, 0x08, 0xfb, 0x19, 0xff, 0xf8, 0x00, 0x5f, 0xff, 0x82, 0xdf, 0xfb, 0xff, 0x06, 0xd2, 0x6f,
+    0xff, 0x80, 0x2e, 0xf5, 0x4f, 0xf9, 0xff, 0x04, 0x43, 0xef, 0x40, 0x03, 0x20, 0xf8, 0xff, 0x01,
+    0xf0, 0x14, 0xfe, 0x00, 0xf8, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xfd, 0xcc, 0xcd,
+    0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xf3, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf0,
+    0xfd, 0x00, 0xfe, 0xff, 0x02, 0xf3, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff,
+    0x02, 0xf3, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xf3, 0x00, 0x03,
+    0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xf3, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xf0,
+    0xfd, 0x00, 0x05, 0xbf, 0xff, 0xff, 0xf3, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xb0, 0xb9, 0x00,
 
     /*Unicode: U+f019 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xbb, 0xbb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%%%%%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x02, 0x66, 0x66, 0xcf, 0xff, 0xff, 0xc6, 0x66, 0x61, 0x00, 0x00, 0x00,  //......++++@@@@@@%++++......
-    0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@@@...........
-    0x01, 0x22, 0x22, 0x22, 0x20, 0x05, 0xff, 0xf3, 0x00, 0x22, 0x22, 0x22, 0x21, 0x00,  //...........+@@@............
-    0xaf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x4c, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xa0,  //%@@@@@@@@%..+@...%@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@%.....@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x53, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@+.+@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x5f, 0xf3, 0x4f, 0xf0,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x6f, 0xf4, 0x5f, 0xf0,  //@@@@@@@@@@@@@@@@@@@.+@@++@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xfc, 0x00, 0x03, 0x3b, 0xbb, 0xbb, 0x20, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00,
+    0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf,
+    0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff,
+    0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xfa, 0x00, 0x08, 0x02, 0x66, 0x66, 0xcf, 0xff,
+    0xff, 0xc6, 0x66, 0x61, 0xfc, 0x00, 0x00, 0x0b, 0xfa, 0xff, 0x00, 0xfa, 0xfc, 0x00, 0x00, 0x05,
+    0xfa, 0xff, 0x00, 0xf3, 0xfb, 0x00, 0x00, 0x5f, 0xfb, 0xff, 0x00, 0x40, 0xfb, 0x00, 0x00, 0x05,
+    0xfc, 0xff, 0x00, 0xf4, 0xf9, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0x40, 0xf9, 0x00, 0x00, 0x05,
+    0xfe, 0xff, 0x00, 0xf4, 0xf7, 0x00, 0x03, 0x5f, 0xff, 0xff, 0x30, 0xfc, 0x00, 0x00, 0x01, 0xfe,
+    0x22, 0x04, 0x20, 0x05, 0xff, 0xf3, 0x00, 0xfe, 0x22, 0x02, 0x21, 0x00, 0xaf, 0xfe, 0xff, 0x04,
+    0xfb, 0x00, 0x4c, 0x30, 0x0c, 0xfd, 0xff, 0x00, 0xa0, 0xfc, 0xff, 0x03, 0xb0, 0x00, 0x00, 0xcf,
+    0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xfd, 0x53, 0x6d, 0xfc, 0xff, 0x00, 0xf0, 0xf4, 0xff,
+    0x00, 0xf0, 0xf8, 0xff, 0x04, 0xd1, 0x5f, 0xf3, 0x4f, 0xf0, 0xf8, 0xff, 0x04, 0xd2, 0x6f, 0xf4,
+    0x5f, 0xf0, 0xf4, 0xff, 0x01, 0xf0, 0x8f, 0xf5, 0xff, 0x00, 0x80, 0xbb, 0x00,
 
     /*Unicode: U+f01c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@....
-    0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@....
-    0x00, 0x0d, 0xff, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0xbf, 0xfa, 0x00, 0x00,  //...@@@%...........%@@%...
-    0x00, 0x3f, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x10, 0x00,  //...@@@............+@@@...
-    0x00, 0xaf, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x80, 0x00,  //..%@@%.............@@@%..
-    0x01, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00,  //..@@@+.............+@@@..
-    0x08, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00,  //.%@@@...............@@@+.
-    0x0e, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xfc, 0x00,  //.@@@+...............%@@@.
-    0x5f, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x30,  //+@@@.................@@@.
-    0xbf, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x90,  //%@@%.................@@@%
-    0xff, 0xf8, 0x55, 0x55, 0x10, 0x00, 0x00, 0x00, 0x25, 0x55, 0x59, 0xff, 0xc0,  //@@@%++++.........++++%@@@
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@%.......@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@......+@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x33, 0x33, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@%.....@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xcb, 0x00, 0x00, 0x5f, 0xfb, 0xff, 0x01, 0xfe, 0x40, 0xfd, 0x00, 0x00, 0xef, 0xfa, 0xff, 0x00,
+    0xd0, 0xfe, 0x00, 0x00, 0x06, 0xf9, 0xff, 0x00, 0xf3, 0xfe, 0x00, 0x02, 0x0d, 0xff, 0x91, 0xfc,
+    0x11, 0x01, 0xbf, 0xfa, 0xfe, 0x00, 0x02, 0x3f, 0xff, 0x20, 0xfc, 0x00, 0x06, 0x4f, 0xff, 0x10,
+    0x00, 0x00, 0xaf, 0xfb, 0xfb, 0x00, 0x06, 0x0d, 0xff, 0x80, 0x00, 0x01, 0xff, 0xf4, 0xfb, 0x00,
+    0x06, 0x07, 0xff, 0xe0, 0x00, 0x08, 0xff, 0xd0, 0xfa, 0x00, 0x05, 0xff, 0xf5, 0x00, 0x0e, 0xff,
+    0x70, 0xfa, 0x00, 0x05, 0x9f, 0xfc, 0x00, 0x5f, 0xff, 0x10, 0xfa, 0x00, 0x04, 0x3f, 0xff, 0x30,
+    0xbf, 0xfa, 0xf9, 0x00, 0x07, 0x0c, 0xff, 0x90, 0xff, 0xf8, 0x55, 0x55, 0x10, 0xfe, 0x00, 0x04,
+    0x25, 0x55, 0x59, 0xff, 0xc0, 0xfd, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x00, 0xdf, 0xfe, 0xff, 0x00,
+    0xd0, 0xfd, 0xff, 0x03, 0xf3, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x00, 0xd0, 0xfd, 0xff, 0x03, 0xfb,
+    0x33, 0x33, 0x3d, 0xfd, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5,
+    0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x01, 0xd0, 0xbf, 0xf6, 0xff, 0x00, 0x90,
+    0xc0, 0x00,
 
     /*Unicode: U+f021 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x6a, 0xdf, 0xfe, 0xd9, 0x40, 0x00, 0x00, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x1d, 0xb0,  //......%@@@@@@@@@@@+....@%
-    0x00, 0x00, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x21, 0xdf, 0xf0,  //.....@@@@@@@@@@@@@@@..@@@
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf0,  //....@@@@@@@@@@@@@@@@@@@@@
-    0x00, 0x2f, 0xff, 0xff, 0xfa, 0x52, 0x13, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xf0,  //...@@@@@@%+...+%@@@@@@@@@
-    0x00, 0xdf, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xf0,  //..@@@@@@.........%@@@@@@@
-    0x07, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@%...........@@@@@@@
-    0x0e, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@...........@@@@@@@@
-    0x5f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xf0,  //+@@@@...........@@@@@@@@@
-    0x9f, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe0,  //%@@@%...........@@@@@@@@@
-    0x25, 0x55, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x55, 0x55, 0x20,  //.+++.............+++++++.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x36, 0x66, 0x66, 0x66, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x66, 0x20,  //.++++++++............+++.
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x70,  //@@@@@@@@@+..........@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x20,  //@@@@@@@@@...........@@@@.
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xfc, 0x00,  //@@@@@@@@...........@@@@@.
-    0xff, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf5, 0x00,  //@@@@@@@...........%@@@@+.
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xb0, 0x00,  //@@@@@@@@.........@@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x52, 0x12, 0x5a, 0xff, 0xff, 0xfe, 0x10, 0x00,  //@@@@@@@@@%+...+%@@@@@@...
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@@@....
-    0xff, 0xd1, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00,  //@@@..@@@@@@@@@@@@@@@.....
-    0xcd, 0x10, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x00, 0x00,  //@@....%@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x01, 0x6a, 0xef, 0xff, 0xea, 0x60, 0x00, 0x00, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe3, 0x00, 0x04, 0x6a, 0xdf, 0xfe, 0xd9, 0x40, 0xfa, 0x00, 0x00, 0x8e, 0xfd, 0xff, 0x07, 0xfe,
+    0x60, 0x00, 0x1d, 0xb0, 0x00, 0x00, 0x3d, 0xfb, 0xff, 0x05, 0xfd, 0x21, 0xdf, 0xf0, 0x00, 0x03,
+    0xf9, 0xff, 0x0a, 0xfe, 0xff, 0xf0, 0x00, 0x2f, 0xff, 0xff, 0xfa, 0x52, 0x13, 0x5a, 0xfd, 0xff,
+    0x05, 0xf0, 0x00, 0xdf, 0xff, 0xfc, 0x20, 0xfe, 0x00, 0x00, 0x2c, 0xfe, 0xff, 0x04, 0xf0, 0x07,
+    0xff, 0xff, 0xa0, 0xfd, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x03, 0xf0, 0x0e, 0xff, 0xfd, 0xfc, 0x00,
+    0x00, 0x1d, 0xfe, 0xff, 0x03, 0xf0, 0x5f, 0xff, 0xf3, 0xfd, 0x00, 0x01, 0x01, 0xdf, 0xfe, 0xff,
+    0x03, 0xf0, 0x9f, 0xff, 0xb0, 0xfd, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x03, 0xe0, 0x25, 0x55, 0x10,
+    0xfc, 0x00, 0x00, 0x35, 0xfe, 0x55, 0x00, 0x20, 0xda, 0x00, 0x00, 0x36, 0xfe, 0x66, 0x00, 0x50,
+    0xfc, 0x00, 0x02, 0x26, 0x66, 0x20, 0xfd, 0xff, 0x00, 0xf4, 0xfc, 0x00, 0x02, 0xcf, 0xff, 0x70,
+    0xfd, 0xff, 0x00, 0xd0, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0x20, 0xfe, 0xff, 0x01, 0xfd, 0x10,
+    0xfd, 0x00, 0x03, 0x0d, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x00, 0xf1, 0xfc, 0x00, 0x03, 0xbf, 0xff,
+    0xf5, 0x00, 0xfe, 0xff, 0x01, 0xfc, 0x20, 0xfe, 0x00, 0x04, 0x2d, 0xff, 0xff, 0xb0, 0x00, 0xfd,
+    0xff, 0x0a, 0xfa, 0x52, 0x12, 0x5a, 0xff, 0xff, 0xfe, 0x10, 0x00, 0xff, 0xfe, 0xf9, 0xff, 0x05,
+    0xe2, 0x00, 0x00, 0xff, 0xd1, 0x2d, 0xfb, 0xff, 0x07, 0xfc, 0x20, 0x00, 0x00, 0xcd, 0x10, 0x00,
+    0x8f, 0xfd, 0xff, 0x01, 0xfe, 0x70, 0xfb, 0x00, 0x05, 0x01, 0x6a, 0xef, 0xff, 0xea, 0x60, 0xd6,
+    0x00,
 
     /*Unicode: U+f026 () , Width: 13 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x30,  //..........+@.
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60,  //.........%@@+
-    0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x60,  //........%@@@+
-    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x60,  //.......%@@@@+
-    0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x60,  //......%@@@@@+
-    0x14, 0x44, 0x48, 0xff, 0xff, 0xff, 0x60,  //.++++%@@@@@@+
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@+
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //%@@@@@@@@@@@+
-    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x60,  //......@@@@@@+
-    0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x60,  //.......@@@@@+
-    0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x60,  //........@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x60,  //.........@@@+
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x60,  //..........@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x10,  //...........%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+    0xd9, 0x00, 0x01, 0x7e, 0x30, 0xfd, 0x00, 0x02, 0x08, 0xff, 0x60, 0xfd, 0x00, 0x02, 0x8f, 0xff,
+    0x60, 0xfe, 0x00, 0x03, 0x08, 0xff, 0xff, 0x60, 0xfe, 0x00, 0x06, 0x8f, 0xff, 0xff, 0x60, 0x14,
+    0x44, 0x48, 0xfe, 0xff, 0x01, 0x60, 0xef, 0xfc, 0xff, 0x00, 0x60, 0xfb, 0xff, 0x00, 0x60, 0xfb,
+    0xff, 0x00, 0x60, 0xfb, 0xff, 0x00, 0x60, 0xfb, 0xff, 0x00, 0x60, 0xfb, 0xff, 0x00, 0x60, 0xfb,
+    0xff, 0x01, 0x60, 0xbf, 0xfc, 0xff, 0x03, 0x60, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x00, 0x60, 0xfe,
+    0x00, 0x03, 0x4f, 0xff, 0xff, 0x60, 0xfe, 0x00, 0x03, 0x04, 0xff, 0xff, 0x60, 0xfd, 0x00, 0x02,
+    0x3f, 0xff, 0x60, 0xfd, 0x00, 0x02, 0x03, 0xff, 0x60, 0xfc, 0x00, 0x01, 0x39, 0x10, 0xde, 0x00,
 
     /*Unicode: U+f027 () , Width: 19 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x30, 0x00, 0x00, 0x00,  //..........+@.......
-    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x00, 0x00, 0x00,  //.........%@@+......
-    0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x60, 0x00, 0x00, 0x00,  //........%@@@+......
-    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //.......%@@@@+......
-    0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //......%@@@@@+......
-    0x14, 0x44, 0x48, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //.++++%@@@@@@+......
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xe4, 0x00,  //@@@@@@@@@@@@+..@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0d, 0xff, 0x30,  //@@@@@@@@@@@@+..@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0xaf, 0xb0,  //@@@@@@@@@@@@+...%@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x2f, 0xf0,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x3f, 0xe0,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x03, 0xdf, 0x90,  //@@@@@@@@@@@@+...@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0f, 0xfd, 0x10,  //@@@@@@@@@@@@+..@@@.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x08, 0x91, 0x00,  //%@@@@@@@@@@@+..%%..
-    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //......@@@@@@+......
-    0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //.......@@@@@+......
-    0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //........@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x60, 0x00, 0x00, 0x00,  //.........@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x60, 0x00, 0x00, 0x00,  //..........@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x10, 0x00, 0x00, 0x00,  //...........%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-
+    0xca, 0x00, 0x01, 0x7e, 0x30, 0xfa, 0x00, 0x02, 0x08, 0xff, 0x60, 0xfa, 0x00, 0x02, 0x8f, 0xff,
+    0x60, 0xfb, 0x00, 0x03, 0x08, 0xff, 0xff, 0x60, 0xfb, 0x00, 0x03, 0x8f, 0xff, 0xff, 0x60, 0xfe,
+    0x00, 0x02, 0x14, 0x44, 0x48, 0xfe, 0xff, 0x00, 0x60, 0xfe, 0x00, 0x00, 0xef, 0xfc, 0xff, 0x03,
+    0x60, 0x0d, 0xe4, 0x00, 0xfb, 0xff, 0x03, 0x60, 0x0d, 0xff, 0x30, 0xfb, 0xff, 0x03, 0x60, 0x00,
+    0xaf, 0xb0, 0xfb, 0xff, 0x03, 0x60, 0x00, 0x2f, 0xf0, 0xfb, 0xff, 0x03, 0x60, 0x00, 0x3f, 0xe0,
+    0xfb, 0xff, 0x03, 0x60, 0x03, 0xdf, 0x90, 0xfb, 0xff, 0x04, 0x60, 0x0f, 0xfd, 0x10, 0xbf, 0xfc,
+    0xff, 0x02, 0x60, 0x08, 0x91, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x00, 0x60, 0xfb, 0x00, 0x03,
+    0x4f, 0xff, 0xff, 0x60, 0xfb, 0x00, 0x03, 0x04, 0xff, 0xff, 0x60, 0xfa, 0x00, 0x02, 0x3f, 0xff,
+    0x60, 0xfa, 0x00, 0x02, 0x03, 0xff, 0x60, 0xf9, 0x00, 0x01, 0x39, 0x10, 0xcc, 0x00,
 
     /*Unicode: U+f028 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x70, 0x00, 0x00, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7f, 0xfd, 0x30, 0x00, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x50, 0x00, 0x00, 0x04, 0xdf, 0xf4, 0x00, 0x00,  //..........@@+......+@@@....
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x60, 0x00, 0x02, 0x00, 0x0b, 0xff, 0x20, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x60, 0x00, 0x3f, 0xd4, 0x00, 0xbf, 0xd0, 0x00,  //........@@@@+....@@+..%@@..
-    0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0x60, 0x00, 0x1e, 0xff, 0x70, 0x1e, 0xf7, 0x00,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x00, 0x01, 0xcf, 0xff, 0xff, 0x60, 0x00, 0x00, 0x9f, 0xf4, 0x05, 0xfe, 0x00,  //......@@@@@@+.....%@@+.+@@.
-    0x6a, 0xaa, 0xad, 0xff, 0xff, 0xff, 0x60, 0x04, 0x20, 0x08, 0xfe, 0x00, 0xdf, 0x50,  //+%%%%@@@@@@@+......%@@..@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xf8, 0x00, 0xdf, 0x60, 0x8f, 0x90,  //@@@@@@@@@@@@+..@@%..@@+.%@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x09, 0xff, 0x60, 0x6f, 0xb0, 0x4f, 0xd0,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xd0, 0x2f, 0xe0, 0x1f, 0xe0,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0,  //@@@@@@@@@@@@+....@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xd0, 0x2f, 0xe0, 0x1f, 0xe0,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x09, 0xff, 0x60, 0x6f, 0xb0, 0x4f, 0xd0,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xf9, 0x00, 0xdf, 0x60, 0x8f, 0x90,  //@@@@@@@@@@@@+..@@%..@@+.+@%
-    0x6a, 0xaa, 0xad, 0xff, 0xff, 0xff, 0x60, 0x04, 0x30, 0x08, 0xfe, 0x00, 0xdf, 0x50,  //+%%%%@@@@@@@+..+...%@@..@@+
-    0x00, 0x00, 0x01, 0xcf, 0xff, 0xff, 0x60, 0x00, 0x00, 0x8f, 0xf5, 0x05, 0xfe, 0x00,  //......@@@@@@+.....%@@+.+@@.
-    0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0x60, 0x00, 0x1d, 0xff, 0x70, 0x0e, 0xf7, 0x00,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x00, 0x00, 0x01, 0xcf, 0xff, 0x60, 0x00, 0x3f, 0xe5, 0x00, 0xbf, 0xd0, 0x00,  //........@@@@+....@@+..%@@..
-    0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x60, 0x00, 0x02, 0x00, 0x0b, 0xff, 0x20, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0x50, 0x00, 0x00, 0x04, 0xdf, 0xf4, 0x00, 0x00,  //..........@@+......+@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x7f, 0xfd, 0x30, 0x00, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x80, 0x00, 0x00, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xce, 0x00, 0x01, 0x7e, 0x70, 0xf9, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x02, 0x7f, 0xfd, 0x30, 0xfa,
+    0x00, 0x06, 0xcf, 0x50, 0x00, 0x00, 0x04, 0xdf, 0xf4, 0xfb, 0x00, 0x08, 0x0c, 0xff, 0x60, 0x00,
+    0x02, 0x00, 0x0b, 0xff, 0x20, 0xfc, 0x00, 0x08, 0xcf, 0xff, 0x60, 0x00, 0x3f, 0xd4, 0x00, 0xbf,
+    0xd0, 0xfd, 0x00, 0x09, 0x1c, 0xff, 0xff, 0x60, 0x00, 0x1e, 0xff, 0x70, 0x1e, 0xf7, 0xfe, 0x00,
+    0x0e, 0x01, 0xcf, 0xff, 0xff, 0x60, 0x00, 0x00, 0x9f, 0xf4, 0x05, 0xfe, 0x00, 0x6a, 0xaa, 0xad,
+    0xfe, 0xff, 0x07, 0x60, 0x04, 0x20, 0x08, 0xfe, 0x00, 0xdf, 0x50, 0xfb, 0xff, 0x07, 0x60, 0x2f,
+    0xf8, 0x00, 0xdf, 0x60, 0x8f, 0x90, 0xfb, 0xff, 0x07, 0x60, 0x09, 0xff, 0x60, 0x6f, 0xb0, 0x4f,
+    0xd0, 0xfb, 0xff, 0x07, 0x60, 0x00, 0x6f, 0xd0, 0x2f, 0xe0, 0x1f, 0xe0, 0xfb, 0xff, 0x07, 0x60,
+    0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0xfb, 0xff, 0x07, 0x60, 0x00, 0x6f, 0xd0, 0x2f, 0xe0,
+    0x1f, 0xe0, 0xfb, 0xff, 0x07, 0x60, 0x09, 0xff, 0x60, 0x6f, 0xb0, 0x4f, 0xd0, 0xfb, 0xff, 0x0a,
+    0x60, 0x2f, 0xf9, 0x00, 0xdf, 0x60, 0x8f, 0x90, 0x6a, 0xaa, 0xad, 0xfe, 0xff, 0x14, 0x60, 0x04,
+    0x30, 0x08, 0xfe, 0x00, 0xdf, 0x50, 0x00, 0x00, 0x01, 0xcf, 0xff, 0xff, 0x60, 0x00, 0x00, 0x8f,
+    0xf5, 0x05, 0xfe, 0xfd, 0x00, 0x09, 0x1c, 0xff, 0xff, 0x60, 0x00, 0x1d, 0xff, 0x70, 0x0e, 0xf7,
+    0xfd, 0x00, 0x09, 0x01, 0xcf, 0xff, 0x60, 0x00, 0x3f, 0xe5, 0x00, 0xbf, 0xd0, 0xfc, 0x00, 0x08,
+    0x1c, 0xff, 0x60, 0x00, 0x02, 0x00, 0x0b, 0xff, 0x20, 0xfc, 0x00, 0x07, 0x01, 0xcf, 0x50, 0x00,
+    0x00, 0x04, 0xdf, 0xf4, 0xfa, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x02, 0x7f, 0xfd, 0x30, 0xf6, 0x00,
+    0x01, 0x7e, 0x80, 0xc6, 0x00,
 
     /*Unicode: U+f03e () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf0,  //@@...........................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0x07, 0xee, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...+@@%....................@@.
-    0xff, 0x10, 0x7f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@..+@@@@%...................@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@..@@@@@@...................@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@..@@@@@@.........%@........@@.
-    0xff, 0x10, 0x9f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfe, 0x20, 0x00, 0x00, 0x0f, 0xf1,  //@@..%@@@@@........%@@@.......@@.
-    0xff, 0x10, 0x0b, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x0f, 0xf1,  //@@...%@@@........%@@@@@......@@.
-    0xff, 0x10, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x0f, 0xf1,  //@@..............@@@@@@@@.....@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x0f, 0xf1,  //@@.............@@@@@@@@@@....@@.
-    0xff, 0x10, 0x00, 0x00, 0x25, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0f, 0xf1,  //@@.......+....@@@@@@@@@@@@...@@.
-    0xff, 0x10, 0x00, 0x02, 0xef, 0x60, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0f, 0xf1,  //@@......@@+..@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0x00, 0x2e, 0xff, 0xf7, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@.....@@@@+@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@....@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@...@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xf1,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0x10, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x80, 0x0f, 0xf1,  //@@..%%%%%%%%%%%%%%%%%%%%%%+..@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@...........................@@.
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xe1, 0x00, 0x00, 0x1b, 0xf4, 0xff, 0x02, 0xfb, 0x10, 0xbf, 0xf3, 0xff, 0x02, 0xc0, 0xff, 0x30,
+    0xf5, 0x00, 0x03, 0x2f, 0xf0, 0xff, 0x10, 0xf5, 0x00, 0x06, 0x0f, 0xf1, 0xff, 0x10, 0x07, 0xee,
+    0x90, 0xf8, 0x00, 0x06, 0x0f, 0xf1, 0xff, 0x10, 0x7f, 0xff, 0xfb, 0xf8, 0x00, 0x07, 0x0f, 0xf1,
+    0xff, 0x10, 0xef, 0xff, 0xff, 0x10, 0xfd, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x07, 0x0f, 0xf1, 0xff,
+    0x10, 0xef, 0xff, 0xff, 0x20, 0xfe, 0x00, 0x01, 0x0b, 0xe2, 0xfe, 0x00, 0x06, 0x0f, 0xf1, 0xff,
+    0x10, 0x9f, 0xff, 0xfd, 0xfd, 0x00, 0x0b, 0xbf, 0xfe, 0x20, 0x00, 0x00, 0x0f, 0xf1, 0xff, 0x10,
+    0x0b, 0xff, 0xd2, 0xfe, 0x00, 0x0b, 0x0c, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x0f, 0xf1, 0xff, 0x10,
+    0x00, 0x12, 0xfd, 0x00, 0x09, 0xcf, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0xfc,
+    0x00, 0x00, 0x0c, 0xfd, 0xff, 0x0b, 0xe2, 0x00, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0x00, 0x25, 0x00,
+    0x00, 0xcf, 0xfd, 0xff, 0x0a, 0xfe, 0x20, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0x02, 0xef, 0x60, 0x0c,
+    0xfb, 0xff, 0x09, 0xd0, 0x0f, 0xf1, 0xff, 0x10, 0x00, 0x2e, 0xff, 0xf7, 0xcf, 0xfb, 0xff, 0x06,
+    0xe0, 0x0f, 0xf1, 0xff, 0x10, 0x02, 0xef, 0xf8, 0xff, 0x05, 0xe0, 0x0f, 0xf1, 0xff, 0x10, 0x2e,
+    0xf7, 0xff, 0x05, 0xe0, 0x0f, 0xf1, 0xff, 0x10, 0xef, 0xf7, 0xff, 0x04, 0xe0, 0x0f, 0xf1, 0xff,
+    0x10, 0xf6, 0xff, 0x04, 0xe0, 0x0f, 0xf1, 0xff, 0x10, 0xf6, 0xff, 0x04, 0xe0, 0x0f, 0xf1, 0xff,
+    0x10, 0xf6, 0x88, 0x04, 0x80, 0x0f, 0xf1, 0xff, 0x10, 0xf5, 0x00, 0x03, 0x0f, 0xf1, 0xff, 0x20,
+    0xf5, 0x00, 0x02, 0x1f, 0xf0, 0xbf, 0xf3, 0xff, 0x01, 0xc0, 0x1c, 0xf4, 0xff, 0x01, 0xfc, 0x20,
+    0xd1, 0x00,
 
     /*Unicode: U+f040 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x63, 0x00, 0x00, 0x00,  //..................+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0x70, 0x00, 0x00,  //.................@@@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf7, 0x00, 0x00,  //................@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x70, 0x00,  //...............@@@@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xf7, 0x00,  //...............@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x20, 0xcf, 0xff, 0xff, 0xff, 0x40,  //.............@..@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe2, 0x0c, 0xff, 0xff, 0xff, 0x70,  //............@@@..@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfd, 0xee, 0x20, 0xcf, 0xff, 0xff, 0x20,  //...........@@@@@..@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xd3, 0xef, 0xe2, 0x0c, 0xff, 0xf4, 0x00,  //..........@@@.@@@..@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xfd, 0x3e, 0xff, 0xfe, 0x20, 0xcf, 0x40, 0x00,  //.........@@@.@@@@@..@@+..
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xd3, 0xef, 0xff, 0xff, 0xe2, 0x03, 0x00, 0x00,  //........@@@.@@@@@@@......
-    0x00, 0x00, 0x00, 0x3f, 0xfd, 0x3e, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,  //.......@@@.@@@@@@@@@.....
-    0x00, 0x00, 0x03, 0xff, 0xd3, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00,  //......@@@.@@@@@@@@@+.....
-    0x00, 0x00, 0x3f, 0xfd, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //.....@@@.@@@@@@@@@+......
-    0x00, 0x03, 0xff, 0xd3, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@@@@@@@+.......
-    0x00, 0x3f, 0xfd, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //...@@@.@@@@@@@@@+........
-    0x03, 0xff, 0xe3, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@.@@@@@@@@@+.........
-    0x3f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@@@@+..........
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%.%@@@@@@@@+...........
-    0xff, 0x10, 0x0a, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@...%@@@@@@+............
-    0xff, 0x21, 0x00, 0xaf, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@....%@@@@+.............
-    0xff, 0xff, 0x20, 0x0d, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@...@@@+..............
-    0xff, 0xff, 0x20, 0xaf, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@..%@@+...............
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@+................
-    0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xdf, 0x00, 0x01, 0x01, 0x63, 0xf6, 0x00, 0x02, 0x3e, 0xff, 0x70, 0xf8, 0x00, 0x03, 0x03, 0xff,
+    0xff, 0xf7, 0xf8, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0x70, 0xf9, 0x00, 0x00, 0x0c, 0xfe, 0xff,
+    0x00, 0xf7, 0xfa, 0x00, 0x02, 0x3d, 0x20, 0xcf, 0xfe, 0xff, 0x00, 0x40, 0xfc, 0x00, 0x03, 0x03,
+    0xff, 0xe2, 0x0c, 0xfe, 0xff, 0x00, 0x70, 0xfc, 0x00, 0x07, 0x3f, 0xfd, 0xee, 0x20, 0xcf, 0xff,
+    0xff, 0x20, 0xfd, 0x00, 0x07, 0x03, 0xff, 0xd3, 0xef, 0xe2, 0x0c, 0xff, 0xf4, 0xfc, 0x00, 0x07,
+    0x3f, 0xfd, 0x3e, 0xff, 0xfe, 0x20, 0xcf, 0x40, 0xfd, 0x00, 0x07, 0x03, 0xff, 0xd3, 0xef, 0xff,
+    0xff, 0xe2, 0x03, 0xfc, 0x00, 0x02, 0x3f, 0xfd, 0x3e, 0xfe, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x03,
+    0x03, 0xff, 0xd3, 0xef, 0xfe, 0xff, 0x00, 0xf5, 0xfc, 0x00, 0x02, 0x3f, 0xfd, 0x3e, 0xfd, 0xff,
+    0x00, 0x50, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xd3, 0xef, 0xfe, 0xff, 0x00, 0xf5, 0xfc, 0x00, 0x02,
+    0x3f, 0xfd, 0x3e, 0xfd, 0xff, 0x00, 0x50, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xe3, 0xef, 0xfe, 0xff,
+    0x00, 0xf5, 0xfc, 0x00, 0x01, 0x3f, 0xfe, 0xfc, 0xff, 0x00, 0x50, 0xfc, 0x00, 0x02, 0xff, 0xb0,
+    0xaf, 0xfe, 0xff, 0x00, 0xf5, 0xfb, 0x00, 0x02, 0xff, 0x10, 0x0a, 0xfe, 0xff, 0x00, 0x50, 0xfb,
+    0x00, 0x05, 0xff, 0x21, 0x00, 0xaf, 0xff, 0xf5, 0xfa, 0x00, 0x05, 0xff, 0xff, 0x20, 0x0d, 0xff,
+    0x50, 0xfa, 0x00, 0x04, 0xff, 0xff, 0x20, 0xaf, 0xf5, 0xf9, 0x00, 0xfd, 0xff, 0x00, 0x50, 0xf9,
+    0x00, 0xfe, 0xff, 0x00, 0xf5, 0xd1, 0x00,
 
     /*Unicode: U+f048 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x9d, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70,  //%@@%...........++
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x90,  //@@@@..........+@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x05, 0xff, 0x90,  //@@@@.........+@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x90,  //@@@@........+@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x04, 0xff, 0xff, 0x90,  //@@@@.......+@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x90,  //@@@@......+@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x04, 0xff, 0xff, 0xff, 0x90,  //@@@@.....+@@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x90,  //@@@@....+@@@@@@@%
-    0xff, 0xff, 0x20, 0x04, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@...+@@@@@@@@%
-    0xff, 0xff, 0x20, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@..+@@@@@@@@@%
-    0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@.+@@@@@@@@@@%
-    0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@+@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@%@@@@@@@@@@@%
-    0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@.+@@@@@@@@@@%
-    0xff, 0xff, 0x20, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@..+@@@@@@@@@%
-    0xff, 0xff, 0x20, 0x06, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@...+@@@@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x6f, 0xff, 0xff, 0xff, 0x90,  //@@@@....+@@@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x06, 0xff, 0xff, 0xff, 0x90,  //@@@@.....+@@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0xff, 0x90,  //@@@@......+@@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x06, 0xff, 0xff, 0x90,  //@@@@.......+@@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x90,  //@@@@........+@@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x06, 0xff, 0x90,  //@@@@.........+@@%
-    0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90,  //@@@@..........+@%
-    0xbf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80,  //%@@@...........+%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xef, 0x00, 0x01, 0x9d, 0xdb, 0xfc, 0x00, 0x04, 0x04, 0x70, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x04,
+    0x5f, 0x90, 0xff, 0xff, 0x20, 0xfe, 0x00, 0x05, 0x05, 0xff, 0x90, 0xff, 0xff, 0x20, 0xfe, 0x00,
+    0x19, 0x4f, 0xff, 0x90, 0xff, 0xff, 0x20, 0x00, 0x00, 0x04, 0xff, 0xff, 0x90, 0xff, 0xff, 0x20,
+    0x00, 0x00, 0x4f, 0xff, 0xff, 0x90, 0xff, 0xff, 0x20, 0x00, 0x04, 0xfe, 0xff, 0x05, 0x90, 0xff,
+    0xff, 0x20, 0x00, 0x4f, 0xfe, 0xff, 0x04, 0x90, 0xff, 0xff, 0x20, 0x04, 0xfd, 0xff, 0x04, 0x90,
+    0xff, 0xff, 0x20, 0x4f, 0xfd, 0xff, 0x03, 0x90, 0xff, 0xff, 0x24, 0xfc, 0xff, 0x03, 0x90, 0xff,
+    0xff, 0x7f, 0xfc, 0xff, 0x00, 0x90, 0xf9, 0xff, 0x03, 0x90, 0xff, 0xff, 0x9f, 0xfc, 0xff, 0x03,
+    0x90, 0xff, 0xff, 0x26, 0xfc, 0xff, 0x04, 0x90, 0xff, 0xff, 0x20, 0x6f, 0xfd, 0xff, 0x04, 0x90,
+    0xff, 0xff, 0x20, 0x06, 0xfd, 0xff, 0x05, 0x90, 0xff, 0xff, 0x20, 0x00, 0x6f, 0xfe, 0xff, 0x05,
+    0x90, 0xff, 0xff, 0x20, 0x00, 0x06, 0xfe, 0xff, 0x15, 0x90, 0xff, 0xff, 0x20, 0x00, 0x00, 0x6f,
+    0xff, 0xff, 0x90, 0xff, 0xff, 0x20, 0x00, 0x00, 0x06, 0xff, 0xff, 0x90, 0xff, 0xff, 0x20, 0xfe,
+    0x00, 0x05, 0x6f, 0xff, 0x90, 0xff, 0xff, 0x20, 0xfe, 0x00, 0x05, 0x06, 0xff, 0x90, 0xff, 0xff,
+    0x20, 0xfd, 0x00, 0x03, 0x6f, 0x90, 0xbf, 0xfd, 0xfc, 0x00, 0x01, 0x06, 0x80, 0xe6, 0x00,
 
     /*Unicode: U+f04b () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.....................
-    0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+...................
-    0xff, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@..................
-    0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@%................
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@%..............
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@+............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@.........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@%.......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@%.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x00,  //@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,  //@@@@@@@@@@@@@@@@@@@@@%.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x00,  //@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@%........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@%............
-    0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@+.............
-    0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+...............
-    0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@%.................
-    0xff, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%...................
-    0xfc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....................
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xe9, 0x00, 0x00, 0xc7, 0xf6, 0x00, 0x01, 0xff, 0xd5, 0xf7, 0x00, 0x02, 0xff, 0xff, 0xc3, 0xf8,
+    0x00, 0xfe, 0xff, 0x00, 0xa2, 0xf9, 0x00, 0xfd, 0xff, 0x00, 0x91, 0xfa, 0x00, 0xfd, 0xff, 0x01,
+    0xfe, 0x70, 0xfb, 0x00, 0xfc, 0xff, 0x01, 0xfd, 0x50, 0xfc, 0x00, 0xfb, 0xff, 0x01, 0xfc, 0x30,
+    0xfd, 0x00, 0xfa, 0xff, 0x01, 0xfa, 0x20, 0xfe, 0x00, 0xf9, 0xff, 0x03, 0xf9, 0x10, 0x00, 0x00,
+    0xf8, 0xff, 0x02, 0xe7, 0x00, 0x00, 0xf7, 0xff, 0x01, 0xd5, 0x00, 0xf6, 0xff, 0x00, 0x90, 0xf7,
+    0xff, 0x01, 0xfa, 0x10, 0xf8, 0xff, 0x02, 0xfb, 0x30, 0x00, 0xf9, 0xff, 0x03, 0xfd, 0x40, 0x00,
+    0x00, 0xfa, 0xff, 0x01, 0xfe, 0x60, 0xfe, 0x00, 0xfa, 0xff, 0x00, 0x80, 0xfd, 0x00, 0xfb, 0xff,
+    0x00, 0xa1, 0xfc, 0x00, 0xfc, 0xff, 0x00, 0xb3, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0xd4, 0xfa, 0x00,
+    0xfe, 0xff, 0x00, 0xe6, 0xf9, 0x00, 0x02, 0xff, 0xff, 0xf8, 0xf8, 0x00, 0x02, 0xff, 0xfa, 0x10,
+    0xf8, 0x00, 0x01, 0xfc, 0x30, 0xf7, 0x00, 0x00, 0x10, 0xde, 0x00,
 
     /*Unicode: U+f04c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x9d, 0xdd, 0xdd, 0xdd, 0xdc, 0x10, 0x00, 0x1c, 0xdd, 0xdd, 0xdd, 0xdd, 0x90,  //%@@@@@@@@@.....@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xb0,  //%@@@@@@@@@.....@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe7, 0x00, 0x00, 0x9d, 0xfe, 0xdd, 0x03, 0xdc, 0x10, 0x00, 0x1c, 0xfd, 0xdd, 0x00, 0x90, 0xfc,
+    0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd,
+    0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02,
+    0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00,
+    0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00,
+    0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc,
+    0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd,
+    0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02,
+    0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00,
+    0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00,
+    0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc,
+    0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd,
+    0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02,
+    0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00,
+    0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00, 0x5f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0x50, 0x00,
+    0x5f, 0xfd, 0xff, 0x01, 0xf0, 0xbf, 0xfe, 0xff, 0x03, 0xfe, 0x20, 0x00, 0x2e, 0xfd, 0xff, 0x00,
+    0xb0, 0xda, 0x00,
 
     /*Unicode: U+f04d () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x9d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x70,  //%@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe7, 0x00, 0x00, 0x9d, 0xf6, 0xdd, 0x00, 0x70, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x01, 0xd0, 0xbf, 0xf6, 0xff, 0x00, 0x90, 0xda, 0x00,
 
     /*Unicode: U+f051 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xdb, 0x00,  //+...........%@@%.
-    0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@+..........@@@@.
-    0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@+.........@@@@.
-    0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@+........@@@@.
-    0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@+.......@@@@.
-    0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@+......@@@@.
-    0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@@+.....@@@@.
-    0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@+....@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@@+...@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@@@+..@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0x20,  //@@@@@@@@@@+.@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0x20,  //@@@@@@@@@@@+@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,  //@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0x20,  //@@@@@@@@@@@%@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0x20,  //@@@@@@@@@@%.@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@@@%..@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@@%...@@@@.
-    0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@@@%....@@@@.
-    0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@@%.....@@@@.
-    0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@@%......@@@@.
-    0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@@%.......@@@@.
-    0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@@%........@@@@.
-    0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@@%.........@@@@.
-    0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x20,  //@%..........@@@@.
-    0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xfd, 0x00,  //%...........%@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xef, 0x00, 0x00, 0x60, 0xfc, 0x00, 0x03, 0x9d, 0xdb, 0x00, 0xf7, 0xfc, 0x00, 0x04, 0xff, 0xff,
+    0x20, 0xff, 0x70, 0xfd, 0x00, 0x04, 0xff, 0xff, 0x20, 0xff, 0xf7, 0xfd, 0x00, 0x05, 0xff, 0xff,
+    0x20, 0xff, 0xff, 0x70, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x20, 0xff, 0xff, 0xf7, 0xfe, 0x00, 0x02,
+    0xff, 0xff, 0x20, 0xfe, 0xff, 0x05, 0x70, 0x00, 0x00, 0xff, 0xff, 0x20, 0xfe, 0xff, 0x05, 0xf7,
+    0x00, 0x00, 0xff, 0xff, 0x20, 0xfd, 0xff, 0x04, 0x60, 0x00, 0xff, 0xff, 0x20, 0xfd, 0xff, 0x04,
+    0xf6, 0x00, 0xff, 0xff, 0x20, 0xfc, 0xff, 0x03, 0x60, 0xff, 0xff, 0x20, 0xfc, 0xff, 0x03, 0xf6,
+    0xff, 0xff, 0x20, 0xf9, 0xff, 0x00, 0x20, 0xfc, 0xff, 0x03, 0xf9, 0xff, 0xff, 0x20, 0xfc, 0xff,
+    0x03, 0x90, 0xff, 0xff, 0x20, 0xfd, 0xff, 0x04, 0xf9, 0x00, 0xff, 0xff, 0x20, 0xfd, 0xff, 0x04,
+    0x90, 0x00, 0xff, 0xff, 0x20, 0xfe, 0xff, 0x05, 0xf9, 0x00, 0x00, 0xff, 0xff, 0x20, 0xfe, 0xff,
+    0x08, 0x90, 0x00, 0x00, 0xff, 0xff, 0x20, 0xff, 0xff, 0xf9, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x20,
+    0xff, 0xff, 0x90, 0xfe, 0x00, 0x04, 0xff, 0xff, 0x20, 0xff, 0xf9, 0xfd, 0x00, 0x04, 0xff, 0xff,
+    0x20, 0xff, 0x90, 0xfd, 0x00, 0x03, 0xff, 0xff, 0x20, 0xf9, 0xfc, 0x00, 0x03, 0xff, 0xff, 0x20,
+    0x90, 0xfc, 0x00, 0x01, 0xbf, 0xfd, 0xe5, 0x00,
 
     /*Unicode: U+f052 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@+........
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@+......
-    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@+....
-    0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00,  //..+@@@@@@@@@@@@@@@@@@@+..
-    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@+.
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x60,  //+%%%%%%%%%%%%%%%%%%%%%%%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00,  //.........................
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xc8, 0x00, 0x01, 0x07, 0xe5, 0xf6, 0x00, 0x02, 0x7f, 0xff, 0x50, 0xf8, 0x00, 0x03, 0x07, 0xff,
+    0xff, 0xf5, 0xf8, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x50, 0xfa, 0x00, 0x00, 0x07, 0xfd, 0xff,
+    0x00, 0xf5, 0xfa, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0x50, 0xfc, 0x00, 0x00, 0x07, 0xfb, 0xff,
+    0x00, 0xf5, 0xfc, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0x00, 0x50, 0xfe, 0x00, 0x00, 0x07, 0xf9, 0xff,
+    0x00, 0xf5, 0xfe, 0x00, 0x00, 0x7f, 0xf8, 0xff, 0x02, 0x50, 0x00, 0x07, 0xf7, 0xff, 0x02, 0xf5,
+    0x00, 0x7f, 0xf6, 0xff, 0x01, 0x50, 0x78, 0xf6, 0x88, 0x00, 0x60, 0xf4, 0x00, 0x00, 0x13, 0xf6,
+    0x33, 0x01, 0x00, 0xef, 0xf6, 0xff, 0x00, 0xb0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0,
+    0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x01, 0xd0, 0xcf, 0xf6, 0xff, 0x00, 0x90, 0xc0, 0x00,
 
     /*Unicode: U+f053 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00,  //............+@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf8, 0x00,  //...........+@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80,  //..........+@@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf3,  //.........+@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0,  //........+@@@@@@@@.
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfc, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00,  //......+@@@@@@@@...
-    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,  //....+@@@@@@@@.....
-    0x00, 0x07, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,  //...+@@@@@@@@......
-    0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x07, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@........
-    0x5f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@.........
-    0x4f, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@.........
-    0x06, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x00,  //.+@@@@@@@@........
-    0x00, 0x6f, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x00, 0x06, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00,  //...+@@@@@@@@......
-    0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00,  //....+@@@@@@@@.....
-    0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xd1, 0x00,  //......+@@@@@@@@...
-    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xfd, 0x10,  //.......+@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xd0,  //........+@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xf2,  //.........+@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0x70,  //..........+@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xf7, 0x00,  //...........+@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x70, 0x00,  //............+@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xf2, 0x00, 0x01, 0x7f, 0x80, 0xfb, 0x00, 0x02, 0x07, 0xff, 0xf8, 0xfb, 0x00, 0x03, 0x7f, 0xff,
+    0xff, 0x80, 0xfd, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xf3, 0xfd, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+    0x00, 0xc0, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+    0x00, 0xc0, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+    0x00, 0xc0, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x7f, 0xfe, 0xff,
+    0x00, 0xc0, 0xfe, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x5f, 0xfe, 0xff,
+    0x00, 0xc0, 0xfd, 0x00, 0x00, 0x4f, 0xfe, 0xff, 0x00, 0xd1, 0xfd, 0x00, 0x00, 0x06, 0xfe, 0xff,
+    0x01, 0xfd, 0x10, 0xfd, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xd1, 0xfd, 0x00, 0x00, 0x06, 0xfe,
+    0xff, 0x01, 0xfd, 0x10, 0xfd, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xd1, 0xfd, 0x00, 0x00, 0x06,
+    0xfe, 0xff, 0x01, 0xfd, 0x10, 0xfd, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xd1, 0xfd, 0x00, 0x00,
+    0x06, 0xfe, 0xff, 0x01, 0xfd, 0x10, 0xfd, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xd0, 0xfd, 0x00,
+    0x00, 0x06, 0xfe, 0xff, 0x00, 0xf2, 0xfc, 0x00, 0x03, 0x6f, 0xff, 0xff, 0x70, 0xfc, 0x00, 0x02,
+    0x06, 0xff, 0xf7, 0xfa, 0x00, 0x01, 0x5f, 0x70, 0xe5, 0x00,
 
     /*Unicode: U+f054 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x0c, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@.............
-    0x00, 0xcf, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@............
-    0x0c, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@...........
-    0x7f, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x2e, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@.........
-    0x02, 0xef, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,  //..@@@@@@@@........
-    0x00, 0x2e, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00,  //...@@@@@@@@.......
-    0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00,  //....@@@@@@@@......
-    0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00,  //.....@@@@@@@@.....
-    0x00, 0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0x30, 0x00,  //......@@@@@@@@....
-    0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xf3, 0x00,  //.......@@@@@@@@...
-    0x00, 0x00, 0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0x30,  //........@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xf1,  //.........@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe1,  //.........@@@@@@@@.
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x20,  //........@@@@@@@@..
-    0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00,  //.......@@@@@@@@...
-    0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00,  //......@@@@@@@@....
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,  //.....@@@@@@@@.....
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //....@@@@@@@@......
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00,  //...@@@@@@@@.......
-    0x03, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00,  //..@@@@@@@@........
-    0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@.........
-    0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x0b, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@@@@...........
-    0x00, 0xbf, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@............
-    0x00, 0x0a, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xf7, 0x00, 0x01, 0x0c, 0xe3, 0xfa, 0x00, 0x02, 0xcf, 0xff, 0x30, 0xfc, 0x00, 0x03, 0x0c, 0xff,
+    0xff, 0xf3, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x2e, 0xfe, 0xff,
+    0x00, 0xf3, 0xfd, 0x00, 0x01, 0x02, 0xef, 0xfe, 0xff, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x2e, 0xfe,
+    0xff, 0x00, 0xf3, 0xfd, 0x00, 0x01, 0x02, 0xef, 0xfe, 0xff, 0x00, 0x30, 0xfd, 0x00, 0x00, 0x2e,
+    0xfe, 0xff, 0x00, 0xf3, 0xfd, 0x00, 0x01, 0x02, 0xef, 0xfe, 0xff, 0x00, 0x30, 0xfd, 0x00, 0x00,
+    0x2e, 0xfe, 0xff, 0x00, 0xf3, 0xfd, 0x00, 0x01, 0x02, 0xef, 0xfe, 0xff, 0x00, 0x30, 0xfd, 0x00,
+    0x00, 0x2e, 0xfe, 0xff, 0x00, 0xf1, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xe1, 0xfe, 0x00,
+    0x00, 0x03, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xe2, 0xfe,
+    0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xe2,
+    0xfe, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00,
+    0xe2, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff,
+    0x00, 0xe2, 0xfd, 0x00, 0x04, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0xfd, 0x00, 0x03, 0x0b, 0xff, 0xff,
+    0xe2, 0xfb, 0x00, 0x02, 0xbf, 0xfe, 0x20, 0xfb, 0x00, 0x01, 0x0a, 0xe2, 0xe0, 0x00,
 
     /*Unicode: U+f067 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x2b, 0xcc, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x17, 0x77, 0x77, 0x77, 0xdf, 0xff, 0xff, 0xb7, 0x77, 0x77, 0x76, 0x00,  //.+++++++@@@@@@%+++++++.
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x4a, 0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xff, 0xdb, 0xbb, 0xbb, 0xba, 0x20,  //+%%%%%%%@@@@@@@%%%%%%%.
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xe5, 0x00, 0x02, 0x2b, 0xcc, 0xc9, 0xf8, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x60, 0xf9, 0x00, 0x03,
+    0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff,
+    0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70,
+    0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xfd, 0x00, 0x00, 0x17, 0xfe, 0x77, 0x08, 0xdf, 0xff,
+    0xff, 0xb7, 0x77, 0x77, 0x76, 0x00, 0xdf, 0xf7, 0xff, 0x00, 0x90, 0xf6, 0xff, 0x00, 0xc0, 0xf6,
+    0xff, 0x00, 0xc0, 0xf6, 0xff, 0x01, 0xc0, 0xef, 0xf7, 0xff, 0x01, 0xb0, 0x4a, 0xfe, 0xbb, 0x07,
+    0xef, 0xff, 0xff, 0xdb, 0xbb, 0xbb, 0xba, 0x20, 0xfd, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9,
+    0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03,
+    0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0xbf, 0xff,
+    0xff, 0x70, 0xf9, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x03, 0x4e, 0xff, 0xfd, 0x10,
+    0xc1, 0x00,
 
     /*Unicode: U+f068 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x02, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x00,  //.......................
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //%@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50,  //+@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0x89, 0x00, 0x00, 0x02, 0xf8, 0x33, 0x02, 0x32, 0x00, 0xaf, 0xf7, 0xff, 0x00, 0x70, 0xf6, 0xff,
+    0x00, 0xc0, 0xf6, 0xff, 0x00, 0xc0, 0xf6, 0xff, 0x00, 0xc0, 0xf6, 0xff, 0x01, 0xb0, 0x7f, 0xf8,
+    0xff, 0x01, 0xfe, 0x50, 0x81, 0x00, 0xe5, 0x00,
 
     /*Unicode: U+f071 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%@%.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............%@@@%............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@@@@@%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x74, 0x44, 0x7f, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //........+@@@+++++@@@+........
-    0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0x30, 0x00, 0x3f, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,  //........@@@@.....@@@@........
-    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x30, 0x00, 0x3f, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@.....@@@@+.......
-    0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@+...+@@@@@.......
-    0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,  //......+@@@@@+...+@@@@@+......
-    0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00,  //......@@@@@@+...+@@@@@@......
-    0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x50, 0x00, 0x6f, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00,  //.....%@@@@@@+...+@@@@@@%.....
-    0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@@@+...+@@@@@@@.....
-    0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0x80, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00,  //....%@@@@@@@%...%@@@@@@@%....
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@@@@@@@%...
-    0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //..+@@@@@@@@@+...+@@@@@@@@@+..
-    0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //..@@@@@@@@@@+...+@@@@@@@@@@..
-    0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00,  //.+@@@@@@@@@@+...+@@@@@@@@@@+.
-    0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x11, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,  //.@@@@@@@@@@@%...%@@@@@@@@@@@.
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xfb, 0x00, 0x01, 0x0a, 0xfa, 0xf4, 0x00, 0x02, 0x8f, 0xff, 0x80, 0xf6, 0x00, 0x03, 0x01, 0xff,
+    0xff, 0xf1, 0xf6, 0x00, 0x03, 0x09, 0xff, 0xff, 0xf9, 0xf6, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0x00,
+    0x20, 0xf7, 0x00, 0x00, 0xbf, 0xfe, 0xff, 0x00, 0xb0, 0xf8, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00,
+    0xf3, 0xf8, 0x00, 0x00, 0x0c, 0xfd, 0xff, 0x00, 0xfc, 0xf8, 0x00, 0x06, 0x5f, 0xff, 0x74, 0x44,
+    0x7f, 0xff, 0x50, 0xf9, 0x00, 0x06, 0xdf, 0xff, 0x30, 0x00, 0x3f, 0xff, 0xd0, 0xfa, 0x00, 0x07,
+    0x06, 0xff, 0xff, 0x30, 0x00, 0x3f, 0xff, 0xf6, 0xfa, 0x00, 0x07, 0x0e, 0xff, 0xff, 0x40, 0x00,
+    0x4f, 0xff, 0xfe, 0xfa, 0x00, 0x08, 0x7f, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xff, 0x70, 0xfc,
+    0x00, 0x00, 0x01, 0xfe, 0xff, 0x05, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xf1, 0xfc, 0x00, 0x00, 0x09,
+    0xfe, 0xff, 0x05, 0x50, 0x00, 0x6f, 0xff, 0xff, 0xf9, 0xfc, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0x02,
+    0x60, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0x20, 0xfd, 0x00, 0x00, 0xaf, 0xfe, 0xff, 0x02, 0x80, 0x00,
+    0x8f, 0xfe, 0xff, 0x00, 0xa0, 0xfe, 0x00, 0x00, 0x03, 0xf7, 0xff, 0x00, 0xf3, 0xfe, 0x00, 0x00,
+    0x0b, 0xf7, 0xff, 0x00, 0xfb, 0xfe, 0x00, 0x00, 0x4f, 0xfd, 0xff, 0x02, 0x70, 0x00, 0x7f, 0xfd,
+    0xff, 0x03, 0x40, 0x00, 0x00, 0xdf, 0xfd, 0xff, 0x02, 0x60, 0x00, 0x6f, 0xfd, 0xff, 0x02, 0xd0,
+    0x00, 0x06, 0xfc, 0xff, 0x02, 0x60, 0x00, 0x6f, 0xfd, 0xff, 0x02, 0xf5, 0x00, 0x0e, 0xfc, 0xff,
+    0x02, 0x81, 0x11, 0x8f, 0xfd, 0xff, 0x02, 0xfe, 0x00, 0x7f, 0xf4, 0xff, 0x01, 0x70, 0xef, 0xf4,
+    0xff, 0x01, 0xe0, 0xef, 0xf4, 0xff, 0x01, 0xe0, 0x4f, 0xf5, 0xff, 0x02, 0xfe, 0x40, 0x00, 0xf5,
+    0x11, 0x00, 0x10, 0xe2, 0x00,
 
     /*Unicode: U+f074 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf5, 0x00, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x50, 0x00,  //.......................@@@+..
-    0xab, 0xbb, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x01, 0x69, 0xbb, 0xbb, 0xcf, 0xff, 0xf5, 0x00,  //%%%%%%+.........+%%%%%@@@@@+.
-    0xff, 0xff, 0xff, 0xfe, 0x50, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@+...%@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0x56, 0x66, 0x7b, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf9, 0x66, 0x66, 0x8f, 0xff, 0xe2, 0x00,  //+++++%@@@@++@@@@@%++++%@@@@..
-    0x00, 0x00, 0x00, 0x4f, 0xfd, 0x1e, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x3f, 0xfe, 0x20, 0x00,  //......+@@@.@@@@@.......@@@...
-    0x00, 0x00, 0x00, 0x07, 0xf6, 0x7f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x3f, 0xe2, 0x00, 0x00,  //.......+@++@@@@........@@....
-    0x00, 0x00, 0x00, 0x00, 0xb1, 0xef, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x2e, 0x20, 0x00, 0x00,  //........%.@@@@%........@.....
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@...............
-    0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@%...............
-    0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@................
-    0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xc2, 0x90, 0x00, 0x00, 0x00, 0x2d, 0x20, 0x00, 0x00,  //........@@@@@.%........@.....
-    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x49, 0xf3, 0x00, 0x00, 0x00, 0x3f, 0xe2, 0x00, 0x00,  //.......+@@@@+%@........@@....
-    0x00, 0x00, 0x00, 0x4f, 0xff, 0xfc, 0x1f, 0xfd, 0x10, 0x00, 0x00, 0x3f, 0xfe, 0x20, 0x00,  //.......@@@@@.@@@.......@@@...
-    0x45, 0x55, 0x6a, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xf9, 0x65, 0x55, 0x8f, 0xff, 0xe2, 0x00,  //+++++%@@@@@.%@@@@%++++%@@@@..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@%...@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xbc, 0xcc, 0xba, 0x60, 0x00, 0x00, 0x00, 0x02, 0x7a, 0xcc, 0xcc, 0xdf, 0xff, 0xf6, 0x00,  //%@@@%%+.........+%%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x60, 0x00,  //.......................@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf6, 0x00, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf6, 0x00, 0x00, 0x03, 0xf3, 0x00, 0x01, 0x3f, 0x50, 0xf4, 0x00, 0x01, 0x3f, 0xf5, 0xf4, 0x00,
+    0x07, 0x3f, 0xff, 0x50, 0x00, 0xab, 0xbb, 0xa8, 0x50, 0xfe, 0x00, 0x07, 0x01, 0x69, 0xbb, 0xbb,
+    0xcf, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0x04, 0xfe, 0x50, 0x00, 0x00, 0x8f, 0xfb, 0xff, 0x00, 0x60,
+    0xfd, 0xff, 0x02, 0xf8, 0x00, 0x0b, 0xfa, 0xff, 0x00, 0xd0, 0xfc, 0xff, 0x01, 0x60, 0xaf, 0xfb,
+    0xff, 0x0f, 0xfe, 0x20, 0x56, 0x66, 0x7b, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf9, 0x66, 0x66, 0x8f,
+    0xff, 0xe2, 0xfd, 0x00, 0x0a, 0x4f, 0xfd, 0x1e, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x3f, 0xfe, 0x20,
+    0xfd, 0x00, 0x04, 0x07, 0xf6, 0x7f, 0xff, 0xf3, 0xfe, 0x00, 0x01, 0x3f, 0xe2, 0xfb, 0x00, 0x03,
+    0xb1, 0xef, 0xff, 0xa0, 0xfe, 0x00, 0x01, 0x2e, 0x20, 0xfb, 0x00, 0x03, 0x06, 0xff, 0xff, 0x20,
+    0xf6, 0x00, 0x02, 0x0d, 0xff, 0xfa, 0xf5, 0x00, 0x02, 0x5f, 0xff, 0xf3, 0xf5, 0x00, 0x03, 0xcf,
+    0xff, 0xc2, 0x90, 0xfe, 0x00, 0x01, 0x2d, 0x20, 0xfc, 0x00, 0x04, 0x06, 0xff, 0xff, 0x49, 0xf3,
+    0xfe, 0x00, 0x01, 0x3f, 0xe2, 0xfc, 0x00, 0x1a, 0x4f, 0xff, 0xfc, 0x1f, 0xfd, 0x10, 0x00, 0x00,
+    0x3f, 0xfe, 0x20, 0x00, 0x45, 0x55, 0x6a, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xf9, 0x65, 0x55, 0x8f,
+    0xff, 0xe2, 0x00, 0xfc, 0xff, 0x01, 0x70, 0xaf, 0xfb, 0xff, 0x01, 0xfe, 0x20, 0xfd, 0xff, 0x02,
+    0xf9, 0x00, 0x0c, 0xfa, 0xff, 0x00, 0xd0, 0xfd, 0xff, 0x03, 0x70, 0x00, 0x00, 0x9f, 0xfb, 0xff,
+    0x04, 0x60, 0xbc, 0xcc, 0xba, 0x60, 0xfe, 0x00, 0x06, 0x02, 0x7a, 0xcc, 0xcc, 0xdf, 0xff, 0xf6,
+    0xf5, 0x00, 0x02, 0x3f, 0xff, 0x60, 0xf5, 0x00, 0x01, 0x3f, 0xf6, 0xf4, 0x00, 0x01, 0x3f, 0x60,
+    0xf4, 0x00, 0x00, 0x03, 0xd1, 0x00,
 
     /*Unicode: U+f077 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xde, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@............
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00,  //........@@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@@@@@@@@........
-    0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@.......
-    0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@......
-    0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //....@@@@@@@@+.@@@@@@@@.....
-    0x00, 0x1d, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,  //...@@@@@@@@+...@@@@@@@@....
-    0x01, 0xdf, 0xff, 0xff, 0xff, 0x50, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00,  //..@@@@@@@@+.....@@@@@@@@...
-    0x1d, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe2, 0x00,  //.@@@@@@@@+.......@@@@@@@@..
-    0xdf, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xfe, 0x00,  //@@@@@@@@+.........@@@@@@@@.
-    0xcf, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x00,  //@@@@@@@+...........@@@@@@@.
-    0x1c, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xd1, 0x00,  //.@@@@@+.............@@@@@..
-    0x01, 0xcf, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfd, 0x10, 0x00,  //..@@@+...............@@@...
-    0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x91, 0x00, 0x00,  //...%+.................%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x8c, 0x00, 0x02, 0x01, 0xde, 0x20, 0xf6, 0x00, 0x02, 0x1d, 0xff, 0xe2, 0xf7, 0x00, 0x04, 0x01,
+    0xdf, 0xff, 0xfe, 0x20, 0xf8, 0x00, 0x00, 0x1d, 0xfe, 0xff, 0x00, 0xe2, 0xf9, 0x00, 0x01, 0x01,
+    0xdf, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfa, 0x00, 0x00, 0x1d, 0xfc, 0xff, 0x00, 0xe2, 0xfb, 0x00,
+    0x01, 0x01, 0xdf, 0xfc, 0xff, 0x01, 0xfe, 0x20, 0xfc, 0x00, 0x00, 0x1d, 0xfa, 0xff, 0x00, 0xe2,
+    0xfd, 0x00, 0x01, 0x01, 0xdf, 0xfe, 0xff, 0x00, 0x53, 0xfe, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00,
+    0x00, 0x1d, 0xfe, 0xff, 0x02, 0xf5, 0x00, 0x3f, 0xfe, 0xff, 0x04, 0xe2, 0x00, 0x00, 0x01, 0xdf,
+    0xfe, 0xff, 0x02, 0x50, 0x00, 0x03, 0xfe, 0xff, 0x03, 0xfe, 0x20, 0x00, 0x1d, 0xfe, 0xff, 0x00,
+    0xf5, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x02, 0xe2, 0x00, 0xdf, 0xfe, 0xff, 0x00, 0x50, 0xfe,
+    0x00, 0x00, 0x04, 0xfe, 0xff, 0x05, 0xfe, 0x00, 0xcf, 0xff, 0xff, 0xf5, 0xfc, 0x00, 0x08, 0x4f,
+    0xff, 0xff, 0xfd, 0x00, 0x1c, 0xff, 0xff, 0x50, 0xfc, 0x00, 0x07, 0x04, 0xff, 0xff, 0xd1, 0x00,
+    0x01, 0xcf, 0xf5, 0xfa, 0x00, 0x06, 0x4f, 0xfd, 0x10, 0x00, 0x00, 0x09, 0x40, 0xfa, 0x00, 0x01,
+    0x03, 0x91, 0xb9, 0x00,
 
     /*Unicode: U+f078 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  //...........................
-    0x00, 0x6f, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0x00, 0x00,  //..+@@................%@%...
-    0x06, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x80, 0x00,  //.+@@@@..............%@@@%..
-    0x6f, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf8, 0x00,  //+@@@@@@............%@@@@@%.
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@..........%@@@@@@@.
-    0x6f, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xf7, 0x00,  //+@@@@@@@@........%@@@@@@@+.
-    0x06, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0x70, 0x00,  //.+@@@@@@@@......%@@@@@@@+..
-    0x00, 0x6f, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //..+@@@@@@@@....%@@@@@@@+...
-    0x00, 0x06, 0xff, 0xff, 0xff, 0xfc, 0x10, 0xbf, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //...+@@@@@@@@..%@@@@@@@+....
-    0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00,  //....+@@@@@@@@%@@@@@@@+.....
-    0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@@+............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............++.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x90, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x01, 0x6f, 0xc1, 0xfa, 0x00, 0x07,
+    0x0b, 0xf8, 0x00, 0x00, 0x06, 0xff, 0xfc, 0x10, 0xfb, 0x00, 0x07, 0xbf, 0xff, 0x80, 0x00, 0x6f,
+    0xff, 0xff, 0xc1, 0xfc, 0x00, 0x04, 0x0b, 0xff, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x01, 0xfc, 0x10,
+    0xfd, 0x00, 0x00, 0xbf, 0xfe, 0xff, 0x01, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xc1, 0xfe, 0x00, 0x00,
+    0x0b, 0xfe, 0xff, 0x02, 0xf7, 0x00, 0x06, 0xfe, 0xff, 0x04, 0xfc, 0x10, 0x00, 0x00, 0xbf, 0xfe,
+    0xff, 0x03, 0x70, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x02, 0xc1, 0x00, 0x0b, 0xfe, 0xff, 0x00, 0xf7,
+    0xfe, 0x00, 0x00, 0x06, 0xfe, 0xff, 0x02, 0xfc, 0x10, 0xbf, 0xfe, 0xff, 0x00, 0x70, 0xfd, 0x00,
+    0x00, 0x6f, 0xfe, 0xff, 0x00, 0xcb, 0xfe, 0xff, 0x00, 0xf7, 0xfc, 0x00, 0x00, 0x06, 0xfa, 0xff,
+    0x00, 0x70, 0xfb, 0x00, 0x00, 0x6f, 0xfc, 0xff, 0x00, 0xf7, 0xfa, 0x00, 0x00, 0x06, 0xfc, 0xff,
+    0x00, 0x70, 0xf9, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x00, 0xf7, 0xf8, 0x00, 0x00, 0x06, 0xfe, 0xff,
+    0x00, 0x70, 0xf7, 0x00, 0x02, 0x6f, 0xff, 0xf7, 0xf6, 0x00, 0x02, 0x06, 0xff, 0x70, 0xf5, 0x00,
+    0x00, 0x45, 0xc2, 0x00,
 
     /*Unicode: U+f079 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x0a, 0xe2, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,  //.....%@...%@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x8f, 0xfd, 0x10, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,  //....%@@@...@@@@@@@@@@@@@@@@.....
-    0x00, 0x05, 0xff, 0xff, 0xc0, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,  //...+@@@@@...@@@@@@@@@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xff, 0xf9, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,  //...@@@@@@%..+@@@@@@@@@@@@@@.....
-    0x01, 0xef, 0xff, 0xff, 0xff, 0x70, 0x01, 0x11, 0x11, 0x11, 0x11, 0x5f, 0xff, 0xe0, 0x00, 0x00,  //..@@@@@@@@+...........+@@@@.....
-    0x0d, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00,  //.@@@@@@@@@@+...........@@@@.....
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00,  //%@@@@@@@@@@@...........@@@@.....
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00,  //@@@@@@@@@@@@+..........@@@@.....
-    0x14, 0x44, 0xef, 0xff, 0x74, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00,  //.+++@@@@+++............@@@@.....
-    0x00, 0x00, 0xdf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xe0, 0x00, 0x00,  //....@@@@+..............@@@@.....
-    0x00, 0x00, 0xdf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x6f, 0xff, 0xf4, 0x44, 0x20,  //....@@@@+...........+++@@@@+++..
-    0x00, 0x00, 0xdf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //....@@@@+.........+@@@@@@@@@@@@.
-    0x00, 0x00, 0xdf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //....@@@@+..........@@@@@@@@@@@%.
-    0x00, 0x00, 0xdf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,  //....@@@@+...........@@@@@@@@@@..
-    0x00, 0x00, 0xdf, 0xff, 0x62, 0x22, 0x22, 0x22, 0x21, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xe2, 0x00,  //....@@@@+...........+@@@@@@@@...
-    0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x08, 0xff, 0xff, 0xff, 0x40, 0x00,  //....@@@@@@@@@@@@@@+..%@@@@@@+...
-    0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0xbf, 0xff, 0xf6, 0x00, 0x00,  //....@@@@@@@@@@@@@@@...%@@@@+....
-    0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0d, 0xff, 0x90, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@...@@@%.....
-    0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x01, 0xdb, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@%...@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0x9f, 0x00, 0x03, 0x0a, 0xe2, 0x00, 0x8f, 0xfa, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x03, 0x8f, 0xfd,
+    0x10, 0x1e, 0xfa, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x04, 0x05, 0xff, 0xff, 0xc0, 0x02, 0xfa, 0xff,
+    0x00, 0xe0, 0xfe, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xf9, 0x00, 0x4f, 0xfb, 0xff, 0x04, 0xe0, 0x00,
+    0x00, 0x01, 0xef, 0xfe, 0xff, 0x01, 0x70, 0x01, 0xfd, 0x11, 0x05, 0x5f, 0xff, 0xe0, 0x00, 0x00,
+    0x0d, 0xfd, 0xff, 0x00, 0xf4, 0xfc, 0x00, 0x05, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0xaf, 0xfc, 0xff,
+    0x00, 0x20, 0xfd, 0x00, 0x05, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0xef, 0xfc, 0xff, 0x00, 0x50, 0xfd,
+    0x00, 0x0a, 0x3f, 0xff, 0xe0, 0x00, 0x00, 0x14, 0x44, 0xef, 0xff, 0x74, 0x43, 0xfc, 0x00, 0x02,
+    0x3f, 0xff, 0xe0, 0xfd, 0x00, 0x02, 0xdf, 0xff, 0x40, 0xfb, 0x00, 0x02, 0x3f, 0xff, 0xe0, 0xfd,
+    0x00, 0x02, 0xdf, 0xff, 0x40, 0xfd, 0x00, 0x0b, 0x03, 0x44, 0x6f, 0xff, 0xf4, 0x44, 0x20, 0x00,
+    0x00, 0xdf, 0xff, 0x40, 0xfd, 0x00, 0x00, 0x4f, 0xfc, 0xff, 0x05, 0xf0, 0x00, 0x00, 0xdf, 0xff,
+    0x40, 0xfd, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0x05, 0xb0, 0x00, 0x00, 0xdf, 0xff, 0x40, 0xfd, 0x00,
+    0x00, 0x03, 0xfd, 0xff, 0x06, 0xfd, 0x10, 0x00, 0x00, 0xdf, 0xff, 0x62, 0xfe, 0x22, 0x02, 0x21,
+    0x00, 0x5f, 0xfe, 0xff, 0x00, 0xe2, 0xfe, 0x00, 0x00, 0xdf, 0xfb, 0xff, 0x01, 0x60, 0x08, 0xfe,
+    0xff, 0x00, 0x40, 0xfe, 0x00, 0x00, 0xdf, 0xfb, 0xff, 0x04, 0xf3, 0x00, 0xbf, 0xff, 0xf6, 0xfd,
+    0x00, 0x00, 0xdf, 0xfb, 0xff, 0x04, 0xfe, 0x20, 0x0d, 0xff, 0x90, 0xfd, 0x00, 0x00, 0xcf, 0xfa,
+    0xff, 0x02, 0x90, 0x01, 0xdb, 0xae, 0x00,
 
     /*Unicode: U+f07b () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x01, 0x9c, 0xcc, 0xcc, 0xcb, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@@@%+................
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@%...............
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@...............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x60, 0x00,  //@@@@@@@@@@@@@%%%%%%%%%%%+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,  //+@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x04, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xe5, 0x00, 0x05, 0x01, 0x9c, 0xcc, 0xcc, 0xcb, 0x50, 0xf9, 0x00, 0x00, 0x2e, 0xfd, 0xff, 0x00,
+    0xf8, 0xf9, 0x00, 0x00, 0xbf, 0xfc, 0xff, 0x00, 0x20, 0xfa, 0x00, 0xfb, 0xff, 0x00, 0x60, 0xfa,
+    0x00, 0xfb, 0xff, 0x00, 0xca, 0xfd, 0xaa, 0x02, 0xa9, 0x60, 0x00, 0xf5, 0xff, 0x01, 0xfc, 0x00,
+    0xf4, 0xff, 0x00, 0x90, 0xf4, 0xff, 0x00, 0xd0, 0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0,
+    0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0,
+    0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x00, 0xe0,
+    0xf4, 0xff, 0x00, 0xe0, 0xf4, 0xff, 0x01, 0xe0, 0xcf, 0xf5, 0xff, 0x01, 0xb0, 0x4f, 0xf5, 0xff,
+    0x02, 0x30, 0x04, 0xcf, 0xf7, 0xff, 0x00, 0xc3, 0xba, 0x00,
 
     /*Unicode: U+f093 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //........@@@@@@@@@@@........
-    0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00,  //.......@@@@@@@@@@@@@.......
-    0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x03, 0x99, 0x99, 0xdf, 0xff, 0xff, 0xc9, 0x99, 0x83, 0x00, 0x00, 0x00,  //......%%%%@@@@@@@%%%%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x01, 0x22, 0x22, 0x22, 0x10, 0x5d, 0xdd, 0xdd, 0x40, 0x12, 0x22, 0x22, 0x21, 0x00,  //..........+@@@@@...........
-    0xaf, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@.........@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x52, 0x22, 0x22, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@+.....+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x5f, 0xf3, 0x4f, 0xf0,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x5f, 0xf3, 0x4f, 0xf0,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xed, 0x00, 0x01, 0x3b, 0x20, 0xf6, 0x00, 0x02, 0x03, 0xff, 0xe2, 0xf6, 0x00, 0x03, 0x3f, 0xff,
+    0xfe, 0x20, 0xf8, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xe2, 0xf8, 0x00, 0x00, 0x3f, 0xfe, 0xff,
+    0x01, 0xfe, 0x20, 0xfa, 0x00, 0x00, 0x03, 0xfc, 0xff, 0x00, 0xe2, 0xfa, 0x00, 0x00, 0x3f, 0xfc,
+    0xff, 0x01, 0xfe, 0x20, 0xfc, 0x00, 0x00, 0x03, 0xfa, 0xff, 0x00, 0xe2, 0xfc, 0x00, 0x00, 0x0c,
+    0xfa, 0xff, 0x00, 0xfa, 0xfc, 0x00, 0x08, 0x03, 0x99, 0x99, 0xdf, 0xff, 0xff, 0xc9, 0x99, 0x83,
+    0xf9, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00,
+    0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf,
+    0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x80, 0xf7, 0x00, 0x03, 0xaf, 0xff, 0xff,
+    0x80, 0xfc, 0x00, 0x00, 0x01, 0xfe, 0x22, 0x0a, 0x10, 0x5d, 0xdd, 0xdd, 0x40, 0x12, 0x22, 0x22,
+    0x21, 0x00, 0xaf, 0xfe, 0xff, 0x00, 0xd0, 0xfe, 0x00, 0x01, 0x01, 0xdf, 0xfe, 0xff, 0x00, 0x90,
+    0xfd, 0xff, 0x04, 0xfc, 0x52, 0x22, 0x22, 0x5d, 0xfd, 0xff, 0x00, 0xf0, 0xf4, 0xff, 0x00, 0xf0,
+    0xf4, 0xff, 0x00, 0xf0, 0xf8, 0xff, 0x04, 0xd1, 0x5f, 0xf3, 0x4f, 0xf0, 0xf8, 0xff, 0x04, 0xd1,
+    0x5f, 0xf3, 0x4f, 0xf0, 0xf4, 0xff, 0x01, 0xf0, 0x9f, 0xf5, 0xff, 0x00, 0x90, 0xd7, 0x00,
 
     /*Unicode: U+f095 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x39, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%%+.................
-    0x05, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@@.................
-    0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@%................
-    0x8f, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@................
-    0xdf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@...............
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xbf, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@%................
-    0x6f, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@%.................
-    0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@+.................
-    0x0a, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@@@.................
-    0x03, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@%................
-    0x00, 0xaf, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@+...............
-    0x00, 0x1e, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@...............
-    0x00, 0x04, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //...+@@@@@..............
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0x50, 0x00, 0x00, 0xcf, 0xb1, 0x00, 0x00,  //....+@@@@@+.....%@%....
-    0x00, 0x00, 0x08, 0xff, 0xff, 0xfb, 0x10, 0x0a, 0xff, 0xff, 0x80, 0x00,  //.....%@@@@@%...%@@@@%..
-    0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xfe, 0x50,  //......%@@@@@@+%@@@@@@@+
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //.......+@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //........+@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,  //..........%@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xaf, 0xff, 0xff, 0xff, 0xf5, 0x00,  //............%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xff, 0xd8, 0x10, 0x00,  //..............+%@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xe8, 0x00, 0x01, 0x39, 0xb5, 0xf8, 0x00, 0x02, 0x05, 0xff, 0xfe, 0xf8, 0x00, 0x03, 0x1f, 0xff,
+    0xff, 0x80, 0xf9, 0x00, 0x03, 0x8f, 0xff, 0xff, 0xf1, 0xf9, 0x00, 0x03, 0xdf, 0xff, 0xff, 0xfb,
+    0xf9, 0x00, 0xfd, 0xff, 0x00, 0x30, 0xfa, 0x00, 0xfe, 0xff, 0x00, 0xfc, 0xf9, 0x00, 0x03, 0xbf,
+    0xff, 0xff, 0xa0, 0xf9, 0x00, 0x02, 0x6f, 0xff, 0xfa, 0xf8, 0x00, 0x02, 0x1f, 0xff, 0xf8, 0xf8,
+    0x00, 0x03, 0x0a, 0xff, 0xff, 0x10, 0xf9, 0x00, 0x03, 0x03, 0xff, 0xff, 0xa0, 0xf8, 0x00, 0x02,
+    0xaf, 0xff, 0xf5, 0xf8, 0x00, 0x03, 0x1e, 0xff, 0xff, 0x30, 0xf9, 0x00, 0x03, 0x04, 0xff, 0xff,
+    0xe3, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x07, 0x7f, 0xff, 0xff, 0x50, 0x00, 0x00, 0xcf, 0xb1,
+    0xfd, 0x00, 0x08, 0x08, 0xff, 0xff, 0xfb, 0x10, 0x0a, 0xff, 0xff, 0x80, 0xfd, 0x00, 0x08, 0x8f,
+    0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xfe, 0x50, 0xfe, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x00, 0xb0,
+    0xfd, 0x00, 0x00, 0x4e, 0xfb, 0xff, 0x00, 0x90, 0xfd, 0x00, 0x01, 0x01, 0xaf, 0xfc, 0xff, 0x00,
+    0x30, 0xfc, 0x00, 0x01, 0x03, 0xaf, 0xfe, 0xff, 0x00, 0xf5, 0xfa, 0x00, 0x04, 0x01, 0x6b, 0xff,
+    0xd8, 0x10, 0xc4, 0x00,
 
     /*Unicode: U+f0c4 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x47, 0x98, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..++%++......................
-    0x1c, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@+....................
-    0xcf, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x10, 0x00,  //@@@@@@@@@@...............+...
-    0xff, 0xf5, 0x01, 0x4b, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xea, 0xe9, 0x00,  //@@@+..+%@@@............%@%@%.
-    0xff, 0x90, 0x00, 0x00, 0x5f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xe8, 0x00, 0x1d, 0x60,  //@@%.....+@@%.........%@%...@+
-    0xff, 0xd0, 0x00, 0x00, 0x07, 0xfd, 0x00, 0x00, 0x00, 0x07, 0xea, 0x10, 0x01, 0xbc, 0x10,  //@@@......+@@.......+@%....%@.
-    0xef, 0xfa, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x05, 0xdb, 0x30, 0x00, 0x2d, 0x90, 0x00,  //@@@%......@@.....+@%.....@%..
-    0x4f, 0xff, 0xe6, 0x20, 0x2b, 0xfe, 0x10, 0x04, 0xcd, 0x40, 0x00, 0x05, 0xe6, 0x00, 0x00,  //+@@@@+...%@@....@@+....+@+...
-    0x05, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe7, 0xbe, 0x60, 0x00, 0x00, 0x8e, 0x30, 0x00, 0x00,  //.+@@@@@@@@@%@+%@+.....%@.....
-    0x00, 0x2b, 0xff, 0xff, 0xff, 0xc0, 0x9f, 0x80, 0x00, 0x00, 0x1b, 0xb1, 0x00, 0x00, 0x00,  //...%@@@@@@@.%@+......%%......
-    0x00, 0x00, 0x26, 0x88, 0x63, 0xdc, 0xf2, 0x33, 0x00, 0x02, 0xd8, 0x00, 0x00, 0x00, 0x00,  //.....+%%+.@@@.......@%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf0, 0xef, 0x00, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00,  //...........%@.@@..+@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xb0, 0xbc, 0x08, 0xed, 0xb1, 0x00, 0x00, 0x00, 0x00,  //..........+@%.%@.%@@%........
-    0x00, 0x02, 0x8d, 0xff, 0xda, 0xe5, 0x02, 0x51, 0xbb, 0x10, 0xae, 0x30, 0x00, 0x00, 0x00,  //....%@@@@%@+..+.%%..%@.......
-    0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x8f, 0xff, 0x70, 0x00, 0x06, 0xf6, 0x00, 0x00, 0x00,  //..%@@@@@@@@.%@@@+....+@+.....
-    0x0c, 0xff, 0xff, 0xb9, 0xbf, 0xff, 0xa1, 0x4c, 0xd5, 0x00, 0x00, 0x3d, 0xa0, 0x00, 0x00,  //.@@@@@%%%@@@%.+@@+.....@%....
-    0xaf, 0xff, 0x70, 0x00, 0x05, 0xfe, 0x00, 0x00, 0x5d, 0xc4, 0x00, 0x00, 0xbd, 0x20, 0x00,  //%@@@+....+@@....+@@+....%@...
-    0xff, 0xf4, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x6e, 0xb3, 0x00, 0x07, 0xe5, 0x00,  //@@@.......@@......+@%....+@+.
-    0xff, 0xa0, 0x00, 0x00, 0x0c, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xa1, 0x00, 0x3e, 0x50,  //@@%......@@%........+@%....@+
-    0xff, 0xc0, 0x00, 0x04, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8e, 0x83, 0x9e, 0x30,  //@@@....+@@@...........%@%.%@.
-    0xff, 0xfe, 0xaa, 0xdf, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9d, 0x71, 0x00,  //@@@@%%@@@@+.............%@+..
-    0x5f, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@+...................
-    0x03, 0xae, 0xfe, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@%+.....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xc4, 0x00, 0x02, 0x47, 0x98, 0x40, 0xf6, 0x00, 0x00, 0x1c, 0xfe, 0xff, 0x00, 0x80, 0xf7, 0x00,
+    0x00, 0xcf, 0xfe, 0xff, 0x01, 0xfd, 0x10, 0xfb, 0x00, 0x08, 0x27, 0x10, 0x00, 0xff, 0xf5, 0x01,
+    0x4b, 0xff, 0xd0, 0xfc, 0x00, 0x09, 0x1a, 0xea, 0xe9, 0x00, 0xff, 0x90, 0x00, 0x00, 0x5f, 0xf8,
+    0xfd, 0x00, 0x0a, 0x08, 0xe8, 0x00, 0x1d, 0x60, 0xff, 0xd0, 0x00, 0x00, 0x07, 0xfd, 0xfe, 0x00,
+    0x24, 0x07, 0xea, 0x10, 0x01, 0xbc, 0x10, 0xef, 0xfa, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x05,
+    0xdb, 0x30, 0x00, 0x2d, 0x90, 0x00, 0x4f, 0xff, 0xe6, 0x20, 0x2b, 0xfe, 0x10, 0x04, 0xcd, 0x40,
+    0x00, 0x05, 0xe6, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x07, 0xfb, 0xe7, 0xbe, 0x60, 0x00, 0x00, 0x8e,
+    0x30, 0xfe, 0x00, 0x00, 0x2b, 0xfe, 0xff, 0x06, 0xc0, 0x9f, 0x80, 0x00, 0x00, 0x1b, 0xb1, 0xfc,
+    0x00, 0x08, 0x26, 0x88, 0x63, 0xdc, 0xf2, 0x33, 0x00, 0x02, 0xd8, 0xf8, 0x00, 0x05, 0x09, 0xf0,
+    0xef, 0x00, 0x5f, 0x50, 0xf8, 0x00, 0x05, 0x4e, 0xb0, 0xbc, 0x08, 0xed, 0xb1, 0xfc, 0x00, 0x0a,
+    0x02, 0x8d, 0xff, 0xda, 0xe5, 0x02, 0x51, 0xbb, 0x10, 0xae, 0x30, 0xfd, 0x00, 0x00, 0x9f, 0xfe,
+    0xff, 0x06, 0xd2, 0x8f, 0xff, 0x70, 0x00, 0x06, 0xf6, 0xfe, 0x00, 0x23, 0x0c, 0xff, 0xff, 0xb9,
+    0xbf, 0xff, 0xa1, 0x4c, 0xd5, 0x00, 0x00, 0x3d, 0xa0, 0x00, 0x00, 0xaf, 0xff, 0x70, 0x00, 0x05,
+    0xfe, 0x00, 0x00, 0x5d, 0xc4, 0x00, 0x00, 0xbd, 0x20, 0x00, 0xff, 0xf4, 0x00, 0x00, 0x03, 0xff,
+    0xfe, 0x00, 0x0b, 0x6e, 0xb3, 0x00, 0x07, 0xe5, 0x00, 0xff, 0xa0, 0x00, 0x00, 0x0c, 0xfb, 0xfd,
+    0x00, 0x0a, 0x7e, 0xa1, 0x00, 0x3e, 0x50, 0xff, 0xc0, 0x00, 0x04, 0xdf, 0xf3, 0xfd, 0x00, 0x0a,
+    0x01, 0x8e, 0x83, 0x9e, 0x30, 0xff, 0xfe, 0xaa, 0xdf, 0xff, 0x60, 0xfc, 0x00, 0x04, 0x01, 0x9d,
+    0x71, 0x00, 0x5f, 0xfe, 0xff, 0x00, 0xe4, 0xf7, 0x00, 0x03, 0x03, 0xae, 0xfe, 0xb6, 0xc9, 0x00,
 
     /*Unicode: U+f0c5 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@+..........
-    0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......%@@@@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x8f, 0xff, 0x21, 0x11, 0x11, 0x2f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@@@.......@@..........
-    0x00, 0x00, 0x08, 0xfc, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@.......@@..........
-    0x00, 0x00, 0x8f, 0xc1, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@.@@.......@@..........
-    0x00, 0x09, 0xfc, 0x10, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@..@@.......@@..........
-    0x00, 0x9f, 0xc1, 0x00, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf9, 0xef, 0xff, 0xff, 0xff, 0x70,  //..%@@...@@.......@@%@@@@@@@@+
-    0x09, 0xfc, 0x10, 0x00, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.%@@....@@.......@@@@@@@@@@@@
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //+@@@@@@@@@.......@@@@......@@
-    0xdf, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x03, 0xef, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@@@@@@@@%......@@@@@......@@
-    0xff, 0x21, 0x11, 0x11, 0x00, 0x00, 0x00, 0x3e, 0xfd, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@.............@@@.@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xe2, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@...........+@@@..@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfe, 0x20, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@..........+@@@...@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x05, 0xff, 0xf3, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@.........+@@@....@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x51, 0x11, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@.........@@@+....@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@........%@@@@@@@@@@......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x1f, 0xf0,  //@@........@@@@@@@@@@+......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@........@@+..............@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@........@@+..............@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@........@@+..............@@
-    0xff, 0x20, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@........@@+..............@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@@@@@@@@@@@+..............@@
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //%@@@@@@@@@@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //..........@@@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //..........+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xfd, 0x00, 0x00, 0x5c, 0xfd, 0xff, 0x00, 0x70, 0xf9, 0x00, 0x00, 0x08, 0xfc, 0xff, 0x00, 0xf0,
+    0xf9, 0x00, 0x06, 0x8f, 0xff, 0x21, 0x11, 0x11, 0x2f, 0xf0, 0xfa, 0x00, 0x07, 0x08, 0xfc, 0xff,
+    0x10, 0x00, 0x00, 0x0f, 0xf0, 0xfa, 0x00, 0x07, 0x8f, 0xc1, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf0,
+    0xfb, 0x00, 0x08, 0x09, 0xfc, 0x10, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf0, 0xfb, 0x00, 0x09, 0x9f,
+    0xc1, 0x00, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xf9, 0xef, 0xfe, 0xff, 0x09, 0x70, 0x09, 0xfc, 0x10,
+    0x00, 0xff, 0x10, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0x01, 0xf0, 0x6f, 0xfd, 0xff, 0xfe, 0x00, 0x07,
+    0x2f, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xdf, 0xfe, 0xff, 0x0e, 0xfa, 0x00, 0x00, 0x03, 0xef,
+    0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x21, 0x11, 0x11, 0xfe, 0x00, 0x09, 0x3e, 0xfd, 0x1f,
+    0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x10, 0xfd, 0x00, 0x0a, 0x04, 0xff, 0xe2, 0x0f, 0xf0, 0x00,
+    0x00, 0x1f, 0xf0, 0xff, 0x10, 0xfd, 0x00, 0x0a, 0x5f, 0xfe, 0x20, 0x0f, 0xf0, 0x00, 0x00, 0x1f,
+    0xf0, 0xff, 0x10, 0xfe, 0x00, 0x0b, 0x05, 0xff, 0xf3, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,
+    0xff, 0x10, 0xfe, 0x00, 0x0b, 0x3f, 0xff, 0x51, 0x11, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff,
+    0x10, 0xfe, 0x00, 0x00, 0xbf, 0xfd, 0xff, 0x06, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x10, 0xfe,
+    0x00, 0x00, 0xef, 0xfd, 0xff, 0x06, 0x70, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x10, 0xfe, 0x00, 0x01,
+    0xef, 0x50, 0xfb, 0x00, 0x03, 0x1f, 0xf0, 0xff, 0x10, 0xfe, 0x00, 0x01, 0xef, 0x50, 0xfb, 0x00,
+    0x03, 0x1f, 0xf0, 0xff, 0x10, 0xfe, 0x00, 0x01, 0xef, 0x50, 0xfb, 0x00, 0x03, 0x1f, 0xf0, 0xff,
+    0x20, 0xfe, 0x00, 0x01, 0xef, 0x50, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfb, 0xff, 0x00, 0x50, 0xfb,
+    0x00, 0x02, 0x1f, 0xf0, 0x8f, 0xfc, 0xff, 0x00, 0x50, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfc, 0x00,
+    0x01, 0xef, 0x50, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfc, 0x00, 0x01, 0xef, 0x50, 0xfb, 0x00, 0x01,
+    0x1f, 0xf0, 0xfc, 0x00, 0x01, 0xef, 0x50, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfc, 0x00, 0x01, 0xef,
+    0x50, 0xfb, 0x00, 0x01, 0x1f, 0xf0, 0xfc, 0x00, 0x00, 0xef, 0xf9, 0xff, 0x00, 0xf0, 0xfc, 0x00,
+    0x00, 0x7f, 0xf9, 0xff, 0x00, 0x80, 0xf2, 0x00,
 
     /*Unicode: U+f0c7 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x00,  //+@@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@%.....
-    0xff, 0x20, 0xff, 0xff, 0xff, 0x50, 0x00, 0x3f, 0xf3, 0xdf, 0xb0, 0x00, 0x00,  //@@..@@@@@@+....@@.@@%....
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1f, 0xf0, 0x1d, 0xfb, 0x00, 0x00,  //@@..@@@@@@.....@@..@@%...
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1f, 0xf0, 0x02, 0xef, 0xb0, 0x00,  //@@..@@@@@@.....@@...@@%..
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1f, 0xf0, 0x00, 0x2e, 0xfb, 0x00,  //@@..@@@@@@.....@@....@@%.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1f, 0xf0, 0x00, 0x03, 0xff, 0x70,  //@@..@@@@@@.....@@.....@@+
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x5f, 0xd0,  //@@..@@@@@@.....@@.....+@@
-    0xff, 0x10, 0xff, 0xff, 0xff, 0x51, 0x11, 0x3f, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@..@@@@@@+....@@......@@
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xf0,  //@@..@@@@@@@@@@@@@......@@
-    0xff, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x1f, 0xf0,  //@@..+@@@@@@@@@@@+......@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@.....................@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@.....................@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@.....................@@
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0,  //@@.....................@@
-    0xff, 0x10, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xf0,  //@@..%@@@@@@@@@@@@@@@%..@@
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xf0,  //@@..@@@@@@@@@@@@@@@@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0x10, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,  //@@..@@.............@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xe7, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0x01, 0xfd, 0x70, 0xfe, 0x00, 0xf8, 0xff, 0x00, 0xfb, 0xfe,
+    0x00, 0x01, 0xff, 0x20, 0xfe, 0xff, 0x09, 0x50, 0x00, 0x3f, 0xf3, 0xdf, 0xb0, 0x00, 0x00, 0xff,
+    0x10, 0xfe, 0xff, 0x09, 0x30, 0x00, 0x1f, 0xf0, 0x1d, 0xfb, 0x00, 0x00, 0xff, 0x10, 0xfe, 0xff,
+    0x09, 0x30, 0x00, 0x1f, 0xf0, 0x02, 0xef, 0xb0, 0x00, 0xff, 0x10, 0xfe, 0xff, 0x09, 0x30, 0x00,
+    0x1f, 0xf0, 0x00, 0x2e, 0xfb, 0x00, 0xff, 0x10, 0xfe, 0xff, 0x09, 0x30, 0x00, 0x1f, 0xf0, 0x00,
+    0x03, 0xff, 0x70, 0xff, 0x10, 0xfe, 0xff, 0x09, 0x30, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x5f, 0xd0,
+    0xff, 0x10, 0xfe, 0xff, 0x09, 0x51, 0x11, 0x3f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x10, 0xfb,
+    0xff, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x10, 0x7f, 0xfc, 0xff, 0x06, 0x70, 0x00, 0x00,
+    0x1f, 0xf0, 0xff, 0x10, 0xf8, 0x00, 0x03, 0x1f, 0xf0, 0xff, 0x10, 0xf8, 0x00, 0x03, 0x1f, 0xf0,
+    0xff, 0x10, 0xf8, 0x00, 0x03, 0x1f, 0xf0, 0xff, 0x10, 0xf8, 0x00, 0x04, 0x1f, 0xf0, 0xff, 0x10,
+    0x9f, 0xfa, 0xff, 0x04, 0x80, 0x1f, 0xf0, 0xff, 0x10, 0xf9, 0xff, 0x06, 0xf0, 0x1f, 0xf0, 0xff,
+    0x10, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x1f, 0xf0, 0x1f, 0xf0, 0xff, 0x10, 0xff, 0x10, 0xfc, 0x00,
+    0x07, 0x1f, 0xf0, 0x1f, 0xf0, 0xff, 0x10, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x1f, 0xf0, 0x1f, 0xf0,
+    0xff, 0x10, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x1f, 0xf0, 0x1f, 0xf0, 0xff, 0x10, 0xff, 0x10, 0xfc,
+    0x00, 0x07, 0x1f, 0xf0, 0x1f, 0xf0, 0xff, 0x10, 0xff, 0x10, 0xfc, 0x00, 0x03, 0x1f, 0xf0, 0x1f,
+    0xf0, 0xf5, 0xff, 0x01, 0xf0, 0x8f, 0xf6, 0xff, 0x00, 0x80, 0xda, 0x00,
 
     /*Unicode: U+f0e7 () , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x09, 0xee, 0xee, 0xec, 0x00, 0x00, 0x00,  //...%@@@@@@.....
-    0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,  //...@@@@@@@.....
-    0x00, 0x3f, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00,  //...@@@@@@+.....
-    0x00, 0x7f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,  //..+@@@@@@......
-    0x00, 0xaf, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00,  //..%@@@@@%......
-    0x00, 0xef, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //..@@@@@@+......
-    0x02, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@.......
-    0x06, 0xff, 0xff, 0xf8, 0x00, 0x48, 0xcf, 0x60,  //.+@@@@@%..+%@@+
-    0x0a, 0xff, 0xff, 0xfa, 0xcf, 0xff, 0xff, 0x20,  //.%@@@@@%@@@@@@.
-    0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00,  //.@@@@@@@@@@@@%.
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00,  //.@@@@@@@@@@@@..
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //+@@@@@@@@@@@%..
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //%@@@@@@@@@@@+..
-    0xdf, 0xff, 0xd9, 0x5a, 0xff, 0xfc, 0x00, 0x00,  //@@@@@%+%@@@@...
-    0x99, 0x51, 0x00, 0x0d, 0xff, 0xf5, 0x00, 0x00,  //%%+....@@@@+...
-    0x00, 0x00, 0x00, 0x1f, 0xff, 0xd0, 0x00, 0x00,  //.......@@@@....
-    0x00, 0x00, 0x00, 0x5f, 0xff, 0x60, 0x00, 0x00,  //......+@@@+....
-    0x00, 0x00, 0x00, 0x9f, 0xfe, 0x00, 0x00, 0x00,  //......%@@@.....
-    0x00, 0x00, 0x00, 0xdf, 0xf7, 0x00, 0x00, 0x00,  //......@@@+.....
-    0x00, 0x00, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-    0x00, 0x00, 0x04, 0xff, 0x80, 0x00, 0x00, 0x00,  //.....+@@%......
-    0x00, 0x00, 0x08, 0xff, 0x10, 0x00, 0x00, 0x00,  //.....%@@.......
-    0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00, 0x00, 0x00,  //.....@@%.......
-    0x00, 0x00, 0x0f, 0xf2, 0x00, 0x00, 0x00, 0x00,  //.....@@........
-    0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x00,  //....+@%........
-    0x00, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x00, 0x00,  //....%@.........
-    0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xf0, 0x00, 0x03, 0x09, 0xee, 0xee, 0xec, 0xfd, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xfc, 0xfd, 0x00,
+    0x03, 0x3f, 0xff, 0xff, 0xf6, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0xaf,
+    0xff, 0xff, 0xa0, 0xfd, 0x00, 0x03, 0xef, 0xff, 0xff, 0x40, 0xfe, 0x00, 0x03, 0x02, 0xff, 0xff,
+    0xfe, 0xfd, 0x00, 0x10, 0x06, 0xff, 0xff, 0xf8, 0x00, 0x48, 0xcf, 0x60, 0x0a, 0xff, 0xff, 0xfa,
+    0xcf, 0xff, 0xff, 0x20, 0x0e, 0xfc, 0xff, 0x02, 0xfa, 0x00, 0x2f, 0xfc, 0xff, 0x02, 0xf3, 0x00,
+    0x6f, 0xfc, 0xff, 0x02, 0xb0, 0x00, 0xaf, 0xfc, 0xff, 0x0f, 0x40, 0x00, 0xdf, 0xff, 0xd9, 0x5a,
+    0xff, 0xfc, 0x00, 0x00, 0x99, 0x51, 0x00, 0x0d, 0xff, 0xf5, 0xfc, 0x00, 0x02, 0x1f, 0xff, 0xd0,
+    0xfc, 0x00, 0x02, 0x5f, 0xff, 0x60, 0xfc, 0x00, 0x01, 0x9f, 0xfe, 0xfb, 0x00, 0x01, 0xdf, 0xf7,
+    0xfc, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x04, 0xff, 0x80, 0xfc, 0x00, 0x02, 0x08,
+    0xff, 0x10, 0xfc, 0x00, 0x01, 0x0c, 0xf9, 0xfb, 0x00, 0x01, 0x0f, 0xf2, 0xfb, 0x00, 0x01, 0x4f,
+    0xa0, 0xfb, 0x00, 0x01, 0x8f, 0x30, 0xfb, 0x00, 0x00, 0x9b, 0xf4, 0x00,
 
     /*Unicode: U+f0f3 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............+%+............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0xf7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x01, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //....%@@@@@@@@@@@@@@@@@+....
-    0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@@@@@%...
-    0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00,  //...@@@@@@@@@@@@@@@@@@@@@...
-    0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //..@@@@@@@@@@@@@@@@@@@@@@%..
-    0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@%.
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x3c, 0xee, 0xee, 0xee, 0xef, 0xef, 0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xec, 0x20,  //.@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x09, 0xbb, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%%%@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x05, 0xf5, 0xef, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@+@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x58, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@+%@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xef, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@@@%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xfb, 0x00, 0x01, 0x6b, 0x50, 0xf5, 0x00, 0x01, 0xff, 0xf0, 0xf6, 0x00, 0x03, 0x37, 0xff, 0xf7,
+    0x30, 0xf8, 0x00, 0x00, 0x4d, 0xfe, 0xff, 0x01, 0xfc, 0x30, 0xfa, 0x00, 0x00, 0x07, 0xfc, 0xff,
+    0x00, 0xf6, 0xfa, 0x00, 0x00, 0x5f, 0xfb, 0xff, 0x00, 0x40, 0xfc, 0x00, 0x01, 0x01, 0xef, 0xfb,
+    0xff, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x00, 0xf6, 0xfc, 0x00, 0x00, 0x0b, 0xfa,
+    0xff, 0x00, 0xfa, 0xfc, 0x00, 0x00, 0x0c, 0xfa, 0xff, 0x00, 0xfb, 0xfc, 0x00, 0x00, 0x0d, 0xfa,
+    0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x0e, 0xfa, 0xff, 0x00, 0xfd, 0xfc, 0x00, 0x00, 0x0f, 0xfa,
+    0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0xfc, 0x00, 0x00, 0x4f, 0xf9, 0xff, 0x00,
+    0x30, 0xfd, 0x00, 0x00, 0x8f, 0xf9, 0xff, 0x00, 0x70, 0xfd, 0x00, 0x00, 0xcf, 0xf9, 0xff, 0x00,
+    0xb0, 0xfe, 0x00, 0x00, 0x03, 0xf8, 0xff, 0x00, 0xf2, 0xfe, 0x00, 0x00, 0x0a, 0xf8, 0xff, 0x00,
+    0xf9, 0xfe, 0x00, 0x00, 0x2f, 0xf7, 0xff, 0x03, 0x10, 0x00, 0x00, 0xcf, 0xf7, 0xff, 0x02, 0xb0,
+    0x00, 0x09, 0xf6, 0xff, 0x02, 0xf8, 0x00, 0x9f, 0xf5, 0xff, 0x01, 0x80, 0xdf, 0xf5, 0xff, 0x01,
+    0xc0, 0x3c, 0xfe, 0xee, 0x01, 0xef, 0xef, 0xfe, 0xff, 0xfe, 0xee, 0x01, 0xec, 0x20, 0xfd, 0x00,
+    0x04, 0x09, 0xbb, 0xff, 0xff, 0xf8, 0xf8, 0x00, 0x04, 0x05, 0xf5, 0xef, 0xff, 0xf4, 0xf7, 0x00,
+    0x03, 0xbd, 0x58, 0xff, 0xa0, 0xf7, 0x00, 0x02, 0x08, 0xef, 0xe8, 0xed, 0x00,
 
     /*Unicode: U+f11c () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0xff, 0x10, 0xdf, 0x00, 0xef, 0xe0, 0x0f, 0xe0, 0x0f, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xff, 0x10, 0xff, 0x00, 0xdf, 0x00, 0xef, 0xe0, 0x0f, 0xe0, 0x0f, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf1,  //@@.......................@@..@@.
-    0xff, 0x10, 0x01, 0x11, 0x00, 0x11, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x2f, 0xf0, 0x0f, 0xf1,  //@@.......................@@..@@.
-    0xff, 0x10, 0xff, 0xff, 0x20, 0xff, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x2f, 0xff, 0xf0, 0x0f, 0xf1,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xff, 0x10, 0xff, 0xff, 0x10, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x1f, 0xff, 0xf0, 0x0f, 0xf1,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0x01, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x10, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x10, 0xff, 0x10, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xff, 0x10, 0xff, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1,  //@@...........................@@.
-    0xff, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xf1,  //@@...........................@@.
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xa1, 0x00, 0x00, 0x3d, 0xf4, 0xff, 0x02, 0xfe, 0x40, 0xdf, 0xf3, 0xff, 0x02, 0xe0, 0xff, 0x20,
+    0xf5, 0x00, 0x03, 0x0f, 0xf1, 0xff, 0x10, 0xf5, 0x00, 0x33, 0x0f, 0xf1, 0xff, 0x10, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0x10,
+    0xdf, 0x00, 0xef, 0xe0, 0x0f, 0xe0, 0x0f, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0x00,
+    0xdf, 0x00, 0xef, 0xe0, 0x0f, 0xe0, 0x0f, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xf7, 0x00,
+    0x35, 0x0f, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0x01, 0x11, 0x00, 0x11, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x2f, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0xff, 0x20, 0xff, 0x00, 0x1f, 0xf0, 0x1f, 0xf0,
+    0x2f, 0xff, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0xff, 0x10, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x1f, 0xff, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xf5, 0x00, 0x06, 0x0f, 0xf1, 0xff, 0x10, 0x01, 0x00,
+    0x01, 0xfb, 0x11, 0x09, 0x00, 0x01, 0x10, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0x10, 0xdf, 0xfb, 0xff,
+    0x09, 0xd0, 0x0f, 0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xff, 0x00, 0xdf, 0xfb, 0xff, 0x06, 0xd0, 0x0f,
+    0xf0, 0x0f, 0xf1, 0xff, 0x10, 0xf5, 0x00, 0x03, 0x0f, 0xf1, 0xff, 0x21, 0xf5, 0x11, 0x02, 0x1f,
+    0xf1, 0xdf, 0xf3, 0xff, 0x01, 0xe0, 0x3d, 0xf4, 0xff, 0x01, 0xfe, 0x40, 0xb1, 0x00,
 
     /*Unicode: U+f124 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40,  //.....................%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xb0,  //...................%@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0x50,  //.................%@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xfc, 0x00,  //...............%@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xff, 0xf5, 0x00,  //.............%@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //...........%@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00,  //.........%@@@@@@@@@@+..
-    0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,  //.......%@@@@@@@@@@@@...
-    0x00, 0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00,  //.....%@@@@@@@@@@@@@+...
-    0x00, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@....
-    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@+....
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@.....
-    0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,  //+%%%%%%%%%@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,  //..........%@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //..........%@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,  //..........%@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xc7, 0x00, 0x01, 0x39, 0x40, 0xf8, 0x00, 0x02, 0x3b, 0xff, 0xb0, 0xf9, 0x00, 0x03, 0x3b, 0xff,
+    0xff, 0x50, 0xfa, 0x00, 0x03, 0x3b, 0xff, 0xff, 0xfc, 0xfa, 0x00, 0x00, 0x3b, 0xfe, 0xff, 0x00,
+    0xf5, 0xfb, 0x00, 0x00, 0x3b, 0xfd, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0x00, 0x3b, 0xfc, 0xff, 0x00,
+    0x50, 0xfd, 0x00, 0x00, 0x3b, 0xfc, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x3b, 0xfb, 0xff, 0x00,
+    0xf5, 0xfe, 0x00, 0x00, 0x3b, 0xfa, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x2b, 0xf9, 0xff, 0x03, 0x50,
+    0x00, 0x00, 0xef, 0xfa, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x7b, 0xfd, 0xbb, 0x03, 0xef, 0xff,
+    0xff, 0xf4, 0xf9, 0x00, 0x03, 0xaf, 0xff, 0xff, 0xc0, 0xf9, 0x00, 0x03, 0xaf, 0xff, 0xff, 0x40,
+    0xf9, 0x00, 0x02, 0xaf, 0xff, 0xfc, 0xf8, 0x00, 0x02, 0xaf, 0xff, 0xf4, 0xf8, 0x00, 0x02, 0xaf,
+    0xff, 0xc0, 0xf8, 0x00, 0x02, 0xaf, 0xff, 0x40, 0xf8, 0x00, 0x01, 0xaf, 0xfc, 0xf7, 0x00, 0x01,
+    0xaf, 0xf4, 0xf7, 0x00, 0x01, 0xaf, 0xc0, 0xf7, 0x00, 0x01, 0x6f, 0x40, 0xd8, 0x00,
 
     /*Unicode: U+f15b () , Width: 25 */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x10, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@@@@@@+..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x68, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+%.......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0x80, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@%......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0xf8, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@%.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0xff, 0x80, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0xff, 0xf8, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0xff, 0xff, 0x80, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6f, 0xff, 0xff, 0xf8, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@@%.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x14, 0x44, 0x44, 0x44, 0x00,  //@@@@@@@@@@@@@@+..+++++++.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa, 0x80,  //@@@@@@@@@@@@@@@@%%%%%%%%%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x00, 0x7f, 0xfb, 0xff, 0x01, 0x70, 0x10, 0xfd, 0x00, 0xfa, 0xff, 0x01, 0x70, 0x68, 0xfd, 0x00,
+    0xfa, 0xff, 0x02, 0x70, 0x6f, 0x80, 0xfe, 0x00, 0xfa, 0xff, 0x02, 0x70, 0x6f, 0xf8, 0xfe, 0x00,
+    0xfa, 0xff, 0x05, 0x70, 0x6f, 0xff, 0x80, 0x00, 0x00, 0xfa, 0xff, 0x05, 0x70, 0x6f, 0xff, 0xf8,
+    0x00, 0x00, 0xfa, 0xff, 0x05, 0x70, 0x6f, 0xff, 0xff, 0x80, 0x00, 0xfa, 0xff, 0x05, 0x70, 0x6f,
+    0xff, 0xff, 0xf8, 0x00, 0xfa, 0xff, 0x01, 0x70, 0x14, 0xfe, 0x44, 0x00, 0x00, 0xfa, 0xff, 0x00,
+    0xb0, 0xfc, 0x00, 0xfa, 0xff, 0x00, 0xfc, 0xfd, 0xaa, 0x00, 0x80, 0xf5, 0xff, 0x00, 0xd0, 0xf5,
+    0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5,
+    0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5,
+    0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5,
+    0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x00, 0xd0, 0xf5, 0xff, 0x01, 0xd0, 0x7f,
+    0xf6, 0xff, 0x00, 0x60, 0xf4, 0x00,
 
     /*Unicode: U+f1eb () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbd, 0xef, 0xfe, 0xca, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+%%@@@@@@%+...........
-    0x00, 0x00, 0x00, 0x04, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0x00, 0x00, 0x00,  //.......+%@@@@@@@@@@@@@@%........
-    0x00, 0x00, 0x05, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@%......
-    0x00, 0x02, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00,  //....%@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x5f, 0xff, 0xff, 0xff, 0xfb, 0x75, 0x32, 0x23, 0x58, 0xcf, 0xff, 0xff, 0xff, 0xd3, 0x00,  //..+@@@@@@@@%++....+%@@@@@@@@@...
-    0x08, 0xff, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8f, 0xff, 0xff, 0xff, 0x50,  //.%@@@@@@@+............%@@@@@@@+.
-    0x8f, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x01, 0x9f, 0xff, 0xff, 0xf5,  //%@@@@@@+................%@@@@@@+
-    0xcf, 0xff, 0xfc, 0x10, 0x00, 0x38, 0xcf, 0xff, 0xff, 0xeb, 0x72, 0x00, 0x03, 0xef, 0xff, 0xf9,  //@@@@@@.....%@@@@@@@%+.....@@@@@%
-    0x1e, 0xff, 0x90, 0x00, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x1c, 0xff, 0xb0,  //.@@@%...+@@@@@@@@@@@@@@+...@@@%.
-    0x02, 0xd7, 0x00, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0xab, 0x00,  //..@+..+@@@@@@@@@@@@@@@@@@...%%..
-    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xfd, 0x84, 0x10, 0x02, 0x48, 0xdf, 0xff, 0xff, 0xf3, 0x00, 0x00,  //....+@@@@@@@%+....+%@@@@@@@.....
-    0x00, 0x00, 0x1d, 0xff, 0xfc, 0x40, 0x00, 0x01, 0x10, 0x00, 0x06, 0xdf, 0xff, 0xa0, 0x00, 0x00,  //.....@@@@@...........+@@@@%.....
-    0x00, 0x00, 0x01, 0xce, 0x50, 0x02, 0x8d, 0xff, 0xff, 0xc7, 0x10, 0x09, 0xfa, 0x00, 0x00, 0x00,  //......@@+...%@@@@@%+...%@%......
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x10, 0x00, 0x00, 0x00,  //..........%@@@@@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xe8, 0x30, 0x04, 0x9f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@%....%@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+........+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xea, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............%@@%..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%@@@@+.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............@@@%..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............%%...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xdc, 0x00, 0x05, 0x48, 0xbd, 0xef, 0xfe, 0xca, 0x73, 0xf9, 0x00, 0x01, 0x04, 0xaf, 0xfb, 0xff,
+    0x01, 0xe8, 0x20, 0xfc, 0x00, 0x01, 0x05, 0xcf, 0xf9, 0xff, 0x01, 0xfb, 0x30, 0xfe, 0x00, 0x01,
+    0x02, 0xbf, 0xf7, 0xff, 0x00, 0xf9, 0xfe, 0x00, 0x00, 0x5f, 0xfe, 0xff, 0x05, 0xfb, 0x75, 0x32,
+    0x23, 0x58, 0xcf, 0xfe, 0xff, 0x02, 0xd3, 0x00, 0x08, 0xfe, 0xff, 0x00, 0xd6, 0xfc, 0x00, 0x01,
+    0x02, 0x8f, 0xfe, 0xff, 0x04, 0x50, 0x8f, 0xff, 0xff, 0xf7, 0xfe, 0x00, 0x1d, 0x12, 0x10, 0x00,
+    0x00, 0x01, 0x9f, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xfc, 0x10, 0x00, 0x38, 0xcf, 0xff, 0xff, 0xeb,
+    0x72, 0x00, 0x03, 0xef, 0xff, 0xf9, 0x1e, 0xff, 0x90, 0x00, 0x6d, 0xfb, 0xff, 0x08, 0xc4, 0x00,
+    0x1c, 0xff, 0xb0, 0x02, 0xd7, 0x00, 0x4d, 0xf9, 0xff, 0x02, 0xc2, 0x00, 0xab, 0xfe, 0x00, 0x00,
+    0x07, 0xf7, 0xff, 0x00, 0x50, 0xfd, 0x00, 0x0b, 0x7f, 0xff, 0xff, 0xfd, 0x84, 0x10, 0x02, 0x48,
+    0xdf, 0xff, 0xff, 0xf3, 0xfd, 0x00, 0x0b, 0x1d, 0xff, 0xfc, 0x40, 0x00, 0x01, 0x10, 0x00, 0x06,
+    0xdf, 0xff, 0xa0, 0xfd, 0x00, 0x0a, 0x01, 0xce, 0x50, 0x02, 0x8d, 0xff, 0xff, 0xc7, 0x10, 0x09,
+    0xfa, 0xfa, 0x00, 0x01, 0x01, 0xaf, 0xfd, 0xff, 0x02, 0xf8, 0x00, 0x10, 0xfa, 0x00, 0x00, 0x1d,
+    0xfb, 0xff, 0x00, 0xb0, 0xf9, 0x00, 0x00, 0x0c, 0xfb, 0xff, 0x00, 0x90, 0xf8, 0x00, 0x05, 0xcf,
+    0xe8, 0x30, 0x04, 0x9f, 0xf9, 0xf7, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x01, 0x02, 0x60, 0xf6, 0x00,
+    0x03, 0x03, 0xbf, 0xea, 0x20, 0xf5, 0x00, 0x03, 0x09, 0xff, 0xff, 0x60, 0xf4, 0x00, 0x01, 0xcf,
+    0xf9, 0xf3, 0x00, 0x01, 0x0b, 0x80, 0xaa, 0x00,
 
     /*Unicode: U+f240 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x0f, 0xf1, 0x00,  //@@..+++++++++++++++++++++++++++..@@...
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf7, 0x10,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@+..
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x3f, 0xf1,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x3f, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xf0,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xfd, 0x40,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@+.
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf1, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xb5, 0x00, 0x00, 0x1b, 0xf2, 0xff, 0x03, 0xfb, 0x10, 0x00, 0xbf, 0xf1, 0xff, 0x03, 0xb0, 0x00,
+    0xff, 0x31, 0xf3, 0x11, 0x04, 0x2f, 0xf0, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+    0xff, 0x10, 0xf4, 0x66, 0x06, 0x60, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0,
+    0x0f, 0xf7, 0x10, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x0f, 0xff, 0xc0, 0xff, 0x10, 0xef,
+    0xf5, 0xff, 0x06, 0xf0, 0x03, 0x3f, 0xf1, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x00, 0x0e,
+    0xf2, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x00, 0x0e, 0xf2, 0xff, 0x10, 0xef, 0xf5, 0xff,
+    0x06, 0xf0, 0x00, 0x0e, 0xf2, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x00, 0x0e, 0xf2, 0xff,
+    0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x00, 0x0e, 0xf2, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0,
+    0x03, 0x3f, 0xf2, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x06, 0xf0, 0x0f, 0xff, 0xf0, 0xff, 0x10, 0xef,
+    0xf5, 0xff, 0x06, 0xf0, 0x0f, 0xfd, 0x40, 0xff, 0x10, 0xef, 0xf5, 0xff, 0x05, 0xf0, 0x0f, 0xf1,
+    0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x31, 0xf3, 0x11, 0x03, 0x2f, 0xf0,
+    0x00, 0xbf, 0xf1, 0xff, 0x02, 0xc0, 0x00, 0x1b, 0xf2, 0xff, 0x01, 0xfb, 0x20, 0xa1, 0x00,
 
     /*Unicode: U+f241 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x40, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..+++++++++++++++++++++........@@...
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x10,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@+..
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf1,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf2,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x40,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@+.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xb5, 0x00, 0x00, 0x1b, 0xf2, 0xff, 0x03, 0xfb, 0x10, 0x00, 0xbf, 0xf1, 0xff, 0x03, 0xb0, 0x00,
+    0xff, 0x31, 0xf3, 0x11, 0x04, 0x2f, 0xf0, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+    0xff, 0x10, 0xf7, 0x66, 0x00, 0x40, 0xfe, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf7, 0xff,
+    0x00, 0xb0, 0xfe, 0x00, 0x04, 0x0f, 0xf7, 0x10, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfe, 0x00,
+    0x04, 0x0f, 0xff, 0xc0, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x04, 0x03, 0x3f, 0xf1,
+    0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfd, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf7, 0xff, 0x00,
+    0xb0, 0xfd, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfd, 0x00, 0x03, 0x0e,
+    0xf2, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfd, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf7, 0xff,
+    0x00, 0xb0, 0xfd, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x04,
+    0x03, 0x3f, 0xf2, 0xff, 0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0xf0, 0xff,
+    0x10, 0xf7, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x04, 0x0f, 0xfd, 0x40, 0xff, 0x10, 0xf7, 0xff, 0x00,
+    0xb0, 0xfe, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff,
+    0x31, 0xf3, 0x11, 0x03, 0x2f, 0xf0, 0x00, 0xbf, 0xf1, 0xff, 0x02, 0xc0, 0x00, 0x1b, 0xf2, 0xff,
+    0x01, 0xfb, 0x20, 0xa1, 0x00,
 
     /*Unicode: U+f242 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..++++++++++++++...............@@...
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x10,  //@@..@@@@@@@@@@@@@@+..............@@+..
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf1,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf2,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x40,  //@@..@@@@@@@@@@@@@@+..............@@@+.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xb5, 0x00, 0x00, 0x1b, 0xf2, 0xff, 0x03, 0xfb, 0x10, 0x00, 0xbf, 0xf1, 0xff, 0x03, 0xb0, 0x00,
+    0xff, 0x31, 0xf3, 0x11, 0x04, 0x2f, 0xf0, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+    0xff, 0x10, 0xfa, 0x66, 0x00, 0x30, 0xfb, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xfa, 0xff,
+    0x00, 0x70, 0xfb, 0x00, 0x04, 0x0f, 0xf7, 0x10, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfb, 0x00,
+    0x04, 0x0f, 0xff, 0xc0, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfb, 0x00, 0x04, 0x03, 0x3f, 0xf1,
+    0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfa, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfa, 0xff, 0x00,
+    0x70, 0xfa, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfa, 0x00, 0x03, 0x0e,
+    0xf2, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfa, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfa, 0xff,
+    0x00, 0x70, 0xfa, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfb, 0x00, 0x04,
+    0x03, 0x3f, 0xf2, 0xff, 0x10, 0xfa, 0xff, 0x00, 0x70, 0xfb, 0x00, 0x04, 0x0f, 0xff, 0xf0, 0xff,
+    0x10, 0xfa, 0xff, 0x00, 0x70, 0xfb, 0x00, 0x04, 0x0f, 0xfd, 0x40, 0xff, 0x10, 0xfa, 0xff, 0x00,
+    0x70, 0xfb, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff,
+    0x31, 0xf3, 0x11, 0x03, 0x2f, 0xf0, 0x00, 0xbf, 0xf1, 0xff, 0x02, 0xc0, 0x00, 0x1b, 0xf2, 0xff,
+    0x01, 0xfb, 0x20, 0xa1, 0x00,
 
     /*Unicode: U+f243 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x66, 0x66, 0x66, 0x66, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..++++++++.....................@@...
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x10,  //@@..@@@@@@@@+....................@@+..
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0,  //@@..@@@@@@@@+....................@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf1,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf2,  //@@..@@@@@@@@+......................@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,  //@@..@@@@@@@@+....................@@@@.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x40,  //@@..@@@@@@@@+....................@@@+.
-    0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@..@@@@@@@@+....................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xb5, 0x00, 0x00, 0x1b, 0xf2, 0xff, 0x03, 0xfb, 0x10, 0x00, 0xbf, 0xf1, 0xff, 0x03, 0xb0, 0x00,
+    0xff, 0x31, 0xf3, 0x11, 0x04, 0x2f, 0xf0, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+    0xff, 0x10, 0xfd, 0x66, 0x00, 0x10, 0xf8, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xfd, 0xff,
+    0x00, 0x40, 0xf8, 0x00, 0x04, 0x0f, 0xf7, 0x10, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf8, 0x00,
+    0x04, 0x0f, 0xff, 0xc0, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf8, 0x00, 0x04, 0x03, 0x3f, 0xf1,
+    0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf7, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfd, 0xff, 0x00,
+    0x40, 0xf7, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf7, 0x00, 0x03, 0x0e,
+    0xf2, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf7, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfd, 0xff,
+    0x00, 0x40, 0xf7, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf8, 0x00, 0x04,
+    0x03, 0x3f, 0xf2, 0xff, 0x10, 0xfd, 0xff, 0x00, 0x40, 0xf8, 0x00, 0x04, 0x0f, 0xff, 0xf0, 0xff,
+    0x10, 0xfd, 0xff, 0x00, 0x40, 0xf8, 0x00, 0x04, 0x0f, 0xfd, 0x40, 0xff, 0x10, 0xfd, 0xff, 0x00,
+    0x40, 0xf8, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff,
+    0x31, 0xf3, 0x11, 0x03, 0x2f, 0xf0, 0x00, 0xbf, 0xf1, 0xff, 0x02, 0xc0, 0x00, 0x1b, 0xf2, 0xff,
+    0x01, 0xfb, 0x20, 0xa1, 0x00,
 
     /*Unicode: U+f244 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00,  //@@...............................@@+..
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xa0,  //@@...............................@@@%.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf1,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3f, 0xf2,  //@@.................................@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,  //@@...............................@@@@.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x50,  //@@...............................@@@+.
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00,  //@@...............................@@...
-    0xff, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x2f, 0xf0, 0x00,  //@@...............................@@...
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0xb5, 0x00, 0x00, 0x1b, 0xf2, 0xff, 0x03, 0xfb, 0x10, 0x00, 0xbf, 0xf1, 0xff, 0x03, 0xb0, 0x00,
+    0xff, 0x31, 0xf3, 0x11, 0x04, 0x2f, 0xf0, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+    0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf5, 0x00,
+    0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xff, 0xa0, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x03, 0x3f, 0xf1,
+    0xff, 0x10, 0xf2, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf2, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10,
+    0xf2, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf2, 0x00, 0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf2, 0x00,
+    0x03, 0x0e, 0xf2, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x03, 0x3f, 0xf2, 0xff, 0x10, 0xf3, 0x00, 0x04,
+    0x0f, 0xff, 0xf0, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xfe, 0x50, 0xff, 0x10, 0xf3, 0x00, 0x04,
+    0x0f, 0xf1, 0x00, 0xff, 0x10, 0xf3, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0xff, 0x31, 0xf3, 0x11, 0x03,
+    0x2f, 0xf0, 0x00, 0xbf, 0xf1, 0xff, 0x02, 0xc0, 0x00, 0x1b, 0xf2, 0xff, 0x01, 0xfb, 0x20, 0xa1,
+    0x00,
 
     /*Unicode: U+f293 () , Width: 22 */
-    0x00, 0x00, 0x00, 0x5a, 0xde, 0xff, 0xeb, 0x82, 0x00, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00,  //....+@@@@@@@@@@@%.....
-    0x00, 0x08, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xfe, 0x20, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x00, 0x6f, 0xff, 0xff, 0xfb, 0x0b, 0xff, 0xff, 0xff, 0xe0, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x01, 0xff, 0xff, 0xff, 0xfb, 0x00, 0xbf, 0xff, 0xff, 0xf9, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x08, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x10,  //.%@@@@@@@%...%@@@@@@..
-    0x0e, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x70,  //.@@@@@@@@%....%@@@@@+.
-    0x3f, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x50, 0x0a, 0xff, 0xff, 0xb0,  //.@@@@@@@@%..+..%@@@@%.
-    0x7f, 0xff, 0xd1, 0xaf, 0xfb, 0x00, 0xf5, 0x00, 0xaf, 0xff, 0xf0,  //+@@@@.%@@%..@+..%@@@@.
-    0x9f, 0xff, 0x60, 0x0a, 0xfb, 0x00, 0xff, 0x20, 0x0d, 0xff, 0xf2,  //%@@@+..%@%..@@...@@@@.
-    0xcf, 0xff, 0xf5, 0x00, 0xab, 0x00, 0xf7, 0x00, 0x8f, 0xff, 0xf4,  //%@@@@+..%%..@+..%@@@@+
-    0xdf, 0xff, 0xff, 0x50, 0x06, 0x00, 0x70, 0x08, 0xff, 0xff, 0xf6,  //@@@@@@+..+..+..%@@@@@+
-    0xef, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf7,  //@@@@@@@+......%@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@+....%@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@...+@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x08, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@+....%@@@@@@@+
-    0xef, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf7,  //@@@@@@@+......%@@@@@@+
-    0xdf, 0xff, 0xff, 0x50, 0x06, 0x00, 0x70, 0x08, 0xff, 0xff, 0xf6,  //@@@@@@+..+..+..%@@@@@+
-    0xcf, 0xff, 0xf5, 0x00, 0xab, 0x00, 0xf7, 0x00, 0x8f, 0xff, 0xf4,  //%@@@@+..%%..@+..%@@@@+
-    0x9f, 0xff, 0x60, 0x0a, 0xfb, 0x00, 0xff, 0x20, 0x0d, 0xff, 0xf2,  //%@@@+..%@%..@@...@@@@.
-    0x7f, 0xff, 0xd1, 0xaf, 0xfb, 0x00, 0xf5, 0x00, 0xaf, 0xff, 0xf0,  //+@@@@.%@@%..@+..%@@@@.
-    0x3f, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x50, 0x0a, 0xff, 0xff, 0xb0,  //.@@@@@@@@%..+..%@@@@%.
-    0x0e, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x70,  //.@@@@@@@@%....%@@@@@+.
-    0x08, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x10,  //.%@@@@@@@%...%@@@@@@..
-    0x01, 0xff, 0xff, 0xff, 0xfb, 0x00, 0xbf, 0xff, 0xff, 0xf9, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x00, 0x6f, 0xff, 0xff, 0xfb, 0x0b, 0xff, 0xff, 0xff, 0xe0, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x00, 0x08, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xfe, 0x20, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00,  //....+@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x5a, 0xde, 0xff, 0xec, 0x82, 0x00, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................
-
-
+    0xfe, 0x00, 0x04, 0x5a, 0xde, 0xff, 0xeb, 0x82, 0xfc, 0x00, 0x00, 0x5e, 0xfc, 0xff, 0x00, 0xa1,
+    0xfe, 0x00, 0x0f, 0x08, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x6f, 0xff,
+    0xff, 0xfb, 0x0b, 0xfe, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xfe, 0xff, 0x07, 0xfb, 0x00, 0xbf, 0xff,
+    0xff, 0xf9, 0x00, 0x08, 0xfe, 0xff, 0x02, 0xfb, 0x00, 0x0b, 0xfe, 0xff, 0x01, 0x10, 0x0e, 0xfe,
+    0xff, 0x07, 0xfb, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x70, 0x3f, 0xfe, 0xff, 0x36, 0xfb, 0x00, 0x50,
+    0x0a, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xd1, 0xaf, 0xfb, 0x00, 0xf5, 0x00, 0xaf, 0xff, 0xf0, 0x9f,
+    0xff, 0x60, 0x0a, 0xfb, 0x00, 0xff, 0x20, 0x0d, 0xff, 0xf2, 0xcf, 0xff, 0xf5, 0x00, 0xab, 0x00,
+    0xf7, 0x00, 0x8f, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0x50, 0x06, 0x00, 0x70, 0x08, 0xff, 0xff, 0xf6,
+    0xef, 0xff, 0xff, 0xf5, 0xfe, 0x00, 0x03, 0x8f, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0x02, 0x50, 0x00,
+    0x08, 0xfe, 0xff, 0x00, 0xf7, 0xfd, 0xff, 0x02, 0xf1, 0x00, 0x4f, 0xfe, 0xff, 0x00, 0xf8, 0xfd,
+    0xff, 0x02, 0x50, 0x00, 0x08, 0xfe, 0xff, 0x04, 0xf7, 0xef, 0xff, 0xff, 0xf5, 0xfe, 0x00, 0x30,
+    0x8f, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0x50, 0x06, 0x00, 0x70, 0x08, 0xff, 0xff, 0xf6, 0xcf,
+    0xff, 0xf5, 0x00, 0xab, 0x00, 0xf7, 0x00, 0x8f, 0xff, 0xf4, 0x9f, 0xff, 0x60, 0x0a, 0xfb, 0x00,
+    0xff, 0x20, 0x0d, 0xff, 0xf2, 0x7f, 0xff, 0xd1, 0xaf, 0xfb, 0x00, 0xf5, 0x00, 0xaf, 0xff, 0xf0,
+    0x3f, 0xfe, 0xff, 0x07, 0xfb, 0x00, 0x50, 0x0a, 0xff, 0xff, 0xb0, 0x0e, 0xfe, 0xff, 0x07, 0xfb,
+    0x00, 0x00, 0xaf, 0xff, 0xff, 0x70, 0x08, 0xfe, 0xff, 0x02, 0xfb, 0x00, 0x0b, 0xfe, 0xff, 0x01,
+    0x10, 0x01, 0xfe, 0xff, 0x0c, 0xfb, 0x00, 0xbf, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x6f, 0xff, 0xff,
+    0xfb, 0x0b, 0xfe, 0xff, 0x0b, 0xe0, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfc, 0xbf, 0xff, 0xff, 0xfe,
+    0x20, 0xfe, 0x00, 0x00, 0x5e, 0xfc, 0xff, 0x00, 0xa1, 0xfc, 0x00, 0x04, 0x5a, 0xde, 0xff, 0xec,
+    0x82, 0xf3, 0x00,
 
 #elif USE_LV_FONT_SYMBOL_30 == 8
     /*Unicode: U+f001 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x48, 0x94, 0xba, 0x4c,  //.....................+%%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x60, 0xae, 0xf2, 0xff, 0xff, 0xff, 0xee,  //..................+%@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x7a, 0xc8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...............+@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x48, 0x94, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...........+%@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xae, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.........%@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff,  //........@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbc, 0x70, 0x24, 0x12, 0xff, 0xff,  //........@@@@@@@@@@@%+..@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xa2, 0x56, 0x0e, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@@@@@@@%+.....@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x88, 0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@@@@%.........@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x76, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@+............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x24, 0x08, 0x12, 0xff, 0xff,  //........@@.............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0xcc, 0xff, 0xff, 0xff, 0xf8, 0xc0, 0xff, 0xff,  //........@@......+@@@@@%@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x02, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........@@.....@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //........@@....+@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //........@@.....@@@@@@@@@@
-    0x00, 0x44, 0xa2, 0xe8, 0xff, 0xfc, 0xe2, 0x98, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x44,  //.+%@@@@%@@.....%@@@@@@@@+
-    0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x98, 0xd8, 0xf4, 0xec, 0xc4, 0x7a, 0x18, 0x00,  //%@@@@@@@@@.......%@@@@+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@...............
-    0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@+...............
-    0x00, 0x5a, 0xb6, 0xf6, 0xff, 0xff, 0xec, 0xa4, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+%@@@@%.................
-    0x00, 0x00, 0x00, 0x00, 0x16, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xbb, 0x00, 0x04, 0x06, 0x48, 0x94, 0xba, 0x4c, 0xf0, 0x00, 0x03, 0x16, 0x60, 0xae, 0xf2, 0xfe,
+    0xff, 0x00, 0xee, 0xf3, 0x00, 0x03, 0x2e, 0x7a, 0xc8, 0xfc, 0xfa, 0xff, 0xf7, 0x00, 0x03, 0x06,
+    0x48, 0x94, 0xe0, 0xf6, 0xff, 0xf9, 0x00, 0x02, 0x32, 0xae, 0xf2, 0xf3, 0xff, 0xf9, 0x00, 0x00,
+    0xe4, 0xf1, 0xff, 0xf9, 0x00, 0xf0, 0xff, 0xf9, 0x00, 0xf0, 0xff, 0xf9, 0x00, 0xf3, 0xff, 0x02,
+    0xdc, 0xff, 0xff, 0xf9, 0x00, 0xf7, 0xff, 0x06, 0xfa, 0xbc, 0x70, 0x24, 0x12, 0xff, 0xff, 0xf9,
+    0x00, 0xfa, 0xff, 0x03, 0xec, 0xa2, 0x56, 0x0e, 0xfe, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf9, 0x00,
+    0xfd, 0xff, 0x03, 0xd6, 0x88, 0x3c, 0x02, 0xfb, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf9, 0x00, 0x03,
+    0xff, 0xff, 0x76, 0x22, 0xf7, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf9, 0x00, 0x02, 0xff, 0xff, 0x12,
+    0xf6, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf9, 0x00, 0x02, 0xff, 0xff, 0x12, 0xf6, 0x00, 0x02, 0x12,
+    0xff, 0xff, 0xf9, 0x00, 0x02, 0xff, 0xff, 0x12, 0xf6, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf9, 0x00,
+    0x02, 0xff, 0xff, 0x12, 0xfa, 0x00, 0x06, 0x10, 0x2c, 0x24, 0x08, 0x12, 0xff, 0xff, 0xf9, 0x00,
+    0x02, 0xff, 0xff, 0x12, 0xfd, 0x00, 0x02, 0x06, 0x72, 0xcc, 0xfe, 0xff, 0x03, 0xf8, 0xc0, 0xff,
+    0xff, 0xf9, 0x00, 0x02, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x01, 0x02, 0xc4, 0xf8, 0xff, 0xf9, 0x00,
+    0x02, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x00, 0x46, 0xf7, 0xff, 0xfd, 0x00, 0x06, 0x08, 0x04, 0x00,
+    0x00, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x00, 0x38, 0xf8, 0xff, 0x0b, 0xda, 0x00, 0x44, 0xa2, 0xe8,
+    0xff, 0xfc, 0xe2, 0x98, 0xff, 0xff, 0x12, 0xfd, 0x00, 0x00, 0x98, 0xfa, 0xff, 0x02, 0xf2, 0x44,
+    0x92, 0xf8, 0xff, 0x00, 0x12, 0xfc, 0x00, 0x08, 0x3e, 0x98, 0xd8, 0xf4, 0xec, 0xc4, 0x7a, 0x18,
+    0x00, 0xf7, 0xff, 0x00, 0x12, 0xf3, 0x00, 0xf8, 0xff, 0x01, 0xf4, 0x02, 0xf3, 0x00, 0x00, 0xa6,
+    0xf9, 0xff, 0x00, 0x6e, 0xf1, 0x00, 0x07, 0x5a, 0xb6, 0xf6, 0xff, 0xff, 0xec, 0xa4, 0x3e, 0xed,
+    0x00, 0x01, 0x16, 0x12, 0xee, 0x00,
 
     /*Unicode: U+f008 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xba, 0x1e, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf6, 0xff, 0x5a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x64, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x66, 0xff, 0xff, 0x4a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x0a,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x4a, 0x00, 0x00, 0x38, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x38, 0x00, 0x00, 0x38, 0xff, 0xff, 0x12,  //@@+...@@...............@@....@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0x6a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x5a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x12,  //@@+..+@@...............@@+..+@@.
-    0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x6a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x64, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x68, 0xff, 0xff, 0x5a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x12,  //@@+..+@@+.............+@@+..+@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x12,  //@@+...@@+.............+@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x5a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x4a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x12,  //@@+..+@@...............@@+..+@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12,  //@@@@@@@@...............@@@@@@@@.
-    0xff, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x12,  //@@+...@@...............@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@...............@@....@@.
-    0xf6, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x0c,  //@@+...@@+.............+@@....@@.
-    0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x1e, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x26, 0x00,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00, 0x00, 0x00,  //................................
-
+    0xc1, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe8, 0xff, 0x04, 0xf8, 0xba, 0x1e, 0x00, 0xb2, 0xe4, 0xff,
+    0x0a, 0xc4, 0x00, 0xf6, 0xff, 0x5a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x64, 0xf4, 0x0e, 0x0c, 0x66,
+    0xff, 0xff, 0x4a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x0a, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x02, 0xff,
+    0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff,
+    0x12, 0xfe, 0x00, 0x02, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x0b,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x38, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x09, 0x12,
+    0xff, 0xff, 0x38, 0x00, 0x00, 0x38, 0xff, 0xff, 0x12, 0xf9, 0xff, 0x00, 0x0e, 0xf4, 0x00, 0x00,
+    0x12, 0xf9, 0xff, 0x00, 0x12, 0xf9, 0xff, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x12, 0xf9, 0xff, 0x09,
+    0x12, 0xff, 0xff, 0x6a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x0c, 0x12, 0xff, 0xff,
+    0x5a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x12, 0xff, 0xff, 0x14, 0xfe, 0x00, 0x02, 0xff, 0xff, 0x0e,
+    0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfe,
+    0x00, 0x02, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0xff,
+    0x12, 0xff, 0xff, 0x14, 0xfe, 0x00, 0x02, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff,
+    0xfd, 0x00, 0x0b, 0xff, 0xff, 0x12, 0xff, 0xff, 0x6a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x64, 0xf4,
+    0x12, 0x09, 0x68, 0xff, 0xff, 0x5a, 0x12, 0x12, 0x5a, 0xff, 0xff, 0x12, 0xe2, 0xff, 0x00, 0x12,
+    0xe2, 0xff, 0x09, 0x12, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x4e, 0xf4, 0x00, 0x0c,
+    0x52, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x02,
+    0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff,
+    0xff, 0x12, 0xfe, 0x00, 0x02, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00,
+    0x0b, 0xff, 0xff, 0x12, 0xff, 0xff, 0x5a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x09,
+    0x12, 0xff, 0xff, 0x4a, 0x0e, 0x0e, 0x4a, 0xff, 0xff, 0x12, 0xf9, 0xff, 0x00, 0x0e, 0xf4, 0x00,
+    0x00, 0x12, 0xf9, 0xff, 0x00, 0x12, 0xf9, 0xff, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x12, 0xf9, 0xff,
+    0x09, 0x12, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x0c, 0x12, 0xff,
+    0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x02, 0xff, 0xff,
+    0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12,
+    0xfe, 0x00, 0x02, 0xff, 0xff, 0x0e, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0xff,
+    0xff, 0x12, 0xf6, 0xff, 0x4c, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x4e, 0xf4, 0x00, 0x0a, 0x52, 0xff,
+    0xff, 0x3a, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x0c, 0xba, 0xe4, 0xff, 0x04, 0xcc, 0x00, 0x1e, 0xc2,
+    0xfc, 0xe7, 0xff, 0x01, 0xca, 0x26, 0xfe, 0x00, 0x00, 0x08, 0xe8, 0x0e, 0x00, 0x08, 0xfe, 0x00,
 
     /*Unicode: U+f00b () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xba, 0x06, 0x00, 0x36, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7e,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x10, 0x00, 0x52, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0x00, 0x2a, 0x32, 0x32, 0x32, 0x32, 0x30, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2a, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x02, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2e, 0x02,  //.............................
-    0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x10, 0x00, 0x54, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xba, 0x06, 0x00, 0x36, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7e,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x02, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x2e, 0x02,  //.............................
-    0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x10, 0x00, 0x54, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae,  //%@@@@@@@..+@@@@@@@@@@@@@@@@@%
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.%@@@@@@@@@@@@@@@@@@
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@..%@@@@@@@@@@@@@@@@@@
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xba, 0x06, 0x00, 0x36, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7e,  //+@@@@@@%...@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xc7, 0x00, 0x01, 0x7e, 0xf6, 0xfd, 0xff, 0x05, 0xfc, 0xba, 0x06, 0x00, 0x36, 0xe4, 0xf2, 0xff,
+    0x02, 0xf6, 0x7e, 0xf6, 0xfa, 0xff, 0x02, 0x3e, 0x00, 0x9a, 0xf0, 0xff, 0x00, 0xf6, 0xf9, 0xff,
+    0x02, 0x46, 0x00, 0xa2, 0xe7, 0xff, 0x02, 0x46, 0x00, 0xa2, 0xef, 0xff, 0x00, 0xfc, 0xfa, 0xff,
+    0x02, 0x44, 0x00, 0xa0, 0xf0, 0xff, 0x01, 0xfc, 0xac, 0xfb, 0xff, 0x04, 0xe2, 0x10, 0x00, 0x52,
+    0xfc, 0xf1, 0xff, 0x02, 0xac, 0x00, 0x2a, 0xfd, 0x32, 0x01, 0x30, 0x0a, 0xfe, 0x00, 0x00, 0x1a,
+    0xf2, 0x32, 0x00, 0x2a, 0xe3, 0x00, 0x01, 0x02, 0x2e, 0xfd, 0x36, 0x01, 0x34, 0x0c, 0xfe, 0x00,
+    0x00, 0x1e, 0xf2, 0x36, 0x02, 0x2e, 0x02, 0xae, 0xfb, 0xff, 0x04, 0xe4, 0x10, 0x00, 0x54, 0xfc,
+    0xf1, 0xff, 0x01, 0xae, 0xfc, 0xfa, 0xff, 0x02, 0x44, 0x00, 0xa0, 0xf0, 0xff, 0x00, 0xfc, 0xf9,
+    0xff, 0x02, 0x46, 0x00, 0xa2, 0xe7, 0xff, 0x02, 0x46, 0x00, 0xa2, 0xef, 0xff, 0x00, 0xf6, 0xfa,
+    0xff, 0x02, 0x3e, 0x00, 0x9a, 0xf0, 0xff, 0x02, 0xf6, 0x7e, 0xf6, 0xfd, 0xff, 0x05, 0xfc, 0xba,
+    0x06, 0x00, 0x36, 0xe4, 0xf2, 0xff, 0x01, 0xf6, 0x7e, 0xe4, 0x00, 0x01, 0x02, 0x2e, 0xfd, 0x36,
+    0x01, 0x34, 0x0c, 0xfe, 0x00, 0x00, 0x1e, 0xf2, 0x36, 0x02, 0x2e, 0x02, 0xae, 0xfb, 0xff, 0x04,
+    0xe4, 0x10, 0x00, 0x54, 0xfc, 0xf1, 0xff, 0x01, 0xae, 0xfc, 0xfa, 0xff, 0x02, 0x44, 0x00, 0xa0,
+    0xf0, 0xff, 0x00, 0xfc, 0xf9, 0xff, 0x02, 0x46, 0x00, 0xa2, 0xe7, 0xff, 0x02, 0x46, 0x00, 0xa2,
+    0xef, 0xff, 0x00, 0xf6, 0xfa, 0xff, 0x02, 0x3e, 0x00, 0x9a, 0xf0, 0xff, 0x02, 0xf6, 0x7e, 0xf6,
+    0xfd, 0xff, 0x05, 0xfc, 0xba, 0x06, 0x00, 0x36, 0xe4, 0xf2, 0xff, 0x01, 0xf6, 0x7e, 0x81, 0x00,
+    0xf0, 0x00,
 
     /*Unicode: U+f00c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x62, 0x0c, 0x00, 0x00,  //.....................+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xce, 0x12, 0x00,  //...................+@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xce, 0x12,  //..................+@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,  //.................+@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //................+@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78,  //...............+@@@@@@@@+
-    0x00, 0x00, 0x1c, 0x86, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00,  //...%+.........+@@@@@@@@+.
-    0x00, 0x22, 0xe2, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00,  //..@@@+.......+@@@@@@@@+..
-    0x22, 0xe2, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00,  //.@@@@@+.....+@@@@@@@@+...
-    0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+...+@@@@@@@@+....
-    0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@+.+@@@@@@@@+.....
-    0x5a, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@%@@@@@@@@+......
-    0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@@@@@@@@+.......
-    0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@@@@@@@@@@@+........
-    0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@+............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@+.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xb6, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+%+..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x81, 0x00, 0xf0, 0x00, 0x02, 0x32, 0x62, 0x0c, 0xec, 0x00, 0x04, 0x52, 0xfa, 0xff, 0xce, 0x12,
+    0xee, 0x00, 0x01, 0x52, 0xfa, 0xfe, 0xff, 0x01, 0xce, 0x12, 0xf0, 0x00, 0x01, 0x52, 0xfa, 0xfc,
+    0xff, 0x00, 0xc2, 0xf1, 0x00, 0x01, 0x52, 0xfa, 0xfb, 0xff, 0x00, 0xf8, 0xf2, 0x00, 0x01, 0x52,
+    0xfa, 0xfa, 0xff, 0x05, 0x78, 0x00, 0x00, 0x1c, 0x86, 0x50, 0xf8, 0x00, 0x01, 0x52, 0xfa, 0xfa,
+    0xff, 0x07, 0x7e, 0x00, 0x00, 0x22, 0xe2, 0xff, 0xff, 0x6e, 0xfa, 0x00, 0x01, 0x52, 0xfa, 0xfa,
+    0xff, 0x04, 0x7e, 0x00, 0x00, 0x22, 0xe2, 0xfd, 0xff, 0x00, 0x6e, 0xfc, 0x00, 0x01, 0x52, 0xfa,
+    0xfa, 0xff, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0xd6, 0xfb, 0xff, 0x00, 0x6e, 0xfe, 0x00, 0x01, 0x52,
+    0xfa, 0xfa, 0xff, 0x00, 0x7e, 0xfd, 0x00, 0x00, 0xf2, 0xfa, 0xff, 0x03, 0x6e, 0x00, 0x52, 0xfa,
+    0xfa, 0xff, 0x00, 0x7e, 0xfc, 0x00, 0x01, 0x5a, 0xfc, 0xfa, 0xff, 0x01, 0xa0, 0xfa, 0xfa, 0xff,
+    0x00, 0x7e, 0xfa, 0x00, 0x01, 0x5c, 0xfc, 0xf3, 0xff, 0x00, 0x7e, 0xf8, 0x00, 0x01, 0x5c, 0xfc,
+    0xf5, 0xff, 0x00, 0x7e, 0xf6, 0x00, 0x01, 0x5c, 0xfc, 0xf7, 0xff, 0x00, 0x7e, 0xf4, 0x00, 0x01,
+    0x5c, 0xfc, 0xf9, 0xff, 0x00, 0x7e, 0xf2, 0x00, 0x01, 0x5c, 0xfc, 0xfb, 0xff, 0x00, 0x7e, 0xf0,
+    0x00, 0x01, 0x5c, 0xfc, 0xfd, 0xff, 0x00, 0x7e, 0xee, 0x00, 0x04, 0x5c, 0xfc, 0xff, 0xff, 0x7c,
+    0xec, 0x00, 0x02, 0x4e, 0xb6, 0x66, 0x81, 0x00, 0xf6, 0x00,
 
     /*Unicode: U+f00d () , Width: 20 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x8c, 0xf2, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xbe, 0xee, 0x62, 0x00, 0x00,  //...%@%.........%@+..
-    0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xce, 0xff, 0xff, 0xfc, 0x64, 0x00,  //..%@@@%.......@@@@+.
-    0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x12, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5e,  //.%@@@@@%.....@@@@@@+
-    0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x02, 0x00, 0x12, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,  //.@@@@@@@%...@@@@@@@@
-    0x0e, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x16, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //.@@@@@@@@%.@@@@@@@@%
-    0x00, 0x32, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x14,  //..@@@@@@@@@@@@@@@@@.
-    0x00, 0x00, 0x32, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x14, 0x00,  //...@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x32, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x14, 0x00, 0x00,  //....@@@@@@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x32, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x14, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x18, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x12, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x02, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x12, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x02, 0x00, 0x00,  //....@@@@@@@@@@@@%...
-    0x00, 0x00, 0x10, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x02, 0x00,  //...@@@@@@@@@@@@@@%..
-    0x00, 0x10, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x02,  //..@@@@@@@@@@@@@@@@%.
-    0x04, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x46, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96,  //.@@@@@@@@@+@@@@@@@@%
-    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x14, 0x00, 0x30, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,  //.@@@@@@@@...@@@@@@@@
-    0x02, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x14, 0x00, 0x00, 0x00, 0x30, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@.....@@@@@@%
-    0x00, 0x0e, 0xc6, 0xff, 0xff, 0xff, 0xd2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xec, 0xff, 0xff, 0xff, 0x9e, 0x00,  //..@@@@@.......@@@@%.
-    0x00, 0x00, 0x0e, 0xc4, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xea, 0xff, 0x9c, 0x00, 0x00,  //...@@@.........@@%..
-    0x00, 0x00, 0x00, 0x02, 0x2e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2a, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................
-
+    0x86, 0x00, 0x03, 0x8c, 0xf2, 0x9c, 0x02, 0xfa, 0x00, 0x03, 0x12, 0xbe, 0xee, 0x62, 0xfd, 0x00,
+    0x00, 0x98, 0xfe, 0xff, 0x01, 0xa8, 0x02, 0xfc, 0x00, 0x08, 0x12, 0xce, 0xff, 0xff, 0xfc, 0x64,
+    0x00, 0x00, 0x96, 0xfc, 0xff, 0x01, 0xa8, 0x02, 0xfe, 0x00, 0x01, 0x12, 0xce, 0xfd, 0xff, 0x02,
+    0xfc, 0x5e, 0x26, 0xfa, 0xff, 0x04, 0xa8, 0x02, 0x00, 0x12, 0xce, 0xfb, 0xff, 0x02, 0xec, 0x0e,
+    0xea, 0xfa, 0xff, 0x02, 0xa6, 0x16, 0xce, 0xfa, 0xff, 0x03, 0xc0, 0x00, 0x32, 0xee, 0xfa, 0xff,
+    0x00, 0xf2, 0xfa, 0xff, 0x05, 0xd4, 0x14, 0x00, 0x00, 0x32, 0xee, 0xf4, 0xff, 0x01, 0xd4, 0x14,
+    0xfd, 0x00, 0x01, 0x32, 0xee, 0xf6, 0xff, 0x01, 0xd4, 0x14, 0xfb, 0x00, 0x01, 0x32, 0xee, 0xf8,
+    0xff, 0x01, 0xd4, 0x14, 0xf9, 0x00, 0x00, 0x46, 0xf9, 0xff, 0x01, 0xf4, 0x18, 0xf9, 0x00, 0x01,
+    0x12, 0xce, 0xf8, 0xff, 0x01, 0xa4, 0x02, 0xfb, 0x00, 0x01, 0x12, 0xce, 0xf6, 0xff, 0x01, 0xa4,
+    0x02, 0xfd, 0x00, 0x01, 0x10, 0xce, 0xf4, 0xff, 0x05, 0xa4, 0x02, 0x00, 0x00, 0x10, 0xcc, 0xf2,
+    0xff, 0x03, 0xa4, 0x02, 0x04, 0xca, 0xfa, 0xff, 0x02, 0xd0, 0x46, 0xec, 0xfa, 0xff, 0x01, 0x96,
+    0x2a, 0xfa, 0xff, 0x04, 0xd2, 0x14, 0x00, 0x30, 0xec, 0xfb, 0xff, 0x02, 0xf2, 0x02, 0xc4, 0xfc,
+    0xff, 0x01, 0xd2, 0x14, 0xfe, 0x00, 0x01, 0x30, 0xec, 0xfc, 0xff, 0x03, 0x90, 0x00, 0x0e, 0xc6,
+    0xfe, 0xff, 0x01, 0xd2, 0x14, 0xfc, 0x00, 0x01, 0x30, 0xec, 0xfe, 0xff, 0x00, 0x9e, 0xfe, 0x00,
+    0x04, 0x0e, 0xc4, 0xff, 0xd0, 0x14, 0xfa, 0x00, 0x03, 0x30, 0xea, 0xff, 0x9c, 0xfc, 0x00, 0x02,
+    0x02, 0x2e, 0x06, 0xf8, 0x00, 0x01, 0x0e, 0x2a, 0xae, 0x00,
 
     /*Unicode: U+f011 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xdc, 0xe6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xf4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0x82, 0x9e, 0x36, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x26, 0x98, 0x8e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%%...@@@@...%%......
-    0x00, 0x00, 0x00, 0x1c, 0xd2, 0xff, 0xff, 0xf2, 0x14, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x04, 0xde, 0xff, 0xff, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x00,  //....@@@@..@@@@..@@@@.....
-    0x00, 0x00, 0x14, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x16, 0xff, 0xff, 0xff, 0xff, 0xea, 0x24, 0x00, 0x00, 0x00,  //...@@@@@..@@@@..@@@@@....
-    0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x06, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x06, 0x00, 0x00,  //..%@@@@@..@@@@..%@@@@@...
-    0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x1a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x0e, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00,  //.+@@@@@...@@@@...@@@@@+..
-    0x00, 0xdc, 0xff, 0xff, 0xff, 0xe2, 0x14, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x08, 0xce, 0xff, 0xff, 0xff, 0xf0, 0x0c, 0x00,  //.@@@@@....@@@@....@@@@@..
-    0x48, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x30, 0xfa, 0xff, 0xff, 0xff, 0x68, 0x00,  //+@@@@+....@@@@.....@@@@+.
-    0x94, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xb8, 0x00,  //%@@@@.....@@@@.....%@@@%.
-    0xcc, 0xff, 0xff, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xee, 0x00,  //@@@@+.....@@@@.....+@@@@.
-    0xee, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff, 0xff, 0x10,  //@@@@+.....%@@@......@@@@.
-    0xfa, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5c, 0x66, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0x1e,  //@@@@.......++.......@@@@.
-    0xea, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0xff, 0x0c,  //@@@@................@@@@.
-    0xd0, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0xff, 0xf4, 0x00,  //@@@@+...............@@@@.
-    0xa4, 0xff, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xc6, 0x00,  //%@@@%..............%@@@@.
-    0x56, 0xff, 0xff, 0xff, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe8, 0xff, 0xff, 0xff, 0x7a, 0x00,  //+@@@@..............@@@@+.
-    0x0c, 0xf0, 0xff, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xfc, 0x26, 0x00,  //.@@@@%............%@@@@..
-    0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x00, 0x00,  //.+@@@@+..........+@@@@%..
-    0x00, 0x0c, 0xe6, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0x22, 0x00, 0x00,  //..@@@@@%........%@@@@@...
-    0x00, 0x00, 0x3c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xec, 0x8e, 0x42, 0x20, 0x1e, 0x3a, 0x82, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00,  //...@@@@@@%+...%@@@@@@+...
-    0x00, 0x00, 0x00, 0x5e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@+....
-    0x00, 0x00, 0x00, 0x00, 0x42, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x98, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@@@@@@@@@@%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x72, 0xc2, 0xea, 0xfc, 0xff, 0xee, 0xca, 0x7e, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xf7, 0x00, 0x03, 0x3e, 0xdc, 0xe6, 0x54, 0xec, 0x00, 0x04, 0xdc, 0xff, 0xff, 0xf4, 0x08, 0xed,
+    0x00, 0xfd, 0xff, 0x00, 0x22, 0xed, 0x00, 0xfd, 0xff, 0x00, 0x22, 0xf3, 0x00, 0x05, 0x0c, 0x82,
+    0x9e, 0x36, 0x00, 0x00, 0xfd, 0xff, 0x05, 0x22, 0x00, 0x26, 0x98, 0x8e, 0x18, 0xf9, 0x00, 0x06,
+    0x1c, 0xd2, 0xff, 0xff, 0xf2, 0x14, 0x00, 0xfd, 0xff, 0x06, 0x22, 0x04, 0xde, 0xff, 0xff, 0xe4,
+    0x2e, 0xfb, 0x00, 0x01, 0x14, 0xd8, 0xfd, 0xff, 0x01, 0x3a, 0x00, 0xfd, 0xff, 0x01, 0x22, 0x16,
+    0xfd, 0xff, 0x01, 0xea, 0x24, 0xfc, 0x00, 0x00, 0xb8, 0xfd, 0xff, 0x02, 0xd8, 0x06, 0x00, 0xfd,
+    0xff, 0x02, 0x22, 0x00, 0xbe, 0xfd, 0xff, 0x01, 0xd0, 0x06, 0xfe, 0x00, 0x00, 0x5c, 0xfd, 0xff,
+    0x03, 0xd6, 0x1a, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x22, 0x00, 0x0e, 0xc2, 0xfd, 0xff, 0x00, 0x7a,
+    0xfe, 0x00, 0x00, 0xdc, 0xfe, 0xff, 0x01, 0xe2, 0x14, 0xfe, 0x00, 0xfd, 0xff, 0x04, 0x22, 0x00,
+    0x00, 0x08, 0xce, 0xfe, 0xff, 0x03, 0xf0, 0x0c, 0x00, 0x48, 0xfd, 0xff, 0x00, 0x4a, 0xfd, 0x00,
+    0xfd, 0xff, 0x00, 0x22, 0xfe, 0x00, 0x01, 0x30, 0xfa, 0xfe, 0xff, 0x02, 0x68, 0x00, 0x94, 0xfe,
+    0xff, 0x00, 0xcc, 0xfc, 0x00, 0xfd, 0xff, 0x00, 0x22, 0xfd, 0x00, 0x00, 0xac, 0xfe, 0xff, 0x02,
+    0xb8, 0x00, 0xcc, 0xfe, 0xff, 0x00, 0x72, 0xfc, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0x00, 0x1a, 0xfd,
+    0x00, 0x00, 0x50, 0xfe, 0xff, 0x02, 0xee, 0x00, 0xee, 0xfe, 0xff, 0x00, 0x42, 0xfc, 0x00, 0x03,
+    0xa2, 0xff, 0xff, 0xc2, 0xfc, 0x00, 0x00, 0x20, 0xfd, 0xff, 0x01, 0x10, 0xfa, 0xfe, 0xff, 0x00,
+    0x2a, 0xfc, 0x00, 0x03, 0x02, 0x5c, 0x66, 0x0a, 0xfc, 0x00, 0x00, 0x06, 0xfd, 0xff, 0x01, 0x1e,
+    0xea, 0xfe, 0xff, 0x00, 0x36, 0xf3, 0x00, 0x00, 0x14, 0xfd, 0xff, 0x01, 0x0c, 0xd0, 0xfe, 0xff,
+    0x00, 0x5c, 0xf3, 0x00, 0x00, 0x38, 0xfe, 0xff, 0x02, 0xf4, 0x00, 0xa4, 0xfe, 0xff, 0x00, 0xa6,
+    0xf3, 0x00, 0x00, 0x84, 0xfe, 0xff, 0x02, 0xc6, 0x00, 0x56, 0xfe, 0xff, 0x01, 0xf8, 0x1c, 0xf5,
+    0x00, 0x01, 0x0a, 0xe8, 0xfe, 0xff, 0x03, 0x7a, 0x00, 0x0c, 0xf0, 0xfe, 0xff, 0x00, 0xaa, 0xf5,
+    0x00, 0x00, 0x88, 0xfe, 0xff, 0x04, 0xfc, 0x26, 0x00, 0x00, 0x80, 0xfd, 0xff, 0x00, 0x7a, 0xf7,
+    0x00, 0x00, 0x5c, 0xfd, 0xff, 0x00, 0xa4, 0xfe, 0x00, 0x01, 0x0c, 0xe6, 0xfd, 0xff, 0x01, 0x9c,
+    0x10, 0xfb, 0x00, 0x02, 0x08, 0x82, 0xfc, 0xfe, 0xff, 0x01, 0xf4, 0x22, 0xfd, 0x00, 0x01, 0x3c,
+    0xf8, 0xfd, 0xff, 0x07, 0xec, 0x8e, 0x42, 0x20, 0x1e, 0x3a, 0x82, 0xe2, 0xfc, 0xff, 0x00, 0x5a,
+    0xfb, 0x00, 0x01, 0x5e, 0xfa, 0xf2, 0xff, 0x00, 0x7e, 0xf9, 0x00, 0x01, 0x42, 0xee, 0xf5, 0xff,
+    0x01, 0xf6, 0x5c, 0xf7, 0x00, 0x02, 0x16, 0x98, 0xfa, 0xf8, 0xff, 0x01, 0xaa, 0x22, 0xf4, 0x00,
+    0x09, 0x1e, 0x72, 0xc2, 0xea, 0xfc, 0xff, 0xee, 0xca, 0x7e, 0x2a, 0xee, 0x00, 0x01, 0x04, 0x06,
+    0xc3, 0x00,
 
     /*Unicode: U+f013 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x38, 0xb4, 0x32, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x32, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00,  //.....%...+@@@@@....%.....
-    0x00, 0x00, 0x00, 0x42, 0xf4, 0xff, 0xf6, 0x62, 0x18, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x18, 0x6a, 0xf8, 0xff, 0xee, 0x36, 0x00, 0x00, 0x00,  //...+@@@+.%@@@@@%.+@@@....
-    0x00, 0x00, 0x36, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xee, 0x2c, 0x00, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x00, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x00, 0x00, 0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x24, 0x00, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x6a, 0x4c, 0x6a, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1a, 0x00, 0x00, 0x00,  //....@@@@@@@+++@@@@@@@....
-    0x00, 0x18, 0x40, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x30, 0x08, 0x00,  //...%@@@@@%.....%@@@@@%...
-    0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc,  //@@@@@@@@@.......@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.......+@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@+.......+@@@@@@@@
-    0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,  //@@@@@@@@@.......@@@@@@@@@
-    0x00, 0x16, 0x3c, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x4c, 0x24, 0x02,  //...%@@@@@%.....%@@@@@%+..
-    0x00, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x58, 0x3c, 0x58, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x24, 0x00, 0x00, 0x00,  //....@@@@@@%+.+%@@@@@@....
-    0x00, 0x00, 0x00, 0x44, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x1c, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x24, 0x00, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00,  //..%@@@@@@@@@@@@@@@@@@@%..
-    0x00, 0x00, 0x38, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x40, 0x00, 0x00,  //...@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x00, 0x00, 0x44, 0xf4, 0xff, 0xfc, 0x7e, 0x2a, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x28, 0x78, 0xfa, 0xff, 0xfa, 0x50, 0x00, 0x00, 0x00,  //...+@@@+.%@@@@@%.+@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x3a, 0xc6, 0x40, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00, 0x42, 0xc8, 0x46, 0x00, 0x00, 0x00, 0x00,  //.....@....@@@@@+..+@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x12, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xc5, 0x00, 0x00, 0xdc, 0xfe, 0xff, 0x00, 0xd8, 0xee, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0x00, 0x12,
+    0xf4, 0x00, 0x05, 0x38, 0xb4, 0x32, 0x00, 0x00, 0x42, 0xfc, 0xff, 0x05, 0x38, 0x00, 0x00, 0x32,
+    0xb4, 0x30, 0xfa, 0x00, 0x06, 0x42, 0xf4, 0xff, 0xf6, 0x62, 0x18, 0xa0, 0xfc, 0xff, 0x06, 0x9c,
+    0x18, 0x6a, 0xf8, 0xff, 0xee, 0x36, 0xfc, 0x00, 0x01, 0x36, 0xf4, 0xfd, 0xff, 0x00, 0xfc, 0xfa,
+    0xff, 0x00, 0xfc, 0xfd, 0xff, 0x01, 0xee, 0x2c, 0xfd, 0x00, 0x00, 0xb4, 0xee, 0xff, 0x00, 0xa2,
+    0xfd, 0x00, 0x01, 0x2a, 0xf2, 0xf0, 0xff, 0x01, 0xee, 0x24, 0xfc, 0x00, 0x00, 0x58, 0xf0, 0xff,
+    0x00, 0x4e, 0xfb, 0x00, 0x01, 0x1a, 0xfc, 0xfc, 0xff, 0x04, 0xca, 0x6a, 0x4c, 0x6a, 0xcc, 0xfc,
+    0xff, 0x01, 0xfa, 0x1a, 0xfd, 0x00, 0x02, 0x18, 0x40, 0xa2, 0xfc, 0xff, 0x00, 0x94, 0xfc, 0x00,
+    0x00, 0x96, 0xfc, 0xff, 0x04, 0x9a, 0x30, 0x08, 0x00, 0xde, 0xfa, 0xff, 0x00, 0xca, 0xfb, 0x00,
+    0x01, 0x02, 0xcc, 0xfb, 0xff, 0x01, 0xfc, 0xcc, 0xf9, 0xff, 0x00, 0x6a, 0xfa, 0x00, 0x00, 0x6c,
+    0xf1, 0xff, 0x00, 0x4c, 0xfa, 0x00, 0x00, 0x4c, 0xf1, 0xff, 0x00, 0x66, 0xfa, 0x00, 0x00, 0x68,
+    0xf9, 0xff, 0x00, 0xde, 0xfa, 0xff, 0x00, 0xc2, 0xfa, 0x00, 0x00, 0xc4, 0xfa, 0xff, 0x04, 0xe6,
+    0x00, 0x16, 0x3c, 0xa0, 0xfc, 0xff, 0x00, 0x82, 0xfc, 0x00, 0x00, 0x84, 0xfc, 0xff, 0x03, 0xac,
+    0x4c, 0x24, 0x02, 0xfe, 0x00, 0x01, 0x1e, 0xfc, 0xfc, 0xff, 0x04, 0xba, 0x58, 0x3c, 0x58, 0xbc,
+    0xfc, 0xff, 0x01, 0xfc, 0x24, 0xfb, 0x00, 0x01, 0x44, 0xfc, 0xf1, 0xff, 0x00, 0x50, 0xfc, 0x00,
+    0x01, 0x1c, 0xea, 0xf0, 0xff, 0x01, 0xf0, 0x24, 0xfd, 0x00, 0x00, 0xa0, 0xee, 0xff, 0x00, 0xb2,
+    0xfd, 0x00, 0x01, 0x38, 0xf4, 0xf0, 0xff, 0x01, 0xf8, 0x40, 0xfc, 0x00, 0x06, 0x44, 0xf4, 0xff,
+    0xfc, 0x7e, 0x2a, 0xa8, 0xfc, 0xff, 0x06, 0xac, 0x28, 0x78, 0xfa, 0xff, 0xfa, 0x50, 0xfa, 0x00,
+    0x05, 0x3a, 0xc6, 0x40, 0x00, 0x00, 0x3c, 0xfc, 0xff, 0x05, 0x44, 0x00, 0x00, 0x42, 0xc8, 0x46,
+    0xf4, 0x00, 0x00, 0x16, 0xfc, 0xff, 0x00, 0x20, 0xee, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0x00, 0xe8,
+    0xed, 0x00, 0x00, 0x06, 0xfe, 0x12, 0x00, 0x06, 0xc5, 0x00,
 
     /*Unicode: U+f014 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......%@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0x76, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xaa, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@+.....%@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xee, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xf6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@.......@@......
-    0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x08, 0x0e, 0xec, 0xff, 0x30, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x64, 0xff, 0xba, 0x0e, 0x04,  //..@@..............+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..............+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..............+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0x34, 0x58, 0x08, 0x00, 0x26, 0x5a, 0x12, 0x00, 0x1a, 0x5a, 0x1e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@...+...+...+..+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc4, 0xff, 0x44, 0x00, 0xa0, 0xff, 0x68, 0x00, 0x7c, 0xff, 0x8c, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..@@+.%@+.+@%.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0xb4, 0xfc, 0x36, 0x00, 0x90, 0xff, 0x58, 0x00, 0x6c, 0xff, 0x7a, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..%@..%@+.+@+.+@%..
-    0x00, 0x00, 0xea, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xb6, 0x00, 0x00,  //..@@..............+@%..
-    0x00, 0x00, 0xe8, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xb4, 0x00, 0x00,  //..@@..............+@%..
-    0x00, 0x00, 0xce, 0xff, 0x56, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x8e, 0xff, 0x96, 0x00, 0x00,  //..@@+.............%@%..
-    0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00,  //..+@@@@@@@@@@@@@@@@@...
-    0x00, 0x00, 0x06, 0xa2, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x74, 0x00, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xcc, 0x00, 0x01, 0x86, 0xf0, 0xfc, 0xff, 0x01, 0xe2, 0x5c, 0xf4, 0x00, 0x00, 0x5e, 0xf9, 0xff,
+    0x01, 0xfc, 0x2c, 0xf5, 0x00, 0x02, 0xd2, 0xff, 0x76, 0xfc, 0x0e, 0x02, 0xaa, 0xff, 0x9c, 0xf6,
+    0x00, 0x03, 0x42, 0xff, 0xee, 0x0a, 0xfc, 0x00, 0x03, 0x34, 0xff, 0xf6, 0x12, 0xfc, 0x00, 0x00,
+    0xec, 0xec, 0xff, 0x01, 0xb4, 0xf2, 0xec, 0xff, 0x05, 0xba, 0x08, 0x0e, 0xec, 0xff, 0x30, 0xf4,
+    0x0e, 0x09, 0x64, 0xff, 0xba, 0x0e, 0x04, 0x00, 0x00, 0xea, 0xff, 0x22, 0xf4, 0x00, 0x02, 0x5a,
+    0xff, 0xb6, 0xfd, 0x00, 0x02, 0xea, 0xff, 0x22, 0xf4, 0x00, 0x02, 0x5a, 0xff, 0xb6, 0xfd, 0x00,
+    0x12, 0xea, 0xff, 0x22, 0x00, 0x34, 0x58, 0x08, 0x00, 0x26, 0x5a, 0x12, 0x00, 0x1a, 0x5a, 0x1e,
+    0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc4, 0xff, 0x44, 0x00, 0xa0,
+    0xff, 0x68, 0x00, 0x7c, 0xff, 0x8c, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22,
+    0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6,
+    0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e,
+    0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46,
+    0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea,
+    0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a,
+    0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a,
+    0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc6,
+    0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00,
+    0x12, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2, 0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e,
+    0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22, 0x00, 0xc6, 0xff, 0x46, 0x00, 0xa2,
+    0xff, 0x6a, 0x00, 0x7e, 0xff, 0x8e, 0x00, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x12, 0xea, 0xff, 0x22,
+    0x00, 0xb4, 0xfc, 0x36, 0x00, 0x90, 0xff, 0x58, 0x00, 0x6c, 0xff, 0x7a, 0x00, 0x5a, 0xff, 0xb6,
+    0xfd, 0x00, 0x02, 0xea, 0xff, 0x22, 0xf4, 0x00, 0x02, 0x5a, 0xff, 0xb6, 0xfd, 0x00, 0x02, 0xe8,
+    0xff, 0x24, 0xf4, 0x00, 0x02, 0x5c, 0xff, 0xb4, 0xfd, 0x00, 0x02, 0xce, 0xff, 0x56, 0xf4, 0x02,
+    0x02, 0x8e, 0xff, 0x96, 0xfd, 0x00, 0x00, 0x7a, 0xf0, 0xff, 0x00, 0x3e, 0xfd, 0x00, 0x02, 0x06,
+    0xa2, 0xfa, 0xf4, 0xff, 0x01, 0xf2, 0x74, 0xfa, 0x00, 0x00, 0x06, 0xf4, 0x0e, 0x00, 0x02, 0xcf,
+    0x00,
 
     /*Unicode: U+f015 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xb8, 0x78, 0x02, 0x00, 0x00, 0x0c, 0xae, 0xb6, 0xb6, 0xa2, 0x00, 0x00, 0x00, 0x00,  //............+%+....%%%%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb0, 0xff, 0xff, 0xff, 0xba, 0x12, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...........%@@@%...@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x2c, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@@..@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xe8, 0xff, 0xff, 0xca, 0x34, 0xc8, 0xff, 0xff, 0xf4, 0x78, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.........@@@@.@@@@+@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf8, 0xff, 0xff, 0xa8, 0x0c, 0x5e, 0x0c, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......+@@@%.+.%@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x80, 0x14, 0xbe, 0xff, 0xbe, 0x14, 0x76, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //......%@@@+.%@%.+@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xb2, 0xff, 0xff, 0xf4, 0x56, 0x2e, 0xde, 0xff, 0xff, 0xff, 0xde, 0x2e, 0x4a, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.....%@@@+.@@@@@.+@@@@@....
-    0x00, 0x00, 0x00, 0x20, 0xd2, 0xff, 0xff, 0xe4, 0x34, 0x56, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x56, 0x28, 0xda, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00,  //....@@@@.+@@@@@@@+.@@@@....
-    0x00, 0x00, 0x3c, 0xea, 0xff, 0xff, 0xca, 0x1c, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x12, 0xba, 0xff, 0xff, 0xf6, 0x58, 0x00, 0x00,  //...@@@@.%@@@@@@@@@%.%@@@+..
-    0x00, 0x60, 0xf8, 0xff, 0xff, 0xaa, 0x18, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x12, 0x92, 0xff, 0xff, 0xff, 0x84, 0x00,  //.+@@@%.%@@@@@@@@@@@%.%@@@%.
-    0x5e, 0xff, 0xff, 0xff, 0x80, 0x28, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x26, 0x62, 0xf8, 0xff, 0xff, 0x8a,  //+@@@+.@@@@@@@@@@@@@@@.+@@@%
-    0x24, 0xee, 0xf4, 0x56, 0x4c, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x4c, 0x3c, 0xe8, 0xfa, 0x44,  //.@@++@@@@@@@@@@@@@@@@@+.@@+
-    0x00, 0x32, 0x2e, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1c, 0x44, 0x00,  //....@@@@@@@@@@@@@@@@@@@..+.
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xc6, 0xc6, 0xc6, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@.....@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@@.....@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x89, 0x00, 0x0a, 0x74, 0xb8, 0x78, 0x02, 0x00, 0x00, 0x0c, 0xae, 0xb6, 0xb6, 0xa2, 0xf3, 0x00,
+    0x01, 0x0c, 0xb0, 0xfe, 0xff, 0x03, 0xba, 0x12, 0x00, 0x22, 0xfd, 0xff, 0xf4, 0x00, 0x01, 0x1e,
+    0xd0, 0xfc, 0xff, 0x02, 0xdc, 0x2c, 0x22, 0xfd, 0xff, 0xf5, 0x00, 0x0a, 0x3a, 0xe8, 0xff, 0xff,
+    0xca, 0x34, 0xc8, 0xff, 0xff, 0xf4, 0x78, 0xfd, 0xff, 0xf6, 0x00, 0x08, 0x60, 0xf8, 0xff, 0xff,
+    0xa8, 0x0c, 0x5e, 0x0c, 0xa2, 0xfa, 0xff, 0xf7, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0x07, 0x80, 0x14,
+    0xbe, 0xff, 0xbe, 0x14, 0x76, 0xfc, 0xfc, 0xff, 0xf9, 0x00, 0x07, 0x0c, 0xb2, 0xff, 0xff, 0xf4,
+    0x56, 0x2e, 0xde, 0xfe, 0xff, 0x03, 0xde, 0x2e, 0x4a, 0xf0, 0xfd, 0xff, 0xfa, 0x00, 0x07, 0x20,
+    0xd2, 0xff, 0xff, 0xe4, 0x34, 0x56, 0xf4, 0xfc, 0xff, 0x03, 0xf4, 0x56, 0x28, 0xda, 0xfe, 0xff,
+    0x00, 0x34, 0xfc, 0x00, 0x06, 0x3c, 0xea, 0xff, 0xff, 0xca, 0x1c, 0x86, 0xf8, 0xff, 0x06, 0x86,
+    0x12, 0xba, 0xff, 0xff, 0xf6, 0x58, 0xfe, 0x00, 0x06, 0x60, 0xf8, 0xff, 0xff, 0xaa, 0x18, 0xb4,
+    0xf6, 0xff, 0x02, 0xb4, 0x12, 0x92, 0xfe, 0xff, 0x02, 0x84, 0x00, 0x5e, 0xfe, 0xff, 0x02, 0x80,
+    0x28, 0xd8, 0xf4, 0xff, 0x0c, 0xd8, 0x26, 0x62, 0xf8, 0xff, 0xff, 0x8a, 0x24, 0xee, 0xf4, 0x56,
+    0x4c, 0xf0, 0xf2, 0xff, 0x0a, 0xf0, 0x4c, 0x3c, 0xe8, 0xfa, 0x44, 0x00, 0x32, 0x2e, 0x00, 0xfc,
+    0xf0, 0xff, 0x03, 0xfc, 0x00, 0x1c, 0x44, 0xfc, 0x00, 0xee, 0xff, 0xf9, 0x00, 0xfa, 0xff, 0x00,
+    0xd4, 0xfe, 0xc6, 0x00, 0xd4, 0xfa, 0xff, 0xf9, 0x00, 0xfa, 0xff, 0x00, 0x3e, 0xfe, 0x00, 0x00,
+    0x3e, 0xfa, 0xff, 0xf9, 0x00, 0xfa, 0xff, 0x00, 0x3e, 0xfe, 0x00, 0x00, 0x3e, 0xfa, 0xff, 0xf9,
+    0x00, 0xfa, 0xff, 0x00, 0x3e, 0xfe, 0x00, 0x00, 0x3e, 0xfa, 0xff, 0xf9, 0x00, 0xfa, 0xff, 0x00,
+    0x3e, 0xfe, 0x00, 0x00, 0x3e, 0xfa, 0xff, 0xf9, 0x00, 0xfa, 0xff, 0x00, 0x3e, 0xfe, 0x00, 0x00,
+    0x3e, 0xfa, 0xff, 0xf9, 0x00, 0x00, 0xbe, 0xfb, 0xff, 0x00, 0x3e, 0xfe, 0x00, 0x00, 0x3e, 0xfb,
+    0xff, 0x00, 0xbe, 0x81, 0x00, 0xf6, 0x00,
 
     /*Unicode: U+f019 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xb2, 0xb6, 0xb6, 0xb6, 0xb0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%%%%%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x6c, 0x6e, 0x6e, 0x6e, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x6e, 0x6e, 0x6e, 0x6a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,  //......++++@@@@@@%++++......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xf4, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@@@...........
-    0x00, 0x1a, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x04, 0x00, 0x50, 0xfa, 0xff, 0xf2, 0x3e, 0x00, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1a, 0x00,  //...........+@@@............
-    0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x06, 0x00, 0x4e, 0xc8, 0x3c, 0x00, 0x0a, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //%@@@@@@@@%..+@...%@@@@@@@@%
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x08, 0x00, 0x00, 0x00, 0x0e, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@@%.....@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x5c, 0x36, 0x60, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@+.+@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x12, 0x50, 0xff, 0xff, 0x36, 0x46, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x26, 0x62, 0xff, 0xff, 0x4a, 0x58, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@.+@@++@@
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x82, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x82,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf7, 0x00, 0x01, 0x3a, 0xb2, 0xfe, 0xb6, 0x01, 0xb0, 0x2c, 0xed, 0x00, 0x00, 0xa0, 0xfc, 0xff,
+    0x00, 0x8c, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff,
+    0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff,
+    0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff,
+    0x00, 0x8e, 0xf2, 0x00, 0x01, 0x24, 0x6c, 0xfe, 0x6e, 0x00, 0xca, 0xfc, 0xff, 0x00, 0xc0, 0xfe,
+    0x6e, 0x01, 0x6a, 0x1c, 0xf7, 0x00, 0x00, 0xbe, 0xf2, 0xff, 0x00, 0xa8, 0xf7, 0x00, 0x01, 0x50,
+    0xfa, 0xf4, 0xff, 0x01, 0xf4, 0x3e, 0xf6, 0x00, 0x01, 0x56, 0xfa, 0xf6, 0xff, 0x01, 0xf4, 0x42,
+    0xf4, 0x00, 0x01, 0x54, 0xfa, 0xf8, 0xff, 0x01, 0xf4, 0x42, 0xf2, 0x00, 0x01, 0x54, 0xfa, 0xfa,
+    0xff, 0x01, 0xf4, 0x40, 0xf0, 0x00, 0x01, 0x52, 0xfa, 0xfc, 0xff, 0x01, 0xf4, 0x40, 0xee, 0x00,
+    0x01, 0x52, 0xfa, 0xfe, 0xff, 0x01, 0xf4, 0x3e, 0xf6, 0x00, 0x00, 0x1a, 0xfa, 0x22, 0x08, 0x04,
+    0x00, 0x50, 0xfa, 0xff, 0xf2, 0x3e, 0x00, 0x06, 0xfa, 0x22, 0x02, 0x1a, 0x00, 0xa0, 0xf9, 0xff,
+    0x08, 0xb2, 0x06, 0x00, 0x4e, 0xc8, 0x3c, 0x00, 0x0a, 0xc0, 0xf9, 0xff, 0x01, 0xa0, 0xfa, 0xf8,
+    0xff, 0x01, 0xba, 0x08, 0xfe, 0x00, 0x01, 0x0e, 0xc6, 0xf8, 0xff, 0x00, 0xfa, 0xf6, 0xff, 0x04,
+    0xd8, 0x5c, 0x36, 0x60, 0xde, 0xc9, 0xff, 0x06, 0xd2, 0x12, 0x50, 0xff, 0xff, 0x36, 0x46, 0xed,
+    0xff, 0x09, 0xd8, 0x26, 0x62, 0xff, 0xff, 0x4a, 0x58, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0x02, 0xf8,
+    0x82, 0xf8, 0xea, 0xff, 0x01, 0xf8, 0x82, 0x81, 0x00, 0xfa, 0x00,
 
     /*Unicode: U+f01c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x5e, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x40, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x08, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x90, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0xb0, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00,  //...@@@%...........%@@%...
-    0x00, 0x00, 0x3e, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xfa, 0x1a, 0x00, 0x00,  //...@@@............+@@@...
-    0x00, 0x00, 0xaa, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xff, 0x84, 0x00, 0x00,  //..%@@%.............@@@%..
-    0x00, 0x1a, 0xfa, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xe8, 0x06, 0x00,  //..@@@+.............+@@@..
-    0x00, 0x84, 0xff, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0xff, 0xff, 0x5e, 0x00,  //.%@@@...............@@@+.
-    0x06, 0xe8, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xca, 0x00,  //.@@@+...............%@@@.
-    0x5e, 0xff, 0xff, 0xf6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0x38,  //+@@@.................@@@.
-    0xbc, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xff, 0xff, 0x96,  //%@@%.................@@@%
-    0xf0, 0xff, 0xff, 0x86, 0x52, 0x52, 0x52, 0x52, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x52, 0x52, 0x52, 0x52, 0x9e, 0xff, 0xff, 0xcc,  //@@@%++++.........++++%@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@%.......@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@......+@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x36, 0x36, 0x36, 0x36, 0x36, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@%.....@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x99, 0x00, 0x01, 0x5e, 0xf0, 0xf4, 0xff, 0x01, 0xe8, 0x40, 0xfa, 0x00, 0x01, 0x08, 0xee, 0xf2,
+    0xff, 0x00, 0xd0, 0xfa, 0x00, 0x00, 0x64, 0xf0, 0xff, 0x00, 0x3c, 0xfb, 0x00, 0x03, 0xd0, 0xff,
+    0xff, 0x90, 0xf6, 0x1a, 0x03, 0xb0, 0xff, 0xff, 0xaa, 0xfc, 0x00, 0x04, 0x3e, 0xff, 0xff, 0xfc,
+    0x20, 0xf6, 0x00, 0x04, 0x44, 0xff, 0xff, 0xfa, 0x1a, 0xfd, 0x00, 0x03, 0xaa, 0xff, 0xff, 0xb4,
+    0xf4, 0x00, 0x03, 0xd8, 0xff, 0xff, 0x84, 0xfe, 0x00, 0x04, 0x1a, 0xfa, 0xff, 0xff, 0x4a, 0xf4,
+    0x00, 0x0a, 0x70, 0xff, 0xff, 0xe8, 0x06, 0x00, 0x00, 0x84, 0xff, 0xff, 0xde, 0xf3, 0x00, 0x0a,
+    0x0e, 0xf4, 0xff, 0xff, 0x5e, 0x00, 0x06, 0xe8, 0xff, 0xff, 0x76, 0xf2, 0x00, 0x09, 0x9c, 0xff,
+    0xff, 0xca, 0x00, 0x5e, 0xff, 0xff, 0xf6, 0x14, 0xf2, 0x00, 0x00, 0x32, 0xfe, 0xff, 0x04, 0x38,
+    0xbc, 0xff, 0xff, 0xa2, 0xf0, 0x00, 0x07, 0xc8, 0xff, 0xff, 0x96, 0xf0, 0xff, 0xff, 0x86, 0xfd,
+    0x52, 0x00, 0x1e, 0xfa, 0x00, 0x00, 0x2a, 0xfd, 0x52, 0x03, 0x9e, 0xff, 0xff, 0xcc, 0xf9, 0xff,
+    0x00, 0xb4, 0xfa, 0x00, 0x00, 0xd6, 0xfa, 0xff, 0x00, 0xda, 0xf8, 0xff, 0x00, 0x32, 0xfc, 0x00,
+    0x00, 0x58, 0xf9, 0xff, 0x00, 0xda, 0xf8, 0xff, 0x00, 0xb8, 0xfc, 0x36, 0x00, 0xd4, 0xf9, 0xff,
+    0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff,
+    0x00, 0xda, 0xe9, 0xff, 0x01, 0xda, 0xbe, 0xea, 0xff, 0x00, 0x98, 0x84, 0x00,
 
     /*Unicode: U+f021 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x62, 0xa4, 0xda, 0xf2, 0xff, 0xee, 0xd4, 0x9a, 0x4e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x82, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x6e, 0x06, 0x00, 0x00, 0x1a, 0xd0, 0xbc,  //......%@@@@@@@@@@@+....@%
-    0x00, 0x00, 0x00, 0x00, 0x30, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x24, 0x1c, 0xda, 0xff, 0xff,  //.....@@@@@@@@@@@@@@@..@@@
-    0x00, 0x00, 0x00, 0x3c, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xff,  //....@@@@@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x28, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xac, 0x5c, 0x2e, 0x1e, 0x30, 0x5a, 0xa6, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@%+...+%@@@@@@@@@
-    0x00, 0x06, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xce, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@@.........%@@@@@@@
-    0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xac, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@%...........@@@@@@@
-    0x08, 0xea, 0xff, 0xff, 0xff, 0xd0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@...........@@@@@@@@
-    0x50, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@...........@@@@@@@@@
-    0x9c, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //%@@@%...........@@@@@@@@@
-    0x28, 0x52, 0x52, 0x52, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x24,  //.+++.............+++++++.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x3a, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x6e, 0x6e, 0x6e, 0x2c,  //.++++++++............+++.
-    0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x78,  //@@@@@@@@@+..........@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0xff, 0xff, 0x2a,  //@@@@@@@@@...........@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd6, 0xff, 0xff, 0xff, 0xce, 0x00,  //@@@@@@@@...........@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00,  //@@@@@@@...........%@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00,  //@@@@@@@@.........@@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa8, 0x58, 0x2a, 0x16, 0x26, 0x54, 0xa8, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x18, 0x00, 0x00,  //@@@@@@@@@%+...+%@@@@@@...
-    0xff, 0xff, 0xff, 0xe2, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@@@....
-    0xff, 0xff, 0xde, 0x1e, 0x2e, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x26, 0x00, 0x00, 0x00, 0x00,  //@@@..@@@@@@@@@@@@@@@.....
-    0xc6, 0xd8, 0x1e, 0x00, 0x00, 0x0c, 0x82, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x7e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@....%@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x62, 0xae, 0xe4, 0xfa, 0xff, 0xfa, 0xe4, 0xac, 0x66, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+%@@@@@%+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xc8, 0x00, 0x0a, 0x0c, 0x62, 0xa4, 0xda, 0xf2, 0xff, 0xee, 0xd4, 0x9a, 0x4e, 0x08, 0xf5, 0x00,
+    0x02, 0x06, 0x82, 0xee, 0xf8, 0xff, 0x07, 0xe6, 0x6e, 0x06, 0x00, 0x00, 0x1a, 0xd0, 0xbc, 0xfd,
+    0x00, 0x01, 0x30, 0xd6, 0xf4, 0xff, 0x05, 0xd0, 0x24, 0x1c, 0xda, 0xff, 0xff, 0xfe, 0x00, 0x01,
+    0x3c, 0xf0, 0xf2, 0xff, 0x01, 0xf0, 0xe0, 0xfe, 0xff, 0x03, 0x00, 0x00, 0x28, 0xf2, 0xfd, 0xff,
+    0x08, 0xfa, 0xac, 0x5c, 0x2e, 0x1e, 0x30, 0x5a, 0xa6, 0xfa, 0xf9, 0xff, 0x02, 0x00, 0x06, 0xd4,
+    0xfd, 0xff, 0x01, 0xce, 0x28, 0xfa, 0x00, 0x01, 0x22, 0xc0, 0xfa, 0xff, 0x01, 0x00, 0x72, 0xfd,
+    0xff, 0x01, 0xac, 0x06, 0xf8, 0x00, 0x01, 0x1c, 0xf4, 0xfb, 0xff, 0x01, 0x08, 0xea, 0xfe, 0xff,
+    0x01, 0xd0, 0x0a, 0xf8, 0x00, 0x01, 0x18, 0xd8, 0xfa, 0xff, 0x00, 0x50, 0xfd, 0xff, 0x00, 0x30,
+    0xf8, 0x00, 0x01, 0x10, 0xd8, 0xf9, 0xff, 0x00, 0x9c, 0xfe, 0xff, 0x00, 0xba, 0xf7, 0x00, 0x00,
+    0x3c, 0xf9, 0xff, 0x01, 0xea, 0x28, 0xfe, 0x52, 0x00, 0x1e, 0xf6, 0x00, 0x00, 0x3e, 0xfa, 0x52,
+    0x00, 0x24, 0xb6, 0x00, 0x00, 0x3a, 0xfa, 0x6e, 0x00, 0x5a, 0xf6, 0x00, 0x00, 0x2c, 0xfe, 0x6e,
+    0x01, 0x2c, 0xf2, 0xf9, 0xff, 0x00, 0x42, 0xf7, 0x00, 0x00, 0xc6, 0xfe, 0xff, 0x00, 0x78, 0xf9,
+    0xff, 0x01, 0xd0, 0x0c, 0xf8, 0x00, 0x00, 0x38, 0xfd, 0xff, 0x00, 0x2a, 0xfa, 0xff, 0x01, 0xd2,
+    0x14, 0xf8, 0x00, 0x01, 0x0c, 0xd6, 0xfe, 0xff, 0x01, 0xce, 0x00, 0xfb, 0xff, 0x01, 0xf4, 0x1c,
+    0xf8, 0x00, 0x01, 0x06, 0xb0, 0xfd, 0xff, 0x01, 0x50, 0x00, 0xfa, 0xff, 0x01, 0xc6, 0x28, 0xfa,
+    0x00, 0x01, 0x28, 0xd0, 0xfd, 0xff, 0x02, 0xba, 0x00, 0x00, 0xf9, 0xff, 0x08, 0xfc, 0xa8, 0x58,
+    0x2a, 0x16, 0x26, 0x54, 0xa8, 0xfa, 0xfd, 0xff, 0x03, 0xe8, 0x18, 0x00, 0x00, 0xfe, 0xff, 0x01,
+    0xe2, 0xf4, 0xf2, 0xff, 0x01, 0xe8, 0x2c, 0xfe, 0x00, 0x05, 0xff, 0xff, 0xde, 0x1e, 0x2e, 0xdc,
+    0xf4, 0xff, 0x01, 0xce, 0x26, 0xfd, 0x00, 0x07, 0xc6, 0xd8, 0x1e, 0x00, 0x00, 0x0c, 0x82, 0xf2,
+    0xf8, 0xff, 0x02, 0xee, 0x7e, 0x04, 0xf5, 0x00, 0x0a, 0x12, 0x62, 0xae, 0xe4, 0xfa, 0xff, 0xfa,
+    0xe4, 0xac, 0x66, 0x0c, 0xee, 0x00, 0x00, 0x0c, 0xc3, 0x00,
 
     /*Unicode: U+f026 () , Width: 13 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xee, 0x34,  //..........+@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0x6a,  //.........%@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0x6a,  //........%@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0x6a,  //.......%@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //......%@@@@@+
-    0x1e, 0x4a, 0x4a, 0x4a, 0x4a, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //.++++%@@@@@@+
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //@@@@@@@@@@@@+
-    0xbc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //%@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a,  //......@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x6a,  //.......@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0x6a,  //........@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0x6a,  //.........@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0x66,  //..........@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x9e, 0x16,  //...........%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+    0xb6, 0x00, 0x02, 0x7e, 0xee, 0x34, 0xf8, 0x00, 0x03, 0x82, 0xff, 0xff, 0x6a, 0xf9, 0x00, 0x00,
+    0x84, 0xfe, 0xff, 0x00, 0x6a, 0xfa, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x00, 0x6a, 0xfb, 0x00, 0x00,
+    0x84, 0xfc, 0xff, 0x01, 0x6a, 0x1e, 0xfd, 0x4a, 0x00, 0x8e, 0xfb, 0xff, 0x01, 0x6a, 0xea, 0xf6,
+    0xff, 0x00, 0x6a, 0xf5, 0xff, 0x00, 0x6a, 0xf5, 0xff, 0x00, 0x6a, 0xf5, 0xff, 0x00, 0x6a, 0xf5,
+    0xff, 0x00, 0x6a, 0xf5, 0xff, 0x00, 0x6a, 0xf5, 0xff, 0x01, 0x6a, 0xbc, 0xfd, 0xfa, 0x00, 0xfc,
+    0xfb, 0xff, 0x00, 0x6a, 0xfc, 0x00, 0x01, 0x40, 0xf4, 0xfc, 0xff, 0x00, 0x6a, 0xfb, 0x00, 0x01,
+    0x40, 0xf4, 0xfd, 0xff, 0x00, 0x6a, 0xfa, 0x00, 0x01, 0x40, 0xf4, 0xfe, 0xff, 0x00, 0x6a, 0xf9,
+    0x00, 0x04, 0x3e, 0xf4, 0xff, 0xff, 0x6a, 0xf8, 0x00, 0x03, 0x3e, 0xf4, 0xff, 0x66, 0xf7, 0x00,
+    0x02, 0x3a, 0x9e, 0x16, 0xc0, 0x00,
 
     /*Unicode: U+f027 () , Width: 19 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xee, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......%@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@@@@@+......
-    0x1e, 0x4a, 0x4a, 0x4a, 0x4a, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.++++%@@@@@@+......
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x06, 0xda, 0xe0, 0x4a, 0x00,  //@@@@@@@@@@@@+..@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x02, 0xd2, 0xff, 0xf8, 0x38,  //@@@@@@@@@@@@+..@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x06, 0xa4, 0xff, 0xb8,  //@@@@@@@@@@@@+...%@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x24, 0xff, 0xf0,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xe4,  //@@@@@@@@@@@@+....@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x32, 0xda, 0xff, 0x96,  //@@@@@@@@@@@@+...@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x08, 0xf6, 0xff, 0xdc, 0x14,  //@@@@@@@@@@@@+..@@@.
-    0xbc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x8c, 0x90, 0x14, 0x00,  //%@@@@@@@@@@@+..%%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x9e, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...................
-
+    0x98, 0x00, 0x02, 0x7e, 0xee, 0x34, 0xf2, 0x00, 0x03, 0x82, 0xff, 0xff, 0x6a, 0xf3, 0x00, 0x00,
+    0x84, 0xfe, 0xff, 0x00, 0x6a, 0xf4, 0x00, 0x00, 0x84, 0xfd, 0xff, 0x00, 0x6a, 0xf5, 0x00, 0x00,
+    0x84, 0xfc, 0xff, 0x00, 0x6a, 0xfb, 0x00, 0x00, 0x1e, 0xfd, 0x4a, 0x00, 0x8e, 0xfb, 0xff, 0x00,
+    0x6a, 0xfb, 0x00, 0x00, 0xea, 0xf6, 0xff, 0x06, 0x6a, 0x00, 0x06, 0xda, 0xe0, 0x4a, 0x00, 0xf5,
+    0xff, 0x06, 0x6a, 0x00, 0x02, 0xd2, 0xff, 0xf8, 0x38, 0xf5, 0xff, 0x06, 0x6a, 0x00, 0x00, 0x06,
+    0xa4, 0xff, 0xb8, 0xf5, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x02, 0x24, 0xff, 0xf0, 0xf5, 0xff, 0x00,
+    0x6a, 0xfe, 0x00, 0x02, 0x3a, 0xff, 0xe4, 0xf5, 0xff, 0x06, 0x6a, 0x00, 0x00, 0x32, 0xda, 0xff,
+    0x96, 0xf5, 0xff, 0x07, 0x6a, 0x00, 0x08, 0xf6, 0xff, 0xdc, 0x14, 0xbc, 0xfd, 0xfa, 0x00, 0xfc,
+    0xfb, 0xff, 0x05, 0x6a, 0x00, 0x00, 0x8c, 0x90, 0x14, 0xfb, 0x00, 0x01, 0x40, 0xf4, 0xfc, 0xff,
+    0x00, 0x6a, 0xf5, 0x00, 0x01, 0x40, 0xf4, 0xfd, 0xff, 0x00, 0x6a, 0xf4, 0x00, 0x01, 0x40, 0xf4,
+    0xfe, 0xff, 0x00, 0x6a, 0xf3, 0x00, 0x04, 0x3e, 0xf4, 0xff, 0xff, 0x6a, 0xf2, 0x00, 0x03, 0x3e,
+    0xf4, 0xff, 0x66, 0xf1, 0x00, 0x02, 0x3a, 0x9e, 0x16, 0x9c, 0x00,
 
     /*Unicode: U+f028 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xec, 0x7e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xda, 0x32, 0x00, 0x00, 0x00, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc8, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xdc, 0xff, 0xf4, 0x40, 0x00, 0x00, 0x00,  //..........@@+......+@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc8, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x08, 0xb8, 0xff, 0xf4, 0x2a, 0x00, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xca, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xde, 0x4a, 0x00, 0x06, 0xb4, 0xff, 0xd4, 0x06, 0x00,  //........@@@@+....@@+..%@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xca, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x1e, 0xe0, 0xff, 0xff, 0x72, 0x00, 0x10, 0xe8, 0xff, 0x72, 0x00,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x08, 0x92, 0xff, 0xff, 0x4e, 0x00, 0x58, 0xff, 0xec, 0x06,  //......@@@@@@+.....%@@+.+@@.
-    0x66, 0xa2, 0xa2, 0xa2, 0xa2, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x8a, 0xff, 0xe6, 0x0a, 0x00, 0xd8, 0xff, 0x54,  //+%%%%@@@@@@@+......%@@..@@+
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x24, 0xff, 0xfc, 0x8e, 0x00, 0x04, 0xd6, 0xff, 0x6a, 0x00, 0x82, 0xff, 0x9c,  //@@@@@@@@@@@@+..@@%..@@+.%@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x02, 0x98, 0xfc, 0xff, 0x66, 0x00, 0x6c, 0xff, 0xbc, 0x00, 0x42, 0xff, 0xd2,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xd2, 0x00, 0x2c, 0xff, 0xea, 0x00, 0x1e, 0xff, 0xec,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xfa, 0x00, 0x12, 0xff, 0xfa,  //@@@@@@@@@@@@+....@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xd2, 0x00, 0x2c, 0xff, 0xea, 0x00, 0x1e, 0xff, 0xec,  //@@@@@@@@@@@@+...+@@..@@..@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x02, 0x94, 0xfc, 0xff, 0x66, 0x00, 0x6a, 0xff, 0xbe, 0x00, 0x42, 0xff, 0xd2,  //@@@@@@@@@@@@+..%@@+.+@%.+@@
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x26, 0xff, 0xff, 0x90, 0x00, 0x02, 0xd2, 0xff, 0x6c, 0x00, 0x80, 0xff, 0x9c,  //@@@@@@@@@@@@+..@@%..@@+.+@%
-    0x6c, 0xa6, 0xa6, 0xa6, 0xa6, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x44, 0x32, 0x00, 0x00, 0x86, 0xff, 0xe8, 0x0c, 0x00, 0xd8, 0xff, 0x54,  //+%%%%@@@@@@@+..+...%@@..@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x8c, 0xff, 0xff, 0x54, 0x00, 0x56, 0xff, 0xec, 0x06,  //......@@@@@@+.....%@@+.+@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x1c, 0xdc, 0xff, 0xff, 0x78, 0x00, 0x0e, 0xe6, 0xff, 0x74, 0x00,  //.......@@@@@+....@@@+..@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xe0, 0x50, 0x00, 0x04, 0xb2, 0xff, 0xd4, 0x06, 0x00,  //........@@@@+....@@+..%@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xcc, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x24, 0x06, 0x00, 0x08, 0xb4, 0xff, 0xf4, 0x2c, 0x00, 0x00,  //.........@@@+........%@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xca, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xda, 0xff, 0xf4, 0x42, 0x00, 0x00, 0x00,  //..........@@+......+@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xdc, 0x32, 0x00, 0x00, 0x00, 0x00,  //...........+......+@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xee, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................+@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x9e, 0x00, 0x03, 0x72, 0xec, 0x7e, 0x0a, 0xf2, 0x00, 0x01, 0x0a, 0x42, 0xfb, 0x00, 0x04, 0x7a,
+    0xff, 0xff, 0xda, 0x32, 0xf4, 0x00, 0x03, 0x0e, 0xc8, 0xff, 0x56, 0xfb, 0x00, 0x04, 0x48, 0xdc,
+    0xff, 0xf4, 0x40, 0xf6, 0x00, 0x04, 0x0e, 0xc8, 0xff, 0xff, 0x6a, 0xfd, 0x00, 0x07, 0x20, 0x04,
+    0x00, 0x08, 0xb8, 0xff, 0xf4, 0x2a, 0xf8, 0x00, 0x01, 0x0e, 0xca, 0xfe, 0xff, 0x00, 0x6a, 0xfe,
+    0x00, 0x09, 0x3c, 0xff, 0xde, 0x4a, 0x00, 0x06, 0xb4, 0xff, 0xd4, 0x06, 0xfa, 0x00, 0x01, 0x10,
+    0xca, 0xfd, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x09, 0x1e, 0xe0, 0xff, 0xff, 0x72, 0x00, 0x10, 0xe8,
+    0xff, 0x72, 0xfb, 0x00, 0x01, 0x10, 0xcc, 0xfc, 0xff, 0x00, 0x6a, 0xfd, 0x00, 0x0a, 0x08, 0x92,
+    0xff, 0xff, 0x4e, 0x00, 0x58, 0xff, 0xec, 0x06, 0x66, 0xfd, 0xa2, 0x00, 0xd6, 0xfb, 0xff, 0x0f,
+    0x6a, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x8a, 0xff, 0xe6, 0x0a, 0x00, 0xd8, 0xff, 0x54, 0xfa,
+    0xf6, 0xff, 0x0e, 0x6a, 0x00, 0x24, 0xff, 0xfc, 0x8e, 0x00, 0x04, 0xd6, 0xff, 0x6a, 0x00, 0x82,
+    0xff, 0x9c, 0xf5, 0xff, 0x0e, 0x6a, 0x00, 0x02, 0x98, 0xfc, 0xff, 0x66, 0x00, 0x6c, 0xff, 0xbc,
+    0x00, 0x42, 0xff, 0xd2, 0xf5, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x0a, 0x6e, 0xff, 0xd2, 0x00, 0x2c,
+    0xff, 0xea, 0x00, 0x1e, 0xff, 0xec, 0xf5, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x0a, 0x1e, 0xff, 0xf4,
+    0x00, 0x16, 0xff, 0xfa, 0x00, 0x12, 0xff, 0xfa, 0xf5, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x0a, 0x6c,
+    0xff, 0xd2, 0x00, 0x2c, 0xff, 0xea, 0x00, 0x1e, 0xff, 0xec, 0xf5, 0xff, 0x0f, 0x6a, 0x00, 0x02,
+    0x94, 0xfc, 0xff, 0x66, 0x00, 0x6a, 0xff, 0xbe, 0x00, 0x42, 0xff, 0xd2, 0xfa, 0xf6, 0xff, 0x0f,
+    0x6a, 0x00, 0x26, 0xff, 0xff, 0x90, 0x00, 0x02, 0xd2, 0xff, 0x6c, 0x00, 0x80, 0xff, 0x9c, 0x6c,
+    0xfd, 0xa6, 0x00, 0xd8, 0xfb, 0xff, 0x0e, 0x6a, 0x00, 0x00, 0x44, 0x32, 0x00, 0x00, 0x86, 0xff,
+    0xe8, 0x0c, 0x00, 0xd8, 0xff, 0x54, 0xfc, 0x00, 0x01, 0x12, 0xce, 0xfc, 0xff, 0x00, 0x6a, 0xfd,
+    0x00, 0x09, 0x06, 0x8c, 0xff, 0xff, 0x54, 0x00, 0x56, 0xff, 0xec, 0x06, 0xfb, 0x00, 0x01, 0x10,
+    0xcc, 0xfd, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x09, 0x1c, 0xdc, 0xff, 0xff, 0x78, 0x00, 0x0e, 0xe6,
+    0xff, 0x74, 0xf9, 0x00, 0x01, 0x10, 0xcc, 0xfe, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x09, 0x3e, 0xff,
+    0xe0, 0x50, 0x00, 0x04, 0xb2, 0xff, 0xd4, 0x06, 0xf8, 0x00, 0x04, 0x10, 0xcc, 0xff, 0xff, 0x6a,
+    0xfd, 0x00, 0x07, 0x24, 0x06, 0x00, 0x08, 0xb4, 0xff, 0xf4, 0x2c, 0xf6, 0x00, 0x03, 0x10, 0xca,
+    0xff, 0x58, 0xfb, 0x00, 0x04, 0x46, 0xda, 0xff, 0xf4, 0x42, 0xf4, 0x00, 0x01, 0x0a, 0x46, 0xfb,
+    0x00, 0x04, 0x7a, 0xff, 0xff, 0xdc, 0x32, 0xeb, 0x00, 0x03, 0x74, 0xee, 0x80, 0x0c, 0x90, 0x00,
 
     /*Unicode: U+f03e () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xba, 0x1e, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@%..
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xf6, 0xff, 0x34, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x22, 0xff, 0xff, 0x0a,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0x02, 0x7c, 0xe0, 0xea, 0x9c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...+@@%....................@@.
-    0xff, 0xff, 0x12, 0x00, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..+@@@@%...................@@.
-    0xff, 0xff, 0x12, 0x00, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@@@...................@@.
-    0xff, 0xff, 0x12, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xe2, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@@@.........%@........@@.
-    0xff, 0xff, 0x12, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbe, 0xff, 0xff, 0xe2, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..%@@@@@........%@@@.......@@.
-    0xff, 0xff, 0x12, 0x00, 0x0e, 0xb4, 0xff, 0xff, 0xd4, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...%@@@........%@@@@@......@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x1a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..............@@@@@@@@.....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x26, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@.............@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@.......+....@@@@@@@@@@@@...@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x22, 0xe2, 0xfc, 0x68, 0x00, 0x0c, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@......@@+..@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x24, 0xe2, 0xff, 0xff, 0xfc, 0x72, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@.....@@@@+@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x24, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@....@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x24, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@@@@@@@@@@@@@@@@@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x80, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..%%%%%%%%%%%%%%%%%%%%%%+..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xf6, 0xff, 0x2a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x16, 0xff, 0xff, 0x0a,  //@@...........................@@.
-    0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x1e, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x26, 0x00,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xc1, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe8, 0xff, 0x04, 0xf8, 0xba, 0x1e, 0x00, 0xb2, 0xe4, 0xff,
+    0x04, 0xc4, 0x00, 0xf6, 0xff, 0x34, 0xe8, 0x0e, 0x06, 0x22, 0xff, 0xff, 0x0a, 0xff, 0xff, 0x12,
+    0xe7, 0x00, 0x0c, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x02, 0x7c, 0xe0, 0xea, 0x9c, 0x0e,
+    0xee, 0x00, 0x07, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x7c, 0xfd, 0xff, 0x00, 0xb4, 0xee,
+    0x00, 0x07, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xe2, 0xfc, 0xff, 0x00, 0x18, 0xf9, 0x00,
+    0x01, 0x08, 0x1e, 0xf9, 0x00, 0x07, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xea, 0xfc, 0xff,
+    0x00, 0x22, 0xfa, 0x00, 0x03, 0x08, 0xbc, 0xe2, 0x22, 0xfa, 0x00, 0x07, 0xff, 0xff, 0x12, 0xff,
+    0xff, 0x12, 0x00, 0x9e, 0xfd, 0xff, 0x00, 0xd4, 0xfa, 0x00, 0x05, 0x0a, 0xbe, 0xff, 0xff, 0xe2,
+    0x24, 0xfb, 0x00, 0x0c, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x0e, 0xb4, 0xff, 0xff, 0xd4,
+    0x28, 0xfb, 0x00, 0x01, 0x0a, 0xc0, 0xfd, 0xff, 0x01, 0xe4, 0x24, 0xfc, 0x00, 0x05, 0xff, 0xff,
+    0x12, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x01, 0x1a, 0x22, 0xfa, 0x00, 0x01, 0x0a, 0xc2, 0xfb, 0xff,
+    0x01, 0xe4, 0x26, 0xfd, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xf6, 0x00, 0x01, 0x0c,
+    0xc2, 0xf9, 0xff, 0x01, 0xe6, 0x26, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfc,
+    0x00, 0x01, 0x22, 0x5e, 0xfe, 0x00, 0x01, 0x0c, 0xc4, 0xf7, 0xff, 0x09, 0xe6, 0x28, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfd, 0x00, 0x06, 0x22, 0xe2, 0xfc, 0x68, 0x00, 0x0c, 0xc6,
+    0xf5, 0xff, 0x08, 0xd8, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xfe, 0x00, 0x06, 0x24,
+    0xe2, 0xff, 0xff, 0xfc, 0x72, 0xc6, 0xf4, 0xff, 0x0c, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff,
+    0xff, 0x12, 0x00, 0x00, 0x24, 0xe4, 0xee, 0xff, 0x0b, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff,
+    0xff, 0x12, 0x00, 0x24, 0xe4, 0xed, 0xff, 0x0a, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff,
+    0x12, 0x00, 0xe4, 0xec, 0xff, 0x09, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00,
+    0xeb, 0xff, 0x09, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xeb, 0xff, 0x09,
+    0xe6, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xeb, 0x8e, 0x08, 0x80, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xe7, 0x00, 0x05, 0xff, 0xff, 0x12, 0xf6, 0xff, 0x2a, 0xe8,
+    0x02, 0x04, 0x16, 0xff, 0xff, 0x0a, 0xba, 0xe4, 0xff, 0x04, 0xcc, 0x00, 0x1e, 0xc2, 0xfc, 0xe7,
+    0xff, 0x01, 0xca, 0x26, 0xfe, 0x00, 0x00, 0x08, 0xe8, 0x0e, 0x00, 0x08, 0xbe, 0x00,
 
     /*Unicode: U+f040 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x68, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xee, 0xff, 0xfc, 0x72, 0x00, 0x00, 0x00, 0x00,  //.................@@@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00,  //................@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x00, 0x00,  //...............@@@@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00,  //...............@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xdc, 0x2e, 0x0a, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //.............@..@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xea, 0x2e, 0x0a, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74,  //............@@@..@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xda, 0xe4, 0xea, 0x2e, 0x0a, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2a,  //...........@@@@@..@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3c, 0xe8, 0xff, 0xea, 0x2e, 0x0a, 0xc2, 0xff, 0xff, 0xf8, 0x4c, 0x00,  //..........@@@.@@@..@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3c, 0xe4, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x0a, 0xc2, 0xf8, 0x4c, 0x00, 0x00,  //.........@@@.@@@@@..@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x0a, 0x3e, 0x00, 0x00, 0x00,  //........@@@.@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x08, 0x00, 0x00, 0x00, 0x00,  //.......@@@.@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@.@@@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@@@@@@@+.......
-    0x00, 0x00, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.@@@@@@@@@+........
-    0x00, 0x38, 0xf0, 0xff, 0xee, 0x3a, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@.@@@@@@@@@+.........
-    0x38, 0xf0, 0xff, 0xe8, 0xfc, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@@@@+..........
-    0xf0, 0xff, 0xb6, 0x0a, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%.%@@@@@@@@+...........
-    0xff, 0xff, 0x16, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@...%@@@@@@+............
-    0xff, 0xff, 0x28, 0x16, 0x02, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@....%@@@@+.............
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x04, 0xde, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@...@@@+..............
-    0xff, 0xff, 0xff, 0xff, 0x26, 0x04, 0xa0, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@..%@@+...............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@+................
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+.................
-    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xbe, 0x00, 0x02, 0x1c, 0x68, 0x38, 0xec, 0x00, 0x04, 0x36, 0xee, 0xff, 0xfc, 0x72, 0xee, 0x00,
+    0x01, 0x38, 0xf0, 0xfd, 0xff, 0x00, 0x74, 0xf0, 0x00, 0x01, 0x32, 0xf0, 0xfb, 0xff, 0x00, 0x76,
+    0xf2, 0x00, 0x02, 0x04, 0x0a, 0xc2, 0xfa, 0xff, 0x00, 0x78, 0xf4, 0x00, 0x04, 0x38, 0xdc, 0x2e,
+    0x0a, 0xc2, 0xfa, 0xff, 0x00, 0x40, 0xf6, 0x00, 0x06, 0x38, 0xf0, 0xff, 0xea, 0x2e, 0x0a, 0xc2,
+    0xfb, 0xff, 0x00, 0x74, 0xf7, 0x00, 0x08, 0x38, 0xf0, 0xff, 0xda, 0xe4, 0xea, 0x2e, 0x0a, 0xc2,
+    0xfd, 0xff, 0x01, 0xf8, 0x2a, 0xf8, 0x00, 0x0e, 0x38, 0xf0, 0xff, 0xd4, 0x3c, 0xe8, 0xff, 0xea,
+    0x2e, 0x0a, 0xc2, 0xff, 0xff, 0xf8, 0x4c, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4, 0x3c, 0xe4,
+    0xfe, 0xff, 0x05, 0xea, 0x2e, 0x0a, 0xc2, 0xf8, 0x4c, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4,
+    0x3a, 0xe4, 0xfc, 0xff, 0x03, 0xea, 0x2e, 0x0a, 0x3e, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4,
+    0x3a, 0xe4, 0xfa, 0xff, 0x01, 0xe6, 0x08, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe4,
+    0xfa, 0xff, 0x01, 0xf8, 0x50, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xfa, 0xff,
+    0x01, 0xf8, 0x50, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xfa, 0xff, 0x01, 0xf8,
+    0x50, 0xf8, 0x00, 0x05, 0x38, 0xf0, 0xff, 0xd4, 0x3a, 0xe2, 0xfa, 0xff, 0x01, 0xf8, 0x50, 0xf8,
+    0x00, 0x05, 0x38, 0xf0, 0xff, 0xee, 0x3a, 0xe2, 0xfa, 0xff, 0x01, 0xf8, 0x50, 0xf8, 0x00, 0x05,
+    0x38, 0xf0, 0xff, 0xe8, 0xfc, 0xf4, 0xfa, 0xff, 0x01, 0xf8, 0x50, 0xf7, 0x00, 0x04, 0xf0, 0xff,
+    0xb6, 0x0a, 0xa2, 0xfa, 0xff, 0x01, 0xf8, 0x50, 0xf6, 0x00, 0x05, 0xff, 0xff, 0x16, 0x00, 0x00,
+    0xa2, 0xfc, 0xff, 0x01, 0xf8, 0x50, 0xf5, 0x00, 0x06, 0xff, 0xff, 0x28, 0x16, 0x02, 0x00, 0xa0,
+    0xfe, 0xff, 0x01, 0xf8, 0x50, 0xf4, 0x00, 0xfd, 0xff, 0x06, 0x22, 0x00, 0x04, 0xde, 0xff, 0xf8,
+    0x50, 0xf3, 0x00, 0xfd, 0xff, 0x05, 0x26, 0x04, 0xa0, 0xff, 0xf8, 0x50, 0xf2, 0x00, 0xfa, 0xff,
+    0x01, 0xf8, 0x50, 0xf1, 0x00, 0xfb, 0xff, 0x01, 0xf8, 0x50, 0xf0, 0x00, 0xfb, 0x0e, 0x00, 0x0a,
+    0xbd, 0x00,
 
     /*Unicode: U+f048 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x9a, 0xda, 0xda, 0xb2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x72,  //%@@%...........++
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf8, 0x92,  //@@@@..........+@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf8, 0xff, 0x92,  //@@@@.........+@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf8, 0xff, 0xff, 0x92,  //@@@@........+@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf8, 0xff, 0xff, 0xff, 0x92,  //@@@@.......+@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@......+@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@.....+@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x4e, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@....+@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x4c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@...+@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x4c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@..+@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x4c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@.+@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x70, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@+@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@%@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@.+@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@..+@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@...+@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@....+@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@.....+@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@......+@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@.......+@@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0x92,  //@@@@........+@@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x92,  //@@@@.........+@@%
-    0xff, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x92,  //@@@@..........+@%
-    0xbe, 0xff, 0xff, 0xd6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x86,  //%@@@...........+%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xdf, 0x00, 0x04, 0x9a, 0xda, 0xda, 0xb2, 0x04, 0xf7, 0x00, 0x01, 0x4e, 0x72, 0xfd, 0xff, 0x00,
+    0x22, 0xf8, 0x00, 0x02, 0x50, 0xf8, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xf9, 0x00, 0x03, 0x50, 0xf8,
+    0xff, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfa, 0x00, 0x04, 0x4e, 0xf8, 0xff, 0xff, 0x92, 0xfd, 0xff,
+    0x00, 0x22, 0xfb, 0x00, 0x01, 0x4e, 0xf8, 0xfe, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfc,
+    0x00, 0x01, 0x4e, 0xf8, 0xfd, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfd, 0x00, 0x01, 0x4e,
+    0xf8, 0xfc, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfe, 0x00, 0x01, 0x4e, 0xf8, 0xfb, 0xff,
+    0x00, 0x92, 0xfd, 0xff, 0x04, 0x22, 0x00, 0x00, 0x4c, 0xf8, 0xfa, 0xff, 0x00, 0x92, 0xfd, 0xff,
+    0x03, 0x22, 0x00, 0x4c, 0xf8, 0xf9, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x02, 0x22, 0x4c, 0xf8, 0xf8,
+    0xff, 0x00, 0x92, 0xfd, 0xff, 0x01, 0x70, 0xf8, 0xf7, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0xfc,
+    0xf6, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x90, 0xf6, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x01, 0x22,
+    0x6e, 0xf7, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x02, 0x22, 0x00, 0x6e, 0xf8, 0xff, 0x00, 0x92, 0xfd,
+    0xff, 0x03, 0x22, 0x00, 0x00, 0x6e, 0xf9, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfe, 0x00,
+    0x00, 0x6e, 0xfa, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfd, 0x00, 0x00, 0x6e, 0xfb, 0xff,
+    0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfc, 0x00, 0x00, 0x6e, 0xfc, 0xff, 0x00, 0x92, 0xfd, 0xff,
+    0x00, 0x22, 0xfb, 0x00, 0x00, 0x6e, 0xfd, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xfa, 0x00,
+    0x00, 0x6e, 0xfe, 0xff, 0x00, 0x92, 0xfd, 0xff, 0x00, 0x22, 0xf9, 0x00, 0x03, 0x6e, 0xff, 0xff,
+    0x92, 0xfd, 0xff, 0x00, 0x22, 0xf8, 0x00, 0x07, 0x6e, 0xff, 0x92, 0xbe, 0xff, 0xff, 0xd6, 0x08,
+    0xf7, 0x00, 0x01, 0x6e, 0x86, 0xce, 0x00,
 
     /*Unicode: U+f04b () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0xcc, 0x76, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.....................
-    0xff, 0xff, 0xde, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+...................
-    0xff, 0xff, 0xff, 0xff, 0xc8, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@..................
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@%................
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x92, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@%..............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x74, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@+............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@.........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@%.......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x92, 0x12, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@%.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x74, 0x06, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@+...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x58, 0x00,  //@@@@@@@@@@@@@@@@@@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa2, 0x1a,  //@@@@@@@@@@@@@@@@@@@@@%.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x32, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x4c, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@+....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@+......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x86, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@%........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@%............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@+.............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+...............
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x88, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@%.................
-    0xff, 0xff, 0xfc, 0xa6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%...................
-    0xf8, 0xc2, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....................
-    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xd3, 0x00, 0x02, 0xcc, 0x76, 0x06, 0xed, 0x00, 0x03, 0xff, 0xff, 0xde, 0x58, 0xee, 0x00, 0xfd,
+    0xff, 0x01, 0xc8, 0x3c, 0xf0, 0x00, 0xfb, 0xff, 0x01, 0xae, 0x24, 0xf2, 0x00, 0xfa, 0xff, 0x02,
+    0xfa, 0x92, 0x12, 0xf4, 0x00, 0xf8, 0xff, 0x02, 0xee, 0x74, 0x06, 0xf6, 0x00, 0xf6, 0xff, 0x01,
+    0xde, 0x58, 0xf7, 0x00, 0xf4, 0xff, 0x01, 0xc8, 0x3c, 0xf9, 0x00, 0xf2, 0xff, 0x01, 0xae, 0x24,
+    0xfb, 0x00, 0xf1, 0xff, 0x02, 0xfa, 0x92, 0x12, 0xfd, 0x00, 0xef, 0xff, 0x04, 0xee, 0x74, 0x06,
+    0x00, 0x00, 0xed, 0xff, 0x02, 0xde, 0x58, 0x00, 0xeb, 0xff, 0x00, 0x98, 0xed, 0xff, 0x02, 0xfc,
+    0xa2, 0x1a, 0xee, 0xff, 0x03, 0xbe, 0x32, 0x00, 0x00, 0xf0, 0xff, 0x01, 0xd6, 0x4c, 0xfd, 0x00,
+    0xf2, 0xff, 0x02, 0xe8, 0x6a, 0x02, 0xfc, 0x00, 0xf4, 0xff, 0x02, 0xf6, 0x86, 0x0c, 0xfa, 0x00,
+    0xf6, 0xff, 0x02, 0xfc, 0xa4, 0x1c, 0xf8, 0x00, 0xf7, 0xff, 0x01, 0xbe, 0x32, 0xf6, 0x00, 0xf9,
+    0xff, 0x01, 0xd8, 0x4e, 0xf4, 0x00, 0xfb, 0xff, 0x02, 0xea, 0x6c, 0x02, 0xf3, 0x00, 0xfd, 0xff,
+    0x02, 0xf6, 0x88, 0x0e, 0xf1, 0x00, 0x04, 0xff, 0xff, 0xfc, 0xa6, 0x1e, 0xef, 0x00, 0x02, 0xf8,
+    0xc2, 0x34, 0xed, 0x00, 0x00, 0x1c, 0xbd, 0x00,
 
     /*Unicode: U+f04c () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x9a, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xca, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0xca, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0x9a,  //%@@@@@@@@@.....@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@+...+@@@@@@@@@@
-    0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x28, 0x00, 0x00, 0x00, 0x2a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc,  //%@@@@@@@@@.....@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xcf, 0x00, 0x00, 0x9a, 0xf9, 0xda, 0x01, 0xca, 0x1c, 0xfe, 0x00, 0x01, 0x1e, 0xca, 0xf9, 0xda,
+    0x00, 0x9a, 0xf7, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00,
+    0x00, 0x5a, 0xed, 0xff, 0x00, 0x5a, 0xfe, 0x00, 0x00, 0x5a, 0xf7, 0xff, 0x00, 0xbe, 0xf9, 0xff,
+    0x01, 0xee, 0x28, 0xfe, 0x00, 0x01, 0x2a, 0xee, 0xf9, 0xff, 0x00, 0xbc, 0xb6, 0x00,
 
     /*Unicode: U+f04d () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x9a, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0xda, 0x7a,  //%@@@@@@@@@@@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xcf, 0x00, 0x00, 0x9a, 0xea, 0xda, 0x00, 0x7a, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x01, 0xda, 0xbe, 0xea, 0xff, 0x00, 0x98, 0xb6, 0x00,
 
     /*Unicode: U+f051 () , Width: 17 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xda, 0xda, 0xb4, 0x04,  //+...........%@@%.
-    0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@+..........@@@@.
-    0xff, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@+.........@@@@.
-    0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@+........@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@+.......@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@+......@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@+.....@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@+....@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@+...@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@+..@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@@+.@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@@@+@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@@@%@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@@%.@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@@%..@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@@%...@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@@%....@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@@%.....@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@@%......@@@@.
-    0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@@%.......@@@@.
-    0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@@%........@@@@.
-    0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@@%.........@@@@.
-    0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x26,  //@%..........@@@@.
-    0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xd8, 0x0a,  //%...........%@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................
-
+    0xdf, 0x00, 0x00, 0x6e, 0xf6, 0x00, 0x06, 0x98, 0xda, 0xda, 0xb4, 0x04, 0xff, 0x72, 0xf7, 0x00,
+    0xfd, 0xff, 0x03, 0x26, 0xff, 0xff, 0x72, 0xf8, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfe, 0xff, 0x00,
+    0x70, 0xf9, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfd, 0xff, 0x00, 0x70, 0xfa, 0x00, 0xfd, 0xff, 0x00,
+    0x26, 0xfc, 0xff, 0x00, 0x70, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfb, 0xff, 0x00, 0x70, 0xfc,
+    0x00, 0xfd, 0xff, 0x00, 0x26, 0xfa, 0xff, 0x00, 0x70, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xf9,
+    0xff, 0x00, 0x6e, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xf8, 0xff, 0x02, 0x6e, 0x00, 0x00, 0xfd,
+    0xff, 0x00, 0x26, 0xf7, 0xff, 0x01, 0x6e, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xf6, 0xff, 0x00, 0x6e,
+    0xfd, 0xff, 0x00, 0x26, 0xf6, 0xff, 0x00, 0xfc, 0xfd, 0xff, 0x00, 0x26, 0xf6, 0xff, 0x00, 0x92,
+    0xfd, 0xff, 0x00, 0x26, 0xf7, 0xff, 0x01, 0x94, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xf8, 0xff, 0x02,
+    0x94, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xf9, 0xff, 0x00, 0x94, 0xfe, 0x00, 0xfd, 0xff, 0x00,
+    0x26, 0xfa, 0xff, 0x00, 0x94, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfb, 0xff, 0x00, 0x94, 0xfc,
+    0x00, 0xfd, 0xff, 0x00, 0x26, 0xfc, 0xff, 0x00, 0x94, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfd,
+    0xff, 0x00, 0x94, 0xfa, 0x00, 0xfd, 0xff, 0x00, 0x26, 0xfe, 0xff, 0x00, 0x94, 0xf9, 0x00, 0xfd,
+    0xff, 0x03, 0x26, 0xff, 0xff, 0x94, 0xf8, 0x00, 0xfd, 0xff, 0x02, 0x26, 0xff, 0x94, 0xf7, 0x00,
+    0xfd, 0xff, 0x01, 0x26, 0x92, 0xf6, 0x00, 0x04, 0xbc, 0xff, 0xff, 0xd8, 0x0a, 0xce, 0x00,
 
     /*Unicode: U+f052 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xee, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@+....
-    0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00,  //...+@@@@@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00,  //..+@@@@@@@@@@@@@@@@@@@+..
-    0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@+.
-    0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x7a, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x6c,  //+%%%%%%%%%%%%%%%%%%%%%%%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x12, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x0a,  //.........................
-    0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc,  //@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x92, 0x00, 0x02, 0x74, 0xee, 0x5c, 0xec, 0x00, 0x04, 0x76, 0xff, 0xff, 0xfc, 0x5c, 0xee, 0x00,
+    0x00, 0x76, 0xfd, 0xff, 0x01, 0xfc, 0x5c, 0xf0, 0x00, 0x00, 0x76, 0xfb, 0xff, 0x01, 0xfc, 0x5c,
+    0xf2, 0x00, 0x00, 0x76, 0xf9, 0xff, 0x01, 0xfc, 0x5c, 0xf4, 0x00, 0x00, 0x76, 0xf7, 0xff, 0x01,
+    0xfc, 0x5c, 0xf6, 0x00, 0x00, 0x76, 0xf5, 0xff, 0x01, 0xfc, 0x5c, 0xf8, 0x00, 0x00, 0x76, 0xf3,
+    0xff, 0x01, 0xfc, 0x5c, 0xfa, 0x00, 0x00, 0x76, 0xf1, 0xff, 0x01, 0xfc, 0x5c, 0xfc, 0x00, 0x00,
+    0x76, 0xef, 0xff, 0x01, 0xfc, 0x5c, 0xfe, 0x00, 0x00, 0x76, 0xed, 0xff, 0x03, 0xfc, 0x5c, 0x00,
+    0x74, 0xeb, 0xff, 0x02, 0xfc, 0x5c, 0x7a, 0xea, 0x86, 0x00, 0x6c, 0xe8, 0x00, 0x00, 0x12, 0xea,
+    0x36, 0x01, 0x0a, 0xe2, 0xea, 0xff, 0x00, 0xbc, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda,
+    0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x01, 0xda, 0xc0, 0xea, 0xff, 0x00, 0x9a, 0x84, 0x00,
 
     /*Unicode: U+f053 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xfc, 0x88, 0x00, 0x00, 0x00,  //............+@%...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00,  //...........+@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x00,  //..........+@@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,  //.........+@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x06,  //........+@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00,  //......+@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@......
-    0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@........
-    0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@.........
-    0x46, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@.........
-    0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@........
-    0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@@@@@@.......
-    0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00, 0x00,  //.....+@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00, 0x00,  //......+@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x14, 0x00,  //.......+@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0a,  //........+@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c,  //.........+@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00,  //..........+@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfc, 0xff, 0xff, 0x72, 0x00, 0x00,  //...........+@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xf0, 0x70, 0x00, 0x00, 0x00,  //............+@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xf4, 0x00, 0x00, 0x0a, 0xf1, 0x00, 0x02, 0x76, 0xfc, 0x88, 0xf3, 0x00, 0x00, 0x78, 0xfe, 0xff,
+    0x00, 0x8a, 0xf5, 0x00, 0x00, 0x78, 0xfc, 0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0x78, 0xfa, 0xff,
+    0x00, 0x30, 0xf9, 0x00, 0x00, 0x78, 0xfa, 0xff, 0x01, 0xc2, 0x06, 0xfa, 0x00, 0x00, 0x78, 0xfa,
+    0xff, 0x01, 0xc2, 0x0a, 0xfa, 0x00, 0x00, 0x78, 0xfa, 0xff, 0x01, 0xc2, 0x0a, 0xfa, 0x00, 0x00,
+    0x7a, 0xfa, 0xff, 0x01, 0xc2, 0x0a, 0xfa, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0x01, 0xc2, 0x0a, 0xfa,
+    0x00, 0x00, 0x7a, 0xfa, 0xff, 0x01, 0xc2, 0x0a, 0xfa, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0x01, 0xc2,
+    0x0a, 0xfa, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0x01, 0xc2, 0x0a, 0xfa, 0x00, 0x00, 0x54, 0xfa, 0xff,
+    0x01, 0xc2, 0x0a, 0xf9, 0x00, 0x01, 0x46, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01,
+    0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0,
+    0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc,
+    0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8,
+    0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff,
+    0x01, 0xd0, 0x14, 0xf8, 0x00, 0x01, 0x60, 0xfc, 0xfb, 0xff, 0x01, 0xd0, 0x0a, 0xf8, 0x00, 0x01,
+    0x60, 0xfc, 0xfb, 0xff, 0x00, 0x2c, 0xf7, 0x00, 0x01, 0x60, 0xfc, 0xfd, 0xff, 0x00, 0x72, 0xf5,
+    0x00, 0x04, 0x60, 0xfc, 0xff, 0xff, 0x72, 0xf3, 0x00, 0x02, 0x5e, 0xf0, 0x70, 0xc8, 0x00,
 
     /*Unicode: U+f054 () , Width: 18 */
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x0c, 0xc2, 0xee, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@.............
-    0x00, 0x0c, 0xc4, 0xff, 0xff, 0xf2, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@............
-    0x0c, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@...........
-    0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x26, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@.........
-    0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@@@........
-    0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@@@.......
-    0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00, 0x00,  //......@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00, 0x00,  //.......@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3c, 0x00,  //........@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x16,  //.........@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x12,  //.........@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00,  //........@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00,  //.......@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00,  //......@@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@......
-    0x00, 0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@@@.......
-    0x00, 0x3a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@@@........
-    0x32, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@.........
-    0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@..........
-    0x06, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@@@@...........
-    0x00, 0x06, 0xb2, 0xff, 0xff, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@............
-    0x00, 0x00, 0x06, 0xac, 0xe0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..................
-
+    0xfd, 0x00, 0x00, 0x06, 0xf2, 0x00, 0x03, 0x0c, 0xc2, 0xee, 0x3a, 0xf4, 0x00, 0x05, 0x0c, 0xc4,
+    0xff, 0xff, 0xf2, 0x3a, 0xf6, 0x00, 0x01, 0x0c, 0xc4, 0xfd, 0xff, 0x01, 0xf2, 0x3a, 0xf7, 0x00,
+    0x00, 0x78, 0xfb, 0xff, 0x01, 0xf2, 0x3a, 0xf8, 0x00, 0x01, 0x26, 0xe8, 0xfb, 0xff, 0x01, 0xf2,
+    0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xe8, 0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xe8,
+    0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xe8, 0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8,
+    0x00, 0x01, 0x2c, 0xe8, 0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xe8, 0xfb, 0xff,
+    0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xe8, 0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01,
+    0x2c, 0xe8, 0xfb, 0xff, 0x01, 0xf2, 0x3c, 0xf8, 0x00, 0x01, 0x2c, 0xea, 0xfb, 0xff, 0x01, 0xf2,
+    0x16, 0xf9, 0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x12, 0xfa, 0x00, 0x01, 0x3a, 0xf2,
+    0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xfa, 0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xfa,
+    0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xfa, 0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff,
+    0x01, 0xe8, 0x2c, 0xfa, 0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xfa, 0x00, 0x01,
+    0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xfa, 0x00, 0x01, 0x3a, 0xf2, 0xfb, 0xff, 0x01, 0xe8,
+    0x2c, 0xfa, 0x00, 0x01, 0x32, 0xf2, 0xfb, 0xff, 0x01, 0xe8, 0x2c, 0xf9, 0x00, 0x00, 0x74, 0xfb,
+    0xff, 0x01, 0xe8, 0x2c, 0xf8, 0x00, 0x01, 0x06, 0xb2, 0xfd, 0xff, 0x01, 0xe8, 0x2c, 0xf6, 0x00,
+    0x05, 0x06, 0xb2, 0xff, 0xff, 0xe8, 0x2c, 0xf4, 0x00, 0x03, 0x06, 0xac, 0xe0, 0x2c, 0xbf, 0x00,
 
     /*Unicode: U+f067 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb2, 0xc6, 0xc6, 0xc6, 0x9e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x1e, 0x76, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x6e, 0x0c,  //.+++++++@@@@@@%+++++++.
-    0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x44, 0xae, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xa6, 0x24,  //+%%%%%%%@@@@@@@%%%%%%%.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........%@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xea, 0xff, 0xff, 0xff, 0xd6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xcb, 0x00, 0x01, 0x24, 0xb2, 0xfe, 0xc6, 0x01, 0x9e, 0x0c, 0xf1, 0x00, 0x00, 0xa6, 0xfc, 0xff,
+    0x00, 0x6e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff,
+    0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff,
+    0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff,
+    0x00, 0x7e, 0xf9, 0x00, 0x01, 0x1e, 0x76, 0xfb, 0x7e, 0x00, 0xda, 0xfc, 0xff, 0x00, 0xbe, 0xfb,
+    0x7e, 0x02, 0x6e, 0x0c, 0xd6, 0xec, 0xff, 0x00, 0x9e, 0xeb, 0xff, 0x00, 0xc6, 0xeb, 0xff, 0x00,
+    0xc6, 0xeb, 0xff, 0x01, 0xc6, 0xea, 0xec, 0xff, 0x02, 0xb2, 0x44, 0xae, 0xfb, 0xb6, 0x00, 0xea,
+    0xfc, 0xff, 0x00, 0xda, 0xfb, 0xb6, 0x01, 0xa6, 0x24, 0xf9, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00,
+    0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00,
+    0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00,
+    0x7e, 0xf1, 0x00, 0x00, 0xb6, 0xfc, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x00, 0xae, 0xfc, 0xff, 0x00,
+    0x76, 0xf1, 0x00, 0x01, 0x44, 0xea, 0xfe, 0xff, 0x01, 0xd6, 0x1e, 0x86, 0x00,
 
     /*Unicode: U+f068 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x02, 0x2e, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x00,  //.......................
-    0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76,  //%@@@@@@@@@@@@@@@@@@@@@+
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,  //@@@@@@@@@@@@@@@@@@@@@@%
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x50,  //+@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0x81, 0x00, 0x9b, 0x00, 0x01, 0x02, 0x2e, 0xee, 0x36, 0x02, 0x26, 0x00, 0xae, 0xec, 0xff, 0x01,
+    0x76, 0xfc, 0xec, 0xff, 0x00, 0xc4, 0xeb, 0xff, 0x00, 0xc6, 0xeb, 0xff, 0x01, 0xc6, 0xf6, 0xec,
+    0xff, 0x02, 0xbe, 0x7e, 0xf6, 0xee, 0xff, 0x01, 0xee, 0x50, 0x81, 0x00, 0x81, 0x00, 0xd6, 0x00,
 
     /*Unicode: U+f071 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa8, 0xf6, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%@%.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............%@@@%............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf4, 0xff, 0xff, 0xff, 0xf4, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@@@@@%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x7e, 0x46, 0x46, 0x46, 0x7e, 0xff, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@+++++@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd8, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........@@@@.....@@@@........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@.....@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe6, 0xff, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@+...+@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@+...+@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@@@@+...+@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@@@+...+@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x24, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x22, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@+...+@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x0e, 0x0e, 0x0e, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@@@%...%@@@@@@@%....
-    0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@@@@@@@%...
-    0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00, 0x00,  //..+@@@@@@@@@+...+@@@@@@@@@+..
-    0x00, 0x00, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00,  //..@@@@@@@@@@+...+@@@@@@@@@@..
-    0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x00,  //.+@@@@@@@@@@+...+@@@@@@@@@@+.
-    0x06, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x12, 0x12, 0x12, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x06,  //.@@@@@@@@@@@%...%@@@@@@@@@@@.
-    0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x48, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x46,  //+@@@@@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x02, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x02, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xf5, 0x00, 0x04, 0x04, 0xa8, 0xf6, 0xa8, 0x04, 0xe9, 0x00, 0x00, 0x86, 0xfe, 0xff, 0x00, 0x86,
+    0xea, 0x00, 0x01, 0x1a, 0xf4, 0xfe, 0xff, 0x01, 0xf4, 0x1a, 0xeb, 0x00, 0x00, 0x9c, 0xfc, 0xff,
+    0x00, 0x9c, 0xec, 0x00, 0x01, 0x2a, 0xfc, 0xfc, 0xff, 0x01, 0xfa, 0x2a, 0xed, 0x00, 0x00, 0xb2,
+    0xfa, 0xff, 0x00, 0xb2, 0xee, 0x00, 0x00, 0x3c, 0xf8, 0xff, 0x00, 0x3c, 0xef, 0x00, 0x00, 0xc6,
+    0xf8, 0xff, 0x00, 0xc6, 0xf0, 0x00, 0x00, 0x52, 0xfe, 0xff, 0x00, 0x7e, 0xfe, 0x46, 0x00, 0x7e,
+    0xfe, 0xff, 0x00, 0x52, 0xf2, 0x00, 0x01, 0x02, 0xd8, 0xfe, 0xff, 0x00, 0x30, 0xfe, 0x00, 0x00,
+    0x32, 0xfe, 0xff, 0x01, 0xd8, 0x02, 0xf3, 0x00, 0x00, 0x68, 0xfd, 0xff, 0x00, 0x38, 0xfe, 0x00,
+    0x00, 0x3a, 0xfd, 0xff, 0x00, 0x68, 0xf4, 0x00, 0x01, 0x0a, 0xe6, 0xfd, 0xff, 0x00, 0x42, 0xfe,
+    0x00, 0x00, 0x44, 0xfd, 0xff, 0x01, 0xe6, 0x0a, 0xf5, 0x00, 0x00, 0x7e, 0xfc, 0xff, 0x00, 0x4a,
+    0xfe, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0x00, 0x7e, 0xf6, 0x00, 0x01, 0x14, 0xf2, 0xfc, 0xff, 0x00,
+    0x52, 0xfe, 0x00, 0x00, 0x56, 0xfc, 0xff, 0x01, 0xf0, 0x14, 0xf7, 0x00, 0x00, 0x94, 0xfb, 0xff,
+    0x00, 0x5c, 0xfe, 0x00, 0x00, 0x60, 0xfb, 0xff, 0x00, 0x92, 0xf8, 0x00, 0x01, 0x24, 0xfa, 0xfb,
+    0xff, 0x00, 0x64, 0xfe, 0x00, 0x00, 0x68, 0xfb, 0xff, 0x01, 0xf8, 0x22, 0xf9, 0x00, 0x00, 0xaa,
+    0xfa, 0xff, 0x00, 0x86, 0xfe, 0x0e, 0x00, 0x8a, 0xfa, 0xff, 0x00, 0xa8, 0xfa, 0x00, 0x00, 0x36,
+    0xec, 0xff, 0x00, 0x34, 0xfb, 0x00, 0x00, 0xbe, 0xec, 0xff, 0x00, 0xbe, 0xfc, 0x00, 0x00, 0x4a,
+    0xf8, 0xff, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0x7e, 0xf8, 0xff, 0x00, 0x48, 0xfd, 0x00, 0x00, 0xd2,
+    0xf8, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x00, 0x6a, 0xf8, 0xff, 0x00, 0xd0, 0xfe, 0x00, 0x00, 0x60,
+    0xf7, 0xff, 0x00, 0x6a, 0xfe, 0x00, 0x00, 0x6a, 0xf7, 0xff, 0x03, 0x5e, 0x00, 0x06, 0xe2, 0xf7,
+    0xff, 0x00, 0x8a, 0xfe, 0x12, 0x00, 0x8a, 0xf7, 0xff, 0x02, 0xe0, 0x06, 0x76, 0xe6, 0xff, 0x01,
+    0x74, 0xe6, 0xe6, 0xff, 0x01, 0xe6, 0xe6, 0xe6, 0xff, 0x02, 0xe6, 0x48, 0xf0, 0xe8, 0xff, 0x03,
+    0xee, 0x46, 0x00, 0x02, 0xe8, 0x12, 0x00, 0x02, 0xc6, 0x00,
 
     /*Unicode: U+f074 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xfc, 0x5e, 0x00, 0x00,  //.......................@@@+..
-    0xa2, 0xb6, 0xb6, 0xb6, 0xaa, 0x8c, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x66, 0x9e, 0xb2, 0xb6, 0xb6, 0xb6, 0xc6, 0xff, 0xff, 0xff, 0xfc, 0x5e, 0x00,  //%%%%%%+.........+%%%%%@@@@@+.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8c, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x06, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde,  //@@@@@@@@@+...%@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x00, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2a,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0x58, 0x6a, 0x6a, 0x6a, 0x7c, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x62, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x98, 0x6e, 0x6a, 0x6a, 0x6a, 0x8a, 0xff, 0xff, 0xff, 0xe8, 0x2a, 0x00,  //+++++%@@@@++@@@@@%++++%@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf8, 0xff, 0xdc, 0x10, 0xea, 0xff, 0xff, 0xff, 0xe6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xe8, 0x2a, 0x00, 0x00,  //......+@@@.@@@@@.......@@@...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0x62, 0x7c, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xe8, 0x2a, 0x00, 0x00, 0x00,  //.......+@++@@@@........@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbe, 0x10, 0xec, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xe4, 0x28, 0x00, 0x00, 0x00, 0x00,  //........%.@@@@%........@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x6a, 0xff, 0xff, 0xff, 0xfc, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@%...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0xc6, 0x22, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xd6, 0x20, 0x00, 0x00, 0x00, 0x00,  //........@@@@@.%........@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x94, 0xfc, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xe0, 0x20, 0x00, 0x00, 0x00,  //.......+@@@@+%@........@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf6, 0xff, 0xff, 0xff, 0xc8, 0x1c, 0xf6, 0xff, 0xdc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xe0, 0x20, 0x00, 0x00,  //.......@@@@@.@@@.......@@@...
-    0x4c, 0x5e, 0x5e, 0x5e, 0x6e, 0xa4, 0xfc, 0xff, 0xff, 0xff, 0xfa, 0x34, 0x9c, 0xff, 0xff, 0xff, 0xf4, 0x96, 0x68, 0x5e, 0x5e, 0x5e, 0x82, 0xff, 0xff, 0xff, 0xe0, 0x22, 0x00,  //+++++%@@@@@.%@@@@%++++%@@@@..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x22,  //@@@@@@@@@@+.%@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00, 0x0c, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@%...@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x98, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e,  //@@@@@@@@+.....%@@@@@@@@@@@@@+
-    0xb0, 0xc2, 0xc2, 0xc2, 0xbc, 0xa2, 0x60, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x74, 0xa6, 0xc0, 0xc8, 0xc8, 0xc6, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00,  //%@@@%%+.........+%%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0x6c, 0x00, 0x00,  //.......................@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00,  //.......................@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00,  //.......................@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0xeb, 0x00, 0x01, 0x04, 0x30, 0xe6, 0x00, 0x02, 0x34, 0xfc, 0x5c, 0xe7, 0x00, 0x03, 0x36, 0xff,
+    0xfc, 0x5c, 0xe8, 0x00, 0x07, 0x36, 0xff, 0xff, 0xfc, 0x5e, 0x00, 0x00, 0xa2, 0xfe, 0xb6, 0x03,
+    0xaa, 0x8c, 0x50, 0x04, 0xfa, 0x00, 0x03, 0x10, 0x66, 0x9e, 0xb2, 0xfe, 0xb6, 0x00, 0xc6, 0xfe,
+    0xff, 0x02, 0xfc, 0x5e, 0x00, 0xfa, 0xff, 0x01, 0xe6, 0x50, 0xfd, 0x00, 0x02, 0x04, 0x8c, 0xf6,
+    0xf6, 0xff, 0x01, 0xfc, 0x60, 0xf8, 0xff, 0x04, 0x80, 0x00, 0x00, 0x06, 0xba, 0xf3, 0xff, 0x00,
+    0xde, 0xf7, 0xff, 0x02, 0x66, 0x00, 0xaa, 0xf3, 0xff, 0x02, 0xe8, 0x2a, 0x58, 0xfe, 0x6a, 0x01,
+    0x7c, 0xb8, 0xfd, 0xff, 0x01, 0x6e, 0x62, 0xfd, 0xff, 0x02, 0xf4, 0x98, 0x6e, 0xfe, 0x6a, 0x00,
+    0x8a, 0xfe, 0xff, 0x01, 0xe8, 0x2a, 0xfa, 0x00, 0x05, 0x4c, 0xf8, 0xff, 0xdc, 0x10, 0xea, 0xfe,
+    0xff, 0x01, 0xe6, 0x24, 0xfc, 0x00, 0x04, 0x36, 0xff, 0xff, 0xe8, 0x2a, 0xf8, 0x00, 0x03, 0x78,
+    0xff, 0x62, 0x7c, 0xfe, 0xff, 0x01, 0xfc, 0x3c, 0xfb, 0x00, 0x03, 0x36, 0xff, 0xe8, 0x2a, 0xf7,
+    0x00, 0x03, 0x02, 0xbe, 0x10, 0xec, 0xfe, 0xff, 0x00, 0xa0, 0xfa, 0x00, 0x02, 0x2a, 0xe4, 0x28,
+    0xf5, 0x00, 0x01, 0x0c, 0x6a, 0xfe, 0xff, 0x01, 0xfc, 0x24, 0xea, 0x00, 0x00, 0xda, 0xfe, 0xff,
+    0x00, 0xac, 0xea, 0x00, 0x00, 0x52, 0xfd, 0xff, 0x01, 0x3a, 0x08, 0xeb, 0x00, 0x00, 0xce, 0xfe,
+    0xff, 0x02, 0xc6, 0x22, 0x98, 0xfa, 0x00, 0x02, 0x28, 0xd6, 0x20, 0xf6, 0x00, 0x00, 0x66, 0xfd,
+    0xff, 0x03, 0x4e, 0x94, 0xfc, 0x34, 0xfb, 0x00, 0x03, 0x36, 0xff, 0xe0, 0x20, 0xf8, 0x00, 0x01,
+    0x40, 0xf6, 0xfe, 0xff, 0x05, 0xc8, 0x1c, 0xf6, 0xff, 0xdc, 0x1c, 0xfc, 0x00, 0x07, 0x36, 0xff,
+    0xff, 0xe0, 0x20, 0x00, 0x00, 0x4c, 0xfe, 0x5e, 0x02, 0x6e, 0xa4, 0xfc, 0xfe, 0xff, 0x02, 0xfa,
+    0x34, 0x9c, 0xfe, 0xff, 0x02, 0xf4, 0x96, 0x68, 0xfe, 0x5e, 0x00, 0x82, 0xfe, 0xff, 0x02, 0xe0,
+    0x22, 0x00, 0xf7, 0xff, 0x02, 0x78, 0x00, 0xac, 0xf3, 0xff, 0x01, 0xe0, 0x22, 0xf8, 0xff, 0x04,
+    0x96, 0x00, 0x00, 0x0c, 0xc6, 0xf3, 0xff, 0x00, 0xda, 0xfa, 0xff, 0x01, 0xf2, 0x72, 0xfd, 0x00,
+    0x02, 0x0a, 0x98, 0xfc, 0xf5, 0xff, 0x01, 0x6e, 0xb0, 0xfe, 0xc2, 0x03, 0xbc, 0xa2, 0x60, 0x0a,
+    0xfa, 0x00, 0x07, 0x22, 0x74, 0xa6, 0xc0, 0xc8, 0xc8, 0xc6, 0xd0, 0xfd, 0xff, 0x00, 0x6e, 0xea,
+    0x00, 0x00, 0x36, 0xfe, 0xff, 0x00, 0x6c, 0xe9, 0x00, 0x03, 0x36, 0xff, 0xff, 0x6c, 0xe8, 0x00,
+    0x02, 0x36, 0xff, 0x6a, 0xe7, 0x00, 0x01, 0x06, 0x3e, 0xa5, 0x00,
 
     /*Unicode: U+f077 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xd8, 0xe2, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xda, 0xff, 0xff, 0xe6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xda, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........@@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@@@@@@@@........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x1c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x00, 0x1c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x3e, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@+.@@@@@@@@.....
-    0x00, 0x00, 0x1c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00, 0x00,  //...@@@@@@@@+...@@@@@@@@....
-    0x00, 0x1c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00, 0x00,  //..@@@@@@@@+.....@@@@@@@@...
-    0x1c, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x28, 0x00,  //.@@@@@@@@+.......@@@@@@@@..
-    0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x04,  //@@@@@@@@+.........@@@@@@@@.
-    0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x02,  //@@@@@@@+...........@@@@@@@.
-    0x10, 0xcc, 0xff, 0xff, 0xff, 0xfa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xff, 0xff, 0xda, 0x1a, 0x00,  //.@@@@@+.............@@@@@..
-    0x00, 0x10, 0xca, 0xff, 0xfa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf4, 0xff, 0xd8, 0x1a, 0x00, 0x00,  //..@@@+...............@@@...
-    0x00, 0x00, 0x0e, 0x90, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x96, 0x18, 0x00, 0x00, 0x00,  //...%+.................%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x81, 0x00, 0xb8, 0x00, 0x01, 0x02, 0x04, 0xe9, 0x00, 0x03, 0x1a, 0xd8, 0xe2, 0x26, 0xeb, 0x00,
+    0x05, 0x1a, 0xda, 0xff, 0xff, 0xe6, 0x26, 0xed, 0x00, 0x01, 0x1a, 0xda, 0xfd, 0xff, 0x01, 0xe6,
+    0x26, 0xef, 0x00, 0x01, 0x1a, 0xda, 0xfb, 0xff, 0x01, 0xe6, 0x26, 0xf1, 0x00, 0x01, 0x1c, 0xda,
+    0xf9, 0xff, 0x01, 0xe6, 0x28, 0xf3, 0x00, 0x01, 0x1c, 0xda, 0xf7, 0xff, 0x01, 0xe6, 0x28, 0xf5,
+    0x00, 0x01, 0x1c, 0xda, 0xf5, 0xff, 0x01, 0xe6, 0x28, 0xf7, 0x00, 0x01, 0x1c, 0xdc, 0xfb, 0xff,
+    0x01, 0xf8, 0xf4, 0xfb, 0xff, 0x01, 0xe6, 0x28, 0xf9, 0x00, 0x01, 0x1c, 0xdc, 0xfb, 0xff, 0x03,
+    0xf8, 0x50, 0x3e, 0xf4, 0xfb, 0xff, 0x01, 0xe6, 0x28, 0xfb, 0x00, 0x01, 0x1c, 0xdc, 0xfb, 0xff,
+    0x05, 0xf8, 0x50, 0x00, 0x00, 0x3e, 0xf4, 0xfb, 0xff, 0x01, 0xe6, 0x28, 0xfd, 0x00, 0x01, 0x1c,
+    0xdc, 0xfb, 0xff, 0x01, 0xf8, 0x50, 0xfd, 0x00, 0x01, 0x3e, 0xf4, 0xfb, 0xff, 0x05, 0xe6, 0x28,
+    0x00, 0x00, 0x1c, 0xdc, 0xfb, 0xff, 0x01, 0xf8, 0x50, 0xfb, 0x00, 0x01, 0x3e, 0xf4, 0xfb, 0xff,
+    0x03, 0xe6, 0x28, 0x00, 0xd4, 0xfb, 0xff, 0x01, 0xfa, 0x50, 0xf9, 0x00, 0x01, 0x40, 0xf4, 0xfb,
+    0xff, 0x02, 0xe4, 0x04, 0xc4, 0xfc, 0xff, 0x01, 0xfa, 0x50, 0xf7, 0x00, 0x01, 0x40, 0xf4, 0xfc,
+    0xff, 0x03, 0xd6, 0x02, 0x10, 0xcc, 0xfe, 0xff, 0x01, 0xfa, 0x52, 0xf5, 0x00, 0x01, 0x40, 0xf4,
+    0xfe, 0xff, 0x08, 0xda, 0x1a, 0x00, 0x00, 0x10, 0xca, 0xff, 0xfa, 0x52, 0xf3, 0x00, 0x04, 0x40,
+    0xf4, 0xff, 0xd8, 0x1a, 0xfd, 0x00, 0x02, 0x0e, 0x90, 0x48, 0xf1, 0x00, 0x02, 0x3a, 0x96, 0x18,
+    0x81, 0x00, 0xf7, 0x00,
 
     /*Unicode: U+f078 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x6c, 0xfc, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0x82, 0x00, 0x00, 0x00,  //..+@@................%@%...
-    0x00, 0x6e, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00,  //.+@@@@..............%@@@%..
-    0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00,  //+@@@@@@............%@@@@@%.
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0a,  //@@@@@@@@..........%@@@@@@@.
-    0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00,  //+@@@@@@@@........%@@@@@@@+.
-    0x00, 0x68, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00,  //.+@@@@@@@@......%@@@@@@@+..
-    0x00, 0x00, 0x68, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x00, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00,  //..+@@@@@@@@....%@@@@@@@+...
-    0x00, 0x00, 0x00, 0x68, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x10, 0x08, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@@..%@@@@@@@+....
-    0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@%@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfc, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@@@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xfc, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@@+............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............++.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0x81, 0x00, 0xa6, 0x00, 0x01, 0x24, 0x08, 0xf1, 0x00, 0x01, 0x04, 0x28, 0xfb, 0x00, 0x03, 0x6c,
+    0xfc, 0xcc, 0x10, 0xf3, 0x00, 0x03, 0x08, 0xbc, 0xff, 0x82, 0xfd, 0x00, 0x00, 0x6e, 0xfe, 0xff,
+    0x01, 0xcc, 0x10, 0xf5, 0x00, 0x01, 0x08, 0xbc, 0xfe, 0xff, 0x03, 0x82, 0x00, 0x00, 0x6c, 0xfc,
+    0xff, 0x01, 0xcc, 0x10, 0xf7, 0x00, 0x01, 0x08, 0xbc, 0xfc, 0xff, 0x02, 0x82, 0x00, 0xf0, 0xfb,
+    0xff, 0x01, 0xcc, 0x10, 0xf9, 0x00, 0x01, 0x08, 0xbc, 0xfb, 0xff, 0x03, 0xfc, 0x0a, 0x66, 0xfc,
+    0xfb, 0xff, 0x01, 0xcc, 0x10, 0xfb, 0x00, 0x01, 0x08, 0xbc, 0xfa, 0xff, 0x04, 0x7c, 0x00, 0x00,
+    0x68, 0xfc, 0xfb, 0xff, 0x01, 0xcc, 0x10, 0xfd, 0x00, 0x01, 0x08, 0xbc, 0xfa, 0xff, 0x00, 0x7e,
+    0xfd, 0x00, 0x01, 0x68, 0xfc, 0xfb, 0xff, 0x05, 0xcc, 0x10, 0x00, 0x00, 0x08, 0xbc, 0xfa, 0xff,
+    0x00, 0x7e, 0xfb, 0x00, 0x01, 0x68, 0xfc, 0xfb, 0xff, 0x03, 0xcc, 0x10, 0x08, 0xbc, 0xfa, 0xff,
+    0x00, 0x7e, 0xf9, 0x00, 0x01, 0x66, 0xfc, 0xfb, 0xff, 0x01, 0xcc, 0xbc, 0xfa, 0xff, 0x00, 0x7c,
+    0xf7, 0x00, 0x01, 0x66, 0xfc, 0xf4, 0xff, 0x00, 0x7c, 0xf5, 0x00, 0x01, 0x66, 0xfc, 0xf6, 0xff,
+    0x00, 0x7c, 0xf3, 0x00, 0x01, 0x66, 0xfc, 0xf8, 0xff, 0x00, 0x7c, 0xf1, 0x00, 0x01, 0x66, 0xfc,
+    0xfa, 0xff, 0x00, 0x7c, 0xef, 0x00, 0x01, 0x66, 0xfc, 0xfc, 0xff, 0x00, 0x7c, 0xed, 0x00, 0x01,
+    0x64, 0xfc, 0xfe, 0xff, 0x00, 0x7a, 0xeb, 0x00, 0x03, 0x64, 0xfc, 0xff, 0x7a, 0xe9, 0x00, 0x01,
+    0x4a, 0x56, 0x88, 0x00,
 
     /*Unicode: U+f079 () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xe4, 0x2a, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@...%@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xdc, 0x12, 0x00, 0x16, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@@...@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x04, 0x00, 0x2e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@...@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x38, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x4e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@%..+@@@@@@@@@@@@@@.....
-    0x00, 0x1c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x00, 0x00, 0x14, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x50, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@@@+...........+@@@@.....
-    0x0a, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@+...........@@@@.....
-    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@...........@@@@.....
-    0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..........@@@@.....
-    0x1a, 0x42, 0x42, 0x42, 0xe4, 0xff, 0xff, 0xff, 0x76, 0x42, 0x42, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+++@@@@+++............@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@@+..............@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x46, 0x46, 0x6e, 0xff, 0xff, 0xff, 0xf2, 0x46, 0x46, 0x46, 0x20, 0x00,  //....@@@@+...........+++@@@@+++..
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x06,  //....@@@@+.........+@@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x00,  //....@@@@+..........@@@@@@@@@@@%.
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x10, 0x00,  //....@@@@+...........@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0x60, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1a, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x24, 0x00, 0x00,  //....@@@@+...........+@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x42, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@+..%@@@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3e, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@...%@@@@+....
-    0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x20, 0x00, 0x0c, 0xd2, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@...@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00, 0x1e, 0xdc, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@%...@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0x81, 0x00, 0xd6, 0x00, 0xf2, 0x02, 0xf6, 0x00, 0x05, 0xa4, 0xe4, 0x2a, 0x00, 0x00, 0x82, 0xf2,
+    0xff, 0x00, 0xe0, 0xf8, 0x00, 0x07, 0x86, 0xff, 0xff, 0xdc, 0x12, 0x00, 0x16, 0xe0, 0xf3, 0xff,
+    0x00, 0xee, 0xf9, 0x00, 0x00, 0x5c, 0xfd, 0xff, 0x04, 0xc2, 0x04, 0x00, 0x2e, 0xf2, 0xf4, 0xff,
+    0x00, 0xee, 0xfa, 0x00, 0x01, 0x38, 0xf6, 0xfc, 0xff, 0x04, 0x9e, 0x00, 0x00, 0x4e, 0xfc, 0xf5,
+    0xff, 0x00, 0xee, 0xfb, 0x00, 0x01, 0x1c, 0xe8, 0xfa, 0xff, 0x03, 0x74, 0x00, 0x00, 0x14, 0xf9,
+    0x1e, 0x00, 0x50, 0xfe, 0xff, 0x00, 0xee, 0xfc, 0x00, 0x01, 0x0a, 0xd0, 0xf9, 0xff, 0x01, 0xfc,
+    0x4c, 0xf7, 0x00, 0x00, 0x36, 0xfe, 0xff, 0x00, 0xee, 0xfc, 0x00, 0x00, 0xaa, 0xf7, 0xff, 0x01,
+    0xf2, 0x20, 0xf8, 0x00, 0x00, 0x36, 0xfe, 0xff, 0x00, 0xee, 0xfc, 0x00, 0x00, 0xe6, 0xf6, 0xff,
+    0x00, 0x50, 0xf8, 0x00, 0x00, 0x36, 0xfe, 0xff, 0x00, 0xee, 0xfc, 0x00, 0x00, 0x1a, 0xfe, 0x42,
+    0x00, 0xe4, 0xfe, 0xff, 0x03, 0x76, 0x42, 0x42, 0x36, 0xf7, 0x00, 0x00, 0x36, 0xfe, 0xff, 0x00,
+    0xee, 0xf8, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0x46, 0xf4, 0x00, 0x00, 0x36, 0xfe, 0xff, 0x00,
+    0xee, 0xf8, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0x46, 0xf7, 0x00, 0x03, 0x34, 0x46, 0x46, 0x6e,
+    0xfe, 0xff, 0x00, 0xf2, 0xfe, 0x46, 0x00, 0x20, 0xfc, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0x46,
+    0xf8, 0x00, 0x00, 0x42, 0xf6, 0xff, 0x01, 0xf2, 0x06, 0xfd, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00,
+    0x46, 0xf8, 0x00, 0x01, 0x18, 0xe8, 0xf7, 0xff, 0x00, 0xb8, 0xfc, 0x00, 0x00, 0xda, 0xfe, 0xff,
+    0x00, 0x46, 0xf7, 0x00, 0x01, 0x38, 0xf6, 0xf9, 0xff, 0x01, 0xd8, 0x10, 0xfc, 0x00, 0x00, 0xda,
+    0xfe, 0xff, 0x00, 0x60, 0xf9, 0x22, 0x03, 0x1a, 0x00, 0x00, 0x5e, 0xfa, 0xff, 0x01, 0xee, 0x24,
+    0xfb, 0x00, 0x00, 0xda, 0xf4, 0xff, 0x03, 0x66, 0x00, 0x00, 0x88, 0xfc, 0xff, 0x01, 0xfa, 0x42,
+    0xfa, 0x00, 0x00, 0xda, 0xf4, 0xff, 0x04, 0xf8, 0x3e, 0x00, 0x00, 0xb0, 0xfd, 0xff, 0x00, 0x6a,
+    0xf9, 0x00, 0x00, 0xda, 0xf3, 0xff, 0x07, 0xea, 0x20, 0x00, 0x0c, 0xd2, 0xff, 0xff, 0x96, 0xf8,
+    0x00, 0x00, 0xca, 0xf2, 0xff, 0x06, 0x96, 0x00, 0x00, 0x1e, 0xdc, 0xb0, 0x02, 0x81, 0x00, 0xdc,
+    0x00,
 
     /*Unicode: U+f07b () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x1e, 0x94, 0xc2, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xb0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@@@%+................
-    0x2a, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@@@@%...............
-    0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@...............
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@+..............
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x9c, 0x68, 0x06, 0x00,  //@@@@@@@@@@@@@%%%%%%%%%%%+..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x0e,  //@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x48, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38,  //+@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x00, 0x48, 0xcc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc6, 0x3c, 0x00,  //.+@@@@@@@@@@@@@@@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xca, 0x00, 0x02, 0x1e, 0x94, 0xc2, 0xfc, 0xc6, 0x01, 0xb0, 0x54, 0xf1, 0x00, 0x01, 0x2a, 0xec,
+    0xf8, 0xff, 0x00, 0x84, 0xf2, 0x00, 0x00, 0xb8, 0xf7, 0xff, 0x01, 0xfc, 0x24, 0xf3, 0x00, 0x00,
+    0xf6, 0xf6, 0xff, 0x00, 0x62, 0xf3, 0x00, 0xf5, 0xff, 0x00, 0xc8, 0xf7, 0xa2, 0x03, 0x9c, 0x68,
+    0x06, 0x00, 0xe8, 0xff, 0x01, 0xce, 0x0e, 0xe7, 0xff, 0x00, 0x92, 0xe7, 0xff, 0x00, 0xdc, 0xe7,
+    0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7,
+    0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7,
+    0xff, 0x00, 0xea, 0xe7, 0xff, 0x00, 0xea, 0xe7, 0xff, 0x01, 0xea, 0xfa, 0xe8, 0xff, 0x01, 0xe6,
+    0xcc, 0xe8, 0xff, 0x02, 0xb8, 0x48, 0xfc, 0xea, 0xff, 0x05, 0xf8, 0x38, 0x00, 0x48, 0xcc, 0xfa,
+    0xee, 0xff, 0x02, 0xf8, 0xc6, 0x3c, 0x81, 0x00, 0xf9, 0x00,
 
     /*Unicode: U+f093 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xb0, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........@@@@@...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........@@@@@@@@@@@........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@@@@@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x90, 0x92, 0x92, 0x92, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x92, 0x92, 0x92, 0x8e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%%%%@@@@@@@%%%%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@%..........
-    0x00, 0x1a, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x52, 0xd6, 0xda, 0xda, 0xda, 0xd4, 0x40, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1a, 0x00,  //..........+@@@@@...........
-    0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c,  //%@@@@@@@@.........@@@@@@@@%
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x50, 0x28, 0x26, 0x26, 0x26, 0x2a, 0x58, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@@+.....+@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x14, 0x54, 0xff, 0xff, 0x38, 0x48, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x16, 0x54, 0xff, 0xff, 0x3a, 0x4a, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@.+@@.+@@
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xda, 0x00, 0x02, 0x3a, 0xb0, 0x2c, 0xea, 0x00, 0x04, 0x3e, 0xf2, 0xff, 0xea, 0x2e, 0xec, 0x00,
+    0x01, 0x3e, 0xf2, 0xfe, 0xff, 0x01, 0xea, 0x2e, 0xee, 0x00, 0x01, 0x3e, 0xf2, 0xfc, 0xff, 0x01,
+    0xea, 0x2e, 0xf0, 0x00, 0x01, 0x3e, 0xf2, 0xfa, 0xff, 0x01, 0xea, 0x2e, 0xf2, 0x00, 0x01, 0x3e,
+    0xf2, 0xf8, 0xff, 0x01, 0xea, 0x2e, 0xf4, 0x00, 0x01, 0x3e, 0xf2, 0xf6, 0xff, 0x01, 0xea, 0x2e,
+    0xf6, 0x00, 0x01, 0x3c, 0xf2, 0xf4, 0xff, 0x01, 0xea, 0x2c, 0xf7, 0x00, 0x00, 0xc0, 0xf2, 0xff,
+    0x00, 0xaa, 0xf7, 0x00, 0x01, 0x3a, 0x90, 0xfe, 0x92, 0x00, 0xd8, 0xfc, 0xff, 0x00, 0xce, 0xfe,
+    0x92, 0x01, 0x8e, 0x30, 0xf2, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2,
+    0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2,
+    0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2,
+    0xfc, 0xff, 0x00, 0x8e, 0xed, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0x8e, 0xf6, 0x00, 0x00, 0x1a,
+    0xfb, 0x22, 0x03, 0x10, 0x00, 0x52, 0xd6, 0xfe, 0xda, 0x03, 0xd4, 0x40, 0x00, 0x12, 0xfb, 0x22,
+    0x02, 0x1a, 0x00, 0xa0, 0xfa, 0xff, 0x01, 0xd0, 0x08, 0xfa, 0x00, 0x01, 0x10, 0xde, 0xfa, 0xff,
+    0x01, 0x9c, 0xfa, 0xf9, 0xff, 0x02, 0xcc, 0x50, 0x28, 0xfe, 0x26, 0x02, 0x2a, 0x58, 0xd6, 0xf9,
+    0xff, 0x00, 0xfa, 0xb9, 0xff, 0x06, 0xd4, 0x14, 0x54, 0xff, 0xff, 0x38, 0x48, 0xed, 0xff, 0x09,
+    0xd4, 0x16, 0x54, 0xff, 0xff, 0x3a, 0x4a, 0xff, 0xff, 0xf8, 0xe8, 0xff, 0x01, 0xf8, 0x90, 0xe8,
+    0xff, 0x02, 0x90, 0x00, 0x08, 0xea, 0x0e, 0x00, 0x08, 0xca, 0x00,
 
     /*Unicode: U+f095 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x38, 0x92, 0xbe, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%%+.................
-    0x00, 0x5c, 0xfc, 0xff, 0xff, 0xea, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@@.................
-    0x18, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@%................
-    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@................
-    0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@...............
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%...............
-    0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@%................
-    0x6a, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@%.................
-    0x12, 0xf8, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@+.................
-    0x00, 0xa6, 0xff, 0xff, 0xff, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@@@.................
-    0x00, 0x38, 0xff, 0xff, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@%................
-    0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@+...............
-    0x00, 0x00, 0x18, 0xea, 0xff, 0xff, 0xff, 0xf6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@...............
-    0x00, 0x00, 0x00, 0x4a, 0xfc, 0xff, 0xff, 0xff, 0xea, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@..............
-    0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc0, 0xff, 0xb4, 0x1e, 0x00, 0x00, 0x00,  //....+@@@@@+.....%@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x1a, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0xf6, 0x88, 0x0e, 0x00,  //.....%@@@@@%...%@@@@%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x80, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x58,  //......%@@@@@@+%@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe,  //.......+@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,  //........+@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x38,  //..........%@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xa6, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x5c, 0x00,  //............%@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x6a, 0xbc, 0xf0, 0xf4, 0xd2, 0x80, 0x18, 0x00, 0x00,  //..............+%@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0xd1, 0x00, 0x03, 0x38, 0x92, 0xbe, 0x58, 0xef, 0x00, 0x05, 0x5c, 0xfc, 0xff, 0xff, 0xea, 0x0e,
+    0xf1, 0x00, 0x01, 0x18, 0xf2, 0xfd, 0xff, 0x00, 0x88, 0xf1, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x01,
+    0xf6, 0x1e, 0xf2, 0x00, 0x00, 0xd2, 0xfb, 0xff, 0x00, 0xb4, 0xf2, 0x00, 0x00, 0xf4, 0xfa, 0xff,
+    0x00, 0x30, 0xf3, 0x00, 0x00, 0xf0, 0xfb, 0xff, 0x01, 0xc0, 0x06, 0xf3, 0x00, 0x00, 0xbc, 0xfc,
+    0xff, 0x01, 0xa8, 0x06, 0xf2, 0x00, 0x00, 0x6a, 0xfd, 0xff, 0x00, 0xa2, 0xf0, 0x00, 0x01, 0x12,
+    0xf8, 0xfe, 0xff, 0x00, 0x80, 0xef, 0x00, 0x00, 0xa6, 0xfe, 0xff, 0x01, 0xf0, 0x1a, 0xf0, 0x00,
+    0x00, 0x38, 0xfd, 0xff, 0x00, 0xae, 0xef, 0x00, 0x00, 0xae, 0xfd, 0xff, 0x00, 0x5c, 0xf0, 0x00,
+    0x01, 0x18, 0xea, 0xfe, 0xff, 0x01, 0xf6, 0x38, 0xf0, 0x00, 0x01, 0x4a, 0xfc, 0xfe, 0xff, 0x01,
+    0xea, 0x38, 0xfb, 0x00, 0x01, 0x06, 0x30, 0xf8, 0x00, 0x00, 0x74, 0xfd, 0xff, 0x01, 0xf6, 0x5c,
+    0xfd, 0x00, 0x04, 0x06, 0xc0, 0xff, 0xb4, 0x1e, 0xf9, 0x00, 0x00, 0x8a, 0xfc, 0xff, 0x04, 0xb0,
+    0x1a, 0x00, 0x00, 0xa8, 0xfe, 0xff, 0x02, 0xf6, 0x88, 0x0e, 0xfa, 0x00, 0x00, 0x8a, 0xfc, 0xff,
+    0x02, 0xf0, 0x80, 0xa2, 0xfb, 0xff, 0x01, 0xea, 0x58, 0xfa, 0x00, 0x01, 0x74, 0xfc, 0xf4, 0xff,
+    0x00, 0xbe, 0xf9, 0x00, 0x01, 0x4a, 0xea, 0xf5, 0xff, 0x00, 0x92, 0xf8, 0x00, 0x01, 0x18, 0xae,
+    0xf7, 0xff, 0x01, 0xfc, 0x38, 0xf6, 0x00, 0x02, 0x38, 0xa6, 0xf8, 0xfb, 0xff, 0x01, 0xf2, 0x5c,
+    0xf3, 0x00, 0x07, 0x12, 0x6a, 0xbc, 0xf0, 0xf4, 0xd2, 0x80, 0x18, 0x8c, 0x00,
 
     /*Unicode: U+f0c4 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x42, 0x7e, 0x90, 0x80, 0x4e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..++%++......................
-    0x16, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@+....................
-    0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x72, 0x1c, 0x00, 0x00,  //@@@@@@@@@@...............+...
-    0xff, 0xff, 0xf0, 0x52, 0x0c, 0x16, 0x46, 0xb0, 0xff, 0xff, 0xd6, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa0, 0xea, 0xa0, 0xec, 0x94, 0x0c,  //@@@+..+%@@@............%@%@%.
-    0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xf4, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x88, 0xee, 0x8a, 0x0e, 0x00, 0x14, 0xda, 0x6e,  //@@%.....+@@%.........%@%...@+
-    0xff, 0xff, 0xda, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0xea, 0xa4, 0x1e, 0x00, 0x00, 0x10, 0xb6, 0xca, 0x16,  //@@@......+@@.......+@%....%@.
-    0xe2, 0xff, 0xff, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xdc, 0xbe, 0x32, 0x00, 0x00, 0x00, 0x2a, 0xda, 0x9a, 0x06, 0x00,  //@@@%......@@.....+@%.....@%..
-    0x4c, 0xfc, 0xff, 0xff, 0xe0, 0x6e, 0x24, 0x06, 0x26, 0xb6, 0xff, 0xec, 0x18, 0x00, 0x00, 0x40, 0xca, 0xd4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x52, 0xea, 0x64, 0x00, 0x00, 0x00,  //+@@@@+...%@@....@@+....+@+...
-    0x00, 0x5c, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xea, 0x7a, 0xb4, 0xe6, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x84, 0xe0, 0x34, 0x00, 0x00, 0x00, 0x00,  //.+@@@@@@@@@%@+%@+.....%@.....
-    0x00, 0x00, 0x2a, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x9a, 0xf4, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x10, 0xb6, 0xba, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@@@@@@.%@+......%%......
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x68, 0x8c, 0x8c, 0x6a, 0x3e, 0xd8, 0xca, 0xfa, 0x20, 0x30, 0x36, 0x00, 0x00, 0x00, 0x2c, 0xda, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+%%+.@@@.......@%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x94, 0xff, 0x0a, 0xea, 0xf6, 0x06, 0x00, 0x54, 0xf0, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@.@@..+@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xe0, 0xba, 0x02, 0xb4, 0xc4, 0x02, 0x86, 0xe0, 0xd6, 0xb8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@%.%@.%@@%........
-    0x00, 0x00, 0x00, 0x26, 0x8c, 0xd0, 0xf2, 0xf4, 0xd2, 0xa6, 0xea, 0x5e, 0x00, 0x2e, 0x50, 0x18, 0xb6, 0xb2, 0x12, 0x0a, 0xa4, 0xe0, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@@@%@+..+.%%..%@.......
-    0x00, 0x06, 0x92, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x22, 0x8e, 0xf4, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x68, 0xf0, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@@@@@.%@@@+....+@+.....
-    0x08, 0xc4, 0xff, 0xff, 0xff, 0xf0, 0xb8, 0x9c, 0xba, 0xfc, 0xff, 0xfc, 0xa0, 0x16, 0x4a, 0xce, 0xde, 0x58, 0x00, 0x00, 0x00, 0x00, 0x32, 0xdc, 0xa6, 0x0a, 0x00, 0x00, 0x00,  //.@@@@@%%%@@@%.+@@+.....@%....
-    0xa0, 0xff, 0xff, 0xf8, 0x7a, 0x0e, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x58, 0xda, 0xcc, 0x44, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0xd4, 0x28, 0x00, 0x00,  //%@@@+....+@@....+@@+....%@...
-    0xfc, 0xff, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x68, 0xe4, 0xb8, 0x30, 0x00, 0x00, 0x00, 0x74, 0xee, 0x56, 0x00,  //@@@.......@@......+@%....+@+.
-    0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc6, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0xec, 0xa2, 0x1e, 0x00, 0x00, 0x3a, 0xe4, 0x54,  //@@%......@@%........+@%....@+
-    0xff, 0xff, 0xc6, 0x04, 0x00, 0x00, 0x00, 0x42, 0xd2, 0xff, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x86, 0xee, 0x8e, 0x32, 0x96, 0xe8, 0x3a,  //@@@....+@@@...........%@%.%@.
-    0xf4, 0xff, 0xff, 0xe0, 0xa2, 0xac, 0xda, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x94, 0xda, 0x7e, 0x10, 0x00,  //@@@@%%@@@@+.............%@+..
-    0x5e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@+...................
-    0x00, 0x36, 0xac, 0xe8, 0xfa, 0xea, 0xb8, 0x66, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@%+.....................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............................
-
+    0x8b, 0x00, 0x05, 0x42, 0x7e, 0x90, 0x80, 0x4e, 0x08, 0xec, 0x00, 0x01, 0x16, 0xc2, 0xfc, 0xff,
+    0x02, 0xf0, 0x80, 0x06, 0xee, 0x00, 0x00, 0xc8, 0xf9, 0xff, 0x01, 0xd0, 0x1e, 0xf4, 0x00, 0x10,
+    0x2e, 0x72, 0x1c, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x52, 0x0c, 0x16, 0x46, 0xb0, 0xff, 0xff, 0xd6,
+    0x0c, 0xf7, 0x00, 0x09, 0x1c, 0xa0, 0xea, 0xa0, 0xec, 0x94, 0x0c, 0xff, 0xff, 0x9c, 0xfc, 0x00,
+    0x03, 0x52, 0xf4, 0xff, 0x82, 0xf9, 0x00, 0x0c, 0x0e, 0x88, 0xee, 0x8a, 0x0e, 0x00, 0x14, 0xda,
+    0x6e, 0xff, 0xff, 0xda, 0x06, 0xfc, 0x00, 0x02, 0x78, 0xff, 0xda, 0xfb, 0x00, 0x0f, 0x04, 0x70,
+    0xea, 0xa4, 0x1e, 0x00, 0x00, 0x10, 0xb6, 0xca, 0x16, 0xe2, 0xff, 0xff, 0xaa, 0x0a, 0xfd, 0x00,
+    0x02, 0x32, 0xff, 0xf8, 0xfc, 0x00, 0x03, 0x58, 0xdc, 0xbe, 0x32, 0xfe, 0x00, 0x17, 0x2a, 0xda,
+    0x9a, 0x06, 0x00, 0x4c, 0xfc, 0xff, 0xff, 0xe0, 0x6e, 0x24, 0x06, 0x26, 0xb6, 0xff, 0xec, 0x18,
+    0x00, 0x00, 0x40, 0xca, 0xd4, 0x4c, 0xfd, 0x00, 0x02, 0x52, 0xea, 0x64, 0xfd, 0x00, 0x01, 0x5c,
+    0xf6, 0xf9, 0xff, 0x06, 0xb4, 0xea, 0x7a, 0xb4, 0xe6, 0x66, 0x02, 0xfd, 0x00, 0x02, 0x84, 0xe0,
+    0x34, 0xfb, 0x00, 0x01, 0x2a, 0xb6, 0xfb, 0xff, 0x05, 0xc2, 0x00, 0x9a, 0xf4, 0x80, 0x0a, 0xfd,
+    0x00, 0x03, 0x10, 0xb6, 0xba, 0x12, 0xf8, 0x00, 0x0b, 0x22, 0x68, 0x8c, 0x8c, 0x6a, 0x3e, 0xd8,
+    0xca, 0xfa, 0x20, 0x30, 0x36, 0xfe, 0x00, 0x03, 0x2c, 0xda, 0x88, 0x02, 0xf1, 0x00, 0x0a, 0x06,
+    0x94, 0xff, 0x0a, 0xea, 0xf6, 0x06, 0x00, 0x54, 0xf0, 0x52, 0xef, 0x00, 0x0b, 0x46, 0xe0, 0xba,
+    0x02, 0xb4, 0xc4, 0x02, 0x86, 0xe0, 0xd6, 0xb8, 0x12, 0xf7, 0x00, 0x13, 0x26, 0x8c, 0xd0, 0xf2,
+    0xf4, 0xd2, 0xa6, 0xea, 0x5e, 0x00, 0x2e, 0x50, 0x18, 0xb6, 0xb2, 0x12, 0x0a, 0xa4, 0xe0, 0x36,
+    0xfa, 0x00, 0x02, 0x06, 0x92, 0xfa, 0xfb, 0xff, 0x06, 0xd6, 0x22, 0x8e, 0xf4, 0xff, 0xff, 0x7c,
+    0xfd, 0x00, 0x02, 0x68, 0xf0, 0x6a, 0xfc, 0x00, 0x01, 0x08, 0xc4, 0xfe, 0xff, 0x0c, 0xf0, 0xb8,
+    0x9c, 0xba, 0xfc, 0xff, 0xfc, 0xa0, 0x16, 0x4a, 0xce, 0xde, 0x58, 0xfd, 0x00, 0x03, 0x32, 0xdc,
+    0xa6, 0x0a, 0xfe, 0x00, 0x05, 0xa0, 0xff, 0xff, 0xf8, 0x7a, 0x0e, 0xfe, 0x00, 0x02, 0x5e, 0xff,
+    0xea, 0xfd, 0x00, 0x03, 0x58, 0xda, 0xcc, 0x44, 0xfe, 0x00, 0x09, 0x0e, 0xb0, 0xd4, 0x28, 0x00,
+    0x00, 0xfc, 0xff, 0xfc, 0x40, 0xfc, 0x00, 0x02, 0x3e, 0xff, 0xf2, 0xfc, 0x00, 0x04, 0x04, 0x68,
+    0xe4, 0xb8, 0x30, 0xfe, 0x00, 0x06, 0x74, 0xee, 0x56, 0x00, 0xff, 0xff, 0xaa, 0xfc, 0x00, 0x03,
+    0x08, 0xc6, 0xff, 0xb8, 0xfa, 0x00, 0x0d, 0x08, 0x78, 0xec, 0xa2, 0x1e, 0x00, 0x00, 0x3a, 0xe4,
+    0x54, 0xff, 0xff, 0xc6, 0x04, 0xfe, 0x00, 0x04, 0x42, 0xd2, 0xff, 0xfc, 0x3c, 0xf8, 0x00, 0x0e,
+    0x10, 0x86, 0xee, 0x8e, 0x32, 0x96, 0xe8, 0x3a, 0xf4, 0xff, 0xff, 0xe0, 0xa2, 0xac, 0xda, 0xfe,
+    0xff, 0x00, 0x6e, 0xf5, 0x00, 0x07, 0x18, 0x94, 0xda, 0x7e, 0x10, 0x00, 0x5e, 0xfc, 0xfb, 0xff,
+    0x01, 0xe4, 0x4c, 0xed, 0x00, 0x07, 0x36, 0xac, 0xe8, 0xfa, 0xea, 0xb8, 0x66, 0x08, 0x96, 0x00,
 
     /*Unicode: U+f0c5 () , Width: 29 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xca, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......%@@@@@@@@@@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0x24, 0x12, 0x12, 0x12, 0x12, 0x12, 0x20, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@@@.......@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xce, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@.......@@..........
-    0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xce, 0x12, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@.@@.......@@..........
-    0x00, 0x00, 0x00, 0x90, 0xff, 0xce, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@..@@.......@@..........
-    0x00, 0x00, 0x94, 0xff, 0xce, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x92, 0xe2, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf6, 0xf0, 0x78,  //..%@@...@@.......@@%@@@@@@@@+
-    0x00, 0x98, 0xff, 0xce, 0x12, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //.%@@....@@.......@@@@@@@@@@@@
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //+@@@@@@@@@.......@@@@......@@
-    0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe8, 0xff, 0xd0, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@@@@@@@@%......@@@@@......@@
-    0xfa, 0xff, 0x24, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xee, 0xff, 0xda, 0x16, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.............@@@.@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xf4, 0xff, 0xe4, 0x20, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@...........+@@@..@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf8, 0xff, 0xec, 0x2c, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@..........+@@@...@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfa, 0xff, 0xf4, 0x38, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.........+@@@....@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfa, 0xff, 0xfc, 0x5c, 0x12, 0x12, 0x12, 0x12, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.........@@@+....@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........%@@@@@@@@@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........@@@@@@@@@@+......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........@@+..............@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........@@+..............@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........@@+..............@@
-    0xff, 0xff, 0x20, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xec, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@........@@+..............@@
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@@@@@@@@@@@+..............@@
-    0x82, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //%@@@@@@@@@@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //..........@@+..............@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //..........@@@@@@@@@@@@@@@@@@@
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x8a,  //..........+@@@@@@@@@@@@@@@@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00,  //.............................
-
+    0xf9, 0x00, 0x02, 0x56, 0xca, 0xfa, 0xfb, 0xff, 0x01, 0xf6, 0x7e, 0xf0, 0x00, 0x00, 0x82, 0xf7,
+    0xff, 0x00, 0xf8, 0xf1, 0x00, 0x00, 0x86, 0xfe, 0xff, 0x00, 0x24, 0xfc, 0x12, 0x02, 0x20, 0xff,
+    0xff, 0xf2, 0x00, 0x05, 0x8a, 0xff, 0xce, 0xff, 0xff, 0x12, 0xfc, 0x00, 0x02, 0x0e, 0xff, 0xff,
+    0xf3, 0x00, 0x06, 0x8e, 0xff, 0xce, 0x12, 0xff, 0xff, 0x12, 0xfc, 0x00, 0x02, 0x0e, 0xff, 0xff,
+    0xf4, 0x00, 0x07, 0x90, 0xff, 0xce, 0x12, 0x00, 0xff, 0xff, 0x12, 0xfc, 0x00, 0x02, 0x0e, 0xff,
+    0xff, 0xf5, 0x00, 0x08, 0x94, 0xff, 0xce, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xfc, 0x00, 0x04,
+    0x0e, 0xff, 0xff, 0x92, 0xe2, 0xfb, 0xf6, 0x06, 0xf0, 0x78, 0x00, 0x98, 0xff, 0xce, 0x12, 0xfe,
+    0x00, 0x02, 0xff, 0xff, 0x12, 0xfc, 0x00, 0x00, 0x0e, 0xf6, 0xff, 0x01, 0xf6, 0x62, 0xf8, 0xff,
+    0x00, 0x0e, 0xfc, 0x00, 0x00, 0x2e, 0xfe, 0xff, 0x00, 0xfa, 0xfc, 0x00, 0x03, 0x12, 0xff, 0xff,
+    0xd0, 0xf9, 0xff, 0x00, 0xaa, 0xfc, 0x00, 0x05, 0x30, 0xe8, 0xff, 0xd0, 0xff, 0xfa, 0xfc, 0x00,
+    0x05, 0x12, 0xff, 0xff, 0xfa, 0xff, 0x24, 0xfc, 0x12, 0x00, 0x0e, 0xfc, 0x00, 0x06, 0x3a, 0xee,
+    0xff, 0xda, 0x16, 0xff, 0xfa, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xf7, 0x00, 0x07,
+    0x44, 0xf4, 0xff, 0xe4, 0x20, 0x00, 0xff, 0xfa, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12,
+    0xf8, 0x00, 0x08, 0x50, 0xf8, 0xff, 0xec, 0x2c, 0x00, 0x00, 0xff, 0xfa, 0xfc, 0x00, 0x00, 0x12,
+    0xfd, 0xff, 0x00, 0x12, 0xf9, 0x00, 0x04, 0x5c, 0xfa, 0xff, 0xf4, 0x38, 0xfe, 0x00, 0x01, 0xff,
+    0xfa, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa, 0x00, 0x04, 0x38, 0xfa, 0xff, 0xfc,
+    0x5c, 0xfd, 0x12, 0x01, 0xff, 0xfa, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa, 0x00,
+    0x00, 0xb2, 0xf8, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa, 0x00,
+    0x00, 0xe4, 0xf9, 0xff, 0x01, 0xf4, 0x70, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa,
+    0x00, 0x02, 0xea, 0xff, 0x5a, 0xf4, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa, 0x00, 0x02,
+    0xea, 0xff, 0x5a, 0xf4, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xfa, 0x00, 0x02, 0xea, 0xff,
+    0x5a, 0xf4, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x20, 0xfa, 0x0e, 0x02, 0xec, 0xff, 0x5a, 0xf4,
+    0x00, 0x03, 0x12, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0x00, 0x5a, 0xf4, 0x00, 0x04, 0x12, 0xff, 0xff,
+    0x82, 0xf8, 0xf7, 0xff, 0x00, 0x5a, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf7, 0x00, 0x02, 0xea,
+    0xff, 0x5a, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf7, 0x00, 0x02, 0xea, 0xff, 0x5a, 0xf4, 0x00,
+    0x02, 0x12, 0xff, 0xff, 0xf7, 0x00, 0x02, 0xea, 0xff, 0x5a, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff,
+    0xf7, 0x00, 0x02, 0xea, 0xff, 0x5a, 0xf4, 0x00, 0x02, 0x12, 0xff, 0xff, 0xf7, 0x00, 0x00, 0xe6,
+    0xf0, 0xff, 0x00, 0xf8, 0xf7, 0x00, 0x01, 0x7c, 0xfc, 0xf2, 0xff, 0x01, 0xfc, 0x8a, 0xf6, 0x00,
+    0x00, 0x06, 0xf2, 0x0e, 0x01, 0x08, 0x00,
 
     /*Unicode: U+f0c7 () , Width: 25 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd8, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@@@@@@@@@@+......
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x04, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@@%.....
-    0xff, 0xff, 0x20, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x0e, 0x0e, 0x0e, 0x3a, 0xff, 0xff, 0x3a, 0xd6, 0xff, 0xb0, 0x04, 0x00, 0x00, 0x00,  //@@..@@@@@@+....@@.@@%....
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x1a, 0xde, 0xff, 0xb0, 0x04, 0x00, 0x00,  //@@..@@@@@@.....@@..@@%...
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x22, 0xe4, 0xff, 0xb0, 0x04, 0x00,  //@@..@@@@@@.....@@...@@%..
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2a, 0xec, 0xff, 0xb0, 0x02,  //@@..@@@@@@.....@@....@@%.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x34, 0xf0, 0xff, 0x72,  //@@..@@@@@@.....@@.....@@+
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xd8,  //@@..@@@@@@.....@@.....+@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x12, 0x12, 0x12, 0x3e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xfc,  //@@..@@@@@@+....@@......@@
-    0xff, 0xff, 0x12, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@..@@@@@@@@@@@@@......@@
-    0xff, 0xff, 0x12, 0x00, 0x74, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@..+@@@@@@@@@@@+......@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.....................@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.....................@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.....................@@
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00, 0x00, 0x12, 0xff, 0xff,  //@@.....................@@
-    0xff, 0xff, 0x12, 0x00, 0x90, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x8e, 0x00, 0x12, 0xff, 0xff,  //@@..%@@@@@@@@@@@@@@@%..@@
-    0xff, 0xff, 0x12, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x12, 0xff, 0xff,  //@@..@@@@@@@@@@@@@@@@@..@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x00, 0x12, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xff, 0xff, 0x16, 0x02, 0xff, 0xff, 0x16, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x16, 0xff, 0xff, 0x02, 0x16, 0xff, 0xff,  //@@..@@.............@@..@@
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x8c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x8c,  //%@@@@@@@@@@@@@@@@@@@@@@@%
-    0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x08, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0xcf, 0x00, 0x01, 0x7e, 0xf6, 0xf3, 0xff, 0x03, 0xfc, 0xd8, 0x74, 0x02, 0xfc, 0x00, 0x00, 0xf6,
+    0xef, 0xff, 0x01, 0xb0, 0x04, 0xfd, 0x00, 0x03, 0xff, 0xff, 0x20, 0x0e, 0xfb, 0xff, 0x00, 0x5c,
+    0xfe, 0x0e, 0x07, 0x3a, 0xff, 0xff, 0x3a, 0xd6, 0xff, 0xb0, 0x04, 0xfe, 0x00, 0x03, 0xff, 0xff,
+    0x12, 0x00, 0xfb, 0xff, 0x00, 0x36, 0xfe, 0x00, 0x0e, 0x12, 0xff, 0xff, 0x00, 0x1a, 0xde, 0xff,
+    0xb0, 0x04, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0xfb, 0xff, 0x00, 0x36, 0xfe, 0x00, 0x0e, 0x12,
+    0xff, 0xff, 0x00, 0x00, 0x22, 0xe4, 0xff, 0xb0, 0x04, 0x00, 0xff, 0xff, 0x12, 0x00, 0xfb, 0xff,
+    0x00, 0x36, 0xfe, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfe, 0x00, 0x08, 0x2a, 0xec, 0xff, 0xb0, 0x02,
+    0xff, 0xff, 0x12, 0x00, 0xfb, 0xff, 0x00, 0x36, 0xfe, 0x00, 0x02, 0x12, 0xff, 0xff, 0xfd, 0x00,
+    0x07, 0x34, 0xf0, 0xff, 0x72, 0xff, 0xff, 0x12, 0x00, 0xfb, 0xff, 0x00, 0x36, 0xfe, 0x00, 0x02,
+    0x12, 0xff, 0xff, 0xfc, 0x00, 0x06, 0x5c, 0xff, 0xd8, 0xff, 0xff, 0x12, 0x00, 0xfb, 0xff, 0x00,
+    0x5e, 0xfe, 0x12, 0x02, 0x3e, 0xff, 0xff, 0xfc, 0x00, 0x07, 0x16, 0xff, 0xfc, 0xff, 0xff, 0x12,
+    0x00, 0xf4, 0xf6, 0xff, 0x00, 0xf2, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x03, 0x12, 0x00, 0x74,
+    0xf4, 0xf8, 0xff, 0x01, 0xf4, 0x70, 0xfc, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xee, 0x00,
+    0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xee, 0x00, 0x00, 0x12, 0xfd, 0xff, 0x00, 0x12, 0xee, 0x00,
+    0x00, 0x12, 0xfd, 0xff, 0x03, 0x12, 0x00, 0x00, 0x08, 0xf4, 0x0e, 0x03, 0x08, 0x00, 0x00, 0x12,
+    0xfd, 0xff, 0x03, 0x12, 0x00, 0x90, 0xfc, 0xf4, 0xff, 0x03, 0xfc, 0x8e, 0x00, 0x12, 0xfd, 0xff,
+    0x02, 0x12, 0x00, 0xfa, 0xf2, 0xff, 0x02, 0xf8, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x12, 0x00, 0xff,
+    0xff, 0x12, 0xf6, 0x00, 0x04, 0x12, 0xff, 0xff, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x12, 0x00, 0xff,
+    0xff, 0x12, 0xf6, 0x00, 0x04, 0x12, 0xff, 0xff, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x12, 0x00, 0xff,
+    0xff, 0x12, 0xf6, 0x00, 0x04, 0x12, 0xff, 0xff, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x12, 0x00, 0xff,
+    0xff, 0x12, 0xf6, 0x00, 0x04, 0x12, 0xff, 0xff, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x12, 0x00, 0xff,
+    0xff, 0x12, 0xf6, 0x00, 0x04, 0x12, 0xff, 0xff, 0x00, 0x12, 0xfd, 0xff, 0x04, 0x16, 0x02, 0xff,
+    0xff, 0x16, 0xf6, 0x02, 0x07, 0x16, 0xff, 0xff, 0x02, 0x16, 0xff, 0xff, 0xf8, 0xea, 0xff, 0x02,
+    0xf8, 0x8c, 0xfc, 0xec, 0xff, 0x03, 0xfc, 0x8c, 0x00, 0x08, 0xec, 0x0e, 0x00, 0x08, 0xce, 0x00,
 
     /*Unicode: U+f0e7 () , Width: 15 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-    0x00, 0x00, 0x00, 0x94, 0xea, 0xea, 0xea, 0xea, 0xea, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@@@@@.....
-    0x00, 0x00, 0x02, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@@.....
-    0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@+.....
-    0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@@@@......
-    0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@@%......
-    0x00, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@+......
-    0x00, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,  //..@@@@@@.......
-    0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x00, 0x0a, 0x46, 0x86, 0xc6, 0xfa, 0x62,  //.+@@@@@%..+%@@+
-    0x00, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xc6, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0x26,  //.%@@@@@%@@@@@@.
-    0x00, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x00,  //.@@@@@@@@@@@@%.
-    0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x00,  //.@@@@@@@@@@@@..
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00,  //+@@@@@@@@@@@%..
-    0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00,  //%@@@@@@@@@@@+..
-    0xde, 0xff, 0xff, 0xff, 0xd6, 0x96, 0x56, 0xac, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00,  //@@@@@%+%@@@@...
-    0x9c, 0x96, 0x56, 0x16, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00,  //%%+....@@@@+...
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0xdc, 0x02, 0x00, 0x00, 0x00,  //.......@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00,  //......+@@@+....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xe8, 0x06, 0x00, 0x00, 0x00, 0x00,  //......%@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfc, 0xff, 0xf0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xf8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@%.......
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xfa, 0xfc, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@........
-    0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@%........
-    0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@.........
-    0x00, 0x00, 0x00, 0x00, 0x90, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+    0xe0, 0x00, 0x00, 0x94, 0xfc, 0xea, 0x00, 0xc6, 0xfa, 0x00, 0x01, 0x02, 0xf0, 0xfc, 0xff, 0x00,
+    0xc4, 0xfa, 0x00, 0x00, 0x32, 0xfb, 0xff, 0x00, 0x64, 0xfa, 0x00, 0x00, 0x70, 0xfc, 0xff, 0x01,
+    0xf6, 0x0e, 0xfa, 0x00, 0x00, 0xae, 0xfc, 0xff, 0x00, 0xa8, 0xf9, 0x00, 0x00, 0xea, 0xfc, 0xff,
+    0x00, 0x4a, 0xfa, 0x00, 0x00, 0x2c, 0xfc, 0xff, 0x01, 0xe6, 0x02, 0xfd, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x6a, 0xfc, 0xff, 0x09, 0x8c, 0x00, 0x0a, 0x46, 0x86, 0xc6, 0xfa, 0x62, 0x00, 0xa8, 0xfc,
+    0xff, 0x02, 0xae, 0xc6, 0xfa, 0xfe, 0xff, 0x03, 0xfc, 0x26, 0x00, 0xe6, 0xf6, 0xff, 0x02, 0xac,
+    0x00, 0x24, 0xf5, 0xff, 0x02, 0x34, 0x00, 0x62, 0xf6, 0xff, 0x03, 0xbc, 0x00, 0x00, 0xa2, 0xf6,
+    0xff, 0x03, 0x46, 0x00, 0x00, 0xde, 0xfe, 0xff, 0x03, 0xd6, 0x96, 0x56, 0xac, 0xfe, 0xff, 0x00,
+    0xce, 0xfe, 0x00, 0x03, 0x9c, 0x96, 0x56, 0x16, 0xfe, 0x00, 0x00, 0xd6, 0xfe, 0xff, 0x00, 0x56,
+    0xf8, 0x00, 0x00, 0x16, 0xfe, 0xff, 0x01, 0xdc, 0x02, 0xf8, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x00,
+    0x68, 0xf7, 0x00, 0x04, 0x92, 0xff, 0xff, 0xe8, 0x06, 0xf7, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x78,
+    0xf7, 0x00, 0x04, 0x10, 0xfc, 0xff, 0xf0, 0x0e, 0xf7, 0x00, 0x03, 0x4c, 0xff, 0xff, 0x8a, 0xf6,
+    0x00, 0x03, 0x8c, 0xff, 0xf8, 0x18, 0xf6, 0x00, 0x02, 0xca, 0xff, 0x9a, 0xf6, 0x00, 0x03, 0x0c,
+    0xfa, 0xfc, 0x26, 0xf6, 0x00, 0x02, 0x46, 0xff, 0xac, 0xf5, 0x00, 0x02, 0x84, 0xff, 0x34, 0xf5,
+    0x00, 0x01, 0x90, 0xb0, 0xe9, 0x00,
 
     /*Unicode: U+f0f3 () , Width: 27 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xbe, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............+%+............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfa, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............@@@............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7e, 0xfc, 0xff, 0xf6, 0x7a, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+@@@+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........+@@@@@@@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@@@@@@@@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x02, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@@@@@@@@@@@@@+....
-    0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00,  //....@@@@@@@@@@@@@@@@@@@....
-    0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@@@@@%...
-    0x00, 0x00, 0x28, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1a, 0x00, 0x00,  //...@@@@@@@@@@@@@@@@@@@@@...
-    0x00, 0x02, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00,  //..@@@@@@@@@@@@@@@@@@@@@@%..
-    0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@%.
-    0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86,  //%@@@@@@@@@@@@@@@@@@@@@@@@@%
-    0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x36, 0xcc, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xf8, 0xe4, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xc6, 0x2a,  //.@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb8, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%%%@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xf4, 0x5a, 0xec, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........+@+@@@@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0xdc, 0x5e, 0x8e, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@+%@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8c, 0xec, 0xff, 0xe8, 0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@@@%...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........................
-
+    0xf5, 0x00, 0x02, 0x60, 0xbe, 0x54, 0xea, 0x00, 0x03, 0x06, 0xfa, 0xff, 0xf0, 0xeb, 0x00, 0x06,
+    0x3c, 0x7e, 0xfc, 0xff, 0xf6, 0x7a, 0x36, 0xef, 0x00, 0x01, 0x44, 0xd6, 0xfa, 0xff, 0x01, 0xce,
+    0x3a, 0xf2, 0x00, 0x00, 0x72, 0xf7, 0xff, 0x01, 0xfc, 0x64, 0xf4, 0x00, 0x00, 0x5a, 0xf5, 0xff,
+    0x01, 0xfc, 0x4a, 0xf6, 0x00, 0x01, 0x10, 0xee, 0xf4, 0xff, 0x01, 0xe6, 0x08, 0xf7, 0x00, 0x00,
+    0x72, 0xf2, 0xff, 0x00, 0x62, 0xf7, 0x00, 0x00, 0xb4, 0xf2, 0xff, 0x00, 0xa2, 0xf7, 0x00, 0x00,
+    0xcc, 0xf2, 0xff, 0x00, 0xbc, 0xf7, 0x00, 0x00, 0xd8, 0xf2, 0xff, 0x00, 0xc8, 0xf7, 0x00, 0x00,
+    0xe2, 0xf2, 0xff, 0x00, 0xd2, 0xf8, 0x00, 0x01, 0x02, 0xfa, 0xf2, 0xff, 0x00, 0xec, 0xf8, 0x00,
+    0x00, 0x1e, 0xf0, 0xff, 0x00, 0x0a, 0xf9, 0x00, 0x00, 0x4c, 0xf0, 0xff, 0x00, 0x3a, 0xf9, 0x00,
+    0x00, 0x84, 0xf0, 0xff, 0x00, 0x70, 0xf9, 0x00, 0x00, 0xce, 0xf0, 0xff, 0x00, 0xba, 0xfa, 0x00,
+    0x00, 0x30, 0xef, 0xff, 0x01, 0xfa, 0x20, 0xfb, 0x00, 0x00, 0xaa, 0xee, 0xff, 0x00, 0x94, 0xfc,
+    0x00, 0x01, 0x28, 0xfc, 0xee, 0xff, 0x01, 0xf6, 0x1a, 0xfe, 0x00, 0x01, 0x02, 0xc4, 0xec, 0xff,
+    0x00, 0xb2, 0xfe, 0x00, 0x00, 0x94, 0xea, 0xff, 0x02, 0x82, 0x00, 0x98, 0xe8, 0xff, 0x01, 0x86,
+    0xd8, 0xe8, 0xff, 0x02, 0xc6, 0x36, 0xcc, 0xfa, 0xee, 0x02, 0xf8, 0xe4, 0xf6, 0xfc, 0xff, 0x00,
+    0xf8, 0xfa, 0xee, 0x01, 0xc6, 0x2a, 0xf8, 0x00, 0x02, 0x9c, 0xb8, 0xbc, 0xfc, 0xff, 0x00, 0x8a,
+    0xef, 0x00, 0x03, 0x58, 0xf4, 0x5a, 0xec, 0xfd, 0xff, 0x00, 0x46, 0xef, 0x00, 0x07, 0x02, 0xbc,
+    0xdc, 0x5e, 0x8e, 0xff, 0xff, 0xac, 0xed, 0x00, 0x06, 0x08, 0x8c, 0xec, 0xff, 0xe8, 0x82, 0x04,
+    0xea, 0x00, 0x00, 0x08, 0xf4, 0x00,
 
     /*Unicode: U+f11c () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x3e, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x4a, 0x00,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0xff, 0xff, 0x20, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x0c, 0x10, 0x00, 0x00, 0x0c, 0x12, 0x0c, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0xfc, 0xff, 0x10, 0x00, 0xd8, 0xfc, 0x00, 0x00, 0xec, 0xff, 0xe8, 0x00, 0x00, 0xfc, 0xe8, 0x00, 0x00, 0xfc, 0xd8, 0x00, 0x0c, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xfa, 0xfc, 0x0e, 0x00, 0xd6, 0xfa, 0x00, 0x00, 0xe8, 0xff, 0xe4, 0x00, 0x00, 0xfa, 0xe6, 0x00, 0x00, 0xfa, 0xd6, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@..@@..@@@..@@..@@..@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@.......................@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x0e, 0x12, 0x12, 0x12, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x12, 0x20, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@.......................@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x20, 0x00, 0xfc, 0xff, 0x0c, 0x00, 0x10, 0xff, 0xfc, 0x00, 0x10, 0xff, 0xfc, 0x00, 0x20, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xfa, 0xff, 0xff, 0xff, 0x1e, 0x00, 0xfa, 0xfc, 0x0c, 0x00, 0x0e, 0xfc, 0xfa, 0x00, 0x0e, 0xfc, 0xfa, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@@@..@@...@@..@@..@@@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x12, 0x00, 0xfc, 0xff, 0x10, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x0c, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0xfa, 0xfc, 0x0e, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x00, 0x0c, 0xfc, 0xfa, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@..@@..@@@@@@@@@@@@@@@..@@..@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xff, 0xff, 0x24, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0xff, 0xff, 0x12,  //@@...........................@@.
-    0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@.
-    0x3e, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x4a, 0x00,  //.@@@@@@@@@@@@@@@@@@@@@@@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0x81, 0x00, 0xc1, 0x00, 0x01, 0x3e, 0xdc, 0xe6, 0xff, 0x03, 0xe2, 0x4a, 0x00, 0xda, 0xe4, 0xff,
+    0x04, 0xec, 0x00, 0xff, 0xff, 0x20, 0xe7, 0x0e, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xe7,
+    0x00, 0x65, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x0e, 0x10, 0x00, 0x00, 0x0c, 0x10, 0x00,
+    0x00, 0x0c, 0x12, 0x0c, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x10, 0x10,
+    0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xfc, 0xff, 0x10, 0x00, 0xd8, 0xfc, 0x00,
+    0x00, 0xec, 0xff, 0xe8, 0x00, 0x00, 0xfc, 0xe8, 0x00, 0x00, 0xfc, 0xd8, 0x00, 0x0c, 0xff, 0xfc,
+    0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xfa, 0xfc, 0x0e, 0x00, 0xd6, 0xfa, 0x00,
+    0x00, 0xe8, 0xff, 0xe4, 0x00, 0x00, 0xfa, 0xe6, 0x00, 0x00, 0xfa, 0xd6, 0x00, 0x0e, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0xec, 0x00, 0x0c, 0x0e, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x0e, 0xfe, 0x12, 0x03, 0x00, 0x00, 0x10, 0x10, 0xfe,
+    0x00, 0x15, 0x10, 0x0e, 0x00, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x12, 0x20, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xfc, 0xfe, 0xff, 0x0e, 0x20, 0x00, 0xfc, 0xff, 0x0c,
+    0x00, 0x10, 0xff, 0xfc, 0x00, 0x10, 0xff, 0xfc, 0x00, 0x20, 0xfd, 0xff, 0x09, 0x00, 0x00, 0xff,
+    0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xfa, 0xfe, 0xff, 0x0e, 0x1e, 0x00, 0xfa, 0xfc, 0x0c, 0x00,
+    0x0e, 0xfc, 0xfa, 0x00, 0x0e, 0xfc, 0xfa, 0x00, 0x1e, 0xfe, 0xff, 0x08, 0xfa, 0x00, 0x00, 0xff,
+    0xff, 0x12, 0xff, 0xff, 0x12, 0xe7, 0x00, 0x0b, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x0e,
+    0x10, 0x00, 0x00, 0x0c, 0xf4, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0xff, 0xff,
+    0x12, 0xff, 0xff, 0x12, 0x00, 0xfc, 0xff, 0x10, 0x00, 0xd8, 0xf4, 0xff, 0x12, 0xd8, 0x00, 0x0c,
+    0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0xfa, 0xfc, 0x0e, 0x00, 0xd6,
+    0xf4, 0xff, 0x0c, 0xd6, 0x00, 0x0c, 0xfc, 0xfa, 0x00, 0x00, 0xff, 0xff, 0x12, 0xff, 0xff, 0x12,
+    0xe7, 0x00, 0x05, 0xff, 0xff, 0x12, 0xff, 0xff, 0x24, 0xe7, 0x12, 0x03, 0xff, 0xff, 0x12, 0xda,
+    0xe4, 0xff, 0x03, 0xec, 0x00, 0x3e, 0xdc, 0xe6, 0xff, 0x01, 0xe2, 0x4a, 0x81, 0x00, 0xe0, 0x00,
 
     /*Unicode: U+f124 () , Width: 23 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x9e, 0x4e,  //.....................%+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb2, 0xff, 0xff, 0xb2,  //...................%@@%
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x50,  //.................%@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00,  //...............%@@@@@@.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00,  //.............%@@@@@@@+.
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00,  //...........%@@@@@@@@@..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00,  //.........%@@@@@@@@@@+..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00,  //.......%@@@@@@@@@@@@...
-    0x00, 0x00, 0x00, 0x00, 0x36, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //.....%@@@@@@@@@@@@@+...
-    0x00, 0x00, 0x36, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00,  //...%@@@@@@@@@@@@@@@....
-    0x2e, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@+....
-    0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@@@@@.....
-    0x70, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00,  //+%%%%%%%%%@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@@......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@+......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@+.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@+........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@+.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xfa, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................
-
+    0x91, 0x00, 0x02, 0x32, 0x9e, 0x4e, 0xef, 0x00, 0x04, 0x34, 0xb2, 0xff, 0xff, 0xb2, 0xf1, 0x00,
+    0x01, 0x34, 0xb4, 0xfd, 0xff, 0x00, 0x50, 0xf3, 0x00, 0x01, 0x34, 0xb4, 0xfc, 0xff, 0x00, 0xce,
+    0xf4, 0x00, 0x01, 0x34, 0xb4, 0xfa, 0xff, 0x00, 0x50, 0xf6, 0x00, 0x01, 0x34, 0xb4, 0xf9, 0xff,
+    0x00, 0xce, 0xf7, 0x00, 0x01, 0x34, 0xb4, 0xf7, 0xff, 0x00, 0x50, 0xf9, 0x00, 0x01, 0x36, 0xb6,
+    0xf6, 0xff, 0x00, 0xce, 0xfa, 0x00, 0x01, 0x36, 0xb6, 0xf4, 0xff, 0x00, 0x50, 0xfc, 0x00, 0x01,
+    0x36, 0xb6, 0xf3, 0xff, 0x00, 0xce, 0xfd, 0x00, 0x01, 0x2e, 0xb6, 0xf1, 0xff, 0x00, 0x50, 0xfd,
+    0x00, 0x00, 0xe4, 0xf1, 0xff, 0x00, 0xce, 0xfc, 0x00, 0x00, 0x70, 0xf8, 0xb6, 0x00, 0xe4, 0xfb,
+    0xff, 0x00, 0x4e, 0xf2, 0x00, 0x00, 0xa2, 0xfc, 0xff, 0x00, 0xce, 0xf1, 0x00, 0x00, 0xa2, 0xfc,
+    0xff, 0x00, 0x4e, 0xf1, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0x00, 0xce, 0xf0, 0x00, 0x00, 0xa2, 0xfd,
+    0xff, 0x00, 0x4e, 0xf0, 0x00, 0x00, 0xa2, 0xfe, 0xff, 0x00, 0xce, 0xef, 0x00, 0x00, 0xa2, 0xfe,
+    0xff, 0x00, 0x4e, 0xef, 0x00, 0x03, 0xa2, 0xff, 0xff, 0xce, 0xee, 0x00, 0x03, 0xa2, 0xff, 0xff,
+    0x4e, 0xee, 0x00, 0x02, 0xa2, 0xff, 0xce, 0xed, 0x00, 0x02, 0x6a, 0xfa, 0x46, 0xec, 0x00, 0x00,
+    0x06, 0xc8, 0x00,
 
     /*Unicode: U+f15b () , Width: 25 */
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@@@@@@+..........
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+%.......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@%......
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@%.....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@@%....
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@@@%...
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@%..
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x00,  //@@@@@@@@@@@@@@+.+@@@@@@%.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x1c, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x06,  //@@@@@@@@@@@@@@+..+++++++.
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@@%..........
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0x8a,  //@@@@@@@@@@@@@@@@%%%%%%%%%
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,  //@@@@@@@@@@@@@@@@@@@@@@@@@
-    0x7e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x60,  //+@@@@@@@@@@@@@@@@@@@@@@@+
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........................
-
+    0x01, 0x7e, 0xf6, 0xf5, 0xff, 0x02, 0x7e, 0x00, 0x12, 0xf9, 0x00, 0x00, 0xf6, 0xf4, 0xff, 0x03,
+    0x7e, 0x00, 0x6a, 0x8e, 0xfa, 0x00, 0xf3, 0xff, 0x04, 0x7e, 0x00, 0x6a, 0xff, 0x8e, 0xfb, 0x00,
+    0xf3, 0xff, 0x05, 0x7e, 0x00, 0x6a, 0xff, 0xff, 0x8e, 0xfc, 0x00, 0xf3, 0xff, 0x02, 0x7e, 0x00,
+    0x6a, 0xfe, 0xff, 0x00, 0x8e, 0xfd, 0x00, 0xf3, 0xff, 0x02, 0x7e, 0x00, 0x6a, 0xfd, 0xff, 0x00,
+    0x8e, 0xfe, 0x00, 0xf3, 0xff, 0x02, 0x7e, 0x00, 0x6a, 0xfc, 0xff, 0x02, 0x8e, 0x00, 0x00, 0xf3,
+    0xff, 0x02, 0x7e, 0x00, 0x6a, 0xfb, 0xff, 0x01, 0x8c, 0x00, 0xf3, 0xff, 0x02, 0x7e, 0x00, 0x1c,
+    0xfa, 0x46, 0x00, 0x06, 0xf3, 0xff, 0x00, 0xb6, 0xf7, 0x00, 0xf2, 0xff, 0x00, 0xc8, 0xf9, 0xa2,
+    0x00, 0x8a, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff,
+    0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff,
+    0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff,
+    0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff, 0x00, 0xda, 0xe9, 0xff,
+    0x01, 0xda, 0xf6, 0xea, 0xff, 0x02, 0xd2, 0x7e, 0xf6, 0xec, 0xff, 0x01, 0xf2, 0x60, 0xe8, 0x00,
 
     /*Unicode: U+f1eb () , Width: 32 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0x86, 0xb2, 0xd8, 0xec, 0xf8, 0xf6, 0xe8, 0xce, 0xa8, 0x78, 0x34, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........+%%@@@@@@%+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xa6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x8e, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......+%@@@@@@@@@@@@@@%........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@%......
-    0x00, 0x00, 0x00, 0x24, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x96, 0x0e, 0x00, 0x00, 0x00,  //....%@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x58, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xba, 0x7a, 0x52, 0x34, 0x28, 0x2a, 0x38, 0x5a, 0x88, 0xcc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x32, 0x00, 0x00,  //..+@@@@@@@@%++....+%@@@@@@@@@...
-    0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x6c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x52, 0x00,  //.%@@@@@@@+............%@@@@@@@+.
-    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x96, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x56,  //%@@@@@@+................%@@@@@@+
-    0xca, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x1e, 0x00, 0x00, 0x00, 0x3e, 0x8c, 0xc8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xec, 0xbc, 0x7c, 0x2a, 0x00, 0x00, 0x00, 0x3c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@.....%@@@@@@@%+.....@@@@@%
-    0x1c, 0xe2, 0xff, 0xff, 0x96, 0x04, 0x00, 0x04, 0x60, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x46, 0x00, 0x00, 0x16, 0xc2, 0xff, 0xff, 0xbc, 0x06,  //.@@@%...+@@@@@@@@@@@@@@+...@@@%.
-    0x00, 0x24, 0xdc, 0x7c, 0x00, 0x00, 0x48, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x28, 0x00, 0x08, 0xae, 0xbc, 0x0a, 0x00,  //..@+..+@@@@@@@@@@@@@@@@@@...%%..
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@@@@@@@@@@@@@@@@@@+.....
-    0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x82, 0x42, 0x18, 0x04, 0x0c, 0x20, 0x44, 0x8c, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@%+....+%@@@@@@@.....
-    0x00, 0x00, 0x00, 0x00, 0x12, 0xd4, 0xff, 0xff, 0xff, 0xc4, 0x40, 0x00, 0x00, 0x00, 0x02, 0x18, 0x14, 0x00, 0x00, 0x00, 0x02, 0x60, 0xde, 0xff, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@...........+@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xca, 0xe4, 0x52, 0x00, 0x00, 0x26, 0x8a, 0xd0, 0xfc, 0xff, 0xff, 0xf8, 0xc0, 0x78, 0x12, 0x00, 0x0a, 0x92, 0xfc, 0xa4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@+...%@@@@@%+...%@%......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x10, 0xa4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x80, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@@@@@@@@+..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@@@@@@@@@@%.........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xc6, 0xff, 0xec, 0x84, 0x30, 0x08, 0x0c, 0x40, 0x9c, 0xf8, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@%....%@@%..........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........+........+...........
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xb6, 0xf2, 0xe8, 0xa4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............%@@%..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............%@@@@+.............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xca, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............@@@%..............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb4, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............%%...............
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................................
-
+    0xb8, 0x00, 0x0d, 0x08, 0x44, 0x86, 0xb2, 0xd8, 0xec, 0xf8, 0xf6, 0xe8, 0xce, 0xa8, 0x78, 0x34,
+    0x02, 0xf1, 0x00, 0x02, 0x46, 0xa6, 0xf4, 0xf5, 0xff, 0x02, 0xe8, 0x8e, 0x2c, 0xf5, 0x00, 0x01,
+    0x52, 0xce, 0xef, 0xff, 0x01, 0xb2, 0x32, 0xf9, 0x00, 0x01, 0x24, 0xba, 0xec, 0xff, 0x02, 0xfc,
+    0x96, 0x0e, 0xfc, 0x00, 0x01, 0x58, 0xf2, 0xfb, 0xff, 0x0b, 0xf6, 0xba, 0x7a, 0x52, 0x34, 0x28,
+    0x2a, 0x38, 0x5a, 0x88, 0xcc, 0xfc, 0xfb, 0xff, 0x01, 0xde, 0x32, 0xfe, 0x00, 0x00, 0x86, 0xfb,
+    0xff, 0x02, 0xde, 0x6c, 0x0e, 0xf7, 0x00, 0x02, 0x20, 0x86, 0xf0, 0xfc, 0xff, 0x03, 0xf6, 0x52,
+    0x00, 0x8e, 0xfc, 0xff, 0x02, 0xf2, 0x70, 0x04, 0xfc, 0x00, 0x03, 0x14, 0x20, 0x1e, 0x0e, 0xfc,
+    0x00, 0x02, 0x12, 0x96, 0xfc, 0xfd, 0xff, 0x02, 0xfa, 0x56, 0xca, 0xfd, 0xff, 0x01, 0xc4, 0x1e,
+    0xfe, 0x00, 0x03, 0x3e, 0x8c, 0xc8, 0xf4, 0xfd, 0xff, 0x03, 0xec, 0xbc, 0x7c, 0x2a, 0xfe, 0x00,
+    0x01, 0x3c, 0xe2, 0xfd, 0xff, 0x0a, 0x90, 0x1c, 0xe2, 0xff, 0xff, 0x96, 0x04, 0x00, 0x04, 0x60,
+    0xda, 0xf5, 0xff, 0x11, 0xc2, 0x46, 0x00, 0x00, 0x16, 0xc2, 0xff, 0xff, 0xbc, 0x06, 0x00, 0x24,
+    0xdc, 0x7c, 0x00, 0x00, 0x48, 0xde, 0xf1, 0xff, 0x06, 0xc6, 0x28, 0x00, 0x08, 0xae, 0xbc, 0x0a,
+    0xfb, 0x00, 0x01, 0x7e, 0xfc, 0xef, 0xff, 0x01, 0xf2, 0x54, 0xf8, 0x00, 0x00, 0x72, 0xfb, 0xff,
+    0x09, 0xd2, 0x82, 0x42, 0x18, 0x04, 0x0c, 0x20, 0x44, 0x8c, 0xde, 0xfb, 0xff, 0x00, 0x3c, 0xf9,
+    0x00, 0x01, 0x12, 0xd4, 0xfe, 0xff, 0x01, 0xc4, 0x40, 0xfe, 0x00, 0x02, 0x02, 0x18, 0x14, 0xfe,
+    0x00, 0x02, 0x02, 0x60, 0xde, 0xfe, 0xff, 0x00, 0xaa, 0xf7, 0x00, 0x15, 0x14, 0xca, 0xe4, 0x52,
+    0x00, 0x00, 0x26, 0x8a, 0xd0, 0xfc, 0xff, 0xff, 0xf8, 0xc0, 0x78, 0x12, 0x00, 0x0a, 0x92, 0xfc,
+    0xa4, 0x04, 0xf6, 0x00, 0x05, 0x06, 0x0e, 0x00, 0x10, 0xa4, 0xfc, 0xf9, 0xff, 0x04, 0xf4, 0x80,
+    0x02, 0x00, 0x1c, 0xf2, 0x00, 0x01, 0x12, 0xdc, 0xf5, 0xff, 0x00, 0xb8, 0xf0, 0x00, 0x01, 0x04,
+    0xc4, 0xf5, 0xff, 0x00, 0x92, 0xef, 0x00, 0x0c, 0x0e, 0xc6, 0xff, 0xec, 0x84, 0x30, 0x08, 0x0c,
+    0x40, 0x9c, 0xf8, 0xff, 0x9c, 0xed, 0x00, 0x02, 0x0a, 0x6c, 0x0e, 0xfb, 0x00, 0x01, 0x22, 0x62,
+    0xe9, 0x00, 0x05, 0x38, 0xb6, 0xf2, 0xe8, 0xa4, 0x22, 0xe7, 0x00, 0x00, 0x9e, 0xfd, 0xff, 0x00,
+    0x68, 0xe7, 0x00, 0x04, 0x0c, 0xca, 0xff, 0xff, 0x9c, 0xe5, 0x00, 0x02, 0x0e, 0xb4, 0x8c, 0x81,
+    0x00, 0xd2, 0x00,
 
     /*Unicode: U+f240 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x16, 0xb0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb6, 0x18, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xfc, 0x08, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x68, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..+++++++++++++++++++++++++++..@@...
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x10, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@+..
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x1c,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@....@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x06,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@@+.
-    0xff, 0xff, 0x12, 0x00, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@@@@@@@@..@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00,  //@@...............................@@...
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbe, 0x22, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0x81, 0x00, 0xe9, 0x00, 0x02, 0x16, 0xb0, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xb6, 0x18, 0xfe, 0x00,
+    0x00, 0xb0, 0xe0, 0xff, 0x00, 0xbc, 0xfe, 0x00, 0x02, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x08, 0x24,
+    0xff, 0xfc, 0x08, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x09, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0x68, 0xe7, 0x6e, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0xff,
+    0xff, 0x12, 0x00, 0xee, 0xe7, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x10, 0x00, 0xff, 0xff,
+    0x12, 0x00, 0xee, 0xe7, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x06, 0xcc, 0x00, 0xff, 0xff, 0x12,
+    0x00, 0xee, 0xe7, 0xff, 0x0b, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x1c, 0xff, 0xff, 0x12, 0x00,
+    0xee, 0xe7, 0xff, 0xfd, 0x00, 0x07, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xee, 0xe7, 0xff,
+    0xfd, 0x00, 0x07, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xee, 0xe7, 0xff, 0xfd, 0x00, 0x07,
+    0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xee, 0xe7, 0xff, 0xfd, 0x00, 0x07, 0xea, 0xff, 0x22,
+    0xff, 0xff, 0x12, 0x00, 0xee, 0xe7, 0xff, 0xfd, 0x00, 0x07, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12,
+    0x00, 0xee, 0xe7, 0xff, 0x0b, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00,
+    0xee, 0xe7, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x06, 0xf0, 0x06, 0xff, 0xff, 0x12, 0x00, 0xee,
+    0xe7, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00, 0xff, 0xff, 0x12, 0x00, 0xee, 0xe7,
+    0xff, 0x09, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff,
+    0xff, 0x12, 0x00, 0x00, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x06, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00,
+    0xb2, 0xe0, 0xff, 0x00, 0xca, 0xfe, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xbe,
+    0x22, 0x81, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+f241 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x16, 0xb0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb6, 0x18, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xfc, 0x08, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..+++++++++++++++++++++........@@...
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x10, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@+..
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x1c,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@@@@@@@%..........@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x06,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@@+.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..@@@@@@@@@@@@@@@@@@@@%........@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00,  //@@...............................@@...
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbe, 0x22, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0x81, 0x00, 0xe9, 0x00, 0x02, 0x16, 0xb0, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xb6, 0x18, 0xfe, 0x00,
+    0x00, 0xb0, 0xe0, 0xff, 0x00, 0xbc, 0xfe, 0x00, 0x02, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x08, 0x24,
+    0xff, 0xfc, 0x08, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xed, 0x6e, 0x00, 0x4e, 0xf9, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0x08, 0xff, 0xff, 0x7e, 0x10, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0xfe, 0xff, 0x05, 0xcc, 0x00, 0xff,
+    0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0x08, 0x3e, 0x3e, 0xf0, 0xff, 0x1c, 0xff,
+    0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf7, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12,
+    0x00, 0xed, 0xff, 0x00, 0xb6, 0xf7, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xed,
+    0xff, 0x00, 0xb6, 0xf7, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00,
+    0xb6, 0xf7, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf7,
+    0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0x08,
+    0x3e, 0x3e, 0xf0, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0xfe,
+    0xff, 0x05, 0xf0, 0x06, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0x08, 0xff,
+    0xff, 0xd6, 0x4a, 0x00, 0xff, 0xff, 0x12, 0x00, 0xed, 0xff, 0x00, 0xb6, 0xf9, 0x00, 0x07, 0xff,
+    0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00, 0xf4,
+    0xff, 0x38, 0xe4, 0x12, 0x06, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00, 0xb2, 0xe0, 0xff, 0x00, 0xca,
+    0xfe, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xbe, 0x22, 0x81, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+f242 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x16, 0xb0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb6, 0x18, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xfc, 0x08, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..++++++++++++++...............@@...
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x10, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@+..
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x1c,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22,  //@@..@@@@@@@@@@@@@@+................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x06,  //@@..@@@@@@@@@@@@@@+..............@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@@+.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..@@@@@@@@@@@@@@+..............@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00,  //@@...............................@@...
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbe, 0x22, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0x81, 0x00, 0xe9, 0x00, 0x02, 0x16, 0xb0, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xb6, 0x18, 0xfe, 0x00,
+    0x00, 0xb0, 0xe0, 0xff, 0x00, 0xbc, 0xfe, 0x00, 0x02, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x08, 0x24,
+    0xff, 0xfc, 0x08, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf3, 0x6e, 0x00, 0x36, 0xf3, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0x08, 0xff, 0xff, 0x7e, 0x10, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0xfe, 0xff, 0x05, 0xcc, 0x00, 0xff,
+    0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0x08, 0x3e, 0x3e, 0xf0, 0xff, 0x1c, 0xff,
+    0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12,
+    0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf1, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf3,
+    0xff, 0x00, 0x7e, 0xf1, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00,
+    0x7e, 0xf1, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf1,
+    0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0x08,
+    0x3e, 0x3e, 0xf0, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0xfe,
+    0xff, 0x05, 0xf0, 0x06, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0x08, 0xff,
+    0xff, 0xd6, 0x4a, 0x00, 0xff, 0xff, 0x12, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xf3, 0x00, 0x07, 0xff,
+    0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00, 0xf4,
+    0xff, 0x38, 0xe4, 0x12, 0x06, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00, 0xb2, 0xe0, 0xff, 0x00, 0xca,
+    0xfe, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xbe, 0x22, 0x81, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+f243 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x16, 0xb0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb6, 0x18, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xfc, 0x08, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..++++++++.....................@@...
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7e, 0x10, 0x00,  //@@..@@@@@@@@+....................@@+..
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x00,  //@@..@@@@@@@@+....................@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x1c,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22,  //@@..@@@@@@@@+......................@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x06,  //@@..@@@@@@@@+....................@@@@.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xd6, 0x4a, 0x00,  //@@..@@@@@@@@+....................@@@+.
-    0xff, 0xff, 0x12, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@..@@@@@@@@+....................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00,  //@@...............................@@...
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbe, 0x22, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0x81, 0x00, 0xe9, 0x00, 0x02, 0x16, 0xb0, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xb6, 0x18, 0xfe, 0x00,
+    0x00, 0xb0, 0xe0, 0xff, 0x00, 0xbc, 0xfe, 0x00, 0x02, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x08, 0x24,
+    0xff, 0xfc, 0x08, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf9, 0x6e, 0x00, 0x1e, 0xed, 0x00, 0x08, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0x08, 0xff, 0xff, 0x7e, 0x10, 0x00,
+    0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0xfe, 0xff, 0x05, 0xcc, 0x00, 0xff,
+    0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0x08, 0x3e, 0x3e, 0xf0, 0xff, 0x1c, 0xff,
+    0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xeb, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12,
+    0x00, 0xf9, 0xff, 0x00, 0x46, 0xeb, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf9,
+    0xff, 0x00, 0x46, 0xeb, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00,
+    0x46, 0xeb, 0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xeb,
+    0x00, 0x06, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0x08,
+    0x3e, 0x3e, 0xf0, 0xff, 0x22, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0xfe,
+    0xff, 0x05, 0xf0, 0x06, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0x08, 0xff,
+    0xff, 0xd6, 0x4a, 0x00, 0xff, 0xff, 0x12, 0x00, 0xf9, 0xff, 0x00, 0x46, 0xed, 0x00, 0x07, 0xff,
+    0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00, 0xf4,
+    0xff, 0x38, 0xe4, 0x12, 0x06, 0x24, 0xff, 0xff, 0x0a, 0x00, 0x00, 0xb2, 0xe0, 0xff, 0x00, 0xca,
+    0xfe, 0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xbe, 0x22, 0x81, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+f244 () , Width: 38 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x16, 0xb0, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb4, 0x16, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xfa, 0x06, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x50, 0x00, 0x00,  //@@...............................@@+..
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xac, 0x00,  //@@...............................@@@%.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x16,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0xf0, 0xff, 0x22,  //@@.................................@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf6, 0x08,  //@@...............................@@@@.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe8, 0x5a, 0x00,  //@@...............................@@@+.
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x12, 0x00, 0x00,  //@@...............................@@...
-    0xf4, 0xff, 0x38, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x24, 0xff, 0xff, 0x0c, 0x00, 0x00,  //@@...............................@@...
-    0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@...
-    0x18, 0xb2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbe, 0x22, 0x00, 0x00, 0x00,  //.%@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@%....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................................
-
+    0x81, 0x00, 0xe9, 0x00, 0x02, 0x16, 0xb0, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xb4, 0x16, 0xfe, 0x00,
+    0x00, 0xb0, 0xe0, 0xff, 0x00, 0xb4, 0xfe, 0x00, 0x02, 0xf4, 0xff, 0x38, 0xe4, 0x12, 0x08, 0x24,
+    0xff, 0xfa, 0x06, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00,
+    0x07, 0xff, 0xff, 0x50, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0xfe, 0xff, 0x04, 0xac, 0x00,
+    0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0x3e, 0x3e, 0xf0, 0xff, 0x16, 0xff, 0xff, 0x12, 0xe1, 0x00,
+    0x05, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0xe1, 0x00, 0x05, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12,
+    0xe1, 0x00, 0x05, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0xe1, 0x00, 0x05, 0xea, 0xff, 0x22, 0xff,
+    0xff, 0x12, 0xe1, 0x00, 0x05, 0xea, 0xff, 0x22, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0x3e, 0x3e,
+    0xf0, 0xff, 0x22, 0xff, 0xff, 0x12, 0xe3, 0x00, 0xfe, 0xff, 0x04, 0xf6, 0x08, 0xff, 0xff, 0x12,
+    0xe3, 0x00, 0x07, 0xff, 0xff, 0xe8, 0x5a, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff,
+    0x12, 0x00, 0x00, 0xff, 0xff, 0x12, 0xe3, 0x00, 0x07, 0xff, 0xff, 0x12, 0x00, 0x00, 0xf4, 0xff,
+    0x38, 0xe4, 0x12, 0x06, 0x24, 0xff, 0xff, 0x0c, 0x00, 0x00, 0xb2, 0xe0, 0xff, 0x00, 0xcc, 0xfe,
+    0x00, 0x02, 0x18, 0xb2, 0xf6, 0xe4, 0xff, 0x02, 0xf8, 0xbe, 0x22, 0x81, 0x00, 0xc0, 0x00,
 
     /*Unicode: U+f293 () , Width: 22 */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x58, 0xa4, 0xd2, 0xec, 0xfa, 0xf4, 0xe4, 0xbc, 0x84, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x00, 0x00, 0x5a, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x1a, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x2a, 0x00, 0x00, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x06, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0e, 0x00, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x00, 0x1a, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x06, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x04, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x16, 0x00,  //.%@@@@@@@%...%@@@@@@..
-    0x00, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00,  //.@@@@@@@@%....%@@@@@+.
-    0x30, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x5a, 0x00, 0x02, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x00,  //.@@@@@@@@%..+..%@@@@%.
-    0x72, 0xff, 0xff, 0xff, 0xd4, 0x18, 0xa6, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xfa, 0x5a, 0x00, 0x02, 0xa4, 0xff, 0xff, 0xff, 0xf4, 0x02,  //+@@@@.%@@%..@+..%@@@@.
-    0x9c, 0xff, 0xff, 0xff, 0x66, 0x00, 0x02, 0xa6, 0xff, 0xbe, 0x00, 0x00, 0xfc, 0xfa, 0x28, 0x00, 0x02, 0xd4, 0xff, 0xff, 0xff, 0x22,  //%@@@+..%@%..@@...@@@@.
-    0xc0, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x00, 0x02, 0xa6, 0xbe, 0x00, 0x00, 0xfc, 0x76, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x46,  //%@@@@+..%%..@+..%@@@@+
-    0xde, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x00, 0x02, 0x68, 0x00, 0x00, 0x72, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64,  //@@@@@@+..+..+..%@@@@@+
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@+......%@@@@@@+
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c,  //@@@@@@@@+....%@@@@@@@+
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x14, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84,  //@@@@@@@@@...+@@@@@@@@%
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c,  //@@@@@@@@+....%@@@@@@@+
-    0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72,  //@@@@@@@+......%@@@@@@+
-    0xde, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x00, 0x02, 0x68, 0x00, 0x00, 0x72, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66,  //@@@@@@+..+..+..%@@@@@+
-    0xc0, 0xff, 0xff, 0xff, 0xfa, 0x52, 0x00, 0x02, 0xa6, 0xbe, 0x00, 0x00, 0xfc, 0x76, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x48,  //%@@@@+..%%..@+..%@@@@+
-    0x9c, 0xff, 0xff, 0xff, 0x66, 0x00, 0x02, 0xa6, 0xff, 0xbe, 0x00, 0x00, 0xfc, 0xfa, 0x28, 0x00, 0x02, 0xd4, 0xff, 0xff, 0xff, 0x24,  //%@@@+..%@%..@@...@@@@.
-    0x72, 0xff, 0xff, 0xff, 0xd4, 0x18, 0xa6, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xfa, 0x5a, 0x00, 0x02, 0xa4, 0xff, 0xff, 0xff, 0xf4, 0x02,  //+@@@@.%@@%..@+..%@@@@.
-    0x32, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x5a, 0x00, 0x02, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x00,  //.@@@@@@@@%..+..%@@@@%.
-    0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00,  //.@@@@@@@@%....%@@@@@+.
-    0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x00, 0x06, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x16, 0x00,  //.%@@@@@@@%...%@@@@@@..
-    0x00, 0x1a, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x00, 0x06, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00,  //..@@@@@@@%..%@@@@@@%..
-    0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x08, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0e, 0x00, 0x00,  //..+@@@@@@%.%@@@@@@@...
-    0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x2a, 0x00, 0x00, 0x00,  //...%@@@@@@%@@@@@@@....
-    0x00, 0x00, 0x00, 0x00, 0x5a, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x1a, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@%.....
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x5a, 0xa8, 0xd4, 0xee, 0xfa, 0xf4, 0xe6, 0xc0, 0x88, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+%@@@@@%%.......
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................
-
-
+    0xfc, 0x00, 0x0a, 0x08, 0x58, 0xa4, 0xd2, 0xec, 0xfa, 0xf4, 0xe4, 0xbc, 0x84, 0x2c, 0xf7, 0x00,
+    0x01, 0x5a, 0xe6, 0xf7, 0xff, 0x01, 0xaa, 0x1a, 0xfa, 0x00, 0x00, 0x88, 0xfc, 0xff, 0x01, 0xc8,
+    0xba, 0xfb, 0xff, 0x01, 0xe4, 0x2a, 0xfc, 0x00, 0x00, 0x6a, 0xfb, 0xff, 0x02, 0xbe, 0x06, 0xb6,
+    0xfb, 0xff, 0x01, 0xe0, 0x0e, 0xfe, 0x00, 0x01, 0x1a, 0xf4, 0xfb, 0xff, 0x03, 0xbe, 0x00, 0x06,
+    0xb2, 0xfb, 0xff, 0x00, 0x98, 0xfe, 0x00, 0x00, 0x88, 0xfa, 0xff, 0x04, 0xbe, 0x00, 0x00, 0x04,
+    0xb0, 0xfc, 0xff, 0x04, 0xf6, 0x16, 0x00, 0x00, 0xe8, 0xfa, 0xff, 0x00, 0xbe, 0xfe, 0x00, 0x01,
+    0x04, 0xac, 0xfc, 0xff, 0x02, 0x72, 0x00, 0x30, 0xfd, 0xff, 0x00, 0xf4, 0xfe, 0xff, 0x06, 0xbe,
+    0x00, 0x00, 0x5a, 0x00, 0x02, 0xa8, 0xfd, 0xff, 0x02, 0xb8, 0x00, 0x72, 0xfe, 0xff, 0x0c, 0xd4,
+    0x18, 0xa6, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xfa, 0x5a, 0x00, 0x02, 0xa4, 0xfe, 0xff, 0x02, 0xf4,
+    0x02, 0x9c, 0xfe, 0xff, 0x0d, 0x66, 0x00, 0x02, 0xa6, 0xff, 0xbe, 0x00, 0x00, 0xfc, 0xfa, 0x28,
+    0x00, 0x02, 0xd4, 0xfe, 0xff, 0x01, 0x22, 0xc0, 0xfe, 0xff, 0x0c, 0xfa, 0x50, 0x00, 0x02, 0xa6,
+    0xbe, 0x00, 0x00, 0xfc, 0x76, 0x00, 0x00, 0x8a, 0xfd, 0xff, 0x01, 0x46, 0xde, 0xfd, 0xff, 0x0a,
+    0xfa, 0x50, 0x00, 0x02, 0x68, 0x00, 0x00, 0x72, 0x00, 0x00, 0x8a, 0xfc, 0xff, 0x01, 0x64, 0xea,
+    0xfc, 0xff, 0x01, 0xf8, 0x50, 0xfb, 0x00, 0x00, 0x8a, 0xfb, 0xff, 0x01, 0x70, 0xf4, 0xfb, 0xff,
+    0x01, 0xf8, 0x50, 0xfd, 0x00, 0x00, 0x8a, 0xfa, 0xff, 0x01, 0x7c, 0xfc, 0xfa, 0xff, 0x04, 0xf4,
+    0x14, 0x00, 0x00, 0x4a, 0xf9, 0xff, 0x01, 0x84, 0xf4, 0xfb, 0xff, 0x01, 0xf8, 0x50, 0xfd, 0x00,
+    0x00, 0x8a, 0xfa, 0xff, 0x01, 0x7c, 0xea, 0xfc, 0xff, 0x01, 0xf8, 0x50, 0xfb, 0x00, 0x00, 0x8a,
+    0xfb, 0xff, 0x01, 0x72, 0xde, 0xfd, 0xff, 0x0a, 0xfa, 0x50, 0x00, 0x02, 0x68, 0x00, 0x00, 0x72,
+    0x00, 0x00, 0x8a, 0xfc, 0xff, 0x01, 0x66, 0xc0, 0xfe, 0xff, 0x0c, 0xfa, 0x52, 0x00, 0x02, 0xa6,
+    0xbe, 0x00, 0x00, 0xfc, 0x76, 0x00, 0x00, 0x8a, 0xfd, 0xff, 0x01, 0x48, 0x9c, 0xfe, 0xff, 0x0d,
+    0x66, 0x00, 0x02, 0xa6, 0xff, 0xbe, 0x00, 0x00, 0xfc, 0xfa, 0x28, 0x00, 0x02, 0xd4, 0xfe, 0xff,
+    0x01, 0x24, 0x72, 0xfe, 0xff, 0x0c, 0xd4, 0x18, 0xa6, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xfa, 0x5a,
+    0x00, 0x02, 0xa4, 0xfe, 0xff, 0x02, 0xf4, 0x02, 0x32, 0xfd, 0xff, 0x00, 0xf4, 0xfe, 0xff, 0x06,
+    0xbe, 0x00, 0x00, 0x5a, 0x00, 0x02, 0xa8, 0xfd, 0xff, 0x03, 0xb8, 0x00, 0x00, 0xea, 0xfa, 0xff,
+    0x00, 0xbe, 0xfe, 0x00, 0x01, 0x04, 0xac, 0xfc, 0xff, 0x03, 0x72, 0x00, 0x00, 0x88, 0xfa, 0xff,
+    0x04, 0xbe, 0x00, 0x00, 0x06, 0xb0, 0xfc, 0xff, 0x05, 0xf6, 0x16, 0x00, 0x00, 0x1a, 0xf4, 0xfb,
+    0xff, 0x03, 0xbe, 0x00, 0x06, 0xb4, 0xfb, 0xff, 0x00, 0x98, 0xfd, 0x00, 0x00, 0x6a, 0xfb, 0xff,
+    0x02, 0xbe, 0x08, 0xb8, 0xfb, 0xff, 0x01, 0xe0, 0x0e, 0xfc, 0x00, 0x00, 0x8a, 0xfc, 0xff, 0x01,
+    0xc8, 0xbc, 0xfb, 0xff, 0x01, 0xe4, 0x2a, 0xfa, 0x00, 0x01, 0x5a, 0xe6, 0xf7, 0xff, 0x01, 0xac,
+    0x1a, 0xf8, 0x00, 0x0a, 0x08, 0x5a, 0xa8, 0xd4, 0xee, 0xfa, 0xf4, 0xe6, 0xc0, 0x88, 0x2e, 0xe5,
+    0x00,
 
 #endif
 };
@@ -6626,211 +2764,211 @@ static const uint8_t lv_font_symbol_30_glyph_bitmap[] = {
 static const lv_font_glyph_dsc_t lv_font_symbol_30_glyph_dsc[] = {
 #if USE_LV_FONT_SYMBOL_30 == 1
     {.w_px = 25,  .glyph_index = 0},  /*Unicode: U+f001 ()*/
-    {.w_px = 32,  .glyph_index = 120},    /*Unicode: U+f008 ()*/
-    {.w_px = 29,  .glyph_index = 240},    /*Unicode: U+f00b ()*/
-    {.w_px = 25,  .glyph_index = 360},    /*Unicode: U+f00c ()*/
-    {.w_px = 20,  .glyph_index = 480},    /*Unicode: U+f00d ()*/
-    {.w_px = 25,  .glyph_index = 570},    /*Unicode: U+f011 ()*/
-    {.w_px = 25,  .glyph_index = 690},    /*Unicode: U+f013 ()*/
-    {.w_px = 23,  .glyph_index = 810},    /*Unicode: U+f014 ()*/
-    {.w_px = 27,  .glyph_index = 900},    /*Unicode: U+f015 ()*/
-    {.w_px = 27,  .glyph_index = 1020},   /*Unicode: U+f019 ()*/
-    {.w_px = 25,  .glyph_index = 1140},   /*Unicode: U+f01c ()*/
-    {.w_px = 25,  .glyph_index = 1260},   /*Unicode: U+f021 ()*/
-    {.w_px = 13,  .glyph_index = 1380},   /*Unicode: U+f026 ()*/
-    {.w_px = 19,  .glyph_index = 1440},   /*Unicode: U+f027 ()*/
-    {.w_px = 27,  .glyph_index = 1530},   /*Unicode: U+f028 ()*/
-    {.w_px = 32,  .glyph_index = 1650},   /*Unicode: U+f03e ()*/
-    {.w_px = 25,  .glyph_index = 1770},   /*Unicode: U+f040 ()*/
-    {.w_px = 17,  .glyph_index = 1890},   /*Unicode: U+f048 ()*/
-    {.w_px = 23,  .glyph_index = 1980},   /*Unicode: U+f04b ()*/
-    {.w_px = 25,  .glyph_index = 2070},   /*Unicode: U+f04c ()*/
-    {.w_px = 25,  .glyph_index = 2190},   /*Unicode: U+f04d ()*/
-    {.w_px = 17,  .glyph_index = 2310},   /*Unicode: U+f051 ()*/
-    {.w_px = 25,  .glyph_index = 2400},   /*Unicode: U+f052 ()*/
-    {.w_px = 18,  .glyph_index = 2520},   /*Unicode: U+f053 ()*/
-    {.w_px = 18,  .glyph_index = 2610},   /*Unicode: U+f054 ()*/
-    {.w_px = 23,  .glyph_index = 2700},   /*Unicode: U+f067 ()*/
-    {.w_px = 23,  .glyph_index = 2790},   /*Unicode: U+f068 ()*/
-    {.w_px = 29,  .glyph_index = 2880},   /*Unicode: U+f071 ()*/
-    {.w_px = 29,  .glyph_index = 3000},   /*Unicode: U+f074 ()*/
-    {.w_px = 27,  .glyph_index = 3120},   /*Unicode: U+f077 ()*/
-    {.w_px = 27,  .glyph_index = 3240},   /*Unicode: U+f078 ()*/
-    {.w_px = 32,  .glyph_index = 3360},   /*Unicode: U+f079 ()*/
-    {.w_px = 27,  .glyph_index = 3480},   /*Unicode: U+f07b ()*/
-    {.w_px = 27,  .glyph_index = 3600},   /*Unicode: U+f093 ()*/
-    {.w_px = 23,  .glyph_index = 3720},   /*Unicode: U+f095 ()*/
-    {.w_px = 29,  .glyph_index = 3810},   /*Unicode: U+f0c4 ()*/
-    {.w_px = 29,  .glyph_index = 3930},   /*Unicode: U+f0c5 ()*/
-    {.w_px = 25,  .glyph_index = 4050},   /*Unicode: U+f0c7 ()*/
-    {.w_px = 15,  .glyph_index = 4170},   /*Unicode: U+f0e7 ()*/
-    {.w_px = 27,  .glyph_index = 4230},   /*Unicode: U+f0f3 ()*/
-    {.w_px = 32,  .glyph_index = 4350},   /*Unicode: U+f11c ()*/
-    {.w_px = 23,  .glyph_index = 4470},   /*Unicode: U+f124 ()*/
-    {.w_px = 25,  .glyph_index = 4560},   /*Unicode: U+f15b ()*/
-    {.w_px = 32,  .glyph_index = 4680},   /*Unicode: U+f1eb ()*/
-    {.w_px = 38,  .glyph_index = 4800},   /*Unicode: U+f240 ()*/
-    {.w_px = 38,  .glyph_index = 4950},   /*Unicode: U+f241 ()*/
-    {.w_px = 38,  .glyph_index = 5100},   /*Unicode: U+f242 ()*/
-    {.w_px = 38,  .glyph_index = 5250},   /*Unicode: U+f243 ()*/
-    {.w_px = 38,  .glyph_index = 5400},   /*Unicode: U+f244 ()*/
-    {.w_px = 22,  .glyph_index = 5550},   /*Unicode: U+f293 ()*/
+    {.w_px = 32,  .glyph_index = 108},    /*Unicode: U+f008 ()*/
+    {.w_px = 29,  .glyph_index = 221},    /*Unicode: U+f00b ()*/
+    {.w_px = 25,  .glyph_index = 304},    /*Unicode: U+f00c ()*/
+    {.w_px = 20,  .glyph_index = 381},    /*Unicode: U+f00d ()*/
+    {.w_px = 25,  .glyph_index = 443},    /*Unicode: U+f011 ()*/
+    {.w_px = 25,  .glyph_index = 552},    /*Unicode: U+f013 ()*/
+    {.w_px = 23,  .glyph_index = 654},    /*Unicode: U+f014 ()*/
+    {.w_px = 27,  .glyph_index = 734},    /*Unicode: U+f015 ()*/
+    {.w_px = 27,  .glyph_index = 821},   /*Unicode: U+f019 ()*/
+    {.w_px = 25,  .glyph_index = 924},   /*Unicode: U+f01c ()*/
+    {.w_px = 25,  .glyph_index = 1013},   /*Unicode: U+f021 ()*/
+    {.w_px = 13,  .glyph_index = 1098},   /*Unicode: U+f026 ()*/
+    {.w_px = 19,  .glyph_index = 1142},   /*Unicode: U+f027 ()*/
+    {.w_px = 27,  .glyph_index = 1205},   /*Unicode: U+f028 ()*/
+    {.w_px = 32,  .glyph_index = 1299},   /*Unicode: U+f03e ()*/
+    {.w_px = 25,  .glyph_index = 1404},   /*Unicode: U+f040 ()*/
+    {.w_px = 17,  .glyph_index = 1500},   /*Unicode: U+f048 ()*/
+    {.w_px = 23,  .glyph_index = 1580},   /*Unicode: U+f04b ()*/
+    {.w_px = 25,  .glyph_index = 1658},   /*Unicode: U+f04c ()*/
+    {.w_px = 25,  .glyph_index = 1763},   /*Unicode: U+f04d ()*/
+    {.w_px = 17,  .glyph_index = 1867},   /*Unicode: U+f051 ()*/
+    {.w_px = 25,  .glyph_index = 1945},   /*Unicode: U+f052 ()*/
+    {.w_px = 18,  .glyph_index = 2026},   /*Unicode: U+f053 ()*/
+    {.w_px = 18,  .glyph_index = 2107},   /*Unicode: U+f054 ()*/
+    {.w_px = 23,  .glyph_index = 2188},   /*Unicode: U+f067 ()*/
+    {.w_px = 23,  .glyph_index = 2260},   /*Unicode: U+f068 ()*/
+    {.w_px = 29,  .glyph_index = 2283},   /*Unicode: U+f071 ()*/
+    {.w_px = 29,  .glyph_index = 2394},   /*Unicode: U+f074 ()*/
+    {.w_px = 27,  .glyph_index = 2496},   /*Unicode: U+f077 ()*/
+    {.w_px = 27,  .glyph_index = 2567},   /*Unicode: U+f078 ()*/
+    {.w_px = 32,  .glyph_index = 2634},   /*Unicode: U+f079 ()*/
+    {.w_px = 27,  .glyph_index = 2715},   /*Unicode: U+f07b ()*/
+    {.w_px = 27,  .glyph_index = 2812},   /*Unicode: U+f093 ()*/
+    {.w_px = 23,  .glyph_index = 2920},   /*Unicode: U+f095 ()*/
+    {.w_px = 29,  .glyph_index = 2994},   /*Unicode: U+f0c4 ()*/
+    {.w_px = 29,  .glyph_index = 3088},   /*Unicode: U+f0c5 ()*/
+    {.w_px = 25,  .glyph_index = 3207},   /*Unicode: U+f0c7 ()*/
+    {.w_px = 15,  .glyph_index = 3312},   /*Unicode: U+f0e7 ()*/
+    {.w_px = 27,  .glyph_index = 3370},   /*Unicode: U+f0f3 ()*/
+    {.w_px = 32,  .glyph_index = 3487},   /*Unicode: U+f11c ()*/
+    {.w_px = 23,  .glyph_index = 3568},   /*Unicode: U+f124 ()*/
+    {.w_px = 25,  .glyph_index = 3639},   /*Unicode: U+f15b ()*/
+    {.w_px = 32,  .glyph_index = 3757},   /*Unicode: U+f1eb ()*/
+    {.w_px = 38,  .glyph_index = 3849},   /*Unicode: U+f240 ()*/
+    {.w_px = 38,  .glyph_index = 3957},   /*Unicode: U+f241 ()*/
+    {.w_px = 38,  .glyph_index = 4065},   /*Unicode: U+f242 ()*/
+    {.w_px = 38,  .glyph_index = 4173},   /*Unicode: U+f243 ()*/
+    {.w_px = 38,  .glyph_index = 4281},   /*Unicode: U+f244 ()*/
+    {.w_px = 22,  .glyph_index = 4389},   /*Unicode: U+f293 ()*/
 
 #elif USE_LV_FONT_SYMBOL_30 == 2
     {.w_px = 25,  .glyph_index = 0},  /*Unicode: U+f001 ()*/
-    {.w_px = 32,  .glyph_index = 210},    /*Unicode: U+f008 ()*/
-    {.w_px = 29,  .glyph_index = 450},    /*Unicode: U+f00b ()*/
-    {.w_px = 25,  .glyph_index = 690},    /*Unicode: U+f00c ()*/
-    {.w_px = 20,  .glyph_index = 900},    /*Unicode: U+f00d ()*/
-    {.w_px = 25,  .glyph_index = 1050},   /*Unicode: U+f011 ()*/
-    {.w_px = 25,  .glyph_index = 1260},   /*Unicode: U+f013 ()*/
-    {.w_px = 23,  .glyph_index = 1470},   /*Unicode: U+f014 ()*/
-    {.w_px = 27,  .glyph_index = 1650},   /*Unicode: U+f015 ()*/
-    {.w_px = 27,  .glyph_index = 1860},   /*Unicode: U+f019 ()*/
-    {.w_px = 25,  .glyph_index = 2070},   /*Unicode: U+f01c ()*/
-    {.w_px = 25,  .glyph_index = 2280},   /*Unicode: U+f021 ()*/
-    {.w_px = 13,  .glyph_index = 2490},   /*Unicode: U+f026 ()*/
-    {.w_px = 19,  .glyph_index = 2610},   /*Unicode: U+f027 ()*/
-    {.w_px = 27,  .glyph_index = 2760},   /*Unicode: U+f028 ()*/
-    {.w_px = 32,  .glyph_index = 2970},   /*Unicode: U+f03e ()*/
-    {.w_px = 25,  .glyph_index = 3210},   /*Unicode: U+f040 ()*/
-    {.w_px = 17,  .glyph_index = 3420},   /*Unicode: U+f048 ()*/
-    {.w_px = 23,  .glyph_index = 3570},   /*Unicode: U+f04b ()*/
-    {.w_px = 25,  .glyph_index = 3750},   /*Unicode: U+f04c ()*/
-    {.w_px = 25,  .glyph_index = 3960},   /*Unicode: U+f04d ()*/
-    {.w_px = 17,  .glyph_index = 4170},   /*Unicode: U+f051 ()*/
-    {.w_px = 25,  .glyph_index = 4320},   /*Unicode: U+f052 ()*/
-    {.w_px = 18,  .glyph_index = 4530},   /*Unicode: U+f053 ()*/
-    {.w_px = 18,  .glyph_index = 4680},   /*Unicode: U+f054 ()*/
-    {.w_px = 23,  .glyph_index = 4830},   /*Unicode: U+f067 ()*/
-    {.w_px = 23,  .glyph_index = 5010},   /*Unicode: U+f068 ()*/
-    {.w_px = 29,  .glyph_index = 5190},   /*Unicode: U+f071 ()*/
-    {.w_px = 29,  .glyph_index = 5430},   /*Unicode: U+f074 ()*/
-    {.w_px = 27,  .glyph_index = 5670},   /*Unicode: U+f077 ()*/
-    {.w_px = 27,  .glyph_index = 5880},   /*Unicode: U+f078 ()*/
-    {.w_px = 32,  .glyph_index = 6090},   /*Unicode: U+f079 ()*/
-    {.w_px = 27,  .glyph_index = 6330},   /*Unicode: U+f07b ()*/
-    {.w_px = 27,  .glyph_index = 6540},   /*Unicode: U+f093 ()*/
-    {.w_px = 23,  .glyph_index = 6750},   /*Unicode: U+f095 ()*/
-    {.w_px = 29,  .glyph_index = 6930},   /*Unicode: U+f0c4 ()*/
-    {.w_px = 29,  .glyph_index = 7170},   /*Unicode: U+f0c5 ()*/
-    {.w_px = 25,  .glyph_index = 7410},   /*Unicode: U+f0c7 ()*/
-    {.w_px = 15,  .glyph_index = 7620},   /*Unicode: U+f0e7 ()*/
-    {.w_px = 27,  .glyph_index = 7740},   /*Unicode: U+f0f3 ()*/
-    {.w_px = 32,  .glyph_index = 7950},   /*Unicode: U+f11c ()*/
-    {.w_px = 23,  .glyph_index = 8190},   /*Unicode: U+f124 ()*/
-    {.w_px = 25,  .glyph_index = 8370},   /*Unicode: U+f15b ()*/
-    {.w_px = 32,  .glyph_index = 8580},   /*Unicode: U+f1eb ()*/
-    {.w_px = 38,  .glyph_index = 8820},   /*Unicode: U+f240 ()*/
-    {.w_px = 38,  .glyph_index = 9120},   /*Unicode: U+f241 ()*/
-    {.w_px = 38,  .glyph_index = 9420},   /*Unicode: U+f242 ()*/
-    {.w_px = 38,  .glyph_index = 9720},   /*Unicode: U+f243 ()*/
-    {.w_px = 38,  .glyph_index = 10020},  /*Unicode: U+f244 ()*/
-    {.w_px = 22,  .glyph_index = 10320},  /*Unicode: U+f293 ()*/
+    {.w_px = 32,  .glyph_index = 176},    /*Unicode: U+f008 ()*/
+    {.w_px = 29,  .glyph_index = 377},    /*Unicode: U+f00b ()*/
+    {.w_px = 25,  .glyph_index = 514},    /*Unicode: U+f00c ()*/
+    {.w_px = 20,  .glyph_index = 636},    /*Unicode: U+f00d ()*/
+    {.w_px = 25,  .glyph_index = 736},   /*Unicode: U+f011 ()*/
+    {.w_px = 25,  .glyph_index = 915},   /*Unicode: U+f013 ()*/
+    {.w_px = 23,  .glyph_index = 1077},   /*Unicode: U+f014 ()*/
+    {.w_px = 27,  .glyph_index = 1225},   /*Unicode: U+f015 ()*/
+    {.w_px = 27,  .glyph_index = 1370},   /*Unicode: U+f019 ()*/
+    {.w_px = 25,  .glyph_index = 1525},   /*Unicode: U+f01c ()*/
+    {.w_px = 25,  .glyph_index = 1655},   /*Unicode: U+f021 ()*/
+    {.w_px = 13,  .glyph_index = 1807},   /*Unicode: U+f026 ()*/
+    {.w_px = 19,  .glyph_index = 1889},   /*Unicode: U+f027 ()*/
+    {.w_px = 27,  .glyph_index = 1989},   /*Unicode: U+f028 ()*/
+    {.w_px = 32,  .glyph_index = 2147},   /*Unicode: U+f03e ()*/
+    {.w_px = 25,  .glyph_index = 2315},   /*Unicode: U+f040 ()*/
+    {.w_px = 17,  .glyph_index = 2474},   /*Unicode: U+f048 ()*/
+    {.w_px = 23,  .glyph_index = 2603},   /*Unicode: U+f04b ()*/
+    {.w_px = 25,  .glyph_index = 2731},   /*Unicode: U+f04c ()*/
+    {.w_px = 25,  .glyph_index = 2912},   /*Unicode: U+f04d ()*/
+    {.w_px = 17,  .glyph_index = 3019},   /*Unicode: U+f051 ()*/
+    {.w_px = 25,  .glyph_index = 3147},   /*Unicode: U+f052 ()*/
+    {.w_px = 18,  .glyph_index = 3254},   /*Unicode: U+f053 ()*/
+    {.w_px = 18,  .glyph_index = 3384},   /*Unicode: U+f054 ()*/
+    {.w_px = 23,  .glyph_index = 3516},   /*Unicode: U+f067 ()*/
+    {.w_px = 23,  .glyph_index = 3631},   /*Unicode: U+f068 ()*/
+    {.w_px = 29,  .glyph_index = 3662},   /*Unicode: U+f071 ()*/
+    {.w_px = 29,  .glyph_index = 3842},   /*Unicode: U+f074 ()*/
+    {.w_px = 27,  .glyph_index = 4016},   /*Unicode: U+f077 ()*/
+    {.w_px = 27,  .glyph_index = 4128},   /*Unicode: U+f078 ()*/
+    {.w_px = 32,  .glyph_index = 4241},   /*Unicode: U+f079 ()*/
+    {.w_px = 27,  .glyph_index = 4394},   /*Unicode: U+f07b ()*/
+    {.w_px = 27,  .glyph_index = 4503},   /*Unicode: U+f093 ()*/
+    {.w_px = 23,  .glyph_index = 4657},   /*Unicode: U+f095 ()*/
+    {.w_px = 29,  .glyph_index = 4784},   /*Unicode: U+f0c4 ()*/
+    {.w_px = 29,  .glyph_index = 4958},   /*Unicode: U+f0c5 ()*/
+    {.w_px = 25,  .glyph_index = 5187},   /*Unicode: U+f0c7 ()*/
+    {.w_px = 15,  .glyph_index = 5356},   /*Unicode: U+f0e7 ()*/
+    {.w_px = 27,  .glyph_index = 5467},   /*Unicode: U+f0f3 ()*/
+    {.w_px = 32,  .glyph_index = 5643},   /*Unicode: U+f11c ()*/
+    {.w_px = 23,  .glyph_index = 5758},   /*Unicode: U+f124 ()*/
+    {.w_px = 25,  .glyph_index = 5884},   /*Unicode: U+f15b ()*/
+    {.w_px = 32,  .glyph_index = 6034},   /*Unicode: U+f1eb ()*/
+    {.w_px = 38,  .glyph_index = 6198},   /*Unicode: U+f240 ()*/
+    {.w_px = 38,  .glyph_index = 6341},   /*Unicode: U+f241 ()*/
+    {.w_px = 38,  .glyph_index = 6497},   /*Unicode: U+f242 ()*/
+    {.w_px = 38,  .glyph_index = 6679},   /*Unicode: U+f243 ()*/
+    {.w_px = 38,  .glyph_index = 6847},  /*Unicode: U+f244 ()*/
+    {.w_px = 22,  .glyph_index = 6977},  /*Unicode: U+f293 ()*/
 
 #elif USE_LV_FONT_SYMBOL_30 == 4
     {.w_px = 25,  .glyph_index = 0},  /*Unicode: U+f001 ()*/
-    {.w_px = 32,  .glyph_index = 390},    /*Unicode: U+f008 ()*/
-    {.w_px = 29,  .glyph_index = 870},    /*Unicode: U+f00b ()*/
-    {.w_px = 25,  .glyph_index = 1320},   /*Unicode: U+f00c ()*/
-    {.w_px = 20,  .glyph_index = 1710},   /*Unicode: U+f00d ()*/
-    {.w_px = 25,  .glyph_index = 2010},   /*Unicode: U+f011 ()*/
-    {.w_px = 25,  .glyph_index = 2400},   /*Unicode: U+f013 ()*/
-    {.w_px = 23,  .glyph_index = 2790},   /*Unicode: U+f014 ()*/
-    {.w_px = 27,  .glyph_index = 3150},   /*Unicode: U+f015 ()*/
-    {.w_px = 27,  .glyph_index = 3570},   /*Unicode: U+f019 ()*/
-    {.w_px = 25,  .glyph_index = 3990},   /*Unicode: U+f01c ()*/
-    {.w_px = 25,  .glyph_index = 4380},   /*Unicode: U+f021 ()*/
-    {.w_px = 13,  .glyph_index = 4770},   /*Unicode: U+f026 ()*/
-    {.w_px = 19,  .glyph_index = 4980},   /*Unicode: U+f027 ()*/
-    {.w_px = 27,  .glyph_index = 5280},   /*Unicode: U+f028 ()*/
-    {.w_px = 32,  .glyph_index = 5700},   /*Unicode: U+f03e ()*/
-    {.w_px = 25,  .glyph_index = 6180},   /*Unicode: U+f040 ()*/
-    {.w_px = 17,  .glyph_index = 6570},   /*Unicode: U+f048 ()*/
-    {.w_px = 23,  .glyph_index = 6840},   /*Unicode: U+f04b ()*/
-    {.w_px = 25,  .glyph_index = 7200},   /*Unicode: U+f04c ()*/
-    {.w_px = 25,  .glyph_index = 7590},   /*Unicode: U+f04d ()*/
-    {.w_px = 17,  .glyph_index = 7980},   /*Unicode: U+f051 ()*/
-    {.w_px = 25,  .glyph_index = 8250},   /*Unicode: U+f052 ()*/
-    {.w_px = 18,  .glyph_index = 8640},   /*Unicode: U+f053 ()*/
-    {.w_px = 18,  .glyph_index = 8910},   /*Unicode: U+f054 ()*/
-    {.w_px = 23,  .glyph_index = 9180},   /*Unicode: U+f067 ()*/
-    {.w_px = 23,  .glyph_index = 9540},   /*Unicode: U+f068 ()*/
-    {.w_px = 29,  .glyph_index = 9900},   /*Unicode: U+f071 ()*/
-    {.w_px = 29,  .glyph_index = 10350},  /*Unicode: U+f074 ()*/
-    {.w_px = 27,  .glyph_index = 10800},  /*Unicode: U+f077 ()*/
-    {.w_px = 27,  .glyph_index = 11220},  /*Unicode: U+f078 ()*/
-    {.w_px = 32,  .glyph_index = 11640},  /*Unicode: U+f079 ()*/
-    {.w_px = 27,  .glyph_index = 12120},  /*Unicode: U+f07b ()*/
-    {.w_px = 27,  .glyph_index = 12540},  /*Unicode: U+f093 ()*/
-    {.w_px = 23,  .glyph_index = 12960},  /*Unicode: U+f095 ()*/
-    {.w_px = 29,  .glyph_index = 13320},  /*Unicode: U+f0c4 ()*/
-    {.w_px = 29,  .glyph_index = 13770},  /*Unicode: U+f0c5 ()*/
-    {.w_px = 25,  .glyph_index = 14220},  /*Unicode: U+f0c7 ()*/
-    {.w_px = 15,  .glyph_index = 14610},  /*Unicode: U+f0e7 ()*/
-    {.w_px = 27,  .glyph_index = 14850},  /*Unicode: U+f0f3 ()*/
-    {.w_px = 32,  .glyph_index = 15270},  /*Unicode: U+f11c ()*/
-    {.w_px = 23,  .glyph_index = 15750},  /*Unicode: U+f124 ()*/
-    {.w_px = 25,  .glyph_index = 16110},  /*Unicode: U+f15b ()*/
-    {.w_px = 32,  .glyph_index = 16500},  /*Unicode: U+f1eb ()*/
-    {.w_px = 38,  .glyph_index = 16980},  /*Unicode: U+f240 ()*/
-    {.w_px = 38,  .glyph_index = 17550},  /*Unicode: U+f241 ()*/
-    {.w_px = 38,  .glyph_index = 18120},  /*Unicode: U+f242 ()*/
-    {.w_px = 38,  .glyph_index = 18690},  /*Unicode: U+f243 ()*/
-    {.w_px = 38,  .glyph_index = 19260},  /*Unicode: U+f244 ()*/
-    {.w_px = 22,  .glyph_index = 19830},  /*Unicode: U+f293 ()*/
+    {.w_px = 32,  .glyph_index = 250},    /*Unicode: U+f008 ()*/
+    {.w_px = 29,  .glyph_index = 533},    /*Unicode: U+f00b ()*/
+    {.w_px = 25,  .glyph_index = 744},   /*Unicode: U+f00c ()*/
+    {.w_px = 20,  .glyph_index = 915},   /*Unicode: U+f00d ()*/
+    {.w_px = 25,  .glyph_index = 1093},   /*Unicode: U+f011 ()*/
+    {.w_px = 25,  .glyph_index = 1381},   /*Unicode: U+f013 ()*/
+    {.w_px = 23,  .glyph_index = 1638},   /*Unicode: U+f014 ()*/
+    {.w_px = 27,  .glyph_index = 1887},   /*Unicode: U+f015 ()*/
+    {.w_px = 27,  .glyph_index = 2126},   /*Unicode: U+f019 ()*/
+    {.w_px = 25,  .glyph_index = 2331},   /*Unicode: U+f01c ()*/
+    {.w_px = 25,  .glyph_index = 2509},   /*Unicode: U+f021 ()*/
+    {.w_px = 13,  .glyph_index = 2750},   /*Unicode: U+f026 ()*/
+    {.w_px = 19,  .glyph_index = 2862},   /*Unicode: U+f027 ()*/
+    {.w_px = 27,  .glyph_index = 3004},   /*Unicode: U+f028 ()*/
+    {.w_px = 32,  .glyph_index = 3265},   /*Unicode: U+f03e ()*/
+    {.w_px = 25,  .glyph_index = 3523},   /*Unicode: U+f040 ()*/
+    {.w_px = 17,  .glyph_index = 3754},   /*Unicode: U+f048 ()*/
+    {.w_px = 23,  .glyph_index = 3961},   /*Unicode: U+f04b ()*/
+    {.w_px = 25,  .glyph_index = 4116},   /*Unicode: U+f04c ()*/
+    {.w_px = 25,  .glyph_index = 4375},   /*Unicode: U+f04d ()*/
+    {.w_px = 17,  .glyph_index = 4482},   /*Unicode: U+f051 ()*/
+    {.w_px = 25,  .glyph_index = 4682},   /*Unicode: U+f052 ()*/
+    {.w_px = 18,  .glyph_index = 4809},   /*Unicode: U+f053 ()*/
+    {.w_px = 18,  .glyph_index = 5011},   /*Unicode: U+f054 ()*/
+    {.w_px = 23,  .glyph_index = 5217},   /*Unicode: U+f067 ()*/
+    {.w_px = 23,  .glyph_index = 5379},   /*Unicode: U+f068 ()*/
+    {.w_px = 29,  .glyph_index = 5419},   /*Unicode: U+f071 ()*/
+    {.w_px = 29,  .glyph_index = 5680},  /*Unicode: U+f074 ()*/
+    {.w_px = 27,  .glyph_index = 5942},  /*Unicode: U+f077 ()*/
+    {.w_px = 27,  .glyph_index = 6122},  /*Unicode: U+f078 ()*/
+    {.w_px = 32,  .glyph_index = 6302},  /*Unicode: U+f079 ()*/
+    {.w_px = 27,  .glyph_index = 6549},  /*Unicode: U+f07b ()*/
+    {.w_px = 27,  .glyph_index = 6671},  /*Unicode: U+f093 ()*/
+    {.w_px = 23,  .glyph_index = 6878},  /*Unicode: U+f095 ()*/
+    {.w_px = 29,  .glyph_index = 7058},  /*Unicode: U+f0c4 ()*/
+    {.w_px = 29,  .glyph_index = 7346},  /*Unicode: U+f0c5 ()*/
+    {.w_px = 25,  .glyph_index = 7690},  /*Unicode: U+f0c7 ()*/
+    {.w_px = 15,  .glyph_index = 7942},  /*Unicode: U+f0e7 ()*/
+    {.w_px = 27,  .glyph_index = 8114},  /*Unicode: U+f0f3 ()*/
+    {.w_px = 32,  .glyph_index = 8335},  /*Unicode: U+f11c ()*/
+    {.w_px = 23,  .glyph_index = 8541},  /*Unicode: U+f124 ()*/
+    {.w_px = 25,  .glyph_index = 8699},  /*Unicode: U+f15b ()*/
+    {.w_px = 32,  .glyph_index = 8865},  /*Unicode: U+f1eb ()*/
+    {.w_px = 38,  .glyph_index = 9113},  /*Unicode: U+f240 ()*/
+    {.w_px = 38,  .glyph_index = 9304},  /*Unicode: U+f241 ()*/
+    {.w_px = 38,  .glyph_index = 9517},  /*Unicode: U+f242 ()*/
+    {.w_px = 38,  .glyph_index = 9730},  /*Unicode: U+f243 ()*/
+    {.w_px = 38,  .glyph_index = 9943},  /*Unicode: U+f244 ()*/
+    {.w_px = 22,  .glyph_index = 10104},  /*Unicode: U+f293 ()*/
 
 #elif USE_LV_FONT_SYMBOL_30 == 8
     {.w_px = 25,  .glyph_index = 0},  /*Unicode: U+f001 ()*/
-    {.w_px = 32,  .glyph_index = 750},    /*Unicode: U+f008 ()*/
-    {.w_px = 29,  .glyph_index = 1710},   /*Unicode: U+f00b ()*/
-    {.w_px = 25,  .glyph_index = 2580},   /*Unicode: U+f00c ()*/
-    {.w_px = 20,  .glyph_index = 3330},   /*Unicode: U+f00d ()*/
-    {.w_px = 25,  .glyph_index = 3930},   /*Unicode: U+f011 ()*/
-    {.w_px = 25,  .glyph_index = 4680},   /*Unicode: U+f013 ()*/
-    {.w_px = 23,  .glyph_index = 5430},   /*Unicode: U+f014 ()*/
-    {.w_px = 27,  .glyph_index = 6120},   /*Unicode: U+f015 ()*/
-    {.w_px = 27,  .glyph_index = 6930},   /*Unicode: U+f019 ()*/
-    {.w_px = 25,  .glyph_index = 7740},   /*Unicode: U+f01c ()*/
-    {.w_px = 25,  .glyph_index = 8490},   /*Unicode: U+f021 ()*/
-    {.w_px = 13,  .glyph_index = 9240},   /*Unicode: U+f026 ()*/
-    {.w_px = 19,  .glyph_index = 9630},   /*Unicode: U+f027 ()*/
-    {.w_px = 27,  .glyph_index = 10200},  /*Unicode: U+f028 ()*/
-    {.w_px = 32,  .glyph_index = 11010},  /*Unicode: U+f03e ()*/
-    {.w_px = 25,  .glyph_index = 11970},  /*Unicode: U+f040 ()*/
-    {.w_px = 17,  .glyph_index = 12720},  /*Unicode: U+f048 ()*/
-    {.w_px = 23,  .glyph_index = 13230},  /*Unicode: U+f04b ()*/
-    {.w_px = 25,  .glyph_index = 13920},  /*Unicode: U+f04c ()*/
-    {.w_px = 25,  .glyph_index = 14670},  /*Unicode: U+f04d ()*/
-    {.w_px = 17,  .glyph_index = 15420},  /*Unicode: U+f051 ()*/
-    {.w_px = 25,  .glyph_index = 15930},  /*Unicode: U+f052 ()*/
-    {.w_px = 18,  .glyph_index = 16680},  /*Unicode: U+f053 ()*/
-    {.w_px = 18,  .glyph_index = 17220},  /*Unicode: U+f054 ()*/
-    {.w_px = 23,  .glyph_index = 17760},  /*Unicode: U+f067 ()*/
-    {.w_px = 23,  .glyph_index = 18450},  /*Unicode: U+f068 ()*/
-    {.w_px = 29,  .glyph_index = 19140},  /*Unicode: U+f071 ()*/
-    {.w_px = 29,  .glyph_index = 20010},  /*Unicode: U+f074 ()*/
-    {.w_px = 27,  .glyph_index = 20880},  /*Unicode: U+f077 ()*/
-    {.w_px = 27,  .glyph_index = 21690},  /*Unicode: U+f078 ()*/
-    {.w_px = 32,  .glyph_index = 22500},  /*Unicode: U+f079 ()*/
-    {.w_px = 27,  .glyph_index = 23460},  /*Unicode: U+f07b ()*/
-    {.w_px = 27,  .glyph_index = 24270},  /*Unicode: U+f093 ()*/
-    {.w_px = 23,  .glyph_index = 25080},  /*Unicode: U+f095 ()*/
-    {.w_px = 29,  .glyph_index = 25770},  /*Unicode: U+f0c4 ()*/
-    {.w_px = 29,  .glyph_index = 26640},  /*Unicode: U+f0c5 ()*/
-    {.w_px = 25,  .glyph_index = 27510},  /*Unicode: U+f0c7 ()*/
-    {.w_px = 15,  .glyph_index = 28260},  /*Unicode: U+f0e7 ()*/
-    {.w_px = 27,  .glyph_index = 28710},  /*Unicode: U+f0f3 ()*/
-    {.w_px = 32,  .glyph_index = 29520},  /*Unicode: U+f11c ()*/
-    {.w_px = 23,  .glyph_index = 30480},  /*Unicode: U+f124 ()*/
-    {.w_px = 25,  .glyph_index = 31170},  /*Unicode: U+f15b ()*/
-    {.w_px = 32,  .glyph_index = 31920},  /*Unicode: U+f1eb ()*/
-    {.w_px = 38,  .glyph_index = 32880},  /*Unicode: U+f240 ()*/
-    {.w_px = 38,  .glyph_index = 34020},  /*Unicode: U+f241 ()*/
-    {.w_px = 38,  .glyph_index = 35160},  /*Unicode: U+f242 ()*/
-    {.w_px = 38,  .glyph_index = 36300},  /*Unicode: U+f243 ()*/
-    {.w_px = 38,  .glyph_index = 37440},  /*Unicode: U+f244 ()*/
-    {.w_px = 22,  .glyph_index = 38580},  /*Unicode: U+f293 ()*/
+    {.w_px = 32,  .glyph_index = 310},    /*Unicode: U+f008 ()*/
+    {.w_px = 29,  .glyph_index = 774},   /*Unicode: U+f00b ()*/
+    {.w_px = 25,  .glyph_index = 1032},   /*Unicode: U+f00c ()*/
+    {.w_px = 20,  .glyph_index = 1250},   /*Unicode: U+f00d ()*/
+    {.w_px = 25,  .glyph_index = 1500},   /*Unicode: U+f011 ()*/
+    {.w_px = 25,  .glyph_index = 1934},   /*Unicode: U+f013 ()*/
+    {.w_px = 23,  .glyph_index = 2264},   /*Unicode: U+f014 ()*/
+    {.w_px = 27,  .glyph_index = 2665},   /*Unicode: U+f015 ()*/
+    {.w_px = 27,  .glyph_index = 2976},   /*Unicode: U+f019 ()*/
+    {.w_px = 25,  .glyph_index = 3227},   /*Unicode: U+f01c ()*/
+    {.w_px = 25,  .glyph_index = 3448},   /*Unicode: U+f021 ()*/
+    {.w_px = 13,  .glyph_index = 3778},   /*Unicode: U+f026 ()*/
+    {.w_px = 19,  .glyph_index = 3912},   /*Unicode: U+f027 ()*/
+    {.w_px = 27,  .glyph_index = 4099},  /*Unicode: U+f028 ()*/
+    {.w_px = 32,  .glyph_index = 4515},  /*Unicode: U+f03e ()*/
+    {.w_px = 25,  .glyph_index = 4913},  /*Unicode: U+f040 ()*/
+    {.w_px = 17,  .glyph_index = 5235},  /*Unicode: U+f048 ()*/
+    {.w_px = 23,  .glyph_index = 5514},  /*Unicode: U+f04b ()*/
+    {.w_px = 25,  .glyph_index = 5698},  /*Unicode: U+f04c ()*/
+    {.w_px = 25,  .glyph_index = 5920},  /*Unicode: U+f04d ()*/
+    {.w_px = 17,  .glyph_index = 6027},  /*Unicode: U+f051 ()*/
+    {.w_px = 25,  .glyph_index = 6266},  /*Unicode: U+f052 ()*/
+    {.w_px = 18,  .glyph_index = 6409},  /*Unicode: U+f053 ()*/
+    {.w_px = 18,  .glyph_index = 6648},  /*Unicode: U+f054 ()*/
+    {.w_px = 23,  .glyph_index = 6904},  /*Unicode: U+f067 ()*/
+    {.w_px = 23,  .glyph_index = 7093},  /*Unicode: U+f068 ()*/
+    {.w_px = 29,  .glyph_index = 7141},  /*Unicode: U+f071 ()*/
+    {.w_px = 29,  .glyph_index = 7471},  /*Unicode: U+f074 ()*/
+    {.w_px = 27,  .glyph_index = 7850},  /*Unicode: U+f077 ()*/
+    {.w_px = 27,  .glyph_index = 8094},  /*Unicode: U+f078 ()*/
+    {.w_px = 32,  .glyph_index = 8322},  /*Unicode: U+f079 ()*/
+    {.w_px = 27,  .glyph_index = 8659},  /*Unicode: U+f07b ()*/
+    {.w_px = 27,  .glyph_index = 8797},  /*Unicode: U+f093 ()*/
+    {.w_px = 23,  .glyph_index = 9048},  /*Unicode: U+f095 ()*/
+    {.w_px = 29,  .glyph_index = 9285},  /*Unicode: U+f0c4 ()*/
+    {.w_px = 29,  .glyph_index = 9749},  /*Unicode: U+f0c5 ()*/
+    {.w_px = 25,  .glyph_index = 10204},  /*Unicode: U+f0c7 ()*/
+    {.w_px = 15,  .glyph_index = 10588},  /*Unicode: U+f0e7 ()*/
+    {.w_px = 27,  .glyph_index = 10818},  /*Unicode: U+f0f3 ()*/
+    {.w_px = 32,  .glyph_index = 11080},  /*Unicode: U+f11c ()*/
+    {.w_px = 23,  .glyph_index = 11432},  /*Unicode: U+f124 ()*/
+    {.w_px = 25,  .glyph_index = 11627},  /*Unicode: U+f15b ()*/
+    {.w_px = 32,  .glyph_index = 11819},  /*Unicode: U+f1eb ()*/
+    {.w_px = 38,  .glyph_index = 12190},  /*Unicode: U+f240 ()*/
+    {.w_px = 38,  .glyph_index = 12467},  /*Unicode: U+f241 ()*/
+    {.w_px = 38,  .glyph_index = 12755},  /*Unicode: U+f242 ()*/
+    {.w_px = 38,  .glyph_index = 13043},  /*Unicode: U+f243 ()*/
+    {.w_px = 38,  .glyph_index = 13331},  /*Unicode: U+f244 ()*/
+    {.w_px = 22,  .glyph_index = 13554},  /*Unicode: U+f293 ()*/
 
 #endif
 };
@@ -6855,6 +2993,7 @@ lv_font_t lv_font_symbol_30 = {
 #endif
     .monospace = 0,
     .next_page = NULL,      /*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_LV_FONT_SYMBOL_30*/
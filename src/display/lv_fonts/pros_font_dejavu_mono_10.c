@@ -12,4951 +12,1290 @@ static const uint8_t pros_font_dejavu_mono_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO == 1
   /*Unicode: U+0020 ( ) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf7, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 1 */
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfd, 0x80, 0x01, 0x00, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+0022 (") , Width: 3 */
-  0x00,  //...
-  0xa0,  //%.%
-  0xa0,  //%.%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x02, 0x00, 0xa0, 0xa0, 0xfa, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 5 */
-  0x20,  //..%..
-  0x10,  //...%.
-  0xf8,  //%%%%%
-  0x50,  //.%.%.
-  0xf8,  //%%%%%
-  0x40,  //.%...
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x20, 0x10, 0xf8, 0x50, 0xf8, 0x40, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 5 */
-  0x00,  //.....
-  0x20,  //..%..
-  0x78,  //.%%%%
-  0xa0,  //%.%..
-  0x70,  //.%%%.
-  0x28,  //..%.%
-  0xf0,  //%%%%.
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-
+  0x09, 0x00, 0x20, 0x78, 0xa0, 0x70, 0x28, 0xf0, 0x20, 0x00, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 5 */
-  0x00,  //.....
-  0xe0,  //%%%..
-  0xa0,  //%.%..
-  0xf0,  //%%%%.
-  0x78,  //.%%%%
-  0x28,  //..%.%
-  0x38,  //..%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0xe0, 0xa0, 0xf0, 0x78, 0x28, 0x38, 0xfe, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0x40,  //.%..
-  0x60,  //.%%.
-  0xb0,  //%.%%
-  0xa0,  //%.%.
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0x40, 0x60, 0xb0, 0xa0, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0027 (') , Width: 1 */
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0x80, 0x80, 0xfa, 0x00,
 
   /*Unicode: U+0028 (() , Width: 2 */
-  0x40,  //.%
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0x40,  //.%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0x40, 0xfc, 0x80, 0x00, 0x40, 0xfe, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 2 */
-  0x80,  //%.
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0x80,  //%.
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0x80, 0xfc, 0x40, 0x00, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+002a (*) , Width: 5 */
-  0x00,  //.....
-  0xa8,  //%.%.%
-  0x70,  //.%%%.
-  0x70,  //.%%%.
-  0xa8,  //%.%.%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x04, 0x00, 0xa8, 0x70, 0x70, 0xa8, 0xfc, 0x00,
 
   /*Unicode: U+002b (+) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x20,  //..%..
-  0x20,  //..%..
-  0xf8,  //%%%%%
-  0x20,  //..%..
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+002c (,) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x03, 0x80, 0x80, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xc0, 0xfc, 0x00,
 
   /*Unicode: U+002e (.) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x00, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+002f (/) , Width: 4 */
-  0x00,  //....
-  0x10,  //...%
-  0x20,  //..%.
-  0x20,  //..%.
-  0x00,  //....
-  0x40,  //.%..
-  0x40,  //.%..
-  0x80,  //%...
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x10, 0x20, 0x20, 0x00, 0x40, 0x40, 0x80, 0x00, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0xd0,  //%%.%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x60, 0x90, 0xd0, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 3 */
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xc0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 5 */
-  0x00,  //.....
-  0xe0,  //%%%..
-  0x10,  //...%.
-  0x10,  //...%.
-  0x20,  //..%..
-  0x40,  //.%...
-  0xf0,  //%%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0xe0, 0x10, 0x10, 0x20, 0x40, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0x10,  //...%
-  0x10,  //...%
-  0x60,  //.%%.
-  0x10,  //...%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xe0, 0x10, 0x10, 0x60, 0x10, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 4 */
-  0x00,  //....
-  0x20,  //..%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xa0,  //%.%.
-  0xf0,  //%%%%
-  0x20,  //..%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x20, 0x60, 0x60, 0xa0, 0xf0, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xe0,  //%%%.
-  0x10,  //...%
-  0x10,  //...%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0xe0, 0x10, 0x10, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0xc0,  //%%..
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0xc0, 0x80, 0xf0, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x10,  //...%
-  0x20,  //..%.
-  0x20,  //..%.
-  0x20,  //..%.
-  0x40,  //.%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0xf0, 0x10, 0xfe, 0x20, 0x00, 0x40, 0xfe, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x60, 0x90, 0x90, 0x60, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x10,  //...%
-  0x30,  //..%%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xe0, 0x90, 0xf0, 0x10, 0x30, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+003a (:) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+003b (;) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x06, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x10,  //...%
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0x10,  //...%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x10, 0xc0, 0xc0, 0x10, 0xfe, 0x00,
 
   /*Unicode: U+003d (=) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x00,  //....
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x02, 0xf0, 0x00, 0xf0, 0xfd, 0x00,
 
   /*Unicode: U+003e (>) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x80,  //%...
-  0x30,  //..%%
-  0x30,  //..%%
-  0x80,  //%...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x80, 0x30, 0x30, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+003f (?) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0x60,  //.%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x00,  //...
-  0x40,  //.%.
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0xe0, 0x60, 0x40, 0x40, 0x00, 0x40, 0xfe, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0xb0,  //%.%%
-  0xb0,  //%.%%
-  0xc0,  //%%..
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x00, 0x60, 0x90, 0xb0, 0xb0, 0xc0, 0x60, 0x00, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfd, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xe0, 0x90, 0x90, 0xe0, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0xc0,  //%%..
-  0x80,  //%...
-  0x80,  //%...
-  0xc0,  //%%..
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0xc0, 0x80, 0x80, 0xc0, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0xe0, 0xfd, 0x90, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xb0,  //%.%%
-  0x90,  //%..%
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0x80, 0x80, 0xb0, 0x90, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfe, 0x90, 0x02, 0xf0, 0x90, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xe0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+004a (J) , Width: 3 */
-  0x00,  //...
-  0x60,  //.%%
-  0x20,  //..%
-  0x20,  //..%
-  0x20,  //..%
-  0x20,  //..%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0x60, 0xfd, 0x20, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+004b (K) , Width: 5 */
-  0x00,  //.....
-  0x90,  //%..%.
-  0xa0,  //%.%..
-  0xc0,  //%%...
-  0xe0,  //%%%..
-  0xa0,  //%.%..
-  0x90,  //%..%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x90, 0xa0, 0xc0, 0xe0, 0xa0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+004c (L) , Width: 4 */
-  0x00,  //....
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0x80, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+004d (M) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x90, 0xfe, 0xf0, 0x01, 0x90, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+004e (N) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0xd0,  //%%.%
-  0xd0,  //%%.%
-  0xb0,  //%.%%
-  0xb0,  //%.%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x90, 0xd0, 0xd0, 0xb0, 0xb0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+004f (O) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0xe0, 0x90, 0xe0, 0xfe, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 5 */
-  0x00,  //.....
-  0xe0,  //%%%..
-  0x90,  //%..%.
-  0xe0,  //%%%..
-  0xb0,  //%.%%.
-  0x90,  //%..%.
-  0x88,  //%...%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0xe0, 0x90, 0xe0, 0xb0, 0x90, 0x88, 0xfe, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0x80,  //%...
-  0xc0,  //%%..
-  0x30,  //..%%
-  0x10,  //...%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0x80, 0xc0, 0x30, 0x10, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 5 */
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x01, 0x00, 0xf8, 0xfc, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x90, 0x90, 0xfd, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 5 */
-  0x00,  //.....
-  0x88,  //%...%
-  0x88,  //%...%
-  0xf8,  //%%%%%
-  0x70,  //.%%%.
-  0x50,  //.%.%.
-  0x50,  //.%.%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x88, 0x88, 0xf8, 0x70, 0x50, 0x50, 0xfe, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x90, 0xfd, 0x60, 0x00, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 5 */
-  0x00,  //.....
-  0x88,  //%...%
-  0x50,  //.%.%.
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x02, 0x00, 0x88, 0x50, 0xfd, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x20,  //..%.
-  0x20,  //..%.
-  0x40,  //.%..
-  0x40,  //.%..
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x20, 0x20, 0x40, 0x40, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+005b ([) , Width: 2 */
-  0xc0,  //%%
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0x80,  //%.
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xc0, 0xfc, 0x80, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+005c (\) , Width: 4 */
-  0x00,  //....
-  0x80,  //%...
-  0x40,  //.%..
-  0x40,  //.%..
-  0x00,  //....
-  0x20,  //..%.
-  0x20,  //..%.
-  0x10,  //...%
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x80, 0x40, 0x40, 0x00, 0x20, 0x20, 0x10, 0x00, 0x00,
 
   /*Unicode: U+005d (]) , Width: 2 */
-  0xc0,  //%%
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0x40,  //.%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xc0, 0xfc, 0x40, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+005e (^) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x60, 0x90, 0xfa, 0x00,
 
   /*Unicode: U+005f (_) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0x00,  //.....
-
+  0xf9, 0x00, 0x01, 0xf8, 0x00,
 
   /*Unicode: U+0060 (`) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf7, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 4 */
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x80, 0x03, 0xe0, 0x90, 0x90, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x80,  //%..
-  0x80,  //%..
-  0x60,  //.%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x03, 0x60, 0x80, 0x80, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 4 */
-  0x10,  //...%
-  0x10,  //...%
-  0x10,  //...%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x10, 0x03, 0x70, 0x90, 0x90, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x70, 0xf0, 0x80, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 4 */
-  0x30,  //..%%
-  0x40,  //.%..
-  0x40,  //.%..
-  0xf0,  //%%%%
-  0x40,  //.%..
-  0x40,  //.%..
-  0x40,  //.%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x30, 0x40, 0x40, 0xf0, 0xfe, 0x40, 0xfe, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x70,  //.%%%
-  0x10,  //...%
-  0xe0,  //%%%.
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x70, 0x90, 0x90, 0x70, 0x10, 0xe0, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 4 */
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x80, 0x00, 0xf0, 0xfe, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 3 */
-  0x40,  //.%.
-  0x00,  //...
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x40, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+006a (j) , Width: 3 */
-  0x20,  //..%
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x20,  //..%
-  0x20,  //..%
-  0x20,  //..%
-  0x20,  //..%
-  0xe0,  //%%%
-  0x00,  //...
-
+  0x03, 0x20, 0x00, 0x00, 0x60, 0xfd, 0x20, 0x01, 0xe0, 0x00,
 
   /*Unicode: U+006b (k) , Width: 5 */
-  0x80,  //%....
-  0x80,  //%....
-  0x80,  //%....
-  0xb0,  //%.%%.
-  0xe0,  //%%%..
-  0xe0,  //%%%..
-  0xb0,  //%.%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x80, 0x03, 0xb0, 0xe0, 0xe0, 0xb0, 0xfe, 0x00,
 
   /*Unicode: U+006c (l) , Width: 4 */
-  0xc0,  //%%..
-  0x40,  //.%..
-  0x40,  //.%..
-  0x40,  //.%..
-  0x40,  //.%..
-  0x40,  //.%..
-  0x30,  //..%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0xc0, 0xfc, 0x40, 0x00, 0x30, 0xfe, 0x00,
 
   /*Unicode: U+006d (m) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0xa8,  //%.%.%
-  0xa8,  //%.%.%
-  0xa8,  //%.%.%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x00, 0xf8, 0xfe, 0xa8, 0xfe, 0x00,
 
   /*Unicode: U+006e (n) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+006f (o) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x60, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x80,  //%...
-  0x80,  //%...
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0xe0, 0x90, 0x90, 0xe0, 0x80, 0x80, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x70,  //.%%%
-  0x10,  //...%
-  0x10,  //...%
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x70, 0x90, 0x90, 0x70, 0x10, 0x10, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0x80,  //%..
-  0x80,  //%..
-  0x80,  //%..
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x00, 0xe0, 0xfe, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0xe0,  //%%%.
-  0x10,  //...%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0xe0, 0x10, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x40,  //.%..
-  0xf0,  //%%%%
-  0x40,  //.%..
-  0x40,  //.%..
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x00, 0x40, 0xf0, 0x40, 0x40, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0xfe, 0x90, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x00, 0x90, 0xfe, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x88,  //%...%
-  0xa8,  //%.%.%
-  0x70,  //.%%%.
-  0x70,  //.%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x03, 0x88, 0xa8, 0x70, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0x60, 0x60, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x40,  //.%..
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x90, 0x60, 0x60, 0x40, 0x40, 0xc0, 0x00,
 
   /*Unicode: U+007a (z) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x60,  //.%%.
-  0x40,  //.%..
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0x60, 0x40, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+007b ({) , Width: 3 */
-  0x60,  //.%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x60,  //.%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x60, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+007c (|) , Width: 1 */
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-
+  0xf9, 0x80, 0x01, 0x00, 0x00,
 
   /*Unicode: U+007d (}) , Width: 3 */
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x60,  //.%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0xc0,  //%%.
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0xc0, 0x40, 0x40, 0x60, 0x40, 0x40, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+007e (~) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
-
+  0xfd, 0x00, 0x00, 0xf0, 0xfc, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 2
   /*Unicode: U+0020 ( ) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf7, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 1 */
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfd, 0xc0, 0x01, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+0022 (") , Width: 3 */
-  0x00,  //...
-  0xcc,  //@.@
-  0xcc,  //@.@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x02, 0x00, 0xcc, 0xcc, 0xfa, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 5 */
-  0x09, 0x40,  //..%++
-  0x06, 0x00,  //..+%.
-  0xbf, 0xc0,  //%@@@@
-  0x22, 0x00,  //.%.%.
-  0xff, 0x80,  //@@@@%
-  0x25, 0x00,  //.%++.
-  0x58, 0x00,  //++%..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x09, 0x40, 0x06, 0x00, 0xbf, 0xc0, 0x22, 0x00, 0xff, 0x80, 0x25, 0x00, 0x58, 0xfa, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x0c, 0x00,  //..@..
-  0x7f, 0xc0,  //+@@@@
-  0xcc, 0x00,  //@.@..
-  0x6e, 0x00,  //+%@%.
-  0x0c, 0xc0,  //..@.@
-  0xff, 0x40,  //@@@@+
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0e, 0x00, 0x00, 0x0c, 0x00, 0x7f, 0xc0, 0xcc, 0x00, 0x6e, 0x00, 0x0c, 0xc0, 0xff, 0x40, 0x0c,
+  0xfc, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xb8, 0x00,  //%@%..
-  0xdc, 0x00,  //@+@..
-  0xbe, 0x40,  //%@@%+
-  0x6f, 0x80,  //+%@@%
-  0x0d, 0xc0,  //..@+@
-  0x0b, 0x80,  //..%@%
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0d, 0x00, 0x00, 0xb8, 0x00, 0xdc, 0x00, 0xbe, 0x40, 0x6f, 0x80, 0x0d, 0xc0, 0x0b, 0x80, 0xfb,
+  0x00,
 
   /*Unicode: U+0026 (&) , Width: 4 */
-  0x00,  //....
-  0x2f,  //.%@@
-  0x30,  //.@..
-  0x28,  //.%%.
-  0x9f,  //%+@@
-  0xd9,  //@+%+
-  0x7a,  //+@%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x2f, 0x30, 0x28, 0x9f, 0xd9, 0x7a, 0xfe, 0x00,
 
   /*Unicode: U+0027 (') , Width: 1 */
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0xc0, 0xc0, 0xfa, 0x00,
 
   /*Unicode: U+0028 (() , Width: 2 */
-  0x20,  //.%
-  0x90,  //%+
-  0xc0,  //@.
-  0xc0,  //@.
-  0xc0,  //@.
-  0x90,  //%+
-  0x20,  //.%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x20, 0x90, 0xfe, 0xc0, 0x01, 0x90, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 2 */
-  0x80,  //%.
-  0x60,  //+%
-  0x30,  //.@
-  0x30,  //.@
-  0x30,  //.@
-  0x60,  //+%
-  0x80,  //%.
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x80, 0x60, 0xfe, 0x30, 0x01, 0x60, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+002a (*) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x8c, 0x80,  //%.@.%
-  0x2e, 0x00,  //.%@%.
-  0x2e, 0x00,  //.%@%.
-  0x8c, 0x80,  //%.@.%
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x09, 0x00, 0x00, 0x8c, 0x80, 0x2e, 0x00, 0x2e, 0x00, 0x8c, 0x80, 0xf7, 0x00,
 
   /*Unicode: U+002b (+) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0xff, 0xc0,  //@@@@@
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfd, 0x00, 0x08, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+002c (,) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x03, 0xc0, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xf0, 0xfc, 0x00,
 
   /*Unicode: U+002e (.) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+002f (/) , Width: 4 */
-  0x00,  //....
-  0x03,  //...@
-  0x09,  //..%+
-  0x0c,  //..@.
-  0x14,  //.++.
-  0x30,  //.@..
-  0x60,  //+%..
-  0xc0,  //@...
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x03, 0x09, 0x0c, 0x14, 0x30, 0x60, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 4 */
-  0x00,  //....
-  0x3c,  //.@@.
-  0xd7,  //@++@
-  0xe3,  //@%.@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x3c,  //.@@.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x3c, 0xd7, 0xe3, 0xc3, 0xd7, 0x3c, 0xfe, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 3 */
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xf0, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xfd, 0x00,  //@@@+.
-  0x03, 0x00,  //...@.
-  0x07, 0x00,  //..+@.
-  0x1d, 0x00,  //.+@+.
-  0x60, 0x00,  //+%...
-  0xff, 0x00,  //@@@@.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0xfd, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x60, 0x00, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 4 */
-  0x00,  //....
-  0xfd,  //@@@+
-  0x03,  //...@
-  0x03,  //...@
-  0x3d,  //.@@+
-  0x07,  //..+@
-  0xfd,  //@@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xfd, 0x03, 0x03, 0x3d, 0x07, 0xfd, 0xfe, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 4 */
-  0x00,  //....
-  0x0c,  //..@.
-  0x2c,  //.%@.
-  0x3c,  //.@@.
-  0x9c,  //%+@.
-  0xff,  //@@@@
-  0x0c,  //..@.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x0c, 0x2c, 0x3c, 0x9c, 0xff, 0x0c, 0xfe, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 4 */
-  0x00,  //....
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xfd,  //@@@+
-  0x07,  //..+@
-  0x07,  //..+@
-  0xfd,  //@@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xff, 0xc0, 0xfd, 0x07, 0x07, 0xfd, 0xfe, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 4 */
-  0x00,  //....
-  0x2f,  //.%@@
-  0xa0,  //%%..
-  0xc0,  //@...
-  0xee,  //@%@%
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x2f, 0xa0, 0xc0, 0xee, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 4 */
-  0x00,  //....
-  0xff,  //@@@@
-  0x06,  //..+%
-  0x0d,  //..@+
-  0x0c,  //..@.
-  0x18,  //.+%.
-  0x30,  //.@..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xff, 0x06, 0x0d, 0x0c, 0x18, 0x30, 0xfe, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 4 */
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xbe,  //%@@%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x7d, 0xc3, 0xc3, 0x7d, 0xc3, 0xbe, 0xfe, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 4 */
-  0x00,  //....
-  0xbc,  //%@@.
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x03,  //...@
-  0x0a,  //..%%
-  0xf8,  //@@%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xbc, 0xc3, 0xbb, 0x03, 0x0a, 0xf8, 0xfe, 0x00,
 
   /*Unicode: U+003a (:) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+003b (;) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x06, 0xc0, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x06,  //..+%
-  0xa4,  //%%+.
-  0xa4,  //%%+.
-  0x06,  //..+%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x06, 0xa4, 0xa4, 0x06, 0xfe, 0x00,
 
   /*Unicode: U+003d (=) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0x00,  //....
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+003e (>) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%+..
-  0x1a,  //.+%%
-  0x1a,  //.+%%
-  0x90,  //%+..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x90, 0x1a, 0x1a, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+003f (?) , Width: 3 */
-  0x00,  //...
-  0xf8,  //@@%
-  0x2c,  //.%@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x00,  //...
-  0x30,  //.@.
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0xf8, 0x2c, 0x30, 0x30, 0x00, 0x30, 0xfe, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x3d,  //.@@+
-  0x93,  //%+.@
-  0xcb,  //@.%@
-  0xcb,  //@.%@
-  0xa0,  //%%..
-  0x3c,  //.@@.
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x00, 0x3d, 0x93, 0xcb, 0xcb, 0xa0, 0x3c, 0x00, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 4 */
-  0x00,  //....
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 4 */
-  0x00,  //....
-  0xfd,  //@@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xfd,  //@@@+
-  0xc3,  //@..@
-  0xfe,  //@@@%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xfd, 0xc3, 0xc3, 0xfd, 0xc3, 0xfe, 0xfe, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 4 */
-  0x00,  //....
-  0x2f,  //.%@@
-  0xa0,  //%%..
-  0xc0,  //@...
-  0xc0,  //@...
-  0xa0,  //%%..
-  0x2f,  //.%@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x2f, 0xa0, 0xc0, 0xc0, 0xa0, 0x2f, 0xfe, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 4 */
-  0x00,  //....
-  0xfc,  //@@@.
-  0xc6,  //@.+%
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc6,  //@.+%
-  0xfc,  //@@@.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xfc, 0xc6, 0xc3, 0xc3, 0xc6, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 4 */
-  0x00,  //....
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 4 */
-  0x00,  //....
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 4 */
-  0x00,  //....
-  0x2f,  //.%@@
-  0x90,  //%+..
-  0xc0,  //@...
-  0xcf,  //@.@@
-  0x93,  //%+.@
-  0x3e,  //.@@%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x2f, 0x90, 0xc0, 0xcf, 0x93, 0x3e, 0xfe, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 4 */
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xff,  //@@@@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfe, 0xc3, 0x02, 0xff, 0xc3, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 3 */
-  0x00,  //...
-  0xfc,  //@@@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xfc, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+004a (J) , Width: 3 */
-  0x00,  //...
-  0x3c,  //.@@
-  0x0c,  //..@
-  0x0c,  //..@
-  0x0c,  //..@
-  0x0c,  //..@
-  0xf8,  //@@%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0x3c, 0xfd, 0x0c, 0x00, 0xf8, 0xfe, 0x00,
 
   /*Unicode: U+004b (K) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xc2, 0x00,  //@..%.
-  0xc8, 0x00,  //@.%..
-  0xf4, 0x00,  //@@+..
-  0xec, 0x00,  //@%@..
-  0xc9, 0x00,  //@.%+.
-  0xc3, 0x00,  //@..@.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0xc2, 0x00, 0xc8, 0x00, 0xf4, 0x00, 0xec, 0x00, 0xc9, 0x00, 0xc3, 0xfa, 0x00,
 
   /*Unicode: U+004c (L) , Width: 4 */
-  0x00,  //....
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0xc0, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+004d (M) , Width: 4 */
-  0x00,  //....
-  0xd7,  //@++@
-  0xeb,  //@%%@
-  0xff,  //@@@@
-  0xff,  //@@@@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xd7, 0xeb, 0xff, 0xff, 0xc3, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+004e (N) , Width: 4 */
-  0x00,  //....
-  0xd3,  //@+.@
-  0xf3,  //@@.@
-  0xe7,  //@%+@
-  0xdf,  //@+@@
-  0xcf,  //@.@@
-  0xc7,  //@.+@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xd3, 0xf3, 0xe7, 0xdf, 0xcf, 0xc7, 0xfe, 0x00,
 
   /*Unicode: U+004f (O) , Width: 4 */
-  0x00,  //....
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 4 */
-  0x00,  //....
-  0xfd,  //@@@+
-  0xc7,  //@.+@
-  0xfd,  //@@@+
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0xfd, 0xc7, 0xfd, 0xfe, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 4 */
-  0x00,  //....
-  0x7d,  //+@@+
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd6,  //@++%
-  0x7c,  //+@@.
-  0x05,  //..++
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0x7d, 0xd7, 0xc3, 0xc3, 0xd6, 0x7c, 0x05, 0x00, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xfd, 0x00,  //@@@+.
-  0xc3, 0x00,  //@..@.
-  0xfd, 0x00,  //@@@+.
-  0xca, 0x00,  //@.%%.
-  0xc3, 0x00,  //@..@.
-  0xc1, 0x80,  //@..+%
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0d, 0x00, 0x00, 0xfd, 0x00, 0xc3, 0x00, 0xfd, 0x00, 0xca, 0x00, 0xc3, 0x00, 0xc1, 0x80, 0xfb,
+  0x00,
 
   /*Unicode: U+0053 (S) , Width: 4 */
-  0x00,  //....
-  0x7f,  //+@@@
-  0xc0,  //@...
-  0xb4,  //%@+.
-  0x0b,  //..%@
-  0x03,  //...@
-  0xfd,  //@@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x7f, 0xc0, 0xb4, 0x0b, 0x03, 0xfd, 0xfe, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 4 */
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0xc3, 0x00, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 4 */
-  0x00,  //....
-  0xc3,  //@..@
-  0x96,  //%++%
-  0x69,  //+%%+
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x28,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xc3, 0x96, 0x69, 0x3c, 0x3c, 0x28, 0xfe, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 5 */
-  0x00, 0x00,  //.....
-  0xc0, 0xc0,  //@...@
-  0xc0, 0xc0,  //@...@
-  0xbf, 0x80,  //%@@@%
-  0x7b, 0x40,  //+@%@+
-  0x73, 0x40,  //+@.@+
-  0x33, 0x00,  //.@.@.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x01, 0x00, 0x00, 0xfd, 0xc0, 0x06, 0xbf, 0x80, 0x7b, 0x40, 0x73, 0x40, 0x33, 0xfa, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 4 */
-  0x00,  //....
-  0x96,  //%++%
-  0x3c,  //.@@.
-  0x28,  //.%%.
-  0x38,  //.@%.
-  0x7c,  //+@@.
-  0x96,  //%++%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x96, 0x3c, 0x28, 0x38, 0x7c, 0x96, 0xfe, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x91, 0x80,  //%+.+%
-  0x33, 0x00,  //.@.@.
-  0x1d, 0x00,  //.+@+.
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0x91, 0x80, 0x33, 0x00, 0x1d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 4 */
-  0x00,  //....
-  0xff,  //@@@@
-  0x09,  //..%+
-  0x1c,  //.+@.
-  0x34,  //.@+.
-  0x70,  //+@..
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xff, 0x09, 0x1c, 0x34, 0x70, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+005b ([) , Width: 2 */
-  0xf0,  //@@
-  0xc0,  //@.
-  0xc0,  //@.
-  0xc0,  //@.
-  0xc0,  //@.
-  0xc0,  //@.
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xf0, 0xfc, 0xc0, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+005c (\) , Width: 4 */
-  0x00,  //....
-  0xc0,  //@...
-  0x60,  //+%..
-  0x30,  //.@..
-  0x14,  //.++.
-  0x0c,  //..@.
-  0x09,  //..%+
-  0x03,  //...@
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0x00, 0xc0, 0x60, 0x30, 0x14, 0x0c, 0x09, 0x03, 0x00, 0x00,
 
   /*Unicode: U+005d (]) , Width: 2 */
-  0xf0,  //@@
-  0x30,  //.@
-  0x30,  //.@
-  0x30,  //.@
-  0x30,  //.@
-  0x30,  //.@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xf0, 0xfc, 0x30, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+005e (^) , Width: 4 */
-  0x00,  //....
-  0x28,  //.%%.
-  0x82,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x28, 0x82, 0xfa, 0x00,
 
   /*Unicode: U+005f (_) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-
+  0xf1, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+0060 (`) , Width: 2 */
-  0x00,  //..
-  0x50,  //++
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0x50, 0xf9, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 4 */
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xed,  //@%@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xed,  //@%@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0xc0, 0x03, 0xed, 0xc3, 0xc3, 0xed, 0xfe, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x7c,  //+@@
-  0xc0,  //@..
-  0xc0,  //@..
-  0x7c,  //+@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x03, 0x7c, 0xc0, 0xc0, 0x7c, 0xfe, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 4 */
-  0x03,  //...@
-  0x03,  //...@
-  0x03,  //...@
-  0x7b,  //+@%@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7b,  //+@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x03, 0x03, 0x7b, 0xc3, 0xc3, 0x7b, 0xfe, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x7e,  //+@@%
-  0xff,  //@@@@
-  0xc0,  //@...
-  0x7f,  //+@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x7e, 0xff, 0xc0, 0x7f, 0xfe, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 4 */
-  0x1f,  //.+@@
-  0x30,  //.@..
-  0x30,  //.@..
-  0xff,  //@@@@
-  0x30,  //.@..
-  0x30,  //.@..
-  0x30,  //.@..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x1f, 0x30, 0x30, 0xff, 0xfe, 0x30, 0xfe, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x7b,  //+@%@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7b,  //+@%@
-  0x07,  //..+@
-  0xfc,  //@@@.
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x7b, 0xc3, 0xc3, 0x7b, 0x07, 0xfc, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 4 */
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xee,  //@%@%
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0xc0, 0x00, 0xee, 0xfe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 3 */
-  0x30,  //.@.
-  0x00,  //...
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x30, 0x00, 0x00, 0xf0, 0x30, 0x30, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+006a (j) , Width: 3 */
-  0x0c,  //..@
-  0x00,  //...
-  0x00,  //...
-  0x3c,  //.@@
-  0x0c,  //..@
-  0x0c,  //..@
-  0x0c,  //..@
-  0x0c,  //..@
-  0xf8,  //@@%
-  0x00,  //...
-
+  0x03, 0x0c, 0x00, 0x00, 0x3c, 0xfd, 0x0c, 0x01, 0xf8, 0x00,
 
   /*Unicode: U+006b (k) , Width: 5 */
-  0xc0, 0x00,  //@....
-  0xc0, 0x00,  //@....
-  0xc0, 0x00,  //@....
-  0xcb, 0x00,  //@.%@.
-  0xf8, 0x00,  //@@%..
-  0xfc, 0x00,  //@@@..
-  0xca, 0x00,  //@.%%.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xcb, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xca, 0xfa, 0x00,
 
   /*Unicode: U+006c (l) , Width: 4 */
-  0xf0,  //@@..
-  0x30,  //.@..
-  0x30,  //.@..
-  0x30,  //.@..
-  0x30,  //.@..
-  0x30,  //.@..
-  0x1f,  //.+@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0xf0, 0xfc, 0x30, 0x00, 0x1f, 0xfe, 0x00,
 
   /*Unicode: U+006d (m) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xfb, 0x80,  //@@%@%
-  0xcc, 0xc0,  //@.@.@
-  0xcc, 0xc0,  //@.@.@
-  0xcc, 0xc0,  //@.@.@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x07, 0xfb, 0x80, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+006e (n) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xee,  //@%@%
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x00, 0xee, 0xfe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+006f (o) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xed,  //@%@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xed,  //@%@+
-  0xc0,  //@...
-  0xc0,  //@...
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0xed, 0xc3, 0xc3, 0xed, 0xc0, 0xc0, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x7b,  //+@%@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7b,  //+@%@
-  0x03,  //...@
-  0x03,  //...@
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x7b, 0xc3, 0xc3, 0x7b, 0x03, 0x03, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xec,  //@%@
-  0xc0,  //@..
-  0xc0,  //@..
-  0xc0,  //@..
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x00, 0xec, 0xfe, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xbf,  //%@@@
-  0xf9,  //@@%+
-  0x07,  //..+@
-  0xfe,  //@@@%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xbf, 0xf9, 0x07, 0xfe, 0xfe, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x30,  //.@..
-  0xff,  //@@@@
-  0x30,  //.@..
-  0x30,  //.@..
-  0x2f,  //.%@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x00, 0x30, 0xff, 0x30, 0x30, 0x2f, 0xfe, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0xfe, 0xc3, 0x00, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xd7,  //@++@
-  0x69,  //+%%+
-  0x3c,  //.@@.
-  0x28,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xd7, 0x69, 0x3c, 0x28, 0xfe, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xc0, 0xc0,  //@...@
-  0x9d, 0x80,  //%+@+%
-  0x7f, 0x40,  //+@@@+
-  0x3f, 0x00,  //.@@@.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x06, 0xc0, 0xc0, 0x9d, 0x80, 0x7f, 0x40, 0x3f, 0xfa, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xaa,  //%%%%
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0xaa,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xaa, 0x28, 0x3c, 0xaa, 0xfe, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xc7,  //@.+@
-  0x6d,  //+%@+
-  0x3c,  //.@@.
-  0x24,  //.%+.
-  0x30,  //.@..
-  0xe0,  //@%..
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0xc7, 0x6d, 0x3c, 0x24, 0x30, 0xe0, 0x00,
 
   /*Unicode: U+007a (z) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0x2c,  //.%@.
-  0x70,  //+@..
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xff, 0x2c, 0x70, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+007b ({) , Width: 3 */
-  0x2c,  //.%@
-  0x30,  //.@.
-  0x30,  //.@.
-  0xe0,  //@%.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x2c,  //.%@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x2c, 0x30, 0x30, 0xe0, 0x30, 0x30, 0x2c, 0xfe, 0x00,
 
   /*Unicode: U+007c (|) , Width: 1 */
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xf9, 0xc0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+007d (}) , Width: 3 */
-  0xe0,  //@%.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x2c,  //.%@
-  0x30,  //.@.
-  0x30,  //.@.
-  0xe0,  //@%.
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0xe0, 0x30, 0x30, 0x2c, 0x30, 0x30, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+007e (~) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
-
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 4
   /*Unicode: U+0020 ( ) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xed, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 1 */
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xd0,  //@
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfe, 0xf0, 0x02, 0xd0, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0022 (") , Width: 3 */
-  0x00, 0x00,  //...
-  0xf0, 0xf0,  //@.@
-  0xf0, 0xf0,  //@.@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x01, 0x00, 0x00, 0xfd, 0xf0, 0xf3, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 5 */
-  0x00, 0xa5, 0x50,  //..%++
-  0x03, 0x78, 0x10,  //..+%.
-  0x8f, 0xff, 0xf0,  //%@@@@
-  0x09, 0x19, 0x00,  //.%.%.
-  0xff, 0xff, 0x80,  //@@@@%
-  0x09, 0x64, 0x00,  //.%++.
-  0x46, 0x90, 0x00,  //++%..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0x13, 0x00, 0xa5, 0x50, 0x03, 0x78, 0x10, 0x8f, 0xff, 0xf0, 0x09, 0x19, 0x00, 0xff, 0xff, 0x80,
+  0x09, 0x64, 0x00, 0x46, 0x90, 0xf7, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xf0, 0x00,  //..@..
-  0x7e, 0xff, 0xf0,  //+@@@@
-  0xe2, 0xf0, 0x00,  //@.@..
-  0x49, 0xf9, 0x30,  //+%@%.
-  0x00, 0xf2, 0xe0,  //..@.@
-  0xfe, 0xfe, 0x70,  //@@@@+
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfd, 0x00, 0x12, 0xf0, 0x00, 0x7e, 0xff, 0xf0, 0xe2, 0xf0, 0x00, 0x49, 0xf9, 0x30, 0x00, 0xf2,
+  0xe0, 0xfe, 0xfe, 0x70, 0x00, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x8f, 0x80, 0x00,  //%@%..
-  0xf4, 0xf0, 0x00,  //@+@..
-  0x8f, 0xd9, 0x50,  //%@@%+
-  0x49, 0xdf, 0x80,  //+%@@%
-  0x00, 0xf4, 0xf0,  //..@+@
-  0x00, 0x8f, 0x80,  //..%@%
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x11, 0x8f, 0x80, 0x00, 0xf4, 0xf0, 0x00, 0x8f, 0xd9, 0x50, 0x49, 0xdf, 0x80, 0x00,
+  0xf4, 0xf0, 0x00, 0x8f, 0x80, 0xf8, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 4 */
-  0x00, 0x00,  //....
-  0x09, 0xff,  //.%@@
-  0x0e, 0x20,  //.@..
-  0x0b, 0x90,  //.%%.
-  0xb4, 0xef,  //%+@@
-  0xe6, 0x95,  //@+%+
-  0x5e, 0xba,  //+@%%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x09, 0xff, 0x0e, 0x20, 0x0b, 0x90, 0xb4, 0xef, 0xe6, 0x95, 0x5e, 0xba, 0xfb,
+  0x00,
 
   /*Unicode: U+0027 (') , Width: 1 */
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0xf0, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+0028 (() , Width: 2 */
-  0x0a,  //.%
-  0x85,  //%+
-  0xd1,  //@.
-  0xf0,  //@.
-  0xd1,  //@.
-  0x85,  //%+
-  0x0a,  //.%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x06, 0x0a, 0x85, 0xd1, 0xf0, 0xd1, 0x85, 0x0a, 0xfe, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 2 */
-  0xa0,  //%.
-  0x58,  //+%
-  0x1d,  //.@
-  0x0f,  //.@
-  0x1d,  //.@
-  0x58,  //+%
-  0xa0,  //%.
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x06, 0xa0, 0x58, 0x1d, 0x0f, 0x1d, 0x58, 0xa0, 0xfe, 0x00,
 
   /*Unicode: U+002a (*) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x91, 0xf1, 0x90,  //%.@.%
-  0x1a, 0xfa, 0x10,  //.%@%.
-  0x1a, 0xfa, 0x10,  //.%@%.
-  0x91, 0xf1, 0x90,  //%.@.%
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x0b, 0x91, 0xf1, 0x90, 0x1a, 0xfa, 0x10, 0x1a, 0xfa, 0x10, 0x91, 0xf1, 0x90, 0xf2,
+  0x00,
 
   /*Unicode: U+002b (+) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfa, 0x00, 0x0c, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0xf7, 0x00,
 
   /*Unicode: U+002c (,) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x03, 0xf0, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
   /*Unicode: U+002e (.) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+002f (/) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x3c,  //...@
-  0x00, 0xa5,  //..%+
-  0x01, 0xe0,  //..@.
-  0x07, 0x70,  //.++.
-  0x0e, 0x10,  //.@..
-  0x5a, 0x00,  //+%..
-  0xc3, 0x00,  //@...
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfe, 0x00, 0x0b, 0x3c, 0x00, 0xa5, 0x01, 0xe0, 0x07, 0x70, 0x0e, 0x10, 0x5a, 0x00, 0xc3, 0xfc,
+  0x00,
 
   /*Unicode: U+0030 (0) , Width: 4 */
-  0x00, 0x00,  //....
-  0x3e, 0xe3,  //.@@.
-  0xc5, 0x5c,  //@++@
-  0xfb, 0x0f,  //@%.@
-  0xf0, 0x0f,  //@..@
-  0xc5, 0x5c,  //@++@
-  0x3e, 0xe3,  //.@@.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x3e, 0xe3, 0xc5, 0x5c, 0xfb, 0x0f, 0xf0, 0x0f, 0xc5, 0x5c, 0x3e, 0xe3, 0xfb,
+  0x00,
 
   /*Unicode: U+0031 (1) , Width: 3 */
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+0032 (2) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xe6, 0x00,  //@@@+.
-  0x00, 0x3f, 0x00,  //...@.
-  0x00, 0x4f, 0x00,  //..+@.
-  0x04, 0xe5, 0x00,  //.+@+.
-  0x6a, 0x20, 0x00,  //+%...
-  0xff, 0xff, 0x00,  //@@@@.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x10, 0xff, 0xe6, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x4f, 0x00, 0x04, 0xe5, 0x00, 0x6a,
+  0x20, 0x00, 0xff, 0xff, 0xf7, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xd4,  //@@@+
-  0x00, 0x3e,  //...@
-  0x00, 0x3d,  //...@
-  0x0f, 0xf4,  //.@@+
-  0x00, 0x4e,  //..+@
-  0xff, 0xe7,  //@@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xd4, 0x00, 0x3e, 0x00, 0x3d, 0x0f, 0xf4, 0x00, 0x4e, 0xff, 0xe7, 0xfb,
+  0x00,
 
   /*Unicode: U+0034 (4) , Width: 4 */
-  0x00, 0x00,  //....
-  0x01, 0xf0,  //..@.
-  0x09, 0xf0,  //.%@.
-  0x2e, 0xf0,  //.@@.
-  0xa7, 0xf0,  //%+@.
-  0xff, 0xff,  //@@@@
-  0x00, 0xf0,  //..@.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x01, 0xf0, 0x09, 0xf0, 0x2e, 0xf0, 0xa7, 0xf0, 0xff, 0xff, 0x00, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+0035 (5) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xd4,  //@@@+
-  0x00, 0x4e,  //..+@
-  0x00, 0x4e,  //..+@
-  0xff, 0xd4,  //@@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xd4, 0x00, 0x4e, 0x00, 0x4e, 0xff, 0xd4, 0xfb,
+  0x00,
 
   /*Unicode: U+0036 (6) , Width: 4 */
-  0x00, 0x00,  //....
-  0x1b, 0xff,  //.%@@
-  0xbb, 0x10,  //%%..
-  0xe3, 0x00,  //@...
-  0xfa, 0xf8,  //@%@%
-  0xc3, 0x3f,  //@..@
-  0x4e, 0xf7,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x1b, 0xff, 0xbb, 0x10, 0xe3, 0x00, 0xfa, 0xf8, 0xc3, 0x3f, 0x4e, 0xf7, 0xfb,
+  0x00,
 
   /*Unicode: U+0037 (7) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xfe,  //@@@@
-  0x00, 0x79,  //..+%
-  0x00, 0xc4,  //..@+
-  0x02, 0xe0,  //..@.
-  0x07, 0x90,  //.+%.
-  0x0d, 0x30,  //.@..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x79, 0x00, 0xc4, 0x02, 0xe0, 0x07, 0x90, 0x0d, 0x30, 0xfb,
+  0x00,
 
   /*Unicode: U+0038 (8) , Width: 4 */
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe3, 0x3e,  //@..@
-  0xd2, 0x3d,  //@..@
-  0x5f, 0xf4,  //+@@+
-  0xe3, 0x3e,  //@..@
-  0x8f, 0xf8,  //%@@%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x6e, 0xe5, 0xe3, 0x3e, 0xd2, 0x3d, 0x5f, 0xf4, 0xe3, 0x3e, 0x8f, 0xf8, 0xfb,
+  0x00,
 
   /*Unicode: U+0039 (9) , Width: 4 */
-  0x00, 0x00,  //....
-  0x8f, 0xe3,  //%@@.
-  0xf3, 0x3c,  //@..@
-  0x8f, 0xaf,  //%@%@
-  0x00, 0x3e,  //...@
-  0x01, 0xbb,  //..%%
-  0xff, 0xb1,  //@@%.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x8f, 0xe3, 0xf3, 0x3c, 0x8f, 0xaf, 0x00, 0x3e, 0x01, 0xbb, 0xff, 0xb1, 0xfb,
+  0x00,
 
   /*Unicode: U+003a (:) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+003b (;) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x06, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x5b,  //..+%
-  0x8a, 0x50,  //%%+.
-  0x8a, 0x50,  //%%+.
-  0x00, 0x5b,  //..+%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfa, 0x00, 0x06, 0x5b, 0x8a, 0x50, 0x8a, 0x50, 0x00, 0x5b, 0xfb, 0x00,
 
   /*Unicode: U+003d (=) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+003e (>) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xa5, 0x00,  //%+..
-  0x05, 0xa8,  //.+%%
-  0x05, 0xa8,  //.+%%
-  0xb5, 0x00,  //%+..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x06, 0xa5, 0x00, 0x05, 0xa8, 0x05, 0xa8, 0xb5, 0xfa, 0x00,
 
   /*Unicode: U+003f (?) , Width: 3 */
-  0x00, 0x00,  //...
-  0xfc, 0x90,  //@@%
-  0x0b, 0xd0,  //.%@
-  0x0f, 0x20,  //.@.
-  0x0f, 0x00,  //.@.
-  0x00, 0x00,  //...
-  0x0f, 0x00,  //.@.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x08, 0x00, 0x00, 0xfc, 0x90, 0x0b, 0xd0, 0x0f, 0x20, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfa, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x1c, 0xe5,  //.@@+
-  0xb7, 0x3d,  //%+.@
-  0xe0, 0xbf,  //@.%@
-  0xe0, 0xbf,  //@.%@
-  0xb8, 0x00,  //%%..
-  0x2c, 0xe0,  //.@@.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x0b, 0x1c, 0xe5, 0xb7, 0x3d, 0xe0, 0xbf, 0xe0, 0xbf, 0xb8, 0x00, 0x2c, 0xe0, 0xfd,
+  0x00,
 
   /*Unicode: U+0041 (A) , Width: 4 */
-  0x00, 0x00,  //....
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+0042 (B) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xe5,  //@@@+
-  0xf0, 0x2e,  //@..@
-  0xf0, 0x3d,  //@..@
-  0xff, 0xf6,  //@@@+
-  0xf0, 0x2e,  //@..@
-  0xff, 0xf8,  //@@@%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xe5, 0xf0, 0x2e, 0xf0, 0x3d, 0xff, 0xf6, 0xf0, 0x2e, 0xff, 0xf8, 0xfb,
+  0x00,
 
   /*Unicode: U+0043 (C) , Width: 4 */
-  0x00, 0x00,  //....
-  0x1b, 0xff,  //.%@@
-  0xa8, 0x00,  //%%..
-  0xe0, 0x00,  //@...
-  0xe0, 0x00,  //@...
-  0xb8, 0x00,  //%%..
-  0x1b, 0xff,  //.%@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x1b, 0xff, 0xa8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xb8, 0x00, 0x1b, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+0044 (D) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xc2,  //@@@.
-  0xf0, 0x7b,  //@.+%
-  0xf0, 0x0e,  //@..@
-  0xf0, 0x0e,  //@..@
-  0xf0, 0x7b,  //@.+%
-  0xff, 0xc2,  //@@@.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xc2, 0xf0, 0x7b, 0xf0, 0x0e, 0xf0, 0x0e, 0xf0, 0x7b, 0xff, 0xc2, 0xfb,
+  0x00,
 
   /*Unicode: U+0045 (E) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+0046 (F) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0c, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 4 */
-  0x00, 0x00,  //....
-  0x1b, 0xff,  //.%@@
-  0xa7, 0x00,  //%+..
-  0xe0, 0x00,  //@...
-  0xe0, 0xff,  //@.@@
-  0xb6, 0x0f,  //%+.@
-  0x2c, 0xe8,  //.@@%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x1b, 0xff, 0xa7, 0x00, 0xe0, 0x00, 0xe0, 0xff, 0xb6, 0x0f, 0x2c, 0xe8, 0xfb,
+  0x00,
 
   /*Unicode: U+0048 (H) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xff, 0xff,  //@@@@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xfb,
+  0x00,
 
   /*Unicode: U+0049 (I) , Width: 3 */
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+004a (J) , Width: 3 */
-  0x00, 0x00,  //...
-  0x0f, 0xf0,  //.@@
-  0x00, 0xf0,  //..@
-  0x00, 0xf0,  //..@
-  0x00, 0xf0,  //..@
-  0x01, 0xf0,  //..@
-  0xff, 0x90,  //@@%
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xf0, 0xff, 0x90, 0xfb,
+  0x00,
 
   /*Unicode: U+004b (K) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xf0, 0x1b, 0x10,  //@..%.
-  0xf1, 0xb1, 0x00,  //@.%..
-  0xfc, 0x50, 0x00,  //@@+..
-  0xf8, 0xc0, 0x00,  //@%@..
-  0xf0, 0xb7, 0x00,  //@.%+.
-  0xf0, 0x1e, 0x20,  //@..@.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x11, 0xf0, 0x1b, 0x10, 0xf1, 0xb1, 0x00, 0xfc, 0x50, 0x00, 0xf8, 0xc0, 0x00, 0xf0,
+  0xb7, 0x00, 0xf0, 0x1e, 0x20, 0xf8, 0x00,
 
   /*Unicode: U+004c (L) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+004d (M) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf5, 0x5f,  //@++@
-  0xf9, 0x9f,  //@%%@
-  0xfd, 0xdf,  //@@@@
-  0xfe, 0xef,  //@@@@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf5, 0x5f, 0xf9, 0x9f, 0xfd, 0xdf, 0xfe, 0xef, 0xf0, 0x0f, 0xf0, 0x0f, 0xfb,
+  0x00,
 
   /*Unicode: U+004e (N) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf7, 0x0f,  //@+.@
-  0xfe, 0x0f,  //@@.@
-  0xfb, 0x6f,  //@%+@
-  0xf4, 0xef,  //@+@@
-  0xf0, 0xdf,  //@.@@
-  0xf0, 0x6f,  //@.+@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf7, 0x0f, 0xfe, 0x0f, 0xfb, 0x6f, 0xf4, 0xef, 0xf0, 0xdf, 0xf0, 0x6f, 0xfb,
+  0x00,
 
   /*Unicode: U+004f (O) , Width: 4 */
-  0x00, 0x00,  //....
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+0050 (P) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xe7,  //@@@+
-  0xf0, 0x4f,  //@.+@
-  0xff, 0xe7,  //@@@+
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0c, 0x00, 0x00, 0xff, 0xe7, 0xf0, 0x4f, 0xff, 0xe7, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 4 */
-  0x00, 0x00,  //....
-  0x4e, 0xe4,  //+@@+
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4b,  //@++%
-  0x4e, 0xf2,  //+@@.
-  0x00, 0x75,  //..++
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0f, 0x00, 0x00, 0x4e, 0xe4, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4b, 0x4e, 0xf2, 0x00,
+  0x75, 0xfd, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xe7, 0x00,  //@@@+.
-  0xf0, 0x3e, 0x00,  //@..@.
-  0xff, 0xe4, 0x00,  //@@@+.
-  0xf1, 0xb8, 0x00,  //@.%%.
-  0xf0, 0x1e, 0x10,  //@..@.
-  0xf0, 0x07, 0xb0,  //@..+%
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x11, 0xff, 0xe7, 0x00, 0xf0, 0x3e, 0x00, 0xff, 0xe4, 0x00, 0xf1, 0xb8, 0x00, 0xf0,
+  0x1e, 0x10, 0xf0, 0x07, 0xb0, 0xf8, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 4 */
-  0x00, 0x00,  //....
-  0x5e, 0xff,  //+@@@
-  0xe3, 0x00,  //@...
-  0xbc, 0x71,  //%@+.
-  0x03, 0x9d,  //..%@
-  0x00, 0x3f,  //...@
-  0xff, 0xe6,  //@@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x5e, 0xff, 0xe3, 0x00, 0xbc, 0x71, 0x03, 0x9d, 0x00, 0x3f, 0xff, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+0054 (T) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x10, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xe2, 0x3e,  //@..@
-  0x5e, 0xe5,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe2, 0x3e, 0x5e, 0xe5, 0xfb,
+  0x00,
 
   /*Unicode: U+0056 (V) , Width: 4 */
-  0x00, 0x00,  //....
-  0xd2, 0x2d,  //@..@
-  0x96, 0x69,  //%++%
-  0x5b, 0xb5,  //+%%+
-  0x1e, 0xe1,  //.@@.
-  0x0d, 0xd0,  //.@@.
-  0x09, 0x90,  //.%%.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xd2, 0x2d, 0x96, 0x69, 0x5b, 0xb5, 0x1e, 0xe1, 0x0d, 0xd0, 0x09, 0x90, 0xfb,
+  0x00,
 
   /*Unicode: U+0057 (W) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xe1, 0x01, 0xe0,  //@...@
-  0xc3, 0x03, 0xc0,  //@...@
-  0x9d, 0xfd, 0x90,  //%@@@%
-  0x7f, 0x9f, 0x70,  //+@%@+
-  0x5f, 0x1f, 0x50,  //+@.@+
-  0x2c, 0x0c, 0x20,  //.@.@.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x11, 0xe1, 0x01, 0xe0, 0xc3, 0x03, 0xc0, 0x9d, 0xfd, 0x90, 0x7f, 0x9f, 0x70, 0x5f,
+  0x1f, 0x50, 0x2c, 0x0c, 0x20, 0xf8, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 4 */
-  0x00, 0x00,  //....
-  0xb6, 0x7b,  //%++%
-  0x2e, 0xe2,  //.@@.
-  0x09, 0x90,  //.%%.
-  0x0c, 0xb0,  //.@%.
-  0x4d, 0xd3,  //+@@.
-  0xb5, 0x6b,  //%++%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xb6, 0x7b, 0x2e, 0xe2, 0x09, 0x90, 0x0c, 0xb0, 0x4d, 0xd3, 0xb5, 0x6b, 0xfb,
+  0x00,
 
   /*Unicode: U+0059 (Y) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xb7, 0x07, 0xb0,  //%+.+%
-  0x2e, 0x3e, 0x10,  //.@.@.
-  0x07, 0xf7, 0x00,  //.+@+.
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x10, 0xb7, 0x07, 0xb0, 0x2e, 0x3e, 0x10, 0x07, 0xf7, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0x00, 0xa7,  //..%+
-  0x04, 0xd0,  //.+@.
-  0x0d, 0x50,  //.@+.
-  0x7c, 0x00,  //+@..
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xff, 0xff, 0x00, 0xa7, 0x04, 0xd0, 0x0d, 0x50, 0x7c, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+005b ([) , Width: 2 */
-  0xff,  //@@
-  0xf0,  //@.
-  0xf0,  //@.
-  0xf0,  //@.
-  0xf0,  //@.
-  0xf0,  //@.
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xff, 0xfc, 0xf0, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+005c (\) , Width: 4 */
-  0x00, 0x00,  //....
-  0xc3, 0x00,  //@...
-  0x5a, 0x00,  //+%..
-  0x0e, 0x10,  //.@..
-  0x07, 0x70,  //.++.
-  0x01, 0xe0,  //..@.
-  0x00, 0xa5,  //..%+
-  0x00, 0x3c,  //...@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0f, 0x00, 0x00, 0xc3, 0x00, 0x5a, 0x00, 0x0e, 0x10, 0x07, 0x70, 0x01, 0xe0, 0x00, 0xa5, 0x00,
+  0x3c, 0xfd, 0x00,
 
   /*Unicode: U+005d (]) , Width: 2 */
-  0xff,  //@@
-  0x0f,  //.@
-  0x0f,  //.@
-  0x0f,  //.@
-  0x0f,  //.@
-  0x0f,  //.@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x00, 0xff, 0xfc, 0x0f, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+005e (^) , Width: 4 */
-  0x00, 0x00,  //....
-  0x0a, 0xa0,  //.%%.
-  0x82, 0x38,  //%..%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x05, 0x00, 0x00, 0x0a, 0xa0, 0x82, 0x38, 0xf3, 0x00,
 
   /*Unicode: U+005f (_) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-
+  0xe9, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0060 (`) , Width: 2 */
-  0x00,  //..
-  0x55,  //++
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0x55, 0xf9, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 4 */
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf9, 0xe6,  //@%@+
-  0xf2, 0x2e,  //@..@
-  0xf2, 0x2e,  //@..@
-  0xf9, 0xe6,  //@%@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf9, 0xe6, 0xf2, 0x2e, 0xf2, 0x2e, 0xf9, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+0063 (c) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x6e, 0xf0,  //+@@
-  0xe3, 0x00,  //@..
-  0xe3, 0x00,  //@..
-  0x6e, 0xf0,  //+@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xfb, 0x00, 0x07, 0x6e, 0xf0, 0xe3, 0x00, 0xe3, 0x00, 0x6e, 0xf0, 0xfb, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 4 */
-  0x00, 0x0f,  //...@
-  0x00, 0x0f,  //...@
-  0x00, 0x0f,  //...@
-  0x6e, 0x9f,  //+@%@
-  0xe2, 0x3f,  //@..@
-  0xe2, 0x3f,  //@..@
-  0x6e, 0x9f,  //+@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x6e, 0x9f, 0xe2, 0x3f, 0xe2, 0x3f, 0x6e, 0x9f, 0xfb,
+  0x00,
 
   /*Unicode: U+0065 (e) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x4e, 0xf8,  //+@@%
-  0xef, 0xff,  //@@@@
-  0xe3, 0x00,  //@...
-  0x4d, 0xff,  //+@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0x4e, 0xf8, 0xef, 0xff, 0xe3, 0x00, 0x4d, 0xff, 0xfb, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 4 */
-  0x05, 0xef,  //.+@@
-  0x0e, 0x20,  //.@..
-  0x0f, 0x00,  //.@..
-  0xff, 0xff,  //@@@@
-  0x0f, 0x00,  //.@..
-  0x0f, 0x00,  //.@..
-  0x0f, 0x00,  //.@..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0c, 0x05, 0xef, 0x0e, 0x20, 0x0f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xfa, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x6e, 0xaf,  //+@%@
-  0xe3, 0x3f,  //@..@
-  0xe3, 0x2f,  //@..@
-  0x6f, 0xaf,  //+@%@
-  0x00, 0x4c,  //..+@
-  0xff, 0xd3,  //@@@.
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x0d, 0x6e, 0xaf, 0xe3, 0x3f, 0xe3, 0x2f, 0x6f, 0xaf, 0x00, 0x4c, 0xff, 0xd3, 0x00,
+  0x00,
 
   /*Unicode: U+0068 (h) , Width: 4 */
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf8, 0xf8,  //@%@%
-  0xf3, 0x2f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf8, 0xf8, 0xf3, 0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfb,
+  0x00,
 
   /*Unicode: U+0069 (i) , Width: 3 */
-  0x0f, 0x00,  //.@.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x00, 0x0f, 0xfc, 0x00, 0x07, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb, 0x00,
 
   /*Unicode: U+006a (j) , Width: 3 */
-  0x00, 0xf0,  //..@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x0f, 0xf0,  //.@@
-  0x00, 0xf0,  //..@
-  0x00, 0xf0,  //..@
-  0x00, 0xf0,  //..@
-  0x01, 0xf0,  //..@
-  0xff, 0x80,  //@@%
-  0x00, 0x00,  //...
-
+  0x01, 0x00, 0xf0, 0xfd, 0x00, 0x0d, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xf0,
+  0xff, 0x80, 0x00, 0x00,
 
   /*Unicode: U+006b (k) , Width: 5 */
-  0xf0, 0x00, 0x00,  //@....
-  0xf0, 0x00, 0x00,  //@....
-  0xf0, 0x00, 0x00,  //@....
-  0xf0, 0xac, 0x10,  //@.%@.
-  0xfc, 0xa0, 0x00,  //@@%..
-  0xfc, 0xc0, 0x00,  //@@@..
-  0xf0, 0xa9, 0x00,  //@.%%.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0x13, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xac, 0x10, 0xfc, 0xa0, 0x00,
+  0xfc, 0xc0, 0x00, 0xf0, 0xa9, 0xf7, 0x00,
 
   /*Unicode: U+006c (l) , Width: 4 */
-  0xff, 0x00,  //@@..
-  0x0f, 0x00,  //.@..
-  0x0f, 0x00,  //.@..
-  0x0f, 0x00,  //.@..
-  0x0f, 0x00,  //.@..
-  0x0e, 0x30,  //.@..
-  0x06, 0xff,  //.+@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0e, 0x30, 0x06, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+006d (m) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xfc, 0x9d, 0xa0,  //@@%@%
-  0xf2, 0xf2, 0xf0,  //@.@.@
-  0xf0, 0xf0, 0xf0,  //@.@.@
-  0xf0, 0xf0, 0xf0,  //@.@.@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x04, 0xfc, 0x9d, 0xa0, 0xf2, 0xf2, 0xfa, 0xf0, 0xf8, 0x00,
 
   /*Unicode: U+006e (n) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xf8, 0xf8,  //@%@%
-  0xf3, 0x2f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xf8, 0xf8, 0xf3, 0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfb, 0x00,
 
   /*Unicode: U+006f (o) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xf9, 0xe6,  //@%@+
-  0xf2, 0x2e,  //@..@
-  0xf2, 0x2e,  //@..@
-  0xf9, 0xe6,  //@%@+
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x0a, 0xf9, 0xe6, 0xf2, 0x2e, 0xf2, 0x2e, 0xf9, 0xe6, 0xf0, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x6e, 0x9f,  //+@%@
-  0xe2, 0x3f,  //@..@
-  0xe2, 0x3f,  //@..@
-  0x6e, 0x9f,  //+@%@
-  0x00, 0x0f,  //...@
-  0x00, 0x0f,  //...@
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x0d, 0x6e, 0x9f, 0xe2, 0x3f, 0xe2, 0x3f, 0x6e, 0x9f, 0x00, 0x0f, 0x00, 0x0f, 0x00,
+  0x00,
 
   /*Unicode: U+0072 (r) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xfa, 0xf0,  //@%@
-  0xf3, 0x00,  //@..
-  0xf0, 0x00,  //@..
-  0xf0, 0x00,  //@..
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xfb, 0x00, 0x06, 0xfa, 0xf0, 0xf3, 0x00, 0xf0, 0x00, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x9e, 0xff,  //%@@@
-  0xcd, 0xa4,  //@@%+
-  0x02, 0x6e,  //..+@
-  0xff, 0xe8,  //@@@%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0x9e, 0xff, 0xcd, 0xa4, 0x02, 0x6e, 0xff, 0xe8, 0xfb, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x0f, 0x00,  //.@..
-  0xff, 0xff,  //@@@@
-  0x0f, 0x00,  //.@..
-  0x0f, 0x10,  //.@..
-  0x09, 0xff,  //.%@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x09, 0x0f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0x0f, 0x10, 0x09, 0xff, 0xfb, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf2, 0x3f,  //@..@
-  0x8f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf2, 0x3f, 0x8f, 0x8f, 0xfb, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xc4, 0x4c,  //@++@
-  0x6a, 0xa6,  //+%%+
-  0x0e, 0xe0,  //.@@.
-  0x0a, 0xa0,  //.%%.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xc4, 0x4c, 0x6a, 0xa6, 0x0e, 0xe0, 0x0a, 0xa0, 0xfb, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xd2, 0x02, 0xd0,  //@...@
-  0x97, 0xe7, 0x90,  //%+@+%
-  0x5e, 0xfe, 0x50,  //+@@@+
-  0x1f, 0xef, 0x10,  //.@@@.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x0b, 0xd2, 0x02, 0xd0, 0x97, 0xe7, 0x90, 0x5e, 0xfe, 0x50, 0x1f, 0xef, 0x10, 0xf8,
+  0x00,
 
   /*Unicode: U+0078 (x) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x9b, 0xb9,  //%%%%
-  0x0b, 0xb0,  //.%%.
-  0x0c, 0xc0,  //.@@.
-  0x9a, 0xa9,  //%%%%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0x9b, 0xb9, 0x0b, 0xb0, 0x0c, 0xc0, 0x9a, 0xa9, 0xfb, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xd3, 0x5c,  //@.+@
-  0x79, 0xc5,  //+%@+
-  0x1f, 0xd0,  //.@@.
-  0x0b, 0x70,  //.%+.
-  0x1e, 0x10,  //.@..
-  0xf8, 0x00,  //@%..
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x0a, 0xd3, 0x5c, 0x79, 0xc5, 0x1f, 0xd0, 0x0b, 0x70, 0x1e, 0x10, 0xf8, 0xfe, 0x00,
 
   /*Unicode: U+007a (z) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xfe,  //@@@@
-  0x09, 0xe2,  //.%@.
-  0x4e, 0x20,  //+@..
-  0xef, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xff, 0xfe, 0x09, 0xe2, 0x4e, 0x20, 0xef, 0xff, 0xfb, 0x00,
 
   /*Unicode: U+007b ({) , Width: 3 */
-  0x0a, 0xf0,  //.%@
-  0x0f, 0x00,  //.@.
-  0x1f, 0x00,  //.@.
-  0xf8, 0x00,  //@%.
-  0x2f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0a, 0xf0,  //.%@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x0a, 0xf0, 0x0f, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x2f, 0x00, 0x0f, 0x00, 0x0a, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+007c (|) , Width: 1 */
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xf9, 0xf0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+007d (}) , Width: 3 */
-  0xfa, 0x00,  //@%.
-  0x1f, 0x00,  //.@.
-  0x0f, 0x10,  //.@.
-  0x08, 0xf0,  //.%@
-  0x0f, 0x20,  //.@.
-  0x0f, 0x00,  //.@.
-  0xfa, 0x00,  //@%.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0c, 0xfa, 0x00, 0x1f, 0x00, 0x0f, 0x10, 0x08, 0xf0, 0x0f, 0x20, 0x0f, 0x00, 0xfa, 0xfa, 0x00,
 
   /*Unicode: U+007e (~) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
-
+  0xf9, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 8
   /*Unicode: U+0020 ( ) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xe3, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 1 */
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0xfa,  //@
-  0xda,  //@
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x06, 0x00, 0xff, 0xff, 0xfa, 0xda, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+0022 (") , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0x00, 0xff,  //@.@
-  0xff, 0x00, 0xff,  //@.@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x05, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xec, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 5 */
-  0x00, 0x02, 0xa2, 0x52, 0x52,  //..%++
-  0x00, 0x30, 0x76, 0x88, 0x1a,  //..+%.
-  0x86, 0xff, 0xff, 0xff, 0xff,  //%@@@@
-  0x00, 0x96, 0x14, 0x9e, 0x00,  //.%.%.
-  0xff, 0xff, 0xff, 0xff, 0x86,  //@@@@%
-  0x0e, 0x96, 0x66, 0x40, 0x00,  //.%++.
-  0x44, 0x62, 0x98, 0x0c, 0x00,  //++%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0x0a, 0x00, 0x02, 0xa2, 0x52, 0x52, 0x00, 0x30, 0x76, 0x88, 0x1a, 0x86, 0xfd, 0xff, 0x04, 0x00,
+  0x96, 0x14, 0x9e, 0x00, 0xfd, 0xff, 0x09, 0x86, 0x0e, 0x96, 0x66, 0x40, 0x00, 0x44, 0x62, 0x98,
+  0x0c, 0xf1, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x78, 0xea, 0xff, 0xff, 0xff,  //+@@@@
-  0xee, 0x28, 0xff, 0x00, 0x00,  //@.@..
-  0x44, 0x9c, 0xff, 0x9a, 0x3c,  //+%@%.
-  0x00, 0x00, 0xff, 0x2e, 0xec,  //..@.@
-  0xf6, 0xec, 0xff, 0xea, 0x76,  //@@@@+
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfa, 0x00, 0x04, 0xff, 0x00, 0x00, 0x78, 0xea, 0xfe, 0xff, 0x16, 0xee, 0x28, 0xff, 0x00, 0x00,
+  0x44, 0x9c, 0xff, 0x9a, 0x3c, 0x00, 0x00, 0xff, 0x2e, 0xec, 0xf6, 0xec, 0xff, 0xea, 0x76, 0x00,
+  0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x88, 0xf2, 0x84, 0x00, 0x00,  //%@%..
-  0xf2, 0x4a, 0xf0, 0x00, 0x06,  //@+@..
-  0x8a, 0xf6, 0xd4, 0x98, 0x58,  //%@@%+
-  0x48, 0x9e, 0xd8, 0xf4, 0x80,  //+%@@%
-  0x02, 0x00, 0xf2, 0x4a, 0xf0,  //..@+@
-  0x00, 0x00, 0x8a, 0xf2, 0x86,  //..%@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x1d, 0x88, 0xf2, 0x84, 0x00, 0x00, 0xf2, 0x4a, 0xf0, 0x00, 0x06, 0x8a, 0xf6, 0xd4,
+  0x98, 0x58, 0x48, 0x9e, 0xd8, 0xf4, 0x80, 0x02, 0x00, 0xf2, 0x4a, 0xf0, 0x00, 0x00, 0x8a, 0xf2,
+  0x86, 0xf2, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x90, 0xf6, 0xff,  //.%@@
-  0x00, 0xea, 0x28, 0x00,  //.@..
-  0x0a, 0xba, 0x90, 0x00,  //.%%.
-  0xba, 0x48, 0xea, 0xf4,  //%+@@
-  0xec, 0x60, 0x90, 0x5a,  //@+%+
-  0x56, 0xe4, 0xbe, 0xa4,  //+@%%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x16, 0x90, 0xf6, 0xff, 0x00, 0xea, 0x28, 0x00, 0x0a, 0xba, 0x90, 0x00, 0xba, 0x48,
+  0xea, 0xf4, 0xec, 0x60, 0x90, 0x5a, 0x56, 0xe4, 0xbe, 0xa4, 0xf5, 0x00,
 
   /*Unicode: U+0027 (') , Width: 1 */
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0xff, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+0028 (() , Width: 2 */
-  0x0e, 0xa2,  //.%
-  0x82, 0x56,  //%+
-  0xda, 0x18,  //@.
-  0xf8, 0x02,  //@.
-  0xda, 0x18,  //@.
-  0x82, 0x56,  //%+
-  0x0e, 0xa2,  //.%
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x0d, 0x0e, 0xa2, 0x82, 0x56, 0xda, 0x18, 0xf8, 0x02, 0xda, 0x18, 0x82, 0x56, 0x0e, 0xa2, 0xfb,
+  0x00,
 
   /*Unicode: U+0029 ()) , Width: 2 */
-  0xa2, 0x0e,  //%.
-  0x56, 0x82,  //+%
-  0x18, 0xda,  //.@
-  0x04, 0xf8,  //.@
-  0x18, 0xda,  //.@
-  0x56, 0x82,  //+%
-  0xa2, 0x0e,  //%.
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x0d, 0xa2, 0x0e, 0x56, 0x82, 0x18, 0xda, 0x04, 0xf8, 0x18, 0xda, 0x56, 0x82, 0xa2, 0x0e, 0xfb,
+  0x00,
 
   /*Unicode: U+002a (*) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x9e, 0x1a, 0xff, 0x1a, 0x9e,  //%.@.%
-  0x1a, 0xa6, 0xff, 0xa6, 0x1a,  //.%@%.
-  0x1a, 0xa6, 0xff, 0xa6, 0x1a,  //.%@%.
-  0x9e, 0x1a, 0xff, 0x1a, 0x9e,  //%.@.%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x13, 0x9e, 0x1a, 0xff, 0x1a, 0x9e, 0x1a, 0xa6, 0xff, 0xa6, 0x1a, 0x1a, 0xa6, 0xff,
+  0xa6, 0x1a, 0x9e, 0x1a, 0xff, 0x1a, 0x9e, 0xe8, 0x00,
 
   /*Unicode: U+002b (+) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf5, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xf0, 0x00,
 
   /*Unicode: U+002c (,) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf9, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00,
 
   /*Unicode: U+002e (.) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfb, 0x00, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+002f (/) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x36, 0xc8,  //...@
-  0x00, 0x00, 0xa4, 0x5a,  //..%+
-  0x00, 0x16, 0xe0, 0x04,  //..@.
-  0x00, 0x7e, 0x7e, 0x00,  //.++.
-  0x04, 0xe0, 0x16, 0x00,  //.@..
-  0x5a, 0xa2, 0x00, 0x00,  //+%..
-  0xc8, 0x34, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x17, 0x36, 0xc8, 0x00, 0x00, 0xa4, 0x5a, 0x00, 0x16, 0xe0, 0x04, 0x00, 0x7e, 0x7e,
+  0x00, 0x04, 0xe0, 0x16, 0x00, 0x5a, 0xa2, 0x00, 0x00, 0xc8, 0x34, 0xf7, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x3c, 0xe0, 0xe0, 0x3a,  //.@@.
-  0xc6, 0x54, 0x54, 0xc4,  //@++@
-  0xf2, 0xbc, 0x08, 0xf2,  //@%.@
-  0xf2, 0x08, 0x08, 0xf2,  //@..@
-  0xc6, 0x52, 0x52, 0xc4,  //@++@
-  0x3e, 0xe0, 0xe0, 0x3c,  //.@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x3c, 0xe0, 0xe0, 0x3a, 0xc6, 0x54, 0x54, 0xc4, 0xf2, 0xbc, 0x08, 0xf2, 0xf2,
+  0x08, 0x08, 0xf2, 0xc6, 0x52, 0x52, 0xc4, 0x3e, 0xe0, 0xe0, 0x3c, 0xf5, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x0e, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xe4, 0x64, 0x00,  //@@@+.
-  0x00, 0x00, 0x38, 0xf4, 0x02,  //...@.
-  0x00, 0x00, 0x40, 0xf8, 0x0e,  //..+@.
-  0x00, 0x40, 0xe8, 0x5a, 0x00,  //.+@+.
-  0x68, 0xac, 0x26, 0x00, 0x00,  //+%...
-  0xff, 0xff, 0xff, 0xff, 0x0a,  //@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x03, 0xff, 0xff, 0xe4, 0x64, 0xfe, 0x00, 0x11, 0x38, 0xf4, 0x02, 0x00, 0x00, 0x40,
+  0xf8, 0x0e, 0x00, 0x40, 0xe8, 0x5a, 0x00, 0x68, 0xac, 0x26, 0x00, 0x00, 0xfd, 0xff, 0x00, 0x0a,
+  0xf2, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xde, 0x4c,  //@@@+
-  0x00, 0x00, 0x3e, 0xe6,  //...@
-  0x00, 0x00, 0x3e, 0xda,  //...@
-  0x00, 0xff, 0xf6, 0x4e,  //.@@+
-  0x00, 0x00, 0x42, 0xea,  //..+@
-  0xff, 0xff, 0xea, 0x7e,  //@@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0xff, 0xde, 0x4c, 0x00, 0x00, 0x3e, 0xe6, 0x00, 0x00, 0x3e, 0xda, 0x00,
+  0xff, 0xf6, 0x4e, 0x00, 0x00, 0x42, 0xea, 0xff, 0xff, 0xea, 0x7e, 0xf5, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x1e, 0xf8, 0x00,  //..@.
-  0x00, 0x9e, 0xff, 0x00,  //.%@.
-  0x26, 0xe8, 0xff, 0x00,  //.@@.
-  0xa8, 0x76, 0xff, 0x00,  //%+@.
-  0xfc, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0xff, 0x00,  //..@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x0f, 0x1e, 0xf8, 0x00, 0x00, 0x9e, 0xff, 0x00, 0x26, 0xe8, 0xff, 0x00, 0xa8, 0x76,
+  0xff, 0x00, 0xfc, 0xfe, 0xff, 0x02, 0x00, 0x00, 0xff, 0xf4, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xf0, 0xdc, 0x4a,  //@@@+
-  0x00, 0x02, 0x4c, 0xe4,  //..+@
-  0x00, 0x00, 0x42, 0xe4,  //..+@
-  0xff, 0xfc, 0xdc, 0x4a,  //@@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xf0, 0xdc, 0x4a, 0x00, 0x02, 0x4c, 0xe4, 0x00,
+  0x00, 0x42, 0xe4, 0xff, 0xfc, 0xdc, 0x4a, 0xf5, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1e, 0xbc, 0xf6, 0xff,  //.%@@
-  0xb2, 0xb2, 0x10, 0x00,  //%%..
-  0xee, 0x30, 0x00, 0x00,  //@...
-  0xf2, 0xa8, 0xf4, 0x88,  //@%@%
-  0xca, 0x3a, 0x36, 0xf2,  //@..@
-  0x42, 0xe0, 0xf0, 0x7e,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x1e, 0xbc, 0xf6, 0xff, 0xb2, 0xb2, 0x10, 0x00, 0xee, 0x30, 0x00, 0x00, 0xf2,
+  0xa8, 0xf4, 0x88, 0xca, 0x3a, 0x36, 0xf2, 0x42, 0xe0, 0xf0, 0x7e, 0xf5, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xea,  //@@@@
-  0x00, 0x00, 0x72, 0x98,  //..+%
-  0x00, 0x00, 0xca, 0x42,  //..@+
-  0x00, 0x22, 0xe6, 0x02,  //..@.
-  0x00, 0x7a, 0x94, 0x00,  //.+%.
-  0x00, 0xd2, 0x3e, 0x00,  //.@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfe, 0xff, 0x13, 0xea, 0x00, 0x00, 0x72, 0x98, 0x00, 0x00, 0xca, 0x42, 0x00, 0x22,
+  0xe6, 0x02, 0x00, 0x7a, 0x94, 0x00, 0x00, 0xd2, 0x3e, 0xf4, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xe8, 0x5e,  //+@@+
-  0xee, 0x30, 0x32, 0xec,  //@..@
-  0xd2, 0x2e, 0x30, 0xd2,  //@..@
-  0x50, 0xf6, 0xf6, 0x4e,  //+@@+
-  0xec, 0x3a, 0x3a, 0xec,  //@..@
-  0x88, 0xf0, 0xf0, 0x88,  //%@@%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x60, 0xea, 0xe8, 0x5e, 0xee, 0x30, 0x32, 0xec, 0xd2, 0x2e, 0x30, 0xd2, 0x50,
+  0xf6, 0xf6, 0x4e, 0xec, 0x3a, 0x3a, 0xec, 0x88, 0xf0, 0xf0, 0x88, 0xf5, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x80, 0xf0, 0xe0, 0x3e,  //%@@.
-  0xf2, 0x36, 0x3a, 0xc8,  //@..@
-  0x88, 0xf4, 0xa2, 0xf2,  //%@%@
-  0x00, 0x00, 0x30, 0xec,  //...@
-  0x00, 0x10, 0xb0, 0xb0,  //..%%
-  0xff, 0xf6, 0xbc, 0x1e,  //@@%.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x80, 0xf0, 0xe0, 0x3e, 0xf2, 0x36, 0x3a, 0xc8, 0x88, 0xf4, 0xa2, 0xf2, 0x00,
+  0x00, 0x30, 0xec, 0x00, 0x10, 0xb0, 0xb0, 0xff, 0xf6, 0xbc, 0x1e, 0xf5, 0x00,
 
   /*Unicode: U+003a (:) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+003b (;) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xfe, 0x00, 0x06, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x06, 0x5e, 0xb0,  //..+%
-  0x86, 0xa2, 0x50, 0x02,  //%%+.
-  0x86, 0xa2, 0x50, 0x04,  //%%+.
-  0x00, 0x06, 0x5e, 0xb2,  //..+%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf4, 0x00, 0x0e, 0x06, 0x5e, 0xb0, 0x86, 0xa2, 0x50, 0x02, 0x86, 0xa2, 0x50, 0x04, 0x00, 0x06,
+  0x5e, 0xb2, 0xf5, 0x00,
 
   /*Unicode: U+003d (=) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+003e (>) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xae, 0x5c, 0x06, 0x00,  //%+..
-  0x02, 0x50, 0xa0, 0x84,  //.+%%
-  0x04, 0x50, 0xa2, 0x86,  //.+%%
-  0xb2, 0x5e, 0x06, 0x00,  //%+..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0e, 0xae, 0x5c, 0x06, 0x00, 0x02, 0x50, 0xa0, 0x84, 0x04, 0x50, 0xa2, 0x86, 0xb2,
+  0x5e, 0x06, 0xf4, 0x00,
 
   /*Unicode: U+003f (?) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xce, 0x9c,  //@@%
-  0x00, 0xb4, 0xde,  //.%@
-  0x00, 0xf4, 0x22,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x0a, 0xff, 0xce, 0x9c, 0x00, 0xb4, 0xde, 0x00, 0xf4, 0x22, 0x00, 0xff, 0xfc, 0x00,
+  0x00, 0xff, 0xf7, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1c, 0xc0, 0xee, 0x5a,  //.@@+
-  0xb0, 0x72, 0x3a, 0xda,  //%+.@
-  0xee, 0x0c, 0xba, 0xfa,  //@.%@
-  0xee, 0x0e, 0xb8, 0xff,  //@.%@
-  0xb2, 0x84, 0x04, 0x00,  //%%..
-  0x22, 0xc6, 0xe8, 0x04,  //.@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf9, 0x00, 0x17, 0x1c, 0xc0, 0xee, 0x5a, 0xb0, 0x72, 0x3a, 0xda, 0xee, 0x0c, 0xba, 0xfa, 0xee,
+  0x0e, 0xb8, 0xff, 0xb2, 0x84, 0x04, 0x00, 0x22, 0xc6, 0xe8, 0x04, 0xf9, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x16, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee, 0x14, 0x56, 0xb0,
+  0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe6, 0x5e,  //@@@+
-  0xff, 0x00, 0x2a, 0xec,  //@..@
-  0xff, 0x00, 0x32, 0xde,  //@..@
-  0xff, 0xff, 0xfa, 0x64,  //@@@+
-  0xff, 0x00, 0x2e, 0xec,  //@..@
-  0xff, 0xff, 0xf0, 0x8e,  //@@@%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0xff, 0xe6, 0x5e, 0xff, 0x00, 0x2a, 0xec, 0xff, 0x00, 0x32, 0xde, 0xff,
+  0xff, 0xfa, 0x64, 0xff, 0x00, 0x2e, 0xec, 0xff, 0xff, 0xf0, 0x8e, 0xf5, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1c, 0xba, 0xf6, 0xff,  //.%@@
-  0xae, 0x82, 0x08, 0x00,  //%%..
-  0xee, 0x0e, 0x00, 0x00,  //@...
-  0xee, 0x0e, 0x00, 0x00,  //@...
-  0xb0, 0x82, 0x06, 0x00,  //%%..
-  0x1e, 0xbc, 0xf6, 0xff,  //.%@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x1c, 0xba, 0xf6, 0xff, 0xae, 0x82, 0x08, 0x00, 0xee, 0x0e, 0x00, 0x00, 0xee,
+  0x0e, 0x00, 0x00, 0xb0, 0x82, 0x06, 0x00, 0x1e, 0xbc, 0xf6, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xf6, 0xc2, 0x26,  //@@@.
-  0xff, 0x06, 0x72, 0xb8,  //@.+%
-  0xff, 0x00, 0x0a, 0xee,  //@..@
-  0xff, 0x00, 0x0a, 0xee,  //@..@
-  0xff, 0x06, 0x70, 0xba,  //@.+%
-  0xff, 0xf6, 0xc4, 0x28,  //@@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0xf6, 0xc2, 0x26, 0xff, 0x06, 0x72, 0xb8, 0xff, 0x00, 0x0a, 0xee, 0xff,
+  0x00, 0x0a, 0xee, 0xff, 0x06, 0x70, 0xba, 0xff, 0xf6, 0xc4, 0x28, 0xf5, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfd, 0xff,
+  0xf5, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff,
+  0xf2, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1c, 0xbc, 0xf6, 0xff,  //.%@@
-  0xae, 0x7e, 0x06, 0x00,  //%+..
-  0xee, 0x0e, 0x00, 0x00,  //@...
-  0xee, 0x0a, 0xff, 0xff,  //@.@@
-  0xb6, 0x68, 0x08, 0xff,  //%+.@
-  0x24, 0xc6, 0xee, 0x84,  //.@@%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x1c, 0xbc, 0xf6, 0xff, 0xae, 0x7e, 0x06, 0x00, 0xee, 0x0e, 0x00, 0x00, 0xee,
+  0x0a, 0xff, 0xff, 0xb6, 0x68, 0x08, 0xff, 0x24, 0xc6, 0xee, 0x84, 0xf5, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x0a, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfb, 0xff,
+  0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0xfe, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+  0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+004a (J) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x14, 0xf6,  //..@
-  0xff, 0xf8, 0x94,  //@@%
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfd, 0x00, 0x10, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x14,
+  0xf6, 0xff, 0xf8, 0x94, 0xf8, 0x00,
 
   /*Unicode: U+004b (K) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0x00, 0x1a, 0xb8, 0x14,  //@..%.
-  0xff, 0x12, 0xb8, 0x1c, 0x00,  //@.%..
-  0xff, 0xc8, 0x50, 0x00, 0x00,  //@@+..
-  0xff, 0x88, 0xca, 0x02, 0x00,  //@%@..
-  0xff, 0x00, 0xb8, 0x76, 0x00,  //@.%+.
-  0xff, 0x00, 0x1e, 0xea, 0x26,  //@..@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x1d, 0xff, 0x00, 0x1a, 0xb8, 0x14, 0xff, 0x12, 0xb8, 0x1c, 0x00, 0xff, 0xc8, 0x50,
+  0x00, 0x00, 0xff, 0x88, 0xca, 0x02, 0x00, 0xff, 0x00, 0xb8, 0x76, 0x00, 0xff, 0x00, 0x1e, 0xea,
+  0x26, 0xf2, 0x00,
 
   /*Unicode: U+004c (L) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+  0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+004d (M) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x5c, 0x5c, 0xff,  //@++@
-  0xff, 0x98, 0x9a, 0xff,  //@%%@
-  0xff, 0xd6, 0xd6, 0xff,  //@@@@
-  0xff, 0xee, 0xee, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0x5c, 0x5c, 0xff, 0xff, 0x98, 0x9a, 0xff, 0xff, 0xd6, 0xd6, 0xff, 0xff,
+  0xee, 0xee, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+004e (N) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x74, 0x00, 0xff,  //@+.@
-  0xff, 0xe6, 0x08, 0xff,  //@@.@
-  0xff, 0xb6, 0x6e, 0xff,  //@%+@
-  0xff, 0x4a, 0xe4, 0xff,  //@+@@
-  0xff, 0x00, 0xda, 0xff,  //@.@@
-  0xff, 0x00, 0x6e, 0xff,  //@.+@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0x74, 0x00, 0xff, 0xff, 0xe6, 0x08, 0xff, 0xff, 0xb6, 0x6e, 0xff, 0xff,
+  0x4a, 0xe4, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+004f (O) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06, 0xf2, 0xf2,
+  0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xea, 0x78,  //@@@+
-  0xff, 0x00, 0x40, 0xf0,  //@.+@
-  0xff, 0xff, 0xec, 0x7c,  //@@@+
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x0c, 0xff, 0xff, 0xea, 0x78, 0xff, 0x00, 0x40, 0xf0, 0xff, 0xff, 0xec, 0x7c, 0xff,
+  0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf2, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x40, 0xe2, 0xe2, 0x40,  //+@@+
-  0xca, 0x4e, 0x4e, 0xca,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf4,  //@..@
-  0xca, 0x4c, 0x4c, 0xbe,  //@++%
-  0x42, 0xe2, 0xf4, 0x2a,  //+@@.
-  0x00, 0x00, 0x74, 0x52,  //..++
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x1b, 0x40, 0xe2, 0xe2, 0x40, 0xca, 0x4e, 0x4e, 0xca, 0xf2, 0x06, 0x06, 0xf2, 0xf2,
+  0x06, 0x06, 0xf4, 0xca, 0x4c, 0x4c, 0xbe, 0x42, 0xe2, 0xf4, 0x2a, 0x00, 0x00, 0x74, 0x52, 0xf9,
+  0x00,
 
   /*Unicode: U+0052 (R) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xec, 0x7e, 0x00,  //@@@+.
-  0xff, 0x00, 0x36, 0xee, 0x00,  //@..@.
-  0xff, 0xff, 0xee, 0x42, 0x00,  //@@@+.
-  0xff, 0x18, 0xb8, 0x8a, 0x00,  //@.%%.
-  0xff, 0x00, 0x1c, 0xea, 0x1e,  //@..@.
-  0xff, 0x00, 0x00, 0x76, 0xb0,  //@..+%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x1d, 0xff, 0xff, 0xec, 0x7e, 0x00, 0xff, 0x00, 0x36, 0xee, 0x00, 0xff, 0xff, 0xee,
+  0x42, 0x00, 0xff, 0x18, 0xb8, 0x8a, 0x00, 0xff, 0x00, 0x1c, 0xea, 0x1e, 0xff, 0x00, 0x00, 0x76,
+  0xb0, 0xf2, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x58, 0xe0, 0xfc, 0xff,  //+@@@
-  0xee, 0x3a, 0x00, 0x00,  //@...
-  0xb6, 0xce, 0x7c, 0x14,  //%@+.
-  0x00, 0x3e, 0x98, 0xd0,  //..%@
-  0x00, 0x00, 0x34, 0xf0,  //...@
-  0xff, 0xff, 0xe8, 0x6c,  //@@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0x58, 0xe0, 0xfc, 0xff, 0xee, 0x3a, 0x00, 0x00, 0xb6, 0xce, 0x7c, 0x14, 0x00,
+  0x3e, 0x98, 0xd0, 0x00, 0x00, 0x34, 0xf0, 0xff, 0xff, 0xe8, 0x6c, 0xf5, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xf0, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xfc, 0x00, 0x00, 0xfc,  //@..@
-  0xe8, 0x2c, 0x30, 0xe8,  //@..@
-  0x5a, 0xe8, 0xe8, 0x5a,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc,
+  0x00, 0x00, 0xfc, 0xe8, 0x2c, 0x30, 0xe8, 0x5a, 0xe8, 0xe8, 0x5a, 0xf5, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xde, 0x2c, 0x2c, 0xdc,  //@..@
-  0x9a, 0x6e, 0x6e, 0x9a,  //%++%
-  0x58, 0xb0, 0xb0, 0x58,  //+%%+
-  0x16, 0xee, 0xee, 0x16,  //.@@.
-  0x00, 0xd2, 0xd2, 0x00,  //.@@.
-  0x00, 0x90, 0x90, 0x00,  //.%%.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x16, 0xde, 0x2c, 0x2c, 0xdc, 0x9a, 0x6e, 0x6e, 0x9a, 0x58, 0xb0, 0xb0, 0x58, 0x16,
+  0xee, 0xee, 0x16, 0x00, 0xd2, 0xd2, 0x00, 0x00, 0x90, 0x90, 0xf4, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xec, 0x16, 0x00, 0x16, 0xea,  //@...@
-  0xc4, 0x3c, 0x00, 0x3c, 0xc4,  //@...@
-  0x9e, 0xdc, 0xf8, 0xdc, 0x9e,  //%@@@%
-  0x78, 0xff, 0x9a, 0xff, 0x76,  //+@%@+
-  0x50, 0xfa, 0x1e, 0xfc, 0x50,  //+@.@+
-  0x2a, 0xca, 0x00, 0xca, 0x2a,  //.@.@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x1d, 0xec, 0x16, 0x00, 0x16, 0xea, 0xc4, 0x3c, 0x00, 0x3c, 0xc4, 0x9e, 0xdc, 0xf8,
+  0xdc, 0x9e, 0x78, 0xff, 0x9a, 0xff, 0x76, 0x50, 0xfa, 0x1e, 0xfc, 0x50, 0x2a, 0xca, 0x00, 0xca,
+  0x2a, 0xf2, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xb8, 0x6a, 0x70, 0xb4,  //%++%
-  0x2c, 0xe6, 0xe8, 0x26,  //.@@.
-  0x00, 0x9e, 0x92, 0x00,  //.%%.
-  0x00, 0xc0, 0xb6, 0x00,  //.@%.
-  0x40, 0xd8, 0xdc, 0x38,  //+@@.
-  0xbe, 0x5c, 0x60, 0xbc,  //%++%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xb8, 0x6a, 0x70, 0xb4, 0x2c, 0xe6, 0xe8, 0x26, 0x00, 0x9e, 0x92, 0x00, 0x00,
+  0xc0, 0xb6, 0x00, 0x40, 0xd8, 0xdc, 0x38, 0xbe, 0x5c, 0x60, 0xbc, 0xf5, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xb2, 0x74, 0x00, 0x74, 0xb0,  //%+.+%
-  0x20, 0xea, 0x3a, 0xea, 0x1e,  //.@.@.
-  0x00, 0x7c, 0xf8, 0x7c, 0x00,  //.+@+.
-  0x00, 0x06, 0xff, 0x06, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x12, 0xb2, 0x74, 0x00, 0x74, 0xb0, 0x20, 0xea, 0x3a, 0xea, 0x1e, 0x00, 0x7c, 0xf8,
+  0x7c, 0x00, 0x00, 0x06, 0xff, 0x06, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xf0, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xf0,  //@@@@
-  0x00, 0x00, 0xae, 0x78,  //..%+
-  0x00, 0x46, 0xde, 0x06,  //.+@.
-  0x04, 0xd6, 0x56, 0x00,  //.@+.
-  0x74, 0xc6, 0x00, 0x00,  //+@..
-  0xf0, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfe, 0xff, 0x11, 0xf0, 0x00, 0x00, 0xae, 0x78, 0x00, 0x46, 0xde, 0x06, 0x04, 0xd6,
+  0x56, 0x00, 0x74, 0xc6, 0x00, 0x00, 0xf0, 0xfe, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+005b ([) , Width: 2 */
-  0xff, 0xff,  //@@
-  0xff, 0x00,  //@.
-  0xff, 0x00,  //@.
-  0xff, 0x00,  //@.
-  0xff, 0x00,  //@.
-  0xff, 0x00,  //@.
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xfe, 0xff, 0x0a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xfb, 0x00,
 
   /*Unicode: U+005c (\) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xc8, 0x34, 0x00, 0x00,  //@...
-  0x5a, 0xa2, 0x00, 0x00,  //+%..
-  0x04, 0xe0, 0x16, 0x00,  //.@..
-  0x00, 0x7e, 0x7e, 0x00,  //.++.
-  0x00, 0x18, 0xe0, 0x04,  //..@.
-  0x00, 0x00, 0xa4, 0x5a,  //..%+
-  0x00, 0x00, 0x36, 0xc8,  //...@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x1b, 0xc8, 0x34, 0x00, 0x00, 0x5a, 0xa2, 0x00, 0x00, 0x04, 0xe0, 0x16, 0x00, 0x00,
+  0x7e, 0x7e, 0x00, 0x00, 0x18, 0xe0, 0x04, 0x00, 0x00, 0xa4, 0x5a, 0x00, 0x00, 0x36, 0xc8, 0xf9,
+  0x00,
 
   /*Unicode: U+005d (]) , Width: 2 */
-  0xff, 0xff,  //@@
-  0x00, 0xff,  //.@
-  0x00, 0xff,  //.@
-  0x00, 0xff,  //.@
-  0x00, 0xff,  //.@
-  0x00, 0xff,  //.@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x0a, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0xff, 0xfb, 0x00,
 
   /*Unicode: U+005e (^) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x02, 0xa4, 0xa4, 0x02,  //.%%.
-  0x84, 0x2e, 0x30, 0x84,  //%..%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x07, 0x02, 0xa4, 0xa4, 0x02, 0x84, 0x2e, 0x30, 0x84, 0xe5, 0x00,
 
   /*Unicode: U+005f (_) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xd9, 0x00, 0xfc, 0xff, 0xfc, 0x00,
 
   /*Unicode: U+0060 (`) , Width: 2 */
-  0x00, 0x00,  //..
-  0x5a, 0x5e,  //++
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x03, 0x00, 0x00, 0x5a, 0x5e, 0xf1, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea, 0xff, 0xfa, 0xf2, 0x38, 0x3c, 0xff, 0x94,
+  0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 4 */
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x9c, 0xee, 0x64,  //@%@+
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x9a, 0xee, 0x64,  //@%@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0x9c, 0xee,
+  0x64, 0xff, 0x2e, 0x2e, 0xea, 0xff, 0x2e, 0x2e, 0xea, 0xff, 0x9a, 0xee, 0x64, 0xf5, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x60, 0xec, 0xff,  //+@@
-  0xea, 0x34, 0x00,  //@..
-  0xea, 0x34, 0x00,  //@..
-  0x60, 0xec, 0xff,  //+@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xf8, 0x00, 0x0b, 0x60, 0xec, 0xff, 0xea, 0x34, 0x00, 0xea, 0x34, 0x00, 0x60, 0xec, 0xff, 0xf8,
+  0x00,
 
   /*Unicode: U+0064 (d) , Width: 4 */
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x66, 0xee, 0x9a, 0xff,  //+@%@
-  0xec, 0x2e, 0x30, 0xff,  //@..@
-  0xea, 0x2e, 0x30, 0xff,  //@..@
-  0x66, 0xee, 0x9a, 0xff,  //+@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x10, 0xff, 0x66, 0xee, 0x9a, 0xff,
+  0xec, 0x2e, 0x30, 0xff, 0xea, 0x2e, 0x30, 0xff, 0x66, 0xee, 0x9a, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x4e, 0xe0, 0xf2, 0x86,  //+@@%
-  0xe6, 0xff, 0xff, 0xfa,  //@@@@
-  0xe4, 0x3c, 0x00, 0x00,  //@...
-  0x4a, 0xda, 0xfc, 0xff,  //+@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x4e, 0xe0, 0xf2, 0x86, 0xe6, 0xff, 0xff, 0xfa, 0xe4, 0x3c, 0x00, 0x00, 0x4a,
+  0xda, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 4 */
-  0x00, 0x5e, 0xec, 0xff,  //.+@@
-  0x00, 0xe0, 0x2e, 0x00,  //.@..
-  0x00, 0xfc, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x0b, 0x00, 0x5e, 0xec, 0xff, 0x00, 0xe0, 0x2e, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfd, 0xff, 0x01,
+  0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf3, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x64, 0xee, 0xa2, 0xff,  //+@%@
-  0xea, 0x32, 0x30, 0xff,  //@..@
-  0xea, 0x30, 0x2e, 0xff,  //@..@
-  0x64, 0xf0, 0xa4, 0xfa,  //+@%@
-  0x00, 0x00, 0x4e, 0xce,  //..+@
-  0xff, 0xfc, 0xd4, 0x38,  //@@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x17, 0x64, 0xee, 0xa2, 0xff, 0xea, 0x32, 0x30, 0xff, 0xea, 0x30, 0x2e, 0xff, 0x64,
+  0xf0, 0xa4, 0xfa, 0x00, 0x00, 0x4e, 0xce, 0xff, 0xfc, 0xd4, 0x38, 0xfd, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 4 */
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x8c, 0xf4, 0x88,  //@%@%
-  0xff, 0x38, 0x2a, 0xf2,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0x8c, 0xf4,
+  0x88, 0xff, 0x38, 0x2a, 0xf2, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 3 */
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x01, 0x00, 0xff, 0xfa, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xfe,
+  0xff, 0xf8, 0x00,
 
   /*Unicode: U+006a (j) , Width: 3 */
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x00, 0xff,  //..@
-  0x00, 0x1a, 0xf4,  //..@
-  0xff, 0xf8, 0x86,  //@@%
-  0x00, 0x00, 0x00,  //...
-
+  0x02, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x10, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0x1a, 0xf4, 0xff, 0xf8, 0x86, 0xfe, 0x00,
 
   /*Unicode: U+006b (k) , Width: 5 */
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@....
-  0xff, 0x06, 0xa8, 0xc0, 0x10,  //@.%@.
-  0xff, 0xc0, 0xac, 0x06, 0x00,  //@@%..
-  0xff, 0xc4, 0xc6, 0x04, 0x00,  //@@@..
-  0xff, 0x00, 0xa8, 0x98, 0x00,  //@.%%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x12, 0xff, 0x06, 0xa8,
+  0xc0, 0x10, 0xff, 0xc0, 0xac, 0x06, 0x00, 0xff, 0xc4, 0xc6, 0x04, 0x00, 0xff, 0x00, 0xa8, 0x98,
+  0xf1, 0x00,
 
   /*Unicode: U+006c (l) , Width: 4 */
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xec, 0x30, 0x00,  //.@..
-  0x00, 0x6a, 0xf0, 0xff,  //.+@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe,
+  0x00, 0x00, 0xff, 0xfe, 0x00, 0x06, 0xec, 0x30, 0x00, 0x00, 0x6a, 0xf0, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+006d (m) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xc2, 0x9a, 0xd4, 0xa8,  //@@%@%
-  0xff, 0x28, 0xff, 0x28, 0xf4,  //@.@.@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@.@.@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0x13, 0xff, 0xc2, 0x9a, 0xd4, 0xa8, 0xff, 0x28, 0xff, 0x28, 0xf4, 0xff, 0x00, 0xff,
+  0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf2, 0x00,
 
   /*Unicode: U+006e (n) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x8c, 0xf4, 0x88,  //@%@%
-  0xff, 0x38, 0x2a, 0xf2,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0xff, 0x8c, 0xf4, 0x88, 0xff, 0x38, 0x2a, 0xf2, 0xff, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+006f (o) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e, 0x2e, 0xea, 0xea, 0x2e, 0x2e, 0xea, 0x60,
+  0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x9a, 0xee, 0x64,  //@%@+
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x9a, 0xee, 0x64,  //@%@+
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x10, 0xff, 0x9a, 0xee, 0x64, 0xff, 0x2e, 0x2e, 0xea, 0xff, 0x2e, 0x2e, 0xea, 0xff,
+  0x9a, 0xee, 0x64, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x66, 0xee, 0x9a, 0xff,  //+@%@
-  0xea, 0x2e, 0x30, 0xff,  //@..@
-  0xec, 0x2e, 0x30, 0xff,  //@..@
-  0x68, 0xee, 0x9a, 0xff,  //+@%@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x66, 0xee, 0x9a, 0xff, 0xea, 0x2e, 0x30, 0xff, 0xec, 0x2e, 0x30, 0xff, 0x68,
+  0xee, 0x9a, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xa2, 0xff,  //@%@
-  0xff, 0x3e, 0x00,  //@..
-  0xff, 0x00, 0x00,  //@..
-  0xff, 0x00, 0x00,  //@..
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xf8, 0x00, 0x09, 0xff, 0xa2, 0xff, 0xff, 0x3e, 0x00, 0xff, 0x00, 0x00, 0xff, 0xf6, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x90, 0xec, 0xff, 0xff,  //%@@@
-  0xcc, 0xde, 0xae, 0x44,  //@@%+
-  0x00, 0x26, 0x6e, 0xee,  //..+@
-  0xff, 0xff, 0xec, 0x8c,  //@@@%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x90, 0xec, 0xff, 0xff, 0xcc, 0xde, 0xae, 0x44, 0x00, 0x26, 0x6e, 0xee, 0xff,
+  0xff, 0xec, 0x8c, 0xf5, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0x00, 0xf8, 0x18, 0x00,  //.@..
-  0x00, 0x94, 0xf4, 0xff,  //.%@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf8, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x00, 0x06, 0xf8, 0x18,
+  0x00, 0x00, 0x94, 0xf4, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xf2, 0x2a, 0x38, 0xff,  //@..@
-  0x88, 0xf4, 0x8c, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf2, 0x2a, 0x38, 0xff, 0x88,
+  0xf4, 0x8c, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xcc, 0x40, 0x40, 0xcc,  //@++@
-  0x6a, 0xa4, 0xa4, 0x6a,  //+%%+
-  0x0e, 0xee, 0xee, 0x0e,  //.@@.
-  0x00, 0xa4, 0xa4, 0x00,  //.%%.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0e, 0xcc, 0x40, 0x40, 0xcc, 0x6a, 0xa4, 0xa4, 0x6a, 0x0e, 0xee, 0xee, 0x0e, 0x00,
+  0xa4, 0xa4, 0xf4, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xdc, 0x2c, 0x00, 0x2c, 0xdc,  //@...@
-  0x98, 0x76, 0xe2, 0x74, 0x98,  //%+@+%
-  0x54, 0xe8, 0xff, 0xe8, 0x54,  //+@@@+
-  0x12, 0xfc, 0xe6, 0xfc, 0x12,  //.@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0x13, 0xdc, 0x2c, 0x00, 0x2c, 0xdc, 0x98, 0x76, 0xe2, 0x74, 0x98, 0x54, 0xe8, 0xff,
+  0xe8, 0x54, 0x12, 0xfc, 0xe6, 0xfc, 0x12, 0xf2, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x94, 0xb2, 0xb2, 0x94,  //%%%%
-  0x02, 0xbc, 0xbc, 0x02,  //.%%.
-  0x08, 0xce, 0xce, 0x06,  //.@@.
-  0x9c, 0xa2, 0xa2, 0x9c,  //%%%%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x94, 0xb2, 0xb2, 0x94, 0x02, 0xbc, 0xbc, 0x02, 0x08, 0xce, 0xce, 0x06, 0x9c,
+  0xa2, 0xa2, 0x9c, 0xf5, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xd0, 0x3e, 0x52, 0xc4,  //@.+@
-  0x72, 0x9c, 0xc2, 0x52,  //+%@+
-  0x16, 0xf4, 0xde, 0x02,  //.@@.
-  0x00, 0xbe, 0x7c, 0x00,  //.%+.
-  0x18, 0xec, 0x1c, 0x00,  //.@..
-  0xfa, 0x8c, 0x00, 0x00,  //@%..
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x15, 0xd0, 0x3e, 0x52, 0xc4, 0x72, 0x9c, 0xc2, 0x52, 0x16, 0xf4, 0xde, 0x02, 0x00,
+  0xbe, 0x7c, 0x00, 0x18, 0xec, 0x1c, 0x00, 0xfa, 0x8c, 0xfb, 0x00,
 
   /*Unicode: U+007a (z) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xe0,  //@@@@
-  0x00, 0x96, 0xe4, 0x22,  //.%@.
-  0x4c, 0xe6, 0x26, 0x00,  //+@..
-  0xe8, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0xfe, 0xff, 0x09, 0xe0, 0x00, 0x96, 0xe4, 0x22, 0x4c, 0xe6, 0x26, 0x00, 0xe8, 0xfe,
+  0xff, 0xf5, 0x00,
 
   /*Unicode: U+007b ({) , Width: 3 */
-  0x00, 0xa2, 0xf6,  //.%@
-  0x00, 0xf8, 0x0e,  //.@.
-  0x14, 0xf6, 0x00,  //.@.
-  0xff, 0x8c, 0x00,  //@%.
-  0x2c, 0xf4, 0x00,  //.@.
-  0x00, 0xf8, 0x0e,  //.@.
-  0x00, 0xa4, 0xf8,  //.%@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x14, 0x00, 0xa2, 0xf6, 0x00, 0xf8, 0x0e, 0x14, 0xf6, 0x00, 0xff, 0x8c, 0x00, 0x2c, 0xf4, 0x00,
+  0x00, 0xf8, 0x0e, 0x00, 0xa4, 0xf8, 0xf8, 0x00,
 
   /*Unicode: U+007c (|) , Width: 1 */
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0xf9, 0xff, 0x01, 0x00, 0x00,
 
   /*Unicode: U+007d (}) , Width: 3 */
-  0xf6, 0xa2, 0x00,  //@%.
-  0x10, 0xf8, 0x00,  //.@.
-  0x00, 0xf6, 0x14,  //.@.
-  0x00, 0x8c, 0xff,  //.%@
-  0x00, 0xf4, 0x2c,  //.@.
-  0x0e, 0xf8, 0x00,  //.@.
-  0xf8, 0xa4, 0x00,  //@%.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x13, 0xf6, 0xa2, 0x00, 0x10, 0xf8, 0x00, 0x00, 0xf6, 0x14, 0x00, 0x8c, 0xff, 0x00, 0xf4, 0x2c,
+  0x0e, 0xf8, 0x00, 0xf8, 0xa4, 0xf7, 0x00,
 
   /*Unicode: U+007e (~) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
-
+  0xf1, 0x00, 0xfd, 0xff, 0xed, 0x00,
 
 #endif
 };
@@ -4967,391 +1306,391 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_glyph_dsc[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO == 1
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 1,	.glyph_index = 10},	/*Unicode: U+0021 (!)*/
-  {.w_px = 3,	.glyph_index = 20},	/*Unicode: U+0022 (")*/
-  {.w_px = 5,	.glyph_index = 30},	/*Unicode: U+0023 (#)*/
-  {.w_px = 5,	.glyph_index = 40},	/*Unicode: U+0024 ($)*/
-  {.w_px = 5,	.glyph_index = 50},	/*Unicode: U+0025 (%)*/
-  {.w_px = 4,	.glyph_index = 60},	/*Unicode: U+0026 (&)*/
-  {.w_px = 1,	.glyph_index = 70},	/*Unicode: U+0027 (')*/
-  {.w_px = 2,	.glyph_index = 80},	/*Unicode: U+0028 (()*/
-  {.w_px = 2,	.glyph_index = 90},	/*Unicode: U+0029 ())*/
-  {.w_px = 5,	.glyph_index = 100},	/*Unicode: U+002a (*)*/
-  {.w_px = 5,	.glyph_index = 110},	/*Unicode: U+002b (+)*/
-  {.w_px = 1,	.glyph_index = 120},	/*Unicode: U+002c (,)*/
-  {.w_px = 2,	.glyph_index = 130},	/*Unicode: U+002d (-)*/
-  {.w_px = 1,	.glyph_index = 140},	/*Unicode: U+002e (.)*/
-  {.w_px = 4,	.glyph_index = 150},	/*Unicode: U+002f (/)*/
-  {.w_px = 4,	.glyph_index = 160},	/*Unicode: U+0030 (0)*/
-  {.w_px = 3,	.glyph_index = 170},	/*Unicode: U+0031 (1)*/
-  {.w_px = 5,	.glyph_index = 180},	/*Unicode: U+0032 (2)*/
-  {.w_px = 4,	.glyph_index = 190},	/*Unicode: U+0033 (3)*/
-  {.w_px = 4,	.glyph_index = 200},	/*Unicode: U+0034 (4)*/
-  {.w_px = 4,	.glyph_index = 210},	/*Unicode: U+0035 (5)*/
-  {.w_px = 4,	.glyph_index = 220},	/*Unicode: U+0036 (6)*/
-  {.w_px = 4,	.glyph_index = 230},	/*Unicode: U+0037 (7)*/
-  {.w_px = 4,	.glyph_index = 240},	/*Unicode: U+0038 (8)*/
-  {.w_px = 4,	.glyph_index = 250},	/*Unicode: U+0039 (9)*/
-  {.w_px = 1,	.glyph_index = 260},	/*Unicode: U+003a (:)*/
-  {.w_px = 1,	.glyph_index = 270},	/*Unicode: U+003b (;)*/
-  {.w_px = 4,	.glyph_index = 280},	/*Unicode: U+003c (<)*/
-  {.w_px = 4,	.glyph_index = 290},	/*Unicode: U+003d (=)*/
-  {.w_px = 4,	.glyph_index = 300},	/*Unicode: U+003e (>)*/
-  {.w_px = 3,	.glyph_index = 310},	/*Unicode: U+003f (?)*/
-  {.w_px = 4,	.glyph_index = 320},	/*Unicode: U+0040 (@)*/
-  {.w_px = 4,	.glyph_index = 330},	/*Unicode: U+0041 (A)*/
-  {.w_px = 4,	.glyph_index = 340},	/*Unicode: U+0042 (B)*/
-  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+0043 (C)*/
-  {.w_px = 4,	.glyph_index = 360},	/*Unicode: U+0044 (D)*/
-  {.w_px = 4,	.glyph_index = 370},	/*Unicode: U+0045 (E)*/
-  {.w_px = 4,	.glyph_index = 380},	/*Unicode: U+0046 (F)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+0047 (G)*/
-  {.w_px = 4,	.glyph_index = 400},	/*Unicode: U+0048 (H)*/
-  {.w_px = 3,	.glyph_index = 410},	/*Unicode: U+0049 (I)*/
-  {.w_px = 3,	.glyph_index = 420},	/*Unicode: U+004a (J)*/
-  {.w_px = 5,	.glyph_index = 430},	/*Unicode: U+004b (K)*/
-  {.w_px = 4,	.glyph_index = 440},	/*Unicode: U+004c (L)*/
-  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+004d (M)*/
-  {.w_px = 4,	.glyph_index = 460},	/*Unicode: U+004e (N)*/
-  {.w_px = 4,	.glyph_index = 470},	/*Unicode: U+004f (O)*/
-  {.w_px = 4,	.glyph_index = 480},	/*Unicode: U+0050 (P)*/
-  {.w_px = 4,	.glyph_index = 490},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 5,	.glyph_index = 500},	/*Unicode: U+0052 (R)*/
-  {.w_px = 4,	.glyph_index = 510},	/*Unicode: U+0053 (S)*/
-  {.w_px = 5,	.glyph_index = 520},	/*Unicode: U+0054 (T)*/
-  {.w_px = 4,	.glyph_index = 530},	/*Unicode: U+0055 (U)*/
-  {.w_px = 4,	.glyph_index = 540},	/*Unicode: U+0056 (V)*/
-  {.w_px = 5,	.glyph_index = 550},	/*Unicode: U+0057 (W)*/
-  {.w_px = 4,	.glyph_index = 560},	/*Unicode: U+0058 (X)*/
-  {.w_px = 5,	.glyph_index = 570},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 4,	.glyph_index = 580},	/*Unicode: U+005a (Z)*/
-  {.w_px = 2,	.glyph_index = 590},	/*Unicode: U+005b ([)*/
-  {.w_px = 4,	.glyph_index = 600},	/*Unicode: U+005c (\)*/
-  {.w_px = 2,	.glyph_index = 610},	/*Unicode: U+005d (])*/
-  {.w_px = 4,	.glyph_index = 620},	/*Unicode: U+005e (^)*/
-  {.w_px = 5,	.glyph_index = 630},	/*Unicode: U+005f (_)*/
-  {.w_px = 2,	.glyph_index = 640},	/*Unicode: U+0060 (`)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+0061 (a)*/
-  {.w_px = 4,	.glyph_index = 660},	/*Unicode: U+0062 (b)*/
-  {.w_px = 3,	.glyph_index = 670},	/*Unicode: U+0063 (c)*/
-  {.w_px = 4,	.glyph_index = 680},	/*Unicode: U+0064 (d)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+0065 (e)*/
-  {.w_px = 4,	.glyph_index = 700},	/*Unicode: U+0066 (f)*/
-  {.w_px = 4,	.glyph_index = 710},	/*Unicode: U+0067 (g)*/
-  {.w_px = 4,	.glyph_index = 720},	/*Unicode: U+0068 (h)*/
-  {.w_px = 3,	.glyph_index = 730},	/*Unicode: U+0069 (i)*/
-  {.w_px = 3,	.glyph_index = 740},	/*Unicode: U+006a (j)*/
-  {.w_px = 5,	.glyph_index = 750},	/*Unicode: U+006b (k)*/
-  {.w_px = 4,	.glyph_index = 760},	/*Unicode: U+006c (l)*/
-  {.w_px = 5,	.glyph_index = 770},	/*Unicode: U+006d (m)*/
-  {.w_px = 4,	.glyph_index = 780},	/*Unicode: U+006e (n)*/
-  {.w_px = 4,	.glyph_index = 790},	/*Unicode: U+006f (o)*/
-  {.w_px = 4,	.glyph_index = 800},	/*Unicode: U+0070 (p)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+0071 (q)*/
-  {.w_px = 3,	.glyph_index = 820},	/*Unicode: U+0072 (r)*/
-  {.w_px = 4,	.glyph_index = 830},	/*Unicode: U+0073 (s)*/
-  {.w_px = 4,	.glyph_index = 840},	/*Unicode: U+0074 (t)*/
-  {.w_px = 4,	.glyph_index = 850},	/*Unicode: U+0075 (u)*/
-  {.w_px = 4,	.glyph_index = 860},	/*Unicode: U+0076 (v)*/
-  {.w_px = 5,	.glyph_index = 870},	/*Unicode: U+0077 (w)*/
-  {.w_px = 4,	.glyph_index = 880},	/*Unicode: U+0078 (x)*/
-  {.w_px = 4,	.glyph_index = 890},	/*Unicode: U+0079 (y)*/
-  {.w_px = 4,	.glyph_index = 900},	/*Unicode: U+007a (z)*/
-  {.w_px = 3,	.glyph_index = 910},	/*Unicode: U+007b ({)*/
-  {.w_px = 1,	.glyph_index = 920},	/*Unicode: U+007c (|)*/
-  {.w_px = 3,	.glyph_index = 930},	/*Unicode: U+007d (})*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+007e (~)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 3,	.glyph_index = 11},	/*Unicode: U+0022 (")*/
+  {.w_px = 5,	.glyph_index = 17},	/*Unicode: U+0023 (#)*/
+  {.w_px = 5,	.glyph_index = 27},	/*Unicode: U+0024 ($)*/
+  {.w_px = 5,	.glyph_index = 38},	/*Unicode: U+0025 (%)*/
+  {.w_px = 4,	.glyph_index = 48},	/*Unicode: U+0026 (&)*/
+  {.w_px = 1,	.glyph_index = 58},	/*Unicode: U+0027 (')*/
+  {.w_px = 2,	.glyph_index = 64},	/*Unicode: U+0028 (()*/
+  {.w_px = 2,	.glyph_index = 72},	/*Unicode: U+0029 ())*/
+  {.w_px = 5,	.glyph_index = 80},	/*Unicode: U+002a (*)*/
+  {.w_px = 5,	.glyph_index = 88},	/*Unicode: U+002b (+)*/
+  {.w_px = 1,	.glyph_index = 98},	/*Unicode: U+002c (,)*/
+  {.w_px = 2,	.glyph_index = 105},	/*Unicode: U+002d (-)*/
+  {.w_px = 1,	.glyph_index = 111},	/*Unicode: U+002e (.)*/
+  {.w_px = 4,	.glyph_index = 117},	/*Unicode: U+002f (/)*/
+  {.w_px = 4,	.glyph_index = 128},	/*Unicode: U+0030 (0)*/
+  {.w_px = 3,	.glyph_index = 138},	/*Unicode: U+0031 (1)*/
+  {.w_px = 5,	.glyph_index = 147},	/*Unicode: U+0032 (2)*/
+  {.w_px = 4,	.glyph_index = 157},	/*Unicode: U+0033 (3)*/
+  {.w_px = 4,	.glyph_index = 167},	/*Unicode: U+0034 (4)*/
+  {.w_px = 4,	.glyph_index = 177},	/*Unicode: U+0035 (5)*/
+  {.w_px = 4,	.glyph_index = 187},	/*Unicode: U+0036 (6)*/
+  {.w_px = 4,	.glyph_index = 197},	/*Unicode: U+0037 (7)*/
+  {.w_px = 4,	.glyph_index = 207},	/*Unicode: U+0038 (8)*/
+  {.w_px = 4,	.glyph_index = 217},	/*Unicode: U+0039 (9)*/
+  {.w_px = 1,	.glyph_index = 227},	/*Unicode: U+003a (:)*/
+  {.w_px = 1,	.glyph_index = 236},	/*Unicode: U+003b (;)*/
+  {.w_px = 4,	.glyph_index = 246},	/*Unicode: U+003c (<)*/
+  {.w_px = 4,	.glyph_index = 255},	/*Unicode: U+003d (=)*/
+  {.w_px = 4,	.glyph_index = 263},	/*Unicode: U+003e (>)*/
+  {.w_px = 3,	.glyph_index = 272},	/*Unicode: U+003f (?)*/
+  {.w_px = 4,	.glyph_index = 282},	/*Unicode: U+0040 (@)*/
+  {.w_px = 4,	.glyph_index = 293},	/*Unicode: U+0041 (A)*/
+  {.w_px = 4,	.glyph_index = 302},	/*Unicode: U+0042 (B)*/
+  {.w_px = 4,	.glyph_index = 312},	/*Unicode: U+0043 (C)*/
+  {.w_px = 4,	.glyph_index = 322},	/*Unicode: U+0044 (D)*/
+  {.w_px = 4,	.glyph_index = 331},	/*Unicode: U+0045 (E)*/
+  {.w_px = 4,	.glyph_index = 341},	/*Unicode: U+0046 (F)*/
+  {.w_px = 4,	.glyph_index = 351},	/*Unicode: U+0047 (G)*/
+  {.w_px = 4,	.glyph_index = 361},	/*Unicode: U+0048 (H)*/
+  {.w_px = 3,	.glyph_index = 371},	/*Unicode: U+0049 (I)*/
+  {.w_px = 3,	.glyph_index = 380},	/*Unicode: U+004a (J)*/
+  {.w_px = 5,	.glyph_index = 389},	/*Unicode: U+004b (K)*/
+  {.w_px = 4,	.glyph_index = 399},	/*Unicode: U+004c (L)*/
+  {.w_px = 4,	.glyph_index = 407},	/*Unicode: U+004d (M)*/
+  {.w_px = 4,	.glyph_index = 417},	/*Unicode: U+004e (N)*/
+  {.w_px = 4,	.glyph_index = 427},	/*Unicode: U+004f (O)*/
+  {.w_px = 4,	.glyph_index = 436},	/*Unicode: U+0050 (P)*/
+  {.w_px = 4,	.glyph_index = 445},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 5,	.glyph_index = 454},	/*Unicode: U+0052 (R)*/
+  {.w_px = 4,	.glyph_index = 464},	/*Unicode: U+0053 (S)*/
+  {.w_px = 5,	.glyph_index = 474},	/*Unicode: U+0054 (T)*/
+  {.w_px = 4,	.glyph_index = 481},	/*Unicode: U+0055 (U)*/
+  {.w_px = 4,	.glyph_index = 489},	/*Unicode: U+0056 (V)*/
+  {.w_px = 5,	.glyph_index = 497},	/*Unicode: U+0057 (W)*/
+  {.w_px = 4,	.glyph_index = 507},	/*Unicode: U+0058 (X)*/
+  {.w_px = 5,	.glyph_index = 516},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 4,	.glyph_index = 524},	/*Unicode: U+005a (Z)*/
+  {.w_px = 2,	.glyph_index = 534},	/*Unicode: U+005b ([)*/
+  {.w_px = 4,	.glyph_index = 542},	/*Unicode: U+005c (\)*/
+  {.w_px = 2,	.glyph_index = 553},	/*Unicode: U+005d (])*/
+  {.w_px = 4,	.glyph_index = 561},	/*Unicode: U+005e (^)*/
+  {.w_px = 5,	.glyph_index = 567},	/*Unicode: U+005f (_)*/
+  {.w_px = 2,	.glyph_index = 572},	/*Unicode: U+0060 (`)*/
+  {.w_px = 4,	.glyph_index = 574},	/*Unicode: U+0061 (a)*/
+  {.w_px = 4,	.glyph_index = 583},	/*Unicode: U+0062 (b)*/
+  {.w_px = 3,	.glyph_index = 592},	/*Unicode: U+0063 (c)*/
+  {.w_px = 4,	.glyph_index = 601},	/*Unicode: U+0064 (d)*/
+  {.w_px = 4,	.glyph_index = 610},	/*Unicode: U+0065 (e)*/
+  {.w_px = 4,	.glyph_index = 619},	/*Unicode: U+0066 (f)*/
+  {.w_px = 4,	.glyph_index = 628},	/*Unicode: U+0067 (g)*/
+  {.w_px = 4,	.glyph_index = 638},	/*Unicode: U+0068 (h)*/
+  {.w_px = 3,	.glyph_index = 646},	/*Unicode: U+0069 (i)*/
+  {.w_px = 3,	.glyph_index = 656},	/*Unicode: U+006a (j)*/
+  {.w_px = 5,	.glyph_index = 666},	/*Unicode: U+006b (k)*/
+  {.w_px = 4,	.glyph_index = 675},	/*Unicode: U+006c (l)*/
+  {.w_px = 5,	.glyph_index = 683},	/*Unicode: U+006d (m)*/
+  {.w_px = 4,	.glyph_index = 691},	/*Unicode: U+006e (n)*/
+  {.w_px = 4,	.glyph_index = 699},	/*Unicode: U+006f (o)*/
+  {.w_px = 4,	.glyph_index = 708},	/*Unicode: U+0070 (p)*/
+  {.w_px = 4,	.glyph_index = 718},	/*Unicode: U+0071 (q)*/
+  {.w_px = 3,	.glyph_index = 728},	/*Unicode: U+0072 (r)*/
+  {.w_px = 4,	.glyph_index = 736},	/*Unicode: U+0073 (s)*/
+  {.w_px = 4,	.glyph_index = 745},	/*Unicode: U+0074 (t)*/
+  {.w_px = 4,	.glyph_index = 755},	/*Unicode: U+0075 (u)*/
+  {.w_px = 4,	.glyph_index = 763},	/*Unicode: U+0076 (v)*/
+  {.w_px = 5,	.glyph_index = 771},	/*Unicode: U+0077 (w)*/
+  {.w_px = 4,	.glyph_index = 780},	/*Unicode: U+0078 (x)*/
+  {.w_px = 4,	.glyph_index = 789},	/*Unicode: U+0079 (y)*/
+  {.w_px = 4,	.glyph_index = 799},	/*Unicode: U+007a (z)*/
+  {.w_px = 3,	.glyph_index = 808},	/*Unicode: U+007b ({)*/
+  {.w_px = 1,	.glyph_index = 818},	/*Unicode: U+007c (|)*/
+  {.w_px = 3,	.glyph_index = 823},	/*Unicode: U+007d (})*/
+  {.w_px = 4,	.glyph_index = 833},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 2
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 1,	.glyph_index = 10},	/*Unicode: U+0021 (!)*/
-  {.w_px = 3,	.glyph_index = 20},	/*Unicode: U+0022 (")*/
-  {.w_px = 5,	.glyph_index = 30},	/*Unicode: U+0023 (#)*/
-  {.w_px = 5,	.glyph_index = 50},	/*Unicode: U+0024 ($)*/
-  {.w_px = 5,	.glyph_index = 70},	/*Unicode: U+0025 (%)*/
-  {.w_px = 4,	.glyph_index = 90},	/*Unicode: U+0026 (&)*/
-  {.w_px = 1,	.glyph_index = 100},	/*Unicode: U+0027 (')*/
-  {.w_px = 2,	.glyph_index = 110},	/*Unicode: U+0028 (()*/
-  {.w_px = 2,	.glyph_index = 120},	/*Unicode: U+0029 ())*/
-  {.w_px = 5,	.glyph_index = 130},	/*Unicode: U+002a (*)*/
-  {.w_px = 5,	.glyph_index = 150},	/*Unicode: U+002b (+)*/
-  {.w_px = 1,	.glyph_index = 170},	/*Unicode: U+002c (,)*/
-  {.w_px = 2,	.glyph_index = 180},	/*Unicode: U+002d (-)*/
-  {.w_px = 1,	.glyph_index = 190},	/*Unicode: U+002e (.)*/
-  {.w_px = 4,	.glyph_index = 200},	/*Unicode: U+002f (/)*/
-  {.w_px = 4,	.glyph_index = 210},	/*Unicode: U+0030 (0)*/
-  {.w_px = 3,	.glyph_index = 220},	/*Unicode: U+0031 (1)*/
-  {.w_px = 5,	.glyph_index = 230},	/*Unicode: U+0032 (2)*/
-  {.w_px = 4,	.glyph_index = 250},	/*Unicode: U+0033 (3)*/
-  {.w_px = 4,	.glyph_index = 260},	/*Unicode: U+0034 (4)*/
-  {.w_px = 4,	.glyph_index = 270},	/*Unicode: U+0035 (5)*/
-  {.w_px = 4,	.glyph_index = 280},	/*Unicode: U+0036 (6)*/
-  {.w_px = 4,	.glyph_index = 290},	/*Unicode: U+0037 (7)*/
-  {.w_px = 4,	.glyph_index = 300},	/*Unicode: U+0038 (8)*/
-  {.w_px = 4,	.glyph_index = 310},	/*Unicode: U+0039 (9)*/
-  {.w_px = 1,	.glyph_index = 320},	/*Unicode: U+003a (:)*/
-  {.w_px = 1,	.glyph_index = 330},	/*Unicode: U+003b (;)*/
-  {.w_px = 4,	.glyph_index = 340},	/*Unicode: U+003c (<)*/
-  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+003d (=)*/
-  {.w_px = 4,	.glyph_index = 360},	/*Unicode: U+003e (>)*/
-  {.w_px = 3,	.glyph_index = 370},	/*Unicode: U+003f (?)*/
-  {.w_px = 4,	.glyph_index = 380},	/*Unicode: U+0040 (@)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+0041 (A)*/
-  {.w_px = 4,	.glyph_index = 400},	/*Unicode: U+0042 (B)*/
-  {.w_px = 4,	.glyph_index = 410},	/*Unicode: U+0043 (C)*/
-  {.w_px = 4,	.glyph_index = 420},	/*Unicode: U+0044 (D)*/
-  {.w_px = 4,	.glyph_index = 430},	/*Unicode: U+0045 (E)*/
-  {.w_px = 4,	.glyph_index = 440},	/*Unicode: U+0046 (F)*/
-  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+0047 (G)*/
-  {.w_px = 4,	.glyph_index = 460},	/*Unicode: U+0048 (H)*/
-  {.w_px = 3,	.glyph_index = 470},	/*Unicode: U+0049 (I)*/
-  {.w_px = 3,	.glyph_index = 480},	/*Unicode: U+004a (J)*/
-  {.w_px = 5,	.glyph_index = 490},	/*Unicode: U+004b (K)*/
-  {.w_px = 4,	.glyph_index = 510},	/*Unicode: U+004c (L)*/
-  {.w_px = 4,	.glyph_index = 520},	/*Unicode: U+004d (M)*/
-  {.w_px = 4,	.glyph_index = 530},	/*Unicode: U+004e (N)*/
-  {.w_px = 4,	.glyph_index = 540},	/*Unicode: U+004f (O)*/
-  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+0050 (P)*/
-  {.w_px = 4,	.glyph_index = 560},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 5,	.glyph_index = 570},	/*Unicode: U+0052 (R)*/
-  {.w_px = 4,	.glyph_index = 590},	/*Unicode: U+0053 (S)*/
-  {.w_px = 5,	.glyph_index = 600},	/*Unicode: U+0054 (T)*/
-  {.w_px = 4,	.glyph_index = 620},	/*Unicode: U+0055 (U)*/
-  {.w_px = 4,	.glyph_index = 630},	/*Unicode: U+0056 (V)*/
-  {.w_px = 5,	.glyph_index = 640},	/*Unicode: U+0057 (W)*/
-  {.w_px = 4,	.glyph_index = 660},	/*Unicode: U+0058 (X)*/
-  {.w_px = 5,	.glyph_index = 670},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+005a (Z)*/
-  {.w_px = 2,	.glyph_index = 700},	/*Unicode: U+005b ([)*/
-  {.w_px = 4,	.glyph_index = 710},	/*Unicode: U+005c (\)*/
-  {.w_px = 2,	.glyph_index = 720},	/*Unicode: U+005d (])*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+005e (^)*/
-  {.w_px = 5,	.glyph_index = 740},	/*Unicode: U+005f (_)*/
-  {.w_px = 2,	.glyph_index = 760},	/*Unicode: U+0060 (`)*/
-  {.w_px = 4,	.glyph_index = 770},	/*Unicode: U+0061 (a)*/
-  {.w_px = 4,	.glyph_index = 780},	/*Unicode: U+0062 (b)*/
-  {.w_px = 3,	.glyph_index = 790},	/*Unicode: U+0063 (c)*/
-  {.w_px = 4,	.glyph_index = 800},	/*Unicode: U+0064 (d)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+0065 (e)*/
-  {.w_px = 4,	.glyph_index = 820},	/*Unicode: U+0066 (f)*/
-  {.w_px = 4,	.glyph_index = 830},	/*Unicode: U+0067 (g)*/
-  {.w_px = 4,	.glyph_index = 840},	/*Unicode: U+0068 (h)*/
-  {.w_px = 3,	.glyph_index = 850},	/*Unicode: U+0069 (i)*/
-  {.w_px = 3,	.glyph_index = 860},	/*Unicode: U+006a (j)*/
-  {.w_px = 5,	.glyph_index = 870},	/*Unicode: U+006b (k)*/
-  {.w_px = 4,	.glyph_index = 890},	/*Unicode: U+006c (l)*/
-  {.w_px = 5,	.glyph_index = 900},	/*Unicode: U+006d (m)*/
-  {.w_px = 4,	.glyph_index = 920},	/*Unicode: U+006e (n)*/
-  {.w_px = 4,	.glyph_index = 930},	/*Unicode: U+006f (o)*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+0070 (p)*/
-  {.w_px = 4,	.glyph_index = 950},	/*Unicode: U+0071 (q)*/
-  {.w_px = 3,	.glyph_index = 960},	/*Unicode: U+0072 (r)*/
-  {.w_px = 4,	.glyph_index = 970},	/*Unicode: U+0073 (s)*/
-  {.w_px = 4,	.glyph_index = 980},	/*Unicode: U+0074 (t)*/
-  {.w_px = 4,	.glyph_index = 990},	/*Unicode: U+0075 (u)*/
-  {.w_px = 4,	.glyph_index = 1000},	/*Unicode: U+0076 (v)*/
-  {.w_px = 5,	.glyph_index = 1010},	/*Unicode: U+0077 (w)*/
-  {.w_px = 4,	.glyph_index = 1030},	/*Unicode: U+0078 (x)*/
-  {.w_px = 4,	.glyph_index = 1040},	/*Unicode: U+0079 (y)*/
-  {.w_px = 4,	.glyph_index = 1050},	/*Unicode: U+007a (z)*/
-  {.w_px = 3,	.glyph_index = 1060},	/*Unicode: U+007b ({)*/
-  {.w_px = 1,	.glyph_index = 1070},	/*Unicode: U+007c (|)*/
-  {.w_px = 3,	.glyph_index = 1080},	/*Unicode: U+007d (})*/
-  {.w_px = 4,	.glyph_index = 1090},	/*Unicode: U+007e (~)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 3,	.glyph_index = 11},	/*Unicode: U+0022 (")*/
+  {.w_px = 5,	.glyph_index = 17},	/*Unicode: U+0023 (#)*/
+  {.w_px = 5,	.glyph_index = 33},	/*Unicode: U+0024 ($)*/
+  {.w_px = 5,	.glyph_index = 51},	/*Unicode: U+0025 (%)*/
+  {.w_px = 4,	.glyph_index = 68},	/*Unicode: U+0026 (&)*/
+  {.w_px = 1,	.glyph_index = 78},	/*Unicode: U+0027 (')*/
+  {.w_px = 2,	.glyph_index = 84},	/*Unicode: U+0028 (()*/
+  {.w_px = 2,	.glyph_index = 94},	/*Unicode: U+0029 ())*/
+  {.w_px = 5,	.glyph_index = 104},	/*Unicode: U+002a (*)*/
+  {.w_px = 5,	.glyph_index = 117},	/*Unicode: U+002b (+)*/
+  {.w_px = 1,	.glyph_index = 131},	/*Unicode: U+002c (,)*/
+  {.w_px = 2,	.glyph_index = 138},	/*Unicode: U+002d (-)*/
+  {.w_px = 1,	.glyph_index = 144},	/*Unicode: U+002e (.)*/
+  {.w_px = 4,	.glyph_index = 150},	/*Unicode: U+002f (/)*/
+  {.w_px = 4,	.glyph_index = 161},	/*Unicode: U+0030 (0)*/
+  {.w_px = 3,	.glyph_index = 171},	/*Unicode: U+0031 (1)*/
+  {.w_px = 5,	.glyph_index = 180},	/*Unicode: U+0032 (2)*/
+  {.w_px = 4,	.glyph_index = 196},	/*Unicode: U+0033 (3)*/
+  {.w_px = 4,	.glyph_index = 206},	/*Unicode: U+0034 (4)*/
+  {.w_px = 4,	.glyph_index = 216},	/*Unicode: U+0035 (5)*/
+  {.w_px = 4,	.glyph_index = 226},	/*Unicode: U+0036 (6)*/
+  {.w_px = 4,	.glyph_index = 236},	/*Unicode: U+0037 (7)*/
+  {.w_px = 4,	.glyph_index = 246},	/*Unicode: U+0038 (8)*/
+  {.w_px = 4,	.glyph_index = 256},	/*Unicode: U+0039 (9)*/
+  {.w_px = 1,	.glyph_index = 266},	/*Unicode: U+003a (:)*/
+  {.w_px = 1,	.glyph_index = 275},	/*Unicode: U+003b (;)*/
+  {.w_px = 4,	.glyph_index = 285},	/*Unicode: U+003c (<)*/
+  {.w_px = 4,	.glyph_index = 294},	/*Unicode: U+003d (=)*/
+  {.w_px = 4,	.glyph_index = 302},	/*Unicode: U+003e (>)*/
+  {.w_px = 3,	.glyph_index = 311},	/*Unicode: U+003f (?)*/
+  {.w_px = 4,	.glyph_index = 321},	/*Unicode: U+0040 (@)*/
+  {.w_px = 4,	.glyph_index = 332},	/*Unicode: U+0041 (A)*/
+  {.w_px = 4,	.glyph_index = 342},	/*Unicode: U+0042 (B)*/
+  {.w_px = 4,	.glyph_index = 352},	/*Unicode: U+0043 (C)*/
+  {.w_px = 4,	.glyph_index = 362},	/*Unicode: U+0044 (D)*/
+  {.w_px = 4,	.glyph_index = 372},	/*Unicode: U+0045 (E)*/
+  {.w_px = 4,	.glyph_index = 382},	/*Unicode: U+0046 (F)*/
+  {.w_px = 4,	.glyph_index = 392},	/*Unicode: U+0047 (G)*/
+  {.w_px = 4,	.glyph_index = 402},	/*Unicode: U+0048 (H)*/
+  {.w_px = 3,	.glyph_index = 412},	/*Unicode: U+0049 (I)*/
+  {.w_px = 3,	.glyph_index = 421},	/*Unicode: U+004a (J)*/
+  {.w_px = 5,	.glyph_index = 430},	/*Unicode: U+004b (K)*/
+  {.w_px = 4,	.glyph_index = 446},	/*Unicode: U+004c (L)*/
+  {.w_px = 4,	.glyph_index = 454},	/*Unicode: U+004d (M)*/
+  {.w_px = 4,	.glyph_index = 464},	/*Unicode: U+004e (N)*/
+  {.w_px = 4,	.glyph_index = 474},	/*Unicode: U+004f (O)*/
+  {.w_px = 4,	.glyph_index = 484},	/*Unicode: U+0050 (P)*/
+  {.w_px = 4,	.glyph_index = 493},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 5,	.glyph_index = 504},	/*Unicode: U+0052 (R)*/
+  {.w_px = 4,	.glyph_index = 521},	/*Unicode: U+0053 (S)*/
+  {.w_px = 5,	.glyph_index = 531},	/*Unicode: U+0054 (T)*/
+  {.w_px = 4,	.glyph_index = 547},	/*Unicode: U+0055 (U)*/
+  {.w_px = 4,	.glyph_index = 555},	/*Unicode: U+0056 (V)*/
+  {.w_px = 5,	.glyph_index = 565},	/*Unicode: U+0057 (W)*/
+  {.w_px = 4,	.glyph_index = 580},	/*Unicode: U+0058 (X)*/
+  {.w_px = 5,	.glyph_index = 590},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 4,	.glyph_index = 606},	/*Unicode: U+005a (Z)*/
+  {.w_px = 2,	.glyph_index = 616},	/*Unicode: U+005b ([)*/
+  {.w_px = 4,	.glyph_index = 624},	/*Unicode: U+005c (\)*/
+  {.w_px = 2,	.glyph_index = 635},	/*Unicode: U+005d (])*/
+  {.w_px = 4,	.glyph_index = 643},	/*Unicode: U+005e (^)*/
+  {.w_px = 5,	.glyph_index = 649},	/*Unicode: U+005f (_)*/
+  {.w_px = 2,	.glyph_index = 656},	/*Unicode: U+0060 (`)*/
+  {.w_px = 4,	.glyph_index = 661},	/*Unicode: U+0061 (a)*/
+  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+0062 (b)*/
+  {.w_px = 3,	.glyph_index = 679},	/*Unicode: U+0063 (c)*/
+  {.w_px = 4,	.glyph_index = 688},	/*Unicode: U+0064 (d)*/
+  {.w_px = 4,	.glyph_index = 697},	/*Unicode: U+0065 (e)*/
+  {.w_px = 4,	.glyph_index = 706},	/*Unicode: U+0066 (f)*/
+  {.w_px = 4,	.glyph_index = 715},	/*Unicode: U+0067 (g)*/
+  {.w_px = 4,	.glyph_index = 725},	/*Unicode: U+0068 (h)*/
+  {.w_px = 3,	.glyph_index = 733},	/*Unicode: U+0069 (i)*/
+  {.w_px = 3,	.glyph_index = 743},	/*Unicode: U+006a (j)*/
+  {.w_px = 5,	.glyph_index = 753},	/*Unicode: U+006b (k)*/
+  {.w_px = 4,	.glyph_index = 769},	/*Unicode: U+006c (l)*/
+  {.w_px = 5,	.glyph_index = 777},	/*Unicode: U+006d (m)*/
+  {.w_px = 4,	.glyph_index = 790},	/*Unicode: U+006e (n)*/
+  {.w_px = 4,	.glyph_index = 798},	/*Unicode: U+006f (o)*/
+  {.w_px = 4,	.glyph_index = 807},	/*Unicode: U+0070 (p)*/
+  {.w_px = 4,	.glyph_index = 817},	/*Unicode: U+0071 (q)*/
+  {.w_px = 3,	.glyph_index = 827},	/*Unicode: U+0072 (r)*/
+  {.w_px = 4,	.glyph_index = 835},	/*Unicode: U+0073 (s)*/
+  {.w_px = 4,	.glyph_index = 844},	/*Unicode: U+0074 (t)*/
+  {.w_px = 4,	.glyph_index = 854},	/*Unicode: U+0075 (u)*/
+  {.w_px = 4,	.glyph_index = 862},	/*Unicode: U+0076 (v)*/
+  {.w_px = 5,	.glyph_index = 871},	/*Unicode: U+0077 (w)*/
+  {.w_px = 4,	.glyph_index = 883},	/*Unicode: U+0078 (x)*/
+  {.w_px = 4,	.glyph_index = 892},	/*Unicode: U+0079 (y)*/
+  {.w_px = 4,	.glyph_index = 902},	/*Unicode: U+007a (z)*/
+  {.w_px = 3,	.glyph_index = 911},	/*Unicode: U+007b ({)*/
+  {.w_px = 1,	.glyph_index = 921},	/*Unicode: U+007c (|)*/
+  {.w_px = 3,	.glyph_index = 926},	/*Unicode: U+007d (})*/
+  {.w_px = 4,	.glyph_index = 936},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 4
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 1,	.glyph_index = 20},	/*Unicode: U+0021 (!)*/
-  {.w_px = 3,	.glyph_index = 30},	/*Unicode: U+0022 (")*/
-  {.w_px = 5,	.glyph_index = 50},	/*Unicode: U+0023 (#)*/
-  {.w_px = 5,	.glyph_index = 80},	/*Unicode: U+0024 ($)*/
-  {.w_px = 5,	.glyph_index = 110},	/*Unicode: U+0025 (%)*/
-  {.w_px = 4,	.glyph_index = 140},	/*Unicode: U+0026 (&)*/
-  {.w_px = 1,	.glyph_index = 160},	/*Unicode: U+0027 (')*/
-  {.w_px = 2,	.glyph_index = 170},	/*Unicode: U+0028 (()*/
-  {.w_px = 2,	.glyph_index = 180},	/*Unicode: U+0029 ())*/
-  {.w_px = 5,	.glyph_index = 190},	/*Unicode: U+002a (*)*/
-  {.w_px = 5,	.glyph_index = 220},	/*Unicode: U+002b (+)*/
-  {.w_px = 1,	.glyph_index = 250},	/*Unicode: U+002c (,)*/
-  {.w_px = 2,	.glyph_index = 260},	/*Unicode: U+002d (-)*/
-  {.w_px = 1,	.glyph_index = 270},	/*Unicode: U+002e (.)*/
-  {.w_px = 4,	.glyph_index = 280},	/*Unicode: U+002f (/)*/
-  {.w_px = 4,	.glyph_index = 300},	/*Unicode: U+0030 (0)*/
-  {.w_px = 3,	.glyph_index = 320},	/*Unicode: U+0031 (1)*/
-  {.w_px = 5,	.glyph_index = 340},	/*Unicode: U+0032 (2)*/
-  {.w_px = 4,	.glyph_index = 370},	/*Unicode: U+0033 (3)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+0034 (4)*/
-  {.w_px = 4,	.glyph_index = 410},	/*Unicode: U+0035 (5)*/
-  {.w_px = 4,	.glyph_index = 430},	/*Unicode: U+0036 (6)*/
-  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+0037 (7)*/
-  {.w_px = 4,	.glyph_index = 470},	/*Unicode: U+0038 (8)*/
-  {.w_px = 4,	.glyph_index = 490},	/*Unicode: U+0039 (9)*/
-  {.w_px = 1,	.glyph_index = 510},	/*Unicode: U+003a (:)*/
-  {.w_px = 1,	.glyph_index = 520},	/*Unicode: U+003b (;)*/
-  {.w_px = 4,	.glyph_index = 530},	/*Unicode: U+003c (<)*/
-  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+003d (=)*/
-  {.w_px = 4,	.glyph_index = 570},	/*Unicode: U+003e (>)*/
-  {.w_px = 3,	.glyph_index = 590},	/*Unicode: U+003f (?)*/
-  {.w_px = 4,	.glyph_index = 610},	/*Unicode: U+0040 (@)*/
-  {.w_px = 4,	.glyph_index = 630},	/*Unicode: U+0041 (A)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+0042 (B)*/
-  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+0043 (C)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+0044 (D)*/
-  {.w_px = 4,	.glyph_index = 710},	/*Unicode: U+0045 (E)*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+0046 (F)*/
-  {.w_px = 4,	.glyph_index = 750},	/*Unicode: U+0047 (G)*/
-  {.w_px = 4,	.glyph_index = 770},	/*Unicode: U+0048 (H)*/
-  {.w_px = 3,	.glyph_index = 790},	/*Unicode: U+0049 (I)*/
-  {.w_px = 3,	.glyph_index = 810},	/*Unicode: U+004a (J)*/
-  {.w_px = 5,	.glyph_index = 830},	/*Unicode: U+004b (K)*/
-  {.w_px = 4,	.glyph_index = 860},	/*Unicode: U+004c (L)*/
-  {.w_px = 4,	.glyph_index = 880},	/*Unicode: U+004d (M)*/
-  {.w_px = 4,	.glyph_index = 900},	/*Unicode: U+004e (N)*/
-  {.w_px = 4,	.glyph_index = 920},	/*Unicode: U+004f (O)*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+0050 (P)*/
-  {.w_px = 4,	.glyph_index = 960},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 5,	.glyph_index = 980},	/*Unicode: U+0052 (R)*/
-  {.w_px = 4,	.glyph_index = 1010},	/*Unicode: U+0053 (S)*/
-  {.w_px = 5,	.glyph_index = 1030},	/*Unicode: U+0054 (T)*/
-  {.w_px = 4,	.glyph_index = 1060},	/*Unicode: U+0055 (U)*/
-  {.w_px = 4,	.glyph_index = 1080},	/*Unicode: U+0056 (V)*/
-  {.w_px = 5,	.glyph_index = 1100},	/*Unicode: U+0057 (W)*/
-  {.w_px = 4,	.glyph_index = 1130},	/*Unicode: U+0058 (X)*/
-  {.w_px = 5,	.glyph_index = 1150},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 4,	.glyph_index = 1180},	/*Unicode: U+005a (Z)*/
-  {.w_px = 2,	.glyph_index = 1200},	/*Unicode: U+005b ([)*/
-  {.w_px = 4,	.glyph_index = 1210},	/*Unicode: U+005c (\)*/
-  {.w_px = 2,	.glyph_index = 1230},	/*Unicode: U+005d (])*/
-  {.w_px = 4,	.glyph_index = 1240},	/*Unicode: U+005e (^)*/
-  {.w_px = 5,	.glyph_index = 1260},	/*Unicode: U+005f (_)*/
-  {.w_px = 2,	.glyph_index = 1290},	/*Unicode: U+0060 (`)*/
-  {.w_px = 4,	.glyph_index = 1300},	/*Unicode: U+0061 (a)*/
-  {.w_px = 4,	.glyph_index = 1320},	/*Unicode: U+0062 (b)*/
-  {.w_px = 3,	.glyph_index = 1340},	/*Unicode: U+0063 (c)*/
-  {.w_px = 4,	.glyph_index = 1360},	/*Unicode: U+0064 (d)*/
-  {.w_px = 4,	.glyph_index = 1380},	/*Unicode: U+0065 (e)*/
-  {.w_px = 4,	.glyph_index = 1400},	/*Unicode: U+0066 (f)*/
-  {.w_px = 4,	.glyph_index = 1420},	/*Unicode: U+0067 (g)*/
-  {.w_px = 4,	.glyph_index = 1440},	/*Unicode: U+0068 (h)*/
-  {.w_px = 3,	.glyph_index = 1460},	/*Unicode: U+0069 (i)*/
-  {.w_px = 3,	.glyph_index = 1480},	/*Unicode: U+006a (j)*/
-  {.w_px = 5,	.glyph_index = 1500},	/*Unicode: U+006b (k)*/
-  {.w_px = 4,	.glyph_index = 1530},	/*Unicode: U+006c (l)*/
-  {.w_px = 5,	.glyph_index = 1550},	/*Unicode: U+006d (m)*/
-  {.w_px = 4,	.glyph_index = 1580},	/*Unicode: U+006e (n)*/
-  {.w_px = 4,	.glyph_index = 1600},	/*Unicode: U+006f (o)*/
-  {.w_px = 4,	.glyph_index = 1620},	/*Unicode: U+0070 (p)*/
-  {.w_px = 4,	.glyph_index = 1640},	/*Unicode: U+0071 (q)*/
-  {.w_px = 3,	.glyph_index = 1660},	/*Unicode: U+0072 (r)*/
-  {.w_px = 4,	.glyph_index = 1680},	/*Unicode: U+0073 (s)*/
-  {.w_px = 4,	.glyph_index = 1700},	/*Unicode: U+0074 (t)*/
-  {.w_px = 4,	.glyph_index = 1720},	/*Unicode: U+0075 (u)*/
-  {.w_px = 4,	.glyph_index = 1740},	/*Unicode: U+0076 (v)*/
-  {.w_px = 5,	.glyph_index = 1760},	/*Unicode: U+0077 (w)*/
-  {.w_px = 4,	.glyph_index = 1790},	/*Unicode: U+0078 (x)*/
-  {.w_px = 4,	.glyph_index = 1810},	/*Unicode: U+0079 (y)*/
-  {.w_px = 4,	.glyph_index = 1830},	/*Unicode: U+007a (z)*/
-  {.w_px = 3,	.glyph_index = 1850},	/*Unicode: U+007b ({)*/
-  {.w_px = 1,	.glyph_index = 1870},	/*Unicode: U+007c (|)*/
-  {.w_px = 3,	.glyph_index = 1880},	/*Unicode: U+007d (})*/
-  {.w_px = 4,	.glyph_index = 1900},	/*Unicode: U+007e (~)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 3,	.glyph_index = 12},	/*Unicode: U+0022 (")*/
+  {.w_px = 5,	.glyph_index = 19},	/*Unicode: U+0023 (#)*/
+  {.w_px = 5,	.glyph_index = 42},	/*Unicode: U+0024 ($)*/
+  {.w_px = 5,	.glyph_index = 66},	/*Unicode: U+0025 (%)*/
+  {.w_px = 4,	.glyph_index = 89},	/*Unicode: U+0026 (&)*/
+  {.w_px = 1,	.glyph_index = 106},	/*Unicode: U+0027 (')*/
+  {.w_px = 2,	.glyph_index = 112},	/*Unicode: U+0028 (()*/
+  {.w_px = 2,	.glyph_index = 122},	/*Unicode: U+0029 ())*/
+  {.w_px = 5,	.glyph_index = 132},	/*Unicode: U+002a (*)*/
+  {.w_px = 5,	.glyph_index = 149},	/*Unicode: U+002b (+)*/
+  {.w_px = 1,	.glyph_index = 167},	/*Unicode: U+002c (,)*/
+  {.w_px = 2,	.glyph_index = 174},	/*Unicode: U+002d (-)*/
+  {.w_px = 1,	.glyph_index = 180},	/*Unicode: U+002e (.)*/
+  {.w_px = 4,	.glyph_index = 186},	/*Unicode: U+002f (/)*/
+  {.w_px = 4,	.glyph_index = 203},	/*Unicode: U+0030 (0)*/
+  {.w_px = 3,	.glyph_index = 220},	/*Unicode: U+0031 (1)*/
+  {.w_px = 5,	.glyph_index = 237},	/*Unicode: U+0032 (2)*/
+  {.w_px = 4,	.glyph_index = 259},	/*Unicode: U+0033 (3)*/
+  {.w_px = 4,	.glyph_index = 276},	/*Unicode: U+0034 (4)*/
+  {.w_px = 4,	.glyph_index = 293},	/*Unicode: U+0035 (5)*/
+  {.w_px = 4,	.glyph_index = 310},	/*Unicode: U+0036 (6)*/
+  {.w_px = 4,	.glyph_index = 327},	/*Unicode: U+0037 (7)*/
+  {.w_px = 4,	.glyph_index = 344},	/*Unicode: U+0038 (8)*/
+  {.w_px = 4,	.glyph_index = 361},	/*Unicode: U+0039 (9)*/
+  {.w_px = 1,	.glyph_index = 378},	/*Unicode: U+003a (:)*/
+  {.w_px = 1,	.glyph_index = 387},	/*Unicode: U+003b (;)*/
+  {.w_px = 4,	.glyph_index = 397},	/*Unicode: U+003c (<)*/
+  {.w_px = 4,	.glyph_index = 409},	/*Unicode: U+003d (=)*/
+  {.w_px = 4,	.glyph_index = 420},	/*Unicode: U+003e (>)*/
+  {.w_px = 3,	.glyph_index = 432},	/*Unicode: U+003f (?)*/
+  {.w_px = 4,	.glyph_index = 448},	/*Unicode: U+0040 (@)*/
+  {.w_px = 4,	.glyph_index = 465},	/*Unicode: U+0041 (A)*/
+  {.w_px = 4,	.glyph_index = 482},	/*Unicode: U+0042 (B)*/
+  {.w_px = 4,	.glyph_index = 499},	/*Unicode: U+0043 (C)*/
+  {.w_px = 4,	.glyph_index = 516},	/*Unicode: U+0044 (D)*/
+  {.w_px = 4,	.glyph_index = 533},	/*Unicode: U+0045 (E)*/
+  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+0046 (F)*/
+  {.w_px = 4,	.glyph_index = 566},	/*Unicode: U+0047 (G)*/
+  {.w_px = 4,	.glyph_index = 583},	/*Unicode: U+0048 (H)*/
+  {.w_px = 3,	.glyph_index = 600},	/*Unicode: U+0049 (I)*/
+  {.w_px = 3,	.glyph_index = 617},	/*Unicode: U+004a (J)*/
+  {.w_px = 5,	.glyph_index = 634},	/*Unicode: U+004b (K)*/
+  {.w_px = 4,	.glyph_index = 657},	/*Unicode: U+004c (L)*/
+  {.w_px = 4,	.glyph_index = 674},	/*Unicode: U+004d (M)*/
+  {.w_px = 4,	.glyph_index = 691},	/*Unicode: U+004e (N)*/
+  {.w_px = 4,	.glyph_index = 708},	/*Unicode: U+004f (O)*/
+  {.w_px = 4,	.glyph_index = 725},	/*Unicode: U+0050 (P)*/
+  {.w_px = 4,	.glyph_index = 741},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 5,	.glyph_index = 760},	/*Unicode: U+0052 (R)*/
+  {.w_px = 4,	.glyph_index = 783},	/*Unicode: U+0053 (S)*/
+  {.w_px = 5,	.glyph_index = 800},	/*Unicode: U+0054 (T)*/
+  {.w_px = 4,	.glyph_index = 822},	/*Unicode: U+0055 (U)*/
+  {.w_px = 4,	.glyph_index = 839},	/*Unicode: U+0056 (V)*/
+  {.w_px = 5,	.glyph_index = 856},	/*Unicode: U+0057 (W)*/
+  {.w_px = 4,	.glyph_index = 879},	/*Unicode: U+0058 (X)*/
+  {.w_px = 5,	.glyph_index = 896},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 4,	.glyph_index = 918},	/*Unicode: U+005a (Z)*/
+  {.w_px = 2,	.glyph_index = 935},	/*Unicode: U+005b ([)*/
+  {.w_px = 4,	.glyph_index = 943},	/*Unicode: U+005c (\)*/
+  {.w_px = 2,	.glyph_index = 962},	/*Unicode: U+005d (])*/
+  {.w_px = 4,	.glyph_index = 970},	/*Unicode: U+005e (^)*/
+  {.w_px = 5,	.glyph_index = 979},	/*Unicode: U+005f (_)*/
+  {.w_px = 2,	.glyph_index = 987},	/*Unicode: U+0060 (`)*/
+  {.w_px = 4,	.glyph_index = 992},	/*Unicode: U+0061 (a)*/
+  {.w_px = 4,	.glyph_index = 1005},	/*Unicode: U+0062 (b)*/
+  {.w_px = 3,	.glyph_index = 1022},	/*Unicode: U+0063 (c)*/
+  {.w_px = 4,	.glyph_index = 1035},	/*Unicode: U+0064 (d)*/
+  {.w_px = 4,	.glyph_index = 1052},	/*Unicode: U+0065 (e)*/
+  {.w_px = 4,	.glyph_index = 1065},	/*Unicode: U+0066 (f)*/
+  {.w_px = 4,	.glyph_index = 1081},	/*Unicode: U+0067 (g)*/
+  {.w_px = 4,	.glyph_index = 1098},	/*Unicode: U+0068 (h)*/
+  {.w_px = 3,	.glyph_index = 1115},	/*Unicode: U+0069 (i)*/
+  {.w_px = 3,	.glyph_index = 1130},	/*Unicode: U+006a (j)*/
+  {.w_px = 5,	.glyph_index = 1150},	/*Unicode: U+006b (k)*/
+  {.w_px = 4,	.glyph_index = 1173},	/*Unicode: U+006c (l)*/
+  {.w_px = 5,	.glyph_index = 1190},	/*Unicode: U+006d (m)*/
+  {.w_px = 4,	.glyph_index = 1202},	/*Unicode: U+006e (n)*/
+  {.w_px = 4,	.glyph_index = 1215},	/*Unicode: U+006f (o)*/
+  {.w_px = 4,	.glyph_index = 1228},	/*Unicode: U+0070 (p)*/
+  {.w_px = 4,	.glyph_index = 1244},	/*Unicode: U+0071 (q)*/
+  {.w_px = 3,	.glyph_index = 1261},	/*Unicode: U+0072 (r)*/
+  {.w_px = 4,	.glyph_index = 1273},	/*Unicode: U+0073 (s)*/
+  {.w_px = 4,	.glyph_index = 1286},	/*Unicode: U+0074 (t)*/
+  {.w_px = 4,	.glyph_index = 1301},	/*Unicode: U+0075 (u)*/
+  {.w_px = 4,	.glyph_index = 1314},	/*Unicode: U+0076 (v)*/
+  {.w_px = 5,	.glyph_index = 1327},	/*Unicode: U+0077 (w)*/
+  {.w_px = 4,	.glyph_index = 1344},	/*Unicode: U+0078 (x)*/
+  {.w_px = 4,	.glyph_index = 1357},	/*Unicode: U+0079 (y)*/
+  {.w_px = 4,	.glyph_index = 1373},	/*Unicode: U+007a (z)*/
+  {.w_px = 3,	.glyph_index = 1386},	/*Unicode: U+007b ({)*/
+  {.w_px = 1,	.glyph_index = 1403},	/*Unicode: U+007c (|)*/
+  {.w_px = 3,	.glyph_index = 1408},	/*Unicode: U+007d (})*/
+  {.w_px = 4,	.glyph_index = 1424},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO == 8
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 1,	.glyph_index = 30},	/*Unicode: U+0021 (!)*/
-  {.w_px = 3,	.glyph_index = 40},	/*Unicode: U+0022 (")*/
-  {.w_px = 5,	.glyph_index = 70},	/*Unicode: U+0023 (#)*/
-  {.w_px = 5,	.glyph_index = 120},	/*Unicode: U+0024 ($)*/
-  {.w_px = 5,	.glyph_index = 170},	/*Unicode: U+0025 (%)*/
-  {.w_px = 4,	.glyph_index = 220},	/*Unicode: U+0026 (&)*/
-  {.w_px = 1,	.glyph_index = 260},	/*Unicode: U+0027 (')*/
-  {.w_px = 2,	.glyph_index = 270},	/*Unicode: U+0028 (()*/
-  {.w_px = 2,	.glyph_index = 290},	/*Unicode: U+0029 ())*/
-  {.w_px = 5,	.glyph_index = 310},	/*Unicode: U+002a (*)*/
-  {.w_px = 5,	.glyph_index = 360},	/*Unicode: U+002b (+)*/
-  {.w_px = 1,	.glyph_index = 410},	/*Unicode: U+002c (,)*/
-  {.w_px = 2,	.glyph_index = 420},	/*Unicode: U+002d (-)*/
-  {.w_px = 1,	.glyph_index = 440},	/*Unicode: U+002e (.)*/
-  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+002f (/)*/
-  {.w_px = 4,	.glyph_index = 490},	/*Unicode: U+0030 (0)*/
-  {.w_px = 3,	.glyph_index = 530},	/*Unicode: U+0031 (1)*/
-  {.w_px = 5,	.glyph_index = 560},	/*Unicode: U+0032 (2)*/
-  {.w_px = 4,	.glyph_index = 610},	/*Unicode: U+0033 (3)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+0034 (4)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+0035 (5)*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+0036 (6)*/
-  {.w_px = 4,	.glyph_index = 770},	/*Unicode: U+0037 (7)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+0038 (8)*/
-  {.w_px = 4,	.glyph_index = 850},	/*Unicode: U+0039 (9)*/
-  {.w_px = 1,	.glyph_index = 890},	/*Unicode: U+003a (:)*/
-  {.w_px = 1,	.glyph_index = 900},	/*Unicode: U+003b (;)*/
-  {.w_px = 4,	.glyph_index = 910},	/*Unicode: U+003c (<)*/
-  {.w_px = 4,	.glyph_index = 950},	/*Unicode: U+003d (=)*/
-  {.w_px = 4,	.glyph_index = 990},	/*Unicode: U+003e (>)*/
-  {.w_px = 3,	.glyph_index = 1030},	/*Unicode: U+003f (?)*/
-  {.w_px = 4,	.glyph_index = 1060},	/*Unicode: U+0040 (@)*/
-  {.w_px = 4,	.glyph_index = 1100},	/*Unicode: U+0041 (A)*/
-  {.w_px = 4,	.glyph_index = 1140},	/*Unicode: U+0042 (B)*/
-  {.w_px = 4,	.glyph_index = 1180},	/*Unicode: U+0043 (C)*/
-  {.w_px = 4,	.glyph_index = 1220},	/*Unicode: U+0044 (D)*/
-  {.w_px = 4,	.glyph_index = 1260},	/*Unicode: U+0045 (E)*/
-  {.w_px = 4,	.glyph_index = 1300},	/*Unicode: U+0046 (F)*/
-  {.w_px = 4,	.glyph_index = 1340},	/*Unicode: U+0047 (G)*/
-  {.w_px = 4,	.glyph_index = 1380},	/*Unicode: U+0048 (H)*/
-  {.w_px = 3,	.glyph_index = 1420},	/*Unicode: U+0049 (I)*/
-  {.w_px = 3,	.glyph_index = 1450},	/*Unicode: U+004a (J)*/
-  {.w_px = 5,	.glyph_index = 1480},	/*Unicode: U+004b (K)*/
-  {.w_px = 4,	.glyph_index = 1530},	/*Unicode: U+004c (L)*/
-  {.w_px = 4,	.glyph_index = 1570},	/*Unicode: U+004d (M)*/
-  {.w_px = 4,	.glyph_index = 1610},	/*Unicode: U+004e (N)*/
-  {.w_px = 4,	.glyph_index = 1650},	/*Unicode: U+004f (O)*/
-  {.w_px = 4,	.glyph_index = 1690},	/*Unicode: U+0050 (P)*/
-  {.w_px = 4,	.glyph_index = 1730},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 5,	.glyph_index = 1770},	/*Unicode: U+0052 (R)*/
-  {.w_px = 4,	.glyph_index = 1820},	/*Unicode: U+0053 (S)*/
-  {.w_px = 5,	.glyph_index = 1860},	/*Unicode: U+0054 (T)*/
-  {.w_px = 4,	.glyph_index = 1910},	/*Unicode: U+0055 (U)*/
-  {.w_px = 4,	.glyph_index = 1950},	/*Unicode: U+0056 (V)*/
-  {.w_px = 5,	.glyph_index = 1990},	/*Unicode: U+0057 (W)*/
-  {.w_px = 4,	.glyph_index = 2040},	/*Unicode: U+0058 (X)*/
-  {.w_px = 5,	.glyph_index = 2080},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 4,	.glyph_index = 2130},	/*Unicode: U+005a (Z)*/
-  {.w_px = 2,	.glyph_index = 2170},	/*Unicode: U+005b ([)*/
-  {.w_px = 4,	.glyph_index = 2190},	/*Unicode: U+005c (\)*/
-  {.w_px = 2,	.glyph_index = 2230},	/*Unicode: U+005d (])*/
-  {.w_px = 4,	.glyph_index = 2250},	/*Unicode: U+005e (^)*/
-  {.w_px = 5,	.glyph_index = 2290},	/*Unicode: U+005f (_)*/
-  {.w_px = 2,	.glyph_index = 2340},	/*Unicode: U+0060 (`)*/
-  {.w_px = 4,	.glyph_index = 2360},	/*Unicode: U+0061 (a)*/
-  {.w_px = 4,	.glyph_index = 2400},	/*Unicode: U+0062 (b)*/
-  {.w_px = 3,	.glyph_index = 2440},	/*Unicode: U+0063 (c)*/
-  {.w_px = 4,	.glyph_index = 2470},	/*Unicode: U+0064 (d)*/
-  {.w_px = 4,	.glyph_index = 2510},	/*Unicode: U+0065 (e)*/
-  {.w_px = 4,	.glyph_index = 2550},	/*Unicode: U+0066 (f)*/
-  {.w_px = 4,	.glyph_index = 2590},	/*Unicode: U+0067 (g)*/
-  {.w_px = 4,	.glyph_index = 2630},	/*Unicode: U+0068 (h)*/
-  {.w_px = 3,	.glyph_index = 2670},	/*Unicode: U+0069 (i)*/
-  {.w_px = 3,	.glyph_index = 2700},	/*Unicode: U+006a (j)*/
-  {.w_px = 5,	.glyph_index = 2730},	/*Unicode: U+006b (k)*/
-  {.w_px = 4,	.glyph_index = 2780},	/*Unicode: U+006c (l)*/
-  {.w_px = 5,	.glyph_index = 2820},	/*Unicode: U+006d (m)*/
-  {.w_px = 4,	.glyph_index = 2870},	/*Unicode: U+006e (n)*/
-  {.w_px = 4,	.glyph_index = 2910},	/*Unicode: U+006f (o)*/
-  {.w_px = 4,	.glyph_index = 2950},	/*Unicode: U+0070 (p)*/
-  {.w_px = 4,	.glyph_index = 2990},	/*Unicode: U+0071 (q)*/
-  {.w_px = 3,	.glyph_index = 3030},	/*Unicode: U+0072 (r)*/
-  {.w_px = 4,	.glyph_index = 3060},	/*Unicode: U+0073 (s)*/
-  {.w_px = 4,	.glyph_index = 3100},	/*Unicode: U+0074 (t)*/
-  {.w_px = 4,	.glyph_index = 3140},	/*Unicode: U+0075 (u)*/
-  {.w_px = 4,	.glyph_index = 3180},	/*Unicode: U+0076 (v)*/
-  {.w_px = 5,	.glyph_index = 3220},	/*Unicode: U+0077 (w)*/
-  {.w_px = 4,	.glyph_index = 3270},	/*Unicode: U+0078 (x)*/
-  {.w_px = 4,	.glyph_index = 3310},	/*Unicode: U+0079 (y)*/
-  {.w_px = 4,	.glyph_index = 3350},	/*Unicode: U+007a (z)*/
-  {.w_px = 3,	.glyph_index = 3390},	/*Unicode: U+007b ({)*/
-  {.w_px = 1,	.glyph_index = 3420},	/*Unicode: U+007c (|)*/
-  {.w_px = 3,	.glyph_index = 3430},	/*Unicode: U+007d (})*/
-  {.w_px = 4,	.glyph_index = 3460},	/*Unicode: U+007e (~)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 3,	.glyph_index = 12},	/*Unicode: U+0022 (")*/
+  {.w_px = 5,	.glyph_index = 23},	/*Unicode: U+0023 (#)*/
+  {.w_px = 5,	.glyph_index = 58},	/*Unicode: U+0024 ($)*/
+  {.w_px = 5,	.glyph_index = 94},	/*Unicode: U+0025 (%)*/
+  {.w_px = 4,	.glyph_index = 129},	/*Unicode: U+0026 (&)*/
+  {.w_px = 1,	.glyph_index = 157},	/*Unicode: U+0027 (')*/
+  {.w_px = 2,	.glyph_index = 163},	/*Unicode: U+0028 (()*/
+  {.w_px = 2,	.glyph_index = 180},	/*Unicode: U+0029 ())*/
+  {.w_px = 5,	.glyph_index = 197},	/*Unicode: U+002a (*)*/
+  {.w_px = 5,	.glyph_index = 222},	/*Unicode: U+002b (+)*/
+  {.w_px = 1,	.glyph_index = 244},	/*Unicode: U+002c (,)*/
+  {.w_px = 2,	.glyph_index = 251},	/*Unicode: U+002d (-)*/
+  {.w_px = 1,	.glyph_index = 258},	/*Unicode: U+002e (.)*/
+  {.w_px = 4,	.glyph_index = 264},	/*Unicode: U+002f (/)*/
+  {.w_px = 4,	.glyph_index = 293},	/*Unicode: U+0030 (0)*/
+  {.w_px = 3,	.glyph_index = 322},	/*Unicode: U+0031 (1)*/
+  {.w_px = 5,	.glyph_index = 344},	/*Unicode: U+0032 (2)*/
+  {.w_px = 4,	.glyph_index = 378},	/*Unicode: U+0033 (3)*/
+  {.w_px = 4,	.glyph_index = 407},	/*Unicode: U+0034 (4)*/
+  {.w_px = 4,	.glyph_index = 434},	/*Unicode: U+0035 (5)*/
+  {.w_px = 4,	.glyph_index = 459},	/*Unicode: U+0036 (6)*/
+  {.w_px = 4,	.glyph_index = 488},	/*Unicode: U+0037 (7)*/
+  {.w_px = 4,	.glyph_index = 515},	/*Unicode: U+0038 (8)*/
+  {.w_px = 4,	.glyph_index = 544},	/*Unicode: U+0039 (9)*/
+  {.w_px = 1,	.glyph_index = 573},	/*Unicode: U+003a (:)*/
+  {.w_px = 1,	.glyph_index = 582},	/*Unicode: U+003b (;)*/
+  {.w_px = 4,	.glyph_index = 592},	/*Unicode: U+003c (<)*/
+  {.w_px = 4,	.glyph_index = 612},	/*Unicode: U+003d (=)*/
+  {.w_px = 4,	.glyph_index = 622},	/*Unicode: U+003e (>)*/
+  {.w_px = 3,	.glyph_index = 642},	/*Unicode: U+003f (?)*/
+  {.w_px = 4,	.glyph_index = 662},	/*Unicode: U+0040 (@)*/
+  {.w_px = 4,	.glyph_index = 691},	/*Unicode: U+0041 (A)*/
+  {.w_px = 4,	.glyph_index = 719},	/*Unicode: U+0042 (B)*/
+  {.w_px = 4,	.glyph_index = 748},	/*Unicode: U+0043 (C)*/
+  {.w_px = 4,	.glyph_index = 777},	/*Unicode: U+0044 (D)*/
+  {.w_px = 4,	.glyph_index = 806},	/*Unicode: U+0045 (E)*/
+  {.w_px = 4,	.glyph_index = 824},	/*Unicode: U+0046 (F)*/
+  {.w_px = 4,	.glyph_index = 842},	/*Unicode: U+0047 (G)*/
+  {.w_px = 4,	.glyph_index = 871},	/*Unicode: U+0048 (H)*/
+  {.w_px = 3,	.glyph_index = 897},	/*Unicode: U+0049 (I)*/
+  {.w_px = 3,	.glyph_index = 918},	/*Unicode: U+004a (J)*/
+  {.w_px = 5,	.glyph_index = 940},	/*Unicode: U+004b (K)*/
+  {.w_px = 4,	.glyph_index = 975},	/*Unicode: U+004c (L)*/
+  {.w_px = 4,	.glyph_index = 1001},	/*Unicode: U+004d (M)*/
+  {.w_px = 4,	.glyph_index = 1030},	/*Unicode: U+004e (N)*/
+  {.w_px = 4,	.glyph_index = 1059},	/*Unicode: U+004f (O)*/
+  {.w_px = 4,	.glyph_index = 1088},	/*Unicode: U+0050 (P)*/
+  {.w_px = 4,	.glyph_index = 1114},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 5,	.glyph_index = 1147},	/*Unicode: U+0052 (R)*/
+  {.w_px = 4,	.glyph_index = 1182},	/*Unicode: U+0053 (S)*/
+  {.w_px = 5,	.glyph_index = 1211},	/*Unicode: U+0054 (T)*/
+  {.w_px = 4,	.glyph_index = 1237},	/*Unicode: U+0055 (U)*/
+  {.w_px = 4,	.glyph_index = 1266},	/*Unicode: U+0056 (V)*/
+  {.w_px = 5,	.glyph_index = 1294},	/*Unicode: U+0057 (W)*/
+  {.w_px = 4,	.glyph_index = 1329},	/*Unicode: U+0058 (X)*/
+  {.w_px = 5,	.glyph_index = 1358},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 4,	.glyph_index = 1390},	/*Unicode: U+005a (Z)*/
+  {.w_px = 2,	.glyph_index = 1417},	/*Unicode: U+005b ([)*/
+  {.w_px = 4,	.glyph_index = 1433},	/*Unicode: U+005c (\)*/
+  {.w_px = 2,	.glyph_index = 1466},	/*Unicode: U+005d (])*/
+  {.w_px = 4,	.glyph_index = 1482},	/*Unicode: U+005e (^)*/
+  {.w_px = 5,	.glyph_index = 1495},	/*Unicode: U+005f (_)*/
+  {.w_px = 2,	.glyph_index = 1501},	/*Unicode: U+0060 (`)*/
+  {.w_px = 4,	.glyph_index = 1508},	/*Unicode: U+0061 (a)*/
+  {.w_px = 4,	.glyph_index = 1529},	/*Unicode: U+0062 (b)*/
+  {.w_px = 3,	.glyph_index = 1560},	/*Unicode: U+0063 (c)*/
+  {.w_px = 4,	.glyph_index = 1577},	/*Unicode: U+0064 (d)*/
+  {.w_px = 4,	.glyph_index = 1607},	/*Unicode: U+0065 (e)*/
+  {.w_px = 4,	.glyph_index = 1628},	/*Unicode: U+0066 (f)*/
+  {.w_px = 4,	.glyph_index = 1656},	/*Unicode: U+0067 (g)*/
+  {.w_px = 4,	.glyph_index = 1685},	/*Unicode: U+0068 (h)*/
+  {.w_px = 3,	.glyph_index = 1716},	/*Unicode: U+0069 (i)*/
+  {.w_px = 3,	.glyph_index = 1735},	/*Unicode: U+006a (j)*/
+  {.w_px = 5,	.glyph_index = 1761},	/*Unicode: U+006b (k)*/
+  {.w_px = 4,	.glyph_index = 1795},	/*Unicode: U+006c (l)*/
+  {.w_px = 5,	.glyph_index = 1826},	/*Unicode: U+006d (m)*/
+  {.w_px = 4,	.glyph_index = 1851},	/*Unicode: U+006e (n)*/
+  {.w_px = 4,	.glyph_index = 1872},	/*Unicode: U+006f (o)*/
+  {.w_px = 4,	.glyph_index = 1893},	/*Unicode: U+0070 (p)*/
+  {.w_px = 4,	.glyph_index = 1919},	/*Unicode: U+0071 (q)*/
+  {.w_px = 3,	.glyph_index = 1948},	/*Unicode: U+0072 (r)*/
+  {.w_px = 4,	.glyph_index = 1963},	/*Unicode: U+0073 (s)*/
+  {.w_px = 4,	.glyph_index = 1984},	/*Unicode: U+0074 (t)*/
+  {.w_px = 4,	.glyph_index = 2007},	/*Unicode: U+0075 (u)*/
+  {.w_px = 4,	.glyph_index = 2028},	/*Unicode: U+0076 (v)*/
+  {.w_px = 5,	.glyph_index = 2048},	/*Unicode: U+0077 (w)*/
+  {.w_px = 4,	.glyph_index = 2073},	/*Unicode: U+0078 (x)*/
+  {.w_px = 4,	.glyph_index = 2094},	/*Unicode: U+0079 (y)*/
+  {.w_px = 4,	.glyph_index = 2121},	/*Unicode: U+007a (z)*/
+  {.w_px = 3,	.glyph_index = 2140},	/*Unicode: U+007b ({)*/
+  {.w_px = 1,	.glyph_index = 2164},	/*Unicode: U+007c (|)*/
+  {.w_px = 3,	.glyph_index = 2169},	/*Unicode: U+007d (})*/
+  {.w_px = 4,	.glyph_index = 2192},	/*Unicode: U+007e (~)*/
 
 #endif
 };
@@ -5378,6 +1717,7 @@ lv_font_t pros_font_dejavu_mono =
 #endif
     .monospace = 5,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO*/
@@ -12,8751 +12,2066 @@ static const uint8_t pros_font_dejavu_mono_20_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_20 == 1
   /*Unicode: U+0020 ( ) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xed, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xf8, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+0022 (") , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0xcc,  //%%..%%
-  0xcc,  //%%..%%
-  0xcc,  //%%..%%
-  0xcc,  //%%..%%
-  0xcc,  //%%..%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfe, 0x00, 0xfc, 0xcc, 0xf5, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x04, 0xc0,  //.....%..%%.
-  0x0c, 0x80,  //....%%..%..
-  0x0c, 0x80,  //....%%..%..
-  0x09, 0x80,  //....%..%%..
-  0x7f, 0xe0,  //.%%%%%%%%%%
-  0x7f, 0xe0,  //.%%%%%%%%%%
-  0x19, 0x00,  //...%%..%...
-  0x13, 0x00,  //...%..%%...
-  0xff, 0xc0,  //%%%%%%%%%%.
-  0xff, 0xc0,  //%%%%%%%%%%.
-  0x32, 0x00,  //..%%..%....
-  0x22, 0x00,  //..%...%....
-  0x26, 0x00,  //..%..%%....
-  0x66, 0x00,  //.%%..%%....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfd, 0x00, 0x1a, 0x04, 0xc0, 0x0c, 0x80, 0x0c, 0x80, 0x09, 0x80, 0x7f, 0xe0, 0x7f, 0xe0, 0x19,
+  0x00, 0x13, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x32, 0x00, 0x22, 0x00, 0x26, 0x00, 0x66, 0xf8, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x08, 0x00,  //....%....
-  0x08, 0x00,  //....%....
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe9, 0x00,  //%%%.%..%.
-  0xc8, 0x00,  //%%..%....
-  0xc8, 0x00,  //%%..%....
-  0x78, 0x00,  //.%%%%....
-  0x0f, 0x00,  //....%%%%.
-  0x09, 0x80,  //....%..%%
-  0x09, 0x80,  //....%..%%
-  0x8b, 0x80,  //%...%.%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0x7e, 0x00,  //.%%%%%%..
-  0x08, 0x00,  //....%....
-  0x08, 0x00,  //....%....
-  0x08, 0x00,  //....%....
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x20, 0x08, 0x00, 0x08, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0xc8,
+  0x00, 0x78, 0x00, 0x0f, 0x00, 0x09, 0x80, 0x09, 0x80, 0x8b, 0x80, 0xff, 0x00, 0x7e, 0x00, 0x08,
+  0x00, 0x08, 0x00, 0x08, 0xfe, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x78, 0x00,  //.%%%%......
-  0xcc, 0x00,  //%%..%%.....
-  0xcc, 0x00,  //%%..%%.....
-  0xcc, 0x00,  //%%..%%.....
-  0xcc, 0x00,  //%%..%%.....
-  0x79, 0xc0,  //.%%%%..%%%.
-  0x0e, 0x00,  //....%%%....
-  0x73, 0xc0,  //.%%%..%%%%.
-  0x06, 0x60,  //.....%%..%%
-  0x06, 0x60,  //.....%%..%%
-  0x06, 0x60,  //.....%%..%%
-  0x06, 0x60,  //.....%%..%%
-  0x03, 0xc0,  //......%%%%.
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x19, 0x78, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0xcc, 0x00, 0x79, 0xc0, 0x0e,
+  0x00, 0x73, 0xc0, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x03, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x1f, 0x00,  //...%%%%%..
-  0x3f, 0x00,  //..%%%%%%..
-  0x30, 0x00,  //..%%......
-  0x30, 0x00,  //..%%......
-  0x18, 0x00,  //...%%.....
-  0x3c, 0x00,  //..%%%%....
-  0x6c, 0xc0,  //.%%.%%..%%
-  0xce, 0xc0,  //%%..%%%.%%
-  0xc7, 0xc0,  //%%...%%%%%
-  0xc3, 0x80,  //%%....%%%.
-  0xe3, 0x00,  //%%%...%%..
-  0x7f, 0x80,  //.%%%%%%%%.
-  0x3d, 0xc0,  //..%%%%.%%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x19, 0x1f, 0x00, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x6c,
+  0xc0, 0xce, 0xc0, 0xc7, 0xc0, 0xc3, 0x80, 0xe3, 0x00, 0x7f, 0x80, 0x3d, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xfc, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0028 (() , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x30,  //..%%
-  0x20,  //..%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x40,  //.%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0x40,  //.%..
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x20,  //..%.
-  0x30,  //..%%
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x00, 0x30, 0x20, 0x60, 0x60, 0x40, 0xfb, 0xc0, 0x06, 0x40, 0x60, 0x60, 0x20, 0x30,
+  0x00, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xc0,  //%%..
-  0x40,  //.%..
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x20,  //..%.
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x20,  //..%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x00, 0xc0, 0x40, 0x60, 0x60, 0x20, 0xfb, 0x30, 0x06, 0x20, 0x60, 0x60, 0x40, 0xc0,
+  0x00, 0x00,
 
   /*Unicode: U+002a (*) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x10,  //...%...
-  0x92,  //%..%..%
-  0x54,  //.%.%.%.
-  0x38,  //..%%%..
-  0x38,  //..%%%..
-  0x54,  //.%.%.%.
-  0x92,  //%..%..%
-  0x10,  //...%...
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x07, 0x10, 0x92, 0x54, 0x38, 0x38, 0x54, 0x92, 0x10, 0xf8, 0x00,
 
   /*Unicode: U+002b (+) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x12, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xf6, 0x00,
 
   /*Unicode: U+002c (,) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x60,  //.%%
-  0x60,  //.%%
-  0xc0,  //%%.
-  0x80,  //%..
-  0x00,  //...
-  0x00,  //...
-
+  0xf4, 0x00, 0xfe, 0x60, 0x03, 0xc0, 0x80, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xf7, 0x00, 0x01, 0xf8, 0xf8, 0xf9, 0x00,
 
   /*Unicode: U+002e (.) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf4, 0x00, 0xfe, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+002f (/) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x01, 0x80,  //.......%%
-  0x03, 0x00,  //......%%.
-  0x03, 0x00,  //......%%.
-  0x06, 0x00,  //.....%%..
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x0c, 0x00,  //....%%...
-  0x08, 0x00,  //....%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0x60, 0x00,  //.%%......
-  0x60, 0x00,  //.%%......
-  0xc0, 0x00,  //%%.......
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x1c, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x08, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xc0,
+  0xfc, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xcd, 0x80, 0xcd,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x38,  //..%%%...
-  0xf8,  //%%%%%...
-  0x98,  //%..%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfe, 0x00, 0x02, 0x38, 0xf8, 0x98, 0xf9, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x7e, 0x00,  //.%%%%%%...
-  0xff, 0x00,  //%%%%%%%%..
-  0x83, 0x80,  //%.....%%%.
-  0x01, 0x80,  //.......%%.
-  0x01, 0x80,  //.......%%.
-  0x03, 0x80,  //......%%%.
-  0x03, 0x00,  //......%%..
-  0x0e, 0x00,  //....%%%...
-  0x1c, 0x00,  //...%%%....
-  0x38, 0x00,  //..%%%.....
-  0x60, 0x00,  //.%%.......
-  0xff, 0x80,  //%%%%%%%%%.
-  0xff, 0x80,  //%%%%%%%%%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x19, 0x7e, 0x00, 0xff, 0x00, 0x83, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80, 0x03,
+  0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x60, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x7e, 0x00,  //.%%%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0x83, 0x80,  //%.....%%%
-  0x01, 0x80,  //.......%%
-  0x03, 0x80,  //......%%%
-  0x3f, 0x00,  //..%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x03, 0x00,  //......%%.
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x83, 0x80,  //%.....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0x7e, 0x00,  //.%%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x7e, 0x00, 0xff, 0x00, 0x83, 0x80, 0x01, 0x80, 0x03, 0x80, 0x3f, 0x00, 0x3e,
+  0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x83, 0x80, 0xff, 0x00, 0x7e, 0xf8, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0e, 0x00,  //....%%%..
-  0x0e, 0x00,  //....%%%..
-  0x16, 0x00,  //...%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x26, 0x00,  //..%..%%..
-  0x66, 0x00,  //.%%..%%..
-  0xc6, 0x00,  //%%...%%..
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x06, 0x00,  //.....%%..
-  0x06, 0x00,  //.....%%..
-  0x06, 0x00,  //.....%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x06, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x16, 0x00, 0x36, 0x00, 0x26, 0x00, 0x66,
+  0x00, 0xc6, 0x00, 0xff, 0x80, 0xff, 0x80, 0x06, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x60, 0x00,  //.%%......
-  0x60, 0x00,  //.%%......
-  0x7e, 0x00,  //.%%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x83, 0x80,  //%.....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0x7c, 0x00,  //.%%%%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7e, 0x00, 0x7f, 0x00, 0x43,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x83, 0x80, 0xff, 0x00, 0x7c, 0xf8, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x3f, 0x00,  //..%%%%%%.
-  0x71, 0x00,  //.%%%...%.
-  0xe0, 0x00,  //%%%......
-  0xc0, 0x00,  //%%.......
-  0xde, 0x00,  //%%.%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x80,  //.%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x1e, 0x00, 0x3f, 0x00, 0x71, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xde, 0x00, 0xff,
+  0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x03, 0x00,  //......%%.
-  0x03, 0x00,  //......%%.
-  0x07, 0x00,  //.....%%%.
-  0x06, 0x00,  //.....%%..
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x0c, 0x00,  //....%%...
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x30, 0x00,  //..%%.....
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xff, 0x80, 0xff, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0xf8, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x3e, 0x00, 0x7f,
+  0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x00,  //%%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x3d, 0x80,  //..%%%%.%%
-  0x01, 0x80,  //.......%%
-  0x03, 0x80,  //......%%%
-  0x47, 0x00,  //.%...%%%.
-  0x7e, 0x00,  //.%%%%%%..
-  0x3c, 0x00,  //..%%%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f,
+  0x80, 0x3d, 0x80, 0x01, 0x80, 0x03, 0x80, 0x47, 0x00, 0x7e, 0x00, 0x3c, 0xf8, 0x00,
 
   /*Unicode: U+003a (:) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfa, 0x00, 0xfe, 0xc0, 0xfe, 0x00, 0xfe, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+003b (;) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x60,  //.%%
-  0x60,  //.%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x60,  //.%%
-  0x60,  //.%%
-  0xc0,  //%%.
-  0x80,  //%..
-  0x00,  //...
-  0x00,  //...
-
+  0xfa, 0x00, 0xfe, 0x60, 0xfe, 0x00, 0xfe, 0x60, 0x03, 0xc0, 0x80, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x80,  //........%
-  0x07, 0x80,  //.....%%%%
-  0x1e, 0x00,  //...%%%%..
-  0x70, 0x00,  //.%%%.....
-  0xc0, 0x00,  //%%.......
-  0x70, 0x00,  //.%%%.....
-  0x1e, 0x00,  //...%%%%..
-  0x07, 0x80,  //.....%%%%
-  0x00, 0x80,  //........%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf4, 0x00, 0x10, 0x80, 0x07, 0x80, 0x1e, 0x00, 0x70, 0x00, 0xc0, 0x00, 0x70, 0x00, 0x1e, 0x00,
+  0x07, 0x80, 0x00, 0x80, 0xf7, 0x00,
 
   /*Unicode: U+003d (=) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf3, 0x00, 0x03, 0xff, 0x80, 0xff, 0x80, 0xfd, 0x00, 0x03, 0xff, 0x80, 0xff, 0x80, 0xf3, 0x00,
 
   /*Unicode: U+003e (>) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x80, 0x00,  //%........
-  0xf0, 0x00,  //%%%%.....
-  0x3c, 0x00,  //..%%%%...
-  0x07, 0x00,  //.....%%%.
-  0x01, 0x80,  //.......%%
-  0x07, 0x00,  //.....%%%.
-  0x3c, 0x00,  //..%%%%...
-  0xf0, 0x00,  //%%%%.....
-  0x80, 0x00,  //%........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x10, 0x80, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x07, 0x00, 0x01, 0x80, 0x07, 0x00, 0x3c,
+  0x00, 0xf0, 0x00, 0x80, 0xf6, 0x00,
 
   /*Unicode: U+003f (?) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x78,  //.%%%%..
-  0xfc,  //%%%%%%.
-  0x86,  //%....%%
-  0x06,  //.....%%
-  0x0e,  //....%%%
-  0x1c,  //...%%%.
-  0x38,  //..%%%..
-  0x30,  //..%%...
-  0x30,  //..%%...
-  0x30,  //..%%...
-  0x00,  //.......
-  0x30,  //..%%...
-  0x30,  //..%%...
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x06, 0x78, 0xfc, 0x86, 0x06, 0x0e, 0x1c, 0x38, 0xfe, 0x30, 0x02, 0x00, 0x30, 0x30,
+  0xfd, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x33, 0x00,  //..%%..%%.
-  0x61, 0x80,  //.%%....%%
-  0x67, 0x80,  //.%%..%%%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xc7, 0x80,  //%%...%%%%
-  0x60, 0x00,  //.%%......
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x1e, 0x00,  //...%%%%..
-  0x00, 0x00,  //.........
-
+  0xf9, 0x00, 0x1c, 0x1e, 0x00, 0x33, 0x00, 0x61, 0x80, 0x67, 0x80, 0xcd, 0x80, 0xcd, 0x80, 0xcd,
+  0x80, 0xcd, 0x80, 0xcd, 0x80, 0xcd, 0x80, 0xc7, 0x80, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x1e,
+  0xfe, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x36, 0x00, 0x36,
+  0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xfe, 0x00,  //%%%%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xc3, 0x80,  //%%....%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xff, 0x00,  //%%%%%%%%.
-  0xc3, 0x80,  //%%....%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xfe, 0x00,  //%%%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xfe, 0x00, 0xff, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x00, 0xff,
+  0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x00, 0xfe, 0xf8, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1f, 0x00,  //...%%%%%.
-  0x3f, 0x80,  //..%%%%%%%
-  0x70, 0x80,  //.%%%....%
-  0x60, 0x00,  //.%%......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xe0, 0x00,  //%%%......
-  0x70, 0x80,  //.%%%....%
-  0x3f, 0x80,  //..%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x1f, 0x00, 0x3f, 0x80, 0x70, 0x80, 0x60, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x80, 0x3f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xfc, 0x00,  //%%%%%%...
-  0xfe, 0x00,  //%%%%%%%..
-  0xc7, 0x00,  //%%...%%%.
-  0xc3, 0x80,  //%%....%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xc7, 0x00,  //%%...%%%.
-  0xfe, 0x00,  //%%%%%%%..
-  0xfc, 0x00,  //%%%%%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xfc, 0x00, 0xfe, 0x00, 0xc7, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xc7, 0x00, 0xfe, 0x00, 0xfc, 0xf8, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff,
+  0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x00,  //%%%%%%%%.
-  0xff, 0x00,  //%%%%%%%%.
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xf8, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1f, 0x00,  //...%%%%%.
-  0x3f, 0x80,  //..%%%%%%%
-  0x70, 0x80,  //.%%%....%
-  0x60, 0x00,  //.%%......
-  0xc0, 0x00,  //%%.......
-  0xc7, 0x80,  //%%...%%%%
-  0xc7, 0x80,  //%%...%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe1, 0x80,  //%%%....%%
-  0x61, 0x80,  //.%%....%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x1e, 0x00,  //...%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x1f, 0x00, 0x3f, 0x80, 0x70, 0x80, 0x60, 0x00, 0xc0, 0x00, 0xc7, 0x80, 0xc7,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe1, 0x80, 0x61, 0x80, 0x3f, 0x80, 0x1e, 0xf8, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xff, 0x80, 0xff,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfe, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+004a (J) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x3e,  //..%%%%%
-  0x3e,  //..%%%%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x8e,  //%...%%%
-  0xfc,  //%%%%%%.
-  0x78,  //.%%%%..
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x01, 0x3e, 0x3e, 0xf9, 0x06, 0x02, 0x8e, 0xfc, 0x78, 0xfd, 0x00,
 
   /*Unicode: U+004b (K) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xc1, 0x80,  //%%.....%%.
-  0xc3, 0x00,  //%%....%%..
-  0xc6, 0x00,  //%%...%%...
-  0xcc, 0x00,  //%%..%%....
-  0xd8, 0x00,  //%%.%%.....
-  0xf8, 0x00,  //%%%%%.....
-  0xf8, 0x00,  //%%%%%.....
-  0xcc, 0x00,  //%%..%%....
-  0xce, 0x00,  //%%..%%%...
-  0xc6, 0x00,  //%%...%%...
-  0xc3, 0x00,  //%%....%%..
-  0xc3, 0x80,  //%%....%%%.
-  0xc1, 0x80,  //%%.....%%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x19, 0xc1, 0x80, 0xc3, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xd8, 0x00, 0xf8, 0x00, 0xf8,
+  0x00, 0xcc, 0x00, 0xce, 0x00, 0xc6, 0x00, 0xc3, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+004c (L) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+004d (M) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xe3, 0x80,  //%%%...%%%
-  0xe3, 0x80,  //%%%...%%%
-  0xe3, 0x80,  //%%%...%%%
-  0xf7, 0x80,  //%%%%.%%%%
-  0xd5, 0x80,  //%%.%.%.%%
-  0xdd, 0x80,  //%%.%%%.%%
-  0xdd, 0x80,  //%%.%%%.%%
-  0xc9, 0x80,  //%%..%..%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xf7, 0x80, 0xd5, 0x80, 0xdd, 0x80, 0xdd,
+  0x80, 0xc9, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+004e (N) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xe1, 0x80,  //%%%....%%
-  0xe1, 0x80,  //%%%....%%
-  0xf1, 0x80,  //%%%%...%%
-  0xd1, 0x80,  //%%.%...%%
-  0xd1, 0x80,  //%%.%...%%
-  0xd9, 0x80,  //%%.%%..%%
-  0xc9, 0x80,  //%%..%..%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xc5, 0x80,  //%%...%.%%
-  0xc5, 0x80,  //%%...%.%%
-  0xc7, 0x80,  //%%...%%%%
-  0xc3, 0x80,  //%%....%%%
-  0xc3, 0x80,  //%%....%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xe1, 0x80, 0xe1, 0x80, 0xf1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xc9,
+  0x80, 0xcd, 0x80, 0xc5, 0x80, 0xc5, 0x80, 0xc7, 0x80, 0xc3, 0x80, 0xc3, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+004f (O) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xfe, 0x00,  //%%%%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xc3, 0x80,  //%%....%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xfe, 0x00,  //%%%%%%%..
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xfe, 0x00, 0xff, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff,
+  0x00, 0xfe, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xf8, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x07, 0x00,  //.....%%%.
-  0x03, 0x00,  //......%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x1c, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e, 0x00, 0x07, 0x00, 0x03,
+  0xfc, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xfe, 0x00,  //%%%%%%%...
-  0xff, 0x00,  //%%%%%%%%..
-  0xc3, 0x80,  //%%....%%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc3, 0x80,  //%%....%%%.
-  0xff, 0x00,  //%%%%%%%%..
-  0xfe, 0x00,  //%%%%%%%...
-  0xc7, 0x00,  //%%...%%%..
-  0xc3, 0x00,  //%%....%%..
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc0, 0xc0,  //%%......%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x19, 0xfe, 0x00, 0xff, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff,
+  0x00, 0xfe, 0x00, 0xc7, 0x00, 0xc3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc0, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe1, 0x00,  //%%%....%.
-  0xc0, 0x00,  //%%.......
-  0xe0, 0x00,  //%%%......
-  0x7c, 0x00,  //.%%%%%...
-  0x3f, 0x00,  //..%%%%%%.
-  0x03, 0x80,  //......%%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x83, 0x80,  //%.....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0x7e, 0x00,  //.%%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0xe1, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x7c, 0x00, 0x3f,
+  0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x83, 0x80, 0xff, 0x00, 0x7e, 0xf8, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0xff, 0xc0, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xf8, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x77, 0x00,  //.%%%.%%%.
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x77, 0x00, 0x36,
+  0x00, 0x36, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xf8, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xc0, 0x60,  //%%.......%%
-  0xc0, 0x60,  //%%.......%%
-  0xc0, 0x60,  //%%.......%%
-  0x60, 0xc0,  //.%%.....%%.
-  0x6e, 0xc0,  //.%%.%%%.%%.
-  0x6e, 0xc0,  //.%%.%%%.%%.
-  0x6e, 0xc0,  //.%%.%%%.%%.
-  0x6a, 0xc0,  //.%%.%.%.%%.
-  0x7b, 0xc0,  //.%%%%.%%%%.
-  0x7b, 0xc0,  //.%%%%.%%%%.
-  0x31, 0x80,  //..%%...%%..
-  0x31, 0x80,  //..%%...%%..
-  0x31, 0x80,  //..%%...%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x19, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0xc0, 0x6e, 0xc0, 0x6e, 0xc0, 0x6e,
+  0xc0, 0x6a, 0xc0, 0x7b, 0xc0, 0x7b, 0xc0, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xe3, 0x80,  //%%%...%%%
-  0x63, 0x00,  //.%%...%%.
-  0x76, 0x00,  //.%%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x77, 0x00,  //.%%%.%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xe3, 0x80,  //%%%...%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xe3, 0x80, 0x63, 0x00, 0x76, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+  0x00, 0x1c, 0x00, 0x3e, 0x00, 0x36, 0x00, 0x77, 0x00, 0x63, 0x00, 0xe3, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xe1, 0xc0,  //%%%....%%%
-  0x61, 0x80,  //.%%....%%.
-  0x73, 0x80,  //.%%%..%%%.
-  0x33, 0x00,  //..%%..%%..
-  0x1e, 0x00,  //...%%%%...
-  0x1e, 0x00,  //...%%%%...
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0xe1, 0xc0, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xf8, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x03, 0x00,  //......%%.
-  0x07, 0x00,  //.....%%%.
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x38, 0x00,  //..%%%....
-  0x70, 0x00,  //.%%%.....
-  0x60, 0x00,  //.%%......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x1c,
+  0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+005b ([) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf5, 0xc0, 0x03, 0xf0, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+005c (\) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0x60, 0x00,  //.%%......
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x08, 0x00,  //....%....
-  0x0c, 0x00,  //....%%...
-  0x0c, 0x00,  //....%%...
-  0x06, 0x00,  //.....%%..
-  0x06, 0x00,  //.....%%..
-  0x03, 0x00,  //......%%.
-  0x03, 0x00,  //......%%.
-  0x01, 0x80,  //.......%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x1d, 0xc0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18,
+  0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01,
+  0x80, 0xfd, 0x00,
 
   /*Unicode: U+005d (]) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0x30,  //..%%
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf5, 0x30, 0x03, 0xf0, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+005e (^) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0c, 0x00,  //....%%....
-  0x1e, 0x00,  //...%%%%...
-  0x33, 0x00,  //..%%..%%..
-  0x61, 0x80,  //.%%....%%.
-  0xc0, 0xc0,  //%%......%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x09, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0x00, 0x61, 0x80, 0xc0, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+005f (_) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-
+  0xdd, 0x00, 0x03, 0xff, 0xe0, 0xff, 0xe0,
 
   /*Unicode: U+0060 (`) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xc0,  //%%..
-  0x60,  //.%%.
-  0x30,  //..%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x04, 0x00, 0x00, 0xc0, 0x60, 0x30, 0xf2, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43, 0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1,
+  0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xde, 0x00,  //%%.%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xde, 0x00,  //%%.%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x1a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xde, 0x00, 0xff, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0xf8, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x1e,  //...%%%%.
-  0x7f,  //.%%%%%%%
-  0x61,  //.%%....%
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0x61,  //.%%....%
-  0x7f,  //.%%%%%%%
-  0x1e,  //...%%%%.
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfb, 0x00, 0x02, 0x1e, 0x7f, 0x61, 0xfd, 0xc0, 0x02, 0x61, 0x7f, 0x1e, 0xfd, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x3d, 0x80,  //..%%%%.%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x3d, 0x80,  //..%%%%.%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x1b, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x3d, 0x80, 0x7f, 0x80, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+0065 (e) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x80,  //.%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0x60, 0x80,  //.%%.....%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x12, 0x1e, 0x00, 0x7f, 0x00, 0x63, 0x80, 0xc1, 0x80, 0xff, 0x80, 0xff, 0x80, 0xc0,
+  0x00, 0x60, 0x80, 0x7f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x0f,  //....%%%%
-  0x1f,  //...%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0x0f, 0x1f, 0x18, 0x18, 0xff, 0xff, 0xf9, 0x18, 0xfd, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3d, 0x80,  //..%%%%.%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x3d, 0x80,  //..%%%%.%%
-  0x01, 0x80,  //.......%%
-  0x43, 0x80,  //.%....%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-
+  0xf5, 0x00, 0x1b, 0x3d, 0x80, 0x7f, 0x80, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x01, 0x80, 0x43, 0x80, 0x7f, 0x00, 0x3e, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xce, 0x00,  //%%..%%%..
-  0xdf, 0x00,  //%%.%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x1b, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xce, 0x00, 0xdf, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+0069 (i) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x00,  //........
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0xf8, 0xf8, 0xfb, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+006a (j) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x00,  //......
-  0x00,  //......
-  0x7c,  //.%%%%%
-  0x7c,  //.%%%%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x0c,  //....%%
-  0x1c,  //...%%%
-  0xf8,  //%%%%%.
-  0xf0,  //%%%%..
-
+  0x07, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x7c, 0x7c, 0xf8, 0x0c, 0x02, 0x1c, 0xf8, 0xf0,
 
   /*Unicode: U+006b (k) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-  0xc3, 0x80,  //%%....%%%.
-  0xc7, 0x00,  //%%...%%%..
-  0xce, 0x00,  //%%..%%%...
-  0xdc, 0x00,  //%%.%%%....
-  0xf8, 0x00,  //%%%%%.....
-  0xfc, 0x00,  //%%%%%%....
-  0xcc, 0x00,  //%%..%%....
-  0xc6, 0x00,  //%%...%%...
-  0xc7, 0x00,  //%%...%%%..
-  0xc3, 0x80,  //%%....%%%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfd, 0x00, 0x1b, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc3, 0x80, 0xc7, 0x00, 0xce,
+  0x00, 0xdc, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xcc, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc3, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+006c (l) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x0f,  //....%%%%
-  0x0f,  //....%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x03, 0x00, 0x00, 0xf8, 0xf8, 0xf7, 0x18, 0x01, 0x0f, 0x0f, 0xfd, 0x00,
 
   /*Unicode: U+006d (m) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xdb, 0x80,  //%%.%%.%%%.
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0xcc, 0xc0,  //%%..%%..%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf5, 0x00, 0x13, 0xdb, 0x80, 0xff, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc,
+  0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+006e (n) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xce, 0x00,  //%%..%%%..
-  0xdf, 0x00,  //%%.%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x13, 0xce, 0x00, 0xdf, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+006f (o) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xde, 0x00,  //%%.%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xde, 0x00,  //%%.%%%%..
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-
+  0xf5, 0x00, 0x1b, 0xde, 0x00, 0xff, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3d, 0x80,  //..%%%%.%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x3d, 0x80,  //..%%%%.%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-
+  0xf5, 0x00, 0x1b, 0x3d, 0x80, 0x7f, 0x80, 0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0x7f, 0x80, 0x3d, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
 
   /*Unicode: U+0072 (r) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0xcc,  //%%..%%.
-  0xde,  //%%.%%%%
-  0xe2,  //%%%...%
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0xc0,  //%%.....
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfb, 0x00, 0x02, 0xcc, 0xde, 0xe2, 0xfa, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3f, 0x00,  //..%%%%%%.
-  0xff, 0x80,  //%%%%%%%%%
-  0xe0, 0x80,  //%%%.....%
-  0xf8, 0x00,  //%%%%%....
-  0x7f, 0x00,  //.%%%%%%%.
-  0x07, 0x80,  //.....%%%%
-  0x01, 0x80,  //.......%%
-  0x83, 0x80,  //%.....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0x7e, 0x00,  //.%%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x12, 0x3f, 0x00, 0xff, 0x80, 0xe0, 0x80, 0xf8, 0x00, 0x7f, 0x00, 0x07, 0x80, 0x01,
+  0x80, 0x83, 0x80, 0xff, 0x00, 0x7e, 0xf8, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x1f, 0x80,  //...%%%%%%
-  0x0f, 0x80,  //....%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xff, 0x80, 0xff, 0x80, 0x18, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1f, 0x80, 0x0f, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7d, 0x80,  //.%%%%%.%%
-  0x39, 0x80,  //..%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x13, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0x7d, 0x80, 0x39, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x12, 0xc1, 0x80, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x36, 0x00, 0x36, 0x00, 0x3e,
+  0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xf8, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xc0, 0x60,  //%%.......%%
-  0xc0, 0x60,  //%%.......%%
-  0x60, 0xc0,  //.%%.....%%.
-  0x64, 0xc0,  //.%%..%..%%.
-  0x6e, 0xc0,  //.%%.%%%.%%.
-  0x6a, 0xc0,  //.%%.%.%.%%.
-  0x3b, 0x80,  //..%%%.%%%..
-  0x3b, 0x80,  //..%%%.%%%..
-  0x31, 0x80,  //..%%...%%..
-  0x31, 0x80,  //..%%...%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x13, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0xc0, 0x64, 0xc0, 0x6e, 0xc0, 0x6a, 0xc0, 0x3b,
+  0x80, 0x3b, 0x80, 0x31, 0x80, 0x31, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xe3, 0x80,  //%%%...%%%
-  0x77, 0x00,  //.%%%.%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x63, 0x00,  //.%%...%%.
-  0xe3, 0x80,  //%%%...%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x13, 0xe3, 0x80, 0x77, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x63, 0x00, 0xe3, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x73, 0x00,  //.%%%..%%.
-  0x36, 0x00,  //..%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1e, 0x00,  //...%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x0c, 0x00,  //....%%...
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x70, 0x00,  //.%%%.....
-  0x70, 0x00,  //.%%%.....
-
+  0xf5, 0x00, 0x1b, 0xc1, 0x80, 0x63, 0x00, 0x63, 0x00, 0x73, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x1e,
+  0x00, 0x1c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x70, 0x00, 0x70, 0x00,
 
   /*Unicode: U+007a (z) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x07, 0x00,  //.....%%%.
-  0x0e, 0x00,  //....%%%..
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x30, 0x00,  //..%%.....
-  0x70, 0x00,  //.%%%.....
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x13, 0xff, 0x80, 0xff, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x30,
+  0x00, 0x70, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+007b ({) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x0f,  //....%%%%
-  0x1f,  //...%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x38,  //..%%%...
-  0xf0,  //%%%%....
-  0xf0,  //%%%%....
-  0x38,  //..%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x1f,  //...%%%%%
-  0x0f,  //....%%%%
-  0x00,  //........
-
+  0x03, 0x00, 0x00, 0x0f, 0x1f, 0xfd, 0x18, 0x03, 0x38, 0xf0, 0xf0, 0x38, 0xfc, 0x18, 0x02, 0x1f,
+  0x0f, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-
+  0x01, 0x00, 0x00, 0xef, 0xc0,
 
   /*Unicode: U+007d (}) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0xf0,  //%%%%....
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x1c,  //...%%%..
-  0x0f,  //....%%%%
-  0x0f,  //....%%%%
-  0x1c,  //...%%%..
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xf8,  //%%%%%...
-  0xf0,  //%%%%....
-  0x00,  //........
-
+  0x03, 0x00, 0x00, 0xf0, 0xf8, 0xfd, 0x18, 0x03, 0x1c, 0x0f, 0x0f, 0x1c, 0xfc, 0x18, 0x02, 0xf8,
+  0xf0, 0x00,
 
   /*Unicode: U+007e (~) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x78, 0x80,  //.%%%%...%
-  0xff, 0x80,  //%%%%%%%%%
-  0x87, 0x00,  //%....%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
-
+  0xef, 0x00, 0x04, 0x78, 0x80, 0xff, 0x80, 0x87, 0xf0, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 2
   /*Unicode: U+0020 ( ) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xd9, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xf8, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0xf0, 0xfd, 0x00,
 
   /*Unicode: U+0022 (") , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xf0, 0xf0,  //@@..@@
-  0xf0, 0xf0,  //@@..@@
-  0xf0, 0xf0,  //@@..@@
-  0xf0, 0xf0,  //@@..@@
-  0xf0, 0xf0,  //@@..@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfb, 0x00, 0xf7, 0xf0, 0xe9, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x70, 0xe0,  //....+@..@%.
-  0x00, 0xb0, 0xd0,  //....%@..@+.
-  0x00, 0xe1, 0xc0,  //....@%.+@..
-  0x00, 0xd2, 0xc0,  //....@+.%@..
-  0x3f, 0xff, 0xfc,  //.@@@@@@@@@@
-  0x3f, 0xff, 0xfc,  //.@@@@@@@@@@
-  0x03, 0x83, 0x40,  //...@%..@+..
-  0x03, 0x4b, 0x00,  //...@+.%@...
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@.
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@.
-  0x0e, 0x0d, 0x00,  //..@%..@+...
-  0x0d, 0x1c, 0x00,  //..@+.+@....
-  0x1c, 0x2c, 0x00,  //.+@..%@....
-  0x2c, 0x38, 0x00,  //.%@..@%....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xfa, 0x00, 0x27, 0x70, 0xe0, 0x00, 0xb0, 0xd0, 0x00, 0xe1, 0xc0, 0x00, 0xd2, 0xc0, 0x3f, 0xff,
+  0xfc, 0x3f, 0xff, 0xfc, 0x03, 0x83, 0x40, 0x03, 0x4b, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+  0x0e, 0x0d, 0x00, 0x0d, 0x1c, 0x00, 0x1c, 0x2c, 0x00, 0x2c, 0x38, 0xf4, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0xc0, 0x00,  //....@....
-  0x00, 0xc0, 0x00,  //....@....
-  0x1b, 0xf8, 0x00,  //.+%@@@%..
-  0x7f, 0xff, 0x00,  //+@@@@@@@.
-  0xf8, 0xc7, 0x00,  //@@%.@.+@.
-  0xf0, 0xc0, 0x00,  //@@..@....
-  0xb4, 0xc0, 0x00,  //%@+.@....
-  0x2f, 0xd0, 0x00,  //.%@@@+...
-  0x01, 0xfe, 0x00,  //...+@@@%.
-  0x00, 0xc7, 0x80,  //....@.+@%
-  0x00, 0xc3, 0xc0,  //....@..@@
-  0xd0, 0xcb, 0xc0,  //@+..@.%@@
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0x2f, 0xf8, 0x00,  //.%@@@@%..
-  0x00, 0xc0, 0x00,  //....@....
-  0x00, 0xc0, 0x00,  //....@....
-  0x00, 0xc0, 0x00,  //....@....
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x30, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x1b, 0xf8, 0x00, 0x7f, 0xff, 0x00, 0xf8, 0xc7,
+  0x00, 0xf0, 0xc0, 0x00, 0xb4, 0xc0, 0x00, 0x2f, 0xd0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0xc7, 0x80,
+  0x00, 0xc3, 0xc0, 0xd0, 0xcb, 0xc0, 0xff, 0xff, 0x40, 0x2f, 0xf8, 0x00, 0x00, 0xc0, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x2f, 0x80, 0x00,  //.%@@%......
-  0xb5, 0xe0, 0x00,  //%@++@%.....
-  0xf0, 0xf0, 0x00,  //@@..@@.....
-  0xf0, 0xf0, 0x00,  //@@..@@.....
-  0xb5, 0xe0, 0x10,  //%@++@%...+.
-  0x2f, 0x86, 0xe0,  //.%@@%.+%@%.
-  0x01, 0xb9, 0x00,  //...+%@%+...
-  0x2e, 0x4b, 0xe0,  //.%@%+.%@@%.
-  0x10, 0x2d, 0x78,  //.+...%@++@%
-  0x00, 0x3c, 0x3c,  //.....@@..@@
-  0x00, 0x3c, 0x3c,  //.....@@..@@
-  0x00, 0x2d, 0x78,  //.....%@++@%
-  0x00, 0x0b, 0xe0,  //......%@@%.
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf8, 0x00, 0x26, 0x2f, 0x80, 0x00, 0xb5, 0xe0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xb5,
+  0xe0, 0x10, 0x2f, 0x86, 0xe0, 0x01, 0xb9, 0x00, 0x2e, 0x4b, 0xe0, 0x10, 0x2d, 0x78, 0x00, 0x3c,
+  0x3c, 0x00, 0x3c, 0x3c, 0x00, 0x2d, 0x78, 0x00, 0x0b, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x02, 0xff, 0x00,  //...%@@@@..
-  0x0b, 0xff, 0x00,  //..%@@@@@..
-  0x0f, 0x40, 0x00,  //..@@+.....
-  0x0f, 0x00, 0x00,  //..@@......
-  0x03, 0xc0, 0x00,  //...@@.....
-  0x0f, 0xe0, 0x00,  //..@@@%....
-  0x3d, 0xf0, 0xf0,  //.@@+@@..@@
-  0xb0, 0xbc, 0xf0,  //%@..%@@.@@
-  0xf0, 0x3e, 0xe0,  //@@...@@%@%
-  0xf4, 0x0f, 0xc0,  //@@+...@@@.
-  0xbd, 0x0b, 0x40,  //%@@+..%@+.
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@.
-  0x0b, 0xe2, 0xe0,  //..%@@%.%@%
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x26, 0x02, 0xff, 0x00, 0x0b, 0xff, 0x00, 0x0f, 0x40, 0x00, 0x0f, 0x00, 0x00, 0x03,
+  0xc0, 0x00, 0x0f, 0xe0, 0x00, 0x3d, 0xf0, 0xf0, 0xb0, 0xbc, 0xf0, 0xf0, 0x3e, 0xe0, 0xf4, 0x0f,
+  0xc0, 0xbd, 0x0b, 0x40, 0x3f, 0xfb, 0xc0, 0x0b, 0xe2, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xfc, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0028 (() , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x0b,  //..%@
-  0x0d,  //..@+
-  0x2c,  //.%@.
-  0x38,  //.@%.
-  0x74,  //+@+.
-  0xb0,  //%@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xb0,  //%@..
-  0x74,  //+@+.
-  0x38,  //.@%.
-  0x2c,  //.%@.
-  0x0d,  //..@+
-  0x0b,  //..%@
-  0x00,  //....
-  0x00,  //....
-
+  0x07, 0x00, 0x00, 0x0b, 0x0d, 0x2c, 0x38, 0x74, 0xb0, 0xfd, 0xf0, 0x07, 0xb0, 0x74, 0x38, 0x2c,
+  0x0d, 0x0b, 0x00, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xe0,  //@%..
-  0x70,  //+@..
-  0x38,  //.@%.
-  0x2c,  //.%@.
-  0x1d,  //.+@+
-  0x0e,  //..@%
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0e,  //..@%
-  0x1d,  //.+@+
-  0x2c,  //.%@.
-  0x38,  //.@%.
-  0x70,  //+@..
-  0xe0,  //@%..
-  0x00,  //....
-  0x00,  //....
-
+  0x07, 0x00, 0x00, 0xe0, 0x70, 0x38, 0x2c, 0x1d, 0x0e, 0xfd, 0x0f, 0x07, 0x0e, 0x1d, 0x2c, 0x38,
+  0x70, 0xe0, 0x00, 0x00,
 
   /*Unicode: U+002a (*) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x03, 0x00,  //...@...
-  0x83, 0x08,  //%..@..%
-  0x77, 0x74,  //+@+@+@+
-  0x0f, 0xc0,  //..@@@..
-  0x0f, 0xc0,  //..@@@..
-  0x77, 0x74,  //+@+@+@+
-  0x83, 0x08,  //%..@..%
-  0x03, 0x00,  //...@...
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x0e, 0x03, 0x00, 0x83, 0x08, 0x77, 0x74, 0x0f, 0xc0, 0x0f, 0xc0, 0x77, 0x74, 0x83,
+  0x08, 0x03, 0xee, 0x00,
 
   /*Unicode: U+002b (+) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf1, 0x00, 0x1b, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff,
+  0xf0, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf1,
+  0x00,
 
   /*Unicode: U+002c (,) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x3c,  //.@@
-  0x3c,  //.@@
-  0x38,  //.@%
-  0xb0,  //%@.
-  0xd0,  //@+.
-  0x00,  //...
-  0x00,  //...
-
+  0xf4, 0x00, 0x06, 0x3c, 0x3c, 0x38, 0xb0, 0xd0, 0x00, 0x00,
 
   /*Unicode: U+002d (-) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xed, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0xf1, 0x00,
 
   /*Unicode: U+002e (.) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf4, 0x00, 0xfe, 0xf0, 0xfd, 0x00,
 
   /*Unicode: U+002f (/) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x0b, 0x40,  //......%@+
-  0x00, 0x0f, 0x00,  //......@@.
-  0x00, 0x2d, 0x00,  //.....%@+.
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0xb4, 0x00,  //....%@+..
-  0x00, 0xf0, 0x00,  //....@@...
-  0x01, 0xd0, 0x00,  //...+@+...
-  0x03, 0xc0, 0x00,  //...@@....
-  0x07, 0x80, 0x00,  //..+@%....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x1e, 0x00, 0x00,  //.+@%.....
-  0x3c, 0x00, 0x00,  //.@@......
-  0x78, 0x00, 0x00,  //+@%......
-  0xf0, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x29, 0x03, 0xc0, 0x00, 0x0b, 0x40, 0x00, 0x0f, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x3c,
+  0x00, 0x00, 0xb4, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xd0, 0x00, 0x03, 0xc0, 0x00, 0x07, 0x80, 0x00,
+  0x0f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf0, 0xf9, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x2f, 0xfe, 0x00,  //.%@@@@@%.
-  0x7d, 0x1f, 0x40,  //+@@+.+@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7d, 0x1f, 0x40,  //+@@+.+@@+
-  0x2f, 0xfe, 0x00,  //.%@@@@@%.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x2f, 0xfe, 0x00, 0x7d, 0x1f, 0x40, 0xb4, 0x07, 0x80, 0xf0,
+  0x03, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07,
+  0x80, 0x7d, 0x1f, 0x40, 0x2f, 0xfe, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x1f, 0xc0,  //.+@@@...
-  0xff, 0xc0,  //@@@@@...
-  0xd3, 0xc0,  //@+.@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfb, 0x00, 0x15, 0x1f, 0xc0, 0xff, 0xc0, 0xd3, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x2f, 0xf8, 0x00,  //.%@@@@%...
-  0xff, 0xff, 0x00,  //@@@@@@@@..
-  0xd0, 0x0f, 0xc0,  //@+....@@@.
-  0x00, 0x03, 0xc0,  //.......@@.
-  0x00, 0x03, 0xc0,  //.......@@.
-  0x00, 0x0b, 0xc0,  //......%@@.
-  0x00, 0x1f, 0x40,  //.....+@@+.
-  0x00, 0xbd, 0x00,  //....%@@+..
-  0x03, 0xf4, 0x00,  //...@@@+...
-  0x0f, 0x80, 0x00,  //..@@%.....
-  0x7c, 0x00, 0x00,  //+@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@.
-  0xff, 0xff, 0xc0,  //@@@@@@@@@.
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x26, 0x2f, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xd0, 0x0f, 0xc0, 0x00, 0x03, 0xc0, 0x00,
+  0x03, 0xc0, 0x00, 0x0b, 0xc0, 0x00, 0x1f, 0x40, 0x00, 0xbd, 0x00, 0x03, 0xf4, 0x00, 0x0f, 0x80,
+  0x00, 0x7c, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2f, 0xf8, 0x00,  //.%@@@@%..
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xd0, 0x0b, 0xc0,  //@+....%@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x0b, 0x80,  //......%@%
-  0x0f, 0xfe, 0x00,  //..@@@@@%.
-  0x0f, 0xfd, 0x00,  //..@@@@@+.
-  0x00, 0x1f, 0x40,  //.....+@@+
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0xd0, 0x1f, 0xc0,  //@+...+@@@
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0x2f, 0xf8, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x2f, 0xf8, 0x00, 0xff, 0xff, 0x40, 0xd0, 0x0b, 0xc0, 0x00, 0x03, 0xc0, 0x00,
+  0x0b, 0x80, 0x0f, 0xfe, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x03, 0xc0, 0x00, 0x03,
+  0xc0, 0xd0, 0x1f, 0xc0, 0xff, 0xff, 0x00, 0x2f, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x7c, 0x00,  //....+@@..
-  0x00, 0xfc, 0x00,  //....@@@..
-  0x01, 0xfc, 0x00,  //...+@@@..
-  0x03, 0x3c, 0x00,  //...@.@@..
-  0x0a, 0x3c, 0x00,  //..%%.@@..
-  0x1c, 0x3c, 0x00,  //.+@..@@..
-  0x38, 0x3c, 0x00,  //.@%..@@..
-  0xb0, 0x3c, 0x00,  //%@...@@..
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x24, 0x7c, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x03, 0x3c, 0x00, 0x0a, 0x3c,
+  0x00, 0x1c, 0x3c, 0x00, 0x38, 0x3c, 0x00, 0xb0, 0x3c, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0xf4, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3c, 0x00, 0x00,  //.@@......
-  0x3c, 0x00, 0x00,  //.@@......
-  0x3f, 0xf8, 0x00,  //.@@@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x20, 0x1f, 0x80,  //.%...+@@%
-  0x00, 0x07, 0xc0,  //......+@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x07, 0xc0,  //......+@@
-  0xd0, 0x1f, 0x80,  //@+...+@@%
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0x6f, 0xf4, 0x00,  //+%@@@@+..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x3f,
+  0xf8, 0x00, 0x3f, 0xff, 0x00, 0x20, 0x1f, 0x80, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x07,
+  0xc0, 0xd0, 0x1f, 0x80, 0xff, 0xff, 0x00, 0x6f, 0xf4, 0xf4, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x06, 0xfd, 0x00,  //..+%@@@+.
-  0x1f, 0xff, 0x00,  //.+@@@@@@.
-  0x3e, 0x02, 0x00,  //.@@%...%.
-  0xbc, 0x00, 0x00,  //%@@......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xf2, 0xfd, 0x00,  //@@.%@@@+.
-  0xfb, 0xff, 0x40,  //@@%@@@@@+
-  0xf8, 0x0b, 0xc0,  //@@%...%@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb0, 0x03, 0xc0,  //%@.....@@
-  0x78, 0x0b, 0x80,  //+@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x06, 0xfd, 0x00, 0x1f, 0xff, 0x00, 0x3e, 0x02, 0x00, 0xbc, 0x00, 0x00, 0xf4,
+  0x00, 0x00, 0xf2, 0xfd, 0x00, 0xfb, 0xff, 0x40, 0xf8, 0x0b, 0xc0, 0xf0, 0x03, 0xc0, 0xb0, 0x03,
+  0xc0, 0x78, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0x80,  //@@@@@@@@%
-  0x00, 0x0f, 0x40,  //......@@+
-  0x00, 0x0f, 0x00,  //......@@.
-  0x00, 0x2e, 0x00,  //.....%@%.
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0x78, 0x00,  //....+@%..
-  0x00, 0xf4, 0x00,  //....@@+..
-  0x00, 0xf0, 0x00,  //....@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xc0, 0x00,  //...@@....
-  0x07, 0xc0, 0x00,  //..+@@....
-  0x0f, 0x40, 0x00,  //..@@+....
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x80, 0x00, 0x0f, 0x40, 0x00, 0x0f, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf0, 0x00, 0x02, 0xe0,
+  0x00, 0x03, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x0f, 0x40, 0xf4, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x1b, 0xf9, 0x00,  //.+%@@@%+.
-  0x7f, 0xff, 0x40,  //+@@@@@@@+
-  0xf8, 0x0b, 0xc0,  //@@%...%@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x1f, 0xfd, 0x00,  //.+@@@@@+.
-  0x2f, 0xfe, 0x00,  //.%@@@@@%.
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf8, 0x0b, 0xc0,  //@@%...%@@
-  0x7f, 0xff, 0x40,  //+@@@@@@@+
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x1b, 0xf9, 0x00, 0x7f, 0xff, 0x40, 0xf8, 0x0b, 0xc0, 0xf0, 0x03, 0xc0, 0xb8,
+  0x0b, 0x80, 0x1f, 0xfd, 0x00, 0x2f, 0xfe, 0x00, 0xb8, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf8, 0x0b, 0xc0, 0x7f, 0xff, 0x40, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xf8, 0x0b, 0x40,  //@@%...%@+
-  0xf0, 0x03, 0x80,  //@@.....@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf8, 0x0b, 0xc0,  //@@%...%@@
-  0x7f, 0xfb, 0xc0,  //+@@@@@%@@
-  0x1f, 0xe3, 0xc0,  //.+@@@%.@@
-  0x00, 0x07, 0xc0,  //......+@@
-  0x00, 0x0f, 0x80,  //......@@%
-  0x20, 0x2f, 0x00,  //.%...%@@.
-  0x3f, 0xfd, 0x00,  //.@@@@@@+.
-  0x1f, 0xe4, 0x00,  //.+@@@%+..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0xf8, 0x0b, 0x40, 0xf0, 0x03, 0x80, 0xf0,
+  0x03, 0xc0, 0xf8, 0x0b, 0xc0, 0x7f, 0xfb, 0xc0, 0x1f, 0xe3, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x0f,
+  0x80, 0x20, 0x2f, 0x00, 0x3f, 0xfd, 0x00, 0x1f, 0xe4, 0xf4, 0x00,
 
   /*Unicode: U+003a (:) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfa, 0x00, 0xfe, 0xf0, 0xfe, 0x00, 0xfe, 0xf0, 0xfd, 0x00,
 
   /*Unicode: U+003b (;) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x3c,  //.@@
-  0x3c,  //.@@
-  0x3c,  //.@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x3c,  //.@@
-  0x3c,  //.@@
-  0x38,  //.@%
-  0xb0,  //%@.
-  0xd0,  //@+.
-  0x00,  //...
-  0x00,  //...
-
+  0xfa, 0x00, 0xfe, 0x3c, 0xfe, 0x00, 0x06, 0x3c, 0x3c, 0x38, 0xb0, 0xd0, 0x00, 0x00,
 
   /*Unicode: U+003c (<) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x01, 0xc0,  //.......+@
-  0x00, 0x2f, 0xc0,  //.....%@@@
-  0x06, 0xf8, 0x00,  //..+%@@%..
-  0x7f, 0x40, 0x00,  //+@@@+....
-  0xf4, 0x00, 0x00,  //@@+......
-  0x7f, 0x40, 0x00,  //+@@@+....
-  0x06, 0xf8, 0x00,  //..+%@@%..
-  0x00, 0x2f, 0xc0,  //.....%@@@
-  0x00, 0x01, 0xc0,  //.......+@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x19, 0x01, 0xc0, 0x00, 0x2f, 0xc0, 0x06, 0xf8, 0x00, 0x7f, 0x40, 0x00, 0xf4, 0x00,
+  0x00, 0x7f, 0x40, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x2f, 0xc0, 0x00, 0x01, 0xc0, 0xf2, 0x00,
 
   /*Unicode: U+003d (=) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x05, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xfb, 0x00, 0x05, 0xff, 0xff, 0xc0, 0xff,
+  0xff, 0xc0, 0xec, 0x00,
 
   /*Unicode: U+003e (>) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xd0, 0x00, 0x00,  //@+.......
-  0xfe, 0x00, 0x00,  //@@@%.....
-  0x0b, 0xe4, 0x00,  //..%@@%+..
-  0x00, 0x7f, 0x40,  //....+@@@+
-  0x00, 0x07, 0xc0,  //......+@@
-  0x00, 0x7f, 0x40,  //....+@@@+
-  0x0b, 0xe4, 0x00,  //..%@@%+..
-  0xfe, 0x00, 0x00,  //@@@%.....
-  0xd0, 0x00, 0x00,  //@+.......
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x18, 0xd0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x0b, 0xe4, 0x00, 0x00, 0x7f, 0x40, 0x00,
+  0x07, 0xc0, 0x00, 0x7f, 0x40, 0x0b, 0xe4, 0x00, 0xfe, 0x00, 0x00, 0xd0, 0xf0, 0x00,
 
   /*Unicode: U+003f (?) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x6f, 0xd0,  //+%@@@+.
-  0xff, 0xf4,  //@@@@@@+
-  0x90, 0x3c,  //%+...@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0xf8,  //....@@%
-  0x03, 0xf0,  //...@@@.
-  0x0b, 0xc0,  //..%@@..
-  0x0f, 0x00,  //..@@...
-  0x0f, 0x00,  //..@@...
-  0x0f, 0x00,  //..@@...
-  0x00, 0x00,  //.......
-  0x0f, 0x00,  //..@@...
-  0x0f, 0x00,  //..@@...
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x12, 0x6f, 0xd0, 0xff, 0xf4, 0x90, 0x3c, 0x00, 0x3c, 0x00, 0xf8, 0x03, 0xf0, 0x0b,
+  0xc0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xfe, 0x00, 0x02, 0x0f, 0x00, 0x0f, 0xf8, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xfd, 0x00,  //...%@@@+.
-  0x0e, 0x0b, 0x40,  //..@%..%@+
-  0x3c, 0x03, 0xc0,  //.@@....@@
-  0x78, 0x3b, 0xc0,  //+@%..@%@@
-  0xb4, 0xb7, 0xc0,  //%@+.%@+@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0xf3, 0xc0,  //@@..@@.@@
-  0xf0, 0xb7, 0xc0,  //@@..%@+@@
-  0xb4, 0x3b, 0xc0,  //%@+..@%@@
-  0x78, 0x00, 0x00,  //+@%......
-  0x3c, 0x00, 0x00,  //.@@......
-  0x0f, 0x40, 0x00,  //..@@+....
-  0x02, 0xfc, 0x00,  //...%@@@..
-  0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x2b, 0x02, 0xfd, 0x00, 0x0e, 0x0b, 0x40, 0x3c, 0x03, 0xc0, 0x78, 0x3b, 0xc0, 0xb4,
+  0xb7, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0xf3, 0xc0, 0xf0, 0xb7,
+  0xc0, 0xb4, 0x3b, 0xc0, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x02, 0xfc, 0xfd,
+  0x00,
 
   /*Unicode: U+0041 (A) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b,
+  0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff,
+  0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xf9, 0x00,  //@@@@@@%+.
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xf0, 0x0b, 0xc0,  //@@....%@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x0b, 0x80,  //@@....%@%
-  0xff, 0xfe, 0x00,  //@@@@@@@%.
-  0xff, 0xfe, 0x00,  //@@@@@@@%.
-  0xf0, 0x0b, 0x80,  //@@....%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x0b, 0xc0,  //@@....%@@
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xff, 0xf9, 0x00,  //@@@@@@%+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0xff, 0xf9, 0x00, 0xff, 0xff, 0x40, 0xf0, 0x0b, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x0b, 0x80, 0xff, 0xfe, 0x00, 0xff, 0xfe, 0x00, 0xf0, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x0b, 0xc0, 0xff, 0xff, 0x40, 0xff, 0xf9, 0xf4, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xfe, 0x40,  //...%@@@%+
-  0x1f, 0xff, 0xc0,  //.+@@@@@@@
-  0x3e, 0x01, 0xc0,  //.@@%...+@
-  0x78, 0x00, 0x00,  //+@%......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xb8, 0x00, 0x00,  //%@%......
-  0x3e, 0x01, 0xc0,  //.@@%...+@
-  0x1f, 0xff, 0xc0,  //.+@@@@@@@
-  0x02, 0xfe, 0x40,  //...%@@@%+
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0x02, 0xfe, 0x40, 0x1f, 0xff, 0xc0, 0x3e, 0x01, 0xc0, 0x78, 0x00, 0x00, 0xf4,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xb8, 0x00,
+  0x00, 0x3e, 0x01, 0xc0, 0x1f, 0xff, 0xc0, 0x02, 0xfe, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xe0, 0x00,  //@@@@@%...
-  0xff, 0xfd, 0x00,  //@@@@@@@+.
-  0xf0, 0x2f, 0x00,  //@@...%@@.
-  0xf0, 0x0b, 0x80,  //@@....%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x0b, 0x80,  //@@....%@%
-  0xf0, 0x2f, 0x00,  //@@...%@@.
-  0xff, 0xfd, 0x00,  //@@@@@@@+.
-  0xff, 0xe0, 0x00,  //@@@@@%...
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0xff, 0xe0, 0x00, 0xff, 0xfd, 0x00, 0xf0, 0x2f, 0x00, 0xf0, 0x0b, 0x80, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x0b,
+  0x80, 0xf0, 0x2f, 0x00, 0xff, 0xfd, 0x00, 0xff, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x24, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf3, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xfe, 0x40,  //...%@@@%+
-  0x1f, 0xff, 0xc0,  //.+@@@@@@@
-  0x3e, 0x01, 0x80,  //.@@%...+%
-  0x78, 0x00, 0x00,  //+@%......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xf0, 0x3f, 0xc0,  //@@...@@@@
-  0xf0, 0x3f, 0xc0,  //@@...@@@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x03, 0xc0,  //%@%....@@
-  0x3d, 0x07, 0xc0,  //.@@+..+@@
-  0x1f, 0xff, 0x80,  //.+@@@@@@%
-  0x02, 0xfd, 0x00,  //...%@@@+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x02, 0xfe, 0x40, 0x1f, 0xff, 0xc0, 0x3e, 0x01, 0x80, 0x78, 0x00, 0x00, 0xf4,
+  0x00, 0x00, 0xf0, 0x3f, 0xc0, 0xf0, 0x3f, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb8, 0x03,
+  0xc0, 0x3d, 0x07, 0xc0, 0x1f, 0xff, 0x80, 0x02, 0xfd, 0xf4, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfb, 0x00, 0xfd, 0xff, 0x11, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+004a (J) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x0f, 0xfc,  //..@@@@@
-  0x0f, 0xfc,  //..@@@@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x90, 0xbc,  //%+..%@@
-  0xff, 0xf4,  //@@@@@@+
-  0x6f, 0xd0,  //+%@@@+.
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x19, 0x0f, 0xfc, 0x0f, 0xfc, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+  0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x90, 0xbc, 0xff, 0xf4, 0x6f, 0xd0, 0xf9, 0x00,
 
   /*Unicode: U+004b (K) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x0f, 0x00,  //@@....@@..
-  0xf0, 0x3d, 0x00,  //@@...@@+..
-  0xf0, 0xf4, 0x00,  //@@..@@+...
-  0xf2, 0xd0, 0x00,  //@@.%@+....
-  0xfb, 0x80, 0x00,  //@@%@%.....
-  0xff, 0xd0, 0x00,  //@@@@@+....
-  0xf5, 0xf0, 0x00,  //@@++@@....
-  0xf0, 0xb8, 0x00,  //@@..%@%...
-  0xf0, 0x3d, 0x00,  //@@...@@+..
-  0xf0, 0x1f, 0x00,  //@@...+@@..
-  0xf0, 0x0b, 0x80,  //@@....%@%.
-  0xf0, 0x03, 0xd0,  //@@.....@@+
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x26, 0xf0, 0x03, 0xc0, 0xf0, 0x0f, 0x00, 0xf0, 0x3d, 0x00, 0xf0, 0xf4, 0x00, 0xf2,
+  0xd0, 0x00, 0xfb, 0x80, 0x00, 0xff, 0xd0, 0x00, 0xf5, 0xf0, 0x00, 0xf0, 0xb8, 0x00, 0xf0, 0x3d,
+  0x00, 0xf0, 0x1f, 0x00, 0xf0, 0x0b, 0x80, 0xf0, 0x03, 0xd0, 0xf5, 0x00,
 
   /*Unicode: U+004c (L) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+004d (M) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xfc, 0x0f, 0xc0,  //@@@...@@@
-  0xfc, 0x0f, 0xc0,  //@@@...@@@
-  0xfd, 0x1f, 0xc0,  //@@@+.+@@@
-  0xfa, 0x2b, 0xc0,  //@@%%.%%@@
-  0xf3, 0x33, 0xc0,  //@@.@.@.@@
-  0xf3, 0xb3, 0xc0,  //@@.@%@.@@
-  0xf2, 0xe3, 0xc0,  //@@.%@%.@@
-  0xf1, 0xd3, 0xc0,  //@@.+@+.@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xfc, 0x0f, 0xc0, 0xfc, 0x0f, 0xc0, 0xfd, 0x1f, 0xc0, 0xfa, 0x2b, 0xc0, 0xf3,
+  0x33, 0xc0, 0xf3, 0xb3, 0xc0, 0xf2, 0xe3, 0xc0, 0xf1, 0xd3, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+004e (N) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xfc, 0x03, 0xc0,  //@@@....@@
-  0xfc, 0x03, 0xc0,  //@@@....@@
-  0xfe, 0x03, 0xc0,  //@@@%...@@
-  0xf7, 0x03, 0xc0,  //@@+@...@@
-  0xf3, 0x43, 0xc0,  //@@.@+..@@
-  0xf2, 0xc3, 0xc0,  //@@.%@..@@
-  0xf1, 0xc3, 0xc0,  //@@.+@..@@
-  0xf0, 0xe3, 0xc0,  //@@..@%.@@
-  0xf0, 0x73, 0xc0,  //@@..+@.@@
-  0xf0, 0x37, 0xc0,  //@@...@+@@
-  0xf0, 0x2f, 0xc0,  //@@...%@@@
-  0xf0, 0x0f, 0xc0,  //@@....@@@
-  0xf0, 0x0f, 0xc0,  //@@....@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xfc, 0x03, 0xc0, 0xfc, 0x03, 0xc0, 0xfe, 0x03, 0xc0, 0xf7, 0x03, 0xc0, 0xf3,
+  0x43, 0xc0, 0xf2, 0xc3, 0xc0, 0xf1, 0xc3, 0xc0, 0xf0, 0xe3, 0xc0, 0xf0, 0x73, 0xc0, 0xf0, 0x37,
+  0xc0, 0xf0, 0x2f, 0xc0, 0xf0, 0x0f, 0xc0, 0xf0, 0x0f, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+004f (O) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07,
+  0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xf8, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xf0, 0x0f, 0x80,  //@@....@@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x0f, 0x80,  //@@....@@%
-  0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0xf8, 0x00,  //@@@@@@%..
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x24, 0xff, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x0f, 0x80, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x0f, 0x80, 0xff, 0xff, 0x00, 0xff, 0xf8, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf3, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x00,  //+@@...@@.
-  0x3f, 0xfe, 0x00,  //.@@@@@@%.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x2e, 0x00,  //.....%@%.
-  0x00, 0x0a, 0x00,  //......%%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x2b, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07,
+  0x80, 0x7c, 0x0f, 0x00, 0x3f, 0xfe, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x0a, 0xfa,
+  0x00,
 
   /*Unicode: U+0052 (R) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xff, 0xf8, 0x00,  //@@@@@@%...
-  0xff, 0xff, 0x00,  //@@@@@@@@..
-  0xf0, 0x0f, 0xc0,  //@@....@@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x0b, 0x80,  //@@....%@%.
-  0xff, 0xfe, 0x00,  //@@@@@@@%..
-  0xff, 0xfc, 0x00,  //@@@@@@@...
-  0xf0, 0x2f, 0x00,  //@@...%@@..
-  0xf0, 0x0b, 0x40,  //@@....%@+.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xd0,  //@@.....@@+
-  0xf0, 0x01, 0xf0,  //@@.....+@@
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x26, 0xff, 0xf8, 0x00, 0xff, 0xff, 0x00, 0xf0, 0x0f, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x0b, 0x80, 0xff, 0xfe, 0x00, 0xff, 0xfc, 0x00, 0xf0, 0x2f, 0x00, 0xf0, 0x0b,
+  0x40, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xd0, 0xf0, 0x01, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xf8, 0x06, 0x00,  //@@%...+%.
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf8, 0x00, 0x00,  //@@%......
-  0x7f, 0xe4, 0x00,  //+@@@@%+..
-  0x1b, 0xff, 0x00,  //.+%@@@@@.
-  0x00, 0x1f, 0x80,  //.....+@@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0xd0, 0x0f, 0xc0,  //@+....@@@
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0x2f, 0xf8, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0xf8, 0x06, 0x00, 0xf0, 0x00, 0x00, 0xf8,
+  0x00, 0x00, 0x7f, 0xe4, 0x00, 0x1b, 0xff, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x03, 0xc0, 0x00, 0x03,
+  0xc0, 0xd0, 0x0f, 0xc0, 0xff, 0xff, 0x40, 0x2f, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x25, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf4, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xb8, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x78, 0x0f, 0x40,  //+@%...@@+
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x3d, 0x1f, 0x00,  //.@@+.+@@.
-  0x2e, 0x2e, 0x00,  //.%@%.%@%.
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0b, 0xb8, 0x00,  //..%@%@%..
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x78, 0x0f, 0x40, 0x3c, 0x0f, 0x00, 0x3d,
+  0x1f, 0x00, 0x2e, 0x2e, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0xb8, 0x00, 0x07, 0xf4,
+  0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x02, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xf0, 0x00, 0x3c,  //@@.......@@
-  0xf0, 0x00, 0x3c,  //@@.......@@
-  0xb4, 0x00, 0x78,  //%@+.....+@%
-  0x78, 0x00, 0xb4,  //+@%.....%@+
-  0x78, 0xb8, 0xb4,  //+@%.%@%.%@+
-  0x3c, 0xfc, 0xf0,  //.@@.@@@.@@.
-  0x3c, 0xec, 0xf0,  //.@@.@%@.@@.
-  0x3d, 0xcd, 0xf0,  //.@@+@.@+@@.
-  0x2f, 0xcf, 0xe0,  //.%@@@.@@@%.
-  0x2f, 0x8b, 0xe0,  //.%@@%.%@@%.
-  0x1f, 0x47, 0xd0,  //.+@@+.+@@+.
-  0x0f, 0x03, 0xc0,  //..@@...@@..
-  0x0f, 0x03, 0xc0,  //..@@...@@..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf8, 0x00, 0x26, 0xf0, 0x00, 0x3c, 0xf0, 0x00, 0x3c, 0xb4, 0x00, 0x78, 0x78, 0x00, 0xb4, 0x78,
+  0xb8, 0xb4, 0x3c, 0xfc, 0xf0, 0x3c, 0xec, 0xf0, 0x3d, 0xcd, 0xf0, 0x2f, 0xcf, 0xe0, 0x2f, 0x8b,
+  0xe0, 0x1f, 0x47, 0xd0, 0x0f, 0x03, 0xc0, 0x0f, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x2f, 0x3d, 0x00,  //.%@@.@@+.
-  0x0f, 0xbc, 0x00,  //..@@%@@..
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x03, 0xe0, 0x00,  //...@@%...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x2e, 0x2e, 0x00,  //.%@%.%@%.
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xb8, 0x0b, 0x80, 0x3c, 0x0f, 0x00, 0x2f, 0x3d, 0x00, 0x0f, 0xbc, 0x00, 0x07,
+  0xf4, 0x00, 0x03, 0xe0, 0x00, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c,
+  0x00, 0x2e, 0x2e, 0x00, 0x3c, 0x0f, 0x00, 0xb8, 0x0b, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xb8, 0x02, 0xe0,  //%@%....%@%
-  0x3c, 0x03, 0xc0,  //.@@....@@.
-  0x2e, 0x0b, 0x80,  //.%@%..%@%.
-  0x0f, 0x0f, 0x00,  //..@@..@@..
-  0x07, 0xfd, 0x00,  //..+@@@@+..
-  0x03, 0xfc, 0x00,  //...@@@@...
-  0x01, 0xf4, 0x00,  //...+@@+...
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x25, 0xb8, 0x02, 0xe0, 0x3c, 0x03, 0xc0, 0x2e, 0x0b, 0x80, 0x0f, 0x0f, 0x00, 0x07,
+  0xfd, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf4, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x0f, 0x00,  //......@@.
-  0x00, 0x2e, 0x00,  //.....%@%.
-  0x00, 0x7c, 0x00,  //....+@@..
-  0x00, 0xf4, 0x00,  //....@@+..
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x07, 0xc0, 0x00,  //..+@@....
-  0x0f, 0x80, 0x00,  //..@@%....
-  0x2f, 0x00, 0x00,  //.%@@.....
-  0x3d, 0x00, 0x00,  //.@@+.....
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x2e, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0xf4, 0x00, 0x02, 0xe0, 0x00, 0x07, 0xc0, 0x00, 0x0f, 0x80, 0x00, 0x2f, 0x00,
+  0x00, 0x3d, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+005b ([) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0xff,  //@@@@
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0xff,  //@@@@
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xf5, 0xf0, 0x03, 0xff, 0xff, 0x00, 0x00,
 
   /*Unicode: U+005c (\) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0x78, 0x00, 0x00,  //+@%......
-  0x3c, 0x00, 0x00,  //.@@......
-  0x1e, 0x00, 0x00,  //.+@%.....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x07, 0x80, 0x00,  //..+@%....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x01, 0xd0, 0x00,  //...+@+...
-  0x00, 0xf0, 0x00,  //....@@...
-  0x00, 0xb4, 0x00,  //....%@+..
-  0x00, 0x3c, 0x00,  //.....@@..
-  0x00, 0x2d, 0x00,  //.....%@+.
-  0x00, 0x0f, 0x00,  //......@@.
-  0x00, 0x0b, 0x40,  //......%@+
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x2c, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xc0, 0x00, 0x01, 0xd0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xb4,
+  0x00, 0x00, 0x3c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x03, 0xc0,
+  0xfb, 0x00,
 
   /*Unicode: U+005d (]) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0xff,  //@@@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0x0f,  //..@@
-  0xff,  //@@@@
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xf5, 0x0f, 0x03, 0xff, 0xff, 0x00, 0x00,
 
   /*Unicode: U+005e (^) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xf0, 0x00,  //....@@....
-  0x03, 0xfc, 0x00,  //...@@@@...
-  0x0f, 0x0f, 0x00,  //..@@..@@..
-  0x2c, 0x03, 0x80,  //.%@....@%.
-  0xb0, 0x00, 0xe0,  //%@......@%
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x0d, 0xf0, 0x00, 0x03, 0xfc, 0x00, 0x0f, 0x0f, 0x00, 0x2c, 0x03, 0x80, 0xb0, 0x00,
+  0xe0, 0xdd, 0x00,
 
   /*Unicode: U+005f (_) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-
+  0xcb, 0x00, 0x05, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc,
 
   /*Unicode: U+0060 (`) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0xb0,  //%@..
-  0x2c,  //.%@.
-  0x0a,  //..%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x04, 0x00, 0x00, 0xb0, 0x2c, 0x0a, 0xf2, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b,
+  0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xf4, 0x03, 0xc0, 0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x28, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf2,
+  0xf8, 0x00, 0xfb, 0xff, 0x00, 0xfc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf4, 0x07, 0xc0, 0xfc, 0x0f, 0x80, 0xfb, 0xff, 0x00, 0xf2, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x07, 0xf9,  //..+@@@%+
-  0x2f, 0xff,  //.%@@@@@@
-  0x7d, 0x02,  //+@@+...%
-  0xf4, 0x00,  //@@+.....
-  0xf0, 0x00,  //@@......
-  0xf0, 0x00,  //@@......
-  0xf4, 0x00,  //@@+.....
-  0x7d, 0x02,  //+@@+...%
-  0x2f, 0xff,  //.%@@@@@@
-  0x07, 0xfd,  //..+@@@@+
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x13, 0x07, 0xf9, 0x2f, 0xff, 0x7d, 0x02, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+  0x00, 0x7d, 0x02, 0x2f, 0xff, 0x07, 0xfd, 0xf9, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x28, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x0b, 0xe3,
+  0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x2f, 0xff, 0x00,  //.%@@@@@@.
-  0x7c, 0x0b, 0x80,  //+@@...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0x7d, 0x01, 0xc0,  //+@@+...+@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0x07, 0xfe, 0x00,  //..+@@@@%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1c, 0x07, 0xf8, 0x00, 0x2f, 0xff, 0x00, 0x7c, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xff,
+  0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x00, 0x7d, 0x01, 0xc0, 0x2f, 0xff, 0xc0, 0x07, 0xfe,
+  0xf4, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0xbf,  //....%@@@
-  0x02, 0xff,  //...%@@@@
-  0x03, 0xd0,  //...@@+..
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfc, 0x00, 0x06, 0xbf, 0x02, 0xff, 0x03, 0xd0, 0x03, 0xc0, 0xfd, 0xff, 0x0f, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x34, 0x0f, 0x80,  //.@+...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-
+  0xef, 0x00, 0x29, 0x0b, 0xe3, 0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3,
+  0xc0, 0x00, 0x03, 0xc0, 0x34, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf1, 0xfd, 0x00,  //@@.+@@@+.
-  0xf7, 0xff, 0x40,  //@@+@@@@@+
-  0xfd, 0x0b, 0xc0,  //@@@+..%@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x29, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf1,
+  0xfd, 0x00, 0xf7, 0xff, 0x40, 0xfd, 0x0b, 0xc0, 0xf4, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0x03, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0,
+  0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+006a (j) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x3f, 0xf0,  //.@@@@@
-  0x3f, 0xf0,  //.@@@@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x00, 0xf0,  //....@@
-  0x02, 0xf0,  //...%@@
-  0xff, 0xd0,  //@@@@@+
-  0xff, 0x40,  //@@@@+.
-
+  0xfc, 0x00, 0x02, 0xf0, 0x00, 0xf0, 0xfd, 0x00, 0x1b, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0xf0, 0x00,
+  0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x02,
+  0xf0, 0xff, 0xd0, 0xff, 0x40,
 
   /*Unicode: U+006b (k) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x0f, 0x80,  //@@....@@%.
-  0xf0, 0x7e, 0x00,  //@@..+@@%..
-  0xf1, 0xf8, 0x00,  //@@.+@@%...
-  0xf7, 0xe0, 0x00,  //@@+@@%....
-  0xff, 0xc0, 0x00,  //@@@@@.....
-  0xff, 0xe0, 0x00,  //@@@@@%....
-  0xf4, 0xf4, 0x00,  //@@+.@@+...
-  0xf0, 0x7c, 0x00,  //@@..+@@...
-  0xf0, 0x2f, 0x00,  //@@...%@@..
-  0xf0, 0x0f, 0x80,  //@@....@@%.
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x29, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0,
+  0x0f, 0x80, 0xf0, 0x7e, 0x00, 0xf1, 0xf8, 0x00, 0xf7, 0xe0, 0x00, 0xff, 0xc0, 0x00, 0xff, 0xe0,
+  0x00, 0xf4, 0xf4, 0x00, 0xf0, 0x7c, 0x00, 0xf0, 0x2f, 0x00, 0xf0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+006c (l) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xd0,  //...@@+..
-  0x01, 0xff,  //...+@@@@
-  0x00, 0xbf,  //....%@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0x1b, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xd0, 0x01, 0xff, 0x00, 0xbf, 0xf9,
+  0x00,
 
   /*Unicode: U+006d (m) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xf7, 0xcb, 0xc0,  //@@+@@.%@@.
-  0xff, 0xef, 0xe0,  //@@@@@%@@@%
-  0xf5, 0xf5, 0xf0,  //@@++@@++@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0xf0, 0xf0, 0xf0,  //@@..@@..@@
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xef, 0x00, 0x07, 0xf7, 0xcb, 0xc0, 0xff, 0xef, 0xe0, 0xf5, 0xf5, 0xeb, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+006e (n) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf1, 0xfd, 0x00,  //@@.+@@@+.
-  0xf7, 0xff, 0x40,  //@@+@@@@@+
-  0xfd, 0x0b, 0xc0,  //@@@+..%@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0xf1, 0xfd, 0x00, 0xf7, 0xff, 0x40, 0xfd, 0x0b, 0xc0, 0xf4, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+006f (o) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1c, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8,
+  0xf4, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-
+  0xef, 0x00, 0x29, 0xf2, 0xf8, 0x00, 0xfb, 0xff, 0x00, 0xfc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xfc, 0x0f, 0x80, 0xfb, 0xff, 0x00, 0xf2, 0xf8,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0xc0,  //%@@...@@@
-  0x3f, 0xfb, 0xc0,  //.@@@@@%@@
-  0x0b, 0xe3, 0xc0,  //..%@@%.@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-
+  0xef, 0x00, 0x29, 0x0b, 0xe3, 0xc0, 0x3f, 0xfb, 0xc0, 0xbc, 0x0f, 0xc0, 0xf4, 0x07, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0xc0, 0x3f, 0xfb, 0xc0, 0x0b, 0xe3,
+  0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0,
 
   /*Unicode: U+0072 (r) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0xf1, 0xf4,  //@@.+@@+
-  0xf7, 0xfc,  //@@+@@@@
-  0xfd, 0x08,  //@@@+..%
-  0xf4, 0x00,  //@@+....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x00,  //@@.....
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xf5, 0x00, 0x12, 0xf1, 0xf4, 0xf7, 0xfc, 0xfd, 0x08, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xf8, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x1b, 0xfe, 0x00,  //.+%@@@@%.
-  0xbf, 0xff, 0xc0,  //%@@@@@@@@
-  0xf8, 0x01, 0xc0,  //@@%....+@
-  0xfe, 0x90, 0x00,  //@@@%%+...
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x01, 0x6f, 0x80,  //...++%@@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0xd0, 0x0b, 0xc0,  //@+....%@@
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0x2f, 0xf9, 0x00,  //.%@@@@%+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1c, 0x1b, 0xfe, 0x00, 0xbf, 0xff, 0xc0, 0xf8, 0x01, 0xc0, 0xfe, 0x90, 0x00, 0x3f,
+  0xff, 0x00, 0x01, 0x6f, 0x80, 0x00, 0x03, 0xc0, 0xd0, 0x0b, 0xc0, 0xff, 0xff, 0x40, 0x2f, 0xf9,
+  0xf4, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xc0, 0x00,  //...@@....
-  0x03, 0xd0, 0x00,  //...@@+...
-  0x02, 0xff, 0xc0,  //...%@@@@@
-  0x00, 0xbf, 0xc0,  //....%@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x26, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0xff, 0xff, 0xc0, 0xff,
+  0xff, 0xc0, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0,
+  0x00, 0x03, 0xd0, 0x00, 0x02, 0xff, 0xc0, 0x00, 0xbf, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x07, 0xc0,  //@@....+@@
-  0xf8, 0x1f, 0xc0,  //@@%..+@@@
-  0x7f, 0xf7, 0xc0,  //+@@@@@+@@
-  0x1f, 0xd3, 0xc0,  //.+@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x07, 0xc0, 0xf8, 0x1f, 0xc0, 0x7f, 0xf7, 0xc0, 0x1f, 0xd3,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0x78, 0x0b, 0x40,  //+@%...%@+
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x3d, 0x1f, 0x00,  //.@@+.+@@.
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1c, 0xf4, 0x07, 0xc0, 0x78, 0x0b, 0x40, 0x3c, 0x0f, 0x00, 0x3d, 0x1f, 0x00, 0x1e,
+  0x2d, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0xf8, 0x00, 0x07, 0xf4, 0x00, 0x03, 0xf0, 0x00, 0x02, 0xe0,
+  0xf4, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xf0, 0x00, 0x3c,  //@@.......@@
-  0xb4, 0x00, 0x78,  //%@+.....+@%
-  0x78, 0x00, 0xb4,  //+@%.....%@+
-  0x3c, 0x74, 0xf0,  //.@@.+@+.@@.
-  0x3c, 0xb8, 0xf0,  //.@@.%@%.@@.
-  0x2d, 0xdd, 0xe0,  //.%@+@+@+@%.
-  0x1f, 0xcf, 0xd0,  //.+@@@.@@@+.
-  0x0f, 0x8b, 0xc0,  //..@@%.%@@..
-  0x0f, 0x47, 0xc0,  //..@@+.+@@..
-  0x0f, 0x03, 0xc0,  //..@@...@@..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xef, 0x00, 0x1d, 0xf0, 0x00, 0x3c, 0xb4, 0x00, 0x78, 0x78, 0x00, 0xb4, 0x3c, 0x74, 0xf0, 0x3c,
+  0xb8, 0xf0, 0x2d, 0xdd, 0xe0, 0x1f, 0xcf, 0xd0, 0x0f, 0x8b, 0xc0, 0x0f, 0x47, 0xc0, 0x0f, 0x03,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3e, 0x2f, 0x00,  //.@@%.%@@.
-  0x0f, 0xbc, 0x00,  //..@@%@@..
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x1f, 0x7d, 0x00,  //.+@@+@@+.
-  0x3d, 0x1f, 0x00,  //.@@+.+@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0xbc, 0x0f, 0x80, 0x3e, 0x2f, 0x00, 0x0f, 0xbc, 0x00, 0x07, 0xf4, 0x00, 0x02,
+  0xe0, 0x00, 0x03, 0xf0, 0x00, 0x0b, 0xf8, 0x00, 0x1f, 0x7d, 0x00, 0x3d, 0x1f, 0x00, 0xbc, 0x0f,
+  0x80, 0xf5, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0x7c, 0x0b, 0x40,  //+@@...%@+
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x2e, 0x1e, 0x00,  //.%@%.+@%.
-  0x0f, 0x3d, 0x00,  //..@@.@@+.
-  0x0b, 0xbc, 0x00,  //..%@%@@..
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x01, 0xf0, 0x00,  //...+@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xc0, 0x00,  //...@@....
-  0x07, 0xc0, 0x00,  //..+@@....
-  0x3f, 0x40, 0x00,  //.@@@+....
-  0x3e, 0x00, 0x00,  //.@@%.....
-
+  0xef, 0x00, 0x29, 0xf4, 0x07, 0xc0, 0x7c, 0x0b, 0x40, 0x3c, 0x0f, 0x00, 0x2e, 0x1e, 0x00, 0x0f,
+  0x3d, 0x00, 0x0b, 0xbc, 0x00, 0x07, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x02, 0xe0,
+  0x00, 0x03, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x3f, 0x40, 0x00, 0x3e, 0x00, 0x00,
 
   /*Unicode: U+007a (z) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x3f, 0x00,  //.....@@@.
-  0x00, 0xfc, 0x00,  //....@@@..
-  0x02, 0xf0, 0x00,  //...%@@...
-  0x07, 0xd0, 0x00,  //..+@@+...
-  0x1f, 0x40, 0x00,  //.+@@+....
-  0x3e, 0x00, 0x00,  //.@@%.....
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x00, 0x00, 0xfc, 0x00, 0x02,
+  0xf0, 0x00, 0x07, 0xd0, 0x00, 0x1f, 0x40, 0x00, 0x3e, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+007b ({) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0xbf,  //....%@@@
-  0x02, 0xff,  //...%@@@@
-  0x03, 0xd0,  //...@@+..
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x0b, 0xc0,  //..%@@...
-  0xff, 0x00,  //@@@@....
-  0xff, 0x00,  //@@@@....
-  0x0b, 0x80,  //..%@%...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xd0,  //...@@+..
-  0x02, 0xff,  //...%@@@@
-  0x00, 0xbf,  //....%@@@
-  0x00, 0x00,  //........
-
+  0xfc, 0x00, 0x22, 0xbf, 0x02, 0xff, 0x03, 0xd0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x0b, 0xc0,
+  0xff, 0x00, 0xff, 0x00, 0x0b, 0x80, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xd0,
+  0x02, 0xff, 0x00, 0xbf, 0x00, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-
+  0x01, 0x00, 0x00, 0xef, 0xf0,
 
   /*Unicode: U+007d (}) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xfe, 0x00,  //@@@%....
-  0xff, 0x80,  //@@@@%...
-  0x07, 0xc0,  //..+@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xe0,  //...@@%..
-  0x00, 0xff,  //....@@@@
-  0x00, 0xff,  //....@@@@
-  0x02, 0xe0,  //...%@%..
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x07, 0xc0,  //..+@@...
-  0xff, 0x80,  //@@@@%...
-  0xfe, 0x00,  //@@@%....
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0x20, 0xfe, 0x00, 0xff, 0x80, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xe0, 0x00, 0xff, 0x00, 0xff, 0x02, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07,
+  0xc0, 0xff, 0x80, 0xfe, 0xfe, 0x00,
 
   /*Unicode: U+007e (~) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x7f, 0x80, 0x80,  //+@@@%...%
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x80, 0x7f, 0x40,  //%...+@@@+
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
-
+  0xe6, 0x00, 0x08, 0x7f, 0x80, 0x80, 0xff, 0xff, 0xc0, 0x80, 0x7f, 0x40, 0xe9, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 4
   /*Unicode: U+0020 ( ) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xc5, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xee,  //@@
-  0xdd,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xfa, 0xff, 0x05, 0xee, 0xdd, 0x00, 0x00, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+0022 (") , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0xff, 0x00, 0xff,  //@@..@@
-  0xff, 0x00, 0xff,  //@@..@@
-  0xff, 0x00, 0xff,  //@@..@@
-  0xff, 0x00, 0xff,  //@@..@@
-  0xff, 0x00, 0xff,  //@@..@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf8, 0x00, 0x0e, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0x00, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x6f, 0x00, 0xca, 0x00,  //....+@..@%.
-  0x00, 0x00, 0xac, 0x00, 0xf6, 0x00,  //....%@..@+.
-  0x00, 0x00, 0xe8, 0x04, 0xf2, 0x00,  //....@%.+@..
-  0x00, 0x02, 0xf4, 0x08, 0xe0, 0x00,  //....@+.%@..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@
-  0x00, 0x0c, 0xa0, 0x2f, 0x40, 0x00,  //...@%..@+..
-  0x00, 0x2f, 0x40, 0x8e, 0x00, 0x00,  //...@+.%@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@.
-  0x00, 0xca, 0x02, 0xf4, 0x00, 0x00,  //..@%..@+...
-  0x00, 0xf6, 0x06, 0xf0, 0x00, 0x00,  //..@+.+@....
-  0x04, 0xf2, 0x0a, 0xc0, 0x00, 0x00,  //.+@..%@....
-  0x08, 0xe0, 0x0d, 0x90, 0x00, 0x00,  //.%@..@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xf3, 0x00, 0x02, 0x6f, 0x00, 0xca, 0xfe, 0x00, 0x02, 0xac, 0x00, 0xf6, 0xfe, 0x00, 0x0a, 0xe8,
+  0x04, 0xf2, 0x00, 0x00, 0x02, 0xf4, 0x08, 0xe0, 0x00, 0x0f, 0xfd, 0xff, 0x01, 0xf0, 0x0f, 0xfd,
+  0xff, 0x0c, 0xf0, 0x00, 0x0c, 0xa0, 0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x8e, 0x00, 0x00, 0xfc,
+  0xff, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x00, 0xca, 0x02, 0xf4, 0xfe, 0x00, 0x0e, 0xf6, 0x06,
+  0xf0, 0x00, 0x00, 0x04, 0xf2, 0x0a, 0xc0, 0x00, 0x00, 0x08, 0xe0, 0x0d, 0x90, 0xe7, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-  0x04, 0xbe, 0xfe, 0xa3, 0x00,  //.+%@@@%..
-  0x6f, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-  0xef, 0x90, 0xf1, 0x5c, 0x00,  //@@%.@.+@.
-  0xff, 0x00, 0xf0, 0x00, 0x00,  //@@..@....
-  0xaf, 0x50, 0xf0, 0x00, 0x00,  //%@+.@....
-  0x1b, 0xfc, 0xf6, 0x20, 0x00,  //.%@@@+...
-  0x00, 0x37, 0xfd, 0xfa, 0x10,  //...+@@@%.
-  0x00, 0x00, 0xf0, 0x5f, 0xa0,  //....@.+@%
-  0x00, 0x00, 0xf0, 0x0f, 0xf0,  //....@..@@
-  0xc6, 0x10, 0xf1, 0x9f, 0xe0,  //@+..@.%@@
-  0xff, 0xff, 0xff, 0xff, 0x50,  //@@@@@@@@+
-  0x28, 0xce, 0xfe, 0xb3, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0xf0, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x04, 0xbe, 0xfe, 0xa3, 0x00, 0x6f,
+  0xfe, 0xff, 0x28, 0x00, 0xef, 0x90, 0xf1, 0x5c, 0x00, 0xff, 0x00, 0xf0, 0x00, 0x00, 0xaf, 0x50,
+  0xf0, 0x00, 0x00, 0x1b, 0xfc, 0xf6, 0x20, 0x00, 0x00, 0x37, 0xfd, 0xfa, 0x10, 0x00, 0x00, 0xf0,
+  0x5f, 0xa0, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0xc6, 0x10, 0xf1, 0x9f, 0xe0, 0xfd, 0xff, 0x04, 0x50,
+  0x28, 0xce, 0xfe, 0xb3, 0xfe, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0,
+  0xfa, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x08, 0xee, 0x80, 0x00, 0x00, 0x00,  //.%@@%......
-  0x8f, 0x66, 0xf8, 0x00, 0x00, 0x00,  //%@++@%.....
-  0xef, 0x00, 0xfe, 0x00, 0x00, 0x00,  //@@..@@.....
-  0xef, 0x00, 0xfe, 0x00, 0x00, 0x00,  //@@..@@.....
-  0x8f, 0x66, 0xf8, 0x00, 0x16, 0x10,  //%@++@%...+.
-  0x08, 0xee, 0x81, 0x5b, 0xfa, 0x30,  //.%@@%.+%@%.
-  0x00, 0x05, 0xae, 0xa5, 0x00, 0x00,  //...+%@%+...
-  0x0a, 0xea, 0x51, 0x8e, 0xe8, 0x00,  //.%@%+.%@@%.
-  0x04, 0x00, 0x08, 0xf6, 0x6f, 0x80,  //.+...%@++@%
-  0x00, 0x00, 0x0e, 0xf0, 0x0f, 0xe0,  //.....@@..@@
-  0x00, 0x00, 0x0e, 0xf0, 0x0f, 0xe0,  //.....@@..@@
-  0x00, 0x00, 0x09, 0xf6, 0x6f, 0x80,  //.....%@++@%
-  0x00, 0x00, 0x00, 0x9e, 0xe8, 0x00,  //......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xef, 0x00, 0x02, 0x08, 0xee, 0x80, 0xfe, 0x00, 0x02, 0x8f, 0x66, 0xf8, 0xfe, 0x00, 0x02, 0xef,
+  0x00, 0xfe, 0xfe, 0x00, 0x02, 0xef, 0x00, 0xfe, 0xfe, 0x00, 0x2f, 0x8f, 0x66, 0xf8, 0x00, 0x16,
+  0x10, 0x08, 0xee, 0x81, 0x5b, 0xfa, 0x30, 0x00, 0x05, 0xae, 0xa5, 0x00, 0x00, 0x0a, 0xea, 0x51,
+  0x8e, 0xe8, 0x00, 0x04, 0x00, 0x08, 0xf6, 0x6f, 0x80, 0x00, 0x00, 0x0e, 0xf0, 0x0f, 0xe0, 0x00,
+  0x00, 0x0e, 0xf0, 0x0f, 0xe0, 0x00, 0x00, 0x09, 0xf6, 0x6f, 0x80, 0xfe, 0x00, 0x01, 0x9e, 0xe8,
+  0xe8, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x08, 0xdf, 0xff, 0x00,  //...%@@@@..
-  0x00, 0xaf, 0xff, 0xff, 0x00,  //..%@@@@@..
-  0x00, 0xff, 0x50, 0x00, 0x00,  //..@@+.....
-  0x00, 0xcf, 0x10, 0x00, 0x00,  //..@@......
-  0x00, 0x3f, 0xc0, 0x00, 0x00,  //...@@.....
-  0x02, 0xcf, 0xf9, 0x00, 0x00,  //..@@@%....
-  0x1e, 0xc4, 0xff, 0x30, 0xff,  //.@@+@@..@@
-  0xaf, 0x20, 0x8f, 0xd0, 0xfd,  //%@..%@@.@@
-  0xef, 0x00, 0x0d, 0xf8, 0xf8,  //@@...@@%@%
-  0xef, 0x60, 0x03, 0xff, 0xc0,  //@@+...@@@.
-  0xaf, 0xf7, 0x10, 0x9f, 0x50,  //%@@+..%@+.
-  0x1e, 0xff, 0xff, 0xaf, 0xe1,  //.@@@@@%@@.
-  0x01, 0x9e, 0xfa, 0x0b, 0xfa,  //..%@@%.%@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf1, 0x00, 0x0b, 0x08, 0xdf, 0xff, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x00, 0x00, 0xff, 0x50, 0xfe,
+  0x00, 0x01, 0xcf, 0x10, 0xfe, 0x00, 0x2b, 0x3f, 0xc0, 0x00, 0x00, 0x02, 0xcf, 0xf9, 0x00, 0x00,
+  0x1e, 0xc4, 0xff, 0x30, 0xff, 0xaf, 0x20, 0x8f, 0xd0, 0xfd, 0xef, 0x00, 0x0d, 0xf8, 0xf8, 0xef,
+  0x60, 0x03, 0xff, 0xc0, 0xaf, 0xf7, 0x10, 0x9f, 0x50, 0x1e, 0xff, 0xff, 0xaf, 0xe1, 0x01, 0x9e,
+  0xfa, 0x0b, 0xfa, 0xed, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+0028 (() , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x8c,  //..%@
-  0x02, 0xf5,  //..@+
-  0x0a, 0xf0,  //.%@.
-  0x1f, 0xa0,  //.@%.
-  0x6f, 0x60,  //+@+.
-  0xbf, 0x30,  //%@..
-  0xdf, 0x10,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xdf, 0x10,  //@@..
-  0xaf, 0x30,  //%@..
-  0x6f, 0x60,  //+@+.
-  0x1f, 0xa0,  //.@%.
-  0x0a, 0xf0,  //.%@.
-  0x02, 0xf5,  //..@+
-  0x00, 0x8c,  //..%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x1e, 0x8c, 0x02, 0xf5, 0x0a, 0xf0, 0x1f, 0xa0, 0x6f, 0x60, 0xbf, 0x30, 0xdf, 0x10,
+  0xff, 0x00, 0xff, 0x00, 0xdf, 0x10, 0xaf, 0x30, 0x6f, 0x60, 0x1f, 0xa0, 0x0a, 0xf0, 0x02, 0xf5,
+  0x00, 0x8c, 0xfd, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xc8, 0x00,  //@%..
-  0x5f, 0x20,  //+@..
-  0x0f, 0xa0,  //.@%.
-  0x0a, 0xf1,  //.%@.
-  0x06, 0xf6,  //.+@+
-  0x03, 0xfa,  //..@%
-  0x01, 0xfd,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x01, 0xfd,  //..@@
-  0x03, 0xfa,  //..@%
-  0x06, 0xf6,  //.+@+
-  0x0a, 0xf1,  //.%@.
-  0x0f, 0xa0,  //.@%.
-  0x5f, 0x20,  //+@..
-  0xc8, 0x00,  //@%..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x1e, 0xc8, 0x00, 0x5f, 0x20, 0x0f, 0xa0, 0x0a, 0xf1, 0x06, 0xf6, 0x03, 0xfa, 0x01,
+  0xfd, 0x00, 0xff, 0x00, 0xff, 0x01, 0xfd, 0x03, 0xfa, 0x06, 0xf6, 0x0a, 0xf1, 0x0f, 0xa0, 0x5f,
+  0x20, 0xc8, 0xfc, 0x00,
 
   /*Unicode: U+002a (*) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x0f, 0x00, 0x00,  //...@...
-  0xa2, 0x0f, 0x02, 0xa0,  //%..@..%
-  0x5e, 0x5f, 0x5e, 0x50,  //+@+@+@+
-  0x02, 0xcf, 0xc2, 0x00,  //..@@@..
-  0x02, 0xcf, 0xc2, 0x00,  //..@@@..
-  0x5e, 0x5f, 0x5e, 0x50,  //+@+@+@+
-  0xa2, 0x0f, 0x02, 0xa0,  //%..@..%
-  0x00, 0x0f, 0x00, 0x00,  //...@...
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf4, 0x00, 0x1c, 0x0f, 0x00, 0x00, 0xa2, 0x0f, 0x02, 0xa0, 0x5e, 0x5f, 0x5e, 0x50, 0x02, 0xcf,
+  0xc2, 0x00, 0x02, 0xcf, 0xc2, 0x00, 0x5e, 0x5f, 0x5e, 0x50, 0xa2, 0x0f, 0x02, 0xa0, 0x00, 0x0f,
+  0xdb, 0x00,
 
   /*Unicode: U+002b (+) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe6, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff,
+  0x00, 0x00, 0xf7, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xe6, 0x00,
 
   /*Unicode: U+002c (,) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x0f, 0xf0,  //.@@
-  0x0f, 0xf0,  //.@@
-  0x3f, 0x80,  //.@%
-  0x8e, 0x00,  //%@.
-  0xd4, 0x00,  //@+.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xe7, 0x00, 0x08, 0x0f, 0xf0, 0x0f, 0xf0, 0x3f, 0x80, 0x8e, 0x00, 0xd4, 0xfc, 0x00,
 
   /*Unicode: U+002d (-) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xe3, 0x00, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xe9, 0x00,
 
   /*Unicode: U+002e (.) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf4, 0x00, 0xfe, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+002f (/) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x3f, 0xc0,  //.......@@
-  0x00, 0x00, 0x00, 0xbf, 0x40,  //......%@+
-  0x00, 0x00, 0x02, 0xfd, 0x00,  //......@@.
-  0x00, 0x00, 0x0a, 0xf5, 0x00,  //.....%@+.
-  0x00, 0x00, 0x1f, 0xe0, 0x00,  //.....@@..
-  0x00, 0x00, 0x9f, 0x60, 0x00,  //....%@+..
-  0x00, 0x01, 0xfe, 0x00, 0x00,  //....@@...
-  0x00, 0x07, 0xf7, 0x00, 0x00,  //...+@+...
-  0x00, 0x0e, 0xf1, 0x00, 0x00,  //...@@....
-  0x00, 0x6f, 0x80, 0x00, 0x00,  //..+@%....
-  0x00, 0xef, 0x10, 0x00, 0x00,  //..@@.....
-  0x05, 0xfa, 0x00, 0x00, 0x00,  //.+@%.....
-  0x0d, 0xf2, 0x00, 0x00, 0x00,  //.@@......
-  0x4f, 0xb0, 0x00, 0x00, 0x00,  //+@%......
-  0xcf, 0x30, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x01, 0x3f, 0xc0, 0xfe, 0x00, 0x05, 0xbf, 0x40, 0x00, 0x00, 0x02, 0xfd, 0xfe, 0x00,
+  0x01, 0x0a, 0xf5, 0xfe, 0x00, 0x01, 0x1f, 0xe0, 0xfe, 0x00, 0x05, 0x9f, 0x60, 0x00, 0x00, 0x01,
+  0xfe, 0xfe, 0x00, 0x01, 0x07, 0xf7, 0xfe, 0x00, 0x01, 0x0e, 0xf1, 0xfe, 0x00, 0x01, 0x6f, 0x80,
+  0xfe, 0x00, 0x05, 0xef, 0x10, 0x00, 0x00, 0x05, 0xfa, 0xfe, 0x00, 0x01, 0x0d, 0xf2, 0xfe, 0x00,
+  0x01, 0x4f, 0xb0, 0xfe, 0x00, 0x01, 0xcf, 0x30, 0xf4, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8d, 0xfd, 0x80, 0x00,  //..%@@@%..
-  0x0b, 0xff, 0xff, 0xfb, 0x00,  //.%@@@@@%.
-  0x4f, 0xe4, 0x04, 0xef, 0x40,  //+@@+.+@@+
-  0xaf, 0x70, 0x00, 0x7f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0xcc, 0x0f, 0xf0,  //@@..@@.@@
-  0xff, 0x00, 0xcc, 0x0f, 0xf0,  //@@..@@.@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x70, 0x00, 0x7f, 0xa0,  //%@+...+@%
-  0x4f, 0xe4, 0x04, 0xef, 0x40,  //+@@+.+@@+
-  0x0b, 0xff, 0xff, 0xfb, 0x00,  //.%@@@@@%.
-  0x00, 0x8e, 0xfd, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x3e, 0x8d, 0xfd, 0x80, 0x00, 0x0b, 0xff, 0xff, 0xfb, 0x00, 0x4f, 0xe4, 0x04, 0xef,
+  0x40, 0xaf, 0x70, 0x00, 0x7f, 0xa0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0xcc, 0x0f, 0xf0,
+  0xff, 0x00, 0xcc, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf,
+  0x70, 0x00, 0x7f, 0xa0, 0x4f, 0xe4, 0x04, 0xef, 0x40, 0x0b, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x8e,
+  0xfd, 0x80, 0xec, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x27, 0xcf, 0xf0, 0x00,  //.+@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xd7, 0x2f, 0xf0, 0x00,  //@+.@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x2b, 0x27, 0xcf, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xd7, 0x2f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9,
+  0xff, 0xf1, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x39, 0xdf, 0xfd, 0x81, 0x00,  //.%@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0x30,  //@@@@@@@@..
-  0xc7, 0x30, 0x03, 0xcf, 0xd0,  //@+....@@@.
-  0x00, 0x00, 0x00, 0x2f, 0xf0,  //.......@@.
-  0x00, 0x00, 0x00, 0x1f, 0xf1,  //.......@@.
-  0x00, 0x00, 0x00, 0x9f, 0xd0,  //......%@@.
-  0x00, 0x00, 0x07, 0xff, 0x50,  //.....+@@+.
-  0x00, 0x00, 0xaf, 0xf7, 0x00,  //....%@@+..
-  0x00, 0x1c, 0xfe, 0x40, 0x00,  //...@@@+...
-  0x03, 0xef, 0xa1, 0x00, 0x00,  //..@@%.....
-  0x6f, 0xc3, 0x00, 0x00, 0x00,  //+@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xf1,  //@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x04, 0x39, 0xdf, 0xfd, 0x81, 0x00, 0xfd, 0xff, 0x05, 0x30, 0xc7, 0x30, 0x03, 0xcf,
+  0xd0, 0xfe, 0x00, 0x01, 0x2f, 0xf0, 0xfe, 0x00, 0x01, 0x1f, 0xf1, 0xfe, 0x00, 0x17, 0x9f, 0xd0,
+  0x00, 0x00, 0x07, 0xff, 0x50, 0x00, 0x00, 0xaf, 0xf7, 0x00, 0x00, 0x1c, 0xfe, 0x40, 0x00, 0x03,
+  0xef, 0xa1, 0x00, 0x00, 0x6f, 0xc3, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf1, 0xfd, 0xff, 0x00, 0xf1,
+  0xed, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x28, 0xcf, 0xfd, 0x92, 0x00,  //.%@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xc6, 0x20, 0x02, 0xaf, 0xd0,  //@+....%@@
-  0x00, 0x00, 0x00, 0x1f, 0xf0,  //.......@@
-  0x00, 0x00, 0x03, 0xaf, 0xa0,  //......%@%
-  0x00, 0xff, 0xff, 0xe8, 0x00,  //..@@@@@%.
-  0x00, 0xff, 0xff, 0xe7, 0x00,  //..@@@@@+.
-  0x00, 0x00, 0x14, 0xdf, 0x70,  //.....+@@+
-  0x00, 0x00, 0x00, 0x2f, 0xd0,  //.......@@
-  0x00, 0x00, 0x00, 0x2f, 0xf0,  //.......@@
-  0xc6, 0x10, 0x14, 0xcf, 0xc0,  //@+...+@@@
-  0xff, 0xff, 0xff, 0xff, 0x30,  //@@@@@@@@.
-  0x28, 0xdf, 0xfd, 0x92, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x04, 0x28, 0xcf, 0xfd, 0x92, 0x00, 0xfd, 0xff, 0x05, 0x40, 0xc6, 0x20, 0x02, 0xaf,
+  0xd0, 0xfe, 0x00, 0x0f, 0x1f, 0xf0, 0x00, 0x00, 0x03, 0xaf, 0xa0, 0x00, 0xff, 0xff, 0xe8, 0x00,
+  0x00, 0xff, 0xff, 0xe7, 0xfe, 0x00, 0x02, 0x14, 0xdf, 0x70, 0xfe, 0x00, 0x01, 0x2f, 0xd0, 0xfe,
+  0x00, 0x06, 0x2f, 0xf0, 0xc6, 0x10, 0x14, 0xcf, 0xc0, 0xfd, 0xff, 0x04, 0x30, 0x28, 0xdf, 0xfd,
+  0x92, 0xec, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x4f, 0xf0, 0x00,  //....+@@..
-  0x00, 0x00, 0xdf, 0xf0, 0x00,  //....@@@..
-  0x00, 0x07, 0xcf, 0xf0, 0x00,  //...+@@@..
-  0x00, 0x1f, 0x3f, 0xf0, 0x00,  //...@.@@..
-  0x00, 0xbb, 0x0f, 0xf0, 0x00,  //..%%.@@..
-  0x04, 0xf2, 0x0f, 0xf0, 0x00,  //.+@..@@..
-  0x0d, 0x90, 0x0f, 0xf0, 0x00,  //.@%..@@..
-  0x8f, 0x10, 0x0f, 0xf0, 0x00,  //%@...@@..
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x0f, 0xf0, 0x00,  //.....@@..
-  0x00, 0x00, 0x0f, 0xf0, 0x00,  //.....@@..
-  0x00, 0x00, 0x0f, 0xf0, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf0, 0x00, 0x01, 0x4f, 0xf0, 0xfe, 0x00, 0x20, 0xdf, 0xf0, 0x00, 0x00, 0x07, 0xcf, 0xf0, 0x00,
+  0x00, 0x1f, 0x3f, 0xf0, 0x00, 0x00, 0xbb, 0x0f, 0xf0, 0x00, 0x04, 0xf2, 0x0f, 0xf0, 0x00, 0x0d,
+  0x90, 0x0f, 0xf0, 0x00, 0x8f, 0x10, 0x0f, 0xf0, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x04,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xec,
+  0x00,
 
   /*Unicode: U+0035 (5) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x0f, 0xf0, 0x00, 0x00, 0x00,  //.@@......
-  0x0f, 0xf0, 0x00, 0x00, 0x00,  //.@@......
-  0x0f, 0xfc, 0xfe, 0x91, 0x00,  //.@@@@@%..
-  0x0f, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x0a, 0x30, 0x15, 0xef, 0x90,  //.%...+@@%
-  0x00, 0x00, 0x00, 0x4f, 0xe0,  //......+@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x4f, 0xe0,  //......+@@
-  0xc5, 0x10, 0x15, 0xef, 0x80,  //@+...+@@%
-  0xff, 0xff, 0xff, 0xfc, 0x00,  //@@@@@@@@.
-  0x4a, 0xef, 0xfc, 0x70, 0x00,  //+%@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x01, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0x00, 0x0f, 0xf0, 0xfe,
+  0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x0e, 0x0f, 0xfc, 0xfe, 0x91, 0x00, 0x0f, 0xff, 0xff, 0xfe,
+  0x10, 0x0a, 0x30, 0x15, 0xef, 0x90, 0xfe, 0x00, 0x01, 0x4f, 0xe0, 0xfe, 0x00, 0x01, 0x0f, 0xf0,
+  0xfe, 0x00, 0x06, 0x4f, 0xe0, 0xc5, 0x10, 0x15, 0xef, 0x80, 0xfe, 0xff, 0x05, 0xfc, 0x00, 0x4a,
+  0xef, 0xfc, 0x70, 0xec, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x4b, 0xef, 0xc4, 0x00,  //..+%@@@+.
-  0x07, 0xff, 0xff, 0xff, 0x00,  //.+@@@@@@.
-  0x2f, 0xfa, 0x20, 0x2b, 0x00,  //.@@%...%.
-  0x9f, 0xc0, 0x00, 0x00, 0x00,  //%@@......
-  0xdf, 0x50, 0x00, 0x00, 0x00,  //@@+......
-  0xff, 0x28, 0xef, 0xc4, 0x00,  //@@.%@@@+.
-  0xff, 0x9f, 0xff, 0xff, 0x40,  //@@%@@@@@+
-  0xff, 0xb2, 0x02, 0xaf, 0xc0,  //@@%...%@@
-  0xdf, 0x10, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xaf, 0x10, 0x00, 0x1f, 0xf0,  //%@.....@@
-  0x5f, 0xb2, 0x02, 0xaf, 0xb0,  //+@%...%@%
-  0x0c, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x00, 0x8d, 0xfe, 0xb3, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x04, 0x4b, 0xef, 0xc4, 0x00, 0x07, 0xfe, 0xff, 0x07, 0x00, 0x2f, 0xfa, 0x20, 0x2b,
+  0x00, 0x9f, 0xc0, 0xfe, 0x00, 0x01, 0xdf, 0x50, 0xfe, 0x00, 0x1e, 0xff, 0x28, 0xef, 0xc4, 0x00,
+  0xff, 0x9f, 0xff, 0xff, 0x40, 0xff, 0xb2, 0x02, 0xaf, 0xc0, 0xdf, 0x10, 0x00, 0x1f, 0xf0, 0xaf,
+  0x10, 0x00, 0x1f, 0xf0, 0x5f, 0xb2, 0x02, 0xaf, 0xb0, 0x0c, 0xfe, 0xff, 0x04, 0x30, 0x00, 0x8d,
+  0xfe, 0xb3, 0xec, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@%
-  0x00, 0x00, 0x00, 0xdf, 0x40,  //......@@+
-  0x00, 0x00, 0x03, 0xfe, 0x00,  //......@@.
-  0x00, 0x00, 0x0a, 0xf8, 0x00,  //.....%@%.
-  0x00, 0x00, 0x0f, 0xf2, 0x00,  //.....@@..
-  0x00, 0x00, 0x6f, 0xb0, 0x00,  //....+@%..
-  0x00, 0x00, 0xdf, 0x50, 0x00,  //....@@+..
-  0x00, 0x03, 0xfe, 0x00, 0x00,  //....@@...
-  0x00, 0x09, 0xf8, 0x00, 0x00,  //...%@%...
-  0x00, 0x0f, 0xf2, 0x00, 0x00,  //...@@....
-  0x00, 0x6f, 0xc0, 0x00, 0x00,  //..+@@....
-  0x00, 0xcf, 0x60, 0x00, 0x00,  //..@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xb0, 0xfe, 0x00, 0x05, 0xdf, 0x40, 0x00,
+  0x00, 0x03, 0xfe, 0xfe, 0x00, 0x01, 0x0a, 0xf8, 0xfe, 0x00, 0x01, 0x0f, 0xf2, 0xfe, 0x00, 0x01,
+  0x6f, 0xb0, 0xfe, 0x00, 0x05, 0xdf, 0x50, 0x00, 0x00, 0x03, 0xfe, 0xfe, 0x00, 0x01, 0x09, 0xf8,
+  0xfe, 0x00, 0x01, 0x0f, 0xf2, 0xfe, 0x00, 0x01, 0x6f, 0xc0, 0xfe, 0x00, 0x01, 0xcf, 0x60, 0xeb,
+  0x00,
 
   /*Unicode: U+0038 (8) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x04, 0xbe, 0xfe, 0xb4, 0x00,  //.+%@@@%+.
-  0x6f, 0xff, 0xff, 0xff, 0x60,  //+@@@@@@@+
-  0xef, 0x91, 0x01, 0x9f, 0xe0,  //@@%...%@@
-  0xef, 0x00, 0x00, 0x0f, 0xe0,  //@@.....@@
-  0x9f, 0x81, 0x01, 0x8f, 0x80,  //%@%...%@%
-  0x07, 0xdf, 0xff, 0xd7, 0x00,  //.+@@@@@+.
-  0x08, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@%.
-  0x8f, 0xb2, 0x02, 0xbf, 0x80,  //%@%...%@%
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xff, 0x10, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xcf, 0xb2, 0x02, 0xbf, 0xc0,  //@@%...%@@
-  0x4f, 0xff, 0xff, 0xff, 0x40,  //+@@@@@@@+
-  0x03, 0xad, 0xfd, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x05, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x6f, 0xfe, 0xff, 0x2e, 0x60, 0xef, 0x91, 0x01,
+  0x9f, 0xe0, 0xef, 0x00, 0x00, 0x0f, 0xe0, 0x9f, 0x81, 0x01, 0x8f, 0x80, 0x07, 0xdf, 0xff, 0xd7,
+  0x00, 0x08, 0xff, 0xff, 0xf8, 0x00, 0x8f, 0xb2, 0x02, 0xbf, 0x80, 0xef, 0x10, 0x00, 0x1f, 0xe0,
+  0xff, 0x10, 0x00, 0x1f, 0xf0, 0xcf, 0xb2, 0x02, 0xbf, 0xc0, 0x4f, 0xfe, 0xff, 0x04, 0x40, 0x03,
+  0xad, 0xfd, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0xbe, 0xfd, 0x80, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0xcf, 0xb2, 0x02, 0xbf, 0x50,  //@@%...%@+
-  0xff, 0x10, 0x00, 0x1f, 0xa0,  //@@.....@%
-  0xff, 0x10, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xcf, 0xa2, 0x02, 0xbf, 0xf0,  //@@%...%@@
-  0x4f, 0xff, 0xff, 0x9f, 0xf0,  //+@@@@@%@@
-  0x04, 0xcf, 0xe9, 0x2f, 0xe0,  //.+@@@%.@@
-  0x00, 0x00, 0x00, 0x5f, 0xc0,  //......+@@
-  0x00, 0x00, 0x00, 0xcf, 0x90,  //......@@%
-  0x0a, 0x20, 0x2a, 0xff, 0x20,  //.%...%@@.
-  0x0f, 0xff, 0xff, 0xf7, 0x00,  //.@@@@@@+.
-  0x04, 0xcf, 0xeb, 0x40, 0x00,  //.+@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x27, 0x03, 0xbe, 0xfd, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0xcf, 0xb2, 0x02,
+  0xbf, 0x50, 0xff, 0x10, 0x00, 0x1f, 0xa0, 0xff, 0x10, 0x00, 0x1f, 0xd0, 0xcf, 0xa2, 0x02, 0xbf,
+  0xf0, 0x4f, 0xff, 0xff, 0x9f, 0xf0, 0x04, 0xcf, 0xe9, 0x2f, 0xe0, 0xfe, 0x00, 0x01, 0x5f, 0xc0,
+  0xfe, 0x00, 0x0f, 0xcf, 0x90, 0x0a, 0x20, 0x2a, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xf7, 0x00, 0x04,
+  0xcf, 0xeb, 0x40, 0xec, 0x00,
 
   /*Unicode: U+003a (:) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfa, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+003b (;) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x0f, 0xf0,  //.@@
-  0x0f, 0xf0,  //.@@
-  0x0f, 0xf0,  //.@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x0f, 0xf0,  //.@@
-  0x0f, 0xf0,  //.@@
-  0x3f, 0x80,  //.@%
-  0x8e, 0x00,  //%@.
-  0xd4, 0x00,  //@+.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xf3, 0x00, 0x05, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0xfb, 0x00, 0x08, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x3f, 0x80, 0x8e, 0x00, 0xd4, 0xfc, 0x00,
 
   /*Unicode: U+003c (<) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x05, 0xc0,  //.......+@
-  0x00, 0x00, 0x28, 0xef, 0xd0,  //.....%@@@
-  0x00, 0x4b, 0xff, 0xa3, 0x00,  //..+%@@%..
-  0x7d, 0xfd, 0x61, 0x00, 0x00,  //+@@@+....
-  0xff, 0x60, 0x00, 0x00, 0x00,  //@@+......
-  0x7d, 0xfc, 0x60, 0x00, 0x00,  //+@@@+....
-  0x00, 0x4b, 0xff, 0x93, 0x00,  //..+%@@%..
-  0x00, 0x00, 0x28, 0xef, 0xd0,  //.....%@@@
-  0x00, 0x00, 0x00, 0x05, 0xc0,  //.......+@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe0, 0x00, 0x12, 0x05, 0xc0, 0x00, 0x00, 0x28, 0xef, 0xd0, 0x00, 0x4b, 0xff, 0xa3, 0x00, 0x7d,
+  0xfd, 0x61, 0x00, 0x00, 0xff, 0x60, 0xfe, 0x00, 0x02, 0x7d, 0xfc, 0x60, 0xfe, 0x00, 0x02, 0x4b,
+  0xff, 0x93, 0xfe, 0x00, 0x02, 0x28, 0xef, 0xd0, 0xfe, 0x00, 0x01, 0x05, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+003d (=) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xde, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xf7, 0x00, 0xfd, 0xff, 0x00, 0xf0,
+  0xfd, 0xff, 0x00, 0xf0, 0xde, 0x00,
 
   /*Unicode: U+003e (>) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xc5, 0x00, 0x00, 0x00, 0x00,  //@+.......
-  0xdf, 0xe8, 0x20, 0x00, 0x00,  //@@@%.....
-  0x03, 0xaf, 0xfb, 0x40, 0x00,  //..%@@%+..
-  0x00, 0x01, 0x6d, 0xfd, 0x70,  //....+@@@+
-  0x00, 0x00, 0x00, 0x6f, 0xf0,  //......+@@
-  0x00, 0x00, 0x6c, 0xfd, 0x70,  //....+@@@+
-  0x03, 0x9f, 0xfb, 0x40, 0x00,  //..%@@%+..
-  0xdf, 0xe8, 0x20, 0x00, 0x00,  //@@@%.....
-  0xc5, 0x00, 0x00, 0x00, 0x00,  //@+.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x00, 0xc5, 0xfd, 0x00, 0x0e, 0xdf, 0xe8, 0x20, 0x00, 0x00, 0x03, 0xaf, 0xfb, 0x40,
+  0x00, 0x00, 0x01, 0x6d, 0xfd, 0x70, 0xfe, 0x00, 0x11, 0x6f, 0xf0, 0x00, 0x00, 0x6c, 0xfd, 0x70,
+  0x03, 0x9f, 0xfb, 0x40, 0x00, 0xdf, 0xe8, 0x20, 0x00, 0x00, 0xc5, 0xe4, 0x00,
 
   /*Unicode: U+003f (?) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x4a, 0xef, 0xd6, 0x00,  //+%@@@+.
-  0xff, 0xff, 0xff, 0x70,  //@@@@@@+
-  0xb4, 0x00, 0x3f, 0xd0,  //%+...@@
-  0x00, 0x00, 0x2f, 0xf0,  //.....@@
-  0x00, 0x01, 0xdf, 0xa0,  //....@@%
-  0x00, 0x0c, 0xfd, 0x10,  //...@@@.
-  0x00, 0x8f, 0xd1, 0x00,  //..%@@..
-  0x00, 0xef, 0x30, 0x00,  //..@@...
-  0x00, 0xff, 0x00, 0x00,  //..@@...
-  0x00, 0xff, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0xff, 0x00, 0x00,  //..@@...
-  0x00, 0xff, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf5, 0x00, 0x03, 0x4a, 0xef, 0xd6, 0x00, 0xfe, 0xff, 0x1a, 0x70, 0xb4, 0x00, 0x3f, 0xd0, 0x00,
+  0x00, 0x2f, 0xf0, 0x00, 0x01, 0xdf, 0xa0, 0x00, 0x0c, 0xfd, 0x10, 0x00, 0x8f, 0xd1, 0x00, 0x00,
+  0xef, 0x30, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
+  0xff, 0xef, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x19, 0xef, 0xd5, 0x00,  //...%@@@+.
-  0x02, 0xeb, 0x21, 0xbf, 0x60,  //..@%..%@+
-  0x0c, 0xe1, 0x00, 0x2f, 0xd0,  //.@@....@@
-  0x4f, 0x80, 0x2e, 0xaf, 0xf0,  //+@%..@%@@
-  0xaf, 0x40, 0x9f, 0x7f, 0xf0,  //%@+.%@+@@
-  0xdf, 0x10, 0xdf, 0x2f, 0xf0,  //@@..@@.@@
-  0xff, 0x00, 0xff, 0x0f, 0xf0,  //@@..@@.@@
-  0xff, 0x00, 0xff, 0x0f, 0xf0,  //@@..@@.@@
-  0xff, 0x00, 0xdf, 0x2f, 0xf0,  //@@..@@.@@
-  0xdf, 0x20, 0x9f, 0x7f, 0xf0,  //@@..%@+@@
-  0xaf, 0x50, 0x2e, 0xaf, 0xf0,  //%@+..@%@@
-  0x4f, 0xa0, 0x00, 0x00, 0x00,  //+@%......
-  0x0c, 0xf2, 0x00, 0x00, 0x00,  //.@@......
-  0x02, 0xee, 0x40, 0x00, 0x00,  //..@@+....
-  0x00, 0x19, 0xef, 0xd0, 0x00,  //...%@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x37, 0x19, 0xef, 0xd5, 0x00, 0x02, 0xeb, 0x21, 0xbf, 0x60, 0x0c, 0xe1, 0x00, 0x2f,
+  0xd0, 0x4f, 0x80, 0x2e, 0xaf, 0xf0, 0xaf, 0x40, 0x9f, 0x7f, 0xf0, 0xdf, 0x10, 0xdf, 0x2f, 0xf0,
+  0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xdf, 0x2f, 0xf0, 0xdf,
+  0x20, 0x9f, 0x7f, 0xf0, 0xaf, 0x50, 0x2e, 0xaf, 0xf0, 0x4f, 0xa0, 0xfe, 0x00, 0x01, 0x0c, 0xf2,
+  0xfe, 0x00, 0x02, 0x02, 0xee, 0x40, 0xfe, 0x00, 0x02, 0x19, 0xef, 0xd0, 0xfb, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x01, 0x09, 0xf9, 0xfe, 0x00, 0x01, 0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20,
+  0x00, 0x00, 0x6f, 0xff, 0x60, 0x00, 0x00, 0xaf, 0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00,
+  0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07, 0xf9, 0x09, 0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f,
+  0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0, 0x00, 0xcf, 0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30,
+  0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xfe, 0xb4, 0x00,  //@@@@@@%+.
-  0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@+
-  0xff, 0x00, 0x01, 0x8f, 0xe0,  //@@....%@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x01, 0x9f, 0xb0,  //@@....%@%
-  0xff, 0xff, 0xff, 0xea, 0x10,  //@@@@@@@%.
-  0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@%.
-  0xff, 0x00, 0x02, 0xbf, 0x80,  //@@....%@%
-  0xff, 0x00, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x02, 0xaf, 0xd0,  //@@....%@@
-  0xff, 0xff, 0xff, 0xff, 0x50,  //@@@@@@@@+
-  0xff, 0xff, 0xfe, 0xb4, 0x00,  //@@@@@@%+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x04, 0xff, 0xff, 0xfe, 0xb4, 0x00, 0xfd, 0xff, 0x0f, 0x60, 0xff, 0x00, 0x01, 0x8f,
+  0xe0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x01, 0x9f, 0xb0, 0xfe, 0xff, 0x01, 0xea, 0x10,
+  0xfe, 0xff, 0x15, 0xf9, 0x00, 0xff, 0x00, 0x02, 0xbf, 0x80, 0xff, 0x00, 0x00, 0x1f, 0xd0, 0xff,
+  0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x02, 0xaf, 0xd0, 0xfd, 0xff, 0x04, 0x50, 0xff, 0xff, 0xfe,
+  0xb4, 0xec, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x19, 0xdf, 0xeb, 0x40,  //...%@@@%+
-  0x04, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@
-  0x1e, 0xfa, 0x20, 0x14, 0xc0,  //.@@%...+@
-  0x7f, 0xb0, 0x00, 0x00, 0x00,  //+@%......
-  0xcf, 0x40, 0x00, 0x00, 0x00,  //@@+......
-  0xef, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xef, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0xcf, 0x40, 0x00, 0x00, 0x00,  //@@+......
-  0x8f, 0xb0, 0x00, 0x00, 0x00,  //%@%......
-  0x1e, 0xfa, 0x20, 0x04, 0xc0,  //.@@%...+@
-  0x04, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@
-  0x00, 0x29, 0xdf, 0xfb, 0x40,  //...%@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x04, 0x19, 0xdf, 0xeb, 0x40, 0x04, 0xfe, 0xff, 0x07, 0xf0, 0x1e, 0xfa, 0x20, 0x14,
+  0xc0, 0x7f, 0xb0, 0xfe, 0x00, 0x01, 0xcf, 0x40, 0xfe, 0x00, 0x01, 0xef, 0x10, 0xfe, 0x00, 0x00,
+  0xff, 0xfd, 0x00, 0x01, 0xef, 0x10, 0xfe, 0x00, 0x01, 0xcf, 0x40, 0xfe, 0x00, 0x01, 0x8f, 0xb0,
+  0xfe, 0x00, 0x05, 0x1e, 0xfa, 0x20, 0x04, 0xc0, 0x04, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x29, 0xdf,
+  0xfb, 0x40, 0xed, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xd9, 0x20, 0x00,  //@@@@@%...
-  0xff, 0xff, 0xff, 0xf5, 0x00,  //@@@@@@@+.
-  0xff, 0x00, 0x29, 0xff, 0x20,  //@@...%@@.
-  0xff, 0x00, 0x00, 0x9f, 0x80,  //@@....%@%
-  0xff, 0x00, 0x00, 0x3f, 0xc0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xe0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xe0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x3f, 0xc0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x9f, 0x90,  //@@....%@%
-  0xff, 0x00, 0x29, 0xff, 0x20,  //@@...%@@.
-  0xff, 0xff, 0xff, 0xf6, 0x00,  //@@@@@@@+.
-  0xff, 0xff, 0xd9, 0x20, 0x00,  //@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x04, 0xff, 0xff, 0xd9, 0x20, 0x00, 0xfe, 0xff, 0x2e, 0xf5, 0x00, 0xff, 0x00, 0x29,
+  0xff, 0x20, 0xff, 0x00, 0x00, 0x9f, 0x80, 0xff, 0x00, 0x00, 0x3f, 0xc0, 0xff, 0x00, 0x00, 0x0f,
+  0xe0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xe0, 0xff, 0x00, 0x00, 0x3f, 0xc0,
+  0xff, 0x00, 0x00, 0x9f, 0x90, 0xff, 0x00, 0x29, 0xff, 0x20, 0xfe, 0xff, 0x05, 0xf6, 0x00, 0xff,
+  0xff, 0xd9, 0x20, 0xec, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+  0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0,
+  0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+  0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xe9, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x29, 0xdf, 0xeb, 0x40,  //...%@@@%+
-  0x04, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@
-  0x1e, 0xfa, 0x20, 0x14, 0xb0,  //.@@%...+%
-  0x7f, 0xa0, 0x00, 0x00, 0x00,  //+@%......
-  0xcf, 0x40, 0x00, 0x00, 0x00,  //@@+......
-  0xef, 0x00, 0x0f, 0xff, 0xf0,  //@@...@@@@
-  0xff, 0x00, 0x0f, 0xff, 0xf0,  //@@...@@@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xcf, 0x30, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x8f, 0x90, 0x00, 0x0f, 0xf0,  //%@%....@@
-  0x1f, 0xf7, 0x10, 0x4f, 0xf0,  //.@@+..+@@
-  0x05, 0xff, 0xff, 0xff, 0xa0,  //.+@@@@@@%
-  0x00, 0x3a, 0xef, 0xd6, 0x00,  //...%@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x04, 0x29, 0xdf, 0xeb, 0x40, 0x04, 0xfe, 0xff, 0x07, 0xf0, 0x1e, 0xfa, 0x20, 0x14,
+  0xb0, 0x7f, 0xa0, 0xfe, 0x00, 0x01, 0xcf, 0x40, 0xfe, 0x00, 0x1e, 0xef, 0x00, 0x0f, 0xff, 0xf0,
+  0xff, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xcf, 0x30, 0x00, 0x0f, 0xf0, 0x8f,
+  0x90, 0x00, 0x0f, 0xf0, 0x1f, 0xf7, 0x10, 0x4f, 0xf0, 0x05, 0xfe, 0xff, 0x04, 0xa0, 0x00, 0x3a,
+  0xef, 0xd6, 0xec, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x18, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xfd, 0xff, 0x00, 0xf0,
+  0xfd, 0xff, 0x1e, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00,
+  0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf5, 0x00, 0xf9, 0xff, 0x23, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+004a (J) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0xff, 0xff, 0xf0,  //..@@@@@
-  0x00, 0xff, 0xff, 0xf0,  //..@@@@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x0f, 0xf0,  //.....@@
-  0x00, 0x00, 0x1f, 0xf0,  //.....@@
-  0xb4, 0x01, 0x9f, 0xc0,  //%+..%@@
-  0xff, 0xff, 0xff, 0x60,  //@@@@@@+
-  0x4b, 0xef, 0xd7, 0x00,  //+%@@@+.
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf4, 0x00, 0x2a, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0xb4, 0x01, 0x9f, 0xc0, 0xfe, 0xff,
+  0x03, 0x60, 0x4b, 0xef, 0xd7, 0xf0, 0x00,
 
   /*Unicode: U+004b (K) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0x00, 0x00, 0x1d, 0xe3,  //@@.....@@.
-  0xff, 0x00, 0x01, 0xdf, 0x30,  //@@....@@..
-  0xff, 0x00, 0x0c, 0xf4, 0x00,  //@@...@@+..
-  0xff, 0x00, 0xcf, 0x40, 0x00,  //@@..@@+...
-  0xff, 0x0b, 0xf4, 0x00, 0x00,  //@@.%@+....
-  0xff, 0xbf, 0xb0, 0x00, 0x00,  //@@%@%.....
-  0xff, 0xff, 0xf5, 0x00, 0x00,  //@@@@@+....
-  0xff, 0x66, 0xfe, 0x10, 0x00,  //@@++@@....
-  0xff, 0x00, 0xbf, 0xb0, 0x00,  //@@..%@%...
-  0xff, 0x00, 0x1e, 0xf6, 0x00,  //@@...@@+..
-  0xff, 0x00, 0x05, 0xff, 0x10,  //@@...+@@..
-  0xff, 0x00, 0x00, 0xaf, 0xb0,  //@@....%@%.
-  0xff, 0x00, 0x00, 0x1e, 0xf6,  //@@.....@@+
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x40, 0xff, 0x00, 0x00, 0x1d, 0xe3, 0xff, 0x00, 0x01, 0xdf, 0x30, 0xff, 0x00, 0x0c,
+  0xf4, 0x00, 0xff, 0x00, 0xcf, 0x40, 0x00, 0xff, 0x0b, 0xf4, 0x00, 0x00, 0xff, 0xbf, 0xb0, 0x00,
+  0x00, 0xff, 0xff, 0xf5, 0x00, 0x00, 0xff, 0x66, 0xfe, 0x10, 0x00, 0xff, 0x00, 0xbf, 0xb0, 0x00,
+  0xff, 0x00, 0x1e, 0xf6, 0x00, 0xff, 0x00, 0x05, 0xff, 0x10, 0xff, 0x00, 0x00, 0xaf, 0xb0, 0xff,
+  0x00, 0x00, 0x1e, 0xf6, 0xed, 0x00,
 
   /*Unicode: U+004c (L) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff,
+  0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+004d (M) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xc0, 0x00, 0xcf, 0xf0,  //@@@...@@@
-  0xff, 0xf1, 0x01, 0xff, 0xf0,  //@@@...@@@
-  0xff, 0xd5, 0x05, 0xdf, 0xf0,  //@@@+.+@@@
-  0xff, 0x8a, 0x0a, 0x8f, 0xf0,  //@@%%.%%@@
-  0xff, 0x3e, 0x0e, 0x3f, 0xf0,  //@@.@.@.@@
-  0xff, 0x0e, 0x8e, 0x0f, 0xf0,  //@@.@%@.@@
-  0xff, 0x0a, 0xfa, 0x0f, 0xf0,  //@@.%@%.@@
-  0xff, 0x05, 0xf5, 0x0f, 0xf0,  //@@.+@+.@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x40, 0xff, 0xc0, 0x00, 0xcf, 0xf0, 0xff, 0xf1, 0x01, 0xff, 0xf0, 0xff, 0xd5, 0x05,
+  0xdf, 0xf0, 0xff, 0x8a, 0x0a, 0x8f, 0xf0, 0xff, 0x3e, 0x0e, 0x3f, 0xf0, 0xff, 0x0e, 0x8e, 0x0f,
+  0xf0, 0xff, 0x0a, 0xfa, 0x0f, 0xf0, 0xff, 0x05, 0xf5, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+004e (N) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xc0, 0x00, 0x0f, 0xf0,  //@@@....@@
-  0xff, 0xf2, 0x00, 0x0f, 0xf0,  //@@@....@@
-  0xff, 0xe9, 0x00, 0x0f, 0xf0,  //@@@%...@@
-  0xff, 0x7f, 0x00, 0x0f, 0xf0,  //@@+@...@@
-  0xff, 0x1f, 0x60, 0x0f, 0xf0,  //@@.@+..@@
-  0xff, 0x0a, 0xd0, 0x0f, 0xf0,  //@@.%@..@@
-  0xff, 0x04, 0xf3, 0x0f, 0xf0,  //@@.+@..@@
-  0xff, 0x00, 0xda, 0x0f, 0xf0,  //@@..@%.@@
-  0xff, 0x00, 0x6f, 0x1f, 0xf0,  //@@..+@.@@
-  0xff, 0x00, 0x0f, 0x7f, 0xf0,  //@@...@+@@
-  0xff, 0x00, 0x09, 0xef, 0xf0,  //@@...%@@@
-  0xff, 0x00, 0x02, 0xff, 0xf0,  //@@....@@@
-  0xff, 0x00, 0x00, 0xcf, 0xf0,  //@@....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x40, 0xff, 0xc0, 0x00, 0x0f, 0xf0, 0xff, 0xf2, 0x00, 0x0f, 0xf0, 0xff, 0xe9, 0x00,
+  0x0f, 0xf0, 0xff, 0x7f, 0x00, 0x0f, 0xf0, 0xff, 0x1f, 0x60, 0x0f, 0xf0, 0xff, 0x0a, 0xd0, 0x0f,
+  0xf0, 0xff, 0x04, 0xf3, 0x0f, 0xf0, 0xff, 0x00, 0xda, 0x0f, 0xf0, 0xff, 0x00, 0x6f, 0x1f, 0xf0,
+  0xff, 0x00, 0x0f, 0x7f, 0xf0, 0xff, 0x00, 0x09, 0xef, 0xf0, 0xff, 0x00, 0x02, 0xff, 0xf0, 0xff,
+  0x00, 0x00, 0xcf, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+004f (O) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x3e, 0x8e, 0xfe, 0x80, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef,
+  0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf,
+  0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e,
+  0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xfe, 0xa2, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0x30,  //@@@@@@@@.
-  0xff, 0x00, 0x03, 0xcf, 0xb0,  //@@....@@%
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x03, 0xcf, 0xb0,  //@@....@@%
-  0xff, 0xff, 0xff, 0xff, 0x30,  //@@@@@@@@.
-  0xff, 0xff, 0xfe, 0xa2, 0x00,  //@@@@@@%..
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x04, 0xff, 0xff, 0xfe, 0xa2, 0x00, 0xfd, 0xff, 0x14, 0x30, 0xff, 0x00, 0x03, 0xcf,
+  0xb0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x03, 0xcf, 0xb0,
+  0xfd, 0xff, 0x06, 0x30, 0xff, 0xff, 0xfe, 0xa2, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xe9, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xe0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0x90,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x30,  //+@@...@@.
-  0x0c, 0xff, 0xff, 0xf8, 0x00,  //.@@@@@@%.
-  0x00, 0x8e, 0xff, 0xb0, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x0a, 0xf9, 0x00,  //.....%@%.
-  0x00, 0x00, 0x00, 0xaa, 0x00,  //......%%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x3e, 0x8e, 0xfe, 0x80, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef,
+  0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xe0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf,
+  0x60, 0x00, 0x6f, 0x90, 0x5f, 0xe3, 0x03, 0xef, 0x30, 0x0c, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x8e,
+  0xff, 0xb0, 0xfe, 0x00, 0x01, 0x0a, 0xf9, 0xfd, 0x00, 0x00, 0xaa, 0xf6, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xfd, 0xa2, 0x00,  //@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0x30,  //@@@@@@@@..
-  0xff, 0x00, 0x03, 0xcf, 0xc0,  //@@....@@@.
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x1f, 0xe0,  //@@.....@@.
-  0xff, 0x00, 0x02, 0xbf, 0x90,  //@@....%@%.
-  0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@%..
-  0xff, 0xff, 0xff, 0xc2, 0x00,  //@@@@@@@...
-  0xff, 0x00, 0x18, 0xfd, 0x00,  //@@...%@@..
-  0xff, 0x00, 0x00, 0xbf, 0x70,  //@@....%@+.
-  0xff, 0x00, 0x00, 0x3f, 0xe0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0c, 0xf5,  //@@.....@@+
-  0xff, 0x00, 0x00, 0x05, 0xfc,  //@@.....+@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x04, 0xff, 0xff, 0xfd, 0xa2, 0x00, 0xfd, 0xff, 0x14, 0x30, 0xff, 0x00, 0x03, 0xcf,
+  0xc0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0x02, 0xbf, 0x90,
+  0xfe, 0xff, 0x01, 0xf9, 0x00, 0xfe, 0xff, 0x1a, 0xc2, 0x00, 0xff, 0x00, 0x18, 0xfd, 0x00, 0xff,
+  0x00, 0x00, 0xbf, 0x70, 0xff, 0x00, 0x00, 0x3f, 0xe0, 0xff, 0x00, 0x00, 0x0c, 0xf5, 0xff, 0x00,
+  0x00, 0x05, 0xfc, 0xed, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x02, 0xae, 0xfe, 0x93, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0xcf, 0xb3, 0x01, 0x4b, 0x00,  //@@%...+%.
-  0xff, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0xdf, 0x81, 0x00, 0x00, 0x00,  //@@%......
-  0x5f, 0xff, 0xda, 0x40, 0x00,  //+@@@@%+..
-  0x04, 0xbf, 0xff, 0xfc, 0x00,  //.+%@@@@@.
-  0x00, 0x00, 0x26, 0xdf, 0x80,  //.....+@@%
-  0x00, 0x00, 0x00, 0x2f, 0xd0,  //.......@@
-  0x00, 0x00, 0x00, 0x1f, 0xf0,  //.......@@
-  0xc6, 0x20, 0x03, 0xcf, 0xd0,  //@+....@@@
-  0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+
-  0x39, 0xdf, 0xfe, 0xa3, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x05, 0x02, 0xae, 0xfe, 0x93, 0x00, 0x3f, 0xfe, 0xff, 0x07, 0x00, 0xcf, 0xb3, 0x01,
+  0x4b, 0x00, 0xff, 0x10, 0xfe, 0x00, 0x01, 0xdf, 0x81, 0xfe, 0x00, 0x08, 0x5f, 0xff, 0xda, 0x40,
+  0x00, 0x04, 0xbf, 0xff, 0xfc, 0xfe, 0x00, 0x02, 0x26, 0xdf, 0x80, 0xfe, 0x00, 0x01, 0x2f, 0xd0,
+  0xfe, 0x00, 0x06, 0x1f, 0xf0, 0xc6, 0x20, 0x03, 0xcf, 0xd0, 0xfd, 0xff, 0x04, 0x40, 0x39, 0xdf,
+  0xfe, 0xa3, 0xec, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0xf7, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xeb, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xaf, 0xa2, 0x02, 0xbf, 0xa0,  //%@%...%@%
-  0x2f, 0xff, 0xff, 0xff, 0x20,  //.@@@@@@@.
-  0x02, 0xae, 0xfe, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x37, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xef, 0x10, 0x00, 0x1f, 0xe0, 0xaf, 0xa2, 0x02, 0xbf, 0xa0, 0x2f, 0xfe, 0xff, 0x04, 0x20, 0x02,
+  0xae, 0xfe, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0x5f, 0xb0, 0x00, 0xcf, 0x50,  //+@%...@@+
-  0x1f, 0xf0, 0x00, 0xff, 0x00,  //.@@...@@.
-  0x0c, 0xf4, 0x04, 0xfc, 0x00,  //.@@+.+@@.
-  0x08, 0xf8, 0x08, 0xf8, 0x00,  //.%@%.%@%.
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x00, 0xff, 0x3f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0xbf, 0xbf, 0xb0, 0x00,  //..%@%@%..
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x0e, 0xfe, 0x00, 0x00,  //...@@@...
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x39, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0x5f, 0xb0, 0x00,
+  0xcf, 0x50, 0x1f, 0xf0, 0x00, 0xff, 0x00, 0x0c, 0xf4, 0x04, 0xfc, 0x00, 0x08, 0xf8, 0x08, 0xf8,
+  0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x00, 0xff, 0x3f, 0xf0, 0x00, 0x00, 0xbf, 0xbf, 0xb0, 0x00,
+  0x00, 0x6f, 0xff, 0x60, 0x00, 0x00, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x0e, 0xfe, 0xfe, 0x00, 0x01,
+  0x09, 0xf9, 0xeb, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xef, 0x10, 0x00, 0x00, 0x1f, 0xe0,  //@@.......@@
-  0xcf, 0x30, 0x00, 0x00, 0x3f, 0xc0,  //@@.......@@
-  0x9f, 0x60, 0x00, 0x00, 0x6f, 0x90,  //%@+.....+@%
-  0x7f, 0x80, 0x00, 0x00, 0x8f, 0x70,  //+@%.....%@+
-  0x4f, 0xb0, 0x9f, 0x90, 0xbf, 0x40,  //+@%.%@%.%@+
-  0x2f, 0xd0, 0xcf, 0xc0, 0xdf, 0x20,  //.@@.@@@.@@.
-  0x0f, 0xf0, 0xf9, 0xf1, 0xff, 0x00,  //.@@.@%@.@@.
-  0x0d, 0xf6, 0xf1, 0xf6, 0xfd, 0x00,  //.@@+@.@+@@.
-  0x0b, 0xfc, 0xc0, 0xcc, 0xfb, 0x00,  //.%@@@.@@@%.
-  0x08, 0xff, 0x80, 0x8f, 0xf8, 0x00,  //.%@@%.%@@%.
-  0x06, 0xff, 0x40, 0x4f, 0xf6, 0x00,  //.+@@+.+@@+.
-  0x03, 0xff, 0x00, 0x0f, 0xf3, 0x00,  //..@@...@@..
-  0x01, 0xfc, 0x00, 0x0c, 0xf1, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xef, 0x00, 0x4c, 0xef, 0x10, 0x00, 0x00, 0x1f, 0xe0, 0xcf, 0x30, 0x00, 0x00, 0x3f, 0xc0, 0x9f,
+  0x60, 0x00, 0x00, 0x6f, 0x90, 0x7f, 0x80, 0x00, 0x00, 0x8f, 0x70, 0x4f, 0xb0, 0x9f, 0x90, 0xbf,
+  0x40, 0x2f, 0xd0, 0xcf, 0xc0, 0xdf, 0x20, 0x0f, 0xf0, 0xf9, 0xf1, 0xff, 0x00, 0x0d, 0xf6, 0xf1,
+  0xf6, 0xfd, 0x00, 0x0b, 0xfc, 0xc0, 0xcc, 0xfb, 0x00, 0x08, 0xff, 0x80, 0x8f, 0xf8, 0x00, 0x06,
+  0xff, 0x40, 0x4f, 0xf6, 0x00, 0x03, 0xff, 0x00, 0x0f, 0xf3, 0x00, 0x01, 0xfc, 0x00, 0x0c, 0xf1,
+  0xe8, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xbf, 0x90, 0x00, 0xaf, 0xb0,  //%@%...%@%
-  0x2f, 0xf2, 0x03, 0xff, 0x20,  //.@@...@@.
-  0x08, 0xfc, 0x0d, 0xf7, 0x00,  //.%@@.@@+.
-  0x00, 0xef, 0xbf, 0xd0, 0x00,  //..@@%@@..
-  0x00, 0x6f, 0xff, 0x40, 0x00,  //..+@@@+..
-  0x00, 0x0c, 0xfb, 0x00, 0x00,  //...@@%...
-  0x00, 0x0a, 0xf8, 0x00, 0x00,  //...%@%...
-  0x00, 0x2f, 0xff, 0x10, 0x00,  //...@@@...
-  0x00, 0xaf, 0xff, 0x90, 0x00,  //..%@@@%..
-  0x03, 0xff, 0x3f, 0xf2, 0x00,  //..@@.@@..
-  0x0b, 0xf8, 0x09, 0xfa, 0x00,  //.%@%.%@%.
-  0x3f, 0xf1, 0x01, 0xff, 0x30,  //.@@...@@.
-  0xbf, 0x80, 0x00, 0x8f, 0xb0,  //%@%...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x1b, 0xbf, 0x90, 0x00, 0xaf, 0xb0, 0x2f, 0xf2, 0x03, 0xff, 0x20, 0x08, 0xfc, 0x0d,
+  0xf7, 0x00, 0x00, 0xef, 0xbf, 0xd0, 0x00, 0x00, 0x6f, 0xff, 0x40, 0x00, 0x00, 0x0c, 0xfb, 0xfe,
+  0x00, 0x01, 0x0a, 0xf8, 0xfe, 0x00, 0x1c, 0x2f, 0xff, 0x10, 0x00, 0x00, 0xaf, 0xff, 0x90, 0x00,
+  0x03, 0xff, 0x3f, 0xf2, 0x00, 0x0b, 0xf8, 0x09, 0xfa, 0x00, 0x3f, 0xf1, 0x01, 0xff, 0x30, 0xbf,
+  0x80, 0x00, 0x8f, 0xb0, 0xed, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xbf, 0x90, 0x00, 0x09, 0xfb,  //%@%....%@%
-  0x2f, 0xf2, 0x00, 0x2f, 0xf2,  //.@@....@@.
-  0x09, 0xfa, 0x00, 0xaf, 0x90,  //.%@%..%@%.
-  0x01, 0xff, 0x33, 0xff, 0x10,  //..@@..@@..
-  0x00, 0x7f, 0xcc, 0xf7, 0x00,  //..+@@@@+..
-  0x00, 0x0e, 0xff, 0xe0, 0x00,  //...@@@@...
-  0x00, 0x05, 0xff, 0x50, 0x00,  //...+@@+...
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x21, 0xbf, 0x90, 0x00, 0x09, 0xfb, 0x2f, 0xf2, 0x00, 0x2f, 0xf2, 0x09, 0xfa, 0x00,
+  0xaf, 0x90, 0x01, 0xff, 0x33, 0xff, 0x10, 0x00, 0x7f, 0xcc, 0xf7, 0x00, 0x00, 0x0e, 0xff, 0xe0,
+  0x00, 0x00, 0x05, 0xff, 0x50, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00,
+  0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xeb, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@
-  0x00, 0x00, 0x02, 0xff, 0x30,  //......@@.
-  0x00, 0x00, 0x0b, 0xf9, 0x00,  //.....%@%.
-  0x00, 0x00, 0x6f, 0xe1, 0x00,  //....+@@..
-  0x00, 0x01, 0xef, 0x50, 0x00,  //....@@+..
-  0x00, 0x0a, 0xfb, 0x00, 0x00,  //...%@%...
-  0x00, 0x4f, 0xf2, 0x00, 0x00,  //..+@@....
-  0x00, 0xef, 0x80, 0x00, 0x00,  //..@@%....
-  0x09, 0xfd, 0x00, 0x00, 0x00,  //.%@@.....
-  0x3f, 0xf4, 0x00, 0x00, 0x00,  //.@@+.....
-  0xdf, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x09, 0xd0, 0x00, 0x00, 0x02, 0xff, 0x30, 0x00,
+  0x00, 0x0b, 0xf9, 0xfe, 0x00, 0x0a, 0x6f, 0xe1, 0x00, 0x00, 0x01, 0xef, 0x50, 0x00, 0x00, 0x0a,
+  0xfb, 0xfe, 0x00, 0x01, 0x4f, 0xf2, 0xfe, 0x00, 0x05, 0xef, 0x80, 0x00, 0x00, 0x09, 0xfd, 0xfe,
+  0x00, 0x01, 0x3f, 0xf4, 0xfe, 0x00, 0x00, 0xdf, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0,
+  0xed, 0x00,
 
   /*Unicode: U+005b ([) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0xff, 0xff,  //@@@@
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0x00,  //@@..
-  0xff, 0xff,  //@@@@
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfc, 0xff, 0x16, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfd, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+005c (\) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xcf, 0x30, 0x00, 0x00, 0x00,  //@@.......
-  0x4f, 0xb0, 0x00, 0x00, 0x00,  //+@%......
-  0x0d, 0xf2, 0x00, 0x00, 0x00,  //.@@......
-  0x05, 0xfa, 0x00, 0x00, 0x00,  //.+@%.....
-  0x00, 0xef, 0x10, 0x00, 0x00,  //..@@.....
-  0x00, 0x6f, 0x80, 0x00, 0x00,  //..+@%....
-  0x00, 0x0e, 0xf1, 0x00, 0x00,  //...@@....
-  0x00, 0x07, 0xf7, 0x00, 0x00,  //...+@+...
-  0x00, 0x01, 0xfe, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x9f, 0x60, 0x00,  //....%@+..
-  0x00, 0x00, 0x1f, 0xe0, 0x00,  //.....@@..
-  0x00, 0x00, 0x0a, 0xf5, 0x00,  //.....%@+.
-  0x00, 0x00, 0x02, 0xfd, 0x00,  //......@@.
-  0x00, 0x00, 0x00, 0xbf, 0x40,  //......%@+
-  0x00, 0x00, 0x00, 0x3f, 0xc0,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x01, 0xcf, 0x30, 0xfe, 0x00, 0x01, 0x4f, 0xb0, 0xfe, 0x00, 0x01, 0x0d, 0xf2, 0xfe,
+  0x00, 0x01, 0x05, 0xfa, 0xfd, 0x00, 0x01, 0xef, 0x10, 0xfe, 0x00, 0x01, 0x6f, 0x80, 0xfe, 0x00,
+  0x01, 0x0e, 0xf1, 0xfe, 0x00, 0x01, 0x07, 0xf7, 0xfe, 0x00, 0x01, 0x01, 0xfe, 0xfd, 0x00, 0x01,
+  0x9f, 0x60, 0xfe, 0x00, 0x01, 0x1f, 0xe0, 0xfe, 0x00, 0x01, 0x0a, 0xf5, 0xfe, 0x00, 0x01, 0x02,
+  0xfd, 0xfd, 0x00, 0x01, 0xbf, 0x40, 0xfe, 0x00, 0x01, 0x3f, 0xc0, 0xf7, 0x00,
 
   /*Unicode: U+005d (]) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0xff, 0xff,  //@@@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0x00, 0xff,  //..@@
-  0xff, 0xff,  //@@@@
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0xfd, 0xff, 0x16, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+005e (^) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x03, 0xff, 0x30, 0x00,  //....@@....
-  0x00, 0x2e, 0xdd, 0xe2, 0x00,  //...@@@@...
-  0x00, 0xde, 0x11, 0xed, 0x00,  //..@@..@@..
-  0x0b, 0xe2, 0x00, 0x2e, 0xb0,  //.%@....@%.
-  0x9e, 0x20, 0x00, 0x02, 0xe9,  //%@......@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf1, 0x00, 0x17, 0x03, 0xff, 0x30, 0x00, 0x00, 0x2e, 0xdd, 0xe2, 0x00, 0x00, 0xde, 0x11, 0xed,
+  0x00, 0x0b, 0xe2, 0x00, 0x2e, 0xb0, 0x9e, 0x20, 0x00, 0x02, 0xe9, 0xc5, 0x00,
 
   /*Unicode: U+005f (_) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-
+  0x95, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0,
 
   /*Unicode: U+0060 (`) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x8e, 0x10,  //%@..
-  0x0a, 0xc0,  //.%@.
-  0x00, 0xb9,  //..%%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x05, 0x8e, 0x10, 0x0a, 0xc0, 0x00, 0xb9, 0xe3, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x05, 0x03, 0x9e, 0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02,
+  0xaf, 0xb0, 0xfe, 0x00, 0x07, 0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14,
+  0xf0, 0xef, 0x71, 0x00, 0x1f, 0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0,
+  0x08, 0xdf, 0xd7, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x09, 0xfe, 0xa1, 0x00,  //@@.%@@%..
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0x0a, 0xfe, 0xa1, 0x00,  //@@.%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x30, 0xff, 0x09, 0xfe, 0xa1, 0x00, 0xff, 0xaf, 0xff, 0xfe, 0x10, 0xff, 0xd3, 0x03,
+  0xdf, 0x80, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0xd3, 0x03, 0xdf, 0x80, 0xff, 0xaf, 0xff, 0xfe, 0x10,
+  0xff, 0x0a, 0xfe, 0xa1, 0xec, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x7c, 0xff, 0xb4,  //..+@@@%+
-  0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x7f, 0xe6, 0x10, 0x3a,  //+@@+...%
-  0xcf, 0x50, 0x00, 0x00,  //@@+.....
-  0xff, 0x10, 0x00, 0x00,  //@@......
-  0xff, 0x10, 0x00, 0x00,  //@@......
-  0xcf, 0x50, 0x00, 0x00,  //@@+.....
-  0x7f, 0xe6, 0x10, 0x3a,  //+@@+...%
-  0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x00, 0x7c, 0xff, 0xc4,  //..+@@@@+
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe8, 0x00, 0x03, 0x7c, 0xff, 0xb4, 0x0b, 0xfe, 0xff, 0x18, 0x7f, 0xe6, 0x10, 0x3a, 0xcf, 0x50,
+  0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xcf, 0x50, 0x00, 0x00, 0x7f, 0xe6,
+  0x10, 0x3a, 0x0b, 0xfe, 0xff, 0x03, 0x00, 0x7c, 0xff, 0xc4, 0xf1, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x01, 0xae, 0xf9, 0x0f, 0xf0,  //..%@@%.@@
-  0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-  0x02, 0xae, 0xfa, 0x0f, 0xf0,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf4, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe,
+  0x00, 0x33, 0x0f, 0xf0, 0x01, 0xae, 0xf9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3,
+  0x03, 0xdf, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xdf, 0xf0, 0x1e, 0xff, 0xff, 0xaf,
+  0xf0, 0x02, 0xae, 0xfa, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-  0x0b, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@.
-  0x7f, 0xc3, 0x02, 0xbf, 0x90,  //+@@...%@%
-  0xcf, 0x20, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xcf, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0x7f, 0xc4, 0x10, 0x26, 0xc0,  //+@@+...+@
-  0x0b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0x00, 0x6c, 0xff, 0xd9, 0x30,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe2, 0x00, 0x12, 0x7d, 0xfe, 0xa2, 0x00, 0x0b, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xc3, 0x02, 0xbf,
+  0x90, 0xcf, 0x20, 0x00, 0x1f, 0xd0, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x02, 0xf0, 0xcf, 0x10,
+  0xfe, 0x00, 0x05, 0x7f, 0xc4, 0x10, 0x26, 0xc0, 0x0b, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x6c, 0xff,
+  0xd9, 0x30, 0xed, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x9e, 0xff,  //....%@@@
-  0x00, 0x09, 0xff, 0xff,  //...%@@@@
-  0x00, 0x0e, 0xf4, 0x00,  //...@@+..
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf7, 0x00, 0x0d, 0x9e, 0xff, 0x00, 0x09, 0xff, 0xff, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0xf9, 0xff, 0x1e, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0xf0, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0xae, 0xe9, 0x0f, 0xf0,  //..%@@%.@@
-  0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0x1e, 0xff, 0xff, 0x9f, 0xf0,  //.@@@@@%@@
-  0x01, 0xae, 0xfa, 0x1f, 0xf0,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x3f, 0xd0,  //.......@@
-  0x0c, 0x51, 0x03, 0xcf, 0x80,  //.@+...@@%
-  0x0f, 0xff, 0xff, 0xfd, 0x10,  //.@@@@@@@.
-  0x03, 0xae, 0xfd, 0x91, 0x00,  //..%@@@%..
-
+  0xe3, 0x00, 0x31, 0x01, 0xae, 0xe9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3, 0x03,
+  0xdf, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xdf, 0xf0, 0x1e, 0xff, 0xff, 0x9f, 0xf0,
+  0x01, 0xae, 0xfa, 0x1f, 0xf0, 0xfe, 0x00, 0x10, 0x3f, 0xd0, 0x0c, 0x51, 0x03, 0xcf, 0x80, 0x0f,
+  0xff, 0xff, 0xfd, 0x10, 0x03, 0xae, 0xfd, 0x91, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x06, 0xdf, 0xd6, 0x00,  //@@.+@@@+.
-  0xff, 0x7f, 0xff, 0xff, 0x50,  //@@+@@@@@+
-  0xff, 0xd4, 0x01, 0xbf, 0xc0,  //@@@+..%@@
-  0xff, 0x40, 0x00, 0x2f, 0xf0,  //@@+....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x31, 0xff, 0x06, 0xdf, 0xd6, 0x00, 0xff, 0x7f, 0xff, 0xff, 0x50, 0xff, 0xd4, 0x01,
+  0xbf, 0xc0, 0xff, 0x40, 0x00, 0x2f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf8, 0x00, 0x05, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+006a (j) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x0f, 0xff, 0xff,  //.@@@@@
-  0x0f, 0xff, 0xff,  //.@@@@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xff,  //....@@
-  0x00, 0x00, 0xfe,  //....@@
-  0x00, 0x08, 0xfc,  //...%@@
-  0xff, 0xff, 0xf5,  //@@@@@+
-  0xff, 0xfd, 0x60,  //@@@@+.
-
+  0xf9, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x29, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x08, 0xfc, 0xff, 0xff,
+  0xf5, 0xff, 0xfd, 0x60,
 
   /*Unicode: U+006b (k) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0x00, 0x03, 0xef, 0xb0,  //@@....@@%.
-  0xff, 0x00, 0x4f, 0xfa, 0x00,  //@@..+@@%..
-  0xff, 0x04, 0xff, 0x90, 0x00,  //@@.+@@%...
-  0xff, 0x5f, 0xf9, 0x00, 0x00,  //@@+@@%....
-  0xff, 0xff, 0xf1, 0x00, 0x00,  //@@@@@.....
-  0xff, 0xfe, 0xfa, 0x00, 0x00,  //@@@@@%....
-  0xff, 0x71, 0xef, 0x60, 0x00,  //@@+.@@+...
-  0xff, 0x00, 0x5f, 0xf2, 0x00,  //@@..+@@...
-  0xff, 0x00, 0x09, 0xfd, 0x00,  //@@...%@@..
-  0xff, 0x00, 0x00, 0xdf, 0xa0,  //@@....@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x31, 0xff, 0x00, 0x03, 0xef, 0xb0, 0xff, 0x00, 0x4f, 0xfa, 0x00, 0xff, 0x04, 0xff,
+  0x90, 0x00, 0xff, 0x5f, 0xf9, 0x00, 0x00, 0xff, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xfe, 0xfa, 0x00,
+  0x00, 0xff, 0x71, 0xef, 0x60, 0x00, 0xff, 0x00, 0x5f, 0xf2, 0x00, 0xff, 0x00, 0x09, 0xfd, 0x00,
+  0xff, 0x00, 0x00, 0xdf, 0xa0, 0xed, 0x00,
 
   /*Unicode: U+006c (l) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0e, 0xf0, 0x00,  //...@@...
-  0x00, 0x0c, 0xf7, 0x00,  //...@@+..
-  0x00, 0x06, 0xff, 0xff,  //...+@@@@
-  0x00, 0x00, 0x8e, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf9, 0x00, 0x37, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0e, 0xf0, 0x00, 0x00,
+  0x0c, 0xf7, 0x00, 0x00, 0x06, 0xff, 0xff, 0x00, 0x00, 0x8e, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+006d (m) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0x5e, 0xc1, 0x8f, 0xc1,  //@@+@@.%@@.
-  0xff, 0xef, 0xfb, 0xff, 0xfa,  //@@@@@%@@@%
-  0xff, 0x44, 0xff, 0x54, 0xfd,  //@@++@@++@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0xff, 0x00, 0xff, 0x00, 0xff,  //@@..@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x31, 0xff, 0x5e, 0xc1, 0x8f, 0xc1, 0xff, 0xef, 0xfb, 0xff, 0xfa, 0xff, 0x44, 0xff,
+  0x54, 0xfd, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0xed, 0x00,
 
   /*Unicode: U+006e (n) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x06, 0xdf, 0xd6, 0x00,  //@@.+@@@+.
-  0xff, 0x7f, 0xff, 0xff, 0x50,  //@@+@@@@@+
-  0xff, 0xd4, 0x01, 0xbf, 0xc0,  //@@@+..%@@
-  0xff, 0x40, 0x00, 0x2f, 0xf0,  //@@+....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x31, 0xff, 0x06, 0xdf, 0xd6, 0x00, 0xff, 0x7f, 0xff, 0xff, 0x50, 0xff, 0xd4, 0x01,
+  0xbf, 0xc0, 0xff, 0x40, 0x00, 0x2f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+006f (o) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x30, 0x01, 0x9e, 0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03,
+  0xdf, 0x80, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10,
+  0x01, 0x9e, 0xfe, 0x91, 0xec, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x09, 0xfe, 0xa1, 0x00,  //@@.%@@%..
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0x0a, 0xfe, 0xa2, 0x00,  //@@.%@@%..
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+  0xe3, 0x00, 0x32, 0xff, 0x09, 0xfe, 0xa1, 0x00, 0xff, 0xaf, 0xff, 0xfe, 0x10, 0xff, 0xd3, 0x03,
+  0xdf, 0x80, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0xd3, 0x03, 0xdf, 0x80, 0xff, 0xaf, 0xff, 0xfe, 0x10,
+  0xff, 0x0a, 0xfe, 0xa2, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0xae, 0xf9, 0x0f, 0xf0,  //..%@@%.@@
-  0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xf0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0xf0,  //%@@...@@@
-  0x1e, 0xff, 0xff, 0xaf, 0xf0,  //.@@@@@%@@
-  0x02, 0xae, 0xf9, 0x0f, 0xf0,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-
+  0xe3, 0x00, 0x31, 0x01, 0xae, 0xf9, 0x0f, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0, 0x8f, 0xd3, 0x03,
+  0xdf, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xf0, 0x8f, 0xd3, 0x03, 0xdf, 0xf0, 0x1e, 0xff, 0xff, 0xaf, 0xf0,
+  0x02, 0xae, 0xf9, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe,
+  0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0,
 
   /*Unicode: U+0072 (r) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0x07, 0xee, 0x60,  //@@.+@@+
-  0xff, 0x6f, 0xff, 0xf0,  //@@+@@@@
-  0xff, 0xd6, 0x11, 0x90,  //@@@+..%
-  0xff, 0x70, 0x00, 0x00,  //@@+....
-  0xff, 0x20, 0x00, 0x00,  //@@.....
-  0xff, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0x00, 0x00, 0x00,  //@@.....
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xe9, 0x00, 0x14, 0xff, 0x07, 0xee, 0x60, 0xff, 0x6f, 0xff, 0xf0, 0xff, 0xd6, 0x11, 0x90, 0xff,
+  0x70, 0x00, 0x00, 0xff, 0x20, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff,
+  0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xee, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x05, 0xbe, 0xff, 0xd9, 0x30,  //.+%@@@@%.
-  0x8f, 0xff, 0xff, 0xff, 0xf0,  //%@@@@@@@@
-  0xff, 0x82, 0x00, 0x26, 0xc0,  //@@%....+@
-  0xdf, 0xca, 0x87, 0x30, 0x00,  //@@@%%+...
-  0x3d, 0xff, 0xff, 0xfc, 0x10,  //.@@@@@@@.
-  0x00, 0x25, 0x7b, 0xff, 0xa0,  //...++%@@%
-  0x00, 0x00, 0x00, 0x2f, 0xe0,  //.......@@
-  0xc7, 0x30, 0x02, 0x8f, 0xe0,  //@+....%@@
-  0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@+
-  0x38, 0xcf, 0xfe, 0xb5, 0x00,  //.%@@@@%+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x05, 0x05, 0xbe, 0xff, 0xd9, 0x30, 0x8f, 0xfe, 0xff, 0x14, 0xf0, 0xff, 0x82, 0x00,
+  0x26, 0xc0, 0xdf, 0xca, 0x87, 0x30, 0x00, 0x3d, 0xff, 0xff, 0xfc, 0x10, 0x00, 0x25, 0x7b, 0xff,
+  0xa0, 0xfe, 0x00, 0x06, 0x2f, 0xe0, 0xc7, 0x30, 0x02, 0x8f, 0xe0, 0xfd, 0xff, 0x04, 0x70, 0x38,
+  0xcf, 0xfe, 0xb5, 0xec, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0f, 0xf0, 0x00, 0x00,  //...@@....
-  0x00, 0x0e, 0xf6, 0x00, 0x00,  //...@@+...
-  0x00, 0x09, 0xff, 0xff, 0xf0,  //...%@@@@@
-  0x00, 0x00, 0x9e, 0xff, 0xf0,  //....%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x03, 0x0f, 0xf0, 0x00,
+  0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x03, 0xf0, 0x00, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f,
+  0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0,
+  0xfe, 0x00, 0x01, 0x0e, 0xf6, 0xfe, 0x00, 0x08, 0x09, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x9e, 0xff,
+  0xf0, 0xed, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x20, 0x00, 0x4f, 0xf0,  //@@....+@@
-  0xcf, 0xb1, 0x04, 0xdf, 0xf0,  //@@%..+@@@
-  0x5f, 0xff, 0xff, 0x7f, 0xf0,  //+@@@@@+@@
-  0x06, 0xdf, 0xd6, 0x0f, 0xf0,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x31, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x20, 0x00, 0x4f, 0xf0, 0xcf, 0xb1, 0x04, 0xdf, 0xf0, 0x5f, 0xff, 0xff, 0x7f, 0xf0,
+  0x06, 0xdf, 0xd6, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x7f, 0xa0, 0x00, 0xaf, 0x70,  //+@%...%@+
-  0x2f, 0xf0, 0x00, 0xff, 0x20,  //.@@...@@.
-  0x0c, 0xf5, 0x05, 0xfc, 0x00,  //.@@+.+@@.
-  0x06, 0xfa, 0x0a, 0xf6, 0x00,  //.+@%.%@+.
-  0x01, 0xff, 0x1f, 0xf1, 0x00,  //..@@.@@..
-  0x00, 0xbf, 0xcf, 0xb0, 0x00,  //..%@@@%..
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0x1f, 0xff, 0x10, 0x00,  //...@@@...
-  0x00, 0x0b, 0xfb, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x2f, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0x7f, 0xa0, 0x00, 0xaf, 0x70, 0x2f, 0xf0, 0x00,
+  0xff, 0x20, 0x0c, 0xf5, 0x05, 0xfc, 0x00, 0x06, 0xfa, 0x0a, 0xf6, 0x00, 0x01, 0xff, 0x1f, 0xf1,
+  0x00, 0x00, 0xbf, 0xcf, 0xb0, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00, 0x00, 0x1f, 0xff, 0x10, 0x00,
+  0x00, 0x0b, 0xfb, 0xeb, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xef, 0x20, 0x00, 0x00, 0x2f, 0xe0,  //@@.......@@
-  0xaf, 0x60, 0x00, 0x00, 0x6f, 0xa0,  //%@+.....+@%
-  0x6f, 0xa0, 0x00, 0x00, 0xaf, 0x60,  //+@%.....%@+
-  0x2f, 0xe0, 0x5f, 0x50, 0xef, 0x20,  //.@@.+@+.@@.
-  0x0e, 0xf1, 0x9e, 0x91, 0xfe, 0x00,  //.@@.%@%.@@.
-  0x0b, 0xf5, 0xe7, 0xe5, 0xfb, 0x00,  //.%@+@+@+@%.
-  0x07, 0xfc, 0xe0, 0xec, 0xf7, 0x00,  //.+@@@.@@@+.
-  0x03, 0xff, 0xa0, 0xaf, 0xf3, 0x00,  //..@@%.%@@..
-  0x00, 0xff, 0x50, 0x5f, 0xf0, 0x00,  //..@@+.+@@..
-  0x00, 0xcf, 0x00, 0x1f, 0xc0, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xdd, 0x00, 0x3a, 0xef, 0x20, 0x00, 0x00, 0x2f, 0xe0, 0xaf, 0x60, 0x00, 0x00, 0x6f, 0xa0, 0x6f,
+  0xa0, 0x00, 0x00, 0xaf, 0x60, 0x2f, 0xe0, 0x5f, 0x50, 0xef, 0x20, 0x0e, 0xf1, 0x9e, 0x91, 0xfe,
+  0x00, 0x0b, 0xf5, 0xe7, 0xe5, 0xfb, 0x00, 0x07, 0xfc, 0xe0, 0xec, 0xf7, 0x00, 0x03, 0xff, 0xa0,
+  0xaf, 0xf3, 0x00, 0x00, 0xff, 0x50, 0x5f, 0xf0, 0x00, 0x00, 0xcf, 0x00, 0x1f, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x9f, 0xd0, 0x00, 0xdf, 0x90,  //%@@...@@%
-  0x0d, 0xf9, 0x0a, 0xfd, 0x00,  //.@@%.%@@.
-  0x02, 0xff, 0xaf, 0xf2, 0x00,  //..@@%@@..
-  0x00, 0x5f, 0xff, 0x50, 0x00,  //..+@@@+..
-  0x00, 0x0a, 0xfa, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x9f, 0xff, 0x90, 0x00,  //..%@@@%..
-  0x04, 0xff, 0x5f, 0xf4, 0x00,  //.+@@+@@+.
-  0x1e, 0xf7, 0x07, 0xfe, 0x10,  //.@@+.+@@.
-  0xaf, 0xc0, 0x00, 0xcf, 0xa0,  //%@@...@@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x16, 0x9f, 0xd0, 0x00, 0xdf, 0x90, 0x0d, 0xf9, 0x0a, 0xfd, 0x00, 0x02, 0xff, 0xaf,
+  0xf2, 0x00, 0x00, 0x5f, 0xff, 0x50, 0x00, 0x00, 0x0a, 0xfa, 0xfe, 0x00, 0x01, 0x0d, 0xfd, 0xfe,
+  0x00, 0x12, 0x9f, 0xff, 0x90, 0x00, 0x04, 0xff, 0x5f, 0xf4, 0x00, 0x1e, 0xf7, 0x07, 0xfe, 0x10,
+  0xaf, 0xc0, 0x00, 0xcf, 0xa0, 0xed, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xcf, 0x50, 0x00, 0x4f, 0xc0,  //@@+...+@@
-  0x6f, 0xc0, 0x00, 0xaf, 0x60,  //+@@...%@+
-  0x0e, 0xf3, 0x01, 0xff, 0x10,  //.@@...@@.
-  0x08, 0xf9, 0x06, 0xfb, 0x00,  //.%@%.+@%.
-  0x02, 0xff, 0x0c, 0xf5, 0x00,  //..@@.@@+.
-  0x00, 0xbf, 0x9f, 0xe0, 0x00,  //..%@%@@..
-  0x00, 0x5f, 0xff, 0x90, 0x00,  //..+@@@%..
-  0x00, 0x0e, 0xff, 0x30, 0x00,  //...@@@...
-  0x00, 0x07, 0xfe, 0x00, 0x00,  //...+@@...
-  0x00, 0x08, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xf3, 0x00, 0x00,  //...@@....
-  0x00, 0x6f, 0xe0, 0x00, 0x00,  //..+@@....
-  0x0f, 0xff, 0x70, 0x00, 0x00,  //.@@@+....
-  0x0f, 0xf9, 0x00, 0x00, 0x00,  //.@@%.....
-
+  0xe3, 0x00, 0x2a, 0xcf, 0x50, 0x00, 0x4f, 0xc0, 0x6f, 0xc0, 0x00, 0xaf, 0x60, 0x0e, 0xf3, 0x01,
+  0xff, 0x10, 0x08, 0xf9, 0x06, 0xfb, 0x00, 0x02, 0xff, 0x0c, 0xf5, 0x00, 0x00, 0xbf, 0x9f, 0xe0,
+  0x00, 0x00, 0x5f, 0xff, 0x90, 0x00, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0x00,
+  0x01, 0x08, 0xf9, 0xfe, 0x00, 0x01, 0x0d, 0xf3, 0xfe, 0x00, 0x0a, 0x6f, 0xe0, 0x00, 0x00, 0x0f,
+  0xff, 0x70, 0x00, 0x00, 0x0f, 0xf9, 0xfe, 0x00,
 
   /*Unicode: U+007a (z) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@
-  0x00, 0x00, 0x1e, 0xfe, 0x10,  //.....@@@.
-  0x00, 0x00, 0xcf, 0xe2, 0x00,  //....@@@..
-  0x00, 0x0a, 0xff, 0x30, 0x00,  //...%@@...
-  0x00, 0x7f, 0xf5, 0x00, 0x00,  //..+@@+...
-  0x04, 0xff, 0x60, 0x00, 0x00,  //.+@@+....
-  0x2e, 0xf8, 0x00, 0x00, 0x00,  //.@@%.....
-  0xdf, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x1b, 0xd0, 0x00, 0x00, 0x1e, 0xfe, 0x10, 0x00,
+  0x00, 0xcf, 0xe2, 0x00, 0x00, 0x0a, 0xff, 0x30, 0x00, 0x00, 0x7f, 0xf5, 0x00, 0x00, 0x04, 0xff,
+  0x60, 0x00, 0x00, 0x2e, 0xf8, 0xfe, 0x00, 0x00, 0xdf, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00,
+  0xf0, 0xed, 0x00,
 
   /*Unicode: U+007b ({) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x01, 0x9d, 0xff,  //....%@@@
-  0x00, 0x0a, 0xff, 0xff,  //...%@@@@
-  0x00, 0x0e, 0xf6, 0x00,  //...@@+..
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x01, 0x8f, 0xc0, 0x00,  //..%@@...
-  0xff, 0xfc, 0x30, 0x00,  //@@@@....
-  0xff, 0xfc, 0x20, 0x00,  //@@@@....
-  0x01, 0xaf, 0xb0, 0x00,  //..%@%...
-  0x00, 0x1f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0e, 0xf6, 0x00,  //...@@+..
-  0x00, 0x09, 0xff, 0xff,  //...%@@@@
-  0x00, 0x00, 0x9d, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf8, 0x00, 0x42, 0x01, 0x9d, 0xff, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x01, 0x8f, 0xc0, 0x00, 0xff, 0xfc,
+  0x30, 0x00, 0xff, 0xfc, 0x20, 0x00, 0x01, 0xaf, 0xb0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0x00, 0x00, 0x9d, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-
+  0x01, 0x00, 0x00, 0xef, 0xff,
 
   /*Unicode: U+007d (}) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xd9, 0x10, 0x00,  //@@@%....
-  0xff, 0xff, 0xa0, 0x00,  //@@@@%...
-  0x00, 0x6f, 0xe0, 0x00,  //..+@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0c, 0xf8, 0x10,  //...@@%..
-  0x00, 0x03, 0xcf, 0xff,  //....@@@@
-  0x00, 0x02, 0xcf, 0xff,  //....@@@@
-  0x00, 0x0b, 0xfa, 0x10,  //...%@%..
-  0x00, 0x0f, 0xf1, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x7f, 0xe0, 0x00,  //..+@@...
-  0xff, 0xff, 0x90, 0x00,  //@@@@%...
-  0xff, 0xd8, 0x00, 0x00,  //@@@%....
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf9, 0x00, 0x41, 0xff, 0xd9, 0x10, 0x00, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0c, 0xf8, 0x10, 0x00,
+  0x03, 0xcf, 0xff, 0x00, 0x02, 0xcf, 0xff, 0x00, 0x0b, 0xfa, 0x10, 0x00, 0x0f, 0xf1, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0xff,
+  0xff, 0x90, 0x00, 0xff, 0xd8, 0xfb, 0x00,
 
   /*Unicode: U+007e (~) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x6c, 0xfd, 0x93, 0x02, 0xa0,  //+@@@%...%
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xa2, 0x02, 0x7d, 0xfc, 0x60,  //%...+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
-
+  0xd4, 0x00, 0x04, 0x6c, 0xfd, 0x93, 0x02, 0xa0, 0xfd, 0xff, 0x05, 0xf0, 0xa2, 0x02, 0x7d, 0xfc,
+  0x60, 0xd9, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 8
   /*Unicode: U+0020 ( ) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0x89, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xf4, 0xf2,  //@@
-  0xe4, 0xe2,  //@@
-  0xd2, 0xd2,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xfb, 0x00, 0xf5, 0xff, 0x05, 0xf4, 0xf2, 0xe4, 0xe2, 0xd2, 0xd2, 0xfd, 0x00, 0xfd, 0xff, 0xf9,
+  0x00,
 
   /*Unicode: U+0022 (") , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xef, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x01, 0x00,
+  0x00, 0xfd, 0xff, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x6c, 0xf6, 0x04, 0x00, 0xcc, 0xa0, 0x00,  //....+@..@%.
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0xc2, 0x00, 0x0c, 0xfa, 0x64, 0x00,  //....%@..@+.
-  0x00, 0x00, 0x00, 0x00, 0xe4, 0x86, 0x00, 0x44, 0xff, 0x28, 0x00,  //....@%.+@..
-  0x00, 0x00, 0x00, 0x20, 0xff, 0x4c, 0x00, 0x80, 0xea, 0x00, 0x00,  //....@+.%@..
-  0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@
-  0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@
-  0x00, 0x00, 0x00, 0xc4, 0xa6, 0x00, 0x22, 0xff, 0x4a, 0x00, 0x00,  //...@%..@+..
-  0x00, 0x00, 0x26, 0xff, 0x46, 0x00, 0x82, 0xe6, 0x02, 0x00, 0x00,  //...@+.%@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00,  //@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00,  //@@@@@@@@@@.
-  0x00, 0x00, 0xcc, 0xa0, 0x00, 0x28, 0xff, 0x40, 0x00, 0x00, 0x00,  //..@%..@+...
-  0x00, 0x0c, 0xfa, 0x64, 0x00, 0x64, 0xfa, 0x0a, 0x00, 0x00, 0x00,  //..@+.+@....
-  0x00, 0x44, 0xff, 0x28, 0x00, 0xa0, 0xca, 0x00, 0x00, 0x00, 0x00,  //.+@..%@....
-  0x00, 0x80, 0xea, 0x00, 0x00, 0xdc, 0x90, 0x00, 0x00, 0x00, 0x00,  //.%@..@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe7, 0x00, 0x05, 0x6c, 0xf6, 0x04, 0x00, 0xcc, 0xa0, 0xfc, 0x00, 0x05, 0xa8, 0xc2, 0x00, 0x0c,
+  0xfa, 0x64, 0xfc, 0x00, 0x05, 0xe4, 0x86, 0x00, 0x44, 0xff, 0x28, 0xfd, 0x00, 0x05, 0x20, 0xff,
+  0x4c, 0x00, 0x80, 0xea, 0xfe, 0x00, 0x00, 0xf6, 0xf8, 0xff, 0x01, 0x00, 0xf6, 0xf8, 0xff, 0xfe,
+  0x00, 0x05, 0xc4, 0xa6, 0x00, 0x22, 0xff, 0x4a, 0xfd, 0x00, 0x08, 0x26, 0xff, 0x46, 0x00, 0x82,
+  0xe6, 0x02, 0x00, 0x00, 0xf8, 0xff, 0x01, 0xf6, 0x00, 0xf8, 0xff, 0x00, 0xf6, 0xfe, 0x00, 0x05,
+  0xcc, 0xa0, 0x00, 0x28, 0xff, 0x40, 0xfd, 0x00, 0x06, 0x0c, 0xfa, 0x64, 0x00, 0x64, 0xfa, 0x0a,
+  0xfd, 0x00, 0x05, 0x44, 0xff, 0x28, 0x00, 0xa0, 0xca, 0xfc, 0x00, 0x05, 0x80, 0xea, 0x00, 0x00,
+  0xdc, 0x90, 0xd1, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x40, 0xb4, 0xe6, 0xff, 0xe2, 0xa2, 0x36, 0x00,  //.+%@@@%..
-  0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //+@@@@@@@.
-  0xe2, 0xff, 0x90, 0x0e, 0xff, 0x18, 0x56, 0xc4, 0x00,  //@@%.@.+@.
-  0xf0, 0xff, 0x0c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@..@....
-  0xac, 0xff, 0x50, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //%@+.@....
-  0x14, 0xbc, 0xff, 0xc8, 0xff, 0x64, 0x24, 0x00, 0x00,  //.%@@@+...
-  0x00, 0x00, 0x34, 0x74, 0xff, 0xd8, 0xff, 0xa8, 0x10,  //...+@@@%.
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x5a, 0xff, 0xaa,  //....@.+@%
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x0c, 0xff, 0xf4,  //....@..@@
-  0xcc, 0x66, 0x18, 0x00, 0xff, 0x12, 0x90, 0xff, 0xe0,  //@+..@.%@@
-  0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xfc, 0x5c,  //@@@@@@@@+
-  0x2c, 0x88, 0xc6, 0xec, 0xff, 0xe4, 0xb2, 0x38, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xeb, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x01, 0xff, 0x02, 0xfd, 0x00, 0x08, 0x40, 0xb4, 0xe6, 0xff,
+  0xe2, 0xa2, 0x36, 0x00, 0x66, 0xfa, 0xff, 0x0e, 0x00, 0xe2, 0xff, 0x90, 0x0e, 0xff, 0x18, 0x56,
+  0xc4, 0x00, 0xf0, 0xff, 0x0c, 0x00, 0xff, 0xfd, 0x00, 0x04, 0xac, 0xff, 0x50, 0x00, 0xff, 0xfd,
+  0x00, 0x06, 0x14, 0xbc, 0xff, 0xc8, 0xff, 0x64, 0x24, 0xfd, 0x00, 0x06, 0x34, 0x74, 0xff, 0xd8,
+  0xff, 0xa8, 0x10, 0xfd, 0x00, 0x04, 0xff, 0x00, 0x5a, 0xff, 0xaa, 0xfd, 0x00, 0x0d, 0xff, 0x00,
+  0x0c, 0xff, 0xf4, 0xcc, 0x66, 0x18, 0x00, 0xff, 0x12, 0x90, 0xff, 0xe0, 0xfe, 0xff, 0x00, 0xf4,
+  0xfe, 0xff, 0x09, 0xfc, 0x5c, 0x2c, 0x88, 0xc6, 0xec, 0xff, 0xe4, 0xb2, 0x38, 0xfd, 0x00, 0x01,
+  0x02, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xf4, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x06, 0x8a, 0xe6, 0xe4, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@%......
-  0x8c, 0xff, 0x64, 0x66, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@++@%.....
-  0xe6, 0xff, 0x0c, 0x0c, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@..@@.....
-  0xe6, 0xff, 0x0a, 0x0c, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@..@@.....
-  0x8e, 0xff, 0x62, 0x66, 0xff, 0x8a, 0x00, 0x00, 0x10, 0x62, 0x12,  //%@++@%...+.
-  0x06, 0x8e, 0xe6, 0xe6, 0x8c, 0x14, 0x5c, 0xb4, 0xf0, 0xac, 0x30,  //.%@@%.+%@%.
-  0x00, 0x00, 0x0a, 0x56, 0xae, 0xee, 0xae, 0x58, 0x0a, 0x00, 0x00,  //...+%@%+...
-  0x0a, 0xa8, 0xec, 0xae, 0x58, 0x12, 0x8c, 0xe6, 0xe2, 0x82, 0x04,  //.%@%+.%@@%.
-  0x00, 0x42, 0x0c, 0x00, 0x00, 0x8c, 0xff, 0x64, 0x68, 0xff, 0x80,  //.+...%@++@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x0c, 0x0c, 0xff, 0xe4,  //.....@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0x0c, 0x0c, 0xff, 0xe6,  //.....@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x64, 0x66, 0xff, 0x88,  //.....%@++@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x90, 0xe8, 0xe6, 0x88, 0x04,  //......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe0, 0x00, 0x05, 0x06, 0x8a, 0xe6, 0xe4, 0x84, 0x04, 0xfc, 0x00, 0x05, 0x8c, 0xff, 0x64, 0x66,
+  0xff, 0x86, 0xfc, 0x00, 0x05, 0xe6, 0xff, 0x0c, 0x0c, 0xff, 0xe4, 0xfc, 0x00, 0x05, 0xe6, 0xff,
+  0x0a, 0x0c, 0xff, 0xe6, 0xfc, 0x00, 0x36, 0x8e, 0xff, 0x62, 0x66, 0xff, 0x8a, 0x00, 0x00, 0x10,
+  0x62, 0x12, 0x06, 0x8e, 0xe6, 0xe6, 0x8c, 0x14, 0x5c, 0xb4, 0xf0, 0xac, 0x30, 0x00, 0x00, 0x0a,
+  0x56, 0xae, 0xee, 0xae, 0x58, 0x0a, 0x00, 0x00, 0x0a, 0xa8, 0xec, 0xae, 0x58, 0x12, 0x8c, 0xe6,
+  0xe2, 0x82, 0x04, 0x00, 0x42, 0x0c, 0x00, 0x00, 0x8c, 0xff, 0x64, 0x68, 0xff, 0x80, 0xfc, 0x00,
+  0x05, 0xe6, 0xff, 0x0c, 0x0c, 0xff, 0xe4, 0xfc, 0x00, 0x05, 0xe8, 0xff, 0x0c, 0x0c, 0xff, 0xe6,
+  0xfc, 0x00, 0x05, 0x90, 0xff, 0x64, 0x66, 0xff, 0x88, 0xfc, 0x00, 0x05, 0x08, 0x90, 0xe8, 0xe6,
+  0x88, 0x04, 0xd5, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x0c, 0x8e, 0xde, 0xfa, 0xff, 0xff, 0x00, 0x00,  //...%@@@@..
-  0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //..%@@@@@..
-  0x00, 0x00, 0xf2, 0xff, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x00,  //..@@+.....
-  0x00, 0x00, 0xc8, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@......
-  0x00, 0x00, 0x34, 0xfc, 0xc2, 0x08, 0x00, 0x00, 0x00, 0x00,  //...@@.....
-  0x00, 0x20, 0xc2, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,  //..@@@%....
-  0x1e, 0xe2, 0xc4, 0x4a, 0xfa, 0xfc, 0x38, 0x00, 0xff, 0xf8,  //.@@+@@..@@
-  0xa6, 0xff, 0x24, 0x00, 0x86, 0xff, 0xd4, 0x04, 0xff, 0xd8,  //%@..%@@.@@
-  0xec, 0xff, 0x0e, 0x00, 0x06, 0xd6, 0xff, 0x82, 0xff, 0x82,  //@@...@@%@%
-  0xee, 0xff, 0x64, 0x00, 0x00, 0x38, 0xfc, 0xf8, 0xca, 0x0a,  //@@+...@@@.
-  0xa6, 0xff, 0xf6, 0x76, 0x1e, 0x00, 0x90, 0xff, 0x5e, 0x00,  //%@@+..%@+.
-  0x1c, 0xe4, 0xff, 0xff, 0xff, 0xf0, 0xa8, 0xff, 0xea, 0x14,  //.@@@@@%@@.
-  0x00, 0x16, 0x96, 0xe2, 0xf8, 0xaa, 0x02, 0xba, 0xff, 0xaa,  //..%@@%.%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe1, 0x00, 0x05, 0x0c, 0x8e, 0xde, 0xfa, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xac, 0xfc, 0xff, 0xfd,
+  0x00, 0x03, 0xf2, 0xff, 0x5e, 0x06, 0xfb, 0x00, 0x02, 0xc8, 0xff, 0x1e, 0xfa, 0x00, 0x03, 0x34,
+  0xfc, 0xc2, 0x08, 0xfc, 0x00, 0x04, 0x20, 0xc2, 0xff, 0xff, 0x90, 0xfd, 0x00, 0x33, 0x1e, 0xe2,
+  0xc4, 0x4a, 0xfa, 0xfc, 0x38, 0x00, 0xff, 0xf8, 0xa6, 0xff, 0x24, 0x00, 0x86, 0xff, 0xd4, 0x04,
+  0xff, 0xd8, 0xec, 0xff, 0x0e, 0x00, 0x06, 0xd6, 0xff, 0x82, 0xff, 0x82, 0xee, 0xff, 0x64, 0x00,
+  0x00, 0x38, 0xfc, 0xf8, 0xca, 0x0a, 0xa6, 0xff, 0xf6, 0x76, 0x1e, 0x00, 0x90, 0xff, 0x5e, 0x00,
+  0x1c, 0xe4, 0xfe, 0xff, 0x0e, 0xf0, 0xa8, 0xff, 0xea, 0x14, 0x00, 0x16, 0x96, 0xe2, 0xf8, 0xaa,
+  0x02, 0xba, 0xff, 0xaa, 0xd9, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xfb, 0x00, 0xf7, 0xff, 0xe9, 0x00,
 
   /*Unicode: U+0028 (() , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x84, 0xc6,  //..%@
-  0x00, 0x24, 0xf8, 0x56,  //..@+
-  0x00, 0xa4, 0xf0, 0x04,  //.%@.
-  0x18, 0xf8, 0xa4, 0x00,  //.@%.
-  0x6c, 0xff, 0x66, 0x00,  //+@+.
-  0xb0, 0xff, 0x34, 0x00,  //%@..
-  0xdc, 0xff, 0x16, 0x00,  //@@..
-  0xf4, 0xff, 0x06, 0x00,  //@@..
-  0xf4, 0xff, 0x06, 0x00,  //@@..
-  0xdc, 0xff, 0x16, 0x00,  //@@..
-  0xae, 0xff, 0x36, 0x00,  //%@..
-  0x6c, 0xff, 0x66, 0x00,  //+@+.
-  0x16, 0xf8, 0xa6, 0x00,  //.@%.
-  0x00, 0xa0, 0xf0, 0x04,  //.%@.
-  0x00, 0x22, 0xf6, 0x56,  //..@+
-  0x00, 0x00, 0x82, 0xc6,  //..%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf7, 0x00, 0x3d, 0x84, 0xc6, 0x00, 0x24, 0xf8, 0x56, 0x00, 0xa4, 0xf0, 0x04, 0x18, 0xf8, 0xa4,
+  0x00, 0x6c, 0xff, 0x66, 0x00, 0xb0, 0xff, 0x34, 0x00, 0xdc, 0xff, 0x16, 0x00, 0xf4, 0xff, 0x06,
+  0x00, 0xf4, 0xff, 0x06, 0x00, 0xdc, 0xff, 0x16, 0x00, 0xae, 0xff, 0x36, 0x00, 0x6c, 0xff, 0x66,
+  0x00, 0x16, 0xf8, 0xa6, 0x00, 0x00, 0xa0, 0xf0, 0x04, 0x00, 0x22, 0xf6, 0x56, 0x00, 0x00, 0x82,
+  0xc6, 0xf9, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xc6, 0x82, 0x00, 0x00,  //@%..
-  0x58, 0xf6, 0x22, 0x00,  //+@..
-  0x04, 0xf0, 0xa2, 0x00,  //.@%.
-  0x00, 0xa6, 0xf8, 0x16,  //.%@.
-  0x00, 0x66, 0xff, 0x6c,  //.+@+
-  0x00, 0x36, 0xff, 0xae,  //..@%
-  0x00, 0x16, 0xff, 0xdc,  //..@@
-  0x00, 0x06, 0xff, 0xf2,  //..@@
-  0x00, 0x08, 0xff, 0xf2,  //..@@
-  0x00, 0x16, 0xff, 0xdc,  //..@@
-  0x00, 0x38, 0xff, 0xae,  //..@%
-  0x00, 0x66, 0xff, 0x6c,  //.+@+
-  0x00, 0xa8, 0xf8, 0x18,  //.%@.
-  0x06, 0xf0, 0xa2, 0x00,  //.@%.
-  0x58, 0xf6, 0x24, 0x00,  //+@..
-  0xc8, 0x82, 0x00, 0x00,  //@%..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf9, 0x00, 0x3d, 0xc6, 0x82, 0x00, 0x00, 0x58, 0xf6, 0x22, 0x00, 0x04, 0xf0, 0xa2, 0x00, 0x00,
+  0xa6, 0xf8, 0x16, 0x00, 0x66, 0xff, 0x6c, 0x00, 0x36, 0xff, 0xae, 0x00, 0x16, 0xff, 0xdc, 0x00,
+  0x06, 0xff, 0xf2, 0x00, 0x08, 0xff, 0xf2, 0x00, 0x16, 0xff, 0xdc, 0x00, 0x38, 0xff, 0xae, 0x00,
+  0x66, 0xff, 0x6c, 0x00, 0xa8, 0xf8, 0x18, 0x06, 0xf0, 0xa2, 0x00, 0x58, 0xf6, 0x24, 0x00, 0xc8,
+  0x82, 0xf7, 0x00,
 
   /*Unicode: U+002a (*) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-  0xa4, 0x2c, 0x00, 0xff, 0x00, 0x2c, 0xa4,  //%..@..%
-  0x5e, 0xe6, 0x52, 0xff, 0x52, 0xe6, 0x5e,  //+@+@+@+
-  0x00, 0x24, 0xcc, 0xff, 0xcc, 0x24, 0x00,  //..@@@..
-  0x00, 0x24, 0xca, 0xff, 0xca, 0x24, 0x00,  //..@@@..
-  0x5c, 0xe6, 0x52, 0xff, 0x54, 0xe6, 0x5c,  //+@+@+@+
-  0xa6, 0x2c, 0x00, 0xff, 0x00, 0x2e, 0xa6,  //%..@..%
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //...@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xe9, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x29, 0xa4, 0x2c, 0x00, 0xff, 0x00, 0x2c, 0xa4, 0x5e, 0xe6,
+  0x52, 0xff, 0x52, 0xe6, 0x5e, 0x00, 0x24, 0xcc, 0xff, 0xcc, 0x24, 0x00, 0x00, 0x24, 0xca, 0xff,
+  0xca, 0x24, 0x00, 0x5c, 0xe6, 0x52, 0xff, 0x54, 0xe6, 0x5c, 0xa6, 0x2c, 0x00, 0xff, 0x00, 0x2e,
+  0xa6, 0xfe, 0x00, 0x00, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+002b (+) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xcb, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9,
+  0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0xed, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01,
+  0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xcb, 0x00,
 
   /*Unicode: U+002c (,) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0xff, 0xfa,  //.@@
-  0x3a, 0xff, 0x88,  //.@%
-  0x88, 0xe0, 0x0a,  //%@.
-  0xd8, 0x4c, 0x00,  //@+.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xd9, 0x00, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xfa, 0x3a, 0xff, 0x88, 0x88, 0xe0, 0x0a, 0xd8, 0x4c,
+  0xfa, 0x00,
 
   /*Unicode: U+002d (-) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xcf, 0x00, 0xf7, 0xff, 0xd9, 0x00,
 
   /*Unicode: U+002e (.) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xe7, 0x00, 0xfb, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+002f (/) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xc2,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x4a,  //......%@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfc, 0xd2, 0x00,  //......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x5c, 0x00,  //.....%@+.
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0xfa, 0xe0, 0x02, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x6c, 0x00, 0x00,  //....%@+..
-  0x00, 0x00, 0x00, 0x12, 0xf4, 0xea, 0x08, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0x7e, 0x00, 0x00, 0x00,  //...+@+...
-  0x00, 0x00, 0x0a, 0xea, 0xf2, 0x12, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x6e, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00,  //..+@%....
-  0x00, 0x04, 0xe0, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x5c, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@%.....
-  0x00, 0xd2, 0xfc, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@......
-  0x4c, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0xc2, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe0, 0x00, 0x02, 0x3a, 0xff, 0xc2, 0xfb, 0x00, 0x02, 0xb2, 0xff, 0x4a, 0xfc, 0x00, 0x02, 0x2a,
+  0xfc, 0xd2, 0xfb, 0x00, 0x02, 0xa0, 0xff, 0x5c, 0xfc, 0x00, 0x03, 0x1c, 0xfa, 0xe0, 0x02, 0xfc,
+  0x00, 0x02, 0x90, 0xff, 0x6c, 0xfc, 0x00, 0x03, 0x12, 0xf4, 0xea, 0x08, 0xfc, 0x00, 0x02, 0x7e,
+  0xff, 0x7e, 0xfc, 0x00, 0x03, 0x0a, 0xea, 0xf2, 0x12, 0xfc, 0x00, 0x02, 0x6e, 0xff, 0x8e, 0xfc,
+  0x00, 0x03, 0x04, 0xe0, 0xf8, 0x1c, 0xfc, 0x00, 0x02, 0x5c, 0xff, 0xa0, 0xfb, 0x00, 0x02, 0xd2,
+  0xfc, 0x2a, 0xfc, 0x00, 0x02, 0x4c, 0xff, 0xb0, 0xfb, 0x00, 0x02, 0xc2, 0xff, 0x3a, 0xe9, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x08, 0x84, 0xde, 0xf8, 0xde, 0x82, 0x06, 0x00,  //..%@@@%..
-  0x00, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //.%@@@@@%.
-  0x4e, 0xff, 0xec, 0x42, 0x06, 0x44, 0xee, 0xff, 0x4a,  //+@@+.+@@+
-  0xa6, 0xff, 0x72, 0x00, 0x00, 0x00, 0x74, 0xff, 0xa4,  //%@+...+@%
-  0xd8, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xd6,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0xc4, 0xc2, 0x0a, 0xff, 0xf2,  //@@..@@.@@
-  0xfc, 0xff, 0x00, 0x00, 0xc6, 0xc4, 0x00, 0xff, 0xfa,  //@@..@@.@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf2,  //@@.....@@
-  0xd8, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xd6,  //@@.....@@
-  0xa6, 0xff, 0x70, 0x00, 0x00, 0x00, 0x74, 0xff, 0xa4,  //%@+...+@%
-  0x4e, 0xff, 0xec, 0x42, 0x06, 0x42, 0xee, 0xff, 0x4a,  //+@@+.+@@+
-  0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00,  //.%@@@@@%.
-  0x00, 0x08, 0x86, 0xe0, 0xf8, 0xde, 0x84, 0x08, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x09, 0x08, 0x84, 0xde, 0xf8, 0xde, 0x82, 0x06, 0x00, 0x00, 0xb4, 0xfc, 0xff, 0x0d,
+  0xb0, 0x00, 0x4e, 0xff, 0xec, 0x42, 0x06, 0x44, 0xee, 0xff, 0x4a, 0xa6, 0xff, 0x72, 0xfe, 0x00,
+  0x05, 0x74, 0xff, 0xa4, 0xd8, 0xff, 0x2a, 0xfe, 0x00, 0x17, 0x2c, 0xff, 0xd6, 0xf4, 0xff, 0x08,
+  0x00, 0xc4, 0xc2, 0x0a, 0xff, 0xf2, 0xfc, 0xff, 0x00, 0x00, 0xc6, 0xc4, 0x00, 0xff, 0xfa, 0xf4,
+  0xff, 0x08, 0xfe, 0x00, 0x05, 0x0a, 0xff, 0xf2, 0xd8, 0xff, 0x2a, 0xfe, 0x00, 0x05, 0x2a, 0xff,
+  0xd6, 0xa6, 0xff, 0x70, 0xfe, 0x00, 0x0d, 0x74, 0xff, 0xa4, 0x4e, 0xff, 0xec, 0x42, 0x06, 0x42,
+  0xee, 0xff, 0x4a, 0x00, 0xb8, 0xfc, 0xff, 0x09, 0xb4, 0x00, 0x00, 0x08, 0x86, 0xe0, 0xf8, 0xde,
+  0x84, 0x08, 0xdc, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x26, 0x78, 0xca, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xd4, 0x7e, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x00,  //@+.@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe9, 0x00, 0x04, 0x26, 0x78, 0xca, 0xff, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x04, 0xd4,
+  0x7e, 0x2a, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff,
+  0xe1, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x34, 0x92, 0xd2, 0xf4, 0xf0, 0xd2, 0x8e, 0x1e, 0x00, 0x00,  //.%@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3e, 0x00,  //@@@@@@@@..
-  0xcc, 0x72, 0x30, 0x0a, 0x08, 0x3a, 0xc8, 0xff, 0xd0, 0x00,  //@+....@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xfa, 0x06,  //.......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0x1c,  //.......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xde, 0x00,  //......%@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0x52, 0x00,  //.....+@@+.
-  0x00, 0x00, 0x00, 0x06, 0xa0, 0xff, 0xfc, 0x70, 0x00, 0x00,  //....%@@+..
-  0x00, 0x00, 0x18, 0xc6, 0xff, 0xea, 0x4c, 0x00, 0x00, 0x00,  //...@@@+...
-  0x00, 0x36, 0xe4, 0xff, 0xa2, 0x14, 0x00, 0x00, 0x00, 0x00,  //..@@%.....
-  0x64, 0xf8, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,  //@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,  //@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x09, 0x34, 0x92, 0xd2, 0xf4, 0xf0, 0xd2, 0x8e, 0x1e, 0x00, 0x00, 0xfa, 0xff, 0x0b,
+  0xf4, 0x3e, 0x00, 0xcc, 0x72, 0x30, 0x0a, 0x08, 0x3a, 0xc8, 0xff, 0xd0, 0xfa, 0x00, 0x03, 0x20,
+  0xff, 0xfa, 0x06, 0xfb, 0x00, 0x03, 0x16, 0xff, 0xff, 0x1c, 0xfb, 0x00, 0x02, 0x94, 0xff, 0xde,
+  0xfb, 0x00, 0x03, 0x7e, 0xff, 0xff, 0x52, 0xfd, 0x00, 0x04, 0x06, 0xa0, 0xff, 0xfc, 0x70, 0xfd,
+  0x00, 0x04, 0x18, 0xc6, 0xff, 0xea, 0x4c, 0xfd, 0x00, 0x04, 0x36, 0xe4, 0xff, 0xa2, 0x14, 0xfd,
+  0x00, 0x03, 0x64, 0xf8, 0xca, 0x3a, 0xfb, 0x00, 0xf8, 0xff, 0x00, 0x16, 0xf8, 0xff, 0x00, 0x16,
+  0xd9, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x2c, 0x84, 0xca, 0xf4, 0xf0, 0xd4, 0x92, 0x26, 0x00,  //.%@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4a,  //@@@@@@@@+
-  0xca, 0x6c, 0x2a, 0x08, 0x08, 0x2a, 0xa0, 0xff, 0xd8,  //@+....%@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xf2,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x34, 0xaa, 0xff, 0xa2,  //......%@%
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x86, 0x08,  //..@@@@@%.
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x72, 0x00,  //..@@@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x12, 0x4a, 0xd2, 0xff, 0x76,  //.....+@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xde,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xf6,  //.......@@
-  0xc4, 0x60, 0x1e, 0x04, 0x10, 0x42, 0xcc, 0xff, 0xc4,  //@+...+@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x36,  //@@@@@@@@.
-  0x2e, 0x8e, 0xd6, 0xf6, 0xf8, 0xdc, 0x9a, 0x24, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x08, 0x2c, 0x84, 0xca, 0xf4, 0xf0, 0xd4, 0x92, 0x26, 0x00, 0xfa, 0xff, 0x0a, 0xf8,
+  0x4a, 0xca, 0x6c, 0x2a, 0x08, 0x08, 0x2a, 0xa0, 0xff, 0xd8, 0xfb, 0x00, 0x02, 0x12, 0xff, 0xf2,
+  0xfd, 0x00, 0x06, 0x0c, 0x34, 0xaa, 0xff, 0xa2, 0x00, 0x00, 0xfd, 0xff, 0x04, 0xe4, 0x86, 0x08,
+  0x00, 0x00, 0xfd, 0xff, 0x01, 0xe4, 0x72, 0xfc, 0x00, 0x04, 0x12, 0x4a, 0xd2, 0xff, 0x76, 0xfb,
+  0x00, 0x02, 0x22, 0xff, 0xde, 0xfb, 0x00, 0x0b, 0x22, 0xff, 0xf6, 0xc4, 0x60, 0x1e, 0x04, 0x10,
+  0x42, 0xcc, 0xff, 0xc4, 0xfa, 0xff, 0x09, 0xf2, 0x36, 0x2e, 0x8e, 0xd6, 0xf6, 0xf8, 0xdc, 0x9a,
+  0x24, 0xdc, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0x00, 0x00,  //....+@@..
-  0x00, 0x00, 0x00, 0x04, 0xd8, 0xff, 0xff, 0x00, 0x00,  //....@@@..
-  0x00, 0x00, 0x00, 0x7a, 0xca, 0xff, 0xff, 0x00, 0x00,  //...+@@@..
-  0x00, 0x00, 0x1e, 0xf4, 0x3e, 0xff, 0xff, 0x00, 0x00,  //...@.@@..
-  0x00, 0x00, 0xb0, 0xb0, 0x00, 0xff, 0xff, 0x00, 0x00,  //..%%.@@..
-  0x00, 0x4a, 0xfa, 0x26, 0x00, 0xff, 0xff, 0x00, 0x00,  //.+@..@@..
-  0x08, 0xdc, 0x94, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.@%..@@..
-  0x80, 0xf0, 0x14, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //%@...@@..
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe2, 0x00, 0x02, 0x44, 0xff, 0xff, 0xfc, 0x00, 0x03, 0x04, 0xd8, 0xff, 0xff, 0xfc, 0x00, 0x03,
+  0x7a, 0xca, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x1e, 0xf4, 0x3e, 0xff, 0xff, 0xfd, 0x00, 0x04, 0xb0,
+  0xb0, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x1a, 0x4a, 0xfa, 0x26, 0x00, 0xff, 0xff, 0x00, 0x00, 0x08,
+  0xdc, 0x94, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x80, 0xf0, 0x14, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0xf6, 0xf0, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0xff, 0xdb, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@......
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@......
-  0x00, 0xff, 0xff, 0xcc, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //.@@@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x1a,  //.@@@@@@@.
-  0x00, 0xac, 0x36, 0x06, 0x14, 0x58, 0xe4, 0xff, 0x9a,  //.%...+@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xe4,  //......+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xf8,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xe0,  //......+@@
-  0xc0, 0x58, 0x1a, 0x04, 0x16, 0x5a, 0xe4, 0xff, 0x8e,  //@+...+@@%
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0e,  //@@@@@@@@.
-  0x42, 0xaa, 0xe2, 0xfa, 0xf4, 0xcc, 0x78, 0x08, 0x00,  //+%@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0xfa, 0xff, 0x01, 0x00, 0x00, 0xfa, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0xff, 0xfa, 0x00, 0x08, 0xff, 0xff, 0xcc, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x00, 0xfb,
+  0xff, 0x0a, 0xe4, 0x1a, 0x00, 0xac, 0x36, 0x06, 0x14, 0x58, 0xe4, 0xff, 0x9a, 0xfb, 0x00, 0x02,
+  0x42, 0xff, 0xe4, 0xfb, 0x00, 0x02, 0x0c, 0xff, 0xf8, 0xfb, 0x00, 0x0b, 0x42, 0xff, 0xe0, 0xc0,
+  0x58, 0x1a, 0x04, 0x16, 0x5a, 0xe4, 0xff, 0x8e, 0xfa, 0xff, 0x09, 0xcc, 0x0e, 0x42, 0xaa, 0xe2,
+  0xfa, 0xf4, 0xcc, 0x78, 0x08, 0xdc, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x46, 0xb8, 0xec, 0xf6, 0xc2, 0x44, 0x00,  //..+%@@@+.
-  0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.+@@@@@@.
-  0x2a, 0xfa, 0xff, 0xae, 0x28, 0x06, 0x2c, 0xb0, 0x00,  //.@@%...%.
-  0x92, 0xff, 0xca, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@......
-  0xd0, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0xf0, 0xff, 0x26, 0x8e, 0xec, 0xf2, 0xc0, 0x46, 0x00,  //@@.%@@@+.
-  0xfc, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x48,  //@@%@@@@@+
-  0xf4, 0xff, 0xb4, 0x2a, 0x06, 0x22, 0xae, 0xff, 0xc4,  //@@%...%@@
-  0xda, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x16, 0xff, 0xf4,  //@@.....@@
-  0xac, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x16, 0xff, 0xf4,  //%@.....@@
-  0x5a, 0xff, 0xba, 0x2a, 0x06, 0x22, 0xae, 0xff, 0xbe,  //+@%...%@%
-  0x02, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3c,  //.@@@@@@@.
-  0x00, 0x0c, 0x88, 0xdc, 0xf8, 0xee, 0xb4, 0x38, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe4, 0x00, 0x08, 0x46, 0xb8, 0xec, 0xf6, 0xc2, 0x44, 0x00, 0x00, 0x70, 0xfb, 0xff, 0x0d, 0x00,
+  0x2a, 0xfa, 0xff, 0xae, 0x28, 0x06, 0x2c, 0xb0, 0x00, 0x92, 0xff, 0xca, 0x02, 0xfc, 0x00, 0x02,
+  0xd0, 0xff, 0x5c, 0xfb, 0x00, 0x0b, 0xf0, 0xff, 0x26, 0x8e, 0xec, 0xf2, 0xc0, 0x46, 0x00, 0xfc,
+  0xff, 0x98, 0xfd, 0xff, 0x0d, 0xfc, 0x48, 0xf4, 0xff, 0xb4, 0x2a, 0x06, 0x22, 0xae, 0xff, 0xc4,
+  0xda, 0xff, 0x1a, 0xfe, 0x00, 0x05, 0x16, 0xff, 0xf4, 0xac, 0xff, 0x1a, 0xfe, 0x00, 0x0d, 0x16,
+  0xff, 0xf4, 0x5a, 0xff, 0xba, 0x2a, 0x06, 0x22, 0xae, 0xff, 0xbe, 0x02, 0xc2, 0xfc, 0xff, 0x09,
+  0xfa, 0x3c, 0x00, 0x0c, 0x88, 0xdc, 0xf8, 0xee, 0xb4, 0x38, 0xdc, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,  //@@@@@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x4e,  //......@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xe4, 0x02,  //......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x84, 0x00,  //.....%@%.
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0xfc, 0x22, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xbc, 0x00, 0x00,  //....+@%..
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x56, 0x00, 0x00,  //....@@+..
-  0x00, 0x00, 0x00, 0x36, 0xff, 0xea, 0x06, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x00, 0x9c, 0xff, 0x8e, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x0c, 0xf2, 0xff, 0x2a, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x66, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00,  //..+@@....
-  0x00, 0x00, 0xcc, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00,  //..@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xf9, 0xff, 0x00, 0xfa, 0xf9, 0xff, 0x00, 0xb2, 0xfb, 0x00, 0x02, 0xd4, 0xff, 0x4e,
+  0xfc, 0x00, 0x03, 0x3a, 0xff, 0xe4, 0x02, 0xfc, 0x00, 0x02, 0xa0, 0xff, 0x84, 0xfc, 0x00, 0x03,
+  0x0e, 0xf4, 0xfc, 0x22, 0xfc, 0x00, 0x02, 0x6c, 0xff, 0xbc, 0xfb, 0x00, 0x02, 0xd0, 0xff, 0x56,
+  0xfc, 0x00, 0x03, 0x36, 0xff, 0xea, 0x06, 0xfc, 0x00, 0x02, 0x9c, 0xff, 0x8e, 0xfc, 0x00, 0x03,
+  0x0c, 0xf2, 0xff, 0x2a, 0xfc, 0x00, 0x02, 0x66, 0xff, 0xc4, 0xfb, 0x00, 0x02, 0xcc, 0xff, 0x60,
+  0xd9, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x42, 0xb2, 0xe0, 0xf6, 0xe0, 0xb0, 0x40, 0x00,  //.+%@@@%+.
-  0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68,  //+@@@@@@@+
-  0xe4, 0xff, 0x92, 0x1c, 0x04, 0x1c, 0x92, 0xff, 0xe4,  //@@%...%@@
-  0xec, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xec,  //@@.....@@
-  0x90, 0xff, 0x8e, 0x1a, 0x04, 0x1a, 0x8e, 0xff, 0x8c,  //%@%...%@%
-  0x02, 0x74, 0xdc, 0xff, 0xff, 0xff, 0xdc, 0x72, 0x00,  //.+@@@@@+.
-  0x02, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0x88, 0x02,  //.%@@@@@%.
-  0x80, 0xff, 0xb4, 0x28, 0x06, 0x28, 0xb8, 0xff, 0x82,  //%@%...%@%
-  0xe0, 0xff, 0x18, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe0,  //@@.....@@
-  0xf8, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf6,  //@@.....@@
-  0xce, 0xff, 0xb6, 0x28, 0x06, 0x26, 0xb4, 0xff, 0xcc,  //@@%...%@@
-  0x4a, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x46,  //+@@@@@@@+
-  0x00, 0x30, 0xaa, 0xde, 0xf6, 0xde, 0xaa, 0x2e, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x08, 0x42, 0xb2, 0xe0, 0xf6, 0xe0, 0xb0, 0x40, 0x00, 0x6a, 0xfa, 0xff, 0x0c, 0x68,
+  0xe4, 0xff, 0x92, 0x1c, 0x04, 0x1c, 0x92, 0xff, 0xe4, 0xec, 0xff, 0x0e, 0xfe, 0x00, 0x0e, 0x0e,
+  0xff, 0xec, 0x90, 0xff, 0x8e, 0x1a, 0x04, 0x1a, 0x8e, 0xff, 0x8c, 0x02, 0x74, 0xdc, 0xfe, 0xff,
+  0x05, 0xdc, 0x72, 0x00, 0x02, 0x86, 0xf0, 0xfe, 0xff, 0x0e, 0xf0, 0x88, 0x02, 0x80, 0xff, 0xb4,
+  0x28, 0x06, 0x28, 0xb8, 0xff, 0x82, 0xe0, 0xff, 0x18, 0xfe, 0x00, 0x05, 0x18, 0xff, 0xe0, 0xf8,
+  0xff, 0x1a, 0xfe, 0x00, 0x0d, 0x18, 0xff, 0xf6, 0xce, 0xff, 0xb6, 0x28, 0x06, 0x26, 0xb4, 0xff,
+  0xcc, 0x4a, 0xfa, 0xfc, 0xff, 0x09, 0xfa, 0x46, 0x00, 0x30, 0xaa, 0xde, 0xf6, 0xde, 0xaa, 0x2e,
+  0xdc, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0xb4, 0xec, 0xf8, 0xda, 0x86, 0x0a, 0x00,  //..%@@@%..
-  0x3e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0xc0, 0xff, 0xb0, 0x24, 0x06, 0x2a, 0xba, 0xff, 0x58,  //@@%...%@+
-  0xf4, 0xff, 0x16, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xac,  //@@.....@%
-  0xf4, 0xff, 0x16, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xda,  //@@.....@@
-  0xc4, 0xff, 0xaa, 0x22, 0x06, 0x2a, 0xb4, 0xff, 0xf2,  //@@%...%@@
-  0x48, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xfa,  //+@@@@@%@@
-  0x00, 0x46, 0xc2, 0xf4, 0xec, 0x92, 0x2a, 0xff, 0xee,  //.+@@@%.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xce,  //......+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0xff, 0x90,  //......@@%
-  0x00, 0xae, 0x2a, 0x04, 0x26, 0xae, 0xff, 0xfa, 0x2a,  //.%...%@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x00,  //.@@@@@@+.
-  0x00, 0x46, 0xc6, 0xf8, 0xec, 0xb8, 0x48, 0x00, 0x00,  //.+@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x09, 0x3a, 0xb4, 0xec, 0xf8, 0xda, 0x86, 0x0a, 0x00, 0x3e, 0xfa, 0xfc, 0xff, 0x0d,
+  0xc0, 0x00, 0xc0, 0xff, 0xb0, 0x24, 0x06, 0x2a, 0xba, 0xff, 0x58, 0xf4, 0xff, 0x16, 0xfe, 0x00,
+  0x05, 0x1a, 0xff, 0xac, 0xf4, 0xff, 0x16, 0xfe, 0x00, 0x0d, 0x1a, 0xff, 0xda, 0xc4, 0xff, 0xaa,
+  0x22, 0x06, 0x2a, 0xb4, 0xff, 0xf2, 0x48, 0xfc, 0xfd, 0xff, 0x0b, 0x9c, 0xff, 0xfa, 0x00, 0x46,
+  0xc2, 0xf4, 0xec, 0x92, 0x2a, 0xff, 0xee, 0xfb, 0x00, 0x02, 0x5e, 0xff, 0xce, 0xfc, 0x00, 0x0d,
+  0x02, 0xcc, 0xff, 0x90, 0x00, 0xae, 0x2a, 0x04, 0x26, 0xae, 0xff, 0xfa, 0x2a, 0x00, 0xfb, 0xff,
+  0x08, 0x72, 0x00, 0x00, 0x46, 0xc6, 0xf8, 0xec, 0xb8, 0x48, 0xdb, 0x00,
 
   /*Unicode: U+003a (:) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf3, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+003b (;) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0xff,  //.@@
-  0x00, 0xff, 0xfa,  //.@@
-  0x3a, 0xff, 0x88,  //.@%
-  0x88, 0xe0, 0x0a,  //%@.
-  0xd8, 0x4c, 0x00,  //@+.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xeb, 0x00, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xf7, 0x00, 0x0c, 0xff, 0xff,
+  0x00, 0xff, 0xfa, 0x3a, 0xff, 0x88, 0x88, 0xe0, 0x0a, 0xd8, 0x4c, 0xfa, 0x00,
 
   /*Unicode: U+003c (<) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5e, 0xc8,  //.......+@
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x88, 0xea, 0xff, 0xd4,  //.....%@@@
-  0x00, 0x00, 0x48, 0xb4, 0xfc, 0xf6, 0xa2, 0x3c, 0x00,  //..+%@@%..
-  0x74, 0xdc, 0xff, 0xd2, 0x6c, 0x10, 0x00, 0x00, 0x00,  //+@@@+....
-  0xff, 0xf8, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0x74, 0xdc, 0xff, 0xca, 0x66, 0x0c, 0x00, 0x00, 0x00,  //+@@@+....
-  0x00, 0x00, 0x4a, 0xb4, 0xfc, 0xf4, 0x9c, 0x38, 0x00,  //..+%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x8a, 0xec, 0xff, 0xd4,  //.....%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5e, 0xca,  //.......+@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xc5, 0x00, 0x02, 0x06, 0x5e, 0xc8, 0xfd, 0x00, 0x13, 0x20, 0x88, 0xea, 0xff, 0xd4, 0x00, 0x00,
+  0x48, 0xb4, 0xfc, 0xf6, 0xa2, 0x3c, 0x00, 0x74, 0xdc, 0xff, 0xd2, 0x6c, 0x10, 0xfe, 0x00, 0x02,
+  0xff, 0xf8, 0x6a, 0xfb, 0x00, 0x05, 0x74, 0xdc, 0xff, 0xca, 0x66, 0x0c, 0xfc, 0x00, 0x05, 0x4a,
+  0xb4, 0xfc, 0xf4, 0x9c, 0x38, 0xfc, 0x00, 0x04, 0x20, 0x8a, 0xec, 0xff, 0xd4, 0xfb, 0x00, 0x02,
+  0x06, 0x5e, 0xca, 0xd4, 0x00,
 
   /*Unicode: U+003d (=) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xc2, 0x00, 0xef, 0xff, 0xef, 0x00, 0xef, 0xff, 0xc2, 0x00,
 
   /*Unicode: U+003e (>) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xc8, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.......
-  0xd4, 0xff, 0xea, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00,  //@@@%.....
-  0x00, 0x3c, 0xa2, 0xf6, 0xfc, 0xb2, 0x48, 0x00, 0x00,  //..%@@%+..
-  0x00, 0x00, 0x00, 0x10, 0x6c, 0xd2, 0xff, 0xdc, 0x74,  //....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf8, 0xff,  //......+@@
-  0x00, 0x00, 0x00, 0x0c, 0x66, 0xcc, 0xff, 0xdc, 0x74,  //....+@@@+
-  0x00, 0x38, 0x9e, 0xf4, 0xfc, 0xb4, 0x4a, 0x00, 0x00,  //..%@@%+..
-  0xd4, 0xff, 0xea, 0x8a, 0x20, 0x00, 0x00, 0x00, 0x00,  //@@@%.....
-  0xca, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0x02, 0xc8, 0x5e, 0x06, 0xfb, 0x00, 0x04, 0xd4, 0xff, 0xea, 0x88, 0x20, 0xfc, 0x00,
+  0x05, 0x3c, 0xa2, 0xf6, 0xfc, 0xb2, 0x48, 0xfc, 0x00, 0x05, 0x10, 0x6c, 0xd2, 0xff, 0xdc, 0x74,
+  0xfb, 0x00, 0x02, 0x6a, 0xf8, 0xff, 0xfe, 0x00, 0x13, 0x0c, 0x66, 0xcc, 0xff, 0xdc, 0x74, 0x00,
+  0x38, 0x9e, 0xf4, 0xfc, 0xb4, 0x4a, 0x00, 0x00, 0xd4, 0xff, 0xea, 0x8a, 0x20, 0xfd, 0x00, 0x02,
+  0xca, 0x5e, 0x06, 0xce, 0x00,
 
   /*Unicode: U+003f (?) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x42, 0xac, 0xe8, 0xf6, 0xd4, 0x6a, 0x00,  //+%@@@+.
-  0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x74,  //@@@@@@+
-  0xba, 0x4a, 0x0c, 0x00, 0x3c, 0xff, 0xda,  //%+...@@
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xf4,  //.....@@
-  0x00, 0x00, 0x00, 0x14, 0xd4, 0xff, 0xa8,  //....@@%
-  0x00, 0x00, 0x0c, 0xce, 0xff, 0xd2, 0x12,  //...@@@.
-  0x00, 0x00, 0x8c, 0xff, 0xd6, 0x14, 0x00,  //..%@@..
-  0x00, 0x00, 0xe0, 0xff, 0x38, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0xfa, 0xff, 0x04, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xec, 0x00, 0x06, 0x42, 0xac, 0xe8, 0xf6, 0xd4, 0x6a, 0x00, 0xfe, 0xff, 0x0a, 0xf8, 0xff, 0xff,
+  0x74, 0xba, 0x4a, 0x0c, 0x00, 0x3c, 0xff, 0xda, 0xfd, 0x00, 0x02, 0x28, 0xff, 0xf4, 0xfe, 0x00,
+  0x10, 0x14, 0xd4, 0xff, 0xa8, 0x00, 0x00, 0x0c, 0xce, 0xff, 0xd2, 0x12, 0x00, 0x00, 0x8c, 0xff,
+  0xd6, 0x14, 0xfe, 0x00, 0x02, 0xe0, 0xff, 0x38, 0xfd, 0x00, 0x02, 0xfa, 0xff, 0x04, 0xfd, 0x00,
+  0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xe2, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x16, 0x98, 0xe2, 0xf4, 0xd0, 0x5c, 0x00,  //...%@@@+.
-  0x00, 0x22, 0xe6, 0xbe, 0x22, 0x16, 0xb8, 0xff, 0x60,  //..@%..%@+
-  0x00, 0xca, 0xec, 0x10, 0x00, 0x00, 0x28, 0xff, 0xd2,  //.@@....@@
-  0x4e, 0xff, 0x8c, 0x00, 0x24, 0xe2, 0xa6, 0xff, 0xf8,  //+@%..@%@@
-  0xa2, 0xff, 0x46, 0x00, 0x9a, 0xff, 0x7a, 0xff, 0xff,  //%@+.%@+@@
-  0xd6, 0xff, 0x1c, 0x00, 0xdc, 0xff, 0x22, 0xff, 0xff,  //@@..@@.@@
-  0xf2, 0xff, 0x06, 0x00, 0xf4, 0xff, 0x06, 0xff, 0xff,  //@@..@@.@@
-  0xfa, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x06, 0xff, 0xff,  //@@..@@.@@
-  0xf0, 0xff, 0x08, 0x00, 0xdc, 0xff, 0x20, 0xff, 0xff,  //@@..@@.@@
-  0xd4, 0xff, 0x24, 0x00, 0x9a, 0xff, 0x78, 0xff, 0xff,  //@@..%@+@@
-  0xa0, 0xff, 0x56, 0x00, 0x24, 0xe2, 0xa2, 0xff, 0xff,  //%@+..@%@@
-  0x4e, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0x00, 0xcc, 0xfa, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@......
-  0x00, 0x24, 0xe8, 0xe2, 0x44, 0x04, 0x00, 0x00, 0x00,  //..@@+....
-  0x00, 0x00, 0x18, 0x98, 0xe4, 0xf8, 0xd2, 0x06, 0x00,  //...%@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xdb, 0x00, 0x63, 0x16, 0x98, 0xe2, 0xf4, 0xd0, 0x5c, 0x00, 0x00, 0x22, 0xe6, 0xbe, 0x22, 0x16,
+  0xb8, 0xff, 0x60, 0x00, 0xca, 0xec, 0x10, 0x00, 0x00, 0x28, 0xff, 0xd2, 0x4e, 0xff, 0x8c, 0x00,
+  0x24, 0xe2, 0xa6, 0xff, 0xf8, 0xa2, 0xff, 0x46, 0x00, 0x9a, 0xff, 0x7a, 0xff, 0xff, 0xd6, 0xff,
+  0x1c, 0x00, 0xdc, 0xff, 0x22, 0xff, 0xff, 0xf2, 0xff, 0x06, 0x00, 0xf4, 0xff, 0x06, 0xff, 0xff,
+  0xfa, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x06, 0xff, 0xff, 0xf0, 0xff, 0x08, 0x00, 0xdc, 0xff, 0x20,
+  0xff, 0xff, 0xd4, 0xff, 0x24, 0x00, 0x9a, 0xff, 0x78, 0xff, 0xff, 0xa0, 0xff, 0x56, 0x00, 0x24,
+  0xe2, 0xa2, 0xff, 0xff, 0x4e, 0xff, 0xa8, 0xfa, 0x00, 0x02, 0xcc, 0xfa, 0x2e, 0xfb, 0x00, 0x04,
+  0x24, 0xe8, 0xe2, 0x44, 0x04, 0xfc, 0x00, 0x05, 0x18, 0x98, 0xe4, 0xf8, 0xd2, 0x06, 0xf7, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x02, 0x96, 0xff, 0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22,
+  0xfe, 0xff, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae,
+  0xff, 0xc6, 0xff, 0xac, 0xfe, 0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00,
+  0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e,
+  0x00, 0x00, 0xc4, 0xfc, 0xff, 0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50,
+  0xff, 0xc0, 0xfe, 0x00, 0x05, 0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff,
+  0x96, 0xdc, 0xff, 0x34, 0xfe, 0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xe8, 0xb4, 0x48, 0x00,  //@@@@@@%+.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66,  //@@@@@@@@+
-  0xff, 0xff, 0x00, 0x00, 0x02, 0x1a, 0x84, 0xff, 0xe0,  //@@....%@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf2,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x02, 0x1c, 0x90, 0xff, 0xb2,  //@@....%@%
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xa0, 0x14,  //@@@@@@@%.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9a, 0x04,  //@@@@@@@%.
-  0xff, 0xff, 0x00, 0x00, 0x04, 0x28, 0xb2, 0xff, 0x86,  //@@....%@%
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xf8,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x04, 0x22, 0xa4, 0xff, 0xd4,  //@@....%@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58,  //@@@@@@@@+
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0xea, 0xb6, 0x48, 0x00,  //@@@@@@%+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xfd, 0xff, 0x04, 0xfa, 0xe8, 0xb4, 0x48, 0x00, 0xf9, 0xff, 0x0b, 0x66, 0xff, 0xff,
+  0x00, 0x00, 0x02, 0x1a, 0x84, 0xff, 0xe0, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0x0e, 0xff, 0xf2, 0xff,
+  0xff, 0x00, 0x00, 0x02, 0x1c, 0x90, 0xff, 0xb2, 0xfb, 0xff, 0x02, 0xee, 0xa0, 0x14, 0xfb, 0xff,
+  0x0d, 0xf6, 0x9a, 0x04, 0xff, 0xff, 0x00, 0x00, 0x04, 0x28, 0xb2, 0xff, 0x86, 0xff, 0xff, 0xfd,
+  0x00, 0x04, 0x1a, 0xff, 0xde, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0x12, 0xff, 0xf8, 0xff, 0xff, 0x00,
+  0x00, 0x04, 0x22, 0xa4, 0xff, 0xd4, 0xf9, 0xff, 0x00, 0x58, 0xfd, 0xff, 0x03, 0xfc, 0xea, 0xb6,
+  0x48, 0xdc, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x94, 0xda, 0xf6, 0xee, 0xb6, 0x48,  //...%@@@%+
-  0x00, 0x40, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@
-  0x14, 0xea, 0xff, 0xa6, 0x2e, 0x06, 0x10, 0x4e, 0xc2,  //.@@%...+@
-  0x7c, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0xc6, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0xee, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xee, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xc8, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@%......
-  0x16, 0xee, 0xff, 0xa4, 0x2c, 0x04, 0x0e, 0x48, 0xc0,  //.@@%...+@
-  0x00, 0x46, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@
-  0x00, 0x00, 0x22, 0x98, 0xdc, 0xf8, 0xf0, 0xb8, 0x48,  //...%@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe4, 0x00, 0x09, 0x1e, 0x94, 0xda, 0xf6, 0xee, 0xb6, 0x48, 0x00, 0x40, 0xf0, 0xfb, 0xff, 0x0b,
+  0x14, 0xea, 0xff, 0xa6, 0x2e, 0x06, 0x10, 0x4e, 0xc2, 0x7c, 0xff, 0xb2, 0xfb, 0x00, 0x02, 0xc6,
+  0xff, 0x42, 0xfb, 0x00, 0x02, 0xee, 0xff, 0x10, 0xfb, 0x00, 0x02, 0xfa, 0xff, 0x02, 0xfb, 0x00,
+  0x02, 0xee, 0xff, 0x10, 0xfb, 0x00, 0x02, 0xc8, 0xff, 0x42, 0xfb, 0x00, 0x02, 0x80, 0xff, 0xb0,
+  0xfb, 0x00, 0x0b, 0x16, 0xee, 0xff, 0xa4, 0x2c, 0x04, 0x0e, 0x48, 0xc0, 0x00, 0x46, 0xf4, 0xfb,
+  0xff, 0x08, 0x00, 0x00, 0x22, 0x98, 0xdc, 0xf8, 0xf0, 0xb8, 0x48, 0xdd, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xf4, 0xd8, 0x9a, 0x2c, 0x00, 0x00,  //@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5e, 0x00,  //@@@@@@@+.
-  0xff, 0xff, 0x00, 0x08, 0x2c, 0x90, 0xfc, 0xf8, 0x26,  //@@...%@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0x8e,  //@@....%@%
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xce,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xee,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfa,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xee,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xce,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0x90,  //@@....%@%
-  0xff, 0xff, 0x00, 0x06, 0x2c, 0x90, 0xfc, 0xf8, 0x28,  //@@...%@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x62, 0x00,  //@@@@@@@+.
-  0xff, 0xff, 0xff, 0xf4, 0xda, 0x9c, 0x2e, 0x00, 0x00,  //@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xfe, 0xff, 0x05, 0xf4, 0xd8, 0x9a, 0x2c, 0x00, 0x00, 0xfb, 0xff, 0x0d, 0xfa, 0x5e,
+  0x00, 0xff, 0xff, 0x00, 0x08, 0x2c, 0x90, 0xfc, 0xf8, 0x26, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x94,
+  0xff, 0x8e, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x34, 0xff, 0xce, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x0c,
+  0xff, 0xee, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x02, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x0c,
+  0xff, 0xee, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x36, 0xff, 0xce, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0x96,
+  0xff, 0x90, 0xff, 0xff, 0x00, 0x06, 0x2c, 0x90, 0xfc, 0xf8, 0x28, 0xfb, 0xff, 0x02, 0xfa, 0x62,
+  0x00, 0xfe, 0xff, 0x03, 0xf4, 0xda, 0x9c, 0x2e, 0xdb, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff,
+  0xff, 0xfa, 0x00, 0xef, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0xf9, 0xff, 0x00, 0x00, 0xf9, 0xff, 0x02, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0xff, 0xd6, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x22, 0x9a, 0xde, 0xf8, 0xec, 0xb2, 0x46,  //...%@@@%+
-  0x00, 0x44, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@
-  0x14, 0xec, 0xff, 0xa2, 0x2a, 0x04, 0x10, 0x4a, 0xb6,  //.@@%...+%
-  0x7e, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0xc6, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0xee, 0xff, 0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,  //@@...@@@@
-  0xfa, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,  //@@...@@@@
-  0xf0, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xcc, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x88, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //%@%....@@
-  0x1e, 0xf4, 0xfc, 0x78, 0x14, 0x08, 0x46, 0xff, 0xff,  //.@@+..+@@
-  0x00, 0x5a, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2,  //.+@@@@@@%
-  0x00, 0x00, 0x36, 0xae, 0xea, 0xf8, 0xd2, 0x6a, 0x00,  //...%@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe4, 0x00, 0x09, 0x22, 0x9a, 0xde, 0xf8, 0xec, 0xb2, 0x46, 0x00, 0x44, 0xf2, 0xfb, 0xff, 0x0b,
+  0x14, 0xec, 0xff, 0xa2, 0x2a, 0x04, 0x10, 0x4a, 0xb6, 0x7e, 0xff, 0xae, 0xfb, 0x00, 0x02, 0xc6,
+  0xff, 0x40, 0xfb, 0x00, 0x04, 0xee, 0xff, 0x0e, 0x00, 0x00, 0xfd, 0xff, 0x01, 0xfa, 0xff, 0xfe,
+  0x00, 0xfd, 0xff, 0x02, 0xf0, 0xff, 0x0c, 0xfd, 0x00, 0x04, 0xff, 0xff, 0xcc, 0xff, 0x36, 0xfd,
+  0x00, 0x04, 0xff, 0xff, 0x88, 0xff, 0x92, 0xfd, 0x00, 0x0d, 0xff, 0xff, 0x1e, 0xf4, 0xfc, 0x78,
+  0x14, 0x08, 0x46, 0xff, 0xff, 0x00, 0x5a, 0xfc, 0xfc, 0xff, 0x08, 0xa2, 0x00, 0x00, 0x36, 0xae,
+  0xea, 0xf8, 0xd2, 0x6a, 0xdc, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xeb, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x01,
+  0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe9, 0x00, 0xf1, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+004a (J) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf0,  //.....@@
-  0xb2, 0x40, 0x0a, 0x10, 0x92, 0xff, 0xc6,  //%+..%@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68,  //@@@@@@+
-  0x42, 0xb2, 0xe4, 0xf8, 0xd8, 0x72, 0x00,  //+%@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xea, 0x00, 0xfc, 0xff, 0x01, 0x00, 0x00, 0xfc, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00,
+  0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01,
+  0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xfc, 0xfd, 0x00, 0x09, 0x18,
+  0xff, 0xf0, 0xb2, 0x40, 0x0a, 0x10, 0x92, 0xff, 0xc6, 0xfb, 0xff, 0x06, 0x68, 0x42, 0xb2, 0xe4,
+  0xf8, 0xd8, 0x72, 0xe4, 0x00,
 
   /*Unicode: U+004b (K) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd6, 0xee, 0x32,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0xd0, 0xf2, 0x38, 0x00,  //@@....@@..
-  0xff, 0xff, 0x00, 0x00, 0x0c, 0xca, 0xf4, 0x40, 0x00, 0x00,  //@@...@@+..
-  0xff, 0xff, 0x00, 0x0a, 0xc2, 0xf8, 0x46, 0x00, 0x00, 0x00,  //@@..@@+...
-  0xff, 0xff, 0x06, 0xbc, 0xfa, 0x4e, 0x00, 0x00, 0x00, 0x00,  //@@.%@+....
-  0xff, 0xff, 0xb4, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%@%.....
-  0xff, 0xff, 0xfc, 0xf6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00,  //@@@@@+....
-  0xff, 0xff, 0x62, 0x6a, 0xff, 0xea, 0x16, 0x00, 0x00, 0x00,  //@@++@@....
-  0xff, 0xff, 0x00, 0x00, 0xb8, 0xff, 0xb0, 0x00, 0x00, 0x00,  //@@..%@%...
-  0xff, 0xff, 0x00, 0x00, 0x1a, 0xee, 0xff, 0x60, 0x00, 0x00,  //@@...@@+..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xf0, 0x1e, 0x00,  //@@...+@@..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xbc, 0x00,  //@@....%@%.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x12, 0xe6, 0xff, 0x6e,  //@@.....@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x05, 0x14, 0xd6, 0xee, 0x32, 0xff, 0xff, 0xfe, 0x00,
+  0x15, 0x10, 0xd0, 0xf2, 0x38, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0c, 0xca, 0xf4, 0x40, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x0a, 0xc2, 0xf8, 0x46, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x06, 0xbc, 0xfa, 0x4e,
+  0xfd, 0x00, 0x04, 0xff, 0xff, 0xb4, 0xff, 0xb8, 0xfc, 0x00, 0x05, 0xff, 0xff, 0xfc, 0xf6, 0xff,
+  0x52, 0xfd, 0x00, 0x06, 0xff, 0xff, 0x62, 0x6a, 0xff, 0xea, 0x16, 0xfe, 0x00, 0x06, 0xff, 0xff,
+  0x00, 0x00, 0xb8, 0xff, 0xb0, 0xfe, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0x1a, 0xee, 0xff, 0x60,
+  0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x06, 0x5a, 0xff, 0xf0, 0x1e, 0x00, 0xff, 0xff, 0xfd, 0x00,
+  0x05, 0xaa, 0xff, 0xbc, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x03, 0x12, 0xe6, 0xff, 0x6e, 0xd9, 0x00,
 
   /*Unicode: U+004c (L) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xef, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+004d (M) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff,  //@@@...@@@
-  0xff, 0xff, 0xfa, 0x10, 0x00, 0x10, 0xfa, 0xff, 0xff,  //@@@...@@@
-  0xff, 0xff, 0xd4, 0x58, 0x00, 0x5a, 0xd4, 0xff, 0xff,  //@@@+.+@@@
-  0xff, 0xff, 0x88, 0xa6, 0x00, 0xa6, 0x88, 0xff, 0xff,  //@@%%.%%@@
-  0xff, 0xff, 0x3a, 0xee, 0x08, 0xee, 0x3c, 0xff, 0xff,  //@@.@.@.@@
-  0xff, 0xff, 0x02, 0xea, 0x80, 0xec, 0x02, 0xff, 0xff,  //@@.@%@.@@
-  0xff, 0xff, 0x00, 0xa2, 0xf6, 0xa4, 0x00, 0xff, 0xff,  //@@.%@%.@@
-  0xff, 0xff, 0x00, 0x54, 0xff, 0x58, 0x00, 0xff, 0xff,  //@@.+@+.@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x02, 0xff, 0xff, 0xc0, 0xfe, 0x00, 0x00, 0xc0, 0xfd, 0xff, 0x04, 0xfa, 0x10, 0x00,
+  0x10, 0xfa, 0xfd, 0xff, 0x04, 0xd4, 0x58, 0x00, 0x5a, 0xd4, 0xfd, 0xff, 0x04, 0x88, 0xa6, 0x00,
+  0xa6, 0x88, 0xfd, 0xff, 0x04, 0x3a, 0xee, 0x08, 0xee, 0x3c, 0xfd, 0xff, 0x04, 0x02, 0xea, 0x80,
+  0xec, 0x02, 0xfd, 0xff, 0x04, 0x00, 0xa2, 0xf6, 0xa4, 0x00, 0xfd, 0xff, 0x04, 0x00, 0x54, 0xff,
+  0x58, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+004e (N) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@....@@
-  0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@....@@
-  0xff, 0xff, 0xe4, 0x94, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@%...@@
-  0xff, 0xff, 0x7e, 0xf0, 0x0c, 0x00, 0x00, 0xff, 0xff,  //@@+@...@@
-  0xff, 0xff, 0x18, 0xfa, 0x6a, 0x00, 0x00, 0xff, 0xff,  //@@.@+..@@
-  0xff, 0xff, 0x00, 0xaa, 0xd2, 0x00, 0x00, 0xff, 0xff,  //@@.%@..@@
-  0xff, 0xff, 0x00, 0x40, 0xff, 0x3e, 0x00, 0xff, 0xff,  //@@.+@..@@
-  0xff, 0xff, 0x00, 0x00, 0xd4, 0xa8, 0x00, 0xff, 0xff,  //@@..@%.@@
-  0xff, 0xff, 0x00, 0x00, 0x6a, 0xfa, 0x18, 0xff, 0xff,  //@@..+@.@@
-  0xff, 0xff, 0x00, 0x00, 0x0c, 0xf2, 0x7e, 0xff, 0xff,  //@@...@+@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x96, 0xe4, 0xff, 0xff,  //@@...%@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff,  //@@....@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff,  //@@....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x02, 0xff, 0xff, 0xc0, 0xfd, 0x00, 0xfc, 0xff, 0x00, 0x2a, 0xfe, 0x00, 0xfd, 0xff,
+  0x01, 0xe4, 0x94, 0xfe, 0x00, 0xfd, 0xff, 0x04, 0x7e, 0xf0, 0x0c, 0x00, 0x00, 0xfd, 0xff, 0x04,
+  0x18, 0xfa, 0x6a, 0x00, 0x00, 0xfd, 0xff, 0x04, 0x00, 0xaa, 0xd2, 0x00, 0x00, 0xfd, 0xff, 0x04,
+  0x00, 0x40, 0xff, 0x3e, 0x00, 0xfd, 0xff, 0x04, 0x00, 0x00, 0xd4, 0xa8, 0x00, 0xfd, 0xff, 0x04,
+  0x00, 0x00, 0x6a, 0xfa, 0x18, 0xfd, 0xff, 0x04, 0x00, 0x00, 0x0c, 0xf2, 0x7e, 0xfd, 0xff, 0xfe,
+  0x00, 0x01, 0x96, 0xe4, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0xfd, 0x00, 0x02, 0xc0,
+  0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+004f (O) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x09, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d,
+  0xc0, 0x00, 0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00,
+  0x05, 0x68, 0xff, 0xaa, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x04, 0x08, 0xff, 0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x05, 0x08, 0xff, 0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa,
+  0xff, 0x62, 0xfe, 0x00, 0x0d, 0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff,
+  0x54, 0x00, 0xc2, 0xfc, 0xff, 0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c,
+  0xdc, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xe2, 0xa4, 0x2c, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x38,  //@@@@@@@@.
-  0xff, 0xff, 0x00, 0x00, 0x08, 0x34, 0xc2, 0xff, 0xbe,  //@@....@@%
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xf2,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xf4,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x08, 0x34, 0xc4, 0xff, 0xbe,  //@@....@@%
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xe4, 0xa6, 0x2e, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xfd, 0xff, 0x04, 0xf8, 0xe2, 0xa4, 0x2c, 0x00, 0xfa, 0xff, 0x0c, 0xf6, 0x38, 0xff,
+  0xff, 0x00, 0x00, 0x08, 0x34, 0xc2, 0xff, 0xbe, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x1c, 0xff, 0xf2,
+  0xff, 0xff, 0xfd, 0x00, 0x0b, 0x1e, 0xff, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x08, 0x34, 0xc4, 0xff,
+  0xbe, 0xfa, 0xff, 0x01, 0xf6, 0x3a, 0xfd, 0xff, 0x06, 0xfa, 0xe4, 0xa6, 0x2e, 0x00, 0xff, 0xff,
+  0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xd6, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x58,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xac,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xdc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf4,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xea,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xd2,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0x94,  //%@+...+@%
-  0x56, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x3a,  //+@@...@@.
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x00,  //.@@@@@@%.
-  0x00, 0x0c, 0x8e, 0xe2, 0xfc, 0xff, 0xba, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xa4, 0xff, 0x90, 0x00,  //.....%@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xa0, 0x0c,  //......%%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x09, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8c, 0x0c, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d,
+  0xc2, 0x00, 0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x58, 0xaa, 0xff, 0x64, 0xfe, 0x00,
+  0x05, 0x68, 0xff, 0xac, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xdc, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x04, 0x08, 0xff, 0xf4, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfa, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x05, 0x08, 0xff, 0xea, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xd2, 0xaa,
+  0xff, 0x62, 0xfe, 0x00, 0x0d, 0x66, 0xff, 0x94, 0x56, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff,
+  0x3a, 0x00, 0xc0, 0xfc, 0xff, 0x08, 0x8c, 0x00, 0x00, 0x0c, 0x8e, 0xe2, 0xfc, 0xff, 0xba, 0xfb,
+  0x00, 0x03, 0x02, 0xa4, 0xff, 0x90, 0xfb, 0x00, 0x03, 0x02, 0xa0, 0xa0, 0x0c, 0xef, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xde, 0xa0, 0x28, 0x00, 0x00,  //@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x38, 0x00,  //@@@@@@@@..
-  0xff, 0xff, 0x00, 0x00, 0x08, 0x36, 0xc0, 0xff, 0xc0, 0x00,  //@@....@@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xf4, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe6, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x06, 0x2c, 0xb6, 0xff, 0x90, 0x00,  //@@....%@%.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x98, 0x08, 0x00,  //@@@@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x22, 0x00, 0x00,  //@@@@@@@...
-  0xff, 0xff, 0x00, 0x02, 0x18, 0x8c, 0xff, 0xd8, 0x08, 0x00,  //@@...%@@..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x7e, 0x00,  //@@....%@+.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xea, 0x06,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x5e,  //@@.....@@+
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xc8,  //@@.....+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0xfd, 0xff, 0x05, 0xf8, 0xde, 0xa0, 0x28, 0x00, 0x00, 0xfa, 0xff, 0x0e, 0xf4, 0x38,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x08, 0x36, 0xc0, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x05,
+  0x1c, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x0d, 0x18, 0xff, 0xe6, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0x06, 0x2c, 0xb6, 0xff, 0x90, 0x00, 0xfb, 0xff, 0x03, 0xf4, 0x98, 0x08, 0x00, 0xfb, 0xff,
+  0x0f, 0xc0, 0x22, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x18, 0x8c, 0xff, 0xd8, 0x08, 0x00, 0xff,
+  0xff, 0xfd, 0x00, 0x05, 0xb8, 0xff, 0x7e, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x05, 0x34, 0xff, 0xea,
+  0x06, 0xff, 0xff, 0xfc, 0x00, 0x04, 0xc8, 0xff, 0x5e, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x5c, 0xff,
+  0xc8, 0xd9, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x2c, 0xa8, 0xe6, 0xfa, 0xe2, 0x9e, 0x3a, 0x00,  //..%@@@%..
-  0x3c, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0xc8, 0xff, 0xba, 0x30, 0x06, 0x12, 0x4e, 0xba, 0x00,  //@@%...+%.
-  0xf6, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xd8, 0xff, 0x84, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%......
-  0x5a, 0xff, 0xff, 0xff, 0xd8, 0xa0, 0x4c, 0x00, 0x00,  //+@@@@%+..
-  0x00, 0x42, 0xb4, 0xf4, 0xff, 0xff, 0xff, 0xc0, 0x0e,  //.+%@@@@@.
-  0x00, 0x00, 0x00, 0x04, 0x2c, 0x6e, 0xde, 0xff, 0x8e,  //.....+@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xde,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf6,  //.......@@
-  0xc8, 0x66, 0x2c, 0x0c, 0x0a, 0x3a, 0xc2, 0xff, 0xd2,  //@+....@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x4e,  //@@@@@@@@+
-  0x36, 0x94, 0xd4, 0xf6, 0xf8, 0xe2, 0xa8, 0x38, 0x00,  //.%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x09, 0x2c, 0xa8, 0xe6, 0xfa, 0xe2, 0x9e, 0x3a, 0x00, 0x3c, 0xf6, 0xfb, 0xff, 0x0c,
+  0x00, 0xc8, 0xff, 0xba, 0x30, 0x06, 0x12, 0x4e, 0xba, 0x00, 0xf6, 0xff, 0x16, 0xfb, 0x00, 0x03,
+  0xd8, 0xff, 0x84, 0x14, 0xfc, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0x02, 0xd8, 0xa0, 0x4c, 0xfe, 0x00,
+  0x02, 0x42, 0xb4, 0xf4, 0xfe, 0xff, 0x01, 0xc0, 0x0e, 0xfe, 0x00, 0x05, 0x04, 0x2c, 0x6e, 0xde,
+  0xff, 0x8e, 0xfb, 0x00, 0x02, 0x26, 0xff, 0xde, 0xfb, 0x00, 0x0b, 0x18, 0xff, 0xf6, 0xc8, 0x66,
+  0x2c, 0x0c, 0x0a, 0x3a, 0xc2, 0xff, 0xd2, 0xfa, 0xff, 0x09, 0xfa, 0x4e, 0x36, 0x94, 0xd4, 0xf6,
+  0xf8, 0xe2, 0xa8, 0x38, 0xdc, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0xed, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00,
+  0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01,
+  0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff,
+  0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xd5, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,  //@@.....@@
-  0xe4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //@@.....@@
-  0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa,  //%@%...%@%
-  0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c,  //.@@@@@@@.
-  0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xf6, 0xe4, 0xff, 0x14,
+  0xfe, 0x00, 0x0d, 0x18, 0xff, 0xe4, 0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa, 0x2a,
+  0xf2, 0xfc, 0xff, 0x09, 0xf2, 0x2c, 0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0xdc, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0x52, 0xff, 0xbe, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@%...@@+
-  0x10, 0xfc, 0xf8, 0x0a, 0x00, 0x0a, 0xf8, 0xfa, 0x0e,  //.@@...@@.
-  0x00, 0xc8, 0xff, 0x48, 0x00, 0x4a, 0xff, 0xc6, 0x00,  //.@@+.+@@.
-  0x00, 0x82, 0xff, 0x8e, 0x00, 0x8e, 0xff, 0x80, 0x00,  //.%@%.%@%.
-  0x00, 0x3c, 0xff, 0xd2, 0x00, 0xd4, 0xff, 0x3c, 0x00,  //..@@.@@..
-  0x00, 0x04, 0xf2, 0xff, 0x32, 0xff, 0xf2, 0x04, 0x00,  //..@@.@@..
-  0x00, 0x00, 0xb2, 0xff, 0xbc, 0xff, 0xb2, 0x00, 0x00,  //..%@%@%..
-  0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0x6c, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0x28, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0xe2, 0xff, 0xe2, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0x9e, 0xff, 0x9c, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x02, 0xdc, 0xff, 0x34, 0xfe, 0x00, 0x05, 0x36, 0xff, 0xdc, 0x96, 0xff, 0x7a, 0xfe,
+  0x00, 0x05, 0x7a, 0xff, 0x96, 0x52, 0xff, 0xbe, 0xfe, 0x00, 0x2e, 0xc0, 0xff, 0x50, 0x10, 0xfc,
+  0xf8, 0x0a, 0x00, 0x0a, 0xf8, 0xfa, 0x0e, 0x00, 0xc8, 0xff, 0x48, 0x00, 0x4a, 0xff, 0xc6, 0x00,
+  0x00, 0x82, 0xff, 0x8e, 0x00, 0x8e, 0xff, 0x80, 0x00, 0x00, 0x3c, 0xff, 0xd2, 0x00, 0xd4, 0xff,
+  0x3c, 0x00, 0x00, 0x04, 0xf2, 0xff, 0x32, 0xff, 0xf2, 0x04, 0xfe, 0x00, 0x04, 0xb2, 0xff, 0xbc,
+  0xff, 0xb2, 0xfd, 0x00, 0x00, 0x6c, 0xfe, 0xff, 0x00, 0x6c, 0xfd, 0x00, 0x00, 0x28, 0xfe, 0xff,
+  0x00, 0x26, 0xfc, 0x00, 0x02, 0xe2, 0xff, 0xe2, 0xfb, 0x00, 0x02, 0x9e, 0xff, 0x9c, 0xda, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xea, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xea,  //@@.......@@
-  0xc4, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xc2,  //@@.......@@
-  0x9c, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0x9c,  //%@+.....+@%
-  0x76, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0x74,  //+@%.....%@+
-  0x4e, 0xff, 0xb2, 0x00, 0x90, 0xff, 0x90, 0x00, 0xb4, 0xff, 0x4e,  //+@%.%@%.%@+
-  0x28, 0xff, 0xda, 0x00, 0xca, 0xf6, 0xca, 0x00, 0xdc, 0xff, 0x26,  //.@@.@@@.@@.
-  0x04, 0xfa, 0xfa, 0x0e, 0xfa, 0x90, 0xfa, 0x10, 0xfc, 0xfa, 0x04,  //.@@.@%@.@@.
-  0x00, 0xda, 0xff, 0x68, 0xfa, 0x1a, 0xfa, 0x6a, 0xff, 0xd8, 0x00,  //.@@+@.@+@@.
-  0x00, 0xb2, 0xff, 0xca, 0xc8, 0x00, 0xca, 0xca, 0xff, 0xb2, 0x00,  //.%@@@.@@@%.
-  0x00, 0x8c, 0xff, 0xff, 0x8a, 0x00, 0x8a, 0xff, 0xff, 0x8a, 0x00,  //.%@@%.%@@%.
-  0x00, 0x64, 0xff, 0xff, 0x4a, 0x00, 0x4c, 0xff, 0xff, 0x64, 0x00,  //.+@@+.+@@+.
-  0x00, 0x3e, 0xff, 0xfc, 0x0e, 0x00, 0x0e, 0xfc, 0xff, 0x3c, 0x00,  //..@@...@@..
-  0x00, 0x16, 0xff, 0xce, 0x00, 0x00, 0x00, 0xce, 0xff, 0x16, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe0, 0x00, 0x02, 0xea, 0xff, 0x16, 0xfc, 0x00, 0x05, 0x16, 0xff, 0xea, 0xc4, 0xff, 0x3c, 0xfc,
+  0x00, 0x05, 0x3e, 0xff, 0xc2, 0x9c, 0xff, 0x64, 0xfc, 0x00, 0x05, 0x66, 0xff, 0x9c, 0x76, 0xff,
+  0x8c, 0xfc, 0x00, 0x5e, 0x8c, 0xff, 0x74, 0x4e, 0xff, 0xb2, 0x00, 0x90, 0xff, 0x90, 0x00, 0xb4,
+  0xff, 0x4e, 0x28, 0xff, 0xda, 0x00, 0xca, 0xf6, 0xca, 0x00, 0xdc, 0xff, 0x26, 0x04, 0xfa, 0xfa,
+  0x0e, 0xfa, 0x90, 0xfa, 0x10, 0xfc, 0xfa, 0x04, 0x00, 0xda, 0xff, 0x68, 0xfa, 0x1a, 0xfa, 0x6a,
+  0xff, 0xd8, 0x00, 0x00, 0xb2, 0xff, 0xca, 0xc8, 0x00, 0xca, 0xca, 0xff, 0xb2, 0x00, 0x00, 0x8c,
+  0xff, 0xff, 0x8a, 0x00, 0x8a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x64, 0xff, 0xff, 0x4a, 0x00, 0x4c,
+  0xff, 0xff, 0x64, 0x00, 0x00, 0x3e, 0xff, 0xfc, 0x0e, 0x00, 0x0e, 0xfc, 0xff, 0x3c, 0x00, 0x00,
+  0x16, 0xff, 0xce, 0xfe, 0x00, 0x02, 0xce, 0xff, 0x16, 0xd4, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xb4, 0xff, 0x98, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xb2,  //%@%...%@%
-  0x26, 0xf8, 0xfc, 0x2e, 0x00, 0x3a, 0xff, 0xf6, 0x20,  //.@@...@@.
-  0x00, 0x8c, 0xff, 0xc0, 0x02, 0xd0, 0xff, 0x7e, 0x00,  //.%@@.@@+.
-  0x00, 0x0e, 0xe8, 0xff, 0xb6, 0xff, 0xdc, 0x06, 0x00,  //..@@%@@..
-  0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0x00, 0xcc, 0xff, 0xb0, 0x00, 0x00, 0x00,  //...@@%...
-  0x00, 0x00, 0x00, 0xa8, 0xff, 0x88, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x2c, 0xfc, 0xff, 0xf4, 0x18, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0xae, 0xff, 0xf2, 0xff, 0x98, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x32, 0xff, 0xf2, 0x3a, 0xfa, 0xfa, 0x24, 0x00,  //..@@.@@..
-  0x00, 0xb6, 0xff, 0x86, 0x00, 0x96, 0xff, 0xa8, 0x00,  //.%@%.%@%.
-  0x3a, 0xff, 0xf0, 0x10, 0x00, 0x18, 0xf4, 0xfc, 0x32,  //.@@...@@.
-  0xbc, 0xff, 0x80, 0x00, 0x00, 0x00, 0x86, 0xff, 0xba,  //%@%...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x02, 0xb4, 0xff, 0x98, 0xfe, 0x00, 0x1c, 0xa0, 0xff, 0xb2, 0x26, 0xf8, 0xfc, 0x2e,
+  0x00, 0x3a, 0xff, 0xf6, 0x20, 0x00, 0x8c, 0xff, 0xc0, 0x02, 0xd0, 0xff, 0x7e, 0x00, 0x00, 0x0e,
+  0xe8, 0xff, 0xb6, 0xff, 0xdc, 0x06, 0xfe, 0x00, 0x00, 0x62, 0xfe, 0xff, 0x00, 0x4a, 0xfc, 0x00,
+  0x02, 0xcc, 0xff, 0xb0, 0xfb, 0x00, 0x02, 0xa8, 0xff, 0x88, 0xfc, 0x00, 0x04, 0x2c, 0xfc, 0xff,
+  0xf4, 0x18, 0xfd, 0x00, 0x04, 0xae, 0xff, 0xf2, 0xff, 0x98, 0xfe, 0x00, 0x1c, 0x32, 0xff, 0xf2,
+  0x3a, 0xfa, 0xfa, 0x24, 0x00, 0x00, 0xb6, 0xff, 0x86, 0x00, 0x96, 0xff, 0xa8, 0x00, 0x3a, 0xff,
+  0xf0, 0x10, 0x00, 0x18, 0xf4, 0xfc, 0x32, 0xbc, 0xff, 0x80, 0xfe, 0x00, 0x02, 0x86, 0xff, 0xba,
+  0xdd, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xb8, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xb6,  //%@%....%@%
-  0x2c, 0xfc, 0xf8, 0x24, 0x00, 0x00, 0x24, 0xfa, 0xfa, 0x2a,  //.@@....@@.
-  0x00, 0x9a, 0xff, 0xae, 0x00, 0x00, 0xae, 0xff, 0x98, 0x00,  //.%@%..%@%.
-  0x00, 0x16, 0xf2, 0xff, 0x3c, 0x3e, 0xff, 0xf2, 0x16, 0x00,  //..@@..@@..
-  0x00, 0x00, 0x7c, 0xff, 0xca, 0xca, 0xff, 0x7c, 0x00, 0x00,  //..+@@@@+..
-  0x00, 0x00, 0x08, 0xe4, 0xff, 0xff, 0xe2, 0x08, 0x00, 0x00,  //...@@@@...
-  0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00,  //...+@@+...
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x02, 0xb8, 0xff, 0x92, 0xfd, 0x00, 0x1f, 0x92, 0xff, 0xb6, 0x2c, 0xfc, 0xf8, 0x24,
+  0x00, 0x00, 0x24, 0xfa, 0xfa, 0x2a, 0x00, 0x9a, 0xff, 0xae, 0x00, 0x00, 0xae, 0xff, 0x98, 0x00,
+  0x00, 0x16, 0xf2, 0xff, 0x3c, 0x3e, 0xff, 0xf2, 0x16, 0xfe, 0x00, 0x05, 0x7c, 0xff, 0xca, 0xca,
+  0xff, 0x7c, 0xfd, 0x00, 0x05, 0x08, 0xe4, 0xff, 0xff, 0xe2, 0x08, 0xfc, 0x00, 0x03, 0x5e, 0xff,
+  0xff, 0x5e, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff,
+  0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff,
+  0xd5, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf6, 0xff, 0x3c,  //......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0x9c, 0x00,  //.....%@%.
-  0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xea, 0x12, 0x00,  //....+@@..
-  0x00, 0x00, 0x00, 0x16, 0xee, 0xff, 0x5e, 0x00, 0x00,  //....@@+..
-  0x00, 0x00, 0x00, 0xaa, 0xff, 0xbe, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x4c, 0xff, 0xf8, 0x26, 0x00, 0x00, 0x00,  //..+@@....
-  0x00, 0x0c, 0xe2, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,  //..@@%....
-  0x00, 0x94, 0xff, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x00,  //.%@@.....
-  0x3a, 0xfc, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@+.....
-  0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0xf0, 0xff, 0x00, 0xd4, 0xfc, 0x00, 0x03, 0x24, 0xf6, 0xff, 0x3c, 0xfc, 0x00, 0x02,
+  0xbe, 0xff, 0x9c, 0xfc, 0x00, 0x03, 0x64, 0xff, 0xea, 0x12, 0xfd, 0x00, 0x03, 0x16, 0xee, 0xff,
+  0x5e, 0xfc, 0x00, 0x02, 0xaa, 0xff, 0xbe, 0xfc, 0x00, 0x03, 0x4c, 0xff, 0xf8, 0x26, 0xfd, 0x00,
+  0x03, 0x0c, 0xe2, 0xff, 0x80, 0xfc, 0x00, 0x03, 0x94, 0xff, 0xd8, 0x06, 0xfd, 0x00, 0x03, 0x3a,
+  0xfc, 0xff, 0x42, 0xfc, 0x00, 0x00, 0xd4, 0xf0, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+005b ([) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf9, 0x00, 0xf7, 0xff, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xf9, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+005c (\) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xc2, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x4c, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0x00, 0xd2, 0xfc, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@......
-  0x00, 0x5c, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@%.....
-  0x00, 0x04, 0xe0, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x00, 0x6e, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00,  //..+@%....
-  0x00, 0x00, 0x0a, 0xea, 0xf2, 0x12, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0x7e, 0x00, 0x00, 0x00,  //...+@+...
-  0x00, 0x00, 0x00, 0x12, 0xf4, 0xea, 0x08, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x6c, 0x00, 0x00,  //....%@+..
-  0x00, 0x00, 0x00, 0x00, 0x1c, 0xfa, 0xe0, 0x02, 0x00,  //.....@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x5c, 0x00,  //.....%@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfc, 0xd2, 0x00,  //......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x4a,  //......%@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xc2,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x02, 0xc2, 0xff, 0x3a, 0xfb, 0x00, 0x02, 0x4c, 0xff, 0xb0, 0xfa, 0x00, 0x02, 0xd2,
+  0xfc, 0x2a, 0xfb, 0x00, 0x02, 0x5c, 0xff, 0xa0, 0xfb, 0x00, 0x03, 0x04, 0xe0, 0xf8, 0x1c, 0xfb,
+  0x00, 0x02, 0x6e, 0xff, 0x8e, 0xfb, 0x00, 0x03, 0x0a, 0xea, 0xf2, 0x12, 0xfb, 0x00, 0x02, 0x7e,
+  0xff, 0x7e, 0xfb, 0x00, 0x03, 0x12, 0xf4, 0xea, 0x08, 0xfb, 0x00, 0x02, 0x90, 0xff, 0x6c, 0xfb,
+  0x00, 0x03, 0x1c, 0xfa, 0xe0, 0x02, 0xfb, 0x00, 0x02, 0xa0, 0xff, 0x5c, 0xfb, 0x00, 0x02, 0x2a,
+  0xfc, 0xd2, 0xfa, 0x00, 0x02, 0xb2, 0xff, 0x4a, 0xfb, 0x00, 0x02, 0x3a, 0xff, 0xc2, 0xef, 0x00,
 
   /*Unicode: U+005d (]) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0x00, 0x00, 0xff, 0xff,  //..@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf9, 0x00, 0xf9, 0xff, 0x2d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xf7, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+005e (^) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x3e, 0xf8, 0xf8, 0x3e, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x22, 0xec, 0xda, 0xda, 0xec, 0x22, 0x00, 0x00,  //...@@@@...
-  0x00, 0x0e, 0xd6, 0xe0, 0x1e, 0x1e, 0xe0, 0xd6, 0x0e, 0x00,  //..@@..@@..
-  0x02, 0xb8, 0xe6, 0x24, 0x00, 0x00, 0x24, 0xe8, 0xb8, 0x02,  //.%@....@%.
-  0x94, 0xec, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xec, 0x92,  //%@......@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe0, 0x00, 0x03, 0x3e, 0xf8, 0xf8, 0x3e, 0xfc, 0x00, 0x05, 0x22, 0xec, 0xda, 0xda, 0xec, 0x22,
+  0xfe, 0x00, 0x15, 0x0e, 0xd6, 0xe0, 0x1e, 0x1e, 0xe0, 0xd6, 0x0e, 0x00, 0x02, 0xb8, 0xe6, 0x24,
+  0x00, 0x00, 0x24, 0xe8, 0xb8, 0x02, 0x94, 0xec, 0x2c, 0xfd, 0x00, 0x02, 0x2e, 0xec, 0x92, 0x89,
+  0x00,
 
   /*Unicode: U+005f (_) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-
+  0x81, 0x00, 0xbb, 0x00, 0xeb, 0xff,
 
   /*Unicode: U+0060 (`) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x8a, 0xea, 0x1e, 0x00,  //%@..
-  0x00, 0xa0, 0xca, 0x06,  //.%@.
-  0x00, 0x02, 0xb6, 0x9a,  //..%%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf9, 0x00, 0x0b, 0x8a, 0xea, 0x1e, 0x00, 0x00, 0xa0, 0xca, 0x06, 0x00, 0x02, 0xb6, 0x9a, 0xc5,
+  0x00,
 
   /*Unicode: U+0061 (a) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xca, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff, 0x0a, 0xf6,
+  0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10, 0xff, 0xec,
+  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea, 0xff, 0x70,
+  0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff, 0x92,
+  0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff, 0xdd,
+  0x00,
 
   /*Unicode: U+0062 (b) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x0a, 0x9e, 0xf0, 0xec, 0xa8, 0x1e, 0x00,  //@@.%@@%..
-  0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x14,  //@@%@@@@@.
-  0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //@@@...@@%
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd8,  //@@+...+@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd6,  //@@+...+@@
-  0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8a,  //@@@...@@%
-  0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x14,  //@@%@@@@@.
-  0xff, 0xff, 0x0a, 0xa0, 0xf0, 0xee, 0xa8, 0x1e, 0x00,  //@@.%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x0b, 0xff, 0xff, 0x0a, 0x9e, 0xf0, 0xec, 0xa8, 0x1e, 0x00,
+  0xff, 0xff, 0xa6, 0xfd, 0xff, 0x0d, 0xe4, 0x14, 0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff,
+  0x8c, 0xff, 0xff, 0x46, 0xfe, 0x00, 0x05, 0x44, 0xff, 0xd8, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05,
+  0x0e, 0xff, 0xf6, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xff, 0xff, 0x46, 0xfe,
+  0x00, 0x0e, 0x44, 0xff, 0xd6, 0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8a, 0xff, 0xff,
+  0xa6, 0xfd, 0xff, 0x09, 0xe4, 0x14, 0xff, 0xff, 0x0a, 0xa0, 0xf0, 0xee, 0xa8, 0x1e, 0xdc, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x04, 0x70, 0xca, 0xf2, 0xf4, 0xbe, 0x4c,  //..+@@@%+
-  0x04, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x74, 0xff, 0xee, 0x64, 0x18, 0x0c, 0x36, 0xa8,  //+@@+...%
-  0xce, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-  0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-  0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-  0xce, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-  0x74, 0xff, 0xee, 0x64, 0x18, 0x0c, 0x34, 0xa4,  //+@@+...%
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x00, 0x04, 0x70, 0xcc, 0xf4, 0xf4, 0xc0, 0x4c,  //..+@@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd0, 0x00, 0x08, 0x04, 0x70, 0xca, 0xf2, 0xf4, 0xbe, 0x4c, 0x04, 0xbc, 0xfb, 0xff, 0x0a, 0x74,
+  0xff, 0xee, 0x64, 0x18, 0x0c, 0x36, 0xa8, 0xce, 0xff, 0x5e, 0xfc, 0x00, 0x02, 0xf6, 0xff, 0x12,
+  0xfc, 0x00, 0x02, 0xf6, 0xff, 0x12, 0xfc, 0x00, 0x02, 0xce, 0xff, 0x5e, 0xfc, 0x00, 0x09, 0x74,
+  0xff, 0xee, 0x64, 0x18, 0x0c, 0x34, 0xa4, 0x04, 0xbe, 0xfb, 0xff, 0x07, 0x00, 0x04, 0x70, 0xcc,
+  0xf4, 0xf4, 0xc0, 0x4c, 0xe1, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x1e, 0xa8, 0xec, 0xf0, 0x9e, 0x0a, 0xff, 0xff,  //..%@@%.@@
-  0x14, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0xff,  //.@@@@@%@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x3a, 0xd8, 0xff, 0xff,  //%@@...@@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xd6, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,  //@@+...+@@
-  0x8c, 0xff, 0xd4, 0x34, 0x0a, 0x38, 0xd8, 0xff, 0xff,  //%@@...@@@
-  0x14, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0xff,  //.@@@@@%@@
-  0x00, 0x20, 0xa8, 0xee, 0xf0, 0xa0, 0x0a, 0xff, 0xff,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe8, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x0c, 0xff, 0xff, 0x00, 0x1e, 0xa8, 0xec, 0xf0, 0x9e, 0x0a, 0xff, 0xff, 0x14, 0xe4, 0xfd,
+  0xff, 0x0e, 0xa6, 0xff, 0xff, 0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x3a, 0xd8, 0xff, 0xff, 0xd8, 0xff,
+  0x44, 0xfe, 0x00, 0x05, 0x46, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff,
+  0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xd6, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46,
+  0xff, 0xff, 0x8c, 0xff, 0xd4, 0x34, 0x0a, 0x38, 0xd8, 0xff, 0xff, 0x14, 0xe4, 0xfd, 0xff, 0x0b,
+  0xa6, 0xff, 0xff, 0x00, 0x20, 0xa8, 0xee, 0xf0, 0xa0, 0x0a, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00,  //..+@@@%..
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x18,  //.%@@@@@@.
-  0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96,  //+@@...%@%
-  0xce, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xce, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6,  //+@@+...+@
-  0x02, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@
-  0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xca, 0x00, 0x09, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00, 0x04, 0xbe, 0xfc, 0xff, 0x0d,
+  0xe6, 0x18, 0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96, 0xce, 0xff, 0x2a, 0xfe, 0x00,
+  0x03, 0x1a, 0xff, 0xde, 0xf4, 0xfa, 0xff, 0x01, 0xfa, 0xf4, 0xf9, 0xff, 0x02, 0xce, 0xfa, 0x10,
+  0xfb, 0x00, 0x0a, 0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6, 0x02, 0xb4, 0xfa, 0xff,
+  0x08, 0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36, 0xdd, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x0c, 0x94, 0xe0, 0xfc, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff,  //...%@@@@
-  0x00, 0x00, 0x00, 0xe0, 0xff, 0x44, 0x00, 0x00,  //...@@+..
-  0x00, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xee, 0x00, 0x04, 0x0c, 0x94, 0xe0, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0x90, 0xfd, 0xff, 0xfe, 0x00,
+  0x02, 0xe0, 0xff, 0x44, 0xfc, 0x00, 0x01, 0xfa, 0xff, 0xfe, 0x00, 0xf1, 0xff, 0xfe, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff,
+  0xfb, 0x00, 0x01, 0xff, 0xff, 0xde, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1c, 0xa8, 0xee, 0xee, 0x9e, 0x08, 0xff, 0xff,  //..%@@%.@@
-  0x12, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xa2, 0xff, 0xff,  //.@@@@@%@@
-  0x88, 0xff, 0xda, 0x3c, 0x0a, 0x36, 0xd6, 0xff, 0xff,  //%@@...@@@
-  0xd6, 0xff, 0x48, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xd6, 0xff, 0x48, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,  //@@+...+@@
-  0x88, 0xff, 0xda, 0x3c, 0x0a, 0x34, 0xd2, 0xff, 0xff,  //%@@...@@@
-  0x12, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff,  //.@@@@@%@@
-  0x00, 0x1e, 0xa8, 0xee, 0xf0, 0xa0, 0x12, 0xff, 0xf4,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xd4,  //.......@@
-  0x00, 0xc0, 0x54, 0x1a, 0x08, 0x38, 0xce, 0xff, 0x88,  //.@+...@@%
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x10,  //.@@@@@@@.
-  0x00, 0x38, 0xa8, 0xea, 0xf8, 0xde, 0x92, 0x14, 0x00,  //..%@@@%..
-
+  0xca, 0x00, 0x09, 0x1c, 0xa8, 0xee, 0xee, 0x9e, 0x08, 0xff, 0xff, 0x12, 0xe0, 0xfd, 0xff, 0x0e,
+  0xa2, 0xff, 0xff, 0x88, 0xff, 0xda, 0x3c, 0x0a, 0x36, 0xd6, 0xff, 0xff, 0xd6, 0xff, 0x48, 0xfe,
+  0x00, 0x05, 0x44, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xf6, 0xff,
+  0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xd6, 0xff, 0x48, 0xfe, 0x00, 0x0d, 0x46, 0xff, 0xff,
+  0x88, 0xff, 0xda, 0x3c, 0x0a, 0x34, 0xd2, 0xff, 0xff, 0x12, 0xe0, 0xfd, 0xff, 0x0b, 0x9c, 0xff,
+  0xff, 0x00, 0x1e, 0xa8, 0xee, 0xf0, 0xa0, 0x12, 0xff, 0xf4, 0xfb, 0x00, 0x0c, 0x36, 0xff, 0xd4,
+  0x00, 0xc0, 0x54, 0x1a, 0x08, 0x38, 0xce, 0xff, 0x88, 0x00, 0xfb, 0xff, 0x0a, 0xdc, 0x10, 0x00,
+  0x38, 0xa8, 0xea, 0xf8, 0xde, 0x92, 0x14, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00,  //@@.+@@@+.
-  0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58,  //@@+@@@@@+
-  0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2,  //@@@+..%@@
-  0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x20, 0xff, 0xf0,  //@@+....@@
-  0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00,
+  0xff, 0xff, 0x7e, 0xfc, 0xff, 0x0c, 0x58, 0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2,
+  0xff, 0xff, 0x48, 0xfe, 0x00, 0x05, 0x20, 0xff, 0xf0, 0xff, 0xff, 0x0c, 0xfd, 0x00, 0x03, 0xff,
+  0xfc, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xee, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xee, 0x00, 0xfc, 0xff, 0xfe, 0x00,
+  0xfc, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff,
+  0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+006a (j) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //....@@
-  0x00, 0x00, 0x00, 0x0e, 0xff, 0xec,  //....@@
-  0x00, 0x00, 0x08, 0x86, 0xff, 0xc6,  //...%@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x54,  //@@@@@+
-  0xff, 0xff, 0xfc, 0xdc, 0x6c, 0x00,  //@@@@+.
-
+  0xf1, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf4, 0x00, 0xfc, 0xff, 0x00, 0x00,
+  0xfc, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff,
+  0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff,
+  0xfd, 0x00, 0x01, 0xff, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x08, 0x0e, 0xff, 0xec,
+  0x00, 0x00, 0x08, 0x86, 0xff, 0xc6, 0xfc, 0xff, 0x06, 0x54, 0xff, 0xff, 0xfc, 0xdc, 0x6c, 0x00,
 
   /*Unicode: U+006b (k) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0xee, 0xff, 0xb2, 0x06,  //@@....@@%.
-  0xff, 0xff, 0x00, 0x00, 0x40, 0xf2, 0xff, 0xa8, 0x04, 0x00,  //@@..+@@%..
-  0xff, 0xff, 0x00, 0x4a, 0xf6, 0xff, 0x9e, 0x02, 0x00, 0x00,  //@@.+@@%...
-  0xff, 0xff, 0x54, 0xf8, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00,  //@@+@@%....
-  0xff, 0xff, 0xfa, 0xff, 0xf0, 0x10, 0x00, 0x00, 0x00, 0x00,  //@@@@@.....
-  0xff, 0xff, 0xff, 0xe4, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00,  //@@@@@%....
-  0xff, 0xff, 0x70, 0x1e, 0xee, 0xff, 0x6a, 0x00, 0x00, 0x00,  //@@+.@@+...
-  0xff, 0xff, 0x00, 0x00, 0x50, 0xff, 0xf6, 0x2e, 0x00, 0x00,  //@@..+@@...
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x94, 0xff, 0xd8, 0x0a, 0x00,  //@@...%@@..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xd0, 0xff, 0xa0, 0x00,  //@@....@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xed, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9,
+  0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x1e, 0x38, 0xee, 0xff, 0xb2,
+  0x06, 0xff, 0xff, 0x00, 0x00, 0x40, 0xf2, 0xff, 0xa8, 0x04, 0x00, 0xff, 0xff, 0x00, 0x4a, 0xf6,
+  0xff, 0x9e, 0x02, 0x00, 0x00, 0xff, 0xff, 0x54, 0xf8, 0xff, 0x92, 0xfd, 0x00, 0x05, 0xff, 0xff,
+  0xfa, 0xff, 0xf0, 0x10, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xe4, 0xff, 0xae, 0xfd, 0x00, 0x06, 0xff,
+  0xff, 0x70, 0x1e, 0xee, 0xff, 0x6a, 0xfe, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0x50, 0xff, 0xf6,
+  0x2e, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x06, 0x94, 0xff, 0xd8, 0x0a, 0x00, 0xff, 0xff, 0xfe,
+  0x00, 0x03, 0x06, 0xd0, 0xff, 0xa0, 0xd8, 0x00,
 
   /*Unicode: U+006c (l) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xee, 0xff, 0x0a, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xca, 0xff, 0x70, 0x02, 0x00,  //...@@+..
-  0x00, 0x00, 0x00, 0x62, 0xff, 0xff, 0xff, 0xff,  //...+@@@@
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xe6, 0xff, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf1, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff,
+  0xfb, 0x00, 0x02, 0xee, 0xff, 0x0a, 0xfc, 0x00, 0x03, 0xca, 0xff, 0x70, 0x02, 0xfd, 0x00, 0x00,
+  0x62, 0xfd, 0xff, 0xfd, 0x00, 0x03, 0x80, 0xe6, 0xff, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+006d (m) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0x52, 0xec, 0xc8, 0x12, 0x80, 0xf2, 0xc8, 0x1c,  //@@+@@.%@@.
-  0xff, 0xff, 0xec, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0xa2,  //@@@@@%@@@%
-  0xff, 0xff, 0x4e, 0x48, 0xff, 0xff, 0x50, 0x46, 0xff, 0xda,  //@@++@@++@@
-  0xff, 0xff, 0x0a, 0x0a, 0xff, 0xff, 0x0a, 0x0a, 0xff, 0xf2,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xc5, 0x00, 0x0f, 0xff, 0xff, 0x52, 0xec, 0xc8, 0x12, 0x80, 0xf2, 0xc8, 0x1c, 0xff, 0xff, 0xec,
+  0xff, 0xff, 0xba, 0xfe, 0xff, 0x26, 0xa2, 0xff, 0xff, 0x4e, 0x48, 0xff, 0xff, 0x50, 0x46, 0xff,
+  0xda, 0xff, 0xff, 0x0a, 0x0a, 0xff, 0xff, 0x0a, 0x0a, 0xff, 0xf2, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x05,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd,
+  0xff, 0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x07, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0xff, 0xff, 0xd9, 0x00,
 
   /*Unicode: U+006e (n) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00,  //@@.+@@@+.
-  0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58,  //@@+@@@@@+
-  0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2,  //@@@+..%@@
-  0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x20, 0xff, 0xf0,  //@@+....@@
-  0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00, 0xff, 0xff, 0x7e, 0xfc,
+  0xff, 0x0c, 0x58, 0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2, 0xff, 0xff, 0x48, 0xfe,
+  0x00, 0x05, 0x20, 0xff, 0xf0, 0xff, 0xff, 0x0c, 0xfd, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0x01, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+006f (o) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xca, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x14, 0xe2, 0xfc, 0xff, 0x0d,
+  0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c, 0xd8, 0xff, 0x44, 0xfe, 0x00,
+  0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xf6, 0xff, 0x0e,
+  0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46, 0xff, 0xd8, 0x8e,
+  0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2, 0xfc, 0xff, 0x09, 0xe2, 0x14, 0x00,
+  0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x08, 0x9c, 0xf0, 0xec, 0xa8, 0x1e, 0x00,  //@@.%@@%..
-  0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x12,  //@@%@@@@@.
-  0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff, 0x8a,  //@@@...@@%
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd6,  //@@+...+@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd8,  //@@+...+@@
-  0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8e,  //@@@...@@%
-  0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x16,  //@@%@@@@@.
-  0xff, 0xff, 0x0c, 0xa2, 0xf0, 0xee, 0xaa, 0x20, 0x00,  //@@.%@@%..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+  0xcb, 0x00, 0x0b, 0xff, 0xff, 0x08, 0x9c, 0xf0, 0xec, 0xa8, 0x1e, 0x00, 0xff, 0xff, 0xa6, 0xfd,
+  0xff, 0x0d, 0xe2, 0x12, 0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff, 0x8a, 0xff, 0xff, 0x46,
+  0xfe, 0x00, 0x05, 0x44, 0xff, 0xd6, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xff,
+  0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xff, 0xff, 0x46, 0xfe, 0x00, 0x0e, 0x44, 0xff,
+  0xd8, 0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8e, 0xff, 0xff, 0xa8, 0xfd, 0xff, 0x0c,
+  0xe6, 0x16, 0xff, 0xff, 0x0c, 0xa2, 0xf0, 0xee, 0xaa, 0x20, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1e, 0xa8, 0xec, 0xf0, 0x9c, 0x08, 0xff, 0xff,  //..%@@%.@@
-  0x12, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff,  //.@@@@@%@@
-  0x8a, 0xff, 0xd6, 0x36, 0x0a, 0x38, 0xd8, 0xff, 0xff,  //%@@...@@@
-  0xd6, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,  //@@+...+@@
-  0x8e, 0xff, 0xd4, 0x34, 0x08, 0x36, 0xd6, 0xff, 0xff,  //%@@...@@@
-  0x16, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xa2, 0xff, 0xff,  //.@@@@@%@@
-  0x00, 0x20, 0xaa, 0xee, 0xf0, 0x9c, 0x08, 0xff, 0xff,  //..%@@%.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-
+  0xca, 0x00, 0x09, 0x1e, 0xa8, 0xec, 0xf0, 0x9c, 0x08, 0xff, 0xff, 0x12, 0xe2, 0xfd, 0xff, 0x0e,
+  0xa4, 0xff, 0xff, 0x8a, 0xff, 0xd6, 0x36, 0x0a, 0x38, 0xd8, 0xff, 0xff, 0xd6, 0xff, 0x44, 0xfe,
+  0x00, 0x05, 0x46, 0xff, 0xff, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xf8, 0xff,
+  0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xff, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46, 0xff, 0xff,
+  0x8e, 0xff, 0xd4, 0x34, 0x08, 0x36, 0xd6, 0xff, 0xff, 0x16, 0xe6, 0xfd, 0xff, 0x0b, 0xa2, 0xff,
+  0xff, 0x00, 0x20, 0xaa, 0xee, 0xf0, 0x9c, 0x08, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff,
 
   /*Unicode: U+0072 (r) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0x00, 0x78, 0xe4, 0xea, 0x6e,  //@@.+@@+
-  0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xff,  //@@+@@@@
-  0xff, 0xff, 0xd0, 0x62, 0x12, 0x16, 0x94,  //@@@+..%
-  0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00,  //@@+....
-  0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xd7, 0x00, 0x09, 0xff, 0xff, 0x00, 0x78, 0xe4, 0xea, 0x6e, 0xff, 0xff, 0x64, 0xfb, 0xff, 0x07,
+  0xd0, 0x62, 0x12, 0x16, 0x94, 0xff, 0xff, 0x76, 0xfd, 0x00, 0x02, 0xff, 0xff, 0x20, 0xfd, 0x00,
+  0x02, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00,
+  0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x56, 0xb6, 0xe4, 0xf8, 0xf6, 0xd8, 0x9a, 0x38,  //.+%@@@@%.
-  0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@@@@@@@
-  0xf2, 0xff, 0x80, 0x20, 0x06, 0x06, 0x24, 0x64, 0xc4,  //@@%....+@
-  0xd4, 0xff, 0xc2, 0xa4, 0x88, 0x70, 0x3a, 0x00, 0x00,  //@@@%%+...
-  0x32, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x1a,  //.@@@@@@@.
-  0x00, 0x00, 0x28, 0x5c, 0x7e, 0xb0, 0xf4, 0xff, 0xa8,  //...++%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xec,  //.......@@
-  0xcc, 0x72, 0x30, 0x0a, 0x04, 0x22, 0x8e, 0xff, 0xee,  //@+....%@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e,  //@@@@@@@@+
-  0x30, 0x8a, 0xce, 0xf4, 0xfa, 0xe6, 0xb4, 0x50, 0x00,  //.%@@@@%+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xca, 0x00, 0x08, 0x56, 0xb6, 0xe4, 0xf8, 0xf6, 0xd8, 0x9a, 0x38, 0x88, 0xf9, 0xff, 0x13, 0xf2,
+  0xff, 0x80, 0x20, 0x06, 0x06, 0x24, 0x64, 0xc4, 0xd4, 0xff, 0xc2, 0xa4, 0x88, 0x70, 0x3a, 0x00,
+  0x00, 0x32, 0xd4, 0xfc, 0xff, 0x0a, 0xcc, 0x1a, 0x00, 0x00, 0x28, 0x5c, 0x7e, 0xb0, 0xf4, 0xff,
+  0xa8, 0xfb, 0x00, 0x0b, 0x28, 0xff, 0xec, 0xcc, 0x72, 0x30, 0x0a, 0x04, 0x22, 0x8e, 0xff, 0xee,
+  0xf9, 0xff, 0x08, 0x7e, 0x30, 0x8a, 0xce, 0xf4, 0xfa, 0xe6, 0xb4, 0x50, 0xdc, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x00, 0xe6, 0xff, 0x6c, 0x0a, 0x00, 0x00,  //...@@+...
-  0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff,  //...%@@@@@
-  0x00, 0x00, 0x00, 0x0a, 0x90, 0xe0, 0xfa, 0xff, 0xff,  //....%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfd,
+  0x00, 0xef, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x02, 0xfc, 0xff, 0x04, 0xfb, 0x00, 0x03,
+  0xe6, 0xff, 0x6c, 0x0a, 0xfc, 0x00, 0x00, 0x96, 0xfc, 0xff, 0xfe, 0x00, 0x05, 0x0a, 0x90, 0xe0,
+  0xfa, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,  //@@.....@@
-  0xf0, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@....+@@
-  0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff,  //@@%..+@@@
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,  //+@@@@@+@@
-  0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x05, 0x0c, 0xff, 0xff, 0xf0,
+  0xff, 0x20, 0xfe, 0x00, 0x0c, 0x4a, 0xff, 0xff, 0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff,
+  0xff, 0x5e, 0xfc, 0xff, 0x0b, 0x7a, 0xff, 0xff, 0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff,
+  0xff, 0xdd, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xd2, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xd2,  //@@+...+@@
-  0x7a, 0xff, 0xa2, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x78,  //+@%...%@+
-  0x22, 0xff, 0xf2, 0x08, 0x00, 0x08, 0xf2, 0xff, 0x20,  //.@@...@@.
-  0x00, 0xc8, 0xff, 0x54, 0x00, 0x56, 0xff, 0xc6, 0x00,  //.@@+.+@@.
-  0x00, 0x6e, 0xff, 0xae, 0x00, 0xae, 0xff, 0x6e, 0x00,  //.+@%.%@+.
-  0x00, 0x18, 0xfc, 0xf6, 0x1e, 0xf8, 0xfc, 0x18, 0x00,  //..@@.@@..
-  0x00, 0x00, 0xbe, 0xff, 0xc0, 0xff, 0xbc, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0x10, 0xf8, 0xff, 0xf8, 0x10, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0xb2, 0xff, 0xb2, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0x02, 0xd2, 0xff, 0x4a, 0xfe, 0x00, 0x05, 0x4a, 0xff, 0xd2, 0x7a, 0xff, 0xa2, 0xfe,
+  0x00, 0x25, 0xa4, 0xff, 0x78, 0x22, 0xff, 0xf2, 0x08, 0x00, 0x08, 0xf2, 0xff, 0x20, 0x00, 0xc8,
+  0xff, 0x54, 0x00, 0x56, 0xff, 0xc6, 0x00, 0x00, 0x6e, 0xff, 0xae, 0x00, 0xae, 0xff, 0x6e, 0x00,
+  0x00, 0x18, 0xfc, 0xf6, 0x1e, 0xf8, 0xfc, 0x18, 0xfe, 0x00, 0x04, 0xbe, 0xff, 0xc0, 0xff, 0xbc,
+  0xfd, 0x00, 0x00, 0x64, 0xfe, 0xff, 0x00, 0x64, 0xfd, 0x00, 0x04, 0x10, 0xf8, 0xff, 0xf8, 0x10,
+  0xfc, 0x00, 0x02, 0xb2, 0xff, 0xb2, 0xda, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xe0, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xe0,  //@@.......@@
-  0xa4, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xa4,  //%@+.....+@%
-  0x68, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x68,  //+@%.....%@+
-  0x2c, 0xff, 0xe0, 0x00, 0x56, 0xff, 0x52, 0x00, 0xe0, 0xff, 0x2c,  //.@@.+@+.@@.
-  0x00, 0xee, 0xff, 0x1a, 0x9e, 0xee, 0x9a, 0x1a, 0xff, 0xee, 0x00,  //.@@.%@%.@@.
-  0x00, 0xb4, 0xff, 0x58, 0xe4, 0x70, 0xe2, 0x58, 0xff, 0xb4, 0x00,  //.%@+@+@+@%.
-  0x00, 0x78, 0xff, 0xc2, 0xe8, 0x04, 0xec, 0xc0, 0xff, 0x78, 0x00,  //.+@@@.@@@+.
-  0x00, 0x3c, 0xff, 0xff, 0xa0, 0x00, 0xa4, 0xff, 0xff, 0x3c, 0x00,  //..@@%.%@@..
-  0x00, 0x06, 0xf8, 0xff, 0x56, 0x00, 0x58, 0xff, 0xf8, 0x06, 0x00,  //..@@+.+@@..
-  0x00, 0x00, 0xc4, 0xfa, 0x0e, 0x00, 0x10, 0xfa, 0xc4, 0x00, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xbf, 0x00, 0x02, 0xe0, 0xff, 0x2c, 0xfc, 0x00, 0x05, 0x2c, 0xff, 0xe0, 0xa4, 0xff, 0x68, 0xfc,
+  0x00, 0x05, 0x68, 0xff, 0xa4, 0x68, 0xff, 0xa4, 0xfc, 0x00, 0x43, 0xa4, 0xff, 0x68, 0x2c, 0xff,
+  0xe0, 0x00, 0x56, 0xff, 0x52, 0x00, 0xe0, 0xff, 0x2c, 0x00, 0xee, 0xff, 0x1a, 0x9e, 0xee, 0x9a,
+  0x1a, 0xff, 0xee, 0x00, 0x00, 0xb4, 0xff, 0x58, 0xe4, 0x70, 0xe2, 0x58, 0xff, 0xb4, 0x00, 0x00,
+  0x78, 0xff, 0xc2, 0xe8, 0x04, 0xec, 0xc0, 0xff, 0x78, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xa0, 0x00,
+  0xa4, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x06, 0xf8, 0xff, 0x56, 0x00, 0x58, 0xff, 0xf8, 0x06, 0xfe,
+  0x00, 0x06, 0xc4, 0xfa, 0x0e, 0x00, 0x10, 0xfa, 0xc4, 0xd3, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x9e, 0xff, 0xd4, 0x08, 0x00, 0x08, 0xd4, 0xff, 0x9e,  //%@@...@@%
-  0x08, 0xd4, 0xff, 0x9e, 0x00, 0xa0, 0xff, 0xd2, 0x08,  //.@@%.%@@.
-  0x00, 0x28, 0xf4, 0xff, 0xaa, 0xff, 0xf2, 0x28, 0x00,  //..@@%@@..
-  0x00, 0x00, 0x5e, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0x00, 0xa6, 0xff, 0xa4, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x0a, 0xda, 0xff, 0xda, 0x08, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x46, 0xff, 0xf8, 0x5a, 0xf8, 0xff, 0x46, 0x00,  //.+@@+@@+.
-  0x10, 0xe4, 0xff, 0x74, 0x00, 0x74, 0xff, 0xe4, 0x10,  //.@@+.+@@.
-  0xa6, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xa6,  //%@@...@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0x19, 0x9e, 0xff, 0xd4, 0x08, 0x00, 0x08, 0xd4, 0xff, 0x9e, 0x08, 0xd4, 0xff, 0x9e,
+  0x00, 0xa0, 0xff, 0xd2, 0x08, 0x00, 0x28, 0xf4, 0xff, 0xaa, 0xff, 0xf2, 0x28, 0xfe, 0x00, 0x00,
+  0x5e, 0xfe, 0xff, 0x00, 0x5c, 0xfc, 0x00, 0x02, 0xa6, 0xff, 0xa4, 0xfc, 0x00, 0x04, 0x0a, 0xda,
+  0xff, 0xda, 0x08, 0xfd, 0x00, 0x00, 0x96, 0xfe, 0xff, 0x00, 0x94, 0xfe, 0x00, 0x13, 0x46, 0xff,
+  0xf8, 0x5a, 0xf8, 0xff, 0x46, 0x00, 0x10, 0xe4, 0xff, 0x74, 0x00, 0x74, 0xff, 0xe4, 0x10, 0xa6,
+  0xff, 0xc0, 0xfe, 0x00, 0x02, 0xc0, 0xff, 0xa6, 0xdd, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xca, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xce,  //@@+...+@@
-  0x60, 0xff, 0xc6, 0x00, 0x00, 0x00, 0xae, 0xff, 0x6e,  //+@@...%@+
-  0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14,  //.@@...@@.
-  0x00, 0x8e, 0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00,  //.%@%.+@%.
-  0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff, 0x50, 0x00,  //..@@.@@+.
-  0x00, 0x00, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0x00,  //..%@%@@..
-  0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00,  //..+@@@%..
-  0x00, 0x00, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0xe4, 0x00, 0x00, 0x00,  //...+@@...
-  0x00, 0x00, 0x00, 0x86, 0xff, 0x92, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xde, 0xff, 0x3e, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x6a, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //..+@@....
-  0x00, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00,  //.@@@+....
-  0x00, 0xff, 0xf4, 0x9c, 0x04, 0x00, 0x00, 0x00, 0x00,  //.@@%.....
-
+  0xcb, 0x00, 0x02, 0xca, 0xff, 0x5c, 0xfe, 0x00, 0x05, 0x4e, 0xff, 0xce, 0x60, 0xff, 0xc6, 0xfe,
+  0x00, 0x1c, 0xae, 0xff, 0x6e, 0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14, 0x00, 0x8e,
+  0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00, 0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff, 0x50, 0xfe,
+  0x00, 0x05, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0xfe, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x00, 0x94,
+  0xfd, 0x00, 0x04, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x02, 0x7e, 0xff, 0xe4, 0xfb, 0x00,
+  0x02, 0x86, 0xff, 0x92, 0xfb, 0x00, 0x02, 0xde, 0xff, 0x3e, 0xfc, 0x00, 0x02, 0x6a, 0xff, 0xe2,
+  0xfc, 0x00, 0xfe, 0xff, 0x00, 0x7a, 0xfc, 0x00, 0x03, 0xff, 0xf4, 0x9c, 0x04, 0xfd, 0x00,
 
   /*Unicode: U+007a (z) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x1a, 0xe6, 0xff, 0xe0, 0x1a,  //.....@@@.
-  0x00, 0x00, 0x00, 0x08, 0xca, 0xff, 0xec, 0x28, 0x00,  //....@@@..
-  0x00, 0x00, 0x00, 0xa4, 0xff, 0xf6, 0x3a, 0x00, 0x00,  //...%@@...
-  0x00, 0x00, 0x76, 0xff, 0xfc, 0x50, 0x00, 0x00, 0x00,  //..+@@+...
-  0x00, 0x48, 0xfc, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00,  //.+@@+....
-  0x26, 0xee, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@%.....
-  0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xcb, 0x00, 0xf0, 0xff, 0x00, 0xd2, 0xfd, 0x00, 0x04, 0x1a, 0xe6, 0xff, 0xe0, 0x1a, 0xfe, 0x00,
+  0x04, 0x08, 0xca, 0xff, 0xec, 0x28, 0xfd, 0x00, 0x03, 0xa4, 0xff, 0xf6, 0x3a, 0xfd, 0x00, 0x03,
+  0x76, 0xff, 0xfc, 0x50, 0xfd, 0x00, 0x03, 0x48, 0xfc, 0xff, 0x6a, 0xfd, 0x00, 0x03, 0x26, 0xee,
+  0xff, 0x84, 0xfc, 0x00, 0x00, 0xd8, 0xf0, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+007b ({) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x10, 0x96, 0xda, 0xf4, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff, 0xff,  //...%@@@@
-  0x00, 0x00, 0x00, 0xe8, 0xff, 0x62, 0x0c, 0x00,  //...@@+..
-  0x00, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x0a, 0xff, 0xf6, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x14, 0x86, 0xff, 0xcc, 0x00, 0x00, 0x00,  //..%@@...
-  0xff, 0xff, 0xff, 0xca, 0x32, 0x00, 0x00, 0x00,  //@@@@....
-  0xff, 0xff, 0xff, 0xc2, 0x26, 0x00, 0x00, 0x00,  //@@@@....
-  0x00, 0x1c, 0xa8, 0xff, 0xbe, 0x00, 0x00, 0x00,  //..%@%...
-  0x00, 0x00, 0x1e, 0xff, 0xf0, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xfa, 0xff, 0x08, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xe2, 0xff, 0x6e, 0x0c, 0x00,  //...@@+..
-  0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xff, 0xff,  //...%@@@@
-  0x00, 0x00, 0x00, 0x0c, 0x90, 0xd8, 0xf6, 0xff,  //....%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xee, 0x00, 0x04, 0x10, 0x96, 0xda, 0xf4, 0xff, 0xfe, 0x00, 0x00, 0xa4, 0xfd, 0xff, 0xfe, 0x00,
+  0x03, 0xe8, 0xff, 0x62, 0x0c, 0xfd, 0x00, 0x02, 0xfc, 0xff, 0x04, 0xfc, 0x00, 0x01, 0xff, 0xff,
+  0xfc, 0x00, 0x02, 0x0a, 0xff, 0xf6, 0xfd, 0x00, 0x03, 0x14, 0x86, 0xff, 0xcc, 0xfe, 0x00, 0xfe,
+  0xff, 0x01, 0xca, 0x32, 0xfe, 0x00, 0xfe, 0xff, 0x01, 0xc2, 0x26, 0xfd, 0x00, 0x03, 0x1c, 0xa8,
+  0xff, 0xbe, 0xfc, 0x00, 0x02, 0x1e, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x02, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x02, 0xfa, 0xff, 0x08, 0xfc, 0x00, 0x03, 0xe2, 0xff, 0x6e, 0x0c,
+  0xfd, 0x00, 0x00, 0x96, 0xfd, 0xff, 0xfe, 0x00, 0x04, 0x0c, 0x90, 0xd8, 0xf6, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-
+  0xfd, 0x00, 0xdd, 0xff,
 
   /*Unicode: U+007d (}) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xf4, 0xda, 0x94, 0x10, 0x00, 0x00, 0x00,  //@@@%....
-  0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00,  //@@@@%...
-  0x00, 0x0c, 0x66, 0xff, 0xe8, 0x00, 0x00, 0x00,  //..+@@...
-  0x00, 0x00, 0x04, 0xff, 0xfc, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xf8, 0xff, 0x0a, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xcc, 0xff, 0x86, 0x14, 0x00,  //...@@%..
-  0x00, 0x00, 0x00, 0x32, 0xca, 0xff, 0xff, 0xff,  //....@@@@
-  0x00, 0x00, 0x00, 0x26, 0xc2, 0xfc, 0xff, 0xff,  //....@@@@
-  0x00, 0x00, 0x00, 0xbe, 0xff, 0xa8, 0x1c, 0x00,  //...%@%..
-  0x00, 0x00, 0x00, 0xf0, 0xff, 0x1e, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x0a, 0xff, 0xf8, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x0e, 0x74, 0xff, 0xe0, 0x00, 0x00, 0x00,  //..+@@...
-  0xff, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00,  //@@@@%...
-  0xff, 0xf6, 0xd8, 0x8e, 0x0c, 0x00, 0x00, 0x00,  //@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf1, 0x00, 0x04, 0xff, 0xf4, 0xda, 0x94, 0x10, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xa2, 0xfd, 0x00,
+  0x03, 0x0c, 0x66, 0xff, 0xe8, 0xfc, 0x00, 0x02, 0x04, 0xff, 0xfc, 0xfb, 0x00, 0x01, 0xff, 0xff,
+  0xfb, 0x00, 0x02, 0xf8, 0xff, 0x0a, 0xfc, 0x00, 0x03, 0xcc, 0xff, 0x86, 0x14, 0xfd, 0x00, 0x01,
+  0x32, 0xca, 0xfe, 0xff, 0xfe, 0x00, 0x04, 0x26, 0xc2, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xbe,
+  0xff, 0xa8, 0x1c, 0xfd, 0x00, 0x02, 0xf0, 0xff, 0x1e, 0xfc, 0x00, 0x02, 0xff, 0xff, 0x02, 0xfc,
+  0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x02, 0x0a, 0xff, 0xf8, 0xfd, 0x00, 0x03, 0x0e, 0x74, 0xff,
+  0xe0, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0x94, 0xfe, 0x00, 0x04, 0xff, 0xf6, 0xd8, 0x8e, 0x0c, 0xf6,
+  0x00,
 
   /*Unicode: U+007e (~) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x60, 0xcc, 0xf4, 0xde, 0x90, 0x36, 0x06, 0x2a, 0xa6,  //+@@@%...%
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xa6, 0x2a, 0x06, 0x2a, 0x7a, 0xd2, 0xf4, 0xce, 0x60,  //%...+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
-
+  0xb0, 0x00, 0x08, 0x60, 0xcc, 0xf4, 0xde, 0x90, 0x36, 0x06, 0x2a, 0xa6, 0xf8, 0xff, 0x08, 0xa6,
+  0x2a, 0x06, 0x2a, 0x7a, 0xd2, 0xf4, 0xce, 0x60, 0xb9, 0x00,
 
 #endif
 };
@@ -8767,391 +2082,391 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_20_glyph_dsc[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_20 == 1
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 2,	.glyph_index = 20},	/*Unicode: U+0021 (!)*/
-  {.w_px = 6,	.glyph_index = 40},	/*Unicode: U+0022 (")*/
-  {.w_px = 11,	.glyph_index = 60},	/*Unicode: U+0023 (#)*/
-  {.w_px = 9,	.glyph_index = 100},	/*Unicode: U+0024 ($)*/
-  {.w_px = 11,	.glyph_index = 140},	/*Unicode: U+0025 (%)*/
-  {.w_px = 10,	.glyph_index = 180},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 220},	/*Unicode: U+0027 (')*/
-  {.w_px = 4,	.glyph_index = 240},	/*Unicode: U+0028 (()*/
-  {.w_px = 4,	.glyph_index = 260},	/*Unicode: U+0029 ())*/
-  {.w_px = 7,	.glyph_index = 280},	/*Unicode: U+002a (*)*/
-  {.w_px = 10,	.glyph_index = 300},	/*Unicode: U+002b (+)*/
-  {.w_px = 3,	.glyph_index = 340},	/*Unicode: U+002c (,)*/
-  {.w_px = 5,	.glyph_index = 360},	/*Unicode: U+002d (-)*/
-  {.w_px = 2,	.glyph_index = 380},	/*Unicode: U+002e (.)*/
-  {.w_px = 9,	.glyph_index = 400},	/*Unicode: U+002f (/)*/
-  {.w_px = 9,	.glyph_index = 440},	/*Unicode: U+0030 (0)*/
-  {.w_px = 8,	.glyph_index = 480},	/*Unicode: U+0031 (1)*/
-  {.w_px = 10,	.glyph_index = 500},	/*Unicode: U+0032 (2)*/
-  {.w_px = 9,	.glyph_index = 540},	/*Unicode: U+0033 (3)*/
-  {.w_px = 9,	.glyph_index = 580},	/*Unicode: U+0034 (4)*/
-  {.w_px = 9,	.glyph_index = 620},	/*Unicode: U+0035 (5)*/
-  {.w_px = 9,	.glyph_index = 660},	/*Unicode: U+0036 (6)*/
-  {.w_px = 9,	.glyph_index = 700},	/*Unicode: U+0037 (7)*/
-  {.w_px = 9,	.glyph_index = 740},	/*Unicode: U+0038 (8)*/
-  {.w_px = 9,	.glyph_index = 780},	/*Unicode: U+0039 (9)*/
-  {.w_px = 2,	.glyph_index = 820},	/*Unicode: U+003a (:)*/
-  {.w_px = 3,	.glyph_index = 840},	/*Unicode: U+003b (;)*/
-  {.w_px = 9,	.glyph_index = 860},	/*Unicode: U+003c (<)*/
-  {.w_px = 9,	.glyph_index = 900},	/*Unicode: U+003d (=)*/
-  {.w_px = 9,	.glyph_index = 940},	/*Unicode: U+003e (>)*/
-  {.w_px = 7,	.glyph_index = 980},	/*Unicode: U+003f (?)*/
-  {.w_px = 9,	.glyph_index = 1000},	/*Unicode: U+0040 (@)*/
-  {.w_px = 9,	.glyph_index = 1040},	/*Unicode: U+0041 (A)*/
-  {.w_px = 9,	.glyph_index = 1080},	/*Unicode: U+0042 (B)*/
-  {.w_px = 9,	.glyph_index = 1120},	/*Unicode: U+0043 (C)*/
-  {.w_px = 9,	.glyph_index = 1160},	/*Unicode: U+0044 (D)*/
-  {.w_px = 9,	.glyph_index = 1200},	/*Unicode: U+0045 (E)*/
-  {.w_px = 9,	.glyph_index = 1240},	/*Unicode: U+0046 (F)*/
-  {.w_px = 9,	.glyph_index = 1280},	/*Unicode: U+0047 (G)*/
-  {.w_px = 9,	.glyph_index = 1320},	/*Unicode: U+0048 (H)*/
-  {.w_px = 8,	.glyph_index = 1360},	/*Unicode: U+0049 (I)*/
-  {.w_px = 7,	.glyph_index = 1380},	/*Unicode: U+004a (J)*/
-  {.w_px = 10,	.glyph_index = 1400},	/*Unicode: U+004b (K)*/
-  {.w_px = 9,	.glyph_index = 1440},	/*Unicode: U+004c (L)*/
-  {.w_px = 9,	.glyph_index = 1480},	/*Unicode: U+004d (M)*/
-  {.w_px = 9,	.glyph_index = 1520},	/*Unicode: U+004e (N)*/
-  {.w_px = 9,	.glyph_index = 1560},	/*Unicode: U+004f (O)*/
-  {.w_px = 9,	.glyph_index = 1600},	/*Unicode: U+0050 (P)*/
-  {.w_px = 9,	.glyph_index = 1640},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 10,	.glyph_index = 1680},	/*Unicode: U+0052 (R)*/
-  {.w_px = 9,	.glyph_index = 1720},	/*Unicode: U+0053 (S)*/
-  {.w_px = 10,	.glyph_index = 1760},	/*Unicode: U+0054 (T)*/
-  {.w_px = 9,	.glyph_index = 1800},	/*Unicode: U+0055 (U)*/
-  {.w_px = 9,	.glyph_index = 1840},	/*Unicode: U+0056 (V)*/
-  {.w_px = 11,	.glyph_index = 1880},	/*Unicode: U+0057 (W)*/
-  {.w_px = 9,	.glyph_index = 1920},	/*Unicode: U+0058 (X)*/
-  {.w_px = 10,	.glyph_index = 1960},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 9,	.glyph_index = 2000},	/*Unicode: U+005a (Z)*/
-  {.w_px = 4,	.glyph_index = 2040},	/*Unicode: U+005b ([)*/
-  {.w_px = 9,	.glyph_index = 2060},	/*Unicode: U+005c (\)*/
-  {.w_px = 4,	.glyph_index = 2100},	/*Unicode: U+005d (])*/
-  {.w_px = 10,	.glyph_index = 2120},	/*Unicode: U+005e (^)*/
-  {.w_px = 11,	.glyph_index = 2160},	/*Unicode: U+005f (_)*/
-  {.w_px = 4,	.glyph_index = 2200},	/*Unicode: U+0060 (`)*/
-  {.w_px = 9,	.glyph_index = 2220},	/*Unicode: U+0061 (a)*/
-  {.w_px = 9,	.glyph_index = 2260},	/*Unicode: U+0062 (b)*/
-  {.w_px = 8,	.glyph_index = 2300},	/*Unicode: U+0063 (c)*/
-  {.w_px = 9,	.glyph_index = 2320},	/*Unicode: U+0064 (d)*/
-  {.w_px = 9,	.glyph_index = 2360},	/*Unicode: U+0065 (e)*/
-  {.w_px = 8,	.glyph_index = 2400},	/*Unicode: U+0066 (f)*/
-  {.w_px = 9,	.glyph_index = 2420},	/*Unicode: U+0067 (g)*/
-  {.w_px = 9,	.glyph_index = 2460},	/*Unicode: U+0068 (h)*/
-  {.w_px = 8,	.glyph_index = 2500},	/*Unicode: U+0069 (i)*/
-  {.w_px = 6,	.glyph_index = 2520},	/*Unicode: U+006a (j)*/
-  {.w_px = 10,	.glyph_index = 2540},	/*Unicode: U+006b (k)*/
-  {.w_px = 8,	.glyph_index = 2580},	/*Unicode: U+006c (l)*/
-  {.w_px = 10,	.glyph_index = 2600},	/*Unicode: U+006d (m)*/
-  {.w_px = 9,	.glyph_index = 2640},	/*Unicode: U+006e (n)*/
-  {.w_px = 9,	.glyph_index = 2680},	/*Unicode: U+006f (o)*/
-  {.w_px = 9,	.glyph_index = 2720},	/*Unicode: U+0070 (p)*/
-  {.w_px = 9,	.glyph_index = 2760},	/*Unicode: U+0071 (q)*/
-  {.w_px = 7,	.glyph_index = 2800},	/*Unicode: U+0072 (r)*/
-  {.w_px = 9,	.glyph_index = 2820},	/*Unicode: U+0073 (s)*/
-  {.w_px = 9,	.glyph_index = 2860},	/*Unicode: U+0074 (t)*/
-  {.w_px = 9,	.glyph_index = 2900},	/*Unicode: U+0075 (u)*/
-  {.w_px = 9,	.glyph_index = 2940},	/*Unicode: U+0076 (v)*/
-  {.w_px = 11,	.glyph_index = 2980},	/*Unicode: U+0077 (w)*/
-  {.w_px = 9,	.glyph_index = 3020},	/*Unicode: U+0078 (x)*/
-  {.w_px = 9,	.glyph_index = 3060},	/*Unicode: U+0079 (y)*/
-  {.w_px = 9,	.glyph_index = 3100},	/*Unicode: U+007a (z)*/
-  {.w_px = 8,	.glyph_index = 3140},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 3160},	/*Unicode: U+007c (|)*/
-  {.w_px = 8,	.glyph_index = 3180},	/*Unicode: U+007d (})*/
-  {.w_px = 9,	.glyph_index = 3200},	/*Unicode: U+007e (~)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 6,	.glyph_index = 13},	/*Unicode: U+0022 (")*/
+  {.w_px = 11,	.glyph_index = 19},	/*Unicode: U+0023 (#)*/
+  {.w_px = 9,	.glyph_index = 51},	/*Unicode: U+0024 ($)*/
+  {.w_px = 11,	.glyph_index = 89},	/*Unicode: U+0025 (%)*/
+  {.w_px = 10,	.glyph_index = 120},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 151},	/*Unicode: U+0027 (')*/
+  {.w_px = 4,	.glyph_index = 157},	/*Unicode: U+0028 (()*/
+  {.w_px = 4,	.glyph_index = 175},	/*Unicode: U+0029 ())*/
+  {.w_px = 7,	.glyph_index = 193},	/*Unicode: U+002a (*)*/
+  {.w_px = 10,	.glyph_index = 206},	/*Unicode: U+002b (+)*/
+  {.w_px = 3,	.glyph_index = 230},	/*Unicode: U+002c (,)*/
+  {.w_px = 5,	.glyph_index = 239},	/*Unicode: U+002d (-)*/
+  {.w_px = 2,	.glyph_index = 246},	/*Unicode: U+002e (.)*/
+  {.w_px = 9,	.glyph_index = 252},	/*Unicode: U+002f (/)*/
+  {.w_px = 9,	.glyph_index = 286},	/*Unicode: U+0030 (0)*/
+  {.w_px = 8,	.glyph_index = 316},	/*Unicode: U+0031 (1)*/
+  {.w_px = 10,	.glyph_index = 329},	/*Unicode: U+0032 (2)*/
+  {.w_px = 9,	.glyph_index = 360},	/*Unicode: U+0033 (3)*/
+  {.w_px = 9,	.glyph_index = 390},	/*Unicode: U+0034 (4)*/
+  {.w_px = 9,	.glyph_index = 420},	/*Unicode: U+0035 (5)*/
+  {.w_px = 9,	.glyph_index = 450},	/*Unicode: U+0036 (6)*/
+  {.w_px = 9,	.glyph_index = 480},	/*Unicode: U+0037 (7)*/
+  {.w_px = 9,	.glyph_index = 510},	/*Unicode: U+0038 (8)*/
+  {.w_px = 9,	.glyph_index = 540},	/*Unicode: U+0039 (9)*/
+  {.w_px = 2,	.glyph_index = 570},	/*Unicode: U+003a (:)*/
+  {.w_px = 3,	.glyph_index = 580},	/*Unicode: U+003b (;)*/
+  {.w_px = 9,	.glyph_index = 593},	/*Unicode: U+003c (<)*/
+  {.w_px = 9,	.glyph_index = 615},	/*Unicode: U+003d (=)*/
+  {.w_px = 9,	.glyph_index = 631},	/*Unicode: U+003e (>)*/
+  {.w_px = 7,	.glyph_index = 653},	/*Unicode: U+003f (?)*/
+  {.w_px = 9,	.glyph_index = 671},	/*Unicode: U+0040 (@)*/
+  {.w_px = 9,	.glyph_index = 705},	/*Unicode: U+0041 (A)*/
+  {.w_px = 9,	.glyph_index = 736},	/*Unicode: U+0042 (B)*/
+  {.w_px = 9,	.glyph_index = 766},	/*Unicode: U+0043 (C)*/
+  {.w_px = 9,	.glyph_index = 796},	/*Unicode: U+0044 (D)*/
+  {.w_px = 9,	.glyph_index = 826},	/*Unicode: U+0045 (E)*/
+  {.w_px = 9,	.glyph_index = 857},	/*Unicode: U+0046 (F)*/
+  {.w_px = 9,	.glyph_index = 887},	/*Unicode: U+0047 (G)*/
+  {.w_px = 9,	.glyph_index = 917},	/*Unicode: U+0048 (H)*/
+  {.w_px = 8,	.glyph_index = 948},	/*Unicode: U+0049 (I)*/
+  {.w_px = 7,	.glyph_index = 960},	/*Unicode: U+004a (J)*/
+  {.w_px = 10,	.glyph_index = 973},	/*Unicode: U+004b (K)*/
+  {.w_px = 9,	.glyph_index = 1004},	/*Unicode: U+004c (L)*/
+  {.w_px = 9,	.glyph_index = 1035},	/*Unicode: U+004d (M)*/
+  {.w_px = 9,	.glyph_index = 1066},	/*Unicode: U+004e (N)*/
+  {.w_px = 9,	.glyph_index = 1097},	/*Unicode: U+004f (O)*/
+  {.w_px = 9,	.glyph_index = 1127},	/*Unicode: U+0050 (P)*/
+  {.w_px = 9,	.glyph_index = 1157},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 10,	.glyph_index = 1191},	/*Unicode: U+0052 (R)*/
+  {.w_px = 9,	.glyph_index = 1222},	/*Unicode: U+0053 (S)*/
+  {.w_px = 10,	.glyph_index = 1252},	/*Unicode: U+0054 (T)*/
+  {.w_px = 9,	.glyph_index = 1282},	/*Unicode: U+0055 (U)*/
+  {.w_px = 9,	.glyph_index = 1312},	/*Unicode: U+0056 (V)*/
+  {.w_px = 11,	.glyph_index = 1342},	/*Unicode: U+0057 (W)*/
+  {.w_px = 9,	.glyph_index = 1373},	/*Unicode: U+0058 (X)*/
+  {.w_px = 10,	.glyph_index = 1404},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 9,	.glyph_index = 1434},	/*Unicode: U+005a (Z)*/
+  {.w_px = 4,	.glyph_index = 1465},	/*Unicode: U+005b ([)*/
+  {.w_px = 9,	.glyph_index = 1477},	/*Unicode: U+005c (\)*/
+  {.w_px = 4,	.glyph_index = 1512},	/*Unicode: U+005d (])*/
+  {.w_px = 10,	.glyph_index = 1524},	/*Unicode: U+005e (^)*/
+  {.w_px = 11,	.glyph_index = 1539},	/*Unicode: U+005f (_)*/
+  {.w_px = 4,	.glyph_index = 1546},	/*Unicode: U+0060 (`)*/
+  {.w_px = 9,	.glyph_index = 1554},	/*Unicode: U+0061 (a)*/
+  {.w_px = 9,	.glyph_index = 1579},	/*Unicode: U+0062 (b)*/
+  {.w_px = 8,	.glyph_index = 1611},	/*Unicode: U+0063 (c)*/
+  {.w_px = 9,	.glyph_index = 1625},	/*Unicode: U+0064 (d)*/
+  {.w_px = 9,	.glyph_index = 1658},	/*Unicode: U+0065 (e)*/
+  {.w_px = 8,	.glyph_index = 1682},	/*Unicode: U+0066 (f)*/
+  {.w_px = 9,	.glyph_index = 1695},	/*Unicode: U+0067 (g)*/
+  {.w_px = 9,	.glyph_index = 1726},	/*Unicode: U+0068 (h)*/
+  {.w_px = 8,	.glyph_index = 1759},	/*Unicode: U+0069 (i)*/
+  {.w_px = 6,	.glyph_index = 1775},	/*Unicode: U+006a (j)*/
+  {.w_px = 10,	.glyph_index = 1790},	/*Unicode: U+006b (k)*/
+  {.w_px = 8,	.glyph_index = 1823},	/*Unicode: U+006c (l)*/
+  {.w_px = 10,	.glyph_index = 1835},	/*Unicode: U+006d (m)*/
+  {.w_px = 9,	.glyph_index = 1860},	/*Unicode: U+006e (n)*/
+  {.w_px = 9,	.glyph_index = 1885},	/*Unicode: U+006f (o)*/
+  {.w_px = 9,	.glyph_index = 1909},	/*Unicode: U+0070 (p)*/
+  {.w_px = 9,	.glyph_index = 1940},	/*Unicode: U+0071 (q)*/
+  {.w_px = 7,	.glyph_index = 1971},	/*Unicode: U+0072 (r)*/
+  {.w_px = 9,	.glyph_index = 1981},	/*Unicode: U+0073 (s)*/
+  {.w_px = 9,	.glyph_index = 2005},	/*Unicode: U+0074 (t)*/
+  {.w_px = 9,	.glyph_index = 2036},	/*Unicode: U+0075 (u)*/
+  {.w_px = 9,	.glyph_index = 2061},	/*Unicode: U+0076 (v)*/
+  {.w_px = 11,	.glyph_index = 2085},	/*Unicode: U+0077 (w)*/
+  {.w_px = 9,	.glyph_index = 2110},	/*Unicode: U+0078 (x)*/
+  {.w_px = 9,	.glyph_index = 2135},	/*Unicode: U+0079 (y)*/
+  {.w_px = 9,	.glyph_index = 2166},	/*Unicode: U+007a (z)*/
+  {.w_px = 8,	.glyph_index = 2191},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 2209},	/*Unicode: U+007c (|)*/
+  {.w_px = 8,	.glyph_index = 2214},	/*Unicode: U+007d (})*/
+  {.w_px = 9,	.glyph_index = 2232},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 2
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 2,	.glyph_index = 40},	/*Unicode: U+0021 (!)*/
-  {.w_px = 6,	.glyph_index = 60},	/*Unicode: U+0022 (")*/
-  {.w_px = 11,	.glyph_index = 100},	/*Unicode: U+0023 (#)*/
-  {.w_px = 9,	.glyph_index = 160},	/*Unicode: U+0024 ($)*/
-  {.w_px = 11,	.glyph_index = 220},	/*Unicode: U+0025 (%)*/
-  {.w_px = 10,	.glyph_index = 280},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 340},	/*Unicode: U+0027 (')*/
-  {.w_px = 4,	.glyph_index = 360},	/*Unicode: U+0028 (()*/
-  {.w_px = 4,	.glyph_index = 380},	/*Unicode: U+0029 ())*/
-  {.w_px = 7,	.glyph_index = 400},	/*Unicode: U+002a (*)*/
-  {.w_px = 10,	.glyph_index = 440},	/*Unicode: U+002b (+)*/
-  {.w_px = 3,	.glyph_index = 500},	/*Unicode: U+002c (,)*/
-  {.w_px = 5,	.glyph_index = 520},	/*Unicode: U+002d (-)*/
-  {.w_px = 2,	.glyph_index = 560},	/*Unicode: U+002e (.)*/
-  {.w_px = 9,	.glyph_index = 580},	/*Unicode: U+002f (/)*/
-  {.w_px = 9,	.glyph_index = 640},	/*Unicode: U+0030 (0)*/
-  {.w_px = 8,	.glyph_index = 700},	/*Unicode: U+0031 (1)*/
-  {.w_px = 10,	.glyph_index = 740},	/*Unicode: U+0032 (2)*/
-  {.w_px = 9,	.glyph_index = 800},	/*Unicode: U+0033 (3)*/
-  {.w_px = 9,	.glyph_index = 860},	/*Unicode: U+0034 (4)*/
-  {.w_px = 9,	.glyph_index = 920},	/*Unicode: U+0035 (5)*/
-  {.w_px = 9,	.glyph_index = 980},	/*Unicode: U+0036 (6)*/
-  {.w_px = 9,	.glyph_index = 1040},	/*Unicode: U+0037 (7)*/
-  {.w_px = 9,	.glyph_index = 1100},	/*Unicode: U+0038 (8)*/
-  {.w_px = 9,	.glyph_index = 1160},	/*Unicode: U+0039 (9)*/
-  {.w_px = 2,	.glyph_index = 1220},	/*Unicode: U+003a (:)*/
-  {.w_px = 3,	.glyph_index = 1240},	/*Unicode: U+003b (;)*/
-  {.w_px = 9,	.glyph_index = 1260},	/*Unicode: U+003c (<)*/
-  {.w_px = 9,	.glyph_index = 1320},	/*Unicode: U+003d (=)*/
-  {.w_px = 9,	.glyph_index = 1380},	/*Unicode: U+003e (>)*/
-  {.w_px = 7,	.glyph_index = 1440},	/*Unicode: U+003f (?)*/
-  {.w_px = 9,	.glyph_index = 1480},	/*Unicode: U+0040 (@)*/
-  {.w_px = 9,	.glyph_index = 1540},	/*Unicode: U+0041 (A)*/
-  {.w_px = 9,	.glyph_index = 1600},	/*Unicode: U+0042 (B)*/
-  {.w_px = 9,	.glyph_index = 1660},	/*Unicode: U+0043 (C)*/
-  {.w_px = 9,	.glyph_index = 1720},	/*Unicode: U+0044 (D)*/
-  {.w_px = 9,	.glyph_index = 1780},	/*Unicode: U+0045 (E)*/
-  {.w_px = 9,	.glyph_index = 1840},	/*Unicode: U+0046 (F)*/
-  {.w_px = 9,	.glyph_index = 1900},	/*Unicode: U+0047 (G)*/
-  {.w_px = 9,	.glyph_index = 1960},	/*Unicode: U+0048 (H)*/
-  {.w_px = 8,	.glyph_index = 2020},	/*Unicode: U+0049 (I)*/
-  {.w_px = 7,	.glyph_index = 2060},	/*Unicode: U+004a (J)*/
-  {.w_px = 10,	.glyph_index = 2100},	/*Unicode: U+004b (K)*/
-  {.w_px = 9,	.glyph_index = 2160},	/*Unicode: U+004c (L)*/
-  {.w_px = 9,	.glyph_index = 2220},	/*Unicode: U+004d (M)*/
-  {.w_px = 9,	.glyph_index = 2280},	/*Unicode: U+004e (N)*/
-  {.w_px = 9,	.glyph_index = 2340},	/*Unicode: U+004f (O)*/
-  {.w_px = 9,	.glyph_index = 2400},	/*Unicode: U+0050 (P)*/
-  {.w_px = 9,	.glyph_index = 2460},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 10,	.glyph_index = 2520},	/*Unicode: U+0052 (R)*/
-  {.w_px = 9,	.glyph_index = 2580},	/*Unicode: U+0053 (S)*/
-  {.w_px = 10,	.glyph_index = 2640},	/*Unicode: U+0054 (T)*/
-  {.w_px = 9,	.glyph_index = 2700},	/*Unicode: U+0055 (U)*/
-  {.w_px = 9,	.glyph_index = 2760},	/*Unicode: U+0056 (V)*/
-  {.w_px = 11,	.glyph_index = 2820},	/*Unicode: U+0057 (W)*/
-  {.w_px = 9,	.glyph_index = 2880},	/*Unicode: U+0058 (X)*/
-  {.w_px = 10,	.glyph_index = 2940},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 9,	.glyph_index = 3000},	/*Unicode: U+005a (Z)*/
-  {.w_px = 4,	.glyph_index = 3060},	/*Unicode: U+005b ([)*/
-  {.w_px = 9,	.glyph_index = 3080},	/*Unicode: U+005c (\)*/
-  {.w_px = 4,	.glyph_index = 3140},	/*Unicode: U+005d (])*/
-  {.w_px = 10,	.glyph_index = 3160},	/*Unicode: U+005e (^)*/
-  {.w_px = 11,	.glyph_index = 3220},	/*Unicode: U+005f (_)*/
-  {.w_px = 4,	.glyph_index = 3280},	/*Unicode: U+0060 (`)*/
-  {.w_px = 9,	.glyph_index = 3300},	/*Unicode: U+0061 (a)*/
-  {.w_px = 9,	.glyph_index = 3360},	/*Unicode: U+0062 (b)*/
-  {.w_px = 8,	.glyph_index = 3420},	/*Unicode: U+0063 (c)*/
-  {.w_px = 9,	.glyph_index = 3460},	/*Unicode: U+0064 (d)*/
-  {.w_px = 9,	.glyph_index = 3520},	/*Unicode: U+0065 (e)*/
-  {.w_px = 8,	.glyph_index = 3580},	/*Unicode: U+0066 (f)*/
-  {.w_px = 9,	.glyph_index = 3620},	/*Unicode: U+0067 (g)*/
-  {.w_px = 9,	.glyph_index = 3680},	/*Unicode: U+0068 (h)*/
-  {.w_px = 8,	.glyph_index = 3740},	/*Unicode: U+0069 (i)*/
-  {.w_px = 6,	.glyph_index = 3780},	/*Unicode: U+006a (j)*/
-  {.w_px = 10,	.glyph_index = 3820},	/*Unicode: U+006b (k)*/
-  {.w_px = 8,	.glyph_index = 3880},	/*Unicode: U+006c (l)*/
-  {.w_px = 10,	.glyph_index = 3920},	/*Unicode: U+006d (m)*/
-  {.w_px = 9,	.glyph_index = 3980},	/*Unicode: U+006e (n)*/
-  {.w_px = 9,	.glyph_index = 4040},	/*Unicode: U+006f (o)*/
-  {.w_px = 9,	.glyph_index = 4100},	/*Unicode: U+0070 (p)*/
-  {.w_px = 9,	.glyph_index = 4160},	/*Unicode: U+0071 (q)*/
-  {.w_px = 7,	.glyph_index = 4220},	/*Unicode: U+0072 (r)*/
-  {.w_px = 9,	.glyph_index = 4260},	/*Unicode: U+0073 (s)*/
-  {.w_px = 9,	.glyph_index = 4320},	/*Unicode: U+0074 (t)*/
-  {.w_px = 9,	.glyph_index = 4380},	/*Unicode: U+0075 (u)*/
-  {.w_px = 9,	.glyph_index = 4440},	/*Unicode: U+0076 (v)*/
-  {.w_px = 11,	.glyph_index = 4500},	/*Unicode: U+0077 (w)*/
-  {.w_px = 9,	.glyph_index = 4560},	/*Unicode: U+0078 (x)*/
-  {.w_px = 9,	.glyph_index = 4620},	/*Unicode: U+0079 (y)*/
-  {.w_px = 9,	.glyph_index = 4680},	/*Unicode: U+007a (z)*/
-  {.w_px = 8,	.glyph_index = 4740},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 4780},	/*Unicode: U+007c (|)*/
-  {.w_px = 8,	.glyph_index = 4800},	/*Unicode: U+007d (})*/
-  {.w_px = 9,	.glyph_index = 4840},	/*Unicode: U+007e (~)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 6,	.glyph_index = 13},	/*Unicode: U+0022 (")*/
+  {.w_px = 11,	.glyph_index = 19},	/*Unicode: U+0023 (#)*/
+  {.w_px = 9,	.glyph_index = 64},	/*Unicode: U+0024 ($)*/
+  {.w_px = 11,	.glyph_index = 118},	/*Unicode: U+0025 (%)*/
+  {.w_px = 10,	.glyph_index = 162},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 206},	/*Unicode: U+0027 (')*/
+  {.w_px = 4,	.glyph_index = 212},	/*Unicode: U+0028 (()*/
+  {.w_px = 4,	.glyph_index = 232},	/*Unicode: U+0029 ())*/
+  {.w_px = 7,	.glyph_index = 252},	/*Unicode: U+002a (*)*/
+  {.w_px = 10,	.glyph_index = 272},	/*Unicode: U+002b (+)*/
+  {.w_px = 3,	.glyph_index = 305},	/*Unicode: U+002c (,)*/
+  {.w_px = 5,	.glyph_index = 315},	/*Unicode: U+002d (-)*/
+  {.w_px = 2,	.glyph_index = 324},	/*Unicode: U+002e (.)*/
+  {.w_px = 9,	.glyph_index = 330},	/*Unicode: U+002f (/)*/
+  {.w_px = 9,	.glyph_index = 377},	/*Unicode: U+0030 (0)*/
+  {.w_px = 8,	.glyph_index = 420},	/*Unicode: U+0031 (1)*/
+  {.w_px = 10,	.glyph_index = 449},	/*Unicode: U+0032 (2)*/
+  {.w_px = 9,	.glyph_index = 493},	/*Unicode: U+0033 (3)*/
+  {.w_px = 9,	.glyph_index = 536},	/*Unicode: U+0034 (4)*/
+  {.w_px = 9,	.glyph_index = 578},	/*Unicode: U+0035 (5)*/
+  {.w_px = 9,	.glyph_index = 621},	/*Unicode: U+0036 (6)*/
+  {.w_px = 9,	.glyph_index = 664},	/*Unicode: U+0037 (7)*/
+  {.w_px = 9,	.glyph_index = 707},	/*Unicode: U+0038 (8)*/
+  {.w_px = 9,	.glyph_index = 750},	/*Unicode: U+0039 (9)*/
+  {.w_px = 2,	.glyph_index = 793},	/*Unicode: U+003a (:)*/
+  {.w_px = 3,	.glyph_index = 803},	/*Unicode: U+003b (;)*/
+  {.w_px = 9,	.glyph_index = 817},	/*Unicode: U+003c (<)*/
+  {.w_px = 9,	.glyph_index = 848},	/*Unicode: U+003d (=)*/
+  {.w_px = 9,	.glyph_index = 868},	/*Unicode: U+003e (>)*/
+  {.w_px = 7,	.glyph_index = 898},	/*Unicode: U+003f (?)*/
+  {.w_px = 9,	.glyph_index = 928},	/*Unicode: U+0040 (@)*/
+  {.w_px = 9,	.glyph_index = 977},	/*Unicode: U+0041 (A)*/
+  {.w_px = 9,	.glyph_index = 1021},	/*Unicode: U+0042 (B)*/
+  {.w_px = 9,	.glyph_index = 1064},	/*Unicode: U+0043 (C)*/
+  {.w_px = 9,	.glyph_index = 1108},	/*Unicode: U+0044 (D)*/
+  {.w_px = 9,	.glyph_index = 1151},	/*Unicode: U+0045 (E)*/
+  {.w_px = 9,	.glyph_index = 1195},	/*Unicode: U+0046 (F)*/
+  {.w_px = 9,	.glyph_index = 1237},	/*Unicode: U+0047 (G)*/
+  {.w_px = 9,	.glyph_index = 1280},	/*Unicode: U+0048 (H)*/
+  {.w_px = 8,	.glyph_index = 1324},	/*Unicode: U+0049 (I)*/
+  {.w_px = 7,	.glyph_index = 1351},	/*Unicode: U+004a (J)*/
+  {.w_px = 10,	.glyph_index = 1382},	/*Unicode: U+004b (K)*/
+  {.w_px = 9,	.glyph_index = 1426},	/*Unicode: U+004c (L)*/
+  {.w_px = 9,	.glyph_index = 1470},	/*Unicode: U+004d (M)*/
+  {.w_px = 9,	.glyph_index = 1514},	/*Unicode: U+004e (N)*/
+  {.w_px = 9,	.glyph_index = 1558},	/*Unicode: U+004f (O)*/
+  {.w_px = 9,	.glyph_index = 1601},	/*Unicode: U+0050 (P)*/
+  {.w_px = 9,	.glyph_index = 1643},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 10,	.glyph_index = 1692},	/*Unicode: U+0052 (R)*/
+  {.w_px = 9,	.glyph_index = 1736},	/*Unicode: U+0053 (S)*/
+  {.w_px = 10,	.glyph_index = 1779},	/*Unicode: U+0054 (T)*/
+  {.w_px = 9,	.glyph_index = 1822},	/*Unicode: U+0055 (U)*/
+  {.w_px = 9,	.glyph_index = 1865},	/*Unicode: U+0056 (V)*/
+  {.w_px = 11,	.glyph_index = 1908},	/*Unicode: U+0057 (W)*/
+  {.w_px = 9,	.glyph_index = 1952},	/*Unicode: U+0058 (X)*/
+  {.w_px = 10,	.glyph_index = 1996},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 9,	.glyph_index = 2039},	/*Unicode: U+005a (Z)*/
+  {.w_px = 4,	.glyph_index = 2083},	/*Unicode: U+005b ([)*/
+  {.w_px = 9,	.glyph_index = 2095},	/*Unicode: U+005c (\)*/
+  {.w_px = 4,	.glyph_index = 2145},	/*Unicode: U+005d (])*/
+  {.w_px = 10,	.glyph_index = 2157},	/*Unicode: U+005e (^)*/
+  {.w_px = 11,	.glyph_index = 2176},	/*Unicode: U+005f (_)*/
+  {.w_px = 4,	.glyph_index = 2185},	/*Unicode: U+0060 (`)*/
+  {.w_px = 9,	.glyph_index = 2193},	/*Unicode: U+0061 (a)*/
+  {.w_px = 9,	.glyph_index = 2228},	/*Unicode: U+0062 (b)*/
+  {.w_px = 8,	.glyph_index = 2274},	/*Unicode: U+0063 (c)*/
+  {.w_px = 9,	.glyph_index = 2299},	/*Unicode: U+0064 (d)*/
+  {.w_px = 9,	.glyph_index = 2345},	/*Unicode: U+0065 (e)*/
+  {.w_px = 8,	.glyph_index = 2379},	/*Unicode: U+0066 (f)*/
+  {.w_px = 9,	.glyph_index = 2410},	/*Unicode: U+0067 (g)*/
+  {.w_px = 9,	.glyph_index = 2455},	/*Unicode: U+0068 (h)*/
+  {.w_px = 8,	.glyph_index = 2502},	/*Unicode: U+0069 (i)*/
+  {.w_px = 6,	.glyph_index = 2532},	/*Unicode: U+006a (j)*/
+  {.w_px = 10,	.glyph_index = 2569},	/*Unicode: U+006b (k)*/
+  {.w_px = 8,	.glyph_index = 2616},	/*Unicode: U+006c (l)*/
+  {.w_px = 10,	.glyph_index = 2649},	/*Unicode: U+006d (m)*/
+  {.w_px = 9,	.glyph_index = 2664},	/*Unicode: U+006e (n)*/
+  {.w_px = 9,	.glyph_index = 2699},	/*Unicode: U+006f (o)*/
+  {.w_px = 9,	.glyph_index = 2733},	/*Unicode: U+0070 (p)*/
+  {.w_px = 9,	.glyph_index = 2778},	/*Unicode: U+0071 (q)*/
+  {.w_px = 7,	.glyph_index = 2823},	/*Unicode: U+0072 (r)*/
+  {.w_px = 9,	.glyph_index = 2847},	/*Unicode: U+0073 (s)*/
+  {.w_px = 9,	.glyph_index = 2881},	/*Unicode: U+0074 (t)*/
+  {.w_px = 9,	.glyph_index = 2925},	/*Unicode: U+0075 (u)*/
+  {.w_px = 9,	.glyph_index = 2960},	/*Unicode: U+0076 (v)*/
+  {.w_px = 11,	.glyph_index = 2994},	/*Unicode: U+0077 (w)*/
+  {.w_px = 9,	.glyph_index = 3029},	/*Unicode: U+0078 (x)*/
+  {.w_px = 9,	.glyph_index = 3064},	/*Unicode: U+0079 (y)*/
+  {.w_px = 9,	.glyph_index = 3109},	/*Unicode: U+007a (z)*/
+  {.w_px = 8,	.glyph_index = 3144},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 3182},	/*Unicode: U+007c (|)*/
+  {.w_px = 8,	.glyph_index = 3187},	/*Unicode: U+007d (})*/
+  {.w_px = 9,	.glyph_index = 3225},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 4
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 2,	.glyph_index = 60},	/*Unicode: U+0021 (!)*/
-  {.w_px = 6,	.glyph_index = 80},	/*Unicode: U+0022 (")*/
-  {.w_px = 11,	.glyph_index = 140},	/*Unicode: U+0023 (#)*/
-  {.w_px = 9,	.glyph_index = 260},	/*Unicode: U+0024 ($)*/
-  {.w_px = 11,	.glyph_index = 360},	/*Unicode: U+0025 (%)*/
-  {.w_px = 10,	.glyph_index = 480},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 580},	/*Unicode: U+0027 (')*/
-  {.w_px = 4,	.glyph_index = 600},	/*Unicode: U+0028 (()*/
-  {.w_px = 4,	.glyph_index = 640},	/*Unicode: U+0029 ())*/
-  {.w_px = 7,	.glyph_index = 680},	/*Unicode: U+002a (*)*/
-  {.w_px = 10,	.glyph_index = 760},	/*Unicode: U+002b (+)*/
-  {.w_px = 3,	.glyph_index = 860},	/*Unicode: U+002c (,)*/
-  {.w_px = 5,	.glyph_index = 900},	/*Unicode: U+002d (-)*/
-  {.w_px = 2,	.glyph_index = 960},	/*Unicode: U+002e (.)*/
-  {.w_px = 9,	.glyph_index = 980},	/*Unicode: U+002f (/)*/
-  {.w_px = 9,	.glyph_index = 1080},	/*Unicode: U+0030 (0)*/
-  {.w_px = 8,	.glyph_index = 1180},	/*Unicode: U+0031 (1)*/
-  {.w_px = 10,	.glyph_index = 1260},	/*Unicode: U+0032 (2)*/
-  {.w_px = 9,	.glyph_index = 1360},	/*Unicode: U+0033 (3)*/
-  {.w_px = 9,	.glyph_index = 1460},	/*Unicode: U+0034 (4)*/
-  {.w_px = 9,	.glyph_index = 1560},	/*Unicode: U+0035 (5)*/
-  {.w_px = 9,	.glyph_index = 1660},	/*Unicode: U+0036 (6)*/
-  {.w_px = 9,	.glyph_index = 1760},	/*Unicode: U+0037 (7)*/
-  {.w_px = 9,	.glyph_index = 1860},	/*Unicode: U+0038 (8)*/
-  {.w_px = 9,	.glyph_index = 1960},	/*Unicode: U+0039 (9)*/
-  {.w_px = 2,	.glyph_index = 2060},	/*Unicode: U+003a (:)*/
-  {.w_px = 3,	.glyph_index = 2080},	/*Unicode: U+003b (;)*/
-  {.w_px = 9,	.glyph_index = 2120},	/*Unicode: U+003c (<)*/
-  {.w_px = 9,	.glyph_index = 2220},	/*Unicode: U+003d (=)*/
-  {.w_px = 9,	.glyph_index = 2320},	/*Unicode: U+003e (>)*/
-  {.w_px = 7,	.glyph_index = 2420},	/*Unicode: U+003f (?)*/
-  {.w_px = 9,	.glyph_index = 2500},	/*Unicode: U+0040 (@)*/
-  {.w_px = 9,	.glyph_index = 2600},	/*Unicode: U+0041 (A)*/
-  {.w_px = 9,	.glyph_index = 2700},	/*Unicode: U+0042 (B)*/
-  {.w_px = 9,	.glyph_index = 2800},	/*Unicode: U+0043 (C)*/
-  {.w_px = 9,	.glyph_index = 2900},	/*Unicode: U+0044 (D)*/
-  {.w_px = 9,	.glyph_index = 3000},	/*Unicode: U+0045 (E)*/
-  {.w_px = 9,	.glyph_index = 3100},	/*Unicode: U+0046 (F)*/
-  {.w_px = 9,	.glyph_index = 3200},	/*Unicode: U+0047 (G)*/
-  {.w_px = 9,	.glyph_index = 3300},	/*Unicode: U+0048 (H)*/
-  {.w_px = 8,	.glyph_index = 3400},	/*Unicode: U+0049 (I)*/
-  {.w_px = 7,	.glyph_index = 3480},	/*Unicode: U+004a (J)*/
-  {.w_px = 10,	.glyph_index = 3560},	/*Unicode: U+004b (K)*/
-  {.w_px = 9,	.glyph_index = 3660},	/*Unicode: U+004c (L)*/
-  {.w_px = 9,	.glyph_index = 3760},	/*Unicode: U+004d (M)*/
-  {.w_px = 9,	.glyph_index = 3860},	/*Unicode: U+004e (N)*/
-  {.w_px = 9,	.glyph_index = 3960},	/*Unicode: U+004f (O)*/
-  {.w_px = 9,	.glyph_index = 4060},	/*Unicode: U+0050 (P)*/
-  {.w_px = 9,	.glyph_index = 4160},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 10,	.glyph_index = 4260},	/*Unicode: U+0052 (R)*/
-  {.w_px = 9,	.glyph_index = 4360},	/*Unicode: U+0053 (S)*/
-  {.w_px = 10,	.glyph_index = 4460},	/*Unicode: U+0054 (T)*/
-  {.w_px = 9,	.glyph_index = 4560},	/*Unicode: U+0055 (U)*/
-  {.w_px = 9,	.glyph_index = 4660},	/*Unicode: U+0056 (V)*/
-  {.w_px = 11,	.glyph_index = 4760},	/*Unicode: U+0057 (W)*/
-  {.w_px = 9,	.glyph_index = 4880},	/*Unicode: U+0058 (X)*/
-  {.w_px = 10,	.glyph_index = 4980},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 9,	.glyph_index = 5080},	/*Unicode: U+005a (Z)*/
-  {.w_px = 4,	.glyph_index = 5180},	/*Unicode: U+005b ([)*/
-  {.w_px = 9,	.glyph_index = 5220},	/*Unicode: U+005c (\)*/
-  {.w_px = 4,	.glyph_index = 5320},	/*Unicode: U+005d (])*/
-  {.w_px = 10,	.glyph_index = 5360},	/*Unicode: U+005e (^)*/
-  {.w_px = 11,	.glyph_index = 5460},	/*Unicode: U+005f (_)*/
-  {.w_px = 4,	.glyph_index = 5580},	/*Unicode: U+0060 (`)*/
-  {.w_px = 9,	.glyph_index = 5620},	/*Unicode: U+0061 (a)*/
-  {.w_px = 9,	.glyph_index = 5720},	/*Unicode: U+0062 (b)*/
-  {.w_px = 8,	.glyph_index = 5820},	/*Unicode: U+0063 (c)*/
-  {.w_px = 9,	.glyph_index = 5900},	/*Unicode: U+0064 (d)*/
-  {.w_px = 9,	.glyph_index = 6000},	/*Unicode: U+0065 (e)*/
-  {.w_px = 8,	.glyph_index = 6100},	/*Unicode: U+0066 (f)*/
-  {.w_px = 9,	.glyph_index = 6180},	/*Unicode: U+0067 (g)*/
-  {.w_px = 9,	.glyph_index = 6280},	/*Unicode: U+0068 (h)*/
-  {.w_px = 8,	.glyph_index = 6380},	/*Unicode: U+0069 (i)*/
-  {.w_px = 6,	.glyph_index = 6460},	/*Unicode: U+006a (j)*/
-  {.w_px = 10,	.glyph_index = 6520},	/*Unicode: U+006b (k)*/
-  {.w_px = 8,	.glyph_index = 6620},	/*Unicode: U+006c (l)*/
-  {.w_px = 10,	.glyph_index = 6700},	/*Unicode: U+006d (m)*/
-  {.w_px = 9,	.glyph_index = 6800},	/*Unicode: U+006e (n)*/
-  {.w_px = 9,	.glyph_index = 6900},	/*Unicode: U+006f (o)*/
-  {.w_px = 9,	.glyph_index = 7000},	/*Unicode: U+0070 (p)*/
-  {.w_px = 9,	.glyph_index = 7100},	/*Unicode: U+0071 (q)*/
-  {.w_px = 7,	.glyph_index = 7200},	/*Unicode: U+0072 (r)*/
-  {.w_px = 9,	.glyph_index = 7280},	/*Unicode: U+0073 (s)*/
-  {.w_px = 9,	.glyph_index = 7380},	/*Unicode: U+0074 (t)*/
-  {.w_px = 9,	.glyph_index = 7480},	/*Unicode: U+0075 (u)*/
-  {.w_px = 9,	.glyph_index = 7580},	/*Unicode: U+0076 (v)*/
-  {.w_px = 11,	.glyph_index = 7680},	/*Unicode: U+0077 (w)*/
-  {.w_px = 9,	.glyph_index = 7800},	/*Unicode: U+0078 (x)*/
-  {.w_px = 9,	.glyph_index = 7900},	/*Unicode: U+0079 (y)*/
-  {.w_px = 9,	.glyph_index = 8000},	/*Unicode: U+007a (z)*/
-  {.w_px = 8,	.glyph_index = 8100},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 8180},	/*Unicode: U+007c (|)*/
-  {.w_px = 8,	.glyph_index = 8200},	/*Unicode: U+007d (})*/
-  {.w_px = 9,	.glyph_index = 8280},	/*Unicode: U+007e (~)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 6,	.glyph_index = 15},	/*Unicode: U+0022 (")*/
+  {.w_px = 11,	.glyph_index = 35},	/*Unicode: U+0023 (#)*/
+  {.w_px = 9,	.glyph_index = 114},	/*Unicode: U+0024 ($)*/
+  {.w_px = 11,	.glyph_index = 196},	/*Unicode: U+0025 (%)*/
+  {.w_px = 10,	.glyph_index = 278},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 347},	/*Unicode: U+0027 (')*/
+  {.w_px = 4,	.glyph_index = 353},	/*Unicode: U+0028 (()*/
+  {.w_px = 4,	.glyph_index = 389},	/*Unicode: U+0029 ())*/
+  {.w_px = 7,	.glyph_index = 425},	/*Unicode: U+002a (*)*/
+  {.w_px = 10,	.glyph_index = 459},	/*Unicode: U+002b (+)*/
+  {.w_px = 3,	.glyph_index = 497},	/*Unicode: U+002c (,)*/
+  {.w_px = 5,	.glyph_index = 511},	/*Unicode: U+002d (-)*/
+  {.w_px = 2,	.glyph_index = 522},	/*Unicode: U+002e (.)*/
+  {.w_px = 9,	.glyph_index = 528},	/*Unicode: U+002f (/)*/
+  {.w_px = 9,	.glyph_index = 602},	/*Unicode: U+0030 (0)*/
+  {.w_px = 8,	.glyph_index = 670},	/*Unicode: U+0031 (1)*/
+  {.w_px = 10,	.glyph_index = 721},	/*Unicode: U+0032 (2)*/
+  {.w_px = 9,	.glyph_index = 787},	/*Unicode: U+0033 (3)*/
+  {.w_px = 9,	.glyph_index = 854},	/*Unicode: U+0034 (4)*/
+  {.w_px = 9,	.glyph_index = 919},	/*Unicode: U+0035 (5)*/
+  {.w_px = 9,	.glyph_index = 988},	/*Unicode: U+0036 (6)*/
+  {.w_px = 9,	.glyph_index = 1056},	/*Unicode: U+0037 (7)*/
+  {.w_px = 9,	.glyph_index = 1121},	/*Unicode: U+0038 (8)*/
+  {.w_px = 9,	.glyph_index = 1190},	/*Unicode: U+0039 (9)*/
+  {.w_px = 2,	.glyph_index = 1259},	/*Unicode: U+003a (:)*/
+  {.w_px = 3,	.glyph_index = 1269},	/*Unicode: U+003b (;)*/
+  {.w_px = 9,	.glyph_index = 1292},	/*Unicode: U+003c (<)*/
+  {.w_px = 9,	.glyph_index = 1339},	/*Unicode: U+003d (=)*/
+  {.w_px = 9,	.glyph_index = 1361},	/*Unicode: U+003e (>)*/
+  {.w_px = 7,	.glyph_index = 1406},	/*Unicode: U+003f (?)*/
+  {.w_px = 9,	.glyph_index = 1457},	/*Unicode: U+0040 (@)*/
+  {.w_px = 9,	.glyph_index = 1535},	/*Unicode: U+0041 (A)*/
+  {.w_px = 9,	.glyph_index = 1604},	/*Unicode: U+0042 (B)*/
+  {.w_px = 9,	.glyph_index = 1671},	/*Unicode: U+0043 (C)*/
+  {.w_px = 9,	.glyph_index = 1739},	/*Unicode: U+0044 (D)*/
+  {.w_px = 9,	.glyph_index = 1808},	/*Unicode: U+0045 (E)*/
+  {.w_px = 9,	.glyph_index = 1862},	/*Unicode: U+0046 (F)*/
+  {.w_px = 9,	.glyph_index = 1914},	/*Unicode: U+0047 (G)*/
+  {.w_px = 9,	.glyph_index = 1982},	/*Unicode: U+0048 (H)*/
+  {.w_px = 8,	.glyph_index = 2050},	/*Unicode: U+0049 (I)*/
+  {.w_px = 7,	.glyph_index = 2095},	/*Unicode: U+004a (J)*/
+  {.w_px = 10,	.glyph_index = 2150},	/*Unicode: U+004b (K)*/
+  {.w_px = 9,	.glyph_index = 2220},	/*Unicode: U+004c (L)*/
+  {.w_px = 9,	.glyph_index = 2276},	/*Unicode: U+004d (M)*/
+  {.w_px = 9,	.glyph_index = 2346},	/*Unicode: U+004e (N)*/
+  {.w_px = 9,	.glyph_index = 2416},	/*Unicode: U+004f (O)*/
+  {.w_px = 9,	.glyph_index = 2484},	/*Unicode: U+0050 (P)*/
+  {.w_px = 9,	.glyph_index = 2544},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 10,	.glyph_index = 2621},	/*Unicode: U+0052 (R)*/
+  {.w_px = 9,	.glyph_index = 2690},	/*Unicode: U+0053 (S)*/
+  {.w_px = 10,	.glyph_index = 2758},	/*Unicode: U+0054 (T)*/
+  {.w_px = 9,	.glyph_index = 2808},	/*Unicode: U+0055 (U)*/
+  {.w_px = 9,	.glyph_index = 2877},	/*Unicode: U+0056 (V)*/
+  {.w_px = 11,	.glyph_index = 2945},	/*Unicode: U+0057 (W)*/
+  {.w_px = 9,	.glyph_index = 3027},	/*Unicode: U+0058 (X)*/
+  {.w_px = 10,	.glyph_index = 3097},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 9,	.glyph_index = 3160},	/*Unicode: U+005a (Z)*/
+  {.w_px = 4,	.glyph_index = 3226},	/*Unicode: U+005b ([)*/
+  {.w_px = 9,	.glyph_index = 3258},	/*Unicode: U+005c (\)*/
+  {.w_px = 4,	.glyph_index = 3335},	/*Unicode: U+005d (])*/
+  {.w_px = 10,	.glyph_index = 3367},	/*Unicode: U+005e (^)*/
+  {.w_px = 11,	.glyph_index = 3396},	/*Unicode: U+005f (_)*/
+  {.w_px = 4,	.glyph_index = 3406},	/*Unicode: U+0060 (`)*/
+  {.w_px = 9,	.glyph_index = 3417},	/*Unicode: U+0061 (a)*/
+  {.w_px = 9,	.glyph_index = 3472},	/*Unicode: U+0062 (b)*/
+  {.w_px = 8,	.glyph_index = 3542},	/*Unicode: U+0063 (c)*/
+  {.w_px = 9,	.glyph_index = 3586},	/*Unicode: U+0064 (d)*/
+  {.w_px = 9,	.glyph_index = 3658},	/*Unicode: U+0065 (e)*/
+  {.w_px = 8,	.glyph_index = 3710},	/*Unicode: U+0066 (f)*/
+  {.w_px = 9,	.glyph_index = 3763},	/*Unicode: U+0067 (g)*/
+  {.w_px = 9,	.glyph_index = 3836},	/*Unicode: U+0068 (h)*/
+  {.w_px = 8,	.glyph_index = 3907},	/*Unicode: U+0069 (i)*/
+  {.w_px = 6,	.glyph_index = 3955},	/*Unicode: U+006a (j)*/
+  {.w_px = 10,	.glyph_index = 4007},	/*Unicode: U+006b (k)*/
+  {.w_px = 8,	.glyph_index = 4078},	/*Unicode: U+006c (l)*/
+  {.w_px = 10,	.glyph_index = 4139},	/*Unicode: U+006d (m)*/
+  {.w_px = 9,	.glyph_index = 4194},	/*Unicode: U+006e (n)*/
+  {.w_px = 9,	.glyph_index = 4249},	/*Unicode: U+006f (o)*/
+  {.w_px = 9,	.glyph_index = 4303},	/*Unicode: U+0070 (p)*/
+  {.w_px = 9,	.glyph_index = 4371},	/*Unicode: U+0071 (q)*/
+  {.w_px = 7,	.glyph_index = 4444},	/*Unicode: U+0072 (r)*/
+  {.w_px = 9,	.glyph_index = 4486},	/*Unicode: U+0073 (s)*/
+  {.w_px = 9,	.glyph_index = 4539},	/*Unicode: U+0074 (t)*/
+  {.w_px = 9,	.glyph_index = 4606},	/*Unicode: U+0075 (u)*/
+  {.w_px = 9,	.glyph_index = 4661},	/*Unicode: U+0076 (v)*/
+  {.w_px = 11,	.glyph_index = 4714},	/*Unicode: U+0077 (w)*/
+  {.w_px = 9,	.glyph_index = 4778},	/*Unicode: U+0078 (x)*/
+  {.w_px = 9,	.glyph_index = 4833},	/*Unicode: U+0079 (y)*/
+  {.w_px = 9,	.glyph_index = 4905},	/*Unicode: U+007a (z)*/
+  {.w_px = 8,	.glyph_index = 4956},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 5028},	/*Unicode: U+007c (|)*/
+  {.w_px = 8,	.glyph_index = 5033},	/*Unicode: U+007d (})*/
+  {.w_px = 9,	.glyph_index = 5104},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_20 == 8
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 2,	.glyph_index = 120},	/*Unicode: U+0021 (!)*/
-  {.w_px = 6,	.glyph_index = 160},	/*Unicode: U+0022 (")*/
-  {.w_px = 11,	.glyph_index = 280},	/*Unicode: U+0023 (#)*/
-  {.w_px = 9,	.glyph_index = 500},	/*Unicode: U+0024 ($)*/
-  {.w_px = 11,	.glyph_index = 680},	/*Unicode: U+0025 (%)*/
-  {.w_px = 10,	.glyph_index = 900},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 1100},	/*Unicode: U+0027 (')*/
-  {.w_px = 4,	.glyph_index = 1140},	/*Unicode: U+0028 (()*/
-  {.w_px = 4,	.glyph_index = 1220},	/*Unicode: U+0029 ())*/
-  {.w_px = 7,	.glyph_index = 1300},	/*Unicode: U+002a (*)*/
-  {.w_px = 10,	.glyph_index = 1440},	/*Unicode: U+002b (+)*/
-  {.w_px = 3,	.glyph_index = 1640},	/*Unicode: U+002c (,)*/
-  {.w_px = 5,	.glyph_index = 1700},	/*Unicode: U+002d (-)*/
-  {.w_px = 2,	.glyph_index = 1800},	/*Unicode: U+002e (.)*/
-  {.w_px = 9,	.glyph_index = 1840},	/*Unicode: U+002f (/)*/
-  {.w_px = 9,	.glyph_index = 2020},	/*Unicode: U+0030 (0)*/
-  {.w_px = 8,	.glyph_index = 2200},	/*Unicode: U+0031 (1)*/
-  {.w_px = 10,	.glyph_index = 2360},	/*Unicode: U+0032 (2)*/
-  {.w_px = 9,	.glyph_index = 2560},	/*Unicode: U+0033 (3)*/
-  {.w_px = 9,	.glyph_index = 2740},	/*Unicode: U+0034 (4)*/
-  {.w_px = 9,	.glyph_index = 2920},	/*Unicode: U+0035 (5)*/
-  {.w_px = 9,	.glyph_index = 3100},	/*Unicode: U+0036 (6)*/
-  {.w_px = 9,	.glyph_index = 3280},	/*Unicode: U+0037 (7)*/
-  {.w_px = 9,	.glyph_index = 3460},	/*Unicode: U+0038 (8)*/
-  {.w_px = 9,	.glyph_index = 3640},	/*Unicode: U+0039 (9)*/
-  {.w_px = 2,	.glyph_index = 3820},	/*Unicode: U+003a (:)*/
-  {.w_px = 3,	.glyph_index = 3860},	/*Unicode: U+003b (;)*/
-  {.w_px = 9,	.glyph_index = 3920},	/*Unicode: U+003c (<)*/
-  {.w_px = 9,	.glyph_index = 4100},	/*Unicode: U+003d (=)*/
-  {.w_px = 9,	.glyph_index = 4280},	/*Unicode: U+003e (>)*/
-  {.w_px = 7,	.glyph_index = 4460},	/*Unicode: U+003f (?)*/
-  {.w_px = 9,	.glyph_index = 4600},	/*Unicode: U+0040 (@)*/
-  {.w_px = 9,	.glyph_index = 4780},	/*Unicode: U+0041 (A)*/
-  {.w_px = 9,	.glyph_index = 4960},	/*Unicode: U+0042 (B)*/
-  {.w_px = 9,	.glyph_index = 5140},	/*Unicode: U+0043 (C)*/
-  {.w_px = 9,	.glyph_index = 5320},	/*Unicode: U+0044 (D)*/
-  {.w_px = 9,	.glyph_index = 5500},	/*Unicode: U+0045 (E)*/
-  {.w_px = 9,	.glyph_index = 5680},	/*Unicode: U+0046 (F)*/
-  {.w_px = 9,	.glyph_index = 5860},	/*Unicode: U+0047 (G)*/
-  {.w_px = 9,	.glyph_index = 6040},	/*Unicode: U+0048 (H)*/
-  {.w_px = 8,	.glyph_index = 6220},	/*Unicode: U+0049 (I)*/
-  {.w_px = 7,	.glyph_index = 6380},	/*Unicode: U+004a (J)*/
-  {.w_px = 10,	.glyph_index = 6520},	/*Unicode: U+004b (K)*/
-  {.w_px = 9,	.glyph_index = 6720},	/*Unicode: U+004c (L)*/
-  {.w_px = 9,	.glyph_index = 6900},	/*Unicode: U+004d (M)*/
-  {.w_px = 9,	.glyph_index = 7080},	/*Unicode: U+004e (N)*/
-  {.w_px = 9,	.glyph_index = 7260},	/*Unicode: U+004f (O)*/
-  {.w_px = 9,	.glyph_index = 7440},	/*Unicode: U+0050 (P)*/
-  {.w_px = 9,	.glyph_index = 7620},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 10,	.glyph_index = 7800},	/*Unicode: U+0052 (R)*/
-  {.w_px = 9,	.glyph_index = 8000},	/*Unicode: U+0053 (S)*/
-  {.w_px = 10,	.glyph_index = 8180},	/*Unicode: U+0054 (T)*/
-  {.w_px = 9,	.glyph_index = 8380},	/*Unicode: U+0055 (U)*/
-  {.w_px = 9,	.glyph_index = 8560},	/*Unicode: U+0056 (V)*/
-  {.w_px = 11,	.glyph_index = 8740},	/*Unicode: U+0057 (W)*/
-  {.w_px = 9,	.glyph_index = 8960},	/*Unicode: U+0058 (X)*/
-  {.w_px = 10,	.glyph_index = 9140},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 9,	.glyph_index = 9340},	/*Unicode: U+005a (Z)*/
-  {.w_px = 4,	.glyph_index = 9520},	/*Unicode: U+005b ([)*/
-  {.w_px = 9,	.glyph_index = 9600},	/*Unicode: U+005c (\)*/
-  {.w_px = 4,	.glyph_index = 9780},	/*Unicode: U+005d (])*/
-  {.w_px = 10,	.glyph_index = 9860},	/*Unicode: U+005e (^)*/
-  {.w_px = 11,	.glyph_index = 10060},	/*Unicode: U+005f (_)*/
-  {.w_px = 4,	.glyph_index = 10280},	/*Unicode: U+0060 (`)*/
-  {.w_px = 9,	.glyph_index = 10360},	/*Unicode: U+0061 (a)*/
-  {.w_px = 9,	.glyph_index = 10540},	/*Unicode: U+0062 (b)*/
-  {.w_px = 8,	.glyph_index = 10720},	/*Unicode: U+0063 (c)*/
-  {.w_px = 9,	.glyph_index = 10880},	/*Unicode: U+0064 (d)*/
-  {.w_px = 9,	.glyph_index = 11060},	/*Unicode: U+0065 (e)*/
-  {.w_px = 8,	.glyph_index = 11240},	/*Unicode: U+0066 (f)*/
-  {.w_px = 9,	.glyph_index = 11400},	/*Unicode: U+0067 (g)*/
-  {.w_px = 9,	.glyph_index = 11580},	/*Unicode: U+0068 (h)*/
-  {.w_px = 8,	.glyph_index = 11760},	/*Unicode: U+0069 (i)*/
-  {.w_px = 6,	.glyph_index = 11920},	/*Unicode: U+006a (j)*/
-  {.w_px = 10,	.glyph_index = 12040},	/*Unicode: U+006b (k)*/
-  {.w_px = 8,	.glyph_index = 12240},	/*Unicode: U+006c (l)*/
-  {.w_px = 10,	.glyph_index = 12400},	/*Unicode: U+006d (m)*/
-  {.w_px = 9,	.glyph_index = 12600},	/*Unicode: U+006e (n)*/
-  {.w_px = 9,	.glyph_index = 12780},	/*Unicode: U+006f (o)*/
-  {.w_px = 9,	.glyph_index = 12960},	/*Unicode: U+0070 (p)*/
-  {.w_px = 9,	.glyph_index = 13140},	/*Unicode: U+0071 (q)*/
-  {.w_px = 7,	.glyph_index = 13320},	/*Unicode: U+0072 (r)*/
-  {.w_px = 9,	.glyph_index = 13460},	/*Unicode: U+0073 (s)*/
-  {.w_px = 9,	.glyph_index = 13640},	/*Unicode: U+0074 (t)*/
-  {.w_px = 9,	.glyph_index = 13820},	/*Unicode: U+0075 (u)*/
-  {.w_px = 9,	.glyph_index = 14000},	/*Unicode: U+0076 (v)*/
-  {.w_px = 11,	.glyph_index = 14180},	/*Unicode: U+0077 (w)*/
-  {.w_px = 9,	.glyph_index = 14400},	/*Unicode: U+0078 (x)*/
-  {.w_px = 9,	.glyph_index = 14580},	/*Unicode: U+0079 (y)*/
-  {.w_px = 9,	.glyph_index = 14760},	/*Unicode: U+007a (z)*/
-  {.w_px = 8,	.glyph_index = 14940},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 15100},	/*Unicode: U+007c (|)*/
-  {.w_px = 8,	.glyph_index = 15140},	/*Unicode: U+007d (})*/
-  {.w_px = 9,	.glyph_index = 15300},	/*Unicode: U+007e (~)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 6,	.glyph_index = 19},	/*Unicode: U+0022 (")*/
+  {.w_px = 11,	.glyph_index = 50},	/*Unicode: U+0023 (#)*/
+  {.w_px = 9,	.glyph_index = 166},	/*Unicode: U+0024 ($)*/
+  {.w_px = 11,	.glyph_index = 290},	/*Unicode: U+0025 (%)*/
+  {.w_px = 10,	.glyph_index = 422},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 540},	/*Unicode: U+0027 (')*/
+  {.w_px = 4,	.glyph_index = 546},	/*Unicode: U+0028 (()*/
+  {.w_px = 4,	.glyph_index = 613},	/*Unicode: U+0029 ())*/
+  {.w_px = 7,	.glyph_index = 680},	/*Unicode: U+002a (*)*/
+  {.w_px = 10,	.glyph_index = 735},	/*Unicode: U+002b (+)*/
+  {.w_px = 3,	.glyph_index = 781},	/*Unicode: U+002c (,)*/
+  {.w_px = 5,	.glyph_index = 799},	/*Unicode: U+002d (-)*/
+  {.w_px = 2,	.glyph_index = 805},	/*Unicode: U+002e (.)*/
+  {.w_px = 9,	.glyph_index = 811},	/*Unicode: U+002f (/)*/
+  {.w_px = 9,	.glyph_index = 907},	/*Unicode: U+0030 (0)*/
+  {.w_px = 8,	.glyph_index = 1023},	/*Unicode: U+0031 (1)*/
+  {.w_px = 10,	.glyph_index = 1089},	/*Unicode: U+0032 (2)*/
+  {.w_px = 9,	.glyph_index = 1187},	/*Unicode: U+0033 (3)*/
+  {.w_px = 9,	.glyph_index = 1286},	/*Unicode: U+0034 (4)*/
+  {.w_px = 9,	.glyph_index = 1371},	/*Unicode: U+0035 (5)*/
+  {.w_px = 9,	.glyph_index = 1458},	/*Unicode: U+0036 (6)*/
+  {.w_px = 9,	.glyph_index = 1566},	/*Unicode: U+0037 (7)*/
+  {.w_px = 9,	.glyph_index = 1648},	/*Unicode: U+0038 (8)*/
+  {.w_px = 9,	.glyph_index = 1762},	/*Unicode: U+0039 (9)*/
+  {.w_px = 2,	.glyph_index = 1870},	/*Unicode: U+003a (:)*/
+  {.w_px = 3,	.glyph_index = 1880},	/*Unicode: U+003b (;)*/
+  {.w_px = 9,	.glyph_index = 1909},	/*Unicode: U+003c (<)*/
+  {.w_px = 9,	.glyph_index = 1978},	/*Unicode: U+003d (=)*/
+  {.w_px = 9,	.glyph_index = 1988},	/*Unicode: U+003e (>)*/
+  {.w_px = 7,	.glyph_index = 2057},	/*Unicode: U+003f (?)*/
+  {.w_px = 9,	.glyph_index = 2136},	/*Unicode: U+0040 (@)*/
+  {.w_px = 9,	.glyph_index = 2264},	/*Unicode: U+0041 (A)*/
+  {.w_px = 9,	.glyph_index = 2372},	/*Unicode: U+0042 (B)*/
+  {.w_px = 9,	.glyph_index = 2471},	/*Unicode: U+0043 (C)*/
+  {.w_px = 9,	.glyph_index = 2564},	/*Unicode: U+0044 (D)*/
+  {.w_px = 9,	.glyph_index = 2670},	/*Unicode: U+0045 (E)*/
+  {.w_px = 9,	.glyph_index = 2709},	/*Unicode: U+0046 (F)*/
+  {.w_px = 9,	.glyph_index = 2762},	/*Unicode: U+0047 (G)*/
+  {.w_px = 9,	.glyph_index = 2864},	/*Unicode: U+0048 (H)*/
+  {.w_px = 8,	.glyph_index = 2916},	/*Unicode: U+0049 (I)*/
+  {.w_px = 7,	.glyph_index = 2971},	/*Unicode: U+004a (J)*/
+  {.w_px = 10,	.glyph_index = 3040},	/*Unicode: U+004b (K)*/
+  {.w_px = 9,	.glyph_index = 3168},	/*Unicode: U+004c (L)*/
+  {.w_px = 9,	.glyph_index = 3229},	/*Unicode: U+004d (M)*/
+  {.w_px = 9,	.glyph_index = 3320},	/*Unicode: U+004e (N)*/
+  {.w_px = 9,	.glyph_index = 3420},	/*Unicode: U+004f (O)*/
+  {.w_px = 9,	.glyph_index = 3534},	/*Unicode: U+0050 (P)*/
+  {.w_px = 9,	.glyph_index = 3620},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 10,	.glyph_index = 3747},	/*Unicode: U+0052 (R)*/
+  {.w_px = 9,	.glyph_index = 3862},	/*Unicode: U+0053 (S)*/
+  {.w_px = 10,	.glyph_index = 3964},	/*Unicode: U+0054 (T)*/
+  {.w_px = 9,	.glyph_index = 4025},	/*Unicode: U+0055 (U)*/
+  {.w_px = 9,	.glyph_index = 4105},	/*Unicode: U+0056 (V)*/
+  {.w_px = 11,	.glyph_index = 4217},	/*Unicode: U+0057 (W)*/
+  {.w_px = 9,	.glyph_index = 4356},	/*Unicode: U+0058 (X)*/
+  {.w_px = 10,	.glyph_index = 4470},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 9,	.glyph_index = 4568},	/*Unicode: U+005a (Z)*/
+  {.w_px = 4,	.glyph_index = 4643},	/*Unicode: U+005b ([)*/
+  {.w_px = 9,	.glyph_index = 4698},	/*Unicode: U+005c (\)*/
+  {.w_px = 4,	.glyph_index = 4794},	/*Unicode: U+005d (])*/
+  {.w_px = 10,	.glyph_index = 4849},	/*Unicode: U+005e (^)*/
+  {.w_px = 11,	.glyph_index = 4898},	/*Unicode: U+005f (_)*/
+  {.w_px = 4,	.glyph_index = 4904},	/*Unicode: U+0060 (`)*/
+  {.w_px = 9,	.glyph_index = 4921},	/*Unicode: U+0061 (a)*/
+  {.w_px = 9,	.glyph_index = 5002},	/*Unicode: U+0062 (b)*/
+  {.w_px = 8,	.glyph_index = 5114},	/*Unicode: U+0063 (c)*/
+  {.w_px = 9,	.glyph_index = 5184},	/*Unicode: U+0064 (d)*/
+  {.w_px = 9,	.glyph_index = 5294},	/*Unicode: U+0065 (e)*/
+  {.w_px = 8,	.glyph_index = 5370},	/*Unicode: U+0066 (f)*/
+  {.w_px = 9,	.glyph_index = 5441},	/*Unicode: U+0067 (g)*/
+  {.w_px = 9,	.glyph_index = 5561},	/*Unicode: U+0068 (h)*/
+  {.w_px = 8,	.glyph_index = 5651},	/*Unicode: U+0069 (i)*/
+  {.w_px = 6,	.glyph_index = 5705},	/*Unicode: U+006a (j)*/
+  {.w_px = 10,	.glyph_index = 5785},	/*Unicode: U+006b (k)*/
+  {.w_px = 8,	.glyph_index = 5905},	/*Unicode: U+006c (l)*/
+  {.w_px = 10,	.glyph_index = 5981},	/*Unicode: U+006d (m)*/
+  {.w_px = 9,	.glyph_index = 6082},	/*Unicode: U+006e (n)*/
+  {.w_px = 9,	.glyph_index = 6152},	/*Unicode: U+006f (o)*/
+  {.w_px = 9,	.glyph_index = 6241},	/*Unicode: U+0070 (p)*/
+  {.w_px = 9,	.glyph_index = 6351},	/*Unicode: U+0071 (q)*/
+  {.w_px = 7,	.glyph_index = 6461},	/*Unicode: U+0072 (r)*/
+  {.w_px = 9,	.glyph_index = 6519},	/*Unicode: U+0073 (s)*/
+  {.w_px = 9,	.glyph_index = 6597},	/*Unicode: U+0074 (t)*/
+  {.w_px = 9,	.glyph_index = 6666},	/*Unicode: U+0075 (u)*/
+  {.w_px = 9,	.glyph_index = 6733},	/*Unicode: U+0076 (v)*/
+  {.w_px = 11,	.glyph_index = 6821},	/*Unicode: U+0077 (w)*/
+  {.w_px = 9,	.glyph_index = 6928},	/*Unicode: U+0078 (x)*/
+  {.w_px = 9,	.glyph_index = 7018},	/*Unicode: U+0079 (y)*/
+  {.w_px = 9,	.glyph_index = 7129},	/*Unicode: U+007a (z)*/
+  {.w_px = 8,	.glyph_index = 7187},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 7299},	/*Unicode: U+007c (|)*/
+  {.w_px = 8,	.glyph_index = 7303},	/*Unicode: U+007d (})*/
+  {.w_px = 9,	.glyph_index = 7416},	/*Unicode: U+007e (~)*/
 
 #endif
 };
@@ -9178,6 +2493,7 @@ lv_font_t pros_font_dejavu_mono_20 =
 #endif
     .monospace = 11,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO_20*/
@@ -12,12551 +12,2813 @@ static const uint8_t pros_font_dejavu_mono_30_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_30 == 1
   /*Unicode: U+0020 ( ) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xe3, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfc, 0x00, 0xf4, 0xe0, 0xfe, 0x00, 0xfe, 0xe0, 0xfb, 0x00,
 
   /*Unicode: U+0022 (") , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0xc6,  //%%...%%
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfc, 0x00, 0xfa, 0xc6, 0xef, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x01, 0x8c,  //.......%%...%%..
-  0x03, 0x0c,  //......%%....%%..
-  0x03, 0x18,  //......%%...%%...
-  0x03, 0x18,  //......%%...%%...
-  0x03, 0x18,  //......%%...%%...
-  0x3f, 0xff,  //..%%%%%%%%%%%%%%
-  0x3f, 0xff,  //..%%%%%%%%%%%%%%
-  0x06, 0x30,  //.....%%...%%....
-  0x06, 0x30,  //.....%%...%%....
-  0x0c, 0x30,  //....%%....%%....
-  0x0c, 0x60,  //....%%...%%.....
-  0xff, 0xfc,  //%%%%%%%%%%%%%%..
-  0xff, 0xfc,  //%%%%%%%%%%%%%%..
-  0x18, 0x60,  //...%%....%%.....
-  0x18, 0xc0,  //...%%...%%......
-  0x18, 0xc0,  //...%%...%%......
-  0x30, 0xc0,  //..%%....%%......
-  0x31, 0xc0,  //..%%...%%%......
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-
+  0xf5, 0x00, 0x23, 0x01, 0x8c, 0x03, 0x0c, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x3f, 0xff, 0x3f,
+  0xff, 0x06, 0x30, 0x06, 0x30, 0x0c, 0x30, 0x0c, 0x60, 0xff, 0xfc, 0xff, 0xfc, 0x18, 0x60, 0x18,
+  0xc0, 0x18, 0xc0, 0x30, 0xc0, 0x31, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x1f, 0x00,  //...%%%%%...
-  0x7f, 0xc0,  //.%%%%%%%%%.
-  0x74, 0x40,  //.%%%.%...%.
-  0xe4, 0x00,  //%%%..%.....
-  0xe4, 0x00,  //%%%..%.....
-  0xe4, 0x00,  //%%%..%.....
-  0xf4, 0x00,  //%%%%.%.....
-  0x7c, 0x00,  //.%%%%%.....
-  0x3f, 0x80,  //..%%%%%%%..
-  0x07, 0xc0,  //.....%%%%%.
-  0x05, 0xe0,  //.....%.%%%%
-  0x04, 0xe0,  //.....%..%%%
-  0x04, 0xe0,  //.....%..%%%
-  0x04, 0xe0,  //.....%..%%%
-  0xc5, 0xc0,  //%%...%.%%%.
-  0xff, 0xc0,  //%%%%%%%%%%.
-  0x3f, 0x00,  //..%%%%%%...
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x2e, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x7f, 0xc0, 0x74, 0x40, 0xe4,
+  0x00, 0xe4, 0x00, 0xe4, 0x00, 0xf4, 0x00, 0x7c, 0x00, 0x3f, 0x80, 0x07, 0xc0, 0x05, 0xe0, 0x04,
+  0xe0, 0x04, 0xe0, 0x04, 0xe0, 0xc5, 0xc0, 0xff, 0xc0, 0x3f, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+  0x00, 0x04, 0xfc, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x3c, 0x00,  //..%%%%.........
-  0x7e, 0x00,  //.%%%%%%........
-  0xe7, 0x00,  //%%%..%%%.......
-  0xc3, 0x00,  //%%....%%.......
-  0xc3, 0x00,  //%%....%%.......
-  0xe7, 0x00,  //%%%..%%%.......
-  0x7e, 0x0c,  //.%%%%%%.....%%.
-  0x3c, 0x38,  //..%%%%....%%%..
-  0x00, 0xe0,  //........%%%....
-  0x03, 0x80,  //......%%%......
-  0x0e, 0x00,  //....%%%........
-  0x38, 0x78,  //..%%%....%%%%..
-  0x60, 0xfc,  //.%%.....%%%%%%.
-  0x01, 0xce,  //.......%%%..%%%
-  0x01, 0x86,  //.......%%....%%
-  0x01, 0x86,  //.......%%....%%
-  0x01, 0xce,  //.......%%%..%%%
-  0x00, 0xfc,  //........%%%%%%.
-  0x00, 0x78,  //.........%%%%..
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0x3c, 0x00, 0x7e, 0x00, 0xe7, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xe7, 0x00, 0x7e,
+  0x0c, 0x3c, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x78, 0x60, 0xfc, 0x01, 0xce, 0x01,
+  0x86, 0x01, 0x86, 0x01, 0xce, 0x00, 0xfc, 0x00, 0x78, 0xf5, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x0f, 0x80,  //....%%%%%......
-  0x1f, 0xc0,  //...%%%%%%%.....
-  0x3c, 0x40,  //..%%%%...%.....
-  0x38, 0x00,  //..%%%..........
-  0x38, 0x00,  //..%%%..........
-  0x38, 0x00,  //..%%%..........
-  0x1c, 0x00,  //...%%%.........
-  0x1e, 0x00,  //...%%%%........
-  0x3e, 0x00,  //..%%%%%........
-  0x7f, 0x06,  //.%%%%%%%.....%%
-  0x67, 0x86,  //.%%..%%%%....%%
-  0xe3, 0xc6,  //%%%...%%%%...%%
-  0xe1, 0xc6,  //%%%....%%%...%%
-  0xe1, 0xec,  //%%%....%%%%.%%.
-  0xe0, 0xfc,  //%%%.....%%%%%%.
-  0x70, 0x78,  //.%%%.....%%%%..
-  0x78, 0x7c,  //.%%%%....%%%%%.
-  0x3f, 0xfc,  //..%%%%%%%%%%%%.
-  0x0f, 0x9e,  //....%%%%%..%%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0x0f, 0x80, 0x1f, 0xc0, 0x3c, 0x40, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1c,
+  0x00, 0x1e, 0x00, 0x3e, 0x00, 0x7f, 0x06, 0x67, 0x86, 0xe3, 0xc6, 0xe1, 0xc6, 0xe1, 0xec, 0xe0,
+  0xfc, 0x70, 0x78, 0x78, 0x7c, 0x3f, 0xfc, 0x0f, 0x9e, 0xf5, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xfa, 0xc0, 0xef, 0x00,
 
   /*Unicode: U+0028 (() , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x0c,  //....%%
-  0x18,  //...%%.
-  0x18,  //...%%.
-  0x30,  //..%%..
-  0x30,  //..%%..
-  0x70,  //.%%%..
-  0x70,  //.%%%..
-  0x60,  //.%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0x60,  //.%%...
-  0x70,  //.%%%..
-  0x70,  //.%%%..
-  0x30,  //..%%..
-  0x30,  //..%%..
-  0x18,  //...%%.
-  0x18,  //...%%.
-  0x0c,  //....%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfd, 0x00, 0x07, 0x0c, 0x18, 0x18, 0x30, 0x30, 0x70, 0x70, 0x60, 0xfa, 0xe0, 0x07, 0x60, 0x70,
+  0x70, 0x30, 0x30, 0x18, 0x18, 0x0c, 0xfe, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0xc0,  //%%....
-  0x60,  //.%%...
-  0x60,  //.%%...
-  0x30,  //..%%..
-  0x30,  //..%%..
-  0x38,  //..%%%.
-  0x38,  //..%%%.
-  0x18,  //...%%.
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x18,  //...%%.
-  0x38,  //..%%%.
-  0x38,  //..%%%.
-  0x30,  //..%%..
-  0x30,  //..%%..
-  0x60,  //.%%...
-  0x60,  //.%%...
-  0xc0,  //%%....
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfd, 0x00, 0x07, 0xc0, 0x60, 0x60, 0x30, 0x30, 0x38, 0x38, 0x18, 0xfa, 0x1c, 0x07, 0x18, 0x38,
+  0x38, 0x30, 0x30, 0x60, 0x60, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+002a (*) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x84, 0x20,  //%....%....%
-  0xe4, 0xe0,  //%%%..%..%%%
-  0x3f, 0x80,  //..%%%%%%%..
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x3f, 0x80,  //..%%%%%%%..
-  0xe4, 0xe0,  //%%%..%..%%%
-  0x84, 0x20,  //%....%....%
-  0x04, 0x00,  //.....%.....
-  0x04, 0x00,  //.....%.....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x16, 0x04, 0x00, 0x04, 0x00, 0x84, 0x20, 0xe4, 0xe0, 0x3f, 0x80, 0x0e, 0x00, 0x0e,
+  0x00, 0x3f, 0x80, 0xe4, 0xe0, 0x84, 0x20, 0x04, 0x00, 0x04, 0xe6, 0x00,
 
   /*Unicode: U+002b (+) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xef, 0x00, 0x1a, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff,
+  0xfc, 0xff, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xf2, 0x00,
 
   /*Unicode: U+002c (,) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x60,  //.%%.
-  0xe0,  //%%%.
-  0xc0,  //%%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xed, 0x00, 0xfd, 0x70, 0x02, 0x60, 0xe0, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+002d (-) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0xfe,  //%%%%%%%
-  0xfe,  //%%%%%%%
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xf1, 0x00, 0x01, 0xfe, 0xfe, 0xf5, 0x00,
 
   /*Unicode: U+002e (.) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xed, 0x00, 0xfd, 0xe0, 0xfb, 0x00,
 
   /*Unicode: U+002f (/) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x38,  //..........%%%
-  0x00, 0x70,  //.........%%%.
-  0x00, 0x70,  //.........%%%.
-  0x00, 0xe0,  //........%%%..
-  0x00, 0xe0,  //........%%%..
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x03, 0x80,  //......%%%....
-  0x03, 0x80,  //......%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x0e, 0x00,  //....%%%......
-  0x0e, 0x00,  //....%%%......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x38, 0x00,  //..%%%........
-  0x38, 0x00,  //..%%%........
-  0x70, 0x00,  //.%%%.........
-  0x70, 0x00,  //.%%%.........
-  0xe0, 0x00,  //%%%..........
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf6, 0x00, 0x27, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0,
+  0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xe0, 0xf8, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x0f, 0x00,  //....%%%%....
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x79, 0xc0,  //.%%%%..%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xee, 0x70,  //%%%.%%%..%%%
-  0xee, 0x70,  //%%%.%%%..%%%
-  0xee, 0x70,  //%%%.%%%..%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x79, 0xc0,  //.%%%%..%%%..
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x0f, 0x00,  //....%%%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0x0f, 0x00, 0x3f, 0xc0, 0x79, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xee, 0x70, 0xee, 0x70, 0xee, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70,
+  0xe0, 0x70, 0xe0, 0x79, 0xc0, 0x3f, 0xc0, 0x0f, 0xf4, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x3e, 0x00,  //..%%%%%....
-  0xfe, 0x00,  //%%%%%%%....
-  0xce, 0x00,  //%%..%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x25, 0x3e, 0x00, 0xfe, 0x00, 0xce, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x3f, 0x00,  //..%%%%%%.....
-  0xff, 0xc0,  //%%%%%%%%%%...
-  0xe1, 0xe0,  //%%%....%%%%..
-  0x80, 0xf0,  //%.......%%%%.
-  0x00, 0x70,  //.........%%%.
-  0x00, 0x70,  //.........%%%.
-  0x00, 0x70,  //.........%%%.
-  0x00, 0xf0,  //........%%%%.
-  0x00, 0xf0,  //........%%%%.
-  0x01, 0xe0,  //.......%%%%..
-  0x03, 0xc0,  //......%%%%...
-  0x07, 0x80,  //.....%%%%....
-  0x0f, 0x00,  //....%%%%.....
-  0x1e, 0x00,  //...%%%%......
-  0x3c, 0x00,  //..%%%%.......
-  0x78, 0x00,  //.%%%%........
-  0xe0, 0x00,  //%%%..........
-  0xff, 0xf0,  //%%%%%%%%%%%%.
-  0xff, 0xf0,  //%%%%%%%%%%%%.
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x25, 0x3f, 0x00, 0xff, 0xc0, 0xe1, 0xe0, 0x80, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c,
+  0x00, 0x78, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xc0,  //.%%%%%%%%%..
-  0x40, 0xe0,  //.%......%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x01, 0xe0,  //.......%%%%.
-  0x1f, 0x80,  //...%%%%%%...
-  0x1f, 0x80,  //...%%%%%%...
-  0x01, 0xe0,  //.......%%%%.
-  0x00, 0xf0,  //........%%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0xf0,  //........%%%%
-  0x81, 0xe0,  //%......%%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0x3f, 0x00,  //..%%%%%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0x1f, 0x80, 0x7f, 0xc0, 0x40, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x01, 0xe0, 0x1f, 0x80, 0x1f, 0x80, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0xf0, 0x81, 0xe0, 0xff, 0xc0, 0x3f, 0xf4, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x01, 0xc0,  //.......%%%...
-  0x03, 0xc0,  //......%%%%...
-  0x03, 0xc0,  //......%%%%...
-  0x07, 0xc0,  //.....%%%%%...
-  0x0d, 0xc0,  //....%%.%%%...
-  0x0d, 0xc0,  //....%%.%%%...
-  0x19, 0xc0,  //...%%..%%%...
-  0x19, 0xc0,  //...%%..%%%...
-  0x31, 0xc0,  //..%%...%%%...
-  0x61, 0xc0,  //.%%....%%%...
-  0x61, 0xc0,  //.%%....%%%...
-  0xc1, 0xc0,  //%%.....%%%...
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x25, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xc0, 0x0d, 0xc0, 0x0d, 0xc0, 0x19,
+  0xc0, 0x19, 0xc0, 0x31, 0xc0, 0x61, 0xc0, 0x61, 0xc0, 0xc1, 0xc0, 0xff, 0xf8, 0xff, 0xf8, 0x01,
+  0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0x7f, 0x80,  //.%%%%%%%%...
-  0x7f, 0xc0,  //.%%%%%%%%%..
-  0x41, 0xe0,  //.%.....%%%%.
-  0x00, 0xe0,  //........%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0xe0,  //........%%%.
-  0x81, 0xe0,  //%......%%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0x7f, 0x00,  //.%%%%%%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f,
+  0x80, 0x7f, 0xc0, 0x41, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x00, 0xe0, 0x81, 0xe0, 0xff, 0xc0, 0x7f, 0xf4, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x07, 0xc0,  //.....%%%%%..
-  0x1f, 0xe0,  //...%%%%%%%%.
-  0x3c, 0x20,  //..%%%%....%.
-  0x78, 0x00,  //.%%%%.......
-  0x70, 0x00,  //.%%%........
-  0xf0, 0x00,  //%%%%........
-  0xe0, 0x00,  //%%%.........
-  0xe7, 0x80,  //%%%..%%%%...
-  0xef, 0xe0,  //%%%.%%%%%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xf0, 0xf0,  //%%%%....%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x60, 0x70,  //.%%......%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0x07, 0xc0, 0x1f, 0xe0, 0x3c, 0x20, 0x78, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xe0,
+  0x00, 0xe7, 0x80, 0xef, 0xe0, 0xf0, 0xe0, 0xf0, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x60,
+  0x70, 0x70, 0xf0, 0x70, 0xe0, 0x3f, 0xc0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0xe0,  //........%%%.
-  0x00, 0xe0,  //........%%%.
-  0x00, 0xe0,  //........%%%.
-  0x01, 0xc0,  //.......%%%..
-  0x01, 0xc0,  //.......%%%..
-  0x03, 0xc0,  //......%%%%..
-  0x03, 0x80,  //......%%%...
-  0x03, 0x80,  //......%%%...
-  0x07, 0x00,  //.....%%%....
-  0x07, 0x00,  //.....%%%....
-  0x0f, 0x00,  //....%%%%....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x1e, 0x00,  //...%%%%.....
-  0x1c, 0x00,  //...%%%......
-  0x1c, 0x00,  //...%%%......
-  0x38, 0x00,  //..%%%.......
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01,
+  0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x38, 0xf4, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x60, 0x60,  //.%%......%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0x1f, 0x80, 0x7f, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0x70, 0xe0, 0x1f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x00,  //...%%%%%....
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xe0, 0x60,  //%%%......%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xf0, 0xf0,  //%%%%....%%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x1e, 0x70,  //...%%%%..%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0xf0,  //........%%%%
-  0x00, 0xe0,  //........%%%.
-  0x00, 0xe0,  //........%%%.
-  0x43, 0xc0,  //.%....%%%%..
-  0x7f, 0x80,  //.%%%%%%%%...
-  0x3e, 0x00,  //..%%%%%.....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0x1f, 0x00, 0x3f, 0xc0, 0x70, 0xe0, 0xf0, 0xe0, 0xe0, 0x60, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xf0, 0xf0, 0x70, 0xf0, 0x7f, 0x70, 0x1e, 0x70, 0x00, 0x70, 0x00, 0xf0, 0x00,
+  0xe0, 0x00, 0xe0, 0x43, 0xc0, 0x7f, 0x80, 0x3e, 0xf4, 0x00,
 
   /*Unicode: U+003a (:) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf6, 0x00, 0xfd, 0xe0, 0xfc, 0x00, 0xfd, 0xe0, 0xfb, 0x00,
 
   /*Unicode: U+003b (;) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x70,  //.%%%
-  0x60,  //.%%.
-  0xe0,  //%%%.
-  0xc0,  //%%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xf6, 0x00, 0xfd, 0x70, 0xfc, 0x00, 0xfd, 0x70, 0x02, 0x60, 0xe0, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+003c (<) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x08,  //............%
-  0x00, 0x78,  //.........%%%%
-  0x01, 0xf8,  //.......%%%%%%
-  0x07, 0xc0,  //.....%%%%%...
-  0x3f, 0x00,  //..%%%%%%.....
-  0xf8, 0x00,  //%%%%%........
-  0xe0, 0x00,  //%%%..........
-  0xf8, 0x00,  //%%%%%........
-  0x3f, 0x00,  //..%%%%%%.....
-  0x07, 0xc0,  //.....%%%%%...
-  0x01, 0xf8,  //.......%%%%%%
-  0x00, 0x78,  //.........%%%%
-  0x00, 0x08,  //............%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xee, 0x00, 0x18, 0x08, 0x00, 0x78, 0x01, 0xf8, 0x07, 0xc0, 0x3f, 0x00, 0xf8, 0x00, 0xe0, 0x00,
+  0xf8, 0x00, 0x3f, 0x00, 0x07, 0xc0, 0x01, 0xf8, 0x00, 0x78, 0x00, 0x08, 0xf1, 0x00,
 
   /*Unicode: U+003d (=) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xe9, 0x00, 0x03, 0xff, 0xf8, 0xff, 0xf8, 0xfb, 0x00, 0x03, 0xff, 0xf8, 0xff, 0xf8, 0xeb, 0x00,
 
   /*Unicode: U+003e (>) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x80, 0x00,  //%............
-  0xf0, 0x00,  //%%%%.........
-  0xfc, 0x00,  //%%%%%%.......
-  0x1f, 0x00,  //...%%%%%.....
-  0x07, 0xe0,  //.....%%%%%%..
-  0x00, 0xf8,  //........%%%%%
-  0x00, 0x38,  //..........%%%
-  0x00, 0xf8,  //........%%%%%
-  0x07, 0xe0,  //.....%%%%%%..
-  0x1f, 0x00,  //...%%%%%.....
-  0xfc, 0x00,  //%%%%%%.......
-  0xf0, 0x00,  //%%%%.........
-  0x80, 0x00,  //%............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xef, 0x00, 0x18, 0x80, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x1f, 0x00, 0x07, 0xe0, 0x00, 0xf8, 0x00,
+  0x38, 0x00, 0xf8, 0x07, 0xe0, 0x1f, 0x00, 0xfc, 0x00, 0xf0, 0x00, 0x80, 0xf0, 0x00,
 
   /*Unicode: U+003f (?) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x3e, 0x00,  //..%%%%%...
-  0x7f, 0x80,  //.%%%%%%%%.
-  0xc3, 0xc0,  //%%....%%%%
-  0x81, 0xc0,  //%......%%%
-  0x01, 0xc0,  //.......%%%
-  0x03, 0xc0,  //......%%%%
-  0x07, 0x80,  //.....%%%%.
-  0x0f, 0x00,  //....%%%%..
-  0x0e, 0x00,  //....%%%...
-  0x1e, 0x00,  //...%%%%...
-  0x1c, 0x00,  //...%%%....
-  0x1c, 0x00,  //...%%%....
-  0x1c, 0x00,  //...%%%....
-  0x1c, 0x00,  //...%%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x1c, 0x00,  //...%%%....
-  0x1c, 0x00,  //...%%%....
-  0x1c, 0x00,  //...%%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x1a, 0x3e, 0x00, 0x7f, 0x80, 0xc3, 0xc0, 0x81, 0xc0, 0x01, 0xc0, 0x03, 0xc0, 0x07,
+  0x80, 0x0f, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xfc, 0x00,
+  0x04, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xf4, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0xe0,  //......%%%%%....
-  0x0f, 0xf8,  //....%%%%%%%%%..
-  0x1c, 0x1c,  //...%%%.....%%%.
-  0x38, 0x0c,  //..%%%.......%%.
-  0x70, 0x06,  //.%%%.........%%
-  0x60, 0x06,  //.%%..........%%
-  0x60, 0xf6,  //.%%.....%%%%.%%
-  0xc3, 0xfe,  //%%....%%%%%%%%%
-  0xc3, 0x0e,  //%%....%%....%%%
-  0xc6, 0x06,  //%%...%%......%%
-  0xc6, 0x06,  //%%...%%......%%
-  0xc6, 0x06,  //%%...%%......%%
-  0xc6, 0x06,  //%%...%%......%%
-  0xc3, 0x0e,  //%%....%%....%%%
-  0xc3, 0xfe,  //%%....%%%%%%%%%
-  0x60, 0xf6,  //.%%.....%%%%.%%
-  0x60, 0x00,  //.%%............
-  0x30, 0x00,  //..%%...........
-  0x38, 0x00,  //..%%%..........
-  0x1e, 0x08,  //...%%%%.....%..
-  0x0f, 0xf8,  //....%%%%%%%%%..
-  0x01, 0xf8,  //.......%%%%%%..
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf5, 0x00, 0x2b, 0x03, 0xe0, 0x0f, 0xf8, 0x1c, 0x1c, 0x38, 0x0c, 0x70, 0x06, 0x60, 0x06, 0x60,
+  0xf6, 0xc3, 0xfe, 0xc3, 0x0e, 0xc6, 0x06, 0xc6, 0x06, 0xc6, 0x06, 0xc6, 0x06, 0xc3, 0x0e, 0xc3,
+  0xfe, 0x60, 0xf6, 0x60, 0x00, 0x30, 0x00, 0x38, 0x00, 0x1e, 0x08, 0x0f, 0xf8, 0x01, 0xf8, 0xfd,
+  0x00,
 
   /*Unicode: U+0041 (A) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e,
+  0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38, 0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78,
+  0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e, 0xf5, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0x00,  //%%%%%%%%....
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xe1, 0xc0,  //%%%....%%%..
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe1, 0xc0,  //%%%....%%%..
-  0xff, 0x80,  //%%%%%%%%%...
-  0xff, 0x80,  //%%%%%%%%%...
-  0xe1, 0xe0,  //%%%....%%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xff, 0x80,  //%%%%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x05, 0xff, 0x00, 0xff, 0xc0, 0xe1, 0xc0, 0xf9, 0xe0, 0x06, 0xe1, 0xc0, 0xff, 0x80,
+  0xff, 0x80, 0xe1, 0xfd, 0xe0, 0x0c, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0xff,
+  0xc0, 0xff, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x07, 0xe0,  //.....%%%%%%.
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x3c, 0x30,  //..%%%%....%%
-  0x78, 0x10,  //.%%%%......%
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0x78, 0x10,  //.%%%%......%
-  0x3c, 0x30,  //..%%%%....%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x07, 0xe0,  //.....%%%%%%.
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0x07, 0xe0, 0x1f, 0xf0, 0x3c, 0x30, 0x78, 0x10, 0x70, 0x00, 0x70, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x78, 0x10, 0x3c, 0x30, 0x1f, 0xf0, 0x07, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xfe, 0x00,  //%%%%%%%.....
-  0xff, 0x80,  //%%%%%%%%%...
-  0xe1, 0xc0,  //%%%....%%%..
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe1, 0xc0,  //%%%....%%%..
-  0xff, 0x80,  //%%%%%%%%%...
-  0xfe, 0x00,  //%%%%%%%.....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x05, 0xfe, 0x00, 0xff, 0x80, 0xe1, 0xc0, 0xfc, 0xe0, 0x10, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xfd, 0xe0, 0x04,
+  0xe1, 0xc0, 0xff, 0x80, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x07, 0xe0,  //.....%%%%%%..
-  0x1f, 0xf0,  //...%%%%%%%%%.
-  0x3c, 0x30,  //..%%%%....%%.
-  0x70, 0x10,  //.%%%.......%.
-  0x70, 0x00,  //.%%%.........
-  0x60, 0x00,  //.%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe1, 0xf8,  //%%%....%%%%%%
-  0xe1, 0xf8,  //%%%....%%%%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x60, 0x38,  //.%%.......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x3c, 0x78,  //..%%%%...%%%%
-  0x1f, 0xf8,  //...%%%%%%%%%%
-  0x07, 0xe0,  //.....%%%%%%..
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x25, 0x07, 0xe0, 0x1f, 0xf0, 0x3c, 0x30, 0x70, 0x10, 0x70, 0x00, 0x60, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe1, 0xf8, 0xe1, 0xf8, 0xe0, 0x38, 0xe0, 0x38, 0x60, 0x38, 0x70,
+  0x38, 0x70, 0x38, 0x3c, 0x78, 0x1f, 0xf8, 0x07, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x25, 0xff, 0xe0, 0xff, 0xe0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+004a (J) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1f, 0xe0,  //...%%%%%%%%
-  0x1f, 0xe0,  //...%%%%%%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x00, 0xe0,  //........%%%
-  0x80, 0xe0,  //%.......%%%
-  0xc1, 0xc0,  //%%.....%%%.
-  0xff, 0xc0,  //%%%%%%%%%%.
-  0x3f, 0x00,  //..%%%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x24, 0x1f, 0xe0, 0x1f, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+  0xe0, 0x80, 0xe0, 0xc1, 0xc0, 0xff, 0xc0, 0x3f, 0xf4, 0x00,
 
   /*Unicode: U+004b (K) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xe0, 0x1c,  //%%%........%%%.
-  0xe0, 0x38,  //%%%.......%%%..
-  0xe0, 0x70,  //%%%......%%%...
-  0xe0, 0xe0,  //%%%.....%%%....
-  0xe1, 0xc0,  //%%%....%%%.....
-  0xe3, 0x80,  //%%%...%%%......
-  0xe7, 0x00,  //%%%..%%%.......
-  0xee, 0x00,  //%%%.%%%........
-  0xfe, 0x00,  //%%%%%%%........
-  0xff, 0x00,  //%%%%%%%%.......
-  0xf7, 0x00,  //%%%%.%%%.......
-  0xe3, 0x80,  //%%%...%%%......
-  0xe3, 0xc0,  //%%%...%%%%.....
-  0xe1, 0xe0,  //%%%....%%%%....
-  0xe0, 0xe0,  //%%%.....%%%....
-  0xe0, 0xf0,  //%%%.....%%%%...
-  0xe0, 0x78,  //%%%......%%%%..
-  0xe0, 0x38,  //%%%.......%%%..
-  0xe0, 0x3c,  //%%%.......%%%%.
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x1a, 0xe0, 0x1c, 0xe0, 0x38, 0xe0, 0x70, 0xe0, 0xe0, 0xe1, 0xc0, 0xe3, 0x80, 0xe7,
+  0x00, 0xee, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xf7, 0x00, 0xe3, 0x80, 0xe3, 0xc0, 0xe1, 0xfd, 0xe0,
+  0x06, 0xf0, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x3c, 0xf5, 0x00,
 
   /*Unicode: U+004c (L) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+004d (M) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xf0, 0x78,  //%%%%.....%%%%
-  0xf0, 0x78,  //%%%%.....%%%%
-  0xf8, 0xf8,  //%%%%%...%%%%%
-  0xf8, 0xf8,  //%%%%%...%%%%%
-  0xf8, 0xf8,  //%%%%%...%%%%%
-  0xe8, 0xb8,  //%%%.%...%.%%%
-  0xed, 0xb8,  //%%%.%%.%%.%%%
-  0xed, 0xb8,  //%%%.%%.%%.%%%
-  0xe5, 0x38,  //%%%..%.%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x03, 0xf0, 0x78, 0xf0, 0x78, 0xfb, 0xf8, 0x1b, 0xe8, 0xb8, 0xed, 0xb8, 0xed, 0xb8,
+  0xe5, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+  0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xf5, 0x00,
 
   /*Unicode: U+004e (N) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xf0, 0x70,  //%%%%.....%%%
-  0xf0, 0x70,  //%%%%.....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0xf0, 0x70, 0xf0, 0x70, 0xf8, 0x70, 0xf8, 0x70, 0xf8, 0x70, 0xec, 0x70, 0xec,
+  0x70, 0xec, 0x70, 0xe6, 0x70, 0xe6, 0x70, 0xe6, 0x70, 0xe3, 0x70, 0xe3, 0x70, 0xe3, 0x70, 0xe1,
+  0xf0, 0xe1, 0xf0, 0xe1, 0xf0, 0xe0, 0xf0, 0xe0, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+004f (O) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0, 0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38,
+  0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70,
+  0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0x80,  //%%%%%%%%%...
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xe1, 0xe0,  //%%%....%%%%.
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xe1, 0xe0,  //%%%....%%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xff, 0x80,  //%%%%%%%%%...
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x24, 0xff, 0x80, 0xff, 0xc0, 0xe1, 0xe0, 0xe0, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0xf0, 0xe1, 0xe0, 0xff, 0xc0, 0xff, 0x80, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0xc0,  //....%%%%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x00, 0xf0,  //........%%%%.
-  0x00, 0x60,  //.........%%..
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0, 0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38,
+  0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70,
+  0x0b, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0x60, 0xfb, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0xff, 0x80,  //%%%%%%%%%.....
-  0xff, 0xc0,  //%%%%%%%%%%....
-  0xe1, 0xe0,  //%%%....%%%%...
-  0xe0, 0xf0,  //%%%.....%%%%..
-  0xe0, 0x70,  //%%%......%%%..
-  0xe0, 0x70,  //%%%......%%%..
-  0xe0, 0x70,  //%%%......%%%..
-  0xe0, 0x70,  //%%%......%%%..
-  0xe0, 0xe0,  //%%%.....%%%...
-  0xff, 0xc0,  //%%%%%%%%%%....
-  0xff, 0x80,  //%%%%%%%%%.....
-  0xe3, 0xc0,  //%%%...%%%%....
-  0xe1, 0xe0,  //%%%....%%%%...
-  0xe0, 0xe0,  //%%%.....%%%...
-  0xe0, 0xf0,  //%%%.....%%%%..
-  0xe0, 0x70,  //%%%......%%%..
-  0xe0, 0x78,  //%%%......%%%%.
-  0xe0, 0x38,  //%%%.......%%%.
-  0xe0, 0x3c,  //%%%.......%%%%
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xf7, 0x00, 0x18, 0xff, 0x80, 0xff, 0xc0, 0xe1, 0xe0, 0xe0, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0xe0, 0xff, 0xc0, 0xff, 0x80, 0xe3, 0xc0, 0xe1, 0xfd, 0xe0, 0x08, 0xf0,
+  0xe0, 0x70, 0xe0, 0x78, 0xe0, 0x38, 0xe0, 0x3c, 0xf5, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xe0,  //..%%%%%%%%%.
-  0x78, 0x60,  //.%%%%....%%.
-  0xf0, 0x20,  //%%%%......%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xf0, 0x00,  //%%%%........
-  0xfc, 0x00,  //%%%%%%......
-  0x7f, 0x80,  //.%%%%%%%%...
-  0x1f, 0xe0,  //...%%%%%%%%.
-  0x03, 0xe0,  //......%%%%%.
-  0x00, 0xf0,  //........%%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x80, 0x70,  //%........%%%
-  0xe1, 0xe0,  //%%%....%%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0x3f, 0x80,  //..%%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0x1f, 0x80, 0x3f, 0xe0, 0x78, 0x60, 0xf0, 0x20, 0xe0, 0x00, 0xe0, 0x00, 0xf0,
+  0x00, 0xfc, 0x00, 0x7f, 0x80, 0x1f, 0xe0, 0x03, 0xe0, 0x00, 0xf0, 0x00, 0x70, 0x00, 0x70, 0x00,
+  0x70, 0x80, 0x70, 0xe1, 0xe0, 0xff, 0xc0, 0x3f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xff, 0xfe,  //%%%%%%%%%%%%%%%
-  0xff, 0xfe,  //%%%%%%%%%%%%%%%
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0xff, 0xfe, 0xff, 0xfe, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0xe0, 0x1c,  //%%%........%%%
-  0xf0, 0x3c,  //%%%%......%%%%
-  0x70, 0x38,  //.%%%......%%%.
-  0x70, 0x38,  //.%%%......%%%.
-  0x70, 0x38,  //.%%%......%%%.
-  0x38, 0x70,  //..%%%....%%%..
-  0x38, 0x70,  //..%%%....%%%..
-  0x38, 0x70,  //..%%%....%%%..
-  0x3c, 0xf0,  //..%%%%..%%%%..
-  0x1c, 0xe0,  //...%%%..%%%...
-  0x1c, 0xe0,  //...%%%..%%%...
-  0x1c, 0xe0,  //...%%%..%%%...
-  0x0f, 0xc0,  //....%%%%%%....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x07, 0x80,  //.....%%%%.....
-  0x07, 0x80,  //.....%%%%.....
-  0x07, 0x80,  //.....%%%%.....
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xf7, 0x00, 0x25, 0xe0, 0x1c, 0xf0, 0x3c, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x38, 0x70, 0x38,
+  0x70, 0x38, 0x70, 0x3c, 0xf0, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0x0f, 0xc0, 0x0f, 0xc0, 0x0f,
+  0xc0, 0x0f, 0xc0, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0xe0, 0x07,  //%%%..........%%%
-  0xe0, 0x07,  //%%%..........%%%
-  0xe0, 0x07,  //%%%..........%%%
-  0x70, 0x0e,  //.%%%........%%%.
-  0x70, 0x0e,  //.%%%........%%%.
-  0x71, 0x8e,  //.%%%...%%...%%%.
-  0x73, 0xce,  //.%%%..%%%%..%%%.
-  0x73, 0xce,  //.%%%..%%%%..%%%.
-  0x73, 0xce,  //.%%%..%%%%..%%%.
-  0x73, 0xce,  //.%%%..%%%%..%%%.
-  0x3a, 0x5c,  //..%%%.%..%.%%%..
-  0x3e, 0x7c,  //..%%%%%..%%%%%..
-  0x3e, 0x7c,  //..%%%%%..%%%%%..
-  0x3e, 0x7c,  //..%%%%%..%%%%%..
-  0x3c, 0x3c,  //..%%%%....%%%%..
-  0x3c, 0x3c,  //..%%%%....%%%%..
-  0x1c, 0x38,  //...%%%....%%%...
-  0x1c, 0x38,  //...%%%....%%%...
-  0x18, 0x18,  //...%%......%%...
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-
+  0xf7, 0x00, 0x1b, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0x70, 0x0e, 0x70, 0x0e, 0x71, 0x8e, 0x73,
+  0xce, 0x73, 0xce, 0x73, 0xce, 0x73, 0xce, 0x3a, 0x5c, 0x3e, 0x7c, 0x3e, 0x7c, 0x3e, 0x7c, 0xfd,
+  0x3c, 0x05, 0x1c, 0x38, 0x1c, 0x38, 0x18, 0x18, 0xf5, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3c, 0x78,  //..%%%%...%%%%..
-  0x1e, 0xf0,  //...%%%%.%%%%...
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xc0,  //....%%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x1e, 0xf0,  //...%%%%.%%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x3c, 0x78,  //..%%%%...%%%%..
-  0x78, 0x38,  //.%%%%.....%%%..
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0xf0, 0x1e, 0x78, 0x3c, 0x38, 0x38, 0x3c, 0x78, 0x1e, 0xf0, 0x0f, 0xe0, 0x0f,
+  0xe0, 0x07, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x07, 0xc0, 0x0f, 0xc0, 0x0f, 0xe0, 0x1e, 0xf0, 0x1c,
+  0x70, 0x3c, 0x78, 0x78, 0x38, 0x70, 0x1c, 0xf0, 0x1e, 0xf5, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x38, 0x38,  //..%%%.....%%%..
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1e, 0xf0,  //...%%%%.%%%%...
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0xf0, 0x1e, 0x70, 0x1c, 0x78, 0x3c, 0x38, 0x38, 0x1c, 0x70, 0x1e, 0xf0, 0x0e,
+  0xe0, 0x0f, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x78,  //.........%%%%
-  0x00, 0x70,  //.........%%%.
-  0x00, 0xe0,  //........%%%..
-  0x01, 0xe0,  //.......%%%%..
-  0x01, 0xc0,  //.......%%%...
-  0x03, 0xc0,  //......%%%%...
-  0x07, 0x80,  //.....%%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x0f, 0x00,  //....%%%%.....
-  0x1e, 0x00,  //...%%%%......
-  0x1c, 0x00,  //...%%%.......
-  0x3c, 0x00,  //..%%%%.......
-  0x38, 0x00,  //..%%%........
-  0x78, 0x00,  //.%%%%........
-  0xf0, 0x00,  //%%%%.........
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x25, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x78, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xe0, 0x01,
+  0xc0, 0x03, 0xc0, 0x07, 0x80, 0x07, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x38,
+  0x00, 0x78, 0x00, 0xf0, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+005b ([) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0xfc,  //%%%%%%
-  0xfc,  //%%%%%%
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xe0,  //%%%...
-  0xfc,  //%%%%%%
-  0xfc,  //%%%%%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfd, 0x00, 0x01, 0xfc, 0xfc, 0xee, 0xe0, 0x01, 0xfc, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+005c (\) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x70, 0x00,  //.%%%.........
-  0x38, 0x00,  //..%%%........
-  0x38, 0x00,  //..%%%........
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x0e, 0x00,  //....%%%......
-  0x0e, 0x00,  //....%%%......
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x03, 0x80,  //......%%%....
-  0x03, 0x80,  //......%%%....
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0xc0,  //.......%%%...
-  0x00, 0xe0,  //........%%%..
-  0x00, 0xe0,  //........%%%..
-  0x00, 0x70,  //.........%%%.
-  0x00, 0x70,  //.........%%%.
-  0x00, 0x38,  //..........%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x29, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01,
+  0xc0, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0xf9, 0x00,
 
   /*Unicode: U+005d (]) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0xfc,  //%%%%%%
-  0xfc,  //%%%%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0x1c,  //...%%%
-  0xfc,  //%%%%%%
-  0xfc,  //%%%%%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfd, 0x00, 0x01, 0xfc, 0xfc, 0xee, 0x1c, 0x01, 0xfc, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+005e (^) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x07, 0x80,  //.....%%%%.....
-  0x07, 0x80,  //.....%%%%.....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x1c, 0xe0,  //...%%%..%%%...
-  0x38, 0x70,  //..%%%....%%%..
-  0x70, 0x38,  //.%%%......%%%.
-  0xe0, 0x1c,  //%%%........%%%
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xf7, 0x00, 0x0d, 0x07, 0x80, 0x07, 0x80, 0x0f, 0xc0, 0x1c, 0xe0, 0x38, 0x70, 0x70, 0x38, 0xe0,
+  0x1c, 0xdd, 0x00,
 
   /*Unicode: U+005f (_) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0xff, 0xff,  //%%%%%%%%%%%%%%%%
-  0xff, 0xff,  //%%%%%%%%%%%%%%%%
-
+  0xc9, 0x00, 0xfd, 0xff,
 
   /*Unicode: U+0060 (`) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0xe0,  //%%%...
-  0x70,  //.%%%..
-  0x30,  //..%%..
-  0x18,  //...%%.
-  0x0c,  //....%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfe, 0x00, 0x04, 0xe0, 0x70, 0x30, 0x18, 0x0c, 0xeb, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x1b, 0x1f, 0x80, 0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f,
+  0xf0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5,
+  0x00,
 
   /*Unicode: U+0062 (b) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe7, 0x80,  //%%%..%%%%...
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xf8, 0xe0,  //%%%%%...%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xe7, 0x80,  //%%%..%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x27, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe7,
+  0x80, 0xff, 0xc0, 0xf8, 0xe0, 0xf0, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xf0, 0xe0, 0xf0, 0xe0, 0xff, 0xc0, 0xe7, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x0f, 0x80,  //....%%%%%..
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x78, 0x60,  //.%%%%....%%
-  0x70, 0x00,  //.%%%.......
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0x70, 0x00,  //.%%%.......
-  0x78, 0x60,  //.%%%%....%%
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x0f, 0x80,  //....%%%%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xed, 0x00, 0x1b, 0x0f, 0x80, 0x3f, 0xc0, 0x78, 0x60, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x60, 0x3f, 0xc0, 0x0f, 0x80, 0xf5,
+  0x00,
 
   /*Unicode: U+0064 (d) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1e, 0x70,  //...%%%%..%%%
-  0x3f, 0xf0,  //..%%%%%%%%%%
-  0x71, 0xf0,  //.%%%...%%%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x71, 0xf0,  //.%%%...%%%%%
-  0x3f, 0xf0,  //..%%%%%%%%%%
-  0x1e, 0x70,  //...%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf8, 0x00, 0x26, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1e, 0x70,
+  0x3f, 0xf0, 0x71, 0xf0, 0x70, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0x70, 0xf0, 0x71, 0xf0, 0x3f, 0xf0, 0x1e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x78, 0x30,  //.%%%%.....%%.
-  0x3f, 0xf0,  //..%%%%%%%%%%.
-  0x0f, 0xc0,  //....%%%%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x1b, 0x0f, 0x80, 0x3f, 0xe0, 0x78, 0xf0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xff,
+  0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x30, 0x3f, 0xf0, 0x0f, 0xc0, 0xf5,
+  0x00,
 
   /*Unicode: U+0066 (f) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x03, 0xf0,  //......%%%%%%
-  0x07, 0xf0,  //.....%%%%%%%
-  0x0f, 0x00,  //....%%%%....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x26, 0x03, 0xf0, 0x07, 0xf0, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0xf4, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1e, 0x70,  //...%%%%..%%%
-  0x3f, 0x70,  //..%%%%%%.%%%
-  0x78, 0xf0,  //.%%%%...%%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x78, 0xf0,  //.%%%%...%%%%
-  0x3f, 0x70,  //..%%%%%%.%%%
-  0x1e, 0x70,  //...%%%%..%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x20, 0xe0,  //..%.....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x27, 0x1e, 0x70, 0x3f, 0x70, 0x78, 0xf0, 0x70, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xf0, 0x78, 0xf0, 0x3f, 0x70, 0x1e, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x20, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0x00, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe7, 0x80,  //%%%..%%%%..
-  0xef, 0xc0,  //%%%.%%%%%%.
-  0xf1, 0xe0,  //%%%%...%%%%
-  0xf0, 0xe0,  //%%%%....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x12, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe7,
+  0x80, 0xef, 0xc0, 0xf1, 0xe0, 0xf0, 0xec, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf9, 0x00, 0x04, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfa, 0x00, 0x1b, 0x7f, 0x00, 0x7f, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+006a (j) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x7f,  //.%%%%%%%
-  0x7f,  //.%%%%%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x07,  //.....%%%
-  0x0e,  //....%%%.
-  0xfe,  //%%%%%%%.
-  0xf8,  //%%%%%...
-  0x00,  //........
-
+  0xfd, 0x00, 0xfe, 0x07, 0xfe, 0x00, 0x01, 0x7f, 0x7f, 0xf3, 0x07, 0x03, 0x0e, 0xfe, 0xf8, 0x00,
 
   /*Unicode: U+006b (k) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0xf0,  //%%%.....%%%%.
-  0xe1, 0xe0,  //%%%....%%%%..
-  0xe3, 0xc0,  //%%%...%%%%...
-  0xe7, 0x80,  //%%%..%%%%....
-  0xef, 0x00,  //%%%.%%%%.....
-  0xfe, 0x00,  //%%%%%%%......
-  0xfe, 0x00,  //%%%%%%%......
-  0xff, 0x00,  //%%%%%%%%.....
-  0xff, 0x00,  //%%%%%%%%.....
-  0xf7, 0x80,  //%%%%.%%%%....
-  0xe3, 0xc0,  //%%%...%%%%...
-  0xe1, 0xc0,  //%%%....%%%...
-  0xe1, 0xe0,  //%%%....%%%%..
-  0xe0, 0xf0,  //%%%.....%%%%.
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf9, 0x00, 0x27, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0xf0, 0xe1, 0xe0, 0xe3, 0xc0, 0xe7, 0x80, 0xef, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff,
+  0x00, 0xf7, 0x80, 0xe3, 0xc0, 0xe1, 0xc0, 0xe1, 0xe0, 0xe0, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+006c (l) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0x00,  //%%%%%%%%.....
-  0xff, 0x00,  //%%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x03, 0x80,  //......%%%....
-  0x03, 0xf8,  //......%%%%%%%
-  0x00, 0xf8,  //........%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf9, 0x00, 0x27, 0xff, 0x00, 0xff, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0xf8, 0x00, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+006d (m) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xee, 0x70,  //%%%.%%%..%%%.
-  0xff, 0xf0,  //%%%%%%%%%%%%.
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0xe7, 0x38,  //%%%..%%%..%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x1b, 0xee, 0x70, 0xff, 0xf0, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7,
+  0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xe7, 0x38, 0xf5,
+  0x00,
 
   /*Unicode: U+006e (n) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe7, 0x80,  //%%%..%%%%..
-  0xef, 0xc0,  //%%%.%%%%%%.
-  0xf1, 0xe0,  //%%%%...%%%%
-  0xf0, 0xe0,  //%%%%....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xed, 0x00, 0x06, 0xe7, 0x80, 0xef, 0xc0, 0xf1, 0xe0, 0xf0, 0xec, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+006f (o) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x1b, 0x1f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5,
+  0x00,
 
   /*Unicode: U+0070 (p) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe7, 0x80,  //%%%..%%%%...
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xf8, 0xe0,  //%%%%%...%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xe7, 0x80,  //%%%..%%%%...
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x24, 0xe7, 0x80, 0xff, 0xc0, 0xf8, 0xe0, 0xf0, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xf0, 0xe0, 0xf0, 0xe0, 0xff, 0xc0, 0xe7, 0x80, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1e, 0x70,  //...%%%%..%%%
-  0x3f, 0xf0,  //..%%%%%%%%%%
-  0x71, 0xf0,  //.%%%...%%%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x70, 0xf0,  //.%%%....%%%%
-  0x3f, 0xf0,  //..%%%%%%%%%%
-  0x1e, 0x70,  //...%%%%..%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x27, 0x1e, 0x70, 0x3f, 0xf0, 0x71, 0xf0, 0x70, 0xf0, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xf0, 0x70, 0xf0, 0x3f, 0xf0, 0x1e, 0x70, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xe7, 0x80,  //%%%..%%%%.
-  0xef, 0xc0,  //%%%.%%%%%%
-  0xf8, 0x40,  //%%%%%....%
-  0xf0, 0x00,  //%%%%......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x00,  //%%%.......
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xed, 0x00, 0x1a, 0xe7, 0x80, 0xef, 0xc0, 0xf8, 0x40, 0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x3f, 0x00,  //..%%%%%%..
-  0x7f, 0x80,  //.%%%%%%%%.
-  0xf0, 0x80,  //%%%%....%.
-  0xe0, 0x00,  //%%%.......
-  0xf0, 0x00,  //%%%%......
-  0xfe, 0x00,  //%%%%%%%...
-  0x7f, 0x80,  //.%%%%%%%%.
-  0x1f, 0xc0,  //...%%%%%%%
-  0x03, 0xc0,  //......%%%%
-  0x01, 0xc0,  //.......%%%
-  0x01, 0xc0,  //.......%%%
-  0x83, 0xc0,  //%.....%%%%
-  0xff, 0x80,  //%%%%%%%%%.
-  0x3e, 0x00,  //..%%%%%...
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xed, 0x00, 0x1a, 0x3f, 0x00, 0x7f, 0x80, 0xf0, 0x80, 0xe0, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x7f,
+  0x80, 0x1f, 0xc0, 0x03, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x83, 0xc0, 0xff, 0x80, 0x3e, 0xf4, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0e, 0x00,  //....%%%.....
-  0x0f, 0x00,  //....%%%%....
-  0x07, 0xf0,  //.....%%%%%%%
-  0x03, 0xf0,  //......%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x23, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0f, 0x00, 0x07, 0xf0, 0x03, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe1, 0xe0,  //%%%....%%%%
-  0xf1, 0xe0,  //%%%%...%%%%
-  0x7e, 0xe0,  //.%%%%%%.%%%
-  0x3c, 0xe0,  //..%%%%..%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xed, 0x00, 0xed, 0xe0, 0x07, 0xe1, 0xe0, 0xf1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3d, 0xe0,  //..%%%%.%%%%..
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1f, 0xc0,  //...%%%%%%%...
-  0x0f, 0x80,  //....%%%%%....
-  0x0f, 0x80,  //....%%%%%....
-  0x0f, 0x80,  //....%%%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x01, 0xe0, 0x38, 0xfb, 0x70, 0x12, 0x38, 0xe0, 0x38, 0xe0, 0x3d, 0xe0, 0x1d, 0xc0,
+  0x1d, 0xc0, 0x1f, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x07, 0xf4, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0xe0, 0x07,  //%%%..........%%%
-  0xe0, 0x07,  //%%%..........%%%
-  0x70, 0x0e,  //.%%%........%%%.
-  0x70, 0x0e,  //.%%%........%%%.
-  0x71, 0x8e,  //.%%%...%%...%%%.
-  0x71, 0x8e,  //.%%%...%%...%%%.
-  0x3b, 0xdc,  //..%%%.%%%%.%%%..
-  0x3b, 0xdc,  //..%%%.%%%%.%%%..
-  0x3a, 0x5c,  //..%%%.%..%.%%%..
-  0x3e, 0x7c,  //..%%%%%..%%%%%..
-  0x1e, 0x78,  //...%%%%..%%%%...
-  0x1c, 0x38,  //...%%%....%%%...
-  0x1c, 0x38,  //...%%%....%%%...
-  0x1c, 0x38,  //...%%%....%%%...
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-
+  0xed, 0x00, 0x1b, 0xe0, 0x07, 0xe0, 0x07, 0x70, 0x0e, 0x70, 0x0e, 0x71, 0x8e, 0x71, 0x8e, 0x3b,
+  0xdc, 0x3b, 0xdc, 0x3a, 0x5c, 0x3e, 0x7c, 0x1e, 0x78, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0xf5,
+  0x00,
 
   /*Unicode: U+0078 (x) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x78, 0x78,  //.%%%%....%%%%.
-  0x3c, 0xf0,  //..%%%%..%%%%..
-  0x1c, 0xe0,  //...%%%..%%%...
-  0x0f, 0xc0,  //....%%%%%%....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x07, 0x80,  //.....%%%%.....
-  0x03, 0x00,  //......%%......
-  0x07, 0x80,  //.....%%%%.....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x0f, 0xc0,  //....%%%%%%....
-  0x1f, 0xe0,  //...%%%%%%%%...
-  0x3c, 0xf0,  //..%%%%..%%%%..
-  0x78, 0x78,  //.%%%%....%%%%.
-  0xf0, 0x3c,  //%%%%......%%%%
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xed, 0x00, 0x1b, 0x78, 0x78, 0x3c, 0xf0, 0x1c, 0xe0, 0x0f, 0xc0, 0x0f, 0xc0, 0x07, 0x80, 0x03,
+  0x00, 0x07, 0x80, 0x0f, 0xc0, 0x0f, 0xc0, 0x1f, 0xe0, 0x3c, 0xf0, 0x78, 0x78, 0xf0, 0x3c, 0xf5,
+  0x00,
 
   /*Unicode: U+0079 (y) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1f, 0xc0,  //...%%%%%%%...
-  0x0f, 0x80,  //....%%%%%....
-  0x0f, 0x80,  //....%%%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x0e, 0x00,  //....%%%......
-  0x0e, 0x00,  //....%%%......
-  0x1e, 0x00,  //...%%%%......
-  0x7c, 0x00,  //.%%%%%.......
-  0x78, 0x00,  //.%%%%........
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x01, 0xe0, 0x38, 0xfd, 0x70, 0x1e, 0x78, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0,
+  0x1d, 0xc0, 0x1f, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x1e, 0x00, 0x7c, 0x00, 0x78, 0xfe, 0x00,
 
   /*Unicode: U+007a (z) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x01, 0xe0,  //.......%%%%
-  0x03, 0xc0,  //......%%%%.
-  0x07, 0x80,  //.....%%%%..
-  0x07, 0x00,  //.....%%%...
-  0x0f, 0x00,  //....%%%%...
-  0x1e, 0x00,  //...%%%%....
-  0x3c, 0x00,  //..%%%%.....
-  0x38, 0x00,  //..%%%......
-  0x78, 0x00,  //.%%%%......
-  0xf0, 0x00,  //%%%%.......
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xed, 0x00, 0x1b, 0xff, 0xe0, 0xff, 0xe0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x07, 0x00, 0x0f,
+  0x00, 0x1e, 0x00, 0x3c, 0x00, 0x38, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf5,
+  0x00,
 
   /*Unicode: U+007b ({) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x03, 0xe0,  //......%%%%%
-  0x07, 0xe0,  //.....%%%%%%
-  0x0f, 0x00,  //....%%%%...
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x1c, 0x00,  //...%%%.....
-  0xf8, 0x00,  //%%%%%......
-  0xf8, 0x00,  //%%%%%......
-  0x1c, 0x00,  //...%%%.....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0f, 0x00,  //....%%%%...
-  0x07, 0xe0,  //.....%%%%%%
-  0x03, 0xe0,  //......%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x2f, 0x03, 0xe0, 0x07, 0xe0, 0x0f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x1c, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x07,
+  0xe0, 0x03, 0xe0, 0xfd, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-
+  0xfd, 0x00, 0xe7, 0xc0,
 
   /*Unicode: U+007d (}) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xf8, 0x00,  //%%%%%......
-  0xfc, 0x00,  //%%%%%%.....
-  0x1e, 0x00,  //...%%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x07, 0x00,  //.....%%%...
-  0x03, 0xe0,  //......%%%%%
-  0x03, 0xe0,  //......%%%%%
-  0x07, 0x00,  //.....%%%...
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x1e, 0x00,  //...%%%%....
-  0xfc, 0x00,  //%%%%%%.....
-  0xf8, 0x00,  //%%%%%......
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x2e, 0xf8, 0x00, 0xfc, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0xe0, 0x03, 0xe0, 0x07, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0xfc,
+  0x00, 0xf8, 0xfc, 0x00,
 
   /*Unicode: U+007e (~) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x3c, 0x00,  //..%%%%.......
-  0xff, 0x18,  //%%%%%%%%...%%
-  0xc3, 0xf8,  //%%....%%%%%%%
-  0x00, 0xe0,  //........%%%..
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
-
+  0xe5, 0x00, 0x07, 0x3c, 0x00, 0xff, 0x18, 0xc3, 0xf8, 0x00, 0xe0, 0xe9, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 2
   /*Unicode: U+0020 ( ) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xc5, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xb8,  //%@%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfc, 0x00, 0xf5, 0xfc, 0x00, 0xb8, 0xfe, 0x00, 0xfe, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+0022 (") , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0xf0, 0x3c,  //@@...@@
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xf7, 0x00, 0x0d, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+  0x3c, 0xdd, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x07, 0xc0, 0xf0,  //......+@@...@@..
-  0x00, 0x0b, 0x41, 0xf0,  //......%@+..+@@..
-  0x00, 0x0f, 0x02, 0xd0,  //......@@...%@+..
-  0x00, 0x0f, 0x03, 0xc0,  //......@@...@@...
-  0x00, 0x1e, 0x03, 0xc0,  //.....+@%...@@...
-  0x1f, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x1f, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x00, 0x3c, 0x0f, 0x00,  //.....@@...@@....
-  0x00, 0x78, 0x0f, 0x00,  //....+@%...@@....
-  0x00, 0xb4, 0x1e, 0x00,  //....%@+..+@%....
-  0x00, 0xf0, 0x2d, 0x00,  //....@@...%@+....
-  0xff, 0xff, 0xff, 0xf4,  //@@@@@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xf4,  //@@@@@@@@@@@@@@+.
-  0x03, 0xd0, 0x78, 0x00,  //...@@+..+@%.....
-  0x03, 0xc0, 0xf4, 0x00,  //...@@...@@+.....
-  0x07, 0xc0, 0xf0, 0x00,  //..+@@...@@......
-  0x0b, 0x41, 0xf0, 0x00,  //..%@+..+@@......
-  0x0f, 0x02, 0xe0, 0x00,  //..@@...%@%......
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-
+  0xe8, 0x00, 0x13, 0x07, 0xc0, 0xf0, 0x00, 0x0b, 0x41, 0xf0, 0x00, 0x0f, 0x02, 0xd0, 0x00, 0x0f,
+  0x03, 0xc0, 0x00, 0x1e, 0x03, 0xc0, 0x1f, 0xfe, 0xff, 0x00, 0x1f, 0xfe, 0xff, 0x0f, 0x00, 0x3c,
+  0x0f, 0x00, 0x00, 0x78, 0x0f, 0x00, 0x00, 0xb4, 0x1e, 0x00, 0x00, 0xf0, 0x2d, 0x00, 0xfe, 0xff,
+  0x00, 0xf4, 0xfe, 0xff, 0x13, 0xf4, 0x03, 0xd0, 0x78, 0x00, 0x03, 0xc0, 0xf4, 0x00, 0x07, 0xc0,
+  0xf0, 0x00, 0x0b, 0x41, 0xf0, 0x00, 0x0f, 0x02, 0xe0, 0xe8, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x06, 0xfe, 0x40,  //..+%@@@%+..
-  0x2f, 0xff, 0xf0,  //.%@@@@@@@@.
-  0x7f, 0x30, 0x70,  //+@@@.@..+@.
-  0xfc, 0x30, 0x00,  //@@@..@.....
-  0xfc, 0x30, 0x00,  //@@@..@.....
-  0xfc, 0x30, 0x00,  //@@@..@.....
-  0xbe, 0x30, 0x00,  //%@@%.@.....
-  0x3f, 0xf4, 0x00,  //.@@@@@+....
-  0x0f, 0xff, 0x80,  //..@@@@@@%..
-  0x00, 0x7f, 0xf0,  //....+@@@@@.
-  0x00, 0x32, 0xf8,  //.....@.%@@%
-  0x00, 0x30, 0xfc,  //.....@..@@@
-  0x00, 0x30, 0xfc,  //.....@..@@@
-  0x00, 0x30, 0xfc,  //.....@..@@@
-  0xe0, 0x33, 0xf4,  //@%...@.@@@+
-  0xff, 0xff, 0xe0,  //@@@@@@@@@%.
-  0x1b, 0xfe, 0x40,  //.+%@@@@%+..
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf4, 0x00, 0x45, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x06, 0xfe, 0x40, 0x2f, 0xff,
+  0xf0, 0x7f, 0x30, 0x70, 0xfc, 0x30, 0x00, 0xfc, 0x30, 0x00, 0xfc, 0x30, 0x00, 0xbe, 0x30, 0x00,
+  0x3f, 0xf4, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x7f, 0xf0, 0x00, 0x32, 0xf8, 0x00, 0x30, 0xfc, 0x00,
+  0x30, 0xfc, 0x00, 0x30, 0xfc, 0xe0, 0x33, 0xf4, 0xff, 0xff, 0xe0, 0x1b, 0xfe, 0x40, 0x00, 0x30,
+  0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0xfa, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x0b, 0xe0, 0x00, 0x00,  //..%@@%.........
-  0x3f, 0xfc, 0x00, 0x00,  //.@@@@@@........
-  0xb8, 0x2e, 0x00, 0x00,  //%@%..%@%.......
-  0xf0, 0x0f, 0x00, 0x00,  //@@....@@.......
-  0xf0, 0x0f, 0x00, 0x00,  //@@....@@.......
-  0xb8, 0x2e, 0x00, 0x10,  //%@%..%@%.....+.
-  0x3f, 0xfc, 0x01, 0xf4,  //.@@@@@@....+@@+
-  0x0b, 0xe0, 0x1f, 0x80,  //..%@@%...+@@%..
-  0x00, 0x01, 0xf8, 0x00,  //.......+@@%....
-  0x00, 0x0f, 0x80, 0x00,  //......@@%......
-  0x00, 0xbd, 0x00, 0x00,  //....%@@+.......
-  0x0b, 0xd0, 0x2f, 0x80,  //..%@@+...%@@%..
-  0x3d, 0x00, 0xff, 0xf0,  //.@@+....@@@@@@.
-  0x00, 0x02, 0xe0, 0xb8,  //.......%@%..%@%
-  0x00, 0x03, 0xc0, 0x3c,  //.......@@....@@
-  0x00, 0x03, 0xc0, 0x3c,  //.......@@....@@
-  0x00, 0x02, 0xe0, 0xb8,  //.......%@%..%@%
-  0x00, 0x00, 0xff, 0xf0,  //........@@@@@@.
-  0x00, 0x00, 0x2f, 0x80,  //.........%@@%..
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x4b, 0x0b, 0xe0, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xb8, 0x2e, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xb8, 0x2e, 0x00, 0x10, 0x3f, 0xfc, 0x01, 0xf4, 0x0b,
+  0xe0, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x0b,
+  0xd0, 0x2f, 0x80, 0x3d, 0x00, 0xff, 0xf0, 0x00, 0x02, 0xe0, 0xb8, 0x00, 0x03, 0xc0, 0x3c, 0x00,
+  0x03, 0xc0, 0x3c, 0x00, 0x02, 0xe0, 0xb8, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0x80, 0xe9,
+  0x00,
 
   /*Unicode: U+0026 (&) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0xbf, 0x80, 0x00,  //....%@@@%......
-  0x03, 0xff, 0xf0, 0x00,  //...@@@@@@@.....
-  0x0b, 0xe0, 0x20, 0x00,  //..%@@%...%.....
-  0x0f, 0xc0, 0x00, 0x00,  //..@@@..........
-  0x0f, 0xc0, 0x00, 0x00,  //..@@@..........
-  0x0b, 0xd0, 0x00, 0x00,  //..%@@+.........
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.........
-  0x02, 0xf8, 0x00, 0x00,  //...%@@%........
-  0x0f, 0xfd, 0x00, 0x00,  //..@@@@@+.......
-  0x2f, 0xbf, 0x00, 0x3c,  //.%@@%@@@.....@@
-  0x7c, 0x3f, 0xc0, 0x3c,  //+@@..@@@@....@@
-  0xbc, 0x0f, 0xe0, 0x3c,  //%@@...@@@%...@@
-  0xfc, 0x07, 0xf4, 0x78,  //@@@...+@@@+.+@%
-  0xfc, 0x02, 0xfc, 0xf4,  //@@@....%@@@.@@+
-  0xfd, 0x00, 0xff, 0xf0,  //@@@+....@@@@@@.
-  0x7f, 0x00, 0x3f, 0xd0,  //+@@@.....@@@@+.
-  0x3f, 0xd0, 0x7f, 0xe0,  //.@@@@+..+@@@@%.
-  0x0f, 0xff, 0xfb, 0xf0,  //..@@@@@@@@%@@@.
-  0x01, 0xff, 0x82, 0xf8,  //...+@@@@%..%@@%
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xec, 0x00, 0x4a, 0xbf, 0x80, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x0b, 0xe0, 0x20, 0x00, 0x0f, 0xc0,
+  0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x02, 0xf8,
+  0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x2f, 0xbf, 0x00, 0x3c, 0x7c, 0x3f, 0xc0, 0x3c, 0xbc, 0x0f,
+  0xe0, 0x3c, 0xfc, 0x07, 0xf4, 0x78, 0xfc, 0x02, 0xfc, 0xf4, 0xfd, 0x00, 0xff, 0xf0, 0x7f, 0x00,
+  0x3f, 0xd0, 0x3f, 0xd0, 0x7f, 0xe0, 0x0f, 0xff, 0xfb, 0xf0, 0x01, 0xff, 0x82, 0xf8, 0xe9, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xfa, 0xf0, 0xef, 0x00,
 
   /*Unicode: U+0028 (() , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0xf0,  //....@@
-  0x03, 0xd0,  //...@@+
-  0x07, 0xc0,  //..+@@.
-  0x0f, 0x40,  //..@@+.
-  0x1f, 0x00,  //.+@@..
-  0x3f, 0x00,  //.@@@..
-  0x3e, 0x00,  //.@@%..
-  0x7d, 0x00,  //+@@+..
-  0xbc, 0x00,  //%@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xbc, 0x00,  //%@@...
-  0x7d, 0x00,  //+@@+..
-  0x3e, 0x00,  //.@@%..
-  0x3f, 0x00,  //.@@@..
-  0x1f, 0x00,  //.+@@..
-  0x0f, 0x40,  //..@@+.
-  0x07, 0xc0,  //..+@@.
-  0x03, 0xd0,  //...@@+
-  0x00, 0xf0,  //....@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xf8, 0x00, 0x2c, 0xf0, 0x03, 0xd0, 0x07, 0xc0, 0x0f, 0x40, 0x1f, 0x00, 0x3f, 0x00, 0x3e, 0x00,
+  0x7d, 0x00, 0xbc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xbc, 0x00,
+  0x7d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x0f, 0x40, 0x07, 0xc0, 0x03, 0xd0, 0x00, 0xf0,
+  0xfb, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xf0, 0x00,  //@@....
-  0x7c, 0x00,  //+@@...
-  0x3d, 0x00,  //.@@+..
-  0x1f, 0x00,  //.+@@..
-  0x0f, 0x40,  //..@@+.
-  0x0f, 0xc0,  //..@@@.
-  0x0b, 0xc0,  //..%@@.
-  0x07, 0xd0,  //..+@@+
-  0x03, 0xe0,  //...@@%
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xe0,  //...@@%
-  0x07, 0xd0,  //..+@@+
-  0x0b, 0xc0,  //..%@@.
-  0x0f, 0xc0,  //..@@@.
-  0x0f, 0x40,  //..@@+.
-  0x1f, 0x00,  //.+@@..
-  0x3d, 0x00,  //.@@+..
-  0x7c, 0x00,  //+@@...
-  0xf0, 0x00,  //@@....
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xf9, 0x00, 0x2c, 0xf0, 0x00, 0x7c, 0x00, 0x3d, 0x00, 0x1f, 0x00, 0x0f, 0x40, 0x0f, 0xc0, 0x0b,
+  0xc0, 0x07, 0xd0, 0x03, 0xe0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03,
+  0xe0, 0x07, 0xd0, 0x0b, 0xc0, 0x0f, 0xc0, 0x0f, 0x40, 0x1f, 0x00, 0x3d, 0x00, 0x7c, 0x00, 0xf0,
+  0xfa, 0x00,
 
   /*Unicode: U+002a (*) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x90, 0x30, 0x18,  //%+...@...+%
-  0xbc, 0x30, 0xf8,  //%@@..@..@@%
-  0x0f, 0xbb, 0xc0,  //..@@%@%@@..
-  0x01, 0xfd, 0x00,  //...+@@@+...
-  0x01, 0xfd, 0x00,  //...+@@@+...
-  0x0f, 0xbb, 0xc0,  //..@@%@%@@..
-  0xbc, 0x30, 0xf8,  //%@@..@..@@%
-  0x90, 0x30, 0x18,  //%+...@...+%
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x30, 0x00,  //.....@.....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf1, 0x00, 0x21, 0x30, 0x00, 0x00, 0x30, 0x00, 0x90, 0x30, 0x18, 0xbc, 0x30, 0xf8, 0x0f, 0xbb,
+  0xc0, 0x01, 0xfd, 0x00, 0x01, 0xfd, 0x00, 0x0f, 0xbb, 0xc0, 0xbc, 0x30, 0xf8, 0x90, 0x30, 0x18,
+  0x00, 0x30, 0x00, 0x00, 0x30, 0xd9, 0x00,
 
   /*Unicode: U+002b (+) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xdc, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x02, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff,
+  0x02, 0xf0, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xe3, 0x00,
 
   /*Unicode: U+002c (,) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3e,  //.@@%
-  0x7c,  //+@@.
-  0xb8,  //%@%.
-  0xf0,  //@@..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xed, 0x00, 0xfe, 0x3f, 0x03, 0x3e, 0x7c, 0xb8, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+002d (-) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0xff, 0xfc,  //@@@@@@@
-  0xff, 0xfc,  //@@@@@@@
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xe1, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+002e (.) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xed, 0x00, 0xfd, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+002f (/) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x0f, 0xc0,  //..........@@@
-  0x00, 0x00, 0x2f, 0x40,  //.........%@@+
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@.
-  0x00, 0x00, 0xbd, 0x00,  //........%@@+.
-  0x00, 0x00, 0xfc, 0x00,  //........@@@..
-  0x00, 0x02, 0xf4, 0x00,  //.......%@@+..
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x0b, 0xd0, 0x00,  //......%@@+...
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@....
-  0x00, 0x2f, 0x40, 0x00,  //.....%@@+....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x7e, 0x00, 0x00,  //....+@@%.....
-  0x00, 0xfc, 0x00, 0x00,  //....@@@......
-  0x01, 0xf8, 0x00, 0x00,  //...+@@%......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x07, 0xe0, 0x00, 0x00,  //..+@@%.......
-  0x0f, 0xc0, 0x00, 0x00,  //..@@@........
-  0x1f, 0x80, 0x00, 0x00,  //.+@@%........
-  0x3f, 0x00, 0x00, 0x00,  //.@@@.........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xeb, 0x00, 0x08, 0x0f, 0xc0, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0xbd,
+  0xfe, 0x00, 0x17, 0xfc, 0x00, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0b, 0xd0,
+  0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7e, 0xfe,
+  0x00, 0x17, 0xfc, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x07, 0xe0, 0x00,
+  0x00, 0x0f, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00,
+  0x00, 0xfc, 0xee, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x01, 0xff, 0x40,  //...+@@@@+...
-  0x0b, 0xff, 0xe0,  //..%@@@@@@%..
-  0x2f, 0x82, 0xf4,  //.%@@%..%@@+.
-  0x3f, 0x00, 0xfc,  //.@@@....@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0xb8, 0x3f,  //@@@.%@%..@@@
-  0xfc, 0xfc, 0x3f,  //@@@.@@@..@@@
-  0xfc, 0xb8, 0x3f,  //@@@.%@%..@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x00, 0xfc,  //.@@@....@@@.
-  0x2f, 0x82, 0xf4,  //.%@@%..%@@+.
-  0x0b, 0xff, 0xe0,  //..%@@@@@@%..
-  0x01, 0xff, 0x40,  //...+@@@@+...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0x01, 0xff, 0x40, 0x0b, 0xff, 0xe0, 0x2f, 0x82, 0xf4, 0x3f, 0x00, 0xfc, 0x7e,
+  0x00, 0xbd, 0xbd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0xb8, 0x3f, 0xfc, 0xfc,
+  0x3f, 0xfc, 0xb8, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x7e, 0x00, 0xbd,
+  0x3f, 0x00, 0xfc, 0x2f, 0x82, 0xf4, 0x0b, 0xff, 0xe0, 0x01, 0xff, 0x40, 0xef, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x1b, 0xfc, 0x00,  //.+%@@@@....
-  0xff, 0xfc, 0x00,  //@@@@@@@....
-  0xe4, 0xfc, 0x00,  //@%+.@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf2, 0x00, 0x38, 0x1b, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xe4, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x1b, 0xff, 0x40, 0x00,  //.+%@@@@@+....
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@@@@@@...
-  0xf9, 0x02, 0xfc, 0x00,  //@@%+...%@@@..
-  0x80, 0x00, 0xbe, 0x00,  //%.......%@@%.
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@.
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@.
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@.
-  0x00, 0x00, 0xbf, 0x00,  //........%@@@.
-  0x00, 0x00, 0xfe, 0x00,  //........@@@%.
-  0x00, 0x03, 0xfc, 0x00,  //.......@@@@..
-  0x00, 0x0b, 0xf4, 0x00,  //......%@@@+..
-  0x00, 0x2f, 0xd0, 0x00,  //.....%@@@+...
-  0x00, 0xbf, 0x40, 0x00,  //....%@@@+....
-  0x02, 0xfd, 0x00, 0x00,  //...%@@@+.....
-  0x0b, 0xf4, 0x00, 0x00,  //..%@@@+......
-  0x2f, 0xc0, 0x00, 0x00,  //.%@@@........
-  0xbd, 0x00, 0x00, 0x00,  //%@@+.........
-  0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x0e, 0x1b, 0xff, 0x40, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf9, 0x02, 0xfc, 0x00, 0x80,
+  0x00, 0xbe, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0xbf, 0xfe, 0x00, 0x1e, 0xfe, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00,
+  0x2f, 0xd0, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0x2f,
+  0xc0, 0x00, 0x00, 0xbd, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xe8, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x80,  //..+%@@@@%...
-  0x3f, 0xff, 0xf4,  //.@@@@@@@@@+.
-  0x34, 0x01, 0xfd,  //.@+....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x7e,  //........+@@%
-  0x00, 0x02, 0xfc,  //.......%@@@.
-  0x03, 0xff, 0xd0,  //...@@@@@@+..
-  0x03, 0xff, 0xd0,  //...@@@@@@+..
-  0x00, 0x02, 0xf8,  //.......%@@%.
-  0x00, 0x00, 0xbe,  //........%@@%
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0xbe,  //........%@@%
-  0xd0, 0x02, 0xfc,  //@+.....%@@@.
-  0xff, 0xff, 0xf4,  //@@@@@@@@@@+.
-  0x1b, 0xff, 0x40,  //.+%@@@@@+...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0x06, 0xff, 0x80, 0x3f, 0xff, 0xf4, 0x34, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x00, 0x02, 0xfc, 0x03, 0xff, 0xd0, 0x03, 0xff,
+  0xd0, 0x00, 0x02, 0xf8, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0xbe, 0xd0, 0x02, 0xfc, 0xff, 0xff, 0xf4, 0x1b, 0xff, 0x40, 0xef, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x0b, 0xf0, 0x00,  //......%@@@...
-  0x00, 0x1f, 0xf0, 0x00,  //.....+@@@@...
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@...
-  0x00, 0xb7, 0xf0, 0x00,  //....%@+@@@...
-  0x00, 0xf3, 0xf0, 0x00,  //....@@.@@@...
-  0x03, 0xc3, 0xf0, 0x00,  //...@@..@@@...
-  0x07, 0x83, 0xf0, 0x00,  //..+@%..@@@...
-  0x0f, 0x03, 0xf0, 0x00,  //..@@...@@@...
-  0x2d, 0x03, 0xf0, 0x00,  //.%@+...@@@...
-  0x7c, 0x03, 0xf0, 0x00,  //+@@....@@@...
-  0xf4, 0x03, 0xf0, 0x00,  //@@+....@@@...
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xec, 0x00, 0x2e, 0x03, 0xf0, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x3f,
+  0xf0, 0x00, 0x00, 0xb7, 0xf0, 0x00, 0x00, 0xf3, 0xf0, 0x00, 0x03, 0xc3, 0xf0, 0x00, 0x07, 0x83,
+  0xf0, 0x00, 0x0f, 0x03, 0xf0, 0x00, 0x2d, 0x03, 0xf0, 0x00, 0x7c, 0x03, 0xf0, 0x00, 0xf4, 0x03,
+  0xf0, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x13, 0xc0, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0xe8, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x3f, 0xff, 0xfc,  //.@@@@@@@@@@.
-  0x3f, 0xff, 0xfc,  //.@@@@@@@@@@.
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x3f, 0xff, 0x80,  //.@@@@@@@%...
-  0x3f, 0xff, 0xf0,  //.@@@@@@@@@..
-  0x24, 0x07, 0xfc,  //.%+...+@@@@.
-  0x00, 0x00, 0xfd,  //........@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x7e,  //........+@@%
-  0x00, 0x00, 0xfd,  //........@@@+
-  0xd0, 0x07, 0xfc,  //@+....+@@@@.
-  0xff, 0xff, 0xe0,  //@@@@@@@@@%..
-  0x2f, 0xfe, 0x40,  //.%@@@@@%+...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xf0, 0x24, 0x07, 0xfc, 0x00, 0x00,
+  0xfd, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0xfd, 0xd0, 0x07, 0xfc, 0xff, 0xff, 0xe0, 0x2f, 0xfe, 0x40, 0xef, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x7f, 0xe0,  //....+@@@@%..
-  0x07, 0xff, 0xfc,  //..+@@@@@@@@.
-  0x0f, 0xe0, 0x1c,  //..@@@%...+@.
-  0x3f, 0x80, 0x00,  //.@@@%.......
-  0x3f, 0x00, 0x00,  //.@@@........
-  0xbe, 0x00, 0x00,  //%@@%........
-  0xbd, 0x00, 0x00,  //%@@+........
-  0xfc, 0x7f, 0x90,  //@@@.+@@@%+..
-  0xfd, 0xff, 0xf8,  //@@@+@@@@@@%.
-  0xff, 0x41, 0xfc,  //@@@@+..+@@@.
-  0xfe, 0x00, 0xbe,  //@@@%....%@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbc, 0x00, 0x3f,  //%@@......@@@
-  0x7c, 0x00, 0x3f,  //+@@......@@@
-  0x3e, 0x00, 0xbe,  //.@@%....%@@%
-  0x2f, 0x41, 0xfc,  //.%@@+..+@@@.
-  0x0f, 0xff, 0xf4,  //..@@@@@@@@+.
-  0x01, 0xff, 0x80,  //...+@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf1, 0x00, 0x37, 0x7f, 0xe0, 0x07, 0xff, 0xfc, 0x0f, 0xe0, 0x1c, 0x3f, 0x80, 0x00, 0x3f, 0x00,
+  0x00, 0xbe, 0x00, 0x00, 0xbd, 0x00, 0x00, 0xfc, 0x7f, 0x90, 0xfd, 0xff, 0xf8, 0xff, 0x41, 0xfc,
+  0xfe, 0x00, 0xbe, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbc, 0x00, 0x3f, 0x7c, 0x00, 0x3f, 0x3e,
+  0x00, 0xbe, 0x2f, 0x41, 0xfc, 0x0f, 0xff, 0xf4, 0x01, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0xbd,  //........%@@+
-  0x00, 0x00, 0xfc,  //........@@@.
-  0x00, 0x01, 0xf8,  //.......+@@%.
-  0x00, 0x03, 0xf4,  //.......@@@+.
-  0x00, 0x07, 0xf0,  //......+@@@..
-  0x00, 0x0b, 0xe0,  //......%@@%..
-  0x00, 0x0f, 0xc0,  //......@@@...
-  0x00, 0x1f, 0xc0,  //.....+@@@...
-  0x00, 0x3f, 0x40,  //.....@@@+...
-  0x00, 0x3f, 0x00,  //.....@@@....
-  0x00, 0xbe, 0x00,  //....%@@%....
-  0x00, 0xfd, 0x00,  //....@@@+....
-  0x01, 0xfc, 0x00,  //...+@@@.....
-  0x02, 0xf8, 0x00,  //...%@@%.....
-  0x03, 0xf0, 0x00,  //...@@@......
-  0x07, 0xf0, 0x00,  //..+@@@......
-  0x0f, 0xd0, 0x00,  //..@@@+......
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0xfb, 0xff, 0x31, 0x00, 0x00, 0xbd, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x03,
+  0xf4, 0x00, 0x07, 0xf0, 0x00, 0x0b, 0xe0, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x40,
+  0x00, 0x3f, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xfd, 0x00, 0x01, 0xfc, 0x00, 0x02, 0xf8, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf0, 0x00, 0x0f, 0xd0, 0xee, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x80,  //..+%@@@@%...
-  0x2f, 0xff, 0xf8,  //.%@@@@@@@@%.
-  0x7f, 0x41, 0xfd,  //+@@@+..+@@@+
-  0xfd, 0x00, 0x7f,  //@@@+....+@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x07, 0xff, 0xd0,  //..+@@@@@@+..
-  0x0b, 0xff, 0xe0,  //..%@@@@@@%..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7d, 0x00, 0x7d,  //+@@+....+@@+
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7f, 0x41, 0xfd,  //+@@@+..+@@@+
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0x06, 0xff, 0x80, 0x2f, 0xff, 0xf8, 0x7f, 0x41, 0xfd, 0xfd, 0x00, 0x7f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc, 0x07, 0xff, 0xd0, 0x0b, 0xff,
+  0xe0, 0x3f, 0x41, 0xfc, 0x7d, 0x00, 0x7d, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xbd, 0x00, 0x7e, 0x7f, 0x41, 0xfd, 0x1f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x40,  //...%@@@@+...
-  0x1f, 0xff, 0xe0,  //.+@@@@@@@%..
-  0x3f, 0x41, 0xf8,  //.@@@+..+@@%.
-  0xbe, 0x00, 0xbc,  //%@@%....%@@.
-  0xfc, 0x00, 0x3d,  //@@@......@@+
-  0xfc, 0x00, 0x3e,  //@@@......@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbe, 0x00, 0xbf,  //%@@%....%@@@
-  0x3f, 0x41, 0xff,  //.@@@+..+@@@@
-  0x2f, 0xff, 0x7f,  //.%@@@@@@+@@@
-  0x06, 0xfd, 0x3f,  //..+%@@@+.@@@
-  0x00, 0x00, 0x7e,  //........+@@%
-  0x00, 0x00, 0xbe,  //........%@@%
-  0x00, 0x00, 0xfc,  //........@@@.
-  0x00, 0x01, 0xfc,  //.......+@@@.
-  0x34, 0x0b, 0xf0,  //.@+...%@@@..
-  0x3f, 0xff, 0xc0,  //.@@@@@@@@...
-  0x0b, 0xfd, 0x00,  //..%@@@@+....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x37, 0x02, 0xff, 0x40, 0x1f, 0xff, 0xe0, 0x3f, 0x41, 0xf8, 0xbe, 0x00, 0xbc, 0xfc,
+  0x00, 0x3d, 0xfc, 0x00, 0x3e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbe, 0x00, 0xbf, 0x3f, 0x41,
+  0xff, 0x2f, 0xff, 0x7f, 0x06, 0xfd, 0x3f, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xfc,
+  0x00, 0x01, 0xfc, 0x34, 0x0b, 0xf0, 0x3f, 0xff, 0xc0, 0x0b, 0xfd, 0xee, 0x00,
 
   /*Unicode: U+003a (:) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf6, 0x00, 0xfd, 0xfc, 0xfc, 0x00, 0xfd, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+003b (;) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3f,  //.@@@
-  0x3e,  //.@@%
-  0x7c,  //+@@.
-  0xb8,  //%@%.
-  0xf0,  //@@..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xf6, 0x00, 0xfd, 0x3f, 0xfc, 0x00, 0xfe, 0x3f, 0x03, 0x3e, 0x7c, 0xb8, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+003c (<) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x01, 0xc0,  //...........+@
-  0x00, 0x00, 0x2f, 0xc0,  //.........%@@@
-  0x00, 0x06, 0xff, 0x80,  //......+%@@@@%
-  0x00, 0x7f, 0xe4, 0x00,  //....+@@@@%+..
-  0x0b, 0xfe, 0x00, 0x00,  //..%@@@@%.....
-  0xff, 0x90, 0x00, 0x00,  //@@@@%+.......
-  0xfd, 0x00, 0x00, 0x00,  //@@@+.........
-  0xff, 0x90, 0x00, 0x00,  //@@@@%+.......
-  0x0b, 0xfe, 0x00, 0x00,  //..%@@@@%.....
-  0x00, 0x7f, 0xe4, 0x00,  //....+@@@@%+..
-  0x00, 0x06, 0xff, 0x80,  //......+%@@@@%
-  0x00, 0x00, 0x2f, 0xc0,  //.........%@@@
-  0x00, 0x00, 0x01, 0xc0,  //...........+@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdb, 0x00, 0x16, 0x01, 0xc0, 0x00, 0x00, 0x2f, 0xc0, 0x00, 0x06, 0xff, 0x80, 0x00, 0x7f, 0xe4,
+  0x00, 0x0b, 0xfe, 0x00, 0x00, 0xff, 0x90, 0x00, 0x00, 0xfd, 0xfe, 0x00, 0x05, 0xff, 0x90, 0x00,
+  0x00, 0x0b, 0xfe, 0xfe, 0x00, 0x0e, 0x7f, 0xe4, 0x00, 0x00, 0x06, 0xff, 0x80, 0x00, 0x00, 0x2f,
+  0xc0, 0x00, 0x00, 0x01, 0xc0, 0xe1, 0x00,
 
   /*Unicode: U+003d (=) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd1, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xf5, 0x00, 0xfe, 0xff, 0x00, 0xc0,
+  0xfe, 0xff, 0x00, 0xc0, 0xd5, 0x00,
 
   /*Unicode: U+003e (>) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xd0, 0x00, 0x00, 0x00,  //@+...........
-  0xfe, 0x00, 0x00, 0x00,  //@@@%.........
-  0xbf, 0xe4, 0x00, 0x00,  //%@@@@%+......
-  0x07, 0xff, 0x40, 0x00,  //..+@@@@@+....
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%..
-  0x00, 0x01, 0xbf, 0xc0,  //.......+%@@@@
-  0x00, 0x00, 0x1f, 0xc0,  //.........+@@@
-  0x00, 0x01, 0xbf, 0xc0,  //.......+%@@@@
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%..
-  0x06, 0xff, 0x40, 0x00,  //..+%@@@@+....
-  0xbf, 0xe4, 0x00, 0x00,  //%@@@@%+......
-  0xfe, 0x00, 0x00, 0x00,  //@@@%.........
-  0xd0, 0x00, 0x00, 0x00,  //@+...........
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdd, 0x00, 0x00, 0xd0, 0xfe, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x24, 0xbf, 0xe4, 0x00, 0x00, 0x07,
+  0xff, 0x40, 0x00, 0x00, 0x2f, 0xf8, 0x00, 0x00, 0x01, 0xbf, 0xc0, 0x00, 0x00, 0x1f, 0xc0, 0x00,
+  0x01, 0xbf, 0xc0, 0x00, 0x2f, 0xf8, 0x00, 0x06, 0xff, 0x40, 0x00, 0xbf, 0xe4, 0x00, 0x00, 0xfe,
+  0xfe, 0x00, 0x00, 0xd0, 0xde, 0x00,
 
   /*Unicode: U+003f (?) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x0b, 0xfd, 0x00,  //..%@@@@+..
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@.
-  0xf4, 0x0b, 0xe0,  //@@+...%@@%
-  0x80, 0x03, 0xf0,  //%......@@@
-  0x00, 0x03, 0xf0,  //.......@@@
-  0x00, 0x0f, 0xf0,  //......@@@@
-  0x00, 0x3f, 0xd0,  //.....@@@@+
-  0x00, 0xbf, 0x40,  //....%@@@+.
-  0x01, 0xfd, 0x00,  //...+@@@+..
-  0x02, 0xf8, 0x00,  //...%@@%...
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x03, 0xf0, 0x00,  //...@@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x28, 0x0b, 0xfd, 0x00, 0x7f, 0xff, 0xc0, 0xf4, 0x0b, 0xe0, 0x80, 0x03, 0xf0, 0x00,
+  0x03, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x3f, 0xd0, 0x00, 0xbf, 0x40, 0x01, 0xfd, 0x00, 0x02, 0xf8,
+  0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0xfa, 0x00, 0x07, 0x03,
+  0xf0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0xee, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x1b, 0xfd, 0x00,  //.....+%@@@@+...
-  0x00, 0xff, 0xff, 0xc0,  //....@@@@@@@@@..
-  0x03, 0xf4, 0x07, 0xf0,  //...@@@+...+@@@.
-  0x0f, 0x80, 0x00, 0xf4,  //..@@%.......@@+
-  0x2f, 0x00, 0x00, 0x78,  //.%@@........+@%
-  0x3c, 0x00, 0x00, 0x3c,  //.@@..........@@
-  0x78, 0x01, 0xfe, 0x3c,  //+@%....+@@@%.@@
-  0xb4, 0x0b, 0xff, 0xfc,  //%@+...%@@@@@@@@
-  0xf0, 0x1f, 0x41, 0xfc,  //@@...+@@+..+@@@
-  0xf0, 0x3d, 0x00, 0x7c,  //@@...@@+....+@@
-  0xf0, 0x3c, 0x00, 0x3c,  //@@...@@......@@
-  0xf0, 0x3c, 0x00, 0x3c,  //@@...@@......@@
-  0xf0, 0x3d, 0x00, 0x7c,  //@@...@@+....+@@
-  0xf4, 0x1f, 0x41, 0xfc,  //@@+..+@@+..+@@@
-  0xb4, 0x0b, 0xff, 0xfc,  //%@+...%@@@@@@@@
-  0x7c, 0x01, 0xfe, 0x3c,  //+@@....+@@@%.@@
-  0x3d, 0x00, 0x00, 0x00,  //.@@+...........
-  0x1f, 0x00, 0x00, 0x00,  //.+@@...........
-  0x0b, 0xc0, 0x00, 0x00,  //..%@@..........
-  0x02, 0xf9, 0x01, 0x80,  //...%@@%+...+%..
-  0x00, 0xbf, 0xff, 0xc0,  //....%@@@@@@@@..
-  0x00, 0x06, 0xff, 0x80,  //......+%@@@@%..
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xe8, 0x00, 0x3f, 0x1b, 0xfd, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xf4, 0x07, 0xf0, 0x0f, 0x80,
+  0x00, 0xf4, 0x2f, 0x00, 0x00, 0x78, 0x3c, 0x00, 0x00, 0x3c, 0x78, 0x01, 0xfe, 0x3c, 0xb4, 0x0b,
+  0xff, 0xfc, 0xf0, 0x1f, 0x41, 0xfc, 0xf0, 0x3d, 0x00, 0x7c, 0xf0, 0x3c, 0x00, 0x3c, 0xf0, 0x3c,
+  0x00, 0x3c, 0xf0, 0x3d, 0x00, 0x7c, 0xf4, 0x1f, 0x41, 0xfc, 0xb4, 0x0b, 0xff, 0xfc, 0x7c, 0x01,
+  0xfe, 0x3c, 0x3d, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x0f, 0x0b, 0xc0, 0x00, 0x00, 0x02, 0xf9,
+  0x01, 0x80, 0x00, 0xbf, 0xff, 0xc0, 0x00, 0x06, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xec, 0x00, 0x4a, 0x0f, 0xc0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f,
+  0xf0, 0x00, 0x00, 0x7f, 0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8,
+  0xbd, 0x00, 0x02, 0xf4, 0x7e, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0,
+  0x1f, 0x80, 0x0f, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00,
+  0x03, 0xf0, 0x3f, 0x00, 0x03, 0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xfe, 0x40,  //@@@@@@@%+...
-  0xff, 0xff, 0xe0,  //@@@@@@@@@%..
-  0xfc, 0x03, 0xf4,  //@@@....@@@+.
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x01, 0xf8,  //@@@....+@@%.
-  0xfc, 0x03, 0xf0,  //@@@....@@@..
-  0xff, 0xff, 0x80,  //@@@@@@@@%...
-  0xff, 0xff, 0xd0,  //@@@@@@@@@+..
-  0xfc, 0x02, 0xf8,  //@@@....%@@%.
-  0xfc, 0x00, 0xbd,  //@@@.....%@@+
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x01, 0xfd,  //@@@....+@@@+
-  0xff, 0xff, 0xf4,  //@@@@@@@@@@+.
-  0xff, 0xff, 0x80,  //@@@@@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0xff, 0xfe, 0x40, 0xff, 0xff, 0xe0, 0xfc, 0x03, 0xf4, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x01, 0xf8, 0xfc, 0x03, 0xf0, 0xff, 0xff, 0x80, 0xff, 0xff,
+  0xd0, 0xfc, 0x02, 0xf8, 0xfc, 0x00, 0xbd, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x7f, 0xfc, 0x01, 0xfd, 0xff, 0xff, 0xf4, 0xff, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x6f, 0xf8,  //....+%@@@@%.
-  0x03, 0xff, 0xff,  //...@@@@@@@@@
-  0x0f, 0xe0, 0x1f,  //..@@@%...+@@
-  0x2f, 0x80, 0x02,  //.%@@%......%
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x7e, 0x00, 0x00,  //+@@%........
-  0xbd, 0x00, 0x00,  //%@@+........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xbd, 0x00, 0x00,  //%@@+........
-  0x7e, 0x00, 0x00,  //+@@%........
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x2f, 0x80, 0x02,  //.%@@%......%
-  0x0f, 0xe0, 0x1f,  //..@@@%...+@@
-  0x03, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x6f, 0xf8,  //....+%@@@@%.
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf1, 0x00, 0x37, 0x6f, 0xf8, 0x03, 0xff, 0xff, 0x0f, 0xe0, 0x1f, 0x2f, 0x80, 0x02, 0x3f, 0x00,
+  0x00, 0x7e, 0x00, 0x00, 0xbd, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x2f,
+  0x80, 0x02, 0x0f, 0xe0, 0x1f, 0x03, 0xff, 0xff, 0x00, 0x6f, 0xf8, 0xef, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xf9, 0x00,  //@@@@@@%+....
-  0xff, 0xff, 0xc0,  //@@@@@@@@@...
-  0xfc, 0x07, 0xf0,  //@@@...+@@@..
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x00, 0xbc,  //@@@.....%@@.
-  0xfc, 0x00, 0x7e,  //@@@.....+@@%
-  0xfc, 0x00, 0x3e,  //@@@......@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3e,  //@@@......@@%
-  0xfc, 0x00, 0x7e,  //@@@.....+@@%
-  0xfc, 0x00, 0xbc,  //@@@.....%@@.
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x07, 0xf0,  //@@@...+@@@..
-  0xff, 0xff, 0xc0,  //@@@@@@@@@...
-  0xff, 0xf9, 0x00,  //@@@@@@%+....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x37, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xc0, 0xfc, 0x07, 0xf0, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xbc, 0xfc, 0x00, 0x7e, 0xfc, 0x00, 0x3e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3e, 0xfc, 0x00, 0x7e, 0xfc, 0x00, 0xbc,
+  0xfc, 0x00, 0xfc, 0xfc, 0x07, 0xf0, 0xff, 0xff, 0xc0, 0xff, 0xf9, 0xee, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0xfb, 0xff, 0x2c, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0xfb, 0xff, 0x30, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xed, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x6f, 0xf8, 0x00,  //....+%@@@@%..
-  0x03, 0xff, 0xff, 0x00,  //...@@@@@@@@@.
-  0x0f, 0xe0, 0x1f, 0x00,  //..@@@%...+@@.
-  0x2f, 0x40, 0x02, 0x00,  //.%@@+......%.
-  0x3f, 0x00, 0x00, 0x00,  //.@@@.........
-  0x7d, 0x00, 0x00, 0x00,  //+@@+.........
-  0xbd, 0x00, 0x00, 0x00,  //%@@+.........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x03, 0xff, 0xc0,  //@@@....@@@@@@
-  0xfc, 0x03, 0xff, 0xc0,  //@@@....@@@@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbc, 0x00, 0x0f, 0xc0,  //%@@.......@@@
-  0x7d, 0x00, 0x0f, 0xc0,  //+@@+......@@@
-  0x3f, 0x00, 0x0f, 0xc0,  //.@@@......@@@
-  0x2f, 0x40, 0x0f, 0xc0,  //.%@@+.....@@@
-  0x0f, 0xe0, 0x2f, 0xc0,  //..@@@%...%@@@
-  0x03, 0xff, 0xff, 0x80,  //...@@@@@@@@@%
-  0x00, 0x6f, 0xf8, 0x00,  //....+%@@@@%..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xec, 0x00, 0x0f, 0x6f, 0xf8, 0x00, 0x03, 0xff, 0xff, 0x00, 0x0f, 0xe0, 0x1f, 0x00, 0x2f, 0x40,
+  0x02, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7d, 0xfe, 0x00, 0x00, 0xbd, 0xfe, 0x00, 0x00, 0xfc, 0xfe,
+  0x00, 0x00, 0xfc, 0xfe, 0x00, 0x26, 0xfc, 0x03, 0xff, 0xc0, 0xfc, 0x03, 0xff, 0xc0, 0xfc, 0x00,
+  0x0f, 0xc0, 0xbc, 0x00, 0x0f, 0xc0, 0x7d, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x0f, 0xc0, 0x2f, 0x40,
+  0x0f, 0xc0, 0x0f, 0xe0, 0x2f, 0xc0, 0x03, 0xff, 0xff, 0x80, 0x00, 0x6f, 0xf8, 0xe8, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x17, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfb, 0xff, 0x1a, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf2, 0x00, 0x38, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+004a (J) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x03, 0xff, 0xfc,  //...@@@@@@@@
-  0x03, 0xff, 0xfc,  //...@@@@@@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x00, 0x00, 0xfc,  //........@@@
-  0x80, 0x01, 0xf8,  //%......+@@%
-  0xf4, 0x07, 0xf4,  //@@+...+@@@+
-  0xff, 0xff, 0xe0,  //@@@@@@@@@%.
-  0x1b, 0xfe, 0x40,  //.+%@@@@%+..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf2, 0x00, 0x38, 0x03, 0xff, 0xfc, 0x03, 0xff, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x80, 0x01, 0xf8, 0xf4, 0x07, 0xf4, 0xff, 0xff, 0xe0, 0x1b, 0xfe, 0x40, 0xef, 0x00,
 
   /*Unicode: U+004b (K) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xfc, 0x00, 0x07, 0xe0,  //@@@.......+@@%.
-  0xfc, 0x00, 0x1f, 0x80,  //@@@......+@@%..
-  0xfc, 0x00, 0x7e, 0x00,  //@@@.....+@@%...
-  0xfc, 0x01, 0xf8, 0x00,  //@@@....+@@%....
-  0xfc, 0x07, 0xe0, 0x00,  //@@@...+@@%.....
-  0xfc, 0x0f, 0xc0, 0x00,  //@@@...@@@......
-  0xfc, 0x3f, 0x00, 0x00,  //@@@..@@@.......
-  0xfc, 0xfc, 0x00, 0x00,  //@@@.@@@........
-  0xff, 0xfc, 0x00, 0x00,  //@@@@@@@........
-  0xff, 0xff, 0x00, 0x00,  //@@@@@@@@.......
-  0xff, 0x7f, 0x40, 0x00,  //@@@@+@@@+......
-  0xfc, 0x1f, 0xc0, 0x00,  //@@@..+@@@......
-  0xfc, 0x0f, 0xf0, 0x00,  //@@@...@@@@.....
-  0xfc, 0x03, 0xf8, 0x00,  //@@@....@@@%....
-  0xfc, 0x01, 0xfc, 0x00,  //@@@....+@@@....
-  0xfc, 0x00, 0xbf, 0x00,  //@@@.....%@@@...
-  0xfc, 0x00, 0x3f, 0x80,  //@@@......@@@%..
-  0xfc, 0x00, 0x1f, 0xc0,  //@@@......+@@@..
-  0xfc, 0x00, 0x0b, 0xf0,  //@@@.......%@@@.
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x4b, 0xfc, 0x00, 0x07, 0xe0, 0xfc, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x7e, 0x00, 0xfc,
+  0x01, 0xf8, 0x00, 0xfc, 0x07, 0xe0, 0x00, 0xfc, 0x0f, 0xc0, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfc,
+  0xfc, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x40, 0x00, 0xfc,
+  0x1f, 0xc0, 0x00, 0xfc, 0x0f, 0xf0, 0x00, 0xfc, 0x03, 0xf8, 0x00, 0xfc, 0x01, 0xfc, 0x00, 0xfc,
+  0x00, 0xbf, 0x00, 0xfc, 0x00, 0x3f, 0x80, 0xfc, 0x00, 0x1f, 0xc0, 0xfc, 0x00, 0x0b, 0xf0, 0xe9,
+  0x00,
 
   /*Unicode: U+004c (L) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x32, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+004d (M) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0x00, 0x3f, 0xc0,  //@@@@.....@@@@
-  0xff, 0x40, 0x7f, 0xc0,  //@@@@+...+@@@@
-  0xff, 0x80, 0xbf, 0xc0,  //@@@@%...%@@@@
-  0xff, 0xc0, 0xff, 0xc0,  //@@@@@...@@@@@
-  0xfe, 0xc0, 0xef, 0xc0,  //@@@%@...@%@@@
-  0xfd, 0xd1, 0xdf, 0xc0,  //@@@+@+.+@+@@@
-  0xfc, 0xe2, 0xcf, 0xc0,  //@@@.@%.%@.@@@
-  0xfc, 0xb3, 0x8f, 0xc0,  //@@@.%@.@%.@@@
-  0xfc, 0x77, 0x4f, 0xc0,  //@@@.+@+@+.@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x2e, 0x0f, 0xc0,  //@@@..%@%..@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x4b, 0xff, 0x00, 0x3f, 0xc0, 0xff, 0x40, 0x7f, 0xc0, 0xff, 0x80, 0xbf, 0xc0, 0xff,
+  0xc0, 0xff, 0xc0, 0xfe, 0xc0, 0xef, 0xc0, 0xfd, 0xd1, 0xdf, 0xc0, 0xfc, 0xe2, 0xcf, 0xc0, 0xfc,
+  0xb3, 0x8f, 0xc0, 0xfc, 0x77, 0x4f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc,
+  0x2e, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xe9,
+  0x00,
 
   /*Unicode: U+004e (N) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0x00, 0x3f,  //@@@@.....@@@
-  0xff, 0x00, 0x3f,  //@@@@.....@@@
-  0xff, 0x80, 0x3f,  //@@@@%....@@@
-  0xff, 0xc0, 0x3f,  //@@@@@....@@@
-  0xfe, 0xc0, 0x3f,  //@@@%@....@@@
-  0xfd, 0xe0, 0x3f,  //@@@+@%...@@@
-  0xfc, 0xf0, 0x3f,  //@@@.@@...@@@
-  0xfc, 0xb4, 0x3f,  //@@@.%@+..@@@
-  0xfc, 0x78, 0x3f,  //@@@.+@%..@@@
-  0xfc, 0x3c, 0x3f,  //@@@..@@..@@@
-  0xfc, 0x2d, 0x3f,  //@@@..%@+.@@@
-  0xfc, 0x1e, 0x3f,  //@@@..+@%.@@@
-  0xfc, 0x0f, 0x3f,  //@@@...@@.@@@
-  0xfc, 0x0b, 0x7f,  //@@@...%@+@@@
-  0xfc, 0x03, 0xbf,  //@@@....@%@@@
-  0xfc, 0x03, 0xff,  //@@@....@@@@@
-  0xfc, 0x02, 0xff,  //@@@....%@@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xc0, 0x3f, 0xfe,
+  0xc0, 0x3f, 0xfd, 0xe0, 0x3f, 0xfc, 0xf0, 0x3f, 0xfc, 0xb4, 0x3f, 0xfc, 0x78, 0x3f, 0xfc, 0x3c,
+  0x3f, 0xfc, 0x2d, 0x3f, 0xfc, 0x1e, 0x3f, 0xfc, 0x0f, 0x3f, 0xfc, 0x0b, 0x7f, 0xfc, 0x03, 0xbf,
+  0xfc, 0x03, 0xff, 0xfc, 0x02, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xef, 0x00,
 
   /*Unicode: U+004f (O) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x4a, 0x01, 0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f,
+  0x00, 0x3f, 0x00, 0x7e, 0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f,
+  0x00, 0x3f, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0x80,  //@@@@@@@@%...
-  0xff, 0xff, 0xf4,  //@@@@@@@@@@+.
-  0xfc, 0x02, 0xfc,  //@@@....%@@@.
-  0xfc, 0x00, 0xbe,  //@@@.....%@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0xbe,  //@@@.....%@@%
-  0xfc, 0x02, 0xfd,  //@@@....%@@@+
-  0xff, 0xff, 0xf4,  //@@@@@@@@@@+.
-  0xff, 0xff, 0x80,  //@@@@@@@@%...
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x36, 0xff, 0xff, 0x80, 0xff, 0xff, 0xf4, 0xfc, 0x02, 0xfc, 0xfc, 0x00, 0xbe, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0xbe, 0xfc, 0x02, 0xfd, 0xff, 0xff,
+  0xf4, 0xff, 0xff, 0x80, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xed, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0xe0, 0x00,  //...+%@@@@%...
-  0x00, 0x02, 0xf4, 0x00,  //.......%@@+..
-  0x00, 0x00, 0xbe, 0x00,  //........%@@%.
-  0x00, 0x00, 0x28, 0x00,  //.........%%..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x4e, 0x01, 0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f,
+  0x00, 0x3f, 0x00, 0x7e, 0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f,
+  0x00, 0x3f, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0xe0, 0x00, 0x00,
+  0x02, 0xf4, 0xfe, 0x00, 0x00, 0xbe, 0xfe, 0x00, 0x00, 0x28, 0xf4, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0x80, 0x00,  //@@@@@@@@%.....
-  0xff, 0xff, 0xf4, 0x00,  //@@@@@@@@@@+...
-  0xfc, 0x02, 0xfc, 0x00,  //@@@....%@@@...
-  0xfc, 0x00, 0xbe, 0x00,  //@@@.....%@@%..
-  0xfc, 0x00, 0x3f, 0x00,  //@@@......@@@..
-  0xfc, 0x00, 0x3f, 0x00,  //@@@......@@@..
-  0xfc, 0x00, 0x3f, 0x00,  //@@@......@@@..
-  0xfc, 0x00, 0x7e, 0x00,  //@@@.....+@@%..
-  0xfc, 0x01, 0xfc, 0x00,  //@@@....+@@@...
-  0xff, 0xff, 0xe0, 0x00,  //@@@@@@@@@%....
-  0xff, 0xff, 0x80, 0x00,  //@@@@@@@@%.....
-  0xfc, 0x0b, 0xf0, 0x00,  //@@@...%@@@....
-  0xfc, 0x02, 0xf8, 0x00,  //@@@....%@@%...
-  0xfc, 0x00, 0xfd, 0x00,  //@@@.....@@@+..
-  0xfc, 0x00, 0xbf, 0x00,  //@@@.....%@@@..
-  0xfc, 0x00, 0x3f, 0x40,  //@@@......@@@+.
-  0xfc, 0x00, 0x2f, 0xc0,  //@@@......%@@@.
-  0xfc, 0x00, 0x0f, 0xd0,  //@@@.......@@@+
-  0xfc, 0x00, 0x0b, 0xf0,  //@@@.......%@@@
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xed, 0x00, 0x4b, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xf4, 0x00, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+  0x00, 0xbe, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0xfc,
+  0x00, 0x7e, 0x00, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0x80, 0x00, 0xfc,
+  0x0b, 0xf0, 0x00, 0xfc, 0x02, 0xf8, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xbf, 0x00, 0xfc,
+  0x00, 0x3f, 0x40, 0xfc, 0x00, 0x2f, 0xc0, 0xfc, 0x00, 0x0f, 0xd0, 0xfc, 0x00, 0x0b, 0xf0, 0xe9,
+  0x00,
 
   /*Unicode: U+0053 (S) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x90,  //...%@@@@%+..
-  0x1f, 0xff, 0xfc,  //.+@@@@@@@@@.
-  0x3f, 0x80, 0x7c,  //.@@@%...+@@.
-  0xbe, 0x00, 0x08,  //%@@%......%.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfe, 0x00, 0x00,  //@@@%........
-  0xbf, 0xe4, 0x00,  //%@@@@%+.....
-  0x3f, 0xff, 0xd0,  //.@@@@@@@@+..
-  0x07, 0xff, 0xf8,  //..+@@@@@@@%.
-  0x00, 0x1b, 0xfd,  //.....+%@@@@+
-  0x00, 0x00, 0xfe,  //........@@@%
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x80, 0x00, 0x7e,  //%.......+@@%
-  0xf8, 0x02, 0xfd,  //@@%....%@@@+
-  0xff, 0xff, 0xf4,  //@@@@@@@@@@+.
-  0x1b, 0xff, 0x80,  //.+%@@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0x02, 0xff, 0x90, 0x1f, 0xff, 0xfc, 0x3f, 0x80, 0x7c, 0xbe, 0x00, 0x08, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xbf, 0xe4, 0x00, 0x3f, 0xff, 0xd0, 0x07, 0xff,
+  0xf8, 0x00, 0x1b, 0xfd, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+  0x80, 0x00, 0x7e, 0xf8, 0x02, 0xfd, 0xff, 0xff, 0xf4, 0x1b, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xfc,  //@@@@@@@@@@@@@@@
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0xfe, 0xff, 0x00, 0xfc, 0xfe, 0xff, 0x43, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x38, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc, 0x1f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0xfd, 0x00, 0x07, 0xf0,  //@@@+......+@@@
-  0xbe, 0x00, 0x0b, 0xe0,  //%@@%......%@@%
-  0x7f, 0x00, 0x0f, 0xd0,  //+@@@......@@@+
-  0x3f, 0x00, 0x0f, 0xc0,  //.@@@......@@@.
-  0x2f, 0x40, 0x1f, 0x80,  //.%@@+....+@@%.
-  0x1f, 0x80, 0x2f, 0x40,  //.+@@%....%@@+.
-  0x0f, 0xc0, 0x3f, 0x00,  //..@@@....@@@..
-  0x0f, 0xd0, 0x7f, 0x00,  //..@@@+..+@@@..
-  0x0b, 0xe0, 0xbe, 0x00,  //..%@@%..%@@%..
-  0x07, 0xf0, 0xfd, 0x00,  //..+@@@..@@@+..
-  0x03, 0xf0, 0xfc, 0x00,  //...@@@..@@@...
-  0x02, 0xf5, 0xf8, 0x00,  //...%@@++@@%...
-  0x01, 0xfa, 0xf4, 0x00,  //...+@@%%@@+...
-  0x00, 0xff, 0xf0, 0x00,  //....@@@@@@....
-  0x00, 0xff, 0xf0, 0x00,  //....@@@@@@....
-  0x00, 0xbf, 0xe0, 0x00,  //....%@@@@%....
-  0x00, 0x7f, 0xc0, 0x00,  //....+@@@@.....
-  0x00, 0x3f, 0xc0, 0x00,  //.....@@@@.....
-  0x00, 0x2f, 0x80, 0x00,  //.....%@@%.....
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xed, 0x00, 0x4a, 0xfd, 0x00, 0x07, 0xf0, 0xbe, 0x00, 0x0b, 0xe0, 0x7f, 0x00, 0x0f, 0xd0, 0x3f,
+  0x00, 0x0f, 0xc0, 0x2f, 0x40, 0x1f, 0x80, 0x1f, 0x80, 0x2f, 0x40, 0x0f, 0xc0, 0x3f, 0x00, 0x0f,
+  0xd0, 0x7f, 0x00, 0x0b, 0xe0, 0xbe, 0x00, 0x07, 0xf0, 0xfd, 0x00, 0x03, 0xf0, 0xfc, 0x00, 0x02,
+  0xf5, 0xf8, 0x00, 0x01, 0xfa, 0xf4, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
+  0xbf, 0xe0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x2f, 0x80, 0xe8, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0xfc, 0x00, 0x00, 0x3f,  //@@@..........@@@
-  0xfd, 0x00, 0x00, 0x7f,  //@@@+........+@@@
-  0xbd, 0x00, 0x00, 0x7e,  //%@@+........+@@%
-  0x7e, 0x00, 0x00, 0xbd,  //+@@%........%@@+
-  0x7e, 0x00, 0x00, 0xbd,  //+@@%........%@@+
-  0x3f, 0x07, 0xd0, 0xfc,  //.@@@..+@@+..@@@.
-  0x3f, 0x0b, 0xe0, 0xfc,  //.@@@..%@@%..@@@.
-  0x3f, 0x0f, 0xf0, 0xfc,  //.@@@..@@@@..@@@.
-  0x2f, 0x4f, 0xf1, 0xf8,  //.%@@+.@@@@.+@@%.
-  0x2f, 0x5e, 0xb5, 0xf8,  //.%@@++@%%@++@@%.
-  0x1f, 0x9d, 0x76, 0xf4,  //.+@@%+@++@+%@@+.
-  0x0f, 0xec, 0x3b, 0xf0,  //..@@@%@..@%@@@..
-  0x0f, 0xfc, 0x3f, 0xf0,  //..@@@@@..@@@@@..
-  0x0f, 0xf8, 0x2f, 0xf0,  //..@@@@%..%@@@@..
-  0x0f, 0xf4, 0x1f, 0xf0,  //..@@@@+..+@@@@..
-  0x0b, 0xf0, 0x0f, 0xe0,  //..%@@@....@@@%..
-  0x07, 0xf0, 0x0f, 0xd0,  //..+@@@....@@@+..
-  0x07, 0xe0, 0x0b, 0xd0,  //..+@@%....%@@+..
-  0x03, 0xd0, 0x07, 0xc0,  //...@@+....+@@...
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-
+  0xed, 0x00, 0x4b, 0xfc, 0x00, 0x00, 0x3f, 0xfd, 0x00, 0x00, 0x7f, 0xbd, 0x00, 0x00, 0x7e, 0x7e,
+  0x00, 0x00, 0xbd, 0x7e, 0x00, 0x00, 0xbd, 0x3f, 0x07, 0xd0, 0xfc, 0x3f, 0x0b, 0xe0, 0xfc, 0x3f,
+  0x0f, 0xf0, 0xfc, 0x2f, 0x4f, 0xf1, 0xf8, 0x2f, 0x5e, 0xb5, 0xf8, 0x1f, 0x9d, 0x76, 0xf4, 0x0f,
+  0xec, 0x3b, 0xf0, 0x0f, 0xfc, 0x3f, 0xf0, 0x0f, 0xf8, 0x2f, 0xf0, 0x0f, 0xf4, 0x1f, 0xf0, 0x0b,
+  0xf0, 0x0f, 0xe0, 0x07, 0xf0, 0x0f, 0xd0, 0x07, 0xe0, 0x0b, 0xd0, 0x03, 0xd0, 0x07, 0xc0, 0xe9,
+  0x00,
 
   /*Unicode: U+0058 (X) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xbf, 0x00, 0x03, 0xf8,  //%@@@.......@@@%
-  0x3f, 0x80, 0x0b, 0xf0,  //.@@@%.....%@@@.
-  0x1f, 0xc0, 0x1f, 0xd0,  //.+@@@....+@@@+.
-  0x0b, 0xf0, 0x3f, 0x80,  //..%@@@...@@@%..
-  0x03, 0xf8, 0xbf, 0x00,  //...@@@%.%@@@...
-  0x01, 0xfe, 0xfc, 0x00,  //...+@@@%@@@....
-  0x00, 0xbf, 0xf8, 0x00,  //....%@@@@@%....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x1f, 0xc0, 0x00,  //.....+@@@......
-  0x00, 0x1f, 0xc0, 0x00,  //.....+@@@......
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0xbf, 0xf4, 0x00,  //....%@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x03, 0xf8, 0xfe, 0x00,  //...@@@%.@@@%...
-  0x07, 0xf0, 0x7f, 0x40,  //..+@@@..+@@@+..
-  0x0f, 0xe0, 0x2f, 0xc0,  //..@@@%...%@@@..
-  0x2f, 0xc0, 0x0f, 0xd0,  //.%@@@.....@@@+.
-  0x3f, 0x40, 0x07, 0xf0,  //.@@@+.....+@@@.
-  0xbf, 0x00, 0x03, 0xf8,  //%@@@.......@@@%
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x4b, 0xbf, 0x00, 0x03, 0xf8, 0x3f, 0x80, 0x0b, 0xf0, 0x1f, 0xc0, 0x1f, 0xd0, 0x0b,
+  0xf0, 0x3f, 0x80, 0x03, 0xf8, 0xbf, 0x00, 0x01, 0xfe, 0xfc, 0x00, 0x00, 0xbf, 0xf8, 0x00, 0x00,
+  0x3f, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00,
+  0xbf, 0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x03, 0xf8, 0xfe, 0x00, 0x07, 0xf0, 0x7f, 0x40, 0x0f,
+  0xe0, 0x2f, 0xc0, 0x2f, 0xc0, 0x0f, 0xd0, 0x3f, 0x40, 0x07, 0xf0, 0xbf, 0x00, 0x03, 0xf8, 0xe9,
+  0x00,
 
   /*Unicode: U+0059 (Y) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0x3f, 0x40, 0x07, 0xf0,  //.@@@+.....+@@@.
-  0x2f, 0xc0, 0x0f, 0xe0,  //.%@@@.....@@@%.
-  0x0f, 0xd0, 0x1f, 0xc0,  //..@@@+...+@@@..
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x03, 0xf8, 0xbf, 0x00,  //...@@@%.%@@@...
-  0x01, 0xfd, 0xfd, 0x00,  //...+@@@+@@@+...
-  0x00, 0xbf, 0xf8, 0x00,  //....%@@@@@%....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x4a, 0xbe, 0x00, 0x02, 0xf8, 0x3f, 0x40, 0x07, 0xf0, 0x2f, 0xc0, 0x0f, 0xe0, 0x0f,
+  0xd0, 0x1f, 0xc0, 0x07, 0xf0, 0x3f, 0x40, 0x03, 0xf8, 0xbf, 0x00, 0x01, 0xfd, 0xfd, 0x00, 0x00,
+  0xbf, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x3f, 0x80,  //.........@@@%
-  0x00, 0x00, 0x7f, 0x00,  //........+@@@.
-  0x00, 0x00, 0xfd, 0x00,  //........@@@+.
-  0x00, 0x02, 0xfc, 0x00,  //.......%@@@..
-  0x00, 0x07, 0xf0, 0x00,  //......+@@@...
-  0x00, 0x0f, 0xe0, 0x00,  //......@@@%...
-  0x00, 0x2f, 0xc0, 0x00,  //.....%@@@....
-  0x00, 0x7f, 0x40, 0x00,  //....+@@@+....
-  0x00, 0xfe, 0x00, 0x00,  //....@@@%.....
-  0x02, 0xfc, 0x00, 0x00,  //...%@@@......
-  0x03, 0xf4, 0x00, 0x00,  //...@@@+......
-  0x0f, 0xf0, 0x00, 0x00,  //..@@@@.......
-  0x1f, 0xc0, 0x00, 0x00,  //.+@@@........
-  0x3f, 0x80, 0x00, 0x00,  //.@@@%........
-  0xbf, 0x00, 0x00, 0x00,  //%@@@.........
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x07, 0xc0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00,
+  0x7f, 0xfe, 0x00, 0x2e, 0xfd, 0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x0f,
+  0xe0, 0x00, 0x00, 0x2f, 0xc0, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x02, 0xfc,
+  0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x00, 0xbf, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+005b ([) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xff, 0xf0,  //@@@@@@
-  0xff, 0xf0,  //@@@@@@
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xfc, 0x00,  //@@@...
-  0xff, 0xf0,  //@@@@@@
-  0xff, 0xf0,  //@@@@@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xf9, 0x00, 0x2d, 0xff, 0xf0, 0xff, 0xf0, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0xfb, 0x00,
 
   /*Unicode: U+005c (\) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x3f, 0x00, 0x00, 0x00,  //.@@@.........
-  0x1f, 0x80, 0x00, 0x00,  //.+@@%........
-  0x0f, 0xc0, 0x00, 0x00,  //..@@@........
-  0x07, 0xe0, 0x00, 0x00,  //..+@@%.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x01, 0xf8, 0x00, 0x00,  //...+@@%......
-  0x00, 0xfc, 0x00, 0x00,  //....@@@......
-  0x00, 0x7e, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x2f, 0x40, 0x00,  //.....%@@+....
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@....
-  0x00, 0x0b, 0xd0, 0x00,  //......%@@+...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@...
-  0x00, 0x02, 0xf4, 0x00,  //.......%@@+..
-  0x00, 0x00, 0xfc, 0x00,  //........@@@..
-  0x00, 0x00, 0xbd, 0x00,  //........%@@+.
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@.
-  0x00, 0x00, 0x2f, 0x40,  //.........%@@+
-  0x00, 0x00, 0x0f, 0xc0,  //..........@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x11, 0x1f,
+  0x80, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x01,
+  0xf8, 0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x11,
+  0x2f, 0x40, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0b, 0xd0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00,
+  0x02, 0xf4, 0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xbd, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x05, 0x2f, 0x40, 0x00, 0x00, 0x0f, 0xc0, 0xf1, 0x00,
 
   /*Unicode: U+005d (]) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xff, 0xf0,  //@@@@@@
-  0xff, 0xf0,  //@@@@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0x03, 0xf0,  //...@@@
-  0xff, 0xf0,  //@@@@@@
-  0xff, 0xf0,  //@@@@@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xf9, 0x00, 0x2d, 0xff, 0xf0, 0xff, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03,
+  0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03,
+  0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0xff, 0xf0, 0xff,
+  0xf0, 0xfb, 0x00,
 
   /*Unicode: U+005e (^) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x2f, 0x80, 0x00,  //.....%@@%.....
-  0x00, 0x7f, 0xd0, 0x00,  //....+@@@@+....
-  0x00, 0xfa, 0xf0, 0x00,  //....@@%%@@....
-  0x03, 0xe0, 0xbc, 0x00,  //...@@%..%@@...
-  0x0f, 0x80, 0x2f, 0x00,  //..@@%....%@@..
-  0x2e, 0x00, 0x0b, 0x80,  //.%@%......%@%.
-  0xb8, 0x00, 0x02, 0xe0,  //%@%........%@%
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xec, 0x00, 0x1a, 0x2f, 0x80, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x00, 0xfa, 0xf0, 0x00, 0x03, 0xe0,
+  0xbc, 0x00, 0x0f, 0x80, 0x2f, 0x00, 0x2e, 0x00, 0x0b, 0x80, 0xb8, 0x00, 0x02, 0xe0, 0xb9, 0x00,
 
   /*Unicode: U+005f (_) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-
+  0x91, 0x00, 0xf9, 0xff,
 
   /*Unicode: U+0060 (`) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xbc, 0x00,  //%@@...
-  0x3e, 0x00,  //.@@%..
-  0x0f, 0x00,  //..@@..
-  0x03, 0xc0,  //...@@.
-  0x01, 0xe0,  //...+@%
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfb, 0x00, 0x09, 0xbc, 0x00, 0x3e, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x01, 0xe0, 0xd5, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc, 0x00,
+  0x7f, 0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0xfe, 0xff, 0xf4,  //@@@%@@@@@@+.
-  0xff, 0x81, 0xfc,  //@@@@%..+@@@.
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xff, 0x41, 0xfc,  //@@@@+..+@@@.
-  0xfe, 0xff, 0xf0,  //@@@%@@@@@@..
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x3b, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x7f, 0x80, 0xfe, 0xff, 0xf4, 0xff, 0x81, 0xfc, 0xfe, 0x00,
+  0xbd, 0xfd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xfd, 0x00, 0x7e, 0xfe, 0x00, 0xbd, 0xff, 0x41, 0xfc, 0xfe, 0xff, 0xf0, 0xfc, 0x7f, 0x80, 0xef,
+  0x00,
 
   /*Unicode: U+0063 (c) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0xbf, 0x80,  //....%@@@%..
-  0x0b, 0xff, 0xf4,  //..%@@@@@@@+
-  0x2f, 0xd0, 0x2c,  //.%@@@+...%@
-  0x7f, 0x00, 0x04,  //+@@@......+
-  0xbd, 0x00, 0x00,  //%@@+.......
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xbd, 0x00, 0x00,  //%@@+.......
-  0x7f, 0x00, 0x04,  //+@@@......+
-  0x2f, 0xd0, 0x2c,  //.%@@@+...%@
-  0x0b, 0xff, 0xf4,  //..%@@@@@@@+
-  0x01, 0xbf, 0x80,  //...+%@@@%..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xe2, 0x00, 0x28, 0xbf, 0x80, 0x0b, 0xff, 0xf4, 0x2f, 0xd0, 0x2c, 0x7f, 0x00, 0x04, 0xbd, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xbd, 0x00, 0x00,
+  0x7f, 0x00, 0x04, 0x2f, 0xd0, 0x2c, 0x0b, 0xff, 0xf4, 0x01, 0xbf, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x1f, 0xff, 0xbf,  //.+@@@@@@%@@@
-  0x3f, 0x42, 0xff,  //.@@@+..%@@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0x3f, 0x42, 0xff,  //.@@@+..%@@@@
-  0x0f, 0xff, 0xbf,  //..@@@@@@%@@@
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf3, 0x00, 0x39, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x3f, 0x02, 0xfd, 0x3f, 0x1f, 0xff, 0xbf, 0x3f, 0x42, 0xff, 0x7e, 0x00, 0xbf, 0xbd,
+  0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00,
+  0x7f, 0x7e, 0x00, 0xbf, 0x3f, 0x42, 0xff, 0x0f, 0xff, 0xbf, 0x02, 0xfd, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xbf, 0xd0, 0x00,  //....%@@@@+...
-  0x0b, 0xff, 0xfc, 0x00,  //..%@@@@@@@@..
-  0x2f, 0xc0, 0xbf, 0x00,  //.%@@@...%@@@.
-  0x3f, 0x00, 0x2f, 0x40,  //.@@@.....%@@+
-  0xbd, 0x00, 0x0f, 0x80,  //%@@+......@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xbc, 0x00, 0x00, 0x00,  //%@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x2f, 0x90, 0x1b, 0x00,  //.%@@%+...+%@.
-  0x0b, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x01, 0xbf, 0xe4, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd8, 0x00, 0x16, 0xbf, 0xd0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x2f, 0xc0, 0xbf, 0x00, 0x3f, 0x00,
+  0x2f, 0x40, 0xbd, 0x00, 0x0f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff,
+  0x01, 0xc0, 0xfc, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x0a, 0x2f, 0x90,
+  0x1b, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x01, 0xbf, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x0b, 0xff,  //......%@@@@@
-  0x00, 0x3f, 0xff,  //.....@@@@@@@
-  0x00, 0xbe, 0x00,  //....%@@%....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf4, 0x00, 0x10, 0x0b, 0xff, 0x00, 0x3f, 0xff, 0x00, 0xbe, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0xfb, 0xff, 0x22, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xee, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x0f, 0xff, 0x7f,  //..@@@@@@+@@@
-  0x3f, 0x81, 0xff,  //.@@@%..+@@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0x3f, 0x81, 0xff,  //.@@@%..+@@@@
-  0x0f, 0xff, 0x7f,  //..@@@@@@+@@@
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x7e,  //........+@@%
-  0x0d, 0x01, 0xfc,  //..@+...+@@@.
-  0x0f, 0xff, 0xf4,  //..@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x38, 0x02, 0xfd, 0x3f, 0x0f, 0xff, 0x7f, 0x3f, 0x81, 0xff, 0x7e, 0x00, 0xbf, 0xbd,
+  0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00,
+  0x7f, 0x7e, 0x00, 0xbf, 0x3f, 0x81, 0xff, 0x0f, 0xff, 0x7f, 0x02, 0xfd, 0x3f, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x7e, 0x0d, 0x01, 0xfc, 0x0f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x6f, 0x80,  //@@@.+%@@%..
-  0xfd, 0xff, 0xf0,  //@@@+@@@@@@.
-  0xff, 0x43, 0xf8,  //@@@@+..@@@%
-  0xfe, 0x01, 0xfc,  //@@@%...+@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x3b, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x6f, 0x80, 0xfd, 0xff, 0xf0, 0xff, 0x43, 0xf8, 0xfe, 0x01,
+  0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc,
+  0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xef,
+  0x00,
 
   /*Unicode: U+0069 (i) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf0, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xf3, 0x00, 0x05, 0x3f,
+  0xff, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x02, 0x3f, 0x00, 0x00, 0xfe,
+  0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+006a (j) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x3f, 0xff,  //.@@@@@@@
-  0x3f, 0xff,  //.@@@@@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0x3f,  //.....@@@
-  0x00, 0xfd,  //....@@@+
-  0xff, 0xfc,  //@@@@@@@.
-  0xff, 0xd0,  //@@@@@+..
-  0x00, 0x00,  //........
-
+  0xf8, 0x00, 0x04, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0xfb, 0x00, 0x27, 0x3f, 0xff, 0x3f, 0xff, 0x00,
+  0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00,
+  0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0xfd, 0xff, 0xfc, 0xff,
+  0xd0, 0x00, 0x00,
 
   /*Unicode: U+006b (k) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xfc, 0x00, 0xff, 0x40,  //@@@.....@@@@+
-  0xfc, 0x03, 0xfd, 0x00,  //@@@....@@@@+.
-  0xfc, 0x0f, 0xf4, 0x00,  //@@@...@@@@+..
-  0xfc, 0x2f, 0xd0, 0x00,  //@@@..%@@@+...
-  0xfc, 0xbf, 0x40, 0x00,  //@@@.%@@@+....
-  0xfe, 0xfd, 0x00, 0x00,  //@@@%@@@+.....
-  0xff, 0xfc, 0x00, 0x00,  //@@@@@@@......
-  0xff, 0xfe, 0x00, 0x00,  //@@@@@@@%.....
-  0xff, 0xff, 0x40, 0x00,  //@@@@@@@@+....
-  0xfe, 0x2f, 0xc0, 0x00,  //@@@%.%@@@....
-  0xfc, 0x0f, 0xe0, 0x00,  //@@@...@@@%...
-  0xfc, 0x07, 0xf4, 0x00,  //@@@...+@@@+..
-  0xfc, 0x02, 0xfc, 0x00,  //@@@....%@@@..
-  0xfc, 0x00, 0xfe, 0x00,  //@@@.....@@@%.
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf1, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xfc,
+  0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x36, 0xfc, 0x00, 0xff, 0x40, 0xfc,
+  0x03, 0xfd, 0x00, 0xfc, 0x0f, 0xf4, 0x00, 0xfc, 0x2f, 0xd0, 0x00, 0xfc, 0xbf, 0x40, 0x00, 0xfe,
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x40, 0x00, 0xfe,
+  0x2f, 0xc0, 0x00, 0xfc, 0x0f, 0xe0, 0x00, 0xfc, 0x07, 0xf4, 0x00, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+  0x00, 0xfe, 0xe8, 0x00,
 
   /*Unicode: U+006c (l) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0x00, 0x00,  //@@@@@@@@.....
-  0xff, 0xff, 0x00, 0x00,  //@@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x40, 0x00,  //.....@@@+....
-  0x00, 0x1f, 0xc0, 0x00,  //.....+@@@....
-  0x00, 0x0f, 0xff, 0xc0,  //......@@@@@@@
-  0x00, 0x01, 0xff, 0xc0,  //.......+@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf1, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x0e, 0x3f, 0x40, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00,
+  0x01, 0xff, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+006d (m) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfc, 0xf8, 0x7e, 0x00,  //@@@.@@%.+@@%.
-  0xff, 0xfe, 0xff, 0x40,  //@@@@@@@%@@@@+
-  0xfd, 0x7f, 0x5f, 0x80,  //@@@++@@@++@@%
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0xfc, 0x3f, 0x0f, 0xc0,  //@@@..@@@..@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd9, 0x00, 0x37, 0xfc, 0xf8, 0x7e, 0x00, 0xff, 0xfe, 0xff, 0x40, 0xfd, 0x7f, 0x5f, 0x80, 0xfc,
+  0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc,
+  0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc,
+  0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xfc, 0x3f, 0x0f, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+006e (n) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x6f, 0x80,  //@@@.+%@@%..
-  0xfd, 0xff, 0xf0,  //@@@+@@@@@@.
-  0xff, 0x43, 0xf8,  //@@@@+..@@@%
-  0xfe, 0x01, 0xfc,  //@@@%...+@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xe3, 0x00, 0x29, 0xfc, 0x6f, 0x80, 0xfd, 0xff, 0xf0, 0xff, 0x43, 0xf8, 0xfe, 0x01, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00,
+  0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+006f (o) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x29, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd, 0xbd,
+  0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00,
+  0x7e, 0x7e, 0x00, 0xbd, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0xfe, 0xff, 0xf0,  //@@@%@@@@@@..
-  0xff, 0x81, 0xfc,  //@@@@%..+@@@.
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xff, 0x41, 0xfc,  //@@@@+..+@@@.
-  0xfe, 0xff, 0xf4,  //@@@%@@@@@@+.
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x36, 0xfc, 0x7f, 0x80, 0xfe, 0xff, 0xf0, 0xff, 0x81, 0xfc, 0xfe, 0x00, 0xbd, 0xfd,
+  0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfd, 0x00,
+  0x7e, 0xfe, 0x00, 0xbd, 0xff, 0x41, 0xfc, 0xfe, 0xff, 0xf4, 0xfc, 0x7f, 0x80, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x0f, 0xff, 0xbf,  //..@@@@@@%@@@
-  0x3f, 0x42, 0xff,  //.@@@+..%@@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7f,  //%@@+....+@@@
-  0x7e, 0x00, 0xbf,  //+@@%....%@@@
-  0x3f, 0x41, 0xff,  //.@@@+..+@@@@
-  0x1f, 0xff, 0xbf,  //.+@@@@@@%@@@
-  0x02, 0xfd, 0x3f,  //...%@@@+.@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x38, 0x02, 0xfd, 0x3f, 0x0f, 0xff, 0xbf, 0x3f, 0x42, 0xff, 0x7e, 0x00, 0xbf, 0xbd,
+  0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00,
+  0x7f, 0x7e, 0x00, 0xbf, 0x3f, 0x41, 0xff, 0x1f, 0xff, 0xbf, 0x02, 0xfd, 0x3f, 0x00, 0x00, 0x3f,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0xfe, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xfc, 0x2f, 0xd0,  //@@@..%@@@+
-  0xfc, 0xff, 0xf0,  //@@@.@@@@@@
-  0xff, 0xd0, 0x20,  //@@@@@+...%
-  0xff, 0x00, 0x00,  //@@@@......
-  0xfd, 0x00, 0x00,  //@@@+......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x27, 0xfc, 0x2f, 0xd0, 0xfc, 0xff, 0xf0, 0xff, 0xd0, 0x20, 0xff, 0x00, 0x00, 0xfd,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xed, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x0b, 0xfe, 0x00,  //..%@@@@%..
-  0x3f, 0xff, 0xc0,  //.@@@@@@@@.
-  0xbe, 0x01, 0x80,  //%@@%...+%.
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfe, 0x40, 0x00,  //@@@%+.....
-  0xbf, 0xf9, 0x00,  //%@@@@@%+..
-  0x3f, 0xff, 0xc0,  //.@@@@@@@@.
-  0x06, 0xff, 0xe0,  //..+%@@@@@%
-  0x00, 0x0f, 0xf0,  //......@@@@
-  0x00, 0x03, 0xf0,  //.......@@@
-  0x00, 0x03, 0xf0,  //.......@@@
-  0xd0, 0x0f, 0xe0,  //@+....@@@%
-  0xff, 0xff, 0xc0,  //@@@@@@@@@.
-  0x1f, 0xfd, 0x00,  //.+@@@@@+..
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x28, 0x0b, 0xfe, 0x00, 0x3f, 0xff, 0xc0, 0xbe, 0x01, 0x80, 0xfc, 0x00, 0x00, 0xfe,
+  0x40, 0x00, 0xbf, 0xf9, 0x00, 0x3f, 0xff, 0xc0, 0x06, 0xff, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x03, 0xf0, 0xd0, 0x0f, 0xe0, 0xff, 0xff, 0xc0, 0x1f, 0xfd, 0xee, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xfc, 0x00,  //....@@@.....
-  0x00, 0xbe, 0x00,  //....%@@%....
-  0x00, 0x3f, 0xff,  //.....@@@@@@@
-  0x00, 0x0b, 0xff,  //......%@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xee, 0x00, 0x0a, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfb, 0xff,
+  0x23, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xbe, 0x00, 0x00,
+  0x3f, 0xff, 0x00, 0x0b, 0xff, 0xef, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfd, 0x02, 0xfc,  //@@@+...%@@@
-  0xbf, 0x07, 0xfc,  //%@@@..+@@@@
-  0x3f, 0xfd, 0xfc,  //.@@@@@@+@@@
-  0x0b, 0xe4, 0xfc,  //..%@@%+.@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xe3, 0x00, 0x29, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00,
+  0xfc, 0xfd, 0x02, 0xfc, 0xbf, 0x07, 0xfc, 0x3f, 0xfd, 0xfc, 0x0b, 0xe4, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfd, 0x00, 0x1f, 0xc0,  //@@@+.....+@@@
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x2f, 0x40, 0x7e, 0x00,  //.%@@+...+@@%.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0f, 0xc0, 0xfc, 0x00,  //..@@@...@@@..
-  0x0b, 0xe2, 0xf8, 0x00,  //..%@@%.%@@%..
-  0x07, 0xf3, 0xf4, 0x00,  //..+@@@.@@@+..
-  0x03, 0xf7, 0xf0, 0x00,  //...@@@+@@@...
-  0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%...
-  0x00, 0xff, 0xc0, 0x00,  //....@@@@@....
-  0x00, 0xff, 0xc0, 0x00,  //....@@@@@....
-  0x00, 0xbf, 0x80, 0x00,  //....%@@@%....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd9, 0x00, 0x35, 0xfd, 0x00, 0x1f, 0xc0, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x2f,
+  0x40, 0x7e, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0b, 0xe2, 0xf8, 0x00, 0x07,
+  0xf3, 0xf4, 0x00, 0x03, 0xf7, 0xf0, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00,
+  0xff, 0xc0, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x3f, 0xe7, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0xfc, 0x00, 0x00, 0x3f,  //@@@..........@@@
-  0xbd, 0x00, 0x00, 0x7e,  //%@@+........+@@%
-  0x7e, 0x00, 0x00, 0xbd,  //+@@%........%@@+
-  0x3f, 0x00, 0x00, 0xfc,  //.@@@........@@@.
-  0x3f, 0x03, 0xc0, 0xfc,  //.@@@...@@...@@@.
-  0x2f, 0x47, 0xd1, 0xf8,  //.%@@+.+@@+.+@@%.
-  0x1f, 0x8b, 0xe2, 0xf4,  //.+@@%.%@@%.%@@+.
-  0x0f, 0xce, 0xb3, 0xf0,  //..@@@.@%%@.@@@..
-  0x0f, 0xdd, 0x77, 0xf0,  //..@@@+@++@+@@@..
-  0x0b, 0xfc, 0x3f, 0xe0,  //..%@@@@..@@@@%..
-  0x07, 0xf8, 0x2f, 0xd0,  //..+@@@%..%@@@+..
-  0x03, 0xf4, 0x1f, 0xc0,  //...@@@+..+@@@...
-  0x03, 0xf0, 0x0f, 0xc0,  //...@@@....@@@...
-  0x02, 0xf0, 0x0f, 0x80,  //...%@@....@@%...
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-
+  0xd9, 0x00, 0x37, 0xfc, 0x00, 0x00, 0x3f, 0xbd, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0xbd, 0x3f,
+  0x00, 0x00, 0xfc, 0x3f, 0x03, 0xc0, 0xfc, 0x2f, 0x47, 0xd1, 0xf8, 0x1f, 0x8b, 0xe2, 0xf4, 0x0f,
+  0xce, 0xb3, 0xf0, 0x0f, 0xdd, 0x77, 0xf0, 0x0b, 0xfc, 0x3f, 0xe0, 0x07, 0xf8, 0x2f, 0xd0, 0x03,
+  0xf4, 0x1f, 0xc0, 0x03, 0xf0, 0x0f, 0xc0, 0x02, 0xf0, 0x0f, 0x80, 0xe9, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x2f, 0xc0, 0x3f, 0x80,  //.%@@@....@@@%.
-  0x0f, 0xe0, 0xff, 0x00,  //..@@@%..@@@@..
-  0x03, 0xf5, 0xfc, 0x00,  //...@@@++@@@...
-  0x01, 0xff, 0xf4, 0x00,  //...+@@@@@@+...
-  0x00, 0xff, 0xf0, 0x00,  //....@@@@@@....
-  0x00, 0x3f, 0xc0, 0x00,  //.....@@@@.....
-  0x00, 0x1f, 0x40, 0x00,  //.....+@@+.....
-  0x00, 0x3f, 0xc0, 0x00,  //.....@@@@.....
-  0x00, 0xbf, 0xe0, 0x00,  //....%@@@@%....
-  0x01, 0xff, 0xf4, 0x00,  //...+@@@@@@+...
-  0x03, 0xfa, 0xfc, 0x00,  //...@@@%%@@@...
-  0x0f, 0xf0, 0xff, 0x00,  //..@@@@..@@@@..
-  0x3f, 0xc0, 0x3f, 0xc0,  //.@@@@....@@@@.
-  0xbf, 0x00, 0x0f, 0xe0,  //%@@@......@@@%
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xd9, 0x00, 0x37, 0x2f, 0xc0, 0x3f, 0x80, 0x0f, 0xe0, 0xff, 0x00, 0x03, 0xf5, 0xfc, 0x00, 0x01,
+  0xff, 0xf4, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00,
+  0x3f, 0xc0, 0x00, 0x00, 0xbf, 0xe0, 0x00, 0x01, 0xff, 0xf4, 0x00, 0x03, 0xfa, 0xfc, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0xbf, 0x00, 0x0f, 0xe0, 0xe9, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfd, 0x00, 0x1f, 0xc0,  //@@@+.....+@@@
-  0x7f, 0x00, 0x3f, 0x40,  //+@@@.....@@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x2f, 0x80, 0xbe, 0x00,  //.%@@%...%@@%.
-  0x0f, 0xc0, 0xfc, 0x00,  //..@@@...@@@..
-  0x0f, 0xd1, 0xfc, 0x00,  //..@@@+.+@@@..
-  0x07, 0xf3, 0xf4, 0x00,  //..+@@@.@@@+..
-  0x03, 0xf7, 0xf0, 0x00,  //...@@@+@@@...
-  0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%...
-  0x00, 0xff, 0xd0, 0x00,  //....@@@@@+...
-  0x00, 0xff, 0xc0, 0x00,  //....@@@@@....
-  0x00, 0x7f, 0x40, 0x00,  //....+@@@+....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x7e, 0x00, 0x00,  //....+@@%.....
-  0x00, 0xfd, 0x00, 0x00,  //....@@@+.....
-  0x01, 0xfc, 0x00, 0x00,  //...+@@@......
-  0x03, 0xf8, 0x00, 0x00,  //...@@@%......
-  0x3f, 0xf0, 0x00, 0x00,  //.@@@@@.......
-  0x3f, 0x80, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd9, 0x00, 0x31, 0xfd, 0x00, 0x1f, 0xc0, 0x7f, 0x00, 0x3f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x2f,
+  0x80, 0xbe, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xd1, 0xfc, 0x00, 0x07, 0xf3, 0xf4, 0x00, 0x03,
+  0xf7, 0xf0, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00,
+  0x7f, 0x40, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x01,
+  0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0x80, 0xfb, 0x00,
 
   /*Unicode: U+007a (z) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x07, 0xf8,  //......+@@@%
-  0x00, 0x0f, 0xf0,  //......@@@@.
-  0x00, 0x2f, 0xc0,  //.....%@@@..
-  0x00, 0x7f, 0x40,  //....+@@@+..
-  0x00, 0xfe, 0x00,  //....@@@%...
-  0x03, 0xfc, 0x00,  //...@@@@....
-  0x0b, 0xf0, 0x00,  //..%@@@.....
-  0x1f, 0xd0, 0x00,  //.+@@@+.....
-  0x3f, 0x80, 0x00,  //.@@@%......
-  0xbf, 0x00, 0x00,  //%@@@.......
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xe3, 0x00, 0x29, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xf8, 0x00, 0x0f, 0xf0, 0x00,
+  0x2f, 0xc0, 0x00, 0x7f, 0x40, 0x00, 0xfe, 0x00, 0x03, 0xfc, 0x00, 0x0b, 0xf0, 0x00, 0x1f, 0xd0,
+  0x00, 0x3f, 0x80, 0x00, 0xbf, 0x00, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+007b ({) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x0b, 0xfc,  //......%@@@@
-  0x00, 0x3f, 0xfc,  //.....@@@@@@
-  0x00, 0xbe, 0x00,  //....%@@%...
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x01, 0xfc, 0x00,  //...+@@@....
-  0x03, 0xf4, 0x00,  //...@@@+....
-  0xff, 0xd0, 0x00,  //@@@@@+.....
-  0xff, 0xd0, 0x00,  //@@@@@+.....
-  0x07, 0xf4, 0x00,  //..+@@@+....
-  0x01, 0xfc, 0x00,  //...+@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xbe, 0x00,  //....%@@%...
-  0x00, 0x3f, 0xfc,  //.....@@@@@@
-  0x00, 0x0b, 0xfc,  //......%@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf4, 0x00, 0x46, 0x0b, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0xbe, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00,
+  0x03, 0xf4, 0x00, 0xff, 0xd0, 0x00, 0xff, 0xd0, 0x00, 0x07, 0xf4, 0x00, 0x01, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xbe, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x0b, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-
+  0xfd, 0x00, 0xe7, 0xf0,
 
   /*Unicode: U+007d (}) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0x80, 0x00,  //@@@@%......
-  0xff, 0xf0, 0x00,  //@@@@@@.....
-  0x02, 0xf8, 0x00,  //...%@@%....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfd, 0x00,  //....@@@+...
-  0x00, 0x7f, 0x00,  //....+@@@...
-  0x00, 0x1f, 0xfc,  //.....+@@@@@
-  0x00, 0x1f, 0xfc,  //.....+@@@@@
-  0x00, 0x7f, 0x40,  //....+@@@+..
-  0x00, 0xfd, 0x00,  //....@@@+...
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x02, 0xf8, 0x00,  //...%@@%....
-  0xff, 0xf0, 0x00,  //@@@@@@.....
-  0xff, 0x80, 0x00,  //@@@@%......
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x46, 0xff, 0x80, 0x00, 0xff, 0xf0, 0x00, 0x02, 0xf8, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfd,
+  0x00, 0x00, 0x7f, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x1f, 0xfc, 0x00, 0x7f, 0x40, 0x00, 0xfd, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x02, 0xf8, 0x00, 0xff, 0xf0, 0x00, 0xff, 0x80, 0xfa, 0x00,
 
   /*Unicode: U+007e (~) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x1f, 0xe0, 0x00, 0x40,  //.+@@@%......+
-  0xbf, 0xfe, 0x02, 0xc0,  //%@@@@@@%...%@
-  0xe0, 0x1f, 0xff, 0x80,  //@%...+@@@@@@%
-  0x40, 0x01, 0xfd, 0x00,  //+......+@@@+.
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0xc9, 0x00, 0x0e, 0x1f, 0xe0, 0x00, 0x40, 0xbf, 0xfe, 0x02, 0xc0, 0xe0, 0x1f, 0xff, 0x80, 0x40,
+  0x01, 0xfd, 0xd0, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 4
   /*Unicode: U+0020 ( ) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x89, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xef, 0xe0,  //@@@
-  0xdf, 0xd0,  //@@@
-  0xcf, 0xc0,  //@@@
-  0xbf, 0xb0,  //%@%
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xf7, 0x00, 0x19, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xef, 0xe0, 0xdf, 0xd0, 0xcf, 0xc0, 0xbf, 0xb0, 0xfb, 0x00, 0x05,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+0022 (") , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0xff, 0x00, 0x0f, 0xf0,  //@@...@@
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xed, 0x00, 0x1b, 0xff, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0xf0, 0xb9,
+  0x00,
 
   /*Unicode: U+0023 (#) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x5f, 0xc0, 0x00, 0xff, 0x00,  //......+@@...@@..
-  0x00, 0x00, 0x00, 0x9f, 0x70, 0x05, 0xfc, 0x00,  //......%@+..+@@..
-  0x00, 0x00, 0x00, 0xdf, 0x30, 0x09, 0xf7, 0x00,  //......@@...%@+..
-  0x00, 0x00, 0x02, 0xfe, 0x00, 0x0d, 0xf3, 0x00,  //......@@...@@...
-  0x00, 0x00, 0x06, 0xfa, 0x00, 0x2f, 0xe0, 0x00,  //.....+@%...@@...
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0xef, 0x30, 0x00,  //.....@@...@@....
-  0x00, 0x00, 0x7f, 0xa0, 0x02, 0xfe, 0x00, 0x00,  //....+@%...@@....
-  0x00, 0x00, 0xbf, 0x50, 0x06, 0xfa, 0x00, 0x00,  //....%@+..+@%....
-  0x00, 0x00, 0xff, 0x10, 0x0b, 0xf5, 0x00, 0x00,  //....@@...%@+....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@+.
-  0x00, 0x0c, 0xf4, 0x00, 0x7f, 0x90, 0x00, 0x00,  //...@@+..+@%.....
-  0x00, 0x0f, 0xf0, 0x00, 0xcf, 0x50, 0x00, 0x00,  //...@@...@@+.....
-  0x00, 0x4f, 0xc0, 0x00, 0xff, 0x00, 0x00, 0x00,  //..+@@...@@......
-  0x00, 0x9f, 0x70, 0x04, 0xfc, 0x00, 0x00, 0x00,  //..%@+..+@@......
-  0x00, 0xdf, 0x30, 0x09, 0xf8, 0x00, 0x00, 0x00,  //..@@...%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xce, 0x00, 0x03, 0x5f, 0xc0, 0x00, 0xff, 0xfd, 0x00, 0x03, 0x9f, 0x70, 0x05, 0xfc, 0xfd, 0x00,
+  0x03, 0xdf, 0x30, 0x09, 0xf7, 0xfe, 0x00, 0x04, 0x02, 0xfe, 0x00, 0x0d, 0xf3, 0xfe, 0x00, 0x06,
+  0x06, 0xfa, 0x00, 0x2f, 0xe0, 0x00, 0x07, 0xfa, 0xff, 0x00, 0x07, 0xfa, 0xff, 0x06, 0x00, 0x00,
+  0x2f, 0xe0, 0x00, 0xef, 0x30, 0xfe, 0x00, 0x03, 0x7f, 0xa0, 0x02, 0xfe, 0xfd, 0x00, 0x03, 0xbf,
+  0x50, 0x06, 0xfa, 0xfd, 0x00, 0x05, 0xff, 0x10, 0x0b, 0xf5, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x70,
+  0xfa, 0xff, 0x06, 0x70, 0x00, 0x0c, 0xf4, 0x00, 0x7f, 0x90, 0xfe, 0x00, 0x04, 0x0f, 0xf0, 0x00,
+  0xcf, 0x50, 0xfe, 0x00, 0x03, 0x4f, 0xc0, 0x00, 0xff, 0xfd, 0x00, 0x03, 0x9f, 0x70, 0x04, 0xfc,
+  0xfd, 0x00, 0x03, 0xdf, 0x30, 0x09, 0xf8, 0xce, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x5b, 0xef, 0xeb, 0x72, 0x00,  //..+%@@@%+..
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%@@@@@@@@.
-  0x7f, 0xfc, 0x1f, 0x13, 0x7d, 0x00,  //+@@@.@..+@.
-  0xdf, 0xf3, 0x0f, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xef, 0xf1, 0x0f, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xaf, 0xf9, 0x0f, 0x00, 0x00, 0x00,  //%@@%.@.....
-  0x2f, 0xff, 0xef, 0x51, 0x00, 0x00,  //.@@@@@+....
-  0x03, 0xcf, 0xff, 0xff, 0xa1, 0x00,  //..@@@@@@%..
-  0x00, 0x03, 0x7f, 0xff, 0xfe, 0x10,  //....+@@@@@.
-  0x00, 0x00, 0x0f, 0x0b, 0xff, 0x90,  //.....@.%@@%
-  0x00, 0x00, 0x0f, 0x02, 0xff, 0xe0,  //.....@..@@@
-  0x00, 0x00, 0x0f, 0x00, 0xff, 0xf0,  //.....@..@@@
-  0x00, 0x00, 0x0f, 0x02, 0xff, 0xd0,  //.....@..@@@
-  0xd8, 0x30, 0x0f, 0x1c, 0xff, 0x60,  //@%...@.@@@+
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0x00,  //@@@@@@@@@%.
-  0x26, 0xad, 0xff, 0xeb, 0x50, 0x00,  //.+%@@@@%+..
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe7, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x05, 0x5b,
+  0xef, 0xeb, 0x72, 0x00, 0x0a, 0xfd, 0xff, 0x09, 0x00, 0x7f, 0xfc, 0x1f, 0x13, 0x7d, 0x00, 0xdf,
+  0xf3, 0x0f, 0xfe, 0x00, 0x02, 0xff, 0xf0, 0x0f, 0xfe, 0x00, 0x02, 0xef, 0xf1, 0x0f, 0xfe, 0x00,
+  0x02, 0xaf, 0xf9, 0x0f, 0xfe, 0x00, 0x2f, 0x2f, 0xff, 0xef, 0x51, 0x00, 0x00, 0x03, 0xcf, 0xff,
+  0xff, 0xa1, 0x00, 0x00, 0x03, 0x7f, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x0f, 0x0b, 0xff, 0x90, 0x00,
+  0x00, 0x0f, 0x02, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x02, 0xff,
+  0xd0, 0xd8, 0x30, 0x0f, 0x1c, 0xff, 0x60, 0xfd, 0xff, 0x06, 0xfa, 0x00, 0x26, 0xad, 0xff, 0xeb,
+  0x50, 0xfe, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00,
+  0x0f, 0xf2, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x02, 0xbf, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x00,  //..%@@%.........
-  0x2f, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@........
-  0xbf, 0xb1, 0x1b, 0xfa, 0x00, 0x00, 0x00, 0x00,  //%@%..%@%.......
-  0xff, 0x10, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....@@.......
-  0xff, 0x10, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@....@@.......
-  0xbf, 0xa1, 0x1b, 0xfb, 0x00, 0x00, 0x04, 0x00,  //%@%..%@%.....+.
-  0x2f, 0xff, 0xff, 0xe2, 0x00, 0x04, 0xcf, 0x50,  //.@@@@@@....+@@+
-  0x02, 0xbf, 0xfb, 0x20, 0x04, 0xcf, 0xb3, 0x00,  //..%@@%...+@@%..
-  0x00, 0x00, 0x00, 0x04, 0xcf, 0xb3, 0x00, 0x00,  //.......+@@%....
-  0x00, 0x00, 0x03, 0xcf, 0xb3, 0x00, 0x00, 0x00,  //......@@%......
-  0x00, 0x03, 0xbf, 0xc4, 0x00, 0x00, 0x00, 0x00,  //....%@@+.......
-  0x03, 0xbf, 0xc4, 0x00, 0x2b, 0xff, 0xa2, 0x00,  //..%@@+...%@@%..
-  0x1f, 0xc4, 0x00, 0x02, 0xff, 0xff, 0xfe, 0x20,  //.@@+....@@@@@@.
-  0x03, 0x00, 0x00, 0x0b, 0xfb, 0x11, 0xbf, 0xa0,  //.......%@%..%@%
-  0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00, 0x1f, 0xf0,  //.......@@....@@
-  0x00, 0x00, 0x00, 0x0f, 0xf1, 0x00, 0x1f, 0xf0,  //.......@@....@@
-  0x00, 0x00, 0x00, 0x0b, 0xfb, 0x11, 0xbf, 0xb0,  //.......%@%..%@%
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfe, 0x20,  //........@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xb2, 0x00,  //.........%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x03, 0x02, 0xbf, 0xfa, 0x20, 0xfd, 0x00, 0x03, 0x2f, 0xff, 0xff, 0xe2, 0xfd, 0x00,
+  0x03, 0xbf, 0xb1, 0x1b, 0xfa, 0xfd, 0x00, 0x03, 0xff, 0x10, 0x01, 0xff, 0xfd, 0x00, 0x03, 0xff,
+  0x10, 0x01, 0xff, 0xfd, 0x00, 0x16, 0xbf, 0xa1, 0x1b, 0xfb, 0x00, 0x00, 0x04, 0x00, 0x2f, 0xff,
+  0xff, 0xe2, 0x00, 0x04, 0xcf, 0x50, 0x02, 0xbf, 0xfb, 0x20, 0x04, 0xcf, 0xb3, 0xfd, 0x00, 0x02,
+  0x04, 0xcf, 0xb3, 0xfd, 0x00, 0x02, 0x03, 0xcf, 0xb3, 0xfd, 0x00, 0x02, 0x03, 0xbf, 0xc4, 0xfd,
+  0x00, 0x17, 0x03, 0xbf, 0xc4, 0x00, 0x2b, 0xff, 0xa2, 0x00, 0x1f, 0xc4, 0x00, 0x02, 0xff, 0xff,
+  0xfe, 0x20, 0x03, 0x00, 0x00, 0x0b, 0xfb, 0x11, 0xbf, 0xa0, 0xfe, 0x00, 0x04, 0x0f, 0xf1, 0x00,
+  0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x0f, 0xf1, 0x00, 0x1f, 0xf0, 0xfe, 0x00, 0x04, 0x0b, 0xfb, 0x11,
+  0xbf, 0xb0, 0xfe, 0x00, 0x04, 0x02, 0xff, 0xff, 0xfe, 0x20, 0xfd, 0x00, 0x02, 0x2b, 0xff, 0xb2,
+  0xd0, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x02, 0xae, 0xfe, 0xa3, 0x00, 0x00, 0x00,  //....%@@@%......
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@@@@@.....
-  0x00, 0xbf, 0xfb, 0x20, 0x3a, 0x00, 0x00, 0x00,  //..%@@%...%.....
-  0x00, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@..........
-  0x00, 0xef, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@..........
-  0x00, 0x9f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@+.........
-  0x00, 0x1e, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.........
-  0x00, 0x0a, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,  //...%@@%........
-  0x00, 0xcf, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,  //..@@@@@+.......
-  0x0b, 0xfd, 0xaf, 0xff, 0x20, 0x00, 0x0f, 0xf0,  //.%@@%@@@.....@@
-  0x5f, 0xf3, 0x0d, 0xff, 0xc0, 0x00, 0x0f, 0xe0,  //+@@..@@@@....@@
-  0xbf, 0xf0, 0x02, 0xff, 0xf9, 0x00, 0x1f, 0xd0,  //%@@...@@@%...@@
-  0xef, 0xf0, 0x00, 0x6f, 0xff, 0x50, 0x5f, 0xa0,  //@@@...+@@@+.+@%
-  0xff, 0xf1, 0x00, 0x0a, 0xff, 0xf2, 0xcf, 0x50,  //@@@....%@@@.@@+
-  0xdf, 0xf5, 0x00, 0x00, 0xdf, 0xff, 0xfe, 0x00,  //@@@+....@@@@@@.
-  0x7f, 0xfd, 0x00, 0x00, 0x2f, 0xff, 0xf5, 0x00,  //+@@@.....@@@@+.
-  0x0d, 0xff, 0xd4, 0x00, 0x6f, 0xff, 0xf9, 0x00,  //.@@@@+..+@@@@%.
-  0x02, 0xdf, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x20,  //..@@@@@@@@%@@@.
-  0x00, 0x06, 0xcf, 0xfd, 0x91, 0x0b, 0xff, 0xb0,  //...+@@@@%..%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd8, 0x00, 0x03, 0x02, 0xae, 0xfe, 0xa3, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xfd, 0x00, 0x03,
+  0xbf, 0xfb, 0x20, 0x3a, 0xfd, 0x00, 0x01, 0xff, 0xf1, 0xfb, 0x00, 0x01, 0xef, 0xf1, 0xfb, 0x00,
+  0x01, 0x9f, 0xf6, 0xfb, 0x00, 0x01, 0x1e, 0xfe, 0xfb, 0x00, 0x02, 0x0a, 0xff, 0x90, 0xfc, 0x00,
+  0x02, 0xcf, 0xff, 0xf5, 0xfd, 0x00, 0x41, 0x0b, 0xfd, 0xaf, 0xff, 0x20, 0x00, 0x0f, 0xf0, 0x5f,
+  0xf3, 0x0d, 0xff, 0xc0, 0x00, 0x0f, 0xe0, 0xbf, 0xf0, 0x02, 0xff, 0xf9, 0x00, 0x1f, 0xd0, 0xef,
+  0xf0, 0x00, 0x6f, 0xff, 0x50, 0x5f, 0xa0, 0xff, 0xf1, 0x00, 0x0a, 0xff, 0xf2, 0xcf, 0x50, 0xdf,
+  0xf5, 0x00, 0x00, 0xdf, 0xff, 0xfe, 0x00, 0x7f, 0xfd, 0x00, 0x00, 0x2f, 0xff, 0xf5, 0x00, 0x0d,
+  0xff, 0xd4, 0x00, 0x6f, 0xff, 0xf9, 0x00, 0x02, 0xdf, 0xfe, 0xff, 0x0a, 0x8f, 0xff, 0x20, 0x00,
+  0x06, 0xcf, 0xfd, 0x91, 0x0b, 0xff, 0xb0, 0xd1, 0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xfa, 0xff, 0xef, 0x00,
 
   /*Unicode: U+0028 (() , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x02, 0xfc,  //....@@
-  0x00, 0x0c, 0xf4,  //...@@+
-  0x00, 0x6f, 0xd0,  //..+@@.
-  0x00, 0xef, 0x70,  //..@@+.
-  0x06, 0xff, 0x20,  //.+@@..
-  0x0d, 0xfc, 0x00,  //.@@@..
-  0x2f, 0xf9, 0x00,  //.@@%..
-  0x7f, 0xf6, 0x00,  //+@@+..
-  0xbf, 0xf3, 0x00,  //%@@...
-  0xdf, 0xf1, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xdf, 0xf1, 0x00,  //@@@...
-  0xbf, 0xf3, 0x00,  //%@@...
-  0x7f, 0xf6, 0x00,  //+@@+..
-  0x2f, 0xf9, 0x00,  //.@@%..
-  0x0d, 0xfd, 0x00,  //.@@@..
-  0x06, 0xff, 0x20,  //.+@@..
-  0x00, 0xef, 0x70,  //..@@+.
-  0x00, 0x6f, 0xd0,  //..+@@.
-  0x00, 0x0c, 0xf4,  //...@@+
-  0x00, 0x02, 0xfc,  //....@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf4, 0x00, 0x43, 0x02, 0xfc, 0x00, 0x0c, 0xf4, 0x00, 0x6f, 0xd0, 0x00, 0xef, 0x70, 0x06, 0xff,
+  0x20, 0x0d, 0xfc, 0x00, 0x2f, 0xf9, 0x00, 0x7f, 0xf6, 0x00, 0xbf, 0xf3, 0x00, 0xdf, 0xf1, 0x00,
+  0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xdf, 0xf1, 0x00, 0xbf, 0xf3, 0x00, 0x7f,
+  0xf6, 0x00, 0x2f, 0xf9, 0x00, 0x0d, 0xfd, 0x00, 0x06, 0xff, 0x20, 0x00, 0xef, 0x70, 0x00, 0x6f,
+  0xd0, 0x00, 0x0c, 0xf4, 0x00, 0x02, 0xfc, 0xf8, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0xcf, 0x20, 0x00,  //@@....
-  0x4f, 0xc0, 0x00,  //+@@...
-  0x0d, 0xf6, 0x00,  //.@@+..
-  0x07, 0xfe, 0x00,  //.+@@..
-  0x02, 0xff, 0x60,  //..@@+.
-  0x00, 0xdf, 0xd0,  //..@@@.
-  0x00, 0x9f, 0xf2,  //..%@@.
-  0x00, 0x6f, 0xf7,  //..+@@+
-  0x00, 0x3f, 0xfb,  //...@@%
-  0x00, 0x2f, 0xfd,  //...@@@
-  0x00, 0x1f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x1f, 0xff,  //...@@@
-  0x00, 0x2f, 0xfd,  //...@@@
-  0x00, 0x3f, 0xfb,  //...@@%
-  0x00, 0x6f, 0xf7,  //..+@@+
-  0x00, 0x9f, 0xf2,  //..%@@.
-  0x00, 0xdf, 0xd0,  //..@@@.
-  0x02, 0xff, 0x60,  //..@@+.
-  0x07, 0xfe, 0x00,  //.+@@..
-  0x0d, 0xf6, 0x00,  //.@@+..
-  0x5f, 0xc0, 0x00,  //+@@...
-  0xcf, 0x20, 0x00,  //@@....
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf5, 0x00, 0x43, 0xcf, 0x20, 0x00, 0x4f, 0xc0, 0x00, 0x0d, 0xf6, 0x00, 0x07, 0xfe, 0x00, 0x02,
+  0xff, 0x60, 0x00, 0xdf, 0xd0, 0x00, 0x9f, 0xf2, 0x00, 0x6f, 0xf7, 0x00, 0x3f, 0xfb, 0x00, 0x2f,
+  0xfd, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x2f, 0xfd, 0x00, 0x3f, 0xfb,
+  0x00, 0x6f, 0xf7, 0x00, 0x9f, 0xf2, 0x00, 0xdf, 0xd0, 0x02, 0xff, 0x60, 0x07, 0xfe, 0x00, 0x0d,
+  0xf6, 0x00, 0x5f, 0xc0, 0x00, 0xcf, 0x20, 0xf7, 0x00,
 
   /*Unicode: U+002a (*) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x87, 0x00, 0x0f, 0x00, 0x07, 0x80,  //%+...@...+%
-  0x9f, 0xd3, 0x0f, 0x03, 0xdf, 0x90,  //%@@..@..@@%
-  0x03, 0xcf, 0x8f, 0x8f, 0xc3, 0x00,  //..@@%@%@@..
-  0x00, 0x06, 0xef, 0xe6, 0x00, 0x00,  //...+@@@+...
-  0x00, 0x06, 0xef, 0xe6, 0x00, 0x00,  //...+@@@+...
-  0x03, 0xcf, 0x8f, 0x8f, 0xc3, 0x00,  //..@@%@%@@..
-  0x9f, 0xd3, 0x0f, 0x03, 0xdf, 0x90,  //%@@..@..@@%
-  0x87, 0x00, 0x0f, 0x00, 0x07, 0x80,  //%+...@...+%
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe1, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x15, 0x87, 0x00, 0x0f, 0x00, 0x07,
+  0x80, 0x9f, 0xd3, 0x0f, 0x03, 0xdf, 0x90, 0x03, 0xcf, 0x8f, 0x8f, 0xc3, 0x00, 0x00, 0x06, 0xef,
+  0xe6, 0xfe, 0x00, 0x19, 0x06, 0xef, 0xe6, 0x00, 0x00, 0x03, 0xcf, 0x8f, 0x8f, 0xc3, 0x00, 0x9f,
+  0xd3, 0x0f, 0x03, 0xdf, 0x90, 0x87, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0f, 0xfc, 0x00,
+  0x00, 0x0f, 0xb0, 0x00,
 
   /*Unicode: U+002b (+) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xbf, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xf3, 0xff, 0xfe, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xcd, 0x00,
 
   /*Unicode: U+002c (,) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xfe,  //.@@@
-  0x3f, 0xf8,  //.@@%
-  0x7f, 0xf1,  //+@@.
-  0xaf, 0xa0,  //%@%.
-  0xef, 0x30,  //@@..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xd9, 0x00, 0x0d, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xfe, 0x3f, 0xf8, 0x7f, 0xf1, 0xaf, 0xa0, 0xef,
+  0x30, 0xfb, 0x00,
 
   /*Unicode: U+002d (-) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xc1, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff, 0x00, 0xf0, 0xd1, 0x00,
 
   /*Unicode: U+002e (.) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xd9, 0x00, 0x07, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+002f (/) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0,  //..........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x40,  //.........%@@+
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0xaf, 0xf5, 0x00,  //........%@@+.
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xd0, 0x00,  //........@@@..
-  0x00, 0x00, 0x00, 0x09, 0xff, 0x60, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x9f, 0xf6, 0x00, 0x00,  //......%@@+...
-  0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,  //......@@@....
-  0x00, 0x00, 0x08, 0xff, 0x70, 0x00, 0x00,  //.....%@@+....
-  0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0xef, 0xf1, 0x00, 0x00, 0x00,  //....@@@......
-  0x00, 0x06, 0xff, 0x90, 0x00, 0x00, 0x00,  //...+@@%......
-  0x00, 0x0e, 0xff, 0x10, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x6f, 0xf9, 0x00, 0x00, 0x00, 0x00,  //..+@@%.......
-  0x00, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //..@@@........
-  0x05, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00,  //.+@@%........
-  0x0c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x4f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0xcf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xda, 0x00, 0x02, 0x03, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0x40, 0xfd, 0x00, 0x01, 0x3f,
+  0xfc, 0xfc, 0x00, 0x01, 0xaf, 0xf5, 0xfd, 0x00, 0x02, 0x02, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x09,
+  0xff, 0x60, 0xfd, 0x00, 0x01, 0x1f, 0xfe, 0xfc, 0x00, 0x01, 0x9f, 0xf6, 0xfd, 0x00, 0x02, 0x01,
+  0xff, 0xe0, 0xfd, 0x00, 0x02, 0x08, 0xff, 0x70, 0xfd, 0x00, 0x01, 0x0f, 0xfe, 0xfc, 0x00, 0x01,
+  0x7f, 0xf8, 0xfc, 0x00, 0x01, 0xef, 0xf1, 0xfd, 0x00, 0x02, 0x06, 0xff, 0x90, 0xfd, 0x00, 0x02,
+  0x0e, 0xff, 0x10, 0xfd, 0x00, 0x01, 0x6f, 0xf9, 0xfc, 0x00, 0x01, 0xdf, 0xf2, 0xfd, 0x00, 0x02,
+  0x05, 0xff, 0xa0, 0xfd, 0x00, 0x02, 0x0c, 0xff, 0x20, 0xfd, 0x00, 0x01, 0x4f, 0xfb, 0xfc, 0x00,
+  0x01, 0xcf, 0xf3, 0xe0, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x06, 0xcf, 0xfc, 0x60, 0x00,  //...+@@@@+...
-  0x00, 0xbf, 0xff, 0xff, 0xfa, 0x00,  //..%@@@@@@%..
-  0x08, 0xff, 0xa1, 0x1a, 0xff, 0x70,  //.%@@%..%@@+.
-  0x1f, 0xfe, 0x00, 0x00, 0xef, 0xf0,  //.@@@....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x8f, 0xf5,  //+@@%....%@@+
-  0xaf, 0xf4, 0x00, 0x00, 0x4f, 0xf9,  //%@@+....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x2f, 0xfc,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x8f, 0x80, 0x0f, 0xff,  //@@@.%@%..@@@
-  0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff,  //@@@.@@@..@@@
-  0xff, 0xf0, 0x8f, 0x80, 0x0f, 0xff,  //@@@.%@%..@@@
-  0xef, 0xf0, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x2f, 0xfc,  //@@@......@@@
-  0xaf, 0xf4, 0x00, 0x00, 0x4f, 0xf9,  //%@@+....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x8f, 0xf5,  //+@@%....%@@+
-  0x1f, 0xfe, 0x00, 0x00, 0xef, 0xf0,  //.@@@....@@@.
-  0x08, 0xff, 0xa1, 0x1a, 0xff, 0x70,  //.%@@%..%@@+.
-  0x00, 0xbf, 0xff, 0xff, 0xfb, 0x00,  //..%@@@@@@%..
-  0x00, 0x06, 0xcf, 0xfc, 0x60, 0x00,  //...+@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x6f, 0x06, 0xcf, 0xfc, 0x60, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfa, 0x00, 0x08, 0xff,
+  0xa1, 0x1a, 0xff, 0x70, 0x1f, 0xfe, 0x00, 0x00, 0xef, 0xf0, 0x5f, 0xf8, 0x00, 0x00, 0x8f, 0xf5,
+  0xaf, 0xf4, 0x00, 0x00, 0x4f, 0xf9, 0xcf, 0xf2, 0x00, 0x00, 0x2f, 0xfc, 0xef, 0xf0, 0x00, 0x00,
+  0x1f, 0xfe, 0xff, 0xf0, 0x8f, 0x80, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0,
+  0x8f, 0x80, 0x0f, 0xff, 0xef, 0xf0, 0x00, 0x00, 0x1f, 0xfe, 0xcf, 0xf2, 0x00, 0x00, 0x2f, 0xfc,
+  0xaf, 0xf4, 0x00, 0x00, 0x4f, 0xf9, 0x5f, 0xf8, 0x00, 0x00, 0x8f, 0xf5, 0x1f, 0xfe, 0x00, 0x00,
+  0xef, 0xf0, 0x08, 0xff, 0xa1, 0x1a, 0xff, 0x70, 0x00, 0xbf, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x06,
+  0xcf, 0xfc, 0x60, 0xdc, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x15, 0x9c, 0xff, 0xf0, 0x00, 0x00,  //.+%@@@@....
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //@@@@@@@....
-  0xd9, 0x51, 0xff, 0xf0, 0x00, 0x00,  //@%+.@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe3, 0x00, 0x05, 0x15, 0x9c, 0xff, 0xf0, 0x00, 0x00, 0xfe, 0xff, 0x06, 0xf0, 0x00, 0x00, 0xd9,
+  0x51, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc,
+  0xff, 0x00, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x27, 0xbd, 0xff, 0xec, 0x71, 0x00, 0x00,  //.+%@@@@@+....
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x00,  //@@@@@@@@@@...
-  0xff, 0xa4, 0x10, 0x29, 0xff, 0xf2, 0x00,  //@@%+...%@@@..
-  0xb2, 0x00, 0x00, 0x00, 0x9f, 0xfa, 0x00,  //%.......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xfe, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0x10,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x00,  //........%@@@.
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xf9, 0x00,  //........@@@%.
-  0x00, 0x00, 0x00, 0x0d, 0xff, 0xe1, 0x00,  //.......@@@@..
-  0x00, 0x00, 0x00, 0xbf, 0xff, 0x40, 0x00,  //......%@@@+..
-  0x00, 0x00, 0x0b, 0xff, 0xf6, 0x00, 0x00,  //.....%@@@+...
-  0x00, 0x00, 0xaf, 0xff, 0x70, 0x00, 0x00,  //....%@@@+....
-  0x00, 0x09, 0xff, 0xf6, 0x00, 0x00, 0x00,  //...%@@@+.....
-  0x00, 0x9f, 0xfe, 0x40, 0x00, 0x00, 0x00,  //..%@@@+......
-  0x08, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00,  //.%@@@........
-  0x8f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,  //@@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,  //@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xde, 0x00, 0x06, 0x27, 0xbd, 0xff, 0xec, 0x71, 0x00, 0x00, 0xfd, 0xff, 0x0a, 0xfe, 0x30, 0x00,
+  0xff, 0xa4, 0x10, 0x29, 0xff, 0xf2, 0x00, 0xb2, 0xfe, 0x00, 0x01, 0x9f, 0xfa, 0xfc, 0x00, 0x01,
+  0x2f, 0xfe, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x02, 0x2f, 0xff, 0x10, 0xfd, 0x00, 0x01,
+  0x8f, 0xff, 0xfd, 0x00, 0x02, 0x02, 0xff, 0xf9, 0xfd, 0x00, 0x02, 0x0d, 0xff, 0xe1, 0xfd, 0x00,
+  0x02, 0xbf, 0xff, 0x40, 0xfe, 0x00, 0x02, 0x0b, 0xff, 0xf6, 0xfd, 0x00, 0x02, 0xaf, 0xff, 0x70,
+  0xfe, 0x00, 0x02, 0x09, 0xff, 0xf6, 0xfd, 0x00, 0x02, 0x9f, 0xfe, 0x40, 0xfe, 0x00, 0x02, 0x08,
+  0xff, 0xc1, 0xfd, 0x00, 0x01, 0x8f, 0xf7, 0xfc, 0x00, 0xfb, 0xff, 0x00, 0x10, 0xfb, 0xff, 0x00,
+  0x10, 0xd7, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x6a, 0xdf, 0xfd, 0x92, 0x00,  //..+%@@@@%...
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x60,  //.@@@@@@@@@+.
-  0x0d, 0x73, 0x10, 0x17, 0xff, 0xf4,  //.@+....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0xfa,  //........+@@%
-  0x00, 0x00, 0x00, 0x28, 0xff, 0xd1,  //.......%@@@.
-  0x00, 0x0f, 0xff, 0xff, 0xd7, 0x00,  //...@@@@@@+..
-  0x00, 0x0f, 0xff, 0xff, 0xd7, 0x00,  //...@@@@@@+..
-  0x00, 0x00, 0x00, 0x3b, 0xff, 0xb0,  //.......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf8,  //........%@@%
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xfd,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xfe,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x9f, 0xfa,  //........%@@%
-  0xd7, 0x31, 0x01, 0x3a, 0xff, 0xf3,  //@+.....%@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x50,  //@@@@@@@@@@+.
-  0x26, 0xbd, 0xff, 0xec, 0x71, 0x00,  //.+%@@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x06, 0x02, 0x6a, 0xdf, 0xfd, 0x92, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x60, 0x0d, 0x73,
+  0x10, 0x17, 0xff, 0xf4, 0xfd, 0x00, 0x01, 0x6f, 0xfc, 0xfd, 0x00, 0x01, 0x1f, 0xff, 0xfd, 0x00,
+  0x01, 0x0f, 0xfe, 0xfd, 0x00, 0x01, 0x6f, 0xfa, 0xfe, 0x00, 0x0d, 0x28, 0xff, 0xd1, 0x00, 0x0f,
+  0xff, 0xff, 0xd7, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xd7, 0xfd, 0x00, 0x02, 0x3b, 0xff, 0xb0, 0xfd,
+  0x00, 0x01, 0x9f, 0xf8, 0xfd, 0x00, 0x01, 0x2f, 0xfd, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00,
+  0x01, 0x2f, 0xfe, 0xfd, 0x00, 0x07, 0x9f, 0xfa, 0xd7, 0x31, 0x01, 0x3a, 0xff, 0xf3, 0xfc, 0xff,
+  0x05, 0x50, 0x26, 0xbd, 0xff, 0xec, 0x71, 0xdc, 0x00,
 
   /*Unicode: U+0034 (4) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x2f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x00,  //......%@@@...
-  0x00, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,  //.....+@@@@...
-  0x00, 0x00, 0x0e, 0xdf, 0xff, 0x00, 0x00,  //.....@@@@@...
-  0x00, 0x00, 0x9f, 0x5f, 0xff, 0x00, 0x00,  //....%@+@@@...
-  0x00, 0x03, 0xfc, 0x0f, 0xff, 0x00, 0x00,  //....@@.@@@...
-  0x00, 0x0c, 0xf3, 0x0f, 0xff, 0x00, 0x00,  //...@@..@@@...
-  0x00, 0x7f, 0x90, 0x0f, 0xff, 0x00, 0x00,  //..+@%..@@@...
-  0x01, 0xff, 0x10, 0x0f, 0xff, 0x00, 0x00,  //..@@...@@@...
-  0x0a, 0xf7, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.%@+...@@@...
-  0x4f, 0xd0, 0x00, 0x0f, 0xff, 0x00, 0x00,  //+@@....@@@...
-  0xdf, 0x50, 0x00, 0x0f, 0xff, 0x00, 0x00,  //@@+....@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdb, 0x00, 0x01, 0x2f, 0xff, 0xfc, 0x00, 0x01, 0xbf, 0xff, 0xfd, 0x00, 0x02, 0x05, 0xff, 0xff,
+  0xfd, 0x00, 0x02, 0x0e, 0xdf, 0xff, 0xfd, 0x00, 0x02, 0x9f, 0x5f, 0xff, 0xfe, 0x00, 0x03, 0x03,
+  0xfc, 0x0f, 0xff, 0xfe, 0x00, 0x03, 0x0c, 0xf3, 0x0f, 0xff, 0xfe, 0x00, 0x21, 0x7f, 0x90, 0x0f,
+  0xff, 0x00, 0x00, 0x01, 0xff, 0x10, 0x0f, 0xff, 0x00, 0x00, 0x0a, 0xf7, 0x00, 0x0f, 0xff, 0x00,
+  0x00, 0x4f, 0xd0, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xdf, 0x50, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xfb,
+  0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f,
+  0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xd5, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@.
-  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x0f, 0xff, 0xcf, 0xfd, 0x81, 0x00,  //.@@@@@@@%...
-  0x0f, 0xff, 0xff, 0xff, 0xfe, 0x20,  //.@@@@@@@@@..
-  0x0b, 0x51, 0x01, 0x5d, 0xff, 0xd0,  //.%+...+@@@@.
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0xf7,  //........@@@+
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x5f, 0xfb,  //........+@@%
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5,  //........@@@+
-  0xc7, 0x31, 0x01, 0x5d, 0xff, 0xc0,  //@+....+@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,  //@@@@@@@@@%..
-  0x38, 0xce, 0xff, 0xea, 0x50, 0x00,  //.%@@@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x01, 0xf0, 0x0f, 0xfd, 0xff, 0x02, 0xf0, 0x0f, 0xff, 0xfd,
+  0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00,
+  0x06, 0x0f, 0xff, 0xcf, 0xfd, 0x81, 0x00, 0x0f, 0xfe, 0xff, 0x07, 0xfe, 0x20, 0x0b, 0x51, 0x01,
+  0x5d, 0xff, 0xd0, 0xfd, 0x00, 0x01, 0xdf, 0xf7, 0xfd, 0x00, 0x01, 0x5f, 0xfc, 0xfd, 0x00, 0x01,
+  0x1f, 0xfe, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x1f, 0xfe, 0xfd, 0x00, 0x01, 0x5f,
+  0xfb, 0xfd, 0x00, 0x07, 0xdf, 0xf5, 0xc7, 0x31, 0x01, 0x5d, 0xff, 0xc0, 0xfd, 0xff, 0x06, 0xfb,
+  0x10, 0x38, 0xce, 0xff, 0xea, 0x50, 0xdc, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x01, 0x7c, 0xef, 0xd9, 0x30,  //....+@@@@%..
-  0x00, 0x4e, 0xff, 0xff, 0xff, 0xf0,  //..+@@@@@@@@.
-  0x02, 0xff, 0xf9, 0x20, 0x15, 0xc0,  //..@@@%...+@.
-  0x0c, 0xff, 0x80, 0x00, 0x00, 0x00,  //.@@@%.......
-  0x3f, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //%@@%........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xef, 0xf1, 0x4c, 0xfe, 0xb5, 0x00,  //@@@.+@@@%+..
-  0xff, 0xf5, 0xff, 0xff, 0xff, 0x80,  //@@@+@@@@@@%.
-  0xff, 0xfe, 0x71, 0x06, 0xff, 0xf3,  //@@@@+..+@@@.
-  0xff, 0xf9, 0x00, 0x00, 0x8f, 0xfa,  //@@@%....%@@%
-  0xef, 0xf3, 0x00, 0x00, 0x2f, 0xfd,  //@@@......@@@
-  0xcf, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xaf, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //%@@......@@@
-  0x6f, 0xf3, 0x00, 0x00, 0x2f, 0xfd,  //+@@......@@@
-  0x1f, 0xf9, 0x00, 0x00, 0x8f, 0xf9,  //.@@%....%@@%
-  0x09, 0xff, 0x71, 0x16, 0xff, 0xf2,  //.%@@+..+@@@.
-  0x00, 0xcf, 0xff, 0xff, 0xff, 0x60,  //..@@@@@@@@+.
-  0x00, 0x06, 0xce, 0xfe, 0xa3, 0x00,  //...+@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x06, 0x01, 0x7c, 0xef, 0xd9, 0x30, 0x00, 0x4e, 0xfe, 0xff, 0x09, 0xf0, 0x02, 0xff,
+  0xf9, 0x20, 0x15, 0xc0, 0x0c, 0xff, 0x80, 0xfe, 0x00, 0x01, 0x3f, 0xfd, 0xfd, 0x00, 0x01, 0x8f,
+  0xf8, 0xfd, 0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x07, 0xef, 0xf1, 0x4c, 0xfe, 0xb5, 0x00, 0xff,
+  0xf5, 0xfe, 0xff, 0x32, 0x80, 0xff, 0xfe, 0x71, 0x06, 0xff, 0xf3, 0xff, 0xf9, 0x00, 0x00, 0x8f,
+  0xfa, 0xef, 0xf3, 0x00, 0x00, 0x2f, 0xfd, 0xcf, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xaf, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0x6f, 0xf3, 0x00, 0x00, 0x2f, 0xfd, 0x1f, 0xf9, 0x00, 0x00, 0x8f, 0xf9, 0x09,
+  0xff, 0x71, 0x16, 0xff, 0xf2, 0x00, 0xcf, 0xfe, 0xff, 0x05, 0x60, 0x00, 0x06, 0xce, 0xfe, 0xa3,
+  0xdc, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0xf7,  //........%@@+
-  0x00, 0x00, 0x00, 0x01, 0xff, 0xf1,  //........@@@.
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xb0,  //.......+@@%.
-  0x00, 0x00, 0x00, 0x0d, 0xff, 0x50,  //.......@@@+.
-  0x00, 0x00, 0x00, 0x4f, 0xfe, 0x00,  //......+@@@..
-  0x00, 0x00, 0x00, 0xaf, 0xf9, 0x00,  //......%@@%..
-  0x00, 0x00, 0x00, 0xff, 0xf3, 0x00,  //......@@@...
-  0x00, 0x00, 0x06, 0xff, 0xd0, 0x00,  //.....+@@@...
-  0x00, 0x00, 0x0c, 0xff, 0x70, 0x00,  //.....@@@+...
-  0x00, 0x00, 0x2f, 0xff, 0x10, 0x00,  //.....@@@....
-  0x00, 0x00, 0x8f, 0xfb, 0x00, 0x00,  //....%@@%....
-  0x00, 0x00, 0xef, 0xf5, 0x00, 0x00,  //....@@@+....
-  0x00, 0x04, 0xff, 0xe0, 0x00, 0x00,  //...+@@@.....
-  0x00, 0x0a, 0xff, 0x90, 0x00, 0x00,  //...%@@%.....
-  0x00, 0x1f, 0xff, 0x30, 0x00, 0x00,  //...@@@......
-  0x00, 0x6f, 0xfc, 0x00, 0x00, 0x00,  //..+@@@......
-  0x00, 0xcf, 0xf6, 0x00, 0x00, 0x00,  //..@@@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0xf6, 0xff, 0x00, 0xfd, 0xfd, 0x00, 0x01, 0xbf, 0xf7, 0xfe, 0x00, 0x02, 0x01, 0xff,
+  0xf1, 0xfe, 0x00, 0x02, 0x07, 0xff, 0xb0, 0xfe, 0x00, 0x02, 0x0d, 0xff, 0x50, 0xfe, 0x00, 0x01,
+  0x4f, 0xfe, 0xfd, 0x00, 0x01, 0xaf, 0xf9, 0xfd, 0x00, 0x01, 0xff, 0xf3, 0xfe, 0x00, 0x02, 0x06,
+  0xff, 0xd0, 0xfe, 0x00, 0x02, 0x0c, 0xff, 0x70, 0xfe, 0x00, 0x02, 0x2f, 0xff, 0x10, 0xfe, 0x00,
+  0x01, 0x8f, 0xfb, 0xfd, 0x00, 0x01, 0xef, 0xf5, 0xfe, 0x00, 0x02, 0x04, 0xff, 0xe0, 0xfe, 0x00,
+  0x02, 0x0a, 0xff, 0x90, 0xfe, 0x00, 0x02, 0x1f, 0xff, 0x30, 0xfe, 0x00, 0x01, 0x6f, 0xfc, 0xfd,
+  0x00, 0x01, 0xcf, 0xf6, 0xda, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x4a, 0xdf, 0xfd, 0xa3, 0x00,  //..+%@@@@%...
-  0x09, 0xff, 0xff, 0xff, 0xff, 0x90,  //.%@@@@@@@@%.
-  0x6f, 0xfe, 0x51, 0x15, 0xef, 0xf6,  //+@@@+..+@@@+
-  0xdf, 0xf5, 0x00, 0x00, 0x5f, 0xfd,  //@@@+....+@@@
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0x9f, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x0c, 0xfe, 0x51, 0x15, 0xef, 0xc0,  //.@@@+..+@@@.
-  0x00, 0x6c, 0xff, 0xff, 0xc6, 0x00,  //..+@@@@@@+..
-  0x00, 0x8e, 0xff, 0xff, 0xe8, 0x00,  //..%@@@@@@%..
-  0x0c, 0xff, 0x61, 0x16, 0xff, 0xc0,  //.@@@+..+@@@.
-  0x7f, 0xf7, 0x00, 0x00, 0x7f, 0xf7,  //+@@+....+@@+
-  0xdf, 0xf2, 0x00, 0x00, 0x2f, 0xfd,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf2, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xbf, 0xf7, 0x00, 0x00, 0x7f, 0xfb,  //%@@+....+@@%
-  0x4f, 0xff, 0x61, 0x16, 0xff, 0xf4,  //+@@@+..+@@@+
-  0x07, 0xff, 0xff, 0xff, 0xff, 0x70,  //.+@@@@@@@@+.
-  0x00, 0x3a, 0xdf, 0xfd, 0xa3, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x05, 0x4a, 0xdf, 0xfd, 0xa3, 0x00, 0x09, 0xfd, 0xff, 0x5b, 0x90, 0x6f, 0xfe, 0x51,
+  0x15, 0xef, 0xf6, 0xdf, 0xf5, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0xf1, 0x00, 0x00, 0x1f, 0xff, 0xef,
+  0xf1, 0x00, 0x00, 0x1f, 0xfe, 0x9f, 0xf5, 0x00, 0x00, 0x5f, 0xf9, 0x0c, 0xfe, 0x51, 0x15, 0xef,
+  0xc0, 0x00, 0x6c, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xe8, 0x00, 0x0c, 0xff, 0x61,
+  0x16, 0xff, 0xc0, 0x7f, 0xf7, 0x00, 0x00, 0x7f, 0xf7, 0xdf, 0xf2, 0x00, 0x00, 0x2f, 0xfd, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0x2f, 0xfe, 0xbf, 0xf7, 0x00, 0x00, 0x7f,
+  0xfb, 0x4f, 0xff, 0x61, 0x16, 0xff, 0xf4, 0x07, 0xfd, 0xff, 0x05, 0x70, 0x00, 0x3a, 0xdf, 0xfd,
+  0xa3, 0xdc, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x3a, 0xef, 0xec, 0x60, 0x00,  //...%@@@@+...
-  0x06, 0xff, 0xff, 0xff, 0xfb, 0x00,  //.+@@@@@@@%..
-  0x2f, 0xff, 0x60, 0x17, 0xff, 0x90,  //.@@@+..+@@%.
-  0x9f, 0xf8, 0x00, 0x00, 0x9f, 0xf1,  //%@@%....%@@.
-  0xdf, 0xf2, 0x00, 0x00, 0x3f, 0xf6,  //@@@......@@+
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfa,  //@@@......@@%
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfc,  //@@@......@@@
-  0xdf, 0xf2, 0x00, 0x00, 0x3f, 0xfe,  //@@@......@@@
-  0xaf, 0xf8, 0x00, 0x00, 0x9f, 0xff,  //%@@%....%@@@
-  0x3f, 0xff, 0x61, 0x07, 0xef, 0xff,  //.@@@+..+@@@@
-  0x08, 0xff, 0xff, 0xff, 0x5f, 0xff,  //.%@@@@@@+@@@
-  0x00, 0x5b, 0xef, 0xc4, 0x1f, 0xfe,  //..+%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfb,  //........+@@%
-  0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8,  //........%@@%
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3,  //........@@@.
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xc0,  //.......+@@@.
-  0x0c, 0x41, 0x02, 0x9f, 0xff, 0x20,  //.@+...%@@@..
-  0x0f, 0xff, 0xff, 0xff, 0xe3, 0x00,  //.@@@@@@@@...
-  0x03, 0x9e, 0xfe, 0xc7, 0x10, 0x00,  //..%@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x05, 0x3a, 0xef, 0xec, 0x60, 0x00, 0x06, 0xfe, 0xff, 0x32, 0xfb, 0x00, 0x2f, 0xff,
+  0x60, 0x17, 0xff, 0x90, 0x9f, 0xf8, 0x00, 0x00, 0x9f, 0xf1, 0xdf, 0xf2, 0x00, 0x00, 0x3f, 0xf6,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0xdf, 0xf2, 0x00, 0x00,
+  0x3f, 0xfe, 0xaf, 0xf8, 0x00, 0x00, 0x9f, 0xff, 0x3f, 0xff, 0x61, 0x07, 0xef, 0xff, 0x08, 0xfe,
+  0xff, 0x07, 0x5f, 0xff, 0x00, 0x5b, 0xef, 0xc4, 0x1f, 0xfe, 0xfd, 0x00, 0x01, 0x4f, 0xfb, 0xfd,
+  0x00, 0x01, 0x8f, 0xf8, 0xfd, 0x00, 0x01, 0xdf, 0xf3, 0xfe, 0x00, 0x09, 0x07, 0xff, 0xc0, 0x0c,
+  0x41, 0x02, 0x9f, 0xff, 0x20, 0x0f, 0xfe, 0xff, 0x06, 0xe3, 0x00, 0x03, 0x9e, 0xfe, 0xc7, 0x10,
+  0xdc, 0x00,
 
   /*Unicode: U+003a (:) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xeb, 0x00, 0x07, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf7, 0x00, 0x07, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+003b (;) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xff,  //.@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xff,  //.@@@
-  0x0f, 0xfe,  //.@@@
-  0x3f, 0xf8,  //.@@%
-  0x7f, 0xf1,  //+@@.
-  0xaf, 0xa0,  //%@%.
-  0xef, 0x30,  //@@..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xeb, 0x00, 0x07, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xf7, 0x00, 0x0d, 0x0f, 0xff,
+  0x0f, 0xff, 0x0f, 0xfe, 0x3f, 0xf8, 0x7f, 0xf1, 0xaf, 0xa0, 0xef, 0x30, 0xfb, 0x00,
 
   /*Unicode: U+003c (<) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc0,  //...........+@
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xef, 0xf0,  //.........%@@@
-  0x00, 0x00, 0x00, 0x4b, 0xff, 0xfe, 0x80,  //......+%@@@@%
-  0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50, 0x00,  //....+@@@@%+..
-  0x03, 0x9f, 0xff, 0xe8, 0x20, 0x00, 0x00,  //..%@@@@%.....
-  0xcf, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.......
-  0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+.........
-  0xcf, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.......
-  0x03, 0x9f, 0xff, 0xe8, 0x20, 0x00, 0x00,  //..%@@@@%.....
-  0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50, 0x00,  //....+@@@@%+..
-  0x00, 0x00, 0x00, 0x4b, 0xff, 0xfe, 0x90,  //......+%@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xef, 0xf0,  //.........%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc0,  //...........+@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbd, 0x00, 0x01, 0x05, 0xc0, 0xfd, 0x00, 0x02, 0x28, 0xef, 0xf0, 0xfe, 0x00, 0x14, 0x4b, 0xff,
+  0xfe, 0x80, 0x00, 0x01, 0x7d, 0xff, 0xfb, 0x50, 0x00, 0x03, 0x9f, 0xff, 0xe8, 0x20, 0x00, 0x00,
+  0xcf, 0xff, 0xb5, 0xfd, 0x00, 0x01, 0xff, 0xe4, 0xfc, 0x00, 0x02, 0xcf, 0xff, 0xb5, 0xfd, 0x00,
+  0x04, 0x03, 0x9f, 0xff, 0xe8, 0x20, 0xfe, 0x00, 0x04, 0x01, 0x7d, 0xff, 0xfb, 0x50, 0xfd, 0x00,
+  0x03, 0x4b, 0xff, 0xfe, 0x90, 0xfd, 0x00, 0x02, 0x28, 0xef, 0xf0, 0xfc, 0x00, 0x01, 0x05, 0xc0,
+  0xc9, 0x00,
 
   /*Unicode: U+003d (=) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xad, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xec, 0x00, 0xfb, 0xff, 0x00, 0xf0,
+  0xfb, 0xff, 0x00, 0xf0, 0xb4, 0x00,
 
   /*Unicode: U+003e (>) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+...........
-  0xff, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x00,  //@@@%.........
-  0x8e, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00,  //%@@@@%+......
-  0x00, 0x5c, 0xff, 0xfd, 0x71, 0x00, 0x00,  //..+@@@@@+....
-  0x00, 0x00, 0x28, 0xef, 0xff, 0x93, 0x00,  //.....%@@@@%..
-  0x00, 0x00, 0x00, 0x05, 0xbf, 0xff, 0xc0,  //.......+%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xef, 0xf0,  //.........+@@@
-  0x00, 0x00, 0x00, 0x05, 0xbf, 0xff, 0xc0,  //.......+%@@@@
-  0x00, 0x00, 0x28, 0xef, 0xff, 0x93, 0x00,  //.....%@@@@%..
-  0x00, 0x5b, 0xff, 0xfd, 0x71, 0x00, 0x00,  //..+%@@@@+....
-  0x9e, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00,  //%@@@@%+......
-  0xff, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x00,  //@@@%.........
-  0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc2, 0x00, 0x00, 0xc5, 0xfb, 0x00, 0x02, 0xff, 0xe8, 0x20, 0xfd, 0x00, 0x03, 0x8e, 0xff, 0xfb,
+  0x40, 0xfd, 0x00, 0x03, 0x5c, 0xff, 0xfd, 0x71, 0xfd, 0x00, 0x03, 0x28, 0xef, 0xff, 0x93, 0xfd,
+  0x00, 0x03, 0x05, 0xbf, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0x04, 0xef, 0xf0, 0xfe, 0x00, 0x15, 0x05,
+  0xbf, 0xff, 0xc0, 0x00, 0x00, 0x28, 0xef, 0xff, 0x93, 0x00, 0x00, 0x5b, 0xff, 0xfd, 0x71, 0x00,
+  0x00, 0x9e, 0xff, 0xfb, 0x40, 0xfe, 0x00, 0x02, 0xff, 0xe8, 0x20, 0xfd, 0x00, 0x00, 0xc5, 0xc3,
+  0x00,
 
   /*Unicode: U+003f (?) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x01, 0x8d, 0xff, 0xc7, 0x00,  //..%@@@@+..
-  0x5f, 0xff, 0xff, 0xff, 0xc0,  //+@@@@@@@@.
-  0xfd, 0x61, 0x01, 0x9f, 0xf8,  //@@+...%@@%
-  0x90, 0x00, 0x00, 0x1f, 0xfe,  //%......@@@
-  0x00, 0x00, 0x00, 0x3f, 0xff,  //.......@@@
-  0x00, 0x00, 0x01, 0xdf, 0xfc,  //......@@@@
-  0x00, 0x00, 0x0c, 0xff, 0xf5,  //.....@@@@+
-  0x00, 0x00, 0xaf, 0xff, 0x70,  //....%@@@+.
-  0x00, 0x04, 0xff, 0xf6, 0x00,  //...+@@@+..
-  0x00, 0x0a, 0xff, 0xa0, 0x00,  //...%@@%...
-  0x00, 0x0e, 0xff, 0x30, 0x00,  //...@@@....
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x0f, 0xff, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe8, 0x00, 0x05, 0x01, 0x8d, 0xff, 0xc7, 0x00, 0x5f, 0xfe, 0xff, 0x0a, 0xc0, 0xfd, 0x61, 0x01,
+  0x9f, 0xf8, 0x90, 0x00, 0x00, 0x1f, 0xfe, 0xfe, 0x00, 0x22, 0x3f, 0xff, 0x00, 0x00, 0x01, 0xdf,
+  0xfc, 0x00, 0x00, 0x0c, 0xff, 0xf5, 0x00, 0x00, 0xaf, 0xff, 0x70, 0x00, 0x04, 0xff, 0xf6, 0x00,
+  0x00, 0x0a, 0xff, 0xa0, 0x00, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x01,
+  0x0f, 0xff, 0xfe, 0x00, 0x01, 0x0f, 0xff, 0xf4, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0x01, 0x0f,
+  0xff, 0xfe, 0x00, 0x01, 0x0f, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x04, 0xad, 0xff, 0xc7, 0x00, 0x00,  //.....+%@@@@+...
-  0x00, 0x02, 0xcf, 0xff, 0xff, 0xff, 0xd1, 0x00,  //....@@@@@@@@@..
-  0x00, 0x2e, 0xfe, 0x72, 0x00, 0x5e, 0xfc, 0x00,  //...@@@+...+@@@.
-  0x00, 0xdf, 0xb0, 0x00, 0x00, 0x01, 0xef, 0x50,  //..@@%.......@@+
-  0x08, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xa0,  //.%@@........+@%
-  0x0f, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe0,  //.@@..........@@
-  0x6f, 0xb0, 0x00, 0x06, 0xdf, 0xe8, 0x1f, 0xf0,  //+@%....+@@@%.@@
-  0x9f, 0x60, 0x00, 0xaf, 0xff, 0xff, 0xcf, 0xf0,  //%@+...%@@@@@@@@
-  0xdf, 0x30, 0x06, 0xff, 0x61, 0x16, 0xff, 0xf0,  //@@...+@@+..+@@@
-  0xef, 0x10, 0x0c, 0xf6, 0x00, 0x00, 0x6f, 0xf0,  //@@...@@+....+@@
-  0xff, 0x00, 0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0,  //@@...@@......@@
-  0xff, 0x00, 0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0,  //@@...@@......@@
-  0xef, 0x10, 0x0c, 0xf6, 0x00, 0x00, 0x6f, 0xf0,  //@@...@@+....+@@
-  0xcf, 0x40, 0x06, 0xff, 0x61, 0x16, 0xff, 0xf0,  //@@+..+@@+..+@@@
-  0x8f, 0x70, 0x00, 0xaf, 0xff, 0xff, 0xcf, 0xf0,  //%@+...%@@@@@@@@
-  0x4f, 0xd0, 0x00, 0x06, 0xdf, 0xe9, 0x0f, 0xf0,  //+@@....+@@@%.@@
-  0x0d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@+...........
-  0x06, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@...........
-  0x00, 0xaf, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@..........
-  0x00, 0x0b, 0xff, 0xa5, 0x10, 0x16, 0x90, 0x00,  //...%@@%+...+%..
-  0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xe0, 0x00,  //....%@@@@@@@@..
-  0x00, 0x00, 0x01, 0x7b, 0xdf, 0xfc, 0x80, 0x00,  //......+%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xcf, 0x00, 0x03, 0x04, 0xad, 0xff, 0xc7, 0xfe, 0x00, 0x01, 0x02, 0xcf, 0xfe, 0xff, 0x13, 0xd1,
+  0x00, 0x00, 0x2e, 0xfe, 0x72, 0x00, 0x5e, 0xfc, 0x00, 0x00, 0xdf, 0xb0, 0x00, 0x00, 0x01, 0xef,
+  0x50, 0x08, 0xfc, 0xfd, 0x00, 0x03, 0x7f, 0xa0, 0x0f, 0xf3, 0xfd, 0x00, 0x53, 0x2f, 0xe0, 0x6f,
+  0xb0, 0x00, 0x06, 0xdf, 0xe8, 0x1f, 0xf0, 0x9f, 0x60, 0x00, 0xaf, 0xff, 0xff, 0xcf, 0xf0, 0xdf,
+  0x30, 0x06, 0xff, 0x61, 0x16, 0xff, 0xf0, 0xef, 0x10, 0x0c, 0xf6, 0x00, 0x00, 0x6f, 0xf0, 0xff,
+  0x00, 0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00, 0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xf0, 0xef,
+  0x10, 0x0c, 0xf6, 0x00, 0x00, 0x6f, 0xf0, 0xcf, 0x40, 0x06, 0xff, 0x61, 0x16, 0xff, 0xf0, 0x8f,
+  0x70, 0x00, 0xaf, 0xff, 0xff, 0xcf, 0xf0, 0x4f, 0xd0, 0x00, 0x06, 0xdf, 0xe9, 0x0f, 0xf0, 0x0d,
+  0xf6, 0xfb, 0x00, 0x02, 0x06, 0xff, 0x20, 0xfb, 0x00, 0x01, 0xaf, 0xe3, 0xfb, 0x00, 0x05, 0x0b,
+  0xff, 0xa5, 0x10, 0x16, 0x90, 0xfe, 0x00, 0x00, 0x8f, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x04,
+  0x01, 0x7b, 0xdf, 0xfc, 0x80, 0xf0, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd7, 0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x0d,
+  0xff, 0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0x70,
+  0xfd, 0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0xfe,
+  0x00, 0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0xfe,
+  0x00, 0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50,
+  0x00, 0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x04,
+  0xfc, 0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x0e, 0xff, 0x30,
+  0x00, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e, 0xff, 0x30, 0x8f, 0xf9, 0xfe,
+  0x00, 0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04, 0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xeb, 0x50, 0x00,  //@@@@@@@%+...
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0x00,  //@@@@@@@@@%..
-  0xff, 0xf0, 0x00, 0x3c, 0xff, 0x70,  //@@@....@@@+.
-  0xff, 0xf0, 0x00, 0x03, 0xff, 0xd0,  //@@@.....@@@.
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@.
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xe0,  //@@@.....@@@.
-  0xff, 0xf0, 0x00, 0x04, 0xff, 0xb0,  //@@@....+@@%.
-  0xff, 0xf0, 0x00, 0x3d, 0xff, 0x30,  //@@@....@@@..
-  0xff, 0xff, 0xff, 0xfe, 0xa2, 0x00,  //@@@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xc6, 0x00,  //@@@@@@@@@+..
-  0xff, 0xf0, 0x00, 0x28, 0xff, 0xa0,  //@@@....%@@%.
-  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xf6,  //@@@.....%@@+
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfd,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x6f, 0xfc,  //@@@.....+@@@
-  0xff, 0xf0, 0x00, 0x16, 0xff, 0xf5,  //@@@....+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xec, 0x92, 0x00,  //@@@@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0xfe, 0xff, 0x02, 0xeb, 0x50, 0x00, 0xfd, 0xff, 0x25, 0xfa, 0x00, 0xff, 0xf0, 0x00,
+  0x3c, 0xff, 0x70, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xd0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0x00, 0x04, 0xff, 0xb0, 0xff, 0xf0, 0x00, 0x3d, 0xff,
+  0x30, 0xfe, 0xff, 0x02, 0xfe, 0xa2, 0x00, 0xfd, 0xff, 0x2b, 0xc6, 0x00, 0xff, 0xf0, 0x00, 0x28,
+  0xff, 0xa0, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xf6, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfd, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x6f, 0xfc,
+  0xff, 0xf0, 0x00, 0x16, 0xff, 0xf5, 0xfc, 0xff, 0x00, 0x70, 0xfe, 0xff, 0x01, 0xec, 0x92, 0xdc,
+  0x00,
 
   /*Unicode: U+0043 (C) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93,  //....+%@@@@%.
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0xdf, 0xfa, 0x30, 0x15, 0xcf,  //..@@@%...+@@
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x08,  //.%@@%......%
-  0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x08,  //.%@@%......%
-  0x01, 0xdf, 0xfa, 0x30, 0x15, 0xcf,  //..@@@%...+@@
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93,  //....+%@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe1, 0x00, 0x05, 0x5a, 0xef, 0xfd, 0x93, 0x00, 0x1c, 0xfd, 0xff, 0x0d, 0x00, 0xdf, 0xfa, 0x30,
+  0x15, 0xcf, 0x09, 0xff, 0x80, 0x00, 0x00, 0x08, 0x1f, 0xfd, 0xfd, 0x00, 0x01, 0x7f, 0xf8, 0xfd,
+  0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xdf, 0xf1, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xdf, 0xf1, 0xfd, 0x00, 0x01,
+  0xbf, 0xf4, 0xfd, 0x00, 0x01, 0x7f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xfd, 0xfd, 0x00, 0x0d, 0x09,
+  0xff, 0x80, 0x00, 0x00, 0x08, 0x01, 0xdf, 0xfa, 0x30, 0x15, 0xcf, 0x00, 0x1c, 0xfd, 0xff, 0x05,
+  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93, 0xdd, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00,  //@@@@@@%+....
-  0xff, 0xff, 0xff, 0xff, 0xe3, 0x00,  //@@@@@@@@@...
-  0xff, 0xf0, 0x02, 0x7f, 0xff, 0x30,  //@@@...+@@@..
-  0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0,  //@@@.....@@@.
-  0xff, 0xf0, 0x00, 0x00, 0xaf, 0xf3,  //@@@.....%@@.
-  0xff, 0xf0, 0x00, 0x00, 0x6f, 0xf8,  //@@@.....+@@%
-  0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfb,  //@@@......@@%
-  0xff, 0xf0, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfb,  //@@@......@@%
-  0xff, 0xf0, 0x00, 0x00, 0x6f, 0xf8,  //@@@.....+@@%
-  0xff, 0xf0, 0x00, 0x00, 0xaf, 0xf3,  //@@@.....%@@.
-  0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0,  //@@@.....@@@.
-  0xff, 0xf0, 0x02, 0x7f, 0xff, 0x30,  //@@@...+@@@..
-  0xff, 0xff, 0xff, 0xff, 0xe3, 0x00,  //@@@@@@@@@...
-  0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00,  //@@@@@@%+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x05, 0xff, 0xff, 0xfe, 0xb6, 0x00, 0x00, 0xfd, 0xff, 0x5b, 0xe3, 0x00, 0xff, 0xf0,
+  0x02, 0x7f, 0xff, 0x30, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xf0, 0x00, 0x00, 0xaf, 0xf3,
+  0xff, 0xf0, 0x00, 0x00, 0x6f, 0xf8, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0xf0, 0x00, 0x00,
+  0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfb,
+  0xff, 0xf0, 0x00, 0x00, 0x6f, 0xf8, 0xff, 0xf0, 0x00, 0x00, 0xaf, 0xf3, 0xff, 0xf0, 0x00, 0x03,
+  0xff, 0xc0, 0xff, 0xf0, 0x02, 0x7f, 0xff, 0x30, 0xfd, 0xff, 0x05, 0xe3, 0x00, 0xff, 0xff, 0xfe,
+  0xb6, 0xdb, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xd9, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x5b, 0xef, 0xfc, 0x93, 0x00,  //....+%@@@@%..
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@@@@@@@.
-  0x01, 0xdf, 0xf9, 0x30, 0x15, 0xcf, 0x00,  //..@@@%...+@@.
-  0x09, 0xff, 0x70, 0x00, 0x00, 0x08, 0x00,  //.%@@+......%.
-  0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x7f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@+.........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.........
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0,  //@@@....@@@@@@
-  0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0,  //@@@....@@@@@@
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xbf, 0xf3, 0x00, 0x00, 0x00, 0xff, 0xf0,  //%@@.......@@@
-  0x7f, 0xf7, 0x00, 0x00, 0x00, 0xff, 0xf0,  //+@@+......@@@
-  0x1f, 0xfc, 0x00, 0x00, 0x00, 0xff, 0xf0,  //.@@@......@@@
-  0x09, 0xff, 0x50, 0x00, 0x00, 0xff, 0xf0,  //.%@@+.....@@@
-  0x00, 0xdf, 0xf8, 0x20, 0x28, 0xff, 0xf0,  //..@@@%...%@@@
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x80,  //...@@@@@@@@@%
-  0x00, 0x00, 0x5a, 0xef, 0xfc, 0x82, 0x00,  //....+%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdc, 0x00, 0x06, 0x5b, 0xef, 0xfc, 0x93, 0x00, 0x00, 0x1c, 0xfd, 0xff, 0x10, 0x00, 0x01, 0xdf,
+  0xf9, 0x30, 0x15, 0xcf, 0x00, 0x09, 0xff, 0x70, 0x00, 0x00, 0x08, 0x00, 0x1f, 0xfd, 0xfc, 0x00,
+  0x01, 0x7f, 0xf7, 0xfc, 0x00, 0x01, 0xbf, 0xf4, 0xfc, 0x00, 0x01, 0xdf, 0xf1, 0xfc, 0x00, 0x01,
+  0xff, 0xf0, 0xfc, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0xdf, 0xf1, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xbf, 0xf3, 0xfe, 0x00, 0x03, 0xff,
+  0xf0, 0x7f, 0xf7, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0x1f, 0xfc, 0xfe, 0x00, 0x11, 0xff, 0xf0, 0x09,
+  0xff, 0x50, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xdf, 0xf8, 0x20, 0x28, 0xff, 0xf0, 0x00, 0x1c, 0xfd,
+  0xff, 0x06, 0x80, 0x00, 0x00, 0x5a, 0xef, 0xfc, 0x82, 0xd6, 0x00,
 
   /*Unicode: U+0048 (H) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x2e, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xf3, 0xff, 0x34, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe3, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+004a (J) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0,  //...@@@@@@@@
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0,  //...@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,  //........@@@
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xd0,  //........@@@
-  0x90, 0x00, 0x00, 0x06, 0xff, 0xa0,  //%......+@@%
-  0xfe, 0x72, 0x00, 0x5e, 0xff, 0x40,  //@@+...+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@%.
-  0x27, 0xbd, 0xff, 0xeb, 0x50, 0x00,  //.+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe2, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x0e, 0x02, 0xff, 0xd0,
+  0x90, 0x00, 0x00, 0x06, 0xff, 0xa0, 0xfe, 0x72, 0x00, 0x5e, 0xff, 0x40, 0xfd, 0xff, 0x06, 0xf9,
+  0x00, 0x27, 0xbd, 0xff, 0xeb, 0x50, 0xdc, 0x00,
 
   /*Unicode: U+004b (K) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00,  //@@@.......+@@%.
-  0xff, 0xf0, 0x00, 0x00, 0x06, 0xff, 0x90, 0x00,  //@@@......+@@%..
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xfa, 0x00, 0x00,  //@@@.....+@@%...
-  0xff, 0xf0, 0x00, 0x05, 0xff, 0xa0, 0x00, 0x00,  //@@@....+@@%....
-  0xff, 0xf0, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00,  //@@@...+@@%.....
-  0xff, 0xf0, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00,  //@@@...@@@......
-  0xff, 0xf0, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,  //@@@..@@@.......
-  0xff, 0xf2, 0xef, 0xd1, 0x00, 0x00, 0x00, 0x00,  //@@@.@@@........
-  0xff, 0xfe, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@........
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@.......
-  0xff, 0xfe, 0x4f, 0xff, 0x70, 0x00, 0x00, 0x00,  //@@@@+@@@+......
-  0xff, 0xf2, 0x07, 0xff, 0xf2, 0x00, 0x00, 0x00,  //@@@..+@@@......
-  0xff, 0xf0, 0x00, 0xcf, 0xfc, 0x00, 0x00, 0x00,  //@@@...@@@@.....
-  0xff, 0xf0, 0x00, 0x2f, 0xff, 0x80, 0x00, 0x00,  //@@@....@@@%....
-  0xff, 0xf0, 0x00, 0x06, 0xff, 0xf3, 0x00, 0x00,  //@@@....+@@@....
-  0xff, 0xf0, 0x00, 0x00, 0xbf, 0xfd, 0x00, 0x00,  //@@@.....%@@@...
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xff, 0x80, 0x00,  //@@@......@@@%..
-  0xff, 0xf0, 0x00, 0x00, 0x06, 0xff, 0xf3, 0x00,  //@@@......+@@@..
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xbf, 0xfd, 0x00,  //@@@.......%@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x1f, 0x7f, 0xf8, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x06,
+  0xff, 0x90, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x5f, 0xfa, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x05, 0xff,
+  0xa0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x4f, 0xfb, 0xfe, 0x00, 0x04, 0xff, 0xf0, 0x03, 0xff, 0xc0,
+  0xfe, 0x00, 0x03, 0xff, 0xf0, 0x3f, 0xfc, 0xfd, 0x00, 0x03, 0xff, 0xf2, 0xef, 0xd1, 0xfd, 0x00,
+  0x03, 0xff, 0xfe, 0xff, 0xf2, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x04, 0xff, 0xfe,
+  0x4f, 0xff, 0x70, 0xfe, 0x00, 0x04, 0xff, 0xf2, 0x07, 0xff, 0xf2, 0xfe, 0x00, 0x04, 0xff, 0xf0,
+  0x00, 0xcf, 0xfc, 0xfe, 0x00, 0x29, 0xff, 0xf0, 0x00, 0x2f, 0xff, 0x80, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x06, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xbf, 0xfd, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0x00, 0x2f, 0xff, 0x80, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x06, 0xff, 0xf3, 0x00, 0xff, 0xf0,
+  0xfe, 0x00, 0x01, 0xbf, 0xfd, 0xd0, 0x00,
 
   /*Unicode: U+004c (L) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+004d (M) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xf0,  //@@@@.....@@@@
-  0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xf0,  //@@@@+...+@@@@
-  0xff, 0xff, 0x80, 0x00, 0x8f, 0xff, 0xf0,  //@@@@%...%@@@@
-  0xff, 0xfd, 0xd0, 0x00, 0xdd, 0xff, 0xf0,  //@@@@@...@@@@@
-  0xff, 0xf9, 0xf1, 0x01, 0xf9, 0xff, 0xf0,  //@@@%@...@%@@@
-  0xff, 0xf4, 0xf6, 0x06, 0xf4, 0xff, 0xf0,  //@@@+@+.+@+@@@
-  0xff, 0xf0, 0xfa, 0x0a, 0xf0, 0xff, 0xf0,  //@@@.@%.%@.@@@
-  0xff, 0xf0, 0xbe, 0x0f, 0xb0, 0xff, 0xf0,  //@@@.%@.@%.@@@
-  0xff, 0xf0, 0x7f, 0x7f, 0x70, 0xff, 0xf0,  //@@@.+@+@+.@@@
-  0xff, 0xf0, 0x2f, 0xef, 0x20, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0e, 0xfe, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x09, 0xf9, 0x00, 0xff, 0xf0,  //@@@..%@%..@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xde, 0x00, 0x55, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff,
+  0xf0, 0xff, 0xff, 0x80, 0x00, 0x8f, 0xff, 0xf0, 0xff, 0xfd, 0xd0, 0x00, 0xdd, 0xff, 0xf0, 0xff,
+  0xf9, 0xf1, 0x01, 0xf9, 0xff, 0xf0, 0xff, 0xf4, 0xf6, 0x06, 0xf4, 0xff, 0xf0, 0xff, 0xf0, 0xfa,
+  0x0a, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xbe, 0x0f, 0xb0, 0xff, 0xf0, 0xff, 0xf0, 0x7f, 0x7f, 0x70,
+  0xff, 0xf0, 0xff, 0xf0, 0x2f, 0xef, 0x20, 0xff, 0xf0, 0xff, 0xf0, 0x0e, 0xfe, 0x00, 0xff, 0xf0,
+  0xff, 0xf0, 0x09, 0xf9, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0,
+  0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00,
+  0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff,
+  0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+004e (N) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0x20, 0x00, 0x0f, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0x80, 0x00, 0x0f, 0xff,  //@@@@%....@@@
-  0xff, 0xff, 0xd0, 0x00, 0x0f, 0xff,  //@@@@@....@@@
-  0xff, 0xfb, 0xf3, 0x00, 0x0f, 0xff,  //@@@%@....@@@
-  0xff, 0xf6, 0xf9, 0x00, 0x0f, 0xff,  //@@@+@%...@@@
-  0xff, 0xf0, 0xfe, 0x00, 0x0f, 0xff,  //@@@.@@...@@@
-  0xff, 0xf0, 0xaf, 0x40, 0x0f, 0xff,  //@@@.%@+..@@@
-  0xff, 0xf0, 0x5f, 0x90, 0x0f, 0xff,  //@@@.+@%..@@@
-  0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff,  //@@@..@@..@@@
-  0xff, 0xf0, 0x09, 0xf5, 0x0f, 0xff,  //@@@..%@+.@@@
-  0xff, 0xf0, 0x04, 0xfa, 0x0f, 0xff,  //@@@..+@%.@@@
-  0xff, 0xf0, 0x00, 0xef, 0x0f, 0xff,  //@@@...@@.@@@
-  0xff, 0xf0, 0x00, 0x9f, 0x6f, 0xff,  //@@@...%@+@@@
-  0xff, 0xf0, 0x00, 0x3f, 0xbf, 0xff,  //@@@....@%@@@
-  0xff, 0xf0, 0x00, 0x0d, 0xff, 0xff,  //@@@....@@@@@
-  0xff, 0xf0, 0x00, 0x08, 0xff, 0xff,  //@@@....%@@@@
-  0xff, 0xf0, 0x00, 0x02, 0xff, 0xff,  //@@@.....@@@@
-  0xff, 0xf0, 0x00, 0x00, 0xdf, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x04, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0x20, 0x00, 0x0f, 0xfe, 0xff,
+  0x02, 0x80, 0x00, 0x0f, 0xfe, 0xff, 0x49, 0xd0, 0x00, 0x0f, 0xff, 0xff, 0xfb, 0xf3, 0x00, 0x0f,
+  0xff, 0xff, 0xf6, 0xf9, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xaf,
+  0x40, 0x0f, 0xff, 0xff, 0xf0, 0x5f, 0x90, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff,
+  0xf0, 0x09, 0xf5, 0x0f, 0xff, 0xff, 0xf0, 0x04, 0xfa, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0xef, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x9f, 0x6f, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xbf, 0xff, 0xff, 0xf0, 0x00,
+  0x0d, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x08, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x02, 0xfe, 0xff, 0x04,
+  0xf0, 0x00, 0x00, 0xdf, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+004f (O) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdd, 0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x2d, 0x90, 0x00,
+  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x5f, 0xf8,
+  0x00, 0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0xcf, 0xf2, 0x00, 0x00,
+  0x02, 0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff,
+  0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x2d, 0xff, 0xf0, 0xef,
+  0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0x9f, 0xf4, 0x00,
+  0x00, 0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f, 0xfe, 0x00, 0x00, 0x0e,
+  0xfe, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x06, 0x90, 0x00,
+  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xfd, 0x92, 0x00,  //@@@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@+.
-  0xff, 0xf0, 0x00, 0x28, 0xff, 0xf3,  //@@@....%@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfb,  //@@@.....%@@%
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfb,  //@@@.....%@@%
-  0xff, 0xf0, 0x00, 0x28, 0xff, 0xf4,  //@@@....%@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xfd, 0x92, 0x00,  //@@@@@@@@%...
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0xfe, 0xff, 0x02, 0xfd, 0x92, 0x00, 0xfc, 0xff, 0x2a, 0x60, 0xff, 0xf0, 0x00, 0x28,
+  0xff, 0xf3, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfb, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfb,
+  0xff, 0xf0, 0x00, 0x28, 0xff, 0xf4, 0xfc, 0xff, 0x00, 0x70, 0xfe, 0xff, 0x04, 0xfd, 0x92, 0x00,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xd9, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x00,  //..%@@@@@@@%..
-  0x00, 0x05, 0xbe, 0xff, 0xf8, 0x00, 0x00,  //...+%@@@@%...
-  0x00, 0x00, 0x00, 0x08, 0xff, 0x70, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x00, 0x9f, 0xf8, 0x00,  //........%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0x91, 0x00,  //.........%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdd, 0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x2d, 0x90, 0x00,
+  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x5f, 0xf8,
+  0x00, 0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0xcf, 0xf2, 0x00, 0x00,
+  0x02, 0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff,
+  0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x2d, 0xff, 0xf0, 0xef,
+  0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0x9f, 0xf4, 0x00,
+  0x00, 0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f, 0xfe, 0x00, 0x00, 0x0e,
+  0xfe, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x06, 0x80, 0x00,
+  0x00, 0x05, 0xbe, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x08, 0xff, 0x70, 0xfc, 0x00, 0x01, 0x9f, 0xf8,
+  0xfc, 0x00, 0x01, 0x0a, 0x91, 0xeb, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0xff, 0xec, 0x82, 0x00, 0x00,  //@@@@@@@@%.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00,  //@@@@@@@@@@+...
-  0xff, 0xf0, 0x00, 0x28, 0xff, 0xf3, 0x00,  //@@@....%@@@...
-  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfa, 0x00,  //@@@.....%@@%..
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0x00,  //@@@......@@@..
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00,  //@@@......@@@..
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0x00,  //@@@......@@@..
-  0xff, 0xf0, 0x00, 0x00, 0x7f, 0xf9, 0x00,  //@@@.....+@@%..
-  0xff, 0xf0, 0x00, 0x17, 0xff, 0xe1, 0x00,  //@@@....+@@@...
-  0xff, 0xff, 0xff, 0xff, 0xe9, 0x10, 0x00,  //@@@@@@@@@%....
-  0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00,  //@@@@@@@@%.....
-  0xff, 0xf0, 0x13, 0x9f, 0xfe, 0x10, 0x00,  //@@@...%@@@....
-  0xff, 0xf0, 0x00, 0x0a, 0xff, 0xb0, 0x00,  //@@@....%@@%...
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf4, 0x00,  //@@@.....@@@+..
-  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfc, 0x00,  //@@@.....%@@@..
-  0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x40,  //@@@......@@@+.
-  0xff, 0xf0, 0x00, 0x00, 0x08, 0xff, 0xc0,  //@@@......%@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x01, 0xff, 0xf4,  //@@@.......@@@+
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x9f, 0xfc,  //@@@.......%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xde, 0x00, 0xfe, 0xff, 0x03, 0xec, 0x82, 0x00, 0x00, 0xfc, 0xff, 0x32, 0x60, 0x00, 0xff, 0xf0,
+  0x00, 0x28, 0xff, 0xf3, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfa, 0x00, 0xff, 0xf0, 0x00, 0x00,
+  0x2f, 0xfe, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,
+  0x00, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xf9, 0x00, 0xff, 0xf0, 0x00, 0x17, 0xff, 0xe1, 0x00, 0xfd,
+  0xff, 0x02, 0xe9, 0x10, 0x00, 0xfd, 0xff, 0x35, 0xa1, 0x00, 0x00, 0xff, 0xf0, 0x13, 0x9f, 0xfe,
+  0x10, 0x00, 0xff, 0xf0, 0x00, 0x0a, 0xff, 0xb0, 0x00, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf4, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0x8f, 0xfc, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x40, 0xff, 0xf0,
+  0x00, 0x00, 0x08, 0xff, 0xc0, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xff, 0xf4, 0xff, 0xf0, 0xfe, 0x00,
+  0x01, 0x9f, 0xfc, 0xd7, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfe, 0xb7, 0x20,  //...%@@@@%+..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@@@.
-  0x2f, 0xff, 0x92, 0x01, 0x6d, 0xf0,  //.@@@%...+@@.
-  0xaf, 0xf8, 0x00, 0x00, 0x00, 0x90,  //%@@%......%.
-  0xef, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xef, 0xfa, 0x00, 0x00, 0x00, 0x00,  //@@@%........
-  0x8f, 0xff, 0xea, 0x61, 0x00, 0x00,  //%@@@@%+.....
-  0x0c, 0xff, 0xff, 0xff, 0xc5, 0x00,  //.@@@@@@@@+..
-  0x00, 0x7e, 0xff, 0xff, 0xff, 0x90,  //..+@@@@@@@%.
-  0x00, 0x00, 0x37, 0xbf, 0xff, 0xf5,  //.....+%@@@@+
-  0x00, 0x00, 0x00, 0x02, 0xdf, 0xfb,  //........@@@%
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe,  //.........@@@
-  0xa1, 0x00, 0x00, 0x00, 0x7f, 0xfb,  //%.......+@@%
-  0xff, 0x83, 0x00, 0x29, 0xff, 0xf4,  //@@%....%@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@+.
-  0x27, 0xbd, 0xff, 0xec, 0x82, 0x00,  //.+%@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x05, 0x18, 0xdf, 0xfe, 0xb7, 0x20, 0x04, 0xfd, 0xff, 0x08, 0xf0, 0x2f, 0xff, 0x92,
+  0x01, 0x6d, 0xf0, 0xaf, 0xf8, 0xfe, 0x00, 0x02, 0x90, 0xef, 0xf1, 0xfd, 0x00, 0x01, 0xff, 0xf1,
+  0xfd, 0x00, 0x01, 0xef, 0xfa, 0xfd, 0x00, 0x06, 0x8f, 0xff, 0xea, 0x61, 0x00, 0x00, 0x0c, 0xfe,
+  0xff, 0x03, 0xc5, 0x00, 0x00, 0x7e, 0xfe, 0xff, 0x06, 0x90, 0x00, 0x00, 0x37, 0xbf, 0xff, 0xf5,
+  0xfe, 0x00, 0x02, 0x02, 0xdf, 0xfb, 0xfd, 0x00, 0x01, 0x3f, 0xfe, 0xfd, 0x00, 0x01, 0x0f, 0xff,
+  0xfd, 0x00, 0x02, 0x1f, 0xfe, 0xa1, 0xfe, 0x00, 0x07, 0x7f, 0xfb, 0xff, 0x83, 0x00, 0x29, 0xff,
+  0xf4, 0xfc, 0xff, 0x05, 0x70, 0x27, 0xbd, 0xff, 0xec, 0x82, 0xdc, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0xfa, 0xff, 0x00, 0xf0, 0xfa, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfb,
+  0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00,
+  0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01,
+  0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff,
+  0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0,
+  0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xce,
+  0x00,
 
   /*Unicode: U+0055 (U) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe,  //@@@......@@@
-  0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd,  //@@@......@@@
-  0xaf, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3,  //.@@@+..+@@@.
-  0x06, 0xff, 0xff, 0xff, 0xff, 0x60,  //.+@@@@@@@@+.
-  0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x66, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd, 0xaf, 0xf5, 0x00,
+  0x00, 0x5f, 0xf9, 0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3, 0x06, 0xfd, 0xff, 0x05, 0x60, 0x00, 0x29,
+  0xdf, 0xfd, 0x92, 0xdc, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xfd,  //@@@+......+@@@
-  0x9f, 0xf8, 0x00, 0x00, 0x00, 0x8f, 0xf9,  //%@@%......%@@%
-  0x4f, 0xfd, 0x00, 0x00, 0x00, 0xdf, 0xf4,  //+@@@......@@@+
-  0x0f, 0xff, 0x20, 0x00, 0x02, 0xff, 0xf0,  //.@@@......@@@.
-  0x0b, 0xff, 0x60, 0x00, 0x06, 0xff, 0xb0,  //.%@@+....+@@%.
-  0x06, 0xff, 0xb0, 0x00, 0x0b, 0xff, 0x60,  //.+@@%....%@@+.
-  0x02, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0x10,  //..@@@....@@@..
-  0x00, 0xdf, 0xf4, 0x00, 0x4f, 0xfd, 0x00,  //..@@@+..+@@@..
-  0x00, 0x8f, 0xf9, 0x00, 0x9f, 0xf8, 0x00,  //..%@@%..%@@%..
-  0x00, 0x4f, 0xfd, 0x00, 0xdf, 0xf4, 0x00,  //..+@@@..@@@+..
-  0x00, 0x0f, 0xff, 0x22, 0xff, 0xf0, 0x00,  //...@@@..@@@...
-  0x00, 0x0b, 0xff, 0x66, 0xff, 0xa0, 0x00,  //...%@@++@@%...
-  0x00, 0x06, 0xff, 0xbb, 0xff, 0x60, 0x00,  //...+@@%%@@+...
-  0x00, 0x01, 0xff, 0xff, 0xff, 0x10, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0xdf, 0xff, 0xfd, 0x00, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0x8f, 0xff, 0xf8, 0x00, 0x00,  //....%@@@@%....
-  0x00, 0x00, 0x4f, 0xff, 0xf3, 0x00, 0x00,  //....+@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0x0a, 0xff, 0xa0, 0x00, 0x00,  //.....%@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xde, 0x00, 0x01, 0xdf, 0xf4, 0xfe, 0x00, 0x03, 0x4f, 0xfd, 0x9f, 0xf8, 0xfe, 0x00, 0x03, 0x8f,
+  0xf9, 0x4f, 0xfd, 0xfe, 0x00, 0x49, 0xdf, 0xf4, 0x0f, 0xff, 0x20, 0x00, 0x02, 0xff, 0xf0, 0x0b,
+  0xff, 0x60, 0x00, 0x06, 0xff, 0xb0, 0x06, 0xff, 0xb0, 0x00, 0x0b, 0xff, 0x60, 0x02, 0xff, 0xf0,
+  0x00, 0x0f, 0xff, 0x10, 0x00, 0xdf, 0xf4, 0x00, 0x4f, 0xfd, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x9f,
+  0xf8, 0x00, 0x00, 0x4f, 0xfd, 0x00, 0xdf, 0xf4, 0x00, 0x00, 0x0f, 0xff, 0x22, 0xff, 0xf0, 0x00,
+  0x00, 0x0b, 0xff, 0x66, 0xff, 0xa0, 0x00, 0x00, 0x06, 0xff, 0xbb, 0xff, 0x60, 0x00, 0x00, 0x01,
+  0xfe, 0xff, 0x00, 0x10, 0xfe, 0x00, 0x02, 0xdf, 0xff, 0xfd, 0xfd, 0x00, 0x02, 0x8f, 0xff, 0xf8,
+  0xfd, 0x00, 0x02, 0x4f, 0xff, 0xf3, 0xfd, 0x00, 0x02, 0x0f, 0xff, 0xf0, 0xfd, 0x00, 0x02, 0x0a,
+  0xff, 0xa0, 0xd5, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xef, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe,  //@@@..........@@@
-  0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //@@@+........+@@@
-  0x9f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf9,  //%@@+........+@@%
-  0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xf7,  //+@@%........%@@+
-  0x5f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf4,  //+@@%........%@@+
-  0x2f, 0xfd, 0x00, 0x6f, 0xf6, 0x00, 0xdf, 0xf2,  //.@@@..+@@+..@@@.
-  0x0f, 0xff, 0x00, 0xaf, 0xfa, 0x00, 0xff, 0xf0,  //.@@@..%@@%..@@@.
-  0x0d, 0xff, 0x20, 0xdf, 0xfd, 0x02, 0xff, 0xd0,  //.@@@..@@@@..@@@.
-  0x0b, 0xff, 0x51, 0xfc, 0xcf, 0x05, 0xff, 0xb0,  //.%@@+.@@@@.+@@%.
-  0x08, 0xff, 0x74, 0xf8, 0x8f, 0x47, 0xff, 0x80,  //.%@@++@%%@++@@%.
-  0x06, 0xff, 0x97, 0xf5, 0x5f, 0x79, 0xff, 0x60,  //.+@@%+@++@+%@@+.
-  0x03, 0xff, 0xcb, 0xf1, 0x1f, 0xac, 0xff, 0x30,  //..@@@%@..@%@@@..
-  0x01, 0xff, 0xee, 0xd0, 0x0d, 0xee, 0xff, 0x10,  //..@@@@@..@@@@@..
-  0x00, 0xff, 0xff, 0xa0, 0x0a, 0xff, 0xff, 0x00,  //..@@@@%..%@@@@..
-  0x00, 0xcf, 0xff, 0x60, 0x06, 0xff, 0xfc, 0x00,  //..@@@@+..+@@@@..
-  0x00, 0xaf, 0xff, 0x20, 0x02, 0xff, 0xfa, 0x00,  //..%@@@....@@@%..
-  0x00, 0x7f, 0xfe, 0x00, 0x00, 0xef, 0xf7, 0x00,  //..+@@@....@@@+..
-  0x00, 0x5f, 0xfb, 0x00, 0x00, 0xbf, 0xf5, 0x00,  //..+@@%....%@@+..
-  0x00, 0x2f, 0xf7, 0x00, 0x00, 0x7f, 0xf2, 0x00,  //...@@+....+@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xd9, 0x00, 0x01, 0xef, 0xf1, 0xfd, 0x00, 0x03, 0x1f, 0xfe, 0xcf, 0xf4, 0xfd, 0x00, 0x03, 0x4f,
+  0xfc, 0x9f, 0xf6, 0xfd, 0x00, 0x03, 0x6f, 0xf9, 0x7f, 0xf8, 0xfd, 0x00, 0x03, 0x8f, 0xf7, 0x5f,
+  0xfb, 0xfd, 0x00, 0x70, 0xbf, 0xf4, 0x2f, 0xfd, 0x00, 0x6f, 0xf6, 0x00, 0xdf, 0xf2, 0x0f, 0xff,
+  0x00, 0xaf, 0xfa, 0x00, 0xff, 0xf0, 0x0d, 0xff, 0x20, 0xdf, 0xfd, 0x02, 0xff, 0xd0, 0x0b, 0xff,
+  0x51, 0xfc, 0xcf, 0x05, 0xff, 0xb0, 0x08, 0xff, 0x74, 0xf8, 0x8f, 0x47, 0xff, 0x80, 0x06, 0xff,
+  0x97, 0xf5, 0x5f, 0x79, 0xff, 0x60, 0x03, 0xff, 0xcb, 0xf1, 0x1f, 0xac, 0xff, 0x30, 0x01, 0xff,
+  0xee, 0xd0, 0x0d, 0xee, 0xff, 0x10, 0x00, 0xff, 0xff, 0xa0, 0x0a, 0xff, 0xff, 0x00, 0x00, 0xcf,
+  0xff, 0x60, 0x06, 0xff, 0xfc, 0x00, 0x00, 0xaf, 0xff, 0x20, 0x02, 0xff, 0xfa, 0x00, 0x00, 0x7f,
+  0xfe, 0x00, 0x00, 0xef, 0xf7, 0x00, 0x00, 0x5f, 0xfb, 0x00, 0x00, 0xbf, 0xf5, 0x00, 0x00, 0x2f,
+  0xf7, 0x00, 0x00, 0x7f, 0xf2, 0xd0, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xaf, 0xfd, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xa0,  //%@@@.......@@@%
-  0x1e, 0xff, 0x90, 0x00, 0x00, 0xaf, 0xfe, 0x10,  //.@@@%.....%@@@.
-  0x05, 0xff, 0xf3, 0x00, 0x05, 0xff, 0xf4, 0x00,  //.+@@@....+@@@+.
-  0x00, 0xaf, 0xfd, 0x00, 0x1e, 0xff, 0x90, 0x00,  //..%@@@...@@@%..
-  0x00, 0x1e, 0xff, 0x90, 0xbf, 0xfd, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x05, 0xff, 0xf9, 0xff, 0xf3, 0x00, 0x00,  //...+@@@%@@@....
-  0x00, 0x00, 0xbf, 0xff, 0xff, 0x80, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x1e, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x06, 0xff, 0xf3, 0x00, 0x00, 0x00,  //.....+@@@......
-  0x00, 0x00, 0x06, 0xff, 0xf3, 0x00, 0x00, 0x00,  //.....+@@@......
-  0x00, 0x00, 0x1e, 0xff, 0xfc, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x9f, 0xff, 0xff, 0x60, 0x00, 0x00,  //....%@@@@@+....
-  0x00, 0x03, 0xff, 0xfb, 0xff, 0xf1, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x0c, 0xff, 0xb0, 0xdf, 0xfa, 0x00, 0x00,  //...@@@%.@@@%...
-  0x00, 0x5f, 0xff, 0x20, 0x4f, 0xff, 0x40, 0x00,  //..+@@@..+@@@+..
-  0x00, 0xef, 0xf8, 0x00, 0x0a, 0xff, 0xd0, 0x00,  //..@@@%...%@@@..
-  0x08, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf7, 0x00,  //.%@@@.....@@@+.
-  0x2f, 0xff, 0x50, 0x00, 0x00, 0x6f, 0xff, 0x10,  //.@@@+.....+@@@.
-  0xbf, 0xfc, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xb0,  //%@@@.......@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x01, 0xaf, 0xfd, 0xfe, 0x00, 0x20, 0x1e, 0xff, 0xa0, 0x1e, 0xff, 0x90, 0x00, 0x00,
+  0xaf, 0xfe, 0x10, 0x05, 0xff, 0xf3, 0x00, 0x05, 0xff, 0xf4, 0x00, 0x00, 0xaf, 0xfd, 0x00, 0x1e,
+  0xff, 0x90, 0x00, 0x00, 0x1e, 0xff, 0x90, 0xbf, 0xfd, 0xfe, 0x00, 0x04, 0x05, 0xff, 0xf9, 0xff,
+  0xf3, 0xfd, 0x00, 0x03, 0xbf, 0xff, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x1e, 0xff, 0xfd, 0xfc, 0x00,
+  0x02, 0x06, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x06, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x1e, 0xff, 0xfc,
+  0xfc, 0x00, 0x03, 0x9f, 0xff, 0xff, 0x60, 0xfe, 0x00, 0x04, 0x03, 0xff, 0xfb, 0xff, 0xf1, 0xfe,
+  0x00, 0x04, 0x0c, 0xff, 0xb0, 0xdf, 0xfa, 0xfe, 0x00, 0x20, 0x5f, 0xff, 0x20, 0x4f, 0xff, 0x40,
+  0x00, 0x00, 0xef, 0xf8, 0x00, 0x0a, 0xff, 0xd0, 0x00, 0x08, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf7,
+  0x00, 0x2f, 0xff, 0x50, 0x00, 0x00, 0x6f, 0xff, 0x10, 0xbf, 0xfc, 0xfe, 0x00, 0x02, 0x0c, 0xff,
+  0xb0, 0xd1, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xbf, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xb0,  //%@@%.......%@@%
-  0x2f, 0xff, 0x40, 0x00, 0x00, 0x5f, 0xff, 0x20,  //.@@@+.....+@@@.
-  0x09, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00,  //.%@@@.....@@@%.
-  0x01, 0xef, 0xf7, 0x00, 0x07, 0xff, 0xe1, 0x00,  //..@@@+...+@@@..
-  0x00, 0x6f, 0xff, 0x10, 0x1f, 0xff, 0x60, 0x00,  //..+@@@...@@@+..
-  0x00, 0x0d, 0xff, 0x90, 0x9f, 0xfd, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x04, 0xff, 0xf6, 0xff, 0xf4, 0x00, 0x00,  //...+@@@+@@@+...
-  0x00, 0x00, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x01, 0xbf, 0xfb, 0xfe, 0x00, 0x28, 0x0b, 0xff, 0xb0, 0x2f, 0xff, 0x40, 0x00, 0x00,
+  0x5f, 0xff, 0x20, 0x09, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00, 0x01, 0xef, 0xf7, 0x00, 0x07,
+  0xff, 0xe1, 0x00, 0x00, 0x6f, 0xff, 0x10, 0x1f, 0xff, 0x60, 0x00, 0x00, 0x0d, 0xff, 0x90, 0x9f,
+  0xfd, 0xfe, 0x00, 0x04, 0x04, 0xff, 0xf6, 0xff, 0xf4, 0xfd, 0x00, 0x03, 0xbf, 0xff, 0xff, 0xb0,
+  0xfd, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfb, 0x00, 0x01,
+  0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff,
+  0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0,
+  0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xce, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xa0,  //.........@@@%
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x10,  //........+@@@.
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xf6, 0x00,  //........@@@+.
-  0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0, 0x00,  //.......%@@@..
-  0x00, 0x00, 0x00, 0x6f, 0xff, 0x20, 0x00,  //......+@@@...
-  0x00, 0x00, 0x01, 0xef, 0xf8, 0x00, 0x00,  //......@@@%...
-  0x00, 0x00, 0x0a, 0xff, 0xd0, 0x00, 0x00,  //.....%@@@....
-  0x00, 0x00, 0x4f, 0xff, 0x40, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0xdf, 0xfa, 0x00, 0x00, 0x00,  //....@@@%.....
-  0x00, 0x08, 0xff, 0xe1, 0x00, 0x00, 0x00,  //...%@@@......
-  0x00, 0x2f, 0xff, 0x60, 0x00, 0x00, 0x00,  //...@@@+......
-  0x00, 0xcf, 0xfc, 0x00, 0x00, 0x00, 0x00,  //..@@@@.......
-  0x06, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,  //.+@@@........
-  0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0xaf, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xde, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x02, 0x0d, 0xff, 0xa0,
+  0xfd, 0x00, 0x02, 0x7f, 0xff, 0x10, 0xfe, 0x00, 0x02, 0x02, 0xff, 0xf6, 0xfd, 0x00, 0x02, 0x0b,
+  0xff, 0xc0, 0xfd, 0x00, 0x02, 0x6f, 0xff, 0x20, 0xfe, 0x00, 0x02, 0x01, 0xef, 0xf8, 0xfd, 0x00,
+  0x02, 0x0a, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x4f, 0xff, 0x40, 0xfd, 0x00, 0x01, 0xdf, 0xfa, 0xfd,
+  0x00, 0x02, 0x08, 0xff, 0xe1, 0xfd, 0x00, 0x02, 0x2f, 0xff, 0x60, 0xfd, 0x00, 0x01, 0xcf, 0xfc,
+  0xfd, 0x00, 0x02, 0x06, 0xff, 0xf2, 0xfd, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xfd, 0x00, 0x01, 0xaf,
+  0xfd, 0xfc, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+005b ([) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xf0, 0x00,  //@@@...
-  0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf5, 0x00, 0xfa, 0xff, 0x37, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00,
+  0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff,
+  0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0,
+  0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xfb, 0xff, 0xf8,
+  0x00,
 
   /*Unicode: U+005c (\) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0x4f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x05, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00,  //.+@@%........
-  0x00, 0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //..@@@........
-  0x00, 0x6f, 0xf9, 0x00, 0x00, 0x00, 0x00,  //..+@@%.......
-  0x00, 0x0e, 0xff, 0x10, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x06, 0xff, 0x90, 0x00, 0x00, 0x00,  //...+@@%......
-  0x00, 0x00, 0xef, 0xf1, 0x00, 0x00, 0x00,  //....@@@......
-  0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x08, 0xff, 0x70, 0x00, 0x00,  //.....%@@+....
-  0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,  //......@@@....
-  0x00, 0x00, 0x00, 0x9f, 0xf6, 0x00, 0x00,  //......%@@+...
-  0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x09, 0xff, 0x60, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xd0, 0x00,  //........@@@..
-  0x00, 0x00, 0x00, 0x00, 0xaf, 0xf5, 0x00,  //........%@@+.
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x40,  //.........%@@+
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0,  //..........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xde, 0x00, 0x01, 0xcf, 0xf3, 0xfc, 0x00, 0x01, 0x4f, 0xfb, 0xfc, 0x00, 0x02, 0x0c, 0xff, 0x20,
+  0xfd, 0x00, 0x02, 0x05, 0xff, 0xa0, 0xfc, 0x00, 0x01, 0xdf, 0xf2, 0xfc, 0x00, 0x01, 0x6f, 0xf9,
+  0xfc, 0x00, 0x02, 0x0e, 0xff, 0x10, 0xfd, 0x00, 0x02, 0x06, 0xff, 0x90, 0xfc, 0x00, 0x01, 0xef,
+  0xf1, 0xfc, 0x00, 0x01, 0x7f, 0xf8, 0xfc, 0x00, 0x01, 0x0f, 0xfe, 0xfc, 0x00, 0x02, 0x08, 0xff,
+  0x70, 0xfd, 0x00, 0x02, 0x01, 0xff, 0xe0, 0xfc, 0x00, 0x01, 0x9f, 0xf6, 0xfc, 0x00, 0x01, 0x1f,
+  0xfe, 0xfc, 0x00, 0x02, 0x09, 0xff, 0x60, 0xfd, 0x00, 0x02, 0x02, 0xff, 0xd0, 0xfc, 0x00, 0x01,
+  0xaf, 0xf5, 0xfc, 0x00, 0x01, 0x3f, 0xfc, 0xfc, 0x00, 0x02, 0x0b, 0xff, 0x40, 0xfd, 0x00, 0x02,
+  0x03, 0xff, 0xc0, 0xe5, 0x00,
 
   /*Unicode: U+005d (]) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0x00, 0x0f, 0xff,  //...@@@
-  0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf5, 0x00, 0xfb, 0xff, 0x37, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f,
+  0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff,
+  0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00,
+  0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xfa, 0xff, 0xf8,
+  0x00,
 
   /*Unicode: U+005e (^) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00,  //.....%@@%.....
-  0x00, 0x00, 0x6f, 0xff, 0xf6, 0x00, 0x00,  //....+@@@@+....
-  0x00, 0x03, 0xff, 0x88, 0xff, 0x30, 0x00,  //....@@%%@@....
-  0x00, 0x2e, 0xf9, 0x00, 0x9f, 0xe2, 0x00,  //...@@%..%@@...
-  0x00, 0xdf, 0xa0, 0x00, 0x0a, 0xfd, 0x00,  //..@@%....%@@..
-  0x0b, 0xfb, 0x00, 0x00, 0x00, 0xbf, 0xb0,  //.%@%......%@%.
-  0x9f, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xf9,  //%@%........%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xdc, 0x00, 0x02, 0x08, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x6f, 0xff, 0xf6, 0xfe, 0x00, 0x15, 0x03,
+  0xff, 0x88, 0xff, 0x30, 0x00, 0x00, 0x2e, 0xf9, 0x00, 0x9f, 0xe2, 0x00, 0x00, 0xdf, 0xa0, 0x00,
+  0x0a, 0xfd, 0x00, 0x0b, 0xfb, 0xfe, 0x00, 0x03, 0xbf, 0xb0, 0x9f, 0xb0, 0xfe, 0x00, 0x01, 0x0b,
+  0xf9, 0x83, 0x00,
 
   /*Unicode: U+005f (_) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-
+  0x81, 0x00, 0xa1, 0x00, 0xf1, 0xff,
 
   /*Unicode: U+0060 (`) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x9f, 0xc0, 0x00,  //%@@...
-  0x0c, 0xf8, 0x00,  //.@@%..
-  0x01, 0xef, 0x30,  //..@@..
-  0x00, 0x2f, 0xe0,  //...@@.
-  0x00, 0x05, 0xfa,  //...+@%
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf8, 0x00, 0x0e, 0x9f, 0xc0, 0x00, 0x0c, 0xf8, 0x00, 0x01, 0xef, 0x30, 0x00, 0x2f, 0xe0, 0x00,
+  0x05, 0xfa, 0xbf, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0x06, 0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83,
+  0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00, 0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a,
+  0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc, 0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4,
+  0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,
+  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff, 0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2,
+  0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x40,  //@@@%@@@@@@+.
-  0xff, 0xff, 0x81, 0x17, 0xff, 0xe0,  //@@@@%..+@@@.
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xff, 0x71, 0x17, 0xff, 0xe0,  //@@@@+..+@@@.
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x30,  //@@@%@@@@@@..
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe9, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x07, 0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00, 0xff, 0xf8, 0xfe, 0xff, 0x3e, 0x40, 0xff, 0xff, 0x81,
+  0x17, 0xff, 0xe0, 0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xff,
+  0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xff, 0xfa, 0x00,
+  0x00, 0xaf, 0xf6, 0xff, 0xff, 0x71, 0x17, 0xff, 0xe0, 0xff, 0xf8, 0xfe, 0xff, 0x05, 0x30, 0xff,
+  0xf0, 0x6d, 0xfe, 0xa2, 0xdc, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x03, 0xad, 0xfe, 0xb3, 0x00,  //....%@@@%..
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0x70,  //..%@@@@@@@+
-  0x0a, 0xff, 0xd5, 0x10, 0x3a, 0xf0,  //.%@@@+...%@
-  0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70,  //+@@@......+
-  0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70,  //+@@@......+
-  0x0a, 0xff, 0xd5, 0x10, 0x2a, 0xf0,  //.%@@@+...%@
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0x70,  //..%@@@@@@@+
-  0x00, 0x04, 0xad, 0xff, 0xb3, 0x00,  //...+%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc4, 0x00, 0x06, 0x03, 0xad, 0xfe, 0xb3, 0x00, 0x00, 0xaf, 0xfe, 0xff, 0x0e, 0x70, 0x0a, 0xff,
+  0xd5, 0x10, 0x3a, 0xf0, 0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70, 0xaf, 0xf6, 0xfd, 0x00, 0x01, 0xdf,
+  0xf2, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xdf, 0xf2,
+  0xfd, 0x00, 0x01, 0xaf, 0xf6, 0xfd, 0x00, 0x0d, 0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70, 0x0a, 0xff,
+  0xd5, 0x10, 0x2a, 0xf0, 0x00, 0xaf, 0xfe, 0xff, 0x05, 0x70, 0x00, 0x04, 0xad, 0xff, 0xb3, 0xdc,
+  0x00,
 
   /*Unicode: U+0064 (d) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff,  //...%@@@+.@@@
-  0x04, 0xff, 0xff, 0xff, 0x8f, 0xff,  //.+@@@@@@%@@@
-  0x0e, 0xff, 0x71, 0x18, 0xff, 0xff,  //.@@@+..%@@@@
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0x0e, 0xff, 0x71, 0x18, 0xff, 0xff,  //.@@@+..%@@@@
-  0x03, 0xff, 0xff, 0xff, 0x8f, 0xff,  //..@@@@@@%@@@
-  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe5, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd,
+  0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x08, 0x0f, 0xff, 0x00, 0x2a,
+  0xef, 0xd6, 0x0f, 0xff, 0x04, 0xfe, 0xff, 0x3e, 0x8f, 0xff, 0x0e, 0xff, 0x71, 0x18, 0xff, 0xff,
+  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff, 0xef, 0xf1, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1,
+  0x00, 0x00, 0x1f, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff,
+  0x0e, 0xff, 0x71, 0x18, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x07, 0x8f, 0xff, 0x00, 0x2a, 0xef, 0xd6,
+  0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0x9d, 0xff, 0xc7, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x00,  //..%@@@@@@@@..
-  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00,  //.%@@@...%@@@.
-  0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60,  //.@@@.....%@@+
-  0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0,  //%@@+......@@%
-  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x4f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00,  //.%@@%+...+%@.
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xba, 0x00, 0x03, 0x03, 0x9d, 0xff, 0xc7, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x1d, 0xd2, 0x00,
+  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00, 0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x9f, 0xf5,
+  0x00, 0x00, 0x03, 0xff, 0xb0, 0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xf0,
+  0xfb, 0xff, 0x02, 0xf0, 0xdf, 0xe0, 0xfc, 0x00, 0x01, 0xaf, 0xf1, 0xfc, 0x00, 0x01, 0x4f, 0xfa,
+  0xfc, 0x00, 0x08, 0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00, 0x00, 0xaf, 0xfd, 0xff, 0x06, 0x00,
+  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0xd6, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x01, 0x8d, 0xff, 0xff,  //......%@@@@@
-  0x00, 0x00, 0x1e, 0xff, 0xff, 0xff,  //.....@@@@@@@
-  0x00, 0x00, 0x9f, 0xfa, 0x10, 0x00,  //....%@@%....
-  0x00, 0x00, 0xdf, 0xf2, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe7, 0x00, 0x06, 0x01, 0x8d, 0xff, 0xff, 0x00, 0x00, 0x1e, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x9f,
+  0xfa, 0x10, 0xfe, 0x00, 0x01, 0xdf, 0xf2, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0xff,
+  0xf0, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xdb, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff,  //...%@@@+.@@@
-  0x03, 0xff, 0xff, 0xff, 0x7f, 0xff,  //..@@@@@@+@@@
-  0x0e, 0xff, 0x81, 0x07, 0xff, 0xff,  //.@@@%..+@@@@
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0x6f, 0xfb, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0x0e, 0xff, 0x81, 0x07, 0xff, 0xff,  //.@@@%..+@@@@
-  0x03, 0xff, 0xff, 0xff, 0x6f, 0xff,  //..@@@@@@+@@@
-  0x00, 0x2a, 0xef, 0xc5, 0x0f, 0xff,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x6f, 0xf9,  //........+@@%
-  0x00, 0xc6, 0x20, 0x16, 0xff, 0xf3,  //..@+...+@@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0x60,  //..@@@@@@@@+.
-  0x00, 0x28, 0xdf, 0xfe, 0xa3, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc4, 0x00, 0x05, 0x2a, 0xef, 0xd6, 0x0f, 0xff, 0x03, 0xfe, 0xff, 0x3e, 0x7f, 0xff, 0x0e, 0xff,
+  0x81, 0x07, 0xff, 0xff, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,
+  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff, 0x6f, 0xfb,
+  0x00, 0x00, 0xaf, 0xff, 0x0e, 0xff, 0x81, 0x07, 0xff, 0xff, 0x03, 0xfe, 0xff, 0x07, 0x6f, 0xff,
+  0x00, 0x2a, 0xef, 0xc5, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x1f, 0xfd, 0xfd, 0x00, 0x08, 0x6f, 0xf9,
+  0x00, 0xc6, 0x20, 0x16, 0xff, 0xf3, 0x00, 0xfd, 0xff, 0x05, 0x60, 0x00, 0x28, 0xdf, 0xfe, 0xa3,
+  0xfa, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x4b, 0xff, 0xb2, 0x00,  //@@@.+%@@%..
-  0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10,  //@@@+@@@@@@.
-  0xff, 0xfe, 0x50, 0x2d, 0xff, 0x80,  //@@@@+..@@@%
-  0xff, 0xf8, 0x00, 0x04, 0xff, 0xc0,  //@@@%...+@@@
-  0xff, 0xf3, 0x00, 0x01, 0xff, 0xe0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe9, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x53, 0xff, 0xf0, 0x4b, 0xff, 0xb2, 0x00, 0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10, 0xff, 0xfe, 0x50,
+  0x2d, 0xff, 0x80, 0xff, 0xf8, 0x00, 0x04, 0xff, 0xc0, 0xff, 0xf3, 0x00, 0x01, 0xff, 0xe0, 0xff,
+  0xf1, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe3, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xe9,
+  0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0xfb,
+  0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+006a (j) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x0f, 0xff, 0xff, 0xff,  //.@@@@@@@
-  0x0f, 0xff, 0xff, 0xff,  //.@@@@@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x0f, 0xff,  //.....@@@
-  0x00, 0x00, 0x3f, 0xfd,  //.....@@@
-  0x00, 0x02, 0xcf, 0xf7,  //....@@@+
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@.
-  0xff, 0xff, 0xd7, 0x00,  //@@@@@+..
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xef, 0x00, 0x09, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xf5, 0x00, 0x00,
+  0x0f, 0xfe, 0xff, 0x00, 0x0f, 0xfe, 0xff, 0x3b, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfd,
+  0x00, 0x02, 0xcf, 0xf7, 0xfe, 0xff, 0x03, 0xc0, 0xff, 0xff, 0xd7, 0xfc, 0x00,
 
   /*Unicode: U+006b (k) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xf0, 0x00, 0x00, 0xcf, 0xff, 0x40,  //@@@.....@@@@+
-  0xff, 0xf0, 0x00, 0x0c, 0xff, 0xf5, 0x00,  //@@@....@@@@+.
-  0xff, 0xf0, 0x00, 0xcf, 0xff, 0x50, 0x00,  //@@@...@@@@+..
-  0xff, 0xf0, 0x0b, 0xff, 0xf6, 0x00, 0x00,  //@@@..%@@@+...
-  0xff, 0xf0, 0xbf, 0xff, 0x60, 0x00, 0x00,  //@@@.%@@@+....
-  0xff, 0xfa, 0xff, 0xf7, 0x00, 0x00, 0x00,  //@@@%@@@+.....
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,  //@@@@@@@......
-  0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00,  //@@@@@@@%.....
-  0xff, 0xff, 0xcf, 0xff, 0x40, 0x00, 0x00,  //@@@@@@@@+....
-  0xff, 0xf9, 0x0a, 0xff, 0xd0, 0x00, 0x00,  //@@@%.%@@@....
-  0xff, 0xf0, 0x01, 0xef, 0xf9, 0x00, 0x00,  //@@@...@@@%...
-  0xff, 0xf0, 0x00, 0x5f, 0xff, 0x40, 0x00,  //@@@...+@@@+..
-  0xff, 0xf0, 0x00, 0x0a, 0xff, 0xe1, 0x00,  //@@@....%@@@..
-  0xff, 0xf0, 0x00, 0x01, 0xef, 0xfa, 0x00,  //@@@.....@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe5, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0xff, 0xf0, 0xfc,
+  0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00,
+  0x26, 0xff, 0xf0, 0x00, 0x00, 0xcf, 0xff, 0x40, 0xff, 0xf0, 0x00, 0x0c, 0xff, 0xf5, 0x00, 0xff,
+  0xf0, 0x00, 0xcf, 0xff, 0x50, 0x00, 0xff, 0xf0, 0x0b, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf0, 0xbf,
+  0xff, 0x60, 0x00, 0x00, 0xff, 0xfa, 0xff, 0xf7, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0xe0, 0xfe, 0x00,
+  0xfe, 0xff, 0x00, 0xf9, 0xfe, 0x00, 0x28, 0xff, 0xff, 0xcf, 0xff, 0x40, 0x00, 0x00, 0xff, 0xf9,
+  0x0a, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xf0, 0x01, 0xef, 0xf9, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x5f,
+  0xff, 0x40, 0x00, 0xff, 0xf0, 0x00, 0x0a, 0xff, 0xe1, 0x00, 0xff, 0xf0, 0x00, 0x01, 0xef, 0xfa,
+  0xd6, 0x00,
 
   /*Unicode: U+006c (l) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@@@@.....
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x10, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0c, 0xff, 0x40, 0x00, 0x00,  //.....@@@+....
-  0x00, 0x00, 0x07, 0xff, 0xd2, 0x00, 0x00,  //.....+@@@....
-  0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xf0,  //......@@@@@@@
-  0x00, 0x00, 0x00, 0x07, 0xcf, 0xff, 0xf0,  //.......+@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe5, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01,
+  0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f,
+  0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0x10, 0xfd,
+  0x00, 0x02, 0x0c, 0xff, 0x40, 0xfd, 0x00, 0x02, 0x07, 0xff, 0xd2, 0xfc, 0x00, 0x03, 0xcf, 0xff,
+  0xff, 0xf0, 0xfe, 0x00, 0x03, 0x07, 0xcf, 0xff, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+006d (m) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xf3, 0xdf, 0x80, 0x7e, 0xf9, 0x00,  //@@@.@@%.+@@%.
-  0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0x60,  //@@@@@@@%@@@@+
-  0xff, 0xf6, 0x6f, 0xff, 0x65, 0xff, 0xb0,  //@@@++@@@++@@%
-  0xff, 0xf1, 0x1f, 0xff, 0x11, 0xff, 0xd0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //@@@..@@@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbb, 0x00, 0x61, 0xff, 0xf3, 0xdf, 0x80, 0x7e, 0xf9, 0x00, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff,
+  0x60, 0xff, 0xf6, 0x6f, 0xff, 0x65, 0xff, 0xb0, 0xff, 0xf1, 0x1f, 0xff, 0x11, 0xff, 0xd0, 0xff,
+  0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f,
+  0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00,
+  0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,
+  0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+  0x0f, 0xff, 0x00, 0xff, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+006e (n) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x4b, 0xff, 0xb2, 0x00,  //@@@.+%@@%..
-  0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10,  //@@@+@@@@@@.
-  0xff, 0xfe, 0x50, 0x2d, 0xff, 0x80,  //@@@@+..@@@%
-  0xff, 0xf8, 0x00, 0x04, 0xff, 0xc0,  //@@@%...+@@@
-  0xff, 0xf3, 0x00, 0x01, 0xff, 0xe0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc5, 0x00, 0x53, 0xff, 0xf0, 0x4b, 0xff, 0xb2, 0x00, 0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10, 0xff,
+  0xfe, 0x50, 0x2d, 0xff, 0x80, 0xff, 0xf8, 0x00, 0x04, 0xff, 0xc0, 0xff, 0xf3, 0x00, 0x01, 0xff,
+  0xe0, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+006f (o) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc4, 0x00, 0x51, 0x18, 0xdf, 0xfd, 0x81, 0x00, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0e, 0xff,
+  0x71, 0x17, 0xff, 0xd0, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,
+  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0x6f, 0xfa,
+  0x00, 0x00, 0xaf, 0xf6, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,
+  0x00, 0x18, 0xdf, 0xfd, 0x81, 0xdc, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x30,  //@@@%@@@@@@..
-  0xff, 0xff, 0x81, 0x17, 0xff, 0xe0,  //@@@@%..+@@@.
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xff, 0x71, 0x07, 0xff, 0xe0,  //@@@@+..+@@@.
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x40,  //@@@%@@@@@@+.
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0x07, 0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00, 0xff, 0xf8, 0xfe, 0xff, 0x3e, 0x30, 0xff,
+  0xff, 0x81, 0x17, 0xff, 0xe0, 0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xff, 0xf4, 0x00, 0x00, 0x4f,
+  0xfb, 0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xff,
+  0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xff, 0xff, 0x71, 0x07, 0xff, 0xe0, 0xff, 0xf8, 0xfe, 0xff, 0x08,
+  0x40, 0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff,  //...%@@@+.@@@
-  0x03, 0xff, 0xff, 0xff, 0x8f, 0xff,  //..@@@@@@%@@@
-  0x0e, 0xff, 0x71, 0x18, 0xff, 0xff,  //.@@@+..%@@@@
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,  //%@@+....+@@@
-  0x7f, 0xfa, 0x00, 0x00, 0xaf, 0xff,  //+@@%....%@@@
-  0x0e, 0xff, 0x70, 0x17, 0xff, 0xff,  //.@@@+..+@@@@
-  0x04, 0xff, 0xff, 0xff, 0x8f, 0xff,  //.+@@@@@@%@@@
-  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc4, 0x00, 0x05, 0x2a, 0xef, 0xd6, 0x0f, 0xff, 0x03, 0xfe, 0xff, 0x3e, 0x8f, 0xff, 0x0e, 0xff,
+  0x71, 0x18, 0xff, 0xff, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff,
+  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xff, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xff, 0x7f, 0xfa,
+  0x00, 0x00, 0xaf, 0xff, 0x0e, 0xff, 0x70, 0x17, 0xff, 0xff, 0x04, 0xfe, 0xff, 0x07, 0x8f, 0xff,
+  0x00, 0x2a, 0xef, 0xd6, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff,
+  0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+0072 (r) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xf0, 0x2a, 0xef, 0xc5,  //@@@..%@@@+
-  0xff, 0xf3, 0xff, 0xff, 0xff,  //@@@.@@@@@@
-  0xff, 0xfc, 0xd4, 0x00, 0x3a,  //@@@@@+...%
-  0xff, 0xfe, 0x00, 0x00, 0x00,  //@@@@......
-  0xff, 0xf6, 0x00, 0x00, 0x00,  //@@@+......
-  0xff, 0xf2, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xf0, 0x00, 0x00, 0x00,  //@@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xcf, 0x00, 0x06, 0xff, 0xf0, 0x2a, 0xef, 0xc5, 0xff, 0xf3, 0xfd, 0xff, 0x05, 0xfc, 0xd4, 0x00,
+  0x3a, 0xff, 0xfe, 0xfe, 0x00, 0x01, 0xff, 0xf6, 0xfe, 0x00, 0x01, 0xff, 0xf2, 0xfe, 0x00, 0x01,
+  0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff,
+  0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0,
+  0xfe, 0x00, 0x01, 0xff, 0xf0, 0xe0, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x01, 0x9d, 0xff, 0xd9, 0x30,  //..%@@@@%..
-  0x2e, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@.
-  0xbf, 0xfa, 0x20, 0x15, 0xb0,  //%@@%...+%.
-  0xff, 0xf1, 0x00, 0x00, 0x00,  //@@@.......
-  0xef, 0xfa, 0x40, 0x00, 0x00,  //@@@%+.....
-  0xaf, 0xff, 0xff, 0xb6, 0x00,  //%@@@@@%+..
-  0x1c, 0xff, 0xff, 0xff, 0xc1,  //.@@@@@@@@.
-  0x00, 0x49, 0xdf, 0xff, 0xfa,  //..+%@@@@@%
-  0x00, 0x00, 0x02, 0xcf, 0xfe,  //......@@@@
-  0x00, 0x00, 0x00, 0x1f, 0xff,  //.......@@@
-  0x00, 0x00, 0x00, 0x2f, 0xfe,  //.......@@@
-  0xc7, 0x30, 0x03, 0xcf, 0xfa,  //@+....@@@%
-  0xff, 0xff, 0xff, 0xff, 0xd1,  //@@@@@@@@@.
-  0x27, 0xce, 0xff, 0xc7, 0x00,  //.+@@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xcf, 0x00, 0x05, 0x01, 0x9d, 0xff, 0xd9, 0x30, 0x2e, 0xfe, 0xff, 0x07, 0xf0, 0xbf, 0xfa, 0x20,
+  0x15, 0xb0, 0xff, 0xf1, 0xfe, 0x00, 0x0a, 0xef, 0xfa, 0x40, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xb6,
+  0x00, 0x1c, 0xfe, 0xff, 0x0a, 0xc1, 0x00, 0x49, 0xdf, 0xff, 0xfa, 0x00, 0x00, 0x02, 0xcf, 0xfe,
+  0xfe, 0x00, 0x01, 0x1f, 0xff, 0xfe, 0x00, 0x06, 0x2f, 0xfe, 0xc7, 0x30, 0x03, 0xcf, 0xfa, 0xfd,
+  0xff, 0x04, 0xd1, 0x27, 0xce, 0xff, 0xc7, 0xe2, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xef, 0xf2, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0xaf, 0xfb, 0x20, 0x00,  //....%@@%....
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,  //.....@@@@@@@
-  0x00, 0x00, 0x02, 0x9d, 0xff, 0xff,  //......%@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xdb, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xef, 0xf2, 0xfd, 0x00, 0x02, 0xaf, 0xfb, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfe,
+  0xff, 0x05, 0x00, 0x00, 0x02, 0x9d, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0,  //@@@.....@@@
-  0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0,  //@@@+...%@@@
-  0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0,  //%@@@..+@@@@
-  0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0,  //.@@@@@@+@@@
-  0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc5, 0x00, 0x53, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0, 0xcf,
+  0xf4, 0x00, 0x09, 0xff, 0xf0, 0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0, 0x1e, 0xff, 0xff, 0xf5, 0xff,
+  0xf0, 0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xdf, 0xf5, 0x00, 0x00, 0x05, 0xff, 0xd0,  //@@@+.....+@@@
-  0x7f, 0xfb, 0x00, 0x00, 0x0b, 0xff, 0x70,  //+@@%.....%@@+
-  0x1f, 0xff, 0x10, 0x00, 0x1f, 0xff, 0x10,  //.@@@.....@@@.
-  0x0b, 0xff, 0x60, 0x00, 0x7f, 0xfb, 0x00,  //.%@@+...+@@%.
-  0x06, 0xff, 0xc0, 0x00, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x00, 0xff, 0xf2, 0x02, 0xff, 0xf0, 0x00,  //..@@@...@@@..
-  0x00, 0xaf, 0xf8, 0x08, 0xff, 0xa0, 0x00,  //..%@@%.%@@%..
-  0x00, 0x4f, 0xfd, 0x0d, 0xff, 0x40, 0x00,  //..+@@@.@@@+..
-  0x00, 0x0e, 0xff, 0x7f, 0xfe, 0x00, 0x00,  //...@@@+@@@...
-  0x00, 0x09, 0xff, 0xff, 0xf9, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x03, 0xff, 0xff, 0xf3, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0xdf, 0xff, 0xd0, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x8f, 0xff, 0x80, 0x00, 0x00,  //....%@@@%....
-  0x00, 0x00, 0x2f, 0xff, 0x20, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbb, 0x00, 0x3c, 0xdf, 0xf5, 0x00, 0x00, 0x05, 0xff, 0xd0, 0x7f, 0xfb, 0x00, 0x00, 0x0b, 0xff,
+  0x70, 0x1f, 0xff, 0x10, 0x00, 0x1f, 0xff, 0x10, 0x0b, 0xff, 0x60, 0x00, 0x7f, 0xfb, 0x00, 0x06,
+  0xff, 0xc0, 0x00, 0xcf, 0xf6, 0x00, 0x00, 0xff, 0xf2, 0x02, 0xff, 0xf0, 0x00, 0x00, 0xaf, 0xf8,
+  0x08, 0xff, 0xa0, 0x00, 0x00, 0x4f, 0xfd, 0x0d, 0xff, 0x40, 0x00, 0x00, 0x0e, 0xff, 0x7f, 0xfe,
+  0xfe, 0x00, 0x03, 0x09, 0xff, 0xff, 0xf9, 0xfe, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf3, 0xfd, 0x00,
+  0x02, 0xdf, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x8f, 0xff, 0x80, 0xfd, 0x00, 0x02, 0x2f, 0xff, 0x20,
+  0xd5, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xef, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfd,  //@@@..........@@@
-  0xaf, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfa,  //%@@+........+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xf6,  //+@@%........%@@+
-  0x2f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf2,  //.@@@........@@@.
-  0x0e, 0xff, 0x20, 0x2f, 0xf2, 0x02, 0xff, 0xe0,  //.@@@...@@...@@@.
-  0x0a, 0xff, 0x60, 0x7f, 0xf6, 0x06, 0xff, 0xa0,  //.%@@+.+@@+.+@@%.
-  0x06, 0xff, 0xa0, 0xbe, 0xeb, 0x0a, 0xff, 0x60,  //.+@@%.%@@%.%@@+.
-  0x02, 0xff, 0xe0, 0xf9, 0xaf, 0x0e, 0xff, 0x20,  //..@@@.@%%@.@@@..
-  0x00, 0xef, 0xf7, 0xf4, 0x5f, 0x7f, 0xfe, 0x00,  //..@@@+@++@+@@@..
-  0x00, 0xbf, 0xfe, 0xf0, 0x0f, 0xef, 0xfa, 0x00,  //..%@@@@..@@@@%..
-  0x00, 0x7f, 0xff, 0xb0, 0x0b, 0xff, 0xf7, 0x00,  //..+@@@%..%@@@+..
-  0x00, 0x3f, 0xff, 0x60, 0x06, 0xff, 0xf3, 0x00,  //...@@@+..+@@@...
-  0x00, 0x0f, 0xff, 0x20, 0x01, 0xff, 0xf0, 0x00,  //...@@@....@@@...
-  0x00, 0x0b, 0xfd, 0x00, 0x00, 0xdf, 0xb0, 0x00,  //...%@@....@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xb1, 0x00, 0x01, 0xef, 0xf3, 0xfd, 0x00, 0x03, 0x3f, 0xfd, 0xaf, 0xf7, 0xfd, 0x00, 0x03, 0x7f,
+  0xfa, 0x6f, 0xfa, 0xfd, 0x00, 0x03, 0xbf, 0xf6, 0x2f, 0xfe, 0xfd, 0x00, 0x50, 0xef, 0xf2, 0x0e,
+  0xff, 0x20, 0x2f, 0xf2, 0x02, 0xff, 0xe0, 0x0a, 0xff, 0x60, 0x7f, 0xf6, 0x06, 0xff, 0xa0, 0x06,
+  0xff, 0xa0, 0xbe, 0xeb, 0x0a, 0xff, 0x60, 0x02, 0xff, 0xe0, 0xf9, 0xaf, 0x0e, 0xff, 0x20, 0x00,
+  0xef, 0xf7, 0xf4, 0x5f, 0x7f, 0xfe, 0x00, 0x00, 0xbf, 0xfe, 0xf0, 0x0f, 0xef, 0xfa, 0x00, 0x00,
+  0x7f, 0xff, 0xb0, 0x0b, 0xff, 0xf7, 0x00, 0x00, 0x3f, 0xff, 0x60, 0x06, 0xff, 0xf3, 0x00, 0x00,
+  0x0f, 0xff, 0x20, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x0b, 0xfd, 0x00, 0x00, 0xdf, 0xb0, 0xd0, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x0a, 0xff, 0xe1, 0x00, 0x1e, 0xff, 0xa0,  //.%@@@....@@@%.
-  0x00, 0xdf, 0xfb, 0x00, 0xcf, 0xfd, 0x00,  //..@@@%..@@@@..
-  0x00, 0x3f, 0xff, 0x77, 0xff, 0xf3, 0x00,  //...@@@++@@@...
-  0x00, 0x07, 0xff, 0xff, 0xff, 0x70, 0x00,  //...+@@@@@@+...
-  0x00, 0x00, 0xcf, 0xff, 0xfc, 0x00, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0x1e, 0xff, 0xe1, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0x06, 0xff, 0x60, 0x00, 0x00,  //.....+@@+.....
-  0x00, 0x00, 0x0c, 0xff, 0xc0, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0xaf, 0xff, 0xf9, 0x00, 0x00,  //....%@@@@%....
-  0x00, 0x06, 0xff, 0xff, 0xff, 0x60, 0x00,  //...+@@@@@@+...
-  0x00, 0x3f, 0xff, 0x99, 0xff, 0xf3, 0x00,  //...@@@%%@@@...
-  0x01, 0xef, 0xfc, 0x00, 0xcf, 0xfe, 0x10,  //..@@@@..@@@@..
-  0x0c, 0xff, 0xe1, 0x00, 0x1e, 0xff, 0xc0,  //.@@@@....@@@@.
-  0x9f, 0xff, 0x30, 0x00, 0x03, 0xff, 0xf9,  //%@@@......@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xbb, 0x00, 0x16, 0x0a, 0xff, 0xe1, 0x00, 0x1e, 0xff, 0xa0, 0x00, 0xdf, 0xfb, 0x00, 0xcf, 0xfd,
+  0x00, 0x00, 0x3f, 0xff, 0x77, 0xff, 0xf3, 0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0x70, 0xfe, 0x00,
+  0x02, 0xcf, 0xff, 0xfc, 0xfd, 0x00, 0x02, 0x1e, 0xff, 0xe1, 0xfd, 0x00, 0x02, 0x06, 0xff, 0x60,
+  0xfd, 0x00, 0x02, 0x0c, 0xff, 0xc0, 0xfd, 0x00, 0x02, 0xaf, 0xff, 0xf9, 0xfe, 0x00, 0x00, 0x06,
+  0xfe, 0xff, 0x1d, 0x60, 0x00, 0x00, 0x3f, 0xff, 0x99, 0xff, 0xf3, 0x00, 0x01, 0xef, 0xfc, 0x00,
+  0xcf, 0xfe, 0x10, 0x0c, 0xff, 0xe1, 0x00, 0x1e, 0xff, 0xc0, 0x9f, 0xff, 0x30, 0x00, 0x03, 0xff,
+  0xf9, 0xd7, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcf, 0xf6, 0x00, 0x00, 0x06, 0xff, 0xc0,  //@@@+.....+@@@
-  0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff, 0x60,  //+@@@.....@@@+
-  0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff, 0x00,  //.@@@.....@@@.
-  0x09, 0xff, 0xa0, 0x00, 0x9f, 0xf9, 0x00,  //.%@@%...%@@%.
-  0x03, 0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00,  //..@@@...@@@..
-  0x00, 0xcf, 0xf6, 0x06, 0xff, 0xd0, 0x00,  //..@@@+.+@@@..
-  0x00, 0x6f, 0xfd, 0x0c, 0xff, 0x60, 0x00,  //..+@@@.@@@+..
-  0x00, 0x0f, 0xff, 0x6f, 0xff, 0x10, 0x00,  //...@@@+@@@...
-  0x00, 0x09, 0xff, 0xff, 0xfa, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0xcf, 0xff, 0xd0, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x6f, 0xff, 0x70, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x2f, 0xff, 0x10, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0xdf, 0xf5, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x04, 0xff, 0xe0, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x2d, 0xff, 0x80, 0x00, 0x00, 0x00,  //...@@@%......
-  0x0f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x0f, 0xfe, 0xa1, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbb, 0x00, 0x3c, 0xcf, 0xf6, 0x00, 0x00, 0x06, 0xff, 0xc0, 0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff,
+  0x60, 0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff, 0x00, 0x09, 0xff, 0xa0, 0x00, 0x9f, 0xf9, 0x00, 0x03,
+  0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xf6, 0x06, 0xff, 0xd0, 0x00, 0x00, 0x6f, 0xfd,
+  0x0c, 0xff, 0x60, 0x00, 0x00, 0x0f, 0xff, 0x6f, 0xff, 0x10, 0x00, 0x00, 0x09, 0xff, 0xff, 0xfa,
+  0xfe, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf4, 0xfd, 0x00, 0x02, 0xcf, 0xff, 0xd0, 0xfd, 0x00, 0x02,
+  0x6f, 0xff, 0x70, 0xfd, 0x00, 0x02, 0x2f, 0xff, 0x10, 0xfd, 0x00, 0x01, 0x7f, 0xfb, 0xfc, 0x00,
+  0x01, 0xdf, 0xf5, 0xfd, 0x00, 0x02, 0x04, 0xff, 0xe0, 0xfd, 0x00, 0x02, 0x2d, 0xff, 0x80, 0xfe,
+  0x00, 0x02, 0x0f, 0xff, 0xfd, 0xfd, 0x00, 0x02, 0x0f, 0xfe, 0xa1, 0xf6, 0x00,
 
   /*Unicode: U+007a (z) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x4f, 0xff, 0xa0,  //......+@@@%
-  0x00, 0x00, 0x01, 0xef, 0xfd, 0x00,  //......@@@@.
-  0x00, 0x00, 0x0b, 0xff, 0xf3, 0x00,  //.....%@@@..
-  0x00, 0x00, 0x6f, 0xff, 0x70, 0x00,  //....+@@@+..
-  0x00, 0x02, 0xff, 0xfb, 0x00, 0x00,  //....@@@%...
-  0x00, 0x0c, 0xff, 0xe1, 0x00, 0x00,  //...@@@@....
-  0x00, 0x8f, 0xff, 0x30, 0x00, 0x00,  //..%@@@.....
-  0x04, 0xff, 0xf7, 0x00, 0x00, 0x00,  //.+@@@+.....
-  0x1e, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.@@@%......
-  0xbf, 0xfe, 0x10, 0x00, 0x00, 0x00,  //%@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc5, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x07, 0x4f, 0xff, 0xa0,
+  0x00, 0x00, 0x01, 0xef, 0xfd, 0xfe, 0x00, 0x02, 0x0b, 0xff, 0xf3, 0xfe, 0x00, 0x07, 0x6f, 0xff,
+  0x70, 0x00, 0x00, 0x02, 0xff, 0xfb, 0xfe, 0x00, 0x02, 0x0c, 0xff, 0xe1, 0xfe, 0x00, 0x07, 0x8f,
+  0xff, 0x30, 0x00, 0x00, 0x04, 0xff, 0xf7, 0xfe, 0x00, 0x02, 0x1e, 0xff, 0xb0, 0xfe, 0x00, 0x02,
+  0xbf, 0xfe, 0x10, 0xfe, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+007b ({) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x03, 0x9c, 0xef, 0xf0,  //......%@@@@
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0,  //.....@@@@@@
-  0x00, 0x00, 0xbf, 0xfa, 0x20, 0x00,  //....%@@%...
-  0x00, 0x00, 0xef, 0xf2, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x04, 0xff, 0xd0, 0x00, 0x00,  //...+@@@....
-  0x00, 0x3d, 0xff, 0x60, 0x00, 0x00,  //...@@@+....
-  0xff, 0xff, 0xd6, 0x00, 0x00, 0x00,  //@@@@@+.....
-  0xff, 0xff, 0xc6, 0x00, 0x00, 0x00,  //@@@@@+.....
-  0x00, 0x4d, 0xff, 0x60, 0x00, 0x00,  //..+@@@+....
-  0x00, 0x04, 0xff, 0xd0, 0x00, 0x00,  //...+@@@....
-  0x00, 0x01, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xef, 0xf2, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xbf, 0xfa, 0x20, 0x00,  //....%@@%...
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0,  //.....@@@@@@
-  0x00, 0x00, 0x03, 0x9d, 0xef, 0xf0,  //......%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe7, 0x00, 0x0e, 0x03, 0x9c, 0xef, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xbf,
+  0xfa, 0x20, 0xfe, 0x00, 0x01, 0xef, 0xf2, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfe, 0x00, 0x02, 0x04, 0xff, 0xd0, 0xfe, 0x00, 0x07, 0x3d, 0xff, 0x60, 0x00, 0x00, 0xff, 0xff,
+  0xd6, 0xfe, 0x00, 0x02, 0xff, 0xff, 0xc6, 0xfd, 0x00, 0x02, 0x4d, 0xff, 0x60, 0xfe, 0x00, 0x02,
+  0x04, 0xff, 0xd0, 0xfe, 0x00, 0x02, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xef, 0xf2, 0xfd, 0x00, 0x02, 0xbf, 0xfa, 0x20, 0xfe, 0x00, 0x09, 0x3f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x03, 0x9d, 0xef, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-
+  0xfd, 0x00, 0xe7, 0xff,
 
   /*Unicode: U+007d (}) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xec, 0x92, 0x00, 0x00, 0x00,  //@@@@%......
-  0xff, 0xff, 0xff, 0x30, 0x00, 0x00,  //@@@@@@.....
-  0x00, 0x2a, 0xff, 0xb0, 0x00, 0x00,  //...%@@%....
-  0x00, 0x02, 0xff, 0xe0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xdf, 0xf4, 0x00, 0x00,  //....@@@+...
-  0x00, 0x00, 0x6f, 0xfd, 0x30, 0x00,  //....+@@@...
-  0x00, 0x00, 0x06, 0xdf, 0xff, 0xf0,  //.....+@@@@@
-  0x00, 0x00, 0x05, 0xcf, 0xff, 0xf0,  //.....+@@@@@
-  0x00, 0x00, 0x6f, 0xfd, 0x40, 0x00,  //....+@@@+..
-  0x00, 0x00, 0xdf, 0xf4, 0x00, 0x00,  //....@@@+...
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x02, 0xff, 0xe0, 0x00, 0x00,  //....@@@....
-  0x00, 0x2a, 0xff, 0xb0, 0x00, 0x00,  //...%@@%....
-  0xff, 0xff, 0xff, 0x30, 0x00, 0x00,  //@@@@@@.....
-  0xff, 0xec, 0x92, 0x00, 0x00, 0x00,  //@@@@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe9, 0x00, 0x02, 0xff, 0xec, 0x92, 0xfe, 0x00, 0xfe, 0xff, 0x00, 0x30, 0xfe, 0x00, 0x02, 0x2a,
+  0xff, 0xb0, 0xfe, 0x00, 0x02, 0x02, 0xff, 0xe0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xdf, 0xf4, 0xfd, 0x00, 0x02, 0x6f, 0xfd, 0x30, 0xfe, 0x00, 0x0e, 0x06,
+  0xdf, 0xff, 0xf0, 0x00, 0x00, 0x05, 0xcf, 0xff, 0xf0, 0x00, 0x00, 0x6f, 0xfd, 0x40, 0xfe, 0x00,
+  0x01, 0xdf, 0xf4, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x02, 0x02,
+  0xff, 0xe0, 0xfe, 0x00, 0x04, 0x2a, 0xff, 0xb0, 0x00, 0x00, 0xfe, 0xff, 0x05, 0x30, 0x00, 0x00,
+  0xff, 0xec, 0x92, 0xf2, 0x00,
 
   /*Unicode: U+007e (~) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x05, 0xcf, 0xea, 0x20, 0x00, 0x00, 0x70,  //.+@@@%......+
-  0x9f, 0xff, 0xff, 0xfa, 0x30, 0x2a, 0xf0,  //%@@@@@@%...%@
-  0xfa, 0x30, 0x27, 0xef, 0xff, 0xff, 0x90,  //@%...+@@@@@@%
-  0x70, 0x00, 0x00, 0x07, 0xdf, 0xc5, 0x00,  //+......+@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0x9f, 0x00, 0x1a, 0x05, 0xcf, 0xea, 0x20, 0x00, 0x00, 0x70, 0x9f, 0xff, 0xff, 0xfa, 0x30, 0x2a,
+  0xf0, 0xfa, 0x30, 0x27, 0xef, 0xff, 0xff, 0x90, 0x70, 0x00, 0x00, 0x07, 0xdf, 0xc5, 0xac, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 8
   /*Unicode: U+0020 ( ) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x81, 0x00, 0x91, 0x00,
 
   /*Unicode: U+0021 (!) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xfc, 0xff, 0xfa,  //@@@
-  0xec, 0xff, 0xea,  //@@@
-  0xda, 0xff, 0xda,  //@@@
-  0xc8, 0xff, 0xc8,  //@@@
-  0xb8, 0xff, 0xb6,  //%@%
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xf2, 0x00, 0xe9, 0xff, 0x0e, 0xfc, 0xff, 0xfa, 0xec, 0xff, 0xea, 0xda, 0xff, 0xda, 0xc8, 0xff,
+  0xc8, 0xb8, 0xff, 0xb6, 0xf8, 0x00, 0xf8, 0xff, 0xef, 0x00,
 
   /*Unicode: U+0022 (") , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@...@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xde, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0xfd,
+  0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0x01,
+  0xff, 0xff, 0x83, 0x00,
 
   /*Unicode: U+0023 (#) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xc0, 0x00, 0x00, 0x0e, 0xfa, 0xfa, 0x0e, 0x00,  //......+@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0x7a, 0x00, 0x00, 0x50, 0xff, 0xc4, 0x00, 0x00,  //......%@+..+@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0x34, 0x00, 0x00, 0x94, 0xff, 0x7e, 0x00, 0x00,  //......@@...%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xec, 0x00, 0x00, 0x00, 0xda, 0xff, 0x38, 0x00, 0x00,  //......@@...@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xa8, 0x00, 0x00, 0x20, 0xff, 0xee, 0x02, 0x00, 0x00,  //.....+@%...@@...
-  0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x00, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x30, 0x00, 0x00, 0x00,  //.....@@...@@....
-  0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xa2, 0x00, 0x00, 0x26, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00,  //....+@%...@@....
-  0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x5c, 0x00, 0x00, 0x6a, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00,  //....%@+..+@%....
-  0x00, 0x00, 0x00, 0x06, 0xf4, 0xfc, 0x16, 0x00, 0x00, 0xb0, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00,  //....@@...%@+....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00,  //@@@@@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00,  //@@@@@@@@@@@@@@+.
-  0x00, 0x00, 0x00, 0xc4, 0xff, 0x4e, 0x00, 0x00, 0x7a, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@+..+@%.....
-  0x00, 0x00, 0x0e, 0xfa, 0xfa, 0x0c, 0x00, 0x00, 0xc0, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@...@@+.....
-  0x00, 0x00, 0x4e, 0xff, 0xc2, 0x00, 0x00, 0x0a, 0xf8, 0xfa, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@...@@......
-  0x00, 0x00, 0x94, 0xff, 0x7c, 0x00, 0x00, 0x4a, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@+..+@@......
-  0x00, 0x00, 0xd8, 0xff, 0x36, 0x00, 0x00, 0x90, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@...%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0x9b, 0x00, 0x08, 0x52, 0xff, 0xc0, 0x00, 0x00, 0x0e, 0xfa, 0xfa, 0x0e, 0xfa, 0x00, 0x07, 0x98,
+  0xff, 0x7a, 0x00, 0x00, 0x50, 0xff, 0xc4, 0xf9, 0x00, 0x07, 0xdc, 0xff, 0x34, 0x00, 0x00, 0x94,
+  0xff, 0x7e, 0xfa, 0x00, 0x02, 0x22, 0xff, 0xec, 0xfe, 0x00, 0x02, 0xda, 0xff, 0x38, 0xfa, 0x00,
+  0x08, 0x68, 0xff, 0xa8, 0x00, 0x00, 0x20, 0xff, 0xee, 0x02, 0xfe, 0x00, 0x00, 0x7e, 0xf3, 0xff,
+  0x01, 0x00, 0x7e, 0xf3, 0xff, 0xfd, 0x00, 0x02, 0x2a, 0xff, 0xe6, 0xfe, 0x00, 0x02, 0xe0, 0xff,
+  0x30, 0xfa, 0x00, 0x07, 0x70, 0xff, 0xa2, 0x00, 0x00, 0x26, 0xff, 0xe8, 0xf9, 0x00, 0x07, 0xb6,
+  0xff, 0x5c, 0x00, 0x00, 0x6a, 0xff, 0xa4, 0xfa, 0x00, 0x08, 0x06, 0xf4, 0xfc, 0x16, 0x00, 0x00,
+  0xb0, 0xff, 0x5e, 0xfd, 0x00, 0xf3, 0xff, 0x01, 0x7e, 0x00, 0xf3, 0xff, 0x00, 0x7e, 0xfd, 0x00,
+  0x07, 0xc4, 0xff, 0x4e, 0x00, 0x00, 0x7a, 0xff, 0x98, 0xfa, 0x00, 0x08, 0x0e, 0xfa, 0xfa, 0x0c,
+  0x00, 0x00, 0xc0, 0xff, 0x52, 0xfa, 0x00, 0x08, 0x4e, 0xff, 0xc2, 0x00, 0x00, 0x0a, 0xf8, 0xfa,
+  0x0e, 0xfa, 0x00, 0x07, 0x94, 0xff, 0x7c, 0x00, 0x00, 0x4a, 0xff, 0xc6, 0xf9, 0x00, 0x07, 0xd8,
+  0xff, 0x36, 0x00, 0x00, 0x90, 0xff, 0x80, 0x9b, 0x00,
 
   /*Unicode: U+0024 ($) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x58, 0xb8, 0xec, 0xff, 0xe8, 0xbe, 0x7c, 0x28, 0x00,  //..+%@@@%+..
-  0x02, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%@@@@@@@@.
-  0x76, 0xff, 0xff, 0xc2, 0x1a, 0xff, 0x12, 0x38, 0x7a, 0xd2, 0x00,  //+@@@.@..+@.
-  0xd4, 0xff, 0xff, 0x30, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xf8, 0xff, 0xff, 0x06, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xec, 0xff, 0xff, 0x1c, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..@.....
-  0xac, 0xff, 0xff, 0x9e, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@%.@.....
-  0x2a, 0xf2, 0xff, 0xff, 0xe2, 0xff, 0x56, 0x16, 0x00, 0x00, 0x00,  //.@@@@@+....
-  0x00, 0x30, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa6, 0x18, 0x00,  //..@@@@@@%..
-  0x00, 0x00, 0x00, 0x34, 0x78, 0xff, 0xf6, 0xff, 0xff, 0xe0, 0x18,  //....+@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0c, 0xb2, 0xff, 0xff, 0x9c,  //.....@.%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x24, 0xff, 0xff, 0xe6,  //.....@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x06, 0xff, 0xff, 0xf6,  //.....@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2e, 0xff, 0xff, 0xd2,  //.....@..@@@
-  0xd6, 0x84, 0x36, 0x0a, 0x00, 0xff, 0x1e, 0xc0, 0xff, 0xff, 0x6c,  //@%...@.@@@+
-  0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00,  //@@@@@@@@@%.
-  0x22, 0x6c, 0xae, 0xd2, 0xf0, 0xff, 0xec, 0xba, 0x54, 0x00, 0x00,  //.+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd0, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x01, 0xff, 0x02, 0xfb, 0x00, 0x0a,
+  0x58, 0xb8, 0xec, 0xff, 0xe8, 0xbe, 0x7c, 0x28, 0x00, 0x02, 0xac, 0xf9, 0xff, 0x11, 0x00, 0x76,
+  0xff, 0xff, 0xc2, 0x1a, 0xff, 0x12, 0x38, 0x7a, 0xd2, 0x00, 0xd4, 0xff, 0xff, 0x30, 0x00, 0xff,
+  0xfc, 0x00, 0x05, 0xf8, 0xff, 0xff, 0x06, 0x00, 0xff, 0xfc, 0x00, 0x05, 0xec, 0xff, 0xff, 0x1c,
+  0x00, 0xff, 0xfc, 0x00, 0x05, 0xac, 0xff, 0xff, 0x9e, 0x02, 0xff, 0xfc, 0x00, 0x07, 0x2a, 0xf2,
+  0xff, 0xff, 0xe2, 0xff, 0x56, 0x16, 0xfd, 0x00, 0x01, 0x30, 0xcc, 0xfd, 0xff, 0x02, 0xfa, 0xa6,
+  0x18, 0xfd, 0x00, 0x07, 0x34, 0x78, 0xff, 0xf6, 0xff, 0xff, 0xe0, 0x18, 0xfc, 0x00, 0x05, 0xff,
+  0x0c, 0xb2, 0xff, 0xff, 0x9c, 0xfc, 0x00, 0x05, 0xff, 0x00, 0x24, 0xff, 0xff, 0xe6, 0xfc, 0x00,
+  0x05, 0xff, 0x00, 0x06, 0xff, 0xff, 0xf6, 0xfc, 0x00, 0x10, 0xff, 0x00, 0x2e, 0xff, 0xff, 0xd2,
+  0xd6, 0x84, 0x36, 0x0a, 0x00, 0xff, 0x1e, 0xc0, 0xff, 0xff, 0x6c, 0xfd, 0xff, 0x00, 0xf2, 0xfd,
+  0xff, 0x0a, 0xa0, 0x00, 0x22, 0x6c, 0xae, 0xd2, 0xf0, 0xff, 0xec, 0xba, 0x54, 0xfb, 0x00, 0x01,
+  0x02, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xe6, 0x00,
 
   /*Unicode: U+0025 (%) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x2c, 0xb2, 0xf2, 0xf0, 0xae, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@%.........
-  0x2c, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xee, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@........
-  0xb4, 0xff, 0xb2, 0x18, 0x1a, 0xb4, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@%..%@%.......
-  0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@....@@.......
-  0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@....@@.......
-  0xb4, 0xff, 0xae, 0x18, 0x1a, 0xb4, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0a,  //%@%..%@%.....+.
-  0x2e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xee, 0x28, 0x00, 0x00, 0x00, 0x4a, 0xcc, 0xff, 0x54,  //.@@@@@@....+@@+
-  0x00, 0x2e, 0xb4, 0xf2, 0xf2, 0xb0, 0x28, 0x00, 0x00, 0x46, 0xc8, 0xff, 0xb6, 0x34, 0x00,  //..%@@%...+@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xc4, 0xff, 0xba, 0x38, 0x00, 0x00, 0x00,  //.......+@@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xc0, 0xff, 0xbe, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@%......
-  0x00, 0x00, 0x00, 0x38, 0xba, 0xff, 0xc4, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@+.......
-  0x00, 0x34, 0xb6, 0xff, 0xc8, 0x46, 0x00, 0x00, 0x2c, 0xb4, 0xf2, 0xf0, 0xaa, 0x22, 0x00,  //..%@@+...%@@%..
-  0x10, 0xf8, 0xcc, 0x4c, 0x00, 0x00, 0x00, 0x2c, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xea, 0x20,  //.@@+....@@@@@@.
-  0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xb0, 0x18, 0x1a, 0xb6, 0xff, 0xa6,  //.......%@%..%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf0,  //.......@@....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf2,  //.......@@....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xb0, 0x18, 0x1a, 0xb4, 0xff, 0xb0,  //.......%@%..%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xee, 0x28,  //........@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xb6, 0xf2, 0xf2, 0xb0, 0x28, 0x00,  //.........%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb5, 0x00, 0x05, 0x2c, 0xb2, 0xf2, 0xf0, 0xae, 0x26, 0xf9, 0x00, 0x01, 0x2c, 0xf2, 0xfd, 0xff,
+  0x01, 0xee, 0x24, 0xfa, 0x00, 0x07, 0xb4, 0xff, 0xb2, 0x18, 0x1a, 0xb4, 0xff, 0xaa, 0xfa, 0x00,
+  0x07, 0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf0, 0xfa, 0x00, 0x07, 0xf2, 0xff, 0x18, 0x00,
+  0x00, 0x1a, 0xff, 0xf2, 0xfa, 0x00, 0x07, 0xb4, 0xff, 0xae, 0x18, 0x1a, 0xb4, 0xff, 0xb0, 0xfc,
+  0x00, 0x03, 0x4e, 0x0a, 0x2e, 0xf2, 0xfd, 0xff, 0x01, 0xee, 0x28, 0xfe, 0x00, 0x11, 0x4a, 0xcc,
+  0xff, 0x54, 0x00, 0x2e, 0xb4, 0xf2, 0xf2, 0xb0, 0x28, 0x00, 0x00, 0x46, 0xc8, 0xff, 0xb6, 0x34,
+  0xf9, 0x00, 0x04, 0x42, 0xc4, 0xff, 0xba, 0x38, 0xf9, 0x00, 0x04, 0x3e, 0xc0, 0xff, 0xbe, 0x3c,
+  0xf9, 0x00, 0x04, 0x38, 0xba, 0xff, 0xc4, 0x42, 0xf9, 0x00, 0x11, 0x34, 0xb6, 0xff, 0xc8, 0x46,
+  0x00, 0x00, 0x2c, 0xb4, 0xf2, 0xf0, 0xaa, 0x22, 0x00, 0x10, 0xf8, 0xcc, 0x4c, 0xfe, 0x00, 0x01,
+  0x2c, 0xf2, 0xfd, 0xff, 0x03, 0xea, 0x20, 0x00, 0x34, 0xfc, 0x00, 0x07, 0xb4, 0xff, 0xb0, 0x18,
+  0x1a, 0xb6, 0xff, 0xa6, 0xfa, 0x00, 0x07, 0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf0, 0xfa,
+  0x00, 0x07, 0xf2, 0xff, 0x18, 0x00, 0x00, 0x1a, 0xff, 0xf2, 0xfa, 0x00, 0x07, 0xb4, 0xff, 0xb0,
+  0x18, 0x1a, 0xb4, 0xff, 0xb0, 0xfa, 0x00, 0x01, 0x2e, 0xf2, 0xfd, 0xff, 0x01, 0xee, 0x28, 0xf9,
+  0x00, 0x05, 0x2e, 0xb6, 0xf2, 0xf2, 0xb0, 0x28, 0xa6, 0x00,
 
   /*Unicode: U+0026 (&) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x26, 0xa0, 0xe2, 0xf8, 0xe6, 0xa2, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@@%......
-  0x00, 0x00, 0x32, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@@@@.....
-  0x00, 0x00, 0xbe, 0xff, 0xff, 0xb0, 0x20, 0x06, 0x34, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@%...%.....
-  0x00, 0x00, 0xf4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@..........
-  0x00, 0x00, 0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@..........
-  0x00, 0x00, 0x96, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@+.........
-  0x00, 0x00, 0x14, 0xe0, 0xff, 0xe0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.........
-  0x00, 0x00, 0x04, 0xac, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@%........
-  0x00, 0x0e, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@@+.......
-  0x00, 0xb4, 0xff, 0xd0, 0xaa, 0xff, 0xff, 0xf0, 0x24, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfc,  //.%@@%@@@.....@@
-  0x56, 0xff, 0xff, 0x3a, 0x0c, 0xd8, 0xff, 0xff, 0xce, 0x06, 0x00, 0x00, 0x02, 0xff, 0xee,  //+@@..@@@@....@@
-  0xbc, 0xff, 0xf8, 0x00, 0x00, 0x2e, 0xf6, 0xff, 0xff, 0x96, 0x00, 0x00, 0x16, 0xff, 0xd6,  //%@@...@@@%...@@
-  0xea, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x56, 0x00, 0x52, 0xff, 0xa4,  //@@@...+@@@+.+@%
-  0xf4, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xf0, 0x2a, 0xca, 0xff, 0x56,  //@@@....%@@@.@@+
-  0xd2, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x0c, 0xd8, 0xff, 0xff, 0xf6, 0xff, 0xe0, 0x04,  //@@@+....@@@@@@.
-  0x7e, 0xff, 0xff, 0xd8, 0x0c, 0x00, 0x00, 0x00, 0x2e, 0xf6, 0xff, 0xff, 0xff, 0x52, 0x00,  //+@@@.....@@@@+.
-  0x0c, 0xda, 0xff, 0xff, 0xd0, 0x42, 0x08, 0x0c, 0x66, 0xf2, 0xff, 0xff, 0xff, 0x96, 0x00,  //.@@@@+..+@@@@%.
-  0x00, 0x22, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x88, 0xff, 0xff, 0xfa, 0x2a,  //..@@@@@@@@%@@@.
-  0x00, 0x00, 0x08, 0x6c, 0xc4, 0xf0, 0xf8, 0xdc, 0x92, 0x1c, 0x00, 0xb6, 0xff, 0xff, 0xb6,  //...+@@@@%..%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb3, 0x00, 0x06, 0x26, 0xa0, 0xe2, 0xf8, 0xe6, 0xa2, 0x36, 0xfa, 0x00, 0x01, 0x32, 0xf2, 0xfb,
+  0xff, 0xfa, 0x00, 0x07, 0xbe, 0xff, 0xff, 0xb0, 0x20, 0x06, 0x34, 0xaa, 0xfa, 0x00, 0x03, 0xf4,
+  0xff, 0xff, 0x16, 0xf6, 0x00, 0x03, 0xe8, 0xff, 0xff, 0x10, 0xf6, 0x00, 0x03, 0x96, 0xff, 0xff,
+  0x60, 0xf6, 0x00, 0x04, 0x14, 0xe0, 0xff, 0xe0, 0x0a, 0xf7, 0x00, 0x04, 0x04, 0xac, 0xff, 0xff,
+  0x98, 0xf8, 0x00, 0x01, 0x0e, 0xc6, 0xfd, 0xff, 0x00, 0x56, 0xf9, 0x00, 0x07, 0xb4, 0xff, 0xd0,
+  0xaa, 0xff, 0xff, 0xf0, 0x24, 0xfe, 0x00, 0x23, 0x06, 0xff, 0xfc, 0x56, 0xff, 0xff, 0x3a, 0x0c,
+  0xd8, 0xff, 0xff, 0xce, 0x06, 0x00, 0x00, 0x02, 0xff, 0xee, 0xbc, 0xff, 0xf8, 0x00, 0x00, 0x2e,
+  0xf6, 0xff, 0xff, 0x96, 0x00, 0x00, 0x16, 0xff, 0xd6, 0xea, 0xff, 0xfa, 0xfe, 0x00, 0x00, 0x66,
+  0xfe, 0xff, 0x08, 0x56, 0x00, 0x52, 0xff, 0xa4, 0xf4, 0xff, 0xff, 0x14, 0xfe, 0x00, 0x0b, 0xa6,
+  0xff, 0xff, 0xf0, 0x2a, 0xca, 0xff, 0x56, 0xd2, 0xff, 0xff, 0x58, 0xfe, 0x00, 0x0c, 0x0c, 0xd8,
+  0xff, 0xff, 0xf6, 0xff, 0xe0, 0x04, 0x7e, 0xff, 0xff, 0xd8, 0x0c, 0xfe, 0x00, 0x01, 0x2e, 0xf6,
+  0xfe, 0xff, 0x0b, 0x52, 0x00, 0x0c, 0xda, 0xff, 0xff, 0xd0, 0x42, 0x08, 0x0c, 0x66, 0xf2, 0xfe,
+  0xff, 0x04, 0x96, 0x00, 0x00, 0x22, 0xd4, 0xfb, 0xff, 0x14, 0xf0, 0x88, 0xff, 0xff, 0xfa, 0x2a,
+  0x00, 0x00, 0x08, 0x6c, 0xc4, 0xf0, 0xf8, 0xdc, 0x92, 0x1c, 0x00, 0xb6, 0xff, 0xff, 0xb6, 0xa7,
+  0x00,
 
   /*Unicode: U+0027 (') , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf7, 0x00, 0xf3, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+0028 (() , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x2a, 0xf8, 0xc2,  //....@@
-  0x00, 0x00, 0x00, 0xca, 0xff, 0x4c,  //...@@+
-  0x00, 0x00, 0x64, 0xff, 0xd6, 0x00,  //..+@@.
-  0x00, 0x06, 0xe4, 0xff, 0x76, 0x00,  //..@@+.
-  0x00, 0x68, 0xff, 0xff, 0x22, 0x00,  //.+@@..
-  0x00, 0xd2, 0xff, 0xce, 0x00, 0x00,  //.@@@..
-  0x2e, 0xff, 0xff, 0x94, 0x00, 0x00,  //.@@%..
-  0x78, 0xff, 0xff, 0x62, 0x00, 0x00,  //+@@+..
-  0xb2, 0xff, 0xff, 0x34, 0x00, 0x00,  //%@@...
-  0xda, 0xff, 0xff, 0x1e, 0x00, 0x00,  //@@@...
-  0xf2, 0xff, 0xff, 0x0e, 0x00, 0x00,  //@@@...
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00,  //@@@...
-  0xf2, 0xff, 0xff, 0x0e, 0x00, 0x00,  //@@@...
-  0xda, 0xff, 0xff, 0x1e, 0x00, 0x00,  //@@@...
-  0xb0, 0xff, 0xff, 0x36, 0x00, 0x00,  //%@@...
-  0x78, 0xff, 0xff, 0x64, 0x00, 0x00,  //+@@+..
-  0x2c, 0xff, 0xff, 0x96, 0x00, 0x00,  //.@@%..
-  0x00, 0xd2, 0xff, 0xd2, 0x00, 0x00,  //.@@@..
-  0x00, 0x66, 0xff, 0xff, 0x24, 0x00,  //.+@@..
-  0x00, 0x06, 0xe4, 0xff, 0x78, 0x00,  //..@@+.
-  0x00, 0x00, 0x62, 0xff, 0xd8, 0x00,  //..+@@.
-  0x00, 0x00, 0x00, 0xc8, 0xff, 0x4e,  //...@@+
-  0x00, 0x00, 0x00, 0x2a, 0xf8, 0xc4,  //....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xe6, 0x00, 0x02, 0x2a, 0xf8, 0xc2, 0xfe, 0x00, 0x5a, 0xca, 0xff, 0x4c, 0x00, 0x00, 0x64, 0xff,
+  0xd6, 0x00, 0x00, 0x06, 0xe4, 0xff, 0x76, 0x00, 0x00, 0x68, 0xff, 0xff, 0x22, 0x00, 0x00, 0xd2,
+  0xff, 0xce, 0x00, 0x00, 0x2e, 0xff, 0xff, 0x94, 0x00, 0x00, 0x78, 0xff, 0xff, 0x62, 0x00, 0x00,
+  0xb2, 0xff, 0xff, 0x34, 0x00, 0x00, 0xda, 0xff, 0xff, 0x1e, 0x00, 0x00, 0xf2, 0xff, 0xff, 0x0e,
+  0x00, 0x00, 0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0xf2, 0xff, 0xff, 0x0e, 0x00, 0x00, 0xda, 0xff,
+  0xff, 0x1e, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x36, 0x00, 0x00, 0x78, 0xff, 0xff, 0x64, 0x00, 0x00,
+  0x2c, 0xff, 0xff, 0x96, 0xfe, 0x00, 0x02, 0xd2, 0xff, 0xd2, 0xfe, 0x00, 0x09, 0x66, 0xff, 0xff,
+  0x24, 0x00, 0x00, 0x06, 0xe4, 0xff, 0x78, 0xfe, 0x00, 0x02, 0x62, 0xff, 0xd8, 0xfd, 0x00, 0x02,
+  0xc8, 0xff, 0x4e, 0xfe, 0x00, 0x02, 0x2a, 0xf8, 0xc4, 0xef, 0x00,
 
   /*Unicode: U+0029 ()) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0xc4, 0xf8, 0x2a, 0x00, 0x00, 0x00,  //@@....
-  0x4e, 0xff, 0xc8, 0x00, 0x00, 0x00,  //+@@...
-  0x00, 0xd8, 0xff, 0x62, 0x00, 0x00,  //.@@+..
-  0x00, 0x7a, 0xff, 0xe4, 0x06, 0x00,  //.+@@..
-  0x00, 0x26, 0xff, 0xff, 0x66, 0x00,  //..@@+.
-  0x00, 0x00, 0xd4, 0xff, 0xd0, 0x00,  //..@@@.
-  0x00, 0x00, 0x9a, 0xff, 0xff, 0x2a,  //..%@@.
-  0x00, 0x00, 0x66, 0xff, 0xff, 0x74,  //..+@@+
-  0x00, 0x00, 0x36, 0xff, 0xff, 0xb0,  //...@@%
-  0x00, 0x00, 0x20, 0xff, 0xff, 0xd8,  //...@@@
-  0x00, 0x00, 0x10, 0xff, 0xff, 0xf2,  //...@@@
-  0x00, 0x00, 0x02, 0xff, 0xff, 0xfa,  //...@@@
-  0x00, 0x00, 0x10, 0xff, 0xff, 0xf2,  //...@@@
-  0x00, 0x00, 0x20, 0xff, 0xff, 0xd8,  //...@@@
-  0x00, 0x00, 0x38, 0xff, 0xff, 0xb0,  //...@@%
-  0x00, 0x00, 0x68, 0xff, 0xff, 0x76,  //..+@@+
-  0x00, 0x00, 0x9a, 0xff, 0xff, 0x2a,  //..%@@.
-  0x00, 0x00, 0xd6, 0xff, 0xd0, 0x00,  //..@@@.
-  0x00, 0x28, 0xff, 0xff, 0x66, 0x00,  //..@@+.
-  0x00, 0x7c, 0xff, 0xe4, 0x06, 0x00,  //.+@@..
-  0x00, 0xda, 0xff, 0x64, 0x00, 0x00,  //.@@+..
-  0x50, 0xff, 0xc8, 0x00, 0x00, 0x00,  //+@@...
-  0xc4, 0xf8, 0x2a, 0x00, 0x00, 0x00,  //@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xe9, 0x00, 0x02, 0xc4, 0xf8, 0x2a, 0xfe, 0x00, 0x02, 0x4e, 0xff, 0xc8, 0xfd, 0x00, 0x02, 0xd8,
+  0xff, 0x62, 0xfe, 0x00, 0x09, 0x7a, 0xff, 0xe4, 0x06, 0x00, 0x00, 0x26, 0xff, 0xff, 0x66, 0xfe,
+  0x00, 0x02, 0xd4, 0xff, 0xd0, 0xfe, 0x00, 0x5a, 0x9a, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x66, 0xff,
+  0xff, 0x74, 0x00, 0x00, 0x36, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x20, 0xff, 0xff, 0xd8, 0x00, 0x00,
+  0x10, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x10, 0xff, 0xff, 0xf2,
+  0x00, 0x00, 0x20, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x38, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x68, 0xff,
+  0xff, 0x76, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x2a, 0x00, 0x00, 0xd6, 0xff, 0xd0, 0x00, 0x00, 0x28,
+  0xff, 0xff, 0x66, 0x00, 0x00, 0x7c, 0xff, 0xe4, 0x06, 0x00, 0x00, 0xda, 0xff, 0x64, 0x00, 0x00,
+  0x50, 0xff, 0xc8, 0xfe, 0x00, 0x02, 0xc4, 0xf8, 0x2a, 0xec, 0x00,
 
   /*Unicode: U+002a (*) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x84, 0x7c, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x04, 0x7c, 0x84,  //%+...@...+%
-  0x98, 0xfc, 0xd2, 0x34, 0x00, 0xff, 0x00, 0x36, 0xd2, 0xfc, 0x98,  //%@@..@..@@%
-  0x00, 0x38, 0xca, 0xfc, 0x8c, 0xff, 0x8c, 0xfc, 0xc8, 0x36, 0x00,  //..@@%@%@@..
-  0x00, 0x00, 0x00, 0x60, 0xe6, 0xff, 0xe6, 0x60, 0x00, 0x00, 0x00,  //...+@@@+...
-  0x00, 0x00, 0x00, 0x60, 0xe6, 0xff, 0xe6, 0x60, 0x00, 0x00, 0x00,  //...+@@@+...
-  0x00, 0x36, 0xc8, 0xfc, 0x8e, 0xff, 0x8e, 0xfc, 0xc8, 0x36, 0x00,  //..@@%@%@@..
-  0x98, 0xfc, 0xd2, 0x34, 0x00, 0xff, 0x00, 0x36, 0xd2, 0xfc, 0x98,  //%@@..@..@@%
-  0x84, 0x7e, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x04, 0x7e, 0x84,  //%+...@...+%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc5, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x1f, 0x84, 0x7c, 0x04, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x04, 0x7c, 0x84, 0x98, 0xfc, 0xd2, 0x34, 0x00, 0xff, 0x00, 0x36, 0xd2, 0xfc,
+  0x98, 0x00, 0x38, 0xca, 0xfc, 0x8c, 0xff, 0x8c, 0xfc, 0xc8, 0x36, 0xfd, 0x00, 0x04, 0x60, 0xe6,
+  0xff, 0xe6, 0x60, 0xfb, 0x00, 0x04, 0x60, 0xe6, 0xff, 0xe6, 0x60, 0xfd, 0x00, 0x1f, 0x36, 0xc8,
+  0xfc, 0x8e, 0xff, 0x8e, 0xfc, 0xc8, 0x36, 0x00, 0x98, 0xfc, 0xd2, 0x34, 0x00, 0xff, 0x00, 0x36,
+  0xd2, 0xfc, 0x98, 0x84, 0x7e, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x04, 0x7e, 0x84, 0xfc, 0x00,
+  0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0x81, 0x00, 0xed, 0x00,
 
   /*Unicode: U+002b (+) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0x81, 0x00, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff,
+  0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff,
+  0xfb, 0x00, 0xe5, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00,
+  0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01,
+  0xff, 0xff, 0x99, 0x00,
 
   /*Unicode: U+002c (,) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x06, 0xff, 0xff, 0xee,  //.@@@
-  0x3a, 0xff, 0xff, 0x88,  //.@@%
-  0x72, 0xff, 0xfa, 0x1c,  //+@@.
-  0xaa, 0xff, 0xa6, 0x00,  //%@%.
-  0xe2, 0xff, 0x36, 0x00,  //@@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xb0, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x12, 0x06, 0xff, 0xff, 0xee, 0x3a, 0xff, 0xff,
+  0x88, 0x72, 0xff, 0xfa, 0x1c, 0xaa, 0xff, 0xa6, 0x00, 0xe2, 0xff, 0x36, 0xf4, 0x00,
 
   /*Unicode: U+002d (-) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0x91, 0x00, 0xf3, 0xff, 0xad, 0x00,
 
   /*Unicode: U+002e (.) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xc5, 0x00, 0xf5, 0xff, 0xef, 0x00,
 
   /*Unicode: U+002f (/) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xc2,  //..........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0x48,  //.........%@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xcc, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x54, 0x00,  //........%@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xfc, 0xff, 0xd6, 0x00, 0x00,  //........@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0x60, 0x00, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0xff, 0xe0, 0x04, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00,  //......%@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf4, 0xff, 0xe8, 0x08, 0x00, 0x00, 0x00,  //......@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //.....%@@+....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf0, 0xff, 0xee, 0x0c, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x00, 0x08, 0xe8, 0xff, 0xf4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@......
-  0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@%......
-  0x00, 0x00, 0x04, 0xe0, 0xff, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x60, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@%.......
-  0x00, 0x00, 0xd8, 0xff, 0xfc, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@........
-  0x00, 0x54, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@%........
-  0x00, 0xce, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x48, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0xc2, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xb7, 0x00, 0x03, 0x3c, 0xff, 0xff, 0xc2, 0xf8, 0x00, 0x03, 0xb6, 0xff, 0xff, 0x48, 0xf9, 0x00,
+  0x03, 0x30, 0xff, 0xff, 0xcc, 0xf8, 0x00, 0x03, 0xaa, 0xff, 0xff, 0x54, 0xf9, 0x00, 0x03, 0x26,
+  0xfc, 0xff, 0xd6, 0xf8, 0x00, 0x03, 0x9e, 0xff, 0xff, 0x60, 0xf9, 0x00, 0x04, 0x1c, 0xf8, 0xff,
+  0xe0, 0x04, 0xf9, 0x00, 0x03, 0x92, 0xff, 0xff, 0x6c, 0xf9, 0x00, 0x04, 0x14, 0xf4, 0xff, 0xe8,
+  0x08, 0xf9, 0x00, 0x03, 0x86, 0xff, 0xff, 0x78, 0xf9, 0x00, 0x04, 0x0e, 0xf0, 0xff, 0xee, 0x0c,
+  0xf9, 0x00, 0x03, 0x78, 0xff, 0xff, 0x84, 0xf9, 0x00, 0x04, 0x08, 0xe8, 0xff, 0xf4, 0x14, 0xf9,
+  0x00, 0x03, 0x6c, 0xff, 0xff, 0x90, 0xf9, 0x00, 0x04, 0x04, 0xe0, 0xff, 0xf8, 0x1c, 0xf9, 0x00,
+  0x03, 0x60, 0xff, 0xff, 0x9c, 0xf8, 0x00, 0x03, 0xd8, 0xff, 0xfc, 0x24, 0xf9, 0x00, 0x03, 0x54,
+  0xff, 0xff, 0xa8, 0xf8, 0x00, 0x03, 0xce, 0xff, 0xff, 0x2e, 0xf9, 0x00, 0x03, 0x48, 0xff, 0xff,
+  0xb4, 0xf8, 0x00, 0x03, 0xc2, 0xff, 0xff, 0x3a, 0xc4, 0x00,
 
   /*Unicode: U+0030 (0) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x66, 0xc8, 0xf0, 0xf0, 0xc6, 0x64, 0x00, 0x00, 0x00,  //...+@@@@+...
-  0x00, 0x02, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x02, 0x00,  //..%@@@@@@%..
-  0x00, 0x80, 0xff, 0xff, 0xaa, 0x18, 0x18, 0xaa, 0xff, 0xff, 0x7c, 0x00,  //.%@@%..%@@+.
-  0x10, 0xf2, 0xff, 0xe2, 0x06, 0x00, 0x00, 0x08, 0xe4, 0xff, 0xf0, 0x0e,  //.@@@....@@@.
-  0x5c, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x5a,  //+@@%....%@@+
-  0xa0, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x9e,  //%@@+....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@......@@@
-  0xe8, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x86, 0xf2, 0x80, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.%@%..@@@
-  0xfc, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.@@@..@@@
-  0xf4, 0xff, 0xff, 0x04, 0x8c, 0xf2, 0x82, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.%@%..@@@
-  0xe8, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x9e,  //%@@+....+@@%
-  0x5c, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x5a,  //+@@%....%@@+
-  0x10, 0xf2, 0xff, 0xe0, 0x06, 0x00, 0x00, 0x06, 0xe4, 0xff, 0xf0, 0x0e,  //.@@@....@@@.
-  0x00, 0x80, 0xff, 0xff, 0xa8, 0x16, 0x16, 0xaa, 0xff, 0xff, 0x7c, 0x00,  //.%@@%..%@@+.
-  0x00, 0x02, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x02, 0x00,  //..%@@@@@@%..
-  0x00, 0x00, 0x00, 0x68, 0xc8, 0xf0, 0xf0, 0xc8, 0x66, 0x00, 0x00, 0x00,  //...+@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc2, 0x00, 0x05, 0x66, 0xc8, 0xf0, 0xf0, 0xc6, 0x64, 0xfd, 0x00, 0x01, 0x02, 0xb2, 0xfb, 0xff,
+  0x1e, 0xae, 0x02, 0x00, 0x00, 0x80, 0xff, 0xff, 0xaa, 0x18, 0x18, 0xaa, 0xff, 0xff, 0x7c, 0x00,
+  0x10, 0xf2, 0xff, 0xe2, 0x06, 0x00, 0x00, 0x08, 0xe4, 0xff, 0xf0, 0x0e, 0x5c, 0xff, 0xff, 0x86,
+  0xfd, 0x00, 0x07, 0x8a, 0xff, 0xff, 0x5a, 0xa0, 0xff, 0xff, 0x4c, 0xfd, 0x00, 0x07, 0x4e, 0xff,
+  0xff, 0x9e, 0xc8, 0xff, 0xff, 0x26, 0xfd, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8, 0xff, 0xff,
+  0x0e, 0xfd, 0x00, 0x2b, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0x86, 0xf2, 0x80, 0x00,
+  0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xff, 0xfc,
+  0xf4, 0xff, 0xff, 0x04, 0x8c, 0xf2, 0x82, 0x00, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x0e,
+  0xfd, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26, 0xfd, 0x00, 0x07, 0x28, 0xff,
+  0xff, 0xc6, 0xa0, 0xff, 0xff, 0x4c, 0xfd, 0x00, 0x07, 0x4e, 0xff, 0xff, 0x9e, 0x5c, 0xff, 0xff,
+  0x86, 0xfd, 0x00, 0x1e, 0x8a, 0xff, 0xff, 0x5a, 0x10, 0xf2, 0xff, 0xe0, 0x06, 0x00, 0x00, 0x06,
+  0xe4, 0xff, 0xf0, 0x0e, 0x00, 0x80, 0xff, 0xff, 0xa8, 0x16, 0x16, 0xaa, 0xff, 0xff, 0x7c, 0x00,
+  0x00, 0x02, 0xb2, 0xfb, 0xff, 0x01, 0xb0, 0x02, 0xfd, 0x00, 0x05, 0x68, 0xc8, 0xf0, 0xf0, 0xc8,
+  0x66, 0xb6, 0x00,
 
   /*Unicode: U+0031 (1) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x1c, 0x56, 0x90, 0xca, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.+%@@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@....
-  0xde, 0x9e, 0x5e, 0x1e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //@%+.@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xca, 0x00, 0x06, 0x1c, 0x56, 0x90, 0xca, 0xfa, 0xff, 0xff, 0xfd, 0x00, 0xfa, 0xff, 0xfd, 0x00,
+  0x03, 0xde, 0x9e, 0x5e, 0x1e, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xfd,
+  0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+0032 (2) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x26, 0x74, 0xb0, 0xda, 0xf2, 0xfa, 0xea, 0xc0, 0x74, 0x10, 0x00, 0x00, 0x00,  //.+%@@@@@+....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x3e, 0x00, 0x00,  //@@@@@@@@@@...
-  0xff, 0xfa, 0xa4, 0x4c, 0x14, 0x08, 0x2c, 0x98, 0xfc, 0xff, 0xf4, 0x26, 0x00,  //@@%+...%@@@..
-  0xb2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xa6, 0x00,  //%.......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xe8, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfc, 0x06,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0x1e,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xf4, 0x02,  //........%@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf8, 0xff, 0xff, 0x98, 0x00,  //........@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xda, 0xff, 0xff, 0xea, 0x18, 0x00,  //.......@@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbe, 0xff, 0xff, 0xfa, 0x48, 0x00, 0x00,  //......%@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00,  //.....%@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00,  //....%@@@+....
-  0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xfa, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@@+.....
-  0x00, 0x00, 0x92, 0xff, 0xff, 0xea, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@+......
-  0x00, 0x8a, 0xff, 0xff, 0xc2, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@@........
-  0x82, 0xff, 0xfa, 0x7c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e,  //@@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e,  //@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc0, 0x00, 0x09, 0x26, 0x74, 0xb0, 0xda, 0xf2, 0xfa, 0xea, 0xc0, 0x74, 0x10, 0xfe, 0x00, 0xf8,
+  0xff, 0x12, 0xe6, 0x3e, 0x00, 0x00, 0xff, 0xfa, 0xa4, 0x4c, 0x14, 0x08, 0x2c, 0x98, 0xfc, 0xff,
+  0xf4, 0x26, 0x00, 0xb2, 0x20, 0xfb, 0x00, 0x03, 0x92, 0xff, 0xff, 0xa6, 0xf8, 0x00, 0x03, 0x26,
+  0xff, 0xff, 0xe8, 0xf8, 0x00, 0x04, 0x08, 0xff, 0xff, 0xfc, 0x06, 0xf9, 0x00, 0x00, 0x2a, 0xfe,
+  0xff, 0x00, 0x1e, 0xf9, 0x00, 0x04, 0x8c, 0xff, 0xff, 0xf4, 0x02, 0xfa, 0x00, 0x04, 0x2e, 0xf8,
+  0xff, 0xff, 0x98, 0xfa, 0x00, 0x05, 0x0e, 0xda, 0xff, 0xff, 0xea, 0x18, 0xfb, 0x00, 0x05, 0x06,
+  0xbe, 0xff, 0xff, 0xfa, 0x48, 0xfb, 0x00, 0x01, 0x02, 0xb0, 0xfe, 0xff, 0x00, 0x64, 0xfa, 0x00,
+  0x00, 0xa4, 0xfe, 0xff, 0x00, 0x76, 0xfa, 0x00, 0x04, 0x9c, 0xff, 0xff, 0xfa, 0x6c, 0xfa, 0x00,
+  0x04, 0x92, 0xff, 0xff, 0xea, 0x46, 0xfa, 0x00, 0x04, 0x8a, 0xff, 0xff, 0xc2, 0x1c, 0xfa, 0x00,
+  0x04, 0x82, 0xff, 0xfa, 0x7c, 0x02, 0xf9, 0x00, 0xf5, 0xff, 0x00, 0x1e, 0xf5, 0xff, 0x00, 0x1e,
+  0xb3, 0x00,
 
   /*Unicode: U+0033 (3) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x24, 0x6e, 0xae, 0xde, 0xf8, 0xf4, 0xd6, 0x96, 0x2a, 0x00, 0x00,  //..+%@@@@%...
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6e, 0x00,  //.@@@@@@@@@+.
-  0x00, 0xd0, 0x7c, 0x3c, 0x12, 0x04, 0x1e, 0x70, 0xf2, 0xff, 0xff, 0x4a,  //.@+....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xc0,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xf2,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xe6,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xa2,  //........+@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2c, 0x8e, 0xfa, 0xff, 0xd8, 0x16,  //.......%@@@.
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x7e, 0x0a, 0x00,  //...@@@@@@+..
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x72, 0x02, 0x00,  //...@@@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0xb0, 0xff, 0xff, 0xba, 0x06,  //.......%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0x80,  //........%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xda,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf8,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xe8,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xac,  //........%@@%
-  0xd0, 0x7c, 0x3e, 0x16, 0x02, 0x14, 0x3c, 0xae, 0xff, 0xff, 0xfa, 0x30,  //@+.....%@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x50, 0x00,  //@@@@@@@@@@+.
-  0x22, 0x6a, 0xb0, 0xdc, 0xf4, 0xfa, 0xec, 0xc4, 0x7e, 0x18, 0x00, 0x00,  //.+%@@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc4, 0x00, 0x08, 0x24, 0x6e, 0xae, 0xde, 0xf8, 0xf4, 0xd6, 0x96, 0x2a, 0xfe, 0x00, 0xf9, 0xff,
+  0x0e, 0xfa, 0x6e, 0x00, 0x00, 0xd0, 0x7c, 0x3c, 0x12, 0x04, 0x1e, 0x70, 0xf2, 0xff, 0xff, 0x4a,
+  0xf9, 0x00, 0x03, 0x66, 0xff, 0xff, 0xc0, 0xf9, 0x00, 0x03, 0x16, 0xff, 0xff, 0xf2, 0xf9, 0x00,
+  0x03, 0x0c, 0xff, 0xff, 0xe6, 0xf9, 0x00, 0x03, 0x6a, 0xff, 0xff, 0xa2, 0xfc, 0x00, 0x06, 0x0c,
+  0x2c, 0x8e, 0xfa, 0xff, 0xd8, 0x16, 0xfe, 0x00, 0xfc, 0xff, 0x02, 0xd8, 0x7e, 0x0a, 0xfd, 0x00,
+  0xfc, 0xff, 0x02, 0xd8, 0x72, 0x02, 0xfb, 0x00, 0x06, 0x0e, 0x38, 0xb0, 0xff, 0xff, 0xba, 0x06,
+  0xf9, 0x00, 0x03, 0x98, 0xff, 0xff, 0x80, 0xf9, 0x00, 0x03, 0x20, 0xff, 0xff, 0xda, 0xf9, 0x00,
+  0x03, 0x04, 0xff, 0xff, 0xf8, 0xf9, 0x00, 0x03, 0x22, 0xff, 0xff, 0xe8, 0xf9, 0x00, 0x0f, 0x96,
+  0xff, 0xff, 0xac, 0xd0, 0x7c, 0x3e, 0x16, 0x02, 0x14, 0x3c, 0xae, 0xff, 0xff, 0xfa, 0x30, 0xf8,
+  0xff, 0x0c, 0xf0, 0x50, 0x00, 0x22, 0x6a, 0xb0, 0xdc, 0xf4, 0xfa, 0xec, 0xc4, 0x7e, 0x18, 0xb7,
+  0x00,
 
   /*Unicode: U+0034 (4) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //......%@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.....+@@@@...
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xde, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.....@@@@@...
-  0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0x54, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //....%@+@@@...
-  0x00, 0x00, 0x00, 0x36, 0xfc, 0xc2, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@.@@@...
-  0x00, 0x00, 0x02, 0xce, 0xfc, 0x30, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@..@@@...
-  0x00, 0x00, 0x70, 0xff, 0x9c, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..+@%..@@@...
-  0x00, 0x1a, 0xf2, 0xf2, 0x16, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@...@@@...
-  0x00, 0xac, 0xff, 0x78, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@+...@@@...
-  0x4a, 0xff, 0xde, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@....@@@...
-  0xde, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@+....@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xba, 0x00, 0x03, 0x24, 0xf6, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xbc, 0xfe, 0xff, 0xf9, 0x00, 0x00,
+  0x5a, 0xfd, 0xff, 0xfa, 0x00, 0x02, 0x0e, 0xe8, 0xde, 0xfe, 0xff, 0xfa, 0x00, 0x02, 0x96, 0xff,
+  0x54, 0xfe, 0xff, 0xfb, 0x00, 0x03, 0x36, 0xfc, 0xc2, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x02,
+  0xce, 0xfc, 0x30, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x70, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xff,
+  0xfd, 0x00, 0x05, 0x1a, 0xf2, 0xf2, 0x16, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x02, 0xac, 0xff,
+  0x78, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x03, 0x4a, 0xff, 0xde, 0x06, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0x02, 0xde, 0xff, 0x54, 0xfd, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xe7, 0xff, 0xfa, 0x00,
+  0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xb0, 0x00,
 
   /*Unicode: U+0035 (5) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0xff, 0xff, 0xff, 0xc4, 0xf0, 0xf4, 0xd4, 0x86, 0x12, 0x00, 0x00,  //.@@@@@@@%...
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x2e, 0x00,  //.@@@@@@@@@..
-  0x00, 0xbe, 0x58, 0x1a, 0x04, 0x10, 0x52, 0xd6, 0xff, 0xff, 0xde, 0x0c,  //.%+...+@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd8, 0xff, 0xff, 0x72,  //........@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xc0,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xec,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xf8,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xe8,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xb8,  //........+@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd4, 0xff, 0xff, 0x5e,  //........@@@+
-  0xce, 0x76, 0x36, 0x10, 0x02, 0x10, 0x50, 0xd2, 0xff, 0xff, 0xc4, 0x02,  //@+....+@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x12, 0x00,  //@@@@@@@@@%..
-  0x32, 0x8a, 0xc4, 0xe8, 0xf8, 0xf8, 0xe2, 0xac, 0x52, 0x00, 0x00, 0x00,  //.%@@@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc4, 0x00, 0xf7, 0xff, 0x01, 0x00, 0x00, 0xf7, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00,
+  0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x05, 0xc4,
+  0xf0, 0xf4, 0xd4, 0x86, 0x12, 0xfe, 0x00, 0xf9, 0xff, 0x0e, 0xe6, 0x2e, 0x00, 0x00, 0xbe, 0x58,
+  0x1a, 0x04, 0x10, 0x52, 0xd6, 0xff, 0xff, 0xde, 0x0c, 0xfa, 0x00, 0x04, 0x0e, 0xd8, 0xff, 0xff,
+  0x72, 0xf9, 0x00, 0x03, 0x58, 0xff, 0xff, 0xc0, 0xf9, 0x00, 0x03, 0x16, 0xff, 0xff, 0xec, 0xf9,
+  0x00, 0x03, 0x02, 0xff, 0xff, 0xf8, 0xf9, 0x00, 0x03, 0x14, 0xff, 0xff, 0xe8, 0xf9, 0x00, 0x03,
+  0x56, 0xff, 0xff, 0xb8, 0xfa, 0x00, 0x10, 0x0a, 0xd4, 0xff, 0xff, 0x5e, 0xce, 0x76, 0x36, 0x10,
+  0x02, 0x10, 0x50, 0xd2, 0xff, 0xff, 0xc4, 0x02, 0xf8, 0xff, 0x0b, 0xbe, 0x12, 0x00, 0x32, 0x8a,
+  0xc4, 0xe8, 0xf8, 0xf8, 0xe2, 0xac, 0x52, 0xb6, 0x00,
 
   /*Unicode: U+0036 (6) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x10, 0x7e, 0xca, 0xec, 0xf8, 0xdc, 0x96, 0x30, 0x00,  //....+@@@@%..
-  0x00, 0x00, 0x40, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..+@@@@@@@@.
-  0x00, 0x2e, 0xf4, 0xff, 0xff, 0x98, 0x2a, 0x06, 0x12, 0x52, 0xc4, 0x00,  //..@@@%...+@.
-  0x00, 0xc4, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%.......
-  0x34, 0xff, 0xff, 0xde, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x88, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@%........
-  0xba, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xe2, 0xff, 0xff, 0x1c, 0x42, 0xc0, 0xf2, 0xee, 0xbc, 0x50, 0x00, 0x00,  //@@@.+@@@%+..
-  0xf2, 0xff, 0xff, 0x5a, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00,  //@@@+@@@@@@%.
-  0xfc, 0xff, 0xff, 0xe6, 0x74, 0x10, 0x0c, 0x60, 0xf6, 0xff, 0xff, 0x3a,  //@@@@+..+@@@.
-  0xf4, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xa4,  //@@@%....%@@%
-  0xe8, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xde,  //@@@......@@@
-  0xcc, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xa6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xf4,  //%@@......@@@
-  0x68, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xda,  //+@@......@@@
-  0x1a, 0xf8, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0x98,  //.@@%....%@@%
-  0x00, 0x96, 0xff, 0xfc, 0x74, 0x10, 0x14, 0x6a, 0xf8, 0xff, 0xf8, 0x2a,  //.%@@+..+@@@.
-  0x00, 0x08, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x60, 0x00,  //..@@@@@@@@+.
-  0x00, 0x00, 0x02, 0x6a, 0xc4, 0xee, 0xf8, 0xe0, 0xa2, 0x30, 0x00, 0x00,  //...+@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc2, 0x00, 0x07, 0x10, 0x7e, 0xca, 0xec, 0xf8, 0xdc, 0x96, 0x30, 0xfe, 0x00, 0x01, 0x40, 0xea,
+  0xfa, 0xff, 0x11, 0x00, 0x00, 0x2e, 0xf4, 0xff, 0xff, 0x98, 0x2a, 0x06, 0x12, 0x52, 0xc4, 0x00,
+  0x00, 0xc4, 0xff, 0xff, 0x80, 0xfa, 0x00, 0x04, 0x34, 0xff, 0xff, 0xde, 0x02, 0xfa, 0x00, 0x03,
+  0x88, 0xff, 0xff, 0x82, 0xf9, 0x00, 0x03, 0xba, 0xff, 0xff, 0x42, 0xf9, 0x00, 0x10, 0xe2, 0xff,
+  0xff, 0x1c, 0x42, 0xc0, 0xf2, 0xee, 0xbc, 0x50, 0x00, 0x00, 0xf2, 0xff, 0xff, 0x5a, 0xfa, 0xfc,
+  0xff, 0x11, 0x82, 0x00, 0xfc, 0xff, 0xff, 0xe6, 0x74, 0x10, 0x0c, 0x60, 0xf6, 0xff, 0xff, 0x3a,
+  0xf4, 0xff, 0xff, 0x98, 0xfd, 0x00, 0x07, 0x86, 0xff, 0xff, 0xa4, 0xe8, 0xff, 0xff, 0x32, 0xfd,
+  0x00, 0x07, 0x2a, 0xff, 0xff, 0xde, 0xcc, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x07, 0x0c, 0xff, 0xff,
+  0xf6, 0xa6, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x07, 0x0c, 0xff, 0xff, 0xf4, 0x68, 0xff, 0xff, 0x32,
+  0xfd, 0x00, 0x07, 0x2a, 0xff, 0xff, 0xda, 0x1a, 0xf8, 0xff, 0x98, 0xfd, 0x00, 0x12, 0x86, 0xff,
+  0xff, 0x98, 0x00, 0x96, 0xff, 0xfc, 0x74, 0x10, 0x14, 0x6a, 0xf8, 0xff, 0xf8, 0x2a, 0x00, 0x08,
+  0xc2, 0xfb, 0xff, 0x01, 0xfa, 0x60, 0xfe, 0x00, 0x07, 0x02, 0x6a, 0xc4, 0xee, 0xf8, 0xe0, 0xa2,
+  0x30, 0xb7, 0x00,
 
   /*Unicode: U+0037 (7) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0x76,  //........%@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfc, 0xff, 0xfa, 0x18,  //........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xb6, 0x00,  //.......+@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x54, 0x00,  //.......@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xec, 0x06, 0x00,  //......+@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0x94, 0x00, 0x00,  //......%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf4, 0xff, 0xff, 0x34, 0x00, 0x00,  //......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00,  //.....+@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0x72, 0x00, 0x00, 0x00,  //.....@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xfa, 0x16, 0x00, 0x00, 0x00,  //.....@@@....
-  0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00,  //....%@@%....
-  0x00, 0x00, 0x00, 0x02, 0xe4, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //....@@@+....
-  0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xea, 0x04, 0x00, 0x00, 0x00, 0x00,  //...+@@@.....
-  0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@%.....
-  0x00, 0x00, 0x12, 0xf8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@......
-  0x00, 0x00, 0x6c, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@......
-  0x00, 0x00, 0xce, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xea, 0xff, 0x00, 0xd6, 0xf9, 0x00, 0x03, 0xbc, 0xff, 0xff, 0x76, 0xfa, 0x00, 0x04,
+  0x1e, 0xfc, 0xff, 0xfa, 0x18, 0xfa, 0x00, 0x03, 0x7e, 0xff, 0xff, 0xb6, 0xf9, 0x00, 0x03, 0xdc,
+  0xff, 0xff, 0x54, 0xfa, 0x00, 0x04, 0x40, 0xff, 0xff, 0xec, 0x06, 0xfa, 0x00, 0x03, 0xa2, 0xff,
+  0xff, 0x94, 0xfa, 0x00, 0x04, 0x0c, 0xf4, 0xff, 0xff, 0x34, 0xfa, 0x00, 0x03, 0x64, 0xff, 0xff,
+  0xd2, 0xf9, 0x00, 0x03, 0xc4, 0xff, 0xff, 0x72, 0xfa, 0x00, 0x04, 0x26, 0xff, 0xff, 0xfa, 0x16,
+  0xfa, 0x00, 0x03, 0x86, 0xff, 0xff, 0xb2, 0xfa, 0x00, 0x04, 0x02, 0xe4, 0xff, 0xff, 0x50, 0xfa,
+  0x00, 0x04, 0x4a, 0xff, 0xff, 0xea, 0x04, 0xfa, 0x00, 0x03, 0xaa, 0xff, 0xff, 0x90, 0xfa, 0x00,
+  0x04, 0x12, 0xf8, 0xff, 0xff, 0x30, 0xfa, 0x00, 0x03, 0x6c, 0xff, 0xff, 0xce, 0xf9, 0x00, 0x03,
+  0xce, 0xff, 0xff, 0x6e, 0xb3, 0x00,
 
   /*Unicode: U+0038 (8) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x40, 0xa4, 0xde, 0xf6, 0xf6, 0xde, 0xa4, 0x3e, 0x00, 0x00,  //..+%@@@@%...
-  0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00,  //.%@@@@@@@@%.
-  0x68, 0xff, 0xff, 0xe8, 0x56, 0x12, 0x12, 0x56, 0xe8, 0xff, 0xff, 0x68,  //+@@@+..+@@@+
-  0xd0, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xd0,  //@@@+....+@@@
-  0xf6, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe8,  //@@@......@@@
-  0x96, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0x92,  //%@@+....+@@%
-  0x0e, 0xc4, 0xff, 0xe8, 0x54, 0x12, 0x10, 0x54, 0xe8, 0xff, 0xc2, 0x0c,  //.@@@+..+@@@.
-  0x00, 0x02, 0x6e, 0xce, 0xff, 0xff, 0xff, 0xff, 0xce, 0x6c, 0x02, 0x00,  //..+@@@@@@+..
-  0x00, 0x08, 0x88, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x88, 0x08, 0x00,  //..%@@@@@@%..
-  0x0a, 0xcc, 0xff, 0xf4, 0x6a, 0x16, 0x16, 0x6a, 0xf6, 0xff, 0xcc, 0x0a,  //.@@@+..+@@@.
-  0x7c, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0x7c,  //+@@+....+@@+
-  0xd2, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xd0,  //@@@......@@@
-  0xf4, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf4,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xec,  //@@@......@@@
-  0xba, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xb8,  //%@@+....+@@%
-  0x4c, 0xff, 0xff, 0xf4, 0x6a, 0x16, 0x14, 0x66, 0xf4, 0xff, 0xff, 0x48,  //+@@@+..+@@@+
-  0x00, 0x7c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x76, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x36, 0xa0, 0xdc, 0xf6, 0xf6, 0xdc, 0xa0, 0x34, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc3, 0x00, 0x07, 0x40, 0xa4, 0xde, 0xf6, 0xf6, 0xde, 0xa4, 0x3e, 0xfe, 0x00, 0x00, 0x94, 0xf9,
+  0xff, 0x11, 0x92, 0x00, 0x68, 0xff, 0xff, 0xe8, 0x56, 0x12, 0x12, 0x56, 0xe8, 0xff, 0xff, 0x68,
+  0xd0, 0xff, 0xff, 0x58, 0xfd, 0x00, 0x07, 0x56, 0xff, 0xff, 0xd0, 0xf6, 0xff, 0xff, 0x12, 0xfd,
+  0x00, 0x07, 0x12, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0x10, 0xfd, 0x00, 0x07, 0x10, 0xff, 0xff,
+  0xe8, 0x96, 0xff, 0xff, 0x54, 0xfd, 0x00, 0x13, 0x54, 0xff, 0xff, 0x92, 0x0e, 0xc4, 0xff, 0xe8,
+  0x54, 0x12, 0x10, 0x54, 0xe8, 0xff, 0xc2, 0x0c, 0x00, 0x02, 0x6e, 0xce, 0xfd, 0xff, 0x07, 0xce,
+  0x6c, 0x02, 0x00, 0x00, 0x08, 0x88, 0xe6, 0xfd, 0xff, 0x13, 0xe6, 0x88, 0x08, 0x00, 0x0a, 0xcc,
+  0xff, 0xf4, 0x6a, 0x16, 0x16, 0x6a, 0xf6, 0xff, 0xcc, 0x0a, 0x7c, 0xff, 0xff, 0x76, 0xfd, 0x00,
+  0x07, 0x7a, 0xff, 0xff, 0x7c, 0xd2, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x07, 0x20, 0xff, 0xff, 0xd0,
+  0xf4, 0xff, 0xff, 0x06, 0xfd, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf4, 0xee, 0xff, 0xff, 0x20, 0xfd,
+  0x00, 0x07, 0x20, 0xff, 0xff, 0xec, 0xba, 0xff, 0xff, 0x78, 0xfd, 0x00, 0x12, 0x76, 0xff, 0xff,
+  0xb8, 0x4c, 0xff, 0xff, 0xf4, 0x6a, 0x16, 0x14, 0x66, 0xf4, 0xff, 0xff, 0x48, 0x00, 0x7c, 0xfc,
+  0xfb, 0xff, 0x01, 0xfc, 0x76, 0xfe, 0x00, 0x07, 0x36, 0xa0, 0xdc, 0xf6, 0xf6, 0xdc, 0xa0, 0x34,
+  0xb7, 0x00,
 
   /*Unicode: U+0039 (9) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x32, 0xa2, 0xe0, 0xf8, 0xec, 0xc4, 0x68, 0x02, 0x00, 0x00,  //...%@@@@+...
-  0x00, 0x64, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x06, 0x00,  //.+@@@@@@@%..
-  0x2c, 0xfa, 0xff, 0xf6, 0x62, 0x0c, 0x10, 0x74, 0xfc, 0xff, 0x94, 0x00,  //.@@@+..+@@%.
-  0x9c, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xf8, 0x1a,  //%@@%....%@@.
-  0xdc, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0x66,  //@@@......@@+
-  0xf6, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xa6,  //@@@......@@%
-  0xf6, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xcc,  //@@@......@@@
-  0xde, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xe8,  //@@@......@@@
-  0xa4, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xf4,  //%@@%....%@@@
-  0x3c, 0xff, 0xff, 0xf6, 0x68, 0x14, 0x0e, 0x74, 0xe6, 0xff, 0xff, 0xfa,  //.@@@+..+@@@@
-  0x00, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5c, 0xff, 0xff, 0xf0,  //.%@@@@@@+@@@
-  0x00, 0x00, 0x52, 0xbe, 0xee, 0xf4, 0xc4, 0x44, 0x1c, 0xff, 0xff, 0xe0,  //..+%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xb8,  //........+@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0x86,  //........%@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xff, 0xff, 0x32,  //........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xc2, 0x00,  //.......+@@@.
-  0x00, 0xc2, 0x4e, 0x10, 0x04, 0x28, 0x96, 0xff, 0xff, 0xf2, 0x2a, 0x00,  //.@+...%@@@..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x3e, 0x00, 0x00,  //.@@@@@@@@...
-  0x00, 0x34, 0x9c, 0xe0, 0xf8, 0xec, 0xca, 0x7c, 0x10, 0x00, 0x00, 0x00,  //..%@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc3, 0x00, 0x07, 0x32, 0xa2, 0xe0, 0xf8, 0xec, 0xc4, 0x68, 0x02, 0xfe, 0x00, 0x01, 0x64, 0xfa,
+  0xfb, 0xff, 0x12, 0xbe, 0x06, 0x00, 0x2c, 0xfa, 0xff, 0xf6, 0x62, 0x0c, 0x10, 0x74, 0xfc, 0xff,
+  0x94, 0x00, 0x9c, 0xff, 0xff, 0x86, 0xfd, 0x00, 0x07, 0x98, 0xff, 0xf8, 0x1a, 0xdc, 0xff, 0xff,
+  0x2a, 0xfd, 0x00, 0x07, 0x32, 0xff, 0xff, 0x66, 0xf6, 0xff, 0xff, 0x0c, 0xfd, 0x00, 0x07, 0x0e,
+  0xff, 0xff, 0xa6, 0xf6, 0xff, 0xff, 0x0c, 0xfd, 0x00, 0x07, 0x0e, 0xff, 0xff, 0xcc, 0xde, 0xff,
+  0xff, 0x28, 0xfd, 0x00, 0x07, 0x32, 0xff, 0xff, 0xe8, 0xa4, 0xff, 0xff, 0x82, 0xfd, 0x00, 0x11,
+  0x98, 0xff, 0xff, 0xf4, 0x3c, 0xff, 0xff, 0xf6, 0x68, 0x14, 0x0e, 0x74, 0xe6, 0xff, 0xff, 0xfa,
+  0x00, 0x86, 0xfc, 0xff, 0x10, 0xfa, 0x5c, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x52, 0xbe, 0xee, 0xf4,
+  0xc4, 0x44, 0x1c, 0xff, 0xff, 0xe0, 0xf9, 0x00, 0x03, 0x42, 0xff, 0xff, 0xb8, 0xf9, 0x00, 0x03,
+  0x82, 0xff, 0xff, 0x86, 0xfa, 0x00, 0x04, 0x02, 0xde, 0xff, 0xff, 0x32, 0xfa, 0x00, 0x11, 0x7c,
+  0xff, 0xff, 0xc2, 0x00, 0x00, 0xc2, 0x4e, 0x10, 0x04, 0x28, 0x96, 0xff, 0xff, 0xf2, 0x2a, 0x00,
+  0x00, 0xfa, 0xff, 0x01, 0xea, 0x3e, 0xfe, 0x00, 0x07, 0x34, 0x9c, 0xe0, 0xf8, 0xec, 0xca, 0x7c,
+  0x10, 0xb6, 0x00,
 
   /*Unicode: U+003a (:) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xe0, 0x00, 0xf5, 0xff, 0xf2, 0x00, 0xf5, 0xff, 0xef, 0x00,
 
   /*Unicode: U+003b (;) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x00, 0xff, 0xff, 0xff,  //.@@@
-  0x06, 0xff, 0xff, 0xee,  //.@@@
-  0x3a, 0xff, 0xff, 0x88,  //.@@%
-  0x72, 0xff, 0xfa, 0x1c,  //+@@.
-  0xaa, 0xff, 0xa6, 0x00,  //%@%.
-  0xe2, 0xff, 0x36, 0x00,  //@@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xd4, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff,
+  0xec, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x12, 0x06, 0xff, 0xff, 0xee, 0x3a, 0xff, 0xff,
+  0x88, 0x72, 0xff, 0xfa, 0x1c, 0xaa, 0xff, 0xa6, 0x00, 0xe2, 0xff, 0x36, 0xf4, 0x00,
 
   /*Unicode: U+003c (<) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5e, 0xc8,  //...........+@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x88, 0xea, 0xff, 0xff,  //.........%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb2, 0xfc, 0xff, 0xff, 0xea, 0x8e,  //......+%@@@@%
-  0x00, 0x00, 0x00, 0x10, 0x72, 0xdc, 0xff, 0xff, 0xff, 0xbe, 0x5a, 0x06, 0x00,  //....+@@@@%+..
-  0x00, 0x32, 0x9c, 0xf6, 0xff, 0xff, 0xea, 0x8a, 0x24, 0x00, 0x00, 0x00, 0x00,  //..%@@@@%.....
-  0xc8, 0xff, 0xff, 0xfc, 0xbc, 0x56, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.......
-  0xff, 0xff, 0xea, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+.........
-  0xc8, 0xff, 0xff, 0xfc, 0xb4, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%+.......
-  0x00, 0x32, 0x9e, 0xf6, 0xff, 0xff, 0xe6, 0x86, 0x24, 0x00, 0x00, 0x00, 0x00,  //..%@@@@%.....
-  0x00, 0x00, 0x00, 0x12, 0x74, 0xdc, 0xff, 0xff, 0xff, 0xbe, 0x5a, 0x06, 0x00,  //....+@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb4, 0xfc, 0xff, 0xff, 0xec, 0x90,  //......+%@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x8a, 0xea, 0xff, 0xff,  //.........%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x5e, 0xca,  //...........+@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x82, 0x00, 0x02, 0x06, 0x5e, 0xc8, 0xf9, 0x00, 0x04, 0x20, 0x88, 0xea, 0xff, 0xff, 0xfb, 0x00,
+  0x06, 0x48, 0xb2, 0xfc, 0xff, 0xff, 0xea, 0x8e, 0xfe, 0x00, 0x02, 0x10, 0x72, 0xdc, 0xfe, 0xff,
+  0x0c, 0xbe, 0x5a, 0x06, 0x00, 0x00, 0x32, 0x9c, 0xf6, 0xff, 0xff, 0xea, 0x8a, 0x24, 0xfd, 0x00,
+  0x06, 0xc8, 0xff, 0xff, 0xfc, 0xbc, 0x56, 0x04, 0xfb, 0x00, 0x03, 0xff, 0xff, 0xea, 0x40, 0xf8,
+  0x00, 0x06, 0xc8, 0xff, 0xff, 0xfc, 0xb4, 0x50, 0x04, 0xfa, 0x00, 0x07, 0x32, 0x9e, 0xf6, 0xff,
+  0xff, 0xe6, 0x86, 0x24, 0xfa, 0x00, 0x02, 0x12, 0x74, 0xdc, 0xfe, 0xff, 0x02, 0xbe, 0x5a, 0x06,
+  0xfa, 0x00, 0x06, 0x48, 0xb4, 0xfc, 0xff, 0xff, 0xec, 0x90, 0xf9, 0x00, 0x04, 0x20, 0x8a, 0xea,
+  0xff, 0xff, 0xf7, 0x00, 0x02, 0x06, 0x5e, 0xca, 0x99, 0x00,
 
   /*Unicode: U+003d (=) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0xe5, 0x00, 0xe7, 0xff, 0xda, 0x00, 0xe7, 0xff, 0x81, 0x00, 0xf2, 0x00,
 
   /*Unicode: U+003e (>) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xc8, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+...........
-  0xff, 0xff, 0xea, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%.........
-  0x8e, 0xec, 0xff, 0xff, 0xfc, 0xb2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@%+......
-  0x00, 0x06, 0x5a, 0xc0, 0xff, 0xff, 0xff, 0xda, 0x72, 0x10, 0x00, 0x00, 0x00,  //..+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x26, 0x8a, 0xea, 0xff, 0xff, 0xf4, 0x9c, 0x32, 0x00,  //.....%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x56, 0xbc, 0xfc, 0xff, 0xff, 0xc8,  //.......+%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xea, 0xff, 0xff,  //.........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0xb6, 0xfc, 0xff, 0xff, 0xc8,  //.......+%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x24, 0x88, 0xe6, 0xff, 0xff, 0xf6, 0x9e, 0x32, 0x00,  //.....%@@@@%..
-  0x00, 0x06, 0x5a, 0xbe, 0xff, 0xff, 0xff, 0xdc, 0x72, 0x10, 0x00, 0x00, 0x00,  //..+%@@@@+....
-  0x90, 0xec, 0xff, 0xff, 0xfc, 0xb4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@%+......
-  0xff, 0xff, 0xea, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%.........
-  0xca, 0x5e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@+...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x8c, 0x00, 0x02, 0xc8, 0x5e, 0x06, 0xf7, 0x00, 0x04, 0xff, 0xff, 0xea, 0x88, 0x20, 0xf9, 0x00,
+  0x06, 0x8e, 0xec, 0xff, 0xff, 0xfc, 0xb2, 0x48, 0xfa, 0x00, 0x02, 0x06, 0x5a, 0xc0, 0xfe, 0xff,
+  0x02, 0xda, 0x72, 0x10, 0xfa, 0x00, 0x07, 0x26, 0x8a, 0xea, 0xff, 0xff, 0xf4, 0x9c, 0x32, 0xfa,
+  0x00, 0x06, 0x04, 0x56, 0xbc, 0xfc, 0xff, 0xff, 0xc8, 0xf8, 0x00, 0x03, 0x40, 0xea, 0xff, 0xff,
+  0xfb, 0x00, 0x06, 0x04, 0x50, 0xb6, 0xfc, 0xff, 0xff, 0xc8, 0xfd, 0x00, 0x0c, 0x24, 0x88, 0xe6,
+  0xff, 0xff, 0xf6, 0x9e, 0x32, 0x00, 0x00, 0x06, 0x5a, 0xbe, 0xfe, 0xff, 0x02, 0xdc, 0x72, 0x10,
+  0xfe, 0x00, 0x06, 0x90, 0xec, 0xff, 0xff, 0xfc, 0xb4, 0x48, 0xfb, 0x00, 0x04, 0xff, 0xff, 0xea,
+  0x88, 0x20, 0xf9, 0x00, 0x02, 0xca, 0x5e, 0x06, 0x8f, 0x00,
 
   /*Unicode: U+003f (?) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x16, 0x84, 0xd2, 0xf4, 0xf2, 0xcc, 0x76, 0x06, 0x00,  //..%@@@@+..
-  0x5e, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x0c,  //+@@@@@@@@.
-  0xff, 0xde, 0x64, 0x16, 0x00, 0x10, 0x96, 0xff, 0xff, 0x8c,  //@@+...%@@%
-  0x9c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe0,  //%......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xf6,  //.......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xd6, 0xff, 0xff, 0xce,  //......@@@@
-  0x00, 0x00, 0x00, 0x00, 0x08, 0xc2, 0xff, 0xff, 0xff, 0x52,  //.....@@@@+
-  0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0x74, 0x00,  //....%@@@+.
-  0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00,  //...+@@@+..
-  0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00,  //...%@@%...
-  0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xce, 0x00, 0x0a, 0x16, 0x84, 0xd2, 0xf4, 0xf2, 0xcc, 0x76, 0x06, 0x00, 0x5e, 0xf2, 0xfb, 0xff,
+  0x0d, 0xca, 0x0c, 0xff, 0xde, 0x64, 0x16, 0x00, 0x10, 0x96, 0xff, 0xff, 0x8c, 0x9c, 0x08, 0xfd,
+  0x00, 0x03, 0x10, 0xff, 0xff, 0xe0, 0xfb, 0x00, 0x03, 0x30, 0xff, 0xff, 0xf6, 0xfc, 0x00, 0x04,
+  0x12, 0xd6, 0xff, 0xff, 0xce, 0xfd, 0x00, 0x01, 0x08, 0xc2, 0xfe, 0xff, 0x00, 0x52, 0xfd, 0x00,
+  0x00, 0xac, 0xfe, 0xff, 0x00, 0x74, 0xfd, 0x00, 0x00, 0x4c, 0xfe, 0xff, 0x00, 0x6e, 0xfc, 0x00,
+  0x03, 0xac, 0xff, 0xff, 0xa0, 0xfb, 0x00, 0x03, 0xe0, 0xff, 0xff, 0x30, 0xfb, 0x00, 0x03, 0xf4,
+  0xff, 0xff, 0x04, 0xfb, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xe6, 0x00, 0xfe, 0xff, 0xfa,
+  0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xc1, 0x00,
 
   /*Unicode: U+0040 (@) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xa0, 0xd8, 0xf2, 0xf2, 0xcc, 0x78, 0x08, 0x00, 0x00,  //.....+%@@@@+...
-  0x00, 0x00, 0x00, 0x22, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x18, 0x00,  //....@@@@@@@@@..
-  0x00, 0x00, 0x28, 0xe6, 0xff, 0xe4, 0x72, 0x28, 0x08, 0x0e, 0x56, 0xe2, 0xff, 0xc4, 0x00,  //...@@@+...+@@@.
-  0x00, 0x08, 0xda, 0xff, 0xb6, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xec, 0xff, 0x52,  //..@@%.......@@+
-  0x00, 0x8a, 0xff, 0xcc, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xac,  //.%@@........+@%
-  0x0c, 0xf0, 0xfc, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xe0,  //.@@..........@@
-  0x60, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xd0, 0xf6, 0xe6, 0x8e, 0x12, 0xff, 0xf6,  //+@%....+@@@%.@@
-  0x9c, 0xff, 0x6a, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,  //%@+...%@@@@@@@@
-  0xd0, 0xff, 0x34, 0x00, 0x00, 0x66, 0xff, 0xf0, 0x64, 0x14, 0x14, 0x62, 0xf0, 0xff, 0xff,  //@@...+@@+..+@@@
-  0xe8, 0xff, 0x12, 0x00, 0x00, 0xca, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff,  //@@...@@+....+@@
-  0xf6, 0xff, 0x04, 0x00, 0x00, 0xf4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff,  //@@...@@......@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0xf4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff,  //@@...@@......@@
-  0xe4, 0xff, 0x18, 0x00, 0x00, 0xca, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff,  //@@...@@+....+@@
-  0xc8, 0xff, 0x42, 0x00, 0x00, 0x66, 0xff, 0xf0, 0x62, 0x14, 0x14, 0x60, 0xf0, 0xff, 0xff,  //@@+..+@@+..+@@@
-  0x8e, 0xff, 0x7e, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff,  //%@+...%@@@@@@@@
-  0x4c, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x6e, 0xd0, 0xf6, 0xe8, 0x98, 0x0e, 0xff, 0xff,  //+@@....+@@@%.@@
-  0x02, 0xdc, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@+...........
-  0x00, 0x60, 0xff, 0xf0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@...........
-  0x00, 0x00, 0xae, 0xff, 0xea, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@..........
-  0x00, 0x00, 0x0a, 0xb6, 0xff, 0xff, 0xac, 0x52, 0x1a, 0x06, 0x1e, 0x66, 0x92, 0x00, 0x00,  //...%@@%+...+%..
-  0x00, 0x00, 0x00, 0x04, 0x80, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00,  //....%@@@@@@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x70, 0xb8, 0xde, 0xf4, 0xf0, 0xcc, 0x82, 0x06, 0x00,  //......+%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xa2, 0x00, 0x07, 0x4a, 0xa0, 0xd8, 0xf2, 0xf2, 0xcc, 0x78, 0x08, 0xfc, 0x00, 0x01, 0x22, 0xc0,
+  0xfa, 0xff, 0x01, 0xd4, 0x18, 0xfe, 0x00, 0x12, 0x28, 0xe6, 0xff, 0xe4, 0x72, 0x28, 0x08, 0x0e,
+  0x56, 0xe2, 0xff, 0xc4, 0x00, 0x00, 0x08, 0xda, 0xff, 0xb6, 0x0e, 0xfc, 0x00, 0x08, 0x1e, 0xec,
+  0xff, 0x52, 0x00, 0x8a, 0xff, 0xcc, 0x08, 0xfa, 0x00, 0x06, 0x74, 0xff, 0xac, 0x0c, 0xf0, 0xfc,
+  0x32, 0xf9, 0x00, 0x05, 0x26, 0xff, 0xe0, 0x60, 0xff, 0xbe, 0xfd, 0x00, 0x0a, 0x6c, 0xd0, 0xf6,
+  0xe6, 0x8e, 0x12, 0xff, 0xf6, 0x9c, 0xff, 0x6a, 0xfe, 0x00, 0x00, 0xac, 0xfc, 0xff, 0x19, 0xc0,
+  0xff, 0xff, 0xd0, 0xff, 0x34, 0x00, 0x00, 0x66, 0xff, 0xf0, 0x64, 0x14, 0x14, 0x62, 0xf0, 0xff,
+  0xff, 0xe8, 0xff, 0x12, 0x00, 0x00, 0xca, 0xff, 0x62, 0xfd, 0x00, 0x0a, 0x62, 0xff, 0xff, 0xf6,
+  0xff, 0x04, 0x00, 0x00, 0xf4, 0xff, 0x14, 0xfd, 0x00, 0x0a, 0x14, 0xff, 0xff, 0xf4, 0xff, 0x08,
+  0x00, 0x00, 0xf4, 0xff, 0x14, 0xfd, 0x00, 0x0a, 0x14, 0xff, 0xff, 0xe4, 0xff, 0x18, 0x00, 0x00,
+  0xca, 0xff, 0x62, 0xfd, 0x00, 0x14, 0x62, 0xff, 0xff, 0xc8, 0xff, 0x42, 0x00, 0x00, 0x66, 0xff,
+  0xf0, 0x62, 0x14, 0x14, 0x60, 0xf0, 0xff, 0xff, 0x8e, 0xff, 0x7e, 0xfe, 0x00, 0x00, 0xac, 0xfc,
+  0xff, 0x05, 0xc4, 0xff, 0xff, 0x4c, 0xff, 0xdc, 0xfe, 0x00, 0x0c, 0x02, 0x6e, 0xd0, 0xf6, 0xe8,
+  0x98, 0x0e, 0xff, 0xff, 0x02, 0xdc, 0xff, 0x60, 0xf5, 0x00, 0x03, 0x60, 0xff, 0xf0, 0x28, 0xf5,
+  0x00, 0x03, 0xae, 0xff, 0xea, 0x3e, 0xf6, 0x00, 0x0a, 0x0a, 0xb6, 0xff, 0xff, 0xac, 0x52, 0x1a,
+  0x06, 0x1e, 0x66, 0x92, 0xfc, 0x00, 0x02, 0x04, 0x80, 0xf4, 0xfb, 0xff, 0x00, 0xe8, 0xfa, 0x00,
+  0x08, 0x16, 0x70, 0xb8, 0xde, 0xf4, 0xf0, 0xcc, 0x82, 0x06, 0xe2, 0x00,
 
   /*Unicode: U+0041 (A) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb1, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0x00, 0x3a, 0xf7, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0x00, 0x8a,
+  0xf7, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0x00, 0x2a,
+  0xf9, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0x00, 0x78, 0xf9, 0x00, 0x06, 0xca, 0xff, 0xff, 0xb0, 0xff,
+  0xff, 0xc8, 0xfa, 0x00, 0x08, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0xfb, 0x00,
+  0x08, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0xfb, 0x00, 0x08, 0xba, 0xff, 0xff,
+  0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0xfc, 0x00, 0x0a, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a,
+  0xff, 0xff, 0xf8, 0x0e, 0xfd, 0x00, 0x03, 0x58, 0xff, 0xff, 0xca, 0xfe, 0x00, 0x03, 0xca, 0xff,
+  0xff, 0x58, 0xfd, 0x00, 0x03, 0xa8, 0xff, 0xff, 0x7a, 0xfe, 0x00, 0x03, 0x7a, 0xff, 0xff, 0xa8,
+  0xfe, 0x00, 0x01, 0x06, 0xf0, 0xf8, 0xff, 0x04, 0xf0, 0x04, 0x00, 0x00, 0x48, 0xf6, 0xff, 0x06,
+  0x48, 0x00, 0x00, 0x98, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x09, 0x8a, 0xff, 0xff, 0x96, 0x00, 0x00,
+  0xe6, 0xff, 0xff, 0x3a, 0xfc, 0x00, 0x08, 0x3a, 0xff, 0xff, 0xe4, 0x00, 0x38, 0xff, 0xff, 0xe8,
+  0xfa, 0x00, 0x07, 0xe8, 0xff, 0xff, 0x36, 0x88, 0xff, 0xff, 0x9a, 0xfa, 0x00, 0x07, 0x9a, 0xff,
+  0xff, 0x86, 0xd6, 0xff, 0xff, 0x4a, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd6, 0xa7, 0x00,
 
   /*Unicode: U+0042 (B) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xe8, 0xb6, 0x58, 0x00, 0x00, 0x00,  //@@@@@@@%+...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x02, 0x00,  //@@@@@@@@@%..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x06, 0x36, 0xce, 0xff, 0xff, 0x70, 0x00,  //@@@....@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0xd0, 0x00,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xf4, 0x00,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xe8, 0x00,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb4, 0x00,  //@@@....+@@%.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0x3c, 0xd8, 0xff, 0xf4, 0x32, 0x00,  //@@@....@@@..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xa4, 0x28, 0x00, 0x00,  //@@@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xcc, 0x66, 0x02, 0x00,  //@@@@@@@@@+..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x06, 0x26, 0x84, 0xf8, 0xff, 0xae, 0x02,  //@@@....%@@%.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0x6e,  //@@@.....%@@+
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xd0,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xc0,  //@@@.....+@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x18, 0x62, 0xf0, 0xff, 0xff, 0x52,  //@@@....+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7e, 0x00,  //@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xce, 0x92, 0x2e, 0x00, 0x00,  //@@@@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfc, 0xff, 0x03, 0xfa, 0xe8, 0xb6, 0x58, 0xfe, 0x00, 0xf8, 0xff, 0x02, 0xac, 0x02,
+  0x00, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x06, 0x36, 0xce, 0xff, 0xff, 0x70, 0x00, 0xfe, 0xff, 0xfd,
+  0x00, 0x04, 0x38, 0xff, 0xff, 0xd0, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04, 0x0a, 0xff, 0xff, 0xf4,
+  0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04, 0x12, 0xff, 0xff, 0xe8, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04,
+  0x48, 0xff, 0xff, 0xb4, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x08, 0x3c, 0xd8, 0xff, 0xf4, 0x32,
+  0x00, 0xfa, 0xff, 0x04, 0xee, 0xa4, 0x28, 0x00, 0x00, 0xfa, 0xff, 0x04, 0xfa, 0xcc, 0x66, 0x02,
+  0x00, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x06, 0x26, 0x84, 0xf8, 0xff, 0xae, 0x02, 0xfe, 0xff, 0xfc,
+  0x00, 0x03, 0x84, 0xff, 0xff, 0x6e, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x26, 0xff, 0xff, 0xd0, 0xfe,
+  0xff, 0xfc, 0x00, 0x03, 0x08, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x1e, 0xff, 0xff,
+  0xee, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x68, 0xff, 0xff, 0xc0, 0xfe, 0xff, 0xfe, 0x00, 0x05, 0x18,
+  0x62, 0xf0, 0xff, 0xff, 0x52, 0xf8, 0xff, 0x02, 0xfc, 0x7e, 0x00, 0xfc, 0xff, 0x04, 0xfc, 0xee,
+  0xce, 0x92, 0x2e, 0xb7, 0x00,
 
   /*Unicode: U+0043 (C) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x54, 0xac, 0xe0, 0xf6, 0xf4, 0xd2, 0x94, 0x36,  //....+%@@@@%.
-  0x00, 0x00, 0x14, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x0c, 0xd4, 0xff, 0xff, 0xa4, 0x34, 0x08, 0x12, 0x52, 0xcc, 0xff,  //..@@@%...+@@
-  0x00, 0x96, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c,  //.%@@%......%
-  0x1a, 0xfa, 0xff, 0xde, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x74, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0xb0, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xde, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xde, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xb2, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0x78, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0x1c, 0xfc, 0xff, 0xde, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0x9e, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,  //.%@@%......%
-  0x00, 0x10, 0xda, 0xff, 0xff, 0xa2, 0x32, 0x08, 0x10, 0x50, 0xca, 0xff,  //..@@@%...+@@
-  0x00, 0x00, 0x1a, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x58, 0xae, 0xe2, 0xf8, 0xf4, 0xd4, 0x96, 0x36,  //....+%@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc1, 0x00, 0x0b, 0x54, 0xac, 0xe0, 0xf6, 0xf4, 0xd2, 0x94, 0x36, 0x00, 0x00, 0x14, 0xc2, 0xf9,
+  0xff, 0x10, 0x00, 0x0c, 0xd4, 0xff, 0xff, 0xa4, 0x34, 0x08, 0x12, 0x52, 0xcc, 0xff, 0x00, 0x96,
+  0xff, 0xff, 0x86, 0xfc, 0x00, 0x06, 0x02, 0x8c, 0x1a, 0xfa, 0xff, 0xde, 0x04, 0xfa, 0x00, 0x03,
+  0x74, 0xff, 0xff, 0x82, 0xf9, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x42, 0xf9, 0x00, 0x03, 0xde, 0xff,
+  0xff, 0x1a, 0xf9, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xf9, 0x00, 0x02, 0xfa, 0xff, 0xff, 0xf8,
+  0x00, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xf9, 0x00, 0x03, 0xde, 0xff, 0xff, 0x1a, 0xf9, 0x00, 0x03,
+  0xb2, 0xff, 0xff, 0x42, 0xf9, 0x00, 0x03, 0x78, 0xff, 0xff, 0x80, 0xf9, 0x00, 0x04, 0x1c, 0xfc,
+  0xff, 0xde, 0x04, 0xf9, 0x00, 0x03, 0x9e, 0xff, 0xff, 0x84, 0xfb, 0x00, 0x10, 0x8a, 0x00, 0x10,
+  0xda, 0xff, 0xff, 0xa2, 0x32, 0x08, 0x10, 0x50, 0xca, 0xff, 0x00, 0x00, 0x1a, 0xca, 0xf9, 0xff,
+  0xfd, 0x00, 0x07, 0x58, 0xae, 0xe2, 0xf8, 0xf4, 0xd4, 0x96, 0x36, 0xb9, 0x00,
 
   /*Unicode: U+0044 (D) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xf6, 0xe2, 0xb6, 0x6c, 0x08, 0x00, 0x00, 0x00,  //@@@@@@%+....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x3c, 0x00, 0x00,  //@@@@@@@@@...
-  0xff, 0xff, 0xff, 0x00, 0x08, 0x28, 0x7c, 0xf2, 0xff, 0xf4, 0x30, 0x00,  //@@@...+@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xff, 0xcc, 0x00,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0x38,  //@@@.....%@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x8a,  //@@@.....+@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc,  //@@@......@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xe2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xe2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc,  //@@@......@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x8c,  //@@@.....+@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0x3a,  //@@@.....%@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xff, 0xcc, 0x00,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x08, 0x28, 0x7c, 0xf2, 0xff, 0xf4, 0x30, 0x00,  //@@@...+@@@..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x3c, 0x00, 0x00,  //@@@@@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xf6, 0xe2, 0xb6, 0x6c, 0x08, 0x00, 0x00, 0x00,  //@@@@@@%+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfd, 0xff, 0x04, 0xf6, 0xe2, 0xb6, 0x6c, 0x08, 0xfe, 0x00, 0xf9, 0xff, 0x03, 0xe6,
+  0x3c, 0x00, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x08, 0x28, 0x7c, 0xf2, 0xff, 0xf4, 0x30, 0x00, 0xfe,
+  0xff, 0xfd, 0x00, 0x04, 0x3e, 0xfc, 0xff, 0xcc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0xae, 0xff,
+  0xff, 0x38, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x60, 0xff, 0xff, 0x8a, 0xfe, 0xff, 0xfc, 0x00, 0x03,
+  0x32, 0xff, 0xff, 0xbc, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x14, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0xfc,
+  0x00, 0x03, 0x08, 0xff, 0xff, 0xf0, 0xfe, 0xff, 0xfb, 0x00, 0x02, 0xff, 0xff, 0xfa, 0xfe, 0xff,
+  0xfc, 0x00, 0x03, 0x08, 0xff, 0xff, 0xf0, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x14, 0xff, 0xff, 0xe2,
+  0xfe, 0xff, 0xfc, 0x00, 0x03, 0x32, 0xff, 0xff, 0xbc, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x60, 0xff,
+  0xff, 0x8c, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0xac, 0xff, 0xff, 0x3a, 0xfe, 0xff, 0xfd, 0x00, 0x04,
+  0x3e, 0xfc, 0xff, 0xcc, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x08, 0x28, 0x7c, 0xf2, 0xff, 0xf4, 0x30,
+  0x00, 0xf9, 0xff, 0x03, 0xe6, 0x3c, 0x00, 0x00, 0xfd, 0xff, 0x04, 0xf6, 0xe2, 0xb6, 0x6c, 0x08,
+  0xb6, 0x00,
 
   /*Unicode: U+0045 (E) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xe6, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xf6, 0xff,
+  0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xe9, 0xff,
+  0xb9, 0x00,
 
   /*Unicode: U+0046 (F) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xe6, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xf6, 0xff,
+  0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xb0, 0x00,
 
   /*Unicode: U+0047 (G) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x5c, 0xb2, 0xe2, 0xf8, 0xf0, 0xce, 0x90, 0x34, 0x00,  //....+%@@@@%..
-  0x00, 0x00, 0x1a, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@@@@@@@.
-  0x00, 0x10, 0xda, 0xff, 0xff, 0x9c, 0x30, 0x08, 0x12, 0x50, 0xc8, 0xff, 0x00,  //..@@@%...+@@.
-  0x00, 0x9c, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00,  //.%@@+......%.
-  0x1c, 0xfc, 0xff, 0xdc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x76, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@+.........
-  0xb2, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.........
-  0xde, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@....@@@@@@
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@....@@@@@@
-  0xde, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xb0, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //%@@.......@@@
-  0x76, 0xff, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //+@@+......@@@
-  0x1a, 0xfa, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.@@@......@@@
-  0x00, 0x98, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.%@@+.....@@@
-  0x00, 0x0e, 0xd6, 0xff, 0xfa, 0x82, 0x20, 0x06, 0x22, 0x88, 0xff, 0xff, 0xff,  //..@@@%...%@@@
-  0x00, 0x00, 0x16, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x80,  //...@@@@@@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x54, 0xac, 0xe0, 0xf6, 0xf0, 0xce, 0x8a, 0x22, 0x00,  //....+%@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbc, 0x00, 0x07, 0x5c, 0xb2, 0xe2, 0xf8, 0xf0, 0xce, 0x90, 0x34, 0xfe, 0x00, 0x01, 0x1a, 0xca,
+  0xf9, 0xff, 0x12, 0x00, 0x00, 0x10, 0xda, 0xff, 0xff, 0x9c, 0x30, 0x08, 0x12, 0x50, 0xc8, 0xff,
+  0x00, 0x00, 0x9c, 0xff, 0xff, 0x7e, 0xfb, 0x00, 0x06, 0x8c, 0x00, 0x1c, 0xfc, 0xff, 0xdc, 0x02,
+  0xf9, 0x00, 0x03, 0x76, 0xff, 0xff, 0x7e, 0xf8, 0x00, 0x03, 0xb2, 0xff, 0xff, 0x40, 0xf8, 0x00,
+  0x03, 0xde, 0xff, 0xff, 0x1a, 0xf8, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xf8, 0x00, 0x02, 0xfa,
+  0xff, 0xff, 0xfd, 0x00, 0xfb, 0xff, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xfe, 0x00, 0xfb, 0xff, 0x03,
+  0xde, 0xff, 0xff, 0x18, 0xfb, 0x00, 0xfe, 0xff, 0x03, 0xb0, 0xff, 0xff, 0x3a, 0xfb, 0x00, 0xfe,
+  0xff, 0x03, 0x76, 0xff, 0xff, 0x72, 0xfb, 0x00, 0xfe, 0xff, 0x03, 0x1a, 0xfa, 0xff, 0xca, 0xfb,
+  0x00, 0xfe, 0xff, 0x04, 0x00, 0x98, 0xff, 0xff, 0x5e, 0xfc, 0x00, 0xfe, 0xff, 0x09, 0x00, 0x0e,
+  0xd6, 0xff, 0xfa, 0x82, 0x20, 0x06, 0x22, 0x88, 0xfe, 0xff, 0x03, 0x00, 0x00, 0x16, 0xc4, 0xfa,
+  0xff, 0x01, 0xfa, 0x80, 0xfd, 0x00, 0x07, 0x54, 0xac, 0xe0, 0xf6, 0xf0, 0xce, 0x8a, 0x22, 0xb2,
+  0x00,
 
   /*Unicode: U+0048 (H) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xe3, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+0049 (I) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xca, 0x00, 0xeb, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xfd, 0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+004a (J) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf2,  //........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xda,  //........@@@
-  0x9c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xa6,  //%......+@@%
-  0xff, 0xe4, 0x74, 0x28, 0x06, 0x0c, 0x54, 0xec, 0xff, 0xff, 0x48,  //@@+...+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00,  //@@@@@@@@@%.
-  0x2a, 0x7c, 0xba, 0xda, 0xf2, 0xf8, 0xe4, 0xb0, 0x50, 0x00, 0x00,  //.+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc7, 0x00, 0xf9, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0x02, 0xff, 0xff, 0xfc, 0xfa, 0x00, 0x03, 0x08, 0xff, 0xff, 0xf2, 0xfa, 0x00, 0x05,
+  0x24, 0xff, 0xff, 0xda, 0x9c, 0x08, 0xfc, 0x00, 0x0e, 0x6c, 0xff, 0xff, 0xa6, 0xff, 0xe4, 0x74,
+  0x28, 0x06, 0x0c, 0x54, 0xec, 0xff, 0xff, 0x48, 0xf8, 0xff, 0x0a, 0x98, 0x00, 0x2a, 0x7c, 0xba,
+  0xda, 0xf2, 0xf8, 0xe4, 0xb0, 0x50, 0xbd, 0x00,
 
   /*Unicode: U+004b (K) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x88, 0x00,  //@@@.......+@@%.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0x94, 0x00, 0x00,  //@@@......+@@%..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfc, 0xff, 0xa0, 0x00, 0x00, 0x00,  //@@@.....+@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfa, 0xff, 0xac, 0x02, 0x00, 0x00, 0x00,  //@@@....+@@%....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x46, 0xf8, 0xff, 0xb6, 0x04, 0x00, 0x00, 0x00, 0x00,  //@@@...+@@%.....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x3c, 0xf4, 0xff, 0xc0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@...@@@......
-  0xff, 0xff, 0xff, 0x00, 0x32, 0xf0, 0xff, 0xc8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..@@@.......
-  0xff, 0xff, 0xff, 0x2a, 0xea, 0xff, 0xdc, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.@@@........
-  0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xf6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@.......
-  0xff, 0xff, 0xff, 0xe0, 0x48, 0xf6, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@+@@@+......
-  0xff, 0xff, 0xff, 0x26, 0x00, 0x76, 0xff, 0xff, 0xf8, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..+@@@......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0xc6, 0xff, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00,  //@@@...@@@@.....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x24, 0xf4, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00,  //@@@....@@@%....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xfa, 0x32, 0x00, 0x00, 0x00,  //@@@....+@@@....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xd4, 0x06, 0x00, 0x00,  //@@@.....%@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf2, 0xff, 0xff, 0x88, 0x00, 0x00,  //@@@......@@@%..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xfc, 0x38, 0x00,  //@@@......+@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xd8, 0x08,  //@@@.......%@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb6, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0x04, 0x74, 0xff, 0xff, 0x88, 0x00, 0xfe, 0xff, 0xfb, 0x00,
+  0x05, 0x68, 0xff, 0xff, 0x94, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x5c, 0xfc, 0xff, 0xa0,
+  0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04, 0x50, 0xfa, 0xff, 0xac, 0x02, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0x04, 0x46, 0xf8, 0xff, 0xb6, 0x04, 0xfd, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x00, 0x3c,
+  0xf4, 0xff, 0xc0, 0x08, 0xfc, 0x00, 0xfe, 0xff, 0x05, 0x00, 0x32, 0xf0, 0xff, 0xc8, 0x0c, 0xfb,
+  0x00, 0xfe, 0xff, 0x04, 0x2a, 0xea, 0xff, 0xdc, 0x10, 0xfa, 0x00, 0xfe, 0xff, 0x04, 0xe6, 0xff,
+  0xff, 0xf6, 0x28, 0xfa, 0x00, 0xfa, 0xff, 0x01, 0xca, 0x02, 0xfb, 0x00, 0xfe, 0xff, 0x05, 0xe0,
+  0x48, 0xf6, 0xff, 0xff, 0x7a, 0xfb, 0x00, 0xfe, 0xff, 0x06, 0x26, 0x00, 0x76, 0xff, 0xff, 0xf8,
+  0x2e, 0xfc, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x00, 0x02, 0xc6, 0xff, 0xff, 0xce, 0x04, 0xfd, 0x00,
+  0xfe, 0xff, 0xfe, 0x00, 0x04, 0x24, 0xf4, 0xff, 0xff, 0x82, 0xfd, 0x00, 0xfe, 0xff, 0xfd, 0x00,
+  0x04, 0x6e, 0xff, 0xff, 0xfa, 0x32, 0xfe, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x06, 0xbe, 0xff, 0xff,
+  0xd4, 0x06, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x06, 0x20, 0xf2, 0xff, 0xff, 0x88, 0x00, 0x00,
+  0xfe, 0xff, 0xfb, 0x00, 0x05, 0x66, 0xff, 0xff, 0xfc, 0x38, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0x04,
+  0xb8, 0xff, 0xff, 0xd8, 0x08, 0xa7, 0x00,
 
   /*Unicode: U+004c (L) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xe9, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+004d (M) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xf4, 0x06, 0x00, 0x00, 0x00, 0x08, 0xf6, 0xff, 0xff, 0xff,  //@@@@.....@@@@
-  0xff, 0xff, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff, 0xff,  //@@@@+...+@@@@
-  0xff, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xff, 0xff,  //@@@@%...%@@@@
-  0xff, 0xff, 0xff, 0xd6, 0xd2, 0x00, 0x00, 0x00, 0xd6, 0xd8, 0xff, 0xff, 0xff,  //@@@@@...@@@@@
-  0xff, 0xff, 0xff, 0x90, 0xff, 0x1a, 0x00, 0x1e, 0xff, 0x92, 0xff, 0xff, 0xff,  //@@@%@...@%@@@
-  0xff, 0xff, 0xff, 0x48, 0xff, 0x60, 0x00, 0x66, 0xff, 0x4a, 0xff, 0xff, 0xff,  //@@@+@+.+@+@@@
-  0xff, 0xff, 0xff, 0x08, 0xf6, 0xa6, 0x00, 0xac, 0xf6, 0x08, 0xff, 0xff, 0xff,  //@@@.@%.%@.@@@
-  0xff, 0xff, 0xff, 0x00, 0xb8, 0xea, 0x04, 0xf0, 0xba, 0x00, 0xff, 0xff, 0xff,  //@@@.%@.@%.@@@
-  0xff, 0xff, 0xff, 0x00, 0x72, 0xff, 0x72, 0xff, 0x72, 0x00, 0xff, 0xff, 0xff,  //@@@.+@+@+.@@@
-  0xff, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xee, 0xff, 0x2a, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xe2, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x9a, 0xff, 0x9a, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..%@%..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc0, 0x00, 0xfe, 0xff, 0x01, 0xf4, 0x06, 0xfe, 0x00, 0x01, 0x08, 0xf6, 0xfa, 0xff, 0x00, 0x44,
+  0xfe, 0x00, 0x00, 0x46, 0xf9, 0xff, 0x00, 0x8a, 0xfe, 0x00, 0x00, 0x8e, 0xfa, 0xff, 0x01, 0xd6,
+  0xd2, 0xfe, 0x00, 0x01, 0xd6, 0xd8, 0xfb, 0xff, 0x06, 0x90, 0xff, 0x1a, 0x00, 0x1e, 0xff, 0x92,
+  0xfb, 0xff, 0x06, 0x48, 0xff, 0x60, 0x00, 0x66, 0xff, 0x4a, 0xfb, 0xff, 0x06, 0x08, 0xf6, 0xa6,
+  0x00, 0xac, 0xf6, 0x08, 0xfb, 0xff, 0x06, 0x00, 0xb8, 0xea, 0x04, 0xf0, 0xba, 0x00, 0xfb, 0xff,
+  0x06, 0x00, 0x72, 0xff, 0x72, 0xff, 0x72, 0x00, 0xfb, 0xff, 0x06, 0x00, 0x2a, 0xff, 0xee, 0xff,
+  0x2a, 0x00, 0xfb, 0xff, 0x06, 0x00, 0x00, 0xe2, 0xff, 0xe0, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x00,
+  0x00, 0x9a, 0xff, 0x9a, 0x00, 0x00, 0xfb, 0xff, 0xfa, 0x00, 0xfb, 0xff, 0xfa, 0x00, 0xfb, 0xff,
+  0xfa, 0x00, 0xfb, 0xff, 0xfa, 0x00, 0xfb, 0xff, 0xfa, 0x00, 0xfb, 0xff, 0xfa, 0x00, 0xfb, 0xff,
+  0xfa, 0x00, 0xfe, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+004e (N) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@%....@@@
-  0xff, 0xff, 0xff, 0xfa, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@@....@@@
-  0xff, 0xff, 0xff, 0xba, 0xff, 0x36, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@%@....@@@
-  0xff, 0xff, 0xff, 0x60, 0xff, 0x90, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@+@%...@@@
-  0xff, 0xff, 0xff, 0x0e, 0xf6, 0xe6, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.@@...@@@
-  0xff, 0xff, 0xff, 0x00, 0xac, 0xff, 0x44, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.%@+..@@@
-  0xff, 0xff, 0xff, 0x00, 0x52, 0xff, 0x9e, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.+@%..@@@
-  0xff, 0xff, 0xff, 0x00, 0x06, 0xf0, 0xf0, 0x06, 0x00, 0xff, 0xff, 0xff,  //@@@..@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x9e, 0xff, 0x52, 0x00, 0xff, 0xff, 0xff,  //@@@..%@+.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x46, 0xff, 0xac, 0x00, 0xff, 0xff, 0xff,  //@@@..+@%.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0xe8, 0xf6, 0x0e, 0xff, 0xff, 0xff,  //@@@...@@.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x92, 0xff, 0x60, 0xff, 0xff, 0xff,  //@@@...%@+@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0xff, 0xba, 0xff, 0xff, 0xff,  //@@@....@%@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfc, 0xff, 0xff, 0xff,  //@@@....@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff,  //@@@....%@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfe, 0xff, 0x00, 0xce, 0xfc, 0x00, 0xfa, 0xff, 0x00, 0x28, 0xfd, 0x00, 0xfa, 0xff,
+  0x00, 0x82, 0xfd, 0x00, 0xfb, 0xff, 0x01, 0xfa, 0xdc, 0xfd, 0x00, 0xfb, 0xff, 0x02, 0xba, 0xff,
+  0x36, 0xfe, 0x00, 0xfb, 0xff, 0x02, 0x60, 0xff, 0x90, 0xfe, 0x00, 0xfb, 0xff, 0x05, 0x0e, 0xf6,
+  0xe6, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xac, 0xff, 0x44, 0x00, 0x00, 0xfb, 0xff, 0x05,
+  0x00, 0x52, 0xff, 0x9e, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0x06, 0xf0, 0xf0, 0x06, 0x00, 0xfb,
+  0xff, 0x05, 0x00, 0x00, 0x9e, 0xff, 0x52, 0x00, 0xfb, 0xff, 0x05, 0x00, 0x00, 0x46, 0xff, 0xac,
+  0x00, 0xfb, 0xff, 0x05, 0x00, 0x00, 0x02, 0xe8, 0xf6, 0x0e, 0xfb, 0xff, 0xfe, 0x00, 0x02, 0x92,
+  0xff, 0x60, 0xfb, 0xff, 0xfe, 0x00, 0x02, 0x38, 0xff, 0xba, 0xfb, 0xff, 0xfd, 0x00, 0x01, 0xdc,
+  0xfc, 0xfb, 0xff, 0xfd, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xfd, 0x00, 0x00, 0x2a, 0xfa, 0xff, 0xfc,
+  0x00, 0x00, 0xd0, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+004f (O) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbd, 0x00, 0x06, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00, 0x98, 0xfa, 0xff,
+  0x00, 0x96, 0xfe, 0x00, 0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e,
+  0x00, 0x0c, 0xec, 0xff, 0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec, 0x0c, 0x58, 0xff,
+  0xff, 0x8a, 0xfc, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07,
+  0x50, 0xff, 0xff, 0x9c, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8,
+  0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00,
+  0x06, 0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff, 0xfc, 0xf4, 0xff,
+  0xff, 0x04, 0xfc, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07,
+  0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0x9e,
+  0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0x5a, 0xff, 0xff, 0x8a, 0xfc, 0x00,
+  0x08, 0x8c, 0xff, 0xff, 0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10, 0x0e, 0xe8, 0xff,
+  0xee, 0x0c, 0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0xfe, 0x00,
+  0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9a, 0xfc, 0x00, 0x06, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c,
+  0xb0, 0x00,
 
   /*Unicode: U+0050 (P) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xd2, 0x94, 0x2a, 0x00, 0x00,  //@@@@@@@@%...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6c, 0x00,  //@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x22, 0x84, 0xfa, 0xff, 0xff, 0x3e,  //@@@....%@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xb0,  //@@@.....%@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xe8,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf8,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xe8,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xb2,  //@@@.....%@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x22, 0x84, 0xfa, 0xff, 0xff, 0x42,  //@@@....%@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x74, 0x00,  //@@@@@@@@@@+.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xd4, 0x96, 0x2e, 0x00, 0x00,  //@@@@@@@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfc, 0xff, 0x06, 0xfc, 0xf0, 0xd2, 0x94, 0x2a, 0x00, 0x00, 0xf8, 0xff, 0x02, 0xfa,
+  0x6c, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x05, 0x22, 0x84, 0xfa, 0xff, 0xff, 0x3e, 0xfe, 0xff, 0xfc,
+  0x00, 0x03, 0x88, 0xff, 0xff, 0xb0, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x24, 0xff, 0xff, 0xe8, 0xfe,
+  0xff, 0xfc, 0x00, 0x03, 0x08, 0xff, 0xff, 0xf8, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x26, 0xff, 0xff,
+  0xe8, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x8a, 0xff, 0xff, 0xb2, 0xfe, 0xff, 0xfe, 0x00, 0x05, 0x22,
+  0x84, 0xfa, 0xff, 0xff, 0x42, 0xf8, 0xff, 0x02, 0xfa, 0x74, 0x00, 0xfb, 0xff, 0x05, 0xf2, 0xd4,
+  0x96, 0x2e, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00,
+  0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00,
+  0xfe, 0xff, 0xb0, 0x00,
 
   /*Unicode: U+0051 (Q) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xca,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9a,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xea, 0x08,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x64, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x50, 0xb4, 0xe8, 0xfc, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00,  //...+%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xfc, 0x7a, 0x00, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x8a, 0x00,  //........%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x96, 0x12, 0x00,  //.........%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbd, 0x00, 0x06, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00, 0x98, 0xfa, 0xff,
+  0x00, 0x96, 0xfe, 0x00, 0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e,
+  0x00, 0x0c, 0xec, 0xff, 0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec, 0x0c, 0x58, 0xff,
+  0xff, 0x8a, 0xfc, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07,
+  0x50, 0xff, 0xff, 0x9c, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8,
+  0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00,
+  0x06, 0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff, 0xfc, 0xf4, 0xff,
+  0xff, 0x04, 0xfc, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf6, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07,
+  0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xca, 0x9e,
+  0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9a, 0x5a, 0xff, 0xff, 0x8a, 0xfc, 0x00,
+  0x08, 0x8c, 0xff, 0xff, 0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10, 0x0e, 0xe8, 0xff,
+  0xea, 0x08, 0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x64, 0xfe, 0x00,
+  0x00, 0x9e, 0xfa, 0xff, 0x00, 0x86, 0xfc, 0x00, 0x06, 0x50, 0xb4, 0xe8, 0xfc, 0xff, 0xff, 0x8e,
+  0xf7, 0x00, 0x03, 0x8e, 0xff, 0xfc, 0x7a, 0xf7, 0x00, 0x03, 0x9a, 0xff, 0xff, 0x8a, 0xf7, 0x00,
+  0x02, 0xa2, 0x96, 0x12, 0xd9, 0x00,
 
   /*Unicode: U+0052 (R) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xcc, 0x8a, 0x22, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@%.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x60, 0x00, 0x00, 0x00,  //@@@@@@@@@@+...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x24, 0x86, 0xfa, 0xff, 0xfc, 0x36, 0x00, 0x00,  //@@@....%@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xaa, 0x00, 0x00,  //@@@.....%@@%..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xe6, 0x00, 0x00,  //@@@......@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf8, 0x00, 0x00,  //@@@......@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xe4, 0x00, 0x00,  //@@@......@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0x9c, 0x00, 0x00,  //@@@.....+@@%..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1e, 0x74, 0xf6, 0xff, 0xe0, 0x18, 0x00, 0x00,  //@@@....+@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x9c, 0x10, 0x00, 0x00, 0x00,  //@@@@@@@@@%....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa8, 0x1c, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@%.....
-  0xff, 0xff, 0xff, 0x06, 0x14, 0x32, 0x9c, 0xff, 0xff, 0xe6, 0x1c, 0x00, 0x00, 0x00,  //@@@...%@@@....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //@@@....%@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf0, 0xff, 0xff, 0x4a, 0x00, 0x00,  //@@@.....@@@+..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xcc, 0x00, 0x00,  //@@@.....%@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xf2, 0xff, 0xff, 0x4a, 0x00,  //@@@......@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xc6, 0x00,  //@@@......%@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf6, 0xff, 0xff, 0x42,  //@@@.......@@@+
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xc0,  //@@@.......%@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xbb, 0x00, 0xfc, 0xff, 0x04, 0xfc, 0xee, 0xcc, 0x8a, 0x22, 0xfd, 0x00, 0xf8, 0xff, 0x01, 0xf6,
+  0x60, 0xfe, 0x00, 0xfe, 0xff, 0x0a, 0x00, 0x00, 0x02, 0x24, 0x86, 0xfa, 0xff, 0xfc, 0x36, 0x00,
+  0x00, 0xfe, 0xff, 0xfc, 0x00, 0x05, 0x86, 0xff, 0xff, 0xaa, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00,
+  0x05, 0x24, 0xff, 0xff, 0xe6, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x05, 0x08, 0xff, 0xff, 0xf8,
+  0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x05, 0x22, 0xff, 0xff, 0xe4, 0x00, 0x00, 0xfe, 0xff, 0xfc,
+  0x00, 0x05, 0x78, 0xff, 0xff, 0x9c, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x07, 0x1e, 0x74, 0xf6,
+  0xff, 0xe0, 0x18, 0x00, 0x00, 0xf9, 0xff, 0x02, 0xea, 0x9c, 0x10, 0xfe, 0x00, 0xfa, 0xff, 0x02,
+  0xfc, 0xa8, 0x1c, 0xfd, 0x00, 0xfe, 0xff, 0x07, 0x06, 0x14, 0x32, 0x9c, 0xff, 0xff, 0xe6, 0x1c,
+  0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0xa2, 0xff, 0xff, 0xb8, 0xfe, 0x00, 0xfe, 0xff, 0xfd,
+  0x00, 0x06, 0x14, 0xf0, 0xff, 0xff, 0x4a, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x05, 0x84, 0xff,
+  0xff, 0xcc, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x05, 0x12, 0xf2, 0xff, 0xff, 0x4a, 0x00, 0xfe,
+  0xff, 0xfb, 0x00, 0x04, 0x8c, 0xff, 0xff, 0xc6, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0x04, 0x18, 0xf6,
+  0xff, 0xff, 0x42, 0xfe, 0xff, 0xfa, 0x00, 0x03, 0x94, 0xff, 0xff, 0xc0, 0xad, 0x00,
 
   /*Unicode: U+0053 (S) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x1a, 0x88, 0xd0, 0xf2, 0xf8, 0xe4, 0xba, 0x7a, 0x2a, 0x00,  //...%@@@@%+..
-  0x00, 0x4c, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.+@@@@@@@@@.
-  0x2a, 0xf6, 0xff, 0xfa, 0x90, 0x28, 0x08, 0x1a, 0x66, 0xdc, 0xff, 0x00,  //.@@@%...+@@.
-  0xa6, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x98, 0x00,  //%@@%......%.
-  0xe6, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xf8, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xe0, 0xff, 0xff, 0xa4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%........
-  0x8a, 0xff, 0xff, 0xff, 0xee, 0xa6, 0x60, 0x1c, 0x00, 0x00, 0x00, 0x00,  //%@@@@%+.....
-  0x0c, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x50, 0x00, 0x00,  //.@@@@@@@@+..
-  0x00, 0x06, 0x76, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00,  //..+@@@@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x32, 0x72, 0xba, 0xfc, 0xff, 0xff, 0xff, 0x50,  //.....+%@@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd4, 0xff, 0xff, 0xba,  //........@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xec,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xfa,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xec,  //.........@@@
-  0xaa, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xb8,  //%.......+@@%
-  0xff, 0xf2, 0x8c, 0x38, 0x0c, 0x0a, 0x2e, 0x96, 0xfc, 0xff, 0xff, 0x48,  //@@%....%@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x70, 0x00,  //@@@@@@@@@@+.
-  0x28, 0x74, 0xb0, 0xda, 0xf4, 0xfa, 0xee, 0xcc, 0x8e, 0x28, 0x00, 0x00,  //.+%@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc3, 0x00, 0x0c, 0x1a, 0x88, 0xd0, 0xf2, 0xf8, 0xe4, 0xba, 0x7a, 0x2a, 0x00, 0x00, 0x4c, 0xf0,
+  0xf9, 0xff, 0x10, 0x00, 0x2a, 0xf6, 0xff, 0xfa, 0x90, 0x28, 0x08, 0x1a, 0x66, 0xdc, 0xff, 0x00,
+  0xa6, 0xff, 0xff, 0x80, 0xfc, 0x00, 0x06, 0x06, 0x98, 0x00, 0xe6, 0xff, 0xff, 0x1c, 0xf9, 0x00,
+  0x03, 0xf8, 0xff, 0xff, 0x16, 0xf9, 0x00, 0x04, 0xe0, 0xff, 0xff, 0xa4, 0x0a, 0xfa, 0x00, 0x00,
+  0x8a, 0xfe, 0xff, 0x03, 0xee, 0xa6, 0x60, 0x1c, 0xfd, 0x00, 0x01, 0x0c, 0xc8, 0xfb, 0xff, 0x01,
+  0xca, 0x50, 0xfe, 0x00, 0x02, 0x06, 0x76, 0xe0, 0xfb, 0xff, 0x00, 0x90, 0xfc, 0x00, 0x03, 0x32,
+  0x72, 0xba, 0xfc, 0xfe, 0xff, 0x00, 0x50, 0xfa, 0x00, 0x04, 0x24, 0xd4, 0xff, 0xff, 0xba, 0xf9,
+  0x00, 0x03, 0x3e, 0xff, 0xff, 0xec, 0xf9, 0x00, 0x03, 0x0a, 0xff, 0xff, 0xfa, 0xf9, 0x00, 0x05,
+  0x14, 0xff, 0xff, 0xec, 0xaa, 0x14, 0xfb, 0x00, 0x0f, 0x78, 0xff, 0xff, 0xb8, 0xff, 0xf2, 0x8c,
+  0x38, 0x0c, 0x0a, 0x2e, 0x96, 0xfc, 0xff, 0xff, 0x48, 0xf8, 0xff, 0x0c, 0xfa, 0x70, 0x00, 0x28,
+  0x74, 0xb0, 0xda, 0xf4, 0xfa, 0xee, 0xcc, 0x8e, 0x28, 0xb7, 0x00,
 
   /*Unicode: U+0054 (T) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb6, 0x00, 0xe3, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff,
+  0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff,
+  0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff,
+  0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff,
+  0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xa1, 0x00,
 
   /*Unicode: U+0055 (U) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xd6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xd4,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x9c,  //%@@+....+@@%
-  0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30,  //.@@@+..+@@@.
-  0x00, 0x60, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfe, 0xff, 0x02, 0xfa, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0xfa, 0xee, 0xff,
+  0xff, 0xfc, 0x00, 0x07, 0x02, 0xff, 0xff, 0xee, 0xd6, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x07, 0x12,
+  0xff, 0xff, 0xd4, 0xa0, 0xff, 0xff, 0x52, 0xfd, 0x00, 0x12, 0x58, 0xff, 0xff, 0x9c, 0x32, 0xfa,
+  0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30, 0x00, 0x60, 0xf8, 0xfb, 0xff, 0x01,
+  0xf8, 0x60, 0xfe, 0x00, 0x07, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0xb7, 0x00,
 
   /*Unicode: U+0056 (V) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xda, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xda,  //@@@+......+@@@
-  0x90, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x90,  //%@@%......%@@%
-  0x46, 0xff, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xff, 0x46,  //+@@@......@@@+
-  0x06, 0xf4, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xf4, 0x06,  //.@@@......@@@.
-  0x00, 0xb4, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb2, 0x00,  //.%@@+....+@@%.
-  0x00, 0x6a, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xff, 0x68, 0x00,  //.+@@%....%@@+.
-  0x00, 0x20, 0xff, 0xff, 0xf4, 0x06, 0x00, 0x00, 0x08, 0xf4, 0xff, 0xff, 0x1e, 0x00,  //..@@@....@@@..
-  0x00, 0x00, 0xd6, 0xff, 0xff, 0x46, 0x00, 0x00, 0x48, 0xff, 0xff, 0xd6, 0x00, 0x00,  //..@@@+..+@@@..
-  0x00, 0x00, 0x8c, 0xff, 0xff, 0x90, 0x00, 0x00, 0x92, 0xff, 0xff, 0x8c, 0x00, 0x00,  //..%@@%..%@@%..
-  0x00, 0x00, 0x42, 0xff, 0xff, 0xda, 0x00, 0x00, 0xda, 0xff, 0xff, 0x42, 0x00, 0x00,  //..+@@@..@@@+..
-  0x00, 0x00, 0x04, 0xf2, 0xff, 0xff, 0x24, 0x26, 0xff, 0xff, 0xf2, 0x04, 0x00, 0x00,  //...@@@..@@@...
-  0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x6e, 0x6e, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00,  //...%@@++@@%...
-  0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xb8, 0xb8, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00,  //...+@@%%@@+...
-  0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00,  //....%@@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00,  //....+@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xf0, 0xff, 0xff, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xbb, 0x00, 0x03, 0xda, 0xff, 0xff, 0x42, 0xfb, 0x00, 0x07, 0x44, 0xff, 0xff, 0xda, 0x90, 0xff,
+  0xff, 0x8c, 0xfb, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x90, 0x46, 0xff, 0xff, 0xd6, 0xfb, 0x00, 0x08,
+  0xd8, 0xff, 0xff, 0x46, 0x06, 0xf4, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x09, 0x20, 0xff, 0xff, 0xf4,
+  0x06, 0x00, 0xb4, 0xff, 0xff, 0x6a, 0xfd, 0x00, 0x09, 0x6a, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x6a,
+  0xff, 0xff, 0xb4, 0xfd, 0x00, 0x11, 0xb4, 0xff, 0xff, 0x68, 0x00, 0x00, 0x20, 0xff, 0xff, 0xf4,
+  0x06, 0x00, 0x00, 0x08, 0xf4, 0xff, 0xff, 0x1e, 0xfe, 0x00, 0x09, 0xd6, 0xff, 0xff, 0x46, 0x00,
+  0x00, 0x48, 0xff, 0xff, 0xd6, 0xfd, 0x00, 0x09, 0x8c, 0xff, 0xff, 0x90, 0x00, 0x00, 0x92, 0xff,
+  0xff, 0x8c, 0xfd, 0x00, 0x09, 0x42, 0xff, 0xff, 0xda, 0x00, 0x00, 0xda, 0xff, 0xff, 0x42, 0xfd,
+  0x00, 0x09, 0x04, 0xf2, 0xff, 0xff, 0x24, 0x26, 0xff, 0xff, 0xf2, 0x04, 0xfc, 0x00, 0x07, 0xb0,
+  0xff, 0xff, 0x6e, 0x6e, 0xff, 0xff, 0xae, 0xfb, 0x00, 0x07, 0x66, 0xff, 0xff, 0xb8, 0xb8, 0xff,
+  0xff, 0x64, 0xfb, 0x00, 0x07, 0x1c, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0x1c, 0xfa, 0x00, 0x00,
+  0xd2, 0xfd, 0xff, 0x00, 0xd2, 0xf9, 0x00, 0x00, 0x88, 0xfd, 0xff, 0x00, 0x88, 0xf9, 0x00, 0x00,
+  0x40, 0xfd, 0xff, 0x00, 0x3e, 0xf9, 0x00, 0x05, 0x04, 0xf0, 0xff, 0xff, 0xf0, 0x02, 0xf8, 0x00,
+  0x03, 0xac, 0xff, 0xff, 0xaa, 0xa8, 0x00,
 
   /*Unicode: U+0057 (W) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xec, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xea,  //@@@..........@@@
-  0xc4, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xc4,  //@@@+........+@@@
-  0x9e, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0x9c,  //%@@+........+@@%
-  0x76, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x76,  //+@@%........%@@+
-  0x50, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0x4e,  //+@@%........%@@+
-  0x28, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x6c, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x28,  //.@@@..+@@+..@@@.
-  0x04, 0xfa, 0xff, 0xfc, 0x06, 0x00, 0xa4, 0xff, 0xff, 0xa2, 0x00, 0x06, 0xfc, 0xff, 0xfa, 0x04,  //.@@@..%@@%..@@@.
-  0x00, 0xda, 0xff, 0xff, 0x2a, 0x00, 0xda, 0xf8, 0xf8, 0xd8, 0x00, 0x2a, 0xff, 0xff, 0xda, 0x00,  //.@@@..@@@@..@@@.
-  0x00, 0xb4, 0xff, 0xff, 0x50, 0x10, 0xff, 0xc4, 0xc6, 0xfc, 0x0e, 0x50, 0xff, 0xff, 0xb2, 0x00,  //.%@@+.@@@@.+@@%.
-  0x00, 0x8c, 0xff, 0xff, 0x78, 0x46, 0xff, 0x8a, 0x8c, 0xff, 0x44, 0x78, 0xff, 0xff, 0x8c, 0x00,  //.%@@++@%%@++@@%.
-  0x00, 0x66, 0xff, 0xff, 0x9e, 0x7c, 0xff, 0x50, 0x50, 0xff, 0x7a, 0x9e, 0xff, 0xff, 0x64, 0x00,  //.+@@%+@++@+%@@+.
-  0x00, 0x3e, 0xff, 0xff, 0xc6, 0xb2, 0xff, 0x16, 0x16, 0xff, 0xae, 0xc6, 0xff, 0xff, 0x3e, 0x00,  //..@@@%@..@%@@@..
-  0x00, 0x18, 0xff, 0xff, 0xec, 0xe6, 0xda, 0x00, 0x00, 0xdc, 0xe4, 0xec, 0xff, 0xff, 0x16, 0x00,  //..@@@@@..@@@@@..
-  0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //..@@@@%..%@@@@..
-  0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00,  //..@@@@+..+@@@@..
-  0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00,  //..%@@@....@@@%..
-  0x00, 0x00, 0x7c, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0xff, 0x7a, 0x00, 0x00,  //..+@@@....@@@+..
-  0x00, 0x00, 0x54, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0x54, 0x00, 0x00,  //..+@@%....%@@+..
-  0x00, 0x00, 0x2e, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0x2e, 0x00, 0x00,  //...@@+....+@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xb1, 0x00, 0x03, 0xec, 0xff, 0xff, 0x1a, 0xf9, 0x00, 0x07, 0x1a, 0xff, 0xff, 0xea, 0xc4, 0xff,
+  0xff, 0x40, 0xf9, 0x00, 0x07, 0x40, 0xff, 0xff, 0xc4, 0x9e, 0xff, 0xff, 0x66, 0xf9, 0x00, 0x07,
+  0x68, 0xff, 0xff, 0x9c, 0x76, 0xff, 0xff, 0x8e, 0xf9, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x76, 0x50,
+  0xff, 0xff, 0xb4, 0xf9, 0x00, 0x7f, 0xb6, 0xff, 0xff, 0x4e, 0x28, 0xff, 0xff, 0xdc, 0x00, 0x00,
+  0x6e, 0xff, 0xff, 0x6c, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x28, 0x04, 0xfa, 0xff, 0xfc, 0x06, 0x00,
+  0xa4, 0xff, 0xff, 0xa2, 0x00, 0x06, 0xfc, 0xff, 0xfa, 0x04, 0x00, 0xda, 0xff, 0xff, 0x2a, 0x00,
+  0xda, 0xf8, 0xf8, 0xd8, 0x00, 0x2a, 0xff, 0xff, 0xda, 0x00, 0x00, 0xb4, 0xff, 0xff, 0x50, 0x10,
+  0xff, 0xc4, 0xc6, 0xfc, 0x0e, 0x50, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x78, 0x46,
+  0xff, 0x8a, 0x8c, 0xff, 0x44, 0x78, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x66, 0xff, 0xff, 0x9e, 0x7c,
+  0xff, 0x50, 0x50, 0xff, 0x7a, 0x9e, 0xff, 0xff, 0x64, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xc6, 0xb2,
+  0xff, 0x16, 0x16, 0xff, 0xae, 0xc6, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x18, 0xff, 0xff, 0xec, 0xe6,
+  0xda, 0x00, 0x00, 0xdc, 0xe4, 0xec, 0x02, 0xff, 0xff, 0x16, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0xff,
+  0x03, 0xa0, 0x00, 0x00, 0xa0, 0xfe, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xca, 0xfe, 0xff, 0x03,
+  0x66, 0x00, 0x00, 0x66, 0xfe, 0xff, 0x00, 0xc8, 0xfd, 0x00, 0x00, 0xa2, 0xfe, 0xff, 0x03, 0x2a,
+  0x00, 0x00, 0x2c, 0xfe, 0xff, 0x00, 0xa2, 0xfd, 0x00, 0x03, 0x7c, 0xff, 0xff, 0xee, 0xfd, 0x00,
+  0x03, 0xee, 0xff, 0xff, 0x7a, 0xfd, 0x00, 0x03, 0x54, 0xff, 0xff, 0xb6, 0xfd, 0x00, 0x03, 0xb6,
+  0xff, 0xff, 0x54, 0xfd, 0x00, 0x03, 0x2e, 0xff, 0xff, 0x7c, 0xfd, 0x00, 0x03, 0x7c, 0xff, 0xff,
+  0x2e, 0x9f, 0x00,
 
   /*Unicode: U+0058 (X) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xaa, 0xff, 0xff, 0xde, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe4, 0xff, 0xff, 0xa6,  //%@@@.......@@@%
-  0x14, 0xea, 0xff, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xe4, 0x10,  //.@@@%.....%@@@.
-  0x00, 0x58, 0xff, 0xff, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@....+@@@+.
-  0x00, 0x00, 0xae, 0xff, 0xff, 0xda, 0x08, 0x00, 0x18, 0xec, 0xff, 0xff, 0x98, 0x00, 0x00,  //..%@@@...@@@%..
-  0x00, 0x00, 0x18, 0xec, 0xff, 0xff, 0x90, 0x00, 0xb6, 0xff, 0xff, 0xdc, 0x0a, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xfc, 0x9a, 0xff, 0xff, 0xfc, 0x3c, 0x00, 0x00, 0x00,  //...+@@@%@@@....
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x1a, 0xee, 0xff, 0xff, 0xff, 0xd2, 0x06, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xfa, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xfc, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@......
-  0x00, 0x00, 0x00, 0x00, 0x12, 0xec, 0xff, 0xff, 0xff, 0xce, 0x02, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@+....
-  0x00, 0x00, 0x00, 0x30, 0xfc, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xf0, 0x18, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xb2, 0x04, 0xd6, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00,  //...@@@%.@@@%...
-  0x00, 0x00, 0x5a, 0xff, 0xff, 0xf8, 0x22, 0x00, 0x42, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00,  //..+@@@..+@@@+..
-  0x00, 0x0a, 0xe4, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xd6, 0x04, 0x00,  //..@@@%...%@@@..
-  0x00, 0x88, 0xff, 0xff, 0xe2, 0x0a, 0x00, 0x00, 0x00, 0x18, 0xf0, 0xff, 0xff, 0x78, 0x00,  //.%@@@.....@@@+.
-  0x24, 0xf8, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xf4, 0x1e,  //.@@@+.....+@@@.
-  0xb4, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xce, 0xff, 0xff, 0xb0,  //%@@@.......@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb6, 0x00, 0x04, 0xaa, 0xff, 0xff, 0xde, 0x0a, 0xfc, 0x00, 0x09, 0x10, 0xe4, 0xff, 0xff, 0xa6,
+  0x14, 0xea, 0xff, 0xff, 0x94, 0xfc, 0x00, 0x0a, 0xa6, 0xff, 0xff, 0xe4, 0x10, 0x00, 0x58, 0xff,
+  0xff, 0xfc, 0x3e, 0xfe, 0x00, 0x00, 0x58, 0xfe, 0xff, 0x00, 0x48, 0xfe, 0x00, 0x0a, 0xae, 0xff,
+  0xff, 0xda, 0x08, 0x00, 0x18, 0xec, 0xff, 0xff, 0x98, 0xfd, 0x00, 0x0a, 0x18, 0xec, 0xff, 0xff,
+  0x90, 0x00, 0xb6, 0xff, 0xff, 0xdc, 0x0a, 0xfc, 0x00, 0x08, 0x5c, 0xff, 0xff, 0xfc, 0x9a, 0xff,
+  0xff, 0xfc, 0x3c, 0xfa, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0x00, 0x8a, 0xf9, 0x00, 0x01, 0x1a, 0xee,
+  0xfe, 0xff, 0x01, 0xd2, 0x06, 0xf8, 0x00, 0x04, 0x60, 0xff, 0xff, 0xfa, 0x30, 0xf7, 0x00, 0x04,
+  0x6c, 0xff, 0xff, 0xfc, 0x36, 0xf8, 0x00, 0x01, 0x12, 0xec, 0xfe, 0xff, 0x01, 0xce, 0x02, 0xf9,
+  0x00, 0x00, 0x98, 0xfc, 0xff, 0x00, 0x6e, 0xfa, 0x00, 0x08, 0x30, 0xfc, 0xff, 0xff, 0xb6, 0xff,
+  0xff, 0xf0, 0x18, 0xfb, 0x00, 0x08, 0xc4, 0xff, 0xff, 0xb2, 0x04, 0xd6, 0xff, 0xff, 0xa4, 0xfc,
+  0x00, 0x06, 0x5a, 0xff, 0xff, 0xf8, 0x22, 0x00, 0x42, 0xfe, 0xff, 0x00, 0x40, 0xfe, 0x00, 0x04,
+  0x0a, 0xe4, 0xff, 0xff, 0x86, 0xfe, 0x00, 0x0b, 0xa6, 0xff, 0xff, 0xd6, 0x04, 0x00, 0x00, 0x88,
+  0xff, 0xff, 0xe2, 0x0a, 0xfe, 0x00, 0x0a, 0x18, 0xf0, 0xff, 0xff, 0x78, 0x00, 0x24, 0xf8, 0xff,
+  0xff, 0x58, 0xfc, 0x00, 0x08, 0x6e, 0xff, 0xff, 0xf4, 0x1e, 0xb4, 0xff, 0xff, 0xc0, 0xfb, 0x00,
+  0x04, 0x02, 0xce, 0xff, 0xff, 0xb0, 0xa7, 0x00,
 
   /*Unicode: U+0059 (Y) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xb6, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xb4,  //%@@%.......%@@%
-  0x28, 0xfa, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xfa, 0x26,  //.@@@+.....+@@@.
-  0x00, 0x90, 0xff, 0xff, 0xda, 0x04, 0x00, 0x00, 0x00, 0x06, 0xdc, 0xff, 0xff, 0x8e, 0x00,  //.%@@@.....@@@%.
-  0x00, 0x10, 0xec, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xea, 0x10, 0x00,  //..@@@+...+@@@..
-  0x00, 0x00, 0x6a, 0xff, 0xff, 0xf0, 0x16, 0x00, 0x16, 0xf0, 0xff, 0xff, 0x6a, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0x02, 0xd4, 0xff, 0xff, 0x9a, 0x00, 0x9c, 0xff, 0xff, 0xd2, 0x02, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xfc, 0x62, 0xfc, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00,  //...+@@@+@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x26, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb6, 0x00, 0x03, 0xb6, 0xff, 0xff, 0xbc, 0xfa, 0x00, 0x08, 0xbc, 0xff, 0xff, 0xb4, 0x28, 0xfa,
+  0xff, 0xff, 0x4e, 0xfc, 0x00, 0x0a, 0x50, 0xff, 0xff, 0xfa, 0x26, 0x00, 0x90, 0xff, 0xff, 0xda,
+  0x04, 0xfe, 0x00, 0x0b, 0x06, 0xdc, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x10, 0xec, 0xff, 0xff, 0x74,
+  0xfe, 0x00, 0x04, 0x76, 0xff, 0xff, 0xea, 0x10, 0xfe, 0x00, 0x0a, 0x6a, 0xff, 0xff, 0xf0, 0x16,
+  0x00, 0x16, 0xf0, 0xff, 0xff, 0x6a, 0xfd, 0x00, 0x0a, 0x02, 0xd4, 0xff, 0xff, 0x9a, 0x00, 0x9c,
+  0xff, 0xff, 0xd2, 0x02, 0xfc, 0x00, 0x08, 0x44, 0xff, 0xff, 0xfc, 0x62, 0xfc, 0xff, 0xff, 0x44,
+  0xfa, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0x00, 0xb2, 0xf9, 0x00, 0x01, 0x26, 0xf8, 0xfe, 0xff, 0x01,
+  0xf8, 0x24, 0xf8, 0x00, 0x00, 0x8c, 0xfe, 0xff, 0x00, 0x8c, 0xf7, 0x00, 0x00, 0x0e, 0xfe, 0xff,
+  0x00, 0x0e, 0xf6, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00,
+  0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00,
+  0xfe, 0xff, 0xa1, 0x00,
 
   /*Unicode: U+005a (Z) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd4, 0xff, 0xff, 0xac,  //.........@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xf0, 0x18,  //........+@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf6, 0xff, 0xff, 0x6a, 0x00,  //........@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xc8, 0x00, 0x00,  //.......%@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xfa, 0x2e, 0x00, 0x00,  //......+@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xea, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00,  //......@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xde, 0x08, 0x00, 0x00, 0x00,  //.....%@@@....
-  0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x00, 0x08, 0xdc, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@%.....
-  0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xee, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@@......
-  0x00, 0x00, 0x2c, 0xfa, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@+......
-  0x00, 0x00, 0xc6, 0xff, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@@.......
-  0x00, 0x6a, 0xff, 0xff, 0xfa, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@........
-  0x18, 0xf0, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0xac, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc0, 0x00, 0xe7, 0xff, 0xf9, 0x00, 0x04, 0x04, 0xd4, 0xff, 0xff, 0xac, 0xf9, 0x00, 0x04, 0x7c,
+  0xff, 0xff, 0xf0, 0x18, 0xfa, 0x00, 0x04, 0x24, 0xf6, 0xff, 0xff, 0x6a, 0xf9, 0x00, 0x03, 0xbe,
+  0xff, 0xff, 0xc8, 0xf9, 0x00, 0x04, 0x60, 0xff, 0xff, 0xfa, 0x2e, 0xfa, 0x00, 0x04, 0x14, 0xea,
+  0xff, 0xff, 0x8a, 0xf9, 0x00, 0x04, 0xa2, 0xff, 0xff, 0xde, 0x08, 0xfa, 0x00, 0x00, 0x44, 0xfe,
+  0xff, 0x00, 0x48, 0xfa, 0x00, 0x04, 0x08, 0xdc, 0xff, 0xff, 0xa8, 0xf9, 0x00, 0x04, 0x86, 0xff,
+  0xff, 0xee, 0x18, 0xfa, 0x00, 0x04, 0x2c, 0xfa, 0xff, 0xff, 0x68, 0xf9, 0x00, 0x03, 0xc6, 0xff,
+  0xff, 0xc6, 0xf9, 0x00, 0x04, 0x6a, 0xff, 0xff, 0xfa, 0x2c, 0xfa, 0x00, 0x04, 0x18, 0xf0, 0xff,
+  0xff, 0x86, 0xf9, 0x00, 0x04, 0xac, 0xff, 0xff, 0xdc, 0x08, 0xf9, 0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+005b ([) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xe9, 0x00, 0xf2, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xf5, 0xff,
+  0xef, 0x00,
 
   /*Unicode: U+005c (\) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xc2, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0x48, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xce, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@.........
-  0x00, 0x54, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@%........
-  0x00, 0x00, 0xd8, 0xff, 0xfc, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@@........
-  0x00, 0x00, 0x60, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@%.......
-  0x00, 0x00, 0x04, 0xe0, 0xff, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@%......
-  0x00, 0x00, 0x00, 0x08, 0xe8, 0xff, 0xf4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@......
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf0, 0xff, 0xee, 0x0c, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //.....%@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf4, 0xff, 0xe8, 0x08, 0x00, 0x00, 0x00,  //......@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00,  //......%@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf8, 0xff, 0xe0, 0x04, 0x00, 0x00,  //.......@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0xff, 0x60, 0x00, 0x00,  //.......%@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xfc, 0xff, 0xd6, 0x00, 0x00,  //........@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x54, 0x00,  //........%@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xff, 0xcc, 0x00,  //.........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0x48,  //.........%@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xc2,  //..........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc0, 0x00, 0x03, 0xc2, 0xff, 0xff, 0x3a, 0xf8, 0x00, 0x03, 0x48, 0xff, 0xff, 0xb4, 0xf7, 0x00,
+  0x03, 0xce, 0xff, 0xff, 0x2e, 0xf8, 0x00, 0x03, 0x54, 0xff, 0xff, 0xa8, 0xf7, 0x00, 0x03, 0xd8,
+  0xff, 0xfc, 0x24, 0xf8, 0x00, 0x03, 0x60, 0xff, 0xff, 0x9c, 0xf8, 0x00, 0x04, 0x04, 0xe0, 0xff,
+  0xf8, 0x1c, 0xf8, 0x00, 0x03, 0x6c, 0xff, 0xff, 0x90, 0xf8, 0x00, 0x04, 0x08, 0xe8, 0xff, 0xf4,
+  0x14, 0xf8, 0x00, 0x03, 0x78, 0xff, 0xff, 0x84, 0xf8, 0x00, 0x04, 0x0e, 0xf0, 0xff, 0xee, 0x0c,
+  0xf8, 0x00, 0x03, 0x86, 0xff, 0xff, 0x78, 0xf8, 0x00, 0x04, 0x14, 0xf4, 0xff, 0xe8, 0x08, 0xf8,
+  0x00, 0x03, 0x92, 0xff, 0xff, 0x6c, 0xf8, 0x00, 0x04, 0x1c, 0xf8, 0xff, 0xe0, 0x04, 0xf8, 0x00,
+  0x03, 0x9e, 0xff, 0xff, 0x60, 0xf8, 0x00, 0x03, 0x26, 0xfc, 0xff, 0xd6, 0xf7, 0x00, 0x03, 0xaa,
+  0xff, 0xff, 0x54, 0xf8, 0x00, 0x03, 0x30, 0xff, 0xff, 0xcc, 0xf7, 0x00, 0x03, 0xb6, 0xff, 0xff,
+  0x48, 0xf8, 0x00, 0x03, 0x3c, 0xff, 0xff, 0xc2, 0xcd, 0x00,
 
   /*Unicode: U+005d (]) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //...@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xe9, 0x00, 0xf5, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xf2, 0xff,
+  0xef, 0x00,
 
   /*Unicode: U+005e (^) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00,  //....+@@@@+....
-  0x00, 0x00, 0x00, 0x3e, 0xf8, 0xff, 0x8c, 0x8c, 0xff, 0xf8, 0x3e, 0x00, 0x00, 0x00,  //....@@%%@@....
-  0x00, 0x00, 0x22, 0xec, 0xff, 0x98, 0x00, 0x00, 0x98, 0xff, 0xec, 0x22, 0x00, 0x00,  //...@@%..%@@...
-  0x00, 0x0e, 0xd6, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xd6, 0x0e, 0x00,  //..@@%....%@@..
-  0x02, 0xb8, 0xff, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0xff, 0xb8, 0x02,  //.%@%......%@%.
-  0x94, 0xff, 0xbc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb8, 0xff, 0x92,  //%@%........%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xb6, 0x00, 0x03, 0x8e, 0xff, 0xff, 0x8e, 0xf8, 0x00, 0x00, 0x64, 0xfd, 0xff, 0x00, 0x62, 0xfa,
+  0x00, 0x07, 0x3e, 0xf8, 0xff, 0x8c, 0x8c, 0xff, 0xf8, 0x3e, 0xfc, 0x00, 0x09, 0x22, 0xec, 0xff,
+  0x98, 0x00, 0x00, 0x98, 0xff, 0xec, 0x22, 0xfe, 0x00, 0x03, 0x0e, 0xd6, 0xff, 0xa4, 0xfd, 0x00,
+  0x09, 0xa4, 0xff, 0xd6, 0x0e, 0x00, 0x02, 0xb8, 0xff, 0xb0, 0x02, 0xfd, 0x00, 0x08, 0x02, 0xb0,
+  0xff, 0xb8, 0x02, 0x94, 0xff, 0xbc, 0x06, 0xfb, 0x00, 0x03, 0x06, 0xb8, 0xff, 0x92, 0x81, 0x00,
+  0x85, 0x00,
 
   /*Unicode: U+005f (_) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@
-
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xc1, 0x00, 0xe1, 0xff,
 
   /*Unicode: U+0060 (`) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x96, 0xff, 0xce, 0x04, 0x00, 0x00,  //%@@...
-  0x04, 0xc0, 0xff, 0x88, 0x00, 0x00,  //.@@%..
-  0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00,  //..@@..
-  0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e,  //...@@.
-  0x00, 0x00, 0x00, 0x54, 0xff, 0xa4,  //...+@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xef, 0x00, 0x09, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0xfe, 0x00, 0x03,
+  0x14, 0xe0, 0xfc, 0x3e, 0xfe, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xfe, 0x00, 0x02, 0x54, 0xff,
+  0xa4, 0x81, 0x00, 0xfd, 0x00,
 
   /*Unicode: U+0061 (a) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x88, 0x00, 0x08, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00, 0xf8, 0xff,
+  0x0d, 0x9c, 0x02, 0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e, 0xf9,
+  0x00, 0x03, 0x44, 0xff, 0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00, 0x00, 0x4a,
+  0xa6, 0xda, 0xf2, 0xfc, 0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff, 0xff, 0xe6,
+  0x5e, 0x1a, 0x02, 0x00, 0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x20,
+  0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03, 0xea, 0xff,
+  0xff, 0x2e, 0xfd, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28,
+  0xae, 0xea, 0xfe, 0xff, 0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff, 0x08, 0x00,
+  0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+0062 (b) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x64, 0xd0, 0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00,  //@@@.+@@@%...
-  0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x40, 0x00,  //@@@%@@@@@@+.
-  0xff, 0xff, 0xff, 0xfc, 0x80, 0x12, 0x10, 0x7e, 0xff, 0xff, 0xe6, 0x0e,  //@@@@%..+@@@.
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x6e,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xba,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xb6,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0x68,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0xfc, 0x7e, 0x10, 0x10, 0x7c, 0xff, 0xff, 0xe2, 0x0c,  //@@@@+..+@@@.
-  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3c, 0x00,  //@@@%@@@@@@..
-  0xff, 0xff, 0xff, 0x00, 0x66, 0xd2, 0xf6, 0xe8, 0xa6, 0x26, 0x00, 0x00,  //@@@.+@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd1, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x64, 0xd0,
+  0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x86, 0xfc, 0xff, 0x02, 0xf6, 0x40, 0x00,
+  0xfe, 0xff, 0x08, 0xfc, 0x80, 0x12, 0x10, 0x7e, 0xff, 0xff, 0xe6, 0x0e, 0xfe, 0xff, 0x00, 0xa8,
+  0xfd, 0x00, 0x03, 0xa8, 0xff, 0xff, 0x6e, 0xfe, 0xff, 0x00, 0x46, 0xfd, 0x00, 0x03, 0x48, 0xff,
+  0xff, 0xba, 0xfe, 0xff, 0x00, 0x16, 0xfd, 0x00, 0x03, 0x18, 0xff, 0xff, 0xe4, 0xfe, 0xff, 0x00,
+  0x04, 0xfd, 0x00, 0x03, 0x04, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0x00, 0x04, 0xfd, 0x00, 0x03, 0x04,
+  0xff, 0xff, 0xf6, 0xfe, 0xff, 0x00, 0x16, 0xfd, 0x00, 0x03, 0x18, 0xff, 0xff, 0xe2, 0xfe, 0xff,
+  0x00, 0x48, 0xfd, 0x00, 0x03, 0x46, 0xff, 0xff, 0xb6, 0xfe, 0xff, 0x00, 0xa8, 0xfd, 0x00, 0x03,
+  0xa6, 0xff, 0xff, 0x68, 0xfe, 0xff, 0x08, 0xfc, 0x7e, 0x10, 0x10, 0x7c, 0xff, 0xff, 0xe2, 0x0c,
+  0xfe, 0xff, 0x00, 0x84, 0xfc, 0xff, 0x02, 0xf4, 0x3c, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x66, 0xd2,
+  0xf6, 0xe8, 0xa6, 0x26, 0xb7, 0x00,
 
   /*Unicode: U+0063 (c) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x3e, 0xa2, 0xdc, 0xf4, 0xee, 0xb2, 0x36, 0x00,  //....%@@@%..
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x70,  //..%@@@@@@@+
-  0x00, 0xa4, 0xff, 0xff, 0xdc, 0x56, 0x12, 0x06, 0x30, 0xa6, 0xff,  //.%@@@+...%@
-  0x40, 0xff, 0xff, 0xe4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a,  //+@@@......+
-  0xa2, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0xde, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xf6, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xf6, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xde, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xa2, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0x40, 0xff, 0xff, 0xe4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,  //+@@@......+
-  0x00, 0xa6, 0xff, 0xff, 0xda, 0x54, 0x10, 0x06, 0x2e, 0xa0, 0xff,  //.%@@@+...%@
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x74,  //..%@@@@@@@+
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf0, 0xb4, 0x38, 0x00,  //...+%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x90, 0x00, 0x0a, 0x3e, 0xa2, 0xdc, 0xf4, 0xee, 0xb2, 0x36, 0x00, 0x00, 0x08, 0xa4, 0xfb, 0xff,
+  0x11, 0xfc, 0x70, 0x00, 0xa4, 0xff, 0xff, 0xdc, 0x56, 0x12, 0x06, 0x30, 0xa6, 0xff, 0x40, 0xff,
+  0xff, 0xe4, 0x14, 0xfc, 0x00, 0x04, 0x7a, 0xa2, 0xff, 0xff, 0x6c, 0xfa, 0x00, 0x03, 0xde, 0xff,
+  0xff, 0x24, 0xfa, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x06, 0xfa, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x06,
+  0xfa, 0x00, 0x03, 0xde, 0xff, 0xff, 0x24, 0xfa, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x6c, 0xfa, 0x00,
+  0x04, 0x40, 0xff, 0xff, 0xe4, 0x14, 0xfc, 0x00, 0x0e, 0x74, 0x00, 0xa6, 0xff, 0xff, 0xda, 0x54,
+  0x10, 0x06, 0x2e, 0xa0, 0xff, 0x00, 0x08, 0xa4, 0xfb, 0xff, 0x01, 0xfc, 0x74, 0xfe, 0x00, 0x06,
+  0x40, 0xa2, 0xdc, 0xf4, 0xf0, 0xb4, 0x38, 0xbe, 0x00,
 
   /*Unicode: U+0064 (d) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x28, 0xa6, 0xe8, 0xf6, 0xd0, 0x64, 0x00, 0xff, 0xff, 0xff,  //...%@@@+.@@@
-  0x00, 0x40, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff,  //.+@@@@@@%@@@
-  0x0e, 0xe6, 0xff, 0xff, 0x7c, 0x10, 0x12, 0x82, 0xfc, 0xff, 0xff, 0xff,  //.@@@+..%@@@@
-  0x6e, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0xba, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xb6, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0x6c, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0x0c, 0xe6, 0xff, 0xff, 0x7a, 0x10, 0x10, 0x82, 0xfc, 0xff, 0xff, 0xff,  //.@@@+..%@@@@
-  0x00, 0x3e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,  //..@@@@@@%@@@
-  0x00, 0x00, 0x28, 0xa6, 0xe8, 0xf6, 0xd2, 0x66, 0x00, 0xff, 0xff, 0xff,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x28, 0xa6, 0xe8, 0xf6, 0xd0,
+  0x64, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x40, 0xf6, 0xfc, 0xff, 0x00, 0x86, 0xfe, 0xff, 0x08, 0x0e,
+  0xe6, 0xff, 0xff, 0x7c, 0x10, 0x12, 0x82, 0xfc, 0xfe, 0xff, 0x03, 0x6e, 0xff, 0xff, 0xa4, 0xfd,
+  0x00, 0x00, 0xac, 0xfe, 0xff, 0x03, 0xba, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x4a, 0xfe, 0xff,
+  0x03, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x00, 0x18, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x04,
+  0xfd, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x00, 0x04, 0xfe,
+  0xff, 0x03, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x00, 0x18, 0xfe, 0xff, 0x03, 0xb6, 0xff, 0xff,
+  0x44, 0xfd, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0x03, 0x6c, 0xff, 0xff, 0xa2, 0xfd, 0x00, 0x00, 0xac,
+  0xfe, 0xff, 0x08, 0x0c, 0xe6, 0xff, 0xff, 0x7a, 0x10, 0x10, 0x82, 0xfc, 0xfe, 0xff, 0x02, 0x00,
+  0x3e, 0xf6, 0xfc, 0xff, 0x00, 0x84, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x28, 0xa6, 0xe8, 0xf6, 0xd2,
+  0x66, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+0065 (e) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x02, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x24, 0x00,  //..%@@@@@@@@..
-  0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06,  //.%@@@...%@@@.
-  0x36, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x62,  //.@@@.....%@@+
-  0x9e, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xb6,  //%@@+......@@%
-  0xdc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xde, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xa2, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x40, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00,  //.%@@%+...+%@.
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0xfc, 0x00, 0x07, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0xfe, 0x00, 0x01,
+  0x02, 0x94, 0xfa, 0xff, 0x14, 0xde, 0x24, 0x00, 0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18,
+  0x84, 0xff, 0xff, 0xd2, 0x06, 0x36, 0xff, 0xff, 0xdc, 0x08, 0xfd, 0x00, 0x07, 0xa4, 0xff, 0xff,
+  0x62, 0x9e, 0xff, 0xff, 0x5c, 0xfc, 0x00, 0x07, 0x3a, 0xff, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0x1c,
+  0xfc, 0x00, 0x08, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfe, 0xff,
+  0x01, 0xf8, 0xf6, 0xf5, 0xff, 0x02, 0xde, 0xff, 0xea, 0xf7, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x1e,
+  0xf8, 0x00, 0x03, 0x40, 0xff, 0xff, 0xa6, 0xf7, 0x00, 0x0e, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c,
+  0x02, 0x14, 0x40, 0x80, 0xd2, 0x00, 0x00, 0x08, 0xa4, 0xf8, 0xff, 0xfd, 0x00, 0x08, 0x40, 0xa2,
+  0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0xb2, 0x00,
 
   /*Unicode: U+0066 (f) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x8e, 0xd6, 0xf4, 0xff, 0xff, 0xff,  //......%@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xaa, 0x1c, 0x00, 0x00, 0x00,  //....%@@%....
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xcc, 0x00, 0x03, 0x16, 0x8e, 0xd6, 0xf4, 0xfe, 0xff, 0xfd, 0x00, 0x01, 0x18, 0xe4, 0xfb, 0xff,
+  0xfd, 0x00, 0x04, 0x94, 0xff, 0xff, 0xaa, 0x1c, 0xfa, 0x00, 0x03, 0xdc, 0xff, 0xff, 0x20, 0xf9,
+  0x00, 0x03, 0xf8, 0xff, 0xff, 0x02, 0xf9, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xe9, 0xff, 0xfd, 0x00,
+  0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00,
+  0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00,
+  0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xb4, 0x00,
 
   /*Unicode: U+0067 (g) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x26, 0xa8, 0xe8, 0xf4, 0xd0, 0x64, 0x00, 0xff, 0xff, 0xff,  //...%@@@+.@@@
-  0x00, 0x3a, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,  //..@@@@@@+@@@
-  0x0a, 0xe2, 0xff, 0xff, 0x88, 0x14, 0x0e, 0x7a, 0xf8, 0xff, 0xff, 0xff,  //.@@@%..+@@@@
-  0x68, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0xb6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xe4, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xb6, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0x68, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0x0a, 0xe2, 0xff, 0xff, 0x8a, 0x14, 0x0c, 0x7a, 0xf2, 0xff, 0xff, 0xff,  //.@@@%..+@@@@
-  0x00, 0x3a, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff,  //..@@@@@@+@@@
-  0x00, 0x00, 0x26, 0xa8, 0xea, 0xf6, 0xce, 0x5c, 0x02, 0xff, 0xff, 0xf4,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xda,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0x9c,  //........+@@%
-  0x00, 0x00, 0xc8, 0x66, 0x2a, 0x08, 0x1c, 0x6a, 0xf2, 0xff, 0xfa, 0x30,  //..@+...+@@@.
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6a, 0x00,  //..@@@@@@@@+.
-  0x00, 0x00, 0x2c, 0x88, 0xd2, 0xf4, 0xf8, 0xe0, 0xa2, 0x34, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x87, 0x00, 0x06, 0x26, 0xa8, 0xe8, 0xf4, 0xd0, 0x64, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x3a, 0xf4,
+  0xfc, 0xff, 0x00, 0x7c, 0xfe, 0xff, 0x08, 0x0a, 0xe2, 0xff, 0xff, 0x88, 0x14, 0x0e, 0x7a, 0xf8,
+  0xfe, 0xff, 0x03, 0x68, 0xff, 0xff, 0xae, 0xfd, 0x00, 0x00, 0xa6, 0xfe, 0xff, 0x03, 0xb6, 0xff,
+  0xff, 0x4a, 0xfd, 0x00, 0x00, 0x46, 0xfe, 0xff, 0x03, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x00,
+  0x16, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x03, 0xf8,
+  0xff, 0xff, 0x04, 0xfd, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x03, 0xe4, 0xff, 0xff, 0x18, 0xfd, 0x00,
+  0x00, 0x18, 0xfe, 0xff, 0x03, 0xb6, 0xff, 0xff, 0x4c, 0xfd, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x03,
+  0x68, 0xff, 0xff, 0xb2, 0xfd, 0x00, 0x00, 0xa8, 0xfe, 0xff, 0x08, 0x0a, 0xe2, 0xff, 0xff, 0x8a,
+  0x14, 0x0c, 0x7a, 0xf2, 0xfe, 0xff, 0x02, 0x00, 0x3a, 0xf4, 0xfc, 0xff, 0x00, 0x6c, 0xfe, 0xff,
+  0x0b, 0x00, 0x00, 0x26, 0xa8, 0xea, 0xf6, 0xce, 0x5c, 0x02, 0xff, 0xff, 0xf4, 0xf9, 0x00, 0x03,
+  0x1a, 0xff, 0xff, 0xda, 0xf9, 0x00, 0x11, 0x6a, 0xff, 0xff, 0x9c, 0x00, 0x00, 0xc8, 0x66, 0x2a,
+  0x08, 0x1c, 0x6a, 0xf2, 0xff, 0xfa, 0x30, 0x00, 0x00, 0xfa, 0xff, 0x01, 0xfc, 0x6a, 0xfe, 0x00,
+  0x07, 0x2c, 0x88, 0xd2, 0xf4, 0xf8, 0xe0, 0xa2, 0x34, 0xf3, 0x00,
 
   /*Unicode: U+0068 (h) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xff, 0xff, 0x00, 0x46, 0xbe, 0xf0, 0xf0, 0xb4, 0x28, 0x00,  //@@@.+%@@%..
-  0xff, 0xff, 0xff, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xea, 0x16,  //@@@+@@@@@@.
-  0xff, 0xff, 0xff, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff, 0xff, 0x86,  //@@@@+..@@@%
-  0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xcc,  //@@@%...+@@@
-  0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xee,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfc,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd5, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x46, 0xbe,
+  0xf0, 0xf0, 0xb4, 0x28, 0x00, 0xfe, 0xff, 0x01, 0x5c, 0xfc, 0xfd, 0xff, 0x01, 0xea, 0x16, 0xfe,
+  0xff, 0x07, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff, 0xff, 0x86, 0xfe, 0xff, 0x00, 0x8c, 0xfe, 0x00,
+  0x03, 0x4e, 0xff, 0xff, 0xcc, 0xfe, 0xff, 0x00, 0x32, 0xfe, 0x00, 0x03, 0x16, 0xff, 0xff, 0xee,
+  0xfe, 0xff, 0x00, 0x12, 0xfe, 0x00, 0x03, 0x02, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+0069 (i) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xc8, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xd4, 0x00, 0xfa, 0xff,
+  0xfb, 0x00, 0xfa, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xe7, 0xff,
+  0xb3, 0x00,
 
   /*Unicode: U+006a (j) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xf4,  //.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xd2,  //.....@@@
-  0x00, 0x00, 0x00, 0x28, 0xca, 0xff, 0xff, 0x7c,  //....@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x08,  //@@@@@@@.
-  0xff, 0xff, 0xff, 0xf6, 0xd2, 0x7c, 0x08, 0x00,  //@@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xdc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xe8, 0x00, 0xfa, 0xff,
+  0x00, 0x00, 0xfa, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0x0c, 0xff, 0xff, 0xf4, 0xfd, 0x00, 0x03, 0x3c, 0xff,
+  0xff, 0xd2, 0xfe, 0x00, 0x04, 0x28, 0xca, 0xff, 0xff, 0x7c, 0xfb, 0xff, 0x01, 0xc8, 0x08, 0xfe,
+  0xff, 0x03, 0xf6, 0xd2, 0x7c, 0x08, 0xf8, 0x00,
 
   /*Unicode: U+006b (k) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xcc, 0xff, 0xff, 0xfa, 0x4e,  //@@@.....@@@@+
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0xc8, 0xff, 0xff, 0xfa, 0x56, 0x00,  //@@@....@@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0xc2, 0xff, 0xff, 0xfc, 0x5e, 0x00, 0x00,  //@@@...@@@@+..
-  0xff, 0xff, 0xff, 0x00, 0x06, 0xba, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00,  //@@@..%@@@+...
-  0xff, 0xff, 0xff, 0x04, 0xb4, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00,  //@@@.%@@@+....
-  0xff, 0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@%@@@+.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@%.....
-  0xff, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff, 0xfc, 0x40, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@+....
-  0xff, 0xff, 0xff, 0x98, 0x00, 0xae, 0xff, 0xff, 0xde, 0x0c, 0x00, 0x00, 0x00,  //@@@%.%@@@....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x16, 0xea, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00,  //@@@...@@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x4a, 0x00, 0x00,  //@@@...+@@@+..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xe6, 0x10, 0x00,  //@@@....%@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x10, 0xe4, 0xff, 0xff, 0xa6, 0x00,  //@@@.....@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xcd, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x05, 0x0e,
+  0xcc, 0xff, 0xff, 0xfa, 0x4e, 0xfe, 0xff, 0xfe, 0x00, 0x06, 0x0c, 0xc8, 0xff, 0xff, 0xfa, 0x56,
+  0x00, 0xfe, 0xff, 0x09, 0x00, 0x00, 0x08, 0xc2, 0xff, 0xff, 0xfc, 0x5e, 0x00, 0x00, 0xfe, 0xff,
+  0x02, 0x00, 0x06, 0xba, 0xfe, 0xff, 0x00, 0x66, 0xfe, 0x00, 0xfe, 0xff, 0x01, 0x04, 0xb4, 0xfe,
+  0xff, 0x00, 0x6e, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0xac, 0xfe, 0xff, 0x00, 0x76, 0xfc, 0x00, 0xfb,
+  0xff, 0x01, 0xe8, 0x08, 0xfc, 0x00, 0xfa, 0xff, 0x00, 0x90, 0xfc, 0x00, 0xfd, 0xff, 0x04, 0xc2,
+  0xff, 0xff, 0xfc, 0x40, 0xfd, 0x00, 0xfe, 0xff, 0x06, 0x98, 0x00, 0xae, 0xff, 0xff, 0xde, 0x0c,
+  0xfe, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x00, 0x16, 0xea, 0xff, 0xff, 0x9c, 0xfe, 0x00, 0xfe, 0xff,
+  0xfe, 0x00, 0x00, 0x52, 0xfe, 0xff, 0x02, 0x4a, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x05, 0xa4,
+  0xff, 0xff, 0xe6, 0x10, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04, 0x10, 0xe4, 0xff, 0xff, 0xa6, 0xb2,
+  0x00,
 
   /*Unicode: U+006c (l) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00,  //.....@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0xd2, 0x2e, 0x00, 0x00, 0x00,  //.....+@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //......@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x76, 0xce, 0xf4, 0xff, 0xff, 0xff,  //.......+@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xcd, 0x00, 0xf9, 0xff, 0xfc, 0x00, 0xf9, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0x03, 0xf4,
+  0xff, 0xff, 0x10, 0xf8, 0x00, 0x03, 0xca, 0xff, 0xff, 0x44, 0xf8, 0x00, 0x04, 0x72, 0xff, 0xff,
+  0xd2, 0x2e, 0xf9, 0x00, 0x01, 0x04, 0xc0, 0xfb, 0xff, 0xfb, 0x00, 0x03, 0x06, 0x76, 0xce, 0xf4,
+  0xfe, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+006d (m) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0x3c, 0xd8, 0xf0, 0x8c, 0x00, 0x7a, 0xea, 0xf0, 0x92, 0x00,  //@@@.@@%.+@@%.
-  0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0x62,  //@@@@@@@%@@@@+
-  0xff, 0xff, 0xff, 0x64, 0x60, 0xff, 0xff, 0xff, 0x68, 0x5a, 0xff, 0xff, 0xb2,  //@@@++@@@++@@%
-  0xff, 0xff, 0xff, 0x18, 0x16, 0xff, 0xff, 0xff, 0x18, 0x16, 0xff, 0xff, 0xda,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x06, 0x06, 0xff, 0xff, 0xff, 0x06, 0x06, 0xff, 0xff, 0xf0,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x09, 0x3c, 0xd8, 0xf0, 0x8c, 0x00, 0x7a, 0xea, 0xf0,
+  0x92, 0x00, 0xfe, 0xff, 0x00, 0xe8, 0xfe, 0xff, 0x00, 0xa8, 0xfd, 0xff, 0x00, 0x62, 0xfe, 0xff,
+  0x01, 0x64, 0x60, 0xfe, 0xff, 0x04, 0x68, 0x5a, 0xff, 0xff, 0xb2, 0xfe, 0xff, 0x01, 0x18, 0x16,
+  0xfe, 0xff, 0x04, 0x18, 0x16, 0xff, 0xff, 0xda, 0xfe, 0xff, 0x01, 0x06, 0x06, 0xfe, 0xff, 0x04,
+  0x06, 0x06, 0xff, 0xff, 0xf0, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x04, 0x00, 0x00, 0xff,
+  0xff, 0xfa, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00,
+  0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfb, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfe,
+  0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff,
+  0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x01,
+  0x00, 0x00, 0xfe, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+006e (n) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x46, 0xbe, 0xf0, 0xf0, 0xb4, 0x28, 0x00,  //@@@.+%@@%..
-  0xff, 0xff, 0xff, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xea, 0x16,  //@@@+@@@@@@.
-  0xff, 0xff, 0xff, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff, 0xff, 0x86,  //@@@@+..@@@%
-  0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xcc,  //@@@%...+@@@
-  0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xee,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfc,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x93, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x46, 0xbe, 0xf0, 0xf0, 0xb4, 0x28, 0x00, 0xfe, 0xff, 0x01,
+  0x5c, 0xfc, 0xfd, 0xff, 0x01, 0xea, 0x16, 0xfe, 0xff, 0x07, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff,
+  0xff, 0x86, 0xfe, 0xff, 0x00, 0x8c, 0xfe, 0x00, 0x03, 0x4e, 0xff, 0xff, 0xcc, 0xfe, 0xff, 0x00,
+  0x32, 0xfe, 0x00, 0x03, 0x16, 0xff, 0xff, 0xee, 0xfe, 0xff, 0x00, 0x12, 0xfe, 0x00, 0x03, 0x02,
+  0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xfc, 0x00, 0xfe, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+006f (o) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x87, 0x00, 0x07, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01, 0x34, 0xea,
+  0xfb, 0xff, 0x12, 0xea, 0x30, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff,
+  0xde, 0x0a, 0x6a, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8, 0xff, 0xff,
+  0x44, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18,
+  0xff, 0xff, 0xe4, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xf8, 0xff,
+  0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07,
+  0x18, 0xff, 0xff, 0xe4, 0xb8, 0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0x6c,
+  0xff, 0xff, 0xa4, 0xfd, 0x00, 0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10,
+  0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34, 0xfe, 0x00,
+  0x07, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+0070 (p) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x62, 0xd0, 0xf6, 0xe8, 0xa6, 0x28, 0x00, 0x00,  //@@@.+@@@%...
-  0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3e, 0x00,  //@@@%@@@@@@..
-  0xff, 0xff, 0xff, 0xfc, 0x80, 0x12, 0x10, 0x7a, 0xff, 0xff, 0xe4, 0x0c,  //@@@@%..+@@@.
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x6a,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xb6,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xba,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0x6e,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0xfc, 0x7e, 0x10, 0x0e, 0x78, 0xff, 0xff, 0xe8, 0x0e,  //@@@@+..+@@@.
-  0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x44, 0x00,  //@@@%@@@@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x68, 0xd2, 0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00,  //@@@.+@@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x89, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x62, 0xd0, 0xf6, 0xe8, 0xa6, 0x28, 0x00, 0x00, 0xfe, 0xff,
+  0x00, 0x82, 0xfc, 0xff, 0x02, 0xf6, 0x3e, 0x00, 0xfe, 0xff, 0x08, 0xfc, 0x80, 0x12, 0x10, 0x7a,
+  0xff, 0xff, 0xe4, 0x0c, 0xfe, 0xff, 0x00, 0xa8, 0xfd, 0x00, 0x03, 0xa4, 0xff, 0xff, 0x6a, 0xfe,
+  0xff, 0x00, 0x46, 0xfd, 0x00, 0x03, 0x46, 0xff, 0xff, 0xb6, 0xfe, 0xff, 0x00, 0x16, 0xfd, 0x00,
+  0x03, 0x16, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0x00, 0x04, 0xfd, 0x00, 0x03, 0x04, 0xff, 0xff, 0xf6,
+  0xfe, 0xff, 0x00, 0x04, 0xfd, 0x00, 0x03, 0x04, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0x00, 0x16, 0xfd,
+  0x00, 0x03, 0x16, 0xff, 0xff, 0xe4, 0xfe, 0xff, 0x00, 0x48, 0xfd, 0x00, 0x03, 0x46, 0xff, 0xff,
+  0xba, 0xfe, 0xff, 0x00, 0xa8, 0xfd, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x6e, 0xfe, 0xff, 0x08, 0xfc,
+  0x7e, 0x10, 0x0e, 0x78, 0xff, 0xff, 0xe8, 0x0e, 0xfe, 0xff, 0x00, 0x86, 0xfc, 0xff, 0x02, 0xf6,
+  0x44, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x68, 0xd2, 0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xec, 0x00,
 
   /*Unicode: U+0071 (q) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x28, 0xa6, 0xe8, 0xf6, 0xd0, 0x62, 0x00, 0xff, 0xff, 0xff,  //...%@@@+.@@@
-  0x00, 0x3e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,  //..@@@@@@%@@@
-  0x0c, 0xe6, 0xff, 0xff, 0x7a, 0x10, 0x12, 0x80, 0xfc, 0xff, 0xff, 0xff,  //.@@@+..%@@@@
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0xb6, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xba, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff,  //%@@+....+@@@
-  0x70, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff,  //+@@%....%@@@
-  0x0e, 0xe8, 0xff, 0xff, 0x78, 0x0e, 0x10, 0x7e, 0xfa, 0xff, 0xff, 0xff,  //.@@@+..+@@@@
-  0x00, 0x44, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,  //.+@@@@@@%@@@
-  0x00, 0x00, 0x2a, 0xa8, 0xe8, 0xf6, 0xd0, 0x62, 0x00, 0xff, 0xff, 0xff,  //...%@@@+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //.........@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x87, 0x00, 0x06, 0x28, 0xa6, 0xe8, 0xf6, 0xd0, 0x62, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x3e, 0xf6,
+  0xfc, 0xff, 0x00, 0x82, 0xfe, 0xff, 0x08, 0x0c, 0xe6, 0xff, 0xff, 0x7a, 0x10, 0x12, 0x80, 0xfc,
+  0xfe, 0xff, 0x03, 0x6c, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x00, 0xa8, 0xfe, 0xff, 0x03, 0xb6, 0xff,
+  0xff, 0x44, 0xfd, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x03, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x00,
+  0x18, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x03, 0xf8,
+  0xff, 0xff, 0x04, 0xfd, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x03, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00,
+  0x00, 0x18, 0xfe, 0xff, 0x03, 0xba, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x48, 0xfe, 0xff, 0x03,
+  0x70, 0xff, 0xff, 0xa2, 0xfd, 0x00, 0x00, 0xa8, 0xfe, 0xff, 0x08, 0x0e, 0xe8, 0xff, 0xff, 0x78,
+  0x0e, 0x10, 0x7e, 0xfa, 0xfe, 0xff, 0x02, 0x00, 0x44, 0xf6, 0xfc, 0xff, 0x00, 0x80, 0xfe, 0xff,
+  0x08, 0x00, 0x00, 0x2a, 0xa8, 0xe8, 0xf6, 0xd0, 0x62, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf5, 0x00,
 
   /*Unicode: U+0072 (r) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0x00, 0x2a, 0xa6, 0xe6, 0xf6, 0xc8, 0x52,  //@@@..%@@@+
-  0xff, 0xff, 0xff, 0x34, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@.@@@@@@
-  0xff, 0xff, 0xff, 0xca, 0xd2, 0x4a, 0x0c, 0x06, 0x3a, 0xae,  //@@@@@+...%
-  0xff, 0xff, 0xff, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@......
-  0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@+......
-  0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0x9d, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x2a, 0xa6, 0xe6, 0xf6, 0xc8, 0x52, 0xfe, 0xff, 0x01, 0x34,
+  0xf0, 0xf9, 0xff, 0x06, 0xca, 0xd2, 0x4a, 0x0c, 0x06, 0x3a, 0xae, 0xfe, 0xff, 0x01, 0xe0, 0x0e,
+  0xfc, 0x00, 0xfe, 0xff, 0x00, 0x68, 0xfb, 0x00, 0xfe, 0xff, 0x00, 0x24, 0xfb, 0x00, 0xfe, 0xff,
+  0x00, 0x06, 0xfb, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfa, 0x00,
+  0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xbe, 0x00,
 
   /*Unicode: U+0073 (s) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x1c, 0x94, 0xda, 0xf6, 0xf6, 0xd8, 0x9a, 0x38, 0x00,  //..%@@@@%..
-  0x2a, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@.
-  0xb4, 0xff, 0xff, 0xac, 0x26, 0x04, 0x14, 0x50, 0xbc, 0x00,  //%@@%...+%.
-  0xf2, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xea, 0xff, 0xff, 0xaa, 0x46, 0x08, 0x00, 0x00, 0x00, 0x00,  //@@@%+.....
-  0xa6, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb8, 0x64, 0x0a, 0x00,  //%@@@@@%+..
-  0x16, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x16,  //.@@@@@@@@.
-  0x00, 0x00, 0x4c, 0x96, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xa0,  //..+%@@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc0, 0xff, 0xff, 0xec,  //......@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //.......@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xec,  //.......@@@
-  0xcc, 0x72, 0x30, 0x0a, 0x08, 0x38, 0xc8, 0xff, 0xff, 0xa2,  //@+....@@@%
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x18,  //@@@@@@@@@.
-  0x2c, 0x7e, 0xc0, 0xea, 0xfa, 0xf0, 0xc8, 0x78, 0x0a, 0x00,  //.+@@@@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0x9c, 0x00, 0x0a, 0x1c, 0x94, 0xda, 0xf6, 0xf6, 0xd8, 0x9a, 0x38, 0x00, 0x2a, 0xec, 0xfa, 0xff,
+  0x0e, 0x00, 0xb4, 0xff, 0xff, 0xac, 0x26, 0x04, 0x14, 0x50, 0xbc, 0x00, 0xf2, 0xff, 0xff, 0x14,
+  0xfb, 0x00, 0x05, 0xea, 0xff, 0xff, 0xaa, 0x46, 0x08, 0xfd, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0x06,
+  0xf6, 0xb8, 0x64, 0x0a, 0x00, 0x16, 0xce, 0xfb, 0xff, 0x06, 0xce, 0x16, 0x00, 0x00, 0x4c, 0x96,
+  0xd4, 0xfd, 0xff, 0x00, 0xa0, 0xfc, 0x00, 0x04, 0x28, 0xc0, 0xff, 0xff, 0xec, 0xfb, 0x00, 0x00,
+  0x18, 0xfe, 0xff, 0xfb, 0x00, 0x0d, 0x22, 0xff, 0xff, 0xec, 0xcc, 0x72, 0x30, 0x0a, 0x08, 0x38,
+  0xc8, 0xff, 0xff, 0xa2, 0xf9, 0xff, 0x0a, 0xd8, 0x18, 0x2c, 0x7e, 0xc0, 0xea, 0xfa, 0xf0, 0xc8,
+  0x78, 0x0a, 0xc4, 0x00,
 
   /*Unicode: U+0074 (t) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00,  //....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0xb6, 0x24, 0x02, 0x00, 0x00,  //....%@@%....
-  0x00, 0x00, 0x00, 0x00, 0x32, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x9e, 0xda, 0xf6, 0xff, 0xff, 0xff,  //......%@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xb5, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0xe9, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0x03, 0xfa, 0xff, 0xff, 0x04, 0xf9, 0x00, 0x03, 0xe6, 0xff, 0xff, 0x26, 0xf9, 0x00,
+  0x05, 0xac, 0xff, 0xff, 0xb6, 0x24, 0x02, 0xfb, 0x00, 0x01, 0x32, 0xf6, 0xfb, 0xff, 0xfc, 0x00,
+  0x03, 0x2c, 0x9e, 0xda, 0xf6, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+0075 (u) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xf0, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xce, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,  //@@@+...%@@@
-  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xff, 0xff, 0xff,  //%@@@..+@@@@
-  0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x58, 0xff, 0xff, 0xff,  //.@@@@@@+@@@
-  0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xff, 0xff, 0xff,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x93, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff,
+  0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff,
+  0xfc, 0x00, 0xfe, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x12, 0xfe, 0xff, 0x03,
+  0xf0, 0xff, 0xff, 0x16, 0xfe, 0x00, 0x00, 0x34, 0xfe, 0xff, 0x03, 0xce, 0xff, 0xff, 0x4c, 0xfe,
+  0x00, 0x00, 0x90, 0xfe, 0xff, 0x07, 0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xfe, 0xff,
+  0x01, 0x1a, 0xee, 0xfd, 0xff, 0x01, 0xfc, 0x58, 0xfe, 0xff, 0x07, 0x00, 0x2c, 0xb6, 0xf2, 0xf0,
+  0xbe, 0x44, 0x00, 0xfe, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+0076 (v) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xd0, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xd0,  //@@@+.....+@@@
-  0x76, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xff, 0x74,  //+@@%.....%@@+
-  0x1c, 0xfc, 0xff, 0xfa, 0x16, 0x00, 0x00, 0x00, 0x18, 0xfa, 0xff, 0xfc, 0x1a,  //.@@@.....@@@.
-  0x00, 0xbe, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xbc, 0x00,  //.%@@+...+@@%.
-  0x00, 0x62, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0x62, 0x00,  //.+@@@...@@@+.
-  0x00, 0x0e, 0xf6, 0xff, 0xff, 0x26, 0x00, 0x28, 0xff, 0xff, 0xf6, 0x0e, 0x00,  //..@@@...@@@..
-  0x00, 0x00, 0xaa, 0xff, 0xff, 0x82, 0x00, 0x82, 0xff, 0xff, 0xaa, 0x00, 0x00,  //..%@@%.%@@%..
-  0x00, 0x00, 0x4e, 0xff, 0xff, 0xdc, 0x00, 0xdc, 0xff, 0xff, 0x4e, 0x00, 0x00,  //..+@@@.@@@+..
-  0x00, 0x00, 0x04, 0xec, 0xff, 0xff, 0x76, 0xff, 0xff, 0xec, 0x04, 0x00, 0x00,  //...@@@+@@@...
-  0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00,  //....%@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0x05, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x5c, 0xfc, 0x00, 0x07, 0x5c, 0xff, 0xff, 0xd0,
+  0x76, 0xff, 0xff, 0xb8, 0xfc, 0x00, 0x08, 0xb8, 0xff, 0xff, 0x74, 0x1c, 0xfc, 0xff, 0xfa, 0x16,
+  0xfe, 0x00, 0x09, 0x18, 0xfa, 0xff, 0xfc, 0x1a, 0x00, 0xbe, 0xff, 0xff, 0x6e, 0xfe, 0x00, 0x09,
+  0x70, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x62, 0xff, 0xff, 0xca, 0xfe, 0x00, 0x10, 0xcc, 0xff, 0xff,
+  0x62, 0x00, 0x00, 0x0e, 0xf6, 0xff, 0xff, 0x26, 0x00, 0x28, 0xff, 0xff, 0xf6, 0x0e, 0xfe, 0x00,
+  0x08, 0xaa, 0xff, 0xff, 0x82, 0x00, 0x82, 0xff, 0xff, 0xaa, 0xfd, 0x00, 0x08, 0x4e, 0xff, 0xff,
+  0xdc, 0x00, 0xdc, 0xff, 0xff, 0x4e, 0xfd, 0x00, 0x08, 0x04, 0xec, 0xff, 0xff, 0x76, 0xff, 0xff,
+  0xec, 0x04, 0xfc, 0x00, 0x06, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x96, 0xfb, 0x00, 0x00, 0x3c,
+  0xfc, 0xff, 0x00, 0x3a, 0xfa, 0x00, 0x00, 0xde, 0xfe, 0xff, 0x00, 0xde, 0xf9, 0x00, 0x00, 0x84,
+  0xfe, 0xff, 0x00, 0x84, 0xf9, 0x00, 0x00, 0x28, 0xfe, 0xff, 0x00, 0x28, 0xaf, 0x00,
 
   /*Unicode: U+0077 (w) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0xe0, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xde,  //@@@..........@@@
-  0xa2, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xa0,  //%@@+........+@@%
-  0x64, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x62,  //+@@%........%@@+
-  0x24, 0xff, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0xff, 0x24,  //.@@@........@@@.
-  0x00, 0xe6, 0xff, 0xff, 0x2c, 0x00, 0x2a, 0xff, 0xff, 0x24, 0x00, 0x2c, 0xff, 0xff, 0xe4, 0x00,  //.@@@...@@...@@@.
-  0x00, 0xa8, 0xff, 0xff, 0x6c, 0x00, 0x74, 0xff, 0xff, 0x6e, 0x00, 0x6c, 0xff, 0xff, 0xa8, 0x00,  //.%@@+.+@@+.+@@%.
-  0x00, 0x6a, 0xff, 0xff, 0xaa, 0x00, 0xbc, 0xe4, 0xea, 0xb8, 0x00, 0xaa, 0xff, 0xff, 0x6a, 0x00,  //.+@@%.%@@%.%@@+.
-  0x00, 0x2c, 0xff, 0xff, 0xe8, 0x0c, 0xf8, 0x98, 0xa0, 0xf6, 0x0a, 0xe8, 0xff, 0xff, 0x2a, 0x00,  //..@@@.@%%@.@@@..
-  0x00, 0x00, 0xec, 0xff, 0xff, 0x78, 0xff, 0x4e, 0x52, 0xff, 0x74, 0xff, 0xff, 0xea, 0x00, 0x00,  //..@@@+@++@+@@@..
-  0x00, 0x00, 0xb0, 0xff, 0xff, 0xee, 0xf6, 0x0a, 0x0c, 0xf8, 0xec, 0xff, 0xff, 0xae, 0x00, 0x00,  //..%@@@@..@@@@%..
-  0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //..+@@@%..%@@@+..
-  0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00,  //...@@@+..+@@@...
-  0x00, 0x00, 0x02, 0xf0, 0xff, 0xff, 0x20, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xf0, 0x02, 0x00, 0x00,  //...@@@....@@@...
-  0x00, 0x00, 0x00, 0xb6, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xb6, 0x00, 0x00, 0x00,  //...%@@....@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0x81, 0x00, 0xe1, 0x00, 0x03, 0xe0, 0xff, 0xff, 0x32, 0xf9, 0x00, 0x07, 0x32, 0xff, 0xff, 0xde,
+  0xa2, 0xff, 0xff, 0x70, 0xf9, 0x00, 0x07, 0x70, 0xff, 0xff, 0xa0, 0x64, 0xff, 0xff, 0xae, 0xf9,
+  0x00, 0x07, 0xb0, 0xff, 0xff, 0x62, 0x24, 0xff, 0xff, 0xec, 0xf9, 0x00, 0x42, 0xec, 0xff, 0xff,
+  0x24, 0x00, 0xe6, 0xff, 0xff, 0x2c, 0x00, 0x2a, 0xff, 0xff, 0x24, 0x00, 0x2c, 0xff, 0xff, 0xe4,
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0x6c, 0x00, 0x74, 0xff, 0xff, 0x6e, 0x00, 0x6c, 0xff, 0xff, 0xa8,
+  0x00, 0x00, 0x6a, 0xff, 0xff, 0xaa, 0x00, 0xbc, 0xe4, 0xea, 0xb8, 0x00, 0xaa, 0xff, 0xff, 0x6a,
+  0x00, 0x00, 0x2c, 0xff, 0xff, 0xe8, 0x0c, 0xf8, 0x98, 0xa0, 0xf6, 0x0a, 0xe8, 0xff, 0xff, 0x2a,
+  0xfe, 0x00, 0x0b, 0xec, 0xff, 0xff, 0x78, 0xff, 0x4e, 0x52, 0xff, 0x74, 0xff, 0xff, 0xea, 0xfd,
+  0x00, 0x0b, 0xb0, 0xff, 0xff, 0xee, 0xf6, 0x0a, 0x0c, 0xf8, 0xec, 0xff, 0xff, 0xae, 0xfd, 0x00,
+  0x00, 0x70, 0xfe, 0xff, 0x03, 0xb6, 0x00, 0x00, 0xb8, 0xfe, 0xff, 0x00, 0x70, 0xfd, 0x00, 0x00,
+  0x32, 0xfe, 0xff, 0x03, 0x6a, 0x00, 0x00, 0x6c, 0xfe, 0xff, 0x00, 0x32, 0xfd, 0x00, 0x0b, 0x02,
+  0xf0, 0xff, 0xff, 0x20, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xf0, 0x02, 0xfc, 0x00, 0x02, 0xb6, 0xff,
+  0xd4, 0xfd, 0x00, 0x02, 0xd2, 0xff, 0xb6, 0x9e, 0x00,
 
   /*Unicode: U+0078 (x) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0xa2, 0xff, 0xff, 0xec, 0x1a, 0x00, 0x00, 0x1c, 0xee, 0xff, 0xff, 0xa2, 0x00,  //.%@@@....@@@%.
-  0x00, 0x0c, 0xde, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xdc, 0x0c, 0x00,  //..@@@%..@@@@..
-  0x00, 0x00, 0x38, 0xfa, 0xff, 0xff, 0x78, 0x7a, 0xff, 0xff, 0xfa, 0x38, 0x00, 0x00,  //...@@@++@@@...
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xf8, 0xfa, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00,  //...+@@@@@@+...
-  0x00, 0x00, 0x00, 0x02, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x02, 0x00, 0x00, 0x00,  //....@@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xee, 0xff, 0xff, 0xee, 0x1e, 0x00, 0x00, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xcc, 0xff, 0xff, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //.....@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00,  //....%@@@@%....
-  0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00,  //...+@@@@@@+...
-  0x00, 0x00, 0x3c, 0xf8, 0xff, 0xff, 0x9c, 0x9c, 0xff, 0xff, 0xf8, 0x3a, 0x00, 0x00,  //...@@@%%@@@...
-  0x00, 0x1a, 0xe6, 0xff, 0xff, 0xc8, 0x06, 0x06, 0xc8, 0xff, 0xff, 0xe6, 0x18, 0x00,  //..@@@@..@@@@..
-  0x04, 0xc6, 0xff, 0xff, 0xe8, 0x1a, 0x00, 0x00, 0x1a, 0xe8, 0xff, 0xff, 0xc6, 0x04,  //.@@@@....@@@@.
-  0x98, 0xff, 0xff, 0xfa, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfa, 0xff, 0xff, 0x98,  //%@@@......@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0x81, 0x00, 0xf4, 0x00, 0x19, 0xa2, 0xff, 0xff, 0xec, 0x1a, 0x00, 0x00, 0x1c, 0xee, 0xff, 0xff,
+  0xa2, 0x00, 0x00, 0x0c, 0xde, 0xff, 0xff, 0xbe, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xdc, 0x0c, 0xfe,
+  0x00, 0x09, 0x38, 0xfa, 0xff, 0xff, 0x78, 0x7a, 0xff, 0xff, 0xfa, 0x38, 0xfc, 0x00, 0x07, 0x7e,
+  0xff, 0xff, 0xf8, 0xfa, 0xff, 0xff, 0x7c, 0xfb, 0x00, 0x01, 0x02, 0xc4, 0xfd, 0xff, 0x01, 0xc2,
+  0x02, 0xfa, 0x00, 0x05, 0x1e, 0xee, 0xff, 0xff, 0xee, 0x1e, 0xf8, 0x00, 0x03, 0x68, 0xff, 0xff,
+  0x68, 0xf8, 0x00, 0x05, 0x06, 0xcc, 0xff, 0xff, 0xca, 0x06, 0xf9, 0x00, 0x00, 0xa0, 0xfd, 0xff,
+  0x00, 0x9e, 0xfa, 0x00, 0x00, 0x6c, 0xfb, 0xff, 0x00, 0x6a, 0xfc, 0x00, 0x09, 0x3c, 0xf8, 0xff,
+  0xff, 0x9c, 0x9c, 0xff, 0xff, 0xf8, 0x3a, 0xfe, 0x00, 0x1f, 0x1a, 0xe6, 0xff, 0xff, 0xc8, 0x06,
+  0x06, 0xc8, 0xff, 0xff, 0xe6, 0x18, 0x00, 0x04, 0xc6, 0xff, 0xff, 0xe8, 0x1a, 0x00, 0x00, 0x1a,
+  0xe8, 0xff, 0xff, 0xc6, 0x04, 0x98, 0xff, 0xff, 0xfa, 0x3c, 0xfd, 0x00, 0x04, 0x3c, 0xfa, 0xff,
+  0xff, 0x98, 0xad, 0x00,
 
   /*Unicode: U+0079 (y) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcc, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xcc,  //@@@+.....+@@@
-  0x66, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x66,  //+@@@.....@@@+
-  0x0c, 0xf2, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xf4, 0x0c,  //.@@@.....@@@.
-  0x00, 0x98, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x9c, 0x00,  //.%@@%...%@@%.
-  0x00, 0x32, 0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff, 0x38, 0x00,  //..@@@...@@@..
-  0x00, 0x00, 0xcc, 0xff, 0xff, 0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0x00, 0x00,  //..@@@+.+@@@..
-  0x00, 0x00, 0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff, 0xff, 0x6e, 0x00, 0x00,  //..+@@@.@@@+..
-  0x00, 0x00, 0x0c, 0xf2, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf6, 0x12, 0x00, 0x00,  //...@@@+@@@...
-  0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xec, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x00, 0x24, 0xd8, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@%......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xda, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x00, 0xff, 0xff, 0xea, 0xa0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0x05, 0x00, 0x00, 0xcc, 0xff, 0xff, 0x6e, 0xfc, 0x00, 0x07, 0x6c, 0xff, 0xff, 0xcc,
+  0x66, 0xff, 0xff, 0xd2, 0xfc, 0x00, 0x08, 0xd0, 0xff, 0xff, 0x66, 0x0c, 0xf2, 0xff, 0xff, 0x3a,
+  0xfe, 0x00, 0x09, 0x36, 0xff, 0xff, 0xf4, 0x0c, 0x00, 0x98, 0xff, 0xff, 0xa0, 0xfe, 0x00, 0x10,
+  0x9a, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x32, 0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff,
+  0x38, 0xfe, 0x00, 0x08, 0xcc, 0xff, 0xff, 0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0xfd, 0x00, 0x08,
+  0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff, 0xff, 0x6e, 0xfd, 0x00, 0x08, 0x0c, 0xf2, 0xff, 0xff,
+  0x66, 0xff, 0xff, 0xf6, 0x12, 0xfc, 0x00, 0x06, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0xfb,
+  0x00, 0x00, 0x32, 0xfc, 0xff, 0x00, 0x40, 0xfa, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x00, 0xdc, 0xf9,
+  0x00, 0x00, 0x66, 0xfe, 0xff, 0x00, 0x7c, 0xf9, 0x00, 0x04, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0xf9,
+  0x00, 0x03, 0x78, 0xff, 0xff, 0xba, 0xf8, 0x00, 0x03, 0xdc, 0xff, 0xff, 0x58, 0xf9, 0x00, 0x04,
+  0x4c, 0xff, 0xff, 0xec, 0x06, 0xfa, 0x00, 0x04, 0x24, 0xd8, 0xff, 0xff, 0x86, 0xfa, 0x00, 0xfd,
+  0xff, 0x01, 0xda, 0x0e, 0xfa, 0x00, 0x04, 0xff, 0xff, 0xea, 0xa0, 0x16, 0xed, 0x00,
 
   /*Unicode: U+007a (z) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xfc, 0xff, 0xff, 0xac,  //......+@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xe4, 0xff, 0xff, 0xde, 0x0e,  //......@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xf8, 0x36, 0x00,  //.....%@@@..
-  0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x72, 0x00, 0x00,  //....+@@@+..
-  0x00, 0x00, 0x00, 0x28, 0xf4, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00,  //....@@@%...
-  0x00, 0x00, 0x06, 0xce, 0xff, 0xff, 0xe2, 0x12, 0x00, 0x00, 0x00,  //...@@@@....
-  0x00, 0x00, 0x8e, 0xff, 0xff, 0xfa, 0x3c, 0x00, 0x00, 0x00, 0x00,  //..%@@@.....
-  0x00, 0x46, 0xfc, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@+.....
-  0x14, 0xe6, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%......
-  0xb2, 0xff, 0xff, 0xe6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x93, 0x00, 0xeb, 0xff, 0xfb, 0x00, 0x04, 0x44, 0xfc, 0xff, 0xff, 0xac, 0xfc, 0x00, 0x05, 0x12,
+  0xe4, 0xff, 0xff, 0xde, 0x0e, 0xfc, 0x00, 0x04, 0xb0, 0xff, 0xff, 0xf8, 0x36, 0xfc, 0x00, 0x00,
+  0x68, 0xfe, 0xff, 0x00, 0x72, 0xfc, 0x00, 0x04, 0x28, 0xf4, 0xff, 0xff, 0xb4, 0xfc, 0x00, 0x05,
+  0x06, 0xce, 0xff, 0xff, 0xe2, 0x12, 0xfc, 0x00, 0x04, 0x8e, 0xff, 0xff, 0xfa, 0x3c, 0xfc, 0x00,
+  0x04, 0x46, 0xfc, 0xff, 0xff, 0x7a, 0xfc, 0x00, 0x04, 0x14, 0xe6, 0xff, 0xff, 0xba, 0xfb, 0x00,
+  0x04, 0xb2, 0xff, 0xff, 0xe6, 0x16, 0xfb, 0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+007b ({) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x98, 0xce, 0xec, 0xf8, 0xff,  //......%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xac, 0x26, 0x04, 0x00,  //....%@@%...
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,  //...+@@@....
-  0x00, 0x0a, 0x3e, 0xd4, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00,  //...@@@+....
-  0xff, 0xff, 0xff, 0xfc, 0xd2, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@+.....
-  0xff, 0xff, 0xff, 0xfc, 0xce, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@+.....
-  0x00, 0x0a, 0x44, 0xdc, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00,  //..+@@@+....
-  0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00,  //...+@@@....
-  0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xa8, 0x24, 0x04, 0x00,  //....%@@%...
-  0x00, 0x00, 0x00, 0x00, 0x3c, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x98, 0xd0, 0xee, 0xf8, 0xff,  //......%@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd0, 0x00, 0x05, 0x30, 0x98, 0xce, 0xec, 0xf8, 0xff, 0xfd, 0x00, 0x01, 0x3a, 0xf8, 0xfc, 0xff,
+  0xfd, 0x00, 0x05, 0xb2, 0xff, 0xff, 0xac, 0x26, 0x04, 0xfc, 0x00, 0x03, 0xe8, 0xff, 0xff, 0x22,
+  0xfa, 0x00, 0x03, 0xfa, 0xff, 0xff, 0x02, 0xfa, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xfa, 0x00, 0x03, 0x0a, 0xff, 0xff, 0xf6, 0xfa, 0x00, 0x03, 0x40, 0xff, 0xff,
+  0xd0, 0xfc, 0x00, 0x05, 0x0a, 0x3e, 0xd4, 0xff, 0xff, 0x6c, 0xfd, 0x00, 0xfe, 0xff, 0x02, 0xfc,
+  0xd2, 0x66, 0xfc, 0x00, 0xfe, 0xff, 0x02, 0xfc, 0xce, 0x60, 0xfb, 0x00, 0x05, 0x0a, 0x44, 0xdc,
+  0xff, 0xff, 0x68, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd0, 0xfa, 0x00, 0x03, 0x10, 0xff, 0xff,
+  0xf6, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0x03,
+  0xfa, 0xff, 0xff, 0x02, 0xfa, 0x00, 0x03, 0xe8, 0xff, 0xff, 0x20, 0xfa, 0x00, 0x05, 0xb2, 0xff,
+  0xff, 0xa8, 0x24, 0x04, 0xfc, 0x00, 0x01, 0x3c, 0xf8, 0xfc, 0xff, 0xfc, 0x00, 0x05, 0x30, 0x98,
+  0xd0, 0xee, 0xf8, 0xff, 0xeb, 0x00,
 
   /*Unicode: U+007c (|) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-
+  0xf9, 0x00, 0xcd, 0xff,
 
   /*Unicode: U+007d (}) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf8, 0xec, 0xce, 0x96, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00,  //@@@@@@.....
-  0x00, 0x04, 0x28, 0xae, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //...%@@%....
-  0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //....@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0xd4, 0x3e, 0x08, 0x00,  //....+@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xd0, 0xfc, 0xff, 0xff, 0xff,  //.....+@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xcc, 0xfc, 0xff, 0xff, 0xff,  //.....+@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xda, 0x42, 0x0a, 0x00,  //....+@@@+..
-  0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00,  //....@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x04, 0x26, 0xac, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //...%@@%....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00,  //@@@@@@.....
-  0xff, 0xf8, 0xec, 0xce, 0x98, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd5, 0x00, 0x05, 0xff, 0xf8, 0xec, 0xce, 0x96, 0x2e, 0xfc, 0x00, 0xfc, 0xff, 0x01, 0xf8, 0x38,
+  0xfc, 0x00, 0x05, 0x04, 0x28, 0xae, 0xff, 0xff, 0xb0, 0xfa, 0x00, 0x03, 0x24, 0xff, 0xff, 0xe6,
+  0xfa, 0x00, 0x03, 0x02, 0xff, 0xff, 0xfa, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x0a, 0xfa, 0x00, 0x03, 0xd2, 0xff, 0xff,
+  0x40, 0xfa, 0x00, 0x05, 0x6e, 0xff, 0xff, 0xd4, 0x3e, 0x08, 0xfb, 0x00, 0x02, 0x64, 0xd0, 0xfc,
+  0xfe, 0xff, 0xfc, 0x00, 0x02, 0x5e, 0xcc, 0xfc, 0xfe, 0xff, 0xfd, 0x00, 0x05, 0x68, 0xff, 0xff,
+  0xda, 0x42, 0x0a, 0xfc, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x48, 0xfa, 0x00, 0x03, 0xf6, 0xff, 0xff,
+  0x0e, 0xfa, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0x03,
+  0x02, 0xff, 0xff, 0xfa, 0xfa, 0x00, 0x03, 0x22, 0xff, 0xff, 0xe6, 0xfc, 0x00, 0x05, 0x04, 0x26,
+  0xac, 0xff, 0xff, 0xb0, 0xfd, 0x00, 0xfc, 0xff, 0x01, 0xf8, 0x38, 0xfd, 0x00, 0x05, 0xff, 0xf8,
+  0xec, 0xce, 0x98, 0x2e, 0xe6, 0x00,
 
   /*Unicode: U+007e (~) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x56, 0xc8, 0xf4, 0xe2, 0xa0, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,  //.+@@@%......+
-  0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa0, 0x34, 0x08, 0x2e, 0xac, 0xff,  //%@@@@@@%...%@
-  0xff, 0xaa, 0x32, 0x08, 0x24, 0x74, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94,  //@%...+@@@@@@%
-  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x78, 0xd6, 0xf4, 0xca, 0x56, 0x00,  //+......+@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0x81, 0x00, 0xca, 0x00, 0x05, 0x56, 0xc8, 0xf4, 0xe2, 0xa0, 0x2a, 0xfc, 0x00, 0x01, 0x7e, 0x96,
+  0xfc, 0xff, 0x0d, 0xfa, 0xa0, 0x34, 0x08, 0x2e, 0xac, 0xff, 0xff, 0xaa, 0x32, 0x08, 0x24, 0x74,
+  0xea, 0xfc, 0xff, 0x01, 0x94, 0x7c, 0xfc, 0x00, 0x05, 0x0c, 0x78, 0xd6, 0xf4, 0xca, 0x56, 0x81,
+  0x00, 0xe4, 0x00,
 
 #endif
 };
@@ -12567,391 +2829,391 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_30_glyph_dsc[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_30 == 1
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 3,	.glyph_index = 30},	/*Unicode: U+0021 (!)*/
-  {.w_px = 7,	.glyph_index = 60},	/*Unicode: U+0022 (")*/
-  {.w_px = 16,	.glyph_index = 90},	/*Unicode: U+0023 (#)*/
-  {.w_px = 11,	.glyph_index = 150},	/*Unicode: U+0024 ($)*/
-  {.w_px = 15,	.glyph_index = 210},	/*Unicode: U+0025 (%)*/
-  {.w_px = 15,	.glyph_index = 270},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 330},	/*Unicode: U+0027 (')*/
-  {.w_px = 6,	.glyph_index = 360},	/*Unicode: U+0028 (()*/
-  {.w_px = 6,	.glyph_index = 390},	/*Unicode: U+0029 ())*/
-  {.w_px = 11,	.glyph_index = 420},	/*Unicode: U+002a (*)*/
-  {.w_px = 14,	.glyph_index = 480},	/*Unicode: U+002b (+)*/
-  {.w_px = 4,	.glyph_index = 540},	/*Unicode: U+002c (,)*/
-  {.w_px = 7,	.glyph_index = 570},	/*Unicode: U+002d (-)*/
-  {.w_px = 3,	.glyph_index = 600},	/*Unicode: U+002e (.)*/
-  {.w_px = 13,	.glyph_index = 630},	/*Unicode: U+002f (/)*/
-  {.w_px = 12,	.glyph_index = 690},	/*Unicode: U+0030 (0)*/
-  {.w_px = 11,	.glyph_index = 750},	/*Unicode: U+0031 (1)*/
-  {.w_px = 13,	.glyph_index = 810},	/*Unicode: U+0032 (2)*/
-  {.w_px = 12,	.glyph_index = 870},	/*Unicode: U+0033 (3)*/
-  {.w_px = 13,	.glyph_index = 930},	/*Unicode: U+0034 (4)*/
-  {.w_px = 12,	.glyph_index = 990},	/*Unicode: U+0035 (5)*/
-  {.w_px = 12,	.glyph_index = 1050},	/*Unicode: U+0036 (6)*/
-  {.w_px = 12,	.glyph_index = 1110},	/*Unicode: U+0037 (7)*/
-  {.w_px = 12,	.glyph_index = 1170},	/*Unicode: U+0038 (8)*/
-  {.w_px = 12,	.glyph_index = 1230},	/*Unicode: U+0039 (9)*/
-  {.w_px = 3,	.glyph_index = 1290},	/*Unicode: U+003a (:)*/
-  {.w_px = 4,	.glyph_index = 1320},	/*Unicode: U+003b (;)*/
-  {.w_px = 13,	.glyph_index = 1350},	/*Unicode: U+003c (<)*/
-  {.w_px = 13,	.glyph_index = 1410},	/*Unicode: U+003d (=)*/
-  {.w_px = 13,	.glyph_index = 1470},	/*Unicode: U+003e (>)*/
-  {.w_px = 10,	.glyph_index = 1530},	/*Unicode: U+003f (?)*/
-  {.w_px = 15,	.glyph_index = 1590},	/*Unicode: U+0040 (@)*/
-  {.w_px = 15,	.glyph_index = 1650},	/*Unicode: U+0041 (A)*/
-  {.w_px = 12,	.glyph_index = 1710},	/*Unicode: U+0042 (B)*/
-  {.w_px = 12,	.glyph_index = 1770},	/*Unicode: U+0043 (C)*/
-  {.w_px = 12,	.glyph_index = 1830},	/*Unicode: U+0044 (D)*/
-  {.w_px = 12,	.glyph_index = 1890},	/*Unicode: U+0045 (E)*/
-  {.w_px = 12,	.glyph_index = 1950},	/*Unicode: U+0046 (F)*/
-  {.w_px = 13,	.glyph_index = 2010},	/*Unicode: U+0047 (G)*/
-  {.w_px = 12,	.glyph_index = 2070},	/*Unicode: U+0048 (H)*/
-  {.w_px = 11,	.glyph_index = 2130},	/*Unicode: U+0049 (I)*/
-  {.w_px = 11,	.glyph_index = 2190},	/*Unicode: U+004a (J)*/
-  {.w_px = 15,	.glyph_index = 2250},	/*Unicode: U+004b (K)*/
-  {.w_px = 12,	.glyph_index = 2310},	/*Unicode: U+004c (L)*/
-  {.w_px = 13,	.glyph_index = 2370},	/*Unicode: U+004d (M)*/
-  {.w_px = 12,	.glyph_index = 2430},	/*Unicode: U+004e (N)*/
-  {.w_px = 13,	.glyph_index = 2490},	/*Unicode: U+004f (O)*/
-  {.w_px = 12,	.glyph_index = 2550},	/*Unicode: U+0050 (P)*/
-  {.w_px = 13,	.glyph_index = 2610},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 14,	.glyph_index = 2670},	/*Unicode: U+0052 (R)*/
-  {.w_px = 12,	.glyph_index = 2730},	/*Unicode: U+0053 (S)*/
-  {.w_px = 15,	.glyph_index = 2790},	/*Unicode: U+0054 (T)*/
-  {.w_px = 12,	.glyph_index = 2850},	/*Unicode: U+0055 (U)*/
-  {.w_px = 14,	.glyph_index = 2910},	/*Unicode: U+0056 (V)*/
-  {.w_px = 16,	.glyph_index = 2970},	/*Unicode: U+0057 (W)*/
-  {.w_px = 15,	.glyph_index = 3030},	/*Unicode: U+0058 (X)*/
-  {.w_px = 15,	.glyph_index = 3090},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 13,	.glyph_index = 3150},	/*Unicode: U+005a (Z)*/
-  {.w_px = 6,	.glyph_index = 3210},	/*Unicode: U+005b ([)*/
-  {.w_px = 13,	.glyph_index = 3240},	/*Unicode: U+005c (\)*/
-  {.w_px = 6,	.glyph_index = 3300},	/*Unicode: U+005d (])*/
-  {.w_px = 14,	.glyph_index = 3330},	/*Unicode: U+005e (^)*/
-  {.w_px = 16,	.glyph_index = 3390},	/*Unicode: U+005f (_)*/
-  {.w_px = 6,	.glyph_index = 3450},	/*Unicode: U+0060 (`)*/
-  {.w_px = 12,	.glyph_index = 3480},	/*Unicode: U+0061 (a)*/
-  {.w_px = 12,	.glyph_index = 3540},	/*Unicode: U+0062 (b)*/
-  {.w_px = 11,	.glyph_index = 3600},	/*Unicode: U+0063 (c)*/
-  {.w_px = 12,	.glyph_index = 3660},	/*Unicode: U+0064 (d)*/
-  {.w_px = 13,	.glyph_index = 3720},	/*Unicode: U+0065 (e)*/
-  {.w_px = 12,	.glyph_index = 3780},	/*Unicode: U+0066 (f)*/
-  {.w_px = 12,	.glyph_index = 3840},	/*Unicode: U+0067 (g)*/
-  {.w_px = 11,	.glyph_index = 3900},	/*Unicode: U+0068 (h)*/
-  {.w_px = 13,	.glyph_index = 3960},	/*Unicode: U+0069 (i)*/
-  {.w_px = 8,	.glyph_index = 4020},	/*Unicode: U+006a (j)*/
-  {.w_px = 13,	.glyph_index = 4050},	/*Unicode: U+006b (k)*/
-  {.w_px = 13,	.glyph_index = 4110},	/*Unicode: U+006c (l)*/
-  {.w_px = 13,	.glyph_index = 4170},	/*Unicode: U+006d (m)*/
-  {.w_px = 11,	.glyph_index = 4230},	/*Unicode: U+006e (n)*/
-  {.w_px = 12,	.glyph_index = 4290},	/*Unicode: U+006f (o)*/
-  {.w_px = 12,	.glyph_index = 4350},	/*Unicode: U+0070 (p)*/
-  {.w_px = 12,	.glyph_index = 4410},	/*Unicode: U+0071 (q)*/
-  {.w_px = 10,	.glyph_index = 4470},	/*Unicode: U+0072 (r)*/
-  {.w_px = 10,	.glyph_index = 4530},	/*Unicode: U+0073 (s)*/
-  {.w_px = 12,	.glyph_index = 4590},	/*Unicode: U+0074 (t)*/
-  {.w_px = 11,	.glyph_index = 4650},	/*Unicode: U+0075 (u)*/
-  {.w_px = 13,	.glyph_index = 4710},	/*Unicode: U+0076 (v)*/
-  {.w_px = 16,	.glyph_index = 4770},	/*Unicode: U+0077 (w)*/
-  {.w_px = 14,	.glyph_index = 4830},	/*Unicode: U+0078 (x)*/
-  {.w_px = 13,	.glyph_index = 4890},	/*Unicode: U+0079 (y)*/
-  {.w_px = 11,	.glyph_index = 4950},	/*Unicode: U+007a (z)*/
-  {.w_px = 11,	.glyph_index = 5010},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 5070},	/*Unicode: U+007c (|)*/
-  {.w_px = 11,	.glyph_index = 5100},	/*Unicode: U+007d (})*/
-  {.w_px = 13,	.glyph_index = 5160},	/*Unicode: U+007e (~)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 7,	.glyph_index = 12},	/*Unicode: U+0022 (")*/
+  {.w_px = 16,	.glyph_index = 18},	/*Unicode: U+0023 (#)*/
+  {.w_px = 11,	.glyph_index = 59},	/*Unicode: U+0024 ($)*/
+  {.w_px = 15,	.glyph_index = 111},	/*Unicode: U+0025 (%)*/
+  {.w_px = 15,	.glyph_index = 154},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 197},	/*Unicode: U+0027 (')*/
+  {.w_px = 6,	.glyph_index = 203},	/*Unicode: U+0028 (()*/
+  {.w_px = 6,	.glyph_index = 227},	/*Unicode: U+0029 ())*/
+  {.w_px = 11,	.glyph_index = 251},	/*Unicode: U+002a (*)*/
+  {.w_px = 14,	.glyph_index = 279},	/*Unicode: U+002b (+)*/
+  {.w_px = 4,	.glyph_index = 311},	/*Unicode: U+002c (,)*/
+  {.w_px = 7,	.glyph_index = 321},	/*Unicode: U+002d (-)*/
+  {.w_px = 3,	.glyph_index = 328},	/*Unicode: U+002e (.)*/
+  {.w_px = 13,	.glyph_index = 334},	/*Unicode: U+002f (/)*/
+  {.w_px = 12,	.glyph_index = 379},	/*Unicode: U+0030 (0)*/
+  {.w_px = 11,	.glyph_index = 421},	/*Unicode: U+0031 (1)*/
+  {.w_px = 13,	.glyph_index = 464},	/*Unicode: U+0032 (2)*/
+  {.w_px = 12,	.glyph_index = 507},	/*Unicode: U+0033 (3)*/
+  {.w_px = 13,	.glyph_index = 549},	/*Unicode: U+0034 (4)*/
+  {.w_px = 12,	.glyph_index = 592},	/*Unicode: U+0035 (5)*/
+  {.w_px = 12,	.glyph_index = 634},	/*Unicode: U+0036 (6)*/
+  {.w_px = 12,	.glyph_index = 677},	/*Unicode: U+0037 (7)*/
+  {.w_px = 12,	.glyph_index = 719},	/*Unicode: U+0038 (8)*/
+  {.w_px = 12,	.glyph_index = 762},	/*Unicode: U+0039 (9)*/
+  {.w_px = 3,	.glyph_index = 804},	/*Unicode: U+003a (:)*/
+  {.w_px = 4,	.glyph_index = 814},	/*Unicode: U+003b (;)*/
+  {.w_px = 13,	.glyph_index = 828},	/*Unicode: U+003c (<)*/
+  {.w_px = 13,	.glyph_index = 858},	/*Unicode: U+003d (=)*/
+  {.w_px = 13,	.glyph_index = 874},	/*Unicode: U+003e (>)*/
+  {.w_px = 10,	.glyph_index = 904},	/*Unicode: U+003f (?)*/
+  {.w_px = 15,	.glyph_index = 944},	/*Unicode: U+0040 (@)*/
+  {.w_px = 15,	.glyph_index = 993},	/*Unicode: U+0041 (A)*/
+  {.w_px = 12,	.glyph_index = 1036},	/*Unicode: U+0042 (B)*/
+  {.w_px = 12,	.glyph_index = 1073},	/*Unicode: U+0043 (C)*/
+  {.w_px = 12,	.glyph_index = 1116},	/*Unicode: U+0044 (D)*/
+  {.w_px = 12,	.glyph_index = 1155},	/*Unicode: U+0045 (E)*/
+  {.w_px = 12,	.glyph_index = 1198},	/*Unicode: U+0046 (F)*/
+  {.w_px = 13,	.glyph_index = 1240},	/*Unicode: U+0047 (G)*/
+  {.w_px = 12,	.glyph_index = 1283},	/*Unicode: U+0048 (H)*/
+  {.w_px = 11,	.glyph_index = 1326},	/*Unicode: U+0049 (I)*/
+  {.w_px = 11,	.glyph_index = 1369},	/*Unicode: U+004a (J)*/
+  {.w_px = 15,	.glyph_index = 1411},	/*Unicode: U+004b (K)*/
+  {.w_px = 12,	.glyph_index = 1453},	/*Unicode: U+004c (L)*/
+  {.w_px = 13,	.glyph_index = 1496},	/*Unicode: U+004d (M)*/
+  {.w_px = 12,	.glyph_index = 1536},	/*Unicode: U+004e (N)*/
+  {.w_px = 13,	.glyph_index = 1579},	/*Unicode: U+004f (O)*/
+  {.w_px = 12,	.glyph_index = 1620},	/*Unicode: U+0050 (P)*/
+  {.w_px = 13,	.glyph_index = 1662},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 14,	.glyph_index = 1709},	/*Unicode: U+0052 (R)*/
+  {.w_px = 12,	.glyph_index = 1751},	/*Unicode: U+0053 (S)*/
+  {.w_px = 15,	.glyph_index = 1794},	/*Unicode: U+0054 (T)*/
+  {.w_px = 12,	.glyph_index = 1837},	/*Unicode: U+0055 (U)*/
+  {.w_px = 14,	.glyph_index = 1880},	/*Unicode: U+0056 (V)*/
+  {.w_px = 16,	.glyph_index = 1923},	/*Unicode: U+0057 (W)*/
+  {.w_px = 15,	.glyph_index = 1965},	/*Unicode: U+0058 (X)*/
+  {.w_px = 15,	.glyph_index = 2008},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 13,	.glyph_index = 2051},	/*Unicode: U+005a (Z)*/
+  {.w_px = 6,	.glyph_index = 2094},	/*Unicode: U+005b ([)*/
+  {.w_px = 13,	.glyph_index = 2106},	/*Unicode: U+005c (\)*/
+  {.w_px = 6,	.glyph_index = 2153},	/*Unicode: U+005d (])*/
+  {.w_px = 14,	.glyph_index = 2165},	/*Unicode: U+005e (^)*/
+  {.w_px = 16,	.glyph_index = 2184},	/*Unicode: U+005f (_)*/
+  {.w_px = 6,	.glyph_index = 2188},	/*Unicode: U+0060 (`)*/
+  {.w_px = 12,	.glyph_index = 2198},	/*Unicode: U+0061 (a)*/
+  {.w_px = 12,	.glyph_index = 2231},	/*Unicode: U+0062 (b)*/
+  {.w_px = 11,	.glyph_index = 2276},	/*Unicode: U+0063 (c)*/
+  {.w_px = 12,	.glyph_index = 2309},	/*Unicode: U+0064 (d)*/
+  {.w_px = 13,	.glyph_index = 2353},	/*Unicode: U+0065 (e)*/
+  {.w_px = 12,	.glyph_index = 2386},	/*Unicode: U+0066 (f)*/
+  {.w_px = 12,	.glyph_index = 2430},	/*Unicode: U+0067 (g)*/
+  {.w_px = 11,	.glyph_index = 2473},	/*Unicode: U+0068 (h)*/
+  {.w_px = 13,	.glyph_index = 2499},	/*Unicode: U+0069 (i)*/
+  {.w_px = 8,	.glyph_index = 2540},	/*Unicode: U+006a (j)*/
+  {.w_px = 13,	.glyph_index = 2556},	/*Unicode: U+006b (k)*/
+  {.w_px = 13,	.glyph_index = 2601},	/*Unicode: U+006c (l)*/
+  {.w_px = 13,	.glyph_index = 2646},	/*Unicode: U+006d (m)*/
+  {.w_px = 11,	.glyph_index = 2679},	/*Unicode: U+006e (n)*/
+  {.w_px = 12,	.glyph_index = 2693},	/*Unicode: U+006f (o)*/
+  {.w_px = 12,	.glyph_index = 2726},	/*Unicode: U+0070 (p)*/
+  {.w_px = 12,	.glyph_index = 2768},	/*Unicode: U+0071 (q)*/
+  {.w_px = 10,	.glyph_index = 2811},	/*Unicode: U+0072 (r)*/
+  {.w_px = 10,	.glyph_index = 2843},	/*Unicode: U+0073 (s)*/
+  {.w_px = 12,	.glyph_index = 2875},	/*Unicode: U+0074 (t)*/
+  {.w_px = 11,	.glyph_index = 2916},	/*Unicode: U+0075 (u)*/
+  {.w_px = 13,	.glyph_index = 2931},	/*Unicode: U+0076 (v)*/
+  {.w_px = 16,	.glyph_index = 2960},	/*Unicode: U+0077 (w)*/
+  {.w_px = 14,	.glyph_index = 2993},	/*Unicode: U+0078 (x)*/
+  {.w_px = 13,	.glyph_index = 3026},	/*Unicode: U+0079 (y)*/
+  {.w_px = 11,	.glyph_index = 3067},	/*Unicode: U+007a (z)*/
+  {.w_px = 11,	.glyph_index = 3100},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 3153},	/*Unicode: U+007c (|)*/
+  {.w_px = 11,	.glyph_index = 3157},	/*Unicode: U+007d (})*/
+  {.w_px = 13,	.glyph_index = 3209},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 2
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 3,	.glyph_index = 60},	/*Unicode: U+0021 (!)*/
-  {.w_px = 7,	.glyph_index = 90},	/*Unicode: U+0022 (")*/
-  {.w_px = 16,	.glyph_index = 150},	/*Unicode: U+0023 (#)*/
-  {.w_px = 11,	.glyph_index = 270},	/*Unicode: U+0024 ($)*/
-  {.w_px = 15,	.glyph_index = 360},	/*Unicode: U+0025 (%)*/
-  {.w_px = 15,	.glyph_index = 480},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 600},	/*Unicode: U+0027 (')*/
-  {.w_px = 6,	.glyph_index = 630},	/*Unicode: U+0028 (()*/
-  {.w_px = 6,	.glyph_index = 690},	/*Unicode: U+0029 ())*/
-  {.w_px = 11,	.glyph_index = 750},	/*Unicode: U+002a (*)*/
-  {.w_px = 14,	.glyph_index = 840},	/*Unicode: U+002b (+)*/
-  {.w_px = 4,	.glyph_index = 960},	/*Unicode: U+002c (,)*/
-  {.w_px = 7,	.glyph_index = 990},	/*Unicode: U+002d (-)*/
-  {.w_px = 3,	.glyph_index = 1050},	/*Unicode: U+002e (.)*/
-  {.w_px = 13,	.glyph_index = 1080},	/*Unicode: U+002f (/)*/
-  {.w_px = 12,	.glyph_index = 1200},	/*Unicode: U+0030 (0)*/
-  {.w_px = 11,	.glyph_index = 1290},	/*Unicode: U+0031 (1)*/
-  {.w_px = 13,	.glyph_index = 1380},	/*Unicode: U+0032 (2)*/
-  {.w_px = 12,	.glyph_index = 1500},	/*Unicode: U+0033 (3)*/
-  {.w_px = 13,	.glyph_index = 1590},	/*Unicode: U+0034 (4)*/
-  {.w_px = 12,	.glyph_index = 1710},	/*Unicode: U+0035 (5)*/
-  {.w_px = 12,	.glyph_index = 1800},	/*Unicode: U+0036 (6)*/
-  {.w_px = 12,	.glyph_index = 1890},	/*Unicode: U+0037 (7)*/
-  {.w_px = 12,	.glyph_index = 1980},	/*Unicode: U+0038 (8)*/
-  {.w_px = 12,	.glyph_index = 2070},	/*Unicode: U+0039 (9)*/
-  {.w_px = 3,	.glyph_index = 2160},	/*Unicode: U+003a (:)*/
-  {.w_px = 4,	.glyph_index = 2190},	/*Unicode: U+003b (;)*/
-  {.w_px = 13,	.glyph_index = 2220},	/*Unicode: U+003c (<)*/
-  {.w_px = 13,	.glyph_index = 2340},	/*Unicode: U+003d (=)*/
-  {.w_px = 13,	.glyph_index = 2460},	/*Unicode: U+003e (>)*/
-  {.w_px = 10,	.glyph_index = 2580},	/*Unicode: U+003f (?)*/
-  {.w_px = 15,	.glyph_index = 2670},	/*Unicode: U+0040 (@)*/
-  {.w_px = 15,	.glyph_index = 2790},	/*Unicode: U+0041 (A)*/
-  {.w_px = 12,	.glyph_index = 2910},	/*Unicode: U+0042 (B)*/
-  {.w_px = 12,	.glyph_index = 3000},	/*Unicode: U+0043 (C)*/
-  {.w_px = 12,	.glyph_index = 3090},	/*Unicode: U+0044 (D)*/
-  {.w_px = 12,	.glyph_index = 3180},	/*Unicode: U+0045 (E)*/
-  {.w_px = 12,	.glyph_index = 3270},	/*Unicode: U+0046 (F)*/
-  {.w_px = 13,	.glyph_index = 3360},	/*Unicode: U+0047 (G)*/
-  {.w_px = 12,	.glyph_index = 3480},	/*Unicode: U+0048 (H)*/
-  {.w_px = 11,	.glyph_index = 3570},	/*Unicode: U+0049 (I)*/
-  {.w_px = 11,	.glyph_index = 3660},	/*Unicode: U+004a (J)*/
-  {.w_px = 15,	.glyph_index = 3750},	/*Unicode: U+004b (K)*/
-  {.w_px = 12,	.glyph_index = 3870},	/*Unicode: U+004c (L)*/
-  {.w_px = 13,	.glyph_index = 3960},	/*Unicode: U+004d (M)*/
-  {.w_px = 12,	.glyph_index = 4080},	/*Unicode: U+004e (N)*/
-  {.w_px = 13,	.glyph_index = 4170},	/*Unicode: U+004f (O)*/
-  {.w_px = 12,	.glyph_index = 4290},	/*Unicode: U+0050 (P)*/
-  {.w_px = 13,	.glyph_index = 4380},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 14,	.glyph_index = 4500},	/*Unicode: U+0052 (R)*/
-  {.w_px = 12,	.glyph_index = 4620},	/*Unicode: U+0053 (S)*/
-  {.w_px = 15,	.glyph_index = 4710},	/*Unicode: U+0054 (T)*/
-  {.w_px = 12,	.glyph_index = 4830},	/*Unicode: U+0055 (U)*/
-  {.w_px = 14,	.glyph_index = 4920},	/*Unicode: U+0056 (V)*/
-  {.w_px = 16,	.glyph_index = 5040},	/*Unicode: U+0057 (W)*/
-  {.w_px = 15,	.glyph_index = 5160},	/*Unicode: U+0058 (X)*/
-  {.w_px = 15,	.glyph_index = 5280},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 13,	.glyph_index = 5400},	/*Unicode: U+005a (Z)*/
-  {.w_px = 6,	.glyph_index = 5520},	/*Unicode: U+005b ([)*/
-  {.w_px = 13,	.glyph_index = 5580},	/*Unicode: U+005c (\)*/
-  {.w_px = 6,	.glyph_index = 5700},	/*Unicode: U+005d (])*/
-  {.w_px = 14,	.glyph_index = 5760},	/*Unicode: U+005e (^)*/
-  {.w_px = 16,	.glyph_index = 5880},	/*Unicode: U+005f (_)*/
-  {.w_px = 6,	.glyph_index = 6000},	/*Unicode: U+0060 (`)*/
-  {.w_px = 12,	.glyph_index = 6060},	/*Unicode: U+0061 (a)*/
-  {.w_px = 12,	.glyph_index = 6150},	/*Unicode: U+0062 (b)*/
-  {.w_px = 11,	.glyph_index = 6240},	/*Unicode: U+0063 (c)*/
-  {.w_px = 12,	.glyph_index = 6330},	/*Unicode: U+0064 (d)*/
-  {.w_px = 13,	.glyph_index = 6420},	/*Unicode: U+0065 (e)*/
-  {.w_px = 12,	.glyph_index = 6540},	/*Unicode: U+0066 (f)*/
-  {.w_px = 12,	.glyph_index = 6630},	/*Unicode: U+0067 (g)*/
-  {.w_px = 11,	.glyph_index = 6720},	/*Unicode: U+0068 (h)*/
-  {.w_px = 13,	.glyph_index = 6810},	/*Unicode: U+0069 (i)*/
-  {.w_px = 8,	.glyph_index = 6930},	/*Unicode: U+006a (j)*/
-  {.w_px = 13,	.glyph_index = 6990},	/*Unicode: U+006b (k)*/
-  {.w_px = 13,	.glyph_index = 7110},	/*Unicode: U+006c (l)*/
-  {.w_px = 13,	.glyph_index = 7230},	/*Unicode: U+006d (m)*/
-  {.w_px = 11,	.glyph_index = 7350},	/*Unicode: U+006e (n)*/
-  {.w_px = 12,	.glyph_index = 7440},	/*Unicode: U+006f (o)*/
-  {.w_px = 12,	.glyph_index = 7530},	/*Unicode: U+0070 (p)*/
-  {.w_px = 12,	.glyph_index = 7620},	/*Unicode: U+0071 (q)*/
-  {.w_px = 10,	.glyph_index = 7710},	/*Unicode: U+0072 (r)*/
-  {.w_px = 10,	.glyph_index = 7800},	/*Unicode: U+0073 (s)*/
-  {.w_px = 12,	.glyph_index = 7890},	/*Unicode: U+0074 (t)*/
-  {.w_px = 11,	.glyph_index = 7980},	/*Unicode: U+0075 (u)*/
-  {.w_px = 13,	.glyph_index = 8070},	/*Unicode: U+0076 (v)*/
-  {.w_px = 16,	.glyph_index = 8190},	/*Unicode: U+0077 (w)*/
-  {.w_px = 14,	.glyph_index = 8310},	/*Unicode: U+0078 (x)*/
-  {.w_px = 13,	.glyph_index = 8430},	/*Unicode: U+0079 (y)*/
-  {.w_px = 11,	.glyph_index = 8550},	/*Unicode: U+007a (z)*/
-  {.w_px = 11,	.glyph_index = 8640},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 8730},	/*Unicode: U+007c (|)*/
-  {.w_px = 11,	.glyph_index = 8760},	/*Unicode: U+007d (})*/
-  {.w_px = 13,	.glyph_index = 8850},	/*Unicode: U+007e (~)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 7,	.glyph_index = 14},	/*Unicode: U+0022 (")*/
+  {.w_px = 16,	.glyph_index = 33},	/*Unicode: U+0023 (#)*/
+  {.w_px = 11,	.glyph_index = 108},	/*Unicode: U+0024 ($)*/
+  {.w_px = 15,	.glyph_index = 183},	/*Unicode: U+0025 (%)*/
+  {.w_px = 15,	.glyph_index = 264},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 344},	/*Unicode: U+0027 (')*/
+  {.w_px = 6,	.glyph_index = 350},	/*Unicode: U+0028 (()*/
+  {.w_px = 6,	.glyph_index = 400},	/*Unicode: U+0029 ())*/
+  {.w_px = 11,	.glyph_index = 450},	/*Unicode: U+002a (*)*/
+  {.w_px = 14,	.glyph_index = 489},	/*Unicode: U+002b (+)*/
+  {.w_px = 4,	.glyph_index = 547},	/*Unicode: U+002c (,)*/
+  {.w_px = 7,	.glyph_index = 558},	/*Unicode: U+002d (-)*/
+  {.w_px = 3,	.glyph_index = 567},	/*Unicode: U+002e (.)*/
+  {.w_px = 13,	.glyph_index = 573},	/*Unicode: U+002f (/)*/
+  {.w_px = 12,	.glyph_index = 657},	/*Unicode: U+0030 (0)*/
+  {.w_px = 11,	.glyph_index = 719},	/*Unicode: U+0031 (1)*/
+  {.w_px = 13,	.glyph_index = 781},	/*Unicode: U+0032 (2)*/
+  {.w_px = 12,	.glyph_index = 859},	/*Unicode: U+0033 (3)*/
+  {.w_px = 13,	.glyph_index = 921},	/*Unicode: U+0034 (4)*/
+  {.w_px = 12,	.glyph_index = 1000},	/*Unicode: U+0035 (5)*/
+  {.w_px = 12,	.glyph_index = 1062},	/*Unicode: U+0036 (6)*/
+  {.w_px = 12,	.glyph_index = 1123},	/*Unicode: U+0037 (7)*/
+  {.w_px = 12,	.glyph_index = 1180},	/*Unicode: U+0038 (8)*/
+  {.w_px = 12,	.glyph_index = 1242},	/*Unicode: U+0039 (9)*/
+  {.w_px = 3,	.glyph_index = 1303},	/*Unicode: U+003a (:)*/
+  {.w_px = 4,	.glyph_index = 1313},	/*Unicode: U+003b (;)*/
+  {.w_px = 13,	.glyph_index = 1328},	/*Unicode: U+003c (<)*/
+  {.w_px = 13,	.glyph_index = 1383},	/*Unicode: U+003d (=)*/
+  {.w_px = 13,	.glyph_index = 1405},	/*Unicode: U+003e (>)*/
+  {.w_px = 10,	.glyph_index = 1459},	/*Unicode: U+003f (?)*/
+  {.w_px = 15,	.glyph_index = 1516},	/*Unicode: U+0040 (@)*/
+  {.w_px = 15,	.glyph_index = 1608},	/*Unicode: U+0041 (A)*/
+  {.w_px = 12,	.glyph_index = 1688},	/*Unicode: U+0042 (B)*/
+  {.w_px = 12,	.glyph_index = 1750},	/*Unicode: U+0043 (C)*/
+  {.w_px = 12,	.glyph_index = 1811},	/*Unicode: U+0044 (D)*/
+  {.w_px = 12,	.glyph_index = 1872},	/*Unicode: U+0045 (E)*/
+  {.w_px = 12,	.glyph_index = 1926},	/*Unicode: U+0046 (F)*/
+  {.w_px = 13,	.glyph_index = 1982},	/*Unicode: U+0047 (G)*/
+  {.w_px = 12,	.glyph_index = 2061},	/*Unicode: U+0048 (H)*/
+  {.w_px = 11,	.glyph_index = 2120},	/*Unicode: U+0049 (I)*/
+  {.w_px = 11,	.glyph_index = 2182},	/*Unicode: U+004a (J)*/
+  {.w_px = 15,	.glyph_index = 2244},	/*Unicode: U+004b (K)*/
+  {.w_px = 12,	.glyph_index = 2325},	/*Unicode: U+004c (L)*/
+  {.w_px = 13,	.glyph_index = 2383},	/*Unicode: U+004d (M)*/
+  {.w_px = 12,	.glyph_index = 2464},	/*Unicode: U+004e (N)*/
+  {.w_px = 13,	.glyph_index = 2526},	/*Unicode: U+004f (O)*/
+  {.w_px = 12,	.glyph_index = 2606},	/*Unicode: U+0050 (P)*/
+  {.w_px = 13,	.glyph_index = 2666},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 14,	.glyph_index = 2758},	/*Unicode: U+0052 (R)*/
+  {.w_px = 12,	.glyph_index = 2839},	/*Unicode: U+0053 (S)*/
+  {.w_px = 15,	.glyph_index = 2901},	/*Unicode: U+0054 (T)*/
+  {.w_px = 12,	.glyph_index = 2980},	/*Unicode: U+0055 (U)*/
+  {.w_px = 14,	.glyph_index = 3042},	/*Unicode: U+0056 (V)*/
+  {.w_px = 16,	.glyph_index = 3122},	/*Unicode: U+0057 (W)*/
+  {.w_px = 15,	.glyph_index = 3203},	/*Unicode: U+0058 (X)*/
+  {.w_px = 15,	.glyph_index = 3284},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 13,	.glyph_index = 3364},	/*Unicode: U+005a (Z)*/
+  {.w_px = 6,	.glyph_index = 3443},	/*Unicode: U+005b ([)*/
+  {.w_px = 13,	.glyph_index = 3494},	/*Unicode: U+005c (\)*/
+  {.w_px = 6,	.glyph_index = 3583},	/*Unicode: U+005d (])*/
+  {.w_px = 14,	.glyph_index = 3634},	/*Unicode: U+005e (^)*/
+  {.w_px = 16,	.glyph_index = 3666},	/*Unicode: U+005f (_)*/
+  {.w_px = 6,	.glyph_index = 3670},	/*Unicode: U+0060 (`)*/
+  {.w_px = 12,	.glyph_index = 3685},	/*Unicode: U+0061 (a)*/
+  {.w_px = 12,	.glyph_index = 3732},	/*Unicode: U+0062 (b)*/
+  {.w_px = 11,	.glyph_index = 3797},	/*Unicode: U+0063 (c)*/
+  {.w_px = 12,	.glyph_index = 3843},	/*Unicode: U+0064 (d)*/
+  {.w_px = 13,	.glyph_index = 3906},	/*Unicode: U+0065 (e)*/
+  {.w_px = 12,	.glyph_index = 3965},	/*Unicode: U+0066 (f)*/
+  {.w_px = 12,	.glyph_index = 4025},	/*Unicode: U+0067 (g)*/
+  {.w_px = 11,	.glyph_index = 4087},	/*Unicode: U+0068 (h)*/
+  {.w_px = 13,	.glyph_index = 4152},	/*Unicode: U+0069 (i)*/
+  {.w_px = 8,	.glyph_index = 4225},	/*Unicode: U+006a (j)*/
+  {.w_px = 13,	.glyph_index = 4276},	/*Unicode: U+006b (k)*/
+  {.w_px = 13,	.glyph_index = 4360},	/*Unicode: U+006c (l)*/
+  {.w_px = 13,	.glyph_index = 4445},	/*Unicode: U+006d (m)*/
+  {.w_px = 11,	.glyph_index = 4506},	/*Unicode: U+006e (n)*/
+  {.w_px = 12,	.glyph_index = 4553},	/*Unicode: U+006f (o)*/
+  {.w_px = 12,	.glyph_index = 4600},	/*Unicode: U+0070 (p)*/
+  {.w_px = 12,	.glyph_index = 4660},	/*Unicode: U+0071 (q)*/
+  {.w_px = 10,	.glyph_index = 4722},	/*Unicode: U+0072 (r)*/
+  {.w_px = 10,	.glyph_index = 4767},	/*Unicode: U+0073 (s)*/
+  {.w_px = 12,	.glyph_index = 4813},	/*Unicode: U+0074 (t)*/
+  {.w_px = 11,	.glyph_index = 4868},	/*Unicode: U+0075 (u)*/
+  {.w_px = 13,	.glyph_index = 4915},	/*Unicode: U+0076 (v)*/
+  {.w_px = 16,	.glyph_index = 4974},	/*Unicode: U+0077 (w)*/
+  {.w_px = 14,	.glyph_index = 5035},	/*Unicode: U+0078 (x)*/
+  {.w_px = 13,	.glyph_index = 5096},	/*Unicode: U+0079 (y)*/
+  {.w_px = 11,	.glyph_index = 5175},	/*Unicode: U+007a (z)*/
+  {.w_px = 11,	.glyph_index = 5222},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 5298},	/*Unicode: U+007c (|)*/
+  {.w_px = 11,	.glyph_index = 5302},	/*Unicode: U+007d (})*/
+  {.w_px = 13,	.glyph_index = 5378},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 4
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 3,	.glyph_index = 120},	/*Unicode: U+0021 (!)*/
-  {.w_px = 7,	.glyph_index = 180},	/*Unicode: U+0022 (")*/
-  {.w_px = 16,	.glyph_index = 300},	/*Unicode: U+0023 (#)*/
-  {.w_px = 11,	.glyph_index = 540},	/*Unicode: U+0024 ($)*/
-  {.w_px = 15,	.glyph_index = 720},	/*Unicode: U+0025 (%)*/
-  {.w_px = 15,	.glyph_index = 960},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 1200},	/*Unicode: U+0027 (')*/
-  {.w_px = 6,	.glyph_index = 1230},	/*Unicode: U+0028 (()*/
-  {.w_px = 6,	.glyph_index = 1320},	/*Unicode: U+0029 ())*/
-  {.w_px = 11,	.glyph_index = 1410},	/*Unicode: U+002a (*)*/
-  {.w_px = 14,	.glyph_index = 1590},	/*Unicode: U+002b (+)*/
-  {.w_px = 4,	.glyph_index = 1800},	/*Unicode: U+002c (,)*/
-  {.w_px = 7,	.glyph_index = 1860},	/*Unicode: U+002d (-)*/
-  {.w_px = 3,	.glyph_index = 1980},	/*Unicode: U+002e (.)*/
-  {.w_px = 13,	.glyph_index = 2040},	/*Unicode: U+002f (/)*/
-  {.w_px = 12,	.glyph_index = 2250},	/*Unicode: U+0030 (0)*/
-  {.w_px = 11,	.glyph_index = 2430},	/*Unicode: U+0031 (1)*/
-  {.w_px = 13,	.glyph_index = 2610},	/*Unicode: U+0032 (2)*/
-  {.w_px = 12,	.glyph_index = 2820},	/*Unicode: U+0033 (3)*/
-  {.w_px = 13,	.glyph_index = 3000},	/*Unicode: U+0034 (4)*/
-  {.w_px = 12,	.glyph_index = 3210},	/*Unicode: U+0035 (5)*/
-  {.w_px = 12,	.glyph_index = 3390},	/*Unicode: U+0036 (6)*/
-  {.w_px = 12,	.glyph_index = 3570},	/*Unicode: U+0037 (7)*/
-  {.w_px = 12,	.glyph_index = 3750},	/*Unicode: U+0038 (8)*/
-  {.w_px = 12,	.glyph_index = 3930},	/*Unicode: U+0039 (9)*/
-  {.w_px = 3,	.glyph_index = 4110},	/*Unicode: U+003a (:)*/
-  {.w_px = 4,	.glyph_index = 4170},	/*Unicode: U+003b (;)*/
-  {.w_px = 13,	.glyph_index = 4230},	/*Unicode: U+003c (<)*/
-  {.w_px = 13,	.glyph_index = 4440},	/*Unicode: U+003d (=)*/
-  {.w_px = 13,	.glyph_index = 4650},	/*Unicode: U+003e (>)*/
-  {.w_px = 10,	.glyph_index = 4860},	/*Unicode: U+003f (?)*/
-  {.w_px = 15,	.glyph_index = 5010},	/*Unicode: U+0040 (@)*/
-  {.w_px = 15,	.glyph_index = 5250},	/*Unicode: U+0041 (A)*/
-  {.w_px = 12,	.glyph_index = 5490},	/*Unicode: U+0042 (B)*/
-  {.w_px = 12,	.glyph_index = 5670},	/*Unicode: U+0043 (C)*/
-  {.w_px = 12,	.glyph_index = 5850},	/*Unicode: U+0044 (D)*/
-  {.w_px = 12,	.glyph_index = 6030},	/*Unicode: U+0045 (E)*/
-  {.w_px = 12,	.glyph_index = 6210},	/*Unicode: U+0046 (F)*/
-  {.w_px = 13,	.glyph_index = 6390},	/*Unicode: U+0047 (G)*/
-  {.w_px = 12,	.glyph_index = 6600},	/*Unicode: U+0048 (H)*/
-  {.w_px = 11,	.glyph_index = 6780},	/*Unicode: U+0049 (I)*/
-  {.w_px = 11,	.glyph_index = 6960},	/*Unicode: U+004a (J)*/
-  {.w_px = 15,	.glyph_index = 7140},	/*Unicode: U+004b (K)*/
-  {.w_px = 12,	.glyph_index = 7380},	/*Unicode: U+004c (L)*/
-  {.w_px = 13,	.glyph_index = 7560},	/*Unicode: U+004d (M)*/
-  {.w_px = 12,	.glyph_index = 7770},	/*Unicode: U+004e (N)*/
-  {.w_px = 13,	.glyph_index = 7950},	/*Unicode: U+004f (O)*/
-  {.w_px = 12,	.glyph_index = 8160},	/*Unicode: U+0050 (P)*/
-  {.w_px = 13,	.glyph_index = 8340},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 14,	.glyph_index = 8550},	/*Unicode: U+0052 (R)*/
-  {.w_px = 12,	.glyph_index = 8760},	/*Unicode: U+0053 (S)*/
-  {.w_px = 15,	.glyph_index = 8940},	/*Unicode: U+0054 (T)*/
-  {.w_px = 12,	.glyph_index = 9180},	/*Unicode: U+0055 (U)*/
-  {.w_px = 14,	.glyph_index = 9360},	/*Unicode: U+0056 (V)*/
-  {.w_px = 16,	.glyph_index = 9570},	/*Unicode: U+0057 (W)*/
-  {.w_px = 15,	.glyph_index = 9810},	/*Unicode: U+0058 (X)*/
-  {.w_px = 15,	.glyph_index = 10050},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 13,	.glyph_index = 10290},	/*Unicode: U+005a (Z)*/
-  {.w_px = 6,	.glyph_index = 10500},	/*Unicode: U+005b ([)*/
-  {.w_px = 13,	.glyph_index = 10590},	/*Unicode: U+005c (\)*/
-  {.w_px = 6,	.glyph_index = 10800},	/*Unicode: U+005d (])*/
-  {.w_px = 14,	.glyph_index = 10890},	/*Unicode: U+005e (^)*/
-  {.w_px = 16,	.glyph_index = 11100},	/*Unicode: U+005f (_)*/
-  {.w_px = 6,	.glyph_index = 11340},	/*Unicode: U+0060 (`)*/
-  {.w_px = 12,	.glyph_index = 11430},	/*Unicode: U+0061 (a)*/
-  {.w_px = 12,	.glyph_index = 11610},	/*Unicode: U+0062 (b)*/
-  {.w_px = 11,	.glyph_index = 11790},	/*Unicode: U+0063 (c)*/
-  {.w_px = 12,	.glyph_index = 11970},	/*Unicode: U+0064 (d)*/
-  {.w_px = 13,	.glyph_index = 12150},	/*Unicode: U+0065 (e)*/
-  {.w_px = 12,	.glyph_index = 12360},	/*Unicode: U+0066 (f)*/
-  {.w_px = 12,	.glyph_index = 12540},	/*Unicode: U+0067 (g)*/
-  {.w_px = 11,	.glyph_index = 12720},	/*Unicode: U+0068 (h)*/
-  {.w_px = 13,	.glyph_index = 12900},	/*Unicode: U+0069 (i)*/
-  {.w_px = 8,	.glyph_index = 13110},	/*Unicode: U+006a (j)*/
-  {.w_px = 13,	.glyph_index = 13230},	/*Unicode: U+006b (k)*/
-  {.w_px = 13,	.glyph_index = 13440},	/*Unicode: U+006c (l)*/
-  {.w_px = 13,	.glyph_index = 13650},	/*Unicode: U+006d (m)*/
-  {.w_px = 11,	.glyph_index = 13860},	/*Unicode: U+006e (n)*/
-  {.w_px = 12,	.glyph_index = 14040},	/*Unicode: U+006f (o)*/
-  {.w_px = 12,	.glyph_index = 14220},	/*Unicode: U+0070 (p)*/
-  {.w_px = 12,	.glyph_index = 14400},	/*Unicode: U+0071 (q)*/
-  {.w_px = 10,	.glyph_index = 14580},	/*Unicode: U+0072 (r)*/
-  {.w_px = 10,	.glyph_index = 14730},	/*Unicode: U+0073 (s)*/
-  {.w_px = 12,	.glyph_index = 14880},	/*Unicode: U+0074 (t)*/
-  {.w_px = 11,	.glyph_index = 15060},	/*Unicode: U+0075 (u)*/
-  {.w_px = 13,	.glyph_index = 15240},	/*Unicode: U+0076 (v)*/
-  {.w_px = 16,	.glyph_index = 15450},	/*Unicode: U+0077 (w)*/
-  {.w_px = 14,	.glyph_index = 15690},	/*Unicode: U+0078 (x)*/
-  {.w_px = 13,	.glyph_index = 15900},	/*Unicode: U+0079 (y)*/
-  {.w_px = 11,	.glyph_index = 16110},	/*Unicode: U+007a (z)*/
-  {.w_px = 11,	.glyph_index = 16290},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 16470},	/*Unicode: U+007c (|)*/
-  {.w_px = 11,	.glyph_index = 16500},	/*Unicode: U+007d (})*/
-  {.w_px = 13,	.glyph_index = 16680},	/*Unicode: U+007e (~)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+0021 (!)*/
+  {.w_px = 7,	.glyph_index = 42},	/*Unicode: U+0022 (")*/
+  {.w_px = 16,	.glyph_index = 75},	/*Unicode: U+0023 (#)*/
+  {.w_px = 11,	.glyph_index = 196},	/*Unicode: U+0024 ($)*/
+  {.w_px = 15,	.glyph_index = 327},	/*Unicode: U+0025 (%)*/
+  {.w_px = 15,	.glyph_index = 473},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 610},	/*Unicode: U+0027 (')*/
+  {.w_px = 6,	.glyph_index = 616},	/*Unicode: U+0028 (()*/
+  {.w_px = 6,	.glyph_index = 689},	/*Unicode: U+0029 ())*/
+  {.w_px = 11,	.glyph_index = 762},	/*Unicode: U+002a (*)*/
+  {.w_px = 14,	.glyph_index = 830},	/*Unicode: U+002b (+)*/
+  {.w_px = 4,	.glyph_index = 884},	/*Unicode: U+002c (,)*/
+  {.w_px = 7,	.glyph_index = 903},	/*Unicode: U+002d (-)*/
+  {.w_px = 3,	.glyph_index = 915},	/*Unicode: U+002e (.)*/
+  {.w_px = 13,	.glyph_index = 928},	/*Unicode: U+002f (/)*/
+  {.w_px = 12,	.glyph_index = 1045},	/*Unicode: U+0030 (0)*/
+  {.w_px = 11,	.glyph_index = 1162},	/*Unicode: U+0031 (1)*/
+  {.w_px = 13,	.glyph_index = 1263},	/*Unicode: U+0032 (2)*/
+  {.w_px = 12,	.glyph_index = 1378},	/*Unicode: U+0033 (3)*/
+  {.w_px = 13,	.glyph_index = 1483},	/*Unicode: U+0034 (4)*/
+  {.w_px = 12,	.glyph_index = 1597},	/*Unicode: U+0035 (5)*/
+  {.w_px = 12,	.glyph_index = 1701},	/*Unicode: U+0036 (6)*/
+  {.w_px = 12,	.glyph_index = 1815},	/*Unicode: U+0037 (7)*/
+  {.w_px = 12,	.glyph_index = 1917},	/*Unicode: U+0038 (8)*/
+  {.w_px = 12,	.glyph_index = 2032},	/*Unicode: U+0039 (9)*/
+  {.w_px = 3,	.glyph_index = 2146},	/*Unicode: U+003a (:)*/
+  {.w_px = 4,	.glyph_index = 2170},	/*Unicode: U+003b (;)*/
+  {.w_px = 13,	.glyph_index = 2200},	/*Unicode: U+003c (<)*/
+  {.w_px = 13,	.glyph_index = 2282},	/*Unicode: U+003d (=)*/
+  {.w_px = 13,	.glyph_index = 2304},	/*Unicode: U+003e (>)*/
+  {.w_px = 10,	.glyph_index = 2385},	/*Unicode: U+003f (?)*/
+  {.w_px = 15,	.glyph_index = 2473},	/*Unicode: U+0040 (@)*/
+  {.w_px = 15,	.glyph_index = 2640},	/*Unicode: U+0041 (A)*/
+  {.w_px = 12,	.glyph_index = 2783},	/*Unicode: U+0042 (B)*/
+  {.w_px = 12,	.glyph_index = 2896},	/*Unicode: U+0043 (C)*/
+  {.w_px = 12,	.glyph_index = 3000},	/*Unicode: U+0044 (D)*/
+  {.w_px = 12,	.glyph_index = 3115},	/*Unicode: U+0045 (E)*/
+  {.w_px = 12,	.glyph_index = 3194},	/*Unicode: U+0046 (F)*/
+  {.w_px = 13,	.glyph_index = 3279},	/*Unicode: U+0047 (G)*/
+  {.w_px = 12,	.glyph_index = 3402},	/*Unicode: U+0048 (H)*/
+  {.w_px = 11,	.glyph_index = 3510},	/*Unicode: U+0049 (I)*/
+  {.w_px = 11,	.glyph_index = 3606},	/*Unicode: U+004a (J)*/
+  {.w_px = 15,	.glyph_index = 3710},	/*Unicode: U+004b (K)*/
+  {.w_px = 12,	.glyph_index = 3861},	/*Unicode: U+004c (L)*/
+  {.w_px = 13,	.glyph_index = 3952},	/*Unicode: U+004d (M)*/
+  {.w_px = 12,	.glyph_index = 4090},	/*Unicode: U+004e (N)*/
+  {.w_px = 13,	.glyph_index = 4209},	/*Unicode: U+004f (O)*/
+  {.w_px = 12,	.glyph_index = 4344},	/*Unicode: U+0050 (P)*/
+  {.w_px = 13,	.glyph_index = 4447},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 14,	.glyph_index = 4598},	/*Unicode: U+0052 (R)*/
+  {.w_px = 12,	.glyph_index = 4731},	/*Unicode: U+0053 (S)*/
+  {.w_px = 15,	.glyph_index = 4839},	/*Unicode: U+0054 (T)*/
+  {.w_px = 12,	.glyph_index = 4936},	/*Unicode: U+0055 (U)*/
+  {.w_px = 14,	.glyph_index = 5053},	/*Unicode: U+0056 (V)*/
+  {.w_px = 16,	.glyph_index = 5185},	/*Unicode: U+0057 (W)*/
+  {.w_px = 15,	.glyph_index = 5336},	/*Unicode: U+0058 (X)*/
+  {.w_px = 15,	.glyph_index = 5483},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 13,	.glyph_index = 5607},	/*Unicode: U+005a (Z)*/
+  {.w_px = 6,	.glyph_index = 5716},	/*Unicode: U+005b ([)*/
+  {.w_px = 13,	.glyph_index = 5781},	/*Unicode: U+005c (\)*/
+  {.w_px = 6,	.glyph_index = 5898},	/*Unicode: U+005d (])*/
+  {.w_px = 14,	.glyph_index = 5963},	/*Unicode: U+005e (^)*/
+  {.w_px = 16,	.glyph_index = 6014},	/*Unicode: U+005f (_)*/
+  {.w_px = 6,	.glyph_index = 6020},	/*Unicode: U+0060 (`)*/
+  {.w_px = 12,	.glyph_index = 6040},	/*Unicode: U+0061 (a)*/
+  {.w_px = 12,	.glyph_index = 6124},	/*Unicode: U+0062 (b)*/
+  {.w_px = 11,	.glyph_index = 6242},	/*Unicode: U+0063 (c)*/
+  {.w_px = 12,	.glyph_index = 6323},	/*Unicode: U+0064 (d)*/
+  {.w_px = 13,	.glyph_index = 6439},	/*Unicode: U+0065 (e)*/
+  {.w_px = 12,	.glyph_index = 6527},	/*Unicode: U+0066 (f)*/
+  {.w_px = 12,	.glyph_index = 6626},	/*Unicode: U+0067 (g)*/
+  {.w_px = 11,	.glyph_index = 6740},	/*Unicode: U+0068 (h)*/
+  {.w_px = 13,	.glyph_index = 6859},	/*Unicode: U+0069 (i)*/
+  {.w_px = 8,	.glyph_index = 6948},	/*Unicode: U+006a (j)*/
+  {.w_px = 13,	.glyph_index = 7041},	/*Unicode: U+006b (k)*/
+  {.w_px = 13,	.glyph_index = 7171},	/*Unicode: U+006c (l)*/
+  {.w_px = 13,	.glyph_index = 7278},	/*Unicode: U+006d (m)*/
+  {.w_px = 11,	.glyph_index = 7381},	/*Unicode: U+006e (n)*/
+  {.w_px = 12,	.glyph_index = 7470},	/*Unicode: U+006f (o)*/
+  {.w_px = 12,	.glyph_index = 7557},	/*Unicode: U+0070 (p)*/
+  {.w_px = 12,	.glyph_index = 7668},	/*Unicode: U+0071 (q)*/
+  {.w_px = 10,	.glyph_index = 7781},	/*Unicode: U+0072 (r)*/
+  {.w_px = 10,	.glyph_index = 7852},	/*Unicode: U+0073 (s)*/
+  {.w_px = 12,	.glyph_index = 7925},	/*Unicode: U+0074 (t)*/
+  {.w_px = 11,	.glyph_index = 8015},	/*Unicode: U+0075 (u)*/
+  {.w_px = 13,	.glyph_index = 8104},	/*Unicode: U+0076 (v)*/
+  {.w_px = 16,	.glyph_index = 8202},	/*Unicode: U+0077 (w)*/
+  {.w_px = 14,	.glyph_index = 8314},	/*Unicode: U+0078 (x)*/
+  {.w_px = 13,	.glyph_index = 8413},	/*Unicode: U+0079 (y)*/
+  {.w_px = 11,	.glyph_index = 8538},	/*Unicode: U+007a (z)*/
+  {.w_px = 11,	.glyph_index = 8617},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 8752},	/*Unicode: U+007c (|)*/
+  {.w_px = 11,	.glyph_index = 8756},	/*Unicode: U+007d (})*/
+  {.w_px = 13,	.glyph_index = 8889},	/*Unicode: U+007e (~)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_30 == 8
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
-  {.w_px = 3,	.glyph_index = 240},	/*Unicode: U+0021 (!)*/
-  {.w_px = 7,	.glyph_index = 330},	/*Unicode: U+0022 (")*/
-  {.w_px = 16,	.glyph_index = 540},	/*Unicode: U+0023 (#)*/
-  {.w_px = 11,	.glyph_index = 1020},	/*Unicode: U+0024 ($)*/
-  {.w_px = 15,	.glyph_index = 1350},	/*Unicode: U+0025 (%)*/
-  {.w_px = 15,	.glyph_index = 1800},	/*Unicode: U+0026 (&)*/
-  {.w_px = 2,	.glyph_index = 2250},	/*Unicode: U+0027 (')*/
-  {.w_px = 6,	.glyph_index = 2310},	/*Unicode: U+0028 (()*/
-  {.w_px = 6,	.glyph_index = 2490},	/*Unicode: U+0029 ())*/
-  {.w_px = 11,	.glyph_index = 2670},	/*Unicode: U+002a (*)*/
-  {.w_px = 14,	.glyph_index = 3000},	/*Unicode: U+002b (+)*/
-  {.w_px = 4,	.glyph_index = 3420},	/*Unicode: U+002c (,)*/
-  {.w_px = 7,	.glyph_index = 3540},	/*Unicode: U+002d (-)*/
-  {.w_px = 3,	.glyph_index = 3750},	/*Unicode: U+002e (.)*/
-  {.w_px = 13,	.glyph_index = 3840},	/*Unicode: U+002f (/)*/
-  {.w_px = 12,	.glyph_index = 4230},	/*Unicode: U+0030 (0)*/
-  {.w_px = 11,	.glyph_index = 4590},	/*Unicode: U+0031 (1)*/
-  {.w_px = 13,	.glyph_index = 4920},	/*Unicode: U+0032 (2)*/
-  {.w_px = 12,	.glyph_index = 5310},	/*Unicode: U+0033 (3)*/
-  {.w_px = 13,	.glyph_index = 5670},	/*Unicode: U+0034 (4)*/
-  {.w_px = 12,	.glyph_index = 6060},	/*Unicode: U+0035 (5)*/
-  {.w_px = 12,	.glyph_index = 6420},	/*Unicode: U+0036 (6)*/
-  {.w_px = 12,	.glyph_index = 6780},	/*Unicode: U+0037 (7)*/
-  {.w_px = 12,	.glyph_index = 7140},	/*Unicode: U+0038 (8)*/
-  {.w_px = 12,	.glyph_index = 7500},	/*Unicode: U+0039 (9)*/
-  {.w_px = 3,	.glyph_index = 7860},	/*Unicode: U+003a (:)*/
-  {.w_px = 4,	.glyph_index = 7950},	/*Unicode: U+003b (;)*/
-  {.w_px = 13,	.glyph_index = 8070},	/*Unicode: U+003c (<)*/
-  {.w_px = 13,	.glyph_index = 8460},	/*Unicode: U+003d (=)*/
-  {.w_px = 13,	.glyph_index = 8850},	/*Unicode: U+003e (>)*/
-  {.w_px = 10,	.glyph_index = 9240},	/*Unicode: U+003f (?)*/
-  {.w_px = 15,	.glyph_index = 9540},	/*Unicode: U+0040 (@)*/
-  {.w_px = 15,	.glyph_index = 9990},	/*Unicode: U+0041 (A)*/
-  {.w_px = 12,	.glyph_index = 10440},	/*Unicode: U+0042 (B)*/
-  {.w_px = 12,	.glyph_index = 10800},	/*Unicode: U+0043 (C)*/
-  {.w_px = 12,	.glyph_index = 11160},	/*Unicode: U+0044 (D)*/
-  {.w_px = 12,	.glyph_index = 11520},	/*Unicode: U+0045 (E)*/
-  {.w_px = 12,	.glyph_index = 11880},	/*Unicode: U+0046 (F)*/
-  {.w_px = 13,	.glyph_index = 12240},	/*Unicode: U+0047 (G)*/
-  {.w_px = 12,	.glyph_index = 12630},	/*Unicode: U+0048 (H)*/
-  {.w_px = 11,	.glyph_index = 12990},	/*Unicode: U+0049 (I)*/
-  {.w_px = 11,	.glyph_index = 13320},	/*Unicode: U+004a (J)*/
-  {.w_px = 15,	.glyph_index = 13650},	/*Unicode: U+004b (K)*/
-  {.w_px = 12,	.glyph_index = 14100},	/*Unicode: U+004c (L)*/
-  {.w_px = 13,	.glyph_index = 14460},	/*Unicode: U+004d (M)*/
-  {.w_px = 12,	.glyph_index = 14850},	/*Unicode: U+004e (N)*/
-  {.w_px = 13,	.glyph_index = 15210},	/*Unicode: U+004f (O)*/
-  {.w_px = 12,	.glyph_index = 15600},	/*Unicode: U+0050 (P)*/
-  {.w_px = 13,	.glyph_index = 15960},	/*Unicode: U+0051 (Q)*/
-  {.w_px = 14,	.glyph_index = 16350},	/*Unicode: U+0052 (R)*/
-  {.w_px = 12,	.glyph_index = 16770},	/*Unicode: U+0053 (S)*/
-  {.w_px = 15,	.glyph_index = 17130},	/*Unicode: U+0054 (T)*/
-  {.w_px = 12,	.glyph_index = 17580},	/*Unicode: U+0055 (U)*/
-  {.w_px = 14,	.glyph_index = 17940},	/*Unicode: U+0056 (V)*/
-  {.w_px = 16,	.glyph_index = 18360},	/*Unicode: U+0057 (W)*/
-  {.w_px = 15,	.glyph_index = 18840},	/*Unicode: U+0058 (X)*/
-  {.w_px = 15,	.glyph_index = 19290},	/*Unicode: U+0059 (Y)*/
-  {.w_px = 13,	.glyph_index = 19740},	/*Unicode: U+005a (Z)*/
-  {.w_px = 6,	.glyph_index = 20130},	/*Unicode: U+005b ([)*/
-  {.w_px = 13,	.glyph_index = 20310},	/*Unicode: U+005c (\)*/
-  {.w_px = 6,	.glyph_index = 20700},	/*Unicode: U+005d (])*/
-  {.w_px = 14,	.glyph_index = 20880},	/*Unicode: U+005e (^)*/
-  {.w_px = 16,	.glyph_index = 21300},	/*Unicode: U+005f (_)*/
-  {.w_px = 6,	.glyph_index = 21780},	/*Unicode: U+0060 (`)*/
-  {.w_px = 12,	.glyph_index = 21960},	/*Unicode: U+0061 (a)*/
-  {.w_px = 12,	.glyph_index = 22320},	/*Unicode: U+0062 (b)*/
-  {.w_px = 11,	.glyph_index = 22680},	/*Unicode: U+0063 (c)*/
-  {.w_px = 12,	.glyph_index = 23010},	/*Unicode: U+0064 (d)*/
-  {.w_px = 13,	.glyph_index = 23370},	/*Unicode: U+0065 (e)*/
-  {.w_px = 12,	.glyph_index = 23760},	/*Unicode: U+0066 (f)*/
-  {.w_px = 12,	.glyph_index = 24120},	/*Unicode: U+0067 (g)*/
-  {.w_px = 11,	.glyph_index = 24480},	/*Unicode: U+0068 (h)*/
-  {.w_px = 13,	.glyph_index = 24810},	/*Unicode: U+0069 (i)*/
-  {.w_px = 8,	.glyph_index = 25200},	/*Unicode: U+006a (j)*/
-  {.w_px = 13,	.glyph_index = 25440},	/*Unicode: U+006b (k)*/
-  {.w_px = 13,	.glyph_index = 25830},	/*Unicode: U+006c (l)*/
-  {.w_px = 13,	.glyph_index = 26220},	/*Unicode: U+006d (m)*/
-  {.w_px = 11,	.glyph_index = 26610},	/*Unicode: U+006e (n)*/
-  {.w_px = 12,	.glyph_index = 26940},	/*Unicode: U+006f (o)*/
-  {.w_px = 12,	.glyph_index = 27300},	/*Unicode: U+0070 (p)*/
-  {.w_px = 12,	.glyph_index = 27660},	/*Unicode: U+0071 (q)*/
-  {.w_px = 10,	.glyph_index = 28020},	/*Unicode: U+0072 (r)*/
-  {.w_px = 10,	.glyph_index = 28320},	/*Unicode: U+0073 (s)*/
-  {.w_px = 12,	.glyph_index = 28620},	/*Unicode: U+0074 (t)*/
-  {.w_px = 11,	.glyph_index = 28980},	/*Unicode: U+0075 (u)*/
-  {.w_px = 13,	.glyph_index = 29310},	/*Unicode: U+0076 (v)*/
-  {.w_px = 16,	.glyph_index = 29700},	/*Unicode: U+0077 (w)*/
-  {.w_px = 14,	.glyph_index = 30180},	/*Unicode: U+0078 (x)*/
-  {.w_px = 13,	.glyph_index = 30600},	/*Unicode: U+0079 (y)*/
-  {.w_px = 11,	.glyph_index = 30990},	/*Unicode: U+007a (z)*/
-  {.w_px = 11,	.glyph_index = 31320},	/*Unicode: U+007b ({)*/
-  {.w_px = 2,	.glyph_index = 31650},	/*Unicode: U+007c (|)*/
-  {.w_px = 11,	.glyph_index = 31710},	/*Unicode: U+007d (})*/
-  {.w_px = 13,	.glyph_index = 32040},	/*Unicode: U+007e (~)*/
+  {.w_px = 3,	.glyph_index = 4},	/*Unicode: U+0021 (!)*/
+  {.w_px = 7,	.glyph_index = 30},	/*Unicode: U+0022 (")*/
+  {.w_px = 16,	.glyph_index = 66},	/*Unicode: U+0023 (#)*/
+  {.w_px = 11,	.glyph_index = 251},	/*Unicode: U+0024 ($)*/
+  {.w_px = 15,	.glyph_index = 443},	/*Unicode: U+0025 (%)*/
+  {.w_px = 15,	.glyph_index = 661},	/*Unicode: U+0026 (&)*/
+  {.w_px = 2,	.glyph_index = 886},	/*Unicode: U+0027 (')*/
+  {.w_px = 6,	.glyph_index = 892},	/*Unicode: U+0028 (()*/
+  {.w_px = 6,	.glyph_index = 1031},	/*Unicode: U+0029 ())*/
+  {.w_px = 11,	.glyph_index = 1170},	/*Unicode: U+002a (*)*/
+  {.w_px = 14,	.glyph_index = 1276},	/*Unicode: U+002b (+)*/
+  {.w_px = 4,	.glyph_index = 1344},	/*Unicode: U+002c (,)*/
+  {.w_px = 7,	.glyph_index = 1374},	/*Unicode: U+002d (-)*/
+  {.w_px = 3,	.glyph_index = 1380},	/*Unicode: U+002e (.)*/
+  {.w_px = 13,	.glyph_index = 1386},	/*Unicode: U+002f (/)*/
+  {.w_px = 12,	.glyph_index = 1540},	/*Unicode: U+0030 (0)*/
+  {.w_px = 11,	.glyph_index = 1751},	/*Unicode: U+0031 (1)*/
+  {.w_px = 13,	.glyph_index = 1836},	/*Unicode: U+0032 (2)*/
+  {.w_px = 12,	.glyph_index = 1998},	/*Unicode: U+0033 (3)*/
+  {.w_px = 13,	.glyph_index = 2159},	/*Unicode: U+0034 (4)*/
+  {.w_px = 12,	.glyph_index = 2291},	/*Unicode: U+0035 (5)*/
+  {.w_px = 12,	.glyph_index = 2428},	/*Unicode: U+0036 (6)*/
+  {.w_px = 12,	.glyph_index = 2623},	/*Unicode: U+0037 (7)*/
+  {.w_px = 12,	.glyph_index = 2757},	/*Unicode: U+0038 (8)*/
+  {.w_px = 12,	.glyph_index = 2967},	/*Unicode: U+0039 (9)*/
+  {.w_px = 3,	.glyph_index = 3162},	/*Unicode: U+003a (:)*/
+  {.w_px = 4,	.glyph_index = 3172},	/*Unicode: U+003b (;)*/
+  {.w_px = 13,	.glyph_index = 3218},	/*Unicode: U+003c (<)*/
+  {.w_px = 13,	.glyph_index = 3340},	/*Unicode: U+003d (=)*/
+  {.w_px = 13,	.glyph_index = 3354},	/*Unicode: U+003e (>)*/
+  {.w_px = 10,	.glyph_index = 3476},	/*Unicode: U+003f (?)*/
+  {.w_px = 15,	.glyph_index = 3597},	/*Unicode: U+0040 (@)*/
+  {.w_px = 15,	.glyph_index = 3865},	/*Unicode: U+0041 (A)*/
+  {.w_px = 12,	.glyph_index = 4072},	/*Unicode: U+0042 (B)*/
+  {.w_px = 12,	.glyph_index = 4253},	/*Unicode: U+0043 (C)*/
+  {.w_px = 12,	.glyph_index = 4410},	/*Unicode: U+0044 (D)*/
+  {.w_px = 12,	.glyph_index = 4588},	/*Unicode: U+0045 (E)*/
+  {.w_px = 12,	.glyph_index = 4654},	/*Unicode: U+0046 (F)*/
+  {.w_px = 13,	.glyph_index = 4724},	/*Unicode: U+0047 (G)*/
+  {.w_px = 12,	.glyph_index = 4901},	/*Unicode: U+0048 (H)*/
+  {.w_px = 11,	.glyph_index = 4975},	/*Unicode: U+0049 (I)*/
+  {.w_px = 11,	.glyph_index = 5045},	/*Unicode: U+004a (J)*/
+  {.w_px = 15,	.glyph_index = 5149},	/*Unicode: U+004b (K)*/
+  {.w_px = 12,	.glyph_index = 5364},	/*Unicode: U+004c (L)*/
+  {.w_px = 13,	.glyph_index = 5438},	/*Unicode: U+004d (M)*/
+  {.w_px = 12,	.glyph_index = 5588},	/*Unicode: U+004e (N)*/
+  {.w_px = 13,	.glyph_index = 5739},	/*Unicode: U+004f (O)*/
+  {.w_px = 12,	.glyph_index = 5949},	/*Unicode: U+0050 (P)*/
+  {.w_px = 13,	.glyph_index = 6081},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 14,	.glyph_index = 6311},	/*Unicode: U+0052 (R)*/
+  {.w_px = 12,	.glyph_index = 6517},	/*Unicode: U+0053 (S)*/
+  {.w_px = 15,	.glyph_index = 6688},	/*Unicode: U+0054 (T)*/
+  {.w_px = 12,	.glyph_index = 6762},	/*Unicode: U+0055 (U)*/
+  {.w_px = 14,	.glyph_index = 6889},	/*Unicode: U+0056 (V)*/
+  {.w_px = 16,	.glyph_index = 7104},	/*Unicode: U+0057 (W)*/
+  {.w_px = 15,	.glyph_index = 7379},	/*Unicode: U+0058 (X)*/
+  {.w_px = 15,	.glyph_index = 7611},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 13,	.glyph_index = 7775},	/*Unicode: U+005a (Z)*/
+  {.w_px = 6,	.glyph_index = 7903},	/*Unicode: U+005b ([)*/
+  {.w_px = 13,	.glyph_index = 7985},	/*Unicode: U+005c (\)*/
+  {.w_px = 6,	.glyph_index = 8139},	/*Unicode: U+005d (])*/
+  {.w_px = 14,	.glyph_index = 8221},	/*Unicode: U+005e (^)*/
+  {.w_px = 16,	.glyph_index = 8303},	/*Unicode: U+005f (_)*/
+  {.w_px = 6,	.glyph_index = 8313},	/*Unicode: U+0060 (`)*/
+  {.w_px = 12,	.glyph_index = 8350},	/*Unicode: U+0061 (a)*/
+  {.w_px = 12,	.glyph_index = 8490},	/*Unicode: U+0062 (b)*/
+  {.w_px = 11,	.glyph_index = 8672},	/*Unicode: U+0063 (c)*/
+  {.w_px = 12,	.glyph_index = 8793},	/*Unicode: U+0064 (d)*/
+  {.w_px = 13,	.glyph_index = 8975},	/*Unicode: U+0065 (e)*/
+  {.w_px = 12,	.glyph_index = 9112},	/*Unicode: U+0066 (f)*/
+  {.w_px = 12,	.glyph_index = 9208},	/*Unicode: U+0067 (g)*/
+  {.w_px = 11,	.glyph_index = 9411},	/*Unicode: U+0068 (h)*/
+  {.w_px = 13,	.glyph_index = 9538},	/*Unicode: U+0069 (i)*/
+  {.w_px = 8,	.glyph_index = 9604},	/*Unicode: U+006a (j)*/
+  {.w_px = 13,	.glyph_index = 9708},	/*Unicode: U+006b (k)*/
+  {.w_px = 13,	.glyph_index = 9885},	/*Unicode: U+006c (l)*/
+  {.w_px = 13,	.glyph_index = 9985},	/*Unicode: U+006d (m)*/
+  {.w_px = 11,	.glyph_index = 10151},	/*Unicode: U+006e (n)*/
+  {.w_px = 12,	.glyph_index = 10254},	/*Unicode: U+006f (o)*/
+  {.w_px = 12,	.glyph_index = 10409},	/*Unicode: U+0070 (p)*/
+  {.w_px = 12,	.glyph_index = 10587},	/*Unicode: U+0071 (q)*/
+  {.w_px = 10,	.glyph_index = 10765},	/*Unicode: U+0072 (r)*/
+  {.w_px = 10,	.glyph_index = 10845},	/*Unicode: U+0073 (s)*/
+  {.w_px = 12,	.glyph_index = 10961},	/*Unicode: U+0074 (t)*/
+  {.w_px = 11,	.glyph_index = 11050},	/*Unicode: U+0075 (u)*/
+  {.w_px = 13,	.glyph_index = 11153},	/*Unicode: U+0076 (v)*/
+  {.w_px = 16,	.glyph_index = 11311},	/*Unicode: U+0077 (w)*/
+  {.w_px = 14,	.glyph_index = 11512},	/*Unicode: U+0078 (x)*/
+  {.w_px = 13,	.glyph_index = 11676},	/*Unicode: U+0079 (y)*/
+  {.w_px = 11,	.glyph_index = 11866},	/*Unicode: U+007a (z)*/
+  {.w_px = 11,	.glyph_index = 11958},	/*Unicode: U+007b ({)*/
+  {.w_px = 2,	.glyph_index = 12124},	/*Unicode: U+007c (|)*/
+  {.w_px = 11,	.glyph_index = 12128},	/*Unicode: U+007d (})*/
+  {.w_px = 13,	.glyph_index = 12294},	/*Unicode: U+007e (~)*/
 
 #endif
 };
@@ -12978,6 +3240,7 @@ lv_font_t pros_font_dejavu_mono_30 =
 #endif
     .monospace = 16,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO_30*/
@@ -12,5003 +12,1317 @@ static const uint8_t pros_font_dejavu_mono_latin_sup_10_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 1
   /*Unicode: U+00a0 ( ) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf7, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 1 */
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0x80, 0x00, 0xfd, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x40,  //.%.
-  0xe0,  //%%%
-  0xc0,  //%%.
-  0xc0,  //%%.
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x00,  //...
-  0x00,  //...
-
+  0x09, 0x00, 0x00, 0x40, 0xe0, 0xc0, 0xc0, 0xe0, 0x40, 0x00, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 4 */
-  0x00,  //....
-  0x30,  //..%%
-  0x40,  //.%..
-  0x40,  //.%..
-  0xe0,  //%%%.
-  0x40,  //.%..
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x30, 0x40, 0x40, 0xe0, 0x40, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xa0,  //%.%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x02, 0xe0, 0xa0, 0xe0, 0xfd, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 5 */
-  0x00,  //.....
-  0x88,  //%...%
-  0x50,  //.%.%.
-  0xf8,  //%%%%%
-  0x20,  //..%..
-  0xf8,  //%%%%%
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x88, 0x50, 0xf8, 0x20, 0xf8, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 1 */
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x80,  //%
-  0x80,  //%
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0x80,  //%..
-  0xc0,  //%%.
-  0xa0,  //%.%
-  0x40,  //.%.
-  0x20,  //..%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-
+  0x09, 0x00, 0xe0, 0x80, 0xc0, 0xa0, 0x40, 0x20, 0xe0, 0x00, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 3 */
-  0x00,  //...
-  0xa0,  //%.%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xa0, 0xf9, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x70,  //.%%%.
-  0xb8,  //%.%%%
-  0xb8,  //%.%%%
-  0x88,  //%...%
-  0x70,  //.%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x00, 0x70, 0xb8, 0xb8, 0x88, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 4 */
-  0x00,  //....
-  0xe0,  //%%%.
-  0xe0,  //%%%.
-  0xe0,  //%%%.
-  0x00,  //....
-  0xe0,  //%%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfe, 0xe0, 0x01, 0x00, 0xe0, 0xfd, 0x00,
 
   /*Unicode: U+00ab («) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x50,  //.%.%
-  0xa0,  //%.%.
-  0xa0,  //%.%.
-  0x50,  //.%.%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x50, 0xa0, 0xa0, 0x50, 0xfe, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x10,  //...%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfd, 0x00, 0x01, 0xf0, 0x10, 0xfd, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xc0, 0xfc, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x70,  //.%%%.
-  0xb8,  //%.%%%
-  0xb8,  //%.%%%
-  0x98,  //%..%%
-  0x70,  //.%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x00, 0x70, 0xb8, 0xb8, 0x98, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 2 */
-  0x00,  //..
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 2 */
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x02, 0x00, 0xc0, 0xc0, 0xfa, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x20,  //..%..
-  0xf8,  //%%%%%
-  0x20,  //..%..
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x03, 0x20, 0xf8, 0x20, 0xf8, 0xfe, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 2 */
-  0x00,  //..
-  0xc0,  //%%
-  0x00,  //..
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xc0, 0x00, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 2 */
-  0x00,  //..
-  0xc0,  //%%
-  0x40,  //.%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xc0, 0x40, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf7, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x90,  //%..%.
-  0x90,  //%..%.
-  0x90,  //%..%.
-  0xf8,  //%%%%%
-  0x80,  //%....
-  0x80,  //%....
-  0x00,  //.....
-
+  0xfe, 0x00, 0xfe, 0x90, 0x03, 0xf8, 0x80, 0x80, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0xd0,  //%%.%
-  0xd0,  //%%.%
-  0x50,  //.%.%
-  0x50,  //.%.%
-  0x50,  //.%.%
-  0x50,  //.%.%
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0xf0, 0xd0, 0xd0, 0xfd, 0x50, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x80,  //%
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfd, 0x00, 0x00, 0x80, 0xfc, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x40,  //.%
-  0xc0,  //%%
-  0x00,  //..
-
+  0xfa, 0x00, 0x02, 0x40, 0xc0, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 3 */
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x03, 0x00, 0xc0, 0x40, 0xe0, 0xfb, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0xa0,  //%.%
-  0xe0,  //%%%
-  0x00,  //...
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x05, 0x00, 0xe0, 0xa0, 0xe0, 0x00, 0xe0, 0xfd, 0x00,
 
   /*Unicode: U+00bb (») , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xa0,  //%.%.
-  0x50,  //.%.%
-  0x50,  //.%.%
-  0xa0,  //%.%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xa0, 0x50, 0x50, 0xa0, 0xfe, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 4 */
-  0xc0,  //%%..
-  0x40,  //.%..
-  0xe0,  //%%%.
-  0x00,  //....
-  0x30,  //..%%
-  0xd0,  //%%.%
-  0x30,  //..%%
-  0x10,  //...%
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xc0, 0x40, 0xe0, 0x00, 0x30, 0xd0, 0x30, 0x10, 0x00, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 4 */
-  0xc0,  //%%..
-  0x40,  //.%..
-  0xe0,  //%%%.
-  0x00,  //....
-  0x30,  //..%%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x30,  //..%%
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xc0, 0x40, 0xe0, 0x00, 0x30, 0xf0, 0x00, 0x30, 0x00, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 4 */
-  0xc0,  //%%..
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-  0x30,  //..%%
-  0xd0,  //%%.%
-  0x30,  //..%%
-  0x10,  //...%
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xc0, 0x40, 0xc0, 0x00, 0x30, 0xd0, 0x30, 0x10, 0x00, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 3 */
-  0x00,  //...
-  0x40,  //.%.
-  0x00,  //...
-  0x40,  //.%.
-  0x40,  //.%.
-  0xc0,  //%%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x40, 0x00, 0x40, 0x40, 0xc0, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfd, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfd, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfd, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 4 */
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfc, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 4 */
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfc, 0x60, 0x01, 0xf0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 4 */
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x60, 0x00, 0x00, 0xfe, 0x60, 0x00, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x70,  //.%%%
-  0xe0,  //%%%.
-  0xb0,  //%.%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x70, 0x60, 0x60, 0x70, 0xe0, 0xb0, 0xfe, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 4 */
-  0x00,  //....
-  0x70,  //.%%%
-  0xc0,  //%%..
-  0x80,  //%...
-  0x80,  //%...
-  0xc0,  //%%..
-  0x70,  //.%%%
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-
+  0x09, 0x00, 0x70, 0xc0, 0x80, 0x80, 0xc0, 0x70, 0x40, 0xc0, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 4 */
-  0x00,  //....
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 4 */
-  0xa0,  //%.%.
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0xa0, 0xf0, 0x80, 0x80, 0xf0, 0x80, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xe0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 3 */
-  0x00,  //...
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xe0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 3 */
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x40, 0xe0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 3 */
-  0xa0,  //%.%
-  0xe0,  //%%%
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0xa0, 0xe0, 0xfd, 0x40, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 5 */
-  0x00,  //.....
-  0x70,  //.%%%.
-  0x48,  //.%..%
-  0x48,  //.%..%
-  0xe8,  //%%%.%
-  0x48,  //.%..%
-  0x70,  //.%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x70, 0x48, 0x48, 0xe8, 0x48, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 4 */
-  0x60,  //.%%.
-  0x90,  //%..%
-  0xd0,  //%%.%
-  0xd0,  //%%.%
-  0xb0,  //%.%%
-  0xb0,  //%.%%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x60, 0x90, 0xd0, 0xd0, 0xb0, 0xb0, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x00, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 4 */
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x60, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 4 */
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x01, 0x60, 0x60, 0xfd, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x90, 0x60, 0x60, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 6 */
-  0x00,  //......
-  0x30,  //..%%..
-  0x48,  //.%..%.
-  0x48,  //.%..%.
-  0x48,  //.%..%.
-  0x48,  //.%..%.
-  0x30,  //..%%..
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0x01, 0x00, 0x30, 0xfd, 0x48, 0x00, 0x30, 0xfe, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfc, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 4 */
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x60, 0xfc, 0x90, 0x00, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 5 */
-  0x00,  //.....
-  0x88,  //%...%
-  0x50,  //.%.%.
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x02, 0x00, 0x88, 0x50, 0xfd, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 4 */
-  0x00,  //....
-  0x80,  //%...
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x80,  //%...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x80, 0xf0, 0x90, 0xf0, 0x80, 0x80, 0xfe, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 4 */
-  0x60,  //.%%.
-  0x90,  //%..%
-  0xa0,  //%.%.
-  0xa0,  //%.%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0xb0,  //%.%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x60, 0x90, 0xa0, 0xa0, 0x90, 0x90, 0xb0, 0xfe, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 4 */
-  0x00,  //....
-  0x40,  //.%..
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x40, 0x00, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 4 */
-  0x00,  //....
-  0xa0,  //%.%.
-  0xa0,  //%.%.
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xa0, 0xa0, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 4 */
-  0x00,  //....
-  0xa0,  //%.%.
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xa0, 0x00, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 4 */
-  0xc0,  //%%..
-  0xc0,  //%%..
-  0x00,  //....
-  0xf0,  //%%%%
-  0x70,  //.%%%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0xc0, 0xc0, 0x00, 0xf0, 0x70, 0x90, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xf0,  //%%%%
-  0xf0,  //%%%%
-  0xc0,  //%%..
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xf0, 0xf0, 0xc0, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x80,  //%..
-  0x80,  //%..
-  0x60,  //.%%
-  0x40,  //.%.
-  0xc0,  //%%.
-  0x00,  //...
-
+  0xfe, 0x00, 0x06, 0x60, 0x80, 0x80, 0x60, 0x40, 0xc0, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x70, 0xf0, 0x80, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x70,  //.%%%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x70, 0xf0, 0x80, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 4 */
-  0x00,  //....
-  0x40,  //.%..
-  0x00,  //....
-  0x70,  //.%%%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x40, 0x00, 0x70, 0xf0, 0x80, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 4 */
-  0x00,  //....
-  0xa0,  //%.%.
-  0x00,  //....
-  0x70,  //.%%%
-  0xf0,  //%%%%
-  0x80,  //%...
-  0x70,  //.%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xa0, 0x00, 0x70, 0xf0, 0x80, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x03, 0xc0, 0x40, 0x40, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x03, 0xc0, 0x40, 0x40, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 3 */
-  0x00,  //...
-  0x40,  //.%.
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x40, 0x00, 0xc0, 0x40, 0x40, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 3 */
-  0x00,  //...
-  0xa0,  //%.%
-  0x00,  //...
-  0xc0,  //%%.
-  0x40,  //.%.
-  0x40,  //.%.
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0xa0, 0x00, 0xc0, 0x40, 0x40, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 4 */
-  0x40,  //.%..
-  0x60,  //.%%.
-  0x20,  //..%.
-  0x70,  //.%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x40, 0x60, 0x20, 0x70, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 4 */
-  0x00,  //....
-  0xa0,  //%.%.
-  0xa0,  //%.%.
-  0xf0,  //%%%%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0xa0, 0xa0, 0xf0, 0xfe, 0x90, 0xfe, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x60, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x60, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x60, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 4 */
-  0x00,  //....
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x00, 0xfe, 0x60, 0x02, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x00,  //....
-  0x60,  //.%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x90, 0x00, 0x60, 0x90, 0x90, 0x60, 0xfe, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x20,  //..%..
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x20,  //..%..
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0x06, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x00, 0x20, 0xfe, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x38,  //..%%%.
-  0x58,  //.%.%%.
-  0x68,  //.%%.%.
-  0x70,  //.%%%..
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfe, 0x00, 0x03, 0x38, 0x58, 0x68, 0x70, 0xfe, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0xfe, 0x90, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0xfe, 0x90, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0xfe, 0x90, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 4 */
-  0x00,  //....
-  0x90,  //%..%
-  0x00,  //....
-  0x90,  //%..%
-  0x90,  //%..%
-  0x90,  //%..%
-  0xf0,  //%%%%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x90, 0x00, 0xfe, 0x90, 0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x40,  //.%..
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-
+  0xfe, 0x00, 0x06, 0x90, 0x60, 0x60, 0x40, 0x40, 0xc0, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 4 */
-  0x80,  //%...
-  0x80,  //%...
-  0x80,  //%...
-  0xe0,  //%%%.
-  0x90,  //%..%
-  0x90,  //%..%
-  0xe0,  //%%%.
-  0x80,  //%...
-  0x80,  //%...
-  0x00,  //....
-
+  0xfe, 0x80, 0x06, 0xe0, 0x90, 0x90, 0xe0, 0x80, 0x80, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 4 */
-  0x00,  //....
-  0xa0,  //%.%.
-  0x00,  //....
-  0x90,  //%..%
-  0x60,  //.%%.
-  0x60,  //.%%.
-  0x40,  //.%..
-  0x40,  //.%..
-  0xc0,  //%%..
-  0x00,  //....
-
-
+  0x09, 0x00, 0xa0, 0x00, 0x90, 0x60, 0x60, 0x40, 0x40, 0xc0, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 2
   /*Unicode: U+00a0 ( ) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf7, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 1 */
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x02, 0x00, 0xc0, 0x00, 0xfd, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x30,  //.@.
-  0xbc,  //%@@
-  0xf0,  //@@.
-  0xf0,  //@@.
-  0xbc,  //%@@
-  0x30,  //.@.
-  0x00,  //...
-  0x00,  //...
-
+  0x09, 0x00, 0x00, 0x30, 0xbc, 0xf0, 0xf0, 0xbc, 0x30, 0x00, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 4 */
-  0x00,  //....
-  0x1f,  //.+@@
-  0x30,  //.@..
-  0x30,  //.@..
-  0xfc,  //@@@.
-  0x30,  //.@..
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x1f, 0x30, 0x30, 0xfc, 0x30, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xb8,  //%@%
-  0xdc,  //@+@
-  0xb8,  //%@%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfe, 0x00, 0x02, 0xb8, 0xdc, 0xb8, 0xfd, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x91, 0x80,  //%+.+%
-  0x33, 0x00,  //.@.@.
-  0xff, 0xc0,  //@@@@@
-  0x0c, 0x00,  //..@..
-  0xff, 0xc0,  //@@@@@
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0x91, 0x80, 0x33, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 1 */
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0xc0,  //@
-  0xc0,  //@
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfe, 0xc0, 0x00, 0x00, 0xfe, 0xc0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 3 */
-  0x00,  //...
-  0xbc,  //%@@
-  0xc0,  //@..
-  0xa4,  //%%+
-  0xcc,  //@.@
-  0x24,  //.%+
-  0x0c,  //..@
-  0xf8,  //@@%
-  0x00,  //...
-  0x00,  //...
-
+  0x09, 0x00, 0xbc, 0xc0, 0xa4, 0xcc, 0x24, 0x0c, 0xf8, 0x00, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 3 */
-  0x00,  //...
-  0xcc,  //@.@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x00, 0xcc, 0xf9, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x2e, 0x00,  //.%@%.
-  0x9f, 0x80,  //%+@@%
-  0xcb, 0xc0,  //@.%@@
-  0x91, 0x80,  //%+.+%
-  0x2e, 0x00,  //.%@%.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfd, 0x00, 0x08, 0x2e, 0x00, 0x9f, 0x80, 0xcb, 0xc0, 0x91, 0x80, 0x2e, 0xfa, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 4 */
-  0x00,  //....
-  0xf8,  //@@%.
-  0xbc,  //%@@.
-  0xec,  //@%@.
-  0x00,  //....
-  0xfc,  //@@@.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x05, 0x00, 0xf8, 0xbc, 0xec, 0x00, 0xfc, 0xfd, 0x00,
 
   /*Unicode: U+00ab («) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x22,  //.%.%
-  0x99,  //%+%+
-  0x99,  //%+%+
-  0x22,  //.%.%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x22, 0x99, 0x99, 0x22, 0xfe, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xff,  //@@@@
-  0x03,  //...@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfd, 0x00, 0x01, 0xff, 0x03, 0xfd, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xf0, 0xfc, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x2e, 0x00,  //.%@%.
-  0x9f, 0x80,  //%+@@%
-  0xce, 0xc0,  //@.@%@
-  0x93, 0xc0,  //%+.@@
-  0x2e, 0x00,  //.%@%.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfd, 0x00, 0x08, 0x2e, 0x00, 0x9f, 0x80, 0xce, 0xc0, 0x93, 0xc0, 0x2e, 0xfa, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 2 */
-  0x00,  //..
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0xf0, 0xf9, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 2 */
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x02, 0x00, 0xf0, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x0c, 0x00,  //..@..
-  0xff, 0xc0,  //@@@@@
-  0x0c, 0x00,  //..@..
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x07, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0xff, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 2 */
-  0x00,  //..
-  0xe0,  //@%
-  0x50,  //++
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xe0, 0x50, 0xf0, 0xfb, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 2 */
-  0x00,  //..
-  0xf0,  //@@
-  0x20,  //.%
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xf0, 0x20, 0xf0, 0xfb, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 2 */
-  0x00,  //..
-  0x50,  //++
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0x50, 0xf9, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xc3, 0x00,  //@..@.
-  0xc3, 0x00,  //@..@.
-  0xc3, 0x00,  //@..@.
-  0xfe, 0xc0,  //@@@%@
-  0xc0, 0x00,  //@....
-  0xc0, 0x00,  //@....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0a, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xfe, 0xc0, 0xc0, 0x00, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 4 */
-  0x00,  //....
-  0xbf,  //%@@@
-  0xf3,  //@@.@
-  0xb3,  //%@.@
-  0x33,  //.@.@
-  0x33,  //.@.@
-  0x33,  //.@.@
-  0x33,  //.@.@
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0xbf, 0xf3, 0xb3, 0xfd, 0x33, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xc0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfd, 0x00, 0x00, 0xc0, 0xfc, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x30,  //.@
-  0xf0,  //@@
-  0x00,  //..
-
+  0xfa, 0x00, 0x02, 0x30, 0xf0, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 3 */
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x03, 0x00, 0xf0, 0x30, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 3 */
-  0x00,  //...
-  0xb8,  //%@%
-  0xdc,  //@+@
-  0xb8,  //%@%
-  0x00,  //...
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x05, 0x00, 0xb8, 0xdc, 0xb8, 0x00, 0xfc, 0xfd, 0x00,
 
   /*Unicode: U+00bb (») , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x88,  //%.%.
-  0x66,  //+%+%
-  0x66,  //+%+%
-  0x88,  //%.%.
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x88, 0x66, 0x66, 0x88, 0xfe, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 4 */
-  0xf0,  //@@..
-  0x30,  //.@..
-  0xfc,  //@@@.
-  0x00,  //....
-  0x1b,  //.+%@
-  0xe3,  //@%.@
-  0x0f,  //..@@
-  0x03,  //...@
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xf0, 0x30, 0xfc, 0x00, 0x1b, 0xe3, 0x0f, 0x03, 0x00, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 4 */
-  0xf0,  //@@..
-  0x30,  //.@..
-  0xfc,  //@@@.
-  0x00,  //....
-  0x1b,  //.+%@
-  0xef,  //@%@@
-  0x05,  //..++
-  0x0f,  //..@@
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xf0, 0x30, 0xfc, 0x00, 0x1b, 0xef, 0x05, 0x0f, 0x00, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 4 */
-  0xf0,  //@@..
-  0x20,  //.%..
-  0xf0,  //@@..
-  0x00,  //....
-  0x1b,  //.+%@
-  0xe3,  //@%.@
-  0x0f,  //..@@
-  0x03,  //...@
-  0x00,  //....
-  0x00,  //....
-
+  0x09, 0xf0, 0x20, 0xf0, 0x00, 0x1b, 0xe3, 0x0f, 0x03, 0x00, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 3 */
-  0x00,  //...
-  0x30,  //.@.
-  0x00,  //...
-  0x30,  //.@.
-  0x30,  //.@.
-  0xe0,  //@%.
-  0xbc,  //%@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x30, 0x00, 0x30, 0x30, 0xe0, 0xbc, 0xfe, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 4 */
-  0x40,  //+...
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x40, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 4 */
-  0x14,  //.++.
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x14, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 4 */
-  0x14,  //.++.
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x14, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 4 */
-  0x3c,  //.@@.
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 4 */
-  0x3c,  //.@@.
-  0x28,  //.%%.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x69,  //+%%+
-  0xbe,  //%@@%
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0x28, 0x3c, 0x3c, 0x69, 0xbe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 4 */
-  0x3c,  //.@@.
-  0x00,  //....
-  0x14,  //.++.
-  0x3c,  //.@@.
-  0x3c,  //.@@.
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0x00, 0x14, 0x3c, 0x3c, 0x7d, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 4 */
-  0x00,  //....
-  0x3f,  //.@@@
-  0x3c,  //.@@.
-  0x7c,  //+@@.
-  0x6f,  //+%@@
-  0xbc,  //%@@.
-  0xcf,  //@.@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x3f, 0x3c, 0x7c, 0x6f, 0xbc, 0xcf, 0xfe, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 4 */
-  0x00,  //....
-  0x2f,  //.%@@
-  0xa0,  //%%..
-  0xc0,  //@...
-  0xc0,  //@...
-  0xa0,  //%%..
-  0x2f,  //.%@@
-  0x30,  //.@..
-  0xf0,  //@@..
-  0x00,  //....
-
+  0x09, 0x00, 0x2f, 0xa0, 0xc0, 0xc0, 0xa0, 0x2f, 0x30, 0xf0, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 4 */
-  0x40,  //+...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x40, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 4 */
-  0x14,  //.++.
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x14, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 4 */
-  0x50,  //++..
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x50, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 4 */
-  0xcc,  //@.@.
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xc0,  //@...
-  0xff,  //@@@@
-  0xc0,  //@...
-  0xff,  //@@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0xcc, 0xff, 0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 3 */
-  0x40,  //+..
-  0xfc,  //@@@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x40, 0xfc, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 3 */
-  0x14,  //.++
-  0xfc,  //@@@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x14, 0xfc, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 3 */
-  0x20,  //.%.
-  0xfc,  //@@@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0x20, 0xfc, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 3 */
-  0xcc,  //@.@
-  0xfc,  //@@@
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x01, 0xcc, 0xfc, 0xfd, 0x30, 0x00, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x3f, 0x00,  //.@@@.
-  0x31, 0x80,  //.@.+%
-  0x30, 0xc0,  //.@..@
-  0xfc, 0xc0,  //@@@.@
-  0x31, 0x80,  //.@.+%
-  0x3f, 0x00,  //.@@@.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x00, 0x00, 0x3f, 0x00, 0x31, 0x80, 0x30, 0xc0, 0xfc, 0xc0, 0x31, 0x80, 0x3f, 0xfa, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 4 */
-  0x3c,  //.@@.
-  0xd3,  //@+.@
-  0xf3,  //@@.@
-  0xe7,  //@%+@
-  0xdf,  //@+@@
-  0xcf,  //@.@@
-  0xc7,  //@.+@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0xd3, 0xf3, 0xe7, 0xdf, 0xcf, 0xc7, 0xfe, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 4 */
-  0x40,  //+...
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x40, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 4 */
-  0x14,  //.++.
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x14, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 4 */
-  0x14,  //.++.
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x14, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 4 */
-  0x3c,  //.@@.
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 4 */
-  0x3c,  //.@@.
-  0x7c,  //+@@.
-  0xd7,  //@++@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xd7,  //@++@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x3c, 0x7c, 0xd7, 0xc3, 0xc3, 0xd7, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x82,  //%..%
-  0x28,  //.%%.
-  0x28,  //.%%.
-  0x82,  //%..%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0x82, 0x28, 0x28, 0x82, 0xfe, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 6 */
-  0x00, 0x00,  //......
-  0x1f, 0x40,  //.+@@+.
-  0x35, 0x80,  //.@++%.
-  0x31, 0xc0,  //.@.+@.
-  0x34, 0xc0,  //.@+.@.
-  0x35, 0xc0,  //.@++@.
-  0x5f, 0x40,  //++@@+.
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0x0d, 0x00, 0x00, 0x1f, 0x40, 0x35, 0x80, 0x31, 0xc0, 0x34, 0xc0, 0x35, 0xc0, 0x5f, 0x40, 0xfb,
+  0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 4 */
-  0x40,  //+...
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x40, 0xfc, 0xc3, 0x00, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 4 */
-  0x14,  //.++.
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x14, 0xfc, 0xc3, 0x00, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 4 */
-  0x14,  //.++.
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x14, 0xfc, 0xc3, 0x00, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 4 */
-  0x3c,  //.@@.
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x00, 0x3c, 0xfc, 0xc3, 0x00, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 5 */
-  0x05, 0x00,  //..++.
-  0x91, 0x80,  //%+.+%
-  0x33, 0x00,  //.@.@.
-  0x1d, 0x00,  //.+@+.
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0x0c, 0x05, 0x00, 0x91, 0x80, 0x33, 0x00, 0x1d, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 4 */
-  0x00,  //....
-  0xc0,  //@...
-  0xfe,  //@@@%
-  0xc3,  //@..@
-  0xfe,  //@@@%
-  0xc0,  //@...
-  0xc0,  //@...
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xc0, 0xfe, 0xc3, 0xfe, 0xc0, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 4 */
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc9,  //@.%+
-  0xcc,  //@.@.
-  0xc2,  //@..%
-  0xc3,  //@..@
-  0xce,  //@.@%
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x7d, 0xc3, 0xc9, 0xcc, 0xc2, 0xc3, 0xce, 0xfe, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 4 */
-  0x00,  //....
-  0x50,  //++..
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x50, 0x00, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x14, 0x00, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 4 */
-  0x00,  //....
-  0x64,  //+%+.
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x64, 0x00, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 4 */
-  0x00,  //....
-  0x9c,  //%+@.
-  0xd8,  //@+%.
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x9c, 0xd8, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 4 */
-  0x00,  //....
-  0xcc,  //@.@.
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xcc, 0x00, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 4 */
-  0xf0,  //@@..
-  0xf0,  //@@..
-  0x00,  //....
-  0xfe,  //@@@%
-  0x7f,  //+@@@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0xf0, 0xf0, 0x00, 0xfe, 0x7f, 0xc3, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0xee,  //@%@%
-  0xbf,  //%@@@
-  0xf0,  //@@..
-  0xef,  //@%@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0xfe, 0x00, 0x03, 0xee, 0xbf, 0xf0, 0xef, 0xfe, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x7c,  //+@@
-  0xc0,  //@..
-  0xc0,  //@..
-  0x7c,  //+@@
-  0x30,  //.@.
-  0xf0,  //@@.
-  0x00,  //...
-
+  0xfe, 0x00, 0x06, 0x7c, 0xc0, 0xc0, 0x7c, 0x30, 0xf0, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 4 */
-  0x00,  //....
-  0x50,  //++..
-  0x00,  //....
-  0x7e,  //+@@%
-  0xff,  //@@@@
-  0xc0,  //@...
-  0x7f,  //+@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x50, 0x00, 0x7e, 0xff, 0xc0, 0x7f, 0xfe, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0x7e,  //+@@%
-  0xff,  //@@@@
-  0xc0,  //@...
-  0x7f,  //+@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x14, 0x00, 0x7e, 0xff, 0xc0, 0x7f, 0xfe, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 4 */
-  0x00,  //....
-  0x64,  //+%+.
-  0x00,  //....
-  0x7e,  //+@@%
-  0xff,  //@@@@
-  0xc0,  //@...
-  0x7f,  //+@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x64, 0x00, 0x7e, 0xff, 0xc0, 0x7f, 0xfe, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 4 */
-  0x00,  //....
-  0xcc,  //@.@.
-  0x00,  //....
-  0x7e,  //+@@%
-  0xff,  //@@@@
-  0xc0,  //@...
-  0x7f,  //+@@@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xcc, 0x00, 0x7e, 0xff, 0xc0, 0x7f, 0xfe, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 3 */
-  0x00,  //...
-  0x50,  //++.
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x50, 0x00, 0xf0, 0x30, 0x30, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 3 */
-  0x00,  //...
-  0x14,  //.++
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x14, 0x00, 0xf0, 0x30, 0x30, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 3 */
-  0x00,  //...
-  0x64,  //+%+
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0x64, 0x00, 0xf0, 0x30, 0x30, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 3 */
-  0x00,  //...
-  0xcc,  //@.@
-  0x00,  //...
-  0xf0,  //@@.
-  0x30,  //.@.
-  0x30,  //.@.
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0x06, 0x00, 0xcc, 0x00, 0xf0, 0x30, 0x30, 0xfc, 0xfe, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 4 */
-  0x34,  //.@+.
-  0x38,  //.@%.
-  0x1c,  //.+@.
-  0x7e,  //+@@%
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x34, 0x38, 0x1c, 0x7e, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 4 */
-  0x00,  //....
-  0x9c,  //%+@.
-  0xd8,  //@+%.
-  0xee,  //@%@%
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x03, 0x00, 0x9c, 0xd8, 0xee, 0xfe, 0xc3, 0xfe, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 4 */
-  0x00,  //....
-  0x50,  //++..
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x50, 0x00, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x14, 0x00, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x14, 0x00, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 4 */
-  0x00,  //....
-  0x28,  //.%%.
-  0x28,  //.%%.
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0x28, 0x28, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 4 */
-  0x00,  //....
-  0xc3,  //@..@
-  0x00,  //....
-  0x7d,  //+@@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0x7d,  //+@@+
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x06, 0x00, 0xc3, 0x00, 0x7d, 0xc3, 0xc3, 0x7d, 0xfe, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x0c, 0x00,  //..@..
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfd, 0x00, 0x00, 0x0c, 0xfe, 0x00, 0x04, 0xff, 0xc0, 0x00, 0x00, 0x0c, 0xfa, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x1f, 0x80,  //.+@@%.
-  0x32, 0xc0,  //.@.%@.
-  0x38, 0xc0,  //.@%.@.
-  0x2f, 0x40,  //.%@@+.
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfb, 0x00, 0x07, 0x1f, 0x80, 0x32, 0xc0, 0x38, 0xc0, 0x2f, 0x40, 0xfb, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 4 */
-  0x00,  //....
-  0x50,  //++..
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x50, 0x00, 0xfe, 0xc3, 0x00, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x14, 0x00, 0xfe, 0xc3, 0x00, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0x14, 0x00, 0xfe, 0xc3, 0x00, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 4 */
-  0x00,  //....
-  0xc3,  //@..@
-  0x00,  //....
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xbb,  //%@%@
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x02, 0x00, 0xc3, 0x00, 0xfe, 0xc3, 0x00, 0xbb, 0xfe, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 4 */
-  0x00,  //....
-  0x14,  //.++.
-  0x00,  //....
-  0xc7,  //@.+@
-  0x6d,  //+%@+
-  0x3c,  //.@@.
-  0x24,  //.%+.
-  0x30,  //.@..
-  0xe0,  //@%..
-  0x00,  //....
-
+  0x09, 0x00, 0x14, 0x00, 0xc7, 0x6d, 0x3c, 0x24, 0x30, 0xe0, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 4 */
-  0xc0,  //@...
-  0xc0,  //@...
-  0xc0,  //@...
-  0xed,  //@%@+
-  0xc3,  //@..@
-  0xc3,  //@..@
-  0xed,  //@%@+
-  0xc0,  //@...
-  0xc0,  //@...
-  0x00,  //....
-
+  0xfe, 0xc0, 0x06, 0xed, 0xc3, 0xc3, 0xed, 0xc0, 0xc0, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 4 */
-  0x00,  //....
-  0xcc,  //@.@.
-  0x00,  //....
-  0xc7,  //@.+@
-  0x6d,  //+%@+
-  0x3c,  //.@@.
-  0x24,  //.%+.
-  0x30,  //.@..
-  0xe0,  //@%..
-  0x00,  //....
-
-
+  0x09, 0x00, 0xcc, 0x00, 0xc7, 0x6d, 0x3c, 0x24, 0x30, 0xe0, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 4
   /*Unicode: U+00a0 ( ) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xed, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 1 */
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0xd0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x03, 0x00, 0xf0, 0x00, 0xd0, 0xfe, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x0f, 0x00,  //.@.
-  0x9f, 0xf0,  //%@@
-  0xff, 0x00,  //@@.
-  0xff, 0x00,  //@@.
-  0x9f, 0xf0,  //%@@
-  0x0f, 0x00,  //.@.
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xfd, 0x00, 0x0a, 0x0f, 0x00, 0x9f, 0xf0, 0xff, 0x00, 0xff, 0x00, 0x9f, 0xf0, 0x0f, 0xfc, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 4 */
-  0x00, 0x00,  //....
-  0x06, 0xff,  //.+@@
-  0x0e, 0x30,  //.@..
-  0x0f, 0x00,  //.@..
-  0xff, 0xf0,  //@@@.
-  0x0f, 0x00,  //.@..
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x06, 0xff, 0x0e, 0x30, 0x0f, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x8c, 0x80,  //%@%
-  0xc4, 0xc0,  //@+@
-  0x9c, 0x80,  //%@%
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xfb, 0x00, 0x05, 0x8c, 0x80, 0xc4, 0xc0, 0x9c, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0xb6, 0x06, 0xa0,  //%+.+%
-  0x1d, 0x0d, 0x10,  //.@.@.
-  0xff, 0xcf, 0xf0,  //@@@@@
-  0x02, 0xf2, 0x00,  //..@..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x10, 0xb6, 0x06, 0xa0, 0x1d, 0x0d, 0x10, 0xff, 0xcf, 0xf0, 0x02, 0xf2, 0x00, 0xff,
+  0xff, 0xf0, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 1 */
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0xf0,  //@
-  0xf0,  //@
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfe, 0xf0, 0x00, 0x00, 0xfe, 0xf0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 3 */
-  0x00, 0x00,  //...
-  0x9f, 0xf0,  //%@@
-  0xd3, 0x00,  //@..
-  0x8b, 0x40,  //%%+
-  0xe3, 0xe0,  //@.@
-  0x3b, 0x70,  //.%+
-  0x02, 0xd0,  //..@
-  0xff, 0x90,  //@@%
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0f, 0x00, 0x00, 0x9f, 0xf0, 0xd3, 0x00, 0x8b, 0x40, 0xe3, 0xe0, 0x3b, 0x70, 0x02, 0xd0, 0xff,
+  0x90, 0xfd, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 3 */
-  0x00, 0x00,  //...
-  0xf0, 0xf0,  //@.@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x03, 0x00, 0x00, 0xf0, 0xf0, 0xf1, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x1b, 0xfb, 0x10,  //.%@%.
-  0xb7, 0xcf, 0xb0,  //%+@@%
-  0xf0, 0xbf, 0xf0,  //@.%@@
-  0xb7, 0x07, 0xb0,  //%+.+%
-  0x1b, 0xfb, 0x10,  //.%@%.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0e, 0x1b, 0xfb, 0x10, 0xb7, 0xcf, 0xb0, 0xf0, 0xbf, 0xf0, 0xb7, 0x07, 0xb0, 0x1b,
+  0xfb, 0x10, 0xf8, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 4 */
-  0x00, 0x00,  //....
-  0xff, 0x90,  //@@%.
-  0xbf, 0xf0,  //%@@.
-  0xcb, 0xf0,  //@%@.
-  0x00, 0x00,  //....
-  0xff, 0xf0,  //@@@.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0b, 0x00, 0x00, 0xff, 0x90, 0xbf, 0xf0, 0xcb, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xf9, 0x00,
 
   /*Unicode: U+00ab («) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x08, 0x08,  //.%.%
-  0x94, 0x94,  //%+%+
-  0x94, 0x94,  //%+%+
-  0x08, 0x08,  //.%.%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x01, 0x08, 0x08, 0xfd, 0x94, 0x01, 0x08, 0x08, 0xfb, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xff, 0xff,  //@@@@
-  0x00, 0x0f,  //...@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xf9, 0x00, 0x03, 0xff, 0xff, 0x00, 0x0f, 0xf9, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x1b, 0xfb, 0x10,  //.%@%.
-  0xb7, 0xff, 0xb0,  //%+@@%
-  0xf0, 0xfa, 0xf0,  //@.@%@
-  0xb7, 0x0f, 0xc0,  //%+.@@
-  0x1b, 0xfb, 0x10,  //.%@%.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0e, 0x1b, 0xfb, 0x10, 0xb7, 0xff, 0xb0, 0xf0, 0xfa, 0xf0, 0xb7, 0x0f, 0xc0, 0x1b,
+  0xfb, 0x10, 0xf8, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 2 */
-  0x00,  //..
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 2 */
-  0x00,  //..
-  0xcc,  //@@
-  0xcc,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x02, 0x00, 0xcc, 0xcc, 0xfa, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xf0, 0x00,  //..@..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0xf0, 0x00,  //..@..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf7, 0x00, 0x0a, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0xf8, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 2 */
-  0x00,  //..
-  0xfb,  //@%
-  0x57,  //++
-  0xee,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xfb, 0x57, 0xee, 0xfb, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 2 */
-  0x00,  //..
-  0xfc,  //@@
-  0x09,  //.%
-  0xfc,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x03, 0x00, 0xfc, 0x09, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 2 */
-  0x00,  //..
-  0x55,  //++
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0x01, 0x00, 0x55, 0xf9, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xf0, 0x0f, 0x00,  //@..@.
-  0xf0, 0x0f, 0x00,  //@..@.
-  0xf2, 0x2f, 0x00,  //@..@.
-  0xec, 0xca, 0xe0,  //@@@%@
-  0xe0, 0x00, 0x00,  //@....
-  0xe0, 0x00, 0x00,  //@....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x0f, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf2, 0x2f, 0x00, 0xec, 0xca, 0xe0, 0xe0,
+  0x00, 0x00, 0xe0, 0xfc, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 4 */
-  0x00, 0x00,  //....
-  0xaf, 0xff,  //%@@@
-  0xff, 0x0f,  //@@.@
-  0xaf, 0x0f,  //%@.@
-  0x0f, 0x0f,  //.@.@
-  0x0f, 0x0f,  //.@.@
-  0x0f, 0x0f,  //.@.@
-  0x0f, 0x0f,  //.@.@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x06, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x0f, 0xaf, 0xf8, 0x0f, 0xfd, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xf0,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfd, 0x00, 0x00, 0xf0, 0xfc, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x0f,  //.@
-  0xec,  //@@
-  0x00,  //..
-
+  0xfa, 0x00, 0x02, 0x0f, 0xec, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 3 */
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x07, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 3 */
-  0x00, 0x00,  //...
-  0x9f, 0x90,  //%@%
-  0xf4, 0xf0,  //@+@
-  0x9f, 0x90,  //%@%
-  0x00, 0x00,  //...
-  0xcf, 0xc0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0b, 0x00, 0x00, 0x9f, 0x90, 0xf4, 0xf0, 0x9f, 0x90, 0x00, 0x00, 0xcf, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+00bb (») , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x80, 0x80,  //%.%.
-  0x49, 0x49,  //+%+%
-  0x49, 0x49,  //+%+%
-  0x80, 0x80,  //%.%.
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x01, 0x80, 0x80, 0xfd, 0x49, 0x01, 0x80, 0x80, 0xfb, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 4 */
-  0xff, 0x00,  //@@..
-  0x0f, 0x00,  //.@..
-  0xff, 0xf0,  //@@@.
-  0x00, 0x00,  //....
-  0x16, 0xad,  //.+%@
-  0xda, 0x3f,  //@%.@
-  0x00, 0xdf,  //..@@
-  0x00, 0x0f,  //...@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0f, 0xff, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x16, 0xad, 0xda, 0x3f, 0x00, 0xdf, 0x00,
+  0x0f, 0xfd, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 4 */
-  0xff, 0x00,  //@@..
-  0x0f, 0x00,  //.@..
-  0xff, 0xf0,  //@@@.
-  0x00, 0x00,  //....
-  0x16, 0xad,  //.+%@
-  0xda, 0xfd,  //@%@@
-  0x00, 0x57,  //..++
-  0x00, 0xee,  //..@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0f, 0xff, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x16, 0xad, 0xda, 0xfd, 0x00, 0x57, 0x00,
+  0xee, 0xfd, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 4 */
-  0xfc, 0x00,  //@@..
-  0x09, 0x00,  //.%..
-  0xfc, 0x00,  //@@..
-  0x00, 0x00,  //....
-  0x16, 0xad,  //.+%@
-  0xda, 0x3f,  //@%.@
-  0x00, 0xdf,  //..@@
-  0x00, 0x0f,  //...@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x04, 0xfc, 0x00, 0x09, 0x00, 0xfc, 0xfe, 0x00, 0x07, 0x16, 0xad, 0xda, 0x3f, 0x00, 0xdf, 0x00,
+  0x0f, 0xfd, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 3 */
-  0x00, 0x00,  //...
-  0x0f, 0x00,  //.@.
-  0x00, 0x00,  //...
-  0x0f, 0x00,  //.@.
-  0x2f, 0x00,  //.@.
-  0xdb, 0x00,  //@%.
-  0xac, 0xf0,  //%@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x02, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x07, 0x0f, 0x00, 0x2f, 0x00, 0xdb, 0x00, 0xac, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00c0 (À) , Width: 4 */
-  0x70, 0x00,  //+...
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x70, 0x00, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 4 */
-  0x07, 0x60,  //.++.
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x60, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 4 */
-  0x07, 0x70,  //.++.
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x70, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 4 */
-  0x0d, 0xd0,  //.@@.
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0d, 0xd0, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 4 */
-  0x0f, 0xf0,  //.@@.
-  0x08, 0x80,  //.%%.
-  0x0d, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x5b, 0xb5,  //+%%+
-  0x9f, 0xf9,  //%@@%
-  0xd2, 0x2d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0f, 0xf0, 0x08, 0x80, 0x0d, 0xc0, 0x1e, 0xe1, 0x5b, 0xb5, 0x9f, 0xf9, 0xd2, 0x2d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 4 */
-  0x0c, 0xc0,  //.@@.
-  0x03, 0x30,  //....
-  0x06, 0x60,  //.++.
-  0x0c, 0xc0,  //.@@.
-  0x1e, 0xe1,  //.@@.
-  0x7f, 0xf7,  //+@@+
-  0xd3, 0x3d,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0c, 0xc0, 0x03, 0x30, 0x06, 0x60, 0x0c, 0xc0, 0x1e, 0xe1, 0x7f, 0xf7, 0xd3, 0x3d, 0xfb,
+  0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 4 */
-  0x00, 0x00,  //....
-  0x0d, 0xff,  //.@@@
-  0x0f, 0xf0,  //.@@.
-  0x4c, 0xf0,  //+@@.
-  0x78, 0xff,  //+%@@
-  0xaf, 0xf0,  //%@@.
-  0xe2, 0xff,  //@.@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x0d, 0xff, 0x0f, 0xf0, 0x4c, 0xf0, 0x78, 0xff, 0xaf, 0xf0, 0xe2, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 4 */
-  0x00, 0x00,  //....
-  0x1b, 0xff,  //.%@@
-  0xa8, 0x00,  //%%..
-  0xe0, 0x00,  //@...
-  0xe0, 0x00,  //@...
-  0xb8, 0x00,  //%%..
-  0x1b, 0xff,  //.%@@
-  0x0f, 0x00,  //.@..
-  0xec, 0x00,  //@@..
-  0x00, 0x00,  //....
-
+  0x10, 0x00, 0x00, 0x1b, 0xff, 0xa8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xb8, 0x00, 0x1b, 0xff, 0x0f,
+  0x00, 0xec, 0xfe, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 4 */
-  0x70, 0x00,  //+...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x70, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00c9 (É) , Width: 4 */
-  0x07, 0x60,  //.++.
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x60, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 4 */
-  0x77, 0x00,  //++..
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x77, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 4 */
-  0xf0, 0xf0,  //@.@.
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0xf0, 0x00,  //@...
-  0xff, 0xff,  //@@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 3 */
-  0x70, 0x00,  //+..
-  0xff, 0xf0,  //@@@
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x70, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00cd (Í) , Width: 3 */
-  0x07, 0x60,  //.++
-  0xff, 0xf0,  //@@@
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x07, 0x60, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00ce (Î) , Width: 3 */
-  0x29, 0x20,  //.%.
-  0xff, 0xf0,  //@@@
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x29, 0x20, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 3 */
-  0xf0, 0xf0,  //@.@
-  0xff, 0xf0,  //@@@
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0xf0, 0xf0, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x0f, 0xfc, 0x20,  //.@@@.
-  0x0f, 0x06, 0xb0,  //.@.+%
-  0x0f, 0x00, 0xe0,  //.@..@
-  0xff, 0xf0, 0xe0,  //@@@.@
-  0x0f, 0x06, 0xb0,  //.@.+%
-  0x0f, 0xfc, 0x20,  //.@@@.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfe, 0x00, 0x11, 0x0f, 0xfc, 0x20, 0x0f, 0x06, 0xb0, 0x0f, 0x00, 0xe0, 0xff, 0xf0, 0xe0, 0x0f,
+  0x06, 0xb0, 0x0f, 0xfc, 0x20, 0xf8, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 4 */
-  0x0d, 0xd0,  //.@@.
-  0xf7, 0x0f,  //@+.@
-  0xfe, 0x0f,  //@@.@
-  0xfb, 0x6f,  //@%+@
-  0xf4, 0xef,  //@+@@
-  0xf0, 0xdf,  //@.@@
-  0xf0, 0x6f,  //@.+@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0d, 0xd0, 0xf7, 0x0f, 0xfe, 0x0f, 0xfb, 0x6f, 0xf4, 0xef, 0xf0, 0xdf, 0xf0, 0x6f, 0xfb,
+  0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 4 */
-  0x70, 0x00,  //+...
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x70, 0x00, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 4 */
-  0x07, 0x60,  //.++.
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x60, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 4 */
-  0x07, 0x70,  //.++.
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x70, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 4 */
-  0x0d, 0xd0,  //.@@.
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0d, 0xd0, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 4 */
-  0x0f, 0xf0,  //.@@.
-  0x4e, 0xe3,  //+@@.
-  0xc4, 0x4c,  //@++@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xc4, 0x4c,  //@++@
-  0x4e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0f, 0xf0, 0x4e, 0xe3, 0xc4, 0x4c, 0xf0, 0x0f, 0xf0, 0x0f, 0xc4, 0x4c, 0x4e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00d7 (×) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x91, 0x19,  //%..%
-  0x1b, 0xb1,  //.%%.
-  0x2b, 0xb1,  //.%%.
-  0x91, 0x19,  //%..%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0x91, 0x19, 0x1b, 0xb1, 0x2b, 0xb1, 0x91, 0x19, 0xfb, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x04, 0xec, 0x72,  //.+@@+.
-  0x0d, 0x46, 0xb0,  //.@++%.
-  0x0f, 0x17, 0xe0,  //.@.+@.
-  0x0f, 0x71, 0xf0,  //.@+.@.
-  0x0c, 0x64, 0xd0,  //.@++@.
-  0x77, 0xde, 0x40,  //++@@+.
-  0x10, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xfe, 0x00, 0x12, 0x04, 0xec, 0x72, 0x0d, 0x46, 0xb0, 0x0f, 0x17, 0xe0, 0x0f, 0x71, 0xf0, 0x0c,
+  0x64, 0xd0, 0x77, 0xde, 0x40, 0x10, 0xf9, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 4 */
-  0x70, 0x00,  //+...
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xe2, 0x3e,  //@..@
-  0x5e, 0xe5,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x70, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe2, 0x3e, 0x5e, 0xe5, 0xfb,
+  0x00,
 
   /*Unicode: U+00da (Ú) , Width: 4 */
-  0x07, 0x60,  //.++.
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xe2, 0x3e,  //@..@
-  0x5e, 0xe5,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x60, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe2, 0x3e, 0x5e, 0xe5, 0xfb,
+  0x00,
 
   /*Unicode: U+00db (Û) , Width: 4 */
-  0x07, 0x70,  //.++.
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xe2, 0x3e,  //@..@
-  0x5e, 0xe5,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x07, 0x70, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe2, 0x3e, 0x5e, 0xe5, 0xfb,
+  0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 4 */
-  0x0f, 0xf0,  //.@@.
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xe2, 0x3e,  //@..@
-  0x5e, 0xe5,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x0f, 0xf0, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe2, 0x3e, 0x5e, 0xe5, 0xfb,
+  0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 5 */
-  0x00, 0x76, 0x00,  //..++.
-  0xb7, 0x07, 0xb0,  //%+.+%
-  0x2e, 0x3e, 0x10,  //.@.@.
-  0x07, 0xf7, 0x00,  //.+@+.
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0x13, 0x00, 0x76, 0x00, 0xb7, 0x07, 0xb0, 0x2e, 0x3e, 0x10, 0x07, 0xf7, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x00,  //@...
-  0xff, 0xe8,  //@@@%
-  0xf0, 0x3f,  //@..@
-  0xff, 0xf8,  //@@@%
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0c, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xe8, 0xf0, 0x3f, 0xff, 0xf8, 0xf0, 0x00, 0xf0, 0xfa, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 4 */
-  0x6e, 0xe5,  //+@@+
-  0xe3, 0x3e,  //@..@
-  0xf0, 0xb6,  //@.%+
-  0xf0, 0xe0,  //@.@.
-  0xf0, 0x18,  //@..%
-  0xf0, 0x1f,  //@..@
-  0xf0, 0xfa,  //@.@%
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x6e, 0xe5, 0xe3, 0x3e, 0xf0, 0xb6, 0xf0, 0xe0, 0xf0, 0x18, 0xf0, 0x1f, 0xf0, 0xfa, 0xfb,
+  0x00,
 
   /*Unicode: U+00e0 (à) , Width: 4 */
-  0x00, 0x00,  //....
-  0x55, 0x00,  //++..
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x02, 0x00, 0x00, 0x55, 0xfe, 0x00, 0x07, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e1 (á) , Width: 4 */
-  0x00, 0x00,  //....
-  0x05, 0x50,  //.++.
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e2 (â) , Width: 4 */
-  0x00, 0x00,  //....
-  0x68, 0x60,  //+%+.
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 4 */
-  0x00, 0x00,  //....
-  0xa7, 0xf0,  //%+@.
-  0xf7, 0xa0,  //@+%.
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xa7, 0xf0, 0xf7, 0xa0, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0xf0,  //@.@.
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e5 (å) , Width: 4 */
-  0xcc, 0x00,  //@@..
-  0xcc, 0x00,  //@@..
-  0x00, 0x00,  //....
-  0xff, 0xe8,  //@@@%
-  0x7e, 0xff,  //+@@@
-  0xf3, 0x3f,  //@..@
-  0x9f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x02, 0xcc, 0x00, 0xcc, 0xfe, 0x00, 0x07, 0xff, 0xe8, 0x7e, 0xff, 0xf3, 0x3f, 0x9f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0xfa, 0xfb,  //@%@%
-  0xbf, 0xff,  //%@@@
-  0xff, 0x20,  //@@..
-  0xc8, 0xef,  //@%@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfb, 0x00, 0x07, 0xfa, 0xfb, 0xbf, 0xff, 0xff, 0x20, 0xc8, 0xef, 0xfb, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x6e, 0xf0,  //+@@
-  0xe3, 0x00,  //@..
-  0xe3, 0x00,  //@..
-  0x6e, 0xf0,  //+@@
-  0x0f, 0x00,  //.@.
-  0xec, 0x00,  //@@.
-  0x00, 0x00,  //...
-
+  0xfb, 0x00, 0x0a, 0x6e, 0xf0, 0xe3, 0x00, 0xe3, 0x00, 0x6e, 0xf0, 0x0f, 0x00, 0xec, 0xfe, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 4 */
-  0x00, 0x00,  //....
-  0x55, 0x00,  //++..
-  0x00, 0x00,  //....
-  0x4e, 0xf8,  //+@@%
-  0xef, 0xff,  //@@@@
-  0xe3, 0x00,  //@...
-  0x4d, 0xff,  //+@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x02, 0x00, 0x00, 0x55, 0xfe, 0x00, 0x07, 0x4e, 0xf8, 0xef, 0xff, 0xe3, 0x00, 0x4d, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00e9 (é) , Width: 4 */
-  0x00, 0x00,  //....
-  0x05, 0x50,  //.++.
-  0x00, 0x00,  //....
-  0x4e, 0xf8,  //+@@%
-  0xef, 0xff,  //@@@@
-  0xe3, 0x00,  //@...
-  0x4d, 0xff,  //+@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x4e, 0xf8, 0xef, 0xff, 0xe3, 0x00, 0x4d, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00ea (ê) , Width: 4 */
-  0x00, 0x00,  //....
-  0x68, 0x60,  //+%+.
-  0x00, 0x00,  //....
-  0x4e, 0xf8,  //+@@%
-  0xef, 0xff,  //@@@@
-  0xe3, 0x00,  //@...
-  0x4d, 0xff,  //+@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0x4e, 0xf8, 0xef, 0xff, 0xe3, 0x00, 0x4d, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00eb (ë) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0xf0,  //@.@.
-  0x00, 0x00,  //....
-  0x4e, 0xf8,  //+@@%
-  0xef, 0xff,  //@@@@
-  0xe3, 0x00,  //@...
-  0x4d, 0xff,  //+@@@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x4e, 0xf8, 0xef, 0xff, 0xe3, 0x00, 0x4d, 0xff, 0xfb,
+  0x00,
 
   /*Unicode: U+00ec (ì) , Width: 3 */
-  0x00, 0x00,  //...
-  0x55, 0x00,  //++.
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x02, 0x00, 0x00, 0x55, 0xfe, 0x00, 0x07, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00ed (í) , Width: 3 */
-  0x00, 0x00,  //...
-  0x05, 0x50,  //.++
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00ee (î) , Width: 3 */
-  0x00, 0x00,  //...
-  0x68, 0x60,  //+%+
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00ef (ï) , Width: 3 */
-  0x00, 0x00,  //...
-  0xf0, 0xf0,  //@.@
-  0x00, 0x00,  //...
-  0xff, 0x00,  //@@.
-  0x0f, 0x00,  //.@.
-  0x0f, 0x00,  //.@.
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0x0d, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xfb,
+  0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 4 */
-  0x3d, 0x42,  //.@+.
-  0x2e, 0xa0,  //.@%.
-  0x24, 0xe3,  //.+@.
-  0x5e, 0xfb,  //+@@%
-  0xe3, 0x2f,  //@..@
-  0xe2, 0x3d,  //@..@
-  0x5e, 0xe4,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x3d, 0x42, 0x2e, 0xa0, 0x24, 0xe3, 0x5e, 0xfb, 0xe3, 0x2f, 0xe2, 0x3d, 0x5e, 0xe4, 0xfb,
+  0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 4 */
-  0x00, 0x00,  //....
-  0xa7, 0xf0,  //%+@.
-  0xf7, 0xa0,  //@+%.
-  0xf8, 0xf8,  //@%@%
-  0xf3, 0x2f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xa7, 0xf0, 0xf7, 0xa0, 0xf8, 0xf8, 0xf3, 0x2f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfb,
+  0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 4 */
-  0x00, 0x00,  //....
-  0x55, 0x00,  //++..
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x02, 0x00, 0x00, 0x55, 0xfe, 0x00, 0x07, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 4 */
-  0x00, 0x00,  //....
-  0x05, 0x50,  //.++.
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 4 */
-  0x00, 0x00,  //....
-  0x06, 0x60,  //.++.
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 4 */
-  0x00, 0x00,  //....
-  0x0b, 0xb0,  //.%%.
-  0x0b, 0xb0,  //.%%.
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x0b, 0xb0, 0x0b, 0xb0, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0x6e, 0xe5,  //+@@+
-  0xe2, 0x2e,  //@..@
-  0xe2, 0x2e,  //@..@
-  0x6e, 0xe6,  //+@@+
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x6e, 0xe5, 0xe2, 0x2e, 0xe2, 0x2e, 0x6e, 0xe6, 0xfb,
+  0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xfa, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x02, 0xff, 0xff, 0xf0, 0xfd, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x07, 0xec, 0x91,  //.+@@%.
-  0x0f, 0x38, 0xc0,  //.@.%@.
-  0x0c, 0x83, 0xf0,  //.@%.@.
-  0x39, 0xcf, 0x70,  //.%@@+.
-  0x10, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf8, 0x00, 0x0c, 0x07, 0xec, 0x91, 0x0f, 0x38, 0xc0, 0x0c, 0x83, 0xf0, 0x39, 0xcf, 0x70, 0x10,
+  0xf9, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 4 */
-  0x00, 0x00,  //....
-  0x55, 0x00,  //++..
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf2, 0x3f,  //@..@
-  0x8f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x02, 0x00, 0x00, 0x55, 0xfe, 0x00, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf2, 0x3f, 0x8f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00fa (ú) , Width: 4 */
-  0x00, 0x00,  //....
-  0x05, 0x50,  //.++.
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf2, 0x3f,  //@..@
-  0x8f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf2, 0x3f, 0x8f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00fb (û) , Width: 4 */
-  0x00, 0x00,  //....
-  0x06, 0x60,  //.++.
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf2, 0x3f,  //@..@
-  0x8f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf2, 0x3f, 0x8f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00fc (ü) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0x00, 0x00,  //....
-  0xf0, 0x0f,  //@..@
-  0xf0, 0x0f,  //@..@
-  0xf2, 0x3f,  //@..@
-  0x8f, 0x8f,  //%@%@
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0x0d, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x0f, 0xf2, 0x3f, 0x8f, 0x8f, 0xfb,
+  0x00,
 
   /*Unicode: U+00fd (ý) , Width: 4 */
-  0x00, 0x00,  //....
-  0x05, 0x50,  //.++.
-  0x00, 0x00,  //....
-  0xd3, 0x5c,  //@.+@
-  0x79, 0xc5,  //+%@+
-  0x1f, 0xd0,  //.@@.
-  0x0b, 0x70,  //.%+.
-  0x1e, 0x10,  //.@..
-  0xf8, 0x00,  //@%..
-  0x00, 0x00,  //....
-
+  0x10, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0xd3, 0x5c, 0x79, 0xc5, 0x1f, 0xd0, 0x0b, 0x70, 0x1e,
+  0x10, 0xf8, 0xfe, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 4 */
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0xf9, 0xe6,  //@%@+
-  0xf2, 0x2e,  //@..@
-  0xf2, 0x2e,  //@..@
-  0xf9, 0xe6,  //@%@+
-  0xf0, 0x00,  //@...
-  0xf0, 0x00,  //@...
-  0x00, 0x00,  //....
-
+  0x10, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf9, 0xe6, 0xf2, 0x2e, 0xf2, 0x2e, 0xf9, 0xe6, 0xf0,
+  0x00, 0xf0, 0xfe, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 4 */
-  0x00, 0x00,  //....
-  0xf0, 0xf0,  //@.@.
-  0x00, 0x00,  //....
-  0xd3, 0x5c,  //@.+@
-  0x79, 0xc5,  //+%@+
-  0x1f, 0xd0,  //.@@.
-  0x0b, 0x70,  //.%+.
-  0x1e, 0x10,  //.@..
-  0xf8, 0x00,  //@%..
-  0x00, 0x00,  //....
-
-
+  0x10, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xd3, 0x5c, 0x79, 0xc5, 0x1f, 0xd0, 0x0b, 0x70, 0x1e,
+  0x10, 0xf8, 0xfe, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 8
   /*Unicode: U+00a0 ( ) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xe3, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 1 */
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0xda,  //@
-  0xfa,  //@
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0x06, 0x00, 0xff, 0x00, 0xda, 0xfa, 0xff, 0xff, 0xfe, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0x00,  //.@.
-  0x96, 0xff, 0xff,  //%@@
-  0xf2, 0xff, 0x00,  //@@.
-  0xf2, 0xff, 0x00,  //@@.
-  0x96, 0xff, 0xff,  //%@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfa, 0x00, 0x0f, 0xff, 0x00, 0x96, 0xff, 0xff, 0xf2, 0xff, 0x00, 0xf2, 0xff, 0x00, 0x96, 0xff,
+  0xff, 0x00, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x6c, 0xf0, 0xff,  //.+@@
-  0x00, 0xec, 0x32, 0x00,  //.@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0x00,  //@@@.
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x0a, 0x6c, 0xf0, 0xff, 0x00, 0xec, 0x32, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfe, 0xff,
+  0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x8a, 0xc6, 0x8e,  //%@%
-  0xc8, 0x46, 0xc8,  //@+@
-  0x90, 0xca, 0x8a,  //%@%
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xf8, 0x00, 0x08, 0x8a, 0xc6, 0x8e, 0xc8, 0x46, 0xc8, 0x90, 0xca, 0x8a, 0xf5, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xb0, 0x62, 0x00, 0x62, 0xae,  //%+.+%
-  0x1e, 0xd6, 0x0e, 0xd4, 0x1a,  //.@.@.
-  0xff, 0xff, 0xcc, 0xff, 0xff,  //@@@@@
-  0x00, 0x2e, 0xff, 0x2a, 0x00,  //..@..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfc, 0x00, 0x13, 0xb0, 0x62, 0x00, 0x62, 0xae, 0x1e, 0xd6, 0x0e, 0xd4, 0x1a, 0xff, 0xff, 0xcc,
+  0xff, 0xff, 0x00, 0x2e, 0xff, 0x2a, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0xff, 0xf0, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 1 */
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0xff,  //@
-  0xff,  //@
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-
+  0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x9a, 0xf8, 0xff,  //%@@
-  0xd2, 0x30, 0x00,  //@..
-  0x8a, 0xb0, 0x42,  //%%+
-  0xe6, 0x3a, 0xee,  //@.@
-  0x38, 0xb2, 0x7e,  //.%+
-  0x00, 0x2c, 0xda,  //..@
-  0xff, 0xf8, 0x96,  //@@%
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x14, 0x9a, 0xf8, 0xff, 0xd2, 0x30, 0x00, 0x8a, 0xb0, 0x42, 0xe6, 0x3a, 0xee, 0x38,
+  0xb2, 0x7e, 0x00, 0x2c, 0xda, 0xff, 0xf8, 0x96, 0xfb, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0x00, 0xff,  //@.@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xe9, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x1c, 0xba, 0xf2, 0xba, 0x1c,  //.%@%.
-  0xba, 0x76, 0xc8, 0xff, 0xba,  //%+@@%
-  0xf2, 0x0a, 0xbe, 0xff, 0xf2,  //@.%@@
-  0xba, 0x76, 0x0a, 0x76, 0xba,  //%+.+%
-  0x1c, 0xba, 0xf2, 0xba, 0x1c,  //.%@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf7, 0x00, 0x18, 0x1c, 0xba, 0xf2, 0xba, 0x1c, 0xba, 0x76, 0xc8, 0xff, 0xba, 0xf2, 0x0a, 0xbe,
+  0xff, 0xf2, 0xba, 0x76, 0x0a, 0x76, 0xba, 0x1c, 0xba, 0xf2, 0xba, 0x1c, 0xf2, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xf6, 0x94, 0x00,  //@@%.
-  0xb2, 0xfa, 0xfa, 0x00,  //%@@.
-  0xcc, 0xb0, 0xff, 0x00,  //@%@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0x06,  //@@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x0a, 0xff, 0xf6, 0x94, 0x00, 0xb2, 0xfa, 0xfa, 0x00, 0xcc, 0xb0, 0xff, 0xfc, 0x00,
+  0xfe, 0xff, 0x00, 0x06, 0xf1, 0x00,
 
   /*Unicode: U+00ab («) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x84, 0x00, 0x84,  //.%.%
-  0x96, 0x4c, 0x92, 0x48,  //%+%+
-  0x96, 0x4c, 0x92, 0x46,  //%+%+
-  0x00, 0x86, 0x00, 0x86,  //.%.%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf4, 0x00, 0x0e, 0x84, 0x00, 0x84, 0x96, 0x4c, 0x92, 0x48, 0x96, 0x4c, 0x92, 0x46, 0x00, 0x86,
+  0x00, 0x86, 0xf5, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf1, 0x00, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf9, 0x00, 0x01, 0xff, 0xff, 0xf7, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x1c, 0xba, 0xf2, 0xba, 0x1c,  //.%@%.
-  0xba, 0x76, 0xff, 0xff, 0xba,  //%+@@%
-  0xf2, 0x0a, 0xff, 0xa4, 0xf2,  //@.@%@
-  0xba, 0x76, 0x0a, 0xff, 0xca,  //%+.@@
-  0x1c, 0xba, 0xf2, 0xba, 0x1c,  //.%@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf7, 0x00, 0x18, 0x1c, 0xba, 0xf2, 0xba, 0x1c, 0xba, 0x76, 0xff, 0xff, 0xba, 0xf2, 0x0a, 0xff,
+  0xa4, 0xf2, 0xba, 0x76, 0x0a, 0xff, 0xca, 0x1c, 0xba, 0xf2, 0xba, 0x1c, 0xf2, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 2 */
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 2 */
-  0x00, 0x00,  //..
-  0xc4, 0xc0,  //@@
-  0xc6, 0xc4,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x05, 0x00, 0x00, 0xc4, 0xc0, 0xc6, 0xc4, 0xf3, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf0, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xff,
+  0xf2, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 2 */
-  0x00, 0x00,  //..
-  0xff, 0xb2,  //@%
-  0x52, 0x74,  //++
-  0xe8, 0xe6,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x07, 0x00, 0x00, 0xff, 0xb2, 0x52, 0x74, 0xe8, 0xe6, 0xf5, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 2 */
-  0x00, 0x00,  //..
-  0xff, 0xc4,  //@@
-  0x00, 0x9e,  //.%
-  0xff, 0xc8,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x07, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x9e, 0xff, 0xc8, 0xf5, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 2 */
-  0x00, 0x00,  //..
-  0x5e, 0x5a,  //++
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0x03, 0x00, 0x00, 0x5e, 0x5a, 0xf1, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0x00, 0x00, 0xff, 0x00,  //@..@.
-  0xff, 0x00, 0x00, 0xff, 0x00,  //@..@.
-  0xff, 0x2a, 0x2e, 0xff, 0x06,  //@..@.
-  0xea, 0xc0, 0xc6, 0xa2, 0xe6,  //@@@%@
-  0xe6, 0x00, 0x00, 0x00, 0x00,  //@....
-  0xe6, 0x00, 0x00, 0x00, 0x00,  //@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0x14, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x2a, 0x2e,
+  0xff, 0x06, 0xea, 0xc0, 0xc6, 0xa2, 0xe6, 0xe6, 0xfd, 0x00, 0x00, 0xe6, 0xf8, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xa4, 0xff, 0xff, 0xff,  //%@@@
-  0xf6, 0xff, 0x00, 0xff,  //@@.@
-  0xac, 0xff, 0x00, 0xff,  //%@.@
-  0x00, 0xff, 0x00, 0xff,  //.@.@
-  0x00, 0xff, 0x00, 0xff,  //.@.@
-  0x00, 0xff, 0x00, 0xff,  //.@.@
-  0x00, 0xff, 0x00, 0xff,  //.@.@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x00, 0xa4, 0xfe, 0xff, 0x17, 0xf6, 0xff, 0x00, 0xff, 0xac, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf9,
+  0x00,
 
   /*Unicode: U+00b7 (·) , Width: 1 */
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0xff,  //@
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-  0x00,  //.
-
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x08, 0xff,  //.@
-  0xee, 0xcc,  //@@
-  0x00, 0x00,  //..
-
+  0xf3, 0x00, 0x05, 0x08, 0xff, 0xee, 0xcc, 0x00, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xfe, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x90, 0xf4, 0x90,  //%@%
-  0xf4, 0x42, 0xf4,  //@+@
-  0x90, 0xf4, 0x90,  //%@%
-  0x00, 0x00, 0x00,  //...
-  0xca, 0xff, 0xc2,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x08, 0x90, 0xf4, 0x90, 0xf4, 0x42, 0xf4, 0x90, 0xf4, 0x90, 0xfe, 0x00, 0x02, 0xca,
+  0xff, 0xc2, 0xf5, 0x00,
 
   /*Unicode: U+00bb (») , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x84, 0x00, 0x84, 0x00,  //%.%.
-  0x48, 0x92, 0x4e, 0x96,  //+%+%
-  0x48, 0x92, 0x4c, 0x96,  //+%+%
-  0x84, 0x00, 0x84, 0x00,  //%.%.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0e, 0x84, 0x00, 0x84, 0x00, 0x48, 0x92, 0x4e, 0x96, 0x48, 0x92, 0x4c, 0x96, 0x84,
+  0x00, 0x84, 0xf4, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 4 */
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0x00,  //@@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1e, 0x60, 0xa2, 0xd6,  //.+%@
-  0xd8, 0xa2, 0x3c, 0xff,  //@%.@
-  0x00, 0x00, 0xd4, 0xff,  //..@@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x01, 0xff, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x0b, 0x1e, 0x60,
+  0xa2, 0xd6, 0xd8, 0xa2, 0x3c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 4 */
-  0xff, 0xff, 0x00, 0x00,  //@@..
-  0x00, 0xff, 0x00, 0x00,  //.@..
-  0xff, 0xff, 0xff, 0x00,  //@@@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1e, 0x60, 0xa2, 0xd6,  //.+%@
-  0xd8, 0xa2, 0xff, 0xd4,  //@%@@
-  0x00, 0x00, 0x52, 0x74,  //..++
-  0x00, 0x00, 0xe8, 0xe6,  //..@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x01, 0xff, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x0f, 0x1e, 0x60,
+  0xa2, 0xd6, 0xd8, 0xa2, 0xff, 0xd4, 0x00, 0x00, 0x52, 0x74, 0x00, 0x00, 0xe8, 0xe6, 0xf9, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 4 */
-  0xff, 0xc4, 0x00, 0x00,  //@@..
-  0x00, 0x9e, 0x00, 0x00,  //.%..
-  0xff, 0xc8, 0x00, 0x00,  //@@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1e, 0x60, 0xa2, 0xd6,  //.+%@
-  0xd8, 0xa2, 0x3c, 0xff,  //@%.@
-  0x00, 0x00, 0xd4, 0xff,  //..@@
-  0x00, 0x00, 0x00, 0xff,  //...@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x01, 0xff, 0xc4, 0xfe, 0x00, 0x04, 0x9e, 0x00, 0x00, 0xff, 0xc8, 0xfb, 0x00, 0x0b, 0x1e, 0x60,
+  0xa2, 0xd6, 0xd8, 0xa2, 0x3c, 0xff, 0x00, 0x00, 0xd4, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0x00, 0x00,  //...
-  0x00, 0xfc, 0x00,  //.@.
-  0x22, 0xf4, 0x00,  //.@.
-  0xde, 0xb2, 0x00,  //@%.
-  0xa2, 0xce, 0xff,  //%@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfd, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x0a, 0xfc, 0x00, 0x22, 0xf4, 0x00, 0xde, 0xb2, 0x00, 0xa2,
+  0xce, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 4 */
-  0x70, 0x00, 0x00, 0x00,  //+...
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0x70, 0xfd, 0x00, 0x16, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee, 0x14,
+  0x56, 0xb0, 0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 4 */
-  0x00, 0x76, 0x68, 0x00,  //.++.
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x68, 0x00, 0x00, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee,
+  0x14, 0x56, 0xb0, 0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 4 */
-  0x00, 0x76, 0x76, 0x00,  //.++.
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x76, 0x00, 0x00, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee,
+  0x14, 0x56, 0xb0, 0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 4 */
-  0x00, 0xda, 0xd8, 0x00,  //.@@.
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xda, 0xd8, 0x00, 0x00, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee,
+  0x14, 0x56, 0xb0, 0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 4 */
-  0x00, 0xff, 0xff, 0x00,  //.@@.
-  0x00, 0x8c, 0x8c, 0x00,  //.%%.
-  0x00, 0xd0, 0xce, 0x00,  //.@@.
-  0x14, 0xec, 0xee, 0x14,  //.@@.
-  0x56, 0xb0, 0xb0, 0x56,  //+%%+
-  0x9a, 0xff, 0xff, 0x98,  //%@@%
-  0xdc, 0x2a, 0x2a, 0xdc,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xff, 0xff, 0x00, 0x00, 0x8c, 0x8c, 0x00, 0x00, 0xd0, 0xce, 0x00, 0x14, 0xec, 0xee,
+  0x14, 0x56, 0xb0, 0xb0, 0x56, 0x9a, 0xff, 0xff, 0x98, 0xdc, 0x2a, 0x2a, 0xdc, 0xf5, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 4 */
-  0x00, 0xca, 0xc8, 0x00,  //.@@.
-  0x00, 0x3a, 0x3a, 0x00,  //....
-  0x00, 0x68, 0x68, 0x00,  //.++.
-  0x00, 0xc2, 0xc2, 0x00,  //.@@.
-  0x1e, 0xea, 0xea, 0x1e,  //.@@.
-  0x78, 0xff, 0xff, 0x76,  //+@@+
-  0xd2, 0x3a, 0x3a, 0xd0,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xca, 0xc8, 0x00, 0x00, 0x3a, 0x3a, 0x00, 0x00, 0x68, 0x68, 0x00, 0x00, 0xc2, 0xc2,
+  0x00, 0x1e, 0xea, 0xea, 0x1e, 0x78, 0xff, 0xff, 0x76, 0xd2, 0x3a, 0x3a, 0xd0, 0xf5, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xd2, 0xff, 0xff,  //.@@@
-  0x0c, 0xf2, 0xff, 0x00,  //.@@.
-  0x40, 0xc4, 0xff, 0x00,  //+@@.
-  0x76, 0x8e, 0xff, 0xff,  //+%@@
-  0xac, 0xff, 0xff, 0x00,  //%@@.
-  0xe4, 0x20, 0xff, 0xff,  //@.@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x16, 0xd2, 0xff, 0xff, 0x0c, 0xf2, 0xff, 0x00, 0x40, 0xc4, 0xff, 0x00, 0x76, 0x8e,
+  0xff, 0xff, 0xac, 0xff, 0xff, 0x00, 0xe4, 0x20, 0xff, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x1c, 0xba, 0xf6, 0xff,  //.%@@
-  0xae, 0x82, 0x08, 0x00,  //%%..
-  0xee, 0x0e, 0x00, 0x00,  //@...
-  0xee, 0x0e, 0x00, 0x00,  //@...
-  0xb0, 0x82, 0x06, 0x00,  //%%..
-  0x1e, 0xbc, 0xf6, 0xff,  //.%@@
-  0x08, 0xff, 0x00, 0x00,  //.@..
-  0xee, 0xcc, 0x00, 0x00,  //@@..
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x1d, 0x1c, 0xba, 0xf6, 0xff, 0xae, 0x82, 0x08, 0x00, 0xee, 0x0e, 0x00, 0x00, 0xee,
+  0x0e, 0x00, 0x00, 0xb0, 0x82, 0x06, 0x00, 0x1e, 0xbc, 0xf6, 0xff, 0x08, 0xff, 0x00, 0x00, 0xee,
+  0xcc, 0xfb, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 4 */
-  0x70, 0x00, 0x00, 0x00,  //+...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0x70, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe, 0x00,
+  0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 4 */
-  0x00, 0x76, 0x68, 0x00,  //.++.
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x03, 0x00, 0x76, 0x68, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe,
+  0x00, 0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 4 */
-  0x76, 0x76, 0x00, 0x00,  //++..
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x03, 0x76, 0x76, 0x00, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe,
+  0x00, 0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 4 */
-  0xff, 0x00, 0xff, 0x00,  //@.@.
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x03, 0xff, 0x00, 0xff, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfe,
+  0x00, 0xfd, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 3 */
-  0x70, 0x00, 0x00,  //+..
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x02, 0x70, 0x00, 0x00, 0xfe, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 3 */
-  0x00, 0x76, 0x68,  //.++
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x02, 0x00, 0x76, 0x68, 0xfe, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 3 */
-  0x2c, 0x94, 0x2c,  //.%.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x02, 0x2c, 0x94, 0x2c, 0xfe, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 3 */
-  0xff, 0x00, 0xff,  //@.@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0x01, 0xff, 0x00, 0xfd, 0xff, 0x0b, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0xff, 0xf6, 0xc2, 0x26,  //.@@@.
-  0x00, 0xff, 0x06, 0x6e, 0xb8,  //.@.+%
-  0x00, 0xff, 0x00, 0x0a, 0xee,  //.@..@
-  0xff, 0xff, 0xff, 0x0a, 0xee,  //@@@.@
-  0x00, 0xff, 0x06, 0x6c, 0xba,  //.@.+%
-  0x00, 0xff, 0xf6, 0xc4, 0x28,  //.@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0d, 0xff, 0xf6, 0xc2, 0x26, 0x00, 0xff, 0x06, 0x6e, 0xb8, 0x00, 0xff, 0x00, 0x0a,
+  0xee, 0xfe, 0xff, 0x0b, 0x0a, 0xee, 0x00, 0xff, 0x06, 0x6c, 0xba, 0x00, 0xff, 0xf6, 0xc4, 0x28,
+  0xf2, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 4 */
-  0x00, 0xda, 0xd8, 0x00,  //.@@.
-  0xff, 0x74, 0x00, 0xff,  //@+.@
-  0xff, 0xe6, 0x08, 0xff,  //@@.@
-  0xff, 0xb6, 0x6e, 0xff,  //@%+@
-  0xff, 0x4a, 0xe4, 0xff,  //@+@@
-  0xff, 0x00, 0xda, 0xff,  //@.@@
-  0xff, 0x00, 0x6e, 0xff,  //@.+@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xda, 0xd8, 0x00, 0xff, 0x74, 0x00, 0xff, 0xff, 0xe6, 0x08, 0xff, 0xff, 0xb6, 0x6e,
+  0xff, 0xff, 0x4a, 0xe4, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0x6e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 4 */
-  0x70, 0x00, 0x00, 0x00,  //+...
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0x70, 0xfe, 0x00, 0x17, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06,
+  0xf2, 0xf2, 0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 4 */
-  0x00, 0x76, 0x68, 0x00,  //.++.
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x68, 0x00, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06,
+  0xf2, 0xf2, 0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 4 */
-  0x00, 0x76, 0x76, 0x00,  //.++.
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x76, 0x00, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06,
+  0xf2, 0xf2, 0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 4 */
-  0x00, 0xda, 0xd8, 0x00,  //.@@.
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xda, 0xd8, 0x00, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06,
+  0xf2, 0xf2, 0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 4 */
-  0x00, 0xff, 0xff, 0x00,  //.@@.
-  0x40, 0xe2, 0xe2, 0x3e,  //+@@.
-  0xca, 0x4e, 0x4e, 0xc6,  //@++@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xf2, 0x06, 0x06, 0xf2,  //@..@
-  0xca, 0x4c, 0x4c, 0xc8,  //@++@
-  0x42, 0xe2, 0xe2, 0x40,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xff, 0xff, 0x00, 0x40, 0xe2, 0xe2, 0x3e, 0xca, 0x4e, 0x4e, 0xc6, 0xf2, 0x06, 0x06,
+  0xf2, 0xf2, 0x06, 0x06, 0xf2, 0xca, 0x4c, 0x4c, 0xc8, 0x42, 0xe2, 0xe2, 0x40, 0xf5, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x9e, 0x1e, 0x1e, 0x9e,  //%..%
-  0x1e, 0xbe, 0xbe, 0x1e,  //.%%.
-  0x20, 0xbe, 0xbe, 0x1e,  //.%%.
-  0x9e, 0x1e, 0x1e, 0x9c,  //%..%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0x9e, 0x1e, 0x1e, 0x9e, 0x1e, 0xbe, 0xbe, 0x1e, 0x20, 0xbe, 0xbe, 0x1e, 0x9e,
+  0x1e, 0x1e, 0x9c, 0xf5, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00,  //......
-  0x00, 0x4a, 0xe6, 0xca, 0x7a, 0x20,  //.+@@+.
-  0x00, 0xd2, 0x4c, 0x6c, 0xb8, 0x00,  //.@++%.
-  0x00, 0xf6, 0x16, 0x7c, 0xec, 0x00,  //.@.+@.
-  0x00, 0xf0, 0x7e, 0x10, 0xf6, 0x00,  //.@+.@.
-  0x00, 0xcc, 0x60, 0x4c, 0xd0, 0x00,  //.@++@.
-  0x7a, 0x74, 0xd0, 0xe6, 0x4a, 0x00,  //++@@+.
-  0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xfd, 0x00, 0x26, 0x02, 0x00, 0x00, 0x4a, 0xe6, 0xca, 0x7a, 0x20, 0x00, 0xd2, 0x4c, 0x6c, 0xb8,
+  0x00, 0x00, 0xf6, 0x16, 0x7c, 0xec, 0x00, 0x00, 0xf0, 0x7e, 0x10, 0xf6, 0x00, 0x00, 0xcc, 0x60,
+  0x4c, 0xd0, 0x00, 0x7a, 0x74, 0xd0, 0xe6, 0x4a, 0x00, 0x12, 0xf0, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 4 */
-  0x70, 0x00, 0x00, 0x00,  //+...
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xfc, 0x00, 0x00, 0xfc,  //@..@
-  0xe8, 0x2c, 0x30, 0xe8,  //@..@
-  0x5a, 0xe8, 0xe8, 0x5a,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0x70, 0xfe, 0x00, 0x17, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xfc, 0x00, 0x00, 0xfc, 0xe8, 0x2c, 0x30, 0xe8, 0x5a, 0xe8, 0xe8, 0x5a, 0xf5, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 4 */
-  0x00, 0x76, 0x68, 0x00,  //.++.
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xfc, 0x00, 0x00, 0xfc,  //@..@
-  0xe8, 0x2c, 0x30, 0xe8,  //@..@
-  0x5a, 0xe8, 0xe8, 0x5a,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x68, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xfc, 0x00, 0x00, 0xfc, 0xe8, 0x2c, 0x30, 0xe8, 0x5a, 0xe8, 0xe8, 0x5a, 0xf5, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 4 */
-  0x00, 0x76, 0x76, 0x00,  //.++.
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xfc, 0x00, 0x00, 0xfc,  //@..@
-  0xe8, 0x2c, 0x30, 0xe8,  //@..@
-  0x5a, 0xe8, 0xe8, 0x5a,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0x76, 0x76, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xfc, 0x00, 0x00, 0xfc, 0xe8, 0x2c, 0x30, 0xe8, 0x5a, 0xe8, 0xe8, 0x5a, 0xf5, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 4 */
-  0x00, 0xff, 0xff, 0x00,  //.@@.
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xfc, 0x00, 0x00, 0xfc,  //@..@
-  0xe8, 0x2c, 0x30, 0xe8,  //@..@
-  0x5a, 0xe8, 0xe8, 0x5a,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xfc, 0x00, 0x00, 0xfc, 0xe8, 0x2c, 0x30, 0xe8, 0x5a, 0xe8, 0xe8, 0x5a, 0xf5, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 5 */
-  0x00, 0x00, 0x76, 0x68, 0x00,  //..++.
-  0xb2, 0x74, 0x00, 0x74, 0xb0,  //%+.+%
-  0x20, 0xea, 0x3a, 0xea, 0x1e,  //.@.@.
-  0x00, 0x7c, 0xf8, 0x7c, 0x00,  //.+@+.
-  0x00, 0x06, 0xff, 0x06, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0x17, 0x00, 0x00, 0x76, 0x68, 0x00, 0xb2, 0x74, 0x00, 0x74, 0xb0, 0x20, 0xea, 0x3a, 0xea, 0x1e,
+  0x00, 0x7c, 0xf8, 0x7c, 0x00, 0x00, 0x06, 0xff, 0x06, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00,
+  0xff, 0xf0, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0xff, 0xee, 0x80,  //@@@%
-  0xff, 0x00, 0x34, 0xf2,  //@..@
-  0xff, 0xff, 0xf0, 0x82,  //@@@%
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0c, 0xff, 0xff, 0xee, 0x80, 0xff, 0x00, 0x34, 0xf2, 0xff,
+  0xff, 0xf0, 0x82, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xf2, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 4 */
-  0x60, 0xea, 0xea, 0x5a,  //+@@+
-  0xe8, 0x30, 0x3c, 0xe2,  //@..@
-  0xff, 0x00, 0xb2, 0x6a,  //@.%+
-  0xff, 0x00, 0xe4, 0x00,  //@.@.
-  0xff, 0x00, 0x1e, 0x88,  //@..%
-  0xff, 0x00, 0x12, 0xf0,  //@..@
-  0xff, 0x00, 0xfc, 0xa8,  //@.@%
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x60, 0xea, 0xea, 0x5a, 0xe8, 0x30, 0x3c, 0xe2, 0xff, 0x00, 0xb2, 0x6a, 0xff, 0x00, 0xe4,
+  0x00, 0xff, 0x00, 0x1e, 0x88, 0xff, 0x00, 0x12, 0xf0, 0xff, 0x00, 0xfc, 0xa8, 0xf5, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x5a, 0x5e, 0x00, 0x00,  //++..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x01, 0x5a, 0x5e, 0xfb, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea, 0xff, 0xfa,
+  0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x5e, 0x5a, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x5e, 0x5a, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea, 0xff, 0xfa,
+  0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0x82, 0x60, 0x00,  //+%+.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x02, 0x60, 0x82, 0x60, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea, 0xff,
+  0xfa, 0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xac, 0x7c, 0xf4, 0x00,  //%+@.
-  0xf4, 0x7c, 0xac, 0x00,  //@+%.
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xac, 0x7c, 0xf4, 0x00, 0xf4, 0x7c, 0xac, 0x00, 0xff, 0xff, 0xe8, 0x8a, 0x76,
+  0xea, 0xff, 0xfa, 0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0xff, 0x00,  //@.@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea, 0xff,
+  0xfa, 0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 4 */
-  0xc4, 0xc2, 0x00, 0x00,  //@@..
-  0xc6, 0xc4, 0x00, 0x00,  //@@..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0xff, 0xe8, 0x8a,  //@@@%
-  0x76, 0xea, 0xff, 0xfa,  //+@@@
-  0xf2, 0x38, 0x3c, 0xff,  //@..@
-  0x94, 0xf4, 0x8e, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x05, 0xc4, 0xc2, 0x00, 0x00, 0xc6, 0xc4, 0xfb, 0x00, 0x0f, 0xff, 0xff, 0xe8, 0x8a, 0x76, 0xea,
+  0xff, 0xfa, 0xf2, 0x38, 0x3c, 0xff, 0x94, 0xf4, 0x8e, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xfc, 0xa4, 0xf0, 0xb2,  //@%@%
-  0xb6, 0xff, 0xff, 0xfc,  //%@@@
-  0xf8, 0xff, 0x20, 0x00,  //@@..
-  0xc4, 0x80, 0xec, 0xff,  //@%@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf5, 0x00, 0x0f, 0xfc, 0xa4, 0xf0, 0xb2, 0xb6, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0x20, 0x00, 0xc4,
+  0x80, 0xec, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x60, 0xec, 0xff,  //+@@
-  0xea, 0x34, 0x00,  //@..
-  0xea, 0x34, 0x00,  //@..
-  0x60, 0xec, 0xff,  //+@@
-  0x08, 0xff, 0x00,  //.@.
-  0xee, 0xcc, 0x00,  //@@.
-  0x00, 0x00, 0x00,  //...
-
+  0xf8, 0x00, 0x10, 0x60, 0xec, 0xff, 0xea, 0x34, 0x00, 0xea, 0x34, 0x00, 0x60, 0xec, 0xff, 0x08,
+  0xff, 0x00, 0xee, 0xcc, 0xfd, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x5a, 0x5e, 0x00, 0x00,  //++..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x4e, 0xe0, 0xf2, 0x86,  //+@@%
-  0xe6, 0xff, 0xff, 0xfa,  //@@@@
-  0xe4, 0x3c, 0x00, 0x00,  //@...
-  0x4a, 0xda, 0xfc, 0xff,  //+@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x01, 0x5a, 0x5e, 0xfb, 0x00, 0x0f, 0x4e, 0xe0, 0xf2, 0x86, 0xe6, 0xff, 0xff, 0xfa,
+  0xe4, 0x3c, 0x00, 0x00, 0x4a, 0xda, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x5e, 0x5a, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x4e, 0xe0, 0xf2, 0x86,  //+@@%
-  0xe6, 0xff, 0xff, 0xfa,  //@@@@
-  0xe4, 0x3c, 0x00, 0x00,  //@...
-  0x4a, 0xda, 0xfc, 0xff,  //+@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x5e, 0x5a, 0xfc, 0x00, 0x0f, 0x4e, 0xe0, 0xf2, 0x86, 0xe6, 0xff, 0xff, 0xfa,
+  0xe4, 0x3c, 0x00, 0x00, 0x4a, 0xda, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0x82, 0x60, 0x00,  //+%+.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x4e, 0xe0, 0xf2, 0x86,  //+@@%
-  0xe6, 0xff, 0xff, 0xfa,  //@@@@
-  0xe4, 0x3c, 0x00, 0x00,  //@...
-  0x4a, 0xda, 0xfc, 0xff,  //+@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x02, 0x60, 0x82, 0x60, 0xfc, 0x00, 0x0f, 0x4e, 0xe0, 0xf2, 0x86, 0xe6, 0xff, 0xff,
+  0xfa, 0xe4, 0x3c, 0x00, 0x00, 0x4a, 0xda, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0xff, 0x00,  //@.@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x4e, 0xe0, 0xf2, 0x86,  //+@@%
-  0xe6, 0xff, 0xff, 0xfa,  //@@@@
-  0xe4, 0x3c, 0x00, 0x00,  //@...
-  0x4a, 0xda, 0xfc, 0xff,  //+@@@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x0f, 0x4e, 0xe0, 0xf2, 0x86, 0xe6, 0xff, 0xff,
+  0xfa, 0xe4, 0x3c, 0x00, 0x00, 0x4a, 0xda, 0xfc, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x5a, 0x5e, 0x00,  //++.
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x01, 0x5a, 0x5e, 0xfd, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+  0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x5e, 0x5a,  //.++
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfd, 0x00, 0x01, 0x5e, 0x5a, 0xfe, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+  0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x60, 0x82, 0x60,  //+%+
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x02, 0x60, 0x82, 0x60, 0xfe, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0xff, 0x00, 0xff,  //@.@
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0x00,  //@@.
-  0x00, 0xff, 0x00,  //.@.
-  0x00, 0xff, 0x00,  //.@.
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x08, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 4 */
-  0x3c, 0xda, 0x48, 0x28,  //.@+.
-  0x20, 0xec, 0xac, 0x04,  //.@%.
-  0x22, 0x40, 0xec, 0x34,  //.+@.
-  0x5e, 0xea, 0xff, 0xbc,  //+@@%
-  0xea, 0x32, 0x28, 0xf4,  //@..@
-  0xea, 0x2e, 0x30, 0xdc,  //@..@
-  0x5e, 0xea, 0xe6, 0x4e,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x1b, 0x3c, 0xda, 0x48, 0x28, 0x20, 0xec, 0xac, 0x04, 0x22, 0x40, 0xec, 0x34, 0x5e, 0xea, 0xff,
+  0xbc, 0xea, 0x32, 0x28, 0xf4, 0xea, 0x2e, 0x30, 0xdc, 0x5e, 0xea, 0xe6, 0x4e, 0xf5, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xac, 0x7c, 0xf4, 0x00,  //%+@.
-  0xf4, 0x7c, 0xac, 0x00,  //@+%.
-  0xff, 0x8c, 0xf4, 0x88,  //@%@%
-  0xff, 0x38, 0x2a, 0xf2,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x17, 0xac, 0x7c, 0xf4, 0x00, 0xf4, 0x7c, 0xac, 0x00, 0xff, 0x8c, 0xf4, 0x88, 0xff,
+  0x38, 0x2a, 0xf2, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x5a, 0x5e, 0x00, 0x00,  //++..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x01, 0x5a, 0x5e, 0xfb, 0x00, 0x0f, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e, 0x2e, 0xea,
+  0xea, 0x2e, 0x2e, 0xea, 0x60, 0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x5e, 0x5a, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x5e, 0x5a, 0xfc, 0x00, 0x0f, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e, 0x2e, 0xea,
+  0xea, 0x2e, 0x2e, 0xea, 0x60, 0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x6c, 0x6c, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x6c, 0x6c, 0xfc, 0x00, 0x0f, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e, 0x2e, 0xea,
+  0xea, 0x2e, 0x2e, 0xea, 0x60, 0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0xb6, 0xb4, 0x00,  //.%%.
-  0x00, 0xb4, 0xb6, 0x00,  //.%%.
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x16, 0xb6, 0xb4, 0x00, 0x00, 0xb4, 0xb6, 0x00, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e,
+  0x2e, 0xea, 0xea, 0x2e, 0x2e, 0xea, 0x60, 0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x60, 0xea, 0xea, 0x5e,  //+@@+
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0xea, 0x2e, 0x2e, 0xea,  //@..@
-  0x60, 0xea, 0xea, 0x60,  //+@@+
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x0f, 0x60, 0xea, 0xea, 0x5e, 0xea, 0x2e,
+  0x2e, 0xea, 0xea, 0x2e, 0x2e, 0xea, 0x60, 0xea, 0xea, 0x60, 0xf5, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf5, 0x00, 0x00, 0xff, 0xfa, 0x00, 0xfc, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xf0, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x04,  //......
-  0x00, 0x72, 0xee, 0xc8, 0x9a, 0x14,  //.+@@%.
-  0x00, 0xf2, 0x36, 0x82, 0xc8, 0x00,  //.@.%@.
-  0x00, 0xca, 0x82, 0x36, 0xf2, 0x00,  //.@%.@.
-  0x38, 0x9a, 0xc8, 0xf0, 0x76, 0x00,  //.%@@+.
-  0x14, 0x06, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xf1, 0x00, 0x1b, 0x08, 0x04, 0x00, 0x72, 0xee, 0xc8, 0x9a, 0x14, 0x00, 0xf2, 0x36, 0x82, 0xc8,
+  0x00, 0x00, 0xca, 0x82, 0x36, 0xf2, 0x00, 0x38, 0x9a, 0xc8, 0xf0, 0x76, 0x00, 0x14, 0x06, 0xf1,
+  0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x5a, 0x5e, 0x00, 0x00,  //++..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xf2, 0x2a, 0x38, 0xff,  //@..@
-  0x88, 0xf4, 0x8c, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x01, 0x5a, 0x5e, 0xfb, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xf2, 0x2a, 0x38, 0xff, 0x88, 0xf4, 0x8c, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x5e, 0x5a, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xf2, 0x2a, 0x38, 0xff,  //@..@
-  0x88, 0xf4, 0x8c, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x5e, 0x5a, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xf2, 0x2a, 0x38, 0xff, 0x88, 0xf4, 0x8c, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x6c, 0x6c, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xf2, 0x2a, 0x38, 0xff,  //@..@
-  0x88, 0xf4, 0x8c, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x6c, 0x6c, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xf2, 0x2a, 0x38, 0xff, 0x88, 0xf4, 0x8c, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xff, 0x00, 0x00, 0xff,  //@..@
-  0xf2, 0x2a, 0x38, 0xff,  //@..@
-  0x88, 0xf4, 0x8c, 0xff,  //%@%@
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0xff, 0xf2, 0x2a, 0x38, 0xff, 0x88, 0xf4, 0x8c, 0xff, 0xf5, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x5e, 0x5a, 0x00,  //.++.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xd0, 0x3e, 0x52, 0xc4,  //@.+@
-  0x72, 0x9c, 0xc2, 0x52,  //+%@+
-  0x16, 0xf4, 0xde, 0x02,  //.@@.
-  0x00, 0xbe, 0x7c, 0x00,  //.%+.
-  0x18, 0xec, 0x1c, 0x00,  //.@..
-  0xfa, 0x8c, 0x00, 0x00,  //@%..
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xfc, 0x00, 0x01, 0x5e, 0x5a, 0xfc, 0x00, 0x15, 0xd0, 0x3e, 0x52, 0xc4, 0x72, 0x9c, 0xc2, 0x52,
+  0x16, 0xf4, 0xde, 0x02, 0x00, 0xbe, 0x7c, 0x00, 0x18, 0xec, 0x1c, 0x00, 0xfa, 0x8c, 0xfb, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 4 */
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x9a, 0xee, 0x64,  //@%@+
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x2e, 0x2e, 0xea,  //@..@
-  0xff, 0x9a, 0xee, 0x64,  //@%@+
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0xff, 0x00, 0x00, 0x00,  //@...
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x10, 0xff, 0x9a, 0xee,
+  0x64, 0xff, 0x2e, 0x2e, 0xea, 0xff, 0x2e, 0x2e, 0xea, 0xff, 0x9a, 0xee, 0x64, 0xff, 0xfe, 0x00,
+  0x00, 0xff, 0xfa, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xff, 0x00, 0xff, 0x00,  //@.@.
-  0x00, 0x00, 0x00, 0x00,  //....
-  0xd0, 0x3e, 0x52, 0xc4,  //@.+@
-  0x72, 0x9c, 0xc2, 0x52,  //+%@+
-  0x16, 0xf4, 0xde, 0x02,  //.@@.
-  0x00, 0xbe, 0x7c, 0x00,  //.%+.
-  0x18, 0xec, 0x1c, 0x00,  //.@..
-  0xfa, 0x8c, 0x00, 0x00,  //@%..
-  0x00, 0x00, 0x00, 0x00,  //....
-
-
+  0xfd, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfc, 0x00, 0x15, 0xd0, 0x3e, 0x52, 0xc4, 0x72, 0x9c, 0xc2,
+  0x52, 0x16, 0xf4, 0xde, 0x02, 0x00, 0xbe, 0x7c, 0x00, 0x18, 0xec, 0x1c, 0x00, 0xfa, 0x8c, 0xfb,
+  0x00,
 
 #endif
 };
@@ -5019,395 +1333,395 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_latin_sup_10_glyph_dsc[]
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 1
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 1,	.glyph_index = 10},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 3,	.glyph_index = 20},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 4,	.glyph_index = 30},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 3,	.glyph_index = 40},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 5,	.glyph_index = 50},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 1,	.glyph_index = 60},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 3,	.glyph_index = 70},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 3,	.glyph_index = 80},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 5,	.glyph_index = 90},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 4,	.glyph_index = 100},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 4,	.glyph_index = 110},	/*Unicode: U+00ab («)*/
-  {.w_px = 4,	.glyph_index = 120},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 2,	.glyph_index = 130},	/*Unicode: U+00ad (­)*/
-  {.w_px = 5,	.glyph_index = 140},	/*Unicode: U+00ae (®)*/
-  {.w_px = 2,	.glyph_index = 150},	/*Unicode: U+00af (¯)*/
-  {.w_px = 2,	.glyph_index = 160},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 5,	.glyph_index = 170},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 2,	.glyph_index = 180},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 2,	.glyph_index = 190},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 2,	.glyph_index = 200},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 5,	.glyph_index = 210},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 4,	.glyph_index = 220},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 1,	.glyph_index = 230},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 2,	.glyph_index = 240},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 3,	.glyph_index = 250},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 3,	.glyph_index = 260},	/*Unicode: U+00ba (º)*/
-  {.w_px = 4,	.glyph_index = 270},	/*Unicode: U+00bb (»)*/
-  {.w_px = 4,	.glyph_index = 280},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 4,	.glyph_index = 290},	/*Unicode: U+00bd (½)*/
-  {.w_px = 4,	.glyph_index = 300},	/*Unicode: U+00be (¾)*/
-  {.w_px = 3,	.glyph_index = 310},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 4,	.glyph_index = 320},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 4,	.glyph_index = 330},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 4,	.glyph_index = 340},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 4,	.glyph_index = 360},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 4,	.glyph_index = 370},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 4,	.glyph_index = 380},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 4,	.glyph_index = 400},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 4,	.glyph_index = 410},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 4,	.glyph_index = 420},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 4,	.glyph_index = 430},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 3,	.glyph_index = 440},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 3,	.glyph_index = 450},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 3,	.glyph_index = 460},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 3,	.glyph_index = 470},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 5,	.glyph_index = 480},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 4,	.glyph_index = 490},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 4,	.glyph_index = 500},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 4,	.glyph_index = 510},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 4,	.glyph_index = 520},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 4,	.glyph_index = 530},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 4,	.glyph_index = 540},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 6,	.glyph_index = 560},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 4,	.glyph_index = 570},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 4,	.glyph_index = 580},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 4,	.glyph_index = 590},	/*Unicode: U+00db (Û)*/
-  {.w_px = 4,	.glyph_index = 600},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 5,	.glyph_index = 610},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 4,	.glyph_index = 620},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 4,	.glyph_index = 630},	/*Unicode: U+00df (ß)*/
-  {.w_px = 4,	.glyph_index = 640},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 4,	.glyph_index = 660},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 4,	.glyph_index = 680},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 4,	.glyph_index = 700},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 3,	.glyph_index = 710},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 4,	.glyph_index = 720},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 4,	.glyph_index = 740},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 4,	.glyph_index = 750},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 3,	.glyph_index = 760},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 3,	.glyph_index = 770},	/*Unicode: U+00ed (í)*/
-  {.w_px = 3,	.glyph_index = 780},	/*Unicode: U+00ee (î)*/
-  {.w_px = 3,	.glyph_index = 790},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 4,	.glyph_index = 800},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 4,	.glyph_index = 820},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 4,	.glyph_index = 830},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 4,	.glyph_index = 840},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 4,	.glyph_index = 850},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 4,	.glyph_index = 860},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 5,	.glyph_index = 870},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 6,	.glyph_index = 880},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 4,	.glyph_index = 890},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 4,	.glyph_index = 900},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 4,	.glyph_index = 910},	/*Unicode: U+00fb (û)*/
-  {.w_px = 4,	.glyph_index = 920},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 4,	.glyph_index = 930},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 4,	.glyph_index = 950},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 3,	.glyph_index = 10},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 4,	.glyph_index = 21},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 3,	.glyph_index = 31},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 5,	.glyph_index = 39},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 1,	.glyph_index = 49},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 3,	.glyph_index = 60},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 3,	.glyph_index = 71},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 5,	.glyph_index = 76},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 4,	.glyph_index = 86},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 4,	.glyph_index = 95},	/*Unicode: U+00ab («)*/
+  {.w_px = 4,	.glyph_index = 104},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 2,	.glyph_index = 111},	/*Unicode: U+00ad (­)*/
+  {.w_px = 5,	.glyph_index = 117},	/*Unicode: U+00ae (®)*/
+  {.w_px = 2,	.glyph_index = 127},	/*Unicode: U+00af (¯)*/
+  {.w_px = 2,	.glyph_index = 132},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 5,	.glyph_index = 138},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 2,	.glyph_index = 147},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 2,	.glyph_index = 154},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 2,	.glyph_index = 161},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 5,	.glyph_index = 163},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 4,	.glyph_index = 172},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 1,	.glyph_index = 182},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 2,	.glyph_index = 188},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 3,	.glyph_index = 194},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 3,	.glyph_index = 201},	/*Unicode: U+00ba (º)*/
+  {.w_px = 4,	.glyph_index = 210},	/*Unicode: U+00bb (»)*/
+  {.w_px = 4,	.glyph_index = 219},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 4,	.glyph_index = 230},	/*Unicode: U+00bd (½)*/
+  {.w_px = 4,	.glyph_index = 241},	/*Unicode: U+00be (¾)*/
+  {.w_px = 3,	.glyph_index = 252},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 4,	.glyph_index = 262},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 4,	.glyph_index = 271},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 4,	.glyph_index = 280},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 4,	.glyph_index = 289},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 4,	.glyph_index = 296},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 4,	.glyph_index = 303},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 4,	.glyph_index = 313},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 4,	.glyph_index = 323},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 4,	.glyph_index = 334},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 4,	.glyph_index = 344},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 4,	.glyph_index = 354},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 4,	.glyph_index = 364},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 3,	.glyph_index = 374},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 3,	.glyph_index = 383},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 3,	.glyph_index = 392},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 3,	.glyph_index = 401},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 5,	.glyph_index = 410},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 4,	.glyph_index = 420},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 4,	.glyph_index = 430},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 4,	.glyph_index = 439},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 4,	.glyph_index = 448},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 4,	.glyph_index = 457},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 4,	.glyph_index = 466},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 4,	.glyph_index = 475},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 6,	.glyph_index = 484},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 4,	.glyph_index = 493},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 4,	.glyph_index = 501},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 4,	.glyph_index = 509},	/*Unicode: U+00db (Û)*/
+  {.w_px = 4,	.glyph_index = 517},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 5,	.glyph_index = 525},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 4,	.glyph_index = 533},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 4,	.glyph_index = 543},	/*Unicode: U+00df (ß)*/
+  {.w_px = 4,	.glyph_index = 553},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 4,	.glyph_index = 562},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 4,	.glyph_index = 571},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 4,	.glyph_index = 581},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 4,	.glyph_index = 591},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 4,	.glyph_index = 601},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 4,	.glyph_index = 611},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 3,	.glyph_index = 620},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 4,	.glyph_index = 630},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 4,	.glyph_index = 639},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 4,	.glyph_index = 648},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 4,	.glyph_index = 658},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 3,	.glyph_index = 668},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 3,	.glyph_index = 677},	/*Unicode: U+00ed (í)*/
+  {.w_px = 3,	.glyph_index = 686},	/*Unicode: U+00ee (î)*/
+  {.w_px = 3,	.glyph_index = 696},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 4,	.glyph_index = 706},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 4,	.glyph_index = 716},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 4,	.glyph_index = 725},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 4,	.glyph_index = 734},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 4,	.glyph_index = 743},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 4,	.glyph_index = 752},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 4,	.glyph_index = 762},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 5,	.glyph_index = 772},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 6,	.glyph_index = 782},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 4,	.glyph_index = 791},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 4,	.glyph_index = 799},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 4,	.glyph_index = 807},	/*Unicode: U+00fb (û)*/
+  {.w_px = 4,	.glyph_index = 815},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 4,	.glyph_index = 825},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 4,	.glyph_index = 835},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 4,	.glyph_index = 845},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 2
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 1,	.glyph_index = 10},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 3,	.glyph_index = 20},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 4,	.glyph_index = 30},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 3,	.glyph_index = 40},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 5,	.glyph_index = 50},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 1,	.glyph_index = 70},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 3,	.glyph_index = 80},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 3,	.glyph_index = 90},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 5,	.glyph_index = 100},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 4,	.glyph_index = 120},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 4,	.glyph_index = 130},	/*Unicode: U+00ab («)*/
-  {.w_px = 4,	.glyph_index = 140},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 2,	.glyph_index = 150},	/*Unicode: U+00ad (­)*/
-  {.w_px = 5,	.glyph_index = 160},	/*Unicode: U+00ae (®)*/
-  {.w_px = 2,	.glyph_index = 180},	/*Unicode: U+00af (¯)*/
-  {.w_px = 2,	.glyph_index = 190},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 5,	.glyph_index = 200},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 2,	.glyph_index = 220},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 2,	.glyph_index = 230},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 2,	.glyph_index = 240},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 5,	.glyph_index = 250},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 4,	.glyph_index = 270},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 1,	.glyph_index = 280},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 2,	.glyph_index = 290},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 3,	.glyph_index = 300},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 3,	.glyph_index = 310},	/*Unicode: U+00ba (º)*/
-  {.w_px = 4,	.glyph_index = 320},	/*Unicode: U+00bb (»)*/
-  {.w_px = 4,	.glyph_index = 330},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 4,	.glyph_index = 340},	/*Unicode: U+00bd (½)*/
-  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+00be (¾)*/
-  {.w_px = 3,	.glyph_index = 360},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 4,	.glyph_index = 370},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 4,	.glyph_index = 380},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 4,	.glyph_index = 400},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 4,	.glyph_index = 410},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 4,	.glyph_index = 420},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 4,	.glyph_index = 430},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 4,	.glyph_index = 440},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 4,	.glyph_index = 460},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 4,	.glyph_index = 470},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 4,	.glyph_index = 480},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 3,	.glyph_index = 490},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 3,	.glyph_index = 500},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 3,	.glyph_index = 510},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 3,	.glyph_index = 520},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 5,	.glyph_index = 530},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 4,	.glyph_index = 560},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 4,	.glyph_index = 570},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 4,	.glyph_index = 580},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 4,	.glyph_index = 590},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 4,	.glyph_index = 600},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 4,	.glyph_index = 610},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 6,	.glyph_index = 620},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 4,	.glyph_index = 640},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 4,	.glyph_index = 660},	/*Unicode: U+00db (Û)*/
-  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 5,	.glyph_index = 680},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 4,	.glyph_index = 700},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 4,	.glyph_index = 710},	/*Unicode: U+00df (ß)*/
-  {.w_px = 4,	.glyph_index = 720},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 4,	.glyph_index = 740},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 4,	.glyph_index = 750},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 4,	.glyph_index = 760},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 4,	.glyph_index = 770},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 4,	.glyph_index = 780},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 3,	.glyph_index = 790},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 4,	.glyph_index = 800},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 4,	.glyph_index = 820},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 4,	.glyph_index = 830},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 3,	.glyph_index = 840},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 3,	.glyph_index = 850},	/*Unicode: U+00ed (í)*/
-  {.w_px = 3,	.glyph_index = 860},	/*Unicode: U+00ee (î)*/
-  {.w_px = 3,	.glyph_index = 870},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 4,	.glyph_index = 880},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 4,	.glyph_index = 890},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 4,	.glyph_index = 900},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 4,	.glyph_index = 910},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 4,	.glyph_index = 920},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 4,	.glyph_index = 930},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 5,	.glyph_index = 950},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 6,	.glyph_index = 970},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 4,	.glyph_index = 990},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 4,	.glyph_index = 1000},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 4,	.glyph_index = 1010},	/*Unicode: U+00fb (û)*/
-  {.w_px = 4,	.glyph_index = 1020},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 4,	.glyph_index = 1030},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 4,	.glyph_index = 1040},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 4,	.glyph_index = 1050},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 3,	.glyph_index = 10},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 4,	.glyph_index = 21},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 3,	.glyph_index = 31},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 5,	.glyph_index = 39},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 1,	.glyph_index = 55},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 3,	.glyph_index = 66},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 3,	.glyph_index = 77},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 5,	.glyph_index = 82},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 4,	.glyph_index = 96},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 4,	.glyph_index = 105},	/*Unicode: U+00ab («)*/
+  {.w_px = 4,	.glyph_index = 114},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 2,	.glyph_index = 121},	/*Unicode: U+00ad (­)*/
+  {.w_px = 5,	.glyph_index = 127},	/*Unicode: U+00ae (®)*/
+  {.w_px = 2,	.glyph_index = 141},	/*Unicode: U+00af (¯)*/
+  {.w_px = 2,	.glyph_index = 146},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 5,	.glyph_index = 152},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 2,	.glyph_index = 165},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 2,	.glyph_index = 172},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 2,	.glyph_index = 179},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 5,	.glyph_index = 184},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 4,	.glyph_index = 200},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 1,	.glyph_index = 210},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 2,	.glyph_index = 216},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 3,	.glyph_index = 222},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 3,	.glyph_index = 229},	/*Unicode: U+00ba (º)*/
+  {.w_px = 4,	.glyph_index = 238},	/*Unicode: U+00bb (»)*/
+  {.w_px = 4,	.glyph_index = 247},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 4,	.glyph_index = 258},	/*Unicode: U+00bd (½)*/
+  {.w_px = 4,	.glyph_index = 269},	/*Unicode: U+00be (¾)*/
+  {.w_px = 3,	.glyph_index = 280},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 4,	.glyph_index = 290},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 4,	.glyph_index = 300},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 4,	.glyph_index = 310},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 4,	.glyph_index = 320},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 4,	.glyph_index = 330},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 4,	.glyph_index = 340},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 4,	.glyph_index = 360},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 4,	.glyph_index = 371},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 4,	.glyph_index = 381},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 4,	.glyph_index = 391},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 4,	.glyph_index = 401},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 3,	.glyph_index = 411},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 3,	.glyph_index = 420},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 3,	.glyph_index = 429},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 3,	.glyph_index = 438},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 5,	.glyph_index = 447},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 4,	.glyph_index = 463},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 4,	.glyph_index = 473},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 4,	.glyph_index = 483},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 4,	.glyph_index = 493},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 4,	.glyph_index = 503},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 4,	.glyph_index = 513},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 4,	.glyph_index = 523},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 6,	.glyph_index = 532},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 4,	.glyph_index = 549},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 4,	.glyph_index = 557},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 4,	.glyph_index = 565},	/*Unicode: U+00db (Û)*/
+  {.w_px = 4,	.glyph_index = 573},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 5,	.glyph_index = 581},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 4,	.glyph_index = 597},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 4,	.glyph_index = 607},	/*Unicode: U+00df (ß)*/
+  {.w_px = 4,	.glyph_index = 617},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 4,	.glyph_index = 627},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 4,	.glyph_index = 637},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 4,	.glyph_index = 647},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 4,	.glyph_index = 657},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 4,	.glyph_index = 667},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 4,	.glyph_index = 677},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 3,	.glyph_index = 686},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 4,	.glyph_index = 696},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 4,	.glyph_index = 706},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 4,	.glyph_index = 716},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 4,	.glyph_index = 726},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 3,	.glyph_index = 736},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 3,	.glyph_index = 746},	/*Unicode: U+00ed (í)*/
+  {.w_px = 3,	.glyph_index = 756},	/*Unicode: U+00ee (î)*/
+  {.w_px = 3,	.glyph_index = 766},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 4,	.glyph_index = 776},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 4,	.glyph_index = 786},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 4,	.glyph_index = 795},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 4,	.glyph_index = 805},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 4,	.glyph_index = 815},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 4,	.glyph_index = 825},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 4,	.glyph_index = 835},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 5,	.glyph_index = 845},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 6,	.glyph_index = 859},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 4,	.glyph_index = 872},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 4,	.glyph_index = 882},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 4,	.glyph_index = 892},	/*Unicode: U+00fb (û)*/
+  {.w_px = 4,	.glyph_index = 902},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 4,	.glyph_index = 912},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 4,	.glyph_index = 923},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 4,	.glyph_index = 933},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 4
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 1,	.glyph_index = 20},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 3,	.glyph_index = 30},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 4,	.glyph_index = 50},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 3,	.glyph_index = 70},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 5,	.glyph_index = 90},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 1,	.glyph_index = 120},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 3,	.glyph_index = 130},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 3,	.glyph_index = 150},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 5,	.glyph_index = 170},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 4,	.glyph_index = 200},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 4,	.glyph_index = 220},	/*Unicode: U+00ab («)*/
-  {.w_px = 4,	.glyph_index = 240},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 2,	.glyph_index = 260},	/*Unicode: U+00ad (­)*/
-  {.w_px = 5,	.glyph_index = 270},	/*Unicode: U+00ae (®)*/
-  {.w_px = 2,	.glyph_index = 300},	/*Unicode: U+00af (¯)*/
-  {.w_px = 2,	.glyph_index = 310},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 5,	.glyph_index = 320},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 2,	.glyph_index = 350},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 2,	.glyph_index = 360},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 2,	.glyph_index = 370},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 5,	.glyph_index = 380},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 4,	.glyph_index = 410},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 1,	.glyph_index = 430},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 2,	.glyph_index = 440},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 3,	.glyph_index = 450},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 3,	.glyph_index = 470},	/*Unicode: U+00ba (º)*/
-  {.w_px = 4,	.glyph_index = 490},	/*Unicode: U+00bb (»)*/
-  {.w_px = 4,	.glyph_index = 510},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 4,	.glyph_index = 530},	/*Unicode: U+00bd (½)*/
-  {.w_px = 4,	.glyph_index = 550},	/*Unicode: U+00be (¾)*/
-  {.w_px = 3,	.glyph_index = 570},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 4,	.glyph_index = 590},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 4,	.glyph_index = 610},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 4,	.glyph_index = 630},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 4,	.glyph_index = 650},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 4,	.glyph_index = 690},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 4,	.glyph_index = 710},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 4,	.glyph_index = 730},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 4,	.glyph_index = 750},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 4,	.glyph_index = 770},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 4,	.glyph_index = 790},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 4,	.glyph_index = 810},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 3,	.glyph_index = 830},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 3,	.glyph_index = 850},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 3,	.glyph_index = 870},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 3,	.glyph_index = 890},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 5,	.glyph_index = 910},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 4,	.glyph_index = 940},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 4,	.glyph_index = 960},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 4,	.glyph_index = 980},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 4,	.glyph_index = 1000},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 4,	.glyph_index = 1020},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 4,	.glyph_index = 1040},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 4,	.glyph_index = 1060},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 6,	.glyph_index = 1080},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 4,	.glyph_index = 1110},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 4,	.glyph_index = 1130},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 4,	.glyph_index = 1150},	/*Unicode: U+00db (Û)*/
-  {.w_px = 4,	.glyph_index = 1170},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 5,	.glyph_index = 1190},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 4,	.glyph_index = 1220},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 4,	.glyph_index = 1240},	/*Unicode: U+00df (ß)*/
-  {.w_px = 4,	.glyph_index = 1260},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 4,	.glyph_index = 1280},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 4,	.glyph_index = 1300},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 4,	.glyph_index = 1320},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 4,	.glyph_index = 1340},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 4,	.glyph_index = 1360},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 4,	.glyph_index = 1380},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 3,	.glyph_index = 1400},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 4,	.glyph_index = 1420},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 4,	.glyph_index = 1440},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 4,	.glyph_index = 1460},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 4,	.glyph_index = 1480},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 3,	.glyph_index = 1500},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 3,	.glyph_index = 1520},	/*Unicode: U+00ed (í)*/
-  {.w_px = 3,	.glyph_index = 1540},	/*Unicode: U+00ee (î)*/
-  {.w_px = 3,	.glyph_index = 1560},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 4,	.glyph_index = 1580},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 4,	.glyph_index = 1600},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 4,	.glyph_index = 1620},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 4,	.glyph_index = 1640},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 4,	.glyph_index = 1660},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 4,	.glyph_index = 1680},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 4,	.glyph_index = 1700},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 5,	.glyph_index = 1720},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 6,	.glyph_index = 1750},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 4,	.glyph_index = 1780},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 4,	.glyph_index = 1800},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 4,	.glyph_index = 1820},	/*Unicode: U+00fb (û)*/
-  {.w_px = 4,	.glyph_index = 1840},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 4,	.glyph_index = 1860},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 4,	.glyph_index = 1880},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 4,	.glyph_index = 1900},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 3,	.glyph_index = 11},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 4,	.glyph_index = 27},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 3,	.glyph_index = 44},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 5,	.glyph_index = 55},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 1,	.glyph_index = 77},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 3,	.glyph_index = 88},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 3,	.glyph_index = 107},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 5,	.glyph_index = 114},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 4,	.glyph_index = 134},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 4,	.glyph_index = 149},	/*Unicode: U+00ab («)*/
+  {.w_px = 4,	.glyph_index = 161},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 2,	.glyph_index = 170},	/*Unicode: U+00ad (­)*/
+  {.w_px = 5,	.glyph_index = 176},	/*Unicode: U+00ae (®)*/
+  {.w_px = 2,	.glyph_index = 196},	/*Unicode: U+00af (¯)*/
+  {.w_px = 2,	.glyph_index = 201},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 5,	.glyph_index = 207},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 2,	.glyph_index = 223},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 2,	.glyph_index = 230},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 2,	.glyph_index = 237},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 5,	.glyph_index = 242},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 4,	.glyph_index = 263},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 1,	.glyph_index = 275},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 2,	.glyph_index = 281},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 3,	.glyph_index = 287},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 3,	.glyph_index = 298},	/*Unicode: U+00ba (º)*/
+  {.w_px = 4,	.glyph_index = 313},	/*Unicode: U+00bb (»)*/
+  {.w_px = 4,	.glyph_index = 325},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 4,	.glyph_index = 344},	/*Unicode: U+00bd (½)*/
+  {.w_px = 4,	.glyph_index = 363},	/*Unicode: U+00be (¾)*/
+  {.w_px = 3,	.glyph_index = 382},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 4,	.glyph_index = 399},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 4,	.glyph_index = 416},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 4,	.glyph_index = 433},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 4,	.glyph_index = 450},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 4,	.glyph_index = 467},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 4,	.glyph_index = 484},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 4,	.glyph_index = 501},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 4,	.glyph_index = 518},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 4,	.glyph_index = 538},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 4,	.glyph_index = 555},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 4,	.glyph_index = 572},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 4,	.glyph_index = 589},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 3,	.glyph_index = 606},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 3,	.glyph_index = 623},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 3,	.glyph_index = 640},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 3,	.glyph_index = 657},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 5,	.glyph_index = 674},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 4,	.glyph_index = 697},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 4,	.glyph_index = 714},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 4,	.glyph_index = 731},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 4,	.glyph_index = 748},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 4,	.glyph_index = 765},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 4,	.glyph_index = 782},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 4,	.glyph_index = 799},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 6,	.glyph_index = 812},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 4,	.glyph_index = 836},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 4,	.glyph_index = 853},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 4,	.glyph_index = 870},	/*Unicode: U+00db (Û)*/
+  {.w_px = 4,	.glyph_index = 887},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 5,	.glyph_index = 904},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 4,	.glyph_index = 927},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 4,	.glyph_index = 943},	/*Unicode: U+00df (ß)*/
+  {.w_px = 4,	.glyph_index = 960},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 4,	.glyph_index = 977},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 4,	.glyph_index = 994},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 4,	.glyph_index = 1011},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 4,	.glyph_index = 1028},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 4,	.glyph_index = 1045},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 4,	.glyph_index = 1062},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 3,	.glyph_index = 1075},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 4,	.glyph_index = 1091},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 4,	.glyph_index = 1108},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 4,	.glyph_index = 1125},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 4,	.glyph_index = 1142},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 3,	.glyph_index = 1159},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 3,	.glyph_index = 1176},	/*Unicode: U+00ed (í)*/
+  {.w_px = 3,	.glyph_index = 1193},	/*Unicode: U+00ee (î)*/
+  {.w_px = 3,	.glyph_index = 1210},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 4,	.glyph_index = 1227},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 4,	.glyph_index = 1244},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 4,	.glyph_index = 1261},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 4,	.glyph_index = 1278},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 4,	.glyph_index = 1295},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 4,	.glyph_index = 1312},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 4,	.glyph_index = 1329},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 5,	.glyph_index = 1346},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 6,	.glyph_index = 1362},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 4,	.glyph_index = 1380},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 4,	.glyph_index = 1397},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 4,	.glyph_index = 1414},	/*Unicode: U+00fb (û)*/
+  {.w_px = 4,	.glyph_index = 1431},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 4,	.glyph_index = 1448},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 4,	.glyph_index = 1468},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 4,	.glyph_index = 1488},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10 == 8
   {.w_px = 3,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 1,	.glyph_index = 30},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 3,	.glyph_index = 40},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 4,	.glyph_index = 70},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 3,	.glyph_index = 110},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 5,	.glyph_index = 140},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 1,	.glyph_index = 190},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 3,	.glyph_index = 200},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 3,	.glyph_index = 230},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 5,	.glyph_index = 260},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 4,	.glyph_index = 310},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 4,	.glyph_index = 350},	/*Unicode: U+00ab («)*/
-  {.w_px = 4,	.glyph_index = 390},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 2,	.glyph_index = 430},	/*Unicode: U+00ad (­)*/
-  {.w_px = 5,	.glyph_index = 450},	/*Unicode: U+00ae (®)*/
-  {.w_px = 2,	.glyph_index = 500},	/*Unicode: U+00af (¯)*/
-  {.w_px = 2,	.glyph_index = 520},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 5,	.glyph_index = 540},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 2,	.glyph_index = 590},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 2,	.glyph_index = 610},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 2,	.glyph_index = 630},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 5,	.glyph_index = 650},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 4,	.glyph_index = 700},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 1,	.glyph_index = 740},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 2,	.glyph_index = 750},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 3,	.glyph_index = 770},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 3,	.glyph_index = 800},	/*Unicode: U+00ba (º)*/
-  {.w_px = 4,	.glyph_index = 830},	/*Unicode: U+00bb (»)*/
-  {.w_px = 4,	.glyph_index = 870},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 4,	.glyph_index = 910},	/*Unicode: U+00bd (½)*/
-  {.w_px = 4,	.glyph_index = 950},	/*Unicode: U+00be (¾)*/
-  {.w_px = 3,	.glyph_index = 990},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 4,	.glyph_index = 1020},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 4,	.glyph_index = 1060},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 4,	.glyph_index = 1100},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 4,	.glyph_index = 1140},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 4,	.glyph_index = 1180},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 4,	.glyph_index = 1220},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 4,	.glyph_index = 1260},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 4,	.glyph_index = 1300},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 4,	.glyph_index = 1340},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 4,	.glyph_index = 1380},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 4,	.glyph_index = 1420},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 4,	.glyph_index = 1460},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 3,	.glyph_index = 1500},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 3,	.glyph_index = 1530},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 3,	.glyph_index = 1560},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 3,	.glyph_index = 1590},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 5,	.glyph_index = 1620},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 4,	.glyph_index = 1670},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 4,	.glyph_index = 1710},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 4,	.glyph_index = 1750},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 4,	.glyph_index = 1790},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 4,	.glyph_index = 1830},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 4,	.glyph_index = 1870},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 4,	.glyph_index = 1910},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 6,	.glyph_index = 1950},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 4,	.glyph_index = 2010},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 4,	.glyph_index = 2050},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 4,	.glyph_index = 2090},	/*Unicode: U+00db (Û)*/
-  {.w_px = 4,	.glyph_index = 2130},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 5,	.glyph_index = 2170},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 4,	.glyph_index = 2220},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 4,	.glyph_index = 2260},	/*Unicode: U+00df (ß)*/
-  {.w_px = 4,	.glyph_index = 2300},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 4,	.glyph_index = 2340},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 4,	.glyph_index = 2380},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 4,	.glyph_index = 2420},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 4,	.glyph_index = 2460},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 4,	.glyph_index = 2500},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 4,	.glyph_index = 2540},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 3,	.glyph_index = 2580},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 4,	.glyph_index = 2610},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 4,	.glyph_index = 2650},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 4,	.glyph_index = 2690},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 4,	.glyph_index = 2730},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 3,	.glyph_index = 2770},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 3,	.glyph_index = 2800},	/*Unicode: U+00ed (í)*/
-  {.w_px = 3,	.glyph_index = 2830},	/*Unicode: U+00ee (î)*/
-  {.w_px = 3,	.glyph_index = 2860},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 4,	.glyph_index = 2890},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 4,	.glyph_index = 2930},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 4,	.glyph_index = 2970},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 4,	.glyph_index = 3010},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 4,	.glyph_index = 3050},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 4,	.glyph_index = 3090},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 4,	.glyph_index = 3130},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 5,	.glyph_index = 3170},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 6,	.glyph_index = 3220},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 4,	.glyph_index = 3280},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 4,	.glyph_index = 3320},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 4,	.glyph_index = 3360},	/*Unicode: U+00fb (û)*/
-  {.w_px = 4,	.glyph_index = 3400},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 4,	.glyph_index = 3440},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 4,	.glyph_index = 3480},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 4,	.glyph_index = 3520},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 1,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 3,	.glyph_index = 12},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 4,	.glyph_index = 33},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 3,	.glyph_index = 59},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 5,	.glyph_index = 73},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 1,	.glyph_index = 104},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 3,	.glyph_index = 115},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 3,	.glyph_index = 141},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 5,	.glyph_index = 149},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 4,	.glyph_index = 179},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 4,	.glyph_index = 201},	/*Unicode: U+00ab («)*/
+  {.w_px = 4,	.glyph_index = 221},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 2,	.glyph_index = 231},	/*Unicode: U+00ad (­)*/
+  {.w_px = 5,	.glyph_index = 238},	/*Unicode: U+00ae (®)*/
+  {.w_px = 2,	.glyph_index = 268},	/*Unicode: U+00af (¯)*/
+  {.w_px = 2,	.glyph_index = 275},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 5,	.glyph_index = 284},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 2,	.glyph_index = 302},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 2,	.glyph_index = 313},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 2,	.glyph_index = 324},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 5,	.glyph_index = 331},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 4,	.glyph_index = 361},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 1,	.glyph_index = 394},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 2,	.glyph_index = 400},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 3,	.glyph_index = 409},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 3,	.glyph_index = 422},	/*Unicode: U+00ba (º)*/
+  {.w_px = 4,	.glyph_index = 442},	/*Unicode: U+00bb (»)*/
+  {.w_px = 4,	.glyph_index = 462},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 4,	.glyph_index = 494},	/*Unicode: U+00bd (½)*/
+  {.w_px = 4,	.glyph_index = 526},	/*Unicode: U+00be (¾)*/
+  {.w_px = 3,	.glyph_index = 558},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 4,	.glyph_index = 578},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 4,	.glyph_index = 608},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 4,	.glyph_index = 639},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 4,	.glyph_index = 670},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 4,	.glyph_index = 701},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 4,	.glyph_index = 732},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 4,	.glyph_index = 763},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 4,	.glyph_index = 791},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 4,	.glyph_index = 826},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 4,	.glyph_index = 846},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 4,	.glyph_index = 867},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 4,	.glyph_index = 888},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 3,	.glyph_index = 909},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 3,	.glyph_index = 932},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 3,	.glyph_index = 955},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 3,	.glyph_index = 978},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 5,	.glyph_index = 1000},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 4,	.glyph_index = 1034},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 4,	.glyph_index = 1065},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 4,	.glyph_index = 1096},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 4,	.glyph_index = 1127},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 4,	.glyph_index = 1158},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 4,	.glyph_index = 1189},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 4,	.glyph_index = 1220},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 6,	.glyph_index = 1241},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 4,	.glyph_index = 1285},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 4,	.glyph_index = 1316},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 4,	.glyph_index = 1347},	/*Unicode: U+00db (Û)*/
+  {.w_px = 4,	.glyph_index = 1378},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 5,	.glyph_index = 1409},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 4,	.glyph_index = 1444},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 4,	.glyph_index = 1470},	/*Unicode: U+00df (ß)*/
+  {.w_px = 4,	.glyph_index = 1501},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 4,	.glyph_index = 1527},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 4,	.glyph_index = 1553},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 4,	.glyph_index = 1580},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 4,	.glyph_index = 1609},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 4,	.glyph_index = 1636},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 4,	.glyph_index = 1664},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 3,	.glyph_index = 1685},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 4,	.glyph_index = 1707},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 4,	.glyph_index = 1733},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 4,	.glyph_index = 1759},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 4,	.glyph_index = 1786},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 3,	.glyph_index = 1813},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 3,	.glyph_index = 1834},	/*Unicode: U+00ed (í)*/
+  {.w_px = 3,	.glyph_index = 1855},	/*Unicode: U+00ee (î)*/
+  {.w_px = 3,	.glyph_index = 1877},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 4,	.glyph_index = 1899},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 4,	.glyph_index = 1930},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 4,	.glyph_index = 1959},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 4,	.glyph_index = 1985},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 4,	.glyph_index = 2011},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 4,	.glyph_index = 2037},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 4,	.glyph_index = 2065},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 5,	.glyph_index = 2093},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 6,	.glyph_index = 2107},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 4,	.glyph_index = 2140},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 4,	.glyph_index = 2166},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 4,	.glyph_index = 2192},	/*Unicode: U+00fb (û)*/
+  {.w_px = 4,	.glyph_index = 2218},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 4,	.glyph_index = 2246},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 4,	.glyph_index = 2278},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 4,	.glyph_index = 2314},	/*Unicode: U+00ff (ÿ)*/
 
 #endif
 };
@@ -5434,6 +1748,7 @@ lv_font_t pros_font_dejavu_mono_latin_sup_10 =
 #endif
     .monospace = 5,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_10*/
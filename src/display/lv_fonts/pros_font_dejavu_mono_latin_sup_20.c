@@ -12,8843 +12,2203 @@ static const uint8_t pros_font_dejavu_mono_latin_sup_20_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 1
   /*Unicode: U+00a0 ( ) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xed, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0x03, 0xc0, 0xc0, 0x00, 0x00, 0xf8, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x08,  //....%..
-  0x08,  //....%..
-  0x08,  //....%..
-  0x3c,  //..%%%%.
-  0x7e,  //.%%%%%%
-  0x6a,  //.%%.%.%
-  0xc8,  //%%..%..
-  0xc8,  //%%..%..
-  0xc8,  //%%..%..
-  0xc8,  //%%..%..
-  0x6a,  //.%%.%.%
-  0x7e,  //.%%%%%%
-  0x3c,  //..%%%%.
-  0x08,  //....%..
-  0x08,  //....%..
-  0x08,  //....%..
-  0x00,  //.......
-
+  0xfe, 0x00, 0xfe, 0x08, 0x02, 0x3c, 0x7e, 0x6a, 0xfd, 0xc8, 0x02, 0x6a, 0x7e, 0x3c, 0xfe, 0x08,
+  0x00, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x0f, 0x00,  //....%%%%.
-  0x1f, 0x80,  //...%%%%%%
-  0x38, 0x80,  //..%%%...%
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0xfe, 0x00,  //%%%%%%%..
-  0xfe, 0x00,  //%%%%%%%..
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0x30, 0x00,  //..%%.....
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x19, 0x0f, 0x00, 0x1f, 0x80, 0x38, 0x80, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xfe,
+  0x00, 0xfe, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x81,  //%......%
-  0x7e,  //.%%%%%%.
-  0x66,  //.%%..%%.
-  0x42,  //.%....%.
-  0x42,  //.%....%.
-  0x66,  //.%%..%%.
-  0x7e,  //.%%%%%%.
-  0x81,  //%......%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfb, 0x00, 0x07, 0x81, 0x7e, 0x66, 0x42, 0x42, 0x66, 0x7e, 0x81, 0xfb, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xe1, 0xc0,  //%%%....%%%
-  0x61, 0x80,  //.%%....%%.
-  0x73, 0x80,  //.%%%..%%%.
-  0x33, 0x00,  //..%%..%%..
-  0x3f, 0x00,  //..%%%%%%..
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x1e, 0x00,  //...%%%%...
-  0x0c, 0x00,  //....%%....
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0xe1, 0xc0, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00, 0x3f, 0x00, 0xff, 0xc0, 0x1e,
+  0x00, 0x0c, 0x00, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0xf8, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-
+  0xfe, 0x00, 0xfa, 0xc0, 0x01, 0x00, 0x00, 0xfa, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x3c,  //..%%%%.
-  0x7c,  //.%%%%%.
-  0x60,  //.%%....
-  0x60,  //.%%....
-  0x30,  //..%%...
-  0x78,  //.%%%%..
-  0xcc,  //%%..%%.
-  0xc6,  //%%...%%
-  0x66,  //.%%..%%
-  0x3c,  //..%%%%.
-  0x18,  //...%%..
-  0x0c,  //....%%.
-  0x0c,  //....%%.
-  0x7c,  //.%%%%%.
-  0x78,  //.%%%%..
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x10, 0x3c, 0x7c, 0x60, 0x60, 0x30, 0x78, 0xcc, 0xc6, 0x66, 0x3c, 0x18, 0x0c, 0x0c,
+  0x7c, 0x78, 0x00, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0xcc,  //%%..%%
-  0xcc,  //%%..%%
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0x03, 0x00, 0x00, 0xcc, 0xcc, 0xf1, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1f, 0x00,  //...%%%%%...
-  0x20, 0x80,  //..%.....%..
-  0x4f, 0x40,  //.%..%%%%.%.
-  0x90, 0x20,  //%..%......%
-  0xa0, 0x20,  //%.%.......%
-  0xa0, 0x20,  //%.%.......%
-  0xa0, 0x20,  //%.%.......%
-  0x90, 0x20,  //%..%......%
-  0x4f, 0x40,  //.%..%%%%.%.
-  0x20, 0x80,  //..%.....%..
-  0x1f, 0x00,  //...%%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x14, 0x1f, 0x00, 0x20, 0x80, 0x4f, 0x40, 0x90, 0x20, 0xa0, 0x20, 0xa0, 0x20, 0xa0,
+  0x20, 0x90, 0x20, 0x4f, 0x40, 0x20, 0x80, 0x1f, 0xf6, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x7c,  //.%%%%%..
-  0x02,  //......%.
-  0x7e,  //.%%%%%%.
-  0xc2,  //%%....%.
-  0x82,  //%.....%.
-  0xc6,  //%%...%%.
-  0x7a,  //.%%%%.%.
-  0x00,  //........
-  0xfe,  //%%%%%%%.
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfe, 0x00, 0x08, 0x7c, 0x02, 0x7e, 0xc2, 0x82, 0xc6, 0x7a, 0x00, 0xfe, 0xf9, 0x00,
 
   /*Unicode: U+00ab («) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x11,  //...%...%
-  0x33,  //..%%..%%
-  0x66,  //.%%..%%.
-  0xcc,  //%%..%%..
-  0xcc,  //%%..%%..
-  0x66,  //.%%..%%.
-  0x33,  //..%%..%%
-  0x11,  //...%...%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfa, 0x00, 0x07, 0x11, 0x33, 0x66, 0xcc, 0xcc, 0x66, 0x33, 0x11, 0xfc, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x01, 0x80,  //.......%%
-  0x01, 0x80,  //.......%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x07, 0xff, 0x80, 0xff, 0x80, 0x01, 0x80, 0x01, 0x80, 0xf1, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xf7, 0x00, 0x01, 0xf8, 0xf8, 0xf9, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1f, 0x00,  //...%%%%%...
-  0x20, 0x80,  //..%.....%..
-  0x5e, 0x40,  //.%.%%%%..%.
-  0x91, 0x20,  //%..%...%..%
-  0x91, 0x20,  //%..%...%..%
-  0x9e, 0x20,  //%..%%%%...%
-  0x92, 0x20,  //%..%..%...%
-  0x91, 0x20,  //%..%...%..%
-  0x51, 0xc0,  //.%.%...%%%.
-  0x20, 0x80,  //..%.....%..
-  0x1f, 0x00,  //...%%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x14, 0x1f, 0x00, 0x20, 0x80, 0x5e, 0x40, 0x91, 0x20, 0x91, 0x20, 0x9e, 0x20, 0x92,
+  0x20, 0x91, 0x20, 0x51, 0xc0, 0x20, 0x80, 0x1f, 0xf6, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf8,  //%%%%%
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x01, 0xf8, 0xf8, 0xf2, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x78,  //.%%%%.
-  0xcc,  //%%..%%
-  0x84,  //%....%
-  0x84,  //%....%
-  0xcc,  //%%..%%
-  0x78,  //.%%%%.
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfe, 0x00, 0x05, 0x78, 0xcc, 0x84, 0x84, 0xcc, 0x78, 0xf6, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf5, 0x00, 0x13, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xf9, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x70,  //.%%%.
-  0x88,  //%...%
-  0x08,  //....%
-  0x10,  //...%.
-  0x30,  //..%%.
-  0x40,  //.%...
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x06, 0x70, 0x88, 0x08, 0x10, 0x30, 0x40, 0xf8, 0xf7, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xf0,  //%%%%.
-  0x08,  //....%
-  0x70,  //.%%%.
-  0x18,  //...%%
-  0x08,  //....%
-  0x18,  //...%%
-  0xf0,  //%%%%.
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x06, 0xf0, 0x08, 0x70, 0x18, 0x08, 0x18, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x30,  //..%%
-  0x60,  //.%%.
-  0xc0,  //%%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x04, 0x00, 0x00, 0x30, 0x60, 0xc0, 0xf2, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xe3, 0x80,  //%%%...%%%.
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xdc, 0xc0,  //%%.%%%..%%
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-  0xc0, 0x00,  //%%........
-
+  0xf5, 0x00, 0x1b, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xe3, 0x80, 0xff, 0xc0, 0xdc, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3f, 0x80,  //..%%%%%%%
-  0x7c, 0x80,  //.%%%%%..%
-  0xfc, 0x80,  //%%%%%%..%
-  0xfc, 0x80,  //%%%%%%..%
-  0xfc, 0x80,  //%%%%%%..%
-  0x7c, 0x80,  //.%%%%%..%
-  0x3c, 0x80,  //..%%%%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x04, 0x80,  //.....%..%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x1d, 0x3f, 0x80, 0x7c, 0x80, 0xfc, 0x80, 0xfc, 0x80, 0xfc, 0x80, 0x7c, 0x80, 0x3c,
+  0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04,
+  0x80, 0xfd, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf9, 0x00, 0xfe, 0xc0, 0xf8, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x60,  //.%%
-  0x20,  //..%
-  0xe0,  //%%%
-  0x00,  //...
-
+  0xf1, 0x00, 0x03, 0x60, 0x20, 0xe0, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0xe0,  //%%%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0x20,  //..%..
-  0xf8,  //%%%%%
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-
+  0xfe, 0x00, 0x00, 0xe0, 0xfc, 0x20, 0x00, 0xf8, 0xf7, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x38,  //..%%%..
-  0x44,  //.%...%.
-  0x82,  //%.....%
-  0x82,  //%.....%
-  0x82,  //%.....%
-  0x44,  //.%...%.
-  0x38,  //..%%%..
-  0x00,  //.......
-  0xfe,  //%%%%%%%
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x01, 0x38, 0x44, 0xfe, 0x82, 0x03, 0x44, 0x38, 0x00, 0xfe, 0xf9, 0x00,
 
   /*Unicode: U+00bb (») , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x88,  //%...%...
-  0xcc,  //%%..%%..
-  0x66,  //.%%..%%.
-  0x33,  //..%%..%%
-  0x33,  //..%%..%%
-  0x66,  //.%%..%%.
-  0xcc,  //%%..%%..
-  0x88,  //%...%...
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfa, 0x00, 0x07, 0x88, 0xcc, 0x66, 0x33, 0x33, 0x66, 0xcc, 0x88, 0xfc, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x70, 0x00,  //.%%%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x7d, 0xc0,  //.%%%%%.%%%
-  0x3f, 0x00,  //..%%%%%%..
-  0xe0, 0x00,  //%%%.......
-  0x01, 0x80,  //.......%%.
-  0x02, 0x80,  //......%.%.
-  0x06, 0x80,  //.....%%.%.
-  0x0c, 0x80,  //....%%..%.
-  0x0f, 0xc0,  //....%%%%%%
-  0x00, 0x80,  //........%.
-  0x00, 0x80,  //........%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfd, 0x00, 0x1f, 0x70, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x7d,
+  0xc0, 0x3f, 0x00, 0xe0, 0x00, 0x01, 0x80, 0x02, 0x80, 0x06, 0x80, 0x0c, 0x80, 0x0f, 0xc0, 0x00,
+  0x80, 0x00, 0x80, 0xfd, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x70, 0x00,  //.%%%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x10, 0x00,  //...%......
-  0x7d, 0xc0,  //.%%%%%.%%%
-  0x3f, 0x00,  //..%%%%%%..
-  0xe0, 0x00,  //%%%.......
-  0x03, 0x80,  //......%%%.
-  0x04, 0x40,  //.....%...%
-  0x00, 0x40,  //.........%
-  0x00, 0x80,  //........%.
-  0x01, 0x80,  //.......%%.
-  0x02, 0x00,  //......%...
-  0x07, 0xc0,  //.....%%%%%
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfd, 0x00, 0x1f, 0x70, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x7d,
+  0xc0, 0x3f, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x04, 0x40, 0x00, 0x40, 0x00, 0x80, 0x01, 0x80, 0x02,
+  0x00, 0x07, 0xc0, 0xfd, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x78, 0x00,  //.%%%%.....
-  0x04, 0x00,  //.....%....
-  0x38, 0x00,  //..%%%.....
-  0x0c, 0x00,  //....%%....
-  0x04, 0x00,  //.....%....
-  0x0c, 0x00,  //....%%....
-  0x79, 0xc0,  //.%%%%..%%%
-  0x3f, 0x00,  //..%%%%%%..
-  0xe0, 0x00,  //%%%.......
-  0x01, 0x80,  //.......%%.
-  0x02, 0x80,  //......%.%.
-  0x06, 0x80,  //.....%%.%.
-  0x0c, 0x80,  //....%%..%.
-  0x0f, 0xc0,  //....%%%%%%
-  0x00, 0x80,  //........%.
-  0x00, 0x80,  //........%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfd, 0x00, 0x1f, 0x78, 0x00, 0x04, 0x00, 0x38, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x79,
+  0xc0, 0x3f, 0x00, 0xe0, 0x00, 0x01, 0x80, 0x02, 0x80, 0x06, 0x80, 0x0c, 0x80, 0x0f, 0xc0, 0x00,
+  0x80, 0x00, 0x80, 0xfd, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x18,  //...%%..
-  0x18,  //...%%..
-  0x00,  //.......
-  0x18,  //...%%..
-  0x18,  //...%%..
-  0x18,  //...%%..
-  0x38,  //..%%%..
-  0x70,  //.%%%...
-  0xe0,  //%%%....
-  0xc0,  //%%.....
-  0xc2,  //%%....%
-  0x7e,  //.%%%%%%
-  0x3c,  //..%%%%.
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfe, 0x00, 0x02, 0x18, 0x18, 0x00, 0xfe, 0x18, 0x06, 0x38, 0x70, 0xe0, 0xc0, 0xc2, 0x7e, 0x3c,
+  0xfd, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 9 */
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 9 */
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 9 */
-  0x1c, 0x00,  //...%%%...
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1c, 0x00, 0x36, 0xfe, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 9 */
-  0x1a, 0x00,  //...%%.%..
-  0x2c, 0x00,  //..%.%%...
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1a, 0x00, 0x2c, 0xfe, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 9 */
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x36, 0x00, 0x36, 0xfe, 0x00, 0x19, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3e,
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 9 */
-  0x14, 0x00,  //...%.%...
-  0x14, 0x00,  //...%.%...
-  0x14, 0x00,  //...%.%...
-  0x08, 0x00,  //....%....
-  0x08, 0x00,  //....%....
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x1c, 0x00,  //...%%%...
-  0x3e, 0x00,  //..%%%%%..
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x1f, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x08, 0x00, 0x08, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+  0x00, 0x3e, 0x00, 0x36, 0x00, 0x36, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xe3, 0x80, 0xc1,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x0f, 0xe0,  //....%%%%%%%
-  0x1f, 0xe0,  //...%%%%%%%%
-  0x1b, 0x00,  //...%%.%%...
-  0x1b, 0x00,  //...%%.%%...
-  0x1b, 0x00,  //...%%.%%...
-  0x33, 0xe0,  //..%%..%%%%%
-  0x33, 0xe0,  //..%%..%%%%%
-  0x33, 0x00,  //..%%..%%...
-  0x7f, 0x00,  //.%%%%%%%...
-  0x7f, 0x00,  //.%%%%%%%...
-  0x63, 0x00,  //.%%...%%...
-  0xe3, 0xe0,  //%%%...%%%%%
-  0xc3, 0xe0,  //%%....%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x19, 0x0f, 0xe0, 0x1f, 0xe0, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x33, 0xe0, 0x33,
+  0xe0, 0x33, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xe3, 0xe0, 0xc3, 0xe0, 0xf9, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1f, 0x00,  //...%%%%%.
-  0x3f, 0x80,  //..%%%%%%%
-  0x70, 0x80,  //.%%%....%
-  0x60, 0x00,  //.%%......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xe0, 0x00,  //%%%......
-  0x70, 0x80,  //.%%%....%
-  0x3f, 0x80,  //..%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x06, 0x00,  //.....%%..
-  0x02, 0x00,  //......%..
-  0x0e, 0x00,  //....%%%..
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x1e, 0x1f, 0x00, 0x3f, 0x80, 0x70, 0x80, 0x60, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x70, 0x80, 0x3f, 0x80, 0x1f, 0x00, 0x06, 0x00, 0x02,
+  0x00, 0x0e, 0xfe, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 9 */
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 9 */
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 9 */
-  0x1c, 0x00,  //...%%%...
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1c, 0x00, 0x36, 0xfe, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 9 */
-  0x33, 0x00,  //..%%..%%.
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x33, 0x00, 0x33, 0xfe, 0x00, 0x19, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xff, 0x80, 0xff,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 8 */
-  0x60,  //.%%.....
-  0x30,  //..%%....
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x04, 0x60, 0x30, 0x00, 0xff, 0xff, 0xf8, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 8 */
-  0x18,  //...%%...
-  0x30,  //..%%....
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x04, 0x18, 0x30, 0x00, 0xff, 0xff, 0xf8, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 8 */
-  0x18,  //...%%...
-  0x24,  //..%..%..
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x04, 0x18, 0x24, 0x00, 0xff, 0xff, 0xf8, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 8 */
-  0x66,  //.%%..%%.
-  0x66,  //.%%..%%.
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x04, 0x66, 0x66, 0x00, 0xff, 0xff, 0xf8, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x7e, 0x00,  //.%%%%%%...
-  0x7f, 0x00,  //.%%%%%%%..
-  0x63, 0x80,  //.%%...%%%.
-  0x61, 0xc0,  //.%%....%%%
-  0x60, 0xc0,  //.%%.....%%
-  0xf8, 0xc0,  //%%%%%...%%
-  0xf8, 0xc0,  //%%%%%...%%
-  0x60, 0xc0,  //.%%.....%%
-  0x60, 0xc0,  //.%%.....%%
-  0x61, 0xc0,  //.%%....%%%
-  0x63, 0x80,  //.%%...%%%.
-  0x7f, 0x00,  //.%%%%%%%..
-  0x7e, 0x00,  //.%%%%%%...
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0x7e, 0x00, 0x7f, 0x00, 0x63, 0x80, 0x61, 0xc0, 0x60, 0xc0, 0xf8, 0xc0, 0xf8,
+  0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x61, 0xc0, 0x63, 0x80, 0x7f, 0x00, 0x7e, 0xf8, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 9 */
-  0x1a, 0x00,  //...%%.%..
-  0x2c, 0x00,  //..%.%%...
-  0x00, 0x00,  //.........
-  0xe1, 0x80,  //%%%....%%
-  0xe1, 0x80,  //%%%....%%
-  0xf1, 0x80,  //%%%%...%%
-  0xd1, 0x80,  //%%.%...%%
-  0xd1, 0x80,  //%%.%...%%
-  0xd9, 0x80,  //%%.%%..%%
-  0xc9, 0x80,  //%%..%..%%
-  0xcd, 0x80,  //%%..%%.%%
-  0xc5, 0x80,  //%%...%.%%
-  0xc5, 0x80,  //%%...%.%%
-  0xc7, 0x80,  //%%...%%%%
-  0xc3, 0x80,  //%%....%%%
-  0xc3, 0x80,  //%%....%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1a, 0x00, 0x2c, 0xfe, 0x00, 0x19, 0xe1, 0x80, 0xe1, 0x80, 0xf1, 0x80, 0xd1, 0x80, 0xd1,
+  0x80, 0xd9, 0x80, 0xc9, 0x80, 0xcd, 0x80, 0xc5, 0x80, 0xc5, 0x80, 0xc7, 0x80, 0xc3, 0x80, 0xc3,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 9 */
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 9 */
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 9 */
-  0x1c, 0x00,  //...%%%...
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1c, 0x00, 0x36, 0xfe, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 9 */
-  0x1a, 0x00,  //...%%.%..
-  0x2c, 0x00,  //..%.%%...
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1a, 0x00, 0x2c, 0xfe, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 9 */
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x00,  //.%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x36, 0x00, 0x36, 0xfe, 0x00, 0x18, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x42,  //.%....%.
-  0x24,  //..%..%..
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x6c,  //.%%.%%..
-  0xe6,  //%%%..%%.
-  0x42,  //.%....%.
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfa, 0x00, 0x06, 0x42, 0x24, 0x18, 0x18, 0x6c, 0xe6, 0x42, 0xfb, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1e, 0x60,  //...%%%%..%%
-  0x3f, 0x40,  //..%%%%%%.%.
-  0x31, 0x80,  //..%%...%%..
-  0x61, 0xc0,  //.%%....%%%.
-  0x63, 0xc0,  //.%%...%%%%.
-  0x62, 0xc0,  //.%%...%.%%.
-  0x64, 0xc0,  //.%%..%..%%.
-  0x68, 0xc0,  //.%%.%...%%.
-  0x70, 0xc0,  //.%%%....%%.
-  0x70, 0xc0,  //.%%%....%%.
-  0x71, 0x80,  //.%%%...%%..
-  0x5f, 0x80,  //.%.%%%%%%..
-  0x8f, 0x00,  //%...%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x18, 0x1e, 0x60, 0x3f, 0x40, 0x31, 0x80, 0x61, 0xc0, 0x63, 0xc0, 0x62, 0xc0, 0x64,
+  0xc0, 0x68, 0xc0, 0x70, 0xc0, 0x70, 0xc0, 0x71, 0x80, 0x5f, 0x80, 0x8f, 0xf8, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 9 */
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 9 */
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 9 */
-  0x1c, 0x00,  //...%%%...
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x1c, 0x00, 0x36, 0xfe, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 9 */
-  0x36, 0x00,  //..%%.%%..
-  0x36, 0x00,  //..%%.%%..
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x02, 0x36, 0x00, 0x36, 0xfe, 0x00, 0x18, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e,
+  0xf8, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 10 */
-  0x0c, 0x00,  //....%%....
-  0x18, 0x00,  //...%%.....
-  0x00, 0x00,  //..........
-  0xe1, 0xc0,  //%%%....%%%
-  0x61, 0x80,  //.%%....%%.
-  0x73, 0x80,  //.%%%..%%%.
-  0x33, 0x00,  //..%%..%%..
-  0x1e, 0x00,  //...%%%%...
-  0x1e, 0x00,  //...%%%%...
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0x02, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x18, 0xe1, 0xc0, 0x61, 0x80, 0x73, 0x80, 0x33, 0x00, 0x1e,
+  0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0xf8, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xfe, 0x00,  //%%%%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xc3, 0x80,  //%%....%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xfe, 0x00,  //%%%%%%%..
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x18, 0xc0, 0x00, 0xc0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xc3, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc3, 0x80, 0xff, 0x00, 0xfe, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xf8, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3c, 0x00,  //..%%%%...
-  0x7e, 0x00,  //.%%%%%%..
-  0xe7, 0x00,  //%%%..%%%.
-  0xc3, 0x00,  //%%....%%.
-  0xc6, 0x00,  //%%...%%..
-  0xcc, 0x00,  //%%..%%...
-  0xcc, 0x00,  //%%..%%...
-  0xc6, 0x00,  //%%...%%..
-  0xc3, 0x00,  //%%....%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xd3, 0x80,  //%%.%..%%%
-  0xdf, 0x80,  //%%.%%%%%%
-  0xce, 0x00,  //%%..%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x1a, 0x3c, 0x00, 0x7e, 0x00, 0xe7, 0x00, 0xc3, 0x00, 0xc6, 0x00, 0xcc, 0x00, 0xcc,
+  0x00, 0xc6, 0x00, 0xc3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xd3, 0x80, 0xdf, 0x80, 0xce, 0xf8, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x60, 0x00, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43,
+  0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00e1 (á) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43,
+  0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00e2 (â) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x0c, 0x00,  //....%%...
-  0x1e, 0x00,  //...%%%%..
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0xfe, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43,
+  0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x19, 0x00,  //...%%..%.
-  0x26, 0x00,  //..%..%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x19, 0x00, 0x26, 0xfc, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43, 0x80, 0x01,
+  0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x33, 0x00,  //..%%..%%.
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x33, 0x00, 0x33, 0xfc, 0x00, 0x13, 0x3e, 0x00, 0x7f, 0x00, 0x43, 0x80, 0x01,
+  0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 9 */
-  0x1c, 0x00,  //...%%%...
-  0x22, 0x00,  //..%...%..
-  0x22, 0x00,  //..%...%..
-  0x22, 0x00,  //..%...%..
-  0x1c, 0x00,  //...%%%...
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x43, 0x80,  //.%....%%%
-  0x01, 0x80,  //.......%%
-  0x3f, 0x80,  //..%%%%%%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc3, 0x80,  //%%....%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0x79, 0x80,  //.%%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0x08, 0x1c, 0x00, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x1c, 0xfe, 0x00, 0x13, 0x3e, 0x00, 0x7f,
+  0x00, 0x43, 0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xc1, 0x80, 0xc3, 0x80, 0xff, 0x80, 0x79,
+  0x80, 0xf9, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x27, 0x00,  //..%..%%%.
-  0x7f, 0x80,  //.%%%%%%%%
-  0x19, 0x80,  //...%%..%%
-  0x19, 0x80,  //...%%..%%
-  0x7f, 0x80,  //.%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xd8, 0x00,  //%%.%%....
-  0xd8, 0x80,  //%%.%%...%
-  0xff, 0x80,  //%%%%%%%%%
-  0x67, 0x00,  //.%%..%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x12, 0x27, 0x00, 0x7f, 0x80, 0x19, 0x80, 0x19, 0x80, 0x7f, 0x80, 0xff, 0x80, 0xd8,
+  0x00, 0xd8, 0x80, 0xff, 0x80, 0x67, 0xf8, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x1e,  //...%%%%.
-  0x7f,  //.%%%%%%%
-  0x61,  //.%%....%
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0xc0,  //%%......
-  0x61,  //.%%....%
-  0x7f,  //.%%%%%%%
-  0x1e,  //...%%%%.
-  0x06,  //.....%%.
-  0x02,  //......%.
-  0x0e,  //....%%%.
-  0x00,  //........
-
+  0xfb, 0x00, 0x02, 0x1e, 0x7f, 0x61, 0xfd, 0xc0, 0x06, 0x61, 0x7f, 0x1e, 0x06, 0x02, 0x0e, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x80,  //.%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0x60, 0x80,  //.%%.....%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x60, 0x00, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x12, 0x1e, 0x00, 0x7f, 0x00, 0x63,
+  0x80, 0xc1, 0x80, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0x60, 0x80, 0x7f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x80,  //.%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0x60, 0x80,  //.%%.....%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x12, 0x1e, 0x00, 0x7f, 0x00, 0x63,
+  0x80, 0xc1, 0x80, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0x60, 0x80, 0x7f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x0c, 0x00,  //....%%...
-  0x1e, 0x00,  //...%%%%..
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x80,  //.%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0x60, 0x80,  //.%%.....%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0xfe, 0x00, 0x12, 0x1e, 0x00, 0x7f, 0x00, 0x63,
+  0x80, 0xc1, 0x80, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0x60, 0x80, 0x7f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x33, 0x00,  //..%%..%%.
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1e, 0x00,  //...%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0x63, 0x80,  //.%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xff, 0x80,  //%%%%%%%%%
-  0xc0, 0x00,  //%%.......
-  0x60, 0x80,  //.%%.....%
-  0x7f, 0x80,  //.%%%%%%%%
-  0x1f, 0x00,  //...%%%%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x33, 0x00, 0x33, 0xfc, 0x00, 0x12, 0x1e, 0x00, 0x7f, 0x00, 0x63, 0x80, 0xc1,
+  0x80, 0xff, 0x80, 0xff, 0x80, 0xc0, 0x00, 0x60, 0x80, 0x7f, 0x80, 0x1f, 0xf8, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0xc0,  //%%......
-  0x60,  //.%%.....
-  0x30,  //..%%....
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x00, 0xf8, 0xf8, 0xfb, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x0c,  //....%%..
-  0x18,  //...%%...
-  0x30,  //..%%....
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0x0c, 0x18, 0x30, 0x00, 0xf8, 0xf8, 0xfb, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x18,  //...%%...
-  0x3c,  //..%%%%..
-  0x66,  //.%%..%%.
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0x18, 0x3c, 0x66, 0x00, 0xf8, 0xf8, 0xfb, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x66,  //.%%..%%.
-  0x66,  //.%%..%%.
-  0x00,  //........
-  0x00,  //........
-  0xf8,  //%%%%%...
-  0xf8,  //%%%%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0x07, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0xf8, 0xf8, 0xfb, 0x18, 0x01, 0xff, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x70, 0x00,  //.%%%.....
-  0x3e, 0x00,  //..%%%%%..
-  0x7c, 0x00,  //.%%%%%...
-  0x0e, 0x00,  //....%%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x00,  //%%%...%%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x1a, 0x70, 0x00, 0x3e, 0x00, 0x7c, 0x00, 0x0e, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0xe3,
+  0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x19, 0x00,  //...%%..%.
-  0x26, 0x00,  //..%..%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xce, 0x00,  //%%..%%%..
-  0xdf, 0x00,  //%%.%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x19, 0x00, 0x26, 0xfc, 0x00, 0x13, 0xce, 0x00, 0xdf, 0x00, 0xe3, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x60, 0x00, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x08, 0x00,  //....%....
-  0x14, 0x00,  //...%.%...
-  0x22, 0x00,  //..%...%..
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x08, 0x00, 0x14, 0x00, 0x22, 0xfe, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x1a, 0x00,  //...%%.%..
-  0x2c, 0x00,  //..%.%%...
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x1a, 0x00, 0x2c, 0xfc, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x7f, 0x00,  //.%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7f, 0x00,  //.%%%%%%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x63, 0x00, 0x63, 0xfc, 0x00, 0x12, 0x3e, 0x00, 0x7f, 0x00, 0xe3, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0xf8, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0xff, 0xc0,  //%%%%%%%%%%
-  0xff, 0xc0,  //%%%%%%%%%%
-  0x00, 0x00,  //..........
-  0x0c, 0x00,  //....%%....
-  0x0c, 0x00,  //....%%....
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf5, 0x00, 0x02, 0x0c, 0x00, 0x0c, 0xfe, 0x00, 0x08, 0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x0c,
+  0x00, 0x0c, 0xf4, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1e, 0x40,  //...%%%%..%.
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x71, 0x80,  //.%%%...%%..
-  0x63, 0xc0,  //.%%...%%%%.
-  0x66, 0xc0,  //.%%..%%.%%.
-  0x6c, 0xc0,  //.%%.%%..%%.
-  0x78, 0xc0,  //.%%%%...%%.
-  0x31, 0xc0,  //..%%...%%%.
-  0x7f, 0x80,  //.%%%%%%%%..
-  0x4f, 0x00,  //.%..%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x12, 0x1e, 0x40, 0x3f, 0xc0, 0x71, 0x80, 0x63, 0xc0, 0x66, 0xc0, 0x6c, 0xc0, 0x78,
+  0xc0, 0x31, 0xc0, 0x7f, 0x80, 0x4f, 0xf8, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x60, 0x00,  //.%%......
-  0x30, 0x00,  //..%%.....
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7d, 0x80,  //.%%%%%.%%
-  0x39, 0x80,  //..%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x60, 0x00, 0x30, 0x00, 0x18, 0xfe, 0x00, 0x13, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7d, 0x80, 0x39, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00fa (ú) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7d, 0x80,  //.%%%%%.%%
-  0x39, 0x80,  //..%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x13, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7d, 0x80, 0x39, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00fb (û) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x08, 0x00,  //....%....
-  0x14, 0x00,  //...%.%...
-  0x22, 0x00,  //..%...%..
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7d, 0x80,  //.%%%%%.%%
-  0x39, 0x80,  //..%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x04, 0x08, 0x00, 0x14, 0x00, 0x22, 0xfe, 0x00, 0x13, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7d, 0x80, 0x39, 0x80, 0xf9,
+  0x00,
 
   /*Unicode: U+00fc (ü) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0x7d, 0x80,  //.%%%%%.%%
-  0x39, 0x80,  //..%%%..%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xfd, 0x00, 0x02, 0x63, 0x00, 0x63, 0xfc, 0x00, 0x13, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7d, 0x80, 0x39, 0x80, 0xf9, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x06, 0x00,  //.....%%..
-  0x0c, 0x00,  //....%%...
-  0x18, 0x00,  //...%%....
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x73, 0x00,  //.%%%..%%.
-  0x36, 0x00,  //..%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1e, 0x00,  //...%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x0c, 0x00,  //....%%...
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x70, 0x00,  //.%%%.....
-  0x70, 0x00,  //.%%%.....
-
+  0xfd, 0x00, 0x04, 0x06, 0x00, 0x0c, 0x00, 0x18, 0xfe, 0x00, 0x1b, 0xc1, 0x80, 0x63, 0x00, 0x63,
+  0x00, 0x73, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x70, 0x00, 0x70, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xde, 0x00,  //%%.%%%%..
-  0xff, 0x00,  //%%%%%%%%.
-  0xe3, 0x80,  //%%%...%%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xe3, 0x80,  //%%%...%%%
-  0xff, 0x00,  //%%%%%%%%.
-  0xde, 0x00,  //%%.%%%%..
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-  0xc0, 0x00,  //%%.......
-
+  0xfd, 0x00, 0x23, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xde, 0x00, 0xff, 0x00, 0xe3,
+  0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x33, 0x00,  //..%%..%%.
-  0x33, 0x00,  //..%%..%%.
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0xc1, 0x80,  //%%.....%%
-  0x63, 0x00,  //.%%...%%.
-  0x63, 0x00,  //.%%...%%.
-  0x73, 0x00,  //.%%%..%%.
-  0x36, 0x00,  //..%%.%%..
-  0x3e, 0x00,  //..%%%%%..
-  0x1e, 0x00,  //...%%%%..
-  0x1c, 0x00,  //...%%%...
-  0x0c, 0x00,  //....%%...
-  0x1c, 0x00,  //...%%%...
-  0x18, 0x00,  //...%%....
-  0x18, 0x00,  //...%%....
-  0x70, 0x00,  //.%%%.....
-  0x70, 0x00,  //.%%%.....
-
-
+  0xfd, 0x00, 0x02, 0x33, 0x00, 0x33, 0xfc, 0x00, 0x1b, 0xc1, 0x80, 0x63, 0x00, 0x63, 0x00, 0x73,
+  0x00, 0x36, 0x00, 0x3e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x18,
+  0x00, 0x70, 0x00, 0x70, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 2
   /*Unicode: U+00a0 ( ) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xd9, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0x03, 0xf0, 0xf0, 0x00, 0x00, 0xf8, 0xf0, 0xfd, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0xc0,  //....@..
-  0x00, 0xc0,  //....@..
-  0x00, 0xc0,  //....@..
-  0x0b, 0xf4,  //..%@@@+
-  0x3f, 0xfc,  //.@@@@@@
-  0x7c, 0xc8,  //+@@.@.%
-  0xf4, 0xc0,  //@@+.@..
-  0xf0, 0xc0,  //@@..@..
-  0xf0, 0xc0,  //@@..@..
-  0xf4, 0xc0,  //@@+.@..
-  0x7c, 0xc8,  //+@@.@.%
-  0x3f, 0xfc,  //.@@@@@@
-  0x0b, 0xf4,  //..%@@@+
-  0x00, 0xc0,  //....@..
-  0x00, 0xc0,  //....@..
-  0x00, 0xc0,  //....@..
-  0x00, 0x00,  //.......
-
+  0xfa, 0x00, 0x20, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x0b, 0xf4, 0x3f, 0xfc, 0x7c, 0xc8, 0xf4, 0xc0,
+  0xf0, 0xc0, 0xf0, 0xc0, 0xf4, 0xc0, 0x7c, 0xc8, 0x3f, 0xfc, 0x0b, 0xf4, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0xbf, 0x40,  //....%@@@+
-  0x03, 0xff, 0xc0,  //...@@@@@@
-  0x0b, 0xc0, 0x80,  //..%@@...%
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0xff, 0xfc, 0x00,  //@@@@@@@..
-  0xff, 0xfc, 0x00,  //@@@@@@@..
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0x0f, 0x00, 0x00,  //..@@.....
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x25, 0xbf, 0x40, 0x03, 0xff, 0xc0, 0x0b, 0xc0, 0x80, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x90, 0x06,  //%+....+%
-  0x7b, 0xed,  //+@%@@%@+
-  0x28, 0x28,  //.%%..%%.
-  0x30, 0x0c,  //.@....@.
-  0x30, 0x0c,  //.@....@.
-  0x28, 0x28,  //.%%..%%.
-  0x7b, 0xed,  //+@%@@%@+
-  0x90, 0x06,  //%+....+%
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x0f, 0x90, 0x06, 0x7b, 0xed, 0x28, 0x28, 0x30, 0x0c, 0x30, 0x0c, 0x28, 0x28, 0x7b,
+  0xed, 0x90, 0x06, 0xf5, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xf8, 0x02, 0xe0,  //@@%....%@%
-  0x7c, 0x03, 0xc0,  //+@@....@@.
-  0x3e, 0x0b, 0x80,  //.@@%..%@%.
-  0x1f, 0x0f, 0x00,  //.+@@..@@..
-  0x0f, 0xae, 0x00,  //..@@%%@%..
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x02, 0xf8, 0x00,  //...%@@%...
-  0x00, 0xf0, 0x00,  //....@@....
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x25, 0xf8, 0x02, 0xe0, 0x7c, 0x03, 0xc0, 0x3e, 0x0b, 0x80, 0x1f, 0x0f, 0x00, 0x0f,
+  0xae, 0x00, 0xff, 0xff, 0xf0, 0x02, 0xf8, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf4, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-
+  0xfe, 0x00, 0xfa, 0xf0, 0x01, 0x00, 0x00, 0xfa, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x0b, 0xf0,  //..%@@@.
-  0x2f, 0xf0,  //.%@@@@.
-  0x3d, 0x00,  //.@@+...
-  0x2c, 0x00,  //.%@....
-  0x0e, 0x00,  //..@%...
-  0x7a, 0xd0,  //+@%%@+.
-  0xf0, 0xb4,  //@@..%@+
-  0xf0, 0x3c,  //@@...@@
-  0x78, 0x3c,  //+@%..@@
-  0x0e, 0xf0,  //..@%@@.
-  0x02, 0xc0,  //...%@..
-  0x00, 0xf0,  //....@@.
-  0x01, 0xf0,  //...+@@.
-  0x3f, 0xe0,  //.@@@@%.
-  0x3f, 0x80,  //.@@@%..
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x1d, 0x0b, 0xf0, 0x2f, 0xf0, 0x3d, 0x00, 0x2c, 0x00, 0x0e, 0x00, 0x7a, 0xd0, 0xf0,
+  0xb4, 0xf0, 0x3c, 0x78, 0x3c, 0x0e, 0xf0, 0x02, 0xc0, 0x00, 0xf0, 0x01, 0xf0, 0x3f, 0xe0, 0x3f,
+  0x80, 0xfd, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0xf0, 0xf0,  //@@..@@
-  0xf0, 0xf0,  //@@..@@
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfd, 0x00, 0xfd, 0xf0, 0xe1, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x02, 0xfe, 0x00,  //...%@@@%...
-  0x1d, 0x01, 0xd0,  //.+@+...+@+.
-  0x31, 0xff, 0x30,  //.@.+@@@@.@.
-  0x97, 0x00, 0x18,  //%++@.....+%
-  0xcc, 0x00, 0x0c,  //@.@.......@
-  0xcc, 0x00, 0x0c,  //@.@.......@
-  0xcc, 0x00, 0x0c,  //@.@.......@
-  0x97, 0x40, 0x18,  //%++@+....+%
-  0x31, 0xff, 0x30,  //.@.+@@@@.@.
-  0x1d, 0x01, 0xd0,  //.+@+...+@+.
-  0x02, 0xfe, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x1f, 0x02, 0xfe, 0x00, 0x1d, 0x01, 0xd0, 0x31, 0xff, 0x30, 0x97, 0x00, 0x18, 0xcc,
+  0x00, 0x0c, 0xcc, 0x00, 0x0c, 0xcc, 0x00, 0x0c, 0x97, 0x40, 0x18, 0x31, 0xff, 0x30, 0x1d, 0x01,
+  0xd0, 0x02, 0xfe, 0xf1, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x3f, 0xe0,  //.@@@@%..
-  0x00, 0x1c,  //.....+@.
-  0x2f, 0xfc,  //.%@@@@@.
-  0xa0, 0x0c,  //%%....@.
-  0xc0, 0x1c,  //@....+@.
-  0xe0, 0x7c,  //@%..+@@.
-  0x2f, 0xdc,  //.%@@@+@.
-  0x00, 0x00,  //........
-  0xbf, 0xfc,  //%@@@@@@.
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfb, 0x00, 0x11, 0x3f, 0xe0, 0x00, 0x1c, 0x2f, 0xfc, 0xa0, 0x0c, 0xc0, 0x1c, 0xe0, 0x7c, 0x2f,
+  0xdc, 0x00, 0x00, 0xbf, 0xfc, 0xf1, 0x00,
 
   /*Unicode: U+00ab («) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x02, 0x02,  //...%...%
-  0x0b, 0x0b,  //..%@..%@
-  0x2c, 0x2c,  //.%@..%@.
-  0xf0, 0xf0,  //@@..@@..
-  0xf0, 0xf0,  //@@..@@..
-  0x2c, 0x2c,  //.%@..%@.
-  0x0b, 0x0b,  //..%@..%@
-  0x02, 0x02,  //...%...%
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf3, 0x00, 0x05, 0x02, 0x02, 0x0b, 0x0b, 0x2c, 0x2c, 0xfd, 0xf0, 0x05, 0x2c, 0x2c, 0x0b, 0x0b,
+  0x02, 0x02, 0xf7, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x03, 0xc0,  //.......@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xe9, 0x00, 0x0b, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0xe9,
+  0x00,
 
   /*Unicode: U+00ad (­) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xed, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0xf1, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x02, 0xfe, 0x00,  //...%@@@%...
-  0x1d, 0x01, 0xd0,  //.+@+...+@+.
-  0x33, 0xfd, 0x30,  //.@.@@@@+.@.
-  0x93, 0x07, 0x18,  //%+.@..+@.+%
-  0xc3, 0x07, 0x0c,  //@..@..+@..@
-  0xc3, 0xfd, 0x0c,  //@..@@@@+..@
-  0xc3, 0x0c, 0x0c,  //@..@..@...@
-  0x93, 0x07, 0x18,  //%+.@..+@.+%
-  0x33, 0x02, 0xf0,  //.@.@...%@@.
-  0x1d, 0x01, 0xd0,  //.+@+...+@+.
-  0x02, 0xfe, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x1f, 0x02, 0xfe, 0x00, 0x1d, 0x01, 0xd0, 0x33, 0xfd, 0x30, 0x93, 0x07, 0x18, 0xc3,
+  0x07, 0x0c, 0xc3, 0xfd, 0x0c, 0xc3, 0x0c, 0x0c, 0x93, 0x07, 0x18, 0x33, 0x02, 0xf0, 0x1d, 0x01,
+  0xd0, 0x02, 0xfe, 0xf1, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xff, 0xc0,  //@@@@@
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xc0, 0xe3, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x2f, 0x80,  //.%@@%.
-  0xa0, 0xa0,  //%%..%%
-  0xc0, 0x30,  //@....@
-  0xc0, 0x30,  //@....@
-  0xa0, 0xa0,  //%%..%%
-  0x2f, 0x80,  //.%@@%.
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfb, 0x00, 0x0b, 0x2f, 0x80, 0xa0, 0xa0, 0xc0, 0x30, 0xc0, 0x30, 0xa0, 0xa0, 0x2f, 0x80, 0xeb,
+  0x00,
 
   /*Unicode: U+00b1 (±) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xee, 0x00, 0x1c, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff,
+  0xf0, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+  0xf5, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x7f, 0x00,  //+@@@.
-  0x81, 0xc0,  //%..+@
-  0x00, 0xc0,  //....@
-  0x02, 0x40,  //...%+
-  0x0e, 0x00,  //..@%.
-  0x74, 0x00,  //+@+..
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0d, 0x7f, 0x00, 0x81, 0xc0, 0x00, 0xc0, 0x02, 0x40, 0x0e, 0x00, 0x74, 0x00, 0xff,
+  0xc0, 0xed, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xff, 0x40,  //@@@@+
-  0x01, 0xc0,  //...+@
-  0x3f, 0x40,  //.@@@+
-  0x02, 0xc0,  //...%@
-  0x00, 0xc0,  //....@
-  0x02, 0xc0,  //...%@
-  0xfe, 0x00,  //@@@%.
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0c, 0xff, 0x40, 0x01, 0xc0, 0x3f, 0x40, 0x02, 0xc0, 0x00, 0xc0, 0x02, 0xc0, 0xfe,
+  0xec, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 4 */
-  0x00,  //....
-  0x00,  //....
-  0x0e,  //..@%
-  0x38,  //.@%.
-  0xa0,  //%%..
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-  0x00,  //....
-
+  0x04, 0x00, 0x00, 0x0e, 0x38, 0xa0, 0xf2, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf8, 0x0f, 0xc0,  //@@%...@@@.
-  0xff, 0xfe, 0xf0,  //@@@@@@@%@@
-  0xf3, 0xf0, 0xe0,  //@@.@@@..@%
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-  0xf0, 0x00, 0x00,  //@@........
-
+  0xef, 0x00, 0x29, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf8, 0x0f, 0xc0, 0xff, 0xfe, 0xf0, 0xf3, 0xf0,
+  0xe0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xff, 0xc0,  //..%@@@@@@
-  0x3f, 0xf0, 0xc0,  //.@@@@@..@
-  0xff, 0xf0, 0xc0,  //@@@@@@..@
-  0xff, 0xf0, 0xc0,  //@@@@@@..@
-  0xff, 0xf0, 0xc0,  //@@@@@@..@
-  0x3f, 0xf0, 0xc0,  //.@@@@@..@
-  0x0b, 0xf0, 0xc0,  //..%@@@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x30, 0xc0,  //.....@..@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x2c, 0x0b, 0xff, 0xc0, 0x3f, 0xf0, 0xc0, 0xff, 0xf0, 0xc0, 0xff, 0xf0, 0xc0, 0xff,
+  0xf0, 0xc0, 0x3f, 0xf0, 0xc0, 0x0b, 0xf0, 0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30,
+  0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30, 0xc0, 0x00, 0x30, 0xc0,
+  0xfb, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf9, 0x00, 0xfe, 0xf0, 0xf8, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x28,  //.%%
-  0x0c,  //..@
-  0xf8,  //@@%
-  0x00,  //...
-
+  0xf1, 0x00, 0x03, 0x28, 0x0c, 0xf8, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0xfc, 0x00,  //@@@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0x0c, 0x00,  //..@..
-  0xff, 0xc0,  //@@@@@
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-
+  0xfb, 0x00, 0x0d, 0xfc, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff,
+  0xc0, 0xed, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x1f, 0xd0,  //.+@@@+.
-  0x70, 0x34,  //+@...@+
-  0xc0, 0x0c,  //@.....@
-  0xc0, 0x0c,  //@.....@
-  0xc0, 0x0c,  //@.....@
-  0x70, 0x34,  //+@...@+
-  0x1f, 0xd0,  //.+@@@+.
-  0x00, 0x00,  //.......
-  0xff, 0xfc,  //@@@@@@@
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x11, 0x1f, 0xd0, 0x70, 0x34, 0xc0, 0x0c, 0xc0, 0x0c, 0xc0, 0x0c, 0x70, 0x34, 0x1f,
+  0xd0, 0x00, 0x00, 0xff, 0xfc, 0xf1, 0x00,
 
   /*Unicode: U+00bb (») , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x80, 0x80,  //%...%...
-  0xe0, 0xe0,  //@%..@%..
-  0x38, 0x38,  //.@%..@%.
-  0x0f, 0x0f,  //..@@..@@
-  0x0f, 0x0f,  //..@@..@@
-  0x38, 0x38,  //.@%..@%.
-  0xe0, 0xe0,  //@%..@%..
-  0x80, 0x80,  //%...%...
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf3, 0x00, 0x05, 0x80, 0x80, 0xe0, 0xe0, 0x38, 0x38, 0xfd, 0x0f, 0x05, 0x38, 0x38, 0xe0, 0xe0,
+  0x80, 0x80, 0xf7, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x3f, 0x00, 0x00,  //.@@@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x3f, 0xf6, 0xb0,  //.@@@@@+%%@
-  0x1a, 0xfa, 0x40,  //.+%%@@%%+.
-  0xe9, 0x00, 0x00,  //@%%+......
-  0x00, 0x03, 0xc0,  //.......@@.
-  0x00, 0x0d, 0xc0,  //......@+@.
-  0x00, 0x28, 0xc0,  //.....%%.@.
-  0x00, 0xa0, 0xc0,  //....%%..@.
-  0x00, 0xff, 0xf0,  //....@@@@@@
-  0x00, 0x00, 0xc0,  //........@.
-  0x00, 0x00, 0xc0,  //........@.
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0x3f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x3f, 0xf6, 0xb0, 0x1a, 0xfa, 0x40, 0xe9, 0xfe, 0x00, 0x13, 0x03,
+  0xc0, 0x00, 0x0d, 0xc0, 0x00, 0x28, 0xc0, 0x00, 0xa0, 0xc0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x3f, 0x00, 0x00,  //.@@@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x03, 0x00, 0x00,  //...@......
-  0x3f, 0xf6, 0xb0,  //.@@@@@+%%@
-  0x1a, 0xfa, 0x40,  //.+%%@@%%+.
-  0xe9, 0x00, 0x00,  //@%%+......
-  0x00, 0x1f, 0xc0,  //.....+@@@.
-  0x00, 0x20, 0x70,  //.....%..+@
-  0x00, 0x00, 0x30,  //.........@
-  0x00, 0x00, 0x90,  //........%+
-  0x00, 0x03, 0x80,  //.......@%.
-  0x00, 0x1d, 0x00,  //.....+@+..
-  0x00, 0x3f, 0xf0,  //.....@@@@@
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0x3f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x3f, 0xf6, 0xb0, 0x1a, 0xfa, 0x40, 0xe9, 0xfe, 0x00, 0x13, 0x1f,
+  0xc0, 0x00, 0x20, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x90, 0x00, 0x03, 0x80, 0x00, 0x1d, 0x00,
+  0x00, 0x3f, 0xf0, 0xfb, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x3f, 0xd0, 0x00,  //.@@@@+....
-  0x00, 0x70, 0x00,  //....+@....
-  0x0f, 0xd0, 0x00,  //..@@@+....
-  0x00, 0xb0, 0x00,  //....%@....
-  0x00, 0x30, 0x00,  //.....@....
-  0x00, 0xb0, 0x00,  //....%@....
-  0x3f, 0x96, 0xb0,  //.@@@%++%%@
-  0x1a, 0xfa, 0x40,  //.+%%@@%%+.
-  0xe9, 0x00, 0x00,  //@%%+......
-  0x00, 0x03, 0xc0,  //.......@@.
-  0x00, 0x0d, 0xc0,  //......@+@.
-  0x00, 0x28, 0xc0,  //.....%%.@.
-  0x00, 0xa0, 0xc0,  //....%%..@.
-  0x00, 0xff, 0xf0,  //....@@@@@@
-  0x00, 0x00, 0xc0,  //........@.
-  0x00, 0x00, 0xc0,  //........@.
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xfb, 0x00, 0x18, 0x3f, 0xd0, 0x00, 0x00, 0x70, 0x00, 0x0f, 0xd0, 0x00, 0x00, 0xb0, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0xb0, 0x00, 0x3f, 0x96, 0xb0, 0x1a, 0xfa, 0x40, 0xe9, 0xfe, 0x00, 0x13, 0x03,
+  0xc0, 0x00, 0x0d, 0xc0, 0x00, 0x28, 0xc0, 0x00, 0xa0, 0xc0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0xc0, 0xfb, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x03, 0xc0,  //...@@..
-  0x03, 0xc0,  //...@@..
-  0x00, 0x00,  //.......
-  0x03, 0xc0,  //...@@..
-  0x03, 0xc0,  //...@@..
-  0x03, 0xc0,  //...@@..
-  0x0f, 0x80,  //..@@%..
-  0x3f, 0x00,  //.@@@...
-  0xbc, 0x00,  //%@@....
-  0xf0, 0x00,  //@@.....
-  0xf0, 0x18,  //@@...+%
-  0x7f, 0xfc,  //+@@@@@@
-  0x1f, 0xe4,  //.+@@@%+
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xfb, 0x00, 0x19, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x0f,
+  0x80, 0x3f, 0x00, 0xbc, 0x00, 0xf0, 0x00, 0xf0, 0x18, 0x7f, 0xfc, 0x1f, 0xe4, 0xf9, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 9 */
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d,
+  0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 9 */
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d,
+  0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 9 */
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x0a, 0x28, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x02, 0xe0, 0x00, 0x0a, 0x28, 0xfd, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d,
+  0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 9 */
-  0x07, 0x8c, 0x00,  //..+@%.@..
-  0x0c, 0xb4, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x07, 0x8c, 0x00, 0x0c, 0xb4, 0xfd, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d,
+  0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 9 */
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x07, 0xf4, 0x00,  //..+@@@+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x1e, 0x2d, 0x00,  //.+@%.%@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0xfd, 0x00, 0x26, 0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03,
+  0xf0, 0x00, 0x07, 0xf4, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0x00, 0x1e, 0x2d,
+  0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x7c, 0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 9 */
-  0x03, 0x70, 0x00,  //...@+@...
-  0x03, 0x30, 0x00,  //...@.@...
-  0x03, 0x70, 0x00,  //...@+@...
-  0x00, 0xc0, 0x00,  //....@....
-  0x01, 0xd0, 0x00,  //...+@+...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x0f, 0x7c, 0x00,  //..@@+@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x2f, 0xfe, 0x00,  //.%@@@@@%.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x2f, 0x03, 0x70, 0x00, 0x03, 0x30, 0x00, 0x03, 0x70, 0x00, 0x00, 0xc0, 0x00, 0x01, 0xd0, 0x00,
+  0x02, 0xe0, 0x00, 0x03, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x0b, 0xf8, 0x00, 0x0f, 0x7c, 0x00, 0x0f,
+  0x3c, 0x00, 0x2f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x3c, 0x0f, 0x00, 0xb8, 0x0b, 0x80, 0xf4, 0x07,
+  0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x01, 0xff, 0xfc,  //...+@@@@@@@
-  0x02, 0xff, 0xfc,  //...%@@@@@@@
-  0x03, 0xcf, 0x00,  //...@@.@@...
-  0x03, 0xcf, 0x00,  //...@@.@@...
-  0x07, 0x8f, 0x00,  //..+@%.@@...
-  0x0f, 0x4f, 0xfc,  //..@@+.@@@@@
-  0x0f, 0x0f, 0xfc,  //..@@..@@@@@
-  0x1e, 0x0f, 0x00,  //.+@%..@@...
-  0x2f, 0xff, 0x00,  //.%@@@@@@...
-  0x3f, 0xff, 0x00,  //.@@@@@@@...
-  0x7c, 0x0f, 0x00,  //+@@...@@...
-  0xb8, 0x0f, 0xfc,  //%@%...@@@@@
-  0xf0, 0x0f, 0xfc,  //@@....@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf8, 0x00, 0x26, 0x01, 0xff, 0xfc, 0x02, 0xff, 0xfc, 0x03, 0xcf, 0x00, 0x03, 0xcf, 0x00, 0x07,
+  0x8f, 0x00, 0x0f, 0x4f, 0xfc, 0x0f, 0x0f, 0xfc, 0x1e, 0x0f, 0x00, 0x2f, 0xff, 0x00, 0x3f, 0xff,
+  0x00, 0x7c, 0x0f, 0x00, 0xb8, 0x0f, 0xfc, 0xf0, 0x0f, 0xfc, 0xf5, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x02, 0xfe, 0x40,  //...%@@@%+
-  0x1f, 0xff, 0xc0,  //.+@@@@@@@
-  0x3e, 0x01, 0xc0,  //.@@%...+@
-  0x78, 0x00, 0x00,  //+@%......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf4, 0x00, 0x00,  //@@+......
-  0xb8, 0x00, 0x00,  //%@%......
-  0x3e, 0x01, 0xc0,  //.@@%...+@
-  0x1f, 0xff, 0xc0,  //.+@@@@@@@
-  0x02, 0xfe, 0x40,  //...%@@@%+
-  0x00, 0x28, 0x00,  //.....%%..
-  0x00, 0x0c, 0x00,  //......@..
-  0x00, 0xf8, 0x00,  //....@@%..
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x2e, 0x02, 0xfe, 0x40, 0x1f, 0xff, 0xc0, 0x3e, 0x01, 0xc0, 0x78, 0x00, 0x00, 0xf4,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xb8, 0x00,
+  0x00, 0x3e, 0x01, 0xc0, 0x1f, 0xff, 0xc0, 0x02, 0xfe, 0x40, 0x00, 0x28, 0x00, 0x00, 0x0c, 0x00,
+  0x00, 0xf8, 0xfd, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 9 */
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 9 */
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 9 */
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x0a, 0x28, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x02, 0xe0, 0x00, 0x0a, 0x28, 0xfd, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 9 */
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0xfd, 0x00, 0x26, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 8 */
-  0x2c, 0x00,  //.%@.....
-  0x0a, 0x00,  //..%%....
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0x02, 0x2c, 0x00, 0x0a, 0xfe, 0x00, 0xfd, 0xff, 0x11, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 8 */
-  0x03, 0x80,  //...@%...
-  0x0a, 0x00,  //..%%....
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0x02, 0x03, 0x80, 0x0a, 0xfe, 0x00, 0xfd, 0xff, 0x11, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 8 */
-  0x03, 0xc0,  //...@@...
-  0x0c, 0x30,  //..@..@..
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0x05, 0x03, 0xc0, 0x0c, 0x30, 0x00, 0x00, 0xfd, 0xff, 0x11, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 8 */
-  0x3c, 0x3c,  //.@@..@@.
-  0x3c, 0x3c,  //.@@..@@.
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x3c, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x11, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x3f, 0xf8, 0x00,  //.@@@@@%...
-  0x3f, 0xff, 0x40,  //.@@@@@@@+.
-  0x3c, 0x0b, 0xc0,  //.@@...%@@.
-  0x3c, 0x02, 0xe0,  //.@@....%@%
-  0x3c, 0x00, 0xf0,  //.@@.....@@
-  0xff, 0xc0, 0xf0,  //@@@@@...@@
-  0xff, 0xc0, 0xf0,  //@@@@@...@@
-  0x3c, 0x00, 0xf0,  //.@@.....@@
-  0x3c, 0x00, 0xf0,  //.@@.....@@
-  0x3c, 0x02, 0xe0,  //.@@....%@%
-  0x3c, 0x0b, 0xc0,  //.@@...%@@.
-  0x3f, 0xff, 0x40,  //.@@@@@@@+.
-  0x3f, 0xf8, 0x00,  //.@@@@@%...
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf8, 0x00, 0x25, 0x3f, 0xf8, 0x00, 0x3f, 0xff, 0x40, 0x3c, 0x0b, 0xc0, 0x3c, 0x02, 0xe0, 0x3c,
+  0x00, 0xf0, 0xff, 0xc0, 0xf0, 0xff, 0xc0, 0xf0, 0x3c, 0x00, 0xf0, 0x3c, 0x00, 0xf0, 0x3c, 0x02,
+  0xe0, 0x3c, 0x0b, 0xc0, 0x3f, 0xff, 0x40, 0x3f, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 9 */
-  0x07, 0x8c, 0x00,  //..+@%.@..
-  0x0c, 0xb4, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00,  //.........
-  0xfc, 0x03, 0xc0,  //@@@....@@
-  0xfc, 0x03, 0xc0,  //@@@....@@
-  0xfe, 0x03, 0xc0,  //@@@%...@@
-  0xf7, 0x03, 0xc0,  //@@+@...@@
-  0xf3, 0x43, 0xc0,  //@@.@+..@@
-  0xf2, 0xc3, 0xc0,  //@@.%@..@@
-  0xf1, 0xc3, 0xc0,  //@@.+@..@@
-  0xf0, 0xe3, 0xc0,  //@@..@%.@@
-  0xf0, 0x73, 0xc0,  //@@..+@.@@
-  0xf0, 0x37, 0xc0,  //@@...@+@@
-  0xf0, 0x2f, 0xc0,  //@@...%@@@
-  0xf0, 0x0f, 0xc0,  //@@....@@@
-  0xf0, 0x0f, 0xc0,  //@@....@@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x07, 0x8c, 0x00, 0x0c, 0xb4, 0xfd, 0x00, 0x26, 0xfc, 0x03, 0xc0, 0xfc, 0x03, 0xc0, 0xfe,
+  0x03, 0xc0, 0xf7, 0x03, 0xc0, 0xf3, 0x43, 0xc0, 0xf2, 0xc3, 0xc0, 0xf1, 0xc3, 0xc0, 0xf0, 0xe3,
+  0xc0, 0xf0, 0x73, 0xc0, 0xf0, 0x37, 0xc0, 0xf0, 0x2f, 0xc0, 0xf0, 0x0f, 0xc0, 0xf0, 0x0f, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 9 */
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c,
+  0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 9 */
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c,
+  0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 9 */
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x0a, 0x28, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x02, 0xe0, 0x00, 0x0a, 0x28, 0xfd, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c,
+  0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 9 */
-  0x07, 0x8c, 0x00,  //..+@%.@..
-  0x0c, 0xb4, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x07, 0x8c, 0x00, 0x0c, 0xb4, 0xfd, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c,
+  0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 9 */
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb4, 0x07, 0x80,  //%@+...+@%
-  0x7c, 0x0f, 0x40,  //+@@...@@+
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0xfd, 0x00, 0x25, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x7c,
+  0x0f, 0x40, 0xb4, 0x07, 0x80, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xb4, 0x07, 0x80, 0x7c, 0x0f, 0x40, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00d7 (×) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x50, 0x05,  //++....++
-  0x74, 0x1d,  //+@+..+@+
-  0x1d, 0x74,  //.+@++@+.
-  0x07, 0xd0,  //..+@@+..
-  0x07, 0xd0,  //..+@@+..
-  0x2d, 0xb4,  //.%@+%@+.
-  0xb8, 0x2d,  //%@%..%@+
-  0x60, 0x09,  //+%....%+
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x0f, 0x50, 0x05, 0x74, 0x1d, 0x1d, 0x74, 0x07, 0xd0, 0x07, 0xd0, 0x2d, 0xb4, 0xb8,
+  0x2d, 0x60, 0x09, 0xf5, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x02, 0xfd, 0x28,  //...%@@@+.%%
-  0x0f, 0xff, 0x70,  //..@@@@@@+@.
-  0x1f, 0x03, 0xd0,  //.+@@...@@+.
-  0x2d, 0x03, 0xe0,  //.%@+...@@%.
-  0x3c, 0x0b, 0xf0,  //.@@...%@@@.
-  0x3c, 0x1c, 0xf0,  //.@@..+@.@@.
-  0x3c, 0x70, 0xf0,  //.@@.+@..@@.
-  0x3c, 0xd0, 0xf0,  //.@@.@+..@@.
-  0x3f, 0x40, 0xf0,  //.@@@+...@@.
-  0x2e, 0x01, 0xe0,  //.%@%...+@%.
-  0x2f, 0x03, 0xd0,  //.%@@...@@+.
-  0x37, 0xff, 0xc0,  //.@+@@@@@@..
-  0x91, 0xfe, 0x00,  //%+.+@@@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf8, 0x00, 0x25, 0x02, 0xfd, 0x28, 0x0f, 0xff, 0x70, 0x1f, 0x03, 0xd0, 0x2d, 0x03, 0xe0, 0x3c,
+  0x0b, 0xf0, 0x3c, 0x1c, 0xf0, 0x3c, 0x70, 0xf0, 0x3c, 0xd0, 0xf0, 0x3f, 0x40, 0xf0, 0x2e, 0x01,
+  0xe0, 0x2f, 0x03, 0xd0, 0x37, 0xff, 0xc0, 0x91, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 9 */
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb8, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00da (Ú) , Width: 9 */
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb8, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00db (Û) , Width: 9 */
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x0a, 0x28, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x02, 0xe0, 0x00, 0x0a, 0x28, 0xfd, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb8, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 9 */
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x0f, 0x3c, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xb8, 0x0b, 0x80,  //%@%...%@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x0f, 0x3c, 0x00, 0x0f, 0x3c, 0xfd, 0x00, 0x25, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xb8, 0x0b, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4,
+  0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 10 */
-  0x00, 0xe0, 0x00,  //....@%....
-  0x02, 0x80, 0x00,  //...%%.....
-  0x00, 0x00, 0x00,  //..........
-  0xb8, 0x02, 0xe0,  //%@%....%@%
-  0x3c, 0x03, 0xc0,  //.@@....@@.
-  0x2e, 0x0b, 0x80,  //.%@%..%@%.
-  0x0f, 0x0f, 0x00,  //..@@..@@..
-  0x07, 0xfd, 0x00,  //..+@@@@+..
-  0x03, 0xfc, 0x00,  //...@@@@...
-  0x01, 0xf4, 0x00,  //...+@@+...
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0x04, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x25, 0xb8, 0x02, 0xe0, 0x3c, 0x03, 0xc0, 0x2e,
+  0x0b, 0x80, 0x0f, 0x0f, 0x00, 0x07, 0xfd, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xf4, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf4,
+  0x00,
 
   /*Unicode: U+00de (Þ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xff, 0xf8, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xf0, 0x0b, 0xc0,  //@@....%@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x0b, 0xc0,  //@@....%@@
-  0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xff, 0xf9, 0x00,  //@@@@@@%+.
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf8, 0x00, 0x24, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xff, 0x40, 0xf0,
+  0x0b, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x0b, 0xc0, 0xff, 0xff, 0x40, 0xff, 0xf9,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xf3, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x1f, 0xf4, 0x00,  //.+@@@@+..
-  0x7f, 0xfd, 0x00,  //+@@@@@@+.
-  0xf8, 0x2e, 0x00,  //@@%..%@%.
-  0xf0, 0x0f, 0x00,  //@@....@@.
-  0xf0, 0x78, 0x00,  //@@..+@%..
-  0xf0, 0xf0, 0x00,  //@@..@@...
-  0xf0, 0xf0, 0x00,  //@@..@@...
-  0xf0, 0x38, 0x00,  //@@...@%..
-  0xf0, 0x0f, 0x00,  //@@....@@.
-  0xf0, 0x03, 0x80,  //@@.....@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf2, 0x0b, 0xc0,  //@@.%..%@@
-  0xf3, 0xff, 0x80,  //@@.@@@@@%
-  0xf1, 0xfd, 0x00,  //@@.+@@@+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x28, 0x1f, 0xf4, 0x00, 0x7f, 0xfd, 0x00, 0xf8, 0x2e, 0x00, 0xf0, 0x0f, 0x00, 0xf0,
+  0x78, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x38, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x03,
+  0x80, 0xf0, 0x03, 0xc0, 0xf2, 0x0b, 0xc0, 0xf3, 0xff, 0x80, 0xf1, 0xfd, 0xf4, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2c, 0x00, 0x00,  //.%@......
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1d, 0x0b, 0xf8,
+  0x00, 0x3f, 0xff, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff, 0xc0, 0x7f, 0xff, 0xc0,
+  0xf4, 0x03, 0xc0, 0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x38, 0x00,  //.....@%..
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1d, 0x0b, 0xf8, 0x00,
+  0x3f, 0xff, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xf4,
+  0x03, 0xc0, 0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0xf0, 0x00,  //....@@...
-  0x03, 0xac, 0x00,  //...@%%@..
-  0x0a, 0x0a, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0xf0, 0x00, 0x03, 0xac, 0x00, 0x0a, 0x0a, 0xfd, 0x00, 0x1d, 0x0b, 0xf8, 0x00,
+  0x3f, 0xff, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xf4,
+  0x03, 0xc0, 0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xc3, 0x00,  //..+@@..@.
-  0x0c, 0x3d, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x07, 0xc3, 0x00, 0x0c, 0x3d, 0xfa, 0x00, 0x1d, 0x0b, 0xf8, 0x00, 0x3f, 0xff,
+  0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xf4, 0x03, 0xc0,
+  0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0xfa, 0x00, 0x1d, 0x0b, 0xf8, 0x00, 0x3f, 0xff,
+  0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff, 0xc0, 0x7f, 0xff, 0xc0, 0xf4, 0x03, 0xc0,
+  0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 9 */
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x09, 0x18, 0x00,  //..%+.+%..
-  0x0c, 0x0c, 0x00,  //..@...@..
-  0x09, 0x18, 0x00,  //..%+.+%..
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x34, 0x0b, 0x80,  //.@+...%@%
-  0x00, 0x03, 0xc0,  //.......@@
-  0x1b, 0xff, 0xc0,  //.+%@@@@@@
-  0x7f, 0xff, 0xc0,  //+@@@@@@@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf4, 0x0b, 0xc0,  //@@+...%@@
-  0xbf, 0xfb, 0xc0,  //%@@@@@%@@
-  0x2f, 0xd3, 0xc0,  //.%@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0x0d, 0x02, 0xe0, 0x00, 0x09, 0x18, 0x00, 0x0c, 0x0c, 0x00, 0x09, 0x18, 0x00, 0x02, 0xe0, 0xfd,
+  0x00, 0x1d, 0x0b, 0xf8, 0x00, 0x3f, 0xff, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x03, 0xc0, 0x1b, 0xff,
+  0xc0, 0x7f, 0xff, 0xc0, 0xf4, 0x03, 0xc0, 0xf4, 0x0b, 0xc0, 0xbf, 0xfb, 0xc0, 0x2f, 0xd3, 0xc0,
+  0xf5, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x1d, 0x3e, 0x00,  //.+@+.@@%.
-  0x3f, 0xff, 0x80,  //.@@@@@@@%
-  0x17, 0xd7, 0xc0,  //.++@@++@@
-  0x03, 0xc3, 0xc0,  //...@@..@@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0xbf, 0xff, 0xc0,  //%@@@@@@@@
-  0xf3, 0xc0, 0x00,  //@@.@@....
-  0xf3, 0xd0, 0x80,  //@@.@@+..%
-  0xff, 0xbf, 0xc0,  //@@@@%@@@@
-  0x3c, 0x2f, 0x40,  //.@@..%@@+
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xef, 0x00, 0x1d, 0x1d, 0x3e, 0x00, 0x3f, 0xff, 0x80, 0x17, 0xd7, 0xc0, 0x03, 0xc3, 0xc0, 0x2f,
+  0xff, 0xc0, 0xbf, 0xff, 0xc0, 0xf3, 0xc0, 0x00, 0xf3, 0xd0, 0x80, 0xff, 0xbf, 0xc0, 0x3c, 0x2f,
+  0x40, 0xf5, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x07, 0xf9,  //..+@@@%+
-  0x2f, 0xff,  //.%@@@@@@
-  0x7d, 0x02,  //+@@+...%
-  0xf4, 0x00,  //@@+.....
-  0xf0, 0x00,  //@@......
-  0xf0, 0x00,  //@@......
-  0xf4, 0x00,  //@@+.....
-  0x7d, 0x02,  //+@@+...%
-  0x2f, 0xff,  //.%@@@@@@
-  0x07, 0xfd,  //..+@@@@+
-  0x00, 0x28,  //.....%%.
-  0x00, 0x0c,  //......@.
-  0x00, 0xf8,  //....@@%.
-  0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x1b, 0x07, 0xf9, 0x2f, 0xff, 0x7d, 0x02, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+  0x00, 0x7d, 0x02, 0x2f, 0xff, 0x07, 0xfd, 0x00, 0x28, 0x00, 0x0c, 0x00, 0xf8, 0x00, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2c, 0x00, 0x00,  //.%@......
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x2f, 0xff, 0x00,  //.%@@@@@@.
-  0x7c, 0x0b, 0x80,  //+@@...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0x7d, 0x01, 0xc0,  //+@@+...+@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0x07, 0xfe, 0x00,  //..+@@@@%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1c, 0x07, 0xf8,
+  0x00, 0x2f, 0xff, 0x00, 0x7c, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0,
+  0xf0, 0x00, 0x00, 0x7d, 0x01, 0xc0, 0x2f, 0xff, 0xc0, 0x07, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x38, 0x00,  //.....@%..
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x2f, 0xff, 0x00,  //.%@@@@@@.
-  0x7c, 0x0b, 0x80,  //+@@...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0x7d, 0x01, 0xc0,  //+@@+...+@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0x07, 0xfe, 0x00,  //..+@@@@%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1c, 0x07, 0xf8, 0x00,
+  0x2f, 0xff, 0x00, 0x7c, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0x7d, 0x01, 0xc0, 0x2f, 0xff, 0xc0, 0x07, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0xf0, 0x00,  //....@@...
-  0x03, 0xac, 0x00,  //...@%%@..
-  0x0a, 0x0a, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x2f, 0xff, 0x00,  //.%@@@@@@.
-  0x7c, 0x0b, 0x80,  //+@@...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0x7d, 0x01, 0xc0,  //+@@+...+@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0x07, 0xfe, 0x00,  //..+@@@@%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0xf0, 0x00, 0x03, 0xac, 0x00, 0x0a, 0x0a, 0xfd, 0x00, 0x1c, 0x07, 0xf8, 0x00,
+  0x2f, 0xff, 0x00, 0x7c, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0,
+  0x00, 0x00, 0x7d, 0x01, 0xc0, 0x2f, 0xff, 0xc0, 0x07, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x2f, 0xff, 0x00,  //.%@@@@@@.
-  0x7c, 0x0b, 0x80,  //+@@...%@%
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xff, 0xff, 0xc0,  //@@@@@@@@@
-  0xf0, 0x00, 0x00,  //@@.......
-  0x7d, 0x01, 0xc0,  //+@@+...+@
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@
-  0x07, 0xfe, 0x00,  //..+@@@@%.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0xfa, 0x00, 0x1c, 0x07, 0xf8, 0x00, 0x2f, 0xff,
+  0x00, 0x7c, 0x0b, 0x80, 0xf0, 0x03, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xf0, 0x00, 0x00,
+  0x7d, 0x01, 0xc0, 0x2f, 0xff, 0xc0, 0x07, 0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xb0, 0x00,  //%@......
-  0x2c, 0x00,  //.%@.....
-  0x0a, 0x00,  //..%%....
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0x04, 0xb0, 0x00, 0x2c, 0x00, 0x0a, 0xfe, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0xe0,  //....@%..
-  0x03, 0x80,  //...@%...
-  0x0a, 0x00,  //..%%....
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfc, 0x00, 0x03, 0xe0, 0x03, 0x80, 0x0a, 0xfe, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0,
+  0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x03, 0xc0,  //...@@...
-  0x0e, 0xb0,  //..@%%@..
-  0x28, 0x28,  //.%%..%%.
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0x17, 0x03, 0xc0, 0x0e, 0xb0, 0x28, 0x28, 0x00, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x3c, 0x3c,  //.@@..@@.
-  0x3c, 0x3c,  //.@@..@@.
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xff, 0xc0,  //@@@@@...
-  0xff, 0xc0,  //@@@@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xfd, 0x00, 0xfd, 0x3c, 0xfd, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xfd, 0xff, 0xf9, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2f, 0x04, 0x00,  //.%@@..+..
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x2f, 0xf0, 0x00,  //.%@@@@...
-  0x00, 0xf8, 0x00,  //....@@%..
-  0x0b, 0xfd, 0x00,  //..%@@@@+.
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbd, 0x0f, 0x40,  //%@@+..@@+
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x28, 0x2f, 0x04, 0x00, 0x0b, 0xf8, 0x00, 0x2f, 0xf0, 0x00, 0x00, 0xf8, 0x00, 0x0b,
+  0xfd, 0x00, 0x3f, 0xff, 0x00, 0xbd, 0x0f, 0x40, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0xc3, 0x00,  //..+@@..@.
-  0x0c, 0x3d, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf1, 0xfd, 0x00,  //@@.+@@@+.
-  0xf7, 0xff, 0x40,  //@@+@@@@@+
-  0xfd, 0x0b, 0xc0,  //@@@+..%@@
-  0xf4, 0x03, 0xc0,  //@@+....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x07, 0xc3, 0x00, 0x0c, 0x3d, 0xfa, 0x00, 0x1d, 0xf1, 0xfd, 0x00, 0xf7, 0xff,
+  0x40, 0xfd, 0x0b, 0xc0, 0xf4, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2c, 0x00, 0x00,  //.%@......
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1c, 0x0b, 0xf8,
+  0x00, 0x3f, 0xff, 0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x38, 0x00,  //.....@%..
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1c, 0x0b, 0xf8, 0x00,
+  0x3f, 0xff, 0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4,
+  0x07, 0xc0, 0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x01, 0xd0, 0x00,  //...+@+...
-  0x03, 0x70, 0x00,  //...@+@...
-  0x09, 0x18, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x01, 0xd0, 0x00, 0x03, 0x70, 0x00, 0x09, 0x18, 0xfd, 0x00, 0x1c, 0x0b, 0xf8,
+  0x00, 0x3f, 0xff, 0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf4, 0x07, 0xc0, 0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x07, 0x8c, 0x00,  //..+@%.@..
-  0x0c, 0xb4, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x07, 0x8c, 0x00, 0x0c, 0xb4, 0xfa, 0x00, 0x1c, 0x0b, 0xf8, 0x00, 0x3f, 0xff,
+  0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0,
+  0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xbc, 0x0f, 0x80,  //%@@...@@%
-  0x3f, 0xff, 0x00,  //.@@@@@@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x3c, 0x0f, 0x00, 0x3c, 0x0f, 0xfa, 0x00, 0x1c, 0x0b, 0xf8, 0x00, 0x3f, 0xff,
+  0x00, 0xbc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf4, 0x07, 0xc0,
+  0xbc, 0x0f, 0x80, 0x3f, 0xff, 0x00, 0x0b, 0xf8, 0xf4, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@@@@@@
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0xf0, 0x00,  //....@@....
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xee, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0,
+  0xfd, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0xee, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x02, 0xfd, 0x34,  //...%@@@+.@+
-  0x0f, 0xff, 0xe0,  //..@@@@@@@%.
-  0x2f, 0x03, 0xd0,  //.%@@...@@+.
-  0x3d, 0x0b, 0xe0,  //.@@+..%@@%.
-  0x3c, 0x28, 0xf0,  //.@@..%%.@@.
-  0x3c, 0xa0, 0xf0,  //.@@.%%..@@.
-  0x2f, 0x81, 0xf0,  //.%@@%..+@@.
-  0x1f, 0x03, 0xe0,  //.+@@...@@%.
-  0x2f, 0xff, 0xc0,  //.%@@@@@@@..
-  0x71, 0xfe, 0x00,  //+@.+@@@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xef, 0x00, 0x1c, 0x02, 0xfd, 0x34, 0x0f, 0xff, 0xe0, 0x2f, 0x03, 0xd0, 0x3d, 0x0b, 0xe0, 0x3c,
+  0x28, 0xf0, 0x3c, 0xa0, 0xf0, 0x2f, 0x81, 0xf0, 0x1f, 0x03, 0xe0, 0x2f, 0xff, 0xc0, 0x71, 0xfe,
+  0xf4, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x2c, 0x00, 0x00,  //.%@......
-  0x0b, 0x00, 0x00,  //..%@.....
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x07, 0xc0,  //@@....+@@
-  0xf8, 0x1f, 0xc0,  //@@%..+@@@
-  0x7f, 0xf7, 0xc0,  //+@@@@@+@@
-  0x1f, 0xd3, 0xc0,  //.+@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x2c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1d, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf0, 0x07, 0xc0, 0xf8, 0x1f, 0xc0, 0x7f, 0xf7, 0xc0, 0x1f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x38, 0x00,  //.....@%..
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x07, 0xc0,  //@@....+@@
-  0xf8, 0x1f, 0xc0,  //@@%..+@@@
-  0x7f, 0xf7, 0xc0,  //+@@@@@+@@
-  0x1f, 0xd3, 0xc0,  //.+@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfa, 0x00, 0x06, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x1d, 0xf0, 0x03, 0xc0,
+  0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0,
+  0x07, 0xc0, 0xf8, 0x1f, 0xc0, 0x7f, 0xf7, 0xc0, 0x1f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x01, 0xd0, 0x00,  //...+@+...
-  0x03, 0x70, 0x00,  //...@+@...
-  0x09, 0x18, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x07, 0xc0,  //@@....+@@
-  0xf8, 0x1f, 0xc0,  //@@%..+@@@
-  0x7f, 0xf7, 0xc0,  //+@@@@@+@@
-  0x1f, 0xd3, 0xc0,  //.+@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x07, 0x01, 0xd0, 0x00, 0x03, 0x70, 0x00, 0x09, 0x18, 0xfd, 0x00, 0x1d, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0,
+  0xf0, 0x07, 0xc0, 0xf8, 0x1f, 0xc0, 0x7f, 0xf7, 0xc0, 0x1f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x07, 0xc0,  //@@....+@@
-  0xf8, 0x1f, 0xc0,  //@@%..+@@@
-  0x7f, 0xf7, 0xc0,  //+@@@@@+@@
-  0x1f, 0xd3, 0xc0,  //.+@@@+.@@
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xfb, 0x00, 0x04, 0x3c, 0x0f, 0x00, 0x3c, 0x0f, 0xfa, 0x00, 0x1d, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x07, 0xc0,
+  0xf8, 0x1f, 0xc0, 0x7f, 0xf7, 0xc0, 0x1f, 0xd3, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x38, 0x00,  //.....@%..
-  0x00, 0xe0, 0x00,  //....@%...
-  0x02, 0x80, 0x00,  //...%%....
-  0x00, 0x00, 0x00,  //.........
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0x7c, 0x0b, 0x40,  //+@@...%@+
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x2e, 0x1e, 0x00,  //.%@%.+@%.
-  0x0f, 0x3d, 0x00,  //..@@.@@+.
-  0x0b, 0xbc, 0x00,  //..%@%@@..
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x01, 0xf0, 0x00,  //...+@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xc0, 0x00,  //...@@....
-  0x07, 0xc0, 0x00,  //..+@@....
-  0x3f, 0x40, 0x00,  //.@@@+....
-  0x3e, 0x00, 0x00,  //.@@%.....
-
+  0xfa, 0x00, 0x06, 0x38, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x80, 0xfd, 0x00, 0x29, 0xf4, 0x07, 0xc0,
+  0x7c, 0x0b, 0x40, 0x3c, 0x0f, 0x00, 0x2e, 0x1e, 0x00, 0x0f, 0x3d, 0x00, 0x0b, 0xbc, 0x00, 0x07,
+  0xf8, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x02, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xc0,
+  0x00, 0x3f, 0x40, 0x00, 0x3e, 0x00, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0xfc, 0x0f, 0x80,  //@@@...@@%
-  0xfb, 0xff, 0x00,  //@@%@@@@@.
-  0xf2, 0xf8, 0x00,  //@@.%@@%..
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-  0xf0, 0x00, 0x00,  //@@.......
-
+  0xfb, 0x00, 0x35, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf2,
+  0xf8, 0x00, 0xfb, 0xff, 0x00, 0xfc, 0x0f, 0x80, 0xf4, 0x07, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03,
+  0xc0, 0xf4, 0x07, 0xc0, 0xfc, 0x0f, 0x80, 0xfb, 0xff, 0x00, 0xf2, 0xf8, 0x00, 0xf0, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x0f, 0x0f, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0xf4, 0x07, 0xc0,  //@@+...+@@
-  0x7c, 0x0b, 0x40,  //+@@...%@+
-  0x3c, 0x0f, 0x00,  //.@@...@@.
-  0x2e, 0x1e, 0x00,  //.%@%.+@%.
-  0x0f, 0x3d, 0x00,  //..@@.@@+.
-  0x0b, 0xbc, 0x00,  //..%@%@@..
-  0x07, 0xf8, 0x00,  //..+@@@%..
-  0x03, 0xf0, 0x00,  //...@@@...
-  0x01, 0xf0, 0x00,  //...+@@...
-  0x02, 0xe0, 0x00,  //...%@%...
-  0x03, 0xc0, 0x00,  //...@@....
-  0x07, 0xc0, 0x00,  //..+@@....
-  0x3f, 0x40, 0x00,  //.@@@+....
-  0x3e, 0x00, 0x00,  //.@@%.....
-
-
+  0xfb, 0x00, 0x04, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0xfa, 0x00, 0x29, 0xf4, 0x07, 0xc0, 0x7c, 0x0b,
+  0x40, 0x3c, 0x0f, 0x00, 0x2e, 0x1e, 0x00, 0x0f, 0x3d, 0x00, 0x0b, 0xbc, 0x00, 0x07, 0xf8, 0x00,
+  0x03, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x02, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x3f,
+  0x40, 0x00, 0x3e, 0x00, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 4
   /*Unicode: U+00a0 ( ) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xc5, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xdd,  //@@
-  0xee,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xdd, 0xee, 0xfa, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x01, 0x9e, 0xfd, 0x50,  //..%@@@+
-  0x0d, 0xff, 0xff, 0xf0,  //.@@@@@@
-  0x7f, 0xd2, 0xf2, 0xa0,  //+@@.@.%
-  0xdf, 0x40, 0xf0, 0x00,  //@@+.@..
-  0xff, 0x00, 0xf0, 0x00,  //@@..@..
-  0xff, 0x00, 0xf0, 0x00,  //@@..@..
-  0xdf, 0x40, 0xf0, 0x00,  //@@+.@..
-  0x7f, 0xd3, 0xf2, 0xa0,  //+@@.@.%
-  0x0d, 0xff, 0xff, 0xf0,  //.@@@@@@
-  0x01, 0x9e, 0xfd, 0x50,  //..%@@@+
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x00, 0x00, 0xf0, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf3, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x2c, 0xf0, 0x00, 0x01, 0x9e, 0xfd,
+  0x50, 0x0d, 0xff, 0xff, 0xf0, 0x7f, 0xd2, 0xf2, 0xa0, 0xdf, 0x40, 0xf0, 0x00, 0xff, 0x00, 0xf0,
+  0x00, 0xff, 0x00, 0xf0, 0x00, 0xdf, 0x40, 0xf0, 0x00, 0x7f, 0xd3, 0xf2, 0xa0, 0x0d, 0xff, 0xff,
+  0xf0, 0x01, 0x9e, 0xfd, 0x50, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0,
+  0xfc, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x03, 0xbe, 0xfc, 0x40,  //....%@@@+
-  0x00, 0x3f, 0xff, 0xff, 0xf0,  //...@@@@@@
-  0x00, 0xaf, 0xc2, 0x02, 0xa0,  //..%@@...%
-  0x00, 0xef, 0x30, 0x00, 0x00,  //..@@.....
-  0x00, 0xff, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0xff, 0x00, 0x00, 0x00,  //..@@.....
-  0xff, 0xff, 0xff, 0xf0, 0x00,  //@@@@@@@..
-  0xff, 0xff, 0xff, 0xf0, 0x00,  //@@@@@@@..
-  0x00, 0xff, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0xff, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0xff, 0x00, 0x00, 0x00,  //..@@.....
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x10, 0x03, 0xbe, 0xfc, 0x40, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0xaf, 0xc2, 0x02,
+  0xa0, 0x00, 0xef, 0x30, 0xfe, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfe, 0x00, 0xfe, 0xff,
+  0x01, 0xf0, 0x00, 0xfe, 0xff, 0x03, 0xf0, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfe, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x95, 0x00, 0x00, 0x59,  //%+....+%
-  0x5f, 0xae, 0xea, 0xf5,  //+@%@@%@+
-  0x0a, 0xb1, 0x1b, 0xa0,  //.%%..%%.
-  0x0e, 0x10, 0x01, 0xe0,  //.@....@.
-  0x0e, 0x10, 0x01, 0xe0,  //.@....@.
-  0x0a, 0xb1, 0x1b, 0xa0,  //.%%..%%.
-  0x5f, 0xbe, 0xea, 0xf5,  //+@%@@%@+
-  0x95, 0x00, 0x00, 0x59,  //%+....+%
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe9, 0x00, 0x1f, 0x95, 0x00, 0x00, 0x59, 0x5f, 0xae, 0xea, 0xf5, 0x0a, 0xb1, 0x1b, 0xa0, 0x0e,
+  0x10, 0x01, 0xe0, 0x0e, 0x10, 0x01, 0xe0, 0x0a, 0xb1, 0x1b, 0xa0, 0x5f, 0xbe, 0xea, 0xf5, 0x95,
+  0x00, 0x00, 0x59, 0xe9, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xcf, 0x80, 0x00, 0x08, 0xfb,  //@@%....%@%
-  0x4f, 0xf1, 0x00, 0x1f, 0xf3,  //+@@....@@.
-  0x0c, 0xf8, 0x00, 0x9f, 0xb0,  //.@@%..%@%.
-  0x04, 0xff, 0x11, 0xff, 0x30,  //.+@@..@@..
-  0x00, 0xcf, 0x99, 0xfb, 0x00,  //..@@%%@%..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x0a, 0xff, 0x90, 0x00,  //...%@@%...
-  0x00, 0x01, 0xff, 0x10, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x18, 0xcf, 0x80, 0x00, 0x08, 0xfb, 0x4f, 0xf1, 0x00, 0x1f, 0xf3, 0x0c, 0xf8, 0x00,
+  0x9f, 0xb0, 0x04, 0xff, 0x11, 0xff, 0x30, 0x00, 0xcf, 0x99, 0xfb, 0x00, 0xfc, 0xff, 0x09, 0x00,
+  0x0a, 0xff, 0x90, 0x00, 0x00, 0x01, 0xff, 0x10, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x00, 0xff, 0xfd,
+  0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xeb, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-
+  0xfe, 0x00, 0xfa, 0xff, 0x01, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x02, 0xbf, 0xff, 0x00,  //..%@@@.
-  0x0b, 0xff, 0xff, 0x00,  //.%@@@@.
-  0x0f, 0xf4, 0x00, 0x00,  //.@@+...
-  0x0b, 0xf1, 0x00, 0x00,  //.%@....
-  0x03, 0xfa, 0x00, 0x00,  //..@%...
-  0x5f, 0xa8, 0xe5, 0x00,  //+@%%@+.
-  0xef, 0x00, 0xaf, 0x70,  //@@..%@+
-  0xef, 0x20, 0x1f, 0xe0,  //@@...@@
-  0x5f, 0xb0, 0x1f, 0xd0,  //+@%..@@
-  0x03, 0xcb, 0xce, 0x30,  //..@%@@.
-  0x00, 0x09, 0xf2, 0x00,  //...%@..
-  0x00, 0x01, 0xfc, 0x00,  //....@@.
-  0x00, 0x04, 0xff, 0x00,  //...+@@.
-  0x0f, 0xff, 0xfb, 0x00,  //.@@@@%.
-  0x0f, 0xff, 0xb1, 0x00,  //.@@@%..
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf5, 0x00, 0x3a, 0x02, 0xbf, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x0f, 0xf4, 0x00, 0x00, 0x0b,
+  0xf1, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00, 0x5f, 0xa8, 0xe5, 0x00, 0xef, 0x00, 0xaf, 0x70, 0xef,
+  0x20, 0x1f, 0xe0, 0x5f, 0xb0, 0x1f, 0xd0, 0x03, 0xcb, 0xce, 0x30, 0x00, 0x09, 0xf2, 0x00, 0x00,
+  0x01, 0xfc, 0x00, 0x00, 0x04, 0xff, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x0f, 0xff, 0xb1, 0xf8, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0xff, 0x00, 0xff,  //@@..@@
-  0xff, 0x00, 0xff,  //@@..@@
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xfb, 0x00, 0x05, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xd1, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x29, 0xef, 0xe9, 0x20, 0x00,  //...%@@@%...
-  0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00,  //.+@+...+@+.
-  0x1e, 0x35, 0xcf, 0xff, 0x3e, 0x10,  //.@.+@@@@.@.
-  0x97, 0x6d, 0x30, 0x00, 0x07, 0x90,  //%++@.....+%
-  0xe2, 0xd3, 0x00, 0x00, 0x02, 0xe0,  //@.@.......@
-  0xf0, 0xf0, 0x00, 0x00, 0x00, 0xf0,  //@.@.......@
-  0xe2, 0xd3, 0x00, 0x00, 0x02, 0xe0,  //@.@.......@
-  0x97, 0x6d, 0x40, 0x00, 0x07, 0x90,  //%++@+....+%
-  0x1e, 0x35, 0xcf, 0xff, 0x3e, 0x10,  //.@.+@@@@.@.
-  0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00,  //.+@+...+@+.
-  0x00, 0x19, 0xef, 0xe9, 0x10, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe8, 0x00, 0x1e, 0x29, 0xef, 0xe9, 0x20, 0x00, 0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00, 0x1e, 0x35,
+  0xcf, 0xff, 0x3e, 0x10, 0x97, 0x6d, 0x30, 0x00, 0x07, 0x90, 0xe2, 0xd3, 0x00, 0x00, 0x02, 0xe0,
+  0xf0, 0xf0, 0xfe, 0x00, 0x1d, 0xf0, 0xe2, 0xd3, 0x00, 0x00, 0x02, 0xe0, 0x97, 0x6d, 0x40, 0x00,
+  0x07, 0x90, 0x1e, 0x35, 0xcf, 0xff, 0x3e, 0x10, 0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00, 0x00, 0x19,
+  0xef, 0xe9, 0x10, 0xe2, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x0f, 0xff, 0xea, 0x20,  //.@@@@%..
-  0x00, 0x00, 0x16, 0xc0,  //.....+@.
-  0x08, 0xdf, 0xff, 0xf0,  //.%@@@@@.
-  0xa9, 0x20, 0x00, 0xf0,  //%%....@.
-  0xf0, 0x00, 0x05, 0xf0,  //@....+@.
-  0xc8, 0x11, 0x5e, 0xf0,  //@%..+@@.
-  0x1a, 0xef, 0xc4, 0xf0,  //.%@@@+@.
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x9f, 0xff, 0xff, 0xf0,  //%@@@@@@.
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf5, 0x00, 0x1b, 0x0f, 0xff, 0xea, 0x20, 0x00, 0x00, 0x16, 0xc0, 0x08, 0xdf, 0xff, 0xf0, 0xa9,
+  0x20, 0x00, 0xf0, 0xf0, 0x00, 0x05, 0xf0, 0xc8, 0x11, 0x5e, 0xf0, 0x1a, 0xef, 0xc4, 0xf0, 0xfd,
+  0x00, 0x03, 0x9f, 0xff, 0xff, 0xf0, 0xe1, 0x00,
 
   /*Unicode: U+00ab («) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x08, 0x00, 0x08,  //...%...%
-  0x00, 0xaf, 0x00, 0xae,  //..%@..%@
-  0x0b, 0xe3, 0x0b, 0xe2,  //.%@..%@.
-  0xcd, 0x20, 0xcc, 0x10,  //@@..@@..
-  0xcd, 0x20, 0xcc, 0x10,  //@@..@@..
-  0x0b, 0xe2, 0x0b, 0xe2,  //.%@..%@.
-  0x00, 0xaf, 0x00, 0xae,  //..%@..%@
-  0x00, 0x08, 0x00, 0x08,  //...%...%
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe4, 0x00, 0x1e, 0x08, 0x00, 0x08, 0x00, 0xaf, 0x00, 0xae, 0x0b, 0xe3, 0x0b, 0xe2, 0xcd, 0x20,
+  0xcc, 0x10, 0xcd, 0x20, 0xcc, 0x10, 0x0b, 0xe2, 0x0b, 0xe2, 0x00, 0xaf, 0x00, 0xae, 0x00, 0x08,
+  0x00, 0x08, 0xed, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x0f, 0xf0,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xd9, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x01, 0x0f, 0xf0, 0xfe,
+  0x00, 0x01, 0x0f, 0xf0, 0xd9, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xe3, 0x00, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xe9, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x29, 0xef, 0xe9, 0x20, 0x00,  //...%@@@%...
-  0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00,  //.+@+...+@+.
-  0x1e, 0x3f, 0xff, 0xd4, 0x3e, 0x10,  //.@.@@@@+.@.
-  0x97, 0x0f, 0x00, 0x4e, 0x07, 0x90,  //%+.@..+@.+%
-  0xe2, 0x0f, 0x00, 0x4e, 0x02, 0xe0,  //@..@..+@..@
-  0xf0, 0x0f, 0xef, 0xe4, 0x00, 0xf0,  //@..@@@@+..@
-  0xe2, 0x0f, 0x02, 0xe3, 0x02, 0xe0,  //@..@..@...@
-  0x97, 0x0f, 0x00, 0x5d, 0x07, 0x90,  //%+.@..+@.+%
-  0x1e, 0x3f, 0x00, 0x09, 0xde, 0x10,  //.@.@...%@@.
-  0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00,  //.+@+...+@+.
-  0x00, 0x19, 0xef, 0xe9, 0x10, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe8, 0x00, 0x3f, 0x29, 0xef, 0xe9, 0x20, 0x00, 0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00, 0x1e, 0x3f,
+  0xff, 0xd4, 0x3e, 0x10, 0x97, 0x0f, 0x00, 0x4e, 0x07, 0x90, 0xe2, 0x0f, 0x00, 0x4e, 0x02, 0xe0,
+  0xf0, 0x0f, 0xef, 0xe4, 0x00, 0xf0, 0xe2, 0x0f, 0x02, 0xe3, 0x02, 0xe0, 0x97, 0x0f, 0x00, 0x5d,
+  0x07, 0x90, 0x1e, 0x3f, 0x00, 0x09, 0xde, 0x10, 0x04, 0xe7, 0x20, 0x27, 0xe4, 0x00, 0x00, 0x19,
+  0xef, 0xe9, 0x10, 0xe2, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf0,  //@@@@@
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x05, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xd4, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x08, 0xee, 0x80,  //.%@@%.
-  0x8b, 0x11, 0xb8,  //%%..%%
-  0xe1, 0x00, 0x1e,  //@....@
-  0xe1, 0x00, 0x1e,  //@....@
-  0x9a, 0x11, 0xb8,  //%%..%%
-  0x09, 0xee, 0x80,  //.%@@%.
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf8, 0x00, 0x11, 0x08, 0xee, 0x80, 0x8b, 0x11, 0xb8, 0xe1, 0x00, 0x1e, 0xe1, 0x00, 0x1e, 0x9a,
+  0x11, 0xb8, 0x09, 0xee, 0x80, 0xe0, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe1, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xf7, 0xff,
+  0x02, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xf7, 0xff,
+  0xed, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x5d, 0xfc, 0x30,  //+@@@.
-  0xa2, 0x06, 0xd0,  //%..+@
-  0x00, 0x01, 0xe0,  //....@
-  0x00, 0x0b, 0x70,  //...%+
-  0x01, 0xca, 0x00,  //..@%.
-  0x4e, 0x70, 0x00,  //+@+..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x14, 0x5d, 0xfc, 0x30, 0xa2, 0x06, 0xd0, 0x00, 0x01, 0xe0, 0x00, 0x0b, 0x70, 0x01,
+  0xca, 0x00, 0x4e, 0x70, 0x00, 0xff, 0xff, 0xf0, 0xe3, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xfd, 0x60,  //@@@@+
-  0x00, 0x05, 0xe0,  //...+@
-  0x0f, 0xff, 0x40,  //.@@@+
-  0x00, 0x18, 0xc0,  //...%@
-  0x00, 0x00, 0xf0,  //....@
-  0x00, 0x19, 0xc0,  //...%@
-  0xff, 0xeb, 0x20,  //@@@%.
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x14, 0xff, 0xfd, 0x60, 0x00, 0x05, 0xe0, 0x0f, 0xff, 0x40, 0x00, 0x18, 0xc0, 0x00,
+  0x00, 0xf0, 0x00, 0x19, 0xc0, 0xff, 0xeb, 0x20, 0xe3, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 4 */
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x01, 0xe8,  //..@%
-  0x0c, 0xa0,  //.@%.
-  0x9b, 0x00,  //%%..
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-  0x00, 0x00,  //....
-
+  0xfd, 0x00, 0x04, 0x01, 0xe8, 0x0c, 0xa0, 0x9b, 0xe2, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@.
-  0xff, 0x10, 0x00, 0x3f, 0xf0,  //@@.....@@.
-  0xff, 0xb2, 0x03, 0xcf, 0xf1,  //@@%...@@@.
-  0xfd, 0xef, 0xff, 0xeb, 0xff,  //@@@@@@@%@@
-  0xfc, 0x2c, 0xfc, 0x33, 0xeb,  //@@.@@@..@%
-  0xfc, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xfc, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xfc, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xfc, 0x00, 0x00, 0x00, 0x00,  //@@........
-
+  0xe3, 0x00, 0x32, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x10, 0x00, 0x3f, 0xf0, 0xff, 0xb2, 0x03, 0xcf, 0xf1, 0xfd, 0xef, 0xff, 0xeb, 0xff,
+  0xfc, 0x2c, 0xfc, 0x33, 0xeb, 0xfc, 0xfd, 0x00, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0xfc, 0xfd, 0x00,
+  0x00, 0xfc, 0xfd, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x8c, 0xef, 0xff, 0xf0,  //..%@@@@@@
-  0x3f, 0xff, 0xff, 0x00, 0xf0,  //.@@@@@..@
-  0xcf, 0xff, 0xff, 0x00, 0xf0,  //@@@@@@..@
-  0xff, 0xff, 0xff, 0x00, 0xf0,  //@@@@@@..@
-  0xcf, 0xff, 0xff, 0x00, 0xf0,  //@@@@@@..@
-  0x3f, 0xff, 0xff, 0x00, 0xf0,  //.@@@@@..@
-  0x01, 0x8c, 0xff, 0x00, 0xf0,  //..%@@@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x0f, 0x00, 0xf0,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x0e, 0x01, 0x8c, 0xef, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x00, 0xf0, 0xcf, 0xff, 0xff,
+  0x00, 0xf0, 0xfe, 0xff, 0x38, 0x00, 0xf0, 0xcf, 0xff, 0xff, 0x00, 0xf0, 0x3f, 0xff, 0xff, 0x00,
+  0xf0, 0x01, 0x8c, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-
+  0xf9, 0x00, 0xfe, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x08, 0x80,  //.%%
-  0x02, 0xf0,  //..@
-  0xef, 0x90,  //@@%
-  0x00, 0x00,  //...
-
+  0xe1, 0x00, 0x07, 0x08, 0x80, 0x02, 0xf0, 0xef, 0x90, 0x00, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0xff, 0xf0, 0x00,  //@@@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0x00, 0xf0, 0x00,  //..@..
-  0xff, 0xff, 0xf0,  //@@@@@
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-
+  0xf8, 0x00, 0x14, 0xff, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0xe3, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x06, 0xdf, 0xd6, 0x00,  //.+@@@+.
-  0x6c, 0x30, 0x3d, 0x60,  //+@...@+
-  0xd3, 0x00, 0x03, 0xd0,  //@.....@
-  0xf0, 0x00, 0x00, 0xf0,  //@.....@
-  0xd3, 0x00, 0x03, 0xd0,  //@.....@
-  0x6c, 0x30, 0x3c, 0x60,  //+@...@+
-  0x06, 0xdf, 0xd6, 0x00,  //.+@@@+.
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0xcf, 0xff, 0xff, 0xc0,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf5, 0x00, 0x1a, 0x06, 0xdf, 0xd6, 0x00, 0x6c, 0x30, 0x3d, 0x60, 0xd3, 0x00, 0x03, 0xd0, 0xf0,
+  0x00, 0x00, 0xf0, 0xd3, 0x00, 0x03, 0xd0, 0x6c, 0x30, 0x3c, 0x60, 0x06, 0xdf, 0xd6, 0xfc, 0x00,
+  0x03, 0xcf, 0xff, 0xff, 0xc0, 0xe1, 0x00,
 
   /*Unicode: U+00bb (») , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x80, 0x00, 0x80, 0x00,  //%...%...
-  0xe9, 0x00, 0xf9, 0x00,  //@%..@%..
-  0x2e, 0xb0, 0x3e, 0xb0,  //.@%..@%.
-  0x01, 0xcc, 0x02, 0xdc,  //..@@..@@
-  0x01, 0xcc, 0x02, 0xdc,  //..@@..@@
-  0x2e, 0xb0, 0x3e, 0xb0,  //.@%..@%.
-  0xea, 0x00, 0xfa, 0x00,  //@%..@%..
-  0x80, 0x00, 0x80, 0x00,  //%...%...
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe5, 0x00, 0x1e, 0x80, 0x00, 0x80, 0x00, 0xe9, 0x00, 0xf9, 0x00, 0x2e, 0xb0, 0x3e, 0xb0, 0x01,
+  0xcc, 0x02, 0xdc, 0x01, 0xcc, 0x02, 0xdc, 0x2e, 0xb0, 0x3e, 0xb0, 0xea, 0x00, 0xfa, 0x00, 0x80,
+  0x00, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x0f, 0xff, 0x00, 0x00, 0x00,  //.@@@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x0f, 0xff, 0xff, 0x58, 0xbd,  //.@@@@@+%%@
-  0x14, 0x8b, 0xee, 0xb8, 0x41,  //.+%%@@%%+.
-  0xdb, 0x85, 0x10, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x00, 0x1d, 0xf0,  //.......@@.
-  0x00, 0x00, 0x00, 0xc7, 0xf0,  //......@+@.
-  0x00, 0x00, 0x0a, 0x80, 0xf0,  //.....%%.@.
-  0x00, 0x00, 0x89, 0x00, 0xf0,  //....%%..@.
-  0x00, 0x00, 0xff, 0xff, 0xff,  //....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xf0,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0xf0,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00,
+  0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x0c, 0x0f, 0xff, 0xff, 0x58,
+  0xbd, 0x14, 0x8b, 0xee, 0xb8, 0x41, 0xdb, 0x85, 0x10, 0xfc, 0x00, 0x01, 0x1d, 0xf0, 0xfe, 0x00,
+  0x0d, 0xc7, 0xf0, 0x00, 0x00, 0x0a, 0x80, 0xf0, 0x00, 0x00, 0x89, 0x00, 0xf0, 0x00, 0x00, 0xfe,
+  0xff, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x0f, 0xff, 0x00, 0x00, 0x00,  //.@@@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x0f, 0x00, 0x00, 0x00,  //...@......
-  0x0f, 0xff, 0xff, 0x58, 0xbd,  //.@@@@@+%%@
-  0x14, 0x8b, 0xee, 0xb8, 0x41,  //.+%%@@%%+.
-  0xdb, 0x85, 0x10, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x05, 0xdf, 0xc3,  //.....+@@@.
-  0x00, 0x00, 0x0a, 0x20, 0x6d,  //.....%..+@
-  0x00, 0x00, 0x00, 0x00, 0x1e,  //.........@
-  0x00, 0x00, 0x00, 0x00, 0xb7,  //........%+
-  0x00, 0x00, 0x00, 0x1c, 0xa0,  //.......@%.
-  0x00, 0x00, 0x04, 0xe7, 0x00,  //.....+@+..
-  0x00, 0x00, 0x0f, 0xff, 0xff,  //.....@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00,
+  0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x0c, 0x0f, 0xff, 0xff, 0x58,
+  0xbd, 0x14, 0x8b, 0xee, 0xb8, 0x41, 0xdb, 0x85, 0x10, 0xfd, 0x00, 0x07, 0x05, 0xdf, 0xc3, 0x00,
+  0x00, 0x0a, 0x20, 0x6d, 0xfd, 0x00, 0x00, 0x1e, 0xfd, 0x00, 0x00, 0xb7, 0xfe, 0x00, 0x05, 0x1c,
+  0xa0, 0x00, 0x00, 0x04, 0xe7, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xff, 0xf7, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x0f, 0xff, 0xd6, 0x00, 0x00,  //.@@@@+....
-  0x00, 0x00, 0x5e, 0x00, 0x00,  //....+@....
-  0x00, 0xff, 0xf4, 0x00, 0x00,  //..@@@+....
-  0x00, 0x01, 0x8c, 0x00, 0x00,  //....%@....
-  0x00, 0x00, 0x0f, 0x00, 0x00,  //.....@....
-  0x00, 0x01, 0x9c, 0x00, 0x00,  //....%@....
-  0x0f, 0xfe, 0xb4, 0x58, 0xbd,  //.@@@%++%%@
-  0x14, 0x8b, 0xee, 0xb8, 0x41,  //.+%%@@%%+.
-  0xdb, 0x85, 0x10, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x00, 0x1d, 0xf0,  //.......@@.
-  0x00, 0x00, 0x00, 0xc7, 0xf0,  //......@+@.
-  0x00, 0x00, 0x0a, 0x80, 0xf0,  //.....%%.@.
-  0x00, 0x00, 0x89, 0x00, 0xf0,  //....%%..@.
-  0x00, 0x00, 0xff, 0xff, 0xff,  //....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xf0,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0xf0,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x02, 0x0f, 0xff, 0xd6, 0xfd, 0x00, 0x00, 0x5e, 0xfe, 0x00, 0x01, 0xff, 0xf4, 0xfe,
+  0x00, 0x01, 0x01, 0x8c, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x10, 0x01, 0x9c, 0x00, 0x00, 0x0f,
+  0xfe, 0xb4, 0x58, 0xbd, 0x14, 0x8b, 0xee, 0xb8, 0x41, 0xdb, 0x85, 0x10, 0xfc, 0x00, 0x01, 0x1d,
+  0xf0, 0xfe, 0x00, 0x0d, 0xc7, 0xf0, 0x00, 0x00, 0x0a, 0x80, 0xf0, 0x00, 0x00, 0x89, 0x00, 0xf0,
+  0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x0f, 0xf0, 0x00,  //...@@..
-  0x00, 0x0f, 0xf0, 0x00,  //...@@..
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x0f, 0xf0, 0x00,  //...@@..
-  0x00, 0x0f, 0xf0, 0x00,  //...@@..
-  0x00, 0x3f, 0xd0, 0x00,  //...@@..
-  0x01, 0xdf, 0x80, 0x00,  //..@@%..
-  0x1d, 0xfc, 0x00, 0x00,  //.@@@...
-  0xaf, 0xd1, 0x00, 0x00,  //%@@....
-  0xff, 0x20, 0x00, 0x00,  //@@.....
-  0xdf, 0x30, 0x04, 0xb0,  //@@...+%
-  0x7f, 0xff, 0xff, 0xf0,  //+@@@@@@
-  0x06, 0xdf, 0xea, 0x40,  //.+@@@%+
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xf4, 0x00, 0x05, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xfb, 0x00, 0x26, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x3f, 0xd0, 0x00, 0x01, 0xdf, 0x80, 0x00, 0x1d, 0xfc, 0x00, 0x00, 0xaf,
+  0xd1, 0x00, 0x00, 0xff, 0x20, 0x00, 0x00, 0xdf, 0x30, 0x04, 0xb0, 0x7f, 0xff, 0xff, 0xf0, 0x06,
+  0xdf, 0xea, 0x40, 0xf1, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 9 */
-  0x00, 0x8c, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0a, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x01, 0x00, 0x8c, 0xfd, 0x00, 0x01, 0x0a, 0x90, 0xf9, 0x00, 0x01, 0x09, 0xf9, 0xfe, 0x00, 0x01,
+  0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00, 0x00, 0xaf,
+  0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07, 0xf9, 0x09,
+  0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0, 0x00, 0xcf,
+  0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 9 */
-  0x00, 0x00, 0xc8, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xa0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x00, 0xc8, 0xfe, 0x00, 0x01, 0x09, 0xa0, 0xf9, 0x00, 0x01, 0x09, 0xf9, 0xfe, 0x00,
+  0x01, 0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00, 0x00,
+  0xaf, 0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07, 0xf9,
+  0x09, 0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0, 0x00,
+  0xcf, 0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 9 */
-  0x00, 0x0a, 0xea, 0x00, 0x00,  //...%@%...
-  0x00, 0x9a, 0x0a, 0x90, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x0a, 0xea, 0xfe, 0x00, 0x02, 0x9a, 0x0a, 0x90, 0xfa, 0x00, 0x01, 0x09, 0xf9, 0xfe,
+  0x00, 0x01, 0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00,
+  0x00, 0xaf, 0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07,
+  0xf9, 0x09, 0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0,
+  0x00, 0xcf, 0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 9 */
-  0x00, 0x7f, 0x91, 0xd0, 0x00,  //..+@%.@..
-  0x00, 0xd1, 0x9f, 0x70, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0x7f, 0x91, 0xd0, 0x00, 0x00, 0xd1, 0x9f, 0x70, 0xfa, 0x00, 0x01, 0x09, 0xf9, 0xfe,
+  0x00, 0x01, 0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00,
+  0x00, 0xaf, 0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07,
+  0xf9, 0x09, 0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0,
+  0x00, 0xcf, 0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 9 */
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xfd, 0x00, 0x00,  //...@@@...
-  0x00, 0x2f, 0xff, 0x20, 0x00,  //...@@@...
-  0x00, 0x6f, 0xff, 0x60, 0x00,  //..+@@@+..
-  0x00, 0xaf, 0xcf, 0xa0, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x3f, 0xe0, 0x00,  //..@@.@@..
-  0x03, 0xfd, 0x0d, 0xf3, 0x00,  //..@@.@@..
-  0x07, 0xf9, 0x09, 0xf7, 0x00,  //.+@%.%@+.
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@.
-  0x5f, 0xc0, 0x00, 0xcf, 0x50,  //+@@...@@+
-  0x9f, 0x70, 0x00, 0x7f, 0x90,  //%@+...+@%
-  0xdf, 0x30, 0x00, 0x3f, 0xd0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0xfa, 0x00, 0x01, 0x09, 0xf9, 0xfe,
+  0x00, 0x01, 0x0d, 0xfd, 0xfe, 0x00, 0x22, 0x2f, 0xff, 0x20, 0x00, 0x00, 0x6f, 0xff, 0x60, 0x00,
+  0x00, 0xaf, 0xcf, 0xa0, 0x00, 0x00, 0xef, 0x3f, 0xe0, 0x00, 0x03, 0xfd, 0x0d, 0xf3, 0x00, 0x07,
+  0xf9, 0x09, 0xf7, 0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xfe, 0xff, 0x0f, 0x00, 0x5f, 0xc0,
+  0x00, 0xcf, 0x50, 0x9f, 0x70, 0x00, 0x7f, 0x90, 0xdf, 0x30, 0x00, 0x3f, 0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 9 */
-  0x00, 0x0d, 0x5d, 0x00, 0x00,  //...@+@...
-  0x00, 0x0f, 0x1f, 0x00, 0x00,  //...@.@...
-  0x00, 0x0d, 0x5c, 0x00, 0x00,  //...@+@...
-  0x00, 0x03, 0xf3, 0x00, 0x00,  //....@....
-  0x00, 0x04, 0xf4, 0x00, 0x00,  //...+@+...
-  0x00, 0x09, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0e, 0xfe, 0x00, 0x00,  //...@@@...
-  0x00, 0x3f, 0xff, 0x30, 0x00,  //...@@@...
-  0x00, 0x9f, 0xff, 0x90, 0x00,  //..%@@@%..
-  0x00, 0xef, 0x6f, 0xe0, 0x00,  //..@@+@@..
-  0x03, 0xfe, 0x0e, 0xf3, 0x00,  //..@@.@@..
-  0x08, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@%.
-  0x0d, 0xff, 0xff, 0xfd, 0x00,  //.@@@@@@@.
-  0x3f, 0xe0, 0x00, 0xef, 0x20,  //.@@...@@.
-  0x8f, 0x90, 0x00, 0x9f, 0x80,  //%@%...%@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x0d, 0x5d, 0xfe, 0x00, 0x01, 0x0f, 0x1f, 0xfe, 0x00, 0x01, 0x0d, 0x5c, 0xfe, 0x00,
+  0x01, 0x03, 0xf3, 0xfe, 0x00, 0x01, 0x04, 0xf4, 0xfe, 0x00, 0x01, 0x09, 0xf9, 0xfe, 0x00, 0x01,
+  0x0e, 0xfe, 0xfe, 0x00, 0x2b, 0x3f, 0xff, 0x30, 0x00, 0x00, 0x9f, 0xff, 0x90, 0x00, 0x00, 0xef,
+  0x6f, 0xe0, 0x00, 0x03, 0xfe, 0x0e, 0xf3, 0x00, 0x08, 0xff, 0xff, 0xf8, 0x00, 0x0d, 0xff, 0xff,
+  0xfd, 0x00, 0x3f, 0xe0, 0x00, 0xef, 0x20, 0x8f, 0x90, 0x00, 0x9f, 0x80, 0xdf, 0x40, 0x00, 0x4f,
+  0xd0, 0xed, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x04, 0xff, 0xff, 0xff, 0xf0,  //...+@@@@@@@
-  0x00, 0x09, 0xff, 0xff, 0xff, 0xf0,  //...%@@@@@@@
-  0x00, 0x0e, 0xf3, 0xff, 0x00, 0x00,  //...@@.@@...
-  0x00, 0x2f, 0xe0, 0xff, 0x00, 0x00,  //...@@.@@...
-  0x00, 0x7f, 0x90, 0xff, 0x00, 0x00,  //..+@%.@@...
-  0x00, 0xcf, 0x40, 0xff, 0xff, 0xf0,  //..@@+.@@@@@
-  0x01, 0xff, 0x00, 0xff, 0xff, 0xf0,  //..@@..@@@@@
-  0x05, 0xfb, 0x00, 0xff, 0x00, 0x00,  //.+@%..@@...
-  0x0a, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%@@@@@@...
-  0x0e, 0xff, 0xff, 0xff, 0x00, 0x00,  //.@@@@@@@...
-  0x4f, 0xd0, 0x00, 0xff, 0x00, 0x00,  //+@@...@@...
-  0x8f, 0x80, 0x00, 0xff, 0xff, 0xf0,  //%@%...@@@@@
-  0xdf, 0x30, 0x00, 0xff, 0xff, 0xf0,  //@@....@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xee, 0x00, 0x00, 0x04, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x09, 0xfe, 0xff, 0x04, 0xf0, 0x00, 0x0e,
+  0xf3, 0xff, 0xfe, 0x00, 0x02, 0x2f, 0xe0, 0xff, 0xfe, 0x00, 0x02, 0x7f, 0x90, 0xff, 0xfe, 0x00,
+  0x11, 0xcf, 0x40, 0xff, 0xff, 0xf0, 0x01, 0xff, 0x00, 0xff, 0xff, 0xf0, 0x05, 0xfb, 0x00, 0xff,
+  0x00, 0x00, 0x0a, 0xfe, 0xff, 0x02, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0x13, 0x00, 0x00, 0x4f, 0xd0,
+  0x00, 0xff, 0x00, 0x00, 0x8f, 0x80, 0x00, 0xff, 0xff, 0xf0, 0xdf, 0x30, 0x00, 0xff, 0xff, 0xf0,
+  0xe9, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x19, 0xdf, 0xeb, 0x40,  //...%@@@%+
-  0x04, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@
-  0x1e, 0xfa, 0x20, 0x14, 0xc0,  //.@@%...+@
-  0x7f, 0xb0, 0x00, 0x00, 0x00,  //+@%......
-  0xcf, 0x40, 0x00, 0x00, 0x00,  //@@+......
-  0xef, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xef, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0xcf, 0x40, 0x00, 0x00, 0x00,  //@@+......
-  0x8f, 0xb0, 0x00, 0x00, 0x00,  //%@%......
-  0x1e, 0xfa, 0x20, 0x04, 0xc0,  //.@@%...+@
-  0x04, 0xff, 0xff, 0xff, 0xf0,  //.+@@@@@@@
-  0x00, 0x29, 0xdf, 0xfb, 0x40,  //...%@@@%+
-  0x00, 0x00, 0x08, 0x80, 0x00,  //.....%%..
-  0x00, 0x00, 0x02, 0xf0, 0x00,  //......@..
-  0x00, 0x00, 0xef, 0x90, 0x00,  //....@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf1, 0x00, 0x04, 0x19, 0xdf, 0xeb, 0x40, 0x04, 0xfe, 0xff, 0x07, 0xf0, 0x1e, 0xfa, 0x20, 0x14,
+  0xc0, 0x7f, 0xb0, 0xfe, 0x00, 0x01, 0xcf, 0x40, 0xfe, 0x00, 0x01, 0xef, 0x10, 0xfe, 0x00, 0x00,
+  0xff, 0xfd, 0x00, 0x01, 0xef, 0x10, 0xfe, 0x00, 0x01, 0xcf, 0x40, 0xfe, 0x00, 0x01, 0x8f, 0xb0,
+  0xfe, 0x00, 0x05, 0x1e, 0xfa, 0x20, 0x04, 0xc0, 0x04, 0xfe, 0xff, 0x09, 0xf0, 0x00, 0x29, 0xdf,
+  0xfb, 0x40, 0x00, 0x00, 0x08, 0x80, 0xfe, 0x00, 0x01, 0x02, 0xf0, 0xfe, 0x00, 0x01, 0xef, 0x90,
+  0xfb, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 9 */
-  0x00, 0x8c, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0a, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x01, 0x00, 0x8c, 0xfd, 0x00, 0x01, 0x0a, 0x90, 0xfa, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff,
+  0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00,
+  0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 9 */
-  0x00, 0x00, 0xc8, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xa0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x00, 0xc8, 0xfe, 0x00, 0x01, 0x09, 0xa0, 0xfa, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd,
+  0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff,
+  0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+  0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 9 */
-  0x00, 0x0a, 0xea, 0x00, 0x00,  //...%@%...
-  0x00, 0x9a, 0x0a, 0x90, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x0a, 0xea, 0xfe, 0x00, 0x02, 0x9a, 0x0a, 0x90, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0xf0,
+  0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd,
+  0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 9 */
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0xf0,
+  0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd,
+  0xff, 0x00, 0xf0, 0xfd, 0xff, 0x01, 0xf0, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x00, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 8 */
-  0x08, 0xc0, 0x00, 0x00,  //.%@.....
-  0x00, 0xa9, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x01, 0x08, 0xc0, 0xfe, 0x00, 0x00, 0xa9, 0xfb, 0x00, 0xf9, 0xff, 0x23, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 8 */
-  0x00, 0x0c, 0x80, 0x00,  //...@%...
-  0x00, 0x9a, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x05, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x9a, 0xfb, 0x00, 0xf9, 0xff, 0x23, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 8 */
-  0x00, 0x3e, 0xe3, 0x00,  //...@@...
-  0x02, 0xd3, 0x3d, 0x20,  //..@..@..
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x07, 0x00, 0x3e, 0xe3, 0x00, 0x02, 0xd3, 0x3d, 0x20, 0xfd, 0x00, 0xf9, 0xff, 0x23, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 8 */
-  0x0f, 0xf0, 0x0f, 0xf0,  //.@@..@@.
-  0x0f, 0xf0, 0x0f, 0xf0,  //.@@..@@.
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x07, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0xfd, 0x00, 0xf9, 0xff, 0x23, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x0f, 0xff, 0xfd, 0x92, 0x00,  //.@@@@@%...
-  0x0f, 0xff, 0xff, 0xff, 0x50,  //.@@@@@@@+.
-  0x0f, 0xf0, 0x03, 0x9f, 0xf2,  //.@@...%@@.
-  0x0f, 0xf0, 0x00, 0x09, 0xf8,  //.@@....%@%
-  0x0f, 0xf0, 0x00, 0x03, 0xfc,  //.@@.....@@
-  0xff, 0xff, 0xf0, 0x00, 0xfe,  //@@@@@...@@
-  0xff, 0xff, 0xf0, 0x00, 0xff,  //@@@@@...@@
-  0x0f, 0xf0, 0x00, 0x00, 0xfe,  //.@@.....@@
-  0x0f, 0xf0, 0x00, 0x03, 0xfc,  //.@@.....@@
-  0x0f, 0xf0, 0x00, 0x09, 0xf8,  //.@@....%@%
-  0x0f, 0xf0, 0x03, 0x9f, 0xf2,  //.@@...%@@.
-  0x0f, 0xff, 0xff, 0xff, 0x50,  //.@@@@@@@+.
-  0x0f, 0xff, 0xfd, 0x92, 0x00,  //.@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x05, 0x0f, 0xff, 0xfd, 0x92, 0x00, 0x0f, 0xfe, 0xff, 0x2e, 0x50, 0x0f, 0xf0, 0x03,
+  0x9f, 0xf2, 0x0f, 0xf0, 0x00, 0x09, 0xf8, 0x0f, 0xf0, 0x00, 0x03, 0xfc, 0xff, 0xff, 0xf0, 0x00,
+  0xfe, 0xff, 0xff, 0xf0, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0xfe, 0x0f, 0xf0, 0x00, 0x03, 0xfc,
+  0x0f, 0xf0, 0x00, 0x09, 0xf8, 0x0f, 0xf0, 0x03, 0x9f, 0xf2, 0x0f, 0xfe, 0xff, 0x04, 0x50, 0x0f,
+  0xff, 0xfd, 0x92, 0xec, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 9 */
-  0x00, 0x7f, 0x91, 0xd0, 0x00,  //..+@%.@..
-  0x00, 0xd1, 0x9f, 0x70, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xc0, 0x00, 0x0f, 0xf0,  //@@@....@@
-  0xff, 0xf2, 0x00, 0x0f, 0xf0,  //@@@....@@
-  0xff, 0xe9, 0x00, 0x0f, 0xf0,  //@@@%...@@
-  0xff, 0x7f, 0x00, 0x0f, 0xf0,  //@@+@...@@
-  0xff, 0x1f, 0x60, 0x0f, 0xf0,  //@@.@+..@@
-  0xff, 0x0a, 0xd0, 0x0f, 0xf0,  //@@.%@..@@
-  0xff, 0x04, 0xf3, 0x0f, 0xf0,  //@@.+@..@@
-  0xff, 0x00, 0xda, 0x0f, 0xf0,  //@@..@%.@@
-  0xff, 0x00, 0x6f, 0x1f, 0xf0,  //@@..+@.@@
-  0xff, 0x00, 0x0f, 0x7f, 0xf0,  //@@...@+@@
-  0xff, 0x00, 0x09, 0xef, 0xf0,  //@@...%@@@
-  0xff, 0x00, 0x02, 0xff, 0xf0,  //@@....@@@
-  0xff, 0x00, 0x00, 0xcf, 0xf0,  //@@....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0x7f, 0x91, 0xd0, 0x00, 0x00, 0xd1, 0x9f, 0x70, 0xfb, 0x00, 0x40, 0xff, 0xc0, 0x00,
+  0x0f, 0xf0, 0xff, 0xf2, 0x00, 0x0f, 0xf0, 0xff, 0xe9, 0x00, 0x0f, 0xf0, 0xff, 0x7f, 0x00, 0x0f,
+  0xf0, 0xff, 0x1f, 0x60, 0x0f, 0xf0, 0xff, 0x0a, 0xd0, 0x0f, 0xf0, 0xff, 0x04, 0xf3, 0x0f, 0xf0,
+  0xff, 0x00, 0xda, 0x0f, 0xf0, 0xff, 0x00, 0x6f, 0x1f, 0xf0, 0xff, 0x00, 0x0f, 0x7f, 0xf0, 0xff,
+  0x00, 0x09, 0xef, 0xf0, 0xff, 0x00, 0x02, 0xff, 0xf0, 0xff, 0x00, 0x00, 0xcf, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 9 */
-  0x00, 0x8c, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0a, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x01, 0x00, 0x8c, 0xfd, 0x00, 0x01, 0x0a, 0x90, 0xf9, 0x00, 0x3e, 0x8e, 0xfe, 0x80, 0x00, 0x0c,
+  0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0xdf, 0x20,
+  0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3, 0x03, 0xef,
+  0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e, 0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 9 */
-  0x00, 0x00, 0xc8, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xa0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x00, 0xc8, 0xfe, 0x00, 0x01, 0x09, 0xa0, 0xf9, 0x00, 0x3e, 0x8e, 0xfe, 0x80, 0x00,
+  0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0xdf,
+  0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00,
+  0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3, 0x03,
+  0xef, 0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e, 0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 9 */
-  0x00, 0x0a, 0xea, 0x00, 0x00,  //...%@%...
-  0x00, 0x9a, 0x0a, 0x90, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x0a, 0xea, 0xfe, 0x00, 0x02, 0x9a, 0x0a, 0x90, 0xfa, 0x00, 0x3e, 0x8e, 0xfe, 0x80,
+  0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0,
+  0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3,
+  0x03, 0xef, 0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e, 0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 9 */
-  0x00, 0x7f, 0x91, 0xd0, 0x00,  //..+@%.@..
-  0x00, 0xd1, 0x9f, 0x70, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0x7f, 0x91, 0xd0, 0x00, 0x00, 0xd1, 0x9f, 0x70, 0xfa, 0x00, 0x3e, 0x8e, 0xfe, 0x80,
+  0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0,
+  0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3,
+  0x03, 0xef, 0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e, 0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 9 */
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xaf, 0x60, 0x00, 0x6f, 0xa0,  //%@+...+@%
-  0x5f, 0xe3, 0x03, 0xef, 0x50,  //+@@...@@+
-  0x0c, 0xff, 0xff, 0xfc, 0x00,  //.@@@@@@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0xfa, 0x00, 0x3e, 0x8e, 0xfe, 0x80,
+  0x00, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x5f, 0xe3, 0x03, 0xef, 0x50, 0xaf, 0x60, 0x00, 0x6f, 0xa0,
+  0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xaf, 0x60, 0x00, 0x6f, 0xa0, 0x5f, 0xe3,
+  0x03, 0xef, 0x50, 0x0c, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x8e, 0xfe, 0x80, 0xec, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x77, 0x00, 0x00, 0x77,  //++....++
-  0x7f, 0x70, 0x07, 0xf7,  //+@+..+@+
-  0x07, 0xf7, 0x7f, 0x70,  //.+@++@+.
-  0x00, 0x7f, 0xf7, 0x00,  //..+@@+..
-  0x00, 0x7f, 0xf7, 0x00,  //..+@@+..
-  0x08, 0xf7, 0x8f, 0x70,  //.%@+%@+.
-  0x8f, 0x80, 0x08, 0xf7,  //%@%..%@+
-  0x78, 0x00, 0x00, 0x87,  //+%....%+
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe9, 0x00, 0x1f, 0x77, 0x00, 0x00, 0x77, 0x7f, 0x70, 0x07, 0xf7, 0x07, 0xf7, 0x7f, 0x70, 0x00,
+  0x7f, 0xf7, 0x00, 0x00, 0x7f, 0xf7, 0x00, 0x08, 0xf7, 0x8f, 0x70, 0x8f, 0x80, 0x08, 0xf7, 0x78,
+  0x00, 0x00, 0x87, 0xe9, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00,  //...........
-  0x00, 0x19, 0xef, 0xc4, 0x0a, 0x80,  //...%@@@+.%%
-  0x00, 0xcf, 0xff, 0xff, 0x6e, 0x10,  //..@@@@@@+@.
-  0x06, 0xfe, 0x30, 0x3e, 0xf6, 0x00,  //.+@@...@@+.
-  0x0b, 0xf6, 0x00, 0x0c, 0xf8, 0x00,  //.%@+...@@%.
-  0x0e, 0xf2, 0x00, 0x9c, 0xfc, 0x00,  //.@@...%@@@.
-  0x0f, 0xf0, 0x06, 0xd1, 0xfe, 0x00,  //.@@..+@.@@.
-  0x0f, 0xf0, 0x4e, 0x20, 0xff, 0x00,  //.@@.+@..@@.
-  0x0e, 0xf2, 0xe4, 0x00, 0xff, 0x00,  //.@@.@+..@@.
-  0x0c, 0xfd, 0x60, 0x02, 0xfe, 0x00,  //.@@@+...@@.
-  0x09, 0xfa, 0x00, 0x06, 0xfb, 0x00,  //.%@%...+@%.
-  0x08, 0xfd, 0x30, 0x3e, 0xf6, 0x00,  //.%@@...@@+.
-  0x2e, 0x7f, 0xff, 0xff, 0xc0, 0x00,  //.@+@@@@@@..
-  0xa7, 0x05, 0xdf, 0xe9, 0x10, 0x00,  //%+.+@@@%...
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xf1, 0x00, 0x50, 0x01, 0x00, 0x00, 0x19, 0xef, 0xc4, 0x0a, 0x80, 0x00, 0xcf, 0xff, 0xff, 0x6e,
+  0x10, 0x06, 0xfe, 0x30, 0x3e, 0xf6, 0x00, 0x0b, 0xf6, 0x00, 0x0c, 0xf8, 0x00, 0x0e, 0xf2, 0x00,
+  0x9c, 0xfc, 0x00, 0x0f, 0xf0, 0x06, 0xd1, 0xfe, 0x00, 0x0f, 0xf0, 0x4e, 0x20, 0xff, 0x00, 0x0e,
+  0xf2, 0xe4, 0x00, 0xff, 0x00, 0x0c, 0xfd, 0x60, 0x02, 0xfe, 0x00, 0x09, 0xfa, 0x00, 0x06, 0xfb,
+  0x00, 0x08, 0xfd, 0x30, 0x3e, 0xf6, 0x00, 0x2e, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0xa7, 0x05, 0xdf,
+  0xe9, 0x10, 0x00, 0x20, 0xea, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 9 */
-  0x00, 0x8c, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0a, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xaf, 0xa2, 0x02, 0xbf, 0xa0,  //%@%...%@%
-  0x2f, 0xff, 0xff, 0xff, 0x20,  //.@@@@@@@.
-  0x02, 0xae, 0xfe, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x01, 0x00, 0x8c, 0xfd, 0x00, 0x01, 0x0a, 0x90, 0xfa, 0x00, 0x37, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00,
+  0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xef, 0x10, 0x00, 0x1f, 0xe0, 0xaf, 0xa2, 0x02,
+  0xbf, 0xa0, 0x2f, 0xfe, 0xff, 0x04, 0x20, 0x02, 0xae, 0xfe, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 9 */
-  0x00, 0x00, 0xc8, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xa0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xaf, 0xa2, 0x02, 0xbf, 0xa0,  //%@%...%@%
-  0x2f, 0xff, 0xff, 0xff, 0x20,  //.@@@@@@@.
-  0x02, 0xae, 0xfe, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x00, 0xc8, 0xfe, 0x00, 0x01, 0x09, 0xa0, 0xfa, 0x00, 0x37, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xef, 0x10, 0x00, 0x1f, 0xe0, 0xaf, 0xa2,
+  0x02, 0xbf, 0xa0, 0x2f, 0xfe, 0xff, 0x04, 0x20, 0x02, 0xae, 0xfe, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 9 */
-  0x00, 0x0a, 0xea, 0x00, 0x00,  //...%@%...
-  0x00, 0x9a, 0x0a, 0x90, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xaf, 0xa2, 0x02, 0xbf, 0xa0,  //%@%...%@%
-  0x2f, 0xff, 0xff, 0xff, 0x20,  //.@@@@@@@.
-  0x02, 0xae, 0xfe, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x02, 0x00, 0x0a, 0xea, 0xfe, 0x00, 0x02, 0x9a, 0x0a, 0x90, 0xfb, 0x00, 0x37, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xef, 0x10, 0x00, 0x1f, 0xe0, 0xaf,
+  0xa2, 0x02, 0xbf, 0xa0, 0x2f, 0xfe, 0xff, 0x04, 0x20, 0x02, 0xae, 0xfe, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 9 */
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0xff, 0x0f, 0xf0, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xef, 0x10, 0x00, 0x1f, 0xe0,  //@@.....@@
-  0xaf, 0xa2, 0x02, 0xbf, 0xa0,  //%@%...%@%
-  0x2f, 0xff, 0xff, 0xff, 0x20,  //.@@@@@@@.
-  0x02, 0xae, 0xfe, 0xa2, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x08, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0xfb, 0x00, 0x37, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xef, 0x10, 0x00, 0x1f, 0xe0, 0xaf,
+  0xa2, 0x02, 0xbf, 0xa0, 0x2f, 0xfe, 0xff, 0x04, 0x20, 0x02, 0xae, 0xfe, 0xa2, 0xec, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 10 */
-  0x00, 0x00, 0xc8, 0x00, 0x00,  //....@%....
-  0x00, 0x09, 0xa0, 0x00, 0x00,  //...%%.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xbf, 0x90, 0x00, 0x09, 0xfb,  //%@%....%@%
-  0x2f, 0xf2, 0x00, 0x2f, 0xf2,  //.@@....@@.
-  0x09, 0xfa, 0x00, 0xaf, 0x90,  //.%@%..%@%.
-  0x01, 0xff, 0x33, 0xff, 0x10,  //..@@..@@..
-  0x00, 0x7f, 0xcc, 0xf7, 0x00,  //..+@@@@+..
-  0x00, 0x0e, 0xff, 0xe0, 0x00,  //...@@@@...
-  0x00, 0x05, 0xff, 0x50, 0x00,  //...+@@+...
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0x02, 0x00, 0x00, 0xc8, 0xfe, 0x00, 0x01, 0x09, 0xa0, 0xfa, 0x00, 0x21, 0xbf, 0x90, 0x00, 0x09,
+  0xfb, 0x2f, 0xf2, 0x00, 0x2f, 0xf2, 0x09, 0xfa, 0x00, 0xaf, 0x90, 0x01, 0xff, 0x33, 0xff, 0x10,
+  0x00, 0x7f, 0xcc, 0xf7, 0x00, 0x00, 0x0e, 0xff, 0xe0, 0x00, 0x00, 0x05, 0xff, 0x50, 0xfe, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xeb, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xfe, 0xb3, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xff, 0x00, 0x03, 0xbf, 0xc0,  //@@....%@@
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x1f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x03, 0xbf, 0xc0,  //@@....%@@
-  0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@+
-  0xff, 0xff, 0xfe, 0xb4, 0x00,  //@@@@@@%+.
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x04, 0xff, 0xff, 0xfe, 0xb3, 0x00,
+  0xfd, 0xff, 0x14, 0x40, 0xff, 0x00, 0x03, 0xbf, 0xc0, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0x00,
+  0x00, 0x1f, 0xf0, 0xff, 0x00, 0x03, 0xbf, 0xc0, 0xfd, 0xff, 0x06, 0x40, 0xff, 0xff, 0xfe, 0xb4,
+  0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xe9, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x05, 0xcf, 0xfc, 0x50, 0x00,  //.+@@@@+..
-  0x5f, 0xff, 0xff, 0xf4, 0x00,  //+@@@@@@+.
-  0xcf, 0x91, 0x18, 0xfb, 0x00,  //@@%..%@%.
-  0xff, 0x10, 0x03, 0xfe, 0x00,  //@@....@@.
-  0xff, 0x00, 0x6f, 0xb3, 0x00,  //@@..+@%..
-  0xff, 0x00, 0xef, 0x10, 0x00,  //@@..@@...
-  0xff, 0x00, 0xef, 0x00, 0x00,  //@@..@@...
-  0xff, 0x00, 0x2d, 0x80, 0x00,  //@@...@%..
-  0xff, 0x00, 0x00, 0xcc, 0x10,  //@@....@@.
-  0xff, 0x00, 0x00, 0x3f, 0xa0,  //@@.....@%
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x0a, 0x20, 0x8f, 0xe0,  //@@.%..%@@
-  0xff, 0x0f, 0xff, 0xff, 0x80,  //@@.@@@@@%
-  0xff, 0x05, 0xdf, 0xd7, 0x00,  //@@.+@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x44, 0x05, 0xcf, 0xfc, 0x50, 0x00, 0x5f, 0xff, 0xff, 0xf4, 0x00, 0xcf, 0x91, 0x18,
+  0xfb, 0x00, 0xff, 0x10, 0x03, 0xfe, 0x00, 0xff, 0x00, 0x6f, 0xb3, 0x00, 0xff, 0x00, 0xef, 0x10,
+  0x00, 0xff, 0x00, 0xef, 0x00, 0x00, 0xff, 0x00, 0x2d, 0x80, 0x00, 0xff, 0x00, 0x00, 0xcc, 0x10,
+  0xff, 0x00, 0x00, 0x3f, 0xa0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x0a, 0x20, 0x8f, 0xe0, 0xff,
+  0x0f, 0xff, 0xff, 0x80, 0xff, 0x05, 0xdf, 0xd7, 0xec, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x08, 0xe1, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0xac, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0b, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x01, 0x08, 0xe1, 0xfd, 0x00, 0x00, 0xac, 0xfd, 0x00, 0x01, 0x0b, 0x90, 0xfa, 0x00,
+  0x05, 0x03, 0x9e, 0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02, 0xaf, 0xb0,
+  0xfe, 0x00, 0x07, 0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14, 0xf0, 0xef,
+  0x71, 0x00, 0x1f, 0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0, 0x08, 0xdf,
+  0xd7, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x80, 0x00,  //.....@%..
-  0x00, 0x00, 0xca, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xb0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x01, 0x1e, 0x80, 0xfe, 0x00, 0x00, 0xca, 0xfe, 0x00, 0x01, 0x09, 0xb0, 0xfa, 0x00,
+  0x05, 0x03, 0x9e, 0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02, 0xaf, 0xb0,
+  0xfe, 0x00, 0x07, 0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14, 0xf0, 0xef,
+  0x71, 0x00, 0x1f, 0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0, 0x08, 0xdf,
+  0xd7, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x02, 0xee, 0x20, 0x00,  //....@@...
-  0x00, 0x0c, 0x99, 0xc0, 0x00,  //...@%%@..
-  0x00, 0x9b, 0x00, 0xb9, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x0c, 0x02, 0xee, 0x20, 0x00, 0x00, 0x0c, 0x99, 0xc0, 0x00, 0x00, 0x9b, 0x00, 0xb9,
+  0xfb, 0x00, 0x05, 0x03, 0x9e, 0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02,
+  0xaf, 0xb0, 0xfe, 0x00, 0x07, 0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14,
+  0xf0, 0xef, 0x71, 0x00, 0x1f, 0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0,
+  0x08, 0xdf, 0xd7, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x6f, 0xc3, 0x2e, 0x00,  //..+@@..@.
-  0x00, 0xe2, 0x3c, 0xf6, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x07, 0x6f, 0xc3, 0x2e, 0x00, 0x00, 0xe2, 0x3c, 0xf6, 0xf6, 0x00, 0x05, 0x03, 0x9e,
+  0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02, 0xaf, 0xb0, 0xfe, 0x00, 0x07,
+  0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14, 0xf0, 0xef, 0x71, 0x00, 0x1f,
+  0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0, 0x08, 0xdf, 0xd7, 0x0f, 0xf0,
+  0xed, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xf6, 0x00, 0x05, 0x03, 0x9e,
+  0xfe, 0xa3, 0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02, 0xaf, 0xb0, 0xfe, 0x00, 0x07,
+  0x1f, 0xe0, 0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14, 0xf0, 0xef, 0x71, 0x00, 0x1f,
+  0xf0, 0xef, 0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0, 0x08, 0xdf, 0xd7, 0x0f, 0xf0,
+  0xed, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 9 */
-  0x00, 0x1b, 0xfb, 0x10, 0x00,  //...%@%...
-  0x00, 0xb7, 0x07, 0xb0, 0x00,  //..%+.+%..
-  0x00, 0xf0, 0x00, 0xf0, 0x00,  //..@...@..
-  0x00, 0xb7, 0x07, 0xb0, 0x00,  //..%+.+%..
-  0x00, 0x2b, 0xfb, 0x10, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x03, 0x9e, 0xfe, 0xa3, 0x00,  //..%@@@%..
-  0x0f, 0xff, 0xff, 0xff, 0x30,  //.@@@@@@@.
-  0x0c, 0x51, 0x02, 0xaf, 0xb0,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x1f, 0xe0,  //.......@@
-  0x05, 0xbe, 0xff, 0xff, 0xf0,  //.+%@@@@@@
-  0x7f, 0xff, 0xff, 0xff, 0xf0,  //+@@@@@@@@
-  0xef, 0x71, 0x00, 0x1f, 0xf0,  //@@+....@@
-  0xef, 0x50, 0x03, 0xbf, 0xf0,  //@@+...%@@
-  0x9f, 0xff, 0xff, 0x8f, 0xf0,  //%@@@@@%@@
-  0x08, 0xdf, 0xd7, 0x0f, 0xf0,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x17, 0x00, 0x1b, 0xfb, 0x10, 0x00, 0x00, 0xb7, 0x07, 0xb0, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+  0x00, 0xb7, 0x07, 0xb0, 0x00, 0x00, 0x2b, 0xfb, 0x10, 0xfb, 0x00, 0x05, 0x03, 0x9e, 0xfe, 0xa3,
+  0x00, 0x0f, 0xfe, 0xff, 0x05, 0x30, 0x0c, 0x51, 0x02, 0xaf, 0xb0, 0xfe, 0x00, 0x07, 0x1f, 0xe0,
+  0x05, 0xbe, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0x14, 0xf0, 0xef, 0x71, 0x00, 0x1f, 0xf0, 0xef,
+  0x50, 0x03, 0xbf, 0xf0, 0x9f, 0xff, 0xff, 0x8f, 0xf0, 0x08, 0xdf, 0xd7, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x07, 0xf6, 0x3d, 0xfb, 0x10,  //.+@+.@@%.
-  0x0f, 0xfe, 0xef, 0xff, 0x80,  //.@@@@@@@%
-  0x06, 0x4f, 0xf4, 0x4f, 0xd0,  //.++@@++@@
-  0x00, 0x0f, 0xf0, 0x0f, 0xf0,  //...@@..@@
-  0x1b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0xbf, 0xff, 0xff, 0xff, 0xf0,  //%@@@@@@@@
-  0xef, 0x2f, 0xf0, 0x00, 0x00,  //@@.@@....
-  0xff, 0x3f, 0xf6, 0x01, 0x90,  //@@.@@+..%
-  0xcf, 0xfc, 0xbf, 0xff, 0xf0,  //@@@@%@@@@
-  0x3d, 0xe3, 0x1b, 0xfd, 0x50,  //.@@..%@@+
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x14, 0x07, 0xf6, 0x3d, 0xfb, 0x10, 0x0f, 0xfe, 0xef, 0xff, 0x80, 0x06, 0x4f, 0xf4,
+  0x4f, 0xd0, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x1b, 0xfe, 0xff, 0x01, 0xf0, 0xbf, 0xfe, 0xff, 0x14,
+  0xf0, 0xef, 0x2f, 0xf0, 0x00, 0x00, 0xff, 0x3f, 0xf6, 0x01, 0x90, 0xcf, 0xfc, 0xbf, 0xff, 0xf0,
+  0x3d, 0xe3, 0x1b, 0xfd, 0x50, 0xed, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x7c, 0xff, 0xb4,  //..+@@@%+
-  0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x7f, 0xe6, 0x10, 0x3a,  //+@@+...%
-  0xcf, 0x50, 0x00, 0x00,  //@@+.....
-  0xff, 0x10, 0x00, 0x00,  //@@......
-  0xff, 0x10, 0x00, 0x00,  //@@......
-  0xcf, 0x50, 0x00, 0x00,  //@@+.....
-  0x7f, 0xe6, 0x10, 0x3a,  //+@@+...%
-  0x0b, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x00, 0x7c, 0xff, 0xc4,  //..+@@@@+
-  0x00, 0x00, 0x08, 0x80,  //.....%%.
-  0x00, 0x00, 0x02, 0xf0,  //......@.
-  0x00, 0x00, 0xef, 0x90,  //....@@%.
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe8, 0x00, 0x03, 0x7c, 0xff, 0xb4, 0x0b, 0xfe, 0xff, 0x18, 0x7f, 0xe6, 0x10, 0x3a, 0xcf, 0x50,
+  0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0xcf, 0x50, 0x00, 0x00, 0x7f, 0xe6,
+  0x10, 0x3a, 0x0b, 0xfe, 0xff, 0x0f, 0x00, 0x7c, 0xff, 0xc4, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00,
+  0x02, 0xf0, 0x00, 0x00, 0xef, 0x90, 0xfd, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x08, 0xe1, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0xac, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0b, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-  0x0b, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@.
-  0x7f, 0xc3, 0x02, 0xbf, 0x90,  //+@@...%@%
-  0xcf, 0x20, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xcf, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0x7f, 0xc4, 0x10, 0x26, 0xc0,  //+@@+...+@
-  0x0b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0x00, 0x6c, 0xff, 0xd9, 0x30,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x01, 0x08, 0xe1, 0xfd, 0x00, 0x00, 0xac, 0xfd, 0x00, 0x01, 0x0b, 0x90, 0xf9, 0x00,
+  0x12, 0x7d, 0xfe, 0xa2, 0x00, 0x0b, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xc3, 0x02, 0xbf, 0x90, 0xcf,
+  0x20, 0x00, 0x1f, 0xd0, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x02, 0xf0, 0xcf, 0x10, 0xfe, 0x00,
+  0x05, 0x7f, 0xc4, 0x10, 0x26, 0xc0, 0x0b, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x6c, 0xff, 0xd9, 0x30,
+  0xed, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x80, 0x00,  //.....@%..
-  0x00, 0x00, 0xca, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xb0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-  0x0b, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@.
-  0x7f, 0xc3, 0x02, 0xbf, 0x90,  //+@@...%@%
-  0xcf, 0x20, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xcf, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0x7f, 0xc4, 0x10, 0x26, 0xc0,  //+@@+...+@
-  0x0b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0x00, 0x6c, 0xff, 0xd9, 0x30,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x01, 0x1e, 0x80, 0xfe, 0x00, 0x00, 0xca, 0xfe, 0x00, 0x01, 0x09, 0xb0, 0xf9, 0x00,
+  0x12, 0x7d, 0xfe, 0xa2, 0x00, 0x0b, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xc3, 0x02, 0xbf, 0x90, 0xcf,
+  0x20, 0x00, 0x1f, 0xd0, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x02, 0xf0, 0xcf, 0x10, 0xfe, 0x00,
+  0x05, 0x7f, 0xc4, 0x10, 0x26, 0xc0, 0x0b, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x6c, 0xff, 0xd9, 0x30,
+  0xed, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x02, 0xee, 0x20, 0x00,  //....@@...
-  0x00, 0x0c, 0x99, 0xc0, 0x00,  //...@%%@..
-  0x00, 0x9b, 0x00, 0xb9, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-  0x0b, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@.
-  0x7f, 0xc3, 0x02, 0xbf, 0x90,  //+@@...%@%
-  0xcf, 0x20, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xcf, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0x7f, 0xc4, 0x10, 0x26, 0xc0,  //+@@+...+@
-  0x0b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0x00, 0x6c, 0xff, 0xd9, 0x30,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x0c, 0x02, 0xee, 0x20, 0x00, 0x00, 0x0c, 0x99, 0xc0, 0x00, 0x00, 0x9b, 0x00, 0xb9,
+  0xfa, 0x00, 0x12, 0x7d, 0xfe, 0xa2, 0x00, 0x0b, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xc3, 0x02, 0xbf,
+  0x90, 0xcf, 0x20, 0x00, 0x1f, 0xd0, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x02, 0xf0, 0xcf, 0x10,
+  0xfe, 0x00, 0x05, 0x7f, 0xc4, 0x10, 0x26, 0xc0, 0x0b, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x6c, 0xff,
+  0xd9, 0x30, 0xed, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7d, 0xfe, 0xa2, 0x00,  //..+@@@%..
-  0x0b, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@.
-  0x7f, 0xc3, 0x02, 0xbf, 0x90,  //+@@...%@%
-  0xcf, 0x20, 0x00, 0x1f, 0xd0,  //@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@
-  0xcf, 0x10, 0x00, 0x00, 0x00,  //@@.......
-  0x7f, 0xc4, 0x10, 0x26, 0xc0,  //+@@+...+@
-  0x0b, 0xff, 0xff, 0xff, 0xf0,  //.%@@@@@@@
-  0x00, 0x6c, 0xff, 0xd9, 0x30,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xf5, 0x00, 0x12, 0x7d, 0xfe,
+  0xa2, 0x00, 0x0b, 0xff, 0xff, 0xfe, 0x10, 0x7f, 0xc3, 0x02, 0xbf, 0x90, 0xcf, 0x20, 0x00, 0x1f,
+  0xd0, 0xfd, 0xff, 0x00, 0xf0, 0xfd, 0xff, 0x02, 0xf0, 0xcf, 0x10, 0xfe, 0x00, 0x05, 0x7f, 0xc4,
+  0x10, 0x26, 0xc0, 0x0b, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0x6c, 0xff, 0xd9, 0x30, 0xed, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x8e, 0x10, 0x00, 0x00,  //%@......
-  0x0a, 0xc0, 0x00, 0x00,  //.%@.....
-  0x00, 0xb9, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf9, 0x00, 0x05, 0x8e, 0x10, 0x00, 0x00, 0x0a, 0xc0, 0xfe, 0x00, 0x00, 0xb9, 0xfb, 0x00, 0x1f,
+  0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00,
+  0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x01, 0xe8, 0x00,  //....@%..
-  0x00, 0x0c, 0xa0, 0x00,  //...@%...
-  0x00, 0x9b, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf8, 0x00, 0x08, 0x01, 0xe8, 0x00, 0x00, 0x0c, 0xa0, 0x00, 0x00, 0x9b, 0xfb, 0x00, 0x1f, 0xff,
+  0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9,
+  0xff, 0xf1, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x2e, 0xe2, 0x00,  //...@@...
-  0x00, 0xc9, 0x9c, 0x00,  //..@%%@..
-  0x09, 0xb0, 0x0b, 0x90,  //.%%..%%.
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf8, 0x00, 0x0a, 0x2e, 0xe2, 0x00, 0x00, 0xc9, 0x9c, 0x00, 0x09, 0xb0, 0x0b, 0x90, 0xfd, 0x00,
+  0x1f, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
+  0x00, 0xf9, 0xff, 0xf1, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x0f, 0xf0, 0x0f, 0xf0,  //.@@..@@.
-  0x0f, 0xf0, 0x0f, 0xf0,  //.@@..@@.
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0xff, 0xff, 0xf0, 0x00,  //@@@@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf9, 0x00, 0x07, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0xf9, 0x00, 0x1f, 0xff, 0xff,
+  0xf0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+  0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xf9, 0xff,
+  0xf1, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x09, 0xfe, 0x20, 0x43, 0x00,  //.%@@..+..
-  0x00, 0xbf, 0xee, 0xa3, 0x00,  //..%@@@%..
-  0x09, 0xee, 0xfc, 0x00, 0x00,  //.%@@@@...
-  0x01, 0x02, 0xff, 0xb0, 0x00,  //....@@%..
-  0x01, 0x9e, 0xff, 0xf7, 0x00,  //..%@@@@+.
-  0x1d, 0xff, 0xff, 0xff, 0x10,  //.@@@@@@@.
-  0x8f, 0xd4, 0x01, 0xcf, 0x70,  //%@@+..@@+
-  0xdf, 0x40, 0x00, 0x4f, 0xc0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xe0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1d, 0xff, 0xff, 0xfd, 0x00,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x19, 0x09, 0xfe, 0x20, 0x43, 0x00, 0x00, 0xbf, 0xee, 0xa3, 0x00, 0x09, 0xee, 0xfc,
+  0x00, 0x00, 0x01, 0x02, 0xff, 0xb0, 0x00, 0x01, 0x9e, 0xff, 0xf7, 0x00, 0x1d, 0xfe, 0xff, 0x27,
+  0x10, 0x8f, 0xd4, 0x01, 0xcf, 0x70, 0xdf, 0x40, 0x00, 0x4f, 0xc0, 0xff, 0x00, 0x00, 0x0f, 0xe0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1d,
+  0xff, 0xff, 0xfd, 0x00, 0x01, 0x9e, 0xfe, 0x91, 0xec, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x6f, 0xc3, 0x2e, 0x00,  //..+@@..@.
-  0x00, 0xe2, 0x3c, 0xf6, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x06, 0xdf, 0xd6, 0x00,  //@@.+@@@+.
-  0xff, 0x7f, 0xff, 0xff, 0x50,  //@@+@@@@@+
-  0xff, 0xd4, 0x01, 0xbf, 0xc0,  //@@@+..%@@
-  0xff, 0x40, 0x00, 0x2f, 0xf0,  //@@+....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x07, 0x6f, 0xc3, 0x2e, 0x00, 0x00, 0xe2, 0x3c, 0xf6, 0xf6, 0x00, 0x31, 0xff, 0x06,
+  0xdf, 0xd6, 0x00, 0xff, 0x7f, 0xff, 0xff, 0x50, 0xff, 0xd4, 0x01, 0xbf, 0xc0, 0xff, 0x40, 0x00,
+  0x2f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xed, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x08, 0xe1, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0xac, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0b, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x01, 0x08, 0xe1, 0xfd, 0x00, 0x00, 0xac, 0xfd, 0x00, 0x01, 0x0b, 0x90, 0xfa, 0x00,
+  0x30, 0x01, 0x9e, 0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03, 0xdf, 0x80,
+  0xdf, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf,
+  0x40, 0x00, 0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x01, 0x9e,
+  0xfe, 0x91, 0xec, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x80, 0x00,  //.....@%..
-  0x00, 0x00, 0xca, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xb0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x01, 0x1e, 0x80, 0xfe, 0x00, 0x00, 0xca, 0xfe, 0x00, 0x01, 0x09, 0xb0, 0xfa, 0x00,
+  0x30, 0x01, 0x9e, 0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03, 0xdf, 0x80,
+  0xdf, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf,
+  0x40, 0x00, 0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x01, 0x9e,
+  0xfe, 0x91, 0xec, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0xf6, 0x00, 0x00,  //...+@+...
-  0x00, 0x1e, 0x6e, 0x10, 0x00,  //...@+@...
-  0x00, 0xa7, 0x07, 0xa0, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x01, 0x06, 0xf6, 0xfe, 0x00, 0x07, 0x1e, 0x6e, 0x10, 0x00, 0x00, 0xa7, 0x07, 0xa0,
+  0xfb, 0x00, 0x30, 0x01, 0x9e, 0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03,
+  0xdf, 0x80, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xdf, 0x40, 0x00, 0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10,
+  0x01, 0x9e, 0xfe, 0x91, 0xec, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x7f, 0x81, 0xd0, 0x00,  //..+@%.@..
-  0x00, 0xd0, 0x8f, 0x70, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x07, 0x7f, 0x81, 0xd0, 0x00, 0x00, 0xd0, 0x8f, 0x70, 0xf6, 0x00, 0x30, 0x01, 0x9e,
+  0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0xdf, 0x40, 0x00,
+  0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x40, 0x00, 0x4f,
+  0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x01, 0x9e, 0xfe, 0x91, 0xec,
+  0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x0f, 0xf0, 0x00, 0xff, 0x00,  //.@@...@@.
-  0x0f, 0xf0, 0x00, 0xff, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0x8f, 0xd3, 0x03, 0xdf, 0x80,  //%@@...@@%
-  0x1e, 0xff, 0xff, 0xfe, 0x10,  //.@@@@@@@.
-  0x01, 0x9e, 0xfe, 0x91, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x08, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xf6, 0x00, 0x30, 0x01,
+  0x9e, 0xfe, 0x91, 0x00, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0xdf, 0x40,
+  0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xdf, 0x40, 0x00,
+  0x4f, 0xd0, 0x8f, 0xd3, 0x03, 0xdf, 0x80, 0x1e, 0xff, 0xff, 0xfe, 0x10, 0x01, 0x9e, 0xfe, 0x91,
+  0xec, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0xff, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe1, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfa, 0x00, 0xf7, 0xff, 0xfa, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x10,  //...........
-  0x00, 0x2a, 0xef, 0xd5, 0x1e, 0x60,  //...%@@@+.@+
-  0x02, 0xff, 0xff, 0xff, 0xdb, 0x00,  //..@@@@@@@%.
-  0x0a, 0xfd, 0x30, 0x3f, 0xf4, 0x00,  //.%@@...@@+.
-  0x0e, 0xf4, 0x00, 0x9d, 0xfb, 0x00,  //.@@+..%@@%.
-  0x0f, 0xf0, 0x0a, 0xa0, 0xfe, 0x00,  //.@@..%%.@@.
-  0x0e, 0xf1, 0xaa, 0x00, 0xff, 0x00,  //.@@.%%..@@.
-  0x0a, 0xfd, 0x90, 0x04, 0xfe, 0x00,  //.%@@%..+@@.
-  0x04, 0xff, 0x30, 0x3d, 0xfa, 0x00,  //.+@@...@@%.
-  0x0b, 0xcf, 0xff, 0xff, 0xf2, 0x00,  //.%@@@@@@@..
-  0x5d, 0x04, 0xdf, 0xea, 0x20, 0x00,  //+@.+@@@%...
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xdf, 0x00, 0x08, 0x03, 0x10, 0x00, 0x2a, 0xef, 0xd5, 0x1e, 0x60, 0x02, 0xfe, 0xff, 0x32, 0xdb,
+  0x00, 0x0a, 0xfd, 0x30, 0x3f, 0xf4, 0x00, 0x0e, 0xf4, 0x00, 0x9d, 0xfb, 0x00, 0x0f, 0xf0, 0x0a,
+  0xa0, 0xfe, 0x00, 0x0e, 0xf1, 0xaa, 0x00, 0xff, 0x00, 0x0a, 0xfd, 0x90, 0x04, 0xfe, 0x00, 0x04,
+  0xff, 0x30, 0x3d, 0xfa, 0x00, 0x0b, 0xcf, 0xff, 0xff, 0xf2, 0x00, 0x5d, 0x04, 0xdf, 0xea, 0x20,
+  0x00, 0x22, 0xea, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x08, 0xe1, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0xac, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x0b, 0x90, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x20, 0x00, 0x4f, 0xf0,  //@@....+@@
-  0xcf, 0xb1, 0x04, 0xdf, 0xf0,  //@@%..+@@@
-  0x5f, 0xff, 0xff, 0x7f, 0xf0,  //+@@@@@+@@
-  0x06, 0xdf, 0xd6, 0x0f, 0xf0,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x01, 0x08, 0xe1, 0xfd, 0x00, 0x00, 0xac, 0xfd, 0x00, 0x01, 0x0b, 0x90, 0xfa, 0x00,
+  0x31, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x20, 0x00, 0x4f, 0xf0, 0xcf, 0xb1, 0x04, 0xdf, 0xf0, 0x5f, 0xff, 0xff, 0x7f, 0xf0, 0x06, 0xdf,
+  0xd6, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x80, 0x00,  //.....@%..
-  0x00, 0x00, 0xca, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xb0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x20, 0x00, 0x4f, 0xf0,  //@@....+@@
-  0xcf, 0xb1, 0x04, 0xdf, 0xf0,  //@@%..+@@@
-  0x5f, 0xff, 0xff, 0x7f, 0xf0,  //+@@@@@+@@
-  0x06, 0xdf, 0xd6, 0x0f, 0xf0,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf5, 0x00, 0x01, 0x1e, 0x80, 0xfe, 0x00, 0x00, 0xca, 0xfe, 0x00, 0x01, 0x09, 0xb0, 0xfa, 0x00,
+  0x31, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff,
+  0x20, 0x00, 0x4f, 0xf0, 0xcf, 0xb1, 0x04, 0xdf, 0xf0, 0x5f, 0xff, 0xff, 0x7f, 0xf0, 0x06, 0xdf,
+  0xd6, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0xf6, 0x00, 0x00,  //...+@+...
-  0x00, 0x1e, 0x6e, 0x10, 0x00,  //...@+@...
-  0x00, 0xa7, 0x07, 0xa0, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x20, 0x00, 0x4f, 0xf0,  //@@....+@@
-  0xcf, 0xb1, 0x04, 0xdf, 0xf0,  //@@%..+@@@
-  0x5f, 0xff, 0xff, 0x7f, 0xf0,  //+@@@@@+@@
-  0x06, 0xdf, 0xd6, 0x0f, 0xf0,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf6, 0x00, 0x01, 0x06, 0xf6, 0xfe, 0x00, 0x07, 0x1e, 0x6e, 0x10, 0x00, 0x00, 0xa7, 0x07, 0xa0,
+  0xfb, 0x00, 0x31, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00,
+  0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x20, 0x00, 0x4f, 0xf0, 0xcf, 0xb1, 0x04, 0xdf, 0xf0, 0x5f, 0xff, 0xff, 0x7f, 0xf0,
+  0x06, 0xdf, 0xd6, 0x0f, 0xf0, 0xed, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x0f, 0xf0, 0x00, 0xff, 0x00,  //.@@...@@.
-  0x0f, 0xf0, 0x00, 0xff, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x20, 0x00, 0x4f, 0xf0,  //@@....+@@
-  0xcf, 0xb1, 0x04, 0xdf, 0xf0,  //@@%..+@@@
-  0x5f, 0xff, 0xff, 0x7f, 0xf0,  //+@@@@@+@@
-  0x06, 0xdf, 0xd6, 0x0f, 0xf0,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x08, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xf6, 0x00, 0x31, 0xff,
+  0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00,
+  0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x20, 0x00,
+  0x4f, 0xf0, 0xcf, 0xb1, 0x04, 0xdf, 0xf0, 0x5f, 0xff, 0xff, 0x7f, 0xf0, 0x06, 0xdf, 0xd6, 0x0f,
+  0xf0, 0xed, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x80, 0x00,  //.....@%..
-  0x00, 0x00, 0xca, 0x00, 0x00,  //....@%...
-  0x00, 0x09, 0xb0, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xcf, 0x50, 0x00, 0x4f, 0xc0,  //@@+...+@@
-  0x6f, 0xc0, 0x00, 0xaf, 0x60,  //+@@...%@+
-  0x0e, 0xf3, 0x01, 0xff, 0x10,  //.@@...@@.
-  0x08, 0xf9, 0x06, 0xfb, 0x00,  //.%@%.+@%.
-  0x02, 0xff, 0x0c, 0xf5, 0x00,  //..@@.@@+.
-  0x00, 0xbf, 0x9f, 0xe0, 0x00,  //..%@%@@..
-  0x00, 0x5f, 0xff, 0x90, 0x00,  //..+@@@%..
-  0x00, 0x0e, 0xff, 0x30, 0x00,  //...@@@...
-  0x00, 0x07, 0xfe, 0x00, 0x00,  //...+@@...
-  0x00, 0x08, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xf3, 0x00, 0x00,  //...@@....
-  0x00, 0x6f, 0xe0, 0x00, 0x00,  //..+@@....
-  0x0f, 0xff, 0x70, 0x00, 0x00,  //.@@@+....
-  0x0f, 0xf9, 0x00, 0x00, 0x00,  //.@@%.....
-
+  0xf5, 0x00, 0x01, 0x1e, 0x80, 0xfe, 0x00, 0x00, 0xca, 0xfe, 0x00, 0x01, 0x09, 0xb0, 0xfa, 0x00,
+  0x2a, 0xcf, 0x50, 0x00, 0x4f, 0xc0, 0x6f, 0xc0, 0x00, 0xaf, 0x60, 0x0e, 0xf3, 0x01, 0xff, 0x10,
+  0x08, 0xf9, 0x06, 0xfb, 0x00, 0x02, 0xff, 0x0c, 0xf5, 0x00, 0x00, 0xbf, 0x9f, 0xe0, 0x00, 0x00,
+  0x5f, 0xff, 0x90, 0x00, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0x00, 0x01, 0x08,
+  0xf9, 0xfe, 0x00, 0x01, 0x0d, 0xf3, 0xfe, 0x00, 0x0a, 0x6f, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0x70,
+  0x00, 0x00, 0x0f, 0xf9, 0xfe, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x09, 0xfe, 0xa1, 0x00,  //@@.%@@%..
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x40, 0x00, 0x4f, 0xd0,  //@@+...+@@
-  0xff, 0xd3, 0x03, 0xdf, 0x80,  //@@@...@@%
-  0xff, 0xaf, 0xff, 0xfe, 0x10,  //@@%@@@@@.
-  0xff, 0x0a, 0xfe, 0xa2, 0x00,  //@@.%@@%..
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+  0xf7, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x32, 0xff, 0x09, 0xfe, 0xa1, 0x00, 0xff, 0xaf, 0xff, 0xfe, 0x10, 0xff, 0xd3, 0x03,
+  0xdf, 0x80, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f,
+  0xf0, 0xff, 0x40, 0x00, 0x4f, 0xd0, 0xff, 0xd3, 0x03, 0xdf, 0x80, 0xff, 0xaf, 0xff, 0xfe, 0x10,
+  0xff, 0x0a, 0xfe, 0xa2, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00,
+  0x00, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0xff, 0x00, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xcf, 0x50, 0x00, 0x4f, 0xc0,  //@@+...+@@
-  0x6f, 0xc0, 0x00, 0xaf, 0x60,  //+@@...%@+
-  0x0e, 0xf3, 0x01, 0xff, 0x10,  //.@@...@@.
-  0x08, 0xf9, 0x06, 0xfb, 0x00,  //.%@%.+@%.
-  0x02, 0xff, 0x0c, 0xf5, 0x00,  //..@@.@@+.
-  0x00, 0xbf, 0x9f, 0xe0, 0x00,  //..%@%@@..
-  0x00, 0x5f, 0xff, 0x90, 0x00,  //..+@@@%..
-  0x00, 0x0e, 0xff, 0x30, 0x00,  //...@@@...
-  0x00, 0x07, 0xfe, 0x00, 0x00,  //...+@@...
-  0x00, 0x08, 0xf9, 0x00, 0x00,  //...%@%...
-  0x00, 0x0d, 0xf3, 0x00, 0x00,  //...@@....
-  0x00, 0x6f, 0xe0, 0x00, 0x00,  //..+@@....
-  0x0f, 0xff, 0x70, 0x00, 0x00,  //.@@@+....
-  0x0f, 0xf9, 0x00, 0x00, 0x00,  //.@@%.....
-
-
+  0xf6, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xf6, 0x00, 0x2a, 0xcf, 0x50,
+  0x00, 0x4f, 0xc0, 0x6f, 0xc0, 0x00, 0xaf, 0x60, 0x0e, 0xf3, 0x01, 0xff, 0x10, 0x08, 0xf9, 0x06,
+  0xfb, 0x00, 0x02, 0xff, 0x0c, 0xf5, 0x00, 0x00, 0xbf, 0x9f, 0xe0, 0x00, 0x00, 0x5f, 0xff, 0x90,
+  0x00, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x07, 0xfe, 0xfe, 0x00, 0x01, 0x08, 0xf9, 0xfe, 0x00,
+  0x01, 0x0d, 0xf3, 0xfe, 0x00, 0x0a, 0x6f, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0x70, 0x00, 0x00, 0x0f,
+  0xf9, 0xfe, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 8
   /*Unicode: U+00a0 ( ) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0x89, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xd2, 0xd2,  //@@
-  0xe4, 0xe2,  //@@
-  0xf4, 0xf2,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xfb, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x05, 0xd2, 0xd2, 0xe4, 0xe2, 0xf4, 0xf2, 0xf5, 0xff, 0xf9,
+  0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x10, 0x92, 0xe6, 0xff, 0xd6, 0x52,  //..%@@@+
-  0x0a, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@
-  0x7c, 0xff, 0xd6, 0x2a, 0xff, 0x20, 0xa4,  //+@@.@.%
-  0xd2, 0xff, 0x46, 0x00, 0xff, 0x00, 0x00,  //@@+.@..
-  0xf6, 0xff, 0x0c, 0x00, 0xff, 0x00, 0x00,  //@@..@..
-  0xf6, 0xff, 0x0e, 0x00, 0xff, 0x00, 0x00,  //@@..@..
-  0xd2, 0xff, 0x4a, 0x00, 0xff, 0x00, 0x00,  //@@+.@..
-  0x7e, 0xff, 0xdc, 0x36, 0xff, 0x26, 0xa8,  //+@@.@.%
-  0x0a, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@
-  0x00, 0x10, 0x92, 0xe6, 0xff, 0xd6, 0x54,  //..%@@@+
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,  //....@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xe8, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x07, 0x10,
+  0x92, 0xe6, 0xff, 0xd6, 0x52, 0x0a, 0xd2, 0xfc, 0xff, 0x2b, 0x7c, 0xff, 0xd6, 0x2a, 0xff, 0x20,
+  0xa4, 0xd2, 0xff, 0x46, 0x00, 0xff, 0x00, 0x00, 0xf6, 0xff, 0x0c, 0x00, 0xff, 0x00, 0x00, 0xf6,
+  0xff, 0x0e, 0x00, 0xff, 0x00, 0x00, 0xd2, 0xff, 0x4a, 0x00, 0xff, 0x00, 0x00, 0x7e, 0xff, 0xdc,
+  0x36, 0xff, 0x26, 0xa8, 0x0a, 0xd4, 0xfc, 0xff, 0x06, 0x00, 0x10, 0x92, 0xe6, 0xff, 0xd6, 0x54,
+  0xfd, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf8, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x36, 0xb4, 0xec, 0xf8, 0xc2, 0x4c,  //....%@@@+
-  0x00, 0x00, 0x34, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@
-  0x00, 0x00, 0xae, 0xff, 0xc8, 0x2e, 0x06, 0x2a, 0xa6,  //..%@@...%
-  0x00, 0x00, 0xe8, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x00, 0xfc, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@@@@..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@@@@..
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //..@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe3, 0x00, 0x09, 0x36, 0xb4, 0xec, 0xf8, 0xc2, 0x4c, 0x00, 0x00, 0x34, 0xf8, 0xfc, 0xff, 0x0d,
+  0x00, 0x00, 0xae, 0xff, 0xc8, 0x2e, 0x06, 0x2a, 0xa6, 0x00, 0x00, 0xe8, 0xff, 0x32, 0xfb, 0x00,
+  0x02, 0xfc, 0xff, 0x06, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfa, 0xff, 0x01, 0x00, 0x00,
+  0xfa, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff,
+  0xff, 0xfc, 0x00, 0xef, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x96, 0x58, 0x00, 0x00, 0x00, 0x00, 0x52, 0x9a,  //%+....+%
-  0x5a, 0xf4, 0xaa, 0xec, 0xec, 0xaa, 0xf2, 0x56,  //+@%@@%@+
-  0x00, 0xaa, 0xb2, 0x18, 0x18, 0xb2, 0xaa, 0x00,  //.%%..%%.
-  0x00, 0xec, 0x18, 0x00, 0x00, 0x18, 0xec, 0x00,  //.@....@.
-  0x00, 0xee, 0x18, 0x00, 0x00, 0x1a, 0xec, 0x00,  //.@....@.
-  0x00, 0xac, 0xb2, 0x18, 0x18, 0xb2, 0xaa, 0x00,  //.%%..%%.
-  0x52, 0xf2, 0xb0, 0xee, 0xee, 0xaa, 0xf4, 0x5a,  //+@%@@%@+
-  0x9a, 0x56, 0x00, 0x00, 0x00, 0x00, 0x58, 0x96,  //%+....+%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd1, 0x00, 0x01, 0x96, 0x58, 0xfd, 0x00, 0x33, 0x52, 0x9a, 0x5a, 0xf4, 0xaa, 0xec, 0xec, 0xaa,
+  0xf2, 0x56, 0x00, 0xaa, 0xb2, 0x18, 0x18, 0xb2, 0xaa, 0x00, 0x00, 0xec, 0x18, 0x00, 0x00, 0x18,
+  0xec, 0x00, 0x00, 0xee, 0x18, 0x00, 0x00, 0x1a, 0xec, 0x00, 0x00, 0xac, 0xb2, 0x18, 0x18, 0xb2,
+  0xaa, 0x00, 0x52, 0xf2, 0xb0, 0xee, 0xee, 0xaa, 0xf4, 0x5a, 0x9a, 0x56, 0xfd, 0x00, 0x01, 0x58,
+  0x96, 0xd1, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xc0, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xbe,  //@@%....%@%
-  0x44, 0xff, 0xf2, 0x14, 0x00, 0x00, 0x14, 0xf2, 0xff, 0x3c,  //+@@....@@.
-  0x00, 0xc6, 0xff, 0x8e, 0x00, 0x00, 0x90, 0xff, 0xbc, 0x00,  //.@@%..%@%.
-  0x00, 0x4a, 0xff, 0xf6, 0x1c, 0x1e, 0xf8, 0xff, 0x3a, 0x00,  //.+@@..@@..
-  0x00, 0x00, 0xcc, 0xff, 0x9c, 0x9e, 0xff, 0xba, 0x00, 0x00,  //..@@%%@%..
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00,  //...%@@%...
-  0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe3, 0x00, 0x02, 0xc0, 0xff, 0x82, 0xfd, 0x00, 0x1f, 0x82, 0xff, 0xbe, 0x44, 0xff, 0xf2, 0x14,
+  0x00, 0x00, 0x14, 0xf2, 0xff, 0x3c, 0x00, 0xc6, 0xff, 0x8e, 0x00, 0x00, 0x90, 0xff, 0xbc, 0x00,
+  0x00, 0x4a, 0xff, 0xf6, 0x1c, 0x1e, 0xf8, 0xff, 0x3a, 0xfe, 0x00, 0x07, 0xcc, 0xff, 0x9c, 0x9e,
+  0xff, 0xba, 0x00, 0x00, 0xfd, 0xff, 0x01, 0xfa, 0xfa, 0xfd, 0xff, 0xfe, 0x00, 0x03, 0xa0, 0xff,
+  0xff, 0x96, 0xfb, 0x00, 0x03, 0x1a, 0xff, 0xff, 0x18, 0xfe, 0x00, 0xf7, 0xff, 0xfd, 0x00, 0x01,
+  0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff,
+  0xff, 0xd5, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-
+  0xfb, 0x00, 0xf3, 0xff, 0xfd, 0x00, 0xf3, 0xff, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x20, 0xb6, 0xf2, 0xff, 0xff, 0x00,  //..%@@@.
-  0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x00,  //.%@@@@.
-  0x00, 0xf4, 0xff, 0x40, 0x00, 0x00, 0x00,  //.@@+...
-  0x00, 0xbc, 0xff, 0x1e, 0x00, 0x00, 0x00,  //.%@....
-  0x00, 0x34, 0xf6, 0xae, 0x0c, 0x00, 0x00,  //..@%...
-  0x50, 0xf6, 0xa8, 0x8c, 0xea, 0x5e, 0x00,  //+@%%@+.
-  0xe4, 0xff, 0x0e, 0x00, 0xa4, 0xff, 0x78,  //@@..%@+
-  0xe4, 0xff, 0x28, 0x00, 0x1c, 0xff, 0xec,  //@@...@@
-  0x5c, 0xfc, 0xbe, 0x04, 0x1c, 0xff, 0xd4,  //+@%..@@
-  0x00, 0x38, 0xcc, 0xb0, 0xc8, 0xe0, 0x32,  //..@%@@.
-  0x00, 0x00, 0x00, 0x92, 0xf4, 0x2a, 0x00,  //...%@..
-  0x00, 0x00, 0x00, 0x16, 0xff, 0xc8, 0x00,  //....@@.
-  0x00, 0x00, 0x00, 0x46, 0xff, 0xf2, 0x00,  //...+@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00,  //.@@@@%.
-  0x00, 0xff, 0xff, 0xf4, 0xb6, 0x1c, 0x00,  //.@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xeb, 0x00, 0x07, 0x20, 0xb6, 0xf2, 0xff, 0xff, 0x00, 0x00, 0xbe, 0xfd, 0xff, 0x04, 0x00, 0x00,
+  0xf4, 0xff, 0x40, 0xfd, 0x00, 0x02, 0xbc, 0xff, 0x1e, 0xfd, 0x00, 0x28, 0x34, 0xf6, 0xae, 0x0c,
+  0x00, 0x00, 0x50, 0xf6, 0xa8, 0x8c, 0xea, 0x5e, 0x00, 0xe4, 0xff, 0x0e, 0x00, 0xa4, 0xff, 0x78,
+  0xe4, 0xff, 0x28, 0x00, 0x1c, 0xff, 0xec, 0x5c, 0xfc, 0xbe, 0x04, 0x1c, 0xff, 0xd4, 0x00, 0x38,
+  0xcc, 0xb0, 0xc8, 0xe0, 0x32, 0xfe, 0x00, 0x02, 0x92, 0xf4, 0x2a, 0xfd, 0x00, 0x02, 0x16, 0xff,
+  0xc8, 0xfd, 0x00, 0x04, 0x46, 0xff, 0xf2, 0x00, 0x00, 0xfd, 0xff, 0x07, 0xb4, 0x00, 0x00, 0xff,
+  0xff, 0xf4, 0xb6, 0x1c, 0xf2, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xf5, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff, 0xa1, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x20, 0x9a, 0xe2, 0xf8, 0xe2, 0x98, 0x20, 0x00, 0x00,  //...%@@@%...
-  0x00, 0x42, 0xe6, 0x7a, 0x20, 0x04, 0x20, 0x7a, 0xe6, 0x42, 0x00,  //.+@+...+@+.
-  0x1e, 0xe6, 0x36, 0x54, 0xca, 0xf2, 0xff, 0xff, 0x36, 0xe6, 0x1c,  //.@.+@@@@.@.
-  0x98, 0x7a, 0x68, 0xd6, 0x3c, 0x06, 0x00, 0x00, 0x00, 0x7e, 0x94,  //%++@.....+%
-  0xe2, 0x20, 0xda, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xe0,  //@.@.......@
-  0xf8, 0x04, 0xf6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf8,  //@.@.......@
-  0xe2, 0x20, 0xd2, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe2,  //@.@.......@
-  0x98, 0x7c, 0x60, 0xd4, 0x40, 0x08, 0x00, 0x00, 0x00, 0x7c, 0x98,  //%++@+....+%
-  0x1e, 0xe6, 0x3a, 0x5a, 0xcc, 0xf2, 0xff, 0xff, 0x3a, 0xe6, 0x1e,  //.@.+@@@@.@.
-  0x00, 0x40, 0xe8, 0x7c, 0x20, 0x04, 0x20, 0x7c, 0xe6, 0x40, 0x00,  //.+@+...+@+.
-  0x00, 0x00, 0x1e, 0x98, 0xe2, 0xf8, 0xe2, 0x98, 0x1e, 0x00, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd3, 0x00, 0x06, 0x20, 0x9a, 0xe2, 0xf8, 0xe2, 0x98, 0x20, 0xfe, 0x00, 0x1a, 0x42, 0xe6, 0x7a,
+  0x20, 0x04, 0x20, 0x7a, 0xe6, 0x42, 0x00, 0x1e, 0xe6, 0x36, 0x54, 0xca, 0xf2, 0xff, 0xff, 0x36,
+  0xe6, 0x1c, 0x98, 0x7a, 0x68, 0xd6, 0x3c, 0x06, 0xfe, 0x00, 0x05, 0x7e, 0x94, 0xe2, 0x20, 0xda,
+  0x38, 0xfc, 0x00, 0x05, 0x22, 0xe0, 0xf8, 0x04, 0xf6, 0x08, 0xfc, 0x00, 0x05, 0x04, 0xf8, 0xe2,
+  0x20, 0xd2, 0x36, 0xfc, 0x00, 0x07, 0x20, 0xe2, 0x98, 0x7c, 0x60, 0xd4, 0x40, 0x08, 0xfe, 0x00,
+  0x16, 0x7c, 0x98, 0x1e, 0xe6, 0x3a, 0x5a, 0xcc, 0xf2, 0xff, 0xff, 0x3a, 0xe6, 0x1e, 0x00, 0x40,
+  0xe8, 0x7c, 0x20, 0x04, 0x20, 0x7c, 0xe6, 0x40, 0xfe, 0x00, 0x06, 0x1e, 0x98, 0xe2, 0xf8, 0xe2,
+  0x98, 0x1e, 0xc8, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0xff, 0xff, 0xfc, 0xe6, 0xaa, 0x20, 0x00,  //.@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x60, 0xc4, 0x00,  //.....+@.
-  0x0e, 0x8e, 0xdc, 0xf6, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@.
-  0xae, 0x9a, 0x26, 0x06, 0x00, 0x0a, 0xff, 0x00,  //%%....@.
-  0xf0, 0x0e, 0x00, 0x00, 0x00, 0x52, 0xff, 0x00,  //@....+@.
-  0xc0, 0x86, 0x10, 0x12, 0x5c, 0xe8, 0xff, 0x00,  //@%..+@@.
-  0x1c, 0xac, 0xec, 0xf6, 0xc4, 0x44, 0xff, 0x00,  //.%@@@+@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e,  //%@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe8, 0x00, 0x05, 0xff, 0xff, 0xfc, 0xe6, 0xaa, 0x20, 0xfc, 0x00, 0x15, 0x10, 0x60, 0xc4, 0x00,
+  0x0e, 0x8e, 0xdc, 0xf6, 0xff, 0xff, 0xf8, 0x00, 0xae, 0x9a, 0x26, 0x06, 0x00, 0x0a, 0xff, 0x00,
+  0xf0, 0x0e, 0xfe, 0x00, 0x11, 0x52, 0xff, 0x00, 0xc0, 0x86, 0x10, 0x12, 0x5c, 0xe8, 0xff, 0x00,
+  0x1c, 0xac, 0xec, 0xf6, 0xc4, 0x44, 0xff, 0xf8, 0x00, 0x00, 0x9e, 0xfb, 0xff, 0x00, 0x0e, 0xc1,
+  0x00,
 
   /*Unicode: U+00ab («) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a,  //...%...%
-  0x00, 0x02, 0xa0, 0xf0, 0x00, 0x02, 0xa0, 0xee,  //..%@..%@
-  0x08, 0xb4, 0xe8, 0x30, 0x08, 0xb4, 0xe0, 0x2a,  //.%@..%@.
-  0xc4, 0xde, 0x24, 0x00, 0xc4, 0xce, 0x18, 0x00,  //@@..@@..
-  0xc4, 0xde, 0x24, 0x00, 0xc4, 0xce, 0x18, 0x00,  //@@..@@..
-  0x08, 0xb4, 0xe8, 0x2e, 0x08, 0xb4, 0xe0, 0x2a,  //.%@..%@.
-  0x00, 0x02, 0xa0, 0xf0, 0x00, 0x02, 0xa0, 0xee,  //..%@..%@
-  0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a,  //...%...%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xc6, 0x00, 0x00, 0x8a, 0xfe, 0x00, 0x30, 0x8a, 0x00, 0x02, 0xa0, 0xf0, 0x00, 0x02, 0xa0, 0xee,
+  0x08, 0xb4, 0xe8, 0x30, 0x08, 0xb4, 0xe0, 0x2a, 0xc4, 0xde, 0x24, 0x00, 0xc4, 0xce, 0x18, 0x00,
+  0xc4, 0xde, 0x24, 0x00, 0xc4, 0xce, 0x18, 0x00, 0x08, 0xb4, 0xe8, 0x2e, 0x08, 0xb4, 0xe0, 0x2a,
+  0x00, 0x02, 0xa0, 0xf0, 0x00, 0x02, 0xa0, 0xee, 0xfe, 0x00, 0x00, 0x8a, 0xfe, 0x00, 0x00, 0x8a,
+  0xd9, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //.......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xb9, 0x00, 0xef, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xcf, 0x00, 0xf7, 0xff, 0xd9, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x20, 0x9a, 0xe2, 0xf8, 0xe2, 0x98, 0x20, 0x00, 0x00,  //...%@@@%...
-  0x00, 0x42, 0xe6, 0x7a, 0x20, 0x04, 0x20, 0x7a, 0xe6, 0x42, 0x00,  //.+@+...+@+.
-  0x1e, 0xe6, 0x36, 0xff, 0xff, 0xf6, 0xd0, 0x48, 0x36, 0xe6, 0x1c,  //.@.@@@@+.@.
-  0x98, 0x7a, 0x00, 0xff, 0x00, 0x04, 0x46, 0xe4, 0x00, 0x7e, 0x94,  //%+.@..+@.+%
-  0xe2, 0x20, 0x00, 0xff, 0x00, 0x04, 0x48, 0xe4, 0x00, 0x22, 0xe0,  //@..@..+@..@
-  0xf8, 0x04, 0x00, 0xff, 0xec, 0xf8, 0xe8, 0x42, 0x00, 0x04, 0xf8,  //@..@@@@+..@
-  0xe2, 0x20, 0x00, 0xff, 0x00, 0x26, 0xee, 0x3c, 0x00, 0x20, 0xe2,  //@..@..@...@
-  0x98, 0x7c, 0x00, 0xff, 0x00, 0x00, 0x5c, 0xd6, 0x0a, 0x7c, 0x98,  //%+.@..+@.+%
-  0x1e, 0xe6, 0x3a, 0xff, 0x00, 0x00, 0x00, 0x9e, 0xdc, 0xe6, 0x1e,  //.@.@...%@@.
-  0x00, 0x40, 0xe8, 0x7c, 0x20, 0x04, 0x20, 0x7c, 0xe6, 0x40, 0x00,  //.+@+...+@+.
-  0x00, 0x00, 0x1e, 0x98, 0xe2, 0xf8, 0xe2, 0x98, 0x1e, 0x00, 0x00,  //...%@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd3, 0x00, 0x06, 0x20, 0x9a, 0xe2, 0xf8, 0xe2, 0x98, 0x20, 0xfe, 0x00, 0x4f, 0x42, 0xe6, 0x7a,
+  0x20, 0x04, 0x20, 0x7a, 0xe6, 0x42, 0x00, 0x1e, 0xe6, 0x36, 0xff, 0xff, 0xf6, 0xd0, 0x48, 0x36,
+  0xe6, 0x1c, 0x98, 0x7a, 0x00, 0xff, 0x00, 0x04, 0x46, 0xe4, 0x00, 0x7e, 0x94, 0xe2, 0x20, 0x00,
+  0xff, 0x00, 0x04, 0x48, 0xe4, 0x00, 0x22, 0xe0, 0xf8, 0x04, 0x00, 0xff, 0xec, 0xf8, 0xe8, 0x42,
+  0x00, 0x04, 0xf8, 0xe2, 0x20, 0x00, 0xff, 0x00, 0x26, 0xee, 0x3c, 0x00, 0x20, 0xe2, 0x98, 0x7c,
+  0x00, 0xff, 0x00, 0x00, 0x5c, 0xd6, 0x0a, 0x7c, 0x98, 0x1e, 0xe6, 0x3a, 0xff, 0xfe, 0x00, 0x0d,
+  0x9e, 0xdc, 0xe6, 0x1e, 0x00, 0x40, 0xe8, 0x7c, 0x20, 0x04, 0x20, 0x7c, 0xe6, 0x40, 0xfe, 0x00,
+  0x06, 0x1e, 0x98, 0xe2, 0xf8, 0xe2, 0x98, 0x1e, 0xc8, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0xf7, 0xff, 0xb6, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x06, 0x8a, 0xe6, 0xe4, 0x84, 0x04,  //.%@@%.
-  0x8a, 0xb4, 0x1a, 0x1a, 0xb6, 0x84,  //%%..%%
-  0xe6, 0x1a, 0x00, 0x00, 0x1c, 0xe4,  //@....@
-  0xe8, 0x16, 0x00, 0x00, 0x1a, 0xe6,  //@....@
-  0x92, 0xac, 0x16, 0x1a, 0xb4, 0x8c,  //%%..%%
-  0x08, 0x92, 0xe8, 0xe6, 0x8a, 0x06,  //.%@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xef, 0x00, 0x23, 0x06, 0x8a, 0xe6, 0xe4, 0x84, 0x04, 0x8a, 0xb4, 0x1a, 0x1a, 0xb6, 0x84, 0xe6,
+  0x1a, 0x00, 0x00, 0x1c, 0xe4, 0xe8, 0x16, 0x00, 0x00, 0x1a, 0xe6, 0x92, 0xac, 0x16, 0x1a, 0xb4,
+  0x8c, 0x08, 0x92, 0xe8, 0xe6, 0x8a, 0x06, 0xbf, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xc1, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xfd,
+  0x00, 0xed, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01,
+  0xff, 0xff, 0xfd, 0x00, 0xed, 0xff, 0xd9, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x5c, 0xdc, 0xf2, 0xc2, 0x30,  //+@@@.
-  0xa6, 0x24, 0x08, 0x68, 0xda,  //%..+@
-  0x00, 0x00, 0x00, 0x1c, 0xea,  //....@
-  0x00, 0x00, 0x0a, 0xbe, 0x78,  //...%+
-  0x00, 0x1a, 0xca, 0xa0, 0x00,  //..@%.
-  0x40, 0xe4, 0x74, 0x00, 0x00,  //+@+..
-  0xfa, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0x09, 0x5c, 0xdc, 0xf2, 0xc2, 0x30, 0xa6, 0x24, 0x08, 0x68, 0xda, 0xfe, 0x00, 0x11,
+  0x1c, 0xea, 0x00, 0x00, 0x0a, 0xbe, 0x78, 0x00, 0x1a, 0xca, 0xa0, 0x00, 0x40, 0xe4, 0x74, 0x00,
+  0x00, 0xfa, 0xfd, 0xff, 0xcf, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xf6, 0xd6, 0x68,  //@@@@+
-  0x00, 0x00, 0x08, 0x5a, 0xea,  //...+@
-  0x00, 0xff, 0xff, 0xf8, 0x4c,  //.@@@+
-  0x00, 0x00, 0x14, 0x86, 0xc8,  //...%@
-  0x00, 0x00, 0x00, 0x0e, 0xf4,  //....@
-  0x00, 0x00, 0x18, 0x90, 0xc0,  //...%@
-  0xff, 0xff, 0xee, 0xb2, 0x20,  //@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0x13, 0xff, 0xff, 0xf6, 0xd6, 0x68, 0x00, 0x00, 0x08, 0x5a, 0xea, 0x00, 0xff, 0xff,
+  0xf8, 0x4c, 0x00, 0x00, 0x14, 0x86, 0xc8, 0xfe, 0x00, 0x0b, 0x0e, 0xf4, 0x00, 0x00, 0x18, 0x90,
+  0xc0, 0xff, 0xff, 0xee, 0xb2, 0x20, 0xcf, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 4 */
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x1e, 0xea, 0x8a,  //..@%
-  0x06, 0xca, 0xa0, 0x00,  //.@%.
-  0x9a, 0xb6, 0x02, 0x00,  //%%..
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-  0x00, 0x00, 0x00, 0x00,  //....
-
+  0xf8, 0x00, 0x09, 0x1e, 0xea, 0x8a, 0x06, 0xca, 0xa0, 0x00, 0x9a, 0xb6, 0x02, 0xc4, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xff, 0xff, 0xb6, 0x24, 0x08, 0x34, 0xce, 0xff, 0xff, 0x16,  //@@%...@@@.
-  0xff, 0xd8, 0xe0, 0xff, 0xff, 0xff, 0xec, 0xb0, 0xff, 0xff,  //@@@@@@@%@@
-  0xff, 0xce, 0x2c, 0xc8, 0xf6, 0xcc, 0x34, 0x36, 0xec, 0xb8,  //@@.@@@..@%
-  0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-  0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........
-
+  0xc5, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x04,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x04,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x06,
+  0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1e, 0xfe, 0x00, 0x10, 0x32, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xb6, 0x24, 0x08, 0x34, 0xce, 0xff, 0xff, 0x16, 0xff, 0xd8, 0xe0, 0xfe, 0xff, 0x01, 0xec, 0xb0,
+  0xfe, 0xff, 0x0a, 0xce, 0x2c, 0xc8, 0xf6, 0xcc, 0x34, 0x36, 0xec, 0xb8, 0xff, 0xce, 0xf9, 0x00,
+  0x01, 0xff, 0xce, 0xf9, 0x00, 0x01, 0xff, 0xce, 0xf9, 0x00, 0x01, 0xff, 0xce, 0xf9, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x16, 0x80, 0xcc, 0xea, 0xff, 0xff, 0xff, 0xff,  //..%@@@@@@
-  0x38, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //.@@@@@..@
-  0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //@@@@@@..@
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //@@@@@@..@
-  0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //@@@@@@..@
-  0x3a, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,  //.@@@@@..@
-  0x00, 0x1a, 0x86, 0xcc, 0xf2, 0xff, 0x00, 0x00, 0xff,  //..%@@@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,  //.....@..@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe5, 0x00, 0x03, 0x16, 0x80, 0xcc, 0xea, 0xfd, 0xff, 0x01, 0x38, 0xf0, 0xfd, 0xff, 0x03, 0x00,
+  0x00, 0xff, 0xcc, 0xfc, 0xff, 0x03, 0x00, 0x00, 0xff, 0xf8, 0xfc, 0xff, 0x03, 0x00, 0x00, 0xff,
+  0xce, 0xfc, 0xff, 0x04, 0x00, 0x00, 0xff, 0x3a, 0xf0, 0xfd, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x00,
+  0x1a, 0x86, 0xcc, 0xf2, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfc,
+  0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03,
+  0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00,
+  0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0xff,
+  0xef, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf1, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x82, 0x8c,  //.%%
-  0x00, 0x28, 0xf2,  //..@
-  0xe8, 0xf6, 0x96,  //@@%
-  0x00, 0x00, 0x00,  //...
-
+  0xd0, 0x00, 0x07, 0x82, 0x8c, 0x00, 0x28, 0xf2, 0xe8, 0xf6, 0x96, 0xfe, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0xff, 0xff, 0xff, 0x00, 0x00,  //@@@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0x00, 0x00, 0xff, 0x00, 0x00,  //..@..
-  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0xf2, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x02, 0xff, 0x00, 0x00, 0xfc, 0xff, 0xcf, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x64, 0xd2, 0xf4, 0xd2, 0x64, 0x00,  //.+@@@+.
-  0x64, 0xce, 0x34, 0x08, 0x34, 0xd2, 0x64,  //+@...@+
-  0xd4, 0x32, 0x00, 0x00, 0x00, 0x34, 0xd2,  //@.....@
-  0xf4, 0x08, 0x00, 0x00, 0x00, 0x08, 0xf4,  //@.....@
-  0xd4, 0x32, 0x00, 0x00, 0x00, 0x34, 0xd4,  //@.....@
-  0x68, 0xcc, 0x32, 0x08, 0x34, 0xce, 0x64,  //+@...@+
-  0x00, 0x68, 0xd4, 0xf4, 0xd4, 0x66, 0x00,  //.+@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xeb, 0x00, 0x0e, 0x64, 0xd2, 0xf4, 0xd2, 0x64, 0x00, 0x64, 0xce, 0x34, 0x08, 0x34, 0xd2, 0x64,
+  0xd4, 0x32, 0xfe, 0x00, 0x03, 0x34, 0xd2, 0xf4, 0x08, 0xfe, 0x00, 0x03, 0x08, 0xf4, 0xd4, 0x32,
+  0xfe, 0x00, 0x0e, 0x34, 0xd4, 0x68, 0xcc, 0x32, 0x08, 0x34, 0xce, 0x64, 0x00, 0x68, 0xd4, 0xf4,
+  0xd4, 0x66, 0xf9, 0x00, 0x00, 0xca, 0xfc, 0xff, 0x00, 0xc2, 0xc9, 0x00,
 
   /*Unicode: U+00bb (») , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,  //%...%...
-  0xee, 0x9e, 0x02, 0x00, 0xf0, 0x9e, 0x02, 0x00,  //@%..@%..
-  0x2a, 0xe0, 0xb2, 0x08, 0x30, 0xe8, 0xb2, 0x08,  //.@%..@%.
-  0x00, 0x18, 0xce, 0xc4, 0x00, 0x24, 0xde, 0xc4,  //..@@..@@
-  0x00, 0x18, 0xce, 0xc4, 0x00, 0x24, 0xde, 0xc4,  //..@@..@@
-  0x2a, 0xe0, 0xb2, 0x08, 0x30, 0xe8, 0xb2, 0x08,  //.@%..@%.
-  0xee, 0xa0, 0x02, 0x00, 0xf0, 0xa0, 0x02, 0x00,  //@%..@%..
-  0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,  //%...%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xc9, 0x00, 0x00, 0x8a, 0xfe, 0x00, 0x00, 0x8a, 0xfe, 0x00, 0x30, 0xee, 0x9e, 0x02, 0x00, 0xf0,
+  0x9e, 0x02, 0x00, 0x2a, 0xe0, 0xb2, 0x08, 0x30, 0xe8, 0xb2, 0x08, 0x00, 0x18, 0xce, 0xc4, 0x00,
+  0x24, 0xde, 0xc4, 0x00, 0x18, 0xce, 0xc4, 0x00, 0x24, 0xde, 0xc4, 0x2a, 0xe0, 0xb2, 0x08, 0x30,
+  0xe8, 0xb2, 0x08, 0xee, 0xa0, 0x02, 0x00, 0xf0, 0xa0, 0x02, 0x00, 0x8a, 0xfe, 0x00, 0x00, 0x8a,
+  0xd6, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x88, 0xbc, 0xd0,  //.@@@@@+%%@
-  0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18,  //.+%%@@%%+.
-  0xd2, 0xbc, 0x88, 0x54, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xde, 0xff, 0x00,  //.......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0x76, 0xff, 0x00,  //......@+@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x8a, 0x00, 0xff, 0x00,  //.....%%.@.
-  0x00, 0x00, 0x00, 0x00, 0x84, 0x9e, 0x00, 0x00, 0xff, 0x00,  //....%%..@.
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xec, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff,
+  0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfa, 0x00, 0xfc, 0xff, 0x12, 0x54, 0x88, 0xbc,
+  0xd0, 0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18, 0xd2, 0xbc, 0x88, 0x54, 0x1e,
+  0xf6, 0x00, 0x02, 0x16, 0xde, 0xff, 0xfb, 0x00, 0x03, 0x08, 0xc8, 0x76, 0xff, 0xfb, 0x00, 0x03,
+  0xa8, 0x8a, 0x00, 0xff, 0xfc, 0x00, 0x04, 0x84, 0x9e, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfb, 0xff,
+  0xf9, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xec, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x88, 0xbc, 0xd0,  //.@@@@@+%%@
-  0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18,  //.+%%@@%%+.
-  0xd2, 0xbc, 0x88, 0x54, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xdc, 0xf2, 0xc2, 0x30,  //.....+@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x24, 0x08, 0x68, 0xda,  //.....%..+@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xea,  //.........@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbe, 0x78,  //........%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xca, 0xa0, 0x00,  //.......@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe4, 0x74, 0x00, 0x00,  //.....+@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xec, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff,
+  0xf8, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfa, 0x00, 0xfc, 0xff, 0x12, 0x54, 0x88, 0xbc,
+  0xd0, 0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18, 0xd2, 0xbc, 0x88, 0x54, 0x1e,
+  0xf7, 0x00, 0x04, 0x5c, 0xdc, 0xf2, 0xc2, 0x30, 0xfc, 0x00, 0x04, 0xa6, 0x24, 0x08, 0x68, 0xda,
+  0xf9, 0x00, 0x01, 0x1c, 0xea, 0xfa, 0x00, 0x02, 0x0a, 0xbe, 0x78, 0xfb, 0x00, 0x02, 0x1a, 0xca,
+  0xa0, 0xfb, 0x00, 0x02, 0x40, 0xe4, 0x74, 0xfa, 0x00, 0x00, 0xfa, 0xfd, 0xff, 0xed, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0xff, 0xff, 0xf6, 0xd6, 0x68, 0x00, 0x00, 0x00, 0x00,  //.@@@@+....
-  0x00, 0x00, 0x00, 0x08, 0x5a, 0xea, 0x00, 0x00, 0x00, 0x00,  //....+@....
-  0x00, 0x00, 0xff, 0xff, 0xf8, 0x4c, 0x00, 0x00, 0x00, 0x00,  //..@@@+....
-  0x00, 0x00, 0x00, 0x14, 0x86, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....%@....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf4, 0x00, 0x00, 0x00, 0x00,  //.....@....
-  0x00, 0x00, 0x00, 0x18, 0x90, 0xc0, 0x00, 0x00, 0x00, 0x00,  //....%@....
-  0x00, 0xff, 0xff, 0xee, 0xb2, 0x40, 0x54, 0x88, 0xbc, 0xd0,  //.@@@%++%%@
-  0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18,  //.+%%@@%%+.
-  0xd2, 0xbc, 0x88, 0x54, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xde, 0xff, 0x00,  //.......@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0x76, 0xff, 0x00,  //......@+@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x8a, 0x00, 0xff, 0x00,  //.....%%.@.
-  0x00, 0x00, 0x00, 0x00, 0x84, 0x9e, 0x00, 0x00, 0xff, 0x00,  //....%%..@.
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //....@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //........@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xec, 0x00, 0x04, 0xff, 0xff, 0xf6, 0xd6, 0x68, 0xfa, 0x00, 0x02, 0x08, 0x5a, 0xea, 0xfb, 0x00,
+  0x03, 0xff, 0xff, 0xf8, 0x4c, 0xfa, 0x00, 0x02, 0x14, 0x86, 0xc8, 0xf9, 0x00, 0x01, 0x0e, 0xf4,
+  0xfa, 0x00, 0x02, 0x18, 0x90, 0xc0, 0xfc, 0x00, 0x17, 0xff, 0xff, 0xee, 0xb2, 0x40, 0x54, 0x88,
+  0xbc, 0xd0, 0x18, 0x4c, 0x82, 0xb6, 0xea, 0xea, 0xb6, 0x82, 0x4e, 0x18, 0xd2, 0xbc, 0x88, 0x54,
+  0x1e, 0xf6, 0x00, 0x02, 0x16, 0xde, 0xff, 0xfb, 0x00, 0x03, 0x08, 0xc8, 0x76, 0xff, 0xfb, 0x00,
+  0x03, 0xa8, 0x8a, 0x00, 0xff, 0xfc, 0x00, 0x04, 0x84, 0x9e, 0x00, 0x00, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xf9, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xec, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //...@@..
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00,  //...@@..
-  0x00, 0x00, 0x04, 0xff, 0xfa, 0x00, 0x00,  //...@@..
-  0x00, 0x00, 0x38, 0xff, 0xde, 0x00, 0x00,  //...@@..
-  0x00, 0x14, 0xd6, 0xff, 0x88, 0x00, 0x00,  //..@@%..
-  0x12, 0xd0, 0xff, 0xcc, 0x0a, 0x00, 0x00,  //.@@@...
-  0xa6, 0xff, 0xd4, 0x14, 0x00, 0x00, 0x00,  //%@@....
-  0xf4, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00,  //@@.....
-  0xdc, 0xff, 0x3c, 0x00, 0x0c, 0x4a, 0xba,  //@@...+%
-  0x76, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,  //+@@@@@@
-  0x00, 0x6e, 0xd4, 0xf6, 0xe8, 0xac, 0x40,  //.+@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xe9, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xfa, 0xff, 0xfd,
+  0x00, 0x02, 0x04, 0xff, 0xfa, 0xfd, 0x00, 0x02, 0x38, 0xff, 0xde, 0xfe, 0x00, 0x10, 0x14, 0xd6,
+  0xff, 0x88, 0x00, 0x00, 0x12, 0xd0, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0xa6, 0xff, 0xd4, 0x14, 0xfe,
+  0x00, 0x02, 0xf4, 0xff, 0x28, 0xfd, 0x00, 0x0a, 0xdc, 0xff, 0x3c, 0x00, 0x0c, 0x4a, 0xba, 0x76,
+  0xff, 0xff, 0xf8, 0xfe, 0xff, 0x06, 0x00, 0x6e, 0xd4, 0xf6, 0xe8, 0xac, 0x40, 0xe5, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 9 */
-  0x00, 0x00, 0x8c, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0x00, 0x8c, 0xcc, 0x06, 0xfa, 0x00, 0x01, 0xa6, 0x9c, 0xf1, 0x00, 0x02, 0x96, 0xff,
+  0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22, 0xfe, 0xff, 0x00, 0x20, 0xfd,
+  0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae, 0xff, 0xc6, 0xff, 0xac, 0xfe,
+  0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8,
+  0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00, 0x00, 0xc4, 0xfc, 0xff,
+  0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50, 0xff, 0xc0, 0xfe, 0x00, 0x05,
+  0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff, 0x96, 0xdc, 0xff, 0x34, 0xfe,
+  0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 9 */
-  0x00, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0x06, 0xcc, 0x8c, 0xfb, 0x00, 0x01, 0x9c, 0xa4, 0xf1, 0x00, 0x02, 0x96, 0xff,
+  0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22, 0xfe, 0xff, 0x00, 0x20, 0xfd,
+  0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae, 0xff, 0xc6, 0xff, 0xac, 0xfe,
+  0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8,
+  0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00, 0x00, 0xc4, 0xfc, 0xff,
+  0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50, 0xff, 0xc0, 0xfe, 0x00, 0x05,
+  0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff, 0x96, 0xdc, 0xff, 0x34, 0xfe,
+  0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 9 */
-  0x00, 0x00, 0x00, 0xae, 0xe0, 0xae, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0x00, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0xae, 0xe0, 0xae, 0xfc, 0x00, 0x04, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0xf3, 0x00,
+  0x02, 0x96, 0xff, 0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22, 0xfe, 0xff,
+  0x00, 0x20, 0xfd, 0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae, 0xff, 0xc6,
+  0xff, 0xac, 0xfe, 0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00, 0x38, 0xff,
+  0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00, 0x00,
+  0xc4, 0xfc, 0xff, 0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50, 0xff, 0xc0,
+  0xfe, 0x00, 0x05, 0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff, 0x96, 0xdc,
+  0xff, 0x34, 0xfe, 0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 9 */
-  0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0x00, 0x00,  //..+@%.@..
-  0x00, 0x00, 0xda, 0x16, 0x94, 0xf2, 0x76, 0x00, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0xfd, 0x00, 0x04, 0xda, 0x16, 0x94, 0xf2, 0x76,
+  0xf3, 0x00, 0x02, 0x96, 0xff, 0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22,
+  0xfe, 0xff, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae,
+  0xff, 0xc6, 0xff, 0xac, 0xfe, 0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00,
+  0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e,
+  0x00, 0x00, 0xc4, 0xfc, 0xff, 0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50,
+  0xff, 0xc0, 0xfe, 0x00, 0x05, 0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff,
+  0x96, 0xdc, 0xff, 0x34, 0xfe, 0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 9 */
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x96, 0xff, 0x94, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xdc, 0xff, 0xda, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0x66, 0x00, 0x00,  //..+@@@+..
-  0x00, 0x00, 0xae, 0xff, 0xc6, 0xff, 0xac, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00,  //..@@.@@..
-  0x00, 0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00,  //..@@.@@..
-  0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e, 0x00,  //.+@%.%@+.
-  0x00, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x00,  //.@@@@@@@.
-  0x0e, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0e,  //.@@@@@@@.
-  0x50, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x50,  //+@@...@@+
-  0x96, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x96,  //%@+...+@%
-  0xdc, 0xff, 0x34, 0x00, 0x00, 0x00, 0x36, 0xff, 0xdc,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xf3, 0x00, 0x02, 0x96, 0xff, 0x94, 0xfb, 0x00, 0x02, 0xdc, 0xff, 0xda, 0xfc, 0x00, 0x00, 0x22,
+  0xfe, 0xff, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x68, 0xfe, 0xff, 0x00, 0x66, 0xfd, 0x00, 0x04, 0xae,
+  0xff, 0xc6, 0xff, 0xac, 0xfe, 0x00, 0x1b, 0x02, 0xee, 0xff, 0x3c, 0xff, 0xee, 0x02, 0x00, 0x00,
+  0x38, 0xff, 0xd6, 0x00, 0xd8, 0xff, 0x38, 0x00, 0x00, 0x7e, 0xff, 0x90, 0x00, 0x92, 0xff, 0x7e,
+  0x00, 0x00, 0xc4, 0xfc, 0xff, 0x03, 0xc4, 0x00, 0x0e, 0xfa, 0xfc, 0xff, 0x04, 0xfa, 0x0e, 0x50,
+  0xff, 0xc0, 0xfe, 0x00, 0x05, 0xc0, 0xff, 0x50, 0x96, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7a, 0xff,
+  0x96, 0xdc, 0xff, 0x34, 0xfe, 0x00, 0x02, 0x36, 0xff, 0xdc, 0xdd, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 9 */
-  0x00, 0x00, 0x00, 0xd4, 0x5a, 0xd4, 0x00, 0x00, 0x00,  //...@+@...
-  0x00, 0x00, 0x00, 0xf8, 0x10, 0xf6, 0x00, 0x00, 0x00,  //...@.@...
-  0x00, 0x00, 0x00, 0xd0, 0x5a, 0xce, 0x00, 0x00, 0x00,  //...@+@...
-  0x00, 0x00, 0x00, 0x32, 0xff, 0x32, 0x00, 0x00, 0x00,  //....@....
-  0x00, 0x00, 0x00, 0x44, 0xff, 0x44, 0x00, 0x00, 0x00,  //...+@+...
-  0x00, 0x00, 0x00, 0x98, 0xff, 0x96, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xe8, 0xff, 0xe6, 0x00, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x90, 0xff, 0xf0, 0xff, 0x90, 0x00, 0x00,  //..%@@@%..
-  0x00, 0x00, 0xe2, 0xff, 0x6a, 0xff, 0xe2, 0x00, 0x00,  //..@@+@@..
-  0x00, 0x36, 0xff, 0xe2, 0x00, 0xe2, 0xff, 0x36, 0x00,  //..@@.@@..
-  0x00, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x00,  //.%@@@@@%.
-  0x00, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x00,  //.@@@@@@@.
-  0x30, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xe6, 0xff, 0x2e,  //.@@...@@.
-  0x82, 0xff, 0x94, 0x00, 0x00, 0x00, 0x94, 0xff, 0x82,  //%@%...%@%
-  0xd6, 0xff, 0x40, 0x00, 0x00, 0x00, 0x40, 0xff, 0xd4,  //@@+...+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0xd4, 0x5a, 0xd4, 0xfb, 0x00, 0x02, 0xf8, 0x10, 0xf6, 0xfb, 0x00, 0x02, 0xd0,
+  0x5a, 0xce, 0xfb, 0x00, 0x02, 0x32, 0xff, 0x32, 0xfb, 0x00, 0x02, 0x44, 0xff, 0x44, 0xfb, 0x00,
+  0x02, 0x98, 0xff, 0x96, 0xfb, 0x00, 0x02, 0xe8, 0xff, 0xe6, 0xfc, 0x00, 0x00, 0x3e, 0xfe, 0xff,
+  0x00, 0x3c, 0xfd, 0x00, 0x04, 0x90, 0xff, 0xf0, 0xff, 0x90, 0xfd, 0x00, 0x04, 0xe2, 0xff, 0x6a,
+  0xff, 0xe2, 0xfe, 0x00, 0x09, 0x36, 0xff, 0xe2, 0x00, 0xe2, 0xff, 0x36, 0x00, 0x00, 0x8a, 0xfc,
+  0xff, 0x03, 0x88, 0x00, 0x00, 0xdc, 0xfc, 0xff, 0x04, 0xdc, 0x00, 0x30, 0xff, 0xe6, 0xfe, 0x00,
+  0x05, 0xe6, 0xff, 0x2e, 0x82, 0xff, 0x94, 0xfe, 0x00, 0x05, 0x94, 0xff, 0x82, 0xd6, 0xff, 0x40,
+  0xfe, 0x00, 0x02, 0x40, 0xff, 0xd4, 0xdd, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...+@@@@@@@
-  0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...%@@@@@@@
-  0x00, 0x00, 0x00, 0xe0, 0xff, 0x34, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@.@@...
-  0x00, 0x00, 0x2c, 0xff, 0xe6, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@.@@...
-  0x00, 0x00, 0x78, 0xff, 0x9a, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //..+@%.@@...
-  0x00, 0x00, 0xc4, 0xff, 0x4e, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@+.@@@@@
-  0x00, 0x12, 0xfc, 0xf6, 0x08, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //..@@..@@@@@
-  0x00, 0x5c, 0xff, 0xb4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+@%..@@...
-  0x00, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.%@@@@@@...
-  0x04, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@...
-  0x40, 0xff, 0xd4, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //+@@...@@...
-  0x8c, 0xff, 0x88, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@%...@@@@@
-  0xd8, 0xff, 0x3c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@....@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xdd, 0x00, 0x00, 0x48, 0xfa, 0xff, 0xfe, 0x00, 0x00, 0x94, 0xfa, 0xff, 0xfe, 0x00, 0x04, 0xe0,
+  0xff, 0x34, 0xff, 0xff, 0xfc, 0x00, 0x05, 0x2c, 0xff, 0xe6, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x05,
+  0x78, 0xff, 0x9a, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xc4, 0xff, 0x4e, 0x00, 0xfc, 0xff, 0x05,
+  0x00, 0x12, 0xfc, 0xf6, 0x08, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x5c, 0xff, 0xb4, 0x00, 0x00, 0xff,
+  0xff, 0xfd, 0x00, 0x00, 0xa8, 0xfb, 0xff, 0xfe, 0x00, 0x01, 0x04, 0xee, 0xfb, 0xff, 0xfe, 0x00,
+  0x02, 0x40, 0xff, 0xd4, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x02, 0x8c, 0xff, 0x88, 0xfe,
+  0x00, 0xfc, 0xff, 0x02, 0xd8, 0xff, 0x3c, 0xfe, 0x00, 0xfc, 0xff, 0xd5, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x1e, 0x94, 0xda, 0xf6, 0xee, 0xb6, 0x48,  //...%@@@%+
-  0x00, 0x40, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@
-  0x14, 0xea, 0xff, 0xa6, 0x2e, 0x06, 0x10, 0x4e, 0xc2,  //.@@%...+@
-  0x7c, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@%......
-  0xc6, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0xee, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xfa, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xee, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xc8, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+......
-  0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@%......
-  0x16, 0xee, 0xff, 0xa4, 0x2c, 0x04, 0x0e, 0x48, 0xc0,  //.@@%...+@
-  0x00, 0x46, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@
-  0x00, 0x00, 0x22, 0x98, 0xdc, 0xf8, 0xf0, 0xb8, 0x48,  //...%@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x8c, 0x00, 0x00,  //.....%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf2, 0x00, 0x00,  //......@..
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0xf6, 0x96, 0x00, 0x00,  //....@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe4, 0x00, 0x09, 0x1e, 0x94, 0xda, 0xf6, 0xee, 0xb6, 0x48, 0x00, 0x40, 0xf0, 0xfb, 0xff, 0x0b,
+  0x14, 0xea, 0xff, 0xa6, 0x2e, 0x06, 0x10, 0x4e, 0xc2, 0x7c, 0xff, 0xb2, 0xfb, 0x00, 0x02, 0xc6,
+  0xff, 0x42, 0xfb, 0x00, 0x02, 0xee, 0xff, 0x10, 0xfb, 0x00, 0x02, 0xfa, 0xff, 0x02, 0xfb, 0x00,
+  0x02, 0xee, 0xff, 0x10, 0xfb, 0x00, 0x02, 0xc8, 0xff, 0x42, 0xfb, 0x00, 0x02, 0x80, 0xff, 0xb0,
+  0xfb, 0x00, 0x0b, 0x16, 0xee, 0xff, 0xa4, 0x2c, 0x04, 0x0e, 0x48, 0xc0, 0x00, 0x46, 0xf4, 0xfb,
+  0xff, 0x08, 0x00, 0x00, 0x22, 0x98, 0xdc, 0xf8, 0xf0, 0xb8, 0x48, 0xfc, 0x00, 0x01, 0x82, 0x8c,
+  0xfa, 0x00, 0x01, 0x28, 0xf2, 0xfb, 0x00, 0x02, 0xe8, 0xf6, 0x96, 0xf6, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 9 */
-  0x00, 0x00, 0x8c, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0x00, 0x8c, 0xcc, 0x06, 0xfa, 0x00, 0x01, 0xa6, 0x9c, 0xf4, 0x00, 0xed, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xef, 0xff,
+  0xdd, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 9 */
-  0x00, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0x06, 0xcc, 0x8c, 0xfb, 0x00, 0x01, 0x9c, 0xa4, 0xf4, 0x00, 0xed, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xef, 0xff,
+  0xdd, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 9 */
-  0x00, 0x00, 0x00, 0xae, 0xe0, 0xae, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0x00, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0xae, 0xe0, 0xae, 0xfc, 0x00, 0x04, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0xf6, 0x00,
+  0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xed, 0xff,
+  0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0xef, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 9 */
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x07, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0xf7, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff,
+  0xfa, 0x00, 0xed, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00,
+  0x01, 0xff, 0xff, 0xfa, 0x00, 0xef, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 8 */
-  0x00, 0x8c, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00,  //.%@.....
-  0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x03, 0x00, 0x8c, 0xcc, 0x06, 0xfb, 0x00, 0x01, 0xa6, 0x9c, 0xf5, 0x00, 0xf1, 0xff, 0xfe, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1,
+  0x00,
 
   /*Unicode: U+00cd (Í) , Width: 8 */
-  0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00,  //...@%...
-  0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x04, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0xfc, 0x00, 0x01, 0x9c, 0xa4, 0xf5, 0x00, 0xf1, 0xff, 0xfe,
+  0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff,
+  0xe1, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 8 */
-  0x00, 0x00, 0x38, 0xe6, 0xe6, 0x38, 0x00, 0x00,  //...@@...
-  0x00, 0x22, 0xda, 0x34, 0x34, 0xda, 0x22, 0x00,  //..@..@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x05, 0x00, 0x00, 0x38, 0xe6, 0xe6, 0x38, 0xfe, 0x00, 0x05, 0x22, 0xda, 0x34, 0x34, 0xda, 0x22,
+  0xf8, 0x00, 0xf1, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 8 */
-  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x0e, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+  0xf8, 0x00, 0xf1, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff,
+  0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0xff, 0xff, 0xff, 0xf0, 0xd2, 0x92, 0x24, 0x00, 0x00,  //.@@@@@%...
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x54, 0x00,  //.@@@@@@@+.
-  0x00, 0xff, 0xff, 0x00, 0x0a, 0x32, 0x98, 0xff, 0xf4, 0x20,  //.@@...%@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x8c,  //.@@....%@%
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xcc,  //.@@.....@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0e, 0xff, 0xee,  //@@@@@...@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0xff, 0xfa,  //@@@@@...@@
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xee,  //.@@.....@@
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xce,  //.@@.....@@
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x8c,  //.@@....%@%
-  0x00, 0xff, 0xff, 0x00, 0x08, 0x30, 0x96, 0xff, 0xf6, 0x22,  //.@@...%@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x58, 0x00,  //.@@@@@@@+.
-  0x00, 0xff, 0xff, 0xff, 0xf2, 0xd4, 0x94, 0x26, 0x00, 0x00,  //.@@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe2, 0x00, 0xfe, 0xff, 0x03, 0xf0, 0xd2, 0x92, 0x24, 0xfe, 0x00, 0xfb, 0xff, 0x0f, 0xf6, 0x54,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x32, 0x98, 0xff, 0xf4, 0x20, 0x00, 0xff, 0xff, 0xfd, 0x00,
+  0x05, 0x9a, 0xff, 0x8c, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x02, 0x36, 0xff, 0xcc, 0xfc, 0xff, 0x04,
+  0x00, 0x00, 0x0e, 0xff, 0xee, 0xfc, 0xff, 0x07, 0x00, 0x00, 0x02, 0xff, 0xfa, 0x00, 0xff, 0xff,
+  0xfd, 0x00, 0x05, 0x0e, 0xff, 0xee, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x05, 0x36, 0xff, 0xce, 0x00,
+  0xff, 0xff, 0xfd, 0x00, 0x0d, 0x9a, 0xff, 0x8c, 0x00, 0xff, 0xff, 0x00, 0x08, 0x30, 0x96, 0xff,
+  0xf6, 0x22, 0x00, 0xfb, 0xff, 0x03, 0xf8, 0x58, 0x00, 0x00, 0xfe, 0xff, 0x03, 0xf2, 0xd4, 0x94,
+  0x26, 0xd7, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 9 */
-  0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0x00, 0x00,  //..+@%.@..
-  0x00, 0x00, 0xda, 0x16, 0x94, 0xf2, 0x76, 0x00, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@....@@
-  0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@....@@
-  0xff, 0xff, 0xe4, 0x94, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@@%...@@
-  0xff, 0xff, 0x7e, 0xf0, 0x0c, 0x00, 0x00, 0xff, 0xff,  //@@+@...@@
-  0xff, 0xff, 0x18, 0xfa, 0x6a, 0x00, 0x00, 0xff, 0xff,  //@@.@+..@@
-  0xff, 0xff, 0x00, 0xaa, 0xd2, 0x00, 0x00, 0xff, 0xff,  //@@.%@..@@
-  0xff, 0xff, 0x00, 0x40, 0xff, 0x3e, 0x00, 0xff, 0xff,  //@@.+@..@@
-  0xff, 0xff, 0x00, 0x00, 0xd4, 0xa8, 0x00, 0xff, 0xff,  //@@..@%.@@
-  0xff, 0xff, 0x00, 0x00, 0x6a, 0xfa, 0x18, 0xff, 0xff,  //@@..+@.@@
-  0xff, 0xff, 0x00, 0x00, 0x0c, 0xf2, 0x7e, 0xff, 0xff,  //@@...@+@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x96, 0xe4, 0xff, 0xff,  //@@...%@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff,  //@@....@@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff,  //@@....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0xfd, 0x00, 0x04, 0xda, 0x16, 0x94, 0xf2, 0x76,
+  0xf6, 0x00, 0x02, 0xff, 0xff, 0xc0, 0xfd, 0x00, 0xfc, 0xff, 0x00, 0x2a, 0xfe, 0x00, 0xfd, 0xff,
+  0x01, 0xe4, 0x94, 0xfe, 0x00, 0xfd, 0xff, 0x04, 0x7e, 0xf0, 0x0c, 0x00, 0x00, 0xfd, 0xff, 0x04,
+  0x18, 0xfa, 0x6a, 0x00, 0x00, 0xfd, 0xff, 0x04, 0x00, 0xaa, 0xd2, 0x00, 0x00, 0xfd, 0xff, 0x04,
+  0x00, 0x40, 0xff, 0x3e, 0x00, 0xfd, 0xff, 0x04, 0x00, 0x00, 0xd4, 0xa8, 0x00, 0xfd, 0xff, 0x04,
+  0x00, 0x00, 0x6a, 0xfa, 0x18, 0xfd, 0xff, 0x04, 0x00, 0x00, 0x0c, 0xf2, 0x7e, 0xfd, 0xff, 0xfe,
+  0x00, 0x01, 0x96, 0xe4, 0xfd, 0xff, 0xfe, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0xfd, 0x00, 0x02, 0xc0,
+  0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 9 */
-  0x00, 0x00, 0x8c, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0x00, 0x8c, 0xcc, 0x06, 0xfa, 0x00, 0x01, 0xa6, 0x9c, 0xf3, 0x00, 0x09, 0x0c, 0x8c,
+  0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d, 0xc0, 0x00, 0x56, 0xff, 0xe4,
+  0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00, 0x05, 0x68, 0xff, 0xaa, 0xda,
+  0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08, 0xfe, 0x00, 0x04, 0x08, 0xff,
+  0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08, 0xfe, 0x00, 0x05, 0x08, 0xff,
+  0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa, 0xff, 0x62, 0xfe, 0x00, 0x0d,
+  0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54, 0x00, 0xc2, 0xfc, 0xff,
+  0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0xdc, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 9 */
-  0x00, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0x06, 0xcc, 0x8c, 0xfb, 0x00, 0x01, 0x9c, 0xa4, 0xf3, 0x00, 0x09, 0x0c, 0x8c,
+  0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d, 0xc0, 0x00, 0x56, 0xff, 0xe4,
+  0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00, 0x05, 0x68, 0xff, 0xaa, 0xda,
+  0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08, 0xfe, 0x00, 0x04, 0x08, 0xff,
+  0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08, 0xfe, 0x00, 0x05, 0x08, 0xff,
+  0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa, 0xff, 0x62, 0xfe, 0x00, 0x0d,
+  0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54, 0x00, 0xc2, 0xfc, 0xff,
+  0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0xdc, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 9 */
-  0x00, 0x00, 0x00, 0xae, 0xe0, 0xae, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0x00, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0xae, 0xe0, 0xae, 0xfc, 0x00, 0x04, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0xf5, 0x00,
+  0x09, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d, 0xc0, 0x00,
+  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00, 0x05, 0x68,
+  0xff, 0xaa, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08, 0xfe, 0x00,
+  0x04, 0x08, 0xff, 0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08, 0xfe, 0x00,
+  0x05, 0x08, 0xff, 0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa, 0xff, 0x62,
+  0xfe, 0x00, 0x0d, 0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54, 0x00,
+  0xc2, 0xfc, 0xff, 0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0xdc, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 9 */
-  0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0x00, 0x00,  //..+@%.@..
-  0x00, 0x00, 0xda, 0x16, 0x94, 0xf2, 0x76, 0x00, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0x7a, 0xf2, 0x90, 0x16, 0xda, 0xfd, 0x00, 0x04, 0xda, 0x16, 0x94, 0xf2, 0x76,
+  0xf5, 0x00, 0x09, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d,
+  0xc0, 0x00, 0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00,
+  0x05, 0x68, 0xff, 0xaa, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x04, 0x08, 0xff, 0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x05, 0x08, 0xff, 0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa,
+  0xff, 0x62, 0xfe, 0x00, 0x0d, 0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff,
+  0x54, 0x00, 0xc2, 0xfc, 0xff, 0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c,
+  0xdc, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 9 */
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00,  //..%@@@%..
-  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0xaa, 0xff, 0x64, 0x00, 0x00, 0x00, 0x68, 0xff, 0xaa,  //%@+...+@%
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x26, 0xff, 0xda,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xf4, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf2,  //@@.....@@
-  0xda, 0xff, 0x24, 0x00, 0x00, 0x00, 0x24, 0xff, 0xda,  //@@.....@@
-  0xaa, 0xff, 0x62, 0x00, 0x00, 0x00, 0x66, 0xff, 0xaa,  //%@+...+@%
-  0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff, 0x54,  //+@@...@@+
-  0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //.@@@@@@@.
-  0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xf5, 0x00, 0x09, 0x0c, 0x8c, 0xe0, 0xf8, 0xe0, 0x8a, 0x0a, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0x0d,
+  0xc0, 0x00, 0x56, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe6, 0xff, 0x54, 0xaa, 0xff, 0x64, 0xfe, 0x00,
+  0x05, 0x68, 0xff, 0xaa, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x26, 0xff, 0xda, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x04, 0x08, 0xff, 0xf2, 0xfc, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xfc, 0xf4, 0xff, 0x08,
+  0xfe, 0x00, 0x05, 0x08, 0xff, 0xf2, 0xda, 0xff, 0x24, 0xfe, 0x00, 0x05, 0x24, 0xff, 0xda, 0xaa,
+  0xff, 0x62, 0xfe, 0x00, 0x0d, 0x66, 0xff, 0xaa, 0x58, 0xff, 0xe4, 0x38, 0x04, 0x3a, 0xe6, 0xff,
+  0x54, 0x00, 0xc2, 0xfc, 0xff, 0x09, 0xc0, 0x00, 0x00, 0x0c, 0x8c, 0xe2, 0xf8, 0xe2, 0x8c, 0x0c,
+  0xdc, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e,  //++....++
-  0x7e, 0xff, 0x7e, 0x00, 0x00, 0x7e, 0xff, 0x7e,  //+@+..+@+
-  0x00, 0x7e, 0xff, 0x7e, 0x7e, 0xff, 0x7e, 0x00,  //.+@++@+.
-  0x00, 0x00, 0x7e, 0xff, 0xff, 0x7e, 0x00, 0x00,  //..+@@+..
-  0x00, 0x00, 0x7e, 0xff, 0xff, 0x7e, 0x00, 0x00,  //..+@@+..
-  0x00, 0x80, 0xff, 0x7e, 0x80, 0xff, 0x7e, 0x00,  //.%@+%@+.
-  0x82, 0xff, 0x80, 0x00, 0x00, 0x80, 0xff, 0x7e,  //%@%..%@+
-  0x7a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x82, 0x78,  //+%....%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd1, 0x00, 0x01, 0x7e, 0x7e, 0xfd, 0x00, 0xfe, 0x7e, 0x0d, 0xff, 0x7e, 0x00, 0x00, 0x7e, 0xff,
+  0x7e, 0x00, 0x7e, 0xff, 0x7e, 0x7e, 0xff, 0x7e, 0xfe, 0x00, 0x03, 0x7e, 0xff, 0xff, 0x7e, 0xfd,
+  0x00, 0x03, 0x7e, 0xff, 0xff, 0x7e, 0xfe, 0x00, 0x10, 0x80, 0xff, 0x7e, 0x80, 0xff, 0x7e, 0x00,
+  0x82, 0xff, 0x80, 0x00, 0x00, 0x80, 0xff, 0x7e, 0x7a, 0x82, 0xfd, 0x00, 0x01, 0x82, 0x78, 0xd1,
+  0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x04,  //...........
-  0x00, 0x00, 0x10, 0x92, 0xe2, 0xf6, 0xcc, 0x46, 0x00, 0xa2, 0x84,  //...%@@@+.%%
-  0x00, 0x04, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x6c, 0xec, 0x18,  //..@@@@@@+@.
-  0x00, 0x64, 0xff, 0xe4, 0x3a, 0x06, 0x3a, 0xe8, 0xff, 0x68, 0x00,  //.+@@...@@+.
-  0x00, 0xb4, 0xff, 0x66, 0x00, 0x00, 0x04, 0xc8, 0xff, 0x80, 0x00,  //.%@+...@@%.
-  0x00, 0xe2, 0xff, 0x28, 0x00, 0x00, 0x98, 0xca, 0xff, 0xc8, 0x00,  //.@@...%@@@.
-  0x00, 0xf6, 0xff, 0x0c, 0x00, 0x6c, 0xd4, 0x14, 0xff, 0xec, 0x00,  //.@@..+@.@@.
-  0x00, 0xf8, 0xff, 0x00, 0x42, 0xe8, 0x22, 0x00, 0xff, 0xfa, 0x00,  //.@@.+@..@@.
-  0x00, 0xe6, 0xff, 0x24, 0xe8, 0x40, 0x00, 0x08, 0xff, 0xf6, 0x00,  //.@@.@+..@@.
-  0x00, 0xce, 0xff, 0xde, 0x68, 0x00, 0x00, 0x24, 0xff, 0xe2, 0x00,  //.@@@+...@@.
-  0x00, 0x92, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x66, 0xff, 0xb4, 0x00,  //.%@%...+@%.
-  0x00, 0x8c, 0xff, 0xda, 0x36, 0x04, 0x3a, 0xe6, 0xff, 0x60, 0x00,  //.%@@...@@+.
-  0x20, 0xe8, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x04, 0x00,  //.@+@@@@@@..
-  0xa8, 0x70, 0x00, 0x5c, 0xd4, 0xf8, 0xe4, 0x92, 0x10, 0x00, 0x00,  //%+.+@@@%...
-  0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe2, 0x00, 0x0f, 0x12, 0x04, 0x00, 0x00, 0x10, 0x92, 0xe2, 0xf6, 0xcc, 0x46, 0x00, 0xa2, 0x84,
+  0x00, 0x04, 0xcc, 0xfd, 0xff, 0x54, 0xfa, 0x6c, 0xec, 0x18, 0x00, 0x64, 0xff, 0xe4, 0x3a, 0x06,
+  0x3a, 0xe8, 0xff, 0x68, 0x00, 0x00, 0xb4, 0xff, 0x66, 0x00, 0x00, 0x04, 0xc8, 0xff, 0x80, 0x00,
+  0x00, 0xe2, 0xff, 0x28, 0x00, 0x00, 0x98, 0xca, 0xff, 0xc8, 0x00, 0x00, 0xf6, 0xff, 0x0c, 0x00,
+  0x6c, 0xd4, 0x14, 0xff, 0xec, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x42, 0xe8, 0x22, 0x00, 0xff, 0xfa,
+  0x00, 0x00, 0xe6, 0xff, 0x24, 0xe8, 0x40, 0x00, 0x08, 0xff, 0xf6, 0x00, 0x00, 0xce, 0xff, 0xde,
+  0x68, 0x00, 0x00, 0x24, 0xff, 0xe2, 0x00, 0x00, 0x92, 0xff, 0xa0, 0xfe, 0x00, 0x11, 0x66, 0xff,
+  0xb4, 0x00, 0x00, 0x8c, 0xff, 0xda, 0x36, 0x04, 0x3a, 0xe6, 0xff, 0x60, 0x00, 0x20, 0xe8, 0x72,
+  0xfc, 0xff, 0x0f, 0xca, 0x04, 0x00, 0xa8, 0x70, 0x00, 0x5c, 0xd4, 0xf8, 0xe4, 0x92, 0x10, 0x00,
+  0x00, 0x2a, 0x04, 0xd7, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 9 */
-  0x00, 0x00, 0x8c, 0xcc, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x00, 0xa6, 0x9c, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,  //@@.....@@
-  0xe4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //@@.....@@
-  0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa,  //%@%...%@%
-  0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c,  //.@@@@@@@.
-  0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x04, 0x00, 0x00, 0x8c, 0xcc, 0x06, 0xfa, 0x00, 0x01, 0xa6, 0x9c, 0xf4, 0x00, 0x01, 0xff, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x03, 0xff,
+  0xff, 0xf8, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xf6, 0xe4, 0xff, 0x14, 0xfe, 0x00, 0x0d, 0x18, 0xff,
+  0xe4, 0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa, 0x2a, 0xf2, 0xfc, 0xff, 0x09, 0xf2,
+  0x2c, 0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0xdc, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 9 */
-  0x00, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,  //@@.....@@
-  0xe4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //@@.....@@
-  0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa,  //%@%...%@%
-  0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c,  //.@@@@@@@.
-  0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0x06, 0xcc, 0x8c, 0xfb, 0x00, 0x01, 0x9c, 0xa4, 0xf4, 0x00, 0x01, 0xff, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x03, 0xff,
+  0xff, 0xf8, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xf6, 0xe4, 0xff, 0x14, 0xfe, 0x00, 0x0d, 0x18, 0xff,
+  0xe4, 0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa, 0x2a, 0xf2, 0xfc, 0xff, 0x09, 0xf2,
+  0x2c, 0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0xdc, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 9 */
-  0x00, 0x00, 0x00, 0xae, 0xe0, 0xae, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0x00, 0x00,  //..%%.%%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,  //@@.....@@
-  0xe4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //@@.....@@
-  0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa,  //%@%...%@%
-  0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c,  //.@@@@@@@.
-  0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xfe, 0x00, 0x02, 0xae, 0xe0, 0xae, 0xfc, 0x00, 0x04, 0x90, 0xa0, 0x04, 0xa0, 0x90, 0xf6, 0x00,
+  0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0x03, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xf6, 0xe4, 0xff, 0x14, 0xfe, 0x00,
+  0x0d, 0x18, 0xff, 0xe4, 0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa, 0x2a, 0xf2, 0xfc,
+  0xff, 0x09, 0xf2, 0x2c, 0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0xdc, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 9 */
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,  //..@@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,  //@@.....@@
-  0xe4, 0xff, 0x14, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //@@.....@@
-  0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa,  //%@%...%@%
-  0x2a, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2c,  //.@@@@@@@.
-  0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0xf6, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0x00, 0x04, 0xff, 0xf6, 0xe4, 0xff, 0x14,
+  0xfe, 0x00, 0x0d, 0x18, 0xff, 0xe4, 0xaa, 0xff, 0xae, 0x2a, 0x06, 0x22, 0xb0, 0xff, 0xaa, 0x2a,
+  0xf2, 0xfc, 0xff, 0x09, 0xf2, 0x2c, 0x00, 0x26, 0xa4, 0xe6, 0xfa, 0xe6, 0xa4, 0x26, 0xdc, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 10 */
-  0x00, 0x00, 0x00, 0x06, 0xcc, 0x8c, 0x00, 0x00, 0x00, 0x00,  //....@%....
-  0x00, 0x00, 0x00, 0x9c, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xb8, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xb6,  //%@%....%@%
-  0x2c, 0xfc, 0xf8, 0x24, 0x00, 0x00, 0x24, 0xfa, 0xfa, 0x2a,  //.@@....@@.
-  0x00, 0x9a, 0xff, 0xae, 0x00, 0x00, 0xae, 0xff, 0x98, 0x00,  //.%@%..%@%.
-  0x00, 0x16, 0xf2, 0xff, 0x3c, 0x3e, 0xff, 0xf2, 0x16, 0x00,  //..@@..@@..
-  0x00, 0x00, 0x7c, 0xff, 0xca, 0xca, 0xff, 0x7c, 0x00, 0x00,  //..+@@@@+..
-  0x00, 0x00, 0x08, 0xe4, 0xff, 0xff, 0xe2, 0x08, 0x00, 0x00,  //...@@@@...
-  0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00,  //...+@@+...
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xfe, 0x00, 0x02, 0x06, 0xcc, 0x8c, 0xfa, 0x00, 0x01, 0x9c, 0xa4, 0xf2, 0x00, 0x02, 0xb8, 0xff,
+  0x92, 0xfd, 0x00, 0x1f, 0x92, 0xff, 0xb6, 0x2c, 0xfc, 0xf8, 0x24, 0x00, 0x00, 0x24, 0xfa, 0xfa,
+  0x2a, 0x00, 0x9a, 0xff, 0xae, 0x00, 0x00, 0xae, 0xff, 0x98, 0x00, 0x00, 0x16, 0xf2, 0xff, 0x3c,
+  0x3e, 0xff, 0xf2, 0x16, 0xfe, 0x00, 0x05, 0x7c, 0xff, 0xca, 0xca, 0xff, 0x7c, 0xfd, 0x00, 0x05,
+  0x08, 0xe4, 0xff, 0xff, 0xe2, 0x08, 0xfc, 0x00, 0x03, 0x5e, 0xff, 0xff, 0x5e, 0xfa, 0x00, 0x01,
+  0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff,
+  0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xd5, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xe8, 0xb2, 0x3e, 0x00,  //@@@@@@%..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x48,  //@@@@@@@@+
-  0xff, 0xff, 0x00, 0x00, 0x08, 0x30, 0xba, 0xff, 0xc4,  //@@....%@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf4,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf4,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x08, 0x30, 0xba, 0xff, 0xc6,  //@@....%@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x4a,  //@@@@@@@@+
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xe8, 0xb2, 0x42, 0x00,  //@@@@@@%+.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe6, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xfd, 0xff, 0x04, 0xfa,
+  0xe8, 0xb2, 0x3e, 0x00, 0xfa, 0xff, 0x0c, 0xfc, 0x48, 0xff, 0xff, 0x00, 0x00, 0x08, 0x30, 0xba,
+  0xff, 0xc4, 0xff, 0xff, 0xfd, 0x00, 0x04, 0x1a, 0xff, 0xf4, 0xff, 0xff, 0xfd, 0x00, 0x0b, 0x1a,
+  0xff, 0xf4, 0xff, 0xff, 0x00, 0x00, 0x08, 0x30, 0xba, 0xff, 0xc6, 0xfa, 0xff, 0x01, 0xfc, 0x4a,
+  0xfd, 0xff, 0x06, 0xfa, 0xe8, 0xb2, 0x42, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xd6, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x5c, 0xca, 0xf4, 0xf6, 0xca, 0x52, 0x00, 0x00,  //.+@@@@+..
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00,  //+@@@@@@+.
-  0xce, 0xff, 0x92, 0x10, 0x10, 0x8a, 0xff, 0xbc, 0x00,  //@@%..%@%.
-  0xf6, 0xff, 0x10, 0x00, 0x00, 0x34, 0xff, 0xe8, 0x00,  //@@....@@.
-  0xff, 0xff, 0x00, 0x00, 0x64, 0xfc, 0xb8, 0x34, 0x00,  //@@..+@%..
-  0xff, 0xff, 0x00, 0x00, 0xe6, 0xff, 0x12, 0x00, 0x00,  //@@..@@...
-  0xff, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0x00,  //@@..@@...
-  0xff, 0xff, 0x00, 0x00, 0x2e, 0xd0, 0x86, 0x04, 0x00,  //@@...@%..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0x14,  //@@....@@.
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xaa,  //@@.....@%
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf0,  //@@.....@@
-  0xff, 0xff, 0x00, 0xa0, 0x24, 0x0c, 0x86, 0xff, 0xe0,  //@@.%..%@@
-  0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //@@.@@@@@%
-  0xff, 0xff, 0x00, 0x52, 0xd8, 0xf6, 0xd6, 0x72, 0x02,  //@@.+@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x08, 0x5c, 0xca, 0xf4, 0xf6, 0xca, 0x52, 0x00, 0x00, 0x5e, 0xfb, 0xff, 0x2b, 0x40,
+  0x00, 0xce, 0xff, 0x92, 0x10, 0x10, 0x8a, 0xff, 0xbc, 0x00, 0xf6, 0xff, 0x10, 0x00, 0x00, 0x34,
+  0xff, 0xe8, 0x00, 0xff, 0xff, 0x00, 0x00, 0x64, 0xfc, 0xb8, 0x34, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xe6, 0xff, 0x12, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe0, 0xff, 0xfe, 0x00, 0x0a, 0xff, 0xff,
+  0x00, 0x00, 0x2e, 0xd0, 0x86, 0x04, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x04, 0xce, 0xce, 0x14, 0xff,
+  0xff, 0xfd, 0x00, 0x04, 0x32, 0xff, 0xaa, 0xff, 0xff, 0xfd, 0x00, 0x0e, 0x0a, 0xff, 0xf0, 0xff,
+  0xff, 0x00, 0xa0, 0x24, 0x0c, 0x86, 0xff, 0xe0, 0xff, 0xff, 0x00, 0xfc, 0xff, 0x09, 0x80, 0xff,
+  0xff, 0x00, 0x52, 0xd8, 0xf6, 0xd6, 0x72, 0x02, 0xdd, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8a, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0x00, 0xa0, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x02, 0xb6, 0x9a, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x02, 0x8a, 0xea, 0x1e, 0xfa, 0x00, 0x02, 0xa0, 0xca, 0x06, 0xfb, 0x00, 0x02, 0x02,
+  0xb6, 0x9a, 0xf3, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff,
+  0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10,
+  0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea,
+  0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff,
+  0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff,
+  0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //.....@%..
-  0x00, 0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xeb, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfc, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfb, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf4, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff,
+  0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10,
+  0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea,
+  0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff,
+  0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff,
+  0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x22, 0xee, 0xee, 0x20, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06, 0x00,  //...@%%@..
-  0x00, 0x00, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x03, 0x22, 0xee, 0xee, 0x20, 0xfd, 0x00, 0x05, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06,
+  0xfe, 0x00, 0x05, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0xf6, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8,
+  0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff, 0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20,
+  0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10, 0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff,
+  0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea,
+  0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06,
+  0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x66, 0xf0, 0xcc, 0x36, 0x28, 0xec, 0x00,  //..+@@..@.
-  0x00, 0x00, 0xea, 0x24, 0x34, 0xca, 0xf0, 0x6a, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xed, 0x00, 0x05, 0x66, 0xf0, 0xcc, 0x36, 0x28, 0xec, 0xfe, 0x00, 0x05, 0xea, 0x24, 0x34, 0xca,
+  0xf0, 0x6a, 0xed, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff,
+  0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10,
+  0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea,
+  0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff,
+  0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff,
+  0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xed, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0xed, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00, 0x00, 0xfb, 0xff,
+  0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10,
+  0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01, 0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea,
+  0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff,
+  0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff,
+  0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 9 */
-  0x00, 0x00, 0x1e, 0xbc, 0xf2, 0xba, 0x1c, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0xbc, 0x74, 0x0a, 0x76, 0xba, 0x00, 0x00,  //..%+.+%..
-  0x00, 0x00, 0xf2, 0x0a, 0x00, 0x0a, 0xf2, 0x00, 0x00,  //..@...@..
-  0x00, 0x00, 0xbe, 0x72, 0x0a, 0x76, 0xbc, 0x00, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x20, 0xbe, 0xf2, 0xbc, 0x1e, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x3a, 0x9e, 0xe0, 0xf8, 0xea, 0xae, 0x32, 0x00,  //..%@@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a,  //.@@@@@@@.
-  0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0, 0xff, 0xb4,  //.@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xec,  //.......@@
-  0x00, 0x56, 0xba, 0xe8, 0xfa, 0xff, 0xff, 0xff, 0xfa,  //.+%@@@@@@
-  0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@@
-  0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff,  //@@+....@@
-  0xea, 0xff, 0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff,  //@@+...%@@
-  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,  //%@@@@@%@@
-  0x06, 0x80, 0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff,  //.%@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0x06, 0x00, 0x00, 0x1e, 0xbc, 0xf2, 0xba, 0x1c, 0xfd, 0x00, 0x04, 0xbc, 0x74, 0x0a, 0x76, 0xba,
+  0xfd, 0x00, 0x04, 0xf2, 0x0a, 0x00, 0x0a, 0xf2, 0xfd, 0x00, 0x04, 0xbe, 0x72, 0x0a, 0x76, 0xbc,
+  0xfd, 0x00, 0x04, 0x20, 0xbe, 0xf2, 0xbc, 0x1e, 0xf5, 0x00, 0x08, 0x3a, 0x9e, 0xe0, 0xf8, 0xea,
+  0xae, 0x32, 0x00, 0x00, 0xfb, 0xff, 0x0a, 0xf6, 0x3a, 0x00, 0xc8, 0x5a, 0x18, 0x04, 0x20, 0xa0,
+  0xff, 0xb4, 0xfb, 0x00, 0x07, 0x10, 0xff, 0xec, 0x00, 0x56, 0xba, 0xe8, 0xfa, 0xfe, 0xff, 0x01,
+  0xfa, 0x7c, 0xf9, 0xff, 0x12, 0xea, 0xff, 0x70, 0x1a, 0x04, 0x00, 0x16, 0xff, 0xff, 0xea, 0xff,
+  0x58, 0x0a, 0x08, 0x36, 0xbc, 0xff, 0xff, 0x92, 0xfc, 0xff, 0x0b, 0x88, 0xff, 0xff, 0x06, 0x80,
+  0xda, 0xf6, 0xdc, 0x76, 0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x78, 0xf0, 0x64, 0x3c, 0xd8, 0xf6, 0xb2, 0x10,  //.+@+.@@%.
-  0x00, 0xff, 0xff, 0xe4, 0xe4, 0xff, 0xff, 0xff, 0x8c,  //.@@@@@@@%
-  0x00, 0x6a, 0x44, 0xff, 0xff, 0x48, 0x48, 0xff, 0xd2,  //.++@@++@@
-  0x00, 0x00, 0x02, 0xff, 0xff, 0x04, 0x04, 0xff, 0xf0,  //...@@..@@
-  0x1e, 0xba, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //.%@@@@@@@
-  0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@@@@@@@
-  0xec, 0xff, 0x24, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,  //@@.@@....
-  0xf2, 0xff, 0x3a, 0xff, 0xff, 0x64, 0x06, 0x18, 0x92,  //@@.@@+..%
-  0xc4, 0xff, 0xff, 0xca, 0xbc, 0xff, 0xff, 0xff, 0xff,  //@@@@%@@@@
-  0x34, 0xd8, 0xe8, 0x3c, 0x1a, 0xba, 0xf4, 0xda, 0x56,  //.@@..%@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xca, 0x00, 0x0c, 0x78, 0xf0, 0x64, 0x3c, 0xd8, 0xf6, 0xb2, 0x10, 0x00, 0xff, 0xff, 0xe4, 0xe4,
+  0xfe, 0xff, 0x15, 0x8c, 0x00, 0x6a, 0x44, 0xff, 0xff, 0x48, 0x48, 0xff, 0xd2, 0x00, 0x00, 0x02,
+  0xff, 0xff, 0x04, 0x04, 0xff, 0xf0, 0x1e, 0xba, 0xf4, 0xfc, 0xff, 0x01, 0xfc, 0xb0, 0xf9, 0xff,
+  0x04, 0xec, 0xff, 0x24, 0xff, 0xfa, 0xfd, 0x00, 0x0d, 0xf2, 0xff, 0x3a, 0xff, 0xff, 0x64, 0x06,
+  0x18, 0x92, 0xc4, 0xff, 0xff, 0xca, 0xbc, 0xfd, 0xff, 0x08, 0x34, 0xd8, 0xe8, 0x3c, 0x1a, 0xba,
+  0xf4, 0xda, 0x56, 0xdd, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x04, 0x70, 0xca, 0xf2, 0xf4, 0xbe, 0x4c,  //..+@@@%+
-  0x04, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x74, 0xff, 0xee, 0x64, 0x18, 0x0c, 0x36, 0xa8,  //+@@+...%
-  0xce, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-  0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-  0xf6, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@......
-  0xce, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@+.....
-  0x74, 0xff, 0xee, 0x64, 0x18, 0x0c, 0x34, 0xa4,  //+@@+...%
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@
-  0x00, 0x04, 0x70, 0xcc, 0xf4, 0xf4, 0xc0, 0x4c,  //..+@@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x8c, 0x00,  //.....%%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf2, 0x00,  //......@.
-  0x00, 0x00, 0x00, 0x00, 0xe8, 0xf6, 0x96, 0x00,  //....@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd0, 0x00, 0x08, 0x04, 0x70, 0xca, 0xf2, 0xf4, 0xbe, 0x4c, 0x04, 0xbc, 0xfb, 0xff, 0x0a, 0x74,
+  0xff, 0xee, 0x64, 0x18, 0x0c, 0x36, 0xa8, 0xce, 0xff, 0x5e, 0xfc, 0x00, 0x02, 0xf6, 0xff, 0x12,
+  0xfc, 0x00, 0x02, 0xf6, 0xff, 0x12, 0xfc, 0x00, 0x02, 0xce, 0xff, 0x5e, 0xfc, 0x00, 0x09, 0x74,
+  0xff, 0xee, 0x64, 0x18, 0x0c, 0x34, 0xa4, 0x04, 0xbe, 0xfb, 0xff, 0x07, 0x00, 0x04, 0x70, 0xcc,
+  0xf4, 0xf4, 0xc0, 0x4c, 0xfc, 0x00, 0x01, 0x82, 0x8c, 0xfb, 0x00, 0x01, 0x28, 0xf2, 0xfc, 0x00,
+  0x02, 0xe8, 0xf6, 0x96, 0xf8, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8a, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0x00, 0xa0, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x02, 0xb6, 0x9a, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00,  //..+@@@%..
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x18,  //.%@@@@@@.
-  0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96,  //+@@...%@%
-  0xce, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xce, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6,  //+@@+...+@
-  0x02, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@
-  0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x02, 0x8a, 0xea, 0x1e, 0xfa, 0x00, 0x02, 0xa0, 0xca, 0x06, 0xfb, 0x00, 0x02, 0x02,
+  0xb6, 0x9a, 0xf3, 0x00, 0x09, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00, 0x04, 0xbe, 0xfc,
+  0xff, 0x0d, 0xe6, 0x18, 0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96, 0xce, 0xff, 0x2a,
+  0xfe, 0x00, 0x03, 0x1a, 0xff, 0xde, 0xf4, 0xfa, 0xff, 0x01, 0xfa, 0xf4, 0xf9, 0xff, 0x02, 0xce,
+  0xfa, 0x10, 0xfb, 0x00, 0x0a, 0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6, 0x02, 0xb4,
+  0xfa, 0xff, 0x08, 0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36, 0xdd, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //.....@%..
-  0x00, 0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00,  //..+@@@%..
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x18,  //.%@@@@@@.
-  0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96,  //+@@...%@%
-  0xce, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xce, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6,  //+@@+...+@
-  0x02, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@
-  0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xeb, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfc, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfb, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf4, 0x00, 0x09, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00, 0x04, 0xbe, 0xfc,
+  0xff, 0x0d, 0xe6, 0x18, 0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96, 0xce, 0xff, 0x2a,
+  0xfe, 0x00, 0x03, 0x1a, 0xff, 0xde, 0xf4, 0xfa, 0xff, 0x01, 0xfa, 0xf4, 0xf9, 0xff, 0x02, 0xce,
+  0xfa, 0x10, 0xfb, 0x00, 0x0a, 0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6, 0x02, 0xb4,
+  0xfa, 0xff, 0x08, 0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36, 0xdd, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x22, 0xee, 0xee, 0x20, 0x00, 0x00,  //....@@...
-  0x00, 0x00, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06, 0x00,  //...@%%@..
-  0x00, 0x00, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0x00,  //..%%..%%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00,  //..+@@@%..
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x18,  //.%@@@@@@.
-  0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96,  //+@@...%@%
-  0xce, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xce, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6,  //+@@+...+@
-  0x02, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@
-  0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x03, 0x22, 0xee, 0xee, 0x20, 0xfd, 0x00, 0x05, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06,
+  0xfe, 0x00, 0x05, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0xf6, 0x00, 0x09, 0x06, 0x78, 0xd4, 0xf6,
+  0xec, 0xa8, 0x20, 0x00, 0x04, 0xbe, 0xfc, 0xff, 0x0d, 0xe6, 0x18, 0x72, 0xff, 0xce, 0x38, 0x08,
+  0x22, 0xb2, 0xff, 0x96, 0xce, 0xff, 0x2a, 0xfe, 0x00, 0x03, 0x1a, 0xff, 0xde, 0xf4, 0xfa, 0xff,
+  0x01, 0xfa, 0xf4, 0xf9, 0xff, 0x02, 0xce, 0xfa, 0x10, 0xfb, 0x00, 0x0a, 0x70, 0xff, 0xc4, 0x44,
+  0x10, 0x04, 0x20, 0x62, 0xc6, 0x02, 0xb4, 0xfa, 0xff, 0x08, 0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8,
+  0xdc, 0x9a, 0x36, 0xdd, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00,  //..+@@@%..
-  0x04, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x18,  //.%@@@@@@.
-  0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96,  //+@@...%@%
-  0xce, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde,  //@@.....@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //@@@@@@@@@
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@
-  0xce, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6,  //+@@+...+@
-  0x02, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@
-  0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36,  //..+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xed, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0xed, 0x00, 0x09, 0x06, 0x78, 0xd4, 0xf6, 0xec, 0xa8, 0x20, 0x00, 0x04, 0xbe, 0xfc,
+  0xff, 0x0d, 0xe6, 0x18, 0x72, 0xff, 0xce, 0x38, 0x08, 0x22, 0xb2, 0xff, 0x96, 0xce, 0xff, 0x2a,
+  0xfe, 0x00, 0x03, 0x1a, 0xff, 0xde, 0xf4, 0xfa, 0xff, 0x01, 0xfa, 0xf4, 0xf9, 0xff, 0x02, 0xce,
+  0xfa, 0x10, 0xfb, 0x00, 0x0a, 0x70, 0xff, 0xc4, 0x44, 0x10, 0x04, 0x20, 0x62, 0xc6, 0x02, 0xb4,
+  0xfa, 0xff, 0x08, 0x00, 0x02, 0x66, 0xc4, 0xf0, 0xf8, 0xdc, 0x9a, 0x36, 0xdd, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x8a, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@......
-  0x00, 0xa0, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //.%@.....
-  0x00, 0x02, 0xb6, 0x9a, 0x00, 0x00, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf1, 0x00, 0x02, 0x8a, 0xea, 0x1e, 0xfb, 0x00, 0x02, 0xa0, 0xca, 0x06, 0xfc, 0x00, 0x02, 0x02,
+  0xb6, 0x9a, 0xf5, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+  0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //....@%..
-  0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //...@%...
-  0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //..%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xee, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfd, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfc, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf6, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+  0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x22, 0xee, 0xee, 0x20, 0x00, 0x00,  //...@@...
-  0x00, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06, 0x00,  //..@%%@..
-  0x00, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0x00,  //.%%..%%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xef, 0x00, 0x03, 0x22, 0xee, 0xee, 0x20, 0xfe, 0x00, 0x0d, 0x06, 0xce, 0x9a, 0x98, 0xcc, 0x06,
+  0x00, 0x00, 0x9c, 0xb8, 0x02, 0x02, 0xb6, 0x9c, 0xf8, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff,
+  0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+  0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00,
+  0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //@@@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf0, 0x00, 0x0d, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0xf0, 0x00, 0xfc, 0xff, 0xfe, 0x00, 0xfc, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01,
+  0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf1, 0xff, 0xe1, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x9e, 0xff, 0xe8, 0x22, 0x06, 0x48, 0x3a, 0x00,  //.%@@..+..
-  0x00, 0x02, 0xb8, 0xff, 0xe8, 0xe0, 0xa4, 0x3e, 0x00,  //..%@@@%..
-  0x00, 0x94, 0xe2, 0xe2, 0xff, 0xce, 0x0e, 0x00, 0x00,  //.%@@@@...
-  0x00, 0x1e, 0x02, 0x20, 0xf2, 0xff, 0xba, 0x02, 0x00,  //....@@%..
-  0x00, 0x16, 0x9a, 0xe4, 0xfa, 0xff, 0xff, 0x7a, 0x00,  //..%@@@@+.
-  0x10, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1a,  //.@@@@@@@.
-  0x88, 0xff, 0xde, 0x42, 0x08, 0x14, 0xc6, 0xff, 0x7c,  //%@@+..@@+
-  0xd6, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x46, 0xff, 0xcc,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xee,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd6, 0xff, 0x48, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xd4,  //@@+...+@@
-  0x88, 0xff, 0xda, 0x3a, 0x0a, 0x3a, 0xdc, 0xff, 0x86,  //%@@...@@%
-  0x10, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x0e,  //.@@@@@@@.
-  0x00, 0x16, 0x98, 0xe4, 0xfa, 0xe4, 0x98, 0x14, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x17, 0x9e, 0xff, 0xe8, 0x22, 0x06, 0x48, 0x3a, 0x00, 0x00, 0x02, 0xb8, 0xff, 0xe8,
+  0xe0, 0xa4, 0x3e, 0x00, 0x00, 0x94, 0xe2, 0xe2, 0xff, 0xce, 0x0e, 0xfe, 0x00, 0x12, 0x1e, 0x02,
+  0x20, 0xf2, 0xff, 0xba, 0x02, 0x00, 0x00, 0x16, 0x9a, 0xe4, 0xfa, 0xff, 0xff, 0x7a, 0x00, 0x10,
+  0xde, 0xfc, 0xff, 0x0d, 0xf6, 0x1a, 0x88, 0xff, 0xde, 0x42, 0x08, 0x14, 0xc6, 0xff, 0x7c, 0xd6,
+  0xff, 0x4a, 0xfe, 0x00, 0x05, 0x46, 0xff, 0xcc, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0a, 0xff,
+  0xee, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd6, 0xff, 0x48, 0xfe, 0x00, 0x0d,
+  0x4a, 0xff, 0xd4, 0x88, 0xff, 0xda, 0x3a, 0x0a, 0x3a, 0xdc, 0xff, 0x86, 0x10, 0xdc, 0xfc, 0xff,
+  0x09, 0xda, 0x0e, 0x00, 0x16, 0x98, 0xe4, 0xfa, 0xe4, 0x98, 0x14, 0xdc, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x66, 0xf0, 0xcc, 0x36, 0x28, 0xec, 0x00,  //..+@@..@.
-  0x00, 0x00, 0xea, 0x24, 0x34, 0xca, 0xf0, 0x6a, 0x00,  //..@..@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00,  //@@.+@@@+.
-  0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58,  //@@+@@@@@+
-  0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2,  //@@@+..%@@
-  0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x20, 0xff, 0xf0,  //@@+....@@
-  0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xed, 0x00, 0x05, 0x66, 0xf0, 0xcc, 0x36, 0x28, 0xec, 0xfe, 0x00, 0x05, 0xea, 0x24, 0x34, 0xca,
+  0xf0, 0x6a, 0xee, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x6e, 0xd8, 0xf8, 0xda, 0x68, 0x00, 0xff, 0xff,
+  0x7e, 0xfc, 0xff, 0x0c, 0x58, 0xff, 0xff, 0xd8, 0x46, 0x0a, 0x1e, 0xb0, 0xff, 0xc2, 0xff, 0xff,
+  0x48, 0xfe, 0x00, 0x05, 0x20, 0xff, 0xf0, 0xff, 0xff, 0x0c, 0xfd, 0x00, 0x03, 0xff, 0xfc, 0xff,
+  0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd,
+  0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8a, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0x00, 0xa0, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x02, 0xb6, 0x9a, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x02, 0x8a, 0xea, 0x1e, 0xfa, 0x00, 0x02, 0xa0, 0xca, 0x06, 0xfb, 0x00, 0x02, 0x02,
+  0xb6, 0x9a, 0xf3, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x14, 0xe2, 0xfc,
+  0xff, 0x0d, 0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c, 0xd8, 0xff, 0x44,
+  0xfe, 0x00, 0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xf6,
+  0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46, 0xff,
+  0xd8, 0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2, 0xfc, 0xff, 0x09, 0xe2,
+  0x14, 0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //.....@%..
-  0x00, 0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xeb, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfc, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfb, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf4, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x14, 0xe2, 0xfc,
+  0xff, 0x0d, 0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c, 0xd8, 0xff, 0x44,
+  0xfe, 0x00, 0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xf6,
+  0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46, 0xff,
+  0xd8, 0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2, 0xfc, 0xff, 0x09, 0xe2,
+  0x14, 0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x64, 0xff, 0x64, 0x00, 0x00, 0x00,  //...+@+...
-  0x00, 0x00, 0x18, 0xe8, 0x62, 0xe8, 0x18, 0x00, 0x00,  //...@+@...
-  0x00, 0x00, 0xac, 0x72, 0x00, 0x70, 0xac, 0x00, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x02, 0x64, 0xff, 0x64, 0xfc, 0x00, 0x04, 0x18, 0xe8, 0x62, 0xe8, 0x18, 0xfd, 0x00,
+  0x04, 0xac, 0x72, 0x00, 0x70, 0xac, 0xf5, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a,
+  0x00, 0x14, 0xe2, 0xfc, 0xff, 0x0d, 0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff,
+  0x8c, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05,
+  0x0e, 0xff, 0xf6, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe,
+  0x00, 0x0d, 0x46, 0xff, 0xd8, 0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2,
+  0xfc, 0xff, 0x09, 0xe2, 0x14, 0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x7c, 0xf0, 0x82, 0x10, 0xd8, 0x00, 0x00,  //..+@%.@..
-  0x00, 0x00, 0xd6, 0x0e, 0x82, 0xf0, 0x7e, 0x00, 0x00,  //..@.%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xed, 0x00, 0x04, 0x7c, 0xf0, 0x82, 0x10, 0xd8, 0xfd, 0x00, 0x04, 0xd6, 0x0e, 0x82, 0xf0, 0x7e,
+  0xec, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x14, 0xe2, 0xfc, 0xff, 0x0d,
+  0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c, 0xd8, 0xff, 0x44, 0xfe, 0x00,
+  0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xf6, 0xff, 0x0e,
+  0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46, 0xff, 0xd8, 0x8e,
+  0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2, 0xfc, 0xff, 0x09, 0xe2, 0x14, 0x00,
+  0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@...@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00,  //..%@@@%..
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c,  //%@@...@@%
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xf6, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xd8, 0xff, 0x44, 0x00, 0x00, 0x00, 0x46, 0xff, 0xd8,  //@@+...+@@
-  0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c,  //%@@...@@%
-  0x14, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x14,  //.@@@@@@@.
-  0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00,
+  0x01, 0xff, 0xff, 0xed, 0x00, 0x09, 0x1a, 0x9c, 0xe4, 0xf8, 0xe4, 0x9c, 0x1a, 0x00, 0x14, 0xe2,
+  0xfc, 0xff, 0x0d, 0xe2, 0x14, 0x8e, 0xff, 0xd6, 0x38, 0x0a, 0x38, 0xd8, 0xff, 0x8c, 0xd8, 0xff,
+  0x44, 0xfe, 0x00, 0x05, 0x46, 0xff, 0xd8, 0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6,
+  0xf6, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xd8, 0xff, 0x44, 0xfe, 0x00, 0x0d, 0x46,
+  0xff, 0xd8, 0x8e, 0xff, 0xd6, 0x36, 0x0a, 0x36, 0xd6, 0xff, 0x8c, 0x14, 0xe2, 0xfc, 0xff, 0x09,
+  0xe2, 0x14, 0x00, 0x1a, 0x9e, 0xe6, 0xfa, 0xe6, 0x9e, 0x1a, 0xdc, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xc1, 0x00, 0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xf3, 0x00, 0xed, 0xff, 0xf3, 0x00,
+  0x01, 0xff, 0xff, 0xf9, 0x00, 0x01, 0xff, 0xff, 0xc1, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x1a,  //...........
-  0x00, 0x00, 0x28, 0xa8, 0xea, 0xf8, 0xd0, 0x58, 0x12, 0xe2, 0x6a,  //...%@@@+.@+
-  0x00, 0x24, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xb8, 0x00,  //..@@@@@@@%.
-  0x00, 0xa2, 0xff, 0xd8, 0x38, 0x0a, 0x38, 0xf0, 0xff, 0x4c, 0x00,  //.%@@...@@+.
-  0x00, 0xe4, 0xff, 0x42, 0x00, 0x00, 0x98, 0xd2, 0xff, 0xb0, 0x00,  //.@@+..%@@%.
-  0x00, 0xf8, 0xff, 0x0c, 0x02, 0xa2, 0xae, 0x0e, 0xff, 0xe0, 0x00,  //.@@..%%.@@.
-  0x00, 0xe2, 0xff, 0x12, 0xaa, 0xa6, 0x02, 0x0e, 0xff, 0xf8, 0x00,  //.@@.%%..@@.
-  0x00, 0xaa, 0xff, 0xd4, 0x9c, 0x00, 0x00, 0x44, 0xff, 0xe4, 0x00,  //.%@@%..+@@.
-  0x00, 0x4a, 0xff, 0xf2, 0x38, 0x08, 0x34, 0xd6, 0xff, 0xa2, 0x00,  //.+@@...@@%.
-  0x00, 0xb4, 0xc6, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x24, 0x00,  //.%@@@@@@@..
-  0x56, 0xd4, 0x0a, 0x4c, 0xd0, 0xf8, 0xea, 0xaa, 0x28, 0x00, 0x00,  //+@.+@@@%...
-  0x2e, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc1, 0x00, 0x0f, 0x32, 0x1a, 0x00, 0x00, 0x28, 0xa8, 0xea, 0xf8, 0xd0, 0x58, 0x12, 0xe2, 0x6a,
+  0x00, 0x24, 0xf0, 0xfc, 0xff, 0x48, 0xd8, 0xb8, 0x00, 0x00, 0xa2, 0xff, 0xd8, 0x38, 0x0a, 0x38,
+  0xf0, 0xff, 0x4c, 0x00, 0x00, 0xe4, 0xff, 0x42, 0x00, 0x00, 0x98, 0xd2, 0xff, 0xb0, 0x00, 0x00,
+  0xf8, 0xff, 0x0c, 0x02, 0xa2, 0xae, 0x0e, 0xff, 0xe0, 0x00, 0x00, 0xe2, 0xff, 0x12, 0xaa, 0xa6,
+  0x02, 0x0e, 0xff, 0xf8, 0x00, 0x00, 0xaa, 0xff, 0xd4, 0x9c, 0x00, 0x00, 0x44, 0xff, 0xe4, 0x00,
+  0x00, 0x4a, 0xff, 0xf2, 0x38, 0x08, 0x34, 0xd6, 0xff, 0xa2, 0x00, 0x00, 0xb4, 0xc6, 0xfa, 0xfd,
+  0xff, 0x0f, 0xf0, 0x24, 0x00, 0x56, 0xd4, 0x0a, 0x4c, 0xd0, 0xf8, 0xea, 0xaa, 0x28, 0x00, 0x00,
+  0x2e, 0x24, 0xd7, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8a, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@......
-  0x00, 0x00, 0xa0, 0xca, 0x06, 0x00, 0x00, 0x00, 0x00,  //..%@.....
-  0x00, 0x00, 0x02, 0xb6, 0x9a, 0x00, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,  //@@.....@@
-  0xf0, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@....+@@
-  0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff,  //@@%..+@@@
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,  //+@@@@@+@@
-  0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x02, 0x8a, 0xea, 0x1e, 0xfa, 0x00, 0x02, 0xa0, 0xca, 0x06, 0xfb, 0x00, 0x02, 0x02,
+  0xb6, 0x9a, 0xf4, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x05, 0x0c, 0xff,
+  0xff, 0xf0, 0xff, 0x20, 0xfe, 0x00, 0x0c, 0x4a, 0xff, 0xff, 0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44,
+  0xd8, 0xff, 0xff, 0x5e, 0xfc, 0xff, 0x0b, 0x7a, 0xff, 0xff, 0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c,
+  0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //.....@%..
-  0x00, 0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,  //@@.....@@
-  0xf0, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@....+@@
-  0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff,  //@@%..+@@@
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,  //+@@@@@+@@
-  0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xeb, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfc, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfb, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x05, 0x0c, 0xff,
+  0xff, 0xf0, 0xff, 0x20, 0xfe, 0x00, 0x0c, 0x4a, 0xff, 0xff, 0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44,
+  0xd8, 0xff, 0xff, 0x5e, 0xfc, 0xff, 0x0b, 0x7a, 0xff, 0xff, 0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c,
+  0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x64, 0xff, 0x64, 0x00, 0x00, 0x00,  //...+@+...
-  0x00, 0x00, 0x18, 0xe8, 0x62, 0xe8, 0x18, 0x00, 0x00,  //...@+@...
-  0x00, 0x00, 0xac, 0x72, 0x00, 0x70, 0xac, 0x00, 0x00,  //..%+.+%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,  //@@.....@@
-  0xf0, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@....+@@
-  0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff,  //@@%..+@@@
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,  //+@@@@@+@@
-  0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xec, 0x00, 0x02, 0x64, 0xff, 0x64, 0xfc, 0x00, 0x04, 0x18, 0xe8, 0x62, 0xe8, 0x18, 0xfd, 0x00,
+  0x04, 0xac, 0x72, 0x00, 0x70, 0xac, 0xf6, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc,
+  0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfd,
+  0x00, 0x05, 0x0c, 0xff, 0xff, 0xf0, 0xff, 0x20, 0xfe, 0x00, 0x0c, 0x4a, 0xff, 0xff, 0xc4, 0xff,
+  0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff, 0x5e, 0xfc, 0xff, 0x0b, 0x7a, 0xff, 0xff, 0x00, 0x6e,
+  0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@...@@.
-  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,  //.@@...@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //@@.....@@
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,  //@@.....@@
-  0xf0, 0xff, 0x20, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff,  //@@....+@@
-  0xc4, 0xff, 0xb0, 0x1e, 0x0a, 0x44, 0xd8, 0xff, 0xff,  //@@%..+@@@
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,  //+@@@@@+@@
-  0x00, 0x6e, 0xdc, 0xf8, 0xd8, 0x6c, 0x00, 0xff, 0xff,  //.+@@@+.@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xee, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00,
+  0x01, 0xff, 0xff, 0xee, 0x00, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff,
+  0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0x05, 0x0c,
+  0xff, 0xff, 0xf0, 0xff, 0x20, 0xfe, 0x00, 0x0c, 0x4a, 0xff, 0xff, 0xc4, 0xff, 0xb0, 0x1e, 0x0a,
+  0x44, 0xd8, 0xff, 0xff, 0x5e, 0xfc, 0xff, 0x0b, 0x7a, 0xff, 0xff, 0x00, 0x6e, 0xdc, 0xf8, 0xd8,
+  0x6c, 0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0xea, 0x8a, 0x00, 0x00,  //.....@%..
-  0x00, 0x00, 0x00, 0x06, 0xca, 0xa0, 0x00, 0x00, 0x00,  //....@%...
-  0x00, 0x00, 0x00, 0x9a, 0xb6, 0x02, 0x00, 0x00, 0x00,  //...%%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xca, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xce,  //@@+...+@@
-  0x60, 0xff, 0xc6, 0x00, 0x00, 0x00, 0xae, 0xff, 0x6e,  //+@@...%@+
-  0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14,  //.@@...@@.
-  0x00, 0x8e, 0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00,  //.%@%.+@%.
-  0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff, 0x50, 0x00,  //..@@.@@+.
-  0x00, 0x00, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0x00,  //..%@%@@..
-  0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00,  //..+@@@%..
-  0x00, 0x00, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0xe4, 0x00, 0x00, 0x00,  //...+@@...
-  0x00, 0x00, 0x00, 0x86, 0xff, 0x92, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xde, 0xff, 0x3e, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x6a, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //..+@@....
-  0x00, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00,  //.@@@+....
-  0x00, 0xff, 0xf4, 0x9c, 0x04, 0x00, 0x00, 0x00, 0x00,  //.@@%.....
-
+  0xeb, 0x00, 0x02, 0x1e, 0xea, 0x8a, 0xfc, 0x00, 0x02, 0x06, 0xca, 0xa0, 0xfb, 0x00, 0x02, 0x9a,
+  0xb6, 0x02, 0xf5, 0x00, 0x02, 0xca, 0xff, 0x5c, 0xfe, 0x00, 0x05, 0x4e, 0xff, 0xce, 0x60, 0xff,
+  0xc6, 0xfe, 0x00, 0x1c, 0xae, 0xff, 0x6e, 0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14,
+  0x00, 0x8e, 0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00, 0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff,
+  0x50, 0xfe, 0x00, 0x05, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0xfe, 0x00, 0x00, 0x50, 0xfe, 0xff,
+  0x00, 0x94, 0xfd, 0x00, 0x04, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x02, 0x7e, 0xff, 0xe4,
+  0xfb, 0x00, 0x02, 0x86, 0xff, 0x92, 0xfb, 0x00, 0x02, 0xde, 0xff, 0x3e, 0xfc, 0x00, 0x02, 0x6a,
+  0xff, 0xe2, 0xfc, 0x00, 0xfe, 0xff, 0x00, 0x7a, 0xfc, 0x00, 0x03, 0xff, 0xf4, 0x9c, 0x04, 0xfd,
+  0x00,
 
   /*Unicode: U+00fe (þ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x08, 0x9c, 0xf0, 0xec, 0xa8, 0x1e, 0x00,  //@@.%@@%..
-  0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x12,  //@@%@@@@@.
-  0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff, 0x8a,  //@@@...@@%
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd6,  //@@+...+@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf6,  //@@.....@@
-  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x44, 0xff, 0xd8,  //@@+...+@@
-  0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8e,  //@@@...@@%
-  0xff, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x16,  //@@%@@@@@.
-  0xff, 0xff, 0x0c, 0xa2, 0xf0, 0xee, 0xaa, 0x20, 0x00,  //@@.%@@%..
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......
-
+  0xef, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa,
+  0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x0b, 0xff, 0xff, 0x08, 0x9c, 0xf0, 0xec, 0xa8, 0x1e, 0x00,
+  0xff, 0xff, 0xa6, 0xfd, 0xff, 0x0d, 0xe2, 0x12, 0xff, 0xff, 0xd8, 0x3a, 0x0a, 0x36, 0xd6, 0xff,
+  0x8a, 0xff, 0xff, 0x46, 0xfe, 0x00, 0x05, 0x44, 0xff, 0xd6, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05,
+  0x0e, 0xff, 0xf6, 0xff, 0xff, 0x0e, 0xfe, 0x00, 0x05, 0x0e, 0xff, 0xf6, 0xff, 0xff, 0x46, 0xfe,
+  0x00, 0x0e, 0x44, 0xff, 0xd8, 0xff, 0xff, 0xd8, 0x38, 0x0a, 0x34, 0xd6, 0xff, 0x8e, 0xff, 0xff,
+  0xa8, 0xfd, 0xff, 0x0c, 0xe6, 0x16, 0xff, 0xff, 0x0c, 0xa2, 0xf0, 0xee, 0xaa, 0x20, 0x00, 0xff,
+  0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xff, 0xff,
+  0xfa, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,  //..@@..@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0xca, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xce,  //@@+...+@@
-  0x60, 0xff, 0xc6, 0x00, 0x00, 0x00, 0xae, 0xff, 0x6e,  //+@@...%@+
-  0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14,  //.@@...@@.
-  0x00, 0x8e, 0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00,  //.%@%.+@%.
-  0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff, 0x50, 0x00,  //..@@.@@+.
-  0x00, 0x00, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0x00,  //..%@%@@..
-  0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0x94, 0x00, 0x00,  //..+@@@%..
-  0x00, 0x00, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0x00, 0x00,  //...@@@...
-  0x00, 0x00, 0x00, 0x7e, 0xff, 0xe4, 0x00, 0x00, 0x00,  //...+@@...
-  0x00, 0x00, 0x00, 0x86, 0xff, 0x92, 0x00, 0x00, 0x00,  //...%@%...
-  0x00, 0x00, 0x00, 0xde, 0xff, 0x3e, 0x00, 0x00, 0x00,  //...@@....
-  0x00, 0x00, 0x6a, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00,  //..+@@....
-  0x00, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00,  //.@@@+....
-  0x00, 0xff, 0xf4, 0x9c, 0x04, 0x00, 0x00, 0x00, 0x00,  //.@@%.....
-
-
+  0xed, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0xee, 0x00, 0x02, 0xca, 0xff, 0x5c, 0xfe, 0x00, 0x05, 0x4e, 0xff, 0xce, 0x60, 0xff,
+  0xc6, 0xfe, 0x00, 0x1c, 0xae, 0xff, 0x6e, 0x08, 0xec, 0xff, 0x30, 0x00, 0x12, 0xf8, 0xfa, 0x14,
+  0x00, 0x8e, 0xff, 0x9a, 0x00, 0x6e, 0xff, 0xb0, 0x00, 0x00, 0x24, 0xfc, 0xf4, 0x0e, 0xcc, 0xff,
+  0x50, 0xfe, 0x00, 0x05, 0xba, 0xff, 0x9c, 0xff, 0xec, 0x04, 0xfe, 0x00, 0x00, 0x50, 0xfe, 0xff,
+  0x00, 0x94, 0xfd, 0x00, 0x04, 0x02, 0xe2, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x02, 0x7e, 0xff, 0xe4,
+  0xfb, 0x00, 0x02, 0x86, 0xff, 0x92, 0xfb, 0x00, 0x02, 0xde, 0xff, 0x3e, 0xfc, 0x00, 0x02, 0x6a,
+  0xff, 0xe2, 0xfc, 0x00, 0xfe, 0xff, 0x00, 0x7a, 0xfc, 0x00, 0x03, 0xff, 0xf4, 0x9c, 0x04, 0xfd,
+  0x00,
 
 #endif
 };
@@ -8859,395 +2219,395 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_latin_sup_20_glyph_dsc[]
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 1
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 2,	.glyph_index = 20},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 7,	.glyph_index = 40},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 9,	.glyph_index = 60},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 8,	.glyph_index = 100},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 10,	.glyph_index = 120},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 160},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 7,	.glyph_index = 180},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 6,	.glyph_index = 200},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 11,	.glyph_index = 220},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 8,	.glyph_index = 260},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 8,	.glyph_index = 280},	/*Unicode: U+00ab («)*/
-  {.w_px = 9,	.glyph_index = 300},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 5,	.glyph_index = 340},	/*Unicode: U+00ad (­)*/
-  {.w_px = 11,	.glyph_index = 360},	/*Unicode: U+00ae (®)*/
-  {.w_px = 5,	.glyph_index = 400},	/*Unicode: U+00af (¯)*/
-  {.w_px = 6,	.glyph_index = 420},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 10,	.glyph_index = 440},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 5,	.glyph_index = 480},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 5,	.glyph_index = 500},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 4,	.glyph_index = 520},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 10,	.glyph_index = 540},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 9,	.glyph_index = 580},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 2,	.glyph_index = 620},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 3,	.glyph_index = 640},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 5,	.glyph_index = 660},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 7,	.glyph_index = 680},	/*Unicode: U+00ba (º)*/
-  {.w_px = 8,	.glyph_index = 700},	/*Unicode: U+00bb (»)*/
-  {.w_px = 10,	.glyph_index = 720},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 10,	.glyph_index = 760},	/*Unicode: U+00bd (½)*/
-  {.w_px = 10,	.glyph_index = 800},	/*Unicode: U+00be (¾)*/
-  {.w_px = 7,	.glyph_index = 840},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 9,	.glyph_index = 860},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 9,	.glyph_index = 900},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 9,	.glyph_index = 940},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 9,	.glyph_index = 980},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 9,	.glyph_index = 1020},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 9,	.glyph_index = 1060},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 11,	.glyph_index = 1100},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 9,	.glyph_index = 1140},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 9,	.glyph_index = 1180},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 9,	.glyph_index = 1220},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 9,	.glyph_index = 1260},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 9,	.glyph_index = 1300},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 8,	.glyph_index = 1340},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 8,	.glyph_index = 1360},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 8,	.glyph_index = 1380},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 8,	.glyph_index = 1400},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 10,	.glyph_index = 1420},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 9,	.glyph_index = 1460},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 9,	.glyph_index = 1500},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 9,	.glyph_index = 1540},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 9,	.glyph_index = 1580},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 9,	.glyph_index = 1620},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 9,	.glyph_index = 1660},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 8,	.glyph_index = 1700},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 11,	.glyph_index = 1720},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 9,	.glyph_index = 1760},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 9,	.glyph_index = 1800},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 9,	.glyph_index = 1840},	/*Unicode: U+00db (Û)*/
-  {.w_px = 9,	.glyph_index = 1880},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 10,	.glyph_index = 1920},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 9,	.glyph_index = 1960},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 9,	.glyph_index = 2000},	/*Unicode: U+00df (ß)*/
-  {.w_px = 9,	.glyph_index = 2040},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 9,	.glyph_index = 2080},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 9,	.glyph_index = 2120},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 9,	.glyph_index = 2160},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 9,	.glyph_index = 2200},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 9,	.glyph_index = 2240},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 9,	.glyph_index = 2280},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 8,	.glyph_index = 2320},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 9,	.glyph_index = 2340},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 9,	.glyph_index = 2380},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 9,	.glyph_index = 2420},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 9,	.glyph_index = 2460},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 8,	.glyph_index = 2500},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 8,	.glyph_index = 2520},	/*Unicode: U+00ed (í)*/
-  {.w_px = 8,	.glyph_index = 2540},	/*Unicode: U+00ee (î)*/
-  {.w_px = 8,	.glyph_index = 2560},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 9,	.glyph_index = 2580},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 9,	.glyph_index = 2620},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 9,	.glyph_index = 2660},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 9,	.glyph_index = 2700},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 9,	.glyph_index = 2740},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 9,	.glyph_index = 2780},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 9,	.glyph_index = 2820},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 10,	.glyph_index = 2860},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 11,	.glyph_index = 2900},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 9,	.glyph_index = 2940},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 9,	.glyph_index = 2980},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 9,	.glyph_index = 3020},	/*Unicode: U+00fb (û)*/
-  {.w_px = 9,	.glyph_index = 3060},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 9,	.glyph_index = 3100},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 9,	.glyph_index = 3140},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 9,	.glyph_index = 3180},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 7,	.glyph_index = 13},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 9,	.glyph_index = 31},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 8,	.glyph_index = 62},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 10,	.glyph_index = 75},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 105},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 7,	.glyph_index = 116},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 6,	.glyph_index = 136},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 11,	.glyph_index = 143},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 8,	.glyph_index = 169},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 8,	.glyph_index = 183},	/*Unicode: U+00ab («)*/
+  {.w_px = 9,	.glyph_index = 196},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 5,	.glyph_index = 209},	/*Unicode: U+00ad (­)*/
+  {.w_px = 11,	.glyph_index = 216},	/*Unicode: U+00ae (®)*/
+  {.w_px = 5,	.glyph_index = 242},	/*Unicode: U+00af (¯)*/
+  {.w_px = 6,	.glyph_index = 249},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 10,	.glyph_index = 260},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 5,	.glyph_index = 285},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 5,	.glyph_index = 297},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 4,	.glyph_index = 309},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 10,	.glyph_index = 317},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 9,	.glyph_index = 348},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 2,	.glyph_index = 383},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 3,	.glyph_index = 389},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 5,	.glyph_index = 396},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 7,	.glyph_index = 406},	/*Unicode: U+00ba (º)*/
+  {.w_px = 8,	.glyph_index = 420},	/*Unicode: U+00bb (»)*/
+  {.w_px = 10,	.glyph_index = 433},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 10,	.glyph_index = 470},	/*Unicode: U+00bd (½)*/
+  {.w_px = 10,	.glyph_index = 507},	/*Unicode: U+00be (¾)*/
+  {.w_px = 7,	.glyph_index = 544},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 9,	.glyph_index = 562},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 9,	.glyph_index = 597},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 9,	.glyph_index = 632},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 9,	.glyph_index = 667},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 9,	.glyph_index = 702},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 9,	.glyph_index = 737},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 11,	.glyph_index = 772},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 9,	.glyph_index = 803},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 9,	.glyph_index = 839},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 9,	.glyph_index = 874},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 9,	.glyph_index = 909},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 9,	.glyph_index = 944},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 8,	.glyph_index = 979},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 8,	.glyph_index = 992},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 8,	.glyph_index = 1005},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 8,	.glyph_index = 1018},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 10,	.glyph_index = 1031},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 9,	.glyph_index = 1061},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 9,	.glyph_index = 1096},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 9,	.glyph_index = 1130},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 9,	.glyph_index = 1164},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 9,	.glyph_index = 1198},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 9,	.glyph_index = 1232},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 8,	.glyph_index = 1266},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 11,	.glyph_index = 1278},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 9,	.glyph_index = 1308},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 9,	.glyph_index = 1342},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 9,	.glyph_index = 1376},	/*Unicode: U+00db (Û)*/
+  {.w_px = 9,	.glyph_index = 1410},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 10,	.glyph_index = 1444},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 9,	.glyph_index = 1478},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 9,	.glyph_index = 1508},	/*Unicode: U+00df (ß)*/
+  {.w_px = 9,	.glyph_index = 1540},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 9,	.glyph_index = 1573},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 9,	.glyph_index = 1606},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 9,	.glyph_index = 1639},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 9,	.glyph_index = 1670},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 9,	.glyph_index = 1701},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 9,	.glyph_index = 1736},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 8,	.glyph_index = 1760},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 9,	.glyph_index = 1776},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 9,	.glyph_index = 1808},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 9,	.glyph_index = 1840},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 9,	.glyph_index = 1872},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 8,	.glyph_index = 1902},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 8,	.glyph_index = 1918},	/*Unicode: U+00ed (í)*/
+  {.w_px = 8,	.glyph_index = 1934},	/*Unicode: U+00ee (î)*/
+  {.w_px = 8,	.glyph_index = 1950},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 9,	.glyph_index = 1966},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 9,	.glyph_index = 1998},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 9,	.glyph_index = 2029},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 9,	.glyph_index = 2061},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 9,	.glyph_index = 2093},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 9,	.glyph_index = 2125},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 9,	.glyph_index = 2155},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 10,	.glyph_index = 2185},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 11,	.glyph_index = 2205},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 9,	.glyph_index = 2229},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 9,	.glyph_index = 2262},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 9,	.glyph_index = 2295},	/*Unicode: U+00fb (û)*/
+  {.w_px = 9,	.glyph_index = 2328},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 9,	.glyph_index = 2359},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 9,	.glyph_index = 2398},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 9,	.glyph_index = 2437},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 2
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 2,	.glyph_index = 40},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 7,	.glyph_index = 60},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 9,	.glyph_index = 100},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 8,	.glyph_index = 160},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 10,	.glyph_index = 200},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 260},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 7,	.glyph_index = 280},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 6,	.glyph_index = 320},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 11,	.glyph_index = 360},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 8,	.glyph_index = 420},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 8,	.glyph_index = 460},	/*Unicode: U+00ab («)*/
-  {.w_px = 9,	.glyph_index = 500},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 5,	.glyph_index = 560},	/*Unicode: U+00ad (­)*/
-  {.w_px = 11,	.glyph_index = 600},	/*Unicode: U+00ae (®)*/
-  {.w_px = 5,	.glyph_index = 660},	/*Unicode: U+00af (¯)*/
-  {.w_px = 6,	.glyph_index = 700},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 10,	.glyph_index = 740},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 5,	.glyph_index = 800},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 5,	.glyph_index = 840},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 4,	.glyph_index = 880},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 10,	.glyph_index = 900},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 9,	.glyph_index = 960},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 2,	.glyph_index = 1020},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 3,	.glyph_index = 1040},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 5,	.glyph_index = 1060},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 7,	.glyph_index = 1100},	/*Unicode: U+00ba (º)*/
-  {.w_px = 8,	.glyph_index = 1140},	/*Unicode: U+00bb (»)*/
-  {.w_px = 10,	.glyph_index = 1180},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 10,	.glyph_index = 1240},	/*Unicode: U+00bd (½)*/
-  {.w_px = 10,	.glyph_index = 1300},	/*Unicode: U+00be (¾)*/
-  {.w_px = 7,	.glyph_index = 1360},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 9,	.glyph_index = 1400},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 9,	.glyph_index = 1460},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 9,	.glyph_index = 1520},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 9,	.glyph_index = 1580},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 9,	.glyph_index = 1640},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 9,	.glyph_index = 1700},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 11,	.glyph_index = 1760},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 9,	.glyph_index = 1820},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 9,	.glyph_index = 1880},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 9,	.glyph_index = 1940},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 9,	.glyph_index = 2000},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 9,	.glyph_index = 2060},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 8,	.glyph_index = 2120},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 8,	.glyph_index = 2160},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 8,	.glyph_index = 2200},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 8,	.glyph_index = 2240},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 10,	.glyph_index = 2280},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 9,	.glyph_index = 2340},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 9,	.glyph_index = 2400},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 9,	.glyph_index = 2460},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 9,	.glyph_index = 2520},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 9,	.glyph_index = 2580},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 9,	.glyph_index = 2640},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 8,	.glyph_index = 2700},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 11,	.glyph_index = 2740},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 9,	.glyph_index = 2800},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 9,	.glyph_index = 2860},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 9,	.glyph_index = 2920},	/*Unicode: U+00db (Û)*/
-  {.w_px = 9,	.glyph_index = 2980},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 10,	.glyph_index = 3040},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 9,	.glyph_index = 3100},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 9,	.glyph_index = 3160},	/*Unicode: U+00df (ß)*/
-  {.w_px = 9,	.glyph_index = 3220},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 9,	.glyph_index = 3280},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 9,	.glyph_index = 3340},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 9,	.glyph_index = 3400},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 9,	.glyph_index = 3460},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 9,	.glyph_index = 3520},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 9,	.glyph_index = 3580},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 8,	.glyph_index = 3640},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 9,	.glyph_index = 3680},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 9,	.glyph_index = 3740},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 9,	.glyph_index = 3800},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 9,	.glyph_index = 3860},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 8,	.glyph_index = 3920},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 8,	.glyph_index = 3960},	/*Unicode: U+00ed (í)*/
-  {.w_px = 8,	.glyph_index = 4000},	/*Unicode: U+00ee (î)*/
-  {.w_px = 8,	.glyph_index = 4040},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 9,	.glyph_index = 4080},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 9,	.glyph_index = 4140},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 9,	.glyph_index = 4200},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 9,	.glyph_index = 4260},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 9,	.glyph_index = 4320},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 9,	.glyph_index = 4380},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 9,	.glyph_index = 4440},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 10,	.glyph_index = 4500},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 11,	.glyph_index = 4560},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 9,	.glyph_index = 4620},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 9,	.glyph_index = 4680},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 9,	.glyph_index = 4740},	/*Unicode: U+00fb (û)*/
-  {.w_px = 9,	.glyph_index = 4800},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 9,	.glyph_index = 4860},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 9,	.glyph_index = 4920},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 9,	.glyph_index = 4980},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 7,	.glyph_index = 13},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 9,	.glyph_index = 49},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 8,	.glyph_index = 92},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 10,	.glyph_index = 113},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 156},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 7,	.glyph_index = 167},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 6,	.glyph_index = 202},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 11,	.glyph_index = 208},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 8,	.glyph_index = 245},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 8,	.glyph_index = 268},	/*Unicode: U+00ab («)*/
+  {.w_px = 9,	.glyph_index = 288},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 5,	.glyph_index = 305},	/*Unicode: U+00ad (­)*/
+  {.w_px = 11,	.glyph_index = 314},	/*Unicode: U+00ae (®)*/
+  {.w_px = 5,	.glyph_index = 351},	/*Unicode: U+00af (¯)*/
+  {.w_px = 6,	.glyph_index = 360},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 10,	.glyph_index = 377},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 5,	.glyph_index = 411},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 5,	.glyph_index = 430},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 4,	.glyph_index = 448},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 10,	.glyph_index = 456},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 9,	.glyph_index = 501},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 2,	.glyph_index = 551},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 3,	.glyph_index = 557},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 5,	.glyph_index = 564},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 7,	.glyph_index = 583},	/*Unicode: U+00ba (º)*/
+  {.w_px = 8,	.glyph_index = 606},	/*Unicode: U+00bb (»)*/
+  {.w_px = 10,	.glyph_index = 626},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 10,	.glyph_index = 679},	/*Unicode: U+00bd (½)*/
+  {.w_px = 10,	.glyph_index = 732},	/*Unicode: U+00be (¾)*/
+  {.w_px = 7,	.glyph_index = 785},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 9,	.glyph_index = 816},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 9,	.glyph_index = 866},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 9,	.glyph_index = 916},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 9,	.glyph_index = 966},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 9,	.glyph_index = 1016},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 9,	.glyph_index = 1066},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 11,	.glyph_index = 1117},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 9,	.glyph_index = 1161},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 9,	.glyph_index = 1213},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 9,	.glyph_index = 1263},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 9,	.glyph_index = 1313},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 9,	.glyph_index = 1363},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 8,	.glyph_index = 1413},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 8,	.glyph_index = 1444},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 8,	.glyph_index = 1475},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 8,	.glyph_index = 1507},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 10,	.glyph_index = 1537},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 9,	.glyph_index = 1580},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 9,	.glyph_index = 1630},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 9,	.glyph_index = 1679},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 9,	.glyph_index = 1728},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 9,	.glyph_index = 1777},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 9,	.glyph_index = 1826},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 8,	.glyph_index = 1875},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 11,	.glyph_index = 1896},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 9,	.glyph_index = 1939},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 9,	.glyph_index = 1988},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 9,	.glyph_index = 2037},	/*Unicode: U+00db (Û)*/
+  {.w_px = 9,	.glyph_index = 2086},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 10,	.glyph_index = 2135},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 9,	.glyph_index = 2184},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 9,	.glyph_index = 2226},	/*Unicode: U+00df (ß)*/
+  {.w_px = 9,	.glyph_index = 2272},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 9,	.glyph_index = 2318},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 9,	.glyph_index = 2363},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 9,	.glyph_index = 2408},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 9,	.glyph_index = 2451},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 9,	.glyph_index = 2494},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 9,	.glyph_index = 2544},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 8,	.glyph_index = 2579},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 9,	.glyph_index = 2610},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 9,	.glyph_index = 2655},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 9,	.glyph_index = 2699},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 9,	.glyph_index = 2743},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 8,	.glyph_index = 2785},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 8,	.glyph_index = 2816},	/*Unicode: U+00ed (í)*/
+  {.w_px = 8,	.glyph_index = 2846},	/*Unicode: U+00ee (î)*/
+  {.w_px = 8,	.glyph_index = 2877},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 9,	.glyph_index = 2904},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 9,	.glyph_index = 2950},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 9,	.glyph_index = 2993},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 9,	.glyph_index = 3038},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 9,	.glyph_index = 3082},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 9,	.glyph_index = 3127},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 9,	.glyph_index = 3169},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 10,	.glyph_index = 3211},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 11,	.glyph_index = 3236},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 9,	.glyph_index = 3270},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 9,	.glyph_index = 3316},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 9,	.glyph_index = 3361},	/*Unicode: U+00fb (û)*/
+  {.w_px = 9,	.glyph_index = 3407},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 9,	.glyph_index = 3450},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 9,	.glyph_index = 3505},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 9,	.glyph_index = 3562},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 4
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 2,	.glyph_index = 60},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 7,	.glyph_index = 80},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 9,	.glyph_index = 160},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 8,	.glyph_index = 260},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 10,	.glyph_index = 340},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 440},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 7,	.glyph_index = 460},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 6,	.glyph_index = 540},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 11,	.glyph_index = 600},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 8,	.glyph_index = 720},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 8,	.glyph_index = 800},	/*Unicode: U+00ab («)*/
-  {.w_px = 9,	.glyph_index = 880},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 5,	.glyph_index = 980},	/*Unicode: U+00ad (­)*/
-  {.w_px = 11,	.glyph_index = 1040},	/*Unicode: U+00ae (®)*/
-  {.w_px = 5,	.glyph_index = 1160},	/*Unicode: U+00af (¯)*/
-  {.w_px = 6,	.glyph_index = 1220},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 10,	.glyph_index = 1280},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 5,	.glyph_index = 1380},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 5,	.glyph_index = 1440},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 4,	.glyph_index = 1500},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 10,	.glyph_index = 1540},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 9,	.glyph_index = 1640},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 2,	.glyph_index = 1740},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 3,	.glyph_index = 1760},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 5,	.glyph_index = 1800},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 7,	.glyph_index = 1860},	/*Unicode: U+00ba (º)*/
-  {.w_px = 8,	.glyph_index = 1940},	/*Unicode: U+00bb (»)*/
-  {.w_px = 10,	.glyph_index = 2020},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 10,	.glyph_index = 2120},	/*Unicode: U+00bd (½)*/
-  {.w_px = 10,	.glyph_index = 2220},	/*Unicode: U+00be (¾)*/
-  {.w_px = 7,	.glyph_index = 2320},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 9,	.glyph_index = 2400},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 9,	.glyph_index = 2500},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 9,	.glyph_index = 2600},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 9,	.glyph_index = 2700},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 9,	.glyph_index = 2800},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 9,	.glyph_index = 2900},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 11,	.glyph_index = 3000},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 9,	.glyph_index = 3120},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 9,	.glyph_index = 3220},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 9,	.glyph_index = 3320},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 9,	.glyph_index = 3420},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 9,	.glyph_index = 3520},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 8,	.glyph_index = 3620},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 8,	.glyph_index = 3700},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 8,	.glyph_index = 3780},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 8,	.glyph_index = 3860},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 10,	.glyph_index = 3940},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 9,	.glyph_index = 4040},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 9,	.glyph_index = 4140},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 9,	.glyph_index = 4240},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 9,	.glyph_index = 4340},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 9,	.glyph_index = 4440},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 9,	.glyph_index = 4540},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 8,	.glyph_index = 4640},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 11,	.glyph_index = 4720},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 9,	.glyph_index = 4840},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 9,	.glyph_index = 4940},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 9,	.glyph_index = 5040},	/*Unicode: U+00db (Û)*/
-  {.w_px = 9,	.glyph_index = 5140},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 10,	.glyph_index = 5240},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 9,	.glyph_index = 5340},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 9,	.glyph_index = 5440},	/*Unicode: U+00df (ß)*/
-  {.w_px = 9,	.glyph_index = 5540},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 9,	.glyph_index = 5640},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 9,	.glyph_index = 5740},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 9,	.glyph_index = 5840},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 9,	.glyph_index = 5940},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 9,	.glyph_index = 6040},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 9,	.glyph_index = 6140},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 8,	.glyph_index = 6240},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 9,	.glyph_index = 6320},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 9,	.glyph_index = 6420},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 9,	.glyph_index = 6520},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 9,	.glyph_index = 6620},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 8,	.glyph_index = 6720},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 8,	.glyph_index = 6800},	/*Unicode: U+00ed (í)*/
-  {.w_px = 8,	.glyph_index = 6880},	/*Unicode: U+00ee (î)*/
-  {.w_px = 8,	.glyph_index = 6960},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 9,	.glyph_index = 7040},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 9,	.glyph_index = 7140},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 9,	.glyph_index = 7240},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 9,	.glyph_index = 7340},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 9,	.glyph_index = 7440},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 9,	.glyph_index = 7540},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 9,	.glyph_index = 7640},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 10,	.glyph_index = 7740},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 11,	.glyph_index = 7840},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 9,	.glyph_index = 7960},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 9,	.glyph_index = 8060},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 9,	.glyph_index = 8160},	/*Unicode: U+00fb (û)*/
-  {.w_px = 9,	.glyph_index = 8260},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 9,	.glyph_index = 8360},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 9,	.glyph_index = 8460},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 9,	.glyph_index = 8560},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 7,	.glyph_index = 15},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 9,	.glyph_index = 81},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 8,	.glyph_index = 143},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 10,	.glyph_index = 180},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 241},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 7,	.glyph_index = 252},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 6,	.glyph_index = 316},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 11,	.glyph_index = 327},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 8,	.glyph_index = 396},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 8,	.glyph_index = 436},	/*Unicode: U+00ab («)*/
+  {.w_px = 9,	.glyph_index = 472},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 5,	.glyph_index = 494},	/*Unicode: U+00ad (­)*/
+  {.w_px = 11,	.glyph_index = 505},	/*Unicode: U+00ae (®)*/
+  {.w_px = 5,	.glyph_index = 574},	/*Unicode: U+00af (¯)*/
+  {.w_px = 6,	.glyph_index = 585},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 10,	.glyph_index = 608},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 5,	.glyph_index = 642},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 5,	.glyph_index = 668},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 4,	.glyph_index = 694},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 10,	.glyph_index = 704},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 9,	.glyph_index = 772},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 2,	.glyph_index = 852},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 3,	.glyph_index = 858},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 5,	.glyph_index = 869},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 7,	.glyph_index = 895},	/*Unicode: U+00ba (º)*/
+  {.w_px = 8,	.glyph_index = 934},	/*Unicode: U+00bb (»)*/
+  {.w_px = 10,	.glyph_index = 970},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 10,	.glyph_index = 1045},	/*Unicode: U+00bd (½)*/
+  {.w_px = 10,	.glyph_index = 1122},	/*Unicode: U+00be (¾)*/
+  {.w_px = 7,	.glyph_index = 1200},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 9,	.glyph_index = 1253},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 9,	.glyph_index = 1330},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 9,	.glyph_index = 1408},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 9,	.glyph_index = 1487},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 9,	.glyph_index = 1566},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 9,	.glyph_index = 1645},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 11,	.glyph_index = 1728},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 9,	.glyph_index = 1810},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 9,	.glyph_index = 1892},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 9,	.glyph_index = 1954},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 9,	.glyph_index = 2017},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 9,	.glyph_index = 2081},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 8,	.glyph_index = 2145},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 8,	.glyph_index = 2197},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 8,	.glyph_index = 2249},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 8,	.glyph_index = 2303},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 10,	.glyph_index = 2357},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 9,	.glyph_index = 2426},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 9,	.glyph_index = 2506},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 9,	.glyph_index = 2582},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 9,	.glyph_index = 2659},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 9,	.glyph_index = 2737},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 9,	.glyph_index = 2815},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 8,	.glyph_index = 2893},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 11,	.glyph_index = 2930},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 9,	.glyph_index = 3016},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 9,	.glyph_index = 3093},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 9,	.glyph_index = 3171},	/*Unicode: U+00db (Û)*/
+  {.w_px = 9,	.glyph_index = 3250},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 10,	.glyph_index = 3329},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 9,	.glyph_index = 3401},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 9,	.glyph_index = 3461},	/*Unicode: U+00df (ß)*/
+  {.w_px = 9,	.glyph_index = 3535},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 9,	.glyph_index = 3604},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 9,	.glyph_index = 3673},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 9,	.glyph_index = 3744},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 9,	.glyph_index = 3810},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 9,	.glyph_index = 3876},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 9,	.glyph_index = 3956},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 8,	.glyph_index = 4011},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 9,	.glyph_index = 4067},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 9,	.glyph_index = 4133},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 9,	.glyph_index = 4199},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 9,	.glyph_index = 4267},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 8,	.glyph_index = 4330},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 8,	.glyph_index = 4382},	/*Unicode: U+00ed (í)*/
+  {.w_px = 8,	.glyph_index = 4433},	/*Unicode: U+00ee (î)*/
+  {.w_px = 8,	.glyph_index = 4486},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 9,	.glyph_index = 4536},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 9,	.glyph_index = 4610},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 9,	.glyph_index = 4676},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 9,	.glyph_index = 4744},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 9,	.glyph_index = 4812},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 9,	.glyph_index = 4882},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 9,	.glyph_index = 4947},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 10,	.glyph_index = 5013},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 11,	.glyph_index = 5035},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 9,	.glyph_index = 5103},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 9,	.glyph_index = 5172},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 9,	.glyph_index = 5241},	/*Unicode: U+00fb (û)*/
+  {.w_px = 9,	.glyph_index = 5312},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 9,	.glyph_index = 5379},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 9,	.glyph_index = 5465},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 9,	.glyph_index = 5549},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20 == 8
   {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 2,	.glyph_index = 120},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 7,	.glyph_index = 160},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 9,	.glyph_index = 300},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 8,	.glyph_index = 480},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 10,	.glyph_index = 640},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 840},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 7,	.glyph_index = 880},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 6,	.glyph_index = 1020},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 11,	.glyph_index = 1140},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 8,	.glyph_index = 1360},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 8,	.glyph_index = 1520},	/*Unicode: U+00ab («)*/
-  {.w_px = 9,	.glyph_index = 1680},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 5,	.glyph_index = 1860},	/*Unicode: U+00ad (­)*/
-  {.w_px = 11,	.glyph_index = 1960},	/*Unicode: U+00ae (®)*/
-  {.w_px = 5,	.glyph_index = 2180},	/*Unicode: U+00af (¯)*/
-  {.w_px = 6,	.glyph_index = 2280},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 10,	.glyph_index = 2400},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 5,	.glyph_index = 2600},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 5,	.glyph_index = 2700},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 4,	.glyph_index = 2800},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 10,	.glyph_index = 2880},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 9,	.glyph_index = 3080},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 2,	.glyph_index = 3260},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 3,	.glyph_index = 3300},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 5,	.glyph_index = 3360},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 7,	.glyph_index = 3460},	/*Unicode: U+00ba (º)*/
-  {.w_px = 8,	.glyph_index = 3600},	/*Unicode: U+00bb (»)*/
-  {.w_px = 10,	.glyph_index = 3760},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 10,	.glyph_index = 3960},	/*Unicode: U+00bd (½)*/
-  {.w_px = 10,	.glyph_index = 4160},	/*Unicode: U+00be (¾)*/
-  {.w_px = 7,	.glyph_index = 4360},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 9,	.glyph_index = 4500},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 9,	.glyph_index = 4680},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 9,	.glyph_index = 4860},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 9,	.glyph_index = 5040},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 9,	.glyph_index = 5220},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 9,	.glyph_index = 5400},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 11,	.glyph_index = 5580},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 9,	.glyph_index = 5800},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 9,	.glyph_index = 5980},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 9,	.glyph_index = 6160},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 9,	.glyph_index = 6340},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 9,	.glyph_index = 6520},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 8,	.glyph_index = 6700},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 8,	.glyph_index = 6860},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 8,	.glyph_index = 7020},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 8,	.glyph_index = 7180},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 10,	.glyph_index = 7340},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 9,	.glyph_index = 7540},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 9,	.glyph_index = 7720},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 9,	.glyph_index = 7900},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 9,	.glyph_index = 8080},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 9,	.glyph_index = 8260},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 9,	.glyph_index = 8440},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 8,	.glyph_index = 8620},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 11,	.glyph_index = 8780},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 9,	.glyph_index = 9000},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 9,	.glyph_index = 9180},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 9,	.glyph_index = 9360},	/*Unicode: U+00db (Û)*/
-  {.w_px = 9,	.glyph_index = 9540},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 10,	.glyph_index = 9720},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 9,	.glyph_index = 9920},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 9,	.glyph_index = 10100},	/*Unicode: U+00df (ß)*/
-  {.w_px = 9,	.glyph_index = 10280},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 9,	.glyph_index = 10460},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 9,	.glyph_index = 10640},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 9,	.glyph_index = 10820},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 9,	.glyph_index = 11000},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 9,	.glyph_index = 11180},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 9,	.glyph_index = 11360},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 8,	.glyph_index = 11540},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 9,	.glyph_index = 11700},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 9,	.glyph_index = 11880},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 9,	.glyph_index = 12060},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 9,	.glyph_index = 12240},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 8,	.glyph_index = 12420},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 8,	.glyph_index = 12580},	/*Unicode: U+00ed (í)*/
-  {.w_px = 8,	.glyph_index = 12740},	/*Unicode: U+00ee (î)*/
-  {.w_px = 8,	.glyph_index = 12900},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 9,	.glyph_index = 13060},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 9,	.glyph_index = 13240},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 9,	.glyph_index = 13420},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 9,	.glyph_index = 13600},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 9,	.glyph_index = 13780},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 9,	.glyph_index = 13960},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 9,	.glyph_index = 14140},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 10,	.glyph_index = 14320},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 11,	.glyph_index = 14520},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 9,	.glyph_index = 14740},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 9,	.glyph_index = 14920},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 9,	.glyph_index = 15100},	/*Unicode: U+00fb (û)*/
-  {.w_px = 9,	.glyph_index = 15280},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 9,	.glyph_index = 15460},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 9,	.glyph_index = 15640},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 9,	.glyph_index = 15820},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 2,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 7,	.glyph_index = 19},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 9,	.glyph_index = 113},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 8,	.glyph_index = 184},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 10,	.glyph_index = 251},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 350},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 7,	.glyph_index = 361},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 6,	.glyph_index = 463},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 11,	.glyph_index = 479},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 8,	.glyph_index = 595},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 8,	.glyph_index = 660},	/*Unicode: U+00ab («)*/
+  {.w_px = 9,	.glyph_index = 726},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 5,	.glyph_index = 742},	/*Unicode: U+00ad (­)*/
+  {.w_px = 11,	.glyph_index = 748},	/*Unicode: U+00ae (®)*/
+  {.w_px = 5,	.glyph_index = 870},	/*Unicode: U+00af (¯)*/
+  {.w_px = 6,	.glyph_index = 876},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 10,	.glyph_index = 917},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 5,	.glyph_index = 957},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 5,	.glyph_index = 995},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 4,	.glyph_index = 1035},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 10,	.glyph_index = 1050},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 9,	.glyph_index = 1161},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 2,	.glyph_index = 1275},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 3,	.glyph_index = 1281},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 5,	.glyph_index = 1294},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 7,	.glyph_index = 1324},	/*Unicode: U+00ba (º)*/
+  {.w_px = 8,	.glyph_index = 1384},	/*Unicode: U+00bb (»)*/
+  {.w_px = 10,	.glyph_index = 1450},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 10,	.glyph_index = 1540},	/*Unicode: U+00bd (½)*/
+  {.w_px = 10,	.glyph_index = 1635},	/*Unicode: U+00be (¾)*/
+  {.w_px = 7,	.glyph_index = 1742},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 9,	.glyph_index = 1821},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 9,	.glyph_index = 1940},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 9,	.glyph_index = 2059},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 9,	.glyph_index = 2181},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 9,	.glyph_index = 2305},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 9,	.glyph_index = 2429},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 11,	.glyph_index = 2549},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 9,	.glyph_index = 2658},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 9,	.glyph_index = 2767},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 9,	.glyph_index = 2817},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 9,	.glyph_index = 2867},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 9,	.glyph_index = 2920},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 8,	.glyph_index = 2977},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 8,	.glyph_index = 3042},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 8,	.glyph_index = 3108},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 8,	.glyph_index = 3179},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 10,	.glyph_index = 3250},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 9,	.glyph_index = 3365},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 9,	.glyph_index = 3481},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 9,	.glyph_index = 3606},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 9,	.glyph_index = 3731},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 9,	.glyph_index = 3859},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 9,	.glyph_index = 3989},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 8,	.glyph_index = 4119},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 11,	.glyph_index = 4184},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 9,	.glyph_index = 4333},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 9,	.glyph_index = 4424},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 9,	.glyph_index = 4515},	/*Unicode: U+00db (Û)*/
+  {.w_px = 9,	.glyph_index = 4609},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 10,	.glyph_index = 4705},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 9,	.glyph_index = 4814},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 9,	.glyph_index = 4900},	/*Unicode: U+00df (ß)*/
+  {.w_px = 9,	.glyph_index = 5022},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 9,	.glyph_index = 5121},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 9,	.glyph_index = 5220},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 9,	.glyph_index = 5326},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 9,	.glyph_index = 5425},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 9,	.glyph_index = 5524},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 9,	.glyph_index = 5645},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 8,	.glyph_index = 5730},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 9,	.glyph_index = 5816},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 9,	.glyph_index = 5910},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 9,	.glyph_index = 6004},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 9,	.glyph_index = 6105},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 8,	.glyph_index = 6199},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 8,	.glyph_index = 6261},	/*Unicode: U+00ed (í)*/
+  {.w_px = 8,	.glyph_index = 6323},	/*Unicode: U+00ee (î)*/
+  {.w_px = 8,	.glyph_index = 6391},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 9,	.glyph_index = 6452},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 9,	.glyph_index = 6577},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 9,	.glyph_index = 6665},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 9,	.glyph_index = 6772},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 9,	.glyph_index = 6879},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 9,	.glyph_index = 6990},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 9,	.glyph_index = 7095},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 10,	.glyph_index = 7203},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 11,	.glyph_index = 7229},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 9,	.glyph_index = 7345},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 9,	.glyph_index = 7430},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 9,	.glyph_index = 7515},	/*Unicode: U+00fb (û)*/
+  {.w_px = 9,	.glyph_index = 7604},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 9,	.glyph_index = 7690},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 9,	.glyph_index = 7819},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 9,	.glyph_index = 7949},	/*Unicode: U+00ff (ÿ)*/
 
 #endif
 };
@@ -9274,6 +2634,7 @@ lv_font_t pros_font_dejavu_mono_latin_sup_20 =
 #endif
     .monospace = 11,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_20*/
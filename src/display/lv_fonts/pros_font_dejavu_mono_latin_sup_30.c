@@ -12,12683 +12,3070 @@ static const uint8_t pros_font_dejavu_mono_latin_sup_30_glyph_bitmap[] =
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 1
   /*Unicode: U+00a0 ( ) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xe3, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfc, 0x00, 0xfe, 0xe0, 0xfe, 0x00, 0xf4, 0xe0, 0xfb, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x07, 0xc0,  //.....%%%%%.
-  0x1f, 0xe0,  //...%%%%%%%%
-  0x39, 0x20,  //..%%%..%..%
-  0x71, 0x00,  //.%%%...%...
-  0xf1, 0x00,  //%%%%...%...
-  0xe1, 0x00,  //%%%....%...
-  0xe1, 0x00,  //%%%....%...
-  0xe1, 0x00,  //%%%....%...
-  0xe1, 0x00,  //%%%....%...
-  0xf1, 0x00,  //%%%%...%...
-  0x71, 0x00,  //.%%%...%...
-  0x39, 0x20,  //..%%%..%..%
-  0x1f, 0xe0,  //...%%%%%%%%
-  0x07, 0xc0,  //.....%%%%%.
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x01, 0x00,  //.......%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x2a, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0xc0, 0x1f, 0xe0, 0x39,
+  0x20, 0x71, 0x00, 0xf1, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0xe1, 0x00, 0xf1, 0x00, 0x71,
+  0x00, 0x39, 0x20, 0x1f, 0xe0, 0x07, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xfc, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x03, 0xf0,  //......%%%%%%.
-  0x07, 0xf8,  //.....%%%%%%%%
-  0x0f, 0x08,  //....%%%%....%
-  0x1e, 0x00,  //...%%%%......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0xff, 0xe0,  //%%%%%%%%%%%..
-  0xff, 0xe0,  //%%%%%%%%%%%..
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0x1c, 0x00,  //...%%%.......
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x25, 0x03, 0xf0, 0x07, 0xf8, 0x0f, 0x08, 0x1e, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+  0x00, 0x1c, 0x00, 0x1c, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+  0x00, 0x1c, 0x00, 0x1c, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xc0, 0x20,  //%%........%
-  0xee, 0xc0,  //%%%.%%%.%%.
-  0x7f, 0xc0,  //.%%%%%%%%%.
-  0x31, 0x80,  //..%%...%%..
-  0x60, 0xc0,  //.%%.....%%.
-  0x60, 0xc0,  //.%%.....%%.
-  0x60, 0xc0,  //.%%.....%%.
-  0x31, 0x80,  //..%%...%%..
-  0x7f, 0xc0,  //.%%%%%%%%%.
-  0x6e, 0xe0,  //.%%.%%%.%%%
-  0xc0, 0x20,  //%%........%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xeb, 0x00, 0x15, 0xc0, 0x20, 0xee, 0xc0, 0x7f, 0xc0, 0x31, 0x80, 0x60, 0xc0, 0x60, 0xc0, 0x60,
+  0xc0, 0x31, 0x80, 0x7f, 0xc0, 0x6e, 0xe0, 0xc0, 0x20, 0xf1, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x38, 0x38,  //..%%%.....%%%..
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1e, 0xf0,  //...%%%%.%%%%...
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x7f, 0xfc,  //.%%%%%%%%%%%%%.
-  0x7f, 0xfc,  //.%%%%%%%%%%%%%.
-  0x07, 0xc0,  //.....%%%%%.....
-  0x03, 0x80,  //......%%%......
-  0x7f, 0xfc,  //.%%%%%%%%%%%%%.
-  0x7f, 0xfc,  //.%%%%%%%%%%%%%.
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0xf0, 0x1e, 0x70, 0x1c, 0x78, 0x3c, 0x38, 0x38, 0x1c, 0x70, 0x1e, 0xf0, 0x0e,
+  0xe0, 0x7f, 0xfc, 0x7f, 0xfc, 0x07, 0xc0, 0x03, 0x80, 0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0xc0,  //%%
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xf7, 0xc0, 0xfe, 0x00, 0xf7, 0xc0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1f, 0x80,  //...%%%%%%..
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x70, 0x40,  //.%%%.....%.
-  0x60, 0x00,  //.%%........
-  0x60, 0x00,  //.%%........
-  0x78, 0x00,  //.%%%%......
-  0x3e, 0x00,  //..%%%%%....
-  0x6f, 0x00,  //.%%.%%%%...
-  0xc3, 0xc0,  //%%....%%%%.
-  0xc0, 0xe0,  //%%......%%%
-  0xc0, 0x60,  //%%.......%%
-  0x70, 0x60,  //.%%%.....%%
-  0x38, 0x60,  //..%%%....%%
-  0x1f, 0xc0,  //...%%%%%%%.
-  0x07, 0x80,  //.....%%%%..
-  0x01, 0xc0,  //.......%%%.
-  0x00, 0xc0,  //........%%.
-  0x00, 0xc0,  //........%%.
-  0x41, 0xc0,  //.%.....%%%.
-  0x7f, 0x80,  //.%%%%%%%%..
-  0x3f, 0x00,  //..%%%%%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x28, 0x1f, 0x80, 0x3f, 0xc0, 0x70, 0x40, 0x60, 0x00, 0x60, 0x00, 0x78, 0x00, 0x3e,
+  0x00, 0x6f, 0x00, 0xc3, 0xc0, 0xc0, 0xe0, 0xc0, 0x60, 0x70, 0x60, 0x38, 0x60, 0x1f, 0xc0, 0x07,
+  0x80, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x41, 0xc0, 0x7f, 0x80, 0x3f, 0xf8, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0xe7,  //%%%..%%%
-  0xe7,  //%%%..%%%
-  0xe7,  //%%%..%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfd, 0x00, 0xfe, 0xe7, 0xea, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x07, 0xe0,  //.....%%%%%%.....
-  0x18, 0x18,  //...%%......%%...
-  0x30, 0x0c,  //..%%........%%..
-  0x63, 0xe6,  //.%%...%%%%%..%%.
-  0x4e, 0x12,  //.%..%%%....%..%.
-  0x8c, 0x01,  //%...%%.........%
-  0x98, 0x01,  //%..%%..........%
-  0x98, 0x01,  //%..%%..........%
-  0x98, 0x01,  //%..%%..........%
-  0x98, 0x01,  //%..%%..........%
-  0x8c, 0x01,  //%...%%.........%
-  0x4e, 0x12,  //.%..%%%....%..%.
-  0x63, 0xe6,  //.%%...%%%%%..%%.
-  0x30, 0x0c,  //..%%........%%..
-  0x18, 0x18,  //...%%......%%...
-  0x07, 0xe0,  //.....%%%%%%.....
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-
+  0xf3, 0x00, 0x1f, 0x07, 0xe0, 0x18, 0x18, 0x30, 0x0c, 0x63, 0xe6, 0x4e, 0x12, 0x8c, 0x01, 0x98,
+  0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x8c, 0x01, 0x4e, 0x12, 0x63, 0xe6, 0x30, 0x0c, 0x18,
+  0x18, 0x07, 0xe0, 0xf3, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x3e, 0x00,  //..%%%%%...
-  0x43, 0x00,  //.%....%%..
-  0x01, 0x80,  //.......%%.
-  0x3f, 0x80,  //..%%%%%%%.
-  0x61, 0x80,  //.%%....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc1, 0x80,  //%%.....%%.
-  0xc3, 0x80,  //%%....%%%.
-  0x67, 0x80,  //.%%..%%%%.
-  0x3d, 0x80,  //..%%%%.%%.
-  0x00, 0x00,  //..........
-  0xff, 0x80,  //%%%%%%%%%.
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x17, 0x3e, 0x00, 0x43, 0x00, 0x01, 0x80, 0x3f, 0x80, 0x61, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc3, 0x80, 0x67, 0x80, 0x3d, 0x80, 0x00, 0x00, 0xff, 0x80, 0xe7, 0x00,
 
   /*Unicode: U+00ab («) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x04, 0x10,  //.....%.....%
-  0x0c, 0x30,  //....%%....%%
-  0x1c, 0x70,  //...%%%...%%%
-  0x38, 0xe0,  //..%%%...%%%.
-  0x71, 0xc0,  //.%%%...%%%..
-  0xe3, 0x80,  //%%%...%%%...
-  0xe3, 0x80,  //%%%...%%%...
-  0x71, 0xc0,  //.%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%.
-  0x1c, 0x70,  //...%%%...%%%
-  0x0c, 0x30,  //....%%....%%
-  0x04, 0x10,  //.....%.....%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xeb, 0x00, 0x17, 0x04, 0x10, 0x0c, 0x30, 0x1c, 0x70, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0x80, 0xe3,
+  0x80, 0x71, 0xc0, 0x38, 0xe0, 0x1c, 0x70, 0x0c, 0x30, 0x04, 0x10, 0xf3, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x18,  //...........%%
-  0x00, 0x18,  //...........%%
-  0x00, 0x18,  //...........%%
-  0x00, 0x18,  //...........%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xe7, 0x00, 0x0b, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0xeb,
+  0x00,
 
   /*Unicode: U+00ad (­) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0xfe,  //%%%%%%%
-  0xfe,  //%%%%%%%
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xf1, 0x00, 0x01, 0xfe, 0xfe, 0xf5, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 16 */
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x07, 0xe0,  //.....%%%%%%.....
-  0x18, 0x18,  //...%%......%%...
-  0x30, 0x0c,  //..%%........%%..
-  0x6f, 0xe6,  //.%%.%%%%%%%..%%.
-  0x4c, 0x32,  //.%..%%....%%..%.
-  0x8c, 0x31,  //%...%%....%%...%
-  0x8c, 0x31,  //%...%%....%%...%
-  0x8f, 0xc1,  //%...%%%%%%.....%
-  0x8c, 0xc1,  //%...%%..%%.....%
-  0x8c, 0x61,  //%...%%...%%....%
-  0x8c, 0x71,  //%...%%...%%%...%
-  0x4c, 0x32,  //.%..%%....%%..%.
-  0x6c, 0x3e,  //.%%.%%....%%%%%.
-  0x30, 0x0c,  //..%%........%%..
-  0x18, 0x18,  //...%%......%%...
-  0x07, 0xe0,  //.....%%%%%%.....
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-  0x00, 0x00,  //................
-
+  0xf3, 0x00, 0x1f, 0x07, 0xe0, 0x18, 0x18, 0x30, 0x0c, 0x6f, 0xe6, 0x4c, 0x32, 0x8c, 0x31, 0x8c,
+  0x31, 0x8f, 0xc1, 0x8c, 0xc1, 0x8c, 0x61, 0x8c, 0x71, 0x4c, 0x32, 0x6c, 0x3e, 0x30, 0x0c, 0x18,
+  0x18, 0x07, 0xe0, 0xf3, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0xff,  //%%%%%%%%
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfc, 0x00, 0x01, 0xff, 0xff, 0xea, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x3c,  //..%%%%..
-  0x7e,  //.%%%%%%.
-  0xe7,  //%%%..%%%
-  0xc3,  //%%....%%
-  0xc3,  //%%....%%
-  0xe7,  //%%%..%%%
-  0x7e,  //.%%%%%%.
-  0x3c,  //..%%%%..
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfc, 0x00, 0x07, 0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e, 0x3c, 0xf0, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x03, 0x00,  //......%%......
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0xff, 0xfc,  //%%%%%%%%%%%%%%
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xef, 0x00, 0x12, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0x03,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xfa, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xfc, 0xf5, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 7 */
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x78,  //.%%%%..
-  0x8c,  //%...%%.
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x06,  //.....%%
-  0x0c,  //....%%.
-  0x1c,  //...%%%.
-  0x38,  //..%%%..
-  0x70,  //.%%%...
-  0xe0,  //%%%....
-  0xfe,  //%%%%%%%
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-  0x00,  //.......
-
+  0xfc, 0x00, 0x01, 0x78, 0x8c, 0xfe, 0x06, 0x05, 0x0c, 0x1c, 0x38, 0x70, 0xe0, 0xfe, 0xf3, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x7c,  //.%%%%%..
-  0x87,  //%....%%%
-  0x03,  //......%%
-  0x07,  //.....%%%
-  0x3c,  //..%%%%..
-  0x06,  //.....%%.
-  0x03,  //......%%
-  0x03,  //......%%
-  0x03,  //......%%
-  0x86,  //%....%%.
-  0x7c,  //.%%%%%..
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfc, 0x00, 0x05, 0x7c, 0x87, 0x03, 0x07, 0x3c, 0x06, 0xfe, 0x03, 0x01, 0x86, 0x7c, 0xf3, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 6 */
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x1c,  //...%%%
-  0x38,  //..%%%.
-  0x30,  //..%%..
-  0x60,  //.%%...
-  0xc0,  //%%....
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-  0x00,  //......
-
+  0xfe, 0x00, 0x04, 0x1c, 0x38, 0x30, 0x60, 0xc0, 0xeb, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xe0, 0xe0,  //%%%.....%%%..
-  0xf1, 0xe0,  //%%%%...%%%%..
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xee, 0x78,  //%%%.%%%..%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0xeb, 0xe0, 0x0e, 0xf1, 0xe0, 0xff, 0xf8, 0xee, 0x78, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x0f, 0xf0,  //....%%%%%%%%
-  0x3f, 0xf0,  //..%%%%%%%%%%
-  0x7f, 0x30,  //.%%%%%%%..%%
-  0xff, 0x30,  //%%%%%%%%..%%
-  0xff, 0x30,  //%%%%%%%%..%%
-  0xff, 0x30,  //%%%%%%%%..%%
-  0xff, 0x30,  //%%%%%%%%..%%
-  0xff, 0x30,  //%%%%%%%%..%%
-  0x7f, 0x30,  //.%%%%%%%..%%
-  0x3f, 0x30,  //..%%%%%%..%%
-  0x0f, 0x30,  //....%%%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x03, 0x30,  //......%%..%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x2b, 0x0f, 0xf0, 0x3f, 0xf0, 0x7f, 0x30, 0xff, 0x30, 0xff, 0x30, 0xff, 0x30, 0xff,
+  0x30, 0xff, 0x30, 0x7f, 0x30, 0x3f, 0x30, 0x0f, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03,
+  0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0xfb,
+  0x00,
 
   /*Unicode: U+00b7 (·) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0xe0,  //%%%
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf4, 0x00, 0xfd, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 5 */
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x00,  //.....
-  0x30,  //..%%.
-  0x18,  //...%%
-  0x18,  //...%%
-  0xf8,  //%%%%%
-  0xf0,  //%%%%.
-  0x00,  //.....
-
+  0xe9, 0x00, 0x05, 0x30, 0x18, 0x18, 0xf8, 0xf0, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 8 */
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x38,  //..%%%...
-  0x98,  //%..%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0x18,  //...%%...
-  0xff,  //%%%%%%%%
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-  0x00,  //........
-
+  0xfc, 0x00, 0x01, 0x38, 0x98, 0xf9, 0x18, 0x00, 0xff, 0xf3, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 9 */
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x3e, 0x00,  //..%%%%%..
-  0x63, 0x00,  //.%%...%%.
-  0x41, 0x00,  //.%.....%.
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0xc1, 0x80,  //%%.....%%
-  0x41, 0x00,  //.%.....%.
-  0x63, 0x00,  //.%%...%%.
-  0x3e, 0x00,  //..%%%%%..
-  0x00, 0x00,  //.........
-  0xff, 0x80,  //%%%%%%%%%
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-  0x00, 0x00,  //.........
-
+  0xf7, 0x00, 0x12, 0x3e, 0x00, 0x63, 0x00, 0x41, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0x41, 0x00, 0x63, 0x00, 0x3e, 0xfe, 0x00, 0x01, 0xff, 0x80, 0xe7, 0x00,
 
   /*Unicode: U+00bb (») , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x82, 0x00,  //%.....%.....
-  0xc3, 0x00,  //%%....%%....
-  0xe3, 0x80,  //%%%...%%%...
-  0x71, 0xc0,  //.%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%.
-  0x1c, 0x70,  //...%%%...%%%
-  0x1c, 0x70,  //...%%%...%%%
-  0x38, 0xe0,  //..%%%...%%%.
-  0x71, 0xc0,  //.%%%...%%%..
-  0xe3, 0x80,  //%%%...%%%...
-  0xc3, 0x00,  //%%....%%....
-  0x82, 0x00,  //%.....%.....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xeb, 0x00, 0x16, 0x82, 0x00, 0xc3, 0x00, 0xe3, 0x80, 0x71, 0xc0, 0x38, 0xe0, 0x1c, 0x70, 0x1c,
+  0x70, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0x80, 0xc3, 0x00, 0x82, 0xf2, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x1c, 0x00,  //...%%%........
-  0x4c, 0x00,  //.%..%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x7f, 0x9c,  //.%%%%%%%%..%%%
-  0x01, 0xf0,  //.......%%%%%..
-  0x3e, 0x00,  //..%%%%%.......
-  0xe0, 0x00,  //%%%...........
-  0x00, 0x30,  //..........%%..
-  0x00, 0x70,  //.........%%%..
-  0x00, 0xf0,  //........%%%%..
-  0x00, 0xb0,  //........%.%%..
-  0x01, 0x30,  //.......%..%%..
-  0x03, 0x30,  //......%%..%%..
-  0x02, 0x30,  //......%...%%..
-  0x06, 0x30,  //.....%%...%%..
-  0x07, 0xf8,  //.....%%%%%%%%.
-  0x00, 0x30,  //..........%%..
-  0x00, 0x30,  //..........%%..
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xfb, 0x00, 0x31, 0x1c, 0x00, 0x4c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7f, 0x9c, 0x01, 0xf0, 0x3e, 0x00, 0xe0, 0x00, 0x00,
+  0x30, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xb0, 0x01, 0x30, 0x03, 0x30, 0x02, 0x30, 0x06, 0x30, 0x07,
+  0xf8, 0x00, 0x30, 0x00, 0x30, 0xfd, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x1c, 0x00,  //...%%%........
-  0x4c, 0x00,  //.%..%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x0c, 0x00,  //....%%........
-  0x7f, 0x9c,  //.%%%%%%%%..%%%
-  0x01, 0xf0,  //.......%%%%%..
-  0x3e, 0x00,  //..%%%%%.......
-  0xe0, 0x00,  //%%%...........
-  0x00, 0xf0,  //........%%%%..
-  0x01, 0x18,  //.......%...%%.
-  0x00, 0x0c,  //............%%
-  0x00, 0x0c,  //............%%
-  0x00, 0x0c,  //............%%
-  0x00, 0x18,  //...........%%.
-  0x00, 0x38,  //..........%%%.
-  0x00, 0x70,  //.........%%%..
-  0x00, 0xe0,  //........%%%...
-  0x01, 0xc0,  //.......%%%....
-  0x01, 0xfc,  //.......%%%%%%%
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xfb, 0x00, 0x31, 0x1c, 0x00, 0x4c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x7f, 0x9c, 0x01, 0xf0, 0x3e, 0x00, 0xe0, 0x00, 0x00,
+  0xf0, 0x01, 0x18, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x38, 0x00, 0x70, 0x00,
+  0xe0, 0x01, 0xc0, 0x01, 0xfc, 0xfd, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 14 */
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-  0x3e, 0x00,  //..%%%%%.......
-  0x43, 0x80,  //.%....%%%.....
-  0x01, 0x80,  //.......%%.....
-  0x03, 0x80,  //......%%%.....
-  0x1e, 0x00,  //...%%%%.......
-  0x03, 0x00,  //......%%......
-  0x01, 0x80,  //.......%%.....
-  0x01, 0x80,  //.......%%.....
-  0x01, 0x80,  //.......%%.....
-  0x43, 0x00,  //.%....%%......
-  0x3e, 0x1c,  //..%%%%%....%%%
-  0x01, 0xf0,  //.......%%%%%..
-  0x3e, 0x00,  //..%%%%%.......
-  0xe0, 0x00,  //%%%...........
-  0x00, 0x30,  //..........%%..
-  0x00, 0x70,  //.........%%%..
-  0x00, 0xf0,  //........%%%%..
-  0x00, 0xb0,  //........%.%%..
-  0x01, 0x30,  //.......%..%%..
-  0x03, 0x30,  //......%%..%%..
-  0x02, 0x30,  //......%...%%..
-  0x06, 0x30,  //.....%%...%%..
-  0x07, 0xf8,  //.....%%%%%%%%.
-  0x00, 0x30,  //..........%%..
-  0x00, 0x30,  //..........%%..
-  0x00, 0x00,  //..............
-  0x00, 0x00,  //..............
-
+  0xfb, 0x00, 0x31, 0x3e, 0x00, 0x43, 0x80, 0x01, 0x80, 0x03, 0x80, 0x1e, 0x00, 0x03, 0x00, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x43, 0x00, 0x3e, 0x1c, 0x01, 0xf0, 0x3e, 0x00, 0xe0, 0x00, 0x00,
+  0x30, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xb0, 0x01, 0x30, 0x03, 0x30, 0x02, 0x30, 0x06, 0x30, 0x07,
+  0xf8, 0x00, 0x30, 0x00, 0x30, 0xfd, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 10 */
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0e, 0x00,  //....%%%...
-  0x0e, 0x00,  //....%%%...
-  0x0e, 0x00,  //....%%%...
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x0e, 0x00,  //....%%%...
-  0x0e, 0x00,  //....%%%...
-  0x0e, 0x00,  //....%%%...
-  0x0e, 0x00,  //....%%%...
-  0x1e, 0x00,  //...%%%%...
-  0x1c, 0x00,  //...%%%....
-  0x3c, 0x00,  //..%%%%....
-  0x78, 0x00,  //.%%%%.....
-  0xf0, 0x00,  //%%%%......
-  0xe0, 0x00,  //%%%.......
-  0xe0, 0x40,  //%%%......%
-  0xf0, 0xc0,  //%%%%....%%
-  0x7f, 0x80,  //.%%%%%%%%.
-  0x1f, 0x00,  //...%%%%%..
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-  0x00, 0x00,  //..........
-
+  0xf7, 0x00, 0x04, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0xfc, 0x00, 0x1a, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xe0, 0x00, 0xe0,
+  0x40, 0xf0, 0xc0, 0x7f, 0x80, 0x1f, 0xf4, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 15 */
-  0x0e, 0x00,  //....%%%........
-  0x07, 0x00,  //.....%%%.......
-  0x03, 0x80,  //......%%%......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x05, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0,
+  0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+  0x38, 0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e,
+  0xf5, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 15 */
-  0x01, 0x80,  //.......%%......
-  0x03, 0x80,  //......%%%......
-  0x07, 0x00,  //.....%%%.......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x04, 0x01, 0x80, 0x03, 0x80, 0x07, 0xfc, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0, 0x07,
+  0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38,
+  0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e, 0xf5,
+  0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 15 */
-  0x03, 0x80,  //......%%%......
-  0x06, 0xc0,  //.....%%.%%.....
-  0x0c, 0x60,  //....%%...%%....
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x05, 0x03, 0x80, 0x06, 0xc0, 0x0c, 0x60, 0xfd, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0,
+  0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+  0x38, 0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e,
+  0xf5, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 15 */
-  0x07, 0x60,  //.....%%%.%%....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0d, 0xc0,  //....%%.%%%.....
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x05, 0x07, 0x60, 0x0f, 0xe0, 0x0d, 0xc0, 0xfd, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0,
+  0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+  0x38, 0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e,
+  0xf5, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 15 */
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x38, 0x38,  //..%%%.....%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x05, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0xfd, 0x00, 0x25, 0x03, 0x80, 0x07, 0xc0, 0x07, 0xc0,
+  0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
+  0x38, 0x38, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0xf0, 0x1e, 0xe0, 0x0e,
+  0xf5, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 15 */
-  0x03, 0x80,  //......%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0c, 0x60,  //....%%...%%....
-  0x0c, 0x60,  //....%%...%%....
-  0x0c, 0x60,  //....%%...%%....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x03, 0x80,  //......%%%......
-  0x07, 0x80,  //.....%%%%......
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x0f, 0xc0,  //....%%%%%%.....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1e, 0xe0,  //...%%%%.%%%....
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1c, 0x70,  //...%%%...%%%...
-  0x3c, 0x70,  //..%%%%...%%%...
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x3f, 0xf8,  //..%%%%%%%%%%%..
-  0x38, 0x38,  //..%%%.....%%%..
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x70, 0x1c,  //.%%%.......%%%.
-  0xe0, 0x0e,  //%%%.........%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x2f, 0x03, 0x80, 0x07, 0xc0, 0x0c, 0x60, 0x0c, 0x60, 0x0c, 0x60, 0x07, 0xc0, 0x03, 0x80, 0x07,
+  0x80, 0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xc0, 0x0f, 0xe0, 0x0e, 0xe0, 0x1e, 0xe0, 0x1c, 0x70, 0x1c,
+  0x70, 0x3c, 0x70, 0x3f, 0xf8, 0x3f, 0xf8, 0x38, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0xe0,
+  0x0e, 0xf5, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x07, 0xfe,  //.....%%%%%%%%%%
-  0x07, 0xfe,  //.....%%%%%%%%%%
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x1c, 0xe0,  //...%%%..%%%....
-  0x1c, 0xe0,  //...%%%..%%%....
-  0x1c, 0xfc,  //...%%%..%%%%%%.
-  0x1c, 0xfc,  //...%%%..%%%%%%.
-  0x38, 0xe0,  //..%%%...%%%....
-  0x38, 0xe0,  //..%%%...%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%....
-  0x7f, 0xe0,  //.%%%%%%%%%%....
-  0x70, 0xe0,  //.%%%....%%%....
-  0x70, 0xe0,  //.%%%....%%%....
-  0x70, 0xe0,  //.%%%....%%%....
-  0xf0, 0xfe,  //%%%%....%%%%%%%
-  0xe0, 0xfe,  //%%%.....%%%%%%%
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x25, 0x07, 0xfe, 0x07, 0xfe, 0x0f, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c,
+  0xe0, 0x1c, 0xe0, 0x1c, 0xfc, 0x1c, 0xfc, 0x38, 0xe0, 0x38, 0xe0, 0x3f, 0xe0, 0x7f, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xfe, 0xe0, 0xfe, 0xf5, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x07, 0xe0,  //.....%%%%%%.
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x3c, 0x30,  //..%%%%....%%
-  0x78, 0x10,  //.%%%%......%
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x70, 0x00,  //.%%%........
-  0x70, 0x00,  //.%%%........
-  0x78, 0x10,  //.%%%%......%
-  0x3c, 0x30,  //..%%%%....%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x07, 0xe0,  //.....%%%%%%.
-  0x01, 0x80,  //.......%%...
-  0x00, 0xc0,  //........%%..
-  0x00, 0xc0,  //........%%..
-  0x07, 0xc0,  //.....%%%%%..
-  0x07, 0x80,  //.....%%%%...
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x31, 0x07, 0xe0, 0x1f, 0xf0, 0x3c, 0x30, 0x78, 0x10, 0x70, 0x00, 0x70, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70,
+  0x00, 0x78, 0x10, 0x3c, 0x30, 0x1f, 0xf0, 0x07, 0xe0, 0x01, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x07,
+  0xc0, 0x07, 0x80, 0x00, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 12 */
-  0x0e, 0x00,  //....%%%.....
-  0x07, 0x00,  //.....%%%....
-  0x03, 0x80,  //......%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x25, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+  0xf5, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 12 */
-  0x01, 0x80,  //.......%%...
-  0x03, 0x80,  //......%%%...
-  0x07, 0x00,  //.....%%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x04, 0x01, 0x80, 0x03, 0x80, 0x07, 0xfc, 0x00, 0x25, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xf5,
+  0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 12 */
-  0x07, 0x80,  //.....%%%%...
-  0x0c, 0xc0,  //....%%..%%..
-  0x18, 0x60,  //...%%....%%.
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x07, 0x80, 0x0c, 0xc0, 0x18, 0x60, 0xfd, 0x00, 0x25, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+  0xf5, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 12 */
-  0x1c, 0xe0,  //...%%%..%%%.
-  0x1c, 0xe0,  //...%%%..%%%.
-  0x1c, 0xe0,  //...%%%..%%%.
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0xff, 0xf0,  //%%%%%%%%%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0xfd, 0x00, 0x25, 0xff, 0xf0, 0xff, 0xf0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+  0xf5, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 11 */
-  0x38, 0x00,  //..%%%......
-  0x1c, 0x00,  //...%%%.....
-  0x0e, 0x00,  //....%%%....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0x04, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0xfc, 0x00, 0x25, 0xff, 0xe0, 0xff, 0xe0, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf5,
+  0x00,
 
   /*Unicode: U+00cd (Í) , Width: 11 */
-  0x06, 0x00,  //.....%%....
-  0x0e, 0x00,  //....%%%....
-  0x1c, 0x00,  //...%%%.....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0x04, 0x06, 0x00, 0x0e, 0x00, 0x1c, 0xfc, 0x00, 0x25, 0xff, 0xe0, 0xff, 0xe0, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
+  0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xf5,
+  0x00,
 
   /*Unicode: U+00ce (Î) , Width: 11 */
-  0x0e, 0x00,  //....%%%....
-  0x1b, 0x00,  //...%%.%%...
-  0x31, 0x80,  //..%%...%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0x05, 0x0e, 0x00, 0x1b, 0x00, 0x31, 0x80, 0xfd, 0x00, 0x25, 0xff, 0xe0, 0xff, 0xe0, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0,
+  0xf5, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 11 */
-  0x3b, 0x80,  //..%%%.%%%..
-  0x3b, 0x80,  //..%%%.%%%..
-  0x3b, 0x80,  //..%%%.%%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0xff, 0xe0,  //%%%%%%%%%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0x05, 0x3b, 0x80, 0x3b, 0x80, 0x3b, 0x80, 0xfd, 0x00, 0x25, 0xff, 0xe0, 0xff, 0xe0, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0,
+  0xf5, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0xc0,  //.%%%%%%%%%...
-  0x70, 0xe0,  //.%%%....%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0xfe, 0x38,  //%%%%%%%...%%%
-  0xfe, 0x38,  //%%%%%%%...%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x38,  //.%%%......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0xe0,  //.%%%....%%%..
-  0x7f, 0xc0,  //.%%%%%%%%%...
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf7, 0x00, 0x05, 0x7f, 0x00, 0x7f, 0xc0, 0x70, 0xe0, 0xfc, 0x70, 0x10, 0x38, 0x70, 0x38, 0x70,
+  0x38, 0xfe, 0x38, 0xfe, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0xfc, 0x70, 0x03,
+  0xe0, 0x7f, 0xc0, 0x7f, 0xf4, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 12 */
-  0x1c, 0xc0,  //...%%%..%%..
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x33, 0x80,  //..%%..%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xf0, 0x70,  //%%%%.....%%%
-  0xf0, 0x70,  //%%%%.....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xf8, 0x70,  //%%%%%....%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xec, 0x70,  //%%%.%%...%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe6, 0x70,  //%%%..%%..%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe3, 0x70,  //%%%...%%.%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe1, 0xf0,  //%%%....%%%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x1c, 0xc0, 0x3f, 0xc0, 0x33, 0x80, 0xfd, 0x00, 0x25, 0xf0, 0x70, 0xf0, 0x70, 0xf8, 0x70,
+  0xf8, 0x70, 0xf8, 0x70, 0xec, 0x70, 0xec, 0x70, 0xec, 0x70, 0xe6, 0x70, 0xe6, 0x70, 0xe6, 0x70,
+  0xe3, 0x70, 0xe3, 0x70, 0xe3, 0x70, 0xe1, 0xf0, 0xe1, 0xf0, 0xe1, 0xf0, 0xe0, 0xf0, 0xe0, 0xf0,
+  0xf5, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 13 */
-  0x0e, 0x00,  //....%%%......
-  0x07, 0x00,  //.....%%%.....
-  0x03, 0x80,  //......%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0x05, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0,
+  0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,
+  0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70, 0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 13 */
-  0x01, 0x80,  //.......%%....
-  0x03, 0x80,  //......%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0x04, 0x01, 0x80, 0x03, 0x80, 0x07, 0xfc, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0, 0xfd,
+  0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38,
+  0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70, 0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 13 */
-  0x07, 0x00,  //.....%%%.....
-  0x0d, 0x80,  //....%%.%%....
-  0x18, 0xc0,  //...%%...%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0x05, 0x07, 0x00, 0x0d, 0x80, 0x18, 0xc0, 0xfd, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0,
+  0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,
+  0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70, 0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 13 */
-  0x0e, 0xc0,  //....%%%.%%...
-  0x1f, 0xc0,  //...%%%%%%%...
-  0x1b, 0x80,  //...%%.%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0x05, 0x0e, 0xc0, 0x1f, 0xc0, 0x1b, 0x80, 0xfd, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0,
+  0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,
+  0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70, 0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 13 */
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x0f, 0x80,  //....%%%%%....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0x05, 0x1d, 0xc0, 0x1d, 0xc0, 0x1d, 0xc0, 0xfd, 0x00, 0x05, 0x0f, 0x80, 0x3f, 0xe0, 0x38, 0xe0,
+  0xfd, 0x70, 0x11, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,
+  0x38, 0xe0, 0x38, 0xe0, 0x38, 0xfd, 0x70, 0x05, 0x38, 0xe0, 0x3f, 0xe0, 0x0f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x40, 0x20,  //.%........%.
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x39, 0xc0,  //..%%%..%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x0f, 0x00,  //....%%%%....
-  0x0f, 0x00,  //....%%%%....
-  0x1f, 0x80,  //...%%%%%%...
-  0x39, 0xc0,  //..%%%..%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0x40, 0x20,  //.%........%.
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xed, 0x00, 0x17, 0x40, 0x20, 0xe0, 0x70, 0x70, 0xe0, 0x39, 0xc0, 0x1f, 0x80, 0x0f, 0x00, 0x0f,
+  0x00, 0x1f, 0x80, 0x39, 0xc0, 0x70, 0xe0, 0xe0, 0x70, 0x40, 0x20, 0xf1, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x07, 0xc6,  //.....%%%%%...%%
-  0x1f, 0xec,  //...%%%%%%%%.%%.
-  0x1c, 0x78,  //...%%%...%%%%..
-  0x38, 0x38,  //..%%%.....%%%..
-  0x38, 0x38,  //..%%%.....%%%..
-  0x70, 0x7c,  //.%%%.....%%%%%.
-  0x70, 0x7c,  //.%%%.....%%%%%.
-  0x70, 0xdc,  //.%%%....%%.%%%.
-  0x71, 0x9c,  //.%%%...%%..%%%.
-  0x73, 0x1c,  //.%%%..%%...%%%.
-  0x73, 0x1c,  //.%%%..%%...%%%.
-  0x76, 0x1c,  //.%%%.%%....%%%.
-  0x7c, 0x1c,  //.%%%%%.....%%%.
-  0x7c, 0x1c,  //.%%%%%.....%%%.
-  0x38, 0x38,  //..%%%.....%%%..
-  0x38, 0x38,  //..%%%.....%%%..
-  0x7c, 0x70,  //.%%%%%...%%%...
-  0x7f, 0xf0,  //.%%%%%%%%%%%...
-  0xc7, 0xc0,  //%%...%%%%%.....
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xf7, 0x00, 0x05, 0x07, 0xc6, 0x1f, 0xec, 0x1c, 0x78, 0xfd, 0x38, 0x11, 0x70, 0x7c, 0x70, 0x7c,
+  0x70, 0xdc, 0x71, 0x9c, 0x73, 0x1c, 0x73, 0x1c, 0x76, 0x1c, 0x7c, 0x1c, 0x7c, 0x1c, 0xfd, 0x38,
+  0x05, 0x7c, 0x70, 0x7f, 0xf0, 0xc7, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 12 */
-  0x0e, 0x00,  //....%%%.....
-  0x07, 0x00,  //.....%%%....
-  0x03, 0x80,  //......%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80,
+  0xf5, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 12 */
-  0x01, 0x80,  //.......%%...
-  0x03, 0x80,  //......%%%...
-  0x07, 0x00,  //.....%%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x04, 0x01, 0x80, 0x03, 0x80, 0x07, 0xfc, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5,
+  0x00,
 
   /*Unicode: U+00db (Û) , Width: 12 */
-  0x0f, 0x00,  //....%%%%....
-  0x19, 0x80,  //...%%..%%...
-  0x30, 0xc0,  //..%%....%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x0f, 0x00, 0x19, 0x80, 0x30, 0xc0, 0xfd, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80,
+  0xf5, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 12 */
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x05, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0xfd, 0x00, 0x25, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80,
+  0xf5, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 15 */
-  0x01, 0x80,  //.......%%......
-  0x03, 0x80,  //......%%%......
-  0x07, 0x00,  //.....%%%.......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0xf0, 0x1e,  //%%%%.......%%%%
-  0x70, 0x1c,  //.%%%.......%%%.
-  0x78, 0x3c,  //.%%%%.....%%%%.
-  0x38, 0x38,  //..%%%.....%%%..
-  0x1c, 0x70,  //...%%%...%%%...
-  0x1e, 0xf0,  //...%%%%.%%%%...
-  0x0e, 0xe0,  //....%%%.%%%....
-  0x0f, 0xe0,  //....%%%%%%%....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x07, 0xc0,  //.....%%%%%.....
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x03, 0x80,  //......%%%......
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0x04, 0x01, 0x80, 0x03, 0x80, 0x07, 0xfc, 0x00, 0x25, 0xf0, 0x1e, 0x70, 0x1c, 0x78, 0x3c, 0x38,
+  0x38, 0x1c, 0x70, 0x1e, 0xf0, 0x0e, 0xe0, 0x0f, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xf5,
+  0x00,
 
   /*Unicode: U+00de (Þ) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xff, 0x80,  //%%%%%%%%%...
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xff, 0xe0,  //%%%%%%%%%%%.
-  0xff, 0x80,  //%%%%%%%%%...
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x08, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xff, 0x80, 0xff, 0xfd, 0xe0, 0x17, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0xff, 0xe0, 0xff, 0x80, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0xf4, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x3e, 0x00,  //..%%%%%.....
-  0x7f, 0x80,  //.%%%%%%%%...
-  0x73, 0x80,  //.%%%..%%%...
-  0xe1, 0xc0,  //%%%....%%%..
-  0xe1, 0xc0,  //%%%....%%%..
-  0xe3, 0xc0,  //%%%...%%%%..
-  0xe7, 0x00,  //%%%..%%%....
-  0xee, 0x00,  //%%%.%%%.....
-  0xee, 0x00,  //%%%.%%%.....
-  0xee, 0x00,  //%%%.%%%.....
-  0xe6, 0x00,  //%%%..%%.....
-  0xe3, 0x80,  //%%%...%%%...
-  0xe1, 0xc0,  //%%%....%%%..
-  0xe0, 0xe0,  //%%%.....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe8, 0xf0,  //%%%.%...%%%%
-  0xef, 0xe0,  //%%%.%%%%%%%.
-  0xe7, 0xc0,  //%%%..%%%%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x19, 0x3e, 0x00, 0x7f, 0x80, 0x73, 0x80, 0xe1, 0xc0, 0xe1, 0xc0, 0xe3, 0xc0, 0xe7,
+  0x00, 0xee, 0x00, 0xee, 0x00, 0xee, 0x00, 0xe6, 0x00, 0xe3, 0x80, 0xe1, 0xc0, 0xfe, 0xe0, 0x0a,
+  0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe8, 0xf0, 0xef, 0xe0, 0xe7, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x38, 0x00,  //..%%%.......
-  0x1c, 0x00,  //...%%%......
-  0x0c, 0x00,  //....%%......
-  0x06, 0x00,  //.....%%.....
-  0x03, 0x00,  //......%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x08, 0x38, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0xfc, 0x00, 0x1b, 0x1f,
+  0x80, 0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f, 0xf0, 0x70, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x01, 0xc0,  //.......%%%..
-  0x03, 0x80,  //......%%%...
-  0x03, 0x00,  //......%%....
-  0x06, 0x00,  //.....%%.....
-  0x0c, 0x00,  //....%%......
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x08, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0xfc, 0x00, 0x1b, 0x1f,
+  0x80, 0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f, 0xf0, 0x70, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x06, 0x00,  //.....%%.....
-  0x0f, 0x00,  //....%%%%....
-  0x09, 0x00,  //....%..%....
-  0x19, 0x80,  //...%%..%%...
-  0x30, 0xc0,  //..%%....%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x09, 0x06, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x19, 0x80, 0x30, 0xc0, 0xfd, 0x00, 0x1b,
+  0x1f, 0x80, 0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f, 0xf0, 0x70, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1c, 0xc0,  //...%%%..%%..
-  0x3c, 0xc0,  //..%%%%..%%..
-  0x33, 0xc0,  //..%%..%%%%..
-  0x33, 0x80,  //..%%..%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x07, 0x1c, 0xc0, 0x3c, 0xc0, 0x33, 0xc0, 0x33, 0x80, 0xfd, 0x00, 0x1b, 0x1f, 0x80,
+  0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f, 0xf0, 0x70, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x05, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0xfb, 0x00, 0x1b, 0x1f, 0x80, 0x7f, 0xe0,
+  0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f, 0xf0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 12 */
-  0x00, 0x00,  //............
-  0x0e, 0x00,  //....%%%.....
-  0x1f, 0x00,  //...%%%%%....
-  0x31, 0x80,  //..%%...%%...
-  0x31, 0x80,  //..%%...%%...
-  0x31, 0x80,  //..%%...%%...
-  0x1f, 0x00,  //...%%%%%....
-  0x0e, 0x00,  //....%%%.....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x7f, 0xe0,  //.%%%%%%%%%%.
-  0x60, 0xe0,  //.%%.....%%%.
-  0x00, 0x70,  //.........%%%
-  0x00, 0x70,  //.........%%%
-  0x1f, 0xf0,  //...%%%%%%%%%
-  0x7f, 0xf0,  //.%%%%%%%%%%%
-  0x70, 0x70,  //.%%%.....%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0xf0,  //%%%.....%%%%
-  0xf1, 0xf0,  //%%%%...%%%%%
-  0x7f, 0x70,  //.%%%%%%%.%%%
-  0x3e, 0x70,  //..%%%%%..%%%
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0x0e, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x1f, 0x00, 0x0e,
+  0xfc, 0x00, 0x1b, 0x1f, 0x80, 0x7f, 0xe0, 0x60, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x1f, 0xf0, 0x7f,
+  0xf0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0xf0, 0xf1, 0xf0, 0x7f, 0x70, 0x3e, 0x70, 0xf5,
+  0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x3e, 0x38,  //..%%%%%...%%%..
-  0x7f, 0xfc,  //.%%%%%%%%%%%%%.
-  0x43, 0xce,  //.%....%%%%..%%%
-  0x01, 0xce,  //.......%%%..%%%
-  0x01, 0xce,  //.......%%%..%%%
-  0x01, 0xce,  //.......%%%..%%%
-  0x1f, 0xfe,  //...%%%%%%%%%%%%
-  0x7f, 0xfe,  //.%%%%%%%%%%%%%%
-  0xf1, 0xc0,  //%%%%...%%%.....
-  0xe1, 0xc0,  //%%%....%%%.....
-  0xe1, 0xc0,  //%%%....%%%.....
-  0xf3, 0xe2,  //%%%%..%%%%%...%
-  0x7f, 0x7e,  //.%%%%%%%.%%%%%%
-  0x3e, 0x3c,  //..%%%%%...%%%%.
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x1b, 0x3e, 0x38, 0x7f, 0xfc, 0x43, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x1f,
+  0xfe, 0x7f, 0xfe, 0xf1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xf3, 0xe2, 0x7f, 0x7e, 0x3e, 0x3c, 0xf5,
+  0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x0f, 0x80,  //....%%%%%..
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x78, 0x60,  //.%%%%....%%
-  0x70, 0x00,  //.%%%.......
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0xe0, 0x00,  //%%%........
-  0x70, 0x00,  //.%%%.......
-  0x78, 0x60,  //.%%%%....%%
-  0x3f, 0xc0,  //..%%%%%%%%.
-  0x0f, 0x80,  //....%%%%%..
-  0x03, 0x00,  //......%%...
-  0x01, 0x80,  //.......%%..
-  0x01, 0x80,  //.......%%..
-  0x0f, 0x80,  //....%%%%%..
-  0x0f, 0x00,  //....%%%%...
-  0x00, 0x00,  //...........
-
+  0xed, 0x00, 0x24, 0x0f, 0x80, 0x3f, 0xc0, 0x78, 0x60, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x60, 0x3f, 0xc0, 0x0f, 0x80, 0x03,
+  0x00, 0x01, 0x80, 0x01, 0x80, 0x0f, 0x80, 0x0f, 0xfe, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x38, 0x00,  //..%%%........
-  0x1c, 0x00,  //...%%%.......
-  0x0c, 0x00,  //....%%.......
-  0x06, 0x00,  //.....%%......
-  0x03, 0x00,  //......%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x78, 0x30,  //.%%%%.....%%.
-  0x3f, 0xf0,  //..%%%%%%%%%%.
-  0x0f, 0xc0,  //....%%%%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x08, 0x38, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0xfc, 0x00, 0x1b, 0x0f,
+  0x80, 0x3f, 0xe0, 0x78, 0xf0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0xe0,
+  0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x30, 0x3f, 0xf0, 0x0f, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x01, 0xc0,  //.......%%%...
-  0x03, 0x80,  //......%%%....
-  0x03, 0x00,  //......%%.....
-  0x06, 0x00,  //.....%%......
-  0x0c, 0x00,  //....%%.......
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x78, 0x30,  //.%%%%.....%%.
-  0x3f, 0xf0,  //..%%%%%%%%%%.
-  0x0f, 0xc0,  //....%%%%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x08, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0xfc, 0x00, 0x1b, 0x0f,
+  0x80, 0x3f, 0xe0, 0x78, 0xf0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0xe0,
+  0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x30, 0x3f, 0xf0, 0x0f, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x06, 0x00,  //.....%%......
-  0x0f, 0x00,  //....%%%%.....
-  0x09, 0x00,  //....%..%.....
-  0x19, 0x80,  //...%%..%%....
-  0x30, 0xc0,  //..%%....%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x78, 0x30,  //.%%%%.....%%.
-  0x3f, 0xf0,  //..%%%%%%%%%%.
-  0x0f, 0xc0,  //....%%%%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x09, 0x06, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x19, 0x80, 0x30, 0xc0, 0xfd, 0x00, 0x1b,
+  0x0f, 0x80, 0x3f, 0xe0, 0x78, 0xf0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8,
+  0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x78, 0x30, 0x3f, 0xf0, 0x0f, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x39, 0xc0,  //..%%%..%%%...
-  0x39, 0xc0,  //..%%%..%%%...
-  0x39, 0xc0,  //..%%%..%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x0f, 0x80,  //....%%%%%....
-  0x3f, 0xe0,  //..%%%%%%%%%..
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0xe0, 0x38,  //%%%.......%%%
-  0xe0, 0x38,  //%%%.......%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xe0, 0x00,  //%%%..........
-  0xe0, 0x00,  //%%%..........
-  0x70, 0x00,  //.%%%.........
-  0x78, 0x30,  //.%%%%.....%%.
-  0x3f, 0xf0,  //..%%%%%%%%%%.
-  0x0f, 0xc0,  //....%%%%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf9, 0x00, 0x05, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0xfb, 0x00, 0x1b, 0x0f, 0x80, 0x3f, 0xe0,
+  0x78, 0xf0, 0x70, 0x70, 0xe0, 0x38, 0xe0, 0x38, 0xff, 0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xe0, 0x00,
+  0x70, 0x00, 0x78, 0x30, 0x3f, 0xf0, 0x0f, 0xc0, 0xf5, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x38, 0x00,  //..%%%........
-  0x1c, 0x00,  //...%%%.......
-  0x0c, 0x00,  //....%%.......
-  0x06, 0x00,  //.....%%......
-  0x03, 0x00,  //......%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x08, 0x38, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0xfc, 0x00, 0x1b, 0x7f,
+  0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x01, 0xc0,  //.......%%%...
-  0x03, 0x80,  //......%%%....
-  0x03, 0x00,  //......%%.....
-  0x06, 0x00,  //.....%%......
-  0x0c, 0x00,  //....%%.......
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x08, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0xfc, 0x00, 0x1b, 0x7f,
+  0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07,
+  0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x06, 0x00,  //.....%%......
-  0x0f, 0x00,  //....%%%%.....
-  0x09, 0x00,  //....%..%.....
-  0x19, 0x80,  //...%%..%%....
-  0x30, 0xc0,  //..%%....%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x09, 0x06, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x19, 0x80, 0x30, 0xc0, 0xfd, 0x00, 0x1b,
+  0x7f, 0x00, 0x7f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x7f, 0x00,  //.%%%%%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xf9, 0x00, 0x05, 0x1d, 0xc0, 0x1d, 0xc0, 0x1d, 0xc0, 0xfb, 0x00, 0x1b, 0x7f, 0x00, 0x7f, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x07, 0x00, 0x07, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xf5, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x38, 0x00,  //..%%%.......
-  0x3d, 0xc0,  //..%%%%.%%%..
-  0x1f, 0x00,  //...%%%%%....
-  0x3f, 0x00,  //..%%%%%%....
-  0x2f, 0x00,  //..%.%%%%....
-  0x07, 0x80,  //.....%%%%...
-  0x1f, 0xc0,  //...%%%%%%%..
-  0x3f, 0xe0,  //..%%%%%%%%%.
-  0x78, 0xe0,  //.%%%%...%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x79, 0xe0,  //.%%%%..%%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x27, 0x38, 0x00, 0x3d, 0xc0, 0x1f, 0x00, 0x3f, 0x00, 0x2f, 0x00, 0x07, 0x80, 0x1f,
+  0xc0, 0x3f, 0xe0, 0x78, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0x70, 0xe0, 0x79, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x1c, 0xc0,  //...%%%..%%.
-  0x3c, 0xc0,  //..%%%%..%%.
-  0x33, 0xc0,  //..%%..%%%%.
-  0x33, 0x80,  //..%%..%%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe7, 0x80,  //%%%..%%%%..
-  0xef, 0xc0,  //%%%.%%%%%%.
-  0xf1, 0xe0,  //%%%%...%%%%
-  0xf0, 0xe0,  //%%%%....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x07, 0x1c, 0xc0, 0x3c, 0xc0, 0x33, 0xc0, 0x33, 0x80, 0xfd, 0x00, 0x06, 0xe7, 0x80,
+  0xef, 0xc0, 0xf1, 0xe0, 0xf0, 0xec, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x38, 0x00,  //..%%%.......
-  0x1c, 0x00,  //...%%%......
-  0x0c, 0x00,  //....%%......
-  0x06, 0x00,  //.....%%.....
-  0x03, 0x00,  //......%%....
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x08, 0x38, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0xfc, 0x00, 0x1b, 0x1f,
+  0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x01, 0xc0,  //.......%%%..
-  0x03, 0x80,  //......%%%...
-  0x03, 0x00,  //......%%....
-  0x06, 0x00,  //.....%%.....
-  0x0c, 0x00,  //....%%......
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x08, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0xfc, 0x00, 0x1b, 0x1f,
+  0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x06, 0x00,  //.....%%.....
-  0x0f, 0x00,  //....%%%%....
-  0x09, 0x00,  //....%..%....
-  0x19, 0x80,  //...%%..%%...
-  0x30, 0xc0,  //..%%....%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x09, 0x06, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x19, 0x80, 0x30, 0xc0, 0xfd, 0x00, 0x1b,
+  0x1f, 0x80, 0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0xe0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1c, 0xc0,  //...%%%..%%..
-  0x3c, 0xc0,  //..%%%%..%%..
-  0x33, 0xc0,  //..%%..%%%%..
-  0x33, 0x80,  //..%%..%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x07, 0x1c, 0xc0, 0x3c, 0xc0, 0x33, 0xc0, 0x33, 0x80, 0xfd, 0x00, 0x1b, 0x1f, 0x80,
+  0x3f, 0xc0, 0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0xe0, 0x70, 0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x39, 0xc0,  //..%%%..%%%..
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x1f, 0x80,  //...%%%%%%...
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0x70, 0xe0,  //.%%%....%%%.
-  0x70, 0xe0,  //.%%%....%%%.
-  0x3f, 0xc0,  //..%%%%%%%%..
-  0x1f, 0x80,  //...%%%%%%...
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x05, 0x39, 0xc0, 0x39, 0xc0, 0x39, 0xc0, 0xfb, 0x00, 0x1b, 0x1f, 0x80, 0x3f, 0xc0,
+  0x70, 0xe0, 0x70, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70,
+  0x70, 0xe0, 0x70, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0xf5, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0xff, 0xf8,  //%%%%%%%%%%%%%
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x04, 0x07, 0x00, 0x07, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xff, 0xf8, 0xff, 0xf8, 0xfd,
+  0x00, 0x04, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf0, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 15 */
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x04,  //.............%.
-  0x07, 0xce,  //.....%%%%%..%%%
-  0x0f, 0xfc,  //....%%%%%%%%%%.
-  0x1e, 0x38,  //...%%%%...%%%..
-  0x1c, 0x38,  //...%%%....%%%..
-  0x38, 0x7c,  //..%%%....%%%%%.
-  0x38, 0xdc,  //..%%%...%%.%%%.
-  0x38, 0x9c,  //..%%%...%..%%%.
-  0x39, 0x1c,  //..%%%..%...%%%.
-  0x3b, 0x1c,  //..%%%.%%...%%%.
-  0x3e, 0x1c,  //..%%%%%....%%%.
-  0x1c, 0x38,  //...%%%....%%%..
-  0x1e, 0x38,  //...%%%%...%%%..
-  0x3f, 0xf0,  //..%%%%%%%%%%...
-  0x63, 0xe0,  //.%%...%%%%%....
-  0x40, 0x00,  //.%.............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-  0x00, 0x00,  //...............
-
+  0xee, 0x00, 0x1d, 0x04, 0x07, 0xce, 0x0f, 0xfc, 0x1e, 0x38, 0x1c, 0x38, 0x38, 0x7c, 0x38, 0xdc,
+  0x38, 0x9c, 0x39, 0x1c, 0x3b, 0x1c, 0x3e, 0x1c, 0x1c, 0x38, 0x1e, 0x38, 0x3f, 0xf0, 0x63, 0xe0,
+  0x40, 0xf6, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x38, 0x00,  //..%%%......
-  0x1c, 0x00,  //...%%%.....
-  0x0c, 0x00,  //....%%.....
-  0x06, 0x00,  //.....%%....
-  0x03, 0x00,  //......%%...
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe1, 0xe0,  //%%%....%%%%
-  0xf1, 0xe0,  //%%%%...%%%%
-  0x7e, 0xe0,  //.%%%%%%.%%%
-  0x3c, 0xe0,  //..%%%%..%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x08, 0x38, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0xfc, 0x00, 0xed, 0xe0,
+  0x07, 0xe1, 0xe0, 0xf1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x01, 0xc0,  //.......%%%.
-  0x03, 0x80,  //......%%%..
-  0x03, 0x00,  //......%%...
-  0x06, 0x00,  //.....%%....
-  0x0c, 0x00,  //....%%.....
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe1, 0xe0,  //%%%....%%%%
-  0xf1, 0xe0,  //%%%%...%%%%
-  0x7e, 0xe0,  //.%%%%%%.%%%
-  0x3c, 0xe0,  //..%%%%..%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x08, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0xfc, 0x00, 0xed, 0xe0,
+  0x07, 0xe1, 0xe0, 0xf1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x0e, 0x00,  //....%%%....
-  0x0e, 0x00,  //....%%%....
-  0x1b, 0x00,  //...%%.%%...
-  0x11, 0x00,  //...%...%...
-  0x31, 0x80,  //..%%...%%..
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe1, 0xe0,  //%%%....%%%%
-  0xf1, 0xe0,  //%%%%...%%%%
-  0x7e, 0xe0,  //.%%%%%%.%%%
-  0x3c, 0xe0,  //..%%%%..%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xfb, 0x00, 0x09, 0x0e, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x11, 0x00, 0x31, 0x80, 0xfd, 0x00, 0xed,
+  0xe0, 0x07, 0xe1, 0xe0, 0xf1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 11 */
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x71, 0xc0,  //.%%%...%%%.
-  0x71, 0xc0,  //.%%%...%%%.
-  0x71, 0xc0,  //.%%%...%%%.
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe0, 0xe0,  //%%%.....%%%
-  0xe1, 0xe0,  //%%%....%%%%
-  0xf1, 0xe0,  //%%%%...%%%%
-  0x7e, 0xe0,  //.%%%%%%.%%%
-  0x3c, 0xe0,  //..%%%%..%%%
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-  0x00, 0x00,  //...........
-
+  0xf9, 0x00, 0x05, 0x71, 0xc0, 0x71, 0xc0, 0x71, 0xc0, 0xfb, 0x00, 0xed, 0xe0, 0x07, 0xe1, 0xe0,
+  0xf1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0xf5, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0xe0,  //........%%%..
-  0x01, 0xc0,  //.......%%%...
-  0x01, 0x80,  //.......%%....
-  0x03, 0x00,  //......%%.....
-  0x06, 0x00,  //.....%%......
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1f, 0xc0,  //...%%%%%%%...
-  0x0f, 0x80,  //....%%%%%....
-  0x0f, 0x80,  //....%%%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x0e, 0x00,  //....%%%......
-  0x0e, 0x00,  //....%%%......
-  0x1e, 0x00,  //...%%%%......
-  0x7c, 0x00,  //.%%%%%.......
-  0x78, 0x00,  //.%%%%........
-  0x00, 0x00,  //.............
-
+  0xfa, 0x00, 0x07, 0xe0, 0x01, 0xc0, 0x01, 0x80, 0x03, 0x00, 0x06, 0xfc, 0x00, 0x01, 0xe0, 0x38,
+  0xfd, 0x70, 0x1e, 0x78, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0, 0x1f, 0xc0, 0x0f,
+  0x80, 0x0f, 0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x7c,
+  0x00, 0x78, 0xfe, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 12 */
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0x00, 0x00,  //............
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe7, 0x80,  //%%%..%%%%...
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xf8, 0xe0,  //%%%%%...%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xe0, 0x70,  //%%%......%%%
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xf0, 0xe0,  //%%%%....%%%.
-  0xff, 0xc0,  //%%%%%%%%%%..
-  0xe7, 0x80,  //%%%..%%%%...
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0xe0, 0x00,  //%%%.........
-  0x00, 0x00,  //............
-
+  0xf9, 0x00, 0x30, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe7,
+  0x80, 0xff, 0xc0, 0xf8, 0xe0, 0xf0, 0xe0, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0, 0x70, 0xe0,
+  0x70, 0xe0, 0x70, 0xf0, 0xe0, 0xf0, 0xe0, 0xff, 0xc0, 0xe7, 0x80, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0xe0, 0xfe, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 13 */
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x1c, 0xe0,  //...%%%..%%%..
-  0x1c, 0xe0,  //...%%%..%%%..
-  0x1c, 0xe0,  //...%%%..%%%..
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0x00, 0x00,  //.............
-  0xe0, 0x38,  //%%%.......%%%
-  0x70, 0x70,  //.%%%.....%%%.
-  0x70, 0x70,  //.%%%.....%%%.
-  0x78, 0xf0,  //.%%%%...%%%%.
-  0x38, 0xe0,  //..%%%...%%%..
-  0x38, 0xe0,  //..%%%...%%%..
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1d, 0xc0,  //...%%%.%%%...
-  0x1f, 0xc0,  //...%%%%%%%...
-  0x0f, 0x80,  //....%%%%%....
-  0x0f, 0x80,  //....%%%%%....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x07, 0x00,  //.....%%%.....
-  0x0e, 0x00,  //....%%%......
-  0x0e, 0x00,  //....%%%......
-  0x1e, 0x00,  //...%%%%......
-  0x7c, 0x00,  //.%%%%%.......
-  0x78, 0x00,  //.%%%%........
-  0x00, 0x00,  //.............
-
-
+  0xf9, 0x00, 0x05, 0x1c, 0xe0, 0x1c, 0xe0, 0x1c, 0xe0, 0xfb, 0x00, 0x01, 0xe0, 0x38, 0xfd, 0x70,
+  0x1e, 0x78, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0, 0x1f, 0xc0, 0x0f, 0x80, 0x0f,
+  0x80, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x7c, 0x00, 0x78,
+  0xfe, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 2
   /*Unicode: U+00a0 ( ) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xc5, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xb8,  //%@%
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xfc, 0x00, 0xfe, 0xfc, 0xfe, 0x00, 0x00, 0xb8, 0xf5, 0xfc, 0xfb, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x7f, 0xe0,  //....+@@@@%.
-  0x07, 0xff, 0xfc,  //..+@@@@@@@@
-  0x1f, 0xd3, 0x1c,  //.+@@@+.@.+@
-  0x3f, 0x03, 0x00,  //.@@@...@...
-  0xbe, 0x03, 0x00,  //%@@%...@...
-  0xfc, 0x03, 0x00,  //@@@....@...
-  0xfc, 0x03, 0x00,  //@@@....@...
-  0xfc, 0x03, 0x00,  //@@@....@...
-  0xfc, 0x03, 0x00,  //@@@....@...
-  0xbe, 0x03, 0x00,  //%@@%...@...
-  0x3f, 0x03, 0x00,  //.@@@...@...
-  0x1f, 0xd3, 0x1c,  //.+@@@+.@.+@
-  0x07, 0xff, 0xfc,  //..+@@@@@@@@
-  0x00, 0x7f, 0xe0,  //....+@@@@%.
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x03, 0x00,  //.......@...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xee, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x7f,
+  0xe0, 0x07, 0xff, 0xfc, 0x1f, 0xd3, 0x1c, 0x3f, 0x03, 0x00, 0xbe, 0x03, 0x00, 0xfc, 0x03, 0x00,
+  0xfc, 0x03, 0x00, 0xfc, 0x03, 0x00, 0xfc, 0x03, 0x00, 0xbe, 0x03, 0x00, 0x3f, 0x03, 0x00, 0x1f,
+  0xd3, 0x1c, 0x07, 0xff, 0xfc, 0x00, 0x7f, 0xe0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x03, 0xfa, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x0b, 0xfe, 0x00,  //......%@@@@%.
-  0x00, 0x7f, 0xff, 0xc0,  //....+@@@@@@@@
-  0x00, 0xfe, 0x01, 0x80,  //....@@@%...+%
-  0x02, 0xf8, 0x00, 0x00,  //...%@@%......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xfc, 0x00,  //@@@@@@@@@@@..
-  0xff, 0xff, 0xfc, 0x00,  //@@@@@@@@@@@..
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0x03, 0xf0, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xec, 0x00, 0x42, 0x0b, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xfe, 0x01, 0x80, 0x02, 0xf8,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x03, 0xf0,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xa0, 0x00, 0x18,  //%%.......+%
-  0xb9, 0xfd, 0xb4,  //%@%+@@@+%@+
-  0x2f, 0xff, 0xe0,  //.%@@@@@@@%.
-  0x0f, 0x43, 0xd0,  //..@@+..@@+.
-  0x3c, 0x00, 0xf0,  //.@@.....@@.
-  0x3c, 0x00, 0xf0,  //.@@.....@@.
-  0x3c, 0x01, 0xf0,  //.@@....+@@.
-  0x1f, 0x07, 0xd0,  //.+@@..+@@+.
-  0x2f, 0xff, 0xe0,  //.%@@@@@@@%.
-  0x79, 0xfd, 0xb8,  //+@%+@@@+%@%
-  0xa0, 0x00, 0x18,  //%%.......+%
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xe0, 0x00, 0x20, 0xa0, 0x00, 0x18, 0xb9, 0xfd, 0xb4, 0x2f, 0xff, 0xe0, 0x0f, 0x43, 0xd0, 0x3c,
+  0x00, 0xf0, 0x3c, 0x00, 0xf0, 0x3c, 0x01, 0xf0, 0x1f, 0x07, 0xd0, 0x2f, 0xff, 0xe0, 0x79, 0xfd,
+  0xb8, 0xa0, 0x00, 0x18, 0xe9, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0x3f, 0x40, 0x07, 0xf0,  //.@@@+.....+@@@.
-  0x2f, 0xc0, 0x0f, 0xe0,  //.%@@@.....@@@%.
-  0x0f, 0xd0, 0x1f, 0xc0,  //..@@@+...+@@@..
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x03, 0xf8, 0xbe, 0x00,  //...@@@%.%@@%...
-  0x00, 0xfd, 0xfc, 0x00,  //....@@@+@@@....
-  0x3f, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@.
-  0x3f, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@.
-  0x00, 0x3f, 0xe0, 0x00,  //.....@@@@%.....
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x3f, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@.
-  0x3f, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@.
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xed, 0x00, 0x4a, 0xbe, 0x00, 0x02, 0xf8, 0x3f, 0x40, 0x07, 0xf0, 0x2f, 0xc0, 0x0f, 0xe0, 0x0f,
+  0xd0, 0x1f, 0xc0, 0x07, 0xf0, 0x3f, 0x40, 0x03, 0xf8, 0xbe, 0x00, 0x00, 0xfd, 0xfc, 0x00, 0x3f,
+  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x3f,
+  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0xf0,  //@@
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xf7, 0xf0, 0xfe, 0x00, 0xf7, 0xf0, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x02, 0xff, 0x80,  //...%@@@@%..
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@.
-  0x3e, 0x00, 0x70,  //.@@%....+@.
-  0x3c, 0x00, 0x00,  //.@@........
-  0x3d, 0x00, 0x00,  //.@@+.......
-  0x2f, 0x80, 0x00,  //.%@@%......
-  0x0f, 0xf8, 0x00,  //..@@@@%....
-  0x3d, 0xbf, 0x40,  //.@@+%@@@+..
-  0xb4, 0x0b, 0xe0,  //%@+...%@@%.
-  0xf0, 0x01, 0xf8,  //@@.....+@@%
-  0xf4, 0x00, 0x7c,  //@@+.....+@@
-  0x7e, 0x00, 0x3c,  //+@@%.....@@
-  0x1f, 0xd0, 0x78,  //.+@@@+..+@%
-  0x02, 0xfe, 0xf0,  //...%@@@%@@.
-  0x00, 0x7f, 0xc0,  //....+@@@@..
-  0x00, 0x07, 0xe0,  //......+@@%.
-  0x00, 0x01, 0xf0,  //.......+@@.
-  0x00, 0x00, 0xf0,  //........@@.
-  0x34, 0x03, 0xe0,  //.@+....@@%.
-  0x3f, 0xff, 0xc0,  //.@@@@@@@@..
-  0x0b, 0xfe, 0x00,  //..%@@@@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf2, 0x00, 0x3d, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3e, 0x00, 0x70, 0x3c, 0x00, 0x00, 0x3d,
+  0x00, 0x00, 0x2f, 0x80, 0x00, 0x0f, 0xf8, 0x00, 0x3d, 0xbf, 0x40, 0xb4, 0x0b, 0xe0, 0xf0, 0x01,
+  0xf8, 0xf4, 0x00, 0x7c, 0x7e, 0x00, 0x3c, 0x1f, 0xd0, 0x78, 0x02, 0xfe, 0xf0, 0x00, 0x7f, 0xc0,
+  0x00, 0x07, 0xe0, 0x00, 0x01, 0xf0, 0x00, 0x00, 0xf0, 0x34, 0x03, 0xe0, 0x3f, 0xff, 0xc0, 0x0b,
+  0xfe, 0xf4, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xfc, 0x3f,  //@@@..@@@
-  0xfc, 0x3f,  //@@@..@@@
-  0xfc, 0x3f,  //@@@..@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf9, 0x00, 0x05, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xd3, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%.....
-  0x02, 0xd0, 0x07, 0x80,  //...%@+....+@%...
-  0x0a, 0x00, 0x00, 0xa0,  //..%%........%%..
-  0x28, 0x1b, 0xf9, 0x28,  //.%%..+%@@@%+.%%.
-  0x30, 0xb8, 0x06, 0x0c,  //.@..%@%...+%..@.
-  0x91, 0xe0, 0x00, 0x06,  //%+.+@%........+%
-  0xc3, 0xc0, 0x00, 0x03,  //@..@@..........@
-  0xc3, 0xc0, 0x00, 0x03,  //@..@@..........@
-  0xc3, 0xc0, 0x00, 0x03,  //@..@@..........@
-  0xc3, 0xc0, 0x00, 0x03,  //@..@@..........@
-  0x91, 0xe0, 0x00, 0x06,  //%+.+@%........+%
-  0x30, 0xb8, 0x06, 0x0c,  //.@..%@%...+%..@.
-  0x28, 0x1b, 0xf9, 0x28,  //.%%..+%@@@%+.%%.
-  0x0a, 0x00, 0x00, 0xa0,  //..%%........%%..
-  0x02, 0xd0, 0x07, 0x80,  //...%@+....+@%...
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-
+  0xe4, 0x00, 0x3d, 0x2f, 0xf8, 0x00, 0x02, 0xd0, 0x07, 0x80, 0x0a, 0x00, 0x00, 0xa0, 0x28, 0x1b,
+  0xf9, 0x28, 0x30, 0xb8, 0x06, 0x0c, 0x91, 0xe0, 0x00, 0x06, 0xc3, 0xc0, 0x00, 0x03, 0xc3, 0xc0,
+  0x00, 0x03, 0xc3, 0xc0, 0x00, 0x03, 0xc3, 0xc0, 0x00, 0x03, 0x91, 0xe0, 0x00, 0x06, 0x30, 0xb8,
+  0x06, 0x0c, 0x28, 0x1b, 0xf9, 0x28, 0x0a, 0x00, 0x00, 0xa0, 0x02, 0xd0, 0x07, 0x80, 0x00, 0x2f,
+  0xf8, 0xe4, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x0b, 0xfd, 0x00,  //..%@@@@+..
-  0x34, 0x0b, 0x40,  //.@+...%@+.
-  0x00, 0x03, 0xc0,  //.......@@.
-  0x0b, 0xff, 0xc0,  //..%@@@@@@.
-  0x7d, 0x03, 0xc0,  //+@@+...@@.
-  0xf0, 0x03, 0xc0,  //@@.....@@.
-  0xf0, 0x07, 0xc0,  //@@....+@@.
-  0xf0, 0x0b, 0xc0,  //@@....%@@.
-  0x78, 0x2f, 0xc0,  //+@%..%@@@.
-  0x1f, 0xe3, 0xc0,  //.+@@@%.@@.
-  0x00, 0x00, 0x00,  //..........
-  0xbf, 0xff, 0xc0,  //%@@@@@@@@.
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf2, 0x00, 0x1d, 0x0b, 0xfd, 0x00, 0x34, 0x0b, 0x40, 0x00, 0x03, 0xc0, 0x0b, 0xff, 0xc0, 0x7d,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x07, 0xc0, 0xf0, 0x0b, 0xc0, 0x78, 0x2f, 0xc0, 0x1f, 0xe3,
+  0xc0, 0xfe, 0x00, 0x02, 0xbf, 0xff, 0xc0, 0xda, 0x00,
 
   /*Unicode: U+00ab («) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x20, 0x02,  //.....%.....%
-  0x00, 0xb0, 0x0b,  //....%@....%@
-  0x02, 0xf0, 0x2f,  //...%@@...%@@
-  0x0f, 0xc0, 0xfc,  //..@@@...@@@.
-  0x3f, 0x03, 0xe0,  //.@@@...@@%..
-  0xf8, 0x0f, 0x80,  //@@%...@@%...
-  0xf8, 0x0f, 0x80,  //@@%...@@%...
-  0x3f, 0x03, 0xe0,  //.@@@...@@%..
-  0x0f, 0xc0, 0xfc,  //..@@@...@@@.
-  0x02, 0xf0, 0x2f,  //...%@@...%@@
-  0x00, 0xb0, 0x0b,  //....%@....%@
-  0x00, 0x20, 0x02,  //.....%.....%
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xdf, 0x00, 0x22, 0x20, 0x02, 0x00, 0xb0, 0x0b, 0x02, 0xf0, 0x2f, 0x0f, 0xc0, 0xfc, 0x3f, 0x03,
+  0xe0, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0x3f, 0x03, 0xe0, 0x0f, 0xc0, 0xfc, 0x02, 0xf0, 0x2f,
+  0x00, 0xb0, 0x0b, 0x00, 0x20, 0x02, 0xec, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x03, 0xc0,  //...........@@
-  0x00, 0x00, 0x03, 0xc0,  //...........@@
-  0x00, 0x00, 0x03, 0xc0,  //...........@@
-  0x00, 0x00, 0x03, 0xc0,  //...........@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xcd, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x10, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0xd5, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0xff, 0xfc,  //@@@@@@@
-  0xff, 0xfc,  //@@@@@@@
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xe1, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%.....
-  0x02, 0xd0, 0x07, 0x80,  //...%@+....+@%...
-  0x0a, 0x00, 0x00, 0xa0,  //..%%........%%..
-  0x28, 0xff, 0xf8, 0x28,  //.%%.@@@@@@%..%%.
-  0x30, 0xf0, 0x1e, 0x0c,  //.@..@@...+@%..@.
-  0x90, 0xf0, 0x0f, 0x06,  //%+..@@....@@..+%
-  0xc0, 0xf0, 0x1e, 0x03,  //@...@@...+@%...@
-  0xc0, 0xff, 0xf4, 0x03,  //@...@@@@@@+....@
-  0xc0, 0xf1, 0xf4, 0x03,  //@...@@.+@@+....@
-  0xc0, 0xf0, 0x7c, 0x03,  //@...@@..+@@....@
-  0x90, 0xf0, 0x2e, 0x06,  //%+..@@...%@%..+%
-  0x30, 0xf0, 0x0f, 0x0c,  //.@..@@....@@..@.
-  0x28, 0xf0, 0x0b, 0xa8,  //.%%.@@....%@%%%.
-  0x0a, 0x00, 0x00, 0xa0,  //..%%........%%..
-  0x02, 0xd0, 0x07, 0x80,  //...%@+....+@%...
-  0x00, 0x2f, 0xf8, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00,  //................
-
+  0xe4, 0x00, 0x3d, 0x2f, 0xf8, 0x00, 0x02, 0xd0, 0x07, 0x80, 0x0a, 0x00, 0x00, 0xa0, 0x28, 0xff,
+  0xf8, 0x28, 0x30, 0xf0, 0x1e, 0x0c, 0x90, 0xf0, 0x0f, 0x06, 0xc0, 0xf0, 0x1e, 0x03, 0xc0, 0xff,
+  0xf4, 0x03, 0xc0, 0xf1, 0xf4, 0x03, 0xc0, 0xf0, 0x7c, 0x03, 0x90, 0xf0, 0x2e, 0x06, 0x30, 0xf0,
+  0x0f, 0x0c, 0x28, 0xf0, 0x0b, 0xa8, 0x0a, 0x00, 0x00, 0xa0, 0x02, 0xd0, 0x07, 0x80, 0x00, 0x2f,
+  0xf8, 0xe4, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf7, 0x00, 0xfd, 0xff, 0xd3, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x0b, 0xe0,  //..%@@%..
-  0x3f, 0xfc,  //.@@@@@@.
-  0xb8, 0x2e,  //%@%..%@%
-  0xf0, 0x0f,  //@@....@@
-  0xf0, 0x0f,  //@@....@@
-  0xb8, 0x2e,  //%@%..%@%
-  0x3f, 0xfc,  //.@@@@@@.
-  0x0b, 0xe0,  //..%@@%..
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf7, 0x00, 0x0f, 0x0b, 0xe0, 0x3f, 0xfc, 0xb8, 0x2e, 0xf0, 0x0f, 0xf0, 0x0f, 0xb8, 0x2e, 0x3f,
+  0xfc, 0x0b, 0xe0, 0xdf, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x0f, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xdc, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x02, 0x0f,
+  0x00, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xf3, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff,
+  0x00, 0xf0, 0xe9, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 7 */
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x6f, 0xd0,  //+%@@@+.
-  0x90, 0xb4,  //%+..%@+
-  0x00, 0x3c,  //.....@@
-  0x00, 0x3c,  //.....@@
-  0x00, 0x7c,  //....+@@
-  0x00, 0xf4,  //....@@+
-  0x03, 0xf0,  //...@@@.
-  0x0f, 0xc0,  //..@@@..
-  0x3f, 0x00,  //.@@@...
-  0xfc, 0x00,  //@@@....
-  0xff, 0xfc,  //@@@@@@@
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-  0x00, 0x00,  //.......
-
+  0xf7, 0x00, 0x15, 0x6f, 0xd0, 0x90, 0xb4, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0xf4, 0x03,
+  0xf0, 0x0f, 0xc0, 0x3f, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xe5, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x2f, 0xf4,  //.%@@@@+.
-  0xd0, 0x2e,  //@+...%@%
-  0x00, 0x0f,  //......@@
-  0x00, 0x2e,  //.....%@%
-  0x0f, 0xf4,  //..@@@@+.
-  0x00, 0x7d,  //....+@@+
-  0x00, 0x0f,  //......@@
-  0x00, 0x0f,  //......@@
-  0x00, 0x1f,  //.....+@@
-  0x90, 0x7d,  //%+..+@@+
-  0x2f, 0xe0,  //.%@@@%..
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf7, 0x00, 0x15, 0x2f, 0xf4, 0xd0, 0x2e, 0x00, 0x0f, 0x00, 0x2e, 0x0f, 0xf4, 0x00, 0x7d, 0x00,
+  0x0f, 0x00, 0x0f, 0x00, 0x1f, 0x90, 0x7d, 0x2f, 0xe0, 0xe5, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 6 */
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x03, 0xe0,  //...@@%
-  0x0b, 0xc0,  //..%@@.
-  0x0f, 0x00,  //..@@..
-  0x3c, 0x00,  //.@@...
-  0xb4, 0x00,  //%@+...
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-  0x00, 0x00,  //......
-
+  0xfb, 0x00, 0x08, 0x03, 0xe0, 0x0b, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xb4, 0xd4, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfc, 0x00, 0xfc, 0x00,  //@@@.....@@@..
-  0xfd, 0x01, 0xfc, 0x00,  //@@@+...+@@@..
-  0xff, 0x07, 0xfc, 0x00,  //@@@@..+@@@@..
-  0xff, 0xff, 0xbf, 0xc0,  //@@@@@@@@%@@@@
-  0xf8, 0xfd, 0x2f, 0x80,  //@@%.@@@+.%@@%
-  0xf8, 0x00, 0x00, 0x00,  //@@%..........
-  0xf8, 0x00, 0x00, 0x00,  //@@%..........
-  0xf8, 0x00, 0x00, 0x00,  //@@%..........
-  0xf8, 0x00, 0x00, 0x00,  //@@%..........
-  0xf8, 0x00, 0x00, 0x00,  //@@%..........
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd9, 0x00, 0x38, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x01, 0xfc, 0x00, 0xff,
+  0x07, 0xfc, 0x00, 0xff, 0xff, 0xbf, 0xc0, 0xf8, 0xfd, 0x2f, 0x80, 0xf8, 0xfe, 0x00, 0x00, 0xf8,
+  0xfe, 0x00, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0xf8, 0xfa, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x01, 0xff, 0xff,  //...+@@@@@@@@
-  0x1f, 0xff, 0xff,  //.+@@@@@@@@@@
-  0x3f, 0xff, 0x0f,  //.@@@@@@@..@@
-  0xbf, 0xff, 0x0f,  //%@@@@@@@..@@
-  0xff, 0xff, 0x0f,  //@@@@@@@@..@@
-  0xff, 0xff, 0x0f,  //@@@@@@@@..@@
-  0xff, 0xff, 0x0f,  //@@@@@@@@..@@
-  0xbf, 0xff, 0x0f,  //%@@@@@@@..@@
-  0x3f, 0xff, 0x0f,  //.@@@@@@@..@@
-  0x1f, 0xff, 0x0f,  //.+@@@@@@..@@
-  0x01, 0xff, 0x0f,  //...+@@@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x0f, 0x0f,  //......@@..@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x41, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x3f, 0xff, 0x0f, 0xbf, 0xff, 0x0f, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xbf, 0xff, 0x0f, 0x3f, 0xff, 0x0f, 0x1f, 0xff,
+  0x0f, 0x01, 0xff, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f,
+  0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00,
+  0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0xf8, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 3 */
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0xfc,  //@@@
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-  0x00,  //...
-
+  0xf4, 0x00, 0xfd, 0xfc, 0xf4, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 5 */
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x00, 0x00,  //.....
-  0x0b, 0x40,  //..%@+
-  0x03, 0x80,  //...@%
-  0x07, 0xc0,  //..+@@
-  0xff, 0xc0,  //@@@@@
-  0xbf, 0x00,  //%@@@.
-  0x00, 0x00,  //.....
-
+  0xd1, 0x00, 0x08, 0x0b, 0x40, 0x03, 0x80, 0x07, 0xc0, 0xff, 0xc0, 0xbf, 0xfe, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 8 */
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x1f, 0xc0,  //.+@@@...
-  0xd3, 0xc0,  //@+.@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0x03, 0xc0,  //...@@...
-  0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-  0x00, 0x00,  //........
-
+  0xf7, 0x00, 0x15, 0x1f, 0xc0, 0xd3, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+  0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xe5, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 9 */
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x3d, 0x1f, 0x00,  //.@@+.+@@.
-  0x74, 0x07, 0x40,  //+@+...+@+
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0xf0, 0x03, 0xc0,  //@@.....@@
-  0x74, 0x07, 0x40,  //+@+...+@+
-  0x3d, 0x1f, 0x00,  //.@@+.+@@.
-  0x0b, 0xf8, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00,  //.........
-  0xbf, 0xff, 0x80,  //%@@@@@@@%
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00,  //.........
-
+  0xf2, 0x00, 0x1c, 0x0b, 0xf8, 0x00, 0x3d, 0x1f, 0x00, 0x74, 0x07, 0x40, 0xf0, 0x03, 0xc0, 0xf0,
+  0x03, 0xc0, 0xf0, 0x03, 0xc0, 0xf0, 0x03, 0xc0, 0x74, 0x07, 0x40, 0x3d, 0x1f, 0x00, 0x0b, 0xf8,
+  0xfd, 0x00, 0x02, 0xbf, 0xff, 0x80, 0xda, 0x00,
 
   /*Unicode: U+00bb (») , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x80, 0x08, 0x00,  //%.....%.....
-  0xe0, 0x0e, 0x00,  //@%....@%....
-  0xf8, 0x0f, 0x80,  //@@%...@@%...
-  0x3f, 0x03, 0xf0,  //.@@@...@@@..
-  0x0b, 0xc0, 0xfc,  //..%@@...@@@.
-  0x02, 0xf0, 0x2f,  //...%@@...%@@
-  0x02, 0xf0, 0x2f,  //...%@@...%@@
-  0x0b, 0xc0, 0xfc,  //..%@@...@@@.
-  0x3f, 0x03, 0xf0,  //.@@@...@@@..
-  0xf8, 0x0f, 0x80,  //@@%...@@%...
-  0xe0, 0x0e, 0x00,  //@%....@%....
-  0x80, 0x08, 0x00,  //%.....%.....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xe0, 0x00, 0x22, 0x80, 0x08, 0x00, 0xe0, 0x0e, 0x00, 0xf8, 0x0f, 0x80, 0x3f, 0x03, 0xf0, 0x0b,
+  0xc0, 0xfc, 0x02, 0xf0, 0x2f, 0x02, 0xf0, 0x2f, 0x0b, 0xc0, 0xfc, 0x3f, 0x03, 0xf0, 0xf8, 0x0f,
+  0x80, 0xe0, 0x0e, 0x00, 0x80, 0x08, 0xeb, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x07, 0xf0, 0x00, 0x00,  //..+@@@........
-  0x34, 0xf0, 0x00, 0x00,  //.@+.@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x3f, 0xff, 0xc6, 0xb0,  //.@@@@@@@@.+%%@
-  0x00, 0x06, 0xfe, 0x40,  //......+%@@@%+.
-  0x1b, 0xf9, 0x00, 0x00,  //.+%@@@%+......
-  0xe9, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x1f, 0x00,  //.........+@@..
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@..
-  0x00, 0x00, 0xef, 0x00,  //........@%@@..
-  0x00, 0x01, 0xcf, 0x00,  //.......+@.@@..
-  0x00, 0x03, 0x4f, 0x00,  //.......@+.@@..
-  0x00, 0x0f, 0x0f, 0x00,  //......@@..@@..
-  0x00, 0x1d, 0x0f, 0x00,  //.....+@+..@@..
-  0x00, 0x38, 0x0f, 0x00,  //.....@%...@@..
-  0x00, 0x3f, 0xff, 0xc0,  //.....@@@@@@@@.
-  0x00, 0x00, 0x0f, 0x00,  //..........@@..
-  0x00, 0x00, 0x0f, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xf5, 0x00, 0x05, 0x07, 0xf0, 0x00, 0x00, 0x34, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc6, 0xb0, 0x00,
+  0x06, 0xfe, 0x40, 0x1b, 0xf9, 0x00, 0x00, 0xe9, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x3f,
+  0xfe, 0x00, 0x1c, 0xef, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x00, 0x03, 0x4f, 0x00, 0x00, 0x0f, 0x0f,
+  0x00, 0x00, 0x1d, 0x0f, 0x00, 0x00, 0x38, 0x0f, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x00, 0x0f, 0xf8, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x07, 0xf0, 0x00, 0x00,  //..+@@@........
-  0x34, 0xf0, 0x00, 0x00,  //.@+.@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x00, 0xf0, 0x00, 0x00,  //....@@........
-  0x3f, 0xff, 0xc6, 0xb0,  //.@@@@@@@@.+%%@
-  0x00, 0x06, 0xfe, 0x40,  //......+%@@@%+.
-  0x1b, 0xf9, 0x00, 0x00,  //.+%@@@%+......
-  0xe9, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x01, 0xbf, 0x40,  //.......+%@@@+.
-  0x00, 0x02, 0x42, 0xd0,  //.......%+..%@+
-  0x00, 0x00, 0x00, 0xf0,  //............@@
-  0x00, 0x00, 0x00, 0xf0,  //............@@
-  0x00, 0x00, 0x01, 0xf0,  //...........+@@
-  0x00, 0x00, 0x03, 0xd0,  //...........@@+
-  0x00, 0x00, 0x0f, 0xc0,  //..........@@@.
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@..
-  0x00, 0x00, 0xfc, 0x00,  //........@@@...
-  0x00, 0x03, 0xf0, 0x00,  //.......@@@....
-  0x00, 0x03, 0xff, 0xf0,  //.......@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xf5, 0x00, 0x05, 0x07, 0xf0, 0x00, 0x00, 0x34, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0xf0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xc6, 0xb0, 0x00,
+  0x06, 0xfe, 0x40, 0x1b, 0xf9, 0x00, 0x00, 0xe9, 0xfd, 0x00, 0x06, 0x01, 0xbf, 0x40, 0x00, 0x02,
+  0x42, 0xd0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x03, 0xd0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x03,
+  0xf0, 0x00, 0x00, 0x03, 0xff, 0xf0, 0xf9, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x0b, 0xfd, 0x00, 0x00,  //..%@@@@+......
-  0x34, 0x0b, 0x80, 0x00,  //.@+...%@%.....
-  0x00, 0x03, 0xc0, 0x00,  //.......@@.....
-  0x00, 0x0b, 0x80, 0x00,  //......%@%.....
-  0x03, 0xfd, 0x00, 0x00,  //...@@@@+......
-  0x00, 0x1f, 0x40, 0x00,  //.....+@@+.....
-  0x00, 0x03, 0xc0, 0x00,  //.......@@.....
-  0x00, 0x03, 0xc0, 0x00,  //.......@@.....
-  0x00, 0x07, 0xc0, 0x00,  //......+@@.....
-  0x24, 0x1f, 0x40, 0x00,  //.%+..+@@+.....
-  0x0b, 0xf8, 0x06, 0xb0,  //..%@@@%...+%%@
-  0x00, 0x06, 0xfe, 0x40,  //......+%@@@%+.
-  0x1b, 0xf9, 0x00, 0x00,  //.+%@@@%+......
-  0xe9, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x1f, 0x00,  //.........+@@..
-  0x00, 0x00, 0x3f, 0x00,  //.........@@@..
-  0x00, 0x00, 0xef, 0x00,  //........@%@@..
-  0x00, 0x01, 0xcf, 0x00,  //.......+@.@@..
-  0x00, 0x03, 0x4f, 0x00,  //.......@+.@@..
-  0x00, 0x0f, 0x0f, 0x00,  //......@@..@@..
-  0x00, 0x1d, 0x0f, 0x00,  //.....+@+..@@..
-  0x00, 0x38, 0x0f, 0x00,  //.....@%...@@..
-  0x00, 0x3f, 0xff, 0xc0,  //.....@@@@@@@@.
-  0x00, 0x00, 0x0f, 0x00,  //..........@@..
-  0x00, 0x00, 0x0f, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xf5, 0x00, 0x11, 0x0b, 0xfd, 0x00, 0x00, 0x34, 0x0b, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
+  0x0b, 0x80, 0x00, 0x03, 0xfd, 0xfe, 0x00, 0x1f, 0x1f, 0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x24, 0x1f, 0x40, 0x00, 0x0b, 0xf8, 0x06, 0xb0, 0x00,
+  0x06, 0xfe, 0x40, 0x1b, 0xf9, 0x00, 0x00, 0xe9, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x3f,
+  0xfe, 0x00, 0x1c, 0xef, 0x00, 0x00, 0x01, 0xcf, 0x00, 0x00, 0x03, 0x4f, 0x00, 0x00, 0x0f, 0x0f,
+  0x00, 0x00, 0x1d, 0x0f, 0x00, 0x00, 0x38, 0x0f, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x00, 0x0f, 0xf8, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 10 */
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x00, 0xfc, 0x00,  //....@@@...
-  0x02, 0xf8, 0x00,  //...%@@%...
-  0x07, 0xf4, 0x00,  //..+@@@+...
-  0x1f, 0xe0, 0x00,  //.+@@@%....
-  0x7f, 0xc0, 0x00,  //+@@@@.....
-  0xff, 0x00, 0x00,  //@@@@......
-  0xfc, 0x00, 0x00,  //@@@.......
-  0xfc, 0x00, 0x20,  //@@@......%
-  0xbe, 0x01, 0xf0,  //%@@%...+@@
-  0x3f, 0xff, 0xd0,  //.@@@@@@@@+
-  0x07, 0xfe, 0x00,  //..+@@@@%..
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00,  //..........
-
+  0xf1, 0x00, 0x06, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xf9, 0x00, 0x27, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x02, 0xf8, 0x00, 0x07, 0xf4, 0x00, 0x1f, 0xe0,
+  0x00, 0x7f, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x20, 0xbe, 0x01, 0xf0,
+  0x3f, 0xff, 0xd0, 0x07, 0xfe, 0xee, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 15 */
-  0x00, 0xbc, 0x00, 0x00,  //....%@@........
-  0x00, 0x2e, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x0b, 0x80, 0x00,  //......%@%......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x01, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x2e, 0xfe, 0x00, 0x01, 0x0b, 0x80, 0xf7, 0x00, 0x4a, 0x0f,
+  0xc0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f,
+  0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8, 0xbd, 0x00, 0x02, 0xf4,
+  0x7e, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0, 0x1f, 0x80, 0x0f, 0xff,
+  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00, 0x03, 0xf0, 0x3f, 0x00,
+  0x03, 0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 15 */
-  0x00, 0x03, 0xd0, 0x00,  //.......@@+.....
-  0x00, 0x0b, 0x80, 0x00,  //......%@%......
-  0x00, 0x2e, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x09, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x2e, 0xf6, 0x00, 0x4a, 0x0f, 0xc0,
+  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f, 0xf4,
+  0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8, 0xbd, 0x00, 0x02, 0xf4, 0x7e,
+  0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0, 0x1f, 0x80, 0x0f, 0xff, 0xff,
+  0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x03,
+  0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 15 */
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x3d, 0xf0, 0x00,  //.....@@+@@.....
-  0x00, 0xb0, 0x38, 0x00,  //....%@...@%....
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x0a, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x3d, 0xf0, 0x00, 0x00, 0xb0, 0x38, 0xf7, 0x00, 0x4a, 0x0f,
+  0xc0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f,
+  0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8, 0xbd, 0x00, 0x02, 0xf4,
+  0x7e, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0, 0x1f, 0x80, 0x0f, 0xff,
+  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00, 0x03, 0xf0, 0x3f, 0x00,
+  0x03, 0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 15 */
-  0x00, 0x3e, 0x3c, 0x00,  //.....@@%.@@....
-  0x00, 0xbf, 0xf8, 0x00,  //....%@@@@@%....
-  0x00, 0xf2, 0xf0, 0x00,  //....@@.%@@.....
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x0a, 0x00, 0x3e, 0x3c, 0x00, 0x00, 0xbf, 0xf8, 0x00, 0x00, 0xf2, 0xf0, 0xf7, 0x00, 0x4a, 0x0f,
+  0xc0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f,
+  0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8, 0xbd, 0x00, 0x02, 0xf4,
+  0x7e, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0, 0x1f, 0x80, 0x0f, 0xff,
+  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00, 0x03, 0xf0, 0x3f, 0x00,
+  0x03, 0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 15 */
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xf8, 0xbd, 0x00,  //...+@@%.%@@+...
-  0x02, 0xf4, 0x7e, 0x00,  //...%@@+.+@@%...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x0b, 0xd0, 0x1f, 0x80,  //..%@@+...+@@%..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0xff, 0xff, 0xd0,  //.+@@@@@@@@@@@+.
-  0x2f, 0x80, 0x0b, 0xe0,  //.%@@%.....%@@%.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x0a, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0xf7, 0x00, 0x4a, 0x0f,
+  0xc0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f,
+  0xf4, 0x00, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xf8, 0xbd, 0x00, 0x02, 0xf4,
+  0x7e, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0x07, 0xf0, 0x3f, 0x40, 0x0b, 0xd0, 0x1f, 0x80, 0x0f, 0xff,
+  0xff, 0xc0, 0x1f, 0xff, 0xff, 0xd0, 0x2f, 0x80, 0x0b, 0xe0, 0x3f, 0x00, 0x03, 0xf0, 0x3f, 0x00,
+  0x03, 0xf0, 0xbe, 0x00, 0x02, 0xf8, 0xfd, 0x00, 0x01, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 15 */
-  0x00, 0x1f, 0xd0, 0x00,  //.....+@@@+.....
-  0x00, 0x7f, 0xf4, 0x00,  //....+@@@@@+....
-  0x00, 0xf4, 0x7c, 0x00,  //....@@+.+@@....
-  0x00, 0xf0, 0x3c, 0x00,  //....@@...@@....
-  0x00, 0xb4, 0x78, 0x00,  //....%@+.+@%....
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x2f, 0xd0, 0x00,  //.....%@@@+.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0xbf, 0xf4, 0x00,  //....%@@@@@+....
-  0x00, 0xfe, 0xfc, 0x00,  //....@@@%@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x02, 0xf8, 0xbd, 0x00,  //...%@@%.%@@+...
-  0x03, 0xf4, 0x7f, 0x00,  //...@@@+.+@@@...
-  0x03, 0xf0, 0x3f, 0x00,  //...@@@...@@@...
-  0x0b, 0xe0, 0x2f, 0x40,  //..%@@%...%@@+..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x0f, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@..
-  0x1f, 0x80, 0x0b, 0xd0,  //.+@@%.....%@@+.
-  0x3f, 0x40, 0x07, 0xf0,  //.@@@+.....+@@@.
-  0x3f, 0x00, 0x03, 0xf0,  //.@@@.......@@@.
-  0x7e, 0x00, 0x02, 0xf4,  //+@@%.......%@@+
-  0xfd, 0x00, 0x01, 0xfc,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x5f, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x7f, 0xf4, 0x00, 0x00, 0xf4, 0x7c, 0x00, 0x00, 0xf0, 0x3c,
+  0x00, 0x00, 0xb4, 0x78, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x2f, 0xd0,
+  0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0xbf, 0xf4, 0x00, 0x00, 0xfe, 0xfc,
+  0x00, 0x00, 0xfc, 0xfc, 0x00, 0x02, 0xf8, 0xbd, 0x00, 0x03, 0xf4, 0x7f, 0x00, 0x03, 0xf0, 0x3f,
+  0x00, 0x0b, 0xe0, 0x2f, 0x40, 0x0f, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xc0, 0x1f, 0x80, 0x0b,
+  0xd0, 0x3f, 0x40, 0x07, 0xf0, 0x3f, 0x00, 0x03, 0xf0, 0x7e, 0x00, 0x02, 0xf4, 0xfd, 0x00, 0x01,
+  0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x3f, 0xff, 0xfc,  //.....@@@@@@@@@@
-  0x00, 0x3f, 0xff, 0xfc,  //.....@@@@@@@@@@
-  0x00, 0xbe, 0xfc, 0x00,  //....%@@%@@@....
-  0x00, 0xfd, 0xfc, 0x00,  //....@@@+@@@....
-  0x00, 0xfc, 0xfc, 0x00,  //....@@@.@@@....
-  0x01, 0xfc, 0xfc, 0x00,  //...+@@@.@@@....
-  0x02, 0xf4, 0xfc, 0x00,  //...%@@+.@@@....
-  0x03, 0xf0, 0xfc, 0x00,  //...@@@..@@@....
-  0x03, 0xf0, 0xff, 0xf0,  //...@@@..@@@@@@.
-  0x07, 0xe0, 0xff, 0xf0,  //..+@@%..@@@@@@.
-  0x0b, 0xd0, 0xfc, 0x00,  //..%@@+..@@@....
-  0x0f, 0xc0, 0xfc, 0x00,  //..@@@...@@@....
-  0x0f, 0xff, 0xfc, 0x00,  //..@@@@@@@@@....
-  0x2f, 0xff, 0xfc, 0x00,  //.%@@@@@@@@@....
-  0x3f, 0x40, 0xfc, 0x00,  //.@@@+...@@@....
-  0x3f, 0x00, 0xfc, 0x00,  //.@@@....@@@....
-  0x7f, 0x00, 0xfc, 0x00,  //+@@@....@@@....
-  0xbe, 0x00, 0xff, 0xfc,  //%@@%....@@@@@@@
-  0xfc, 0x00, 0xff, 0xfc,  //@@@.....@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xec, 0x00, 0x4a, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0xbe, 0xfc, 0x00, 0x00, 0xfd,
+  0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x01, 0xfc, 0xfc, 0x00, 0x02, 0xf4, 0xfc, 0x00, 0x03, 0xf0,
+  0xfc, 0x00, 0x03, 0xf0, 0xff, 0xf0, 0x07, 0xe0, 0xff, 0xf0, 0x0b, 0xd0, 0xfc, 0x00, 0x0f, 0xc0,
+  0xfc, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x2f, 0xff, 0xfc, 0x00, 0x3f, 0x40, 0xfc, 0x00, 0x3f, 0x00,
+  0xfc, 0x00, 0x7f, 0x00, 0xfc, 0x00, 0xbe, 0x00, 0xff, 0xfc, 0xfc, 0x00, 0xff, 0xfc, 0xe9, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x6f, 0xf8,  //....+%@@@@%.
-  0x03, 0xff, 0xff,  //...@@@@@@@@@
-  0x0f, 0xe0, 0x1f,  //..@@@%...+@@
-  0x2f, 0x80, 0x02,  //.%@@%......%
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x7e, 0x00, 0x00,  //+@@%........
-  0xbd, 0x00, 0x00,  //%@@+........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xbd, 0x00, 0x00,  //%@@+........
-  0x7e, 0x00, 0x00,  //+@@%........
-  0x3f, 0x00, 0x00,  //.@@@........
-  0x2f, 0x80, 0x02,  //.%@@%......%
-  0x0f, 0xe0, 0x1f,  //..@@@%...+@@
-  0x03, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x6f, 0xf8,  //....+%@@@@%.
-  0x00, 0x02, 0xd0,  //.......%@+..
-  0x00, 0x00, 0xe0,  //........@%..
-  0x00, 0x01, 0xf0,  //.......+@@..
-  0x00, 0x3f, 0xf0,  //.....@@@@@..
-  0x00, 0x2f, 0xc0,  //.....%@@@...
-  0x00, 0x00, 0x00,  //............
-
+  0xf1, 0x00, 0x46, 0x6f, 0xf8, 0x03, 0xff, 0xff, 0x0f, 0xe0, 0x1f, 0x2f, 0x80, 0x02, 0x3f, 0x00,
+  0x00, 0x7e, 0x00, 0x00, 0xbd, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x2f,
+  0x80, 0x02, 0x0f, 0xe0, 0x1f, 0x03, 0xff, 0xff, 0x00, 0x6f, 0xf8, 0x00, 0x02, 0xd0, 0x00, 0x00,
+  0xe0, 0x00, 0x01, 0xf0, 0x00, 0x3f, 0xf0, 0x00, 0x2f, 0xc0, 0xfe, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 12 */
-  0x00, 0xbc, 0x00,  //....%@@.....
-  0x00, 0x2e, 0x00,  //.....%@%....
-  0x00, 0x0b, 0x80,  //......%@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x00, 0xbc, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x0b, 0x80, 0xfb, 0x00, 0xfb, 0xff, 0x2c, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 12 */
-  0x00, 0x03, 0xd0,  //.......@@+..
-  0x00, 0x0b, 0x80,  //......%@%...
-  0x00, 0x2e, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x07, 0x00, 0x03, 0xd0, 0x00, 0x0b, 0x80, 0x00, 0x2e, 0xfa, 0x00, 0xfb, 0xff, 0x2c, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 12 */
-  0x00, 0x2f, 0x80,  //.....%@@%...
-  0x00, 0xb5, 0xe0,  //....%@++@%..
-  0x02, 0xd0, 0x78,  //...%@+..+@%.
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x00, 0x2f, 0x80, 0x00, 0xb5, 0xe0, 0x02, 0xd0, 0x78, 0xfb, 0x00, 0xfb, 0xff, 0x2c, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 12 */
-  0x03, 0xf0, 0xfc,  //...@@@..@@@.
-  0x03, 0xf0, 0xfc,  //...@@@..@@@.
-  0x03, 0xf0, 0xfc,  //...@@@..@@@.
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@.
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x03, 0xf0, 0xfc, 0x03, 0xf0, 0xfc, 0x03, 0xf0, 0xfc, 0xfb, 0x00, 0xfb, 0xff, 0x2c, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfb, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 11 */
-  0x0b, 0xc0, 0x00,  //..%@@......
-  0x02, 0xe0, 0x00,  //...%@%.....
-  0x00, 0xb8, 0x00,  //....%@%....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0x07, 0x0b, 0xc0, 0x00, 0x02, 0xe0, 0x00, 0x00, 0xb8, 0xfa, 0x00, 0x38, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xff,
+  0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 11 */
-  0x00, 0x3d, 0x00,  //.....@@+...
-  0x00, 0xb8, 0x00,  //....%@%....
-  0x02, 0xe0, 0x00,  //...%@%.....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0x07, 0x00, 0x3d, 0x00, 0x00, 0xb8, 0x00, 0x02, 0xe0, 0xfa, 0x00, 0x38, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xff,
+  0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 11 */
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x03, 0xcf, 0x00,  //...@@.@@...
-  0x0f, 0x03, 0xc0,  //..@@...@@..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0x08, 0x00, 0xfc, 0x00, 0x03, 0xcf, 0x00, 0x0f, 0x03, 0xc0, 0xfb, 0x00, 0x38, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 11 */
-  0x0f, 0xcf, 0xc0,  //..@@@.@@@..
-  0x0f, 0xcf, 0xc0,  //..@@@.@@@..
-  0x0f, 0xcf, 0xc0,  //..@@@.@@@..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0xff, 0xff, 0xfc,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0x08, 0x0f, 0xcf, 0xc0, 0x0f, 0xcf, 0xc0, 0x0f, 0xcf, 0xc0, 0xfb, 0x00, 0x38, 0xff, 0xff, 0xfc,
+  0xff, 0xff, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xfe, 0x40, 0x00,  //.@@@@@@%+....
-  0x3f, 0xff, 0xf0, 0x00,  //.@@@@@@@@@...
-  0x3f, 0x01, 0xfc, 0x00,  //.@@@...+@@@..
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x3f, 0x00, 0x2f, 0x00,  //.@@@.....%@@.
-  0x3f, 0x00, 0x1f, 0x80,  //.@@@.....+@@%
-  0x3f, 0x00, 0x0f, 0x80,  //.@@@......@@%
-  0x3f, 0x00, 0x0f, 0xc0,  //.@@@......@@@
-  0xff, 0xfc, 0x0f, 0xc0,  //@@@@@@@...@@@
-  0xff, 0xfc, 0x0f, 0xc0,  //@@@@@@@...@@@
-  0x3f, 0x00, 0x0f, 0xc0,  //.@@@......@@@
-  0x3f, 0x00, 0x0f, 0xc0,  //.@@@......@@@
-  0x3f, 0x00, 0x0f, 0x80,  //.@@@......@@%
-  0x3f, 0x00, 0x1f, 0x80,  //.@@@.....+@@%
-  0x3f, 0x00, 0x2f, 0x00,  //.@@@.....%@@.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x3f, 0x01, 0xfc, 0x00,  //.@@@...+@@@..
-  0x3f, 0xff, 0xf0, 0x00,  //.@@@@@@@@@...
-  0x3f, 0xfe, 0x40, 0x00,  //.@@@@@@%+....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xed, 0x00, 0x4a, 0x3f, 0xfe, 0x40, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x3f, 0x01, 0xfc, 0x00, 0x3f,
+  0x00, 0x3f, 0x00, 0x3f, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x1f, 0x80, 0x3f, 0x00, 0x0f, 0x80, 0x3f,
+  0x00, 0x0f, 0xc0, 0xff, 0xfc, 0x0f, 0xc0, 0xff, 0xfc, 0x0f, 0xc0, 0x3f, 0x00, 0x0f, 0xc0, 0x3f,
+  0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x0f, 0x80, 0x3f, 0x00, 0x1f, 0x80, 0x3f, 0x00, 0x2f, 0x00, 0x3f,
+  0x00, 0x3f, 0x00, 0x3f, 0x01, 0xfc, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x3f, 0xfe, 0x40, 0xe8, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 12 */
-  0x03, 0xf4, 0xf0,  //...@@@+.@@..
-  0x0b, 0xff, 0xe0,  //..%@@@@@@%..
-  0x0f, 0x1f, 0xc0,  //..@@.+@@@...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xff, 0x00, 0x3f,  //@@@@.....@@@
-  0xff, 0x00, 0x3f,  //@@@@.....@@@
-  0xff, 0x80, 0x3f,  //@@@@%....@@@
-  0xff, 0xc0, 0x3f,  //@@@@@....@@@
-  0xfe, 0xc0, 0x3f,  //@@@%@....@@@
-  0xfd, 0xe0, 0x3f,  //@@@+@%...@@@
-  0xfc, 0xf0, 0x3f,  //@@@.@@...@@@
-  0xfc, 0xb4, 0x3f,  //@@@.%@+..@@@
-  0xfc, 0x78, 0x3f,  //@@@.+@%..@@@
-  0xfc, 0x3c, 0x3f,  //@@@..@@..@@@
-  0xfc, 0x2d, 0x3f,  //@@@..%@+.@@@
-  0xfc, 0x1e, 0x3f,  //@@@..+@%.@@@
-  0xfc, 0x0f, 0x3f,  //@@@...@@.@@@
-  0xfc, 0x0b, 0x7f,  //@@@...%@+@@@
-  0xfc, 0x03, 0xbf,  //@@@....@%@@@
-  0xfc, 0x03, 0xff,  //@@@....@@@@@
-  0xfc, 0x02, 0xff,  //@@@....%@@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x03, 0xf4, 0xf0, 0x0b, 0xff, 0xe0, 0x0f, 0x1f, 0xc0, 0xfb, 0x00, 0x38, 0xff, 0x00, 0x3f,
+  0xff, 0x00, 0x3f, 0xff, 0x80, 0x3f, 0xff, 0xc0, 0x3f, 0xfe, 0xc0, 0x3f, 0xfd, 0xe0, 0x3f, 0xfc,
+  0xf0, 0x3f, 0xfc, 0xb4, 0x3f, 0xfc, 0x78, 0x3f, 0xfc, 0x3c, 0x3f, 0xfc, 0x2d, 0x3f, 0xfc, 0x1e,
+  0x3f, 0xfc, 0x0f, 0x3f, 0xfc, 0x0b, 0x7f, 0xfc, 0x03, 0xbf, 0xfc, 0x03, 0xff, 0xfc, 0x02, 0xff,
+  0xfc, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 13 */
-  0x00, 0xbc, 0x00, 0x00,  //....%@@......
-  0x00, 0x2e, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x0b, 0x80, 0x00,  //......%@%....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x01, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x2e, 0xfe, 0x00, 0x01, 0x0b, 0x80, 0xf8, 0x00, 0x4a, 0x01,
+  0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e,
+  0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x1f,
+  0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 13 */
-  0x00, 0x03, 0xd0, 0x00,  //.......@@+...
-  0x00, 0x0b, 0x80, 0x00,  //......%@%....
-  0x00, 0x2e, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x09, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x2e, 0xf7, 0x00, 0x4a, 0x01, 0xbf,
+  0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e, 0x00,
+  0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00,
+  0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00,
+  0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x1f, 0xc0,
+  0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 13 */
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0xf7, 0xc0, 0x00,  //....@@+@@....
-  0x02, 0xc0, 0xe0, 0x00,  //...%@...@%...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x01, 0x00, 0x3f, 0xfe, 0x00, 0x05, 0xf7, 0xc0, 0x00, 0x02, 0xc0, 0xe0, 0xf8, 0x00, 0x4a, 0x01,
+  0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e,
+  0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x1f,
+  0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 13 */
-  0x00, 0xf8, 0xf0, 0x00,  //....@@%.@@...
-  0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%...
-  0x03, 0xcb, 0xc0, 0x00,  //...@@.%@@....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x0a, 0x00, 0xf8, 0xf0, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x03, 0xcb, 0xc0, 0xf8, 0x00, 0x4a, 0x01,
+  0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e,
+  0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x1f,
+  0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 13 */
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xbd, 0x00, 0x1f, 0x80,  //%@@+.....+@@%
-  0x7e, 0x00, 0x2f, 0x40,  //+@@%.....%@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x1f, 0xc0, 0xfd, 0x00,  //.+@@@...@@@+.
-  0x0b, 0xff, 0xf8, 0x00,  //..%@@@@@@@%..
-  0x01, 0xbf, 0x90, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x0a, 0x03, 0xf3, 0xf0, 0x00, 0x03, 0xf3, 0xf0, 0x00, 0x03, 0xf3, 0xf0, 0xf8, 0x00, 0x4a, 0x01,
+  0xbf, 0x90, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x1f, 0xc0, 0xfd, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e,
+  0x00, 0x2f, 0x40, 0xbd, 0x00, 0x1f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xc0, 0xfc,
+  0x00, 0x0f, 0xc0, 0xbd, 0x00, 0x1f, 0x80, 0x7e, 0x00, 0x2f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x1f,
+  0xc0, 0xfd, 0x00, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xbf, 0x90, 0xe8, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x20, 0x00, 0x08,  //.%........%.
-  0xbc, 0x00, 0x3e,  //%@@......@@%
-  0x3f, 0x00, 0xfc,  //.@@@....@@@.
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x03, 0xff, 0xc0,  //...@@@@@@...
-  0x00, 0xff, 0x00,  //....@@@@....
-  0x00, 0xff, 0x00,  //....@@@@....
-  0x03, 0xff, 0xc0,  //...@@@@@@...
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x3f, 0x00, 0xfc,  //.@@@....@@@.
-  0xbc, 0x00, 0x3e,  //%@@......@@%
-  0x20, 0x00, 0x08,  //.%........%.
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x23, 0x20, 0x00, 0x08, 0xbc, 0x00, 0x3e, 0x3f, 0x00, 0xfc, 0x0f, 0xc3, 0xf0, 0x03,
+  0xff, 0xc0, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x0f, 0xc3, 0xf0, 0x3f, 0x00,
+  0xfc, 0xbc, 0x00, 0x3e, 0x20, 0x00, 0x08, 0xe9, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x6f, 0xe0, 0x3c,  //....+%@@@%...@@
-  0x02, 0xff, 0xfd, 0xf0,  //...%@@@@@@@+@@.
-  0x07, 0xf0, 0x3f, 0xd0,  //..+@@@...@@@@+.
-  0x0f, 0xc0, 0x0f, 0xc0,  //..@@@.....@@@..
-  0x1f, 0x80, 0x0f, 0xd0,  //.+@@%.....@@@+.
-  0x2f, 0x40, 0x3f, 0xe0,  //.%@@+....@@@@%.
-  0x3f, 0x00, 0x7b, 0xf0,  //.@@@....+@%@@@.
-  0x3f, 0x00, 0xe3, 0xf0,  //.@@@....@%.@@@.
-  0x3f, 0x03, 0xc3, 0xf0,  //.@@@...@@..@@@.
-  0x3f, 0x0b, 0x43, 0xf0,  //.@@@..%@+..@@@.
-  0x3f, 0x0e, 0x03, 0xf0,  //.@@@..@%...@@@.
-  0x3f, 0x3c, 0x03, 0xf0,  //.@@@.@@....@@@.
-  0x3f, 0xb0, 0x03, 0xf0,  //.@@@%@.....@@@.
-  0x2f, 0xe0, 0x07, 0xe0,  //.%@@@%....+@@%.
-  0x1f, 0xc0, 0x0b, 0xd0,  //.+@@@.....%@@+.
-  0x0f, 0xc0, 0x0f, 0xc0,  //..@@@.....@@@..
-  0x2f, 0xe0, 0x3f, 0x40,  //.%@@@%...@@@+..
-  0x3a, 0xff, 0xfe, 0x00,  //.@%%@@@@@@@%...
-  0xa0, 0x6f, 0xe4, 0x00,  //%%..+%@@@%+....
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xec, 0x00, 0x49, 0x6f, 0xe0, 0x3c, 0x02, 0xff, 0xfd, 0xf0, 0x07, 0xf0, 0x3f, 0xd0, 0x0f, 0xc0,
+  0x0f, 0xc0, 0x1f, 0x80, 0x0f, 0xd0, 0x2f, 0x40, 0x3f, 0xe0, 0x3f, 0x00, 0x7b, 0xf0, 0x3f, 0x00,
+  0xe3, 0xf0, 0x3f, 0x03, 0xc3, 0xf0, 0x3f, 0x0b, 0x43, 0xf0, 0x3f, 0x0e, 0x03, 0xf0, 0x3f, 0x3c,
+  0x03, 0xf0, 0x3f, 0xb0, 0x03, 0xf0, 0x2f, 0xe0, 0x07, 0xe0, 0x1f, 0xc0, 0x0b, 0xd0, 0x0f, 0xc0,
+  0x0f, 0xc0, 0x2f, 0xe0, 0x3f, 0x40, 0x3a, 0xff, 0xfe, 0x00, 0xa0, 0x6f, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 12 */
-  0x00, 0xbc, 0x00,  //....%@@.....
-  0x00, 0x2e, 0x00,  //.....%@%....
-  0x00, 0x0b, 0x80,  //......%@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x00, 0xbc, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x0b, 0x80, 0xfb, 0x00, 0x38, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc,
+  0x1f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 12 */
-  0x00, 0x03, 0xd0,  //.......@@+..
-  0x00, 0x0b, 0x80,  //......%@%...
-  0x00, 0x2e, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x07, 0x00, 0x03, 0xd0, 0x00, 0x0b, 0x80, 0x00, 0x2e, 0xfa, 0x00, 0x38, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc, 0x1f,
+  0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 12 */
-  0x00, 0xbe, 0x00,  //....%@@%....
-  0x02, 0xd7, 0x80,  //...%@++@%...
-  0x0b, 0x41, 0xe0,  //..%@+..+@%..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x00, 0xbe, 0x00, 0x02, 0xd7, 0x80, 0x0b, 0x41, 0xe0, 0xfb, 0x00, 0x38, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc,
+  0x1f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 12 */
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x1f, 0xff, 0xf4,  //.+@@@@@@@@+.
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0x08, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0xfb, 0x00, 0x38, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc,
+  0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x3f, 0x41, 0xfc,
+  0x1f, 0xff, 0xf4, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 15 */
-  0x00, 0x03, 0xd0, 0x00,  //.......@@+.....
-  0x00, 0x0b, 0x80, 0x00,  //......%@%......
-  0x00, 0x2e, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0xbe, 0x00, 0x02, 0xf8,  //%@@%.......%@@%
-  0x3f, 0x40, 0x07, 0xf0,  //.@@@+.....+@@@.
-  0x2f, 0xc0, 0x0f, 0xe0,  //.%@@@.....@@@%.
-  0x0f, 0xd0, 0x1f, 0xc0,  //..@@@+...+@@@..
-  0x07, 0xf0, 0x3f, 0x40,  //..+@@@...@@@+..
-  0x03, 0xf8, 0xbf, 0x00,  //...@@@%.%@@@...
-  0x01, 0xfd, 0xfd, 0x00,  //...+@@@+@@@+...
-  0x00, 0xbf, 0xf8, 0x00,  //....%@@@@@%....
-  0x00, 0x3f, 0xf0, 0x00,  //.....@@@@@.....
-  0x00, 0x2f, 0xe0, 0x00,  //.....%@@@%.....
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x0f, 0xc0, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x09, 0x00, 0x03, 0xd0, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0x2e, 0xf7, 0x00, 0x4a, 0xbe, 0x00,
+  0x02, 0xf8, 0x3f, 0x40, 0x07, 0xf0, 0x2f, 0xc0, 0x0f, 0xe0, 0x0f, 0xd0, 0x1f, 0xc0, 0x07, 0xf0,
+  0x3f, 0x40, 0x03, 0xf8, 0xbf, 0x00, 0x01, 0xfd, 0xfd, 0x00, 0x00, 0xbf, 0xf8, 0x00, 0x00, 0x3f,
+  0xf0, 0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f,
+  0xc0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x0f, 0xc0, 0xe8, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0x90,  //@@@@@@@@%+..
-  0xff, 0xff, 0xf8,  //@@@@@@@@@@%.
-  0xfc, 0x01, 0xfd,  //@@@....+@@@+
-  0xfc, 0x00, 0x7e,  //@@@.....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x7e,  //@@@.....+@@%
-  0xfc, 0x01, 0xfd,  //@@@....+@@@+
-  0xff, 0xff, 0xf8,  //@@@@@@@@@@%.
-  0xff, 0xff, 0x90,  //@@@@@@@@%+..
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x36, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xff, 0xff, 0x90, 0xff,
+  0xff, 0xf8, 0xfc, 0x01, 0xfd, 0xfc, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x7e, 0xfc, 0x01, 0xfd, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x90, 0xfc, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xed, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x0b, 0xfd, 0x00,  //..%@@@@+....
-  0x3f, 0xff, 0x80,  //.@@@@@@@%...
-  0x7f, 0x0b, 0xd0,  //+@@@..%@@+..
-  0xfc, 0x03, 0xe0,  //@@@....@@%..
-  0xfc, 0x03, 0xf0,  //@@@....@@@..
-  0xfc, 0x1f, 0xe0,  //@@@..+@@@%..
-  0xfc, 0x7f, 0x00,  //@@@.+@@@....
-  0xfc, 0xfc, 0x00,  //@@@.@@@.....
-  0xfc, 0xfc, 0x00,  //@@@.@@@.....
-  0xfc, 0xfc, 0x00,  //@@@.@@@.....
-  0xfc, 0x7c, 0x00,  //@@@.+@@.....
-  0xfc, 0x1f, 0x80,  //@@@..+@@%...
-  0xfc, 0x03, 0xf4,  //@@@....@@@+.
-  0xfc, 0x00, 0xfc,  //@@@.....@@@.
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x80, 0xfe,  //@@@.%...@@@%
-  0xfc, 0xff, 0xfc,  //@@@.@@@@@@@.
-  0xfc, 0x2f, 0xe0,  //@@@..%@@@%..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x3b, 0x0b, 0xfd, 0x00, 0x3f, 0xff, 0x80, 0x7f, 0x0b, 0xd0, 0xfc, 0x03, 0xe0, 0xfc,
+  0x03, 0xf0, 0xfc, 0x1f, 0xe0, 0xfc, 0x7f, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0x7c, 0x00, 0xfc, 0x1f, 0x80, 0xfc, 0x03, 0xf4, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0x3f,
+  0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x80, 0xfe, 0xfc, 0xff, 0xfc, 0xfc, 0x2f, 0xe0, 0xef,
+  0x00,
 
   /*Unicode: U+00e0 (à) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x0b, 0xc0, 0x00,  //..%@@.......
-  0x03, 0xe0, 0x00,  //...@@%......
-  0x00, 0xf0, 0x00,  //....@@......
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0x1e, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf8, 0x00, 0x0d, 0x0b, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x1e, 0xfa, 0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f,
+  0x00, 0x00, 0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc,
+  0x00, 0x7f, 0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x03, 0xe0,  //.......@@%..
-  0x00, 0x0b, 0xc0,  //......%@@...
-  0x00, 0x0f, 0x00,  //......@@....
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0xb4, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x0c, 0x03, 0xe0, 0x00, 0x0b, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xb4,
+  0xfa, 0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc, 0x00,
+  0x7f, 0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0xff, 0x00,  //....@@@@....
-  0x01, 0xd7, 0x40,  //...+@++@+...
-  0x03, 0xc3, 0xc0,  //...@@..@@...
-  0x0b, 0x00, 0xe0,  //..%@....@%..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x0d, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x01, 0xd7, 0x40, 0x03, 0xc3, 0xc0, 0x0b, 0x00,
+  0xe0, 0xfb, 0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f,
+  0x00, 0x00, 0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc,
+  0x00, 0x7f, 0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x03, 0xe0, 0xf0,  //...@@%..@@..
-  0x0b, 0xf4, 0xf0,  //..%@@@+.@@..
-  0x0f, 0x5f, 0xe0,  //..@@++@@@%..
-  0x0f, 0x0b, 0xc0,  //..@@..%@@...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x0b, 0x03, 0xe0, 0xf0, 0x0b, 0xf4, 0xf0, 0x0f, 0x5f, 0xe0, 0x0f, 0x0b, 0xc0, 0xfb,
+  0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00, 0x00,
+  0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc, 0x00, 0x7f,
+  0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x08, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0xf8, 0x00, 0x29, 0x06,
+  0xff, 0x90, 0x3f, 0xff, 0xf8, 0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0x06, 0xff,
+  0xff, 0x2f, 0xff, 0xff, 0x7f, 0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc, 0x00, 0x7f, 0xfc, 0x00, 0xff,
+  0xbf, 0x02, 0xff, 0x3f, 0xff, 0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x01, 0xfd, 0x00,  //...+@@@+....
-  0x07, 0xff, 0x40,  //..+@@@@@+...
-  0x0f, 0x47, 0xc0,  //..@@+.+@@...
-  0x0f, 0x03, 0xc0,  //..@@...@@...
-  0x0f, 0x47, 0xc0,  //..@@+.+@@...
-  0x07, 0xff, 0x40,  //..+@@@@@+...
-  0x01, 0xfd, 0x00,  //...+@@@+....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x06, 0xff, 0x90,  //..+%@@@@%+..
-  0x3f, 0xff, 0xf8,  //.@@@@@@@@@%.
-  0x38, 0x01, 0xfd,  //.@%....+@@@+
-  0x00, 0x00, 0x7f,  //........+@@@
-  0x00, 0x00, 0x3f,  //.........@@@
-  0x06, 0xff, 0xff,  //..+%@@@@@@@@
-  0x2f, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0x40, 0x3f,  //+@@@+....@@@
-  0xfd, 0x00, 0x3f,  //@@@+.....@@@
-  0xfc, 0x00, 0x7f,  //@@@.....+@@@
-  0xfc, 0x00, 0xff,  //@@@.....@@@@
-  0xbf, 0x02, 0xff,  //%@@@...%@@@@
-  0x3f, 0xff, 0x7f,  //.@@@@@@@+@@@
-  0x0b, 0xf8, 0x3f,  //..%@@@%..@@@
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xfe, 0x00, 0x13, 0x01, 0xfd, 0x00, 0x07, 0xff, 0x40, 0x0f, 0x47, 0xc0, 0x0f, 0x03, 0xc0, 0x0f,
+  0x47, 0xc0, 0x07, 0xff, 0x40, 0x01, 0xfd, 0xfa, 0x00, 0x29, 0x06, 0xff, 0x90, 0x3f, 0xff, 0xf8,
+  0x38, 0x01, 0xfd, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0x06, 0xff, 0xff, 0x2f, 0xff, 0xff, 0x7f,
+  0x40, 0x3f, 0xfd, 0x00, 0x3f, 0xfc, 0x00, 0x7f, 0xfc, 0x00, 0xff, 0xbf, 0x02, 0xff, 0x3f, 0xff,
+  0x7f, 0x0b, 0xf8, 0x3f, 0xef, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x0b, 0xf9, 0x1f, 0xd0,  //..%@@@%+.+@@@+.
-  0x3f, 0xff, 0xbf, 0xf0,  //.@@@@@@@%@@@@@.
-  0x34, 0x1f, 0xf5, 0xf8,  //.@+..+@@@@++@@%
-  0x00, 0x07, 0xf0, 0xfc,  //......+@@@..@@@
-  0x00, 0x03, 0xf0, 0xfc,  //.......@@@..@@@
-  0x00, 0x03, 0xf0, 0xfc,  //.......@@@..@@@
-  0x07, 0xff, 0xff, 0xfc,  //..+@@@@@@@@@@@@
-  0x3f, 0xff, 0xff, 0xfc,  //.@@@@@@@@@@@@@@
-  0xbe, 0x03, 0xf0, 0x00,  //%@@%...@@@.....
-  0xfc, 0x03, 0xf0, 0x00,  //@@@....@@@.....
-  0xfc, 0x03, 0xf0, 0x00,  //@@@....@@@.....
-  0xfe, 0x0b, 0xfc, 0x08,  //@@@%..%@@@@...%
-  0x7f, 0xff, 0x7f, 0xfc,  //+@@@@@@@+@@@@@@
-  0x0b, 0xf8, 0x1f, 0xe4,  //..%@@@%..+@@@%+
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x37, 0x0b, 0xf9, 0x1f, 0xd0, 0x3f, 0xff, 0xbf, 0xf0, 0x34, 0x1f, 0xf5, 0xf8, 0x00,
+  0x07, 0xf0, 0xfc, 0x00, 0x03, 0xf0, 0xfc, 0x00, 0x03, 0xf0, 0xfc, 0x07, 0xff, 0xff, 0xfc, 0x3f,
+  0xff, 0xff, 0xfc, 0xbe, 0x03, 0xf0, 0x00, 0xfc, 0x03, 0xf0, 0x00, 0xfc, 0x03, 0xf0, 0x00, 0xfe,
+  0x0b, 0xfc, 0x08, 0x7f, 0xff, 0x7f, 0xfc, 0x0b, 0xf8, 0x1f, 0xe4, 0xe9, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0xbf, 0x80,  //....%@@@%..
-  0x0b, 0xff, 0xf4,  //..%@@@@@@@+
-  0x2f, 0xd0, 0x2c,  //.%@@@+...%@
-  0x7f, 0x00, 0x04,  //+@@@......+
-  0xbd, 0x00, 0x00,  //%@@+.......
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xfc, 0x00, 0x00,  //@@@........
-  0xbd, 0x00, 0x00,  //%@@+.......
-  0x7f, 0x00, 0x04,  //+@@@......+
-  0x2f, 0xd0, 0x2c,  //.%@@@+...%@
-  0x0b, 0xff, 0xf4,  //..%@@@@@@@+
-  0x01, 0xbf, 0x80,  //...+%@@@%..
-  0x00, 0x0b, 0x40,  //......%@+..
-  0x00, 0x03, 0x80,  //.......@%..
-  0x00, 0x07, 0xc0,  //......+@@..
-  0x00, 0xff, 0xc0,  //....@@@@@..
-  0x00, 0xbf, 0x00,  //....%@@@...
-  0x00, 0x00, 0x00,  //...........
-
+  0xe2, 0x00, 0x36, 0xbf, 0x80, 0x0b, 0xff, 0xf4, 0x2f, 0xd0, 0x2c, 0x7f, 0x00, 0x04, 0xbd, 0x00,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xbd, 0x00, 0x00,
+  0x7f, 0x00, 0x04, 0x2f, 0xd0, 0x2c, 0x0b, 0xff, 0xf4, 0x01, 0xbf, 0x80, 0x00, 0x0b, 0x40, 0x00,
+  0x03, 0x80, 0x00, 0x07, 0xc0, 0x00, 0xff, 0xc0, 0x00, 0xbf, 0xfd, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x0b, 0xc0, 0x00, 0x00,  //..%@@........
-  0x03, 0xe0, 0x00, 0x00,  //...@@%.......
-  0x00, 0xf0, 0x00, 0x00,  //....@@.......
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0x1e, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xbf, 0xd0, 0x00,  //....%@@@@+...
-  0x0b, 0xff, 0xfc, 0x00,  //..%@@@@@@@@..
-  0x2f, 0xc0, 0xbf, 0x00,  //.%@@@...%@@@.
-  0x3f, 0x00, 0x2f, 0x40,  //.@@@.....%@@+
-  0xbd, 0x00, 0x0f, 0x80,  //%@@+......@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xbc, 0x00, 0x00, 0x00,  //%@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x2f, 0x90, 0x1b, 0x00,  //.%@@%+...+%@.
-  0x0b, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x01, 0xbf, 0xe4, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf5, 0x00, 0x05, 0x0b, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0x3c, 0xfe, 0x00, 0x00, 0x1e, 0xf6, 0x00, 0x16, 0xbf, 0xd0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x2f,
+  0xc0, 0xbf, 0x00, 0x3f, 0x00, 0x2f, 0x40, 0xbd, 0x00, 0x0f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfe,
+  0xff, 0x00, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfc, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x7e,
+  0xfe, 0x00, 0x0a, 0x2f, 0x90, 0x1b, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x01, 0xbf, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0xe0, 0x00,  //.......@@%...
-  0x00, 0x0b, 0xc0, 0x00,  //......%@@....
-  0x00, 0x0f, 0x00, 0x00,  //......@@.....
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0xb4, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xbf, 0xd0, 0x00,  //....%@@@@+...
-  0x0b, 0xff, 0xfc, 0x00,  //..%@@@@@@@@..
-  0x2f, 0xc0, 0xbf, 0x00,  //.%@@@...%@@@.
-  0x3f, 0x00, 0x2f, 0x40,  //.@@@.....%@@+
-  0xbd, 0x00, 0x0f, 0x80,  //%@@+......@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xbc, 0x00, 0x00, 0x00,  //%@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x2f, 0x90, 0x1b, 0x00,  //.%@@%+...+%@.
-  0x0b, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x01, 0xbf, 0xe4, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf4, 0x00, 0x08, 0x03, 0xe0, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x3c,
+  0xfe, 0x00, 0x00, 0xb4, 0xf6, 0x00, 0x16, 0xbf, 0xd0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x2f, 0xc0,
+  0xbf, 0x00, 0x3f, 0x00, 0x2f, 0x40, 0xbd, 0x00, 0x0f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfe, 0xff,
+  0x00, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfc, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x7e, 0xfe,
+  0x00, 0x0a, 0x2f, 0x90, 0x1b, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x01, 0xbf, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0xff, 0x00, 0x00,  //....@@@@.....
-  0x01, 0xd7, 0x40, 0x00,  //...+@++@+....
-  0x03, 0xc3, 0xc0, 0x00,  //...@@..@@....
-  0x0b, 0x00, 0xe0, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xbf, 0xd0, 0x00,  //....%@@@@+...
-  0x0b, 0xff, 0xfc, 0x00,  //..%@@@@@@@@..
-  0x2f, 0xc0, 0xbf, 0x00,  //.%@@@...%@@@.
-  0x3f, 0x00, 0x2f, 0x40,  //.@@@.....%@@+
-  0xbd, 0x00, 0x0f, 0x80,  //%@@+......@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xbc, 0x00, 0x00, 0x00,  //%@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x2f, 0x90, 0x1b, 0x00,  //.%@@%+...+%@.
-  0x0b, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x01, 0xbf, 0xe4, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf4, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x0d, 0xff, 0x00, 0x00, 0x01, 0xd7, 0x40, 0x00, 0x03, 0xc3,
+  0xc0, 0x00, 0x0b, 0x00, 0xe0, 0xf7, 0x00, 0x16, 0xbf, 0xd0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x2f,
+  0xc0, 0xbf, 0x00, 0x3f, 0x00, 0x2f, 0x40, 0xbd, 0x00, 0x0f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfe,
+  0xff, 0x00, 0xc0, 0xfe, 0xff, 0x01, 0xc0, 0xfc, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x7e,
+  0xfe, 0x00, 0x0a, 0x2f, 0x90, 0x1b, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x01, 0xbf, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xc3, 0xf0, 0x00,  //..@@@..@@@...
-  0x0f, 0xc3, 0xf0, 0x00,  //..@@@..@@@...
-  0x0f, 0xc3, 0xf0, 0x00,  //..@@@..@@@...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xbf, 0xd0, 0x00,  //....%@@@@+...
-  0x0b, 0xff, 0xfc, 0x00,  //..%@@@@@@@@..
-  0x2f, 0xc0, 0xbf, 0x00,  //.%@@@...%@@@.
-  0x3f, 0x00, 0x2f, 0x40,  //.@@@.....%@@+
-  0xbd, 0x00, 0x0f, 0x80,  //%@@+......@@%
-  0xfc, 0x00, 0x0f, 0xc0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xfc, 0x00, 0x00, 0x00,  //@@@..........
-  0xbc, 0x00, 0x00, 0x00,  //%@@..........
-  0x7e, 0x00, 0x00, 0x00,  //+@@%.........
-  0x2f, 0x90, 0x1b, 0x00,  //.%@@%+...+%@.
-  0x0b, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x01, 0xbf, 0xe4, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf1, 0x00, 0x0a, 0x0f, 0xc3, 0xf0, 0x00, 0x0f, 0xc3, 0xf0, 0x00, 0x0f, 0xc3, 0xf0, 0xf3, 0x00,
+  0x16, 0xbf, 0xd0, 0x00, 0x0b, 0xff, 0xfc, 0x00, 0x2f, 0xc0, 0xbf, 0x00, 0x3f, 0x00, 0x2f, 0x40,
+  0xbd, 0x00, 0x0f, 0x80, 0xfc, 0x00, 0x0f, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x01, 0xc0,
+  0xfc, 0xfe, 0x00, 0x00, 0xbc, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x0a, 0x2f, 0x90, 0x1b, 0x00,
+  0x0b, 0xff, 0xff, 0x00, 0x01, 0xbf, 0xe4, 0xe8, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x0b, 0xc0, 0x00, 0x00,  //..%@@........
-  0x03, 0xe0, 0x00, 0x00,  //...@@%.......
-  0x00, 0xf0, 0x00, 0x00,  //....@@.......
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0x1e, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf5, 0x00, 0x05, 0x0b, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0xfe, 0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00,
+  0x3c, 0xfe, 0x00, 0x00, 0x1e, 0xf7, 0x00, 0x05, 0x3f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x02, 0x3f, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0,
+  0xe9, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0xe0, 0x00,  //.......@@%...
-  0x00, 0x0b, 0xc0, 0x00,  //......%@@....
-  0x00, 0x0f, 0x00, 0x00,  //......@@.....
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0xb4, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf4, 0x00, 0x08, 0x03, 0xe0, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x3c,
+  0xfe, 0x00, 0x00, 0xb4, 0xf7, 0x00, 0x05, 0x3f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x02, 0x3f, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xe9,
+  0x00,
 
   /*Unicode: U+00ee (î) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x3c, 0x00, 0x00,  //.....@@......
-  0x00, 0xff, 0x00, 0x00,  //....@@@@.....
-  0x01, 0xd7, 0x40, 0x00,  //...+@++@+....
-  0x03, 0xc3, 0xc0, 0x00,  //...@@..@@....
-  0x0b, 0x00, 0xe0, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf4, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x0d, 0xff, 0x00, 0x00, 0x01, 0xd7, 0x40, 0x00, 0x03, 0xc3,
+  0xc0, 0x00, 0x0b, 0x00, 0xe0, 0xf8, 0x00, 0x05, 0x3f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x02, 0x3f, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0,
+  0xe9, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x03, 0xf3, 0xf0, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x3f, 0xff, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf1, 0x00, 0x0a, 0x03, 0xf3, 0xf0, 0x00, 0x03, 0xf3, 0xf0, 0x00, 0x03, 0xf3, 0xf0, 0xf4, 0x00,
+  0x05, 0x3f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe,
+  0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe,
+  0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x02, 0x3f, 0x00,
+  0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xe9, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x1f, 0xd0, 0x00,  //.+@@@+......
-  0x0b, 0xf6, 0xf0,  //..%@@@+%@@..
-  0x03, 0xff, 0x40,  //...@@@@@+...
-  0x0b, 0xfe, 0x00,  //..%@@@@%....
-  0x0d, 0xbf, 0x40,  //..@+%@@@+...
-  0x00, 0x3f, 0xc0,  //.....@@@@...
-  0x02, 0xff, 0xf0,  //...%@@@@@@..
-  0x0f, 0xff, 0xf8,  //..@@@@@@@@%.
-  0x3f, 0x80, 0xfc,  //.@@@%...@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x82, 0xfc,  //.@@@%..%@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x3b, 0x1f, 0xd0, 0x00, 0x0b, 0xf6, 0xf0, 0x03, 0xff, 0x40, 0x0b, 0xfe, 0x00, 0x0d,
+  0xbf, 0x40, 0x00, 0x3f, 0xc0, 0x02, 0xff, 0xf0, 0x0f, 0xff, 0xf8, 0x3f, 0x80, 0xfc, 0x7e, 0x00,
+  0xbd, 0xbd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xbd, 0x00, 0x7e, 0x7e, 0x00, 0xbd, 0x3f, 0x82, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef,
+  0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x03, 0xe0, 0xf0,  //...@@%..@@.
-  0x0b, 0xf4, 0xf0,  //..%@@@+.@@.
-  0x0f, 0x5f, 0xe0,  //..@@++@@@%.
-  0x0f, 0x0b, 0xc0,  //..@@..%@@..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x6f, 0x80,  //@@@.+%@@%..
-  0xfd, 0xff, 0xf0,  //@@@+@@@@@@.
-  0xff, 0x43, 0xf8,  //@@@@+..@@@%
-  0xfe, 0x01, 0xfc,  //@@@%...+@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x0b, 0x03, 0xe0, 0xf0, 0x0b, 0xf4, 0xf0, 0x0f, 0x5f, 0xe0, 0x0f, 0x0b, 0xc0, 0xfb,
+  0x00, 0x29, 0xfc, 0x6f, 0x80, 0xfd, 0xff, 0xf0, 0xff, 0x43, 0xf8, 0xfe, 0x01, 0xfc, 0xfc, 0x00,
+  0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc,
+  0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x0b, 0xc0, 0x00,  //..%@@.......
-  0x03, 0xe0, 0x00,  //...@@%......
-  0x00, 0xf0, 0x00,  //....@@......
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0x1e, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf8, 0x00, 0x0d, 0x0b, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x1e, 0xfa, 0x00, 0x29, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd,
+  0xbd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd,
+  0x00, 0x7e, 0x7e, 0x00, 0xbd, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x03, 0xe0,  //.......@@%..
-  0x00, 0x0b, 0xc0,  //......%@@...
-  0x00, 0x0f, 0x00,  //......@@....
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0xb4, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x0c, 0x03, 0xe0, 0x00, 0x0b, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xb4,
+  0xfa, 0x00, 0x29, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd, 0xbd,
+  0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00,
+  0x7e, 0x7e, 0x00, 0xbd, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x3c, 0x00,  //.....@@.....
-  0x00, 0xff, 0x00,  //....@@@@....
-  0x01, 0xd7, 0x40,  //...+@++@+...
-  0x03, 0xc3, 0xc0,  //...@@..@@...
-  0x0b, 0x00, 0xe0,  //..%@....@%..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf7, 0x00, 0x0d, 0x3c, 0x00, 0x00, 0xff, 0x00, 0x01, 0xd7, 0x40, 0x03, 0xc3, 0xc0, 0x0b, 0x00,
+  0xe0, 0xfb, 0x00, 0x29, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd,
+  0xbd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd,
+  0x00, 0x7e, 0x7e, 0x00, 0xbd, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x03, 0xe0, 0xf0,  //...@@%..@@..
-  0x0b, 0xf4, 0xf0,  //..%@@@+.@@..
-  0x0f, 0x5f, 0xe0,  //..@@++@@@%..
-  0x0f, 0x0b, 0xc0,  //..@@..%@@...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x0b, 0x03, 0xe0, 0xf0, 0x0b, 0xf4, 0xf0, 0x0f, 0x5f, 0xe0, 0x0f, 0x0b, 0xc0, 0xfb,
+  0x00, 0x29, 0x02, 0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd, 0xbd, 0x00,
+  0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e,
+  0x7e, 0x00, 0xbd, 0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x0f, 0xc3, 0xf0,  //..@@@..@@@..
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xbd, 0x00, 0x7e,  //%@@+....+@@%
-  0x7e, 0x00, 0xbd,  //+@@%....%@@+
-  0x3f, 0x41, 0xfc,  //.@@@+..+@@@.
-  0x0f, 0xff, 0xf0,  //..@@@@@@@@..
-  0x02, 0xff, 0x80,  //...%@@@@%...
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x08, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0x0f, 0xc3, 0xf0, 0xf8, 0x00, 0x29, 0x02,
+  0xff, 0x80, 0x0f, 0xff, 0xf0, 0x3f, 0x41, 0xfc, 0x7e, 0x00, 0xbd, 0xbd, 0x00, 0x7e, 0xfc, 0x00,
+  0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xbd, 0x00, 0x7e, 0x7e, 0x00, 0xbd,
+  0x3f, 0x41, 0xfc, 0x0f, 0xff, 0xf0, 0x02, 0xff, 0x80, 0xef, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xc0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd8, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xf7, 0x00, 0xfe, 0xff,
+  0x00, 0xc0, 0xfe, 0xff, 0x00, 0xc0, 0xf8, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0x00,
+  0x00, 0x3f, 0xdf, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x20,  //.............%.
-  0x00, 0x2f, 0xe4, 0xb8,  //.....%@@@%+.%@%
-  0x01, 0xff, 0xff, 0xe0,  //...+@@@@@@@@@%.
-  0x03, 0xf8, 0x1f, 0xc0,  //...@@@%..+@@@..
-  0x07, 0xe0, 0x0f, 0xc0,  //..+@@%....@@@..
-  0x0b, 0xd0, 0x3f, 0xe0,  //..%@@+...@@@@%.
-  0x0f, 0xc0, 0xb3, 0xf0,  //..@@@...%@.@@@.
-  0x0f, 0xc1, 0xc3, 0xf0,  //..@@@..+@..@@@.
-  0x0f, 0xc3, 0x43, 0xf0,  //..@@@..@+..@@@.
-  0x0f, 0xce, 0x03, 0xf0,  //..@@@.@%...@@@.
-  0x0b, 0xfc, 0x07, 0xe0,  //..%@@@@...+@@%.
-  0x03, 0xf0, 0x0b, 0xd0,  //...@@@....%@@+.
-  0x03, 0xf8, 0x1f, 0xc0,  //...@@@%..+@@@..
-  0x0f, 0xbf, 0xff, 0x40,  //..@@%@@@@@@@+..
-  0x3d, 0x1b, 0xf8, 0x00,  //.@@+.+%@@@%....
-  0x24, 0x00, 0x00, 0x00,  //.%+............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xda, 0x00, 0x39, 0x20, 0x00, 0x2f, 0xe4, 0xb8, 0x01, 0xff, 0xff, 0xe0, 0x03, 0xf8, 0x1f, 0xc0,
+  0x07, 0xe0, 0x0f, 0xc0, 0x0b, 0xd0, 0x3f, 0xe0, 0x0f, 0xc0, 0xb3, 0xf0, 0x0f, 0xc1, 0xc3, 0xf0,
+  0x0f, 0xc3, 0x43, 0xf0, 0x0f, 0xce, 0x03, 0xf0, 0x0b, 0xfc, 0x07, 0xe0, 0x03, 0xf0, 0x0b, 0xd0,
+  0x03, 0xf8, 0x1f, 0xc0, 0x0f, 0xbf, 0xff, 0x40, 0x3d, 0x1b, 0xf8, 0x00, 0x24, 0xea, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x0b, 0xc0, 0x00,  //..%@@......
-  0x03, 0xe0, 0x00,  //...@@%.....
-  0x00, 0xf0, 0x00,  //....@@.....
-  0x00, 0x3c, 0x00,  //.....@@....
-  0x00, 0x1e, 0x00,  //.....+@%...
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfd, 0x02, 0xfc,  //@@@+...%@@@
-  0xbf, 0x07, 0xfc,  //%@@@..+@@@@
-  0x3f, 0xfd, 0xfc,  //.@@@@@@+@@@
-  0x0b, 0xe4, 0xfc,  //..%@@%+.@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf8, 0x00, 0x0d, 0x0b, 0xc0, 0x00, 0x03, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x1e, 0xfa, 0x00, 0x29, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc,
+  0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfd, 0x02, 0xfc, 0xbf, 0x07, 0xfc, 0x3f, 0xfd, 0xfc, 0x0b, 0xe4, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x03, 0xe0,  //.......@@%.
-  0x00, 0x0b, 0xc0,  //......%@@..
-  0x00, 0x0f, 0x00,  //......@@...
-  0x00, 0x3c, 0x00,  //.....@@....
-  0x00, 0xb4, 0x00,  //....%@+....
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfd, 0x02, 0xfc,  //@@@+...%@@@
-  0xbf, 0x07, 0xfc,  //%@@@..+@@@@
-  0x3f, 0xfd, 0xfc,  //.@@@@@@+@@@
-  0x0b, 0xe4, 0xfc,  //..%@@%+.@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x0c, 0x03, 0xe0, 0x00, 0x0b, 0xc0, 0x00, 0x0f, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xb4,
+  0xfa, 0x00, 0x29, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00,
+  0xfc, 0xfd, 0x02, 0xfc, 0xbf, 0x07, 0xfc, 0x3f, 0xfd, 0xfc, 0x0b, 0xe4, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0xb8, 0x00,  //....%@%....
-  0x00, 0xfc, 0x00,  //....@@@....
-  0x02, 0xce, 0x00,  //...%@.@%...
-  0x03, 0x47, 0x00,  //...@+.+@...
-  0x0b, 0x03, 0x80,  //..%@...@%..
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfd, 0x02, 0xfc,  //@@@+...%@@@
-  0xbf, 0x07, 0xfc,  //%@@@..+@@@@
-  0x3f, 0xfd, 0xfc,  //.@@@@@@+@@@
-  0x0b, 0xe4, 0xfc,  //..%@@%+.@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf7, 0x00, 0x0d, 0xb8, 0x00, 0x00, 0xfc, 0x00, 0x02, 0xce, 0x00, 0x03, 0x47, 0x00, 0x0b, 0x03,
+  0x80, 0xfb, 0x00, 0x29, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc,
+  0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc,
+  0x00, 0xfc, 0xfd, 0x02, 0xfc, 0xbf, 0x07, 0xfc, 0x3f, 0xfd, 0xfc, 0x0b, 0xe4, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 11 */
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x3f, 0x03, 0xf0,  //.@@@...@@@.
-  0x3f, 0x03, 0xf0,  //.@@@...@@@.
-  0x3f, 0x03, 0xf0,  //.@@@...@@@.
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfc, 0x00, 0xfc,  //@@@.....@@@
-  0xfd, 0x02, 0xfc,  //@@@+...%@@@
-  0xbf, 0x07, 0xfc,  //%@@@..+@@@@
-  0x3f, 0xfd, 0xfc,  //.@@@@@@+@@@
-  0x0b, 0xe4, 0xfc,  //..%@@%+.@@@
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00,  //...........
-
+  0xf5, 0x00, 0x08, 0x3f, 0x03, 0xf0, 0x3f, 0x03, 0xf0, 0x3f, 0x03, 0xf0, 0xf8, 0x00, 0x29, 0xfc,
+  0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00,
+  0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0x00, 0xfc, 0xfd, 0x02, 0xfc,
+  0xbf, 0x07, 0xfc, 0x3f, 0xfd, 0xfc, 0x0b, 0xe4, 0xfc, 0xef, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0xf8, 0x00,  //........@@%..
-  0x00, 0x02, 0xf0, 0x00,  //.......%@@...
-  0x00, 0x03, 0xc0, 0x00,  //.......@@....
-  0x00, 0x0f, 0x00, 0x00,  //......@@.....
-  0x00, 0x2d, 0x00, 0x00,  //.....%@+.....
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfd, 0x00, 0x1f, 0xc0,  //@@@+.....+@@@
-  0x7f, 0x00, 0x3f, 0x40,  //+@@@.....@@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x2f, 0x80, 0xbe, 0x00,  //.%@@%...%@@%.
-  0x0f, 0xc0, 0xfc, 0x00,  //..@@@...@@@..
-  0x0f, 0xd1, 0xfc, 0x00,  //..@@@+.+@@@..
-  0x07, 0xf3, 0xf4, 0x00,  //..+@@@.@@@+..
-  0x03, 0xf7, 0xf0, 0x00,  //...@@@+@@@...
-  0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%...
-  0x00, 0xff, 0xd0, 0x00,  //....@@@@@+...
-  0x00, 0xff, 0xc0, 0x00,  //....@@@@@....
-  0x00, 0x7f, 0x40, 0x00,  //....+@@@+....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x7e, 0x00, 0x00,  //....+@@%.....
-  0x00, 0xfd, 0x00, 0x00,  //....@@@+.....
-  0x01, 0xfc, 0x00, 0x00,  //...+@@@......
-  0x03, 0xf8, 0x00, 0x00,  //...@@@%......
-  0x3f, 0xf0, 0x00, 0x00,  //.@@@@@.......
-  0x3f, 0x80, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xf3, 0x00, 0x0b, 0xf8, 0x00, 0x00, 0x02, 0xf0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0xfe,
+  0x00, 0x00, 0x2d, 0xf7, 0x00, 0x31, 0xfd, 0x00, 0x1f, 0xc0, 0x7f, 0x00, 0x3f, 0x40, 0x3f, 0x00,
+  0x3f, 0x00, 0x2f, 0x80, 0xbe, 0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xd1, 0xfc, 0x00, 0x07, 0xf3,
+  0xf4, 0x00, 0x03, 0xf7, 0xf0, 0x00, 0x02, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xd0, 0x00, 0x00, 0xff,
+  0xc0, 0x00, 0x00, 0x7f, 0x40, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x10, 0xfd,
+  0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0x80,
+  0xfb, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 12 */
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00,  //............
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0xfe, 0xff, 0xf0,  //@@@%@@@@@@..
-  0xff, 0x81, 0xfc,  //@@@@%..+@@@.
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfc, 0x00, 0x3f,  //@@@......@@@
-  0xfd, 0x00, 0x7e,  //@@@+....+@@%
-  0xfe, 0x00, 0xbd,  //@@@%....%@@+
-  0xff, 0x41, 0xfc,  //@@@@+..+@@@.
-  0xfe, 0xff, 0xf4,  //@@@%@@@@@@+.
-  0xfc, 0x7f, 0x80,  //@@@.+@@@%...
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0xfc, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00,  //............
-
+  0xf5, 0x00, 0x48, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x7f, 0x80, 0xfe, 0xff, 0xf0, 0xff, 0x81, 0xfc, 0xfe, 0x00,
+  0xbd, 0xfd, 0x00, 0x7e, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfc, 0x00, 0x3f,
+  0xfd, 0x00, 0x7e, 0xfe, 0x00, 0xbd, 0xff, 0x41, 0xfc, 0xfe, 0xff, 0xf4, 0xfc, 0x7f, 0x80, 0xfc,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0xfc, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x03, 0xf0, 0xfc, 0x00,  //...@@@..@@@..
-  0x03, 0xf0, 0xfc, 0x00,  //...@@@..@@@..
-  0x03, 0xf0, 0xfc, 0x00,  //...@@@..@@@..
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00,  //.............
-  0xfd, 0x00, 0x1f, 0xc0,  //@@@+.....+@@@
-  0x7f, 0x00, 0x3f, 0x40,  //+@@@.....@@@+
-  0x3f, 0x00, 0x3f, 0x00,  //.@@@.....@@@.
-  0x2f, 0x80, 0xbe, 0x00,  //.%@@%...%@@%.
-  0x0f, 0xc0, 0xfc, 0x00,  //..@@@...@@@..
-  0x0f, 0xd1, 0xfc, 0x00,  //..@@@+.+@@@..
-  0x07, 0xf3, 0xf4, 0x00,  //..+@@@.@@@+..
-  0x03, 0xf7, 0xf0, 0x00,  //...@@@+@@@...
-  0x02, 0xff, 0xe0, 0x00,  //...%@@@@@%...
-  0x00, 0xff, 0xd0, 0x00,  //....@@@@@+...
-  0x00, 0xff, 0xc0, 0x00,  //....@@@@@....
-  0x00, 0x7f, 0x40, 0x00,  //....+@@@+....
-  0x00, 0x3f, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x7e, 0x00, 0x00,  //....+@@%.....
-  0x00, 0xfd, 0x00, 0x00,  //....@@@+.....
-  0x01, 0xfc, 0x00, 0x00,  //...+@@@......
-  0x03, 0xf8, 0x00, 0x00,  //...@@@%......
-  0x3f, 0xf0, 0x00, 0x00,  //.@@@@@.......
-  0x3f, 0x80, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0xf1, 0x00, 0x0a, 0x03, 0xf0, 0xfc, 0x00, 0x03, 0xf0, 0xfc, 0x00, 0x03, 0xf0, 0xfc, 0xf4, 0x00,
+  0x31, 0xfd, 0x00, 0x1f, 0xc0, 0x7f, 0x00, 0x3f, 0x40, 0x3f, 0x00, 0x3f, 0x00, 0x2f, 0x80, 0xbe,
+  0x00, 0x0f, 0xc0, 0xfc, 0x00, 0x0f, 0xd1, 0xfc, 0x00, 0x07, 0xf3, 0xf4, 0x00, 0x03, 0xf7, 0xf0,
+  0x00, 0x02, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xd0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0x40,
+  0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7e, 0xfe, 0x00, 0x10, 0xfd, 0x00, 0x00, 0x01, 0xfc, 0x00,
+  0x00, 0x03, 0xf8, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x3f, 0x80, 0xfb, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 4
   /*Unicode: U+00a0 ( ) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0x89, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xbf, 0xb0,  //%@%
-  0xcf, 0xc0,  //@@@
-  0xdf, 0xd0,  //@@@
-  0xef, 0xe0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xf7, 0x00, 0x05, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xfb, 0x00, 0x19, 0xbf, 0xb0, 0xcf, 0xc0,
+  0xdf, 0xd0, 0xef, 0xe0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0,
+  0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf5, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x01, 0x7c, 0xef, 0xea, 0x30,  //....+@@@@%.
-  0x00, 0x5f, 0xff, 0xff, 0xff, 0xf0,  //..+@@@@@@@@
-  0x06, 0xff, 0xe6, 0x1f, 0x15, 0xc0,  //.+@@@+.@.+@
-  0x2f, 0xff, 0x20, 0x0f, 0x00, 0x00,  //.@@@...@...
-  0x9f, 0xf8, 0x00, 0x0f, 0x00, 0x00,  //%@@%...@...
-  0xdf, 0xf2, 0x00, 0x0f, 0x00, 0x00,  //@@@....@...
-  0xff, 0xf0, 0x00, 0x0f, 0x00, 0x00,  //@@@....@...
-  0xff, 0xf0, 0x00, 0x0f, 0x00, 0x00,  //@@@....@...
-  0xdf, 0xf2, 0x00, 0x0f, 0x00, 0x00,  //@@@....@...
-  0x9f, 0xf8, 0x00, 0x0f, 0x00, 0x00,  //%@@%...@...
-  0x2f, 0xff, 0x30, 0x0f, 0x00, 0x00,  //.@@@...@...
-  0x06, 0xff, 0xf7, 0x2f, 0x15, 0xc0,  //.+@@@+.@.+@
-  0x00, 0x6f, 0xff, 0xff, 0xff, 0xf0,  //..+@@@@@@@@
-  0x00, 0x01, 0x7c, 0xef, 0xea, 0x30,  //....+@@@@%.
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xda, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f,
+  0xfe, 0x00, 0x06, 0x01, 0x7c, 0xef, 0xea, 0x30, 0x00, 0x5f, 0xfe, 0xff, 0x3e, 0xf0, 0x06, 0xff,
+  0xe6, 0x1f, 0x15, 0xc0, 0x2f, 0xff, 0x20, 0x0f, 0x00, 0x00, 0x9f, 0xf8, 0x00, 0x0f, 0x00, 0x00,
+  0xdf, 0xf2, 0x00, 0x0f, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x0f,
+  0x00, 0x00, 0xdf, 0xf2, 0x00, 0x0f, 0x00, 0x00, 0x9f, 0xf8, 0x00, 0x0f, 0x00, 0x00, 0x2f, 0xff,
+  0x30, 0x0f, 0x00, 0x00, 0x06, 0xff, 0xf7, 0x2f, 0x15, 0xc0, 0x00, 0x6f, 0xfe, 0xff, 0x06, 0xf0,
+  0x00, 0x01, 0x7c, 0xef, 0xea, 0x30, 0xfe, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xfc, 0x00,
+  0x00, 0x0f, 0xfc, 0x00, 0x00, 0x0f, 0xf3, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x02, 0x9d, 0xff, 0xd9, 0x30,  //......%@@@@%.
-  0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xf0,  //....+@@@@@@@@
-  0x00, 0x02, 0xff, 0xf8, 0x10, 0x15, 0xb0,  //....@@@%...+%
-  0x00, 0x09, 0xff, 0x90, 0x00, 0x00, 0x00,  //...%@@%......
-  0x00, 0x0d, 0xff, 0x30, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //@@@@@@@@@@@..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //@@@@@@@@@@@..
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xdc, 0x00, 0x07, 0x02, 0x9d, 0xff, 0xd9, 0x30, 0x00, 0x00, 0x6f, 0xfe, 0xff, 0x0b, 0xf0, 0x00,
+  0x02, 0xff, 0xf8, 0x10, 0x15, 0xb0, 0x00, 0x09, 0xff, 0x90, 0xfd, 0x00, 0x02, 0x0d, 0xff, 0x30,
+  0xfd, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0xfc, 0xff, 0x01, 0xf0, 0x00, 0xfc, 0xff, 0x04, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01,
+  0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfd, 0x00, 0xfb, 0xff,
+  0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x98, 0x00, 0x00, 0x00, 0x07, 0x90,  //%%.......+%
-  0x8f, 0xb4, 0xcf, 0xc4, 0xaf, 0x70,  //%@%+@@@+%@+
-  0x0a, 0xff, 0xff, 0xff, 0xfb, 0x00,  //.%@@@@@@@%.
-  0x03, 0xfd, 0x40, 0x3d, 0xf4, 0x00,  //..@@+..@@+.
-  0x0c, 0xf3, 0x00, 0x03, 0xfc, 0x00,  //.@@.....@@.
-  0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00,  //.@@.....@@.
-  0x0c, 0xf3, 0x00, 0x04, 0xfc, 0x00,  //.@@....+@@.
-  0x04, 0xfd, 0x30, 0x4d, 0xf4, 0x00,  //.+@@..+@@+.
-  0x0a, 0xff, 0xff, 0xff, 0xfb, 0x00,  //.%@@@@@@@%.
-  0x7f, 0xb4, 0xcf, 0xc4, 0xaf, 0x80,  //+@%+@@@+%@%
-  0x98, 0x00, 0x00, 0x00, 0x07, 0x90,  //%%.......+%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xbf, 0x00, 0x00, 0x98, 0xfe, 0x00, 0x08, 0x07, 0x90, 0x8f, 0xb4, 0xcf, 0xc4, 0xaf, 0x70, 0x0a,
+  0xfe, 0xff, 0x20, 0xfb, 0x00, 0x03, 0xfd, 0x40, 0x3d, 0xf4, 0x00, 0x0c, 0xf3, 0x00, 0x03, 0xfc,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x0c, 0xf3, 0x00, 0x04, 0xfc, 0x00, 0x04, 0xfd, 0x30,
+  0x4d, 0xf4, 0x00, 0x0a, 0xfe, 0xff, 0x08, 0xfb, 0x00, 0x7f, 0xb4, 0xcf, 0xc4, 0xaf, 0x80, 0x98,
+  0xfe, 0x00, 0x01, 0x07, 0x90, 0xd1, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xbf, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xb0,  //%@@%.......%@@%
-  0x2f, 0xff, 0x40, 0x00, 0x00, 0x4f, 0xff, 0x20,  //.@@@+.....+@@@.
-  0x08, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00,  //.%@@@.....@@@%.
-  0x00, 0xef, 0xf6, 0x00, 0x06, 0xff, 0xe0, 0x00,  //..@@@+...+@@@..
-  0x00, 0x6f, 0xfe, 0x00, 0x1e, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0x0c, 0xff, 0x80, 0x8f, 0xfb, 0x00, 0x00,  //...@@@%.%@@%...
-  0x00, 0x03, 0xff, 0xf4, 0xff, 0xf2, 0x00, 0x00,  //....@@@+@@@....
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0x00, 0x0c, 0xff, 0xfb, 0x00, 0x00, 0x00,  //.....@@@@%.....
-  0x00, 0x00, 0x02, 0xff, 0xf2, 0x00, 0x00, 0x00,  //......@@@......
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd9, 0x00, 0x01, 0xbf, 0xfb, 0xfe, 0x00, 0x28, 0x0b, 0xff, 0xb0, 0x2f, 0xff, 0x40, 0x00, 0x00,
+  0x4f, 0xff, 0x20, 0x08, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00, 0x00, 0xef, 0xf6, 0x00, 0x06,
+  0xff, 0xe0, 0x00, 0x00, 0x6f, 0xfe, 0x00, 0x1e, 0xff, 0x50, 0x00, 0x00, 0x0c, 0xff, 0x80, 0x8f,
+  0xfb, 0xfe, 0x00, 0x07, 0x03, 0xff, 0xf4, 0xff, 0xf2, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x01, 0x00,
+  0x0f, 0xfb, 0xff, 0xfe, 0x00, 0x02, 0x0c, 0xff, 0xfb, 0xfc, 0x00, 0x02, 0x02, 0xff, 0xf2, 0xfe,
+  0x00, 0x00, 0x0f, 0xfb, 0xff, 0x01, 0x00, 0x0f, 0xfb, 0xff, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfb,
+  0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00,
+  0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xce, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-  0x00,  //..
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0xff,  //@@
-  0x00,  //..
-  0x00,  //..
-
+  0xfc, 0x00, 0xf7, 0xff, 0xfe, 0x00, 0xf7, 0xff, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x18, 0xdf, 0xfd, 0x83, 0x00,  //...%@@@@%..
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x00,  //..@@@@@@@@.
-  0x0c, 0xfb, 0x30, 0x03, 0x7c, 0x00,  //.@@%....+@.
-  0x0f, 0xf1, 0x00, 0x00, 0x00, 0x00,  //.@@........
-  0x0e, 0xf5, 0x00, 0x00, 0x00, 0x00,  //.@@+.......
-  0x08, 0xff, 0x81, 0x00, 0x00, 0x00,  //.%@@%......
-  0x02, 0xff, 0xfe, 0x80, 0x00, 0x00,  //..@@@@%....
-  0x2e, 0xf6, 0xbf, 0xfe, 0x60, 0x00,  //.@@+%@@@+..
-  0xbf, 0x40, 0x03, 0xbf, 0xfb, 0x00,  //%@+...%@@%.
-  0xff, 0x00, 0x00, 0x04, 0xef, 0x80,  //@@.....+@@%
-  0xdf, 0x70, 0x00, 0x00, 0x4f, 0xe0,  //@@+.....+@@
-  0x6f, 0xf8, 0x00, 0x00, 0x0f, 0xe0,  //+@@%.....@@
-  0x07, 0xff, 0xe7, 0x00, 0x7f, 0x90,  //.+@@@+..+@%
-  0x00, 0x2b, 0xff, 0xea, 0xfc, 0x00,  //...%@@@%@@.
-  0x00, 0x00, 0x4c, 0xff, 0xf1, 0x00,  //....+@@@@..
-  0x00, 0x00, 0x00, 0x5e, 0xf9, 0x00,  //......+@@%.
-  0x00, 0x00, 0x00, 0x04, 0xfe, 0x00,  //.......+@@.
-  0x00, 0x00, 0x00, 0x01, 0xff, 0x00,  //........@@.
-  0x0c, 0x73, 0x00, 0x3c, 0xfb, 0x00,  //.@+....@@%.
-  0x0f, 0xff, 0xff, 0xff, 0xe2, 0x00,  //.@@@@@@@@..
-  0x03, 0x8d, 0xff, 0xd9, 0x10, 0x00,  //..%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe2, 0x00, 0x05, 0x18, 0xdf, 0xfd, 0x83, 0x00, 0x03, 0xfd, 0xff, 0x08, 0x00, 0x0c, 0xfb, 0x30,
+  0x03, 0x7c, 0x00, 0x0f, 0xf1, 0xfd, 0x00, 0x01, 0x0e, 0xf5, 0xfd, 0x00, 0x02, 0x08, 0xff, 0x81,
+  0xfe, 0x00, 0x2e, 0x02, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x2e, 0xf6, 0xbf, 0xfe, 0x60, 0x00, 0xbf,
+  0x40, 0x03, 0xbf, 0xfb, 0x00, 0xff, 0x00, 0x00, 0x04, 0xef, 0x80, 0xdf, 0x70, 0x00, 0x00, 0x4f,
+  0xe0, 0x6f, 0xf8, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xff, 0xe7, 0x00, 0x7f, 0x90, 0x00, 0x2b, 0xff,
+  0xea, 0xfc, 0xfe, 0x00, 0x02, 0x4c, 0xff, 0xf1, 0xfd, 0x00, 0x01, 0x5e, 0xf9, 0xfd, 0x00, 0x01,
+  0x04, 0xfe, 0xfd, 0x00, 0x09, 0x01, 0xff, 0x00, 0x0c, 0x73, 0x00, 0x3c, 0xfb, 0x00, 0x0f, 0xfe,
+  0xff, 0x06, 0xe2, 0x00, 0x03, 0x8d, 0xff, 0xd9, 0x10, 0xe8, 0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xf0, 0x0f, 0xff,  //@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff,  //@@@..@@@
-  0xff, 0xf0, 0x0f, 0xff,  //@@@..@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xf1, 0x00, 0x0b, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xa5,
+  0x00,
 
   /*Unicode: U+00a9 (©) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x09, 0xe7, 0x20, 0x02, 0x7e, 0x90, 0x00,  //...%@+....+@%...
-  0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00,  //..%%........%%..
-  0x09, 0xa0, 0x04, 0xae, 0xfe, 0xb4, 0x0a, 0x90,  //.%%..+%@@@%+.%%.
-  0x2e, 0x00, 0x9f, 0xa2, 0x01, 0x5b, 0x00, 0xe2,  //.@..%@%...+%..@.
-  0x97, 0x05, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x79,  //%+.+@%........+%
-  0xd2, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2d,  //@..@@..........@
-  0xf0, 0x0f, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x0f,  //@..@@..........@
-  0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f,  //@..@@..........@
-  0xd2, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x2d,  //@..@@..........@
-  0x97, 0x06, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x79,  //%+.+@%........+%
-  0x2e, 0x00, 0x9f, 0xa3, 0x01, 0x4b, 0x00, 0xe2,  //.@..%@%...+%..@.
-  0x08, 0xb0, 0x04, 0xbe, 0xfe, 0xb4, 0x0a, 0x80,  //.%%..+%@@@%+.%%.
-  0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00,  //..%%........%%..
-  0x00, 0x08, 0xe7, 0x20, 0x02, 0x7e, 0x80, 0x00,  //...%@+....+@%...
-  0x00, 0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xc7, 0x00, 0x03, 0x29, 0xdf, 0xfd, 0x92, 0xfe, 0x00, 0x08, 0x09, 0xe7, 0x20, 0x02, 0x7e, 0x90,
+  0x00, 0x00, 0xba, 0xfd, 0x00, 0x14, 0xab, 0x00, 0x09, 0xa0, 0x04, 0xae, 0xfe, 0xb4, 0x0a, 0x90,
+  0x2e, 0x00, 0x9f, 0xa2, 0x01, 0x5b, 0x00, 0xe2, 0x97, 0x05, 0xfb, 0xfd, 0x00, 0x03, 0x79, 0xd2,
+  0x0c, 0xf3, 0xfd, 0x00, 0x03, 0x2d, 0xf0, 0x0f, 0xf1, 0xfd, 0x00, 0x03, 0x0f, 0xf0, 0x0f, 0xf0,
+  0xfd, 0x00, 0x03, 0x0f, 0xd2, 0x0c, 0xf3, 0xfd, 0x00, 0x03, 0x2d, 0x97, 0x06, 0xfa, 0xfd, 0x00,
+  0x12, 0x79, 0x2e, 0x00, 0x9f, 0xa3, 0x01, 0x4b, 0x00, 0xe2, 0x08, 0xb0, 0x04, 0xbe, 0xfe, 0xb4,
+  0x0a, 0x80, 0x00, 0xbb, 0xfd, 0x00, 0x08, 0xab, 0x00, 0x00, 0x08, 0xe7, 0x20, 0x02, 0x7e, 0x80,
+  0xfe, 0x00, 0x03, 0x29, 0xdf, 0xfd, 0x92, 0xc7, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x03, 0xae, 0xfe, 0xc5, 0x00,  //..%@@@@+..
-  0x0c, 0x51, 0x03, 0xbf, 0x70,  //.@+...%@+.
-  0x00, 0x00, 0x00, 0x1f, 0xd0,  //.......@@.
-  0x03, 0xae, 0xff, 0xff, 0xf0,  //..%@@@@@@.
-  0x4f, 0xd4, 0x00, 0x0f, 0xf0,  //+@@+...@@.
-  0xdf, 0x30, 0x00, 0x1f, 0xf0,  //@@.....@@.
-  0xff, 0x00, 0x00, 0x4f, 0xf0,  //@@....+@@.
-  0xdf, 0x20, 0x00, 0xbf, 0xf0,  //@@....%@@.
-  0x6f, 0xb1, 0x18, 0xff, 0xf0,  //+@%..%@@@.
-  0x06, 0xdf, 0xea, 0x2f, 0xf0,  //.+@@@%.@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x9f, 0xff, 0xff, 0xff, 0xf1,  //%@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe8, 0x00, 0x09, 0x03, 0xae, 0xfe, 0xc5, 0x00, 0x0c, 0x51, 0x03, 0xbf, 0x70, 0xfe, 0x00, 0x24,
+  0x1f, 0xd0, 0x03, 0xae, 0xff, 0xff, 0xf0, 0x4f, 0xd4, 0x00, 0x0f, 0xf0, 0xdf, 0x30, 0x00, 0x1f,
+  0xf0, 0xff, 0x00, 0x00, 0x4f, 0xf0, 0xdf, 0x20, 0x00, 0xbf, 0xf0, 0x6f, 0xb1, 0x18, 0xff, 0xf0,
+  0x06, 0xdf, 0xea, 0x2f, 0xf0, 0xfc, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x00, 0xf1, 0xc0, 0x00,
 
   /*Unicode: U+00ab («) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08,  //.....%.....%
-  0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f,  //....%@....%@
-  0x00, 0x0b, 0xfd, 0x00, 0x0b, 0xfd,  //...%@@...%@@
-  0x01, 0xcf, 0xd1, 0x01, 0xcf, 0xc1,  //..@@@...@@@.
-  0x1d, 0xfc, 0x10, 0x1d, 0xfa, 0x00,  //.@@@...@@%..
-  0xef, 0xb0, 0x00, 0xef, 0x90, 0x00,  //@@%...@@%...
-  0xef, 0xb0, 0x00, 0xef, 0x90, 0x00,  //@@%...@@%...
-  0x1d, 0xfc, 0x00, 0x1d, 0xfa, 0x00,  //.@@@...@@%..
-  0x01, 0xcf, 0xd1, 0x01, 0xcf, 0xc1,  //..@@@...@@@.
-  0x00, 0x0b, 0xfd, 0x00, 0x0b, 0xfd,  //...%@@...%@@
-  0x00, 0x00, 0xaf, 0x00, 0x00, 0xaf,  //....%@....%@
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08,  //.....%.....%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xbd, 0x00, 0x45, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x9f, 0x00, 0x0b, 0xfd,
+  0x00, 0x0b, 0xfd, 0x01, 0xcf, 0xd1, 0x01, 0xcf, 0xc1, 0x1d, 0xfc, 0x10, 0x1d, 0xfa, 0x00, 0xef,
+  0xb0, 0x00, 0xef, 0x90, 0x00, 0xef, 0xb0, 0x00, 0xef, 0x90, 0x00, 0x1d, 0xfc, 0x00, 0x1d, 0xfa,
+  0x00, 0x01, 0xcf, 0xd1, 0x01, 0xcf, 0xc1, 0x00, 0x0b, 0xfd, 0x00, 0x0b, 0xfd, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0xaf, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0xd7, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xa6, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xf0, 0xfc,
+  0x00, 0x01, 0x0f, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xf0, 0xb4, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xc1, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xfe, 0xff, 0x00, 0xf0, 0xd1, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x09, 0xe7, 0x20, 0x02, 0x7e, 0x90, 0x00,  //...%@+....+@%...
-  0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00,  //..%%........%%..
-  0x09, 0xa0, 0xff, 0xff, 0xfd, 0x80, 0x0a, 0x90,  //.%%.@@@@@@%..%%.
-  0x2e, 0x00, 0xff, 0x00, 0x17, 0xfb, 0x00, 0xe2,  //.@..@@...+@%..@.
-  0x97, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x79,  //%+..@@....@@..+%
-  0xd2, 0x00, 0xff, 0x00, 0x17, 0xfa, 0x00, 0x2d,  //@...@@...+@%...@
-  0xf0, 0x00, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x0f,  //@...@@@@@@+....@
-  0xf0, 0x00, 0xff, 0x17, 0xff, 0x40, 0x00, 0x0f,  //@...@@.+@@+....@
-  0xd2, 0x00, 0xff, 0x00, 0x6f, 0xe0, 0x00, 0x2d,  //@...@@..+@@....@
-  0x97, 0x00, 0xff, 0x00, 0x0b, 0xf9, 0x00, 0x79,  //%+..@@...%@%..+%
-  0x2e, 0x00, 0xff, 0x00, 0x02, 0xff, 0x20, 0xe2,  //.@..@@....@@..@.
-  0x08, 0xb0, 0xff, 0x00, 0x00, 0x9f, 0xba, 0x80,  //.%%.@@....%@%%%.
-  0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xab, 0x00,  //..%%........%%..
-  0x00, 0x08, 0xe7, 0x20, 0x02, 0x7e, 0x80, 0x00,  //...%@+....+@%...
-  0x00, 0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0xc7, 0x00, 0x03, 0x29, 0xdf, 0xfd, 0x92, 0xfe, 0x00, 0x08, 0x09, 0xe7, 0x20, 0x02, 0x7e, 0x90,
+  0x00, 0x00, 0xba, 0xfd, 0x00, 0x53, 0xab, 0x00, 0x09, 0xa0, 0xff, 0xff, 0xfd, 0x80, 0x0a, 0x90,
+  0x2e, 0x00, 0xff, 0x00, 0x17, 0xfb, 0x00, 0xe2, 0x97, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x79,
+  0xd2, 0x00, 0xff, 0x00, 0x17, 0xfa, 0x00, 0x2d, 0xf0, 0x00, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x0f,
+  0xf0, 0x00, 0xff, 0x17, 0xff, 0x40, 0x00, 0x0f, 0xd2, 0x00, 0xff, 0x00, 0x6f, 0xe0, 0x00, 0x2d,
+  0x97, 0x00, 0xff, 0x00, 0x0b, 0xf9, 0x00, 0x79, 0x2e, 0x00, 0xff, 0x00, 0x02, 0xff, 0x20, 0xe2,
+  0x08, 0xb0, 0xff, 0x00, 0x00, 0x9f, 0xba, 0x80, 0x00, 0xbb, 0xfd, 0x00, 0x08, 0xab, 0x00, 0x00,
+  0x08, 0xe7, 0x20, 0x02, 0x7e, 0x80, 0xfe, 0x00, 0x03, 0x29, 0xdf, 0xfd, 0x92, 0xc7, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xed, 0x00, 0xf9, 0xff, 0xa5, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x02, 0xbf, 0xfa, 0x20,  //..%@@%..
-  0x2e, 0xff, 0xff, 0xe2,  //.@@@@@@.
-  0xbf, 0xb1, 0x1b, 0xfa,  //%@%..%@%
-  0xff, 0x10, 0x01, 0xff,  //@@....@@
-  0xff, 0x10, 0x01, 0xff,  //@@....@@
-  0xbf, 0xa1, 0x1b, 0xfb,  //%@%..%@%
-  0x3f, 0xff, 0xff, 0xe2,  //.@@@@@@.
-  0x03, 0xbf, 0xfb, 0x20,  //..%@@%..
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xed, 0x00, 0x1f, 0x02, 0xbf, 0xfa, 0x20, 0x2e, 0xff, 0xff, 0xe2, 0xbf, 0xb1, 0x1b, 0xfa, 0xff,
+  0x10, 0x01, 0xff, 0xff, 0x10, 0x01, 0xff, 0xbf, 0xa1, 0x1b, 0xfb, 0x3f, 0xff, 0xff, 0xe2, 0x03,
+  0xbf, 0xfb, 0x20, 0xbd, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xbf, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfe, 0x00, 0xf3, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xe9, 0x00, 0xf3, 0xff, 0xd7, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x4b, 0xfe, 0xc5, 0x00,  //+%@@@+.
-  0xb4, 0x02, 0xbf, 0x70,  //%+..%@+
-  0x00, 0x00, 0x1f, 0xe0,  //.....@@
-  0x00, 0x00, 0x1f, 0xf0,  //.....@@
-  0x00, 0x00, 0x7f, 0xd0,  //....+@@
-  0x00, 0x02, 0xff, 0x70,  //....@@+
-  0x00, 0x1e, 0xfc, 0x00,  //...@@@.
-  0x01, 0xdf, 0xd1, 0x00,  //..@@@..
-  0x1d, 0xfd, 0x10, 0x00,  //.@@@...
-  0xcf, 0xd1, 0x00, 0x00,  //@@@....
-  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xed, 0x00, 0x27, 0x4b, 0xfe, 0xc5, 0x00, 0xb4, 0x02, 0xbf, 0x70, 0x00, 0x00, 0x1f, 0xe0, 0x00,
+  0x00, 0x1f, 0xf0, 0x00, 0x00, 0x7f, 0xd0, 0x00, 0x02, 0xff, 0x70, 0x00, 0x1e, 0xfc, 0x00, 0x01,
+  0xdf, 0xd1, 0x00, 0x1d, 0xfd, 0x10, 0x00, 0xcf, 0xd1, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xf0, 0xc9,
+  0x00,
 
   /*Unicode: U+00b3 (³) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x39, 0xef, 0xec, 0x60,  //.%@@@@+.
-  0xc5, 0x10, 0x29, 0xfa,  //@+...%@%
-  0x00, 0x00, 0x01, 0xff,  //......@@
-  0x00, 0x00, 0x29, 0xf8,  //.....%@%
-  0x00, 0xff, 0xff, 0x60,  //..@@@@+.
-  0x00, 0x00, 0x4d, 0xf5,  //....+@@+
-  0x00, 0x00, 0x03, 0xfd,  //......@@
-  0x00, 0x00, 0x00, 0xff,  //......@@
-  0x00, 0x00, 0x04, 0xfc,  //.....+@@
-  0xb4, 0x11, 0x4e, 0xf4,  //%+..+@@+
-  0x3b, 0xff, 0xea, 0x30,  //.%@@@%..
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xed, 0x00, 0x1b, 0x39, 0xef, 0xec, 0x60, 0xc5, 0x10, 0x29, 0xfa, 0x00, 0x00, 0x01, 0xff, 0x00,
+  0x00, 0x29, 0xf8, 0x00, 0xff, 0xff, 0x60, 0x00, 0x00, 0x4d, 0xf5, 0x00, 0x00, 0x03, 0xfd, 0xfe,
+  0x00, 0x0c, 0xff, 0x00, 0x00, 0x04, 0xfc, 0xb4, 0x11, 0x4e, 0xf4, 0x3b, 0xff, 0xea, 0x30, 0xc9,
+  0x00,
 
   /*Unicode: U+00b4 (´) , Width: 6 */
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x0c, 0xf9,  //...@@%
-  0x00, 0x8f, 0xc0,  //..%@@.
-  0x03, 0xfd, 0x10,  //..@@..
-  0x0e, 0xf2, 0x00,  //.@@...
-  0xaf, 0x50, 0x00,  //%@+...
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00,  //......
-
+  0xf7, 0x00, 0x0c, 0x0c, 0xf9, 0x00, 0x8f, 0xc0, 0x03, 0xfd, 0x10, 0x0e, 0xf2, 0x00, 0xaf, 0x50,
+  0xbe, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf1, 0x00, 0x02, 0xff, 0xf0, 0x00,  //@@@.....@@@..
-  0xff, 0xf5, 0x00, 0x07, 0xff, 0xf0, 0x00,  //@@@+...+@@@..
-  0xff, 0xfd, 0x30, 0x4e, 0xff, 0xf3, 0x00,  //@@@@..+@@@@..
-  0xff, 0xce, 0xff, 0xff, 0x9f, 0xff, 0xf0,  //@@@@@@@@%@@@@
-  0xff, 0xb3, 0xcf, 0xd4, 0x0a, 0xfe, 0x90,  //@@%.@@@+.%@@%
-  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbb, 0x00, 0x63, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0x00, 0xff, 0xf1, 0x00, 0x02, 0xff, 0xf0, 0x00, 0xff, 0xf5, 0x00, 0x07, 0xff, 0xf0, 0x00,
+  0xff, 0xfd, 0x30, 0x4e, 0xff, 0xf3, 0x00, 0xff, 0xce, 0xff, 0xff, 0x9f, 0xff, 0xf0, 0xff, 0xb3,
+  0xcf, 0xd4, 0x0a, 0xfe, 0x90, 0xff, 0xb0, 0xfc, 0x00, 0x01, 0xff, 0xb0, 0xfc, 0x00, 0x01, 0xff,
+  0xb0, 0xfc, 0x00, 0x01, 0xff, 0xb0, 0xfc, 0x00, 0x01, 0xff, 0xb0, 0xf5, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x17, 0xce, 0xff, 0xff, 0xff,  //...+@@@@@@@@
-  0x04, 0xef, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@
-  0x2f, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@@@@@..@@
-  0x9f, 0xff, 0xff, 0xff, 0x00, 0xff,  //%@@@@@@@..@@
-  0xef, 0xff, 0xff, 0xff, 0x00, 0xff,  //@@@@@@@@..@@
-  0xff, 0xff, 0xff, 0xff, 0x00, 0xff,  //@@@@@@@@..@@
-  0xef, 0xff, 0xff, 0xff, 0x00, 0xff,  //@@@@@@@@..@@
-  0xaf, 0xff, 0xff, 0xff, 0x00, 0xff,  //%@@@@@@@..@@
-  0x2f, 0xff, 0xff, 0xff, 0x00, 0xff,  //.@@@@@@@..@@
-  0x04, 0xef, 0xff, 0xff, 0x00, 0xff,  //.+@@@@@@..@@
-  0x00, 0x17, 0xce, 0xff, 0x00, 0xff,  //...+@@@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0xff, 0x00, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe2, 0x00, 0x01, 0x17, 0xce, 0xfe, 0xff, 0x01, 0x04, 0xef, 0xfd, 0xff, 0x00, 0x2f, 0xfe, 0xff,
+  0x02, 0x00, 0xff, 0x9f, 0xfe, 0xff, 0x02, 0x00, 0xff, 0xef, 0xfe, 0xff, 0x00, 0x00, 0xfc, 0xff,
+  0x02, 0x00, 0xff, 0xef, 0xfe, 0xff, 0x02, 0x00, 0xff, 0xaf, 0xfe, 0xff, 0x02, 0x00, 0xff, 0x2f,
+  0xfe, 0xff, 0x0d, 0x00, 0xff, 0x04, 0xef, 0xff, 0xff, 0x00, 0xff, 0x00, 0x17, 0xce, 0xff, 0x00,
+  0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02,
+  0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe,
+  0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00,
+  0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02, 0xff, 0x00, 0xff, 0xfe, 0x00, 0x02,
+  0xff, 0x00, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 3 */
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0xff, 0xf0,  //@@@
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-  0x00, 0x00,  //...
-
+  0xe7, 0x00, 0x07, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xe7, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 5 */
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00,  //.....
-  0x00, 0xaf, 0x40,  //..%@+
-  0x00, 0x1f, 0xb0,  //...@%
-  0x00, 0x4f, 0xf0,  //..+@@
-  0xff, 0xff, 0xd0,  //@@@@@
-  0xbf, 0xfc, 0x30,  //%@@@.
-  0x00, 0x00, 0x00,  //.....
-
+  0xb8, 0x00, 0x0d, 0xaf, 0x40, 0x00, 0x1f, 0xb0, 0x00, 0x4f, 0xf0, 0xff, 0xff, 0xd0, 0xbf, 0xfc,
+  0x30, 0xfe, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x27, 0xcf, 0xf0, 0x00,  //.+@@@...
-  0xd7, 0x2f, 0xf0, 0x00,  //@+.@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0x00, 0x0f, 0xf0, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00,  //........
-
+  0xed, 0x00, 0x27, 0x27, 0xcf, 0xf0, 0x00, 0xd7, 0x2f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xfd, 0xff, 0xc9, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x0c, 0xf4, 0x04, 0xfc, 0x00,  //.@@+.+@@.
-  0x7f, 0x70, 0x00, 0x7f, 0x70,  //+@+...+@+
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xff, 0x00, 0x00, 0x0f, 0xf0,  //@@.....@@
-  0xdf, 0x20, 0x00, 0x2f, 0xd0,  //@@.....@@
-  0x7f, 0x70, 0x00, 0x7f, 0x70,  //+@+...+@+
-  0x0d, 0xe4, 0x04, 0xfc, 0x00,  //.@@+.+@@.
-  0x00, 0x8e, 0xfe, 0x80, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x9f, 0xff, 0xff, 0xff, 0x80,  //%@@@@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xe7, 0x00, 0x2f, 0x8e, 0xfe, 0x80, 0x00, 0x0c, 0xf4, 0x04, 0xfc, 0x00, 0x7f, 0x70, 0x00, 0x7f,
+  0x70, 0xdf, 0x20, 0x00, 0x2f, 0xd0, 0xff, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xf0,
+  0xdf, 0x20, 0x00, 0x2f, 0xd0, 0x7f, 0x70, 0x00, 0x7f, 0x70, 0x0d, 0xe4, 0x04, 0xfc, 0x00, 0x00,
+  0x8e, 0xfe, 0x80, 0xfb, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x00, 0x80, 0xc0, 0x00,
 
   /*Unicode: U+00bb (») , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x80, 0x00, 0x00, 0x80, 0x00, 0x00,  //%.....%.....
-  0xf9, 0x00, 0x00, 0xf9, 0x00, 0x00,  //@%....@%....
-  0xdf, 0xb0, 0x00, 0xdf, 0xb0, 0x00,  //@@%...@@%...
-  0x1c, 0xfc, 0x10, 0x1d, 0xfc, 0x10,  //.@@@...@@@..
-  0x00, 0xaf, 0xd1, 0x01, 0xcf, 0xd1,  //..%@@...@@@.
-  0x00, 0x09, 0xfe, 0x00, 0x0b, 0xfe,  //...%@@...%@@
-  0x00, 0x09, 0xfe, 0x00, 0x0b, 0xfe,  //...%@@...%@@
-  0x00, 0xaf, 0xd1, 0x01, 0xcf, 0xd1,  //..%@@...@@@.
-  0x1c, 0xfc, 0x10, 0x1d, 0xfc, 0x10,  //.@@@...@@@..
-  0xdf, 0xb0, 0x00, 0xdf, 0xb0, 0x00,  //@@%...@@%...
-  0xf9, 0x00, 0x00, 0xf9, 0x00, 0x00,  //@%....@%....
-  0x80, 0x00, 0x00, 0x80, 0x00, 0x00,  //%.....%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xbf, 0x00, 0x45, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xf9, 0x00, 0x00, 0xdf,
+  0xb0, 0x00, 0xdf, 0xb0, 0x00, 0x1c, 0xfc, 0x10, 0x1d, 0xfc, 0x10, 0x00, 0xaf, 0xd1, 0x01, 0xcf,
+  0xd1, 0x00, 0x09, 0xfe, 0x00, 0x0b, 0xfe, 0x00, 0x09, 0xfe, 0x00, 0x0b, 0xfe, 0x00, 0xaf, 0xd1,
+  0x01, 0xcf, 0xd1, 0x1c, 0xfc, 0x10, 0x1d, 0xfc, 0x10, 0xdf, 0xb0, 0x00, 0xdf, 0xb0, 0x00, 0xf9,
+  0x00, 0x00, 0xf9, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0xd5, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x02, 0x7c, 0xff, 0x00, 0x00, 0x00, 0x00,  //..+@@@........
-  0x0d, 0x72, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@+.@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x0f, 0xff, 0xff, 0xff, 0xf1, 0x48, 0xbc,  //.@@@@@@@@.+%%@
-  0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51,  //......+%@@@%+.
-  0x15, 0x8c, 0xfd, 0xa6, 0x30, 0x00, 0x00,  //.+%@@@%+......
-  0xcb, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00,  //.........+@@..
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0x00,  //.........@@@..
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x00,  //........@%@@..
-  0x00, 0x00, 0x00, 0x07, 0xf1, 0xff, 0x00,  //.......+@.@@..
-  0x00, 0x00, 0x00, 0x2f, 0x70, 0xff, 0x00,  //.......@+.@@..
-  0x00, 0x00, 0x00, 0xcd, 0x00, 0xff, 0x00,  //......@@..@@..
-  0x00, 0x00, 0x07, 0xf5, 0x00, 0xff, 0x00,  //.....+@+..@@..
-  0x00, 0x00, 0x0f, 0xb0, 0x00, 0xff, 0x00,  //.....@%...@@..
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0,  //.....@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xec, 0x00, 0x02, 0x02, 0x7c, 0xff, 0xfd, 0x00, 0x02, 0x0d, 0x72, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0x0f,
+  0xfe, 0xff, 0x13, 0xf1, 0x48, 0xbc, 0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51, 0x15, 0x8c, 0xfd,
+  0xa6, 0x30, 0x00, 0x00, 0xcb, 0x84, 0x10, 0xf9, 0x00, 0x01, 0x07, 0xff, 0xfc, 0x00, 0x01, 0x2f,
+  0xff, 0xfc, 0x00, 0x01, 0xca, 0xff, 0xfd, 0x00, 0x02, 0x07, 0xf1, 0xff, 0xfd, 0x00, 0x02, 0x2f,
+  0x70, 0xff, 0xfd, 0x00, 0x02, 0xcd, 0x00, 0xff, 0xfe, 0x00, 0x03, 0x07, 0xf5, 0x00, 0xff, 0xfe,
+  0x00, 0x03, 0x0f, 0xb0, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfc, 0x00,
+  0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf2, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x02, 0x7c, 0xff, 0x00, 0x00, 0x00, 0x00,  //..+@@@........
-  0x0d, 0x72, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@+.@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x0f, 0xff, 0xff, 0xff, 0xf1, 0x48, 0xbc,  //.@@@@@@@@.+%%@
-  0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51,  //......+%@@@%+.
-  0x15, 0x8c, 0xfd, 0xa6, 0x30, 0x00, 0x00,  //.+%@@@%+......
-  0xcb, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x04, 0xbf, 0xec, 0x50,  //.......+%@@@+.
-  0x00, 0x00, 0x00, 0x0b, 0x40, 0x2b, 0xf7,  //.......%+..%@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe,  //............@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,  //............@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfd,  //...........+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf7,  //...........@@+
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xef, 0xc0,  //..........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x1d, 0xfd, 0x10,  //.........@@@..
-  0x00, 0x00, 0x00, 0x01, 0xdf, 0xd1, 0x00,  //........@@@...
-  0x00, 0x00, 0x00, 0x0c, 0xfd, 0x10, 0x00,  //.......@@@....
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,  //.......@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xec, 0x00, 0x02, 0x02, 0x7c, 0xff, 0xfd, 0x00, 0x02, 0x0d, 0x72, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0x0f,
+  0xfe, 0xff, 0x13, 0xf1, 0x48, 0xbc, 0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51, 0x15, 0x8c, 0xfd,
+  0xa6, 0x30, 0x00, 0x00, 0xcb, 0x84, 0x10, 0xfa, 0x00, 0x03, 0x04, 0xbf, 0xec, 0x50, 0xfe, 0x00,
+  0x03, 0x0b, 0x40, 0x2b, 0xf7, 0xfc, 0x00, 0x01, 0x01, 0xfe, 0xfc, 0x00, 0x01, 0x01, 0xff, 0xfc,
+  0x00, 0x01, 0x07, 0xfd, 0xfc, 0x00, 0x01, 0x2f, 0xf7, 0xfd, 0x00, 0x02, 0x01, 0xef, 0xc0, 0xfd,
+  0x00, 0x02, 0x1d, 0xfd, 0x10, 0xfe, 0x00, 0x02, 0x01, 0xdf, 0xd1, 0xfd, 0x00, 0x02, 0x0c, 0xfd,
+  0x10, 0xfd, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xf3, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x03, 0x9e, 0xfe, 0xc6, 0x00, 0x00, 0x00,  //..%@@@@+......
-  0x0c, 0x51, 0x02, 0x9f, 0xa0, 0x00, 0x00,  //.@+...%@%.....
-  0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x02, 0x9f, 0x80, 0x00, 0x00,  //......%@%.....
-  0x00, 0x0f, 0xff, 0xf6, 0x00, 0x00, 0x00,  //...@@@@+......
-  0x00, 0x00, 0x04, 0xdf, 0x50, 0x00, 0x00,  //.....+@@+.....
-  0x00, 0x00, 0x00, 0x3f, 0xd0, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x00, 0x4f, 0xc0, 0x00, 0x00,  //......+@@.....
-  0x0b, 0x41, 0x14, 0xef, 0x40, 0x00, 0x00,  //.%+..+@@+.....
-  0x03, 0xbf, 0xfe, 0xa3, 0x01, 0x48, 0xbc,  //..%@@@%...+%%@
-  0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51,  //......+%@@@%+.
-  0x15, 0x8c, 0xfd, 0xa6, 0x30, 0x00, 0x00,  //.+%@@@%+......
-  0xcb, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00,  //.........+@@..
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0x00,  //.........@@@..
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x00,  //........@%@@..
-  0x00, 0x00, 0x00, 0x07, 0xf1, 0xff, 0x00,  //.......+@.@@..
-  0x00, 0x00, 0x00, 0x2f, 0x70, 0xff, 0x00,  //.......@+.@@..
-  0x00, 0x00, 0x00, 0xcd, 0x00, 0xff, 0x00,  //......@@..@@..
-  0x00, 0x00, 0x07, 0xf5, 0x00, 0xff, 0x00,  //.....+@+..@@..
-  0x00, 0x00, 0x0f, 0xb0, 0x00, 0xff, 0x00,  //.....@%...@@..
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0,  //.....@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xec, 0x00, 0x03, 0x03, 0x9e, 0xfe, 0xc6, 0xfe, 0x00, 0x04, 0x0c, 0x51, 0x02, 0x9f, 0xa0, 0xfc,
+  0x00, 0x01, 0x1f, 0xf0, 0xfd, 0x00, 0x02, 0x02, 0x9f, 0x80, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xf6,
+  0xfc, 0x00, 0x02, 0x04, 0xdf, 0x50, 0xfc, 0x00, 0x01, 0x3f, 0xd0, 0xfc, 0x00, 0x01, 0x0f, 0xf0,
+  0xfc, 0x00, 0x22, 0x4f, 0xc0, 0x00, 0x00, 0x0b, 0x41, 0x14, 0xef, 0x40, 0x00, 0x00, 0x03, 0xbf,
+  0xfe, 0xa3, 0x01, 0x48, 0xbc, 0x00, 0x00, 0x03, 0x6a, 0xdf, 0xc8, 0x51, 0x15, 0x8c, 0xfd, 0xa6,
+  0x30, 0x00, 0x00, 0xcb, 0x84, 0x10, 0xf9, 0x00, 0x01, 0x07, 0xff, 0xfc, 0x00, 0x01, 0x2f, 0xff,
+  0xfc, 0x00, 0x01, 0xca, 0xff, 0xfd, 0x00, 0x02, 0x07, 0xf1, 0xff, 0xfd, 0x00, 0x02, 0x2f, 0x70,
+  0xff, 0xfd, 0x00, 0x02, 0xcd, 0x00, 0xff, 0xfe, 0x00, 0x03, 0x07, 0xf5, 0x00, 0xff, 0xfe, 0x00,
+  0x03, 0x0f, 0xb0, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00,
+  0xff, 0xfb, 0x00, 0x00, 0xff, 0xf2, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x00, 0xff, 0xf0, 0x00,  //....@@@...
-  0x00, 0x02, 0xff, 0xe0, 0x00,  //....@@@...
-  0x00, 0x0a, 0xff, 0xa0, 0x00,  //...%@@%...
-  0x00, 0x6f, 0xff, 0x50, 0x00,  //..+@@@+...
-  0x07, 0xff, 0xfb, 0x00, 0x00,  //.+@@@%....
-  0x5f, 0xff, 0xc0, 0x00, 0x00,  //+@@@@.....
-  0xcf, 0xfd, 0x10, 0x00, 0x00,  //@@@@......
-  0xff, 0xf3, 0x00, 0x00, 0x00,  //@@@.......
-  0xef, 0xf0, 0x00, 0x00, 0x09,  //@@@......%
-  0x8f, 0xf9, 0x00, 0x16, 0xdf,  //%@@%...+@@
-  0x0c, 0xff, 0xff, 0xff, 0xf5,  //.@@@@@@@@+
-  0x00, 0x7c, 0xff, 0xd8, 0x10,  //..+@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xe6, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xf4,
+  0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x01, 0xff, 0xf0, 0xfe, 0x00, 0x22, 0xff, 0xf0, 0x00, 0x00,
+  0x02, 0xff, 0xe0, 0x00, 0x00, 0x0a, 0xff, 0xa0, 0x00, 0x00, 0x6f, 0xff, 0x50, 0x00, 0x07, 0xff,
+  0xfb, 0x00, 0x00, 0x5f, 0xff, 0xc0, 0x00, 0x00, 0xcf, 0xfd, 0x10, 0x00, 0x00, 0xff, 0xf3, 0xfe,
+  0x00, 0x0a, 0xef, 0xf0, 0x00, 0x00, 0x09, 0x8f, 0xf9, 0x00, 0x16, 0xdf, 0x0c, 0xfe, 0xff, 0x05,
+  0xf5, 0x00, 0x7c, 0xff, 0xd8, 0x10, 0xe3, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 15 */
-  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00, 0x00,  //....%@@........
-  0x00, 0x00, 0x08, 0xfb, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x03, 0x00, 0x00, 0x8f, 0xc0, 0xfb, 0x00, 0x01, 0x08, 0xfb, 0xfa, 0x00, 0x01, 0x8f, 0x90, 0xec,
+  0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x0d, 0xff,
+  0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0x70, 0xfd,
+  0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0xfe, 0x00,
+  0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0xfe, 0x00,
+  0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,
+  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x04, 0xfc,
+  0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x0e, 0xff, 0x30, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e, 0xff, 0x30, 0x8f, 0xf9, 0xfe, 0x00,
+  0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04, 0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 15 */
-  0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00, 0x00,  //.......@@+.....
-  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfe, 0x00, 0x01, 0x0c, 0xf7, 0xfb, 0x00, 0x01, 0xbf, 0x80, 0xfc, 0x00, 0x01, 0x09, 0xf8, 0xeb,
+  0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfc, 0x00, 0x02, 0x0d, 0xff,
+  0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x03, 0x7f, 0xff, 0xff, 0x70, 0xfd,
+  0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0xfe, 0x00,
+  0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0xfe, 0x00,
+  0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,
+  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc, 0xff, 0x02, 0xf0, 0x00, 0x04, 0xfc,
+  0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x0e, 0xff, 0x30, 0x00,
+  0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e, 0xff, 0x30, 0x8f, 0xf9, 0xfe, 0x00,
+  0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04, 0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 15 */
-  0x00, 0x00, 0x01, 0xef, 0xe1, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x0c, 0xe4, 0xec, 0x00, 0x00, 0x00,  //.....@@+@@.....
-  0x00, 0x00, 0x9e, 0x20, 0x2e, 0x90, 0x00, 0x00,  //....%@...@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x04, 0x00, 0x00, 0x01, 0xef, 0xe1, 0xfc, 0x00, 0x02, 0x0c, 0xe4, 0xec, 0xfc, 0x00, 0x03, 0x9e,
+  0x20, 0x2e, 0x90, 0xed, 0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfc,
+  0x00, 0x02, 0x0d, 0xff, 0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x03, 0x7f,
+  0xff, 0xff, 0x70, 0xfd, 0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01, 0xff, 0xf1,
+  0xff, 0xf1, 0xfe, 0x00, 0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b, 0xff, 0x60,
+  0x6f, 0xfb, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f, 0xfc, 0x00,
+  0x0c, 0xff, 0x50, 0x00, 0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc, 0xff, 0x02,
+  0xf0, 0x00, 0x04, 0xfc, 0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,
+  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e, 0xff, 0x30,
+  0x8f, 0xf9, 0xfe, 0x00, 0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04, 0xff, 0xd0,
+  0xd1, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 15 */
-  0x00, 0x00, 0x2d, 0xe8, 0x1d, 0xe0, 0x00, 0x00,  //.....@@%.@@....
-  0x00, 0x00, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0xfd, 0x18, 0xed, 0x20, 0x00, 0x00,  //....@@.%@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x05, 0x00, 0x00, 0x2d, 0xe8, 0x1d, 0xe0, 0xfd, 0x00, 0x03, 0xbf, 0xff, 0xff, 0xb0, 0xfd, 0x00,
+  0x03, 0xfd, 0x18, 0xed, 0x20, 0xed, 0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff,
+  0xf8, 0xfc, 0x00, 0x02, 0x0d, 0xff, 0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00,
+  0x03, 0x7f, 0xff, 0xff, 0x70, 0xfd, 0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01,
+  0xff, 0xf1, 0xff, 0xf1, 0xfe, 0x00, 0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b,
+  0xff, 0x60, 0x6f, 0xfb, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f,
+  0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00, 0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc,
+  0xff, 0x02, 0xf0, 0x00, 0x04, 0xfc, 0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f,
+  0xf9, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e,
+  0xff, 0x30, 0x8f, 0xf9, 0xfe, 0x00, 0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04,
+  0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 15 */
-  0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xcf, 0xfb, 0xff, 0xc0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x01, 0xff, 0xf1, 0xff, 0xf1, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x0b, 0xff, 0x60, 0x6f, 0xfb, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x5f, 0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00,  //..+@@@...@@@+..
-  0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00,  //..%@@+...+@@%..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..@@@@@@@@@@@..
-  0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //.+@@@@@@@@@@@+.
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xf9, 0x00,  //.%@@%.....%@@%.
-  0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00,  //.@@@.......@@@.
-  0x3f, 0xfe, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x30,  //.@@@.......@@@.
-  0x8f, 0xf9, 0x00, 0x00, 0x00, 0x09, 0xff, 0x80,  //%@@%.......%@@%
-  0xdf, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x05, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfd, 0x00,
+  0x03, 0xff, 0xf0, 0xff, 0xf0, 0xed, 0x00, 0x02, 0x03, 0xff, 0xf3, 0xfc, 0x00, 0x02, 0x08, 0xff,
+  0xf8, 0xfc, 0x00, 0x02, 0x0d, 0xff, 0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00,
+  0x03, 0x7f, 0xff, 0xff, 0x70, 0xfd, 0x00, 0x03, 0xcf, 0xfb, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x01,
+  0xff, 0xf1, 0xff, 0xf1, 0xfe, 0x00, 0x04, 0x06, 0xff, 0xb0, 0xbf, 0xf6, 0xfe, 0x00, 0x04, 0x0b,
+  0xff, 0x60, 0x6f, 0xfb, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x10, 0x1f, 0xff, 0xfe, 0x00, 0x0f, 0x5f,
+  0xfc, 0x00, 0x0c, 0xff, 0x50, 0x00, 0x00, 0xaf, 0xf7, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xfc,
+  0xff, 0x02, 0xf0, 0x00, 0x04, 0xfc, 0xff, 0x13, 0xf4, 0x00, 0x09, 0xff, 0x80, 0x00, 0x00, 0x8f,
+  0xf9, 0x00, 0x0e, 0xff, 0x30, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0xfe, 0x00, 0x04, 0x0e,
+  0xff, 0x30, 0x8f, 0xf9, 0xfe, 0x00, 0x04, 0x09, 0xff, 0x80, 0xdf, 0xf4, 0xfe, 0x00, 0x02, 0x04,
+  0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 15 */
-  0x00, 0x00, 0x05, 0xcf, 0xc5, 0x00, 0x00, 0x00,  //.....+@@@+.....
-  0x00, 0x00, 0x6f, 0xff, 0xff, 0x60, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0xef, 0x70, 0x7f, 0xd0, 0x00, 0x00,  //....@@+.+@@....
-  0x00, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00,  //....@@...@@....
-  0x00, 0x00, 0xaf, 0x70, 0x7f, 0xa0, 0x00, 0x00,  //....%@+.+@%....
-  0x00, 0x00, 0x0b, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x02, 0xff, 0xf2, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x08, 0xff, 0xf7, 0x00, 0x00, 0x00,  //.....%@@@+.....
-  0x00, 0x00, 0x0d, 0xff, 0xfd, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x8f, 0xff, 0xff, 0x70, 0x00, 0x00,  //....%@@@@@+....
-  0x00, 0x00, 0xdf, 0xfa, 0xff, 0xd0, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x02, 0xff, 0xf1, 0xff, 0xf2, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x08, 0xff, 0xa0, 0xaf, 0xf7, 0x00, 0x00,  //...%@@%.%@@+...
-  0x00, 0x0d, 0xff, 0x50, 0x5f, 0xfd, 0x00, 0x00,  //...@@@+.+@@@...
-  0x00, 0x2f, 0xff, 0x00, 0x0f, 0xff, 0x20, 0x00,  //...@@@...@@@...
-  0x00, 0x8f, 0xfa, 0x00, 0x0a, 0xff, 0x70, 0x00,  //..%@@%...%@@+..
-  0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //..@@@@@@@@@@@..
-  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x00,  //..@@@@@@@@@@@..
-  0x07, 0xff, 0xa0, 0x00, 0x00, 0xaf, 0xf7, 0x00,  //.+@@%.....%@@+.
-  0x0d, 0xff, 0x50, 0x00, 0x00, 0x5f, 0xfd, 0x00,  //.@@@+.....+@@@.
-  0x2f, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x20,  //.@@@.......@@@.
-  0x7f, 0xfa, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x70,  //+@@%.......%@@+
-  0xdf, 0xf5, 0x00, 0x00, 0x00, 0x05, 0xff, 0xd0,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x04, 0x00, 0x00, 0x05, 0xcf, 0xc5, 0xfc, 0x00, 0x03, 0x6f, 0xff, 0xff, 0x60, 0xfd, 0x00, 0x03,
+  0xef, 0x70, 0x7f, 0xd0, 0xfd, 0x00, 0x03, 0xff, 0x00, 0x0f, 0xf0, 0xfd, 0x00, 0x03, 0xaf, 0x70,
+  0x7f, 0xa0, 0xfd, 0x00, 0x02, 0x0b, 0xff, 0xfa, 0xfc, 0x00, 0x02, 0x02, 0xff, 0xf2, 0xfc, 0x00,
+  0x02, 0x08, 0xff, 0xf7, 0xfc, 0x00, 0x02, 0x0d, 0xff, 0xfd, 0xfc, 0x00, 0x03, 0x2f, 0xff, 0xff,
+  0x20, 0xfd, 0x00, 0x03, 0x8f, 0xff, 0xff, 0x70, 0xfd, 0x00, 0x03, 0xdf, 0xfa, 0xff, 0xd0, 0xfe,
+  0x00, 0x04, 0x02, 0xff, 0xf1, 0xff, 0xf2, 0xfe, 0x00, 0x04, 0x08, 0xff, 0xa0, 0xaf, 0xf7, 0xfe,
+  0x00, 0x04, 0x0d, 0xff, 0x50, 0x5f, 0xfd, 0xfe, 0x00, 0x10, 0x2f, 0xff, 0x00, 0x0f, 0xff, 0x20,
+  0x00, 0x00, 0x8f, 0xfa, 0x00, 0x0a, 0xff, 0x70, 0x00, 0x00, 0xdf, 0xfd, 0xff, 0x02, 0xd0, 0x00,
+  0x02, 0xfc, 0xff, 0x13, 0xf2, 0x00, 0x07, 0xff, 0xa0, 0x00, 0x00, 0xaf, 0xf7, 0x00, 0x0d, 0xff,
+  0x50, 0x00, 0x00, 0x5f, 0xfd, 0x00, 0x2f, 0xff, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x20, 0x7f, 0xfa,
+  0xfe, 0x00, 0x04, 0x0a, 0xff, 0x70, 0xdf, 0xf5, 0xfe, 0x00, 0x02, 0x05, 0xff, 0xd0, 0xd1, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.....@@@@@@@@@@
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.....@@@@@@@@@@
-  0x00, 0x00, 0x8f, 0xf9, 0xff, 0xf0, 0x00, 0x00,  //....%@@%@@@....
-  0x00, 0x00, 0xcf, 0xf4, 0xff, 0xf0, 0x00, 0x00,  //....@@@+@@@....
-  0x00, 0x01, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x05, 0xff, 0xc0, 0xff, 0xf0, 0x00, 0x00,  //...+@@@.@@@....
-  0x00, 0x09, 0xff, 0x70, 0xff, 0xf0, 0x00, 0x00,  //...%@@+.@@@....
-  0x00, 0x0e, 0xff, 0x30, 0xff, 0xf0, 0x00, 0x00,  //...@@@..@@@....
-  0x00, 0x2f, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,  //...@@@..@@@@@@.
-  0x00, 0x6f, 0xfa, 0x00, 0xff, 0xff, 0xff, 0x00,  //..+@@%..@@@@@@.
-  0x00, 0xbf, 0xf6, 0x00, 0xff, 0xf0, 0x00, 0x00,  //..%@@+..@@@....
-  0x00, 0xff, 0xf2, 0x00, 0xff, 0xf0, 0x00, 0x00,  //..@@@...@@@....
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //..@@@@@@@@@....
-  0x08, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,  //.%@@@@@@@@@....
-  0x0c, 0xff, 0x50, 0x00, 0xff, 0xf0, 0x00, 0x00,  //.@@@+...@@@....
-  0x0f, 0xff, 0x10, 0x00, 0xff, 0xf0, 0x00, 0x00,  //.@@@....@@@....
-  0x5f, 0xfc, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //+@@@....@@@....
-  0x9f, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0,  //%@@%....@@@@@@@
-  0xdf, 0xf3, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0,  //@@@.....@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xd7, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x06, 0xf0, 0x00,
+  0x00, 0x8f, 0xf9, 0xff, 0xf0, 0xfd, 0x00, 0x03, 0xcf, 0xf4, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x01,
+  0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x05, 0xff, 0xc0, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x09,
+  0xff, 0x70, 0xff, 0xf0, 0xfe, 0x00, 0x04, 0x0e, 0xff, 0x30, 0xff, 0xf0, 0xfe, 0x00, 0x02, 0x2f,
+  0xff, 0x00, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x6f, 0xfa, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x00, 0xbf,
+  0xf6, 0x00, 0xff, 0xf0, 0xfe, 0x00, 0x07, 0xff, 0xf2, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xfd,
+  0xff, 0x03, 0xf0, 0x00, 0x00, 0x08, 0xfd, 0xff, 0x1e, 0xf0, 0x00, 0x00, 0x0c, 0xff, 0x50, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x10, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x5f, 0xfc, 0x00, 0x00,
+  0xff, 0xf0, 0x00, 0x00, 0x9f, 0xf8, 0x00, 0x00, 0xfe, 0xff, 0x04, 0xf0, 0xdf, 0xf3, 0x00, 0x00,
+  0xfe, 0xff, 0x00, 0xf0, 0xd1, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93,  //....+%@@@@%.
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0xdf, 0xfa, 0x30, 0x15, 0xcf,  //..@@@%...+@@
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x08,  //.%@@%......%
-  0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xdf, 0xf1, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xbf, 0xf4, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0x1f, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x09, 0xff, 0x80, 0x00, 0x00, 0x08,  //.%@@%......%
-  0x01, 0xdf, 0xfa, 0x30, 0x15, 0xcf,  //..@@@%...+@@
-  0x00, 0x1c, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93,  //....+%@@@@%.
-  0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00,  //.......%@+..
-  0x00, 0x00, 0x00, 0x01, 0xfb, 0x00,  //........@%..
-  0x00, 0x00, 0x00, 0x04, 0xff, 0x00,  //.......+@@..
-  0x00, 0x00, 0x0f, 0xff, 0xfd, 0x00,  //.....@@@@@..
-  0x00, 0x00, 0x0b, 0xff, 0xc3, 0x00,  //.....%@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe1, 0x00, 0x05, 0x5a, 0xef, 0xfd, 0x93, 0x00, 0x1c, 0xfd, 0xff, 0x0d, 0x00, 0xdf, 0xfa, 0x30,
+  0x15, 0xcf, 0x09, 0xff, 0x80, 0x00, 0x00, 0x08, 0x1f, 0xfd, 0xfd, 0x00, 0x01, 0x7f, 0xf8, 0xfd,
+  0x00, 0x01, 0xbf, 0xf4, 0xfd, 0x00, 0x01, 0xdf, 0xf1, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xdf, 0xf1, 0xfd, 0x00, 0x01,
+  0xbf, 0xf4, 0xfd, 0x00, 0x01, 0x7f, 0xf8, 0xfd, 0x00, 0x01, 0x1f, 0xfd, 0xfd, 0x00, 0x0d, 0x09,
+  0xff, 0x80, 0x00, 0x00, 0x08, 0x01, 0xdf, 0xfa, 0x30, 0x15, 0xcf, 0x00, 0x1c, 0xfd, 0xff, 0x05,
+  0x00, 0x00, 0x5a, 0xef, 0xfd, 0x93, 0xfe, 0x00, 0x01, 0x0a, 0xf4, 0xfd, 0x00, 0x01, 0x01, 0xfb,
+  0xfd, 0x00, 0x01, 0x04, 0xff, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xfd, 0xfe, 0x00, 0x02, 0x0b, 0xff,
+  0xc3, 0xfa, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 12 */
-  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00,  //....%@@.....
-  0x00, 0x00, 0x08, 0xfb, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x8f, 0x90, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x03, 0x00, 0x00, 0x8f, 0xc0, 0xfd, 0x00, 0x01, 0x08, 0xfb, 0xfc, 0x00, 0x01, 0x8f, 0x90, 0xf4,
+  0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 12 */
-  0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00,  //.......@@+..
-  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00,  //......%@%...
-  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfe, 0x00, 0x01, 0x0c, 0xf7, 0xfd, 0x00, 0x01, 0xbf, 0x80, 0xfe, 0x00, 0x01, 0x09, 0xf8, 0xf3,
+  0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 12 */
-  0x00, 0x00, 0x0a, 0xff, 0xa0, 0x00,  //.....%@@%...
-  0x00, 0x00, 0x9f, 0x77, 0xf9, 0x00,  //....%@++@%..
-  0x00, 0x08, 0xf6, 0x00, 0x6f, 0x80,  //...%@+..+@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x04, 0x00, 0x00, 0x0a, 0xff, 0xa0, 0xfe, 0x00, 0x09, 0x9f, 0x77, 0xf9, 0x00, 0x00, 0x08, 0xf6,
+  0x00, 0x6f, 0x80, 0xf5, 0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff,
+  0xdd, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 12 */
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //...@@@..@@@.
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //...@@@..@@@.
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //...@@@..@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x11, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00, 0x0f, 0xff,
+  0x00, 0xff, 0xf0, 0xf5, 0x00, 0xf4, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x02, 0xf0, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0xf5, 0xff,
+  0xdd, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 11 */
-  0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00,  //..%@@......
-  0x00, 0x08, 0xfb, 0x00, 0x00, 0x00,  //...%@%.....
-  0x00, 0x00, 0x8f, 0x90, 0x00, 0x00,  //....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x02, 0x00, 0x8f, 0xc0, 0xfd, 0x00, 0x01, 0x08, 0xfb, 0xfc, 0x00, 0x01, 0x8f, 0x90, 0xf3, 0x00,
+  0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x03,
+  0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 11 */
-  0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00,  //.....@@+...
-  0x00, 0x00, 0xbf, 0x80, 0x00, 0x00,  //....%@%....
-  0x00, 0x09, 0xf8, 0x00, 0x00, 0x00,  //...%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x03, 0x00, 0x00, 0x0c, 0xf7, 0xfd, 0x00, 0x01, 0xbf, 0x80, 0xfe, 0x00, 0x01, 0x09, 0xf8, 0xf2,
+  0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x03, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 11 */
-  0x00, 0x03, 0xff, 0xf3, 0x00, 0x00,  //....@@@....
-  0x00, 0x2e, 0xd3, 0xde, 0x20, 0x00,  //...@@.@@...
-  0x02, 0xec, 0x10, 0x1c, 0xe2, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x03, 0x00, 0x03, 0xff, 0xf3, 0xfe, 0x00, 0x09, 0x2e, 0xd3, 0xde, 0x20, 0x00, 0x02, 0xec, 0x10,
+  0x1c, 0xe2, 0xf4, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0,
+  0xdd, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 11 */
-  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,  //..@@@.@@@..
-  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,  //..@@@.@@@..
-  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,  //..@@@.@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x10, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0xff, 0xf0, 0xf4, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x04, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01,
+  0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0xf0,
+  0xdd, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x00,  //.@@@@@@%+....
-  0x0f, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x00,  //.@@@@@@@@@...
-  0x0f, 0xff, 0x00, 0x27, 0xff, 0xf3, 0x00,  //.@@@...+@@@..
-  0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00,  //.@@@.....@@@.
-  0x0f, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x30,  //.@@@.....%@@.
-  0x0f, 0xff, 0x00, 0x00, 0x05, 0xff, 0x80,  //.@@@.....+@@%
-  0x0f, 0xff, 0x00, 0x00, 0x03, 0xff, 0xb0,  //.@@@......@@%
-  0x0f, 0xff, 0x00, 0x00, 0x01, 0xff, 0xe0,  //.@@@......@@@
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xf0,  //@@@@@@@...@@@
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xf0,  //@@@@@@@...@@@
-  0x0f, 0xff, 0x00, 0x00, 0x00, 0xff, 0xf0,  //.@@@......@@@
-  0x0f, 0xff, 0x00, 0x00, 0x01, 0xff, 0xe0,  //.@@@......@@@
-  0x0f, 0xff, 0x00, 0x00, 0x03, 0xff, 0xb0,  //.@@@......@@%
-  0x0f, 0xff, 0x00, 0x00, 0x06, 0xff, 0x80,  //.@@@.....+@@%
-  0x0f, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x30,  //.@@@.....%@@.
-  0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00,  //.@@@.....@@@.
-  0x0f, 0xff, 0x00, 0x27, 0xff, 0xf3, 0x00,  //.@@@...+@@@..
-  0x0f, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x00,  //.@@@@@@@@@...
-  0x0f, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x00,  //.@@@@@@%+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xde, 0x00, 0x07, 0x0f, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x2c, 0xfe, 0x30,
+  0x00, 0x0f, 0xff, 0x00, 0x27, 0xff, 0xf3, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x0f,
+  0xff, 0x00, 0x00, 0x0a, 0xff, 0x30, 0x0f, 0xff, 0x00, 0x00, 0x05, 0xff, 0x80, 0x0f, 0xff, 0x00,
+  0x00, 0x03, 0xff, 0xb0, 0x0f, 0xff, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xfe, 0xff, 0x03, 0xf0, 0x00,
+  0xff, 0xf0, 0xfe, 0xff, 0x05, 0xf0, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x00, 0x2c, 0xff, 0xf0,
+  0x0f, 0xff, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x0f, 0xff, 0x00, 0x00, 0x03, 0xff, 0xb0, 0x0f, 0xff,
+  0x00, 0x00, 0x06, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x0a, 0xff, 0x30, 0x0f, 0xff, 0x00, 0x00,
+  0x3f, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x27, 0xff, 0xf3, 0x00, 0x0f, 0xfe, 0xff, 0x07, 0xfe, 0x30,
+  0x00, 0x0f, 0xff, 0xff, 0xeb, 0x60, 0xd5, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 12 */
-  0x00, 0x2c, 0xfc, 0x42, 0xfe, 0x00,  //...@@@+.@@..
-  0x00, 0xbf, 0xff, 0xff, 0xfa, 0x00,  //..%@@@@@@%..
-  0x00, 0xef, 0x25, 0xcf, 0xc1, 0x00,  //..@@.+@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0x20, 0x00, 0x0f, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0x80, 0x00, 0x0f, 0xff,  //@@@@%....@@@
-  0xff, 0xff, 0xd0, 0x00, 0x0f, 0xff,  //@@@@@....@@@
-  0xff, 0xfb, 0xf3, 0x00, 0x0f, 0xff,  //@@@%@....@@@
-  0xff, 0xf6, 0xf9, 0x00, 0x0f, 0xff,  //@@@+@%...@@@
-  0xff, 0xf0, 0xfe, 0x00, 0x0f, 0xff,  //@@@.@@...@@@
-  0xff, 0xf0, 0xaf, 0x40, 0x0f, 0xff,  //@@@.%@+..@@@
-  0xff, 0xf0, 0x5f, 0x90, 0x0f, 0xff,  //@@@.+@%..@@@
-  0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff,  //@@@..@@..@@@
-  0xff, 0xf0, 0x09, 0xf5, 0x0f, 0xff,  //@@@..%@+.@@@
-  0xff, 0xf0, 0x04, 0xfa, 0x0f, 0xff,  //@@@..+@%.@@@
-  0xff, 0xf0, 0x00, 0xef, 0x0f, 0xff,  //@@@...@@.@@@
-  0xff, 0xf0, 0x00, 0x9f, 0x6f, 0xff,  //@@@...%@+@@@
-  0xff, 0xf0, 0x00, 0x3f, 0xbf, 0xff,  //@@@....@%@@@
-  0xff, 0xf0, 0x00, 0x0d, 0xff, 0xff,  //@@@....@@@@@
-  0xff, 0xf0, 0x00, 0x08, 0xff, 0xff,  //@@@....%@@@@
-  0xff, 0xf0, 0x00, 0x02, 0xff, 0xff,  //@@@.....@@@@
-  0xff, 0xf0, 0x00, 0x00, 0xdf, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x10, 0x00, 0x2c, 0xfc, 0x42, 0xfe, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xef, 0x25,
+  0xcf, 0xc1, 0xf4, 0x00, 0x04, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0x20, 0x00, 0x0f,
+  0xfe, 0xff, 0x02, 0x80, 0x00, 0x0f, 0xfe, 0xff, 0x49, 0xd0, 0x00, 0x0f, 0xff, 0xff, 0xfb, 0xf3,
+  0x00, 0x0f, 0xff, 0xff, 0xf6, 0xf9, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0xfe, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0xaf, 0x40, 0x0f, 0xff, 0xff, 0xf0, 0x5f, 0x90, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f,
+  0xff, 0xff, 0xf0, 0x09, 0xf5, 0x0f, 0xff, 0xff, 0xf0, 0x04, 0xfa, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0xef, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x9f, 0x6f, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xbf, 0xff, 0xff,
+  0xf0, 0x00, 0x0d, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x08, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x02, 0xfe,
+  0xff, 0x04, 0xf0, 0x00, 0x00, 0xdf, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 13 */
-  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00, 0x00,  //....%@@......
-  0x00, 0x00, 0x08, 0xfb, 0x00, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x00, 0x00, 0x8f, 0x90, 0x00, 0x00,  //......%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x03, 0x00, 0x00, 0x8f, 0xc0, 0xfc, 0x00, 0x01, 0x08, 0xfb, 0xfb, 0x00, 0x01, 0x8f, 0x90, 0xf0,
+  0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x2d, 0x90, 0x00, 0x07,
+  0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x5f, 0xf8, 0x00,
+  0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0xcf, 0xf2, 0x00, 0x00, 0x02,
+  0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0,
+  0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x2d, 0xff, 0xf0, 0xef, 0xf1,
+  0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0x9f, 0xf4, 0x00, 0x00,
+  0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe,
+  0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x06, 0x90, 0x00, 0x00,
+  0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 13 */
-  0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00,  //.......@@+...
-  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00,  //......%@%....
-  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfe, 0x00, 0x01, 0x0c, 0xf7, 0xfc, 0x00, 0x01, 0xbf, 0x80, 0xfd, 0x00, 0x01, 0x09, 0xf8, 0xef,
+  0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x2d, 0x90, 0x00, 0x07,
+  0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x5f, 0xf8, 0x00,
+  0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0xcf, 0xf2, 0x00, 0x00, 0x02,
+  0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0,
+  0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x2d, 0xff, 0xf0, 0xef, 0xf1,
+  0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0x9f, 0xf4, 0x00, 0x00,
+  0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe,
+  0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x06, 0x90, 0x00, 0x00,
+  0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 13 */
-  0x00, 0x00, 0x1e, 0xfe, 0x10, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0xce, 0x4e, 0xc0, 0x00, 0x00,  //....@@+@@....
-  0x00, 0x09, 0xe2, 0x02, 0xe9, 0x00, 0x00,  //...%@...@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x04, 0x00, 0x00, 0x1e, 0xfe, 0x10, 0xfd, 0x00, 0x02, 0xce, 0x4e, 0xc0, 0xfe, 0x00, 0x03, 0x09,
+  0xe2, 0x02, 0xe9, 0xf0, 0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff,
+  0x2d, 0x90, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe,
+  0x00, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0xcf,
+  0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0, 0xfe,
+  0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x2d,
+  0xff, 0xf0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,
+  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f, 0xfe,
+  0x00, 0x00, 0x0e, 0xfe, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe, 0xff,
+  0x06, 0x90, 0x00, 0x00, 0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 13 */
-  0x00, 0x02, 0xde, 0x81, 0xde, 0x00, 0x00,  //....@@%.@@...
-  0x00, 0x0b, 0xff, 0xff, 0xfb, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x0f, 0xd1, 0x8e, 0xd2, 0x00, 0x00,  //...@@.%@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x04, 0x00, 0x02, 0xde, 0x81, 0xde, 0xfe, 0x00, 0x03, 0x0b, 0xff, 0xff, 0xfb, 0xfe, 0x00, 0x03,
+  0x0f, 0xd1, 0x8e, 0xd2, 0xf0, 0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe,
+  0xff, 0x2d, 0x90, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e,
+  0xfe, 0x00, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,
+  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0,
+  0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00,
+  0x2d, 0xff, 0xf0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff,
+  0xc0, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f,
+  0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe,
+  0xff, 0x06, 0x90, 0x00, 0x00, 0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 13 */
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00,  //.+@@@...@@@+.
-  0x0e, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xf0,  //@@@.......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0,  //@@@.......@@@
-  0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,  //%@@+.....+@@%
-  0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50,  //+@@%.....%@@+
-  0x0f, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00,  //.@@@.....@@@.
-  0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00,  //.+@@@...@@@+.
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x00,  //..%@@@@@@@%..
-  0x00, 0x04, 0xbe, 0xfe, 0xb4, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x04, 0x00, 0x0f, 0xff, 0x0f, 0xff, 0xfe, 0x00, 0x03, 0x0f, 0xff, 0x0f, 0xff, 0xfe, 0x00, 0x03,
+  0x0f, 0xff, 0x0f, 0xff, 0xf0, 0x00, 0x03, 0x04, 0xbe, 0xfe, 0xb4, 0xfe, 0x00, 0x00, 0x9f, 0xfe,
+  0xff, 0x2d, 0x90, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf6, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x1e,
+  0xfe, 0x00, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90,
+  0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff, 0xc0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf0,
+  0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0xff, 0xf0, 0xfe, 0x00,
+  0x2d, 0xff, 0xf0, 0xef, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xcf, 0xf2, 0x00, 0x00, 0x02, 0xff,
+  0xc0, 0x9f, 0xf4, 0x00, 0x00, 0x05, 0xff, 0x90, 0x5f, 0xf8, 0x00, 0x00, 0x08, 0xff, 0x50, 0x0f,
+  0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x07, 0xff, 0xc2, 0x02, 0xcf, 0xf7, 0x00, 0x00, 0x9f, 0xfe,
+  0xff, 0x06, 0x90, 0x00, 0x00, 0x04, 0xbe, 0xfe, 0xb4, 0xd5, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x2b, 0x10, 0x00, 0x00, 0x01, 0xb1,  //.%........%.
-  0xbf, 0xd1, 0x00, 0x00, 0x1d, 0xfb,  //%@@......@@%
-  0x1d, 0xfd, 0x10, 0x01, 0xdf, 0xd1,  //.@@@....@@@.
-  0x01, 0xdf, 0xd1, 0x1d, 0xfd, 0x10,  //..@@@..@@@..
-  0x00, 0x1d, 0xfd, 0xdf, 0xd1, 0x00,  //...@@@@@@...
-  0x00, 0x01, 0xdf, 0xfd, 0x10, 0x00,  //....@@@@....
-  0x00, 0x01, 0xdf, 0xfd, 0x10, 0x00,  //....@@@@....
-  0x00, 0x2d, 0xfd, 0xdf, 0xd1, 0x00,  //...@@@@@@...
-  0x02, 0xef, 0xd1, 0x1d, 0xfd, 0x10,  //..@@@..@@@..
-  0x2e, 0xfd, 0x10, 0x02, 0xef, 0xd1,  //.@@@....@@@.
-  0xbf, 0xe2, 0x00, 0x00, 0x2e, 0xfb,  //%@@......@@%
-  0x1b, 0x20, 0x00, 0x00, 0x02, 0xb1,  //.%........%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0x47, 0x2b, 0x10, 0x00, 0x00, 0x01, 0xb1, 0xbf, 0xd1, 0x00, 0x00, 0x1d, 0xfb, 0x1d,
+  0xfd, 0x10, 0x01, 0xdf, 0xd1, 0x01, 0xdf, 0xd1, 0x1d, 0xfd, 0x10, 0x00, 0x1d, 0xfd, 0xdf, 0xd1,
+  0x00, 0x00, 0x01, 0xdf, 0xfd, 0x10, 0x00, 0x00, 0x01, 0xdf, 0xfd, 0x10, 0x00, 0x00, 0x2d, 0xfd,
+  0xdf, 0xd1, 0x00, 0x02, 0xef, 0xd1, 0x1d, 0xfd, 0x10, 0x2e, 0xfd, 0x10, 0x02, 0xef, 0xd1, 0xbf,
+  0xe2, 0x00, 0x00, 0x2e, 0xfb, 0x1b, 0x20, 0x00, 0x00, 0x02, 0xb1, 0xd1, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10,  //...............
-  0x00, 0x00, 0x5b, 0xef, 0xea, 0x20, 0x1e, 0xc0,  //....+%@@@%...@@
-  0x00, 0x0a, 0xff, 0xff, 0xff, 0xf6, 0xcf, 0x30,  //...%@@@@@@@+@@.
-  0x00, 0x7f, 0xfc, 0x20, 0x3c, 0xff, 0xf7, 0x00,  //..+@@@...@@@@+.
-  0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xe0, 0x00,  //..@@@.....@@@..
-  0x05, 0xff, 0x90, 0x00, 0x02, 0xff, 0xf4, 0x00,  //.+@@%.....@@@+.
-  0x09, 0xff, 0x50, 0x00, 0x0c, 0xff, 0xf9, 0x00,  //.%@@+....@@@@%.
-  0x0c, 0xff, 0x20, 0x00, 0x7f, 0x8f, 0xfc, 0x00,  //.@@@....+@%@@@.
-  0x0e, 0xff, 0x10, 0x02, 0xfa, 0x0f, 0xfe, 0x00,  //.@@@....@%.@@@.
-  0x0f, 0xff, 0x00, 0x0d, 0xe1, 0x0f, 0xff, 0x00,  //.@@@...@@..@@@.
-  0x0f, 0xff, 0x00, 0x8f, 0x40, 0x0f, 0xff, 0x00,  //.@@@..%@+..@@@.
-  0x0f, 0xff, 0x03, 0xf9, 0x00, 0x0f, 0xff, 0x00,  //.@@@..@%...@@@.
-  0x0e, 0xff, 0x1d, 0xd0, 0x00, 0x1f, 0xfe, 0x00,  //.@@@.@@....@@@.
-  0x0c, 0xff, 0xbf, 0x30, 0x00, 0x2f, 0xfc, 0x00,  //.@@@%@.....@@@.
-  0x0a, 0xff, 0xf8, 0x00, 0x00, 0x4f, 0xf9, 0x00,  //.%@@@%....+@@%.
-  0x06, 0xff, 0xc0, 0x00, 0x00, 0x8f, 0xf5, 0x00,  //.+@@@.....%@@+.
-  0x02, 0xff, 0xc0, 0x00, 0x00, 0xef, 0xe0, 0x00,  //..@@@.....@@@..
-  0x08, 0xff, 0xfb, 0x20, 0x2c, 0xff, 0x70, 0x00,  //.%@@@%...@@@+..
-  0x1f, 0x98, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00,  //.@%%@@@@@@@%...
-  0xab, 0x00, 0x4b, 0xef, 0xeb, 0x50, 0x00, 0x00,  //%%..+%@@@%+....
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xdb, 0x00, 0x0b, 0x03, 0x10, 0x00, 0x00, 0x5b, 0xef, 0xea, 0x20, 0x1e, 0xc0, 0x00, 0x0a, 0xfe,
+  0xff, 0x7c, 0xf6, 0xcf, 0x30, 0x00, 0x7f, 0xfc, 0x20, 0x3c, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xe0,
+  0x00, 0x01, 0xff, 0xe0, 0x00, 0x05, 0xff, 0x90, 0x00, 0x02, 0xff, 0xf4, 0x00, 0x09, 0xff, 0x50,
+  0x00, 0x0c, 0xff, 0xf9, 0x00, 0x0c, 0xff, 0x20, 0x00, 0x7f, 0x8f, 0xfc, 0x00, 0x0e, 0xff, 0x10,
+  0x02, 0xfa, 0x0f, 0xfe, 0x00, 0x0f, 0xff, 0x00, 0x0d, 0xe1, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00,
+  0x8f, 0x40, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x03, 0xf9, 0x00, 0x0f, 0xff, 0x00, 0x0e, 0xff, 0x1d,
+  0xd0, 0x00, 0x1f, 0xfe, 0x00, 0x0c, 0xff, 0xbf, 0x30, 0x00, 0x2f, 0xfc, 0x00, 0x0a, 0xff, 0xf8,
+  0x00, 0x00, 0x4f, 0xf9, 0x00, 0x06, 0xff, 0xc0, 0x00, 0x00, 0x8f, 0xf5, 0x00, 0x02, 0xff, 0xc0,
+  0x00, 0x00, 0xef, 0xe0, 0x00, 0x08, 0xff, 0xfb, 0x20, 0x2c, 0xff, 0x70, 0x00, 0x1f, 0x98, 0xfe,
+  0xff, 0x0b, 0xf9, 0x00, 0x00, 0xab, 0x00, 0x4b, 0xef, 0xeb, 0x50, 0x00, 0x00, 0x31, 0xd2, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 12 */
-  0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00,  //....%@@.....
-  0x00, 0x00, 0x08, 0xfb, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x8f, 0x90, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe,  //@@@......@@@
-  0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd,  //@@@......@@@
-  0xaf, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3,  //.@@@+..+@@@.
-  0x06, 0xff, 0xff, 0xff, 0xff, 0x60,  //.+@@@@@@@@+.
-  0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x03, 0x00, 0x00, 0x8f, 0xc0, 0xfd, 0x00, 0x01, 0x08, 0xfb, 0xfc, 0x00, 0x01, 0x8f, 0x90, 0xf4,
+  0x00, 0x66, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd, 0xaf, 0xf5, 0x00, 0x00,
+  0x5f, 0xf9, 0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3, 0x06, 0xfd, 0xff, 0x05, 0x60, 0x00, 0x29, 0xdf,
+  0xfd, 0x92, 0xdc, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 12 */
-  0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00,  //.......@@+..
-  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00,  //......%@%...
-  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe,  //@@@......@@@
-  0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd,  //@@@......@@@
-  0xaf, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3,  //.@@@+..+@@@.
-  0x06, 0xff, 0xff, 0xff, 0xff, 0x60,  //.+@@@@@@@@+.
-  0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfe, 0x00, 0x01, 0x0c, 0xf7, 0xfd, 0x00, 0x01, 0xbf, 0x80, 0xfe, 0x00, 0x01, 0x09, 0xf8, 0xf3,
+  0x00, 0x66, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd, 0xaf, 0xf5, 0x00, 0x00,
+  0x5f, 0xf9, 0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3, 0x06, 0xfd, 0xff, 0x05, 0x60, 0x00, 0x29, 0xdf,
+  0xfd, 0x92, 0xdc, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 12 */
-  0x00, 0x00, 0xaf, 0xfa, 0x00, 0x00,  //....%@@%....
-  0x00, 0x09, 0xf7, 0x7f, 0x90, 0x00,  //...%@++@%...
-  0x00, 0x8f, 0x60, 0x06, 0xf8, 0x00,  //..%@+..+@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe,  //@@@......@@@
-  0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd,  //@@@......@@@
-  0xaf, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3,  //.@@@+..+@@@.
-  0x06, 0xff, 0xff, 0xff, 0xff, 0x60,  //.+@@@@@@@@+.
-  0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x03, 0x00, 0x00, 0xaf, 0xfa, 0xfe, 0x00, 0x09, 0x09, 0xf7, 0x7f, 0x90, 0x00, 0x00, 0x8f, 0x60,
+  0x06, 0xf8, 0xf4, 0x00, 0x66, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd, 0xaf,
+  0xf5, 0x00, 0x00, 0x5f, 0xf9, 0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3, 0x06, 0xfd, 0xff, 0x05, 0x60,
+  0x00, 0x29, 0xdf, 0xfd, 0x92, 0xdc, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 12 */
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe,  //@@@......@@@
-  0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd,  //@@@......@@@
-  0xaf, 0xf5, 0x00, 0x00, 0x5f, 0xf9,  //%@@+....+@@%
-  0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3,  //.@@@+..+@@@.
-  0x06, 0xff, 0xff, 0xff, 0xff, 0x60,  //.+@@@@@@@@+.
-  0x00, 0x29, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x10, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0,
+  0x0f, 0xff, 0xf4, 0x00, 0x66, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xef, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xdf, 0xf0, 0x00, 0x00, 0x1f, 0xfd, 0xaf,
+  0xf5, 0x00, 0x00, 0x5f, 0xf9, 0x3f, 0xfe, 0x50, 0x05, 0xef, 0xf3, 0x06, 0xfd, 0xff, 0x05, 0x60,
+  0x00, 0x29, 0xdf, 0xfd, 0x92, 0xdc, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 15 */
-  0x00, 0x00, 0x00, 0x0c, 0xf7, 0x00, 0x00, 0x00,  //.......@@+.....
-  0x00, 0x00, 0x00, 0xbf, 0x80, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x09, 0xf8, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xbf, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xb0,  //%@@%.......%@@%
-  0x2f, 0xff, 0x40, 0x00, 0x00, 0x5f, 0xff, 0x20,  //.@@@+.....+@@@.
-  0x09, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00,  //.%@@@.....@@@%.
-  0x01, 0xef, 0xf7, 0x00, 0x07, 0xff, 0xe1, 0x00,  //..@@@+...+@@@..
-  0x00, 0x6f, 0xff, 0x10, 0x1f, 0xff, 0x60, 0x00,  //..+@@@...@@@+..
-  0x00, 0x0d, 0xff, 0x90, 0x9f, 0xfd, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x04, 0xff, 0xf6, 0xff, 0xf4, 0x00, 0x00,  //...+@@@+@@@+...
-  0x00, 0x00, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x2f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x08, 0xff, 0xf8, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfe, 0x00, 0x01, 0x0c, 0xf7, 0xfb, 0x00, 0x01, 0xbf, 0x80, 0xfc, 0x00, 0x01, 0x09, 0xf8, 0xed,
+  0x00, 0x01, 0xbf, 0xfb, 0xfe, 0x00, 0x28, 0x0b, 0xff, 0xb0, 0x2f, 0xff, 0x40, 0x00, 0x00, 0x5f,
+  0xff, 0x20, 0x09, 0xff, 0xd0, 0x00, 0x00, 0xdf, 0xf8, 0x00, 0x01, 0xef, 0xf7, 0x00, 0x07, 0xff,
+  0xe1, 0x00, 0x00, 0x6f, 0xff, 0x10, 0x1f, 0xff, 0x60, 0x00, 0x00, 0x0d, 0xff, 0x90, 0x9f, 0xfd,
+  0xfe, 0x00, 0x04, 0x04, 0xff, 0xf6, 0xff, 0xf4, 0xfd, 0x00, 0x03, 0xbf, 0xff, 0xff, 0xb0, 0xfd,
+  0x00, 0x03, 0x2f, 0xff, 0xff, 0x20, 0xfd, 0x00, 0x02, 0x08, 0xff, 0xf8, 0xfb, 0x00, 0x01, 0xff,
+  0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0,
+  0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xfb,
+  0x00, 0x01, 0xff, 0xf0, 0xfb, 0x00, 0x01, 0xff, 0xf0, 0xce, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xfd, 0xa4, 0x00,  //@@@@@@@@%+..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80,  //@@@@@@@@@@%.
-  0xff, 0xf0, 0x00, 0x27, 0xff, 0xf5,  //@@@....+@@@+
-  0xff, 0xf0, 0x00, 0x00, 0x7f, 0xfb,  //@@@.....+@@%
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x7f, 0xfb,  //@@@.....+@@%
-  0xff, 0xf0, 0x00, 0x27, 0xff, 0xf5,  //@@@....+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x90,  //@@@@@@@@@@%.
-  0xff, 0xff, 0xff, 0xfd, 0xa4, 0x00,  //@@@@@@@@%+..
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe3, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0xfe, 0xff, 0x02, 0xfd, 0xa4, 0x00, 0xfc, 0xff, 0x2a, 0x80, 0xff, 0xf0, 0x00, 0x27, 0xff,
+  0xf5, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xfb, 0xff,
+  0xf0, 0x00, 0x27, 0xff, 0xf5, 0xfc, 0xff, 0x00, 0x90, 0xfe, 0xff, 0x04, 0xfd, 0xa4, 0x00, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0,
+  0xfd, 0x00, 0x01, 0xff, 0xf0, 0xd9, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x8d, 0xff, 0xd7, 0x00, 0x00,  //..%@@@@+....
-  0x0d, 0xff, 0xff, 0xff, 0xb0, 0x00,  //.@@@@@@@%...
-  0x7f, 0xfc, 0x11, 0xbf, 0xf6, 0x00,  //+@@@..%@@+..
-  0xcf, 0xf3, 0x00, 0x3f, 0xfb, 0x00,  //@@@....@@%..
-  0xff, 0xf0, 0x00, 0x1f, 0xfe, 0x00,  //@@@....@@@..
-  0xff, 0xf0, 0x07, 0xff, 0xe9, 0x00,  //@@@..+@@@%..
-  0xff, 0xf0, 0x5f, 0xfc, 0x10, 0x00,  //@@@.+@@@....
-  0xff, 0xf0, 0xcf, 0xf2, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xf0, 0xdf, 0xf0, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xf0, 0x5f, 0xf3, 0x00, 0x00,  //@@@.+@@.....
-  0xff, 0xf0, 0x04, 0xdf, 0xa1, 0x00,  //@@@..+@@%...
-  0xff, 0xf0, 0x00, 0x0e, 0xff, 0x50,  //@@@....@@@+.
-  0xff, 0xf0, 0x00, 0x01, 0xdf, 0xf3,  //@@@.....@@@.
-  0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfc,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0xb3, 0x02, 0xcf, 0xfa,  //@@@.%...@@@%
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xe1,  //@@@.@@@@@@@.
-  0xff, 0xf0, 0x3b, 0xff, 0xd9, 0x10,  //@@@..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe8, 0x00, 0x05, 0x8d, 0xff, 0xd7, 0x00, 0x00, 0x0d, 0xfe, 0xff, 0x63, 0xb0, 0x00, 0x7f, 0xfc,
+  0x11, 0xbf, 0xf6, 0x00, 0xcf, 0xf3, 0x00, 0x3f, 0xfb, 0x00, 0xff, 0xf0, 0x00, 0x1f, 0xfe, 0x00,
+  0xff, 0xf0, 0x07, 0xff, 0xe9, 0x00, 0xff, 0xf0, 0x5f, 0xfc, 0x10, 0x00, 0xff, 0xf0, 0xcf, 0xf2,
+  0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xdf, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0x5f, 0xf3, 0x00, 0x00, 0xff, 0xf0, 0x04, 0xdf, 0xa1, 0x00, 0xff, 0xf0, 0x00, 0x0e, 0xff, 0x50,
+  0xff, 0xf0, 0x00, 0x01, 0xdf, 0xf3, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0xf0, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xf0, 0xb3, 0x02, 0xcf, 0xfa, 0xff, 0xf0,
+  0xfe, 0xff, 0x06, 0xe1, 0xff, 0xf0, 0x3b, 0xff, 0xd9, 0x10, 0xdd, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x9f, 0xc0, 0x00, 0x00, 0x00,  //..%@@.......
-  0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00,  //...@@%......
-  0x00, 0x01, 0xef, 0x30, 0x00, 0x00,  //....@@......
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x05, 0xfa, 0x00, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xee, 0x00, 0x01, 0x9f, 0xc0, 0xfd, 0x00, 0x01, 0x0c, 0xf8, 0xfd, 0x00, 0x02, 0x01, 0xef, 0x30,
+  0xfd, 0x00, 0x01, 0x2f, 0xe0, 0xfd, 0x00, 0x01, 0x05, 0xfa, 0xf3, 0x00, 0x06, 0x02, 0x7b, 0xef,
+  0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00,
+  0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc,
+  0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,
+  0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00,  //.......@@%..
-  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00,  //......%@@...
-  0x00, 0x00, 0x03, 0xfd, 0x10, 0x00,  //......@@....
-  0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0xaf, 0x50, 0x00, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xec, 0x00, 0x01, 0x0c, 0xf9, 0xfd, 0x00, 0x01, 0x8f, 0xc0, 0xfe, 0x00, 0x02, 0x03, 0xfd, 0x10,
+  0xfe, 0x00, 0x01, 0x0e, 0xf2, 0xfd, 0x00, 0x01, 0xaf, 0x50, 0xf3, 0x00, 0x06, 0x02, 0x7b, 0xef,
+  0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00,
+  0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc,
+  0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,
+  0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00,  //....@@@@....
-  0x00, 0x07, 0xf7, 0x7f, 0x70, 0x00,  //...+@++@+...
-  0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00,  //...@@..@@...
-  0x00, 0xbf, 0x20, 0x02, 0xfb, 0x00,  //..%@....@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xed, 0x00, 0x01, 0x3f, 0xf3, 0xfd, 0x00, 0x01, 0xdf, 0xfd, 0xfe, 0x00, 0x0f, 0x07, 0xf7, 0x7f,
+  0x70, 0x00, 0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00, 0x00, 0xbf, 0x20, 0x02, 0xfb, 0xf4, 0x00, 0x06,
+  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83, 0x10, 0x15, 0xef,
+  0xf6, 0xfd, 0x00, 0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff,
+  0x00, 0x0a, 0xfc, 0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30,
+  0x2a, 0xef, 0xff, 0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd,
+  0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x1c, 0xe8, 0x00, 0xff, 0x00,  //...@@%..@@..
-  0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00,  //..%@@@+.@@..
-  0x00, 0xdf, 0x46, 0xff, 0xf8, 0x00,  //..@@++@@@%..
-  0x00, 0xff, 0x00, 0x8e, 0xc1, 0x00,  //..@@..%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe8, 0x00, 0x15, 0x1c, 0xe8, 0x00, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00, 0x00, 0xdf,
+  0x46, 0xff, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x8e, 0xc1, 0xf4, 0x00, 0x06, 0x02, 0x7b, 0xef, 0xfd,
+  0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00, 0x01,
+  0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc, 0xff,
+  0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0, 0x00,
+  0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff, 0x1e,
+  0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe8, 0x00, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff,
+  0xf0, 0x0f, 0xff, 0xee, 0x00, 0x06, 0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06,
+  0x90, 0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00, 0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f,
+  0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc, 0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f,
+  0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00,
+  0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff, 0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01,
+  0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x05, 0xdf, 0xd5, 0x00, 0x00,  //...+@@@+....
-  0x00, 0x5f, 0xff, 0xff, 0x50, 0x00,  //..+@@@@@+...
-  0x00, 0xdf, 0x70, 0x7f, 0xd0, 0x00,  //..@@+.+@@...
-  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00,  //..@@...@@...
-  0x00, 0xdf, 0x70, 0x7f, 0xd0, 0x00,  //..@@+.+@@...
-  0x00, 0x5f, 0xff, 0xff, 0x50, 0x00,  //..+@@@@@+...
-  0x00, 0x05, 0xdf, 0xd5, 0x00, 0x00,  //...+@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x02, 0x7b, 0xef, 0xfd, 0xa4, 0x00,  //..+%@@@@%+..
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0x90,  //.@@@@@@@@@%.
-  0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe,  //.........@@@
-  0x00, 0x4a, 0xdf, 0xff, 0xff, 0xff,  //..+%@@@@@@@@
-  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff,  //+@@@+....@@@
-  0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff,  //@@@+.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0x5f, 0xff,  //@@@.....+@@@
-  0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff,  //@@@.....@@@@
-  0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,  //%@@@...%@@@@
-  0x1e, 0xff, 0xff, 0xff, 0x4f, 0xff,  //.@@@@@@@+@@@
-  0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfa, 0x00, 0x02, 0x05, 0xdf, 0xd5, 0xfe, 0x00, 0x20, 0x5f, 0xff, 0xff, 0x50, 0x00, 0x00, 0xdf,
+  0x70, 0x7f, 0xd0, 0x00, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xdf, 0x70, 0x7f, 0xd0, 0x00,
+  0x00, 0x5f, 0xff, 0xff, 0x50, 0x00, 0x00, 0x05, 0xdf, 0xd5, 0xf3, 0x00, 0x06, 0x02, 0x7b, 0xef,
+  0xfd, 0xa4, 0x00, 0x0f, 0xfd, 0xff, 0x06, 0x90, 0x0d, 0x83, 0x10, 0x15, 0xef, 0xf6, 0xfd, 0x00,
+  0x01, 0x4f, 0xfc, 0xfd, 0x00, 0x04, 0x0f, 0xfe, 0x00, 0x4a, 0xdf, 0xfe, 0xff, 0x00, 0x0a, 0xfc,
+  0xff, 0x1e, 0x7f, 0xfe, 0x51, 0x00, 0x0f, 0xff, 0xdf, 0xf4, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xf0,
+  0x00, 0x00, 0x5f, 0xff, 0xef, 0xf2, 0x00, 0x00, 0xcf, 0xff, 0xaf, 0xfc, 0x30, 0x2a, 0xef, 0xff,
+  0x1e, 0xfe, 0xff, 0x07, 0x4f, 0xff, 0x01, 0x9e, 0xfe, 0xa2, 0x0f, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x03, 0x9d, 0xff, 0xb4, 0x07, 0xdf, 0xd4, 0x00,  //..%@@@%+.+@@@+.
-  0x0f, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0x20,  //.@@@@@@@%@@@@@.
-  0x0c, 0x51, 0x04, 0xdf, 0xff, 0x66, 0xff, 0x80,  //.@+..+@@@@++@@%
-  0x00, 0x00, 0x00, 0x4f, 0xff, 0x11, 0xff, 0xc0,  //......+@@@..@@@
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xe0,  //.......@@@..@@@
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0,  //.......@@@..@@@
-  0x00, 0x7c, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf0,  //..+@@@@@@@@@@@@
-  0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@@@@@
-  0xaf, 0xfb, 0x20, 0x0f, 0xff, 0x00, 0x00, 0x00,  //%@@%...@@@.....
-  0xff, 0xf1, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //@@@....@@@.....
-  0xff, 0xf1, 0x00, 0x2f, 0xff, 0x30, 0x00, 0x00,  //@@@....@@@.....
-  0xcf, 0xf9, 0x11, 0xaf, 0xff, 0xc2, 0x02, 0xa0,  //@@@%..%@@@@...%
-  0x4f, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xf0,  //+@@@@@@@+@@@@@@
-  0x03, 0xae, 0xfe, 0xa2, 0x04, 0xcf, 0xfb, 0x40,  //..%@@@%..+@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb1, 0x00, 0x08, 0x03, 0x9d, 0xff, 0xb4, 0x07, 0xdf, 0xd4, 0x00, 0x0f, 0xfe, 0xff, 0x0b, 0xaf,
+  0xff, 0xff, 0x20, 0x0c, 0x51, 0x04, 0xdf, 0xff, 0x66, 0xff, 0x80, 0xfe, 0x00, 0x04, 0x4f, 0xff,
+  0x11, 0xff, 0xc0, 0xfe, 0x00, 0x04, 0x0f, 0xff, 0x00, 0xff, 0xe0, 0xfe, 0x00, 0x07, 0x0f, 0xff,
+  0x00, 0xff, 0xf0, 0x00, 0x7c, 0xef, 0xfd, 0xff, 0x01, 0xf0, 0x1e, 0xfb, 0xff, 0x05, 0xf0, 0xaf,
+  0xfb, 0x20, 0x0f, 0xff, 0xfe, 0x00, 0x04, 0xff, 0xf1, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x1f, 0xff,
+  0xf1, 0x00, 0x2f, 0xff, 0x30, 0x00, 0x00, 0xcf, 0xf9, 0x11, 0xaf, 0xff, 0xc2, 0x02, 0xa0, 0x4f,
+  0xff, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xf0, 0x03, 0xae, 0xfe, 0xa2, 0x04, 0xcf, 0xfb, 0x40, 0xd1,
+  0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x03, 0xad, 0xfe, 0xb3, 0x00,  //....%@@@%..
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0x70,  //..%@@@@@@@+
-  0x0a, 0xff, 0xd5, 0x10, 0x3a, 0xf0,  //.%@@@+...%@
-  0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70,  //+@@@......+
-  0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xdf, 0xf2, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70,  //+@@@......+
-  0x0a, 0xff, 0xd5, 0x10, 0x2a, 0xf0,  //.%@@@+...%@
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0x70,  //..%@@@@@@@+
-  0x00, 0x04, 0xad, 0xff, 0xb3, 0x00,  //...+%@@@%..
-  0x00, 0x00, 0x00, 0xaf, 0x40, 0x00,  //......%@+..
-  0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00,  //.......@%..
-  0x00, 0x00, 0x00, 0x4f, 0xf0, 0x00,  //......+@@..
-  0x00, 0x00, 0xff, 0xff, 0xd0, 0x00,  //....@@@@@..
-  0x00, 0x00, 0xbf, 0xfc, 0x30, 0x00,  //....%@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc4, 0x00, 0x06, 0x03, 0xad, 0xfe, 0xb3, 0x00, 0x00, 0xaf, 0xfe, 0xff, 0x0e, 0x70, 0x0a, 0xff,
+  0xd5, 0x10, 0x3a, 0xf0, 0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70, 0xaf, 0xf6, 0xfd, 0x00, 0x01, 0xdf,
+  0xf2, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xdf, 0xf2,
+  0xfd, 0x00, 0x01, 0xaf, 0xf6, 0xfd, 0x00, 0x0d, 0x4f, 0xfe, 0x10, 0x00, 0x00, 0x70, 0x0a, 0xff,
+  0xd5, 0x10, 0x2a, 0xf0, 0x00, 0xaf, 0xfe, 0xff, 0x05, 0x70, 0x00, 0x04, 0xad, 0xff, 0xb3, 0xfd,
+  0x00, 0x01, 0xaf, 0x40, 0xfd, 0x00, 0x01, 0x1f, 0xb0, 0xfd, 0x00, 0x01, 0x4f, 0xf0, 0xfe, 0x00,
+  0x02, 0xff, 0xff, 0xd0, 0xfe, 0x00, 0x02, 0xbf, 0xfc, 0x30, 0xfa, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x00,  //..%@@........
-  0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00,  //...@@%.......
-  0x00, 0x01, 0xef, 0x30, 0x00, 0x00, 0x00,  //....@@.......
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x05, 0xfa, 0x00, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0x9d, 0xff, 0xc7, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x00,  //..%@@@@@@@@..
-  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00,  //.%@@@...%@@@.
-  0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60,  //.@@@.....%@@+
-  0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0,  //%@@+......@@%
-  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x4f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00,  //.%@@%+...+%@.
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xeb, 0x00, 0x01, 0x9f, 0xc0, 0xfc, 0x00, 0x01, 0x0c, 0xf8, 0xfc, 0x00, 0x02, 0x01, 0xef, 0x30,
+  0xfc, 0x00, 0x01, 0x2f, 0xe0, 0xfc, 0x00, 0x01, 0x05, 0xfa, 0xef, 0x00, 0x03, 0x03, 0x9d, 0xff,
+  0xc7, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x1d, 0xd2, 0x00, 0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd,
+  0x00, 0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0, 0xdf,
+  0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x02, 0xf0, 0xdf, 0xe0,
+  0xfc, 0x00, 0x01, 0xaf, 0xf1, 0xfc, 0x00, 0x01, 0x4f, 0xfa, 0xfc, 0x00, 0x08, 0x0a, 0xff, 0xb4,
+  0x00, 0x14, 0x8d, 0x00, 0x00, 0xaf, 0xfd, 0xff, 0x06, 0x00, 0x00, 0x04, 0xad, 0xff, 0xeb, 0x72,
+  0xd6, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00,  //.......@@%...
-  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00,  //......%@@....
-  0x00, 0x00, 0x03, 0xfd, 0x10, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0xaf, 0x50, 0x00, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0x9d, 0xff, 0xc7, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x00,  //..%@@@@@@@@..
-  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00,  //.%@@@...%@@@.
-  0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60,  //.@@@.....%@@+
-  0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0,  //%@@+......@@%
-  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x4f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00,  //.%@@%+...+%@.
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe9, 0x00, 0x01, 0x0c, 0xf9, 0xfc, 0x00, 0x01, 0x8f, 0xc0, 0xfd, 0x00, 0x02, 0x03, 0xfd, 0x10,
+  0xfd, 0x00, 0x01, 0x0e, 0xf2, 0xfc, 0x00, 0x01, 0xaf, 0x50, 0xef, 0x00, 0x03, 0x03, 0x9d, 0xff,
+  0xc7, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x1d, 0xd2, 0x00, 0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd,
+  0x00, 0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0, 0xdf,
+  0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x02, 0xf0, 0xdf, 0xe0,
+  0xfc, 0x00, 0x01, 0xaf, 0xf1, 0xfc, 0x00, 0x01, 0x4f, 0xfa, 0xfc, 0x00, 0x08, 0x0a, 0xff, 0xb4,
+  0x00, 0x14, 0x8d, 0x00, 0x00, 0xaf, 0xfd, 0xff, 0x06, 0x00, 0x00, 0x04, 0xad, 0xff, 0xeb, 0x72,
+  0xd6, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00, 0x00,  //....@@@@.....
-  0x00, 0x07, 0xf7, 0x7f, 0x70, 0x00, 0x00,  //...+@++@+....
-  0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00, 0x00,  //...@@..@@....
-  0x00, 0xbf, 0x20, 0x02, 0xfb, 0x00, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0x9d, 0xff, 0xc7, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x00,  //..%@@@@@@@@..
-  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00,  //.%@@@...%@@@.
-  0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60,  //.@@@.....%@@+
-  0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0,  //%@@+......@@%
-  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x4f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00,  //.%@@%+...+%@.
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xea, 0x00, 0x01, 0x3f, 0xf3, 0xfc, 0x00, 0x01, 0xdf, 0xfd, 0xfd, 0x00, 0x03, 0x07, 0xf7, 0x7f,
+  0x70, 0xfe, 0x00, 0x03, 0x1f, 0xc0, 0x0c, 0xf1, 0xfe, 0x00, 0x03, 0xbf, 0x20, 0x02, 0xfb, 0xf0,
+  0x00, 0x03, 0x03, 0x9d, 0xff, 0xc7, 0xfe, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x1d, 0xd2, 0x00, 0x09,
+  0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00, 0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x9f, 0xf5, 0x00,
+  0x00, 0x03, 0xff, 0xb0, 0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0, 0xfb, 0xff, 0x00, 0xf0, 0xfb,
+  0xff, 0x02, 0xf0, 0xdf, 0xe0, 0xfc, 0x00, 0x01, 0xaf, 0xf1, 0xfc, 0x00, 0x01, 0x4f, 0xfa, 0xfc,
+  0x00, 0x08, 0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00, 0x00, 0xaf, 0xfd, 0xff, 0x06, 0x00, 0x00,
+  0x04, 0xad, 0xff, 0xeb, 0x72, 0xd6, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x03, 0x9d, 0xff, 0xc7, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x9f, 0xff, 0xff, 0xff, 0xd2, 0x00,  //..%@@@@@@@@..
-  0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00,  //.%@@@...%@@@.
-  0x3f, 0xfd, 0x00, 0x00, 0x0a, 0xff, 0x60,  //.@@@.....%@@+
-  0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0,  //%@@+......@@%
-  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff, 0xe0,  //@@@.......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xaf, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x4f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00,  //.%@@%+...+%@.
-  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe4, 0x00, 0x03, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x00,
+  0x03, 0xff, 0xf0, 0x0f, 0xff, 0xe9, 0x00, 0x03, 0x03, 0x9d, 0xff, 0xc7, 0xfe, 0x00, 0x00, 0x9f,
+  0xfe, 0xff, 0x1d, 0xd2, 0x00, 0x09, 0xff, 0xc3, 0x01, 0x8f, 0xfd, 0x00, 0x3f, 0xfd, 0x00, 0x00,
+  0x0a, 0xff, 0x60, 0x9f, 0xf5, 0x00, 0x00, 0x03, 0xff, 0xb0, 0xdf, 0xf1, 0x00, 0x00, 0x01, 0xff,
+  0xe0, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x02, 0xf0, 0xdf, 0xe0, 0xfc, 0x00, 0x01, 0xaf, 0xf1,
+  0xfc, 0x00, 0x01, 0x4f, 0xfa, 0xfc, 0x00, 0x08, 0x0a, 0xff, 0xb4, 0x00, 0x14, 0x8d, 0x00, 0x00,
+  0xaf, 0xfd, 0xff, 0x06, 0x00, 0x00, 0x04, 0xad, 0xff, 0xeb, 0x72, 0xd6, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x00,  //..%@@........
-  0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x00,  //...@@%.......
-  0x00, 0x01, 0xef, 0x30, 0x00, 0x00, 0x00,  //....@@.......
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x05, 0xfa, 0x00, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xeb, 0x00, 0x01, 0x9f, 0xc0, 0xfc, 0x00, 0x01, 0x0c, 0xf8, 0xfc, 0x00, 0x02, 0x01, 0xef, 0x30,
+  0xfc, 0x00, 0x01, 0x2f, 0xe0, 0xfc, 0x00, 0x01, 0x05, 0xfa, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xff,
+  0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff,
+  0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00, 0x00,  //.......@@%...
-  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00, 0x00,  //......%@@....
-  0x00, 0x00, 0x03, 0xfd, 0x10, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0xaf, 0x50, 0x00, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe9, 0x00, 0x01, 0x0c, 0xf9, 0xfc, 0x00, 0x01, 0x8f, 0xc0, 0xfd, 0x00, 0x02, 0x03, 0xfd, 0x10,
+  0xfd, 0x00, 0x01, 0x0e, 0xf2, 0xfc, 0x00, 0x01, 0xaf, 0x50, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0xff,
+  0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff,
+  0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00, 0x00,  //....@@@@.....
-  0x00, 0x07, 0xf7, 0x7f, 0x70, 0x00, 0x00,  //...+@++@+....
-  0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00, 0x00,  //...@@..@@....
-  0x00, 0xbf, 0x20, 0x02, 0xfb, 0x00, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xea, 0x00, 0x01, 0x3f, 0xf3, 0xfc, 0x00, 0x01, 0xdf, 0xfd, 0xfd, 0x00, 0x03, 0x07, 0xf7, 0x7f,
+  0x70, 0xfe, 0x00, 0x03, 0x1f, 0xc0, 0x0c, 0xf1, 0xfe, 0x00, 0x03, 0xbf, 0x20, 0x02, 0xfb, 0xf1,
+  0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfe, 0x00, 0xfb,
+  0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x0f, 0xff, 0x0f, 0xff, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe4, 0x00, 0x03, 0x0f, 0xff, 0x0f, 0xff, 0xfe, 0x00, 0x03, 0x0f, 0xff, 0x0f, 0xff, 0xfe, 0x00,
+  0x03, 0x0f, 0xff, 0x0f, 0xff, 0xea, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xfe,
+  0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff,
+  0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc,
+  0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfe, 0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xd7, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x07, 0xff, 0xf4, 0x00, 0x02, 0x00,  //.+@@@+......
-  0x00, 0xbf, 0xfe, 0x48, 0xed, 0x00,  //..%@@@+%@@..
-  0x00, 0x1e, 0xff, 0xfd, 0x71, 0x00,  //...@@@@@+...
-  0x01, 0xaf, 0xff, 0xf8, 0x00, 0x00,  //..%@@@@%....
-  0x01, 0xc6, 0xbf, 0xff, 0x60, 0x00,  //..@+%@@@+...
-  0x00, 0x00, 0x1e, 0xff, 0xf3, 0x00,  //.....@@@@...
-  0x00, 0x18, 0xdf, 0xff, 0xfd, 0x00,  //...%@@@@@@..
-  0x02, 0xef, 0xff, 0xff, 0xff, 0x80,  //..@@@@@@@@%.
-  0x0d, 0xff, 0x81, 0x03, 0xff, 0xf0,  //.@@@%...@@@.
-  0x6f, 0xfb, 0x00, 0x00, 0x9f, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfa,  //%@@+....+@@%
-  0x6f, 0xfb, 0x00, 0x00, 0xbf, 0xf5,  //+@@%....%@@+
-  0x0d, 0xff, 0x81, 0x18, 0xff, 0xd0,  //.@@@%..%@@@.
-  0x02, 0xef, 0xff, 0xff, 0xfe, 0x20,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x80, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe9, 0x00, 0x1c, 0x07, 0xff, 0xf4, 0x00, 0x02, 0x00, 0x00, 0xbf, 0xfe, 0x48, 0xed, 0x00, 0x00,
+  0x1e, 0xff, 0xfd, 0x71, 0x00, 0x01, 0xaf, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xc6, 0xbf, 0xff, 0x60,
+  0xfe, 0x00, 0x0b, 0x1e, 0xff, 0xf3, 0x00, 0x00, 0x18, 0xdf, 0xff, 0xfd, 0x00, 0x02, 0xef, 0xfe,
+  0xff, 0x47, 0x80, 0x0d, 0xff, 0x81, 0x03, 0xff, 0xf0, 0x6f, 0xfb, 0x00, 0x00, 0x9f, 0xf6, 0xbf,
+  0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xbf, 0xf4, 0x00,
+  0x00, 0x4f, 0xfa, 0x6f, 0xfb, 0x00, 0x00, 0xbf, 0xf5, 0x0d, 0xff, 0x81, 0x18, 0xff, 0xd0, 0x02,
+  0xef, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x18, 0xdf, 0xfd, 0x80, 0xdc, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x1c, 0xe8, 0x00, 0xff, 0x00,  //...@@%..@@.
-  0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00,  //..%@@@+.@@.
-  0x00, 0xdf, 0x46, 0xff, 0xf8, 0x00,  //..@@++@@@%.
-  0x00, 0xff, 0x00, 0x8e, 0xc1, 0x00,  //..@@..%@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x4b, 0xff, 0xb2, 0x00,  //@@@.+%@@%..
-  0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10,  //@@@+@@@@@@.
-  0xff, 0xfe, 0x50, 0x2d, 0xff, 0x80,  //@@@@+..@@@%
-  0xff, 0xf8, 0x00, 0x04, 0xff, 0xc0,  //@@@%...+@@@
-  0xff, 0xf3, 0x00, 0x01, 0xff, 0xe0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe8, 0x00, 0x15, 0x1c, 0xe8, 0x00, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00, 0x00, 0xdf,
+  0x46, 0xff, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x8e, 0xc1, 0xf4, 0x00, 0x53, 0xff, 0xf0, 0x4b, 0xff,
+  0xb2, 0x00, 0xff, 0xf5, 0xff, 0xff, 0xfe, 0x10, 0xff, 0xfe, 0x50, 0x2d, 0xff, 0x80, 0xff, 0xf8,
+  0x00, 0x04, 0xff, 0xc0, 0xff, 0xf3, 0x00, 0x01, 0xff, 0xe0, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xf0,
+  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,
+  0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+  0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,
+  0xdd, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x9f, 0xc0, 0x00, 0x00, 0x00,  //..%@@.......
-  0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00,  //...@@%......
-  0x00, 0x01, 0xef, 0x30, 0x00, 0x00,  //....@@......
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x05, 0xfa, 0x00, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xee, 0x00, 0x01, 0x9f, 0xc0, 0xfd, 0x00, 0x01, 0x0c, 0xf8, 0xfd, 0x00, 0x02, 0x01, 0xef, 0x30,
+  0xfd, 0x00, 0x01, 0x2f, 0xe0, 0xfd, 0x00, 0x01, 0x05, 0xfa, 0xf2, 0x00, 0x51, 0x18, 0xdf, 0xfd,
+  0x81, 0x00, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0, 0x6f, 0xfa,
+  0x00, 0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00,
+  0x1f, 0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0x0e, 0xff,
+  0x71, 0x17, 0xff, 0xe0, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x18, 0xdf, 0xfd, 0x81, 0xdc,
+  0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00,  //.......@@%..
-  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00,  //......%@@...
-  0x00, 0x00, 0x03, 0xfd, 0x10, 0x00,  //......@@....
-  0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0xaf, 0x50, 0x00, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xec, 0x00, 0x01, 0x0c, 0xf9, 0xfd, 0x00, 0x01, 0x8f, 0xc0, 0xfe, 0x00, 0x02, 0x03, 0xfd, 0x10,
+  0xfe, 0x00, 0x01, 0x0e, 0xf2, 0xfd, 0x00, 0x01, 0xaf, 0x50, 0xf2, 0x00, 0x51, 0x18, 0xdf, 0xfd,
+  0x81, 0x00, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0, 0x6f, 0xfa,
+  0x00, 0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,
+  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00,
+  0x1f, 0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0x0e, 0xff,
+  0x71, 0x17, 0xff, 0xe0, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x18, 0xdf, 0xfd, 0x81, 0xdc,
+  0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x3f, 0xf3, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00,  //....@@@@....
-  0x00, 0x07, 0xf7, 0x7f, 0x70, 0x00,  //...+@++@+...
-  0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00,  //...@@..@@...
-  0x00, 0xbf, 0x20, 0x02, 0xfb, 0x00,  //..%@....@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xed, 0x00, 0x01, 0x3f, 0xf3, 0xfd, 0x00, 0x01, 0xdf, 0xfd, 0xfe, 0x00, 0x0f, 0x07, 0xf7, 0x7f,
+  0x70, 0x00, 0x00, 0x1f, 0xc0, 0x0c, 0xf1, 0x00, 0x00, 0xbf, 0x20, 0x02, 0xfb, 0xf3, 0x00, 0x51,
+  0x18, 0xdf, 0xfd, 0x81, 0x00, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0e, 0xff, 0x71, 0x17, 0xff,
+  0xd0, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00,
+  0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef,
+  0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0x6f, 0xfa, 0x00, 0x00, 0xaf,
+  0xf6, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x18, 0xdf,
+  0xfd, 0x81, 0xdc, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x1c, 0xe8, 0x00, 0xff, 0x00,  //...@@%..@@..
-  0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00,  //..%@@@+.@@..
-  0x00, 0xdf, 0x46, 0xff, 0xf8, 0x00,  //..@@++@@@%..
-  0x00, 0xff, 0x00, 0x8e, 0xc1, 0x00,  //..@@..%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe8, 0x00, 0x15, 0x1c, 0xe8, 0x00, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x63, 0xfd, 0x00, 0x00, 0xdf,
+  0x46, 0xff, 0xf8, 0x00, 0x00, 0xff, 0x00, 0x8e, 0xc1, 0xf3, 0x00, 0x51, 0x18, 0xdf, 0xfd, 0x81,
+  0x00, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0, 0x6f, 0xfa, 0x00,
+  0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f,
+  0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0x0e, 0xff, 0x71,
+  0x17, 0xff, 0xe0, 0x03, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x18, 0xdf, 0xfd, 0x81, 0xdc, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0,  //.@@@+..+@@@.
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xbf, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //%@@+....+@@%
-  0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //+@@%....%@@+
-  0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0,  //.@@@+..+@@@.
-  0x03, 0xef, 0xff, 0xff, 0xfe, 0x30,  //..@@@@@@@@..
-  0x00, 0x18, 0xdf, 0xfd, 0x81, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe8, 0x00, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0xff,
+  0xf0, 0x0f, 0xff, 0xed, 0x00, 0x51, 0x18, 0xdf, 0xfd, 0x81, 0x00, 0x03, 0xef, 0xff, 0xff, 0xfe,
+  0x30, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xd0, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xbf, 0xf4, 0x00,
+  0x00, 0x4f, 0xfb, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x0f, 0xff, 0xef, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xbf, 0xf4, 0x00, 0x00, 0x4f,
+  0xfb, 0x6f, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0x0e, 0xff, 0x71, 0x17, 0xff, 0xe0, 0x03, 0xef, 0xff,
+  0xff, 0xfe, 0x30, 0x00, 0x18, 0xdf, 0xfd, 0x81, 0xdc, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xb9, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xf0,
+  0x00, 0xfb, 0xff, 0x00, 0xf0, 0xfb, 0xff, 0x00, 0xf0, 0xf1, 0x00, 0x01, 0x0f, 0xff, 0xfc, 0x00,
+  0x01, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xc6, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x30,  //.............%.
-  0x00, 0x00, 0x29, 0xdf, 0xeb, 0x40, 0x9f, 0xa0,  //.....%@@@%+.%@%
-  0x00, 0x04, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0x00,  //...+@@@@@@@@@%.
-  0x00, 0x1e, 0xff, 0x81, 0x07, 0xff, 0xd0, 0x00,  //...@@@%..+@@@..
-  0x00, 0x7f, 0xfa, 0x00, 0x03, 0xff, 0xf3, 0x00,  //..+@@%....@@@..
-  0x00, 0xbf, 0xf4, 0x00, 0x0d, 0xdf, 0xf9, 0x00,  //..%@@+...@@@@%.
-  0x00, 0xef, 0xf1, 0x00, 0xae, 0x2f, 0xfd, 0x00,  //..@@@...%@.@@@.
-  0x00, 0xff, 0xf0, 0x06, 0xf3, 0x0f, 0xff, 0x00,  //..@@@..+@..@@@.
-  0x00, 0xff, 0xf0, 0x3f, 0x70, 0x0f, 0xff, 0x00,  //..@@@..@+..@@@.
-  0x00, 0xdf, 0xf3, 0xdb, 0x00, 0x1f, 0xfe, 0x00,  //..@@@.@%...@@@.
-  0x00, 0xaf, 0xfd, 0xe1, 0x00, 0x4f, 0xfb, 0x00,  //..%@@@@...+@@%.
-  0x00, 0x3f, 0xff, 0x30, 0x00, 0xaf, 0xf7, 0x00,  //...@@@....%@@+.
-  0x00, 0x0e, 0xff, 0x81, 0x07, 0xff, 0xe1, 0x00,  //...@@@%..+@@@..
-  0x00, 0xcf, 0xbf, 0xff, 0xff, 0xff, 0x40, 0x00,  //..@@%@@@@@@@+..
-  0x0c, 0xf7, 0x04, 0xbe, 0xfe, 0x92, 0x00, 0x00,  //.@@+.+%@@@%....
-  0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%+............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb3, 0x00, 0x0b, 0x08, 0x30, 0x00, 0x00, 0x29, 0xdf, 0xeb, 0x40, 0x9f, 0xa0, 0x00, 0x04, 0xfe,
+  0xff, 0x55, 0xfc, 0xfb, 0x00, 0x00, 0x1e, 0xff, 0x81, 0x07, 0xff, 0xd0, 0x00, 0x00, 0x7f, 0xfa,
+  0x00, 0x03, 0xff, 0xf3, 0x00, 0x00, 0xbf, 0xf4, 0x00, 0x0d, 0xdf, 0xf9, 0x00, 0x00, 0xef, 0xf1,
+  0x00, 0xae, 0x2f, 0xfd, 0x00, 0x00, 0xff, 0xf0, 0x06, 0xf3, 0x0f, 0xff, 0x00, 0x00, 0xff, 0xf0,
+  0x3f, 0x70, 0x0f, 0xff, 0x00, 0x00, 0xdf, 0xf3, 0xdb, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0xaf, 0xfd,
+  0xe1, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x3f, 0xff, 0x30, 0x00, 0xaf, 0xf7, 0x00, 0x00, 0x0e, 0xff,
+  0x81, 0x07, 0xff, 0xe1, 0x00, 0x00, 0xcf, 0xbf, 0xfe, 0xff, 0x0b, 0x40, 0x00, 0x0c, 0xf7, 0x04,
+  0xbe, 0xfe, 0x92, 0x00, 0x00, 0x08, 0x60, 0xd3, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x9f, 0xc0, 0x00, 0x00, 0x00,  //..%@@......
-  0x00, 0x0c, 0xf8, 0x00, 0x00, 0x00,  //...@@%.....
-  0x00, 0x01, 0xef, 0x30, 0x00, 0x00,  //....@@.....
-  0x00, 0x00, 0x2f, 0xe0, 0x00, 0x00,  //.....@@....
-  0x00, 0x00, 0x05, 0xfa, 0x00, 0x00,  //.....+@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0,  //@@@.....@@@
-  0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0,  //@@@+...%@@@
-  0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0,  //%@@@..+@@@@
-  0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0,  //.@@@@@@+@@@
-  0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xee, 0x00, 0x01, 0x9f, 0xc0, 0xfd, 0x00, 0x01, 0x0c, 0xf8, 0xfd, 0x00, 0x02, 0x01, 0xef, 0x30,
+  0xfd, 0x00, 0x01, 0x2f, 0xe0, 0xfd, 0x00, 0x01, 0x05, 0xfa, 0xf3, 0x00, 0x53, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x01, 0xff, 0xf0, 0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0, 0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0, 0x8f,
+  0xfd, 0x20, 0x5e, 0xff, 0xf0, 0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0x02, 0xbf, 0xfb, 0x40, 0xff,
+  0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x0c, 0xf9, 0x00,  //.......@@%.
-  0x00, 0x00, 0x00, 0x8f, 0xc0, 0x00,  //......%@@..
-  0x00, 0x00, 0x03, 0xfd, 0x10, 0x00,  //......@@...
-  0x00, 0x00, 0x0e, 0xf2, 0x00, 0x00,  //.....@@....
-  0x00, 0x00, 0xaf, 0x50, 0x00, 0x00,  //....%@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0,  //@@@.....@@@
-  0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0,  //@@@+...%@@@
-  0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0,  //%@@@..+@@@@
-  0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0,  //.@@@@@@+@@@
-  0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xec, 0x00, 0x01, 0x0c, 0xf9, 0xfd, 0x00, 0x01, 0x8f, 0xc0, 0xfe, 0x00, 0x02, 0x03, 0xfd, 0x10,
+  0xfe, 0x00, 0x01, 0x0e, 0xf2, 0xfd, 0x00, 0x01, 0xaf, 0x50, 0xf3, 0x00, 0x53, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x01, 0xff, 0xf0, 0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0, 0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0, 0x8f,
+  0xfd, 0x20, 0x5e, 0xff, 0xf0, 0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0x02, 0xbf, 0xfb, 0x40, 0xff,
+  0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x9f, 0x90, 0x00, 0x00,  //....%@%....
-  0x00, 0x02, 0xff, 0xf2, 0x00, 0x00,  //....@@@....
-  0x00, 0x0a, 0xf2, 0xfa, 0x00, 0x00,  //...%@.@%...
-  0x00, 0x3f, 0x60, 0x6f, 0x30, 0x00,  //...@+.+@...
-  0x00, 0xbd, 0x00, 0x0c, 0xb0, 0x00,  //..%@...@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0,  //@@@.....@@@
-  0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0,  //@@@+...%@@@
-  0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0,  //%@@@..+@@@@
-  0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0,  //.@@@@@@+@@@
-  0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xed, 0x00, 0x01, 0x9f, 0x90, 0xfe, 0x00, 0x02, 0x02, 0xff, 0xf2, 0xfe, 0x00, 0x02, 0x0a, 0xf2,
+  0xfa, 0xfe, 0x00, 0x09, 0x3f, 0x60, 0x6f, 0x30, 0x00, 0x00, 0xbd, 0x00, 0x0c, 0xb0, 0xf4, 0x00,
+  0x53, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0, 0xcf, 0xf4, 0x00,
+  0x09, 0xff, 0xf0, 0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0, 0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0, 0x02,
+  0xbf, 0xfb, 0x40, 0xff, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00fc (ü) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00,  //.@@@...@@@.
-  0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00,  //.@@@...@@@.
-  0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00,  //.@@@...@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@
-  0xff, 0xf1, 0x00, 0x03, 0xff, 0xf0,  //@@@.....@@@
-  0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0,  //@@@+...%@@@
-  0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0,  //%@@@..+@@@@
-  0x1e, 0xff, 0xff, 0xf5, 0xff, 0xf0,  //.@@@@@@+@@@
-  0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xe9, 0x00, 0x10, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x0f,
+  0xff, 0x00, 0x0f, 0xff, 0xee, 0x00, 0x53, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00,
+  0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff,
+  0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xf0, 0xff, 0xf1, 0x00,
+  0x03, 0xff, 0xf0, 0xcf, 0xf4, 0x00, 0x09, 0xff, 0xf0, 0x8f, 0xfd, 0x20, 0x5e, 0xff, 0xf0, 0x1e,
+  0xff, 0xff, 0xf5, 0xff, 0xf0, 0x02, 0xbf, 0xfb, 0x40, 0xff, 0xf0, 0xdd, 0x00,
 
   /*Unicode: U+00fd (ý) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0xcf, 0x90, 0x00,  //........@@%..
-  0x00, 0x00, 0x00, 0x08, 0xfc, 0x00, 0x00,  //.......%@@...
-  0x00, 0x00, 0x00, 0x3f, 0xd1, 0x00, 0x00,  //.......@@....
-  0x00, 0x00, 0x00, 0xef, 0x20, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x0a, 0xf5, 0x00, 0x00, 0x00,  //.....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcf, 0xf6, 0x00, 0x00, 0x06, 0xff, 0xc0,  //@@@+.....+@@@
-  0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff, 0x60,  //+@@@.....@@@+
-  0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff, 0x00,  //.@@@.....@@@.
-  0x09, 0xff, 0xa0, 0x00, 0x9f, 0xf9, 0x00,  //.%@@%...%@@%.
-  0x03, 0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00,  //..@@@...@@@..
-  0x00, 0xcf, 0xf6, 0x06, 0xff, 0xd0, 0x00,  //..@@@+.+@@@..
-  0x00, 0x6f, 0xfd, 0x0c, 0xff, 0x60, 0x00,  //..+@@@.@@@+..
-  0x00, 0x0f, 0xff, 0x6f, 0xff, 0x10, 0x00,  //...@@@+@@@...
-  0x00, 0x09, 0xff, 0xff, 0xfa, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0xcf, 0xff, 0xd0, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x6f, 0xff, 0x70, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x2f, 0xff, 0x10, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0xdf, 0xf5, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x04, 0xff, 0xe0, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x2d, 0xff, 0x80, 0x00, 0x00, 0x00,  //...@@@%......
-  0x0f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x0f, 0xfe, 0xa1, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xe8, 0x00, 0x01, 0xcf, 0x90, 0xfd, 0x00, 0x01, 0x08, 0xfc, 0xfc, 0x00, 0x01, 0x3f, 0xd1, 0xfc,
+  0x00, 0x01, 0xef, 0x20, 0xfd, 0x00, 0x01, 0x0a, 0xf5, 0xf0, 0x00, 0x3c, 0xcf, 0xf6, 0x00, 0x00,
+  0x06, 0xff, 0xc0, 0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff, 0x60, 0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff,
+  0x00, 0x09, 0xff, 0xa0, 0x00, 0x9f, 0xf9, 0x00, 0x03, 0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00, 0x00,
+  0xcf, 0xf6, 0x06, 0xff, 0xd0, 0x00, 0x00, 0x6f, 0xfd, 0x0c, 0xff, 0x60, 0x00, 0x00, 0x0f, 0xff,
+  0x6f, 0xff, 0x10, 0x00, 0x00, 0x09, 0xff, 0xff, 0xfa, 0xfe, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf4,
+  0xfd, 0x00, 0x02, 0xcf, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x6f, 0xff, 0x70, 0xfd, 0x00, 0x02, 0x2f,
+  0xff, 0x10, 0xfd, 0x00, 0x01, 0x7f, 0xfb, 0xfc, 0x00, 0x01, 0xdf, 0xf5, 0xfd, 0x00, 0x02, 0x04,
+  0xff, 0xe0, 0xfd, 0x00, 0x02, 0x2d, 0xff, 0x80, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xfd, 0xfd, 0x00,
+  0x02, 0x0f, 0xfe, 0xa1, 0xf6, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x30,  //@@@%@@@@@@..
-  0xff, 0xff, 0x81, 0x17, 0xff, 0xe0,  //@@@@%..+@@@.
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,  //@@@......@@@
-  0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe,  //@@@......@@@
-  0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb,  //@@@+....+@@%
-  0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6,  //@@@%....%@@+
-  0xff, 0xff, 0x71, 0x07, 0xff, 0xe0,  //@@@@+..+@@@.
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0x40,  //@@@%@@@@@@+.
-  0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00,  //@@@.+@@@%...
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xe9, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd,
+  0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00,
+  0x07, 0xff, 0xf0, 0x6d, 0xfe, 0xa2, 0x00, 0xff, 0xf8, 0xfe, 0xff, 0x3e, 0x30, 0xff, 0xff, 0x81,
+  0x17, 0xff, 0xe0, 0xff, 0xfa, 0x00, 0x00, 0xaf, 0xf6, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xff,
+  0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xf1, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xfb, 0xff, 0xfa, 0x00,
+  0x00, 0xaf, 0xf6, 0xff, 0xff, 0x71, 0x07, 0xff, 0xe0, 0xff, 0xf8, 0xfe, 0xff, 0x08, 0x40, 0xff,
+  0xf0, 0x6d, 0xfe, 0xa2, 0x00, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff,
+  0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xfd, 0x00, 0x01, 0xff, 0xf0, 0xf7, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00,  //...@@@..@@@..
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00,  //...@@@..@@@..
-  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00,  //...@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcf, 0xf6, 0x00, 0x00, 0x06, 0xff, 0xc0,  //@@@+.....+@@@
-  0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff, 0x60,  //+@@@.....@@@+
-  0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff, 0x00,  //.@@@.....@@@.
-  0x09, 0xff, 0xa0, 0x00, 0x9f, 0xf9, 0x00,  //.%@@%...%@@%.
-  0x03, 0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00,  //..@@@...@@@..
-  0x00, 0xcf, 0xf6, 0x06, 0xff, 0xd0, 0x00,  //..@@@+.+@@@..
-  0x00, 0x6f, 0xfd, 0x0c, 0xff, 0x60, 0x00,  //..+@@@.@@@+..
-  0x00, 0x0f, 0xff, 0x6f, 0xff, 0x10, 0x00,  //...@@@+@@@...
-  0x00, 0x09, 0xff, 0xff, 0xfa, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0xcf, 0xff, 0xd0, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x6f, 0xff, 0x70, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x2f, 0xff, 0x10, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0xdf, 0xf5, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x04, 0xff, 0xe0, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x2d, 0xff, 0x80, 0x00, 0x00, 0x00,  //...@@@%......
-  0x0f, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x0f, 0xfe, 0xa1, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0xe4, 0x00, 0x12, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0xeb, 0x00, 0x3c, 0xcf, 0xf6, 0x00, 0x00, 0x06, 0xff, 0xc0,
+  0x6f, 0xfd, 0x00, 0x00, 0x0d, 0xff, 0x60, 0x0f, 0xff, 0x30, 0x00, 0x3f, 0xff, 0x00, 0x09, 0xff,
+  0xa0, 0x00, 0x9f, 0xf9, 0x00, 0x03, 0xff, 0xf1, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xf6, 0x06,
+  0xff, 0xd0, 0x00, 0x00, 0x6f, 0xfd, 0x0c, 0xff, 0x60, 0x00, 0x00, 0x0f, 0xff, 0x6f, 0xff, 0x10,
+  0x00, 0x00, 0x09, 0xff, 0xff, 0xfa, 0xfe, 0x00, 0x03, 0x03, 0xff, 0xff, 0xf4, 0xfd, 0x00, 0x02,
+  0xcf, 0xff, 0xd0, 0xfd, 0x00, 0x02, 0x6f, 0xff, 0x70, 0xfd, 0x00, 0x02, 0x2f, 0xff, 0x10, 0xfd,
+  0x00, 0x01, 0x7f, 0xfb, 0xfc, 0x00, 0x01, 0xdf, 0xf5, 0xfd, 0x00, 0x02, 0x04, 0xff, 0xe0, 0xfd,
+  0x00, 0x02, 0x2d, 0xff, 0x80, 0xfe, 0x00, 0x02, 0x0f, 0xff, 0xfd, 0xfd, 0x00, 0x02, 0x0f, 0xfe,
+  0xa1, 0xf6, 0x00,
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 8
   /*Unicode: U+00a0 ( ) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0x81, 0x00, 0x91, 0x00,
 
   /*Unicode: U+00a1 (¡) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xb8, 0xff, 0xb6,  //%@%
-  0xc8, 0xff, 0xc8,  //@@@
-  0xda, 0xff, 0xda,  //@@@
-  0xec, 0xff, 0xea,  //@@@
-  0xfc, 0xff, 0xfa,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xf2, 0x00, 0xf8, 0xff, 0xf8, 0x00, 0x0e, 0xb8, 0xff, 0xb6, 0xc8, 0xff, 0xc8, 0xda, 0xff, 0xda,
+  0xec, 0xff, 0xea, 0xfc, 0xff, 0xfa, 0xe9, 0xff, 0xef, 0x00,
 
   /*Unicode: U+00a2 (¢) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x12, 0x76, 0xc0, 0xec, 0xff, 0xe2, 0xa2, 0x36,  //....+@@@@%.
-  0x00, 0x00, 0x5e, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..+@@@@@@@@
-  0x00, 0x68, 0xff, 0xff, 0xec, 0x68, 0x14, 0xff, 0x14, 0x50, 0xc2,  //.+@@@+.@.+@
-  0x22, 0xf8, 0xff, 0xf4, 0x2a, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.@@@...@...
-  0x92, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%@@%...@...
-  0xd6, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //@@@....@...
-  0xf4, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //@@@....@...
-  0xf4, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //@@@....@...
-  0xd8, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //@@@....@...
-  0x94, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //%@@%...@...
-  0x24, 0xfa, 0xff, 0xf6, 0x32, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.@@@...@...
-  0x00, 0x6c, 0xff, 0xff, 0xf2, 0x74, 0x22, 0xff, 0x18, 0x56, 0xc4,  //.+@@@+.@.+@
-  0x00, 0x00, 0x60, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //..+@@@@@@@@
-  0x00, 0x00, 0x00, 0x12, 0x74, 0xc0, 0xec, 0xff, 0xe4, 0xa2, 0x36,  //....+@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,  //.......@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xb8, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff,
+  0xfb, 0x00, 0x0b, 0x12, 0x76, 0xc0, 0xec, 0xff, 0xe2, 0xa2, 0x36, 0x00, 0x00, 0x5e, 0xf0, 0xfa,
+  0xff, 0x12, 0x00, 0x68, 0xff, 0xff, 0xec, 0x68, 0x14, 0xff, 0x14, 0x50, 0xc2, 0x22, 0xf8, 0xff,
+  0xf4, 0x2a, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0x92, 0xff, 0xff, 0x80, 0xfe, 0x00, 0x00, 0xff,
+  0xfe, 0x00, 0x03, 0xd6, 0xff, 0xff, 0x2a, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xf4, 0xff,
+  0xff, 0x06, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xf4, 0xff, 0xff, 0x06, 0xfe, 0x00, 0x00,
+  0xff, 0xfe, 0x00, 0x03, 0xd8, 0xff, 0xff, 0x2c, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0x94,
+  0xff, 0xff, 0x86, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x07, 0x24, 0xfa, 0xff, 0xf6, 0x32, 0x00,
+  0x00, 0xff, 0xfd, 0x00, 0x0d, 0x6c, 0xff, 0xff, 0xf2, 0x74, 0x22, 0xff, 0x18, 0x56, 0xc4, 0x00,
+  0x00, 0x60, 0xf0, 0xfa, 0xff, 0xfe, 0x00, 0x07, 0x12, 0x74, 0xc0, 0xec, 0xff, 0xe4, 0xa2, 0x36,
+  0xfa, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0xff,
+  0xe8, 0x00,
 
   /*Unicode: U+00a3 (£) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x9a, 0xd8, 0xf2, 0xf8, 0xd8, 0x98, 0x36,  //......%@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x66, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //....+@@@@@@@@
-  0x00, 0x00, 0x00, 0x2e, 0xfa, 0xff, 0xff, 0x88, 0x1e, 0x04, 0x16, 0x52, 0xbc,  //....@@@%...+%
-  0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@@%......
-  0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@@@@@@@@..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@@@@@@@@@..
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbb, 0x00, 0x07, 0x2c, 0x9a, 0xd8, 0xf2, 0xf8, 0xd8, 0x98, 0x36, 0xfd, 0x00, 0x01, 0x66, 0xfa,
+  0xfa, 0xff, 0xfe, 0x00, 0x09, 0x2e, 0xfa, 0xff, 0xff, 0x88, 0x1e, 0x04, 0x16, 0x52, 0xbc, 0xfe,
+  0x00, 0x03, 0x9c, 0xff, 0xff, 0x98, 0xf8, 0x00, 0x03, 0xda, 0xff, 0xff, 0x36, 0xf8, 0x00, 0x03,
+  0xf4, 0xff, 0xff, 0x0a, 0xf8, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xfa, 0x00, 0xf6, 0xff, 0x01, 0x00, 0x00, 0xf6, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe,
+  0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe,
+  0xff, 0xfa, 0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+00a4 (¤) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x96, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x9c,  //%%.......+%
-  0x80, 0xff, 0xb0, 0x44, 0xc2, 0xf0, 0xc0, 0x48, 0xae, 0xff, 0x7e,  //%@%+@@@+%@+
-  0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //.%@@@@@@@%.
-  0x00, 0x3a, 0xff, 0xdc, 0x40, 0x0a, 0x3e, 0xdc, 0xff, 0x46, 0x00,  //..@@+..@@+.
-  0x00, 0xc0, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xc0, 0x00,  //.@@.....@@.
-  0x00, 0xf2, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf0, 0x00,  //.@@.....@@.
-  0x00, 0xc2, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x40, 0xff, 0xc0, 0x00,  //.@@....+@@.
-  0x00, 0x44, 0xff, 0xdc, 0x3e, 0x0a, 0x40, 0xde, 0xff, 0x40, 0x00,  //.+@@..+@@+.
-  0x00, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00,  //.%@@@@@@@%.
-  0x7a, 0xff, 0xb0, 0x48, 0xc2, 0xf0, 0xc2, 0x40, 0xae, 0xff, 0x80,  //+@%+@@@+%@%
-  0x9c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x98,  //%%.......+%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x88, 0x00, 0x01, 0x96, 0x80, 0xfa, 0x00, 0x0e, 0x7a, 0x9c, 0x80, 0xff, 0xb0, 0x44, 0xc2, 0xf0,
+  0xc0, 0x48, 0xae, 0xff, 0x7e, 0x00, 0xae, 0xfa, 0xff, 0x10, 0xb0, 0x00, 0x00, 0x3a, 0xff, 0xdc,
+  0x40, 0x0a, 0x3e, 0xdc, 0xff, 0x46, 0x00, 0x00, 0xc0, 0xff, 0x3e, 0xfe, 0x00, 0x07, 0x3e, 0xff,
+  0xc0, 0x00, 0x00, 0xf2, 0xff, 0x0a, 0xfe, 0x00, 0x07, 0x0a, 0xff, 0xf0, 0x00, 0x00, 0xc2, 0xff,
+  0x3e, 0xfe, 0x00, 0x10, 0x40, 0xff, 0xc0, 0x00, 0x00, 0x44, 0xff, 0xdc, 0x3e, 0x0a, 0x40, 0xde,
+  0xff, 0x40, 0x00, 0x00, 0xae, 0xfa, 0xff, 0x0e, 0xb0, 0x00, 0x7a, 0xff, 0xb0, 0x48, 0xc2, 0xf0,
+  0xc2, 0x40, 0xae, 0xff, 0x80, 0x9c, 0x80, 0xfa, 0x00, 0x01, 0x7e, 0x98, 0xa9, 0x00,
 
   /*Unicode: U+00a5 (¥) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xb4, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xb2,  //%@@%.......%@@%
-  0x26, 0xf8, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xf6, 0x22,  //.@@@+.....+@@@.
-  0x00, 0x8c, 0xff, 0xff, 0xd4, 0x02, 0x00, 0x00, 0x00, 0x02, 0xd6, 0xff, 0xff, 0x84, 0x00,  //.%@@@.....@@@%.
-  0x00, 0x0e, 0xe8, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xe0, 0x08, 0x00,  //..@@@+...+@@@..
-  0x00, 0x00, 0x64, 0xff, 0xff, 0xea, 0x0e, 0x00, 0x10, 0xec, 0xff, 0xff, 0x54, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0x8c, 0x00, 0x8e, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00,  //...@@@%.%@@%...
-  0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xf8, 0x48, 0xf8, 0xff, 0xfa, 0x2a, 0x00, 0x00, 0x00,  //....@@@+@@@....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.@@@@@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb6, 0x00, 0x03, 0xb4, 0xff, 0xff, 0xb6, 0xfa, 0x00, 0x08, 0xba, 0xff, 0xff, 0xb2, 0x26, 0xf8,
+  0xff, 0xff, 0x48, 0xfc, 0x00, 0x0a, 0x4c, 0xff, 0xff, 0xf6, 0x22, 0x00, 0x8c, 0xff, 0xff, 0xd4,
+  0x02, 0xfe, 0x00, 0x0b, 0x02, 0xd6, 0xff, 0xff, 0x84, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xff, 0x6a,
+  0xfe, 0x00, 0x04, 0x6c, 0xff, 0xff, 0xe0, 0x08, 0xfe, 0x00, 0x0a, 0x64, 0xff, 0xff, 0xea, 0x0e,
+  0x00, 0x10, 0xec, 0xff, 0xff, 0x54, 0xfc, 0x00, 0x08, 0xce, 0xff, 0xff, 0x8c, 0x00, 0x8e, 0xff,
+  0xff, 0xbc, 0xfb, 0x00, 0x08, 0x3c, 0xff, 0xff, 0xf8, 0x48, 0xf8, 0xff, 0xfa, 0x2a, 0xfd, 0x00,
+  0xfb, 0xff, 0x00, 0xfa, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xf4, 0xff, 0xfb, 0x00, 0x00, 0xc2, 0xfe,
+  0xff, 0x00, 0xbc, 0xf7, 0x00, 0x00, 0x20, 0xfe, 0xff, 0x00, 0x20, 0xfb, 0x00, 0xf4, 0xff, 0x01,
+  0x00, 0x00, 0xf4, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff,
+  0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xa1, 0x00,
 
   /*Unicode: U+00a6 (¦) , Width: 2 */
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0xff, 0xff,  //@@
-  0x00, 0x00,  //..
-  0x00, 0x00,  //..
-
+  0xf7, 0x00, 0xed, 0xff, 0xfb, 0x00, 0xed, 0xff, 0xfd, 0x00,
 
   /*Unicode: U+00a7 (§) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x1a, 0x8c, 0xd0, 0xf0, 0xf4, 0xd0, 0x8e, 0x32, 0x00,  //...%@@@@%..
-  0x00, 0x36, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..@@@@@@@@.
-  0x00, 0xc8, 0xff, 0xba, 0x34, 0x0a, 0x0a, 0x32, 0x74, 0xce, 0x00,  //.@@%....+@.
-  0x00, 0xf8, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@........
-  0x00, 0xe2, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@+.......
-  0x00, 0x84, 0xff, 0xfc, 0x8a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%@@%......
-  0x00, 0x20, 0xf2, 0xff, 0xff, 0xee, 0x82, 0x0e, 0x00, 0x00, 0x00,  //..@@@@%....
-  0x28, 0xec, 0xf0, 0x6c, 0xb6, 0xff, 0xff, 0xea, 0x64, 0x00, 0x00,  //.@@+%@@@+..
-  0xb6, 0xff, 0x4e, 0x00, 0x00, 0x32, 0xb6, 0xff, 0xff, 0xb0, 0x08,  //%@+...%@@%.
-  0xf2, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xee, 0xff, 0x8e,  //@@.....+@@%
-  0xde, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xe8,  //@@+.....+@@
-  0x6e, 0xff, 0xfc, 0x8a, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xea,  //+@@%.....@@
-  0x00, 0x7c, 0xfa, 0xff, 0xe8, 0x70, 0x08, 0x00, 0x78, 0xff, 0x98,  //.+@@@+..+@%
-  0x00, 0x00, 0x2e, 0xbe, 0xff, 0xff, 0xea, 0xac, 0xff, 0xc4, 0x0c,  //...%@@@%@@.
-  0x00, 0x00, 0x00, 0x00, 0x46, 0xc6, 0xff, 0xff, 0xf0, 0x12, 0x00,  //....+@@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xee, 0xff, 0x94, 0x00,  //......+@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xea, 0x00,  //.......+@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf4, 0x00,  //........@@.
-  0x00, 0xce, 0x74, 0x30, 0x08, 0x0a, 0x38, 0xc0, 0xff, 0xb8, 0x00,  //.@+....@@%.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x2a, 0x00,  //.@@@@@@@@..
-  0x00, 0x32, 0x8e, 0xd0, 0xf4, 0xf8, 0xdc, 0x94, 0x1c, 0x00, 0x00,  //..%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xc8, 0x00, 0x0b, 0x1a, 0x8c, 0xd0, 0xf0, 0xf4, 0xd0, 0x8e, 0x32, 0x00, 0x00, 0x36, 0xf2, 0xfa,
+  0xff, 0x0f, 0x00, 0x00, 0xc8, 0xff, 0xba, 0x34, 0x0a, 0x0a, 0x32, 0x74, 0xce, 0x00, 0x00, 0xf8,
+  0xff, 0x14, 0xf9, 0x00, 0x02, 0xe2, 0xff, 0x5a, 0xf9, 0x00, 0x04, 0x84, 0xff, 0xfc, 0x8a, 0x10,
+  0xfb, 0x00, 0x06, 0x20, 0xf2, 0xff, 0xff, 0xee, 0x82, 0x0e, 0xfe, 0x00, 0x18, 0x28, 0xec, 0xf0,
+  0x6c, 0xb6, 0xff, 0xff, 0xea, 0x64, 0x00, 0x00, 0xb6, 0xff, 0x4e, 0x00, 0x00, 0x32, 0xb6, 0xff,
+  0xff, 0xb0, 0x08, 0xf2, 0xff, 0x0e, 0xfd, 0x00, 0x06, 0x4e, 0xee, 0xff, 0x8e, 0xde, 0xff, 0x74,
+  0xfc, 0x00, 0x07, 0x44, 0xff, 0xe8, 0x6e, 0xff, 0xfc, 0x8a, 0x0a, 0xfe, 0x00, 0x18, 0x0a, 0xff,
+  0xea, 0x00, 0x7c, 0xfa, 0xff, 0xe8, 0x70, 0x08, 0x00, 0x78, 0xff, 0x98, 0x00, 0x00, 0x2e, 0xbe,
+  0xff, 0xff, 0xea, 0xac, 0xff, 0xc4, 0x0c, 0xfd, 0x00, 0x05, 0x46, 0xc6, 0xff, 0xff, 0xf0, 0x12,
+  0xfa, 0x00, 0x03, 0x56, 0xee, 0xff, 0x94, 0xf9, 0x00, 0x02, 0x40, 0xff, 0xea, 0xf9, 0x00, 0x0f,
+  0x1a, 0xff, 0xf4, 0x00, 0x00, 0xce, 0x74, 0x30, 0x08, 0x0a, 0x38, 0xc0, 0xff, 0xb8, 0x00, 0x00,
+  0xfa, 0xff, 0x0b, 0xec, 0x2a, 0x00, 0x00, 0x32, 0x8e, 0xd0, 0xf4, 0xf8, 0xdc, 0x94, 0x1c, 0xd3,
+  0x00,
 
   /*Unicode: U+00a8 (¨) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xe1, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00,
+  0x00, 0xfe, 0xff, 0x81, 0x00, 0xc9, 0x00,
 
   /*Unicode: U+00a9 (©) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x2c, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x04, 0x94, 0xe2, 0x74, 0x2a, 0x0a, 0x0a, 0x2a, 0x74, 0xe2, 0x94, 0x04, 0x00, 0x00,  //...%@+....+@%...
-  0x00, 0x04, 0xba, 0xa8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa8, 0xba, 0x04, 0x00,  //..%%........%%..
-  0x00, 0x92, 0xaa, 0x00, 0x00, 0x46, 0xae, 0xe6, 0xf8, 0xea, 0xb0, 0x46, 0x00, 0xa8, 0x92, 0x00,  //.%%..+%@@@%+.%%.
-  0x2a, 0xe4, 0x0a, 0x00, 0x92, 0xff, 0xa8, 0x2c, 0x04, 0x12, 0x50, 0xba, 0x00, 0x0a, 0xe4, 0x2a,  //.@..%@%...+%..@.
-  0x92, 0x76, 0x00, 0x5e, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x90,  //%+.+@%........+%
-  0xd6, 0x2c, 0x00, 0xc6, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xd4,  //@..@@..........@
-  0xf2, 0x0a, 0x00, 0xf4, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf2,  //@..@@..........@
-  0xf2, 0x0a, 0x00, 0xf4, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf2,  //@..@@..........@
-  0xd6, 0x2c, 0x00, 0xc8, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xd4,  //@..@@..........@
-  0x92, 0x78, 0x00, 0x62, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x90,  //%+.+@%........+%
-  0x2a, 0xe6, 0x0c, 0x00, 0x9a, 0xff, 0xaa, 0x32, 0x06, 0x12, 0x42, 0xb2, 0x00, 0x0c, 0xe4, 0x2a,  //.@..%@%...+%..@.
-  0x00, 0x8e, 0xb0, 0x00, 0x00, 0x4c, 0xb2, 0xe6, 0xf8, 0xe2, 0xb2, 0x46, 0x00, 0xae, 0x8e, 0x00,  //.%%..+%@@@%+.%%.
-  0x00, 0x02, 0xb6, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xae, 0xb4, 0x02, 0x00,  //..%%........%%..
-  0x00, 0x00, 0x02, 0x8e, 0xe4, 0x78, 0x2c, 0x0a, 0x0a, 0x2c, 0x78, 0xe4, 0x8e, 0x02, 0x00, 0x00,  //...%@+....+@%...
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x28, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0x8d, 0x00, 0x07, 0x2c, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x2a, 0xfb, 0x00, 0x0b, 0x04, 0x94,
+  0xe2, 0x74, 0x2a, 0x0a, 0x0a, 0x2a, 0x74, 0xe2, 0x94, 0x04, 0xfe, 0x00, 0x03, 0x04, 0xba, 0xa8,
+  0x0a, 0xfb, 0x00, 0x2a, 0x08, 0xa8, 0xba, 0x04, 0x00, 0x00, 0x92, 0xaa, 0x00, 0x00, 0x46, 0xae,
+  0xe6, 0xf8, 0xea, 0xb0, 0x46, 0x00, 0xa8, 0x92, 0x00, 0x2a, 0xe4, 0x0a, 0x00, 0x92, 0xff, 0xa8,
+  0x2c, 0x04, 0x12, 0x50, 0xba, 0x00, 0x0a, 0xe4, 0x2a, 0x92, 0x76, 0x00, 0x5e, 0xff, 0xbc, 0xf9,
+  0x00, 0x07, 0x76, 0x90, 0xd6, 0x2c, 0x00, 0xc6, 0xff, 0x3e, 0xf9, 0x00, 0x07, 0x2c, 0xd4, 0xf2,
+  0x0a, 0x00, 0xf4, 0xff, 0x12, 0xf9, 0x00, 0x07, 0x0a, 0xf2, 0xf2, 0x0a, 0x00, 0xf4, 0xff, 0x06,
+  0xf9, 0x00, 0x07, 0x0a, 0xf2, 0xd6, 0x2c, 0x00, 0xc8, 0xff, 0x34, 0xf9, 0x00, 0x07, 0x2c, 0xd4,
+  0x92, 0x78, 0x00, 0x62, 0xff, 0xaa, 0xf9, 0x00, 0x26, 0x78, 0x90, 0x2a, 0xe6, 0x0c, 0x00, 0x9a,
+  0xff, 0xaa, 0x32, 0x06, 0x12, 0x42, 0xb2, 0x00, 0x0c, 0xe4, 0x2a, 0x00, 0x8e, 0xb0, 0x00, 0x00,
+  0x4c, 0xb2, 0xe6, 0xf8, 0xe2, 0xb2, 0x46, 0x00, 0xae, 0x8e, 0x00, 0x00, 0x02, 0xb6, 0xb0, 0x0c,
+  0xfb, 0x00, 0x03, 0x0c, 0xae, 0xb4, 0x02, 0xfe, 0x00, 0x0b, 0x02, 0x8e, 0xe4, 0x78, 0x2c, 0x0a,
+  0x0a, 0x2c, 0x78, 0xe4, 0x8e, 0x02, 0xfb, 0x00, 0x07, 0x2a, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90,
+  0x28, 0x8d, 0x00,
 
   /*Unicode: U+00aa (ª) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x3e, 0xa6, 0xe6, 0xfa, 0xec, 0xc0, 0x5e, 0x00, 0x00,  //..%@@@@+..
-  0x00, 0xc4, 0x54, 0x10, 0x0a, 0x34, 0xbe, 0xff, 0x72, 0x00,  //.@+...%@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xde, 0x00,  //.......@@.
-  0x00, 0x3a, 0xac, 0xe6, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0x00,  //..%@@@@@@.
-  0x4e, 0xfc, 0xd4, 0x40, 0x0c, 0x00, 0x02, 0xff, 0xff, 0x00,  //+@@+...@@.
-  0xd2, 0xff, 0x36, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0x00,  //@@.....@@.
-  0xf6, 0xff, 0x08, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0x00,  //@@....+@@.
-  0xd8, 0xff, 0x2a, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x00,  //@@....%@@.
-  0x6c, 0xff, 0xbc, 0x1c, 0x12, 0x8c, 0xf6, 0xff, 0xff, 0x00,  //+@%..%@@@.
-  0x00, 0x68, 0xd2, 0xf6, 0xea, 0xac, 0x2e, 0xff, 0xff, 0x00,  //.+@@@%.@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16,  //%@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xce, 0x00, 0x06, 0x3e, 0xa6, 0xe6, 0xfa, 0xec, 0xc0, 0x5e, 0xfe, 0x00, 0x07, 0xc4, 0x54, 0x10,
+  0x0a, 0x34, 0xbe, 0xff, 0x72, 0xfa, 0x00, 0x08, 0x1a, 0xff, 0xde, 0x00, 0x00, 0x3a, 0xac, 0xe6,
+  0xfa, 0xfe, 0xff, 0x0e, 0xfc, 0x00, 0x4e, 0xfc, 0xd4, 0x40, 0x0c, 0x00, 0x02, 0xff, 0xff, 0x00,
+  0xd2, 0xff, 0x36, 0xfe, 0x00, 0x06, 0x1c, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x08, 0xfe, 0x00, 0x06,
+  0x4c, 0xff, 0xff, 0x00, 0xd8, 0xff, 0x2a, 0xfe, 0x00, 0x16, 0xba, 0xff, 0xff, 0x00, 0x6c, 0xff,
+  0xbc, 0x1c, 0x12, 0x8c, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x68, 0xd2, 0xf6, 0xea, 0xac, 0x2e, 0xff,
+  0xff, 0xf6, 0x00, 0x00, 0x9e, 0xf9, 0xff, 0x00, 0x16, 0x81, 0x00, 0x01, 0x00, 0x00,
 
   /*Unicode: U+00ab («) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,  //.....%.....%
-  0x00, 0x00, 0x00, 0x02, 0x9e, 0xff, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xff,  //....%@....%@
-  0x00, 0x00, 0x08, 0xb2, 0xff, 0xdc, 0x00, 0x00, 0x08, 0xb2, 0xff, 0xda,  //...%@@...%@@
-  0x00, 0x10, 0xc4, 0xff, 0xd0, 0x16, 0x00, 0x10, 0xc4, 0xff, 0xc6, 0x12,  //..@@@...@@@.
-  0x1a, 0xd2, 0xff, 0xc4, 0x10, 0x00, 0x1a, 0xd2, 0xff, 0xae, 0x08, 0x00,  //.@@@...@@%..
-  0xe0, 0xff, 0xb6, 0x08, 0x00, 0x00, 0xe0, 0xff, 0x92, 0x00, 0x00, 0x00,  //@@%...@@%...
-  0xe0, 0xff, 0xb6, 0x08, 0x00, 0x00, 0xe0, 0xff, 0x90, 0x00, 0x00, 0x00,  //@@%...@@%...
-  0x1a, 0xd2, 0xff, 0xc4, 0x0e, 0x00, 0x1a, 0xd2, 0xff, 0xae, 0x08, 0x00,  //.@@@...@@%..
-  0x00, 0x10, 0xc4, 0xff, 0xd0, 0x16, 0x00, 0x10, 0xc4, 0xff, 0xc6, 0x12,  //..@@@...@@@.
-  0x00, 0x00, 0x08, 0xb2, 0xff, 0xdc, 0x00, 0x00, 0x08, 0xb2, 0xff, 0xda,  //...%@@...%@@
-  0x00, 0x00, 0x00, 0x02, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x02, 0xa0, 0xff,  //....%@....%@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,  //.....%.....%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x81, 0x00, 0xf8, 0x00, 0x00, 0x8a, 0xfc, 0x00, 0x00, 0x8a, 0xfe, 0x00, 0x02, 0x02, 0x9e, 0xff,
+  0xfe, 0x00, 0x2f, 0x02, 0x9e, 0xff, 0x00, 0x00, 0x08, 0xb2, 0xff, 0xdc, 0x00, 0x00, 0x08, 0xb2,
+  0xff, 0xda, 0x00, 0x10, 0xc4, 0xff, 0xd0, 0x16, 0x00, 0x10, 0xc4, 0xff, 0xc6, 0x12, 0x1a, 0xd2,
+  0xff, 0xc4, 0x10, 0x00, 0x1a, 0xd2, 0xff, 0xae, 0x08, 0x00, 0xe0, 0xff, 0xb6, 0x08, 0x00, 0x00,
+  0xe0, 0xff, 0x92, 0xfe, 0x00, 0x08, 0xe0, 0xff, 0xb6, 0x08, 0x00, 0x00, 0xe0, 0xff, 0x90, 0xfe,
+  0x00, 0x23, 0x1a, 0xd2, 0xff, 0xc4, 0x0e, 0x00, 0x1a, 0xd2, 0xff, 0xae, 0x08, 0x00, 0x00, 0x10,
+  0xc4, 0xff, 0xd0, 0x16, 0x00, 0x10, 0xc4, 0xff, 0xc6, 0x12, 0x00, 0x00, 0x08, 0xb2, 0xff, 0xdc,
+  0x00, 0x00, 0x08, 0xb2, 0xff, 0xda, 0xfe, 0x00, 0x02, 0x02, 0xa0, 0xff, 0xfe, 0x00, 0x02, 0x02,
+  0xa0, 0xff, 0xfc, 0x00, 0x00, 0x8a, 0xfc, 0x00, 0x00, 0x8a, 0xad, 0x00,
 
   /*Unicode: U+00ac (¬) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,  //...........@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0xd8, 0x00, 0xe7, 0xff, 0xf6, 0x00, 0x01, 0xff, 0xff, 0xf6, 0x00, 0x01, 0xff, 0xff,
+  0xf6, 0x00, 0x01, 0xff, 0xff, 0xf6, 0x00, 0x01, 0xff, 0xff, 0x81, 0x00, 0xf2, 0x00,
 
   /*Unicode: U+00ad (­) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0x91, 0x00, 0xf3, 0xff, 0xad, 0x00,
 
   /*Unicode: U+00ae (®) , Width: 16 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x2c, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x04, 0x94, 0xe2, 0x74, 0x2a, 0x0a, 0x0a, 0x2a, 0x74, 0xe2, 0x94, 0x04, 0x00, 0x00,  //...%@+....+@%...
-  0x00, 0x04, 0xba, 0xa8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa8, 0xba, 0x04, 0x00,  //..%%........%%..
-  0x00, 0x92, 0xaa, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd4, 0x8a, 0x0e, 0x00, 0xa8, 0x92, 0x00,  //.%%.@@@@@@%..%%.
-  0x2a, 0xe4, 0x0a, 0x00, 0xff, 0xff, 0x00, 0x00, 0x14, 0x7c, 0xff, 0xba, 0x00, 0x0a, 0xe4, 0x2a,  //.@..@@...+@%..@.
-  0x92, 0x76, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xf4, 0x00, 0x00, 0x76, 0x90,  //%+..@@....@@..+%
-  0xd6, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x14, 0x7e, 0xff, 0xaa, 0x00, 0x00, 0x2c, 0xd4,  //@...@@...+@%...@
-  0xf2, 0x0a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x72, 0x06, 0x00, 0x00, 0x0a, 0xf2,  //@...@@@@@@+....@
-  0xf2, 0x0a, 0x00, 0x00, 0xff, 0xff, 0x1c, 0x72, 0xf8, 0xfa, 0x46, 0x00, 0x00, 0x00, 0x0a, 0xf2,  //@...@@.+@@+....@
-  0xd6, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x64, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x2c, 0xd4,  //@...@@..+@@....@
-  0x92, 0x78, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xbc, 0xff, 0x90, 0x00, 0x00, 0x78, 0x90,  //%+..@@...%@%..+%
-  0x2a, 0xe6, 0x0c, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x2c, 0xfa, 0xfa, 0x26, 0x0c, 0xe4, 0x2a,  //.@..@@....@@..@.
-  0x00, 0x8e, 0xb0, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xb6, 0xae, 0x8e, 0x00,  //.%%.@@....%@%%%.
-  0x00, 0x02, 0xb6, 0xb0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xae, 0xb4, 0x02, 0x00,  //..%%........%%..
-  0x00, 0x00, 0x02, 0x8e, 0xe4, 0x78, 0x2c, 0x0a, 0x0a, 0x2c, 0x78, 0xe4, 0x8e, 0x02, 0x00, 0x00,  //...%@+....+@%...
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x28, 0x00, 0x00, 0x00, 0x00,  //.....%@@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................
-
+  0x8d, 0x00, 0x07, 0x2c, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x2a, 0xfb, 0x00, 0x0b, 0x04, 0x94,
+  0xe2, 0x74, 0x2a, 0x0a, 0x0a, 0x2a, 0x74, 0xe2, 0x94, 0x04, 0xfe, 0x00, 0x03, 0x04, 0xba, 0xa8,
+  0x0a, 0xfb, 0x00, 0x08, 0x08, 0xa8, 0xba, 0x04, 0x00, 0x00, 0x92, 0xaa, 0x00, 0xfd, 0xff, 0x1d,
+  0xf4, 0xd4, 0x8a, 0x0e, 0x00, 0xa8, 0x92, 0x00, 0x2a, 0xe4, 0x0a, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x14, 0x7c, 0xff, 0xba, 0x00, 0x0a, 0xe4, 0x2a, 0x92, 0x76, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00,
+  0x1a, 0x0c, 0xff, 0xf4, 0x00, 0x00, 0x76, 0x90, 0xd6, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x14, 0x7e, 0xff, 0xaa, 0x00, 0x00, 0x2c, 0xd4, 0xf2, 0x0a, 0x00, 0x00, 0xfc, 0xff, 0x11, 0xe0,
+  0x72, 0x06, 0x00, 0x00, 0x0a, 0xf2, 0xf2, 0x0a, 0x00, 0x00, 0xff, 0xff, 0x1c, 0x72, 0xf8, 0xfa,
+  0x46, 0xfe, 0x00, 0x17, 0x0a, 0xf2, 0xd6, 0x2c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x64, 0xff,
+  0xe6, 0x0e, 0x00, 0x00, 0x2c, 0xd4, 0x92, 0x78, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x0c, 0xbc,
+  0xff, 0x90, 0x00, 0x00, 0x78, 0x90, 0x2a, 0xe6, 0x0c, 0x00, 0xff, 0xff, 0xfe, 0x00, 0x0c, 0x2c,
+  0xfa, 0xfa, 0x26, 0x0c, 0xe4, 0x2a, 0x00, 0x8e, 0xb0, 0x00, 0xff, 0xff, 0xfd, 0x00, 0x0a, 0x98,
+  0xff, 0xb6, 0xae, 0x8e, 0x00, 0x00, 0x02, 0xb6, 0xb0, 0x0c, 0xfb, 0x00, 0x03, 0x0c, 0xae, 0xb4,
+  0x02, 0xfe, 0x00, 0x0b, 0x02, 0x8e, 0xe4, 0x78, 0x2c, 0x0a, 0x0a, 0x2c, 0x78, 0xe4, 0x8e, 0x02,
+  0xfb, 0x00, 0x07, 0x2a, 0x92, 0xd6, 0xf2, 0xf2, 0xd4, 0x90, 0x28, 0x8d, 0x00,
 
   /*Unicode: U+00af (¯) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd9, 0x00, 0xf1, 0xff, 0x81, 0x00, 0xc9, 0x00,
 
   /*Unicode: U+00b0 (°) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x28, 0xb0, 0xf2, 0xf0, 0xac, 0x24, 0x00,  //..%@@%..
-  0x26, 0xee, 0xff, 0xff, 0xff, 0xff, 0xec, 0x24,  //.@@@@@@.
-  0xb0, 0xff, 0xb4, 0x1a, 0x1a, 0xb6, 0xff, 0xac,  //%@%..%@%
-  0xf2, 0xff, 0x1a, 0x00, 0x00, 0x1c, 0xff, 0xf0,  //@@....@@
-  0xf4, 0xff, 0x16, 0x00, 0x00, 0x1a, 0xff, 0xf2,  //@@....@@
-  0xb8, 0xff, 0xac, 0x16, 0x1a, 0xb4, 0xff, 0xb2,  //%@%..%@%
-  0x32, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xee, 0x28,  //.@@@@@@.
-  0x00, 0x32, 0xb8, 0xf4, 0xf2, 0xb0, 0x26, 0x00,  //..%@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd8, 0x00, 0x08, 0x28, 0xb0, 0xf2, 0xf0, 0xac, 0x24, 0x00, 0x26, 0xee, 0xfd, 0xff, 0x23, 0xec,
+  0x24, 0xb0, 0xff, 0xb4, 0x1a, 0x1a, 0xb6, 0xff, 0xac, 0xf2, 0xff, 0x1a, 0x00, 0x00, 0x1c, 0xff,
+  0xf0, 0xf4, 0xff, 0x16, 0x00, 0x00, 0x1a, 0xff, 0xf2, 0xb8, 0xff, 0xac, 0x16, 0x1a, 0xb4, 0xff,
+  0xb2, 0x32, 0xf6, 0xfd, 0xff, 0x08, 0xee, 0x28, 0x00, 0x32, 0xb8, 0xf4, 0xf2, 0xb0, 0x26, 0x81,
+  0x00, 0xf8, 0x00,
 
   /*Unicode: U+00b1 (±) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0x81, 0x00, 0xfd, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff,
+  0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0xe5, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xf5,
+  0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xd1, 0x00,
+  0xe5, 0xff, 0xad, 0x00,
 
   /*Unicode: U+00b2 (²) , Width: 7 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x44, 0xb4, 0xf0, 0xee, 0xc6, 0x52, 0x00,  //+%@@@+.
-  0xb6, 0x40, 0x08, 0x20, 0xb4, 0xff, 0x72,  //%+..%@+
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf6,  //.....@@
-  0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xd0,  //....+@@
-  0x00, 0x00, 0x00, 0x2e, 0xf6, 0xff, 0x74,  //....@@+
-  0x00, 0x00, 0x16, 0xe0, 0xff, 0xc6, 0x04,  //...@@@.
-  0x00, 0x14, 0xd2, 0xff, 0xd0, 0x12, 0x00,  //..@@@..
-  0x12, 0xd0, 0xff, 0xd2, 0x14, 0x00, 0x00,  //.@@@...
-  0xcc, 0xff, 0xd4, 0x16, 0x00, 0x00, 0x00,  //@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......
-
+  0xde, 0x00, 0x0d, 0x44, 0xb4, 0xf0, 0xee, 0xc6, 0x52, 0x00, 0xb6, 0x40, 0x08, 0x20, 0xb4, 0xff,
+  0x72, 0xfd, 0x00, 0x02, 0x18, 0xff, 0xe4, 0xfd, 0x00, 0x02, 0x18, 0xff, 0xf6, 0xfd, 0x00, 0x02,
+  0x7e, 0xff, 0xd0, 0xfe, 0x00, 0x1c, 0x2e, 0xf6, 0xff, 0x74, 0x00, 0x00, 0x16, 0xe0, 0xff, 0xc6,
+  0x04, 0x00, 0x14, 0xd2, 0xff, 0xd0, 0x12, 0x00, 0x12, 0xd0, 0xff, 0xd2, 0x14, 0x00, 0x00, 0xcc,
+  0xff, 0xd4, 0x16, 0xfe, 0x00, 0xfa, 0xff, 0x9f, 0x00,
 
   /*Unicode: U+00b3 (³) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x30, 0x96, 0xe0, 0xf8, 0xe6, 0xc0, 0x6a, 0x04,  //.%@@@@+.
-  0xc8, 0x5e, 0x16, 0x06, 0x26, 0x9c, 0xff, 0xae,  //@+...%@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf2,  //......@@
-  0x00, 0x00, 0x00, 0x06, 0x28, 0x9e, 0xff, 0x86,  //.....%@%
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xf6, 0x64, 0x00,  //..@@@@+.
-  0x00, 0x00, 0x00, 0x0e, 0x44, 0xd8, 0xfa, 0x52,  //....+@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xd6,  //......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf6,  //......@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xce,  //.....+@@
-  0xbc, 0x4e, 0x14, 0x10, 0x4e, 0xe2, 0xf8, 0x46,  //%+..+@@+
-  0x3c, 0xb2, 0xf0, 0xf8, 0xe0, 0xa4, 0x30, 0x00,  //.%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd9, 0x00, 0x0f, 0x30, 0x96, 0xe0, 0xf8, 0xe6, 0xc0, 0x6a, 0x04, 0xc8, 0x5e, 0x16, 0x06, 0x26,
+  0x9c, 0xff, 0xae, 0xfc, 0x00, 0x02, 0x10, 0xff, 0xf2, 0xfe, 0x00, 0x06, 0x06, 0x28, 0x9e, 0xff,
+  0x86, 0x00, 0x00, 0xfe, 0xff, 0x01, 0xf6, 0x64, 0xfd, 0x00, 0x04, 0x0e, 0x44, 0xd8, 0xfa, 0x52,
+  0xfc, 0x00, 0x02, 0x38, 0xff, 0xd6, 0xfc, 0x00, 0x02, 0x0a, 0xff, 0xf6, 0xfc, 0x00, 0x11, 0x40,
+  0xff, 0xce, 0xbc, 0x4e, 0x14, 0x10, 0x4e, 0xe2, 0xf8, 0x46, 0x3c, 0xb2, 0xf0, 0xf8, 0xe0, 0xa4,
+  0x30, 0x90, 0x00,
 
   /*Unicode: U+00b4 (´) , Width: 6 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x04, 0xce, 0xff, 0x96,  //...@@%
-  0x00, 0x00, 0x88, 0xff, 0xc0, 0x04,  //..%@@.
-  0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00,  //..@@..
-  0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00,  //.@@...
-  0xa4, 0xff, 0x54, 0x00, 0x00, 0x00,  //%@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......
-
+  0xed, 0x00, 0x18, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x3e, 0xfc,
+  0xde, 0x14, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x81, 0x00, 0xfa, 0x00,
 
   /*Unicode: U+00b5 (µ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@.....@@@..
-  0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0x00, 0x00,  //@@@+...+@@@..
-  0xff, 0xff, 0xff, 0xdc, 0x38, 0x0c, 0x4e, 0xee, 0xff, 0xff, 0xff, 0x32, 0x00,  //@@@@..+@@@@..
-  0xff, 0xff, 0xca, 0xec, 0xff, 0xff, 0xff, 0xf6, 0x90, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@%@@@@
-  0xff, 0xff, 0xb6, 0x36, 0xca, 0xf6, 0xd0, 0x42, 0x04, 0xa4, 0xf2, 0xe6, 0x9e,  //@@%.@@@+.%@@%
-  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01,
+  0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe,
+  0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfd,
+  0x00, 0x00, 0x06, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x14, 0xfe, 0x00, 0x00, 0x20,
+  0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x50, 0xfe, 0x00, 0x00, 0x70, 0xfe, 0xff, 0x01,
+  0x00, 0x00, 0xfe, 0xff, 0x04, 0xdc, 0x38, 0x0c, 0x4e, 0xee, 0xfe, 0xff, 0x05, 0x32, 0x00, 0xff,
+  0xff, 0xca, 0xec, 0xfe, 0xff, 0x01, 0xf6, 0x90, 0xfb, 0xff, 0x0d, 0xb6, 0x36, 0xca, 0xf6, 0xd0,
+  0x42, 0x04, 0xa4, 0xf2, 0xe6, 0x9e, 0xff, 0xff, 0xb6, 0xf7, 0x00, 0x02, 0xff, 0xff, 0xb6, 0xf7,
+  0x00, 0x02, 0xff, 0xff, 0xb6, 0xf7, 0x00, 0x02, 0xff, 0xff, 0xb6, 0xf7, 0x00, 0x02, 0xff, 0xff,
+  0xb6, 0xea, 0x00,
 
   /*Unicode: U+00b6 (¶) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x14, 0x7e, 0xc8, 0xee, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,  //...+@@@@@@@@
-  0x00, 0x42, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.+@@@@@@@@@@
-  0x24, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //.@@@@@@@..@@
-  0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //%@@@@@@@..@@
-  0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@@@@@@@..@@
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@@@@@@@..@@
-  0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //@@@@@@@@..@@
-  0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //%@@@@@@@..@@
-  0x28, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //.@@@@@@@..@@
-  0x00, 0x44, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //.+@@@@@@..@@
-  0x00, 0x00, 0x10, 0x76, 0xc2, 0xee, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //...+@@@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,  //......@@..@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc3, 0x00, 0x04, 0x14, 0x7e, 0xc8, 0xee, 0xfc, 0xfc, 0xff, 0x02, 0x00, 0x42, 0xea, 0xf8, 0xff,
+  0x01, 0x24, 0xf2, 0xfb, 0xff, 0x04, 0x00, 0x00, 0xff, 0xff, 0x9e, 0xfa, 0xff, 0x04, 0x00, 0x00,
+  0xff, 0xff, 0xe4, 0xfa, 0xff, 0x04, 0x00, 0x00, 0xff, 0xff, 0xf8, 0xfa, 0xff, 0x04, 0x00, 0x00,
+  0xff, 0xff, 0xe6, 0xfa, 0xff, 0x04, 0x00, 0x00, 0xff, 0xff, 0xa2, 0xfa, 0xff, 0x05, 0x00, 0x00,
+  0xff, 0xff, 0x28, 0xf4, 0xfb, 0xff, 0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0x44, 0xec, 0xfc, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x10, 0x76, 0xc2, 0xee, 0xff, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00,
+  0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00,
+  0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+  0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff,
+  0x00, 0x00, 0xff, 0xff, 0xdd, 0x00,
 
   /*Unicode: U+00b7 (·) , Width: 3 */
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0xff, 0xff, 0xff,  //@@@
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-  0x00, 0x00, 0x00,  //...
-
+  0xda, 0x00, 0xf5, 0xff, 0xda, 0x00,
 
   /*Unicode: U+00b8 (¸) , Width: 5 */
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-  0x00, 0x00, 0xa6, 0xff, 0x48,  //..%@+
-  0x00, 0x00, 0x1e, 0xff, 0xbe,  //...@%
-  0x00, 0x00, 0x40, 0xff, 0xf6,  //..+@@
-  0xff, 0xff, 0xff, 0xff, 0xd2,  //@@@@@
-  0xbe, 0xf0, 0xf2, 0xc2, 0x30,  //%@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00,  //.....
-
+  0x87, 0x00, 0x0c, 0xa6, 0xff, 0x48, 0x00, 0x00, 0x1e, 0xff, 0xbe, 0x00, 0x00, 0x40, 0xff, 0xf6,
+  0xfd, 0xff, 0x05, 0xd2, 0xbe, 0xf0, 0xf2, 0xc2, 0x30, 0xfc, 0x00,
 
   /*Unicode: U+00b9 (¹) , Width: 8 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x26, 0x78, 0xca, 0xff, 0xff, 0x00, 0x00, 0x00,  //.+@@@...
-  0xd4, 0x7e, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x00,  //@+.@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@...
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........
-
+  0xd9, 0x00, 0x04, 0x26, 0x78, 0xca, 0xff, 0xff, 0xfe, 0x00, 0x04, 0xd4, 0x7e, 0x2a, 0xff, 0xff,
+  0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb,
+  0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfb, 0x00,
+  0x01, 0xff, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xf9, 0xff, 0x91, 0x00,
 
   /*Unicode: U+00ba (º) , Width: 9 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x0e, 0x8c, 0xe0, 0xf8, 0xe0, 0x8c, 0x0c, 0x00,  //..%@@@%..
-  0x08, 0xce, 0xf0, 0x46, 0x06, 0x48, 0xf2, 0xcc, 0x08,  //.@@+.+@@.
-  0x7c, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x7a,  //+@+...+@+
-  0xd2, 0xff, 0x28, 0x00, 0x00, 0x00, 0x28, 0xff, 0xd0,  //@@.....@@
-  0xf6, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xf4,  //@@.....@@
-  0xf6, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf4,  //@@.....@@
-  0xd2, 0xff, 0x26, 0x00, 0x00, 0x00, 0x28, 0xff, 0xd2,  //@@.....@@
-  0x7c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x7c,  //+@+...+@+
-  0x0a, 0xd0, 0xee, 0x46, 0x06, 0x48, 0xf2, 0xce, 0x08,  //.@@+.+@@.
-  0x00, 0x0e, 0x8e, 0xe2, 0xfa, 0xe2, 0x8e, 0x0e, 0x00,  //..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82,  //%@@@@@@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........
-
+  0xd3, 0x00, 0x13, 0x0e, 0x8c, 0xe0, 0xf8, 0xe0, 0x8c, 0x0c, 0x00, 0x08, 0xce, 0xf0, 0x46, 0x06,
+  0x48, 0xf2, 0xcc, 0x08, 0x7c, 0xff, 0x7a, 0xfe, 0x00, 0x05, 0x7e, 0xff, 0x7a, 0xd2, 0xff, 0x28,
+  0xfe, 0x00, 0x05, 0x28, 0xff, 0xd0, 0xf6, 0xff, 0x0a, 0xfe, 0x00, 0x05, 0x0c, 0xff, 0xf4, 0xf6,
+  0xff, 0x0a, 0xfe, 0x00, 0x05, 0x0a, 0xff, 0xf4, 0xd2, 0xff, 0x26, 0xfe, 0x00, 0x05, 0x28, 0xff,
+  0xd2, 0x7c, 0xff, 0x78, 0xfe, 0x00, 0x13, 0x7e, 0xff, 0x7c, 0x0a, 0xd0, 0xee, 0x46, 0x06, 0x48,
+  0xf2, 0xce, 0x08, 0x00, 0x0e, 0x8e, 0xe2, 0xfa, 0xe2, 0x8e, 0x0e, 0xf7, 0x00, 0x00, 0x96, 0xfa,
+  0xff, 0x00, 0x82, 0x8c, 0x00,
 
   /*Unicode: U+00bb (») , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,  //%.....%.....
-  0xff, 0x9e, 0x02, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x02, 0x00, 0x00, 0x00,  //@%....@%....
-  0xda, 0xff, 0xb2, 0x08, 0x00, 0x00, 0xdc, 0xff, 0xb2, 0x08, 0x00, 0x00,  //@@%...@@%...
-  0x14, 0xc6, 0xff, 0xc2, 0x10, 0x00, 0x18, 0xd0, 0xff, 0xc2, 0x10, 0x00,  //.@@@...@@@..
-  0x00, 0x08, 0xae, 0xff, 0xd2, 0x1a, 0x00, 0x10, 0xc4, 0xff, 0xd2, 0x1a,  //..%@@...@@@.
-  0x00, 0x00, 0x00, 0x92, 0xff, 0xe0, 0x00, 0x00, 0x08, 0xb6, 0xff, 0xe0,  //...%@@...%@@
-  0x00, 0x00, 0x00, 0x92, 0xff, 0xe0, 0x00, 0x00, 0x08, 0xb6, 0xff, 0xe0,  //...%@@...%@@
-  0x00, 0x08, 0xae, 0xff, 0xd2, 0x1a, 0x00, 0x10, 0xc4, 0xff, 0xd2, 0x1a,  //..%@@...@@@.
-  0x14, 0xc6, 0xff, 0xc4, 0x10, 0x00, 0x18, 0xd0, 0xff, 0xc4, 0x10, 0x00,  //.@@@...@@@..
-  0xda, 0xff, 0xb2, 0x08, 0x00, 0x00, 0xdc, 0xff, 0xb2, 0x08, 0x00, 0x00,  //@@%...@@%...
-  0xff, 0x9e, 0x02, 0x00, 0x00, 0x00, 0xff, 0x9e, 0x02, 0x00, 0x00, 0x00,  //@%....@%....
-  0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //%.....%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x81, 0x00, 0xfd, 0x00, 0x00, 0x88, 0xfc, 0x00, 0x00, 0x88, 0xfc, 0x00, 0x02, 0xff, 0x9e, 0x02,
+  0xfe, 0x00, 0x02, 0xff, 0x9e, 0x02, 0xfe, 0x00, 0x23, 0xda, 0xff, 0xb2, 0x08, 0x00, 0x00, 0xdc,
+  0xff, 0xb2, 0x08, 0x00, 0x00, 0x14, 0xc6, 0xff, 0xc2, 0x10, 0x00, 0x18, 0xd0, 0xff, 0xc2, 0x10,
+  0x00, 0x00, 0x08, 0xae, 0xff, 0xd2, 0x1a, 0x00, 0x10, 0xc4, 0xff, 0xd2, 0x1a, 0xfe, 0x00, 0x08,
+  0x92, 0xff, 0xe0, 0x00, 0x00, 0x08, 0xb6, 0xff, 0xe0, 0xfe, 0x00, 0x2f, 0x92, 0xff, 0xe0, 0x00,
+  0x00, 0x08, 0xb6, 0xff, 0xe0, 0x00, 0x08, 0xae, 0xff, 0xd2, 0x1a, 0x00, 0x10, 0xc4, 0xff, 0xd2,
+  0x1a, 0x14, 0xc6, 0xff, 0xc4, 0x10, 0x00, 0x18, 0xd0, 0xff, 0xc4, 0x10, 0x00, 0xda, 0xff, 0xb2,
+  0x08, 0x00, 0x00, 0xdc, 0xff, 0xb2, 0x08, 0x00, 0x00, 0xff, 0x9e, 0x02, 0xfe, 0x00, 0x02, 0xff,
+  0x9e, 0x02, 0xfe, 0x00, 0x00, 0x8a, 0xfc, 0x00, 0x00, 0x8a, 0xa8, 0x00,
 
   /*Unicode: U+00bc (¼) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x26, 0x78, 0xca, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@........
-  0x00, 0xd4, 0x7e, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@+.@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x4c, 0x84, 0xbc, 0xc6,  //.@@@@@@@@.+%%@
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a,  //......+%@@@%+.
-  0x1a, 0x52, 0x8a, 0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00,  //.+%@@@%+......
-  0xc8, 0xbc, 0x84, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x00,  //.........+@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0xff, 0xff, 0x00, 0x00,  //.........@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xca, 0xa0, 0xff, 0xff, 0x00, 0x00,  //........@%@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xf2, 0x18, 0xff, 0xff, 0x00, 0x00,  //.......+@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf6, 0x78, 0x00, 0xff, 0xff, 0x00, 0x00,  //.......@+.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xdc, 0x06, 0x00, 0xff, 0xff, 0x00, 0x00,  //......@@..@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0x50, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....+@+..@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbc, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....@%...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.....@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xd6, 0x00, 0x04, 0x26, 0x78, 0xca, 0xff, 0xff, 0xf8, 0x00, 0x04, 0xd4, 0x7e, 0x2a, 0xff, 0xff,
+  0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5,
+  0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00,
+  0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x00, 0xf9, 0xff, 0x04, 0x14, 0x4c, 0x84,
+  0xbc, 0xc6, 0xfd, 0x00, 0x13, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a, 0x1a,
+  0x52, 0x8a, 0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0xfd, 0x00, 0x04, 0xc8, 0xbc, 0x84, 0x4c,
+  0x14, 0xef, 0x00, 0x02, 0x7c, 0xff, 0xff, 0xf7, 0x00, 0x03, 0x2a, 0xf6, 0xff, 0xff, 0xf8, 0x00,
+  0x04, 0x02, 0xca, 0xa0, 0xff, 0xff, 0xf8, 0x00, 0x04, 0x76, 0xf2, 0x18, 0xff, 0xff, 0xf9, 0x00,
+  0x05, 0x28, 0xf6, 0x78, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x06, 0x02, 0xc6, 0xdc, 0x06, 0x00, 0xff,
+  0xff, 0xfa, 0x00, 0x06, 0x72, 0xff, 0x50, 0x00, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xf4, 0xbc,
+  0xfe, 0x00, 0x01, 0xff, 0xff, 0xfa, 0x00, 0xf9, 0xff, 0xf6, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00,
+  0x01, 0xff, 0xff, 0xe3, 0x00,
 
   /*Unicode: U+00bd (½) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x26, 0x78, 0xca, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+@@@........
-  0x00, 0xd4, 0x7e, 0x2a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@+.@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@........
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x4c, 0x84, 0xbc, 0xc6,  //.@@@@@@@@.+%%@
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a,  //......+%@@@%+.
-  0x1a, 0x52, 0x8a, 0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00,  //.+%@@@%+......
-  0xc8, 0xbc, 0x84, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xb4, 0xf0, 0xee, 0xc6, 0x52, 0x00,  //.......+%@@@+.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x40, 0x08, 0x20, 0xb4, 0xff, 0x72,  //.......%+..%@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xe4,  //............@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xf6,  //............@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xd0,  //...........+@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf6, 0xff, 0x74,  //...........@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xe0, 0xff, 0xc6, 0x04,  //..........@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd2, 0xff, 0xd0, 0x12, 0x00,  //.........@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xd0, 0xff, 0xd2, 0x14, 0x00, 0x00,  //........@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xd4, 0x16, 0x00, 0x00, 0x00,  //.......@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.......@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xd6, 0x00, 0x04, 0x26, 0x78, 0xca, 0xff, 0xff, 0xf8, 0x00, 0x04, 0xd4, 0x7e, 0x2a, 0xff, 0xff,
+  0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5,
+  0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00,
+  0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x00, 0xf9, 0xff, 0x04, 0x14, 0x4c, 0x84,
+  0xbc, 0xc6, 0xfd, 0x00, 0x13, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a, 0x1a,
+  0x52, 0x8a, 0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0xfd, 0x00, 0x04, 0xc8, 0xbc, 0x84, 0x4c,
+  0x14, 0xf1, 0x00, 0x05, 0x44, 0xb4, 0xf0, 0xee, 0xc6, 0x52, 0xf9, 0x00, 0x06, 0xb6, 0x40, 0x08,
+  0x20, 0xb4, 0xff, 0x72, 0xf6, 0x00, 0x02, 0x18, 0xff, 0xe4, 0xf6, 0x00, 0x02, 0x18, 0xff, 0xf6,
+  0xf6, 0x00, 0x02, 0x7e, 0xff, 0xd0, 0xf7, 0x00, 0x03, 0x2e, 0xf6, 0xff, 0x74, 0xf8, 0x00, 0x04,
+  0x16, 0xe0, 0xff, 0xc6, 0x04, 0xf9, 0x00, 0x04, 0x14, 0xd2, 0xff, 0xd0, 0x12, 0xf9, 0x00, 0x04,
+  0x12, 0xd0, 0xff, 0xd2, 0x14, 0xf8, 0x00, 0x03, 0xcc, 0xff, 0xd4, 0x16, 0xf7, 0x00, 0xfa, 0xff,
+  0xe5, 0x00,
 
   /*Unicode: U+00be (¾) , Width: 14 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x30, 0x96, 0xe0, 0xf8, 0xe6, 0xc0, 0x6a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@@@+......
-  0x00, 0xc8, 0x5e, 0x16, 0x06, 0x26, 0x9c, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@+...%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x28, 0x9e, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@%.....
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf6, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@@+......
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x44, 0xd8, 0xfa, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@@.....
-  0x00, 0xbc, 0x4e, 0x14, 0x10, 0x4e, 0xe2, 0xf8, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%+..+@@+.....
-  0x00, 0x3c, 0xb2, 0xf0, 0xf8, 0xe0, 0xa4, 0x30, 0x00, 0x14, 0x4c, 0x84, 0xbc, 0xc6,  //..%@@@%...+%%@
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a,  //......+%@@@%+.
-  0x1a, 0x52, 0x8a, 0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00,  //.+%@@@%+......
-  0xc8, 0xbc, 0x84, 0x4c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%%+..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0x00, 0x00,  //.........+@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0xff, 0xff, 0x00, 0x00,  //.........@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xca, 0xa0, 0xff, 0xff, 0x00, 0x00,  //........@%@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xf2, 0x18, 0xff, 0xff, 0x00, 0x00,  //.......+@.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf6, 0x78, 0x00, 0xff, 0xff, 0x00, 0x00,  //.......@+.@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xdc, 0x06, 0x00, 0xff, 0xff, 0x00, 0x00,  //......@@..@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0x50, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....+@+..@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbc, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //.....@%...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //.....@@@@@@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,  //..........@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..............
-
+  0xd6, 0x00, 0x07, 0x30, 0x96, 0xe0, 0xf8, 0xe6, 0xc0, 0x6a, 0x04, 0xfb, 0x00, 0x07, 0xc8, 0x5e,
+  0x16, 0x06, 0x26, 0x9c, 0xff, 0xae, 0xf6, 0x00, 0x02, 0x10, 0xff, 0xf2, 0xf8, 0x00, 0x04, 0x06,
+  0x28, 0x9e, 0xff, 0x86, 0xf9, 0x00, 0xfe, 0xff, 0x01, 0xf6, 0x64, 0xf7, 0x00, 0x04, 0x0e, 0x44,
+  0xd8, 0xfa, 0x52, 0xf6, 0x00, 0x02, 0x38, 0xff, 0xd6, 0xf6, 0x00, 0x02, 0x0a, 0xff, 0xf6, 0xf6,
+  0x00, 0x02, 0x40, 0xff, 0xce, 0xfb, 0x00, 0x07, 0xbc, 0x4e, 0x14, 0x10, 0x4e, 0xe2, 0xf8, 0x46,
+  0xfb, 0x00, 0x0c, 0x3c, 0xb2, 0xf0, 0xf8, 0xe0, 0xa4, 0x30, 0x00, 0x14, 0x4c, 0x84, 0xbc, 0xc6,
+  0xfd, 0x00, 0x13, 0x04, 0x34, 0x6c, 0xa4, 0xdc, 0xf4, 0xc4, 0x8c, 0x54, 0x1a, 0x1a, 0x52, 0x8a,
+  0xc2, 0xf6, 0xdc, 0xa4, 0x6c, 0x34, 0x04, 0xfd, 0x00, 0x04, 0xc8, 0xbc, 0x84, 0x4c, 0x14, 0xef,
+  0x00, 0x02, 0x7c, 0xff, 0xff, 0xf7, 0x00, 0x03, 0x2a, 0xf6, 0xff, 0xff, 0xf8, 0x00, 0x04, 0x02,
+  0xca, 0xa0, 0xff, 0xff, 0xf8, 0x00, 0x04, 0x76, 0xf2, 0x18, 0xff, 0xff, 0xf9, 0x00, 0x05, 0x28,
+  0xf6, 0x78, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x06, 0x02, 0xc6, 0xdc, 0x06, 0x00, 0xff, 0xff, 0xfa,
+  0x00, 0x06, 0x72, 0xff, 0x50, 0x00, 0x00, 0xff, 0xff, 0xfa, 0x00, 0x01, 0xf4, 0xbc, 0xfe, 0x00,
+  0x01, 0xff, 0xff, 0xfa, 0x00, 0xf9, 0xff, 0xf6, 0x00, 0x01, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xff,
+  0xff, 0xe3, 0x00,
 
   /*Unicode: U+00bf (¿) , Width: 10 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,  //....@@@...
-  0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00,  //...%@@%...
-  0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //..+@@@+...
-  0x00, 0x74, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00,  //.+@@@%....
-  0x50, 0xff, 0xff, 0xff, 0xc6, 0x08, 0x00, 0x00, 0x00, 0x00,  //+@@@@.....
-  0xce, 0xff, 0xff, 0xd8, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@......
-  0xf8, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.......
-  0xe0, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x9a,  //@@@......%
-  0x8c, 0xff, 0xff, 0x92, 0x0e, 0x00, 0x16, 0x62, 0xde, 0xff,  //%@@%...+@@
-  0x0c, 0xca, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xf2, 0x5e,  //.@@@@@@@@+
-  0x00, 0x06, 0x76, 0xce, 0xf4, 0xf4, 0xd2, 0x86, 0x16, 0x00,  //..+@@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........
-
+  0xcb, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xe6, 0x00, 0x02, 0xf6,
+  0xff, 0xff, 0xfa, 0x00, 0x02, 0xf8, 0xff, 0xff, 0xfb, 0x00, 0x03, 0x04, 0xff, 0xff, 0xf4, 0xfb,
+  0x00, 0x03, 0x2e, 0xff, 0xff, 0xe0, 0xfb, 0x00, 0x03, 0xa0, 0xff, 0xff, 0xac, 0xfc, 0x00, 0x00,
+  0x6e, 0xfe, 0xff, 0x00, 0x50, 0xfd, 0x00, 0x00, 0x74, 0xfe, 0xff, 0x00, 0xb2, 0xfd, 0x00, 0x00,
+  0x50, 0xfe, 0xff, 0x01, 0xc6, 0x08, 0xfd, 0x00, 0x04, 0xce, 0xff, 0xff, 0xd8, 0x12, 0xfc, 0x00,
+  0x03, 0xf8, 0xff, 0xff, 0x30, 0xfb, 0x00, 0x03, 0xe0, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x1e, 0x08,
+  0x9a, 0x8c, 0xff, 0xff, 0x92, 0x0e, 0x00, 0x16, 0x62, 0xde, 0xff, 0x0c, 0xca, 0xff, 0xff, 0xfc,
+  0xfc, 0xff, 0xff, 0xf2, 0x5e, 0x00, 0x06, 0x76, 0xce, 0xf4, 0xf4, 0xd2, 0x86, 0x16, 0xc4, 0x00,
 
   /*Unicode: U+00c0 (À) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfd, 0x00, 0x03, 0x80, 0xff, 0xcc, 0x0a, 0xf5, 0x00, 0x02, 0x80, 0xff, 0xb0, 0xf4, 0x00, 0x02,
+  0x82, 0xff, 0x90, 0xd8, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0x00, 0x3a, 0xf7, 0x00, 0x00, 0x8a, 0xfe,
+  0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x2a, 0xfc,
+  0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0x00, 0x78, 0xf9, 0x00, 0x06, 0xca, 0xff,
+  0xff, 0xb0, 0xff, 0xff, 0xc8, 0xfa, 0x00, 0x08, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc,
+  0x1a, 0xfb, 0x00, 0x08, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0xfb, 0x00, 0x08,
+  0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0xfc, 0x00, 0x0a, 0x0e, 0xf8, 0xff, 0xfc,
+  0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0xfd, 0x00, 0x03, 0x58, 0xff, 0xff, 0xca, 0xfe, 0x00,
+  0x03, 0xca, 0xff, 0xff, 0x58, 0xfd, 0x00, 0x03, 0xa8, 0xff, 0xff, 0x7a, 0xfe, 0x00, 0x03, 0x7a,
+  0xff, 0xff, 0xa8, 0xfe, 0x00, 0x01, 0x06, 0xf0, 0xf8, 0xff, 0x04, 0xf0, 0x04, 0x00, 0x00, 0x48,
+  0xf6, 0xff, 0x06, 0x48, 0x00, 0x00, 0x98, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x09, 0x8a, 0xff, 0xff,
+  0x96, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x3a, 0xfc, 0x00, 0x08, 0x3a, 0xff, 0xff, 0xe4, 0x00, 0x38,
+  0xff, 0xff, 0xe8, 0xfa, 0x00, 0x07, 0xe8, 0xff, 0xff, 0x36, 0x88, 0xff, 0xff, 0x9a, 0xfa, 0x00,
+  0x07, 0x9a, 0xff, 0xff, 0x86, 0xd6, 0xff, 0xff, 0x4a, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd6,
+  0xa7, 0x00,
 
   /*Unicode: U+00c1 (Á) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfb, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xf6, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xf6, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xd7, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0x00, 0x3a, 0xf7, 0x00, 0x00, 0x8a, 0xfe,
+  0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x2a, 0xfc,
+  0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0x00, 0x78, 0xf9, 0x00, 0x06, 0xca, 0xff,
+  0xff, 0xb0, 0xff, 0xff, 0xc8, 0xfa, 0x00, 0x08, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc,
+  0x1a, 0xfb, 0x00, 0x08, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0xfb, 0x00, 0x08,
+  0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0xfc, 0x00, 0x0a, 0x0e, 0xf8, 0xff, 0xfc,
+  0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0xfd, 0x00, 0x03, 0x58, 0xff, 0xff, 0xca, 0xfe, 0x00,
+  0x03, 0xca, 0xff, 0xff, 0x58, 0xfd, 0x00, 0x03, 0xa8, 0xff, 0xff, 0x7a, 0xfe, 0x00, 0x03, 0x7a,
+  0xff, 0xff, 0xa8, 0xfe, 0x00, 0x01, 0x06, 0xf0, 0xf8, 0xff, 0x04, 0xf0, 0x04, 0x00, 0x00, 0x48,
+  0xf6, 0xff, 0x06, 0x48, 0x00, 0x00, 0x98, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x09, 0x8a, 0xff, 0xff,
+  0x96, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x3a, 0xfc, 0x00, 0x08, 0x3a, 0xff, 0xff, 0xe4, 0x00, 0x38,
+  0xff, 0xff, 0xe8, 0xfa, 0x00, 0x07, 0xe8, 0xff, 0xff, 0x36, 0x88, 0xff, 0xff, 0x9a, 0xfa, 0x00,
+  0x07, 0x9a, 0xff, 0xff, 0x86, 0xd6, 0xff, 0xff, 0x4a, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd6,
+  0xa7, 0x00,
 
   /*Unicode: U+00c2 (Â) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xe2, 0xff, 0xe2, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xc2, 0xe4, 0x42, 0xe2, 0xc2, 0x04, 0x00, 0x00, 0x00, 0x00,  //.....@@+@@.....
-  0x00, 0x00, 0x00, 0x00, 0x98, 0xea, 0x28, 0x00, 0x26, 0xe8, 0x96, 0x00, 0x00, 0x00, 0x00,  //....%@...@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfc, 0x00, 0x04, 0x16, 0xe2, 0xff, 0xe2, 0x16, 0xf8, 0x00, 0x06, 0x04, 0xc2, 0xe4, 0x42, 0xe2,
+  0xc2, 0x04, 0xf9, 0x00, 0x06, 0x98, 0xea, 0x28, 0x00, 0x26, 0xe8, 0x96, 0xda, 0x00, 0x00, 0x3a,
+  0xfe, 0xff, 0x00, 0x3a, 0xf7, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0xda,
+  0xfe, 0xff, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x7a,
+  0xfc, 0xff, 0x00, 0x78, 0xf9, 0x00, 0x06, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0xfa, 0x00,
+  0x08, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0xfb, 0x00, 0x08, 0x6a, 0xff, 0xff,
+  0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0xfb, 0x00, 0x08, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff,
+  0xff, 0xb8, 0xfc, 0x00, 0x0a, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e,
+  0xfd, 0x00, 0x03, 0x58, 0xff, 0xff, 0xca, 0xfe, 0x00, 0x03, 0xca, 0xff, 0xff, 0x58, 0xfd, 0x00,
+  0x03, 0xa8, 0xff, 0xff, 0x7a, 0xfe, 0x00, 0x03, 0x7a, 0xff, 0xff, 0xa8, 0xfe, 0x00, 0x01, 0x06,
+  0xf0, 0xf8, 0xff, 0x04, 0xf0, 0x04, 0x00, 0x00, 0x48, 0xf6, 0xff, 0x06, 0x48, 0x00, 0x00, 0x98,
+  0xff, 0xff, 0x8a, 0xfc, 0x00, 0x09, 0x8a, 0xff, 0xff, 0x96, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x3a,
+  0xfc, 0x00, 0x08, 0x3a, 0xff, 0xff, 0xe4, 0x00, 0x38, 0xff, 0xff, 0xe8, 0xfa, 0x00, 0x07, 0xe8,
+  0xff, 0xff, 0x36, 0x88, 0xff, 0xff, 0x9a, 0xfa, 0x00, 0x07, 0x9a, 0xff, 0xff, 0x86, 0xd6, 0xff,
+  0xff, 0x4a, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd6, 0xa7, 0x00,
 
   /*Unicode: U+00c3 (Ã) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xdc, 0xec, 0x8c, 0x14, 0xdc, 0xee, 0x00, 0x00, 0x00, 0x00,  //.....@@%.@@....
-  0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x00, 0x00, 0xf0, 0xdc, 0x16, 0x8e, 0xec, 0xda, 0x2a, 0x00, 0x00, 0x00, 0x00,  //....@@.%@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfd, 0x00, 0x06, 0x2e, 0xdc, 0xec, 0x8c, 0x14, 0xdc, 0xee, 0xf9, 0x00, 0x00, 0xbc, 0xfc, 0xff,
+  0x00, 0xb4, 0xf9, 0x00, 0x06, 0xf0, 0xdc, 0x16, 0x8e, 0xec, 0xda, 0x2a, 0xda, 0x00, 0x00, 0x3a,
+  0xfe, 0xff, 0x00, 0x3a, 0xf7, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0xda,
+  0xfe, 0xff, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x7a,
+  0xfc, 0xff, 0x00, 0x78, 0xf9, 0x00, 0x06, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0xfa, 0x00,
+  0x08, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0xfb, 0x00, 0x08, 0x6a, 0xff, 0xff,
+  0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0xfb, 0x00, 0x08, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff,
+  0xff, 0xb8, 0xfc, 0x00, 0x0a, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e,
+  0xfd, 0x00, 0x03, 0x58, 0xff, 0xff, 0xca, 0xfe, 0x00, 0x03, 0xca, 0xff, 0xff, 0x58, 0xfd, 0x00,
+  0x03, 0xa8, 0xff, 0xff, 0x7a, 0xfe, 0x00, 0x03, 0x7a, 0xff, 0xff, 0xa8, 0xfe, 0x00, 0x01, 0x06,
+  0xf0, 0xf8, 0xff, 0x04, 0xf0, 0x04, 0x00, 0x00, 0x48, 0xf6, 0xff, 0x06, 0x48, 0x00, 0x00, 0x98,
+  0xff, 0xff, 0x8a, 0xfc, 0x00, 0x09, 0x8a, 0xff, 0xff, 0x96, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x3a,
+  0xfc, 0x00, 0x08, 0x3a, 0xff, 0xff, 0xe4, 0x00, 0x38, 0xff, 0xff, 0xe8, 0xfa, 0x00, 0x07, 0xe8,
+  0xff, 0xff, 0x36, 0x88, 0xff, 0xff, 0x9a, 0xfa, 0x00, 0x07, 0x9a, 0xff, 0xff, 0x86, 0xd6, 0xff,
+  0xff, 0x4a, 0xfa, 0x00, 0x03, 0x4a, 0xff, 0xff, 0xd6, 0xa7, 0x00,
 
   /*Unicode: U+00c4 (Ä) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x1a, 0xfc, 0xff, 0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //...+@@%.%@@+...
-  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00,  //...%@@+.+@@%...
-  0x00, 0x00, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x58, 0xff, 0xff, 0xca, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x58, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0xa8, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xa8, 0x00, 0x00,  //..%@@+...+@@%..
-  0x00, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x04, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x00,  //.+@@@@@@@@@@@+.
-  0x00, 0x98, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x96, 0x00,  //.%@@%.....%@@%.
-  0x00, 0xe6, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xe4, 0x00,  //.@@@.......@@@.
-  0x38, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x36,  //.@@@.......@@@.
-  0x88, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x86,  //%@@%.......%@@%
-  0xd6, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xd6,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfd, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff,
+  0xf9, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xda, 0x00, 0x00, 0x3a, 0xfe, 0xff, 0x00, 0x3a,
+  0xf7, 0x00, 0x00, 0x8a, 0xfe, 0xff, 0x00, 0x8a, 0xf7, 0x00, 0x00, 0xda, 0xfe, 0xff, 0x00, 0xd8,
+  0xf8, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0x00, 0x78,
+  0xf9, 0x00, 0x06, 0xca, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xc8, 0xfa, 0x00, 0x08, 0x1a, 0xfc, 0xff,
+  0xf8, 0x1e, 0xf8, 0xff, 0xfc, 0x1a, 0xfb, 0x00, 0x08, 0x6a, 0xff, 0xff, 0xb8, 0x00, 0xba, 0xff,
+  0xff, 0x68, 0xfb, 0x00, 0x08, 0xba, 0xff, 0xff, 0x68, 0x00, 0x6a, 0xff, 0xff, 0xb8, 0xfc, 0x00,
+  0x0a, 0x0e, 0xf8, 0xff, 0xfc, 0x1a, 0x00, 0x1a, 0xff, 0xff, 0xf8, 0x0e, 0xfd, 0x00, 0x03, 0x58,
+  0xff, 0xff, 0xca, 0xfe, 0x00, 0x03, 0xca, 0xff, 0xff, 0x58, 0xfd, 0x00, 0x03, 0xa8, 0xff, 0xff,
+  0x7a, 0xfe, 0x00, 0x03, 0x7a, 0xff, 0xff, 0xa8, 0xfe, 0x00, 0x01, 0x06, 0xf0, 0xf8, 0xff, 0x04,
+  0xf0, 0x04, 0x00, 0x00, 0x48, 0xf6, 0xff, 0x06, 0x48, 0x00, 0x00, 0x98, 0xff, 0xff, 0x8a, 0xfc,
+  0x00, 0x09, 0x8a, 0xff, 0xff, 0x96, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x3a, 0xfc, 0x00, 0x08, 0x3a,
+  0xff, 0xff, 0xe4, 0x00, 0x38, 0xff, 0xff, 0xe8, 0xfa, 0x00, 0x07, 0xe8, 0xff, 0xff, 0x36, 0x88,
+  0xff, 0xff, 0x9a, 0xfa, 0x00, 0x07, 0x9a, 0xff, 0xff, 0x86, 0xd6, 0xff, 0xff, 0x4a, 0xfa, 0x00,
+  0x03, 0x4a, 0xff, 0xff, 0xd6, 0xa7, 0x00,
 
   /*Unicode: U+00c5 (Å) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xce, 0xf2, 0xce, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x74, 0x0a, 0x76, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00,  //....@@+.+@@....
-  0x00, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x0a, 0x00, 0x0a, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,  //....@@...@@....
-  0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x76, 0x0a, 0x76, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00,  //....%@+.+@%....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xb0, 0xff, 0xff, 0xff, 0xae, 0x0c, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@+....
-  0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00,  //....@@@%@@@....
-  0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xf2, 0x12, 0xf4, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xa8, 0x00, 0xa8, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00,  //...%@@%.%@@+...
-  0x00, 0x00, 0x00, 0xd4, 0xff, 0xff, 0x52, 0x00, 0x54, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00,  //...@@@+.+@@@...
-  0x00, 0x00, 0x2a, 0xff, 0xff, 0xf4, 0x08, 0x00, 0x08, 0xf4, 0xff, 0xff, 0x28, 0x00, 0x00,  //...@@@...@@@...
-  0x00, 0x00, 0x80, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x7e, 0x00, 0x00,  //..%@@%...%@@+..
-  0x00, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x00,  //..@@@@@@@@@@@..
-  0x00, 0x7e, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x7e, 0x00,  //.+@@%.....%@@+.
-  0x00, 0xd4, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xd4, 0x00,  //.@@@+.....+@@@.
-  0x2a, 0xff, 0xff, 0xf2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf2, 0xff, 0xff, 0x28,  //.@@@.......@@@.
-  0x7e, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x7e,  //+@@%.......%@@+
-  0xd4, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0xd4,  //@@@+.......+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfc, 0x00, 0x04, 0x56, 0xce, 0xf2, 0xce, 0x54, 0xf8, 0x00, 0x00, 0x68, 0xfc, 0xff, 0x00, 0x64,
+  0xf9, 0x00, 0x06, 0xe0, 0xff, 0x74, 0x0a, 0x76, 0xff, 0xde, 0xf9, 0x00, 0x06, 0xf2, 0xff, 0x0a,
+  0x00, 0x0a, 0xff, 0xf2, 0xf9, 0x00, 0x06, 0xa6, 0xff, 0x76, 0x0a, 0x76, 0xff, 0xa6, 0xf9, 0x00,
+  0x01, 0x0e, 0xb0, 0xfe, 0xff, 0x01, 0xae, 0x0c, 0xf8, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0x00, 0x2a,
+  0xf7, 0x00, 0x00, 0x80, 0xfe, 0xff, 0x00, 0x7e, 0xf7, 0x00, 0x00, 0xd4, 0xfe, 0xff, 0x00, 0xd4,
+  0xf8, 0x00, 0x00, 0x2a, 0xfc, 0xff, 0x00, 0x2a, 0xf9, 0x00, 0x00, 0x80, 0xfc, 0xff, 0x00, 0x7e,
+  0xf9, 0x00, 0x06, 0xd4, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xd4, 0xfa, 0x00, 0x08, 0x2a, 0xff, 0xff,
+  0xf2, 0x12, 0xf4, 0xff, 0xff, 0x2a, 0xfb, 0x00, 0x08, 0x80, 0xff, 0xff, 0xa8, 0x00, 0xa8, 0xff,
+  0xff, 0x7e, 0xfb, 0x00, 0x08, 0xd4, 0xff, 0xff, 0x52, 0x00, 0x54, 0xff, 0xff, 0xd4, 0xfc, 0x00,
+  0x0a, 0x2a, 0xff, 0xff, 0xf4, 0x08, 0x00, 0x08, 0xf4, 0xff, 0xff, 0x28, 0xfd, 0x00, 0x03, 0x80,
+  0xff, 0xff, 0xa8, 0xfe, 0x00, 0x03, 0xaa, 0xff, 0xff, 0x7e, 0xfd, 0x00, 0x00, 0xd4, 0xf8, 0xff,
+  0x00, 0xd4, 0xfe, 0x00, 0x00, 0x2a, 0xf6, 0xff, 0x06, 0x28, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xa8,
+  0xfc, 0x00, 0x09, 0xa8, 0xff, 0xff, 0x7e, 0x00, 0x00, 0xd4, 0xff, 0xff, 0x52, 0xfc, 0x00, 0x09,
+  0x52, 0xff, 0xff, 0xd4, 0x00, 0x2a, 0xff, 0xff, 0xf2, 0x08, 0xfc, 0x00, 0x08, 0x08, 0xf2, 0xff,
+  0xff, 0x28, 0x7e, 0xff, 0xff, 0xa6, 0xfa, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x7e, 0xd4, 0xff, 0xff,
+  0x50, 0xfa, 0x00, 0x03, 0x52, 0xff, 0xff, 0xd4, 0xa7, 0x00,
 
   /*Unicode: U+00c6 (Æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....%@@%@@@....
-  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@+@@@....
-  0x00, 0x00, 0x00, 0x12, 0xfc, 0xff, 0xfa, 0x0c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@.@@@....
-  0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xc4, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...+@@@.@@@....
-  0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x7e, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...%@@+.@@@....
-  0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x3a, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //...@@@..@@@....
-  0x00, 0x00, 0x26, 0xff, 0xff, 0xf0, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //...@@@..@@@@@@.
-  0x00, 0x00, 0x6a, 0xff, 0xff, 0xae, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..+@@%..@@@@@@.
-  0x00, 0x00, 0xb0, 0xff, 0xff, 0x6a, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..%@@+..@@@....
-  0x00, 0x02, 0xf0, 0xff, 0xff, 0x24, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@@@...@@@....
-  0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //..@@@@@@@@@....
-  0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.%@@@@@@@@@....
-  0x00, 0xc6, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@+...@@@....
-  0x0e, 0xfa, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.@@@....@@@....
-  0x52, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //+@@@....@@@....
-  0x96, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //%@@%....@@@@@@@
-  0xdc, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@.....@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb2, 0x00, 0x01, 0x04, 0xf2, 0xf8, 0xff, 0xfd, 0x00, 0x00, 0x3e, 0xf7, 0xff, 0xfd, 0x00, 0x03,
+  0x84, 0xff, 0xff, 0x94, 0xfe, 0xff, 0xf9, 0x00, 0x03, 0xca, 0xff, 0xff, 0x4e, 0xfe, 0xff, 0xfa,
+  0x00, 0x04, 0x12, 0xfc, 0xff, 0xfa, 0x0c, 0xfe, 0xff, 0xfa, 0x00, 0x04, 0x54, 0xff, 0xff, 0xc4,
+  0x00, 0xfe, 0xff, 0xfa, 0x00, 0x04, 0x9a, 0xff, 0xff, 0x7e, 0x00, 0xfe, 0xff, 0xfa, 0x00, 0x04,
+  0xe0, 0xff, 0xff, 0x3a, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0x05, 0x26, 0xff, 0xff, 0xf0, 0x02, 0x00,
+  0xfb, 0xff, 0xfe, 0x00, 0x05, 0x6a, 0xff, 0xff, 0xae, 0x00, 0x00, 0xfb, 0xff, 0xfe, 0x00, 0x05,
+  0xb0, 0xff, 0xff, 0x6a, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x06, 0x02, 0xf0, 0xff, 0xff, 0x24,
+  0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x00, 0x3c, 0xf8, 0xff, 0xfc, 0x00, 0x00, 0x80, 0xf8, 0xff,
+  0xfc, 0x00, 0x03, 0xc6, 0xff, 0xff, 0x54, 0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x04, 0x0e, 0xfa,
+  0xff, 0xfc, 0x10, 0xfe, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x03, 0x52, 0xff, 0xff, 0xc8, 0xfd, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0x03, 0x96, 0xff, 0xff, 0x82, 0xfd, 0x00, 0xfa, 0xff, 0x03, 0xdc, 0xff,
+  0xff, 0x3c, 0xfd, 0x00, 0xfa, 0xff, 0xa7, 0x00,
 
   /*Unicode: U+00c7 (Ç) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x54, 0xac, 0xe0, 0xf6, 0xf4, 0xd2, 0x94, 0x36,  //....+%@@@@%.
-  0x00, 0x00, 0x14, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x0c, 0xd4, 0xff, 0xff, 0xa4, 0x34, 0x08, 0x12, 0x52, 0xcc, 0xff,  //..@@@%...+@@
-  0x00, 0x96, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c,  //.%@@%......%
-  0x1a, 0xfa, 0xff, 0xde, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x74, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0xb0, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0xde, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xde, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xb2, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+........
-  0x78, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%........
-  0x1c, 0xfc, 0xff, 0xde, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@........
-  0x00, 0x9e, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,  //.%@@%......%
-  0x00, 0x10, 0xda, 0xff, 0xff, 0xa2, 0x32, 0x08, 0x10, 0x50, 0xca, 0xff,  //..@@@%...+@@
-  0x00, 0x00, 0x1a, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //...@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x58, 0xae, 0xe2, 0xf8, 0xf4, 0xd4, 0x96, 0x36,  //....+%@@@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x48, 0x00, 0x00,  //.......%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xbe, 0x00, 0x00,  //........@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xf6, 0x00, 0x00,  //.......+@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00,  //.....@@@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xf0, 0xf2, 0xc2, 0x30, 0x00, 0x00,  //.....%@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc1, 0x00, 0x0b, 0x54, 0xac, 0xe0, 0xf6, 0xf4, 0xd2, 0x94, 0x36, 0x00, 0x00, 0x14, 0xc2, 0xf9,
+  0xff, 0x10, 0x00, 0x0c, 0xd4, 0xff, 0xff, 0xa4, 0x34, 0x08, 0x12, 0x52, 0xcc, 0xff, 0x00, 0x96,
+  0xff, 0xff, 0x86, 0xfc, 0x00, 0x06, 0x02, 0x8c, 0x1a, 0xfa, 0xff, 0xde, 0x04, 0xfa, 0x00, 0x03,
+  0x74, 0xff, 0xff, 0x82, 0xf9, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x42, 0xf9, 0x00, 0x03, 0xde, 0xff,
+  0xff, 0x1a, 0xf9, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xf9, 0x00, 0x02, 0xfa, 0xff, 0xff, 0xf8,
+  0x00, 0x03, 0xf0, 0xff, 0xff, 0x08, 0xf9, 0x00, 0x03, 0xde, 0xff, 0xff, 0x1a, 0xf9, 0x00, 0x03,
+  0xb2, 0xff, 0xff, 0x42, 0xf9, 0x00, 0x03, 0x78, 0xff, 0xff, 0x80, 0xf9, 0x00, 0x04, 0x1c, 0xfc,
+  0xff, 0xde, 0x04, 0xf9, 0x00, 0x03, 0x9e, 0xff, 0xff, 0x84, 0xfb, 0x00, 0x10, 0x8a, 0x00, 0x10,
+  0xda, 0xff, 0xff, 0xa2, 0x32, 0x08, 0x10, 0x50, 0xca, 0xff, 0x00, 0x00, 0x1a, 0xca, 0xf9, 0xff,
+  0xfd, 0x00, 0x07, 0x58, 0xae, 0xe2, 0xf8, 0xf4, 0xd4, 0x96, 0x36, 0xfa, 0x00, 0x02, 0xa6, 0xff,
+  0x48, 0xf8, 0x00, 0x02, 0x1e, 0xff, 0xbe, 0xf8, 0x00, 0x02, 0x40, 0xff, 0xf6, 0xfa, 0x00, 0xfd,
+  0xff, 0x00, 0xd2, 0xfa, 0x00, 0x04, 0xbe, 0xf0, 0xf2, 0xc2, 0x30, 0xf3, 0x00,
 
   /*Unicode: U+00c8 (È) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00,  //....%@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x90, 0x00, 0x00, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfd, 0x00, 0x03, 0x80, 0xff, 0xcc, 0x0a, 0xf8, 0x00, 0x02, 0x80, 0xff, 0xb0, 0xf7, 0x00, 0x02,
+  0x82, 0xff, 0x90, 0xe6, 0x00, 0xe6, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00,
+  0x00, 0xf6, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xe9, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00c9 (É) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00,  //.......@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xf9, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xf9, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xe5, 0x00, 0xe6, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00,
+  0x00, 0xf6, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xe9, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00ca (Ê) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xac, 0xff, 0xff, 0xac, 0x02, 0x00, 0x00,  //.....%@@%...
-  0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x76, 0x74, 0xff, 0x9a, 0x00, 0x00,  //....%@++@%..
-  0x00, 0x00, 0x00, 0x88, 0xfc, 0x62, 0x00, 0x00, 0x60, 0xfa, 0x88, 0x00,  //...%@+..+@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfd, 0x00, 0x05, 0x02, 0xac, 0xff, 0xff, 0xac, 0x02, 0xfb, 0x00, 0x05, 0x9a, 0xff, 0x76, 0x74,
+  0xff, 0x9a, 0xfc, 0x00, 0x07, 0x88, 0xfc, 0x62, 0x00, 0x00, 0x60, 0xfa, 0x88, 0xe8, 0x00, 0xe6,
+  0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe,
+  0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xfe,
+  0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe,
+  0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xe9, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00cb (Ë) , Width: 12 */
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //...@@@..@@@.
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //...@@@..@@@.
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //...@@@..@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //@@@@@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfe, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xe8, 0x00, 0xe6, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8,
+  0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xe9, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00cc (Ì) , Width: 11 */
-  0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@......
-  0x00, 0x00, 0x00, 0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,  //....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x05, 0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0xf9, 0x00, 0x02, 0x80, 0xff, 0xb0, 0xf8, 0x00, 0x02,
+  0x82, 0xff, 0x90, 0xe7, 0x00, 0xeb, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xfd, 0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00cd (Í) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00, 0x00,  //.....@@+...
-  0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,  //....%@%....
-  0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,  //...%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xfd, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xfa, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xfa, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xe6, 0x00, 0xeb, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9,
+  0x00, 0xfe, 0xff, 0xfd, 0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00ce (Î) , Width: 11 */
-  0x00, 0x00, 0x00, 0x3a, 0xf4, 0xff, 0xf4, 0x3a, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x2c, 0xee, 0xd6, 0x3a, 0xd6, 0xee, 0x2c, 0x00, 0x00,  //...@@.@@...
-  0x00, 0x20, 0xe6, 0xcc, 0x14, 0x00, 0x12, 0xc8, 0xe6, 0x20, 0x00,  //..@@...@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xfe, 0x00, 0x04, 0x3a, 0xf4, 0xff, 0xf4, 0x3a, 0xfc, 0x00, 0x06, 0x2c, 0xee, 0xd6, 0x3a, 0xd6,
+  0xee, 0x2c, 0xfe, 0x00, 0x08, 0x20, 0xe6, 0xcc, 0x14, 0x00, 0x12, 0xc8, 0xe6, 0x20, 0xea, 0x00,
+  0xeb, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00,
+  0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00,
+  0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00,
+  0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xfd, 0x00,
+  0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00cf (Ï) , Width: 11 */
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@.@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@.@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@.@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //....@@@....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x01, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe,
+  0xff, 0xfd, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xe9, 0x00, 0xeb, 0xff, 0xfd, 0x00, 0xfe,
+  0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe,
+  0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe,
+  0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe,
+  0xff, 0xf9, 0x00, 0xfe, 0xff, 0xf9, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xeb, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00d0 (Ð) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe2, 0xb6, 0x6e, 0x0a, 0x00, 0x00, 0x00,  //.@@@@@@%+....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x3e, 0x00, 0x00,  //.@@@@@@@@@...
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x06, 0x26, 0x78, 0xf2, 0xff, 0xf6, 0x32, 0x00,  //.@@@...+@@@..
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xff, 0xce, 0x00,  //.@@@.....@@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0x3a,  //.@@@.....%@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x8c,  //.@@@.....+@@%
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc,  //.@@@......@@%
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xe2,  //.@@@......@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0,  //@@@@@@@...@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@@@@@...@@@
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0,  //.@@@......@@@
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xe2,  //.@@@......@@@
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc,  //.@@@......@@%
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x8c,  //.@@@.....+@@%
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xff, 0x3a,  //.@@@.....%@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xff, 0xcc, 0x00,  //.@@@.....@@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x06, 0x26, 0x7a, 0xf2, 0xff, 0xf4, 0x30, 0x00,  //.@@@...+@@@..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x3c, 0x00, 0x00,  //.@@@@@@@@@...
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe2, 0xb6, 0x6c, 0x0a, 0x00, 0x00, 0x00,  //.@@@@@@%+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xbf, 0x00, 0xfd, 0xff, 0x04, 0xf6, 0xe2, 0xb6, 0x6e, 0x0a, 0xfd, 0x00, 0xf9, 0xff, 0x01, 0xe6,
+  0x3e, 0xfe, 0x00, 0xfe, 0xff, 0x09, 0x00, 0x06, 0x26, 0x78, 0xf2, 0xff, 0xf6, 0x32, 0x00, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0x05, 0x3a, 0xfc, 0xff, 0xce, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04,
+  0xac, 0xff, 0xff, 0x3a, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x5e, 0xff, 0xff, 0x8c, 0x00, 0xfe,
+  0xff, 0xfc, 0x00, 0x04, 0x32, 0xff, 0xff, 0xbc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x14, 0xff,
+  0xff, 0xe2, 0xfa, 0xff, 0x05, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf0, 0xfa, 0xff, 0xfe, 0x00, 0x03,
+  0xff, 0xff, 0xfa, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x08, 0xff, 0xff, 0xf0, 0x00, 0xfe, 0xff,
+  0xfc, 0x00, 0x04, 0x14, 0xff, 0xff, 0xe2, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x32, 0xff, 0xff,
+  0xbc, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0x04, 0x60, 0xff, 0xff, 0x8c, 0x00, 0xfe, 0xff, 0xfc, 0x00,
+  0x04, 0xac, 0xff, 0xff, 0x3a, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0x05, 0x3c, 0xfc, 0xff, 0xcc, 0x00,
+  0x00, 0xfe, 0xff, 0x09, 0x00, 0x06, 0x26, 0x7a, 0xf2, 0xff, 0xf4, 0x30, 0x00, 0x00, 0xf9, 0xff,
+  0x01, 0xe6, 0x3c, 0xfe, 0x00, 0xfd, 0xff, 0x04, 0xf6, 0xe2, 0xb6, 0x6c, 0x0a, 0xb0, 0x00,
 
   /*Unicode: U+00d1 (Ñ) , Width: 12 */
-  0x00, 0x00, 0x22, 0xc8, 0xf4, 0xc2, 0x4e, 0x2a, 0xff, 0xec, 0x00, 0x00,  //...@@@+.@@..
-  0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x00, 0x00,  //..%@@@@@@%..
-  0x00, 0x00, 0xee, 0xff, 0x28, 0x50, 0xc6, 0xf6, 0xc6, 0x1e, 0x00, 0x00,  //..@@.+@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@.....@@@
-  0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@%....@@@
-  0xff, 0xff, 0xff, 0xfa, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@@@....@@@
-  0xff, 0xff, 0xff, 0xba, 0xff, 0x36, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@%@....@@@
-  0xff, 0xff, 0xff, 0x60, 0xff, 0x90, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@+@%...@@@
-  0xff, 0xff, 0xff, 0x0e, 0xf6, 0xe6, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.@@...@@@
-  0xff, 0xff, 0xff, 0x00, 0xac, 0xff, 0x44, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.%@+..@@@
-  0xff, 0xff, 0xff, 0x00, 0x52, 0xff, 0x9e, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.+@%..@@@
-  0xff, 0xff, 0xff, 0x00, 0x06, 0xf0, 0xf0, 0x06, 0x00, 0xff, 0xff, 0xff,  //@@@..@@..@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x9e, 0xff, 0x52, 0x00, 0xff, 0xff, 0xff,  //@@@..%@+.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x46, 0xff, 0xac, 0x00, 0xff, 0xff, 0xff,  //@@@..+@%.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0xe8, 0xf6, 0x0e, 0xff, 0xff, 0xff,  //@@@...@@.@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x92, 0xff, 0x60, 0xff, 0xff, 0xff,  //@@@...%@+@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x38, 0xff, 0xba, 0xff, 0xff, 0xff,  //@@@....@%@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xfc, 0xff, 0xff, 0xff,  //@@@....@@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0xff,  //@@@....%@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x09, 0x00, 0x00, 0x22, 0xc8, 0xf4, 0xc2, 0x4e, 0x2a, 0xff, 0xec, 0xfd, 0x00, 0x00, 0xb2, 0xfb,
+  0xff, 0x00, 0xac, 0xfd, 0x00, 0x07, 0xee, 0xff, 0x28, 0x50, 0xc6, 0xf6, 0xc6, 0x1e, 0xe7, 0x00,
+  0xfe, 0xff, 0x00, 0xce, 0xfc, 0x00, 0xfa, 0xff, 0x00, 0x28, 0xfd, 0x00, 0xfa, 0xff, 0x00, 0x82,
+  0xfd, 0x00, 0xfb, 0xff, 0x01, 0xfa, 0xdc, 0xfd, 0x00, 0xfb, 0xff, 0x02, 0xba, 0xff, 0x36, 0xfe,
+  0x00, 0xfb, 0xff, 0x02, 0x60, 0xff, 0x90, 0xfe, 0x00, 0xfb, 0xff, 0x05, 0x0e, 0xf6, 0xe6, 0x02,
+  0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xac, 0xff, 0x44, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0x52,
+  0xff, 0x9e, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0x06, 0xf0, 0xf0, 0x06, 0x00, 0xfb, 0xff, 0x05,
+  0x00, 0x00, 0x9e, 0xff, 0x52, 0x00, 0xfb, 0xff, 0x05, 0x00, 0x00, 0x46, 0xff, 0xac, 0x00, 0xfb,
+  0xff, 0x05, 0x00, 0x00, 0x02, 0xe8, 0xf6, 0x0e, 0xfb, 0xff, 0xfe, 0x00, 0x02, 0x92, 0xff, 0x60,
+  0xfb, 0xff, 0xfe, 0x00, 0x02, 0x38, 0xff, 0xba, 0xfb, 0xff, 0xfd, 0x00, 0x01, 0xdc, 0xfc, 0xfb,
+  0xff, 0xfd, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xfd, 0x00, 0x00, 0x2a, 0xfa, 0xff, 0xfc, 0x00, 0x00,
+  0xd0, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00d2 (Ò) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00,  //......%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfd, 0x00, 0x03, 0x80, 0xff, 0xcc, 0x0a, 0xf7, 0x00, 0x02, 0x80, 0xff, 0xb0, 0xf6, 0x00, 0x02,
+  0x82, 0xff, 0x90, 0xe0, 0x00, 0x06, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00,
+  0x98, 0xfa, 0xff, 0x00, 0x96, 0xfe, 0x00, 0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2,
+  0xff, 0xff, 0x6e, 0x00, 0x0c, 0xec, 0xff, 0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec,
+  0x0c, 0x58, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e,
+  0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff,
+  0xff, 0xc6, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff,
+  0x04, 0xfc, 0x00, 0x06, 0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff,
+  0xfc, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x10,
+  0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff,
+  0xff, 0xc6, 0x9e, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0x5a, 0xff, 0xff,
+  0x8a, 0xfc, 0x00, 0x08, 0x8c, 0xff, 0xff, 0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10,
+  0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff,
+  0x72, 0xfe, 0x00, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9a, 0xfc, 0x00, 0x06, 0x4e, 0xb2, 0xe8, 0xf8,
+  0xe6, 0xb2, 0x4c, 0xb0, 0x00,
 
   /*Unicode: U+00d3 (Ó) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00, 0x00,  //.......@@+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,  //......%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfb, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xf8, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xf8, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xdf, 0x00, 0x06, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00,
+  0x98, 0xfa, 0xff, 0x00, 0x96, 0xfe, 0x00, 0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2,
+  0xff, 0xff, 0x6e, 0x00, 0x0c, 0xec, 0xff, 0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec,
+  0x0c, 0x58, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e,
+  0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff,
+  0xff, 0xc6, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff,
+  0x04, 0xfc, 0x00, 0x06, 0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff,
+  0xfc, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x10,
+  0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff,
+  0xff, 0xc6, 0x9e, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0x5a, 0xff, 0xff,
+  0x8a, 0xfc, 0x00, 0x08, 0x8c, 0xff, 0xff, 0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10,
+  0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff,
+  0x72, 0xfe, 0x00, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9a, 0xfc, 0x00, 0x06, 0x4e, 0xb2, 0xe8, 0xf8,
+  0xe6, 0xb2, 0x4c, 0xb0, 0x00,
 
   /*Unicode: U+00d4 (Ô) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x16, 0xe2, 0xff, 0xe2, 0x16, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x04, 0xc2, 0xe4, 0x42, 0xe2, 0xc2, 0x04, 0x00, 0x00, 0x00,  //....@@+@@....
-  0x00, 0x00, 0x00, 0x98, 0xea, 0x28, 0x00, 0x26, 0xe8, 0x96, 0x00, 0x00, 0x00,  //...%@...@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfd, 0x00, 0x04, 0x16, 0xe2, 0xff, 0xe2, 0x16, 0xfa, 0x00, 0x06, 0x04, 0xc2, 0xe4, 0x42, 0xe2,
+  0xc2, 0x04, 0xfb, 0x00, 0x06, 0x98, 0xea, 0x28, 0x00, 0x26, 0xe8, 0x96, 0xe1, 0x00, 0x06, 0x4a,
+  0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x96, 0xfe, 0x00,
+  0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00, 0x0c, 0xec, 0xff,
+  0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec, 0x0c, 0x58, 0xff, 0xff, 0x8a, 0xfc, 0x00,
+  0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c,
+  0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8, 0xff, 0xff, 0x10, 0xfc,
+  0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x06, 0x06, 0xff, 0xff,
+  0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00,
+  0x07, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6,
+  0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0x9e, 0xff, 0xff, 0x4e, 0xfc,
+  0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0x5a, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x08, 0x8c, 0xff, 0xff,
+  0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10, 0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x76,
+  0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0xfe, 0x00, 0x00, 0x9e, 0xfa, 0xff,
+  0x00, 0x9a, 0xfc, 0x00, 0x06, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0xb0, 0x00,
 
   /*Unicode: U+00d5 (Õ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x2e, 0xdc, 0xec, 0x8c, 0x14, 0xdc, 0xee, 0x00, 0x00, 0x00,  //....@@%.@@...
-  0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x00, 0x00, 0xf0, 0xdc, 0x16, 0x8e, 0xec, 0xda, 0x2a, 0x00, 0x00, 0x00,  //...@@.%@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfe, 0x00, 0x06, 0x2e, 0xdc, 0xec, 0x8c, 0x14, 0xdc, 0xee, 0xfb, 0x00, 0x00, 0xbc, 0xfc, 0xff,
+  0x00, 0xb4, 0xfb, 0x00, 0x06, 0xf0, 0xdc, 0x16, 0x8e, 0xec, 0xda, 0x2a, 0xe1, 0x00, 0x06, 0x4a,
+  0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0xfc, 0x00, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x96, 0xfe, 0x00,
+  0x10, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00, 0x0c, 0xec, 0xff,
+  0xe6, 0x0e, 0xfe, 0x00, 0x08, 0x10, 0xea, 0xff, 0xec, 0x0c, 0x58, 0xff, 0xff, 0x8a, 0xfc, 0x00,
+  0x07, 0x8e, 0xff, 0xff, 0x56, 0x9c, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c,
+  0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8, 0xff, 0xff, 0x10, 0xfc,
+  0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x06, 0x06, 0xff, 0xff,
+  0xf2, 0xfc, 0xff, 0xff, 0xfa, 0x00, 0x06, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00,
+  0x07, 0x06, 0xff, 0xff, 0xf2, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6,
+  0xc8, 0xff, 0xff, 0x26, 0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0x9e, 0xff, 0xff, 0x4e, 0xfc,
+  0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0x5a, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x08, 0x8c, 0xff, 0xff,
+  0x56, 0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0xfe, 0x00, 0x10, 0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x76,
+  0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0xfe, 0x00, 0x00, 0x9e, 0xfa, 0xff,
+  0x00, 0x9a, 0xfc, 0x00, 0x06, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0xb0, 0x00,
 
   /*Unicode: U+00d6 (Ö) , Width: 13 */
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4, 0xb0, 0x4a, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x70, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00,  //.+@@@...@@@+.
-  0x0c, 0xec, 0xff, 0xe6, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xea, 0xff, 0xec, 0x0c,  //.@@@.....@@@.
-  0x58, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x9c, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@.......@@@
-  0xe8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xc8, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6,  //@@@.......@@@
-  0x9e, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x9c,  //%@@+.....+@@%
-  0x5a, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x56,  //+@@%.....%@@+
-  0x0e, 0xf0, 0xff, 0xe6, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c,  //.@@@.....@@@.
-  0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00,  //.+@@@...@@@+.
-  0x00, 0x00, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x00,  //..%@@@@@@@%..
-  0x00, 0x00, 0x00, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0x00, 0x00, 0x00,  //...+%@@@%+...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xfe, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff,
+  0xfb, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xe1, 0x00, 0x06, 0x4a, 0xb0, 0xe4, 0xf8, 0xe4,
+  0xb0, 0x4a, 0xfc, 0x00, 0x00, 0x98, 0xfa, 0xff, 0x00, 0x96, 0xfe, 0x00, 0x10, 0x70, 0xff, 0xff,
+  0xc0, 0x2e, 0x06, 0x2e, 0xc2, 0xff, 0xff, 0x6e, 0x00, 0x0c, 0xec, 0xff, 0xe6, 0x0e, 0xfe, 0x00,
+  0x08, 0x10, 0xea, 0xff, 0xec, 0x0c, 0x58, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x07, 0x8e, 0xff, 0xff,
+  0x56, 0x9c, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff, 0xff, 0x9c, 0xc8, 0xff, 0xff, 0x26,
+  0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff,
+  0xff, 0xe6, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x06, 0x06, 0xff, 0xff, 0xf2, 0xfc, 0xff, 0xff,
+  0xfa, 0x00, 0x06, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0x04, 0xfc, 0x00, 0x07, 0x06, 0xff, 0xff,
+  0xf2, 0xe8, 0xff, 0xff, 0x10, 0xfc, 0x00, 0x07, 0x10, 0xff, 0xff, 0xe6, 0xc8, 0xff, 0xff, 0x26,
+  0xfc, 0x00, 0x07, 0x28, 0xff, 0xff, 0xc6, 0x9e, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x07, 0x50, 0xff,
+  0xff, 0x9c, 0x5a, 0xff, 0xff, 0x8a, 0xfc, 0x00, 0x08, 0x8c, 0xff, 0xff, 0x56, 0x0e, 0xf0, 0xff,
+  0xe6, 0x0c, 0xfe, 0x00, 0x10, 0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x76, 0xff, 0xff, 0xc0, 0x2e,
+  0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0xfe, 0x00, 0x00, 0x9e, 0xfa, 0xff, 0x00, 0x9a, 0xfc, 0x00,
+  0x06, 0x4e, 0xb2, 0xe8, 0xf8, 0xe6, 0xb2, 0x4c, 0xb0, 0x00,
 
   /*Unicode: U+00d7 (×) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x20, 0xbe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xbe, 0x1e,  //.%........%.
-  0xbe, 0xff, 0xdc, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xdc, 0xff, 0xbe,  //%@@......@@%
-  0x1e, 0xde, 0xff, 0xdc, 0x1c, 0x00, 0x00, 0x1e, 0xdc, 0xff, 0xde, 0x1e,  //.@@@....@@@.
-  0x00, 0x1e, 0xde, 0xff, 0xdc, 0x1e, 0x1e, 0xde, 0xff, 0xde, 0x1e, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x1e, 0xde, 0xff, 0xde, 0xde, 0xff, 0xde, 0x1e, 0x00, 0x00,  //...@@@@@@...
-  0x00, 0x00, 0x00, 0x1e, 0xde, 0xff, 0xff, 0xde, 0x1e, 0x00, 0x00, 0x00,  //....@@@@....
-  0x00, 0x00, 0x00, 0x1e, 0xde, 0xff, 0xff, 0xde, 0x1e, 0x00, 0x00, 0x00,  //....@@@@....
-  0x00, 0x00, 0x20, 0xde, 0xff, 0xde, 0xde, 0xff, 0xde, 0x1e, 0x00, 0x00,  //...@@@@@@...
-  0x00, 0x20, 0xe0, 0xff, 0xde, 0x1e, 0x1e, 0xde, 0xff, 0xde, 0x1e, 0x00,  //..@@@..@@@..
-  0x22, 0xe0, 0xff, 0xde, 0x1e, 0x00, 0x00, 0x20, 0xe0, 0xff, 0xde, 0x1e,  //.@@@....@@@.
-  0xbe, 0xff, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe0, 0xff, 0xb6,  //%@@......@@%
-  0x1c, 0xbe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbc, 0x1a,  //.%........%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x89, 0x00, 0x02, 0x20, 0xbe, 0x1c, 0xfb, 0x00, 0x06, 0x1c, 0xbe, 0x1e, 0xbe, 0xff, 0xdc, 0x1c,
+  0xfd, 0x00, 0x1a, 0x1c, 0xdc, 0xff, 0xbe, 0x1e, 0xde, 0xff, 0xdc, 0x1c, 0x00, 0x00, 0x1e, 0xdc,
+  0xff, 0xde, 0x1e, 0x00, 0x1e, 0xde, 0xff, 0xdc, 0x1e, 0x1e, 0xde, 0xff, 0xde, 0x1e, 0xfe, 0x00,
+  0x07, 0x1e, 0xde, 0xff, 0xde, 0xde, 0xff, 0xde, 0x1e, 0xfc, 0x00, 0x05, 0x1e, 0xde, 0xff, 0xff,
+  0xde, 0x1e, 0xfb, 0x00, 0x05, 0x1e, 0xde, 0xff, 0xff, 0xde, 0x1e, 0xfc, 0x00, 0x07, 0x20, 0xde,
+  0xff, 0xde, 0xde, 0xff, 0xde, 0x1e, 0xfe, 0x00, 0x1a, 0x20, 0xe0, 0xff, 0xde, 0x1e, 0x1e, 0xde,
+  0xff, 0xde, 0x1e, 0x00, 0x22, 0xe0, 0xff, 0xde, 0x1e, 0x00, 0x00, 0x20, 0xe0, 0xff, 0xde, 0x1e,
+  0xbe, 0xff, 0xe0, 0x20, 0xfd, 0x00, 0x06, 0x20, 0xe0, 0xff, 0xb6, 0x1c, 0xbe, 0x20, 0xfb, 0x00,
+  0x02, 0x20, 0xbc, 0x1a, 0xa1, 0x00,
 
   /*Unicode: U+00d8 (Ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x12,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x54, 0xb6, 0xe8, 0xf8, 0xe2, 0xa2, 0x2c, 0x00, 0x1c, 0xe8, 0xcc,  //....+%@@@%...@@
-  0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x60, 0xca, 0xfa, 0x3e,  //...%@@@@@@@+@@.
-  0x00, 0x00, 0x78, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x30, 0xc4, 0xff, 0xff, 0xff, 0x74, 0x00,  //..+@@@...@@@@+.
-  0x00, 0x0e, 0xf0, 0xff, 0xe8, 0x0e, 0x00, 0x00, 0x00, 0x10, 0xf2, 0xff, 0xee, 0x02, 0x00,  //..@@@.....@@@..
-  0x00, 0x5a, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x20, 0xf2, 0xff, 0xff, 0x4a, 0x00,  //.+@@%.....@@@+.
-  0x00, 0x9e, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff, 0x92, 0x00,  //.%@@+....@@@@%.
-  0x00, 0xc8, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x76, 0xff, 0x82, 0xff, 0xff, 0xc2, 0x00,  //.@@@....+@%@@@.
-  0x00, 0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x2c, 0xf8, 0xa8, 0x0c, 0xff, 0xff, 0xe4, 0x00,  //.@@@....@%.@@@.
-  0x00, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x06, 0xd0, 0xe4, 0x10, 0x02, 0xff, 0xff, 0xf4, 0x00,  //.@@@...@@..@@@.
-  0x00, 0xfc, 0xff, 0xff, 0x02, 0x00, 0x88, 0xff, 0x46, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00,  //.@@@..%@+..@@@.
-  0x00, 0xf6, 0xff, 0xff, 0x00, 0x3c, 0xfc, 0x94, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2, 0x00,  //.@@@..@%...@@@.
-  0x00, 0xe8, 0xff, 0xff, 0x10, 0xdc, 0xd8, 0x08, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6, 0x00,  //.@@@.@@....@@@.
-  0x00, 0xcc, 0xff, 0xff, 0xb2, 0xfa, 0x36, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xc6, 0x00,  //.@@@%@.....@@@.
-  0x00, 0xa2, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x9c, 0x00,  //.%@@@%....+@@%.
-  0x00, 0x64, 0xff, 0xff, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x58, 0x00,  //.+@@@.....%@@+.
-  0x00, 0x20, 0xff, 0xff, 0xce, 0x02, 0x00, 0x00, 0x00, 0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00,  //..@@@.....@@@..
-  0x00, 0x88, 0xff, 0xff, 0xff, 0xb6, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00, 0x00,  //.%@@@%...@@@+..
-  0x1e, 0xf6, 0x92, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00,  //.@%%@@@@@@@%...
-  0xa6, 0xbe, 0x02, 0x00, 0x48, 0xb0, 0xe6, 0xf8, 0xe8, 0xb6, 0x52, 0x00, 0x00, 0x00, 0x00,  //%%..+%@@@%+....
-  0x3e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xb8, 0x00, 0x01, 0x30, 0x12, 0xfd, 0x00, 0x0a, 0x54, 0xb6, 0xe8, 0xf8, 0xe2, 0xa2, 0x2c, 0x00,
+  0x1c, 0xe8, 0xcc, 0xfe, 0x00, 0x00, 0xa2, 0xfb, 0xff, 0x0e, 0xfa, 0x60, 0xca, 0xfa, 0x3e, 0x00,
+  0x00, 0x78, 0xff, 0xff, 0xc0, 0x2e, 0x06, 0x30, 0xc4, 0xfe, 0xff, 0x07, 0x74, 0x00, 0x00, 0x0e,
+  0xf0, 0xff, 0xe8, 0x0e, 0xfe, 0x00, 0x0a, 0x10, 0xf2, 0xff, 0xee, 0x02, 0x00, 0x00, 0x5a, 0xff,
+  0xff, 0x90, 0xfd, 0x00, 0x0a, 0x20, 0xf2, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x9e, 0xff, 0xff, 0x54,
+  0xfd, 0x00, 0x00, 0xc2, 0xfe, 0xff, 0x06, 0x92, 0x00, 0x00, 0xc8, 0xff, 0xff, 0x2e, 0xfe, 0x00,
+  0x58, 0x76, 0xff, 0x82, 0xff, 0xff, 0xc2, 0x00, 0x00, 0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x2c,
+  0xf8, 0xa8, 0x0c, 0xff, 0xff, 0xe4, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x08, 0x00, 0x06, 0xd0, 0xe4,
+  0x10, 0x02, 0xff, 0xff, 0xf4, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x02, 0x00, 0x88, 0xff, 0x46, 0x00,
+  0x00, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x00, 0x3c, 0xfc, 0x94, 0x00, 0x00, 0x06,
+  0xff, 0xff, 0xf2, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x10, 0xdc, 0xd8, 0x08, 0x00, 0x00, 0x10, 0xff,
+  0xff, 0xe6, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xb2, 0xfa, 0x36, 0xfe, 0x00, 0x06, 0x28, 0xff, 0xff,
+  0xc6, 0x00, 0x00, 0xa2, 0xfe, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x0a, 0x4e, 0xff, 0xff, 0x9c, 0x00,
+  0x00, 0x64, 0xff, 0xff, 0xcc, 0x04, 0xfd, 0x00, 0x0a, 0x8c, 0xff, 0xff, 0x58, 0x00, 0x00, 0x20,
+  0xff, 0xff, 0xce, 0x02, 0xfe, 0x00, 0x07, 0x0e, 0xe8, 0xff, 0xee, 0x0c, 0x00, 0x00, 0x88, 0xfe,
+  0xff, 0x0d, 0xb6, 0x2e, 0x06, 0x2e, 0xc0, 0xff, 0xff, 0x72, 0x00, 0x00, 0x1e, 0xf6, 0x92, 0x8e,
+  0xfa, 0xff, 0x00, 0x9e, 0xfe, 0x00, 0x0a, 0xa6, 0xbe, 0x02, 0x00, 0x48, 0xb0, 0xe6, 0xf8, 0xe8,
+  0xb6, 0x52, 0xfd, 0x00, 0x01, 0x3e, 0x14, 0xa9, 0x00,
 
   /*Unicode: U+00d9 (Ù) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x00,  //....%@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x90, 0x00, 0x00, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xd6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xd4,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x9c,  //%@@+....+@@%
-  0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30,  //.@@@+..+@@@.
-  0x00, 0x60, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfd, 0x00, 0x03, 0x80, 0xff, 0xcc, 0x0a, 0xf8, 0x00, 0x02, 0x80, 0xff, 0xb0, 0xf7, 0x00, 0x02,
+  0x82, 0xff, 0x90, 0xe6, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0x02, 0xfa, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff,
+  0xfa, 0xee, 0xff, 0xff, 0xfc, 0x00, 0x07, 0x02, 0xff, 0xff, 0xee, 0xd6, 0xff, 0xff, 0x0e, 0xfd,
+  0x00, 0x07, 0x12, 0xff, 0xff, 0xd4, 0xa0, 0xff, 0xff, 0x52, 0xfd, 0x00, 0x12, 0x58, 0xff, 0xff,
+  0x9c, 0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30, 0x00, 0x60, 0xf8,
+  0xfb, 0xff, 0x01, 0xf8, 0x60, 0xfe, 0x00, 0x07, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28,
+  0xb7, 0x00,
 
   /*Unicode: U+00da (Ú) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00,  //.......@@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00,  //......%@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00,  //.....%@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xd6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xd4,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x9c,  //%@@+....+@@%
-  0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30,  //.@@@+..+@@@.
-  0x00, 0x60, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfb, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xf9, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xf9, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xe5, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb,
+  0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0x02, 0xfa, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff,
+  0xfa, 0xee, 0xff, 0xff, 0xfc, 0x00, 0x07, 0x02, 0xff, 0xff, 0xee, 0xd6, 0xff, 0xff, 0x0e, 0xfd,
+  0x00, 0x07, 0x12, 0xff, 0xff, 0xd4, 0xa0, 0xff, 0xff, 0x52, 0xfd, 0x00, 0x12, 0x58, 0xff, 0xff,
+  0x9c, 0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30, 0x00, 0x60, 0xf8,
+  0xfb, 0xff, 0x01, 0xf8, 0x60, 0xfe, 0x00, 0x07, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28,
+  0xb7, 0x00,
 
   /*Unicode: U+00db (Û) , Width: 12 */
-  0x00, 0x00, 0x00, 0x02, 0xac, 0xff, 0xff, 0xac, 0x02, 0x00, 0x00, 0x00,  //....%@@%....
-  0x00, 0x00, 0x00, 0x9a, 0xff, 0x76, 0x74, 0xff, 0x9a, 0x00, 0x00, 0x00,  //...%@++@%...
-  0x00, 0x00, 0x88, 0xfc, 0x62, 0x00, 0x00, 0x60, 0xfa, 0x88, 0x00, 0x00,  //..%@+..+@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xd6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xd4,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x9c,  //%@@+....+@@%
-  0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30,  //.@@@+..+@@@.
-  0x00, 0x60, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xfe, 0x00, 0x05, 0x02, 0xac, 0xff, 0xff, 0xac, 0x02, 0xfb, 0x00, 0x05, 0x9a, 0xff, 0x76, 0x74,
+  0xff, 0x9a, 0xfc, 0x00, 0x07, 0x88, 0xfc, 0x62, 0x00, 0x00, 0x60, 0xfa, 0x88, 0xe7, 0x00, 0xfe,
+  0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb,
+  0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb,
+  0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfe,
+  0xff, 0x02, 0xfa, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xfc, 0x00,
+  0x07, 0x02, 0xff, 0xff, 0xee, 0xd6, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x07, 0x12, 0xff, 0xff, 0xd4,
+  0xa0, 0xff, 0xff, 0x52, 0xfd, 0x00, 0x12, 0x58, 0xff, 0xff, 0x9c, 0x32, 0xfa, 0xff, 0xea, 0x56,
+  0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30, 0x00, 0x60, 0xf8, 0xfb, 0xff, 0x01, 0xf8, 0x60, 0xfe,
+  0x00, 0x07, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0xb7, 0x00,
 
   /*Unicode: U+00dc (Ü) , Width: 12 */
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@......@@@
-  0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xee,  //@@@......@@@
-  0xd6, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xd4,  //@@@......@@@
-  0xa0, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x9c,  //%@@+....+@@%
-  0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c, 0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30,  //.@@@+..+@@@.
-  0x00, 0x60, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x60, 0x00,  //.+@@@@@@@@+.
-  0x00, 0x00, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0x01, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00,
+  0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xe7, 0x00, 0xfe, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff,
+  0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfb, 0xff, 0xfb, 0x00, 0xfe, 0xff,
+  0x02, 0xfa, 0xff, 0xff, 0xfb, 0x00, 0x05, 0xff, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xfc, 0x00, 0x07,
+  0x02, 0xff, 0xff, 0xee, 0xd6, 0xff, 0xff, 0x0e, 0xfd, 0x00, 0x07, 0x12, 0xff, 0xff, 0xd4, 0xa0,
+  0xff, 0xff, 0x52, 0xfd, 0x00, 0x12, 0x58, 0xff, 0xff, 0x9c, 0x32, 0xfa, 0xff, 0xea, 0x56, 0x0c,
+  0x0c, 0x56, 0xec, 0xff, 0xfa, 0x30, 0x00, 0x60, 0xf8, 0xfb, 0xff, 0x01, 0xf8, 0x60, 0xfe, 0x00,
+  0x07, 0x26, 0x96, 0xd8, 0xf6, 0xf6, 0xd8, 0x96, 0x28, 0xb7, 0x00,
 
   /*Unicode: U+00dd (Ý) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcc, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......@@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......%@%......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@%.......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0xb6, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xff, 0xb4,  //%@@%.......%@@%
-  0x28, 0xfa, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xfa, 0x26,  //.@@@+.....+@@@.
-  0x00, 0x90, 0xff, 0xff, 0xda, 0x04, 0x00, 0x00, 0x00, 0x06, 0xdc, 0xff, 0xff, 0x8e, 0x00,  //.%@@@.....@@@%.
-  0x00, 0x10, 0xec, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xea, 0x10, 0x00,  //..@@@+...+@@@..
-  0x00, 0x00, 0x6a, 0xff, 0xff, 0xf0, 0x16, 0x00, 0x16, 0xf0, 0xff, 0xff, 0x6a, 0x00, 0x00,  //..+@@@...@@@+..
-  0x00, 0x00, 0x02, 0xd4, 0xff, 0xff, 0x9a, 0x00, 0x9c, 0xff, 0xff, 0xd2, 0x02, 0x00, 0x00,  //...@@@%.%@@@...
-  0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xfc, 0x62, 0xfc, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00,  //...+@@@+@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00,  //....%@@@@@%....
-  0x00, 0x00, 0x00, 0x00, 0x26, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0x24, 0x00, 0x00, 0x00, 0x00,  //.....@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@@@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......@@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0xfb, 0x00, 0x03, 0x0a, 0xcc, 0xff, 0x7e, 0xf6, 0x00, 0x02, 0xb0, 0xff, 0x80, 0xf6, 0x00, 0x02,
+  0x90, 0xff, 0x82, 0xdc, 0x00, 0x03, 0xb6, 0xff, 0xff, 0xbc, 0xfa, 0x00, 0x08, 0xbc, 0xff, 0xff,
+  0xb4, 0x28, 0xfa, 0xff, 0xff, 0x4e, 0xfc, 0x00, 0x0a, 0x50, 0xff, 0xff, 0xfa, 0x26, 0x00, 0x90,
+  0xff, 0xff, 0xda, 0x04, 0xfe, 0x00, 0x0b, 0x06, 0xdc, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x10, 0xec,
+  0xff, 0xff, 0x74, 0xfe, 0x00, 0x04, 0x76, 0xff, 0xff, 0xea, 0x10, 0xfe, 0x00, 0x0a, 0x6a, 0xff,
+  0xff, 0xf0, 0x16, 0x00, 0x16, 0xf0, 0xff, 0xff, 0x6a, 0xfd, 0x00, 0x0a, 0x02, 0xd4, 0xff, 0xff,
+  0x9a, 0x00, 0x9c, 0xff, 0xff, 0xd2, 0x02, 0xfc, 0x00, 0x08, 0x44, 0xff, 0xff, 0xfc, 0x62, 0xfc,
+  0xff, 0xff, 0x44, 0xfa, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0x00, 0xb2, 0xf9, 0x00, 0x01, 0x26, 0xf8,
+  0xfe, 0xff, 0x01, 0xf8, 0x24, 0xf8, 0x00, 0x00, 0x8c, 0xfe, 0xff, 0x00, 0x8c, 0xf7, 0x00, 0x00,
+  0x0e, 0xfe, 0xff, 0x00, 0x0e, 0xf6, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe,
+  0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe, 0xff, 0xf5, 0x00, 0xfe,
+  0xff, 0xf5, 0x00, 0xfe, 0xff, 0xa1, 0x00,
 
   /*Unicode: U+00de (Þ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xda, 0xa4, 0x42, 0x00, 0x00,  //@@@@@@@@%+..
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00,  //@@@@@@@@@@%.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x22, 0x7a, 0xf6, 0xff, 0xff, 0x52,  //@@@....+@@@+
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xb8,  //@@@.....+@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xff, 0xea,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfa,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xea,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xba,  //@@@.....+@@%
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x02, 0x20, 0x7a, 0xf6, 0xff, 0xff, 0x54,  //@@@....+@@@+
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x00,  //@@@@@@@@@@%.
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdc, 0xa6, 0x44, 0x00, 0x00,  //@@@@@@@@%+..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xc5, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfb, 0xff,
+  0x05, 0xf2, 0xda, 0xa4, 0x42, 0x00, 0x00, 0xf7, 0xff, 0x01, 0x8e, 0x00, 0xfe, 0xff, 0x08, 0x00,
+  0x00, 0x02, 0x22, 0x7a, 0xf6, 0xff, 0xff, 0x52, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x7c, 0xff, 0xff,
+  0xb8, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x22, 0xff, 0xff, 0xea, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x08,
+  0xff, 0xff, 0xfa, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x24, 0xff, 0xff, 0xea, 0xfe, 0xff, 0xfc, 0x00,
+  0x03, 0x7c, 0xff, 0xff, 0xba, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x02, 0x20, 0x7a, 0xf6, 0xff, 0xff,
+  0x54, 0xf7, 0xff, 0x01, 0x94, 0x00, 0xfb, 0xff, 0x05, 0xf4, 0xdc, 0xa6, 0x44, 0x00, 0x00, 0xfe,
+  0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe,
+  0xff, 0xb0, 0x00,
 
   /*Unicode: U+00df (ß) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x0c, 0x82, 0xd2, 0xf4, 0xf6, 0xd2, 0x7a, 0x06, 0x00, 0x00, 0x00,  //..%@@@@+....
-  0x0c, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x02, 0x00, 0x00,  //.@@@@@@@%...
-  0x7e, 0xff, 0xff, 0xc2, 0x1c, 0x1a, 0xbe, 0xff, 0xff, 0x64, 0x00, 0x00,  //+@@@..%@@+..
-  0xce, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc, 0x00, 0x00,  //@@@....@@%..
-  0xf2, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xea, 0x00, 0x00,  //@@@....@@@..
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x78, 0xf6, 0xff, 0xe8, 0x9c, 0x00, 0x00,  //@@@..+@@@%..
-  0xff, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xff, 0xc0, 0x10, 0x00, 0x00, 0x00,  //@@@.+@@@....
-  0xff, 0xff, 0xff, 0x00, 0xca, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xff, 0xff, 0x00, 0xf2, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.@@@.....
-  0xff, 0xff, 0xff, 0x00, 0x50, 0xfa, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00,  //@@@.+@@.....
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x40, 0xd6, 0xfc, 0xa0, 0x1a, 0x00, 0x00,  //@@@..+@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0xe6, 0xff, 0xf0, 0x54, 0x00,  //@@@....@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xd8, 0xff, 0xfc, 0x3e,  //@@@.....@@@.
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xc2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0xea,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x00, 0xb0, 0x3c, 0x0a, 0x2a, 0xc6, 0xff, 0xff, 0xa2,  //@@@.%...@@@%
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x1c,  //@@@.@@@@@@@.
-  0xff, 0xff, 0xff, 0x00, 0x3c, 0xb2, 0xf0, 0xf8, 0xda, 0x90, 0x14, 0x00,  //@@@..%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd0, 0x00, 0x07, 0x0c, 0x82, 0xd2, 0xf4, 0xf6, 0xd2, 0x7a, 0x06, 0xfe, 0x00, 0x01, 0x0c, 0xd2,
+  0xfb, 0xff, 0x27, 0xbc, 0x02, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xc2, 0x1c, 0x1a, 0xbe, 0xff, 0xff,
+  0x64, 0x00, 0x00, 0xce, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x32, 0xff, 0xff, 0xbc, 0x00, 0x00, 0xf2,
+  0xff, 0xff, 0x0e, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xea, 0x00, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x00,
+  0x78, 0xf6, 0xff, 0xe8, 0x9c, 0x00, 0x00, 0xfe, 0xff, 0x05, 0x00, 0x5c, 0xff, 0xff, 0xc0, 0x10,
+  0xfe, 0x00, 0xfe, 0xff, 0x04, 0x00, 0xca, 0xff, 0xff, 0x2e, 0xfd, 0x00, 0xfe, 0xff, 0x04, 0x00,
+  0xf2, 0xff, 0xff, 0x02, 0xfd, 0x00, 0xfe, 0xff, 0x03, 0x00, 0xda, 0xff, 0xff, 0xfc, 0x00, 0xfe,
+  0xff, 0x04, 0x00, 0x50, 0xfa, 0xff, 0x32, 0xfd, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x00, 0x40, 0xd6,
+  0xfc, 0xa0, 0x1a, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0x05, 0x02, 0xe6, 0xff, 0xf0, 0x54, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0x04, 0x1a, 0xd8, 0xff, 0xfc, 0x3e, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x3c,
+  0xff, 0xff, 0xc2, 0xfe, 0xff, 0xfc, 0x00, 0x03, 0x06, 0xff, 0xff, 0xf2, 0xfe, 0xff, 0xfc, 0x00,
+  0x03, 0x28, 0xff, 0xff, 0xea, 0xfe, 0xff, 0x08, 0x00, 0xb0, 0x3c, 0x0a, 0x2a, 0xc6, 0xff, 0xff,
+  0xa2, 0xfe, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0xe4, 0x1c, 0xfe, 0xff, 0x07, 0x00, 0x3c, 0xb2,
+  0xf0, 0xf8, 0xda, 0x90, 0x14, 0xb8, 0x00,
 
   /*Unicode: U+00e0 (à) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@.......
-  0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@%......
-  0x00, 0x00, 0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@......
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xdb, 0x00, 0x03, 0x96, 0xff, 0xce, 0x04, 0xf9, 0x00, 0x03, 0x04, 0xc0, 0xff, 0x88, 0xf8, 0x00,
+  0x03, 0x14, 0xe0, 0xfc, 0x3e, 0xf8, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xf8, 0x00, 0x02, 0x54,
+  0xff, 0xa4, 0xe4, 0x00, 0x08, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00,
+  0xf8, 0xff, 0x0d, 0x9c, 0x02, 0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff,
+  0x6e, 0xf9, 0x00, 0x03, 0x44, 0xff, 0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00,
+  0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xfc, 0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff,
+  0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00,
+  0x00, 0x20, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03,
+  0xea, 0xff, 0xff, 0x2e, 0xfd, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30,
+  0x06, 0x28, 0xae, 0xea, 0xfe, 0xff, 0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff,
+  0x08, 0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e1 (á) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00,  //.......@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x00,  //......%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00, 0x00,  //......@@....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd7, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xf9, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xfa, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xfa, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xf9, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xe3, 0x00, 0x08, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00,
+  0xf8, 0xff, 0x0d, 0x9c, 0x02, 0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff,
+  0x6e, 0xf9, 0x00, 0x03, 0x44, 0xff, 0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00,
+  0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xfc, 0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff,
+  0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00,
+  0x00, 0x20, 0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03,
+  0xea, 0xff, 0xff, 0x2e, 0xfd, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30,
+  0x06, 0x28, 0xae, 0xea, 0xfe, 0xff, 0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff,
+  0x08, 0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e2 (â) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xfc, 0x3a, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02, 0x00, 0x00, 0x00,  //....@@@@....
-  0x00, 0x00, 0x00, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0x00, 0x00, 0x00,  //...+@++@+...
-  0x00, 0x00, 0x1c, 0xf2, 0xc4, 0x00, 0x00, 0xc2, 0xf2, 0x1c, 0x00, 0x00,  //...@@..@@...
-  0x00, 0x00, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0x00, 0x00,  //..%@....@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd9, 0x00, 0x03, 0x3a, 0xfc, 0xfc, 0x3a, 0xfa, 0x00, 0x05, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02,
+  0xfb, 0x00, 0x05, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0xfc, 0x00, 0x07, 0x1c, 0xf2, 0xc4, 0x00,
+  0x00, 0xc2, 0xf2, 0x1c, 0xfd, 0x00, 0x07, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0xe6,
+  0x00, 0x08, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00, 0xf8, 0xff, 0x0d,
+  0x9c, 0x02, 0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e, 0xf9, 0x00,
+  0x03, 0x44, 0xff, 0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00, 0x00, 0x4a, 0xa6,
+  0xda, 0xf2, 0xfc, 0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff, 0xff, 0xe6, 0x5e,
+  0x1a, 0x02, 0x00, 0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x20, 0xfe,
+  0xff, 0x03, 0xf8, 0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03, 0xea, 0xff, 0xff,
+  0x2e, 0xfd, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae,
+  0xea, 0xfe, 0xff, 0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff, 0x08, 0x00, 0x1a,
+  0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e3 (ã) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0x00, 0x00,  //...@@%..@@..
-  0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6a, 0x3e, 0xff, 0xd4, 0x00, 0x00,  //..%@@@+.@@..
-  0x00, 0x00, 0xd6, 0xff, 0x40, 0x68, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00,  //..@@++@@@%..
-  0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0x00, 0x00,  //..@@..%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xcf, 0x00, 0x07, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0xfd, 0x00, 0x00, 0x88, 0xfe,
+  0xff, 0x03, 0x6a, 0x3e, 0xff, 0xd4, 0xfd, 0x00, 0x03, 0xd6, 0xff, 0x40, 0x68, 0xfe, 0xff, 0x00,
+  0x86, 0xfd, 0x00, 0x07, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0xe6, 0x00, 0x08, 0x2a,
+  0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00, 0xf8, 0xff, 0x0d, 0x9c, 0x02, 0x00,
+  0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e, 0xf9, 0x00, 0x03, 0x44, 0xff,
+  0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xfc,
+  0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00,
+  0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x20, 0xfe, 0xff, 0x03, 0xf8,
+  0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03, 0xea, 0xff, 0xff, 0x2e, 0xfd, 0x00,
+  0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xfe, 0xff,
+  0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff, 0x08, 0x00, 0x1a, 0x9a, 0xe4, 0xf8,
+  0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e4 (ä) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xcf, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xda, 0x00, 0x08, 0x2a, 0x7a,
+  0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00, 0xf8, 0xff, 0x0d, 0x9c, 0x02, 0x00, 0xd6,
+  0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e, 0xf9, 0x00, 0x03, 0x44, 0xff, 0xff,
+  0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xfc, 0xff,
+  0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02,
+  0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x20, 0xfe, 0xff, 0x03, 0xf8, 0xff,
+  0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03, 0xea, 0xff, 0xff, 0x2e, 0xfd, 0x00, 0x00,
+  0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xfe, 0xff, 0x01,
+  0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff, 0x08, 0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6,
+  0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e5 (å) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x5a, 0xd6, 0xf8, 0xd6, 0x58, 0x00, 0x00, 0x00, 0x00,  //...+@@@+....
-  0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00,  //..+@@@@@+...
-  0x00, 0x00, 0xd6, 0xff, 0x74, 0x0a, 0x76, 0xff, 0xd6, 0x00, 0x00, 0x00,  //..@@+.+@@...
-  0x00, 0x00, 0xf8, 0xff, 0x0a, 0x00, 0x0a, 0xff, 0xf8, 0x00, 0x00, 0x00,  //..@@...@@...
-  0x00, 0x00, 0xd6, 0xff, 0x72, 0x0a, 0x76, 0xff, 0xd6, 0x00, 0x00, 0x00,  //..@@+.+@@...
-  0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00,  //..+@@@@@+...
-  0x00, 0x00, 0x00, 0x5a, 0xd6, 0xf8, 0xd6, 0x5a, 0x00, 0x00, 0x00, 0x00,  //...+@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0x00, 0x00,  //..+%@@@@%+..
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x02,  //.@@@@@@@@@%.
-  0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e,  //.@%....+@@@+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0xc8,  //........+@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xee,  //.........@@@
-  0x00, 0x00, 0x4a, 0xa6, 0xda, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,  //..+%@@@@@@@@
-  0x04, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.%@@@@@@@@@@
-  0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff,  //+@@@+....@@@
-  0xda, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff,  //@@@+.....@@@
-  0xf8, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff,  //@@@.....+@@@
-  0xea, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff,  //@@@.....@@@@
-  0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea, 0xff, 0xff, 0xff,  //%@@@...%@@@@
-  0x1e, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0xff, 0xff, 0xff,  //.@@@@@@@+@@@
-  0x00, 0x1a, 0x9a, 0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xff, 0xff, 0xff,  //..%@@@%..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xf2, 0x00, 0x04, 0x5a, 0xd6, 0xf8, 0xd6, 0x58, 0xfb, 0x00, 0x00, 0x5a, 0xfc, 0xff, 0x00, 0x58,
+  0xfc, 0x00, 0x06, 0xd6, 0xff, 0x74, 0x0a, 0x76, 0xff, 0xd6, 0xfc, 0x00, 0x06, 0xf8, 0xff, 0x0a,
+  0x00, 0x0a, 0xff, 0xf8, 0xfc, 0x00, 0x06, 0xd6, 0xff, 0x72, 0x0a, 0x76, 0xff, 0xd6, 0xfc, 0x00,
+  0x00, 0x5a, 0xfc, 0xff, 0x00, 0x58, 0xfb, 0x00, 0x04, 0x5a, 0xd6, 0xf8, 0xd6, 0x5a, 0xe4, 0x00,
+  0x08, 0x2a, 0x7a, 0xb8, 0xe4, 0xf8, 0xf2, 0xdc, 0xa2, 0x42, 0xfe, 0x00, 0xf8, 0xff, 0x0d, 0x9c,
+  0x02, 0x00, 0xd6, 0x82, 0x3a, 0x10, 0x04, 0x18, 0x54, 0xe0, 0xff, 0xff, 0x6e, 0xf9, 0x00, 0x03,
+  0x44, 0xff, 0xff, 0xc8, 0xf9, 0x00, 0x09, 0x08, 0xff, 0xff, 0xee, 0x00, 0x00, 0x4a, 0xa6, 0xda,
+  0xf2, 0xfc, 0xff, 0x02, 0xfa, 0x04, 0xac, 0xf7, 0xff, 0x08, 0x7a, 0xff, 0xff, 0xe6, 0x5e, 0x1a,
+  0x02, 0x00, 0x02, 0xfe, 0xff, 0x03, 0xda, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x00, 0x20, 0xfe, 0xff,
+  0x03, 0xf8, 0xff, 0xff, 0x0a, 0xfd, 0x00, 0x00, 0x54, 0xfe, 0xff, 0x03, 0xea, 0xff, 0xff, 0x2e,
+  0xfd, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x08, 0xa2, 0xff, 0xff, 0xca, 0x30, 0x06, 0x28, 0xae, 0xea,
+  0xfe, 0xff, 0x01, 0x1e, 0xe6, 0xfc, 0xff, 0x01, 0xf6, 0x46, 0xfe, 0xff, 0x08, 0x00, 0x1a, 0x9a,
+  0xe4, 0xf8, 0xe6, 0xa8, 0x2e, 0x00, 0xfe, 0xff, 0xb9, 0x00,
 
   /*Unicode: U+00e6 (æ) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x34, 0x92, 0xd6, 0xf6, 0xf0, 0xbe, 0x46, 0x00, 0x72, 0xde, 0xf6, 0xd0, 0x4a, 0x00,  //..%@@@%+.+@@@+.
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x28,  //.@@@@@@@%@@@@@.
-  0x00, 0xc8, 0x5e, 0x18, 0x08, 0x40, 0xde, 0xff, 0xff, 0xff, 0x6c, 0x6c, 0xff, 0xff, 0x8c,  //.@+..+@@@@++@@%
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0x1a, 0x1c, 0xff, 0xff, 0xc4,  //......+@@@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x04, 0x08, 0xff, 0xff, 0xe2,  //.......@@@..@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf4,  //.......@@@..@@@
-  0x00, 0x0e, 0x7a, 0xc6, 0xec, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //..+@@@@@@@@@@@@
-  0x1e, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.@@@@@@@@@@@@@@
-  0xac, 0xff, 0xff, 0xb2, 0x2e, 0x08, 0x00, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@%...@@@.....
-  0xf0, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00,  //@@@....@@@.....
-  0xf6, 0xff, 0xff, 0x10, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00,  //@@@....@@@.....
-  0xc4, 0xff, 0xff, 0x9a, 0x12, 0x14, 0xa6, 0xff, 0xff, 0xff, 0xc0, 0x24, 0x04, 0x2c, 0xa2,  //@@@%..%@@@@...%
-  0x44, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x52, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,  //+@@@@@@@+@@@@@@
-  0x00, 0x38, 0xae, 0xe8, 0xfa, 0xe8, 0xa6, 0x22, 0x00, 0x40, 0xc0, 0xf2, 0xf2, 0xbc, 0x42,  //..%@@@%..+@@@%+
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x81, 0x00, 0xea, 0x00, 0x0e, 0x34, 0x92, 0xd6, 0xf6, 0xf0, 0xbe, 0x46, 0x00, 0x72, 0xde, 0xf6,
+  0xd0, 0x4a, 0x00, 0x00, 0xfb, 0xff, 0x01, 0xfc, 0xa6, 0xfd, 0xff, 0x08, 0xf8, 0x28, 0x00, 0xc8,
+  0x5e, 0x18, 0x08, 0x40, 0xde, 0xfe, 0xff, 0x04, 0x6c, 0x6c, 0xff, 0xff, 0x8c, 0xfb, 0x00, 0x00,
+  0x4a, 0xfe, 0xff, 0x04, 0x1a, 0x1c, 0xff, 0xff, 0xc4, 0xfb, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0x04,
+  0x04, 0x08, 0xff, 0xff, 0xe2, 0xfa, 0x00, 0xfe, 0xff, 0x0a, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00,
+  0x0e, 0x7a, 0xc6, 0xec, 0xfa, 0xf9, 0xff, 0x02, 0xfc, 0x1e, 0xe0, 0xf4, 0xff, 0x09, 0xac, 0xff,
+  0xff, 0xb2, 0x2e, 0x08, 0x00, 0xff, 0xff, 0xf8, 0xfc, 0x00, 0x06, 0xf0, 0xff, 0xff, 0x1a, 0x00,
+  0x00, 0x06, 0xfe, 0xff, 0x00, 0x06, 0xfd, 0x00, 0x06, 0xf6, 0xff, 0xff, 0x10, 0x00, 0x00, 0x26,
+  0xfe, 0xff, 0x00, 0x32, 0xfd, 0x00, 0x06, 0xc4, 0xff, 0xff, 0x9a, 0x12, 0x14, 0xa6, 0xfe, 0xff,
+  0x06, 0xc0, 0x24, 0x04, 0x2c, 0xa2, 0x44, 0xfa, 0xfc, 0xff, 0x02, 0xee, 0x52, 0xfa, 0xfc, 0xff,
+  0x0e, 0x00, 0x38, 0xae, 0xe8, 0xfa, 0xe8, 0xa6, 0x22, 0x00, 0x40, 0xc0, 0xf2, 0xf2, 0xbc, 0x42,
+  0xa7, 0x00,
 
   /*Unicode: U+00e7 (ç) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x3e, 0xa2, 0xdc, 0xf4, 0xee, 0xb2, 0x36, 0x00,  //....%@@@%..
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x70,  //..%@@@@@@@+
-  0x00, 0xa4, 0xff, 0xff, 0xdc, 0x56, 0x12, 0x06, 0x30, 0xa6, 0xff,  //.%@@@+...%@
-  0x40, 0xff, 0xff, 0xe4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a,  //+@@@......+
-  0xa2, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0xde, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xf6, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xf6, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xde, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@........
-  0xa2, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@+.......
-  0x40, 0xff, 0xff, 0xe4, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,  //+@@@......+
-  0x00, 0xa6, 0xff, 0xff, 0xda, 0x54, 0x10, 0x06, 0x2e, 0xa0, 0xff,  //.%@@@+...%@
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x74,  //..%@@@@@@@+
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf0, 0xb4, 0x38, 0x00,  //...+%@@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x48, 0x00, 0x00,  //......%@+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xbe, 0x00, 0x00,  //.......@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xf6, 0x00, 0x00,  //......+@@..
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00,  //....@@@@@..
-  0x00, 0x00, 0x00, 0x00, 0xbe, 0xf0, 0xf2, 0xc2, 0x30, 0x00, 0x00,  //....%@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0x90, 0x00, 0x0a, 0x3e, 0xa2, 0xdc, 0xf4, 0xee, 0xb2, 0x36, 0x00, 0x00, 0x08, 0xa4, 0xfb, 0xff,
+  0x11, 0xfc, 0x70, 0x00, 0xa4, 0xff, 0xff, 0xdc, 0x56, 0x12, 0x06, 0x30, 0xa6, 0xff, 0x40, 0xff,
+  0xff, 0xe4, 0x14, 0xfc, 0x00, 0x04, 0x7a, 0xa2, 0xff, 0xff, 0x6c, 0xfa, 0x00, 0x03, 0xde, 0xff,
+  0xff, 0x24, 0xfa, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x06, 0xfa, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x06,
+  0xfa, 0x00, 0x03, 0xde, 0xff, 0xff, 0x24, 0xfa, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x6c, 0xfa, 0x00,
+  0x04, 0x40, 0xff, 0xff, 0xe4, 0x14, 0xfc, 0x00, 0x0e, 0x74, 0x00, 0xa6, 0xff, 0xff, 0xda, 0x54,
+  0x10, 0x06, 0x2e, 0xa0, 0xff, 0x00, 0x08, 0xa4, 0xfb, 0xff, 0x01, 0xfc, 0x74, 0xfe, 0x00, 0x06,
+  0x40, 0xa2, 0xdc, 0xf4, 0xf0, 0xb4, 0x38, 0xfa, 0x00, 0x02, 0xa6, 0xff, 0x48, 0xf9, 0x00, 0x02,
+  0x1e, 0xff, 0xbe, 0xf9, 0x00, 0x02, 0x40, 0xff, 0xf6, 0xfb, 0x00, 0xfd, 0xff, 0x00, 0xd2, 0xfb,
+  0x00, 0x04, 0xbe, 0xf0, 0xf2, 0xc2, 0x30, 0xf4, 0x00,
 
   /*Unicode: U+00e8 (è) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@........
-  0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@%.......
-  0x00, 0x00, 0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@.......
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x02, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x24, 0x00,  //..%@@@@@@@@..
-  0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06,  //.%@@@...%@@@.
-  0x36, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x62,  //.@@@.....%@@+
-  0x9e, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xb6,  //%@@+......@@%
-  0xdc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xde, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xa2, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x40, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00,  //.%@@%+...+%@.
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd8, 0x00, 0x03, 0x96, 0xff, 0xce, 0x04, 0xf8, 0x00, 0x03, 0x04, 0xc0, 0xff, 0x88, 0xf7, 0x00,
+  0x03, 0x14, 0xe0, 0xfc, 0x3e, 0xf7, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xf7, 0x00, 0x02, 0x54,
+  0xff, 0xa4, 0xdf, 0x00, 0x07, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0xfe, 0x00, 0x01,
+  0x02, 0x94, 0xfa, 0xff, 0x14, 0xde, 0x24, 0x00, 0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18,
+  0x84, 0xff, 0xff, 0xd2, 0x06, 0x36, 0xff, 0xff, 0xdc, 0x08, 0xfd, 0x00, 0x07, 0xa4, 0xff, 0xff,
+  0x62, 0x9e, 0xff, 0xff, 0x5c, 0xfc, 0x00, 0x07, 0x3a, 0xff, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0x1c,
+  0xfc, 0x00, 0x08, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfe, 0xff,
+  0x01, 0xf8, 0xf6, 0xf5, 0xff, 0x02, 0xde, 0xff, 0xea, 0xf7, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x1e,
+  0xf8, 0x00, 0x03, 0x40, 0xff, 0xff, 0xa6, 0xf7, 0x00, 0x0e, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c,
+  0x02, 0x14, 0x40, 0x80, 0xd2, 0x00, 0x00, 0x08, 0xa4, 0xf8, 0xff, 0xfd, 0x00, 0x08, 0x40, 0xa2,
+  0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0xb2, 0x00,
 
   /*Unicode: U+00e9 (é) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00, 0x00,  //.......@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x00, 0x00,  //......%@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x02, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x24, 0x00,  //..%@@@@@@@@..
-  0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06,  //.%@@@...%@@@.
-  0x36, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x62,  //.@@@.....%@@+
-  0x9e, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xb6,  //%@@+......@@%
-  0xdc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xde, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xa2, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x40, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00,  //.%@@%+...+%@.
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd4, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xf8, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xf9, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xf9, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xf8, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xde, 0x00, 0x07, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0xfe, 0x00, 0x01,
+  0x02, 0x94, 0xfa, 0xff, 0x14, 0xde, 0x24, 0x00, 0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18,
+  0x84, 0xff, 0xff, 0xd2, 0x06, 0x36, 0xff, 0xff, 0xdc, 0x08, 0xfd, 0x00, 0x07, 0xa4, 0xff, 0xff,
+  0x62, 0x9e, 0xff, 0xff, 0x5c, 0xfc, 0x00, 0x07, 0x3a, 0xff, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0x1c,
+  0xfc, 0x00, 0x08, 0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfe, 0xff,
+  0x01, 0xf8, 0xf6, 0xf5, 0xff, 0x02, 0xde, 0xff, 0xea, 0xf7, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x1e,
+  0xf8, 0x00, 0x03, 0x40, 0xff, 0xff, 0xa6, 0xf7, 0x00, 0x0e, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c,
+  0x02, 0x14, 0x40, 0x80, 0xd2, 0x00, 0x00, 0x08, 0xa4, 0xf8, 0xff, 0xfd, 0x00, 0x08, 0x40, 0xa2,
+  0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0xb2, 0x00,
 
   /*Unicode: U+00ea (ê) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xfc, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02, 0x00, 0x00, 0x00, 0x00,  //....@@@@.....
-  0x00, 0x00, 0x00, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00,  //...+@++@+....
-  0x00, 0x00, 0x1c, 0xf2, 0xc4, 0x00, 0x00, 0xc2, 0xf2, 0x1c, 0x00, 0x00, 0x00,  //...@@..@@....
-  0x00, 0x00, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0x00, 0x00, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x02, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x24, 0x00,  //..%@@@@@@@@..
-  0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06,  //.%@@@...%@@@.
-  0x36, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x62,  //.@@@.....%@@+
-  0x9e, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xb6,  //%@@+......@@%
-  0xdc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xde, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xa2, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x40, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00,  //.%@@%+...+%@.
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd6, 0x00, 0x03, 0x3a, 0xfc, 0xfc, 0x3a, 0xf9, 0x00, 0x05, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02,
+  0xfa, 0x00, 0x05, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0xfb, 0x00, 0x07, 0x1c, 0xf2, 0xc4, 0x00,
+  0x00, 0xc2, 0xf2, 0x1c, 0xfc, 0x00, 0x07, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0xe1,
+  0x00, 0x07, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0xfe, 0x00, 0x01, 0x02, 0x94, 0xfa,
+  0xff, 0x14, 0xde, 0x24, 0x00, 0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff,
+  0xd2, 0x06, 0x36, 0xff, 0xff, 0xdc, 0x08, 0xfd, 0x00, 0x07, 0xa4, 0xff, 0xff, 0x62, 0x9e, 0xff,
+  0xff, 0x5c, 0xfc, 0x00, 0x07, 0x3a, 0xff, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0x1c, 0xfc, 0x00, 0x08,
+  0x10, 0xff, 0xff, 0xe6, 0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfe, 0xff, 0x01, 0xf8, 0xf6,
+  0xf5, 0xff, 0x02, 0xde, 0xff, 0xea, 0xf7, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x1e, 0xf8, 0x00, 0x03,
+  0x40, 0xff, 0xff, 0xa6, 0xf7, 0x00, 0x0e, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40,
+  0x80, 0xd2, 0x00, 0x00, 0x08, 0xa4, 0xf8, 0xff, 0xfd, 0x00, 0x08, 0x40, 0xa2, 0xdc, 0xf4, 0xf8,
+  0xe2, 0xb8, 0x7a, 0x2a, 0xb2, 0x00,
 
   /*Unicode: U+00eb (ë) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //..@@@..@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x36, 0x9e, 0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0x00, 0x00,  //....%@@@@+...
-  0x00, 0x02, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x24, 0x00,  //..%@@@@@@@@..
-  0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06,  //.%@@@...%@@@.
-  0x36, 0xff, 0xff, 0xdc, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x62,  //.@@@.....%@@+
-  0x9e, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0xb6,  //%@@+......@@%
-  0xdc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xe6,  //@@@.......@@@
-  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xf8,  //@@@@@@@@@@@@@
-  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xde, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@..........
-  0xa2, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@..........
-  0x40, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@%.........
-  0x00, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00,  //.%@@%+...+%@.
-  0x00, 0x08, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,  //..%@@@@@@@@@.
-  0x00, 0x00, 0x00, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a, 0x00,  //...+%@@@@%+..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xcb, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xd4, 0x00, 0x07, 0x36, 0x9e,
+  0xdc, 0xf4, 0xf2, 0xce, 0x7c, 0x0c, 0xfe, 0x00, 0x01, 0x02, 0x94, 0xfa, 0xff, 0x14, 0xde, 0x24,
+  0x00, 0x00, 0x94, 0xff, 0xff, 0xc2, 0x36, 0x06, 0x18, 0x84, 0xff, 0xff, 0xd2, 0x06, 0x36, 0xff,
+  0xff, 0xdc, 0x08, 0xfd, 0x00, 0x07, 0xa4, 0xff, 0xff, 0x62, 0x9e, 0xff, 0xff, 0x5c, 0xfc, 0x00,
+  0x07, 0x3a, 0xff, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0x1c, 0xfc, 0x00, 0x08, 0x10, 0xff, 0xff, 0xe6,
+  0xf4, 0xff, 0xff, 0xfa, 0xfa, 0xfd, 0xfc, 0xfe, 0xff, 0x01, 0xf8, 0xf6, 0xf5, 0xff, 0x02, 0xde,
+  0xff, 0xea, 0xf7, 0x00, 0x03, 0xa2, 0xff, 0xff, 0x1e, 0xf8, 0x00, 0x03, 0x40, 0xff, 0xff, 0xa6,
+  0xf7, 0x00, 0x0e, 0xa6, 0xff, 0xff, 0xb6, 0x42, 0x0c, 0x02, 0x14, 0x40, 0x80, 0xd2, 0x00, 0x00,
+  0x08, 0xa4, 0xf8, 0xff, 0xfd, 0x00, 0x08, 0x40, 0xa2, 0xdc, 0xf4, 0xf8, 0xe2, 0xb8, 0x7a, 0x2a,
+  0xb2, 0x00,
 
   /*Unicode: U+00ec (ì) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@........
-  0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@%.......
-  0x00, 0x00, 0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@.......
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@%.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd8, 0x00, 0x03, 0x96, 0xff, 0xce, 0x04, 0xf8, 0x00, 0x03, 0x04, 0xc0, 0xff, 0x88, 0xf7, 0x00,
+  0x03, 0x14, 0xe0, 0xfc, 0x3e, 0xf7, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xf7, 0x00, 0x02, 0x54,
+  0xff, 0xa4, 0xe1, 0x00, 0xfa, 0xff, 0xfb, 0x00, 0xfa, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xfc, 0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+00ed (í) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00, 0x00,  //.......@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x00, 0x00,  //......%@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@+......
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd4, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xf8, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xf9, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xf9, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xf8, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xe0, 0x00, 0xfa, 0xff, 0xfb, 0x00, 0xfa, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00,
+  0xfe, 0xff, 0xfc, 0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+00ee (î) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xfc, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@......
-  0x00, 0x00, 0x00, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02, 0x00, 0x00, 0x00, 0x00,  //....@@@@.....
-  0x00, 0x00, 0x00, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00,  //...+@++@+....
-  0x00, 0x00, 0x1c, 0xf2, 0xc4, 0x00, 0x00, 0xc2, 0xf2, 0x1c, 0x00, 0x00, 0x00,  //...@@..@@....
-  0x00, 0x00, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0x00, 0x00, 0x00,  //..%@....@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd6, 0x00, 0x03, 0x3a, 0xfc, 0xfc, 0x3a, 0xf9, 0x00, 0x05, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02,
+  0xfa, 0x00, 0x05, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0xfb, 0x00, 0x07, 0x1c, 0xf2, 0xc4, 0x00,
+  0x00, 0xc2, 0xf2, 0x1c, 0xfc, 0x00, 0x07, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0xe3,
+  0x00, 0xfa, 0xff, 0xfb, 0x00, 0xfa, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7,
+  0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7,
+  0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xfc,
+  0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+00ef (ï) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,  //...@@@.@@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xca, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xfb, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff,
+  0xfb, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfe, 0xff, 0xd6, 0x00, 0xfa, 0xff, 0xfb, 0x00, 0xfa, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff,
+  0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xe7, 0xff, 0xb3, 0x00,
 
   /*Unicode: U+00f0 (ð) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x70, 0xff, 0xff, 0xfc, 0x46, 0x00, 0x00, 0x04, 0x22, 0x00, 0x00,  //.+@@@+......
-  0x00, 0x00, 0xb4, 0xff, 0xff, 0xe8, 0x42, 0x8e, 0xea, 0xd2, 0x00, 0x00,  //..%@@@+%@@..
-  0x00, 0x00, 0x14, 0xe4, 0xff, 0xff, 0xff, 0xd2, 0x78, 0x1e, 0x00, 0x00,  //...@@@@@+...
-  0x00, 0x1e, 0xa4, 0xf4, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00,  //..%@@@@%....
-  0x00, 0x12, 0xc4, 0x6a, 0xb2, 0xff, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,  //..@+%@@@+...
-  0x00, 0x00, 0x00, 0x00, 0x12, 0xe4, 0xff, 0xff, 0xf8, 0x38, 0x00, 0x00,  //.....@@@@...
-  0x00, 0x00, 0x14, 0x8c, 0xd8, 0xf4, 0xff, 0xff, 0xff, 0xdc, 0x0a, 0x00,  //...%@@@@@@..
-  0x00, 0x2e, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00,  //..@@@@@@@@%.
-  0x08, 0xda, 0xff, 0xff, 0x8e, 0x18, 0x06, 0x38, 0xf4, 0xff, 0xf2, 0x0e,  //.@@@%...@@@.
-  0x64, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb4, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xb2,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xe0,  //@@@......@@@
-  0xf6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf8,  //@@@......@@@
-  0xf6, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf4,  //@@@......@@@
-  0xe2, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xe0,  //@@@......@@@
-  0xb2, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xae,  //%@@+....+@@%
-  0x60, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x5a,  //+@@%....%@@+
-  0x06, 0xd8, 0xff, 0xff, 0x84, 0x10, 0x10, 0x86, 0xff, 0xff, 0xd2, 0x04,  //.@@@%..%@@@.
-  0x00, 0x28, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x24, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x10, 0x84, 0xd2, 0xf4, 0xf4, 0xd2, 0x82, 0x0e, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd0, 0x00, 0x08, 0x70, 0xff, 0xff, 0xfc, 0x46, 0x00, 0x00, 0x04, 0x22, 0xfd, 0x00, 0x07, 0xb4,
+  0xff, 0xff, 0xe8, 0x42, 0x8e, 0xea, 0xd2, 0xfd, 0x00, 0x01, 0x14, 0xe4, 0xfe, 0xff, 0x02, 0xd2,
+  0x78, 0x1e, 0xfe, 0x00, 0x02, 0x1e, 0xa4, 0xf4, 0xfe, 0xff, 0x00, 0x86, 0xfc, 0x00, 0x03, 0x12,
+  0xc4, 0x6a, 0xb2, 0xfe, 0xff, 0x00, 0x68, 0xfa, 0x00, 0x05, 0x12, 0xe4, 0xff, 0xff, 0xf8, 0x38,
+  0xfd, 0x00, 0x03, 0x14, 0x8c, 0xd8, 0xf4, 0xfe, 0xff, 0x05, 0xdc, 0x0a, 0x00, 0x00, 0x2e, 0xe8,
+  0xfa, 0xff, 0x11, 0x82, 0x00, 0x08, 0xda, 0xff, 0xff, 0x8e, 0x18, 0x06, 0x38, 0xf4, 0xff, 0xf2,
+  0x0e, 0x64, 0xff, 0xff, 0xb4, 0xfd, 0x00, 0x07, 0x98, 0xff, 0xff, 0x68, 0xb4, 0xff, 0xff, 0x4c,
+  0xfd, 0x00, 0x07, 0x4e, 0xff, 0xff, 0xb2, 0xe4, 0xff, 0xff, 0x18, 0xfd, 0x00, 0x07, 0x1c, 0xff,
+  0xff, 0xe0, 0xf6, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x06, 0xff, 0xff, 0xf8, 0xf6, 0xff, 0xff,
+  0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf4, 0xe2, 0xff, 0xff, 0x18, 0xfd, 0x00, 0x07, 0x1a,
+  0xff, 0xff, 0xe0, 0xb2, 0xff, 0xff, 0x4c, 0xfd, 0x00, 0x07, 0x4c, 0xff, 0xff, 0xae, 0x60, 0xff,
+  0xff, 0xb0, 0xfd, 0x00, 0x12, 0xb0, 0xff, 0xff, 0x5a, 0x06, 0xd8, 0xff, 0xff, 0x84, 0x10, 0x10,
+  0x86, 0xff, 0xff, 0xd2, 0x04, 0x00, 0x28, 0xe4, 0xfb, 0xff, 0x01, 0xe2, 0x24, 0xfe, 0x00, 0x07,
+  0x10, 0x84, 0xd2, 0xf4, 0xf4, 0xd2, 0x82, 0x0e, 0xb7, 0x00,
 
   /*Unicode: U+00f1 (ñ) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0x00,  //...@@%..@@.
-  0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6a, 0x3e, 0xff, 0xd4, 0x00,  //..%@@@+.@@.
-  0x00, 0x00, 0xd6, 0xff, 0x40, 0x68, 0xff, 0xff, 0xff, 0x86, 0x00,  //..@@++@@@%.
-  0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0x00,  //..@@..%@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x46, 0xbe, 0xf0, 0xf0, 0xb4, 0x28, 0x00,  //@@@.+%@@%..
-  0xff, 0xff, 0xff, 0x5c, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xea, 0x16,  //@@@+@@@@@@.
-  0xff, 0xff, 0xff, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff, 0xff, 0x86,  //@@@@+..@@@%
-  0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xcc,  //@@@%...+@@@
-  0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xee,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xfc,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd3, 0x00, 0x07, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0xfe, 0x00, 0x00, 0x88, 0xfe,
+  0xff, 0x03, 0x6a, 0x3e, 0xff, 0xd4, 0xfe, 0x00, 0x03, 0xd6, 0xff, 0x40, 0x68, 0xfe, 0xff, 0x00,
+  0x86, 0xfe, 0x00, 0x07, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0xea, 0x00, 0xfe, 0xff,
+  0x07, 0x00, 0x46, 0xbe, 0xf0, 0xf0, 0xb4, 0x28, 0x00, 0xfe, 0xff, 0x01, 0x5c, 0xfc, 0xfd, 0xff,
+  0x01, 0xea, 0x16, 0xfe, 0xff, 0x07, 0xe8, 0x5c, 0x08, 0x2c, 0xd4, 0xff, 0xff, 0x86, 0xfe, 0xff,
+  0x00, 0x8c, 0xfe, 0x00, 0x03, 0x4e, 0xff, 0xff, 0xcc, 0xfe, 0xff, 0x00, 0x32, 0xfe, 0x00, 0x03,
+  0x16, 0xff, 0xff, 0xee, 0xfe, 0xff, 0x00, 0x12, 0xfe, 0x00, 0x03, 0x02, 0xff, 0xff, 0xfc, 0xfe,
+  0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb,
+  0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfe,
+  0xff, 0xbf, 0x00,
 
   /*Unicode: U+00f2 (ò) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@.......
-  0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@%......
-  0x00, 0x00, 0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@......
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00,  //.....+@%....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xdb, 0x00, 0x03, 0x96, 0xff, 0xce, 0x04, 0xf9, 0x00, 0x03, 0x04, 0xc0, 0xff, 0x88, 0xf8, 0x00,
+  0x03, 0x14, 0xe0, 0xfc, 0x3e, 0xf8, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xf8, 0x00, 0x02, 0x54,
+  0xff, 0xa4, 0xe3, 0x00, 0x07, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01,
+  0x34, 0xea, 0xfb, 0xff, 0x12, 0xea, 0x30, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e,
+  0xff, 0xff, 0xde, 0x0a, 0x6a, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8,
+  0xff, 0xff, 0x44, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00,
+  0x07, 0x18, 0xff, 0xff, 0xe4, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6,
+  0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd,
+  0x00, 0x07, 0x18, 0xff, 0xff, 0xe4, 0xb8, 0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff,
+  0xb6, 0x6c, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff,
+  0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34,
+  0xfe, 0x00, 0x07, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+00f3 (ó) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00,  //.......@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x00,  //......%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00, 0x00,  //......@@....
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd7, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xf9, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xfa, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xfa, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xf9, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xe2, 0x00, 0x07, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01,
+  0x34, 0xea, 0xfb, 0xff, 0x12, 0xea, 0x30, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e,
+  0xff, 0xff, 0xde, 0x0a, 0x6a, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8,
+  0xff, 0xff, 0x44, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00,
+  0x07, 0x18, 0xff, 0xff, 0xe4, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6,
+  0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd,
+  0x00, 0x07, 0x18, 0xff, 0xff, 0xe4, 0xb8, 0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff,
+  0xb6, 0x6c, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff,
+  0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34,
+  0xfe, 0x00, 0x07, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+00f4 (ô) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xfc, 0x3a, 0x00, 0x00, 0x00, 0x00,  //.....@@.....
-  0x00, 0x00, 0x00, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02, 0x00, 0x00, 0x00,  //....@@@@....
-  0x00, 0x00, 0x00, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0x00, 0x00, 0x00,  //...+@++@+...
-  0x00, 0x00, 0x1c, 0xf2, 0xc4, 0x00, 0x00, 0xc2, 0xf2, 0x1c, 0x00, 0x00,  //...@@..@@...
-  0x00, 0x00, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0x00, 0x00,  //..%@....@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd9, 0x00, 0x03, 0x3a, 0xfc, 0xfc, 0x3a, 0xfa, 0x00, 0x05, 0x04, 0xd2, 0xf8, 0xf8, 0xd2, 0x02,
+  0xfb, 0x00, 0x05, 0x74, 0xff, 0x76, 0x76, 0xff, 0x74, 0xfc, 0x00, 0x07, 0x1c, 0xf2, 0xc4, 0x00,
+  0x00, 0xc2, 0xf2, 0x1c, 0xfd, 0x00, 0x07, 0xb0, 0xf2, 0x22, 0x00, 0x00, 0x20, 0xf2, 0xb0, 0xe5,
+  0x00, 0x07, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01, 0x34, 0xea, 0xfb,
+  0xff, 0x12, 0xea, 0x30, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde,
+  0x0a, 0x6a, 0xff, 0xff, 0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8, 0xff, 0xff, 0x44,
+  0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18, 0xff,
+  0xff, 0xe4, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xff,
+  0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18,
+  0xff, 0xff, 0xe4, 0xb8, 0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0x6c, 0xff,
+  0xff, 0xa4, 0xfd, 0x00, 0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10,
+  0x7e, 0xff, 0xff, 0xe0, 0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34, 0xfe, 0x00, 0x07,
+  0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+00f5 (õ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0x00, 0x00,  //...@@%..@@..
-  0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6a, 0x3e, 0xff, 0xd4, 0x00, 0x00,  //..%@@@+.@@..
-  0x00, 0x00, 0xd6, 0xff, 0x40, 0x68, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00,  //..@@++@@@%..
-  0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0x00, 0x00,  //..@@..%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xcf, 0x00, 0x07, 0x12, 0xc2, 0xee, 0x88, 0x00, 0x06, 0xff, 0xf2, 0xfd, 0x00, 0x00, 0x88, 0xfe,
+  0xff, 0x03, 0x6a, 0x3e, 0xff, 0xd4, 0xfd, 0x00, 0x03, 0xd6, 0xff, 0x40, 0x68, 0xfe, 0xff, 0x00,
+  0x86, 0xfd, 0x00, 0x07, 0xf2, 0xff, 0x06, 0x00, 0x86, 0xee, 0xc2, 0x10, 0xe5, 0x00, 0x07, 0x16,
+  0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01, 0x34, 0xea, 0xfb, 0xff, 0x12, 0xea,
+  0x30, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a, 0x6a, 0xff,
+  0xff, 0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x07,
+  0x48, 0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18, 0xff, 0xff, 0xe4, 0xf8,
+  0xff, 0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00,
+  0x07, 0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18, 0xff, 0xff, 0xe4,
+  0xb8, 0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0x6c, 0xff, 0xff, 0xa4, 0xfd,
+  0x00, 0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff,
+  0xe0, 0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34, 0xfe, 0x00, 0x07, 0x18, 0x8c, 0xd6,
+  0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+00f6 (ö) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //..@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x16, 0x8a, 0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x34, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x30, 0x00,  //..@@@@@@@@..
-  0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a,  //.@@@+..+@@@.
-  0x6a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0xb8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0xe4, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xe6, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xb8, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0xff, 0xb6,  //%@@+....+@@%
-  0x6c, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x68,  //+@@%....%@@+
-  0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0, 0x0a,  //.@@@+..+@@@.
-  0x00, 0x36, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x34, 0x00,  //..@@@@@@@@..
-  0x00, 0x00, 0x18, 0x8c, 0xd6, 0xf4, 0xf4, 0xd6, 0x8c, 0x16, 0x00, 0x00,  //...%@@@@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xcf, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfd, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xd9, 0x00, 0x07, 0x16, 0x8a,
+  0xd4, 0xf4, 0xf4, 0xd4, 0x8a, 0x14, 0xfe, 0x00, 0x01, 0x34, 0xea, 0xfb, 0xff, 0x12, 0xea, 0x30,
+  0x00, 0x0c, 0xe0, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xde, 0x0a, 0x6a, 0xff, 0xff,
+  0xa4, 0xfd, 0x00, 0x07, 0xa8, 0xff, 0xff, 0x68, 0xb8, 0xff, 0xff, 0x44, 0xfd, 0x00, 0x07, 0x48,
+  0xff, 0xff, 0xb6, 0xe4, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18, 0xff, 0xff, 0xe4, 0xf8, 0xff,
+  0xff, 0x04, 0xfd, 0x00, 0x07, 0x04, 0xff, 0xff, 0xf6, 0xf8, 0xff, 0xff, 0x04, 0xfd, 0x00, 0x07,
+  0x04, 0xff, 0xff, 0xf6, 0xe6, 0xff, 0xff, 0x16, 0xfd, 0x00, 0x07, 0x18, 0xff, 0xff, 0xe4, 0xb8,
+  0xff, 0xff, 0x46, 0xfd, 0x00, 0x07, 0x48, 0xff, 0xff, 0xb6, 0x6c, 0xff, 0xff, 0xa4, 0xfd, 0x00,
+  0x12, 0xa8, 0xff, 0xff, 0x68, 0x0c, 0xe2, 0xff, 0xff, 0x7c, 0x10, 0x10, 0x7e, 0xff, 0xff, 0xe0,
+  0x0a, 0x00, 0x36, 0xec, 0xfb, 0xff, 0x01, 0xec, 0x34, 0xfe, 0x00, 0x07, 0x18, 0x8c, 0xd6, 0xf4,
+  0xf4, 0xd6, 0x8c, 0x16, 0xb7, 0x00,
 
   /*Unicode: U+00f7 (÷) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0x81, 0x00, 0xfa, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xe2, 0x00,
+  0xe7, 0xff, 0xe2, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0xf7, 0x00, 0xfe, 0xff, 0x94, 0x00,
 
   /*Unicode: U+00f8 (ø) , Width: 15 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x3e,  //.............%.
-  0x00, 0x00, 0x00, 0x00, 0x22, 0x9c, 0xde, 0xf8, 0xec, 0xb8, 0x4c, 0x00, 0x90, 0xff, 0xa0,  //.....%@@@%+.%@%
-  0x00, 0x00, 0x00, 0x42, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xb0, 0x02,  //...+@@@@@@@@@%.
-  0x00, 0x00, 0x10, 0xea, 0xff, 0xff, 0x80, 0x12, 0x0e, 0x78, 0xff, 0xff, 0xdc, 0x06, 0x00,  //...@@@%..+@@@..
-  0x00, 0x00, 0x74, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x32, 0xfa, 0xff, 0xff, 0x3a, 0x00,  //..+@@%....@@@..
-  0x00, 0x00, 0xbc, 0xff, 0xff, 0x44, 0x00, 0x00, 0x0e, 0xdc, 0xda, 0xff, 0xff, 0x9e, 0x00,  //..%@@+...@@@@%.
-  0x00, 0x00, 0xe8, 0xff, 0xff, 0x14, 0x00, 0x00, 0xac, 0xe0, 0x2a, 0xff, 0xff, 0xda, 0x00,  //..@@@...%@.@@@.
-  0x00, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x6c, 0xfa, 0x38, 0x04, 0xff, 0xff, 0xf4, 0x00,  //..@@@..+@..@@@.
-  0x00, 0x00, 0xf6, 0xff, 0xff, 0x0a, 0x32, 0xf8, 0x72, 0x00, 0x04, 0xff, 0xff, 0xf8, 0x00,  //..@@@..@+..@@@.
-  0x00, 0x00, 0xda, 0xff, 0xff, 0x32, 0xdc, 0xb2, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe6, 0x00,  //..@@@.@%...@@@.
-  0x00, 0x00, 0xa2, 0xff, 0xff, 0xde, 0xe0, 0x10, 0x00, 0x00, 0x46, 0xff, 0xff, 0xbc, 0x00,  //..%@@@@...+@@%.
-  0x00, 0x00, 0x3e, 0xff, 0xff, 0xfc, 0x38, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x74, 0x00,  //...@@@....%@@+.
-  0x00, 0x00, 0x0e, 0xe8, 0xff, 0xff, 0x82, 0x10, 0x0e, 0x7a, 0xff, 0xff, 0xea, 0x12, 0x00,  //...@@@%..+@@@..
-  0x00, 0x0c, 0xc6, 0xff, 0xb2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x46, 0x00, 0x00,  //..@@%@@@@@@@+..
-  0x0a, 0xc4, 0xff, 0x72, 0x00, 0x40, 0xb8, 0xec, 0xf8, 0xe0, 0x9e, 0x26, 0x00, 0x00, 0x00,  //.@@+.+%@@@%....
-  0x06, 0x82, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.%+............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...............
-
+  0x81, 0x00, 0xed, 0x00, 0x01, 0x82, 0x3e, 0xfd, 0x00, 0x0a, 0x22, 0x9c, 0xde, 0xf8, 0xec, 0xb8,
+  0x4c, 0x00, 0x90, 0xff, 0xa0, 0xfe, 0x00, 0x01, 0x42, 0xf4, 0xfb, 0xff, 0x11, 0xca, 0xff, 0xb0,
+  0x02, 0x00, 0x00, 0x10, 0xea, 0xff, 0xff, 0x80, 0x12, 0x0e, 0x78, 0xff, 0xff, 0xdc, 0x06, 0xfe,
+  0x00, 0x03, 0x74, 0xff, 0xff, 0xa6, 0xfe, 0x00, 0x04, 0x32, 0xfa, 0xff, 0xff, 0x3a, 0xfe, 0x00,
+  0x0b, 0xbc, 0xff, 0xff, 0x44, 0x00, 0x00, 0x0e, 0xdc, 0xda, 0xff, 0xff, 0x9e, 0xfe, 0x00, 0x0b,
+  0xe8, 0xff, 0xff, 0x14, 0x00, 0x00, 0xac, 0xe0, 0x2a, 0xff, 0xff, 0xda, 0xfe, 0x00, 0x0b, 0xf8,
+  0xff, 0xff, 0x02, 0x00, 0x6c, 0xfa, 0x38, 0x04, 0xff, 0xff, 0xf4, 0xfe, 0x00, 0x0b, 0xf6, 0xff,
+  0xff, 0x0a, 0x32, 0xf8, 0x72, 0x00, 0x04, 0xff, 0xff, 0xf8, 0xfe, 0x00, 0x0b, 0xda, 0xff, 0xff,
+  0x32, 0xdc, 0xb2, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe6, 0xfe, 0x00, 0x0b, 0xa2, 0xff, 0xff, 0xde,
+  0xe0, 0x10, 0x00, 0x00, 0x46, 0xff, 0xff, 0xbc, 0xfe, 0x00, 0x04, 0x3e, 0xff, 0xff, 0xfc, 0x38,
+  0xfe, 0x00, 0x03, 0xa4, 0xff, 0xff, 0x74, 0xfe, 0x00, 0x12, 0x0e, 0xe8, 0xff, 0xff, 0x82, 0x10,
+  0x0e, 0x7a, 0xff, 0xff, 0xea, 0x12, 0x00, 0x00, 0x0c, 0xc6, 0xff, 0xb2, 0xfc, 0xfc, 0xff, 0x0f,
+  0xf6, 0x46, 0x00, 0x00, 0x0a, 0xc4, 0xff, 0x72, 0x00, 0x40, 0xb8, 0xec, 0xf8, 0xe0, 0x9e, 0x26,
+  0xfe, 0x00, 0x02, 0x06, 0x82, 0x64, 0xaa, 0x00,
 
   /*Unicode: U+00f9 (ù) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x96, 0xff, 0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,  //..%@@......
-  0x00, 0x00, 0x04, 0xc0, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@%.....
-  0x00, 0x00, 0x00, 0x14, 0xe0, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00,  //....@@.....
-  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf4, 0xe0, 0x0e, 0x00, 0x00, 0x00,  //.....@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xa4, 0x00, 0x00, 0x00,  //.....+@%...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xf0, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xce, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,  //@@@+...%@@@
-  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xff, 0xff, 0xff,  //%@@@..+@@@@
-  0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x58, 0xff, 0xff, 0xff,  //.@@@@@@+@@@
-  0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xff, 0xff, 0xff,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xde, 0x00, 0x03, 0x96, 0xff, 0xce, 0x04, 0xfa, 0x00, 0x03, 0x04, 0xc0, 0xff, 0x88, 0xf9, 0x00,
+  0x03, 0x14, 0xe0, 0xfc, 0x3e, 0xf9, 0x00, 0x03, 0x2e, 0xf4, 0xe0, 0x0e, 0xf9, 0x00, 0x02, 0x54,
+  0xff, 0xa4, 0xe8, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x12, 0xfe,
+  0xff, 0x03, 0xf0, 0xff, 0xff, 0x16, 0xfe, 0x00, 0x00, 0x34, 0xfe, 0xff, 0x03, 0xce, 0xff, 0xff,
+  0x4c, 0xfe, 0x00, 0x00, 0x90, 0xfe, 0xff, 0x07, 0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6,
+  0xfe, 0xff, 0x01, 0x1a, 0xee, 0xfd, 0xff, 0x01, 0xfc, 0x58, 0xfe, 0xff, 0x07, 0x00, 0x2c, 0xb6,
+  0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xfe, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00fa (ú) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00,  //.......@@%.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00,  //......%@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00,  //......@@...
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00,  //.....@@....
-  0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00,  //....%@+....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xf0, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xce, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,  //@@@+...%@@@
-  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xff, 0xff, 0xff,  //%@@@..+@@@@
-  0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x58, 0xff, 0xff, 0xff,  //.@@@@@@+@@@
-  0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xff, 0xff, 0xff,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xda, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xfa, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xfb, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xfb, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xfa, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xe7, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x12, 0xfe,
+  0xff, 0x03, 0xf0, 0xff, 0xff, 0x16, 0xfe, 0x00, 0x00, 0x34, 0xfe, 0xff, 0x03, 0xce, 0xff, 0xff,
+  0x4c, 0xfe, 0x00, 0x00, 0x90, 0xfe, 0xff, 0x07, 0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6,
+  0xfe, 0xff, 0x01, 0x1a, 0xee, 0xfd, 0xff, 0x01, 0xfc, 0x58, 0xfe, 0xff, 0x07, 0x00, 0x2c, 0xb6,
+  0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xfe, 0xff, 0xbf, 0x00,
 
   /*Unicode: U+00fb (û) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00,  //....%@%....
-  0x00, 0x00, 0x00, 0x22, 0xf8, 0xf4, 0xf8, 0x22, 0x00, 0x00, 0x00,  //....@@@....
-  0x00, 0x00, 0x00, 0xa6, 0xf0, 0x2e, 0xf0, 0xa6, 0x00, 0x00, 0x00,  //...%@.@%...
-  0x00, 0x00, 0x32, 0xfc, 0x6e, 0x00, 0x6c, 0xfc, 0x30, 0x00, 0x00,  //...@+.+@...
-  0x00, 0x00, 0xba, 0xd0, 0x02, 0x00, 0x02, 0xcc, 0xba, 0x00, 0x00,  //..%@...@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xf0, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xce, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,  //@@@+...%@@@
-  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xff, 0xff, 0xff,  //%@@@..+@@@@
-  0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x58, 0xff, 0xff, 0xff,  //.@@@@@@+@@@
-  0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xff, 0xff, 0xff,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xdc, 0x00, 0x02, 0x94, 0xff, 0x92, 0xfa, 0x00, 0x04, 0x22, 0xf8, 0xf4, 0xf8, 0x22, 0xfb, 0x00,
+  0x04, 0xa6, 0xf0, 0x2e, 0xf0, 0xa6, 0xfc, 0x00, 0x06, 0x32, 0xfc, 0x6e, 0x00, 0x6c, 0xfc, 0x30,
+  0xfd, 0x00, 0x06, 0xba, 0xd0, 0x02, 0x00, 0x02, 0xcc, 0xba, 0xe9, 0x00, 0xfe, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x03, 0xfc,
+  0xff, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x12, 0xfe, 0xff, 0x03, 0xf0, 0xff, 0xff, 0x16, 0xfe, 0x00,
+  0x00, 0x34, 0xfe, 0xff, 0x03, 0xce, 0xff, 0xff, 0x4c, 0xfe, 0x00, 0x00, 0x90, 0xfe, 0xff, 0x07,
+  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xfe, 0xff, 0x01, 0x1a, 0xee, 0xfd, 0xff, 0x01,
+  0xfc, 0x58, 0xfe, 0xff, 0x07, 0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xfe, 0xff, 0xbf,
+  0x00,
 
   /*Unicode: U+00fc (ü) , Width: 11 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@...@@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@...@@@.
-  0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,  //.@@@...@@@.
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xfc, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xf0, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,  //@@@.....@@@
-  0xce, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,  //@@@+...%@@@
-  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xff, 0xff, 0xff,  //%@@@..+@@@@
-  0x1a, 0xee, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x58, 0xff, 0xff, 0xff,  //.@@@@@@+@@@
-  0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xff, 0xff, 0xff,  //..%@@%+.@@@
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........
-
+  0xd4, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe,
+  0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfe, 0x00, 0xfe, 0xff, 0xdf, 0x00, 0xfe, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00,
+  0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfb, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x03, 0xfc,
+  0xff, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x12, 0xfe, 0xff, 0x03, 0xf0, 0xff, 0xff, 0x16, 0xfe, 0x00,
+  0x00, 0x34, 0xfe, 0xff, 0x03, 0xce, 0xff, 0xff, 0x4c, 0xfe, 0x00, 0x00, 0x90, 0xfe, 0xff, 0x07,
+  0x8a, 0xff, 0xff, 0xd4, 0x2c, 0x08, 0x5c, 0xe6, 0xfe, 0xff, 0x01, 0x1a, 0xee, 0xfd, 0xff, 0x01,
+  0xfc, 0x58, 0xfe, 0xff, 0x07, 0x00, 0x2c, 0xb6, 0xf2, 0xf0, 0xbe, 0x44, 0x00, 0xfe, 0xff, 0xbf,
+  0x00,
 
   /*Unicode: U+00fd (ý) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xce, 0xff, 0x96, 0x00, 0x00,  //........@@%..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc0, 0x04, 0x00, 0x00,  //.......%@@...
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xde, 0x14, 0x00, 0x00, 0x00,  //.......@@....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0xf2, 0x2e, 0x00, 0x00, 0x00, 0x00,  //......@@.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....%@+.....
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcc, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xcc,  //@@@+.....+@@@
-  0x66, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x66,  //+@@@.....@@@+
-  0x0c, 0xf2, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xf4, 0x0c,  //.@@@.....@@@.
-  0x00, 0x98, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x9c, 0x00,  //.%@@%...%@@%.
-  0x00, 0x32, 0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff, 0x38, 0x00,  //..@@@...@@@..
-  0x00, 0x00, 0xcc, 0xff, 0xff, 0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0x00, 0x00,  //..@@@+.+@@@..
-  0x00, 0x00, 0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff, 0xff, 0x6e, 0x00, 0x00,  //..+@@@.@@@+..
-  0x00, 0x00, 0x0c, 0xf2, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf6, 0x12, 0x00, 0x00,  //...@@@+@@@...
-  0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xec, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x00, 0x24, 0xd8, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@%......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xda, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x00, 0xff, 0xff, 0xea, 0xa0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
+  0xd3, 0x00, 0x03, 0x04, 0xce, 0xff, 0x96, 0xf8, 0x00, 0x03, 0x88, 0xff, 0xc0, 0x04, 0xf9, 0x00,
+  0x03, 0x3e, 0xfc, 0xde, 0x14, 0xf9, 0x00, 0x03, 0x0e, 0xe0, 0xf2, 0x2e, 0xf8, 0x00, 0x02, 0xa4,
+  0xff, 0x54, 0xe2, 0x00, 0x03, 0xcc, 0xff, 0xff, 0x6e, 0xfc, 0x00, 0x07, 0x6c, 0xff, 0xff, 0xcc,
+  0x66, 0xff, 0xff, 0xd2, 0xfc, 0x00, 0x08, 0xd0, 0xff, 0xff, 0x66, 0x0c, 0xf2, 0xff, 0xff, 0x3a,
+  0xfe, 0x00, 0x09, 0x36, 0xff, 0xff, 0xf4, 0x0c, 0x00, 0x98, 0xff, 0xff, 0xa0, 0xfe, 0x00, 0x10,
+  0x9a, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x32, 0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff,
+  0x38, 0xfe, 0x00, 0x08, 0xcc, 0xff, 0xff, 0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0xfd, 0x00, 0x08,
+  0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff, 0xff, 0x6e, 0xfd, 0x00, 0x08, 0x0c, 0xf2, 0xff, 0xff,
+  0x66, 0xff, 0xff, 0xf6, 0x12, 0xfc, 0x00, 0x06, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0xfb,
+  0x00, 0x00, 0x32, 0xfc, 0xff, 0x00, 0x40, 0xfa, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x00, 0xdc, 0xf9,
+  0x00, 0x00, 0x66, 0xfe, 0xff, 0x00, 0x7c, 0xf9, 0x00, 0x04, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0xf9,
+  0x00, 0x03, 0x78, 0xff, 0xff, 0xba, 0xf8, 0x00, 0x03, 0xdc, 0xff, 0xff, 0x58, 0xf9, 0x00, 0x04,
+  0x4c, 0xff, 0xff, 0xec, 0x06, 0xfa, 0x00, 0x04, 0x24, 0xd8, 0xff, 0xff, 0x86, 0xfa, 0x00, 0xfd,
+  0xff, 0x01, 0xda, 0x0e, 0xfa, 0x00, 0x04, 0xff, 0xff, 0xea, 0xa0, 0x16, 0xed, 0x00,
 
   /*Unicode: U+00fe (þ) , Width: 12 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x62, 0xd0, 0xf6, 0xe8, 0xa6, 0x28, 0x00, 0x00,  //@@@.+@@@%...
-  0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3e, 0x00,  //@@@%@@@@@@..
-  0xff, 0xff, 0xff, 0xfc, 0x80, 0x12, 0x10, 0x7a, 0xff, 0xff, 0xe4, 0x0c,  //@@@@%..+@@@.
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x6a,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xb6,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe2,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xe4,  //@@@......@@@
-  0xff, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0xba,  //@@@+....+@@%
-  0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0x6e,  //@@@%....%@@+
-  0xff, 0xff, 0xff, 0xfc, 0x7e, 0x10, 0x0e, 0x78, 0xff, 0xff, 0xe8, 0x0e,  //@@@@+..+@@@.
-  0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x44, 0x00,  //@@@%@@@@@@+.
-  0xff, 0xff, 0xff, 0x00, 0x68, 0xd2, 0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00,  //@@@.+@@@%...
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@.........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............
-
+  0xd1, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x62, 0xd0,
+  0xf6, 0xe8, 0xa6, 0x28, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x82, 0xfc, 0xff, 0x02, 0xf6, 0x3e, 0x00,
+  0xfe, 0xff, 0x08, 0xfc, 0x80, 0x12, 0x10, 0x7a, 0xff, 0xff, 0xe4, 0x0c, 0xfe, 0xff, 0x00, 0xa8,
+  0xfd, 0x00, 0x03, 0xa4, 0xff, 0xff, 0x6a, 0xfe, 0xff, 0x00, 0x46, 0xfd, 0x00, 0x03, 0x46, 0xff,
+  0xff, 0xb6, 0xfe, 0xff, 0x00, 0x16, 0xfd, 0x00, 0x03, 0x16, 0xff, 0xff, 0xe2, 0xfe, 0xff, 0x00,
+  0x04, 0xfd, 0x00, 0x03, 0x04, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0x00, 0x04, 0xfd, 0x00, 0x03, 0x04,
+  0xff, 0xff, 0xf6, 0xfe, 0xff, 0x00, 0x16, 0xfd, 0x00, 0x03, 0x16, 0xff, 0xff, 0xe4, 0xfe, 0xff,
+  0x00, 0x48, 0xfd, 0x00, 0x03, 0x46, 0xff, 0xff, 0xba, 0xfe, 0xff, 0x00, 0xa8, 0xfd, 0x00, 0x03,
+  0xa2, 0xff, 0xff, 0x6e, 0xfe, 0xff, 0x08, 0xfc, 0x7e, 0x10, 0x0e, 0x78, 0xff, 0xff, 0xe8, 0x0e,
+  0xfe, 0xff, 0x00, 0x86, 0xfc, 0xff, 0x02, 0xf6, 0x44, 0x00, 0xfe, 0xff, 0x08, 0x00, 0x68, 0xd2,
+  0xf6, 0xe8, 0xa8, 0x2a, 0x00, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff,
+  0xf8, 0x00, 0xfe, 0xff, 0xf8, 0x00, 0xfe, 0xff, 0xec, 0x00,
 
   /*Unicode: U+00ff (ÿ) , Width: 13 */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //...@@@..@@@..
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //...@@@..@@@..
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,  //...@@@..@@@..
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-  0xcc, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xcc,  //@@@+.....+@@@
-  0x66, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x66,  //+@@@.....@@@+
-  0x0c, 0xf2, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0xf4, 0x0c,  //.@@@.....@@@.
-  0x00, 0x98, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x9c, 0x00,  //.%@@%...%@@%.
-  0x00, 0x32, 0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff, 0x38, 0x00,  //..@@@...@@@..
-  0x00, 0x00, 0xcc, 0xff, 0xff, 0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0x00, 0x00,  //..@@@+.+@@@..
-  0x00, 0x00, 0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff, 0xff, 0x6e, 0x00, 0x00,  //..+@@@.@@@+..
-  0x00, 0x00, 0x0c, 0xf2, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf6, 0x12, 0x00, 0x00,  //...@@@+@@@...
-  0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00,  //...%@@@@@%...
-  0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,  //....@@@@@+...
-  0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00,  //....@@@@@....
-  0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00,  //....+@@@+....
-  0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0x00, 0x00, 0x00, 0x00,  //.....@@@.....
-  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@@%.....
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,  //....@@@+.....
-  0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xec, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,  //...+@@@......
-  0x00, 0x00, 0x24, 0xd8, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //...@@@%......
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xda, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@.......
-  0x00, 0xff, 0xff, 0xea, 0xa0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@%........
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............
-
-
+  0xca, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00,
+  0xfe, 0xff, 0xfc, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xfe, 0xff, 0xd8, 0x00, 0x03, 0xcc, 0xff,
+  0xff, 0x6e, 0xfc, 0x00, 0x07, 0x6c, 0xff, 0xff, 0xcc, 0x66, 0xff, 0xff, 0xd2, 0xfc, 0x00, 0x08,
+  0xd0, 0xff, 0xff, 0x66, 0x0c, 0xf2, 0xff, 0xff, 0x3a, 0xfe, 0x00, 0x09, 0x36, 0xff, 0xff, 0xf4,
+  0x0c, 0x00, 0x98, 0xff, 0xff, 0xa0, 0xfe, 0x00, 0x10, 0x9a, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x32,
+  0xff, 0xff, 0xf4, 0x10, 0x00, 0x0a, 0xf2, 0xff, 0xff, 0x38, 0xfe, 0x00, 0x08, 0xcc, 0xff, 0xff,
+  0x6c, 0x00, 0x62, 0xff, 0xff, 0xd2, 0xfd, 0x00, 0x08, 0x66, 0xff, 0xff, 0xd2, 0x00, 0xc8, 0xff,
+  0xff, 0x6e, 0xfd, 0x00, 0x08, 0x0c, 0xf2, 0xff, 0xff, 0x66, 0xff, 0xff, 0xf6, 0x12, 0xfc, 0x00,
+  0x06, 0x98, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xa4, 0xfb, 0x00, 0x00, 0x32, 0xfc, 0xff, 0x00, 0x40,
+  0xfa, 0x00, 0x00, 0xcc, 0xfe, 0xff, 0x00, 0xdc, 0xf9, 0x00, 0x00, 0x66, 0xfe, 0xff, 0x00, 0x7c,
+  0xf9, 0x00, 0x04, 0x24, 0xff, 0xff, 0xfc, 0x1e, 0xf9, 0x00, 0x03, 0x78, 0xff, 0xff, 0xba, 0xf8,
+  0x00, 0x03, 0xdc, 0xff, 0xff, 0x58, 0xf9, 0x00, 0x04, 0x4c, 0xff, 0xff, 0xec, 0x06, 0xfa, 0x00,
+  0x04, 0x24, 0xd8, 0xff, 0xff, 0x86, 0xfa, 0x00, 0xfd, 0xff, 0x01, 0xda, 0x0e, 0xfa, 0x00, 0x04,
+  0xff, 0xff, 0xea, 0xa0, 0x16, 0xed, 0x00,
 
 #endif
 };
@@ -12699,395 +3086,395 @@ static const lv_font_glyph_dsc_t pros_font_dejavu_mono_latin_sup_30_glyph_dsc[]
 {
 #if USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 1
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 3,	.glyph_index = 30},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 11,	.glyph_index = 60},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 13,	.glyph_index = 120},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 11,	.glyph_index = 180},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 15,	.glyph_index = 240},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 300},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 11,	.glyph_index = 330},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 8,	.glyph_index = 390},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 16,	.glyph_index = 420},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 10,	.glyph_index = 480},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 12,	.glyph_index = 540},	/*Unicode: U+00ab («)*/
-  {.w_px = 13,	.glyph_index = 600},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 7,	.glyph_index = 660},	/*Unicode: U+00ad (­)*/
-  {.w_px = 16,	.glyph_index = 690},	/*Unicode: U+00ae (®)*/
-  {.w_px = 8,	.glyph_index = 750},	/*Unicode: U+00af (¯)*/
-  {.w_px = 8,	.glyph_index = 780},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 14,	.glyph_index = 810},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 7,	.glyph_index = 870},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 8,	.glyph_index = 900},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 6,	.glyph_index = 930},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 13,	.glyph_index = 960},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 12,	.glyph_index = 1020},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 3,	.glyph_index = 1080},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 5,	.glyph_index = 1110},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 8,	.glyph_index = 1140},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 9,	.glyph_index = 1170},	/*Unicode: U+00ba (º)*/
-  {.w_px = 12,	.glyph_index = 1230},	/*Unicode: U+00bb (»)*/
-  {.w_px = 14,	.glyph_index = 1290},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 14,	.glyph_index = 1350},	/*Unicode: U+00bd (½)*/
-  {.w_px = 14,	.glyph_index = 1410},	/*Unicode: U+00be (¾)*/
-  {.w_px = 10,	.glyph_index = 1470},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 15,	.glyph_index = 1530},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 15,	.glyph_index = 1590},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 15,	.glyph_index = 1650},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 15,	.glyph_index = 1710},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 15,	.glyph_index = 1770},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 15,	.glyph_index = 1830},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 15,	.glyph_index = 1890},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 12,	.glyph_index = 1950},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 12,	.glyph_index = 2010},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 12,	.glyph_index = 2070},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 12,	.glyph_index = 2130},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 12,	.glyph_index = 2190},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 11,	.glyph_index = 2250},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 11,	.glyph_index = 2310},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 11,	.glyph_index = 2370},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 11,	.glyph_index = 2430},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 13,	.glyph_index = 2490},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 12,	.glyph_index = 2550},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 13,	.glyph_index = 2610},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 13,	.glyph_index = 2670},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 13,	.glyph_index = 2730},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 13,	.glyph_index = 2790},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 13,	.glyph_index = 2850},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 12,	.glyph_index = 2910},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 15,	.glyph_index = 2970},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 12,	.glyph_index = 3030},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 12,	.glyph_index = 3090},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 12,	.glyph_index = 3150},	/*Unicode: U+00db (Û)*/
-  {.w_px = 12,	.glyph_index = 3210},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 15,	.glyph_index = 3270},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 12,	.glyph_index = 3330},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 12,	.glyph_index = 3390},	/*Unicode: U+00df (ß)*/
-  {.w_px = 12,	.glyph_index = 3450},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 12,	.glyph_index = 3510},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 12,	.glyph_index = 3570},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 12,	.glyph_index = 3630},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 12,	.glyph_index = 3690},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 12,	.glyph_index = 3750},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 15,	.glyph_index = 3810},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 11,	.glyph_index = 3870},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 13,	.glyph_index = 3930},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 13,	.glyph_index = 3990},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 13,	.glyph_index = 4050},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 13,	.glyph_index = 4110},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 13,	.glyph_index = 4170},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 13,	.glyph_index = 4230},	/*Unicode: U+00ed (í)*/
-  {.w_px = 13,	.glyph_index = 4290},	/*Unicode: U+00ee (î)*/
-  {.w_px = 13,	.glyph_index = 4350},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 12,	.glyph_index = 4410},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 11,	.glyph_index = 4470},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 12,	.glyph_index = 4530},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 12,	.glyph_index = 4590},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 12,	.glyph_index = 4650},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 12,	.glyph_index = 4710},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 12,	.glyph_index = 4770},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 13,	.glyph_index = 4830},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 15,	.glyph_index = 4890},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 11,	.glyph_index = 4950},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 11,	.glyph_index = 5010},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 11,	.glyph_index = 5070},	/*Unicode: U+00fb (û)*/
-  {.w_px = 11,	.glyph_index = 5130},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 13,	.glyph_index = 5190},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 12,	.glyph_index = 5250},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 13,	.glyph_index = 5310},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 11,	.glyph_index = 12},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 13,	.glyph_index = 60},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 11,	.glyph_index = 103},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 15,	.glyph_index = 130},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 173},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 11,	.glyph_index = 184},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 8,	.glyph_index = 230},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 16,	.glyph_index = 236},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 10,	.glyph_index = 273},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 12,	.glyph_index = 302},	/*Unicode: U+00ab («)*/
+  {.w_px = 13,	.glyph_index = 331},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 7,	.glyph_index = 348},	/*Unicode: U+00ad (­)*/
+  {.w_px = 16,	.glyph_index = 355},	/*Unicode: U+00ae (®)*/
+  {.w_px = 8,	.glyph_index = 392},	/*Unicode: U+00af (¯)*/
+  {.w_px = 8,	.glyph_index = 399},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 14,	.glyph_index = 412},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 7,	.glyph_index = 443},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 8,	.glyph_index = 459},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 6,	.glyph_index = 475},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 13,	.glyph_index = 485},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 12,	.glyph_index = 507},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 3,	.glyph_index = 556},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 5,	.glyph_index = 562},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 8,	.glyph_index = 571},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 9,	.glyph_index = 582},	/*Unicode: U+00ba (º)*/
+  {.w_px = 12,	.glyph_index = 611},	/*Unicode: U+00bb (»)*/
+  {.w_px = 14,	.glyph_index = 639},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 14,	.glyph_index = 694},	/*Unicode: U+00bd (½)*/
+  {.w_px = 14,	.glyph_index = 749},	/*Unicode: U+00be (¾)*/
+  {.w_px = 10,	.glyph_index = 804},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 15,	.glyph_index = 844},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 15,	.glyph_index = 894},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 15,	.glyph_index = 943},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 15,	.glyph_index = 993},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 15,	.glyph_index = 1043},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 15,	.glyph_index = 1093},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 15,	.glyph_index = 1144},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 12,	.glyph_index = 1187},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 12,	.glyph_index = 1240},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 12,	.glyph_index = 1290},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 12,	.glyph_index = 1339},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 12,	.glyph_index = 1389},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 11,	.glyph_index = 1439},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 11,	.glyph_index = 1488},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 11,	.glyph_index = 1537},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 11,	.glyph_index = 1587},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 13,	.glyph_index = 1637},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 12,	.glyph_index = 1675},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 13,	.glyph_index = 1725},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 13,	.glyph_index = 1773},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 13,	.glyph_index = 1820},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 13,	.glyph_index = 1868},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 13,	.glyph_index = 1916},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 12,	.glyph_index = 1964},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 15,	.glyph_index = 1993},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 12,	.glyph_index = 2034},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 12,	.glyph_index = 2084},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 12,	.glyph_index = 2133},	/*Unicode: U+00db (Û)*/
+  {.w_px = 12,	.glyph_index = 2183},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 15,	.glyph_index = 2233},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 12,	.glyph_index = 2282},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 12,	.glyph_index = 2323},	/*Unicode: U+00df (ß)*/
+  {.w_px = 12,	.glyph_index = 2368},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 12,	.glyph_index = 2413},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 12,	.glyph_index = 2458},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 12,	.glyph_index = 2504},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 12,	.glyph_index = 2548},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 12,	.glyph_index = 2590},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 15,	.glyph_index = 2639},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 11,	.glyph_index = 2672},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 13,	.glyph_index = 2714},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 13,	.glyph_index = 2759},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 13,	.glyph_index = 2804},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 13,	.glyph_index = 2850},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 13,	.glyph_index = 2892},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 13,	.glyph_index = 2937},	/*Unicode: U+00ed (í)*/
+  {.w_px = 13,	.glyph_index = 2982},	/*Unicode: U+00ee (î)*/
+  {.w_px = 13,	.glyph_index = 3028},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 12,	.glyph_index = 3070},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 11,	.glyph_index = 3115},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 12,	.glyph_index = 3140},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 12,	.glyph_index = 3185},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 12,	.glyph_index = 3230},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 12,	.glyph_index = 3276},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 12,	.glyph_index = 3320},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 13,	.glyph_index = 3362},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 15,	.glyph_index = 3387},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 11,	.glyph_index = 3422},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 11,	.glyph_index = 3449},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 11,	.glyph_index = 3476},	/*Unicode: U+00fb (û)*/
+  {.w_px = 11,	.glyph_index = 3504},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 13,	.glyph_index = 3528},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 12,	.glyph_index = 3580},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 13,	.glyph_index = 3634},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 2
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 3,	.glyph_index = 60},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 11,	.glyph_index = 90},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 13,	.glyph_index = 180},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 11,	.glyph_index = 300},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 15,	.glyph_index = 390},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 510},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 11,	.glyph_index = 540},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 8,	.glyph_index = 630},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 16,	.glyph_index = 690},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 10,	.glyph_index = 810},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 12,	.glyph_index = 900},	/*Unicode: U+00ab («)*/
-  {.w_px = 13,	.glyph_index = 990},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 7,	.glyph_index = 1110},	/*Unicode: U+00ad (­)*/
-  {.w_px = 16,	.glyph_index = 1170},	/*Unicode: U+00ae (®)*/
-  {.w_px = 8,	.glyph_index = 1290},	/*Unicode: U+00af (¯)*/
-  {.w_px = 8,	.glyph_index = 1350},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 14,	.glyph_index = 1410},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 7,	.glyph_index = 1530},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 8,	.glyph_index = 1590},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 6,	.glyph_index = 1650},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 13,	.glyph_index = 1710},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 12,	.glyph_index = 1830},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 3,	.glyph_index = 1920},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 5,	.glyph_index = 1950},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 8,	.glyph_index = 2010},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 9,	.glyph_index = 2070},	/*Unicode: U+00ba (º)*/
-  {.w_px = 12,	.glyph_index = 2160},	/*Unicode: U+00bb (»)*/
-  {.w_px = 14,	.glyph_index = 2250},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 14,	.glyph_index = 2370},	/*Unicode: U+00bd (½)*/
-  {.w_px = 14,	.glyph_index = 2490},	/*Unicode: U+00be (¾)*/
-  {.w_px = 10,	.glyph_index = 2610},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 15,	.glyph_index = 2700},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 15,	.glyph_index = 2820},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 15,	.glyph_index = 2940},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 15,	.glyph_index = 3060},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 15,	.glyph_index = 3180},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 15,	.glyph_index = 3300},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 15,	.glyph_index = 3420},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 12,	.glyph_index = 3540},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 12,	.glyph_index = 3630},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 12,	.glyph_index = 3720},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 12,	.glyph_index = 3810},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 12,	.glyph_index = 3900},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 11,	.glyph_index = 3990},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 11,	.glyph_index = 4080},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 11,	.glyph_index = 4170},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 11,	.glyph_index = 4260},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 13,	.glyph_index = 4350},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 12,	.glyph_index = 4470},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 13,	.glyph_index = 4560},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 13,	.glyph_index = 4680},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 13,	.glyph_index = 4800},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 13,	.glyph_index = 4920},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 13,	.glyph_index = 5040},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 12,	.glyph_index = 5160},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 15,	.glyph_index = 5250},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 12,	.glyph_index = 5370},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 12,	.glyph_index = 5460},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 12,	.glyph_index = 5550},	/*Unicode: U+00db (Û)*/
-  {.w_px = 12,	.glyph_index = 5640},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 15,	.glyph_index = 5730},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 12,	.glyph_index = 5850},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 12,	.glyph_index = 5940},	/*Unicode: U+00df (ß)*/
-  {.w_px = 12,	.glyph_index = 6030},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 12,	.glyph_index = 6120},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 12,	.glyph_index = 6210},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 12,	.glyph_index = 6300},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 12,	.glyph_index = 6390},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 12,	.glyph_index = 6480},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 15,	.glyph_index = 6570},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 11,	.glyph_index = 6690},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 13,	.glyph_index = 6780},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 13,	.glyph_index = 6900},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 13,	.glyph_index = 7020},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 13,	.glyph_index = 7140},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 13,	.glyph_index = 7260},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 13,	.glyph_index = 7380},	/*Unicode: U+00ed (í)*/
-  {.w_px = 13,	.glyph_index = 7500},	/*Unicode: U+00ee (î)*/
-  {.w_px = 13,	.glyph_index = 7620},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 12,	.glyph_index = 7740},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 11,	.glyph_index = 7830},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 12,	.glyph_index = 7920},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 12,	.glyph_index = 8010},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 12,	.glyph_index = 8100},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 12,	.glyph_index = 8190},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 12,	.glyph_index = 8280},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 13,	.glyph_index = 8370},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 15,	.glyph_index = 8490},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 11,	.glyph_index = 8610},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 11,	.glyph_index = 8700},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 11,	.glyph_index = 8790},	/*Unicode: U+00fb (û)*/
-  {.w_px = 11,	.glyph_index = 8880},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 13,	.glyph_index = 8970},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 12,	.glyph_index = 9090},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 13,	.glyph_index = 9180},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 11,	.glyph_index = 14},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 13,	.glyph_index = 83},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 11,	.glyph_index = 163},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 15,	.glyph_index = 201},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 281},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 11,	.glyph_index = 292},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 8,	.glyph_index = 359},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 16,	.glyph_index = 370},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 10,	.glyph_index = 437},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 12,	.glyph_index = 478},	/*Unicode: U+00ab («)*/
+  {.w_px = 13,	.glyph_index = 518},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 7,	.glyph_index = 546},	/*Unicode: U+00ad (­)*/
+  {.w_px = 16,	.glyph_index = 555},	/*Unicode: U+00ae (®)*/
+  {.w_px = 8,	.glyph_index = 622},	/*Unicode: U+00af (¯)*/
+  {.w_px = 8,	.glyph_index = 628},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 14,	.glyph_index = 649},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 7,	.glyph_index = 701},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 8,	.glyph_index = 728},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 6,	.glyph_index = 755},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 13,	.glyph_index = 769},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 12,	.glyph_index = 847},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 3,	.glyph_index = 918},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 5,	.glyph_index = 924},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 8,	.glyph_index = 938},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 9,	.glyph_index = 965},	/*Unicode: U+00ba (º)*/
+  {.w_px = 12,	.glyph_index = 1005},	/*Unicode: U+00bb (»)*/
+  {.w_px = 14,	.glyph_index = 1045},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 14,	.glyph_index = 1147},	/*Unicode: U+00bd (½)*/
+  {.w_px = 14,	.glyph_index = 1251},	/*Unicode: U+00be (¾)*/
+  {.w_px = 10,	.glyph_index = 1353},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 15,	.glyph_index = 1408},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 15,	.glyph_index = 1500},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 15,	.glyph_index = 1591},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 15,	.glyph_index = 1683},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 15,	.glyph_index = 1775},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 15,	.glyph_index = 1867},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 15,	.glyph_index = 1966},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 12,	.glyph_index = 2046},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 12,	.glyph_index = 2122},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 12,	.glyph_index = 2186},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 12,	.glyph_index = 2249},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 12,	.glyph_index = 2313},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 11,	.glyph_index = 2377},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 11,	.glyph_index = 2448},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 11,	.glyph_index = 2519},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 11,	.glyph_index = 2591},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 13,	.glyph_index = 2663},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 12,	.glyph_index = 2743},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 13,	.glyph_index = 2815},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 13,	.glyph_index = 2907},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 13,	.glyph_index = 2998},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 13,	.glyph_index = 3090},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 13,	.glyph_index = 3182},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 12,	.glyph_index = 3274},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 15,	.glyph_index = 3315},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 12,	.glyph_index = 3394},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 12,	.glyph_index = 3466},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 12,	.glyph_index = 3537},	/*Unicode: U+00db (Û)*/
+  {.w_px = 12,	.glyph_index = 3609},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 15,	.glyph_index = 3681},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 12,	.glyph_index = 3772},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 12,	.glyph_index = 3832},	/*Unicode: U+00df (ß)*/
+  {.w_px = 12,	.glyph_index = 3897},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 12,	.glyph_index = 3961},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 12,	.glyph_index = 4024},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 12,	.glyph_index = 4088},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 12,	.glyph_index = 4150},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 12,	.glyph_index = 4209},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 15,	.glyph_index = 4279},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 11,	.glyph_index = 4340},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 13,	.glyph_index = 4400},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 13,	.glyph_index = 4480},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 13,	.glyph_index = 4559},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 13,	.glyph_index = 4639},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 13,	.glyph_index = 4712},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 13,	.glyph_index = 4794},	/*Unicode: U+00ed (í)*/
+  {.w_px = 13,	.glyph_index = 4875},	/*Unicode: U+00ee (î)*/
+  {.w_px = 13,	.glyph_index = 4957},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 12,	.glyph_index = 5032},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 11,	.glyph_index = 5097},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 12,	.glyph_index = 5159},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 12,	.glyph_index = 5223},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 12,	.glyph_index = 5286},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 12,	.glyph_index = 5350},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 12,	.glyph_index = 5412},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 13,	.glyph_index = 5471},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 15,	.glyph_index = 5507},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 11,	.glyph_index = 5570},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 11,	.glyph_index = 5634},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 11,	.glyph_index = 5697},	/*Unicode: U+00fb (û)*/
+  {.w_px = 11,	.glyph_index = 5761},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 13,	.glyph_index = 5820},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 12,	.glyph_index = 5918},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 13,	.glyph_index = 5996},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 4
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 3,	.glyph_index = 120},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 11,	.glyph_index = 180},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 13,	.glyph_index = 360},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 11,	.glyph_index = 570},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 15,	.glyph_index = 750},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 990},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 11,	.glyph_index = 1020},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 8,	.glyph_index = 1200},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 16,	.glyph_index = 1320},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 10,	.glyph_index = 1560},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 12,	.glyph_index = 1710},	/*Unicode: U+00ab («)*/
-  {.w_px = 13,	.glyph_index = 1890},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 7,	.glyph_index = 2100},	/*Unicode: U+00ad (­)*/
-  {.w_px = 16,	.glyph_index = 2220},	/*Unicode: U+00ae (®)*/
-  {.w_px = 8,	.glyph_index = 2460},	/*Unicode: U+00af (¯)*/
-  {.w_px = 8,	.glyph_index = 2580},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 14,	.glyph_index = 2700},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 7,	.glyph_index = 2910},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 8,	.glyph_index = 3030},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 6,	.glyph_index = 3150},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 13,	.glyph_index = 3240},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 12,	.glyph_index = 3450},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 3,	.glyph_index = 3630},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 5,	.glyph_index = 3690},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 8,	.glyph_index = 3780},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 9,	.glyph_index = 3900},	/*Unicode: U+00ba (º)*/
-  {.w_px = 12,	.glyph_index = 4050},	/*Unicode: U+00bb (»)*/
-  {.w_px = 14,	.glyph_index = 4230},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 14,	.glyph_index = 4440},	/*Unicode: U+00bd (½)*/
-  {.w_px = 14,	.glyph_index = 4650},	/*Unicode: U+00be (¾)*/
-  {.w_px = 10,	.glyph_index = 4860},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 15,	.glyph_index = 5010},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 15,	.glyph_index = 5250},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 15,	.glyph_index = 5490},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 15,	.glyph_index = 5730},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 15,	.glyph_index = 5970},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 15,	.glyph_index = 6210},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 15,	.glyph_index = 6450},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 12,	.glyph_index = 6690},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 12,	.glyph_index = 6870},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 12,	.glyph_index = 7050},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 12,	.glyph_index = 7230},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 12,	.glyph_index = 7410},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 11,	.glyph_index = 7590},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 11,	.glyph_index = 7770},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 11,	.glyph_index = 7950},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 11,	.glyph_index = 8130},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 13,	.glyph_index = 8310},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 12,	.glyph_index = 8520},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 13,	.glyph_index = 8700},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 13,	.glyph_index = 8910},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 13,	.glyph_index = 9120},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 13,	.glyph_index = 9330},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 13,	.glyph_index = 9540},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 12,	.glyph_index = 9750},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 15,	.glyph_index = 9930},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 12,	.glyph_index = 10170},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 12,	.glyph_index = 10350},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 12,	.glyph_index = 10530},	/*Unicode: U+00db (Û)*/
-  {.w_px = 12,	.glyph_index = 10710},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 15,	.glyph_index = 10890},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 12,	.glyph_index = 11130},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 12,	.glyph_index = 11310},	/*Unicode: U+00df (ß)*/
-  {.w_px = 12,	.glyph_index = 11490},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 12,	.glyph_index = 11670},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 12,	.glyph_index = 11850},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 12,	.glyph_index = 12030},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 12,	.glyph_index = 12210},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 12,	.glyph_index = 12390},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 15,	.glyph_index = 12570},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 11,	.glyph_index = 12810},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 13,	.glyph_index = 12990},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 13,	.glyph_index = 13200},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 13,	.glyph_index = 13410},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 13,	.glyph_index = 13620},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 13,	.glyph_index = 13830},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 13,	.glyph_index = 14040},	/*Unicode: U+00ed (í)*/
-  {.w_px = 13,	.glyph_index = 14250},	/*Unicode: U+00ee (î)*/
-  {.w_px = 13,	.glyph_index = 14460},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 12,	.glyph_index = 14670},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 11,	.glyph_index = 14850},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 12,	.glyph_index = 15030},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 12,	.glyph_index = 15210},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 12,	.glyph_index = 15390},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 12,	.glyph_index = 15570},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 12,	.glyph_index = 15750},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 13,	.glyph_index = 15930},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 15,	.glyph_index = 16140},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 11,	.glyph_index = 16380},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 11,	.glyph_index = 16560},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 11,	.glyph_index = 16740},	/*Unicode: U+00fb (û)*/
-  {.w_px = 11,	.glyph_index = 16920},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 13,	.glyph_index = 17100},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 12,	.glyph_index = 17310},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 13,	.glyph_index = 17490},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 3,	.glyph_index = 2},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 11,	.glyph_index = 42},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 13,	.glyph_index = 162},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 11,	.glyph_index = 266},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 15,	.glyph_index = 337},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 459},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 11,	.glyph_index = 470},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 8,	.glyph_index = 593},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 16,	.glyph_index = 610},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 10,	.glyph_index = 731},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 12,	.glyph_index = 794},	/*Unicode: U+00ab («)*/
+  {.w_px = 13,	.glyph_index = 869},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 7,	.glyph_index = 901},	/*Unicode: U+00ad (­)*/
+  {.w_px = 16,	.glyph_index = 913},	/*Unicode: U+00ae (®)*/
+  {.w_px = 8,	.glyph_index = 1040},	/*Unicode: U+00af (¯)*/
+  {.w_px = 8,	.glyph_index = 1046},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 14,	.glyph_index = 1083},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 7,	.glyph_index = 1125},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 8,	.glyph_index = 1174},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 6,	.glyph_index = 1223},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 13,	.glyph_index = 1241},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 12,	.glyph_index = 1366},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 3,	.glyph_index = 1499},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 5,	.glyph_index = 1512},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 8,	.glyph_index = 1531},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 9,	.glyph_index = 1578},	/*Unicode: U+00ba (º)*/
+  {.w_px = 12,	.glyph_index = 1639},	/*Unicode: U+00bb (»)*/
+  {.w_px = 14,	.glyph_index = 1714},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 14,	.glyph_index = 1850},	/*Unicode: U+00bd (½)*/
+  {.w_px = 14,	.glyph_index = 1987},	/*Unicode: U+00be (¾)*/
+  {.w_px = 10,	.glyph_index = 2138},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 15,	.glyph_index = 2226},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 15,	.glyph_index = 2384},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 15,	.glyph_index = 2542},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 15,	.glyph_index = 2704},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 15,	.glyph_index = 2868},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 15,	.glyph_index = 3032},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 15,	.glyph_index = 3208},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 12,	.glyph_index = 3358},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 12,	.glyph_index = 3489},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 12,	.glyph_index = 3583},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 12,	.glyph_index = 3677},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 12,	.glyph_index = 3775},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 11,	.glyph_index = 3873},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 11,	.glyph_index = 3983},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 11,	.glyph_index = 4094},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 11,	.glyph_index = 4208},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 13,	.glyph_index = 4322},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 12,	.glyph_index = 4458},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 13,	.glyph_index = 4595},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 13,	.glyph_index = 4745},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 13,	.glyph_index = 4895},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 13,	.glyph_index = 5049},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 13,	.glyph_index = 5204},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 12,	.glyph_index = 5359},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 15,	.glyph_index = 5436},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 12,	.glyph_index = 5596},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 12,	.glyph_index = 5728},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 12,	.glyph_index = 5860},	/*Unicode: U+00db (Û)*/
+  {.w_px = 12,	.glyph_index = 5995},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 15,	.glyph_index = 6130},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 12,	.glyph_index = 6269},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 12,	.glyph_index = 6372},	/*Unicode: U+00df (ß)*/
+  {.w_px = 12,	.glyph_index = 6496},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 12,	.glyph_index = 6606},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 12,	.glyph_index = 6716},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 12,	.glyph_index = 6829},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 12,	.glyph_index = 6938},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 12,	.glyph_index = 7041},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 15,	.glyph_index = 7167},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 11,	.glyph_index = 7280},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 13,	.glyph_index = 7388},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 13,	.glyph_index = 7502},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 13,	.glyph_index = 7616},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 13,	.glyph_index = 7735},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 13,	.glyph_index = 7844},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 13,	.glyph_index = 7944},	/*Unicode: U+00ed (í)*/
+  {.w_px = 13,	.glyph_index = 8044},	/*Unicode: U+00ee (î)*/
+  {.w_px = 13,	.glyph_index = 8149},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 12,	.glyph_index = 8244},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 11,	.glyph_index = 8368},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 12,	.glyph_index = 8482},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 12,	.glyph_index = 8595},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 12,	.glyph_index = 8708},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 12,	.glyph_index = 8824},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 12,	.glyph_index = 8936},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 13,	.glyph_index = 9042},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 15,	.glyph_index = 9084},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 11,	.glyph_index = 9205},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 11,	.glyph_index = 9320},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 11,	.glyph_index = 9435},	/*Unicode: U+00fb (û)*/
+  {.w_px = 11,	.glyph_index = 9554},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 13,	.glyph_index = 9663},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 12,	.glyph_index = 9813},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 13,	.glyph_index = 9954},	/*Unicode: U+00ff (ÿ)*/
 
 #elif USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30 == 8
   {.w_px = 8,	.glyph_index = 0},	/*Unicode: U+00a0 ( )*/
-  {.w_px = 3,	.glyph_index = 240},	/*Unicode: U+00a1 (¡)*/
-  {.w_px = 11,	.glyph_index = 330},	/*Unicode: U+00a2 (¢)*/
-  {.w_px = 13,	.glyph_index = 660},	/*Unicode: U+00a3 (£)*/
-  {.w_px = 11,	.glyph_index = 1050},	/*Unicode: U+00a4 (¤)*/
-  {.w_px = 15,	.glyph_index = 1380},	/*Unicode: U+00a5 (¥)*/
-  {.w_px = 2,	.glyph_index = 1830},	/*Unicode: U+00a6 (¦)*/
-  {.w_px = 11,	.glyph_index = 1890},	/*Unicode: U+00a7 (§)*/
-  {.w_px = 8,	.glyph_index = 2220},	/*Unicode: U+00a8 (¨)*/
-  {.w_px = 16,	.glyph_index = 2460},	/*Unicode: U+00a9 (©)*/
-  {.w_px = 10,	.glyph_index = 2940},	/*Unicode: U+00aa (ª)*/
-  {.w_px = 12,	.glyph_index = 3240},	/*Unicode: U+00ab («)*/
-  {.w_px = 13,	.glyph_index = 3600},	/*Unicode: U+00ac (¬)*/
-  {.w_px = 7,	.glyph_index = 3990},	/*Unicode: U+00ad (­)*/
-  {.w_px = 16,	.glyph_index = 4200},	/*Unicode: U+00ae (®)*/
-  {.w_px = 8,	.glyph_index = 4680},	/*Unicode: U+00af (¯)*/
-  {.w_px = 8,	.glyph_index = 4920},	/*Unicode: U+00b0 (°)*/
-  {.w_px = 14,	.glyph_index = 5160},	/*Unicode: U+00b1 (±)*/
-  {.w_px = 7,	.glyph_index = 5580},	/*Unicode: U+00b2 (²)*/
-  {.w_px = 8,	.glyph_index = 5790},	/*Unicode: U+00b3 (³)*/
-  {.w_px = 6,	.glyph_index = 6030},	/*Unicode: U+00b4 (´)*/
-  {.w_px = 13,	.glyph_index = 6210},	/*Unicode: U+00b5 (µ)*/
-  {.w_px = 12,	.glyph_index = 6600},	/*Unicode: U+00b6 (¶)*/
-  {.w_px = 3,	.glyph_index = 6960},	/*Unicode: U+00b7 (·)*/
-  {.w_px = 5,	.glyph_index = 7050},	/*Unicode: U+00b8 (¸)*/
-  {.w_px = 8,	.glyph_index = 7200},	/*Unicode: U+00b9 (¹)*/
-  {.w_px = 9,	.glyph_index = 7440},	/*Unicode: U+00ba (º)*/
-  {.w_px = 12,	.glyph_index = 7710},	/*Unicode: U+00bb (»)*/
-  {.w_px = 14,	.glyph_index = 8070},	/*Unicode: U+00bc (¼)*/
-  {.w_px = 14,	.glyph_index = 8490},	/*Unicode: U+00bd (½)*/
-  {.w_px = 14,	.glyph_index = 8910},	/*Unicode: U+00be (¾)*/
-  {.w_px = 10,	.glyph_index = 9330},	/*Unicode: U+00bf (¿)*/
-  {.w_px = 15,	.glyph_index = 9630},	/*Unicode: U+00c0 (À)*/
-  {.w_px = 15,	.glyph_index = 10080},	/*Unicode: U+00c1 (Á)*/
-  {.w_px = 15,	.glyph_index = 10530},	/*Unicode: U+00c2 (Â)*/
-  {.w_px = 15,	.glyph_index = 10980},	/*Unicode: U+00c3 (Ã)*/
-  {.w_px = 15,	.glyph_index = 11430},	/*Unicode: U+00c4 (Ä)*/
-  {.w_px = 15,	.glyph_index = 11880},	/*Unicode: U+00c5 (Å)*/
-  {.w_px = 15,	.glyph_index = 12330},	/*Unicode: U+00c6 (Æ)*/
-  {.w_px = 12,	.glyph_index = 12780},	/*Unicode: U+00c7 (Ç)*/
-  {.w_px = 12,	.glyph_index = 13140},	/*Unicode: U+00c8 (È)*/
-  {.w_px = 12,	.glyph_index = 13500},	/*Unicode: U+00c9 (É)*/
-  {.w_px = 12,	.glyph_index = 13860},	/*Unicode: U+00ca (Ê)*/
-  {.w_px = 12,	.glyph_index = 14220},	/*Unicode: U+00cb (Ë)*/
-  {.w_px = 11,	.glyph_index = 14580},	/*Unicode: U+00cc (Ì)*/
-  {.w_px = 11,	.glyph_index = 14910},	/*Unicode: U+00cd (Í)*/
-  {.w_px = 11,	.glyph_index = 15240},	/*Unicode: U+00ce (Î)*/
-  {.w_px = 11,	.glyph_index = 15570},	/*Unicode: U+00cf (Ï)*/
-  {.w_px = 13,	.glyph_index = 15900},	/*Unicode: U+00d0 (Ð)*/
-  {.w_px = 12,	.glyph_index = 16290},	/*Unicode: U+00d1 (Ñ)*/
-  {.w_px = 13,	.glyph_index = 16650},	/*Unicode: U+00d2 (Ò)*/
-  {.w_px = 13,	.glyph_index = 17040},	/*Unicode: U+00d3 (Ó)*/
-  {.w_px = 13,	.glyph_index = 17430},	/*Unicode: U+00d4 (Ô)*/
-  {.w_px = 13,	.glyph_index = 17820},	/*Unicode: U+00d5 (Õ)*/
-  {.w_px = 13,	.glyph_index = 18210},	/*Unicode: U+00d6 (Ö)*/
-  {.w_px = 12,	.glyph_index = 18600},	/*Unicode: U+00d7 (×)*/
-  {.w_px = 15,	.glyph_index = 18960},	/*Unicode: U+00d8 (Ø)*/
-  {.w_px = 12,	.glyph_index = 19410},	/*Unicode: U+00d9 (Ù)*/
-  {.w_px = 12,	.glyph_index = 19770},	/*Unicode: U+00da (Ú)*/
-  {.w_px = 12,	.glyph_index = 20130},	/*Unicode: U+00db (Û)*/
-  {.w_px = 12,	.glyph_index = 20490},	/*Unicode: U+00dc (Ü)*/
-  {.w_px = 15,	.glyph_index = 20850},	/*Unicode: U+00dd (Ý)*/
-  {.w_px = 12,	.glyph_index = 21300},	/*Unicode: U+00de (Þ)*/
-  {.w_px = 12,	.glyph_index = 21660},	/*Unicode: U+00df (ß)*/
-  {.w_px = 12,	.glyph_index = 22020},	/*Unicode: U+00e0 (à)*/
-  {.w_px = 12,	.glyph_index = 22380},	/*Unicode: U+00e1 (á)*/
-  {.w_px = 12,	.glyph_index = 22740},	/*Unicode: U+00e2 (â)*/
-  {.w_px = 12,	.glyph_index = 23100},	/*Unicode: U+00e3 (ã)*/
-  {.w_px = 12,	.glyph_index = 23460},	/*Unicode: U+00e4 (ä)*/
-  {.w_px = 12,	.glyph_index = 23820},	/*Unicode: U+00e5 (å)*/
-  {.w_px = 15,	.glyph_index = 24180},	/*Unicode: U+00e6 (æ)*/
-  {.w_px = 11,	.glyph_index = 24630},	/*Unicode: U+00e7 (ç)*/
-  {.w_px = 13,	.glyph_index = 24960},	/*Unicode: U+00e8 (è)*/
-  {.w_px = 13,	.glyph_index = 25350},	/*Unicode: U+00e9 (é)*/
-  {.w_px = 13,	.glyph_index = 25740},	/*Unicode: U+00ea (ê)*/
-  {.w_px = 13,	.glyph_index = 26130},	/*Unicode: U+00eb (ë)*/
-  {.w_px = 13,	.glyph_index = 26520},	/*Unicode: U+00ec (ì)*/
-  {.w_px = 13,	.glyph_index = 26910},	/*Unicode: U+00ed (í)*/
-  {.w_px = 13,	.glyph_index = 27300},	/*Unicode: U+00ee (î)*/
-  {.w_px = 13,	.glyph_index = 27690},	/*Unicode: U+00ef (ï)*/
-  {.w_px = 12,	.glyph_index = 28080},	/*Unicode: U+00f0 (ð)*/
-  {.w_px = 11,	.glyph_index = 28440},	/*Unicode: U+00f1 (ñ)*/
-  {.w_px = 12,	.glyph_index = 28770},	/*Unicode: U+00f2 (ò)*/
-  {.w_px = 12,	.glyph_index = 29130},	/*Unicode: U+00f3 (ó)*/
-  {.w_px = 12,	.glyph_index = 29490},	/*Unicode: U+00f4 (ô)*/
-  {.w_px = 12,	.glyph_index = 29850},	/*Unicode: U+00f5 (õ)*/
-  {.w_px = 12,	.glyph_index = 30210},	/*Unicode: U+00f6 (ö)*/
-  {.w_px = 13,	.glyph_index = 30570},	/*Unicode: U+00f7 (÷)*/
-  {.w_px = 15,	.glyph_index = 30960},	/*Unicode: U+00f8 (ø)*/
-  {.w_px = 11,	.glyph_index = 31410},	/*Unicode: U+00f9 (ù)*/
-  {.w_px = 11,	.glyph_index = 31740},	/*Unicode: U+00fa (ú)*/
-  {.w_px = 11,	.glyph_index = 32070},	/*Unicode: U+00fb (û)*/
-  {.w_px = 11,	.glyph_index = 32400},	/*Unicode: U+00fc (ü)*/
-  {.w_px = 13,	.glyph_index = 32730},	/*Unicode: U+00fd (ý)*/
-  {.w_px = 12,	.glyph_index = 33120},	/*Unicode: U+00fe (þ)*/
-  {.w_px = 13,	.glyph_index = 33480},	/*Unicode: U+00ff (ÿ)*/
+  {.w_px = 3,	.glyph_index = 4},	/*Unicode: U+00a1 (¡)*/
+  {.w_px = 11,	.glyph_index = 30},	/*Unicode: U+00a2 (¢)*/
+  {.w_px = 13,	.glyph_index = 208},	/*Unicode: U+00a3 (£)*/
+  {.w_px = 11,	.glyph_index = 311},	/*Unicode: U+00a4 (¤)*/
+  {.w_px = 15,	.glyph_index = 421},	/*Unicode: U+00a5 (¥)*/
+  {.w_px = 2,	.glyph_index = 579},	/*Unicode: U+00a6 (¦)*/
+  {.w_px = 11,	.glyph_index = 589},	/*Unicode: U+00a7 (§)*/
+  {.w_px = 8,	.glyph_index = 782},	/*Unicode: U+00a8 (¨)*/
+  {.w_px = 16,	.glyph_index = 805},	/*Unicode: U+00a9 (©)*/
+  {.w_px = 10,	.glyph_index = 1016},	/*Unicode: U+00aa (ª)*/
+  {.w_px = 12,	.glyph_index = 1126},	/*Unicode: U+00ab («)*/
+  {.w_px = 13,	.glyph_index = 1266},	/*Unicode: U+00ac (¬)*/
+  {.w_px = 7,	.glyph_index = 1296},	/*Unicode: U+00ad (­)*/
+  {.w_px = 16,	.glyph_index = 1302},	/*Unicode: U+00ae (®)*/
+  {.w_px = 8,	.glyph_index = 1539},	/*Unicode: U+00af (¯)*/
+  {.w_px = 8,	.glyph_index = 1547},	/*Unicode: U+00b0 (°)*/
+  {.w_px = 14,	.glyph_index = 1614},	/*Unicode: U+00b1 (±)*/
+  {.w_px = 7,	.glyph_index = 1666},	/*Unicode: U+00b2 (²)*/
+  {.w_px = 8,	.glyph_index = 1739},	/*Unicode: U+00b3 (³)*/
+  {.w_px = 6,	.glyph_index = 1822},	/*Unicode: U+00b4 (´)*/
+  {.w_px = 13,	.glyph_index = 1854},	/*Unicode: U+00b5 (µ)*/
+  {.w_px = 12,	.glyph_index = 2033},	/*Unicode: U+00b6 (¶)*/
+  {.w_px = 3,	.glyph_index = 2231},	/*Unicode: U+00b7 (·)*/
+  {.w_px = 5,	.glyph_index = 2237},	/*Unicode: U+00b8 (¸)*/
+  {.w_px = 8,	.glyph_index = 2264},	/*Unicode: U+00b9 (¹)*/
+  {.w_px = 9,	.glyph_index = 2326},	/*Unicode: U+00ba (º)*/
+  {.w_px = 12,	.glyph_index = 2427},	/*Unicode: U+00bb (»)*/
+  {.w_px = 14,	.glyph_index = 2567},	/*Unicode: U+00bc (¼)*/
+  {.w_px = 14,	.glyph_index = 2748},	/*Unicode: U+00bd (½)*/
+  {.w_px = 14,	.glyph_index = 2926},	/*Unicode: U+00be (¾)*/
+  {.w_px = 10,	.glyph_index = 3137},	/*Unicode: U+00bf (¿)*/
+  {.w_px = 15,	.glyph_index = 3265},	/*Unicode: U+00c0 (À)*/
+  {.w_px = 15,	.glyph_index = 3491},	/*Unicode: U+00c1 (Á)*/
+  {.w_px = 15,	.glyph_index = 3717},	/*Unicode: U+00c2 (Â)*/
+  {.w_px = 15,	.glyph_index = 3952},	/*Unicode: U+00c3 (Ã)*/
+  {.w_px = 15,	.glyph_index = 4187},	/*Unicode: U+00c4 (Ä)*/
+  {.w_px = 15,	.glyph_index = 4418},	/*Unicode: U+00c5 (Å)*/
+  {.w_px = 15,	.glyph_index = 4668},	/*Unicode: U+00c6 (Æ)*/
+  {.w_px = 12,	.glyph_index = 4852},	/*Unicode: U+00c7 (Ç)*/
+  {.w_px = 12,	.glyph_index = 5041},	/*Unicode: U+00c8 (È)*/
+  {.w_px = 12,	.glyph_index = 5126},	/*Unicode: U+00c9 (É)*/
+  {.w_px = 12,	.glyph_index = 5211},	/*Unicode: U+00ca (Ê)*/
+  {.w_px = 12,	.glyph_index = 5306},	/*Unicode: U+00cb (Ë)*/
+  {.w_px = 11,	.glyph_index = 5399},	/*Unicode: U+00cc (Ì)*/
+  {.w_px = 11,	.glyph_index = 5488},	/*Unicode: U+00cd (Í)*/
+  {.w_px = 11,	.glyph_index = 5577},	/*Unicode: U+00ce (Î)*/
+  {.w_px = 11,	.glyph_index = 5677},	/*Unicode: U+00cf (Ï)*/
+  {.w_px = 13,	.glyph_index = 5772},	/*Unicode: U+00d0 (Ð)*/
+  {.w_px = 12,	.glyph_index = 5963},	/*Unicode: U+00d1 (Ñ)*/
+  {.w_px = 13,	.glyph_index = 6144},	/*Unicode: U+00d2 (Ò)*/
+  {.w_px = 13,	.glyph_index = 6373},	/*Unicode: U+00d3 (Ó)*/
+  {.w_px = 13,	.glyph_index = 6602},	/*Unicode: U+00d4 (Ô)*/
+  {.w_px = 13,	.glyph_index = 6840},	/*Unicode: U+00d5 (Õ)*/
+  {.w_px = 13,	.glyph_index = 7078},	/*Unicode: U+00d6 (Ö)*/
+  {.w_px = 12,	.glyph_index = 7312},	/*Unicode: U+00d7 (×)*/
+  {.w_px = 15,	.glyph_index = 7446},	/*Unicode: U+00d8 (Ø)*/
+  {.w_px = 12,	.glyph_index = 7727},	/*Unicode: U+00d9 (Ù)*/
+  {.w_px = 12,	.glyph_index = 7873},	/*Unicode: U+00da (Ú)*/
+  {.w_px = 12,	.glyph_index = 8019},	/*Unicode: U+00db (Û)*/
+  {.w_px = 12,	.glyph_index = 8175},	/*Unicode: U+00dc (Ü)*/
+  {.w_px = 15,	.glyph_index = 8330},	/*Unicode: U+00dd (Ý)*/
+  {.w_px = 12,	.glyph_index = 8513},	/*Unicode: U+00de (Þ)*/
+  {.w_px = 12,	.glyph_index = 8644},	/*Unicode: U+00df (ß)*/
+  {.w_px = 12,	.glyph_index = 8859},	/*Unicode: U+00e0 (à)*/
+  {.w_px = 12,	.glyph_index = 9033},	/*Unicode: U+00e1 (á)*/
+  {.w_px = 12,	.glyph_index = 9207},	/*Unicode: U+00e2 (â)*/
+  {.w_px = 12,	.glyph_index = 9394},	/*Unicode: U+00e3 (ã)*/
+  {.w_px = 12,	.glyph_index = 9578},	/*Unicode: U+00e4 (ä)*/
+  {.w_px = 12,	.glyph_index = 9745},	/*Unicode: U+00e5 (å)*/
+  {.w_px = 15,	.glyph_index = 9947},	/*Unicode: U+00e6 (æ)*/
+  {.w_px = 11,	.glyph_index = 10125},	/*Unicode: U+00e7 (ç)*/
+  {.w_px = 13,	.glyph_index = 10278},	/*Unicode: U+00e8 (è)*/
+  {.w_px = 13,	.glyph_index = 10447},	/*Unicode: U+00e9 (é)*/
+  {.w_px = 13,	.glyph_index = 10616},	/*Unicode: U+00ea (ê)*/
+  {.w_px = 13,	.glyph_index = 10798},	/*Unicode: U+00eb (ë)*/
+  {.w_px = 13,	.glyph_index = 10960},	/*Unicode: U+00ec (ì)*/
+  {.w_px = 13,	.glyph_index = 11048},	/*Unicode: U+00ed (í)*/
+  {.w_px = 13,	.glyph_index = 11136},	/*Unicode: U+00ee (î)*/
+  {.w_px = 13,	.glyph_index = 11237},	/*Unicode: U+00ef (ï)*/
+  {.w_px = 12,	.glyph_index = 11315},	/*Unicode: U+00f0 (ð)*/
+  {.w_px = 11,	.glyph_index = 11533},	/*Unicode: U+00f1 (ñ)*/
+  {.w_px = 12,	.glyph_index = 11680},	/*Unicode: U+00f2 (ò)*/
+  {.w_px = 12,	.glyph_index = 11869},	/*Unicode: U+00f3 (ó)*/
+  {.w_px = 12,	.glyph_index = 12058},	/*Unicode: U+00f4 (ô)*/
+  {.w_px = 12,	.glyph_index = 12260},	/*Unicode: U+00f5 (õ)*/
+  {.w_px = 12,	.glyph_index = 12459},	/*Unicode: U+00f6 (ö)*/
+  {.w_px = 13,	.glyph_index = 12641},	/*Unicode: U+00f7 (÷)*/
+  {.w_px = 15,	.glyph_index = 12673},	/*Unicode: U+00f8 (ø)*/
+  {.w_px = 11,	.glyph_index = 12889},	/*Unicode: U+00f9 (ù)*/
+  {.w_px = 11,	.glyph_index = 13026},	/*Unicode: U+00fa (ú)*/
+  {.w_px = 11,	.glyph_index = 13163},	/*Unicode: U+00fb (û)*/
+  {.w_px = 11,	.glyph_index = 13308},	/*Unicode: U+00fc (ü)*/
+  {.w_px = 13,	.glyph_index = 13437},	/*Unicode: U+00fd (ý)*/
+  {.w_px = 12,	.glyph_index = 13659},	/*Unicode: U+00fe (þ)*/
+  {.w_px = 13,	.glyph_index = 13861},	/*Unicode: U+00ff (ÿ)*/
 
 #endif
 };
@@ -13114,6 +3501,7 @@ lv_font_t pros_font_dejavu_mono_latin_sup_30 =
 #endif
     .monospace = 16,		/*Fix width (0: if not used)*/
     .next_page = NULL,		/*Pointer to a font extension*/
+    .compressed = 1,        /*The glyphs are packed with PackBits*/
 };
 
 #endif /*USE_PROS_FONT_DEJAVU_MONO_LATIN_SUP_30*/
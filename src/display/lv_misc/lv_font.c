@@ -7,8 +7,10 @@
  *      INCLUDES
  *********************/
 #include <stddef.h>
+#include <string.h>
 #include "lv_font.h"
 #include "lv_log.h"
+#include "lv_math.h"
 
 /*********************
  *      DEFINES
@@ -21,6 +23,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static int32_t lv_font_get_sparse_index(const lv_font_t * font, uint32_t unicode_letter);
 
 /**********************
  *  STATIC VARIABLES
@@ -150,6 +153,53 @@ uint8_t lv_font_get_width(const lv_font_t * font_p, uint32_t letter)
 
 }
 
+/**
+ * Tells if the glyph of a letter is compressed
+ * @param font pointer to font
+ * @param letter a letter from font (font extensions can be compressed or not)
+ * @return true: the bitmap of the letter has to be unpacked with `lv_font_decompress`
+ */
+bool lv_font_is_compressed(const lv_font_t * font, uint32_t letter)
+{
+    const lv_font_t * font_i = font;
+    while(font_i != NULL) {
+        if(letter >= font_i->unicode_first && letter <= font_i->unicode_last) {
+            return font_i->compressed != 0;
+        }
+        font_i = font_i->next_page;
+    }
+
+    return false;
+}
+
+/**
+ * Unpack the bitmap of a compressed glyph.
+ * A header byte 'n' of 0..127 is followed by 'n + 1' bytes to copy,
+ * one of 129..255 by a byte to repeat '257 - n' times.
+ * @param src the compressed bitmap (from `lv_font_get_bitmap`)
+ * @param dest store the bitmap here
+ * @param len length of the unpacked bitmap (the rows of the glyph)
+ */
+void lv_font_decompress(const uint8_t * src, uint8_t * dest, uint32_t len)
+{
+    uint8_t * dest_end = dest + len;
+    while(dest < dest_end) {
+        uint8_t header = *src++;
+        uint32_t cnt;
+        if(header < 128) {
+            cnt = LV_MATH_MIN((uint32_t)header + 1, (uint32_t)(dest_end - dest));
+            memcpy(dest, src, cnt);
+            src += (uint32_t)header + 1;
+        } else if(header > 128) {
+            cnt = LV_MATH_MIN((uint32_t)257 - header, (uint32_t)(dest_end - dest));
+            memset(dest, *src++, cnt);
+        } else {
+            cnt = 0;    /*No-op*/
+        }
+        dest += cnt;
+    }
+}
+
 /**
  * Get the width of the letter without overwriting it with the `monospace` attribute
  * @param font_p pointer to a font
@@ -216,14 +266,10 @@ const uint8_t * lv_font_get_bitmap_sparse(const lv_font_t * font, uint32_t unico
     /*Check the range*/
     if(unicode_letter < font->unicode_first || unicode_letter > font->unicode_last) return NULL;
 
-    uint32_t i;
-    for(i = 0; font->unicode_list[i] != 0; i++) {
-        if(font->unicode_list[i] == unicode_letter) {
-            return &font->glyph_bitmap[font->glyph_dsc[i].glyph_index];
-        }
-    }
+    int32_t i = lv_font_get_sparse_index(font, unicode_letter);
+    if(i < 0) return NULL;
 
-    return NULL;
+    return &font->glyph_bitmap[font->glyph_dsc[i].glyph_index];
 }
 
 /**
@@ -254,16 +300,44 @@ int16_t lv_font_get_width_sparse(const lv_font_t * font, uint32_t unicode_letter
     /*Check the range*/
     if(unicode_letter < font->unicode_first || unicode_letter > font->unicode_last) return -1;
 
-    uint32_t i;
-    for(i = 0; font->unicode_list[i] != 0; i++) {
-        if(font->unicode_list[i] == unicode_letter) {
-            return font->glyph_dsc[i].w_px;
-        }
-    }
+    int32_t i = lv_font_get_sparse_index(font, unicode_letter);
+    if(i < 0) return -1;
 
-    return -1;
+    return font->glyph_dsc[i].w_px;
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Find a letter in the 'unicode_list' of a sparse font.
+ * The font converter writes the list in ascending order and sets 'glyph_cnt' so it is searched by bisection.
+ * Fonts without 'glyph_cnt' are scanned up to the terminating 0 instead.
+ * @param font pointer to a sparse font
+ * @param unicode_letter an unicode letter to find
+ * @return index of the letter in 'unicode_list' and 'glyph_dsc' or -1 if not found
+ */
+static int32_t lv_font_get_sparse_index(const lv_font_t * font, uint32_t unicode_letter)
+{
+    const uint32_t * list = font->unicode_list;
+
+    if(font->glyph_cnt == 0) {
+        uint32_t i;
+        for(i = 0; list[i] != 0; i++) {
+            if(list[i] == unicode_letter) return i;
+        }
+        return -1;
+    }
+
+    uint32_t first = 0;
+    uint32_t last = font->glyph_cnt;    /*One past the last candidate*/
+    while(first < last) {
+        uint32_t mid = first + (last - first) / 2;
+        if(list[mid] < unicode_letter) first = mid + 1;
+        else last = mid;
+    }
+
+    if(first < font->glyph_cnt && list[first] == unicode_letter) return first;
+    return -1;
+}
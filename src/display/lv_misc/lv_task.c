@@ -2,6 +2,10 @@
  * @file lv_task.c
  * An 'lv_task'  is a void (*fp) (void* param) type function which will be called periodically.
  * A priority (5 levels + disable) can be assigned to lv_tasks.
+ *
+ * The lv_tasks are kept in order of when they are next due, with the stopped ones at the end,
+ * so `lv_task_handler` only looks at the ones which are due instead of every lv_task.
+ * When more than one is due the highest priority one runs first.
  */
 
 /*********************
@@ -29,6 +33,9 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool lv_task_exec(lv_task_t * lv_task_p);
+static void lv_task_sched(lv_task_t * lv_task_p);
+static lv_task_t * lv_task_get_next_due(void);
+static bool lv_task_is_due(const lv_task_t * lv_task_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -36,7 +43,7 @@ static bool lv_task_exec(lv_task_t * lv_task_p);
 static bool lv_task_run = false;
 static uint8_t idle_last = 0;
 static bool task_deleted;
-static bool task_created;
+static uint8_t handler_pass;    /*Counts `lv_task_handler` calls, so that no lv_task runs twice in one*/
 
 /**********************
  *      MACROS
@@ -59,8 +66,9 @@ void lv_task_init(void)
 
 /**
  * Call it  periodically to handle lv_tasks.
+ * @return milliseconds until the next call has something to do, see `lv_task_get_time_till_next`
  */
-LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
+LV_ATTRIBUTE_TASK_HANDLER uint32_t lv_task_handler(void)
 {
     LV_LOG_TRACE("lv_task_handler started");
     bool task_run = __atomic_load_n(&lv_task_run, __ATOMIC_ACQUIRE);
@@ -68,7 +76,7 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
     if(task_run == false)
     {
         LV_LOG_TRACE("lv_task_handler bailed early, task run false");
-        return;
+        return UINT32_MAX;
     }
 
     /*Avoid concurrent running of the task handler*/
@@ -76,9 +84,10 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
 
     bool expected = false;
     bool toSet = true;
-    bool alreadyTaken = __atomic_compare_exchange(&task_handler_mutex, &expected, &toSet,/* weak*/ false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+    /*The exchange succeeds when the handler wasn't running yet*/
+    bool taken = __atomic_compare_exchange(&task_handler_mutex, &expected, &toSet,/* weak*/ false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
 
-    if (alreadyTaken) return;
+    if (!taken) return 0;
 
     static uint32_t idle_period_start = 0;
     static uint32_t handler_start = 0;
@@ -86,65 +95,13 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
 
 
     handler_start = lv_tick_get();
+    handler_pass++;
 
-    /* Run all task from the highest to the lowest priority
-     * If a lower priority task is executed check task again from the highest priority
-     * but on the priority of executed tasks don't run tasks before the executed*/
-    lv_task_t * task_interrupter = NULL;
-    lv_task_t * next;
-    bool end_flag;
-    do {
-        end_flag = true;
-        task_deleted = false;
-        task_created = false;
-        LV_GC_ROOT(_lv_task_act) = lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
-        while(LV_GC_ROOT(_lv_task_act)) {
-            /* The task might be deleted if it runs only once ('once = 1')
-             * So get next element until the current is surely valid*/
-            next = lv_ll_get_next(&LV_GC_ROOT(_lv_task_ll), LV_GC_ROOT(_lv_task_act));
-
-            /*We reach priority of the turned off task. There is nothing more to do.*/
-            if(((lv_task_t *)LV_GC_ROOT(_lv_task_act))->prio == LV_TASK_PRIO_OFF) {
-                break;
-            }
-
-            /*Here is the interrupter task. Don't execute it again.*/
-            if(LV_GC_ROOT(_lv_task_act) == task_interrupter) {
-                task_interrupter = NULL;     /*From this point only task after the interrupter comes, so the interrupter is not interesting anymore*/
-                LV_GC_ROOT(_lv_task_act) = next;
-                continue;                   /*Load the next task*/
-            }
-
-            /*Just try to run the tasks with highest priority.*/
-            if(((lv_task_t *)LV_GC_ROOT(_lv_task_act))->prio == LV_TASK_PRIO_HIGHEST) {
-                lv_task_exec(LV_GC_ROOT(_lv_task_act));
-            }
-            /*Tasks with higher priority then the interrupted shall be run in every case*/
-            else if(task_interrupter) {
-                if(((lv_task_t *)LV_GC_ROOT(_lv_task_act))->prio > task_interrupter->prio) {
-                    if(lv_task_exec(LV_GC_ROOT(_lv_task_act))) {
-                        task_interrupter = LV_GC_ROOT(_lv_task_act);  /*Check all tasks again from the highest priority */
-                        end_flag = false;
-                        break;
-                    }
-                }
-            }
-            /* It is no interrupter task or we already reached it earlier.
-             * Just run the remaining tasks*/
-            else {
-                if(lv_task_exec(LV_GC_ROOT(_lv_task_act))) {
-                    task_interrupter = LV_GC_ROOT(_lv_task_act);  /*Check all tasks again from the highest priority */
-                    end_flag = false;
-                    break;
-                }
-            }
-
-            if(task_deleted) break;     /*If a task was deleted then this or the next item might be corrupted*/
-            if(task_created) break;     /*If a task was deleted then this or the next item might be corrupted*/
-
-            LV_GC_ROOT(_lv_task_act) = next;         /*Load the next task*/
-        }
-    } while(!end_flag);
+    /* Run the due tasks from the highest to the lowest priority, each at most once.
+     * The next one is looked up after every run, as a task can create, delete or reschedule any of them*/
+    while((LV_GC_ROOT(_lv_task_act) = lv_task_get_next_due()) != NULL) {
+        lv_task_exec(LV_GC_ROOT(_lv_task_act));
+    }
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -161,6 +118,8 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
     __atomic_store_n(&task_handler_mutex, false, __ATOMIC_RELEASE);
 
     LV_LOG_TRACE("lv_task_handler ready");
+
+    return lv_task_get_time_till_next();
 }
 
 /**
@@ -173,32 +132,9 @@ LV_ATTRIBUTE_TASK_HANDLER void lv_task_handler(void)
  */
 lv_task_t * lv_task_create(void (*task)(void *), uint32_t period, lv_task_prio_t prio, void * param)
 {
-    lv_task_t * new_lv_task = NULL;
-    lv_task_t * tmp;
-
-    /*Create task lists in order of priority from high to low*/
-    tmp = lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
-    if(NULL == tmp) {                               /*First task*/
-        new_lv_task = lv_ll_ins_head(&LV_GC_ROOT(_lv_task_ll));
-        lv_mem_assert(new_lv_task);
-        if(new_lv_task == NULL) return NULL;
-    } else {
-        do {
-            if(tmp->prio <= prio) {
-                new_lv_task = lv_ll_ins_prev(&LV_GC_ROOT(_lv_task_ll), tmp);
-                lv_mem_assert(new_lv_task);
-                if(new_lv_task == NULL) return NULL;
-                break;
-            }
-            tmp = lv_ll_get_next(&LV_GC_ROOT(_lv_task_ll), tmp);
-        } while(tmp != NULL);
-
-        if(tmp == NULL) {   /*Only too high priority tasks were found*/
-            new_lv_task = lv_ll_ins_tail(&LV_GC_ROOT(_lv_task_ll));
-            lv_mem_assert(new_lv_task);
-            if(new_lv_task == NULL) return NULL;
-        }
-    }
+    lv_task_t * new_lv_task = lv_ll_ins_tail(&LV_GC_ROOT(_lv_task_ll));
+    lv_mem_assert(new_lv_task);
+    if(new_lv_task == NULL) return NULL;
 
     new_lv_task->period = period;
     new_lv_task->task = task;
@@ -206,8 +142,9 @@ lv_task_t * lv_task_create(void (*task)(void *), uint32_t period, lv_task_prio_t
     new_lv_task->param = param;
     new_lv_task->once = 0;
     new_lv_task->last_run = lv_tick_get();
+    new_lv_task->pass = handler_pass - 1;      /*Can run in the current `lv_task_handler` call if it's due*/
 
-    task_created = true;
+    lv_task_sched(new_lv_task);
 
     return new_lv_task;
 }
@@ -232,22 +169,8 @@ void lv_task_del(lv_task_t * lv_task_p)
  */
 void lv_task_set_prio(lv_task_t * lv_task_p, lv_task_prio_t prio)
 {
-    /*Find the tasks with new priority*/
-    lv_task_t * i;
-    LL_READ(LV_GC_ROOT(_lv_task_ll), i) {
-        if(i->prio <= prio) {
-            if(i != lv_task_p) lv_ll_move_before(&LV_GC_ROOT(_lv_task_ll), lv_task_p, i);
-            break;
-        }
-    }
-
-    /*There was no such a low priority so far then add the node to the tail*/
-    if(i == NULL) {
-        lv_ll_move_before(&LV_GC_ROOT(_lv_task_ll), lv_task_p, NULL);
-    }
-
-
     lv_task_p->prio = prio;
+    lv_task_sched(lv_task_p);     /*Stopped tasks go to the end*/
 }
 
 /**
@@ -258,6 +181,7 @@ void lv_task_set_prio(lv_task_t * lv_task_p, lv_task_prio_t prio)
 void lv_task_set_period(lv_task_t * lv_task_p, uint32_t period)
 {
     lv_task_p->period = period;
+    lv_task_sched(lv_task_p);
 }
 
 /**
@@ -267,6 +191,7 @@ void lv_task_set_period(lv_task_t * lv_task_p, uint32_t period)
 void lv_task_ready(lv_task_t * lv_task_p)
 {
     lv_task_p->last_run = lv_tick_get() - lv_task_p->period - 1;
+    lv_task_sched(lv_task_p);
 }
 
 /**
@@ -286,6 +211,7 @@ void lv_task_once(lv_task_t * lv_task_p)
 void lv_task_reset(lv_task_t * lv_task_p)
 {
     lv_task_p->last_run = lv_tick_get();
+    lv_task_sched(lv_task_p);
 }
 
 /**
@@ -306,6 +232,23 @@ uint8_t lv_task_get_idle(void)
     return idle_last;
 }
 
+/**
+ * Get the time until the next lv_task is due, e.g. to sleep until then between calls of `lv_task_handler`
+ * @return milliseconds until 'lv_task_handler' has something to do (0: now, UINT32_MAX: nothing to do,
+ *         because there are no lv_tasks or the lv_task handling is suspended)
+ */
+uint32_t lv_task_get_time_till_next(void)
+{
+    if(__atomic_load_n(&lv_task_run, __ATOMIC_ACQUIRE) == false) return UINT32_MAX;
+
+    /*The list is ordered by deadline, so only the head matters*/
+    lv_task_t * lv_task_p = lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
+    if(lv_task_p == NULL || lv_task_p->prio == LV_TASK_PRIO_OFF) return UINT32_MAX;
+
+    uint32_t elp = lv_tick_elaps(lv_task_p->last_run);
+    return elp >= lv_task_p->period ? 0 : lv_task_p->period - elp;
+}
+
 
 /**********************
  *   STATIC FUNCTIONS
@@ -321,11 +264,11 @@ static bool lv_task_exec(lv_task_t * lv_task_p)
     bool exec = false;
 
     /*Execute if at least 'period' time elapsed*/
-    uint32_t elp = lv_tick_elaps(lv_task_p->last_run);
-    if(elp >= lv_task_p->period) {
+    if(lv_task_is_due(lv_task_p)) {
         lv_task_p->last_run = lv_tick_get();
+        lv_task_p->pass = handler_pass;
+        lv_task_sched(lv_task_p);
         task_deleted = false;
-        task_created = false;
         lv_task_p->task(lv_task_p->param);
 
         /*Delete if it was a one shot lv_task*/
@@ -340,3 +283,57 @@ static bool lv_task_exec(lv_task_t * lv_task_p)
     return exec;
 }
 
+/**
+ * Tell whether a task's period has elapsed
+ * @param lv_task_p pointer to lv_task
+ * @return true: the task is due
+ */
+static bool lv_task_is_due(const lv_task_t * lv_task_p)
+{
+    return lv_tick_elaps(lv_task_p->last_run) >= lv_task_p->period;
+}
+
+/**
+ * Move a task to its place in the list after its deadline, priority or period changed
+ * @param lv_task_p pointer to lv_task
+ */
+static void lv_task_sched(lv_task_t * lv_task_p)
+{
+    lv_ll_t * ll_p = &LV_GC_ROOT(_lv_task_ll);
+    if(lv_task_p->prio == LV_TASK_PRIO_OFF) {
+        lv_ll_move_before(ll_p, lv_task_p, NULL);
+        return;
+    }
+
+    /*Put it before the first task which is due later, or is stopped.
+     * Deadlines are compared relative to now, so that they can wrap around*/
+    uint32_t elp = lv_tick_elaps(lv_task_p->last_run);
+    uint32_t remaining = elp >= lv_task_p->period ? 0 : lv_task_p->period - elp;
+    lv_task_t * i;
+    LL_READ(*ll_p, i) {
+        if(i == lv_task_p) continue;
+        if(i->prio == LV_TASK_PRIO_OFF) break;
+        uint32_t i_elp = lv_tick_elaps(i->last_run);
+        uint32_t i_remaining = i_elp >= i->period ? 0 : i->period - i_elp;
+        if(i_remaining > remaining) break;
+    }
+    lv_ll_move_before(ll_p, lv_task_p, i);
+}
+
+/**
+ * Find the highest priority task which is due and hasn't run in this `lv_task_handler` call yet
+ * @return pointer to the lv_task, or NULL if there is none
+ */
+static lv_task_t * lv_task_get_next_due(void)
+{
+    lv_task_t * next = NULL;
+    lv_task_t * i;
+    /*The due tasks are all at the head of the list, and the earliest due wins a tie*/
+    LL_READ(LV_GC_ROOT(_lv_task_ll), i) {
+        if(i->prio == LV_TASK_PRIO_OFF || !lv_task_is_due(i)) break;
+        if(i->pass == handler_pass) continue;
+        if(next == NULL || i->prio > next->prio) next = i;
+    }
+
+    return next;
+}
@@ -6,8 +6,10 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <string.h>
 #include "lv_txt.h"
 #include "lv_math.h"
+#include "lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -337,6 +339,154 @@ lv_coord_t lv_txt_get_width(const char * txt, uint16_t length,
     return width;
 }
 
+/**
+ * Initialize an empty text layout
+ * @param layout pointer to a layout
+ */
+void lv_txt_layout_init(lv_txt_layout_t * layout)
+{
+    memset(layout, 0, sizeof(lv_txt_layout_t));
+}
+
+/**
+ * Lay out a text, unless the layout is of the same text with the same settings already
+ * @param layout pointer to a layout
+ * @param txt a '\0' terminated string
+ * @param font pointer to a font
+ * @param letter_space letter space
+ * @param max_width max with of the text (break the lines to fit this size) Set CORD_MAX to avoid line breaks
+ * @param flag settings for the text from 'txt_flag_type' enum
+ * @return true: the layout is of `txt`, false: not enough memory to lay it out
+ */
+bool lv_txt_layout_update(lv_txt_layout_t * layout, const char * txt, const lv_font_t * font,
+                          lv_coord_t letter_space, lv_coord_t max_width, lv_txt_flag_t flag)
+{
+    if(txt == NULL || font == NULL) return false;
+
+    if(flag & LV_TXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+    flag &= LV_TXT_FLAG_RECOLOR | LV_TXT_FLAG_EXPAND;   /*The alignment doesn't change the lines*/
+
+    /*Hash the text too, as it can be changed in place (e.g. static texts or the dots of LV_LABEL_LONG_DOT).
+     * That is still much cheaper than looking up the width of every letter again*/
+    uint32_t hash = 2166136261u;    /*FNV-1a*/
+    uint32_t len = 0;
+    while(txt[len] != '\0') {
+        hash = (hash ^ (uint8_t)txt[len]) * 16777619u;
+        len++;
+    }
+
+    if(layout->valid && layout->txt == txt && layout->txt_hash == hash && layout->txt_len == len &&
+       layout->font == font && layout->letter_space == letter_space && layout->flag == flag) {
+        if(layout->max_width == max_width) return true;
+        /*If no line was wrapped then no letter came closer to the width limit than the longest line,
+         * so the lines come out the same for any limit at least that wide.
+         * E.g. a label is laid out without a limit and then drawn with its width set to fit the text*/
+        if(layout->unwrapped && letter_space >= 0 && layout->width <= max_width) return true;
+    }
+
+    layout->valid = 0;
+    layout->txt = txt;
+    layout->txt_hash = hash;
+    layout->txt_len = len;
+    layout->font = font;
+    layout->letter_space = letter_space;
+    layout->max_width = max_width;
+    layout->flag = flag;
+    layout->unwrapped = 1;
+    layout->line_cnt = 0;
+    layout->width = 0;
+
+    uint32_t line_start = 0;
+    while(txt[line_start] != '\0') {
+        uint32_t line_end = line_start + lv_txt_get_next_line(&txt[line_start], font, letter_space, max_width, flag);
+
+        if(layout->line_cnt == layout->line_cap) {
+            uint16_t new_cap = layout->line_cap == 0 ? 4 : layout->line_cap * 2;
+            lv_txt_line_t * new_lines = lv_mem_realloc(layout->lines, new_cap * sizeof(lv_txt_line_t));
+            if(new_lines == NULL) return false;
+            layout->lines = new_lines;
+            layout->line_cap = new_cap;
+        }
+
+        lv_txt_line_t * line = &layout->lines[layout->line_cnt++];
+        line->start = line_start;
+        line->width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, letter_space, flag);
+        layout->width = LV_MATH_MAX(line->width, layout->width);
+
+        /*Only line breaks and the end of the text don't depend on the width*/
+        char last = txt[line_end - 1];
+        if(txt[line_end] != '\0' && last != '\n' && last != '\r') layout->unwrapped = 0;
+
+        line_start = line_end;
+    }
+
+    layout->valid = 1;
+    return true;
+}
+
+/**
+ * Get the size of a laid out text, the same as 'lv_txt_get_size' would give it
+ * @param layout pointer to an up to date layout
+ * @param size_res pointer to a 'point_t' variable to store the result
+ * @param line_space line space of the text
+ */
+void lv_txt_layout_get_size(const lv_txt_layout_t * layout, lv_point_t * size_res, lv_coord_t line_space)
+{
+    uint8_t letter_height = lv_font_get_height(layout->font);
+    uint32_t line_cnt = layout->line_cnt;
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if(layout->txt_len != 0) {
+        char last = layout->txt[layout->txt_len - 1];
+        if(last == '\n' || last == '\r') line_cnt++;
+    }
+
+    size_res->x = layout->width;
+    if(line_cnt == 0) size_res->y = letter_height;
+    else size_res->y = line_cnt * (letter_height + line_space) - line_space;
+}
+
+/**
+ * Get the line of a laid out text a letter is in
+ * @param layout pointer to an up to date layout with at least one line
+ * @param byte_id byte index of the letter
+ * @return index of the line in 'layout->lines'
+ */
+uint16_t lv_txt_layout_get_line(const lv_txt_layout_t * layout, uint32_t byte_id)
+{
+    /*Binary search for the last line starting at or before the letter*/
+    uint16_t lo = 0;
+    uint16_t hi = layout->line_cnt - 1;
+    while(lo < hi) {
+        uint16_t mid = (lo + hi + 1) / 2;
+        if(layout->lines[mid].start <= byte_id) lo = mid;
+        else hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/**
+ * Get the byte index of the first letter after a line of a laid out text
+ * @param layout pointer to an up to date layout
+ * @param line index of the line in 'layout->lines'
+ * @return where the next line starts, or the length of the text after the last line
+ */
+uint32_t lv_txt_layout_get_line_end(const lv_txt_layout_t * layout, uint16_t line)
+{
+    return line + 1 < layout->line_cnt ? layout->lines[line + 1].start : layout->txt_len;
+}
+
+/**
+ * Free the memory of a text layout and make it empty
+ * @param layout pointer to a layout
+ */
+void lv_txt_layout_clear(lv_txt_layout_t * layout)
+{
+    if(layout->lines != NULL) lv_mem_free(layout->lines);
+    lv_txt_layout_init(layout);
+}
+
 /**
  * Check next character in a string and decide if the character is part of the command or not
  * @param state pointer to a txt_cmd_state_t variable which stores the current state of command processing
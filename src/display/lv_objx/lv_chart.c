@@ -11,6 +11,8 @@
 
 #include "display/lv_draw/lv_draw.h"
 #include "display/lv_themes/lv_theme.h"
+#include "display/lv_core/lv_refr.h"
+#include "display/lv_misc/lv_math.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +37,8 @@ static void lv_chart_draw_lines(lv_obj_t * chart, const lv_area_t * mask);
 static void lv_chart_draw_points(lv_obj_t * chart, const lv_area_t * mask);
 static void lv_chart_draw_cols(lv_obj_t * chart, const lv_area_t * mask);
 static void lv_chart_draw_vertical_lines(lv_obj_t * chart, const lv_area_t * mask);
+static uint16_t lv_chart_get_point_id(const lv_chart_ext_t * ext, const lv_chart_series_t * ser, uint16_t i);
+static void lv_chart_invalidate_point(lv_obj_t * chart, uint16_t id);
 
 /**********************
  *  STATIC VARIABLES
@@ -78,6 +82,7 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->vdiv_cnt = LV_CHART_VDIV_DEF;
     ext->point_cnt = LV_CHART_PNUM_DEF;
     ext->type = LV_CHART_TYPE_LINE;
+    ext->update_mode = LV_CHART_UPDATE_MODE_SHIFT;
     ext->series.opa = LV_OPA_COVER;
     ext->series.dark = LV_OPA_50;
     ext->series.width = 2;
@@ -103,6 +108,7 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     } else {
         lv_chart_ext_t * ext_copy = lv_obj_get_ext_attr(copy);
         ext->type = ext_copy->type;
+        ext->update_mode = ext_copy->update_mode;
         ext->ymin = ext_copy->ymin;
         ext->ymax = ext_copy->ymax;
         ext->hdiv_cnt = ext_copy->hdiv_cnt;
@@ -299,6 +305,20 @@ void lv_chart_set_point_count(lv_obj_t * chart, uint16_t point_cnt)
     lv_chart_refresh(chart);
 }
 
+/**
+ * Set how new points are added by 'lv_chart_set_next'
+ * @param chart pointer to a chart object
+ * @param mode the new update mode (from 'lv_chart_update_mode_t')
+ */
+void lv_chart_set_update_mode(lv_obj_t * chart, lv_chart_update_mode_t mode)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    if(ext->update_mode == mode) return;
+
+    ext->update_mode = mode;
+    lv_chart_refresh(chart);
+}
+
 /**
  * Set the opacity of the data series
  * @param chart pointer to a chart object
@@ -382,9 +402,15 @@ void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y)
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
 
     ser->points[ser->start_point] = y;  /*This was the place of the former left most value, after shifting it is the rightmost*/
-    ser->start_point = (ser->start_point + 1) % ext->point_cnt;
 
-    lv_chart_refresh(chart);
+    if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
+        /*The other points stay where they are so only redraw around the new one*/
+        lv_chart_invalidate_point(chart, ser->start_point);
+        ser->start_point = (ser->start_point + 1) % ext->point_cnt;
+    } else {
+        ser->start_point = (ser->start_point + 1) % ext->point_cnt;
+        lv_chart_refresh(chart);
+    }
 }
 
 /*=====================
@@ -413,6 +439,17 @@ uint16_t lv_chart_get_point_cnt(const lv_obj_t * chart)
     return ext->point_cnt;
 }
 
+/**
+ * Get how new points are added by 'lv_chart_set_next'
+ * @param chart pointer to a chart object
+ * @return the update mode (from 'lv_chart_update_mode_t')
+ */
+lv_chart_update_mode_t lv_chart_get_update_mode(const lv_obj_t * chart)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    return ext->update_mode;
+}
+
 /**
  * Get the opacity of the data series
  * @param chart pointer to chart object
@@ -626,7 +663,7 @@ static void lv_chart_draw_lines(lv_obj_t * chart, const lv_area_t * mask)
         p1.x = 0 + x_ofs;
         p2.x = 0 + x_ofs;
 
-        p_prev = ser->start_point;
+        p_prev = lv_chart_get_point_id(ext, ser, 0);
         y_tmp = (int32_t)((int32_t) ser->points[p_prev] - ext->ymin) * h;
         y_tmp = y_tmp / (ext->ymax - ext->ymin);
         p2.y = h - y_tmp + y_ofs;
@@ -637,13 +674,15 @@ static void lv_chart_draw_lines(lv_obj_t * chart, const lv_area_t * mask)
 
             p2.x = ((w * i) / (ext->point_cnt - 1)) + x_ofs;
 
-            p_act = (ser->start_point + i) % ext->point_cnt;
+            p_act = lv_chart_get_point_id(ext, ser, i);
 
             y_tmp = (int32_t)((int32_t) ser->points[p_act] - ext->ymin) * h;
             y_tmp = y_tmp / (ext->ymax - ext->ymin);
             p2.y = h - y_tmp + y_ofs;
 
-            if(ser->points[p_prev] != LV_CHART_POINT_DEF && ser->points[p_act] != LV_CHART_POINT_DEF)
+            /*In circular mode leave a gap between the newest and the oldest point*/
+            bool gap = ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR && p_act == ser->start_point;
+            if(ser->points[p_prev] != LV_CHART_POINT_DEF && ser->points[p_act] != LV_CHART_POINT_DEF && !gap)
                 lv_draw_line(&p1, &p2, mask, &style, opa_scale);
 
             p_prev = p_act;
@@ -688,7 +727,7 @@ static void lv_chart_draw_points(lv_obj_t * chart, const lv_area_t * mask)
             cir_a.x1 = ((w * i) / (ext->point_cnt - 1)) + x_ofs;
             cir_a.x2 = cir_a.x1 + style_point.body.radius;
             cir_a.x1 -= style_point.body.radius;
-            p_act = (ser->start_point + i) % ext->point_cnt;
+            p_act = lv_chart_get_point_id(ext, ser, i);
             y_tmp = (int32_t)((int32_t) ser->points[p_act] - ext->ymin) * h;
             y_tmp = y_tmp / (ext->ymax - ext->ymin);
             cir_a.y1 = h - y_tmp + y_ofs;
@@ -746,7 +785,7 @@ static void lv_chart_draw_cols(lv_obj_t * chart, const lv_area_t * mask)
             col_a.x2 = col_a.x1 + col_w;
             x_act += col_w;
 
-            lv_coord_t p_act = (ser->start_point + i) % ext->point_cnt;
+            lv_coord_t p_act = lv_chart_get_point_id(ext, ser, i);
             y_tmp = (int32_t)((int32_t) ser->points[p_act] - ext->ymin) * h;
             y_tmp = y_tmp / (ext->ymax - ext->ymin);
             col_a.y1 = h - y_tmp + chart->coords.y1;
@@ -821,4 +860,63 @@ static void lv_chart_draw_vertical_lines(lv_obj_t * chart, const lv_area_t * mas
         }
     }
 }
+
+/**
+ * Get where the i-th point from the left is stored in a series
+ * @param ext pointer to the chart's ext. data
+ * @param ser pointer to a data series of the chart
+ * @param i index of the point from the left
+ * @return index of the point in 'ser->points'
+ */
+static uint16_t lv_chart_get_point_id(const lv_chart_ext_t * ext, const lv_chart_series_t * ser, uint16_t i)
+{
+    if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) return i;
+    return (ser->start_point + i) % ext->point_cnt;
+}
+
+/**
+ * Invalidate only the part of a chart which changes when a point is set in circular mode:
+ * the lines to its neighbours, its circle and the columns at its index
+ * @param chart pointer to chart object
+ * @param id index of the point
+ */
+static void lv_chart_invalidate_point(lv_obj_t * chart, uint16_t id)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    if(ext->point_cnt < 2) {
+        lv_chart_refresh(chart);
+        return;
+    }
+    if(lv_obj_get_hidden(chart)) return;
+
+    lv_coord_t w = lv_obj_get_width(chart);
+    uint16_t prev = id > 0 ? id - 1 : 0;
+    uint16_t next = id < ext->point_cnt - 1 ? id + 1 : id;
+    lv_coord_t pad = ext->series.width + 1;
+
+    /*Lines and points are placed on 'w / (point_cnt - 1)' steps, columns on 'w / point_cnt'*/
+    lv_coord_t line_x1 = (int32_t)((int32_t) w * prev) / (ext->point_cnt - 1);
+    lv_coord_t line_x2 = (int32_t)((int32_t) w * next) / (ext->point_cnt - 1);
+    lv_coord_t col_x1 = (int32_t)((int32_t) w * id) / ext->point_cnt;
+    lv_coord_t col_x2 = (int32_t)((int32_t) w * (id + 1)) / ext->point_cnt;
+
+    lv_area_t area;
+    area.x1 = chart->coords.x1 + LV_MATH_MIN(line_x1, col_x1) - pad;
+    area.x2 = chart->coords.x1 + LV_MATH_MAX(line_x2, col_x2) + pad;
+    area.y1 = chart->coords.y1 - chart->ext_size;
+    area.y2 = chart->coords.y2 + chart->ext_size;
+
+    /*Truncate to the parents and invalidate only on a shown screen like 'lv_obj_invalidate'*/
+    lv_obj_t * scr = lv_obj_get_screen(chart);
+    if(scr != lv_scr_act() && scr != lv_layer_top() && scr != lv_layer_sys()) return;
+
+    lv_obj_t * par = lv_obj_get_parent(chart);
+    while(par != NULL) {
+        if(lv_area_intersect(&area, &area, &par->coords) == false) return;
+        if(lv_obj_get_hidden(par)) return;
+        par = lv_obj_get_parent(par);
+    }
+
+    lv_inv_area(&area);
+}
 #endif
@@ -39,6 +39,8 @@ static lv_res_t lv_label_signal(lv_obj_t * label, lv_signal_t sign, void * param
 static bool lv_label_design(lv_obj_t * label, const lv_area_t * mask, lv_design_mode_t mode);
 static void lv_label_refr_text(lv_obj_t * label);
 static void lv_label_revert_dots(lv_obj_t * label);
+static void lv_label_get_txt_size(const lv_obj_t * label, lv_point_t * size, lv_coord_t max_w, lv_txt_flag_t flag);
+static bool lv_label_update_layout(const lv_obj_t * label, lv_coord_t max_w, lv_txt_flag_t flag);
 
 #if USE_LV_ANIMATION
 static void lv_label_set_offset_x(lv_obj_t * label, lv_coord_t x);
@@ -91,6 +93,7 @@ lv_obj_t * lv_label_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->anim_speed = LV_LABEL_SCROLL_SPEED;
     ext->offset.x = 0;
     ext->offset.y = 0;
+    lv_txt_layout_init(&ext->layout);
 #if USE_LV_MULTI_LANG
     ext->lang_txt_id = LV_LANG_TXT_ID_NONE;
 #endif
@@ -464,12 +467,21 @@ void lv_label_get_letter_pos(const lv_obj_t * label, uint16_t index, lv_point_t
     index = lv_txt_encoded_get_byte_id(txt, index);
 
     /*Search the line of the index letter */;
-    while(txt[new_line_start] != '\0') {
-        new_line_start += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, max_w, flag);
-        if(index < new_line_start || txt[new_line_start] == '\0') break; /*The line of 'index' letter begins at 'line_start'*/
+    if(lv_label_update_layout(label, max_w, flag)) {
+        if(ext->layout.line_cnt != 0) {
+            uint16_t line_id = lv_txt_layout_get_line(&ext->layout, index);
+            line_start = ext->layout.lines[line_id].start;
+            new_line_start = lv_txt_layout_get_line_end(&ext->layout, line_id);
+            y = line_id * (letter_height + style->text.line_space);
+        }
+    } else {
+        while(txt[new_line_start] != '\0') {
+            new_line_start += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, max_w, flag);
+            if(index < new_line_start || txt[new_line_start] == '\0') break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + style->text.line_space;
-        line_start = new_line_start;
+            y += letter_height + style->text.line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -533,13 +545,27 @@ uint16_t lv_label_get_letter_on(const lv_obj_t * label, lv_point_t * pos)
     }
 
     /*Search the line of the index letter */;
-    while(txt[line_start] != '\0') {
-        new_line_start += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, max_w, flag);
+    lv_coord_t line_height = letter_height + style->text.line_space;
+    if(line_height > 0 && lv_label_update_layout(label, max_w, flag)) {
+        /*The first line whose bottom is not above the point, or after the last line if there is none*/
+        uint32_t line_id = 0;
+        if(pos->y > letter_height) line_id = (pos->y - letter_height + line_height - 1) / line_height;
+        if(line_id < ext->layout.line_cnt) {
+            line_start = ext->layout.lines[line_id].start;
+            new_line_start = lv_txt_layout_get_line_end(&ext->layout, line_id);
+        } else {
+            line_start = ext->layout.txt_len;
+            new_line_start = line_start;
+        }
+    } else {
+        while(txt[line_start] != '\0') {
+            new_line_start += lv_txt_get_next_line(&txt[line_start], font, style->text.letter_space, max_w, flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + style->text.line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + style->text.line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     /*Calculate the x coordinate*/
@@ -701,14 +727,14 @@ static bool lv_label_design(lv_obj_t * label, const lv_area_t * mask, lv_design_
         if((ext->long_mode == LV_LABEL_LONG_ROLL) &&
                 (ext->align == LV_LABEL_ALIGN_CENTER || ext->align == LV_LABEL_ALIGN_RIGHT)) {
             lv_point_t size;
-            lv_txt_get_size(&size, ext->text, style->text.font, style->text.letter_space, style->text.line_space, LV_COORD_MAX, flag);
+            lv_label_get_txt_size(label, &size, LV_COORD_MAX, flag);
             if(size.x > lv_obj_get_width(label)) {
                 flag &= ~LV_TXT_FLAG_RIGHT;
                 flag &= ~LV_TXT_FLAG_CENTER;
             }
         }
 
-        lv_draw_label(&coords, mask, style, opa_scale, ext->text, flag, &ext->offset);
+        lv_draw_label_layout(&coords, mask, style, opa_scale, ext->text, flag, &ext->offset, &ext->layout);
     }
     return true;
 }
@@ -736,6 +762,7 @@ static lv_res_t lv_label_signal(lv_obj_t * label, lv_signal_t sign, void * param
             lv_mem_free(ext->text);
             ext->text = NULL;
         }
+        lv_txt_layout_clear(&ext->layout);
     } else if(sign == LV_SIGNAL_STYLE_CHG) {
         /*Revert dots for proper refresh*/
         lv_label_revert_dots(label);
@@ -801,7 +828,7 @@ static void lv_label_refr_text(lv_obj_t * label)
     lv_txt_flag_t flag = LV_TXT_FLAG_NONE;
     if(ext->recolor != 0) flag |= LV_TXT_FLAG_RECOLOR;
     if(ext->expand != 0) flag |= LV_TXT_FLAG_EXPAND;
-    lv_txt_get_size(&size, ext->text, font, style->text.letter_space, style->text.line_space, max_w, flag);
+    lv_label_get_txt_size(label, &size, max_w, flag);
 
     /*Set the full size in expand mode*/
     if(ext->long_mode == LV_LABEL_LONG_EXPAND || ext->long_mode == LV_LABEL_LONG_SCROLL) {
@@ -969,6 +996,38 @@ static void lv_label_revert_dots(lv_obj_t * label)
     ext->dot_end = LV_LABEL_DOT_END_INV;
 }
 
+/**
+ * Lay out the label's text, unless it's laid out with these settings already
+ * @param label pointer to a label object
+ * @param max_w max with of the text
+ * @param flag settings for the text from 'txt_flag_t' enum
+ * @return true: 'ext->layout' is up to date, false: there wasn't enough memory for it
+ */
+static bool lv_label_update_layout(const lv_obj_t * label, lv_coord_t max_w, lv_txt_flag_t flag)
+{
+    lv_label_ext_t * ext = lv_obj_get_ext_attr(label);
+    lv_style_t * style = lv_obj_get_style(label);
+    return lv_txt_layout_update(&ext->layout, ext->text, style->text.font, style->text.letter_space, max_w, flag);
+}
+
+/**
+ * Get the size of the label's text like 'lv_txt_get_size', from its layout if possible
+ * @param label pointer to a label object
+ * @param size store the result here
+ * @param max_w max with of the text
+ * @param flag settings for the text from 'txt_flag_t' enum
+ */
+static void lv_label_get_txt_size(const lv_obj_t * label, lv_point_t * size, lv_coord_t max_w, lv_txt_flag_t flag)
+{
+    lv_label_ext_t * ext = lv_obj_get_ext_attr(label);
+    lv_style_t * style = lv_obj_get_style(label);
+    if(lv_label_update_layout(label, max_w, flag)) {
+        lv_txt_layout_get_size(&ext->layout, size, style->text.line_space);
+    } else {
+        lv_txt_get_size(size, ext->text, style->text.font, style->text.letter_space, style->text.line_space, max_w, flag);
+    }
+}
+
 #if USE_LV_ANIMATION
 static void lv_label_set_offset_x(lv_obj_t * label, lv_coord_t x)
 {
@@ -39,6 +39,10 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param);
 static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * param);
 static void refr_btn_width(lv_obj_t * list);
 static void lv_list_btn_single_selected(lv_obj_t *btn);
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param);
+static void virt_free(lv_obj_t * list);
+static void virt_refr(lv_obj_t * list, bool all);
+static void virt_refr_pool(lv_obj_t * list);
 
 /**********************
  *  STATIC VARIABLES
@@ -49,6 +53,7 @@ static lv_signal_func_t img_signal;
 static lv_signal_func_t label_signal;
 static lv_signal_func_t ancestor_page_signal;
 static lv_signal_func_t ancestor_btn_signal;
+static lv_signal_func_t ancestor_scrl_signal;
 #if USE_LV_GROUP
 /*Used to make the last clicked button pressed (selected) when the list become focused and `click_focus == 1`*/
 static lv_obj_t * last_clicked_btn;
@@ -92,6 +97,12 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->anim_time = LV_LIST_FOCUS_TIME;
     ext->single_mode = false;
     ext->size = 0;
+    ext->item_cb = NULL;
+    ext->virt_btns = NULL;
+    ext->virt_items = NULL;
+    ext->virt_btn_cnt = 0;
+    ext->item_h = 0;
+    ext->virt_action = NULL;
     
 #if USE_LV_GROUP
     ext->last_sel = NULL;
@@ -158,6 +169,7 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
  */
 void lv_list_clean(lv_obj_t * obj)
 {
+    virt_free(obj);     /*A virtual list becomes a normal one*/
     lv_obj_t * scrl = lv_page_get_scrl(obj);
     lv_obj_clean(scrl);
     lv_list_ext_t * ext = lv_obj_get_ext_attr(obj);
@@ -180,6 +192,10 @@ lv_obj_t * lv_list_add(lv_obj_t * list, const void * img_src, const char * txt,
 {
     lv_style_t * style = lv_obj_get_style(list);
     lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->item_cb != NULL) {
+        LV_LOG_WARN("lv_list_add: can't add buttons to a virtual list");
+        return NULL;
+    }
     ext->size ++;
     /*Create a list element with the image an the text*/
     lv_obj_t * liste;
@@ -251,7 +267,7 @@ lv_obj_t * lv_list_add(lv_obj_t * list, const void * img_src, const char * txt,
 bool lv_list_remove(const lv_obj_t * list, uint32_t index)
 {
     lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
-    if(index >= ext->size) return false;
+    if(index >= ext->size || ext->item_cb != NULL) return false;
     uint32_t count = 0;
     lv_obj_t * e = lv_list_get_next_btn(list, NULL);
     while(e != NULL) {
@@ -266,6 +282,68 @@ bool lv_list_remove(const lv_obj_t * list, uint32_t index)
     return false;
 }
 
+/**
+ * Make a list virtual: instead of a button for every item it only has buttons for the items in view,
+ * which are recycled for the next items while it's scrolled, so memory and scrolling don't depend on the item count.
+ * `item_cb` fills in a button whenever it starts showing another item, and `lv_list_get_btn_index` tells
+ * which item a button shows, e.g. in `rel_action`. Any buttons added before are deleted.
+ * The buttons' states are not kept per item, so in single mode `item_cb` should set them.
+ * The height of the items times their count must fit in `lv_coord_t`.
+ * @param list pointer to a list object
+ * @param item_cnt number of items
+ * @param item_h height of every item
+ * @param item_cb function to fill in the button of an item
+ * @param rel_action pointer to release action function of the buttons (like with lv_btn)
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t item_cnt, lv_coord_t item_h, lv_list_item_cb_t item_cb,
+                         lv_action_t rel_action)
+{
+    if(item_cb == NULL || item_h <= 0) {
+        LV_LOG_WARN("lv_list_set_virtual: invalid item callback or height");
+        return;
+    }
+
+    lv_list_clean(list);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrl(list);
+    if(ancestor_scrl_signal == NULL) ancestor_scrl_signal = lv_obj_get_signal_func(scrl);
+    lv_obj_set_signal_func(scrl, lv_list_scrl_signal);
+
+    /*The buttons are placed by `virt_refr` instead of the layout*/
+    lv_page_set_scrl_layout(list, LV_LAYOUT_OFF);
+    lv_page_set_scrl_fit(list, false, false);
+
+    ext->item_h = item_h;
+    ext->virt_action = rel_action;
+    ext->item_cb = item_cb;
+
+    virt_refr_pool(list);
+    lv_list_set_virtual_size(list, item_cnt);
+}
+
+/**
+ * Change the number of items of a virtual list, and fill in every visible button again as their items might have changed
+ * @param list pointer to a list object in virtual mode
+ * @param item_cnt number of items
+ */
+void lv_list_set_virtual_size(lv_obj_t * list, uint32_t item_cnt)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->item_cb == NULL) return;
+
+    ext->size = item_cnt;
+
+    lv_style_t * style = lv_list_get_style(list, LV_LIST_STYLE_BG);
+    lv_style_t * style_scrl = lv_obj_get_style(lv_page_get_scrl(list));
+    lv_page_set_scrl_width(list, lv_obj_get_width(list) - 2 * style->body.padding.hor);
+    lv_coord_t h = 2 * style_scrl->body.padding.ver;
+    if(item_cnt > 0) h += item_cnt * (ext->item_h + style_scrl->body.padding.inner) - style_scrl->body.padding.inner;
+    lv_page_set_scrl_height(list, h);   /*Scrolls it back in range too*/
+
+    virt_refr(list, true);
+}
+
 /*=====================
  * Setter functions
  *====================*/
@@ -523,6 +601,15 @@ int32_t lv_list_get_btn_index(const lv_obj_t * list, const lv_obj_t * btn)
         /* no list provided, assuming btn is part of a list */
         list = lv_obj_get_parent(lv_obj_get_parent(btn));
     }
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->item_cb != NULL) {
+        /*The index of the item the button shows*/
+        uint16_t i;
+        for(i = 0; i < ext->virt_btn_cnt; i++) {
+            if(ext->virt_btns[i] == btn) return ext->virt_items[i] == UINT32_MAX ? -1 : (int32_t)ext->virt_items[i];
+        }
+        return -1;
+    }
     lv_obj_t * e = lv_list_get_next_btn(list, NULL);
     while(e != NULL) {
         if(e == btn) {
@@ -537,7 +624,7 @@ int32_t lv_list_get_btn_index(const lv_obj_t * list, const lv_obj_t * btn)
 /**
  * Get the number of buttons in the list
  * @param list pointer to a list object
- * @return the number of buttons in the list
+ * @return the number of buttons in the list (or of items in virtual mode)
  */
 uint32_t lv_list_get_size(const lv_obj_t * list)
 {
@@ -749,9 +836,26 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
         if(w != lv_area_get_width(param)) {   /*Width changed*/
             refr_btn_width(list);
         }
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->item_cb != NULL && (w != lv_area_get_width(param) || lv_obj_get_height(list) != lv_area_get_height(param))) {
+            /*More or fewer buttons might be in view*/
+            virt_refr_pool(list);
+            lv_list_set_virtual_size(list, ext->size);
+        }
     } else if(sign == LV_SIGNAL_STYLE_CHG) {
         /*Because of the possible change of horizontal and vertical padding refresh buttons width */
         refr_btn_width(list);
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->item_cb != NULL) lv_list_set_virtual_size(list, ext->size);
+    } else if(sign == LV_SIGNAL_CLEANUP) {
+        /*The buttons are already deleted*/
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        lv_mem_free(ext->virt_btns);
+        lv_mem_free(ext->virt_items);
+        ext->virt_btns = NULL;
+        ext->virt_items = NULL;
+        ext->virt_btn_cnt = 0;
+        ext->item_cb = NULL;
     } else if(sign == LV_SIGNAL_FOCUS) {
 
 #if USE_LV_GROUP
@@ -969,4 +1073,148 @@ static void lv_list_btn_single_selected(lv_obj_t *btn)
     } while (e != NULL);
 }
 
+/**
+ * Signal function of the scrollable part of a virtual list
+ * @param scrl pointer to the scrollable object
+ * @param sign a signal type from lv_signal_t enum
+ * @param param pointer to a signal specific variable
+ * @return LV_RES_OK: the object is not deleted in the function; LV_RES_INV: the object is deleted
+ */
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param)
+{
+    lv_res_t res;
+
+    /* Include the ancient signal function */
+    res = ancestor_scrl_signal(scrl, sign, param);
+    if(res != LV_RES_OK) return res;
+
+    /*Show the items which were scrolled into view*/
+    if(sign == LV_SIGNAL_CORD_CHG) virt_refr(lv_obj_get_parent(scrl), false);
+
+    return res;
+}
+
+/**
+ * Make a virtual list a normal one again, deleting its buttons
+ * @param list pointer to a list object
+ */
+static void virt_free(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->item_cb == NULL) return;
+
+    ext->item_cb = NULL;
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        lv_obj_del(ext->virt_btns[i]);
+    }
+    lv_mem_free(ext->virt_btns);
+    lv_mem_free(ext->virt_items);
+    ext->virt_btns = NULL;
+    ext->virt_items = NULL;
+    ext->virt_btn_cnt = 0;
+    ext->size = 0;
+
+    lv_obj_t * scrl = lv_page_get_scrl(list);
+    lv_obj_set_signal_func(scrl, ancestor_scrl_signal);
+    lv_page_set_scrl_fit(list, false, true);
+    lv_page_set_scrl_layout(list, LV_LIST_LAYOUT_DEF);
+}
+
+/**
+ * Make a virtual list have enough buttons to fill its height
+ * @param list pointer to a list object in virtual mode
+ */
+static void virt_refr_pool(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_style_t * style_scrl = lv_obj_get_style(lv_page_get_scrl(list));
+
+    /*However it's scrolled, this many items can be at least partly in view*/
+    lv_coord_t pitch = ext->item_h + style_scrl->body.padding.inner;
+    if(pitch <= 0) pitch = 1;
+    uint16_t btn_cnt = lv_obj_get_height(list) / pitch + 2;
+    if(btn_cnt == ext->virt_btn_cnt) return;
+
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        lv_obj_del(ext->virt_btns[i]);
+    }
+    lv_mem_free(ext->virt_btns);
+    lv_mem_free(ext->virt_items);
+    ext->virt_btn_cnt = 0;
+
+    ext->virt_btns = lv_mem_alloc(btn_cnt * sizeof(lv_obj_t *));
+    ext->virt_items = lv_mem_alloc(btn_cnt * sizeof(uint32_t));
+    lv_mem_assert(ext->virt_btns);
+    lv_mem_assert(ext->virt_items);
+    if(ext->virt_btns == NULL || ext->virt_items == NULL) {
+        lv_mem_free(ext->virt_btns);
+        lv_mem_free(ext->virt_items);
+        ext->virt_btns = NULL;
+        ext->virt_items = NULL;
+        return;
+    }
+
+    /*Add them like normal buttons, without counting them as items*/
+    lv_list_item_cb_t item_cb = ext->item_cb;
+    uint32_t size = ext->size;
+    ext->item_cb = NULL;
+    for(i = 0; i < btn_cnt; i++) {
+        lv_obj_t * btn = lv_list_add(list, NULL, "", ext->virt_action);
+        if(btn == NULL) break;
+        lv_btn_set_fit(btn, false, false);
+        lv_obj_set_height(btn, ext->item_h);
+        lv_obj_set_hidden(btn, true);
+        ext->virt_btns[i] = btn;
+        ext->virt_items[i] = UINT32_MAX;
+    }
+    ext->virt_btn_cnt = i;
+    ext->item_cb = item_cb;
+    ext->size = size;
+}
+
+/**
+ * Move the buttons of a virtual list to the items in view, and fill them in
+ * @param list pointer to a list object
+ * @param all true: fill in every button again, false: only the ones which show another item
+ */
+static void virt_refr(lv_obj_t * list, bool all)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    uint16_t cnt = ext->virt_btn_cnt;
+    if(ext->item_cb == NULL || cnt == 0) return;
+
+    lv_obj_t * scrl = lv_page_get_scrl(list);
+    lv_style_t * style_scrl = lv_obj_get_style(scrl);
+    lv_coord_t pitch = ext->item_h + style_scrl->body.padding.inner;
+    if(pitch <= 0) pitch = 1;
+
+    /*The scrollable is moved up by the amount scrolled*/
+    lv_coord_t scrolled = -lv_obj_get_y(scrl) - style_scrl->body.padding.ver;
+    uint32_t first = scrolled > 0 ? scrolled / pitch : 0;
+
+    uint16_t i;
+    for(i = 0; i < cnt; i++) {
+        /*Item `n` always goes on button `n % cnt`, so scrolling by one item only moves one button*/
+        uint32_t item = first + (i + cnt - first % cnt) % cnt;
+        lv_obj_t * btn = ext->virt_btns[i];
+
+        if(item >= ext->size) {
+            if(ext->virt_items[i] != UINT32_MAX) {
+                ext->virt_items[i] = UINT32_MAX;
+                lv_obj_set_hidden(btn, true);
+            }
+            continue;
+        }
+
+        if(all || ext->virt_items[i] != item) {
+            ext->virt_items[i] = item;
+            lv_obj_set_pos(btn, style_scrl->body.padding.hor, style_scrl->body.padding.ver + item * pitch);
+            lv_obj_set_hidden(btn, false);
+            ext->item_cb(list, btn, item);
+        }
+    }
+}
+
 #endif
@@ -29,6 +29,10 @@ static bool lv_table_design(lv_obj_t * table, const lv_area_t * mask, lv_design_
 static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param);
 static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id);
 static void refr_size(lv_obj_t * table);
+static void free_cells(lv_obj_t * table);
+static lv_coord_t get_virt_row_height(lv_obj_t * table);
+static const char * get_virt_cell(lv_obj_t * table, uint16_t row, uint16_t col, lv_table_cell_format_t * format);
+static void draw_virt(lv_obj_t * table, const lv_area_t * mask);
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +78,7 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->cell_style[3] = &lv_style_plain;
     ext->col_cnt = 0;
     ext->row_cnt = 0;
+    ext->cell_cb = NULL;
 
     uint16_t i;
     for(i = 0; i < LV_TABLE_COL_MAX; i++) {
@@ -131,7 +136,7 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
 void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const char * txt)
 {
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-    if(row >= ext->row_cnt || col >= ext->col_cnt) {
+    if(row >= ext->row_cnt || col >= ext->col_cnt || ext->cell_cb != NULL) {
         LV_LOG_WARN("lv_table_set_cell_value: invalid row or column");
         return;
     }
@@ -168,7 +173,10 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt)
     uint16_t old_row_cnt = ext->row_cnt;
     ext->row_cnt = row_cnt;
 
-    if(ext->row_cnt > 0 && ext->col_cnt > 0) {
+    if(ext->cell_cb != NULL) {
+        /*Virtual tables don't store their cells*/
+    }
+    else if(ext->row_cnt > 0 && ext->col_cnt > 0) {
         ext->cell_data = lv_mem_realloc(ext->cell_data, ext->row_cnt * ext->col_cnt * sizeof(char*));
 
         /*Initilize the new fields*/
@@ -186,6 +194,29 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt)
     refr_size(table);
 }
 
+/**
+ * Make a table virtual: it stores no cells and gets only the ones it draws from `cell_cb`,
+ * so drawing and memory don't depend on the number of rows.
+ * All the rows are one line high, the cells can't be merged, and their values and formats can't be set.
+ * `lv_table_set_row_cnt` changes the number of rows, and `lv_obj_invalidate` redraws changed cells.
+ * The height of all the rows must still fit in `lv_coord_t`.
+ * @param table pointer to a Table object
+ * @param row_cnt number of rows
+ * @param cell_cb function giving the cells, or NULL to make the table normal again with empty cells
+ */
+void lv_table_set_virtual(lv_obj_t * table, uint16_t row_cnt, lv_table_cell_cb_t cell_cb)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    free_cells(table);
+    lv_mem_free(ext->cell_data);
+    ext->cell_data = NULL;
+    ext->cell_cb = cell_cb;
+    ext->row_cnt = 0;
+
+    /*Allocates empty cells if it isn't virtual*/
+    lv_table_set_row_cnt(table, row_cnt);
+}
+
 /**
  * Set the number of columns
  * @param table table pointer to a Table object
@@ -203,7 +234,10 @@ void lv_table_set_col_cnt(lv_obj_t * table, uint16_t col_cnt)
     uint16_t old_col_cnt = ext->col_cnt;
     ext->col_cnt = col_cnt;
 
-    if(ext->row_cnt > 0 && ext->col_cnt > 0) {
+    if(ext->cell_cb != NULL) {
+        /*Virtual tables don't store their cells*/
+    }
+    else if(ext->row_cnt > 0 && ext->col_cnt > 0) {
         ext->cell_data = lv_mem_realloc(ext->cell_data, ext->row_cnt * ext->col_cnt * sizeof(char*));
         /*Initilize the new fields*/
         if(old_col_cnt < col_cnt) {
@@ -248,7 +282,7 @@ void lv_table_set_col_width(lv_obj_t * table, uint16_t col_id, lv_coord_t w)
 void lv_table_set_cell_align(lv_obj_t * table, uint16_t row, uint16_t col, lv_label_align_t align)
 {
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-     if(row >= ext->row_cnt || col >= ext->col_cnt) {
+     if(row >= ext->row_cnt || col >= ext->col_cnt || ext->cell_cb != NULL) {
          LV_LOG_WARN("lv_table_set_cell_align: invalid row or column");
          return;
      }
@@ -276,7 +310,7 @@ void lv_table_set_cell_align(lv_obj_t * table, uint16_t row, uint16_t col, lv_la
 void lv_table_set_cell_type(lv_obj_t * table, uint16_t row, uint16_t col, uint8_t type)
 {
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-     if(row >= ext->row_cnt || col >= ext->col_cnt) {
+     if(row >= ext->row_cnt || col >= ext->col_cnt || ext->cell_cb != NULL) {
          LV_LOG_WARN("lv_table_set_cell_type: invalid row or column");
          return;
      }
@@ -307,7 +341,7 @@ void lv_table_set_cell_type(lv_obj_t * table, uint16_t row, uint16_t col, uint8_
 void lv_table_set_cell_crop(lv_obj_t * table, uint16_t row, uint16_t col, bool crop)
 {
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-     if(row >= ext->row_cnt || col >= ext->col_cnt) {
+     if(row >= ext->row_cnt || col >= ext->col_cnt || ext->cell_cb != NULL) {
          LV_LOG_WARN("lv_table_set_cell_crop: invalid row or column");
          return;
      }
@@ -336,7 +370,7 @@ void lv_table_set_cell_crop(lv_obj_t * table, uint16_t row, uint16_t col, bool c
 void lv_table_set_cell_merge_right(lv_obj_t * table, uint16_t row, uint16_t col, bool en)
 {
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-    if(row >= ext->row_cnt || col >= ext->col_cnt) {
+    if(row >= ext->row_cnt || col >= ext->col_cnt || ext->cell_cb != NULL) {
         LV_LOG_WARN("lv_table_set_cell_merge_right: invalid row or column");
         return;
     }
@@ -408,6 +442,11 @@ const char * lv_table_get_cell_value(lv_obj_t * table, uint16_t row, uint16_t co
         LV_LOG_WARN("lv_table_set_cell_value: invalid row or column");
         return "";
     }
+    if(ext->cell_cb != NULL) {
+        lv_table_cell_format_t format;
+        const char * txt = get_virt_cell(table, row, col, &format);
+        return txt != NULL ? txt : "";
+    }
     uint32_t cell = row * ext->col_cnt + col;
 
     if(ext->cell_data[cell] == NULL) return "";
@@ -468,6 +507,11 @@ lv_label_align_t lv_table_get_cell_align(lv_obj_t * table, uint16_t row, uint16_
          LV_LOG_WARN("lv_table_set_cell_align: invalid row or column");
          return LV_LABEL_ALIGN_LEFT;    /*Just return with something*/
      }
+     if(ext->cell_cb != NULL) {
+         lv_table_cell_format_t format;
+         get_virt_cell(table, row, col, &format);
+         return format.align;
+     }
      uint32_t cell = row * ext->col_cnt + col;
 
      if(ext->cell_data[cell] == NULL) return LV_LABEL_ALIGN_LEFT;    /*Just return with something*/
@@ -492,6 +536,11 @@ lv_label_align_t lv_table_get_cell_type(lv_obj_t * table, uint16_t row, uint16_t
          LV_LOG_WARN("lv_table_get_cell_type: invalid row or column");
          return 1;    /*Just return with something*/
      }
+     if(ext->cell_cb != NULL) {
+         lv_table_cell_format_t format;
+         get_virt_cell(table, row, col, &format);
+         return format.type + 1;
+     }
      uint32_t cell = row * ext->col_cnt + col;
 
      if(ext->cell_data[cell] == NULL) return 1;    /*Just return with something*/
@@ -516,6 +565,7 @@ lv_label_align_t lv_table_get_cell_crop(lv_obj_t * table, uint16_t row, uint16_t
          LV_LOG_WARN("lv_table_get_cell_crop: invalid row or column");
          return false;    /*Just return with something*/
      }
+     if(ext->cell_cb != NULL) return true;     /*Virtual cells are always cropped*/
      uint32_t cell = row * ext->col_cnt + col;
 
      if(ext->cell_data[cell] == NULL) return false;    /*Just return with something*/
@@ -541,6 +591,7 @@ bool lv_table_get_cell_merge_right(lv_obj_t * table, uint16_t row, uint16_t col)
         return false;
     }
 
+    if(ext->cell_cb != NULL) return false;
     uint32_t cell = row * ext->col_cnt + col;
 
     if(ext->cell_data[cell] == NULL) return false;
@@ -610,6 +661,10 @@ static bool lv_table_design(lv_obj_t * table, const lv_area_t * mask, lv_design_
         ancestor_scrl_design(table, mask, mode);
 
         lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+        if(ext->cell_cb != NULL) {
+            draw_virt(table, mask);
+            return true;
+        }
         lv_style_t * bg_style = lv_obj_get_style(table);
         lv_style_t * cell_style;
         lv_coord_t h_row;
@@ -755,14 +810,7 @@ static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param
 
     if(sign == LV_SIGNAL_CLEANUP) {
         /*Free the cell texts*/
-        lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-        uint16_t cell;
-        for(cell = 0; cell < ext->col_cnt * ext->row_cnt; cell++) {
-            if(ext->cell_data[cell]) {
-                lv_mem_free(ext->cell_data[cell]);
-                ext->cell_data[cell] = NULL;
-            }
-        }
+        free_cells(table);
     } else if(sign == LV_SIGNAL_GET_TYPE) {
         lv_obj_type_t * buf = param;
         uint8_t i;
@@ -786,8 +834,12 @@ static void refr_size(lv_obj_t * table)
     for(i= 0; i < ext->col_cnt; i++) {
         w += ext->col_w[i];
     }
-    for(i= 0; i < ext->row_cnt; i++) {
-        h += get_row_height(table, i);
+    if(ext->cell_cb != NULL) {
+        h = ext->row_cnt * get_virt_row_height(table);
+    } else {
+        for(i= 0; i < ext->row_cnt; i++) {
+            h += get_row_height(table, i);
+        }
     }
 
     lv_style_t * bg_style = lv_obj_get_style(table);
@@ -853,4 +905,120 @@ static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id)
     return h_max;
 }
 
+/**
+ * Free the texts of the cells
+ * @param table pointer to a table object
+ */
+static void free_cells(lv_obj_t * table)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    if(ext->cell_data == NULL) return;
+
+    uint32_t cell;
+    for(cell = 0; cell < (uint32_t)ext->col_cnt * ext->row_cnt; cell++) {
+        if(ext->cell_data[cell]) {
+            lv_mem_free(ext->cell_data[cell]);
+            ext->cell_data[cell] = NULL;
+        }
+    }
+}
+
+/**
+ * Get the height of every row of a virtual table
+ * @param table pointer to a table object in virtual mode
+ * @return one line of the tallest cell style
+ */
+static lv_coord_t get_virt_row_height(lv_obj_t * table)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    lv_coord_t h_max = 0;
+    uint8_t i;
+    for(i = 0; i < LV_TABLE_CELL_STYLE_CNT; i++) {
+        lv_style_t * cell_style = ext->cell_style[i];
+        h_max = LV_MATH_MAX(lv_font_get_height(cell_style->text.font) + 2 * cell_style->body.padding.ver, h_max);
+    }
+
+    return h_max;
+}
+
+/**
+ * Get a cell of a virtual table from its callback
+ * @param table pointer to a table object in virtual mode
+ * @param row id of the row
+ * @param col id of the column
+ * @param format store the cell's format here
+ * @return text of the cell (NULL if empty)
+ */
+static const char * get_virt_cell(lv_obj_t * table, uint16_t row, uint16_t col, lv_table_cell_format_t * format)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    format->format_byte = 0;
+    format->align = LV_LABEL_ALIGN_LEFT;
+    format->type = 0;
+    format->crop = 1;
+
+    const char * txt = ext->cell_cb(table, row, col, format);
+
+    /*Not supported by virtual tables*/
+    format->right_merge = 0;
+    format->crop = 1;
+    return txt;
+}
+
+/**
+ * Draw the rows of a virtual table which are in the mask
+ * @param table pointer to a table object in virtual mode
+ * @param mask the object will be drawn only in this area
+ */
+static void draw_virt(lv_obj_t * table, const lv_area_t * mask)
+{
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    lv_style_t * bg_style = lv_obj_get_style(table);
+    lv_opa_t opa_scale = lv_obj_get_opa_scale(table);
+    lv_coord_t h_row = get_virt_row_height(table);
+    if(h_row <= 0) return;
+
+    /*Start with the first row in the mask instead of going through the ones above it*/
+    lv_coord_t y_start = table->coords.y1 + bg_style->body.padding.ver;
+    uint32_t row = mask->y1 > y_start ? (mask->y1 - y_start) / h_row : 0;
+
+    lv_area_t cell_area;
+    lv_area_t txt_area;
+    for(; row < ext->row_cnt; row++) {
+        cell_area.y1 = y_start + row * h_row;
+        if(cell_area.y1 > mask->y2) break;
+        cell_area.y2 = cell_area.y1 + h_row;
+
+        cell_area.x2 = table->coords.x1 + bg_style->body.padding.hor;
+
+        uint16_t col;
+        for(col = 0; col < ext->col_cnt; col++) {
+            lv_table_cell_format_t format;
+            const char * txt = get_virt_cell(table, row, col, &format);
+            lv_style_t * cell_style = ext->cell_style[format.type];
+
+            cell_area.x1 = cell_area.x2;
+            cell_area.x2 = cell_area.x1 + ext->col_w[col];
+
+            lv_draw_rect(&cell_area, mask, cell_style, opa_scale);
+
+            if(txt == NULL) continue;
+
+            txt_area.x1 = cell_area.x1 + cell_style->body.padding.hor;
+            txt_area.x2 = cell_area.x2 - cell_style->body.padding.hor;
+            txt_area.y1 = cell_area.y1 + cell_style->body.padding.ver;
+            txt_area.y2 = cell_area.y2 - cell_style->body.padding.ver;
+
+            lv_txt_flag_t txt_flags = LV_TXT_FLAG_EXPAND;
+            if(format.align == LV_LABEL_ALIGN_RIGHT) txt_flags |= LV_TXT_FLAG_RIGHT;
+            else if(format.align == LV_LABEL_ALIGN_CENTER) txt_flags |= LV_TXT_FLAG_CENTER;
+
+            lv_area_t label_mask;
+            if(lv_area_intersect(&label_mask, mask, &cell_area)) {
+                lv_draw_label(&txt_area, &label_mask, cell_style, opa_scale, txt, txt_flags, NULL);
+            }
+        }
+    }
+}
+
 #endif
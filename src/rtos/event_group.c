@@ -0,0 +1,113 @@
+/**
+ * \file rtos/event_group.c
+ *
+ * Event groups.
+ *
+ * An event group is a word of bits and a short table of the tasks blocked on
+ * it. Waiting tasks block on their task notification, and setting bits
+ * notifies every task in the table, each of which checks whether the bits it
+ * waits for are there yet. The bits and the table are only changed with the
+ * scheduler suspended.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+
+typedef struct event_group_s {
+	volatile uint32_t bits;
+	task_t waiters[EVENT_GROUP_MAX_WAITERS];
+} event_group_s_t;
+
+_Static_assert(sizeof(event_group_s_t) == EVENT_GROUP_STORAGE_SIZE, "EVENT_GROUP_STORAGE_SIZE is out of date");
+
+event_group_t event_group_create_static(void* storage) {
+	if (storage == NULL || (uintptr_t)storage % 4) {
+		errno = EINVAL;
+		return NULL;
+	}
+	event_group_s_t* group = storage;
+	*group = (event_group_s_t){0};
+	return group;
+}
+
+event_group_t event_group_create(void) {
+	event_group_s_t* group = kmalloc(sizeof(*group));
+	if (group == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	return event_group_create_static(group);
+}
+
+void event_group_delete(event_group_t group) {
+	kfree(group);
+}
+
+uint32_t event_group_set(event_group_t group, uint32_t bits) {
+	event_group_s_t* const g = group;
+	rtos_suspend_all();
+	uint32_t result = g->bits |= bits;
+	for (size_t i = 0; i < EVENT_GROUP_MAX_WAITERS; i++) {
+		if (g->waiters[i] != NULL) task_notify(g->waiters[i]);
+	}
+	rtos_resume_all();
+	return result;
+}
+
+uint32_t event_group_clear(event_group_t group, uint32_t bits) {
+	event_group_s_t* const g = group;
+	rtos_suspend_all();
+	uint32_t result = g->bits;
+	g->bits = result & ~bits;
+	rtos_resume_all();
+	return result;
+}
+
+uint32_t event_group_get(event_group_t group) {
+	return ((event_group_s_t*)group)->bits;
+}
+
+uint32_t event_group_wait(event_group_t group, uint32_t bits, bool wait_for_all, bool clear_on_exit,
+                          uint32_t timeout) {
+	event_group_s_t* const g = group;
+	task_t self = task_get_current();
+	size_t slot = EVENT_GROUP_MAX_WAITERS;
+	uint32_t start = millis();
+	uint32_t result;
+	while (true) {
+		rtos_suspend_all();
+		result = g->bits;
+		bool done = wait_for_all ? (result & bits) == bits : (result & bits) != 0;
+		if (done && clear_on_exit) g->bits = result & ~bits;
+		// register before giving up the scheduler so a set() from now on leaves a
+		// notification pending
+		if (!done && slot == EVENT_GROUP_MAX_WAITERS) {
+			for (slot = 0; slot < EVENT_GROUP_MAX_WAITERS && g->waiters[slot] != NULL; slot++)
+				;
+			if (slot < EVENT_GROUP_MAX_WAITERS) g->waiters[slot] = self;
+		}
+		rtos_resume_all();
+		if (done || slot == EVENT_GROUP_MAX_WAITERS) break;
+		uint32_t wait_time = TIMEOUT_MAX;
+		if (timeout != TIMEOUT_MAX) {
+			uint32_t elapsed = millis() - start;
+			if (elapsed >= timeout) break;
+			wait_time = timeout - elapsed;
+		}
+		task_notify_take(true, wait_time);
+	}
+	if (slot < EVENT_GROUP_MAX_WAITERS) {
+		rtos_suspend_all();
+		g->waiters[slot] = NULL;
+		rtos_resume_all();
+	}
+	return result;
+}
@@ -0,0 +1,342 @@
+/**
+ * \file rtos/gthread.c
+ *
+ * The gthreads backend of libstdc++, see pros/gthr-pros.h
+ *
+ * A thread started by gthread_create() is a task with a gthread_s_t behind one
+ * of its thread local storage pointers. The task and the std::thread each hold
+ * a reference to it, so whichever of join()/detach() and the end of the task
+ * comes last frees it. Tasks which weren't started this way only get one when
+ * they set a key, and it's freed when they're deleted.
+ *
+ * Mutexes keep a hybrid mutex in their own storage, and condition variables
+ * are lists of waiters on the waiting tasks' stacks. Both lists and the lazy
+ * setup of mutexes are only changed with the scheduler suspended.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "pros/gthr-pros.h"
+#include "system/optimizers.h"
+
+#define GTHREAD_TLSP_IDX 6
+#define GTHREAD_DESTRUCTOR_ITERATIONS 4
+
+// from tasks.c
+void* pvTaskGetThreadLocalStoragePointer(task_t xTaskToQuery, int32_t xIndex);
+void vTaskSetThreadLocalStoragePointer(task_t xTaskToSet, int32_t xIndex, void* pvValue);
+
+_Static_assert(sizeof(static_hybrid_mutex_s_t) <= sizeof(((__gthread_mutex_t*)0)->storage),
+               "GTHREAD_MUTEX_WORDS is too small for a hybrid mutex");
+
+typedef struct gthread {
+	void* (*func)(void*);
+	void* arg;
+	uint32_t refs;
+	bool joinable;  // Started by gthread_create(), rather than a task which only set a key
+	sem_t done;
+	static_sem_s_t done_buf;
+	void* values[GTHREAD_KEYS_MAX];
+	uint32_t generations[GTHREAD_KEYS_MAX];  // The generation of each key a value was set for
+} gthread_s_t;
+
+typedef struct gthread_waiter {
+	task_t task;
+	struct gthread_waiter* next;
+	volatile bool signaled;
+} gthread_waiter_s_t;
+
+// A key's generation goes up every time it's created, so the values left in
+// tasks for a deleted key aren't seen through a new one
+static uint32_t keys_used;  // Bit i for key i
+static void (*key_dtors[GTHREAD_KEYS_MAX])(void*);
+static uint32_t key_generations[GTHREAD_KEYS_MAX];
+
+// Milliseconds until an absolute gettimeofday() time, rounded up
+static uint32_t timeout_ms(const __gthread_time_t* timeout) {
+	if (timeout == NULL) return TIMEOUT_MAX;
+	uint64_t const now = micros();
+	uint64_t const then = (uint64_t)timeout->tv_sec * 1000000 + (timeout->tv_nsec + 999) / 1000;
+	if (then <= now) return 0;
+	uint64_t const ms = (then - now + 999) / 1000;
+	return ms < TIMEOUT_MAX ? ms : TIMEOUT_MAX - 1;
+}
+
+static void gthread_unref(gthread_s_t* thread) {
+	if (__atomic_sub_fetch(&thread->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+		sem_delete(thread->done);
+		kfree(thread);
+	}
+}
+
+static void gthread_run_dtors(gthread_s_t* thread) {
+	for (uint32_t i = 0; i < GTHREAD_DESTRUCTOR_ITERATIONS; i++) {
+		bool called = false;
+		for (uint32_t key = 0; key < GTHREAD_KEYS_MAX; key++) {
+			void* const value = thread->values[key];
+			if (value == NULL || thread->generations[key] != key_generations[key] || !(keys_used & (1 << key)) ||
+			    key_dtors[key] == NULL) {
+				continue;
+			}
+			thread->values[key] = NULL;
+			key_dtors[key](value);
+			called = true;
+		}
+		if (!called) break;
+	}
+}
+
+static void gthread_entry(void* param) {
+	gthread_s_t* const thread = param;
+	vTaskSetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX, thread);
+	thread->func(thread->arg);
+	gthread_run_dtors(thread);
+	vTaskSetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX, NULL);
+	sem_post(thread->done);
+	gthread_unref(thread);
+}
+
+// Called when a task is deleted or restarted, before it's taken off its lists
+void gthread_release(task_t task) {
+	gthread_s_t* const thread = pvTaskGetThreadLocalStoragePointer(task, GTHREAD_TLSP_IDX);
+	if (likely(thread == NULL)) return;
+	vTaskSetThreadLocalStoragePointer(task, GTHREAD_TLSP_IDX, NULL);
+	if (thread->joinable) {
+		// A thread deleted before it finished is over as far as join() goes
+		sem_post(thread->done);
+		gthread_unref(thread);
+	} else {
+		kfree(thread);
+	}
+}
+
+int gthread_create(__gthread_t* handle, void* (*func)(void*), void* arg) {
+	gthread_s_t* const thread = kmalloc(sizeof(*thread));
+	if (thread == NULL) return EAGAIN;
+	memset(thread, 0, sizeof(*thread));
+	thread->func = func;
+	thread->arg = arg;
+	thread->refs = 2;
+	thread->joinable = true;
+	thread->done = sem_create_static(1, 0, &thread->done_buf);
+	*handle = thread;
+	if (task_create(gthread_entry, thread, task_get_priority(NULL), TASK_STACK_DEPTH_DEFAULT, "std::thread") == NULL) {
+		sem_delete(thread->done);
+		kfree(thread);
+		return EAGAIN;
+	}
+	return 0;
+}
+
+int gthread_join(__gthread_t handle, void** value) {
+	gthread_s_t* const thread = handle;
+	if (thread == pvTaskGetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX)) return EDEADLK;
+	sem_wait(thread->done, TIMEOUT_MAX);
+	if (value != NULL) *value = NULL;
+	gthread_unref(thread);
+	return 0;
+}
+
+int gthread_detach(__gthread_t handle) {
+	gthread_unref(handle);
+	return 0;
+}
+
+__gthread_t gthread_self(void) {
+	gthread_s_t* const thread = pvTaskGetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX);
+	// Tasks which didn't come from gthread_create() are told apart by their handle
+	return thread != NULL && thread->joinable ? (__gthread_t)thread : (__gthread_t)task_get_current();
+}
+
+void gthread_yield(void) {
+	task_delay(0);
+}
+
+int gthread_once(__gthread_once_t* once, void (*func)(void)) {
+	uint32_t state = 0;
+	if (__atomic_compare_exchange_n(&once->state, &state, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+		func();
+		__atomic_store_n(&once->state, 2, __ATOMIC_RELEASE);
+		return 0;
+	}
+	// Another task is running func
+	while (__atomic_load_n(&once->state, __ATOMIC_ACQUIRE) != 2) task_delay(1);
+	return 0;
+}
+
+int gthread_key_create(__gthread_key_t* key, void (*dtor)(void*)) {
+	rtos_suspend_all();
+	if (keys_used == (1 << GTHREAD_KEYS_MAX) - 1) {
+		rtos_resume_all();
+		return EAGAIN;
+	}
+	int const i = __builtin_ctz(~keys_used);
+	keys_used |= 1 << i;
+	key_dtors[i] = dtor;
+	key_generations[i]++;
+	rtos_resume_all();
+	*key = i;
+	return 0;
+}
+
+int gthread_key_delete(__gthread_key_t key) {
+	if (key >= GTHREAD_KEYS_MAX || !(keys_used & (1 << key))) return EINVAL;
+	rtos_suspend_all();
+	keys_used &= ~(1 << key);
+	key_dtors[key] = NULL;
+	rtos_resume_all();
+	return 0;
+}
+
+void* gthread_getspecific(__gthread_key_t key) {
+	gthread_s_t* const thread = pvTaskGetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX);
+	if (thread == NULL || key >= GTHREAD_KEYS_MAX || thread->generations[key] != key_generations[key]) return NULL;
+	return thread->values[key];
+}
+
+int gthread_setspecific(__gthread_key_t key, const void* value) {
+	if (key >= GTHREAD_KEYS_MAX || !(keys_used & (1 << key))) return EINVAL;
+	gthread_s_t* thread = pvTaskGetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX);
+	if (thread == NULL) {
+		thread = kmalloc(sizeof(*thread));
+		if (thread == NULL) return ENOMEM;
+		memset(thread, 0, sizeof(*thread));
+		vTaskSetThreadLocalStoragePointer(NULL, GTHREAD_TLSP_IDX, thread);
+	}
+	thread->values[key] = (void*)value;
+	thread->generations[key] = key_generations[key];
+	return 0;
+}
+
+static hybrid_mutex_t mutex_get(__gthread_mutex_t* mutex) {
+	static_hybrid_mutex_s_t* const storage = (static_hybrid_mutex_s_t*)mutex->storage;
+	if (unlikely(!__atomic_load_n(&mutex->ready, __ATOMIC_ACQUIRE))) {
+		rtos_suspend_all();
+		if (!mutex->ready) {
+			hybrid_mutex_create_static(storage);
+			__atomic_store_n(&mutex->ready, 1, __ATOMIC_RELEASE);
+		}
+		rtos_resume_all();
+	}
+	return storage;
+}
+
+int gthread_mutex_lock(__gthread_mutex_t* mutex, const __gthread_time_t* timeout) {
+	return hybrid_mutex_take(mutex_get(mutex), timeout_ms(timeout)) ? 0 : ETIMEDOUT;
+}
+
+int gthread_mutex_trylock(__gthread_mutex_t* mutex) {
+	return hybrid_mutex_take(mutex_get(mutex), 0) ? 0 : EBUSY;
+}
+
+int gthread_mutex_unlock(__gthread_mutex_t* mutex) {
+	return hybrid_mutex_give(mutex_get(mutex)) ? 0 : EPERM;
+}
+
+int gthread_recursive_mutex_lock(__gthread_recursive_mutex_t* mutex, const __gthread_time_t* timeout) {
+	// Only the owner can find itself in the state, so the count is its alone
+	if (hybrid_mutex_get_owner(mutex_get(&mutex->mutex)) == task_get_current()) {
+		mutex->count++;
+		return 0;
+	}
+	int const err = gthread_mutex_lock(&mutex->mutex, timeout);
+	if (err == 0) mutex->count = 1;
+	return err;
+}
+
+int gthread_recursive_mutex_trylock(__gthread_recursive_mutex_t* mutex) {
+	if (hybrid_mutex_get_owner(mutex_get(&mutex->mutex)) == task_get_current()) {
+		mutex->count++;
+		return 0;
+	}
+	int const err = gthread_mutex_trylock(&mutex->mutex);
+	if (err == 0) mutex->count = 1;
+	return err;
+}
+
+int gthread_recursive_mutex_unlock(__gthread_recursive_mutex_t* mutex) {
+	if (hybrid_mutex_get_owner(mutex_get(&mutex->mutex)) != task_get_current()) return EPERM;
+	if (--mutex->count > 0) return 0;
+	return gthread_mutex_unlock(&mutex->mutex);
+}
+
+int gthread_cond_wait(__gthread_cond_t* cond, __gthread_mutex_t* mutex, const __gthread_time_t* timeout) {
+	gthread_waiter_s_t waiter = {.task = task_get_current(), .next = NULL, .signaled = false};
+	rtos_suspend_all();
+	if (cond->tail != NULL) {
+		((gthread_waiter_s_t*)cond->tail)->next = &waiter;
+	} else {
+		cond->head = &waiter;
+	}
+	cond->tail = &waiter;
+	rtos_resume_all();
+
+	gthread_mutex_unlock(mutex);
+	uint32_t const wait = timeout_ms(timeout);
+	uint32_t const start = millis();
+	// Notifications meant for something else only cost another trip around
+	while (!waiter.signaled) {
+		uint32_t const elapsed = millis() - start;
+		if (wait != TIMEOUT_MAX && elapsed >= wait) break;
+		task_notify_take(true, wait == TIMEOUT_MAX ? TIMEOUT_MAX : wait - elapsed);
+	}
+
+	int err = 0;
+	if (!waiter.signaled) {
+		rtos_suspend_all();
+		// A signal may have come in just after the timeout
+		if (!waiter.signaled) {
+			gthread_waiter_s_t* prev = NULL;
+			for (gthread_waiter_s_t* w = cond->head; w != NULL; prev = w, w = w->next) {
+				if (w != &waiter) continue;
+				if (prev != NULL) {
+					prev->next = w->next;
+				} else {
+					cond->head = w->next;
+				}
+				if (cond->tail == w) cond->tail = prev;
+				break;
+			}
+			err = ETIMEDOUT;
+		}
+		rtos_resume_all();
+	}
+	gthread_mutex_lock(mutex, NULL);
+	return err;
+}
+
+// Called with the scheduler suspended, so the waiter can't run and return
+// before it's been notified
+static void cond_wake(__gthread_cond_t* cond) {
+	gthread_waiter_s_t* const waiter = cond->head;
+	cond->head = waiter->next;
+	if (cond->head == NULL) cond->tail = NULL;
+	task_t const task = waiter->task;
+	waiter->signaled = true;
+	task_notify(task);
+}
+
+int gthread_cond_signal(__gthread_cond_t* cond) {
+	if (cond->head == NULL) return 0;
+	rtos_suspend_all();
+	if (cond->head != NULL) cond_wake(cond);
+	rtos_resume_all();
+	return 0;
+}
+
+int gthread_cond_broadcast(__gthread_cond_t* cond) {
+	if (cond->head == NULL) return 0;
+	rtos_suspend_all();
+	while (cond->head != NULL) cond_wake(cond);
+	rtos_resume_all();
+	return 0;
+}
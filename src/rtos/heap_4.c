@@ -33,6 +33,8 @@
  * See heap_1.c, heap_2.c and heap_3.c for alternative implementations, and the
  * memory management pages of http://www.FreeRTOS.org for more information.
  */
+#include <errno.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "FreeRTOS.h"
@@ -42,6 +44,9 @@
 	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+/* heap_tlsf.c provides the heap instead when configUSE_TLSF_HEAP is 1. */
+#if( configUSE_TLSF_HEAP == 0 )
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( xHeapStructSize << 1 ) )
 
@@ -301,6 +306,65 @@ BlockLink_t *pxLink;
 }
 /*-----------------------------------------------------------*/
 
+/* There is no way to split the front off a block here, so the allocation is
+made alignment bytes bigger and the pointer kmalloc() returned is kept in the
+word in front of the aligned one for kfree_aligned(). */
+void *kmalloc_aligned( size_t xWantedSize, size_t xAlignment )
+{
+uint8_t *pucRaw;
+uintptr_t uxAligned;
+
+	if( ( xAlignment == 0 ) || ( ( xAlignment & ( xAlignment - 1 ) ) != 0 ) )
+	{
+		errno = EINVAL;
+		return NULL;
+	}
+	if( xAlignment < sizeof( void * ) )
+	{
+		xAlignment = sizeof( void * );
+	}
+	if( xWantedSize > SIZE_MAX - xAlignment - sizeof( void * ) )
+	{
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	pucRaw = kmalloc( xWantedSize + xAlignment - 1 + sizeof( void * ) );
+	if( pucRaw == NULL )
+	{
+		errno = ENOMEM;
+		return NULL;
+	}
+	uxAligned = ( ( uintptr_t ) pucRaw + sizeof( void * ) + xAlignment - 1 ) & ~( uintptr_t ) ( xAlignment - 1 );
+	( ( void ** ) uxAligned )[ -1 ] = pucRaw;
+	return ( void * ) uxAligned;
+}
+/*-----------------------------------------------------------*/
+
+void kfree_aligned( void *pv )
+{
+	if( pv != NULL )
+	{
+		kfree( ( ( void ** ) pv )[ -1 ] );
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t kmalloc_block_size( const void *pv )
+{
+const BlockLink_t *pxLink;
+
+	if( pv == NULL )
+	{
+		return 0;
+	}
+
+	/* The size in the header includes the header itself. */
+	pxLink = ( const void * ) ( ( const uint8_t * ) pv - xHeapStructSize );
+	return pxLink->xBlockSize & ~xBlockAllocatedBit;
+}
+/*-----------------------------------------------------------*/
+
 size_t xPortGetFreeHeapSize( void )
 {
 	return xFreeBytesRemaining;
@@ -319,6 +383,60 @@ void vPortInitialiseBlocks( void )
 }
 /*-----------------------------------------------------------*/
 
+/* Matches heap_stats_s_t in pros/apix.h. */
+typedef struct heap_stats_s
+{
+	uint32_t total_bytes;
+	uint32_t free_bytes;
+	uint32_t min_free_bytes;
+	uint32_t largest_free_block;
+	uint32_t free_blocks;
+	float fragmentation;
+} heap_stats_s_t;
+
+int32_t heap_get_stats( heap_stats_s_t * const pxStats )
+{
+BlockLink_t *pxBlock;
+size_t xLargest = 0, xUsable = 0;
+uint32_t ulBlocks = 0;
+
+	if( pxStats == NULL )
+	{
+		errno = EINVAL;
+		return INT32_MAX; /* PROS_ERR */
+	}
+
+	rtos_suspend_all();
+	{
+		if( pxEnd == NULL )
+		{
+			prvHeapInit();
+		}
+
+		/* Unlike heap_tlsf.c this has to walk the whole free list. */
+		for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+		{
+			if( pxBlock->xBlockSize - xHeapStructSize > xLargest )
+			{
+				xLargest = pxBlock->xBlockSize - xHeapStructSize;
+			}
+			xUsable += pxBlock->xBlockSize - xHeapStructSize;
+			ulBlocks++;
+		}
+
+		pxStats->total_bytes = configTOTAL_HEAP_SIZE;
+		pxStats->free_bytes = xFreeBytesRemaining;
+		pxStats->min_free_bytes = xMinimumEverFreeBytesRemaining;
+		pxStats->largest_free_block = xLargest;
+		pxStats->free_blocks = ulBlocks;
+		pxStats->fragmentation = xUsable ? 1.0f - ( float ) xLargest / xUsable : 0;
+	}
+	( void ) rtos_resume_all();
+
+	return 1;
+}
+/*-----------------------------------------------------------*/
+
 static void prvHeapInit( void )
 {
 BlockLink_t *pxFirstFreeBlock;
@@ -426,3 +544,5 @@ uint8_t *puc;
 		mtCOVERAGE_TEST_MARKER();
 	}
 }
+
+#endif /* configUSE_TLSF_HEAP */
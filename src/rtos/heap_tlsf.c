@@ -0,0 +1,330 @@
+/**
+ * \file rtos/heap_tlsf.c
+ *
+ * Two-Level Segregated Fit allocator for the kernel heap.
+ *
+ * Free blocks are kept in lists segregated by size: the first level splits
+ * sizes by powers of two and the second level splits each power of two into
+ * 16 ranges. A bitmap per level records which lists have blocks in them, so
+ * finding a free block that fits is a couple of count-leading-zeros
+ * instructions, and kmalloc() and kfree() take the same bounded time no matter
+ * how many blocks the heap is split into. Blocks are merged with their
+ * physical neighbors as soon as they are freed.
+ *
+ * Every block starts with an 8 byte header holding the previous physical
+ * block and the block's size, whose lowest bit marks the block as free. Free
+ * blocks keep their list links in the space which is otherwise handed out.
+ *
+ * Selected with configUSE_TLSF_HEAP in FreeRTOSConfig.h, as a replacement for
+ * heap_4.c.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+
+#if (configUSE_TLSF_HEAP == 1)
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+typedef struct heap_stats_s {
+	uint32_t total_bytes;
+	uint32_t free_bytes;
+	uint32_t min_free_bytes;
+	uint32_t largest_free_block;
+	uint32_t free_blocks;
+	float fragmentation;
+} heap_stats_s_t;
+#define PROS_ERR (INT32_MAX)
+
+#define ALIGN_LOG2 3
+#define ALIGN (1 << ALIGN_LOG2)
+#define SL_LOG2 4
+#define SL_COUNT (1 << SL_LOG2)
+// Sizes below this all go in the first first-level list, in steps of ALIGN
+#define FL_SHIFT (SL_LOG2 + ALIGN_LOG2)
+#define SMALL_BLOCK_SIZE (1 << FL_SHIFT)
+#define FL_COUNT (32 - FL_SHIFT + 1)
+
+#define BLOCK_FREE 1UL
+#define BLOCK_SIZE_MASK (~(size_t)(ALIGN - 1))
+
+typedef struct block {
+	struct block* prev_phys;  // NULL for the first block
+	size_t size;              // The size of the block after the header, with BLOCK_FREE if it's free
+	// Only valid while the block is free
+	struct block* next_free;
+	struct block* prev_free;
+} block_s_t;
+
+#define BLOCK_HEADER_SIZE offsetof(block_s_t, next_free)
+// A free block must have room for its list links
+#define BLOCK_MIN_SIZE (sizeof(block_s_t) - BLOCK_HEADER_SIZE)
+#define BLOCK_MAX_SIZE ((size_t)1 << 31)
+
+static uint8_t heap[configTOTAL_HEAP_SIZE] __attribute__((aligned(ALIGN)));
+
+// All of the state below is protected by suspending the scheduler
+static uint32_t fl_bitmap;
+static uint32_t sl_bitmap[FL_COUNT];
+static block_s_t* free_lists[FL_COUNT][SL_COUNT];
+static bool heap_initialized;
+static size_t free_bytes;
+static size_t min_free_bytes;
+static uint32_t free_blocks;
+
+static inline size_t block_size(const block_s_t* block) {
+	return block->size & BLOCK_SIZE_MASK;
+}
+
+static inline bool block_is_free(const block_s_t* block) {
+	return block->size & BLOCK_FREE;
+}
+
+static inline block_s_t* block_next(const block_s_t* block) {
+	return (block_s_t*)((uint8_t*)block + BLOCK_HEADER_SIZE + block_size(block));
+}
+
+static inline int fls(uint32_t x) {
+	return 31 - __builtin_clz(x);
+}
+
+// finds the list a block of the given size belongs in
+static inline void mapping(size_t size, uint32_t* fl, uint32_t* sl) {
+	if (size < SMALL_BLOCK_SIZE) {
+		*fl = 0;
+		*sl = size >> ALIGN_LOG2;
+	} else {
+		int log2 = fls(size);
+		*sl = (size >> (log2 - SL_LOG2)) ^ SL_COUNT;
+		*fl = log2 - FL_SHIFT + 1;
+	}
+}
+
+// finds the first list whose blocks are all at least the given size, so that
+// its first block can be taken without looking at the others
+static inline void mapping_search(size_t size, uint32_t* fl, uint32_t* sl) {
+	if (size >= SMALL_BLOCK_SIZE) size += (1UL << (fls(size) - SL_LOG2)) - 1;
+	mapping(size, fl, sl);
+}
+
+static void free_list_insert(block_s_t* block) {
+	uint32_t fl, sl;
+	mapping(block_size(block), &fl, &sl);
+	block_s_t* head = free_lists[fl][sl];
+	block->next_free = head;
+	block->prev_free = NULL;
+	if (head != NULL) head->prev_free = block;
+	free_lists[fl][sl] = block;
+	fl_bitmap |= 1UL << fl;
+	sl_bitmap[fl] |= 1UL << sl;
+	block->size |= BLOCK_FREE;
+	free_bytes += BLOCK_HEADER_SIZE + block_size(block);
+	free_blocks++;
+}
+
+static void free_list_remove(block_s_t* block) {
+	uint32_t fl, sl;
+	mapping(block_size(block), &fl, &sl);
+	if (block->next_free != NULL) block->next_free->prev_free = block->prev_free;
+	if (block->prev_free != NULL) {
+		block->prev_free->next_free = block->next_free;
+	} else {
+		free_lists[fl][sl] = block->next_free;
+		if (block->next_free == NULL) {
+			sl_bitmap[fl] &= ~(1UL << sl);
+			if (sl_bitmap[fl] == 0) fl_bitmap &= ~(1UL << fl);
+		}
+	}
+	block->size &= ~BLOCK_FREE;
+	free_bytes -= BLOCK_HEADER_SIZE + block_size(block);
+	free_blocks--;
+}
+
+static block_s_t* free_list_find(size_t size) {
+	uint32_t fl, sl;
+	mapping_search(size, &fl, &sl);
+	if (fl >= FL_COUNT) return NULL;
+	uint32_t sl_map = sl_bitmap[fl] & (~0UL << sl);
+	if (sl_map == 0) {
+		uint32_t fl_map = fl + 1 < 32 ? fl_bitmap & (~0UL << (fl + 1)) : 0;
+		if (fl_map == 0) return NULL;
+		fl = __builtin_ctz(fl_map);
+		sl_map = sl_bitmap[fl];
+	}
+	return free_lists[fl][__builtin_ctz(sl_map)];
+}
+
+static void heap_init(void) {
+	// The heap is one free block followed by an empty allocated block, so that
+	// every block has a next block to check when merging
+	block_s_t* first = (block_s_t*)heap;
+	first->prev_phys = NULL;
+	first->size = (sizeof(heap) - 2 * BLOCK_HEADER_SIZE) & BLOCK_SIZE_MASK;
+	block_s_t* sentinel = block_next(first);
+	sentinel->prev_phys = first;
+	sentinel->size = 0;
+	free_list_insert(first);
+	min_free_bytes = free_bytes;
+	heap_initialized = true;
+}
+
+// Takes a block of at least wanted_size bytes whose payload is a multiple of
+// alignment, a power of 2, off the free lists. Called with the scheduler suspended
+static void* block_take(size_t wanted_size, size_t alignment) {
+	if (wanted_size == 0 || wanted_size > BLOCK_MAX_SIZE || alignment > BLOCK_MAX_SIZE - wanted_size) return NULL;
+	size_t size = (wanted_size + ALIGN - 1) & BLOCK_SIZE_MASK;
+	if (size < BLOCK_MIN_SIZE) size = BLOCK_MIN_SIZE;
+	// A payload which isn't aligned well enough is moved up, and the space in front of it becomes a free block of
+	// its own, so the search leaves room for that as well
+	size_t const gap_max = alignment > ALIGN ? alignment + BLOCK_HEADER_SIZE + BLOCK_MIN_SIZE : 0;
+	block_s_t* block = free_list_find(size + gap_max);
+	if (block == NULL) return NULL;
+	free_list_remove(block);
+	if (gap_max) {
+		uintptr_t const payload = (uintptr_t)block + BLOCK_HEADER_SIZE;
+		uintptr_t aligned = (payload + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		if (aligned != payload && aligned - payload < BLOCK_HEADER_SIZE + BLOCK_MIN_SIZE) aligned += alignment;
+		if (aligned != payload) {
+			// The block before a free one is never free, so the gap doesn't need merging
+			block_s_t* moved = (block_s_t*)(aligned - BLOCK_HEADER_SIZE);
+			moved->prev_phys = block;
+			moved->size = block_size(block) - (aligned - payload);
+			block->size = aligned - payload - BLOCK_HEADER_SIZE;
+			block_next(moved)->prev_phys = moved;
+			free_list_insert(block);
+			block = moved;
+		}
+	}
+	// Give back whatever is big enough to be a block of its own
+	if (block_size(block) >= size + BLOCK_HEADER_SIZE + BLOCK_MIN_SIZE) {
+		block_s_t* rest = (block_s_t*)((uint8_t*)block + BLOCK_HEADER_SIZE + size);
+		rest->prev_phys = block;
+		rest->size = block_size(block) - size - BLOCK_HEADER_SIZE;
+		block->size = size;
+		block_next(rest)->prev_phys = rest;
+		free_list_insert(rest);
+	}
+	if (free_bytes < min_free_bytes) min_free_bytes = free_bytes;
+	return (uint8_t*)block + BLOCK_HEADER_SIZE;
+}
+
+void* kmalloc(size_t wanted_size) {
+	rtos_suspend_all();
+	if (!heap_initialized) heap_init();
+	void* ret = block_take(wanted_size, ALIGN);
+	traceMALLOC(ret, wanted_size);
+	rtos_resume_all();
+
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+	if (ret == NULL) {
+		extern void vApplicationMallocFailedHook(void);
+		vApplicationMallocFailedHook();
+	}
+#endif
+	return ret;
+}
+
+void* kmalloc_aligned(size_t wanted_size, size_t alignment) {
+	if (alignment == 0 || (alignment & (alignment - 1))) {
+		errno = EINVAL;
+		return NULL;
+	}
+	rtos_suspend_all();
+	if (!heap_initialized) heap_init();
+	void* ret = block_take(wanted_size, alignment);
+	traceMALLOC(ret, wanted_size);
+	rtos_resume_all();
+
+	if (ret == NULL) {
+		errno = ENOMEM;
+#if (configUSE_MALLOC_FAILED_HOOK == 1)
+		extern void vApplicationMallocFailedHook(void);
+		vApplicationMallocFailedHook();
+#endif
+	}
+	return ret;
+}
+
+void kfree(void* pv) {
+	if (pv == NULL) return;
+	block_s_t* block = (block_s_t*)((uint8_t*)pv - BLOCK_HEADER_SIZE);
+	configASSERT(!block_is_free(block));
+	rtos_suspend_all();
+	traceFREE(pv, block_size(block));
+	block_s_t* prev = block->prev_phys;
+	if (prev != NULL && block_is_free(prev)) {
+		free_list_remove(prev);
+		prev->size += BLOCK_HEADER_SIZE + block_size(block);
+		block = prev;
+	}
+	block_s_t* next = block_next(block);
+	if (block_is_free(next)) {
+		free_list_remove(next);
+		block->size += BLOCK_HEADER_SIZE + block_size(next);
+		next = block_next(block);
+	}
+	next->prev_phys = block;
+	free_list_insert(block);
+	rtos_resume_all();
+}
+
+// The aligned blocks are ordinary blocks which start further in
+void kfree_aligned(void* pv) {
+	kfree(pv);
+}
+
+// The bytes of the heap a block from kmalloc() takes up, including its header
+size_t kmalloc_block_size(const void* pv) {
+	if (pv == NULL) return 0;
+	return BLOCK_HEADER_SIZE + block_size((const block_s_t*)((const uint8_t*)pv - BLOCK_HEADER_SIZE));
+}
+
+size_t xPortGetFreeHeapSize(void) {
+	return free_bytes;
+}
+
+size_t xPortGetMinimumEverFreeHeapSize(void) {
+	return min_free_bytes;
+}
+
+void vPortInitialiseBlocks(void) {
+	// This just exists to keep the linker quiet
+}
+
+int32_t heap_get_stats(heap_stats_s_t* const stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (!heap_initialized) heap_init();
+	size_t largest = 0;
+	if (fl_bitmap != 0) {
+		// The largest block is in the highest occupied list, which only holds sizes within 1/16 of each other
+		uint32_t fl = fls(fl_bitmap);
+		for (block_s_t* block = free_lists[fl][fls(sl_bitmap[fl])]; block != NULL; block = block->next_free) {
+			if (block_size(block) > largest) largest = block_size(block);
+		}
+	}
+	// Compare against the space which could be handed out, without the headers of the free blocks
+	size_t usable = free_bytes - free_blocks * BLOCK_HEADER_SIZE;
+	*stats = (heap_stats_s_t){.total_bytes = sizeof(heap),
+	                          .free_bytes = free_bytes,
+	                          .min_free_bytes = min_free_bytes,
+	                          .largest_free_block = largest,
+	                          .free_blocks = free_blocks,
+	                          .fragmentation = usable ? 1.0f - (float)largest / usable : 0};
+	rtos_resume_all();
+	return 1;
+}
+
+#endif
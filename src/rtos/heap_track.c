@@ -0,0 +1,196 @@
+/**
+ * \file rtos/heap_track.c
+ *
+ * Tracking of live heap allocations.
+ *
+ * Built in with configUSE_HEAP_TRACKING in FreeRTOSConfig.h. Every kmalloc()
+ * and every malloc() goes into a fixed size hash table along with the address
+ * it was called from, the calling task and its size, and comes out of it again
+ * when it is freed. Whatever is still in the table is what's allocated, so a
+ * leak shows up as a call site whose allocations keep piling up.
+ *
+ * The table is open addressed with linear probing, keyed by the allocation's
+ * address, and entries are removed by shifting the rest of their run back so
+ * that lookups never have to skip over tombstones. Writers mask interrupts for
+ * the few instructions an update takes, since malloc() doesn't take a lock
+ * when its per-task cache has a block ready.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+#include "rtos/tcb.h"
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+#define KDBG_FILENO 3
+#define PROS_ERR (INT32_MAX)
+
+#if (configUSE_HEAP_TRACKING == 1)
+
+#define TRACK_SLOTS configHEAP_TRACKING_ENTRIES
+_Static_assert((TRACK_SLOTS & (TRACK_SLOTS - 1)) == 0, "configHEAP_TRACKING_ENTRIES must be a power of two");
+
+#define TRACK_NEWLIB 0x80000000UL
+#define TRACK_SIZE_MASK (~TRACK_NEWLIB)
+#define TRACK_LINE_LEN 64
+
+typedef struct track_entry_s {
+	uintptr_t ptr;  // 0 if the slot is empty
+	uintptr_t caller;
+	uint32_t size;  // With TRACK_NEWLIB for malloc() rather than kmalloc()
+	uint32_t task;  // The TCB number of the allocating task, 0 before the scheduler starts
+} track_entry_s_t;
+
+static track_entry_s_t table[TRACK_SLOTS];
+static uint32_t live_count;
+static uint32_t dropped;  // Allocations which didn't fit in the table
+
+static inline uint32_t track_hash(uintptr_t ptr) {
+	// Blocks are at least 8 byte aligned, so the low bits carry nothing
+	return ((ptr >> 3) * 2654435761UL) & (TRACK_SLOTS - 1);
+}
+
+void heap_track_alloc(void* ptr, size_t size, void* caller, bool newlib) {
+	if (ptr == NULL) return;
+	TCB_t* tcb = xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED ? task_get_current() : NULL;
+	track_entry_s_t entry = {.ptr = (uintptr_t)ptr,
+	                         .caller = (uintptr_t)caller,
+	                         .size = (size & TRACK_SIZE_MASK) | (newlib ? TRACK_NEWLIB : 0),
+	                         .task = tcb != NULL ? tcb->uxTCBNumber : 0};
+
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	// Always leave an empty slot so that every probe ends
+	if (live_count < TRACK_SLOTS - 1) {
+		uint32_t i = track_hash(entry.ptr);
+		while (table[i].ptr != 0) i = (i + 1) & (TRACK_SLOTS - 1);
+		table[i] = entry;
+		live_count++;
+	} else {
+		dropped++;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void heap_track_free(void* ptr) {
+	if (ptr == NULL) return;
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	uint32_t i = track_hash((uintptr_t)ptr);
+	while (table[i].ptr != 0 && table[i].ptr != (uintptr_t)ptr) i = (i + 1) & (TRACK_SLOTS - 1);
+	// Allocations which were dropped, or made by newlib on its own, aren't in the table
+	if (table[i].ptr != 0) {
+		// Move later entries of the run back into the hole if that's no further than where they hash to
+		for (uint32_t j = (i + 1) & (TRACK_SLOTS - 1); table[j].ptr != 0; j = (j + 1) & (TRACK_SLOTS - 1)) {
+			uint32_t home = track_hash(table[j].ptr);
+			if (((j - home) & (TRACK_SLOTS - 1)) >= ((j - i) & (TRACK_SLOTS - 1))) {
+				table[i] = table[j];
+				i = j;
+			}
+		}
+		table[i].ptr = 0;
+		live_count--;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+// Sorts by call site, then by task, so that allocations from the same place are next to each other
+static int track_compare_site(const void* a, const void* b) {
+	const track_entry_s_t* x = a;
+	const track_entry_s_t* y = b;
+	if (x->caller != y->caller) return x->caller < y->caller ? -1 : 1;
+	if (x->task != y->task) return x->task < y->task ? -1 : 1;
+	return (int)(x->size & TRACK_NEWLIB) - (int)(y->size & TRACK_NEWLIB);
+}
+
+// Sorts the biggest totals first. Totals are kept in ptr once entries are merged
+static int track_compare_bytes(const void* a, const void* b) {
+	const track_entry_s_t* x = a;
+	const track_entry_s_t* y = b;
+	return x->ptr < y->ptr ? 1 : x->ptr > y->ptr ? -1 : 0;
+}
+
+static const char* track_task_name(const TaskStatus_t* statuses, uint32_t count, uint32_t task) {
+	if (task == 0) return "(startup)";
+	for (uint32_t i = 0; i < count; i++) {
+		if (statuses[i].xTaskNumber == task) return statuses[i].pcTaskName;
+	}
+	return "(ended)";
+}
+
+int32_t heap_track_dump(void) {
+	uint32_t status_count = task_get_count() + 4;
+	track_entry_s_t* entries = kmalloc(sizeof(table));
+	TaskStatus_t* statuses = kmalloc(status_count * sizeof(*statuses));
+	if (entries == NULL || statuses == NULL) {
+		kfree(entries);
+		kfree(statuses);
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+
+	// Take a snapshot of the table, leaving out the report's own buffers
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < TRACK_SLOTS; i++) {
+		uintptr_t ptr = table[i].ptr;
+		if (ptr != 0 && ptr != (uintptr_t)entries && ptr != (uintptr_t)statuses) entries[count++] = table[i];
+	}
+	uint32_t total_dropped = dropped;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+	status_count = uxTaskGetSystemState(statuses, status_count, NULL);
+
+	// Merge the allocations of each call site and task into one entry, which
+	// keeps the total bytes in ptr and the number of blocks in size
+	qsort(entries, count, sizeof(*entries), track_compare_site);
+	uint32_t sites = 0;
+	for (uint32_t i = 0; i < count;) {
+		track_entry_s_t site = entries[i];
+		site.ptr = 0;
+		uint32_t blocks = 0;
+		for (; i < count && track_compare_site(&entries[i], &site) == 0; i++) {
+			site.ptr += entries[i].size & TRACK_SIZE_MASK;
+			blocks++;
+		}
+		site.size = blocks | (site.size & TRACK_NEWLIB);
+		entries[sites++] = site;
+	}
+	qsort(entries, sites, sizeof(*entries), track_compare_bytes);
+
+	// Formatted one line at a time, as the whole report could be bigger than the table
+	char line[TRACK_LINE_LEN + configMAX_TASK_NAME_LEN];
+	int len = snprintf(line, sizeof(line), "Live allocations: %lu (%lu not tracked)\n", count, total_dropped);
+	write(KDBG_FILENO, line, len);
+	len = snprintf(line, sizeof(line), "     bytes  blocks  heap    caller      task\n");
+	write(KDBG_FILENO, line, len);
+	for (uint32_t i = 0; i < sites; i++) {
+		len = snprintf(line, sizeof(line), "%10lu  %6lu  %-6s  0x%08lx  %s\n", (uint32_t)entries[i].ptr,
+		               entries[i].size & TRACK_SIZE_MASK, entries[i].size & TRACK_NEWLIB ? "malloc" : "kernel",
+		               (uint32_t)entries[i].caller, track_task_name(statuses, status_count, entries[i].task));
+		write(KDBG_FILENO, line, len < (int)sizeof(line) ? len : (int)sizeof(line) - 1);
+	}
+
+	kfree(entries);
+	kfree(statuses);
+	return count;
+}
+
+#else
+
+int32_t heap_track_dump(void) {
+	errno = ENOSYS;
+	return PROS_ERR;
+}
+
+#endif
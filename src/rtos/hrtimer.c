@@ -0,0 +1,155 @@
+/**
+ * \file rtos/hrtimer.c
+ *
+ * Microsecond timebase and delays.
+ *
+ * The Cortex-A9's global timer is a 64 bit counter running at the peripheral
+ * clock, half the 666.67 MHz CPU clock, which micros() reads directly, as does
+ * hrtimer_nanos() for std::chrono's clocks in system/cpp_support.cpp. Its
+ * comparator is used as a one-shot timer: tasks waiting in
+ * task_delay_until_us() are kept in a list sorted by wake time, and the
+ * comparator is always set to the earliest one. Its interrupt wakes every
+ * waiter which is due and moves the comparator on to the next.
+ *
+ * Each waiter blocks on a binary semaphore on its own stack, so waiting
+ * doesn't use the task's notification value or its suspended state. The
+ * semaphore is taken with a millisecond timeout as well, in case the
+ * interrupt is ever missed.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/semphr.h"
+#include "rtos/task.h"
+
+#define GT_BASE 0xF8F00200UL
+#define GT_COUNTER_LO (*(volatile uint32_t*)(GT_BASE + 0x00))
+#define GT_COUNTER_HI (*(volatile uint32_t*)(GT_BASE + 0x04))
+#define GT_CONTROL (*(volatile uint32_t*)(GT_BASE + 0x08))
+#define GT_STATUS (*(volatile uint32_t*)(GT_BASE + 0x0C))
+#define GT_COMPARATOR_LO (*(volatile uint32_t*)(GT_BASE + 0x10))
+#define GT_COMPARATOR_HI (*(volatile uint32_t*)(GT_BASE + 0x14))
+
+#define GT_CONTROL_TIMER_ENABLE (1UL << 0)
+#define GT_CONTROL_COMP_ENABLE (1UL << 1)
+#define GT_CONTROL_IRQ_ENABLE (1UL << 2)
+#define GT_STATUS_EVENT (1UL << 0)
+
+// The global timer's interrupt is private peripheral interrupt 27
+#define GT_IRQ_ID 27
+#define GIC_DIST_BASE configINTERRUPT_CONTROLLER_BASE_ADDRESS
+#define GIC_SET_ENABLE (*(volatile uint32_t*)(GIC_DIST_BASE + 0x100))
+#define GIC_SET_PENDING (*(volatile uint32_t*)(GIC_DIST_BASE + 0x200))
+#define GIC_PRIORITY(id) (*(volatile uint8_t*)(GIC_DIST_BASE + 0x400 + (id)))
+
+// The counter runs at 333.33 MHz, so three counts take a hundredth of a microsecond
+#define COUNTS_TO_US(counts) ((counts)*3 / 1000)
+#define US_TO_COUNTS(us) ((us)*1000 / 3)
+#define COUNTS_TO_NS(counts) ((counts)*3)
+
+typedef struct hrtimer_waiter_s {
+	struct hrtimer_waiter_s* next;
+	uint64_t deadline;  // In counts of the global timer
+	sem_t sem;
+	bool queued;
+} hrtimer_waiter_s_t;
+
+// Only changed in a critical section or the timer's interrupt
+static hrtimer_waiter_s_t* waiters;
+static uint64_t epoch;
+
+static uint64_t gt_read(void) {
+	// The halves are read separately, so the high half is read again in case the low half overflowed in between
+	uint32_t hi, lo;
+	do {
+		hi = GT_COUNTER_HI;
+		lo = GT_COUNTER_LO;
+	} while (hi != GT_COUNTER_HI);
+	return ((uint64_t)hi << 32) | lo;
+}
+
+static void gt_arm(uint64_t deadline) {
+	GT_CONTROL &= ~GT_CONTROL_COMP_ENABLE;
+	GT_COMPARATOR_LO = (uint32_t)deadline;
+	GT_COMPARATOR_HI = (uint32_t)(deadline >> 32);
+	GT_CONTROL |= GT_CONTROL_COMP_ENABLE | GT_CONTROL_IRQ_ENABLE;
+	// The comparator only fires as the counter passes it, so handle a deadline
+	// which is already behind us the same way
+	if (gt_read() >= deadline) GIC_SET_PENDING = 1UL << GT_IRQ_ID;
+}
+
+void hrtimer_initialize(void) {
+	GT_CONTROL = (GT_CONTROL | GT_CONTROL_TIMER_ENABLE) & ~(GT_CONTROL_COMP_ENABLE | GT_CONTROL_IRQ_ENABLE);
+	GT_STATUS = GT_STATUS_EVENT;
+	epoch = gt_read();
+	// Just above the tick so that wakeups aren't held up by it, and low enough to use the FreeRTOS API
+	GIC_PRIORITY(GT_IRQ_ID) = (portLOWEST_USABLE_INTERRUPT_PRIORITY - 1) << portPRIORITY_SHIFT;
+	GIC_SET_ENABLE = 1UL << GT_IRQ_ID;
+}
+
+void hrtimer_irq_handler(void) {
+	int32_t woken = pdFALSE;
+	GT_STATUS = GT_STATUS_EVENT;
+	uint64_t now = gt_read();
+	while (waiters != NULL && waiters->deadline <= now) {
+		hrtimer_waiter_s_t* waiter = waiters;
+		waiters = waiter->next;
+		waiter->queued = false;
+		xSemaphoreGiveFromISR(waiter->sem, &woken);
+	}
+	if (waiters != NULL) {
+		gt_arm(waiters->deadline);
+	} else {
+		GT_CONTROL &= ~(GT_CONTROL_COMP_ENABLE | GT_CONTROL_IRQ_ENABLE);
+	}
+	portYIELD_FROM_ISR(woken);
+}
+
+uint64_t micros(void) {
+	return COUNTS_TO_US(gt_read() - epoch);
+}
+
+uint64_t hrtimer_nanos(void) {
+	return COUNTS_TO_NS(gt_read() - epoch);
+}
+
+void task_delay_until_us(uint64_t* const prev_time, const uint32_t delta) {
+	configASSERT(prev_time);
+	*prev_time += delta;
+	uint64_t now = micros();
+	if (*prev_time <= now) {
+		// Already late, but give other tasks at the same priority a chance like task_delay_until() does
+		taskYIELD();
+		return;
+	}
+
+	static_sem_s_t sem_buf;
+	hrtimer_waiter_s_t waiter = {.deadline = epoch + US_TO_COUNTS(*prev_time), .sem = xSemaphoreCreateBinaryStatic(&sem_buf), .queued = true};
+	taskENTER_CRITICAL();
+	{
+		hrtimer_waiter_s_t** link = &waiters;
+		while (*link != NULL && (*link)->deadline <= waiter.deadline) link = &(*link)->next;
+		waiter.next = *link;
+		*link = &waiter;
+		if (waiters == &waiter) gt_arm(waiter.deadline);
+	}
+	taskEXIT_CRITICAL();
+
+	// Rounded up, with a tick to spare since the tick may be just about to happen
+	sem_wait(waiter.sem, (*prev_time - now + 999) / 1000 + 1);
+
+	taskENTER_CRITICAL();
+	if (waiter.queued) {
+		hrtimer_waiter_s_t** link = &waiters;
+		while (*link != &waiter) link = &(*link)->next;
+		*link = waiter.next;
+	}
+	taskEXIT_CRITICAL();
+	sem_delete(waiter.sem);
+}
@@ -0,0 +1,147 @@
+/**
+ * \file rtos/hybrid_mutex.c
+ *
+ * Mutexes with an uncontended fast path.
+ *
+ * A hybrid mutex's state word holds its owner, and taking or giving a mutex
+ * which nobody else wants is a single exclusive load and store of it. Only
+ * when a task finds the mutex taken does it fall back to the mutex's queue
+ * mutex: with the scheduler suspended it takes the queue mutex on behalf of
+ * the owner (xQueueTakeMutexFor) and marks the state as contended, then blocks
+ * on the queue mutex so that the owner inherits its priority as usual. An
+ * owner which finds the contended mark gives the queue mutex back instead.
+ *
+ * The state is one of
+ * - 0: free, and so is the queue mutex
+ * - owner: taken on the fast path, the queue mutex is free and nobody waits
+ * - owner | CONTENDED: taken, and the owner holds the queue mutex
+ * - CONTENDED: the queue mutex was just given to a waiting task, which records
+ *   itself as the owner once it runs
+ *
+ * Tasks only change a contended state with the scheduler suspended. A context
+ * switch clears the exclusive monitor (see rtos/pool.c), so a fast path which
+ * is preempted between its load and store just tries again.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+
+// rtos/queue.h clashes with the PROS queue API
+extern int32_t xQueueTakeMutexFor(queue_t mutex, void* holder);
+
+// Task handles are word aligned, so the low bit is free
+#define CONTENDED 1
+
+static inline bool cas_state(static_hybrid_mutex_s_t* mutex, uint32_t expected, uint32_t desired) {
+	// The V5 has a single core, so compiler barriers are all the ordering needed
+	bool swapped = __atomic_compare_exchange_n(&mutex->state, &expected, desired, false, __ATOMIC_RELAXED,
+	                                           __ATOMIC_RELAXED);
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+	return swapped;
+}
+
+hybrid_mutex_t hybrid_mutex_create_static(static_hybrid_mutex_s_t* mutex_buffer) {
+	if (mutex_buffer == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	mutex_buffer->state = 0;
+	mutex_buffer->waiters = 0;
+	mutex_buffer->queue_mutex = mutex_create_static(&mutex_buffer->queue_mutex_buf);
+	return mutex_buffer;
+}
+
+hybrid_mutex_t hybrid_mutex_create(void) {
+	static_hybrid_mutex_s_t* mutex = kmalloc(sizeof(*mutex));
+	if (mutex == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	return hybrid_mutex_create_static(mutex);
+}
+
+void hybrid_mutex_delete(hybrid_mutex_t mutex) {
+	if (mutex == NULL) return;
+	queue_delete(((static_hybrid_mutex_s_t*)mutex)->queue_mutex);
+	kfree(mutex);
+}
+
+__pros_fast static bool take_contended(static_hybrid_mutex_s_t* mutex, uint32_t self, uint32_t timeout) {
+	rtos_suspend_all();
+	uint32_t state = mutex->state;
+	if (state == 0) {
+		// The owner gave it back before the scheduler was suspended
+		mutex->state = self;
+		rtos_resume_all();
+		return true;
+	}
+	if (timeout == 0) {
+		rtos_resume_all();
+		return false;
+	}
+	if (!(state & CONTENDED)) {
+		// The owner took it on the fast path, so it doesn't hold the queue mutex yet
+		xQueueTakeMutexFor(mutex->queue_mutex, (void*)state);
+		mutex->state = state | CONTENDED;
+	}
+	mutex->waiters++;
+	rtos_resume_all();
+
+	bool taken = mutex_take(mutex->queue_mutex, timeout);
+
+	rtos_suspend_all();
+	mutex->waiters--;
+	if (taken) mutex->state = self | CONTENDED;
+	rtos_resume_all();
+	return taken;
+}
+
+__pros_fast bool hybrid_mutex_take(hybrid_mutex_t mutex, uint32_t timeout) {
+	if (mutex == NULL) {
+		errno = EINVAL;
+		return false;
+	}
+	static_hybrid_mutex_s_t* const m = mutex;
+	uint32_t self = (uint32_t)task_get_current();
+	if (cas_state(m, 0, self)) return true;
+	return take_contended(m, self, timeout);
+}
+
+__pros_fast bool hybrid_mutex_give(hybrid_mutex_t mutex) {
+	if (mutex == NULL) {
+		errno = EINVAL;
+		return false;
+	}
+	static_hybrid_mutex_s_t* const m = mutex;
+	uint32_t self = (uint32_t)task_get_current();
+	if (cas_state(m, self, 0)) return true;
+	if (m->state != (self | CONTENDED)) {
+		errno = EPERM;
+		return false;
+	}
+	// Giving the queue mutex wakes the highest priority waiter and drops any
+	// priority it lent us. Context switches wait until the scheduler resumes,
+	// by which time the state is consistent
+	rtos_suspend_all();
+	m->state = m->waiters ? CONTENDED : 0;
+	bool given = mutex_give(m->queue_mutex);
+	rtos_resume_all();
+	return given;
+}
+
+task_t hybrid_mutex_get_owner(hybrid_mutex_t mutex) {
+	if (mutex == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	return (task_t)(((static_hybrid_mutex_s_t*)mutex)->state & ~CONTENDED);
+}
@@ -0,0 +1,75 @@
+/**
+ * \file rtos/message_buffer.c
+ *
+ * Message buffers for the PROS API.
+ *
+ * These wrap the FreeRTOS message buffers from rtos/stream_buffer.c, which
+ * are only macros in rtos/message_buffer.h, as functions which user code can
+ * call and which report errors through errno.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+#include "rtos/message_buffer.h"
+
+_Static_assert(sizeof(static_msg_buf_s_t) == MESSAGE_BUFFER_HEADER_SIZE, "MESSAGE_BUFFER_HEADER_SIZE is out of date");
+_Static_assert(MESSAGE_BUFFER_MESSAGE_SPACE(0) == sizeof(size_t), "MESSAGE_BUFFER_MESSAGE_SPACE is out of date");
+
+message_buffer_t message_buffer_create(size_t size) {
+	if (size <= MESSAGE_BUFFER_MESSAGE_SPACE(0)) {
+		errno = EINVAL;
+		return NULL;
+	}
+	message_buffer_t buffer = xMessageBufferCreate(size);
+	if (buffer == NULL) errno = ENOMEM;
+	return buffer;
+}
+
+message_buffer_t message_buffer_create_static(size_t size, void* storage) {
+	if (size <= MESSAGE_BUFFER_MESSAGE_SPACE(0) || storage == NULL || (uintptr_t)storage % 4) {
+		errno = EINVAL;
+		return NULL;
+	}
+	// Laid out like message_buffer_create()'s allocation, including the extra
+	// byte which makes the free space come out as expected
+	return xMessageBufferCreateStatic(size + 1, (uint8_t*)storage + MESSAGE_BUFFER_HEADER_SIZE,
+	                                  (static_msg_buf_s_t*)storage);
+}
+
+void message_buffer_delete(message_buffer_t buffer) {
+	vMessageBufferDelete(buffer);
+}
+
+size_t message_buffer_send(message_buffer_t buffer, const void* data, size_t length, uint32_t timeout) {
+	// A message which wouldn't fit in the empty buffer never will, so don't wait
+	// for room. The receiver can only free space, so reading the used space first
+	// never makes the buffer look smaller than it is
+	size_t capacity = stream_buf_get_used(buffer);
+	capacity += stream_buf_get_unused(buffer);
+	if (MESSAGE_BUFFER_MESSAGE_SPACE(length) > capacity) {
+		errno = EMSGSIZE;
+		return 0;
+	}
+	size_t sent = msg_buf_send(buffer, data, length, timeout);
+	if (sent == 0) errno = ETIMEDOUT;
+	return sent;
+}
+
+size_t message_buffer_recv(message_buffer_t buffer, void* data, size_t max_length, uint32_t timeout) {
+	size_t received = msg_buf_recv(buffer, data, max_length, timeout);
+	// A message which is too long for data stays at the front of the buffer
+	if (received == 0) errno = msg_buf_is_empty(buffer) ? ETIMEDOUT : EMSGSIZE;
+	return received;
+}
+
+size_t message_buffer_get_free(message_buffer_t buffer) {
+	return xMessageBufferSpaceAvailable(buffer);
+}
@@ -0,0 +1,140 @@
+/**
+ * \file rtos/periodic_task.c
+ *
+ * Periodic tasks with deadline miss detection.
+ *
+ * A periodic task runs a loop which calls the user's function once per release
+ * and waits for the next release with task_delay_until_us(). The loop times
+ * each run from its release with micros(), so the response times it records
+ * include whatever the task spent preempted, and no hook in the scheduler is
+ * needed. The timing record lives in a thread local storage pointer of the
+ * task, where the getters can find it and from where it is freed once the
+ * task is deleted.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+
+// NOTE: can't just include task.h because of redefinition that goes on in kapi
+//       include chain, so we just prototype what we need here
+void* pvTaskGetThreadLocalStoragePointer(task_t xTaskToQuery, int32_t xIndex);
+void vTaskSetThreadLocalStoragePointer(task_t xTaskToSet, int32_t xIndex, void* pvValue);
+
+// The thread local storage pointer the state lives in, after the one used by
+// system/mlock.c
+#define PERIODIC_TLSP_IDX 3
+
+typedef struct periodic_task_s {
+	task_fn_t function;
+	void* param;
+	periodic_miss_fn_t miss_callback;
+	void* miss_param;
+	// Written by the task and read by others, so only touched with the
+	// scheduler suspended
+	periodic_task_stats_s_t stats;
+} periodic_task_s_t;
+
+static periodic_task_s_t* periodic_task_get(task_t task) {
+	if (task == NULL) task = task_get_current();
+	periodic_task_s_t* state = pvTaskGetThreadLocalStoragePointer(task, PERIODIC_TLSP_IDX);
+	if (state == NULL) errno = EINVAL;
+	return state;
+}
+
+static void periodic_task_loop(void* param) {
+	periodic_task_s_t* const state = param;
+	uint32_t const period = state->stats.period * 1000;
+	uint32_t const deadline = state->stats.deadline * 1000;
+	uint64_t release = micros();
+	while (true) {
+		state->function(state->param);
+		uint64_t const now = micros();
+		uint32_t const response = now - release;
+		// Releases which passed during the run are skipped, so the task waits for
+		// the first one still to come
+		uint32_t const passed = (now - release) / period;
+		bool const missed = response > deadline;
+
+		rtos_suspend_all();
+		periodic_task_stats_s_t* const stats = &state->stats;
+		stats->releases++;
+		stats->misses += missed;
+		stats->skipped += passed;
+		stats->last_release = release;
+		stats->last_completion = now;
+		stats->last_response = response;
+		if (response > stats->max_response) stats->max_response = response;
+		periodic_miss_fn_t const callback = state->miss_callback;
+		void* const miss_param = state->miss_param;
+		rtos_resume_all();
+
+		if (missed && callback) callback(task_get_current(), response, miss_param);
+		release += (uint64_t)passed * period;
+		task_delay_until_us(&release, period);
+	}
+}
+
+task_t task_create_periodic(task_fn_t function, void* const parameters, uint32_t period, uint32_t deadline,
+                            uint32_t prio, const uint16_t stack_depth, const char* const name) {
+	if (deadline == 0) deadline = period;
+	if (period == 0 || deadline > period) {
+		errno = EINVAL;
+		return NULL;
+	}
+	periodic_task_s_t* state = kmalloc(sizeof(*state));
+	if (state == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	*state = (periodic_task_s_t){.function = function, .param = parameters};
+	state->stats.period = period;
+	state->stats.deadline = deadline;
+
+	// The state must be in place before the task can run, or be deleted
+	rtos_suspend_all();
+	task_t task = task_create(periodic_task_loop, state, prio, stack_depth, name);
+	if (task != NULL) vTaskSetThreadLocalStoragePointer(task, PERIODIC_TLSP_IDX, state);
+	rtos_resume_all();
+
+	if (task == NULL) kfree(state);
+	return task;
+}
+
+int32_t task_get_periodic_stats(task_t task, periodic_task_stats_s_t* const stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	periodic_task_s_t* state = periodic_task_get(task);
+	if (state == NULL) return PROS_ERR;
+	rtos_suspend_all();
+	*stats = state->stats;
+	rtos_resume_all();
+	return 1;
+}
+
+int32_t task_set_deadline_miss_callback(task_t task, periodic_miss_fn_t callback, void* param) {
+	periodic_task_s_t* state = periodic_task_get(task);
+	if (state == NULL) return PROS_ERR;
+	rtos_suspend_all();
+	state->miss_callback = callback;
+	state->miss_param = param;
+	rtos_resume_all();
+	return 1;
+}
+
+// Called when a task is deleted, once it can no longer run
+void periodic_task_release(task_t task) {
+	periodic_task_s_t* state = pvTaskGetThreadLocalStoragePointer(task, PERIODIC_TLSP_IDX);
+	if (state == NULL) return;
+	vTaskSetThreadLocalStoragePointer(task, PERIODIC_TLSP_IDX, NULL);
+	kfree(state);
+}
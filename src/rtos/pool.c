@@ -0,0 +1,131 @@
+/**
+ * \file rtos/pool.c
+ *
+ * Fixed-size memory pools.
+ *
+ * A pool's free blocks form a stack linked through the blocks themselves, with
+ * the bookkeeping at the start of the caller's storage. Blocks are pushed and
+ * popped with exclusive loads and stores instead of a lock, so a task can't be
+ * held up by another one which was preempted in the middle of an allocation,
+ * and interrupts can use pools too.
+ *
+ * Popping a block reads the next block between the exclusive load and store of
+ * the head. The store only succeeds if nothing else has stored to the head in
+ * between, which rules out another block having been popped and pushed back in
+ * the meantime (the ABA problem). portRESTORE_CONTEXT clears the exclusive
+ * monitor so that a context switch in between fails the store as well.
+ *
+ * The V5 has a single core, so compiler barriers are all the ordering needed.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+
+typedef struct pool_s {
+	void* volatile head;  // The first free block, whose first word points to the next one
+	uint32_t stride;
+	uint32_t count;
+	volatile uint32_t free_count;
+} pool_s_t;
+
+_Static_assert(sizeof(pool_s_t) == POOL_HEADER_SIZE, "POOL_HEADER_SIZE is out of date");
+
+static inline uint8_t* pool_blocks(pool_s_t* pool) {
+	return (uint8_t*)pool + POOL_HEADER_SIZE;
+}
+
+static inline void* load_exclusive(void* volatile* addr) {
+	void* value;
+	__asm volatile("ldrex %0, [%1]" : "=r"(value) : "r"(addr) : "memory");
+	return value;
+}
+
+// Returns 0 if the store succeeded
+static inline uint32_t store_exclusive(void* volatile* addr, void* value) {
+	uint32_t failed;
+	__asm volatile("strex %0, %2, [%1]" : "=&r"(failed) : "r"(addr), "r"(value) : "memory");
+	return failed;
+}
+
+static void* pool_pop(pool_s_t* pool) {
+	void* block;
+	do {
+		block = load_exclusive(&pool->head);
+		if (block == NULL) {
+			__asm volatile("clrex" ::: "memory");
+			return NULL;
+		}
+	} while (store_exclusive(&pool->head, *(void**)block));
+	__atomic_fetch_sub(&pool->free_count, 1, __ATOMIC_RELAXED);
+	return block;
+}
+
+static bool pool_push(pool_s_t* pool, void* block) {
+	uint32_t offset = (uint8_t*)block - pool_blocks(pool);
+	if ((uint8_t*)block < pool_blocks(pool) || offset >= pool->count * pool->stride || offset % pool->stride) {
+		return false;
+	}
+	// Pushing can't suffer from ABA, since the block being pushed isn't on the stack
+	void* head = pool->head;
+	do {
+		*(void**)block = head;
+	} while (!__atomic_compare_exchange_n(&pool->head, &head, block, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	__atomic_fetch_add(&pool->free_count, 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+pool_t pool_create_static(size_t block_size, uint32_t count, void* storage) {
+	if (block_size == 0 || count == 0 || storage == NULL || (uintptr_t)storage % POOL_ALIGNMENT) {
+		errno = EINVAL;
+		return NULL;
+	}
+	pool_s_t* pool = storage;
+	pool->stride = POOL_BLOCK_STRIDE(block_size);
+	pool->count = count;
+	pool->free_count = count;
+	// Link the blocks in order, so the first allocations are next to each other
+	uint8_t* blocks = pool_blocks(pool);
+	for (uint32_t i = 0; i < count; i++) {
+		*(void**)(blocks + i * pool->stride) = i + 1 < count ? blocks + (i + 1) * pool->stride : NULL;
+	}
+	pool->head = blocks;
+	return pool;
+}
+
+void* pool_alloc(pool_t pool) {
+	if (pool == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	void* block = pool_pop(pool);
+	if (block == NULL) errno = ENOMEM;
+	return block;
+}
+
+int32_t pool_free(pool_t pool, void* block) {
+	if (pool == NULL || !pool_push(pool, block)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+void* pool_alloc_from_isr(pool_t pool) {
+	return pool ? pool_pop(pool) : NULL;
+}
+
+bool pool_free_from_isr(pool_t pool, void* block) {
+	return pool && pool_push(pool, block);
+}
+
+uint32_t pool_get_free(pool_t pool) {
+	return pool ? ((pool_s_t*)pool)->free_count : 0;
+}
@@ -31,6 +31,7 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "system/optimizers.h"
 
 #ifndef configINTERRUPT_CONTROLLER_BASE_ADDRESS
 	#error configINTERRUPT_CONTROLLER_BASE_ADDRESS must be defined.  See http://www.freertos.org/Using-FreeRTOS-on-Cortex-A-Embedded-Processors.html
@@ -86,12 +87,15 @@ this value. */
 (but the lowest) interrupt priority. */
 #define portUNMASK_VALUE				( 0xFFUL )
 
-/* Tasks are not created with a floating point context, but can be given a
-floating point context after they have been created.  A variable is stored as
-part of the tasks context that holds portNO_FLOATING_POINT_CONTEXT if the task
-does not have an FPU context, or any other value if the task does have an FPU
-context. */
-#define portNO_FLOATING_POINT_CONTEXT	( ( task_stack_t ) 0 )
+/* The FPU registers are switched lazily: a context switch leaves them as they
+are and disables the FPU, and the first floating point instruction a task runs
+afterwards traps into FreeRTOS_Undefined_Handler (portASM.S).  The handler saves
+the registers to the save area of the task which last used them and loads the
+current task's.  Each task's save area sits at the top of its stack, and the
+task's context holds a pointer to it. */
+#if( configUSE_TASK_FPU_SUPPORT != 2 )
+	#error The lazy FPU switch needs configUSE_TASK_FPU_SUPPORT set to 2
+#endif
 
 /* Constants required to setup the initial task context. */
 #define portINITIAL_SPSR				( ( task_stack_t ) 0x1f ) /* System mode, ARM mode, IRQ enabled FIQ enabled. */
@@ -148,8 +152,10 @@ debugger. */
 #endif
 
 /* The space on the stack required to hold the FPU registers.  This is 32 64-bit
-registers, plus a 32-bit status register. */
+registers, plus a 32-bit status register.  The save area takes one more word so
+that the rest of the stack stays 8 byte aligned. */
 #define portFPU_REGISTER_WORDS	( ( 32 * 2 ) + 1 )
+#define portFPU_CONTEXT_WORDS	( portFPU_REGISTER_WORDS + 1 )
 
 /*-----------------------------------------------------------*/
 
@@ -194,9 +200,13 @@ the scheduler starts.  As it is stored as part of the task context it will
 automatically be set to 0 when the first task is started. */
 volatile uint32_t ulCriticalNesting = 9999UL;
 
-/* Saved as part of the task context.  If ulPortTaskHasFPUContext is non-zero then
-a floating point context must be saved and restored for the task. */
-volatile uint32_t ulPortTaskHasFPUContext = pdFALSE;
+/* Saved as part of the task context, the running task's FPU save area.  NULL
+before the scheduler starts. */
+task_stack_t * volatile pxPortTaskFPUContext = NULL;
+
+/* The save area of the task whose registers the FPU holds, or NULL if they
+belong to nobody (an exception handler used the FPU last). */
+task_stack_t * volatile pxPortFPUOwner = NULL;
 
 /* Set to 1 to pend a context switch from an ISR. */
 volatile uint32_t ulPortYieldRequired = pdFALSE;
@@ -224,6 +234,14 @@ void task_clean_up() {
  */
 task_stack_t *pxPortInitialiseStack( task_stack_t *pxTopOfStack, task_fn_t pxCode, void *pvParameters )
 {
+task_stack_t *pxFPUContext;
+
+	/* The FPU save area takes the top of the stack, with the registers
+	initialised to 0. */
+	pxFPUContext = pxTopOfStack - ( portFPU_CONTEXT_WORDS - 1 );
+	memset( pxFPUContext, 0x00, portFPU_REGISTER_WORDS * sizeof( task_stack_t ) );
+	pxTopOfStack = pxFPUContext - 1;
+
 	/* Setup the initial stack of the task.  The stack is set exactly as
 	expected by the portRESTORE_CONTEXT() macro.
 
@@ -285,30 +303,10 @@ task_stack_t *pxPortInitialiseStack( task_stack_t *pxTopOfStack, task_fn_t pxCod
 	enabled. */
 	*pxTopOfStack = portNO_CRITICAL_NESTING;
 
-	#if( configUSE_TASK_FPU_SUPPORT == 1 )
-	{
-		/* The task will start without a floating point context.  A task that
-		uses the floating point hardware must call vPortTaskUsesFPU() before
-		executing any floating point instructions. */
-		pxTopOfStack--;
-		*pxTopOfStack = portNO_FLOATING_POINT_CONTEXT;
-	}
-	#elif( configUSE_TASK_FPU_SUPPORT == 2 )
-	{
-		/* The task will start with a floating point context.  Leave enough
-		space for the registers - and ensure they are initialised to 0. */
-		pxTopOfStack -= portFPU_REGISTER_WORDS;
-		memset( pxTopOfStack, 0x00, portFPU_REGISTER_WORDS * sizeof( task_stack_t ) );
-
-		pxTopOfStack--;
-		*pxTopOfStack = pdTRUE;
-		ulPortTaskHasFPUContext = pdTRUE;
-	}
-	#else
-	{
-		#error Invalid configUSE_TASK_FPU_SUPPORT setting - configUSE_TASK_FPU_SUPPORT must be set to 1, 2, or left undefined.
-	}
-	#endif
+	/* The context holds a pointer to the FPU save area rather than the
+	registers themselves. */
+	pxTopOfStack--;
+	*pxTopOfStack = ( task_stack_t ) pxFPUContext;
 
 	return pxTopOfStack;
 }
@@ -456,8 +454,18 @@ void vPortExitCritical( void )
 }
 /*-----------------------------------------------------------*/
 
-void FreeRTOS_Tick_Handler( void )
+/* The sampling profiler, see system/profiler.c. */
+extern volatile uint32_t profiler_running;
+void profiler_sample( void );
+
+__pros_fast void FreeRTOS_Tick_Handler( void )
 {
+	/* Record where the tick interrupted while the profiler runs. */
+	if( __builtin_expect( profiler_running, 0 ) != 0 )
+	{
+		profiler_sample();
+	}
+
 	/* Set interrupt mask before altering scheduler structures.   The tick
 	handler runs at the lowest priority, so interrupts cannot already be masked,
 	so there is no need to save and restore the current mask value.  It is
@@ -481,21 +489,21 @@ void FreeRTOS_Tick_Handler( void )
 }
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TASK_FPU_SUPPORT != 2 )
-
-	void vPortTaskUsesFPU( void )
+void vPortCleanUpFPUContext( void *pxTCB )
+{
+task_stack_t *pxFPUContext;
+
+	/* A deleted task is never running, so its saved context starts with the
+	pointer to its FPU save area.  Make sure the save area, which is about to be
+	freed with the stack, is not written to by the next FPU trap. */
+	portENTER_CRITICAL();
+	pxFPUContext = ( task_stack_t * ) **( task_stack_t *** ) pxTCB;
+	if( pxPortFPUOwner == pxFPUContext )
 	{
-	uint32_t ulInitialFPSCR = 0;
-
-		/* A task is registering the fact that it needs an FPU context.  Set the
-		FPU flag (which is saved as part of the task context). */
-		ulPortTaskHasFPUContext = pdTRUE;
-
-		/* Initialise the floating point status register. */
-		__asm volatile ( "FMXR 	FPSCR, %0" :: "r" (ulInitialFPSCR) : "memory" );
+		pxPortFPUOwner = NULL;
 	}
-
-#endif /* configUSE_TASK_FPU_SUPPORT */
+	portEXIT_CRITICAL();
+}
 /*-----------------------------------------------------------*/
 
 void vPortClearInterruptMask( uint32_t ulNewMaskValue )
@@ -175,6 +175,18 @@ static int32_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemTo
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const buffer ) ;
 
+/*
+ * PROS extension: gets the slot holding the item at the front of a queue.
+ */
+static int8_t *prvGetFrontSlot( const Queue_t * const pxQueue ) ;
+
+/*
+ * PROS extension: the body of queue_peek() and queue_peek_front_ptr(). If
+ * xByReference is set, a pointer to the front item is stored in buffer instead
+ * of a copy of the item.
+ */
+static int32_t prvQueuePeek( queue_t queue, void * const buffer, uint32_t timeout, const int32_t xByReference ) ;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -569,6 +581,36 @@ static void prvInitialiseNewQueue( const uint32_t uxQueueLength, const uint32_t
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	int32_t xQueueTakeMutexFor( queue_t xMutex, void* xHolder )
+	{
+	Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+	int32_t xReturn = pdFALSE;
+
+		/* Used by hybrid mutexes, which are taken without touching their queue
+		mutex while nobody else wants them.  Once another task does, the queue
+		mutex is taken on behalf of the task which already owns the hybrid mutex,
+		so that the waiting task blocks on it and the owner inherits the waiting
+		task's priority as usual.  The owner gives the queue mutex back itself. */
+		taskENTER_CRITICAL();
+		{
+			if( ( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxMutex->uxMessagesWaiting > ( uint32_t ) 0 ) )
+			{
+				pxMutex->uxMessagesWaiting--;
+				pxMutex->pxMutexHolder = ( int8_t * ) xHolder;
+				vTaskIncrementMutexHeldCountOf( xHolder );
+				xReturn = pdTRUE;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_RECURSIVE_MUTEXES == 1 )
 
 	int32_t xQueueGiveMutexRecursive( queue_t xMutex )
@@ -751,6 +793,16 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			queue is full. */
 			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
 			{
+				if( xCopyPosition == queueRESERVE_BACK )
+				{
+					/* PROS extension: hand the free slot to the caller, who
+					builds the item in place and publishes it with
+					queue_commit(). */
+					*( void ** ) pvItemToQueue = pxQueue->pcWriteTo;
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+
 				traceQUEUE_SEND( pxQueue );
 				xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
@@ -928,6 +980,82 @@ bool queue_append(queue_t queue, const void* item, uint32_t timeout) {
 	return xQueueGenericSend(queue, item, timeout, queueSEND_TO_BACK);
 }
 
+/** PROS extension: zero-copy sends **/
+void* queue_reserve_back(queue_t queue, uint32_t timeout) {
+	void* slot;
+	if (xQueueGenericSend(queue, &slot, timeout, queueRESERVE_BACK) != pdPASS) {
+		return NULL;
+	}
+	return slot;
+}
+
+bool queue_commit(queue_t queue)
+{
+Queue_t * const pxQueue = ( Queue_t * ) queue;
+
+	configASSERT( pxQueue );
+	configASSERT( pxQueue->uxItemSize != ( uint32_t ) 0U );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxQueue->uxMessagesWaiting >= pxQueue->uxLength )
+		{
+			taskEXIT_CRITICAL();
+			return pdFALSE;
+		}
+
+		/* The item is already in place, so this is prvCopyDataToQueue()
+		without the copy. */
+		traceQUEUE_SEND( pxQueue );
+		pxQueue->pcWriteTo += pxQueue->uxItemSize;
+		if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		pxQueue->uxMessagesWaiting++;
+
+		#if ( configUSE_QUEUE_SETS == 1 )
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* Tasks wait on the set rather than the queue, so tell the set
+			that the queue has an item. */
+			if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		#endif /* configUSE_QUEUE_SETS */
+		/* If there was a task waiting for data to arrive on the queue then
+		unblock it now. */
+		if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+	return pdPASS;
+}
+
 int32_t xQueueGenericSendFromISR( queue_t xQueue, const void * const pvItemToQueue, int32_t * const pxHigherPriorityTaskWoken, const int32_t xCopyPosition )
 {
 int32_t xReturn;
@@ -1606,6 +1734,64 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 /*-----------------------------------------------------------*/
 
 int32_t queue_peek(queue_t queue, void* const buffer, uint32_t timeout)
+{
+	return prvQueuePeek( queue, buffer, timeout, pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+void* queue_peek_front_ptr(queue_t queue, uint32_t timeout)
+{
+void *pvItem;
+
+	if( prvQueuePeek( queue, &pvItem, timeout, pdTRUE ) != pdPASS )
+	{
+		return NULL;
+	}
+	return pvItem;
+}
+/*-----------------------------------------------------------*/
+
+bool queue_release(queue_t queue)
+{
+Queue_t * const pxQueue = ( Queue_t * ) queue;
+
+	configASSERT( pxQueue );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxQueue->uxMessagesWaiting == ( uint32_t ) 0 )
+		{
+			taskEXIT_CRITICAL();
+			return pdFALSE;
+		}
+
+		/* This is the removal half of queue_recv(), without the copy. */
+		pxQueue->u.pcReadFrom = prvGetFrontSlot( pxQueue );
+		traceQUEUE_RECEIVE( pxQueue );
+		pxQueue->uxMessagesWaiting--;
+
+		if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+			{
+				queueYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static int32_t prvQueuePeek( queue_t queue, void * const buffer, uint32_t timeout, const int32_t xByReference )
 {
 int32_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
@@ -1646,7 +1832,14 @@ Queue_t * const pxQueue = ( Queue_t * ) queue;
 				data, not removing it. */
 				pcOriginalReadPosition = pxQueue->u.pcReadFrom;
 
-				prvCopyDataFromQueue( pxQueue, buffer );
+				if( xByReference != pdFALSE )
+				{
+					*( void ** ) buffer = prvGetFrontSlot( pxQueue );
+				}
+				else
+				{
+					prvCopyDataFromQueue( pxQueue, buffer );
+				}
 				traceQUEUE_PEEK( pxQueue );
 
 				/* The data is not being removed, so reset the read pointer. */
@@ -2124,6 +2317,18 @@ uint32_t uxMessagesWaiting;
 }
 /*-----------------------------------------------------------*/
 
+static int8_t *prvGetFrontSlot( const Queue_t * const pxQueue )
+{
+int8_t *pcFront = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+
+	if( pcFront >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	{
+		pcFront = pxQueue->pcHead;
+	}
+	return pcFront;
+}
+/*-----------------------------------------------------------*/
+
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const buffer )
 {
 	if( pxQueue->uxItemSize != ( uint32_t ) 0 )
@@ -2849,6 +3054,42 @@ int32_t xReturn;
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
+/** PROS extension: queue sets **/
+queue_set_t queue_set_create(uint32_t length) {
+	if (length == 0) {
+		errno = EINVAL;
+		return NULL;
+	}
+	return xQueueCreateSet(length);
+}
+
+void queue_set_delete(queue_set_t set) {
+	queue_delete(set);
+}
+
+bool queue_set_add(queue_set_t set, void* member) {
+	if (xQueueAddToSet(member, set) != pdPASS) {
+		errno = EINVAL;
+		return false;
+	}
+	return true;
+}
+
+bool queue_set_remove(queue_set_t set, void* member) {
+	if (xQueueRemoveFromSet(member, set) != pdPASS) {
+		errno = EINVAL;
+		return false;
+	}
+	return true;
+}
+
+void* queue_set_select(queue_set_t set, uint32_t timeout) {
+	void* member = xQueueSelectFromSet(set, timeout);
+	if (member == NULL) errno = ETIMEDOUT;
+	return member;
+}
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 	static int32_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const int32_t xCopyPosition )
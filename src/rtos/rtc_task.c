@@ -0,0 +1,204 @@
+/**
+ * \file rtos/rtc_task.c
+ *
+ * Run-to-completion tasks.
+ *
+ * Each priority has at most one executor, a task started along with the first
+ * handler at that priority. An executor keeps a list of its handlers which
+ * have activations waiting, and each time it's notified it runs the head of
+ * the list once, moving it to the back if it still has activations left, until
+ * the list is empty. The list is only touched in critical sections, so that
+ * interrupts can activate handlers too.
+ *
+ * A handler which is deleted while it runs is only marked, and the executor
+ * frees it once it returns.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "kapi.h"
+
+// NOTE: can't just include task.h because of redefinition that goes on in kapi
+//       include chain, so we just prototype what we need here
+void vTaskNotifyGiveFromISR(task_t xTaskToNotify, int32_t* pxHigherPriorityTaskWoken);
+
+// Below the system daemon, like work queues
+#define RTC_PRIORITY_LIMIT (TASK_PRIORITY_MAX - 2)
+
+typedef struct rtc_task_s {
+	struct rtc_task_s* next;  // In its executor's ready list, while queued
+	rtc_fn_t function;
+	void* param;
+	uint32_t prio;
+	uint32_t pending;  // Activations which haven't run yet
+	bool queued;
+	bool deleted;  // Deleted while its handler was running
+} rtc_task_s_t;
+
+typedef struct rtc_executor_s {
+	task_t worker;
+	uint16_t stack_depth;  // 0 for the default
+	// Only touched in critical sections
+	rtc_task_s_t* head;
+	rtc_task_s_t* tail;
+	rtc_task_s_t* running;
+} rtc_executor_s_t;
+
+static rtc_executor_s_t executors[RTC_PRIORITY_LIMIT];
+
+static void rtc_executor(void* param) {
+	rtc_executor_s_t* const ex = param;
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		while (true) {
+			portENTER_CRITICAL();
+			rtc_task_s_t* const task = ex->head;
+			if (task != NULL) {
+				ex->head = task->next;
+				if (--task->pending) {
+					// Back of the line, so that one busy handler doesn't starve the others
+					task->next = NULL;
+					if (ex->head == NULL) {
+						ex->head = task;
+					} else {
+						ex->tail->next = task;
+					}
+					ex->tail = task;
+				} else {
+					task->queued = false;
+					if (ex->head == NULL) ex->tail = NULL;
+				}
+			}
+			ex->running = task;
+			portEXIT_CRITICAL();
+			if (task == NULL) break;
+
+			task->function(task->param);
+
+			portENTER_CRITICAL();
+			ex->running = NULL;
+			bool const deleted = task->deleted;
+			portEXIT_CRITICAL();
+			if (deleted) kfree(task);
+		}
+	}
+}
+
+int32_t rtc_executor_set_stack_depth(uint32_t prio, uint16_t stack_depth) {
+	if (prio >= RTC_PRIORITY_LIMIT || stack_depth < TASK_STACK_DEPTH_MIN) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	bool const started = executors[prio].worker != NULL;
+	if (!started) executors[prio].stack_depth = stack_depth;
+	rtos_resume_all();
+	if (started) {
+		errno = EBUSY;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+rtc_task_t rtc_task_create(rtc_fn_t function, void* param, uint32_t prio) {
+	if (function == NULL || prio >= RTC_PRIORITY_LIMIT) {
+		errno = EINVAL;
+		return NULL;
+	}
+	rtc_executor_s_t* const ex = &executors[prio];
+	if (ex->worker == NULL) {
+		char name[TASK_NAME_MAX_LEN];
+		snprintf(name, sizeof(name), "RTC Executor %lu (PROS)", prio);
+		// Created with the scheduler suspended, so two tasks can't both start one
+		rtos_suspend_all();
+		if (ex->worker == NULL) {
+			uint16_t const depth = ex->stack_depth ? ex->stack_depth : RTC_EXECUTOR_STACK_DEPTH_DEFAULT;
+			ex->worker = task_create(rtc_executor, ex, prio, depth, name);
+		}
+		rtos_resume_all();
+		if (ex->worker == NULL) {
+			errno = ENOMEM;
+			return NULL;
+		}
+	}
+	rtc_task_s_t* const task = kmalloc(sizeof(*task));
+	if (task == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	*task = (rtc_task_s_t){.function = function, .param = param, .prio = prio};
+	return task;
+}
+
+void rtc_task_delete(rtc_task_t handle) {
+	rtc_task_s_t* const task = handle;
+	if (task == NULL) return;
+	rtc_executor_s_t* const ex = &executors[task->prio];
+	portENTER_CRITICAL();
+	if (task->queued) {
+		rtc_task_s_t** link = &ex->head;
+		rtc_task_s_t* prev = NULL;
+		while (*link != task) {
+			prev = *link;
+			link = &prev->next;
+		}
+		*link = task->next;
+		if (ex->tail == task) ex->tail = prev;
+		task->queued = false;
+	}
+	task->pending = 0;
+	bool const running = ex->running == task;
+	task->deleted = running;
+	portEXIT_CRITICAL();
+	if (!running) kfree(task);
+}
+
+// Called in a critical section. Returns the executor to notify, or NULL if the
+// task was already deleted
+static rtc_executor_s_t* rtc_task_enqueue(rtc_task_s_t* task) {
+	if (task->deleted) return NULL;
+	rtc_executor_s_t* const ex = &executors[task->prio];
+	if (task->pending != UINT32_MAX) task->pending++;
+	if (!task->queued) {
+		task->next = NULL;
+		if (ex->head == NULL) {
+			ex->head = task;
+		} else {
+			ex->tail->next = task;
+		}
+		ex->tail = task;
+		task->queued = true;
+	}
+	return ex;
+}
+
+int32_t rtc_task_activate(rtc_task_t task) {
+	if (task == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	portENTER_CRITICAL();
+	rtc_executor_s_t* const ex = rtc_task_enqueue(task);
+	portEXIT_CRITICAL();
+	if (ex != NULL) task_notify(ex->worker);
+	return 1;
+}
+
+bool rtc_task_activate_from_isr(rtc_task_t task) {
+	if (task == NULL) return false;
+	uint32_t const saved = portSET_INTERRUPT_MASK_FROM_ISR();
+	rtc_executor_s_t* const ex = rtc_task_enqueue(task);
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(saved);
+	int32_t woken = false;
+	if (ex != NULL) vTaskNotifyGiveFromISR(ex->worker, &woken);
+	portYIELD_FROM_ISR(woken);
+	return true;
+}
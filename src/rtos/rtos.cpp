@@ -68,6 +68,14 @@ using namespace pros::c;
     return task_get_name(task);
   }
 
+  std::uint32_t Task::get_cpu_time(void) {
+    return task_get_cpu_time(task);
+  }
+
+  double Task::get_cpu_usage(void) {
+    return task_get_cpu_usage(task);
+  }
+
   std::uint32_t Task::notify(void) {
     return task_notify(task);
   }
@@ -92,10 +100,35 @@ using namespace pros::c;
     task_delay_until(prev_time, delta);
   }
 
+  void Task::delay_until_us(std::uint64_t* const prev_time, const std::uint32_t delta) {
+    task_delay_until_us(prev_time, delta);
+  }
+
   std::uint32_t Task::get_count(void) {
     return task_get_count();
   }
 
+  PeriodicTask::PeriodicTask(task_fn_t function, void* parameters, std::uint32_t period, std::uint32_t deadline,
+                             std::uint32_t prio, std::uint16_t stack_depth, const char* name)
+      : Task(static_cast<task_t>(nullptr)) {
+    task = task_create_periodic(function, parameters, period, deadline, prio, stack_depth, name);
+  }
+
+  PeriodicTask::~PeriodicTask(void) {
+    // The task may be in the middle of calling the callable
+    if (task != nullptr) remove();
+  }
+
+  periodic_task_stats_s_t PeriodicTask::get_stats(void) {
+    periodic_task_stats_s_t stats{};
+    task_get_periodic_stats(task, &stats);
+    return stats;
+  }
+
+  void PeriodicTask::set_miss_callback(periodic_miss_fn_t callback, void* param) {
+    task_set_deadline_miss_callback(task, callback, param);
+  }
+
   Mutex::Mutex(void) : mutex(mutex_create()) { }
 
   bool Mutex::take(std::uint32_t timeout) {
@@ -105,4 +138,159 @@ using namespace pros::c;
   bool Mutex::give(void) {
     return mutex_give(mutex);
   }
+
+  static_assert(sizeof(static_queue_s_t) == detail::static_queue_size, "detail::static_queue_size is out of date");
+  static_assert(configNUM_THREAD_LOCAL_STORAGE_POINTERS == detail::thread_local_storage_pointers,
+                "detail::thread_local_storage_pointers is out of date");
+  static_assert(sizeof(static_task_s_t) == sizeof(detail::StaticTaskControl) &&
+                    alignof(static_task_s_t) == alignof(detail::StaticTaskControl),
+                "detail::StaticTaskControl is out of date");
+  static_assert(POOL_HEADER_SIZE == detail::pool_header_size && POOL_ALIGNMENT == detail::pool_alignment,
+                "detail::pool_header_size or detail::pool_alignment is out of date");
+  static_assert(MESSAGE_BUFFER_HEADER_SIZE == detail::message_buffer_header_size &&
+                    EVENT_GROUP_STORAGE_SIZE == detail::event_group_storage_size,
+                "detail::message_buffer_header_size or detail::event_group_storage_size is out of date");
+  static_assert(WORK_QUEUE_INLINE_SIZE == detail::work_queue_inline_size,
+                "detail::work_queue_inline_size is out of date");
+
+  task_t detail::task_create_static(task_fn_t function, void* parameters, std::uint32_t prio, std::size_t stack_words,
+                                    const char* name, std::uint32_t* stack, StaticTaskControl* control) {
+    return ::task_create_static(function, parameters, prio, stack_words, name, stack,
+                                reinterpret_cast<static_task_s_t*>(control));
+  }
+
+  queue_t detail::queue_create_static(std::uint32_t length, std::uint32_t item_size, std::uint8_t* storage,
+                                      void* control) {
+    return ::queue_create_static(length, item_size, storage, static_cast<static_queue_s_t*>(control));
+  }
+
+  Semaphore::Semaphore(std::uint32_t max_count, std::uint32_t init_count) : sem(sem_create(max_count, init_count)) { }
+
+  Semaphore::Semaphore(Semaphore&& other) noexcept : sem(other.sem) {
+    other.sem = nullptr;
+  }
+
+  Semaphore& Semaphore::operator = (Semaphore&& other) noexcept {
+    if (this != &other) {
+      if (sem != nullptr) sem_delete(sem);
+      sem = other.sem;
+      other.sem = nullptr;
+    }
+    return *this;
+  }
+
+  Semaphore::~Semaphore(void) {
+    if (sem != nullptr) sem_delete(sem);
+  }
+
+  bool Semaphore::wait(std::uint32_t timeout) {
+    return sem_wait(sem, timeout);
+  }
+
+  bool Semaphore::post(void) {
+    return sem_post(sem);
+  }
+
+  std::uint32_t Semaphore::get_count(void) {
+    return sem_get_count(sem);
+  }
+
+  QueueSet::QueueSet(std::uint32_t length) : set(queue_set_create(length)) { }
+
+  QueueSet::~QueueSet(void) {
+    if (set != nullptr) queue_set_delete(set);
+  }
+
+  bool QueueSet::add(Semaphore& sem) {
+    return queue_set_add(set, sem.sem);
+  }
+
+  bool QueueSet::add(void* member) {
+    return queue_set_add(set, member);
+  }
+
+  bool QueueSet::remove(Semaphore& sem) {
+    return queue_set_remove(set, sem.sem);
+  }
+
+  bool QueueSet::remove(void* member) {
+    return queue_set_remove(set, member);
+  }
+
+  void* QueueSet::select(std::uint32_t timeout) {
+    return queue_set_select(set, timeout);
+  }
+
+  RecursiveMutex::RecursiveMutex(void) : mutex(mutex_recursive_create()) { }
+
+  RecursiveMutex::RecursiveMutex(RecursiveMutex&& other) noexcept : mutex(other.mutex) {
+    other.mutex = nullptr;
+  }
+
+  RecursiveMutex& RecursiveMutex::operator = (RecursiveMutex&& other) noexcept {
+    if (this != &other) {
+      if (mutex != nullptr) sem_delete(mutex);
+      mutex = other.mutex;
+      other.mutex = nullptr;
+    }
+    return *this;
+  }
+
+  RecursiveMutex::~RecursiveMutex(void) {
+    // mutexes are semaphores underneath
+    if (mutex != nullptr) sem_delete(mutex);
+  }
+
+  bool RecursiveMutex::take(std::uint32_t timeout) {
+    return mutex_recursive_take(mutex, timeout);
+  }
+
+  bool RecursiveMutex::give(void) {
+    return mutex_recursive_give(mutex);
+  }
+
+  CeilingMutex::CeilingMutex(std::uint32_t ceiling) : mutex(mutex_create_ceiling(ceiling)) { }
+
+  CeilingMutex::CeilingMutex(CeilingMutex&& other) noexcept : mutex(other.mutex) {
+    other.mutex = nullptr;
+  }
+
+  CeilingMutex& CeilingMutex::operator = (CeilingMutex&& other) noexcept {
+    if (this != &other) {
+      if (mutex != nullptr) sem_delete(mutex);
+      mutex = other.mutex;
+      other.mutex = nullptr;
+    }
+    return *this;
+  }
+
+  CeilingMutex::~CeilingMutex(void) {
+    if (mutex != nullptr) sem_delete(mutex);
+  }
+
+  bool CeilingMutex::take(std::uint32_t timeout) {
+    return mutex_take(mutex, timeout);
+  }
+
+  bool CeilingMutex::give(void) {
+    return mutex_give(mutex);
+  }
+
+  EventGroup::EventGroup(void) : group(event_group_create_static(storage)) { }
+
+  std::uint32_t EventGroup::set(std::uint32_t bits) {
+    return event_group_set(group, bits);
+  }
+
+  std::uint32_t EventGroup::clear(std::uint32_t bits) {
+    return event_group_clear(group, bits);
+  }
+
+  std::uint32_t EventGroup::get(void) const {
+    return event_group_get(group);
+  }
+
+  std::uint32_t EventGroup::wait(std::uint32_t bits, bool wait_for_all, bool clear_on_exit, std::uint32_t timeout) {
+    return event_group_wait(group, bits, wait_for_all, clear_on_exit, timeout);
+  }
 }
@@ -1,5 +1,8 @@
+#include <errno.h>
+
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
 
 /**
  * semphr. h
@@ -194,11 +197,67 @@ mutex_t mutex_create(void) {
 	return (mutex_t)xQueueCreateMutex(queueQUEUE_TYPE_MUTEX);
 }
 
+// Priority ceiling mutexes are ordinary mutexes of their own queue type, with
+// the ceiling kept after the queue. A task is raised to the ceiling before it
+// takes the mutex (the immediate ceiling protocol), so as long as the ceiling
+// is at least the priority of every task which uses the mutex, none of them can
+// run and block on it while it's held. Their owners never inherit anything from
+// them, so nothing chains.
+typedef struct ceiling_mutex {
+	static_sem_s_t sem;  // First, so the handle is the queue's
+	uint32_t ceiling;
+	uint32_t saved_priority;  // The owner's base priority from before it took the mutex
+} ceiling_mutex_s_t;
+
+mutex_t mutex_create_ceiling(uint32_t ceiling) {
+	if (ceiling < 1 || ceiling > configMAX_PRIORITIES) {
+		errno = EINVAL;
+		return NULL;
+	}
+	ceiling_mutex_s_t* mutex = kmalloc(sizeof(*mutex));
+	if (mutex == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	mutex->ceiling = ceiling;
+	mutex->saved_priority = 0;
+	return xQueueCreateMutexStatic(queueQUEUE_TYPE_CEILING_MUTEX, &mutex->sem);
+}
+
+static uint8_t ceiling_mutex_take(ceiling_mutex_s_t* mutex, uint32_t timeout) {
+	uint32_t const prio = task_get_base_priority(NULL);
+	if (prio > mutex->ceiling) {
+		errno = EINVAL;
+		return false;
+	}
+	if (prio < mutex->ceiling) task_set_priority(NULL, mutex->ceiling);
+	if (!xQueueSemaphoreTake((queue_t)mutex, timeout)) {
+		if (prio < mutex->ceiling) task_set_priority(NULL, prio);
+		return false;
+	}
+	mutex->saved_priority = prio;
+	return true;
+}
+
+static uint8_t ceiling_mutex_give(ceiling_mutex_s_t* mutex) {
+	if (xQueueGetMutexHolder((queue_t)mutex) != task_get_current()) {
+		errno = EPERM;
+		return false;
+	}
+	// Read before the mutex is given, since the next owner overwrites it
+	uint32_t const prio = mutex->saved_priority;
+	if (!xQueueGenericSend((queue_t)mutex, NULL, semGIVE_BLOCK_TIME, queueSEND_TO_BACK)) return false;
+	if (prio < mutex->ceiling) task_set_priority(NULL, prio);
+	return true;
+}
+
 uint8_t mutex_give(mutex_t mutex) {
+	if (ucQueueGetQueueType(mutex) == queueQUEUE_TYPE_CEILING_MUTEX) return ceiling_mutex_give(mutex);
 	return xQueueGenericSend((queue_t)(mutex), NULL, semGIVE_BLOCK_TIME, queueSEND_TO_BACK);
 }
 
 uint8_t mutex_take(mutex_t mutex, uint32_t timeout) {
+	if (ucQueueGetQueueType(mutex) == queueQUEUE_TYPE_CEILING_MUTEX) return ceiling_mutex_take(mutex, timeout);
 	return xQueueSemaphoreTake( ( mutex ), ( timeout ) );
 }
 
@@ -516,7 +575,10 @@ sem_t sem_create(uint32_t max_count, uint32_t init_count) {
 }
 
 void sem_delete(sem_t sem) {
+	bool const ceiling = ucQueueGetQueueType(sem) == queueQUEUE_TYPE_CEILING_MUTEX;
 	queue_delete((queue_t)(sem));
+	// The queue is statically allocated inside the ceiling mutex, so queue_delete() leaves it
+	if (ceiling) kfree(sem);
 }
 
 task_t mutex_get_owner(mutex_t mutex) {
@@ -134,6 +134,21 @@ that uses task notifications. */
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_SPSC					( ( uint8_t ) 4 ) /* Set if the stream buffer was created by stream_buf_create_spsc_static(). */
+
+/* PROS extension: the reader only ever writes xTail and the writer only ever
+writes xHead.  Each side publishes its index with release semantics after
+touching the data, and loads the other side's index with acquire semantics
+before touching the data, so the data copies themselves need no critical
+section. */
+#define sbLOAD_INDEX( xIndex )			__atomic_load_n( &( xIndex ), __ATOMIC_ACQUIRE )
+#define sbPUBLISH_INDEX( xIndex, xValue ) __atomic_store_n( &( xIndex ), ( xValue ), __ATOMIC_RELEASE )
+
+/* PROS extension: single producer, single consumer buffers only go through
+the scheduler when the other side is actually blocked.  This is safe because
+a task only blocks after checking the buffer inside a critical section, which
+the other side can't interrupt. */
+#define sbIS_SPSC( pxStreamBuffer ) ( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_SPSC ) != ( uint8_t ) 0 )
 
 /*-----------------------------------------------------------*/
 
@@ -455,7 +470,7 @@ size_t xSpace;
 
 	configASSERT( pxStreamBuffer );
 
-	xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
+	xSpace = pxStreamBuffer->xLength + sbLOAD_INDEX( pxStreamBuffer->xTail );
 	xSpace -= pxStreamBuffer->xHead;
 	xSpace -= ( size_t ) 1;
 
@@ -510,6 +525,17 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
+	/* Single producer, single consumer buffers skip the critical section when
+	there's already room, since the space can only grow until we write. */
+	if( sbIS_SPSC( pxStreamBuffer ) && ( xTicksToWait != ( uint32_t ) 0 ) )
+	{
+		xSpace = stream_buf_get_unused( pxStreamBuffer );
+		if( xSpace >= xRequiredSpace )
+		{
+			xTicksToWait = 0;
+		}
+	}
+
 	if( xTicksToWait != ( uint32_t ) 0 )
 	{
 		vTaskSetTimeOutState( &xTimeOut );
@@ -566,7 +592,11 @@ TimeOut_t xTimeOut;
 		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
 
 		/* Was a task waiting for the data? */
-		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		if( sbIS_SPSC( pxStreamBuffer ) && ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) )
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		else if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
 			sbSEND_COMPLETED( pxStreamBuffer );
 		}
@@ -713,6 +743,14 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
+	/* Single producer, single consumer buffers skip the critical section when
+	there's already data, since the data can only grow until we read. */
+	if( sbIS_SPSC( pxStreamBuffer ) && ( xTicksToWait != ( uint32_t ) 0 ) &&
+		( prvBytesInBuffer( pxStreamBuffer ) > xBytesToStoreMessageLength ) )
+	{
+		xTicksToWait = 0;
+	}
+
 	if( xTicksToWait != ( uint32_t ) 0 )
 	{
 		/* Checking if there is data and clearing the notification state must be
@@ -775,7 +813,10 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		if( xReceivedLength != ( size_t ) 0 )
 		{
 			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-			sbRECEIVE_COMPLETED( pxStreamBuffer );
+			if( !sbIS_SPSC( pxStreamBuffer ) || ( pxStreamBuffer->xTaskWaitingToSend != NULL ) )
+			{
+				sbRECEIVE_COMPLETED( pxStreamBuffer );
+			}
 		}
 		else
 		{
@@ -792,6 +833,113 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 }
 /*-----------------------------------------------------------*/
 
+size_t stream_buf_peek_contiguous( stream_buf_t xStreamBuffer, uint8_t **ppucData )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as stream_buf_t is opaque Streambuffer_t. */
+size_t xTail, xBytesAvailable;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ppucData );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	xTail = pxStreamBuffer->xTail;
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	*ppucData = &( pxStreamBuffer->pucBuffer[ xTail ] );
+
+	return configMIN( xBytesAvailable, pxStreamBuffer->xLength - xTail );
+}
+/*-----------------------------------------------------------*/
+
+size_t stream_buf_consume( stream_buf_t xStreamBuffer, size_t xCount )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as stream_buf_t is opaque Streambuffer_t. */
+size_t xNextTail;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	xCount = configMIN( xCount, prvBytesInBuffer( pxStreamBuffer ) );
+	if( xCount > ( size_t ) 0 )
+	{
+		xNextTail = pxStreamBuffer->xTail + xCount;
+		if( xNextTail >= pxStreamBuffer->xLength )
+		{
+			xNextTail -= pxStreamBuffer->xLength;
+		}
+		sbPUBLISH_INDEX( pxStreamBuffer->xTail, xNextTail );
+		if( !sbIS_SPSC( pxStreamBuffer ) || ( pxStreamBuffer->xTaskWaitingToSend != NULL ) )
+		{
+			sbRECEIVE_COMPLETED( pxStreamBuffer );
+		}
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+size_t stream_buf_peek_free( stream_buf_t xStreamBuffer, uint8_t **ppucData )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as stream_buf_t is opaque Streambuffer_t. */
+size_t xHead;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ppucData );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	xHead = pxStreamBuffer->xHead;
+	*ppucData = &( pxStreamBuffer->pucBuffer[ xHead ] );
+
+	return configMIN( stream_buf_get_unused( pxStreamBuffer ), pxStreamBuffer->xLength - xHead );
+}
+/*-----------------------------------------------------------*/
+
+size_t stream_buf_commit( stream_buf_t xStreamBuffer, size_t xCount )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer; /*lint !e9087 !e9079 Safe cast as stream_buf_t is opaque Streambuffer_t. */
+size_t xNextHead;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	xCount = configMIN( xCount, stream_buf_get_unused( pxStreamBuffer ) );
+	if( xCount > ( size_t ) 0 )
+	{
+		xNextHead = pxStreamBuffer->xHead + xCount;
+		if( xNextHead >= pxStreamBuffer->xLength )
+		{
+			xNextHead -= pxStreamBuffer->xLength;
+		}
+		sbPUBLISH_INDEX( pxStreamBuffer->xHead, xNextHead );
+		if( sbIS_SPSC( pxStreamBuffer ) && ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) )
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		else if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+stream_buf_t stream_buf_create_spsc_static( size_t xBufferSizeBytes,
+											uint8_t * const pucStreamBufferStorageArea,
+											static_stream_buf_s_t * const pxStaticStreamBuffer )
+{
+StreamBuffer_t *pxStreamBuffer;
+
+	pxStreamBuffer = ( StreamBuffer_t * ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 1, pdFALSE, pucStreamBufferStorageArea, pxStaticStreamBuffer );
+	if( pxStreamBuffer != NULL )
+	{
+		pxStreamBuffer->ucFlags |= sbFLAGS_IS_SPSC;
+	}
+
+	return ( stream_buf_t ) pxStreamBuffer;
+}
+/*-----------------------------------------------------------*/
+
 size_t xStreamBufferReceiveFromISR( stream_buf_t xStreamBuffer,
 									void *pvRxData,
 									size_t xBufferLengthBytes,
@@ -1057,7 +1205,7 @@ size_t xNextHead, xFirstLength;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
+	sbPUBLISH_INDEX( pxStreamBuffer->xHead, xNextHead );
 
 	return xCount;
 }
@@ -1107,7 +1255,7 @@ size_t xCount, xFirstLength, xNextTail;
 			xNextTail -= pxStreamBuffer->xLength;
 		}
 
-		pxStreamBuffer->xTail = xNextTail;
+		sbPUBLISH_INDEX( pxStreamBuffer->xTail, xNextTail );
 	}
 	else
 	{
@@ -1123,7 +1271,7 @@ static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
 /* Returns the distance between xTail and xHead. */
 size_t xCount;
 
-	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+	xCount = pxStreamBuffer->xLength + sbLOAD_INDEX( pxStreamBuffer->xHead );
 	xCount -= pxStreamBuffer->xTail;
 	if ( xCount >= pxStreamBuffer->xLength )
 	{
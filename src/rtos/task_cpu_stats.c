@@ -0,0 +1,174 @@
+/**
+ * \file rtos/task_cpu_stats.c
+ *
+ * Per-task CPU usage.
+ *
+ * FreeRTOS credits each task with the microseconds it ran for whenever it is
+ * switched out. Once per window, a software timer snapshots those counters to
+ * work out the share of the window each task used, and optionally prints a
+ * table of them, busiest first, on the kdbg stream.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+typedef void* sw_timer_t;
+typedef void (*timer_fn_t)(void*);
+sw_timer_t timer_create(timer_fn_t callback, void* param, uint32_t period, bool periodic);
+int32_t timer_start(sw_timer_t timer);
+// from system/overload.c
+void overload_account(uint32_t priority, uint32_t usage);
+void overload_evaluate(void);
+#define KDBG_FILENO 3
+
+#define CPU_STATS_WINDOW 1000
+#define CPU_STATS_LINE_LEN (configMAX_TASK_NAME_LEN + 24)
+
+typedef struct cpu_sample_s {
+	task_t task;
+	uint32_t run_time;  // The task's run time counter at the end of the window
+	uint32_t usage;     // The share of the window the task ran for in hundredths of a percent
+} cpu_sample_s_t;
+
+// Only the timer task touches the status array and the spare sample array
+static TaskStatus_t* statuses;
+static cpu_sample_s_t* spare_samples;
+static uint32_t capacity;
+static uint32_t last_total;
+static uint32_t report_elapsed;
+
+// Read by other tasks, so swapped with the scheduler suspended
+static cpu_sample_s_t* samples;
+static uint32_t sample_count;
+static volatile uint32_t report_period;
+
+static cpu_sample_s_t* cpu_stats_find(cpu_sample_s_t* const list, const uint32_t count, const task_t task) {
+	for (uint32_t i = 0; i < count; i++) {
+		if (list[i].task == task) return &list[i];
+	}
+	return NULL;
+}
+
+static bool cpu_stats_grow(uint32_t needed) {
+	TaskStatus_t* new_statuses = kmalloc(needed * sizeof(*new_statuses));
+	cpu_sample_s_t* new_samples = kmalloc(needed * sizeof(*new_samples));
+	cpu_sample_s_t* new_spare = kmalloc(needed * sizeof(*new_spare));
+	if (new_statuses == NULL || new_samples == NULL || new_spare == NULL) {
+		kfree(new_statuses);
+		kfree(new_samples);
+		kfree(new_spare);
+		return false;
+	}
+	kfree(statuses);
+	kfree(spare_samples);
+	statuses = new_statuses;
+	spare_samples = new_spare;
+
+	rtos_suspend_all();
+	if (sample_count) memcpy(new_samples, samples, sample_count * sizeof(*samples));
+	cpu_sample_s_t* old_samples = samples;
+	samples = new_samples;
+	rtos_resume_all();
+	kfree(old_samples);
+
+	capacity = needed;
+	return true;
+}
+
+static void cpu_stats_report(const uint32_t count, const uint32_t window) {
+	// Sort the busiest tasks first, there are only ever a few dozen
+	for (uint32_t i = 1; i < count; i++) {
+		for (uint32_t j = i; j > 0 && spare_samples[j - 1].usage < spare_samples[j].usage; j--) {
+			cpu_sample_s_t sample = spare_samples[j];
+			spare_samples[j] = spare_samples[j - 1];
+			spare_samples[j - 1] = sample;
+			TaskStatus_t status = statuses[j];
+			statuses[j] = statuses[j - 1];
+			statuses[j - 1] = status;
+		}
+	}
+
+	// Format everything before writing, since the names are only valid until a task is cleaned up
+	size_t size = (count + 2) * CPU_STATS_LINE_LEN;
+	char* buf = kmalloc(size);
+	if (buf == NULL) return;
+	size_t len = snprintf(buf, size, "CPU usage over %lu ms:\n  %%CPU  time (ms)  task\n", window / 1000);
+	for (uint32_t i = 0; i < count && len < size; i++) {
+		len += snprintf(buf + len, size - len, "%3lu.%02lu %10lu  %s\n", spare_samples[i].usage / 100,
+		                spare_samples[i].usage % 100, spare_samples[i].run_time / 1000, statuses[i].pcTaskName);
+	}
+	write(KDBG_FILENO, buf, len < size ? len : size - 1);
+	kfree(buf);
+}
+
+static void cpu_stats_sample(void* ign) {
+	// Leave room for a few tasks created while the snapshot is taken
+	uint32_t needed = task_get_count() + 4;
+	if (needed > capacity && !cpu_stats_grow(needed)) return;
+
+	uint32_t total;
+	uint32_t count = uxTaskGetSystemStateExt(statuses, capacity, &total, pdFALSE);
+	if (count == 0) return;
+	uint32_t window = total - last_total;
+	last_total = total;
+
+	for (uint32_t i = 0; i < count; i++) {
+		cpu_sample_s_t* prev = cpu_stats_find(samples, sample_count, statuses[i].xHandle);
+		uint32_t run_time = statuses[i].ulRunTimeCounter;
+		// A new or restarted task did all of its running in this window
+		uint32_t delta = (prev != NULL && run_time >= prev->run_time) ? run_time - prev->run_time : run_time;
+		if (delta > window) delta = window;
+		spare_samples[i] = (cpu_sample_s_t){.task = statuses[i].xHandle,
+		                                     .run_time = run_time,
+		                                     .usage = window ? (uint32_t)((uint64_t)delta * 10000 / window) : 0};
+		overload_account(statuses[i].uxBasePriority, spare_samples[i].usage);
+	}
+
+	// Report before publishing the samples, as the report reorders them
+	if (report_period != 0 && (report_elapsed += CPU_STATS_WINDOW) >= report_period) {
+		report_elapsed = 0;
+		cpu_stats_report(count, window);
+	}
+
+	rtos_suspend_all();
+	cpu_sample_s_t* old_samples = samples;
+	samples = spare_samples;
+	sample_count = count;
+	rtos_resume_all();
+	spare_samples = old_samples;
+	if (window != 0) overload_evaluate();
+}
+
+void task_cpu_stats_initialize(void) {
+	timer_start(timer_create(cpu_stats_sample, NULL, CPU_STATS_WINDOW, true));
+}
+
+double task_get_cpu_usage(task_t task) {
+	if (task == NULL) task = task_get_current();
+	double usage = 0;
+	rtos_suspend_all();
+	cpu_sample_s_t* sample = cpu_stats_find(samples, sample_count, task);
+	if (sample != NULL) usage = sample->usage / 100.0;
+	rtos_resume_all();
+	return usage;
+}
+
+void task_cpu_report_set_period(uint32_t period) {
+	rtos_suspend_all();
+	report_period = period;
+	report_elapsed = 0;
+	rtos_resume_all();
+}
@@ -1,11 +1,4 @@
 #include "kapi.h"
-#include "common/linkedlist.h"
-
-// NOTE: can't just include task.h because of redefinition that goes on in kapi
-//       include chain, so we just prototype what we need here
-void *pvTaskGetThreadLocalStoragePointer( task_t xTaskToQuery, int32_t xIndex );
-void vTaskSetThreadLocalStoragePointer( task_t xTaskToSet, int32_t xIndex, void *pvValue );
-
 #include "rtos/tcb.h"
 
 // This increments configNUM_THREAD_LOCAL_STORAGE_POINTERS by 2
@@ -13,41 +6,73 @@ void vTaskSetThreadLocalStoragePointer( task_t xTaskToSet, int32_t xIndex, void
 #define SUBSCRIBERS_TLSP_IDX 0
 #define SUBSCRIPTIONS_TLSP_IDX 1
 
+// Subscriptions taken from the pool before falling back to kmalloc. Enough for
+// a few tasks watching each other without touching the heap when tasks are
+// torn down between competition modes
+#define NOTIFY_DELETE_POOL_COUNT 32
+
 static static_sem_s_t task_notify_when_deleting_mutex_buf;
 static mutex_t task_notify_when_deleting_mutex;
 
+// One subscription, linked into both the target's list of subscribers and the
+// notified task's list of subscriptions. Each prev points at whatever link
+// points to the node, so the node can be unlinked from either list without
+// walking it
 struct notify_delete_action {
+  task_t target_task;
   task_t task_to_notify;
   uint32_t value;
   notify_action_e_t notify_action;
+  struct notify_delete_action* next_subscriber;
+  struct notify_delete_action** prev_subscriber;
+  struct notify_delete_action* next_subscription;
+  struct notify_delete_action** prev_subscription;
 };
 
-struct _find_task_args {
-  task_t task;
-  struct notify_delete_action* found_action;
-};
+static uint8_t action_pool_buf[POOL_STORAGE_SIZE(sizeof(struct notify_delete_action), NOTIFY_DELETE_POOL_COUNT)]
+    __attribute__((aligned(POOL_ALIGNMENT)));
+static pool_t action_pool;
 
-static void _find_task_cb(ll_node_s_t* node, void* extra) {
-  struct notify_delete_action* action = node->payload.data;
-  struct _find_task_args* args = extra;
+static struct notify_delete_action* _alloc_action(void) {
+  struct notify_delete_action* action = pool_alloc(action_pool);
+  if (action == NULL) {
+    action = kmalloc(sizeof(struct notify_delete_action));
+  }
+  return action;
+}
 
-  if(action->task_to_notify == args->task) {
-    args->found_action = action;
+static void _free_action(struct notify_delete_action* action) {
+  uint8_t* const block = (uint8_t*)action;
+  if (block >= action_pool_buf && block < action_pool_buf + sizeof(action_pool_buf)) {
+    pool_free(action_pool, action);
+  } else {
+    kfree(action);
   }
 }
 
-static struct notify_delete_action* _find_task(linked_list_s_t* ll, task_t task) {
-  struct _find_task_args args = {
-    .task = task,
-    .found_action = NULL
-  };
-  linked_list_foreach(ll, _find_task_cb, &args);
+static void _unlink_subscriber(struct notify_delete_action* action) {
+  *action->prev_subscriber = action->next_subscriber;
+  if (action->next_subscriber != NULL) {
+    action->next_subscriber->prev_subscriber = action->prev_subscriber;
+  }
+}
 
-  return args.found_action;
+static void _unlink_subscription(struct notify_delete_action* action) {
+  *action->prev_subscription = action->next_subscription;
+  if (action->next_subscription != NULL) {
+    action->next_subscription->prev_subscription = action->prev_subscription;
+  }
+}
+
+// The head of a task's list lives directly in its thread local storage pointer,
+// so the address of the list head is the address of that pointer
+static struct notify_delete_action** _list_head(task_t task, int32_t idx) {
+  return (struct notify_delete_action**)&((TCB_t*)task)->pvThreadLocalStoragePointers[idx];
 }
 
 void task_notify_when_deleting_init() {
   task_notify_when_deleting_mutex = mutex_create_static(&task_notify_when_deleting_mutex_buf);
+  action_pool = pool_create_static(sizeof(struct notify_delete_action), NOTIFY_DELETE_POOL_COUNT, action_pool_buf);
 }
 
 void task_notify_when_deleting(task_t target_task, task_t task_to_notify,
@@ -63,111 +88,65 @@ void task_notify_when_deleting(task_t target_task, task_t task_to_notify,
 
   mutex_take(task_notify_when_deleting_mutex, TIMEOUT_MAX);
 
-  // task_to_notify maintains a list of the tasks whose deletion it cares about.
-  // This will allow us to unsubscribe from notification if/when task_to_notify
-  // is deleted
-  linked_list_s_t* subscriptions_ll = pvTaskGetThreadLocalStoragePointer(task_to_notify, SUBSCRIPTIONS_TLSP_IDX);
-  if (subscriptions_ll == NULL) {
-    subscriptions_ll = linked_list_init();
-    vTaskSetThreadLocalStoragePointer(task_to_notify, SUBSCRIPTIONS_TLSP_IDX, subscriptions_ll);
-  }
-  if (subscriptions_ll != NULL) {
-    // check whether task_to_notify is already subscribed to target_task. if so,
-    // do nothing
-    ll_node_s_t* it = subscriptions_ll->head;
-    bool found = false;
-    while (it != NULL && !found) {
-      found = it->payload.data == target_task;
-      it = it->next;
-    }
-    if (!found) {
-      linked_list_prepend_data(subscriptions_ll, target_task);
-    }
-  }
-
-  // similarly, target_task maintains a list of the tasks it needs to notify
-  // when being deleted
-  linked_list_s_t* target_ll = pvTaskGetThreadLocalStoragePointer(target_task, SUBSCRIBERS_TLSP_IDX);
-  if (target_ll == NULL) {
-    target_ll = linked_list_init();
-    vTaskSetThreadLocalStoragePointer(target_task, SUBSCRIBERS_TLSP_IDX, target_ll);
+  // target_task keeps a list of the tasks it needs to notify when being
+  // deleted. If task_to_notify is already on it, just update the action
+  struct notify_delete_action** subscribers = _list_head(target_task, SUBSCRIBERS_TLSP_IDX);
+  struct notify_delete_action* action = *subscribers;
+  while (action != NULL && action->task_to_notify != task_to_notify) {
+    action = action->next_subscriber;
   }
 
-  if (target_ll != NULL) {
-    // Try to find the task_to_notify in the target linked list
-    // i.e., target_task was already configured to notify task_to_notify
-    struct notify_delete_action* action = _find_task(target_ll, task_to_notify);
-
-    // action wasn't found, so add it to the linked list
-    if (action == NULL) {
-      action = (struct notify_delete_action*)kmalloc(sizeof(struct notify_delete_action));
-      if (action != NULL) {
-        linked_list_prepend_data(target_ll, action);
-      }
-    }
-
-    // update the action (whether it was found or newly allocated)
+  if (action == NULL) {
+    action = _alloc_action();
     if (action != NULL) {
+      action->target_task = target_task;
       action->task_to_notify = task_to_notify;
-      action->notify_action = notify_action;
-      action->value = value;
-    }
-  }
-  mutex_give(task_notify_when_deleting_mutex);
-}
 
-// NOTE: this code is untested, probably works, but also has a terrible name (task_notify_when_deleting_unsubscribe)
-// void task_notify_when_deleting_unsubscribe(task_t target_task, task_t task_to_notify) {
-//   task_to_notify = (task_to_notify == NULL) ? pxCurrentTCB : task_to_notify;
-//   target_task = (target_task == NULL) ? pxCurrentTCB : target_task;
-//
-//   if (task_to_notify == target_task || !task_to_notify || !target_task) {
-//     return;
-//   }
-//
-//   linked_list_s_t* ll = pvTaskGetThreadLocalStoragePointer(target_task, TLSP_IDX);
-//   if (ll != NULL) {
-//     struct notify_delete_action* action = _find_task(ll, task_to_notify);
-//     if (action != NULL) {
-//       linked_list_remove_data(ll, action);
-//       kfree(action);
-//     }
-//   }
-// }
-
-static void unsubscribe_hook_cb(ll_node_s_t* node, void* task_to_remove) {
-  task_t subscription = node->payload.data;
-
-  linked_list_s_t* subscriptions_list = pvTaskGetThreadLocalStoragePointer(subscription, SUBSCRIBERS_TLSP_IDX);
-  if (subscriptions_list != NULL) {
-    linked_list_remove_data(subscriptions_list, task_to_remove);
+      action->next_subscriber = *subscribers;
+      action->prev_subscriber = subscribers;
+      if (*subscribers != NULL) {
+        (*subscribers)->prev_subscriber = &action->next_subscriber;
+      }
+      *subscribers = action;
+
+      // task_to_notify keeps the same node in its list of subscriptions, so it
+      // can be unsubscribed if/when task_to_notify is deleted first
+      struct notify_delete_action** subscriptions = _list_head(task_to_notify, SUBSCRIPTIONS_TLSP_IDX);
+      action->next_subscription = *subscriptions;
+      action->prev_subscription = subscriptions;
+      if (*subscriptions != NULL) {
+        (*subscriptions)->prev_subscription = &action->next_subscription;
+      }
+      *subscriptions = action;
+    }
   }
-}
 
-static void delete_hook_cb(ll_node_s_t* node, void* ignore) {
-  struct notify_delete_action* action = node->payload.data;
+  // update the action (whether it was found or newly allocated)
   if (action != NULL) {
-    task_notify_ext(action->task_to_notify, action->value, action->notify_action, NULL);
-    kfree(action);
-    node->payload.data = NULL;
+    action->notify_action = notify_action;
+    action->value = value;
   }
+  mutex_give(task_notify_when_deleting_mutex);
 }
 
 void task_notify_when_deleting_hook(task_t task) {
   mutex_take(task_notify_when_deleting_mutex, TIMEOUT_MAX);
   // if this task was subscribed to any other task deletion events, unsubscribe
-  linked_list_s_t* ll = pvTaskGetThreadLocalStoragePointer(task, SUBSCRIPTIONS_TLSP_IDX);
-  if (ll != NULL) {
-    linked_list_foreach(ll, unsubscribe_hook_cb, task);
-    linked_list_free(ll);
-    vTaskSetThreadLocalStoragePointer(task, SUBSCRIPTIONS_TLSP_IDX, NULL);
+  struct notify_delete_action** head = _list_head(task, SUBSCRIPTIONS_TLSP_IDX);
+  while (*head != NULL) {
+    struct notify_delete_action* action = *head;
+    _unlink_subscription(action);
+    _unlink_subscriber(action);
+    _free_action(action);
   }
   // notify subscribed tasks of this task's deletion
-  ll = pvTaskGetThreadLocalStoragePointer(task, SUBSCRIBERS_TLSP_IDX);
-  if (ll != NULL) {
-    linked_list_foreach(ll, delete_hook_cb, NULL);
-    linked_list_free(ll);
-    vTaskSetThreadLocalStoragePointer(task, SUBSCRIBERS_TLSP_IDX, NULL); // for good measure
+  head = _list_head(task, SUBSCRIBERS_TLSP_IDX);
+  while (*head != NULL) {
+    struct notify_delete_action* action = *head;
+    task_notify_ext(action->task_to_notify, action->value, action->notify_action, NULL);
+    _unlink_subscriber(action);
+    _unlink_subscription(action);
+    _free_action(action);
   }
   mutex_give(task_notify_when_deleting_mutex);
 }
@@ -0,0 +1,150 @@
+/**
+ * \file rtos/task_stack_stats.c
+ *
+ * Stack usage of every task.
+ *
+ * Every few seconds, a software timer reads the high water mark of each task's
+ * stack, i.e. the fewest words which have ever been left free on it. The
+ * lowest value seen is kept by task name, so tasks which come and go, such as
+ * the competition tasks, are still accounted for after they end.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+typedef void* sw_timer_t;
+typedef void (*timer_fn_t)(void*);
+sw_timer_t timer_create(timer_fn_t callback, void* param, uint32_t period, bool periodic);
+int32_t timer_start(sw_timer_t timer);
+#define KDBG_FILENO 3
+
+typedef struct task_stack_stats_s {
+	char name[configMAX_TASK_NAME_LEN];
+	uint32_t stack_size;
+	uint32_t min_free;
+} task_stack_stats_s_t;
+
+#define STACK_STATS_PERIOD 5000
+#define STACK_STATS_LINE_LEN (configMAX_TASK_NAME_LEN + 24)
+
+// Only the timer task touches the status array
+static TaskStatus_t* statuses;
+static uint32_t status_capacity;
+
+// Read by other tasks, so changed with the scheduler suspended
+static task_stack_stats_s_t* entries;
+static uint32_t entry_count;
+static uint32_t entry_capacity;
+
+static sw_timer_t report_timer;
+
+static bool stack_stats_reserve(const uint32_t tasks) {
+	if (tasks > status_capacity) {
+		TaskStatus_t* new_statuses = kmalloc(tasks * sizeof(*new_statuses));
+		if (new_statuses == NULL) return false;
+		kfree(statuses);
+		statuses = new_statuses;
+		status_capacity = tasks;
+	}
+	if (entry_count + tasks > entry_capacity) {
+		uint32_t capacity = entry_count + tasks;
+		task_stack_stats_s_t* new_entries = kmalloc(capacity * sizeof(*new_entries));
+		if (new_entries == NULL) return false;
+		rtos_suspend_all();
+		if (entry_count) memcpy(new_entries, entries, entry_count * sizeof(*entries));
+		task_stack_stats_s_t* old_entries = entries;
+		entries = new_entries;
+		entry_capacity = capacity;
+		rtos_resume_all();
+		kfree(old_entries);
+	}
+	return true;
+}
+
+static void stack_stats_sample(void* ign) {
+	// Leave room for a few tasks created while the snapshot is taken
+	if (!stack_stats_reserve(task_get_count() + 4)) return;
+	uint32_t count = uxTaskGetSystemStateExt(statuses, status_capacity, NULL, pdTRUE);
+
+	rtos_suspend_all();
+	for (uint32_t i = 0; i < count; i++) {
+		task_stack_stats_s_t* entry = NULL;
+		for (uint32_t j = 0; j < entry_count && entry == NULL; j++) {
+			if (strncmp(entries[j].name, statuses[i].pcTaskName, configMAX_TASK_NAME_LEN) == 0) entry = &entries[j];
+		}
+		uint32_t stack_size = statuses[i].pxEndOfStack - statuses[i].pxStackBase + 1;
+		if (entry == NULL) {
+			entry = &entries[entry_count++];
+			strncpy(entry->name, statuses[i].pcTaskName, configMAX_TASK_NAME_LEN);
+			entry->name[configMAX_TASK_NAME_LEN - 1] = '\0';
+			entry->stack_size = stack_size;
+			entry->min_free = statuses[i].usStackHighWaterMark;
+		} else {
+			// Tasks sharing a name may have differently sized stacks, so keep the worst case
+			if (stack_size > entry->stack_size) entry->stack_size = stack_size;
+			if (statuses[i].usStackHighWaterMark < entry->min_free) entry->min_free = statuses[i].usStackHighWaterMark;
+		}
+	}
+	rtos_resume_all();
+}
+
+static int stack_stats_compare(const void* a, const void* b) {
+	const task_stack_stats_s_t* x = a;
+	const task_stack_stats_s_t* y = b;
+	return (x->min_free > y->min_free) - (x->min_free < y->min_free);
+}
+
+static void stack_stats_report(void* ign) {
+	stack_stats_sample(NULL);
+
+	uint32_t count = entry_count;
+	size_t size = (count + 2) * STACK_STATS_LINE_LEN;
+	char* buf = kmalloc(size);
+	task_stack_stats_s_t* copy = kmalloc(count * sizeof(*copy) + 1);
+	if (buf != NULL && copy != NULL) {
+		// Only this task adds entries, so just the values can change while copying
+		rtos_suspend_all();
+		memcpy(copy, entries, count * sizeof(*copy));
+		rtos_resume_all();
+		qsort(copy, count, sizeof(*copy), stack_stats_compare);
+
+		size_t len = snprintf(buf, size, "Stack usage in words:\n    size  min free  task\n");
+		for (uint32_t i = 0; i < count && len < size; i++) {
+			len += snprintf(buf + len, size - len, "%8lu  %8lu  %s\n", copy[i].stack_size, copy[i].min_free, copy[i].name);
+		}
+		write(KDBG_FILENO, buf, len < size ? len : size - 1);
+	}
+	kfree(buf);
+	kfree(copy);
+}
+
+void task_stack_stats_initialize(void) {
+	timer_start(timer_create(stack_stats_sample, NULL, STACK_STATS_PERIOD, true));
+	report_timer = timer_create(stack_stats_report, NULL, 1, false);
+}
+
+int32_t task_get_stack_stats(task_stack_stats_s_t* const stats, const uint32_t count) {
+	rtos_suspend_all();
+	uint32_t total = entry_count;
+	if (stats != NULL && total) memcpy(stats, entries, (count < total ? count : total) * sizeof(*stats));
+	rtos_resume_all();
+	return total;
+}
+
+void task_stack_report(void) {
+	timer_start(report_timer);
+}
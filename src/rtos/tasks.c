@@ -26,6 +26,7 @@
  */
 
 /* Standard includes. */
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -39,6 +40,7 @@ task.h is included from an application file. */
 #include "task.h"
 #include "timers.h"
 #include "stack_macros.h"
+#include "system/optimizers.h"
 
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
@@ -97,6 +99,15 @@ changed then the definition of static_task_s_t must also be updated. */
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY 			( ( uint8_t ) 1 )
 #define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
 
+#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	/* A light task has no Newlib reent structure of its own and shares
+	_GLOBAL_REENT instead, see task_create_light().  Its errno is kept in
+	the thread local storage pointer after the one used by rtos/periodic_task.c
+	while it isn't running, and lives in _GLOBAL_REENT while it is. */
+	#define tskERRNO_TLSP_INDEX		4
+	#define taskIS_LIGHT( pxTCB )	( ( pxTCB )->pxNewLib_reent != &( ( pxTCB )->xNewLib_reent ) )
+#endif
+
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
 set then don't fill the stack so there is no unnecessary dependency on memset. */
@@ -263,15 +274,22 @@ to its original value when it is released. */
 
 #include "tcb.h"
 
+/* newlib's heap lock, from system/mlock.c. Deleting or restarting another task
+takes it so that the task can't be stopped while it is allocating. */
+struct _reent;
+void __malloc_lock( struct _reent *r );
+void __malloc_unlock( struct _reent *r );
+int32_t malloc_lock_try( void );
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
-TCB_t * volatile pxCurrentTCB = NULL;
+__pros_fast_bss TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
-static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+__pros_fast_bss static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
+__pros_fast_bss static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+__pros_fast_bss static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
 static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
@@ -318,6 +336,12 @@ static volatile uint32_t uxSchedulerSuspended	= ( uint32_t ) pdFALSE;
 
 #endif
 
+/* Every task is kept in the bucket of its name's hash, newest first, so
+task_get_by_name() only compares the names in one bucket.  The buckets are
+only changed in critical sections. */
+#define taskNAME_INDEX_SIZE	32	/* Must be a power of 2. */
+static TCB_t * pxNameIndex[ taskNAME_INDEX_SIZE ] = { NULL };
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -409,7 +433,7 @@ static void prvAddCurrentTaskToDelayedList( uint32_t timeout, const int32_t xCan
  */
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	static uint32_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, task_state_e_t eState ) ;
+	static uint32_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, task_state_e_t eState, int32_t xGetFreeStackSpace ) ;
 
 #endif
 
@@ -417,11 +441,12 @@ static void prvAddCurrentTaskToDelayedList( uint32_t timeout, const int32_t xCan
  * Searches pxList for a task with name name - returning a handle to
  * the task if it is found, or NULL if the task is not found.
  */
-#if ( INCLUDE_xTaskGetHandle == 1 )
-
-	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char name[] ) ;
-
-#endif
+/*
+ * Add a task to the name index or take it out.  Taking out a task which isn't
+ * in the index does nothing.  Called in critical sections.
+ */
+static void prvNameIndexInsert( TCB_t *pxTCB ) ;
+static void prvNameIndexRemove( TCB_t *pxTCB ) ;
 
 /*
  * When a task is created, the stack of the task is filled with a known value.
@@ -543,6 +568,12 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 			}
 			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
+			#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				pxNewTCB->pxNewLib_reent = &( pxNewTCB->xNewLib_reent );
+			}
+			#endif
+
 			prvInitialiseNewTask( task_code, name, stack_size, param, priority, &xReturn, pxNewTCB );
 			prvAddNewTaskToReadyList( pxNewTCB );
 		}
@@ -555,20 +586,193 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 		return xReturn;
 	}
 
+	#if ( INCLUDE_vTaskDelete == 1 )
+
+	task_t task_restart_static(	task_t task, task_fn_t task_code, void* const param,
+								uint32_t priority, const size_t stack_size,
+								const char* const name ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TCB_t *pxTCB = ( TCB_t * ) task;
+	List_t *pxStateList;
+	int32_t xReclaimReent = pdTRUE;
+	task_t xReturn;
+
+		/* Only a task that owns both its TCB and stack can be recycled in place,
+		and the calling task cannot reset the stack it is running on. */
+		if( ( pxTCB == NULL ) || ( pxTCB == pxCurrentTCB ) )
+		{
+			errno = EINVAL;
+			return NULL;
+		}
+
+		#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+		{
+			if( pxTCB->ucStaticallyAllocated != tskSTATICALLY_ALLOCATED_STACK_AND_TCB )
+			{
+				errno = EINVAL;
+				return NULL;
+			}
+		}
+		#endif
+
+		/* To anyone waiting on it, the old task has ended. */
+		void task_notify_when_deleting_hook(task_t);
+		task_notify_when_deleting_hook(task);
+		void watchdog_release(task_t);
+		watchdog_release(task);
+		void gthread_release(task_t);
+		gthread_release(task);
+
+		/* The task must not be in the middle of allocating when it starts
+		over. Holding newlib's heap lock makes sure of that, and means the reent
+		structure can be reclaimed with the scheduler suspended below without
+		waiting on the lock. */
+		__malloc_lock( _REENT );
+		malloc_cache_release( task );
+
+		/* Keep other tasks away from the TCB until it is back on a ready list. */
+		rtos_suspend_all();
+		{
+			taskENTER_CRITICAL();
+			{
+				pxStateList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+				if( pxStateList == NULL )
+				{
+					/* The idle task has already reaped the task, so its reent
+					structure is reclaimed and it no longer counts as a task. */
+					xReclaimReent = pdFALSE;
+					uxCurrentNumberOfTasks++;
+				}
+				else
+				{
+					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( uint32_t ) 0 )
+					{
+						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* A task that deleted itself is still counted until the idle
+					task cleans it up; take that job away from the idle task. */
+					if( pxStateList == &xTasksWaitingTermination )
+					{
+						--uxDeletedTasksWaitingCleanUp;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* An ISR notifying the task must not try to unblock it while
+				it is on no list at all. */
+				#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+				{
+					pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				}
+				#endif
+
+				/* It goes back in the index under its new name. */
+				prvNameIndexRemove( pxTCB );
+
+				uxTaskNumber++;
+				traceTASK_DELETE( pxTCB );
+
+				/* The task may have been the next one due to unblock. */
+				prvResetNextTaskUnblockTime();
+			}
+			taskEXIT_CRITICAL();
+
+			#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				if( xReclaimReent != pdFALSE )
+				{
+					_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+				}
+			}
+			#endif /* configUSE_NEWLIB_REENTRANT */
+			( void ) xReclaimReent;
+
+			/* The stack buffer is kept, everything else starts over.  Only tasks
+			created by task_create_static() get here, and they have their own
+			reent structure. */
+			#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				pxTCB->pxNewLib_reent = &( pxTCB->xNewLib_reent );
+			}
+			#endif
+			prvInitialiseNewTask( task_code, name, stack_size, param, priority, &xReturn, pxTCB );
+
+			taskENTER_CRITICAL();
+			{
+				#if ( configUSE_TRACE_FACILITY == 1 )
+				{
+					pxTCB->uxTCBNumber = uxTaskNumber;
+				}
+				#endif /* configUSE_TRACE_FACILITY */
+				traceTASK_CREATE( pxTCB );
+
+				prvAddTaskToReadyList( pxTCB );
+				prvNameIndexInsert( pxTCB );
+			}
+			taskEXIT_CRITICAL();
+		}
+		( void ) rtos_resume_all();
+		__malloc_unlock( _REENT );
+
+		if( pxCurrentTCB->uxPriority < pxTCB->uxPriority )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+	#endif /* INCLUDE_vTaskDelete */
+
 #endif /* SUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	task_t task_create(task_fn_t function,
+	static task_t prvCreateTask(task_fn_t function,
 							void* const parameters,
 							uint32_t prio,
 							const uint16_t stack_depth,
-							const char* const name)		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+							const char* const name,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+							int32_t light)
 	{
 	TCB_t* new_tcb;
 	task_t return_val = NULL;
+	size_t tcb_size = sizeof( TCB_t );
+
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			/* A light task's TCB stops short of the reent structure, which is
+			the last member. */
+			if( light != pdFALSE )
+			{
+				tcb_size = offsetof( TCB_t, xNewLib_reent );
+			}
+		}
+		#endif
+		( void ) light;
 
 		/* If the stack grows down then allocate the stack then the TCB so the stack
 		does not grow into the TCB.  Likewise if the stack grows up then allocate
@@ -578,7 +782,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 			/* Allocate space for the TCB.  Where the memory comes from depends on
 			the implementation of the port malloc function and whether or not static
 			allocation is being used. */
-			new_tcb = ( TCB_t * ) kmalloc( sizeof( TCB_t ) );
+			new_tcb = ( TCB_t * ) kmalloc( tcb_size );
 
 			if( new_tcb != NULL )
 			{
@@ -605,7 +809,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 			if( stack != NULL )
 			{
 				/* Allocate space for the TCB. */
-				new_tcb = ( TCB_t * ) kmalloc( sizeof( TCB_t ) ); /*lint !e961 MISRA exception as the casts are only redundant for some paths. */
+				new_tcb = ( TCB_t * ) kmalloc( tcb_size ); /*lint !e961 MISRA exception as the casts are only redundant for some paths. */
 
 				if( new_tcb != NULL )
 				{
@@ -636,6 +840,12 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 			}
 			#endif /* configSUPPORT_STATIC_ALLOCATION */
 
+			#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			{
+				new_tcb->pxNewLib_reent = ( light != pdFALSE ) ? _GLOBAL_REENT : &( new_tcb->xNewLib_reent );
+			}
+			#endif
+
 			prvInitialiseNewTask(function, name, ( uint32_t ) stack_depth, parameters, prio,
 				&return_val, new_tcb);
 			prvAddNewTaskToReadyList(new_tcb);
@@ -649,6 +859,24 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) ;
 		return return_val;
 	}
 
+	task_t task_create(task_fn_t function,
+							void* const parameters,
+							uint32_t prio,
+							const uint16_t stack_depth,
+							const char* const name)		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+		return prvCreateTask(function, parameters, prio, stack_depth, name, pdFALSE);
+	}
+
+	task_t task_create_light(task_fn_t function,
+							void* const parameters,
+							uint32_t prio,
+							const uint16_t stack_depth,
+							const char* const name)		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+		return prvCreateTask(function, parameters, prio, stack_depth, name, pdTRUE);
+	}
+
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
@@ -739,6 +967,8 @@ uint32_t x;
 	}
 
 	pxNewTCB->uxPriority = uxPriority;
+	pxNewTCB->pxNameNext = NULL;
+	pxNewTCB->uxStackFreeWords = ulStackDepth;
 	#if ( configUSE_MUTEXES == 1 )
 	{
 		pxNewTCB->uxBasePriority = uxPriority;
@@ -793,8 +1023,12 @@ uint32_t x;
 
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 	{
-		/* Initialise this task's Newlib reent structure. */
-		_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+		/* Initialise this task's Newlib reent structure.  A light task's errno
+		starts out as 0 in its cleared thread local storage pointer. */
+		if( !taskIS_LIGHT( pxNewTCB ) )
+		{
+			_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
+		}
 	}
 	#endif
 
@@ -881,6 +1115,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		traceTASK_CREATE( pxNewTCB );
 
 		prvAddTaskToReadyList( pxNewTCB );
+		prvNameIndexInsert( pxNewTCB );
 
 		portSETUP_TCB( pxNewTCB );
 	}
@@ -914,6 +1149,20 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 		void task_notify_when_deleting_hook(task_t);
 		task_notify_when_deleting_hook(task);
+		void watchdog_release(task_t);
+		watchdog_release(task);
+		void gthread_release(task_t);
+		gthread_release(task);
+
+		/* Another task is cleaned up right away, so it must not be in the
+		middle of allocating. Holding newlib's heap lock makes sure of that,
+		and lets its reent structure and cached blocks be freed below, inside
+		the critical section, without waiting on the lock. */
+		const int32_t xDeletingOther = ( task != NULL ) && ( task != ( task_t ) pxCurrentTCB );
+		if( xDeletingOther != pdFALSE )
+		{
+			__malloc_lock( _REENT );
+		}
 
 		taskENTER_CRITICAL();
 		{
@@ -941,6 +1190,10 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			/* A deleted task can't be found by name, even before the idle task
+			frees it. */
+			prvNameIndexRemove( pxTCB );
+
 			/* Increment the uxTaskNumber also so kernel aware debuggers can
 			detect that the task lists need re-generating.  This is done before
 			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -982,6 +1235,11 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		}
 		taskEXIT_CRITICAL();
 
+		if( xDeletingOther != pdFALSE )
+		{
+			__malloc_unlock( _REENT );
+		}
+
 		/* Force a reschedule if it is the currently running task that has just
 		been deleted. */
 		if( xSchedulerRunning != pdFALSE )
@@ -1257,6 +1515,28 @@ void delay(const uint32_t milliseconds)
 #endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	/* The priority the task was last given, without any inherited from the
+	mutexes it holds. Used by the priority ceiling mutexes in semphr.c. */
+	uint32_t task_get_base_priority(task_t task)
+	{
+	TCB_t *pxTCB;
+	uint32_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( task );
+			uxReturn = pxTCB->uxBasePriority;
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_uxTaskPriorityGet == 1 )
 
 	uint32_t uxTaskPriorityGetFromISR( task_t task )
@@ -1811,7 +2091,11 @@ int32_t xReturn;
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
 			structure specific to the task that will run first. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+			_impure_ptr = pxCurrentTCB->pxNewLib_reent;
+			if( taskIS_LIGHT( pxCurrentTCB ) )
+			{
+				_impure_ptr->_errno = ( int ) ( intptr_t ) pxCurrentTCB->pvThreadLocalStoragePointers[ tskERRNO_TLSP_INDEX ];
+			}
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
@@ -2113,205 +2397,321 @@ TCB_t *pxTCB;
 }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+static uint32_t prvNameHash( const char *pcName )
+{
+uint32_t ulHash = 2166136261UL;
+uint32_t x;
 
-	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char name[] )
+	/* FNV-1a over the part of the name which is kept in the TCB. */
+	for( x = 0; ( x < ( uint32_t ) configMAX_TASK_NAME_LEN - 1 ) && ( pcName[ x ] != '\0' ); x++ )
 	{
-	TCB_t *pxNextTCB, *pxFirstTCB, *pxReturn = NULL;
-	uint32_t x;
-	char cNextChar;
+		ulHash = ( ulHash ^ ( uint8_t ) pcName[ x ] ) * 16777619UL;
+	}
+
+	return ulHash & ( taskNAME_INDEX_SIZE - 1 );
+}
+/*-----------------------------------------------------------*/
 
-		/* This function is called with the scheduler suspended. */
+static void prvNameIndexInsert( TCB_t *pxTCB )
+{
+TCB_t **ppxBucket = &( pxNameIndex[ prvNameHash( pxTCB->pcTaskName ) ] );
 
-		if( listCURRENT_LIST_LENGTH( pxList ) > ( uint32_t ) 0 )
+	pxTCB->pxNameNext = *ppxBucket;
+	*ppxBucket = pxTCB;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNameIndexRemove( TCB_t *pxTCB )
+{
+TCB_t **ppxLink = &( pxNameIndex[ prvNameHash( pxTCB->pcTaskName ) ] );
+
+	while( *ppxLink != NULL )
+	{
+		if( *ppxLink == pxTCB )
 		{
-			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+			*ppxLink = pxTCB->pxNameNext;
+			break;
+		}
+		ppxLink = &( ( *ppxLink )->pxNameNext );
+	}
+}
+/*-----------------------------------------------------------*/
 
-			do
-			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+#if ( INCLUDE_xTaskGetHandle == 1 )
 
-				/* Check each character in the name looking for a match or
-				mismatch. */
-				for( x = ( uint32_t ) 0; x < ( uint32_t ) configMAX_TASK_NAME_LEN; x++ )
-				{
-					cNextChar = pxNextTCB->pcTaskName[ x ];
+	task_t task_get_by_name(const char* name) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TCB_t* pxTCB;
 
-					if( cNextChar != name[ x ] )
-					{
-						/* Characters didn't match. */
-						break;
-					}
-					else if( cNextChar == 0x00 )
-					{
-						/* Both strings terminated, a match must have been
-						found. */
-						pxReturn = pxNextTCB;
-						break;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
+		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+		configASSERT( strlen( name ) < configMAX_TASK_NAME_LEN );
 
-				if( pxReturn != NULL )
+		taskENTER_CRITICAL();
+		{
+			for( pxTCB = pxNameIndex[ prvNameHash( name ) ]; pxTCB != NULL; pxTCB = pxTCB->pxNameNext )
+			{
+				if( strncmp( pxTCB->pcTaskName, name, configMAX_TASK_NAME_LEN - 1 ) == 0 )
 				{
-					/* The handle has been found. */
 					break;
 				}
-
-			} while( pxNextTCB != pxFirstTCB );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 
-		return pxReturn;
+		return ( task_t ) pxTCB;
 	}
 
 #endif /* INCLUDE_xTaskGetHandle */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-	task_t task_get_by_name(const char* name) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	uint32_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime )
 	{
-	uint32_t uxQueue = configMAX_PRIORITIES;
-	TCB_t* pxTCB;
+		return uxTaskGetSystemStateExt( pxTaskStatusArray, uxArraySize, pulTotalRunTime, pdTRUE );
+	}
+	/*-----------------------------------------------------------*/
 
-		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
-		configASSERT( strlen( name ) < configMAX_TASK_NAME_LEN );
+	static uint32_t prvGetSystemState( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, const int32_t xGetFreeStackSpace )
+	{
+	uint32_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
-		rtos_suspend_all();
+		/* Is there a space in the array for each task in the system? */
+		if( uxArraySize >= uxCurrentNumberOfTasks )
 		{
-			/* Search the ready lists. */
+			/* Fill in an TaskStatus_t structure with information on each
+			task in the Ready state. */
 			do
 			{
 				uxQueue--;
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), name );
-
-				if( pxTCB != NULL )
-				{
-					/* Found the handle. */
-					break;
-				}
+				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), E_TASK_STATE_READY, xGetFreeStackSpace );
 
 			} while( uxQueue > ( uint32_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
-			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			/* Fill in an TaskStatus_t structure with information on each
+			task in the Blocked state. */
+			uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, E_TASK_STATE_BLOCKED, xGetFreeStackSpace );
+			uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, E_TASK_STATE_BLOCKED, xGetFreeStackSpace );
+
+			#if( INCLUDE_vTaskDelete == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, name );
+				/* Fill in an TaskStatus_t structure with information on
+				each task that has been deleted but not yet cleaned up. */
+				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, E_TASK_STATE_DELETED, xGetFreeStackSpace );
 			}
+			#endif
 
-			if( pxTCB == NULL )
+			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, name );
+				/* Fill in an TaskStatus_t structure with information on
+				each task in the Suspended state. */
+				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, E_TASK_STATE_SUSPENDED, xGetFreeStackSpace );
 			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			#if ( INCLUDE_vTaskSuspend == 1 )
+		return uxTask;
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t uxTaskGetSystemStateExt( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime, const int32_t xGetFreeStackSpace )
+	{
+	uint32_t uxTask;
+
+		rtos_suspend_all();
+		{
+			uxTask = prvGetSystemState( pxTaskStatusArray, uxArraySize, xGetFreeStackSpace );
+
+			#if ( configGENERATE_RUN_TIME_STATS == 1)
 			{
-				if( pxTCB == NULL )
+				if( pulTotalRunTime != NULL )
 				{
-					/* Search the suspended list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, name );
+					#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+						portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+					#else
+						*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+					#endif
 				}
 			}
-			#endif
-
-			#if( INCLUDE_vTaskDelete == 1 )
+			#else
 			{
-				if( pxTCB == NULL )
+				if( pulTotalRunTime != NULL )
 				{
-					/* Search the deleted list. */
-					pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, name );
+					*pulTotalRunTime = 0;
 				}
 			}
 			#endif
 		}
 		( void ) rtos_resume_all();
 
-		return ( task_t ) pxTCB;
+		return uxTask;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* INCLUDE_xTaskGetHandle */
-/*-----------------------------------------------------------*/
+	uint32_t uxTaskGetSystemStateFromAbort( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize )
+	{
+		/* Resuming the scheduler could re-enable interrupts or yield, neither
+		of which the abort handler can survive, and nothing else runs while it
+		does anyway. */
+		return prvGetSystemState( pxTaskStatusArray, uxArraySize, pdFALSE );
+	}
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#endif /* configUSE_TRACE_FACILITY */
+/*----------------------------------------------------------*/
 
-	uint32_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const uint32_t uxArraySize, uint32_t * const pulTotalRunTime )
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+	uint32_t task_get_cpu_time( task_t task )
 	{
-	uint32_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	TCB_t *pxTCB;
+	uint32_t ulRunTime;
 
-		rtos_suspend_all();
+		taskENTER_CRITICAL();
 		{
-			/* Is there a space in the array for each task in the system? */
-			if( uxArraySize >= uxCurrentNumberOfTasks )
+			pxTCB = prvGetTCBFromHandle( task );
+			ulRunTime = pxTCB->ulRunTimeCounter;
+
+			/* The running task hasn't been credited with its current slice. */
+			if( pxTCB == pxCurrentTCB )
 			{
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Ready state. */
-				do
-				{
-					uxQueue--;
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), E_TASK_STATE_READY );
+				ulRunTime += portGET_RUN_TIME_COUNTER_VALUE() - ulTaskSwitchedInTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return ulRunTime;
+	}
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+/*----------------------------------------------------------*/
+
+static uint32_t prvStackFreeWords( TCB_t *pxTCB )
+{
+	#if( portSTACK_GROWTH < 0 )
+	{
+	const task_stack_t xFillWord = ( task_stack_t ) 0x01010101UL * ( task_stack_t ) tskSTACK_FILL_BYTE;
+	const task_stack_t *pxStack = pxTCB->pxStack;
+	uint32_t ulFree = pxTCB->uxStackFreeWords;
+
+		/* Everything from the last mark up has been used, so rather than
+		counting the untouched words from the bottom of the stack, only the
+		words used since are scanned, going down.  A used word can happen to
+		look like the fill, so the scan only stops at two in a row. */
+		while( ( ulFree > 0 ) && ( ( pxStack[ ulFree - 1 ] != xFillWord ) || ( ( ulFree > 1 ) && ( pxStack[ ulFree - 2 ] != xFillWord ) ) ) )
+		{
+			ulFree--;
+		}
 
-				} while( uxQueue > ( uint32_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		pxTCB->uxStackFreeWords = ulFree;
+		return ulFree;
+	}
+	#else
+	{
+		return ( uint32_t ) prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
 
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, E_TASK_STATE_BLOCKED );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, E_TASK_STATE_BLOCKED );
+static uint32_t prvSnapshotList( task_snapshot_s_t *pxSnapshot, const uint32_t uxCount, uint32_t uxTask, List_t *pxList, task_state_e_t eState )
+{
+configLIST_VOLATILE TCB_t *pxNextTCB, *pxFirstTCB;
+task_snapshot_s_t *pxEntry;
 
-				#if( INCLUDE_vTaskDelete == 1 )
+	if( listCURRENT_LIST_LENGTH( pxList ) > ( uint32_t ) 0 )
+	{
+		listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList );
+		do
+		{
+			listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
+			if( uxTask < uxCount )
+			{
+				pxEntry = &( pxSnapshot[ uxTask ] );
+				pxEntry->task = ( task_t ) pxNextTCB;
+				memcpy( pxEntry->name, pxNextTCB->pcTaskName, configMAX_TASK_NAME_LEN );
+				pxEntry->priority = pxNextTCB->uxPriority;
+				pxEntry->stack_free = prvStackFreeWords( ( TCB_t * ) pxNextTCB );
+
+				/* The same states as vTaskGetInfo() gives. */
+				if( pxNextTCB == pxCurrentTCB )
 				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task that has been deleted but not yet cleaned up. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, E_TASK_STATE_DELETED );
+					pxEntry->state = E_TASK_STATE_RUNNING;
 				}
-				#endif
-
-				#if ( INCLUDE_vTaskSuspend == 1 )
+				else if( ( eState == E_TASK_STATE_SUSPENDED ) && ( listLIST_ITEM_CONTAINER( &( pxNextTCB->xEventListItem ) ) != NULL ) )
 				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task in the Suspended state. */
-					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, E_TASK_STATE_SUSPENDED );
+					pxEntry->state = E_TASK_STATE_BLOCKED;
+				}
+				else
+				{
+					pxEntry->state = eState;
 				}
-				#endif
 
-				#if ( configGENERATE_RUN_TIME_STATS == 1)
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
 				{
-					if( pulTotalRunTime != NULL )
+					pxEntry->cpu_time = pxNextTCB->ulRunTimeCounter;
+					if( pxNextTCB == pxCurrentTCB )
 					{
-						#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-						#else
-							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-						#endif
+						pxEntry->cpu_time += portGET_RUN_TIME_COUNTER_VALUE() - ulTaskSwitchedInTime;
 					}
 				}
 				#else
 				{
-					if( pulTotalRunTime != NULL )
-					{
-						*pulTotalRunTime = 0;
-					}
+					pxEntry->cpu_time = 0;
 				}
 				#endif
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			uxTask++;
+		} while( pxNextTCB != pxFirstTCB );
+	}
+
+	return uxTask;
+}
+/*-----------------------------------------------------------*/
+
+int32_t task_list_snapshot( task_snapshot_s_t * const pxSnapshot, const uint32_t uxCount )
+{
+uint32_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+const uint32_t uxFill = ( pxSnapshot != NULL ) ? uxCount : 0;
+
+	/* One walk of the lists, like prvGetSystemState(), but the stack scans
+	only cover what changed since the last snapshot, which keeps the scheduler
+	suspended for as short a time as possible. */
+	rtos_suspend_all();
+	{
+		do
+		{
+			uxQueue--;
+			uxTask = prvSnapshotList( pxSnapshot, uxFill, uxTask, &( pxReadyTasksLists[ uxQueue ] ), E_TASK_STATE_READY );
+		} while( uxQueue > ( uint32_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+		uxTask = prvSnapshotList( pxSnapshot, uxFill, uxTask, ( List_t * ) pxDelayedTaskList, E_TASK_STATE_BLOCKED );
+		uxTask = prvSnapshotList( pxSnapshot, uxFill, uxTask, ( List_t * ) pxOverflowDelayedTaskList, E_TASK_STATE_BLOCKED );
+
+		#if( INCLUDE_vTaskDelete == 1 )
+		{
+			uxTask = prvSnapshotList( pxSnapshot, uxFill, uxTask, &xTasksWaitingTermination, E_TASK_STATE_DELETED );
 		}
-		( void ) rtos_resume_all();
+		#endif
 
-		return uxTask;
+		#if ( INCLUDE_vTaskSuspend == 1 )
+		{
+			uxTask = prvSnapshotList( pxSnapshot, uxFill, uxTask, &xSuspendedTaskList, E_TASK_STATE_SUSPENDED );
+		}
+		#endif
 	}
+	( void ) rtos_resume_all();
 
-#endif /* configUSE_TRACE_FACILITY */
-/*----------------------------------------------------------*/
+	return ( int32_t ) uxTask;
+}
+/*-----------------------------------------------------------*/
 
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
@@ -2421,7 +2821,7 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 #endif /* INCLUDE_xTaskAbortDelay */
 /*----------------------------------------------------------*/
 
-int32_t xTaskIncrementTick( void )
+__pros_fast int32_t xTaskIncrementTick( void )
 {
 TCB_t * pxTCB;
 uint32_t xItemValue;
@@ -2683,7 +3083,7 @@ int32_t xSwitchRequired = pdFALSE;
 #endif /* configUSE_APPLICATION_TASK_TAG */
 /*-----------------------------------------------------------*/
 
-void vTaskSwitchContext( void )
+__pros_fast void vTaskSwitchContext( void )
 {
 	if( uxSchedulerSuspended != ( uint32_t ) pdFALSE )
 	{
@@ -2706,19 +3106,10 @@ void vTaskSwitchContext( void )
 
 				/* Add the amount of time the task has been running to the
 				accumulated time so far.  The time the task started running was
-				stored in ulTaskSwitchedInTime.  Note that there is no overflow
-				protection here so count values are only valid until the timer
-				overflows.  The guard against negative values is to protect
-				against suspect run time stat counter implementations - which
-				are provided by the application, not the kernel. */
-				if( ulTotalRunTime > ulTaskSwitchedInTime )
-				{
-					pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				stored in ulTaskSwitchedInTime.  The run time counter is a free
+				running microsecond count, so the unsigned difference stays
+				correct when it wraps around. */
+				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
 				ulTaskSwitchedInTime = ulTotalRunTime;
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
@@ -2726,6 +3117,16 @@ void vTaskSwitchContext( void )
 		/* Check for stack overflow, if configured. */
 		taskCHECK_FOR_STACK_OVERFLOW();
 
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			/* A light task's errno leaves _GLOBAL_REENT with it. */
+			if( taskIS_LIGHT( pxCurrentTCB ) )
+			{
+				pxCurrentTCB->pvThreadLocalStoragePointers[ tskERRNO_TLSP_INDEX ] = ( void * ) ( intptr_t ) _impure_ptr->_errno;
+			}
+		}
+		#endif /* configUSE_NEWLIB_REENTRANT */
+
 		/* Select a new task to run using either the generic C or port
 		optimised asm code. */
 		taskSELECT_HIGHEST_PRIORITY_TASK();
@@ -2734,8 +3135,13 @@ void vTaskSwitchContext( void )
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
-			structure specific to this task. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+			structure specific to this task, or to _GLOBAL_REENT with the
+			task's errno in it for a light task. */
+			_impure_ptr = pxCurrentTCB->pxNewLib_reent;
+			if( taskIS_LIGHT( pxCurrentTCB ) )
+			{
+				_impure_ptr->_errno = ( int ) ( intptr_t ) pxCurrentTCB->pvThreadLocalStoragePointers[ tskERRNO_TLSP_INDEX ];
+			}
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 	}
@@ -3294,8 +3700,10 @@ static void prvCheckTasksWaitingTermination( void )
 		TCB_t *pxTCB;
 
 		/* uxDeletedTasksWaitingCleanUp is used to prevent rtos_suspend_all()
-		being called too often in the idle task. */
-		while( uxDeletedTasksWaitingCleanUp > ( uint32_t ) 0U )
+		being called too often in the idle task. Cleaning up frees memory, and
+		the idle task must never block, so the clean up waits for its next turn
+		if another task holds newlib's heap lock. */
+		while( ( uxDeletedTasksWaitingCleanUp > ( uint32_t ) 0U ) && ( malloc_lock_try() != pdFALSE ) )
 		{
 			taskENTER_CRITICAL();
 			{
@@ -3307,6 +3715,7 @@ static void prvCheckTasksWaitingTermination( void )
 			taskEXIT_CRITICAL();
 
 			prvDeleteTCB( pxTCB );
+			__malloc_unlock( _REENT );
 		}
 	}
 	#endif /* INCLUDE_vTaskDelete */
@@ -3326,6 +3735,11 @@ static void prvCheckTasksWaitingTermination( void )
 		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
 		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
 		pxTaskStatus->pxStackBase = pxTCB->pxStack;
+		#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+		{
+			pxTaskStatus->pxEndOfStack = pxTCB->pxEndOfStack;
+		}
+		#endif
 		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
 
 		#if ( configUSE_MUTEXES == 1 )
@@ -3411,7 +3825,7 @@ static void prvCheckTasksWaitingTermination( void )
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-	static uint32_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, task_state_e_t eState )
+	static uint32_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, task_state_e_t eState, int32_t xGetFreeStackSpace )
 	{
 	configLIST_VOLATILE TCB_t *pxNextTCB, *pxFirstTCB;
 	uint32_t uxTask = 0;
@@ -3427,7 +3841,7 @@ static void prvCheckTasksWaitingTermination( void )
 			do
 			{
 				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList );
-				vTaskGetInfo( ( task_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+				vTaskGetInfo( ( task_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), xGetFreeStackSpace, eState );
 				uxTask++;
 			} while( pxNextTCB != pxFirstTCB );
 		}
@@ -3446,16 +3860,18 @@ static void prvCheckTasksWaitingTermination( void )
 
 	static uint16_t prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
 	{
+	const task_stack_t *pxStackWord = ( const task_stack_t * ) pucStackByte;
+	const task_stack_t xFillWord = ( task_stack_t ) 0x01010101UL * ( task_stack_t ) tskSTACK_FILL_BYTE;
 	uint32_t ulCount = 0U;
 
-		while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+		/* Stacks are word aligned, so compare a whole word at a time rather
+		than a byte at a time. */
+		while( *pxStackWord == xFillWord )
 		{
-			pucStackByte -= portSTACK_GROWTH;
+			pxStackWord -= portSTACK_GROWTH;
 			ulCount++;
 		}
 
-		ulCount /= ( uint32_t ) sizeof( task_stack_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
-
 		return ( uint16_t ) ulCount;
 	}
 
@@ -3503,7 +3919,11 @@ static void prvCheckTasksWaitingTermination( void )
 		to the task to free any memory allocated at the application level. */
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
-			_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+			/* _GLOBAL_REENT outlives every light task. */
+			if( !taskIS_LIGHT( pxTCB ) )
+			{
+				_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+			}
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
@@ -4229,6 +4649,16 @@ uint32_t uxReturn;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskIncrementMutexHeldCountOf( task_t xTask )
+	{
+		( ( ( TCB_t * ) xTask )->uxMutexesHeld )++;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
 	uint32_t task_notify_take(bool clear_on_exit, uint32_t timeout)
@@ -0,0 +1,259 @@
+/**
+ * \file rtos/timer_wheel.c
+ *
+ * Software timers on a hierarchical timing wheel.
+ *
+ * Each level of the wheel has 64 slots, the first covering one millisecond
+ * each and every following level 64 times as much as the one before it. A
+ * timer goes into the slot of the lowest level which still reaches its expiry
+ * time, so starting or stopping a timer is a list insertion or removal no
+ * matter how many timers exist. Whenever the first level wraps around, the
+ * matching slot of the next level is spread back out over the levels below.
+ *
+ * The timer task advances the wheel one tick at a time and runs the callbacks
+ * of every timer expiring on a tick as one batch. It sleeps until the next
+ * occupied slot or cascade instead of waking every tick.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+
+#define WHEEL_LEVELS 4
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1)
+// Timers further out than this are parked in the last level until they get closer
+#define WHEEL_RANGE (1UL << (WHEEL_LEVELS * WHEEL_SLOT_BITS))
+// The "level" of a timer which has expired and waits for its callback to run
+#define WHEEL_LEVEL_EXPIRED WHEEL_LEVELS
+
+typedef struct sw_timer_s {
+	struct sw_timer_s* next;
+	struct sw_timer_s** pprev;  // NULL unless the timer is on the wheel or expired
+	uint32_t expiry;
+	uint32_t period;
+	timer_fn_t callback;
+	void* param;
+	uint8_t level;
+	uint8_t slot;
+	bool periodic;
+	bool running;  // The callback is running
+	bool deleted;  // timer_delete() was called while the callback was running
+} sw_timer_s_t;
+
+// All of the state below is protected by suspending the scheduler
+static sw_timer_s_t* wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t first_level_occupied;
+static uint32_t upper_level_count;
+static sw_timer_s_t* expired;
+// The next tick the wheel will process
+static uint32_t wheel_time;
+// When the timer task will wake up next, if wake_scheduled
+static uint32_t next_wake;
+static bool wake_scheduled;
+
+static task_stack_t timer_task_stack[TASK_STACK_DEPTH_DEFAULT];
+static static_task_s_t timer_task_buffer;
+static task_t timer_task;
+
+static void timer_link(sw_timer_s_t** head, sw_timer_s_t* timer) {
+	timer->next = *head;
+	if (timer->next != NULL) timer->next->pprev = &timer->next;
+	*head = timer;
+	timer->pprev = head;
+}
+
+static void timer_unlink(sw_timer_s_t* timer) {
+	*timer->pprev = timer->next;
+	if (timer->next != NULL) timer->next->pprev = timer->pprev;
+	timer->pprev = NULL;
+	if (timer->level == 0) {
+		if (wheel[0][timer->slot] == NULL) first_level_occupied &= ~(1ULL << timer->slot);
+	} else if (timer->level < WHEEL_LEVELS) {
+		upper_level_count--;
+	}
+}
+
+static void wheel_insert(sw_timer_s_t* timer) {
+	uint32_t expiry = timer->expiry;
+	int32_t delta = (int32_t)(expiry - wheel_time);
+	if (delta < 0) {
+		// Already due, so it goes into the slot processed next
+		delta = 0;
+		expiry = wheel_time;
+	} else if ((uint32_t)delta >= WHEEL_RANGE) {
+		delta = WHEEL_RANGE - 1;
+		expiry = wheel_time + delta;
+	}
+
+	uint8_t level = 0;
+	while ((uint32_t)delta >= (1UL << ((level + 1) * WHEEL_SLOT_BITS))) level++;
+	timer->level = level;
+	timer->slot = (expiry >> (level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+	timer_link(&wheel[level][timer->slot], timer);
+	if (level == 0) {
+		first_level_occupied |= 1ULL << timer->slot;
+	} else {
+		upper_level_count++;
+	}
+}
+
+static bool wheel_cascade(uint8_t level) {
+	uint8_t slot = (wheel_time >> (level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+	sw_timer_s_t* timer = wheel[level][slot];
+	wheel[level][slot] = NULL;
+	while (timer != NULL) {
+		sw_timer_s_t* next = timer->next;
+		upper_level_count--;
+		wheel_insert(timer);
+		timer = next;
+	}
+	// The next level only needs to cascade when this one wrapped around too
+	return slot == 0;
+}
+
+// moves the timers expiring on the current tick to the expired list and advances the wheel
+static void wheel_process_tick(void) {
+	uint8_t slot = wheel_time & WHEEL_SLOT_MASK;
+	if (slot == 0) {
+		for (uint8_t level = 1; level < WHEEL_LEVELS && wheel_cascade(level); level++)
+			;
+	}
+
+	sw_timer_s_t* timer = wheel[0][slot];
+	wheel[0][slot] = NULL;
+	first_level_occupied &= ~(1ULL << slot);
+	while (timer != NULL) {
+		sw_timer_s_t* next = timer->next;
+		timer->level = WHEEL_LEVEL_EXPIRED;
+		timer_link(&expired, timer);
+		timer = next;
+	}
+	wheel_time++;
+}
+
+// returns the number of ticks from now the timer task may sleep for
+static uint32_t wheel_sleep_time(uint32_t now) {
+	if (first_level_occupied == 0 && upper_level_count == 0) {
+		wake_scheduled = false;
+		return TIMEOUT_MAX;
+	}
+	uint8_t index = wheel_time & WHEEL_SLOT_MASK;
+	// The next cascade happens when the tick at index 0 is processed
+	uint32_t ticks = upper_level_count ? (WHEEL_SLOTS - index) & WHEEL_SLOT_MASK : UINT32_MAX;
+	uint64_t pending = index ? (first_level_occupied >> index) | (first_level_occupied << (WHEEL_SLOTS - index))
+	                         : first_level_occupied;
+	if (pending != 0 && (uint32_t)__builtin_ctzll(pending) < ticks) ticks = __builtin_ctzll(pending);
+
+	wake_scheduled = true;
+	next_wake = wheel_time + ticks;
+	int32_t delta = (int32_t)(next_wake - now);
+	return delta > 0 ? (uint32_t)delta : 0;
+}
+
+static void timer_task_fn(void* ign) {
+	for (;;) {
+		uint32_t now = millis();
+		rtos_suspend_all();
+		while ((int32_t)(now - wheel_time) >= 0) {
+			wheel_process_tick();
+			sw_timer_s_t* timer;
+			while ((timer = expired) != NULL) {
+				timer_unlink(timer);
+				if (timer->periodic) {
+					// Re-arm before the callback so that the callback may stop it
+					timer->expiry += timer->period;
+					if ((int32_t)(timer->expiry - wheel_time) < 0) timer->expiry = wheel_time - 1 + timer->period;
+					wheel_insert(timer);
+				}
+				timer->running = true;
+				rtos_resume_all();
+				timer->callback(timer->param);
+				rtos_suspend_all();
+				timer->running = false;
+				if (timer->deleted) kfree(timer);
+			}
+		}
+		uint32_t sleep = wheel_sleep_time(millis());
+		rtos_resume_all();
+		task_notify_take(true, sleep);
+	}
+}
+
+void timer_wheel_initialize(void) {
+	timer_task = task_create_static(timer_task_fn, NULL, TASK_PRIORITY_MAX - 3, TASK_STACK_DEPTH_DEFAULT,
+	                                "PROS Timers", timer_task_stack, &timer_task_buffer);
+}
+
+sw_timer_t timer_create(timer_fn_t callback, void* param, uint32_t period, bool periodic) {
+	if (callback == NULL || period == 0) {
+		errno = EINVAL;
+		return NULL;
+	}
+	sw_timer_s_t* timer = kmalloc(sizeof(*timer));
+	if (timer == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	*timer = (sw_timer_s_t){.callback = callback, .param = param, .period = period, .periodic = periodic};
+	return timer;
+}
+
+int32_t timer_start(sw_timer_t timer_handle) {
+	sw_timer_s_t* timer = timer_handle;
+	if (timer == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (timer->pprev != NULL) timer_unlink(timer);
+	timer->expiry = millis() + timer->period;
+	wheel_insert(timer);
+	// The timer task recomputes its wake time anyway if it is the one starting the timer
+	bool wake = task_get_current() != timer_task &&
+	            (!wake_scheduled || (int32_t)(timer->expiry - next_wake) < 0);
+	rtos_resume_all();
+	if (wake) task_notify(timer_task);
+	return 1;
+}
+
+int32_t timer_stop(sw_timer_t timer_handle) {
+	sw_timer_s_t* timer = timer_handle;
+	if (timer == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (timer->pprev != NULL) timer_unlink(timer);
+	rtos_resume_all();
+	return 1;
+}
+
+bool timer_is_active(sw_timer_t timer_handle) {
+	sw_timer_s_t* timer = timer_handle;
+	return timer != NULL && timer->pprev != NULL;
+}
+
+int32_t timer_delete(sw_timer_t timer_handle) {
+	sw_timer_s_t* timer = timer_handle;
+	if (timer == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (timer->pprev != NULL) timer_unlink(timer);
+	// A running callback still uses the timer, so the timer task frees it afterwards
+	bool running = timer->running;
+	timer->deleted = running;
+	rtos_resume_all();
+	if (!running) kfree(timer);
+	return 1;
+}
@@ -0,0 +1,293 @@
+/**
+ * \file rtos/topic.c
+ *
+ * Publish/subscribe topics.
+ *
+ * A topic holds the latest value published on it along with a sequence number
+ * which counts the publishes. Publishing copies the value in and bumps the
+ * sequence with the scheduler suspended, like the system daemon does with its
+ * snapshots, so readers never lock anything: they copy the value out between
+ * two reads of the sequence and retry if a publish got in between.
+ *
+ * Each subscriber has a semaphore which is posted on every publish. One with
+ * a queue also gets a copy of every value, the oldest being dropped once the
+ * queue is full, while one without only ever sees the latest value. A
+ * subscriber can also ask for notification bits to be set on its task, so one
+ * task can wait for several topics at once.
+ *
+ * The kernel's topics are created at startup and filled in straight from the
+ * system daemon's snapshots, but only once a task has opened them, so they cost
+ * the daemon nothing until then.
+ *
+ * Topics are never deleted, which is what lets handles be used without locks.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+
+typedef struct topic_sub_s {
+	struct topic_sub_s* next;
+	struct topic_s* topic;
+	task_t task;
+	uint32_t notify_bits;
+	sem_t sem;
+	uint32_t last_seq;  // The latest value seen, without a queue
+	uint32_t length;    // 0 without a queue
+	uint32_t head;
+	uint32_t tail;
+	uint32_t dropped;
+	uint8_t entries[] __attribute__((aligned(8)));
+} topic_sub_s_t;
+
+typedef struct topic_s {
+	struct topic_s* next;
+	char name[TOPIC_NAME_MAX_LEN + 1];
+	size_t size;
+	volatile uint32_t seq;  // 0 until the first publish
+	bool kernel;            // Only published by the system daemon
+	volatile bool opened;   // Whether a task has asked for it by name
+	topic_sub_s_t* subs;
+	uint8_t value[] __attribute__((aligned(8)));
+} topic_s_t;
+
+// Only changed with the scheduler suspended
+static topic_s_t* topics;
+
+static topic_s_t* topic_lookup(const char* name) {
+	topic_s_t* topic = topics;
+	while (topic != NULL && strcmp(topic->name, name)) topic = topic->next;
+	return topic;
+}
+
+static topic_t topic_create_internal(const char* name, size_t size, bool kernel) {
+	if (name == NULL || size == 0 || strlen(name) > TOPIC_NAME_MAX_LEN) {
+		errno = EINVAL;
+		return NULL;
+	}
+	topic_s_t* const created = kmalloc(sizeof(topic_s_t) + size);
+	if (created == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	*created = (topic_s_t){.size = size, .kernel = kernel, .opened = !kernel};
+	strcpy(created->name, name);
+	memset(created->value, 0, size);
+
+	rtos_suspend_all();
+	topic_s_t* topic = topic_lookup(name);
+	if (topic == NULL) {
+		created->next = topics;
+		topics = created;
+		topic = created;
+	}
+	rtos_resume_all();
+	if (topic != created) {
+		kfree(created);
+		if (topic->size != size) {
+			errno = EINVAL;
+			return NULL;
+		}
+		topic->opened = true;
+	}
+	return topic;
+}
+
+topic_t topic_create(const char* name, size_t size) {
+	return topic_create_internal(name, size, false);
+}
+
+topic_t topic_find(const char* name) {
+	if (name == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	rtos_suspend_all();
+	topic_s_t* const topic = topic_lookup(name);
+	rtos_resume_all();
+	if (topic == NULL) {
+		errno = ENOENT;
+		return NULL;
+	}
+	topic->opened = true;
+	return topic;
+}
+
+size_t topic_get_size(topic_t topic) {
+	if (topic == NULL) {
+		errno = EINVAL;
+		return 0;
+	}
+	return ((topic_s_t*)topic)->size;
+}
+
+// Called with the scheduler suspended once the topic's value is in place
+static void topic_fan_out(topic_s_t* topic) {
+	compiler_barrier();
+	topic->seq++;
+	for (topic_sub_s_t* sub = topic->subs; sub != NULL; sub = sub->next) {
+		if (sub->length) {
+			if (sub->head - sub->tail >= sub->length) {
+				sub->tail++;
+				sub->dropped++;
+			}
+			memcpy(sub->entries + (sub->head % sub->length) * topic->size, topic->value, topic->size);
+			sub->head++;
+		}
+		// Already at its maximum if the subscriber hasn't caught up yet
+		sem_post(sub->sem);
+		if (sub->notify_bits) task_notify_ext(sub->task, sub->notify_bits, E_NOTIFY_ACTION_BITS, NULL);
+	}
+}
+
+int32_t topic_publish(topic_t handle, const void* value) {
+	topic_s_t* const topic = handle;
+	if (topic == NULL || value == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (topic->kernel) {
+		errno = EACCES;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	memcpy(topic->value, value, topic->size);
+	topic_fan_out(topic);
+	rtos_resume_all();
+	return 1;
+}
+
+// Copies the latest value out, returning its sequence number
+static uint32_t topic_copy(const topic_s_t* topic, void* value) {
+	uint32_t seq;
+	do {
+		seq = topic->seq;
+		compiler_barrier();
+		memcpy(value, topic->value, topic->size);
+		compiler_barrier();
+	} while (seq != topic->seq);
+	return seq;
+}
+
+uint32_t topic_read(topic_t handle, void* value) {
+	const topic_s_t* const topic = handle;
+	if (topic == NULL || value == NULL) {
+		errno = EINVAL;
+		return 0;
+	}
+	uint32_t const seq = topic_copy(topic, value);
+	if (seq == 0) errno = EAGAIN;
+	return seq;
+}
+
+uint32_t topic_get_seq(topic_t handle) {
+	if (handle == NULL) {
+		errno = EINVAL;
+		return 0;
+	}
+	return ((const topic_s_t*)handle)->seq;
+}
+
+topic_sub_t topic_subscribe(topic_t handle, uint32_t queue_length, uint32_t notify_bits) {
+	topic_s_t* const topic = handle;
+	if (topic == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	topic_sub_s_t* const sub = kmalloc(sizeof(topic_sub_s_t) + queue_length * topic->size);
+	if (sub == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	*sub = (topic_sub_s_t){
+	    .topic = topic, .task = task_get_current(), .notify_bits = notify_bits, .length = queue_length};
+	sub->sem = sem_create(queue_length ? queue_length : 1, 0);
+	if (sub->sem == NULL) {
+		kfree(sub);
+		errno = ENOMEM;
+		return NULL;
+	}
+	topic->opened = true;
+	rtos_suspend_all();
+	// Only values published from now on are new to it
+	sub->last_seq = topic->seq;
+	sub->next = topic->subs;
+	topic->subs = sub;
+	rtos_resume_all();
+	return sub;
+}
+
+void topic_unsubscribe(topic_sub_t handle) {
+	topic_sub_s_t* const sub = handle;
+	if (sub == NULL) return;
+	rtos_suspend_all();
+	topic_sub_s_t** link = &sub->topic->subs;
+	while (*link != sub) link = &(*link)->next;
+	*link = sub->next;
+	rtos_resume_all();
+	sem_delete(sub->sem);
+	kfree(sub);
+}
+
+uint32_t topic_sub_receive(topic_sub_t handle, void* value, uint32_t timeout) {
+	topic_sub_s_t* const sub = handle;
+	if (sub == NULL || value == NULL) {
+		errno = EINVAL;
+		return 0;
+	}
+	const topic_s_t* const topic = sub->topic;
+	while (true) {
+		if (!sem_wait(sub->sem, timeout)) {
+			errno = EAGAIN;
+			return 0;
+		}
+		if (sub->length) {
+			rtos_suspend_all();
+			memcpy(value, sub->entries + (sub->tail % sub->length) * topic->size, topic->size);
+			// The sequence number of the value just taken
+			uint32_t const seq = topic->seq - (sub->head - sub->tail - 1);
+			sub->tail++;
+			rtos_resume_all();
+			return seq;
+		}
+		uint32_t const seq = topic_copy(topic, value);
+		// A post left over from a value which was already read
+		if (seq == sub->last_seq) continue;
+		sub->last_seq = seq;
+		return seq;
+	}
+}
+
+uint32_t topic_sub_get_dropped(topic_sub_t handle) {
+	if (handle == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return ((const topic_sub_s_t*)handle)->dropped;
+}
+
+// Creates one of the kernel's topics, which only the system daemon publishes
+topic_t topic_create_kernel(const char* name, size_t size) {
+	return topic_create_internal(name, size, true);
+}
+
+// Called by the system daemon with the scheduler suspended. Gives the buffer to
+// fill in the topic's next value, or NULL if no task has opened the topic yet
+void* topic_kernel_begin(topic_t handle) {
+	topic_s_t* const topic = handle;
+	return topic != NULL && topic->opened ? topic->value : NULL;
+}
+
+// Publishes the value filled in after topic_kernel_begin()
+void topic_kernel_commit(topic_t handle) {
+	topic_fan_out(handle);
+}
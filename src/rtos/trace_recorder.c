@@ -0,0 +1,231 @@
+/**
+ * \file rtos/trace_recorder.c
+ *
+ * Scheduler trace recorder.
+ *
+ * The FreeRTOS trace hooks in rtos/trace_recorder.h write fixed size binary
+ * events into a ring buffer while a trace is being recorded, so the buffer
+ * always holds the most recent events. Writers mask interrupts for the few
+ * instructions it takes to claim a slot and fill it in, since the hooks run
+ * from tasks and from the context switch alike.
+ *
+ * The trace is sent over the serial line on the 'trce' stream, framed with
+ * COBS like every other stream, in the format documented in pros/apix.h.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+#include "rtos/tcb.h"
+#include "rtos/trace_recorder.h"
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+bool ser_frame_write(uint32_t stream_id, const void* data, size_t len);
+#define PROS_ERR (INT32_MAX)
+#define SER_TRACE_STREAM_ID 0x65637274
+
+#define TRACE_FORMAT_VERSION 1
+#define TRACE_NAME_SLOTS 32
+#define TRACE_EVENTS_PER_FRAME 40
+
+enum { E_TRACE_RECORD_HEADER = 0, E_TRACE_RECORD_TASK, E_TRACE_RECORD_EVENTS, E_TRACE_RECORD_END };
+
+// Matches trace_event_s_t in pros/apix.h
+typedef struct __attribute__((packed)) trace_event_s {
+	uint32_t timestamp;
+	uint16_t task;
+	uint8_t type;
+	uint8_t priority;
+	uint32_t arg;
+} trace_event_s_t;
+
+typedef struct trace_name_s {
+	uint32_t task;
+	char name[configMAX_TASK_NAME_LEN];
+} trace_name_s_t;
+
+volatile uint32_t trace_recording;
+uint32_t trace_queue_number;
+
+// The buffers are only replaced while not recording. The counters are only
+// changed with interrupts masked
+static trace_event_s_t* events;
+static uint32_t capacity;  // Always a power of two
+static uint32_t head;      // The number of events recorded since the trace started
+static trace_name_s_t* names;
+static uint32_t name_head;
+
+void trace_record(uint32_t type, uint32_t task, uint32_t priority, uint32_t arg) {
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	// Checked again with interrupts masked, since trace_stop() also masks them
+	if (trace_recording) {
+		events[head++ & (capacity - 1)] = (trace_event_s_t){.timestamp = portGET_RUN_TIME_COUNTER_VALUE(),
+		                                                    .task = task,
+		                                                    .type = type,
+		                                                    .priority = priority,
+		                                                    .arg = arg};
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void trace_record_current(uint32_t type, uint32_t arg) {
+	TCB_t* tcb = task_get_current();
+	trace_record(type, tcb->uxTCBNumber, tcb->uxPriority, arg);
+}
+
+void trace_record_task_name(uint32_t task, const char* name) {
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	if (trace_recording) {
+		trace_name_s_t* slot = &names[name_head++ % TRACE_NAME_SLOTS];
+		slot->task = task;
+		strncpy(slot->name, name, configMAX_TASK_NAME_LEN);
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void trace_mark(uint32_t value) {
+	if (trace_recording) trace_record_current(TRACE_EVENT_MARK, value);
+}
+
+uint32_t trace_copy_recent(void* dest, uint32_t max) {
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	uint32_t count = 0;
+	if (events != NULL) {
+		uint32_t first = head > capacity ? head - capacity : 0;
+		if (head - first > max) first = head - max;
+		for (uint32_t i = first; i < head; i++, count++) {
+			((trace_event_s_t*)dest)[count] = events[i & (capacity - 1)];
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+	return count;
+}
+
+void trace_stop(void) {
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	trace_recording = 0;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+int32_t trace_start(uint32_t event_count) {
+	if (event_count == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Round down to a power of two so that the ring buffer index is a mask
+	event_count = 1UL << (31 - __builtin_clz(event_count));
+
+	trace_stop();
+	if (event_count != capacity) {
+		kfree(events);
+		events = kmalloc(event_count * sizeof(*events));
+		capacity = events != NULL ? event_count : 0;
+	}
+	if (names == NULL) names = kmalloc(TRACE_NAME_SLOTS * sizeof(*names));
+	if (events == NULL || names == NULL) {
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	head = 0;
+	name_head = 0;
+	trace_recording = 1;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+	return 1;
+}
+
+static bool trace_send_task(uint32_t task, uint32_t priority, const char* name) {
+	struct __attribute__((packed)) {
+		uint8_t kind;
+		uint8_t priority;
+		uint16_t task;
+		char name[configMAX_TASK_NAME_LEN];
+	} record = {.kind = E_TRACE_RECORD_TASK, .priority = priority, .task = task};
+	size_t len = strnlen(name, configMAX_TASK_NAME_LEN);
+	memcpy(record.name, name, len);
+	return ser_frame_write(SER_TRACE_STREAM_ID, &record, offsetof(__typeof__(record), name) + len);
+}
+
+static bool trace_send_tasks(void) {
+	// Tasks which are still around are named from their current state
+	uint32_t count = task_get_count() + 4;
+	TaskStatus_t* statuses = kmalloc(count * sizeof(*statuses));
+	if (statuses == NULL) return false;
+	count = uxTaskGetSystemState(statuses, count, NULL);
+
+	bool ret = true;
+	for (uint32_t i = 0; ret && i < count; i++) {
+		ret = trace_send_task(statuses[i].xTaskNumber, statuses[i].uxCurrentPriority, statuses[i].pcTaskName);
+	}
+	// The rest were created during the trace and have since been deleted, or restarted under a new number
+	uint32_t first = name_head > TRACE_NAME_SLOTS ? name_head - TRACE_NAME_SLOTS : 0;
+	for (uint32_t i = first; ret && i < name_head; i++) {
+		trace_name_s_t* slot = &names[i % TRACE_NAME_SLOTS];
+		bool known = false;
+		for (uint32_t j = 0; j < count && !known; j++) known = statuses[j].xTaskNumber == slot->task;
+		if (!known) ret = trace_send_task(slot->task, 0, slot->name);
+	}
+	kfree(statuses);
+	return ret;
+}
+
+int32_t trace_dump(void) {
+	trace_stop();
+	if (events == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+
+	uint32_t first = head > capacity ? head - capacity : 0;
+	struct __attribute__((packed)) {
+		uint8_t kind;
+		uint8_t version;
+		uint16_t event_size;
+		uint32_t event_count;
+		uint32_t lost;
+		uint32_t queues;
+	} header = {.kind = E_TRACE_RECORD_HEADER,
+	            .version = TRACE_FORMAT_VERSION,
+	            .event_size = sizeof(trace_event_s_t),
+	            .event_count = head - first,
+	            .lost = first,
+	            .queues = trace_queue_number};
+	if (!ser_frame_write(SER_TRACE_STREAM_ID, &header, sizeof(header)) || !trace_send_tasks()) {
+		errno = EIO;
+		return PROS_ERR;
+	}
+
+	struct __attribute__((packed)) {
+		uint8_t kind;
+		uint8_t reserved;
+		uint16_t count;
+		trace_event_s_t events[TRACE_EVENTS_PER_FRAME];
+	} frame = {.kind = E_TRACE_RECORD_EVENTS};
+	for (uint32_t i = first; i < head; i += frame.count) {
+		frame.count = head - i < TRACE_EVENTS_PER_FRAME ? head - i : TRACE_EVENTS_PER_FRAME;
+		for (uint32_t j = 0; j < frame.count; j++) frame.events[j] = events[(i + j) & (capacity - 1)];
+		size_t len = offsetof(__typeof__(frame), events) + frame.count * sizeof(trace_event_s_t);
+		if (!ser_frame_write(SER_TRACE_STREAM_ID, &frame, len)) {
+			errno = EIO;
+			return PROS_ERR;
+		}
+	}
+
+	const uint8_t end = E_TRACE_RECORD_END;
+	if (!ser_frame_write(SER_TRACE_STREAM_ID, &end, sizeof(end))) {
+		errno = EIO;
+		return PROS_ERR;
+	}
+	return head - first;
+}
@@ -0,0 +1,127 @@
+/**
+ * \file rtos/work_queue.c
+ *
+ * Work queues.
+ *
+ * Each work queue is a worker task, a pool of job blocks and a queue of
+ * pointers to the jobs waiting to run. Submitting a job takes a block from the
+ * pool without locking anything and appends its pointer to the queue. The
+ * worker receives the pointers in order, runs each job and gives its block
+ * back. The queue has a slot for every block plus one for the job which stops
+ * the worker, so appending never has to wait.
+ *
+ * The FreeRTOS timer task could run deferred calls too, but it runs above
+ * every other task and only has room for a few of them.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+
+#include "kapi.h"
+
+typedef struct work_job_s {
+	work_fn_t function;  // NULL for the job which stops the worker
+	void* param;
+	uint8_t data[WORK_QUEUE_INLINE_SIZE] __attribute__((aligned(8)));
+} work_job_s_t;
+
+typedef struct work_queue_s {
+	queue_t jobs;
+	pool_t pool;
+	task_t worker;
+	void* pool_storage;
+} work_queue_s_t;
+
+static inline work_job_s_t* job_of(void* data) {
+	return (work_job_s_t*)((uint8_t*)data - offsetof(work_job_s_t, data));
+}
+
+static void work_queue_worker(void* param) {
+	work_queue_s_t* const wq = param;
+	work_job_s_t* job;
+	while (true) {
+		queue_recv(wq->jobs, &job, TIMEOUT_MAX);
+		if (job->function == NULL) break;
+		job->function(job->param);
+		pool_free(wq->pool, job);
+	}
+	// Every earlier job has run, and nothing here touches the work queue again
+	task_notify(job->param);
+	task_delete(NULL);
+}
+
+work_queue_t work_queue_create(uint32_t prio, uint32_t max_jobs, uint16_t stack_depth, const char* name) {
+	if (max_jobs == 0 || prio >= TASK_PRIORITY_MAX - 2) {
+		errno = EINVAL;
+		return NULL;
+	}
+	work_queue_s_t* wq = kmalloc(sizeof(*wq));
+	void* pool_storage = kmalloc(POOL_STORAGE_SIZE(sizeof(work_job_s_t), max_jobs));
+	queue_t jobs = queue_create(max_jobs + 1, sizeof(work_job_s_t*));
+	if (wq == NULL || pool_storage == NULL || jobs == NULL) goto fail;
+	*wq = (work_queue_s_t){.jobs = jobs,
+	                       .pool = pool_create_static(sizeof(work_job_s_t), max_jobs, pool_storage),
+	                       .pool_storage = pool_storage};
+	wq->worker = task_create(work_queue_worker, wq, prio, stack_depth, name);
+	if (wq->worker == NULL) goto fail;
+	return wq;
+
+fail:
+	if (jobs != NULL) queue_delete(jobs);
+	kfree(pool_storage);
+	kfree(wq);
+	errno = ENOMEM;
+	return NULL;
+}
+
+void work_queue_delete(work_queue_t queue) {
+	work_queue_s_t* const wq = queue;
+	if (wq == NULL) return;
+	work_job_s_t stop = {.function = NULL, .param = task_get_current()};
+	work_job_s_t* job = &stop;
+	queue_append(wq->jobs, &job, TIMEOUT_MAX);
+	task_notify_take(true, TIMEOUT_MAX);
+	queue_delete(wq->jobs);
+	kfree(wq->pool_storage);
+	kfree(wq);
+}
+
+void* work_queue_reserve(work_queue_t queue, work_fn_t function) {
+	work_queue_s_t* const wq = queue;
+	if (wq == NULL || function == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	work_job_s_t* job = pool_alloc(wq->pool);
+	if (job == NULL) {
+		errno = ENOSPC;
+		return NULL;
+	}
+	job->function = function;
+	job->param = job->data;
+	return job->data;
+}
+
+bool work_queue_commit(work_queue_t queue, void* data) {
+	work_queue_s_t* const wq = queue;
+	if (wq == NULL || data == NULL) {
+		errno = EINVAL;
+		return false;
+	}
+	work_job_s_t* job = job_of(data);
+	return queue_append(wq->jobs, &job, 0);
+}
+
+bool work_queue_submit(work_queue_t queue, work_fn_t function, void* param) {
+	void* data = work_queue_reserve(queue, function);
+	if (data == NULL) return false;
+	job_of(data)->param = param;
+	return work_queue_commit(queue, data);
+}
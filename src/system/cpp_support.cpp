@@ -11,14 +11,24 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <cerrno>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <stdexcept>
+#include <thread>
 
 #include "rtos/FreeRTOS.h"
 #include "rtos/task.h"
 #include "v5_api.h"
 
+// from rtos/hrtimer.c, since pros/rtos.h can't be included alongside rtos/task.h
+extern "C" {
+uint64_t micros(void);
+uint64_t hrtimer_nanos(void);
+void task_delay_until_us(uint64_t* const prev_time, const uint32_t delta);
+}
+
 extern "C" void task_fn_wrapper(task_fn_t fn, void* args) {
 #ifdef __cpp_exceptions
 	try {
@@ -66,3 +76,95 @@ extern "C" void cpp_disabled() {
 extern "C" void cpp_competition_initialize() {
 	competition_initialize();
 }
+
+/******************************************************************************/
+/**                                 Threads                                  **/
+/**                                                                          **/
+/**  The parts of std::thread and std::condition_variable which libstdc++    **/
+/**  keeps in the library, for the GCC 9 and 10 toolchains. Everything else  **/
+/**  is in the headers, on top of pros/gthr-pros.h.                          **/
+/******************************************************************************/
+namespace std {
+thread::_State::~_State() = default;
+
+static void* thread_entry(void* state) {
+	thread::_State_ptr owner{static_cast<thread::_State*>(state)};
+	owner->_M_run();
+	return nullptr;
+}
+
+void thread::_M_start_thread(_State_ptr state, void (*)()) {
+	int const err = __gthread_create(&_M_id._M_thread, thread_entry, state.get());
+	if (err) __throw_system_error(err);
+	// The new thread owns it now
+	state.release();
+}
+
+void thread::join() {
+	int err = EINVAL;
+	if (_M_id != id()) err = __gthread_join(_M_id._M_thread, nullptr);
+	if (err) __throw_system_error(err);
+	_M_id = id();
+}
+
+void thread::detach() {
+	int err = EINVAL;
+	if (_M_id != id()) err = __gthread_detach(_M_id._M_thread);
+	if (err) __throw_system_error(err);
+	_M_id = id();
+}
+
+unsigned int thread::hardware_concurrency() noexcept {
+	return 1;
+}
+
+#if !defined(_GLIBCXX_NO_SLEEP) && !defined(_GLIBCXX_USE_NANOSLEEP)
+namespace this_thread {
+void __sleep_for(chrono::seconds s, chrono::nanoseconds ns) {
+	// Rounded up to whole microseconds, since a sleep may be longer but not shorter. sleep_until() is built on
+	// this in the headers
+	uint64_t remaining = s.count() * 1000000 + (ns.count() + 999) / 1000;
+	uint64_t wake = micros();
+	while (remaining) {
+		uint32_t const delta = remaining < UINT32_MAX ? remaining : UINT32_MAX;
+		task_delay_until_us(&wake, delta);
+		remaining -= delta;
+	}
+}
+}  // namespace this_thread
+#endif
+
+condition_variable::condition_variable() noexcept = default;
+
+condition_variable::~condition_variable() noexcept = default;
+
+void condition_variable::wait(unique_lock<mutex>& lock) noexcept {
+	__gthread_cond_wait(&_M_cond, lock.mutex()->native_handle());
+}
+
+void condition_variable::notify_one() noexcept {
+	__gthread_cond_signal(&_M_cond);
+}
+
+void condition_variable::notify_all() noexcept {
+	__gthread_cond_broadcast(&_M_cond);
+}
+}  // namespace std
+
+/******************************************************************************/
+/**                                  Clocks                                  **/
+/**                                                                          **/
+/**  std::chrono::system_clock and steady_clock count nanoseconds, but       **/
+/**  libstdc++ reads them through gettimeofday() or time(), and its chrono.o **/
+/**  can't be left out of the cold package. common.mk wraps their now()      **/
+/**  functions instead, so these read the global timer through               **/
+/**  hrtimer_nanos(). high_resolution_clock is system_clock, and both start  **/
+/**  at 0 when PROS initializes.                                             **/
+/******************************************************************************/
+extern "C" std::chrono::system_clock::time_point __wrap__ZNSt6chrono3_V212system_clock3nowEv() noexcept {
+	return std::chrono::system_clock::time_point(std::chrono::nanoseconds(hrtimer_nanos()));
+}
+
+extern "C" std::chrono::steady_clock::time_point __wrap__ZNSt6chrono3_V212steady_clock3nowEv() noexcept {
+	return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(hrtimer_nanos()));
+}
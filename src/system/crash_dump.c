@@ -0,0 +1,137 @@
+/**
+ * \file system/crash_dump.c
+ *
+ * Binary crash dumps
+ *
+ * When a data abort happens, the registers, the running task's stack around sp,
+ * a list of every task and the most recent scheduler trace events are copied
+ * into a crash_dump_s_t, laid out in system/crash_dump.h. The dump lives in
+ * the .noinit section, which isn't loaded or cleared at startup, so it is
+ * still there the next time the program starts if the brain wasn't powered
+ * off in between.
+ *
+ * The dump is written to the next free /usd/crash-N.bin straight from the
+ * abort handler, unless a task was in the middle of using the card. Otherwise
+ * it is written when the program next starts. Either way it is only written
+ * once.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "common/crc.h"
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+#include "rtos/tcb.h"
+#include "rtos/trace_recorder.h"
+#include "system/crash_dump.h"
+#include "system/dev/usd.h"
+#include "system/hot.h"
+#include "v5_api.h"
+
+// Room for more tasks than the dump keeps, since the task list can only be
+// read all at once
+#define CRASH_DUMP_STATUS_COUNT (2 * CRASH_DUMP_MAX_TASKS)
+
+static crash_dump_s_t crash_dump __attribute__((section(".noinit"), aligned(8)));
+static TaskStatus_t statuses[CRASH_DUMP_STATUS_COUNT];
+
+static uint32_t crash_dump_crc(void) {
+	const uint8_t* const start = (const uint8_t*)&crash_dump.crc + sizeof(crash_dump.crc);
+	return crc32(CRC32_INIT, start, (const uint8_t*)(&crash_dump + 1) - start);
+}
+
+// called by report_data_abort() in unwind.c
+void crash_dump_capture(const uint32_t* regs) {
+	memset(&crash_dump, 0, sizeof(crash_dump));
+	crash_dump.version = CRASH_DUMP_VERSION;
+	crash_dump.size = sizeof(crash_dump);
+	crash_dump.millis = vexSystemTimeGet();
+	asm volatile("mrc p15, 0, %0, c5, c0, 0" : "=r"(crash_dump.dfsr));
+	asm volatile("mrc p15, 0, %0, c6, c0, 0" : "=r"(crash_dump.dfar));
+	memcpy(crash_dump.regs, regs, sizeof(crash_dump.regs));
+	crash_dump.hot_table = (uint32_t)HOT_TABLE;
+
+	TCB_t* const tcb = pxCurrentTCB;
+	if (tcb != NULL) {
+		crash_dump.tcb = (uint32_t)tcb;
+		strncpy(crash_dump.task_name, tcb->pcTaskName, sizeof(crash_dump.task_name));
+		crash_dump.stack_base = (uint32_t)tcb->pxStack;
+		crash_dump.stack_end = (uint32_t)tcb->pxEndOfStack;
+		// Only copy from sp when it is inside the task's stack, so a corrupt sp
+		// can't fault again in here
+		const uint32_t* const sp = (const uint32_t*)regs[13];
+		if (sp >= tcb->pxStack && sp <= tcb->pxEndOfStack) {
+			uint32_t words = tcb->pxEndOfStack - sp + 1;
+			if (words > CRASH_DUMP_STACK_WORDS) words = CRASH_DUMP_STACK_WORDS;
+			memcpy(crash_dump.stack, sp, words * sizeof(uint32_t));
+			crash_dump.stack_words = words;
+		}
+
+		uint32_t count = uxTaskGetSystemStateFromAbort(statuses, CRASH_DUMP_STATUS_COUNT);
+		if (count > CRASH_DUMP_MAX_TASKS) count = CRASH_DUMP_MAX_TASKS;
+		for (uint32_t i = 0; i < count; i++) {
+			crash_dump_task_s_t* const task = &crash_dump.tasks[i];
+			task->tcb = (uint32_t)statuses[i].xHandle;
+			task->top_of_stack = (uint32_t)((TCB_t*)statuses[i].xHandle)->pxTopOfStack;
+			task->stack_base = (uint32_t)statuses[i].pxStackBase;
+			task->stack_end = (uint32_t)statuses[i].pxEndOfStack;
+			task->number = statuses[i].xTaskNumber;
+			task->state = statuses[i].eCurrentState;
+			task->priority = statuses[i].uxCurrentPriority;
+			strncpy(task->name, statuses[i].pcTaskName, sizeof(task->name));
+		}
+		crash_dump.task_count = count;
+	}
+
+	crash_dump.trace_count = trace_copy_recent(crash_dump.trace, CRASH_DUMP_TRACE_EVENTS);
+	crash_dump.crc = crash_dump_crc();
+	crash_dump.magic = CRASH_DUMP_MAGIC;
+}
+
+int32_t crash_dump_persist(void) {
+	if (crash_dump.magic != CRASH_DUMP_MAGIC || crash_dump.size != sizeof(crash_dump) ||
+	    crash_dump.crc != crash_dump_crc()) {
+		return -1;
+	}
+	if (vexFileMountSD() != F_OK) return -1;
+	char path[16];
+	for (int32_t n = 0; n < CRASH_DUMP_MAX_FILES; n++) {
+		snprintf(path, sizeof(path), "crash-%ld.bin", n);
+		FIL* fptr = vexFileOpen(path, "");  // mode is ignored
+		if (fptr != NULL) {
+			vexFileClose(fptr);
+			continue;
+		}
+		if ((fptr = vexFileOpenCreate(path)) == NULL) return -1;
+		int32_t written = vexFileWrite((char*)&crash_dump, 1, sizeof(crash_dump), fptr);
+		vexFileClose(fptr);
+		if (written != sizeof(crash_dump)) return -1;
+		crash_dump.magic = 0;
+		return n;
+	}
+	return -1;
+}
+
+// called by report_data_abort() in unwind.c
+int32_t crash_dump_persist_from_abort(void) {
+	// A task which was using the card may have left the file system half way
+	// through an update
+	if (usd_io_is_locked()) return -1;
+	return crash_dump_persist();
+}
+
+// called by pros_init() in startup.c
+void crash_dump_initialize(void) {
+	if (crash_dump.magic != CRASH_DUMP_MAGIC) return;
+	usd_io_lock();
+	crash_dump_persist();
+	usd_io_unlock();
+}
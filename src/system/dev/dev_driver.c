@@ -42,16 +42,10 @@ typedef struct dev_file_arg {
 int dev_read_r(struct _reent* r, void* const arg, uint8_t* buffer, const size_t len) {
 	dev_file_arg_t* file_arg = (dev_file_arg_t*)arg;
 	uint32_t port = file_arg->port;
-	int32_t recv = 0;
-	while (true) {
-		recv = serial_read(port, (uint8_t*)(buffer + recv), len - recv);
-		if (recv == PROS_ERR) {
-			return 0;
-		}
-		if (file_arg->flags & O_NONBLOCK || recv >= 1) {
-			break;
-		}
-		task_delay(2);
+	// wait for the system daemon to receive data unless the file is non-blocking
+	int32_t recv = serial_rx_read(port, buffer, len, file_arg->flags & O_NONBLOCK ? 0 : TIMEOUT_MAX);
+	if (recv == PROS_ERR) {
+		return 0;
 	}
 	if (recv == 0) {
 		errno = EAGAIN;
@@ -63,17 +57,10 @@ int dev_read_r(struct _reent* r, void* const arg, uint8_t* buffer, const size_t
 int dev_write_r(struct _reent* r, void* const arg, const uint8_t* buf, const size_t len) {
 	dev_file_arg_t* file_arg = (dev_file_arg_t*)arg;
 	uint32_t port = file_arg->port;
-	int32_t wrtn = 0;
-	while (true) {
-		int32_t w = serial_write(port, (uint8_t*)(buf + wrtn), len - wrtn);
-		if (w == PROS_ERR) {
-			return wrtn;
-		}
-		wrtn += w;
-		if (file_arg->flags & O_NONBLOCK || wrtn >= len) {
-			break;
-		}
-		task_delay(2);
+	// the system daemon transmits the queued data as the port frees up
+	int32_t wrtn = serial_tx_write(port, buf, len, file_arg->flags & O_NONBLOCK ? 0 : TIMEOUT_MAX);
+	if (wrtn == PROS_ERR) {
+		return 0;
 	}
 	if (wrtn == 0) {
 		errno = EAGAIN;
@@ -119,6 +106,14 @@ int dev_ctl(void* const arg, const uint32_t cmd, void* const extra_arg) {
 	}
 }
 
+int16_t dev_poll(void* const arg, const int16_t events) {
+	dev_file_arg_t* file_arg = (dev_file_arg_t*)arg;
+	int16_t ready = 0;
+	if (serial_rx_get_used(file_arg->port) > 0) ready |= VFS_POLLIN;
+	if (serial_tx_get_unused(file_arg->port) > 0) ready |= VFS_POLLOUT;
+	return events & ready;
+}
+
 /******************************************************************************/
 /**                           Driver description                             **/
 /******************************************************************************/
@@ -128,7 +123,8 @@ const struct fs_driver _dev_driver = {.close_r = dev_close_r,
                                       .lseek_r = dev_lseek_r,
                                       .read_r = dev_read_r,
                                       .write_r = dev_write_r,
-                                      .ctl = dev_ctl};
+                                      .ctl = dev_ctl,
+                                      .poll = dev_poll};
 
 const struct fs_driver* const dev_driver = &_dev_driver;
 
@@ -161,8 +157,6 @@ int dev_open_r(struct _reent* r, const char* path, int flags, int mode) {
 	}
 	serial_enable(port);
 
-	dev_file_arg_t* arg = (dev_file_arg_t*)kmalloc(sizeof(dev_file_arg_t));
-	arg->port = port;
-	arg->flags = flags;
-	return vfs_add_entry_r(r, dev_driver, arg);
+	dev_file_arg_t arg = {.port = port, .flags = flags};
+	return vfs_add_entry_inline_r(r, dev_driver, &arg, sizeof(arg));
 }
@@ -0,0 +1,246 @@
+/**
+ * \file system/dev/plog.c
+ *
+ * Deferred logging
+ *
+ * plog() keeps its format string in the .plog_fmt section and plog_write()
+ * only walks it for the conversion specifiers, copying each argument's raw
+ * bytes into a record. The records go into a bounded queue which many tasks
+ * can add to without locking: each slot has a sequence number saying whether
+ * it is free or holds a record yet, and producers claim slots by advancing the
+ * enqueue position with a compare and swap. A background task takes the
+ * records out in order and sends them in batches on the plog stream.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "system/dev/ser.h"
+
+#define PLOG_QUEUE_LENGTH 256  // must be a power of 2
+#define PLOG_DRAIN_PERIOD 5    // ms
+#define PLOG_FRAME_SIZE 512
+
+typedef struct plog_slot {
+	uint32_t seq;
+	const char* fmt;
+	uint32_t time;
+	uint8_t len;
+	uint8_t args[PLOG_ARGS_SIZE];
+} plog_slot_s_t;
+
+// A record as it is sent: the address of its format, its time and length
+#define PLOG_RECORD_HEADER_SIZE 9
+
+static plog_slot_s_t slots[PLOG_QUEUE_LENGTH];
+static uint32_t enqueue_pos;
+static uint32_t dequeue_pos;  // only used by the drain task
+static uint32_t dropped;
+// While the CPU is overloaded only 1 in shed_ratio messages is queued
+static uint32_t shed_ratio = 1;
+static uint32_t shed_count;
+static uint32_t shed;
+
+static task_stack_t plog_task_stack[TASK_STACK_DEPTH_MIN];
+static static_task_s_t plog_task_buffer;
+
+// Appends an argument to args, returning false if it doesn't fit
+static inline bool plog_put(uint8_t* args, size_t* len, const void* value, size_t size) {
+	if (*len + size > PLOG_ARGS_SIZE) return false;
+	memcpy(args + *len, value, size);
+	*len += size;
+	return true;
+}
+
+// Copies the arguments for fmt's conversions into args. Returns the number of
+// bytes used, stopping at the first argument which doesn't fit. Also packs the
+// kernel log's records, see klog.c
+size_t plog_pack(uint8_t* args, const char* fmt, va_list* ap) {
+	size_t len = 0;
+	while (*fmt) {
+		if (*fmt++ != '%') continue;
+		if (*fmt == '%') {
+			fmt++;
+			continue;
+		}
+		while (*fmt && strchr("-+ #0", *fmt)) fmt++;
+		// a * width or precision is an int argument of its own
+		if (*fmt == '*') {
+			int const width = va_arg(*ap, int);
+			if (!plog_put(args, &len, &width, sizeof(width))) return len;
+			fmt++;
+		}
+		while (*fmt >= '0' && *fmt <= '9') fmt++;
+		size_t precision = PLOG_ARGS_SIZE;
+		if (*fmt == '.') {
+			fmt++;
+			if (*fmt == '*') {
+				int const given = va_arg(*ap, int);
+				if (!plog_put(args, &len, &given, sizeof(given))) return len;
+				if (given >= 0) precision = given;
+				fmt++;
+			} else {
+				precision = 0;
+				while (*fmt >= '0' && *fmt <= '9') precision = precision * 10 + (*fmt++ - '0');
+			}
+		}
+		bool wide = false;
+		while (*fmt && strchr("hlLqjzt", *fmt)) {
+			// ll and j are the only 64-bit integers, long is 32 bits
+			bool const ll = *fmt == 'l' && fmt[1] == 'l';
+			wide |= ll || *fmt == 'j';
+			fmt += ll ? 2 : 1;
+		}
+		bool fits = true;
+		switch (*fmt) {
+			case '\0':
+				return len;
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A': {
+				double const value = va_arg(*ap, double);
+				fits = plog_put(args, &len, &value, sizeof(value));
+				break;
+			}
+			case 's': {
+				const char* str = va_arg(*ap, const char*);
+				if (str == NULL) str = "(null)";
+				if (len >= PLOG_ARGS_SIZE) return len;
+				// strings are cut short to fit, but always terminated
+				size_t n = strnlen(str, precision);
+				if (n > PLOG_ARGS_SIZE - len - 1) n = PLOG_ARGS_SIZE - len - 1;
+				memcpy(args + len, str, n);
+				args[len + n] = '\0';
+				len += n + 1;
+				break;
+			}
+			case 'p': {
+				void* const value = va_arg(*ap, void*);
+				fits = plog_put(args, &len, &value, sizeof(value));
+				break;
+			}
+			default:
+				if (wide) {
+					long long const value = va_arg(*ap, long long);
+					fits = plog_put(args, &len, &value, sizeof(value));
+				} else {
+					int const value = va_arg(*ap, int);
+					fits = plog_put(args, &len, &value, sizeof(value));
+				}
+				break;
+		}
+		if (!fits) return len;
+		fmt++;
+	}
+	return len;
+}
+
+bool plog_write(const char* fmt, ...) {
+	uint32_t const ratio = __atomic_load_n(&shed_ratio, __ATOMIC_RELAXED);
+	if (ratio > 1 && __atomic_fetch_add(&shed_count, 1, __ATOMIC_RELAXED) % ratio != 0) {
+		__atomic_add_fetch(&shed, 1, __ATOMIC_RELAXED);
+		return false;
+	}
+	uint8_t args[PLOG_ARGS_SIZE];
+	va_list ap;
+	va_start(ap, fmt);
+	size_t const len = plog_pack(args, fmt, &ap);
+	va_end(ap);
+
+	// Claim the slot at the enqueue position, which is free once the drain task
+	// has given it the sequence number of this lap around the queue
+	plog_slot_s_t* slot;
+	uint32_t pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+	while (true) {
+		slot = &slots[pos & (PLOG_QUEUE_LENGTH - 1)];
+		int32_t const diff = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos;
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+		} else if (diff < 0) {
+			// the slot still holds a record from the last lap, so the queue is full
+			__atomic_add_fetch(&dropped, 1, __ATOMIC_RELAXED);
+			return false;
+		} else {
+			pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+		}
+	}
+	slot->fmt = fmt;
+	slot->time = micros();
+	slot->len = len;
+	memcpy(slot->args, args, len);
+	__atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+uint32_t plog_get_dropped(void) {
+	return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
+
+// Called by system/overload.c
+void plog_set_shed_ratio(uint32_t ratio) {
+	__atomic_store_n(&shed_ratio, ratio, __ATOMIC_RELAXED);
+}
+
+uint32_t plog_get_shed(void) {
+	return __atomic_load_n(&shed, __ATOMIC_RELAXED);
+}
+
+static size_t plog_put_record(uint8_t* frame, const char* fmt, uint32_t time, const void* args, uint8_t len) {
+	uint32_t const addr = (uint32_t)fmt;
+	memcpy(frame, &addr, sizeof(addr));
+	memcpy(frame + 4, &time, sizeof(time));
+	frame[8] = len;
+	memcpy(frame + PLOG_RECORD_HEADER_SIZE, args, len);
+	return PLOG_RECORD_HEADER_SIZE + len;
+}
+
+static void plog_task(void* ign) {
+	static uint8_t frame[PLOG_FRAME_SIZE];
+	uint32_t reported_drops = 0;
+	while (true) {
+		task_delay(PLOG_DRAIN_PERIOD);
+		bool const sent = ser_stream_is_sent(PLOG_STREAM_ID);
+		size_t frame_len = 0;
+		uint32_t const drops = plog_get_dropped();
+		if (drops != reported_drops) {
+			uint32_t const count = drops - reported_drops;
+			frame_len += plog_put_record(frame, NULL, micros(), &count, sizeof(count));
+			reported_drops = drops;
+		}
+		while (true) {
+			plog_slot_s_t* const slot = &slots[dequeue_pos & (PLOG_QUEUE_LENGTH - 1)];
+			if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != dequeue_pos + 1) break;
+			if (frame_len + PLOG_RECORD_HEADER_SIZE + slot->len > sizeof(frame)) {
+				if (sent) ser_frame_write(PLOG_STREAM_ID, frame, frame_len);
+				frame_len = 0;
+			}
+			frame_len += plog_put_record(frame + frame_len, slot->fmt, slot->time, slot->args, slot->len);
+			// free the slot for the producers' next lap around the queue
+			__atomic_store_n(&slot->seq, dequeue_pos + PLOG_QUEUE_LENGTH, __ATOMIC_RELEASE);
+			dequeue_pos++;
+		}
+		if (sent && frame_len) ser_frame_write(PLOG_STREAM_ID, frame, frame_len);
+	}
+}
+
+// called by ser_initialize() in ser_daemon.c
+void plog_initialize(void) {
+	for (uint32_t i = 0; i < PLOG_QUEUE_LENGTH; i++) {
+		slots[i].seq = i;
+	}
+	task_create_static(plog_task, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_MIN, "Deferred Log (PROS)",
+	                   plog_task_stack, &plog_task_buffer);
+}
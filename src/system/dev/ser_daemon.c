@@ -16,14 +16,24 @@
  */
 
 #include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
 
+#include "common/crc.h"
 #include "kapi.h"
 #include "system/dev/banners.h"
+#include "system/dev/ser.h"
+#include "system/dev/vfs.h"
 #include "system/hot.h"
 #include "system/optimizers.h"
 #include "v5_api.h"
 
-#define MAX_COMMAND_LENGTH 32
+#define MAX_COMMAND_LENGTH 64
+#define SER_DAEMON_BLOCK_SIZE 64
+
+// from metrics.c
+extern void metrics_emit_poll(void);
 
 __attribute__((weak)) char const* const _PROS_COMPILE_TIMESTAMP = "Unknown";
 __attribute__((weak)) char const* const _PROS_COMPILE_DIRECTORY = "Unknown";
@@ -53,20 +63,36 @@ void print_large_banner(void) {
 /** this is what read() reads from. Implemented as a ring buffer             **/
 /**  TODO: just use a FreeRTOS queue instead of 2 semaphores                 **/
 /******************************************************************************/
-#define INP_BUFFER_SIZE 0x1000  // 4KB... which is larger than VEX's output buffer -_-
+// 4KB by default... which is larger than VEX's output buffer -_-
+#define INP_BUFFER_SIZE KERNEL_SER_INPUT_BUFFER_SIZE
 
 static static_stream_buf_s_t inp_stream_buf;
-static uint8_t inp_buffer[INP_BUFFER_SIZE];
 static stream_buf_t inp_stream;
 
 static inline void inp_buffer_initialize() {
-	inp_stream = stream_buf_create_static(INP_BUFFER_SIZE, 1, inp_buffer, &inp_stream_buf);
+	const ser_buffer_sizes_s_t* const sizes = boot_get_ser_buffer_sizes();
+	uint8_t* inp_buffer;
+	size_t const size = ser_buffer_alloc(sizes ? sizes->input : 0, INP_BUFFER_SIZE, &inp_buffer);
+	// only the daemon writes, and reads are serialized by the serial driver
+	inp_stream = stream_buf_create_spsc_static(size, inp_buffer, &inp_stream_buf);
 }
 
 // if you extern this function you can place characters on the rest of the
 // system's input buffer
 bool inp_buffer_post(uint8_t b) {
-	return stream_buf_send(inp_stream, &b, 1, TIMEOUT_MAX);
+	bool posted = stream_buf_send(inp_stream, &b, 1, TIMEOUT_MAX);
+	vfs_poll_notify();
+	return posted;
+}
+
+// places a run of characters on the input buffer with a single send
+bool inp_buffer_post_block(const uint8_t* data, size_t len) {
+	if (len == 0) {
+		return true;
+	}
+	bool posted = stream_buf_send(inp_stream, data, len, TIMEOUT_MAX) == len;
+	vfs_poll_notify();
+	return posted;
 }
 
 int32_t inp_buffer_read(uint32_t timeout) {
@@ -82,104 +108,611 @@ int32_t inp_buffer_read(uint32_t timeout) {
 	return (int32_t)b;
 }
 
+// Reads up to and including a newline or len bytes, whichever comes first.
+// Waits for the first byte, then takes whatever else is already buffered
+// straight out of the stream buffer's memory
+size_t inp_buffer_read_line(uint8_t* buffer, size_t len) {
+	if (len == 0) {
+		return 0;
+	}
+	while (!stream_buf_recv(inp_stream, buffer, 1, TIMEOUT_MAX))
+		;
+	size_t read = 1;
+	if (buffer[0] == '\n') {
+		return read;
+	}
+	// Two passes cover data which wraps around the end of the buffer
+	for (int i = 0; i < 2 && read < len; i++) {
+		uint8_t* data;
+		size_t avail = stream_buf_peek_contiguous(inp_stream, &data);
+		if (avail == 0) break;
+		if (avail > len - read) avail = len - read;
+		uint8_t* newline = memchr(data, '\n', avail);
+		if (newline != NULL) avail = newline - data + 1;
+		memcpy(buffer + read, data, avail);
+		stream_buf_consume(inp_stream, avail);
+		read += avail;
+		if (newline != NULL) break;
+	}
+	return read;
+}
+
 // returns the number of bytes currently in the stream
 int32_t inp_buffer_available() {
 	return stream_buf_get_used(inp_stream);
 }
 
+/******************************************************************************/
+/**                            Serial parameters                             **/
+/**                                                                          **/
+/** Values written by the host are staged here and copied into the user's    **/
+/** variables all at once by ser_param_apply                                 **/
+/******************************************************************************/
+typedef struct ser_param {
+	const char* name;
+	ser_param_type_e_t type;
+	void* var;  // int32_t* or float*, both 4 bytes
+	uint32_t staged;
+} ser_param_s_t;
+
+static ser_param_s_t params[SER_PARAM_MAX_COUNT];
+static size_t param_count;
+static uint32_t staged_params;  // bitmap of params with a staged value
+
+static int32_t ser_param_register(const char* const name, void* const var, ser_param_type_e_t type) {
+	if (name == NULL || var == NULL || strlen(name) > SER_PARAM_NAME_LENGTH) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	int32_t rtn = PROS_ERR;
+	rtos_suspend_all();
+	for (size_t i = 0; i < param_count; i++) {
+		if (!strcmp(params[i].name, name)) {
+			errno = EEXIST;
+			goto leave;
+		}
+	}
+	if (param_count >= SER_PARAM_MAX_COUNT) {
+		errno = ENOMEM;
+		goto leave;
+	}
+	params[param_count] = (ser_param_s_t){.name = name, .type = type, .var = var};
+	rtn = param_count++;
+leave:
+	rtos_resume_all();
+	return rtn;
+}
+
+int32_t ser_param_register_int32(const char* const name, int32_t* const var) {
+	return ser_param_register(name, var, E_SER_PARAM_INT32);
+}
+
+int32_t ser_param_register_float(const char* const name, float* const var) {
+	return ser_param_register(name, var, E_SER_PARAM_FLOAT);
+}
+
+int32_t ser_param_apply(void) {
+	// cheap check so control loops don't suspend the scheduler every iteration
+	if (!staged_params) {
+		return 0;
+	}
+	int32_t count = 0;
+	rtos_suspend_all();
+	for (size_t i = 0; i < param_count; i++) {
+		if (staged_params & (1U << i)) {
+			memcpy(params[i].var, &params[i].staged, sizeof(params[i].staged));
+			count++;
+		}
+	}
+	staged_params = 0;
+	rtos_resume_all();
+	return count;
+}
+
+static void param_respond(uint8_t op, uint8_t index, ser_param_status_e_t status, const void* data, size_t len) {
+	uint8_t response[4 + SER_PARAM_NAME_LENGTH];
+	response[0] = op;
+	response[1] = index;
+	response[2] = status;
+	response[3] = index < param_count ? params[index].type : 0;
+	if (len) memcpy(response + 4, data, len);
+	ser_frame_write(SER_PARAM_STREAM_ID, response, 4 + len);
+}
+
+// Handles a parameter request from the host (pRv)
+static void param_command(const uint8_t* request, size_t len) {
+	const uint8_t op = len ? request[0] : 0;
+	const uint8_t index = len > 1 ? request[1] : 0;
+	switch (op) {
+		case 'l':
+			for (size_t i = 0; i < param_count; i++) {
+				param_respond(op, i, E_SER_PARAM_OK, params[i].name, strlen(params[i].name));
+			}
+			param_respond(op, param_count, E_SER_PARAM_END, NULL, 0);
+			return;
+		case 'r':
+			if (len != 2) break;
+			if (index >= param_count) {
+				param_respond(op, index, E_SER_PARAM_BAD_INDEX, NULL, 0);
+			} else {
+				param_respond(op, index, E_SER_PARAM_OK, params[index].var, sizeof(uint32_t));
+			}
+			return;
+		case 'w':
+			if (len != 2 + sizeof(uint32_t)) break;
+			if (index >= param_count) {
+				param_respond(op, index, E_SER_PARAM_BAD_INDEX, NULL, 0);
+				return;
+			}
+			rtos_suspend_all();
+			memcpy(&params[index].staged, request + 2, sizeof(uint32_t));
+			staged_params |= 1U << index;
+			rtos_resume_all();
+			param_respond(op, index, E_SER_PARAM_OK, request + 2, sizeof(uint32_t));
+			return;
+		default:
+			break;
+	}
+	param_respond(op, index, E_SER_PARAM_BAD_REQUEST, NULL, 0);
+}
+
+/******************************************************************************/
+/**                          Clock synchronization                           **/
+/**                                                                          **/
+/** Each exchange is only complete once the next request says when the host  **/
+/** got the answer, so the last exchange's robot times are kept until then.  **/
+/** The answer is queued rather than sent when it's timestamped, and the     **/
+/** daemon polls for input, so both add to an exchange's delay. The fastest  **/
+/** exchange of the last few has the least of that, so it gives the offset.  **/
+/******************************************************************************/
+#define CLOCK_SYNC_WINDOW 8              // exchanges the fastest one is picked from
+#define CLOCK_SYNC_DRIFT_SPAN 10000000   // us from the first estimate before drift is measured
+#define CLOCK_SYNC_RESET_ERROR 100000    // us off the prediction at which the host's clock has jumped
+
+typedef struct clock_sample {
+	uint64_t time;  // micros() halfway through the robot's part of the exchange
+	int64_t offset;
+	uint32_t delay;
+} clock_sample_s_t;
+
+static uint64_t read_time;  // micros() when the daemon last read from the serial line
+static uint64_t pending_times[3];  // the host's send time, read_time and the send time of the last answer
+static clock_sample_s_t clock_samples[CLOCK_SYNC_WINDOW];
+static uint32_t clock_sample_count;
+static clock_sample_s_t clock_anchor;        // the estimate drift is measured from
+static clock_sync_status_s_t clock_status;  // changed with the scheduler suspended
+
+static int64_t clock_predict(const clock_sync_status_s_t* status, uint64_t time) {
+	return status->offset + (int64_t)(status->drift * (double)(int64_t)(time - status->ref_time));
+}
+
+static void clock_sync_sample(uint64_t t1, uint64_t t2, uint64_t t3, uint64_t t4) {
+	int64_t const delay = (int64_t)(t4 - t1) - (int64_t)(t3 - t2);
+	// a host clock which went backwards gives nonsense
+	if (delay < 0 || delay > UINT32_MAX) return;
+	clock_samples[clock_sample_count++ % CLOCK_SYNC_WINDOW] = (clock_sample_s_t){
+	    .time = t2 + (t3 - t2) / 2, .offset = ((int64_t)(t1 - t2) + (int64_t)(t4 - t3)) / 2, .delay = delay};
+	uint32_t const count = clock_sample_count < CLOCK_SYNC_WINDOW ? clock_sample_count : CLOCK_SYNC_WINDOW;
+	const clock_sample_s_t* best = &clock_samples[0];
+	for (uint32_t i = 1; i < count; i++) {
+		if (clock_samples[i].delay < best->delay) best = &clock_samples[i];
+	}
+
+	rtos_suspend_all();
+	int64_t const error = clock_status.samples ? best->offset - clock_predict(&clock_status, best->time) : 0;
+	if (!clock_status.samples || error > CLOCK_SYNC_RESET_ERROR || error < -CLOCK_SYNC_RESET_ERROR) {
+		// first contact, or the host's clock was set, so start over from this exchange
+		clock_samples[0] = clock_samples[(clock_sample_count - 1) % CLOCK_SYNC_WINDOW];
+		clock_sample_count = 1;
+		best = &clock_samples[0];
+		clock_anchor = *best;
+		clock_status.drift = 0;
+	} else if (best->time - clock_anchor.time >= CLOCK_SYNC_DRIFT_SPAN) {
+		clock_status.drift = (double)(best->offset - clock_anchor.offset) / (double)(best->time - clock_anchor.time);
+	}
+	clock_status.ref_time = best->time;
+	clock_status.offset = best->offset;
+	clock_status.delay = best->delay;
+	clock_status.samples++;
+	clock_sync_status_s_t const status = clock_status;
+	rtos_resume_all();
+
+	if (ser_stream_is_sent(SER_TLM_STREAM_ID)) {
+		uint16_t const id = SER_TLM_CLOCK_ID;
+		uint64_t const now = micros();
+		int64_t const offset = clock_predict(&status, now);
+		uint8_t record[sizeof(id) + sizeof(now) + sizeof(offset) + sizeof(status.drift)];
+		memcpy(record, &id, sizeof(id));
+		memcpy(record + 2, &now, sizeof(now));
+		memcpy(record + 10, &offset, sizeof(offset));
+		memcpy(record + 18, &status.drift, sizeof(status.drift));
+		ser_frame_write(SER_TLM_STREAM_ID, record, sizeof(record));
+	}
+}
+
+int32_t clock_sync_get_status(clock_sync_status_s_t* const status) {
+	if (status == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*status = clock_status;
+	rtos_resume_all();
+	if (!status->samples) {
+		errno = EAGAIN;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+uint64_t clock_sync_to_host(const uint64_t time) {
+	clock_sync_status_s_t status;
+	if (clock_sync_get_status(&status) == PROS_ERR) return 0;
+	return time + clock_predict(&status, time);
+}
+
+// Reads everything which is waiting on the serial line, up to size bytes.
+// Waits until there's at least one byte, sending metrics snapshots meanwhile
+static size_t vex_read_block(uint8_t* buf, size_t size) {
+	while (1) {
+		metrics_emit_poll();
+		size_t n = 0;
+		while (n < size) {
+			int32_t b = vexSerialReadChar(1);
+			// Don't get rid of the literal type suffix, it ensures optimiziations
+			// don't break this condition
+			if (b == -1L) break;
+			buf[n++] = (uint8_t)b;
+		}
+		if (n) return n;
+		task_delay(1);
+	}
+}
+
+/******************************************************************************/
+/**                              File transfer                               **/
+/**                                                                          **/
+/** Blocks are read straight into block_data instead of going through the    **/
+/** command parser one byte at a time, then checked and written with the     **/
+/** uSD driver's write-behind buffer. Only the block after the last one      **/
+/** written is taken, so after a bad block the host resends from there.     **/
+/******************************************************************************/
+typedef struct file_rx {
+	int fd;  // -1 while no upload is open
+	uint32_t size;
+	uint32_t crc;  // of the whole file, from the host
+	uint32_t written;
+	uint32_t written_crc;
+	uint16_t next_seq;
+	// the block being read
+	uint16_t block_seq;
+	uint32_t block_crc;
+	size_t block_len;
+	size_t block_received;
+} file_rx_s_t;
+
+static file_rx_s_t file_rx = {.fd = -1};
+static uint8_t block_data[SER_FILE_BLOCK_SIZE];
+
+static void file_respond(uint8_t op, ser_file_status_e_t status) {
+	uint8_t response[2 + sizeof(uint16_t) + sizeof(uint32_t)];
+	response[0] = op;
+	response[1] = status;
+	memcpy(response + 2, &file_rx.next_seq, sizeof(uint16_t));
+	memcpy(response + 4, &file_rx.written, sizeof(uint32_t));
+	ser_frame_write(SER_FILE_STREAM_ID, response, sizeof(response));
+}
+
+static void file_rx_close(void) {
+	if (file_rx.fd >= 0) close(file_rx.fd);
+	file_rx.fd = -1;
+}
+
+// Handles a file transfer request from the host (pRf)
+static void file_command(const uint8_t* request, size_t len) {
+	const uint8_t op = len ? request[0] : 0;
+	switch (op) {
+		case 'o': {
+			// the size and CRC of the file, then its path on the card
+			size_t const header = 1 + 2 * sizeof(uint32_t);
+			char path[sizeof("/usd/") + MAX_COMMAND_LENGTH] = "/usd/";
+			if (len <= header) break;
+			file_rx_close();
+			memcpy(&file_rx.size, request + 1, sizeof(uint32_t));
+			memcpy(&file_rx.crc, request + 5, sizeof(uint32_t));
+			memcpy(path + strlen("/usd/"), request + header, len - header);
+			file_rx.written = 0;
+			file_rx.written_crc = CRC32_INIT;
+			file_rx.next_seq = 0;
+			file_rx.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC);
+			file_respond(op, file_rx.fd < 0 ? E_SER_FILE_OPEN_FAILED : E_SER_FILE_OK);
+			return;
+		}
+		case 'c': {
+			if (len != 1) break;
+			if (file_rx.fd < 0) {
+				file_respond(op, E_SER_FILE_NOT_OPEN);
+				return;
+			}
+			ser_file_status_e_t status = E_SER_FILE_OK;
+			if (file_rx.written != file_rx.size) {
+				status = E_SER_FILE_BAD_SIZE;
+			} else if (file_rx.written_crc != file_rx.crc) {
+				status = E_SER_FILE_BAD_CRC;
+			}
+			// the write-behind buffer is written out on close
+			if (close(file_rx.fd) != 0 && status == E_SER_FILE_OK) status = E_SER_FILE_WRITE_FAILED;
+			file_rx.fd = -1;
+			file_respond(op, status);
+			return;
+		}
+		case 'x':
+			if (len != 1) break;
+			file_rx_close();
+			file_respond(op, E_SER_FILE_OK);
+			return;
+		default:
+			break;
+	}
+	file_respond(op, E_SER_FILE_BAD_REQUEST);
+}
+
+// Whether the block's header asked for more than fits, in which case the payload
+// is skipped and the block refused once it's all in
+static inline bool file_block_oversized(void) {
+	return file_rx.block_len > SER_FILE_BLOCK_SIZE;
+}
+
+static void file_block_finish(void) {
+	ser_file_status_e_t status = E_SER_FILE_OK;
+	if (file_rx.fd < 0) {
+		status = E_SER_FILE_NOT_OPEN;
+	} else if (file_block_oversized()) {
+		status = E_SER_FILE_BAD_REQUEST;
+	} else if (file_rx.block_seq != file_rx.next_seq) {
+		status = E_SER_FILE_OUT_OF_ORDER;
+	} else if (crc32(CRC32_INIT, block_data, file_rx.block_len) != file_rx.block_crc) {
+		status = E_SER_FILE_BAD_CRC;
+	} else if (write(file_rx.fd, block_data, file_rx.block_len) != (ssize_t)file_rx.block_len) {
+		status = E_SER_FILE_WRITE_FAILED;
+	} else {
+		file_rx.written += file_rx.block_len;
+		file_rx.written_crc = crc32(file_rx.written_crc, block_data, file_rx.block_len);
+		file_rx.next_seq++;
+	}
+	file_respond('F', status);
+}
+
+// Starts reading a block (pRF) given its sequence number, length and CRC
+static void file_block_command(const uint8_t* arg, size_t len) {
+	uint16_t block_len;
+	memcpy(&file_rx.block_seq, arg, sizeof(uint16_t));
+	memcpy(&block_len, arg + 2, sizeof(uint16_t));
+	memcpy(&file_rx.block_crc, arg + 4, sizeof(uint32_t));
+	file_rx.block_len = block_len;
+	file_rx.block_received = 0;
+	if (block_len == 0) file_block_finish();
+}
+
+// Takes up to len bytes of the block's payload, returning how many were taken
+static size_t file_block_feed(const uint8_t* data, size_t len) {
+	size_t const remaining = file_rx.block_len - file_rx.block_received;
+	if (len > remaining) len = remaining;
+	if (!file_block_oversized()) memcpy(block_data + file_rx.block_received, data, len);
+	file_rx.block_received += len;
+	if (file_rx.block_received == file_rx.block_len) file_block_finish();
+	return len;
+}
+
+// Whether the parser has handed the input over to a block's payload
+static inline bool file_block_pending(void) {
+	return file_rx.block_received < file_rx.block_len;
+}
+
+// Reads the rest of a block's payload from the serial line into block_data
+static void file_block_read(void) {
+	while (file_block_pending()) {
+		file_rx.block_received +=
+		    vex_read_block(block_data + file_rx.block_received, file_rx.block_len - file_rx.block_received);
+	}
+	file_block_finish();
+}
+
 /******************************************************************************/
 /**                              Serial Daemon                               **/
 /******************************************************************************/
-static task_stack_t ser_daemon_stack[TASK_STACK_DEPTH_MIN];
+// from metrics.c
+extern void metrics_command(const uint8_t* request, size_t len);
+
+static task_stack_t ser_daemon_stack[KERNEL_SER_DAEMON_STACK_DEPTH];
 static static_task_s_t ser_daemon_task_buffer;
 
-static inline uint8_t vex_read_char() {
-	int32_t b = vexSerialReadChar(1);
-	while (b == -1L) {
-		task_delay(1);
-		b = vexSerialReadChar(1);
+static void alive_command(const uint8_t* arg, size_t len) {
+	fprintf(stderr, "I'm alive!\n");
+}
+
+static void small_banner_command(const uint8_t* arg, size_t len) {
+	task_delay(20);
+	print_small_banner();
+}
+
+static void large_banner_command(const uint8_t* arg, size_t len) {
+	task_delay(20);
+	print_large_banner();
+}
+
+static void activate_command(const uint8_t* arg, size_t len) {
+	// the parameter expected to serctl is the stream id (a uint32_t), so we need
+	// to cast to a uint32_t pointer, dereference it, and cast to a void* to make
+	// the compiler happy
+	serctl(SERCTL_ACTIVATE, (void*)(*(uint32_t*)arg));
+}
+
+static void deactivate_command(const uint8_t* arg, size_t len) {
+	serctl(SERCTL_DEACTIVATE, (void*)(*(uint32_t*)arg));
+}
+
+static void enable_cobs_command(const uint8_t* arg, size_t len) {
+	serctl(SERCTL_ENABLE_COBS, NULL);
+}
+
+static void disable_cobs_command(const uint8_t* arg, size_t len) {
+	serctl(SERCTL_DISABLE_COBS, NULL);
+}
+
+// Answers a clock synchronization request (pRt), finishing the last exchange
+// if the host says when that answer got to it
+static void clock_sync_command(const uint8_t* arg, size_t len) {
+	uint64_t request[3];  // this request's send time, then the last one's and when its answer arrived
+	memcpy(request, arg, sizeof(request));
+	if (request[1] && request[1] == pending_times[0] && request[2]) {
+		clock_sync_sample(pending_times[0], pending_times[1], pending_times[2], request[2]);
+	}
+	uint64_t answer[3] = {request[0], read_time, 0};
+	answer[2] = micros();
+	ser_frame_write(SER_SYNC_STREAM_ID, answer, sizeof(answer));
+	memcpy(pending_times, answer, sizeof(answer));
+}
+
+// Commands whose argument starts with its own length byte
+#define COMMAND_ARG_FRAMED 0xFF
+// The stack holds "pR", the command character and the argument
+#define MAX_COMMAND_ARG_LENGTH (MAX_COMMAND_LENGTH - 4)
+
+typedef struct command {
+	uint8_t name;
+	uint8_t arg_length;  // fixed argument length, or COMMAND_ARG_FRAMED
+	void (*run)(const uint8_t* arg, size_t len);
+} command_s_t;
+
+// Kernel commands are "pR" followed by the command character and its argument.
+// Add new commands here
+static const command_s_t commands[] = {
+    {'a', 0, alive_command},
+    {'b', 0, small_banner_command},
+    {'B', 0, large_banner_command},
+    {'e', 4, activate_command},
+    {'d', 4, deactivate_command},
+    {'c', 0, enable_cobs_command},
+    {'r', 0, disable_cobs_command},
+    {'v', COMMAND_ARG_FRAMED, param_command},
+    {'t', 3 * sizeof(uint64_t), clock_sync_command},
+    {'m', COMMAND_ARG_FRAMED, metrics_command},
+    {'f', COMMAND_ARG_FRAMED, file_command},
+    {'F', 2 * sizeof(uint16_t) + sizeof(uint32_t), file_block_command},
+};
+#define commands_size (sizeof(commands) / sizeof(*commands))
+
+// The parser is fed one byte at a time so commands may be split across reads
+typedef struct command_parser {
+	enum { E_CMD_IDLE, E_CMD_PREFIX, E_CMD_NAME, E_CMD_LENGTH, E_CMD_ARG } state;
+	const command_s_t* command;
+	uint8_t stack[MAX_COMMAND_LENGTH];
+	size_t idx;
+	size_t arg_length;
+} command_parser_s_t;
+
+// Feeds a byte to the parser. Returns false if the byte doesn't continue the
+// command, in which case the partial command has been put back on the input
+// buffer and the byte should be treated as regular input
+static bool command_parse(command_parser_s_t* parser, uint8_t b) {
+	switch (parser->state) {
+		case E_CMD_IDLE:
+			if (b != 'p') return false;  // TODO: make the command prefix not typeable
+			parser->stack[0] = b;
+			parser->idx = 1;
+			parser->state = E_CMD_PREFIX;
+			return true;
+		case E_CMD_PREFIX:
+			if (b != 'R') {
+				// empty out the command stack onto the input buffer since something
+				// wasn't right with the command
+				inp_buffer_post_block(parser->stack, parser->idx);
+				parser->state = E_CMD_IDLE;
+				return false;
+			}
+			parser->stack[parser->idx++] = b;
+			parser->state = E_CMD_NAME;
+			return true;
+		case E_CMD_NAME:
+			parser->command = NULL;
+			for (size_t i = 0; i < commands_size; i++) {
+				if (commands[i].name == b) {
+					parser->command = &commands[i];
+					break;
+				}
+			}
+			if (parser->command == NULL) {
+				// unknown commands are dropped
+				parser->state = E_CMD_IDLE;
+				return true;
+			}
+			parser->stack[parser->idx++] = b;
+			parser->arg_length = parser->command->arg_length;
+			if (parser->arg_length == COMMAND_ARG_FRAMED) {
+				parser->state = E_CMD_LENGTH;
+				return true;
+			}
+			break;
+		case E_CMD_LENGTH:
+			if (b > MAX_COMMAND_ARG_LENGTH) {
+				parser->state = E_CMD_IDLE;
+				return true;
+			}
+			parser->stack[parser->idx++] = b;
+			parser->arg_length = b;
+			break;
+		case E_CMD_ARG:
+			parser->stack[parser->idx++] = b;
+			parser->arg_length--;
+			break;
+	}
+	if (parser->arg_length) {
+		parser->state = E_CMD_ARG;
+		return true;
 	}
-	// Don't get rid of the literal type suffix, it ensures optimiziations don't
-	// break this condition
-	return (uint8_t)b;
+	// the argument comes after "pR", the command character and the length byte
+	const uint8_t* arg = parser->stack + 3;
+	if (parser->command->arg_length == COMMAND_ARG_FRAMED) arg++;
+	parser->command->run(arg, parser->stack + parser->idx - arg);
+	parser->state = E_CMD_IDLE;
+	return true;
 }
 
 static void ser_daemon_task(void* ign) {
-	uint8_t command_stack[MAX_COMMAND_LENGTH];
-	size_t command_stack_idx = 0;
+	uint8_t block[SER_DAEMON_BLOCK_SIZE];
+	command_parser_s_t parser = {.state = E_CMD_IDLE};
 
 	print_large_banner();
 
 	while (1) {
-		uint8_t b = vex_read_char();
-		if (b == 'p') {  // TODO: make the command prefix not typeable
-			command_stack[command_stack_idx++] = b;
-			b = vex_read_char();
-			if (b == 'R') {
-				command_stack[command_stack_idx++] = b;
-				b = command_stack[command_stack_idx++] = vex_read_char();
-				switch (b) {
-					case 'a':
-						fprintf(stderr, "I'm alive!\n");
-						command_stack_idx = 0;
-						break;
-					case 'b':
-						task_delay(20);
-						print_small_banner();
-						command_stack_idx = 0;
-						break;
-					case 'B':
-						task_delay(20);
-						print_large_banner();
-						command_stack_idx = 0;
-						break;
-					case 'e':
-						// read next 4 bytes
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						// the parameter expected to serctl is the stream id (a uint32_t), so
-						// we
-						// need to cast to a uint32_t pointer, dereference it, and cast to a
-						// void* to make the compiler happy
-						serctl(SERCTL_ACTIVATE, (void*)(*(uint32_t*)(command_stack + 3)));
-						// printf("enabled %s\n", command_stack + 3);
-						command_stack_idx = 0;
-						break;
-					case 'd':
-						// read next 4 bytes
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						command_stack[command_stack_idx++] = vex_read_char();
-						serctl(SERCTL_DEACTIVATE, (void*)(*(uint32_t*)(command_stack + 3)));
-						// printf("disabled %s\n", command_stack+3);
-						command_stack_idx = 0;
-						break;
-					case 'c':
-						serctl(SERCTL_ENABLE_COBS, NULL);
-						command_stack_idx = 0;
-						break;
-					case 'r':
-						serctl(SERCTL_DISABLE_COBS, NULL);
-						command_stack_idx = 0;
-						break;
-					default:
-						command_stack_idx = 0;
-						break;
+		if (file_block_pending() && !file_block_oversized()) file_block_read();
+		size_t n = vex_read_block(block, sizeof(block));
+		read_time = micros();
+		// Regular input is posted in runs between commands
+		size_t run_start = 0;
+		size_t i = 0;
+		while (i < n) {
+			if (file_block_pending()) {
+				i += file_block_feed(block + i, n - i);
+				run_start = i;
+				continue;
+			}
+			if (parser.state == E_CMD_IDLE) {
+				if (block[i] != 'p') {
+					i++;
+					continue;
 				}
+				inp_buffer_post_block(block + run_start, i - run_start);
 			}
-
-			for (size_t i = 0; i < command_stack_idx; i++) {
-				// empty out the command stack onto the input buffer since something
-				// wasn't right with the command
-				inp_buffer_post(command_stack[i]);
+			if (command_parse(&parser, block[i])) {
+				run_start = ++i;
+			} else {
+				// look at the byte again now that the parser is idle
+				run_start = i;
 			}
-			command_stack_idx = 0;
-		} else {
-			inp_buffer_post(b);
 		}
+		inp_buffer_post_block(block + run_start, n - run_start);
 	}
 }
 
@@ -187,7 +720,11 @@ void ser_initialize(void) {
 	inp_buffer_initialize();
 	extern void ser_driver_initialize(void);
 	ser_driver_initialize();
+	extern void plog_initialize(void);
+	plog_initialize();
+	extern void metrics_initialize(void);
+	metrics_initialize();
 
-	task_create_static(ser_daemon_task, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_MIN, "Serial Daemon (PROS)",
-	                   ser_daemon_stack, &ser_daemon_task_buffer);
+	task_create_static(ser_daemon_task, NULL, TASK_PRIORITY_MIN + 1, KERNEL_SER_DAEMON_STACK_DEPTH,
+	                   "Serial Daemon (PROS)", ser_daemon_stack, &ser_daemon_task_buffer);
 }
@@ -17,6 +17,7 @@
 #include <string.h>
 
 #include "common/cobs.h"
+#include "common/compress.h"
 #include "common/set.h"
 #include "common/string.h"
 #include "kapi.h"
@@ -25,17 +26,23 @@
 #include "system/optimizers.h"
 #include "v5_api.h"
 
-#define VEX_SERIAL_BUFFER_SIZE 2047
+#define VEX_SERIAL_BUFFER_SIZE KERNEL_SER_OUTPUT_BUFFER_SIZE  // the default size of the normal priority queue
+#define SER_FLUSH_PERIOD 1           // ms between capture mode flushes while VEXos is full
 
-// ser_file_arg is 2 words (64 bits). The first word is the stream_id
+// ser_file_arg is 3 words (96 bits). The first word is the stream_id
 // (i.e. sout/serr/jinx/kdbg) and is exactly 4 characters. The second word
-// contains flags for serial driver operation
+// contains flags for serial driver operation. The third caches whether the
+// stream is sent, so writes don't look it up every time
 typedef struct ser_file_arg {
 	union {
 		uint32_t stream_id;
 		uint8_t stream[4];
 	};
 	enum { E_NOBLK_WRITE = 1 } flags;
+	// The generation of enabled_streams_set shifted left by 1, with the lowest
+	// bit set if the stream was sent in that generation. One word so a write
+	// from another task can't tear it
+	uint32_t sent_cache;
 } ser_file_s_t;
 
 #define STDIN_STREAM_ID 0x706e6973   // 'sinp' little endian
@@ -56,15 +63,28 @@ static ser_file_s_t RESERVED_SER_FILES[] = {
 
 // These mutexes are initialized in ser_driver_initialize
 static static_sem_s_t read_mtx_buf;
-static static_sem_s_t write_mtx_buf;
-static mutex_t read_mtx;   // ensures that only one read is happening at a time
-static mutex_t write_mtx;  // ensures that only one write is happening at a time
-
-// Write buffer as a stream buffer. Initialized below in ser_driver_initialize
-static static_stream_buf_s_t write_stream_buf;
-static uint8_t write_buf[VEX_SERIAL_BUFFER_SIZE + 1];
-static uint8_t write_scratch_buf[VEX_SERIAL_BUFFER_SIZE];  // scratch buffer
-static stream_buf_t write_stream;
+static mutex_t read_mtx;  // ensures that only one read is happening at a time
+
+// Output is queued in one stream buffer per priority class, so a chatty stream
+// can't hold up a more important one. Initialized in ser_driver_initialize
+typedef struct output_queue {
+	stream_buf_t stream;
+	static_stream_buf_s_t stream_buf;
+	mutex_t mtx;  // ensures that only one write to this queue is happening at a time
+	static_sem_s_t mtx_buf;
+	// COBS output is encoded in chunks through this buffer, protected by mtx
+	uint8_t cobs_buf[320];
+} output_queue_s_t;
+
+static output_queue_s_t output_queues[E_SER_PRIORITY_COUNT];
+static uint8_t high_priority_buf[KERNEL_SER_PRIORITY_BUFFER_SIZE + 1];
+static uint8_t low_priority_buf[KERNEL_SER_PRIORITY_BUFFER_SIZE + 1];
+
+// Capture mode's flush task, created the first time capture mode is turned on
+static volatile bool capture_mode;
+static task_t flush_task;
+static task_stack_t flush_task_stack[TASK_STACK_DEPTH_MIN];
+static static_task_s_t flush_task_buffer;
 
 // We maintain a set of streams which should actually be sent over the serial
 // line. This is maintained as a separate list and don't traverse through
@@ -84,11 +104,95 @@ static const uint32_t guaranteed_delivery_streams[] = {
 };
 #define guaranteed_delivery_streams_size (sizeof(guaranteed_delivery_streams) / sizeof(*guaranteed_delivery_streams))
 
+bool ser_stream_is_sent(uint32_t stream_id) {
+	return list_contains(guaranteed_delivery_streams, guaranteed_delivery_streams_size, stream_id) ||
+	       set_contains(&enabled_streams_set, stream_id);
+}
+
+// Checks whether writes to a file are sent over the serial line, which only
+// needs the set when it changed since the file last asked
+static bool stream_is_sent(ser_file_s_t* const file) {
+	uint32_t const generation = set_generation(&enabled_streams_set) << 1;
+	uint32_t const cache = __atomic_load_n(&file->sent_cache, __ATOMIC_RELAXED);
+	if ((cache & ~1u) == generation) {
+		return cache & 1;
+	}
+	bool const sent = ser_stream_is_sent(file->stream_id);
+	__atomic_store_n(&file->sent_cache, generation | sent, __ATOMIC_RELAXED);
+	return sent;
+}
+
+// Output configuration and statistics per stream ID. Accessed with the
+// scheduler suspended since writes to different queues run concurrently
+#define MAX_STREAM_STATES 8
+typedef struct stream_state {
+	ser_stream_stats_s_t stats;
+	ser_priority_e_t priority;
+	uint32_t rate;   // bytes per second, 0 for no limit
+	uint32_t burst;  // size of the token bucket in bytes
+	uint32_t tokens;
+	uint32_t last_refill;
+} stream_state_s_t;
+static stream_state_s_t stream_states[MAX_STREAM_STATES];
+
+// Gets the state of a stream, taking a free entry if it has none. Returns NULL
+// if every entry is taken. Must be called with the scheduler suspended
+static stream_state_s_t* get_stream_state(uint32_t stream_id) {
+	for (size_t i = 0; i < MAX_STREAM_STATES; i++) {
+		if (stream_states[i].stats.stream_id == stream_id) return &stream_states[i];
+		if (stream_states[i].stats.stream_id == 0) {
+			stream_states[i].stats.stream_id = stream_id;
+			stream_states[i].priority = stream_id == STDERR_STREAM_ID ? E_SER_PRIORITY_HIGH : E_SER_PRIORITY_NORMAL;
+			return &stream_states[i];
+		}
+	}
+	return NULL;
+}
+
+static void record_stream_write(uint32_t stream_id, size_t len, bool sent) {
+	rtos_suspend_all();
+	stream_state_s_t* state = get_stream_state(stream_id);
+	if (state != NULL) {
+		if (sent) {
+			state->stats.sent += len;
+		} else {
+			state->stats.dropped += len;
+		}
+	}
+	rtos_resume_all();
+}
+
+// Takes len bytes worth of tokens from the stream's bucket and gets the
+// stream's priority. Returns false if the stream is over its rate limit
+static bool admit_stream_write(uint32_t stream_id, size_t len, ser_priority_e_t* priority) {
+	bool admitted = true;
+	*priority = stream_id == STDERR_STREAM_ID ? E_SER_PRIORITY_HIGH : E_SER_PRIORITY_NORMAL;
+	rtos_suspend_all();
+	stream_state_s_t* state = get_stream_state(stream_id);
+	if (state != NULL) {
+		*priority = state->priority;
+		if (state->rate) {
+			uint32_t now = millis();
+			uint64_t tokens = state->tokens + (uint64_t)(now - state->last_refill) * state->rate / 1000;
+			state->tokens = tokens > state->burst ? state->burst : tokens;
+			state->last_refill = now;
+			if (state->tokens >= len) {
+				state->tokens -= len;
+			} else {
+				admitted = false;
+			}
+		}
+	}
+	rtos_resume_all();
+	return admitted;
+}
+
 // global runtime config for the serial driver
 static enum { E_COBS_ENABLED = 1 } ser_driver_runtime_config;
 
 // comes from ser_daemon
-extern int32_t inp_buffer_read(uint32_t timeout);
+extern size_t inp_buffer_read_line(uint8_t* buffer, size_t len);
+extern int32_t inp_buffer_available();
 
 /******************************************************************************/
 /**                              Output queue                                **/
@@ -99,16 +203,138 @@ extern int32_t inp_buffer_read(uint32_t timeout);
 /** underlying access to the write buffer, as opposed to calling queue_recv  **/
 /** a bunch of times                                                         **/
 /******************************************************************************/
+
+// The queue which was flushed in the middle of a COBS frame, or -1. It has to
+// be finished before any other queue is flushed so frames don't interleave
+static int partial_queue = -1;
+
+// Hands a queue's memory straight to VEXos. Two passes cover data which wraps
+// around the end of the buffer. Whatever VEXos doesn't take stays queued for
+// the next cycle
+static int32_t flush_queue(output_queue_s_t* queue, int32_t free, bool* frame_done) {
+	int32_t total = 0;
+	for (int i = 0; i < 2 && free > 0; i++) {
+		uint8_t* data;
+		size_t len = stream_buf_peek_contiguous(queue->stream, &data);
+		if (len == 0) break;
+		if (len > (size_t)free) len = free;
+		int32_t sent = vexSerialWriteBuffer(1, data, len);
+		if (sent <= 0) break;
+		*frame_done = !(ser_driver_runtime_config & E_COBS_ENABLED) || data[sent - 1] == 0;
+		stream_buf_consume(queue->stream, sent);
+		free -= sent;
+		total += sent;
+		if ((size_t)sent < len) break;
+	}
+	return total;
+}
+
 void ser_output_flush(void) {
-	size_t len = stream_buf_recv(write_stream, write_scratch_buf, vexSerialWriteFree(1), 0);
-	uint32_t ret = vexSerialWriteBuffer(1, write_scratch_buf, len);
-	if (ret != len) {
-		display_error("WARNING: some serial data has been dropped");
+	int32_t free = vexSerialWriteFree(1);
+	bool frame_done = true;
+	if (partial_queue >= 0) {
+		free -= flush_queue(&output_queues[partial_queue], free, &frame_done);
+		if (!frame_done) return;
+		partial_queue = -1;
+	}
+	for (int i = 0; i < E_SER_PRIORITY_COUNT && free > 0; i++) {
+		free -= flush_queue(&output_queues[i], free, &frame_done);
+		if (!frame_done) {
+			partial_queue = i;
+			return;
+		}
 	}
 }
 
-bool ser_output_write(const uint8_t* buffer, size_t size, bool noblock) {
-	return stream_buf_send(write_stream, buffer, size, noblock ? 0 : TIMEOUT_MAX);
+static bool output_pending(void) {
+	for (int i = 0; i < E_SER_PRIORITY_COUNT; i++) {
+		if (stream_buf_get_used(output_queues[i].stream)) return true;
+	}
+	return false;
+}
+
+// Flushes whatever is queued as soon as a write wakes it, then keeps flushing
+// every SER_FLUSH_PERIOD until VEXos has taken all of it. The scheduler is
+// suspended around each flush, so it never runs at the same time as the
+// daemon's flush or vexBackgroundProcessing()
+static void flush_task_fn(void* ign) {
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		while (capture_mode) {
+			rtos_suspend_all();
+			ser_output_flush();
+			bool const pending = output_pending();
+			rtos_resume_all();
+			if (!pending) break;
+			task_delay(SER_FLUSH_PERIOD);
+		}
+	}
+}
+
+typedef struct cobs_sink {
+	stream_buf_t stream;
+	bool noblock;
+} cobs_sink_s_t;
+
+// Sink for the streaming COBS encoder
+static size_t cobs_flush(const uint8_t* data, size_t len, void* arg) {
+	cobs_sink_s_t* sink = (cobs_sink_s_t*)arg;
+	return stream_buf_send(sink->stream, data, len, sink->noblock ? 0 : TIMEOUT_MAX);
+}
+
+typedef enum { E_WRITE_SENT, E_WRITE_RATE_LIMITED, E_WRITE_BUSY, E_WRITE_FAILED } write_result_e_t;
+
+// Queues a frame for a stream made of the given parts, without building it in
+// a temporary buffer
+static write_result_e_t write_frame(uint32_t stream_id, const void* const* parts, const size_t* lens, size_t count,
+                                    bool noblock) {
+	size_t len = 0;
+	for (size_t i = 0; i < count; i++) len += lens[i];
+
+	ser_priority_e_t priority;
+	if (!admit_stream_write(stream_id, len, &priority)) {
+		record_stream_write(stream_id, len, false);
+		return E_WRITE_RATE_LIMITED;
+	}
+	const bool cobs_enabled = ser_driver_runtime_config & E_COBS_ENABLED;
+	// Without COBS framing, queues can't be told apart on the wire, so keep
+	// everything in order in one queue
+	output_queue_s_t* queue = &output_queues[cobs_enabled ? priority : E_SER_PRIORITY_NORMAL];
+
+	// need to guarantee writes are in order
+	if (!mutex_take(queue->mtx, noblock ? 0 : TIMEOUT_MAX)) {
+		return E_WRITE_BUSY;
+	}
+	bool ret = true;
+	if (cobs_enabled) {
+		// A non-blocking write must not leave half a frame in the queue, so make
+		// sure the worst case encoding (prefix, data and delimiter) fits up front
+		if (noblock && stream_buf_get_unused(queue->stream) < COBS_ENCODE_MEASURE_MAX(len + 4) + 1) {
+			ret = false;
+		} else {
+			cobs_sink_s_t sink = {.stream = queue->stream, .noblock = noblock};
+			cobs_stream_s_t cobs;
+			cobs_stream_init(&cobs, queue->cobs_buf, sizeof(queue->cobs_buf), cobs_flush, &sink, stream_id);
+			for (size_t i = 0; i < count; i++) {
+				cobs_stream_write(&cobs, parts[i], lens[i]);
+			}
+			ret = cobs_stream_finish(&cobs);
+		}
+	} else {
+		for (size_t i = 0; ret && i < count; i++) {
+			ret = stream_buf_send(queue->stream, parts[i], lens[i], noblock ? 0 : TIMEOUT_MAX) == lens[i];
+		}
+	}
+	mutex_give(queue->mtx);
+	if (capture_mode) task_notify(flush_task);
+	record_stream_write(stream_id, len, ret);
+	return ret ? E_WRITE_SENT : E_WRITE_FAILED;
+}
+
+bool ser_frame_write(uint32_t stream_id, const void* data, size_t len) {
+	const void* parts[] = {data};
+	const size_t lens[] = {len};
+	return write_frame(stream_id, parts, lens, 1, false) == E_WRITE_SENT;
 }
 
 /******************************************************************************/
@@ -116,82 +342,37 @@ bool ser_output_write(const uint8_t* buffer, size_t size, bool noblock) {
 /******************************************************************************/
 int ser_read_r(struct _reent* r, void* const arg, uint8_t* buffer, const size_t len) {
 	// arg isn't used since serial reads aren't stream-based
-	size_t read = 0;
-	int32_t c;
 	if (!mutex_take(read_mtx, TIMEOUT_MAX)) {
 		r->_errno = EACCES;
 		return 0;
 	}
-	while (read < len) {
-		// the logic inside this loop is a bit funky but seems to make newlib behave
-		// properly
-		c = inp_buffer_read(0);
-		// Don't get rid of the literal type suffix, it ensures optimiziations don't
-		// break this condition
-		if (c == -1L) {
-			if (read) {
-				break;
-			} else {
-				continue;
-			}
-		}
-		*(buffer++) = (uint8_t)c;
-		read++;
-		if (c == '\n') {
-			break;
-		}
-	}
+	size_t read = inp_buffer_read_line(buffer, len);
 	mutex_give(read_mtx);
-	*buffer = 0;
+	buffer[read] = 0;
 	return read;
 }
 
 int ser_write_r(struct _reent* r, void* const arg, const uint8_t* buf, const size_t len) {
 	const ser_file_s_t file = *(ser_file_s_t*)arg;
 
-	if (!list_contains(guaranteed_delivery_streams, guaranteed_delivery_streams_size, file.stream_id) &&
-	    !set_contains(&enabled_streams_set, file.stream_id)) {
+	if (!stream_is_sent((ser_file_s_t*)arg)) {
 		// the stream isn't a guaranteed delivery or hasn't been enabled so just
 		// pretend like the data was shipped just fine
 		return len;
 	}
 
-	if (ser_driver_runtime_config &= E_COBS_ENABLED) {
-		// allocate stack space for the buffer to be cobs encoded
-		const size_t cobs_len = cobs_encode_measure(buf, len, file.stream_id);
-		uint8_t cobs_buf[cobs_len + 1];
-
-		// need to guarantee writes are in order
-		if (!mutex_take(write_mtx, (file.flags & E_NOBLK_WRITE) ? 0 : TIMEOUT_MAX)) {
-			r->_errno = EACCES;
-			return 0;
-		}
-		cobs_encode(cobs_buf, buf, len, file.stream_id);
-		cobs_buf[cobs_len] = 0;
-
-		bool ret = ser_output_write(cobs_buf, cobs_len + 1, file.flags & E_NOBLK_WRITE);
-		mutex_give(write_mtx);
-
-		if (!ret) {
-			r->_errno = EIO;
-			return 0;
-		}
-		return len;
-	} else {
-		// need to guarantee writes are in order
-		if (!mutex_take(write_mtx, TIMEOUT_MAX)) {
+	const void* parts[] = {buf};
+	const size_t lens[] = {len};
+	switch (write_frame(file.stream_id, parts, lens, 1, file.flags & E_NOBLK_WRITE)) {
+		case E_WRITE_BUSY:
 			r->_errno = EACCES;
 			return 0;
-		}
-
-		bool ret = ser_output_write(buf, len, file.flags & E_NOBLK_WRITE);
-
-		mutex_give(write_mtx);
-		if (!ret) {
+		case E_WRITE_FAILED:
 			r->_errno = EIO;
 			return 0;
-		}
-		return len;
+		default:
+			// rate limited data is dropped like data for disabled streams
+			return len;
 	}
 }
 
@@ -242,6 +423,16 @@ int ser_ctl(void* const arg, const uint32_t cmd, void* const extra_arg) {
 	}
 }
 
+int16_t ser_poll(void* const arg, const int16_t events) {
+	const ser_file_s_t file = *(ser_file_s_t*)arg;
+	// writes are queued for the daemon, so serial streams are always writable
+	int16_t ready = VFS_POLLOUT;
+	if (file.stream_id == STDIN_STREAM_ID && inp_buffer_available() > 0) {
+		ready |= VFS_POLLIN;
+	}
+	return events & ready;
+}
+
 /******************************************************************************/
 /**                           Driver description                             **/
 /******************************************************************************/
@@ -251,7 +442,8 @@ const struct fs_driver _ser_driver = {.close_r = ser_close_r,
                                       .lseek_r = ser_lseek_r,
                                       .read_r = ser_read_r,
                                       .write_r = ser_write_r,
-                                      .ctl = ser_ctl};
+                                      .ctl = ser_ctl,
+                                      .poll = ser_poll};
 
 const struct fs_driver* const ser_driver = &_ser_driver;
 
@@ -286,9 +478,9 @@ int ser_open_r(struct _reent* r, const char* path, int flags, int mode) {
 		return STDERR_FILENO;
 	}
 
-	ser_file_s_t* arg = kmalloc(sizeof(*arg));
-	memcpy(arg->stream, path, strlen(path));
-	return vfs_add_entry_r(r, ser_driver, arg);
+	ser_file_s_t arg = {.stream_id = 0, .flags = 0};
+	memcpy(arg.stream, path, strlen(path));
+	return vfs_add_entry_inline_r(r, ser_driver, &arg, sizeof(arg));
 }
 
 // control various components of the serial driver or a file
@@ -316,24 +508,259 @@ int32_t serctl(const uint32_t action, void* const extra_arg) {
 		case SERCTL_DISABLE_COBS:
 			ser_driver_runtime_config &= ~E_COBS_ENABLED;
 			return 0;
+		case SERCTL_ENABLE_CAPTURE:
+			rtos_suspend_all();
+			if (flush_task == NULL) {
+				flush_task = task_create_static(flush_task_fn, NULL, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_MIN,
+				                                "Serial Flush (PROS)", flush_task_stack, &flush_task_buffer);
+			}
+			capture_mode = true;
+			rtos_resume_all();
+			// anything queued before now goes out straight away too
+			task_notify(flush_task);
+			return 0;
+		case SERCTL_DISABLE_CAPTURE:
+			capture_mode = false;
+			return 0;
+		case SERCTL_GET_STREAM_STATS: {
+			ser_stream_stats_s_t* stats = (ser_stream_stats_s_t*)extra_arg;
+			if (stats == NULL) {
+				errno = EINVAL;
+				return PROS_ERR;
+			}
+			uint32_t stream_id = stats->stream_id;
+			stats->sent = stats->dropped = 0;
+			rtos_suspend_all();
+			for (size_t i = 0; i < MAX_STREAM_STATES; i++) {
+				if (stream_states[i].stats.stream_id == stream_id) {
+					*stats = stream_states[i].stats;
+					break;
+				}
+			}
+			rtos_resume_all();
+			return 0;
+		}
+		case SERCTL_CONFIGURE_STREAM: {
+			ser_stream_config_s_t* config = (ser_stream_config_s_t*)extra_arg;
+			if (config == NULL || config->stream_id == 0 || config->priority >= E_SER_PRIORITY_COUNT) {
+				errno = EINVAL;
+				return PROS_ERR;
+			}
+			rtos_suspend_all();
+			stream_state_s_t* state = get_stream_state(config->stream_id);
+			if (state != NULL) {
+				state->priority = config->priority;
+				state->rate = config->rate;
+				state->burst = config->burst;
+				state->tokens = config->burst;
+				state->last_refill = millis();
+			}
+			rtos_resume_all();
+			if (state == NULL) {
+				errno = ENOMEM;
+				return PROS_ERR;
+			}
+			return 0;
+		}
 		default:
 			errno = EINVAL;
 			return PROS_ERR;
 	}
 }
 
+/******************************************************************************/
+/**                            Serial telemetry                              **/
+/******************************************************************************/
+// The compression state of a record ID. Taken from the table and used with
+// tlm_mtx held, which also keeps the compressed records of an ID in order
+typedef struct tlm_compressor {
+	uint16_t id;  // 0 for a free entry
+	ser_tlm_compression_e_t mode;
+	uint16_t prev_len;   // The size of prev, 0 if the host has nothing to take a delta from
+	uint16_t since_key;  // Delta records sent since the last uncompressed one
+	uint8_t prev[SER_TLM_DELTA_MAX_SIZE];
+} tlm_compressor_s_t;
+
+static tlm_compressor_s_t tlm_compressors[SER_TLM_COMPRESS_MAX_RECORDS];
+static volatile uint32_t tlm_compressed_count;  // lets uncompressed writes skip the lock
+static static_sem_s_t tlm_mtx_buf;
+static mutex_t tlm_mtx;
+static uint8_t tlm_scratch[SER_TLM_LZ4_MAX_SIZE];
+static uint16_t tlm_lz4_table[1 << LZ4_HASH_BITS];
+
+static int32_t tlm_result(write_result_e_t result) {
+	switch (result) {
+		case E_WRITE_SENT:
+			return 1;
+		case E_WRITE_RATE_LIMITED:
+			return 0;
+		case E_WRITE_BUSY:
+			errno = EACCES;
+			return PROS_ERR;
+		default:
+			errno = EIO;
+			return PROS_ERR;
+	}
+}
+
+// Sends a frame on the telemetry stream made of the record ID followed by up to
+// 3 parts
+static int32_t ser_tlm_send(const uint16_t record_id, const void* const* parts, const size_t* lens,
+                            const size_t count) {
+	if (!set_contains(&enabled_streams_set, SER_TLM_STREAM_ID)) {
+		return 0;
+	}
+	const void* frame_parts[4] = {&record_id};
+	size_t frame_lens[4] = {sizeof(record_id)};
+	for (size_t i = 0; i < count; i++) {
+		frame_parts[i + 1] = parts[i];
+		frame_lens[i + 1] = lens[i];
+	}
+	return tlm_result(write_frame(SER_TLM_STREAM_ID, frame_parts, frame_lens, count + 1, false));
+}
+
+// Sends a record on the compressed telemetry stream. Called with tlm_mtx held
+static int32_t ser_tlm_send_compressed(tlm_compressor_s_t* c, const uint8_t* data, size_t size) {
+	if (!set_contains(&enabled_streams_set, SER_TLM_STREAM_ID)) {
+		// the host won't have seen this record to take the next delta from
+		c->prev_len = 0;
+		return 0;
+	}
+	uint8_t encoding = E_SER_TLM_COMPRESS_NONE;
+	const uint8_t* payload = data;
+	size_t len = size;
+	size_t packed = 0;
+	// Each encoder gives up once it's no shorter than the record
+	if (c->mode == E_SER_TLM_COMPRESS_DELTA) {
+		if (size > 1 && size == c->prev_len && c->since_key < SER_TLM_KEYFRAME_INTERVAL) {
+			packed = delta_encode(tlm_scratch, size - 1, data, c->prev, size);
+		}
+	} else if (size > 1 && size <= SER_TLM_LZ4_MAX_SIZE) {
+		packed = lz4_compress(tlm_scratch, size - 1, data, size, tlm_lz4_table);
+	}
+	if (packed) {
+		encoding = c->mode;
+		payload = tlm_scratch;
+		len = packed;
+	}
+	const uint8_t header[3] = {c->id & 0xff, c->id >> 8, encoding};
+	const void* parts[] = {header, payload};
+	const size_t lens[] = {sizeof(header), len};
+	write_result_e_t const result = write_frame(SER_TLM_Z_STREAM_ID, parts, lens, 2, false);
+	if (c->mode == E_SER_TLM_COMPRESS_DELTA) {
+		if (result == E_WRITE_SENT && size <= SER_TLM_DELTA_MAX_SIZE) {
+			memcpy(c->prev, data, size);
+			c->prev_len = size;
+			c->since_key = encoding == E_SER_TLM_COMPRESS_NONE ? 0 : c->since_key + 1;
+		} else {
+			c->prev_len = 0;
+		}
+	}
+	return tlm_result(result);
+}
+
+int32_t ser_tlm_describe(const ser_tlm_descriptor_s_t* const descriptor) {
+	if (descriptor == NULL || descriptor->id == SER_TLM_DESCRIPTOR_ID || descriptor->id == SER_TLM_CLOCK_ID) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	const uint16_t header[2] = {descriptor->id, descriptor->size};
+	// The name and format are sent back to back, including their null terminators
+	const void* parts[] = {header, descriptor->name, descriptor->format};
+	const size_t lens[] = {sizeof(header), strlen(descriptor->name) + 1, strlen(descriptor->format) + 1};
+	return ser_tlm_send(SER_TLM_DESCRIPTOR_ID, parts, lens, 3);
+}
+
+int32_t ser_tlm_write(const uint16_t record_id, const void* const data, const size_t size) {
+	if (data == NULL || record_id == SER_TLM_CLOCK_ID) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (tlm_compressed_count) {
+		mutex_take(tlm_mtx, TIMEOUT_MAX);
+		for (size_t i = 0; i < SER_TLM_COMPRESS_MAX_RECORDS; i++) {
+			if (tlm_compressors[i].id == record_id) {
+				int32_t const ret = ser_tlm_send_compressed(&tlm_compressors[i], data, size);
+				mutex_give(tlm_mtx);
+				return ret;
+			}
+		}
+		mutex_give(tlm_mtx);
+	}
+	return ser_tlm_send(record_id, &data, &size, 1);
+}
+
+int32_t ser_tlm_set_compression(const uint16_t record_id, const ser_tlm_compression_e_t mode) {
+	if (record_id == SER_TLM_DESCRIPTOR_ID || (uint32_t)mode > E_SER_TLM_COMPRESS_LZ4) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	mutex_take(tlm_mtx, TIMEOUT_MAX);
+	tlm_compressor_s_t* entry = NULL;
+	for (size_t i = 0; i < SER_TLM_COMPRESS_MAX_RECORDS && entry == NULL; i++) {
+		if (tlm_compressors[i].id == record_id) entry = &tlm_compressors[i];
+	}
+	if (entry == NULL && mode != E_SER_TLM_COMPRESS_NONE) {
+		for (size_t i = 0; i < SER_TLM_COMPRESS_MAX_RECORDS && entry == NULL; i++) {
+			if (tlm_compressors[i].id == SER_TLM_DESCRIPTOR_ID) entry = &tlm_compressors[i];
+		}
+		if (entry == NULL) {
+			mutex_give(tlm_mtx);
+			errno = ENOMEM;
+			return PROS_ERR;
+		}
+		entry->id = record_id;
+		tlm_compressed_count++;
+	}
+	if (entry != NULL) {
+		if (mode == E_SER_TLM_COMPRESS_NONE) {
+			entry->id = SER_TLM_DESCRIPTOR_ID;
+			tlm_compressed_count--;
+		}
+		entry->mode = mode;
+		entry->prev_len = 0;
+		entry->since_key = 0;
+	}
+	mutex_give(tlm_mtx);
+	return 1;
+}
+
+size_t ser_buffer_alloc(uint32_t size, size_t default_size, uint8_t** buffer) {
+	// one byte over, like the static queues above
+	*buffer = size ? kmalloc(size + 1) : NULL;
+	if (*buffer == NULL) {
+		size = default_size;
+		*buffer = kmalloc(size + 1);
+		kassert(*buffer != NULL);
+	}
+	return size;
+}
+
 // called by ser_initialize() in ser_daemon.c
 // vfs_initialize() calls ser_initialize()
 void ser_driver_initialize(void) {
 	ser_driver_runtime_config |= E_COBS_ENABLED;  // start with cobs enabled
 
 	read_mtx = mutex_create_static(&read_mtx_buf);
-	write_mtx = mutex_create_static(&write_mtx_buf);
+	tlm_mtx = mutex_create_static(&tlm_mtx_buf);
 
 	set_initialize(&enabled_streams_set);
 	set_add(&enabled_streams_set, STDOUT_STREAM_ID);  // 'sout' little endian
-
-	write_stream = stream_buf_create_static(VEX_SERIAL_BUFFER_SIZE, 0, write_buf, &write_stream_buf);
+	set_add(&enabled_streams_set, PLOG_STREAM_ID);
+
+	// The normal priority queue carries sout and most other streams, so it's the one a program may resize
+	const ser_buffer_sizes_s_t* const sizes = boot_get_ser_buffer_sizes();
+	uint8_t* normal_priority_buf;
+	size_t const normal_size = ser_buffer_alloc(sizes ? sizes->output : 0, VEX_SERIAL_BUFFER_SIZE, &normal_priority_buf);
+	uint8_t* const queue_bufs[E_SER_PRIORITY_COUNT] = {high_priority_buf, normal_priority_buf, low_priority_buf};
+	const size_t queue_sizes[E_SER_PRIORITY_COUNT] = {sizeof(high_priority_buf) - 1, normal_size,
+	                                                  sizeof(low_priority_buf) - 1};
+	for (int i = 0; i < E_SER_PRIORITY_COUNT; i++) {
+		output_queue_s_t* queue = &output_queues[i];
+		// writers are serialized by the queue's mutex and only the daemon reads
+		queue->stream = stream_buf_create_spsc_static(queue_sizes[i], queue_bufs[i], &queue->stream_buf);
+		queue->mtx = mutex_create_static(&queue->mtx_buf);
+	}
 
 	vfs_update_entry(STDIN_FILENO, ser_driver, &(RESERVED_SER_FILES[0]));
 	vfs_update_entry(STDOUT_FILENO, ser_driver, &(RESERVED_SER_FILES[1]));
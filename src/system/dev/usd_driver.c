@@ -25,10 +25,51 @@
 #include "system/optimizers.h"
 #include "v5_api.h"
 
+#define USD_WRITE_BUFFER_SIZE KERNEL_USD_WRITE_BUFFER_SIZE
+// Data is written to the card in multiples of the sector size
+#define USD_WRITE_CHUNK_SIZE 512
+// Buffered data which doesn't fill a chunk is written after this long (ms)
+#define USD_FLUSH_INTERVAL 100
+#define USD_MAX_FILES 8  // VEXos doesn't allow more than 8 open files
+#define USD_READ_BUFFER_SIZE KERNEL_USD_READ_BUFFER_SIZE
+// usd_load_file reads files in chunks of this size
+#define USD_LOAD_CHUNK_SIZE 0x8000
+
 typedef struct usd_file_arg {
 	FIL* ifi_fptr;
+	// Write-behind buffer, NULL for files opened for reading. Producers append
+	// to the free space under lock while the writer task writes out the data
+	// starting at tail, so appending never waits on the card
+	uint8_t* buf;
+	size_t tail;
+	size_t count;
+	size_t offset;  // bytes written to the card, used to keep writes aligned
+	uint32_t last_write;
+	bool error;  // a write to the card failed since the last write call
+	// Read-ahead buffer, NULL for files opened for writing. Reads are only
+	// serialized by newlib's FILE lock, like before
+	uint8_t* rbuf;
+	size_t rpos;
+	size_t rlen;
+	mutex_t lock;
+	static_sem_s_t lock_buf;
+	bool in_use;
 } usd_file_arg_t;
 
+// Serializes every call into the VEXos file system. Also protects usd_files
+// and usd_mounted
+static static_sem_s_t usd_io_mtx_buf;
+static mutex_t usd_io_mtx;
+
+// Every open file's state, since VEXos won't open more than this many anyway
+static usd_file_arg_t usd_files[USD_MAX_FILES];
+// Whether the card has been mounted since it was last found missing
+static bool usd_mounted;
+
+static task_stack_t usd_writer_stack[TASK_STACK_DEPTH_MIN];
+static static_task_s_t usd_writer_task_buffer;
+static task_t usd_writer_task;
+
 static const int FRESULTMAP[] = {0,       EIO,    EINVAL, EBUSY, ENOENT,  ENOENT, EINVAL, EACCES,  // FR_DENIED
                                  EEXIST,  EINVAL, EROFS,  ENXIO, ENOBUFS, ENXIO,  EIO,    EACCES,  // FR_LOCKED
                                  ENOBUFS, ENFILE, EINVAL};
@@ -40,32 +81,195 @@ enum fa_flags {
 	FA_CREATE_NEW = 1 << 4
 };
 
+/******************************************************************************/
+/**                            Write-behind cache                            **/
+/******************************************************************************/
+// Writes buffered data to the card. Unless force is set, only whole aligned
+// chunks are written. Must be called with usd_io_mtx held. Returns the number
+// of bytes written
+static size_t usd_flush(usd_file_arg_t* file, bool force) {
+	size_t flushed = 0;
+	while (1) {
+		mutex_take(file->lock, TIMEOUT_MAX);
+		size_t len = file->count;
+		if (len > USD_WRITE_BUFFER_SIZE - file->tail) len = USD_WRITE_BUFFER_SIZE - file->tail;
+		mutex_give(file->lock);
+		if (!force) {
+			// end the write on a chunk boundary
+			size_t end = (file->offset + len) / USD_WRITE_CHUNK_SIZE * USD_WRITE_CHUNK_SIZE;
+			len = end > file->offset ? end - file->offset : 0;
+		}
+		if (len == 0) return flushed;
+
+		// the region being written is only touched by us, so the lock isn't held
+		int32_t written = vexFileWrite((char*)file->buf + file->tail, 1, len, file->ifi_fptr);
+		if (written != (int32_t)len) file->error = true;
+
+		mutex_take(file->lock, TIMEOUT_MAX);
+		file->tail = (file->tail + len) % USD_WRITE_BUFFER_SIZE;
+		file->count -= len;
+		mutex_give(file->lock);
+		file->offset += len;
+		flushed += len;
+	}
+}
+
+static void usd_sync(usd_file_arg_t* file) {
+	if (file->buf == NULL) return;
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	usd_flush(file, true);
+	mutex_give(usd_io_mtx);
+}
+
+static void usd_writer_task_fn(void* ign) {
+	while (1) {
+		task_notify_take(true, USD_FLUSH_INTERVAL);
+		mutex_take(usd_io_mtx, TIMEOUT_MAX);
+		uint32_t now = millis();
+		size_t flushed = 0;
+		for (size_t i = 0; i < USD_MAX_FILES; i++) {
+			if (usd_files[i].in_use && usd_files[i].buf != NULL) {
+				flushed += usd_flush(&usd_files[i], now - usd_files[i].last_write >= USD_FLUSH_INTERVAL);
+			}
+		}
+		usd_log_flush();
+		mutex_give(usd_io_mtx);
+		// files which were full are writable again
+		if (flushed > 0) vfs_poll_notify();
+	}
+}
+
+void usd_io_lock(void) {
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+}
+
+void usd_io_unlock(void) {
+	mutex_give(usd_io_mtx);
+}
+
+bool usd_io_is_locked(void) {
+	return mutex_get_owner(usd_io_mtx) != NULL;
+}
+
+void usd_writer_notify(void) {
+	task_notify(usd_writer_task);
+}
+
+int usd_fresult_errno(FRESULT result) {
+	return (uint32_t)result < sizeof(FRESULTMAP) / sizeof(FRESULTMAP[0]) ? FRESULTMAP[result] : EIO;
+}
+
+FRESULT usd_mount(void) {
+	// Taking the card out unmounts it, so it has to be mounted again once it's back
+	if (!vexFileDriveStatus(0)) {
+		usd_mounted = false;
+		return FR_NOT_READY;
+	}
+	if (likely(usd_mounted)) return FR_OK;
+	FRESULT const result = vexFileMountSD();
+	usd_mounted = result == FR_OK;
+	return result;
+}
+
+void usd_initialize(void) {
+	usd_io_mtx = mutex_create_static(&usd_io_mtx_buf);
+	usd_writer_task = task_create_static(usd_writer_task_fn, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_MIN,
+	                                     "uSD Writer (PROS)", usd_writer_stack, &usd_writer_task_buffer);
+}
+
 /******************************************************************************/
 /**                         newlib driver functions                          **/
 /******************************************************************************/
 int usd_read_r(struct _reent* r, void* const arg, uint8_t* buffer, const size_t len) {
 	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
-	// TODO: mutex here. Global or file lock?
-	int32_t result = vexFileRead((char*)buffer, sizeof(*buffer), len, file_arg->ifi_fptr);
-	return result;
+	if (file_arg->rbuf == NULL) {
+		// the file was opened for writing
+		r->_errno = EBADF;
+		return -1;
+	}
+	size_t read = 0;
+	while (read < len) {
+		if (file_arg->rpos < file_arg->rlen) {
+			size_t n = file_arg->rlen - file_arg->rpos;
+			if (n > len - read) n = len - read;
+			memcpy(buffer + read, file_arg->rbuf + file_arg->rpos, n);
+			file_arg->rpos += n;
+			read += n;
+			continue;
+		}
+		mutex_take(usd_io_mtx, TIMEOUT_MAX);
+		int32_t result;
+		if (len - read >= USD_READ_BUFFER_SIZE) {
+			// large reads skip the buffer
+			result = vexFileRead((char*)buffer + read, 1, len - read, file_arg->ifi_fptr);
+			if (result > 0) read += result;
+		} else {
+			result = vexFileRead((char*)file_arg->rbuf, 1, USD_READ_BUFFER_SIZE, file_arg->ifi_fptr);
+			file_arg->rpos = 0;
+			file_arg->rlen = result > 0 ? result : 0;
+		}
+		mutex_give(usd_io_mtx);
+		if (result <= 0) break;
+	}
+	return read;
 }
 
 int usd_write_r(struct _reent* r, void* const arg, const uint8_t* buf, const size_t len) {
 	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
-	// TODO: mutex here. Global or file lock?
-	int32_t result = vexFileWrite((char*)buf, sizeof(*buf), len, file_arg->ifi_fptr);
-	return result;
+	if (file_arg->buf == NULL) {
+		// the file was opened for reading
+		r->_errno = EBADF;
+		return -1;
+	}
+	if (file_arg->error) {
+		file_arg->error = false;
+		r->_errno = EIO;
+		return -1;
+	}
+	size_t written = 0;
+	while (written < len) {
+		mutex_take(file_arg->lock, TIMEOUT_MAX);
+		size_t head = (file_arg->tail + file_arg->count) % USD_WRITE_BUFFER_SIZE;
+		size_t n = USD_WRITE_BUFFER_SIZE - file_arg->count;
+		if (n > USD_WRITE_BUFFER_SIZE - head) n = USD_WRITE_BUFFER_SIZE - head;
+		if (n > len - written) n = len - written;
+		memcpy(file_arg->buf + head, buf + written, n);
+		file_arg->count += n;
+		file_arg->last_write = millis();
+		size_t count = file_arg->count;
+		mutex_give(file_arg->lock);
+		written += n;
+
+		if (count >= USD_WRITE_BUFFER_SIZE) {
+			// the card can't keep up, so there's no choice but to wait for it
+			usd_sync(file_arg);
+		} else if (count >= USD_WRITE_CHUNK_SIZE) {
+			task_notify(usd_writer_task);
+		}
+	}
+	return written;
 }
 
 int usd_close_r(struct _reent* r, void* const arg) {
 	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	if (file_arg->buf != NULL) usd_flush(file_arg, true);
 	vexFileClose(file_arg->ifi_fptr);
+	// mutexes are semaphores, and there is no mutex_delete()
+	sem_delete(file_arg->lock);
+	kfree(file_arg->buf);
+	kfree(file_arg->rbuf);
+	// Only now can the writer task no longer see the file
+	file_arg->in_use = false;
+	mutex_give(usd_io_mtx);
 	return 0;
 }
 
 int usd_fstat_r(struct _reent* r, void* const arg, struct stat* st) {
 	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
-	st->st_size = vexFileSize(file_arg->ifi_fptr);
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	st->st_size = vexFileSize(file_arg->ifi_fptr) + file_arg->count;
+	mutex_give(usd_io_mtx);
 	return 0;
 }
 
@@ -75,17 +279,51 @@ int usd_isatty_r(struct _reent* r, void* const arg) {
 
 off_t usd_lseek_r(struct _reent* r, void* const arg, off_t ptr, int dir) {
 	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
-	// TODO: mutex here. Global or file lock?
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	if (file_arg->buf != NULL) {
+		// buffered data belongs at the current position
+		usd_flush(file_arg, true);
+	}
+	if (dir == SEEK_CUR) {
+		// the card's position is past whatever is left in the read-ahead buffer
+		ptr -= file_arg->rlen - file_arg->rpos;
+	}
+	file_arg->rpos = file_arg->rlen = 0;
 	FRESULT result = vexFileSeek(file_arg->ifi_fptr, ptr, dir);
+	off_t pos = vexFileTell(file_arg->ifi_fptr);
+	file_arg->offset = pos;
+	mutex_give(usd_io_mtx);
 	if (result != FR_OK) {
 		r->_errno = FRESULTMAP[result];
 		return (off_t)-1;
 	}
-	return vexFileTell(file_arg->ifi_fptr);
+	return pos;
 }
 
 int usd_ctl(void* const arg, const uint32_t cmd, void* const extra_arg) {
-	return 0;
+	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
+	switch (cmd) {
+		case USDCTL_SYNC:
+			usd_sync(file_arg);
+			if (file_arg->error) {
+				file_arg->error = false;
+				errno = EIO;
+				return PROS_ERR;
+			}
+			return 0;
+		default:
+			errno = EINVAL;
+			return PROS_ERR;
+	}
+}
+
+int16_t usd_poll(void* const arg, const int16_t events) {
+	usd_file_arg_t* file_arg = (usd_file_arg_t*)arg;
+	// files being read never wait on the card for long, like regular files
+	// everywhere else
+	int16_t ready = file_arg->buf == NULL ? VFS_POLLIN : 0;
+	if (file_arg->buf != NULL && file_arg->count < USD_WRITE_BUFFER_SIZE) ready |= VFS_POLLOUT;
+	return events & ready;
 }
 
 /******************************************************************************/
@@ -98,37 +336,111 @@ const struct fs_driver _usd_driver = {.close_r = usd_close_r,
                                       .lseek_r = usd_lseek_r,
                                       .read_r = usd_read_r,
                                       .write_r = usd_write_r,
-                                      .ctl = usd_ctl};
+                                      .ctl = usd_ctl,
+                                      .poll = usd_poll};
 const struct fs_driver* const usd_driver = &_usd_driver;
 
 int usd_open_r(struct _reent* r, const char* path, int flags, int mode) {
-	FRESULT result = vexFileMountSD();
-	if (result != F_OK) {
-		r->_errno = FRESULTMAP[result];
+	int const access = flags & O_ACCMODE;
+	if (access != O_RDONLY && access != O_WRONLY) {
+		r->_errno = EINVAL;
+		return -1;
+	}
+	// The buffer is allocated before taking the lock, so a slow allocation doesn't hold up the card
+	uint8_t* const buffer = kmalloc(access == O_RDONLY ? USD_READ_BUFFER_SIZE : USD_WRITE_BUFFER_SIZE);
+	if (buffer == NULL) {
+		r->_errno = ENOMEM;
 		return -1;
 	}
 
-	usd_file_arg_t* file_arg = kmalloc(sizeof(*file_arg));
-
-	switch (flags & O_ACCMODE) {
-		case O_RDONLY:
-			file_arg->ifi_fptr = vexFileOpen(path, "");  // mode is ignored
-			break;
-		case O_WRONLY:
-			if (flags & O_APPEND) {
-				file_arg->ifi_fptr = vexFileOpenWrite(path);
-			} else {
-				file_arg->ifi_fptr = vexFileOpenCreate(path);
-			}
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	FRESULT result = usd_mount();
+	if (result != FR_OK) {
+		mutex_give(usd_io_mtx);
+		kfree(buffer);
+		r->_errno = FRESULTMAP[result];
+		return -1;
+	}
+	usd_file_arg_t* file_arg = NULL;
+	for (size_t i = 0; i < USD_MAX_FILES; i++) {
+		if (!usd_files[i].in_use) {
+			file_arg = &usd_files[i];
 			break;
-		default:
-			r->_errno = EINVAL;
-			return -1;
+		}
 	}
-
-	if (!file_arg->ifi_fptr) {
+	FIL* fptr = NULL;
+	if (file_arg != NULL) {
+		if (access == O_RDONLY) {
+			fptr = vexFileOpen(path, "");  // mode is ignored
+		} else if (flags & O_APPEND) {
+			fptr = vexFileOpenWrite(path);
+		} else {
+			fptr = vexFileOpenCreate(path);
+		}
+	}
+	if (fptr == NULL) {
+		mutex_give(usd_io_mtx);
+		kfree(buffer);
 		r->_errno = ENFILE;  // up to 8 files max as of vexOS 0.7.4b55
 		return -1;
 	}
-	return vfs_add_entry_r(r, usd_driver, file_arg);
+
+	memset(file_arg, 0, sizeof(*file_arg));
+	file_arg->ifi_fptr = fptr;
+	file_arg->lock = mutex_create_static(&file_arg->lock_buf);
+	if (access == O_RDONLY) {
+		file_arg->rbuf = buffer;
+	} else {
+		file_arg->buf = buffer;
+		if (flags & O_APPEND) file_arg->offset = vexFileSize(fptr);
+	}
+	file_arg->in_use = true;
+	mutex_give(usd_io_mtx);
+	int const fd = vfs_add_entry_r(r, usd_driver, file_arg);
+	if (fd < 0) usd_close_r(r, file_arg);
+	return fd;
+}
+
+const void* usd_load_file(const char* path, size_t* const size) {
+	if (path == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+	if (strstr(path, "/usd") == path) {
+		path += strlen("/usd");
+	}
+	uint8_t* data = NULL;
+	mutex_take(usd_io_mtx, TIMEOUT_MAX);
+	FIL* fptr = usd_mount() == FR_OK ? vexFileOpen(path, "") : NULL;
+	if (fptr == NULL) {
+		errno = ENOENT;
+		goto leave;
+	}
+	int32_t len = vexFileSize(fptr);
+	data = kmalloc(len > 0 ? len : 1);
+	if (data == NULL) {
+		errno = ENOMEM;
+		goto close;
+	}
+	for (int32_t read = 0; read < len;) {
+		int32_t chunk = len - read < USD_LOAD_CHUNK_SIZE ? len - read : USD_LOAD_CHUNK_SIZE;
+		int32_t result = vexFileRead((char*)data + read, 1, chunk, fptr);
+		if (result <= 0) {
+			kfree(data);
+			data = NULL;
+			errno = EIO;
+			goto close;
+		}
+		read += result;
+	}
+	if (size != NULL) *size = len;
+close:
+	vexFileClose(fptr);
+leave:
+	mutex_give(usd_io_mtx);
+	return data;
+}
+
+void usd_unload_file(const void* data) {
+	kfree((void*)data);
 }
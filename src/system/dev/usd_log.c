@@ -0,0 +1,189 @@
+/**
+ * \file system/dev/usd_log.c
+ *
+ * Binary logging to the microSD card
+ *
+ * Records are copied into one of two preallocated buffers. When the active
+ * buffer fills up, logging switches to the other one and the uSD writer task
+ * writes the full buffer to the card in a single vexFileWrite, so logging a
+ * record never waits on the card.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "kapi.h"
+#include "system/dev/usd.h"
+#include "system/optimizers.h"
+#include "v5_api.h"
+
+#define USD_LOG_BUFFER_SIZE 0x4000
+#define USD_LOG_MAX_OPEN 4
+#define USD_LOG_MAGIC 0x474f4c50  // 'PLOG' little endian
+#define USD_LOG_VERSION 1
+
+typedef struct __attribute__((packed)) usd_log_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;   // size of a record, including its timestamp
+	uint32_t start_millis;  // millis() when the log was opened
+	uint64_t start_micros;  // microsecond timestamp when the log was opened
+	// followed by the null-terminated name and format of the records
+} usd_log_header_s_t;
+
+struct usd_log {
+	FIL* fptr;
+	size_t record_size;  // including the timestamp
+	uint8_t* bufs[2];
+	uint8_t active;
+	size_t fill;  // bytes in the active buffer
+	// bytes of each buffer waiting for the writer task, 0 if the buffer is free.
+	// Only one buffer can be waiting at once since logging only switches to a
+	// free buffer
+	volatile size_t pending[2];
+	uint32_t dropped;
+	mutex_t lock;  // protects the active buffer from concurrent writers
+	static_sem_s_t lock_buf;
+};
+
+// Protected by the uSD I/O lock
+static usd_log_t open_logs[USD_LOG_MAX_OPEN];
+
+// Must be called with the uSD I/O lock held
+static void usd_log_write_pending(usd_log_t log) {
+	for (size_t i = 0; i < 2; i++) {
+		if (log->pending[i]) {
+			vexFileWrite((char*)log->bufs[i], 1, log->pending[i], log->fptr);
+			compiler_barrier();
+			log->pending[i] = 0;
+		}
+	}
+}
+
+void usd_log_flush(void) {
+	for (size_t i = 0; i < USD_LOG_MAX_OPEN; i++) {
+		if (open_logs[i] != NULL) {
+			usd_log_write_pending(open_logs[i]);
+		}
+	}
+}
+
+usd_log_t usd_log_open(const char* path, const usd_log_schema_s_t* const schema) {
+	if (path == NULL || schema == NULL || schema->name == NULL || schema->format == NULL || !schema->record_size ||
+	    schema->record_size + sizeof(uint32_t) > USD_LOG_BUFFER_SIZE) {
+		errno = EINVAL;
+		return NULL;
+	}
+	if (strstr(path, "/usd") == path) {
+		path += strlen("/usd");
+	}
+
+	usd_log_t log = kmalloc(sizeof(*log));
+	uint8_t* bufs = kmalloc(2 * USD_LOG_BUFFER_SIZE);
+	if (log == NULL || bufs == NULL) {
+		kfree(log);
+		kfree(bufs);
+		errno = ENOMEM;
+		return NULL;
+	}
+	memset(log, 0, sizeof(*log));
+	log->record_size = schema->record_size + sizeof(uint32_t);
+	log->bufs[0] = bufs;
+	log->bufs[1] = bufs + USD_LOG_BUFFER_SIZE;
+
+	usd_io_lock();
+	size_t slot;
+	for (slot = 0; slot < USD_LOG_MAX_OPEN && open_logs[slot] != NULL; slot++)
+		;
+	if (slot == USD_LOG_MAX_OPEN) {
+		errno = ENFILE;
+		goto fail;
+	}
+	if (usd_mount() != FR_OK || (log->fptr = vexFileOpenCreate(path)) == NULL) {
+		errno = EIO;
+		goto fail;
+	}
+
+	const usd_log_header_s_t header = {.magic = USD_LOG_MAGIC,
+	                                   .version = USD_LOG_VERSION,
+	                                   .record_size = log->record_size,
+	                                   .start_millis = millis(),
+	                                   .start_micros = vexSystemHighResTimeGet()};
+	vexFileWrite((char*)&header, 1, sizeof(header), log->fptr);
+	vexFileWrite((char*)schema->name, 1, strlen(schema->name) + 1, log->fptr);
+	vexFileWrite((char*)schema->format, 1, strlen(schema->format) + 1, log->fptr);
+
+	log->lock = mutex_create_static(&log->lock_buf);
+	open_logs[slot] = log;
+	usd_io_unlock();
+	return log;
+
+fail:
+	usd_io_unlock();
+	kfree(bufs);
+	kfree(log);
+	return NULL;
+}
+
+int32_t usd_log_write(usd_log_t log, const void* const record) {
+	if (log == NULL || record == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	mutex_take(log->lock, TIMEOUT_MAX);
+	if (log->fill + log->record_size > USD_LOG_BUFFER_SIZE) {
+		const uint8_t other = !log->active;
+		if (log->pending[other]) {
+			// the card hasn't caught up yet
+			log->dropped++;
+			mutex_give(log->lock);
+			return 0;
+		}
+		log->pending[log->active] = log->fill;
+		log->active = other;
+		log->fill = 0;
+		usd_writer_notify();
+	}
+	uint8_t* dest = log->bufs[log->active] + log->fill;
+	const uint32_t timestamp = vexSystemHighResTimeGet();
+	memcpy(dest, &timestamp, sizeof(timestamp));
+	memcpy(dest + sizeof(timestamp), record, log->record_size - sizeof(timestamp));
+	log->fill += log->record_size;
+	mutex_give(log->lock);
+	return 1;
+}
+
+uint32_t usd_log_get_dropped(usd_log_t log) {
+	if (log == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return log->dropped;
+}
+
+int32_t usd_log_close(usd_log_t log) {
+	if (log == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	mutex_take(log->lock, TIMEOUT_MAX);
+	usd_io_lock();
+	usd_log_write_pending(log);
+	vexFileWrite((char*)log->bufs[log->active], 1, log->fill, log->fptr);
+	vexFileClose(log->fptr);
+	for (size_t i = 0; i < USD_LOG_MAX_OPEN; i++) {
+		if (open_logs[i] == log) open_logs[i] = NULL;
+	}
+	usd_io_unlock();
+	mutex_give(log->lock);
+	sem_delete(log->lock);  // like usd_close_r(), a mutex is a semaphore
+	kfree(log->bufs[0]);
+	kfree(log);
+	return 1;
+}
@@ -23,6 +23,7 @@
 
 #include <errno.h>
 #include <stdint.h>
+#include <string.h>
 #include <unistd.h>
 
 #include "common/gid.h"
@@ -35,7 +36,7 @@
 #include "v5_api.h"
 
 #define MAX_FILELEN 128
-#define MAX_FILES_OPEN 31
+#define MAX_FILES_OPEN VFS_MAX_FILES_OPEN
 
 #define RESERVED_FILENOS 4  // reserve stdin, stdout, stderr, kdbg
 
@@ -50,10 +51,36 @@ static struct gid_metadata file_table_gids = {.bitmap = file_table_bmp,
 // file table mapping a file descriptor number to a driver and driver argument
 static struct file_entry file_table[MAX_FILES_OPEN];
 
+// Opening a path is dispatched on its first 4 characters
+#define MOUNT_PREFIX_LENGTH 4
+static const struct mount {
+	char prefix[MOUNT_PREFIX_LENGTH + 1];
+	int (*open_r)(struct _reent*, const char*, int, int);
+} mounts[] = {
+    {"/ser", ser_open_r},  // serial pseudofiles
+    {"/usd", usd_open_r},
+    {"/dev", dev_open_r},
+};
+#define mounts_size (sizeof(mounts) / sizeof(*mounts))
+
+// Tasks blocked in vfs_poll, protected by suspending the scheduler
+#define MAX_POLL_WAITERS 8
+static task_t poll_waiters[MAX_POLL_WAITERS];
+
+// Gets the file table entry of an open file, or NULL if the file isn't open.
+// Entries of closed files have no driver, so this is a single lookup
+static inline struct file_entry* get_entry(int file) {
+	if ((unsigned)file >= MAX_FILES_OPEN || file_table[file].driver == NULL) {
+		return NULL;
+	}
+	return &file_table[file];
+}
+
 void vfs_initialize(void) {
 	gid_init(&file_table_gids);
 
 	ser_initialize();
+	usd_initialize();
 
 	// Force _GLOBAL_REENT initialization for C++ stdio to work. See D97
 	extern void __sinit(struct _reent * s);
@@ -68,8 +95,26 @@ int vfs_add_entry_r(struct _reent* r, struct fs_driver const* const driver, void
 		return -1;
 	}
 
-	file_table[gid].driver = driver;
 	file_table[gid].arg = arg;
+	file_table[gid].driver = driver;
+	return gid;
+}
+
+int vfs_add_entry_inline_r(struct _reent* r, struct fs_driver const* const driver, const void* arg, size_t size) {
+	if (size > VFS_INLINE_ARG_SIZE) {
+		r->_errno = EINVAL;
+		return -1;
+	}
+	uint32_t gid = gid_alloc(&file_table_gids);
+	if (gid == 0) {
+		r->_errno = ENFILE;
+		return -1;
+	}
+
+	memset(file_table[gid].inline_arg, 0, VFS_INLINE_ARG_SIZE);
+	memcpy(file_table[gid].inline_arg, arg, size);
+	file_table[gid].arg = file_table[gid].inline_arg;
+	file_table[gid].driver = driver;
 	return gid;
 }
 
@@ -77,7 +122,7 @@ int vfs_add_entry_r(struct _reent* r, struct fs_driver const* const driver, void
 // initialize stdout, stdin, stderr, and kdbg
 int vfs_update_entry(int file, struct fs_driver const* const driver, void* arg) {
 	if (file < 0 || !gid_check(&file_table_gids, file)) {
-		kprintf("BAD vfs update %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD vfs update %d", file);
 		return -1;
 	}
 	if (driver != NULL) {
@@ -102,13 +147,12 @@ int _open(const char* file, int flags, int mode) {
 		r->_errno = ENAMETOOLONG;
 		return -1;
 	}
-	if (strstr(file, "/ser") == file) {
-		// is a serial pseudofile
-		return ser_open_r(r, file + strlen("/ser"), flags, mode);
-	} else if (strstr(file, "/usd") == file) {
-		return usd_open_r(r, file + strlen("/usd"), flags, mode);
-	} else if (strstr(file, "/dev") == file) {
-		return dev_open_r(r, file + strlen("/dev"), flags, mode);
+	if (i >= MOUNT_PREFIX_LENGTH) {
+		for (size_t m = 0; m < mounts_size; m++) {
+			if (!memcmp(file, mounts[m].prefix, MOUNT_PREFIX_LENGTH)) {
+				return mounts[m].open_r(r, file + MOUNT_PREFIX_LENGTH, flags, mode);
+			}
+		}
 	}
 
 	r->_errno = ENOENT;
@@ -117,22 +161,24 @@ int _open(const char* file, int flags, int mode) {
 
 ssize_t _write(int file, const void* buf, size_t len) {
 	struct _reent* r = _REENT;
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD write %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD write %d", file);
 		return -1;
 	}
-	return file_table[file].driver->write_r(r, file_table[file].arg, buf, len);
+	return entry->driver->write_r(r, entry->arg, buf, len);
 }
 
 ssize_t _read(int file, void* buf, size_t len) {
 	struct _reent* r = _REENT;
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD read %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD read %d", file);
 		return -1;
 	}
-	return file_table[file].driver->read_r(r, file_table[file].arg, buf, len);
+	return entry->driver->read_r(r, entry->arg, buf, len);
 }
 
 int _close(int file) {
@@ -143,13 +189,15 @@ int _close(int file) {
 		// Do not close the reserved file handles
 		return 0;
 	}
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD close %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD close %d", file);
 		return -1;
 	}
-	int ret = file_table[file].driver->close_r(r, file_table[file].arg);
+	int ret = entry->driver->close_r(r, entry->arg);
 	if (ret == 0) {
+		entry->driver = NULL;
 		gid_free(&file_table_gids, file);
 	}
 	return ret;
@@ -157,38 +205,104 @@ int _close(int file) {
 
 int _fstat(int file, struct stat* st) {
 	struct _reent* r = _REENT;
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD fstat %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD fstat %d", file);
 		return -1;
 	}
-	return file_table[file].driver->fstat_r(r, file_table[file].arg, st);
+	return entry->driver->fstat_r(r, entry->arg, st);
 }
 
 off_t _lseek(int file, off_t ptr, int dir) {
 	struct _reent* r = _REENT;
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD lseek %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD lseek %d", file);
 		return -1;
 	}
-	return file_table[file].driver->lseek_r(r, file_table[file].arg, ptr, dir);
+	return entry->driver->lseek_r(r, entry->arg, ptr, dir);
 }
 
 int _isatty(int file) {
 	struct _reent* r = _REENT;
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		r->_errno = EBADF;
-		kprintf("BAD isatty %d", file);
+		klog(E_KLOG_VFS, E_KLOG_ERROR, "BAD isatty %d", file);
 		return -1;
 	}
-	return file_table[file].driver->isatty_r(r, file_table[file].arg);
+	return entry->driver->isatty_r(r, entry->arg);
 }
 
 int32_t fdctl(int file, const uint32_t action, void* const extra_arg) {
-	if (file < 0 || !gid_check(&file_table_gids, file)) {
+	struct file_entry* entry = get_entry(file);
+	if (entry == NULL) {
 		errno = EBADF;
 		return -1;
 	}
-	return file_table[file].driver->ctl(file_table[file].arg, action, extra_arg);
+	return entry->driver->ctl(entry->arg, action, extra_arg);
+}
+
+void vfs_poll_notify(void) {
+	rtos_suspend_all();
+	for (size_t i = 0; i < MAX_POLL_WAITERS; i++) {
+		if (poll_waiters[i] != NULL) task_notify(poll_waiters[i]);
+	}
+	rtos_resume_all();
+}
+
+static bool poll_waiter_set(task_t from, task_t to) {
+	bool found = false;
+	rtos_suspend_all();
+	for (size_t i = 0; i < MAX_POLL_WAITERS; i++) {
+		if (poll_waiters[i] == from) {
+			poll_waiters[i] = to;
+			found = true;
+			break;
+		}
+	}
+	rtos_resume_all();
+	return found;
+}
+
+int32_t vfs_poll(vfs_pollfd_s_t* fds, size_t count, uint32_t timeout) {
+	if (fds == NULL && count > 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	task_t self = task_get_current();
+	// Registering before the first check means a driver becoming ready at any
+	// point after it leaves a notification pending
+	if (!poll_waiter_set(NULL, self)) {
+		errno = EBUSY;
+		return PROS_ERR;
+	}
+	uint32_t start = millis();
+	int32_t ready;
+	while (1) {
+		ready = 0;
+		for (size_t i = 0; i < count; i++) {
+			struct file_entry* entry = get_entry(fds[i].fd);
+			if (entry == NULL) {
+				fds[i].revents = VFS_POLLNVAL;
+			} else if (entry->driver->poll != NULL) {
+				fds[i].revents = entry->driver->poll(entry->arg, fds[i].events);
+			} else {
+				fds[i].revents = fds[i].events & (VFS_POLLIN | VFS_POLLOUT);
+			}
+			if (fds[i].revents) ready++;
+		}
+		if (ready > 0 || timeout == 0) break;
+		uint32_t wait = TIMEOUT_MAX;
+		if (timeout != TIMEOUT_MAX) {
+			uint32_t elapsed = millis() - start;
+			if (elapsed >= timeout) break;
+			wait = timeout - elapsed;
+		}
+		task_notify_take(true, wait);
+	}
+	poll_waiter_set(self, NULL);
+	return ready;
 }
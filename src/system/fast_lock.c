@@ -0,0 +1,97 @@
+/**
+ * \file system/fast_lock.c
+ *
+ * Locks the __pros_fast sections into the L2 cache
+ *
+ * The V5's Zynq has a 512 KB, 8-way PL310 L2 cache. PROS_BOOT_LOCK_FAST
+ * dedicates one way to the __pros_fast code and data (see system/optimizers.h),
+ * so that the tick, context switch and daemon paths never wait on DDR after the
+ * rest of the program evicts them. The other 448 KB stays shared with VEXos.
+ *
+ * Locking a way works by flushing the sections out of both cache levels,
+ * allowing allocation into that way only, reading the sections back in and
+ * then forbidding allocation into the way, which keeps the lines in it as
+ * long as the lockdown lasts. The V5 maps memory flat, so the addresses the
+ * linker gives are physical ones as well.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CACHE_LINE 32
+
+#define L2C_BASE 0xF8F02000
+#define L2C_CACHE_SYNC 0x730
+#define L2C_CLEAN_INV_PA 0x7F0
+// Each of the 8 bus masters has a data and an instruction lockdown register. A
+// set bit keeps the master from allocating lines into that way
+#define L2C_D_LOCKDOWN(master) (0x900 + 8 * (master))
+#define L2C_I_LOCKDOWN(master) (0x904 + 8 * (master))
+#define L2C_MASTERS 8
+#define L2C_WAYS_MASK 0xFF
+
+#define FAST_WAY 7
+
+#define L2C_REG(offset) (*(volatile uint32_t*)(L2C_BASE + (offset)))
+
+extern uint8_t __pros_fast_text_start[], __pros_fast_text_end[];
+extern uint8_t __pros_fast_data_start[], __pros_fast_data_end[];
+extern uint8_t __pros_fast_bss_start[], __pros_fast_bss_end[];
+
+static void flush_range(uint8_t const* start, uint8_t const* end) {
+	for (uintptr_t line = (uintptr_t)start & ~(CACHE_LINE - 1); line < (uintptr_t)end; line += CACHE_LINE) {
+		// DCCIMVAC: clean and invalidate the line in L1, then in L2
+		__asm__ volatile("mcr p15, 0, %0, c7, c14, 1" ::"r"(line) : "memory");
+		__asm__ volatile("dsb" ::: "memory");
+		L2C_REG(L2C_CLEAN_INV_PA) = line;
+	}
+}
+
+static void touch_range(uint8_t const* start, uint8_t const* end) {
+	for (uintptr_t line = (uintptr_t)start & ~(CACHE_LINE - 1); line < (uintptr_t)end; line += CACHE_LINE) {
+		(void)*(volatile uint32_t const*)line;
+	}
+}
+
+static void set_lockdown(uint32_t const* base, uint32_t ways) {
+	for (int m = 0; m < L2C_MASTERS; m++) {
+		L2C_REG(L2C_D_LOCKDOWN(m)) = base[2 * m] | ways;
+		L2C_REG(L2C_I_LOCKDOWN(m)) = base[2 * m + 1] | ways;
+	}
+	L2C_REG(L2C_CACHE_SYNC) = 0;
+	__asm__ volatile("dsb" ::: "memory");
+}
+
+// Locks the __pros_fast sections into the last way of the L2 cache, unless
+// something else (VEXos) already locked that way. Runs with interrupts disabled
+// before the scheduler starts
+bool fast_memory_lock(void) {
+	uint32_t lockdown[2 * L2C_MASTERS];
+	for (int m = 0; m < L2C_MASTERS; m++) {
+		lockdown[2 * m] = L2C_REG(L2C_D_LOCKDOWN(m));
+		lockdown[2 * m + 1] = L2C_REG(L2C_I_LOCKDOWN(m));
+		if ((lockdown[2 * m] | lockdown[2 * m + 1]) & (1 << FAST_WAY)) return false;
+	}
+
+	flush_range(__pros_fast_text_start, __pros_fast_text_end);
+	flush_range(__pros_fast_data_start, __pros_fast_data_end);
+	flush_range(__pros_fast_bss_start, __pros_fast_bss_end);
+	L2C_REG(L2C_CACHE_SYNC) = 0;
+	__asm__ volatile("dsb" ::: "memory");
+
+	// Only the fast way may take lines while the sections are read back in
+	set_lockdown(lockdown, L2C_WAYS_MASK & ~(1 << FAST_WAY));
+	touch_range(__pros_fast_text_start, __pros_fast_text_end);
+	touch_range(__pros_fast_data_start, __pros_fast_data_end);
+	touch_range(__pros_fast_bss_start, __pros_fast_bss_end);
+	__asm__ volatile("dsb" ::: "memory");
+	set_lockdown(lockdown, 1 << FAST_WAY);
+	return true;
+}
@@ -1,7 +1,14 @@
 #include "system/hot.h"
+#include "common/crc.h"
 #include "kapi.h"
+#include "system/cycles.h"
+#include "system/dev/ser.h"
 #include "v5_api.h"
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 // stored only in cold
 struct hot_table __HOT_TABLE = {0};
 struct hot_table* const HOT_TABLE = &__HOT_TABLE;
@@ -9,8 +16,25 @@ struct hot_table* const HOT_TABLE = &__HOT_TABLE;
 #define MAGIC0 0x52616368
 #define MAGIC1 0x8CEF7310
 
-__attribute__((section(".hot_magic"))) uint32_t MAGIC[] = {MAGIC0, MAGIC1};
-uint32_t const volatile* const MAGIC_ADDR = MAGIC;
+// The chunk table is placed by v5-hot.ld at the end of the hot image, and is
+// found through the magic so that it can be checked before the hot image runs
+extern __attribute__((weak)) struct hot_chunks const __hot_chunks;
+// Defined by PROS_BOOT_OPTIONS() in the user program, and also found through
+// the magic since pros_init needs it before the hot table is installed
+extern __attribute__((weak)) uint32_t const pros_boot_options;
+// Defined by PROS_SER_BUFFER_SIZES(), needed by vfs_initialize() the same way
+extern __attribute__((weak)) ser_buffer_sizes_s_t const pros_ser_buffer_sizes;
+
+struct hot_magic {
+	uint32_t magic[2];
+	struct hot_chunks const* chunks;
+	uint32_t const* boot_options;
+	ser_buffer_sizes_s_t const* ser_buffer_sizes;
+};
+
+__attribute__((section(".hot_magic"))) struct hot_magic MAGIC = {
+    {MAGIC0, MAGIC1}, &__hot_chunks, &pros_boot_options, &pros_ser_buffer_sizes};
+struct hot_magic const volatile* const MAGIC_ADDR = &MAGIC;
 
 // The linker decides on these symbols in each section just as normal
 // When linking in hot, these pointers work just like any other weak symbol
@@ -28,12 +52,50 @@ extern unsigned __exidx_end;
 #include "system/user_functions/list.h"
 #undef FUNC
 
+// Clears .bss 64 bytes at a time with NEON stores, which is what most of the
+// time before the constructors goes to in programs with big zeroed tables.
+// memset takes the unaligned ends and anything too small to be worth it
+__attribute__((section(".hot_init"))) static void bss_clear(uint8_t* start, uint8_t* end) {
+#ifdef __ARM_NEON
+	if (end - start >= 128) {
+		uint8_t* aligned = (uint8_t*)(((uintptr_t)start + 15) & ~(uintptr_t)15);
+		memset(start, 0, aligned - start);
+		uint8x16_t const zero = vdupq_n_u8(0);
+		for (; end - aligned >= 64; aligned += 64) {
+			vst1q_u8(aligned, zero);
+			vst1q_u8(aligned + 16, zero);
+			vst1q_u8(aligned + 32, zero);
+			vst1q_u8(aligned + 48, zero);
+		}
+		start = aligned;
+	}
+#endif
+	memset(start, 0, end - start);
+}
+
+// Runs each constructor between start and end, keeping track of the slowest
+__attribute__((section(".hot_init"))) static void run_ctors(struct hot_table* const tbl, void (*const* start)(void),
+                                                            void (*const* end)(void)) {
+	for (void (*const* ctor)(void) = start; ctor < end; ctor++) {
+		uint32_t const begin = cycle_counter_get();
+		(*ctor)();
+		uint32_t const cycles = cycle_counter_get() - begin;
+		tbl->init_stats.ctor_count++;
+		tbl->init_stats.ctor_cycles += cycles;
+		if (cycles > tbl->init_stats.slowest_ctor_cycles) {
+			tbl->init_stats.slowest_ctor = *ctor;
+			tbl->init_stats.slowest_ctor_cycles = cycles;
+		}
+	}
+}
+
 __attribute__((section(".hot_init"))) void install_hot_table(struct hot_table* const tbl) {
 	// printf("Hot initializing\n");
 	tbl->compile_timestamp = _PROS_COMPILE_TIMESTAMP;
 	tbl->compile_directory = _PROS_COMPILE_DIRECTORY;
 	tbl->__exidx_start = &__exidx_start;
 	tbl->__exidx_end = &__exidx_end;
+	tbl->chunks = &__hot_chunks;
 
 // this expands to a bunch of:
 // tbl->functions.autonomous = autonomous;
@@ -44,36 +106,83 @@ __attribute__((section(".hot_init"))) void install_hot_table(struct hot_table* c
 	// all of these weak symbols are given to us by the linker
 	// These values should come from the hot region, since that's where this
 	// function is linked
-	extern __attribute__((weak)) uint8_t* __sbss_start[];
-	extern __attribute__((weak)) uint8_t* __sbss_end[];
-	memset(__sbss_start, 0, (size_t)__sbss_end - (size_t)__sbss_start);
+	memset(&tbl->init_stats, 0, sizeof(tbl->init_stats));
+	uint32_t const bss_begin = cycle_counter_get();
+	extern __attribute__((weak)) uint8_t __sbss_start[];
+	extern __attribute__((weak)) uint8_t __sbss_end[];
+	bss_clear(__sbss_start, __sbss_end);
 
-	extern __attribute__((weak)) uint8_t* __bss_start[];
-	extern __attribute__((weak)) uint8_t* __bss_end[];
-	memset(__bss_start, 0, (size_t)__bss_end - (size_t)__bss_start);
+	extern __attribute__((weak)) uint8_t __bss_start[];
+	extern __attribute__((weak)) uint8_t __bss_end[];
+	bss_clear(__bss_start, __bss_end);
+	tbl->init_stats.bss_cycles = cycle_counter_get() - bss_begin;
+	tbl->init_stats.bss_bytes = (__sbss_end - __sbss_start) + (__bss_end - __bss_start);
 
 	extern __attribute__((weak)) void (*const __preinit_array_start[])(void);
 	extern __attribute__((weak)) void (*const __preinit_array_end[])(void);
-	for (void (*const* ctor)() = __preinit_array_start; ctor < __preinit_array_end; ctor++) {
-		(*ctor)();
-	}
+	run_ctors(tbl, __preinit_array_start, __preinit_array_end);
 
 	extern __attribute__((weak)) void (*const __init_array_start[])(void);
 	extern __attribute__((weak)) void (*const __init_array_end[])(void);
-	for (void (*const* ctor)() = __init_array_start; ctor < __init_array_end; ctor++) {
-		(*ctor)();
+	run_ctors(tbl, __init_array_start, __init_array_end);
+}
+
+int32_t hot_chunks_verify(struct hot_chunks const* chunks) {
+	if (!chunks || chunks->magic != HOT_CHUNKS_MAGIC || chunks->chunk_size == 0) {
+		return -1;
 	}
+	extern uint8_t start_of_hot_mem;
+	uint32_t const* hashes = (uint32_t const*)chunks - chunks->count;
+	uint8_t const* image_end = (uint8_t const*)hashes;
+	uint8_t const* chunk = &start_of_hot_mem;
+	for (uint32_t i = 0; i < chunks->count; i++, chunk += chunks->chunk_size) {
+		size_t len = (size_t)(image_end - chunk) < chunks->chunk_size ? (size_t)(image_end - chunk) : chunks->chunk_size;
+		if (crc32(CRC32_INIT, chunk, len) != hashes[i]) {
+			return (int32_t)i;
+		}
+	}
+	return -1;
+}
+
+static bool hot_image_present(void) {
+	return vexSystemLinkAddrGet() == (uint32_t)0x03800000 && MAGIC_ADDR->magic[0] == MAGIC0 &&
+	       MAGIC_ADDR->magic[1] == MAGIC1;
+}
+
+uint32_t boot_get_options(void) {
+	// A monolithic program links its options straight into the kernel
+	uint32_t const* options = hot_image_present() ? MAGIC_ADDR->boot_options : &pros_boot_options;
+	return options ? *options : 0;
+}
+
+const ser_buffer_sizes_s_t* boot_get_ser_buffer_sizes(void) {
+	return hot_image_present() ? MAGIC_ADDR->ser_buffer_sizes : &pros_ser_buffer_sizes;
 }
 
 // this function really exists on the cold section! Called by pros_init
 // this does the check if we're running with hot/cold and invokes the hot table
 // installer (install_hot_table) located in hot memory
 void invoke_install_hot_table() {
-	// install_hot_table is at 0x07800008
+	// install_hot_table is at 0x07800010
 	// MAGIC_ADDR is at 0x0780000
-	// printf("%s %p %p %x %x\n", __FUNCTION__, (void*)install_hot_table, (void*)HOT_TABLE, MAGIC_ADDR[0], MAGIC_ADDR[1]);
-	if (vexSystemLinkAddrGet() == (uint32_t)0x03800000 && MAGIC_ADDR[0] == MAGIC0 && MAGIC_ADDR[1] == MAGIC1) {
-		install_hot_table(HOT_TABLE);
+	// printf("%s %p %p %x %x\n", __FUNCTION__, (void*)install_hot_table, (void*)HOT_TABLE, MAGIC_ADDR->magic[0], MAGIC_ADDR->magic[1]);
+	if (hot_image_present()) {
+		// An upload which only sent some of the chunks must have left the others
+		// intact, otherwise the hot image is a mix of two programs
+		int32_t bad_chunk = hot_chunks_verify(MAGIC_ADDR->chunks);
+		if (bad_chunk < 0) {
+			install_hot_table(HOT_TABLE);
+			if (HOT_TABLE->__exidx_start != HOT_TABLE->__exidx_end) {
+				extern uint8_t start_of_hot_mem, end_of_hot_mem;
+				HOT_TABLE->exidx_code_start = (uintptr_t)&start_of_hot_mem;
+				HOT_TABLE->exidx_code_end = (uintptr_t)&end_of_hot_mem;
+			}
+			return;
+		}
+		memset(HOT_TABLE, 0, sizeof(*HOT_TABLE));
+		char msg[64];
+		snprintf(msg, sizeof(msg), "Hot image chunk %ld is corrupt, re-upload", bad_chunk);
+		display_error(msg);
 	} else {
 		memset(HOT_TABLE, 0, sizeof(*HOT_TABLE));
 	}
@@ -0,0 +1,124 @@
+/**
+ * \file system/idle_work.c
+ *
+ * Deferrable callbacks run by the idle task
+ *
+ * vApplicationIdleHook() calls idle_work_run() on every pass of the idle
+ * task's loop, after the tasks waiting to be freed have been. It starts the
+ * registered callbacks round robin, picking up after the last one it ran, and
+ * stops starting them once the pass's budget is used. The registry is only
+ * changed with the scheduler suspended, and the idle task copies out the next
+ * callback the same way, so a callback is never seen half registered.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+
+#define IDLE_WORK_NONE -1
+
+typedef struct idle_work_entry {
+	idle_work_fn_t fn;
+	void* param;
+} idle_work_entry_s_t;
+
+static idle_work_entry_s_t entries[IDLE_WORK_MAX];
+static uint32_t registered;  // Bit i for entries[i]
+static volatile int32_t running = IDLE_WORK_NONE;
+static uint32_t next;  // Only used by the idle task
+static volatile uint32_t budget = IDLE_WORK_DEFAULT_BUDGET;
+static idle_work_stats_s_t stats;
+static task_t idle_task;
+
+int32_t idle_work_register(idle_work_fn_t fn, void* param) {
+	if (fn == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	if (registered == (1 << IDLE_WORK_MAX) - 1) {
+		rtos_resume_all();
+		errno = ENOSPC;
+		return PROS_ERR;
+	}
+	int32_t const id = __builtin_ctz(~registered);
+	entries[id] = (idle_work_entry_s_t){.fn = fn, .param = param};
+	registered |= 1 << id;
+	rtos_resume_all();
+	return id;
+}
+
+int32_t idle_work_unregister(int32_t id) {
+	rtos_suspend_all();
+	if (id < 0 || id >= IDLE_WORK_MAX || !(registered & (1 << id))) {
+		rtos_resume_all();
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	registered &= ~(1 << id);
+	rtos_resume_all();
+	// The idle task only runs once this task blocks, so wait for it to finish instead of spinning
+	while (running == id) task_delay(1);
+	return 1;
+}
+
+void idle_work_set_budget(uint32_t new_budget) {
+	budget = new_budget;
+}
+
+int32_t idle_work_get_stats(idle_work_stats_s_t* const out) {
+	if (out == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*out = stats;
+	rtos_resume_all();
+	return 1;
+}
+
+double idle_get_usage(void) {
+	return idle_task != NULL ? task_get_cpu_usage(idle_task) : 0;
+}
+
+// Called by vApplicationIdleHook() on every pass of the idle task's loop
+void idle_work_run(void) {
+	if (unlikely(idle_task == NULL)) idle_task = task_get_current();
+	if (likely(!registered)) return;
+	uint64_t const deadline = micros() + budget;
+	for (uint32_t i = 0; i < IDLE_WORK_MAX; i++) {
+		uint32_t const id = (next + i) % IDLE_WORK_MAX;
+		rtos_suspend_all();
+		if (!(registered & (1 << id))) {
+			rtos_resume_all();
+			continue;
+		}
+		idle_work_entry_s_t const entry = entries[id];
+		running = id;
+		rtos_resume_all();
+
+		uint64_t const start = micros();
+		entry.fn(entry.param, deadline);
+		uint64_t const end = micros();
+		running = IDLE_WORK_NONE;
+
+		uint32_t const elapsed = end - start;
+		rtos_suspend_all();
+		stats.runs++;
+		stats.work_time += elapsed;
+		if (end > deadline) stats.overruns++;
+		if (elapsed > stats.longest) stats.longest = elapsed;
+		rtos_resume_all();
+
+		next = id + 1;
+		if (end >= deadline) break;
+	}
+}
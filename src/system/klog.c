@@ -0,0 +1,266 @@
+/**
+ * \file system/klog.c
+ *
+ * Kernel log
+ *
+ * kprintf() and klog() used to format their messages and write them to kdbg
+ * on the spot, which took newlib's locks and the serial driver's from inside
+ * the registry and the VFS. Now klog_write() packs the arguments like
+ * plog_write() and queues a record of the format, file, line, level and
+ * subsystem in a queue of its own, built the same way as plog's. A low
+ * priority task takes the records out in order, formats them and writes them
+ * to kdbg.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+
+#define KLOG_QUEUE_LENGTH 128  // must be a power of 2
+#define KLOG_DRAIN_PERIOD 10   // ms
+#define KLOG_LINE_SIZE 256
+#define KLOG_SPEC_SIZE 24
+#define KLOG_TASK_STACK_DEPTH (TASK_STACK_DEPTH_MIN * 2)  // snprintf() of a double needs the room
+
+#define KLOG_CONVERSIONS "diouxXcsfFeEgGaAp"
+
+// from plog.c
+extern size_t plog_pack(uint8_t* args, const char* fmt, va_list* ap);
+
+typedef struct klog_slot {
+	uint32_t seq;
+	const char* fmt;
+	const char* file;
+	uint16_t line;
+	uint8_t tag;  // subsystem << 4 | level
+	uint8_t len;
+	uint8_t args[PLOG_ARGS_SIZE];
+} klog_slot_s_t;
+
+static const char* const subsystem_names[E_KLOG_SUBSYSTEMS] = {"KERNEL", "BOOT", "VFS", "VDML"};
+static const char* const level_names[E_KLOG_NONE] = {"DEBUG", "INFO", "WARNING", "ERROR"};
+
+static uint8_t levels[E_KLOG_SUBSYSTEMS];  // E_KLOG_INFO once klog_initialize() runs
+// Raised over every subsystem's level while the CPU is overloaded, without
+// changing what klog_get_level() reports
+static uint8_t shed_floor = E_KLOG_DEBUG;
+
+static klog_slot_s_t slots[KLOG_QUEUE_LENGTH];
+static uint32_t enqueue_pos;
+static uint32_t dequeue_pos;  // only used by the log task
+static uint32_t dropped;
+
+static task_stack_t klog_task_stack[KLOG_TASK_STACK_DEPTH];
+static static_task_s_t klog_task_buffer;
+
+bool klog_write(uint8_t subsystem, uint8_t level, const char* file, uint16_t line, const char* fmt, ...) {
+	if (unlikely(subsystem >= E_KLOG_SUBSYSTEMS || level >= E_KLOG_NONE) ||
+	    level < __atomic_load_n(&levels[subsystem], __ATOMIC_RELAXED) ||
+	    level < __atomic_load_n(&shed_floor, __ATOMIC_RELAXED)) {
+		return false;
+	}
+	uint8_t args[PLOG_ARGS_SIZE];
+	va_list ap;
+	va_start(ap, fmt);
+	size_t const len = plog_pack(args, fmt, &ap);
+	va_end(ap);
+
+	// Claimed and given back the same way as plog_write()'s slots
+	klog_slot_s_t* slot;
+	uint32_t pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+	while (true) {
+		slot = &slots[pos & (KLOG_QUEUE_LENGTH - 1)];
+		int32_t const diff = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) - pos;
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+		} else if (diff < 0) {
+			__atomic_add_fetch(&dropped, 1, __ATOMIC_RELAXED);
+			return false;
+		} else {
+			pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+		}
+	}
+	slot->fmt = fmt;
+	slot->file = file;
+	slot->line = line;
+	slot->tag = subsystem << 4 | level;
+	slot->len = len;
+	memcpy(slot->args, args, len);
+	__atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+int32_t klog_set_level(klog_subsystem_e_t subsystem, klog_level_e_t level) {
+	if ((uint32_t)subsystem > E_KLOG_SUBSYSTEMS || (uint32_t)level > E_KLOG_NONE) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	for (uint32_t i = 0; i < E_KLOG_SUBSYSTEMS; i++) {
+		if (subsystem == E_KLOG_SUBSYSTEMS || i == (uint32_t)subsystem) {
+			__atomic_store_n(&levels[i], level, __ATOMIC_RELAXED);
+		}
+	}
+	return 1;
+}
+
+// Called by system/overload.c
+void klog_set_shed_floor(klog_level_e_t level) {
+	__atomic_store_n(&shed_floor, level, __ATOMIC_RELAXED);
+}
+
+klog_level_e_t klog_get_level(klog_subsystem_e_t subsystem) {
+	if ((uint32_t)subsystem >= E_KLOG_SUBSYSTEMS) return E_KLOG_NONE;
+	return __atomic_load_n(&levels[subsystem], __ATOMIC_RELAXED);
+}
+
+uint32_t klog_get_dropped(void) {
+	return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
+
+// Takes the next size bytes of arguments, returning false if they ran out
+static bool klog_take(const uint8_t* args, size_t len, size_t* pos, void* value, size_t size) {
+	if (*pos + size > len) return false;
+	memcpy(value, args + *pos, size);
+	*pos += size;
+	return true;
+}
+
+// Formats fmt with the arguments packed by plog_pack() into out, stopping where
+// the arguments ran out. Returns the length written
+static size_t klog_format(char* out, size_t size, const char* fmt, const uint8_t* args, size_t len) {
+	char spec[KLOG_SPEC_SIZE];
+	size_t n = 0, pos = 0;
+	while (*fmt && n < size - 1) {
+		if (*fmt != '%') {
+			out[n++] = *fmt++;
+			continue;
+		}
+		if (fmt[1] == '%') {
+			out[n++] = '%';
+			fmt += 2;
+			continue;
+		}
+		// The conversion is rebuilt with any * width or precision written in
+		size_t s = 0;
+		bool wide = false;
+		spec[s++] = *fmt++;
+		for (; *fmt && !strchr(KLOG_CONVERSIONS, *fmt); fmt++) {
+			if (s >= sizeof(spec) - 2) return n;
+			if (*fmt == '*') {
+				int value;
+				if (!klog_take(args, len, &pos, &value, sizeof(value))) return n;
+				if (value < 0 && spec[s - 1] == '.') {
+					// a negative precision is as if there were none
+					s--;
+				} else {
+					int const written = snprintf(spec + s, sizeof(spec) - s, "%d", value);
+					if (written < 0 || (size_t)written >= sizeof(spec) - s) return n;
+					s += written;
+				}
+				continue;
+			}
+			wide |= *fmt == 'j' || (*fmt == 'l' && spec[s - 1] == 'l');
+			spec[s++] = *fmt;
+		}
+		if (!*fmt) return n;
+		spec[s++] = *fmt;
+		spec[s] = '\0';
+
+		int written;
+		switch (*fmt++) {
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A': {
+				double value;
+				if (!klog_take(args, len, &pos, &value, sizeof(value))) return n;
+				written = snprintf(out + n, size - n, spec, value);
+				break;
+			}
+			case 's': {
+				if (pos >= len) return n;
+				const char* const str = (const char*)args + pos;
+				pos += strnlen(str, len - pos) + 1;
+				written = snprintf(out + n, size - n, spec, str);
+				break;
+			}
+			case 'p': {
+				void* value;
+				if (!klog_take(args, len, &pos, &value, sizeof(value))) return n;
+				written = snprintf(out + n, size - n, spec, value);
+				break;
+			}
+			default:
+				if (wide) {
+					long long value;
+					if (!klog_take(args, len, &pos, &value, sizeof(value))) return n;
+					written = snprintf(out + n, size - n, spec, value);
+				} else {
+					int value;
+					if (!klog_take(args, len, &pos, &value, sizeof(value))) return n;
+					written = snprintf(out + n, size - n, spec, value);
+				}
+				break;
+		}
+		if (written < 0) return n;
+		n += (size_t)written < size - n ? (size_t)written : size - n - 1;
+	}
+	return n;
+}
+
+static void klog_task(void* ign) {
+	static char line[KLOG_LINE_SIZE];
+	uint32_t reported_drops = 0;
+	while (true) {
+		task_delay(KLOG_DRAIN_PERIOD);
+		uint32_t const drops = klog_get_dropped();
+		if (drops != reported_drops) {
+			int const len = snprintf(line, sizeof(line), "%s:%d -- [KERNEL][WARNING] %lu messages dropped\n", __FILE__,
+			                         __LINE__, drops - reported_drops);
+			write(KDBG_FILENO, line, len < (int)sizeof(line) ? len : (int)sizeof(line) - 1);
+			reported_drops = drops;
+		}
+		while (true) {
+			klog_slot_s_t* const slot = &slots[dequeue_pos & (KLOG_QUEUE_LENGTH - 1)];
+			if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != dequeue_pos + 1) break;
+			int len = snprintf(line, sizeof(line), "%s:%u -- [%s][%s] ", slot->file, slot->line,
+			                   subsystem_names[slot->tag >> 4], level_names[slot->tag & 0xf]);
+			if (len < 0 || len >= (int)sizeof(line) - 1) len = sizeof(line) - 2;
+			len += klog_format(line + len, sizeof(line) - 1 - len, slot->fmt, slot->args, slot->len);
+			// the record's written out, so the slot is free for the producers' next lap
+			__atomic_store_n(&slot->seq, dequeue_pos + KLOG_QUEUE_LENGTH, __ATOMIC_RELEASE);
+			dequeue_pos++;
+			line[len++] = '\n';
+			write(KDBG_FILENO, line, len);
+		}
+	}
+}
+
+// called by pros_init() in startup.c, once the RTOS is initialized and before
+// anything else is, so the messages logged during boot are kept
+void klog_initialize(void) {
+	for (uint32_t i = 0; i < KLOG_QUEUE_LENGTH; i++) {
+		slots[i].seq = i;
+	}
+	for (uint32_t i = 0; i < E_KLOG_SUBSYSTEMS; i++) {
+		levels[i] = E_KLOG_INFO;
+	}
+	task_create_static(klog_task, NULL, TASK_PRIORITY_MIN + 1, KLOG_TASK_STACK_DEPTH, "Kernel Log (PROS)",
+	                   klog_task_stack, &klog_task_buffer);
+}
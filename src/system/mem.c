@@ -0,0 +1,180 @@
+/**
+ * \file system/mem.c
+ *
+ * memcpy, memset and memcmp for the Cortex-A9
+ *
+ * These replace the generic newlib versions in libc.a, which move a byte or a
+ * word at a time. Each function picks a method by size: short blocks go a byte
+ * at a time since anything cleverer costs more to set up than it saves, medium
+ * blocks go a word at a time when the pointers allow it, and long blocks go
+ * through the NEON unit 64 bytes at a time. NEON loads and stores don't need
+ * aligned addresses, so blocks which are misaligned relative to each other
+ * still take the fast path. The thresholds come from tests/mem_bench.c.
+ *
+ * NEON registers are safe to use anywhere in the kernel: every task has an FPU
+ * context (configUSE_TASK_FPU_SUPPORT is 2) and interrupts save the FPU
+ * registers before they reach vApplicationFPUSafeIRQHandler().
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+// Blocks shorter than these go a byte at a time, and blocks at least as long as
+// the NEON thresholds go through the NEON unit
+#define MEMCPY_WORD_MIN 16
+#define MEMCPY_NEON_MIN 64
+#define MEMSET_WORD_MIN 16
+#define MEMSET_NEON_MIN 96
+#define MEMCMP_WORD_MIN 16
+#define MEMCMP_NEON_MIN 64
+
+// The kernel is built for size, but these are hot enough to be worth unrolling.
+// GCC must also not turn the byte loops back into calls to the functions
+// they're in
+#define MEM_FN __attribute__((optimize("O2", "no-tree-loop-distribute-patterns")))
+
+#define ALIGNED(p, n) (((uintptr_t)(p) & ((n)-1)) == 0)
+
+// The words alias whatever the caller's blocks hold
+typedef uint32_t __attribute__((may_alias)) word_t;
+
+MEM_FN void* memcpy(void* restrict dest, void const* restrict src, size_t n) {
+	uint8_t* restrict d = dest;
+	uint8_t const* restrict s = src;
+
+#ifdef __ARM_NEON
+	if (n >= MEMCPY_NEON_MIN) {
+		// Stores which straddle a cache line are the expensive ones, so align
+		// the destination and let the loads fall where they may
+		while (!ALIGNED(d, 16)) {
+			*d++ = *s++;
+			n--;
+		}
+		for (; n >= 64; n -= 64, d += 64, s += 64) {
+			__builtin_prefetch(s + 256);
+			uint8x16_t a = vld1q_u8(s);
+			uint8x16_t b = vld1q_u8(s + 16);
+			uint8x16_t c = vld1q_u8(s + 32);
+			uint8x16_t e = vld1q_u8(s + 48);
+			vst1q_u8(d, a);
+			vst1q_u8(d + 16, b);
+			vst1q_u8(d + 32, c);
+			vst1q_u8(d + 48, e);
+		}
+		for (; n >= 16; n -= 16, d += 16, s += 16) vst1q_u8(d, vld1q_u8(s));
+	}
+#endif
+
+	if (n >= MEMCPY_WORD_MIN && ALIGNED((uintptr_t)d ^ (uintptr_t)s, 4)) {
+		while (!ALIGNED(d, 4)) {
+			*d++ = *s++;
+			n--;
+		}
+		word_t* restrict dw = (word_t*)d;
+		word_t const* restrict sw = (word_t const*)s;
+		for (; n >= 16; n -= 16, dw += 4, sw += 4) {
+			dw[0] = sw[0];
+			dw[1] = sw[1];
+			dw[2] = sw[2];
+			dw[3] = sw[3];
+		}
+		for (; n >= 4; n -= 4) *dw++ = *sw++;
+		d = (uint8_t*)dw;
+		s = (uint8_t const*)sw;
+	}
+
+	while (n--) *d++ = *s++;
+	return dest;
+}
+
+MEM_FN void* memset(void* dest, int c, size_t n) {
+	uint8_t* d = dest;
+	uint8_t const byte = (uint8_t)c;
+
+#ifdef __ARM_NEON
+	if (n >= MEMSET_NEON_MIN) {
+		while (!ALIGNED(d, 16)) {
+			*d++ = byte;
+			n--;
+		}
+		uint8x16_t const v = vdupq_n_u8(byte);
+		for (; n >= 64; n -= 64, d += 64) {
+			vst1q_u8(d, v);
+			vst1q_u8(d + 16, v);
+			vst1q_u8(d + 32, v);
+			vst1q_u8(d + 48, v);
+		}
+		for (; n >= 16; n -= 16, d += 16) vst1q_u8(d, v);
+	}
+#endif
+
+	if (n >= MEMSET_WORD_MIN) {
+		while (!ALIGNED(d, 4)) {
+			*d++ = byte;
+			n--;
+		}
+		uint32_t const word = byte * 0x01010101u;
+		word_t* dw = (word_t*)d;
+		for (; n >= 16; n -= 16, dw += 4) {
+			dw[0] = word;
+			dw[1] = word;
+			dw[2] = word;
+			dw[3] = word;
+		}
+		for (; n >= 4; n -= 4) *dw++ = word;
+		d = (uint8_t*)dw;
+	}
+
+	while (n--) *d++ = byte;
+	return dest;
+}
+
+MEM_FN int memcmp(void const* a, void const* b, size_t n) {
+	uint8_t const* x = a;
+	uint8_t const* y = b;
+
+#ifdef __ARM_NEON
+	// Skips the blocks which match, and leaves the first which doesn't to the
+	// byte loop below
+	if (n >= MEMCMP_NEON_MIN) {
+		for (; n >= 16; n -= 16, x += 16, y += 16) {
+			uint8x16_t const eq = vceqq_u8(vld1q_u8(x), vld1q_u8(y));
+			uint8x8_t const half = vand_u8(vget_low_u8(eq), vget_high_u8(eq));
+			if (vget_lane_u64(vreinterpret_u64_u8(half), 0) != UINT64_MAX) break;
+		}
+	}
+#endif
+
+	if (n >= MEMCMP_WORD_MIN && ALIGNED((uintptr_t)x ^ (uintptr_t)y, 4)) {
+		while (!ALIGNED(x, 4) && n) {
+			if (*x != *y) return *x - *y;
+			x++;
+			y++;
+			n--;
+		}
+		word_t const* xw = (word_t const*)x;
+		word_t const* yw = (word_t const*)y;
+		for (; n >= 4 && *xw == *yw; n -= 4) {
+			xw++;
+			yw++;
+		}
+		x = (uint8_t const*)xw;
+		y = (uint8_t const*)yw;
+	}
+
+	for (; n; n--, x++, y++) {
+		if (*x != *y) return *x - *y;
+	}
+	return 0;
+}
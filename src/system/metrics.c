@@ -0,0 +1,282 @@
+/**
+ * \file system/metrics.c
+ *
+ * Registry of named metrics
+ *
+ * Metrics are kept in a fixed table and registered once, so updating one is
+ * a single atomic operation on its slot which needs no lock and works from an
+ * interrupt. The table is only appended to with the scheduler suspended, and
+ * the count is bumped after the new slot is filled in, so the serial daemon
+ * can walk it without locking anything while metrics are being updated.
+ *
+ * A snapshot copies each metric's value one at a time, so a histogram's
+ * buckets may be a few observations off from one another, but never torn.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "system/dev/ser.h"
+#include "system/optimizers.h"
+
+// 'd', the metric count and millis()
+#define SNAPSHOT_HEADER_SIZE (2 + sizeof(uint32_t))
+// the index and type, then the value or the histogram
+#define SNAPSHOT_SCALAR_SIZE (2 + sizeof(uint32_t))
+#define SNAPSHOT_HISTOGRAM_SIZE (2 + sizeof(metric_histogram_s_t))
+#define SNAPSHOT_MAX_SIZE \
+	(SNAPSHOT_HEADER_SIZE + (METRIC_MAX_COUNT - METRIC_MAX_HISTOGRAMS) * SNAPSHOT_SCALAR_SIZE + \
+	 METRIC_MAX_HISTOGRAMS * SNAPSHOT_HISTOGRAM_SIZE)
+
+typedef struct metric {
+	const char* name;
+	metric_type_e_t type;
+	volatile uint32_t value;
+	uint32_t (*sample)(void);        // for sampled gauges, NULL otherwise
+	metric_histogram_s_t* histogram;  // for histograms, NULL otherwise
+} metric_s_t;
+
+static metric_s_t metrics[METRIC_MAX_COUNT];
+static volatile uint32_t metric_count;
+static metric_histogram_s_t histograms[METRIC_MAX_HISTOGRAMS];
+static uint32_t histogram_count;
+
+static uint32_t emit_period;  // ms between snapshots sent by the serial daemon, 0 if off
+static uint32_t next_emit;
+static uint32_t emit_shed = 1;  // multiplies the period while the CPU is overloaded
+
+static static_sem_s_t snapshot_mutex_buf;
+static mutex_t snapshot_mutex;
+static uint8_t snapshot[SNAPSHOT_MAX_SIZE];
+
+static int32_t metric_register(const char* name, metric_type_e_t type, uint32_t (*sample)(void)) {
+	if (name == NULL || strlen(name) > METRIC_NAME_LENGTH) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	int32_t rtn = PROS_ERR;
+	rtos_suspend_all();
+	for (uint32_t i = 0; i < metric_count; i++) {
+		if (!strcmp(metrics[i].name, name)) {
+			errno = EEXIST;
+			goto leave;
+		}
+	}
+	if (metric_count >= METRIC_MAX_COUNT ||
+	    (type == E_METRIC_HISTOGRAM && histogram_count >= METRIC_MAX_HISTOGRAMS)) {
+		errno = ENOMEM;
+		goto leave;
+	}
+	metrics[metric_count] = (metric_s_t){.name = name, .type = type, .sample = sample};
+	if (type == E_METRIC_HISTOGRAM) metrics[metric_count].histogram = &histograms[histogram_count++];
+	compiler_barrier();
+	rtn = metric_count++;
+leave:
+	rtos_resume_all();
+	return rtn;
+}
+
+int32_t metric_register_counter(const char* name) {
+	return metric_register(name, E_METRIC_COUNTER, NULL);
+}
+
+int32_t metric_register_gauge(const char* name) {
+	return metric_register(name, E_METRIC_GAUGE, NULL);
+}
+
+int32_t metric_register_sampled(const char* name, uint32_t (*sample)(void)) {
+	if (sample == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	return metric_register(name, E_METRIC_GAUGE, sample);
+}
+
+int32_t metric_register_histogram(const char* name) {
+	return metric_register(name, E_METRIC_HISTOGRAM, NULL);
+}
+
+void metric_add(int32_t metric, uint32_t n) {
+	if (unlikely((uint32_t)metric >= metric_count)) return;
+	__atomic_fetch_add(&metrics[metric].value, n, __ATOMIC_RELAXED);
+}
+
+void metric_set(int32_t metric, uint32_t value) {
+	if (unlikely((uint32_t)metric >= metric_count)) return;
+	metrics[metric].value = value;
+}
+
+void metric_observe(int32_t metric, uint32_t value) {
+	if (unlikely((uint32_t)metric >= metric_count)) return;
+	metric_histogram_s_t* const histogram = metrics[metric].histogram;
+	if (unlikely(histogram == NULL)) return;
+	// bucket i counts the values of i significant bits
+	uint32_t bucket = value ? 32 - __builtin_clz(value) : 0;
+	if (bucket >= METRIC_HISTOGRAM_BUCKETS) bucket = METRIC_HISTOGRAM_BUCKETS - 1;
+	__atomic_fetch_add(&histogram->buckets[bucket], 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&histogram->count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&histogram->sum, value, __ATOMIC_RELAXED);
+}
+
+int32_t metric_dump(void) {
+	mutex_take(snapshot_mutex, TIMEOUT_MAX);
+	uint32_t const count = metric_count;
+	uint32_t const now = millis();
+	size_t len = 0;
+	snapshot[len++] = 'd';
+	snapshot[len++] = count;
+	memcpy(snapshot + len, &now, sizeof(now));
+	len += sizeof(now);
+	for (uint32_t i = 0; i < count; i++) {
+		const metric_s_t* const metric = &metrics[i];
+		snapshot[len++] = i;
+		snapshot[len++] = metric->type;
+		if (metric->histogram != NULL) {
+			metric_histogram_s_t histogram;
+			for (size_t j = 0; j < sizeof(histogram) / sizeof(uint32_t); j++) {
+				((uint32_t*)&histogram)[j] = __atomic_load_n(&((uint32_t*)metric->histogram)[j], __ATOMIC_RELAXED);
+			}
+			memcpy(snapshot + len, &histogram, sizeof(histogram));
+			len += sizeof(histogram);
+		} else {
+			uint32_t const value = metric->sample != NULL ? metric->sample() : metric->value;
+			memcpy(snapshot + len, &value, sizeof(value));
+			len += sizeof(value);
+		}
+	}
+	bool const sent = ser_frame_write(SER_METRICS_STREAM_ID, snapshot, len);
+	mutex_give(snapshot_mutex);
+	if (!sent) {
+		errno = ENOBUFS;
+		return PROS_ERR;
+	}
+	return 1;
+}
+
+// Sends one frame per metric with 'l', its index, its type and its name, then
+// one with 'l' and the metric count
+static void metric_list(void) {
+	uint8_t frame[3 + METRIC_NAME_LENGTH];
+	uint32_t const count = metric_count;
+	for (uint32_t i = 0; i < count; i++) {
+		size_t const name_len = strlen(metrics[i].name);
+		frame[0] = 'l';
+		frame[1] = i;
+		frame[2] = metrics[i].type;
+		memcpy(frame + 3, metrics[i].name, name_len);
+		ser_frame_write(SER_METRICS_STREAM_ID, frame, 3 + name_len);
+	}
+	frame[0] = 'l';
+	frame[1] = count;
+	ser_frame_write(SER_METRICS_STREAM_ID, frame, 2);
+}
+
+// Handles a metrics request from the host (pRm)
+void metrics_command(const uint8_t* request, size_t len) {
+	switch (len ? request[0] : 0) {
+		case 'l':
+			metric_list();
+			break;
+		case 'd':
+			metric_dump();
+			break;
+		case 'a':
+			if (len != 1 + sizeof(uint32_t)) break;
+			memcpy(&emit_period, request + 1, sizeof(uint32_t));
+			next_emit = millis();
+			break;
+		default:
+			break;
+	}
+}
+
+// Called by the serial daemon each time it polls the serial line
+void metrics_emit_poll(void) {
+	if (likely(!emit_period)) return;
+	uint32_t const now = millis();
+	if ((int32_t)(now - next_emit) < 0) return;
+	// fall behind by no more than one period if a dump is held up
+	uint32_t const period = emit_period * __atomic_load_n(&emit_shed, __ATOMIC_RELAXED);
+	next_emit = now - next_emit >= period ? now + period : next_emit + period;
+	metric_dump();
+}
+
+// Called by system/overload.c
+void metrics_set_shed(uint32_t factor) {
+	__atomic_store_n(&emit_shed, factor, __ATOMIC_RELAXED);
+}
+
+/******************************************************************************/
+/**                              Kernel metrics                              **/
+/******************************************************************************/
+
+static uint32_t heap_free_sample(void) {
+	heap_stats_s_t stats;
+	heap_get_stats(&stats);
+	return stats.free_bytes;
+}
+
+static uint32_t heap_min_free_sample(void) {
+	heap_stats_s_t stats;
+	heap_get_stats(&stats);
+	return stats.min_free_bytes;
+}
+
+static uint32_t heap_largest_free_sample(void) {
+	heap_stats_s_t stats;
+	heap_get_stats(&stats);
+	return stats.largest_free_block;
+}
+
+static uint32_t daemon_cycles_sample(void) {
+	system_daemon_stats_s_t stats;
+	system_daemon_get_stats(&stats);
+	return stats.cycles;
+}
+
+static uint32_t daemon_missed_sample(void) {
+	system_daemon_stats_s_t stats;
+	system_daemon_get_stats(&stats);
+	return stats.missed_deadlines;
+}
+
+static uint32_t daemon_vdml_max_sample(void) {
+	system_daemon_stats_s_t stats;
+	system_daemon_get_stats(&stats);
+	return stats.phases[E_SYSTEM_DAEMON_PHASE_VDML].max_us;
+}
+
+static uint32_t ports_contended_sample(void) {
+	port_access_stats_s_t stats;
+	port_stats_get_daemon(&stats);
+	return stats.contended;
+}
+
+static uint32_t sout_dropped_sample(void) {
+	ser_stream_stats_s_t stats = {.stream_id = 0x74756f73};  // "sout"
+	serctl(SERCTL_GET_STREAM_STATS, &stats);
+	return stats.dropped;
+}
+
+// Called by ser_initialize()
+void metrics_initialize(void) {
+	snapshot_mutex = mutex_create_static(&snapshot_mutex_buf);
+	metric_register_sampled("heap.free", heap_free_sample);
+	metric_register_sampled("heap.min_free", heap_min_free_sample);
+	metric_register_sampled("heap.largest_free", heap_largest_free_sample);
+	metric_register_sampled("daemon.cycles", daemon_cycles_sample);
+	metric_register_sampled("daemon.missed", daemon_missed_sample);
+	metric_register_sampled("daemon.vdml_max_us", daemon_vdml_max_sample);
+	metric_register_sampled("ports.contended", ports_contended_sample);
+	metric_register_sampled("sout.dropped", sout_dropped_sample);
+	metric_register_sampled("klog.dropped", klog_get_dropped);
+	metric_register_sampled("plog.dropped", plog_get_dropped);
+}
@@ -3,7 +3,15 @@
  *
  * memory lock newlib stubs
  *
- * Contains implementations of memory-locking functions for newlib.
+ * Contains implementations of memory-locking functions for newlib, and the
+ * per-task caches of small blocks which sit in front of newlib's malloc().
+ *
+ * newlib's allocator is guarded by a recursive mutex, so a task allocating
+ * only holds up other tasks which allocate, and a higher priority task waiting
+ * on the lock lends its priority to the holder. Most allocations are small and
+ * short lived, so each task keeps a few free blocks of a handful of sizes which
+ * it can hand out and take back without taking the lock at all. The lock is
+ * only taken to refill or drain a cache, a few blocks at a time.
  *
  * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
  * All rights reserved.
@@ -13,12 +21,178 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <malloc.h>
+#include <reent.h>
+#include <stdlib.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/semphr.h"
 #include "rtos/task.h"
 
- void __malloc_lock(void) {
- 	rtos_suspend_all();
- }
+// The thread local storage pointer the cache lives in, after the two used by
+// task_notify_when_deleting.c
+#define MALLOC_CACHE_TLSP_IDX 2
+
+// The sizes of block which are cached. Requests are rounded up to one of them
+#define CACHE_CLASS_COUNT 8
+static const uint16_t cache_class_sizes[CACHE_CLASS_COUNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+// The class of each request size in steps of 16 bytes, rounded up
+static const uint8_t cache_request_classes[] = {0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+#define CACHE_MAX_REQUEST 256
+// Blocks which newlib made much bigger than asked for aren't worth caching
+#define CACHE_MAX_USABLE 288
+// The most blocks a task keeps of each class, and how many are moved at once
+#define CACHE_CLASS_MAX_BLOCKS 8
+#define CACHE_BATCH 4
+
+typedef struct cached_block {
+	struct cached_block* next;
+} cached_block_s_t;
+
+typedef struct malloc_cache {
+	cached_block_s_t* blocks[CACHE_CLASS_COUNT];
+	uint8_t counts[CACHE_CLASS_COUNT];
+} malloc_cache_s_t;
+
+static static_sem_s_t malloc_mutex_buf;
+static sem_t malloc_mutex;
+
+void malloc_lock_initialize(void) {
+	malloc_mutex = xSemaphoreCreateRecursiveMutexStatic(&malloc_mutex_buf);
+}
+
+void __malloc_lock(struct _reent* r) {
+	// Nothing else runs before the scheduler starts
+	int32_t state = xTaskGetSchedulerState();
+	if (state == taskSCHEDULER_NOT_STARTED) return;
+	// A task which suspended the scheduler can't wait for another one to finish allocating
+	configASSERT(state == taskSCHEDULER_RUNNING || xQueueGetMutexHolder(malloc_mutex) == NULL ||
+	             xQueueGetMutexHolder(malloc_mutex) == task_get_current());
+	xQueueTakeMutexRecursive(malloc_mutex, state == taskSCHEDULER_RUNNING ? portMAX_DELAY : 0);
+}
+
+// Takes the lock only if that doesn't mean waiting, for the idle task which must never block
+int32_t malloc_lock_try(void) {
+	if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) return pdTRUE;
+	return xQueueTakeMutexRecursive(malloc_mutex, 0);
+}
+
+void __malloc_unlock(struct _reent* r) {
+	if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) return;
+	xQueueGiveMutexRecursive(malloc_mutex);
+}
+
+static malloc_cache_s_t* malloc_cache_get(void) {
+	if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) return NULL;
+	malloc_cache_s_t* cache = pvTaskGetThreadLocalStoragePointer(NULL, MALLOC_CACHE_TLSP_IDX);
+	if (cache == NULL) {
+		cache = _calloc_r(_REENT, 1, sizeof(*cache));
+		vTaskSetThreadLocalStoragePointer(NULL, MALLOC_CACHE_TLSP_IDX, cache);
+	}
+	return cache;
+}
+
+// Only the task which owns a cache touches it, so it isn't locked
+static void malloc_cache_refill(malloc_cache_s_t* cache, uint8_t class) {
+	__malloc_lock(_REENT);
+	for (size_t i = 0; i < CACHE_BATCH; i++) {
+		cached_block_s_t* block = _malloc_r(_REENT, cache_class_sizes[class]);
+		if (block == NULL) break;
+		block->next = cache->blocks[class];
+		cache->blocks[class] = block;
+		cache->counts[class]++;
+	}
+	__malloc_unlock(_REENT);
+}
+
+static void malloc_cache_drain(malloc_cache_s_t* cache, uint8_t class, size_t count) {
+	__malloc_lock(_REENT);
+	for (size_t i = 0; i < count && cache->blocks[class] != NULL; i++) {
+		cached_block_s_t* block = cache->blocks[class];
+		cache->blocks[class] = block->next;
+		cache->counts[class]--;
+		_free_r(_REENT, block);
+	}
+	__malloc_unlock(_REENT);
+}
+
+static void* malloc_cached(size_t size) {
+	malloc_cache_s_t* cache;
+	if (size <= CACHE_MAX_REQUEST && (cache = malloc_cache_get()) != NULL) {
+		uint8_t class = cache_request_classes[(size + 15) >> 4];
+		if (cache->blocks[class] == NULL) malloc_cache_refill(cache, class);
+		cached_block_s_t* block = cache->blocks[class];
+		if (block != NULL) {
+			cache->blocks[class] = block->next;
+			cache->counts[class]--;
+			return block;
+		}
+	}
+	return _malloc_r(_REENT, size);
+}
+
+void* malloc(size_t size) {
+	void* ptr = malloc_cached(size);
+#if (configUSE_HEAP_TRACKING == 1)
+	heap_track_alloc(ptr, size, __builtin_return_address(0), true);
+#endif
+	return ptr;
+}
+
+#if (configUSE_HEAP_TRACKING == 1)
+// Overridden so that the blocks they hand out are tracked as well, and blocks
+// freed by realloc() stop being tracked
+
+void* calloc(size_t count, size_t size) {
+	void* ptr = _calloc_r(_REENT, count, size);
+	heap_track_alloc(ptr, count * size, __builtin_return_address(0), true);
+	return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+	void* new_ptr = _realloc_r(_REENT, ptr, size);
+	if (new_ptr != NULL || size == 0) {
+		heap_track_free(ptr);
+		heap_track_alloc(new_ptr, size, __builtin_return_address(0), true);
+	}
+	return new_ptr;
+}
+#endif
+
+void free(void* ptr) {
+	if (ptr == NULL) return;
+#if (configUSE_HEAP_TRACKING == 1)
+	heap_track_free(ptr);
+#endif
+	// Blocks are cached by how big newlib made them, so they may come from any task or from realloc()
+	size_t usable = malloc_usable_size(ptr);
+	malloc_cache_s_t* cache;
+	if (usable >= cache_class_sizes[0] && usable <= CACHE_MAX_USABLE && (cache = malloc_cache_get()) != NULL) {
+		uint8_t class = CACHE_CLASS_COUNT - 1;
+		while (cache_class_sizes[class] > usable) class--;
+		if (cache->counts[class] >= CACHE_CLASS_MAX_BLOCKS) malloc_cache_drain(cache, class, CACHE_BATCH);
+		cached_block_s_t* block = ptr;
+		block->next = cache->blocks[class];
+		cache->blocks[class] = block;
+		cache->counts[class]++;
+		return;
+	}
+	_free_r(_REENT, ptr);
+}
 
- void __malloc_unlock(void) {
- 	rtos_resume_all();
- }
+// Called when a task is deleted or restarted, once it can no longer run
+void malloc_cache_release(task_t task) {
+	malloc_cache_s_t* cache = pvTaskGetThreadLocalStoragePointer(task, MALLOC_CACHE_TLSP_IDX);
+	if (cache == NULL) return;
+	vTaskSetThreadLocalStoragePointer(task, MALLOC_CACHE_TLSP_IDX, NULL);
+	__malloc_lock(_REENT);
+	for (uint8_t class = 0; class < CACHE_CLASS_COUNT; class++) {
+		while (cache->blocks[class] != NULL) {
+			cached_block_s_t* block = cache->blocks[class];
+			cache->blocks[class] = block->next;
+			_free_r(_REENT, block);
+		}
+	}
+	_free_r(_REENT, cache);
+	__malloc_unlock(_REENT);
+}
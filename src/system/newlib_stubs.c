@@ -15,12 +15,17 @@
  */
 
 #include <errno.h>
+#include <malloc.h>
 #include <stdint.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 #include "rtos/task.h"
 #include "v5_api.h"
 
+// NOTE: pros/rtos.h can't be included alongside rtos/task.h
+uint64_t micros(void);
+
 void _exit(int status) {
 	// TODO: print status code, maybe backtrace as well
 	while (1) {
@@ -33,3 +38,24 @@ void _exit(int status) {
 void __sync_synchronize(void) {
 	__sync_synchronize();
 }
+
+// Backs gettimeofday(), and with it time() and the timeouts of the gthreads
+// backend, on the same timebase as std::chrono's clocks. The time counts from when the program started
+int _gettimeofday(struct timeval* tv, void* tz) {
+	if (tv != NULL) {
+		uint64_t const now = micros();
+		tv->tv_sec = now / 1000000;
+		tv->tv_usec = now % 1000000;
+	}
+	return 0;
+}
+
+// newlib's aligned_alloc(), and with it the aligned operator new, is built on
+// posix_memalign() without providing it, so it's built on memalign() here
+int posix_memalign(void** memptr, size_t alignment, size_t size) {
+	if (alignment < sizeof(void*) || (alignment & (alignment - 1))) return EINVAL;
+	void* const ptr = memalign(alignment, size);
+	if (ptr == NULL) return ENOMEM;
+	*memptr = ptr;
+	return 0;
+}
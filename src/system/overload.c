@@ -0,0 +1,169 @@
+/**
+ * \file system/overload.c
+ *
+ * Sheds the kernel's optional work while the CPU is overloaded
+ *
+ * The task CPU statistics hand every task's share of each one second window
+ * to overload_account(), and call overload_evaluate() once the window is
+ * done, both from the timer task. The policy picks a level from the idle
+ * share, and each level is applied through the shed setters of the modules
+ * which own the work, so turning the shedding off gives each of them back
+ * exactly the settings the program chose.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+
+// from klog.c, dev/plog.c, display.c, vdml_motors.c and metrics.c
+extern void klog_set_shed_floor(klog_level_e_t level);
+extern void plog_set_shed_ratio(uint32_t ratio);
+extern uint32_t plog_get_shed(void);
+extern void display_set_shed_mode(display_refresh_mode_e_t mode);
+extern void motor_telemetry_set_shed(uint32_t factor);
+extern void metrics_set_shed(uint32_t factor);
+
+// What each level sheds: the lowest klog level kept, 1 in how many plog()
+// messages is kept, the slowest the display may refresh, and how many times
+// less often telemetry is sent
+typedef struct overload_shed {
+	klog_level_e_t klog_floor;
+	uint32_t plog_ratio;
+	display_refresh_mode_e_t display_mode;
+	uint32_t telemetry_factor;
+} overload_shed_s_t;
+
+static const overload_shed_s_t sheds[E_OVERLOAD_SEVERE + 1] = {
+    [E_OVERLOAD_NONE] = {E_KLOG_DEBUG, 1, E_DISPLAY_REFRESH_FULL, 1},
+    [E_OVERLOAD_DEGRADED] = {E_KLOG_WARNING, 2, E_DISPLAY_REFRESH_REDUCED, 2},
+    [E_OVERLOAD_SEVERE] = {E_KLOG_ERROR, 8, E_DISPLAY_REFRESH_FROZEN, 4}};
+
+// Only touched by the timer task
+static uint32_t class_sums[E_TASK_CLASSES];
+static uint32_t calm_windows;  // samples in a row with room to step down a level
+
+// Changed by other tasks with the scheduler suspended
+static overload_policy_s_t policy;
+static bool policy_set;
+static bool policy_changed;
+static overload_stats_s_t stats;
+
+// Called by cpu_stats_sample() for each task, with its base priority and its
+// share of the window in hundredths of a percent
+void overload_account(uint32_t priority, uint32_t usage) {
+	task_class_e_t class;
+	if (priority == 0) {
+		class = E_TASK_CLASS_IDLE;
+	} else if (priority < TASK_PRIORITY_DEFAULT) {
+		class = E_TASK_CLASS_LOW;
+	} else if (priority == TASK_PRIORITY_DEFAULT) {
+		class = E_TASK_CLASS_DEFAULT;
+	} else {
+		class = E_TASK_CLASS_HIGH;
+	}
+	class_sums[class] += usage;
+}
+
+static void overload_apply(overload_level_e_t level, uint32_t actions) {
+	const overload_shed_s_t* const none = &sheds[E_OVERLOAD_NONE];
+	const overload_shed_s_t* const shed = &sheds[level];
+	bool const logs = actions & OVERLOAD_SHED_LOGS;
+	bool const telemetry = actions & OVERLOAD_SHED_TELEMETRY;
+	klog_set_shed_floor(logs ? shed->klog_floor : none->klog_floor);
+	plog_set_shed_ratio(logs ? shed->plog_ratio : none->plog_ratio);
+	display_set_shed_mode(actions & OVERLOAD_SHED_DISPLAY ? shed->display_mode : none->display_mode);
+	motor_telemetry_set_shed(telemetry ? shed->telemetry_factor : none->telemetry_factor);
+	metrics_set_shed(telemetry ? shed->telemetry_factor : none->telemetry_factor);
+}
+
+// Picks the level for a sample with the given idle share, in hundredths of a
+// percent
+static overload_level_e_t overload_next_level(const overload_policy_s_t* const p, overload_level_e_t level,
+                                              uint32_t idle) {
+	double const percent = idle / 100.0;
+	overload_level_e_t target = E_OVERLOAD_NONE;
+	if (percent < p->severe_idle) {
+		target = E_OVERLOAD_SEVERE;
+	} else if (percent < p->degraded_idle) {
+		target = E_OVERLOAD_DEGRADED;
+	}
+	if (target >= level) {
+		calm_windows = 0;
+		return target;
+	}
+	// Step down a level once there has been room for long enough
+	double const threshold = level == E_OVERLOAD_SEVERE ? p->severe_idle : p->degraded_idle;
+	if (percent < threshold + p->restore_margin) {
+		calm_windows = 0;
+		return level;
+	}
+	if (++calm_windows < p->restore_windows) return level;
+	calm_windows = 0;
+	return level - 1;
+}
+
+// Called by cpu_stats_sample() once every task in the window is accounted
+void overload_evaluate(void) {
+	rtos_suspend_all();
+	overload_policy_s_t const p = policy;
+	bool const active = policy_set;
+	bool const changed = policy_changed;
+	policy_changed = false;
+	overload_level_e_t const level = stats.level;
+	rtos_resume_all();
+
+	overload_level_e_t next = E_OVERLOAD_NONE;
+	if (active) next = overload_next_level(&p, changed ? E_OVERLOAD_NONE : level, class_sums[E_TASK_CLASS_IDLE]);
+	if (changed || next != level) overload_apply(next, active ? p.actions : 0);
+
+	rtos_suspend_all();
+	for (int i = 0; i < E_TASK_CLASSES; i++) stats.class_usage[i] = class_sums[i] / 100.0;
+	stats.windows[next]++;
+	if (next != level) stats.changes++;
+	stats.level = next;
+	stats.logs_shed = plog_get_shed();
+	rtos_resume_all();
+	memset(class_sums, 0, sizeof(class_sums));
+
+	if (next != level && active && p.on_change != NULL) p.on_change(next, p.param);
+}
+
+int32_t overload_set_policy(const overload_policy_s_t* const new_policy) {
+	if (new_policy != NULL &&
+	    (new_policy->degraded_idle < 0 || new_policy->degraded_idle > 100 || new_policy->severe_idle < 0 ||
+	     new_policy->severe_idle > new_policy->degraded_idle || new_policy->restore_margin < 0 ||
+	     new_policy->restore_windows == 0)) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Applied by the timer task with the next sample, starting from no shedding
+	rtos_suspend_all();
+	if (new_policy != NULL) policy = *new_policy;
+	policy_set = new_policy != NULL;
+	policy_changed = true;
+	rtos_resume_all();
+	return 1;
+}
+
+overload_level_e_t overload_get_level(void) {
+	return stats.level;
+}
+
+int32_t overload_get_stats(overload_stats_s_t* const out) {
+	if (out == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*out = stats;
+	rtos_resume_all();
+	return 1;
+}
@@ -0,0 +1,248 @@
+/**
+ * \file system/profiler.c
+ *
+ * Sampling profiler
+ *
+ * While the profiler runs, every tick interrupt records where the code it
+ * interrupted was: the return address FreeRTOS_IRQ_Handler pushed on the IRQ
+ * stack and, if asked for, the return addresses unwound from there with the
+ * interrupted task's sp and lr. Samples of the same addresses in the same task
+ * are counted in one bucket of an open addressed hash table, so the table ends
+ * up as a histogram which a host tool can resolve into a flat profile or a
+ * flame graph.
+ *
+ * The buckets are only touched by the tick interrupt while the profiler runs,
+ * and only replaced or sent while it doesn't.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "rtos/FreeRTOS.h"
+#include "rtos/task.h"
+#include "rtos/tcb.h"
+
+// NOTE: kapi.h can't be included alongside rtos/task.h, so we just prototype
+//       what we need from it here
+bool ser_frame_write(uint32_t stream_id, const void* data, size_t len);
+#define PROS_ERR (INT32_MAX)
+#define SER_PROFILE_STREAM_ID 0x666f7270
+#define PROFILER_MAX_DEPTH 8
+
+// from system/unwind.c
+uint32_t unwind_backtrace(const uint32_t* regs, uint32_t* pcs, uint32_t max);
+
+#define PROFILER_FORMAT_VERSION 1
+#define PROFILER_MAX_PROBES 16
+#define PROFILER_FRAME_WORDS 120
+
+#define MODE_MASK 0x1f
+#define USR_MODE 0x10
+#define SYS_MODE 0x1f
+#define R_SP 13
+#define R_PC 15
+
+enum { E_PROFILE_RECORD_HEADER = 0, E_PROFILE_RECORD_TASK, E_PROFILE_RECORD_BUCKETS, E_PROFILE_RECORD_END };
+
+volatile uint32_t profiler_running;
+
+// Each bucket is its sample count, the task number and depth addresses, with
+// 0s after the end of a shorter trace. A count of 0 marks a free bucket
+static uint32_t* buckets;
+static uint32_t capacity;  // Always a power of two
+static uint32_t depth;
+static uint32_t samples;
+static uint32_t dropped;  // samples which found no free bucket
+
+static inline uint32_t bucket_words(void) {
+	return 2 + depth;
+}
+
+// Reads the IRQ mode stack pointer, which the outermost interrupt left pointing
+// at the SPSR and return address it pushed, see FreeRTOS_IRQ_Handler in portASM.S
+static inline const uint32_t* irq_frame(void) {
+	const uint32_t* sp;
+	uint32_t cpsr;
+	asm volatile(
+	    "mrs %1, cpsr\n"
+	    "cpsid i\n"
+	    "cps #0x12\n"
+	    "mov %0, sp\n"
+	    "msr cpsr_c, %1\n"
+	    : "=&r"(sp), "=&r"(cpsr)
+	    :
+	    : "memory");
+	return sp;
+}
+
+// called by FreeRTOS_Tick_Handler() in port.c while profiler_running is set
+void profiler_sample(void) {
+	extern volatile uint32_t ulPortInterruptNesting;
+	// Only the outermost interrupt's frame is at the top of the IRQ stack. The
+	// tick has the lowest priority, so it should always be the outermost
+	if (ulPortInterruptNesting != 1) return;
+
+	const uint32_t* const frame = irq_frame();
+	uint32_t pcs[PROFILER_MAX_DEPTH] = {0};
+	pcs[0] = frame[1];
+	uint32_t const mode = frame[0] & MODE_MASK;
+	if (depth > 1 && (mode == SYS_MODE || mode == USR_MODE)) {
+		uint32_t regs[16] = {0};
+		regs[R_PC] = frame[1];
+		// a task's sp and lr are in the banked user registers
+		asm volatile("stm %0, {r13,r14}^" : : "r"(regs + R_SP) : "memory");
+		unwind_backtrace(regs, pcs, depth);
+	}
+
+	uint32_t const task = pxCurrentTCB != NULL ? pxCurrentTCB->uxTCBNumber : 0;
+	uint32_t hash = task * 0x9E3779B1UL;
+	for (uint32_t i = 0; i < depth; i++) {
+		hash = (hash ^ pcs[i]) * 0x9E3779B1UL;
+	}
+	hash ^= hash >> 16;
+
+	for (uint32_t probe = 0; probe < PROFILER_MAX_PROBES; probe++) {
+		uint32_t* const bucket = buckets + ((hash + probe) & (capacity - 1)) * bucket_words();
+		if (bucket[0] == 0) {
+			bucket[1] = task;
+			memcpy(bucket + 2, pcs, depth * sizeof(uint32_t));
+		} else if (bucket[1] != task || memcmp(bucket + 2, pcs, depth * sizeof(uint32_t))) {
+			continue;
+		}
+		bucket[0]++;
+		samples++;
+		return;
+	}
+	dropped++;
+}
+
+void profiler_stop(void) {
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	profiler_running = 0;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+int32_t profiler_start(uint32_t bucket_count, uint32_t trace_depth) {
+	if (bucket_count == 0 || trace_depth == 0 || trace_depth > PROFILER_MAX_DEPTH) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// Round down to a power of two so that the bucket index is a mask
+	bucket_count = 1UL << (31 - __builtin_clz(bucket_count));
+
+	profiler_stop();
+	size_t const size = bucket_count * (2 + trace_depth) * sizeof(uint32_t);
+	if (bucket_count != capacity || trace_depth != depth) {
+		kfree(buckets);
+		buckets = kmalloc(size);
+		capacity = buckets != NULL ? bucket_count : 0;
+		depth = buckets != NULL ? trace_depth : 0;
+	}
+	if (buckets == NULL) {
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+	memset(buckets, 0, size);
+
+	uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+	samples = 0;
+	dropped = 0;
+	profiler_running = 1;
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+	return 1;
+}
+
+static bool profiler_send_tasks(void) {
+	uint32_t count = task_get_count() + 4;
+	TaskStatus_t* statuses = kmalloc(count * sizeof(*statuses));
+	if (statuses == NULL) return false;
+	count = uxTaskGetSystemStateExt(statuses, count, NULL, pdFALSE);
+
+	bool ret = true;
+	for (uint32_t i = 0; ret && i < count; i++) {
+		struct __attribute__((packed)) {
+			uint8_t kind;
+			uint8_t priority;
+			uint16_t task;
+			char name[configMAX_TASK_NAME_LEN];
+		} record = {.kind = E_PROFILE_RECORD_TASK,
+		            .priority = statuses[i].uxCurrentPriority,
+		            .task = statuses[i].xTaskNumber};
+		size_t len = strnlen(statuses[i].pcTaskName, configMAX_TASK_NAME_LEN);
+		memcpy(record.name, statuses[i].pcTaskName, len);
+		ret = ser_frame_write(SER_PROFILE_STREAM_ID, &record, offsetof(__typeof__(record), name) + len);
+	}
+	kfree(statuses);
+	return ret;
+}
+
+int32_t profiler_dump(void) {
+	profiler_stop();
+	if (buckets == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+
+	uint32_t used = 0;
+	for (uint32_t i = 0; i < capacity; i++) {
+		if (buckets[i * bucket_words()] != 0) used++;
+	}
+	struct __attribute__((packed)) {
+		uint8_t kind;
+		uint8_t version;
+		uint8_t depth;
+		uint8_t reserved;
+		uint32_t bucket_count;
+		uint32_t samples;
+		uint32_t dropped;
+		uint32_t period_us;
+	} header = {.kind = E_PROFILE_RECORD_HEADER,
+	            .version = PROFILER_FORMAT_VERSION,
+	            .depth = depth,
+	            .bucket_count = used,
+	            .samples = samples,
+	            .dropped = dropped,
+	            .period_us = 1000000 / configTICK_RATE_HZ};
+	if (!ser_frame_write(SER_PROFILE_STREAM_ID, &header, sizeof(header)) || !profiler_send_tasks()) {
+		errno = EIO;
+		return PROS_ERR;
+	}
+
+	struct __attribute__((packed)) {
+		uint8_t kind;
+		uint8_t reserved;
+		uint16_t count;
+		uint32_t words[PROFILER_FRAME_WORDS];
+	} frame = {.kind = E_PROFILE_RECORD_BUCKETS};
+	uint32_t const per_frame = PROFILER_FRAME_WORDS / bucket_words();
+	for (uint32_t i = 0; i < capacity;) {
+		frame.count = 0;
+		for (; i < capacity && frame.count < per_frame; i++) {
+			const uint32_t* const bucket = buckets + i * bucket_words();
+			if (bucket[0] == 0) continue;
+			memcpy(frame.words + frame.count * bucket_words(), bucket, bucket_words() * sizeof(uint32_t));
+			frame.count++;
+		}
+		if (frame.count == 0) break;
+		size_t len = offsetof(__typeof__(frame), words) + frame.count * bucket_words() * sizeof(uint32_t);
+		if (!ser_frame_write(SER_PROFILE_STREAM_ID, &frame, len)) {
+			errno = EIO;
+			return PROS_ERR;
+		}
+	}
+
+	const uint8_t end = E_PROFILE_RECORD_END;
+	if (!ser_frame_write(SER_PROFILE_STREAM_ID, &end, sizeof(end))) {
+		errno = EIO;
+		return PROS_ERR;
+	}
+	return used;
+}
@@ -18,6 +18,7 @@
 #include "rtos/semphr.h"
 #include "rtos/task.h"
 #include "rtos/tcb.h"
+#include "system/optimizers.h"
 
 #include "v5_api.h"
 #include "v5_color.h"
@@ -57,8 +58,23 @@ void rtos_initialize() {
 
 	vPortInstallFreeRTOSVectorTable();
 
+	void malloc_lock_initialize(void);
+	malloc_lock_initialize();
+
 	void task_notify_when_deleting_init();
 	task_notify_when_deleting_init();
+
+	void hrtimer_initialize(void);
+	hrtimer_initialize();
+
+	void timer_wheel_initialize(void);
+	timer_wheel_initialize();
+
+	void task_cpu_stats_initialize(void);
+	task_cpu_stats_initialize();
+
+	void task_stack_stats_initialize(void);
+	task_stack_stats_initialize();
 }
 
 extern void FreeRTOS_Tick_Handler(void);
@@ -71,8 +87,14 @@ void rtos_tick_interrupt_clear() {
 	vexSystemTimerClearInterrupt();
 }
 
-void vApplicationFPUSafeIRQHandler(uint32_t ulICCIAR) {
-	vexSystemApplicationIRQHandler(ulICCIAR);
+__pros_fast void vApplicationFPUSafeIRQHandler(uint32_t ulICCIAR) {
+	// The global timer drives task_delay_until_us(), everything else belongs to VEXos
+	if ((ulICCIAR & 0x3FF) == 27) {
+		void hrtimer_irq_handler(void);
+		hrtimer_irq_handler();
+	} else {
+		vexSystemApplicationIRQHandler(ulICCIAR);
+	}
 }
 
 void vInitialiseTimerForRunTimeStats(void) {
@@ -108,19 +130,10 @@ void vApplicationStackOverflowHook(task_t pxTask, char* pcTaskName) {
 }
 
 void vApplicationIdleHook(void) {
-	volatile size_t xFreeHeapSpace;
-
-	// This is just a trivial example of an idle hook.  It is called on each cycle
-	// of the idle task.  It must *NOT* attempt to block.  In this case the idle
-	// task just queries the amount of FreeRTOS heap that remains.  See the memory
-	// management section on the http://www.FreeRTOS.org web site for memory
-	// management options.  If there is a lot of heap memory free then the
-	// configTOTAL_HEAP_SIZE value in FreeRTOSConfig.h can be reduced to free up
-	// RAM.
-	xFreeHeapSpace = xPortGetFreeHeapSize();
-
-	// Remove compiler warning about xFreeHeapSpace being set but never used.
-	(void)xFreeHeapSpace;
+	// Called on each cycle of the idle task, which must *NOT* block, after
+	// the tasks which deleted themselves have been freed
+	void idle_work_run(void);
+	idle_work_run();
 }
 
 void vAssertCalled(const char* pcFile, unsigned long ulLine) {
@@ -192,74 +205,3 @@ void vApplicationGetTimerTaskMemory(static_task_s_t** ppxTimerTaskTCBBuffer, tas
 	*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
 }
 #endif
-
-/******************************************************************************/
-/**                      Replacements for mem functions                      **/
-/**                                                                          **/
-/** See https://goo.gl/cHUA9b for more details                               **/
-/** Unsure if necessary due to Arm's newlib optimization                     **/
-/******************************************************************************/
-#if 0
-#if (configUSE_TASK_FPU_SUPPORT == 2)
-void* memcpy(void* restrict out, void const* restrict in, size_t n) {
-  // modified GNU algorithm to copy a word at a time
-  uint32_t* restrict lout;
-  uint32_t const* restrict lin;
-
-  if (!((uint32_t)in & 0xFFFFFFFC) && !((uint32_t)out & 0xFFFFFFFC)) {
-    while(n >= sizeof(unt32_t)) {
-      *lout++ = *lin++;
-      n -= sizeof(uint32_t);
-    }
-  }
-}
-void* memcpy(void *pvDest, void const *pvSource, size_t len) {
-  long *plDst = (long *)pvDest;
-  long const *plSrc = (long const *)pvSource;
-
-  if (!((uint32_t)pvSource & 0xFFFFFFFC) && !((uint32_t)pvDest & 0xFFFFFFFC)) {
-    while (len >= 4) {
-      *plDst++ = *plSrc++;
-      len -= 4;
-    }
-  }
-
-  char *pcDst = (char *)plDst;
-  char const *pcSrc = (char const *)plSrc;
-
-  while (len--)
-    *pcDst++ = *pcSrc++;
-
-  return (pvDest);
-}
-
-/*-----------------------------------------------------------*/
-
-void *memset(void *pvDest, int iValue, size_t ulBytes) {
-  volatile unsigned char *pcDest = (unsigned char *)pvDest;
-
-  if (ulBytes > 0) {
-    do {
-      *pcDest++ = (unsigned char)iValue;
-    } while (--ulBytes != 0);
-  }
-
-  return pvDest;
-}
-
-/*-----------------------------------------------------------*/
-
-int memcmp(const void *pvMem1, const void *pvMem2, size_t ulBytes) {
-  const unsigned char *pucMem1 = pvMem1, *pucMem2 = pvMem2;
-  size_t x;
-
-  for (x = 0; x < ulBytes; x++) {
-    if (pucMem1[x] != pucMem2[x]) {
-      break;
-    }
-  }
-
-  return ulBytes - x;
-}
-#endif
-#endif
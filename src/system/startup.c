@@ -16,16 +16,38 @@
 #include <stdio.h>
 
 #include "kapi.h"
+#include "system/cycles.h"
+#include "system/hot.h"
 #include "v5_api.h"
 
 extern void rtos_initialize();
+extern void klog_initialize(void);
 extern void vfs_initialize();
+extern void crash_dump_initialize(void);
 extern void system_daemon_initialize();
 // extern void graphical_context_daemon_initialize(void);
 extern void display_initialize(void);
 extern void rtos_sched_start();
 extern void vdml_initialize();
 extern void invoke_install_hot_table();
+extern bool fast_memory_lock(void);
+
+// Boot phases timed by pros_init, reported by boot_report_times()
+enum boot_phase {
+	E_BOOT_RTOS = 0,
+	E_BOOT_VFS,
+	E_BOOT_VDML,
+	E_BOOT_DISPLAY,
+	E_BOOT_SYSTEM_DAEMON,
+	E_BOOT_HOT_TABLE,
+	E_BOOT_PHASES
+};
+static const char* const boot_phase_names[E_BOOT_PHASES] = {"rtos",    "vfs",           "vdml",
+                                                            "display", "system daemon", "hot table"};
+static uint32_t boot_start;
+static uint32_t boot_phase_ends[E_BOOT_PHASES];  // micros() when each phase finished
+static uint32_t boot_sched_start;
+static bool boot_fast_locked;
 
 // XXX: pros_init happens inside __libc_init_array, and before any global
 // C++ constructors are invoked. This is accomplished by instructing
@@ -34,24 +56,65 @@ extern void invoke_install_hot_table();
 // from 0-~65k. The first 0-100 priorities are reserved for language
 // implementation.
 __attribute__((constructor(101))) static void pros_init(void) {
+	boot_start = micros();
+
 	rtos_initialize();
+	klog_initialize();
+	boot_phase_ends[E_BOOT_RTOS] = micros();
 
 	vfs_initialize();
+	// writes out a crash dump from the last run, once the uSD driver is ready
+	crash_dump_initialize();
+	boot_phase_ends[E_BOOT_VFS] = micros();
 
 	vdml_initialize();
+	boot_phase_ends[E_BOOT_VDML] = micros();
 
 	display_initialize();
+	boot_phase_ends[E_BOOT_DISPLAY] = micros();
 
 	// NOTE: this function should be called after all other initialize
 	// functions. for an example of what could happen if this is not
 	// the case, see
 	// https://github.com/purduesigbots/pros/pull/144/#issuecomment-496901942
 	system_daemon_initialize();
+	boot_phase_ends[E_BOOT_SYSTEM_DAEMON] = micros();
 
 	invoke_install_hot_table();
+	boot_phase_ends[E_BOOT_HOT_TABLE] = micros();
+}
+
+void boot_report_times(void) {
+	uint32_t now = micros();
+	uint32_t phase_start = boot_start;
+	klog(E_KLOG_BOOT, E_KLOG_INFO, "pros_init started at %lu us", boot_start);
+	for (int i = 0; i < E_BOOT_PHASES; i++) {
+		klog(E_KLOG_BOOT, E_KLOG_INFO, "%-13s %7lu us", boot_phase_names[i], boot_phase_ends[i] - phase_start);
+		phase_start = boot_phase_ends[i];
+	}
+	// Between the end of pros_init and the scheduler are the user's global constructors
+	klog(E_KLOG_BOOT, E_KLOG_INFO, "constructors  %7lu us", boot_sched_start - phase_start);
+	// The hot image's .bss and constructors are part of the hot table phase.
+	// addr2line on the hot image's elf turns the address into the constructor's
+	// symbol, e.g. _GLOBAL__sub_I_drive for the globals in drive.cpp
+	if (HOT_TABLE->init_stats.ctor_count || HOT_TABLE->init_stats.bss_bytes) {
+		klog(E_KLOG_BOOT, E_KLOG_INFO, "hot .bss %lu bytes cleared in %lu us", HOT_TABLE->init_stats.bss_bytes,
+		     HOT_TABLE->init_stats.bss_cycles / CPU_CYCLES_PER_US);
+		klog(E_KLOG_BOOT, E_KLOG_INFO, "hot constructors: %lu in %lu us, slowest at 0x%08lx took %lu us",
+		     HOT_TABLE->init_stats.ctor_count, HOT_TABLE->init_stats.ctor_cycles / CPU_CYCLES_PER_US,
+		     (uint32_t)(uintptr_t)HOT_TABLE->init_stats.slowest_ctor,
+		     HOT_TABLE->init_stats.slowest_ctor_cycles / CPU_CYCLES_PER_US);
+	}
+	if (boot_get_options() & PROS_BOOT_LOCK_FAST) {
+		klog(E_KLOG_BOOT, E_KLOG_INFO, "__pros_fast sections %s",
+		     boot_fast_locked ? "locked into L2" : "not locked, L2 way taken");
+	}
+	klog(E_KLOG_BOOT, E_KLOG_INFO, "initialize() starting at %lu us", now);
 }
 
 int main() {
+	if (boot_get_options() & PROS_BOOT_LOCK_FAST) boot_fast_locked = fast_memory_lock();
+	boot_sched_start = micros();
 	rtos_sched_start();
 
 	vexDisplayPrintf(10, 60, 1, "failed to start scheduler\n");
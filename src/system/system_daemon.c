@@ -11,21 +11,32 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include "kapi.h"
+#include "system/cycles.h"
 #include "system/optimizers.h"
 #include "system/user_functions.h"
 #include "v5_api.h"
 
 extern void vdml_background_processing();
+extern void vdml_snapshot_capture(void);
+extern void vdml_dispatch_updates(void);
+extern void registry_dispatch_changes();
+extern void registry_config_apply(uint32_t ports);
+extern void motor_dispatch_faults(void);
+extern void watchdog_check(void);
+extern void display_touch_poll(void);
 
 extern void port_mutex_take_all();
 extern void port_mutex_give_all();
 
-static task_stack_t competition_task_stack[TASK_STACK_DEPTH_DEFAULT];
+static task_stack_t competition_task_stack[KERNEL_COMPETITION_TASK_STACK_DEPTH];
 static static_task_s_t competition_task_buffer;
 static task_t competition_task;
 
-static task_stack_t system_daemon_task_stack[TASK_STACK_DEPTH_DEFAULT];
+static task_stack_t system_daemon_task_stack[KERNEL_SYSTEM_DAEMON_STACK_DEPTH];
 static static_task_s_t system_daemon_task_buffer;
 static task_t system_daemon_task;
 
@@ -37,30 +48,236 @@ static void _competition_initialize_task(void* ign);
 static void _initialize_task(void* ign);
 static void _system_daemon_task(void* ign);
 
-enum state_task { E_OPCONTROL_TASK = 0, E_AUTON_TASK, E_DISABLED_TASK, E_COMP_INIT_TASK };
-
 char task_names[4][32] = {"User Operator Control (PROS)", "User Autonomous (PROS)", "User Disabled (PROS)",
                           "User Comp. Init. (PROS)"};
 task_fn_t task_fns[4] = {_opcontrol_task, _autonomous_task, _disabled_task, _competition_initialize_task};
 
+// A mode registered with competition_handler_register(). handler and param
+// are only changed with the scheduler suspended, so the daemon and the
+// handler's task never see half of an update
+typedef struct competition_handler {
+	task_t task;
+	task_fn_t handler;
+	void* param;
+	uint32_t priority;
+	volatile bool running;  // Set when the task is notified, until the handler returns
+} competition_handler_s_t;
+
+static competition_handler_s_t* competition_handlers[E_COMPETITION_MODE_COUNT];
+// The mode whose user code was last started, and whether it runs in a handler's task
+static competition_mode_e_t competition_mode = E_COMPETITION_MODE_OPCONTROL;
+static bool competition_mode_handled;
+// Whether competition_task is still in a user function, rather than having returned and deleted itself
+static volatile bool competition_task_running;
+
+// When the daemon noticed the last mode change, until the user code records how long it took to start
+static uint32_t start_cycles;
+static bool start_pending;
+
 extern void ser_output_flush(void);
 
+__pros_fast_bss static system_daemon_stats_s_t daemon_stats;
+static const uint32_t daemon_histogram_bounds[SYSTEM_DAEMON_HISTOGRAM_BUCKETS] = SYSTEM_DAEMON_HISTOGRAM_BOUNDS;
+
+// records the duration of a phase that started at *start and restarts *start
+static inline void record_phase(system_daemon_phase_e_t phase, uint32_t* start) {
+	uint32_t now = cycle_counter_get();
+	uint32_t us = (now - *start) / CPU_CYCLES_PER_US;
+	*start = now;
+	system_daemon_phase_stats_s_t* stats = &daemon_stats.phases[phase];
+	stats->last_us = us;
+	if (us > stats->max_us) stats->max_us = us;
+	int bucket = 0;
+	while (us >= daemon_histogram_bounds[bucket] && bucket < SYSTEM_DAEMON_HISTOGRAM_BUCKETS - 1) bucket++;
+	stats->histogram[bucket]++;
+}
+
 // does the basic background operations that need to occur every 2ms
 static inline void do_background_operations() {
-	port_mutex_take_all();
+	uint32_t start = cycle_counter_get();
+	// Serial output doesn't touch the smart ports, so flush it before taking them
 	ser_output_flush();
+	record_phase(E_SYSTEM_DAEMON_PHASE_SERIAL_FLUSH, &start);
+	port_mutex_take_all();
+	record_phase(E_SYSTEM_DAEMON_PHASE_PORT_TAKE, &start);
 	rtos_suspend_all();
 	vexBackgroundProcessing();
+	vdml_snapshot_capture();
 	rtos_resume_all();
+	record_phase(E_SYSTEM_DAEMON_PHASE_BACKGROUND, &start);
 	vdml_background_processing();
+	record_phase(E_SYSTEM_DAEMON_PHASE_VDML, &start);
 	port_mutex_give_all();
+	record_phase(E_SYSTEM_DAEMON_PHASE_PORT_GIVE, &start);
+	// Woken tasks can use their devices straight away, now that the ports are released
+	vdml_dispatch_updates();
+	registry_dispatch_changes();
+	motor_dispatch_faults();
+	watchdog_check();
+	display_touch_poll();
+	daemon_stats.cycles++;
+}
+
+int32_t system_daemon_get_stats(system_daemon_stats_s_t* const stats) {
+	if (stats == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	// The daemon preempts the caller, so keep it from updating the stats midway
+	rtos_suspend_all();
+	*stats = daemon_stats;
+	rtos_resume_all();
+	return 1;
+}
+
+void system_daemon_reset_stats(void) {
+	rtos_suspend_all();
+	memset(&daemon_stats, 0, sizeof(daemon_stats));
+	rtos_resume_all();
+}
+
+// Called by the user code's task just before the user function
+static void record_start(void) {
+	rtos_suspend_all();
+	if (start_pending) {
+		uint32_t us = (cycle_counter_get() - start_cycles) / CPU_CYCLES_PER_US;
+		daemon_stats.last_start_us = us;
+		if (us > daemon_stats.max_start_us) daemon_stats.max_start_us = us;
+		start_pending = false;
+	}
+	rtos_resume_all();
+}
+
+static void _competition_handler_task(void* mode) {
+	competition_handler_s_t* const handler = competition_handlers[(competition_mode_e_t)mode];
+	while (1) {
+		task_notify_take(true, TIMEOUT_MAX);
+		rtos_suspend_all();
+		task_fn_t const fn = handler->handler;
+		void* const param = handler->param;
+		rtos_resume_all();
+		record_start();
+		fn(param);
+		handler->running = false;
+	}
+}
+
+int32_t competition_handler_register(competition_mode_e_t mode, task_fn_t handler, void* param, uint32_t priority) {
+	if ((uint32_t)mode >= E_COMPETITION_MODE_COUNT || handler == NULL || priority > TASK_PRIORITY_MAX - 3) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	competition_handler_s_t* entry = competition_handlers[mode];
+	if (entry != NULL) {
+		rtos_suspend_all();
+		entry->handler = handler;
+		entry->param = param;
+		entry->priority = priority;
+		rtos_resume_all();
+		// A running handler keeps its priority until it's next restarted or notified
+		if (!entry->running) task_set_priority(entry->task, priority);
+		return 1;
+	}
+
+	// The task is restarted in place when its mode ends, so it needs buffers of its own
+	entry = kmalloc(sizeof(*entry));
+	static_task_s_t* const buffer = kmalloc(sizeof(*buffer));
+	task_stack_t* const stack = kmalloc(KERNEL_COMPETITION_TASK_STACK_DEPTH * sizeof(task_stack_t));
+	if (entry == NULL || buffer == NULL || stack == NULL) {
+		kfree(entry);
+		kfree(buffer);
+		kfree(stack);
+		errno = ENOMEM;
+		return PROS_ERR;
+	}
+	entry->handler = handler;
+	entry->param = param;
+	entry->priority = priority;
+	entry->running = false;
+	rtos_suspend_all();
+	competition_handlers[mode] = entry;
+	entry->task = task_create_static(_competition_handler_task, (void*)mode, priority,
+	                                 KERNEL_COMPETITION_TASK_STACK_DEPTH, task_names[mode], stack, buffer);
+	rtos_resume_all();
+	return 1;
+}
+
+// Stops the user code of the last mode and starts the user code of the new one
+static void competition_start(competition_mode_e_t mode) {
+	uint32_t start = cycle_counter_get();
+	start_cycles = start;
+	start_pending = true;
+	if (competition_mode_handled) {
+		competition_handler_s_t* const old = competition_handlers[competition_mode];
+		// A handler which has returned is already waiting for its next notification.
+		// One which was notified but hasn't run yet must not run in the new mode
+		if (old->running) {
+			old->running = false;
+			task_restart_static(old->task, _competition_handler_task, (void*)competition_mode, old->priority,
+			                    KERNEL_COMPETITION_TASK_STACK_DEPTH, task_names[competition_mode]);
+		}
+	}
+	competition_handler_s_t* const handler = competition_handlers[mode];
+	if (handler != NULL) {
+		if (competition_task_running) {
+			task_delete(competition_task);
+			competition_task_running = false;
+		}
+		task_set_priority(handler->task, handler->priority);
+		handler->running = true;
+		task_notify(handler->task);
+	} else {
+		// Recycle the competition task in place rather than deleting it and waiting on the idle task to clean it up
+		competition_task_running = true;
+		competition_task = task_restart_static(competition_task, task_fns[mode], NULL, TASK_PRIORITY_DEFAULT,
+		                                       KERNEL_COMPETITION_TASK_STACK_DEPTH, task_names[mode]);
+	}
+	competition_mode = mode;
+	competition_mode_handled = handler != NULL;
+	uint32_t us = (cycle_counter_get() - start) / CPU_CYCLES_PER_US;
+	daemon_stats.transitions++;
+	daemon_stats.last_transition_us = us;
+	if (us > daemon_stats.max_transition_us) daemon_stats.max_transition_us = us;
 }
 
-static void _system_daemon_task(void* ign) {
+// Starts the user code for the competition status if it has changed since *status
+static void competition_check(uint32_t* status) {
+	uint32_t const old_status = *status;
+	uint32_t const new_status = competition_get_status();
+	if (likely(new_status == old_status)) return;
+	// Have a new competition status, need to clean up whatever's running
+	*status = new_status;
+	if ((new_status & COMPETITION_DISABLED) && (old_status & COMPETITION_DISABLED)) {
+		// Don't restart the disabled task even if other bits have changed (e.g. auton bit)
+		return;
+	}
+
+	// competition initialize runs only when entering disabled and we're
+	// connected to competition control
+	competition_mode_e_t mode = E_COMPETITION_MODE_OPCONTROL;
+	if ((new_status ^ old_status) & COMPETITION_CONNECTED &&
+	    (new_status & (COMPETITION_DISABLED | COMPETITION_CONNECTED)) == (COMPETITION_DISABLED | COMPETITION_CONNECTED)) {
+		mode = E_COMPETITION_MODE_INITIALIZE;
+	} else if (new_status & COMPETITION_DISABLED) {
+		mode = E_COMPETITION_MODE_DISABLED;
+	} else if (new_status & COMPETITION_AUTONOMOUS) {
+		mode = E_COMPETITION_MODE_AUTONOMOUS;
+	}
+
+	// The match is over once the field disables driver control, so summarize how close tasks came to overflowing
+	const uint32_t mode_bits = COMPETITION_DISABLED | COMPETITION_AUTONOMOUS | COMPETITION_CONNECTED;
+	if ((old_status & mode_bits) == COMPETITION_CONNECTED &&
+	    (new_status & (COMPETITION_DISABLED | COMPETITION_CONNECTED)) == (COMPETITION_DISABLED | COMPETITION_CONNECTED)) {
+		task_stack_report();
+	}
+
+	competition_start(mode);
+}
+
+__pros_fast static void _system_daemon_task(void* ign) {
 	uint32_t time = millis();
 	// Initialize status to an invalid state to force an update the first loop
 	uint32_t status = (uint32_t)(1 << 8);
-	uint32_t task_state;
 
 	// XXX: Delay likely necessary for shared memory to get copied over
 	// (discovered b/c VDML would crash and burn)
@@ -69,12 +286,16 @@ static void _system_daemon_task(void* ign) {
 	port_mutex_take_all();
 	task_delay(2);
 	port_mutex_give_all();
+	// Configure the robot's motors now VEXos can talk to them, so they're ready for initialize()
+	registry_config_apply(UINT32_MAX);
 
 	// start up user initialize task. once the user initialize function completes,
 	// the _initialize_task will notify us and we can go into normal competition
 	// monitoring mode
-	competition_task = task_create_static(_initialize_task, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT,
-	                                      "User Initialization (PROS)", competition_task_stack, &competition_task_buffer);
+	boot_report_times();
+	competition_task =
+	    task_create_static(_initialize_task, NULL, TASK_PRIORITY_DEFAULT, KERNEL_COMPETITION_TASK_STACK_DEPTH,
+	                       "User Initialization (PROS)", competition_task_stack, &competition_task_buffer);
 
 	time = millis();
 	while (!task_notify_take(true, 2)) {
@@ -82,56 +303,31 @@ static void _system_daemon_task(void* ign) {
 		do_background_operations();
 	}
 	while (1) {
+		// VEXos updates the status while the daemon sleeps, so start the new mode's
+		// code before spending the cycle on the devices
+		competition_check(&status);
 		do_background_operations();
 
-		if (unlikely(status != competition_get_status())) {
-			// Have a new competition status, need to clean up whatever's running
-			uint32_t old_status = status;
-			status = competition_get_status();
-			enum state_task state = E_OPCONTROL_TASK;
-			if ((status & COMPETITION_DISABLED) && (old_status & COMPETITION_DISABLED)) {
-				// Don't restart the disabled task even if other bits have changed (e.g. auton bit)
-				continue;
-			}
-
-			// competition initialize runs only when entering disabled and we're
-			// connected to competition control
-			if ((status ^ old_status) & COMPETITION_CONNECTED &&
-			    (status & (COMPETITION_DISABLED | COMPETITION_CONNECTED)) == (COMPETITION_DISABLED | COMPETITION_CONNECTED)) {
-				state = E_COMP_INIT_TASK;
-			} else if (status & COMPETITION_DISABLED) {
-				state = E_DISABLED_TASK;
-			} else if (status & COMPETITION_AUTONOMOUS) {
-				state = E_AUTON_TASK;
-			}
-
-			task_state = task_get_state(competition_task);
-			// delete the task only if it's in normal operation (e.g. not deleted)
-			// The valid task states AREN'T deleted, invalid, or running (running
-			// means it's the current task, which will never be the case)
-			if (task_state == E_TASK_STATE_READY || task_state == E_TASK_STATE_BLOCKED ||
-			    task_state == E_TASK_STATE_SUSPENDED) {
-				task_delete(competition_task);
-			}
-
-			competition_task = task_create_static(task_fns[state], NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT,
-			                                      task_names[state], competition_task_stack, &competition_task_buffer);
-		}
-
+		// task_delay_until doesn't block if the next wake time has already passed
+		if (millis() - time >= 2) daemon_stats.missed_deadlines++;
 		task_delay_until(&time, 2);
 	}
 }
 
 void system_daemon_initialize() {
-	system_daemon_task = task_create_static(_system_daemon_task, NULL, TASK_PRIORITY_MAX - 2, TASK_STACK_DEPTH_DEFAULT,
-	                                        "PROS System Daemon", system_daemon_task_stack, &system_daemon_task_buffer);
+	cycle_counter_enable();
+	system_daemon_task =
+	    task_create_static(_system_daemon_task, NULL, TASK_PRIORITY_MAX - 2, KERNEL_SYSTEM_DAEMON_STACK_DEPTH,
+	                       "PROS System Daemon", system_daemon_task_stack, &system_daemon_task_buffer);
 }
 
 // these functions are what actually get called by the system daemon, which
 // attempt to call whatever the user declares
 #define FUNC(NAME)                        \
 	static void _##NAME##_task(void* ign) { \
+		record_start();                       \
 		user_##NAME();                        \
+		competition_task_running = false;     \
 		task_notify(system_daemon_task);      \
 	}
 #include "system/user_functions/c_list.h"
@@ -13,7 +13,9 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <errno.h>
 #include <malloc.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <unwind.h>
 
@@ -21,10 +23,14 @@
 
 #include "rtos/task.h"
 #include "rtos/tcb.h"
+#include "system/crash_dump.h"
 #include "system/hot.h"
 
 #include "v5_api.h"
 
+// NOTE: kapi.h can't be included alongside rtos/task.h
+#define PROS_ERR (INT32_MAX)
+
 /******************************************************************************/
 /**                           Helpful Unwind Files                           **/
 /*******************************************************************************
@@ -85,15 +91,103 @@ extern struct __EIT_entry __exidx_start;
 extern struct __EIT_entry __exidx_end;
 extern uint8_t start_of_cold_mem, end_of_cold_mem, start_of_hot_mem, end_of_hot_mem;
 
+// The unwinder binary searches whatever table it's given, so once the entry for
+// a PC is known only that entry and the next one (which bounds it) are handed
+// back. Entries found are kept in a small direct mapped cache, since a throw or
+// a profiler sample mostly unwinds through PCs which were seen before. A cached
+// entry is only used if the PC really falls inside it, so the cache needs no
+// lock: a slot holds a single pointer and is never wrong, only stale
+#define EXIDX_CACHE_BITS 6
+static struct __EIT_entry const* exidx_cache[1 << EXIDX_CACHE_BITS];
+
+// Decodes a table entry's function address, a 31 bit offset from the entry
+static inline _uw exidx_fn(struct __EIT_entry const* entry) {
+	_uw offset = entry->fnoffset;
+	offset = (offset & (1UL << 30)) ? offset | (1UL << 31) : offset & ~(1UL << 31);
+	return offset + (_uw)&entry->fnoffset;
+}
+
+// Whether entry, in the table ending at end, is the one for pc
+static inline bool exidx_covers(struct __EIT_entry const* entry, struct __EIT_entry const* end, _uw pc) {
+	return exidx_fn(entry) <= pc && (entry + 1 == end || pc < exidx_fn(entry + 1));
+}
+
 _Unwind_Ptr __gnu_Unwind_Find_exidx(_Unwind_Ptr pc, int* nrec) {
-	// check if pc is in the hot region
-	if (HOT_TABLE && (void*)&start_of_hot_mem < (void*)pc && (void*)pc < (void*)&end_of_hot_mem) {
-		*nrec = (struct __EIT_entry*)HOT_TABLE->__exidx_end - (struct __EIT_entry*)HOT_TABLE->__exidx_start;
-		return (_Unwind_Ptr)HOT_TABLE->__exidx_start;
+	struct __EIT_entry const* start;
+	struct __EIT_entry const* end;
+	// check if pc is in the hot region, whose bounds are only set when there's a
+	// hot table
+	if (HOT_TABLE->exidx_code_start < pc && pc < HOT_TABLE->exidx_code_end) {
+		start = HOT_TABLE->__exidx_start;
+		end = HOT_TABLE->__exidx_end;
+	} else {
+		// otherwise, we're in a monolith build or the cold region of a hot/cold build
+		start = &__exidx_start;
+		end = &__exidx_end;
+	}
+
+	size_t const slot = ((pc >> 1) * 0x9E3779B1UL) >> (32 - EXIDX_CACHE_BITS);
+	struct __EIT_entry const* entry = exidx_cache[slot];
+	if (entry == NULL || entry < start || entry >= end || !exidx_covers(entry, end, pc)) {
+		// the last entry whose function starts at or before pc
+		struct __EIT_entry const* lo = start;
+		struct __EIT_entry const* hi = end;
+		while (hi - lo > 1) {
+			struct __EIT_entry const* mid = lo + (hi - lo) / 2;
+			if (exidx_fn(mid) <= pc) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+		if (lo == end || exidx_fn(lo) > pc) {
+			// let the unwinder come to the same conclusion
+			*nrec = end - start;
+			return (_Unwind_Ptr)start;
+		}
+		entry = lo;
+		exidx_cache[slot] = entry;
+	}
+	*nrec = entry + 1 == end ? 1 : 2;
+	return (_Unwind_Ptr)entry;
+}
+
+// Collects the return addresses of the frames being unwound
+struct backtrace_state {
+	uint32_t* pcs;
+	uint32_t max;
+	uint32_t count;
+	uint32_t skip;  // frames to leave out at the start
+};
+
+static _Unwind_Reason_Code collect_fn(_Unwind_Context* unwind_ctx, void* d) {
+	struct backtrace_state* state = d;
+	uint32_t pc = _Unwind_GetIP(unwind_ctx);
+	extern void task_clean_up();
+	if (state->skip) {
+		state->skip--;
+	} else {
+		state->pcs[state->count++] = pc;
+	}
+	if (state->count == state->max || pc == (uint32_t)task_clean_up) {
+		return _URC_FAILURE;  // stops the unwinder
 	}
-	// otherwise, we're in a monolith build or the cold region of a hot/cold build
-	*nrec = &__exidx_end - &__exidx_start;
-	return (_Unwind_Ptr)&__exidx_start;
+	return _URC_NO_REASON;
+}
+
+// Unwinds from the registers r0-r15 in regs, storing up to max addresses in
+// pcs starting with regs' pc. Returns how many were stored. Also called from
+// the sampling profiler in profiler.c
+uint32_t unwind_backtrace(const uint32_t* regs, uint32_t* pcs, uint32_t max) {
+	if (max == 0) return 0;
+	struct phase2_vrs vrs = {.demand_save_flags = 0};
+	for (size_t i = 0; i < 16; i++) vrs.core.r[i] = regs[i];
+	// The unwinder only reports frames it has a table entry for, so the pc
+	// itself is stored first and skipped when the unwinder reports it
+	pcs[0] = regs[R_PC];
+	struct backtrace_state state = {.pcs = pcs, .max = max, .count = 1, .skip = 1};
+	if (max > 1) __gnu_Unwind_Backtrace(collect_fn, &state, &vrs);
+	return state.count;
 }
 
 _Unwind_Reason_Code trace_fn(_Unwind_Context* unwind_ctx, void* d) {
@@ -136,6 +230,8 @@ void p2vrs_from_data_abort(_uw* sp, struct phase2_vrs* vrs) {
 void report_data_abort(uint32_t _sp) {
 	struct phase2_vrs vrs;
 	p2vrs_from_data_abort((_uw*)_sp, &vrs);
+	// Before anything else touches the stacks or the heap
+	crash_dump_capture(vrs.core.r);
 
 	fputs("\n\nDATA ABORT EXCEPTION\n\n", stderr);
 	vexDisplayForegroundColor(ClrWhite);
@@ -161,6 +257,14 @@ void report_data_abort(uint32_t _sp) {
 	if (pxCurrentTCB) {
 		fprintf(stderr, "STACK REMAINING AT ABORT: %lu bytes\n", vrs.core.r[R_SP] - (uint32_t)pxCurrentTCB->pxStack);
 	}
+
+	int32_t crash_file = crash_dump_persist_from_abort();
+	if (crash_file >= 0) {
+		vexDisplayString(5, "CRASH DUMP: /usd/crash-%ld.bin", crash_file);
+		fprintf(stderr, "CRASH DUMP: /usd/crash-%ld.bin\n", crash_file);
+	} else {
+		fputs("CRASH DUMP: kept in RAM until the next run\n", stderr);
+	}
 }
 
 /******************************************************************************/
@@ -169,41 +273,40 @@ void report_data_abort(uint32_t _sp) {
 /** These functions use the __gnu_Unwind_* functions providing our helper    **/
 /** functions and phase2_vrs structure based on a target task                **/
 /******************************************************************************/
-#define REGISTER_BASE 67
+// A saved context starts with the FPU save area pointer and the critical nesting
+// count, followed by r0-r12, lr, the pc and the CPSR
+#define REGISTER_BASE 2
+// Fills in regs from the context a task saved when it stopped running. Should be
+// called with the task scheduler suspended, and only for tasks which aren't
+// running
+static inline void regs_from_saved_context(TCB_t* tcb, uint32_t* regs) {
+	for (size_t i = 0; i < 13; i++) {
+		regs[i] = tcb->pxTopOfStack[REGISTER_BASE + i];
+	}
+	regs[R_SP] = (uint32_t)(tcb->pxTopOfStack + REGISTER_BASE + 16);
+	regs[R_LR] = tcb->pxTopOfStack[REGISTER_BASE + 13];
+	regs[R_PC] = tcb->pxTopOfStack[REGISTER_BASE + 14];
+}
+
 static inline struct phase2_vrs p2vrs_from_task(task_t task) {
 	// should be called with the task scheduler suspended
 	taskENTER_CRITICAL();
 
 	TCB_t* tcb = (TCB_t*)task;
-	size_t i;
-
-	struct phase2_vrs vrs;
+	struct phase2_vrs vrs = {.demand_save_flags = 0};
 	if (tcb == NULL) {
 		tcb = pxCurrentTCB;
 	}
-
-	vrs.demand_save_flags = 0;
-	switch (task_get_state(task)) {
+	// Every task which isn't running saved its context the same way, whether it
+	// was preempted, blocked or suspended
+	switch (task_get_state(tcb)) {
 		case E_TASK_STATE_READY:
-			for (i = 0; i < 12; i++) {
-				vrs.core.r[i] = tcb->pxTopOfStack[REGISTER_BASE + i];
-			}
-			vrs.core.r[13] = (_uw)(tcb->pxTopOfStack + REGISTER_BASE + 16);  // r13 is sp
-			vrs.core.r[14] = tcb->pxTopOfStack[REGISTER_BASE + 13];          // r14 is lr
-			vrs.core.r[15] = tcb->pxTopOfStack[REGISTER_BASE + 14];          // r15 is pc
-			break;
 		case E_TASK_STATE_BLOCKED:
-			// for(i = 0; i < 12; i++) {
-			// 	vrs.core.r[i] = tcb->pxTopOfStack[REGISTER_BASE + i];
-			// }
-			// vrs.core.r[13] = (_uw)(tcb->pxTopOfStack + REGISTER_BASE + 29);
-			// vrs.core.r[14] = tcb->pxTopOfStack[REGISTER_BASE + ]
-			break;
-		case E_TASK_STATE_RUNNING:
-			break;
 		case E_TASK_STATE_SUSPENDED:
+			regs_from_saved_context(tcb, vrs.core.r);
 			break;
-		case E_TASK_STATE_DELETED:  // will never happen
+		case E_TASK_STATE_RUNNING:
+		case E_TASK_STATE_DELETED:
 		case E_TASK_STATE_INVALID:
 		default:
 			break;
@@ -212,6 +315,37 @@ static inline struct phase2_vrs p2vrs_from_task(task_t task) {
 	return vrs;
 }
 
+int32_t task_get_backtrace(task_t task, uint32_t* pcs, uint32_t max) {
+	if (pcs == NULL || max == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	if (task == NULL || task == pxCurrentTCB) {
+		// The first frame the unwinder reports is this function's own
+		struct backtrace_state state = {.pcs = pcs, .max = max, .count = 0, .skip = 1};
+		_Unwind_Backtrace(collect_fn, &state);
+		return state.count;
+	}
+
+	uint32_t regs[16];
+	uint32_t count = PROS_ERR;
+	// The task's stack can't change while it is walked with the scheduler suspended
+	rtos_suspend_all();
+	switch (task_get_state(task)) {
+		case E_TASK_STATE_READY:
+		case E_TASK_STATE_BLOCKED:
+		case E_TASK_STATE_SUSPENDED:
+			regs_from_saved_context(task, regs);
+			count = unwind_backtrace(regs, pcs, max);
+			break;
+		default:
+			break;
+	}
+	rtos_resume_all();
+	if (count == PROS_ERR) errno = EINVAL;
+	return count;
+}
+
 void backtrace_task(task_t task) {
 	struct phase2_vrs vrs = p2vrs_from_task(task);
 	printf("Trace:\n");
@@ -0,0 +1,73 @@
+/**
+ * \file system/v5_abi.c
+ *
+ * Shims between a hard float kernel and libv5rts
+ *
+ * Built with FLOAT_ABI=hard (see common.mk), the kernel passes floating point
+ * arguments and results in VFP registers, while VEXos's libv5rts is built for
+ * softfp and expects them in core registers. The link wraps each libv5rts
+ * function which takes or returns a floating point value, listed in
+ * V5_ABI_WRAPS, so the kernel's calls land here and the real function is
+ * called with the base calling convention. Every other function, including
+ * variadic ones like vexDisplayPrintf(), is called the same under both.
+ *
+ * Keep this list and V5_ABI_WRAPS in step when the kernel starts using
+ * another such function.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifdef __ARM_PCS_VFP
+
+#include "v5_api.h"
+
+#define SOFTFP __attribute__((pcs("aapcs")))
+
+#define V5_ABI_GET(name)                    \
+	extern SOFTFP double __real_##name(void); \
+	double __wrap_##name(void) {              \
+		return __real_##name();                 \
+	}
+
+#define V5_ABI_DEVICE_GET(name)                          \
+	extern SOFTFP double __real_##name(V5_DeviceT device); \
+	double __wrap_##name(V5_DeviceT device) {              \
+		return __real_##name(device);                        \
+	}
+
+#define V5_ABI_DEVICE_SET(name)                                      \
+	extern SOFTFP void __real_##name(V5_DeviceT device, double value); \
+	void __wrap_##name(V5_DeviceT device, double value) {              \
+		__real_##name(device, value);                                    \
+	}
+
+#define V5_ABI_DEVICE_TARGET_SET(name)                                                    \
+	extern SOFTFP void __real_##name(V5_DeviceT device, double position, int32_t velocity); \
+	void __wrap_##name(V5_DeviceT device, double position, int32_t velocity) {              \
+		__real_##name(device, position, velocity);                                            \
+	}
+
+V5_ABI_GET(vexBatteryCapacityGet)
+V5_ABI_GET(vexBatteryTemperatureGet)
+
+V5_ABI_DEVICE_GET(vexDeviceImuDegreesGet)
+V5_ABI_DEVICE_GET(vexDeviceImuHeadingGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorActualVelocityGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorEfficiencyGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorPositionGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorPowerGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorTargetGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorTemperatureGet)
+V5_ABI_DEVICE_GET(vexDeviceMotorTorqueGet)
+
+V5_ABI_DEVICE_SET(vexDeviceMotorPositionSet)
+
+V5_ABI_DEVICE_TARGET_SET(vexDeviceMotorAbsoluteTargetSet)
+V5_ABI_DEVICE_TARGET_SET(vexDeviceMotorRelativeTargetSet)
+
+#endif
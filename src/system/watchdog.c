@@ -0,0 +1,142 @@
+/**
+ * \file system/watchdog.c
+ *
+ * Per-task heartbeat deadlines checked by the system daemon
+ *
+ * A registered task's entry is kept in one of its thread local storage
+ * pointers, so watchdog_kick() only has to store the time. The daemon walks
+ * the registered entries once a cycle in watchdog_check(), after the ports
+ * have been released, and runs the safe-state action for each newly missed
+ * deadline. Entries are only taken, changed and given back with the scheduler
+ * suspended, and the daemon preempts every user task, so it never sees one
+ * half set up.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "kapi.h"
+#include "system/optimizers.h"
+
+#define WATCHDOG_TLSP_IDX 5
+
+// from tasks.c
+void* pvTaskGetThreadLocalStoragePointer(task_t xTaskToQuery, int32_t xIndex);
+void vTaskSetThreadLocalStoragePointer(task_t xTaskToSet, int32_t xIndex, void* pvValue);
+
+typedef struct watchdog_entry {
+	task_t task;
+	uint32_t deadline;
+	volatile uint32_t last_kick;
+	volatile bool tripped;  // Whether the current miss has been handled
+} watchdog_entry_s_t;
+
+static watchdog_entry_s_t entries[WATCHDOG_MAX_TASKS];
+static uint32_t registered;  // Bit i for entries[i]
+static watchdog_action_fn_t action;
+static void* action_param;
+static watchdog_stats_s_t stats;
+
+int32_t watchdog_register(uint32_t deadline) {
+	if (deadline == 0) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	watchdog_entry_s_t* entry = pvTaskGetThreadLocalStoragePointer(NULL, WATCHDOG_TLSP_IDX);
+	if (entry == NULL) {
+		if (registered == (1 << WATCHDOG_MAX_TASKS) - 1) {
+			rtos_resume_all();
+			errno = ENOSPC;
+			return PROS_ERR;
+		}
+		int const i = __builtin_ctz(~registered);
+		entry = &entries[i];
+		entry->task = task_get_current();
+		vTaskSetThreadLocalStoragePointer(NULL, WATCHDOG_TLSP_IDX, entry);
+		registered |= 1 << i;
+	}
+	entry->deadline = deadline;
+	entry->last_kick = millis();
+	entry->tripped = false;
+	rtos_resume_all();
+	return 1;
+}
+
+// Called when a task is deleted or restarted, before it's taken off its lists
+void watchdog_release(task_t task) {
+	if (likely(!registered)) return;
+	rtos_suspend_all();
+	watchdog_entry_s_t* const entry = pvTaskGetThreadLocalStoragePointer(task, WATCHDOG_TLSP_IDX);
+	if (entry != NULL) {
+		vTaskSetThreadLocalStoragePointer(task, WATCHDOG_TLSP_IDX, NULL);
+		registered &= ~(1 << (entry - entries));
+	}
+	rtos_resume_all();
+}
+
+void watchdog_unregister(void) {
+	watchdog_release(NULL);
+}
+
+int32_t watchdog_kick(void) {
+	watchdog_entry_s_t* const entry = pvTaskGetThreadLocalStoragePointer(NULL, WATCHDOG_TLSP_IDX);
+	if (entry == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	entry->last_kick = millis();
+	entry->tripped = false;
+	return 1;
+}
+
+void watchdog_set_action(watchdog_action_fn_t new_action, void* param) {
+	rtos_suspend_all();
+	action = new_action;
+	action_param = param;
+	rtos_resume_all();
+}
+
+int32_t watchdog_get_stats(watchdog_stats_s_t* const out) {
+	if (out == NULL) {
+		errno = EINVAL;
+		return PROS_ERR;
+	}
+	rtos_suspend_all();
+	*out = stats;
+	rtos_resume_all();
+	return 1;
+}
+
+void watchdog_reset_stats(void) {
+	rtos_suspend_all();
+	memset(&stats, 0, sizeof(stats));
+	rtos_resume_all();
+}
+
+// Called by the system daemon once the ports have been released
+void watchdog_check(void) {
+	if (likely(!registered)) return;
+	uint32_t const now = millis();
+	for (uint32_t pending = registered; pending; pending &= pending - 1) {
+		watchdog_entry_s_t* const entry = &entries[__builtin_ctz(pending)];
+		uint32_t const elapsed = now - entry->last_kick;
+		if (likely(elapsed <= entry->deadline) || entry->tripped) continue;
+		entry->tripped = true;
+		uint32_t const overdue = elapsed - entry->deadline;
+		stats.misses++;
+		stats.last_miss_time = now;
+		stats.last_overdue = overdue;
+		strncpy(stats.last_task_name, task_get_name(entry->task), TASK_NAME_MAX_LEN - 1);
+		stats.last_task_name[TASK_NAME_MAX_LEN - 1] = '\0';
+		// The action may unregister tasks, which only clears their bits in registered
+		if (action != NULL) action(entry->task, overdue, action_param);
+	}
+}
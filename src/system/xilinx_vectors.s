@@ -78,11 +78,12 @@
 
 .extern FreeRTOS_IRQ_Handler
 .extern FreeRTOS_SWI_Handler
+.extern FreeRTOS_Undefined_Handler
 
 .section .freertos_vectors
 _freertos_vector_table:
 	B	  _boot
-	B	  FreeRTOS_Undefined
+	B	  FreeRTOS_Undefined_Handler
 	ldr   pc, _swi
 	B	  FreeRTOS_PrefetchAbortHandler
 	B	  FreeRTOS_DataAbortHandler
@@ -102,10 +103,6 @@ FIQLoop:
 	ldmia	sp!,{r0-r3,r12,lr}	/* state restore from compiled code */
 	subs	pc, lr, #4			/* adjust return */
 
-.align 4
-FreeRTOS_Undefined:				/* Undefined handler */
-	b		.
-
 .align 4
 FreeRTOS_DataAbortHandler:		/* Data Abort handler */
 #ifdef CONFIG_ARM_ERRATA_775420
@@ -0,0 +1,59 @@
+/**
+ * \file tests/adi_calibrate.c
+ *
+ * Test code for background ADI calibrations
+ *
+ * Calibrates line sensors on ports A and B and a gyro on port C at the same
+ * time, while another task keeps reading the button on port H. The button
+ * should keep being read throughout, and everything should be calibrated
+ * after about 1.3 s, the gyro's calibration time.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+static volatile uint32_t button_reads;
+
+static void read_button(void* ign) {
+	while (true) {
+		if (adi_digital_read('H') != PROS_ERR) button_reads++;
+		task_delay(10);
+	}
+}
+
+void opcontrol() {
+	adi_port_set_config('A', E_ADI_ANALOG_IN);
+	adi_port_set_config('B', E_ADI_ANALOG_IN);
+	adi_port_set_config('C', E_ADI_TYPE_UNDEFINED);
+	adi_port_set_config('H', E_ADI_DIGITAL_IN);
+	task_create(read_button, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "button");
+
+	uint32_t start = millis();
+	adi_analog_calibrate_async('A');
+	adi_analog_calibrate_async('B');
+	adi_gyro_t gyro = adi_gyro_init_async('C', 1);
+	uint32_t reads_before = button_reads;
+
+	int32_t a = adi_calibration_wait('A', TIMEOUT_MAX);
+	int32_t b = adi_calibration_wait('B', TIMEOUT_MAX);
+	printf("Analog sensors calibrated to %ld and %ld after %lu ms\n", a, b, millis() - start);
+	adi_calibration_wait(gyro, TIMEOUT_MAX);
+	printf("Gyro calibrated after %lu ms\n", millis() - start);
+	printf("Button was read %lu times meanwhile\n", button_reads - reads_before);
+
+	// Reconfiguring a port cancels its calibration
+	adi_analog_calibrate_async('A');
+	adi_port_set_config('A', E_ADI_DIGITAL_IN);
+	if (adi_calibration_wait('A', 1000) == PROS_ERR && errno == EINVAL) printf("Cancelled calibration reported\n");
+
+	while (true) {
+		printf("B: %ld (%ld in 16ths), gyro: %f\n", adi_analog_read_calibrated('B'), adi_analog_read_calibrated_HR('B'),
+		       adi_gyro_get(gyro));
+		task_delay(500);
+	}
+}
@@ -0,0 +1,35 @@
+/**
+ * \file tests/boot_options.c
+ *
+ * Test code for the boot options
+ *
+ * Defers the display and quiets the registry, so initialize() should start
+ * before LVGL is up and the kdbg stream should show the boot times without a
+ * line per plugged-in device. LVGL comes up once initialize() blocks, and LLEMU
+ * works as usual in opcontrol().
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+PROS_BOOT_OPTIONS(PROS_BOOT_DEFER_DISPLAY | PROS_BOOT_QUIET_REGISTRY);
+
+void initialize() {
+	printf("initialize() at %lu ms, display started: %d\n", millis(), display_is_started());
+	delay(100);
+	printf("after blocking at %lu ms, display started: %d\n", millis(), display_is_started());
+}
+
+void opcontrol() {
+	lcd_initialize();
+	while (true) {
+		lcd_print(0, "%lu ms", millis());
+		delay(50);
+	}
+}
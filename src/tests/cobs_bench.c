@@ -0,0 +1,153 @@
+/**
+ * \file tests/cobs_bench.c
+ *
+ * Benchmark for the COBS encoder and decoder
+ *
+ * The ref_* functions below encode a byte at a time, like common/cobs.c did
+ * before it scanned for zeros a word at a time. Prints the throughput in
+ * bytes per microsecond of measuring, encoding, streaming and decoding text
+ * (zeros are rare, so the runs are long) and random bytes (a zero every 256
+ * bytes on average), for the reference and the kernel. The kernel's column
+ * should never be the slower one.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/cobs.h"
+
+#define REF_FN __attribute__((noinline))
+
+#define SIZE 4096
+#define ROUNDS 50
+#define PREFIX 0x74756f73  // 'sout' little endian
+
+static uint8_t src[SIZE];
+static uint8_t encoded[COBS_ENCODE_MEASURE_MAX(SIZE + 4) + 1];
+static uint8_t decoded[SIZE + 4];
+static uint8_t stream_buf[320];
+static uint8_t stream_out[sizeof(encoded)];
+static size_t stream_out_len;
+
+REF_FN static size_t ref_measure(const uint8_t* data, size_t len) {
+	size_t write_idx = 1 + 4;
+	uint8_t code = 5;
+	for (size_t i = 0; i < len; i++) {
+		write_idx++;
+		if (data[i] == 0) {
+			code = 1;
+		} else if (++code == 0xff) {
+			code = 1;
+			write_idx++;
+		}
+	}
+	return write_idx;
+}
+
+REF_FN static size_t ref_encode(uint8_t* dest, const uint8_t* data, size_t len) {
+	size_t write_idx = 1;
+	size_t code_idx = 0;
+	uint8_t code = 1;
+	memcpy(dest + 1, &(uint32_t){PREFIX}, 4);
+	write_idx += 4;
+	code += 4;
+	for (size_t i = 0; i < len; i++) {
+		if (data[i] == 0) {
+			dest[code_idx] = code;
+			code = 1;
+			code_idx = write_idx++;
+		} else {
+			dest[write_idx++] = data[i];
+			if (++code == 0xff) {
+				dest[code_idx] = code;
+				code = 1;
+				code_idx = write_idx++;
+			}
+		}
+	}
+	dest[code_idx] = code;
+	return write_idx;
+}
+
+static size_t capture(const uint8_t* data, size_t len, void* arg) {
+	memcpy(stream_out + stream_out_len, data, len);
+	stream_out_len += len;
+	return len;
+}
+
+static size_t stream_encode(void) {
+	cobs_stream_s_t cobs;
+	stream_out_len = 0;
+	cobs_stream_init(&cobs, stream_buf, sizeof(stream_buf), capture, NULL, PREFIX);
+	cobs_stream_write(&cobs, src, SIZE);
+	cobs_stream_finish(&cobs);
+	return stream_out_len;
+}
+
+static int32_t decode(bool runs) {
+	cobs_decoder_s_t decoder;
+	cobs_decoder_init(&decoder, decoded, sizeof(decoded));
+	int32_t len = -1;
+	for (size_t i = 0; i < stream_out_len; i++) {
+		if (runs) {
+			i += cobs_decode_run(&decoder, stream_out + i, stream_out_len - i);
+			if (i == stream_out_len) break;
+		}
+		int32_t ret = cobs_decode_byte(&decoder, stream_out[i]);
+		if (ret >= 0) len = ret;
+	}
+	return len;
+}
+
+// Bytes per microsecond over all rounds
+#define RATE(call)                                                  \
+	({                                                                \
+		uint64_t start = micros();                                      \
+		for (int r = 0; r < ROUNDS; r++) call;                          \
+		(uint32_t)((uint64_t)SIZE * ROUNDS / (micros() - start + 1)); \
+	})
+
+static void bench(const char* name) {
+	printf("%s: measure ref/kernel, encode ref/kernel, stream, decode bytes/runs (bytes/us)\n", name);
+	uint32_t measure_ref = RATE(ref_measure(src, SIZE));
+	uint32_t measure = RATE(cobs_encode_measure(src, SIZE, PREFIX));
+	uint32_t encode_ref = RATE(ref_encode(encoded, src, SIZE));
+	uint32_t encode = RATE(cobs_encode(encoded, src, SIZE, PREFIX));
+	uint32_t stream = RATE(stream_encode());
+	uint32_t decode_bytes = RATE(decode(false));
+	uint32_t decode_runs = RATE(decode(true));
+	printf("%7lu %7lu %7lu %7lu %7lu %7lu %7lu\n", measure_ref, measure, encode_ref, encode, stream, decode_bytes,
+	       decode_runs);
+}
+
+static bool check(void) {
+	size_t len = cobs_encode(encoded, src, SIZE, PREFIX);
+	if (len != ref_encode(decoded, src, SIZE) || memcmp(encoded, decoded, len)) return false;
+	if (cobs_encode_measure(src, SIZE, PREFIX) != len || ref_measure(src, SIZE) != len) return false;
+	// the stream also ends the frame with the delimiter
+	if (stream_encode() != len + 1 || memcmp(stream_out, encoded, len)) return false;
+	return decode(true) == SIZE + 4 && !memcmp(decoded + 4, src, SIZE);
+}
+
+void opcontrol() {
+	static const char text[] = "left 127 right -127 arm 4095 claw open\n";
+	while (true) {
+		for (size_t i = 0; i < SIZE; i++) src[i] = text[i % (sizeof(text) - 1)];
+		printf("text results %s\n", check() ? "match" : "DO NOT MATCH");
+		bench("text");
+		delay(2);
+
+		for (size_t i = 0; i < SIZE; i++) src[i] = rand();
+		printf("random results %s\n", check() ? "match" : "DO NOT MATCH");
+		bench("random");
+		delay(5000);
+	}
+}
@@ -0,0 +1,51 @@
+/**
+ * \file tests/delay_us.c
+ *
+ * Test code for task_delay_until_us
+ *
+ * Runs a 500 Hz loop on task_delay_until_us() and reports how late each
+ * wakeup was, next to a busy task at the same priority and a 1 ms loop at a
+ * lower one. The worst lateness should stay within a few tens of
+ * microseconds.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#define PERIOD_US 2000
+
+static void spin(void* ign) {
+	while (true) {
+		volatile uint32_t i = 0;
+		while (i < 100000) i++;
+		task_delay(1);
+	}
+}
+
+static void slow_loop(void* ign) {
+	uint32_t now = millis();
+	while (true) task_delay_until(&now, 1);
+}
+
+void opcontrol() {
+	task_create(spin, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "spin");
+	task_create(slow_loop, NULL, TASK_PRIORITY_DEFAULT - 1, TASK_STACK_DEPTH_DEFAULT, "slow loop");
+
+	uint64_t wake = micros();
+	for (uint32_t round = 0;; round++) {
+		uint64_t worst = 0, total = 0;
+		for (int i = 0; i < 500; i++) {
+			task_delay_until_us(&wake, PERIOD_US);
+			uint64_t late = micros() - wake;
+			total += late;
+			if (late > worst) worst = late;
+		}
+		printf("round %lu: %d us period, late by %lu us on average and %lu us at worst\n", round, PERIOD_US,
+		       (uint32_t)(total / 500), (uint32_t)worst);
+	}
+}
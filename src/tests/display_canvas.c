@@ -0,0 +1,58 @@
+/**
+ * \file tests/display_canvas.c
+ *
+ * Test code for display canvases
+ *
+ * Plots the battery current and a sine wave at 50 Hz on a canvas covering the
+ * bottom half of the screen, under an LVGL label showing the display's refresh
+ * statistics. The label should keep updating and never draw over the plot.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+#define PLOT_WIDTH 480
+#define PLOT_HEIGHT 120
+
+void opcontrol() {
+	lv_obj_t* label = lv_label_create(lv_scr_act(), NULL);
+	lv_obj_set_pos(label, 10, 10);
+
+	display_canvas_t canvas = display_canvas_create(0, 240 - PLOT_HEIGHT, PLOT_WIDTH - 1, 239);
+	if (canvas == NULL) {
+		printf("Couldn't create the canvas (errno %d)\n", errno);
+		return;
+	}
+
+	int16_t last_current = PLOT_HEIGHT - 1;
+	int16_t last_sine = PLOT_HEIGHT / 2;
+	uint32_t time = millis();
+	for (uint32_t i = 0; true; i++) {
+		// 0 to 20 A from the bottom of the plot to the top
+		int16_t current = PLOT_HEIGHT - 1 - battery_get_current() * (PLOT_HEIGHT - 1) / 20000;
+		int16_t sine = PLOT_HEIGHT / 2 - sin(i * 0.05) * (PLOT_HEIGHT / 2 - 1);
+
+		display_canvas_scroll(canvas, 2, COLOR_BLACK);
+		display_canvas_draw_line(canvas, PLOT_WIDTH - 3, last_current, PLOT_WIDTH - 1, current, COLOR_ORANGE);
+		display_canvas_draw_line(canvas, PLOT_WIDTH - 3, last_sine, PLOT_WIDTH - 1, sine, COLOR_CYAN);
+		display_canvas_present(canvas);
+		last_current = current;
+		last_sine = sine;
+
+		if (i % 25 == 0) {
+			display_refresh_stats_s_t stats;
+			display_get_refresh_stats(&stats);
+			char text[96];
+			snprintf(text, sizeof(text), "%lu refreshes, last %lu flushes of %lu px in %lu ms", stats.refreshes,
+			         stats.last_flushes, stats.last_pixels, stats.last_refresh_time);
+			lv_label_set_text(label, text);
+		}
+		task_delay_until(&time, 20);
+	}
+}
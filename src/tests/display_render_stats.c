@@ -0,0 +1,56 @@
+/**
+ * \file tests/display_render_stats.c
+ *
+ * Test code for the display render statistics
+ *
+ * Fills the screen with buttons, labels and a chart which keep changing, and
+ * prints every second how long each type of object took to draw. The chart
+ * and the shadowed buttons should be near the top.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+#define MAX_TYPES 16
+
+void opcontrol() {
+	lv_obj_t* labels[4];
+	for (int i = 0; i < 4; i++) {
+		lv_obj_t* btn = lv_btn_create(lv_scr_act(), NULL);
+		lv_obj_set_size(btn, 100, 50);
+		lv_obj_set_pos(btn, 10 + 115 * i, 10);
+		labels[i] = lv_label_create(btn, NULL);
+	}
+	lv_obj_t* chart = lv_chart_create(lv_scr_act(), NULL);
+	lv_obj_set_size(chart, 460, 160);
+	lv_obj_set_pos(chart, 10, 70);
+	lv_chart_series_t* series = lv_chart_add_series(chart, LV_COLOR_RED);
+
+	display_render_stats_s_t stats[MAX_TYPES];
+	display_reset_render_stats();
+	uint32_t second = millis();
+	while (true) {
+		for (int i = 0; i < 4; i++) lv_label_set_text(labels[i], (millis() / 500 + i) % 2 ? "Tick" : "Tock");
+		lv_chart_set_next(chart, series, millis() % 100);
+		delay(20);
+
+		if (millis() - second >= 1000) {
+			int32_t types = display_get_render_stats(stats, MAX_TYPES);
+			printf("%ld object types drawn:\n", types);
+			for (int32_t i = 0; i < types && i < MAX_TYPES; i++) {
+				printf("%-12s %6lu draws %8lu us (max %lu us), histogram", stats[i].type, stats[i].draws,
+				       stats[i].draw_time, stats[i].max_draw_time);
+				for (int b = 0; b < DISPLAY_RENDER_BUCKETS; b++) printf(" %lu", stats[i].histogram[b]);
+				printf("\n");
+			}
+			display_reset_render_stats();
+			second = millis();
+		}
+	}
+}
@@ -0,0 +1,81 @@
+/**
+ * \file tests/display_virtual.c
+ *
+ * Test code for virtual lists and tables
+ *
+ * Shows a virtual list of 1000 items next to a virtual table of 1000 rows in
+ * a page, and scrolls both through every item while printing LVGL's free
+ * memory once a second. The free memory should stay the same however far
+ * they have scrolled, and releasing a list button should print the item it
+ * showed.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdio.h>
+
+#include "main.h"
+
+#define ITEMS 1000
+#define ITEM_HEIGHT 30
+
+static void fill_item(lv_obj_t* list, lv_obj_t* btn, uint32_t index) {
+	char text[16];
+	snprintf(text, sizeof(text), "Item %lu", index);
+	lv_label_set_text(lv_list_get_btn_label(btn), text);
+}
+
+static lv_res_t item_released(lv_obj_t* btn) {
+	printf("Released item %ld\n", lv_list_get_btn_index(NULL, btn));
+	return LV_RES_OK;
+}
+
+static const char* fill_cell(lv_obj_t* table, uint16_t row, uint16_t col, lv_table_cell_format_t* format) {
+	static char text[16];
+	if (col == 0) {
+		snprintf(text, sizeof(text), "%u", row);
+	} else {
+		format->align = LV_LABEL_ALIGN_RIGHT;
+		snprintf(text, sizeof(text), "%u", row * row);
+	}
+	return text;
+}
+
+void opcontrol() {
+	lv_obj_t* list = lv_list_create(lv_scr_act(), NULL);
+	lv_obj_set_size(list, 220, 220);
+	lv_obj_set_pos(list, 10, 10);
+	lv_list_set_virtual(list, ITEMS, ITEM_HEIGHT, fill_item, item_released);
+
+	lv_obj_t* page = lv_page_create(lv_scr_act(), NULL);
+	lv_obj_set_size(page, 230, 220);
+	lv_obj_set_pos(page, 240, 10);
+	lv_obj_t* table = lv_table_create(page, NULL);
+	lv_table_set_col_cnt(table, 2);
+	lv_table_set_col_width(table, 0, 80);
+	lv_table_set_col_width(table, 1, 110);
+	lv_table_set_virtual(table, ITEMS, fill_cell);
+
+	lv_obj_t* scrl = lv_page_get_scrl(list);
+	lv_coord_t const bottom = lv_obj_get_height(list) - lv_obj_get_height(scrl);
+	uint32_t second = millis();
+	lv_coord_t y = 0;
+	while (true) {
+		// Scroll down through everything, then jump back to the top
+		y = y - 5 < bottom ? 0 : y - 5;
+		lv_obj_set_y(scrl, y);
+		lv_page_scroll_ver(page, y == 0 ? lv_obj_get_height(table) : -5);
+		delay(20);
+
+		if (millis() - second >= 1000) {
+			lv_mem_monitor_t mon;
+			lv_mem_monitor(&mon);
+			printf("scrolled to %d, %lu bytes free\n", y, mon.free_size);
+			second = millis();
+		}
+	}
+}
@@ -1,5 +1,6 @@
 #include <errno.h>
 #include "api.h"
+#include "pros/apix.h"
 #include "v5_api.h"
 
 void task_a_fn(void* ign) {
@@ -19,7 +20,26 @@ void task_b_fn(void* ign) {
 	}
 }
 
+// Light tasks share newlib's global reent structure, but not errno
+void task_c_fn(void* ign) {
+	task_delay(1000);
+	errno = EACCES;
+	while (1) {
+		vexDisplayString(4, "Errno from light C is: %d\n", errno);
+		task_delay(10);
+	}
+}
+
+void task_d_fn(void* ign) {
+	while (1) {
+		vexDisplayString(5, "Errno from light D is: %d\n", errno);
+		task_delay(10);
+	}
+}
+
 void test_errno_reentrancy() {
 	task_create(task_a_fn, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Task A");
 	task_create(task_b_fn, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Task B");
-}
+	task_create_light(task_c_fn, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Task C");
+	task_create_light(task_d_fn, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Task D");
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ * \file tests/ext_adi.cpp
+ *
+ * Test code for ADI expanders
+ *
+ * Expects an expander on smart port 1 with encoders on ports A-B of both it
+ * and the brain, and solenoids on the expander's ports E-H. The encoders
+ * should count and give velocities independently of each other, the solenoids
+ * should fire all together once a second, and each ADI's values should be
+ * read in one call.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#define EXPANDER_PORT 1
+#define SOLENOIDS 0xf0  // Ports E-H
+
+void opcontrol() {
+	pros::ADIEncoder brain_encoder('A', 'B');
+	pros::ADIEncoder expander_encoder({{EXPANDER_PORT, 'A', 'B'}});
+	for (std::uint8_t port = 'E'; port <= 'H'; port++) pros::c::ext_adi_pin_mode(EXPANDER_PORT, port, OUTPUT);
+
+	// A port which isn't a digital output leaves the rest of the mask alone
+	if (pros::ADIPort::set_digital_mask(EXPANDER_PORT, SOLENOIDS | 0x01, SOLENOIDS) == PROS_ERR && errno == EADDRINUSE) {
+		printf("Mixed mask refused\n");
+	}
+
+	std::int32_t brain[NUM_ADI_PORTS];
+	std::int32_t expander[NUM_ADI_PORTS];
+	bool fired = false;
+	while (true) {
+		fired = !fired;
+		pros::ADIPort::set_digital_mask(EXPANDER_PORT, SOLENOIDS, fired ? SOLENOIDS : 0);
+		pros::ADIPort::read_all(brain);
+		pros::ADIPort::read_all(EXPANDER_PORT, expander);
+		printf("brain: %ld (%f/s), expander: %ld (%f/s), expander H: %ld\n", brain[0], brain_encoder.get_velocity(),
+		       expander[0], expander_encoder.get_velocity(), expander[7]);
+		pros::delay(1000);
+	}
+}
@@ -0,0 +1,74 @@
+/**
+ * \file tests/fast_jitter.c
+ *
+ * Test code for PROS_BOOT_LOCK_FAST
+ *
+ * Runs a 5 ms control loop next to a task which streams through 4 MB of memory
+ * so that the L2 cache keeps getting thrashed, and prints every 10 seconds how
+ * late the loop woke up. Run it once as is and once with LOCK_FAST set to 0;
+ * with the kernel's fast paths locked into L2 the worst wakeups should be
+ * noticeably earlier. The boot log says whether the lock took.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+#include <string.h>
+
+#define LOCK_FAST 1
+
+#if LOCK_FAST
+PROS_BOOT_OPTIONS(PROS_BOOT_LOCK_FAST);
+#endif
+
+#define PERIOD_US 5000
+#define THRASH_BYTES (4 * 1024 * 1024)
+// Lateness histogram buckets, in microseconds
+#define BUCKETS 6
+static const uint32_t bucket_bounds[BUCKETS] = {5, 10, 20, 50, 100, UINT32_MAX};
+
+static void thrash(void* ign) {
+	uint8_t* buf = malloc(THRASH_BYTES);
+	while (buf) {
+		memset(buf, millis(), THRASH_BYTES / 2);
+		memcpy(buf + THRASH_BYTES / 2, buf, THRASH_BYTES / 2);
+		delay(1);
+	}
+}
+
+void opcontrol() {
+	task_create(thrash, NULL, TASK_PRIORITY_MIN + 1, TASK_STACK_DEPTH_DEFAULT, "thrash");
+
+	uint32_t histogram[BUCKETS] = {0};
+	uint32_t worst = 0;
+	uint64_t late_sum = 0;
+	uint32_t wakeups = 0;
+	uint64_t wake = micros();
+	while (true) {
+		task_delay_until_us(&wake, PERIOD_US);
+		uint32_t late = micros() - wake;
+
+		int b = 0;
+		while (late >= bucket_bounds[b]) b++;
+		histogram[b]++;
+		if (late > worst) worst = late;
+		late_sum += late;
+
+		if (++wakeups == 10000000 / PERIOD_US) {
+			printf("lock %d: mean %lu us late, worst %lu us, under 5/10/20/50/100/more us:", LOCK_FAST,
+			       (uint32_t)(late_sum / wakeups), worst);
+			for (b = 0; b < BUCKETS; b++) printf(" %lu", histogram[b]);
+			printf("\n");
+			memset(histogram, 0, sizeof(histogram));
+			worst = 0;
+			late_sum = 0;
+			wakeups = 0;
+		}
+	}
+}
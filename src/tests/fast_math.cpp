@@ -0,0 +1,107 @@
+/**
+ * \file tests/fast_math.cpp
+ *
+ * Accuracy and speed of pros/math.hpp against libm
+ *
+ * Sweeps each function over its range and prints the largest error against
+ * the double precision libm result, which should stay within the bounds at
+ * the top of pros/math.hpp, then times a block of values through the batched
+ * and scalar functions and through libm, in nanoseconds per value.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#define COUNT 256
+#define ROUNDS 100
+#define SWEEP 100000
+
+static float xs[COUNT], ys[COUNT], out_a[COUNT], out_b[COUNT];
+static volatile float sink;
+
+// Nanoseconds per value of running fn over the block ROUNDS times
+template <typename F>
+static uint32_t time_ns(F fn) {
+	uint64_t const start = pros::c::micros();
+	for (int i = 0; i < ROUNDS; i++) fn();
+	return (pros::c::micros() - start) * 1000 / (ROUNDS * COUNT);
+}
+
+static void accuracy() {
+	double sin_err = 0, cos_err = 0, atan2_err = 0, sqrt_err = 0;
+	for (int i = 0; i < SWEEP; i++) {
+		float const x = -8192.0f + 16384.0f * i / (SWEEP - 1);
+		float s, c;
+		pros::math::sincos(x, &s, &c);
+		sin_err = std::fmax(sin_err, std::fabs(s - std::sin((double)x)));
+		cos_err = std::fmax(cos_err, std::fabs(c - std::cos((double)x)));
+		float const y = 10.0f * (i % 317) / 316 - 5, z = 10.0f * (i / 317) / 315 - 5;
+		if (y != 0 || z != 0) {
+			atan2_err = std::fmax(atan2_err, std::fabs(pros::math::atan2(y, z) - std::atan2((double)y, (double)z)));
+		}
+	}
+	// The batched versions are checked too, since NEON refines its own divisions and square roots
+	for (int i = 0; i < SWEEP; i += COUNT) {
+		for (int j = 0; j < COUNT; j++) {
+			xs[j] = std::ldexp(1.0f + (float)j / COUNT, (i / COUNT) % 60 - 30);
+			ys[j] = 4.0f * ((i + j) % 101) / 100 - 2;
+		}
+		pros::math::sqrt(xs, out_a, COUNT);
+		pros::math::atan2(ys, xs, out_b, COUNT);
+		for (int j = 0; j < COUNT; j++) {
+			double const root = std::sqrt((double)xs[j]);
+			sqrt_err = std::fmax(sqrt_err, std::fabs(out_a[j] - root) / root);
+			atan2_err = std::fmax(atan2_err, std::fabs(out_b[j] - std::atan2((double)ys[j], (double)xs[j])));
+		}
+	}
+	printf("max error: sin %.3g cos %.3g atan2 %.3g sqrt %.3g (relative)\n", sin_err, cos_err, atan2_err, sqrt_err);
+}
+
+static void speed() {
+	for (int i = 0; i < COUNT; i++) {
+		xs[i] = 0.05f * i - 6.0f;
+		ys[i] = 3.0f - 0.03f * i;
+	}
+	printf("%-8s %8s %8s %8s\n", "ns", "batched", "scalar", "libm");
+	printf("%-8s %8lu %8lu %8lu\n", "sincos", time_ns([] { pros::math::sincos(xs, out_a, out_b, COUNT); }),
+	       time_ns([] {
+		       for (int i = 0; i < COUNT; i++) pros::math::sincos(xs[i], &out_a[i], &out_b[i]);
+	       }),
+	       time_ns([] {
+		       for (int i = 0; i < COUNT; i++) {
+			       out_a[i] = std::sin(xs[i]);
+			       out_b[i] = std::cos(xs[i]);
+		       }
+	       }));
+	printf("%-8s %8lu %8lu %8lu\n", "atan2", time_ns([] { pros::math::atan2(ys, xs, out_a, COUNT); }),
+	       time_ns([] {
+		       for (int i = 0; i < COUNT; i++) out_a[i] = pros::math::atan2(ys[i], xs[i]);
+	       }),
+	       time_ns([] {
+		       for (int i = 0; i < COUNT; i++) out_a[i] = std::atan2(ys[i], xs[i]);
+	       }));
+	printf("%-8s %8lu %8s %8lu\n", "hypot", time_ns([] { pros::math::hypot(xs, ys, out_a, COUNT); }), "-",
+	       time_ns([] {
+		       for (int i = 0; i < COUNT; i++) out_a[i] = std::hypot(xs[i], ys[i]);
+	       }));
+	printf("%-8s %8lu %8s %8lu\n", "rotate", time_ns([] { pros::math::rotate(xs, ys, 0.7f, out_a, out_b, COUNT); }),
+	       "-", time_ns([] {
+		       double const s = std::sin(0.7), c = std::cos(0.7);
+		       for (int i = 0; i < COUNT; i++) {
+			       out_a[i] = xs[i] * c - ys[i] * s;
+			       out_b[i] = xs[i] * s + ys[i] * c;
+		       }
+	       }));
+	sink = out_a[COUNT / 2] + out_b[COUNT / 2];
+}
+
+void opcontrol() {
+	accuracy();
+	speed();
+	while (true) pros::delay(1000);
+}
@@ -0,0 +1,59 @@
+/**
+ * \file tests/idle_work.c
+ *
+ * Test code for idle work and the idle usage
+ *
+ * Registers a callback which counts its runs, then prints how often it ran and
+ * how idle the CPU was, first with nothing else to do and then while a task
+ * keeps the CPU busy for most of each 10 ms. The callback should run far less
+ * while the CPU is busy, and the idle usage should drop by about 80%. After
+ * the callback is unregistered its count must stop changing.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+static volatile uint32_t count;
+
+static void counter(void* param, uint64_t deadline) {
+	(*(volatile uint32_t*)param)++;
+}
+
+static void busy(void* ign) {
+	uint32_t now = millis();
+	while (true) {
+		uint64_t const start = micros();
+		while (micros() - start < 8000) continue;
+		task_delay_until(&now, 10);
+	}
+}
+
+static void report(const char* label) {
+	uint32_t const before = count;
+	task_delay(2000);
+	idle_work_stats_s_t stats;
+	idle_work_get_stats(&stats);
+	printf("%s: %lu runs in 2 s, idle %.1f%%, %lu overruns, longest %lu us\n", label, count - before,
+	       idle_get_usage(), stats.overruns, stats.longest);
+}
+
+void opcontrol() {
+	int32_t const id = idle_work_register(counter, (void*)&count);
+	report("idle");
+	task_t const task = task_create(busy, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Busy");
+	report("busy");
+	task_delete(task);
+
+	idle_work_unregister(id);
+	uint32_t const after = count;
+	task_delay(100);
+	printf("unregistered: %s\n", count == after ? "no more runs" : "STILL RUNNING");
+
+	while (true) task_delay(1000);
+}
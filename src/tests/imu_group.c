@@ -0,0 +1,37 @@
+/**
+ * \file tests/imu_group.c
+ *
+ * Test code for Inertial Sensor groups
+ *
+ * Fuses Inertial Sensors on ports 1 and 2 and prints the fused rotation next
+ * to each sensor's own, every 100 ms. Leave the robot still for a minute: the
+ * fused rotation should drift less than either sensor once the biases have
+ * been learned. Turning it should move all three together, and unplugging
+ * one sensor should leave the fused rotation following the other.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+void opcontrol() {
+	static const uint8_t ports[] = {1, 2};
+	while (imu_get_status(1) & E_IMU_STATUS_CALIBRATING || imu_get_status(2) & E_IMU_STATUS_CALIBRATING) delay(10);
+	imu_group_t group = imu_group_create(ports, 2);
+	if (group == NULL) {
+		printf("couldn't create the group: %d\n", errno);
+		return;
+	}
+	while (true) {
+		imu_group_state_s_t state;
+		if (imu_group_get_state(group, &state) == 1) {
+			printf("fused %8.3f (%6.2f dps, %d sensors, rejected %x)  imu1 %8.3f  imu2 %8.3f\n", state.rotation, state.rate,
+			       state.sensors, state.rejected, imu_get_rotation(1), imu_get_rotation(2));
+		}
+		delay(100);
+	}
+}
@@ -0,0 +1,287 @@
+/**
+ * \file tests/kernel_bench.c
+ *
+ * Microbenchmarks for the kernel's primitives
+ *
+ * Every operation is timed on its own with the Cortex-A9's cycle counter and
+ * the cost of reading the counter is taken off. The results are printed as CSV
+ * with one row per operation:
+ *
+ *   name,param,iterations,min,mean,max
+ *
+ * where min, mean and max are CPU cycles (667 per microsecond) and param is
+ * the item or block size in bytes where the operation has one. The max picks
+ * up whatever interrupts landed in the middle of an operation, so compare min
+ * and mean between builds. For stream_buf rows the throughput in bytes per
+ * microsecond is param * 667 / mean.
+ *
+ * The motor and ADI rows use port 1 and port 'A' and cost about the same
+ * whether or not anything is plugged in there.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "kapi.h"
+#include "system/cycles.h"
+
+#define ITERATIONS 1000
+#define MAX_ITEM_SIZE 256
+#define BENCH_PRIORITY (TASK_PRIORITY_DEFAULT + 1)
+
+struct stats {
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint32_t count;
+};
+
+static uint32_t overhead;
+
+static void stats_reset(struct stats* stats) {
+	*stats = (struct stats){.min = UINT32_MAX};
+}
+
+static void stats_record(struct stats* stats, uint32_t elapsed) {
+	elapsed = elapsed > overhead ? elapsed - overhead : 0;
+	if (elapsed < stats->min) stats->min = elapsed;
+	if (elapsed > stats->max) stats->max = elapsed;
+	stats->total += elapsed;
+	stats->count++;
+}
+
+static void stats_print(const char* name, uint32_t param, const struct stats* stats) {
+	if (stats->count == 0) {
+		printf("%s,%lu,0,,,\n", name, param);
+		return;
+	}
+	printf("%s,%lu,%lu,%lu,%lu,%lu\n", name, param, stats->count, stats->min, (uint32_t)(stats->total / stats->count),
+	       stats->max);
+}
+
+// Times op on its own and records it in *stats
+#define MEASURE(stats, op)                      \
+	do {                                          \
+		uint32_t const _start = cycle_counter_get();           \
+		op;                                         \
+		stats_record((stats), cycle_counter_get() - _start);   \
+	} while (0)
+
+// Runs op ITERATIONS times and prints a row for it
+#define BENCH(name, param, op)                                      \
+	do {                                                              \
+		struct stats _stats;                                            \
+		stats_reset(&_stats);                                           \
+		for (int _i = 0; _i < ITERATIONS; _i++) MEASURE(&_stats, op);   \
+		stats_print((name), (param), &_stats);                          \
+	} while (0)
+
+static void calibrate(void) {
+	uint32_t best = UINT32_MAX;
+	for (int i = 0; i < ITERATIONS; i++) {
+		uint32_t const start = cycle_counter_get();
+		uint32_t const elapsed = cycle_counter_get() - start;
+		if (elapsed < best) best = elapsed;
+	}
+	overhead = best;
+}
+
+/******************************************************************************/
+/**                             Context switches                             **/
+/******************************************************************************/
+static struct stats switch_stats;
+static volatile uint32_t switch_mark;
+static volatile uint32_t switch_workers;
+
+// Two of these take turns with task_yield(). Each one times from just before
+// the other yielded to just after it was switched back in, until one of them
+// finishes and the other is left yielding to itself
+static void yield_worker(void* main_task) {
+	for (int i = 0; i < ITERATIONS; i++) {
+		uint32_t const now = cycle_counter_get();
+		if (switch_workers == 2 && switch_mark != 0) stats_record(&switch_stats, now - switch_mark);
+		switch_mark = cycle_counter_get();
+		task_yield();
+	}
+	switch_workers = 1;
+	task_notify(main_task);
+}
+
+static void bench_context_switch(void) {
+	stats_reset(&switch_stats);
+	switch_mark = 0;
+	switch_workers = 2;
+	task_t const self = task_get_current();
+	// Both workers have to be ready before either starts yielding to the other
+	task_set_priority(self, BENCH_PRIORITY + 1);
+	task_create(yield_worker, self, BENCH_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "yield a");
+	task_create(yield_worker, self, BENCH_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "yield b");
+	task_set_priority(self, TASK_PRIORITY_DEFAULT);
+	task_notify_take(false, TIMEOUT_MAX);
+	task_notify_take(false, TIMEOUT_MAX);
+	stats_print("context_switch", 0, &switch_stats);
+}
+
+/******************************************************************************/
+/**                                 Mutexes                                  **/
+/******************************************************************************/
+static mutex_t bench_mutex;  // kept between runs since mutexes can't be deleted
+
+// Takes the mutex whenever the main task asks, and gives it back as soon as the
+// main task blocks on it
+static void mutex_holder(void* main_task) {
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		mutex_take(bench_mutex, TIMEOUT_MAX);
+		task_notify(main_task);
+		mutex_give(bench_mutex);
+	}
+}
+
+static void bench_mutex_ops(void) {
+	if (bench_mutex == NULL) bench_mutex = mutex_create();
+	BENCH("mutex_take_give", 0, {
+		mutex_take(bench_mutex, TIMEOUT_MAX);
+		mutex_give(bench_mutex);
+	});
+	struct stats take, give;
+	stats_reset(&take);
+	stats_reset(&give);
+	for (int i = 0; i < ITERATIONS; i++) {
+		MEASURE(&take, mutex_take(bench_mutex, TIMEOUT_MAX));
+		MEASURE(&give, mutex_give(bench_mutex));
+	}
+	stats_print("mutex_take", 0, &take);
+	stats_print("mutex_give", 0, &give);
+
+	// The holder runs below us, so taking the mutex from it means switching to
+	// it at our priority, it giving the mutex back and switching back to us
+	task_t const holder =
+	    task_create(mutex_holder, task_get_current(), TASK_PRIORITY_DEFAULT - 1, TASK_STACK_DEPTH_DEFAULT, "holder");
+	stats_reset(&take);
+	for (int i = 0; i < ITERATIONS; i++) {
+		task_notify(holder);
+		task_notify_take(true, TIMEOUT_MAX);
+		MEASURE(&take, mutex_take(bench_mutex, TIMEOUT_MAX));
+		mutex_give(bench_mutex);
+	}
+	stats_print("mutex_take_contended", 0, &take);
+	task_delete(holder);
+}
+
+/******************************************************************************/
+/**                                  Queues                                  **/
+/******************************************************************************/
+static const uint32_t item_sizes[] = {4, 16, 64, 256};
+
+static void bench_queue_ops(void) {
+	static uint8_t item[MAX_ITEM_SIZE];
+	for (size_t s = 0; s < sizeof(item_sizes) / sizeof(item_sizes[0]); s++) {
+		queue_t const queue = queue_create(1, item_sizes[s]);
+		struct stats append, recv;
+		stats_reset(&append);
+		stats_reset(&recv);
+		for (int i = 0; i < ITERATIONS; i++) {
+			MEASURE(&append, queue_append(queue, item, TIMEOUT_MAX));
+			MEASURE(&recv, queue_recv(queue, item, TIMEOUT_MAX));
+		}
+		stats_print("queue_append", item_sizes[s], &append);
+		stats_print("queue_recv", item_sizes[s], &recv);
+		queue_delete(queue);
+	}
+}
+
+/******************************************************************************/
+/**                              Notifications                               **/
+/******************************************************************************/
+static void notify_echo(void* main_task) {
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		task_notify(main_task);
+	}
+}
+
+static void bench_notify(void) {
+	task_t const echo =
+	    task_create(notify_echo, task_get_current(), BENCH_PRIORITY, TASK_STACK_DEPTH_DEFAULT, "echo");
+	BENCH("task_notify_round_trip", 0, {
+		task_notify(echo);
+		task_notify_take(true, TIMEOUT_MAX);
+	});
+	task_delete(echo);
+}
+
+/******************************************************************************/
+/**                               Kernel heap                                **/
+/******************************************************************************/
+static const uint32_t block_sizes[] = {16, 64, 256, 1024, 4096};
+
+static void bench_kernel_heap(void) {
+	for (size_t s = 0; s < sizeof(block_sizes) / sizeof(block_sizes[0]); s++) {
+		struct stats alloc, release;
+		stats_reset(&alloc);
+		stats_reset(&release);
+		for (int i = 0; i < ITERATIONS; i++) {
+			void* block;
+			MEASURE(&alloc, block = kmalloc(block_sizes[s]));
+			MEASURE(&release, kfree(block));
+		}
+		stats_print("kmalloc", block_sizes[s], &alloc);
+		stats_print("kfree", block_sizes[s], &release);
+	}
+}
+
+/******************************************************************************/
+/**                              Stream buffers                              **/
+/******************************************************************************/
+static const uint32_t chunk_sizes[] = {1, 16, 64, 256};
+
+static void bench_stream_buf(void) {
+	static uint8_t chunk[MAX_ITEM_SIZE];
+	stream_buf_t const buf = stream_buf_create(4 * MAX_ITEM_SIZE, 1);
+	for (size_t s = 0; s < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); s++) {
+		struct stats send, recv;
+		stats_reset(&send);
+		stats_reset(&recv);
+		for (int i = 0; i < ITERATIONS; i++) {
+			MEASURE(&send, stream_buf_send(buf, chunk, chunk_sizes[s], TIMEOUT_MAX));
+			MEASURE(&recv, stream_buf_recv(buf, chunk, chunk_sizes[s], TIMEOUT_MAX));
+		}
+		stats_print("stream_buf_send", chunk_sizes[s], &send);
+		stats_print("stream_buf_recv", chunk_sizes[s], &recv);
+	}
+	vStreamBufferDelete(buf);
+}
+
+/******************************************************************************/
+/**                                 Devices                                  **/
+/******************************************************************************/
+static void bench_devices(void) {
+	static volatile double sink_double;
+	static volatile int32_t sink_int;
+	BENCH("motor_get_position", 0, sink_double = motor_get_position(1));
+	BENCH("motor_get_actual_velocity", 0, sink_double = motor_get_actual_velocity(1));
+	BENCH("motor_get_current_draw", 0, sink_int = motor_get_current_draw(1));
+	BENCH("adi_analog_read", 0, sink_int = adi_analog_read('A'));
+	BENCH("adi_digital_read", 0, sink_int = adi_digital_read('A'));
+}
+
+void opcontrol() {
+	cycle_counter_enable();
+	calibrate();
+	while (true) {
+		printf("name,param,iterations,min,mean,max\n");
+		bench_context_switch();
+		bench_mutex_ops();
+		bench_queue_ops();
+		bench_notify();
+		bench_kernel_heap();
+		bench_stream_buf();
+		bench_devices();
+		printf("\n");
+		delay(5000);
+	}
+}
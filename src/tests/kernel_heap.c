@@ -0,0 +1,53 @@
+/**
+ * \file tests/kernel_heap.c
+ *
+ * Test code for the kernel heap
+ *
+ * Churns through random allocations and reports the slowest kmalloc() and
+ * kfree() along with the state of the heap. The worst case should stay flat
+ * no matter how long the test runs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdlib.h>
+
+#include "kapi.h"
+#include "v5_api.h"
+
+#define SLOTS 256
+
+void opcontrol() {
+	void* blocks[SLOTS] = {0};
+	uint32_t max_alloc_us = 0;
+	uint32_t max_free_us = 0;
+	for (uint32_t round = 0;; round++) {
+		for (int i = 0; i < 10000; i++) {
+			int slot = rand() % SLOTS;
+			uint64_t start = vexSystemHighResTimeGet();
+			if (blocks[slot] == NULL) {
+				// Mostly small blocks, with the occasional large one to break the heap up
+				blocks[slot] = kmalloc(rand() % 8 ? rand() % 256 + 1 : rand() % 8192 + 1);
+				uint32_t us = vexSystemHighResTimeGet() - start;
+				if (us > max_alloc_us) max_alloc_us = us;
+			} else {
+				kfree(blocks[slot]);
+				blocks[slot] = NULL;
+				uint32_t us = vexSystemHighResTimeGet() - start;
+				if (us > max_free_us) max_free_us = us;
+			}
+		}
+
+		heap_stats_s_t stats;
+		heap_get_stats(&stats);
+		printf("round %lu: kmalloc <= %lu us, kfree <= %lu us, %lu/%lu bytes free in %lu blocks, largest %lu, "
+		       "fragmentation %.3f, min free %lu\n",
+		       round, max_alloc_us, max_free_us, stats.free_bytes, stats.total_bytes, stats.free_blocks,
+		       stats.largest_free_block, stats.fragmentation, stats.min_free_bytes);
+		delay(100);
+	}
+}
@@ -0,0 +1,63 @@
+/**
+ * \file tests/latency_probe.c
+ *
+ * Test code for the input latency probe
+ *
+ * Drives the motor on port 1 from the master controller's left joystick, and
+ * prints the latency statistics every 5 seconds. With batching off the output
+ * stage should stay under one daemon cycle (2 ms), and the input stage should
+ * be about the opcontrol loop's 10 ms delay or less. Wiggle the joystick while
+ * it runs.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+static const char* const stage_names[E_LATENCY_PROBE_STAGE_COUNT] = {"input", "output", "total"};
+
+static void print_stats(void) {
+	static const uint32_t bounds[LATENCY_PROBE_HISTOGRAM_BUCKETS] = LATENCY_PROBE_HISTOGRAM_BOUNDS;
+	latency_probe_stats_s_t stats;
+	latency_probe_get_stats(&stats);
+	printf("%lu samples, %lu expired, %lu replaced\n", stats.samples, stats.expired, stats.replaced);
+	for (int s = 0; s < E_LATENCY_PROBE_STAGE_COUNT; s++) {
+		const latency_probe_stage_stats_s_t* const stage = &stats.stages[s];
+		uint32_t const mean = stats.samples ? (uint32_t)(stage->total_us / stats.samples) : 0;
+		printf("%-6s mean %lu us, max %lu us:", stage_names[s], mean, stage->max_us);
+		for (int b = 0; b < LATENCY_PROBE_HISTOGRAM_BUCKETS; b++) {
+			if (bounds[b] == UINT32_MAX) {
+				printf(" rest=%lu", stage->histogram[b]);
+			} else {
+				printf(" <%lu=%lu", bounds[b], stage->histogram[b]);
+			}
+		}
+		printf("\n");
+	}
+}
+
+void opcontrol() {
+	latency_probe_start();
+	uint32_t last_input = 0;
+	uint32_t last_print = millis();
+	while (true) {
+		uint32_t const input = latency_probe_get_input();
+		controller_state_s_t state;
+		controller_get_state(E_CONTROLLER_MASTER, &state);
+		if (input != last_input) {
+			latency_probe_tag(1, input);
+			last_input = input;
+		}
+		motor_move(1, state.analog[E_CONTROLLER_ANALOG_LEFT_Y]);
+		if (millis() - last_print >= 5000) {
+			print_stats();
+			last_print = millis();
+		}
+		delay(10);
+	}
+}
@@ -0,0 +1,103 @@
+/**
+ * \file tests/linalg.cpp
+ *
+ * Accuracy and speed of pros/linalg.hpp
+ *
+ * Inverts a well conditioned 6x6 matrix and prints the largest error of the
+ * product with its inverse against the identity, which should be below 1e-5,
+ * and times a 6x6 multiply and a 6 state EKF step in nanoseconds. Then runs a
+ * PoseFilter on a simulated robot driving a circle with drifting odometry and
+ * a heading fix every 10 steps, printing the filtered heading error, which
+ * should stay well below the odometry's.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <cmath>
+#include <cstdio>
+
+#include "main.h"
+#include "pros/linalg.hpp"
+
+using pros::linalg::Matrix;
+using pros::linalg::Vector;
+
+#define ROUNDS 10000
+
+static volatile float sink;
+
+static Matrix<6, 6> test_matrix() {
+	Matrix<6, 6> a;
+	for (std::size_t i = 0; i < 6; i++) {
+		for (std::size_t j = 0; j < 6; j++) a(i, j) = i == j ? 8.0f : std::sin(1.0f + i * 6 + j);
+	}
+	return a;
+}
+
+static void accuracy() {
+	Matrix<6, 6> const a = test_matrix();
+	Matrix<6, 6> a_inv;
+	if (!pros::linalg::inverse(a, &a_inv)) {
+		printf("inverse failed\n");
+		return;
+	}
+	Matrix<6, 6> const product = a * a_inv;
+	float err = 0;
+	for (std::size_t i = 0; i < 6; i++) {
+		for (std::size_t j = 0; j < 6; j++) err = std::fmax(err, std::fabs(product(i, j) - (i == j ? 1.0f : 0.0f)));
+	}
+	printf("6x6 inverse error %g\n", err);
+}
+
+static void speed() {
+	Matrix<6, 6> a = test_matrix();
+	Matrix<6, 6> const b = test_matrix() * 0.1f;
+	uint64_t start = pros::c::micros();
+	for (int i = 0; i < ROUNDS; i++) a = a * b;
+	sink = a(0, 0);
+	printf("6x6 multiply %llu ns\n", (pros::c::micros() - start) * 1000 / ROUNDS);
+
+	pros::linalg::Ekf<6> ekf;
+	Matrix<6, 6> const F = Matrix<6, 6>::identity();
+	Matrix<6, 6> const Q = Matrix<6, 6>::identity() * 0.01f;
+	Matrix<3, 6> const H{1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0};
+	Matrix<3, 3> const R = Matrix<3, 3>::identity() * 0.1f;
+	start = pros::c::micros();
+	for (int i = 0; i < ROUNDS; i++) {
+		ekf.predict(ekf.state(), F, Q);
+		ekf.update(Vector<3>{0.1f, -0.1f, 0.05f}, H, R);
+	}
+	sink = ekf.state()[0];
+	printf("6 state EKF step %llu ns\n", (pros::c::micros() - start) * 1000 / ROUNDS);
+}
+
+static void fusion() {
+	pros::linalg::PoseFilter filter(0.01f, 0.01f);
+	pros::c::odom_pose_s_t odom{0, 0, 0, 0};
+	double true_theta = 0;
+	for (uint32_t step = 1; step <= 1000; step++) {
+		// 1 degree per step truly, and the odometry sees 1.05
+		true_theta += 1;
+		double const theta = odom.theta * M_PI / 180;
+		odom.x += std::sin(theta);
+		odom.y += std::cos(theta);
+		odom.theta += 1.05;
+		odom.timestamp = step;
+		filter.predict(odom);
+		if (step % 10 == 0) filter.update_heading(true_theta, 0.0001f);
+		if (step % 100 == 0) {
+			printf("step %lu: odometry heading error %.2f, filtered %.2f\n", step, odom.theta - true_theta,
+			       filter.pose().theta - true_theta);
+		}
+	}
+}
+
+void opcontrol() {
+	accuracy();
+	speed();
+	fusion();
+}
@@ -0,0 +1,161 @@
+/**
+ * \file tests/mem_bench.c
+ *
+ * Benchmark for the kernel's memcpy, memset and memcmp
+ *
+ * The kernel's versions replace newlib's in the link, so the newlib_* functions
+ * below follow newlib's generic C versions instead: a word at a time, four
+ * words per loop, when the pointers are aligned and a byte at a time
+ * otherwise. Prints the time per call in nanoseconds for each size, both with
+ * the blocks aligned and with the source one byte off. The kernel's column
+ * should never be the slower one; where it is, move the thresholds at the top
+ * of system/mem.c.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#include <string.h>
+
+#define REF_FN __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+#define UNALIGNED(x, y) (((uint32_t)(x) | (uint32_t)(y)) & 3)
+
+#define MAX_SIZE 4096
+#define ROUNDS 200
+
+static uint32_t src_buf[MAX_SIZE / 4 + 1];
+static uint32_t dst_buf[MAX_SIZE / 4 + 1];
+static const size_t sizes[] = {4, 8, 16, 32, 64, 96, 128, 256, 512, 1024, 4096};
+
+REF_FN static void* newlib_memcpy(void* dest, void const* src, size_t n) {
+	uint8_t* d = dest;
+	uint8_t const* s = src;
+	if (n >= 16 && !UNALIGNED(d, s)) {
+		uint32_t* dw = (uint32_t*)d;
+		uint32_t const* sw = (uint32_t const*)s;
+		for (; n >= 16; n -= 16) {
+			*dw++ = *sw++;
+			*dw++ = *sw++;
+			*dw++ = *sw++;
+			*dw++ = *sw++;
+		}
+		for (; n >= 4; n -= 4) *dw++ = *sw++;
+		d = (uint8_t*)dw;
+		s = (uint8_t const*)sw;
+	}
+	while (n--) *d++ = *s++;
+	return dest;
+}
+
+REF_FN static void* newlib_memset(void* dest, int c, size_t n) {
+	uint8_t* d = dest;
+	while (((uint32_t)d & 3) && n) {
+		*d++ = c;
+		n--;
+	}
+	if (n >= 4) {
+		uint32_t word = (uint8_t)c * 0x01010101u;
+		uint32_t* dw = (uint32_t*)d;
+		for (; n >= 16; n -= 16) {
+			*dw++ = word;
+			*dw++ = word;
+			*dw++ = word;
+			*dw++ = word;
+		}
+		for (; n >= 4; n -= 4) *dw++ = word;
+		d = (uint8_t*)dw;
+	}
+	while (n--) *d++ = c;
+	return dest;
+}
+
+REF_FN static int newlib_memcmp(void const* a, void const* b, size_t n) {
+	uint8_t const* x = a;
+	uint8_t const* y = b;
+	if (n >= 4 && !UNALIGNED(x, y)) {
+		uint32_t const* xw = (uint32_t const*)x;
+		uint32_t const* yw = (uint32_t const*)y;
+		for (; n >= 4 && *xw == *yw; n -= 4) {
+			xw++;
+			yw++;
+		}
+		x = (uint8_t const*)xw;
+		y = (uint8_t const*)yw;
+	}
+	for (; n; n--, x++, y++) {
+		if (*x != *y) return *x - *y;
+	}
+	return 0;
+}
+
+// Calls through volatile pointers so GCC can't inline or fold the kernel's
+// functions as builtins
+static void* (*volatile kernel_memcpy)(void*, void const*, size_t) = memcpy;
+static void* (*volatile kernel_memset)(void*, int, size_t) = memset;
+static int (*volatile kernel_memcmp)(void const*, void const*, size_t) = memcmp;
+
+#define TIME_NS(call)                               \
+	({                                                \
+		uint64_t start = micros();                      \
+		for (int r = 0; r < ROUNDS; r++) call;          \
+		(uint32_t)((micros() - start) * 1000 / ROUNDS); \
+	})
+
+static void bench(size_t offset) {
+	uint8_t* src = (uint8_t*)src_buf + offset;
+	uint8_t* dst = (uint8_t*)dst_buf;
+	printf("source offset %u: size, memcpy newlib/kernel, memset newlib/kernel, memcmp newlib/kernel (ns)\n",
+	       offset);
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+		size_t n = sizes[i];
+		memset(src, 0x5A, n);
+		memset(dst, 0x5A, n);
+		// Equal blocks are the worst case for memcmp
+		uint32_t cpy_ref = TIME_NS(newlib_memcpy(dst, src, n));
+		uint32_t cpy = TIME_NS(kernel_memcpy(dst, src, n));
+		uint32_t set_ref = TIME_NS(newlib_memset(dst, 0x5A, n));
+		uint32_t set = TIME_NS(kernel_memset(dst, 0x5A, n));
+		uint32_t cmp_ref = TIME_NS(newlib_memcmp(dst, src, n));
+		uint32_t cmp = TIME_NS(kernel_memcmp(dst, src, n));
+		printf("%5u %7lu %7lu %7lu %7lu %7lu %7lu\n", n, cpy_ref, cpy, set_ref, set, cmp_ref, cmp);
+		delay(2);
+	}
+}
+
+static bool check(void) {
+	uint8_t* src = (uint8_t*)src_buf;
+	uint8_t* dst = (uint8_t*)dst_buf;
+	for (size_t i = 0; i < MAX_SIZE; i++) src[i] = i * 7;
+	for (size_t n = 0; n < 300; n++) {
+		for (size_t off = 0; off < 4; off++) {
+			memset(dst, 0xEE, n + 8);
+			kernel_memcpy(dst + off, src + 3, n);
+			if (newlib_memcmp(dst + off, src + 3, n) || dst[off + n] != 0xEE) return false;
+			if (n && kernel_memcmp(dst + off, src + 3, n)) return false;
+			if (n) {
+				dst[off + n - 1] ^= 0x80;
+				bool greater = newlib_memcmp(dst + off, src + 3, n) > 0;
+				if ((kernel_memcmp(dst + off, src + 3, n) > 0) != greater) return false;
+			}
+			kernel_memset(dst + off, 0x33, n);
+			for (size_t j = 0; j < n; j++) {
+				if (dst[off + j] != 0x33) return false;
+			}
+		}
+	}
+	return true;
+}
+
+void opcontrol() {
+	printf("results %s\n", check() ? "match" : "DO NOT MATCH");
+	while (true) {
+		bench(0);
+		bench(1);
+		delay(5000);
+	}
+}
@@ -0,0 +1,17 @@
+#include "main.h"
+
+void opcontrol() {
+	pros::Motor motor(1);
+	pros::Controller master(E_CONTROLLER_MASTER);
+	motor_controller_s_t controller = {E_MOTOR_CONTROLLER_VELOCITY, 60, 20, 0.5, 0, 100};
+	motor.enable_controller(controller);
+	while (true) {
+		motor.set_controller_target(master.get_analog(E_CONTROLLER_ANALOG_LEFT_Y) * 200 / 127);
+		printf("velocity %f voltage %ld\n", motor.get_actual_velocity(), motor.get_voltage());
+		if (master.get_digital(E_CONTROLLER_DIGITAL_A)) {
+			motor.disable_controller();
+			break;
+		}
+		pros::delay(20);
+	}
+}
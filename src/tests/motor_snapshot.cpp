@@ -0,0 +1,13 @@
+#include "main.h"
+
+void opcontrol() {
+	pros::Motor motor(1);
+	pros::Controller master(E_CONTROLLER_MASTER);
+	while (true) {
+		motor.move(master.get_analog(E_CONTROLLER_ANALOG_LEFT_Y));
+		motor_snapshot_s_t snapshot = motor.snapshot();
+		printf("%lu: pos %f vel %f current %ld temp %f\n", snapshot.timestamp, snapshot.position, snapshot.velocity,
+		       snapshot.current_draw, snapshot.temperature);
+		pros::delay(20);
+	}
+}
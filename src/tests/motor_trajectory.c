@@ -0,0 +1,89 @@
+/**
+ * \file tests/motor_trajectory.c
+ *
+ * Test code for motor trajectories
+ *
+ * Builds a trapezoidal profile that turns motors on ports 1 and 2 (the second
+ * reversed) through 1800 degrees and back, plays it in the kernel, and prints
+ * where the motors ended up against where the profile said they should be.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#define DISTANCE 1800.0   // degrees
+#define MAX_VELOCITY 0.6  // degrees per millisecond
+#define ACCELERATION 0.002
+#define STEP 10  // milliseconds between points
+
+static motor_trajectory_point_s_t points[1000];
+
+// Fills points with a trapezoidal profile over the given distance
+static uint32_t build_profile(double distance) {
+	double direction = distance < 0 ? -1 : 1;
+	distance = fabs(distance);
+	double ramp_time = MAX_VELOCITY / ACCELERATION;
+	double ramp_distance = 0.5 * ACCELERATION * ramp_time * ramp_time;
+	double peak = MAX_VELOCITY;
+	if (2 * ramp_distance > distance) {
+		ramp_time = sqrt(distance / ACCELERATION);
+		ramp_distance = distance / 2;
+		peak = ACCELERATION * ramp_time;
+	}
+	double cruise_time = (distance - 2 * ramp_distance) / peak;
+	double total = 2 * ramp_time + cruise_time;
+
+	uint32_t n = 0;
+	for (double t = 0; n < sizeof(points) / sizeof(points[0]); t += STEP) {
+		if (t > total) t = total;
+		double position, velocity;
+		if (t < ramp_time) {
+			velocity = ACCELERATION * t;
+			position = 0.5 * ACCELERATION * t * t;
+		} else if (t < ramp_time + cruise_time) {
+			velocity = peak;
+			position = ramp_distance + peak * (t - ramp_time);
+		} else {
+			double left = total - t;
+			velocity = ACCELERATION * left;
+			position = distance - 0.5 * ACCELERATION * left * left;
+		}
+		points[n].time = (uint32_t)t;
+		points[n].position = direction * position;
+		points[n].velocity = direction * velocity * 1000 * 60 / 360;  // rpm
+		points[n].voltage = direction * velocity * 20000;
+		if (n > 0 && points[n].time <= points[n - 1].time) break;
+		n++;
+		if (t == total) break;
+	}
+	return n;
+}
+
+void opcontrol() {
+	int8_t ports[] = {1, -2};
+	motor_trajectory_gains_s_t gains = {.kp = 20, .kv = 10};
+	motor_tare_position(1);
+	motor_tare_position(2);
+
+	for (double distance = DISTANCE; true; distance = -distance) {
+		uint32_t n = build_profile(distance);
+		for (uint32_t i = 0; i < n; i++) points[i].position += distance < 0 ? -distance : 0;
+		motor_trajectory_t trajectory = motor_trajectory_load(ports, 2, points, n, &gains);
+		if (trajectory == NULL) {
+			printf("Couldn't load the trajectory (errno %d)\n", errno);
+			return;
+		}
+		uint32_t start = millis();
+		motor_trajectory_start(trajectory);
+		motor_trajectory_wait(trajectory, TIMEOUT_MAX);
+		printf("%lu points in %lu ms: port 1 at %f, port 2 at %f, target %f\n", n, millis() - start,
+		       motor_get_position(1), motor_get_position(2), points[n - 1].position);
+		motor_trajectory_delete(trajectory);
+		delay(1000);
+	}
+}
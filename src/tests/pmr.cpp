@@ -0,0 +1,68 @@
+/**
+ * \file tests/pmr.cpp
+ *
+ * Test code for the memory resources in pros/pmr.hpp
+ *
+ * Fills a vector and a map from an arena and a pool once per control loop
+ * iteration, releasing the arena each time, and times that against the same
+ * containers on the heap with std::chrono::steady_clock. The arena's peak
+ * should be a single iteration's worth, and neither resource should miss until
+ * the last run, which deliberately outgrows both and should count the misses
+ * that fell back to the heap.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <chrono>
+#include <map>
+#include <vector>
+
+#include "main.h"
+#include "pros/pmr.hpp"
+
+#define ITERATIONS 100
+#define ITEMS 64
+
+static pros::pmr::arena_resource<2048> arena(std::pmr::new_delete_resource());
+static pros::pmr::pool_resource<32, ITEMS> pool(std::pmr::new_delete_resource());
+
+static void fill(std::pmr::memory_resource* vector_resource, std::pmr::memory_resource* map_resource, int items) {
+	std::pmr::vector<int> values(vector_resource);
+	std::pmr::map<int, int> index(map_resource);
+	values.reserve(items);
+	for (int i = 0; i < items; i++) {
+		values.push_back(i * 3);
+		index.emplace(i, i * 3);
+	}
+}
+
+// Microseconds per iteration of filling the containers from the given resources
+static int64_t time_us(std::pmr::memory_resource* vector_resource, std::pmr::memory_resource* map_resource,
+                       bool release) {
+	auto const start = std::chrono::steady_clock::now();
+	for (int i = 0; i < ITERATIONS; i++) {
+		fill(vector_resource, map_resource, ITEMS);
+		if (release) arena.release();
+	}
+	auto const elapsed = std::chrono::steady_clock::now() - start;
+	return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / ITERATIONS;
+}
+
+void opcontrol() {
+	int64_t const kernel = time_us(&arena, &pool, true);
+	printf("arena and pool: %lld us per iteration, arena peak %u bytes, misses %lu and %lu\n", kernel, arena.peak(),
+	       arena.misses(), pool.misses());
+	int64_t const heap = time_us(std::pmr::new_delete_resource(), std::pmr::new_delete_resource(), false);
+	printf("heap: %lld us per iteration\n", heap);
+
+	fill(&arena, &pool, ITEMS * 16);
+	arena.release();
+	printf("outgrown: arena misses %lu, pool misses %lu, %lu blocks free\n", arena.misses(), pool.misses(),
+	       pool.available());
+
+	while (true) pros::delay(1000);
+}
@@ -0,0 +1,63 @@
+/**
+ * \file tests/profiler.c
+ *
+ * Test code for backtraces and the sampling profiler
+ *
+ * A worker task spends about three times as long in spin_long() as in
+ * spin_short(). After 5 seconds of sampling the profile is sent on the 'prof'
+ * stream, where the host tool should show both functions under worker() in
+ * roughly that ratio. The worker's backtrace is printed every second and
+ * should end in spin_long() or spin_short() called from worker().
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+static volatile uint32_t sink;
+
+static void __attribute__((noinline)) spin_for(uint32_t us) {
+	uint32_t start = micros();
+	while (micros() - start < us) sink++;
+}
+
+static void __attribute__((noinline)) spin_long(void) {
+	spin_for(3000);
+}
+
+static void __attribute__((noinline)) spin_short(void) {
+	spin_for(1000);
+}
+
+static void worker(void* ign) {
+	while (true) {
+		spin_long();
+		spin_short();
+		delay(1);
+	}
+}
+
+void opcontrol() {
+	task_t task = task_create(worker, NULL, TASK_PRIORITY_DEFAULT - 1, TASK_STACK_DEPTH_DEFAULT, "worker");
+	if (profiler_start(1024, 4) != 1) {
+		printf("couldn't start the profiler: %d\n", errno);
+		return;
+	}
+
+	uint32_t pcs[8];
+	for (int i = 0; i < 5; i++) {
+		delay(1000);
+		int32_t count = task_get_backtrace(task, pcs, 8);
+		printf("worker backtrace (%ld):", count);
+		for (int32_t j = 0; j < count && count != PROS_ERR; j++) printf(" %p", (void*)pcs[j]);
+		printf("\n");
+	}
+
+	printf("sent %ld buckets\n", profiler_dump());
+	task_delete(task);
+}
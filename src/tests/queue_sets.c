@@ -0,0 +1,80 @@
+/**
+ * \file tests/queue_sets.c
+ *
+ * Test code for queue sets
+ *
+ * Waits in one place on a queue fed every 30 ms, a semaphore posted every
+ * 100 ms and the device update semaphore for port 1. Every second it prints
+ * how often each one was selected, which should be about 33, 10 and, with a
+ * device plugged into port 1, 100 or more. Any receive which fails after a
+ * select is a bug.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+#define QUEUE_LENGTH 4
+
+static queue_t values;
+static sem_t ticks;
+
+static void feed_values(void* ign) {
+	uint32_t value = 0;
+	while (true) {
+		queue_append(values, &value, TIMEOUT_MAX);
+		value++;
+		delay(30);
+	}
+}
+
+static void post_ticks(void* ign) {
+	while (true) {
+		sem_post(ticks);
+		delay(100);
+	}
+}
+
+void opcontrol() {
+	values = queue_create(QUEUE_LENGTH, sizeof(uint32_t));
+	ticks = sem_binary_create();
+
+	queue_set_t set = queue_set_create(QUEUE_LENGTH + 2);
+	// The update semaphore joins the set before the daemon can post it
+	sem_t updates = vdml_update_sem_create(1 << 0, set);
+	if (updates == NULL || !queue_set_add(set, values) || !queue_set_add(set, ticks)) {
+		printf("couldn't add to the set: %d\n", errno);
+		return;
+	}
+	task_create(feed_values, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "values");
+	task_create(post_ticks, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "ticks");
+
+	uint32_t value_count = 0, tick_count = 0, update_count = 0, failures = 0;
+	uint32_t report = millis() + 1000;
+	while (true) {
+		void* ready = queue_set_select(set, 50);
+		if (ready == values) {
+			uint32_t value;
+			if (!queue_recv(values, &value, 0)) failures++;
+			value_count++;
+		} else if (ready == ticks) {
+			if (!sem_wait(ticks, 0)) failures++;
+			tick_count++;
+		} else if (ready == updates) {
+			if (!sem_wait(updates, 0)) failures++;
+			update_count++;
+		}
+
+		if ((int32_t)(millis() - report) >= 0) {
+			printf("values %lu, ticks %lu, port 1 updates %lu, failed receives %lu\n", value_count, tick_count,
+			       update_count, failures);
+			value_count = tick_count = update_count = 0;
+			report += 1000;
+		}
+	}
+}
@@ -0,0 +1,36 @@
+/**
+ * \file tests/ser_param.c
+ *
+ * Test code for serial parameters
+ *
+ * NOTE: There should be a motor plugged into port 1. Tune the gains from the
+ * host with "pRv" requests while the motor runs
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+void opcontrol() {
+	float kp = 0.5;
+	float kd = 0;
+	int32_t target = 0;
+	ser_param_register_float("kp", &kp);
+	ser_param_register_float("kd", &kd);
+	ser_param_register_int32("target", &target);
+	double last_error = 0;
+	while (true) {
+		if (ser_param_apply()) {
+			printf("kp %f kd %f target %ld\n", kp, kd, target);
+		}
+		double error = target - motor_get_position(1);
+		motor_move(1, kp * error + kd * (error - last_error));
+		last_error = error;
+		delay(10);
+	}
+}
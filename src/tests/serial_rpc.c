@@ -0,0 +1,73 @@
+/**
+ * \file tests/serial_rpc.c
+ *
+ * Test code for serial RPC
+ *
+ * Expects smart ports 1 and 2 to be wired to each other. A task on port 2
+ * plays the coprocessor, answering each request with the sum of its
+ * arguments, while opcontrol calls it from port 1 and prints how long each
+ * call took. Calls should take well under a millisecond plus the time the
+ * frames spend on the wire, and method 2 should fail with EPROTO.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "pros/serial.h"
+
+#define CALLER_PORT 1
+#define COPROCESSOR_PORT 2
+#define BAUDRATE 921600
+
+typedef struct add_args {
+	int32_t a;
+	int32_t b;
+} add_args_s_t;
+
+SERIAL_RPC_METHOD(rpc_add, 1, add_args_s_t, int32_t)
+SERIAL_RPC_METHOD(rpc_refused, 2, add_args_s_t, int32_t)
+
+static void coprocessor(void* ign) {
+	uint8_t request[SERIAL_MAX_FRAME_SIZE];
+	while (true) {
+		int32_t len = serial_read_frame(COPROCESSOR_PORT, request, sizeof(request), TIMEOUT_MAX);
+		if (len != 2 + sizeof(add_args_s_t)) continue;
+		add_args_s_t args;
+		memcpy(&args, request + 2, sizeof(args));
+		int32_t const sum = args.a + args.b;
+		uint8_t response[3 + sizeof(sum)] = {SERIAL_RPC_RESPONSE, request[1], request[0] == 1 ? 0 : 1};
+		memcpy(response + 3, &sum, sizeof(sum));
+		serial_write_frame(COPROCESSOR_PORT, response, sizeof(response));
+	}
+}
+
+void opcontrol() {
+	for (uint8_t port = CALLER_PORT; port <= COPROCESSOR_PORT; port++) {
+		serial_enable(port);
+		serial_set_baudrate(port, BAUDRATE);
+		serial_set_framing(port, E_SERIAL_FRAMING_LENGTH_CRC);
+	}
+	serial_rpc_enable(CALLER_PORT);
+	task_create(coprocessor, NULL, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_DEFAULT, "Coprocessor");
+
+	int32_t i = 0;
+	while (true) {
+		add_args_s_t const args = {.a = i, .b = 2 * i};
+		int32_t sum = 0;
+		uint64_t const start = micros();
+		int32_t const len = rpc_add(CALLER_PORT, &args, &sum, 10);
+		uint64_t const end = micros();
+		printf("%ld + %ld = %ld (%ld bytes) in %llu us\n", args.a, args.b, sum, len, end - start);
+		if (rpc_refused(CALLER_PORT, &args, &sum, 10) != PROS_ERR || errno != EPROTO) printf("refusal not seen\n");
+		i++;
+		delay(100);
+	}
+}
@@ -0,0 +1,65 @@
+/**
+ * \file tests/task_snapshot.c
+ *
+ * Test code for task lookup by name and task list snapshots
+ *
+ * Creates a batch of tasks, finds each by name and times the lookups, then
+ * prints a snapshot of every task along with how long the first and a later
+ * snapshot took. The later one should be much quicker, since only the stack
+ * used in between is scanned. A deleted task must no longer be found.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+#define NUM_TASKS 24
+#define MAX_SNAPSHOT 64
+
+static const char* const state_names[] = {"running", "ready", "blocked", "suspended", "deleted", "invalid"};
+
+static task_t tasks[NUM_TASKS];
+static task_snapshot_s_t snapshot[MAX_SNAPSHOT];
+
+static void worker(void* ign) {
+	while (true) task_delay(10);
+}
+
+void opcontrol() {
+	char name[TASK_NAME_MAX_LEN];
+	for (int i = 0; i < NUM_TASKS; i++) {
+		snprintf(name, sizeof(name), "Worker %d", i);
+		tasks[i] = task_create(worker, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, name);
+	}
+
+	uint64_t start = micros();
+	int found = 0;
+	for (int i = 0; i < NUM_TASKS; i++) {
+		snprintf(name, sizeof(name), "Worker %d", i);
+		found += task_get_by_name(name) == tasks[i];
+	}
+	printf("found %d of %d tasks by name, %llu us per lookup\n", found, NUM_TASKS, (micros() - start) / NUM_TASKS);
+
+	task_delete(tasks[0]);
+	printf("deleted task %s\n", task_get_by_name("Worker 0") == NULL ? "not found" : "STILL FOUND");
+
+	start = micros();
+	int32_t count = task_list_snapshot(snapshot, MAX_SNAPSHOT);
+	uint32_t const first = micros() - start;
+	task_delay(100);
+	start = micros();
+	count = task_list_snapshot(snapshot, MAX_SNAPSHOT);
+	uint32_t const second = micros() - start;
+	printf("%ld tasks, first snapshot %lu us, second %lu us\n", count, first, second);
+	for (int32_t i = 0; i < count && i < MAX_SNAPSHOT; i++) {
+		printf("%-32s %-9s %2lu %6lu %10lu\n", snapshot[i].name, state_names[snapshot[i].state], snapshot[i].priority,
+		       snapshot[i].stack_free, snapshot[i].cpu_time);
+	}
+
+	while (true) task_delay(1000);
+}
@@ -0,0 +1,235 @@
+/**
+ * \file tests/throughput_bench.c
+ *
+ * Throughput benchmarks for the serial output, uSD, generic serial and display
+ *
+ * Where tests/kernel_bench.c times the kernel's primitives, this times whole
+ * subsystems through the same paths programs use: write() to a serial stream
+ * (ser_write_r) with COBS on and off, write() and read() of a file on the uSD
+ * card (usd_write_r and usd_read_r), write() and read() of /dev/1 and /dev/2
+ * (dev_driver.c), and a full screen redraw with lv_refr_now(). The results are
+ * printed as CSV with one row per case:
+ *
+ *   name,param,ops,bytes,us,bytes_per_s,us_per_op
+ *
+ * where param is the message, chunk or block size in bytes (the pixel count
+ * for display rows), ops is the number of writes, reads, round trips or
+ * redraws, and us is the total time they took. For gser_latency rows
+ * us_per_op is the mean time from writing a byte on port 1 to reading it on
+ * port 2.
+ *
+ * The serial rows go to a 'bnch' stream, which the terminal doesn't show with
+ * COBS on. With COBS off every stream shares the wire, so those rows' dots
+ * show up in the terminal. Each case writes far more than the output buffer
+ * holds, so the rate is close to what the wire takes.
+ *
+ * The uSD rows need a card, which gets a bench.bin file, and the generic
+ * serial rows need ports 1 and 2 wired to each other. Rows for whatever is
+ * missing are printed with ops 0.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "pros/apix.h"
+
+#define SER_TOTAL 32768
+#define USD_TOTAL 262144
+#define USD_FILE "/usd/bench.bin"
+#define GSER_TOTAL 16384
+#define GSER_BAUDRATE 921600
+#define GSER_ROUND_TRIPS 50
+#define GSER_TIMEOUT 2000
+#define DISPLAY_FRAMES 20
+
+static uint8_t buf[16384];
+static const size_t ser_sizes[] = {16, 64, 256, 1024};
+static const size_t usd_chunks[] = {64, 512, 4096, 16384};
+static const size_t gser_blocks[] = {1, 64, 1024};
+
+static void row(const char* name, uint32_t param, uint32_t ops, uint32_t bytes, uint64_t us) {
+	if (ops == 0 || us == 0) {
+		printf("%s,%lu,0,0,0,,\n", name, param);
+		return;
+	}
+	printf("%s,%lu,%lu,%lu,%llu,%llu,%llu\n", name, param, ops, bytes, us, (uint64_t)bytes * 1000000 / us, us / ops);
+}
+
+// Lets the serial daemon send what is queued, so one case doesn't slow the next
+static void ser_drain(void) {
+	fflush(stdout);
+	delay(500);
+}
+
+static void bench_serial(bool cobs) {
+	int const fd = open("/ser/bnch", O_WRONLY);
+	if (fd < 0) return;
+	fdctl(fd, SERCTL_ACTIVATE, NULL);
+	memset(buf, '.', sizeof(buf));
+	for (size_t i = 0; i < sizeof(ser_sizes) / sizeof(ser_sizes[0]); i++) {
+		size_t const size = ser_sizes[i];
+		buf[size - 1] = '\n';
+		ser_drain();
+		serctl(cobs ? SERCTL_ENABLE_COBS : SERCTL_DISABLE_COBS, NULL);
+		uint32_t ops = 0;
+		uint64_t const start = micros();
+		for (; ops * size < SER_TOTAL; ops++) {
+			if (write(fd, buf, size) != (ssize_t)size) break;
+		}
+		uint64_t const us = micros() - start;
+		ser_drain();
+		serctl(SERCTL_ENABLE_COBS, NULL);
+		row(cobs ? "ser_cobs" : "ser_raw", size, ops, ops * size, us);
+		buf[size - 1] = '.';
+	}
+	fdctl(fd, SERCTL_DEACTIVATE, NULL);
+	close(fd);
+}
+
+static void bench_usd(void) {
+	for (size_t i = 0; i < sizeof(usd_chunks) / sizeof(usd_chunks[0]); i++) {
+		size_t const chunk = usd_chunks[i];
+		uint32_t ops = 0;
+		uint64_t us = 0;
+		int fd = usd_is_installed() ? open(USD_FILE, O_WRONLY | O_CREAT | O_TRUNC) : -1;
+		if (fd >= 0) {
+			for (size_t j = 0; j < chunk; j++) buf[j] = j;
+			uint64_t const start = micros();
+			for (; ops * chunk < USD_TOTAL; ops++) {
+				if (write(fd, buf, chunk) != (ssize_t)chunk) break;
+			}
+			// the data only has to be on the card once the file is closed
+			close(fd);
+			us = micros() - start;
+		}
+		row("usd_write", chunk, ops, ops * chunk, us);
+
+		uint32_t const written = ops;
+		ops = 0;
+		us = 0;
+		fd = written ? open(USD_FILE, O_RDONLY) : -1;
+		if (fd >= 0) {
+			uint64_t const start = micros();
+			for (; ops < written; ops++) {
+				if (read(fd, buf, chunk) != (ssize_t)chunk) break;
+			}
+			us = micros() - start;
+			close(fd);
+		}
+		row("usd_read", chunk, ops, ops * chunk, us);
+	}
+}
+
+// Port 2's reader, which notes when each read returned
+static int gser_rx;
+static sem_t gser_rx_sem;
+static volatile uint32_t gser_received;
+static volatile uint64_t gser_last_rx;
+
+static void gser_reader(void* ign) {
+	static uint8_t rx[1024];
+	while (true) {
+		int const len = read(gser_rx, rx, sizeof(rx));
+		if (len <= 0) continue;
+		gser_last_rx = micros();
+		gser_received += len;
+		sem_post(gser_rx_sem);
+	}
+}
+
+static void bench_gser(void) {
+	static bool started = false;
+	static int tx;
+	if (!started) {
+		tx = open("/dev/1", O_RDWR);
+		gser_rx = open("/dev/2", O_RDWR);
+		fdctl(tx, DEVCTL_SET_BAUDRATE, (void*)GSER_BAUDRATE);
+		fdctl(gser_rx, DEVCTL_SET_BAUDRATE, (void*)GSER_BAUDRATE);
+		gser_rx_sem = sem_create(UINT32_MAX, 0);
+		task_create(gser_reader, NULL, TASK_PRIORITY_DEFAULT + 1, TASK_STACK_DEPTH_DEFAULT, "Bench Reader");
+		started = true;
+		delay(10);
+	}
+
+	for (size_t i = 0; i < sizeof(gser_blocks) / sizeof(gser_blocks[0]); i++) {
+		size_t const block = gser_blocks[i];
+		memset(buf, 0x55, block);
+		uint32_t ops = 0;
+		uint32_t const base = gser_received;
+		uint64_t const start = micros();
+		for (; ops * block < GSER_TOTAL; ops++) {
+			if (write(tx, buf, block) != (ssize_t)block) break;
+		}
+		uint32_t const deadline = millis() + GSER_TIMEOUT;
+		while (gser_received - base < ops * block && (int32_t)(deadline - millis()) > 0) delay(1);
+		uint32_t const received = gser_received - base;
+		row("gser_throughput", block, received == ops * block ? ops : 0, received, gser_last_rx - start);
+	}
+
+	uint32_t trips = 0;
+	uint64_t total = 0;
+	while (sem_wait(gser_rx_sem, 0)) continue;
+	for (; trips < GSER_ROUND_TRIPS; trips++) {
+		uint64_t const start = micros();
+		if (write(tx, buf, 1) != 1 || !sem_wait(gser_rx_sem, 100)) break;
+		total += gser_last_rx - start;
+		delay(2);
+	}
+	row("gser_latency", 1, trips == GSER_ROUND_TRIPS ? trips : 0, trips, total);
+}
+
+static void bench_display(void) {
+	static lv_obj_t* chart = NULL;
+	static lv_chart_series_t* series;
+	if (chart == NULL) {
+		// something a program might really draw over the whole screen
+		for (int i = 0; i < 4; i++) {
+			lv_obj_t* btn = lv_btn_create(lv_scr_act(), NULL);
+			lv_obj_set_size(btn, 100, 50);
+			lv_obj_set_pos(btn, 10 + 115 * i, 10);
+			lv_label_set_text(lv_label_create(btn, NULL), "Bench");
+		}
+		chart = lv_chart_create(lv_scr_act(), NULL);
+		lv_obj_set_size(chart, 460, 160);
+		lv_obj_set_pos(chart, 10, 70);
+		series = lv_chart_add_series(chart, LV_COLOR_RED);
+	}
+
+	// Keep the display daemon out of LVGL while this redraws
+	display_refresh_mode_e_t const mode = display_get_refresh_mode();
+	display_set_refresh_mode(E_DISPLAY_REFRESH_FROZEN);
+	delay(50);
+	uint64_t us = 0;
+	for (int i = 0; i < DISPLAY_FRAMES; i++) {
+		lv_chart_set_next(chart, series, i * 5);
+		lv_obj_invalidate(lv_scr_act());
+		uint64_t const start = micros();
+		lv_refr_now();
+		us += micros() - start;
+	}
+	display_set_refresh_mode(mode);
+	uint32_t const pixels = LV_HOR_RES * LV_VER_RES;
+	row("display_full", pixels, DISPLAY_FRAMES, DISPLAY_FRAMES * pixels * sizeof(lv_color_t), us);
+}
+
+void opcontrol() {
+	while (true) {
+		printf("name,param,ops,bytes,us,bytes_per_s,us_per_op\n");
+		bench_serial(true);
+		bench_serial(false);
+		bench_usd();
+		bench_gser();
+		bench_display();
+		printf("\n");
+		delay(10000);
+	}
+}
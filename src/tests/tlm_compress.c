@@ -0,0 +1,63 @@
+/**
+ * \file tests/tlm_compress.c
+ *
+ * Test code for telemetry compression
+ *
+ * Sends the same slowly changing state record uncompressed on one ID and delta
+ * encoded on another, and a repetitive 2 KB block uncompressed and LZ4
+ * compressed, then prints the bytes each stream queued. The 'tlmz' stream
+ * should queue several times less than the 'tlm' stream, and the host should
+ * decode both to the same records.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+typedef struct __attribute__((packed)) state {
+	uint32_t time;
+	float x, y, theta;
+	int32_t left, right;
+} state_s_t;
+SER_TLM_RECORD(state_s_t, 1, "Ifffii");
+
+#define BLOCK_SIZE 2048
+static uint8_t block[BLOCK_SIZE];
+
+static uint32_t queued(uint32_t stream_id) {
+	ser_stream_stats_s_t stats = {.stream_id = stream_id};
+	serctl(SERCTL_GET_STREAM_STATS, &stats);
+	return stats.sent;
+}
+
+void opcontrol() {
+	serctl(SERCTL_ACTIVATE, (void*)SER_TLM_STREAM_ID);
+	ser_tlm_describe(&state_s_t_tlm);
+	ser_tlm_set_compression(2, E_SER_TLM_COMPRESS_DELTA);
+	ser_tlm_set_compression(4, E_SER_TLM_COMPRESS_LZ4);
+
+	state_s_t state = {0};
+	for (int i = 0; i < 500; i++) {
+		state.time = millis();
+		state.x += 0.01f;
+		state.theta = 0.1f * (i % 20);
+		state.left = state.right = i;
+		ser_tlm_write(1, &state, sizeof(state));
+		ser_tlm_write(2, &state, sizeof(state));
+		delay(10);
+	}
+	printf("state: %lu bytes raw, %lu compressed\n", queued(SER_TLM_STREAM_ID), queued(SER_TLM_Z_STREAM_ID));
+
+	for (int i = 0; i < BLOCK_SIZE; i++) block[i] = (i / 16) % 7;
+	uint32_t const raw = queued(SER_TLM_STREAM_ID), compressed = queued(SER_TLM_Z_STREAM_ID);
+	ser_tlm_write(3, block, BLOCK_SIZE);
+	ser_tlm_write(4, block, BLOCK_SIZE);
+	printf("block: %lu bytes raw, %lu compressed\n", queued(SER_TLM_STREAM_ID) - raw,
+	       queued(SER_TLM_Z_STREAM_ID) - compressed);
+	while (true) delay(1000);
+}
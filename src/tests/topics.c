@@ -0,0 +1,60 @@
+/**
+ * \file tests/topics.c
+ *
+ * Test code for topics
+ *
+ * A producer task publishes a counter on a topic every 10 ms, which opcontrol
+ * receives both through a queued subscription and alongside the kernel's
+ * controller topic by waiting for notification bits. The queue should see every
+ * count with nothing dropped, and the master controller's left stick should be
+ * printed as it moves.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <stdio.h>
+
+#include "main.h"
+#include "pros/apix.h"
+
+#define COUNTER_BIT 0x1
+#define CONTROLLER_BIT 0x2
+
+static void producer(void* topic) {
+	uint32_t count = 0;
+	uint32_t now = millis();
+	while (true) {
+		count++;
+		topic_publish(topic, &count);
+		task_delay_until(&now, 10);
+	}
+}
+
+void opcontrol() {
+	topic_t counter = topic_create("test/counter", sizeof(uint32_t));
+	topic_t controllers = topic_find(TOPIC_CONTROLLERS);
+	topic_sub_t counter_sub = topic_subscribe(counter, 16, COUNTER_BIT);
+	topic_sub_t controller_sub = topic_subscribe(controllers, 0, CONTROLLER_BIT);
+	task_create(producer, counter, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Producer");
+
+	uint32_t expected = 1;
+	int32_t left_y = 0;
+	while (true) {
+		task_notify_take(true, TIMEOUT_MAX);
+		uint32_t count;
+		while (topic_sub_receive(counter_sub, &count, 0)) {
+			if (count != expected) printf("expected %lu, got %lu\n", expected, count);
+			expected = count + 1;
+			if (count % 100 == 0) printf("count %lu, %lu dropped\n", count, topic_sub_get_dropped(counter_sub));
+		}
+		controller_state_s_t states[2];
+		if (topic_sub_receive(controller_sub, states, 0) && states[E_CONTROLLER_MASTER].analog[1] != left_y) {
+			left_y = states[E_CONTROLLER_MASTER].analog[1];
+			printf("left y %ld\n", left_y);
+		}
+	}
+}
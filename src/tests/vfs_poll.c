@@ -0,0 +1,44 @@
+/**
+ * \file tests/vfs_poll.c
+ *
+ * Test code for waiting on several files at once
+ *
+ * NOTE: There should be generic serial devices plugged into ports 5 and 6.
+ * Anything typed into the terminal or received on either port is echoed back
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <fcntl.h>
+
+#include "main.h"
+#include "pros/apix.h"
+
+void opcontrol() {
+	vfs_pollfd_s_t fds[] = {
+	    {.fd = STDIN_FILENO, .events = VFS_POLLIN},
+	    {.fd = open("/dev/5", O_RDWR | O_NONBLOCK), .events = VFS_POLLIN},
+	    {.fd = open("/dev/6", O_RDWR | O_NONBLOCK), .events = VFS_POLLIN},
+	};
+	char buf[64];
+	while (true) {
+		int32_t ready = vfs_poll(fds, 3, 1000);
+		if (ready == 0) {
+			printf("nothing for a second\n");
+			continue;
+		}
+		for (size_t i = 0; i < 3; i++) {
+			if (fds[i].revents & VFS_POLLNVAL) {
+				printf("fd %d isn't open\n", fds[i].fd);
+			} else if (fds[i].revents & VFS_POLLIN) {
+				ssize_t len = read(fds[i].fd, buf, sizeof(buf) - 1);
+				buf[len > 0 ? len : 0] = 0;
+				printf("fd %d: %s\n", fds[i].fd, buf);
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+/**
+ * \file tests/vision_frames.c
+ *
+ * Test code for vision snapshots and frame notifications
+ *
+ * Waits for every frame of a Vision Sensor on port 1 and reports how many
+ * frames arrive each second, which should be about 50 while the sensor sees
+ * something moving, along with the largest object of signature 1 in the
+ * latest frame.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+
+#define VISION_PORT 1
+
+void opcontrol() {
+	vision_snapshot_s_t snapshot;
+	vision_filter_s_t filter = {.signature = 1, .min_area = 0, .max_area = 0};
+	vision_object_s_t largest;
+
+	uint32_t frames = 0;
+	uint32_t second = millis();
+	while (true) {
+		int32_t frame = vision_wait_for_frame(VISION_PORT, 1000);
+		if (frame == PROS_ERR) {
+			printf("No frame for a second (errno %d)\n", errno);
+			continue;
+		}
+		frames++;
+		if (millis() - second >= 1000) {
+			vision_snapshot_get(VISION_PORT, &snapshot);
+			printf("%lu frames in the last second, frame %ld has %lu objects\n", frames, frame, snapshot.count);
+			if (vision_snapshot_filter(&snapshot, &filter, 1, &largest) == 1) {
+				printf("Largest signature 1 object at (%d, %d), %dx%d\n", largest.x_middle_coord, largest.y_middle_coord,
+				       largest.width, largest.height);
+			}
+			frames = 0;
+			second = millis();
+		}
+	}
+}
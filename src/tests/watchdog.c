@@ -0,0 +1,59 @@
+/**
+ * \file tests/watchdog.c
+ *
+ * Test code for the task watchdog
+ *
+ * A worker task registers with a 20 ms deadline and kicks every 5 ms, then
+ * stalls for 100 ms once a second. The action should run once per stall,
+ * about 20 ms into it, and stop the motor on port 1, which is otherwise
+ * driven at half speed. Kicking again before a stall is over must not run
+ * the action a second time, and deleting the worker must not trip it at all.
+ *
+ * Copyright (c) 2017-2020, Purdue University ACM SIGBots.
+ * All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include "main.h"
+#include "pros/apix.h"
+
+static volatile uint32_t stall_start;
+static volatile uint32_t actions;
+static volatile uint32_t stalls;
+
+static void brake(task_t task, uint32_t overdue, void* param) {
+	motor_move_velocity(1, 0);
+	actions++;
+	printf("%s missed its deadline %lu ms into a stall, %lu ms over\n", task_get_name(task), millis() - stall_start,
+	       overdue);
+}
+
+static void worker(void* ign) {
+	watchdog_register(20);
+	for (int i = 0;; i++) {
+		if (i % 200 == 199) {
+			stall_start = millis();
+			stalls++;
+			delay(100);
+			motor_move_velocity(1, 100);
+		}
+		watchdog_kick();
+		delay(5);
+	}
+}
+
+void opcontrol() {
+	motor_set_brake_mode(1, E_MOTOR_BRAKE_BRAKE);
+	motor_move_velocity(1, 100);
+	watchdog_set_action(brake, NULL);
+	task_t task = task_create(worker, NULL, TASK_PRIORITY_DEFAULT, TASK_STACK_DEPTH_DEFAULT, "Watchdog Worker");
+	delay(5500);
+	task_delete(task);
+	delay(100);
+	watchdog_stats_s_t stats;
+	watchdog_get_stats(&stats);
+	printf("%lu actions for %lu stalls, %lu misses, last by %s\n", actions, stalls, stats.misses, stats.last_task_name);
+	motor_move_velocity(1, 0);
+}